@@ -46,6 +46,7 @@
 #include "driverlib/timer.h"
 #include "driverlib/rom.h"
 #include "grlib/grlib.h"
+#include "defines.h"
 #include "Kentec320x240x16_ssd2119_8bit.h"
 
 
@@ -245,6 +246,9 @@
 //
 //*****************************************************************************
 typedef void (*pfnWriteData)(uint16_t usData);
+typedef void (*pfnWriteDataRepeat)(uint16_t usData, uint32_t ulCount);
+typedef void (*pfnWriteDataIndexed)(const uint8_t *pucIndex, uint32_t ulCount,
+                                    const uint16_t *pusPalette);
 typedef void (*pfnWriteCommand)(uint8_t ucData);
 
 //*****************************************************************************
@@ -254,11 +258,36 @@ typedef void (*pfnWriteCommand)(uint8_t ucData);
 //*****************************************************************************
 
 static void WriteDataGPIO(uint16_t usData);
+static void WriteDataRepeatGPIO(uint16_t usData, uint32_t ulCount);
+static void WriteDataIndexedGPIO(const uint8_t *pucIndex, uint32_t ulCount,
+                                 const uint16_t *pusPalette);
 static void WriteCommandGPIO(uint8_t ucData);
 
 pfnWriteData WriteData = WriteDataGPIO;
+pfnWriteDataRepeat WriteDataRepeat = WriteDataRepeatGPIO;
+pfnWriteDataIndexed WriteDataIndexed = WriteDataIndexedGPIO;
 pfnWriteCommand WriteCommand = WriteCommandGPIO;
 
+//*****************************************************************************
+//
+// The entry mode last written to the controller.
+//
+//*****************************************************************************
+static uint16_t g_ui16EntryMode;
+
+//*****************************************************************************
+//
+// The bus transfer counters.  LCD_STATS_ADD() compiles to nothing unless
+// LCD_STATS_ENABLE is defined.
+//
+//*****************************************************************************
+#ifdef LCD_STATS_ENABLE
+static tLCDBusStats g_sLCDStats;
+#define LCD_STATS_ADD(field, n) (g_sLCDStats.field += (n))
+#else
+#define LCD_STATS_ADD(field, n)
+#endif
+
 void LED_ON(void)
 {
 HWREG(LCD_BACKLIGHT_BASE + GPIO_O_DATA + (LCD_BACKLIGHT_PIN << 2)) = 0;
@@ -284,6 +313,8 @@ HWREG(USER_LED_BASE + GPIO_O_DATA + (USER_LED_B_PIN << 2)) = USER_LED_B_PIN;
 static void
 WriteDataGPIO(uint16_t usData)
 {
+    LCD_STATS_ADD(ui32DataWords, 1);
+
 	//
     // Write the most significant byte of the data to the bus.
     //
@@ -328,6 +359,93 @@ WriteDataGPIO(uint16_t usData)
     
 }
 
+//*****************************************************************************
+//
+// Writes a data word to the SSD2119 while it is already selected, with the
+// same write enable timing as WriteDataGPIO().  This is the body of the burst
+// writes, which keep the controller selected for the whole burst and so save
+// two port writes and a call per word.
+//
+//*****************************************************************************
+#define WRITE_DATA_SELECTED(usData)                                           \
+{                                                                             \
+    SET_LCD_DATA((usData) >> 8);                                              \
+    HWREG(LCD_WR_BASE + GPIO_O_DATA + (LCD_WR_PIN << 2)) = 0;                 \
+    HWREG(LCD_WR_BASE + GPIO_O_DATA + (LCD_WR_PIN << 2)) = 0;                 \
+    HWREG(LCD_WR_BASE + GPIO_O_DATA + (LCD_WR_PIN << 2)) = 0;                 \
+    HWREG(LCD_WR_BASE + GPIO_O_DATA + (LCD_WR_PIN << 2)) = LCD_WR_PIN;        \
+    SET_LCD_DATA(usData);                                                     \
+    HWREG(LCD_WR_BASE + GPIO_O_DATA + (LCD_WR_PIN << 2)) = 0;                 \
+    HWREG(LCD_WR_BASE + GPIO_O_DATA + (LCD_WR_PIN << 2)) = 0;                 \
+    HWREG(LCD_WR_BASE + GPIO_O_DATA + (LCD_WR_PIN << 2)) = 0;                 \
+    HWREG(LCD_WR_BASE + GPIO_O_DATA + (LCD_WR_PIN << 2)) = LCD_WR_PIN;        \
+    HWREG(LCD_WR_BASE + GPIO_O_DATA + (LCD_WR_PIN << 2)) = LCD_WR_PIN;        \
+    HWREG(LCD_WR_BASE + GPIO_O_DATA + (LCD_WR_PIN << 2)) = LCD_WR_PIN;        \
+}
+
+//*****************************************************************************
+//
+// Writes the same data word to the SSD2119 a number of times, as one burst.
+//
+//*****************************************************************************
+static void
+WriteDataRepeatGPIO(uint16_t usData, uint32_t ulCount)
+{
+    LCD_STATS_ADD(ui32DataWords, ulCount);
+
+    HWREG(LCD_CS_BASE + GPIO_O_DATA + (LCD_CS_PIN << 2)) = 0;
+    for(; ulCount; ulCount--)
+    {
+        WRITE_DATA_SELECTED(usData);
+    }
+    HWREG(LCD_CS_BASE + GPIO_O_DATA + (LCD_CS_PIN << 2)) = LCD_CS_PIN;
+}
+
+//*****************************************************************************
+//
+// Writes palette colors to the SSD2119, as one burst.
+//
+//*****************************************************************************
+static void
+WriteDataIndexedGPIO(const uint8_t *pucIndex, uint32_t ulCount,
+                     const uint16_t *pusPalette)
+{
+    uint16_t usData;
+
+    LCD_STATS_ADD(ui32DataWords, ulCount);
+
+    HWREG(LCD_CS_BASE + GPIO_O_DATA + (LCD_CS_PIN << 2)) = 0;
+    for(; ulCount; ulCount--)
+    {
+        usData = pusPalette[*pucIndex++];
+        WRITE_DATA_SELECTED(usData);
+    }
+    HWREG(LCD_CS_BASE + GPIO_O_DATA + (LCD_CS_PIN << 2)) = LCD_CS_PIN;
+}
+
+//*****************************************************************************
+//
+// Writes display format colors, stored low byte first, to the SSD2119 as one
+// burst.
+//
+//*****************************************************************************
+static void
+WriteDataBytesGPIO(const uint8_t *pucData, uint32_t ulCount)
+{
+    uint16_t usData;
+
+    LCD_STATS_ADD(ui32DataWords, ulCount);
+
+    HWREG(LCD_CS_BASE + GPIO_O_DATA + (LCD_CS_PIN << 2)) = 0;
+    for(; ulCount; ulCount--)
+    {
+        usData = pucData[0] | (pucData[1] << 8);
+        pucData += 2;
+        WRITE_DATA_SELECTED(usData);
+    }
+    HWREG(LCD_CS_BASE + GPIO_O_DATA + (LCD_CS_PIN << 2)) = LCD_CS_PIN;
+}
+
 //*****************************************************************************
 //
 // Writes a command to the SSD2119.  This function implements the basic GPIO
@@ -338,6 +456,8 @@ static void
 WriteCommandGPIO(uint8_t ucData)
 
 {
+    LCD_STATS_ADD(ui32Commands, 1);
+
     //
     // Write the most significant byte of the data to the bus. This is always
     // 0 since commands are no more than 8 bits currently.
@@ -392,6 +512,24 @@ WriteCommandGPIO(uint8_t ucData)
 	HWREG(LCD_CS_BASE + GPIO_O_DATA + (LCD_CS_PIN << 2)) = LCD_CS_PIN;
 }
 
+//*****************************************************************************
+//
+// Sets the cursor increment of the SSD2119, unless it is set that way
+// already.  Primitives drawn one after another in the same direction, as the
+// spans replayed by the display list (see displaylist.c), so skip the command.
+//
+//*****************************************************************************
+static void
+EntryModeSet(uint16_t ui16Mode)
+{
+    if(ui16Mode != g_ui16EntryMode)
+    {
+        WriteCommand(SSD2119_ENTRY_MODE_REG);
+        WriteData(ui16Mode);
+        g_ui16EntryMode = ui16Mode;
+    }
+}
+
 //*****************************************************************************
 //
 // Initializes the pins required for the GPIO-based LCD interface.
@@ -552,6 +690,7 @@ Kentec320x240x16_SSD2119Init(void)
     //
     WriteCommand(SSD2119_ENTRY_MODE_REG);
     WriteData(ENTRY_MODE_DEFAULT);
+    g_ui16EntryMode = ENTRY_MODE_DEFAULT;
 
     //
     // Enable the display.
@@ -644,6 +783,9 @@ static void
 Kentec320x240x16_SSD2119PixelDraw(void *pvDisplayData, int32_t lX, int32_t lY,
                                    uint32_t ulValue)
 {
+    LCD_STATS_ADD(pui32Calls[LCD_PRIM_PIXEL], 1);
+    LCD_STATS_ADD(pui32Pixels[LCD_PRIM_PIXEL], 1);
+
     //
     // Set the X address of the display cursor.
     //
@@ -697,11 +839,13 @@ Kentec320x240x16_SSD2119PixelDrawMultiple(void *pvDisplayData, int32_t lX,
 {
     uint32_t ulByte;
 
+    LCD_STATS_ADD(pui32Calls[LCD_PRIM_MULTIPLE], 1);
+    LCD_STATS_ADD(pui32Pixels[LCD_PRIM_MULTIPLE], lCount);
+
     //
     // Set the cursor increment to left to right, followed by top to bottom.
     //
-    WriteCommand(SSD2119_ENTRY_MODE_REG);
-    WriteData(MAKE_ENTRY_MODE(HORIZ_DIRECTION));
+    EntryModeSet(MAKE_ENTRY_MODE(HORIZ_DIRECTION));
 
     //
     // Set the starting X address of the display cursor.
@@ -920,11 +1064,13 @@ static void
 Kentec320x240x16_SSD2119LineDrawH(void *pvDisplayData, int32_t lX1, int32_t lX2,
                                    int32_t lY, uint32_t ulValue)
 {
+    LCD_STATS_ADD(pui32Calls[LCD_PRIM_LINE_H], 1);
+    LCD_STATS_ADD(pui32Pixels[LCD_PRIM_LINE_H], lX2 - lX1 + 1);
+
     //
     // Set the cursor increment to left to right, followed by top to bottom.
     //
-    WriteCommand(SSD2119_ENTRY_MODE_REG);
-    WriteData(MAKE_ENTRY_MODE(HORIZ_DIRECTION));
+    EntryModeSet(MAKE_ENTRY_MODE(HORIZ_DIRECTION));
 
     //
     // Set the starting X address of the display cursor.
@@ -976,11 +1122,13 @@ static void
 Kentec320x240x16_SSD2119LineDrawV(void *pvDisplayData, int32_t lX, int32_t lY1,
                                    int32_t lY2, uint32_t ulValue)
 {
+    LCD_STATS_ADD(pui32Calls[LCD_PRIM_LINE_V], 1);
+    LCD_STATS_ADD(pui32Pixels[LCD_PRIM_LINE_V], lY2 - lY1 + 1);
+
     //
     // Set the cursor increment to top to bottom, followed by left to right.
     //
-    WriteCommand(SSD2119_ENTRY_MODE_REG);
-    WriteData(MAKE_ENTRY_MODE(VERT_DIRECTION));
+    EntryModeSet(MAKE_ENTRY_MODE(VERT_DIRECTION));
 
     //
     // Set the X address of the display cursor.
@@ -1034,11 +1182,16 @@ Kentec320x240x16_SSD2119RectFill(void *pvDisplayData, const tRectangle *pRect,
 {
     int32_t lCount;
 
+    LCD_STATS_ADD(pui32Calls[LCD_PRIM_RECT], 1);
+    LCD_STATS_ADD(pui32Pixels[LCD_PRIM_RECT],
+                  ((pRect->i16XMax - pRect->i16XMin + 1) *
+                   (pRect->i16YMax - pRect->i16YMin + 1)));
+    LCD_STATS_ADD(ui32WindowSetups, 2);
+
     //
     // Write the Y extents of the rectangle.
     //
-    WriteCommand(SSD2119_ENTRY_MODE_REG);
-    WriteData(MAKE_ENTRY_MODE(HORIZ_DIRECTION));
+    EntryModeSet(MAKE_ENTRY_MODE(HORIZ_DIRECTION));
 
     //
     // Write the X extents of the rectangle.
@@ -1161,6 +1314,370 @@ Kentec320x240x16_SSD2119Flush(void *pvDisplayData)
     //
 }
 
+//*****************************************************************************
+//
+// Programs the RAM window to a rectangle, left to right then top to bottom,
+// and starts a RAM write at its upper left corner.
+//
+//*****************************************************************************
+static void
+WindowWriteStart(int32_t lX, int32_t lY, int32_t lWidth, int32_t lHeight)
+{
+    //
+    // Set the cursor increment to left to right, followed by top to bottom.
+    //
+    EntryModeSet(MAKE_ENTRY_MODE(HORIZ_DIRECTION));
+
+    //
+    // Write the X extents of the rectangle.
+    //
+    WriteCommand(SSD2119_H_RAM_START_REG);
+#if (defined PORTRAIT) || (defined LANDSCAPE)
+    WriteData(MAPPED_X(lX + lWidth - 1, lY + lHeight - 1));
+#else
+    WriteData(MAPPED_X(lX, lY));
+#endif
+
+    WriteCommand(SSD2119_H_RAM_END_REG);
+#if (defined PORTRAIT) || (defined LANDSCAPE)
+    WriteData(MAPPED_X(lX, lY));
+#else
+    WriteData(MAPPED_X(lX + lWidth - 1, lY + lHeight - 1));
+#endif
+
+    //
+    // Write the Y extents of the rectangle.
+    //
+    WriteCommand(SSD2119_V_RAM_POS_REG);
+#if (defined LANDSCAPE_FLIP) || (defined PORTRAIT)
+    WriteData(MAPPED_Y(lX, lY) |
+             (MAPPED_Y(lX + lWidth - 1, lY + lHeight - 1) << 8));
+#else
+    WriteData(MAPPED_Y(lX + lWidth - 1, lY + lHeight - 1) |
+             (MAPPED_Y(lX, lY) << 8));
+#endif
+
+    //
+    // Set the display cursor to the upper left of the rectangle and start
+    // the write.
+    //
+    WriteCommand(SSD2119_X_RAM_ADDR_REG);
+    WriteData(MAPPED_X(lX, lY));
+
+    WriteCommand(SSD2119_Y_RAM_ADDR_REG);
+    WriteData(MAPPED_Y(lX, lY));
+
+    WriteCommand(SSD2119_RAM_DATA_REG);
+}
+
+//*****************************************************************************
+//
+// Resets the RAM window to the entire screen.
+//
+//*****************************************************************************
+static void
+WindowReset(void)
+{
+    WriteCommand(SSD2119_H_RAM_START_REG);
+    WriteData(0x0000);
+    WriteCommand(SSD2119_H_RAM_END_REG);
+    WriteData(0x013F);
+    WriteCommand(SSD2119_V_RAM_POS_REG);
+    WriteData(0xEF00);
+}
+
+//*****************************************************************************
+//
+//! Draws a rectangle of pixels that are already in the display format.
+//!
+//! \param lX is the X coordinate of the upper left corner.
+//! \param lY is the Y coordinate of the upper left corner.
+//! \param lWidth is the width of the rectangle.
+//! \param lHeight is the height of the rectangle.
+//! \param pui16Data points to the pixels, row by row from the top, as
+//! returned by DpyColorTranslate().
+//!
+//! This function programs the RAM window to the rectangle once and streams
+//! the pixels into it, so that a pre-rendered sprite costs one data word per
+//! pixel plus the window setup, instead of a cursor setup per row as
+//! GrImageDraw() takes.  It is not a grlib primitive, so the rectangle is not
+//! clipped and must lie within the display.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Kentec320x240x16_SSD2119ImageDraw(int32_t lX, int32_t lY, int32_t lWidth,
+                                  int32_t lHeight, const uint16_t *pui16Data)
+{
+    int32_t lCount;
+
+    LCD_STATS_ADD(pui32Calls[LCD_PRIM_IMAGE], 1);
+    LCD_STATS_ADD(pui32Pixels[LCD_PRIM_IMAGE], lWidth * lHeight);
+    LCD_STATS_ADD(ui32WindowSetups, 2);
+
+    WindowWriteStart(lX, lY, lWidth, lHeight);
+    for(lCount = lWidth * lHeight; lCount > 0; lCount--)
+    {
+        WriteData(*pui16Data++);
+    }
+    WindowReset();
+}
+
+//*****************************************************************************
+//
+//! Draws a rectangle of 1 BPP pixels in two colors.
+//!
+//! \param lX is the X coordinate of the upper left corner.
+//! \param lY is the Y coordinate of the upper left corner.
+//! \param lWidth is the width of the rectangle.
+//! \param lHeight is the height of the rectangle.
+//! \param pui8Data points to the pixels, row by row from the top, most
+//! significant bit first, with each row starting on a byte boundary.
+//! \param ui32Foreground is the color of the set pixels, as returned by
+//! DpyColorTranslate().
+//! \param ui32Background is the color of the clear pixels.
+//!
+//! This is the 1 BPP counterpart of Kentec320x240x16_SSD2119ImageDraw(), used
+//! to draw pre-rendered glyphs in whatever colors the text is drawn with.  The
+//! rectangle is not clipped and must lie within the display.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Kentec320x240x16_SSD2119GlyphDraw(int32_t lX, int32_t lY, int32_t lWidth,
+                                  int32_t lHeight, const uint8_t *pui8Data,
+                                  uint32_t ui32Foreground,
+                                  uint32_t ui32Background)
+{
+    uint32_t ulByte;
+    int32_t lRow, lCol;
+
+    LCD_STATS_ADD(pui32Calls[LCD_PRIM_GLYPH], 1);
+    LCD_STATS_ADD(pui32Pixels[LCD_PRIM_GLYPH], lWidth * lHeight);
+    LCD_STATS_ADD(ui32WindowSetups, 2);
+
+    WindowWriteStart(lX, lY, lWidth, lHeight);
+    for(lRow = 0; lRow < lHeight; lRow++)
+    {
+        ulByte = 0;
+        for(lCol = 0; lCol < lWidth; lCol++)
+        {
+            //
+            // Get the next byte of pixel data at the start of each byte.
+            //
+            if((lCol & 7) == 0)
+            {
+                ulByte = *pui8Data++;
+            }
+            WriteData((ulByte & (0x80 >> (lCol & 7))) ? ui32Foreground :
+                      ui32Background);
+        }
+    }
+    WindowReset();
+}
+
+//*****************************************************************************
+//
+//! Draws a run-length encoded rectangle of pixels.
+//!
+//! \param lX is the X coordinate of the upper left corner.
+//! \param lY is the Y coordinate of the upper left corner.
+//! \param lWidth is the width of the rectangle.
+//! \param lHeight is the height of the rectangle.
+//! \param pui16Runs points to the runs: pairs of a pixel count and a color,
+//! as returned by DpyColorTranslate(), that fill the rectangle row by row from
+//! the top.  A run may continue on the next row.
+//! \param ui32Runs is the number of runs.
+//!
+//! Like Kentec320x240x16_SSD2119ImageDraw(), this function programs the RAM
+//! window once and streams the pixels into it, each run as one burst.  The
+//! rectangle is not clipped and must lie within the display.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Kentec320x240x16_SSD2119RunsDraw(int32_t lX, int32_t lY, int32_t lWidth,
+                                 int32_t lHeight, const uint16_t *pui16Runs,
+                                 uint32_t ui32Runs)
+{
+    LCD_STATS_ADD(pui32Calls[LCD_PRIM_RUNS], 1);
+    LCD_STATS_ADD(pui32Pixels[LCD_PRIM_RUNS], lWidth * lHeight);
+    LCD_STATS_ADD(ui32WindowSetups, 2);
+
+    WindowWriteStart(lX, lY, lWidth, lHeight);
+    for(; ui32Runs; ui32Runs--, pui16Runs += 2)
+    {
+        WriteDataRepeat(pui16Runs[1], pui16Runs[0]);
+    }
+    WindowReset();
+}
+
+//*****************************************************************************
+//
+//! Starts streaming pixels into a rectangle of the display.
+//!
+//! \param lX is the X coordinate of the upper left corner.
+//! \param lY is the Y coordinate of the upper left corner.
+//! \param lWidth is the width of the rectangle.
+//! \param lHeight is the height of the rectangle.
+//!
+//! This function programs the RAM window to the rectangle, for a decoder to
+//! write the pixels of the rectangle, row by row from the top, with
+//! Kentec320x240x16_SSD2119StreamFill() and
+//! Kentec320x240x16_SSD2119StreamPixels() as it produces them, and to end with
+//! Kentec320x240x16_SSD2119StreamEnd().  Nothing else may be drawn on the
+//! display in between.  The rectangle is not clipped and must lie within the
+//! display.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Kentec320x240x16_SSD2119StreamStart(int32_t lX, int32_t lY, int32_t lWidth,
+                                    int32_t lHeight)
+{
+    LCD_STATS_ADD(pui32Calls[LCD_PRIM_STREAM], 1);
+    LCD_STATS_ADD(pui32Pixels[LCD_PRIM_STREAM], lWidth * lHeight);
+    LCD_STATS_ADD(ui32WindowSetups, 2);
+
+    WindowWriteStart(lX, lY, lWidth, lHeight);
+}
+
+//*****************************************************************************
+//
+//! Streams pixels of one color.
+//!
+//! \param ui32Color is the color, as returned by DpyColorTranslate().
+//! \param ui32Count is the number of pixels.
+//!
+//! The pixels are written as one burst, which takes fewer port writes per
+//! pixel than writing them one at a time.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Kentec320x240x16_SSD2119StreamFill(uint32_t ui32Color, uint32_t ui32Count)
+{
+    WriteDataRepeat(ui32Color, ui32Count);
+}
+
+//*****************************************************************************
+//
+//! Streams palette pixels.
+//!
+//! \param pui8Index points to the palette index of each pixel.
+//! \param ui32Count is the number of pixels.
+//! \param pui16Palette points to the palette, in the format returned by
+//! DpyColorTranslate().
+//!
+//! Like Kentec320x240x16_SSD2119StreamFill(), the pixels are written as one
+//! burst.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Kentec320x240x16_SSD2119StreamPixels(const uint8_t *pui8Index,
+                                     uint32_t ui32Count,
+                                     const uint16_t *pui16Palette)
+{
+    WriteDataIndexed(pui8Index, ui32Count, pui16Palette);
+}
+
+//*****************************************************************************
+//
+//! Streams display format pixels.
+//!
+//! \param pui8Data points to the pixels, as returned by DpyColorTranslate(),
+//! low byte first.
+//! \param ui32Count is the number of pixels.
+//!
+//! The pixels are written as one burst, like those of
+//! Kentec320x240x16_SSD2119StreamFill().  The data need not be aligned.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Kentec320x240x16_SSD2119StreamData(const uint8_t *pui8Data, uint32_t ui32Count)
+{
+    WriteDataBytesGPIO(pui8Data, ui32Count);
+}
+
+//*****************************************************************************
+//
+//! Moves the cursor of the stream.
+//!
+//! \param lX is the X coordinate of the next pixel to stream.
+//! \param lY is the Y coordinate of the next pixel to stream.
+//!
+//! The pixels between the last one streamed and the new position keep what
+//! the display shows.  The position must lie within the rectangle given to
+//! Kentec320x240x16_SSD2119StreamStart(); the stream goes on to wrap at its
+//! edges as before.  A move takes three commands and two data words, so it
+//! only pays to skip more than a few pixels this way.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Kentec320x240x16_SSD2119StreamSkip(int32_t lX, int32_t lY)
+{
+    WriteCommand(SSD2119_X_RAM_ADDR_REG);
+    WriteData(MAPPED_X(lX, lY));
+
+    WriteCommand(SSD2119_Y_RAM_ADDR_REG);
+    WriteData(MAPPED_Y(lX, lY));
+
+    WriteCommand(SSD2119_RAM_DATA_REG);
+}
+
+//*****************************************************************************
+//
+//! Ends streaming pixels, and restores the RAM window to the full screen.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Kentec320x240x16_SSD2119StreamEnd(void)
+{
+    WindowReset();
+}
+
+#ifdef LCD_STATS_ENABLE
+//*****************************************************************************
+//
+//! Gets the bus transfer counters of the driver.
+//!
+//! \param psStats is a pointer to the structure that receives the counters.
+//! \param bReset is \b true to clear the counters once they have been read.
+//!
+//! The counters cover every command and data word written to the SSD2119 and
+//! every call of the drawing primitives since they were last cleared.  They
+//! must be read from the same context that draws.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+Kentec320x240x16_SSD2119StatsGet(tLCDBusStats *psStats, bool bReset)
+{
+    static const tLCDBusStats sZero;
+
+    *psStats = g_sLCDStats;
+
+    if(bReset)
+    {
+        g_sLCDStats = sZero;
+    }
+}
+#endif
+
 //*****************************************************************************
 //
 //! The display structure that describes the driver for the Kentec
@@ -46,4 +46,83 @@ extern void Kentec320x240x16_SSD2119SetLCDControl(unsigned char ucMask,
                                                     unsigned char ucVal);
 extern void LED_ON(void);
 extern void LED_OFF(void);
+extern void Kentec320x240x16_SSD2119ImageDraw(int32_t lX, int32_t lY,
+                                              int32_t lWidth, int32_t lHeight,
+                                              const uint16_t *pui16Data);
+extern void Kentec320x240x16_SSD2119GlyphDraw(int32_t lX, int32_t lY,
+                                              int32_t lWidth, int32_t lHeight,
+                                              const uint8_t *pui8Data,
+                                              uint32_t ui32Foreground,
+                                              uint32_t ui32Background);
+extern void Kentec320x240x16_SSD2119RunsDraw(int32_t lX, int32_t lY,
+                                             int32_t lWidth, int32_t lHeight,
+                                             const uint16_t *pui16Runs,
+                                             uint32_t ui32Runs);
+extern void Kentec320x240x16_SSD2119StreamStart(int32_t lX, int32_t lY,
+                                                int32_t lWidth,
+                                                int32_t lHeight);
+extern void Kentec320x240x16_SSD2119StreamFill(uint32_t ui32Color,
+                                               uint32_t ui32Count);
+extern void Kentec320x240x16_SSD2119StreamPixels(const uint8_t *pui8Index,
+                                                 uint32_t ui32Count,
+                                                 const uint16_t *pui16Palette);
+extern void Kentec320x240x16_SSD2119StreamData(const uint8_t *pui8Data,
+                                               uint32_t ui32Count);
+extern void Kentec320x240x16_SSD2119StreamSkip(int32_t lX, int32_t lY);
+extern void Kentec320x240x16_SSD2119StreamEnd(void);
+
+//*****************************************************************************
+//
+// The drawing primitives of the driver, as counted by the bus transfer
+// counters.
+//
+//*****************************************************************************
+#define LCD_PRIM_PIXEL          0           // PixelDraw
+#define LCD_PRIM_MULTIPLE       1           // PixelDrawMultiple
+#define LCD_PRIM_LINE_H         2           // LineDrawH
+#define LCD_PRIM_LINE_V         3           // LineDrawV
+#define LCD_PRIM_RECT           4           // RectFill
+#define LCD_PRIM_IMAGE          5           // ImageDraw
+#define LCD_PRIM_GLYPH          6           // GlyphDraw
+#define LCD_PRIM_RUNS           7           // RunsDraw
+#define LCD_PRIM_STREAM         8           // StreamStart
+#define NUM_LCD_PRIMS           9
+
+#ifdef LCD_STATS_ENABLE
+
+//*****************************************************************************
+//
+//! The bus transfer counters of the display driver.  They are enabled by
+//! defining LCD_STATS_ENABLE (see defines.h).
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The command and data words written to the SSD2119.
+    //
+    uint32_t ui32Commands;
+    uint32_t ui32DataWords;
+
+    //
+    //! The number of times the RAM window was programmed.  A rectangle fill
+    //! programs it twice: once for the rectangle and once to restore the
+    //! full screen.
+    //
+    uint32_t ui32WindowSetups;
+
+    //
+    //! The calls of each drawing primitive and the pixels they drew, indexed
+    //! by LCD_PRIM_*.
+    //
+    uint32_t pui32Calls[NUM_LCD_PRIMS];
+    uint32_t pui32Pixels[NUM_LCD_PRIMS];
+}
+tLCDBusStats;
+
+extern void Kentec320x240x16_SSD2119StatsGet(tLCDBusStats *psStats,
+                                             bool bReset);
+
+#endif // LCD_STATS_ENABLE
+
 #endif // __KENTEC320X240X16_SSD2119_H__
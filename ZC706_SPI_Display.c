@@ -39,7 +39,9 @@
  * The 32bit words are stored in an array ( int32_t g_ulDataRx2[NUM_SSI_DATA])  \n
  * for further processing and display.    \n
  * The UART0 is used to send information to host at 115200 baud and 8-n-1       \n
- * mode.                                                                        \n
+ * mode.  It also takes console commands, which inspect the received registers, \n
+ * the statistics and the alarm thresholds and change the display rate, the    \n
+ * panel, the telemetry capture and the profiler at run time; type help.       \n
  * \n
  * This example uses the following peripherals and I/O signals on EK-TM4C123GXL.\n
  * \n
@@ -50,19 +52,31 @@
  * - SSI1Rx  - PD2  - MOSI                                                      \n
  * - SSI1Tx  - PD3  - MISO (currently not used)                                 \n
  * \n
- * The following UART signals are configured only for sending console           \n
- * messages back to host.  They are not required for operation of the SSI1:      \n
+ * The following UART signals are configured for the console and the telemetry  \n
+ * stream.  They are not required for operation of the SSI1:                    \n
  * \n
  * - UART0 peripheral                                                           \n
  * - GPIO Port A peripheral (for UART0 pins)                                    \n
  * - UART0RX - PA0                                                              \n
  * - UART0TX - PA1                                                              \n
  * \n
+ * The UART starts at 115200 baud, 8-N-1.  The console command baud raises   \n
+ * the rate, 921600 and above, with a handshake that restores 115200 when    \n
+ * the host does not confirm; tools/telemetry.py --baud does this itself.    \n
+ * \n
  * \section interrupt_sec Interrupts
  * This code uses the following interrupt handlers:
  * \n
  * \n
  * - SSI1IntHandler.                                                            \n
+ * - AcquireIntHandler (Timer 0A, samples the data at ACQ_RATE_HZ).             \n
+ * - SysTickIntHandler (posts the display frame at DISPLAY_RATE_HZ).           \n
+ * - SerialIntHandler (UART0, moves console and telemetry bytes to and from    \n
+ *   the UART FIFOs).                                                           \n
+ * \n
+ * The interrupt handlers only capture data and post work; all processing runs \n
+ * as tasks of the cooperative scheduler in scheduler.c, which sleeps with WFI \n
+ * when no task is ready.                                                       \n
  * \n
  * See also tm4c123gh6pm_startup_ccs.c which contains the vector interrupt table    \n
  */
@@ -83,11 +97,21 @@
 #include "stdint.h"
 #include "stdbool.h"
 #include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include "time.h"
 #include "touch.h"
 #include "images.h"
 #include "defines.h"
+#include "alarm.h"
+#include "acquire.h"
+#include "scheduler.h"
+#include "painter.h"
+#include "irq.h"
+#include "profile.h"
+#include "serial.h"
+#include "telemetry.h"
 
 #include "inc/hw_memmap.h"
 #include "inc/hw_nvic.h"
@@ -123,9 +147,17 @@
 #include "grlib/slider.h"
 
 #include "utils/ustdlib.h"
-#include "utils/uartstdio.h"
+#include "utils/cmdline.h"
 
 #include "Kentec320x240x16_ssd2119_8bit.h"
+#include "numfield.h"
+#include "compositor.h"
+#include "displaylist.h"
+#include "panelcache.h"
+#include "rleimage.h"
+#include "assetdraw.h"
+#include "assets.h"
+#include "sprite.h"
 
 #include "drivers/rgb.h"
 
@@ -159,9 +191,6 @@
     uint8_t iFrame_Curve[320]={ [ 0 ... 319 ] = 186};
 
 
-
-    float my_noise;
-
     static char val_AGC_Str[20];
     static char val_Lock_Str[20];
     static char val_HOLD_Str[20];
@@ -171,7 +200,6 @@
     static char val_BER_Str[20];
     static char val8_string[20];
     static char val9_string[20];
-    static char val10_string[20];
     static char val11_string[20];
     static char val12_string[20];
 
@@ -187,13 +215,106 @@
     //*****************************************************************************
 
     uint16_t i16average = 16;
-    uint8_t	SysTick_Semafore = 1;
     volatile uint32_t g_ulSSI1RXFF = 0;
+    volatile uint32_t g_ui32SSI1SyncErrors = 0;
+    volatile uint32_t g_ui32SSI1Overruns = 0;
     int32_t g_ulDataRx2[NUM_SSI_DATA];
     uint8_t iHealth = 0, iHealth_old = 0;
     uint8_t iLight_AGC = 0, iLight_Lock = 0, iLight_Hold = 0, iLight_EVM = 0;
     uint8_t iLight_Frame = 0, iLight_CRC = 0, iLight_BER = 0;
 
+    //
+    // The display frame rate actually programmed into SysTick.
+    //
+    uint32_t g_ui32DisplayRateHz = DISPLAY_RATE_HZ;
+
+    //
+    // Sequence number of the last alarm event reported on the console.
+    //
+    uint32_t g_ui32AlarmSeq = 0;
+    static const char * const g_ppcLightNames[] = { "green", "yellow", "red" };
+
+    //
+    // The drawing context of the display and the statistics of the frame
+    // being painted, shared by the stats task and the render job.
+    //
+    tContext g_sContext;
+    tAcqFrame g_sFrame;
+
+    //
+    // The drawing context of the scopes, which draw through the display list.
+    //
+    tContext g_sScopeContext;
+
+    //
+    // The scheduler tasks.  The indices must match the order of g_psTasks.
+    //
+    #define TASK_LINK       0
+    #define TASK_WIDGET     1
+    #define TASK_STATS      2
+    #define TASK_CONSOLE    3
+    #define TASK_TELEMETRY  4
+    #define TASK_IMAGE      5
+#ifdef PROFILE_ENABLE
+    #define TASK_PROFILE    6
+    #define NUM_TASKS       7
+#else
+    #define NUM_TASKS       6
+#endif
+    extern tSchedTask g_psTasks[NUM_TASKS];
+
+    //
+    // The paint jobs, which run from PendSV.  The indices must match the
+    // order of g_psPaintJobs.
+    //
+    #define PAINT_WIDGET    0
+    #define PAINT_RENDER    1
+    #define PAINT_IMAGE     2
+    #define NUM_PAINT_JOBS  3
+    extern tSchedTask g_psPaintJobs[NUM_PAINT_JOBS];
+
+    //
+    // The interval, in milliseconds, of the task execution time report on the
+    // console, and the time of the last report.
+    //
+    #define SCHED_REPORT_MS 10000
+    uint32_t g_ui32SchedReportMs = 0;
+    uint64_t g_ui64SchedReportIdle = 0;
+
+    //
+    // SPI link supervision: the counters seen by the last run of the link
+    // task and the frame and sync error rates, per second, derived from them.
+    //
+    uint32_t g_ui32LinkFrames = 0, g_ui32LinkSyncErrors = 0;
+    uint32_t g_ui32LinkFrameRate = 0, g_ui32LinkSyncErrorRate = 0;
+    bool g_bLinkUp = false;
+
+#ifdef PROFILE_ENABLE
+    //
+    // The time of the last profile report and the text of the profile
+    // overlay shown in the title bar.
+    //
+    uint32_t g_ui32ProfileReportMs = 0;
+    char g_pcProfileOverlay[32];
+#endif
+
+#ifdef LCD_STATS_ENABLE
+    //
+    // The display bus transfers of each panel, collected after every run of
+    // the widget and render jobs.  A paint is one such run that wrote to the
+    // display.
+    //
+    #define LCD_MAX_PANELS  10
+    typedef struct
+    {
+        uint32_t ui32Paints;
+        uint32_t ui32MaxWords;
+        tLCDBusStats sTotal;
+    }
+    tPanelBusStats;
+    tPanelBusStats g_psPanelBus[LCD_MAX_PANELS];
+#endif
+
 
     //*****************************************************************************
     // Global variables used by widgets
@@ -221,14 +342,14 @@
     void OnRadioChange(tWidget *pWidget, uint32_t bSelected);
     void DrawFirstImage(tWidget *pWidget, tContext *pContext);           // Panel 1
 
+    //
+    // The first panel background, drawn IMAGE_SLICE_ROWS rows at a time by
+    // the image job.
+    //
+    tAssetDrawJob g_sFirstImageJob;
+
 
     extern tCanvasWidget g_psPanels[10];
-    //extern const uint8_t g_pui_Soothing_Image[];    //Soothing Image
-   //extern const uint8_t g_pui_Stormy_Image[];      //Stormy Image
-    extern const uint8_t g_pui_Lightning_Image[];      //Lightning Image
-    extern const uint8_t g_pui_Harmony_Image[];      //Harmony Image
-    extern const uint8_t g_pui_Flower_Image[];      // Flower Image
-    extern const uint8_t g_pui_Blue_Moon_Image[];    // Blue Moon Image
     tContext *p1Context;
 
 //*****************************************************************************
@@ -277,7 +398,18 @@ SSI1IntHandler(void)
 	//
 	// Read interrupt status.
 	//
-	ulStatus = SSIIntStatus(SSI1_BASE, 1);
+	PROFILE_ENTER(PROFILE_SSI);
+
+	ulStatus = SSIIntStatus(SSI1_BASE, 0);
+
+	//
+	// Count the receive FIFO overruns.  The overrun interrupt is not enabled,
+	// so the raw status is read; it is cleared along with the time-out.
+	//
+	if(ulStatus & SSI_RXOR)
+	{
+		g_ui32SSI1Overruns++;
+	}
 
 	//
 	// Check the reason for the interrupt.
@@ -298,7 +430,9 @@ SSI1IntHandler(void)
 
 		if ((Byte3 & 0x0300)!=0x0300)			// Check if we are properly sync'ed
 		{
+			g_ui32SSI1SyncErrors++;
 			SSIIntClear(SSI1_BASE, ulStatus);
+			PROFILE_EXIT(PROFILE_SSI);
 			return;
 		}
 
@@ -307,7 +441,9 @@ SSI1IntHandler(void)
 
 		if ((Byte2 & 0x0300)!=0x0200)			// Check if we are properly sync'ed
 		{
+			g_ui32SSI1SyncErrors++;
 			SSIIntClear(SSI1_BASE, ulStatus);
+			PROFILE_EXIT(PROFILE_SSI);
 			return;
 		}
 
@@ -316,7 +452,9 @@ SSI1IntHandler(void)
 
 		if ((Byte1 & 0x0300)!=0x0100)			// Check if we are properly sync'ed
 		{
+			g_ui32SSI1SyncErrors++;
 			SSIIntClear(SSI1_BASE, ulStatus);
+			PROFILE_EXIT(PROFILE_SSI);
 			return;
 		}
 
@@ -325,7 +463,9 @@ SSI1IntHandler(void)
 
 		if ((Byte0 & 0x0300)!=0x0000)			// Check if we are properly sync'ed
 		{
+			g_ui32SSI1SyncErrors++;
 			SSIIntClear(SSI1_BASE, ulStatus);
+			PROFILE_EXIT(PROFILE_SSI);
 			return;
 		}
 
@@ -351,28 +491,55 @@ SSI1IntHandler(void)
 	// Clear interrupts.
 	//
 	SSIIntClear(SSI1_BASE, ulStatus);
+
+	PROFILE_EXIT(PROFILE_SSI);
 }
 
 //*****************************************************************************
 //
 // Called by the NVIC as a SysTick interrupt, which is used to generate the
-// sample interval
+// display frame interval.  A tick that arrives while the previous frame is
+// still being collected or painted is absorbed by the pending stats task.
 //
 //*****************************************************************************
-uint8_t SysTickIntHandler()
+void
+SysTickIntHandler(void)
 {
-	uint8_t status = 0;
-	if (SysTick_Semafore == 1)
-	{
-		status = 1;
-		return status;
-	}
-	ROM_IntMasterDisable();
+    //
+    // SysTick has been counting down from its reload value since it wrapped.
+    //
+    IRQ_LATENCY(IRQ_SYSTICK, SysTickPeriodGet() - 1 - SysTickValueGet());
+
+    SchedulerTaskPost(TASK_STATS);
+}
+
+//*****************************************************************************
+//
+// Sets the display frame rate.  SysTick paces the display stage only; the
+// data are sampled independently by the acquisition timer.  The SysTick
+// reload register is 24 bits wide, which limits the lowest frame rate to
+// about 5 Hz at 80 MHz.
+//
+//*****************************************************************************
+void
+DisplayRateSet(uint32_t ui32RateHz)
+{
+    uint32_t ui32Clock, ui32Period;
+
+    ui32Clock = ROM_SysCtlClockGet();
 
-    ROM_IntMasterEnable();
-    SysTick_Semafore = 1;		// Indicate to Main Routine that Sys Tick occured
+    if (ui32RateHz == 0)
+    {
+        ui32RateHz = 1;
+    }
+    ui32Period = ui32Clock / ui32RateHz;
+    if (ui32Period > 16777216)
+    {
+        ui32Period = 16777216;
+    }
 
-    return status;
+    ROM_SysTickPeriodSet(ui32Period);
+    g_ui32DisplayRateHz = ui32Clock / ui32Period;
 }
 
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -391,7 +558,7 @@ uint8_t SysTickIntHandler()
 tPushButtonWidget g_psFirst[] =
 {
 RectangularButtonStruct(g_psPanels, 0, 0,
-                        &g_sKentec320x240x16_SSD2119, 0, 24, 320, 216,
+                        &g_sCompositorDisplay, 0, 24, 320, 216,
                         PB_STYLE_OUTLINE |PB_STYLE_TEXT_OPAQUE | PB_STYLE_RELEASE_NOTIFY ,
                         ClrBlack, ClrBlack,  ClrGray, ClrSilver,
                         &g_sFontCm20, "", 0, 0, 0, 0, OnFirst),
@@ -401,7 +568,7 @@ RectangularButtonStruct(g_psPanels, 0, 0,
 tCanvasWidget g_psFirstCanvas[] =
 {
 CanvasStruct(g_psPanels, g_psFirst, 0,
-                       &g_sKentec320x240x16_SSD2119, 0, 24, 320, 240,
+                       &g_sCompositorDisplay, 0, 24, 320, 240,
                        CANVAS_STYLE_APP_DRAWN, 0, 0, 0, 0, 0, 0, DrawFirstImage),
 };
 
@@ -416,45 +583,53 @@ CanvasStruct(g_psPanels, g_psFirst, 0,
 
 uint32_t g_ulButtonState;
 uint32_t g_ulButtonState2;
+
+//
+// The first NUM_STATUS_BLOCKS buttons show the status of the RX, PLL, SYNC
+// and MSG blocks, and whether the action hint below them is on the display.
+//
+#define NUM_STATUS_BLOCKS       4
+bool g_bBlockHintShown = false;
+
 tPushButtonWidget g_psPushButtons2[] =
 {
     RectangularButtonStruct(g_psPanels+1, g_psPushButtons2 + 1, 0,
-                            &g_sKentec320x240x16_SSD2119, rect_x1, rect_y1, rect_x, rect_y,
+                            &g_sCompositorDisplay, rect_x1, rect_y1, rect_x, rect_y,
                             PB_STYLE_FILL | PB_STYLE_OUTLINE | PB_STYLE_TEXT | PB_STYLE_RELEASE_NOTIFY ,
 							ClrLightGreen, ClrGold,  ClrGray, ClrBlack,
                             &g_sFontCm14, "RX", 0, 0, 0, 0, OnRxButtonPress),
     RectangularButtonStruct(g_psPanels+1, g_psPushButtons2 + 2, 0,
-    					    &g_sKentec320x240x16_SSD2119, rect_x2, rect_y1, rect_x, rect_y,
+    					    &g_sCompositorDisplay, rect_x2, rect_y1, rect_x, rect_y,
                             PB_STYLE_FILL | PB_STYLE_OUTLINE | PB_STYLE_TEXT | PB_STYLE_RELEASE_NOTIFY ,
 							ClrLightGreen, ClrGold, ClrGray, ClrBlack,
                             &g_sFontCm14, "PLL", 0, 0, 0, 0, OnPLLButtonPress),
     RectangularButtonStruct(g_psPanels+1, g_psPushButtons2 + 3, 0,
-    						&g_sKentec320x240x16_SSD2119, rect_x3, rect_y1, rect_x, rect_y,
+    						&g_sCompositorDisplay, rect_x3, rect_y1, rect_x, rect_y,
 	                        PB_STYLE_FILL | PB_STYLE_OUTLINE | PB_STYLE_TEXT | PB_STYLE_RELEASE_NOTIFY ,
 							ClrLightGreen, ClrGold, ClrGray, ClrBlack,
 	                        &g_sFontCm14, "SYNC", 0, 0, 0, 0, OnSYNCButtonPress),
 	RectangularButtonStruct(g_psPanels+1,g_psPushButtons2 + 4 , 0,
-						    &g_sKentec320x240x16_SSD2119, rect_x4, rect_y1, rect_x, rect_y,
+						    &g_sCompositorDisplay, rect_x4, rect_y1, rect_x, rect_y,
 							PB_STYLE_FILL | PB_STYLE_OUTLINE | PB_STYLE_TEXT | PB_STYLE_RELEASE_NOTIFY ,
 							ClrLightGreen, ClrGold, ClrGray, ClrBlack,
 							&g_sFontCm14, "MSG", 0, 0, 0, 0, OnRXMSGButtonPress),
     RectangularButtonStruct(g_psPanels+1, g_psPushButtons2 + 5, 0,
-                            &g_sKentec320x240x16_SSD2119, rect_x1, rect_y2, rect_x, rect_y,
+                            &g_sCompositorDisplay, rect_x1, rect_y2, rect_x, rect_y,
                             PB_STYLE_FILL | PB_STYLE_OUTLINE | PB_STYLE_TEXT | PB_STYLE_RELEASE_NOTIFY ,
                             ClrLightGreen, ClrGold, ClrGray, ClrBlack,
                             &g_sFontCm14, "TX", 0, 0, 0, 0, OnButtonPress2),
     RectangularButtonStruct(g_psPanels+1, g_psPushButtons2 + 6, 0,
-    					    &g_sKentec320x240x16_SSD2119, rect_x2, rect_y2, rect_x, rect_y,
+    					    &g_sCompositorDisplay, rect_x2, rect_y2, rect_x, rect_y,
                             PB_STYLE_FILL | PB_STYLE_OUTLINE | PB_STYLE_TEXT | PB_STYLE_RELEASE_NOTIFY ,
                             ClrLightGreen, ClrGold, ClrGray, ClrBlack,
                             &g_sFontCm14, "RRC", 0, 0, 0, 0, OnButtonPress2),
     RectangularButtonStruct(g_psPanels+1, g_psPushButtons2 + 7, 0,
-    						&g_sKentec320x240x16_SSD2119, rect_x3, rect_y2, rect_x, rect_y,
+    						&g_sCompositorDisplay, rect_x3, rect_y2, rect_x, rect_y,
 	                        PB_STYLE_FILL | PB_STYLE_OUTLINE | PB_STYLE_TEXT | PB_STYLE_RELEASE_NOTIFY ,
 	                        ClrLightGreen, ClrGold, ClrGray, ClrBlack,
 	                        &g_sFontCm14, "BPSK", 0, 0, 0, 0, OnButtonPress2),
 	RectangularButtonStruct(g_psPanels+1, 0, 0,
-						    &g_sKentec320x240x16_SSD2119, rect_x4, rect_y2, rect_x, rect_y,
+						    &g_sCompositorDisplay, rect_x4, rect_y2, rect_x, rect_y,
 							PB_STYLE_FILL | PB_STYLE_OUTLINE | PB_STYLE_TEXT | PB_STYLE_RELEASE_NOTIFY ,
 							ClrLightGreen, ClrGold, ClrGray, ClrBlack,
 							&g_sFontCm14, "MSG", 0, 0, 0, 0, OnButtonPress2),
@@ -464,10 +639,10 @@ tPushButtonWidget g_psPushButtons2[] =
 tCanvasWidget g_psButtonCanvas[] =
 {
     CanvasStruct(g_psPanels+1, g_psButtonCanvas+1, 0,
-                 &g_sKentec320x240x16_SSD2119, 0, 24, 320, 166,
+                 &g_sCompositorDisplay, 0, 24, 320, 166,
                  CANVAS_STYLE_FILL, ClrSeashell, 0, 0, 0, 0, 0, 0),
     CanvasStruct(g_psPanels+1, g_psPushButtons2, 0,
-                 &g_sKentec320x240x16_SSD2119, 0, 24, 320, 166,
+                 &g_sCompositorDisplay, 0, 24, 320, 166,
                  CANVAS_STYLE_APP_DRAWN, 0, 0, 0, 0, 0, 0, OnBlockDiagramPaint),
 };
 
@@ -481,7 +656,7 @@ tCanvasWidget g_psButtonCanvas[] =
 // The third panel, which contains the Status LEDs
 //
 //*****************************************************************************
-Canvas(g_sLED_Display, g_psPanels+2, 0, 0, &g_sKentec320x240x16_SSD2119, 0, 24,
+Canvas(g_sLED_Display, g_psPanels+2, 0, 0, &g_sCompositorDisplay, 0, 24,
        320, 166, CANVAS_STYLE_APP_DRAWN, 0, 0, 0, 0, 0, 0, OnLEDStatusPaint);
 
 //*****************************************************************************
@@ -489,14 +664,14 @@ Canvas(g_sLED_Display, g_psPanels+2, 0, 0, &g_sKentec320x240x16_SSD2119, 0, 24,
 // The fourth panel, which contains Status Data in string form
 //
 //*****************************************************************************
-Canvas(g_sStatusData, g_psPanels + 3, 0, 0, &g_sKentec320x240x16_SSD2119, 0, 24,
+Canvas(g_sStatusData, g_psPanels + 3, 0, 0, &g_sCompositorDisplay, 0, 24,
        320, 166, CANVAS_STYLE_APP_DRAWN, 0, 0, 0, 0, 0, 0, OnDataPaint);
 //*****************************************************************************
 //
 // The fifth panel, which contains Rx Status Info
 //
 //*****************************************************************************
-Canvas(g_sRxStatus, g_psPanels + 4, 0, 0, &g_sKentec320x240x16_SSD2119, 0, 24,
+Canvas(g_sRxStatus, g_psPanels + 4, 0, 0, &g_sCompositorDisplay, 0, 24,
        320, 166, CANVAS_STYLE_APP_DRAWN, 0, 0, 0, 0, 0, 0, OnRxStatusPaint);
 
 //*****************************************************************************
@@ -504,28 +679,28 @@ Canvas(g_sRxStatus, g_psPanels + 4, 0, 0, &g_sKentec320x240x16_SSD2119, 0, 24,
 // The sixth panel, which contains PLL Status Info
 //
 //*****************************************************************************
-Canvas(g_sPLLStatus, g_psPanels + 5, 0, 0, &g_sKentec320x240x16_SSD2119, 0, 24,
+Canvas(g_sPLLStatus, g_psPanels + 5, 0, 0, &g_sCompositorDisplay, 0, 24,
        320, 166, CANVAS_STYLE_APP_DRAWN, 0, 0, 0, 0, 0, 0, OnPLLStatusPaint);
 //*****************************************************************************
 //
 // The seventh panel, which contains SYNC Status Info
 //
 //*****************************************************************************
-Canvas(g_sSYNCStatus, g_psPanels + 6, 0, 0, &g_sKentec320x240x16_SSD2119, 0, 24,
+Canvas(g_sSYNCStatus, g_psPanels + 6, 0, 0, &g_sCompositorDisplay, 0, 24,
        320, 166, CANVAS_STYLE_APP_DRAWN, 0, 0, 0, 0, 0, 0, OnSYNCStatusPaint);
 //*****************************************************************************
 //
 // The eigth panel, which contains PLL Status Info
 //
 //*****************************************************************************
-Canvas(g_sRXMSGStatus, g_psPanels + 7, 0, 0, &g_sKentec320x240x16_SSD2119, 0, 24,
+Canvas(g_sRXMSGStatus, g_psPanels + 7, 0, 0, &g_sCompositorDisplay, 0, 24,
        320, 166, CANVAS_STYLE_APP_DRAWN, 0, 0, 0, 0, 0, 0, OnRXMSGStatusPaint);
 //*****************************************************************************
 //
 // The ninth panel, which draws some Primitives
 //
 //*****************************************************************************
-Canvas(g_sPrimitives, g_psPanels + 8, 0, 0, &g_sKentec320x240x16_SSD2119, 0, 24,
+Canvas(g_sPrimitives, g_psPanels + 8, 0, 0, &g_sCompositorDisplay, 0, 24,
 	   320, 166, CANVAS_STYLE_APP_DRAWN, 0, 0, 0, 0, 0, 0, OnPrimitivePaint);
 
 //*****************************************************************************
@@ -536,21 +711,21 @@ Canvas(g_sPrimitives, g_psPanels + 8, 0, 0, &g_sKentec320x240x16_SSD2119, 0, 24,
 //*****************************************************************************
 tCanvasWidget g_psPanels[] =
 {
-    CanvasStruct(0, 0, &g_psFirstCanvas , &g_sKentec320x240x16_SSD2119, 0, 24,
+    CanvasStruct(0, 0, &g_psFirstCanvas , &g_sCompositorDisplay, 0, 24,
                  320, 216, CANVAS_STYLE_FILL, ClrBlack, 0, 0, 0, 0, 0, 0),
-	CanvasStruct(0, 0, &g_psButtonCanvas, &g_sKentec320x240x16_SSD2119, 0, 24,
+	CanvasStruct(0, 0, &g_psButtonCanvas, &g_sCompositorDisplay, 0, 24,
 	             320, 166, CANVAS_STYLE_FILL, ClrBlack, 0, 0, 0, 0, 0, 0),
-	CanvasStruct(0, 0, &g_sLED_Display , &g_sKentec320x240x16_SSD2119, 0, 24,
+	CanvasStruct(0, 0, &g_sLED_Display , &g_sCompositorDisplay, 0, 24,
 			     320, 166, CANVAS_STYLE_FILL, ClrBlack, 0, 0, 0, 0, 0, 0),
-    CanvasStruct(0, 0, &g_sStatusData, &g_sKentec320x240x16_SSD2119, 0, 24,
+    CanvasStruct(0, 0, &g_sStatusData, &g_sCompositorDisplay, 0, 24,
                  320, 166, CANVAS_STYLE_FILL, ClrLime, 0, 0, 0, 0, 0, 0),
-    CanvasStruct(0, 0, &g_sRxStatus, &g_sKentec320x240x16_SSD2119, 0, 24,
+    CanvasStruct(0, 0, &g_sRxStatus, &g_sCompositorDisplay, 0, 24,
 	             320, 166, CANVAS_STYLE_FILL, ClrLime, 0, 0, 0, 0, 0, 0),
-    CanvasStruct(0, 0, &g_sPLLStatus, &g_sKentec320x240x16_SSD2119, 0, 24,
+    CanvasStruct(0, 0, &g_sPLLStatus, &g_sCompositorDisplay, 0, 24,
 			     320, 166, CANVAS_STYLE_FILL, ClrLime, 0, 0, 0, 0, 0, 0),
-	CanvasStruct(0, 0, &g_sSYNCStatus, &g_sKentec320x240x16_SSD2119, 0, 24,
+	CanvasStruct(0, 0, &g_sSYNCStatus, &g_sCompositorDisplay, 0, 24,
 			     320, 166, CANVAS_STYLE_FILL, ClrLime, 0, 0, 0, 0, 0, 0),
-    CanvasStruct(0, 0, &g_sRXMSGStatus, &g_sKentec320x240x16_SSD2119, 0, 24,
+    CanvasStruct(0, 0, &g_sRXMSGStatus, &g_sCompositorDisplay, 0, 24,
 			     320, 166, CANVAS_STYLE_FILL, ClrLime, 0, 0, 0, 0, 0, 0),
 
 };
@@ -587,19 +762,19 @@ char *g_pcPanelNames[] =
 // The buttons and text across the bottom of the screen.
 //
 //*****************************************************************************
-RectangularButton(g_sPrevious, 0, 0, 0, &g_sKentec320x240x16_SSD2119, 0, 190,
-                  50, 50, PB_STYLE_FILL | PB_STYLE_RELEASE_NOTIFY , ClrBlack, ClrBlack, 0, ClrSilver,
-                  &g_sFontCm20, "-", g_pucBlue50x50, g_pucBlue50x50Press, 0, 0,
-                  OnPrevious);
+SpriteButton(g_sPrevious, 0, 0, 0, &g_sCompositorDisplay, 0, 190,
+             50, 50, PB_STYLE_FILL | PB_STYLE_RELEASE_NOTIFY , ClrBlack, ClrBlack, 0, ClrSilver,
+             &g_sFontCm20, "-", g_pui8ButtonSprite, g_pui8ButtonPressSprite,
+             OnPrevious);
 
-Canvas(g_sTitle, 0, ClrBlack, 0, &g_sKentec320x240x16_SSD2119, 50, 190, 220, 50,
+Canvas(g_sTitle, 0, ClrBlack, 0, &g_sCompositorDisplay, 50, 190, 220, 50,
        CANVAS_STYLE_TEXT | CANVAS_STYLE_FILL, 0, 0, ClrSilver,
        &g_sFontCm20, 0, 0, 0);
 
-RectangularButton(g_sNext, 0, 0, 0, &g_sKentec320x240x16_SSD2119, 270, 190,
-                  50, 50, PB_STYLE_IMG | PB_STYLE_TEXT | PB_STYLE_RELEASE_NOTIFY , ClrBlack, ClrBlack, 0,
-                  ClrSilver, &g_sFontCm20, "+", g_pucBlue50x50,
-                  g_pucBlue50x50Press, 0, 0, OnNext);
+SpriteButton(g_sNext, 0, 0, 0, &g_sCompositorDisplay, 270, 190,
+             50, 50, PB_STYLE_IMG | PB_STYLE_TEXT | PB_STYLE_RELEASE_NOTIFY , ClrBlack, ClrBlack, 0,
+             ClrSilver, &g_sFontCm20, "+", g_pui8ButtonSprite,
+             g_pui8ButtonPressSprite, OnNext);
 
 
 //*****************************************************************************
@@ -609,6 +784,75 @@ RectangularButton(g_sNext, 0, 0, 0, &g_sKentec320x240x16_SSD2119, 270, 190,
 //*****************************************************************************
 uint32_t g_ulPanel;
 uint32_t g_ulPreviousPanel;
+
+//*****************************************************************************
+//
+// The templates of the values on the status panels, one character per cell
+// with NUMFIELD_DIGIT for a digit cell.  They match the formats StatsTask()
+// uses for the value strings.
+//
+//*****************************************************************************
+#define FIELD_AGC               "####.###dB"
+#define FIELD_LOCK              "###.#dB"
+#define FIELD_RATIO2            "###.##"
+#define FIELD_RATIO1            "###.#"
+#define FIELD_BER               "####.###"
+#define FIELD_ERRORS            "####.###e6"
+#define FIELD_BITS              "####.#e6"
+
+//*****************************************************************************
+//
+// The value fields of the status panels.  The paint handler of each panel
+// invalidates its fields, and the render job draws the values into them.
+//
+//*****************************************************************************
+tNumField g_sDataAGC, g_sDataLock, g_sDataHold, g_sDataEVM, g_sDataFrame;
+tNumField g_sDataCRC, g_sDataBER, g_sDataErrors, g_sDataBits;
+tNumField g_sRxAGC;
+tNumField g_sPLLLock, g_sPLLHold;
+tNumField g_sSYNCFrame;
+tNumField g_sRXMSGCRC;
+
+//*****************************************************************************
+//
+// Lays out the value fields of the status panels where the values used to be
+// drawn: the left aligned values from their left edge and the right aligned
+// ones from their right edge.
+//
+//*****************************************************************************
+void
+PanelFieldsInit(tContext *pContext)
+{
+    NumFieldInit(&g_sDataAGC, pContext, &g_sFontCm20, FIELD_AGC,
+                 S11_x, S11_y, false);
+    NumFieldInit(&g_sDataLock, pContext, &g_sFontCm20, FIELD_LOCK,
+                 S12_x, S12_y, false);
+    NumFieldInit(&g_sDataHold, pContext, &g_sFontCm20, FIELD_RATIO2,
+                 S21_x+70, S21_y, true);
+    NumFieldInit(&g_sDataEVM, pContext, &g_sFontCm20, FIELD_RATIO2,
+                 S22_x+70, S22_y, true);
+    NumFieldInit(&g_sDataFrame, pContext, &g_sFontCm20, FIELD_RATIO1,
+                 S31_x+70, S31_y, true);
+    NumFieldInit(&g_sDataCRC, pContext, &g_sFontCm20, FIELD_RATIO1,
+                 S32_x+70, S32_y, true);
+    NumFieldInit(&g_sDataBER, pContext, &g_sFontCm20, FIELD_BER,
+                 S41_x+70, S41_y, true);
+    NumFieldInit(&g_sDataErrors, pContext, &g_sFontCm20, FIELD_ERRORS,
+                 S42_x+80, S42_y, true);
+    NumFieldInit(&g_sDataBits, pContext, &g_sFontCm20, FIELD_BITS,
+                 S51_x+100, S51_y, true);
+    NumFieldInit(&g_sRxAGC, pContext, &g_sFontCm20, FIELD_AGC,
+                 S11_x+10, S11_y, false);
+    NumFieldInit(&g_sPLLLock, pContext, &g_sFontCm20, FIELD_LOCK,
+                 S11_x+80, S11_y, true);
+    NumFieldInit(&g_sPLLHold, pContext, &g_sFontCm20, FIELD_RATIO2,
+                 S12_x+70, S12_y, true);
+    NumFieldInit(&g_sSYNCFrame, pContext, &g_sFontCm20, FIELD_RATIO1,
+                 S11_x+100, S11_y, true);
+    NumFieldInit(&g_sRXMSGCRC, pContext, &g_sFontCm20, FIELD_RATIO1,
+                 S11_x+70, S11_y, true);
+}
+
 //*****************************************************************************
 //
 // Draw a string right side adjusted
@@ -766,6 +1010,62 @@ OnNext(tWidget *pWidget)
     }
 
 }
+//*****************************************************************************
+//
+// Shows a panel directly, as the console panel command does, setting up the
+// title and the previous and next buttons as the button handlers would.
+//
+//*****************************************************************************
+void
+PanelSelect(uint32_t ui32Panel)
+{
+    //
+    // Replace the current panel with the new one.
+    //
+    WidgetRemove((tWidget *)(g_psPanels + g_ulPanel));
+    g_ulPreviousPanel = g_ulPanel;
+    g_ulPanel = ui32Panel;
+    WidgetAdd(WIDGET_ROOT, (tWidget *)(g_psPanels + g_ulPanel));
+    WidgetPaint((tWidget *)(g_psPanels + g_ulPanel));
+
+    CanvasTextSet(&g_sTitle, g_pcPanelNames[g_ulPanel]);
+    WidgetPaint((tWidget *)&g_sTitle);
+
+    //
+    // There is no previous button on the first panel.
+    //
+    if(g_ulPanel == First_Panel)
+    {
+        PushButtonImageOff(&g_sPrevious);
+        PushButtonTextOff(&g_sPrevious);
+        PushButtonFillOff(&g_sPrevious);
+    }
+    else
+    {
+        PushButtonImageOn(&g_sPrevious);
+        PushButtonTextOn(&g_sPrevious);
+        PushButtonFillOn(&g_sPrevious);
+    }
+    WidgetPaint((tWidget *)&g_sPrevious);
+
+    //
+    // There is no next button on the last panel and the status panels
+    // reached from the block diagram.
+    //
+    if(g_ulPanel >= Data_Panel)
+    {
+        PushButtonImageOff(&g_sNext);
+        PushButtonTextOff(&g_sNext);
+    }
+    else
+    {
+        PushButtonImageOn(&g_sNext);
+        PushButtonTextOn(&g_sNext);
+    }
+    PushButtonFillOn(&g_sNext);
+    WidgetPaint((tWidget *)&g_sNext);
+}
+
 //*****************************************************************************
 //
 // Handles presses of the first panel button.
@@ -838,31 +1138,84 @@ void
 DrawFirstImage(tWidget *pWidget, tContext *pContext)
 {
 
+    //
+    // The image is not drawn here but by the image job, a band of rows per
+    // run, so that the tasks of the main loop are not held off for the whole
+    // of the draw.
+    //
     if   (iHealth == 0)
     {
-//        GrImageDraw(pContext, g_pui_Blue_Moon_Image, 0, 24);
-        GrImageDraw(pContext, g_pui_Flower_Image, 0, 24);
+        AssetDrawJobStart(&g_sFirstImageJob, pContext,
+                          g_pui_Flower_Image, 0, 24,
+                          IMAGE_SLICE_ROWS);
     }
     else
     {
-//        GrImageDraw(pContext, g_pui_Blue_Moon_Image, 0, 24);
-        GrImageDraw(pContext, g_pui_Lightning_Image, 0, 24);
+        AssetDrawJobStart(&g_sFirstImageJob, pContext,
+                          g_pui_Lightning_Image, 0, 24,
+                          IMAGE_SLICE_ROWS);
     }
-
-    GrFlush(pContext);
+    SchedulerTaskPost(TASK_IMAGE);
 
 }
+
 //*****************************************************************************
 //
-// Handles paint requests for the primitives g_psButtonCanvas widget.
+// Image paint job.  Draws the next band of rows of the first panel background
+// and has the image task post it again until the background is complete; the
+// round trip through the main loop lets the tasks there run between bands.
+// The outline of the first panel button and the alarm hint of the render job
+// are drawn over the background, so they are drawn again once it is done.  A
+// background that is still being drawn when the first panel is left is
+// abandoned.
 //
 //*****************************************************************************
 void
-OnBlockDiagramPaint(tWidget *pWidget, tContext *pContext)
+ImageJob(void)
 {
+    if(!AssetDrawJobBusy(&g_sFirstImageJob))
+    {
+        return;
+    }
+    if(g_ulPanel != First_Panel)
+    {
+        AssetDrawJobCancel(&g_sFirstImageJob);
+        return;
+    }
 
+    PROFILE_ENTER(PROFILE_RENDER);
+    if(AssetDrawJobRun(&g_sFirstImageJob))
+    {
+        SchedulerTaskPost(TASK_IMAGE);
+    }
+    else
+    {
+        WidgetPaint((tWidget *)g_psFirst);
+        PainterJobPost(PAINT_WIDGET);
+        PainterJobPost(PAINT_RENDER);
+    }
+    PROFILE_EXIT(PROFILE_RENDER);
+}
 
-
+//*****************************************************************************
+//
+// Image task.  Posted by the image paint job while the first panel background
+// has rows left to draw; posts the job again.
+//
+//*****************************************************************************
+void
+ImageTask(void)
+{
+    PainterJobPost(PAINT_IMAGE);
+}
+//*****************************************************************************
+//
+// Draws the arrows between the blocks of the block diagram.
+//
+//*****************************************************************************
+void
+BlockDiagramArrowsPaint(tContext *pContext)
+{
     GrContextForegroundSet(pContext, ClrBrown);
     GrLineDraw(pContext, rect_x1+rect_x, rect_y1+rect_y/2, rect_x2, rect_y1+rect_y/2);
     GrLineDraw(pContext, rect_x2-10, rect_y1+rect_y/2-5, rect_x2, rect_y1+rect_y/2);
@@ -897,8 +1250,25 @@ OnBlockDiagramPaint(tWidget *pWidget, tContext *pContext)
     GrLineDraw(pContext, rect_x3+rect_x, rect_y2+rect_y/2, rect_x4, rect_y2+rect_y/2);
     GrLineDraw(pContext, rect_x3+rect_x, rect_y2+rect_y/2, rect_x3+rect_x+10, rect_y2+rect_y/2-5);
     GrLineDraw(pContext, rect_x3+rect_x, rect_y2+rect_y/2, rect_x3+rect_x+10, rect_y2+rect_y/2+5);
+}
 
+//*****************************************************************************
+//
+// Handles paint requests for the primitives g_psButtonCanvas widget.
+//
+//*****************************************************************************
+void
+OnBlockDiagramPaint(tWidget *pWidget, tContext *pContext)
+{
+    //
+    // The background fill of the panel has just erased the hint.
+    //
+    g_bBlockHintShown = false;
 
+    if(!PanelCacheDraw(Block_Diagram))
+    {
+        BlockDiagramArrowsPaint(pContext);
+    }
 }
 //*****************************************************************************
 //
@@ -1131,32 +1501,157 @@ OnButtonPress2(tWidget *pWidget)
 }
 //*****************************************************************************
 //
-// Handles paint requests for the LED Status canvas widget.
+// The LEDs of the status LED panel, five to a row, are pre-rendered sprites
+// (see sprite.h) of a green, a yellow and a red LED on the black panel
+// background, indexed by light level.  Drawing one is a single window write
+// of LED_SPRITE_SIZE * LED_SPRITE_SIZE pixels, as a few bursts a row, instead
+// of a circle fill, which sets up the cursor for every line of the circle.
+// The corners are black runs rather than skips: on the plain background they
+// are cheaper to write than to move the cursor past.  g_pui8LEDShown holds
+// the level each LED was last drawn with, so that only the LEDs that change
+// are redrawn.
+//
+//*****************************************************************************
+#define NUM_LEDS                10
+#define LEDS_PER_ROW            5
+#define LED_SPRITE_SIZE         (2 * LED_size + 1)
+#define LED_SPRITE_BYTES        (5 + (LED_SPRITE_SIZE * 3 * 3))
+
+static uint8_t g_ppui8LEDSprite[light_is_red + 1][LED_SPRITE_BYTES];
+static uint8_t g_pui8LEDShown[NUM_LEDS];
+
+//*****************************************************************************
+//
+// Appends a run of pixels of one color to an LED sprite.
+//
+//*****************************************************************************
+static uint8_t *
+LEDSpriteRunPut(uint8_t *pui8Sprite, int32_t i32Count, uint16_t ui16Color)
+{
+    if(i32Count > 0)
+    {
+        *pui8Sprite++ = SPRITE_TOKEN_RUN + i32Count - 1;
+        *pui8Sprite++ = ui16Color & 0xff;
+        *pui8Sprite++ = ui16Color >> 8;
+    }
+
+    return(pui8Sprite);
+}
+
+//*****************************************************************************
+//
+// Renders the LED sprites.  The rows of the disc are those GrCircleFill()
+// fills for a circle of radius LED_size, so the LEDs look as they always
+// have.
 //
 //*****************************************************************************
 void
-OnLEDStatusPaint(tWidget *pWidget, tContext *pContext)
+LEDSpriteInit(void)
 {
+    static const uint32_t pui32Colors[light_is_red + 1] =
+    {
+        ClrLime, ClrYellow, ClrRed
+    };
+    int32_t pi32HalfWidth[LED_size + 1];
+    int32_t i32A, i32B, i32D, i32Row, i32DY, i32Side;
+    uint32_t ui32Level;
+    uint16_t ui16Back, ui16Color;
+    uint8_t *pui8Sprite;
 
     //
-    // Start placing some LEDs
+    // Work out the half width of each row of the disc from its distance to
+    // the center, following the midpoint algorithm of GrCircleFill().
     //
+    for (i32Row = 0; i32Row <= LED_size; i32Row++)
+    {
+        pi32HalfWidth[i32Row] = -1;
+    }
+    i32A = 0;
+    i32B = LED_size;
+    i32D = 3 - (2 * LED_size);
+    while (i32A <= i32B)
+    {
+        if (i32B > pi32HalfWidth[i32A])
+        {
+            pi32HalfWidth[i32A] = i32B;
+        }
+        if (i32D < 0)
+        {
+            i32D += (4 * i32A) + 6;
+        }
+        else
+        {
+            if ((i32A != i32B) && (i32A > pi32HalfWidth[i32B]))
+            {
+                pi32HalfWidth[i32B] = i32A;
+            }
+            i32D += (4 * (i32A - i32B)) + 10;
+            i32B--;
+        }
+        i32A++;
+    }
 
+    ui16Back = DpyColorTranslate(&g_sKentec320x240x16_SSD2119, ClrBlack);
+    for (ui32Level = 0; ui32Level <= light_is_red; ui32Level++)
+    {
+        ui16Color = DpyColorTranslate(&g_sKentec320x240x16_SSD2119,
+                                      pui32Colors[ui32Level]);
+        pui8Sprite = g_ppui8LEDSprite[ui32Level];
+        *pui8Sprite++ = SPRITE_FMT_RGB565;
+        *pui8Sprite++ = LED_SPRITE_SIZE;
+        *pui8Sprite++ = 0;
+        *pui8Sprite++ = LED_SPRITE_SIZE;
+        *pui8Sprite++ = 0;
 
+        //
+        // Each row is the background, the disc and the background again.
+        //
+        for (i32Row = 0; i32Row < LED_SPRITE_SIZE; i32Row++)
+        {
+            i32DY = (i32Row < LED_size) ? (LED_size - i32Row) :
+                                          (i32Row - LED_size);
+            i32Side = LED_size - pi32HalfWidth[i32DY];
+            pui8Sprite = LEDSpriteRunPut(pui8Sprite, i32Side, ui16Back);
+            pui8Sprite = LEDSpriteRunPut(pui8Sprite,
+                                         LED_SPRITE_SIZE - (2 * i32Side),
+                                         ui16Color);
+            pui8Sprite = LEDSpriteRunPut(pui8Sprite, i32Side, ui16Back);
+        }
+    }
+}
 
-    GrContextForegroundSet(pContext, ClrLime);
-    GrCircleFill(pContext, (LED_x0 + 0*LED_xd), (LED_y0 + 0*LED_yd), LED_size);
-    GrCircleFill(pContext, (LED_x0 + 1*LED_xd), (LED_y0 + 0*LED_yd), LED_size);
-    GrCircleFill(pContext, (LED_x0 + 2*LED_xd), (LED_y0 + 0*LED_yd), LED_size);
-    GrCircleFill(pContext, (LED_x0 + 3*LED_xd), (LED_y0 + 0*LED_yd), LED_size);
-    GrCircleFill(pContext, (LED_x0 + 4*LED_xd), (LED_y0 + 0*LED_yd), LED_size);
+//*****************************************************************************
+//
+// Draws an LED of the status LED panel at a light level.
+//
+//*****************************************************************************
+void
+LEDDraw(uint32_t ui32LED, uint8_t ui8Level)
+{
+    SpriteDraw(&g_sContext, g_ppui8LEDSprite[ui8Level],
+               LED_x0 + ((ui32LED % LEDS_PER_ROW) * LED_xd) - LED_size,
+               LED_y0 + ((ui32LED / LEDS_PER_ROW) * LED_yd) - LED_size);
+    g_pui8LEDShown[ui32LED] = ui8Level;
+}
 
+//*****************************************************************************
+//
+// Handles paint requests for the LED Status canvas widget.
+//
+//*****************************************************************************
+void
+OnLEDStatusPaint(tWidget *pWidget, tContext *pContext)
+{
+    uint32_t ui32LED;
 
-    GrCircleFill(pContext, (LED_x0 + 0*LED_xd), (LED_y0 + 1*LED_yd), LED_size);
-    GrCircleFill(pContext, (LED_x0 + 1*LED_xd), (LED_y0 + 1*LED_yd), LED_size);
-    GrCircleFill(pContext, (LED_x0 + 2*LED_xd), (LED_y0 + 1*LED_yd), LED_size);
-    GrCircleFill(pContext, (LED_x0 + 3*LED_xd), (LED_y0 + 1*LED_yd), LED_size);
-    GrCircleFill(pContext, (LED_x0 + 4*LED_xd), (LED_y0 + 1*LED_yd), LED_size);
+    //
+    // Place the LEDs as they were last shown; the render job updates the
+    // ones that changed since.
+    //
+    for (ui32LED = 0; ui32LED < NUM_LEDS; ui32LED++)
+    {
+        LEDDraw(ui32LED, g_pui8LEDShown[ui32LED]);
+    }
 
     GrContextFontSet(pContext, &g_sFontCm14 );
     GrContextForegroundSet(pContext, ClrLimeGreen);
@@ -1184,7 +1679,18 @@ OnLEDStatusPaint(tWidget *pWidget, tContext *pContext)
 void
 OnDataPaint(tWidget *pWidget, tContext *pContext)
 {
-
+    //
+    // The panel background has just been painted over the values.
+    //
+    NumFieldInvalidate(&g_sDataAGC);
+    NumFieldInvalidate(&g_sDataLock);
+    NumFieldInvalidate(&g_sDataHold);
+    NumFieldInvalidate(&g_sDataEVM);
+    NumFieldInvalidate(&g_sDataFrame);
+    NumFieldInvalidate(&g_sDataCRC);
+    NumFieldInvalidate(&g_sDataBER);
+    NumFieldInvalidate(&g_sDataErrors);
+    NumFieldInvalidate(&g_sDataBits);
 
     //
     // Start placing some strings
@@ -1206,58 +1712,112 @@ OnDataPaint(tWidget *pWidget, tContext *pContext)
 }
 //*****************************************************************************
 //
-// Handles paint requests for the Rx Status canvas widget.
+// Fills the back of the scope of the status panels with black.
 //
 //*****************************************************************************
 void
-OnRxStatusPaint(tWidget *pWidget, tContext *pContext)
+ScopeBackPaint(tContext *pContext)
 {
     tRectangle sRect;
-    //
-    // Start placing some strings
-    //
-    GrContextFontSet(pContext, &g_sFontCm20);
-    GrContextForegroundSet(pContext, ClrBlack);
-    GrStringDrawRight(pContext, str_AGC,  9, P11_x+10, P11_y, 0);
-    //
-    // Fill the back of the scope with black panel.
-    //
+
     sRect.i16XMin = 0;
     sRect.i16YMin = 85-6;
     sRect.i16XMax = 319;
     sRect.i16YMax = 186+3;
     GrContextForegroundSet(pContext, ClrBlack);
     GrRectFill(pContext, &sRect);
-
 }
+
 //*****************************************************************************
 //
-// Handles paint requests for the PLL Status canvas widget.
+// Paints the static layer of a panel: its background and whatever is drawn
+// on it the same way every time the panel is shown, except text.  The host
+// simulator bakes these layers into the panel cache (see panelcache.c), and
+// the paint handlers draw the same parts themselves if a panel is not in the
+// cache.  Returns false, drawing nothing, for the panels whose background is
+// a plain fill or an image.
+//
+//*****************************************************************************
+bool
+PanelStaticPaint(uint32_t ui32Panel, tContext *pContext, tRectangle *psRect)
+{
+    if((ui32Panel != Block_Diagram) &&
+       ((ui32Panel < RX_Panel) || (ui32Panel > RXMSG_Panel)))
+    {
+        return(false);
+    }
+
+    *psRect = g_psPanels[ui32Panel].sBase.sPosition;
+    if(ui32Panel == Block_Diagram)
+    {
+        GrContextForegroundSet(pContext, g_psButtonCanvas[0].ui32FillColor);
+        GrRectFill(pContext, psRect);
+        BlockDiagramArrowsPaint(pContext);
+    }
+    else
+    {
+        GrContextForegroundSet(pContext, g_psPanels[ui32Panel].ui32FillColor);
+        GrRectFill(pContext, psRect);
+        ScopeBackPaint(pContext);
+    }
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Handles paint requests for the Rx Status canvas widget.
 //
 //*****************************************************************************
 void
-OnPLLStatusPaint(tWidget *pWidget, tContext *pContext)
+OnRxStatusPaint(tWidget *pWidget, tContext *pContext)
 {
-    tRectangle sRect;
+    NumFieldInvalidate(&g_sRxAGC);
+
+    //
+    // Fill the back of the scope with black panel, unless the panel cache
+    // has drawn the whole static layer.
+    //
+    if(!PanelCacheDraw(RX_Panel))
+    {
+        ScopeBackPaint(pContext);
+    }
 
     //
     // Start placing some strings
     //
     GrContextFontSet(pContext, &g_sFontCm20);
     GrContextForegroundSet(pContext, ClrBlack);
+    GrStringDrawRight(pContext, str_AGC,  9, P11_x+10, P11_y, 0);
+}
+//*****************************************************************************
+//
+// Handles paint requests for the PLL Status canvas widget.
+//
+//*****************************************************************************
+void
+OnPLLStatusPaint(tWidget *pWidget, tContext *pContext)
+{
+    NumFieldInvalidate(&g_sPLLLock);
+    NumFieldInvalidate(&g_sPLLHold);
 
-    GrStringDrawRight(pContext, str_Lock,  9, P11_x+10, P11_y, 0);
-    GrStringDrawRight(pContext, str_HOLD,  9, P12_x+10, P12_y, 0);
     //
-    // Fill the back of the scope with black panel.
+    // Fill the back of the scope with black panel, unless the panel cache
+    // has drawn the whole static layer.
     //
-    sRect.i16XMin = 0;
-    sRect.i16YMin = 85-6;
-    sRect.i16XMax = 319;
-    sRect.i16YMax = 186+3;
+    if(!PanelCacheDraw(PLL_Panel))
+    {
+        ScopeBackPaint(pContext);
+    }
+
+    //
+    // Start placing some strings
+    //
+    GrContextFontSet(pContext, &g_sFontCm20);
     GrContextForegroundSet(pContext, ClrBlack);
-    GrRectFill(pContext, &sRect);
 
+    GrStringDrawRight(pContext, str_Lock,  9, P11_x+10, P11_y, 0);
+    GrStringDrawRight(pContext, str_HOLD,  9, P12_x+10, P12_y, 0);
 }
 //*****************************************************************************
 //
@@ -1267,7 +1827,17 @@ OnPLLStatusPaint(tWidget *pWidget, tContext *pContext)
 void
 OnSYNCStatusPaint(tWidget *pWidget, tContext *pContext)
 {
-    tRectangle sRect;
+    NumFieldInvalidate(&g_sSYNCFrame);
+
+    //
+    // Fill the back of the scope with black panel, unless the panel cache
+    // has drawn the whole static layer.
+    //
+    if(!PanelCacheDraw(SYNC_Panel))
+    {
+        ScopeBackPaint(pContext);
+    }
+
     //
     // Start placing some strings
     //
@@ -1276,15 +1846,6 @@ OnSYNCStatusPaint(tWidget *pWidget, tContext *pContext)
     GrContextBackgroundSet(pContext, ClrLime);
     GrStringDraw(pContext, str_FRAME, -1, 32, S11_y, 1);
     //GrStringDrawRight(pContext, str_FRAME,  9, P11_x+10, P11_y, 0);
-    //
-    // Fill the back of the scope with black panel.
-    //
-    sRect.i16XMin = 0;
-    sRect.i16YMin = 85-6;
-    sRect.i16XMax = 319;
-    sRect.i16YMax = 186+3;
-    GrContextForegroundSet(pContext, ClrBlack);
-    GrRectFill(pContext, &sRect);
 }
 //*****************************************************************************
 //
@@ -1294,7 +1855,17 @@ OnSYNCStatusPaint(tWidget *pWidget, tContext *pContext)
 void
 OnRXMSGStatusPaint(tWidget *pWidget, tContext *pContext)
 {
-    tRectangle sRect;
+    NumFieldInvalidate(&g_sRXMSGCRC);
+
+    //
+    // Fill the back of the scope with black panel, unless the panel cache
+    // has drawn the whole static layer.
+    //
+    if(!PanelCacheDraw(RXMSG_Panel))
+    {
+        ScopeBackPaint(pContext);
+    }
+
     //
     // Start placing some strings
     //
@@ -1302,15 +1873,6 @@ OnRXMSGStatusPaint(tWidget *pWidget, tContext *pContext)
     GrContextForegroundSet(pContext, ClrBlack);
 
     GrStringDrawRight(pContext, str_CRC,  9, P11_x+10, P11_y, 0);
-    //
-    // Fill the back of the scope with black panel.
-    //
-    sRect.i16XMin = 0;
-    sRect.i16YMin = 85-6;
-    sRect.i16XMax = 319;
-    sRect.i16YMax = 186+3;
-    GrContextForegroundSet(pContext, ClrBlack);
-    GrRectFill(pContext, &sRect);
 }
 //*****************************************************************************
 //
@@ -1446,7 +2008,7 @@ OnPrimitivePaint(tWidget *pWidget, tContext *pContext)
 
 //*****************************************************************************
 //
-// Configure the UART and its pins.  This must be called before UARTprintf().
+// Configure the UART and its pins.  This must be called before SerialPrintf().
 //
 //*****************************************************************************
 void
@@ -1470,14 +2032,17 @@ ConfigureUART(void)
     ROM_GPIOPinTypeUART(GPIO_PORTA_BASE, GPIO_PIN_0 | GPIO_PIN_1);
 
     //
-    // Use the internal 16MHz oscillator as the UART clock source.
+    // Use the 80MHz system clock as the UART clock source, so that the baud
+    // command can raise the rate well beyond the 1Mbaud the internal 16MHz
+    // oscillator allows.
     //
-    UARTClockSourceSet(UART0_BASE, UART_CLOCK_PIOSC);
+    UARTClockSourceSet(UART0_BASE, UART_CLOCK_SYSTEM);
 
     //
-    // Initialize the UART for console I/O.
+    // Set up the UART for 115200 baud, 8-N-1, and start the interrupt driven
+    // driver that carries the console and the telemetry.
     //
-    UARTStdioConfig(0, 115200, 16000000);
+    SerialInit(SERIAL_BAUD_DEFAULT);
 }
 
 
@@ -1633,6 +2198,9 @@ void UpdateScope(tContext *pContext, uint8_t *i_Curve, float fnew_Value, float f
 
 
     uint8_t yp_center, yp_off;
+
+    PROFILE_ENTER(PROFILE_SCOPE);
+
     yp_center = (yp_max+yp_min)/2;
     yp_off = (yp_max - yp_min)/4;
     if (fnew_Value>fmax)
@@ -1684,139 +2252,1537 @@ void UpdateScope(tContext *pContext, uint8_t *i_Curve, float fnew_Value, float f
      GrLineDrawH(pContext, 0, 319, yp_max+2);
      GrLineDrawH(pContext, 0, 319, yp_max+3);
 
+     //
+     // Draw what the display list still holds back.
+     //
+     GrFlush(pContext);
+
+     PROFILE_EXIT(PROFILE_SCOPE);
 }
 
 
+#ifdef LCD_STATS_ENABLE
 //*****************************************************************************
 //
-// Main 'C' Language entry point.
+// Adds the display bus transfers since the last call to the current panel.
+// Called after each run of the widget and render jobs, which do all of the
+// drawing, so a panel change is charged to the panel being shown.
 //
 //*****************************************************************************
-int
-main(void)
-
-
+void
+PanelBusCollect(void)
 {
+    tLCDBusStats sStats;
+    tPanelBusStats *psPanel;
+    uint32_t ui32Idx;
 
-    char *title_str_full = malloc(25);
-    uint8_t i8Count=0;
-
-    //uint32_t ulindex_max = 0;
-    int16_t val;
-    uint16_t LSB_val, MSB_val;
-
-    float float_val;
-
-    tContext sContext;
-    tRectangle sRect;
+    Kentec320x240x16_SSD2119StatsGet(&sStats, true);
+    if ((sStats.ui32DataWords == 0) || (g_ulPanel >= LCD_MAX_PANELS))
+    {
+        return;
+    }
 
+    psPanel = &g_psPanelBus[g_ulPanel];
+    psPanel->ui32Paints++;
+    if (sStats.ui32DataWords > psPanel->ui32MaxWords)
+    {
+        psPanel->ui32MaxWords = sStats.ui32DataWords;
+    }
+    psPanel->sTotal.ui32Commands += sStats.ui32Commands;
+    psPanel->sTotal.ui32DataWords += sStats.ui32DataWords;
+    psPanel->sTotal.ui32WindowSetups += sStats.ui32WindowSetups;
+    for (ui32Idx = 0; ui32Idx < NUM_LCD_PRIMS; ui32Idx++)
+    {
+        psPanel->sTotal.pui32Calls[ui32Idx] += sStats.pui32Calls[ui32Idx];
+        psPanel->sTotal.pui32Pixels[ui32Idx] += sStats.pui32Pixels[ui32Idx];
+    }
+}
 
-//***************************************************************************************
+//*****************************************************************************
+//
+// Reports the average display bus transfers per paint of each panel shown
+// since the last report, then starts over.  The pixel columns are the pixels
+// drawn per paint by each primitive of the driver.  The paint jobs collect
+// the counts from PendSV, so each panel is copied and cleared with them held
+// off, and printed from the copy.
+//
+//*****************************************************************************
+void
+PanelBusReport(void)
+{
+    tPanelBusStats sPanel, *psPanel;
+    uint32_t ui32Panel, ui32Paints, ui32Was;
+
+    SerialPrintf("LCD bus per paint: panel paints  cmds   words  max words "
+                 "win  pixel  multi  lineH  lineV   rect  image  glyph "
+                 "  runs stream\n");
+    psPanel = &sPanel;
+    for (ui32Panel = 0; ui32Panel < LCD_MAX_PANELS; ui32Panel++)
+    {
+        ui32Was = PainterLock();
+        sPanel = g_psPanelBus[ui32Panel];
+        g_psPanelBus[ui32Panel].ui32Paints = 0;
+        g_psPanelBus[ui32Panel].ui32MaxWords = 0;
+        memset(&g_psPanelBus[ui32Panel].sTotal, 0, sizeof(tLCDBusStats));
+        PainterUnlock(ui32Was);
+
+        ui32Paints = psPanel->ui32Paints;
+        if (ui32Paints == 0)
+        {
+            continue;
+        }
 
+        SerialPrintf("%24d %6d %5d %7d %10d %3d %6d %6d %6d %6d %6d %6d "
+                     "%6d %6d %6d\n",
+                     ui32Panel, ui32Paints,
+                     psPanel->sTotal.ui32Commands / ui32Paints,
+                     psPanel->sTotal.ui32DataWords / ui32Paints,
+                     psPanel->ui32MaxWords,
+                     psPanel->sTotal.ui32WindowSetups / ui32Paints,
+                     psPanel->sTotal.pui32Pixels[LCD_PRIM_PIXEL] / ui32Paints,
+                     psPanel->sTotal.pui32Pixels[LCD_PRIM_MULTIPLE] /
+                     ui32Paints,
+                     psPanel->sTotal.pui32Pixels[LCD_PRIM_LINE_H] / ui32Paints,
+                     psPanel->sTotal.pui32Pixels[LCD_PRIM_LINE_V] / ui32Paints,
+                     psPanel->sTotal.pui32Pixels[LCD_PRIM_RECT] / ui32Paints,
+                     psPanel->sTotal.pui32Pixels[LCD_PRIM_IMAGE] / ui32Paints,
+                     psPanel->sTotal.pui32Pixels[LCD_PRIM_GLYPH] / ui32Paints,
+                     psPanel->sTotal.pui32Pixels[LCD_PRIM_RUNS] / ui32Paints,
+                     psPanel->sTotal.pui32Pixels[LCD_PRIM_STREAM] /
+                     ui32Paints);
+    }
+}
+#endif
 
+//*****************************************************************************
+//
+// Widget paint job.  Processes the widget message queue, which holds the
+// pointer messages from the touch screen and the paint requests of the
+// widgets.
+//
+//*****************************************************************************
+void
+WidgetJob(void)
+{
+    PROFILE_ENTER(PROFILE_WIDGET);
+    WidgetMessageQueueProcess();
+    CompositorFlush();
+    PROFILE_EXIT(PROFILE_WIDGET);
 
-    g_ulDataRx2[0] = 0b1111000011110000;
-    g_ulDataRx2[1] = 0b1100110011110000;
-    g_ulDataRx2[2] = 0b1111000011001100;
-    g_ulDataRx2[3] = 0b1010101011110000;
-    g_ulDataRx2[4] = 0b1010101011001100;
-    g_ulDataRx2[5] = 0b1111000011110000;
-    g_ulDataRx2[6] = 0b1100110011110000;
-    g_ulDataRx2[7] = 0b1111000011001100;
-    g_ulDataRx2[8] = 0b1010101011110000;
-    g_ulDataRx2[9] = 0b1010101011001100;
-    g_ulDataRx2[10] = 0b1111000011110000;
-    g_ulDataRx2[11] = 0b1100110011110000;
+#ifdef LCD_STATS_ENABLE
+    PanelBusCollect();
+#endif
+}
 
-    g_ulDataRx2[13] = 0b1010101011110000;
+//*****************************************************************************
+//
+// Widget task.  Posts the widget paint job periodically, so that paint
+// requests queued without a post are processed as well.
+//
+//*****************************************************************************
+void
+WidgetTask(void)
+{
+    PainterJobPost(PAINT_WIDGET);
+}
 
-    g_ulDataRx2[pos_AGC] =	      0b100001111000011001100;
-    g_ulDataRx2[pos_Lock] =       0b1000000000000000;
-    g_ulDataRx2[pos_Lock_Avg2] =  0.8*32768.0;
-    g_ulDataRx2[pos_Hold] =       0b0000000000000000;
-    g_ulDataRx2[pos_CRC] =        0b0000000000000000;
-    g_ulDataRx2[pos_Frame] =      0b1000000000000000;
+//*****************************************************************************
+//
+// Passes touch screen events on to the widget tree and posts the widget paint
+// job to process them, which runs as soon as the touch screen interrupt
+// returns.  Called from the touch screen interrupt.
+//
+//*****************************************************************************
+int32_t
+TouchPointerMessage(uint32_t ulMessage, int32_t lX, int32_t lY)
+{
+    int32_t lRet;
 
+    lRet = WidgetPointerMessage(ulMessage, lX, lY);
+    PainterJobPost(PAINT_WIDGET);
 
-    LSB_val = 128;
-    MSB_val = 0b11110000;
-	val = LSB_val + (MSB_val<<8);
-	float_val = val;
-	float_val =  g_ulDataRx2[0]/(16384.0);
-	float_val = float_val/(16384.0);
+    return lRet;
+}
 
+//*****************************************************************************
+//
+// SPI link task.  Runs once a second; derives the received frame rate and the
+// sync error rate from the counters kept by SSI1IntHandler and reports on the
+// console when the link to the ZC706 comes up or goes down.
+//
+//*****************************************************************************
+void
+LinkTask(void)
+{
+    uint32_t ui32Frames, ui32SyncErrors;
+    uint32_t pui32Counters[NUM_TLM_LINK];
+    tSerialStats sSerial;
+    bool bLinkUp;
+
+    ui32Frames = g_ulSSI1RXFF;
+    ui32SyncErrors = g_ui32SSI1SyncErrors;
+
+    g_ui32LinkFrameRate = ui32Frames - g_ui32LinkFrames;
+    g_ui32LinkSyncErrorRate = ui32SyncErrors - g_ui32LinkSyncErrors;
+    g_ui32LinkFrames = ui32Frames;
+    g_ui32LinkSyncErrors = ui32SyncErrors;
+
+    //
+    // Send the link counters along with the telemetry.
+    //
+    pui32Counters[TLM_LINK_FRAMES] = ui32Frames;
+    pui32Counters[TLM_LINK_SYNC_ERRORS] = ui32SyncErrors;
+    pui32Counters[TLM_LINK_FRAME_RATE] = g_ui32LinkFrameRate;
+    pui32Counters[TLM_LINK_SYNC_RATE] = g_ui32LinkSyncErrorRate;
+    TelemetryCountsGet(&pui32Counters[TLM_LINK_TLM_FRAMES],
+                       &pui32Counters[TLM_LINK_TLM_BYTES]);
+    SerialStatsGet(&sSerial, false);
+    pui32Counters[TLM_LINK_UART_DROPS] = sSerial.ui32Dropped;
+    pui32Counters[TLM_LINK_UART_MAX_USED] = sSerial.ui32MaxUsed;
+    TelemetryLinkSend(pui32Counters, NUM_TLM_LINK, SchedulerTimeGet());
+
+    bLinkUp = (g_ui32LinkFrameRate != 0);
+    if (bLinkUp != g_bLinkUp)
+    {
+        g_bLinkUp = bLinkUp;
+        SerialPrintf("SPI link %s\n", bLinkUp ? "up" : "down");
+    }
+}
 
+//*****************************************************************************
+//
+// Statistics task.  Posted by SysTick once per display frame; collects the
+// frame statistics, formats the values for display, updates the lights and
+// hands over to the render job.  The paint jobs are held off meanwhile, so
+// that they never draw a frame that is only partly updated.
+//
+//*****************************************************************************
+void
+StatsTask(void)
+{
+    uint32_t ui32Was;
 
+    ui32Was = PainterLock();
+    PROFILE_ENTER(PROFILE_STATS);
 
-//***************************************************************************************
     //
-    // The FPU should be enabled because some compilers will use floating-
-    // point registers, even for non-floating-point code.  If the FPU is not
-    // enabled this will cause a fault.  This also ensures that floating-
-    // point operations could be added to this application and would work
-    // correctly and use the hardware floating-point unit.  Finally, lazy
-    // stacking is enabled for interrupt handlers.  This allows floating-
-    // point instructions to be used within interrupt handlers, but at the
-    // expense of extra stack usage.
+    // Collect the statistics of the samples the acquisition stage
+    // took since the last frame.  SPI reception and acquisition keep
+    // running while the frame is painted.
     //
-    FPUEnable();
-    FPULazyStackingEnable();
+    AcquireFrameGet(&g_sFrame);
+    TelemetryMetricsSend(&g_sFrame, SchedulerTimeGet());
 
-    MPUEnable(MPU_CONFIG_PRIV_DEFAULT);
+    // Take the converted metrics of the latest sample.
+    // Convert the floats to integer part and fraction part for easy
+    // print.
 
+    // AGC Value
+    fAGC = g_sFrame.psMetric[ALARM_AGC].fLast;
+    float_to_int_and_fract(fAGC, &i32IntegerPart, &i32FractionPart, 3);
+    usprintf(val_AGC_Str, "%4d.%03ddB", i32IntegerPart, i32FractionPart);
+    if ((fAGC<0)&(i32IntegerPart==0))
+    {
+        val_AGC_Str[2] = '-';
+    }
+    fLock = g_sFrame.psMetric[ALARM_LOCK].fLast;
+    float_to_int_and_fract(fLock, &i32IntegerPart, &i32FractionPart, 1);
+    usprintf(val_Lock_Str, "%3d.%01ddB", i32IntegerPart, i32FractionPart);
+    if ((fLock<0)&(i32IntegerPart==0))
+    {
+        val_Lock_Str[2] = '-';
+    }
 
-    //
-    // Set the clock to 40Mhz derived from the PLL and the external oscillator
-    //
-    ROM_SysCtlClockSet(SYSCTL_SYSDIV_2_5 | SYSCTL_USE_PLL | SYSCTL_XTAL_16MHZ | SYSCTL_OSC_MAIN );
+    // Hold Over
+    fHold = g_sFrame.psMetric[ALARM_HOLD].fLast;
+    float_to_int_and_fract(fHold, &i32IntegerPart, &i32FractionPart, 2);
+    usprintf(val_HOLD_Str, "%3d.%02d", i32IntegerPart, i32FractionPart);
 
-    //
-    // Initialize the display driver.
-    //
-    Kentec320x240x16_SSD2119Init();
+    // EVM
+    fEVM = g_sFrame.psMetric[ALARM_EVM].fLast;
+    float_to_int_and_fract(fEVM, &i32IntegerPart, &i32FractionPart, 2);
+    usprintf(val_EVM_Str, "%3d.%02d", i32IntegerPart, i32FractionPart);
 
+    // Frame
+    fFrame = g_sFrame.psMetric[ALARM_FRAME].fLast;
+    float_to_int_and_fract(fFrame, &i32IntegerPart, &i32FractionPart, 1);
+    usprintf(val_Frame_Str, "%3d.%01d", i32IntegerPart, i32FractionPart);
 
-    //
-    // Initialize the graphics context.
-    //
-    GrContextInit(&sContext, &g_sKentec320x240x16_SSD2119);
+    // Message (CRC Error)
+    fCRC = g_sFrame.psMetric[ALARM_CRC].fLast;
+    float_to_int_and_fract(fCRC, &i32IntegerPart, &i32FractionPart, 1);
+    usprintf(val_CRC_Str, "%3d.%01d", i32IntegerPart, i32FractionPart);
 
-    //
-    // Fill the top 24 rows of the screen with blue to create the banner.
-    //
-    sRect.i16XMin = 0;
-    sRect.i16YMin = 0;
-    sRect.i16XMax = Display_Width- 1;
-    sRect.i16YMax = 23;
-    GrContextForegroundSet(&sContext, ClrDarkBlue);
-    GrRectFill(&sContext, &sRect);
+    // BER
+    fBER = g_sFrame.psMetric[ALARM_BER].fLast;
+    float_to_int_and_fract(fBER, &i32IntegerPart, &i32FractionPart, 3);
+    usprintf(val_BER_Str, "%4d.%03d", i32IntegerPart, i32FractionPart);
 
-    //
-    // Put a white box around the banner.
-    //
-    GrContextForegroundSet(&sContext, ClrWhite);
-    GrRectDraw(&sContext, &sRect);
+    uint32_t * i32_myunsignedint = 0;
+    int64_t i64_mysignedint = 0;
+    int32_t ihelp = 0;
+    uint32_t ihelpu = 0;
 
-    //
-    // Put the application name in the middle of the banner.
-    //
-    title_str_full = strcat(title_str_sub , ver);
-    GrContextFontSet(&sContext, &g_sFontCm20);
-    GrStringDrawCentered(&sContext, title_str_full , -1,
-                             Display_Width/ 2, 10, 0);
+//            ihelp = g_ulDataRx2[pos_Error_Count];
+    ihelpu = g_sFrame.ui32ErrorCount;
+//          i64_mysignedint = (int64_t) i32_myunsignedint;
+//            fTemp2 = (float) i64_mysignedint;
+    fTemp2 = (float) ihelpu;
+//            if (fTemp2<0)
+//            {
+//                fTemp2 = fTemp2 + (4294967296.0);
+//            }
+    fTemp2 = fTemp2/1e6;
+    float_to_int_and_fract(fTemp2, &i32IntegerPart, &i32FractionPart, 3);
+    usprintf(val8_string, "%4d.%03de6", i32IntegerPart, i32FractionPart);
 
+//            ihelp = g_ulDataRx2[pos_Bit_Count];
+    ihelpu = g_sFrame.ui32BitCount;
+//            * i32_myunsignedint = &ihelp;
+//            i64_mysignedint = (int64_t) i32_myunsignedint;
+//            fTempInt = (float) i64_mysignedint;
+    fTempInt = (float) ihelpu;
+//            if (fTempInt<0)
+//            {
+//                fTempInt = fTempInt + (4294967296.0);//2.1575e9;
+//            }
+    fTempInt = fTempInt/1e6;
+    float_to_int_and_fract(fTempInt, &i32IntegerPart, &i32FractionPart, 1);
+//    		i32FractionPart = i32FractionPart/1000;
+    usprintf(val9_string, "%4d.%01de6", i32IntegerPart, i32FractionPart);
 
     //
-    // Configure and enable uDMA
+    // Check light status.  The acquisition stage feeds every sample
+    // to the alarm engine, which applies the hysteresis bands and
+    // debounce times, so a metric sitting on a threshold does not
+    // make the lights (and the first panel) flicker.
     //
-    SysCtlPeripheralEnable(SYSCTL_PERIPH_UDMA);
-    SysCtlDelay(10);
-    uDMAControlBaseSet(&sDMAControlTable[0]);
-    uDMAEnable();
+    iLight_AGC = AlarmLevelGet(ALARM_AGC);
+    iLight_Lock = AlarmLevelGet(ALARM_LOCK);
+    iLight_Hold = AlarmLevelGet(ALARM_HOLD);
+    iLight_EVM = AlarmLevelGet(ALARM_EVM);
+    iLight_Frame = AlarmLevelGet(ALARM_FRAME);
+    iLight_CRC = AlarmLevelGet(ALARM_CRC);
+    iLight_BER = AlarmLevelGet(ALARM_BER);
+    iHealth = AlarmHealthGet();
 
+    PROFILE_EXIT(PROFILE_STATS);
+    PainterUnlock(ui32Was);
 
+    PainterJobPost(PAINT_RENDER);
+}
 
-    //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//*****************************************************************************
+//
+// Render paint job.  Paints the dynamic content of the current panel.
+//
+//*****************************************************************************
+void
+RenderJob(void)
+{
+    uint32_t pui32BlockColor[NUM_STATUS_BLOCKS];
+    uint8_t pui8LEDLevel[NUM_LEDS];
+    uint32_t ui32Block, ui32LED;
+
+    PROFILE_ENTER(PROFILE_RENDER);
+
+    //
+    // Check which panel.
+    //
+    switch(g_ulPanel) {
+       case First_Panel :
+           //
+           // Only repaint the background when the choice of image
+           // changes, not on every change of the health sum.
+           //
+           if ((iHealth == 0) != (iHealth_old == 0))
+           {
+               DrawFirstImage((tWidget *)(uintptr_t)g_ulPanel, &g_sContext);
+           }
+           iHealth_old = iHealth;
+           // Health status check, once the background is drawn
+           if ((iHealth !=0) && !AssetDrawJobBusy(&g_sFirstImageJob))
+           {
+               GrContextFontSet(&g_sContext, &g_sFontCm20);
+               GrContextForegroundSet(&g_sContext, ClrRed);
+               GrContextBackgroundSet(&g_sContext, ClrSeashell);
+               GrStringDraw(&g_sContext, "Touch Screen to Take Action", -1, 20, 95, 1);
+           }
+           break;
+       case Block_Diagram  :
+            //
+            // Work out the colour of the four status blocks.  Only the most
+            // urgent block is colored, red before yellow.
+            //
+            pui32BlockColor[0] = ClrLightGreen;
+            pui32BlockColor[1] = ClrLightGreen;
+            pui32BlockColor[2] = ClrLightGreen;
+            pui32BlockColor[3] = ClrLightGreen;
+            g_ulButtonState=0;
+            if (iLight_AGC == light_is_red)
+            {
+                //
+                // Change color of AGC button to Red
+                //
+                pui32BlockColor[0] = ClrRed;
+                g_ulButtonState=1;
+            }
+
+            else if ((iLight_Lock == light_is_red)|(iLight_Hold == light_is_red))
+            {
+                //
+                // Change color of PLL button to Red
+                //
+                pui32BlockColor[1] = ClrRed;
+                g_ulButtonState=2;
+            }
+
+            else if (iLight_Frame == light_is_red)
+            {
+                //
+                // Change color of SYNC button to Red
+                //
+                pui32BlockColor[2] = ClrRed;
+                g_ulButtonState=4;
+            }
+
+            else if (iLight_CRC == light_is_red)
+            {
+                //
+                // Change color of MSG button to Red
+                //
+                pui32BlockColor[3] = ClrRed;
+                g_ulButtonState=8;
+            }
+            else if (iLight_AGC == light_is_yellow)
+            {
+                //
+                // Change color of AGC button to Yellow
+                //
+                pui32BlockColor[0] = ClrYellow;
+                g_ulButtonState=1;
+            }
+            else if (iLight_Lock == light_is_yellow)
+            {
+                //
+                // Change color of PLL button to Yellow
+                //
+                pui32BlockColor[1] = ClrYellow;
+                g_ulButtonState=2;
+            }
+
+            //
+            // Repaint only the blocks whose colour changed.  A block's fill
+            // colour is only set here, together with its repaint, so it is
+            // always the colour it was last painted with; a repaint of the
+            // whole panel uses it too.
+            //
+            for (ui32Block = 0; ui32Block < NUM_STATUS_BLOCKS; ui32Block++)
+            {
+                if (g_psPushButtons2[ui32Block].ui32FillColor !=
+                    pui32BlockColor[ui32Block])
+                {
+                    PushButtonFillColorSet(g_psPushButtons2 + ui32Block,
+                                           pui32BlockColor[ui32Block]);
+                    WidgetPaint((tWidget *)(g_psPushButtons2 + ui32Block));
+                }
+            }
+
+            //
+            // Show or erase the hint when the health changes, or when a
+            // repaint of the panel erased it.
+            //
+            if ((iHealth != 0) != g_bBlockHintShown)
+            {
+                g_bBlockHintShown = (iHealth != 0);
+                GrContextFontSet(&g_sContext, &g_sFontCm16);
+                GrContextForegroundSet(&g_sContext, g_bBlockHintShown ?
+                                       ClrRed : ClrSeashell);
+                GrContextBackgroundSet(&g_sContext, ClrSeashell);
+                GrStringDraw(&g_sContext, "Touch Red Block to Take Action", -1, 20, 95, 1);   // AGC
+            }
+            break;
+
+       case LED_Panel  :
+            //
+            // The light level of each LED.  Hold Over, Frame and CRC only
+            // light green or red, the remaining LEDs are always green.
+            //
+            memset(pui8LEDLevel, light_is_green, sizeof(pui8LEDLevel));
+            pui8LEDLevel[0] = iLight_AGC;
+            pui8LEDLevel[1] = iLight_Lock;
+            if (iLight_Hold == light_is_red)
+            {
+                pui8LEDLevel[2] = light_is_red;
+            }
+            if (iLight_Frame == light_is_red)
+            {
+                pui8LEDLevel[4] = light_is_red;
+            }
+            if (iLight_CRC == light_is_red)
+            {
+                pui8LEDLevel[5] = light_is_red;
+            }
+
+            //
+            // Redraw only the LEDs whose level changed.
+            //
+            for (ui32LED = 0; ui32LED < NUM_LEDS; ui32LED++)
+            {
+                if (pui8LEDLevel[ui32LED] != g_pui8LEDShown[ui32LED])
+                {
+                    LEDDraw(ui32LED, pui8LEDLevel[ui32LED]);
+                }
+            }
+           break;
+
+       case Data_Panel  :
+           PROFILE_ENTER(PROFILE_TEXT);
+           GrContextFontSet(&g_sContext, &g_sFontCm20);
+           GrContextForegroundSet(&g_sContext, ClrBlack);
+           GrContextBackgroundSet(&g_sContext, ClrLime);
+           NumFieldDraw(&g_sDataAGC, &g_sContext, val_AGC_Str);         // AGC
+           NumFieldDraw(&g_sDataLock, &g_sContext, val_Lock_Str);       // Lock
+
+           NumFieldDraw(&g_sDataHold, &g_sContext, val_HOLD_Str);       // Holder Over
+           NumFieldDraw(&g_sDataEVM, &g_sContext, val_EVM_Str);         // EVM
+
+           NumFieldDraw(&g_sDataFrame, &g_sContext, val_Frame_Str);     // Frame Status
+           NumFieldDraw(&g_sDataCRC, &g_sContext, val_CRC_Str);         // Message Status (CRC Error)
+
+           NumFieldDraw(&g_sDataBER, &g_sContext, val_BER_Str);         // BER
+           NumFieldDraw(&g_sDataErrors, &g_sContext, val8_string);
+
+           NumFieldDraw(&g_sDataBits, &g_sContext, val9_string);
+           PROFILE_EXIT(PROFILE_TEXT);
+
+          break;
+
+       case RX_Panel  :
+           GrContextBackgroundSet(&g_sContext, ClrLime);
+           GrContextForegroundSet(&g_sContext, ClrBlack);
+           GrContextFontSet(&g_sContext, &g_sFontCm20);
+           if (iLight_AGC == light_is_red)
+           {
+               GrContextBackgroundSet(&g_sContext, ClrRed);
+               GrStringDraw(&g_sContext, "Check input to RX1A ", -1, 32, S21_y-5, 1);
+           }
+           else if (iLight_AGC == light_is_yellow)
+           {
+               GrContextBackgroundSet(&g_sContext, ClrYellow);
+               GrStringDraw(&g_sContext, "Weak Input Signal ", -1, 32, S21_y-5, 1);
+           }
+           else
+           {
+            GrStringDraw(&g_sContext,    "AGC within Range    ", -1, 32, S21_y-5, 1);
+           }
+           NumFieldDraw(&g_sRxAGC, &g_sContext, val_AGC_Str);           // AGC
+           GrContextBackgroundSet(&g_sContext, ClrLime);
+
+           UpdateScope(&g_sScopeContext, & iAGC_Curve[0], fAGC, -0.5, 0.5, 136, 186, "AGC Graph");
+
+
+          break;
+
+       case PLL_Panel  :
+           GrContextForegroundSet(&g_sContext, ClrBlack);
+
+           GrContextBackgroundSet(&g_sContext, ClrLime);
+           GrContextFontSet(&g_sContext, &g_sFontCm20);
+           NumFieldDraw(&g_sPLLLock, &g_sContext, val_Lock_Str);        // Lock
+           NumFieldDraw(&g_sPLLHold, &g_sContext, val_HOLD_Str);        // Hold Over
+           if (iLight_Lock == light_is_red)
+          {
+              GrContextBackgroundSet(&g_sContext, ClrRed);
+              GrStringDraw(&g_sContext, "PLL unLocked ", -1, 20, S21_y-5, 1);
+          }
+          else if (iLight_Lock == light_is_yellow)
+          {
+              GrContextBackgroundSet(&g_sContext, ClrYellow);
+              GrStringDraw(&g_sContext, "PLL Lock Weak", -1, 20, S21_y-5, 1);
+          }
+          else
+          {
+              GrStringDraw(&g_sContext,    "PLL Locked   ", -1, 20, S21_y-5, 1);
+          }
+           GrContextBackgroundSet(&g_sContext, ClrLime);
+           if (iLight_Hold == light_is_red)
+          {
+              GrContextBackgroundSet(&g_sContext, ClrRed);
+              GrStringDraw(&g_sContext, "PLL Hold Mode ", -1, 170, S21_y-5, 1);
+          }
+          else
+          {
+           GrStringDraw(&g_sContext,    "PLL Track Mode", -1, 170, S21_y-5, 1);
+          }
+           GrContextBackgroundSet(&g_sContext, ClrLime);
+
+           UpdateScope(&g_sScopeContext, &iLock_Curve[0], fLock, -5.0, 5.0, 85, 132, "Lock Graph");
+           // Error ratios plot the frame peak so that a burst
+           // shorter than a frame still shows on the scope.
+           UpdateScope(&g_sScopeContext, &iHold_Curve[0], g_sFrame.psMetric[ALARM_HOLD].fMax, 0.0, 1.0, 138, 186, "Hold Graph");
+
+          break;
+
+       case SYNC_Panel  :
+           GrContextForegroundSet(&g_sContext, ClrBlack);
+           GrContextBackgroundSet(&g_sContext, ClrLime);
+           GrContextFontSet(&g_sContext, &g_sFontCm20);
+
+           if (iLight_Frame == light_is_red)
+          {
+              GrContextBackgroundSet(&g_sContext, ClrRed);
+              GrStringDraw(&g_sContext, "Synchronization Error ", -1, 32, S21_y-5, 1);
+          }
+          else
+          {
+           GrStringDraw(&g_sContext,    "Synchronization Ok    ", -1, 32, S21_y-5, 1);
+          }
+
+           NumFieldDraw(&g_sSYNCFrame, &g_sContext, val_Frame_Str);     // Frame Status
+           GrContextBackgroundSet(&g_sContext, ClrLime);
+
+           UpdateScope(&g_sScopeContext, & iFrame_Curve[0], g_sFrame.psMetric[ALARM_FRAME].fMax, 0.0, 1.0, 136, 186, "Frame Graph");
+
+
+          break;
+
+       case RXMSG_Panel  :
+           GrContextForegroundSet(&g_sContext, ClrBlack);
+           GrContextBackgroundSet(&g_sContext, ClrLime);
+           GrContextFontSet(&g_sContext, &g_sFontCm20);
+           if (iLight_CRC == light_is_red)
+          {
+              GrContextBackgroundSet(&g_sContext, ClrRed);
+              GrStringDraw(&g_sContext, "Check Sum Error ", -1, 32, S21_y-5, 1);
+          }
+          else
+          {
+           GrStringDraw(&g_sContext,    "Check Sum Ok    ", -1, 32, S21_y-5, 1);
+          }
+           NumFieldDraw(&g_sRXMSGCRC, &g_sContext, val_CRC_Str);        // Message Status (CRC Error)
+           GrContextBackgroundSet(&g_sContext, ClrLime);
+
+           UpdateScope(&g_sScopeContext, &iCRC_Curve[0], g_sFrame.psMetric[ALARM_CRC].fMax, 0.0, 1.0, 136, 186, "CRC Graph");
+
+          break;
+
+    }
+
+    PROFILE_EXIT(PROFILE_RENDER);
+
+#ifdef PROFILE_ENABLE
+    //
+    // Show the CPU load and the paint time below the panel title.
+    //
+    ProfileOverlayGet(g_pcProfileOverlay, sizeof(g_pcProfileOverlay));
+    GrContextFontSet(&g_sContext, &g_sFontCm12);
+    GrContextForegroundSet(&g_sContext, ClrSilver);
+    GrContextBackgroundSet(&g_sContext, ClrBlack);
+    GrStringDraw(&g_sContext, g_pcProfileOverlay, -1, 56, 227, 1);
+#endif
+
+    //
+    // Let the widget paint job process the paint requests queued above.
+    //
+    PainterJobPost(PAINT_WIDGET);
+
+#ifdef LCD_STATS_ENABLE
+    PanelBusCollect();
+#endif
+}
+
+//*****************************************************************************
+//
+// Prints a line of execution time statistics for each task of a scheduler
+// task or paint job table.
+//
+//*****************************************************************************
+void
+ConsoleReportTasks(tSchedTask *psTasks, uint32_t ui32NumTasks,
+                   uint64_t ui64Elapsed, uint32_t ui32CyclesPerUs)
+{
+    tSchedTask *psTask;
+    uint32_t ui32Idx;
+
+    for (ui32Idx = 0; ui32Idx < ui32NumTasks; ui32Idx++)
+    {
+        psTask = &psTasks[ui32Idx];
+        SerialPrintf("%8s %3d%% %5d %8d %8d %7d %5d\n", psTask->pcName,
+                     (uint32_t)((psTask->ui64CyclesTotal * 100) / ui64Elapsed),
+                     psTask->ui32Runs,
+                     psTask->ui32CyclesMax / ui32CyclesPerUs,
+                     (psTask->ui32Runs ?
+                      (uint32_t)(psTask->ui64CyclesTotal / psTask->ui32Runs /
+                                 ui32CyclesPerUs) : 0),
+                     psTask->ui32BudgetUs, psTask->ui32Overruns);
+    }
+}
+
+//*****************************************************************************
+//
+// Prints the execution time statistics of the tasks and the paint jobs and,
+// if enabled, the interrupt latencies since the last report, the UART
+// counters and, if enabled, the display bus transfers per panel.
+//
+//*****************************************************************************
+void
+ConsoleReport(void)
+{
+    const tIrqSource *psIrq;
+    tSerialStats sSerial;
+    uint32_t ui32Idx, ui32CyclesPerUs, ui32Now;
+    uint64_t ui64Elapsed, ui64Idle;
+
+    //
+    // Report the share of the processor each task took since the last
+    // report, its longest and average run and how often it overran its
+    // budget.  The time of a task includes that of the interrupts that
+    // preempted it, but not that of the paint jobs, which are listed apart.
+    //
+    ui32Now = SchedulerTimeGet();
+    ui32CyclesPerUs = ROM_SysCtlClockGet() / 1000000;
+    ui64Elapsed = ((uint64_t)(ui32Now - g_ui32SchedReportMs) * 1000 *
+                   ui32CyclesPerUs);
+    if (ui64Elapsed == 0)
+    {
+        return;
+    }
+    ui64Idle = SchedulerIdleCyclesGet();
+    g_ui32SchedReportMs = ui32Now;
+
+    SerialPrintf("Task     load  runs  max(us)  avg(us)  budget  over\n");
+    ConsoleReportTasks(g_psTasks, NUM_TASKS, ui64Elapsed, ui32CyclesPerUs);
+    SerialPrintf("Paint job\n");
+    ConsoleReportTasks(g_psPaintJobs, NUM_PAINT_JOBS, ui64Elapsed,
+                       ui32CyclesPerUs);
+    SerialPrintf("    idle %3d%%\n",
+                 (uint32_t)(((ui64Idle - g_ui64SchedReportIdle) * 100) /
+                            ui64Elapsed));
+    g_ui64SchedReportIdle = ui64Idle;
+
+    SchedulerStatsReset();
+    PainterStatsReset();
+
+#ifdef IRQ_STATS_ENABLE
+    //
+    // Report the longest and the average latency of the interrupts raised by
+    // a timer, in processor cycles.
+    //
+    SerialPrintf("IRQ      prio  runs  max(cyc)  avg(cyc)\n");
+    for (ui32Idx = 0; ui32Idx < NUM_IRQS; ui32Idx++)
+    {
+        psIrq = IrqSourceGet(ui32Idx);
+        if (psIrq->ui32Samples)
+        {
+            SerialPrintf("%8s 0x%02x %5d %9d %9d\n", psIrq->pcName,
+                         psIrq->ui8Priority, psIrq->ui32Samples,
+                         psIrq->ui32LatencyMax,
+                         (uint32_t)(psIrq->ui64LatencyTotal /
+                                    psIrq->ui32Samples));
+        }
+    }
+    IrqStatsReset();
+#endif
+
+    //
+    // Report the console and telemetry output that did not fit the UART
+    // transmit buffer.
+    //
+    SerialStatsGet(&sSerial, false);
+    SerialPrintf("UART %d bytes, max %d/%d buffered, %d dropped (%d bytes)\n",
+                 sSerial.ui32Bytes, sSerial.ui32MaxUsed,
+                 SERIAL_TX_BUFFER_SIZE, sSerial.ui32Dropped,
+                 sSerial.ui32DroppedBytes);
+
+#ifdef LCD_STATS_ENABLE
+    PanelBusReport();
+#endif
+}
+
+//*****************************************************************************
+//
+// Console commands.  A line typed on UART0 is split into words by
+// CmdLineProcess(), which runs the entry of g_psCmdTable named by the first
+// word with the words as arguments.  The commands only use static storage.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Parses a word that is a whole unsigned number, decimal or 0x prefixed hex.
+//
+//*****************************************************************************
+static bool
+CommandNumberParse(const char *pcArg, uint32_t *pui32Value)
+{
+    const char *pcEnd;
+
+    *pui32Value = ustrtoul(pcArg, &pcEnd, 0);
+
+    return((pcEnd != pcArg) && (*pcEnd == 0));
+}
+
+//*****************************************************************************
+//
+// Parses a word that is a whole alarm threshold: a number or "never".
+//
+//*****************************************************************************
+static bool
+CommandThresholdParse(const char *pcArg, float *pfValue)
+{
+    const char *pcEnd;
+
+    if (!ustrcmp(pcArg, "never"))
+    {
+        *pfValue = ALARM_NEVER;
+        return(true);
+    }
+
+    *pfValue = ustrtof(pcArg, &pcEnd);
+
+    return((pcEnd != pcArg) && (*pcEnd == 0));
+}
+
+//*****************************************************************************
+//
+// Formats an alarm threshold with three decimals, since the console has no
+// floating point format.
+//
+//*****************************************************************************
+static void
+CommandThresholdFormat(char *pcBuf, uint32_t ui32Size, float fValue)
+{
+    int32_t i32Milli;
+
+    if (fValue >= ALARM_NEVER)
+    {
+        usnprintf(pcBuf, ui32Size, "never");
+        return;
+    }
+    if ((fValue > 2000000.0f) || (fValue < -2000000.0f))
+    {
+        usnprintf(pcBuf, ui32Size, "%d", (int32_t)fValue);
+        return;
+    }
+
+    i32Milli = (int32_t)(fValue * 1000.0f + ((fValue < 0) ? -0.5f : 0.5f));
+    usnprintf(pcBuf, ui32Size, "%s%d.%03d", (i32Milli < 0) ? "-" : "",
+              abs(i32Milli) / 1000, abs(i32Milli) % 1000);
+}
+
+//*****************************************************************************
+//
+// Parses an on/off argument.
+//
+//*****************************************************************************
+static bool
+CommandSwitchParse(const char *pcArg, bool *pbOn)
+{
+    if (!ustrcmp(pcArg, "on"))
+    {
+        *pbOn = true;
+        return(true);
+    }
+    if (!ustrcmp(pcArg, "off"))
+    {
+        *pbOn = false;
+        return(true);
+    }
+
+    return(false);
+}
+
+//*****************************************************************************
+//
+// help: lists the commands.
+//
+//*****************************************************************************
+int
+Cmd_help(int argc, char *argv[])
+{
+    tCmdLineEntry *psEntry;
+
+    for (psEntry = g_psCmdTable; psEntry->pcCmd; psEntry++)
+    {
+        SerialPrintf("%8s  %s\n", psEntry->pcCmd, psEntry->pcHelp);
+    }
+
+    return(0);
+}
+
+//*****************************************************************************
+//
+// reg <index> [count]: prints received registers.
+//
+//*****************************************************************************
+int
+Cmd_reg(int argc, char *argv[])
+{
+    uint32_t ui32Index, ui32Count;
+
+    ui32Count = 1;
+    if ((argc < 2) || (argc > 3) || !CommandNumberParse(argv[1], &ui32Index) ||
+        ((argc == 3) && !CommandNumberParse(argv[2], &ui32Count)) ||
+        (ui32Index >= NUM_SSI_DATA))
+    {
+        SerialPrintf("Usage: reg <index 0-%d> [count]\n", NUM_SSI_DATA - 1);
+        return(0);
+    }
+
+    if (ui32Count > (NUM_SSI_DATA - ui32Index))
+    {
+        ui32Count = NUM_SSI_DATA - ui32Index;
+    }
+    while (ui32Count--)
+    {
+        SerialPrintf("reg %3d = %11d 0x%08x\n", ui32Index,
+                     g_ulDataRx2[ui32Index], g_ulDataRx2[ui32Index]);
+        ui32Index++;
+    }
+
+    return(0);
+}
+
+//*****************************************************************************
+//
+// stats: prints the link, telemetry and alarm state and the console report.
+//
+//*****************************************************************************
+int
+Cmd_stats(int argc, char *argv[])
+{
+    uint32_t ui32Idx, ui32Frames, ui32Bytes;
+
+    SerialPrintf("Link %s: %d frames (%d/s), %d sync errors (%d/s), "
+                 "%d overruns\n",
+                 g_bLinkUp ? "up" : "down", g_ulSSI1RXFF, g_ui32LinkFrameRate,
+                 g_ui32SSI1SyncErrors, g_ui32LinkSyncErrorRate,
+                 g_ui32SSI1Overruns);
+
+    TelemetryCountsGet(&ui32Frames, &ui32Bytes);
+    SerialPrintf("Capture %s: %d frames, %d bytes\n",
+                 TelemetryIsEnabled() ? "on" : "off", ui32Frames, ui32Bytes);
+
+    SerialPrintf("Display %d Hz, panel %d\n", g_ui32DisplayRateHz, g_ulPanel);
+
+    for (ui32Idx = 0; ui32Idx < NUM_ALARMS; ui32Idx++)
+    {
+        SerialPrintf("%8s %s\n", AlarmNameGet(ui32Idx),
+                     g_ppcLightNames[AlarmLevelGet(ui32Idx)]);
+    }
+
+    ConsoleReport();
+
+    return(0);
+}
+
+//*****************************************************************************
+//
+// alarm [<channel> [<yellow on> <yellow off> <red on> <red off>
+// [<raise ms> <clear ms>]]]: prints or sets the alarm thresholds.  A channel
+// is given by number or by name.
+//
+//*****************************************************************************
+int
+Cmd_alarm(int argc, char *argv[])
+{
+    tAlarmThreshold sThreshold;
+    uint32_t ui32Channel, ui32First, ui32Last, ui32Raise, ui32Clear;
+    char pcValues[4][16];
+
+    ui32First = 0;
+    ui32Last = NUM_ALARMS - 1;
+    if (argc > 1)
+    {
+        for (ui32Channel = 0; ui32Channel < NUM_ALARMS; ui32Channel++)
+        {
+            if (!ustrcmp(argv[1], AlarmNameGet(ui32Channel)))
+            {
+                break;
+            }
+        }
+        if ((ui32Channel == NUM_ALARMS) &&
+            !CommandNumberParse(argv[1], &ui32Channel))
+        {
+            ui32Channel = NUM_ALARMS;
+        }
+        ui32First = ui32Channel;
+        ui32Last = ui32Channel;
+    }
+
+    if (((argc != 1) && (argc != 2) && (argc != 6) && (argc != 8)) ||
+        (ui32First >= NUM_ALARMS))
+    {
+        SerialPrintf("Usage: alarm [<channel> [<yellow on> <yellow off> "
+                     "<red on> <red off> [<raise ms> <clear ms>]]]\n");
+        return(0);
+    }
+
+    if (argc >= 6)
+    {
+        AlarmThresholdGet(ui32First, &sThreshold);
+        if (!CommandThresholdParse(argv[2], &sThreshold.fYellowOn) ||
+            !CommandThresholdParse(argv[3], &sThreshold.fYellowOff) ||
+            !CommandThresholdParse(argv[4], &sThreshold.fRedOn) ||
+            !CommandThresholdParse(argv[5], &sThreshold.fRedOff))
+        {
+            SerialPrintf("Bad threshold\n");
+            return(0);
+        }
+        if (argc == 8)
+        {
+            if (!CommandNumberParse(argv[6], &ui32Raise) ||
+                !CommandNumberParse(argv[7], &ui32Clear) ||
+                (ui32Raise > 0xffff) || (ui32Clear > 0xffff))
+            {
+                SerialPrintf("Bad persistence time\n");
+                return(0);
+            }
+            sThreshold.ui16RaiseMs = ui32Raise;
+            sThreshold.ui16ClearMs = ui32Clear;
+        }
+        AlarmThresholdSet(ui32First, &sThreshold);
+    }
+
+    SerialPrintf("Channel  yellow on/off     red on/off  raise/clear(ms)\n");
+    for (ui32Channel = ui32First; ui32Channel <= ui32Last; ui32Channel++)
+    {
+        AlarmThresholdGet(ui32Channel, &sThreshold);
+        CommandThresholdFormat(pcValues[0], 16, sThreshold.fYellowOn);
+        CommandThresholdFormat(pcValues[1], 16, sThreshold.fYellowOff);
+        CommandThresholdFormat(pcValues[2], 16, sThreshold.fRedOn);
+        CommandThresholdFormat(pcValues[3], 16, sThreshold.fRedOff);
+        SerialPrintf("%7s %7s %7s %7s %7s %7d %7d\n",
+                     AlarmNameGet(ui32Channel), pcValues[0], pcValues[1],
+                     pcValues[2], pcValues[3], sThreshold.ui16RaiseMs,
+                     sThreshold.ui16ClearMs);
+    }
+
+    return(0);
+}
+
+//*****************************************************************************
+//
+// rate [<Hz>]: prints or sets the display frame rate paced by SysTick.
+//
+//*****************************************************************************
+int
+Cmd_rate(int argc, char *argv[])
+{
+    uint32_t ui32Rate;
+
+    if (argc == 2)
+    {
+        if (!CommandNumberParse(argv[1], &ui32Rate) || (ui32Rate < 1) ||
+            (ui32Rate > 100))
+        {
+            SerialPrintf("Usage: rate [<1-100 Hz>]\n");
+            return(0);
+        }
+        DisplayRateSet(ui32Rate);
+    }
+
+    SerialPrintf("Display rate %d Hz\n", g_ui32DisplayRateHz);
+
+    return(0);
+}
+
+//*****************************************************************************
+//
+// baud [<rate>|ok]: prints or changes the UART baud rate.  The reply to a
+// change is sent at the current rate; the board then switches and restores
+// the current rate unless "baud ok" arrives at the new rate within
+// SERIAL_BAUD_CONFIRM_MS.  tools/telemetry.py does this handshake itself.
+//
+//*****************************************************************************
+int
+Cmd_baud(int argc, char *argv[])
+{
+    uint32_t ui32Baud;
+
+    if ((argc == 2) && !ustrcmp(argv[1], "ok"))
+    {
+        if (SerialBaudConfirm())
+        {
+            SerialPrintf("Baud %d confirmed\n", SerialBaudGet());
+        }
+        return(0);
+    }
+
+    if (argc == 2)
+    {
+        if (!CommandNumberParse(argv[1], &ui32Baud))
+        {
+            SerialPrintf("Usage: baud [<rate>|ok]\n");
+            return(0);
+        }
+        if (!SerialBaudSet(ui32Baud))
+        {
+            SerialPrintf("Baud %d not supported\n", ui32Baud);
+            return(0);
+        }
+        if (ui32Baud != SerialBaudGet())
+        {
+            SerialPrintf("Baud %d, send baud ok within %d ms\n", ui32Baud,
+                         SERIAL_BAUD_CONFIRM_MS);
+            return(0);
+        }
+    }
+
+    SerialPrintf("Baud %d\n", SerialBaudGet());
+
+    return(0);
+}
+
+//*****************************************************************************
+//
+// panel [<index>]: lists the panels or shows one.
+//
+//*****************************************************************************
+int
+Cmd_panel(int argc, char *argv[])
+{
+    uint32_t ui32Panel, ui32Was;
+    const char *pcName;
+
+    if (argc == 2)
+    {
+        if (!CommandNumberParse(argv[1], &ui32Panel) ||
+            (ui32Panel > RXMSG_Panel))
+        {
+            SerialPrintf("Usage: panel [<0-%d>]\n", RXMSG_Panel);
+            return(0);
+        }
+        if (ui32Panel != g_ulPanel)
+        {
+            ui32Was = PainterLock();
+            PanelSelect(ui32Panel);
+            PainterUnlock(ui32Was);
+            PainterJobPost(PAINT_WIDGET);
+        }
+    }
+
+    for (ui32Panel = 0; ui32Panel <= RXMSG_Panel; ui32Panel++)
+    {
+        for (pcName = g_pcPanelNames[ui32Panel]; *pcName == ' '; pcName++)
+        {
+        }
+        SerialPrintf("%c %d %s\n", (ui32Panel == g_ulPanel) ? '*' : ' ',
+                     ui32Panel, pcName);
+    }
+
+    return(0);
+}
+
+//*****************************************************************************
+//
+// irq [<source> <priority>]: lists the interrupt sources and their priorities
+// or changes the priority of one.
+//
+//*****************************************************************************
+int
+Cmd_irq(int argc, char *argv[])
+{
+    const tIrqSource *psIrq;
+    uint32_t ui32Irq, ui32Priority;
+
+    if (argc == 3)
+    {
+        if (!CommandNumberParse(argv[1], &ui32Irq) ||
+            !CommandNumberParse(argv[2], &ui32Priority) ||
+            !IrqPrioritySet(ui32Irq, ui32Priority))
+        {
+            SerialPrintf("Usage: irq [<0-%d> <0x00-0x%02x, step 0x20>]\n",
+                         NUM_IRQS - 1, INT_PRIORITY_PENDSV - 0x20);
+            return(0);
+        }
+    }
+    else if (argc != 1)
+    {
+        SerialPrintf("Usage: irq [<0-%d> <0x00-0x%02x, step 0x20>]\n",
+                     NUM_IRQS - 1, INT_PRIORITY_PENDSV - 0x20);
+        return(0);
+    }
+
+    for (ui32Irq = 0; ui32Irq < NUM_IRQS; ui32Irq++)
+    {
+        psIrq = IrqSourceGet(ui32Irq);
+        SerialPrintf("%d %8s 0x%02x\n", ui32Irq, psIrq->pcName,
+                     psIrq->ui8Priority);
+    }
+    SerialPrintf("  %8s 0x%02x\n", "pendsv", INT_PRIORITY_PENDSV);
+
+    return(0);
+}
+
+//*****************************************************************************
+//
+// capture [on|off]: starts or stops the telemetry capture stream.
+//
+//*****************************************************************************
+int
+Cmd_capture(int argc, char *argv[])
+{
+    bool bOn;
+
+    if (argc == 2)
+    {
+        if (!CommandSwitchParse(argv[1], &bOn))
+        {
+            SerialPrintf("Usage: capture [on|off]\n");
+            return(0);
+        }
+        TelemetryEnable(bOn);
+    }
+
+    SerialPrintf("Capture %s\n", TelemetryIsEnabled() ? "on" : "off");
+
+    return(0);
+}
+
+//*****************************************************************************
+//
+// profile [on|off|report]: starts or stops the zone profiler, or prints its
+// report now.
+//
+//*****************************************************************************
+int
+Cmd_profile(int argc, char *argv[])
+{
+#ifdef PROFILE_ENABLE
+    bool bOn;
+
+    if (argc == 2)
+    {
+        if (!ustrcmp(argv[1], "report"))
+        {
+            ProfileReport();
+            return(0);
+        }
+        if (!CommandSwitchParse(argv[1], &bOn))
+        {
+            SerialPrintf("Usage: profile [on|off|report]\n");
+            return(0);
+        }
+        ProfileEnable(bOn);
+        g_ui32ProfileReportMs = SchedulerTimeGet();
+    }
+
+    SerialPrintf("Profile %s\n", ProfileIsEnabled() ? "on" : "off");
+#else
+    SerialPrintf("Profiling is not built in, see PROFILE_ENABLE\n");
+#endif
+
+    return(0);
+}
+
+//*****************************************************************************
+//
+// The console command table, as searched by CmdLineProcess().
+//
+//*****************************************************************************
+tCmdLineEntry g_psCmdTable[] =
+{
+    { "help",    Cmd_help,    "List the commands" },
+    { "reg",     Cmd_reg,     "Print received registers" },
+    { "stats",   Cmd_stats,   "Print link, alarm and task statistics" },
+    { "alarm",   Cmd_alarm,   "Print or set alarm thresholds" },
+    { "rate",    Cmd_rate,    "Print or set the display rate" },
+    { "baud",    Cmd_baud,    "Print or change the UART baud rate" },
+    { "panel",   Cmd_panel,   "List or show panels" },
+    { "irq",     Cmd_irq,     "List or set the interrupt priorities" },
+    { "capture", Cmd_capture, "Start or stop the telemetry capture" },
+    { "profile", Cmd_profile, "Start, stop or report the profiler" },
+    { 0, 0, 0 }
+};
+
+//*****************************************************************************
+//
+// Runs a command line typed on the console and prompts for the next one.
+//
+//*****************************************************************************
+void
+CommandRun(char *pcLine)
+{
+    const char *pcChar;
+
+    for (pcChar = pcLine; *pcChar == ' '; pcChar++)
+    {
+    }
+
+    if (*pcChar)
+    {
+        switch (CmdLineProcess(pcLine))
+        {
+            case CMDLINE_BAD_CMD:
+                SerialPrintf("Unknown command, type help for a list\n");
+                break;
+
+            case CMDLINE_TOO_MANY_ARGS:
+                SerialPrintf("Too many arguments\n");
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    SerialPrintf("> ");
+}
+
+//*****************************************************************************
+//
+// Console task.  Runs the commands typed on the console, reports new alarm
+// events and, every SCHED_REPORT_MS, prints the console report.
+//
+//*****************************************************************************
+void
+ConsoleTask(void)
+{
+    tAlarmEvent sAlarmEvent;
+    char *pcLine;
+
+    //
+    // Switch the baud rate once a change has drained the output, and report
+    // a change that was not confirmed at the new rate.
+    //
+    if (SerialBaudPoll(SchedulerTimeGet()) == SERIAL_BAUD_RESTORED)
+    {
+        SerialPrintf("Baud %d restored\n> ", SerialBaudGet());
+    }
+
+    //
+    // Run the commands that have been completed since the last run.
+    //
+    while ((pcLine = SerialLineGet()) != 0)
+    {
+        CommandRun(pcLine);
+    }
+
+    //
+    // Report new alarm events on the console.
+    //
+    while (AlarmLogRead(&g_ui32AlarmSeq, &sAlarmEvent))
+    {
+        SerialPrintf("Alarm %6d.%03ds %s: %s -> %s\n",
+                     sAlarmEvent.ui32Time / 1000,
+                     sAlarmEvent.ui32Time % 1000,
+                     AlarmNameGet(sAlarmEvent.ui8Channel),
+                     g_ppcLightNames[sAlarmEvent.ui8From],
+                     g_ppcLightNames[sAlarmEvent.ui8To]);
+    }
+
+    if ((SchedulerTimeGet() - g_ui32SchedReportMs) >= SCHED_REPORT_MS)
+    {
+        ConsoleReport();
+    }
+}
+
+//*****************************************************************************
+//
+// Telemetry task.  Sends the received registers that changed, or all of them
+// when a key frame is due, every TLM_REG_PERIOD_MS.
+//
+//*****************************************************************************
+void
+TelemetryTask(void)
+{
+    TelemetryRegistersSend(g_ulDataRx2, SchedulerTimeGet());
+}
+
+#ifdef PROFILE_ENABLE
+//*****************************************************************************
+//
+// Profile task.  Updates the CPU load once a second and, while profiling is
+// enabled, prints the zone statistics every PROFILE_REPORT_MS.
+//
+//*****************************************************************************
+void
+ProfileTask(void)
+{
+    ProfileLoadUpdate();
+
+    if (ProfileIsEnabled() &&
+        ((SchedulerTimeGet() - g_ui32ProfileReportMs) >= PROFILE_REPORT_MS))
+    {
+        g_ui32ProfileReportMs = SchedulerTimeGet();
+        ProfileReport();
+    }
+}
+#endif
+
+//*****************************************************************************
+//
+// The scheduler task table, in TASK_* order.  Lower priority numbers run
+// first: the link supervision is tiny and time critical, and a frame is
+// collected before the next band of the first panel background is drawn.  The
+// widget and image tasks only post their paint jobs.  The budgets are the
+// longest run each task is expected to take.
+//
+//*****************************************************************************
+tSchedTask g_psTasks[NUM_TASKS] =
+{
+    SchedTaskStruct("link", LinkTask, 0, 1000, 100),
+    SchedTaskStruct("widget", WidgetTask, 1, 20, 100),
+    SchedTaskStruct("stats", StatsTask, 2, 0, 2000),
+    SchedTaskStruct("console", ConsoleTask, 4, 100, 5000),
+    SchedTaskStruct("tlm", TelemetryTask, 4, TLM_REG_PERIOD_MS, 2000),
+    SchedTaskStruct("image", ImageTask, 3, 0, 100),
+#ifdef PROFILE_ENABLE
+    SchedTaskStruct("profile", ProfileTask, 5, 1000, 5000),
+#endif
+};
+
+//*****************************************************************************
+//
+// The paint job table, in PAINT_* order.  The paint jobs do all of the drawing
+// and run from PendSV, preempted by every interrupt.  The widget job runs
+// first, so that a touch is answered before a frame is painted.
+//
+//*****************************************************************************
+tSchedTask g_psPaintJobs[NUM_PAINT_JOBS] =
+{
+    SchedTaskStruct("widget", WidgetJob, 0, 0, 100000),
+    SchedTaskStruct("render", RenderJob, 1, 0, 50000),
+    SchedTaskStruct("image", ImageJob, 1, 0, 3000),
+};
+
+//*****************************************************************************
+//
+// Main 'C' Language entry point.
+//
+//*****************************************************************************
+int
+main(void)
+
+
+{
+
+    char *title_str_full = malloc(25);
+
+    //uint32_t ulindex_max = 0;
+    int16_t val;
+    uint16_t LSB_val, MSB_val;
+
+    float float_val;
+
+    tRectangle sRect;
+
+
+//***************************************************************************************
+
+
+
+    g_ulDataRx2[0] = 0b1111000011110000;
+    g_ulDataRx2[1] = 0b1100110011110000;
+    g_ulDataRx2[2] = 0b1111000011001100;
+    g_ulDataRx2[3] = 0b1010101011110000;
+    g_ulDataRx2[4] = 0b1010101011001100;
+    g_ulDataRx2[5] = 0b1111000011110000;
+    g_ulDataRx2[6] = 0b1100110011110000;
+    g_ulDataRx2[7] = 0b1111000011001100;
+    g_ulDataRx2[8] = 0b1010101011110000;
+    g_ulDataRx2[9] = 0b1010101011001100;
+    g_ulDataRx2[10] = 0b1111000011110000;
+    g_ulDataRx2[11] = 0b1100110011110000;
+
+    g_ulDataRx2[13] = 0b1010101011110000;
+
+    g_ulDataRx2[pos_AGC] =	      0b100001111000011001100;
+    g_ulDataRx2[pos_Lock] =       0b1000000000000000;
+    g_ulDataRx2[pos_Lock_Avg2] =  0.8*32768.0;
+    g_ulDataRx2[pos_Hold] =       0b0000000000000000;
+    g_ulDataRx2[pos_CRC] =        0b0000000000000000;
+    g_ulDataRx2[pos_Frame] =      0b1000000000000000;
+
+
+    LSB_val = 128;
+    MSB_val = 0b11110000;
+	val = LSB_val + (MSB_val<<8);
+	float_val = val;
+	float_val =  g_ulDataRx2[0]/(16384.0);
+	float_val = float_val/(16384.0);
+
+
+
+
+//***************************************************************************************
+    //
+    // The FPU should be enabled because some compilers will use floating-
+    // point registers, even for non-floating-point code.  If the FPU is not
+    // enabled this will cause a fault.  This also ensures that floating-
+    // point operations could be added to this application and would work
+    // correctly and use the hardware floating-point unit.  Finally, lazy
+    // stacking is enabled for interrupt handlers.  This allows floating-
+    // point instructions to be used within interrupt handlers, but at the
+    // expense of extra stack usage.
+    //
+    FPUEnable();
+    FPULazyStackingEnable();
+
+    MPUEnable(MPU_CONFIG_PRIV_DEFAULT);
+
+
+    //
+    // Set the clock to 40Mhz derived from the PLL and the external oscillator
+    //
+    ROM_SysCtlClockSet(SYSCTL_SYSDIV_2_5 | SYSCTL_USE_PLL | SYSCTL_XTAL_16MHZ | SYSCTL_OSC_MAIN );
+
+    //
+    // Initialize the display driver.
+    //
+    Kentec320x240x16_SSD2119Init();
+
+
+    //
+    // Initialize the graphics context, and the compositor that the widgets
+    // draw through.  The render job draws on the display itself, but for the
+    // scopes, which draw through the display list.
+    //
+    GrContextInit(&g_sContext, &g_sKentec320x240x16_SSD2119);
+    CompositorInit(&g_sKentec320x240x16_SSD2119);
+    DisplayListInit(&g_sKentec320x240x16_SSD2119);
+    GrContextInit(&g_sScopeContext, &g_sDisplayListDisplay);
+    LEDSpriteInit();
+    PanelFieldsInit(&g_sContext);
+
+    //
+    // Fill the top 24 rows of the screen with blue to create the banner.
+    //
+    sRect.i16XMin = 0;
+    sRect.i16YMin = 0;
+    sRect.i16XMax = Display_Width- 1;
+    sRect.i16YMax = 23;
+    GrContextForegroundSet(&g_sContext, ClrDarkBlue);
+    GrRectFill(&g_sContext, &sRect);
+
+    //
+    // Put a white box around the banner.
+    //
+    GrContextForegroundSet(&g_sContext, ClrWhite);
+    GrRectDraw(&g_sContext, &sRect);
+
+    //
+    // Put the application name in the middle of the banner.
+    //
+    title_str_full = strcat(title_str_sub , ver);
+    GrContextFontSet(&g_sContext, &g_sFontCm20);
+    GrStringDrawCentered(&g_sContext, title_str_full , -1,
+                             Display_Width/ 2, 10, 0);
+
+
+    //
+    // Configure and enable uDMA
+    //
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_UDMA);
+    SysCtlDelay(10);
+    uDMAControlBaseSet(&sDMAControlTable[0]);
+    uDMAEnable();
+
+
+
+    //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 
     //
@@ -1824,7 +3790,7 @@ main(void)
     // widget tree.
     //
     TouchScreenInit();
-    TouchScreenCallbackSet(WidgetPointerMessage);
+    TouchScreenCallbackSet(TouchPointerMessage);
 
     //
     // Add the title bLock and the previous and next buttons to the widget
@@ -1861,10 +3827,11 @@ main(void)
     //
     // Display the setup on the console.
     //
-    UARTprintf("\n Read data from ZC706 via SPI Interface: \n");
-    UARTprintf("  SPI Mode = 0 with SPO=0 and SPH=0\n");
-    UARTprintf("  Data: 2 x 16-bit\n");
-    UARTprintf("  First 8 bits are identifier, second 8 bit are data MSB/LSB \n");
+    SerialPrintf("\n Read data from ZC706 via SPI Interface: \n");
+    SerialPrintf("  SPI Mode = 0 with SPO=0 and SPH=0\n");
+    SerialPrintf("  Data: 2 x 16-bit\n");
+    SerialPrintf("  First 8 bits are identifier, second 8 bit are data MSB/LSB \n");
+    SerialPrintf("  Type help for the console commands\n> ");
 
 
     //
@@ -1906,489 +3873,52 @@ main(void)
        ROM_GPIOPinTypeGPIOOutput(GPIO_PORTF_BASE, GPIO_PIN_1);
        ROM_GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_1, 0x00);
 
+       //
+       // Set the interrupt priorities (see defines.h).  The priority of
+       // PendSV, which runs the paint jobs, is set by PainterInit().
+       //
+       IrqInit();
+
        //
        // Enable interrupts to the processor.
        //
        ROM_IntMasterEnable();
 
-       // Enable the system ticks at 100 hz. - 100 measurements per second
        //
-       uint32_t a = ROM_SysCtlClockGet();		// Current Clock Rate (80MHz)
-       ROM_SysTickPeriodSet(a/4);			    //Argument has to be <= 16777216
+       // Start with all alarms green and an empty event log, then start
+       // sampling the received data at the acquisition rate.  The
+       // acquisition timer also provides the scheduler time base.
+       //
+       AlarmInit();
+       SchedulerInit(g_psTasks, NUM_TASKS, 0);
+       PainterInit(g_psPaintJobs, NUM_PAINT_JOBS, INT_PRIORITY_PENDSV);
+#ifdef PROFILE_ENABLE
+       ProfileInit();
+#endif
+#ifdef TELEMETRY_ENABLE
+       TelemetryInit(true);
+#else
+       TelemetryInit(false);
+#endif
+       AcquireInit();
+
+       //
+       // Enable the system ticks at the display frame rate.
+       //
+       DisplayRateSet(DISPLAY_RATE_HZ);
        ROM_SysTickIntEnable();
        ROM_SysTickEnable();
 
 
     //
-    // Begin the data collection and printing.  Loop Forever.
+    // Paint the first frame and the first panel background, which the
+    // initial paint has started, as soon as the scheduler starts, then hand
+    // the processor over to the scheduler.  It does not return.
     //
-    while(1)
-    {
-
-        //
-        // Process any messages in the widget message queue.
-        //
-        WidgetMessageQueueProcess();
-
-		//SysTick_Semafore = 1;
-    	i8Count++;
-
-    	if (SysTick_Semafore==1) 	 // Only print after Sys Tick occured
-   		{
-
-        	IntDisable(INT_SSI1);
-        	//
-        	// Display the data that were read from RX FIFO.
-        	//
-        	//ulindex_max = g_ulSSI1RXFF;
-        	g_ulSSI1RXFF = 0;
-
-        	//
-        	// Display indication that we have received data.
-        	//
-
-
-    		// Convert the 32bit integer to floats
-            // Convert the floats to integer part and fraction part for easy
-            // print.
-
-            // AGC Value
-    		fAGC =  log10((abs(g_ulDataRx2[pos_AGC]/32768.0)/1000.0)+0.00001);
-    		float_to_int_and_fract(fAGC, &i32IntegerPart, &i32FractionPart, 3);
-            usprintf(val_AGC_Str, " %3d.%03ddB  ", i32IntegerPart, i32FractionPart);
-            if ((fAGC<0)&(i32IntegerPart==0))
-            {
-                val_AGC_Str[2] = '-';
-            }
-            fLock = log10(abs(g_ulDataRx2[pos_Lock_Avg2]/32768.0)+0.00001);
-            float_to_int_and_fract(fLock, &i32IntegerPart, &i32FractionPart, 1);
-            usprintf(val_Lock_Str, " %2d.%01ddB  ", i32IntegerPart, i32FractionPart);
-            if ((fLock<0)&(i32IntegerPart==0))
-            {
-                val_Lock_Str[2] = '-';
-            }
-
-            // Hold Over
-    		fHold = (g_ulDataRx2[pos_Hold]/32768.0);
-    		float_to_int_and_fract(fHold, &i32IntegerPart, &i32FractionPart, 2);
-            usprintf(val_HOLD_Str, " %2d.%02d    ", i32IntegerPart, i32FractionPart);
-
-            // EVM
-    		fEVM = (g_ulDataRx2[pos_EVM]/(16384.0))+my_noise/10;
-    		float_to_int_and_fract(fEVM, &i32IntegerPart, &i32FractionPart, 2);
-            usprintf(val_EVM_Str, " %2d.%02d    ", i32IntegerPart, i32FractionPart);
-
-            // Frame
-            fFrame = 1.0 - (g_ulDataRx2[pos_Frame]/32768.0);
-    		float_to_int_and_fract(fFrame, &i32IntegerPart, &i32FractionPart, 1);
-            usprintf(val_Frame_Str, " %2d.%01d    ", i32IntegerPart, i32FractionPart);
-
-            // Message (CRC Error)
-            fCRC = (g_ulDataRx2[pos_CRC]/32768.0);
-    		float_to_int_and_fract(fCRC, &i32IntegerPart, &i32FractionPart, 1);
-            usprintf(val_CRC_Str, " %2d.%01d    ", i32IntegerPart, i32FractionPart);
-
-            // BER
-            fBER = 100.0*(1.0+g_ulDataRx2[pos_Error_Count])/(1.0+g_ulDataRx2[pos_Bit_Count]);
-    		float_to_int_and_fract(fBER, &i32IntegerPart, &i32FractionPart, 3);
-            usprintf(val_BER_Str, " %3d.%03d", i32IntegerPart, i32FractionPart);
-
-            uint32_t * i32_myunsignedint = 0;
-            int64_t i64_mysignedint = 0;
-            int32_t ihelp = 0;
-            uint32_t ihelpu = 0;
-
-//            ihelp = g_ulDataRx2[pos_Error_Count];
-            ihelpu = (uint32_t) g_ulDataRx2[pos_Error_Count];
-//          i64_mysignedint = (int64_t) i32_myunsignedint;
-//            fTemp2 = (float) i64_mysignedint;
-            fTemp2 = (float) ihelpu;
-//            if (fTemp2<0)
-//            {
-//                fTemp2 = fTemp2 + (4294967296.0);
-//            }
-            fTemp2 = fTemp2/1e6;
-    		float_to_int_and_fract(fTemp2, &i32IntegerPart, &i32FractionPart, 3);
-            usprintf(val8_string, "%2d.%03de6 ", i32IntegerPart, i32FractionPart);
-
-//            ihelp = g_ulDataRx2[pos_Bit_Count];
-            ihelpu = (uint32_t) g_ulDataRx2[pos_Bit_Count];
-//            * i32_myunsignedint = &ihelp;
-//            i64_mysignedint = (int64_t) i32_myunsignedint;
-//            fTempInt = (float) i64_mysignedint;
-            fTempInt = (float) ihelpu;
-//            if (fTempInt<0)
-//            {
-//                fTempInt = fTempInt + (4294967296.0);//2.1575e9;
-//            }
-            fTempInt = fTempInt/1e6;
-    		float_to_int_and_fract(fTempInt, &i32IntegerPart, &i32FractionPart, 1);
-//    		i32FractionPart = i32FractionPart/1000;
-            usprintf(val9_string, "%4d.%01de6 ", i32IntegerPart, i32FractionPart);
-
-            //
-            // Check light status
-            //
-            if (fAGC>0.0)
-            {
-                iLight_AGC = light_is_red;
-            }
-            else if (fAGC>-0.1)
-            {
-                iLight_AGC = light_is_yellow;
-            }
-            else
-            {
-                iLight_AGC = light_is_green;
-            }
-
-            if (fLock>0)
-            {
-                iLight_Lock = light_is_red;
-            }
-            else if (fLock>-0.1)
-            {
-                iLight_Lock = light_is_yellow;
-            }
-            else
-            {
-                iLight_Lock = light_is_green;
-            }
-
-
-            if (fHold>0)
-            {
-                iLight_Hold = light_is_red;
-            }
-            else
-            {
-                iLight_Hold = light_is_green;
-            }
-
-            if (fFrame>0)
-            {
-                iLight_Frame = light_is_red;
-            }
-            else
-            {
-                iLight_Frame = light_is_green;
-            }
-
-            if (fCRC>0)
-            {
-                iLight_CRC = light_is_red;
-            }
-            else
-            {
-                iLight_CRC = light_is_green;
-            }
-            iHealth = iLight_AGC + iLight_Lock + iLight_Hold + iLight_EVM + iLight_Frame + iLight_CRC + iLight_BER;
-            //
-            // Check which panel.
-            //
-            switch(g_ulPanel) {
-               case First_Panel :
-                   if (iHealth != iHealth_old)
-                   {
-                       DrawFirstImage((tWidget *) g_ulPanel, &sContext);
-                   }
-                   iHealth_old = iHealth;
-                   // Health status check
-                   if (iHealth !=0)
-                   {
-                       GrContextFontSet(&sContext, &g_sFontCm20);
-                       GrContextForegroundSet(&sContext, ClrRed);
-                       GrContextBackgroundSet(&sContext, ClrSeashell);
-                       GrStringDraw(&sContext, "Touch Screen to Take Action", -1, 20, 95, 1);
-                   }
-                   break;
-               case Block_Diagram  :
-                    GrContextFontSet(&sContext, &g_sFontCm20);
-           	        PushButtonFillColorSet( g_psPushButtons2 + 0, ClrLightGreen );
-           	        PushButtonFillColorSet( g_psPushButtons2 + 1, ClrLightGreen );
-           	        PushButtonFillColorSet( g_psPushButtons2 + 2, ClrLightGreen );
-           	        PushButtonFillColorSet( g_psPushButtons2 + 3, ClrLightGreen );
-           	        g_ulButtonState=0;
-           	        if (iLight_AGC == light_is_red)
-           	        {
-                	    //
-                	    // Change color of AGC button to Red
-                	    //
-                	    PushButtonFillColorSet( g_psPushButtons2 + 0, ClrRed );
-               	        g_ulButtonState=1;
-           	        }
-
-           	        else if ((iLight_Lock == light_is_red)|(iLight_Hold == light_is_red))
-           	        {
-                	    //
-                	    // Change color of PLL button to Red
-                	    //
-                 	    PushButtonFillColorSet( g_psPushButtons2 + 1, ClrRed );
-               	        g_ulButtonState=2;
-           	        }
-
-           	        else if (iLight_Frame == light_is_red)
-           	        {
-                	    //
-                	    // Change color of SYNC button to Red
-                	    //
-                	    PushButtonFillColorSet( g_psPushButtons2 + 2, ClrRed );
-               	        g_ulButtonState=4;
-           	        }
-
-           	        else if (iLight_CRC == light_is_red)
-           	        {
-                	    //
-                	    // Change color of MSG button to Red
-                	    //
-                	    PushButtonFillColorSet( g_psPushButtons2 + 3, ClrRed );
-               	        g_ulButtonState=8;
-           	        }
-                    else if (iLight_AGC == light_is_yellow)
-                    {
-                        //
-                        // Change color of AGC button to Yellow
-                        //
-                        PushButtonFillColorSet( g_psPushButtons2 + 0, ClrYellow );
-                        g_ulButtonState=1;
-                    }
-                    else if (iLight_Lock == light_is_yellow)
-                    {
-                        //
-                        // Change color of PLL button to Red
-                        //
-                        PushButtonFillColorSet( g_psPushButtons2 + 1, ClrYellow );
-                        g_ulButtonState=2;
-                    }
-                    WidgetPaint((tWidget *)(g_psPushButtons2+0) );
-                    WidgetPaint((tWidget *)(g_psPushButtons2+1) );
-                    WidgetPaint((tWidget *)(g_psPushButtons2+2) );
-                    WidgetPaint((tWidget *)(g_psPushButtons2+3) );
-                    if (iHealth !=0)
-                    {
-                        GrContextFontSet(&sContext, &g_sFontCm16);
-                        GrContextForegroundSet(&sContext, ClrRed);
-                        GrContextBackgroundSet(&sContext, ClrSeashell);
-                        GrStringDraw(&sContext, "Touch Red Block to Take Action", -1, 20, 95, 1);   // AGC
-                    }
-                    else
-                    {
-                        GrContextFontSet(&sContext, &g_sFontCm16);
-                        GrContextForegroundSet(&sContext, ClrSeashell);
-                        GrContextBackgroundSet(&sContext, ClrSeashell);
-                        GrStringDraw(&sContext, "Touch Red Block to Take Action", -1, 20, 95, 1);   // AGC
-                    }
-                    break;
-
-               case LED_Panel  :
-            	    GrContextForegroundSet(&sContext, ClrLime);
-                    //GrContextFontSet(&sContext, &g_sFontCm20);
-            	    if (iLight_AGC == light_is_red)
-            	    {
-            	    	GrContextForegroundSet(&sContext, ClrRed);
-            	    }
-            	    else if (iLight_AGC == light_is_yellow)
-            	    {
-            	        GrContextForegroundSet(&sContext, ClrYellow);
-            	    }
-            	    GrCircleFill(&sContext, (LED_x0 + 0*LED_xd), (LED_y0 + 0*LED_yd), 10);	//AGC
-            	    GrContextForegroundSet(&sContext, ClrLime);
-
-            	    if (iLight_Lock == light_is_red)
-            	    {
-            	    	GrContextForegroundSet(&sContext, ClrRed);
-            	    }
-                    else if (iLight_Lock == light_is_yellow)
-                    {
-                        GrContextForegroundSet(&sContext, ClrYellow);
-                    }
-            	    GrCircleFill(&sContext, (LED_x0 + 1*LED_xd), (LED_y0 + 0*LED_yd), 10);  // Lock
-            	    GrContextForegroundSet(&sContext, ClrLime);
-
-            	    if (iLight_Hold == light_is_red)
-            	    {
-            	    	GrContextForegroundSet(&sContext, ClrRed);
-            	    }
-            	    GrCircleFill(&sContext, (LED_x0 + 2*LED_xd), (LED_y0 + 0*LED_yd), 10);  // Hold Over
-            	    GrContextForegroundSet(&sContext, ClrLime);
-
-            	    GrCircleFill(&sContext, (LED_x0 + 3*LED_xd), (LED_y0 + 0*LED_yd), 10);	// EVM
-
-            	    if (iLight_Frame == light_is_red)
-            	    {
-            	    	GrContextForegroundSet(&sContext, ClrRed);
-            	    }
-            	    GrCircleFill(&sContext, (LED_x0 + 4*LED_xd), (LED_y0 + 0*LED_yd), 10);	// Frame
-            	    GrContextForegroundSet(&sContext, ClrLime);
-
-            	    if (iLight_CRC == light_is_red)
-            	    {
-            	    	GrContextForegroundSet(&sContext, ClrRed);
-            	    }
-            	    GrCircleFill(&sContext, (LED_x0 + 0*LED_xd), (LED_y0 + 1*LED_yd), 10);	// CRC (CRC)
-            	    GrContextForegroundSet(&sContext, ClrLime);
-
-            	    GrCircleFill(&sContext, (LED_x0 + 1*LED_xd), (LED_y0 + 1*LED_yd), 10);	// BER
-            	    GrCircleFill(&sContext, (LED_x0 + 2*LED_xd), (LED_y0 + 1*LED_yd), 10);
-            	    GrCircleFill(&sContext, (LED_x0 + 3*LED_xd), (LED_y0 + 1*LED_yd), 10);
-            	    GrCircleFill(&sContext, (LED_x0 + 4*LED_xd), (LED_y0 + 1*LED_yd), 10);
-
-                   break;
-
-               case Data_Panel  :
-                   GrContextFontSet(&sContext, &g_sFontCm20);
-                   GrContextForegroundSet(&sContext, ClrBlack);
-                   GrContextBackgroundSet(&sContext, ClrLime);
-                   GrStringDraw(&sContext, val_AGC_Str, -1, S11_x, S11_y, 1);	// AGC
-                   GrStringDraw(&sContext, val_Lock_Str, 10, S12_x, S12_y, 1);	// Lock
-
-                   GrStringDrawRight(&sContext, val_HOLD_Str, 8, S21_x+70, S21_y, 1);	// Holder Over
-                   GrStringDrawRight(&sContext, val_EVM_Str, 8, S22_x+70, S22_y, 1);	// EVM
-
-                   GrStringDrawRight(&sContext, val_Frame_Str, 8, S31_x+70, S31_y, 1);	// Frame Status
-                   GrStringDrawRight(&sContext, val_CRC_Str, 8, S32_x+70, S32_y, 1);	// Message Status (CRC Error)
-
-                   GrStringDrawRight(&sContext, val_BER_Str, 8, S41_x+70, S41_y, 1);	// BER
-                   GrStringDrawRight(&sContext, val8_string, -1, S42_x+80, S42_y, 1);
-
-                   GrStringDrawRight(&sContext, val9_string, -1, S51_x+100, S51_y, 1);
-                   GrStringDrawRight(&sContext, val10_string, 8, S52_x+70, S52_y, 1);
-
-                  break;
-
-               case RX_Panel  :
-            	   GrContextBackgroundSet(&sContext, ClrLime);
-                   GrContextForegroundSet(&sContext, ClrBlack);
-                   GrContextFontSet(&sContext, &g_sFontCm20);
-           	       if (iLight_AGC == light_is_red)
-           	       {
-           	    	   GrContextBackgroundSet(&sContext, ClrRed);
-           	    	   GrStringDraw(&sContext, "Check input to RX1A ", -1, 32, S21_y-5, 1);
-           	       }
-           	       else if (iLight_AGC == light_is_yellow)
-           	       {
-                       GrContextBackgroundSet(&sContext, ClrYellow);
-                       GrStringDraw(&sContext, "Weak Input Signal ", -1, 32, S21_y-5, 1);
-           	       }
-           	       else
-           	       {
-           	        GrStringDraw(&sContext,    "AGC within Range    ", -1, 32, S21_y-5, 1);
-           	       }
-                   GrStringDraw(&sContext, val_AGC_Str, 10, S11_x+10, S11_y, 1);	// AGC
-                   GrContextBackgroundSet(&sContext, ClrLime);
-
-                   UpdateScope(&sContext, & iAGC_Curve[0], fAGC, -0.5, 0.5, 136, 186, "AGC Graph");
-
-
-            	  break;
-
-               case PLL_Panel  :
-                   GrContextForegroundSet(&sContext, ClrBlack);
-
-                   GrContextBackgroundSet(&sContext, ClrLime);
-                   GrContextFontSet(&sContext, &g_sFontCm20);
-                   GrStringDrawRight(&sContext, val_Lock_Str, 9, S11_x+80, S11_y, 1);	// Lock
-                   GrStringDrawRight(&sContext, val_HOLD_Str, 8, S12_x+70, S12_y, 1);	// Hold Over
-                   if (iLight_Lock == light_is_red)
-                  {
-                      GrContextBackgroundSet(&sContext, ClrRed);
-                      GrStringDraw(&sContext, "PLL unLocked ", -1, 20, S21_y-5, 1);
-                  }
-                  else if (iLight_Lock == light_is_yellow)
-                  {
-                      GrContextBackgroundSet(&sContext, ClrYellow);
-                      GrStringDraw(&sContext, "PLL Lock Weak", -1, 20, S21_y-5, 1);
-                  }
-                  else
-                  {
-                      GrStringDraw(&sContext,    "PLL Locked   ", -1, 20, S21_y-5, 1);
-                  }
-                   GrContextBackgroundSet(&sContext, ClrLime);
-                   if (iLight_Hold == light_is_red)
-                  {
-                      GrContextBackgroundSet(&sContext, ClrRed);
-                      GrStringDraw(&sContext, "PLL Hold Mode ", -1, 170, S21_y-5, 1);
-                  }
-                  else
-                  {
-                   GrStringDraw(&sContext,    "PLL Track Mode", -1, 170, S21_y-5, 1);
-                  }
-                   GrContextBackgroundSet(&sContext, ClrLime);
-
-                   UpdateScope(&sContext, &iLock_Curve[0], fLock, -5.0, 5.0, 85, 132, "Lock Graph");
-                   UpdateScope(&sContext, &iHold_Curve[0], fHold, 0.0, 1.0, 138, 186, "Hold Graph");
-
-            	  break;
-
-               case SYNC_Panel  :
-                   GrContextForegroundSet(&sContext, ClrBlack);
-                   GrContextBackgroundSet(&sContext, ClrLime);
-                   GrContextFontSet(&sContext, &g_sFontCm20);
-
-                   if (iLight_Frame == light_is_red)
-                  {
-                      GrContextBackgroundSet(&sContext, ClrRed);
-                      GrStringDraw(&sContext, "Synchronization Error ", -1, 32, S21_y-5, 1);
-                  }
-                  else
-                  {
-                   GrStringDraw(&sContext,    "Synchronization Ok    ", -1, 32, S21_y-5, 1);
-                  }
-
-                   GrStringDrawRight(&sContext, val_Frame_Str, 8, S11_x+100, S11_y, 1); // Message Status (CRC Error)
-                   GrContextBackgroundSet(&sContext, ClrLime);
-
-                   UpdateScope(&sContext, & iFrame_Curve[0], fFrame, 0.0, 1.0, 136, 186, "Frame Graph");
-
-
-            	  break;
-
-               case RXMSG_Panel  :
-                   GrContextForegroundSet(&sContext, ClrBlack);
-                   GrContextBackgroundSet(&sContext, ClrLime);
-                   GrContextFontSet(&sContext, &g_sFontCm20);
-                   if (iLight_CRC == light_is_red)
-                  {
-                      GrContextBackgroundSet(&sContext, ClrRed);
-                      GrStringDraw(&sContext, "Check Sum Error ", -1, 32, S21_y-5, 1);
-                  }
-                  else
-                  {
-                   GrStringDraw(&sContext,    "Check Sum Ok    ", -1, 32, S21_y-5, 1);
-                  }
-                   GrStringDrawRight(&sContext, val_CRC_Str, 8, S11_x+70, S11_y, 1); // Message Status (CRC Error)
-                   GrContextBackgroundSet(&sContext, ClrLime);
-
-                   UpdateScope(&sContext, &iCRC_Curve[0], fCRC, 0.0, 1.0, 136, 186, "CRC Graph");
-
-            	  break;
-
-            }
-
-
-//           UARTprintf("Re(S): %10s   ", val_AGC_Str);
-/*            UARTprintf("Vin1: %10s   ", vin1_string);
-            UARTprintf("Vin2: %10s   ", vin2_string);
-            UARTprintf("Vin3: %10s   ",vin3_string);
-            UARTprintf("Isense1: %10s   ", isense1_string );
-            UARTprintf("Isense2: %10s   ", isense2_string );
-            UARTprintf("Temp1: %10s   ", temp1_string );
-            UARTprintf("Temp2: %10s   ", temp2_string );
-            UARTprintf("TempInt: %10s   ", tempint_string );
-            UARTprintf("\n");
-*/
-
-    		SysTick_Semafore =0;
-    		i8Count=0;
-    	    IntEnable(INT_SSI1);
-
-    	}
-
-
-    }//while end
-
-
-
+    SchedulerTaskPost(TASK_STATS);
+    SchedulerTaskPost(TASK_IMAGE);
+    SchedulerRun();
 
+    return(0);
 }
 
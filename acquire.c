@@ -0,0 +1,258 @@
+//*****************************************************************************
+//
+// acquire.c - High rate acquisition and statistics stage.
+//
+// Timer 0A samples the registers received from the ZC706 at ACQ_RATE_HZ,
+// converts them into the displayed metrics, runs the alarm engine and keeps
+// per-frame statistics.  The display stage collects the statistics at its own
+// frame rate, so short transients are seen by the alarms and in the frame
+// minimum/maximum even though the screen is only updated a few times a
+// second.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup acquire_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/timer.h"
+#include "defines.h"
+#include "alarm.h"
+#include "acquire.h"
+#include "scheduler.h"
+#include "profile.h"
+#include "irq.h"
+
+//*****************************************************************************
+//
+// The registers received over SPI by SSI1IntHandler().
+//
+//*****************************************************************************
+extern int32_t g_ulDataRx2[NUM_SSI_DATA];
+
+//*****************************************************************************
+//
+// The number of acquisition samples taken since AcquireInit().
+//
+//*****************************************************************************
+static volatile uint32_t g_ui32AcqTicks;
+
+//*****************************************************************************
+//
+// The statistics accumulated since the last call to AcquireFrameGet().
+//
+//*****************************************************************************
+static float g_pfAcqLast[NUM_ALARMS];
+static float g_pfAcqMin[NUM_ALARMS];
+static float g_pfAcqMax[NUM_ALARMS];
+static float g_pfAcqSum[NUM_ALARMS];
+static uint32_t g_ui32AcqCount;
+static uint32_t g_ui32AcqErrorCount;
+static uint32_t g_ui32AcqBitCount;
+
+//*****************************************************************************
+//
+// Converts the received registers into the displayed metrics.
+//
+//*****************************************************************************
+static void
+AcquireConvert(float *pfValue)
+{
+    //
+    // AGC and PLL lock level, as log ratios.
+    //
+    pfValue[ALARM_AGC] = log10f((fabsf(g_ulDataRx2[pos_AGC] / 32768.0f) /
+                                 1000.0f) + 0.00001f);
+    pfValue[ALARM_LOCK] = log10f(fabsf(g_ulDataRx2[pos_Lock_Avg2] /
+                                       32768.0f) + 0.00001f);
+
+    //
+    // Hold over, EVM, frame error and message (CRC error) ratios.
+    //
+    pfValue[ALARM_HOLD] = g_ulDataRx2[pos_Hold] / 32768.0f;
+    pfValue[ALARM_EVM] = g_ulDataRx2[pos_EVM] / 16384.0f;
+    pfValue[ALARM_FRAME] = 1.0f - (g_ulDataRx2[pos_Frame] / 32768.0f);
+    pfValue[ALARM_CRC] = g_ulDataRx2[pos_CRC] / 32768.0f;
+
+    //
+    // Bit error rate in percent.
+    //
+    pfValue[ALARM_BER] = (100.0f *
+                          (1.0f + (uint32_t)g_ulDataRx2[pos_Error_Count]) /
+                          (1.0f + (uint32_t)g_ulDataRx2[pos_Bit_Count]));
+}
+
+//*****************************************************************************
+//
+//! Initializes the acquisition stage.
+//!
+//! This function configures Timer 0A to interrupt at ACQ_RATE_HZ.  The alarm
+//! engine must have been initialized before this function is called.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+AcquireInit(void)
+{
+    g_ui32AcqTicks = 0;
+    g_ui32AcqCount = 0;
+
+    //
+    // Configure timer 0A as a periodic timer at the acquisition rate.
+    //
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER0);
+    TimerConfigure(TIMER0_BASE, TIMER_CFG_PERIODIC);
+    TimerLoadSet(TIMER0_BASE, TIMER_A, (SysCtlClockGet() / ACQ_RATE_HZ) - 1);
+    TimerIntEnable(TIMER0_BASE, TIMER_TIMA_TIMEOUT);
+    IntEnable(INT_TIMER0A);
+    TimerEnable(TIMER0_BASE, TIMER_A);
+}
+
+//*****************************************************************************
+//
+//! Handles the acquisition timer interrupt.
+//!
+//! This function is called at ACQ_RATE_HZ.  It converts the most recently
+//! received registers, feeds the alarm engine and updates the frame
+//! statistics.  It also advances the scheduler time.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+AcquireIntHandler(void)
+{
+    float pfValue[NUM_ALARMS];
+    uint32_t ui32Idx, ui32Now;
+
+    //
+    // The timer has been counting down from its load value since it expired.
+    //
+    IRQ_LATENCY(IRQ_TIMER0A, (TimerLoadGet(TIMER0_BASE, TIMER_A) -
+                              TimerValueGet(TIMER0_BASE, TIMER_A)));
+
+    PROFILE_ENTER(PROFILE_ACQUIRE);
+
+    TimerIntClear(TIMER0_BASE, TIMER_TIMA_TIMEOUT);
+
+    g_ui32AcqTicks++;
+    ui32Now = AcquireTimeGet();
+    SchedulerTick(ui32Now);
+
+    PROFILE_ENTER(PROFILE_CONVERT);
+    AcquireConvert(pfValue);
+    PROFILE_EXIT(PROFILE_CONVERT);
+
+    for(ui32Idx = 0; ui32Idx < NUM_ALARMS; ui32Idx++)
+    {
+        AlarmUpdate(ui32Idx, pfValue[ui32Idx], ui32Now);
+
+        g_pfAcqLast[ui32Idx] = pfValue[ui32Idx];
+
+        //
+        // The first sample of a frame restarts the statistics.
+        //
+        if(g_ui32AcqCount == 0)
+        {
+            g_pfAcqMin[ui32Idx] = pfValue[ui32Idx];
+            g_pfAcqMax[ui32Idx] = pfValue[ui32Idx];
+            g_pfAcqSum[ui32Idx] = 0.0f;
+        }
+        else if(pfValue[ui32Idx] < g_pfAcqMin[ui32Idx])
+        {
+            g_pfAcqMin[ui32Idx] = pfValue[ui32Idx];
+        }
+        else if(pfValue[ui32Idx] > g_pfAcqMax[ui32Idx])
+        {
+            g_pfAcqMax[ui32Idx] = pfValue[ui32Idx];
+        }
+        g_pfAcqSum[ui32Idx] += pfValue[ui32Idx];
+    }
+
+    g_ui32AcqErrorCount = g_ulDataRx2[pos_Error_Count];
+    g_ui32AcqBitCount = g_ulDataRx2[pos_Bit_Count];
+    g_ui32AcqCount++;
+
+    PROFILE_EXIT(PROFILE_ACQUIRE);
+}
+
+//*****************************************************************************
+//
+//! Collects the statistics of the current display frame.
+//!
+//! \param psFrame points to storage for the frame statistics.
+//!
+//! This function is called by the display stage once per frame.  It returns
+//! the statistics accumulated since the previous call and starts a new frame.
+//! If no sample has been taken since the previous call, the last values are
+//! returned with a sample count of zero.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+AcquireFrameGet(tAcqFrame *psFrame)
+{
+    uint32_t ui32Idx;
+
+    IntDisable(INT_TIMER0A);
+
+    for(ui32Idx = 0; ui32Idx < NUM_ALARMS; ui32Idx++)
+    {
+        psFrame->psMetric[ui32Idx].fLast = g_pfAcqLast[ui32Idx];
+        if(g_ui32AcqCount != 0)
+        {
+            psFrame->psMetric[ui32Idx].fMin = g_pfAcqMin[ui32Idx];
+            psFrame->psMetric[ui32Idx].fMax = g_pfAcqMax[ui32Idx];
+            psFrame->psMetric[ui32Idx].fMean = (g_pfAcqSum[ui32Idx] /
+                                                g_ui32AcqCount);
+        }
+        else
+        {
+            psFrame->psMetric[ui32Idx].fMin = g_pfAcqLast[ui32Idx];
+            psFrame->psMetric[ui32Idx].fMax = g_pfAcqLast[ui32Idx];
+            psFrame->psMetric[ui32Idx].fMean = g_pfAcqLast[ui32Idx];
+        }
+    }
+    psFrame->ui32ErrorCount = g_ui32AcqErrorCount;
+    psFrame->ui32BitCount = g_ui32AcqBitCount;
+    psFrame->ui32Samples = g_ui32AcqCount;
+    psFrame->ui32Time = AcquireTimeGet();
+
+    g_ui32AcqCount = 0;
+
+    IntEnable(INT_TIMER0A);
+}
+
+//*****************************************************************************
+//
+//! Gets the acquisition time.
+//!
+//! \return Returns the number of milliseconds of acquisition since
+//! AcquireInit().
+//
+//*****************************************************************************
+uint32_t
+AcquireTimeGet(void)
+{
+    return((uint32_t)(((uint64_t)g_ui32AcqTicks * 1000) / ACQ_RATE_HZ));
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
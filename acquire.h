@@ -0,0 +1,89 @@
+//*****************************************************************************
+//
+// acquire.h - Prototypes for the high rate acquisition and statistics stage.
+//
+//*****************************************************************************
+
+#ifndef __ACQUIRE_H__
+#define __ACQUIRE_H__
+
+//*****************************************************************************
+//
+// The rate, in Hz, at which the received registers are sampled, converted
+// and fed to the alarm engine.
+//
+//*****************************************************************************
+#define ACQ_RATE_HZ             1000
+
+//*****************************************************************************
+//
+//! The statistics of one metric over a display frame.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The most recent sample.
+    //
+    float fLast;
+
+    //
+    //! The smallest sample seen during the frame.
+    //
+    float fMin;
+
+    //
+    //! The largest sample seen during the frame.
+    //
+    float fMax;
+
+    //
+    //! The average of all samples taken during the frame.
+    //
+    float fMean;
+}
+tAcqStat;
+
+//*****************************************************************************
+//
+//! The data handed from the acquisition stage to the display stage once per
+//! display frame.  The metrics are indexed by alarm channel (ALARM_AGC ...
+//! ALARM_BER).
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The per-metric statistics since the previous frame.
+    //
+    tAcqStat psMetric[NUM_ALARMS];
+
+    //
+    //! The raw bit error and bit counters.
+    //
+    uint32_t ui32ErrorCount;
+    uint32_t ui32BitCount;
+
+    //
+    //! The number of acquisition samples that make up the statistics.
+    //
+    uint32_t ui32Samples;
+
+    //
+    //! The acquisition time, in milliseconds, of the most recent sample.
+    //
+    uint32_t ui32Time;
+}
+tAcqFrame;
+
+//*****************************************************************************
+//
+// Prototypes for the functions exported by the acquisition stage.
+//
+//*****************************************************************************
+extern void AcquireInit(void);
+extern void AcquireIntHandler(void);
+extern void AcquireFrameGet(tAcqFrame *psFrame);
+extern uint32_t AcquireTimeGet(void);
+
+#endif // __ACQUIRE_H__
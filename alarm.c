@@ -0,0 +1,371 @@
+//*****************************************************************************
+//
+// alarm.c - Link health alarm engine with hysteresis, debounce and event log.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup alarm_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "defines.h"
+#include "alarm.h"
+
+//*****************************************************************************
+//
+// The default thresholds.  AGC and Lock are in dB and keep the original
+// yellow/red limits of -0.1 dB and 0 dB, each with a 0.02 dB hysteresis band.
+// Hold, Frame and CRC are error ratios that go red as soon as they are above
+// zero; they have no room for a band so they rely on the debounce time.  EVM
+// and BER are displayed but do not raise alarms.
+//
+//*****************************************************************************
+static const tAlarmThreshold g_psAlarmDefaults[NUM_ALARMS] =
+{
+    { -0.1f, -0.12f, 0.0f, -0.02f, 250, 1000 },                 // AGC
+    { -0.1f, -0.12f, 0.0f, -0.02f, 250, 1000 },                 // Lock
+    { 0.0f, 0.0f, 0.0f, 0.0f, 250, 1000 },                      // Hold
+    { ALARM_NEVER, 0.0f, ALARM_NEVER, 0.0f, 250, 1000 },        // EVM
+    { 0.0f, 0.0f, 0.0f, 0.0f, 250, 1000 },                      // Frame
+    { 0.0f, 0.0f, 0.0f, 0.0f, 250, 1000 },                      // CRC
+    { ALARM_NEVER, 0.0f, ALARM_NEVER, 0.0f, 250, 1000 },        // BER
+};
+
+//*****************************************************************************
+//
+// The names of the alarm channels, as shown on the LED panel.
+//
+//*****************************************************************************
+static const char * const g_ppcAlarmNames[NUM_ALARMS] =
+{
+    str_LED1, str_LED2, str_LED3, str_LED4, str_LED5, str_LED6, str_LED7
+};
+
+//*****************************************************************************
+//
+// The run time state of one alarm channel.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // The thresholds in use.
+    //
+    tAlarmThreshold sThreshold;
+
+    //
+    // The committed level, as shown to the user.
+    //
+    uint8_t ui8Level;
+
+    //
+    // The level the metric currently asks for, and since when it has done so.
+    //
+    uint8_t ui8Pending;
+    uint32_t ui32PendingSince;
+}
+tAlarmState;
+
+static tAlarmState g_psAlarms[NUM_ALARMS];
+
+//*****************************************************************************
+//
+// The event log.  g_ui32AlarmEvents counts every event ever logged; the entry
+// for event n lives at index n modulo ALARM_LOG_SIZE.
+//
+//*****************************************************************************
+static tAlarmEvent g_psAlarmLog[ALARM_LOG_SIZE];
+static volatile uint32_t g_ui32AlarmEvents;
+
+//*****************************************************************************
+//
+// Determines the level a metric asks for, given the level currently shown.
+// Raising uses the On thresholds, while a level that is already shown is kept
+// until the metric drops to its Off threshold.
+//
+//*****************************************************************************
+static uint8_t
+AlarmLevelEval(const tAlarmThreshold *psThreshold, uint8_t ui8Level,
+               float fValue)
+{
+    if((fValue > psThreshold->fRedOn) ||
+       ((ui8Level == light_is_red) && (fValue > psThreshold->fRedOff)))
+    {
+        return(light_is_red);
+    }
+
+    if((fValue > psThreshold->fYellowOn) ||
+       ((ui8Level != light_is_green) && (fValue > psThreshold->fYellowOff)))
+    {
+        return(light_is_yellow);
+    }
+
+    return(light_is_green);
+}
+
+//*****************************************************************************
+//
+// Appends an event to the log, overwriting the oldest entry when it is full.
+//
+//*****************************************************************************
+static void
+AlarmLogAdd(uint32_t ui32Channel, uint8_t ui8From, uint8_t ui8To,
+            uint32_t ui32Now)
+{
+    tAlarmEvent *psEvent;
+
+    psEvent = &g_psAlarmLog[g_ui32AlarmEvents & (ALARM_LOG_SIZE - 1)];
+    psEvent->ui32Time = ui32Now;
+    psEvent->ui8Channel = ui32Channel;
+    psEvent->ui8From = ui8From;
+    psEvent->ui8To = ui8To;
+
+    g_ui32AlarmEvents++;
+}
+
+//*****************************************************************************
+//
+//! Initializes the alarm engine.
+//!
+//! This function loads the default thresholds, sets all channels to green and
+//! empties the event log.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+AlarmInit(void)
+{
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < NUM_ALARMS; ui32Idx++)
+    {
+        g_psAlarms[ui32Idx].sThreshold = g_psAlarmDefaults[ui32Idx];
+        g_psAlarms[ui32Idx].ui8Level = light_is_green;
+        g_psAlarms[ui32Idx].ui8Pending = light_is_green;
+        g_psAlarms[ui32Idx].ui32PendingSince = 0;
+    }
+
+    g_ui32AlarmEvents = 0;
+}
+
+//*****************************************************************************
+//
+//! Sets the thresholds of an alarm channel.
+//!
+//! \param ui32Channel is the alarm channel.
+//! \param psThreshold points to the new thresholds.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+AlarmThresholdSet(uint32_t ui32Channel, const tAlarmThreshold *psThreshold)
+{
+    if(ui32Channel < NUM_ALARMS)
+    {
+        g_psAlarms[ui32Channel].sThreshold = *psThreshold;
+    }
+}
+
+//*****************************************************************************
+//
+//! Gets the thresholds of an alarm channel.
+//!
+//! \param ui32Channel is the alarm channel.
+//! \param psThreshold points to storage for the thresholds.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+AlarmThresholdGet(uint32_t ui32Channel, tAlarmThreshold *psThreshold)
+{
+    if(ui32Channel < NUM_ALARMS)
+    {
+        *psThreshold = g_psAlarms[ui32Channel].sThreshold;
+    }
+}
+
+//*****************************************************************************
+//
+//! Feeds a new sample of a metric into its alarm channel.
+//!
+//! \param ui32Channel is the alarm channel.
+//! \param fValue is the current value of the metric.
+//! \param ui32Now is the current time in milliseconds.
+//!
+//! The level requested by the sample is compared against the hysteresis
+//! bands.  A change of level is committed, and logged, only once it has been
+//! requested continuously for the raise or clear debounce time.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+AlarmUpdate(uint32_t ui32Channel, float fValue, uint32_t ui32Now)
+{
+    tAlarmState *psAlarm;
+    uint8_t ui8Target;
+    uint32_t ui32Hold;
+
+    if(ui32Channel >= NUM_ALARMS)
+    {
+        return;
+    }
+    psAlarm = &g_psAlarms[ui32Channel];
+
+    ui8Target = AlarmLevelEval(&psAlarm->sThreshold, psAlarm->ui8Level,
+                               fValue);
+
+    //
+    // Restart the debounce timer whenever the requested level changes.
+    //
+    if(ui8Target != psAlarm->ui8Pending)
+    {
+        psAlarm->ui8Pending = ui8Target;
+        psAlarm->ui32PendingSince = ui32Now;
+    }
+
+    if(ui8Target == psAlarm->ui8Level)
+    {
+        return;
+    }
+
+    ui32Hold = ((ui8Target > psAlarm->ui8Level) ?
+                psAlarm->sThreshold.ui16RaiseMs :
+                psAlarm->sThreshold.ui16ClearMs);
+
+    if((ui32Now - psAlarm->ui32PendingSince) >= ui32Hold)
+    {
+        AlarmLogAdd(ui32Channel, psAlarm->ui8Level, ui8Target, ui32Now);
+        psAlarm->ui8Level = ui8Target;
+    }
+}
+
+//*****************************************************************************
+//
+//! Gets the committed level of an alarm channel.
+//!
+//! \param ui32Channel is the alarm channel.
+//!
+//! \return Returns light_is_green, light_is_yellow or light_is_red.
+//
+//*****************************************************************************
+uint8_t
+AlarmLevelGet(uint32_t ui32Channel)
+{
+    if(ui32Channel >= NUM_ALARMS)
+    {
+        return(light_is_green);
+    }
+
+    return(g_psAlarms[ui32Channel].ui8Level);
+}
+
+//*****************************************************************************
+//
+//! Gets the overall link health.
+//!
+//! \return Returns the sum of the committed levels of all channels; zero
+//! means every channel is green.
+//
+//*****************************************************************************
+uint8_t
+AlarmHealthGet(void)
+{
+    uint32_t ui32Idx;
+    uint8_t ui8Health;
+
+    ui8Health = 0;
+    for(ui32Idx = 0; ui32Idx < NUM_ALARMS; ui32Idx++)
+    {
+        ui8Health += g_psAlarms[ui32Idx].ui8Level;
+    }
+
+    return(ui8Health);
+}
+
+//*****************************************************************************
+//
+//! Gets the display name of an alarm channel.
+//!
+//! \param ui32Channel is the alarm channel.
+//!
+//! \return Returns a pointer to the name string.
+//
+//*****************************************************************************
+const char *
+AlarmNameGet(uint32_t ui32Channel)
+{
+    if(ui32Channel >= NUM_ALARMS)
+    {
+        return("---");
+    }
+
+    return(g_ppcAlarmNames[ui32Channel]);
+}
+
+//*****************************************************************************
+//
+//! Gets the number of events logged since AlarmInit().
+//!
+//! \return Returns the total event count, including events that have since
+//! been overwritten in the log.
+//
+//*****************************************************************************
+uint32_t
+AlarmLogCountGet(void)
+{
+    return(g_ui32AlarmEvents);
+}
+
+//*****************************************************************************
+//
+//! Reads the next event from the alarm event log.
+//!
+//! \param pui32Seq points to the reader's sequence number, which is the count
+//! of events it has consumed so far.  Start with zero to read the whole log.
+//! \param psEvent points to storage for the event.
+//!
+//! A reader that has fallen more than ALARM_LOG_SIZE events behind skips
+//! forward to the oldest event still held in the log.
+//!
+//! \return Returns \b true if an event was read or \b false if the reader is
+//! up to date.
+//
+//*****************************************************************************
+bool
+AlarmLogRead(uint32_t *pui32Seq, tAlarmEvent *psEvent)
+{
+    uint32_t ui32Events;
+
+    ui32Events = g_ui32AlarmEvents;
+
+    if(*pui32Seq == ui32Events)
+    {
+        return(false);
+    }
+
+    if((ui32Events - *pui32Seq) > ALARM_LOG_SIZE)
+    {
+        *pui32Seq = ui32Events - ALARM_LOG_SIZE;
+    }
+
+    *psEvent = g_psAlarmLog[*pui32Seq & (ALARM_LOG_SIZE - 1)];
+    (*pui32Seq)++;
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
@@ -0,0 +1,128 @@
+//*****************************************************************************
+//
+// alarm.h - Prototypes for the link health alarm engine.
+//
+//*****************************************************************************
+
+#ifndef __ALARM_H__
+#define __ALARM_H__
+
+//*****************************************************************************
+//
+// The alarm channels, one per monitored metric.  The order matches the
+// traffic lights on the LED panel.
+//
+//*****************************************************************************
+#define ALARM_AGC               0
+#define ALARM_LOCK              1
+#define ALARM_HOLD              2
+#define ALARM_EVM               3
+#define ALARM_FRAME             4
+#define ALARM_CRC               5
+#define ALARM_BER               6
+#define NUM_ALARMS              7
+
+//*****************************************************************************
+//
+// The number of entries kept in the alarm event log.  Must be a power of two.
+//
+//*****************************************************************************
+#define ALARM_LOG_SIZE          32
+
+//*****************************************************************************
+//
+// A threshold value that can never be exceeded; used to disable a level.
+//
+//*****************************************************************************
+#define ALARM_NEVER             3.0e38f
+
+//*****************************************************************************
+//
+//! The thresholds applied to one alarm channel.  A level is raised when the
+//! metric rises above its On value and cleared only once the metric falls to
+//! or below its Off value, so Off must not be greater than On.  A new level is
+//! only committed after the metric has asked for it continuously for the
+//! raise or clear debounce time.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The value above which the channel turns yellow.
+    //
+    float fYellowOn;
+
+    //
+    //! The value at or below which a yellow channel turns green again.
+    //
+    float fYellowOff;
+
+    //
+    //! The value above which the channel turns red.
+    //
+    float fRedOn;
+
+    //
+    //! The value at or below which a red channel drops back to yellow/green.
+    //
+    float fRedOff;
+
+    //
+    //! The time, in milliseconds, a worse level must persist to be raised.
+    //
+    uint16_t ui16RaiseMs;
+
+    //
+    //! The time, in milliseconds, a better level must persist to be cleared.
+    //
+    uint16_t ui16ClearMs;
+}
+tAlarmThreshold;
+
+//*****************************************************************************
+//
+//! One entry of the alarm event log.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The time stamp, in milliseconds, at which the new level was committed.
+    //
+    uint32_t ui32Time;
+
+    //
+    //! The alarm channel (ALARM_AGC ... ALARM_BER).
+    //
+    uint8_t ui8Channel;
+
+    //
+    //! The level before the change (light_is_green/yellow/red).
+    //
+    uint8_t ui8From;
+
+    //
+    //! The level after the change.
+    //
+    uint8_t ui8To;
+}
+tAlarmEvent;
+
+//*****************************************************************************
+//
+// Prototypes for the functions exported by the alarm engine.
+//
+//*****************************************************************************
+extern void AlarmInit(void);
+extern void AlarmThresholdSet(uint32_t ui32Channel,
+                              const tAlarmThreshold *psThreshold);
+extern void AlarmThresholdGet(uint32_t ui32Channel,
+                              tAlarmThreshold *psThreshold);
+extern void AlarmUpdate(uint32_t ui32Channel, float fValue, uint32_t ui32Now);
+extern uint8_t AlarmLevelGet(uint32_t ui32Channel);
+extern uint8_t AlarmHealthGet(void);
+extern const char *AlarmNameGet(uint32_t ui32Channel);
+extern uint32_t AlarmLogCountGet(void);
+extern bool AlarmLogRead(uint32_t *pui32Seq, tAlarmEvent *psEvent);
+
+#endif // __ALARM_H__
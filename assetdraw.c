@@ -0,0 +1,300 @@
+//*****************************************************************************
+//
+// assetdraw.c - Draws the images of the asset pipeline, in any of its
+// formats.
+//
+// tools/assets.py converts each image of assets/manifest.txt to a palette,
+// dithered, run-length encoded, display format and sprite candidate,
+// measures how long each one takes to draw in the host simulator, and keeps
+// the one that fits best (see assets/report.txt).  The application draws the
+// images with AssetDraw(), so that a change of format is only a change of the
+// generated source.
+//
+// A full-screen image takes some 20 ms to draw.  The AssetDrawJob functions
+// draw one a band of rows at a time instead, so that the application can go
+// on with its other work between the bands.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup assetdraw_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "grlib/grlib.h"
+#include "grlib/widget.h"
+#include "Kentec320x240x16_ssd2119_8bit.h"
+#include "compositor.h"
+#include "rleimage.h"
+#include "sprite.h"
+#include "assetdraw.h"
+
+//*****************************************************************************
+//
+// Draws an image in the ASSET_FMT_RGB565 format, clipped, as one stream of
+// rows.
+//
+//*****************************************************************************
+static void
+AssetRGB565Draw(const tContext *pContext, const uint8_t *pui8Image,
+                int32_t i32X, int32_t i32Y)
+{
+    tRectangle sImage, sRect;
+    int32_t i32Width, i32Row;
+
+    i32Width = pui8Image[1] | (pui8Image[2] << 8);
+    sImage.i16XMin = i32X;
+    sImage.i16YMin = i32Y;
+    sImage.i16XMax = i32X + i32Width - 1;
+    sImage.i16YMax = i32Y + (pui8Image[3] | (pui8Image[4] << 8)) - 1;
+    if(!GrRectIntersectGet(&sImage, (tRectangle *)&pContext->sClipRegion,
+                           &sRect))
+    {
+        return;
+    }
+
+    //
+    // Skip to the first visible pixel.
+    //
+    pui8Image += 5 + (((((sRect.i16YMin - i32Y) * i32Width) +
+                        (sRect.i16XMin - i32X))) * 2);
+
+    CompositorRectDraw(&sRect);
+    Kentec320x240x16_SSD2119StreamStart(sRect.i16XMin, sRect.i16YMin,
+                                        sRect.i16XMax - sRect.i16XMin + 1,
+                                        sRect.i16YMax - sRect.i16YMin + 1);
+
+    //
+    // Stream the image as one burst when none of it is clipped at the sides,
+    // and a row at a time otherwise.
+    //
+    if((sRect.i16XMin == sImage.i16XMin) && (sRect.i16XMax == sImage.i16XMax))
+    {
+        Kentec320x240x16_SSD2119StreamData(pui8Image,
+                                           (sRect.i16YMax - sRect.i16YMin +
+                                            1) * i32Width);
+    }
+    else
+    {
+        for(i32Row = sRect.i16YMin; i32Row <= sRect.i16YMax; i32Row++)
+        {
+            Kentec320x240x16_SSD2119StreamData(pui8Image,
+                                               sRect.i16XMax -
+                                               sRect.i16XMin + 1);
+            pui8Image += i32Width * 2;
+        }
+    }
+
+    Kentec320x240x16_SSD2119StreamEnd();
+}
+
+//*****************************************************************************
+//
+//! Draws an image written by the asset pipeline.
+//!
+//! \param pContext is a pointer to the drawing context to use.
+//! \param pui8Image is a pointer to the image, in the ASSET_FMT_RGB565,
+//! RLE_IMAGE_FMT_8BPP or SPRITE_FMT_RGB565 format, or in any format that
+//! GrImageDraw() draws.
+//! \param i32X is the X coordinate of the upper left corner of the image.
+//! \param i32Y is the Y coordinate of the upper left corner of the image.
+//!
+//! The image is drawn by the decoder of its format, clipped to the clipping
+//! region of the context.  Like GrImageDraw(), the foreground and background
+//! colors of the context are not used.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+AssetDraw(const tContext *pContext, const uint8_t *pui8Image, int32_t i32X,
+          int32_t i32Y)
+{
+    switch(pui8Image[0])
+    {
+        case ASSET_FMT_RGB565:
+        {
+            AssetRGB565Draw(pContext, pui8Image, i32X, i32Y);
+            break;
+        }
+
+        case RLE_IMAGE_FMT_8BPP:
+        {
+            RLEImageDraw(pContext, pui8Image, i32X, i32Y);
+            break;
+        }
+
+        case SPRITE_FMT_RGB565:
+        {
+            SpriteDraw(pContext, pui8Image, i32X, i32Y);
+            break;
+        }
+
+        default:
+        {
+            GrImageDraw(pContext, pui8Image, i32X, i32Y);
+            break;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Starts drawing an image a band of rows at a time.
+//!
+//! \param psJob is a pointer to the job that holds the state of the draw.
+//! \param pContext is a pointer to the drawing context to use.
+//! \param pui8Image is a pointer to the image, in any format that AssetDraw()
+//! draws.
+//! \param i32X is the X coordinate of the upper left corner of the image.
+//! \param i32Y is the Y coordinate of the upper left corner of the image.
+//! \param ui32Rows is the number of rows to draw per call of
+//! AssetDrawJobRun().
+//!
+//! Nothing is drawn here.  The image is drawn from the top by calls of
+//! AssetDrawJobRun(), each of which draws the next \e ui32Rows rows, clipped
+//! to the clipping region \e pContext has now.  A job that is still in
+//! progress is abandoned, so that the display shows the latest image that was
+//! asked for.  The pending compositor fills under the image are cut away
+//! here, so that they are not drawn ahead of the bands that cover them.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+AssetDrawJobStart(tAssetDrawJob *psJob, const tContext *pContext,
+                  const uint8_t *pui8Image, int32_t i32X, int32_t i32Y,
+                  uint32_t ui32Rows)
+{
+    tRectangle sImage, sRect;
+
+    psJob->sContext = *pContext;
+    psJob->pui8Image = 0;
+    psJob->i32X = i32X;
+    psJob->i32Y = i32Y;
+    psJob->ui32Rows = ui32Rows ? ui32Rows : 1;
+    psJob->sCursor.pui8Token = 0;
+
+    //
+    // Only the visible rows of the image are drawn.
+    //
+    sImage.i16XMin = i32X;
+    sImage.i16YMin = i32Y;
+    sImage.i16XMax = i32X + GrImageWidthGet(pui8Image) - 1;
+    sImage.i16YMax = i32Y + GrImageHeightGet(pui8Image) - 1;
+    if(GrRectIntersectGet(&sImage, &psJob->sContext.sClipRegion, &sRect))
+    {
+        psJob->pui8Image = pui8Image;
+        psJob->i32Row = sRect.i16YMin;
+        psJob->i32RowMax = sRect.i16YMax;
+
+        //
+        // A sprite may let what is under it show through, so its bands draw
+        // the fills under them instead.
+        //
+        if(pui8Image[0] != SPRITE_FMT_RGB565)
+        {
+            CompositorRectDraw(&sRect);
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Draws the next band of rows of an image started by AssetDrawJobStart().
+//!
+//! \param psJob is a pointer to the job.
+//!
+//! The band is drawn like AssetDraw() draws it, with the clipping region
+//! narrowed to the band.  The run-length encoded images are decoded from where
+//! the previous band stopped; the other formats can start at any row.
+//!
+//! \return Returns \b true if rows of the image remain to be drawn, and
+//! \b false once the image is complete or when no job is in progress.
+//
+//*****************************************************************************
+bool
+AssetDrawJobRun(tAssetDrawJob *psJob)
+{
+    tContext sBand;
+
+    if(!psJob->pui8Image)
+    {
+        return(false);
+    }
+
+    //
+    // Draw the band through a copy of the context clipped to it.
+    //
+    sBand = psJob->sContext;
+    sBand.sClipRegion.i16YMin = psJob->i32Row;
+    sBand.sClipRegion.i16YMax = psJob->i32Row + psJob->ui32Rows - 1;
+    if(sBand.sClipRegion.i16YMax > psJob->i32RowMax)
+    {
+        sBand.sClipRegion.i16YMax = psJob->i32RowMax;
+    }
+    if(psJob->pui8Image[0] == RLE_IMAGE_FMT_8BPP)
+    {
+        RLEImageRowsDraw(&sBand, psJob->pui8Image, psJob->i32X, psJob->i32Y,
+                         &psJob->sCursor);
+    }
+    else
+    {
+        AssetDraw(&sBand, psJob->pui8Image, psJob->i32X, psJob->i32Y);
+    }
+
+    //
+    // Move on to the next band, and finish after the last.
+    //
+    psJob->i32Row = sBand.sClipRegion.i16YMax + 1;
+    if(psJob->i32Row > psJob->i32RowMax)
+    {
+        psJob->pui8Image = 0;
+    }
+
+    return(psJob->pui8Image != 0);
+}
+
+//*****************************************************************************
+//
+//! Abandons an image started by AssetDrawJobStart().
+//!
+//! \param psJob is a pointer to the job.
+//!
+//! The rows that have been drawn stay on the display.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+AssetDrawJobCancel(tAssetDrawJob *psJob)
+{
+    psJob->pui8Image = 0;
+}
+
+//*****************************************************************************
+//
+//! Determines whether an image started by AssetDrawJobStart() is still being
+//! drawn.
+//!
+//! \param psJob is a pointer to the job.
+//!
+//! \return Returns \b true if rows of the image remain to be drawn.
+//
+//*****************************************************************************
+bool
+AssetDrawJobBusy(tAssetDrawJob *psJob)
+{
+    return(psJob->pui8Image != 0);
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
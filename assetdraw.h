@@ -0,0 +1,86 @@
+//*****************************************************************************
+//
+// assetdraw.h - Prototypes for drawing the images of the asset pipeline.
+//
+//*****************************************************************************
+
+#ifndef __ASSETDRAW_H__
+#define __ASSETDRAW_H__
+
+//*****************************************************************************
+//
+// The format byte of an uncompressed image in the display format.  The image
+// is laid out like a TivaWare image without a palette:
+//
+//     ASSET_FMT_RGB565
+//     width, low byte first (2 bytes)
+//     height, low byte first (2 bytes)
+//     the pixels, row by row from the top, as returned by
+//     DpyColorTranslate(), low byte first (2 bytes each)
+//
+// tools/assets.py writes the images in this format, the RLE_IMAGE_FMT_8BPP
+// format (see rleimage.h), the SPRITE_FMT_RGB565 format (see sprite.h) or the
+// TivaWare IMAGE_FMT_4BPP_UNCOMP and IMAGE_FMT_8BPP_UNCOMP formats, whichever
+// suits each image best.
+//
+//*****************************************************************************
+#define ASSET_FMT_RGB565        0x50
+
+//*****************************************************************************
+//
+//! An image drawn a band of rows at a time by AssetDrawJobRun(), so that a
+//! large image does not hold off the other work of the application for the
+//! whole of its draw.  The structure needs rleimage.h.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The drawing context, with the clipping region it was started with.
+    //
+    tContext sContext;
+
+    //
+    //! The image, or 0 when no draw is in progress.
+    //
+    const uint8_t *pui8Image;
+
+    //
+    //! The screen position of the upper left corner of the image.
+    //
+    int32_t i32X;
+    int32_t i32Y;
+
+    //
+    //! The next row to draw and the last, in screen coordinates.
+    //
+    int32_t i32Row;
+    int32_t i32RowMax;
+
+    //
+    //! The number of rows drawn by each call of AssetDrawJobRun().
+    //
+    uint32_t ui32Rows;
+
+    //
+    //! The decoder position of a RLE_IMAGE_FMT_8BPP image.
+    //
+    tRLEImageCursor sCursor;
+}
+tAssetDrawJob;
+
+//*****************************************************************************
+//
+// Prototypes for the functions exported by the image dispatcher.
+//
+//*****************************************************************************
+extern void AssetDraw(const tContext *pContext, const uint8_t *pui8Image,
+                      int32_t i32X, int32_t i32Y);
+extern void AssetDrawJobStart(tAssetDrawJob *psJob, const tContext *pContext,
+                              const uint8_t *pui8Image, int32_t i32X,
+                              int32_t i32Y, uint32_t ui32Rows);
+extern bool AssetDrawJobRun(tAssetDrawJob *psJob);
+extern void AssetDrawJobCancel(tAssetDrawJob *psJob);
+extern bool AssetDrawJobBusy(tAssetDrawJob *psJob);
+
+#endif // __ASSETDRAW_H__
@@ -0,0 +1,8717 @@
+//*****************************************************************************
+//
+// assets.c - The images of the application, as picked by tools/assets.py.
+//
+// Generated from assets/manifest.txt by:
+//
+//   tools/assets.py ../assets/manifest.txt --sim ./zc706sim --budget 131072 -o ../assets.c --report ../assets/report.txt
+//
+// Do not edit.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+
+//
+// flower.png: 320x216 rle (tolerance 1), 56718 bytes, 99.0 dB.
+//
+const uint8_t g_pui_Flower_Image[] =
+{
+    0x48, 0x40, 0x01, 0xd8, 0x00, 0xfe, 0x00, 0x00, 0x21, 0x00, 0x41, 0x00,
+    0x01, 0x00, 0x40, 0x00, 0x82, 0x08, 0x41, 0x08, 0x62, 0x08, 0x84, 0x08,
+    0xa7, 0x08, 0x80, 0x08, 0x60, 0x08, 0x81, 0x08, 0x83, 0x08, 0xa6, 0x08,
+    0x62, 0x10, 0x83, 0x10, 0x00, 0x11, 0xc0, 0x10, 0xc2, 0x10, 0xa3, 0x10,
+    0xc4, 0x10, 0xa5, 0x18, 0xc4, 0x18, 0xe2, 0x18, 0xe0, 0x18, 0xe5, 0x18,
+    0x28, 0x19, 0x80, 0x19, 0xc5, 0x18, 0x41, 0x19, 0x05, 0x21, 0x05, 0x21,
+    0x06, 0x21, 0x24, 0x21, 0x43, 0x21, 0xe0, 0x21, 0x47, 0x21, 0x80, 0x21,
+    0x47, 0x29, 0x80, 0x2a, 0x40, 0x2a, 0x88, 0x29, 0x69, 0x29, 0x68, 0x29,
+    0x86, 0x29, 0x68, 0x31, 0xa9, 0x31, 0xaa, 0x31, 0xa8, 0x31, 0x80, 0x32,
+    0xa9, 0x31, 0x40, 0x32, 0xeb, 0x39, 0x40, 0x3b, 0xea, 0x39, 0x08, 0x3a,
+    0x42, 0x3a, 0x0a, 0x3a, 0x2c, 0x3a, 0x25, 0x3a, 0xcb, 0x39, 0x2c, 0x3a,
+    0xe0, 0x3a, 0x6e, 0x42, 0x0b, 0x42, 0x0c, 0x42, 0x6d, 0x42, 0x4d, 0x42,
+    0xc0, 0x43, 0xae, 0x42, 0x4c, 0x4a, 0x6e, 0x4a, 0x4d, 0x4a, 0x6a, 0x4a,
+    0x40, 0x4b, 0x4d, 0x4a, 0x8e, 0x4a, 0x8e, 0x4a, 0xcf, 0x4a, 0x8d, 0x4a,
+    0xaf, 0x4a, 0xaa, 0x4a, 0x60, 0x4b, 0x8c, 0x52, 0x8e, 0x52, 0xf0, 0x52,
+    0x20, 0x54, 0xaf, 0x52, 0xcf, 0x52, 0x01, 0x53, 0xce, 0x52, 0xc0, 0x53,
+    0xae, 0x52, 0xcd, 0x52, 0xd0, 0x52, 0x10, 0x53, 0xcd, 0x5a, 0x07, 0x5b,
+    0xcf, 0x5a, 0x10, 0x5b, 0x80, 0x5c, 0xf0, 0x5a, 0x0f, 0x5b, 0x51, 0x5b,
+    0x0e, 0x5b, 0x81, 0x5b, 0x11, 0x5b, 0x10, 0x63, 0x2c, 0x63, 0x72, 0x63,
+    0x20, 0x64, 0x31, 0x63, 0x51, 0x63, 0x4e, 0x63, 0x72, 0x63, 0x30, 0x63,
+    0x52, 0x63, 0x8a, 0x63, 0x92, 0x63, 0xe0, 0x64, 0x80, 0x6c, 0x91, 0x6b,
+    0x8f, 0x6b, 0x00, 0x6c, 0x72, 0x6b, 0xb3, 0x6b, 0x91, 0x6b, 0xf3, 0x6b,
+    0x71, 0x6b, 0xb2, 0x6b, 0xd3, 0x6b, 0x60, 0x6c, 0xb3, 0x73, 0xd1, 0x73,
+    0xd3, 0x73, 0xd0, 0x73, 0x92, 0x73, 0xf4, 0x73, 0x06, 0x74, 0x14, 0x74,
+    0x21, 0x75, 0xc0, 0x74, 0x0c, 0x74, 0x40, 0x75, 0xf3, 0x73, 0xd3, 0x7b,
+    0x54, 0x7c, 0x12, 0x7c, 0x14, 0x7c, 0xf4, 0x7b, 0x30, 0x7c, 0x65, 0x7c,
+    0xc0, 0x7c, 0x81, 0x7c, 0x34, 0x7c, 0x54, 0x7c, 0x40, 0x7d, 0x95, 0x84,
+    0x55, 0x84, 0x34, 0x84, 0x8b, 0x84, 0x23, 0x85, 0xa0, 0x85, 0x54, 0x84,
+    0x71, 0x84, 0x95, 0x84, 0x75, 0x84, 0x20, 0x85, 0x8f, 0x8c, 0xd6, 0x8c,
+    0x94, 0x8c, 0x95, 0x8c, 0xa0, 0x8d, 0xd6, 0x8c, 0xb6, 0x8c, 0xe0, 0x95,
+    0xd5, 0x94, 0xf3, 0x94, 0x21, 0x95, 0xb6, 0x94, 0x24, 0x95, 0x80, 0x95,
+    0xb5, 0x94, 0x17, 0x95, 0x33, 0x9d, 0x21, 0x9d, 0xa0, 0x9d, 0x20, 0x9e,
+    0xf7, 0x9c, 0xe1, 0x9d, 0x2b, 0x9d, 0x82, 0x9d, 0x51, 0x9d, 0x58, 0x9d,
+    0x4e, 0xa5, 0x82, 0xa5, 0x57, 0xa5, 0x20, 0xa6, 0x07, 0xa6, 0x63, 0xa5,
+    0x79, 0xa5, 0xe1, 0xa5, 0x96, 0xa5, 0x97, 0xad, 0x74, 0xad, 0x98, 0xad,
+    0xe4, 0xad, 0x60, 0xae, 0xaa, 0xad, 0x00, 0xae, 0xba, 0xad, 0xd4, 0xad,
+    0xb9, 0xb5, 0x60, 0xb6, 0xb8, 0xb5, 0xd8, 0xb5, 0xc3, 0xb5, 0x08, 0xb6,
+    0x44, 0xb6, 0x42, 0xb6, 0x0e, 0xb6, 0x46, 0xb6, 0x60, 0xb6, 0xa2, 0xb6,
+    0x32, 0xbe, 0x1b, 0xbe, 0xc0, 0xbe, 0xa3, 0xc6, 0xa0, 0xc6, 0xa6, 0xc6,
+    0x7c, 0xc6, 0xa8, 0xc6, 0xa4, 0xc6, 0xe2, 0xce, 0xce, 0xce, 0x00, 0xcf,
+    0xea, 0xce, 0xec, 0xd6, 0xf1, 0xd6, 0x06, 0xd7, 0x08, 0xd7, 0x09, 0xd7,
+    0x42, 0xdf, 0x45, 0xdf, 0x60, 0xdf, 0x55, 0xdf, 0x67, 0xe7, 0x6a, 0xe7,
+    0x6b, 0xe7, 0x6d, 0xe7, 0x6e, 0xe7, 0x91, 0xe7, 0x73, 0xe7, 0x8f, 0xe7,
+    0x0a, 0x6e, 0x91, 0x9f, 0xa7, 0xb4, 0xa6, 0xa6, 0x9f, 0x9b, 0x9b, 0x95,
+    0x81, 0x91, 0x85, 0x87, 0x01, 0x80, 0x80, 0x8e, 0x87, 0x00, 0x80, 0x84,
+    0x87, 0x81, 0x91, 0x02, 0x8a, 0x91, 0x87, 0x81, 0x8c, 0x04, 0x91, 0x95,
+    0x95, 0x8c, 0x93, 0x81, 0x9b, 0x80, 0x9e, 0x01, 0xa7, 0xac, 0x80, 0xaa,
+    0x00, 0xb4, 0x80, 0xb8, 0x00, 0xc2, 0x80, 0xce, 0x0b, 0xc5, 0xb8, 0xb4,
+    0x95, 0x71, 0x43, 0x2c, 0x17, 0x02, 0x06, 0x01, 0x01, 0x80, 0x06, 0x81,
+    0x0f, 0x03, 0x10, 0x10, 0x17, 0x17, 0x80, 0x15, 0x84, 0x1f, 0x00, 0x21,
+    0x80, 0x27, 0x0e, 0x2c, 0x2a, 0x2f, 0x33, 0x37, 0x35, 0x41, 0x41, 0x3b,
+    0x42, 0x49, 0x49, 0x43, 0x49, 0x43, 0x80, 0x41, 0x05, 0x37, 0x37, 0x2f,
+    0x31, 0x2c, 0x27, 0x81, 0x1f, 0x09, 0x21, 0x2c, 0x37, 0x43, 0x59, 0x68,
+    0x87, 0x9b, 0xa6, 0xae, 0x80, 0xc5, 0x01, 0xce, 0xce, 0x81, 0xd5, 0x80,
+    0xce, 0x81, 0xc5, 0x82, 0xb8, 0x85, 0xaa, 0x02, 0xaf, 0xaf, 0xa7, 0x8c,
+    0x9e, 0x81, 0x9f, 0x81, 0x93, 0x81, 0x9b, 0x81, 0x93, 0x02, 0x9b, 0x93,
+    0x9b, 0x82, 0x95, 0x03, 0x8a, 0x95, 0x95, 0x8a, 0x80, 0x95, 0x02, 0x8c,
+    0x95, 0x95, 0x81, 0x91, 0x09, 0x8a, 0x91, 0x91, 0x8a, 0x91, 0x8a, 0x8a,
+    0x87, 0x87, 0x83, 0x80, 0x87, 0x80, 0x83, 0x02, 0x8a, 0x87, 0x87, 0x83,
+    0x83, 0x07, 0x80, 0x83, 0x85, 0x85, 0x83, 0x80, 0x87, 0x80, 0x82, 0x8a,
+    0x12, 0x91, 0x95, 0x95, 0x93, 0x9e, 0x9e, 0xa7, 0xa7, 0x9b, 0x83, 0x70,
+    0x58, 0x3b, 0x2a, 0x21, 0x1d, 0x1a, 0x21, 0x21, 0x81, 0x25, 0x80, 0x2b,
+    0x80, 0x30, 0x11, 0x3d, 0x3d, 0x2b, 0x25, 0x25, 0x27, 0x2f, 0x87, 0x9b,
+    0xac, 0xa6, 0xac, 0x9f, 0x9b, 0x9b, 0x95, 0x91, 0x91, 0x84, 0x87, 0x00,
+    0x83, 0x82, 0x87, 0x00, 0x83, 0x80, 0x87, 0x01, 0x83, 0x83, 0x95, 0x87,
+    0x03, 0x91, 0x87, 0x87, 0x8a, 0x83, 0x8c, 0x80, 0x95, 0x80, 0x9b, 0x05,
+    0x93, 0x9e, 0x9e, 0xa7, 0xa6, 0xa6, 0x81, 0xaa, 0x80, 0xb8, 0x0d, 0xc5,
+    0xce, 0xc9, 0xce, 0xc5, 0xbd, 0xac, 0x91, 0x64, 0x47, 0x27, 0x17, 0x06,
+    0x06, 0x80, 0x01, 0x80, 0x06, 0x82, 0x0f, 0x80, 0x10, 0x85, 0x17, 0x02,
+    0x15, 0x17, 0x15, 0x82, 0x1f, 0x09, 0x21, 0x27, 0x27, 0x2c, 0x2e, 0x2a,
+    0x2c, 0x2f, 0x2f, 0x2a, 0x80, 0x2c, 0x01, 0x27, 0x27, 0x80, 0x1f, 0x80,
+    0x17, 0x0e, 0x15, 0x1f, 0x21, 0x31, 0x41, 0x4d, 0x64, 0x80, 0x95, 0xa6,
+    0xb4, 0xb8, 0xc5, 0xce, 0xce, 0x80, 0xd5, 0x81, 0xce, 0x81, 0xc5, 0x00,
+    0xc2, 0x81, 0xb8, 0x81, 0xaa, 0x80, 0xb4, 0x00, 0xae, 0x82, 0x9e, 0x00,
+    0xa7, 0x89, 0x9e, 0x06, 0x93, 0x93, 0x9e, 0x9f, 0x93, 0x9b, 0x9f, 0x85,
+    0x9b, 0x81, 0x93, 0x87, 0x95, 0x00, 0x8a, 0x81, 0x8c, 0x04, 0x8a, 0x8c,
+    0x8a, 0x8a, 0x91, 0x81, 0x8a, 0x00, 0x91, 0x80, 0x8a, 0x80, 0x83, 0x01,
+    0x87, 0x80, 0x80, 0x83, 0x00, 0x87, 0x89, 0x83, 0x00, 0x7e, 0x89, 0x83,
+    0x0e, 0x8a, 0x8a, 0x8c, 0x9b, 0x9f, 0xa7, 0x93, 0x8a, 0x7e, 0x6b, 0x4e,
+    0x42, 0x2e, 0x21, 0x21, 0x81, 0x25, 0x81, 0x2b, 0x83, 0x30, 0x00, 0x2e,
+    0x80, 0x25, 0x08, 0x2f, 0x91, 0x9f, 0xa7, 0xa6, 0x9f, 0x95, 0x95, 0x91,
+    0x80, 0x87, 0x80, 0x82, 0x05, 0x7e, 0x7e, 0x82, 0x82, 0x7e, 0x7e, 0x80,
+    0x82, 0x00, 0x83, 0x83, 0x82, 0x85, 0x87, 0x00, 0x80, 0x8c, 0x87, 0x00,
+    0x83, 0x81, 0x87, 0x80, 0x8c, 0x0e, 0x91, 0x8c, 0x91, 0x95, 0x8c, 0x93,
+    0x93, 0x9b, 0x9b, 0x9f, 0x9c, 0xa6, 0xa6, 0xa7, 0xa6, 0x81, 0xaa, 0x03,
+    0xb8, 0xb8, 0xc2, 0xc5, 0x80, 0xce, 0x0c, 0xc5, 0xbd, 0xa6, 0x91, 0x64,
+    0x3b, 0x27, 0x10, 0x02, 0x01, 0x01, 0x00, 0x01, 0x80, 0x06, 0x01, 0x02,
+    0x06, 0x8c, 0x0f, 0x83, 0x10, 0x81, 0x17, 0x01, 0x1d, 0x1d, 0x80, 0x1f,
+    0x01, 0x1d, 0x1f, 0x82, 0x17, 0x11, 0x10, 0x14, 0x10, 0x10, 0x17, 0x1f,
+    0x27, 0x2f, 0x43, 0x64, 0x7a, 0x9c, 0xa6, 0xae, 0xb8, 0xc5, 0xce, 0xce,
+    0x80, 0xd5, 0x80, 0xce, 0x81, 0xc5, 0x00, 0xc2, 0x82, 0xb8, 0x80, 0xaa,
+    0x05, 0xb4, 0xae, 0xae, 0xb4, 0xae, 0xac, 0x81, 0x9e, 0x03, 0xa7, 0x9e,
+    0x9e, 0xa7, 0x88, 0x9e, 0x80, 0x93, 0x87, 0x9b, 0x04, 0x93, 0x95, 0x95,
+    0x93, 0x93, 0x88, 0x95, 0x03, 0x8a, 0x91, 0x8c, 0x8c, 0x86, 0x8a, 0x06,
+    0x80, 0x8a, 0x91, 0x8a, 0x83, 0x83, 0x87, 0x86, 0x83, 0x87, 0x7e, 0x00,
+    0x85, 0x8a, 0x7e, 0x03, 0x83, 0x83, 0x8a, 0x8a, 0x80, 0x9b, 0x0e, 0x83,
+    0x73, 0x5f, 0x44, 0x35, 0x2a, 0x25, 0x25, 0x2b, 0x2b, 0x2e, 0x2b, 0x2b,
+    0x30, 0x30, 0x82, 0x3d, 0x0d, 0x30, 0x2b, 0x25, 0x25, 0x27, 0x2f, 0x95,
+    0x9f, 0xa7, 0x9b, 0x95, 0x91, 0x87, 0x87, 0x82, 0x82, 0x04, 0x7a, 0x77,
+    0x77, 0x7a, 0x82, 0x82, 0x7e, 0x85, 0x82, 0x04, 0x87, 0x82, 0x83, 0x87,
+    0x82, 0x82, 0x87, 0x00, 0x80, 0x81, 0x87, 0x01, 0x80, 0x80, 0x88, 0x87,
+    0x80, 0x91, 0x06, 0x8c, 0x8c, 0x91, 0x91, 0x8c, 0x8c, 0x95, 0x80, 0x9b,
+    0x00, 0x9f, 0x83, 0x9e, 0x06, 0xae, 0xae, 0xb4, 0xb8, 0xb8, 0xc2, 0xc2,
+    0x80, 0xce, 0x0e, 0xc5, 0xb8, 0xa6, 0x80, 0x64, 0x35, 0x27, 0x10, 0x02,
+    0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x80, 0x02, 0x01, 0x06, 0x06, 0x83,
+    0x0f, 0x00, 0x05, 0x8d, 0x0f, 0x07, 0x10, 0x14, 0x14, 0x10, 0x14, 0x0f,
+    0x0f, 0x05, 0x80, 0x0f, 0x0f, 0x05, 0x0f, 0x07, 0x10, 0x15, 0x27, 0x35,
+    0x4d, 0x71, 0x80, 0x9c, 0xae, 0xc5, 0xc5, 0xce, 0xce, 0x80, 0xd5, 0x01,
+    0xce, 0xce, 0x82, 0xc5, 0x82, 0xb8, 0x84, 0xaa, 0x8c, 0x9e, 0x01, 0x9f,
+    0x9e, 0x81, 0x93, 0x80, 0x9f, 0x80, 0x93, 0x81, 0x9b, 0x01, 0x93, 0x9b,
+    0x83, 0x93, 0x00, 0x8c, 0x80, 0x95, 0x09, 0x8c, 0x95, 0x95, 0x8c, 0x95,
+    0x95, 0x8c, 0x91, 0x8c, 0x8c, 0x80, 0x8a, 0x02, 0x8c, 0x8a, 0x91, 0x80,
+    0x8a, 0x00, 0x87, 0x80, 0x83, 0x00, 0x87, 0x86, 0x83, 0x01, 0x7e, 0x83,
+    0x83, 0x7e, 0x06, 0x7d, 0x77, 0x7d, 0x7e, 0x77, 0x7e, 0x7e, 0x82, 0x77,
+    0x00, 0x7d, 0x81, 0x77, 0x00, 0x73, 0x82, 0x77, 0x0d, 0x7e, 0x7e, 0x83,
+    0x8a, 0x8a, 0x95, 0x8a, 0x7d, 0x6b, 0x51, 0x42, 0x30, 0x2a, 0x25, 0x80,
+    0x2b, 0x80, 0x30, 0x80, 0x3d, 0x15, 0x35, 0x3d, 0x3d, 0x30, 0x2b, 0x21,
+    0x21, 0x27, 0x2f, 0x95, 0x93, 0x9b, 0x91, 0x87, 0x82, 0x7e, 0x82, 0x7a,
+    0x77, 0x7a, 0x73, 0x7a, 0x81, 0x6e, 0x82, 0x77, 0x02, 0x7a, 0x82, 0x82,
+    0x80, 0x7e, 0x02, 0x82, 0x82, 0x80, 0x86, 0x82, 0x06, 0x83, 0x87, 0x82,
+    0x83, 0x87, 0x83, 0x83, 0x80, 0x87, 0x00, 0x83, 0x80, 0x87, 0x04, 0x83,
+    0x83, 0x87, 0x80, 0x87, 0x80, 0x80, 0x80, 0x8c, 0x04, 0x91, 0x91, 0x8c,
+    0x93, 0x95, 0x81, 0x9b, 0x05, 0x9f, 0x9e, 0x9e, 0xac, 0xa7, 0xa6, 0x80,
+    0xaa, 0x03, 0xb8, 0xb8, 0xc2, 0xc2, 0x80, 0xce, 0x08, 0xc5, 0xb8, 0xa6,
+    0x80, 0x59, 0x37, 0x21, 0x10, 0x06, 0x85, 0x01, 0x01, 0x02, 0x02, 0x88,
+    0x06, 0x00, 0x02, 0x80, 0x06, 0x03, 0x02, 0x04, 0x02, 0x02, 0x8d, 0x06,
+    0x0e, 0x0f, 0x10, 0x1f, 0x2c, 0x3b, 0x59, 0x7a, 0x93, 0xa6, 0xb1, 0xc5,
+    0xce, 0xce, 0xd5, 0xd5, 0x80, 0xce, 0x80, 0xc5, 0x00, 0xc2, 0x82, 0xb8,
+    0x84, 0xaa, 0x86, 0x9e, 0x09, 0xa7, 0x9f, 0x9e, 0x9f, 0x93, 0x9f, 0x9f,
+    0x93, 0x9f, 0x9f, 0x82, 0x93, 0x00, 0x9b, 0x82, 0x93, 0x80, 0x9b, 0x84,
+    0x93, 0x80, 0x8c, 0x03, 0x95, 0x95, 0x91, 0x95, 0x83, 0x8c, 0x02, 0x91,
+    0x8c, 0x8c, 0x84, 0x8a, 0x01, 0x83, 0x87, 0x81, 0x83, 0x06, 0x87, 0x83,
+    0x87, 0x83, 0x83, 0x7e, 0x83, 0x84, 0x7e, 0x0a, 0x77, 0x77, 0x7e, 0x77,
+    0x73, 0x77, 0x77, 0x73, 0x73, 0x77, 0x77, 0x8a, 0x6e, 0x00, 0x75, 0x82,
+    0x6e, 0x08, 0x7e, 0x83, 0x83, 0x8a, 0x7e, 0x70, 0x5f, 0x43, 0x2f, 0x80,
+    0x2b, 0x04, 0x30, 0x30, 0x3d, 0x30, 0x35, 0x81, 0x3d, 0x0c, 0x3e, 0x3d,
+    0x30, 0x25, 0x21, 0x21, 0x27, 0x2f, 0x95, 0x95, 0x91, 0x87, 0x89, 0x80,
+    0x7a, 0x07, 0x73, 0x7a, 0x73, 0x73, 0x75, 0x81, 0x71, 0x6e, 0x81, 0x7a,
+    0x00, 0x73, 0x81, 0x7a, 0x01, 0x77, 0x77, 0x89, 0x82, 0x00, 0x85, 0x84,
+    0x83, 0x04, 0x82, 0x87, 0x87, 0x83, 0x83, 0x84, 0x87, 0x03, 0x80, 0x91,
+    0x91, 0x87, 0x82, 0x91, 0x81, 0x95, 0x80, 0x93, 0x04, 0x9e, 0xa7, 0xa7,
+    0xac, 0xa6, 0x81, 0xaa, 0x03, 0xbd, 0xb8, 0xc2, 0xc5, 0x80, 0xce, 0x0b,
+    0xc5, 0xb8, 0xa6, 0x82, 0x59, 0x37, 0x21, 0x07, 0x02, 0x03, 0x00, 0x03,
+    0x83, 0x01, 0x02, 0x06, 0x01, 0x06, 0x81, 0x02, 0x80, 0x06, 0x06, 0x04,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00,
+    0x00, 0x01, 0x81, 0x02, 0x1c, 0x04, 0x01, 0x01, 0x02, 0x02, 0x0f, 0x10,
+    0x1f, 0x2a, 0x43, 0x64, 0x80, 0x9c, 0xae, 0xc5, 0xc5, 0xce, 0xce, 0xd5,
+    0xd5, 0xce, 0xce, 0xc5, 0xc5, 0xc2, 0xb8, 0xc5, 0xb8, 0xbd, 0x81, 0xaa,
+    0x00, 0xb4, 0x80, 0xaa, 0x86, 0x9e, 0x06, 0xa7, 0x9e, 0x9e, 0x9f, 0x9f,
+    0x9b, 0x9b, 0x80, 0x93, 0x04, 0x9b, 0x93, 0x9b, 0x93, 0x9b, 0x84, 0x93,
+    0x00, 0x9b, 0x83, 0x93, 0x07, 0x95, 0x95, 0x93, 0x8c, 0x8a, 0x95, 0x8c,
+    0x8a, 0x81, 0x91, 0x08, 0x8a, 0x91, 0x8c, 0x91, 0x91, 0x8a, 0x8a, 0x8c,
+    0x91, 0x81, 0x8a, 0x09, 0x80, 0x8a, 0x87, 0x83, 0x87, 0x83, 0x87, 0x83,
+    0x83, 0x85, 0x80, 0x83, 0x84, 0x7e, 0x00, 0x7d, 0x80, 0x77, 0x84, 0x6e,
+    0x02, 0x7d, 0x75, 0x7d, 0x83, 0x6e, 0x05, 0x75, 0x75, 0x6e, 0x75, 0x6e,
+    0x6e, 0x82, 0x75, 0x00, 0x68, 0x80, 0x6e, 0x0b, 0x77, 0x7e, 0x7e, 0x70,
+    0x5f, 0x44, 0x35, 0x30, 0x2b, 0x2b, 0x30, 0x30, 0x80, 0x3d, 0x13, 0x3e,
+    0x3e, 0x3d, 0x3e, 0x3d, 0x3d, 0x30, 0x25, 0x21, 0x21, 0x27, 0x2a, 0x91,
+    0x92, 0x87, 0x89, 0x81, 0x81, 0x71, 0x6e, 0x80, 0x74, 0x13, 0x75, 0x74,
+    0x74, 0x71, 0x75, 0x74, 0x71, 0x6e, 0x75, 0x75, 0x81, 0x7a, 0x7d, 0x73,
+    0x73, 0x77, 0x7a, 0x77, 0x82, 0x77, 0x88, 0x82, 0x0b, 0x83, 0x82, 0x7e,
+    0x7e, 0x82, 0x82, 0x83, 0x83, 0x87, 0x82, 0x87, 0x82, 0x83, 0x87, 0x0c,
+    0x80, 0x87, 0x87, 0x91, 0x8c, 0x91, 0x8c, 0x91, 0x8c, 0x95, 0x95, 0x93,
+    0x93, 0x80, 0x9b, 0x04, 0x9f, 0xa7, 0xa7, 0xac, 0xa7, 0x81, 0xaa, 0x03,
+    0xb8, 0xb8, 0xc2, 0xc2, 0x80, 0xce, 0x09, 0xc5, 0xae, 0x93, 0x82, 0x4d,
+    0x2f, 0x1a, 0x0f, 0x06, 0x01, 0x81, 0x00, 0x00, 0x01, 0x80, 0x00, 0x05,
+    0x03, 0x01, 0x01, 0x00, 0x00, 0x01, 0x81, 0x00, 0x80, 0x01, 0x88, 0x00,
+    0x01, 0x01, 0x01, 0x81, 0x00, 0x0b, 0x01, 0x02, 0x06, 0x10, 0x1f, 0x2f,
+    0x43, 0x64, 0x80, 0xa6, 0xb8, 0xc5, 0x80, 0xce, 0x02, 0xd5, 0xce, 0xce,
+    0x80, 0xc5, 0x80, 0xb8, 0x84, 0xaa, 0x01, 0xb4, 0xaf, 0x83, 0x9e, 0x00,
+    0xa7, 0x80, 0x9e, 0x81, 0x9f, 0x83, 0x9b, 0x01, 0x93, 0x9b, 0x80, 0x93,
+    0x01, 0x9b, 0x9b, 0x88, 0x93, 0x05, 0x8c, 0x8c, 0x95, 0x95, 0x8c, 0x8a,
+    0x81, 0x95, 0x02, 0x91, 0x8a, 0x91, 0x85, 0x8a, 0x00, 0x80, 0x80, 0x87,
+    0x02, 0x83, 0x87, 0x87, 0x84, 0x83, 0x02, 0x7e, 0x7e, 0x83, 0x80, 0x7e,
+    0x02, 0x85, 0x7e, 0x85, 0x81, 0x77, 0x84, 0x6e, 0x82, 0x75, 0x06, 0x73,
+    0x73, 0x75, 0x6e, 0x75, 0x75, 0x6e, 0x80, 0x75, 0x01, 0x70, 0x68, 0x81,
+    0x70, 0x0d, 0x68, 0x70, 0x68, 0x68, 0x6b, 0x68, 0x75, 0x73, 0x73, 0x71,
+    0x58, 0x44, 0x42, 0x35, 0x80, 0x30, 0x01, 0x3d, 0x35, 0x84, 0x3b, 0x1d,
+    0x3d, 0x30, 0x27, 0x21, 0x21, 0x27, 0x2c, 0x87, 0x83, 0x7a, 0x7a, 0x71,
+    0x74, 0x68, 0x68, 0x70, 0x71, 0x68, 0x71, 0x68, 0x68, 0x71, 0x71, 0x68,
+    0x70, 0x6e, 0x6e, 0x75, 0x7a, 0x81, 0x83, 0x7a, 0x82, 0x77, 0x09, 0x82,
+    0x82, 0x7e, 0x7e, 0x82, 0x82, 0x7e, 0x82, 0x7e, 0x7e, 0x86, 0x82, 0x00,
+    0x80, 0x80, 0x83, 0x02, 0x87, 0x80, 0x80, 0x81, 0x87, 0x08, 0x80, 0x8c,
+    0x91, 0x8c, 0x8c, 0x95, 0x95, 0x8c, 0x95, 0x80, 0x9b, 0x00, 0x9f, 0x80,
+    0x9e, 0x09, 0xa7, 0xa6, 0xaf, 0xae, 0xae, 0xb4, 0xb8, 0xb8, 0xc2, 0xc5,
+    0x80, 0xce, 0x09, 0xc2, 0xae, 0x9f, 0x7a, 0x4d, 0x2f, 0x15, 0x0f, 0x06,
+    0x01, 0x82, 0x00, 0x02, 0x01, 0x00, 0x00, 0x80, 0x01, 0x80, 0x00, 0x07,
+    0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x83, 0x00, 0x80, 0x01,
+    0x01, 0x00, 0x03, 0x80, 0x00, 0x0b, 0x03, 0x01, 0x06, 0x10, 0x1f, 0x2f,
+    0x4d, 0x71, 0x91, 0xa6, 0xb8, 0xc5, 0x82, 0xce, 0x80, 0xc5, 0x80, 0xb8,
+    0x84, 0xaa, 0x88, 0x9e, 0x02, 0xa7, 0x9e, 0x9e, 0x80, 0x9f, 0x82, 0x93,
+    0x01, 0x9b, 0x9b, 0x82, 0x93, 0x05, 0x9b, 0x9b, 0x95, 0x93, 0x93, 0x9b,
+    0x81, 0x93, 0x07, 0x95, 0x95, 0x93, 0x95, 0x8c, 0x8c, 0x95, 0x8c, 0x82,
+    0x95, 0x05, 0x91, 0x8a, 0x91, 0x8a, 0x8a, 0x8c, 0x80, 0x8a, 0x03, 0x80,
+    0x8a, 0x87, 0x87, 0x86, 0x83, 0x01, 0x7e, 0x83, 0x82, 0x7e, 0x01, 0x82,
+    0x7e, 0x82, 0x77, 0x84, 0x6e, 0x02, 0x75, 0x6e, 0x6e, 0x81, 0x75, 0x80,
+    0x6e, 0x83, 0x75, 0x01, 0x70, 0x68, 0x81, 0x70, 0x81, 0x6b, 0x0c, 0x66,
+    0x66, 0x60, 0x66, 0x6b, 0x68, 0x66, 0x51, 0x42, 0x35, 0x2f, 0x2e, 0x30,
+    0x80, 0x3d, 0x00, 0x3e, 0x82, 0x49, 0x11, 0x3e, 0x35, 0x2b, 0x25, 0x1a,
+    0x1d, 0x1f, 0x27, 0x92, 0x7d, 0x7a, 0x75, 0x74, 0x74, 0x70, 0x68, 0x74,
+    0x6b, 0x81, 0x68, 0x02, 0x71, 0x71, 0x74, 0x80, 0x70, 0x0a, 0x6e, 0x75,
+    0x75, 0x71, 0x7a, 0x7a, 0x73, 0x73, 0x7a, 0x7a, 0x7d, 0x80, 0x77, 0x05,
+    0x7a, 0x77, 0x82, 0x7e, 0x82, 0x82, 0x82, 0x7e, 0x86, 0x82, 0x01, 0x83,
+    0x83, 0x87, 0x87, 0x03, 0x8c, 0x8c, 0x91, 0x91, 0x81, 0x95, 0x80, 0x9b,
+    0x05, 0x9f, 0x9f, 0xa7, 0xac, 0xa6, 0xa6, 0x80, 0xaa, 0x80, 0xb8, 0x01,
+    0xc2, 0xc2, 0x80, 0xce, 0x0a, 0xc2, 0xae, 0x9b, 0x7a, 0x4d, 0x2a, 0x15,
+    0x05, 0x06, 0x03, 0x01, 0x81, 0x00, 0x0b, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x1a, 0x01, 0x03,
+    0x00, 0x01, 0x01, 0x03, 0x01, 0x03, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01,
+    0x03, 0x06, 0x06, 0x10, 0x21, 0x37, 0x4d, 0x71, 0x8c, 0xac, 0xb8, 0xc5,
+    0xc5, 0x80, 0xce, 0x80, 0xc5, 0x80, 0xb8, 0x81, 0xaa, 0x04, 0xb4, 0xae,
+    0xa6, 0xa6, 0xa7, 0x86, 0x9e, 0x80, 0x9f, 0x03, 0x9e, 0x9f, 0x93, 0x9b,
+    0x82, 0x93, 0x05, 0x9b, 0x9b, 0x93, 0x93, 0x95, 0x93, 0x83, 0x95, 0x01,
+    0x93, 0x95, 0x84, 0x93, 0x09, 0x8c, 0x95, 0x8a, 0x95, 0x8c, 0x95, 0x95,
+    0x8a, 0x8a, 0x91, 0x86, 0x8a, 0x00, 0x87, 0x88, 0x83, 0x02, 0x7e, 0x85,
+    0x85, 0x82, 0x7e, 0x08, 0x77, 0x7d, 0x73, 0x73, 0x7d, 0x73, 0x73, 0x75,
+    0x75, 0x80, 0x6e, 0x88, 0x75, 0x00, 0x6e, 0x81, 0x75, 0x03, 0x68, 0x68,
+    0x70, 0x68, 0x80, 0x70, 0x05, 0x6b, 0x68, 0x6b, 0x6b, 0x66, 0x66, 0x82,
+    0x5f, 0x08, 0x51, 0x44, 0x35, 0x30, 0x2e, 0x2a, 0x2e, 0x30, 0x3d, 0x84,
+    0x49, 0x11, 0x3e, 0x3d, 0x2b, 0x25, 0x1d, 0x15, 0x1f, 0x27, 0x89, 0x81,
+    0x75, 0x74, 0x64, 0x6c, 0x6b, 0x6b, 0x6c, 0x6c, 0x81, 0x6b, 0x03, 0x6c,
+    0x64, 0x6b, 0x6b, 0x80, 0x70, 0x12, 0x75, 0x75, 0x6e, 0x71, 0x73, 0x73,
+    0x81, 0x7d, 0x7d, 0x7a, 0x7a, 0x7d, 0x73, 0x73, 0x77, 0x7a, 0x7e, 0x82,
+    0x82, 0x81, 0x7e, 0x85, 0x82, 0x01, 0x7e, 0x82, 0x86, 0x87, 0x0f, 0x80,
+    0x87, 0x87, 0x91, 0x8c, 0x91, 0x91, 0x95, 0x95, 0x8c, 0x8c, 0x93, 0x93,
+    0x9b, 0x93, 0x9f, 0x81, 0x9e, 0x00, 0xac, 0x80, 0xaa, 0x80, 0xb8, 0x01,
+    0xc2, 0xc5, 0x80, 0xce, 0x09, 0xc2, 0xae, 0x9b, 0x71, 0x43, 0x2a, 0x15,
+    0x06, 0x06, 0x03, 0x90, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x01, 0x01,
+    0x83, 0x00, 0x0d, 0x01, 0x01, 0x02, 0x10, 0x21, 0x37, 0x50, 0x71, 0x9c,
+    0xa6, 0xb8, 0xc5, 0xc5, 0xce, 0x81, 0xc5, 0x02, 0xb8, 0xb8, 0xbd, 0x83,
+    0xaa, 0x02, 0xac, 0xac, 0xa6, 0x81, 0xa7, 0x81, 0x9e, 0x00, 0x9f, 0x80,
+    0x9e, 0x03, 0x9f, 0x9f, 0x93, 0x9f, 0x80, 0x9b, 0x05, 0x93, 0x93, 0x9b,
+    0x9b, 0x93, 0x93, 0x80, 0x95, 0x00, 0x93, 0x82, 0x95, 0x01, 0x93, 0x93,
+    0x80, 0x95, 0x03, 0x93, 0x8c, 0x93, 0x8a, 0x82, 0x95, 0x07, 0x8c, 0x95,
+    0x95, 0x91, 0x95, 0x8a, 0x8a, 0x91, 0x80, 0x8a, 0x04, 0x91, 0x8a, 0x8a,
+    0x83, 0x87, 0x81, 0x83, 0x00, 0x80, 0x80, 0x83, 0x83, 0x7e, 0x81, 0x77,
+    0x02, 0x73, 0x73, 0x7d, 0x80, 0x6e, 0x82, 0x75, 0x80, 0x6e, 0x82, 0x75,
+    0x00, 0x70, 0x80, 0x75, 0x12, 0x6e, 0x75, 0x75, 0x6e, 0x6e, 0x75, 0x75,
+    0x6e, 0x6e, 0x68, 0x75, 0x70, 0x70, 0x68, 0x68, 0x60, 0x66, 0x66, 0x5f,
+    0x80, 0x58, 0x0a, 0x51, 0x4e, 0x44, 0x35, 0x30, 0x2b, 0x2e, 0x25, 0x2e,
+    0x30, 0x3d, 0x82, 0x49, 0x0e, 0x44, 0x4c, 0x4c, 0x3d, 0x2e, 0x21, 0x1f,
+    0x17, 0x17, 0x1f, 0x81, 0x75, 0x74, 0x64, 0x6b, 0x80, 0x66, 0x00, 0x6c,
+    0x80, 0x66, 0x06, 0x60, 0x6b, 0x6c, 0x6b, 0x6b, 0x68, 0x6b, 0x81, 0x70,
+    0x0e, 0x6e, 0x75, 0x75, 0x6e, 0x75, 0x75, 0x7d, 0x73, 0x7a, 0x73, 0x7d,
+    0x73, 0x7a, 0x7d, 0x7d, 0x83, 0x7e, 0x80, 0x82, 0x00, 0x7e, 0x82, 0x82,
+    0x00, 0x7e, 0x82, 0x87, 0x00, 0x80, 0x84, 0x87, 0x00, 0x80, 0x81, 0x91,
+    0x80, 0x95, 0x81, 0x9b, 0x80, 0x9e, 0x02, 0xa7, 0xa7, 0xaf, 0x80, 0xaa,
+    0x03, 0xb8, 0xb8, 0xc2, 0xc5, 0x81, 0xce, 0x09, 0xc2, 0xae, 0x95, 0x71,
+    0x43, 0x2c, 0x10, 0x02, 0x01, 0x03, 0x88, 0x00, 0x03, 0x01, 0x01, 0x00,
+    0x00, 0x80, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x0a, 0x03, 0x01,
+    0x02, 0x10, 0x1f, 0x37, 0x4d, 0x7a, 0x9c, 0xac, 0xb8, 0x83, 0xc5, 0x80,
+    0xb8, 0x81, 0xaa, 0x08, 0xb4, 0xae, 0xa7, 0xac, 0xa7, 0xa7, 0x9e, 0xa7,
+    0xa7, 0x80, 0x9e, 0x81, 0x9f, 0x05, 0x9e, 0x93, 0x93, 0x9f, 0x9f, 0x93,
+    0x80, 0x9b, 0x06, 0x93, 0x9b, 0x93, 0x9b, 0x95, 0x95, 0x93, 0x80, 0x95,
+    0x03, 0x8c, 0x8c, 0x95, 0x95, 0x80, 0x8c, 0x02, 0x95, 0x93, 0x93, 0x80,
+    0x95, 0x04, 0x8a, 0x8c, 0x95, 0x8c, 0x8c, 0x80, 0x95, 0x80, 0x8c, 0x0a,
+    0x95, 0x91, 0x8a, 0x8a, 0x8c, 0x91, 0x91, 0x8a, 0x83, 0x8a, 0x87, 0x85,
+    0x83, 0x83, 0x7e, 0x01, 0x77, 0x77, 0x84, 0x6e, 0x06, 0x75, 0x73, 0x75,
+    0x6e, 0x75, 0x6e, 0x75, 0x80, 0x68, 0x10, 0x75, 0x70, 0x75, 0x70, 0x70,
+    0x68, 0x68, 0x75, 0x6e, 0x6e, 0x75, 0x75, 0x6e, 0x75, 0x75, 0x6e, 0x6e,
+    0x82, 0x75, 0x13, 0x68, 0x68, 0x6b, 0x66, 0x5f, 0x58, 0x58, 0x4e, 0x48,
+    0x4c, 0x3e, 0x3d, 0x30, 0x2b, 0x25, 0x25, 0x27, 0x2e, 0x3d, 0x3d, 0x85,
+    0x49, 0x0e, 0x3d, 0x2e, 0x21, 0x1d, 0x1d, 0x17, 0x17, 0x68, 0x71, 0x6c,
+    0x64, 0x6c, 0x66, 0x66, 0x60, 0x81, 0x66, 0x03, 0x64, 0x60, 0x60, 0x66,
+    0x80, 0x6b, 0x03, 0x68, 0x74, 0x70, 0x70, 0x86, 0x75, 0x06, 0x73, 0x73,
+    0x7a, 0x73, 0x73, 0x77, 0x77, 0x80, 0x7e, 0x0e, 0x82, 0x7e, 0x82, 0x7e,
+    0x7e, 0x82, 0x82, 0x7e, 0x82, 0x82, 0x7e, 0x7e, 0x82, 0x82, 0x83, 0x82,
+    0x87, 0x00, 0x80, 0x83, 0x87, 0x03, 0x91, 0x8c, 0x91, 0x91, 0x80, 0x95,
+    0x08, 0x9b, 0x93, 0x93, 0x9f, 0x9e, 0x9e, 0xa7, 0xa7, 0xa6, 0x80, 0xaa,
+    0x04, 0xb4, 0xbd, 0xb8, 0xbd, 0xc2, 0x81, 0xce, 0x09, 0xc2, 0xae, 0x93,
+    0x71, 0x3b, 0x27, 0x10, 0x02, 0x01, 0x03, 0x88, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x07, 0x03, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x82, 0x00,
+    0x11, 0x01, 0x03, 0x02, 0x05, 0x1f, 0x37, 0x59, 0x7a, 0xa4, 0xae, 0xb1,
+    0xc5, 0xc5, 0xc2, 0xc5, 0xbd, 0xb8, 0xb8, 0x81, 0xaa, 0x06, 0xb4, 0xae,
+    0xa6, 0xa7, 0xa6, 0xa6, 0xa7, 0x82, 0x9e, 0x0a, 0x9f, 0x9f, 0x93, 0x9b,
+    0x9b, 0x9f, 0x9b, 0x93, 0x93, 0x9b, 0x93, 0x80, 0x9b, 0x11, 0x93, 0x93,
+    0x9b, 0x9b, 0x93, 0x93, 0x95, 0x95, 0x8c, 0x95, 0x95, 0x8c, 0x95, 0x8c,
+    0x8c, 0x95, 0x95, 0x8c, 0x80, 0x95, 0x83, 0x8c, 0x02, 0x95, 0x8a, 0x8c,
+    0x81, 0x95, 0x04, 0x8a, 0x91, 0x8a, 0x91, 0x91, 0x81, 0x8a, 0x00, 0x96,
+    0x84, 0x83, 0x86, 0x7e, 0x04, 0x77, 0x77, 0x73, 0x73, 0x7d, 0x80, 0x75,
+    0x00, 0x6e, 0x83, 0x75, 0x0e, 0x6e, 0x70, 0x75, 0x70, 0x68, 0x70, 0x68,
+    0x68, 0x70, 0x70, 0x68, 0x70, 0x75, 0x6e, 0x6e, 0x80, 0x75, 0x83, 0x6e,
+    0x0a, 0x7d, 0x7d, 0x75, 0x75, 0x70, 0x6b, 0x60, 0x5f, 0x58, 0x4e, 0x44,
+    0x80, 0x3b, 0x01, 0x2b, 0x25, 0x80, 0x1a, 0x03, 0x21, 0x25, 0x30, 0x3e,
+    0x85, 0x49, 0x0c, 0x3d, 0x2e, 0x21, 0x1d, 0x10, 0x0f, 0x17, 0x6c, 0x6b,
+    0x64, 0x66, 0x64, 0x56, 0x81, 0x5f, 0x01, 0x66, 0x5f, 0x82, 0x66, 0x81,
+    0x6b, 0x80, 0x70, 0x82, 0x75, 0x00, 0x6e, 0x80, 0x75, 0x80, 0x6e, 0x04,
+    0x7a, 0x7a, 0x77, 0x7e, 0x7e, 0x80, 0x82, 0x03, 0x7e, 0x7e, 0x82, 0x82,
+    0x83, 0x7e, 0x02, 0x80, 0x82, 0x82, 0x80, 0x87, 0x01, 0x83, 0x83, 0x84,
+    0x87, 0x80, 0x91, 0x80, 0x8c, 0x06, 0x95, 0x9b, 0x93, 0x93, 0x9b, 0x9f,
+    0x9f, 0x81, 0x9e, 0x07, 0xaf, 0xae, 0xb4, 0xbd, 0xb8, 0xb8, 0xc2, 0xc2,
+    0x81, 0xce, 0x07, 0xc2, 0xae, 0x91, 0x64, 0x3b, 0x27, 0x10, 0x02, 0x80,
+    0x01, 0x86, 0x00, 0x00, 0x01, 0x84, 0x00, 0x80, 0x01, 0x83, 0x00, 0x09,
+    0x03, 0x06, 0x0f, 0x1f, 0x2f, 0x4d, 0x7a, 0x9b, 0xb4, 0xb8, 0x81, 0xc5,
+    0x00, 0xb8, 0x81, 0xb4, 0x03, 0xae, 0xae, 0xac, 0xaa, 0x87, 0x9e, 0x80,
+    0x93, 0x84, 0x9b, 0x03, 0x93, 0x9b, 0x93, 0x9b, 0x86, 0x93, 0x80, 0x8c,
+    0x03, 0x95, 0x95, 0x8c, 0x8c, 0x80, 0x95, 0x0b, 0x8a, 0x95, 0x8c, 0x95,
+    0x8c, 0x95, 0x8c, 0x8c, 0x95, 0x95, 0x8a, 0x8c, 0x80, 0x95, 0x00, 0x91,
+    0x83, 0x8a, 0x01, 0x91, 0x80, 0x80, 0x87, 0x83, 0x83, 0x84, 0x7e, 0x02,
+    0x82, 0x7e, 0x77, 0x80, 0x6e, 0x85, 0x75, 0x01, 0x6e, 0x75, 0x84, 0x70,
+    0x80, 0x68, 0x02, 0x70, 0x75, 0x75, 0x80, 0x6e, 0x01, 0x75, 0x75, 0x80,
+    0x6e, 0x01, 0x77, 0x77, 0x80, 0x7e, 0x15, 0x85, 0x7e, 0x73, 0x75, 0x6b,
+    0x66, 0x5f, 0x51, 0x44, 0x3e, 0x3d, 0x30, 0x1b, 0x1b, 0x16, 0x16, 0x0d,
+    0x15, 0x1a, 0x25, 0x2b, 0x3d, 0x84, 0x49, 0x09, 0x3e, 0x35, 0x2b, 0x25,
+    0x1a, 0x10, 0x0f, 0x05, 0x6c, 0x59, 0x88, 0x5f, 0x03, 0x56, 0x66, 0x60,
+    0x66, 0x81, 0x6b, 0x81, 0x70, 0x13, 0x68, 0x6e, 0x75, 0x6e, 0x73, 0x75,
+    0x75, 0x73, 0x7a, 0x73, 0x73, 0x7a, 0x7a, 0x77, 0x7a, 0x7e, 0x7e, 0x82,
+    0x77, 0x7d, 0x81, 0x82, 0x06, 0x7e, 0x7e, 0x82, 0x80, 0x7e, 0x7e, 0x82,
+    0x81, 0x87, 0x02, 0x83, 0x87, 0x83, 0x82, 0x87, 0x82, 0x91, 0x07, 0x95,
+    0x95, 0x93, 0x95, 0x9b, 0x93, 0x93, 0x9b, 0x82, 0x9e, 0x00, 0xac, 0x80,
+    0xaa, 0x18, 0xbd, 0xb8, 0xb8, 0xc2, 0xc5, 0xce, 0xd5, 0xce, 0xc9, 0xb8,
+    0xac, 0x91, 0x64, 0x3b, 0x21, 0x10, 0x02, 0x06, 0x03, 0x01, 0x00, 0x03,
+    0x03, 0x00, 0x00, 0x80, 0x01, 0x80, 0x00, 0x01, 0x01, 0x01, 0x80, 0x00,
+    0x06, 0x01, 0x01, 0x03, 0x03, 0x01, 0x03, 0x00, 0x80, 0x01, 0x12, 0x0f,
+    0x15, 0x2f, 0x4d, 0x71, 0x95, 0xac, 0xb8, 0xc5, 0xc5, 0xc2, 0xb8, 0xb8,
+    0xae, 0xae, 0xb4, 0xae, 0xb4, 0xa7, 0x86, 0x9e, 0x04, 0x93, 0x93, 0x9b,
+    0x93, 0x93, 0x82, 0x9b, 0x00, 0x93, 0x82, 0x9b, 0x00, 0x93, 0x81, 0x9b,
+    0x04, 0x93, 0x93, 0x9b, 0x93, 0x93, 0x80, 0x95, 0x02, 0x93, 0x95, 0x8a,
+    0x85, 0x95, 0x00, 0x8c, 0x81, 0x95, 0x07, 0x8c, 0x8a, 0x8a, 0x95, 0x8a,
+    0x8a, 0x91, 0x91, 0x83, 0x8a, 0x04, 0x87, 0x80, 0x80, 0x83, 0x87, 0x82,
+    0x83, 0x83, 0x7e, 0x01, 0x77, 0x7e, 0x80, 0x77, 0x03, 0x73, 0x73, 0x75,
+    0x6e, 0x81, 0x75, 0x08, 0x70, 0x68, 0x75, 0x68, 0x70, 0x70, 0x68, 0x70,
+    0x68, 0x80, 0x70, 0x81, 0x68, 0x01, 0x75, 0x75, 0x81, 0x6e, 0x03, 0x7d,
+    0x77, 0x7e, 0x7e, 0x83, 0x83, 0x09, 0x7e, 0x77, 0x75, 0x70, 0x66, 0x58,
+    0x48, 0x3e, 0x3e, 0x2b, 0x80, 0x1b, 0x00, 0x16, 0x80, 0x0d, 0x03, 0x15,
+    0x21, 0x2b, 0x3d, 0x84, 0x49, 0x09, 0x3e, 0x35, 0x2b, 0x25, 0x1d, 0x10,
+    0x0f, 0x0f, 0x59, 0x5f, 0x84, 0x58, 0x82, 0x5f, 0x81, 0x66, 0x81, 0x6b,
+    0x03, 0x70, 0x70, 0x68, 0x75, 0x80, 0x6e, 0x00, 0x75, 0x86, 0x6e, 0x00,
+    0x7d, 0x81, 0x77, 0x01, 0x7e, 0x85, 0x80, 0x82, 0x0a, 0x7e, 0x7e, 0x82,
+    0x82, 0x7e, 0x7e, 0x82, 0x82, 0x87, 0x83, 0x83, 0x86, 0x87, 0x81, 0x91,
+    0x0b, 0x8c, 0x8c, 0x93, 0x95, 0x9b, 0x93, 0x9b, 0x9f, 0x9f, 0x9e, 0xa7,
+    0xa6, 0x80, 0xac, 0x07, 0xae, 0xb4, 0xb4, 0xb8, 0xbd, 0xb8, 0xc2, 0xc5,
+    0x81, 0xce, 0x08, 0xb8, 0xa6, 0x80, 0x64, 0x35, 0x1f, 0x07, 0x06, 0x06,
+    0x81, 0x03, 0x80, 0x01, 0x04, 0x03, 0x01, 0x01, 0x03, 0x03, 0x82, 0x01,
+    0x10, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x01, 0x01, 0x06, 0x02, 0x15,
+    0x2c, 0x43, 0x71, 0x91, 0xac, 0xbd, 0x80, 0xc5, 0x00, 0xb8, 0x80, 0xaa,
+    0x00, 0xb4, 0x80, 0x9e, 0x01, 0xac, 0xa7, 0x81, 0x9e, 0x00, 0x9f, 0x81,
+    0x93, 0x02, 0x9b, 0x9b, 0x93, 0x80, 0x9b, 0x09, 0x93, 0x9b, 0x9b, 0x93,
+    0x9b, 0x9b, 0x93, 0x9b, 0x9b, 0x93, 0x83, 0x9b, 0x00, 0x93, 0x82, 0x95,
+    0x80, 0x8c, 0x81, 0x95, 0x03, 0x8c, 0x95, 0x95, 0x8c, 0x80, 0x95, 0x05,
+    0x8a, 0x95, 0x95, 0x8a, 0x95, 0x8c, 0x80, 0x8a, 0x01, 0x91, 0x91, 0x83,
+    0x8a, 0x04, 0x83, 0x83, 0x87, 0x80, 0x87, 0x81, 0x83, 0x82, 0x7e, 0x00,
+    0x7d, 0x81, 0x77, 0x80, 0x6e, 0x04, 0x75, 0x6e, 0x6e, 0x75, 0x68, 0x84,
+    0x70, 0x01, 0x68, 0x68, 0x81, 0x70, 0x01, 0x75, 0x75, 0x80, 0x6e, 0x07,
+    0x7d, 0x73, 0x77, 0x77, 0x7e, 0x7e, 0x83, 0x83, 0x84, 0x8a, 0x08, 0x83,
+    0x7e, 0x75, 0x70, 0x66, 0x51, 0x44, 0x3e, 0x30, 0x80, 0x1b, 0x08, 0x0e,
+    0x08, 0x0d, 0x07, 0x07, 0x15, 0x21, 0x2b, 0x3d, 0x84, 0x49, 0x09, 0x3e,
+    0x35, 0x2b, 0x25, 0x1d, 0x10, 0x0f, 0x06, 0x5d, 0x58, 0x81, 0x51, 0x09,
+    0x4d, 0x4f, 0x58, 0x58, 0x59, 0x58, 0x4f, 0x56, 0x5f, 0x5f, 0x80, 0x66,
+    0x80, 0x6b, 0x80, 0x70, 0x02, 0x75, 0x74, 0x74, 0x82, 0x75, 0x80, 0x6e,
+    0x05, 0x7a, 0x73, 0x7a, 0x7d, 0x73, 0x7d, 0x80, 0x77, 0x08, 0x82, 0x7a,
+    0x7a, 0x77, 0x77, 0x7e, 0x82, 0x7e, 0x7e, 0x81, 0x82, 0x87, 0x87, 0x83,
+    0x91, 0x02, 0x8c, 0x8c, 0x95, 0x81, 0x9b, 0x06, 0x93, 0x9e, 0xa7, 0xa7,
+    0xac, 0xac, 0xa7, 0x80, 0xb4, 0x05, 0xae, 0xbd, 0xb8, 0xc2, 0xc2, 0xc9,
+    0x80, 0xce, 0x0b, 0xc9, 0xb8, 0xac, 0x87, 0x59, 0x37, 0x1f, 0x05, 0x02,
+    0x01, 0x01, 0x06, 0x81, 0x01, 0x01, 0x06, 0x06, 0x82, 0x01, 0x03, 0x03,
+    0x06, 0x01, 0x06, 0x81, 0x01, 0x0e, 0x03, 0x01, 0x01, 0x02, 0x10, 0x27,
+    0x41, 0x64, 0x87, 0xa6, 0xae, 0xb8, 0xc2, 0xc5, 0xb8, 0x80, 0xaa, 0x09,
+    0xa6, 0xac, 0xa6, 0xac, 0xa7, 0xa7, 0x9e, 0x9c, 0x9c, 0x9f, 0x81, 0x93,
+    0x02, 0x9b, 0x93, 0x93, 0x81, 0x9b, 0x09, 0x93, 0x93, 0x9b, 0x95, 0x93,
+    0x95, 0x95, 0x93, 0x93, 0x95, 0x80, 0x93, 0x04, 0x95, 0x93, 0x95, 0x95,
+    0x93, 0x84, 0x95, 0x00, 0x8c, 0x8d, 0x95, 0x03, 0x91, 0x91, 0x8a, 0x8a,
+    0x80, 0x91, 0x00, 0x8c, 0x80, 0x8a, 0x85, 0x83, 0x01, 0x7e, 0x82, 0x80,
+    0x7e, 0x03, 0x77, 0x7d, 0x77, 0x7d, 0x80, 0x6e, 0x01, 0x7d, 0x75, 0x80,
+    0x6e, 0x02, 0x71, 0x6e, 0x68, 0x82, 0x70, 0x03, 0x68, 0x70, 0x68, 0x68,
+    0x81, 0x70, 0x82, 0x6e, 0x03, 0x77, 0x7e, 0x7e, 0x83, 0x80, 0x8a, 0x00,
+    0x95, 0x82, 0x9b, 0x0f, 0x95, 0x91, 0x83, 0x7e, 0x75, 0x6b, 0x5f, 0x4e,
+    0x3e, 0x30, 0x2b, 0x1b, 0x1b, 0x0e, 0x08, 0x0d, 0x80, 0x07, 0x03, 0x15,
+    0x21, 0x2e, 0x3d, 0x84, 0x49, 0x12, 0x3e, 0x35, 0x2e, 0x25, 0x1d, 0x10,
+    0x0f, 0x06, 0x51, 0x51, 0x55, 0x55, 0x4e, 0x4e, 0x51, 0x46, 0x55, 0x51,
+    0x5d, 0x80, 0x58, 0x05, 0x59, 0x5f, 0x64, 0x56, 0x60, 0x64, 0x80, 0x6b,
+    0x80, 0x70, 0x01, 0x74, 0x74, 0x80, 0x75, 0x00, 0x71, 0x80, 0x75, 0x0f,
+    0x6e, 0x6e, 0x7a, 0x73, 0x7d, 0x7d, 0x73, 0x7a, 0x7a, 0x77, 0x7a, 0x77,
+    0x77, 0x82, 0x82, 0x7e, 0x80, 0x82, 0x04, 0x7e, 0x7e, 0x82, 0x82, 0x83,
+    0x85, 0x87, 0x81, 0x91, 0x0b, 0x8c, 0x91, 0x95, 0x95, 0x8c, 0x95, 0x9b,
+    0x9b, 0x93, 0x9b, 0x9f, 0x9f, 0x80, 0xa7, 0x03, 0xac, 0xa6, 0xac, 0xb4,
+    0x80, 0xaa, 0x10, 0xb8, 0xbd, 0xc2, 0xc2, 0xce, 0xce, 0xd5, 0xce, 0xc5,
+    0xb8, 0xac, 0x87, 0x59, 0x37, 0x1f, 0x07, 0x02, 0x80, 0x06, 0x00, 0x02,
+    0x82, 0x06, 0x80, 0x02, 0x81, 0x06, 0x2b, 0x02, 0x02, 0x06, 0x06, 0x02,
+    0x06, 0x01, 0x06, 0x0f, 0x1f, 0x2f, 0x4d, 0x82, 0x9b, 0xae, 0xb8, 0xc5,
+    0xc5, 0xb8, 0xae, 0xae, 0xa6, 0xac, 0xa6, 0xac, 0xa7, 0x9e, 0x9f, 0x93,
+    0x9c, 0x9b, 0x93, 0x93, 0x9b, 0x93, 0x93, 0x9b, 0x95, 0x93, 0x95, 0x93,
+    0x95, 0x95, 0x9b, 0x83, 0x95, 0x02, 0x8c, 0x8c, 0x95, 0x80, 0x93, 0x80,
+    0x95, 0x03, 0x93, 0x95, 0x95, 0x93, 0x83, 0x95, 0x00, 0x8c, 0x83, 0x95,
+    0x00, 0x8a, 0x81, 0x8c, 0x0a, 0x95, 0x8a, 0x8a, 0x95, 0x95, 0x8a, 0x91,
+    0x8a, 0x8c, 0x91, 0x91, 0x80, 0x8a, 0x04, 0x83, 0x83, 0x8a, 0x80, 0x87,
+    0x82, 0x83, 0x03, 0x7e, 0x82, 0x7e, 0x7e, 0x81, 0x77, 0x07, 0x7d, 0x73,
+    0x73, 0x7d, 0x73, 0x75, 0x6e, 0x6e, 0x80, 0x75, 0x04, 0x68, 0x68, 0x70,
+    0x68, 0x70, 0x81, 0x68, 0x80, 0x70, 0x0d, 0x75, 0x75, 0x73, 0x73, 0x7d,
+    0x85, 0x7e, 0x83, 0x83, 0x8a, 0x8a, 0x9b, 0x9b, 0x9f, 0x81, 0xa7, 0x18,
+    0x9f, 0x9b, 0x95, 0x8a, 0x83, 0x7a, 0x75, 0x66, 0x58, 0x44, 0x3d, 0x30,
+    0x1b, 0x1b, 0x0e, 0x0e, 0x08, 0x0d, 0x07, 0x06, 0x0f, 0x17, 0x21, 0x2e,
+    0x3d, 0x84, 0x49, 0x11, 0x3d, 0x3d, 0x2e, 0x25, 0x1a, 0x10, 0x0f, 0x06,
+    0x48, 0x48, 0x49, 0x55, 0x49, 0x55, 0x55, 0x4e, 0x55, 0x4e, 0x80, 0x51,
+    0x80, 0x58, 0x01, 0x56, 0x5f, 0x81, 0x66, 0x02, 0x6b, 0x68, 0x6b, 0x81,
+    0x70, 0x02, 0x68, 0x74, 0x68, 0x85, 0x75, 0x01, 0x7d, 0x7a, 0x80, 0x6e,
+    0x0c, 0x77, 0x77, 0x7a, 0x77, 0x77, 0x82, 0x7e, 0x7e, 0x82, 0x7e, 0x7e,
+    0x82, 0x83, 0x84, 0x87, 0x01, 0x91, 0x87, 0x83, 0x91, 0x24, 0x95, 0x95,
+    0x8c, 0x95, 0x95, 0x9b, 0x93, 0x9b, 0x9f, 0x9f, 0x9e, 0xa7, 0xac, 0xac,
+    0x9e, 0xa7, 0xac, 0xb4, 0xae, 0xae, 0xb8, 0xbd, 0xb8, 0xc2, 0xc5, 0xce,
+    0xce, 0xd5, 0xce, 0xc5, 0xb8, 0xac, 0x82, 0x59, 0x37, 0x1f, 0x07, 0x94,
+    0x06, 0x09, 0x05, 0x15, 0x2a, 0x47, 0x71, 0x95, 0xac, 0xb8, 0xc5, 0xb1,
+    0x80, 0xaa, 0x02, 0xa6, 0xac, 0xa7, 0x80, 0x9f, 0x80, 0x93, 0x04, 0x9b,
+    0x9b, 0x93, 0x9b, 0x9b, 0x83, 0x95, 0x03, 0x93, 0x95, 0x93, 0x93, 0x81,
+    0x95, 0x03, 0x8c, 0x8c, 0x95, 0x8c, 0x81, 0x95, 0x81, 0x93, 0x0d, 0x95,
+    0x95, 0x93, 0x95, 0x95, 0x8a, 0x93, 0x95, 0x95, 0x8c, 0x8c, 0x8a, 0x95,
+    0x8c, 0x81, 0x95, 0x06, 0x8a, 0x8c, 0x95, 0x8a, 0x95, 0x8a, 0x95, 0x80,
+    0x8a, 0x00, 0x91, 0x81, 0x8a, 0x81, 0x87, 0x82, 0x83, 0x01, 0x87, 0x83,
+    0x82, 0x7e, 0x80, 0x77, 0x81, 0x6e, 0x04, 0x7d, 0x75, 0x75, 0x6e, 0x6e,
+    0x80, 0x75, 0x85, 0x70, 0x00, 0x68, 0x83, 0x6e, 0x0c, 0x7e, 0x7e, 0x83,
+    0x8a, 0x8a, 0x9b, 0x9f, 0x9e, 0x9e, 0xa7, 0xaa, 0xaf, 0xaf, 0x80, 0xa7,
+    0x17, 0x9f, 0x95, 0x96, 0x85, 0x75, 0x6c, 0x63, 0x55, 0x4c, 0x3d, 0x2b,
+    0x1b, 0x1b, 0x0e, 0x0e, 0x0d, 0x07, 0x07, 0x06, 0x0f, 0x1d, 0x21, 0x2e,
+    0x3d, 0x83, 0x49, 0x08, 0x3e, 0x3e, 0x35, 0x2b, 0x25, 0x21, 0x10, 0x0f,
+    0x06, 0x83, 0x49, 0x80, 0x48, 0x80, 0x4d, 0x01, 0x46, 0x51, 0x80, 0x58,
+    0x11, 0x5f, 0x5f, 0x66, 0x60, 0x66, 0x66, 0x6b, 0x60, 0x68, 0x68, 0x6b,
+    0x70, 0x70, 0x68, 0x68, 0x71, 0x68, 0x71, 0x83, 0x75, 0x05, 0x73, 0x73,
+    0x7d, 0x73, 0x7d, 0x73, 0x82, 0x7a, 0x06, 0x82, 0x7e, 0x7e, 0x82, 0x7e,
+    0x7e, 0x82, 0x83, 0x87, 0x81, 0x91, 0x15, 0x8c, 0x91, 0x91, 0x8c, 0x91,
+    0x95, 0x95, 0x93, 0x9b, 0x9b, 0x93, 0x9b, 0x9b, 0x9f, 0x9f, 0x9e, 0xa7,
+    0xa6, 0xa7, 0xa7, 0xac, 0xa6, 0x81, 0xaa, 0x11, 0xb8, 0xb8, 0xc5, 0xc5,
+    0xce, 0xce, 0xd5, 0xce, 0xc9, 0xb8, 0xa7, 0x82, 0x59, 0x35, 0x1a, 0x10,
+    0x0f, 0x06, 0x8f, 0x0f, 0x10, 0x06, 0x0f, 0x10, 0x27, 0x41, 0x64, 0x87,
+    0xa4, 0xae, 0xb8, 0xb8, 0xae, 0xac, 0xac, 0xa6, 0xa7, 0x9f, 0x86, 0x9b,
+    0x80, 0x93, 0x83, 0x95, 0x12, 0x8c, 0x95, 0x8c, 0x93, 0x8c, 0x95, 0x95,
+    0x8c, 0x95, 0x95, 0x8c, 0x95, 0x95, 0x8c, 0x8c, 0x95, 0x93, 0x95, 0x8a,
+    0x80, 0x95, 0x04, 0x93, 0x95, 0x95, 0x93, 0x93, 0x81, 0x95, 0x03, 0x8c,
+    0x95, 0x8c, 0x8c, 0x80, 0x95, 0x07, 0x8c, 0x8c, 0x8a, 0x8a, 0x95, 0x91,
+    0x91, 0x8c, 0x82, 0x91, 0x00, 0x8a, 0x81, 0x87, 0x00, 0x83, 0x80, 0x87,
+    0x01, 0x85, 0x83, 0x83, 0x7e, 0x80, 0x77, 0x81, 0x6e, 0x01, 0x75, 0x75,
+    0x82, 0x6e, 0x04, 0x75, 0x68, 0x70, 0x70, 0x68, 0x80, 0x70, 0x01, 0x75,
+    0x75, 0x81, 0x6e, 0x0d, 0x77, 0x7e, 0x83, 0x83, 0x8a, 0x8a, 0x9b, 0x9f,
+    0xa7, 0xaa, 0xaa, 0xaf, 0xb4, 0xaa, 0x80, 0xaf, 0x19, 0xa7, 0x9f, 0x9b,
+    0x91, 0x83, 0x7d, 0x70, 0x6c, 0x5d, 0x48, 0x3e, 0x30, 0x1b, 0x1b, 0x0e,
+    0x0e, 0x08, 0x0d, 0x07, 0x06, 0x06, 0x07, 0x1d, 0x21, 0x33, 0x35, 0x84,
+    0x49, 0x07, 0x3e, 0x30, 0x2b, 0x25, 0x21, 0x15, 0x0f, 0x06, 0x81, 0x42,
+    0x03, 0x49, 0x43, 0x49, 0x49, 0x80, 0x48, 0x80, 0x4d, 0x00, 0x51, 0x80,
+    0x58, 0x00, 0x59, 0x80, 0x56, 0x03, 0x66, 0x66, 0x60, 0x64, 0x80, 0x6b,
+    0x0a, 0x68, 0x68, 0x6b, 0x68, 0x68, 0x71, 0x68, 0x75, 0x6e, 0x75, 0x75,
+    0x80, 0x6e, 0x00, 0x75, 0x81, 0x7d, 0x0b, 0x73, 0x77, 0x77, 0x82, 0x7e,
+    0x82, 0x7e, 0x80, 0x82, 0x7e, 0x82, 0x82, 0x81, 0x87, 0x80, 0x80, 0x80,
+    0x8c, 0x81, 0x91, 0x80, 0x95, 0x01, 0x93, 0x93, 0x80, 0x9b, 0x01, 0x93,
+    0x9f, 0x81, 0x9e, 0x03, 0xa7, 0xa7, 0xa6, 0xa6, 0x80, 0xaa, 0x80, 0xb8,
+    0x10, 0xc2, 0xc5, 0xce, 0xce, 0xd5, 0xce, 0xc2, 0xb8, 0xa7, 0x80, 0x59,
+    0x2f, 0x1f, 0x10, 0x0f, 0x0f, 0x07, 0x8c, 0x10, 0x12, 0x07, 0x0f, 0x10,
+    0x1f, 0x2f, 0x4d, 0x7a, 0x95, 0xac, 0xb4, 0xb4, 0xae, 0xac, 0xac, 0xa6,
+    0x9f, 0xa4, 0x9c, 0x9b, 0x80, 0x95, 0x01, 0x93, 0x93, 0x80, 0x95, 0x01,
+    0x8c, 0x93, 0x80, 0x95, 0x03, 0x8c, 0x8c, 0x95, 0x95, 0x82, 0x8c, 0x01,
+    0x95, 0x8c, 0x80, 0x95, 0x03, 0x8c, 0x95, 0x8c, 0x8c, 0x80, 0x95, 0x0c,
+    0x8c, 0x95, 0x95, 0x93, 0x8c, 0x93, 0x95, 0x95, 0x8a, 0x95, 0x95, 0x8c,
+    0x93, 0x83, 0x95, 0x0d, 0x8c, 0x95, 0x8c, 0x8c, 0x95, 0x95, 0x8a, 0x8a,
+    0x91, 0x8a, 0x91, 0x91, 0x8c, 0x91, 0x80, 0x87, 0x00, 0x80, 0x84, 0x83,
+    0x84, 0x7e, 0x01, 0x77, 0x77, 0x89, 0x6e, 0x03, 0x68, 0x68, 0x70, 0x70,
+    0x80, 0x68, 0x0e, 0x6e, 0x75, 0x75, 0x73, 0x73, 0x77, 0x7e, 0x83, 0x8a,
+    0x8a, 0x93, 0x93, 0x9e, 0x9e, 0xaa, 0x83, 0xaf, 0x14, 0xb4, 0xaf, 0xa7,
+    0xa7, 0x9b, 0x91, 0x87, 0x7a, 0x74, 0x64, 0x5d, 0x4e, 0x3e, 0x3d, 0x2b,
+    0x1b, 0x0e, 0x0e, 0x08, 0x0d, 0x0d, 0x80, 0x06, 0x13, 0x10, 0x1d, 0x27,
+    0x30, 0x42, 0x4c, 0x49, 0x44, 0x4c, 0x4c, 0x44, 0x42, 0x35, 0x30, 0x30,
+    0x27, 0x1f, 0x1d, 0x10, 0x0f, 0x83, 0x42, 0x00, 0x44, 0x80, 0x49, 0x80,
+    0x48, 0x02, 0x4e, 0x55, 0x51, 0x80, 0x58, 0x0c, 0x5d, 0x5f, 0x59, 0x5f,
+    0x64, 0x56, 0x60, 0x66, 0x66, 0x6b, 0x60, 0x6b, 0x6b, 0x80, 0x70, 0x02,
+    0x74, 0x71, 0x70, 0x86, 0x75, 0x04, 0x73, 0x7d, 0x73, 0x77, 0x82, 0x82,
+    0x7e, 0x03, 0x83, 0x87, 0x87, 0x83, 0x81, 0x87, 0x0d, 0x91, 0x80, 0x8c,
+    0x8c, 0x91, 0x8c, 0x91, 0x91, 0x8c, 0x95, 0x8c, 0x8c, 0x95, 0x95, 0x81,
+    0x9b, 0x03, 0x9f, 0x93, 0x9e, 0x9f, 0x80, 0xa7, 0x01, 0x9e, 0xa6, 0x81,
+    0xaa, 0x80, 0xb8, 0x0f, 0xc2, 0xc5, 0xce, 0xce, 0xd5, 0xce, 0xc5, 0xb8,
+    0x9e, 0x80, 0x4d, 0x2f, 0x21, 0x15, 0x10, 0x10, 0x81, 0x15, 0x05, 0x1d,
+    0x1d, 0x15, 0x15, 0x17, 0x1d, 0x80, 0x15, 0x11, 0x1d, 0x0d, 0x10, 0x10,
+    0x15, 0x2c, 0x3b, 0x64, 0x87, 0xac, 0xae, 0xb4, 0xb4, 0xa6, 0xa7, 0xa4,
+    0x9b, 0x9b, 0x80, 0x95, 0x06, 0x8c, 0x8c, 0x95, 0x8c, 0x8c, 0x95, 0x8c,
+    0x82, 0x95, 0x01, 0x8c, 0x95, 0x85, 0x8c, 0x03, 0x95, 0x8c, 0x95, 0x8c,
+    0x80, 0x95, 0x01, 0x8c, 0x8c, 0x82, 0x95, 0x00, 0x93, 0x84, 0x95, 0x03,
+    0x8c, 0x93, 0x8c, 0x8c, 0x80, 0x95, 0x0a, 0x8c, 0x95, 0x95, 0x8a, 0x8a,
+    0x95, 0x95, 0x8c, 0x8a, 0x91, 0x91, 0x81, 0x8a, 0x02, 0x8c, 0x80, 0x87,
+    0x80, 0x83, 0x04, 0x80, 0x83, 0x87, 0x83, 0x83, 0x83, 0x7e, 0x80, 0x77,
+    0x83, 0x6e, 0x00, 0x75, 0x81, 0x6e, 0x07, 0x68, 0x75, 0x75, 0x6e, 0x75,
+    0x75, 0x70, 0x68, 0x81, 0x6e, 0x07, 0x77, 0x7e, 0x83, 0x83, 0x8a, 0x95,
+    0x9f, 0xa7, 0x80, 0xaa, 0x00, 0xb8, 0x81, 0xbd, 0x80, 0xaf, 0x1b, 0xa7,
+    0xa7, 0x9b, 0x91, 0x82, 0x7a, 0x70, 0x66, 0x59, 0x55, 0x42, 0x3d, 0x2b,
+    0x1b, 0x1b, 0x0e, 0x08, 0x0d, 0x0d, 0x07, 0x02, 0x06, 0x0f, 0x10, 0x1d,
+    0x27, 0x33, 0x3d, 0x80, 0x49, 0x0d, 0x44, 0x4c, 0x4c, 0x42, 0x35, 0x30,
+    0x33, 0x25, 0x21, 0x1d, 0x10, 0x0f, 0x37, 0x35, 0x81, 0x42, 0x02, 0x3e,
+    0x3b, 0x42, 0x80, 0x49, 0x05, 0x48, 0x48, 0x4e, 0x4e, 0x51, 0x51, 0x82,
+    0x58, 0x02, 0x5f, 0x56, 0x56, 0x81, 0x66, 0x81, 0x6b, 0x05, 0x70, 0x70,
+    0x68, 0x70, 0x70, 0x68, 0x83, 0x75, 0x05, 0x73, 0x73, 0x7d, 0x73, 0x77,
+    0x7a, 0x80, 0x7e, 0x02, 0x85, 0x7e, 0x7e, 0x81, 0x83, 0x82, 0x87, 0x81,
+    0x91, 0x02, 0x8c, 0x91, 0x91, 0x82, 0x95, 0x00, 0x93, 0x81, 0x9b, 0x81,
+    0x9f, 0x18, 0xa7, 0xac, 0xa7, 0xa6, 0xa6, 0xae, 0xb4, 0xae, 0xae, 0xb8,
+    0xbd, 0xb8, 0xc5, 0xc5, 0xce, 0xce, 0xd5, 0xce, 0xc5, 0xb8, 0xa6, 0x80,
+    0x4d, 0x2f, 0x21, 0x81, 0x15, 0x00, 0x1d, 0x87, 0x1a, 0x11, 0x1d, 0x15,
+    0x0d, 0x15, 0x27, 0x37, 0x4d, 0x7a, 0xa4, 0xac, 0xb4, 0xae, 0xac, 0xa4,
+    0x93, 0xa4, 0x95, 0x95, 0x83, 0x91, 0x00, 0x8c, 0x83, 0x91, 0x0d, 0x8c,
+    0x91, 0x8c, 0x8c, 0x91, 0x8c, 0x8c, 0x91, 0x95, 0x95, 0x8c, 0x95, 0x95,
+    0x8c, 0x80, 0x95, 0x00, 0x8c, 0x80, 0x95, 0x00, 0x8c, 0x85, 0x95, 0x00,
+    0x8a, 0x83, 0x8c, 0x84, 0x95, 0x02, 0x8c, 0x95, 0x95, 0x80, 0x8c, 0x07,
+    0x8a, 0x91, 0x8a, 0x8c, 0x8c, 0x8a, 0x91, 0x87, 0x81, 0x83, 0x03, 0x87,
+    0x83, 0x82, 0x82, 0x83, 0x7e, 0x02, 0x7d, 0x7d, 0x77, 0x85, 0x6e, 0x83,
+    0x75, 0x00, 0x68, 0x80, 0x75, 0x80, 0x6e, 0x0b, 0x7d, 0x77, 0x7e, 0x83,
+    0x83, 0x8a, 0x8a, 0x9f, 0xa7, 0xaf, 0xaf, 0xae, 0x80, 0xbd, 0x19, 0xb8,
+    0xb8, 0xbd, 0xbd, 0xaf, 0xaf, 0xa7, 0x9f, 0xa0, 0x87, 0x82, 0x7a, 0x74,
+    0x6c, 0x5d, 0x4d, 0x49, 0x35, 0x30, 0x2b, 0x1b, 0x16, 0x08, 0x08, 0x0d,
+    0x07, 0x80, 0x06, 0x06, 0x0f, 0x17, 0x1f, 0x2e, 0x30, 0x3d, 0x44, 0x82,
+    0x49, 0x0a, 0x42, 0x35, 0x30, 0x2b, 0x2e, 0x21, 0x1d, 0x10, 0x0f, 0x2a,
+    0x2f, 0x81, 0x35, 0x81, 0x42, 0x07, 0x3b, 0x49, 0x44, 0x44, 0x48, 0x48,
+    0x4e, 0x4e, 0x80, 0x51, 0x81, 0x58, 0x03, 0x5f, 0x56, 0x56, 0x5f, 0x80,
+    0x66, 0x80, 0x6b, 0x06, 0x68, 0x70, 0x68, 0x68, 0x71, 0x68, 0x68, 0x84,
+    0x75, 0x0b, 0x73, 0x73, 0x77, 0x77, 0x7e, 0x7e, 0x82, 0x82, 0x7e, 0x7e,
+    0x82, 0x83, 0x80, 0x87, 0x02, 0x80, 0x87, 0x87, 0x85, 0x91, 0x01, 0x8c,
+    0x8c, 0x80, 0x95, 0x00, 0x93, 0x81, 0x9b, 0x81, 0x9f, 0x07, 0x9e, 0xa7,
+    0x9e, 0xa6, 0xae, 0xb4, 0xae, 0xae, 0x80, 0xb8, 0x10, 0xc2, 0xc5, 0xc5,
+    0xce, 0xd5, 0xd5, 0xce, 0xc5, 0xb8, 0x9f, 0x7a, 0x4d, 0x2f, 0x21, 0x15,
+    0x15, 0x1d, 0x89, 0x21, 0x11, 0x1d, 0x15, 0x21, 0x2a, 0x43, 0x64, 0x86,
+    0xac, 0xae, 0xae, 0xa6, 0x9c, 0x9b, 0x95, 0x8c, 0x91, 0x8c, 0x80, 0x84,
+    0x87, 0x09, 0x91, 0x91, 0x8c, 0x91, 0x8c, 0x8c, 0x91, 0x8c, 0x91, 0x91,
+    0x80, 0x8c, 0x00, 0x8a, 0x82, 0x8c, 0x04, 0x95, 0x8c, 0x8c, 0x95, 0x8a,
+    0x82, 0x8c, 0x03, 0x95, 0x95, 0x8c, 0x8c, 0x80, 0x95, 0x82, 0x8c, 0x01,
+    0x95, 0x8c, 0x82, 0x95, 0x04, 0x8c, 0x8c, 0x95, 0x8c, 0x8c, 0x80, 0x8a,
+    0x00, 0x8c, 0x80, 0x8a, 0x86, 0x83, 0x00, 0x82, 0x82, 0x7e, 0x82, 0x77,
+    0x81, 0x6e, 0x01, 0x75, 0x75, 0x80, 0x6e, 0x03, 0x75, 0x75, 0x70, 0x75,
+    0x81, 0x6e, 0x00, 0x75, 0x80, 0x6e, 0x09, 0x77, 0x7e, 0x83, 0x8a, 0x8a,
+    0x9b, 0xa7, 0x9e, 0xaa, 0xae, 0x80, 0xb8, 0x81, 0xbd, 0x20, 0xb4, 0xaf,
+    0xa7, 0x9f, 0x95, 0x87, 0x82, 0x7d, 0x68, 0x6c, 0x63, 0x5d, 0x4d, 0x43,
+    0x35, 0x30, 0x2b, 0x25, 0x16, 0x16, 0x08, 0x0d, 0x07, 0x07, 0x01, 0x02,
+    0x06, 0x0f, 0x17, 0x21, 0x2e, 0x35, 0x3e, 0x82, 0x49, 0x11, 0x42, 0x42,
+    0x35, 0x30, 0x2b, 0x25, 0x21, 0x1d, 0x10, 0x0f, 0x27, 0x2a, 0x2f, 0x30,
+    0x33, 0x37, 0x35, 0x35, 0x80, 0x42, 0x05, 0x3e, 0x3e, 0x44, 0x44, 0x48,
+    0x48, 0x81, 0x4d, 0x02, 0x51, 0x51, 0x5d, 0x80, 0x58, 0x02, 0x56, 0x5f,
+    0x5f, 0x80, 0x66, 0x80, 0x6b, 0x81, 0x70, 0x00, 0x68, 0x80, 0x70, 0x82,
+    0x75, 0x80, 0x6e, 0x03, 0x77, 0x82, 0x7e, 0x82, 0x80, 0x7e, 0x01, 0x82,
+    0x83, 0x85, 0x87, 0x84, 0x91, 0x82, 0x95, 0x0e, 0x93, 0x9b, 0x9b, 0x9c,
+    0x93, 0x9f, 0x9f, 0x9e, 0x9e, 0xa7, 0xa7, 0xa6, 0xa6, 0xae, 0xb4, 0x80,
+    0xaa, 0x13, 0xb8, 0xbd, 0xc2, 0xc2, 0xc9, 0xce, 0xd5, 0xd5, 0xce, 0xc5,
+    0xb8, 0x93, 0x7a, 0x4d, 0x35, 0x27, 0x21, 0x1a, 0x21, 0x21, 0x86, 0x25,
+    0x0f, 0x21, 0x1d, 0x1d, 0x27, 0x37, 0x4d, 0x71, 0xa4, 0xac, 0xae, 0xa6,
+    0xa6, 0x9b, 0x95, 0x91, 0x8c, 0x81, 0x80, 0x81, 0x87, 0x05, 0x80, 0x87,
+    0x87, 0x91, 0x80, 0x80, 0x80, 0x91, 0x02, 0x8a, 0x8c, 0x91, 0x80, 0x8c,
+    0x02, 0x91, 0x95, 0x95, 0x80, 0x8c, 0x80, 0x95, 0x00, 0x8c, 0x84, 0x95,
+    0x05, 0x8c, 0x95, 0x8c, 0x95, 0x95, 0x8c, 0x88, 0x95, 0x02, 0x8a, 0x95,
+    0x95, 0x80, 0x8c, 0x00, 0x8a, 0x80, 0x91, 0x80, 0x8a, 0x84, 0x83, 0x83,
+    0x82, 0x80, 0x7e, 0x80, 0x77, 0x84, 0x6e, 0x85, 0x75, 0x0e, 0x6e, 0x6e,
+    0x75, 0x73, 0x73, 0x77, 0x7e, 0x7e, 0x83, 0x8a, 0x93, 0x9e, 0x9e, 0xaa,
+    0xae, 0x80, 0xbd, 0x00, 0xb8, 0x81, 0xbd, 0x17, 0xaf, 0xaf, 0xa7, 0x95,
+    0x91, 0x85, 0x81, 0x71, 0x6b, 0x66, 0x5d, 0x55, 0x49, 0x42, 0x35, 0x30,
+    0x2b, 0x1b, 0x16, 0x16, 0x08, 0x0d, 0x07, 0x07, 0x81, 0x06, 0x05, 0x10,
+    0x1d, 0x27, 0x30, 0x3d, 0x3e, 0x82, 0x49, 0x0f, 0x42, 0x42, 0x35, 0x3d,
+    0x2b, 0x25, 0x21, 0x1d, 0x10, 0x0f, 0x1d, 0x21, 0x2c, 0x2e, 0x2f, 0x2f,
+    0x81, 0x35, 0x06, 0x42, 0x42, 0x3e, 0x3e, 0x44, 0x44, 0x49, 0x80, 0x48,
+    0x03, 0x4e, 0x4e, 0x51, 0x51, 0x81, 0x58, 0x80, 0x5f, 0x01, 0x66, 0x66,
+    0x81, 0x6b, 0x04, 0x70, 0x68, 0x6b, 0x70, 0x70, 0x81, 0x75, 0x07, 0x6e,
+    0x6e, 0x75, 0x73, 0x73, 0x7d, 0x77, 0x7a, 0x83, 0x82, 0x01, 0x7e, 0x83,
+    0x85, 0x87, 0x02, 0x80, 0x8c, 0x8c, 0x81, 0x91, 0x05, 0x8c, 0x95, 0x95,
+    0x8c, 0x95, 0x9c, 0x80, 0x9b, 0x08, 0x93, 0x9e, 0xa7, 0x9e, 0xa7, 0xa6,
+    0xa7, 0xa6, 0xa6, 0x81, 0xaa, 0x01, 0xb8, 0xb8, 0x80, 0xc5, 0x0d, 0xce,
+    0xce, 0xd5, 0xd5, 0xce, 0xc5, 0xb8, 0x9c, 0x7a, 0x4d, 0x35, 0x25, 0x21,
+    0x21, 0x81, 0x25, 0x13, 0x2e, 0x2a, 0x2a, 0x2e, 0x25, 0x25, 0x21, 0x1d,
+    0x1f, 0x2c, 0x41, 0x59, 0x7a, 0x9b, 0xac, 0xa6, 0xa6, 0x9c, 0x95, 0x8c,
+    0x80, 0x87, 0x00, 0x80, 0x82, 0x82, 0x80, 0x87, 0x02, 0x80, 0x87, 0x87,
+    0x80, 0x80, 0x05, 0x91, 0x8c, 0x8c, 0x91, 0x91, 0x8c, 0x80, 0x91, 0x80,
+    0x8c, 0x81, 0x95, 0x0a, 0x8a, 0x95, 0x8c, 0x95, 0x95, 0x8c, 0x95, 0x95,
+    0x8c, 0x95, 0x8c, 0x81, 0x95, 0x01, 0x8c, 0x95, 0x80, 0x8c, 0x82, 0x95,
+    0x04, 0x8c, 0x8a, 0x95, 0x95, 0x8c, 0x80, 0x8a, 0x04, 0x8c, 0x91, 0x91,
+    0x87, 0x8a, 0x80, 0x83, 0x06, 0x87, 0x83, 0x85, 0x83, 0x82, 0x7e, 0x82,
+    0x82, 0x7e, 0x80, 0x7d, 0x00, 0x77, 0x85, 0x6e, 0x84, 0x75, 0x81, 0x6e,
+    0x34, 0x77, 0x7e, 0x87, 0x8a, 0x8a, 0x9b, 0xa7, 0xaf, 0xaa, 0xae, 0xb8,
+    0xbd, 0xb8, 0xbd, 0xb8, 0xbd, 0xbd, 0xb4, 0xaf, 0xa7, 0x9b, 0x8a, 0x85,
+    0x75, 0x74, 0x6c, 0x63, 0x58, 0x55, 0x55, 0x49, 0x42, 0x35, 0x30, 0x2b,
+    0x25, 0x16, 0x16, 0x0d, 0x0d, 0x07, 0x07, 0x02, 0x01, 0x06, 0x06, 0x0f,
+    0x10, 0x1d, 0x27, 0x33, 0x35, 0x3e, 0x81, 0x49, 0x13, 0x42, 0x3e, 0x42,
+    0x3d, 0x30, 0x2e, 0x25, 0x21, 0x1d, 0x1d, 0x10, 0x17, 0x1d, 0x21, 0x2c,
+    0x2a, 0x2f, 0x2f, 0x30, 0x30, 0x80, 0x35, 0x00, 0x42, 0x80, 0x3b, 0x08,
+    0x44, 0x49, 0x44, 0x4c, 0x48, 0x55, 0x4e, 0x51, 0x51, 0x81, 0x58, 0x04,
+    0x5f, 0x5f, 0x64, 0x64, 0x66, 0x80, 0x6b, 0x03, 0x68, 0x71, 0x70, 0x68,
+    0x80, 0x70, 0x02, 0x75, 0x75, 0x6e, 0x80, 0x75, 0x04, 0x73, 0x7d, 0x73,
+    0x73, 0x7d, 0x82, 0x82, 0x02, 0x7e, 0x7e, 0x82, 0x83, 0x87, 0x00, 0x80,
+    0x83, 0x91, 0x81, 0x8c, 0x07, 0x95, 0x95, 0x93, 0x93, 0x9b, 0x9b, 0x9c,
+    0x93, 0x81, 0x9e, 0x00, 0xa7, 0x80, 0x9e, 0x00, 0xb4, 0x80, 0xaa, 0x02,
+    0xbd, 0xb8, 0xb8, 0x80, 0xc5, 0x0d, 0xce, 0xd5, 0xd5, 0xce, 0xc5, 0xae,
+    0x9b, 0x7a, 0x4d, 0x35, 0x25, 0x21, 0x21, 0x25, 0x82, 0x2e, 0x12, 0x2b,
+    0x2e, 0x25, 0x21, 0x1a, 0x21, 0x31, 0x41, 0x59, 0x82, 0xa4, 0xa6, 0xa6,
+    0x93, 0x95, 0x91, 0x87, 0x87, 0x7e, 0x80, 0x82, 0x00, 0x7e, 0x83, 0x82,
+    0x01, 0x87, 0x87, 0x82, 0x80, 0x02, 0x87, 0x91, 0x8c, 0x80, 0x91, 0x01,
+    0x8c, 0x8a, 0x81, 0x91, 0x00, 0x95, 0x80, 0x8c, 0x01, 0x95, 0x95, 0x81,
+    0x8c, 0x07, 0x95, 0x8c, 0x95, 0x95, 0x8c, 0x8c, 0x95, 0x8c, 0x80, 0x8a,
+    0x03, 0x8c, 0x95, 0x95, 0x8c, 0x82, 0x95, 0x11, 0x91, 0x8c, 0x8c, 0x8a,
+    0x8a, 0x8c, 0x8c, 0x91, 0x91, 0x8a, 0x87, 0x83, 0x80, 0x80, 0x87, 0x87,
+    0x83, 0x83, 0x84, 0x7e, 0x02, 0x77, 0x77, 0x7d, 0x8a, 0x6e, 0x0d, 0x75,
+    0x6e, 0x75, 0x75, 0x73, 0x73, 0x77, 0x7e, 0x83, 0x83, 0x8a, 0x9b, 0x9f,
+    0xa7, 0x80, 0xaf, 0x82, 0xbd, 0x40, 0xb4, 0xaf, 0xaf, 0xa7, 0x9b, 0x96,
+    0x83, 0x73, 0x70, 0x6c, 0x5d, 0x55, 0x55, 0x49, 0x49, 0x42, 0x42, 0x35,
+    0x30, 0x2b, 0x25, 0x16, 0x16, 0x08, 0x0d, 0x07, 0x07, 0x06, 0x06, 0x01,
+    0x06, 0x06, 0x07, 0x1d, 0x21, 0x25, 0x33, 0x35, 0x3d, 0x4c, 0x4c, 0x44,
+    0x44, 0x42, 0x3e, 0x3e, 0x35, 0x30, 0x2e, 0x25, 0x21, 0x1d, 0x15, 0x10,
+    0x10, 0x17, 0x1f, 0x21, 0x27, 0x2a, 0x2e, 0x33, 0x2f, 0x30, 0x30, 0x80,
+    0x35, 0x07, 0x42, 0x3e, 0x3e, 0x49, 0x49, 0x44, 0x48, 0x48, 0x80, 0x4d,
+    0x00, 0x51, 0x80, 0x58, 0x80, 0x5f, 0x80, 0x66, 0x80, 0x6b, 0x03, 0x68,
+    0x70, 0x74, 0x74, 0x80, 0x70, 0x80, 0x75, 0x02, 0x6e, 0x75, 0x75, 0x81,
+    0x7d, 0x08, 0x77, 0x77, 0x7e, 0x7e, 0x85, 0x7e, 0x7e, 0x82, 0x82, 0x81,
+    0x87, 0x02, 0x83, 0x87, 0x87, 0x84, 0x91, 0x81, 0x95, 0x06, 0x9b, 0x9b,
+    0x93, 0x9b, 0x9b, 0x9f, 0x9c, 0x80, 0x9e, 0x08, 0xa7, 0x9e, 0xa6, 0xac,
+    0xb4, 0xb4, 0xae, 0xae, 0xb4, 0x80, 0xb8, 0x11, 0xc2, 0xc2, 0xce, 0xce,
+    0xd5, 0xd5, 0xce, 0xc5, 0xb4, 0x93, 0x7a, 0x4d, 0x35, 0x25, 0x27, 0x25,
+    0x2e, 0x2b, 0x81, 0x30, 0x01, 0x2e, 0x25, 0x80, 0x21, 0x0c, 0x2f, 0x43,
+    0x64, 0x87, 0x9b, 0x9f, 0x93, 0x8c, 0x91, 0x87, 0x87, 0x82, 0x7e, 0x84,
+    0x7a, 0x0f, 0x77, 0x7e, 0x7e, 0x83, 0x80, 0x80, 0x87, 0x87, 0x80, 0x87,
+    0x87, 0x80, 0x91, 0x80, 0x91, 0x91, 0x84, 0x8c, 0x04, 0x8a, 0x91, 0x8c,
+    0x91, 0x91, 0x82, 0x8c, 0x00, 0x95, 0x82, 0x8c, 0x02, 0x95, 0x8a, 0x8a,
+    0x80, 0x8c, 0x02, 0x91, 0x8c, 0x91, 0x82, 0x8c, 0x0c, 0x8a, 0x91, 0x91,
+    0x8c, 0x8c, 0x8a, 0x8a, 0x87, 0x87, 0x83, 0x83, 0x87, 0x80, 0x81, 0x83,
+    0x80, 0x7e, 0x02, 0x83, 0x77, 0x7e, 0x80, 0x77, 0x85, 0x6e, 0x01, 0x75,
+    0x75, 0x83, 0x6e, 0x0c, 0x75, 0x73, 0x73, 0x77, 0x7e, 0x83, 0x8a, 0x95,
+    0x9b, 0xa7, 0xa7, 0xaf, 0xb4, 0x81, 0xbd, 0x80, 0xb4, 0x0b, 0xa7, 0xa7,
+    0x9b, 0x96, 0x85, 0x7d, 0x70, 0x66, 0x5f, 0x55, 0x49, 0x49, 0x80, 0x42,
+    0x2c, 0x35, 0x30, 0x2b, 0x2b, 0x25, 0x16, 0x16, 0x0d, 0x0d, 0x07, 0x07,
+    0x06, 0x06, 0x01, 0x01, 0x06, 0x0f, 0x10, 0x1d, 0x21, 0x2a, 0x33, 0x35,
+    0x42, 0x42, 0x4c, 0x4c, 0x44, 0x4c, 0x3e, 0x35, 0x30, 0x30, 0x2e, 0x25,
+    0x21, 0x1d, 0x15, 0x10, 0x0f, 0x10, 0x17, 0x1d, 0x21, 0x27, 0x80, 0x2e,
+    0x80, 0x2f, 0x02, 0x30, 0x35, 0x35, 0x80, 0x42, 0x00, 0x3e, 0x80, 0x44,
+    0x04, 0x48, 0x4e, 0x4e, 0x51, 0x51, 0x80, 0x58, 0x80, 0x5f, 0x80, 0x66,
+    0x02, 0x6b, 0x6b, 0x64, 0x80, 0x68, 0x81, 0x70, 0x02, 0x75, 0x70, 0x6e,
+    0x82, 0x75, 0x04, 0x7d, 0x7a, 0x77, 0x77, 0x7d, 0x81, 0x7e, 0x02, 0x82,
+    0x82, 0x83, 0x84, 0x87, 0x83, 0x91, 0x01, 0x95, 0x8c, 0x80, 0x95, 0x81,
+    0x9b, 0x02, 0x9f, 0x9f, 0xa6, 0x81, 0xa7, 0x02, 0xa6, 0xac, 0xb4, 0x80,
+    0xaa, 0x14, 0xb4, 0xbd, 0xb8, 0xb8, 0xc2, 0xc5, 0xce, 0xce, 0xd5, 0xd5,
+    0xce, 0xc2, 0xae, 0x9b, 0x7a, 0x4d, 0x35, 0x2a, 0x25, 0x25, 0x2e, 0x81,
+    0x30, 0x0f, 0x2e, 0x2e, 0x21, 0x21, 0x27, 0x2f, 0x43, 0x64, 0x87, 0x9c,
+    0x9b, 0x95, 0x91, 0x87, 0x82, 0x82, 0x83, 0x7a, 0x00, 0x71, 0x81, 0x7a,
+    0x80, 0x82, 0x81, 0x87, 0x01, 0x80, 0x83, 0x82, 0x87, 0x00, 0x91, 0x83,
+    0x8c, 0x26, 0x91, 0x91, 0x8c, 0x8c, 0x91, 0x8c, 0x8c, 0x91, 0x91, 0x8c,
+    0x91, 0x8c, 0x8c, 0x91, 0x95, 0x91, 0x91, 0x8c, 0x91, 0x91, 0x8a, 0x8a,
+    0x91, 0x91, 0x8c, 0x91, 0x8c, 0x91, 0x91, 0x8a, 0x91, 0x8a, 0x8a, 0x91,
+    0x91, 0x8a, 0x87, 0x87, 0x80, 0x84, 0x83, 0x00, 0x85, 0x83, 0x7e, 0x08,
+    0x77, 0x77, 0x7d, 0x73, 0x7d, 0x73, 0x75, 0x73, 0x6e, 0x84, 0x75, 0x57,
+    0x6e, 0x75, 0x6e, 0x73, 0x7d, 0x77, 0x7e, 0x83, 0x8a, 0x8a, 0x9b, 0xa7,
+    0xa7, 0xaf, 0xaf, 0xb4, 0xbd, 0xaf, 0xb4, 0xb4, 0xa7, 0xa7, 0x9f, 0x95,
+    0x91, 0x82, 0x7a, 0x74, 0x66, 0x5f, 0x55, 0x49, 0x49, 0x42, 0x42, 0x35,
+    0x35, 0x30, 0x2b, 0x2b, 0x25, 0x21, 0x1a, 0x08, 0x0d, 0x0d, 0x07, 0x07,
+    0x02, 0x06, 0x01, 0x01, 0x02, 0x06, 0x0f, 0x10, 0x1d, 0x21, 0x25, 0x2e,
+    0x30, 0x35, 0x35, 0x3d, 0x3e, 0x3d, 0x3d, 0x35, 0x3d, 0x30, 0x30, 0x2e,
+    0x25, 0x21, 0x21, 0x15, 0x15, 0x06, 0x0f, 0x10, 0x17, 0x1d, 0x21, 0x25,
+    0x2e, 0x2a, 0x2a, 0x2e, 0x80, 0x2f, 0x01, 0x35, 0x35, 0x81, 0x42, 0x80,
+    0x44, 0x04, 0x48, 0x4e, 0x4e, 0x51, 0x51, 0x80, 0x58, 0x81, 0x5f, 0x80,
+    0x66, 0x06, 0x6c, 0x6b, 0x6b, 0x64, 0x6b, 0x70, 0x71, 0x81, 0x70, 0x83,
+    0x75, 0x0a, 0x7a, 0x7a, 0x7d, 0x7d, 0x77, 0x77, 0x7e, 0x82, 0x7e, 0x82,
+    0x82, 0x80, 0x83, 0x82, 0x87, 0x83, 0x91, 0x03, 0x8c, 0x8c, 0x95, 0x95,
+    0x81, 0x9b, 0x81, 0x9f, 0x05, 0xa4, 0xa7, 0xa7, 0xa6, 0xac, 0xa6, 0x82,
+    0xaa, 0x01, 0xbd, 0xb8, 0x80, 0xc5, 0x20, 0xce, 0xce, 0xd5, 0xd5, 0xce,
+    0xc2, 0xae, 0x93, 0x71, 0x4d, 0x35, 0x2a, 0x25, 0x2e, 0x30, 0x30, 0x35,
+    0x30, 0x30, 0x2e, 0x21, 0x21, 0x27, 0x31, 0x47, 0x64, 0x82, 0x95, 0x95,
+    0x91, 0x87, 0x82, 0x82, 0x81, 0x7a, 0x83, 0x71, 0x03, 0x6e, 0x7a, 0x7a,
+    0x80, 0x81, 0x82, 0x00, 0x87, 0x80, 0x83, 0x82, 0x87, 0x04, 0x80, 0x91,
+    0x91, 0x8c, 0x8c, 0x84, 0x91, 0x81, 0x8c, 0x02, 0x91, 0x8c, 0x8c, 0x80,
+    0x91, 0x00, 0x8c, 0x83, 0x91, 0x08, 0x8c, 0x8c, 0x91, 0x91, 0x8c, 0x91,
+    0x8a, 0x8c, 0x91, 0x80, 0x87, 0x02, 0x80, 0x87, 0x87, 0x82, 0x83, 0x04,
+    0x87, 0x83, 0x83, 0x7e, 0x82, 0x80, 0x7e, 0x80, 0x77, 0x03, 0x7d, 0x7d,
+    0x73, 0x73, 0x81, 0x75, 0x00, 0x6e, 0x86, 0x75, 0x0a, 0x7d, 0x7d, 0x85,
+    0x83, 0x8a, 0x95, 0x9b, 0xa7, 0xa7, 0xaf, 0xaf, 0x81, 0xb4, 0x1d, 0xa7,
+    0xa7, 0x9b, 0x91, 0x83, 0x7d, 0x74, 0x71, 0x6c, 0x5d, 0x55, 0x49, 0x49,
+    0x42, 0x42, 0x37, 0x37, 0x33, 0x2a, 0x2e, 0x25, 0x21, 0x1a, 0x1a, 0x0d,
+    0x0d, 0x07, 0x07, 0x06, 0x06, 0x80, 0x01, 0x21, 0x06, 0x02, 0x0f, 0x07,
+    0x17, 0x1f, 0x21, 0x2a, 0x33, 0x33, 0x35, 0x42, 0x42, 0x49, 0x49, 0x44,
+    0x44, 0x49, 0x49, 0x42, 0x42, 0x35, 0x35, 0x2f, 0x2f, 0x2a, 0x00, 0x06,
+    0x0f, 0x10, 0x17, 0x1f, 0x21, 0x27, 0x81, 0x2a, 0x05, 0x2e, 0x33, 0x30,
+    0x30, 0x35, 0x35, 0x80, 0x42, 0x07, 0x3e, 0x49, 0x44, 0x48, 0x55, 0x4e,
+    0x4e, 0x51, 0x81, 0x58, 0x80, 0x5f, 0x09, 0x66, 0x66, 0x6c, 0x66, 0x6b,
+    0x60, 0x64, 0x6b, 0x68, 0x68, 0x81, 0x70, 0x83, 0x75, 0x0b, 0x7d, 0x7a,
+    0x77, 0x7a, 0x77, 0x7d, 0x82, 0x7e, 0x7e, 0x85, 0x85, 0x82, 0x84, 0x87,
+    0x83, 0x91, 0x00, 0x8c, 0x80, 0x95, 0x81, 0x93, 0x0e, 0x9b, 0x9f, 0x9f,
+    0xa4, 0xa7, 0xa6, 0xac, 0xac, 0xa6, 0xa6, 0xac, 0xb4, 0xae, 0xae, 0xb4,
+    0x80, 0xb8, 0x14, 0xc2, 0xc5, 0xce, 0xce, 0xd5, 0xd5, 0xce, 0xc5, 0xae,
+    0x8c, 0x71, 0x4d, 0x35, 0x2a, 0x2e, 0x2e, 0x30, 0x35, 0x35, 0x30, 0x2e,
+    0x80, 0x21, 0x07, 0x2c, 0x41, 0x6c, 0x82, 0x91, 0x91, 0x82, 0x82, 0x80,
+    0x7a, 0x03, 0x71, 0x6e, 0x71, 0x68, 0x82, 0x71, 0x0e, 0x68, 0x6e, 0x73,
+    0x77, 0x7e, 0x7e, 0x80, 0x82, 0x7e, 0x82, 0x80, 0x80, 0x82, 0x87, 0x87,
+    0x80, 0x80, 0x04, 0x87, 0x87, 0x91, 0x91, 0x87, 0x83, 0x91, 0x05, 0x8c,
+    0x91, 0x8c, 0x8c, 0x91, 0x8c, 0x82, 0x91, 0x0e, 0x8c, 0x8c, 0x91, 0x91,
+    0x8c, 0x91, 0x8a, 0x91, 0x8a, 0x91, 0x91, 0x8a, 0x8c, 0x8a, 0x8a, 0x82,
+    0x87, 0x01, 0x83, 0x87, 0x81, 0x83, 0x02, 0x87, 0x87, 0x83, 0x81, 0x7e,
+    0x07, 0x77, 0x77, 0x7a, 0x7a, 0x73, 0x7d, 0x7d, 0x73, 0x81, 0x75, 0x04,
+    0x6e, 0x68, 0x68, 0x70, 0x70, 0x81, 0x75, 0x27, 0x73, 0x7d, 0x85, 0x83,
+    0x91, 0x8a, 0x9b, 0x9f, 0xa7, 0xa7, 0xaf, 0xaf, 0xb4, 0xaf, 0xa7, 0xa7,
+    0x9b, 0x91, 0x82, 0x7d, 0x74, 0x6c, 0x63, 0x5d, 0x55, 0x49, 0x49, 0x42,
+    0x42, 0x37, 0x33, 0x33, 0x2e, 0x25, 0x25, 0x21, 0x1a, 0x15, 0x0d, 0x0d,
+    0x80, 0x07, 0x01, 0x02, 0x06, 0x80, 0x02, 0x24, 0x06, 0x0f, 0x10, 0x15,
+    0x21, 0x25, 0x2f, 0x35, 0x42, 0x49, 0x55, 0x63, 0x66, 0x6b, 0x71, 0x68,
+    0x68, 0x6e, 0x6e, 0x75, 0x70, 0x68, 0x68, 0x6b, 0x60, 0x60, 0x59, 0x00,
+    0x00, 0x06, 0x0f, 0x10, 0x17, 0x1f, 0x21, 0x27, 0x2e, 0x80, 0x2a, 0x05,
+    0x2e, 0x33, 0x30, 0x33, 0x37, 0x35, 0x81, 0x42, 0x05, 0x44, 0x44, 0x48,
+    0x49, 0x4e, 0x4e, 0x80, 0x51, 0x05, 0x58, 0x58, 0x63, 0x5f, 0x5f, 0x63,
+    0x81, 0x66, 0x80, 0x6b, 0x02, 0x60, 0x68, 0x6b, 0x80, 0x70, 0x81, 0x75,
+    0x0e, 0x73, 0x75, 0x7d, 0x73, 0x7a, 0x77, 0x77, 0x82, 0x7e, 0x85, 0x7e,
+    0x7e, 0x87, 0x87, 0x83, 0x85, 0x87, 0x07, 0x91, 0x8c, 0x91, 0x91, 0x8c,
+    0x8c, 0x95, 0x93, 0x82, 0x9b, 0x80, 0x9f, 0x05, 0x9e, 0xa6, 0xac, 0xa7,
+    0xa6, 0xa6, 0x82, 0xaa, 0x80, 0xb8, 0x21, 0xc2, 0xc5, 0xc5, 0xce, 0xd5,
+    0xd5, 0xce, 0xc2, 0xae, 0x8c, 0x71, 0x4d, 0x35, 0x2a, 0x2e, 0x30, 0x35,
+    0x35, 0x30, 0x2e, 0x21, 0x1d, 0x1f, 0x2c, 0x41, 0x59, 0x7a, 0x87, 0x82,
+    0x82, 0x7a, 0x7a, 0x71, 0x71, 0x80, 0x68, 0x0b, 0x64, 0x60, 0x64, 0x60,
+    0x60, 0x64, 0x68, 0x71, 0x73, 0x73, 0x7a, 0x77, 0x81, 0x7e, 0x05, 0x82,
+    0x82, 0x87, 0x87, 0x83, 0x80, 0x85, 0x87, 0x00, 0x8a, 0x82, 0x91, 0x0a,
+    0x8a, 0x91, 0x8a, 0x91, 0x80, 0x8c, 0x8a, 0x8a, 0x91, 0x8c, 0x91, 0x81,
+    0x8c, 0x81, 0x91, 0x01, 0x8a, 0x8c, 0x81, 0x8a, 0x80, 0x87, 0x00, 0x83,
+    0x80, 0x87, 0x04, 0x83, 0x83, 0x87, 0x83, 0x83, 0x83, 0x7e, 0x06, 0x7d,
+    0x77, 0x7d, 0x77, 0x73, 0x73, 0x75, 0x83, 0x6e, 0x0e, 0x75, 0x68, 0x70,
+    0x70, 0x6e, 0x75, 0x75, 0x73, 0x77, 0x7e, 0x83, 0x8a, 0x95, 0x9b, 0x9f,
+    0x82, 0xa7, 0x19, 0xac, 0x9f, 0x9b, 0x95, 0x87, 0x7d, 0x74, 0x6c, 0x63,
+    0x55, 0x55, 0x49, 0x42, 0x42, 0x35, 0x37, 0x33, 0x2f, 0x2a, 0x25, 0x25,
+    0x21, 0x1d, 0x15, 0x0d, 0x0d, 0x82, 0x07, 0x13, 0x0f, 0x0f, 0x07, 0x10,
+    0x15, 0x21, 0x27, 0x2f, 0x37, 0x43, 0x4d, 0x59, 0x64, 0x71, 0x7a, 0x82,
+    0x87, 0x91, 0x91, 0x95, 0x89, 0x9b, 0x0a, 0x00, 0x00, 0x01, 0x02, 0x0f,
+    0x10, 0x15, 0x1d, 0x21, 0x27, 0x2e, 0x81, 0x2a, 0x00, 0x2e, 0x81, 0x2f,
+    0x00, 0x35, 0x80, 0x42, 0x07, 0x49, 0x49, 0x48, 0x48, 0x4e, 0x4e, 0x51,
+    0x4d, 0x82, 0x58, 0x1f, 0x59, 0x56, 0x56, 0x66, 0x66, 0x6c, 0x66, 0x6b,
+    0x6b, 0x60, 0x60, 0x6b, 0x68, 0x68, 0x70, 0x75, 0x75, 0x6e, 0x6e, 0x75,
+    0x75, 0x73, 0x73, 0x7a, 0x7a, 0x77, 0x7e, 0x82, 0x82, 0x7e, 0x82, 0x82,
+    0x85, 0x87, 0x82, 0x91, 0x01, 0x95, 0x8c, 0x80, 0x95, 0x09, 0x9b, 0x93,
+    0x9b, 0x93, 0x9b, 0x9f, 0x9f, 0xa6, 0xa6, 0xa7, 0x80, 0xac, 0x00, 0xa6,
+    0x82, 0xaa, 0x1f, 0xb8, 0xbd, 0xb8, 0xc2, 0xc5, 0xc5, 0xce, 0xd5, 0xd5,
+    0xce, 0xc2, 0xae, 0x8c, 0x71, 0x4d, 0x37, 0x2b, 0x2e, 0x30, 0x35, 0x30,
+    0x2a, 0x21, 0x1d, 0x1f, 0x2c, 0x3a, 0x5d, 0x74, 0x82, 0x7a, 0x7a, 0x82,
+    0x71, 0x80, 0x60, 0x07, 0x66, 0x60, 0x64, 0x60, 0x64, 0x64, 0x71, 0x71,
+    0x80, 0x6e, 0x80, 0x77, 0x00, 0x7e, 0x82, 0x82, 0x83, 0x87, 0x01, 0x83,
+    0x80, 0x81, 0x87, 0x81, 0x91, 0x03, 0x87, 0x91, 0x87, 0x80, 0x81, 0x91,
+    0x14, 0x8a, 0x91, 0x80, 0x91, 0x80, 0x80, 0x91, 0x91, 0x80, 0x8c, 0x91,
+    0x8c, 0x8a, 0x87, 0x83, 0x83, 0x80, 0x83, 0x83, 0x87, 0x87, 0x80, 0x83,
+    0x02, 0x87, 0x87, 0x83, 0x84, 0x7e, 0x01, 0x77, 0x77, 0x80, 0x6e, 0x04,
+    0x7a, 0x75, 0x75, 0x6e, 0x6e, 0x81, 0x75, 0x0c, 0x70, 0x75, 0x75, 0x6e,
+    0x6e, 0x75, 0x7d, 0x7e, 0x7e, 0x83, 0x8a, 0x95, 0x9b, 0x82, 0x9f, 0x30,
+    0x9b, 0x9b, 0x91, 0x87, 0x82, 0x81, 0x6c, 0x63, 0x55, 0x55, 0x49, 0x42,
+    0x42, 0x37, 0x37, 0x31, 0x31, 0x2c, 0x27, 0x21, 0x21, 0x1d, 0x15, 0x10,
+    0x0d, 0x07, 0x07, 0x05, 0x07, 0x07, 0x0d, 0x15, 0x1f, 0x27, 0x2c, 0x37,
+    0x3b, 0x4d, 0x59, 0x6b, 0x7a, 0x82, 0x87, 0x95, 0x9b, 0x9f, 0xa7, 0xa7,
+    0xaa, 0x80, 0xaf, 0x02, 0xb4, 0xb4, 0xaf, 0x86, 0xbd, 0x80, 0x00, 0x08,
+    0x06, 0x06, 0x0f, 0x10, 0x1d, 0x1d, 0x21, 0x27, 0x25, 0x82, 0x2a, 0x80,
+    0x2f, 0x02, 0x35, 0x37, 0x35, 0x80, 0x42, 0x02, 0x44, 0x44, 0x48, 0x80,
+    0x4d, 0x01, 0x51, 0x51, 0x82, 0x58, 0x00, 0x56, 0x80, 0x5f, 0x81, 0x66,
+    0x07, 0x6b, 0x60, 0x68, 0x68, 0x74, 0x68, 0x71, 0x68, 0x81, 0x6e, 0x05,
+    0x7a, 0x73, 0x77, 0x77, 0x7e, 0x82, 0x80, 0x7e, 0x01, 0x82, 0x82, 0x85,
+    0x87, 0x83, 0x91, 0x81, 0x95, 0x0d, 0x9c, 0x93, 0x9b, 0x93, 0x9b, 0x9f,
+    0xa6, 0x9e, 0xa7, 0xa7, 0xac, 0xac, 0xa6, 0xa6, 0x81, 0xaa, 0x00, 0xb4,
+    0x80, 0xb8, 0x02, 0xc2, 0xc5, 0xc9, 0x81, 0xce, 0x13, 0xc5, 0xac, 0x87,
+    0x71, 0x43, 0x2f, 0x2e, 0x2b, 0x30, 0x30, 0x2e, 0x21, 0x1d, 0x15, 0x27,
+    0x31, 0x55, 0x6c, 0x7a, 0x7a, 0x80, 0x71, 0x0e, 0x64, 0x64, 0x60, 0x60,
+    0x66, 0x60, 0x64, 0x60, 0x64, 0x60, 0x66, 0x64, 0x64, 0x71, 0x68, 0x82,
+    0x6e, 0x02, 0x77, 0x7a, 0x80, 0x80, 0x82, 0x01, 0x7e, 0x7e, 0x81, 0x83,
+    0x0a, 0x87, 0x80, 0x80, 0x87, 0x80, 0x87, 0x80, 0x87, 0x87, 0x8a, 0x8a,
+    0x85, 0x87, 0x02, 0x80, 0x87, 0x87, 0x80, 0x80, 0x04, 0x91, 0x87, 0x80,
+    0x80, 0x91, 0x81, 0x80, 0x03, 0x87, 0x83, 0x87, 0x87, 0x82, 0x83, 0x84,
+    0x7e, 0x80, 0x77, 0x82, 0x6e, 0x00, 0x75, 0x80, 0x6e, 0x0f, 0x68, 0x68,
+    0x70, 0x70, 0x68, 0x75, 0x75, 0x6e, 0x75, 0x7d, 0x7d, 0x7e, 0x83, 0x8a,
+    0x91, 0x95, 0x81, 0x9b, 0x2d, 0x95, 0x95, 0x87, 0x87, 0x82, 0x81, 0x74,
+    0x66, 0x63, 0x55, 0x49, 0x49, 0x42, 0x37, 0x37, 0x2f, 0x2c, 0x2c, 0x27,
+    0x21, 0x1f, 0x15, 0x15, 0x17, 0x10, 0x10, 0x07, 0x10, 0x10, 0x15, 0x1a,
+    0x27, 0x2a, 0x35, 0x43, 0x4d, 0x64, 0x71, 0x82, 0x91, 0x9b, 0x9f, 0xa7,
+    0xae, 0xb4, 0xae, 0x82, 0xbd, 0x89, 0xc2, 0x80, 0xc9, 0x80, 0x00, 0x0a,
+    0x03, 0x06, 0x06, 0x0f, 0x10, 0x17, 0x1d, 0x21, 0x25, 0x27, 0x27, 0x80,
+    0x2a, 0x0d, 0x2c, 0x2a, 0x2e, 0x2f, 0x30, 0x30, 0x35, 0x42, 0x42, 0x3e,
+    0x44, 0x44, 0x48, 0x48, 0x80, 0x4d, 0x01, 0x51, 0x51, 0x80, 0x58, 0x04,
+    0x59, 0x58, 0x59, 0x5f, 0x5f, 0x81, 0x66, 0x00, 0x60, 0x80, 0x6b, 0x0d,
+    0x68, 0x71, 0x68, 0x68, 0x75, 0x75, 0x73, 0x7a, 0x73, 0x73, 0x7a, 0x7a,
+    0x82, 0x82, 0x81, 0x7e, 0x03, 0x82, 0x82, 0x83, 0x83, 0x83, 0x87, 0x81,
+    0x91, 0x0a, 0x8c, 0x95, 0x95, 0x93, 0x93, 0x9b, 0x9b, 0x9c, 0x9b, 0x9f,
+    0x93, 0x80, 0x9e, 0x01, 0xa7, 0xa7, 0x80, 0x9e, 0x01, 0xaa, 0xb4, 0x81,
+    0xaa, 0x05, 0xb8, 0xb8, 0xc2, 0xc2, 0xc5, 0xc9, 0x80, 0xce, 0x05, 0xb8,
+    0xac, 0x80, 0x64, 0x43, 0x35, 0x80, 0x2e, 0x07, 0x25, 0x21, 0x15, 0x15,
+    0x1f, 0x31, 0x42, 0x59, 0x80, 0x71, 0x80, 0x64, 0x80, 0x60, 0x05, 0x56,
+    0x64, 0x59, 0x64, 0x56, 0x56, 0x80, 0x60, 0x02, 0x64, 0x68, 0x68, 0x82,
+    0x6e, 0x80, 0x77, 0x81, 0x7e, 0x0e, 0x82, 0x82, 0x83, 0x83, 0x87, 0x87,
+    0x80, 0x80, 0x83, 0x80, 0x80, 0x87, 0x83, 0x87, 0x83, 0x80, 0x87, 0x01,
+    0x83, 0x80, 0x83, 0x87, 0x07, 0x83, 0x80, 0x87, 0x80, 0x87, 0x80, 0x87,
+    0x87, 0x81, 0x80, 0x84, 0x83, 0x81, 0x7e, 0x00, 0x85, 0x80, 0x7e, 0x80,
+    0x77, 0x86, 0x6e, 0x3b, 0x75, 0x75, 0x70, 0x70, 0x68, 0x68, 0x70, 0x75,
+    0x6e, 0x73, 0x77, 0x7e, 0x7e, 0x83, 0x8a, 0x91, 0x91, 0x95, 0x95, 0x91,
+    0x91, 0x87, 0x89, 0x7a, 0x75, 0x75, 0x6b, 0x5f, 0x58, 0x55, 0x49, 0x42,
+    0x42, 0x37, 0x33, 0x2a, 0x2c, 0x27, 0x1f, 0x1d, 0x15, 0x17, 0x17, 0x10,
+    0x10, 0x0d, 0x0d, 0x15, 0x21, 0x2a, 0x2f, 0x3b, 0x4d, 0x64, 0x7a, 0x87,
+    0x95, 0x9f, 0xa7, 0xae, 0x80, 0xbd, 0x80, 0xc2, 0x87, 0xc9, 0x00, 0xce,
+    0x87, 0xc9, 0x80, 0x00, 0x11, 0x03, 0x03, 0x06, 0x06, 0x0f, 0x10, 0x1d,
+    0x1d, 0x21, 0x21, 0x27, 0x27, 0x25, 0x25, 0x2c, 0x2c, 0x2a, 0x2a, 0x80,
+    0x2f, 0x07, 0x35, 0x35, 0x42, 0x42, 0x43, 0x44, 0x48, 0x48, 0x80, 0x4d,
+    0x02, 0x46, 0x51, 0x51, 0x80, 0x58, 0x01, 0x59, 0x58, 0x80, 0x5f, 0x01,
+    0x66, 0x66, 0x81, 0x60, 0x81, 0x68, 0x01, 0x75, 0x75, 0x81, 0x6e, 0x0c,
+    0x7a, 0x77, 0x77, 0x82, 0x7e, 0x7e, 0x82, 0x7e, 0x7e, 0x82, 0x82, 0x87,
+    0x82, 0x81, 0x87, 0x00, 0x80, 0x80, 0x91, 0x05, 0x8c, 0x8c, 0x95, 0x95,
+    0x93, 0x93, 0x82, 0x9b, 0x02, 0x9c, 0x9f, 0x9f, 0x84, 0x9e, 0x0a, 0xac,
+    0xa6, 0xae, 0xae, 0xb4, 0xae, 0xb8, 0xb8, 0xc2, 0xc5, 0xc5, 0x81, 0xce,
+    0x10, 0xb8, 0xac, 0x87, 0x64, 0x43, 0x30, 0x2e, 0x2e, 0x21, 0x1d, 0x15,
+    0x17, 0x17, 0x27, 0x37, 0x50, 0x59, 0x82, 0x64, 0x0a, 0x59, 0x56, 0x56,
+    0x59, 0x59, 0x56, 0x59, 0x56, 0x5f, 0x56, 0x64, 0x80, 0x60, 0x80, 0x68,
+    0x02, 0x6e, 0x6e, 0x75, 0x80, 0x6e, 0x07, 0x77, 0x77, 0x82, 0x85, 0x7e,
+    0x82, 0x7e, 0x82, 0x81, 0x83, 0x80, 0x87, 0x0d, 0x83, 0x87, 0x87, 0x83,
+    0x87, 0x87, 0x83, 0x83, 0x87, 0x87, 0x80, 0x80, 0x87, 0x87, 0x80, 0x83,
+    0x82, 0x87, 0x00, 0x83, 0x81, 0x87, 0x83, 0x83, 0x80, 0x7e, 0x02, 0x82,
+    0x7e, 0x7e, 0x81, 0x77, 0x84, 0x6e, 0x03, 0x75, 0x75, 0x6e, 0x75, 0x80,
+    0x68, 0x02, 0x70, 0x68, 0x75, 0x81, 0x6e, 0x01, 0x77, 0x7e, 0x80, 0x83,
+    0x81, 0x87, 0x12, 0x82, 0x7a, 0x81, 0x74, 0x64, 0x6c, 0x63, 0x5d, 0x55,
+    0x49, 0x49, 0x42, 0x35, 0x33, 0x2a, 0x2e, 0x27, 0x1f, 0x1d, 0x80, 0x17,
+    0x12, 0x10, 0x10, 0x15, 0x15, 0x21, 0x2a, 0x37, 0x43, 0x59, 0x68, 0x82,
+    0x91, 0x9f, 0xac, 0xb4, 0xb8, 0xb8, 0xc2, 0xc2, 0x81, 0xc9, 0x80, 0xce,
+    0x01, 0xc9, 0xce, 0x81, 0xc9, 0x8b, 0xc2, 0x83, 0x00, 0x18, 0x02, 0x06,
+    0x0f, 0x10, 0x17, 0x15, 0x21, 0x27, 0x25, 0x27, 0x25, 0x27, 0x27, 0x2c,
+    0x2e, 0x2a, 0x2e, 0x33, 0x33, 0x37, 0x35, 0x42, 0x3b, 0x49, 0x44, 0x80,
+    0x48, 0x05, 0x4e, 0x46, 0x4d, 0x46, 0x51, 0x51, 0x80, 0x58, 0x00, 0x59,
+    0x80, 0x5f, 0x03, 0x66, 0x64, 0x60, 0x60, 0x80, 0x6b, 0x0e, 0x70, 0x71,
+    0x74, 0x74, 0x6e, 0x71, 0x7a, 0x7a, 0x73, 0x73, 0x77, 0x7a, 0x77, 0x7e,
+    0x7e, 0x83, 0x82, 0x81, 0x87, 0x05, 0x80, 0x91, 0x91, 0x8c, 0x91, 0x8c,
+    0x82, 0x95, 0x81, 0x9b, 0x06, 0x9c, 0x9f, 0x9c, 0x9e, 0x9e, 0xa7, 0xac,
+    0x80, 0xa7, 0x80, 0x9e, 0x80, 0xaa, 0x81, 0xb8, 0x01, 0xc2, 0xc5, 0x80,
+    0xce, 0x12, 0xc5, 0xb8, 0xa6, 0x80, 0x64, 0x43, 0x2f, 0x27, 0x1f, 0x17,
+    0x10, 0x10, 0x17, 0x1f, 0x31, 0x41, 0x4d, 0x59, 0x64, 0x81, 0x59, 0x0a,
+    0x4f, 0x4f, 0x58, 0x4f, 0x4f, 0x59, 0x59, 0x4f, 0x56, 0x59, 0x59, 0x81,
+    0x64, 0x02, 0x68, 0x68, 0x71, 0x80, 0x6e, 0x0f, 0x7d, 0x7d, 0x73, 0x77,
+    0x7d, 0x77, 0x82, 0x82, 0x7e, 0x82, 0x82, 0x7e, 0x7e, 0x82, 0x82, 0x87,
+    0x80, 0x83, 0x02, 0x87, 0x83, 0x83, 0x81, 0x87, 0x03, 0x83, 0x80, 0x80,
+    0x87, 0x80, 0x83, 0x05, 0x87, 0x87, 0x83, 0x83, 0x87, 0x80, 0x85, 0x83,
+    0x80, 0x7e, 0x03, 0x82, 0x7e, 0x7e, 0x7d, 0x80, 0x77, 0x85, 0x6e, 0x01,
+    0x75, 0x75, 0x80, 0x6e, 0x04, 0x68, 0x70, 0x68, 0x68, 0x6e, 0x80, 0x75,
+    0x05, 0x7d, 0x77, 0x7e, 0x85, 0x7e, 0x7e, 0x81, 0x82, 0x13, 0x7a, 0x81,
+    0x74, 0x64, 0x59, 0x5d, 0x5d, 0x55, 0x55, 0x49, 0x42, 0x35, 0x35, 0x2e,
+    0x2a, 0x27, 0x1f, 0x1d, 0x1d, 0x17, 0x80, 0x10, 0x15, 0x15, 0x1f, 0x27,
+    0x2f, 0x3b, 0x5d, 0x71, 0x82, 0x95, 0xac, 0xb4, 0xbd, 0xb8, 0xc2, 0xc5,
+    0xce, 0xc9, 0xce, 0xce, 0xc9, 0xc9, 0xce, 0x80, 0xc9, 0x82, 0xc2, 0x84,
+    0xbd, 0x01, 0xb8, 0xb8, 0x84, 0xbd, 0x81, 0x00, 0x09, 0x01, 0x00, 0x01,
+    0x06, 0x06, 0x0f, 0x0f, 0x17, 0x1d, 0x21, 0x84, 0x27, 0x09, 0x2c, 0x2c,
+    0x2a, 0x2f, 0x33, 0x37, 0x35, 0x42, 0x3b, 0x3e, 0x80, 0x44, 0x01, 0x49,
+    0x55, 0x80, 0x4d, 0x0c, 0x51, 0x51, 0x58, 0x58, 0x5d, 0x58, 0x56, 0x5f,
+    0x5f, 0x56, 0x64, 0x66, 0x66, 0x81, 0x6b, 0x02, 0x70, 0x71, 0x74, 0x81,
+    0x6e, 0x06, 0x7d, 0x7d, 0x77, 0x7a, 0x82, 0x82, 0x7e, 0x80, 0x82, 0x02,
+    0x80, 0x82, 0x82, 0x82, 0x87, 0x00, 0x91, 0x80, 0x8c, 0x00, 0x91, 0x82,
+    0x95, 0x01, 0x9b, 0x9b, 0x82, 0x93, 0x09, 0x9f, 0x9e, 0xa7, 0xa7, 0x9e,
+    0x9e, 0xa7, 0xa7, 0x9e, 0xaf, 0x81, 0xaa, 0x80, 0xb8, 0x01, 0xc2, 0xc5,
+    0x80, 0xce, 0x25, 0xc5, 0xb8, 0xa6, 0x82, 0x59, 0x3b, 0x2a, 0x1d, 0x17,
+    0x10, 0x0f, 0x0f, 0x17, 0x27, 0x31, 0x47, 0x4d, 0x59, 0x59, 0x5d, 0x59,
+    0x5d, 0x4f, 0x59, 0x58, 0x59, 0x4d, 0x4f, 0x4f, 0x58, 0x4f, 0x59, 0x56,
+    0x5f, 0x56, 0x60, 0x60, 0x64, 0x80, 0x68, 0x00, 0x71, 0x80, 0x6e, 0x05,
+    0x7a, 0x73, 0x73, 0x77, 0x77, 0x7a, 0x80, 0x82, 0x02, 0x80, 0x7e, 0x82,
+    0x81, 0x7e, 0x07, 0x83, 0x83, 0x82, 0x83, 0x83, 0x87, 0x87, 0x83, 0x80,
+    0x87, 0x80, 0x83, 0x02, 0x87, 0x83, 0x87, 0x81, 0x83, 0x05, 0x87, 0x83,
+    0x83, 0x7e, 0x7e, 0x83, 0x82, 0x7e, 0x06, 0x82, 0x7e, 0x7e, 0x77, 0x77,
+    0x73, 0x7a, 0x82, 0x6e, 0x00, 0x75, 0x81, 0x6e, 0x06, 0x75, 0x6e, 0x75,
+    0x68, 0x75, 0x70, 0x68, 0x82, 0x6e, 0x1a, 0x77, 0x77, 0x7e, 0x7d, 0x77,
+    0x7d, 0x7a, 0x7a, 0x71, 0x71, 0x6c, 0x6c, 0x5d, 0x55, 0x49, 0x49, 0x42,
+    0x3b, 0x35, 0x30, 0x2f, 0x2c, 0x27, 0x1f, 0x1d, 0x15, 0x15, 0x80, 0x10,
+    0x0d, 0x15, 0x1f, 0x2c, 0x37, 0x4d, 0x64, 0x7a, 0x95, 0xac, 0xb4, 0xb8,
+    0xc2, 0xc2, 0xc9, 0x81, 0xce, 0x80, 0xc9, 0x81, 0xc2, 0x00, 0xbd, 0x81,
+    0xb8, 0x04, 0xbd, 0xb8, 0xb4, 0xb4, 0xae, 0x81, 0xb4, 0x00, 0xae, 0x81,
+    0xaf, 0x03, 0xb4, 0xaf, 0xae, 0xaf, 0x82, 0x00, 0x80, 0x01, 0x07, 0x06,
+    0x06, 0x0f, 0x10, 0x17, 0x15, 0x1d, 0x21, 0x81, 0x27, 0x0c, 0x25, 0x25,
+    0x2c, 0x2a, 0x2c, 0x2e, 0x2f, 0x37, 0x37, 0x35, 0x42, 0x3e, 0x3e, 0x80,
+    0x49, 0x00, 0x48, 0x80, 0x4d, 0x01, 0x51, 0x51, 0x80, 0x58, 0x04, 0x4f,
+    0x4f, 0x56, 0x5f, 0x5f, 0x80, 0x66, 0x81, 0x6b, 0x03, 0x70, 0x74, 0x70,
+    0x6e, 0x80, 0x75, 0x02, 0x81, 0x73, 0x77, 0x80, 0x7a, 0x84, 0x82, 0x82,
+    0x87, 0x04, 0x91, 0x91, 0x8c, 0x91, 0x91, 0x82, 0x95, 0x00, 0x9b, 0x80,
+    0x93, 0x04, 0x9b, 0x9b, 0x9f, 0x9e, 0x9f, 0x84, 0x9e, 0x81, 0xaa, 0x05,
+    0xb4, 0xb8, 0xbd, 0xb8, 0xc2, 0xc2, 0x80, 0xce, 0x07, 0xc5, 0xb8, 0x9c,
+    0x7a, 0x4d, 0x2f, 0x1f, 0x10, 0x80, 0x0f, 0x0c, 0x10, 0x1f, 0x2c, 0x37,
+    0x47, 0x4d, 0x55, 0x55, 0x4d, 0x4d, 0x46, 0x51, 0x46, 0x81, 0x51, 0x0e,
+    0x4d, 0x4d, 0x59, 0x4f, 0x5f, 0x5f, 0x66, 0x64, 0x64, 0x60, 0x60, 0x68,
+    0x68, 0x71, 0x71, 0x80, 0x6e, 0x00, 0x7a, 0x80, 0x6e, 0x03, 0x77, 0x77,
+    0x7d, 0x77, 0x80, 0x7e, 0x02, 0x82, 0x7e, 0x7e, 0x81, 0x82, 0x80, 0x7e,
+    0x08, 0x83, 0x83, 0x82, 0x82, 0x83, 0x82, 0x7e, 0x83, 0x83, 0x81, 0x7e,
+    0x00, 0x82, 0x87, 0x7e, 0x81, 0x77, 0x81, 0x6e, 0x01, 0x7d, 0x7d, 0x83,
+    0x6e, 0x0a, 0x75, 0x75, 0x68, 0x6e, 0x75, 0x70, 0x70, 0x68, 0x75, 0x6e,
+    0x75, 0x80, 0x6e, 0x17, 0x7a, 0x7d, 0x7a, 0x75, 0x74, 0x71, 0x71, 0x6c,
+    0x6c, 0x64, 0x63, 0x5d, 0x55, 0x49, 0x42, 0x35, 0x30, 0x2f, 0x2a, 0x27,
+    0x21, 0x1f, 0x15, 0x15, 0x81, 0x10, 0x0c, 0x17, 0x1f, 0x2a, 0x42, 0x4d,
+    0x71, 0x87, 0x9b, 0xb4, 0xb8, 0xbd, 0xc2, 0xc9, 0x81, 0xce, 0x01, 0xc9,
+    0xc9, 0x80, 0xc2, 0x0f, 0xbd, 0xbd, 0xb8, 0xb8, 0xbd, 0xb4, 0xae, 0xae,
+    0xaf, 0xaa, 0xaf, 0xb4, 0xaf, 0xb4, 0xaf, 0xaf, 0x81, 0xa7, 0x07, 0x9e,
+    0xa7, 0x9e, 0x9e, 0xa7, 0x9e, 0xa7, 0x9e, 0x83, 0x00, 0x0d, 0x01, 0x00,
+    0x01, 0x02, 0x06, 0x0f, 0x0f, 0x17, 0x15, 0x1f, 0x1f, 0x21, 0x27, 0x25,
+    0x81, 0x27, 0x06, 0x2a, 0x2a, 0x2e, 0x2f, 0x2f, 0x37, 0x35, 0x81, 0x42,
+    0x07, 0x44, 0x49, 0x48, 0x48, 0x4e, 0x4e, 0x51, 0x51, 0x80, 0x58, 0x04,
+    0x4f, 0x59, 0x56, 0x5f, 0x5f, 0x81, 0x66, 0x02, 0x64, 0x6b, 0x6b, 0x81,
+    0x74, 0x03, 0x6e, 0x71, 0x75, 0x73, 0x82, 0x7a, 0x00, 0x77, 0x82, 0x82,
+    0x82, 0x87, 0x81, 0x91, 0x00, 0x8c, 0x80, 0x95, 0x01, 0x8c, 0x95, 0x83,
+    0x9b, 0x80, 0x93, 0x02, 0xa6, 0x9e, 0xa7, 0x80, 0x9e, 0x01, 0xa7, 0xa6,
+    0x82, 0xaa, 0x04, 0xb8, 0xb8, 0xbd, 0xc2, 0xc2, 0x80, 0xce, 0x14, 0xc2,
+    0xb4, 0x9c, 0x71, 0x43, 0x27, 0x10, 0x0f, 0x06, 0x06, 0x0f, 0x17, 0x1f,
+    0x2c, 0x37, 0x47, 0x4d, 0x55, 0x4d, 0x4d, 0x55, 0x84, 0x4d, 0x04, 0x55,
+    0x51, 0x4f, 0x59, 0x58, 0x80, 0x56, 0x09, 0x60, 0x60, 0x6b, 0x68, 0x68,
+    0x71, 0x71, 0x68, 0x6e, 0x71, 0x80, 0x6e, 0x02, 0x7a, 0x73, 0x73, 0x80,
+    0x77, 0x03, 0x7e, 0x7e, 0x82, 0x82, 0x82, 0x7e, 0x00, 0x82, 0x80, 0x7e,
+    0x01, 0x82, 0x82, 0x86, 0x7e, 0x00, 0x82, 0x84, 0x7e, 0x00, 0x7d, 0x83,
+    0x77, 0x87, 0x6e, 0x01, 0x75, 0x6e, 0x83, 0x75, 0x1d, 0x70, 0x75, 0x6e,
+    0x6e, 0x75, 0x75, 0x73, 0x7d, 0x81, 0x81, 0x71, 0x71, 0x64, 0x6c, 0x63,
+    0x63, 0x59, 0x5d, 0x55, 0x49, 0x42, 0x35, 0x30, 0x2b, 0x2e, 0x25, 0x21,
+    0x1d, 0x15, 0x17, 0x81, 0x10, 0x0b, 0x15, 0x1f, 0x2a, 0x41, 0x59, 0x7a,
+    0x91, 0xac, 0xb4, 0xb8, 0xc5, 0xc5, 0x82, 0xce, 0x01, 0xc2, 0xc2, 0x80,
+    0xbd, 0x00, 0xb8, 0x80, 0xb4, 0x05, 0xaf, 0xb4, 0xaf, 0xaf, 0xae, 0xaf,
+    0x89, 0xa7, 0x03, 0x9e, 0xa7, 0xa7, 0x9e, 0x81, 0xa7, 0x01, 0x00, 0x01,
+    0x83, 0x00, 0x0d, 0x01, 0x01, 0x06, 0x06, 0x0f, 0x0f, 0x10, 0x17, 0x1f,
+    0x1f, 0x21, 0x27, 0x27, 0x25, 0x80, 0x27, 0x80, 0x2a, 0x04, 0x2e, 0x2f,
+    0x30, 0x35, 0x35, 0x80, 0x42, 0x80, 0x49, 0x08, 0x48, 0x4e, 0x4e, 0x51,
+    0x51, 0x4d, 0x4f, 0x5d, 0x59, 0x82, 0x5f, 0x11, 0x66, 0x60, 0x64, 0x6b,
+    0x68, 0x68, 0x71, 0x70, 0x70, 0x6e, 0x71, 0x75, 0x75, 0x7a, 0x7d, 0x73,
+    0x7d, 0x77, 0x80, 0x7a, 0x03, 0x82, 0x80, 0x82, 0x82, 0x82, 0x87, 0x04,
+    0x91, 0x8c, 0x8c, 0x91, 0x91, 0x84, 0x95, 0x82, 0x93, 0x03, 0x9f, 0x93,
+    0x93, 0x9f, 0x81, 0x9e, 0x02, 0xac, 0xa6, 0xa6, 0x81, 0xaa, 0x00, 0xb4,
+    0x80, 0xb8, 0x00, 0xc2, 0x80, 0xce, 0x06, 0xb8, 0xa6, 0x87, 0x5d, 0x2f,
+    0x15, 0x0f, 0x80, 0x06, 0x04, 0x0f, 0x15, 0x1f, 0x31, 0x37, 0x82, 0x43,
+    0x04, 0x40, 0x49, 0x43, 0x49, 0x49, 0x80, 0x4d, 0x10, 0x51, 0x51, 0x4f,
+    0x58, 0x4f, 0x5f, 0x5f, 0x56, 0x60, 0x60, 0x64, 0x60, 0x68, 0x68, 0x70,
+    0x68, 0x68, 0x81, 0x6e, 0x00, 0x7a, 0x80, 0x6e, 0x80, 0x77, 0x00, 0x7a,
+    0x81, 0x77, 0x05, 0x7e, 0x7e, 0x77, 0x7e, 0x7e, 0x82, 0x80, 0x7e, 0x01,
+    0x82, 0x82, 0x89, 0x7e, 0x81, 0x77, 0x82, 0x6e, 0x00, 0x7d, 0x83, 0x6e,
+    0x0c, 0x75, 0x75, 0x6e, 0x6e, 0x75, 0x75, 0x6e, 0x6e, 0x75, 0x6e, 0x6e,
+    0x75, 0x75, 0x81, 0x6e, 0x24, 0x75, 0x7a, 0x74, 0x74, 0x71, 0x64, 0x64,
+    0x5d, 0x5d, 0x55, 0x49, 0x49, 0x42, 0x35, 0x30, 0x2a, 0x25, 0x25, 0x21,
+    0x1a, 0x15, 0x10, 0x10, 0x0f, 0x0f, 0x07, 0x0d, 0x1f, 0x2c, 0x41, 0x59,
+    0x7a, 0x95, 0xac, 0xae, 0xb8, 0xc2, 0x80, 0xce, 0x01, 0xc9, 0xc9, 0x80,
+    0xc2, 0x80, 0xb8, 0x81, 0xaa, 0x02, 0xaf, 0xaf, 0xaa, 0x82, 0xa7, 0x00,
+    0x9e, 0x80, 0xa7, 0x85, 0x9f, 0x01, 0x9e, 0x9e, 0x83, 0x9f, 0x01, 0x01,
+    0x03, 0x84, 0x00, 0x0b, 0x01, 0x01, 0x06, 0x06, 0x0f, 0x0f, 0x14, 0x17,
+    0x15, 0x1f, 0x21, 0x21, 0x82, 0x27, 0x0e, 0x2c, 0x2c, 0x2a, 0x2a, 0x2f,
+    0x2f, 0x35, 0x35, 0x3b, 0x42, 0x3e, 0x49, 0x44, 0x49, 0x49, 0x82, 0x4d,
+    0x01, 0x55, 0x5d, 0x80, 0x58, 0x80, 0x5f, 0x08, 0x56, 0x60, 0x60, 0x6b,
+    0x68, 0x64, 0x71, 0x70, 0x68, 0x81, 0x6e, 0x07, 0x7a, 0x73, 0x7d, 0x7a,
+    0x7a, 0x7d, 0x7a, 0x7a, 0x80, 0x82, 0x83, 0x87, 0x01, 0x91, 0x91, 0x81,
+    0x8c, 0x02, 0x95, 0x91, 0x8c, 0x80, 0x95, 0x03, 0x93, 0x95, 0x9b, 0x93,
+    0x80, 0x9b, 0x05, 0x93, 0x9f, 0x93, 0xa6, 0xa7, 0xac, 0x82, 0x9e, 0x80,
+    0xaa, 0x80, 0xb8, 0x13, 0xc2, 0xc5, 0xce, 0xc5, 0xbd, 0x9b, 0x71, 0x3b,
+    0x21, 0x07, 0x02, 0x01, 0x01, 0x02, 0x10, 0x15, 0x27, 0x2f, 0x41, 0x42,
+    0x80, 0x43, 0x15, 0x40, 0x44, 0x49, 0x44, 0x49, 0x43, 0x49, 0x48, 0x4e,
+    0x46, 0x4d, 0x4f, 0x58, 0x59, 0x59, 0x56, 0x56, 0x60, 0x60, 0x64, 0x60,
+    0x60, 0x82, 0x68, 0x04, 0x71, 0x71, 0x7a, 0x6e, 0x7a, 0x83, 0x6e, 0x04,
+    0x7a, 0x7a, 0x73, 0x77, 0x73, 0x82, 0x77, 0x81, 0x7a, 0x01, 0x77, 0x82,
+    0x81, 0x77, 0x01, 0x7a, 0x7a, 0x81, 0x77, 0x02, 0x7d, 0x7d, 0x77, 0x81,
+    0x6e, 0x02, 0x7a, 0x75, 0x75, 0x81, 0x6e, 0x02, 0x75, 0x6e, 0x75, 0x89,
+    0x6e, 0x26, 0x75, 0x73, 0x71, 0x6e, 0x6e, 0x71, 0x74, 0x6b, 0x6c, 0x63,
+    0x5d, 0x55, 0x49, 0x42, 0x42, 0x35, 0x2f, 0x2b, 0x25, 0x25, 0x1a, 0x15,
+    0x0d, 0x10, 0x07, 0x0f, 0x05, 0x0f, 0x10, 0x15, 0x27, 0x37, 0x4d, 0x7a,
+    0x95, 0xac, 0xb4, 0xc2, 0xc5, 0x81, 0xce, 0x05, 0xc5, 0xc2, 0xc2, 0xb8,
+    0xbd, 0xbd, 0x80, 0xaa, 0x01, 0xaf, 0xaa, 0x82, 0x9e, 0x01, 0xa7, 0xa7,
+    0x84, 0x9f, 0x8d, 0x9b, 0x01, 0x03, 0x01, 0x85, 0x00, 0x0b, 0x01, 0x01,
+    0x06, 0x02, 0x02, 0x0f, 0x0f, 0x17, 0x15, 0x1d, 0x21, 0x21, 0x81, 0x27,
+    0x01, 0x25, 0x25, 0x81, 0x2a, 0x00, 0x2f, 0x80, 0x35, 0x80, 0x42, 0x04,
+    0x49, 0x43, 0x43, 0x55, 0x40, 0x80, 0x4d, 0x00, 0x55, 0x81, 0x58, 0x03,
+    0x5f, 0x5f, 0x56, 0x64, 0x80, 0x60, 0x05, 0x64, 0x64, 0x68, 0x70, 0x70,
+    0x68, 0x80, 0x71, 0x04, 0x6e, 0x6e, 0x7a, 0x7a, 0x7d, 0x80, 0x7a, 0x81,
+    0x82, 0x06, 0x87, 0x83, 0x87, 0x87, 0x91, 0x91, 0x8c, 0x81, 0x91, 0x80,
+    0x8c, 0x82, 0x95, 0x01, 0x93, 0x93, 0x82, 0x9b, 0x03, 0x9f, 0x9e, 0x9f,
+    0xa7, 0x80, 0x9e, 0x02, 0xa7, 0xa6, 0xa6, 0x80, 0xaa, 0x17, 0xbd, 0xb8,
+    0xc2, 0xc5, 0xc5, 0xb8, 0xa6, 0x87, 0x4d, 0x2a, 0x10, 0x02, 0x01, 0x01,
+    0x02, 0x0f, 0x10, 0x1f, 0x27, 0x2f, 0x37, 0x42, 0x3b, 0x42, 0x80, 0x3b,
+    0x05, 0x42, 0x43, 0x49, 0x43, 0x40, 0x40, 0x80, 0x4d, 0x06, 0x46, 0x4f,
+    0x59, 0x58, 0x5f, 0x56, 0x56, 0x82, 0x60, 0x81, 0x68, 0x01, 0x71, 0x71,
+    0x82, 0x6e, 0x80, 0x7a, 0x02, 0x73, 0x7a, 0x7a, 0x84, 0x6e, 0x80, 0x77,
+    0x01, 0x7a, 0x73, 0x83, 0x7a, 0x0e, 0x73, 0x73, 0x7d, 0x73, 0x73, 0x7d,
+    0x73, 0x7d, 0x73, 0x7d, 0x7a, 0x75, 0x73, 0x75, 0x75, 0x83, 0x6e, 0x01,
+    0x75, 0x75, 0x8a, 0x6e, 0x14, 0x71, 0x68, 0x70, 0x6c, 0x64, 0x63, 0x5d,
+    0x55, 0x49, 0x42, 0x35, 0x30, 0x30, 0x2b, 0x25, 0x25, 0x1a, 0x15, 0x0d,
+    0x0d, 0x07, 0x80, 0x06, 0x0a, 0x0f, 0x10, 0x1f, 0x31, 0x43, 0x64, 0x87,
+    0xac, 0xae, 0xbd, 0xc5, 0x81, 0xce, 0x04, 0xc5, 0xc2, 0xb8, 0xb8, 0xb4,
+    0x82, 0xaa, 0x02, 0x9e, 0xa7, 0xa7, 0x82, 0x9e, 0x01, 0x9f, 0x9f, 0x86,
+    0x9b, 0x83, 0x95, 0x00, 0x8a, 0x80, 0x95, 0x00, 0x8a, 0x80, 0x95, 0x03,
+    0x01, 0x01, 0x03, 0x01, 0x84, 0x00, 0x0d, 0x01, 0x01, 0x03, 0x02, 0x06,
+    0x0f, 0x10, 0x10, 0x1d, 0x1d, 0x21, 0x21, 0x27, 0x27, 0x82, 0x25, 0x02,
+    0x2c, 0x2a, 0x2a, 0x80, 0x2f, 0x03, 0x35, 0x35, 0x42, 0x42, 0x80, 0x49,
+    0x05, 0x43, 0x48, 0x4e, 0x46, 0x4d, 0x51, 0x81, 0x58, 0x16, 0x56, 0x5f,
+    0x5f, 0x64, 0x66, 0x66, 0x6b, 0x6c, 0x64, 0x70, 0x68, 0x68, 0x70, 0x71,
+    0x71, 0x6e, 0x75, 0x71, 0x7a, 0x73, 0x73, 0x7d, 0x77, 0x80, 0x82, 0x01,
+    0x80, 0x82, 0x83, 0x87, 0x02, 0x91, 0x8c, 0x86, 0x80, 0x8c, 0x01, 0x91,
+    0x8c, 0x84, 0x95, 0x01, 0x93, 0x93, 0x80, 0x9b, 0x05, 0x9f, 0x9f, 0x9e,
+    0xa7, 0x9e, 0xa6, 0x80, 0xa7, 0x00, 0x9e, 0x81, 0xaa, 0x09, 0xb8, 0xb8,
+    0xc2, 0xc2, 0xae, 0x95, 0x64, 0x35, 0x1f, 0x05, 0x80, 0x01, 0x1a, 0x02,
+    0x05, 0x17, 0x1f, 0x27, 0x31, 0x37, 0x35, 0x42, 0x3b, 0x42, 0x3b, 0x42,
+    0x3e, 0x3e, 0x43, 0x43, 0x40, 0x40, 0x46, 0x4d, 0x46, 0x46, 0x4f, 0x58,
+    0x4f, 0x58, 0x80, 0x56, 0x81, 0x60, 0x84, 0x68, 0x82, 0x6e, 0x00, 0x71,
+    0x85, 0x6e, 0x05, 0x7a, 0x7a, 0x73, 0x7d, 0x73, 0x7a, 0x81, 0x6e, 0x05,
+    0x7a, 0x7a, 0x73, 0x73, 0x7a, 0x7d, 0x81, 0x6e, 0x80, 0x75, 0x82, 0x6e,
+    0x06, 0x75, 0x75, 0x6e, 0x75, 0x6e, 0x6e, 0x75, 0x8a, 0x6e, 0x21, 0x75,
+    0x71, 0x70, 0x6b, 0x6c, 0x63, 0x59, 0x55, 0x49, 0x42, 0x35, 0x30, 0x2b,
+    0x1b, 0x25, 0x1a, 0x16, 0x0d, 0x0d, 0x07, 0x06, 0x02, 0x06, 0x06, 0x0f,
+    0x17, 0x27, 0x41, 0x59, 0x82, 0xa4, 0xb4, 0xbd, 0xc2, 0x80, 0xce, 0x0d,
+    0xc9, 0xc2, 0xc2, 0xb8, 0xb8, 0xb4, 0xb4, 0xae, 0xaf, 0xaa, 0x9e, 0xa7,
+    0x9e, 0xa7, 0x81, 0x9f, 0x80, 0x9b, 0x03, 0x93, 0x93, 0x9b, 0x9b, 0x80,
+    0x95, 0x02, 0xa0, 0x8a, 0x95, 0x81, 0x8a, 0x01, 0x95, 0x95, 0x82, 0x8a,
+    0x81, 0x95, 0x06, 0x02, 0x06, 0x03, 0x01, 0x00, 0x00, 0x01, 0x80, 0x00,
+    0x01, 0x01, 0x01, 0x80, 0x03, 0x09, 0x06, 0x06, 0x0f, 0x0f, 0x10, 0x15,
+    0x1f, 0x1f, 0x21, 0x21, 0x82, 0x25, 0x08, 0x27, 0x25, 0x2a, 0x2a, 0x2f,
+    0x2f, 0x30, 0x35, 0x35, 0x80, 0x42, 0x05, 0x49, 0x49, 0x48, 0x48, 0x4e,
+    0x4d, 0x80, 0x51, 0x10, 0x58, 0x4f, 0x4f, 0x58, 0x5f, 0x56, 0x56, 0x60,
+    0x66, 0x66, 0x60, 0x60, 0x68, 0x68, 0x70, 0x71, 0x71, 0x80, 0x75, 0x00,
+    0x71, 0x80, 0x6e, 0x03, 0x77, 0x77, 0x82, 0x7e, 0x81, 0x82, 0x80, 0x87,
+    0x09, 0x80, 0x87, 0x87, 0x80, 0x80, 0x91, 0x91, 0x8c, 0x91, 0x91, 0x80,
+    0x8c, 0x80, 0x95, 0x05, 0x8c, 0x8c, 0x95, 0x95, 0x9b, 0x9b, 0x80, 0x93,
+    0x08, 0x9f, 0x9e, 0x9f, 0x9f, 0x9e, 0xa7, 0x9e, 0x9e, 0xaf, 0x80, 0xaa,
+    0x80, 0xb8, 0x0f, 0xa6, 0x82, 0x4d, 0x27, 0x10, 0x02, 0x01, 0x03, 0x03,
+    0x06, 0x0f, 0x17, 0x1f, 0x27, 0x2f, 0x37, 0x81, 0x35, 0x80, 0x3b, 0x01,
+    0x42, 0x43, 0x80, 0x40, 0x04, 0x4d, 0x46, 0x46, 0x51, 0x51, 0x80, 0x58,
+    0x80, 0x56, 0x00, 0x66, 0x80, 0x60, 0x80, 0x68, 0x00, 0x71, 0x81, 0x68,
+    0x90, 0x6e, 0x05, 0x7a, 0x73, 0x7a, 0x7a, 0x73, 0x75, 0x81, 0x6e, 0x00,
+    0x75, 0x92, 0x6e, 0x00, 0x7d, 0x83, 0x6e, 0x21, 0x7d, 0x75, 0x74, 0x70,
+    0x6c, 0x6c, 0x63, 0x5d, 0x55, 0x49, 0x35, 0x30, 0x2b, 0x1b, 0x1b, 0x0e,
+    0x16, 0x08, 0x0d, 0x0d, 0x07, 0x02, 0x06, 0x02, 0x06, 0x10, 0x1f, 0x2a,
+    0x4d, 0x71, 0x95, 0xac, 0xbd, 0xc2, 0x81, 0xce, 0x03, 0xc5, 0xc5, 0xb8,
+    0xb8, 0x81, 0xaa, 0x82, 0xa7, 0x04, 0x9e, 0x9e, 0x9f, 0x93, 0x93, 0x80,
+    0x9b, 0x81, 0x95, 0x09, 0x8a, 0x8a, 0x95, 0x8a, 0x95, 0x8a, 0x95, 0x8a,
+    0x8a, 0x95, 0x89, 0x8a, 0x80, 0x06, 0x03, 0x03, 0x03, 0x01, 0x01, 0x81,
+    0x00, 0x0e, 0x01, 0x00, 0x01, 0x03, 0x01, 0x01, 0x06, 0x06, 0x05, 0x10,
+    0x15, 0x15, 0x1f, 0x1f, 0x21, 0x84, 0x27, 0x80, 0x2a, 0x04, 0x2f, 0x2f,
+    0x30, 0x35, 0x35, 0x80, 0x42, 0x02, 0x44, 0x44, 0x48, 0x80, 0x4d, 0x00,
+    0x51, 0x81, 0x58, 0x05, 0x56, 0x5f, 0x5f, 0x56, 0x56, 0x66, 0x80, 0x60,
+    0x82, 0x68, 0x06, 0x70, 0x68, 0x6e, 0x75, 0x75, 0x73, 0x73, 0x80, 0x77,
+    0x80, 0x82, 0x02, 0x7e, 0x82, 0x83, 0x82, 0x87, 0x00, 0x80, 0x81, 0x87,
+    0x04, 0x91, 0x8c, 0x91, 0x8c, 0x8c, 0x80, 0x91, 0x07, 0x8c, 0x8c, 0x95,
+    0x8c, 0x95, 0x9b, 0x9b, 0x93, 0x80, 0x9b, 0x02, 0x93, 0x9f, 0x9f, 0x82,
+    0x9e, 0x15, 0xaa, 0xae, 0xb8, 0xb8, 0xa6, 0x91, 0x59, 0x2f, 0x15, 0x02,
+    0x01, 0x03, 0x03, 0x01, 0x06, 0x0f, 0x17, 0x1f, 0x27, 0x2a, 0x2f, 0x30,
+    0x81, 0x35, 0x04, 0x42, 0x42, 0x3b, 0x3b, 0x43, 0x80, 0x40, 0x09, 0x46,
+    0x4e, 0x51, 0x51, 0x58, 0x58, 0x4f, 0x58, 0x5f, 0x5f, 0x83, 0x60, 0x88,
+    0x68, 0x02, 0x6e, 0x6e, 0x68, 0x84, 0x6e, 0x00, 0x75, 0x85, 0x6e, 0x00,
+    0x75, 0x95, 0x6e, 0x84, 0x77, 0x14, 0x7d, 0x75, 0x75, 0x74, 0x66, 0x63,
+    0x5d, 0x55, 0x49, 0x3e, 0x3d, 0x30, 0x2b, 0x1b, 0x16, 0x0e, 0x08, 0x0d,
+    0x0d, 0x07, 0x02, 0x81, 0x06, 0x08, 0x10, 0x21, 0x37, 0x59, 0x82, 0xa4,
+    0xb4, 0xc2, 0xc2, 0x80, 0xce, 0x03, 0xc2, 0xbd, 0xb8, 0xb8, 0x81, 0xaa,
+    0x01, 0xa6, 0x9e, 0x80, 0xa7, 0x05, 0x9f, 0x9f, 0x9b, 0x93, 0x93, 0x9b,
+    0x81, 0x95, 0x81, 0x8a, 0x01, 0x91, 0x8c, 0x81, 0x95, 0x02, 0x8a, 0x8a,
+    0x91, 0x8a, 0x8a, 0x81, 0x06, 0x82, 0x01, 0x83, 0x00, 0x80, 0x01, 0x08,
+    0x02, 0x06, 0x0f, 0x10, 0x10, 0x17, 0x1f, 0x1f, 0x21, 0x80, 0x27, 0x01,
+    0x25, 0x27, 0x80, 0x25, 0x11, 0x2e, 0x2a, 0x2a, 0x2f, 0x2f, 0x35, 0x35,
+    0x42, 0x3e, 0x3b, 0x40, 0x49, 0x44, 0x48, 0x4e, 0x4e, 0x51, 0x51, 0x81,
+    0x58, 0x80, 0x5f, 0x00, 0x56, 0x81, 0x60, 0x80, 0x6b, 0x06, 0x68, 0x70,
+    0x68, 0x70, 0x75, 0x7a, 0x75, 0x80, 0x6e, 0x02, 0x7d, 0x77, 0x82, 0x81,
+    0x7e, 0x01, 0x82, 0x82, 0x86, 0x87, 0x80, 0x91, 0x00, 0x8c, 0x81, 0x91,
+    0x02, 0x8c, 0x8c, 0x91, 0x82, 0x95, 0x01, 0x9b, 0x95, 0x80, 0x9b, 0x19,
+    0x93, 0x9b, 0x9f, 0x9f, 0xa7, 0x9e, 0x9e, 0xae, 0xae, 0xb4, 0x95, 0x71,
+    0x3b, 0x27, 0x07, 0x01, 0x03, 0x03, 0x01, 0x01, 0x06, 0x05, 0x17, 0x1f,
+    0x27, 0x2a, 0x80, 0x2f, 0x03, 0x37, 0x37, 0x35, 0x35, 0x80, 0x42, 0x0a,
+    0x49, 0x43, 0x48, 0x48, 0x4e, 0x4e, 0x51, 0x46, 0x58, 0x4f, 0x58, 0x80,
+    0x5f, 0x85, 0x60, 0x87, 0x68, 0x00, 0x75, 0x95, 0x6e, 0x00, 0x75, 0x89,
+    0x6e, 0x80, 0x77, 0x01, 0x7e, 0x7d, 0x82, 0x7e, 0x13, 0x77, 0x73, 0x6e,
+    0x68, 0x6b, 0x5f, 0x58, 0x55, 0x43, 0x3e, 0x3d, 0x2b, 0x1b, 0x1b, 0x16,
+    0x16, 0x08, 0x0d, 0x07, 0x07, 0x81, 0x06, 0x08, 0x05, 0x17, 0x27, 0x3b,
+    0x64, 0x91, 0xac, 0xbd, 0xc2, 0x80, 0xce, 0x01, 0xc5, 0xc2, 0x80, 0xb8,
+    0x80, 0xaa, 0x03, 0xa7, 0xa7, 0x9e, 0x9e, 0x80, 0x9f, 0x08, 0x9b, 0x9b,
+    0x93, 0x93, 0x9b, 0x95, 0x8a, 0x95, 0x95, 0x80, 0x8a, 0x02, 0x91, 0x8a,
+    0x96, 0x83, 0x8a, 0x00, 0x91, 0x86, 0x8a, 0x81, 0x83, 0x01, 0x8a, 0x0f,
+    0x81, 0x06, 0x05, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x80, 0x01, 0x81,
+    0x00, 0x09, 0x03, 0x06, 0x02, 0x0f, 0x0f, 0x10, 0x1d, 0x1d, 0x1f, 0x21,
+    0x82, 0x27, 0x80, 0x25, 0x06, 0x2c, 0x2a, 0x2c, 0x2a, 0x2f, 0x33, 0x35,
+    0x81, 0x42, 0x04, 0x49, 0x44, 0x48, 0x4e, 0x4e, 0x80, 0x51, 0x81, 0x58,
+    0x80, 0x5f, 0x0a, 0x66, 0x66, 0x60, 0x6b, 0x6b, 0x68, 0x6b, 0x70, 0x68,
+    0x75, 0x75, 0x81, 0x6e, 0x08, 0x7a, 0x73, 0x73, 0x77, 0x7e, 0x7e, 0x82,
+    0x82, 0x89, 0x82, 0x82, 0x01, 0x7e, 0x83, 0x87, 0x87, 0x02, 0x80, 0x87,
+    0x87, 0x85, 0x91, 0x1d, 0x95, 0x95, 0x8c, 0x95, 0x93, 0x9b, 0x9b, 0x93,
+    0x9f, 0xa7, 0x9e, 0xaa, 0xa7, 0x9b, 0x7a, 0x4d, 0x2a, 0x10, 0x02, 0x03,
+    0x01, 0x01, 0x03, 0x06, 0x06, 0x10, 0x17, 0x1f, 0x27, 0x2c, 0x81, 0x2f,
+    0x02, 0x30, 0x35, 0x35, 0x80, 0x42, 0x07, 0x3e, 0x49, 0x49, 0x43, 0x4e,
+    0x4e, 0x51, 0x51, 0x80, 0x58, 0x81, 0x56, 0x02, 0x60, 0x60, 0x64, 0x80,
+    0x60, 0x85, 0x68, 0x80, 0x70, 0x00, 0x75, 0x85, 0x6e, 0x04, 0x75, 0x75,
+    0x6e, 0x6e, 0x75, 0x85, 0x6e, 0x01, 0x75, 0x75, 0x85, 0x6e, 0x80, 0x7d,
+    0x00, 0x77, 0x80, 0x7e, 0x19, 0x83, 0x83, 0x85, 0x85, 0x83, 0x83, 0x7e,
+    0x85, 0x7d, 0x75, 0x70, 0x64, 0x63, 0x5d, 0x55, 0x49, 0x42, 0x2f, 0x2b,
+    0x1b, 0x1b, 0x0e, 0x08, 0x0d, 0x0d, 0x07, 0x82, 0x06, 0x12, 0x05, 0x17,
+    0x2a, 0x47, 0x71, 0x93, 0xae, 0xb8, 0xc5, 0xce, 0xce, 0xc5, 0xc2, 0xb8,
+    0xbd, 0xae, 0xb4, 0xae, 0xac, 0x82, 0xa7, 0x80, 0x9f, 0x81, 0x9b, 0x06,
+    0x95, 0x95, 0x8a, 0x95, 0x95, 0x91, 0x91, 0x80, 0x8a, 0x13, 0x91, 0x91,
+    0x8c, 0x8c, 0x8a, 0x91, 0x91, 0x8a, 0x8a, 0x96, 0x8a, 0x8a, 0x96, 0x8a,
+    0x8a, 0x87, 0x8a, 0x83, 0x83, 0x85, 0x80, 0x83, 0x02, 0x07, 0x0f, 0x0f,
+    0x80, 0x06, 0x15, 0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x03, 0x00, 0x01,
+    0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x06, 0x06, 0x0f, 0x14, 0x17, 0x15,
+    0x1f, 0x80, 0x21, 0x03, 0x27, 0x27, 0x25, 0x25, 0x80, 0x27, 0x06, 0x2c,
+    0x2a, 0x2a, 0x2f, 0x2f, 0x37, 0x35, 0x80, 0x42, 0x05, 0x44, 0x44, 0x48,
+    0x4d, 0x4e, 0x55, 0x80, 0x51, 0x07, 0x58, 0x4f, 0x59, 0x56, 0x5f, 0x5f,
+    0x66, 0x60, 0x80, 0x64, 0x13, 0x6b, 0x6b, 0x71, 0x70, 0x68, 0x70, 0x6e,
+    0x75, 0x75, 0x7a, 0x7a, 0x73, 0x73, 0x77, 0x7a, 0x77, 0x82, 0x77, 0x82,
+    0x89, 0x84, 0x82, 0x88, 0x87, 0x05, 0x80, 0x87, 0x83, 0x87, 0x87, 0x80,
+    0x80, 0x91, 0x80, 0x8c, 0x1c, 0x91, 0x8c, 0x8c, 0x95, 0x93, 0x93, 0x9f,
+    0xa7, 0xa7, 0x9f, 0x82, 0x4f, 0x2f, 0x15, 0x02, 0x01, 0x01, 0x00, 0x00,
+    0x01, 0x06, 0x0f, 0x10, 0x17, 0x1f, 0x27, 0x2c, 0x2a, 0x2e, 0x80, 0x2f,
+    0x02, 0x30, 0x35, 0x35, 0x80, 0x3b, 0x02, 0x49, 0x44, 0x48, 0x81, 0x4d,
+    0x02, 0x58, 0x58, 0x4f, 0x80, 0x56, 0x84, 0x60, 0x0e, 0x68, 0x71, 0x68,
+    0x68, 0x71, 0x68, 0x70, 0x70, 0x68, 0x68, 0x70, 0x75, 0x6e, 0x68, 0x75,
+    0x80, 0x6e, 0x01, 0x71, 0x71, 0x80, 0x75, 0x8b, 0x6e, 0x81, 0x77, 0x03,
+    0x7e, 0x7e, 0x85, 0x7e, 0x81, 0x83, 0x82, 0x8a, 0x2b, 0x87, 0x82, 0x89,
+    0x75, 0x74, 0x6c, 0x63, 0x5d, 0x55, 0x49, 0x35, 0x30, 0x2b, 0x1b, 0x1b,
+    0x0e, 0x08, 0x0d, 0x0d, 0x07, 0x07, 0x06, 0x01, 0x01, 0x02, 0x0f, 0x17,
+    0x31, 0x4d, 0x7a, 0x93, 0xae, 0xc5, 0xc5, 0xce, 0xc5, 0xc5, 0xb8, 0xb8,
+    0xae, 0xae, 0xb4, 0xac, 0x9e, 0x80, 0xa7, 0x81, 0x9f, 0x04, 0x9b, 0x93,
+    0x9b, 0x93, 0x93, 0x80, 0x95, 0x03, 0x8a, 0x8a, 0x91, 0x91, 0x82, 0x8a,
+    0x00, 0x87, 0x86, 0x8a, 0x02, 0x83, 0x83, 0x8a, 0x86, 0x83, 0x03, 0x10,
+    0x10, 0x0f, 0x0f, 0x82, 0x06, 0x81, 0x03, 0x84, 0x01, 0x0a, 0x03, 0x03,
+    0x06, 0x06, 0x0f, 0x10, 0x10, 0x15, 0x1d, 0x21, 0x21, 0x81, 0x27, 0x08,
+    0x25, 0x27, 0x27, 0x25, 0x25, 0x2a, 0x2a, 0x2f, 0x33, 0x80, 0x35, 0x05,
+    0x42, 0x42, 0x49, 0x44, 0x48, 0x48, 0x81, 0x4d, 0x11, 0x51, 0x58, 0x4f,
+    0x59, 0x59, 0x56, 0x5f, 0x66, 0x60, 0x64, 0x66, 0x64, 0x64, 0x68, 0x71,
+    0x70, 0x68, 0x68, 0x80, 0x6e, 0x00, 0x71, 0x83, 0x7a, 0x80, 0x77, 0x01,
+    0x82, 0x7a, 0x82, 0x82, 0x02, 0x80, 0x82, 0x80, 0x80, 0x82, 0x81, 0x87,
+    0x03, 0x82, 0x82, 0x87, 0x83, 0x81, 0x87, 0x15, 0x80, 0x87, 0x87, 0x80,
+    0x87, 0x87, 0x80, 0x8a, 0x87, 0x91, 0x91, 0x95, 0x9b, 0x9f, 0x9b, 0x83,
+    0x66, 0x35, 0x1f, 0x0f, 0x06, 0x01, 0x80, 0x00, 0x0a, 0x03, 0x06, 0x0f,
+    0x0f, 0x17, 0x1f, 0x27, 0x25, 0x2a, 0x2a, 0x2e, 0x80, 0x2f, 0x80, 0x35,
+    0x08, 0x3b, 0x3b, 0x43, 0x44, 0x48, 0x48, 0x4e, 0x51, 0x51, 0x80, 0x58,
+    0x05, 0x5f, 0x5f, 0x56, 0x60, 0x60, 0x66, 0x80, 0x60, 0x01, 0x68, 0x64,
+    0x82, 0x68, 0x00, 0x70, 0x81, 0x68, 0x01, 0x6e, 0x71, 0x83, 0x6e, 0x00,
+    0x75, 0x89, 0x6e, 0x80, 0x77, 0x81, 0x7e, 0x81, 0x83, 0x04, 0x8a, 0x91,
+    0x8a, 0x8c, 0x8c, 0x80, 0x95, 0x27, 0x91, 0x91, 0x87, 0x82, 0x81, 0x74,
+    0x6c, 0x63, 0x5d, 0x55, 0x44, 0x35, 0x30, 0x2b, 0x1b, 0x0e, 0x0e, 0x08,
+    0x0d, 0x0d, 0x07, 0x06, 0x06, 0x01, 0x06, 0x06, 0x0f, 0x15, 0x2f, 0x59,
+    0x82, 0xac, 0xb8, 0xc5, 0xce, 0xce, 0xc5, 0xc2, 0xb8, 0xbd, 0x80, 0xaa,
+    0x82, 0xa7, 0x0c, 0x9e, 0x9f, 0x93, 0x9b, 0x9b, 0x93, 0x9b, 0x95, 0x95,
+    0x93, 0x8c, 0x8a, 0x95, 0x80, 0x8a, 0x02, 0x8c, 0x8a, 0x91, 0x85, 0x83,
+    0x05, 0x8a, 0x83, 0x96, 0x83, 0x83, 0x8a, 0x82, 0x83, 0x00, 0x85, 0x81,
+    0x83, 0x00, 0x85, 0x80, 0x10, 0x01, 0x0f, 0x0f, 0x81, 0x06, 0x17, 0x00,
+    0x01, 0x03, 0x01, 0x00, 0x01, 0x00, 0x03, 0x01, 0x00, 0x00, 0x03, 0x01,
+    0x01, 0x02, 0x06, 0x0f, 0x0f, 0x10, 0x17, 0x15, 0x1f, 0x1f, 0x21, 0x85,
+    0x27, 0x01, 0x2c, 0x2a, 0x80, 0x2f, 0x01, 0x35, 0x35, 0x80, 0x42, 0x12,
+    0x44, 0x44, 0x48, 0x48, 0x49, 0x4e, 0x4e, 0x51, 0x58, 0x5d, 0x58, 0x58,
+    0x5f, 0x56, 0x56, 0x64, 0x66, 0x64, 0x64, 0x80, 0x6b, 0x07, 0x71, 0x71,
+    0x74, 0x74, 0x6e, 0x6e, 0x71, 0x71, 0x81, 0x7a, 0x02, 0x73, 0x7d, 0x73,
+    0x84, 0x7a, 0x8a, 0x82, 0x00, 0x7e, 0x81, 0x82, 0x00, 0x7e, 0x81, 0x82,
+    0x00, 0x83, 0x81, 0x87, 0x0b, 0x83, 0x87, 0x91, 0x95, 0x95, 0x87, 0x6b,
+    0x3b, 0x27, 0x10, 0x02, 0x01, 0x80, 0x00, 0x08, 0x01, 0x01, 0x06, 0x0f,
+    0x0f, 0x17, 0x1f, 0x27, 0x27, 0x80, 0x2a, 0x00, 0x2c, 0x80, 0x2f, 0x11,
+    0x35, 0x35, 0x3b, 0x3b, 0x42, 0x49, 0x49, 0x48, 0x4e, 0x51, 0x51, 0x59,
+    0x4f, 0x5f, 0x5f, 0x56, 0x56, 0x66, 0x81, 0x60, 0x87, 0x68, 0x04, 0x6e,
+    0x6e, 0x71, 0x71, 0x75, 0x83, 0x6e, 0x00, 0x7a, 0x80, 0x6e, 0x09, 0x7d,
+    0x73, 0x73, 0x77, 0x77, 0x7e, 0x7e, 0x82, 0x7e, 0x7e, 0x80, 0x83, 0x80,
+    0x8a, 0x04, 0x95, 0x95, 0x9b, 0x9b, 0x93, 0x81, 0x9f, 0x21, 0x9b, 0x9b,
+    0x95, 0x91, 0x87, 0x7a, 0x74, 0x6c, 0x6c, 0x5d, 0x55, 0x49, 0x35, 0x30,
+    0x2b, 0x25, 0x16, 0x0e, 0x08, 0x0d, 0x07, 0x07, 0x02, 0x06, 0x01, 0x06,
+    0x06, 0x0f, 0x15, 0x31, 0x59, 0x87, 0xac, 0xb8, 0x80, 0xc5, 0x02, 0xc2,
+    0xb8, 0xbd, 0x80, 0xb4, 0x81, 0xa7, 0x02, 0x9e, 0x9f, 0x9f, 0x81, 0x9b,
+    0x01, 0x95, 0x93, 0x80, 0x95, 0x02, 0x8a, 0x95, 0x95, 0x82, 0x91, 0x80,
+    0x87, 0x80, 0x83, 0x00, 0x85, 0x81, 0x83, 0x00, 0x87, 0x8b, 0x83, 0x02,
+    0x85, 0x15, 0x1d, 0x80, 0x10, 0x01, 0x0f, 0x0f, 0x81, 0x06, 0x02, 0x01,
+    0x01, 0x03, 0x80, 0x01, 0x04, 0x03, 0x01, 0x01, 0x00, 0x00, 0x80, 0x01,
+    0x09, 0x06, 0x06, 0x0f, 0x0f, 0x10, 0x17, 0x1d, 0x1f, 0x21, 0x21, 0x83,
+    0x27, 0x03, 0x25, 0x2c, 0x2a, 0x2e, 0x80, 0x2f, 0x03, 0x35, 0x42, 0x3b,
+    0x42, 0x81, 0x49, 0x80, 0x4d, 0x08, 0x51, 0x51, 0x5d, 0x5d, 0x58, 0x5f,
+    0x56, 0x56, 0x5f, 0x81, 0x66, 0x05, 0x64, 0x68, 0x68, 0x74, 0x74, 0x68,
+    0x81, 0x71, 0x04, 0x6e, 0x71, 0x71, 0x75, 0x73, 0x8a, 0x7a, 0x02, 0x82,
+    0x7a, 0x7a, 0x80, 0x82, 0x0e, 0x7e, 0x77, 0x82, 0x82, 0x7e, 0x82, 0x80,
+    0x77, 0x77, 0x82, 0x7e, 0x82, 0x7e, 0x7e, 0x82, 0x80, 0x7e, 0x0a, 0x82,
+    0x82, 0x83, 0x91, 0x87, 0x64, 0x49, 0x2c, 0x15, 0x06, 0x01, 0x82, 0x00,
+    0x08, 0x01, 0x06, 0x0f, 0x10, 0x17, 0x1f, 0x21, 0x25, 0x2c, 0x81, 0x2a,
+    0x01, 0x2f, 0x2f, 0x80, 0x35, 0x10, 0x42, 0x3b, 0x49, 0x43, 0x4d, 0x46,
+    0x4d, 0x59, 0x4f, 0x58, 0x5f, 0x56, 0x56, 0x66, 0x66, 0x60, 0x6b, 0x83,
+    0x68, 0x84, 0x6e, 0x01, 0x7a, 0x7a, 0x82, 0x6e, 0x04, 0x77, 0x7a, 0x77,
+    0x7e, 0x82, 0x81, 0x7e, 0x81, 0x83, 0x81, 0x8a, 0x07, 0x95, 0x95, 0x9b,
+    0x9b, 0x9f, 0x9e, 0xa7, 0xa7, 0x80, 0x9e, 0x80, 0xa7, 0x29, 0x9f, 0x9b,
+    0x91, 0x87, 0x82, 0x7a, 0x64, 0x6c, 0x5d, 0x55, 0x49, 0x35, 0x2f, 0x2b,
+    0x25, 0x0e, 0x0e, 0x08, 0x0d, 0x07, 0x07, 0x01, 0x01, 0x03, 0x06, 0x02,
+    0x0f, 0x15, 0x2f, 0x59, 0x87, 0xac, 0xbd, 0xc5, 0xce, 0xc5, 0xc5, 0xbd,
+    0xb4, 0xb4, 0xae, 0xae, 0x80, 0xa7, 0x06, 0x9f, 0x9f, 0x9b, 0x9b, 0x93,
+    0x9b, 0x9b, 0x83, 0x95, 0x07, 0x91, 0x8a, 0x8a, 0x91, 0x8a, 0x8a, 0x91,
+    0x87, 0x84, 0x83, 0x07, 0x85, 0x85, 0x83, 0x83, 0x85, 0x83, 0x85, 0x85,
+    0x81, 0x83, 0x00, 0x85, 0x80, 0x83, 0x81, 0x7e, 0x06, 0x85, 0x1d, 0x1d,
+    0x15, 0x1d, 0x10, 0x10, 0x80, 0x0f, 0x82, 0x06, 0x02, 0x00, 0x01, 0x03,
+    0x80, 0x01, 0x04, 0x03, 0x00, 0x00, 0x01, 0x03, 0x80, 0x06, 0x07, 0x0f,
+    0x0f, 0x10, 0x17, 0x1d, 0x1f, 0x1f, 0x21, 0x83, 0x27, 0x2b, 0x2c, 0x2c,
+    0x2a, 0x2a, 0x2f, 0x2f, 0x37, 0x35, 0x35, 0x42, 0x3b, 0x3e, 0x49, 0x49,
+    0x48, 0x55, 0x4e, 0x4e, 0x51, 0x55, 0x58, 0x4f, 0x58, 0x58, 0x5f, 0x5f,
+    0x56, 0x64, 0x64, 0x60, 0x66, 0x60, 0x6b, 0x6b, 0x71, 0x68, 0x68, 0x71,
+    0x70, 0x74, 0x70, 0x75, 0x6e, 0x6e, 0x80, 0x71, 0x04, 0x7a, 0x71, 0x81,
+    0x7a, 0x81, 0x84, 0x7a, 0x00, 0x73, 0x81, 0x7a, 0x06, 0x7d, 0x73, 0x73,
+    0x7a, 0x73, 0x7a, 0x7a, 0x80, 0x6e, 0x80, 0x7a, 0x80, 0x6e, 0x0d, 0x7d,
+    0x73, 0x73, 0x77, 0x7e, 0x82, 0x82, 0x60, 0x43, 0x2a, 0x15, 0x02, 0x06,
+    0x01, 0x81, 0x00, 0x0a, 0x01, 0x03, 0x02, 0x0f, 0x10, 0x17, 0x1d, 0x21,
+    0x27, 0x25, 0x25, 0x81, 0x2a, 0x12, 0x2f, 0x2f, 0x35, 0x35, 0x42, 0x42,
+    0x3b, 0x44, 0x43, 0x4d, 0x4d, 0x51, 0x58, 0x58, 0x5f, 0x5f, 0x66, 0x60,
+    0x60, 0x80, 0x68, 0x80, 0x6e, 0x00, 0x75, 0x83, 0x6e, 0x08, 0x77, 0x82,
+    0x7e, 0x7e, 0x82, 0x7e, 0x7e, 0x82, 0x82, 0x82, 0x83, 0x08, 0x87, 0x8c,
+    0x8c, 0x8a, 0x8a, 0x95, 0x9b, 0x9b, 0x9f, 0x81, 0x9e, 0x80, 0xaf, 0x35,
+    0xaa, 0xae, 0xb4, 0xae, 0xb4, 0xae, 0xaf, 0xa7, 0xa7, 0x9f, 0x95, 0x91,
+    0x82, 0x7a, 0x74, 0x64, 0x5d, 0x55, 0x49, 0x42, 0x30, 0x2b, 0x25, 0x0e,
+    0x08, 0x0d, 0x0d, 0x07, 0x06, 0x06, 0x03, 0x01, 0x01, 0x06, 0x05, 0x15,
+    0x2f, 0x59, 0x82, 0xac, 0xbd, 0xc5, 0xc5, 0xc2, 0xc2, 0xb8, 0xb4, 0xb4,
+    0xae, 0xac, 0xac, 0xa7, 0x9f, 0x9f, 0x81, 0x9b, 0x07, 0x93, 0x93, 0x95,
+    0x8a, 0x95, 0x8a, 0x91, 0x96, 0x83, 0x8a, 0x04, 0x83, 0x83, 0x87, 0x83,
+    0x83, 0x80, 0x85, 0x86, 0x83, 0x80, 0x85, 0x00, 0x7e, 0x81, 0x83, 0x80,
+    0x7e, 0x02, 0x85, 0x85, 0x7e, 0x81, 0x1d, 0x0a, 0x17, 0x10, 0x10, 0x0f,
+    0x0f, 0x06, 0x06, 0x02, 0x06, 0x06, 0x01, 0x83, 0x03, 0x01, 0x00, 0x00,
+    0x80, 0x01, 0x08, 0x03, 0x01, 0x06, 0x06, 0x0f, 0x0f, 0x10, 0x17, 0x1d,
+    0x80, 0x1f, 0x83, 0x27, 0x07, 0x2a, 0x2a, 0x2c, 0x2e, 0x2f, 0x2f, 0x37,
+    0x35, 0x80, 0x42, 0x03, 0x43, 0x49, 0x43, 0x43, 0x80, 0x4d, 0x0b, 0x46,
+    0x4d, 0x4f, 0x4f, 0x58, 0x58, 0x56, 0x56, 0x59, 0x56, 0x66, 0x64, 0x81,
+    0x6b, 0x06, 0x64, 0x71, 0x71, 0x64, 0x60, 0x68, 0x68, 0x83, 0x71, 0x06,
+    0x74, 0x75, 0x75, 0x6e, 0x6e, 0x7a, 0x75, 0x82, 0x7a, 0x03, 0x73, 0x73,
+    0x7a, 0x73, 0x83, 0x7a, 0x02, 0x73, 0x6e, 0x75, 0x81, 0x6e, 0x05, 0x71,
+    0x6e, 0x6e, 0x75, 0x6e, 0x75, 0x80, 0x6e, 0x06, 0x66, 0x49, 0x2a, 0x15,
+    0x0f, 0x01, 0x01, 0x83, 0x00, 0x21, 0x01, 0x06, 0x0f, 0x10, 0x15, 0x1d,
+    0x21, 0x25, 0x27, 0x27, 0x25, 0x25, 0x2c, 0x2a, 0x2f, 0x2f, 0x35, 0x37,
+    0x35, 0x3b, 0x3b, 0x42, 0x49, 0x49, 0x4d, 0x4e, 0x51, 0x58, 0x5f, 0x66,
+    0x60, 0x60, 0x70, 0x68, 0x80, 0x6e, 0x01, 0x77, 0x77, 0x81, 0x7e, 0x05,
+    0x83, 0x87, 0x83, 0x83, 0x80, 0x87, 0x80, 0x8a, 0x02, 0x8c, 0x8c, 0x8a,
+    0x80, 0x95, 0x06, 0x93, 0x9b, 0x93, 0x9e, 0x9e, 0xa7, 0x9e, 0x80, 0xaa,
+    0x01, 0xb8, 0xb8, 0x80, 0xc2, 0x00, 0xc9, 0x80, 0xc2, 0x32, 0xb8, 0xb8,
+    0xbd, 0xb4, 0xb4, 0xa7, 0xa7, 0x9b, 0x91, 0x82, 0x7a, 0x71, 0x64, 0x63,
+    0x55, 0x49, 0x42, 0x30, 0x2b, 0x25, 0x0e, 0x08, 0x0d, 0x0d, 0x07, 0x06,
+    0x01, 0x01, 0x03, 0x03, 0x02, 0x06, 0x17, 0x2c, 0x4d, 0x82, 0xac, 0xbd,
+    0xc2, 0xc5, 0xc2, 0xb8, 0xb8, 0xb4, 0xae, 0xac, 0xac, 0xa7, 0x9e, 0x9f,
+    0x93, 0x80, 0x9b, 0x83, 0x95, 0x06, 0x91, 0x91, 0x8a, 0x91, 0x8a, 0x91,
+    0x91, 0x80, 0x8a, 0x02, 0x83, 0x83, 0x87, 0x80, 0x83, 0x03, 0x85, 0x83,
+    0x85, 0x87, 0x84, 0x83, 0x81, 0x7e, 0x02, 0x83, 0x7e, 0x83, 0x80, 0x7e,
+    0x07, 0x77, 0x7d, 0x77, 0x7d, 0x1d, 0x1f, 0x1d, 0x1d, 0x81, 0x15, 0x80,
+    0x10, 0x06, 0x0f, 0x0f, 0x06, 0x02, 0x06, 0x02, 0x06, 0x80, 0x01, 0x00,
+    0x06, 0x81, 0x01, 0x0b, 0x03, 0x01, 0x01, 0x02, 0x06, 0x0f, 0x0f, 0x10,
+    0x17, 0x1d, 0x20, 0x1f, 0x82, 0x27, 0x01, 0x25, 0x2c, 0x81, 0x2a, 0x14,
+    0x2f, 0x2f, 0x30, 0x35, 0x35, 0x42, 0x42, 0x3e, 0x49, 0x44, 0x49, 0x48,
+    0x4e, 0x55, 0x4d, 0x46, 0x58, 0x58, 0x59, 0x4f, 0x56, 0x81, 0x5f, 0x01,
+    0x66, 0x66, 0x80, 0x6b, 0x06, 0x64, 0x60, 0x6b, 0x60, 0x60, 0x68, 0x68,
+    0x82, 0x71, 0x18, 0x74, 0x70, 0x68, 0x6e, 0x6e, 0x75, 0x6e, 0x75, 0x75,
+    0x71, 0x7a, 0x7a, 0x75, 0x75, 0x7a, 0x73, 0x73, 0x7a, 0x7a, 0x73, 0x75,
+    0x75, 0x71, 0x6e, 0x71, 0x82, 0x6e, 0x85, 0x68, 0x05, 0x59, 0x42, 0x2a,
+    0x15, 0x0f, 0x02, 0x85, 0x00, 0x07, 0x01, 0x06, 0x0f, 0x10, 0x1d, 0x1a,
+    0x21, 0x27, 0x81, 0x25, 0x02, 0x2a, 0x2a, 0x2b, 0x80, 0x2f, 0x15, 0x35,
+    0x35, 0x42, 0x3b, 0x3b, 0x43, 0x49, 0x49, 0x4e, 0x51, 0x58, 0x66, 0x60,
+    0x68, 0x6e, 0x73, 0x77, 0x7e, 0x83, 0x87, 0x80, 0x80, 0x81, 0x8c, 0x07,
+    0x95, 0x93, 0x9b, 0x9b, 0x93, 0x93, 0x9f, 0xa7, 0x80, 0x9e, 0x00, 0xa7,
+    0x81, 0xaa, 0x80, 0xb8, 0x01, 0xc2, 0xc2, 0x80, 0xc9, 0x80, 0xd3, 0x29,
+    0xd5, 0xd5, 0xd3, 0xc9, 0xc9, 0xc2, 0xb8, 0xbd, 0xb4, 0xac, 0xa7, 0x9b,
+    0x91, 0x82, 0x7a, 0x71, 0x64, 0x59, 0x55, 0x49, 0x42, 0x30, 0x2b, 0x25,
+    0x1a, 0x08, 0x0d, 0x0d, 0x07, 0x06, 0x06, 0x03, 0x03, 0x01, 0x01, 0x02,
+    0x10, 0x27, 0x43, 0x7a, 0xa4, 0xb8, 0x80, 0xc5, 0x0b, 0xb8, 0xb8, 0xae,
+    0xb4, 0xa7, 0xa7, 0xac, 0xa7, 0x9e, 0x93, 0x9b, 0x9b, 0x82, 0x95, 0x81,
+    0x91, 0x02, 0x8a, 0x8a, 0x91, 0x80, 0x8a, 0x00, 0x87, 0x85, 0x83, 0x00,
+    0x85, 0x86, 0x83, 0x01, 0x7e, 0x85, 0x82, 0x7e, 0x00, 0x83, 0x80, 0x7e,
+    0x04, 0x77, 0x7d, 0x77, 0x77, 0x2a, 0x80, 0x37, 0x81, 0x41, 0x0d, 0x37,
+    0x37, 0x31, 0x31, 0x2c, 0x2c, 0x27, 0x1f, 0x1f, 0x15, 0x17, 0x10, 0x0f,
+    0x0f, 0x80, 0x06, 0x01, 0x01, 0x01, 0x80, 0x00, 0x80, 0x06, 0x06, 0x0f,
+    0x0f, 0x10, 0x17, 0x20, 0x1f, 0x21, 0x82, 0x27, 0x09, 0x2c, 0x2c, 0x2a,
+    0x2a, 0x2e, 0x2e, 0x33, 0x33, 0x35, 0x35, 0x80, 0x42, 0x09, 0x44, 0x43,
+    0x44, 0x49, 0x49, 0x55, 0x4e, 0x51, 0x51, 0x4f, 0x80, 0x58, 0x00, 0x59,
+    0x80, 0x5f, 0x80, 0x66, 0x01, 0x6c, 0x6c, 0x81, 0x6b, 0x08, 0x64, 0x64,
+    0x68, 0x71, 0x71, 0x70, 0x71, 0x74, 0x70, 0x80, 0x68, 0x05, 0x71, 0x75,
+    0x6e, 0x6e, 0x75, 0x75, 0x80, 0x6e, 0x04, 0x75, 0x75, 0x73, 0x7a, 0x73,
+    0x80, 0x75, 0x09, 0x6e, 0x75, 0x6e, 0x6e, 0x75, 0x75, 0x68, 0x70, 0x68,
+    0x68, 0x83, 0x60, 0x06, 0x4d, 0x42, 0x2c, 0x1d, 0x0f, 0x06, 0x01, 0x83,
+    0x00, 0x09, 0x01, 0x00, 0x06, 0x02, 0x0f, 0x10, 0x15, 0x1f, 0x21, 0x21,
+    0x81, 0x27, 0x00, 0x25, 0x80, 0x2a, 0x02, 0x33, 0x2f, 0x37, 0x80, 0x35,
+    0x80, 0x42, 0x0a, 0x49, 0x4d, 0x4d, 0x56, 0x6b, 0x6e, 0x73, 0x7e, 0x83,
+    0x91, 0x8c, 0x80, 0x93, 0x04, 0x9f, 0x9e, 0xa7, 0xa7, 0x9e, 0x82, 0xaa,
+    0x81, 0xb8, 0x80, 0xc2, 0x80, 0xc9, 0x80, 0xd3, 0x01, 0xd5, 0xd5, 0x85,
+    0xe2, 0x15, 0xd5, 0xd5, 0xc9, 0xc2, 0xbd, 0xb4, 0xac, 0x9f, 0x95, 0x91,
+    0x82, 0x81, 0x74, 0x64, 0x5d, 0x55, 0x47, 0x42, 0x30, 0x2b, 0x25, 0x1a,
+    0x80, 0x0d, 0x14, 0x07, 0x06, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x0f,
+    0x21, 0x42, 0x71, 0xa4, 0xb4, 0xc2, 0xc5, 0xc2, 0xb8, 0xb8, 0xae, 0xb4,
+    0x80, 0xa7, 0x04, 0x9e, 0x9f, 0x9b, 0x93, 0x93, 0x82, 0x95, 0x00, 0x8a,
+    0x81, 0x91, 0x02, 0x87, 0x8a, 0x87, 0x80, 0x83, 0x00, 0x87, 0x8f, 0x83,
+    0x81, 0x85, 0x03, 0x7e, 0x7e, 0x83, 0x83, 0x80, 0x7e, 0x08, 0x85, 0x85,
+    0x7e, 0x77, 0x6c, 0x71, 0x7a, 0x7a, 0x86, 0x82, 0x82, 0x17, 0x7a, 0x7a,
+    0x71, 0x64, 0x64, 0x5b, 0x50, 0x47, 0x41, 0x37, 0x31, 0x2c, 0x1f, 0x1f,
+    0x17, 0x10, 0x0f, 0x02, 0x04, 0x01, 0x01, 0x06, 0x02, 0x06, 0x80, 0x0f,
+    0x03, 0x10, 0x17, 0x1f, 0x21, 0x82, 0x27, 0x80, 0x2c, 0x80, 0x2a, 0x04,
+    0x2f, 0x33, 0x30, 0x37, 0x35, 0x80, 0x42, 0x81, 0x49, 0x01, 0x4d, 0x46,
+    0x80, 0x51, 0x1e, 0x58, 0x5d, 0x5d, 0x58, 0x58, 0x5f, 0x5f, 0x56, 0x56,
+    0x66, 0x64, 0x60, 0x66, 0x66, 0x6b, 0x64, 0x64, 0x60, 0x6b, 0x6b, 0x71,
+    0x71, 0x68, 0x68, 0x71, 0x71, 0x70, 0x68, 0x68, 0x71, 0x68, 0x81, 0x6e,
+    0x08, 0x75, 0x6e, 0x75, 0x6e, 0x7a, 0x75, 0x73, 0x75, 0x75, 0x81, 0x6e,
+    0x12, 0x75, 0x75, 0x68, 0x68, 0x64, 0x60, 0x66, 0x64, 0x56, 0x59, 0x4f,
+    0x5d, 0x55, 0x37, 0x2c, 0x15, 0x05, 0x06, 0x03, 0x85, 0x00, 0x11, 0x01,
+    0x01, 0x06, 0x0f, 0x10, 0x17, 0x15, 0x1f, 0x21, 0x21, 0x27, 0x27, 0x25,
+    0x27, 0x25, 0x2c, 0x2a, 0x2a, 0x80, 0x2f, 0x80, 0x35, 0x11, 0x42, 0x42,
+    0x43, 0x4e, 0x58, 0x64, 0x6e, 0x77, 0x83, 0x91, 0x95, 0x9b, 0x9e, 0x9e,
+    0xaa, 0xaf, 0xaa, 0xae, 0x80, 0xb8, 0x81, 0xc2, 0x80, 0xc9, 0x01, 0xd5,
+    0xd3, 0x80, 0xd5, 0x82, 0xe2, 0x86, 0xe7, 0x1a, 0xe2, 0xe2, 0xd5, 0xce,
+    0xb8, 0xb4, 0xa7, 0x9b, 0x91, 0x87, 0x7a, 0x71, 0x74, 0x64, 0x5d, 0x55,
+    0x49, 0x42, 0x30, 0x2b, 0x25, 0x1a, 0x08, 0x0d, 0x07, 0x07, 0x06, 0x81,
+    0x01, 0x0e, 0x06, 0x06, 0x0f, 0x1f, 0x41, 0x6c, 0x95, 0xb4, 0xbd, 0xc5,
+    0xc2, 0xb8, 0xb4, 0xb4, 0xac, 0x80, 0xa7, 0x04, 0x9e, 0x93, 0x9b, 0x93,
+    0x9b, 0x82, 0x95, 0x06, 0x91, 0x8a, 0x91, 0x91, 0x8a, 0x83, 0x87, 0x87,
+    0x83, 0x01, 0x85, 0x85, 0x81, 0x83, 0x00, 0x85, 0x84, 0x83, 0x03, 0x7e,
+    0x82, 0x7e, 0x85, 0x82, 0x7e, 0x00, 0x83, 0x82, 0x7e, 0x01, 0xac, 0xac,
+    0x82, 0xb4, 0x80, 0xbd, 0x80, 0xb4, 0x12, 0xac, 0xac, 0xa4, 0x9b, 0x95,
+    0x91, 0x82, 0x7a, 0x71, 0x59, 0x4d, 0x41, 0x37, 0x2c, 0x1f, 0x17, 0x10,
+    0x0f, 0x02, 0x81, 0x06, 0x06, 0x0f, 0x0f, 0x14, 0x1d, 0x1d, 0x1f, 0x21,
+    0x81, 0x27, 0x01, 0x2e, 0x2e, 0x81, 0x2a, 0x02, 0x2f, 0x2f, 0x30, 0x80,
+    0x35, 0x80, 0x42, 0x80, 0x49, 0x80, 0x4d, 0x80, 0x51, 0x03, 0x58, 0x5d,
+    0x4f, 0x4f, 0x81, 0x5f, 0x80, 0x56, 0x05, 0x60, 0x60, 0x64, 0x60, 0x6b,
+    0x60, 0x80, 0x6b, 0x00, 0x64, 0x80, 0x68, 0x00, 0x70, 0x80, 0x68, 0x01,
+    0x75, 0x68, 0x8c, 0x6e, 0x80, 0x75, 0x11, 0x70, 0x68, 0x60, 0x60, 0x6c,
+    0x63, 0x5d, 0x55, 0x55, 0x49, 0x42, 0x37, 0x27, 0x15, 0x0f, 0x06, 0x03,
+    0x01, 0x84, 0x00, 0x0a, 0x01, 0x01, 0x06, 0x06, 0x0f, 0x10, 0x17, 0x15,
+    0x1f, 0x21, 0x21, 0x82, 0x27, 0x80, 0x2a, 0x00, 0x2e, 0x80, 0x2f, 0x80,
+    0x35, 0x19, 0x3b, 0x43, 0x4d, 0x64, 0x71, 0x77, 0x82, 0x91, 0x95, 0x9f,
+    0xa7, 0xaa, 0xae, 0xbd, 0xbd, 0xb8, 0xc2, 0xc2, 0xc9, 0xc9, 0xce, 0xc9,
+    0xd3, 0xd3, 0xd5, 0xd5, 0x83, 0xe2, 0x8b, 0xe7, 0x18, 0xe2, 0xd5, 0xc2,
+    0xb4, 0x9f, 0x95, 0x87, 0x82, 0x7a, 0x71, 0x6c, 0x59, 0x5d, 0x55, 0x49,
+    0x42, 0x30, 0x2b, 0x25, 0x1a, 0x08, 0x0d, 0x07, 0x06, 0x06, 0x80, 0x01,
+    0x14, 0x03, 0x01, 0x06, 0x0f, 0x15, 0x2f, 0x59, 0x87, 0xac, 0xb8, 0xc2,
+    0xb8, 0xb8, 0xb4, 0xb4, 0xaf, 0xa7, 0xa7, 0x9f, 0x9f, 0x9b, 0x80, 0x93,
+    0x81, 0x95, 0x81, 0x91, 0x02, 0x8a, 0x83, 0x87, 0x89, 0x83, 0x00, 0x85,
+    0x82, 0x83, 0x00, 0x85, 0x80, 0x83, 0x00, 0x85, 0x81, 0x83, 0x04, 0x7e,
+    0x83, 0x7e, 0x7e, 0x83, 0x85, 0x7e, 0x02, 0x85, 0xc5, 0xc5, 0x89, 0xce,
+    0x1e, 0xc5, 0xc2, 0xbd, 0xbd, 0xb8, 0xbd, 0xb4, 0xb4, 0xa7, 0x9b, 0x87,
+    0x7a, 0x64, 0x5b, 0x47, 0x37, 0x27, 0x1f, 0x10, 0x0f, 0x02, 0x02, 0x06,
+    0x0f, 0x0f, 0x10, 0x17, 0x15, 0x1f, 0x1f, 0x21, 0x81, 0x27, 0x02, 0x2a,
+    0x2a, 0x2c, 0x80, 0x2a, 0x26, 0x33, 0x30, 0x30, 0x37, 0x35, 0x42, 0x3e,
+    0x42, 0x49, 0x49, 0x48, 0x48, 0x4e, 0x4e, 0x51, 0x51, 0x4f, 0x58, 0x59,
+    0x5d, 0x5d, 0x63, 0x56, 0x56, 0x5f, 0x56, 0x56, 0x66, 0x64, 0x64, 0x60,
+    0x66, 0x6b, 0x64, 0x6b, 0x64, 0x68, 0x64, 0x71, 0x81, 0x68, 0x05, 0x70,
+    0x75, 0x6e, 0x6e, 0x71, 0x7a, 0x81, 0x6e, 0x85, 0x77, 0x14, 0x73, 0x7a,
+    0x73, 0x6e, 0x68, 0x64, 0x64, 0x59, 0x5d, 0x4e, 0x49, 0x42, 0x42, 0x35,
+    0x2e, 0x21, 0x17, 0x0f, 0x06, 0x01, 0x01, 0x82, 0x00, 0x0c, 0x01, 0x00,
+    0x00, 0x01, 0x03, 0x06, 0x06, 0x0f, 0x10, 0x17, 0x17, 0x1f, 0x1f, 0x81,
+    0x21, 0x05, 0x27, 0x25, 0x27, 0x25, 0x2a, 0x2a, 0x81, 0x2f, 0x11, 0x35,
+    0x35, 0x3b, 0x40, 0x4f, 0x64, 0x71, 0x82, 0x87, 0x95, 0x9b, 0xa7, 0xaa,
+    0xae, 0xb8, 0xbd, 0xc2, 0xc2, 0x81, 0xc9, 0x03, 0xd3, 0xd3, 0xd5, 0xd5,
+    0x82, 0xe2, 0x8c, 0xe7, 0x2e, 0xe2, 0xe2, 0xc9, 0xb8, 0xa7, 0x91, 0x82,
+    0x71, 0x74, 0x64, 0x59, 0x5d, 0x4d, 0x49, 0x49, 0x42, 0x30, 0x2b, 0x25,
+    0x1a, 0x0d, 0x0d, 0x07, 0x06, 0x06, 0x03, 0x01, 0x01, 0x03, 0x03, 0x06,
+    0x06, 0x10, 0x2c, 0x4d, 0x82, 0xac, 0xb8, 0xc5, 0xc2, 0xb8, 0xae, 0xae,
+    0xaf, 0xa7, 0xa7, 0x9f, 0x80, 0x9b, 0x81, 0x95, 0x02, 0x91, 0x8a, 0x8a,
+    0x81, 0x91, 0x03, 0x83, 0x83, 0x87, 0x87, 0x85, 0x83, 0x01, 0x85, 0x85,
+    0x8c, 0x83, 0x02, 0x7e, 0x7e, 0x85, 0x89, 0x7e, 0x8b, 0xd5, 0x84, 0xce,
+    0x80, 0xc5, 0x0d, 0xb7, 0xae, 0xac, 0xa4, 0xa4, 0x7a, 0x64, 0x50, 0x37,
+    0x2c, 0x15, 0x10, 0x0f, 0x06, 0x80, 0x0f, 0x0e, 0x10, 0x17, 0x15, 0x1d,
+    0x1f, 0x21, 0x27, 0x27, 0x25, 0x25, 0x2a, 0x2a, 0x2c, 0x2a, 0x2e, 0x80,
+    0x2f, 0x02, 0x37, 0x35, 0x35, 0x80, 0x42, 0x04, 0x44, 0x44, 0x48, 0x4e,
+    0x4e, 0x81, 0x51, 0x80, 0x58, 0x83, 0x5f, 0x15, 0x60, 0x56, 0x60, 0x66,
+    0x6b, 0x64, 0x60, 0x60, 0x6b, 0x68, 0x74, 0x70, 0x71, 0x74, 0x71, 0x75,
+    0x75, 0x73, 0x73, 0x7a, 0x77, 0x77, 0x80, 0x7e, 0x1b, 0x82, 0x7e, 0x7e,
+    0x83, 0x83, 0x87, 0x80, 0x80, 0x82, 0x82, 0x7a, 0x71, 0x71, 0x64, 0x59,
+    0x5d, 0x49, 0x3e, 0x3e, 0x3d, 0x30, 0x2b, 0x25, 0x1a, 0x10, 0x06, 0x06,
+    0x01, 0x87, 0x00, 0x80, 0x01, 0x05, 0x06, 0x05, 0x0f, 0x10, 0x17, 0x15,
+    0x80, 0x1f, 0x81, 0x21, 0x01, 0x27, 0x25, 0x80, 0x2a, 0x15, 0x2b, 0x2f,
+    0x33, 0x35, 0x42, 0x43, 0x4e, 0x56, 0x60, 0x6e, 0x7e, 0x83, 0x91, 0x93,
+    0x9e, 0xa7, 0xaa, 0xae, 0xb8, 0xbd, 0xc2, 0xc2, 0x80, 0xc9, 0x03, 0xd3,
+    0xd3, 0xd5, 0xd5, 0x82, 0xe2, 0x8a, 0xe7, 0x19, 0xe2, 0xe2, 0xd3, 0xc2,
+    0xae, 0x95, 0x7d, 0x6b, 0x5f, 0x5d, 0x55, 0x4d, 0x49, 0x49, 0x42, 0x35,
+    0x33, 0x2e, 0x25, 0x1a, 0x0d, 0x0d, 0x06, 0x02, 0x06, 0x03, 0x80, 0x00,
+    0x13, 0x03, 0x01, 0x06, 0x0f, 0x1f, 0x41, 0x71, 0xa4, 0xb4, 0xc2, 0xb8,
+    0xb8, 0xae, 0xae, 0xa6, 0xa7, 0xa7, 0x9f, 0x93, 0x9b, 0x81, 0x95, 0x82,
+    0x91, 0x81, 0x8a, 0x82, 0x83, 0x02, 0x87, 0x83, 0x87, 0x87, 0x83, 0x00,
+    0x7e, 0x81, 0x83, 0x07, 0x7e, 0x7e, 0x83, 0x85, 0x7e, 0x7e, 0x85, 0x85,
+    0x82, 0x7e, 0x00, 0x85, 0x84, 0x7e, 0x82, 0xce, 0x83, 0xc5, 0x8b, 0xce,
+    0x80, 0xc5, 0x09, 0xb8, 0xb4, 0xac, 0xa4, 0x86, 0x64, 0x47, 0x31, 0x1f,
+    0x17, 0x82, 0x0f, 0x09, 0x10, 0x17, 0x15, 0x1f, 0x1f, 0x21, 0x27, 0x27,
+    0x25, 0x2c, 0x82, 0x2a, 0x80, 0x2f, 0x01, 0x35, 0x35, 0x80, 0x42, 0x08,
+    0x49, 0x43, 0x48, 0x55, 0x4e, 0x55, 0x51, 0x4d, 0x55, 0x80, 0x58, 0x00,
+    0x59, 0x80, 0x5f, 0x1a, 0x56, 0x64, 0x60, 0x64, 0x60, 0x60, 0x64, 0x60,
+    0x60, 0x68, 0x71, 0x71, 0x68, 0x6e, 0x7a, 0x7a, 0x73, 0x73, 0x77, 0x7e,
+    0x7e, 0x82, 0x83, 0x83, 0x87, 0x8a, 0x91, 0x80, 0x8c, 0x17, 0x95, 0x8c,
+    0x95, 0x8c, 0x8c, 0x87, 0x82, 0x7a, 0x71, 0x64, 0x5d, 0x55, 0x42, 0x35,
+    0x30, 0x2b, 0x1b, 0x25, 0x1a, 0x15, 0x07, 0x02, 0x04, 0x01, 0x8a, 0x00,
+    0x0a, 0x06, 0x02, 0x06, 0x0f, 0x10, 0x10, 0x17, 0x1d, 0x1d, 0x1f, 0x1f,
+    0x80, 0x21, 0x03, 0x27, 0x27, 0x25, 0x2c, 0x80, 0x2a, 0x10, 0x2f, 0x35,
+    0x42, 0x49, 0x4d, 0x58, 0x66, 0x6b, 0x75, 0x77, 0x87, 0x91, 0x95, 0x9e,
+    0x9e, 0xae, 0xaa, 0x80, 0xb8, 0x80, 0xc2, 0x80, 0xc9, 0x00, 0xd3, 0x80,
+    0xd5, 0x8c, 0xe2, 0x23, 0xd3, 0xc9, 0xb4, 0x9b, 0x82, 0x66, 0x5d, 0x55,
+    0x49, 0x49, 0x43, 0x42, 0x42, 0x37, 0x30, 0x25, 0x21, 0x1a, 0x0d, 0x07,
+    0x06, 0x02, 0x01, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x02, 0x0f, 0x17,
+    0x2f, 0x59, 0x87, 0xb4, 0x80, 0xb8, 0x07, 0xb4, 0xae, 0xa6, 0x9e, 0x9f,
+    0x9f, 0x9b, 0x93, 0x80, 0x95, 0x01, 0x91, 0x95, 0x80, 0x91, 0x01, 0x8c,
+    0x87, 0x80, 0x8a, 0x01, 0x87, 0x87, 0x81, 0x83, 0x00, 0x85, 0x81, 0x83,
+    0x01, 0x7e, 0x7e, 0x82, 0x83, 0x87, 0x7e, 0x00, 0x85, 0x81, 0x7e, 0x00,
+    0x85, 0x88, 0x7e, 0x04, 0xc2, 0xb8, 0xb8, 0xc5, 0xc5, 0x84, 0xb8, 0x80,
+    0xbd, 0x02, 0xc5, 0xc5, 0xbd, 0x81, 0xc5, 0x85, 0xce, 0x19, 0xc5, 0xc5,
+    0xb4, 0xac, 0x91, 0x7a, 0x5b, 0x41, 0x27, 0x17, 0x0f, 0x05, 0x0f, 0x0f,
+    0x10, 0x10, 0x17, 0x17, 0x15, 0x1f, 0x21, 0x27, 0x25, 0x25, 0x2a, 0x2c,
+    0x80, 0x2a, 0x0a, 0x2e, 0x33, 0x33, 0x30, 0x35, 0x35, 0x42, 0x42, 0x49,
+    0x49, 0x48, 0x81, 0x4d, 0x00, 0x55, 0x80, 0x5d, 0x01, 0x59, 0x58, 0x81,
+    0x5f, 0x15, 0x56, 0x60, 0x60, 0x6b, 0x68, 0x68, 0x71, 0x68, 0x6e, 0x71,
+    0x73, 0x73, 0x80, 0x7e, 0x7e, 0x83, 0x83, 0x80, 0x80, 0x8c, 0x95, 0x95,
+    0x80, 0x93, 0x81, 0x9e, 0x0c, 0xac, 0xa7, 0x9b, 0x95, 0x91, 0x82, 0x7a,
+    0x71, 0x63, 0x55, 0x49, 0x35, 0x2b, 0x80, 0x1b, 0x06, 0x0e, 0x16, 0x0d,
+    0x05, 0x06, 0x01, 0x01, 0x8b, 0x00, 0x2c, 0x01, 0x01, 0x02, 0x0f, 0x0f,
+    0x10, 0x17, 0x15, 0x15, 0x1d, 0x21, 0x1f, 0x21, 0x21, 0x27, 0x27, 0x25,
+    0x27, 0x25, 0x25, 0x2a, 0x2f, 0x2f, 0x35, 0x3b, 0x49, 0x4e, 0x58, 0x59,
+    0x60, 0x68, 0x71, 0x77, 0x87, 0x8c, 0x95, 0x9b, 0x9e, 0x9e, 0xa7, 0xaf,
+    0xaf, 0xaa, 0xb8, 0xb8, 0x80, 0xc2, 0x81, 0xc9, 0x00, 0xd5, 0x81, 0xd3,
+    0x80, 0xd5, 0x81, 0xd3, 0x07, 0xc9, 0xc2, 0xb4, 0x9f, 0x82, 0x6c, 0x4d,
+    0x49, 0x80, 0x41, 0x24, 0x37, 0x37, 0x33, 0x2a, 0x25, 0x21, 0x1a, 0x0d,
+    0x07, 0x06, 0x06, 0x01, 0x03, 0x01, 0x00, 0x00, 0x01, 0x00, 0x02, 0x06,
+    0x10, 0x27, 0x47, 0x7a, 0xac, 0xb4, 0xb8, 0xb8, 0xae, 0xaf, 0xac, 0xa7,
+    0x9e, 0x9b, 0x9b, 0x95, 0x95, 0x84, 0x91, 0x80, 0x8a, 0x04, 0x83, 0x87,
+    0x87, 0x83, 0x87, 0x82, 0x83, 0x07, 0x85, 0x85, 0x7e, 0x7e, 0x85, 0x85,
+    0x7e, 0x83, 0x8e, 0x7e, 0x01, 0x85, 0x85, 0x87, 0x7e, 0x06, 0x85, 0xb4,
+    0xae, 0xae, 0xb4, 0xb4, 0xae, 0x80, 0xb4, 0x03, 0xae, 0xb4, 0xae, 0xae,
+    0x81, 0xb4, 0x80, 0xbd, 0x01, 0xb8, 0xbd, 0x82, 0xc5, 0x82, 0xce, 0x0a,
+    0xc5, 0xc5, 0xbd, 0xb4, 0xa4, 0x82, 0x67, 0x41, 0x2c, 0x17, 0x10, 0x81,
+    0x0f, 0x04, 0x10, 0x10, 0x15, 0x1d, 0x21, 0x80, 0x27, 0x00, 0x2c, 0x81,
+    0x2a, 0x05, 0x2e, 0x2e, 0x33, 0x33, 0x35, 0x35, 0x80, 0x42, 0x0c, 0x49,
+    0x48, 0x48, 0x4e, 0x4d, 0x51, 0x51, 0x58, 0x58, 0x59, 0x4f, 0x5f, 0x5f,
+    0x80, 0x66, 0x03, 0x60, 0x60, 0x70, 0x70, 0x81, 0x6e, 0x0b, 0x77, 0x7e,
+    0x82, 0x87, 0x91, 0x91, 0x95, 0x9b, 0x9b, 0x93, 0x9e, 0x9e, 0x80, 0xaa,
+    0x02, 0xb8, 0xb8, 0xae, 0x80, 0xb4, 0x0a, 0xac, 0xa7, 0x9b, 0x91, 0x82,
+    0x71, 0x64, 0x5d, 0x49, 0x3e, 0x30, 0x80, 0x1b, 0x0b, 0x0e, 0x0e, 0x0d,
+    0x07, 0x06, 0x02, 0x03, 0x01, 0x01, 0x03, 0x03, 0x01, 0x88, 0x00, 0x0b,
+    0x03, 0x01, 0x06, 0x06, 0x0f, 0x10, 0x17, 0x1d, 0x15, 0x1d, 0x1d, 0x1f,
+    0x83, 0x21, 0x19, 0x27, 0x25, 0x25, 0x2a, 0x2f, 0x2f, 0x35, 0x3e, 0x49,
+    0x49, 0x46, 0x4f, 0x56, 0x60, 0x60, 0x68, 0x73, 0x77, 0x7e, 0x83, 0x91,
+    0x8a, 0x9b, 0x9f, 0x9e, 0x9e, 0x80, 0xaa, 0x02, 0xbd, 0xb8, 0xb8, 0x89,
+    0xc2, 0x08, 0xb8, 0xbd, 0xa7, 0x95, 0x7a, 0x64, 0x49, 0x41, 0x41, 0x80,
+    0x37, 0x07, 0x2f, 0x33, 0x2a, 0x27, 0x21, 0x15, 0x0d, 0x07, 0x80, 0x06,
+    0x82, 0x00, 0x13, 0x01, 0x01, 0x06, 0x0f, 0x1f, 0x37, 0x6c, 0x95, 0xb4,
+    0xb8, 0xbd, 0xae, 0xae, 0xa7, 0xa7, 0x9f, 0x9b, 0x9b, 0x95, 0x95, 0x80,
+    0x91, 0x03, 0x8a, 0x8a, 0x91, 0x91, 0x80, 0x83, 0x02, 0x87, 0x83, 0x87,
+    0x85, 0x83, 0x05, 0x85, 0x85, 0x7e, 0x7e, 0x85, 0x7e, 0x81, 0x85, 0x91,
+    0x7e, 0x00, 0x85, 0x80, 0x7e, 0x00, 0x85, 0x80, 0x7e, 0x01, 0xac, 0xa6,
+    0x80, 0xac, 0x00, 0xa7, 0x86, 0xac, 0x00, 0xaf, 0x85, 0xb4, 0x80, 0xb8,
+    0x81, 0xc5, 0x81, 0xce, 0x0b, 0xc5, 0xc5, 0xb4, 0xa4, 0x82, 0x59, 0x41,
+    0x1f, 0x17, 0x0f, 0x06, 0x06, 0x80, 0x0f, 0x0c, 0x17, 0x17, 0x1d, 0x21,
+    0x27, 0x27, 0x25, 0x25, 0x2a, 0x2a, 0x2c, 0x2a, 0x2e, 0x80, 0x2f, 0x1e,
+    0x35, 0x35, 0x42, 0x42, 0x49, 0x44, 0x49, 0x4d, 0x4e, 0x55, 0x58, 0x5d,
+    0x4f, 0x59, 0x56, 0x66, 0x60, 0x60, 0x6b, 0x70, 0x68, 0x6e, 0x73, 0x77,
+    0x7e, 0x7e, 0x83, 0x87, 0x91, 0x95, 0x93, 0x80, 0x9e, 0x80, 0xaa, 0x03,
+    0xb8, 0xc2, 0xc2, 0xc9, 0x80, 0xce, 0x0f, 0xc9, 0xc2, 0xb8, 0xb4, 0xb4,
+    0xac, 0x9b, 0x91, 0x89, 0x71, 0x64, 0x55, 0x49, 0x30, 0x2b, 0x1b, 0x80,
+    0x0e, 0x0b, 0x08, 0x0d, 0x07, 0x06, 0x06, 0x01, 0x03, 0x00, 0x03, 0x03,
+    0x01, 0x01, 0x87, 0x00, 0x80, 0x01, 0x0e, 0x06, 0x06, 0x0f, 0x10, 0x17,
+    0x15, 0x15, 0x1d, 0x1f, 0x1d, 0x1d, 0x1f, 0x1d, 0x1f, 0x1f, 0x80, 0x21,
+    0x1c, 0x27, 0x27, 0x2a, 0x2a, 0x2f, 0x30, 0x42, 0x42, 0x49, 0x43, 0x43,
+    0x4d, 0x4d, 0x51, 0x4f, 0x56, 0x60, 0x68, 0x73, 0x7e, 0x83, 0x8a, 0x8a,
+    0x9b, 0x93, 0x9f, 0xa7, 0xa7, 0xaf, 0x80, 0xaa, 0x80, 0xaf, 0x00, 0xaa,
+    0x80, 0xaf, 0x18, 0xaa, 0xaf, 0xa7, 0x95, 0x87, 0x71, 0x59, 0x47, 0x41,
+    0x37, 0x33, 0x31, 0x31, 0x2c, 0x2c, 0x27, 0x21, 0x1d, 0x15, 0x07, 0x0f,
+    0x06, 0x01, 0x03, 0x01, 0x83, 0x00, 0x11, 0x02, 0x02, 0x10, 0x2c, 0x55,
+    0x82, 0xac, 0xb4, 0xbd, 0xb4, 0xb4, 0xa6, 0xa7, 0x9f, 0x9b, 0x9b, 0x93,
+    0x95, 0x80, 0x91, 0x84, 0x87, 0x80, 0x83, 0x0a, 0x87, 0x87, 0x85, 0x83,
+    0x85, 0x83, 0x83, 0x7e, 0x7e, 0x85, 0x85, 0x83, 0x7e, 0x00, 0x82, 0x87,
+    0x7e, 0x01, 0x85, 0x85, 0x80, 0x7e, 0x01, 0x85, 0x85, 0x89, 0x7e, 0x83,
+    0xa7, 0x01, 0x9f, 0xa4, 0x80, 0x9f, 0x01, 0xa4, 0xa4, 0x82, 0xa7, 0x82,
+    0xac, 0x01, 0xb4, 0xae, 0x80, 0xb4, 0x02, 0xbd, 0xbd, 0xb8, 0x80, 0xc5,
+    0x80, 0xce, 0x17, 0xc5, 0xc5, 0xb4, 0xa4, 0x7a, 0x50, 0x31, 0x1d, 0x0f,
+    0x02, 0x06, 0x06, 0x0f, 0x0f, 0x10, 0x17, 0x1d, 0x21, 0x21, 0x27, 0x27,
+    0x25, 0x27, 0x25, 0x80, 0x2a, 0x04, 0x2e, 0x2f, 0x2f, 0x35, 0x35, 0x80,
+    0x42, 0x80, 0x49, 0x16, 0x55, 0x4e, 0x51, 0x5d, 0x59, 0x5f, 0x64, 0x64,
+    0x68, 0x70, 0x73, 0x73, 0x7e, 0x83, 0x80, 0x8c, 0x95, 0x93, 0x9e, 0x9e,
+    0xaa, 0xae, 0xb8, 0x80, 0xc2, 0x01, 0xce, 0xc9, 0x80, 0xd5, 0x80, 0xe2,
+    0x17, 0xd5, 0xd5, 0xc9, 0xc2, 0xb4, 0xae, 0xa6, 0xa4, 0x87, 0x7f, 0x64,
+    0x63, 0x47, 0x42, 0x30, 0x1b, 0x1b, 0x0e, 0x0e, 0x16, 0x0d, 0x07, 0x02,
+    0x06, 0x80, 0x01, 0x03, 0x00, 0x01, 0x01, 0x00, 0x80, 0x01, 0x88, 0x00,
+    0x07, 0x01, 0x02, 0x06, 0x0f, 0x0f, 0x10, 0x17, 0x17, 0x81, 0x15, 0x0f,
+    0x1d, 0x1f, 0x1f, 0x1d, 0x1d, 0x1f, 0x1f, 0x21, 0x1f, 0x27, 0x27, 0x2a,
+    0x2a, 0x2f, 0x2f, 0x30, 0x80, 0x37, 0x0f, 0x35, 0x3b, 0x3e, 0x44, 0x4e,
+    0x58, 0x66, 0x70, 0x6e, 0x73, 0x7e, 0x83, 0x83, 0x91, 0x91, 0x95, 0x80,
+    0x9b, 0x82, 0x9f, 0x0b, 0x9b, 0x9b, 0x95, 0x87, 0x85, 0x71, 0x64, 0x55,
+    0x41, 0x37, 0x33, 0x31, 0x80, 0x2c, 0x09, 0x27, 0x1f, 0x1d, 0x17, 0x10,
+    0x0f, 0x06, 0x02, 0x01, 0x01, 0x83, 0x00, 0x07, 0x01, 0x02, 0x06, 0x0f,
+    0x1f, 0x37, 0x64, 0xa4, 0x81, 0xb4, 0x06, 0xa7, 0x9e, 0x9f, 0x9b, 0x9b,
+    0x95, 0x95, 0x80, 0x91, 0x82, 0x87, 0x06, 0x83, 0x87, 0x83, 0x87, 0x83,
+    0x87, 0x83, 0x81, 0x85, 0x03, 0x83, 0x83, 0x7e, 0x85, 0x83, 0x7e, 0x02,
+    0x85, 0x7e, 0x82, 0x82, 0x7e, 0x00, 0x85, 0x81, 0x7e, 0x04, 0x85, 0x85,
+    0x7e, 0x85, 0x85, 0x84, 0x7e, 0x01, 0x85, 0x7d, 0x82, 0x7e, 0x8c, 0x9b,
+    0x05, 0xa4, 0x9b, 0x9f, 0xa4, 0x9f, 0xa4, 0x82, 0xac, 0x01, 0xa7, 0xac,
+    0x81, 0xb4, 0x80, 0xbd, 0x1b, 0xc5, 0xc5, 0xce, 0xc5, 0xc5, 0xb7, 0xac,
+    0x87, 0x64, 0x41, 0x1f, 0x10, 0x06, 0x06, 0x02, 0x02, 0x0f, 0x0f, 0x10,
+    0x1d, 0x1d, 0x1f, 0x21, 0x27, 0x27, 0x25, 0x2c, 0x2c, 0x80, 0x2a, 0x80,
+    0x2f, 0x1c, 0x35, 0x35, 0x42, 0x3b, 0x42, 0x42, 0x49, 0x44, 0x48, 0x55,
+    0x55, 0x58, 0x66, 0x6b, 0x6e, 0x73, 0x7e, 0x87, 0x91, 0x9b, 0x9e, 0x9e,
+    0xae, 0xae, 0xb8, 0xc2, 0xc2, 0xc9, 0xc9, 0x80, 0xd5, 0x82, 0xe2, 0x12,
+    0xe7, 0xe7, 0xe2, 0xe2, 0xd5, 0xce, 0xbd, 0xae, 0xa6, 0xa4, 0x86, 0x7a,
+    0x71, 0x63, 0x55, 0x42, 0x30, 0x2b, 0x1b, 0x80, 0x0e, 0x12, 0x08, 0x0d,
+    0x07, 0x02, 0x06, 0x01, 0x03, 0x00, 0x00, 0x06, 0x06, 0x01, 0x01, 0x03,
+    0x01, 0x01, 0x00, 0x00, 0x01, 0x84, 0x00, 0x0b, 0x01, 0x03, 0x01, 0x02,
+    0x06, 0x0f, 0x0f, 0x10, 0x17, 0x15, 0x15, 0x1d, 0x81, 0x15, 0x81, 0x1d,
+    0x05, 0x1f, 0x1f, 0x21, 0x21, 0x1f, 0x27, 0x83, 0x25, 0x1f, 0x2a, 0x2f,
+    0x35, 0x35, 0x3e, 0x49, 0x55, 0x59, 0x56, 0x66, 0x6b, 0x68, 0x73, 0x73,
+    0x77, 0x7e, 0x7e, 0x87, 0x83, 0x83, 0x7e, 0x7e, 0x7a, 0x73, 0x6e, 0x71,
+    0x64, 0x5d, 0x55, 0x42, 0x37, 0x31, 0x80, 0x2c, 0x0b, 0x27, 0x27, 0x1f,
+    0x1d, 0x17, 0x10, 0x0f, 0x0f, 0x06, 0x04, 0x01, 0x01, 0x85, 0x00, 0x0f,
+    0x06, 0x0f, 0x17, 0x2c, 0x55, 0x82, 0xac, 0xb4, 0xb4, 0xac, 0xac, 0xa7,
+    0x93, 0x9b, 0x95, 0x95, 0x80, 0x91, 0x80, 0x87, 0x03, 0x83, 0x83, 0x87,
+    0x87, 0x87, 0x83, 0x03, 0x82, 0x82, 0x7e, 0x85, 0x84, 0x7e, 0x00, 0x85,
+    0x8f, 0x7e, 0x00, 0x85, 0x82, 0x7e, 0x02, 0x77, 0x77, 0x7e, 0x81, 0x77,
+    0x8f, 0x95, 0x80, 0x9b, 0x01, 0xa4, 0x9b, 0x81, 0x9f, 0x81, 0xac, 0x81,
+    0xb4, 0x01, 0xb7, 0xb8, 0x82, 0xc5, 0x06, 0xb4, 0xa4, 0x7a, 0x50, 0x2c,
+    0x17, 0x02, 0x81, 0x06, 0x05, 0x0f, 0x10, 0x17, 0x17, 0x1d, 0x21, 0x81,
+    0x27, 0x04, 0x2c, 0x2a, 0x2c, 0x2a, 0x2a, 0x80, 0x2f, 0x03, 0x37, 0x35,
+    0x35, 0x42, 0x80, 0x3b, 0x12, 0x44, 0x48, 0x51, 0x5f, 0x68, 0x7a, 0x87,
+    0x8c, 0x93, 0x9e, 0xaa, 0xae, 0xb8, 0xc2, 0xc2, 0xc9, 0xc9, 0xd3, 0xd5,
+    0x81, 0xe2, 0x85, 0xe7, 0x19, 0xe2, 0xd5, 0xc5, 0xb4, 0xa4, 0xa4, 0x82,
+    0x7a, 0x71, 0x64, 0x55, 0x47, 0x35, 0x2b, 0x25, 0x1b, 0x0e, 0x0e, 0x08,
+    0x0d, 0x07, 0x06, 0x06, 0x03, 0x03, 0x00, 0x81, 0x06, 0x05, 0x02, 0x02,
+    0x06, 0x03, 0x01, 0x01, 0x87, 0x00, 0x80, 0x01, 0x08, 0x02, 0x06, 0x06,
+    0x0f, 0x07, 0x10, 0x10, 0x17, 0x17, 0x81, 0x15, 0x00, 0x1d, 0x80, 0x15,
+    0x05, 0x1d, 0x15, 0x15, 0x1f, 0x1d, 0x1d, 0x82, 0x1f, 0x04, 0x21, 0x21,
+    0x27, 0x2a, 0x2f, 0x80, 0x35, 0x04, 0x3b, 0x3b, 0x49, 0x4d, 0x4d, 0x80,
+    0x59, 0x11, 0x60, 0x64, 0x64, 0x6c, 0x63, 0x5d, 0x55, 0x4d, 0x43, 0x47,
+    0x41, 0x37, 0x31, 0x31, 0x2c, 0x2c, 0x27, 0x27, 0x80, 0x1f, 0x03, 0x17,
+    0x10, 0x07, 0x05, 0x80, 0x06, 0x87, 0x00, 0x14, 0x04, 0x06, 0x0f, 0x1f,
+    0x37, 0x64, 0x91, 0xac, 0xb4, 0xb4, 0xac, 0x9f, 0x9b, 0x95, 0x95, 0x8c,
+    0x8c, 0x91, 0x80, 0x87, 0x87, 0x86, 0x83, 0x07, 0x82, 0x7e, 0x82, 0x7e,
+    0x83, 0x7e, 0x7e, 0x85, 0x83, 0x7e, 0x00, 0x85, 0x8a, 0x7e, 0x00, 0x7d,
+    0x89, 0x7e, 0x05, 0x77, 0x85, 0x7d, 0x7d, 0x77, 0x77, 0x80, 0x7d, 0x00,
+    0x91, 0x81, 0x95, 0x8b, 0x91, 0x81, 0x95, 0x1a, 0x9b, 0x9b, 0xa4, 0x9b,
+    0x9f, 0x9f, 0x9c, 0xa7, 0xac, 0xa7, 0xa7, 0xac, 0xb4, 0xb4, 0xb8, 0xbd,
+    0xc2, 0xc2, 0xc5, 0xc5, 0xbd, 0xac, 0x87, 0x5d, 0x31, 0x15, 0x0f, 0x80,
+    0x06, 0x07, 0x02, 0x0f, 0x0f, 0x10, 0x17, 0x15, 0x21, 0x21, 0x82, 0x27,
+    0x07, 0x25, 0x2a, 0x2a, 0x2e, 0x33, 0x2f, 0x30, 0x37, 0x80, 0x35, 0x12,
+    0x3e, 0x42, 0x49, 0x4e, 0x5f, 0x75, 0x7e, 0x91, 0x93, 0x9e, 0xae, 0xb8,
+    0xb8, 0xc2, 0xc9, 0xc9, 0xd3, 0xd5, 0xd5, 0x80, 0xe2, 0x86, 0xe7, 0x15,
+    0xe2, 0xe2, 0xce, 0xbd, 0xa4, 0x87, 0x7a, 0x71, 0x6c, 0x59, 0x59, 0x49,
+    0x42, 0x30, 0x1b, 0x1b, 0x0e, 0x0e, 0x08, 0x0d, 0x07, 0x02, 0x81, 0x01,
+    0x85, 0x06, 0x06, 0x01, 0x01, 0x03, 0x01, 0x01, 0x00, 0x01, 0x84, 0x00,
+    0x80, 0x01, 0x06, 0x06, 0x02, 0x06, 0x0f, 0x0f, 0x07, 0x0f, 0x80, 0x10,
+    0x8e, 0x17, 0x04, 0x15, 0x15, 0x1f, 0x21, 0x21, 0x81, 0x27, 0x05, 0x2a,
+    0x2a, 0x2f, 0x2f, 0x37, 0x41, 0x80, 0x3b, 0x09, 0x42, 0x42, 0x35, 0x37,
+    0x37, 0x2f, 0x31, 0x2c, 0x27, 0x27, 0x83, 0x1f, 0x08, 0x17, 0x17, 0x10,
+    0x0f, 0x0f, 0x06, 0x02, 0x01, 0x01, 0x86, 0x00, 0x11, 0x01, 0x00, 0x06,
+    0x0f, 0x10, 0x27, 0x4d, 0x7a, 0xa4, 0xac, 0xb4, 0xa6, 0x9f, 0x9b, 0x93,
+    0x95, 0x91, 0x8c, 0x81, 0x87, 0x05, 0x83, 0x83, 0x82, 0x7e, 0x83, 0x83,
+    0x80, 0x7e, 0x00, 0x83, 0x92, 0x7e, 0x00, 0x85, 0x81, 0x7e, 0x00, 0x7d,
+    0x82, 0x77, 0x0c, 0x85, 0x7d, 0x7e, 0x7e, 0x77, 0x7d, 0x7e, 0x77, 0x7e,
+    0x7e, 0x77, 0x7e, 0x7d, 0x82, 0x77, 0x88, 0x91, 0x82, 0x87, 0x80, 0x91,
+    0x02, 0x96, 0x91, 0x91, 0x82, 0x95, 0x81, 0x9b, 0x02, 0x9f, 0xa4, 0xa7,
+    0x80, 0xac, 0x0e, 0xb4, 0xb4, 0xb8, 0xb8, 0xc2, 0xc5, 0xc5, 0xbd, 0xb4,
+    0x91, 0x6c, 0x37, 0x1d, 0x07, 0x02, 0x81, 0x06, 0x05, 0x0f, 0x07, 0x10,
+    0x15, 0x1f, 0x21, 0x80, 0x27, 0x00, 0x25, 0x80, 0x27, 0x02, 0x2a, 0x2e,
+    0x2e, 0x81, 0x2f, 0x13, 0x30, 0x37, 0x35, 0x42, 0x4e, 0x5f, 0x75, 0x85,
+    0x91, 0x93, 0x9e, 0xae, 0xb8, 0xc2, 0xc2, 0xc9, 0xce, 0xd3, 0xd5, 0xd5,
+    0x83, 0xe2, 0x01, 0xe7, 0xe7, 0x82, 0xe2, 0x14, 0xd5, 0xc2, 0xb4, 0x91,
+    0x71, 0x64, 0x67, 0x5d, 0x55, 0x47, 0x42, 0x30, 0x2b, 0x25, 0x0e, 0x0e,
+    0x08, 0x0d, 0x0d, 0x07, 0x06, 0x80, 0x03, 0x81, 0x06, 0x01, 0x0f, 0x0f,
+    0x83, 0x06, 0x81, 0x01, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x03, 0x03, 0x01, 0x80, 0x06, 0x80, 0x0f, 0x81, 0x10,
+    0x00, 0x0f, 0x8a, 0x10, 0x81, 0x17, 0x00, 0x15, 0x81, 0x17, 0x01, 0x15,
+    0x15, 0x80, 0x1f, 0x01, 0x27, 0x27, 0x80, 0x2c, 0x00, 0x27, 0x83, 0x1f,
+    0x03, 0x17, 0x15, 0x17, 0x1d, 0x80, 0x17, 0x06, 0x14, 0x14, 0x0f, 0x0f,
+    0x06, 0x02, 0x06, 0x8b, 0x00, 0x06, 0x06, 0x0f, 0x17, 0x2f, 0x59, 0x87,
+    0xa7, 0x80, 0x9e, 0x05, 0x9b, 0x95, 0x8c, 0x91, 0x87, 0x87, 0x80, 0x83,
+    0x8f, 0x7e, 0x00, 0x85, 0x8c, 0x7e, 0x87, 0x77, 0x00, 0x7d, 0x80, 0x77,
+    0x00, 0x7d, 0x89, 0x77, 0x01, 0x87, 0x87, 0x81, 0x91, 0x8c, 0x87, 0x82,
+    0x91, 0x81, 0x95, 0x00, 0xa0, 0x81, 0x9b, 0x02, 0xa4, 0xa7, 0xa7, 0x80,
+    0xb4, 0x0a, 0xbd, 0xb8, 0xc2, 0xc2, 0xbd, 0xb4, 0x91, 0x64, 0x37, 0x1d,
+    0x0f, 0x80, 0x06, 0x0e, 0x01, 0x06, 0x06, 0x0f, 0x10, 0x17, 0x1d, 0x21,
+    0x21, 0x27, 0x27, 0x21, 0x21, 0x27, 0x25, 0x81, 0x2a, 0x81, 0x2f, 0x0d,
+    0x35, 0x42, 0x44, 0x58, 0x70, 0x7e, 0x8a, 0x9b, 0x9e, 0xaa, 0xb4, 0xb8,
+    0xc2, 0xc2, 0x80, 0xc9, 0x83, 0xd5, 0x80, 0xe2, 0x82, 0xd5, 0x16, 0xc2,
+    0xb4, 0x95, 0x7a, 0x59, 0x59, 0x50, 0x47, 0x47, 0x41, 0x2f, 0x2b, 0x25,
+    0x0e, 0x0e, 0x08, 0x0d, 0x0d, 0x07, 0x06, 0x01, 0x03, 0x01, 0x80, 0x06,
+    0x84, 0x0f, 0x81, 0x06, 0x03, 0x01, 0x01, 0x03, 0x03, 0x80, 0x00, 0x00,
+    0x01, 0x80, 0x00, 0x01, 0x01, 0x00, 0x81, 0x03, 0x82, 0x06, 0x89, 0x0f,
+    0x03, 0x07, 0x10, 0x0f, 0x05, 0x86, 0x0f, 0x04, 0x05, 0x05, 0x0f, 0x0f,
+    0x05, 0x81, 0x14, 0x84, 0x17, 0x80, 0x14, 0x05, 0x3c, 0x62, 0x8b, 0x8b,
+    0x39, 0x13, 0x80, 0x0f, 0x02, 0x06, 0x06, 0x03, 0x80, 0x00, 0x03, 0x01,
+    0x00, 0x00, 0x01, 0x85, 0x00, 0x0e, 0x01, 0x06, 0x07, 0x1f, 0x41, 0x71,
+    0x95, 0xa7, 0xa7, 0x9f, 0x93, 0x95, 0x91, 0x8c, 0x87, 0x80, 0x83, 0x03,
+    0x82, 0x7e, 0x7e, 0x82, 0x87, 0x7e, 0x00, 0x82, 0x87, 0x7e, 0x06, 0x7d,
+    0x7e, 0x7e, 0x77, 0x77, 0x7e, 0x7e, 0x80, 0x77, 0x00, 0x7e, 0x88, 0x77,
+    0x00, 0x7e, 0x87, 0x77, 0x06, 0x7d, 0x77, 0x77, 0x7d, 0x7d, 0x85, 0x92,
+    0x81, 0x87, 0x00, 0x83, 0x8d, 0x87, 0x83, 0x91, 0x80, 0x95, 0x81, 0x9b,
+    0x13, 0xa4, 0xa4, 0xa7, 0xac, 0xb4, 0xb4, 0xae, 0xbd, 0xb8, 0xc2, 0xbd,
+    0xb4, 0x91, 0x64, 0x37, 0x15, 0x0f, 0x02, 0x02, 0x01, 0x80, 0x06, 0x04,
+    0x0f, 0x0f, 0x1d, 0x15, 0x1d, 0x82, 0x21, 0x02, 0x27, 0x27, 0x25, 0x81,
+    0x2a, 0x0c, 0x2e, 0x2f, 0x30, 0x35, 0x49, 0x51, 0x6b, 0x7a, 0x7e, 0x8a,
+    0x93, 0x93, 0xa7, 0x80, 0xaa, 0x01, 0xb8, 0xb8, 0x80, 0xc2, 0x80, 0xc9,
+    0x83, 0xce, 0x19, 0xc9, 0xc9, 0xc5, 0xae, 0x9b, 0x7a, 0x63, 0x55, 0x47,
+    0x47, 0x41, 0x37, 0x2f, 0x2b, 0x25, 0x1a, 0x16, 0x08, 0x0d, 0x0d, 0x07,
+    0x02, 0x01, 0x03, 0x03, 0x01, 0x80, 0x06, 0x01, 0x0f, 0x07, 0x81, 0x10,
+    0x01, 0x07, 0x0f, 0x81, 0x06, 0x06, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x01, 0x80, 0x00, 0x07, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x03, 0x01,
+    0x81, 0x06, 0x00, 0x02, 0x81, 0x0f, 0x01, 0x07, 0x0f, 0x85, 0x10, 0x05,
+    0x05, 0x0f, 0x05, 0x0f, 0x0f, 0x05, 0x81, 0x06, 0x04, 0x02, 0x02, 0x04,
+    0x04, 0x0f, 0x83, 0x0c, 0x07, 0x0f, 0x05, 0x0f, 0x05, 0x0f, 0x0f, 0x39,
+    0xd1, 0x80, 0xee, 0x11, 0xeb, 0x8b, 0x12, 0x06, 0x03, 0x0a, 0x1e, 0x1e,
+    0x00, 0x00, 0x03, 0x0b, 0x5a, 0x9a, 0x34, 0x00, 0x00, 0x01, 0x80, 0x00,
+    0x18, 0x01, 0x00, 0x06, 0x0f, 0x10, 0x2c, 0x50, 0x7a, 0x9b, 0xa7, 0x9e,
+    0x9b, 0x95, 0x91, 0x91, 0x80, 0x87, 0x83, 0x7e, 0x82, 0x7e, 0x82, 0x7e,
+    0x82, 0x7e, 0x81, 0x77, 0x00, 0x7e, 0x81, 0x77, 0x00, 0x7e, 0x80, 0x77,
+    0x81, 0x7e, 0x8f, 0x77, 0x04, 0x7d, 0x77, 0x73, 0x7d, 0x7d, 0x83, 0x77,
+    0x00, 0x7d, 0x83, 0x77, 0x0a, 0x73, 0x73, 0x7d, 0x73, 0x73, 0x85, 0x7e,
+    0x83, 0x87, 0x87, 0x82, 0x80, 0x83, 0x03, 0x82, 0x85, 0x82, 0x82, 0x8a,
+    0x87, 0x84, 0x91, 0x80, 0x95, 0x08, 0x9b, 0x9b, 0x9f, 0xa7, 0xa7, 0xac,
+    0xaf, 0xb4, 0xae, 0x80, 0xbd, 0x07, 0xac, 0x91, 0x63, 0x37, 0x15, 0x0f,
+    0x02, 0x06, 0x80, 0x03, 0x07, 0x06, 0x06, 0x0f, 0x10, 0x1d, 0x1d, 0x1f,
+    0x1f, 0x81, 0x21, 0x16, 0x27, 0x25, 0x25, 0x2a, 0x2a, 0x2e, 0x2a, 0x30,
+    0x35, 0x42, 0x55, 0x4f, 0x60, 0x68, 0x73, 0x7e, 0x83, 0x91, 0x95, 0x9b,
+    0x9f, 0xa7, 0x9e, 0x80, 0xaa, 0x84, 0xb8, 0x11, 0xbd, 0xb8, 0xb8, 0xbd,
+    0xac, 0x95, 0x7a, 0x59, 0x47, 0x41, 0x41, 0x37, 0x37, 0x2f, 0x2b, 0x21,
+    0x1a, 0x08, 0x80, 0x0d, 0x01, 0x07, 0x02, 0x80, 0x01, 0x00, 0x03, 0x80,
+    0x06, 0x01, 0x0f, 0x0f, 0x80, 0x10, 0x00, 0x17, 0x80, 0x10, 0x01, 0x0f,
+    0x0f, 0x81, 0x06, 0x08, 0x01, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01,
+    0x06, 0x83, 0x02, 0x02, 0x05, 0x0f, 0x07, 0x80, 0x10, 0x00, 0x17, 0x80,
+    0x15, 0x81, 0x1f, 0x01, 0x1a, 0x1f, 0x80, 0x1a, 0x80, 0x15, 0x00, 0x17,
+    0x80, 0x10, 0x07, 0x07, 0x0f, 0x05, 0x02, 0x02, 0x06, 0x02, 0x04, 0x80,
+    0x06, 0x81, 0x04, 0x20, 0x02, 0x06, 0x0f, 0x02, 0x04, 0x0c, 0x8b, 0xee,
+    0xeb, 0xeb, 0xfe, 0xfc, 0xfd, 0x62, 0x12, 0x98, 0xeb, 0xfc, 0xd1, 0x12,
+    0x01, 0x19, 0xda, 0xf8, 0xf7, 0xde, 0x1e, 0x03, 0x00, 0x01, 0x03, 0x00,
+    0x01, 0x80, 0x06, 0x0c, 0x17, 0x31, 0x59, 0x82, 0x9b, 0xa7, 0x9b, 0x8c,
+    0x91, 0x87, 0x87, 0x82, 0x82, 0x80, 0x7e, 0x81, 0x77, 0x03, 0x7d, 0x77,
+    0x77, 0x73, 0x80, 0x77, 0x03, 0x7d, 0x77, 0x77, 0x7a, 0x8a, 0x77, 0x00,
+    0x7d, 0x80, 0x77, 0x09, 0x7d, 0x77, 0x77, 0x7d, 0x7d, 0x77, 0x77, 0x7d,
+    0x73, 0x77, 0x80, 0x6e, 0x00, 0x7d, 0x81, 0x77, 0x81, 0x6e, 0x05, 0x77,
+    0x77, 0x73, 0x73, 0x7d, 0x73, 0x80, 0x7d, 0x00, 0x85, 0x81, 0x82, 0x06,
+    0x7e, 0x85, 0x85, 0x82, 0x82, 0x85, 0x89, 0x84, 0x82, 0x87, 0x87, 0x80,
+    0x91, 0x02, 0x8c, 0x91, 0x91, 0x80, 0x95, 0x1c, 0x9b, 0x9f, 0x9f, 0xa7,
+    0xa7, 0xac, 0xac, 0xb4, 0xae, 0xb8, 0xb4, 0xa7, 0x87, 0x59, 0x2f, 0x17,
+    0x06, 0x06, 0x03, 0x01, 0x00, 0x01, 0x06, 0x06, 0x0f, 0x07, 0x10, 0x15,
+    0x15, 0x80, 0x1f, 0x02, 0x21, 0x1f, 0x21, 0x80, 0x27, 0x80, 0x2a, 0x13,
+    0x2f, 0x35, 0x42, 0x49, 0x51, 0x58, 0x66, 0x60, 0x68, 0x71, 0x73, 0x82,
+    0x87, 0x91, 0x95, 0x93, 0x93, 0x9e, 0xa7, 0xa7, 0x84, 0xaa, 0x0d, 0xa7,
+    0x9b, 0x87, 0x71, 0x5b, 0x47, 0x37, 0x37, 0x33, 0x31, 0x2a, 0x25, 0x21,
+    0x15, 0x80, 0x0d, 0x03, 0x07, 0x06, 0x02, 0x01, 0x80, 0x03, 0x81, 0x06,
+    0x0c, 0x0f, 0x0f, 0x10, 0x17, 0x15, 0x1d, 0x15, 0x17, 0x10, 0x10, 0x07,
+    0x0f, 0x0f, 0x80, 0x06, 0x80, 0x02, 0x05, 0x06, 0x06, 0x02, 0x0f, 0x07,
+    0x10, 0x80, 0x15, 0x08, 0x21, 0x27, 0x2c, 0x2a, 0x2f, 0x37, 0x37, 0x3b,
+    0x41, 0x80, 0x43, 0x00, 0x50, 0x82, 0x4d, 0x80, 0x43, 0x10, 0x3b, 0x37,
+    0x2f, 0x2f, 0x2c, 0x27, 0x27, 0x21, 0x1f, 0x15, 0x15, 0x17, 0x10, 0x05,
+    0x05, 0x0f, 0x0c, 0x81, 0x04, 0x02, 0x0c, 0x26, 0x26, 0x80, 0x04, 0x02,
+    0x19, 0xd1, 0xeb, 0x81, 0xef, 0x2e, 0xfd, 0xdd, 0xda, 0xfa, 0xf9, 0xf9,
+    0xda, 0x26, 0x04, 0xb5, 0xf8, 0xf9, 0xed, 0xf7, 0x3f, 0x5a, 0xb5, 0xcf,
+    0x6a, 0x12, 0x00, 0x0c, 0x39, 0x98, 0x3c, 0x3a, 0x64, 0x87, 0x9b, 0x9b,
+    0x95, 0x8c, 0x87, 0x86, 0x86, 0x82, 0x7e, 0x77, 0x7a, 0x77, 0x7a, 0x77,
+    0x77, 0x73, 0x77, 0x73, 0x73, 0x82, 0x7a, 0x00, 0x77, 0x87, 0x6e, 0x0e,
+    0x77, 0x73, 0x73, 0x77, 0x73, 0x77, 0x77, 0x73, 0x77, 0x77, 0x7d, 0x77,
+    0x7d, 0x7d, 0x77, 0x80, 0x6e, 0x00, 0x7d, 0x80, 0x6e, 0x01, 0x77, 0x77,
+    0x84, 0x6e, 0x01, 0x7d, 0x77, 0x82, 0x6e, 0x06, 0x7d, 0x73, 0x85, 0x7e,
+    0x82, 0x7e, 0x82, 0x81, 0x7e, 0x0a, 0x82, 0x82, 0x85, 0x82, 0x7e, 0x92,
+    0x82, 0x82, 0x7e, 0x89, 0x82, 0x80, 0x87, 0x00, 0x83, 0x83, 0x87, 0x03,
+    0x92, 0x87, 0x87, 0x8a, 0x80, 0x91, 0x23, 0x95, 0x93, 0x9b, 0x9b, 0x9f,
+    0x9f, 0xa7, 0xa7, 0xac, 0xa6, 0xae, 0xb8, 0xb4, 0xac, 0x82, 0x4d, 0x27,
+    0x10, 0x06, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x06, 0x06, 0x0f, 0x10,
+    0x17, 0x17, 0x1f, 0x1d, 0x21, 0x1f, 0x1f, 0x80, 0x21, 0x2f, 0x27, 0x27,
+    0x25, 0x2a, 0x30, 0x30, 0x42, 0x42, 0x49, 0x48, 0x40, 0x4d, 0x4d, 0x59,
+    0x59, 0x60, 0x6e, 0x77, 0x82, 0x83, 0x87, 0x8a, 0x95, 0x93, 0x93, 0x9b,
+    0x9b, 0x93, 0x93, 0x91, 0x87, 0x7a, 0x66, 0x55, 0x41, 0x37, 0x31, 0x31,
+    0x2c, 0x27, 0x21, 0x21, 0x1a, 0x0d, 0x0d, 0x07, 0x07, 0x06, 0x80, 0x01,
+    0x00, 0x03, 0x80, 0x01, 0x80, 0x06, 0x02, 0x0f, 0x10, 0x15, 0x81, 0x1d,
+    0x04, 0x15, 0x15, 0x17, 0x10, 0x10, 0x81, 0x0f, 0x13, 0x07, 0x10, 0x17,
+    0x15, 0x1f, 0x27, 0x31, 0x2f, 0x3b, 0x43, 0x4d, 0x59, 0x64, 0x71, 0x7a,
+    0x80, 0x80, 0x86, 0x91, 0x95, 0x81, 0x93, 0x80, 0x9e, 0x83, 0x93, 0x1d,
+    0x8c, 0x91, 0x87, 0x82, 0x7a, 0x71, 0x64, 0x59, 0x4d, 0x43, 0x35, 0x2f,
+    0x2c, 0x27, 0x1f, 0x1f, 0x17, 0x14, 0x05, 0x05, 0x0c, 0x39, 0xf2, 0xe8,
+    0x26, 0x0b, 0x04, 0x8b, 0xee, 0xeb, 0x82, 0xef, 0x28, 0xfd, 0xfb, 0xfe,
+    0xfa, 0xf9, 0xfb, 0xed, 0xb5, 0xf9, 0xfb, 0xee, 0xee, 0xfe, 0xed, 0xf9,
+    0xf8, 0xf8, 0xf7, 0xda, 0x26, 0x98, 0xf7, 0xf8, 0xf9, 0xa1, 0x7f, 0x91,
+    0x9b, 0x8c, 0x8c, 0x9c, 0xb9, 0xdd, 0xdd, 0xa5, 0x77, 0x73, 0x73, 0x7a,
+    0x73, 0x7a, 0x81, 0x6e, 0x00, 0x75, 0x82, 0x6e, 0x00, 0x7d, 0x82, 0x6e,
+    0x00, 0x7d, 0x84, 0x6e, 0x01, 0x7d, 0x7d, 0x80, 0x77, 0x87, 0x6e, 0x81,
+    0x7d, 0x02, 0x73, 0x73, 0x7d, 0x84, 0x6e, 0x03, 0x7d, 0x7d, 0x73, 0x7d,
+    0x81, 0x6e, 0x02, 0x7d, 0x7e, 0x7d, 0x82, 0x7e, 0x01, 0x85, 0x82, 0x80,
+    0x7e, 0x06, 0x89, 0x82, 0x82, 0x7e, 0x82, 0x89, 0x89, 0x83, 0x82, 0x04,
+    0x92, 0x87, 0x87, 0x85, 0x92, 0x81, 0x87, 0x81, 0x91, 0x00, 0x95, 0x80,
+    0x9b, 0x0e, 0x9f, 0x9f, 0xa7, 0xa7, 0xa6, 0xae, 0xb8, 0xae, 0x9b, 0x71,
+    0x41, 0x1f, 0x0f, 0x06, 0x01, 0x80, 0x00, 0x80, 0x01, 0x07, 0x06, 0x0f,
+    0x0f, 0x10, 0x17, 0x15, 0x1d, 0x1d, 0x81, 0x1f, 0x08, 0x21, 0x21, 0x27,
+    0x27, 0x25, 0x2a, 0x2f, 0x2f, 0x37, 0x81, 0x35, 0x21, 0x3b, 0x43, 0x4d,
+    0x59, 0x60, 0x68, 0x68, 0x75, 0x7d, 0x7e, 0x82, 0x7e, 0x82, 0x82, 0x7a,
+    0x7a, 0x71, 0x59, 0x4d, 0x41, 0x37, 0x31, 0x2c, 0x2c, 0x27, 0x27, 0x21,
+    0x15, 0x1d, 0x0d, 0x07, 0x07, 0x02, 0x02, 0x80, 0x01, 0x03, 0x03, 0x00,
+    0x06, 0x01, 0x80, 0x06, 0x0a, 0x0f, 0x0f, 0x10, 0x15, 0x15, 0x1d, 0x1d,
+    0x1f, 0x15, 0x15, 0x1d, 0x81, 0x15, 0x0f, 0x21, 0x27, 0x2f, 0x37, 0x43,
+    0x4d, 0x64, 0x71, 0x82, 0x94, 0x9c, 0xa6, 0xac, 0xae, 0xae, 0xb8, 0x81,
+    0xc5, 0x00, 0xc2, 0x82, 0xc5, 0x82, 0xce, 0x20, 0xc5, 0xc9, 0xc5, 0xc2,
+    0xc5, 0xc2, 0xbd, 0xc5, 0xb8, 0xae, 0xae, 0x9e, 0x9e, 0x9b, 0x91, 0x82,
+    0x71, 0x64, 0x4d, 0x3b, 0x37, 0x2a, 0x27, 0x1f, 0x3c, 0xed, 0xf8, 0xfa,
+    0xd1, 0x8b, 0x62, 0xda, 0xfc, 0x83, 0xef, 0x04, 0xfc, 0xfe, 0xfc, 0xfb,
+    0xed, 0x80, 0xf9, 0x1e, 0xfa, 0xfe, 0xee, 0xfe, 0xfc, 0xfb, 0xf9, 0xf2,
+    0xed, 0xf8, 0xfa, 0xda, 0xf1, 0xf9, 0xf1, 0xf9, 0xfb, 0xa9, 0x87, 0x8c,
+    0x9c, 0xb2, 0xe1, 0xfc, 0xfb, 0xf9, 0xeb, 0xc1, 0xa5, 0x71, 0x71, 0x83,
+    0x6e, 0x81, 0x75, 0x01, 0x73, 0x75, 0x84, 0x6e, 0x00, 0x7d, 0x85, 0x6e,
+    0x01, 0x77, 0x77, 0x8a, 0x6e, 0x02, 0x7d, 0x73, 0x73, 0x80, 0x7d, 0x80,
+    0x6e, 0x16, 0x75, 0x73, 0x73, 0x7d, 0x73, 0x73, 0x7d, 0x7d, 0x73, 0x73,
+    0x7d, 0x7d, 0x85, 0x77, 0x77, 0x7e, 0x77, 0x77, 0x7d, 0x77, 0x85, 0x85,
+    0x7d, 0x81, 0x82, 0x04, 0x7e, 0x82, 0x89, 0x89, 0x7e, 0x83, 0x82, 0x02,
+    0x87, 0x87, 0x82, 0x84, 0x87, 0x80, 0x91, 0x01, 0x95, 0x95, 0x80, 0x9b,
+    0x0d, 0x9f, 0xa7, 0xa7, 0xa6, 0xae, 0xb4, 0xac, 0x91, 0x63, 0x2f, 0x17,
+    0x02, 0x06, 0x03, 0x80, 0x00, 0x09, 0x01, 0x01, 0x06, 0x06, 0x0f, 0x0f,
+    0x10, 0x10, 0x17, 0x17, 0x82, 0x1d, 0x80, 0x1f, 0x28, 0x21, 0x21, 0x27,
+    0x27, 0x2c, 0x2c, 0x25, 0x25, 0x2a, 0x2a, 0x2f, 0x35, 0x42, 0x49, 0x4d,
+    0x55, 0x5d, 0x63, 0x66, 0x64, 0x66, 0x6c, 0x63, 0x4d, 0x55, 0x47, 0x41,
+    0x37, 0x31, 0x2c, 0x27, 0x27, 0x1f, 0x1f, 0x15, 0x15, 0x10, 0x07, 0x06,
+    0x06, 0x02, 0x80, 0x01, 0x03, 0x00, 0x00, 0x01, 0x01, 0x82, 0x06, 0x03,
+    0x0f, 0x0f, 0x10, 0x15, 0x80, 0x1d, 0x0f, 0x1a, 0x1a, 0x21, 0x21, 0x25,
+    0x2f, 0x37, 0x47, 0x59, 0x71, 0x82, 0x94, 0xa4, 0xa6, 0xae, 0xb8, 0x80,
+    0xc5, 0x81, 0xce, 0x95, 0xd5, 0x81, 0xce, 0x14, 0xc5, 0xc2, 0xc2, 0xbd,
+    0xae, 0xae, 0xa6, 0x95, 0x80, 0x71, 0x59, 0x43, 0xbf, 0xf8, 0xf2, 0xed,
+    0xfe, 0xfe, 0xfc, 0xfd, 0xfc, 0x83, 0xef, 0x80, 0xfc, 0x80, 0xf9, 0x20,
+    0xfa, 0xf7, 0xf7, 0xf8, 0xfa, 0xfb, 0xfb, 0xf9, 0xf9, 0xf2, 0xf1, 0xf8,
+    0xfe, 0xfe, 0xf9, 0xee, 0xf2, 0xfb, 0xfe, 0xe1, 0x94, 0x8c, 0xab, 0xf6,
+    0xfd, 0xfc, 0xef, 0xeb, 0xed, 0xf1, 0xeb, 0x97, 0x71, 0x80, 0x6e, 0x03,
+    0x75, 0x71, 0x68, 0x70, 0x82, 0x6e, 0x03, 0x75, 0x6e, 0x6e, 0x75, 0x81,
+    0x6e, 0x01, 0x7d, 0x7d, 0x83, 0x6e, 0x80, 0x77, 0x08, 0x7d, 0x7d, 0x75,
+    0x7d, 0x73, 0x73, 0x75, 0x73, 0x75, 0x83, 0x6e, 0x00, 0x75, 0x8a, 0x6e,
+    0x05, 0x75, 0x75, 0x73, 0x7d, 0x77, 0x7e, 0x81, 0x77, 0x03, 0x7a, 0x7a,
+    0x77, 0x77, 0x80, 0x7d, 0x06, 0x82, 0x82, 0x7e, 0x7e, 0x89, 0x82, 0x7d,
+    0x80, 0x82, 0x01, 0x7e, 0x7e, 0x81, 0x82, 0x01, 0x85, 0x82, 0x84, 0x87,
+    0x01, 0x91, 0x91, 0x81, 0x95, 0x0e, 0x9b, 0x9b, 0x9f, 0xa7, 0xaf, 0xb4,
+    0xae, 0xa7, 0x82, 0x55, 0x27, 0x07, 0x06, 0x03, 0x01, 0x81, 0x00, 0x03,
+    0x01, 0x01, 0x06, 0x06, 0x80, 0x0f, 0x02, 0x10, 0x17, 0x17, 0x82, 0x1d,
+    0x01, 0x15, 0x1d, 0x81, 0x1f, 0x15, 0x21, 0x1f, 0x1f, 0x21, 0x21, 0x27,
+    0x2a, 0x2e, 0x2f, 0x2f, 0x35, 0x41, 0x42, 0x3b, 0x43, 0x42, 0x42, 0x35,
+    0x37, 0x31, 0x2c, 0x2c, 0x82, 0x1f, 0x09, 0x17, 0x17, 0x10, 0x0f, 0x0f,
+    0x02, 0x02, 0x01, 0x03, 0x03, 0x80, 0x01, 0x02, 0x00, 0x00, 0x01, 0x81,
+    0x06, 0x15, 0x0f, 0x0f, 0x10, 0x10, 0x15, 0x15, 0x1a, 0x21, 0x25, 0x2f,
+    0x3b, 0x4d, 0x64, 0x7a, 0x87, 0xa4, 0xae, 0xb4, 0xc5, 0xc5, 0xce, 0xce,
+    0xa5, 0xd5, 0x80, 0xce, 0x07, 0xc5, 0xc5, 0xb8, 0xb8, 0xa6, 0x9f, 0xdd,
+    0xf9, 0x80, 0xee, 0x06, 0xfe, 0xfe, 0xfd, 0xfd, 0xef, 0xef, 0xf6, 0x80,
+    0xef, 0x02, 0xfc, 0xfe, 0xfb, 0x80, 0xf9, 0x00, 0xf8, 0x80, 0xf7, 0x1c,
+    0xf8, 0xf9, 0xf9, 0xf7, 0xf2, 0xf1, 0xf1, 0xf9, 0xfe, 0xfc, 0xfb, 0xee,
+    0xe8, 0xf9, 0xfb, 0xeb, 0x9c, 0x80, 0xb2, 0xfd, 0xfd, 0xfc, 0xef, 0xef,
+    0xee, 0xed, 0xf9, 0xef, 0x7b, 0x82, 0x68, 0x05, 0x7a, 0x88, 0x68, 0x6e,
+    0x6e, 0x75, 0x86, 0x6e, 0x01, 0x75, 0x75, 0x81, 0x6e, 0x02, 0x75, 0x73,
+    0x7d, 0x81, 0x6e, 0x81, 0x75, 0x81, 0x6e, 0x80, 0x75, 0x84, 0x6e, 0x01,
+    0x75, 0x73, 0x80, 0x75, 0x80, 0x6e, 0x81, 0x75, 0x81, 0x77, 0x00, 0x7a,
+    0x80, 0x77, 0x00, 0x73, 0x80, 0x7d, 0x0f, 0x7a, 0x77, 0x7a, 0x7d, 0x85,
+    0x77, 0x7d, 0x85, 0x89, 0x7d, 0x82, 0x82, 0x7e, 0x7e, 0x82, 0x7e, 0x81,
+    0x82, 0x01, 0x87, 0x85, 0x80, 0x87, 0x16, 0x83, 0x87, 0x87, 0x91, 0x91,
+    0x8c, 0x91, 0x95, 0x95, 0x9b, 0x9b, 0x9f, 0xa7, 0x9e, 0xae, 0xaf, 0x95,
+    0x74, 0x37, 0x1f, 0x0f, 0x06, 0x01, 0x81, 0x00, 0x81, 0x01, 0x0d, 0x06,
+    0x06, 0x0f, 0x0f, 0x10, 0x10, 0x17, 0x17, 0x15, 0x1d, 0x1d, 0x15, 0x17,
+    0x17, 0x81, 0x15, 0x80, 0x17, 0x08, 0x15, 0x1f, 0x1f, 0x1d, 0x1f, 0x1f,
+    0x21, 0x27, 0x27, 0x81, 0x2c, 0x00, 0x27, 0x80, 0x1f, 0x00, 0x17, 0x82,
+    0x14, 0x04, 0x10, 0x0f, 0x0f, 0x06, 0x06, 0x82, 0x01, 0x80, 0x03, 0x80,
+    0x01, 0x14, 0x06, 0x06, 0x02, 0x06, 0x0f, 0x0f, 0x10, 0x15, 0x1f, 0x27,
+    0x2f, 0x3b, 0x59, 0x71, 0x80, 0x9c, 0xa6, 0xb1, 0xc5, 0xce, 0xce, 0x8b,
+    0xd5, 0x86, 0xce, 0x85, 0xc5, 0x87, 0xce, 0x86, 0xd5, 0x80, 0xce, 0x02,
+    0xc5, 0xef, 0xf9, 0x80, 0xee, 0x11, 0xfb, 0xfb, 0xfe, 0xfd, 0xef, 0xfc,
+    0xfd, 0xf6, 0xef, 0xef, 0xfa, 0xf9, 0xf9, 0xfb, 0xf9, 0xf7, 0xf4, 0xf4,
+    0x80, 0xf7, 0x1b, 0xf8, 0xf9, 0xf7, 0xf9, 0xf1, 0xf1, 0xf8, 0xf8, 0xfe,
+    0xfe, 0xee, 0xed, 0xf1, 0xf9, 0xee, 0x94, 0x87, 0xcd, 0xf6, 0xfd, 0xfd,
+    0xef, 0xef, 0xeb, 0xeb, 0xee, 0xfb, 0xa9, 0x82, 0x68, 0x0b, 0xc3, 0xda,
+    0x94, 0x70, 0x70, 0x75, 0x68, 0x6e, 0x75, 0x6e, 0x75, 0x75, 0x82, 0x6e,
+    0x0c, 0x75, 0x75, 0x6e, 0x75, 0x75, 0x73, 0x73, 0x75, 0x73, 0x73, 0x75,
+    0x73, 0x73, 0x80, 0x75, 0x85, 0x6e, 0x03, 0x75, 0x73, 0x75, 0x75, 0x80,
+    0x6e, 0x82, 0x75, 0x80, 0x6e, 0x03, 0x75, 0x6e, 0x77, 0x77, 0x80, 0x7a,
+    0x01, 0x7d, 0x77, 0x80, 0x7d, 0x80, 0x7a, 0x0e, 0x77, 0x7d, 0x7d, 0x81,
+    0x7a, 0x7d, 0x7d, 0x89, 0x7d, 0x89, 0x82, 0x85, 0x82, 0x82, 0x7e, 0x84,
+    0x82, 0x02, 0x92, 0x87, 0x83, 0x81, 0x87, 0x12, 0x8c, 0x91, 0x91, 0x95,
+    0x95, 0x9b, 0x9b, 0x9e, 0xa7, 0xa7, 0xaf, 0xa7, 0x82, 0x55, 0x2c, 0x10,
+    0x02, 0x03, 0x01, 0x80, 0x00, 0x80, 0x01, 0x04, 0x03, 0x06, 0x02, 0x06,
+    0x06, 0x80, 0x0f, 0x80, 0x10, 0x80, 0x17, 0x08, 0x10, 0x10, 0x17, 0x10,
+    0x14, 0x14, 0x10, 0x17, 0x17, 0x83, 0x10, 0x80, 0x17, 0x00, 0x15, 0x81,
+    0x17, 0x0c, 0x14, 0x14, 0x05, 0x13, 0x0f, 0x05, 0x05, 0x0f, 0x0f, 0x06,
+    0x06, 0x01, 0x03, 0x80, 0x01, 0x80, 0x03, 0x03, 0x01, 0x01, 0x06, 0x01,
+    0x81, 0x06, 0x0d, 0x0f, 0x07, 0x15, 0x21, 0x2a, 0x3b, 0x59, 0x7a, 0x91,
+    0xa6, 0xae, 0xc5, 0xc5, 0xce, 0x88, 0xd5, 0x83, 0xce, 0x0a, 0xc5, 0xc5,
+    0xc2, 0xc5, 0xc5, 0xc2, 0xc5, 0xc2, 0xc2, 0xc5, 0xc5, 0x85, 0xb8, 0x03,
+    0xc2, 0xc5, 0xc2, 0xbd, 0x80, 0xc2, 0x08, 0xc5, 0xc5, 0xc2, 0xc5, 0xce,
+    0xce, 0xcc, 0xd8, 0xd7, 0x83, 0xd5, 0x01, 0xef, 0xf9, 0x80, 0xee, 0x80,
+    0xfb, 0x06, 0xfc, 0xef, 0xef, 0xfd, 0xf6, 0xfd, 0xfc, 0x80, 0xf9, 0x02,
+    0xfb, 0xf9, 0xf7, 0x83, 0xf4, 0x80, 0xf8, 0x80, 0xf7, 0x02, 0xf4, 0xf7,
+    0xf9, 0x80, 0xf7, 0x04, 0xfe, 0xfe, 0xa5, 0x82, 0xd4, 0x80, 0xfd, 0x80,
+    0xef, 0x16, 0xeb, 0xee, 0xfc, 0xe1, 0x64, 0x60, 0x71, 0x71, 0xb2, 0xda,
+    0xfb, 0xc1, 0x71, 0x70, 0x68, 0x70, 0x70, 0x75, 0x68, 0x70, 0x70, 0x68,
+    0x68, 0x85, 0x75, 0x01, 0x6e, 0x6e, 0x86, 0x75, 0x08, 0x6e, 0x6e, 0x75,
+    0x6e, 0x6e, 0x75, 0x6e, 0x75, 0x6e, 0x80, 0x75, 0x00, 0x6e, 0x82, 0x75,
+    0x03, 0x6e, 0x6e, 0x75, 0x75, 0x80, 0x6e, 0x02, 0x7d, 0x7a, 0x73, 0x80,
+    0x7d, 0x16, 0x77, 0x7d, 0x7d, 0x73, 0x73, 0x7a, 0x77, 0x7d, 0x7a, 0x77,
+    0x7a, 0x77, 0x77, 0x81, 0x7a, 0x77, 0x7d, 0x77, 0x77, 0x82, 0x82, 0x7e,
+    0x7e, 0x80, 0x82, 0x03, 0x7e, 0x7e, 0x82, 0x7e, 0x80, 0x83, 0x82, 0x87,
+    0x80, 0x91, 0x0c, 0x95, 0x9b, 0x9b, 0x9f, 0xa7, 0xaf, 0xa7, 0x8a, 0x74,
+    0x3b, 0x1d, 0x0f, 0x01, 0x84, 0x00, 0x06, 0x01, 0x01, 0x00, 0x01, 0x02,
+    0x02, 0x06, 0x81, 0x0f, 0x82, 0x10, 0x85, 0x0f, 0x04, 0x02, 0x06, 0x02,
+    0x06, 0x06, 0x84, 0x0f, 0x14, 0x0c, 0x05, 0x05, 0x0c, 0x0c, 0x0f, 0x05,
+    0x02, 0x06, 0x02, 0x01, 0x01, 0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x03,
+    0x01, 0x03, 0x83, 0x06, 0x0b, 0x07, 0x15, 0x27, 0x37, 0x4d, 0x71, 0x8c,
+    0xa6, 0xae, 0xc5, 0xc5, 0xce, 0x86, 0xd5, 0x81, 0xce, 0x80, 0xc5, 0x03,
+    0xc2, 0xc2, 0xbd, 0xc2, 0x87, 0xb8, 0x03, 0xae, 0xae, 0xb8, 0xae, 0x8d,
+    0xb8, 0x06, 0xc5, 0xcb, 0xe1, 0xeb, 0xe1, 0xd7, 0xc9, 0x80, 0xce, 0x17,
+    0xd5, 0xfc, 0xf8, 0xf9, 0xed, 0xed, 0xfb, 0xfa, 0xf9, 0xfb, 0xfc, 0xfe,
+    0xf9, 0xf9, 0xfa, 0xfa, 0xf8, 0xf9, 0xf9, 0xfa, 0xf9, 0xf7, 0xf3, 0xf4,
+    0x81, 0xf3, 0x10, 0xf7, 0xf8, 0xf7, 0xf0, 0xf4, 0xf4, 0xf3, 0xf4, 0xf7,
+    0xf4, 0xf7, 0xf4, 0xfa, 0xfc, 0xdd, 0x86, 0xc1, 0x81, 0xfd, 0x10, 0xef,
+    0xef, 0xeb, 0xeb, 0xfe, 0xef, 0x7f, 0x60, 0x71, 0xb9, 0xf6, 0xfd, 0xfb,
+    0xef, 0xa9, 0x71, 0x68, 0x80, 0x70, 0x03, 0x68, 0x68, 0x70, 0x68, 0x81,
+    0x70, 0x01, 0x6e, 0x68, 0x81, 0x75, 0x00, 0x6e, 0x82, 0x75, 0x04, 0x6e,
+    0x6e, 0x75, 0x6e, 0x6e, 0x80, 0x75, 0x00, 0x6e, 0x80, 0x75, 0x01, 0x6e,
+    0x6e, 0x8c, 0x75, 0x82, 0x7d, 0x00, 0x73, 0x82, 0x7d, 0x0f, 0x77, 0x7a,
+    0x73, 0x73, 0x77, 0x7a, 0x77, 0x77, 0x7a, 0x77, 0x73, 0x73, 0x77, 0x7a,
+    0x7a, 0x7d, 0x81, 0x82, 0x84, 0x7e, 0x00, 0x83, 0x81, 0x87, 0x08, 0x80,
+    0x87, 0x91, 0x8a, 0x91, 0x95, 0x9b, 0x9b, 0x9f, 0x80, 0xa7, 0x05, 0x82,
+    0x55, 0x2c, 0x10, 0x06, 0x01, 0x84, 0x00, 0x83, 0x01, 0x01, 0x06, 0x06,
+    0x83, 0x0f, 0x00, 0x07, 0x82, 0x0f, 0x08, 0x02, 0x06, 0x02, 0x02, 0x00,
+    0x01, 0x06, 0x01, 0x02, 0x81, 0x06, 0x08, 0x0c, 0x05, 0x04, 0x02, 0x04,
+    0x04, 0x02, 0x06, 0x02, 0x82, 0x01, 0x05, 0x00, 0x00, 0x01, 0x03, 0x01,
+    0x01, 0x80, 0x03, 0x0d, 0x06, 0x06, 0x02, 0x02, 0x10, 0x1f, 0x2f, 0x47,
+    0x64, 0x80, 0xa6, 0xae, 0xc5, 0xce, 0x86, 0xd5, 0x80, 0xce, 0x82, 0xc5,
+    0x01, 0xb8, 0xc5, 0x84, 0xb8, 0x02, 0xae, 0xb4, 0xb4, 0x82, 0xaa, 0x00,
+    0xb4, 0x8a, 0xaa, 0x00, 0xb4, 0x81, 0xaa, 0x07, 0xb8, 0xcc, 0xe1, 0xf9,
+    0xf7, 0xfe, 0xe1, 0xcc, 0x80, 0xc5, 0x01, 0xd7, 0xfb, 0x80, 0xf9, 0x01,
+    0xfa, 0xfa, 0x80, 0xf9, 0x04, 0xfb, 0xf8, 0xf4, 0xf7, 0xf4, 0x82, 0xf8,
+    0x00, 0xf7, 0x83, 0xf3, 0x04, 0xf5, 0xf3, 0xf4, 0xf7, 0xf4, 0x80, 0xf3,
+    0x02, 0xf4, 0xf3, 0xf3, 0x80, 0xf4, 0x18, 0xf9, 0xfb, 0xa9, 0xc1, 0xfc,
+    0xfb, 0xfc, 0xfd, 0xfd, 0xef, 0xef, 0xeb, 0xfe, 0xef, 0x7b, 0x64, 0xa9,
+    0xfd, 0xfd, 0xfe, 0xee, 0xfa, 0xdd, 0x7f, 0x6b, 0x80, 0x68, 0x05, 0x70,
+    0x70, 0x68, 0x68, 0x70, 0x70, 0x80, 0x68, 0x80, 0x70, 0x00, 0x68, 0x80,
+    0x75, 0x02, 0x6e, 0x68, 0x75, 0x80, 0x6e, 0x02, 0x75, 0x6e, 0x68, 0x80,
+    0x75, 0x01, 0x6e, 0x6e, 0x80, 0x75, 0x00, 0x6e, 0x84, 0x75, 0x00, 0x6e,
+    0x80, 0x75, 0x09, 0x6e, 0x68, 0x70, 0x68, 0x75, 0x7a, 0x73, 0x7d, 0x73,
+    0x73, 0x80, 0x7d, 0x14, 0x81, 0x7a, 0x7d, 0x7d, 0x73, 0x73, 0x7a, 0x7a,
+    0x73, 0x7a, 0x77, 0x77, 0x7d, 0x73, 0x7d, 0x7d, 0x77, 0x82, 0x7d, 0x7d,
+    0x7e, 0x80, 0x82, 0x00, 0x7e, 0x80, 0x82, 0x06, 0x7e, 0x82, 0x82, 0x87,
+    0x83, 0x83, 0x80, 0x80, 0x87, 0x00, 0x91, 0x80, 0x95, 0x0a, 0x9b, 0x9f,
+    0x9e, 0xa7, 0x95, 0x6c, 0x37, 0x15, 0x06, 0x01, 0x03, 0x84, 0x00, 0x83,
+    0x01, 0x80, 0x06, 0x00, 0x02, 0x82, 0x0f, 0x10, 0x05, 0x0f, 0x02, 0x06,
+    0x02, 0x02, 0x00, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x01, 0x02, 0x06,
+    0x06, 0x80, 0x02, 0x01, 0x04, 0x04, 0x80, 0x01, 0x02, 0x00, 0x01, 0x03,
+    0x81, 0x00, 0x80, 0x01, 0x0f, 0x03, 0x01, 0x01, 0x06, 0x06, 0x02, 0x02,
+    0x10, 0x21, 0x2f, 0x5b, 0x7a, 0x9c, 0xae, 0xc2, 0xce, 0x85, 0xd5, 0x81,
+    0xce, 0x82, 0xc5, 0x03, 0xb8, 0xbd, 0xb8, 0xb8, 0x86, 0xaa, 0x01, 0xb4,
+    0xb4, 0x80, 0x9e, 0x0d, 0xae, 0xae, 0xa7, 0xa6, 0xac, 0xa6, 0xa6, 0xac,
+    0xa6, 0xa6, 0xae, 0xa6, 0xae, 0xa6, 0x84, 0xaa, 0x0c, 0xb1, 0xe1, 0xfa,
+    0xf2, 0xed, 0xfe, 0xfd, 0xe1, 0xcb, 0xb8, 0xb8, 0xcb, 0xfa, 0x83, 0xf9,
+    0x80, 0xf8, 0x08, 0xf7, 0xfe, 0xfe, 0xf7, 0xf9, 0xfb, 0xf9, 0xf7, 0xf7,
+    0x84, 0xf3, 0x04, 0xf7, 0xf9, 0xf7, 0xf7, 0xf4, 0x83, 0xf3, 0x80, 0xf4,
+    0x1a, 0xf7, 0xf9, 0xd1, 0xe1, 0xf9, 0xf9, 0xfe, 0xfe, 0xf9, 0xfa, 0xfb,
+    0xed, 0xfe, 0xfc, 0x97, 0xa9, 0xfd, 0xfc, 0xfb, 0xee, 0xeb, 0xed, 0xeb,
+    0x7b, 0x60, 0x60, 0x68, 0x81, 0x6b, 0x81, 0x68, 0x83, 0x70, 0x01, 0x75,
+    0x70, 0x80, 0x68, 0x01, 0x6e, 0x6e, 0x81, 0x75, 0x04, 0x70, 0x68, 0x68,
+    0x70, 0x75, 0x82, 0x68, 0x00, 0x75, 0x80, 0x70, 0x01, 0x68, 0x68, 0x82,
+    0x75, 0x80, 0x70, 0x03, 0x68, 0x7a, 0x73, 0x75, 0x80, 0x6e, 0x02, 0x81,
+    0x7d, 0x73, 0x80, 0x7a, 0x06, 0x7d, 0x73, 0x73, 0x7a, 0x73, 0x73, 0x7d,
+    0x80, 0x6e, 0x03, 0x7a, 0x7a, 0x7d, 0x77, 0x80, 0x7a, 0x00, 0x7e, 0x80,
+    0x82, 0x06, 0x7e, 0x7e, 0x82, 0x82, 0x7e, 0x82, 0x7e, 0x80, 0x83, 0x81,
+    0x87, 0x01, 0x91, 0x91, 0x80, 0x95, 0x09, 0x93, 0xa7, 0xa7, 0x9b, 0x81,
+    0x4d, 0x27, 0x07, 0x06, 0x03, 0x88, 0x00, 0x05, 0x01, 0x00, 0x01, 0x01,
+    0x06, 0x02, 0x80, 0x06, 0x00, 0x0f, 0x81, 0x06, 0x00, 0x02, 0x83, 0x00,
+    0x05, 0x01, 0x03, 0x03, 0x01, 0x01, 0x00, 0x82, 0x01, 0x00, 0x00, 0x80,
+    0x01, 0x82, 0x00, 0x01, 0x01, 0x00, 0x80, 0x03, 0x0d, 0x01, 0x06, 0x02,
+    0x02, 0x05, 0x15, 0x27, 0x3a, 0x59, 0x87, 0xa6, 0xb1, 0xc5, 0xce, 0x83,
+    0xd5, 0x80, 0xce, 0x01, 0xc5, 0xce, 0x82, 0xc5, 0x81, 0xb8, 0x00, 0xb4,
+    0x81, 0xaa, 0x00, 0xb4, 0x80, 0xaa, 0x83, 0x9e, 0x01, 0xa7, 0xa7, 0x82,
+    0x9e, 0x05, 0xa7, 0xac, 0xac, 0xa6, 0xa7, 0xa7, 0x82, 0x9e, 0x12, 0xa7,
+    0xac, 0xa7, 0x9e, 0xa6, 0xb1, 0xeb, 0xf8, 0xee, 0xed, 0xf8, 0xfb, 0xfd,
+    0xf6, 0xcb, 0xb8, 0xcb, 0xf9, 0xf8, 0x80, 0xf9, 0x0c, 0xf8, 0xf9, 0xf8,
+    0xf7, 0xf7, 0xf4, 0xfe, 0xfd, 0xfe, 0xf7, 0xf7, 0xf8, 0xf7, 0x83, 0xf3,
+    0x05, 0xf5, 0xf4, 0xf8, 0xfe, 0xfc, 0xf9, 0x84, 0xf3, 0x1b, 0xf4, 0xf7,
+    0xf7, 0xf4, 0xf4, 0xee, 0xd1, 0xf4, 0xf7, 0xf8, 0xf7, 0xf7, 0xf9, 0xfa,
+    0xf7, 0xf9, 0xfe, 0xdd, 0xfc, 0xfe, 0xfb, 0xfa, 0xfa, 0xf9, 0xf9, 0xee,
+    0x88, 0x6b, 0x80, 0x60, 0x00, 0x68, 0x80, 0x6b, 0x00, 0x68, 0x80, 0x70,
+    0x02, 0x68, 0x70, 0x68, 0x81, 0x70, 0x01, 0x68, 0x70, 0x81, 0x68, 0x80,
+    0x70, 0x80, 0x68, 0x80, 0x70, 0x02, 0x68, 0x70, 0x70, 0x81, 0x68, 0x02,
+    0x70, 0x70, 0x68, 0x80, 0x70, 0x00, 0x68, 0x82, 0x70, 0x04, 0x7a, 0x6e,
+    0x73, 0x7a, 0x7a, 0x81, 0x7d, 0x00, 0x73, 0x80, 0x7a, 0x02, 0x73, 0x7d,
+    0x7d, 0x80, 0x6e, 0x80, 0x7d, 0x0c, 0x7a, 0x7a, 0x7d, 0x7a, 0x7e, 0x7a,
+    0x81, 0x7d, 0x7e, 0x82, 0x82, 0x7e, 0x7e, 0x81, 0x82, 0x17, 0x7e, 0x82,
+    0x82, 0x83, 0x83, 0x87, 0x83, 0x83, 0x87, 0x91, 0x8a, 0x8a, 0x95, 0x95,
+    0x9b, 0xa7, 0x9f, 0x87, 0x63, 0x2f, 0x17, 0x06, 0x06, 0x01, 0x8b, 0x00,
+    0x02, 0x03, 0x01, 0x03, 0x81, 0x06, 0x13, 0x02, 0x01, 0x00, 0x01, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x03, 0x03, 0x00,
+    0x00, 0x03, 0x03, 0x80, 0x01, 0x82, 0x00, 0x11, 0x01, 0x00, 0x03, 0x01,
+    0x03, 0x03, 0x06, 0x02, 0x02, 0x07, 0x15, 0x27, 0x47, 0x64, 0xa4, 0xa6,
+    0xc5, 0xce, 0x83, 0xd5, 0x80, 0xce, 0x83, 0xc5, 0x03, 0xb8, 0xc5, 0xb8,
+    0xb8, 0x84, 0xaa, 0x81, 0x9e, 0x80, 0xac, 0x01, 0xa6, 0xa7, 0x80, 0x9e,
+    0x80, 0xa7, 0x00, 0x9e, 0x81, 0xa7, 0x00, 0x9f, 0x81, 0x9e, 0x80, 0xa7,
+    0x14, 0x9e, 0x9e, 0xa7, 0xa7, 0x9e, 0xa7, 0xa6, 0xb2, 0xed, 0xf9, 0xf9,
+    0xf7, 0xf4, 0xf8, 0xfa, 0xfe, 0xf6, 0xcd, 0xb1, 0xfa, 0xf7, 0x80, 0xf9,
+    0x80, 0xf8, 0x09, 0xf7, 0xf7, 0xf4, 0xf4, 0xfe, 0xfb, 0xf8, 0xf4, 0xf3,
+    0xf4, 0x80, 0xf3, 0x09, 0xf4, 0xf9, 0xfc, 0xf9, 0xf4, 0xf4, 0xfa, 0xfe,
+    0xfe, 0xf4, 0x83, 0xf3, 0x13, 0xf9, 0xfe, 0xfd, 0xf9, 0xf3, 0xf4, 0xf0,
+    0xf7, 0xf7, 0xf4, 0xf3, 0xf3, 0xf8, 0xf9, 0xf7, 0xf7, 0xf9, 0xfa, 0xf9,
+    0xf8, 0x81, 0xf7, 0x02, 0xf9, 0xee, 0x88, 0x82, 0x60, 0x81, 0x6b, 0x03,
+    0x68, 0x68, 0x70, 0x70, 0x80, 0x68, 0x80, 0x70, 0x82, 0x68, 0x01, 0x70,
+    0x68, 0x80, 0x70, 0x01, 0x68, 0x68, 0x83, 0x70, 0x80, 0x68, 0x84, 0x70,
+    0x00, 0x68, 0x82, 0x70, 0x80, 0x6e, 0x01, 0x75, 0x75, 0x81, 0x7d, 0x00,
+    0x75, 0x82, 0x7d, 0x0b, 0x81, 0x7d, 0x7d, 0x7a, 0x73, 0x7d, 0x73, 0x73,
+    0x7a, 0x77, 0x7d, 0x7e, 0x80, 0x77, 0x07, 0x7e, 0x7d, 0x85, 0x85, 0x7e,
+    0x85, 0x7a, 0x85, 0x80, 0x82, 0x00, 0x7e, 0x80, 0x82, 0x00, 0x83, 0x80,
+    0x87, 0x0d, 0x91, 0x8a, 0x8c, 0x95, 0x95, 0x93, 0x9f, 0x95, 0x75, 0x3b,
+    0x1f, 0x0f, 0x02, 0x03, 0x88, 0x00, 0x00, 0x01, 0x80, 0x00, 0x0d, 0x01,
+    0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x03, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x83, 0x00, 0x05, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x84, 0x00,
+    0x80, 0x01, 0x0d, 0x03, 0x01, 0x06, 0x06, 0x05, 0x10, 0x15, 0x2a, 0x47,
+    0x71, 0x9c, 0xb4, 0xc5, 0xce, 0x82, 0xd5, 0x80, 0xce, 0x81, 0xc5, 0x05,
+    0xb8, 0xc5, 0xb8, 0xbd, 0xae, 0xb4, 0x84, 0xaa, 0x02, 0xa6, 0xa6, 0xac,
+    0x80, 0x9e, 0x11, 0xa7, 0x9e, 0xa7, 0x9e, 0xa7, 0x9e, 0x9e, 0x9f, 0x9f,
+    0x9e, 0x93, 0x9f, 0x9e, 0x9c, 0x9f, 0x9f, 0x93, 0x9f, 0x80, 0x93, 0x11,
+    0x9f, 0x93, 0x9f, 0x9e, 0x9e, 0x9f, 0x9b, 0x9c, 0x9b, 0x9f, 0x9f, 0xb1,
+    0xee, 0xf8, 0xf7, 0xf4, 0xf7, 0xf9, 0x80, 0xfe, 0x08, 0xfd, 0xd4, 0xfb,
+    0xf8, 0xfa, 0xf9, 0xf9, 0xf8, 0xf8, 0x80, 0xf7, 0x14, 0xf3, 0xf3, 0xf7,
+    0xfa, 0xf9, 0xf7, 0xf3, 0xf4, 0xf4, 0xf3, 0xf3, 0xf7, 0xf7, 0xfc, 0xfe,
+    0xf3, 0xf3, 0xf9, 0xfb, 0xfa, 0xf7, 0x82, 0xf3, 0x06, 0xf8, 0xf8, 0xfe,
+    0xfc, 0xfb, 0xf3, 0xf3, 0x80, 0xf4, 0x80, 0xf3, 0x0e, 0xf7, 0xf8, 0xf4,
+    0xf4, 0xf8, 0xf8, 0xf7, 0xf7, 0xf4, 0xf3, 0xf3, 0xf4, 0xf9, 0xf9, 0x8f,
+    0x82, 0x60, 0x05, 0x6b, 0x6b, 0x68, 0x6b, 0x68, 0x6b, 0x82, 0x68, 0x12,
+    0x70, 0x68, 0x68, 0x70, 0x70, 0x68, 0x70, 0x70, 0x68, 0x70, 0x70, 0x68,
+    0x68, 0x70, 0x70, 0x68, 0x70, 0x70, 0x68, 0x81, 0x70, 0x05, 0x68, 0x70,
+    0x70, 0x68, 0x70, 0x68, 0x81, 0x70, 0x00, 0x68, 0x80, 0x70, 0x02, 0x75,
+    0x73, 0x73, 0x82, 0x75, 0x01, 0x73, 0x75, 0x83, 0x7d, 0x16, 0x73, 0x73,
+    0x7a, 0x7a, 0x7d, 0x73, 0x7d, 0x73, 0x7a, 0x77, 0x7a, 0x77, 0x7d, 0x77,
+    0x7a, 0x77, 0x7a, 0x77, 0x7e, 0x77, 0x82, 0x7a, 0x82, 0x80, 0x7e, 0x07,
+    0x82, 0x7e, 0x7e, 0x83, 0x7e, 0x83, 0x87, 0x87, 0x80, 0x91, 0x0a, 0x95,
+    0x93, 0x9b, 0x95, 0x7d, 0x55, 0x2a, 0x10, 0x06, 0x03, 0x01, 0x8d, 0x00,
+    0x00, 0x03, 0x83, 0x01, 0x01, 0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x88,
+    0x00, 0x81, 0x01, 0x0c, 0x03, 0x01, 0x06, 0x05, 0x10, 0x15, 0x2c, 0x43,
+    0x71, 0x93, 0xae, 0xc2, 0xce, 0x81, 0xd5, 0x01, 0xce, 0xce, 0x81, 0xc5,
+    0x81, 0xb8, 0x01, 0xae, 0xb4, 0x83, 0xaa, 0x0d, 0xa6, 0xa7, 0xa6, 0x9e,
+    0xa7, 0xa7, 0xa6, 0xa7, 0x9e, 0x9e, 0x9f, 0x9e, 0x93, 0x9f, 0x85, 0x93,
+    0x00, 0x9b, 0x8e, 0x93, 0x80, 0x9b, 0x01, 0xab, 0xdd, 0x80, 0xf8, 0x80,
+    0xf7, 0x08, 0xf8, 0xfa, 0xfb, 0xfc, 0xfe, 0xfb, 0xfb, 0xf9, 0xf8, 0x81,
+    0xf7, 0x00, 0xf4, 0x80, 0xf3, 0x12, 0xf8, 0xf9, 0xf8, 0xf3, 0xf3, 0xf4,
+    0xf5, 0xf4, 0xf9, 0xf7, 0xfb, 0xfa, 0xf7, 0xf3, 0xf4, 0xfe, 0xfa, 0xf9,
+    0xf7, 0x80, 0xf3, 0x06, 0xf7, 0xf7, 0xf4, 0xfb, 0xfe, 0xf9, 0xf4, 0x83,
+    0xf3, 0x04, 0xec, 0xf4, 0xf7, 0xf4, 0xf3, 0x81, 0xf4, 0x80, 0xf3, 0x03,
+    0xf4, 0xf7, 0xf7, 0x8f, 0x86, 0x60, 0x80, 0x6b, 0x02, 0x68, 0x68, 0x6b,
+    0x82, 0x68, 0x80, 0x70, 0x85, 0x68, 0x85, 0x70, 0x13, 0x68, 0x6b, 0x6b,
+    0x70, 0x70, 0x68, 0x68, 0x70, 0x70, 0x68, 0x68, 0x70, 0x70, 0x6b, 0x6e,
+    0x6e, 0x75, 0x6e, 0x75, 0x75, 0x80, 0x6e, 0x82, 0x75, 0x81, 0x7d, 0x01,
+    0x73, 0x7d, 0x82, 0x6e, 0x04, 0x77, 0x7a, 0x77, 0x73, 0x73, 0x81, 0x77,
+    0x05, 0x7e, 0x7e, 0x77, 0x77, 0x7d, 0x77, 0x80, 0x7e, 0x80, 0x82, 0x01,
+    0x83, 0x83, 0x81, 0x87, 0x0b, 0x8a, 0x8c, 0x8c, 0x95, 0x95, 0x87, 0x63,
+    0x37, 0x15, 0x02, 0x06, 0x01, 0x8a, 0x00, 0x01, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x00, 0x82, 0x01, 0x01, 0x00, 0x01, 0x8c, 0x00, 0x12, 0x01, 0x00,
+    0x00, 0x01, 0x01, 0x03, 0x01, 0x03, 0x01, 0x06, 0x10, 0x15, 0x2a, 0x43,
+    0x71, 0x93, 0xae, 0xc5, 0xce, 0x81, 0xd5, 0x00, 0xce, 0x81, 0xc5, 0x04,
+    0xb8, 0xc5, 0xb8, 0xbd, 0xb4, 0x80, 0xaa, 0x01, 0xb4, 0xac, 0x82, 0x9e,
+    0x05, 0xa7, 0xac, 0x9e, 0x9e, 0x9f, 0x9f, 0x82, 0x93, 0x80, 0x9b, 0x02,
+    0x93, 0x93, 0x9b, 0x80, 0x93, 0x02, 0x9b, 0x93, 0x9b, 0x82, 0x93, 0x01,
+    0x95, 0x95, 0x80, 0x93, 0x00, 0x9b, 0x83, 0x93, 0x00, 0x9b, 0x80, 0x93,
+    0x04, 0xdd, 0xf7, 0xf8, 0xfe, 0xf9, 0x82, 0xf7, 0x00, 0xf8, 0x80, 0xfa,
+    0x01, 0xf9, 0xf8, 0x80, 0xf7, 0x00, 0xf4, 0x82, 0xf3, 0x1a, 0xf7, 0xf7,
+    0xf3, 0xf5, 0xf5, 0xf3, 0xf7, 0xf9, 0xf7, 0xf4, 0xf9, 0xf7, 0xf3, 0xf3,
+    0xf9, 0xfc, 0xf8, 0xf8, 0xf3, 0xf5, 0xf3, 0xf4, 0xec, 0xf4, 0xf9, 0xf8,
+    0xf7, 0x82, 0xf3, 0x80, 0xec, 0x01, 0xf3, 0xf7, 0x86, 0xf3, 0x0b, 0xf4,
+    0xf7, 0xf0, 0x8f, 0x60, 0x66, 0x60, 0x66, 0x66, 0x60, 0x6b, 0x60, 0x82,
+    0x6b, 0x82, 0x68, 0x01, 0x70, 0x70, 0x83, 0x68, 0x03, 0x70, 0x6b, 0x6b,
+    0x70, 0x80, 0x68, 0x07, 0x70, 0x68, 0x6b, 0x70, 0x68, 0x6b, 0x68, 0x68,
+    0x80, 0x6b, 0x02, 0x68, 0x68, 0x6b, 0x81, 0x68, 0x01, 0x6b, 0x6b, 0x84,
+    0x75, 0x02, 0x73, 0x7a, 0x75, 0x81, 0x6e, 0x80, 0x7d, 0x02, 0x73, 0x7d,
+    0x7d, 0x80, 0x6e, 0x00, 0x7a, 0x81, 0x6e, 0x80, 0x77, 0x05, 0x7a, 0x77,
+    0x77, 0x7a, 0x77, 0x82, 0x81, 0x77, 0x00, 0x82, 0x80, 0x7e, 0x12, 0x82,
+    0x7e, 0x83, 0x87, 0x83, 0x87, 0x87, 0x80, 0x8c, 0x8c, 0x95, 0x95, 0x91,
+    0x68, 0x42, 0x21, 0x0f, 0x06, 0x03, 0x8c, 0x00, 0x80, 0x01, 0x04, 0x00,
+    0x01, 0x03, 0x01, 0x00, 0x80, 0x01, 0x02, 0x03, 0x01, 0x01, 0x81, 0x00,
+    0x00, 0x01, 0x86, 0x00, 0x01, 0x01, 0x00, 0x80, 0x01, 0x09, 0x06, 0x07,
+    0x15, 0x2c, 0x47, 0x71, 0x9b, 0xae, 0xc5, 0xce, 0x80, 0xd5, 0x04, 0xce,
+    0xce, 0xc5, 0xc5, 0xc2, 0x81, 0xb8, 0x00, 0xae, 0x81, 0xb4, 0x80, 0x9e,
+    0x00, 0xa7, 0x82, 0x9e, 0x00, 0xa7, 0x80, 0x9f, 0x05, 0x93, 0x9b, 0x9b,
+    0x93, 0x93, 0x9b, 0x82, 0x93, 0x0a, 0x95, 0x95, 0x93, 0x93, 0x95, 0x95,
+    0x8c, 0x8c, 0x93, 0x95, 0x95, 0x82, 0x8c, 0x81, 0x95, 0x80, 0x93, 0x02,
+    0x95, 0x95, 0xb1, 0x80, 0xe1, 0x05, 0xf2, 0xf4, 0xf4, 0xf9, 0xfe, 0xfb,
+    0x80, 0xf7, 0x01, 0xf4, 0xf4, 0x81, 0xf7, 0x00, 0xf8, 0x80, 0xf7, 0x00,
+    0xf4, 0x86, 0xf3, 0x16, 0xf5, 0xf3, 0xf7, 0xf7, 0xf3, 0xec, 0xf4, 0xf7,
+    0xf3, 0xf3, 0xf9, 0xf9, 0xf7, 0xf8, 0xf9, 0xf3, 0xf3, 0xec, 0xec, 0xea,
+    0xf9, 0xf7, 0xf7, 0x82, 0xf3, 0x80, 0xec, 0x01, 0xf3, 0xf4, 0x86, 0xf3,
+    0x03, 0xf4, 0xf7, 0xe8, 0x88, 0x84, 0x60, 0x83, 0x6b, 0x89, 0x68, 0x03,
+    0x70, 0x70, 0x68, 0x70, 0x84, 0x68, 0x82, 0x6b, 0x03, 0x68, 0x60, 0x68,
+    0x60, 0x81, 0x6b, 0x80, 0x60, 0x00, 0x68, 0x82, 0x75, 0x03, 0x6e, 0x73,
+    0x75, 0x75, 0x80, 0x6e, 0x00, 0x75, 0x81, 0x6e, 0x04, 0x75, 0x7d, 0x73,
+    0x7d, 0x7d, 0x84, 0x6e, 0x05, 0x7a, 0x7a, 0x7d, 0x73, 0x77, 0x7a, 0x81,
+    0x77, 0x05, 0x7a, 0x77, 0x7d, 0x85, 0x85, 0x82, 0x80, 0x7e, 0x83, 0x83,
+    0x08, 0x80, 0x8a, 0x95, 0x91, 0x7a, 0x55, 0x2a, 0x10, 0x06, 0x80, 0x01,
+    0x8b, 0x00, 0x80, 0x01, 0x08, 0x03, 0x03, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x00, 0x80, 0x01, 0x13, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x06, 0x0f, 0x10, 0x27,
+    0x3b, 0x64, 0x8c, 0xae, 0xc5, 0xce, 0x80, 0xd5, 0x08, 0xce, 0xce, 0xc5,
+    0xc5, 0xc2, 0xb8, 0xbd, 0xbd, 0xb4, 0x81, 0xaa, 0x05, 0xb4, 0xac, 0xa6,
+    0xa7, 0xac, 0xa7, 0x81, 0x9e, 0x02, 0x93, 0x93, 0x9f, 0x80, 0x9b, 0x0d,
+    0x93, 0x93, 0x95, 0x93, 0x95, 0x95, 0x93, 0x95, 0x93, 0x8c, 0x93, 0x95,
+    0x95, 0x8c, 0x81, 0x95, 0x00, 0x8c, 0x81, 0x95, 0x82, 0x8c, 0x80, 0x95,
+    0x15, 0x8c, 0x8c, 0x95, 0x95, 0xb1, 0xdd, 0xf9, 0xed, 0xf9, 0xf4, 0xf7,
+    0xf4, 0xf7, 0xfa, 0xfc, 0xf9, 0xf4, 0xf4, 0xf7, 0xfe, 0xfe, 0xfa, 0x81,
+    0xf7, 0x01, 0xf4, 0xf4, 0x87, 0xf3, 0x03, 0xf5, 0xf3, 0xf7, 0xf4, 0x80,
+    0xec, 0x10, 0xf4, 0xf3, 0xf4, 0xf7, 0xf3, 0xf3, 0xf4, 0xf8, 0xf7, 0xf3,
+    0xec, 0xec, 0xea, 0xf9, 0xf7, 0xf4, 0xec, 0x80, 0xf3, 0x81, 0xec, 0x88,
+    0xf3, 0x03, 0xf4, 0xf3, 0xd1, 0x7b, 0x84, 0x60, 0x09, 0x6b, 0x6b, 0x68,
+    0x68, 0x6b, 0x6b, 0x68, 0x68, 0x6b, 0x6b, 0x84, 0x68, 0x01, 0x70, 0x70,
+    0x80, 0x68, 0x07, 0x70, 0x68, 0x68, 0x70, 0x70, 0x68, 0x68, 0x70, 0x81,
+    0x6b, 0x08, 0x60, 0x68, 0x60, 0x6b, 0x60, 0x6b, 0x6b, 0x60, 0x6b, 0x80,
+    0x60, 0x21, 0x75, 0x6e, 0x75, 0x6e, 0x6e, 0x75, 0x75, 0x73, 0x75, 0x75,
+    0x73, 0x75, 0x7a, 0x73, 0x75, 0x73, 0x73, 0x7d, 0x73, 0x73, 0x7d, 0x73,
+    0x7a, 0x73, 0x73, 0x7d, 0x7d, 0x73, 0x73, 0x7a, 0x7a, 0x7d, 0x7d, 0x73,
+    0x83, 0x77, 0x0a, 0x7a, 0x77, 0x77, 0x7d, 0x85, 0x7e, 0x7e, 0x82, 0x7e,
+    0x7e, 0x87, 0x82, 0x83, 0x08, 0x8a, 0x91, 0x82, 0x4f, 0x2f, 0x15, 0x02,
+    0x01, 0x03, 0x80, 0x01, 0x88, 0x00, 0x04, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x80, 0x01, 0x0c, 0x00, 0x01, 0x01, 0x00, 0x03, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0x0b, 0x01, 0x00, 0x01,
+    0x06, 0x10, 0x1a, 0x37, 0x59, 0x8c, 0xae, 0xc5, 0xce, 0x80, 0xd5, 0x07,
+    0xce, 0xce, 0xc5, 0xc2, 0xbd, 0xc5, 0xb8, 0xb8, 0x81, 0xaa, 0x07, 0xa6,
+    0xa7, 0xa6, 0xac, 0xa7, 0x9e, 0xa6, 0x9f, 0x81, 0x93, 0x00, 0x9b, 0x82,
+    0x93, 0x00, 0x9b, 0x80, 0x93, 0x04, 0x95, 0x93, 0x95, 0x8c, 0x95, 0x80,
+    0x8c, 0x80, 0x95, 0x82, 0x8c, 0x01, 0x91, 0x95, 0x82, 0x8c, 0x0c, 0x91,
+    0x8c, 0x95, 0x95, 0x8c, 0x9c, 0x9c, 0x8c, 0x94, 0xc3, 0xf1, 0xf2, 0xf2,
+    0x83, 0xf7, 0x01, 0xfa, 0xf9, 0x80, 0xf4, 0x08, 0xf8, 0xfb, 0xfb, 0xfc,
+    0xfa, 0xf7, 0xf7, 0xf8, 0xf4, 0x89, 0xf3, 0x01, 0xf4, 0xf3, 0x80, 0xec,
+    0x00, 0xf3, 0x80, 0xf4, 0x80, 0xec, 0x01, 0xf4, 0xf4, 0x81, 0xec, 0x05,
+    0xf7, 0xf7, 0xf4, 0xec, 0xf3, 0xf3, 0x82, 0xec, 0x84, 0xf3, 0x00, 0xec,
+    0x81, 0xf3, 0x02, 0xf4, 0xa1, 0x60, 0x80, 0x64, 0x01, 0x6b, 0x60, 0x84,
+    0x68, 0x09, 0x70, 0x68, 0x68, 0x70, 0x68, 0x68, 0x70, 0x68, 0x70, 0x70,
+    0x80, 0x68, 0x00, 0x70, 0x87, 0x68, 0x00, 0x6b, 0x83, 0x68, 0x82, 0x60,
+    0x0a, 0x6b, 0x68, 0x6b, 0x6b, 0x68, 0x75, 0x71, 0x6e, 0x71, 0x75, 0x7a,
+    0x80, 0x6e, 0x00, 0x75, 0x80, 0x7a, 0x03, 0x73, 0x75, 0x73, 0x75, 0x80,
+    0x7d, 0x03, 0x81, 0x7d, 0x7d, 0x73, 0x80, 0x7d, 0x17, 0x73, 0x77, 0x7a,
+    0x77, 0x7d, 0x73, 0x7d, 0x7a, 0x77, 0x7a, 0x7a, 0x77, 0x7d, 0x7a, 0x77,
+    0x77, 0x7d, 0x85, 0x7e, 0x82, 0x82, 0x7e, 0x7e, 0x82, 0x82, 0x83, 0x08,
+    0x8a, 0x91, 0x82, 0x64, 0x41, 0x1f, 0x05, 0x06, 0x03, 0x82, 0x01, 0x01,
+    0x00, 0x01, 0x90, 0x00, 0x80, 0x01, 0x89, 0x00, 0x09, 0x03, 0x02, 0x05,
+    0x15, 0x2c, 0x4d, 0x82, 0xa6, 0xc5, 0xce, 0x80, 0xd5, 0x01, 0xce, 0xce,
+    0x80, 0xc5, 0x02, 0xb8, 0xb8, 0xb4, 0x80, 0xaa, 0x01, 0xb4, 0xac, 0x80,
+    0xa7, 0x06, 0xac, 0xac, 0xa7, 0x9e, 0x93, 0x9b, 0x9b, 0x80, 0x93, 0x06,
+    0x9b, 0x93, 0x93, 0x9b, 0x95, 0x93, 0x95, 0x81, 0x8c, 0x00, 0x95, 0x81,
+    0x8c, 0x80, 0x95, 0x80, 0x91, 0x81, 0x8c, 0x82, 0x91, 0x11, 0x8c, 0x8c,
+    0x91, 0x91, 0x95, 0x95, 0xb2, 0xdd, 0xe1, 0xb9, 0xd4, 0xed, 0xf4, 0xf2,
+    0xed, 0xf0, 0xf7, 0xf7, 0x80, 0xf4, 0x01, 0xf7, 0xf7, 0x80, 0xf4, 0x09,
+    0xf3, 0xf7, 0xf9, 0xfa, 0xfa, 0xf9, 0xfc, 0xfa, 0xfc, 0xf7, 0x80, 0xf3,
+    0x80, 0xec, 0x83, 0xf3, 0x82, 0xec, 0x01, 0xf3, 0xea, 0x81, 0xec, 0x01,
+    0xea, 0xf4, 0x81, 0xec, 0x01, 0xf4, 0xf4, 0x86, 0xec, 0x02, 0xf3, 0xf3,
+    0xec, 0x81, 0xf3, 0x01, 0xf4, 0xf7, 0x80, 0xf3, 0x12, 0xdb, 0x97, 0x64,
+    0x69, 0x7f, 0x72, 0x7f, 0x71, 0x71, 0x7f, 0x97, 0xc1, 0xa9, 0x97, 0x88,
+    0x7f, 0x68, 0x68, 0x75, 0x81, 0x68, 0x07, 0x70, 0x75, 0x70, 0x70, 0x68,
+    0x70, 0x68, 0x75, 0x85, 0x68, 0x00, 0x70, 0x80, 0x68, 0x02, 0x70, 0x68,
+    0x68, 0x80, 0x60, 0x02, 0x6b, 0x6b, 0x68, 0x81, 0x6b, 0x05, 0x75, 0x75,
+    0x6e, 0x75, 0x6e, 0x73, 0x81, 0x75, 0x02, 0x73, 0x7d, 0x7a, 0x81, 0x6e,
+    0x00, 0x75, 0x81, 0x7d, 0x01, 0x75, 0x7d, 0x81, 0x6e, 0x07, 0x77, 0x73,
+    0x7d, 0x7d, 0x7a, 0x7d, 0x73, 0x77, 0x80, 0x7a, 0x04, 0x7d, 0x73, 0x7a,
+    0x77, 0x7d, 0x84, 0x7e, 0x83, 0x83, 0x11, 0x91, 0x87, 0x68, 0x43, 0x27,
+    0x0f, 0x02, 0x01, 0x01, 0x06, 0x06, 0x01, 0x06, 0x00, 0x00, 0x03, 0x01,
+    0x01, 0x9b, 0x00, 0x08, 0x01, 0x02, 0x10, 0x27, 0x41, 0x71, 0x9f, 0xb8,
+    0xc5, 0x80, 0xd5, 0x03, 0xce, 0xce, 0xc2, 0xc5, 0x80, 0xb8, 0x82, 0xaa,
+    0x0f, 0xac, 0xa6, 0xac, 0xa6, 0x9e, 0xa7, 0xa4, 0x9f, 0x9f, 0x9b, 0x9b,
+    0x95, 0x93, 0x8c, 0x8c, 0x95, 0x82, 0x8c, 0x05, 0x95, 0x95, 0x8c, 0x8c,
+    0x95, 0x95, 0x80, 0x8c, 0x03, 0x95, 0x91, 0x8c, 0x8c, 0x82, 0x91, 0x81,
+    0x8c, 0x02, 0x91, 0x8c, 0x8c, 0x81, 0x91, 0x0e, 0x8c, 0x91, 0xab, 0xdd,
+    0xf8, 0xfb, 0xfc, 0xfe, 0xf7, 0xf7, 0xf2, 0xed, 0xf0, 0xf7, 0xf7, 0x82,
+    0xf4, 0x0e, 0xf3, 0xf3, 0xf4, 0xf7, 0xf7, 0xf4, 0xf7, 0xf8, 0xfe, 0xf9,
+    0xf4, 0xfb, 0xfd, 0xf7, 0xf3, 0x80, 0xec, 0x06, 0xf4, 0xf8, 0xfb, 0xfe,
+    0xf9, 0xf4, 0xf3, 0x83, 0xec, 0x0c, 0xea, 0xec, 0xea, 0xec, 0xec, 0xea,
+    0xea, 0xec, 0xec, 0xea, 0xec, 0xec, 0xea, 0x81, 0xec, 0x07, 0xf4, 0xf7,
+    0xf4, 0xec, 0xec, 0xf3, 0xec, 0xec, 0x80, 0xf3, 0x0f, 0xf7, 0xf7, 0xf4,
+    0xf4, 0xf3, 0xf3, 0xda, 0x8f, 0xbf, 0xed, 0xe8, 0xf1, 0xf2, 0xa1, 0xc1,
+    0xeb, 0x81, 0xfa, 0x02, 0xf8, 0xbf, 0x71, 0x82, 0x6e, 0x81, 0x75, 0x83,
+    0x6e, 0x0b, 0x75, 0x6e, 0x75, 0x6e, 0x6e, 0x75, 0x68, 0x68, 0x70, 0x68,
+    0x70, 0x70, 0x82, 0x68, 0x02, 0x70, 0x70, 0x68, 0x81, 0x70, 0x04, 0x6e,
+    0x6e, 0x75, 0x6e, 0x75, 0x81, 0x6e, 0x00, 0x7a, 0x81, 0x75, 0x01, 0x7d,
+    0x75, 0x80, 0x6e, 0x0d, 0x7d, 0x75, 0x7d, 0x75, 0x75, 0x7d, 0x7a, 0x7a,
+    0x73, 0x77, 0x77, 0x7d, 0x7a, 0x7a, 0x80, 0x6e, 0x80, 0x7a, 0x09, 0x7d,
+    0x7d, 0x73, 0x7a, 0x7d, 0x7d, 0x77, 0x7d, 0x82, 0x82, 0x81, 0x7e, 0x81,
+    0x83, 0x07, 0x8a, 0x87, 0x75, 0x55, 0x2c, 0x10, 0x06, 0x01, 0x83, 0x06,
+    0x02, 0x01, 0x06, 0x06, 0x81, 0x01, 0x94, 0x00, 0x80, 0x01, 0x11, 0x02,
+    0x0f, 0x15, 0x2f, 0x59, 0x91, 0xae, 0xc5, 0xce, 0xd5, 0xd5, 0xce, 0xce,
+    0xc5, 0xc5, 0xb8, 0xb8, 0xb4, 0x80, 0xaa, 0x0f, 0xa6, 0xac, 0xa6, 0xa6,
+    0xac, 0xac, 0xa6, 0x9c, 0x9f, 0x9f, 0x9b, 0x93, 0x9b, 0x9b, 0x95, 0x95,
+    0x82, 0x8c, 0x03, 0x95, 0x8c, 0x8c, 0x95, 0x80, 0x8c, 0x00, 0x91, 0x81,
+    0x8c, 0x05, 0x91, 0x91, 0x8c, 0x91, 0x8c, 0x91, 0x81, 0x8c, 0x02, 0x91,
+    0x91, 0x87, 0x80, 0x80, 0x14, 0x87, 0x91, 0x80, 0x91, 0x80, 0x8c, 0x91,
+    0xb2, 0xee, 0xf1, 0xee, 0xee, 0xfb, 0xf1, 0xf7, 0xf9, 0xed, 0xf1, 0xf7,
+    0xf7, 0xf4, 0x84, 0xf3, 0x15, 0xf8, 0xfa, 0xf3, 0xf3, 0xf8, 0xf9, 0xf4,
+    0xf3, 0xf7, 0xfe, 0xfc, 0xf4, 0xf3, 0xec, 0xec, 0xf3, 0xf3, 0xf4, 0xfa,
+    0xfe, 0xfb, 0xf3, 0x82, 0xec, 0x80, 0xea, 0x08, 0xe5, 0xe5, 0xea, 0xf0,
+    0xea, 0xec, 0xec, 0xe5, 0xea, 0x80, 0xec, 0x08, 0xe5, 0xec, 0xec, 0xf7,
+    0xf3, 0xf7, 0xea, 0xec, 0xf3, 0x80, 0xec, 0x0a, 0xf3, 0xf7, 0xf7, 0xf4,
+    0xf3, 0xf3, 0xf4, 0xf0, 0xde, 0xf1, 0xf3, 0x81, 0xf4, 0x01, 0xfb, 0xfa,
+    0x80, 0xf8, 0x04, 0xf7, 0xf4, 0xf3, 0xf3, 0xa9, 0x82, 0x6e, 0x00, 0x7d,
+    0x86, 0x6e, 0x01, 0x75, 0x73, 0x81, 0x75, 0x01, 0x73, 0x6e, 0x81, 0x75,
+    0x80, 0x6e, 0x80, 0x68, 0x83, 0x75, 0x02, 0x6e, 0x75, 0x6e, 0x83, 0x75,
+    0x07, 0x73, 0x73, 0x75, 0x75, 0x73, 0x7d, 0x7d, 0x75, 0x80, 0x6e, 0x1c,
+    0x7d, 0x75, 0x75, 0x73, 0x7a, 0x7d, 0x7a, 0x73, 0x77, 0x7d, 0x7d, 0x77,
+    0x7a, 0x7d, 0x7a, 0x77, 0x7a, 0x73, 0x73, 0x7d, 0x7d, 0x73, 0x73, 0x7a,
+    0x77, 0x77, 0x7e, 0x82, 0x82, 0x84, 0x7e, 0x80, 0x83, 0x03, 0x7d, 0x5d,
+    0x2f, 0x17, 0x89, 0x06, 0x81, 0x01, 0x03, 0x03, 0x00, 0x00, 0x01, 0x8a,
+    0x00, 0x12, 0x01, 0x01, 0x00, 0x03, 0x01, 0x03, 0x06, 0x02, 0x10, 0x21,
+    0x43, 0x7a, 0xa6, 0xb8, 0xce, 0xd5, 0xd5, 0xce, 0xce, 0x80, 0xc5, 0x01,
+    0xb8, 0xae, 0x80, 0xb4, 0x83, 0x9e, 0x04, 0x9c, 0x9f, 0x9c, 0x9b, 0x9b,
+    0x80, 0x93, 0x84, 0x95, 0x0a, 0x8c, 0x8c, 0x91, 0x91, 0x8c, 0x91, 0x8c,
+    0x8c, 0x91, 0x91, 0x8c, 0x80, 0x91, 0x02, 0x8c, 0x87, 0x80, 0x84, 0x8c,
+    0x00, 0x91, 0x84, 0x87, 0x80, 0x80, 0x04, 0x87, 0xa5, 0xdd, 0xed, 0xed,
+    0x80, 0xeb, 0x06, 0xed, 0xf7, 0xf9, 0xf9, 0xf1, 0xf4, 0xf7, 0x85, 0xf3,
+    0x05, 0xf7, 0xf7, 0xea, 0xec, 0xf7, 0xf4, 0x80, 0xf3, 0x03, 0xf7, 0xfa,
+    0xf8, 0xf3, 0x81, 0xec, 0x04, 0xf3, 0xf3, 0xf4, 0xf7, 0xf0, 0x80, 0xec,
+    0x00, 0xe5, 0x80, 0xea, 0x81, 0xe5, 0x80, 0xea, 0x01, 0xe5, 0xe5, 0x81,
+    0xec, 0x06, 0xe3, 0xec, 0xea, 0xea, 0xec, 0xf4, 0xea, 0x82, 0xec, 0x09,
+    0xf4, 0xf7, 0xea, 0xec, 0xec, 0xf7, 0xf4, 0xf7, 0xf4, 0xf3, 0x81, 0xf4,
+    0x0c, 0xf7, 0xfa, 0xf9, 0xf4, 0xf3, 0xf3, 0xf4, 0xea, 0xea, 0xec, 0xde,
+    0xa9, 0x77, 0x84, 0x7e, 0x82, 0x77, 0x0a, 0x73, 0x77, 0x77, 0x73, 0x73,
+    0x7d, 0x7d, 0x77, 0x73, 0x7d, 0x7d, 0x85, 0x6e, 0x03, 0x75, 0x73, 0x73,
+    0x75, 0x81, 0x6e, 0x03, 0x74, 0x6e, 0x75, 0x81, 0x80, 0x75, 0x01, 0x73,
+    0x71, 0x80, 0x75, 0x05, 0x7d, 0x7d, 0x75, 0x7d, 0x7a, 0x73, 0x80, 0x75,
+    0x12, 0x73, 0x73, 0x7d, 0x7d, 0x73, 0x77, 0x7d, 0x7d, 0x77, 0x73, 0x73,
+    0x7a, 0x7d, 0x73, 0x73, 0x7d, 0x73, 0x7a, 0x7d, 0x80, 0x7a, 0x05, 0x77,
+    0x7a, 0x82, 0x77, 0x7e, 0x77, 0x83, 0x7e, 0x09, 0x83, 0x83, 0x77, 0x5f,
+    0x33, 0x15, 0x02, 0x01, 0x06, 0x06, 0x82, 0x0f, 0x83, 0x06, 0x01, 0x01,
+    0x01, 0x80, 0x03, 0x04, 0x01, 0x03, 0x01, 0x01, 0x03, 0x80, 0x00, 0x00,
+    0x03, 0x85, 0x01, 0x0c, 0x03, 0x06, 0x06, 0x15, 0x2f, 0x59, 0x91, 0xae,
+    0xc5, 0xce, 0xd5, 0xce, 0xce, 0x80, 0xc5, 0x01, 0xb8, 0xb8, 0x80, 0xaa,
+    0x04, 0xa6, 0xa6, 0xa7, 0xa6, 0x9f, 0x82, 0x93, 0x00, 0x9b, 0x80, 0x95,
+    0x03, 0x93, 0x8c, 0x95, 0x8c, 0x80, 0x91, 0x00, 0x95, 0x83, 0x91, 0x04,
+    0x8c, 0x8c, 0x91, 0x8c, 0x8c, 0x80, 0x91, 0x01, 0x8a, 0x8c, 0x81, 0x91,
+    0x81, 0x8c, 0x00, 0x91, 0x85, 0x87, 0x11, 0x80, 0x80, 0x87, 0x9c, 0xeb,
+    0xf7, 0xfa, 0xfc, 0xfd, 0xeb, 0xee, 0xed, 0xf7, 0xf8, 0xf9, 0xf2, 0xf4,
+    0xf4, 0x85, 0xf3, 0x05, 0xf4, 0xf4, 0xec, 0xec, 0xea, 0xea, 0x80, 0xec,
+    0x03, 0xf3, 0xf7, 0xf8, 0xf7, 0x81, 0xec, 0x05, 0xea, 0xec, 0xec, 0xf3,
+    0xf4, 0xea, 0x81, 0xe5, 0x80, 0xea, 0x04, 0xe5, 0xe5, 0xe3, 0xea, 0xea,
+    0x80, 0xe5, 0x80, 0xec, 0x02, 0xe3, 0xe3, 0xec, 0x81, 0xea, 0x82, 0xec,
+    0x01, 0xf3, 0xf4, 0x80, 0xec, 0x07, 0xf4, 0xf8, 0xf7, 0xf4, 0xec, 0xea,
+    0xf3, 0xf3, 0x80, 0xf4, 0x03, 0xf7, 0xf7, 0xf3, 0xf4, 0x81, 0xea, 0x03,
+    0xe5, 0xe9, 0xd1, 0x7e, 0x8b, 0x83, 0x8c, 0x7e, 0x08, 0x77, 0x77, 0x7e,
+    0x7e, 0x77, 0x77, 0x7e, 0x77, 0x71, 0x80, 0x6e, 0x09, 0x75, 0x71, 0x81,
+    0x75, 0x7a, 0x71, 0x7a, 0x6e, 0x75, 0x75, 0x82, 0x6e, 0x80, 0x75, 0x80,
+    0x7d, 0x80, 0x6e, 0x05, 0x7d, 0x82, 0x77, 0x77, 0x73, 0x7a, 0x81, 0x6e,
+    0x03, 0x7d, 0x73, 0x7a, 0x7d, 0x80, 0x7a, 0x80, 0x77, 0x00, 0x7d, 0x80,
+    0x77, 0x01, 0x7e, 0x85, 0x80, 0x7e, 0x09, 0x83, 0x83, 0x82, 0x66, 0x37,
+    0x1d, 0x02, 0x01, 0x06, 0x0f, 0x81, 0x10, 0x80, 0x0f, 0x81, 0x06, 0x01,
+    0x02, 0x02, 0x82, 0x06, 0x02, 0x01, 0x03, 0x03, 0x80, 0x01, 0x03, 0x06,
+    0x01, 0x06, 0x01, 0x80, 0x06, 0x11, 0x02, 0x02, 0x06, 0x07, 0x1f, 0x3b,
+    0x71, 0xac, 0xb8, 0xce, 0xd5, 0xd5, 0xce, 0xce, 0xc5, 0xc5, 0xb8, 0xb8,
+    0x80, 0xaa, 0x07, 0xa6, 0xa6, 0xa7, 0x9e, 0x9e, 0x9f, 0x9c, 0x9b, 0x80,
+    0x93, 0x80, 0x95, 0x02, 0x8c, 0x95, 0x95, 0x80, 0x8c, 0x81, 0x91, 0x03,
+    0x8c, 0x91, 0x8c, 0x8c, 0x80, 0x91, 0x02, 0x8c, 0x91, 0x8a, 0x80, 0x91,
+    0x80, 0x8c, 0x04, 0x80, 0x87, 0x87, 0x91, 0x8c, 0x80, 0x91, 0x81, 0x87,
+    0x00, 0x80, 0x82, 0x87, 0x07, 0xb2, 0xeb, 0xef, 0xf7, 0xf7, 0xf8, 0xf9,
+    0xf9, 0x80, 0xf8, 0x04, 0xf7, 0xf9, 0xfa, 0xf2, 0xf4, 0x87, 0xf3, 0x04,
+    0xf4, 0xea, 0xec, 0xec, 0xf4, 0x81, 0xec, 0x80, 0xf7, 0x00, 0xea, 0x80,
+    0xec, 0x0b, 0xe3, 0xea, 0xea, 0xec, 0xea, 0xea, 0xe5, 0xe5, 0xe3, 0xe3,
+    0xea, 0xea, 0x81, 0xe3, 0x00, 0xea, 0x81, 0xe5, 0x07, 0xec, 0xec, 0xea,
+    0xe3, 0xe5, 0xea, 0xea, 0xe5, 0x80, 0xea, 0x04, 0xec, 0xea, 0xea, 0xf3,
+    0xf4, 0x81, 0xec, 0x0d, 0xf0, 0xf8, 0xf7, 0xf0, 0xec, 0xec, 0xf3, 0xf4,
+    0xf4, 0xf3, 0xf3, 0xf7, 0xf0, 0xf4, 0x81, 0xea, 0x0a, 0xe9, 0xe9, 0xf1,
+    0xc3, 0x8a, 0x8a, 0x95, 0x8a, 0x8a, 0x8c, 0x8c, 0x8d, 0x8a, 0x8c, 0x83,
+    0x00, 0x6e, 0x80, 0x75, 0x1e, 0x6e, 0x75, 0x71, 0x75, 0x73, 0x71, 0x73,
+    0x73, 0x75, 0x7d, 0x73, 0x7d, 0x7d, 0x73, 0x73, 0x75, 0x6e, 0x73, 0x75,
+    0x7d, 0x73, 0x7d, 0x73, 0x73, 0x7d, 0x7a, 0x7a, 0x77, 0x73, 0x73, 0x7d,
+    0x87, 0x6e, 0x83, 0x77, 0x00, 0x7d, 0x82, 0x7e, 0x0d, 0x83, 0x83, 0x7e,
+    0x6b, 0x41, 0x1f, 0x0f, 0x01, 0x06, 0x0f, 0x10, 0x15, 0x1d, 0x1d, 0x80,
+    0x10, 0x02, 0x07, 0x0f, 0x0f, 0x89, 0x06, 0x01, 0x02, 0x02, 0x85, 0x06,
+    0x0e, 0x0f, 0x0d, 0x2c, 0x4d, 0x91, 0xae, 0xc5, 0xce, 0xd5, 0xce, 0xce,
+    0xc5, 0xc5, 0xb8, 0xb8, 0x81, 0xaa, 0x80, 0xac, 0x01, 0x9f, 0x9e, 0x81,
+    0x93, 0x01, 0x95, 0x8c, 0x80, 0x95, 0x0d, 0x91, 0x91, 0x95, 0x91, 0x8c,
+    0x8c, 0x91, 0x91, 0x8c, 0x91, 0x91, 0x8c, 0x91, 0x91, 0x80, 0x8c, 0x01,
+    0x80, 0x8c, 0x85, 0x91, 0x81, 0x87, 0x00, 0x91, 0x82, 0x87, 0x00, 0x83,
+    0x80, 0x87, 0x09, 0x80, 0x87, 0x87, 0x94, 0xeb, 0xf7, 0xf7, 0xf9, 0xfb,
+    0xf8, 0x80, 0xf7, 0x00, 0xf4, 0x80, 0xf7, 0x02, 0xf8, 0xf9, 0xf7, 0x87,
+    0xf3, 0x00, 0xf4, 0x81, 0xec, 0x00, 0xf4, 0x80, 0xec, 0x03, 0xf3, 0xf4,
+    0xf3, 0xea, 0x80, 0xec, 0x08, 0xe3, 0xea, 0xea, 0xec, 0xec, 0xea, 0xea,
+    0xe5, 0xe5, 0x85, 0xe3, 0x81, 0xe5, 0x01, 0xec, 0xec, 0x83, 0xe3, 0x80,
+    0xea, 0x12, 0xf4, 0xfb, 0xf0, 0xec, 0xec, 0xea, 0xea, 0xec, 0xec, 0xf0,
+    0xf7, 0xf0, 0xea, 0xec, 0xf3, 0xf3, 0xf4, 0xf3, 0xf3, 0x80, 0xf4, 0x82,
+    0xea, 0x03, 0xe9, 0xf1, 0xeb, 0xa6, 0x81, 0x9f, 0x04, 0x93, 0x9f, 0xa7,
+    0x9e, 0x9e, 0x82, 0x9f, 0x05, 0x93, 0x9f, 0x93, 0x93, 0x9f, 0x9f, 0x80,
+    0x9b, 0x02, 0x93, 0x9b, 0x9b, 0x83, 0x95, 0x81, 0x8a, 0x01, 0x8c, 0x8a,
+    0x83, 0x75, 0x00, 0x6e, 0x84, 0x75, 0x05, 0x7d, 0x75, 0x73, 0x7a, 0x7a,
+    0x73, 0x80, 0x75, 0x82, 0x6e, 0x06, 0x7d, 0x73, 0x81, 0x7a, 0x73, 0x7a,
+    0x7d, 0x80, 0x7a, 0x0d, 0x73, 0x7a, 0x73, 0x73, 0x7d, 0x7d, 0x73, 0x77,
+    0x77, 0x73, 0x77, 0x77, 0x7d, 0x7d, 0x80, 0x77, 0x80, 0x7e, 0x09, 0x83,
+    0x7e, 0x70, 0x43, 0x1f, 0x0f, 0x06, 0x06, 0x0f, 0x15, 0x81, 0x1d, 0x04,
+    0x15, 0x0d, 0x10, 0x10, 0x07, 0x82, 0x0f, 0x8c, 0x06, 0x0e, 0x0f, 0x07,
+    0x1f, 0x37, 0x71, 0x9c, 0xc5, 0xce, 0xd5, 0xce, 0xce, 0xc5, 0xc5, 0xb8,
+    0xb8, 0x81, 0xaa, 0x80, 0x9e, 0x03, 0x9f, 0x9f, 0xa4, 0x9b, 0x81, 0x93,
+    0x01, 0x8c, 0x95, 0x81, 0x91, 0x82, 0x8c, 0x82, 0x91, 0x06, 0x8c, 0x8c,
+    0x87, 0x87, 0x80, 0x80, 0x87, 0x80, 0x91, 0x02, 0x87, 0x87, 0x91, 0x81,
+    0x87, 0x01, 0x80, 0x80, 0x84, 0x87, 0x02, 0x83, 0x82, 0x82, 0x81, 0x87,
+    0x07, 0xc1, 0xf2, 0xf1, 0xf0, 0xf9, 0xfc, 0xfe, 0xf7, 0x82, 0xf4, 0x04,
+    0xf3, 0xf4, 0xf7, 0xf9, 0xf7, 0x81, 0xf3, 0x03, 0xf4, 0xf4, 0xf3, 0xec,
+    0x80, 0xf3, 0x80, 0xec, 0x00, 0xea, 0x83, 0xec, 0x0a, 0xea, 0xea, 0xe5,
+    0xec, 0xea, 0xea, 0xe3, 0xea, 0xec, 0xea, 0xea, 0x88, 0xe3, 0x80, 0xe5,
+    0x00, 0xec, 0x84, 0xe3, 0x06, 0xea, 0xe5, 0xea, 0xf7, 0xf9, 0xf0, 0xec,
+    0x80, 0xe5, 0x06, 0xea, 0xec, 0xf4, 0xf7, 0xea, 0xec, 0xec, 0x82, 0xf3,
+    0x03, 0xf4, 0xea, 0xea, 0xf4, 0x80, 0xea, 0x03, 0xf0, 0xf1, 0xf1, 0xc3,
+    0x82, 0xaf, 0x82, 0xaa, 0x00, 0xaf, 0x80, 0xaa, 0x00, 0xaf, 0x84, 0xaa,
+    0x03, 0xaf, 0xaf, 0xa7, 0x9e, 0x83, 0xa7, 0x00, 0x9e, 0x81, 0xa7, 0x02,
+    0x9e, 0xa7, 0x74, 0x85, 0x75, 0x00, 0x71, 0x80, 0x75, 0x01, 0x7d, 0x7d,
+    0x80, 0x6e, 0x01, 0x75, 0x7a, 0x81, 0x75, 0x82, 0x6e, 0x09, 0x7a, 0x7a,
+    0x73, 0x7a, 0x7a, 0x7d, 0x7d, 0x73, 0x7a, 0x7d, 0x81, 0x6e, 0x09, 0x7d,
+    0x73, 0x77, 0x77, 0x73, 0x7d, 0x73, 0x77, 0x7d, 0x7d, 0x80, 0x77, 0x81,
+    0x7e, 0x0f, 0x70, 0x49, 0x21, 0x0f, 0x06, 0x06, 0x07, 0x1d, 0x1d, 0x21,
+    0x1d, 0x1a, 0x1a, 0x1d, 0x1d, 0x15, 0x81, 0x10, 0x80, 0x07, 0x8a, 0x0f,
+    0x0a, 0x07, 0x0d, 0x27, 0x47, 0x80, 0xae, 0xc5, 0xce, 0xd5, 0xce, 0xce,
+    0x80, 0xc5, 0x03, 0xb8, 0xae, 0xae, 0xb4, 0x80, 0xac, 0x0b, 0x9e, 0xa6,
+    0x93, 0x9f, 0xa4, 0x9b, 0x9b, 0x93, 0x95, 0x95, 0x8c, 0x95, 0x83, 0x91,
+    0x01, 0x8c, 0x8c, 0x84, 0x91, 0x01, 0x80, 0x80, 0x81, 0x87, 0x03, 0x91,
+    0x87, 0x87, 0x91, 0x84, 0x87, 0x00, 0x80, 0x82, 0x87, 0x83, 0x82, 0x0a,
+    0x87, 0x87, 0x94, 0xdd, 0xf8, 0xf0, 0xea, 0xf7, 0xfb, 0xfe, 0xf8, 0x81,
+    0xf4, 0x06, 0xf7, 0xf7, 0xf4, 0xf4, 0xf9, 0xf9, 0xf4, 0x80, 0xf3, 0x06,
+    0xf4, 0xf4, 0xf3, 0xec, 0xec, 0xf3, 0xf3, 0x81, 0xec, 0x02, 0xea, 0xec,
+    0xea, 0x82, 0xec, 0x03, 0xe5, 0xe5, 0xea, 0xea, 0x80, 0xe3, 0x03, 0xea,
+    0xea, 0xe3, 0xdf, 0x81, 0xe3, 0x00, 0xe0, 0x81, 0xe3, 0x03, 0xe5, 0xe5,
+    0xea, 0xea, 0x85, 0xe3, 0x04, 0xea, 0xf0, 0xea, 0xf0, 0xea, 0x81, 0xe5,
+    0x05, 0xec, 0xec, 0xf4, 0xf7, 0xf7, 0xec, 0x83, 0xf3, 0x01, 0xea, 0xea,
+    0x80, 0xf4, 0x08, 0xf0, 0xf7, 0xf1, 0xf1, 0xda, 0xb1, 0xaf, 0xb4, 0xbd,
+    0x80, 0xb8, 0x8f, 0xc2, 0x01, 0xbd, 0xc2, 0x81, 0xb8, 0x0a, 0xbd, 0xbd,
+    0xb8, 0xb8, 0xbd, 0xbd, 0xb8, 0xbd, 0xbd, 0x75, 0x71, 0x88, 0x75, 0x00,
+    0x7d, 0x81, 0x6e, 0x0a, 0x7a, 0x7a, 0x81, 0x81, 0x7a, 0x7a, 0x73, 0x7a,
+    0x7a, 0x73, 0x73, 0x83, 0x7a, 0x02, 0x7d, 0x73, 0x7d, 0x81, 0x6e, 0x0a,
+    0x7d, 0x73, 0x77, 0x73, 0x7a, 0x7d, 0x7d, 0x73, 0x73, 0x77, 0x7d, 0x81,
+    0x77, 0x80, 0x7e, 0x08, 0x70, 0x49, 0x21, 0x0f, 0x01, 0x02, 0x07, 0x17,
+    0x1f, 0x81, 0x21, 0x80, 0x1d, 0x03, 0x15, 0x15, 0x1d, 0x1d, 0x83, 0x10,
+    0x00, 0x0f, 0x83, 0x10, 0x14, 0x0f, 0x0f, 0x07, 0x15, 0x2a, 0x59, 0x9c,
+    0xb8, 0xce, 0xd5, 0xd5, 0xce, 0xc5, 0xc5, 0xb8, 0xb8, 0xae, 0xae, 0xac,
+    0xa6, 0xac, 0x80, 0x9e, 0x02, 0x9f, 0x9f, 0x9b, 0x81, 0x93, 0x05, 0x95,
+    0x8c, 0x95, 0x95, 0x91, 0x8c, 0x83, 0x91, 0x01, 0x80, 0x8c, 0x82, 0x91,
+    0x03, 0x87, 0x87, 0x80, 0x80, 0x80, 0x87, 0x00, 0x80, 0x81, 0x87, 0x00,
+    0x80, 0x86, 0x87, 0x86, 0x82, 0x0a, 0x80, 0x94, 0xd1, 0xf1, 0xea, 0xea,
+    0xf4, 0xf7, 0xf9, 0xf8, 0xf4, 0x80, 0xf3, 0x14, 0xf7, 0xfa, 0xf7, 0xec,
+    0xf0, 0xf0, 0xf7, 0xf3, 0xf3, 0xec, 0xea, 0xf3, 0xf3, 0xf4, 0xf1, 0xfb,
+    0xfa, 0xf7, 0xec, 0xea, 0xe5, 0x80, 0xea, 0x80, 0xe5, 0x87, 0xe3, 0x02,
+    0xea, 0xe3, 0xd6, 0x80, 0xe3, 0x0b, 0xd6, 0xd6, 0xe0, 0xe3, 0xe3, 0xe4,
+    0xe4, 0xe5, 0xe5, 0xe3, 0xe3, 0xd6, 0x81, 0xe3, 0x04, 0xe5, 0xea, 0xf0,
+    0xe3, 0xea, 0x83, 0xe5, 0x0e, 0xec, 0xf4, 0xf7, 0xf7, 0xf8, 0xea, 0xec,
+    0xf4, 0xf7, 0xf7, 0xf4, 0xf7, 0xf0, 0xf3, 0xf3, 0x81, 0xf4, 0x05, 0xe9,
+    0xe9, 0xc1, 0xaf, 0xaa, 0xaf, 0x80, 0xbd, 0x80, 0xc2, 0x83, 0xc9, 0x96,
+    0xd3, 0x03, 0x74, 0x74, 0x6e, 0x6e, 0x83, 0x75, 0x0b, 0x73, 0x75, 0x7d,
+    0x75, 0x7d, 0x73, 0x75, 0x81, 0x7d, 0x7d, 0x7a, 0x7a, 0x80, 0x6e, 0x01,
+    0x7d, 0x7a, 0x80, 0x6e, 0x82, 0x7a, 0x00, 0x73, 0x80, 0x7d, 0x08, 0x77,
+    0x7d, 0x73, 0x7d, 0x7d, 0x73, 0x73, 0x7a, 0x7d, 0x81, 0x6e, 0x12, 0x77,
+    0x73, 0x77, 0x77, 0x7d, 0x77, 0x7e, 0x82, 0x70, 0x49, 0x1f, 0x0f, 0x01,
+    0x02, 0x0f, 0x1d, 0x21, 0x21, 0x27, 0x81, 0x21, 0x00, 0x1f, 0x86, 0x1d,
+    0x03, 0x17, 0x17, 0x15, 0x17, 0x80, 0x1d, 0x07, 0x10, 0x07, 0x07, 0x15,
+    0x37, 0x64, 0xa4, 0xb8, 0x81, 0xce, 0x0a, 0xc5, 0xc5, 0xb8, 0xae, 0xae,
+    0xb4, 0xb4, 0xa7, 0xac, 0x9e, 0xa6, 0x80, 0x93, 0x06, 0x9b, 0x93, 0x93,
+    0x95, 0x93, 0x95, 0x95, 0x81, 0x91, 0x00, 0x8c, 0x80, 0x91, 0x07, 0x8c,
+    0x91, 0x91, 0x87, 0x80, 0x87, 0x87, 0x80, 0x87, 0x87, 0x02, 0x80, 0x87,
+    0x80, 0x80, 0x87, 0x00, 0x80, 0x84, 0x87, 0x02, 0x82, 0x82, 0x87, 0x84,
+    0x82, 0x09, 0x86, 0xd1, 0xf0, 0xf0, 0xe5, 0xea, 0xf4, 0xf7, 0xf7, 0xf4,
+    0x80, 0xf3, 0x13, 0xf4, 0xf8, 0xf8, 0xf3, 0xec, 0xec, 0xf4, 0xf4, 0xf3,
+    0xec, 0xec, 0xf3, 0xf0, 0xf0, 0xf8, 0xf9, 0xf7, 0xf0, 0xf4, 0xea, 0x80,
+    0xe5, 0x01, 0xea, 0xe3, 0x80, 0xe5, 0x88, 0xe3, 0x00, 0xd6, 0x80, 0xe3,
+    0x80, 0xd6, 0x08, 0xe3, 0xf1, 0xfb, 0xf8, 0xe5, 0xe5, 0xe3, 0xe3, 0xd6,
+    0x82, 0xe3, 0x04, 0xe4, 0xe3, 0xe3, 0xe0, 0xe3, 0x82, 0xe5, 0x0c, 0xf4,
+    0xf7, 0xf7, 0xf3, 0xf7, 0xf1, 0xf4, 0xf7, 0xf7, 0xf4, 0xf3, 0xf7, 0xfa,
+    0x82, 0xf3, 0x0d, 0xe9, 0xf0, 0xd1, 0x9c, 0x9b, 0xa7, 0xa7, 0xb4, 0xcd,
+    0xe1, 0xbd, 0xbd, 0xc2, 0xc2, 0x82, 0xc9, 0x86, 0xd3, 0x01, 0xd5, 0xd5,
+    0x80, 0xd3, 0x81, 0xe2, 0x00, 0xd3, 0x83, 0xe2, 0x01, 0x75, 0x74, 0x85,
+    0x75, 0x13, 0x73, 0x73, 0x7a, 0x73, 0x7d, 0x73, 0x75, 0x7d, 0x7d, 0x73,
+    0x73, 0x75, 0x7a, 0x73, 0x73, 0x7d, 0x73, 0x7a, 0x73, 0x77, 0x83, 0x7a,
+    0x03, 0x77, 0x7d, 0x77, 0x7a, 0x82, 0x6e, 0x02, 0x7a, 0x7d, 0x7d, 0x85,
+    0x6e, 0x11, 0x77, 0x77, 0x7e, 0x7e, 0x6e, 0x49, 0x1f, 0x0f, 0x06, 0x02,
+    0x0f, 0x1d, 0x21, 0x27, 0x25, 0x27, 0x25, 0x25, 0x86, 0x21, 0x02, 0x1d,
+    0x1d, 0x15, 0x82, 0x1d, 0x80, 0x10, 0x04, 0x15, 0x3b, 0x7a, 0xac, 0xc5,
+    0x80, 0xce, 0x0b, 0xc5, 0xc5, 0xb8, 0xbd, 0xae, 0xae, 0xb4, 0xac, 0xac,
+    0xa7, 0xa7, 0x9e, 0x83, 0x93, 0x04, 0x95, 0x95, 0x8c, 0x8c, 0x95, 0x80,
+    0x91, 0x00, 0x8c, 0x81, 0x91, 0x03, 0x80, 0x80, 0x91, 0x91, 0x80, 0x87,
+    0x03, 0x80, 0x87, 0x87, 0x80, 0x83, 0x87, 0x01, 0x80, 0x80, 0x83, 0x87,
+    0x02, 0x83, 0x87, 0x83, 0x81, 0x87, 0x03, 0x82, 0x80, 0x87, 0x87, 0x82,
+    0x82, 0x07, 0x7a, 0x82, 0xbf, 0xf0, 0xf0, 0xe5, 0xe5, 0xea, 0x80, 0xf4,
+    0x80, 0xf3, 0x0c, 0xec, 0xf4, 0xf7, 0xf7, 0xea, 0xec, 0xec, 0xf4, 0xf8,
+    0xf4, 0xea, 0xea, 0xf0, 0x84, 0xea, 0x80, 0xe5, 0x0b, 0xe3, 0xe3, 0xe5,
+    0xe5, 0xe3, 0xe3, 0xea, 0xfb, 0xf2, 0xe3, 0xe3, 0xe0, 0x81, 0xe3, 0x06,
+    0xd6, 0xe3, 0xe3, 0xe0, 0xd6, 0xd6, 0xe0, 0x81, 0xea, 0x02, 0xe5, 0xe3,
+    0xe3, 0x81, 0xd6, 0x82, 0xe3, 0x80, 0xe0, 0x26, 0xe3, 0xe3, 0xe5, 0xe5,
+    0xea, 0xf4, 0xf4, 0xea, 0xf4, 0xf7, 0xf4, 0xf3, 0xec, 0xec, 0xea, 0xf3,
+    0xf4, 0xf9, 0xf7, 0xf3, 0xf4, 0xf4, 0xf1, 0xf1, 0xe6, 0x97, 0x7e, 0x82,
+    0x91, 0xa5, 0xbf, 0xd9, 0xd1, 0xcd, 0xb1, 0xaa, 0xaf, 0xbd, 0xb8, 0x80,
+    0xc2, 0x81, 0xc9, 0x83, 0xd3, 0x00, 0xd5, 0x80, 0xd3, 0x88, 0xe2, 0x02,
+    0x75, 0x75, 0x6e, 0x81, 0x75, 0x87, 0x6e, 0x05, 0x75, 0x7d, 0x7a, 0x73,
+    0x75, 0x7a, 0x82, 0x7d, 0x01, 0x73, 0x73, 0x80, 0x7a, 0x80, 0x7d, 0x80,
+    0x77, 0x01, 0x7a, 0x7a, 0x81, 0x6e, 0x05, 0x7a, 0x7a, 0x7d, 0x73, 0x7d,
+    0x7d, 0x80, 0x6e, 0x0e, 0x77, 0x73, 0x77, 0x77, 0x7e, 0x7e, 0x71, 0x49,
+    0x27, 0x05, 0x01, 0x06, 0x0f, 0x15, 0x21, 0x82, 0x25, 0x05, 0x27, 0x25,
+    0x25, 0x27, 0x21, 0x25, 0x86, 0x21, 0x08, 0x1d, 0x17, 0x10, 0x10, 0x21,
+    0x3b, 0x82, 0xae, 0xc5, 0x80, 0xce, 0x05, 0xc5, 0xc5, 0xbd, 0xae, 0xb4,
+    0xae, 0x80, 0xac, 0x03, 0xa6, 0xa6, 0x9f, 0x93, 0x80, 0x9b, 0x83, 0x95,
+    0x01, 0x91, 0x8c, 0x80, 0x91, 0x00, 0x8c, 0x81, 0x91, 0x03, 0x87, 0x80,
+    0x87, 0x91, 0x87, 0x87, 0x03, 0x83, 0x87, 0x83, 0x80, 0x84, 0x87, 0x01,
+    0x83, 0x82, 0x83, 0x87, 0x05, 0x80, 0x83, 0x83, 0x82, 0x7e, 0x7e, 0x80,
+    0x82, 0x07, 0x7d, 0xc1, 0xe9, 0xea, 0xea, 0xe5, 0xe5, 0xea, 0x82, 0xf3,
+    0x07, 0xf7, 0xf0, 0xf0, 0xf7, 0xf7, 0xea, 0xea, 0xf7, 0x80, 0xf4, 0x04,
+    0xf0, 0xe4, 0xea, 0xe5, 0xe5, 0x81, 0xe3, 0x81, 0xe5, 0x81, 0xe3, 0x07,
+    0xea, 0xfa, 0xfe, 0xfb, 0xea, 0xe3, 0xd6, 0xd6, 0x80, 0xe3, 0x08, 0xd6,
+    0xe0, 0xe3, 0xd6, 0xc6, 0xd6, 0xf1, 0xfb, 0xe4, 0x81, 0xe3, 0x83, 0xd6,
+    0x81, 0xe3, 0x00, 0xe0, 0x81, 0xd6, 0x00, 0xe3, 0x81, 0xea, 0x04, 0xec,
+    0xf1, 0xea, 0xec, 0xec, 0x81, 0xea, 0x01, 0xf4, 0xf7, 0x82, 0xf4, 0x15,
+    0xf0, 0xa1, 0x7f, 0xa5, 0xc1, 0xe1, 0xeb, 0xed, 0xe8, 0xd9, 0xd9, 0xa5,
+    0x9b, 0x9f, 0x9e, 0xa7, 0xaf, 0xaa, 0xaf, 0xaf, 0xbd, 0xb8, 0x80, 0xc2,
+    0x83, 0xc9, 0x89, 0xd3, 0x02, 0xe2, 0x75, 0x71, 0x84, 0x75, 0x81, 0x7a,
+    0x0b, 0x7d, 0x7d, 0x73, 0x7a, 0x81, 0x71, 0x7a, 0x73, 0x7a, 0x7a, 0x73,
+    0x73, 0x81, 0x7d, 0x07, 0x7a, 0x7a, 0x77, 0x7a, 0x77, 0x77, 0x7d, 0x7d,
+    0x80, 0x77, 0x00, 0x7a, 0x82, 0x77, 0x01, 0x73, 0x7d, 0x86, 0x6e, 0x0b,
+    0x77, 0x77, 0x7e, 0x6e, 0x49, 0x27, 0x0f, 0x01, 0x02, 0x10, 0x1d, 0x27,
+    0x86, 0x2e, 0x80, 0x25, 0x0e, 0x27, 0x25, 0x21, 0x25, 0x25, 0x21, 0x21,
+    0x1d, 0x15, 0x10, 0x17, 0x27, 0x4d, 0x91, 0xb8, 0x80, 0xce, 0x03, 0xc5,
+    0xc5, 0xb8, 0xb8, 0x80, 0xb4, 0x08, 0xac, 0xa6, 0xa7, 0xa7, 0x9c, 0x9b,
+    0x9b, 0x9c, 0x9b, 0x80, 0x95, 0x04, 0x8c, 0x91, 0x8c, 0x91, 0x8c, 0x86,
+    0x91, 0x09, 0x80, 0x87, 0x80, 0x80, 0x87, 0x80, 0x80, 0x87, 0x87, 0x80,
+    0x8d, 0x87, 0x00, 0x83, 0x84, 0x87, 0x05, 0x82, 0x82, 0x83, 0x82, 0x7e,
+    0x7e, 0x80, 0x82, 0x14, 0x7d, 0xa5, 0xde, 0xea, 0xea, 0xe5, 0xdf, 0xe5,
+    0xec, 0xf3, 0xf3, 0xf4, 0xf7, 0xf9, 0xfb, 0xf7, 0xf4, 0xf7, 0xea, 0xea,
+    0xf0, 0x80, 0xe5, 0x05, 0xea, 0xe5, 0xe4, 0xe3, 0xe3, 0xe0, 0x81, 0xe3,
+    0x02, 0xe5, 0xdf, 0xdf, 0x80, 0xe3, 0x06, 0xdf, 0xf0, 0xf0, 0xe3, 0xe3,
+    0xea, 0xe3, 0x80, 0xd6, 0x0a, 0xe3, 0xe3, 0xe4, 0xe6, 0xe3, 0xd6, 0xc6,
+    0xe4, 0xf2, 0xf0, 0xe3, 0x80, 0xe0, 0x00, 0xe3, 0x82, 0xd6, 0x02, 0xe0,
+    0xe3, 0xe3, 0x80, 0xe0, 0x81, 0xd6, 0x00, 0xe5, 0x85, 0xea, 0x80, 0xe5,
+    0x05, 0xea, 0xf7, 0xf7, 0xea, 0xec, 0xea, 0x80, 0xf4, 0x12, 0xcf, 0x8f,
+    0xc3, 0xfc, 0xfc, 0xfe, 0xee, 0xda, 0xda, 0xed, 0xed, 0xa5, 0x7e, 0x83,
+    0x8a, 0x8a, 0x8c, 0x9b, 0x9f, 0x80, 0xa7, 0x04, 0xaa, 0xaf, 0xaa, 0xaf,
+    0xaa, 0x80, 0xb8, 0x83, 0xc2, 0x85, 0xc9, 0x01, 0x6e, 0x71, 0x80, 0x75,
+    0x00, 0x74, 0x81, 0x75, 0x05, 0x81, 0x81, 0x7a, 0x7a, 0x7d, 0x73, 0x81,
+    0x75, 0x00, 0x73, 0x81, 0x7d, 0x0c, 0x7a, 0x7d, 0x7d, 0x73, 0x7a, 0x7d,
+    0x7d, 0x7a, 0x7a, 0x7d, 0x77, 0x7d, 0x7d, 0x81, 0x77, 0x00, 0x7d, 0x84,
+    0x77, 0x80, 0x6e, 0x80, 0x7d, 0x0d, 0x73, 0x73, 0x77, 0x7e, 0x71, 0x47,
+    0x27, 0x0f, 0x01, 0x06, 0x10, 0x1d, 0x27, 0x2a, 0x87, 0x2e, 0x83, 0x25,
+    0x08, 0x21, 0x1f, 0x1d, 0x10, 0x15, 0x2c, 0x59, 0xa4, 0xc5, 0x80, 0xce,
+    0x80, 0xc5, 0x00, 0xb8, 0x80, 0xb4, 0x06, 0xa6, 0xa6, 0xa7, 0x9f, 0x9f,
+    0x9b, 0x9b, 0x83, 0x95, 0x03, 0x8c, 0x91, 0x8c, 0x8c, 0x83, 0x91, 0x80,
+    0x87, 0x05, 0x80, 0x80, 0x87, 0x87, 0x80, 0x80, 0x89, 0x87, 0x00, 0x80,
+    0x83, 0x87, 0x00, 0x80, 0x80, 0x87, 0x04, 0x82, 0x83, 0x83, 0x82, 0x87,
+    0x89, 0x82, 0x1c, 0xbf, 0xe9, 0xea, 0xea, 0xe5, 0xdf, 0xe5, 0xf3, 0xf3,
+    0xf4, 0xf4, 0xf7, 0xf7, 0xf8, 0xf0, 0xf4, 0xf4, 0xea, 0xe5, 0xe4, 0xe4,
+    0xe5, 0xe3, 0xe0, 0xe4, 0xe0, 0xe0, 0xd6, 0xe0, 0x81, 0xe3, 0x80, 0xd6,
+    0x01, 0xe3, 0xe3, 0x80, 0xe0, 0x03, 0xe3, 0xe0, 0xe0, 0xe3, 0x80, 0xd6,
+    0x0f, 0xe3, 0xf0, 0xf9, 0xf0, 0xe0, 0xd6, 0xe0, 0xe4, 0xe4, 0xe0, 0xd6,
+    0xd0, 0xd0, 0xe3, 0xf0, 0xe0, 0x81, 0xd6, 0x04, 0xe0, 0xe3, 0xe3, 0xd0,
+    0xe0, 0x81, 0xd6, 0x01, 0xe5, 0xea, 0x80, 0xe3, 0x02, 0xea, 0xf0, 0xea,
+    0x81, 0xe5, 0x0b, 0xea, 0xf7, 0xf0, 0xf4, 0xea, 0xec, 0xec, 0xf0, 0xf8,
+    0xf4, 0xe9, 0xe6, 0x81, 0xf7, 0x0d, 0xf8, 0xf1, 0xed, 0xfc, 0xeb, 0x88,
+    0x6b, 0x70, 0x75, 0x73, 0x77, 0x7e, 0x83, 0x83, 0x80, 0x8a, 0x0b, 0x9b,
+    0x9b, 0x9f, 0x9f, 0xa7, 0x9e, 0xa7, 0xaf, 0xaa, 0xaa, 0xaf, 0xaa, 0x80,
+    0xaf, 0x83, 0xbd, 0x01, 0x68, 0x68, 0x81, 0x75, 0x00, 0x6e, 0x84, 0x75,
+    0x04, 0x7d, 0x7a, 0x81, 0x74, 0x6e, 0x80, 0x75, 0x81, 0x7d, 0x80, 0x6e,
+    0x08, 0x77, 0x77, 0x7d, 0x7a, 0x7a, 0x77, 0x77, 0x7d, 0x7d, 0x80, 0x77,
+    0x00, 0x7d, 0x85, 0x77, 0x81, 0x6e, 0x0f, 0x7d, 0x7d, 0x73, 0x73, 0x77,
+    0x7e, 0x74, 0x49, 0x27, 0x0f, 0x06, 0x06, 0x10, 0x1d, 0x25, 0x2a, 0x80,
+    0x2e, 0x80, 0x2b, 0x83, 0x2e, 0x0b, 0x2b, 0x2b, 0x2e, 0x2e, 0x21, 0x1d,
+    0x10, 0x15, 0x31, 0x64, 0xac, 0xc5, 0x80, 0xce, 0x05, 0xc5, 0xc5, 0xb8,
+    0xae, 0xb4, 0xb4, 0x81, 0x9e, 0x01, 0x9f, 0x9f, 0x80, 0x9b, 0x05, 0x93,
+    0x95, 0x95, 0x8c, 0x91, 0x91, 0x80, 0x8c, 0x80, 0x91, 0x02, 0x8c, 0x91,
+    0x91, 0x82, 0x87, 0x00, 0x80, 0x8c, 0x87, 0x00, 0x83, 0x81, 0x87, 0x06,
+    0x82, 0x82, 0x87, 0x80, 0x82, 0x87, 0x87, 0x80, 0x82, 0x00, 0x80, 0x81,
+    0x82, 0x02, 0x87, 0x82, 0x80, 0x83, 0x82, 0x01, 0x94, 0xc7, 0x80, 0xea,
+    0x0e, 0xe4, 0xe4, 0xea, 0xec, 0xec, 0xea, 0xea, 0xf4, 0xf0, 0xf0, 0xea,
+    0xf4, 0xea, 0xe4, 0xe0, 0x82, 0xd6, 0x01, 0xe0, 0xe0, 0x82, 0xd6, 0x01,
+    0xe0, 0xe0, 0x80, 0xd6, 0x06, 0xe0, 0xe0, 0xd0, 0xd6, 0xe0, 0xd0, 0xd0,
+    0x80, 0xd6, 0x03, 0xe0, 0xe4, 0xf0, 0xe5, 0x80, 0xd6, 0x03, 0xe0, 0xe0,
+    0xd0, 0xc6, 0x80, 0xd0, 0x11, 0xe0, 0xe3, 0xe0, 0xd6, 0xd6, 0xd0, 0xd6,
+    0xe3, 0xe3, 0xd0, 0xd0, 0xe0, 0xd0, 0xd6, 0xd6, 0xe6, 0xfa, 0xf1, 0x80,
+    0xe3, 0x01, 0xea, 0xea, 0x82, 0xe5, 0x0a, 0xf4, 0xf4, 0xea, 0xea, 0xec,
+    0xec, 0xf3, 0xf9, 0xf9, 0xea, 0xf0, 0x80, 0xf4, 0x82, 0xf7, 0x11, 0xfb,
+    0xdd, 0x50, 0x51, 0x58, 0x58, 0x5f, 0x5f, 0x66, 0x6b, 0x68, 0x75, 0x75,
+    0x73, 0x7e, 0x7e, 0x83, 0x83, 0x81, 0x8a, 0x05, 0x95, 0x9b, 0x93, 0x9b,
+    0x9f, 0x9f, 0x84, 0xa7, 0x04, 0x68, 0x6e, 0x75, 0x75, 0x6e, 0x83, 0x75,
+    0x0f, 0x73, 0x73, 0x75, 0x7d, 0x7d, 0x75, 0x74, 0x75, 0x81, 0x7d, 0x73,
+    0x7a, 0x73, 0x7a, 0x73, 0x73, 0x81, 0x77, 0x07, 0x7d, 0x7d, 0x77, 0x77,
+    0x7d, 0x85, 0x7e, 0x82, 0x81, 0x7d, 0x06, 0x77, 0x77, 0x7d, 0x7d, 0x77,
+    0x7d, 0x77, 0x85, 0x6e, 0x0f, 0x77, 0x7e, 0x74, 0x49, 0x27, 0x0f, 0x01,
+    0x02, 0x10, 0x21, 0x2e, 0x2e, 0x33, 0x30, 0x33, 0x2b, 0x82, 0x30, 0x17,
+    0x33, 0x2b, 0x2e, 0x30, 0x30, 0x2e, 0x25, 0x1d, 0x10, 0x15, 0x2f, 0x71,
+    0xac, 0xc5, 0xd5, 0xce, 0xc5, 0xc5, 0xb8, 0xb8, 0xae, 0xae, 0xb4, 0xac,
+    0x80, 0x9e, 0x00, 0x9f, 0x80, 0x9b, 0x09, 0x93, 0x95, 0x8c, 0x95, 0x95,
+    0x8c, 0x91, 0x91, 0x8c, 0x8c, 0x81, 0x91, 0x07, 0x80, 0x80, 0x87, 0x87,
+    0x80, 0x80, 0x87, 0x80, 0x8d, 0x87, 0x00, 0x83, 0x83, 0x87, 0x80, 0x82,
+    0x00, 0x87, 0x85, 0x82, 0x00, 0xc1, 0x80, 0xe1, 0x0c, 0xb9, 0x94, 0x82,
+    0x80, 0x82, 0x80, 0x94, 0xef, 0xfa, 0xfa, 0xfe, 0xfa, 0xf7, 0x81, 0xf4,
+    0x01, 0xea, 0xe5, 0x82, 0xea, 0x83, 0xd6, 0x02, 0xd0, 0xd6, 0xe0, 0x85,
+    0xd6, 0x02, 0xd2, 0xd2, 0xd6, 0x83, 0xd0, 0x0c, 0xc6, 0xd0, 0xd0, 0xe0,
+    0xe0, 0xd6, 0xc6, 0xc6, 0xd6, 0xe0, 0xe0, 0xc6, 0xb0, 0x80, 0xc6, 0x1d,
+    0xd0, 0xfe, 0xf2, 0xe0, 0xd6, 0xd6, 0xc6, 0xd6, 0xe0, 0xe0, 0xd0, 0xd0,
+    0xe0, 0xe0, 0xc6, 0xdf, 0xf1, 0xf8, 0xf1, 0xe6, 0xe3, 0xea, 0xe3, 0xe3,
+    0xe5, 0xea, 0xe5, 0xe5, 0xea, 0xf4, 0x80, 0xea, 0x05, 0xec, 0xec, 0xf7,
+    0xf9, 0xf1, 0xea, 0x81, 0xf4, 0x00, 0xf7, 0x80, 0xf1, 0x06, 0xf0, 0xf8,
+    0x76, 0x35, 0x35, 0x42, 0x42, 0x81, 0x3b, 0x0b, 0x44, 0x48, 0x4e, 0x58,
+    0x5f, 0x60, 0x68, 0x70, 0x75, 0x6e, 0x73, 0x77, 0x80, 0x7e, 0x81, 0x83,
+    0x83, 0x8a, 0x07, 0x75, 0x6e, 0x75, 0x74, 0x6e, 0x75, 0x75, 0x73, 0x80,
+    0x75, 0x81, 0x6e, 0x0c, 0x7d, 0x73, 0x75, 0x74, 0x75, 0x7a, 0x73, 0x73,
+    0x7a, 0x7a, 0x73, 0x73, 0x77, 0x80, 0x7d, 0x14, 0x77, 0x7a, 0x7d, 0x77,
+    0x77, 0x85, 0x7d, 0x7d, 0x7e, 0x82, 0x7e, 0x7e, 0x7d, 0x77, 0x77, 0x7d,
+    0x77, 0x7d, 0x7d, 0x73, 0x7a, 0x82, 0x6e, 0x0c, 0x77, 0x77, 0x7e, 0x74,
+    0x49, 0x1f, 0x0f, 0x00, 0x06, 0x10, 0x1f, 0x2e, 0x2e, 0x81, 0x2f, 0x80,
+    0x30, 0x02, 0x3d, 0x3d, 0x33, 0x80, 0x30, 0x0d, 0x33, 0x2e, 0x1f, 0x17,
+    0x15, 0x37, 0x71, 0xb4, 0xc5, 0xce, 0xce, 0xc5, 0xc5, 0xb8, 0x80, 0xaa,
+    0x80, 0xac, 0x02, 0xa7, 0x9f, 0x9f, 0x80, 0x9b, 0x82, 0x95, 0x01, 0x91,
+    0x8c, 0x81, 0x91, 0x00, 0x87, 0x80, 0x91, 0x01, 0x87, 0x87, 0x80, 0x80,
+    0x8c, 0x87, 0x05, 0x80, 0x87, 0x83, 0x87, 0x87, 0x83, 0x80, 0x87, 0x02,
+    0x82, 0x82, 0x80, 0x88, 0x82, 0x12, 0xdd, 0xfb, 0xfc, 0xfd, 0xfd, 0xf6,
+    0xd4, 0xb9, 0xd4, 0xe1, 0xeb, 0xf7, 0xf7, 0xfa, 0xf8, 0xea, 0xea, 0xe5,
+    0xe5, 0x81, 0xea, 0x83, 0xe5, 0x01, 0xdf, 0xe0, 0x80, 0xd6, 0x05, 0xd0,
+    0xd0, 0xd6, 0xe0, 0xd6, 0xd0, 0x80, 0xd6, 0x01, 0xd0, 0xd0, 0x80, 0xc6,
+    0x01, 0xd0, 0xc6, 0x81, 0xd0, 0x03, 0xc6, 0xc6, 0xd6, 0xd0, 0x80, 0xc6,
+    0x05, 0xbe, 0xd0, 0xd0, 0xbc, 0xb0, 0xb0, 0x80, 0xc6, 0x03, 0xe0, 0xf1,
+    0xf8, 0xe6, 0x80, 0xc6, 0x0c, 0xd6, 0xe0, 0xd6, 0xd6, 0xd0, 0xd0, 0xd6,
+    0xc6, 0xe4, 0xf1, 0xf0, 0xea, 0xe4, 0x80, 0xe3, 0x05, 0xe0, 0xea, 0xf1,
+    0xf0, 0xe3, 0xec, 0x80, 0xea, 0x06, 0xec, 0xec, 0xf4, 0xf7, 0xf7, 0xf4,
+    0xea, 0x81, 0xf4, 0x06, 0xf0, 0xf1, 0xf0, 0xf0, 0xe9, 0xf0, 0x3c, 0x80,
+    0x27, 0x82, 0x25, 0x12, 0x2a, 0x2a, 0x30, 0x30, 0x42, 0x3e, 0x44, 0x48,
+    0x4e, 0x51, 0x58, 0x5f, 0x66, 0x6b, 0x6b, 0x70, 0x70, 0x68, 0x6e, 0x80,
+    0x75, 0x06, 0x73, 0x7d, 0x7d, 0x75, 0x6e, 0x74, 0x71, 0x84, 0x75, 0x81,
+    0x7d, 0x04, 0x7a, 0x7a, 0x71, 0x74, 0x75, 0x83, 0x7d, 0x01, 0x73, 0x7a,
+    0x80, 0x7d, 0x0e, 0x82, 0x77, 0x7a, 0x7a, 0x7d, 0x82, 0x7e, 0x7e, 0x77,
+    0x7a, 0x7e, 0x7e, 0x7d, 0x7a, 0x7a, 0x81, 0x77, 0x82, 0x6e, 0x12, 0x7d,
+    0x73, 0x77, 0x85, 0x7e, 0x71, 0x49, 0x1f, 0x06, 0x06, 0x02, 0x0d, 0x21,
+    0x2e, 0x2e, 0x33, 0x3d, 0x3d, 0x30, 0x84, 0x3d, 0x16, 0x35, 0x30, 0x2e,
+    0x21, 0x1d, 0x15, 0x37, 0x7a, 0xb4, 0xc5, 0xce, 0xce, 0xc5, 0xc2, 0xb8,
+    0xb4, 0xb4, 0xae, 0xac, 0xac, 0xa7, 0xa7, 0x9f, 0x81, 0x9b, 0x80, 0x95,
+    0x04, 0x91, 0x8c, 0x91, 0x91, 0x8c, 0x83, 0x91, 0x04, 0x8c, 0x91, 0x87,
+    0x87, 0x80, 0x86, 0x87, 0x01, 0x80, 0x80, 0x82, 0x87, 0x00, 0x80, 0x81,
+    0x87, 0x04, 0x80, 0x87, 0x82, 0x87, 0x87, 0x8b, 0x82, 0x0a, 0xc3, 0xed,
+    0xeb, 0xfc, 0xfd, 0xfd, 0xfc, 0xfc, 0xfe, 0xf9, 0xf1, 0x83, 0xea, 0x80,
+    0xe5, 0x00, 0xdf, 0x80, 0xe5, 0x04, 0xdf, 0xe4, 0xe3, 0xe3, 0xe5, 0x82,
+    0xd6, 0x80, 0xc6, 0x02, 0xd6, 0xe0, 0xd0, 0x81, 0xc6, 0x00, 0xd0, 0x86,
+    0xc6, 0x09, 0xbe, 0xc6, 0xc6, 0xbc, 0xbc, 0xc6, 0xbe, 0xc6, 0xd0, 0xbc,
+    0x81, 0xb0, 0x07, 0xc6, 0xc6, 0xd6, 0xe3, 0xe3, 0xe0, 0xd0, 0xc6, 0x81,
+    0xd0, 0x08, 0xc6, 0xd0, 0xd0, 0xc6, 0xdc, 0xf0, 0xe4, 0xe4, 0xdf, 0x80,
+    0xe3, 0x05, 0xe0, 0xea, 0xea, 0xf0, 0xf0, 0xe5, 0x80, 0xea, 0x80, 0xe5,
+    0x06, 0xf4, 0xf0, 0xf4, 0xea, 0xea, 0xf4, 0xf4, 0x82, 0xf0, 0x03, 0xe9,
+    0xf1, 0xf0, 0x26, 0x80, 0x17, 0x83, 0x15, 0x0d, 0x1d, 0x1f, 0x21, 0x25,
+    0x2a, 0x30, 0x30, 0x35, 0x35, 0x3e, 0x3e, 0x44, 0x4e, 0x51, 0x80, 0x58,
+    0x80, 0x5f, 0x80, 0x66, 0x04, 0x6b, 0x75, 0x6e, 0x74, 0x71, 0x80, 0x75,
+    0x0b, 0x7d, 0x75, 0x73, 0x7a, 0x75, 0x7d, 0x73, 0x73, 0x7a, 0x7a, 0x71,
+    0x75, 0x83, 0x7d, 0x03, 0x73, 0x77, 0x7d, 0x7d, 0x81, 0x77, 0x80, 0x7a,
+    0x80, 0x7e, 0x02, 0x77, 0x7a, 0x7d, 0x84, 0x77, 0x02, 0x73, 0x7d, 0x7d,
+    0x82, 0x6e, 0x80, 0x7e, 0x0d, 0x71, 0x43, 0x1f, 0x06, 0x01, 0x06, 0x10,
+    0x21, 0x25, 0x2e, 0x30, 0x3d, 0x3d, 0x35, 0x84, 0x3d, 0x07, 0x35, 0x33,
+    0x27, 0x1d, 0x15, 0x37, 0x7a, 0xae, 0x80, 0xce, 0x08, 0xc5, 0xb8, 0xb8,
+    0xb4, 0xae, 0xb4, 0xac, 0xac, 0xa7, 0x80, 0x9f, 0x01, 0x9c, 0x9b, 0x80,
+    0x95, 0x01, 0x8c, 0x95, 0x85, 0x91, 0x00, 0x80, 0x80, 0x91, 0x02, 0x80,
+    0x87, 0x80, 0x88, 0x87, 0x00, 0x80, 0x85, 0x87, 0x04, 0x83, 0x87, 0x87,
+    0x83, 0x87, 0x80, 0x82, 0x00, 0x80, 0x80, 0x82, 0x00, 0x7e, 0x85, 0x82,
+    0x13, 0xc3, 0xf1, 0xed, 0xeb, 0xef, 0xee, 0xf1, 0xf1, 0xf0, 0xf0, 0xea,
+    0xea, 0xf0, 0xf1, 0xf9, 0xfa, 0xfa, 0xf2, 0xf1, 0xe4, 0x84, 0xd6, 0x0d,
+    0xe0, 0xe5, 0xe3, 0xc6, 0xdc, 0xd6, 0xd6, 0xc6, 0xc6, 0xe6, 0xe6, 0xe0,
+    0xd6, 0xd0, 0x81, 0xc6, 0x13, 0xdc, 0xe6, 0xe8, 0xdc, 0xc6, 0xc6, 0xbe,
+    0xc6, 0xc6, 0xad, 0xc6, 0xbc, 0xb0, 0xb0, 0xc6, 0xbe, 0xbc, 0xbc, 0xb0,
+    0xa3, 0x81, 0xb0, 0x10, 0xad, 0xc6, 0xd0, 0xd0, 0xe0, 0xe6, 0xdb, 0xc6,
+    0xd0, 0xd0, 0xc6, 0xd0, 0xd0, 0xc6, 0xbe, 0xe4, 0xe0, 0x80, 0xd6, 0x06,
+    0xe3, 0xe3, 0xd6, 0xe3, 0xea, 0xea, 0xf0, 0x80, 0xea, 0x81, 0xe5, 0x06,
+    0xf4, 0xf8, 0xf9, 0xf9, 0xea, 0xea, 0xf4, 0x81, 0xf0, 0x0c, 0xea, 0xf0,
+    0xf1, 0xf1, 0xe9, 0x12, 0x13, 0x13, 0x05, 0x23, 0x23, 0x0f, 0x14, 0x80,
+    0x17, 0x0e, 0x15, 0x1d, 0x21, 0x21, 0x27, 0x25, 0x2a, 0x2a, 0x2f, 0x2f,
+    0x35, 0x35, 0x42, 0x3b, 0x3e, 0x82, 0x44, 0x07, 0x48, 0x4e, 0x4e, 0x6e,
+    0x75, 0x71, 0x71, 0x81, 0x80, 0x75, 0x0a, 0x81, 0x75, 0x7a, 0x7a, 0x75,
+    0x7d, 0x7a, 0x7a, 0x81, 0x75, 0x75, 0x80, 0x6e, 0x80, 0x7d, 0x00, 0x7a,
+    0x87, 0x77, 0x02, 0x7e, 0x82, 0x7e, 0x81, 0x77, 0x06, 0x7a, 0x77, 0x7a,
+    0x77, 0x7d, 0x77, 0x7d, 0x84, 0x6e, 0x0e, 0x77, 0x7e, 0x7e, 0x68, 0x42,
+    0x1f, 0x02, 0x01, 0x06, 0x10, 0x21, 0x25, 0x2e, 0x30, 0x3d, 0x83, 0x35,
+    0x80, 0x3d, 0x06, 0x30, 0x27, 0x1d, 0x15, 0x2f, 0x7a, 0xae, 0x80, 0xce,
+    0x02, 0xc5, 0xb8, 0xb8, 0x80, 0xb4, 0x0c, 0xac, 0xa7, 0xa7, 0x9f, 0x9b,
+    0x9b, 0x93, 0x93, 0x95, 0x95, 0x8c, 0x91, 0x95, 0x80, 0x91, 0x00, 0x8c,
+    0x80, 0x91, 0x81, 0x87, 0x00, 0x91, 0x80, 0x87, 0x00, 0x80, 0x91, 0x87,
+    0x81, 0x82, 0x00, 0x87, 0x83, 0x82, 0x01, 0x7e, 0x7e, 0x85, 0x82, 0x06,
+    0xc1, 0xf1, 0xf2, 0xee, 0xee, 0xf2, 0xf0, 0x80, 0xf1, 0x05, 0xf0, 0xf0,
+    0xf8, 0xfa, 0xf9, 0xf8, 0x80, 0xf9, 0x05, 0xf8, 0xf0, 0xe4, 0xdf, 0xc6,
+    0xc6, 0x80, 0xd6, 0x04, 0xe0, 0xd6, 0xd6, 0xc6, 0xd6, 0x80, 0xc6, 0x0c,
+    0xf9, 0xfc, 0xf1, 0xe0, 0xd0, 0xc6, 0xbe, 0xc6, 0xe4, 0xf1, 0xfb, 0xfc,
+    0xf2, 0x81, 0xc6, 0x01, 0xbc, 0xad, 0x82, 0xb0, 0x02, 0xbc, 0xbc, 0xb0,
+    0x82, 0xa3, 0x1d, 0xb0, 0xa3, 0xb0, 0xbc, 0xbc, 0xe0, 0xf8, 0xf9, 0xe0,
+    0xd0, 0xbc, 0xc6, 0xd0, 0xd0, 0xc6, 0xd0, 0xe0, 0xd6, 0xc6, 0xc6, 0xe0,
+    0xe3, 0xd6, 0xe0, 0xe3, 0xe3, 0xf0, 0xf0, 0xe3, 0xea, 0x80, 0xe5, 0x0a,
+    0xea, 0xf0, 0xf9, 0xf8, 0xf7, 0xf4, 0xf7, 0xf4, 0xf0, 0xf0, 0xf7, 0x81,
+    0xf0, 0x02, 0xf1, 0xf7, 0x6a, 0x81, 0x0c, 0x04, 0x3c, 0x98, 0x0a, 0x05,
+    0x14, 0x81, 0x17, 0x08, 0x1f, 0x1f, 0x21, 0x27, 0x25, 0x27, 0x25, 0x2a,
+    0x2a, 0x85, 0x2f, 0x80, 0x30, 0x0c, 0x35, 0x6e, 0x75, 0x6e, 0x71, 0x73,
+    0x75, 0x73, 0x75, 0x7d, 0x73, 0x73, 0x7a, 0x81, 0x7d, 0x03, 0x73, 0x75,
+    0x73, 0x7d, 0x82, 0x6e, 0x86, 0x77, 0x07, 0x7d, 0x77, 0x7e, 0x82, 0x7e,
+    0x77, 0x77, 0x82, 0x87, 0x77, 0x82, 0x6e, 0x80, 0x77, 0x0a, 0x6b, 0x3b,
+    0x15, 0x06, 0x06, 0x0f, 0x0d, 0x21, 0x2e, 0x30, 0x30, 0x81, 0x3d, 0x82,
+    0x35, 0x06, 0x3d, 0x2e, 0x15, 0x15, 0x2f, 0x71, 0xb4, 0x80, 0xce, 0x12,
+    0xc5, 0xbd, 0xb8, 0xae, 0xb4, 0xa6, 0xac, 0xac, 0xa7, 0x9f, 0x9b, 0x9b,
+    0x95, 0x95, 0x8c, 0x8c, 0x95, 0x8c, 0x8c, 0x81, 0x91, 0x80, 0x87, 0x00,
+    0x80, 0x8e, 0x87, 0x80, 0x83, 0x85, 0x87, 0x01, 0x82, 0x82, 0x82, 0x87,
+    0x05, 0x83, 0x82, 0x82, 0x83, 0x82, 0x7e, 0x85, 0x82, 0x05, 0x7e, 0xa9,
+    0xf1, 0xf8, 0xfa, 0xf2, 0x82, 0xf1, 0x03, 0xe4, 0xf0, 0xf0, 0xf7, 0x80,
+    0xf4, 0x82, 0xea, 0x02, 0xf0, 0xe4, 0xd2, 0x81, 0xc6, 0x00, 0xd6, 0x80,
+    0xc6, 0x06, 0xd0, 0xc6, 0xc6, 0xe4, 0xf1, 0xf0, 0xe4, 0x80, 0xc6, 0x0b,
+    0xdc, 0xd6, 0xe4, 0xe4, 0xd6, 0xe4, 0xc6, 0xf0, 0xf2, 0xe8, 0xbe, 0xa3,
+    0x80, 0xb0, 0x03, 0xa3, 0xb0, 0xbc, 0xb0, 0x82, 0xa3, 0x02, 0xb0, 0xb0,
+    0xa3, 0x80, 0xb0, 0x1c, 0xe0, 0xe4, 0xf0, 0xe4, 0xc6, 0xb0, 0xc6, 0xd0,
+    0xbc, 0xd0, 0xe0, 0xd0, 0xc6, 0xc6, 0xd0, 0xe3, 0xd6, 0xd6, 0xe3, 0xe3,
+    0xe4, 0xe4, 0xe3, 0xe5, 0xe5, 0xdf, 0xe5, 0xea, 0xf0, 0x80, 0xf7, 0x04,
+    0xea, 0xf4, 0xf9, 0xf4, 0xf4, 0x80, 0xf7, 0x0e, 0xf8, 0xfe, 0xfb, 0xf7,
+    0xcf, 0x12, 0x04, 0x00, 0x01, 0x01, 0x1e, 0xe8, 0x62, 0x04, 0x13, 0x81,
+    0x14, 0x01, 0x17, 0x17, 0x80, 0x1f, 0x80, 0x21, 0x01, 0x27, 0x27, 0x80,
+    0x21, 0x00, 0x1f, 0x80, 0x1a, 0x81, 0x21, 0x02, 0x75, 0x6e, 0x75, 0x80,
+    0x6e, 0x00, 0x7a, 0x82, 0x6e, 0x81, 0x7d, 0x80, 0x6e, 0x81, 0x7d, 0x00,
+    0x73, 0x80, 0x77, 0x03, 0x7a, 0x77, 0x77, 0x7d, 0x81, 0x77, 0x03, 0x7e,
+    0x82, 0x7e, 0x7e, 0x82, 0x77, 0x00, 0x7d, 0x82, 0x77, 0x85, 0x6e, 0x10,
+    0x77, 0x77, 0x66, 0x35, 0x15, 0x02, 0x06, 0x0f, 0x15, 0x21, 0x2e, 0x30,
+    0x35, 0x35, 0x42, 0x3d, 0x3d, 0x80, 0x42, 0x20, 0x3d, 0x3d, 0x2e, 0x1a,
+    0x15, 0x2a, 0x64, 0xae, 0xc5, 0xce, 0xce, 0xc5, 0xb8, 0xb4, 0xae, 0xae,
+    0xa6, 0xa6, 0xac, 0x9f, 0x9f, 0x9b, 0x9b, 0x93, 0x93, 0x95, 0x8c, 0x8c,
+    0x91, 0x8c, 0x8c, 0x91, 0x91, 0x81, 0x87, 0x02, 0x80, 0x87, 0x80, 0x85,
+    0x87, 0x03, 0x83, 0x87, 0x87, 0x83, 0x80, 0x87, 0x16, 0x83, 0x83, 0x87,
+    0x7e, 0x83, 0x87, 0x83, 0x80, 0x80, 0x82, 0x7e, 0x82, 0x7e, 0x7e, 0x83,
+    0x87, 0x87, 0x83, 0x87, 0x7e, 0x82, 0x7e, 0x85, 0x81, 0x7e, 0x83, 0x82,
+    0x0c, 0x7e, 0xa5, 0xe8, 0xe9, 0xf1, 0xf1, 0xf0, 0xf1, 0xf1, 0xf9, 0xf2,
+    0xe9, 0xea, 0x80, 0xf0, 0x81, 0xf1, 0x00, 0xe4, 0x80, 0xe5, 0x04, 0xea,
+    0xe5, 0xc6, 0xc6, 0xdc, 0x83, 0xc6, 0x05, 0xd0, 0xc6, 0xc6, 0xdc, 0xe4,
+    0xe0, 0x81, 0xc6, 0x09, 0xbe, 0xc6, 0xb0, 0xa3, 0xad, 0xbe, 0xdc, 0xf1,
+    0xe4, 0xbe, 0x81, 0xa3, 0x14, 0xd0, 0xe4, 0xe4, 0xe0, 0xa3, 0xa3, 0xbe,
+    0xd0, 0xc6, 0xdb, 0xe8, 0xbe, 0xa3, 0xa3, 0xb0, 0xc6, 0xd6, 0xe0, 0xe0,
+    0xdc, 0xad, 0x80, 0xc6, 0x06, 0xe0, 0xd0, 0xc6, 0xbc, 0xc6, 0xd0, 0xd0,
+    0x83, 0xe0, 0x0a, 0xe3, 0xe3, 0xdf, 0xdf, 0xea, 0xea, 0xf0, 0xf7, 0xf8,
+    0xea, 0xea, 0x80, 0xf4, 0x82, 0xf3, 0x0c, 0xf7, 0xf8, 0xe8, 0x26, 0x0a,
+    0x19, 0x39, 0x8b, 0x98, 0xda, 0xee, 0xd1, 0x00, 0x83, 0x0c, 0x80, 0x14,
+    0x81, 0x17, 0x0e, 0x15, 0x17, 0x17, 0x10, 0x10, 0x07, 0x07, 0x0f, 0x05,
+    0x0f, 0x07, 0x10, 0x10, 0x75, 0x6e, 0x80, 0x75, 0x05, 0x73, 0x75, 0x73,
+    0x73, 0x75, 0x75, 0x83, 0x7d, 0x80, 0x6e, 0x80, 0x7d, 0x01, 0x73, 0x73,
+    0x81, 0x77, 0x09, 0x7a, 0x7d, 0x7d, 0x77, 0x77, 0x7e, 0x82, 0x82, 0x7e,
+    0x7d, 0x84, 0x77, 0x00, 0x73, 0x80, 0x77, 0x00, 0x7d, 0x86, 0x6e, 0x1a,
+    0x63, 0x37, 0x0d, 0x06, 0x06, 0x05, 0x1d, 0x21, 0x2e, 0x33, 0x35, 0x35,
+    0x42, 0x3e, 0x3d, 0x3d, 0x42, 0x3d, 0x35, 0x2e, 0x21, 0x15, 0x27, 0x64,
+    0xac, 0xc5, 0xce, 0x80, 0xc5, 0x06, 0xb8, 0xae, 0xb4, 0xac, 0xac, 0xa7,
+    0x9f, 0x80, 0x9b, 0x00, 0x93, 0x80, 0x95, 0x00, 0x8c, 0x80, 0x91, 0x02,
+    0x8c, 0x91, 0x91, 0x94, 0x87, 0x00, 0x83, 0x82, 0x82, 0x00, 0x83, 0x84,
+    0x82, 0x03, 0x87, 0x83, 0x87, 0x7e, 0x80, 0x82, 0x07, 0x7e, 0x7e, 0x82,
+    0x7e, 0x82, 0x82, 0x80, 0x80, 0x81, 0x82, 0x2c, 0x94, 0xd1, 0xd9, 0xe9,
+    0xf0, 0xf0, 0xf1, 0xf9, 0xf9, 0xf1, 0xf0, 0xe4, 0xf0, 0xf0, 0xea, 0xe4,
+    0xf1, 0xf2, 0xf9, 0xf1, 0xf1, 0xe4, 0xd6, 0xe3, 0xe5, 0xe0, 0xd6, 0xe6,
+    0xf2, 0xdc, 0xbe, 0xbe, 0xad, 0xad, 0xbe, 0xc6, 0xbe, 0xbe, 0xc6, 0xc6,
+    0xbc, 0xa3, 0xb0, 0xb0, 0xad, 0x80, 0xa3, 0x15, 0x90, 0xa3, 0xbe, 0xd6,
+    0xbe, 0xe0, 0xf0, 0xe0, 0xb0, 0xb0, 0xe0, 0xf0, 0xfb, 0xed, 0xbe, 0xe0,
+    0xe4, 0xf1, 0xe6, 0xe0, 0xf0, 0xbe, 0x80, 0xa3, 0x07, 0xb0, 0xc6, 0xc6,
+    0xd0, 0xbe, 0xad, 0xe0, 0xe0, 0x80, 0xd0, 0x0e, 0xbc, 0xbc, 0xc6, 0xd0,
+    0xe0, 0xe0, 0xd0, 0xd0, 0xe0, 0xd0, 0xe0, 0xe3, 0xd6, 0xdf, 0xe3, 0x80,
+    0xea, 0x02, 0xf4, 0xf9, 0xf0, 0x80, 0xea, 0x82, 0xec, 0x0d, 0xf4, 0xf0,
+    0xf4, 0xf2, 0xdd, 0xef, 0xdd, 0xeb, 0xeb, 0xee, 0xeb, 0xee, 0xd1, 0x00,
+    0x82, 0x04, 0x82, 0x0c, 0x81, 0x05, 0x00, 0x0f, 0x83, 0x06, 0x00, 0x02,
+    0x81, 0x06, 0x81, 0x75, 0x01, 0x7a, 0x7a, 0x80, 0x75, 0x83, 0x7d, 0x09,
+    0x7a, 0x7a, 0x7d, 0x73, 0x7d, 0x7d, 0x81, 0x81, 0x73, 0x77, 0x80, 0x7d,
+    0x09, 0x7a, 0x77, 0x7a, 0x77, 0x77, 0x7d, 0x7e, 0x82, 0x7e, 0x7e, 0x80,
+    0x7d, 0x86, 0x77, 0x00, 0x7d, 0x86, 0x6e, 0x19, 0x5d, 0x2f, 0x10, 0x06,
+    0x06, 0x0f, 0x1d, 0x21, 0x2e, 0x30, 0x30, 0x35, 0x42, 0x42, 0x3d, 0x3d,
+    0x42, 0x42, 0x33, 0x21, 0x15, 0x27, 0x59, 0xa6, 0xc5, 0xce, 0x80, 0xc5,
+    0x0a, 0xb8, 0xb4, 0xae, 0xa6, 0xac, 0xa4, 0x9f, 0xa4, 0x9b, 0x9b, 0x93,
+    0x80, 0x95, 0x07, 0x91, 0x91, 0x8c, 0x8c, 0x91, 0x8c, 0x80, 0x91, 0x85,
+    0x87, 0x02, 0x80, 0x87, 0x80, 0x85, 0x87, 0x02, 0x80, 0x87, 0x87, 0x8c,
+    0x82, 0x01, 0x80, 0x7e, 0x8a, 0x82, 0x01, 0x7a, 0x7a, 0x80, 0x82, 0x04,
+    0xa9, 0xc8, 0xdb, 0xe9, 0xf0, 0x81, 0xf1, 0x04, 0xe9, 0xe4, 0xe5, 0xea,
+    0xea, 0x82, 0xe4, 0x01, 0xf0, 0xe4, 0x81, 0xd6, 0x09, 0xe4, 0xd6, 0xe9,
+    0xe8, 0xe0, 0xbb, 0xad, 0xad, 0x9d, 0xad, 0x80, 0xbe, 0x80, 0xb0, 0x03,
+    0xa3, 0xb0, 0xa3, 0xa3, 0x80, 0x90, 0x14, 0xa3, 0x78, 0x78, 0xa3, 0xf2,
+    0xfe, 0xf2, 0xc6, 0xa3, 0xc6, 0xf1, 0xfb, 0xbe, 0xad, 0xe0, 0xf1, 0xfb,
+    0xed, 0xbe, 0xbe, 0xa3, 0x80, 0x90, 0x07, 0xa3, 0xa3, 0xb0, 0xbc, 0xa3,
+    0xc6, 0xe3, 0xe3, 0x80, 0xd0, 0x02, 0xbc, 0xbc, 0xc6, 0x81, 0xd0, 0x05,
+    0xe0, 0xd0, 0xd0, 0xd6, 0xc6, 0xd6, 0x80, 0xe3, 0x04, 0xe5, 0xea, 0xf4,
+    0xf9, 0xf1, 0x80, 0xea, 0x09, 0xec, 0xec, 0xea, 0xea, 0xf4, 0xf7, 0xfa,
+    0xf0, 0xf4, 0xee, 0x81, 0xef, 0x03, 0xeb, 0xeb, 0xee, 0x62, 0x80, 0x00,
+    0x88, 0x04, 0x80, 0x02, 0x02, 0x01, 0x01, 0x06, 0x81, 0x01, 0x80, 0x00,
+    0x82, 0x75, 0x00, 0x7a, 0x80, 0x75, 0x82, 0x7d, 0x82, 0x6e, 0x0b, 0x7d,
+    0x7d, 0x73, 0x77, 0x73, 0x77, 0x7a, 0x7d, 0x7d, 0x77, 0x7a, 0x7a, 0x81,
+    0x77, 0x06, 0x7e, 0x7e, 0x77, 0x7e, 0x7d, 0x77, 0x7d, 0x85, 0x77, 0x02,
+    0x7d, 0x73, 0x73, 0x80, 0x77, 0x80, 0x6e, 0x0e, 0x7a, 0x55, 0x2c, 0x07,
+    0x06, 0x06, 0x0f, 0x15, 0x21, 0x2e, 0x30, 0x35, 0x35, 0x42, 0x3d, 0x80,
+    0x3b, 0x13, 0x30, 0x21, 0x15, 0x1f, 0x50, 0xa4, 0xc5, 0xce, 0xce, 0xc5,
+    0xc5, 0xb8, 0xae, 0xb4, 0xa6, 0xa6, 0xa7, 0x9f, 0x93, 0x9b, 0x80, 0x95,
+    0x02, 0x91, 0x8c, 0x8c, 0x82, 0x91, 0x00, 0x80, 0x8a, 0x87, 0x80, 0x83,
+    0x06, 0x87, 0x87, 0x83, 0x83, 0x80, 0x82, 0x83, 0x82, 0x82, 0x00, 0x87,
+    0x8b, 0x82, 0x03, 0x7e, 0x82, 0x82, 0x7e, 0x83, 0x82, 0x80, 0x7a, 0x13,
+    0x82, 0x82, 0x85, 0x88, 0xba, 0xd9, 0xe9, 0xe9, 0xf1, 0xf0, 0xf1, 0xf0,
+    0xe4, 0xe4, 0xe5, 0xe5, 0xea, 0xea, 0xe5, 0xe4, 0x81, 0xd6, 0x0e, 0xe4,
+    0xdf, 0xd2, 0xc6, 0xd6, 0xdf, 0xc6, 0xdc, 0xe6, 0xd6, 0xbe, 0xad, 0x90,
+    0x8e, 0xad, 0x80, 0xb0, 0x06, 0xa3, 0xb0, 0x90, 0xa3, 0xa3, 0x90, 0x78,
+    0x80, 0x90, 0x20, 0xa3, 0xa3, 0xbe, 0xed, 0xee, 0xc6, 0x90, 0x8d, 0x78,
+    0xad, 0x9d, 0x65, 0x78, 0xad, 0xf1, 0xfc, 0xfe, 0xbe, 0x9d, 0xa3, 0x90,
+    0x78, 0x90, 0x90, 0xa3, 0xb0, 0xbc, 0xa3, 0xd0, 0xe4, 0xe6, 0xdc, 0xd0,
+    0x80, 0xbc, 0x03, 0xc6, 0xd0, 0xd0, 0xc6, 0x80, 0xd0, 0x02, 0xc6, 0xbe,
+    0xc6, 0x81, 0xe3, 0x80, 0xea, 0x01, 0xf9, 0xf1, 0x83, 0xe5, 0x0d, 0xea,
+    0xf4, 0xf4, 0xf1, 0xf0, 0xe5, 0xf1, 0xef, 0xf6, 0xf6, 0xef, 0xeb, 0xfe,
+    0xbf, 0x84, 0x00, 0x86, 0x04, 0x01, 0x00, 0x01, 0x82, 0x00, 0x04, 0x01,
+    0x01, 0x00, 0x01, 0x01, 0x82, 0x75, 0x80, 0x6e, 0x06, 0x7a, 0x73, 0x7d,
+    0x7a, 0x7d, 0x73, 0x7a, 0x80, 0x6e, 0x02, 0x7a, 0x73, 0x73, 0x83, 0x77,
+    0x00, 0x7d, 0x80, 0x77, 0x01, 0x82, 0x7a, 0x80, 0x77, 0x05, 0x7e, 0x7e,
+    0x77, 0x77, 0x7d, 0x7d, 0x84, 0x77, 0x02, 0x73, 0x7d, 0x73, 0x82, 0x7e,
+    0x0f, 0x85, 0x7d, 0x71, 0x47, 0x27, 0x0f, 0x01, 0x06, 0x10, 0x1d, 0x27,
+    0x2e, 0x30, 0x3d, 0x3d, 0x42, 0x80, 0x3d, 0x14, 0x30, 0x27, 0x15, 0x1a,
+    0x3b, 0x95, 0xb8, 0xce, 0xce, 0xc2, 0xc5, 0xb8, 0xae, 0xae, 0xa6, 0xac,
+    0xa4, 0x9f, 0x9b, 0x93, 0x93, 0x80, 0x95, 0x02, 0x91, 0x91, 0x8c, 0x81,
+    0x91, 0x02, 0x87, 0x80, 0x80, 0x88, 0x87, 0x0a, 0x82, 0x83, 0x87, 0x82,
+    0x87, 0x80, 0x82, 0x83, 0x82, 0x7e, 0x7e, 0x81, 0x82, 0x03, 0x7e, 0x82,
+    0x82, 0x7e, 0x83, 0x82, 0x00, 0x7e, 0x83, 0x82, 0x00, 0x7e, 0x82, 0x82,
+    0x01, 0x7e, 0x82, 0x80, 0x7a, 0x08, 0x82, 0x7e, 0x77, 0x7e, 0x88, 0xb5,
+    0xd9, 0xdb, 0xe9, 0x81, 0xf1, 0x00, 0xf0, 0x80, 0xe4, 0x81, 0xe5, 0x07,
+    0xdf, 0xd2, 0xd2, 0xe9, 0xf1, 0xe9, 0xe4, 0xdc, 0x81, 0xc6, 0x80, 0xdc,
+    0x03, 0xbe, 0x90, 0x8d, 0x9d, 0x80, 0xb0, 0x80, 0xa3, 0x80, 0x90, 0x06,
+    0xa3, 0xbe, 0xc7, 0xb0, 0xa3, 0xdc, 0xe6, 0x80, 0x65, 0x1a, 0x78, 0xa3,
+    0x90, 0x65, 0x78, 0xa3, 0xa3, 0x90, 0x8e, 0xda, 0xde, 0xe8, 0xf2, 0xd0,
+    0xb0, 0x78, 0x78, 0x90, 0xa3, 0xb0, 0xa3, 0xbc, 0xe0, 0xf1, 0xf2, 0xe8,
+    0xdc, 0x82, 0xbc, 0x10, 0xc6, 0xe0, 0xf0, 0xd6, 0xbe, 0xbb, 0xc6, 0xe0,
+    0xe3, 0xd6, 0xd6, 0xe3, 0xea, 0xea, 0xf0, 0xf1, 0xe4, 0x83, 0xe5, 0x80,
+    0xea, 0x03, 0xf0, 0xe9, 0xe9, 0xed, 0x81, 0xfd, 0x04, 0xfc, 0xbf, 0x04,
+    0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x82, 0x00, 0x81, 0x04, 0x85, 0x00,
+    0x80, 0x01, 0x01, 0x00, 0x00, 0x81, 0x75, 0x00, 0x71, 0x81, 0x6e, 0x81,
+    0x7d, 0x0f, 0x73, 0x73, 0x7d, 0x73, 0x77, 0x7a, 0x73, 0x7d, 0x73, 0x77,
+    0x7a, 0x7d, 0x77, 0x7a, 0x77, 0x77, 0x80, 0x7e, 0x02, 0x77, 0x77, 0x7a,
+    0x80, 0x7e, 0x03, 0x77, 0x77, 0x73, 0x73, 0x83, 0x77, 0x17, 0x73, 0x77,
+    0x7d, 0x73, 0x7e, 0x83, 0x83, 0x85, 0x85, 0x7e, 0x7e, 0x74, 0x47, 0x1f,
+    0x02, 0x06, 0x06, 0x10, 0x1d, 0x27, 0x2e, 0x30, 0x35, 0x35, 0x80, 0x42,
+    0x14, 0x37, 0x27, 0x15, 0x17, 0x37, 0x87, 0xb8, 0xce, 0xce, 0xc5, 0xb8,
+    0xb8, 0xae, 0xae, 0xac, 0xa7, 0x9e, 0x93, 0x9b, 0x93, 0x93, 0x81, 0x8c,
+    0x03, 0x91, 0x91, 0x8c, 0x91, 0x8e, 0x87, 0x00, 0x82, 0x80, 0x83, 0x82,
+    0x82, 0x00, 0x7e, 0x84, 0x82, 0x00, 0x7e, 0x81, 0x82, 0x00, 0x7e, 0x83,
+    0x82, 0x03, 0x7e, 0x82, 0x82, 0x7e, 0x81, 0x82, 0x17, 0x7a, 0x77, 0x77,
+    0x82, 0x7a, 0x7a, 0x82, 0x82, 0x77, 0x73, 0x94, 0xda, 0xca, 0xdb, 0xe9,
+    0xf2, 0xfa, 0xfb, 0xfe, 0xfe, 0xfa, 0xf1, 0xe4, 0xe4, 0x81, 0xe5, 0x05,
+    0xdf, 0xf2, 0xf9, 0xe4, 0xe4, 0xe5, 0x80, 0xe0, 0x4c, 0xc6, 0xbe, 0xbb,
+    0xc6, 0xdc, 0xdc, 0xbe, 0x90, 0x78, 0x90, 0xb0, 0xb0, 0xa3, 0xa3, 0x90,
+    0x78, 0x90, 0xbe, 0xe0, 0xf0, 0xf9, 0xee, 0x8d, 0x90, 0x90, 0x36, 0x57,
+    0x9d, 0xa3, 0xe6, 0xf2, 0xa3, 0x79, 0xc6, 0xe0, 0xc6, 0x57, 0x65, 0x90,
+    0xdc, 0xe9, 0xbe, 0xa3, 0x78, 0x78, 0xbe, 0xbe, 0xb0, 0xb0, 0xc6, 0xf0,
+    0xf1, 0xe9, 0xe6, 0xe9, 0xbc, 0xc6, 0xc6, 0xbc, 0xb0, 0xc6, 0xea, 0xf1,
+    0xed, 0xb6, 0xc6, 0xd0, 0xd0, 0xc6, 0xc6, 0xe0, 0xe3, 0xea, 0xf0, 0xf0,
+    0xe4, 0xdf, 0x86, 0xe5, 0x02, 0xe4, 0xe4, 0xe9, 0x80, 0xee, 0x05, 0xed,
+    0xee, 0xeb, 0xbf, 0x62, 0x18, 0x8d, 0x00, 0x00, 0x01, 0x80, 0x00, 0x80,
+    0x01, 0x0d, 0x06, 0x01, 0x01, 0x06, 0x75, 0x74, 0x6e, 0x75, 0x71, 0x73,
+    0x73, 0x7d, 0x81, 0x75, 0x80, 0x7d, 0x81, 0x6e, 0x82, 0x7d, 0x03, 0x7a,
+    0x73, 0x7d, 0x7a, 0x83, 0x7e, 0x80, 0x77, 0x06, 0x7e, 0x7e, 0x77, 0x77,
+    0x7d, 0x7a, 0x73, 0x81, 0x77, 0x02, 0x73, 0x73, 0x7d, 0x80, 0x6e, 0x09,
+    0x7e, 0x7e, 0x77, 0x73, 0x77, 0x77, 0x7d, 0x6c, 0x41, 0x1f, 0x80, 0x06,
+    0x05, 0x10, 0x1d, 0x25, 0x2e, 0x33, 0x35, 0x80, 0x42, 0x11, 0x3d, 0x2e,
+    0x1d, 0x10, 0x2c, 0x71, 0xae, 0xce, 0xce, 0xc5, 0xc5, 0xb8, 0xae, 0xb4,
+    0xac, 0xac, 0x9f, 0x9f, 0x80, 0x93, 0x01, 0x95, 0x95, 0x83, 0x91, 0x88,
+    0x87, 0x00, 0x83, 0x80, 0x87, 0x06, 0x82, 0x80, 0x82, 0x82, 0x83, 0x82,
+    0x83, 0x81, 0x82, 0x0b, 0x7e, 0x7e, 0x82, 0x7e, 0x7e, 0x83, 0x7e, 0x82,
+    0x82, 0x7e, 0x82, 0x7e, 0x82, 0x82, 0x81, 0x7e, 0x01, 0x82, 0x7e, 0x80,
+    0x82, 0x04, 0x7e, 0x7d, 0x82, 0x7a, 0x82, 0x81, 0x7a, 0x12, 0x82, 0x80,
+    0x94, 0x88, 0xc3, 0xc8, 0xca, 0xdb, 0xdc, 0xe8, 0xed, 0xf1, 0xf2, 0xed,
+    0xf1, 0xf1, 0xf0, 0xe4, 0xe4, 0x80, 0xd6, 0x05, 0xe4, 0xfe, 0xf1, 0xd2,
+    0xdc, 0xc6, 0x81, 0xd6, 0x0b, 0xc6, 0xc6, 0xbb, 0xbe, 0xc6, 0xc6, 0xbe,
+    0x90, 0x65, 0xa3, 0xb0, 0xa3, 0x80, 0x90, 0x00, 0xad, 0x80, 0xc6, 0x02,
+    0xad, 0xbe, 0x57, 0x80, 0x28, 0x2a, 0x8d, 0xa2, 0x57, 0x8e, 0xa2, 0x57,
+    0x28, 0xad, 0xf1, 0xee, 0x9d, 0x90, 0xad, 0x9d, 0xad, 0x8d, 0x78, 0x65,
+    0x78, 0xf1, 0xfa, 0xe4, 0xc6, 0xd0, 0xe0, 0xe4, 0xdf, 0xd6, 0xd0, 0xbe,
+    0xf2, 0xfa, 0xbe, 0xb0, 0xe0, 0xe3, 0xf0, 0xe8, 0xbe, 0xc6, 0xc6, 0xbe,
+    0xd0, 0x80, 0xe3, 0x02, 0xea, 0xe4, 0xe4, 0x82, 0xd6, 0x82, 0xe5, 0x04,
+    0xe4, 0xdf, 0xe9, 0xe9, 0xe8, 0x80, 0xdb, 0x06, 0xee, 0xeb, 0xeb, 0xdd,
+    0xd1, 0x62, 0x03, 0x8b, 0x00, 0x05, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+    0x82, 0x01, 0x05, 0x6e, 0x6e, 0x75, 0x75, 0x73, 0x75, 0x81, 0x7d, 0x01,
+    0x81, 0x7d, 0x81, 0x6e, 0x08, 0x7d, 0x73, 0x7d, 0x7a, 0x7d, 0x7d, 0x7a,
+    0x77, 0x77, 0x83, 0x7e, 0x05, 0x7d, 0x77, 0x7e, 0x82, 0x7e, 0x7e, 0x80,
+    0x77, 0x01, 0x73, 0x73, 0x82, 0x77, 0x17, 0x73, 0x7d, 0x73, 0x73, 0x7d,
+    0x73, 0x73, 0x75, 0x6e, 0x73, 0x7d, 0x75, 0x6c, 0x37, 0x17, 0x06, 0x06,
+    0x0f, 0x10, 0x21, 0x25, 0x30, 0x3d, 0x35, 0x80, 0x42, 0x12, 0x33, 0x1f,
+    0x10, 0x1f, 0x59, 0xac, 0xc5, 0xce, 0xc5, 0xc5, 0xb8, 0xae, 0xae, 0xac,
+    0xac, 0x9f, 0x9f, 0xa4, 0x9b, 0x80, 0x95, 0x83, 0x91, 0x83, 0x87, 0x80,
+    0x80, 0x03, 0x87, 0x87, 0x83, 0x83, 0x80, 0x87, 0x02, 0x82, 0x82, 0x80,
+    0x81, 0x82, 0x03, 0x7e, 0x82, 0x7e, 0x82, 0x80, 0x7e, 0x07, 0x82, 0x7e,
+    0x83, 0x7e, 0x7e, 0x82, 0x82, 0x7e, 0x83, 0x82, 0x05, 0x7e, 0x82, 0x7e,
+    0x82, 0x82, 0x85, 0x80, 0x82, 0x81, 0x7e, 0x80, 0x77, 0x07, 0x7a, 0x77,
+    0x77, 0x94, 0xc3, 0xd1, 0xde, 0xd9, 0x80, 0xca, 0x02, 0xdb, 0xe9, 0xe9,
+    0x87, 0xd6, 0x02, 0xe9, 0xf1, 0xdf, 0x80, 0xdc, 0x00, 0xc6, 0x82, 0xd6,
+    0x02, 0xdc, 0xc6, 0xbb, 0x80, 0xbe, 0x29, 0x90, 0x8d, 0xa3, 0xa3, 0xbe,
+    0xe6, 0xf2, 0xed, 0xa3, 0x78, 0x78, 0x8d, 0x79, 0x28, 0x28, 0x36, 0x28,
+    0x57, 0x28, 0x24, 0x24, 0x28, 0x36, 0x28, 0x32, 0xb5, 0xee, 0xa2, 0x8e,
+    0x57, 0x28, 0x45, 0x5c, 0x79, 0x90, 0x8e, 0xe9, 0xf0, 0xe4, 0xbe, 0xc6,
+    0xdc, 0x80, 0xc6, 0x0d, 0xd0, 0xa3, 0xe3, 0xea, 0xe0, 0xc6, 0xe0, 0xe3,
+    0xe4, 0xe9, 0xbe, 0xad, 0xad, 0xd6, 0x81, 0xe3, 0x01, 0xe4, 0xe4, 0x83,
+    0xd6, 0x82, 0xe5, 0x09, 0xdf, 0xe4, 0xe9, 0xde, 0xdb, 0xdb, 0xed, 0xeb,
+    0xfd, 0xf6, 0x80, 0xeb, 0x01, 0xd1, 0x3c, 0x87, 0x00, 0x01, 0x01, 0x01,
+    0x80, 0x00, 0x0a, 0x01, 0x00, 0x01, 0x03, 0x00, 0x01, 0x01, 0x00, 0x00,
+    0x01, 0x6e, 0x81, 0x75, 0x09, 0x7a, 0x73, 0x75, 0x7d, 0x7a, 0x73, 0x7d,
+    0x7d, 0x73, 0x7a, 0x80, 0x6e, 0x07, 0x7a, 0x7a, 0x77, 0x7a, 0x7a, 0x77,
+    0x77, 0x7d, 0x80, 0x7e, 0x07, 0x82, 0x7e, 0x77, 0x77, 0x7e, 0x7e, 0x77,
+    0x7d, 0x87, 0x77, 0x01, 0x7d, 0x7d, 0x82, 0x6e, 0x00, 0x75, 0x80, 0x6e,
+    0x1f, 0x75, 0x63, 0x33, 0x17, 0x06, 0x06, 0x0f, 0x15, 0x21, 0x2e, 0x2b,
+    0x30, 0x35, 0x42, 0x3d, 0x30, 0x21, 0x17, 0x0d, 0x37, 0x91, 0xc2, 0xce,
+    0xc5, 0xc5, 0xb8, 0xae, 0xae, 0xa7, 0xa7, 0x9f, 0x9f, 0x80, 0x93, 0x02,
+    0x95, 0x91, 0x8c, 0x81, 0x91, 0x02, 0x87, 0x87, 0x8a, 0x84, 0x87, 0x02,
+    0x82, 0x83, 0x82, 0x80, 0x87, 0x01, 0x82, 0x80, 0x82, 0x82, 0x00, 0x7e,
+    0x83, 0x82, 0x00, 0x7e, 0x81, 0x82, 0x0a, 0x80, 0x82, 0x7e, 0x82, 0x7e,
+    0x7e, 0x82, 0x7e, 0x82, 0x7e, 0x7e, 0x83, 0x82, 0x82, 0x7e, 0x03, 0x82,
+    0x82, 0x7a, 0x77, 0x80, 0x7a, 0x04, 0x77, 0x86, 0xdd, 0xee, 0xde, 0x80,
+    0xdb, 0x05, 0xca, 0xd2, 0xe9, 0xe6, 0xe9, 0xdc, 0x83, 0xd2, 0x07, 0xdf,
+    0xdf, 0xdc, 0xd2, 0xe4, 0xdf, 0xdf, 0xdc, 0x80, 0xc6, 0x80, 0xd6, 0x02,
+    0xd2, 0xc6, 0xc6, 0x81, 0xad, 0x09, 0x90, 0x90, 0xbe, 0xe6, 0xf2, 0xfe,
+    0xe8, 0x78, 0x65, 0x45, 0x80, 0x36, 0x44, 0x57, 0xbe, 0x5c, 0x24, 0x24,
+    0x36, 0x28, 0xa2, 0x9d, 0x36, 0x3f, 0x28, 0x3f, 0x29, 0x3f, 0x29, 0x24,
+    0x32, 0xda, 0xf2, 0xc6, 0x9d, 0xa8, 0xe0, 0xc6, 0xd0, 0xbc, 0xbc, 0xb0,
+    0xb0, 0xbc, 0xbc, 0x90, 0xbc, 0xe0, 0xe0, 0xc6, 0xd0, 0xe0, 0xe0, 0xd6,
+    0xbe, 0xad, 0xd0, 0xe3, 0xe4, 0xe8, 0xde, 0xe4, 0xe3, 0xe0, 0xd6, 0xc6,
+    0xd2, 0xd2, 0xdf, 0xe5, 0xea, 0xea, 0xe5, 0xe5, 0xe4, 0xdf, 0xdf, 0xdb,
+    0xde, 0xde, 0xee, 0xfc, 0x80, 0xf6, 0x04, 0xda, 0x8b, 0x8f, 0xbf, 0x62,
+    0x91, 0x00, 0x06, 0x01, 0x01, 0x06, 0x06, 0x02, 0x6e, 0x6e, 0x80, 0x75,
+    0x06, 0x81, 0x73, 0x75, 0x7d, 0x75, 0x7d, 0x7d, 0x82, 0x6e, 0x02, 0x7d,
+    0x7a, 0x7a, 0x80, 0x77, 0x01, 0x73, 0x7a, 0x81, 0x77, 0x01, 0x7d, 0x7d,
+    0x86, 0x77, 0x00, 0x7d, 0x83, 0x77, 0x82, 0x6e, 0x01, 0x75, 0x75, 0x81,
+    0x6e, 0x23, 0x70, 0x4d, 0x31, 0x10, 0x06, 0x06, 0x0f, 0x15, 0x21, 0x25,
+    0x30, 0x30, 0x35, 0x42, 0x35, 0x2e, 0x1d, 0x10, 0x27, 0x71, 0xae, 0xce,
+    0xc5, 0xc5, 0xb8, 0xae, 0xae, 0xac, 0xa7, 0xa7, 0x9f, 0x9b, 0x9b, 0x8c,
+    0x8c, 0x91, 0x80, 0x8c, 0x01, 0x91, 0x91, 0x83, 0x87, 0x05, 0x80, 0x87,
+    0x87, 0x82, 0x83, 0x87, 0x84, 0x82, 0x02, 0x7e, 0x7e, 0x82, 0x80, 0x7e,
+    0x01, 0x82, 0x80, 0x80, 0x82, 0x81, 0x7e, 0x02, 0x82, 0x80, 0x80, 0x82,
+    0x7e, 0x0e, 0x82, 0x7e, 0x82, 0x7e, 0x7e, 0x82, 0x7e, 0x7e, 0x82, 0x7a,
+    0x77, 0x77, 0x82, 0x82, 0x7e, 0x80, 0x77, 0x82, 0x7a, 0x05, 0x73, 0x7a,
+    0xc3, 0xed, 0xda, 0xde, 0x80, 0xdb, 0x05, 0xd9, 0xd9, 0xe9, 0xe4, 0xdf,
+    0xd2, 0x80, 0xca, 0x0a, 0xbb, 0xbb, 0xca, 0xd2, 0xdc, 0xd2, 0xe9, 0xe4,
+    0xdf, 0xdf, 0xdc, 0x83, 0xc6, 0x0c, 0xdc, 0xd6, 0xc6, 0xad, 0xbb, 0xbe,
+    0xa3, 0x90, 0xbe, 0xc6, 0xdc, 0xe9, 0xbe, 0x80, 0x65, 0x19, 0x90, 0xa2,
+    0x5c, 0x28, 0x5c, 0x3f, 0x29, 0x32, 0x5c, 0x28, 0x7c, 0x7c, 0x6f, 0x8e,
+    0x29, 0x53, 0x8e, 0x45, 0x36, 0x28, 0x53, 0xdb, 0xc6, 0x90, 0x65, 0x8d,
+    0x84, 0xb0, 0x1d, 0xbc, 0xb0, 0x78, 0xbc, 0xd0, 0xe0, 0xd0, 0xd0, 0xe0,
+    0xd0, 0xdc, 0xbe, 0xd0, 0xe0, 0xe0, 0xf1, 0xf1, 0xe6, 0xe9, 0xe0, 0xc6,
+    0xbb, 0xc6, 0xd2, 0xd2, 0xe5, 0xea, 0xf4, 0xf4, 0xf7, 0x80, 0xf1, 0x09,
+    0xe9, 0xe6, 0xf2, 0xed, 0xfb, 0xed, 0xed, 0xee, 0xd1, 0x39, 0x80, 0x00,
+    0x00, 0x0b, 0x8d, 0x00, 0x15, 0x01, 0x03, 0x01, 0x06, 0x0f, 0x07, 0x15,
+    0x1f, 0x2a, 0x71, 0x71, 0x75, 0x71, 0x71, 0x75, 0x7a, 0x75, 0x73, 0x75,
+    0x7d, 0x7d, 0x7a, 0x80, 0x7d, 0x08, 0x73, 0x7d, 0x7d, 0x73, 0x7d, 0x7e,
+    0x7a, 0x77, 0x7d, 0x81, 0x77, 0x12, 0x73, 0x77, 0x73, 0x7d, 0x7d, 0x77,
+    0x77, 0x7a, 0x77, 0x77, 0x73, 0x7d, 0x73, 0x73, 0x7a, 0x77, 0x77, 0x73,
+    0x7d, 0x83, 0x6e, 0x2b, 0x75, 0x6e, 0x6e, 0x68, 0x64, 0x4d, 0x2c, 0x10,
+    0x06, 0x06, 0x0f, 0x15, 0x21, 0x2e, 0x30, 0x30, 0x35, 0x35, 0x2e, 0x1d,
+    0x05, 0x15, 0x43, 0xa4, 0xc5, 0xc5, 0xc2, 0xb8, 0xae, 0xae, 0xa6, 0xa7,
+    0xa7, 0x9f, 0x9b, 0x9b, 0x95, 0x95, 0x91, 0x8c, 0x91, 0x91, 0x8c, 0x91,
+    0x84, 0x87, 0x04, 0x83, 0x87, 0x87, 0x83, 0x7e, 0x86, 0x82, 0x01, 0x7e,
+    0x7e, 0x82, 0x82, 0x80, 0x7e, 0x02, 0x82, 0x7e, 0x7e, 0x80, 0x80, 0x00,
+    0x82, 0x80, 0x7e, 0x85, 0x82, 0x08, 0x7e, 0x77, 0x7a, 0x77, 0x7e, 0x82,
+    0x7a, 0x82, 0x82, 0x80, 0x77, 0x01, 0x7a, 0x77, 0x80, 0x7a, 0x05, 0x73,
+    0x73, 0xa5, 0xda, 0xe8, 0xe8, 0x82, 0xd9, 0x05, 0xdb, 0xdc, 0xdf, 0xdf,
+    0xdc, 0xca, 0x82, 0xb6, 0x05, 0xca, 0xca, 0xd2, 0xdf, 0xe4, 0xdf, 0x83,
+    0xdc, 0x25, 0xc6, 0xc6, 0xbe, 0xad, 0xc6, 0xed, 0xf2, 0xbe, 0xa3, 0xbe,
+    0xbe, 0xad, 0xbe, 0xad, 0x65, 0x65, 0x78, 0xbe, 0xde, 0xb5, 0x28, 0x3f,
+    0x32, 0x79, 0x53, 0x1c, 0x1c, 0x4b, 0x24, 0x6a, 0x5c, 0x24, 0x3f, 0x84,
+    0x5c, 0x3f, 0x36, 0x53, 0x80, 0x57, 0x06, 0x45, 0x65, 0x90, 0xde, 0xe8,
+    0xb0, 0xa3, 0x80, 0xb0, 0x02, 0xa3, 0x90, 0xb0, 0x80, 0xbc, 0x00, 0xd0,
+    0x80, 0xc6, 0x08, 0xd0, 0xd6, 0xd6, 0xe4, 0xe4, 0xdf, 0xdc, 0xe0, 0xc6,
+    0x80, 0xbb, 0x01, 0xd2, 0xe5, 0x81, 0xea, 0x05, 0xf0, 0xf8, 0xfa, 0xfb,
+    0xf9, 0xf0, 0x81, 0xf1, 0x03, 0xe9, 0xf0, 0xc4, 0x19, 0x80, 0x00, 0x05,
+    0x03, 0x01, 0x00, 0x01, 0x00, 0x01, 0x80, 0x00, 0x02, 0x01, 0x00, 0x00,
+    0x80, 0x01, 0x10, 0x04, 0x06, 0x0f, 0x10, 0x15, 0x21, 0x2a, 0x37, 0x47,
+    0x59, 0x81, 0x74, 0x71, 0x6e, 0x71, 0x71, 0x81, 0x81, 0x75, 0x00, 0x7d,
+    0x80, 0x6e, 0x0c, 0x7a, 0x73, 0x73, 0x7d, 0x7d, 0x7a, 0x7d, 0x82, 0x7a,
+    0x77, 0x7d, 0x7d, 0x73, 0x82, 0x77, 0x05, 0x7d, 0x7d, 0x89, 0x7d, 0x81,
+    0x77, 0x83, 0x6e, 0x03, 0x77, 0x73, 0x73, 0x7d, 0x85, 0x6e, 0x1a, 0x68,
+    0x68, 0x64, 0x4d, 0x2c, 0x10, 0x02, 0x02, 0x0f, 0x1d, 0x21, 0x2e, 0x30,
+    0x30, 0x3d, 0x2e, 0x1f, 0x10, 0x10, 0x2f, 0x82, 0xb8, 0xc5, 0xc5, 0xb8,
+    0xae, 0xb4, 0x80, 0xa7, 0x07, 0x9f, 0x9b, 0x9b, 0x95, 0x95, 0x91, 0x91,
+    0x8c, 0x81, 0x91, 0x83, 0x87, 0x08, 0x83, 0x87, 0x87, 0x82, 0x83, 0x82,
+    0x7e, 0x82, 0x82, 0x80, 0x87, 0x84, 0x82, 0x00, 0x7e, 0x83, 0x82, 0x01,
+    0x7e, 0x80, 0x81, 0x82, 0x03, 0x7e, 0x82, 0x7e, 0x7e, 0x83, 0x82, 0x08,
+    0x80, 0x7e, 0x77, 0x7a, 0x82, 0x7e, 0x77, 0x77, 0x7a, 0x80, 0x77, 0x04,
+    0x7a, 0x7a, 0x73, 0x77, 0x77, 0x81, 0x7a, 0x04, 0xc3, 0xf1, 0xf2, 0xe6,
+    0xdb, 0x80, 0xd9, 0x06, 0xca, 0xca, 0xd2, 0xdf, 0xdf, 0xdc, 0xbb, 0x83,
+    0xa8, 0x18, 0xb6, 0xca, 0xc6, 0xd6, 0xe4, 0xf0, 0xf2, 0xf2, 0xe6, 0xdc,
+    0xbe, 0xad, 0xad, 0xb6, 0xe8, 0xe8, 0xe6, 0xb0, 0x90, 0xa3, 0xa3, 0x90,
+    0x65, 0x57, 0x45, 0x80, 0x57, 0x24, 0x79, 0x79, 0x45, 0xa2, 0x53, 0x24,
+    0x24, 0x32, 0x29, 0x3f, 0x1c, 0x24, 0x3f, 0x6f, 0x53, 0x98, 0x99, 0x6f,
+    0x98, 0xee, 0xc7, 0xa2, 0x79, 0x45, 0x45, 0x65, 0xe6, 0xf2, 0xd0, 0xa3,
+    0xa3, 0xb0, 0xb0, 0x90, 0xa3, 0xa3, 0xb0, 0x81, 0xbc, 0x0d, 0xc6, 0xc6,
+    0xd0, 0xc6, 0xd6, 0xe4, 0xdf, 0xdc, 0xd6, 0xc6, 0xb6, 0xb6, 0xbb, 0xd6,
+    0x82, 0xe5, 0x05, 0xea, 0xf1, 0xf1, 0xf7, 0xf8, 0xf1, 0x81, 0xe9, 0x04,
+    0xe6, 0xf2, 0xf9, 0xf7, 0x5a, 0x83, 0x00, 0x1b, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x04, 0x06, 0x06, 0x0f, 0x10, 0x15, 0x25, 0x2f, 0x42,
+    0x55, 0x71, 0x7a, 0x91, 0xa7, 0xb4, 0xbd, 0x75, 0x6e, 0x75, 0x75, 0x71,
+    0x81, 0x75, 0x01, 0x73, 0x7d, 0x81, 0x7a, 0x09, 0x7d, 0x73, 0x73, 0x7d,
+    0x73, 0x7a, 0x82, 0x7e, 0x77, 0x73, 0x80, 0x7d, 0x08, 0x77, 0x7d, 0x77,
+    0x7a, 0x7a, 0x89, 0x89, 0x7d, 0x77, 0x83, 0x7d, 0x04, 0x7a, 0x7d, 0x73,
+    0x73, 0x7d, 0x81, 0x6e, 0x25, 0x75, 0x6e, 0x75, 0x6e, 0x70, 0x6b, 0x64,
+    0x55, 0x2c, 0x10, 0x06, 0x02, 0x07, 0x1d, 0x21, 0x2a, 0x30, 0x3d, 0x33,
+    0x21, 0x10, 0x0f, 0x1f, 0x5b, 0xac, 0xc5, 0xc5, 0xbd, 0xb8, 0xb4, 0xac,
+    0xac, 0xa7, 0x9c, 0x9b, 0x9b, 0x95, 0x95, 0x82, 0x91, 0x86, 0x87, 0x80,
+    0x82, 0x00, 0x83, 0x82, 0x82, 0x05, 0x87, 0x91, 0x87, 0x82, 0x82, 0x7e,
+    0x85, 0x82, 0x00, 0x7e, 0x8c, 0x82, 0x0b, 0x77, 0x7a, 0x77, 0x77, 0x7e,
+    0x82, 0x82, 0x7a, 0x7a, 0x77, 0x7a, 0x7a, 0x80, 0x77, 0x05, 0x7a, 0x77,
+    0x7a, 0x73, 0x7a, 0x73, 0x80, 0x7a, 0x12, 0xa5, 0xde, 0xf1, 0xf2, 0xde,
+    0xdb, 0xc4, 0xd9, 0xca, 0xca, 0xbb, 0xca, 0xd2, 0xdc, 0xdc, 0xd2, 0xca,
+    0xbb, 0xb6, 0x81, 0xa8, 0x07, 0xb6, 0xbb, 0xc6, 0xe4, 0xf1, 0xdc, 0xa8,
+    0x79, 0x80, 0x9d, 0x34, 0xcf, 0xe6, 0xe9, 0xbe, 0xa3, 0x90, 0x78, 0x90,
+    0x78, 0x57, 0x6f, 0xa2, 0x79, 0x36, 0x28, 0x28, 0x3f, 0x36, 0x79, 0x32,
+    0x24, 0x3f, 0x29, 0x3f, 0x24, 0x19, 0x4b, 0x53, 0x3f, 0xda, 0xee, 0xcf,
+    0x79, 0x84, 0xe6, 0xee, 0xf2, 0xd0, 0xa3, 0x8d, 0x65, 0xbe, 0xd6, 0xc6,
+    0xbc, 0xb0, 0xa3, 0x90, 0x90, 0xf2, 0xed, 0xb0, 0xb0, 0x81, 0xbc, 0x80,
+    0xc6, 0x07, 0xd6, 0xdf, 0xdc, 0xdc, 0xbe, 0x9d, 0xa8, 0xbb, 0x83, 0xe5,
+    0x00, 0xea, 0x82, 0xf0, 0x81, 0xe9, 0x05, 0xf1, 0xf2, 0xf9, 0xfe, 0xf8,
+    0x5a, 0x85, 0x00, 0x00, 0x01, 0x80, 0x06, 0x1d, 0x05, 0x17, 0x1d, 0x27,
+    0x37, 0x43, 0x64, 0x7a, 0x91, 0x9f, 0xb4, 0xbd, 0xbd, 0xc2, 0xc5, 0xc9,
+    0xc9, 0x75, 0x6e, 0x75, 0x75, 0x6e, 0x75, 0x75, 0x73, 0x81, 0x75, 0x75,
+    0x7d, 0x7a, 0x80, 0x7d, 0x12, 0x81, 0x7d, 0x7d, 0x73, 0x81, 0x89, 0x82,
+    0x7e, 0x73, 0x7d, 0x73, 0x7d, 0x77, 0x7d, 0x77, 0x77, 0x7a, 0x7a, 0x81,
+    0x80, 0x7d, 0x02, 0x73, 0x7d, 0x7d, 0x80, 0x6e, 0x80, 0x7d, 0x25, 0x75,
+    0x73, 0x6e, 0x75, 0x6e, 0x6e, 0x75, 0x70, 0x70, 0x6b, 0x6b, 0x63, 0x49,
+    0x27, 0x07, 0x06, 0x02, 0x07, 0x1d, 0x27, 0x2e, 0x30, 0x3d, 0x2e, 0x1d,
+    0x0f, 0x10, 0x37, 0x87, 0xb8, 0xc5, 0xb8, 0xb8, 0xae, 0xac, 0xac, 0x9f,
+    0x9f, 0x80, 0x93, 0x00, 0x8c, 0x82, 0x91, 0x84, 0x87, 0x00, 0x83, 0x84,
+    0x82, 0x05, 0x7e, 0x82, 0x82, 0x7e, 0x82, 0x87, 0x80, 0x82, 0x00, 0x7e,
+    0x84, 0x82, 0x00, 0x7e, 0x80, 0x82, 0x07, 0x7e, 0x7e, 0x7a, 0x82, 0x77,
+    0x7e, 0x82, 0x82, 0x80, 0x7e, 0x04, 0x82, 0x82, 0x77, 0x82, 0x82, 0x80,
+    0x77, 0x01, 0x7a, 0x7a, 0x80, 0x77, 0x00, 0x7a, 0x82, 0x77, 0x03, 0x7a,
+    0x7a, 0x73, 0x7a, 0x80, 0x6e, 0x19, 0x86, 0xd1, 0xe9, 0xed, 0xde, 0xd9,
+    0xd9, 0xc4, 0xdb, 0xdb, 0xd2, 0xb6, 0xb6, 0xd2, 0xd2, 0xe4, 0xf0, 0xe4,
+    0xe4, 0xd6, 0xd6, 0xc6, 0xc6, 0xbb, 0xb6, 0xa8, 0x80, 0xb6, 0x2f, 0x8e,
+    0x6f, 0x5c, 0x6f, 0x8e, 0xbe, 0xc6, 0xbe, 0xad, 0xa3, 0x90, 0x65, 0x78,
+    0x90, 0xbe, 0xe8, 0xee, 0xc7, 0x28, 0x29, 0x36, 0xa2, 0xc7, 0x29, 0x11,
+    0x32, 0x32, 0x19, 0x3f, 0x3f, 0x32, 0x24, 0x1c, 0x1c, 0x7c, 0x84, 0x6f,
+    0x4b, 0x32, 0x6f, 0xbe, 0xe0, 0xbc, 0xa3, 0x90, 0x90, 0xbe, 0xc6, 0x80,
+    0xb0, 0x05, 0xa3, 0x78, 0xa3, 0xf0, 0xf2, 0xc6, 0x81, 0xb0, 0x0e, 0xbc,
+    0xe0, 0xe8, 0xbe, 0xd6, 0xdc, 0xc6, 0xc6, 0xb6, 0xb6, 0xc6, 0xe3, 0xe5,
+    0xdf, 0xdf, 0x80, 0xe5, 0x80, 0xf0, 0x06, 0xe9, 0xe9, 0xe4, 0xdf, 0xe9,
+    0xe9, 0xea, 0x80, 0xf1, 0x19, 0xf8, 0xf1, 0xe6, 0x39, 0xbf, 0x8b, 0x00,
+    0x00, 0x01, 0x06, 0x02, 0x05, 0x17, 0x1f, 0x27, 0x37, 0x4d, 0x71, 0x87,
+    0x9b, 0xac, 0xbd, 0xbd, 0xc5, 0xce, 0xce, 0x80, 0xc9, 0x80, 0xc2, 0x00,
+    0x70, 0x80, 0x75, 0x05, 0x6e, 0x6e, 0x7a, 0x71, 0x75, 0x75, 0x80, 0x7d,
+    0x0d, 0x75, 0x7d, 0x7d, 0x73, 0x7a, 0x7d, 0x73, 0x7d, 0x89, 0x85, 0x85,
+    0x7d, 0x73, 0x7d, 0x81, 0x6e, 0x01, 0x7d, 0x77, 0x82, 0x7d, 0x01, 0x73,
+    0x7d, 0x82, 0x6e, 0x2a, 0x7d, 0x75, 0x73, 0x75, 0x6e, 0x70, 0x70, 0x68,
+    0x70, 0x68, 0x68, 0x6b, 0x6c, 0x59, 0x41, 0x1f, 0x0f, 0x06, 0x06, 0x07,
+    0x1d, 0x27, 0x2a, 0x33, 0x2e, 0x1f, 0x10, 0x0f, 0x1f, 0x59, 0xac, 0xc5,
+    0xc2, 0xb8, 0xae, 0xb4, 0x9e, 0xac, 0x9f, 0x93, 0x9b, 0x93, 0x95, 0x81,
+    0x91, 0x83, 0x87, 0x00, 0x83, 0x80, 0x87, 0x04, 0x82, 0x82, 0x83, 0x82,
+    0x82, 0x81, 0x7e, 0x86, 0x82, 0x18, 0x7e, 0x82, 0x82, 0x7e, 0x82, 0x7a,
+    0x77, 0x77, 0x7d, 0x7a, 0x7e, 0x82, 0x7a, 0x7a, 0x77, 0x82, 0x7e, 0x82,
+    0x7a, 0x77, 0x77, 0x7e, 0x7a, 0x77, 0x7a, 0x80, 0x77, 0x0b, 0x7a, 0x7a,
+    0x77, 0x82, 0x7a, 0x77, 0x77, 0x7a, 0x77, 0x73, 0x73, 0x77, 0x80, 0x6e,
+    0x17, 0x7d, 0x73, 0x7d, 0x7a, 0x73, 0x8f, 0xd9, 0xe9, 0xde, 0xd9, 0xd9,
+    0xc4, 0xdb, 0xdb, 0xe9, 0xdc, 0xe6, 0xe8, 0xe6, 0xe9, 0xe4, 0xdf, 0xdf,
+    0xdc, 0x82, 0xc6, 0x3c, 0xbe, 0xb6, 0xb3, 0xb3, 0xa8, 0x8e, 0x6f, 0x53,
+    0x4b, 0x9d, 0xad, 0x9d, 0xa3, 0xa3, 0x90, 0x78, 0x90, 0xb0, 0xbe, 0xbe,
+    0xad, 0x45, 0x29, 0x36, 0x45, 0x79, 0x4b, 0x79, 0x32, 0x1c, 0x1c, 0x34,
+    0x29, 0x1c, 0x3f, 0x29, 0x29, 0x53, 0x1c, 0x5a, 0xda, 0xad, 0x79, 0x5c,
+    0x36, 0x90, 0xa3, 0x78, 0xa3, 0xfc, 0xfc, 0xd0, 0xa3, 0xa3, 0xb0, 0x90,
+    0x65, 0x78, 0xdf, 0xdf, 0xdc, 0x81, 0xb0, 0x04, 0xd6, 0xe4, 0xf2, 0xe9,
+    0xd6, 0x80, 0xc6, 0x02, 0xbb, 0xd6, 0xe3, 0x80, 0xd6, 0x03, 0xe5, 0xdf,
+    0xe5, 0xe5, 0x81, 0xe4, 0x80, 0xd6, 0x02, 0xe5, 0xea, 0xea, 0x81, 0xf0,
+    0x1e, 0xe9, 0xed, 0xfb, 0xee, 0xda, 0x1e, 0x07, 0x17, 0x1f, 0x2c, 0x37,
+    0x4d, 0x71, 0x91, 0xa7, 0xb4, 0xbd, 0xc2, 0xc2, 0xc9, 0xce, 0xce, 0xc5,
+    0xc5, 0xc2, 0xbd, 0xb8, 0xbd, 0xbd, 0xae, 0xb4, 0x82, 0x75, 0x16, 0x6e,
+    0x73, 0x75, 0x73, 0x75, 0x75, 0x7a, 0x73, 0x7d, 0x7d, 0x73, 0x73, 0x77,
+    0x7d, 0x7d, 0x73, 0x77, 0x7a, 0x77, 0x73, 0x73, 0x7a, 0x77, 0x84, 0x6e,
+    0x06, 0x7d, 0x73, 0x73, 0x7d, 0x7d, 0x73, 0x73, 0x80, 0x7d, 0x80, 0x6e,
+    0x01, 0x75, 0x75, 0x81, 0x70, 0x21, 0x68, 0x68, 0x60, 0x64, 0x5d, 0x37,
+    0x17, 0x02, 0x06, 0x02, 0x10, 0x1d, 0x27, 0x2e, 0x2e, 0x27, 0x1d, 0x0f,
+    0x10, 0x37, 0x87, 0xb8, 0xc5, 0xb8, 0xae, 0xae, 0xa6, 0x9e, 0x9f, 0x9b,
+    0x93, 0x9b, 0x95, 0x8c, 0x80, 0x91, 0x82, 0x87, 0x01, 0x82, 0x87, 0x80,
+    0x82, 0x02, 0x85, 0x82, 0x7e, 0x84, 0x82, 0x00, 0x80, 0x81, 0x82, 0x00,
+    0x7e, 0x80, 0x82, 0x09, 0x7e, 0x82, 0x7a, 0x82, 0x77, 0x77, 0x7a, 0x7a,
+    0x77, 0x77, 0x81, 0x7a, 0x0a, 0x82, 0x7a, 0x77, 0x7a, 0x7a, 0x77, 0x7a,
+    0x82, 0x7a, 0x7a, 0x77, 0x82, 0x7a, 0x03, 0x77, 0x77, 0x7d, 0x77, 0x83,
+    0x6e, 0x03, 0x7a, 0x7a, 0x73, 0x73, 0x80, 0x7a, 0x11, 0x73, 0x7f, 0xa1,
+    0xcf, 0xd9, 0xc4, 0xc0, 0xc4, 0x9a, 0x6a, 0xc0, 0xdc, 0xdc, 0xe9, 0xdb,
+    0xdc, 0xdf, 0xdf, 0x81, 0xc6, 0x3f, 0xbe, 0xc6, 0xc6, 0xdc, 0xdc, 0xed,
+    0xfa, 0xe9, 0xa8, 0x8e, 0x79, 0x4b, 0x79, 0x9d, 0x90, 0xa3, 0x90, 0x90,
+    0x9d, 0xbe, 0xa3, 0x90, 0x65, 0x45, 0x36, 0x79, 0xa2, 0x5c, 0x36, 0x24,
+    0x32, 0x32, 0x6f, 0x4b, 0x34, 0x39, 0x26, 0x34, 0x32, 0x5a, 0x6a, 0x5c,
+    0xa8, 0xe8, 0xed, 0xbe, 0x90, 0x57, 0x36, 0x57, 0x65, 0x90, 0xe8, 0xf2,
+    0xe6, 0xe0, 0xb0, 0xa3, 0x90, 0x65, 0x78, 0xbe, 0xc6, 0xc6, 0x80, 0xb0,
+    0x04, 0xd6, 0xf1, 0xe9, 0xe9, 0xd6, 0x81, 0xc6, 0x84, 0xd6, 0x02, 0xe5,
+    0xea, 0xe5, 0x80, 0xe4, 0x80, 0xd6, 0x00, 0xe5, 0x81, 0xea, 0x14, 0xf0,
+    0xf0, 0xe9, 0xe8, 0xed, 0xde, 0xf1, 0xda, 0x2d, 0x37, 0x50, 0x71, 0x91,
+    0xac, 0xbd, 0xc2, 0xce, 0xc9, 0xce, 0xce, 0xc9, 0x80, 0xc2, 0x81, 0xb8,
+    0x00, 0xb4, 0x80, 0xaf, 0x01, 0x9e, 0xa7, 0x81, 0x75, 0x01, 0x6e, 0x6e,
+    0x80, 0x75, 0x05, 0x73, 0x75, 0x73, 0x75, 0x7d, 0x75, 0x81, 0x6e, 0x80,
+    0x7d, 0x04, 0x73, 0x7a, 0x73, 0x73, 0x7d, 0x81, 0x6e, 0x03, 0x7a, 0x73,
+    0x7a, 0x73, 0x80, 0x7d, 0x02, 0x75, 0x73, 0x73, 0x81, 0x75, 0x81, 0x6e,
+    0x20, 0x70, 0x68, 0x70, 0x68, 0x70, 0x60, 0x6b, 0x64, 0x64, 0x55, 0x31,
+    0x10, 0x02, 0x01, 0x06, 0x10, 0x1d, 0x27, 0x2e, 0x25, 0x1d, 0x0f, 0x0f,
+    0x21, 0x59, 0xac, 0xc5, 0xc5, 0xb8, 0xae, 0xac, 0xa7, 0x9f, 0x81, 0x9b,
+    0x02, 0x95, 0x91, 0x8c, 0x84, 0x87, 0x02, 0x82, 0x82, 0x7e, 0x81, 0x82,
+    0x02, 0x7e, 0x82, 0x82, 0x80, 0x7e, 0x85, 0x82, 0x03, 0x7e, 0x82, 0x82,
+    0x7a, 0x80, 0x82, 0x03, 0x77, 0x7e, 0x82, 0x7a, 0x80, 0x77, 0x01, 0x82,
+    0x80, 0x80, 0x7a, 0x02, 0x77, 0x7a, 0x82, 0x80, 0x7a, 0x01, 0x77, 0x7a,
+    0x81, 0x77, 0x01, 0x7a, 0x7a, 0x81, 0x6e, 0x01, 0x7a, 0x7a, 0x81, 0x6e,
+    0x84, 0x7a, 0x0f, 0x73, 0x7a, 0x7f, 0xa1, 0xca, 0xcf, 0xc0, 0xc0, 0xb3,
+    0x9a, 0x9a, 0xb3, 0xdc, 0xdc, 0xd2, 0xca, 0x80, 0xc6, 0x10, 0xbe, 0xc6,
+    0xc6, 0xbe, 0xc6, 0xdc, 0xdc, 0xdb, 0xe8, 0xdc, 0xc6, 0xbe, 0xad, 0x9d,
+    0x79, 0x5c, 0x9d, 0x80, 0x90, 0x2b, 0xad, 0xde, 0xdb, 0xad, 0x57, 0x36,
+    0x45, 0x65, 0xbe, 0xe8, 0xa2, 0x8e, 0x3f, 0x4b, 0x32, 0x4b, 0x32, 0x7c,
+    0x7c, 0x5a, 0x5a, 0x9a, 0x5a, 0x3f, 0xb5, 0xa2, 0xe6, 0xf2, 0xdb, 0xad,
+    0x9d, 0x8e, 0x57, 0x65, 0x78, 0xc6, 0xdc, 0xdc, 0xe0, 0xc6, 0xb0, 0x8d,
+    0x57, 0x65, 0x80, 0xad, 0x02, 0xb0, 0xa3, 0xbe, 0x80, 0xe6, 0x01, 0xe9,
+    0xdc, 0x85, 0xc6, 0x01, 0xdf, 0xdf, 0x80, 0xe5, 0x83, 0xe4, 0x01, 0xe5,
+    0xe5, 0x81, 0xea, 0x80, 0xe9, 0x08, 0xdb, 0xe8, 0xe9, 0xe9, 0xda, 0x86,
+    0xac, 0xbd, 0xc2, 0x83, 0xce, 0x09, 0xc9, 0xc2, 0xbd, 0xb8, 0xbd, 0xae,
+    0xb4, 0xae, 0xae, 0xaf, 0x81, 0xa7, 0x01, 0x9e, 0x9f, 0x86, 0x75, 0x11,
+    0x6e, 0x71, 0x73, 0x6e, 0x75, 0x75, 0x73, 0x73, 0x75, 0x7a, 0x73, 0x75,
+    0x73, 0x7a, 0x7a, 0x75, 0x7a, 0x75, 0x80, 0x6e, 0x03, 0x7d, 0x7a, 0x7a,
+    0x73, 0x80, 0x7d, 0x85, 0x75, 0x04, 0x6e, 0x75, 0x75, 0x70, 0x70, 0x80,
+    0x68, 0x24, 0x6b, 0x60, 0x66, 0x66, 0x63, 0x47, 0x27, 0x0f, 0x02, 0x01,
+    0x06, 0x10, 0x1d, 0x21, 0x25, 0x21, 0x10, 0x0f, 0x10, 0x37, 0x87, 0xbd,
+    0xc5, 0xb8, 0xae, 0xac, 0xac, 0x9f, 0x9b, 0x9b, 0x95, 0x95, 0x8c, 0x8c,
+    0x91, 0x80, 0x80, 0x80, 0x87, 0x83, 0x82, 0x80, 0x7e, 0x81, 0x82, 0x80,
+    0x7e, 0x03, 0x82, 0x82, 0x7e, 0x7e, 0x80, 0x82, 0x0a, 0x77, 0x77, 0x7a,
+    0x77, 0x7a, 0x7a, 0x80, 0x7e, 0x77, 0x7a, 0x7a, 0x81, 0x77, 0x05, 0x7a,
+    0x7a, 0x77, 0x7a, 0x7a, 0x73, 0x82, 0x7a, 0x07, 0x77, 0x7a, 0x7a, 0x82,
+    0x77, 0x73, 0x7a, 0x7a, 0x82, 0x6e, 0x00, 0x7a, 0x81, 0x6e, 0x03, 0x7a,
+    0x73, 0x7a, 0x71, 0x81, 0x7a, 0x37, 0x71, 0x6e, 0x7f, 0xa1, 0xcf, 0xca,
+    0xca, 0xc0, 0xb3, 0x99, 0x99, 0xca, 0xbe, 0xbb, 0xb6, 0xad, 0xad, 0xbb,
+    0xbb, 0xbe, 0xbb, 0xbe, 0xbe, 0xc6, 0xdc, 0xdb, 0xbe, 0xbb, 0xbb, 0xad,
+    0xad, 0xbe, 0xad, 0x9d, 0x9d, 0x90, 0x90, 0xad, 0xc6, 0xdc, 0xdc, 0x9d,
+    0x36, 0x45, 0x57, 0x65, 0xa3, 0xad, 0x36, 0x79, 0x4b, 0x5c, 0x3f, 0x29,
+    0x4b, 0x7c, 0x80, 0x6a, 0x16, 0x9a, 0x7c, 0x9a, 0xc7, 0xcf, 0x9d, 0x90,
+    0xad, 0xe8, 0xf2, 0xe0, 0xb0, 0x90, 0x78, 0x90, 0xbe, 0xbe, 0xc6, 0xc6,
+    0xb0, 0x78, 0x45, 0x57, 0x82, 0xa3, 0x82, 0xdc, 0x80, 0xc6, 0x05, 0xbe,
+    0xbe, 0xbb, 0xbb, 0xc6, 0xd6, 0x83, 0xe5, 0x00, 0xe4, 0x80, 0xe5, 0x02,
+    0xea, 0xea, 0xf0, 0x81, 0xe5, 0x0a, 0xe4, 0xe9, 0xe9, 0xe6, 0xf1, 0xe9,
+    0xdc, 0xc3, 0xc9, 0xce, 0xce, 0x80, 0xc9, 0x08, 0xc2, 0xc2, 0xbd, 0xb8,
+    0xb8, 0xae, 0xb4, 0xb4, 0xaf, 0x80, 0x9e, 0x03, 0xa7, 0xa7, 0x9f, 0x9f,
+    0x81, 0x9b, 0x00, 0x68, 0x87, 0x75, 0x03, 0x6e, 0x6e, 0x75, 0x75, 0x82,
+    0x6e, 0x00, 0x75, 0x80, 0x7a, 0x09, 0x75, 0x75, 0x73, 0x75, 0x73, 0x73,
+    0x75, 0x7a, 0x75, 0x75, 0x80, 0x6e, 0x04, 0x75, 0x71, 0x73, 0x75, 0x75,
+    0x81, 0x6e, 0x27, 0x75, 0x70, 0x6b, 0x6b, 0x68, 0x68, 0x60, 0x6b, 0x60,
+    0x60, 0x6c, 0x5d, 0x41, 0x1f, 0x0f, 0x06, 0x03, 0x02, 0x10, 0x1a, 0x21,
+    0x21, 0x15, 0x0f, 0x05, 0x1f, 0x59, 0xa6, 0xc5, 0xc5, 0xae, 0xac, 0xac,
+    0xa7, 0x9c, 0x93, 0x95, 0x91, 0x91, 0x8c, 0x80, 0x80, 0x80, 0x87, 0x80,
+    0x82, 0x01, 0x80, 0x82, 0x80, 0x7e, 0x01, 0x82, 0x7e, 0x80, 0x82, 0x81,
+    0x7e, 0x08, 0x82, 0x82, 0x7e, 0x82, 0x7e, 0x7e, 0x82, 0x77, 0x7a, 0x80,
+    0x77, 0x05, 0x7a, 0x80, 0x7e, 0x7e, 0x77, 0x82, 0x81, 0x77, 0x81, 0x7a,
+    0x10, 0x77, 0x73, 0x73, 0x77, 0x7a, 0x7a, 0x77, 0x7a, 0x7a, 0x77, 0x80,
+    0x7a, 0x73, 0x7a, 0x7a, 0x73, 0x7a, 0x81, 0x6e, 0x80, 0x7a, 0x12, 0x73,
+    0x73, 0x7a, 0x73, 0x6e, 0x71, 0x7a, 0x7a, 0x71, 0x71, 0x6e, 0x6e, 0x97,
+    0xd1, 0xde, 0xca, 0xca, 0xb6, 0xc0, 0x81, 0xb6, 0x02, 0xad, 0x9d, 0x9d,
+    0x80, 0xb6, 0x80, 0xbb, 0x08, 0xbe, 0xd2, 0xca, 0xb6, 0xad, 0xbe, 0xad,
+    0xad, 0xbe, 0x81, 0xad, 0x2d, 0x9d, 0xbe, 0xbb, 0xad, 0xa3, 0x65, 0x36,
+    0x45, 0x45, 0x57, 0x57, 0x5c, 0x6f, 0x3f, 0x29, 0x29, 0xa2, 0x79, 0x6f,
+    0x3f, 0x9a, 0xba, 0x9a, 0x6a, 0x5a, 0x7c, 0xe8, 0xed, 0x78, 0x36, 0x28,
+    0xb3, 0xdc, 0xb0, 0xa3, 0x90, 0x78, 0x65, 0x78, 0xa3, 0xa3, 0xb0, 0xb0,
+    0x8d, 0x36, 0x57, 0x81, 0x90, 0x00, 0xa3, 0x84, 0xc6, 0x03, 0xad, 0xb6,
+    0xad, 0xc6, 0x80, 0xd6, 0x82, 0xe5, 0x00, 0xe3, 0x83, 0xe5, 0x1b, 0xf0,
+    0xf8, 0xf0, 0xea, 0xdf, 0xdb, 0xdb, 0xe8, 0xe8, 0xe9, 0xe9, 0xcf, 0xd7,
+    0xce, 0xce, 0xc2, 0xc2, 0xbd, 0xb8, 0xb8, 0xae, 0xaa, 0xb4, 0xaf, 0xaf,
+    0x9e, 0xa7, 0xa7, 0x80, 0x9f, 0x80, 0x9b, 0x00, 0x95, 0x81, 0x8a, 0x00,
+    0x70, 0x82, 0x75, 0x80, 0x6e, 0x04, 0x75, 0x6e, 0x6e, 0x75, 0x6e, 0x80,
+    0x75, 0x01, 0x6e, 0x6e, 0x80, 0x75, 0x80, 0x6e, 0x80, 0x75, 0x01, 0x6e,
+    0x73, 0x81, 0x75, 0x03, 0x73, 0x75, 0x75, 0x6e, 0x81, 0x75, 0x01, 0x6e,
+    0x6e, 0x82, 0x68, 0x81, 0x60, 0x19, 0x66, 0x60, 0x56, 0x66, 0x55, 0x2f,
+    0x17, 0x06, 0x01, 0x01, 0x06, 0x10, 0x21, 0x21, 0x1d, 0x10, 0x06, 0x10,
+    0x2f, 0x80, 0xb8, 0xc5, 0xb8, 0xae, 0xa6, 0xa7, 0x80, 0x93, 0x00, 0x95,
+    0x80, 0x91, 0x05, 0x87, 0x80, 0x80, 0x87, 0x87, 0x83, 0x80, 0x82, 0x04,
+    0x80, 0x7e, 0x7e, 0x82, 0x7e, 0x81, 0x82, 0x81, 0x7e, 0x80, 0x82, 0x06,
+    0x7e, 0x77, 0x82, 0x7e, 0x7e, 0x82, 0x77, 0x81, 0x7a, 0x01, 0x77, 0x7e,
+    0x85, 0x77, 0x00, 0x7a, 0x80, 0x77, 0x06, 0x73, 0x73, 0x77, 0x77, 0x7a,
+    0x73, 0x73, 0x80, 0x7a, 0x05, 0x73, 0x73, 0x7a, 0x73, 0x7a, 0x7a, 0x81,
+    0x6e, 0x01, 0x7a, 0x7a, 0x81, 0x6e, 0x0c, 0x7a, 0x6e, 0x6e, 0x71, 0x71,
+    0x6e, 0x6e, 0x7f, 0xa9, 0xdd, 0xda, 0xcf, 0xb3, 0x80, 0xa8, 0x01, 0x99,
+    0x79, 0x81, 0x8e, 0x06, 0x9d, 0xb6, 0xcf, 0xcf, 0xb6, 0xa8, 0xa8, 0x80,
+    0xb6, 0x03, 0xad, 0xad, 0xc6, 0xbe, 0x82, 0xad, 0x23, 0x9d, 0xad, 0xde,
+    0xbe, 0x8d, 0x65, 0x45, 0x45, 0x57, 0x36, 0x36, 0x65, 0xbe, 0xb6, 0x79,
+    0x6f, 0x4b, 0x8d, 0x57, 0x79, 0xa2, 0x84, 0x9a, 0xb5, 0x7c, 0x5a, 0x6a,
+    0xa8, 0xbe, 0xb0, 0x57, 0x6f, 0x8e, 0x8d, 0x90, 0x90, 0x80, 0x65, 0x16,
+    0x57, 0x65, 0x8d, 0xa3, 0xa3, 0xe8, 0xc7, 0x65, 0x78, 0x78, 0x90, 0x8d,
+    0x90, 0xa3, 0xb0, 0xbe, 0xbe, 0xc6, 0xc6, 0xad, 0xad, 0xc6, 0xc6, 0x81,
+    0xd6, 0x80, 0xe5, 0x03, 0xe3, 0xe5, 0xd6, 0xc6, 0x82, 0xd6, 0x10, 0xe5,
+    0xea, 0xf4, 0xe9, 0xca, 0xca, 0xde, 0xe8, 0xe9, 0xe9, 0xdb, 0xc3, 0xc2,
+    0xc2, 0xb8, 0xb8, 0xbd, 0x80, 0xb4, 0x01, 0xae, 0x9e, 0x81, 0xa7, 0x07,
+    0x9f, 0x9b, 0x9b, 0x93, 0x8a, 0x8a, 0x95, 0x91, 0x81, 0x8a, 0x00, 0x83,
+    0x81, 0x70, 0x8b, 0x75, 0x80, 0x6e, 0x03, 0x75, 0x75, 0x6e, 0x6e, 0x80,
+    0x75, 0x04, 0x6e, 0x75, 0x6e, 0x75, 0x73, 0x82, 0x75, 0x01, 0x6e, 0x75,
+    0x80, 0x6e, 0x00, 0x75, 0x80, 0x68, 0x00, 0x6b, 0x81, 0x60, 0x20, 0x66,
+    0x66, 0x56, 0x66, 0x5f, 0x49, 0x27, 0x07, 0x06, 0x01, 0x01, 0x06, 0x10,
+    0x21, 0x1f, 0x17, 0x0f, 0x0f, 0x15, 0x50, 0xa4, 0xb8, 0xb8, 0xae, 0xa6,
+    0x9e, 0x9f, 0x9b, 0x93, 0x95, 0x8c, 0x91, 0x91, 0x80, 0x87, 0x04, 0x83,
+    0x83, 0x82, 0x7e, 0x7e, 0x80, 0x82, 0x80, 0x7e, 0x80, 0x82, 0x83, 0x7e,
+    0x81, 0x82, 0x01, 0x77, 0x77, 0x83, 0x7a, 0x00, 0x77, 0x81, 0x7a, 0x07,
+    0x77, 0x73, 0x77, 0x77, 0x7a, 0x77, 0x73, 0x7a, 0x80, 0x77, 0x03, 0x73,
+    0x73, 0x77, 0x77, 0x81, 0x6e, 0x00, 0x7a, 0x82, 0x6e, 0x02, 0x7a, 0x73,
+    0x7a, 0x80, 0x6e, 0x03, 0x7a, 0x6e, 0x73, 0x71, 0x83, 0x6e, 0x0b, 0x71,
+    0x6e, 0x86, 0xc3, 0xd1, 0xda, 0xde, 0xb3, 0x99, 0x9a, 0x7c, 0x7c, 0x80,
+    0x5c, 0x04, 0x79, 0x8e, 0x9d, 0xb6, 0xca, 0x80, 0xdb, 0x08, 0xca, 0xb6,
+    0xb3, 0xa2, 0x8e, 0x9d, 0xad, 0xbe, 0xc6, 0x83, 0xad, 0x31, 0xe6, 0xf2,
+    0xf1, 0x8e, 0x57, 0x45, 0x90, 0xe6, 0x6f, 0x45, 0x65, 0x78, 0x65, 0x45,
+    0x79, 0x6f, 0x79, 0x3f, 0xa2, 0xa2, 0x53, 0x7c, 0x7c, 0xb5, 0xc7, 0xee,
+    0xc7, 0xb6, 0x90, 0x78, 0xe8, 0xbe, 0xbe, 0xfe, 0xf2, 0xb0, 0x78, 0x57,
+    0x45, 0x36, 0x65, 0x78, 0x90, 0xdc, 0xe4, 0x78, 0x65, 0x78, 0x90, 0xb0,
+    0x80, 0xa3, 0x05, 0xad, 0xbe, 0xb0, 0xad, 0xad, 0xbb, 0x80, 0xc6, 0x80,
+    0xd6, 0x07, 0xe0, 0xe5, 0xe0, 0xd6, 0xc6, 0xbe, 0xd2, 0xd2, 0x80, 0xd6,
+    0x00, 0xe9, 0x80, 0xf1, 0x0a, 0xed, 0xcf, 0xcf, 0xdb, 0xe9, 0xe9, 0xde,
+    0xc3, 0xbd, 0xb8, 0xb8, 0x80, 0xb4, 0x00, 0xaf, 0x81, 0xa7, 0x03, 0x9f,
+    0x9f, 0x9b, 0x9b, 0x80, 0x95, 0x00, 0x91, 0x80, 0x8a, 0x09, 0x87, 0x83,
+    0x83, 0x85, 0x83, 0x83, 0x6b, 0x70, 0x70, 0x68, 0x80, 0x70, 0x81, 0x68,
+    0x88, 0x75, 0x01, 0x6e, 0x6e, 0x83, 0x75, 0x00, 0x6e, 0x85, 0x75, 0x81,
+    0x68, 0x03, 0x70, 0x70, 0x68, 0x68, 0x82, 0x60, 0x80, 0x5f, 0x1e, 0x59,
+    0x5d, 0x41, 0x1d, 0x06, 0x06, 0x01, 0x01, 0x0f, 0x15, 0x21, 0x1d, 0x07,
+    0x06, 0x07, 0x2c, 0x7a, 0xae, 0xb8, 0xae, 0xac, 0xa7, 0x9f, 0x9b, 0x93,
+    0x8c, 0x91, 0x8c, 0x80, 0x87, 0x83, 0x80, 0x87, 0x03, 0x82, 0x82, 0x7e,
+    0x7e, 0x80, 0x82, 0x05, 0x7e, 0x82, 0x82, 0x7e, 0x7e, 0x82, 0x84, 0x7e,
+    0x81, 0x82, 0x01, 0x77, 0x82, 0x82, 0x77, 0x00, 0x73, 0x80, 0x7a, 0x00,
+    0x73, 0x80, 0x77, 0x05, 0x7a, 0x7a, 0x77, 0x7a, 0x7a, 0x73, 0x81, 0x7a,
+    0x07, 0x73, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7e, 0x7e, 0x80, 0x6e, 0x03,
+    0x7a, 0x7a, 0x73, 0x7a, 0x80, 0x6e, 0x00, 0x71, 0x82, 0x6e, 0x00, 0x7a,
+    0x80, 0x6e, 0x16, 0x71, 0x6e, 0xa9, 0xda, 0xee, 0xed, 0xca, 0xc0, 0xb3,
+    0x99, 0x9a, 0x9a, 0x7c, 0x6a, 0x4b, 0x4b, 0x5c, 0x99, 0xa8, 0xb6, 0xb6,
+    0xbb, 0xc6, 0x82, 0xca, 0x00, 0xb6, 0x83, 0xad, 0x41, 0x9d, 0x9d, 0xc6,
+    0xc6, 0xdc, 0xc6, 0x65, 0x45, 0x65, 0x90, 0xbe, 0x79, 0x36, 0x45, 0x45,
+    0x36, 0x53, 0x36, 0x9d, 0x9d, 0x6f, 0xbe, 0xa2, 0xc0, 0xda, 0xda, 0xee,
+    0xe8, 0xed, 0xfb, 0xfa, 0xe0, 0x8d, 0xc7, 0xc7, 0x9d, 0xdc, 0xe6, 0xc6,
+    0xb0, 0x78, 0x36, 0x28, 0x36, 0x65, 0x90, 0xdc, 0xdc, 0x8d, 0x57, 0x78,
+    0xa3, 0xc6, 0xbe, 0xbe, 0xa3, 0xb0, 0xb0, 0xad, 0xa3, 0xad, 0xad, 0xbe,
+    0xc6, 0xc6, 0xd6, 0x81, 0xc6, 0x80, 0xbb, 0x15, 0xca, 0xd2, 0xd2, 0xdf,
+    0xdf, 0xe9, 0xf1, 0xf9, 0xf1, 0xf1, 0xe6, 0xe4, 0xe9, 0xe4, 0xe9, 0xda,
+    0xb9, 0xaf, 0xb4, 0xb4, 0xaf, 0xaf, 0x81, 0xa7, 0x04, 0x9f, 0x9f, 0x9b,
+    0x9b, 0x93, 0x80, 0x95, 0x81, 0x8a, 0x82, 0x83, 0x02, 0x7e, 0x7d, 0x7e,
+    0x80, 0x6b, 0x05, 0x70, 0x70, 0x74, 0x74, 0x68, 0x68, 0x85, 0x70, 0x01,
+    0x68, 0x68, 0x80, 0x70, 0x81, 0x75, 0x00, 0x68, 0x88, 0x75, 0x82, 0x70,
+    0x2b, 0x6b, 0x6b, 0x68, 0x6b, 0x60, 0x60, 0x66, 0x66, 0x5f, 0x5f, 0x58,
+    0x58, 0x59, 0x4d, 0x31, 0x17, 0x06, 0x01, 0x01, 0x06, 0x0f, 0x15, 0x15,
+    0x10, 0x0f, 0x02, 0x0d, 0x41, 0xa4, 0xb8, 0xae, 0xae, 0xa6, 0x93, 0x9b,
+    0x93, 0x8c, 0x91, 0x91, 0x87, 0x80, 0x87, 0x83, 0x87, 0x81, 0x82, 0x02,
+    0x7e, 0x85, 0x7e, 0x80, 0x82, 0x03, 0x77, 0x7e, 0x82, 0x7e, 0x81, 0x82,
+    0x06, 0x7e, 0x82, 0x82, 0x7e, 0x77, 0x82, 0x7a, 0x80, 0x77, 0x00, 0x7a,
+    0x80, 0x77, 0x09, 0x73, 0x7a, 0x7a, 0x73, 0x77, 0x73, 0x77, 0x77, 0x73,
+    0x77, 0x80, 0x6e, 0x00, 0x77, 0x80, 0x6e, 0x01, 0x7d, 0x7a, 0x83, 0x6e,
+    0x02, 0x77, 0x7a, 0x7a, 0x89, 0x6e, 0x04, 0x75, 0x6e, 0x6e, 0x71, 0x71,
+    0x80, 0x6e, 0x17, 0x86, 0xdd, 0xe8, 0xee, 0xee, 0xed, 0xe6, 0xe9, 0xdc,
+    0xdb, 0xcf, 0xc0, 0xb3, 0x99, 0x9a, 0x6a, 0x4b, 0x5c, 0x6f, 0x79, 0xa2,
+    0xc6, 0xc6, 0xbb, 0x82, 0xa8, 0x00, 0x9d, 0x80, 0xad, 0x3e, 0xb0, 0xa3,
+    0xbe, 0xbe, 0xad, 0xad, 0xa3, 0x65, 0x45, 0x65, 0x65, 0x8d, 0xc7, 0x5c,
+    0x36, 0x36, 0x79, 0xbe, 0x5c, 0xa8, 0xbe, 0xa2, 0xe8, 0xc7, 0xb6, 0xde,
+    0xed, 0xee, 0xe8, 0xbe, 0xc6, 0xdc, 0xc6, 0xb0, 0xe6, 0xf2, 0xbb, 0xad,
+    0xbe, 0xb0, 0xa3, 0x90, 0x57, 0x24, 0x28, 0x45, 0x90, 0xbe, 0xbe, 0x8d,
+    0x57, 0x78, 0x90, 0xa3, 0xbe, 0xbe, 0xa3, 0xad, 0xad, 0x8d, 0x90, 0x90,
+    0xa3, 0x81, 0xad, 0x05, 0x9d, 0x9d, 0xb6, 0xbb, 0xbb, 0xbe, 0x81, 0xd2,
+    0x0e, 0xdf, 0xe5, 0xf0, 0xf1, 0xf0, 0xe9, 0xdf, 0xe4, 0xe9, 0xe9, 0xe6,
+    0xbf, 0xb1, 0xaf, 0xaf, 0x82, 0xa7, 0x80, 0x93, 0x00, 0x9b, 0x81, 0x95,
+    0x80, 0x8a, 0x00, 0x87, 0x82, 0x83, 0x80, 0x7e, 0x02, 0x77, 0x7d, 0x77,
+    0x80, 0x6b, 0x00, 0x68, 0x80, 0x6b, 0x0d, 0x64, 0x70, 0x68, 0x68, 0x70,
+    0x70, 0x68, 0x70, 0x68, 0x70, 0x68, 0x70, 0x68, 0x68, 0x87, 0x70, 0x81,
+    0x75, 0x0f, 0x70, 0x68, 0x68, 0x70, 0x68, 0x70, 0x70, 0x6b, 0x6b, 0x60,
+    0x60, 0x66, 0x60, 0x60, 0x5f, 0x5f, 0x81, 0x58, 0x19, 0x5d, 0x47, 0x27,
+    0x0f, 0x01, 0x01, 0x03, 0x06, 0x0f, 0x15, 0x1d, 0x0f, 0x02, 0x06, 0x1f,
+    0x59, 0xac, 0xbd, 0xb4, 0xac, 0x9f, 0x93, 0x95, 0x95, 0x91, 0x91, 0x80,
+    0x87, 0x00, 0x83, 0x80, 0x82, 0x00, 0x7e, 0x81, 0x82, 0x03, 0x7e, 0x82,
+    0x82, 0x7e, 0x80, 0x77, 0x02, 0x7e, 0x82, 0x82, 0x80, 0x7e, 0x07, 0x77,
+    0x77, 0x7a, 0x77, 0x7a, 0x77, 0x77, 0x73, 0x81, 0x7a, 0x0f, 0x73, 0x77,
+    0x77, 0x73, 0x7d, 0x77, 0x73, 0x7a, 0x77, 0x77, 0x73, 0x7a, 0x73, 0x73,
+    0x7a, 0x7a, 0x81, 0x6e, 0x00, 0x7a, 0x82, 0x6e, 0x03, 0x7a, 0x73, 0x73,
+    0x7a, 0x83, 0x6e, 0x02, 0x71, 0x6e, 0x71, 0x82, 0x6e, 0x0a, 0x71, 0x6e,
+    0x6e, 0x68, 0x68, 0xa9, 0xf1, 0xe8, 0xee, 0xfb, 0xf9, 0x82, 0xe9, 0x13,
+    0xdc, 0xc6, 0xc6, 0xca, 0xca, 0xb3, 0x84, 0x6f, 0x5c, 0x5c, 0x84, 0xbe,
+    0xc6, 0xbe, 0xb6, 0xa8, 0xb6, 0xa8, 0x9d, 0x9d, 0x80, 0x8e, 0x1d, 0x8d,
+    0xbe, 0xad, 0xa3, 0x90, 0x65, 0x57, 0x45, 0x57, 0x57, 0xa3, 0xe6, 0x6f,
+    0x36, 0x79, 0xc7, 0xad, 0xb6, 0xe8, 0xad, 0xdb, 0xe6, 0xe6, 0xbe, 0x90,
+    0xe6, 0xf2, 0xf2, 0xad, 0x8d, 0x80, 0xa3, 0x13, 0xc6, 0xdc, 0xdc, 0x9d,
+    0x78, 0x90, 0x90, 0x78, 0x65, 0x28, 0x28, 0x36, 0xa3, 0xad, 0xad, 0x90,
+    0x65, 0x78, 0x78, 0x90, 0x80, 0xa3, 0x02, 0xc6, 0xed, 0x9d, 0x81, 0x79,
+    0x09, 0x8e, 0x9d, 0xad, 0xc6, 0xc6, 0xe0, 0xe4, 0xf0, 0xf0, 0xf1, 0x80,
+    0xf0, 0x02, 0xe4, 0xe4, 0xf0, 0x81, 0xe9, 0x07, 0xdb, 0xca, 0xc8, 0xc1,
+    0xb1, 0xa7, 0xac, 0xa7, 0x80, 0x9f, 0x80, 0x9b, 0x07, 0x93, 0x8c, 0x8c,
+    0x91, 0x8a, 0x91, 0x8a, 0x8a, 0x84, 0x83, 0x01, 0x7e, 0x77, 0x81, 0x6e,
+    0x01, 0x7d, 0x66, 0x84, 0x6b, 0x06, 0x64, 0x6b, 0x68, 0x68, 0x70, 0x68,
+    0x68, 0x80, 0x70, 0x01, 0x68, 0x70, 0x80, 0x68, 0x84, 0x70, 0x13, 0x68,
+    0x75, 0x70, 0x6e, 0x75, 0x70, 0x68, 0x70, 0x70, 0x68, 0x70, 0x6b, 0x60,
+    0x6b, 0x6b, 0x60, 0x66, 0x66, 0x56, 0x56, 0x81, 0x58, 0x1c, 0x51, 0x55,
+    0x41, 0x1d, 0x06, 0x01, 0x03, 0x03, 0x06, 0x0f, 0x17, 0x10, 0x06, 0x06,
+    0x0f, 0x31, 0x82, 0xb4, 0xb4, 0xac, 0xa4, 0x9b, 0x9b, 0x95, 0x91, 0x80,
+    0x87, 0x87, 0x83, 0x80, 0x82, 0x02, 0x80, 0x7e, 0x7e, 0x80, 0x82, 0x81,
+    0x7e, 0x81, 0x77, 0x02, 0x82, 0x7a, 0x77, 0x80, 0x7e, 0x80, 0x77, 0x02,
+    0x82, 0x7a, 0x77, 0x80, 0x7a, 0x10, 0x73, 0x77, 0x7a, 0x77, 0x7a, 0x77,
+    0x77, 0x73, 0x73, 0x77, 0x7a, 0x7a, 0x73, 0x77, 0x73, 0x73, 0x7a, 0x81,
+    0x6e, 0x01, 0x7a, 0x7a, 0x80, 0x6e, 0x00, 0x7a, 0x8a, 0x6e, 0x23, 0x75,
+    0x71, 0x68, 0x6e, 0x6e, 0x71, 0x6e, 0x71, 0x70, 0x75, 0x86, 0x86, 0xd1,
+    0xf2, 0xed, 0xee, 0xda, 0xbf, 0xda, 0xe9, 0xdc, 0xe9, 0xdc, 0xdc, 0xd2,
+    0xd2, 0xca, 0xca, 0xc6, 0xc6, 0xb6, 0x99, 0x84, 0x5c, 0x5c, 0xa8, 0x81,
+    0xc6, 0x33, 0xbe, 0xbe, 0xb6, 0xad, 0x9d, 0x8e, 0x79, 0x9d, 0xb0, 0xa3,
+    0x8d, 0x65, 0x57, 0x57, 0xc7, 0xa2, 0x90, 0xc6, 0x65, 0x45, 0xc6, 0xe0,
+    0xad, 0xad, 0xdc, 0xa3, 0xbe, 0xfe, 0xee, 0xe6, 0x65, 0xb6, 0xe0, 0xe0,
+    0xc6, 0x65, 0x65, 0x78, 0x78, 0xad, 0xbb, 0xbe, 0xa3, 0x45, 0x65, 0x78,
+    0x78, 0x65, 0x36, 0x29, 0x45, 0xa3, 0x80, 0x90, 0x00, 0x65, 0x80, 0x78,
+    0x24, 0x90, 0x90, 0xa3, 0xe9, 0xfe, 0xeb, 0xa2, 0x9d, 0xad, 0xbe, 0xc6,
+    0xd6, 0xd6, 0xe0, 0xe3, 0xe3, 0xdf, 0xe4, 0xf1, 0xfa, 0xf9, 0xf8, 0xf1,
+    0xf1, 0xe9, 0xe4, 0xdf, 0xdf, 0xe9, 0xed, 0xee, 0xba, 0xa5, 0xa7, 0xa7,
+    0x9f, 0x9f, 0x80, 0x9b, 0x01, 0x95, 0x93, 0x80, 0x95, 0x80, 0x91, 0x00,
+    0x8a, 0x81, 0x83, 0x03, 0x85, 0x87, 0x83, 0x83, 0x81, 0x7e, 0x04, 0x77,
+    0x7d, 0x7d, 0x73, 0x73, 0x81, 0x66, 0x81, 0x6b, 0x01, 0x60, 0x60, 0x80,
+    0x6b, 0x02, 0x68, 0x6b, 0x6b, 0x80, 0x68, 0x00, 0x70, 0x81, 0x68, 0x0c,
+    0x70, 0x70, 0x68, 0x68, 0x70, 0x68, 0x68, 0x70, 0x70, 0x6e, 0x75, 0x70,
+    0x70, 0x81, 0x68, 0x80, 0x6b, 0x06, 0x66, 0x60, 0x66, 0x5f, 0x5f, 0x4f,
+    0x58, 0x80, 0x51, 0x1b, 0x55, 0x49, 0x31, 0x10, 0x06, 0x01, 0x01, 0x03,
+    0x02, 0x07, 0x10, 0x0f, 0x06, 0x02, 0x10, 0x47, 0xa4, 0xb4, 0xb4, 0xac,
+    0x9f, 0x9c, 0x95, 0x91, 0x80, 0x87, 0x7e, 0x7e, 0x81, 0x82, 0x80, 0x7e,
+    0x00, 0x80, 0x80, 0x7a, 0x0f, 0x77, 0x82, 0x77, 0x7a, 0x77, 0x77, 0x7a,
+    0x77, 0x7a, 0x7a, 0x77, 0x7e, 0x82, 0x77, 0x7a, 0x77, 0x80, 0x7a, 0x02,
+    0x77, 0x77, 0x73, 0x82, 0x7a, 0x04, 0x77, 0x73, 0x7a, 0x73, 0x73, 0x80,
+    0x7a, 0x80, 0x6e, 0x0b, 0x7a, 0x7a, 0x73, 0x73, 0x7a, 0x73, 0x73, 0x7a,
+    0x7a, 0x73, 0x7a, 0x7a, 0x84, 0x6e, 0x00, 0x75, 0x82, 0x6e, 0x00, 0x75,
+    0x80, 0x68, 0x0e, 0x6e, 0x71, 0x71, 0x70, 0xa9, 0xee, 0xee, 0xf1, 0xf1,
+    0xe9, 0xbf, 0x7f, 0xb2, 0xe8, 0xdc, 0x80, 0xe9, 0x04, 0xdc, 0xdc, 0xd2,
+    0xd2, 0xbe, 0x80, 0xbb, 0x3b, 0xd2, 0xdc, 0xbe, 0xc0, 0x99, 0x84, 0x8e,
+    0xa8, 0xb6, 0xbb, 0xbb, 0xad, 0xad, 0x9d, 0x8e, 0x8e, 0x65, 0x90, 0x90,
+    0x78, 0x65, 0x65, 0xbe, 0xe6, 0xbe, 0x90, 0xe0, 0x8e, 0x65, 0xad, 0x90,
+    0x9d, 0xc7, 0x90, 0x65, 0x8d, 0xf0, 0xf0, 0xe6, 0xa3, 0x79, 0xc6, 0xbe,
+    0xbe, 0xa3, 0x45, 0x65, 0x65, 0x90, 0xad, 0xad, 0xb0, 0x57, 0x36, 0x65,
+    0x78, 0x65, 0x36, 0x24, 0x45, 0x80, 0x90, 0x0f, 0x8d, 0x65, 0x78, 0x78,
+    0x8d, 0xad, 0xbe, 0xbb, 0xc6, 0xdb, 0xeb, 0xbe, 0xad, 0xbe, 0xc6, 0xc6,
+    0x80, 0xd6, 0x16, 0xc6, 0xc6, 0xd6, 0xe4, 0xf0, 0xf8, 0xf1, 0xf1, 0xe4,
+    0xe4, 0xdf, 0xdf, 0xd2, 0xdf, 0xe9, 0xf2, 0xed, 0xd9, 0xa4, 0x9b, 0x9b,
+    0x93, 0x93, 0x81, 0x95, 0x00, 0x8c, 0x80, 0x91, 0x00, 0x8a, 0x81, 0x87,
+    0x00, 0x83, 0x86, 0x7e, 0x80, 0x77, 0x03, 0x73, 0x73, 0x75, 0x56, 0x83,
+    0x66, 0x80, 0x6b, 0x80, 0x60, 0x80, 0x6b, 0x03, 0x60, 0x64, 0x60, 0x60,
+    0x81, 0x68, 0x01, 0x6b, 0x70, 0x80, 0x6b, 0x82, 0x68, 0x07, 0x70, 0x68,
+    0x68, 0x60, 0x68, 0x60, 0x6b, 0x60, 0x80, 0x66, 0x0c, 0x56, 0x5f, 0x5f,
+    0x58, 0x4f, 0x51, 0x51, 0x4e, 0x4e, 0x49, 0x41, 0x27, 0x05, 0x81, 0x01,
+    0x14, 0x02, 0x07, 0x0f, 0x06, 0x06, 0x02, 0x15, 0x59, 0xac, 0xae, 0xac,
+    0xa4, 0x9b, 0x95, 0x91, 0x87, 0x87, 0x82, 0x82, 0x85, 0x7a, 0x80, 0x82,
+    0x0f, 0x7e, 0x80, 0x82, 0x77, 0x7a, 0x7a, 0x77, 0x7a, 0x7a, 0x77, 0x7a,
+    0x77, 0x77, 0x7a, 0x77, 0x7a, 0x80, 0x77, 0x80, 0x7a, 0x09, 0x77, 0x7d,
+    0x7a, 0x7a, 0x73, 0x7a, 0x7a, 0x73, 0x73, 0x7d, 0x80, 0x7a, 0x01, 0x73,
+    0x77, 0x81, 0x7a, 0x01, 0x73, 0x7a, 0x80, 0x6e, 0x05, 0x7a, 0x7a, 0x73,
+    0x7a, 0x7a, 0x71, 0x8f, 0x6e, 0x01, 0x68, 0x6e, 0x80, 0x68, 0x0d, 0x71,
+    0x68, 0x70, 0xa9, 0xe6, 0xf1, 0xf1, 0xe9, 0xdb, 0x8f, 0x88, 0xee, 0xdc,
+    0xdc, 0x80, 0xe9, 0x09, 0xe6, 0xe6, 0xf2, 0xf2, 0xf1, 0xf1, 0xd6, 0xbb,
+    0xbb, 0xc6, 0x80, 0xdc, 0x09, 0xd2, 0xca, 0xa8, 0x8e, 0x84, 0x6f, 0x5c,
+    0x53, 0x4b, 0x4b, 0x80, 0x53, 0x04, 0x8d, 0x78, 0x65, 0xa3, 0xad, 0x80,
+    0xbe, 0x0f, 0xe6, 0xdb, 0x8e, 0xe6, 0x9d, 0x8d, 0xe6, 0xc7, 0x79, 0x57,
+    0xbe, 0xd6, 0xd0, 0xb0, 0x8d, 0xa3, 0x80, 0xbe, 0x0e, 0x65, 0x36, 0x57,
+    0x78, 0xad, 0xc7, 0xbe, 0xad, 0x36, 0x36, 0x57, 0x57, 0x36, 0x1c, 0x57,
+    0x80, 0x90, 0x0c, 0xbb, 0x78, 0x65, 0x78, 0xad, 0xe6, 0xf2, 0xfa, 0xf2,
+    0xdb, 0xed, 0xbb, 0xad, 0x80, 0xbb, 0x05, 0xbe, 0xbe, 0xc6, 0xd6, 0xe3,
+    0xea, 0x80, 0xf0, 0x01, 0xe4, 0xe4, 0x80, 0xd6, 0x08, 0xd2, 0xdc, 0xe9,
+    0xfa, 0xed, 0xd9, 0xc4, 0xb2, 0xa4, 0x81, 0x91, 0x04, 0x8a, 0x87, 0x87,
+    0x8c, 0x80, 0x81, 0x83, 0x08, 0x82, 0x7e, 0x85, 0x85, 0x7e, 0x77, 0x7e,
+    0x7e, 0x7d, 0x81, 0x77, 0x82, 0x6e, 0x00, 0x75, 0x80, 0x5f, 0x01, 0x66,
+    0x64, 0x80, 0x66, 0x03, 0x64, 0x66, 0x66, 0x60, 0x82, 0x6b, 0x03, 0x60,
+    0x60, 0x64, 0x68, 0x80, 0x6b, 0x03, 0x68, 0x6b, 0x6b, 0x70, 0x84, 0x6b,
+    0x80, 0x68, 0x82, 0x60, 0x22, 0x66, 0x66, 0x56, 0x56, 0x58, 0x58, 0x51,
+    0x4e, 0x4e, 0x49, 0x49, 0x47, 0x37, 0x1d, 0x06, 0x01, 0x00, 0x01, 0x01,
+    0x06, 0x0f, 0x0f, 0x06, 0x02, 0x02, 0x27, 0x7a, 0xb4, 0xb4, 0xac, 0xa4,
+    0x95, 0x91, 0x87, 0x87, 0x83, 0x82, 0x05, 0x7a, 0x7a, 0x82, 0x82, 0x7a,
+    0x77, 0x81, 0x7a, 0x03, 0x77, 0x77, 0x7a, 0x73, 0x81, 0x7a, 0x17, 0x77,
+    0x77, 0x73, 0x7a, 0x7a, 0x73, 0x7a, 0x73, 0x7a, 0x73, 0x73, 0x7a, 0x73,
+    0x73, 0x7d, 0x73, 0x7a, 0x73, 0x7a, 0x7d, 0x7d, 0x73, 0x73, 0x7a, 0x82,
+    0x6e, 0x80, 0x7a, 0x01, 0x73, 0x7a, 0x80, 0x6e, 0x01, 0x7a, 0x7a, 0x8a,
+    0x6e, 0x80, 0x68, 0x0e, 0x6e, 0x71, 0x68, 0x68, 0x71, 0x68, 0x70, 0x8f,
+    0xde, 0xf1, 0xe9, 0xd9, 0xd1, 0x7b, 0xc3, 0x80, 0xe9, 0x80, 0xf1, 0x06,
+    0xee, 0xf9, 0xfb, 0xfa, 0xf2, 0xf2, 0xe0, 0x80, 0xc6, 0x0a, 0xd2, 0xbe,
+    0xca, 0xca, 0xb6, 0xb6, 0xde, 0xe6, 0xe6, 0xe0, 0xc6, 0x80, 0xbe, 0x44,
+    0xb6, 0x9d, 0x8e, 0x65, 0x9d, 0xe6, 0xed, 0x8e, 0xc7, 0xe8, 0xbe, 0xb0,
+    0xa3, 0xc6, 0xbe, 0x8e, 0xbe, 0xed, 0xf1, 0x8e, 0xc7, 0xf2, 0xe8, 0xa3,
+    0x78, 0x78, 0xa3, 0xde, 0xee, 0xde, 0x57, 0x36, 0x65, 0xc7, 0xfc, 0xee,
+    0xfe, 0xa2, 0x29, 0x28, 0x36, 0x24, 0x29, 0x8d, 0x90, 0xad, 0xde, 0xed,
+    0xed, 0x9d, 0x90, 0xdc, 0xdf, 0xdf, 0xe9, 0xe6, 0xdc, 0xbe, 0x9d, 0xa8,
+    0xb6, 0xbb, 0xbe, 0xc6, 0xe0, 0xe3, 0xe5, 0xe3, 0xe4, 0x83, 0xd6, 0x14,
+    0xe4, 0xe5, 0xea, 0xe5, 0xf1, 0xed, 0xe6, 0xba, 0xdb, 0xda, 0xc3, 0xa9,
+    0x94, 0x85, 0x87, 0x94, 0x83, 0x83, 0x87, 0x87, 0x85, 0x80, 0x7e, 0x02,
+    0x77, 0x7d, 0x7d, 0x82, 0x77, 0x01, 0x7d, 0x7d, 0x83, 0x6e, 0x80, 0x75,
+    0x83, 0x5f, 0x81, 0x66, 0x80, 0x60, 0x06, 0x66, 0x66, 0x6b, 0x66, 0x66,
+    0x6b, 0x60, 0x8d, 0x6b, 0x1b, 0x68, 0x60, 0x60, 0x6b, 0x60, 0x6b, 0x66,
+    0x60, 0x6b, 0x5f, 0x58, 0x58, 0x51, 0x51, 0x4e, 0x48, 0x49, 0x41, 0x41,
+    0x2e, 0x10, 0x03, 0x01, 0x01, 0x00, 0x03, 0x06, 0x0f, 0x80, 0x06, 0x09,
+    0x05, 0x37, 0x91, 0xae, 0xa6, 0xa4, 0x95, 0x91, 0x87, 0x87, 0x80, 0x82,
+    0x01, 0x7a, 0x77, 0x82, 0x7a, 0x00, 0x82, 0x83, 0x7a, 0x08, 0x73, 0x73,
+    0x7a, 0x7a, 0x73, 0x7a, 0x7a, 0x73, 0x73, 0x81, 0x7a, 0x00, 0x73, 0x80,
+    0x7a, 0x04, 0x73, 0x7a, 0x73, 0x7a, 0x73, 0x81, 0x7a, 0x06, 0x73, 0x7d,
+    0x73, 0x73, 0x7a, 0x73, 0x7a, 0x80, 0x6e, 0x00, 0x75, 0x88, 0x6e, 0x00,
+    0x71, 0x84, 0x6e, 0x04, 0x71, 0x68, 0x75, 0x6e, 0x71, 0x84, 0x68, 0x49,
+    0x71, 0x68, 0x7b, 0xda, 0xf1, 0xdb, 0xd9, 0xb5, 0xbf, 0xda, 0xe9, 0xf1,
+    0xf2, 0xf2, 0xf1, 0xf0, 0xf1, 0xf9, 0xfe, 0xfe, 0xe6, 0xbe, 0xad, 0x9d,
+    0xad, 0xa3, 0x9d, 0xa8, 0xa8, 0xb6, 0xc0, 0xde, 0xfb, 0xf9, 0xf0, 0xe0,
+    0xbc, 0xb0, 0xbe, 0xbe, 0xad, 0xad, 0x8d, 0x8e, 0xbe, 0xe8, 0xee, 0xb5,
+    0xf2, 0xf2, 0xe6, 0x90, 0x65, 0x78, 0xbe, 0xcf, 0xad, 0xc6, 0xc6, 0xbe,
+    0xe6, 0xe8, 0xf1, 0xdb, 0x90, 0x65, 0x90, 0xbe, 0xe9, 0xe6, 0xbe, 0x36,
+    0x45, 0xdb, 0x80, 0xe8, 0x08, 0xe6, 0x6f, 0x1c, 0x29, 0x36, 0xb6, 0xed,
+    0xc7, 0xbe, 0x80, 0xee, 0x01, 0xe0, 0xbe, 0x80, 0xc6, 0x09, 0xbe, 0xc6,
+    0xc6, 0xad, 0xad, 0xc6, 0xdc, 0xd6, 0xf0, 0xf0, 0x81, 0xd6, 0x81, 0xc6,
+    0x14, 0xd6, 0xdf, 0xe4, 0xf0, 0xe4, 0xe4, 0xe9, 0xe6, 0xf2, 0xde, 0xc8,
+    0xe9, 0xf1, 0xee, 0xd9, 0xd1, 0xa9, 0x82, 0xe1, 0xa5, 0x7d, 0x80, 0x7e,
+    0x09, 0x7d, 0x77, 0x73, 0x73, 0x7d, 0x73, 0x73, 0x77, 0x7e, 0x77, 0x81,
+    0x6e, 0x00, 0x75, 0x81, 0x6e, 0x03, 0x75, 0x6e, 0x6e, 0x58, 0x85, 0x5f,
+    0x80, 0x66, 0x00, 0x64, 0x82, 0x66, 0x02, 0x60, 0x66, 0x66, 0x85, 0x6b,
+    0x01, 0x60, 0x60, 0x81, 0x6b, 0x81, 0x60, 0x2a, 0x66, 0x66, 0x60, 0x66,
+    0x6b, 0x6b, 0x66, 0x58, 0x58, 0x46, 0x4e, 0x49, 0x49, 0x41, 0x41, 0x37,
+    0x21, 0x06, 0x01, 0x01, 0x00, 0x01, 0x01, 0x06, 0x0f, 0x06, 0x01, 0x06,
+    0x10, 0x47, 0x9c, 0xa6, 0xa4, 0xa4, 0x95, 0x87, 0x87, 0x82, 0x82, 0x89,
+    0x7a, 0x7a, 0x73, 0x82, 0x7a, 0x00, 0x77, 0x81, 0x7a, 0x08, 0x7d, 0x73,
+    0x7a, 0x73, 0x7d, 0x73, 0x73, 0x7d, 0x7a, 0x80, 0x6e, 0x01, 0x7a, 0x7a,
+    0x80, 0x6e, 0x80, 0x7a, 0x80, 0x6e, 0x02, 0x7a, 0x7a, 0x73, 0x80, 0x7a,
+    0x01, 0x75, 0x7d, 0x8a, 0x6e, 0x00, 0x71, 0x85, 0x6e, 0x00, 0x71, 0x81,
+    0x6e, 0x01, 0x68, 0x6e, 0x86, 0x68, 0x80, 0x71, 0x07, 0x68, 0xa1, 0xe9,
+    0xe6, 0xe6, 0xdb, 0xdb, 0xe6, 0x80, 0xf1, 0x19, 0xe6, 0xe6, 0xe4, 0xdf,
+    0xe9, 0xf1, 0xf2, 0xe6, 0xe0, 0xc6, 0xad, 0xad, 0xbe, 0xad, 0xb6, 0xbb,
+    0xc6, 0xdb, 0xe6, 0xe9, 0xdc, 0xbe, 0xc6, 0xbe, 0xb0, 0xb0, 0x80, 0xa3,
+    0x19, 0x90, 0x90, 0xbe, 0xdc, 0xc6, 0x8e, 0xc6, 0xdc, 0xe4, 0xad, 0x36,
+    0x65, 0xdc, 0xe9, 0xad, 0x90, 0xad, 0xad, 0xbe, 0xd2, 0xdc, 0xdc, 0xbe,
+    0x65, 0x65, 0xbe, 0x80, 0xc6, 0x14, 0x8d, 0x36, 0xc6, 0xdc, 0xbe, 0xc6,
+    0xdc, 0x9d, 0x24, 0x3f, 0x78, 0xe0, 0xee, 0xe8, 0xdc, 0xdc, 0xdb, 0xdb,
+    0xdc, 0xc6, 0xbe, 0x84, 0xad, 0x06, 0xbe, 0xc6, 0xc6, 0xe0, 0xdc, 0xbe,
+    0xbe, 0x80, 0xbb, 0x05, 0xbe, 0xd2, 0xdc, 0xdf, 0xdf, 0xe9, 0x80, 0xf1,
+    0x80, 0xe9, 0x17, 0xca, 0xdb, 0xe9, 0xe6, 0xde, 0xe9, 0xf1, 0xed, 0xc3,
+    0xee, 0xe1, 0x7a, 0x7a, 0x7d, 0x73, 0x7a, 0x73, 0x7d, 0x73, 0x75, 0x75,
+    0x73, 0x7e, 0x77, 0x82, 0x6e, 0x0a, 0x75, 0x75, 0x6e, 0x75, 0x75, 0x70,
+    0x68, 0x68, 0x58, 0x58, 0x56, 0x86, 0x5f, 0x01, 0x66, 0x66, 0x84, 0x60,
+    0x01, 0x6b, 0x66, 0x80, 0x6b, 0x82, 0x60, 0x00, 0x6b, 0x81, 0x68, 0x14,
+    0x60, 0x60, 0x6b, 0x6b, 0x60, 0x60, 0x66, 0x60, 0x60, 0x66, 0x58, 0x51,
+    0x4e, 0x49, 0x43, 0x41, 0x37, 0x33, 0x25, 0x10, 0x01, 0x81, 0x00, 0x0f,
+    0x03, 0x06, 0x06, 0x01, 0x02, 0x02, 0x15, 0x59, 0xa4, 0xa6, 0xa4, 0x95,
+    0x91, 0x87, 0x82, 0x7e, 0x87, 0x7a, 0x03, 0x7e, 0x82, 0x7a, 0x73, 0x80,
+    0x7a, 0x04, 0x73, 0x73, 0x7d, 0x73, 0x7a, 0x80, 0x6e, 0x07, 0x75, 0x73,
+    0x7a, 0x73, 0x73, 0x7d, 0x7a, 0x7a, 0x82, 0x6e, 0x02, 0x7a, 0x7a, 0x73,
+    0x80, 0x7a, 0x01, 0x73, 0x75, 0x86, 0x6e, 0x14, 0x71, 0x71, 0x6e, 0x71,
+    0x71, 0x6e, 0x6e, 0x71, 0x71, 0x6e, 0x6e, 0x71, 0x71, 0x6e, 0x68, 0x6e,
+    0x71, 0x71, 0x68, 0x68, 0x6e, 0x81, 0x68, 0x02, 0x71, 0x71, 0x68, 0x81,
+    0x71, 0x0d, 0x68, 0x7f, 0xd1, 0xf2, 0xed, 0xe8, 0xe9, 0xe9, 0xdc, 0xe4,
+    0xe4, 0xdf, 0xdf, 0xdc, 0x80, 0xc6, 0x81, 0xe4, 0x00, 0xf0, 0x80, 0xf2,
+    0x2d, 0xe6, 0xf2, 0xe6, 0xe9, 0xdb, 0xb6, 0xad, 0xa3, 0xad, 0xb0, 0xbe,
+    0xb0, 0xa3, 0xa3, 0x90, 0x8d, 0x90, 0xad, 0xad, 0x8d, 0x57, 0xa3, 0xad,
+    0xad, 0xa3, 0x36, 0x57, 0xc6, 0xbe, 0x8e, 0x79, 0xed, 0xe8, 0xbe, 0xad,
+    0xbe, 0xbe, 0xb0, 0x90, 0x57, 0x90, 0xad, 0xad, 0xb0, 0xa3, 0x8d, 0x80,
+    0xad, 0x10, 0xbb, 0xbe, 0xbe, 0x57, 0x57, 0x90, 0xc6, 0xe6, 0xbe, 0xc6,
+    0xd2, 0xca, 0xc6, 0xbe, 0xad, 0xa3, 0xa3, 0x80, 0xad, 0x01, 0x9d, 0xa3,
+    0x80, 0xad, 0x08, 0xc6, 0xc6, 0x9d, 0x90, 0x9d, 0x9d, 0xad, 0xc6, 0xc6,
+    0x80, 0xd6, 0x03, 0xe4, 0xe9, 0xf1, 0xe9, 0x80, 0xdc, 0x17, 0xd2, 0xdb,
+    0xe9, 0xd9, 0xe9, 0xd9, 0xd9, 0xda, 0xee, 0xe8, 0xee, 0xdd, 0x71, 0x73,
+    0x7a, 0x6e, 0x6e, 0x75, 0x75, 0x6e, 0x75, 0x75, 0x73, 0x7d, 0x81, 0x6e,
+    0x05, 0x68, 0x70, 0x68, 0x70, 0x70, 0x75, 0x81, 0x70, 0x05, 0x58, 0x58,
+    0x4f, 0x5f, 0x4f, 0x56, 0x84, 0x5f, 0x07, 0x56, 0x60, 0x66, 0x64, 0x60,
+    0x66, 0x60, 0x60, 0x80, 0x6b, 0x80, 0x60, 0x06, 0x6b, 0x68, 0x68, 0x6b,
+    0x68, 0x70, 0x70, 0x82, 0x68, 0x01, 0x60, 0x6b, 0x82, 0x60, 0x0a, 0x56,
+    0x51, 0x49, 0x49, 0x41, 0x37, 0x2f, 0x2b, 0x1a, 0x0f, 0x01, 0x81, 0x00,
+    0x19, 0x01, 0x06, 0x06, 0x01, 0x01, 0x06, 0x21, 0x71, 0xac, 0xa4, 0x9b,
+    0x91, 0x87, 0x82, 0x82, 0x77, 0x7a, 0x71, 0x74, 0x73, 0x73, 0x7a, 0x7a,
+    0x71, 0x73, 0x73, 0x80, 0x7a, 0x03, 0x73, 0x7a, 0x73, 0x7a, 0x81, 0x6e,
+    0x04, 0x7a, 0x73, 0x73, 0x7a, 0x7a, 0x81, 0x6e, 0x04, 0x7d, 0x7a, 0x7a,
+    0x73, 0x7a, 0x80, 0x6e, 0x01, 0x7a, 0x73, 0x80, 0x7a, 0x06, 0x73, 0x7a,
+    0x73, 0x73, 0x7a, 0x71, 0x71, 0x82, 0x6e, 0x01, 0x71, 0x71, 0x81, 0x6e,
+    0x02, 0x71, 0x6e, 0x71, 0x80, 0x6e, 0x01, 0x68, 0x6e, 0x81, 0x71, 0x02,
+    0x68, 0x68, 0x71, 0x80, 0x68, 0x04, 0x71, 0x68, 0x71, 0x68, 0x71, 0x80,
+    0x68, 0x13, 0x71, 0x71, 0x7f, 0xd1, 0xf1, 0xf1, 0xe6, 0xe6, 0xe9, 0xdc,
+    0xd2, 0xdc, 0xc6, 0xc6, 0xbe, 0xbb, 0xa8, 0xb6, 0xc6, 0xe0, 0x83, 0xe4,
+    0x07, 0xe0, 0xd6, 0xd6, 0xc6, 0xa8, 0xad, 0x90, 0x90, 0x81, 0xa3, 0x07,
+    0x90, 0x90, 0x78, 0x90, 0x90, 0x78, 0x57, 0x36, 0x81, 0x90, 0x09, 0x36,
+    0x45, 0x90, 0x90, 0x65, 0xcf, 0xdb, 0xbb, 0x8d, 0x90, 0x81, 0xa3, 0x02,
+    0x78, 0x57, 0x90, 0x83, 0xa3, 0x81, 0xad, 0x07, 0x78, 0x65, 0x78, 0xa3,
+    0xc6, 0x90, 0xad, 0xbb, 0x80, 0xad, 0x0f, 0xa3, 0x90, 0x90, 0xa3, 0xa3,
+    0x90, 0x8d, 0x90, 0x90, 0xa3, 0xad, 0xdb, 0x99, 0x79, 0x9d, 0xad, 0x80,
+    0xc6, 0x00, 0xdc, 0x81, 0xd6, 0x02, 0xe4, 0xdc, 0xdc, 0x81, 0xd2, 0x0a,
+    0xdf, 0xe9, 0xd9, 0xe9, 0xc8, 0xc8, 0xda, 0xe6, 0xf1, 0xeb, 0x8f, 0x80,
+    0x75, 0x0b, 0x71, 0x6e, 0x71, 0x6e, 0x6e, 0x75, 0x75, 0x68, 0x68, 0x6e,
+    0x68, 0x6e, 0x81, 0x68, 0x00, 0x70, 0x80, 0x68, 0x02, 0x70, 0x70, 0x68,
+    0x83, 0x58, 0x85, 0x5f, 0x80, 0x66, 0x00, 0x60, 0x82, 0x6b, 0x0b, 0x60,
+    0x6b, 0x68, 0x68, 0x71, 0x71, 0x68, 0x70, 0x70, 0x68, 0x68, 0x70, 0x83,
+    0x68, 0x0e, 0x60, 0x6b, 0x68, 0x6b, 0x6b, 0x5f, 0x55, 0x49, 0x41, 0x37,
+    0x2f, 0x2b, 0x16, 0x0d, 0x06, 0x82, 0x00, 0x80, 0x06, 0x0a, 0x01, 0x06,
+    0x06, 0x2a, 0x7a, 0xac, 0xa4, 0x95, 0x87, 0x80, 0x82, 0x80, 0x7a, 0x0f,
+    0x6e, 0x6e, 0x7a, 0x73, 0x7a, 0x71, 0x6e, 0x6e, 0x75, 0x71, 0x7a, 0x73,
+    0x7a, 0x71, 0x6e, 0x7a, 0x81, 0x6e, 0x03, 0x7a, 0x7a, 0x73, 0x7a, 0x86,
+    0x6e, 0x01, 0x7a, 0x7a, 0x80, 0x6e, 0x80, 0x7a, 0x01, 0x73, 0x75, 0x84,
+    0x6e, 0x00, 0x71, 0x80, 0x6e, 0x04, 0x71, 0x71, 0x6e, 0x6e, 0x71, 0x80,
+    0x6e, 0x01, 0x68, 0x71, 0x80, 0x68, 0x02, 0x71, 0x68, 0x70, 0x80, 0x68,
+    0x06, 0x70, 0x68, 0x68, 0x71, 0x68, 0x68, 0x71, 0x82, 0x68, 0x80, 0x71,
+    0x09, 0x6e, 0x7f, 0xd1, 0xdb, 0xdb, 0xca, 0xca, 0xc0, 0xb6, 0xdc, 0x80,
+    0xe9, 0x81, 0xdc, 0x0d, 0xe4, 0xf0, 0xea, 0xe3, 0xe3, 0xe5, 0xe4, 0xe3,
+    0xe3, 0xe0, 0xd6, 0xad, 0x90, 0x90, 0x81, 0xa3, 0x16, 0x90, 0x90, 0x78,
+    0x65, 0x65, 0x78, 0x57, 0x57, 0x45, 0x78, 0x8d, 0xc7, 0xa2, 0x57, 0x36,
+    0x65, 0x65, 0x57, 0xb6, 0xca, 0x90, 0x57, 0x65, 0x81, 0x90, 0x02, 0x8d,
+    0x65, 0x78, 0x82, 0x90, 0x0c, 0xa3, 0xa3, 0x90, 0xa3, 0xad, 0x65, 0x45,
+    0x57, 0x8d, 0xb0, 0xa3, 0xa3, 0xad, 0x80, 0xa3, 0x80, 0x90, 0x10, 0x8d,
+    0x65, 0x57, 0x65, 0x8d, 0x90, 0xa3, 0xad, 0xb6, 0xb6, 0xd6, 0xd6, 0xc6,
+    0xc6, 0xd2, 0xc6, 0xc6, 0x81, 0xd6, 0x01, 0xd2, 0xd2, 0x81, 0xca, 0x02,
+    0xd2, 0xdb, 0xdf, 0x80, 0xd9, 0x05, 0xdb, 0xe6, 0xf1, 0xe8, 0xda, 0x71,
+    0x83, 0x75, 0x05, 0x70, 0x70, 0x75, 0x68, 0x70, 0x6b, 0x81, 0x68, 0x02,
+    0x70, 0x68, 0x68, 0x81, 0x6b, 0x02, 0x70, 0x75, 0x70, 0x84, 0x58, 0x00,
+    0x56, 0x81, 0x5f, 0x00, 0x56, 0x80, 0x66, 0x00, 0x60, 0x83, 0x6b, 0x07,
+    0x68, 0x70, 0x68, 0x68, 0x75, 0x6e, 0x6e, 0x75, 0x80, 0x6e, 0x00, 0x75,
+    0x80, 0x6e, 0x03, 0x75, 0x75, 0x70, 0x70, 0x80, 0x6b, 0x1c, 0x5f, 0x55,
+    0x49, 0x41, 0x37, 0x2e, 0x1b, 0x0e, 0x08, 0x07, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x06, 0x06, 0x01, 0x03, 0x06, 0x0f, 0x2f, 0x87, 0xa4, 0x95,
+    0x91, 0x87, 0x7e, 0x80, 0x7a, 0x02, 0x6e, 0x75, 0x68, 0x80, 0x6e, 0x04,
+    0x7a, 0x71, 0x6e, 0x75, 0x71, 0x81, 0x6e, 0x01, 0x75, 0x71, 0x81, 0x6e,
+    0x80, 0x7a, 0x8c, 0x6e, 0x80, 0x7a, 0x81, 0x6e, 0x00, 0x71, 0x88, 0x6e,
+    0x07, 0x71, 0x68, 0x71, 0x68, 0x71, 0x68, 0x71, 0x6e, 0x80, 0x68, 0x00,
+    0x71, 0x8f, 0x68, 0x0a, 0x71, 0x6e, 0x6e, 0x7b, 0xbf, 0xde, 0xcf, 0xdb,
+    0xe9, 0xf0, 0xf0, 0x82, 0xe4, 0x08, 0xe6, 0xf8, 0xf4, 0xea, 0xe0, 0xe0,
+    0xd6, 0xe0, 0xe0, 0x80, 0xd6, 0x04, 0xc6, 0xbb, 0x9d, 0xa3, 0x90, 0x80,
+    0xa3, 0x0e, 0x90, 0x78, 0x65, 0x79, 0x57, 0x57, 0x65, 0x90, 0x65, 0x65,
+    0xcf, 0xe6, 0xe4, 0x57, 0x28, 0x80, 0x57, 0x04, 0x8e, 0x9d, 0x8d, 0x45,
+    0x57, 0x83, 0x78, 0x10, 0x65, 0x78, 0x90, 0x78, 0x78, 0x90, 0xa3, 0xa3,
+    0x90, 0xa3, 0xa3, 0x79, 0x28, 0x45, 0x78, 0x90, 0x90, 0x80, 0xa3, 0x11,
+    0x9d, 0x90, 0x65, 0x57, 0x57, 0x45, 0x45, 0x57, 0x65, 0x8d, 0xad, 0xbe,
+    0xc6, 0xc6, 0xd6, 0xdc, 0xe0, 0xe4, 0x84, 0xc6, 0x83, 0xbb, 0x06, 0xca,
+    0xd2, 0xdc, 0xdf, 0xd9, 0xc4, 0xca, 0x80, 0xe9, 0x01, 0xe6, 0xa1, 0x80,
+    0x75, 0x80, 0x6e, 0x80, 0x70, 0x04, 0x68, 0x6e, 0x70, 0x6b, 0x6b, 0x80,
+    0x68, 0x03, 0x6b, 0x60, 0x60, 0x68, 0x80, 0x6b, 0x03, 0x68, 0x70, 0x6b,
+    0x4f, 0x82, 0x58, 0x81, 0x5f, 0x80, 0x66, 0x01, 0x60, 0x60, 0x80, 0x6b,
+    0x03, 0x70, 0x70, 0x68, 0x75, 0x85, 0x6e, 0x80, 0x77, 0x2e, 0x7d, 0x77,
+    0x77, 0x7e, 0x77, 0x73, 0x7d, 0x75, 0x75, 0x68, 0x66, 0x5d, 0x55, 0x49,
+    0x42, 0x37, 0x2b, 0x1b, 0x0e, 0x0e, 0x0d, 0x02, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x06, 0x06, 0x01, 0x01, 0x06, 0x0f, 0x37, 0x91, 0x9b, 0x91,
+    0x87, 0x89, 0x7d, 0x73, 0x71, 0x68, 0x68, 0x70, 0x68, 0x80, 0x6e, 0x02,
+    0x7a, 0x71, 0x6e, 0x80, 0x70, 0x05, 0x68, 0x68, 0x6e, 0x75, 0x71, 0x71,
+    0x84, 0x6e, 0x01, 0x7a, 0x75, 0x81, 0x6e, 0x00, 0x7a, 0x97, 0x6e, 0x05,
+    0x71, 0x68, 0x68, 0x71, 0x68, 0x70, 0x92, 0x68, 0x0c, 0x6e, 0x71, 0x6e,
+    0x6e, 0x71, 0x70, 0x6c, 0x69, 0xa9, 0xed, 0xf1, 0xf1, 0xf0, 0x82, 0xe4,
+    0x03, 0xdf, 0xe9, 0xe9, 0xe4, 0x80, 0xd6, 0x82, 0xc6, 0x03, 0xbb, 0xbb,
+    0xb6, 0xb6, 0x80, 0xbe, 0x16, 0x9d, 0x90, 0x8d, 0x78, 0x8e, 0xc7, 0xa2,
+    0x53, 0x65, 0x65, 0x57, 0x57, 0xbe, 0xdc, 0xc6, 0x65, 0x28, 0x45, 0x79,
+    0x57, 0x79, 0x65, 0x65, 0x80, 0x57, 0x02, 0x78, 0x90, 0x78, 0x80, 0x65,
+    0x28, 0x78, 0x78, 0xa3, 0xad, 0x78, 0x90, 0x90, 0xa3, 0x90, 0xa3, 0x65,
+    0x79, 0x36, 0x45, 0x65, 0x78, 0x90, 0x90, 0xad, 0xde, 0xa2, 0x53, 0x36,
+    0x28, 0x36, 0x36, 0x57, 0x8d, 0xad, 0xbe, 0xc6, 0xbe, 0xbe, 0xc6, 0xc6,
+    0xd6, 0xe0, 0xe4, 0xc6, 0xbb, 0xbb, 0x80, 0xad, 0x02, 0xb6, 0xbb, 0xb6,
+    0x80, 0xa8, 0x80, 0xca, 0x03, 0xd2, 0xdb, 0xde, 0xe6, 0x80, 0xe9, 0x10,
+    0xcf, 0x7b, 0x75, 0x68, 0x70, 0x70, 0x68, 0x68, 0x70, 0x70, 0x68, 0x68,
+    0x6e, 0x70, 0x68, 0x60, 0x6b, 0x81, 0x60, 0x08, 0x6b, 0x68, 0x6b, 0x60,
+    0x68, 0x6b, 0x60, 0x60, 0x51, 0x80, 0x58, 0x81, 0x5f, 0x81, 0x66, 0x80,
+    0x6b, 0x80, 0x68, 0x80, 0x75, 0x80, 0x6e, 0x01, 0x77, 0x77, 0x80, 0x7e,
+    0x02, 0x85, 0x83, 0x85, 0x83, 0x83, 0x0a, 0x85, 0x85, 0x77, 0x75, 0x71,
+    0x59, 0x55, 0x49, 0x42, 0x35, 0x2b, 0x80, 0x0e, 0x0a, 0x08, 0x07, 0x01,
+    0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x06, 0x06, 0x80, 0x01, 0x08, 0x0f,
+    0x3b, 0x95, 0x95, 0x87, 0x82, 0x82, 0x7a, 0x71, 0x82, 0x68, 0x06, 0x71,
+    0x71, 0x6e, 0x71, 0x6e, 0x68, 0x71, 0x82, 0x68, 0x01, 0x70, 0x71, 0x82,
+    0x6e, 0x00, 0x7a, 0x84, 0x6e, 0x80, 0x71, 0x8f, 0x6e, 0x05, 0x68, 0x71,
+    0x6e, 0x6e, 0x68, 0x68, 0x80, 0x71, 0x87, 0x68, 0x00, 0x71, 0x80, 0x68,
+    0x03, 0x70, 0x68, 0x71, 0x71, 0x82, 0x68, 0x0e, 0x75, 0x71, 0x71, 0x64,
+    0x64, 0x50, 0x47, 0x31, 0x2d, 0x20, 0x76, 0xe8, 0xf1, 0xf1, 0xf0, 0x83,
+    0xe4, 0x01, 0xd2, 0xca, 0x81, 0xd6, 0x82, 0xc6, 0x0e, 0xbb, 0xbb, 0xb6,
+    0xbe, 0xde, 0xca, 0xc6, 0xb0, 0xa3, 0xa3, 0x90, 0xb6, 0xe6, 0xde, 0xa2,
+    0x80, 0x45, 0x1a, 0x5c, 0x9d, 0xb6, 0x9d, 0x79, 0x3f, 0xb5, 0xde, 0xc7,
+    0x79, 0x57, 0x8e, 0xde, 0xa2, 0x36, 0xc7, 0xed, 0xbe, 0x65, 0x57, 0x45,
+    0x65, 0xad, 0xf2, 0xed, 0x8d, 0x78, 0x81, 0x90, 0x11, 0x78, 0xb0, 0x36,
+    0x28, 0x36, 0x65, 0x78, 0xbe, 0xe6, 0xf2, 0xde, 0xcf, 0x6f, 0x36, 0x79,
+    0x8e, 0x9d, 0x9d, 0x80, 0xad, 0x02, 0xbb, 0xc6, 0xe9, 0x80, 0xe6, 0x07,
+    0xf0, 0xb6, 0x8e, 0x8e, 0x9d, 0x9d, 0xa8, 0xa2, 0x80, 0x8e, 0x80, 0xa8,
+    0x0d, 0xb6, 0xca, 0xdc, 0xe9, 0xf1, 0xe9, 0xe4, 0xdf, 0xb5, 0x8f, 0x75,
+    0x75, 0x6e, 0x70, 0x80, 0x68, 0x01, 0x6b, 0x6b, 0x80, 0x68, 0x00, 0x6b,
+    0x80, 0x60, 0x08, 0x6b, 0x60, 0x60, 0x6b, 0x6b, 0x60, 0x6b, 0x60, 0x60,
+    0x80, 0x6b, 0x80, 0x58, 0x80, 0x5f, 0x80, 0x66, 0x05, 0x6b, 0x6b, 0x70,
+    0x68, 0x68, 0x75, 0x80, 0x6e, 0x01, 0x7d, 0x77, 0x80, 0x7e, 0x07, 0x83,
+    0x83, 0x87, 0x8a, 0x8a, 0x8c, 0x8c, 0x8a, 0x85, 0x95, 0x08, 0x91, 0x82,
+    0x71, 0x64, 0x5d, 0x49, 0x49, 0x37, 0x25, 0x81, 0x0e, 0x01, 0x0d, 0x06,
+    0x83, 0x00, 0x02, 0x02, 0x06, 0x06, 0x80, 0x01, 0x0b, 0x10, 0x43, 0x91,
+    0x91, 0x82, 0x82, 0x73, 0x71, 0x71, 0x68, 0x68, 0x60, 0x82, 0x64, 0x03,
+    0x68, 0x71, 0x71, 0x68, 0x82, 0x71, 0x00, 0x75, 0x84, 0x6e, 0x00, 0x7a,
+    0x82, 0x6e, 0x03, 0x71, 0x6e, 0x6e, 0x71, 0x88, 0x6e, 0x00, 0x71, 0x82,
+    0x6e, 0x02, 0x68, 0x71, 0x71, 0x81, 0x68, 0x05, 0x71, 0x68, 0x68, 0x71,
+    0x68, 0x70, 0x81, 0x68, 0x00, 0x70, 0x80, 0x68, 0x00, 0x71, 0x88, 0x68,
+    0x06, 0x71, 0x71, 0x5b, 0x3a, 0x2d, 0x22, 0x18, 0x80, 0x0a, 0x03, 0x98,
+    0xf1, 0xf1, 0xf0, 0x83, 0xe4, 0x03, 0xdf, 0xdc, 0xca, 0xdc, 0x82, 0xd6,
+    0x80, 0xc6, 0x2c, 0xbe, 0xbb, 0xbb, 0xbe, 0xcf, 0xc6, 0xad, 0xb0, 0xb0,
+    0xa3, 0x90, 0x9d, 0xbe, 0xd2, 0xdb, 0x57, 0x45, 0x36, 0x36, 0x8d, 0x79,
+    0x8e, 0x45, 0x99, 0xdb, 0xca, 0xe4, 0x8e, 0x79, 0x8e, 0xdc, 0xdb, 0xb3,
+    0xed, 0xf2, 0xe9, 0x8d, 0x45, 0x36, 0x79, 0xdc, 0xf2, 0xde, 0x79, 0x65,
+    0x80, 0x90, 0x26, 0x78, 0x45, 0x65, 0x90, 0x28, 0x28, 0x45, 0x8e, 0xdc,
+    0xe9, 0xdc, 0xdb, 0xdc, 0xad, 0x57, 0x65, 0x65, 0x79, 0x8e, 0x9d, 0xbb,
+    0xdc, 0xe6, 0xf2, 0xed, 0xee, 0xfc, 0xf2, 0xa8, 0x79, 0x79, 0x6f, 0x79,
+    0x8e, 0xa8, 0xb6, 0xbb, 0xbb, 0xca, 0x81, 0xd2, 0x80, 0xd6, 0x0b, 0xdc,
+    0xca, 0x98, 0x8f, 0x7f, 0x71, 0x6e, 0x68, 0x68, 0x6e, 0x70, 0x68, 0x82,
+    0x6b, 0x08, 0x60, 0x66, 0x60, 0x60, 0x66, 0x60, 0x60, 0x66, 0x60, 0x80,
+    0x6b, 0x80, 0x60, 0x02, 0x6b, 0x6b, 0x58, 0x80, 0x5f, 0x0d, 0x66, 0x66,
+    0x6b, 0x6b, 0x70, 0x68, 0x75, 0x6e, 0x75, 0x7d, 0x73, 0x7d, 0x7e, 0x7e,
+    0x80, 0x83, 0x08, 0x8a, 0x91, 0x8a, 0x8a, 0x9b, 0x93, 0x9f, 0x9e, 0x9e,
+    0x81, 0xa7, 0x0c, 0x9e, 0xaf, 0xa7, 0xa7, 0x9b, 0x91, 0x7a, 0x64, 0x59,
+    0x50, 0x49, 0x42, 0x2b, 0x81, 0x0e, 0x02, 0x08, 0x07, 0x03, 0x82, 0x00,
+    0x0f, 0x01, 0x02, 0x06, 0x01, 0x01, 0x00, 0x02, 0x0d, 0x4d, 0x91, 0x87,
+    0x82, 0x7a, 0x6e, 0x71, 0x71, 0x81, 0x64, 0x80, 0x60, 0x0d, 0x64, 0x60,
+    0x60, 0x64, 0x6b, 0x60, 0x70, 0x68, 0x71, 0x68, 0x70, 0x71, 0x6e, 0x71,
+    0x82, 0x6e, 0x00, 0x75, 0x8b, 0x6e, 0x00, 0x75, 0x84, 0x6e, 0x82, 0x68,
+    0x00, 0x71, 0x80, 0x68, 0x00, 0x70, 0x82, 0x68, 0x05, 0x70, 0x70, 0x68,
+    0x68, 0x70, 0x70, 0x8a, 0x68, 0x0c, 0x75, 0x68, 0x6e, 0x64, 0x3a, 0x18,
+    0x12, 0x12, 0x0a, 0x0b, 0x0b, 0x19, 0xb5, 0x80, 0xf0, 0x82, 0xe4, 0x04,
+    0xe9, 0xe9, 0xdc, 0xca, 0xdc, 0x80, 0xe4, 0x80, 0xe0, 0x08, 0xe4, 0xe0,
+    0xe0, 0xd6, 0xd6, 0xc6, 0xad, 0xbe, 0xa3, 0x80, 0x90, 0x08, 0x78, 0x8d,
+    0x9d, 0xad, 0xad, 0x65, 0x45, 0x36, 0x36, 0x81, 0x65, 0x35, 0x9d, 0xbb,
+    0xb6, 0xbe, 0x79, 0x45, 0x8e, 0xd2, 0xdb, 0xdb, 0xdc, 0xe9, 0xdc, 0x90,
+    0x36, 0x28, 0x79, 0xdc, 0xdb, 0xca, 0x53, 0x36, 0x78, 0x8d, 0x65, 0x57,
+    0x36, 0x45, 0x90, 0xa3, 0x1c, 0x32, 0xb6, 0xc6, 0xc6, 0xbe, 0xca, 0xc6,
+    0x8e, 0x36, 0x53, 0x5c, 0x8e, 0xbb, 0xe0, 0xe4, 0xe4, 0xf0, 0xf1, 0xf1,
+    0xe8, 0xe9, 0xdc, 0x6f, 0x81, 0x79, 0x12, 0x8e, 0xa8, 0xa8, 0xb6, 0xbb,
+    0xca, 0xd2, 0xd2, 0xdc, 0xca, 0xb5, 0x98, 0x8b, 0x8f, 0x7f, 0x75, 0x71,
+    0x68, 0x70, 0x82, 0x68, 0x02, 0x60, 0x60, 0x6b, 0x80, 0x60, 0x03, 0x66,
+    0x60, 0x66, 0x66, 0x80, 0x60, 0x04, 0x6b, 0x66, 0x66, 0x60, 0x6b, 0x82,
+    0x60, 0x05, 0x5f, 0x5f, 0x66, 0x66, 0x6b, 0x70, 0x80, 0x75, 0x05, 0x7d,
+    0x77, 0x7e, 0x83, 0x85, 0x83, 0x80, 0x8a, 0x09, 0x95, 0x9b, 0x9b, 0x9f,
+    0xa7, 0xa7, 0xaf, 0xaa, 0xaf, 0xaa, 0x85, 0xb8, 0x0a, 0xae, 0xa7, 0x95,
+    0x82, 0x71, 0x6c, 0x5d, 0x55, 0x49, 0x41, 0x2b, 0x81, 0x0e, 0x02, 0x0d,
+    0x02, 0x03, 0x82, 0x00, 0x13, 0x03, 0x06, 0x06, 0x01, 0x03, 0x06, 0x06,
+    0x0d, 0x4d, 0x87, 0x82, 0x7a, 0x71, 0x68, 0x68, 0x64, 0x6b, 0x64, 0x64,
+    0x66, 0x84, 0x64, 0x02, 0x66, 0x6b, 0x6b, 0x82, 0x68, 0x05, 0x71, 0x68,
+    0x68, 0x6e, 0x6e, 0x75, 0x80, 0x6e, 0x85, 0x68, 0x02, 0x6e, 0x6e, 0x68,
+    0x80, 0x6e, 0x06, 0x68, 0x6e, 0x68, 0x75, 0x68, 0x71, 0x6e, 0x81, 0x68,
+    0x01, 0x71, 0x71, 0x81, 0x68, 0x00, 0x70, 0x84, 0x68, 0x00, 0x71, 0x8b,
+    0x68, 0x80, 0x6e, 0x0c, 0x68, 0x5b, 0x38, 0x23, 0x12, 0x12, 0x0a, 0x0b,
+    0x0b, 0x12, 0x9a, 0xe9, 0xe9, 0x83, 0xe4, 0x09, 0xe9, 0xe9, 0xe4, 0xdc,
+    0xd2, 0xe4, 0xe4, 0xe0, 0xdc, 0xd0, 0x80, 0xd6, 0x05, 0xdc, 0xc6, 0xc6,
+    0xad, 0xad, 0xa3, 0x80, 0x90, 0x02, 0x78, 0x78, 0x65, 0x80, 0x90, 0x00,
+    0x65, 0x80, 0x36, 0x81, 0x57, 0x2a, 0x8e, 0x9d, 0x8e, 0x90, 0x57, 0x28,
+    0x79, 0xad, 0xbe, 0xca, 0xca, 0xbe, 0xbe, 0x8d, 0x28, 0x24, 0x8d, 0xad,
+    0xb6, 0xa8, 0x32, 0x1c, 0x36, 0x45, 0x36, 0x29, 0x1c, 0x28, 0x65, 0xa3,
+    0x28, 0x5c, 0xc6, 0xad, 0xad, 0xbb, 0xbb, 0xbe, 0x99, 0x5c, 0x8e, 0xc6,
+    0xc6, 0x81, 0xd6, 0x81, 0xdc, 0x12, 0xdf, 0xdc, 0xb6, 0x84, 0x5c, 0x6f,
+    0x79, 0x79, 0x8e, 0xa8, 0xa8, 0xb6, 0xb6, 0xca, 0xca, 0xde, 0xa9, 0x6b,
+    0x6b, 0x80, 0x70, 0x04, 0x68, 0x60, 0x68, 0x68, 0x70, 0x80, 0x68, 0x02,
+    0x60, 0x60, 0x71, 0x81, 0x60, 0x03, 0x66, 0x60, 0x60, 0x6b, 0x83, 0x60,
+    0x15, 0x66, 0x6b, 0x60, 0x6b, 0x6b, 0x66, 0x6b, 0x66, 0x6b, 0x6b, 0x70,
+    0x75, 0x7d, 0x77, 0x7e, 0x83, 0x85, 0x8a, 0x8a, 0x95, 0x9b, 0x9f, 0x80,
+    0xa7, 0x08, 0xaf, 0xaa, 0xaa, 0xb8, 0xbd, 0xbd, 0xc2, 0xc9, 0xc9, 0x80,
+    0xd3, 0x10, 0xd5, 0xd5, 0xd3, 0xc9, 0xc2, 0xbd, 0xaf, 0x9b, 0x91, 0x7a,
+    0x74, 0x6c, 0x55, 0x49, 0x49, 0x35, 0x25, 0x80, 0x0e, 0x04, 0x08, 0x06,
+    0x01, 0x03, 0x01, 0x81, 0x00, 0x80, 0x06, 0x0a, 0x03, 0x01, 0x06, 0x06,
+    0x15, 0x48, 0x89, 0x7a, 0x7a, 0x71, 0x71, 0x81, 0x64, 0x04, 0x56, 0x5f,
+    0x59, 0x56, 0x64, 0x80, 0x60, 0x80, 0x66, 0x81, 0x60, 0x00, 0x70, 0x80,
+    0x68, 0x00, 0x71, 0x85, 0x68, 0x00, 0x70, 0x83, 0x68, 0x01, 0x6e, 0x71,
+    0x85, 0x68, 0x05, 0x75, 0x68, 0x71, 0x71, 0x68, 0x71, 0x82, 0x68, 0x00,
+    0x70, 0x8d, 0x68, 0x0c, 0x70, 0x70, 0x68, 0x68, 0x70, 0x70, 0x68, 0x73,
+    0x77, 0x71, 0x61, 0x38, 0x2d, 0x80, 0x23, 0x06, 0x18, 0x0b, 0x0b, 0x04,
+    0x5a, 0xca, 0xe9, 0x83, 0xe4, 0x05, 0xe9, 0xe9, 0xdf, 0xdf, 0xdc, 0xdc,
+    0x81, 0xc6, 0x16, 0xd6, 0xd6, 0xc6, 0xc6, 0xbe, 0xbb, 0xa8, 0x8e, 0x8e,
+    0x78, 0x90, 0x90, 0x8d, 0x65, 0x57, 0x79, 0x78, 0x8d, 0x78, 0x45, 0x36,
+    0x36, 0x3f, 0x80, 0x57, 0x21, 0x65, 0x8d, 0x65, 0x78, 0x57, 0x1c, 0x3f,
+    0xa3, 0xad, 0xad, 0xbb, 0xad, 0xa3, 0x90, 0x3f, 0x1c, 0x65, 0x90, 0x9d,
+    0x6f, 0x1c, 0x1c, 0x11, 0x1c, 0x11, 0x11, 0x1c, 0x24, 0x3f, 0x36, 0x45,
+    0xa3, 0xad, 0xa3, 0x80, 0xad, 0x04, 0xa3, 0x90, 0xa3, 0xa3, 0xbe, 0x82,
+    0xc6, 0x18, 0xd2, 0xc6, 0xd2, 0xd2, 0xdf, 0xe9, 0xf8, 0xf2, 0xa2, 0x5c,
+    0x79, 0x79, 0x8e, 0xa8, 0xa8, 0xb6, 0xb6, 0xca, 0xca, 0xe8, 0xe1, 0x7f,
+    0x68, 0x70, 0x70, 0x82, 0x6b, 0x00, 0x66, 0x80, 0x60, 0x02, 0x66, 0x6b,
+    0x73, 0x82, 0x60, 0x09, 0x70, 0x6b, 0x6b, 0x60, 0x66, 0x60, 0x66, 0x60,
+    0x66, 0x66, 0x80, 0x60, 0x0e, 0x66, 0x60, 0x66, 0x6b, 0x75, 0x7d, 0x77,
+    0x7e, 0x83, 0x8a, 0x8a, 0x95, 0x9b, 0xa7, 0xa7, 0x80, 0xaf, 0x02, 0xbd,
+    0xb8, 0xc2, 0x80, 0xc9, 0x80, 0xd3, 0x80, 0xe2, 0x82, 0xe7, 0x14, 0xe2,
+    0xc9, 0xb8, 0xb4, 0xa4, 0x95, 0x82, 0x71, 0x64, 0x63, 0x55, 0x49, 0x42,
+    0x2b, 0x16, 0x0e, 0x0e, 0x08, 0x07, 0x02, 0x03, 0x82, 0x00, 0x00, 0x03,
+    0x80, 0x06, 0x15, 0x03, 0x01, 0x06, 0x02, 0x17, 0x49, 0x7a, 0x7a, 0x71,
+    0x64, 0x64, 0x60, 0x64, 0x5f, 0x5f, 0x56, 0x5f, 0x59, 0x56, 0x56, 0x5f,
+    0x59, 0x82, 0x66, 0x08, 0x60, 0x6b, 0x60, 0x60, 0x68, 0x60, 0x60, 0x6c,
+    0x60, 0x80, 0x68, 0x04, 0x71, 0x68, 0x68, 0x71, 0x71, 0x86, 0x68, 0x06,
+    0x71, 0x68, 0x68, 0x70, 0x68, 0x70, 0x70, 0x84, 0x68, 0x01, 0x71, 0x71,
+    0x81, 0x68, 0x00, 0x70, 0x81, 0x68, 0x00, 0x6b, 0x87, 0x68, 0x17, 0x70,
+    0x68, 0x6e, 0x75, 0x6e, 0x6e, 0x7a, 0x7a, 0x67, 0x38, 0x38, 0x4a, 0x61,
+    0x61, 0x38, 0x22, 0x0b, 0x0b, 0x04, 0x19, 0x7c, 0xca, 0xdf, 0xdf, 0x80,
+    0xe4, 0x01, 0xdf, 0xdf, 0x81, 0xdc, 0x02, 0xd2, 0xbe, 0xbb, 0x80, 0xbe,
+    0x0c, 0xc6, 0xc6, 0xbb, 0xbb, 0xb6, 0x8e, 0x5c, 0x4b, 0x5c, 0x6f, 0x79,
+    0x79, 0x57, 0x80, 0x5c, 0x09, 0x57, 0x57, 0x45, 0x36, 0x3f, 0x29, 0x28,
+    0x5c, 0x45, 0x5c, 0x81, 0x65, 0x0f, 0x28, 0x3f, 0xa8, 0x9d, 0x9d, 0xa3,
+    0x90, 0x8d, 0x78, 0x79, 0x3f, 0x78, 0x8d, 0x8d, 0x65, 0x29, 0x81, 0x1c,
+    0x12, 0x11, 0x1c, 0x28, 0x28, 0x3f, 0x78, 0xb0, 0xa3, 0xa3, 0xad, 0xa3,
+    0x8e, 0x8d, 0x8d, 0x90, 0xad, 0xad, 0xbe, 0xbe, 0x83, 0xc6, 0x1f, 0xd2,
+    0xe9, 0xf1, 0xf2, 0xed, 0xc7, 0x6f, 0x6f, 0x79, 0xa8, 0xb6, 0xa8, 0xb6,
+    0xb6, 0xca, 0xca, 0xe9, 0xed, 0xa1, 0x6b, 0x66, 0x71, 0x88, 0x97, 0xa9,
+    0x97, 0x97, 0x71, 0x66, 0x6b, 0x66, 0x66, 0x80, 0x60, 0x02, 0x66, 0x66,
+    0x60, 0x82, 0x6b, 0x81, 0x66, 0x00, 0x60, 0x80, 0x66, 0x00, 0x60, 0x80,
+    0x66, 0x0d, 0x6b, 0x73, 0x7e, 0x8a, 0x95, 0x9b, 0xa7, 0xa7, 0xaf, 0xbd,
+    0xbd, 0xc2, 0xc2, 0xc9, 0x80, 0xd3, 0x01, 0xe2, 0xe2, 0x89, 0xe7, 0x0e,
+    0xe2, 0xc9, 0xbd, 0xac, 0x9b, 0x91, 0x87, 0x7a, 0x6c, 0x63, 0x5d, 0x55,
+    0x41, 0x33, 0x25, 0x80, 0x0e, 0x03, 0x0d, 0x06, 0x01, 0x01, 0x82, 0x00,
+    0x00, 0x01, 0x80, 0x06, 0x17, 0x01, 0x01, 0x06, 0x06, 0x10, 0x47, 0x71,
+    0x64, 0x6c, 0x64, 0x64, 0x63, 0x5f, 0x5f, 0x58, 0x58, 0x5d, 0x5d, 0x58,
+    0x58, 0x56, 0x5f, 0x56, 0x5f, 0x80, 0x66, 0x82, 0x60, 0x01, 0x6b, 0x60,
+    0x82, 0x6b, 0x00, 0x64, 0x86, 0x68, 0x00, 0x71, 0x80, 0x68, 0x03, 0x71,
+    0x68, 0x68, 0x71, 0x8a, 0x68, 0x00, 0x71, 0x85, 0x68, 0x00, 0x70, 0x84,
+    0x68, 0x1a, 0x70, 0x70, 0x68, 0x6e, 0x6e, 0x75, 0x6e, 0x73, 0x77, 0x7a,
+    0x67, 0x61, 0x67, 0x71, 0x5b, 0x3a, 0x22, 0x0c, 0x0b, 0x04, 0x04, 0x00,
+    0x11, 0x6a, 0xdb, 0xdf, 0xdf, 0x80, 0xe4, 0x80, 0xd6, 0x03, 0xdb, 0xdf,
+    0xdc, 0xca, 0x80, 0xbb, 0x09, 0xbe, 0xca, 0xca, 0xbb, 0xb6, 0x79, 0x6f,
+    0x84, 0x8e, 0x8e, 0x80, 0x79, 0x0a, 0x6f, 0x79, 0x57, 0x5c, 0x5c, 0x45,
+    0x45, 0x36, 0x28, 0x29, 0x24, 0x80, 0x29, 0x0a, 0x57, 0x65, 0x65, 0x57,
+    0x99, 0xde, 0xde, 0xc0, 0x9d, 0x90, 0x90, 0x80, 0x78, 0x1a, 0x5c, 0x78,
+    0x8d, 0x8d, 0x90, 0x45, 0x29, 0x28, 0x29, 0x29, 0x32, 0x53, 0x99, 0x57,
+    0xa2, 0xbe, 0xa3, 0x90, 0xa3, 0x78, 0x4b, 0x32, 0x3f, 0x5c, 0x79, 0x90,
+    0xad, 0x82, 0xbe, 0x24, 0xc6, 0xc6, 0xd2, 0xd2, 0xdc, 0xb3, 0x9a, 0xb3,
+    0xb6, 0xb6, 0xd2, 0xdf, 0xdf, 0xe4, 0xe4, 0xdb, 0xca, 0xdb, 0xe9, 0xe9,
+    0xdc, 0xb5, 0xbf, 0xd1, 0xda, 0xda, 0xed, 0xed, 0xee, 0xee, 0xeb, 0x97,
+    0x5f, 0x66, 0x56, 0x66, 0x66, 0x81, 0x60, 0x80, 0x66, 0x06, 0x60, 0x66,
+    0x60, 0x60, 0x6b, 0x66, 0x56, 0x80, 0x66, 0x00, 0x6b, 0x80, 0x66, 0x08,
+    0x77, 0x8a, 0x9b, 0x9b, 0x9e, 0xaa, 0xb8, 0xc2, 0xc9, 0x80, 0xd3, 0x80,
+    0xe2, 0x8c, 0xe7, 0x15, 0xe2, 0xd3, 0xbd, 0xa7, 0x95, 0x87, 0x81, 0x7a,
+    0x74, 0x63, 0x55, 0x49, 0x47, 0x41, 0x2e, 0x1a, 0x08, 0x0e, 0x08, 0x0f,
+    0x02, 0x03, 0x82, 0x00, 0x01, 0x01, 0x01, 0x80, 0x06, 0x0c, 0x00, 0x00,
+    0x02, 0x02, 0x10, 0x37, 0x59, 0x59, 0x6c, 0x64, 0x63, 0x59, 0x59, 0x80,
+    0x5d, 0x06, 0x58, 0x5d, 0x5d, 0x58, 0x4f, 0x58, 0x59, 0x80, 0x56, 0x81,
+    0x60, 0x05, 0x66, 0x60, 0x66, 0x60, 0x64, 0x6b, 0x85, 0x60, 0x85, 0x68,
+    0x02, 0x71, 0x71, 0x70, 0x82, 0x68, 0x00, 0x71, 0x81, 0x68, 0x06, 0x71,
+    0x68, 0x68, 0x70, 0x68, 0x68, 0x71, 0x81, 0x68, 0x01, 0x71, 0x71, 0x83,
+    0x68, 0x00, 0x70, 0x81, 0x68, 0x06, 0x6e, 0x75, 0x71, 0x73, 0x73, 0x77,
+    0x82, 0x80, 0x7a, 0x05, 0x5b, 0x38, 0x22, 0x0c, 0x0b, 0x0b, 0x80, 0x04,
+    0x05, 0x00, 0x00, 0x6a, 0xca, 0xdc, 0xdf, 0x80, 0xe4, 0x01, 0xdf, 0xdf,
+    0x80, 0xdc, 0x02, 0xd2, 0xca, 0xca, 0x81, 0xd2, 0x07, 0xca, 0xbb, 0xa8,
+    0xb6, 0xbb, 0xbb, 0xb6, 0xb6, 0x80, 0xa8, 0x32, 0xad, 0x90, 0x90, 0x8e,
+    0x8e, 0x57, 0x36, 0x28, 0x28, 0x29, 0x29, 0x24, 0x1c, 0x24, 0x29, 0x57,
+    0x57, 0x79, 0xca, 0xdb, 0xca, 0xc0, 0xbe, 0x90, 0x8d, 0x78, 0x65, 0x57,
+    0x3f, 0x65, 0x65, 0x78, 0x65, 0x3f, 0x29, 0x36, 0x36, 0x57, 0xc6, 0xe9,
+    0xe6, 0xde, 0xde, 0xe8, 0xc0, 0x5c, 0x3f, 0x32, 0x3f, 0x53, 0x5c, 0x81,
+    0x57, 0x05, 0x79, 0x8d, 0x9d, 0xad, 0xad, 0xbb, 0x80, 0xc6, 0x03, 0xb6,
+    0xca, 0xbb, 0xd2, 0x82, 0xd6, 0x0d, 0xe9, 0xe9, 0xf1, 0xf2, 0xdf, 0xe9,
+    0xe9, 0xd2, 0xdb, 0xe6, 0xe9, 0xe6, 0xf1, 0xe8, 0x81, 0xed, 0x03, 0xfc,
+    0xc1, 0x69, 0x59, 0x82, 0x60, 0x81, 0x66, 0x16, 0x60, 0x66, 0x56, 0x60,
+    0x60, 0x6e, 0x60, 0x60, 0x66, 0x66, 0x6b, 0x6b, 0x66, 0x60, 0x8a, 0x9f,
+    0xa7, 0xaa, 0xaa, 0xbd, 0xbd, 0xc9, 0xc9, 0x81, 0xd3, 0x81, 0xe2, 0x8b,
+    0xe7, 0x14, 0xd5, 0xb4, 0x91, 0x82, 0x74, 0x6c, 0x6c, 0x63, 0x5d, 0x49,
+    0x42, 0x42, 0x33, 0x21, 0x10, 0x10, 0x0d, 0x07, 0x06, 0x01, 0x01, 0x82,
+    0x00, 0x00, 0x01, 0x81, 0x06, 0x0b, 0x01, 0x03, 0x06, 0x06, 0x07, 0x2f,
+    0x50, 0x55, 0x5d, 0x59, 0x63, 0x5d, 0x80, 0x4d, 0x05, 0x51, 0x55, 0x4d,
+    0x5d, 0x58, 0x58, 0x80, 0x59, 0x07, 0x5f, 0x59, 0x5f, 0x5f, 0x56, 0x60,
+    0x66, 0x66, 0x82, 0x60, 0x01, 0x64, 0x64, 0x82, 0x60, 0x85, 0x68, 0x03,
+    0x71, 0x68, 0x71, 0x71, 0x9d, 0x68, 0x80, 0x6e, 0x09, 0x7a, 0x7a, 0x77,
+    0x7e, 0x7e, 0x83, 0x71, 0x4a, 0x22, 0x0a, 0x80, 0x0b, 0x80, 0x04, 0x0d,
+    0x00, 0x00, 0x5a, 0xe6, 0xe9, 0xe9, 0xdc, 0xe9, 0xdf, 0xe4, 0xe4, 0xe9,
+    0xe9, 0xdc, 0x81, 0xd2, 0x01, 0xdf, 0xdf, 0x81, 0xd2, 0x02, 0xdc, 0xc6,
+    0xbe, 0x80, 0xbb, 0x0c, 0xdb, 0xdc, 0xdc, 0xc6, 0xad, 0xbb, 0xe9, 0xbe,
+    0x57, 0x36, 0x36, 0x28, 0x28, 0x80, 0x29, 0x3a, 0x24, 0x1c, 0x24, 0x36,
+    0x99, 0xa8, 0xb6, 0xb6, 0xa8, 0xad, 0x90, 0x65, 0x65, 0x57, 0x3f, 0x1c,
+    0x28, 0x53, 0x57, 0x53, 0x1c, 0x29, 0x45, 0x57, 0x90, 0xd6, 0xdc, 0xe6,
+    0xdb, 0xdb, 0xe9, 0xb6, 0x32, 0x24, 0x24, 0x29, 0x3f, 0x5c, 0x57, 0x78,
+    0x90, 0xa3, 0x9d, 0x90, 0x9d, 0xad, 0xb6, 0xad, 0xad, 0x9d, 0x8e, 0xa8,
+    0xb6, 0xbb, 0xca, 0xd2, 0xd2, 0xdf, 0xdc, 0x80, 0xd6, 0x06, 0xf0, 0xfc,
+    0xee, 0xdc, 0xca, 0xc0, 0xda, 0x80, 0xd1, 0x0c, 0xda, 0xda, 0xe8, 0xe6,
+    0xdb, 0xdb, 0xc4, 0xeb, 0xa5, 0x5f, 0x66, 0x5f, 0x66, 0x80, 0x60, 0x07,
+    0x66, 0x66, 0x60, 0x68, 0x6b, 0x60, 0x56, 0x60, 0x83, 0x66, 0x0c, 0x60,
+    0x56, 0x5f, 0x83, 0x8a, 0x9b, 0xa7, 0xa7, 0xaf, 0xaa, 0xb8, 0xb8, 0xc2,
+    0x80, 0xc9, 0x80, 0xd3, 0x00, 0xd5, 0x8b, 0xe2, 0x04, 0xd5, 0xac, 0x7a,
+    0x6c, 0x63, 0x81, 0x55, 0x0a, 0x49, 0x41, 0x37, 0x2c, 0x14, 0x0c, 0x0c,
+    0x07, 0x06, 0x06, 0x01, 0x82, 0x00, 0x10, 0x01, 0x03, 0x06, 0x06, 0x02,
+    0x01, 0x00, 0x01, 0x02, 0x06, 0x0f, 0x2a, 0x4d, 0x4d, 0x5d, 0x59, 0x58,
+    0x80, 0x55, 0x80, 0x4d, 0x08, 0x46, 0x4f, 0x4f, 0x58, 0x59, 0x59, 0x58,
+    0x5f, 0x63, 0x80, 0x5f, 0x04, 0x56, 0x64, 0x56, 0x60, 0x66, 0x81, 0x60,
+    0x00, 0x64, 0x83, 0x60, 0x02, 0x68, 0x60, 0x60, 0x82, 0x68, 0x00, 0x6b,
+    0x8a, 0x68, 0x00, 0x64, 0x84, 0x68, 0x04, 0x70, 0x70, 0x68, 0x68, 0x71,
+    0x81, 0x68, 0x84, 0x6e, 0x09, 0x77, 0x7e, 0x7e, 0x83, 0x87, 0x7a, 0x3a,
+    0x18, 0x0a, 0x0a, 0x80, 0x0b, 0x80, 0x04, 0x03, 0x00, 0x00, 0x39, 0xca,
+    0x81, 0xe9, 0x81, 0xe4, 0x03, 0xdf, 0xdf, 0xdc, 0xd2, 0x81, 0xd6, 0x13,
+    0xdc, 0xdc, 0xe9, 0xdf, 0xd6, 0xc6, 0xc6, 0xbe, 0xbe, 0xed, 0xfa, 0xf2,
+    0xe4, 0xbe, 0x9d, 0xdb, 0xa8, 0x90, 0x8d, 0x57, 0x80, 0x36, 0x07, 0x3f,
+    0x28, 0x29, 0x24, 0x24, 0x1c, 0x11, 0x6f, 0x80, 0x8e, 0x05, 0x9d, 0x90,
+    0x90, 0x28, 0x24, 0x29, 0x81, 0x1c, 0x80, 0x11, 0x15, 0x24, 0x57, 0x90,
+    0xb0, 0xc6, 0xdc, 0xdb, 0xdb, 0xd2, 0xdc, 0xb6, 0x3f, 0x28, 0x29, 0x29,
+    0x32, 0x3f, 0x5c, 0x79, 0x8e, 0x9d, 0xad, 0x80, 0xbe, 0x0c, 0xc6, 0x9d,
+    0x5c, 0x5c, 0x6f, 0xa2, 0x8e, 0xa8, 0xa8, 0xb6, 0xca, 0xd2, 0xd2, 0x80,
+    0xd6, 0x03, 0xe9, 0xf8, 0xfe, 0xed, 0x80, 0xb3, 0x0e, 0xc0, 0xcf, 0xde,
+    0xdb, 0xe9, 0xe9, 0xe6, 0xdb, 0xb3, 0x76, 0x67, 0x69, 0x66, 0x5f, 0x5f,
+    0x80, 0x56, 0x80, 0x66, 0x16, 0x6b, 0x70, 0x6b, 0x60, 0x66, 0x56, 0x5f,
+    0x66, 0x6b, 0x66, 0x5f, 0x56, 0x56, 0x5f, 0x5f, 0x6e, 0x77, 0x83, 0x8a,
+    0x8a, 0x9b, 0xa7, 0xa7, 0x80, 0xaa, 0x03, 0xb8, 0xbd, 0xc2, 0xc2, 0x81,
+    0xc9, 0x89, 0xd3, 0x13, 0xc9, 0x91, 0x59, 0x5d, 0x55, 0x47, 0x42, 0x49,
+    0x49, 0x42, 0x37, 0x2c, 0x14, 0x0c, 0x0c, 0x05, 0x06, 0x06, 0x03, 0x01,
+    0x82, 0x00, 0x01, 0x01, 0x01, 0x80, 0x06, 0x0e, 0x01, 0x01, 0x03, 0x06,
+    0x06, 0x05, 0x27, 0x43, 0x4d, 0x55, 0x51, 0x55, 0x4d, 0x55, 0x4e, 0x80,
+    0x48, 0x05, 0x4e, 0x58, 0x4f, 0x58, 0x58, 0x5d, 0x80, 0x58, 0x0b, 0x5f,
+    0x58, 0x58, 0x59, 0x5f, 0x5f, 0x56, 0x56, 0x66, 0x66, 0x56, 0x66, 0x81,
+    0x60, 0x03, 0x6b, 0x6b, 0x60, 0x6b, 0x86, 0x60, 0x82, 0x68, 0x01, 0x64,
+    0x64, 0x80, 0x68, 0x04, 0x64, 0x68, 0x60, 0x68, 0x71, 0x85, 0x68, 0x05,
+    0x71, 0x71, 0x68, 0x6e, 0x68, 0x68, 0x81, 0x6e, 0x0e, 0x77, 0x77, 0x7e,
+    0x82, 0x87, 0x83, 0x87, 0x82, 0x50, 0x22, 0x12, 0x0a, 0x0b, 0x0c, 0x0c,
+    0x81, 0x04, 0x80, 0x00, 0x02, 0x34, 0xc0, 0xdf, 0x89, 0xe4, 0x34, 0xdf,
+    0xe4, 0xf1, 0xe6, 0xdf, 0xc6, 0xc6, 0xbe, 0xbb, 0xb6, 0xee, 0xfc, 0xee,
+    0xe8, 0xbb, 0x9d, 0x9d, 0xb3, 0x99, 0xb6, 0x9d, 0x65, 0x57, 0x45, 0x45,
+    0x36, 0x28, 0x28, 0x29, 0x24, 0x1c, 0x11, 0x6f, 0x8e, 0x65, 0x78, 0x8d,
+    0x90, 0x8d, 0x29, 0x19, 0x11, 0x1c, 0x1c, 0x29, 0x29, 0x11, 0x19, 0x26,
+    0x1c, 0x53, 0x90, 0xb0, 0x83, 0xbe, 0x26, 0x79, 0x29, 0x53, 0x57, 0x5c,
+    0x4b, 0x4b, 0x53, 0x5c, 0x79, 0x8e, 0x9d, 0xa8, 0xa8, 0xb6, 0xb6, 0xdc,
+    0x99, 0x4b, 0x53, 0x6f, 0x5c, 0x6f, 0x79, 0x8e, 0xa8, 0xa8, 0xb6, 0xca,
+    0xd2, 0xdc, 0xdf, 0xe9, 0xf1, 0xfe, 0xe8, 0xca, 0xdb, 0xdc, 0x82, 0xdb,
+    0x04, 0xcf, 0x98, 0x76, 0x5f, 0x5f, 0x81, 0x58, 0x00, 0x4f, 0x80, 0x58,
+    0x02, 0x5f, 0x66, 0x56, 0x81, 0x66, 0x05, 0x5f, 0x66, 0x66, 0x68, 0x66,
+    0x66, 0x81, 0x5f, 0x0e, 0x66, 0x68, 0x6e, 0x73, 0x7e, 0x83, 0x8a, 0x8a,
+    0x9b, 0x9f, 0xa7, 0xa7, 0xaf, 0xaa, 0xaa, 0x80, 0xb8, 0x81, 0xc2, 0x86,
+    0xc9, 0x11, 0xb4, 0x6c, 0x49, 0x49, 0x41, 0x41, 0x37, 0x41, 0x41, 0x37,
+    0x31, 0x20, 0x0c, 0x04, 0x04, 0x06, 0x06, 0x01, 0x83, 0x00, 0x05, 0x03,
+    0x03, 0x01, 0x02, 0x06, 0x06, 0x80, 0x01, 0x04, 0x02, 0x06, 0x05, 0x21,
+    0x47, 0x81, 0x55, 0x06, 0x4d, 0x48, 0x48, 0x44, 0x49, 0x49, 0x4e, 0x80,
+    0x58, 0x00, 0x5d, 0x80, 0x58, 0x0c, 0x4f, 0x4f, 0x58, 0x58, 0x4f, 0x58,
+    0x5f, 0x59, 0x59, 0x5f, 0x5f, 0x56, 0x56, 0x80, 0x60, 0x01, 0x66, 0x66,
+    0x83, 0x60, 0x00, 0x64, 0x83, 0x60, 0x02, 0x68, 0x68, 0x60, 0x80, 0x68,
+    0x00, 0x71, 0x81, 0x68, 0x03, 0x60, 0x68, 0x68, 0x60, 0x81, 0x68, 0x02,
+    0x70, 0x68, 0x70, 0x81, 0x68, 0x82, 0x6e, 0x0f, 0x7a, 0x82, 0x7e, 0x83,
+    0x87, 0x87, 0x8c, 0x8a, 0x7a, 0x3a, 0x18, 0x0a, 0x0a, 0x0b, 0x0c, 0x0c,
+    0x80, 0x04, 0x81, 0x00, 0x04, 0x01, 0x26, 0xc0, 0xdf, 0xdf, 0x80, 0xe4,
+    0x1c, 0xf0, 0xf0, 0xe4, 0xdf, 0xc6, 0xc6, 0xd2, 0xdb, 0xf2, 0xf2, 0xc6,
+    0xc6, 0xbe, 0xbb, 0xad, 0xad, 0xc0, 0xed, 0xe6, 0xdb, 0xbb, 0x9d, 0x8d,
+    0x65, 0x84, 0x99, 0xdc, 0xbe, 0x8d, 0x80, 0x57, 0x03, 0x45, 0x36, 0x28,
+    0x29, 0x80, 0x24, 0x15, 0x3f, 0x65, 0x65, 0x78, 0x8e, 0x8d, 0x65, 0x1c,
+    0x11, 0x1c, 0x29, 0x24, 0x32, 0x3f, 0x24, 0x19, 0x1c, 0x1c, 0x29, 0x79,
+    0xa3, 0xb0, 0x80, 0xad, 0x1a, 0xb0, 0x9d, 0x79, 0x3f, 0x4b, 0x79, 0x78,
+    0x8e, 0x79, 0x6f, 0x57, 0x79, 0x79, 0x8e, 0xa8, 0xb6, 0xb6, 0xbb, 0xdb,
+    0xe6, 0x99, 0x5c, 0x6f, 0x6f, 0x79, 0x8e, 0x8e, 0x80, 0xa8, 0x07, 0xb6,
+    0xca, 0xca, 0xd2, 0xd2, 0xe9, 0xf1, 0xe8, 0x82, 0xca, 0x04, 0xc0, 0x98,
+    0x8b, 0x76, 0x61, 0x81, 0x5f, 0x80, 0x4f, 0x82, 0x58, 0x01, 0x5f, 0x5f,
+    0x80, 0x66, 0x02, 0x60, 0x6b, 0x66, 0x80, 0x56, 0x12, 0x5f, 0x5f, 0x66,
+    0x5f, 0x5f, 0x51, 0x58, 0x5f, 0x60, 0x68, 0x6e, 0x73, 0x7e, 0x7e, 0x83,
+    0x8a, 0x8a, 0x9b, 0x9f, 0x80, 0x9e, 0x04, 0xaa, 0xaa, 0xaf, 0xaf, 0xaa,
+    0x80, 0xb8, 0x00, 0xbd, 0x81, 0xb8, 0x11, 0xaf, 0x81, 0x49, 0x41, 0x41,
+    0x37, 0x37, 0x2f, 0x37, 0x37, 0x33, 0x1f, 0x0c, 0x04, 0x04, 0x06, 0x06,
+    0x01, 0x83, 0x00, 0x0e, 0x01, 0x01, 0x03, 0x01, 0x06, 0x02, 0x06, 0x06,
+    0x00, 0x00, 0x02, 0x06, 0x0f, 0x15, 0x41, 0x80, 0x49, 0x80, 0x43, 0x08,
+    0x49, 0x43, 0x43, 0x49, 0x49, 0x55, 0x51, 0x51, 0x55, 0x80, 0x51, 0x01,
+    0x4f, 0x4f, 0x82, 0x58, 0x00, 0x59, 0x82, 0x5f, 0x03, 0x56, 0x64, 0x56,
+    0x66, 0x81, 0x60, 0x00, 0x66, 0x80, 0x60, 0x00, 0x64, 0x81, 0x60, 0x00,
+    0x6b, 0x81, 0x60, 0x84, 0x68, 0x01, 0x60, 0x60, 0x88, 0x68, 0x83, 0x6e,
+    0x0b, 0x77, 0x7e, 0x82, 0x82, 0x80, 0x80, 0x8c, 0x8c, 0x93, 0x80, 0x3a,
+    0x18, 0x80, 0x0b, 0x81, 0x04, 0x83, 0x00, 0x10, 0x04, 0xb5, 0xca, 0xd2,
+    0xdc, 0xe4, 0xf0, 0xe4, 0xdf, 0xd2, 0xc6, 0xbb, 0xbb, 0xb6, 0xed, 0xe8,
+    0xd2, 0x81, 0xbb, 0x00, 0xad, 0x80, 0xb6, 0x03, 0xca, 0xb6, 0xa8, 0x79,
+    0x80, 0x57, 0x28, 0x9d, 0xad, 0xa3, 0x8d, 0x65, 0x65, 0x57, 0x5c, 0x36,
+    0x28, 0x28, 0x32, 0x29, 0x1c, 0x24, 0x32, 0x3f, 0x3f, 0x4b, 0x5c, 0x32,
+    0x26, 0x1c, 0x6a, 0x99, 0x29, 0x4b, 0x79, 0x28, 0x12, 0x24, 0x24, 0x26,
+    0x29, 0x5c, 0x90, 0x90, 0x79, 0x57, 0x3f, 0x53, 0x81, 0x79, 0x02, 0x90,
+    0x9d, 0xad, 0x80, 0x8e, 0x0d, 0xb6, 0xdb, 0xe8, 0xed, 0xed, 0xe9, 0xe9,
+    0xf2, 0xed, 0xb3, 0x99, 0x79, 0x79, 0x8e, 0x80, 0xa8, 0x01, 0xb6, 0xb6,
+    0x81, 0xca, 0x0b, 0xe9, 0xe9, 0xcf, 0x98, 0x98, 0x8b, 0x8b, 0x76, 0x72,
+    0x69, 0x59, 0x58, 0x82, 0x5f, 0x10, 0x58, 0x58, 0x4f, 0x46, 0x51, 0x4e,
+    0x4e, 0x58, 0x5f, 0x5f, 0x66, 0x66, 0x60, 0x60, 0x66, 0x66, 0x56, 0x83,
+    0x5f, 0x13, 0x58, 0x44, 0x48, 0x4e, 0x51, 0x4f, 0x56, 0x66, 0x6b, 0x68,
+    0x6e, 0x73, 0x7e, 0x7e, 0x83, 0x8a, 0x8a, 0x9b, 0x9b, 0x9f, 0x80, 0xa7,
+    0x19, 0x9e, 0xa7, 0x9e, 0xa7, 0xaa, 0x9e, 0xa7, 0xa7, 0x82, 0x49, 0x37,
+    0x37, 0x33, 0x31, 0x33, 0x31, 0x2f, 0x31, 0x27, 0x14, 0x04, 0x04, 0x02,
+    0x06, 0x01, 0x01, 0x82, 0x00, 0x04, 0x01, 0x03, 0x03, 0x01, 0x01, 0x80,
+    0x06, 0x15, 0x02, 0x01, 0x01, 0x00, 0x06, 0x0f, 0x15, 0x35, 0x43, 0x42,
+    0x49, 0x49, 0x43, 0x42, 0x3b, 0x42, 0x3b, 0x49, 0x49, 0x4e, 0x4e, 0x55,
+    0x82, 0x51, 0x03, 0x4d, 0x4d, 0x51, 0x4f, 0x80, 0x58, 0x06, 0x4f, 0x58,
+    0x56, 0x56, 0x5f, 0x5f, 0x59, 0x80, 0x56, 0x8c, 0x60, 0x00, 0x6b, 0x81,
+    0x60, 0x04, 0x64, 0x68, 0x68, 0x60, 0x60, 0x88, 0x68, 0x82, 0x6e, 0x0f,
+    0x77, 0x7e, 0x7e, 0x83, 0x83, 0x8a, 0x8c, 0x8c, 0x93, 0x93, 0x9e, 0x86,
+    0x38, 0x0a, 0x0b, 0x0b, 0x81, 0x04, 0x84, 0x00, 0x10, 0x19, 0xcf, 0x99,
+    0xb3, 0xdb, 0xf1, 0xe4, 0xdf, 0xd2, 0xbe, 0xbb, 0xbb, 0xb6, 0xca, 0xe9,
+    0xd2, 0xc6, 0x80, 0xbb, 0x03, 0xad, 0xad, 0xb6, 0xb6, 0x80, 0xa8, 0x2a,
+    0x8e, 0x79, 0x57, 0x57, 0x53, 0x53, 0x79, 0x90, 0x78, 0x65, 0x57, 0x57,
+    0x45, 0x36, 0x36, 0x3f, 0x29, 0x1c, 0x29, 0x28, 0x29, 0x11, 0x11, 0x24,
+    0x1c, 0x1c, 0x24, 0x3f, 0xe6, 0xcf, 0x7c, 0xde, 0xc7, 0x57, 0x11, 0x29,
+    0x28, 0x1c, 0x1c, 0x29, 0x3f, 0x57, 0x65, 0x82, 0x79, 0x21, 0x90, 0xa3,
+    0x90, 0x9d, 0xbe, 0xc6, 0xbe, 0xdc, 0xe9, 0xf1, 0xf2, 0xf2, 0xf1, 0xf1,
+    0xe9, 0xf1, 0xf1, 0xe9, 0xd2, 0xd2, 0xbe, 0xca, 0xa8, 0xa8, 0xb6, 0xb6,
+    0xca, 0xd2, 0xdb, 0xdb, 0xe9, 0xe9, 0xdb, 0xa1, 0x82, 0x59, 0x06, 0x63,
+    0x59, 0x59, 0x56, 0x5f, 0x58, 0x4f, 0x80, 0x58, 0x0a, 0x51, 0x46, 0x51,
+    0x4e, 0x4e, 0x46, 0x58, 0x5f, 0x56, 0x56, 0x5f, 0x80, 0x60, 0x04, 0x5f,
+    0x56, 0x56, 0x5f, 0x5f, 0x81, 0x58, 0x11, 0x3e, 0x3e, 0x4c, 0x3e, 0x42,
+    0x42, 0x44, 0x51, 0x58, 0x56, 0x60, 0x68, 0x75, 0x73, 0x77, 0x7e, 0x83,
+    0x83, 0x80, 0x8a, 0x0c, 0x95, 0x8a, 0x95, 0x9b, 0x95, 0x8a, 0x8a, 0x95,
+    0x7a, 0x43, 0x31, 0x2f, 0x31, 0x81, 0x2c, 0x07, 0x2e, 0x27, 0x15, 0x0c,
+    0x04, 0x06, 0x06, 0x01, 0x81, 0x00, 0x05, 0x01, 0x00, 0x01, 0x01, 0x03,
+    0x01, 0x83, 0x06, 0x12, 0x01, 0x00, 0x01, 0x06, 0x0f, 0x10, 0x2a, 0x42,
+    0x35, 0x41, 0x41, 0x42, 0x3b, 0x3b, 0x42, 0x42, 0x43, 0x55, 0x55, 0x80,
+    0x4d, 0x01, 0x51, 0x46, 0x80, 0x4d, 0x06, 0x46, 0x46, 0x51, 0x51, 0x58,
+    0x4f, 0x4f, 0x80, 0x58, 0x02, 0x5f, 0x5f, 0x59, 0x80, 0x56, 0x00, 0x66,
+    0x83, 0x60, 0x00, 0x64, 0x80, 0x60, 0x00, 0x64, 0x81, 0x60, 0x00, 0x64,
+    0x82, 0x60, 0x02, 0x68, 0x60, 0x68, 0x80, 0x60, 0x80, 0x68, 0x02, 0x70,
+    0x68, 0x75, 0x81, 0x6e, 0x0f, 0x77, 0x7a, 0x77, 0x7e, 0x7e, 0x83, 0x87,
+    0x8c, 0x8c, 0x93, 0x9b, 0x9e, 0x9e, 0x94, 0x3a, 0x0a, 0x82, 0x0b, 0x01,
+    0x04, 0x04, 0x83, 0x00, 0x11, 0x0b, 0x9a, 0xdb, 0x84, 0x99, 0xe6, 0xe4,
+    0xdc, 0xd2, 0xca, 0xbb, 0xbb, 0xca, 0xbb, 0xb6, 0xca, 0xdb, 0xd2, 0x80,
+    0xbe, 0x0e, 0xad, 0xb6, 0xb6, 0xa8, 0xb6, 0xbb, 0xad, 0x9d, 0x79, 0x5c,
+    0x45, 0x36, 0x4b, 0x4b, 0x53, 0x82, 0x57, 0x27, 0x45, 0x3f, 0x29, 0x29,
+    0x32, 0x53, 0x3f, 0x26, 0x1e, 0x29, 0x29, 0x26, 0x1e, 0x34, 0xb3, 0xdb,
+    0xca, 0xb5, 0xca, 0xe9, 0xbe, 0x32, 0x29, 0x36, 0x3f, 0x29, 0x29, 0x32,
+    0x4b, 0x79, 0x9d, 0xad, 0xc6, 0xdc, 0x8e, 0x9d, 0xad, 0xc6, 0xbe, 0xbe,
+    0x82, 0xd6, 0x00, 0xe4, 0x80, 0xe9, 0x80, 0xdb, 0x0a, 0xdc, 0xd2, 0xdc,
+    0xdf, 0xdf, 0xd2, 0xca, 0xd2, 0xdc, 0xdf, 0xdf, 0x80, 0xe9, 0x1c, 0xdc,
+    0x9a, 0x59, 0x63, 0x63, 0x4f, 0x59, 0x59, 0x58, 0x4f, 0x4f, 0x56, 0x5f,
+    0x58, 0x58, 0x4f, 0x58, 0x58, 0x51, 0x51, 0x46, 0x4e, 0x46, 0x4f, 0x56,
+    0x58, 0x56, 0x56, 0x5f, 0x81, 0x56, 0x03, 0x5f, 0x56, 0x56, 0x5f, 0x81,
+    0x58, 0x0f, 0x30, 0x30, 0x2f, 0x2a, 0x25, 0x1a, 0x25, 0x2f, 0x35, 0x48,
+    0x4f, 0x58, 0x5f, 0x60, 0x6b, 0x68, 0x80, 0x6e, 0x84, 0x7e, 0x03, 0x77,
+    0x6e, 0x6c, 0x42, 0x82, 0x2c, 0x80, 0x27, 0x05, 0x21, 0x1a, 0x05, 0x04,
+    0x06, 0x06, 0x86, 0x00, 0x01, 0x01, 0x01, 0x84, 0x06, 0x11, 0x03, 0x00,
+    0x00, 0x02, 0x06, 0x0f, 0x21, 0x35, 0x35, 0x37, 0x37, 0x35, 0x42, 0x42,
+    0x3b, 0x42, 0x42, 0x49, 0x80, 0x48, 0x80, 0x4d, 0x00, 0x48, 0x82, 0x4d,
+    0x80, 0x51, 0x00, 0x4f, 0x81, 0x58, 0x06, 0x5f, 0x56, 0x5f, 0x5f, 0x59,
+    0x56, 0x56, 0x80, 0x60, 0x00, 0x66, 0x80, 0x60, 0x03, 0x66, 0x66, 0x6b,
+    0x6b, 0x80, 0x60, 0x03, 0x6b, 0x60, 0x6b, 0x6b, 0x80, 0x60, 0x87, 0x68,
+    0x82, 0x6e, 0x13, 0x77, 0x7e, 0x7e, 0x83, 0x83, 0x91, 0x8c, 0x93, 0x9b,
+    0x9e, 0x9e, 0xaa, 0xaa, 0x69, 0x0a, 0x0a, 0x12, 0x0a, 0x0b, 0x0b, 0x81,
+    0x04, 0x82, 0x00, 0x09, 0x1e, 0xdb, 0xca, 0x99, 0xc0, 0xe9, 0xe9, 0xdb,
+    0xd2, 0xd2, 0x81, 0xca, 0x24, 0xb6, 0xba, 0xba, 0xdc, 0xbe, 0xbb, 0xbe,
+    0xbe, 0xbb, 0xbe, 0xbe, 0xdb, 0xe6, 0xdb, 0xb6, 0x8e, 0x57, 0x57, 0x45,
+    0x99, 0xe9, 0xde, 0xa2, 0x79, 0x78, 0x65, 0x57, 0x36, 0x4b, 0x36, 0x57,
+    0x79, 0x36, 0x1c, 0x26, 0x32, 0x32, 0x80, 0x1c, 0x19, 0x6a, 0xbb, 0xb6,
+    0xb6, 0xb3, 0xb6, 0xd2, 0xc6, 0x6f, 0x24, 0x57, 0x57, 0x4b, 0x4b, 0x79,
+    0xbb, 0xdc, 0xe0, 0xbb, 0xdc, 0xf1, 0xa2, 0x6f, 0xa8, 0xbe, 0xd6, 0x80,
+    0xc6, 0x02, 0xd6, 0xd6, 0xc6, 0x81, 0xd2, 0x09, 0xca, 0xca, 0xb6, 0xa8,
+    0xbb, 0xd2, 0xdc, 0xdf, 0xe4, 0xe9, 0x81, 0xd6, 0x0b, 0xe4, 0xdf, 0xca,
+    0x98, 0x59, 0x5d, 0x5d, 0x59, 0x58, 0x58, 0x56, 0x59, 0x86, 0x58, 0x08,
+    0x4f, 0x58, 0x51, 0x4e, 0x48, 0x46, 0x46, 0x51, 0x58, 0x82, 0x5f, 0x04,
+    0x66, 0x5f, 0x56, 0x5f, 0x5f, 0x80, 0x58, 0x1d, 0x51, 0x21, 0x21, 0x15,
+    0x17, 0x10, 0x10, 0x15, 0x21, 0x2a, 0x35, 0x44, 0x44, 0x48, 0x4e, 0x58,
+    0x58, 0x56, 0x66, 0x60, 0x6b, 0x6b, 0x68, 0x6b, 0x60, 0x6b, 0x66, 0x4d,
+    0x47, 0x2f, 0x84, 0x27, 0x07, 0x1f, 0x21, 0x08, 0x07, 0x02, 0x06, 0x01,
+    0x03, 0x85, 0x00, 0x02, 0x01, 0x01, 0x03, 0x81, 0x06, 0x0b, 0x0f, 0x06,
+    0x06, 0x03, 0x00, 0x01, 0x01, 0x06, 0x0f, 0x15, 0x33, 0x37, 0x81, 0x2f,
+    0x80, 0x35, 0x04, 0x3b, 0x42, 0x49, 0x43, 0x44, 0x80, 0x49, 0x80, 0x48,
+    0x80, 0x4d, 0x80, 0x46, 0x00, 0x51, 0x81, 0x58, 0x01, 0x59, 0x58, 0x81,
+    0x5f, 0x04, 0x56, 0x5f, 0x56, 0x60, 0x60, 0x81, 0x66, 0x02, 0x60, 0x60,
+    0x6b, 0x82, 0x60, 0x00, 0x6b, 0x80, 0x68, 0x00, 0x6b, 0x85, 0x68, 0x04,
+    0x6e, 0x6e, 0x7d, 0x7a, 0x77, 0x81, 0x7e, 0x12, 0x83, 0x8a, 0x8c, 0x8c,
+    0x93, 0x93, 0x9e, 0xaa, 0xae, 0xb8, 0xb8, 0x86, 0x23, 0x19, 0x19, 0x12,
+    0x0a, 0x0b, 0x0b, 0x82, 0x04, 0x80, 0x00, 0x07, 0x04, 0x6a, 0xc0, 0xca,
+    0xdb, 0xe9, 0xdb, 0xdb, 0x80, 0xd2, 0x82, 0xca, 0x42, 0xc0, 0xc0, 0xca,
+    0xdc, 0xe6, 0xe6, 0xe4, 0xdc, 0xc6, 0xb6, 0xca, 0xca, 0xc6, 0xc6, 0xbe,
+    0x9d, 0x79, 0x8e, 0xc0, 0xdb, 0xe9, 0xdc, 0xbe, 0xa8, 0x99, 0x8e, 0x9d,
+    0x90, 0x65, 0x5c, 0x1c, 0x24, 0x4b, 0x3f, 0x24, 0x29, 0x29, 0x1c, 0x79,
+    0x9d, 0x9d, 0xb6, 0xb6, 0xa8, 0xa8, 0xad, 0x6f, 0x26, 0x5c, 0x78, 0x9d,
+    0xad, 0xad, 0xbe, 0xdc, 0xe9, 0xc0, 0xb3, 0xdb, 0xa2, 0x5c, 0x5c, 0x79,
+    0xc0, 0xe4, 0xe0, 0xdc, 0x82, 0xc6, 0x12, 0xbb, 0xb6, 0xa8, 0x99, 0x79,
+    0x8e, 0xa8, 0xb6, 0xca, 0xdc, 0xdf, 0xdf, 0xe9, 0xdc, 0xd2, 0xd2, 0xca,
+    0x98, 0x6d, 0x81, 0x58, 0x0b, 0x5d, 0x58, 0x59, 0x59, 0x4d, 0x5d, 0x58,
+    0x5d, 0x5f, 0x58, 0x4f, 0x59, 0x80, 0x51, 0x00, 0x58, 0x82, 0x51, 0x81,
+    0x58, 0x03, 0x5f, 0x58, 0x5f, 0x66, 0x81, 0x5f, 0x20, 0x58, 0x58, 0x4e,
+    0x4e, 0x15, 0x15, 0x10, 0x0f, 0x10, 0x15, 0x21, 0x2a, 0x2a, 0x30, 0x2f,
+    0x35, 0x42, 0x42, 0x44, 0x48, 0x4e, 0x51, 0x51, 0x58, 0x58, 0x51, 0x4e,
+    0x49, 0x3b, 0x35, 0x2c, 0x27, 0x21, 0x80, 0x27, 0x82, 0x1f, 0x05, 0x1d,
+    0x07, 0x06, 0x06, 0x03, 0x01, 0x83, 0x00, 0x04, 0x01, 0x00, 0x01, 0x01,
+    0x03, 0x81, 0x06, 0x80, 0x0f, 0x08, 0x06, 0x06, 0x00, 0x01, 0x03, 0x02,
+    0x06, 0x10, 0x2c, 0x83, 0x2f, 0x02, 0x30, 0x35, 0x35, 0x81, 0x42, 0x0c,
+    0x3e, 0x3e, 0x49, 0x43, 0x49, 0x44, 0x48, 0x48, 0x4e, 0x51, 0x4d, 0x4d,
+    0x51, 0x80, 0x58, 0x07, 0x4f, 0x5f, 0x59, 0x56, 0x56, 0x5f, 0x5f, 0x56,
+    0x83, 0x66, 0x08, 0x64, 0x60, 0x6b, 0x6b, 0x60, 0x60, 0x64, 0x60, 0x60,
+    0x81, 0x68, 0x02, 0x6b, 0x68, 0x71, 0x81, 0x68, 0x82, 0x6e, 0x19, 0x77,
+    0x77, 0x7e, 0x85, 0x83, 0x83, 0x87, 0x91, 0x8c, 0x93, 0x93, 0xa7, 0x9e,
+    0xae, 0xb8, 0xb8, 0xc2, 0xb8, 0x94, 0x5e, 0x52, 0x2d, 0x12, 0x0a, 0x0b,
+    0x0b, 0x83, 0x04, 0x80, 0x00, 0x02, 0x0a, 0x5a, 0xca, 0x83, 0xdb, 0x1a,
+    0xdc, 0xe9, 0xdc, 0xdb, 0xdc, 0xdf, 0xdf, 0xca, 0xca, 0xdc, 0xdc, 0xd6,
+    0xbe, 0xa8, 0xa8, 0x8e, 0x79, 0xa2, 0x9d, 0x9d, 0x8e, 0x8e, 0x78, 0x65,
+    0x79, 0xb6, 0xca, 0x80, 0xbe, 0x08, 0xad, 0x9d, 0x9d, 0x6f, 0x3f, 0x32,
+    0x4b, 0x5c, 0x4b, 0x81, 0x32, 0x20, 0x29, 0x5c, 0x8e, 0x8e, 0xad, 0xad,
+    0x9d, 0x9d, 0x79, 0x29, 0x12, 0x29, 0x79, 0x90, 0x9d, 0xb6, 0xb6, 0xbe,
+    0xbe, 0x99, 0x84, 0xb6, 0xa8, 0x79, 0x6f, 0x79, 0x79, 0xcf, 0xf2, 0xf2,
+    0xe9, 0xca, 0xa8, 0x80, 0xb6, 0x00, 0xa8, 0x80, 0x99, 0x17, 0xa8, 0xa8,
+    0xb3, 0xb6, 0xca, 0xdc, 0xdc, 0xdf, 0xe9, 0xc0, 0xca, 0xcf, 0xbf, 0x8f,
+    0x55, 0x51, 0x58, 0x51, 0x51, 0x58, 0x5d, 0x4e, 0x49, 0x4d, 0x80, 0x51,
+    0x81, 0x58, 0x11, 0x51, 0x51, 0x58, 0x58, 0x4f, 0x58, 0x58, 0x4f, 0x58,
+    0x58, 0x4f, 0x58, 0x4f, 0x58, 0x4f, 0x58, 0x56, 0x5f, 0x80, 0x58, 0x03,
+    0x51, 0x51, 0x58, 0x10, 0x80, 0x17, 0x13, 0x15, 0x21, 0x25, 0x25, 0x21,
+    0x15, 0x15, 0x1f, 0x21, 0x21, 0x25, 0x2b, 0x35, 0x35, 0x42, 0x35, 0x37,
+    0x2f, 0x2c, 0x27, 0x80, 0x1f, 0x03, 0x1d, 0x1f, 0x1f, 0x27, 0x80, 0x1f,
+    0x07, 0x17, 0x20, 0x17, 0x10, 0x06, 0x01, 0x00, 0x01, 0x84, 0x00, 0x04,
+    0x01, 0x01, 0x00, 0x01, 0x01, 0x80, 0x06, 0x81, 0x0f, 0x08, 0x06, 0x06,
+    0x00, 0x03, 0x03, 0x01, 0x02, 0x0f, 0x21, 0x80, 0x2f, 0x16, 0x2a, 0x2a,
+    0x2e, 0x2e, 0x33, 0x30, 0x33, 0x35, 0x35, 0x42, 0x42, 0x3e, 0x42, 0x43,
+    0x49, 0x40, 0x48, 0x4e, 0x4e, 0x51, 0x4e, 0x4d, 0x55, 0x80, 0x58, 0x03,
+    0x4f, 0x4f, 0x59, 0x56, 0x81, 0x5f, 0x00, 0x56, 0x81, 0x60, 0x04, 0x64,
+    0x64, 0x60, 0x6b, 0x6b, 0x80, 0x60, 0x01, 0x64, 0x64, 0x82, 0x68, 0x80,
+    0x71, 0x01, 0x6e, 0x75, 0x81, 0x6e, 0x18, 0x77, 0x77, 0x7e, 0x7e, 0x83,
+    0x87, 0x8a, 0x8a, 0x91, 0x95, 0x93, 0x9e, 0x9e, 0xaf, 0xb4, 0xb8, 0xb8,
+    0xc2, 0xc9, 0xc5, 0xb1, 0xab, 0xa4, 0x5e, 0x18, 0x81, 0x0b, 0x80, 0x04,
+    0x80, 0x00, 0x07, 0x19, 0x39, 0x8b, 0xd1, 0xcf, 0xb3, 0xc0, 0xdc, 0x80,
+    0xe9, 0x02, 0xdc, 0xe9, 0xe9, 0x80, 0xd6, 0x03, 0xc6, 0xc6, 0xa8, 0x6f,
+    0x80, 0x4b, 0x1a, 0x84, 0x6f, 0x4b, 0x4b, 0x53, 0x5c, 0x57, 0x57, 0x45,
+    0x36, 0x28, 0x32, 0x5c, 0x5c, 0x6f, 0x8e, 0x8e, 0x79, 0x57, 0x5c, 0x4b,
+    0x6f, 0x8e, 0x79, 0x5c, 0x4b, 0x3f, 0x80, 0x4b, 0x0d, 0x32, 0x4b, 0x4b,
+    0x29, 0x53, 0x5c, 0x4b, 0x29, 0x29, 0x1c, 0x12, 0x26, 0x24, 0x5c, 0x80,
+    0x9d, 0x04, 0xa8, 0x9d, 0xa8, 0xa8, 0x9d, 0x80, 0xad, 0x11, 0xb6, 0xa8,
+    0xa8, 0xed, 0xfe, 0xed, 0xf2, 0xcf, 0x8e, 0x9d, 0xb6, 0xbb, 0xca, 0xca,
+    0xd2, 0xd2, 0xdb, 0xdb, 0x80, 0xca, 0x0f, 0xd2, 0xdb, 0xca, 0x9a, 0xb5,
+    0xcf, 0xde, 0xd1, 0xc3, 0x52, 0x2c, 0x4a, 0x6d, 0x4a, 0x50, 0x49, 0x81,
+    0x4d, 0x81, 0x58, 0x07, 0x51, 0x51, 0x58, 0x51, 0x58, 0x58, 0x66, 0x5f,
+    0x83, 0x58, 0x03, 0x5f, 0x58, 0x4f, 0x56, 0x84, 0x58, 0x09, 0x0f, 0x0f,
+    0x10, 0x10, 0x17, 0x17, 0x15, 0x1d, 0x10, 0x06, 0x80, 0x02, 0x0a, 0x06,
+    0x06, 0x0f, 0x10, 0x15, 0x1f, 0x15, 0x17, 0x17, 0x10, 0x14, 0x81, 0x0f,
+    0x02, 0x14, 0x17, 0x17, 0x80, 0x1f, 0x07, 0x17, 0x17, 0x0f, 0x06, 0x00,
+    0x00, 0x01, 0x01, 0x80, 0x00, 0x03, 0x01, 0x03, 0x01, 0x01, 0x81, 0x03,
+    0x80, 0x06, 0x82, 0x0f, 0x02, 0x06, 0x06, 0x03, 0x80, 0x01, 0x02, 0x06,
+    0x06, 0x15, 0x84, 0x2e, 0x0f, 0x2a, 0x2a, 0x2f, 0x30, 0x35, 0x35, 0x42,
+    0x3e, 0x42, 0x3e, 0x43, 0x49, 0x40, 0x46, 0x4e, 0x51, 0x80, 0x4d, 0x00,
+    0x51, 0x80, 0x58, 0x09, 0x4f, 0x5f, 0x56, 0x5f, 0x5f, 0x66, 0x56, 0x66,
+    0x60, 0x60, 0x80, 0x66, 0x08, 0x60, 0x60, 0x6b, 0x60, 0x68, 0x68, 0x6b,
+    0x68, 0x70, 0x80, 0x68, 0x04, 0x70, 0x70, 0x75, 0x6e, 0x75, 0x81, 0x6e,
+    0x1a, 0x77, 0x77, 0x7e, 0x7e, 0x83, 0x83, 0x8a, 0x8c, 0x8a, 0x95, 0x9b,
+    0x9f, 0xa7, 0xaa, 0xae, 0xbd, 0xb8, 0xc2, 0xc2, 0xce, 0xc9, 0xc2, 0xb8,
+    0xac, 0x86, 0x38, 0x13, 0x81, 0x0b, 0x80, 0x04, 0x0c, 0x1e, 0x5a, 0x98,
+    0xd1, 0xeb, 0xee, 0xde, 0xc7, 0xcf, 0xb5, 0xca, 0xf1, 0xe9, 0x81, 0xdc,
+    0x23, 0xc6, 0xbe, 0xb6, 0x99, 0x6a, 0x3f, 0x3f, 0x32, 0x32, 0x6f, 0x6f,
+    0x4b, 0x53, 0x5c, 0x57, 0x57, 0x5c, 0x53, 0x3f, 0x3f, 0x53, 0x5c, 0x53,
+    0x5c, 0x8e, 0x79, 0x79, 0x57, 0x57, 0x5c, 0x8e, 0xb6, 0xa8, 0x79, 0x5c,
+    0x53, 0x81, 0x5c, 0x41, 0x4b, 0x6f, 0x32, 0x29, 0x3f, 0x32, 0x24, 0x1c,
+    0x24, 0x32, 0x11, 0x1c, 0x11, 0x11, 0x24, 0x5c, 0x78, 0x8e, 0x9d, 0x9d,
+    0x5c, 0x34, 0x79, 0xad, 0xc6, 0xd6, 0xd6, 0xbb, 0xcf, 0xed, 0xf2, 0xe9,
+    0xe8, 0xa2, 0x8e, 0xb6, 0xbb, 0xca, 0xd2, 0xd2, 0xdf, 0xe9, 0xf2, 0xf2,
+    0xe9, 0xdb, 0xca, 0xc0, 0x84, 0x6f, 0x84, 0xb5, 0xcf, 0xde, 0xd1, 0xdd,
+    0xa1, 0xd1, 0xb5, 0x3c, 0x2d, 0x31, 0x47, 0x5d, 0x4d, 0x55, 0x80, 0x51,
+    0x00, 0x58, 0x82, 0x51, 0x87, 0x58, 0x01, 0x4f, 0x56, 0x84, 0x58, 0x01,
+    0x7d, 0x10, 0x84, 0x0f, 0x08, 0x06, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x06, 0x88, 0x0f, 0x08, 0x05, 0x0f, 0x0f, 0x17, 0x1d, 0x17, 0x10,
+    0x0f, 0x03, 0x84, 0x00, 0x1f, 0x03, 0x03, 0x01, 0x01, 0x03, 0x03, 0x01,
+    0x01, 0x02, 0x06, 0x06, 0x0f, 0x0f, 0x07, 0x0f, 0x07, 0x0f, 0x0f, 0x06,
+    0x01, 0x01, 0x00, 0x01, 0x01, 0x06, 0x10, 0x27, 0x2e, 0x2a, 0x2a, 0x2e,
+    0x2e, 0x82, 0x2a, 0x13, 0x33, 0x30, 0x35, 0x35, 0x42, 0x3e, 0x3e, 0x43,
+    0x40, 0x48, 0x48, 0x4e, 0x4e, 0x55, 0x51, 0x51, 0x58, 0x58, 0x4f, 0x4f,
+    0x80, 0x5f, 0x80, 0x56, 0x05, 0x66, 0x60, 0x66, 0x60, 0x66, 0x6b, 0x80,
+    0x60, 0x82, 0x68, 0x02, 0x70, 0x6e, 0x6e, 0x81, 0x75, 0x01, 0x73, 0x7d,
+    0x80, 0x77, 0x04, 0x85, 0x85, 0x83, 0x87, 0x87, 0x80, 0x8a, 0x06, 0x93,
+    0x93, 0x9e, 0x9e, 0xaa, 0xaa, 0xb8, 0x80, 0xc2, 0x09, 0xc9, 0xce, 0xc2,
+    0xbd, 0xb4, 0x9f, 0x71, 0x2d, 0x0b, 0x0a, 0x81, 0x0b, 0x05, 0x1e, 0x5a,
+    0xb5, 0xed, 0xed, 0xde, 0x82, 0xc0, 0x0c, 0xcf, 0xde, 0xdb, 0xdb, 0xca,
+    0xca, 0xb6, 0xb3, 0x99, 0x6f, 0x53, 0x4b, 0x4b, 0x81, 0x3f, 0x11, 0x5c,
+    0x79, 0x53, 0x6f, 0x8e, 0x9d, 0x79, 0x79, 0x5c, 0x53, 0x6f, 0xa2, 0xa8,
+    0xb6, 0xbb, 0xad, 0x9d, 0x8e, 0x80, 0x79, 0x04, 0x6f, 0xbe, 0xb6, 0xa8,
+    0x79, 0x83, 0x6f, 0x25, 0x5c, 0xa8, 0x32, 0x3f, 0x36, 0x32, 0x24, 0x1c,
+    0x34, 0x3f, 0x1c, 0x24, 0x1e, 0x11, 0x11, 0x1c, 0x36, 0x57, 0x8e, 0x5c,
+    0x26, 0x1c, 0x29, 0x79, 0xbe, 0xd6, 0xe0, 0xd6, 0xd2, 0xdc, 0xe9, 0xdb,
+    0xd2, 0x6a, 0x4b, 0x8e, 0xb6, 0xbb, 0x80, 0xca, 0x1b, 0xdf, 0xe9, 0xe9,
+    0xdb, 0xdb, 0xca, 0xb6, 0x84, 0x84, 0x99, 0xb5, 0xb5, 0xde, 0xed, 0xee,
+    0xee, 0xc7, 0x6a, 0x23, 0x23, 0x18, 0x2d, 0x41, 0x4d, 0x55, 0x4e, 0x43,
+    0x4e, 0x80, 0x58, 0x80, 0x4d, 0x84, 0x58, 0x04, 0x5f, 0x58, 0x58, 0x56,
+    0x51, 0x82, 0x58, 0x02, 0x4f, 0x58, 0x5f, 0x81, 0x0f, 0x03, 0x04, 0x04,
+    0x02, 0x06, 0x81, 0x00, 0x80, 0x06, 0x03, 0x00, 0x00, 0x06, 0x06, 0x81,
+    0x0f, 0x80, 0x05, 0x80, 0x0f, 0x01, 0x02, 0x06, 0x80, 0x0f, 0x03, 0x06,
+    0x01, 0x01, 0x00, 0x80, 0x01, 0x0d, 0x03, 0x01, 0x03, 0x06, 0x06, 0x01,
+    0x01, 0x03, 0x01, 0x03, 0x06, 0x06, 0x0f, 0x0f, 0x82, 0x10, 0x0a, 0x07,
+    0x0f, 0x06, 0x06, 0x01, 0x00, 0x01, 0x03, 0x01, 0x06, 0x1f, 0x83, 0x2a,
+    0x01, 0x2c, 0x2e, 0x80, 0x2a, 0x06, 0x2e, 0x33, 0x35, 0x35, 0x42, 0x42,
+    0x3e, 0x80, 0x44, 0x07, 0x48, 0x4e, 0x4e, 0x51, 0x51, 0x58, 0x58, 0x4f,
+    0x81, 0x5f, 0x01, 0x56, 0x56, 0x85, 0x60, 0x80, 0x68, 0x00, 0x71, 0x82,
+    0x6e, 0x04, 0x77, 0x77, 0x7d, 0x77, 0x77, 0x81, 0x7e, 0x80, 0x83, 0x02,
+    0x91, 0x8c, 0x8c, 0x80, 0x93, 0x07, 0x9e, 0x9e, 0xaa, 0xae, 0xb8, 0xb8,
+    0xc2, 0xc2, 0x80, 0xc9, 0x06, 0xc2, 0xb8, 0xae, 0x95, 0x67, 0x2d, 0x0a,
+    0x81, 0x0b, 0x09, 0x12, 0x5a, 0xb5, 0xde, 0xe8, 0xde, 0xb3, 0x9a, 0x7c,
+    0x7c, 0x80, 0x6a, 0x2b, 0xb3, 0xdb, 0xdb, 0xca, 0xca, 0xb3, 0x99, 0x84,
+    0x5c, 0x5c, 0x53, 0x53, 0x4b, 0x4b, 0x53, 0x53, 0x6f, 0xb3, 0xb6, 0xca,
+    0xca, 0xb6, 0x9d, 0x79, 0x79, 0x99, 0xcf, 0xe8, 0xe6, 0xdb, 0xca, 0xca,
+    0xb6, 0xa8, 0x8e, 0x8e, 0xa8, 0x8e, 0x6f, 0xb6, 0xdc, 0xca, 0xa8, 0x8e,
+    0x83, 0x79, 0x39, 0xb6, 0x4b, 0x5c, 0x5c, 0x3f, 0x29, 0x24, 0x29, 0x5c,
+    0x32, 0x29, 0x1c, 0x1e, 0x1e, 0x1c, 0x3f, 0x8e, 0xb6, 0x6f, 0x26, 0x24,
+    0x1c, 0x32, 0x79, 0xbb, 0xc6, 0xdc, 0xe4, 0xdf, 0xd2, 0xb6, 0x8e, 0xa8,
+    0xa2, 0x79, 0xa8, 0xb6, 0xb6, 0xbb, 0xc6, 0xd2, 0xd2, 0xca, 0xc0, 0xc0,
+    0xb6, 0xb3, 0xb3, 0xc0, 0xc0, 0xdb, 0xdb, 0xed, 0xed, 0xee, 0xcf, 0x99,
+    0x34, 0x80, 0x18, 0x06, 0x23, 0x38, 0x47, 0x55, 0x5d, 0x4f, 0x4f, 0x80,
+    0x58, 0x80, 0x51, 0x85, 0x58, 0x03, 0x56, 0x56, 0x4f, 0x58, 0x81, 0x5f,
+    0x03, 0x58, 0x58, 0x5f, 0x5f, 0x81, 0x02, 0x03, 0x01, 0x01, 0x00, 0x06,
+    0x80, 0x00, 0x80, 0x06, 0x01, 0x03, 0x01, 0x81, 0x06, 0x01, 0x0f, 0x0f,
+    0x84, 0x06, 0x00, 0x02, 0x81, 0x01, 0x04, 0x00, 0x01, 0x01, 0x03, 0x03,
+    0x80, 0x06, 0x85, 0x01, 0x03, 0x06, 0x06, 0x0f, 0x07, 0x83, 0x10, 0x0a,
+    0x0f, 0x0f, 0x06, 0x06, 0x03, 0x01, 0x03, 0x01, 0x01, 0x06, 0x10, 0x80,
+    0x27, 0x00, 0x2a, 0x85, 0x25, 0x03, 0x2a, 0x2f, 0x37, 0x35, 0x80, 0x42,
+    0x09, 0x44, 0x44, 0x48, 0x4e, 0x4e, 0x51, 0x58, 0x58, 0x4f, 0x4f, 0x80,
+    0x5f, 0x00, 0x66, 0x82, 0x60, 0x01, 0x6b, 0x6b, 0x82, 0x68, 0x82, 0x6e,
+    0x02, 0x7d, 0x77, 0x77, 0x81, 0x7e, 0x0d, 0x82, 0x83, 0x83, 0x8a, 0x8a,
+    0x8c, 0x8c, 0x93, 0x93, 0x9f, 0x9e, 0x9e, 0xaa, 0xaa, 0x80, 0xb8, 0x26,
+    0xc2, 0xc5, 0xce, 0xd5, 0xc9, 0xc2, 0xb8, 0xaf, 0xa7, 0x87, 0x54, 0x22,
+    0x18, 0x0a, 0x0c, 0x0c, 0x0b, 0x0b, 0x26, 0x9a, 0xc0, 0xd9, 0xd9, 0xba,
+    0x99, 0x9a, 0x9a, 0x7c, 0x7c, 0x6a, 0x7c, 0xdb, 0xdb, 0xca, 0xb6, 0xb3,
+    0x99, 0x6f, 0x6f, 0x82, 0x5c, 0x03, 0x6f, 0x6f, 0x99, 0xcf, 0x80, 0xdb,
+    0x04, 0xca, 0xb6, 0xa8, 0xa8, 0xcf, 0x80, 0xed, 0x0f, 0xe6, 0xdb, 0xca,
+    0xbb, 0xb6, 0xb6, 0xa8, 0xb6, 0xb6, 0xa2, 0x5c, 0x7c, 0xd2, 0xdb, 0xca,
+    0xb3, 0x82, 0x8e, 0x0c, 0xa8, 0xbb, 0x99, 0x79, 0x6f, 0x4b, 0x32, 0x29,
+    0x32, 0x57, 0x36, 0x32, 0x29, 0x80, 0x1c, 0x17, 0x29, 0x6f, 0x84, 0x3f,
+    0x29, 0x24, 0x29, 0x29, 0x4b, 0x6f, 0x8e, 0xb6, 0xa8, 0x99, 0x84, 0x6f,
+    0x6f, 0x8e, 0xa8, 0xa8, 0x8e, 0x8e, 0x53, 0x5a, 0x81, 0x7c, 0x02, 0x84,
+    0xa8, 0xb6, 0x80, 0xca, 0x80, 0xdb, 0x0f, 0xde, 0xcf, 0xc0, 0xb5, 0x6a,
+    0x1e, 0x0b, 0x18, 0x18, 0x23, 0x2d, 0x38, 0x3a, 0x47, 0x4d, 0x4f, 0x81,
+    0x58, 0x03, 0x4f, 0x4f, 0x51, 0x51, 0x81, 0x58, 0x01, 0x4f, 0x58, 0x82,
+    0x5f, 0x80, 0x58, 0x09, 0x5f, 0x5f, 0x56, 0x56, 0x06, 0x00, 0x01, 0x01,
+    0x00, 0x00, 0x8f, 0x06, 0x84, 0x01, 0x03, 0x00, 0x01, 0x00, 0x03, 0x84,
+    0x06, 0x05, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x81, 0x06, 0x05, 0x07,
+    0x10, 0x0d, 0x0d, 0x15, 0x15, 0x80, 0x10, 0x00, 0x0f, 0x80, 0x06, 0x0d,
+    0x03, 0x01, 0x00, 0x01, 0x03, 0x02, 0x21, 0x2a, 0x27, 0x2e, 0x2a, 0x27,
+    0x25, 0x27, 0x82, 0x25, 0x12, 0x2b, 0x2f, 0x2f, 0x37, 0x35, 0x42, 0x3e,
+    0x44, 0x44, 0x40, 0x4e, 0x51, 0x51, 0x58, 0x56, 0x4f, 0x5f, 0x66, 0x56,
+    0x81, 0x60, 0x82, 0x68, 0x82, 0x6e, 0x02, 0x77, 0x73, 0x77, 0x80, 0x7e,
+    0x80, 0x83, 0x00, 0x87, 0x80, 0x8a, 0x03, 0x8c, 0x95, 0x9b, 0x93, 0x80,
+    0x9e, 0x80, 0xaa, 0x00, 0xb8, 0x80, 0xc2, 0x00, 0xc9, 0x80, 0xd5, 0x0a,
+    0xc2, 0xb8, 0xae, 0x9e, 0x95, 0x87, 0x67, 0x2d, 0x0a, 0x13, 0x0c, 0x81,
+    0x0b, 0x13, 0x19, 0x39, 0x5a, 0x9a, 0xdb, 0xd9, 0xde, 0xd9, 0xc0, 0xc0,
+    0xb3, 0x9a, 0x99, 0xca, 0xca, 0xc0, 0xc0, 0xb3, 0x99, 0x99, 0x80, 0x84,
+    0x34, 0x99, 0x8e, 0x99, 0x84, 0xb3, 0xde, 0xe8, 0xe6, 0xe6, 0xdb, 0xdb,
+    0xca, 0xca, 0xdc, 0xf1, 0xed, 0xe8, 0xe6, 0xdb, 0xdb, 0xca, 0xbb, 0xb6,
+    0x9d, 0xa8, 0xbe, 0xb6, 0x79, 0x53, 0x5c, 0xb3, 0xca, 0xb6, 0xb3, 0x99,
+    0x8e, 0x84, 0xa8, 0xa8, 0xbb, 0xc6, 0xb6, 0x79, 0x79, 0x5c, 0x4b, 0x32,
+    0x3f, 0x79, 0x57, 0x36, 0x3f, 0x1c, 0x80, 0x24, 0x33, 0x32, 0x29, 0x29,
+    0x3f, 0x3f, 0x32, 0x3f, 0x4b, 0x5c, 0x79, 0x8e, 0x79, 0x4b, 0x3f, 0x5c,
+    0x6f, 0x79, 0x99, 0xb6, 0xb6, 0x8e, 0x6a, 0x03, 0x00, 0x04, 0x0a, 0x19,
+    0x26, 0x39, 0x5a, 0x7c, 0x9a, 0x9a, 0xb5, 0xc0, 0x9a, 0x5a, 0x39, 0x34,
+    0x39, 0x1e, 0x0a, 0x0b, 0x0a, 0x18, 0x22, 0x2d, 0x2d, 0x23, 0x22, 0x3a,
+    0x4d, 0x81, 0x58, 0x00, 0x56, 0x86, 0x58, 0x82, 0x5f, 0x06, 0x58, 0x58,
+    0x5f, 0x56, 0x5f, 0x5f, 0x58, 0x84, 0x01, 0x07, 0x06, 0x01, 0x01, 0x06,
+    0x02, 0x06, 0x02, 0x02, 0x80, 0x06, 0x02, 0x0f, 0x0f, 0x07, 0x80, 0x0f,
+    0x03, 0x05, 0x05, 0x07, 0x0f, 0x80, 0x02, 0x05, 0x06, 0x01, 0x00, 0x03,
+    0x06, 0x06, 0x84, 0x01, 0x05, 0x03, 0x00, 0x01, 0x01, 0x06, 0x06, 0x80,
+    0x0f, 0x00, 0x10, 0x81, 0x15, 0x0f, 0x1d, 0x10, 0x10, 0x0f, 0x0f, 0x06,
+    0x02, 0x03, 0x03, 0x00, 0x01, 0x01, 0x06, 0x10, 0x27, 0x27, 0x80, 0x25,
+    0x01, 0x27, 0x27, 0x80, 0x25, 0x12, 0x27, 0x25, 0x2a, 0x2a, 0x2b, 0x2f,
+    0x2f, 0x35, 0x42, 0x42, 0x40, 0x44, 0x4e, 0x4e, 0x51, 0x58, 0x56, 0x5f,
+    0x56, 0x81, 0x60, 0x01, 0x68, 0x68, 0x82, 0x6e, 0x02, 0x7a, 0x77, 0x77,
+    0x80, 0x7e, 0x81, 0x83, 0x0b, 0x80, 0x8c, 0x91, 0x8c, 0x95, 0x93, 0x93,
+    0x9b, 0x93, 0xa7, 0xa7, 0x9e, 0x80, 0xaa, 0x05, 0xb8, 0xc2, 0xc2, 0xc9,
+    0xce, 0xd5, 0x80, 0xe2, 0x09, 0xc9, 0xb8, 0xb8, 0xae, 0x9e, 0x95, 0x82,
+    0x5b, 0x2d, 0x18, 0x81, 0x0a, 0x02, 0x0b, 0x0b, 0x04, 0x80, 0x0b, 0x10,
+    0x19, 0x5a, 0xc0, 0xca, 0xca, 0xc0, 0xb3, 0xb3, 0x9a, 0x7c, 0x7c, 0xb6,
+    0xca, 0xca, 0xc0, 0xb6, 0xb3, 0x80, 0xa8, 0x0a, 0xb6, 0xb6, 0xdb, 0xdb,
+    0xe6, 0xe6, 0xf1, 0xe6, 0xe8, 0xdb, 0xdb, 0x80, 0xca, 0x00, 0xdb, 0x80,
+    0xe6, 0x22, 0xdc, 0xdb, 0xbe, 0xb6, 0x9d, 0x79, 0xb6, 0xd2, 0xb6, 0x79,
+    0x6f, 0x6f, 0x79, 0xb6, 0x8e, 0x8e, 0x79, 0x79, 0xa8, 0xb6, 0xc0, 0xbe,
+    0xbb, 0x53, 0x8e, 0x9d, 0x6f, 0x5c, 0x3f, 0x4b, 0x8e, 0x8e, 0x57, 0x5c,
+    0x34, 0x82, 0x29, 0x1d, 0x34, 0x32, 0x53, 0x5c, 0x53, 0x5c, 0x5c, 0x79,
+    0xa8, 0xa8, 0xb3, 0x6f, 0x53, 0x5c, 0x79, 0x99, 0xa8, 0xca, 0xb3, 0x84,
+    0x0a, 0x01, 0x00, 0x00, 0x01, 0x01, 0x02, 0x0c, 0x12, 0x12, 0x80, 0x19,
+    0x00, 0x12, 0x80, 0x04, 0x06, 0x0c, 0x0c, 0x0b, 0x0b, 0x0c, 0x18, 0x18,
+    0x81, 0x23, 0x01, 0x22, 0x47, 0x80, 0x4f, 0x00, 0x5f, 0x80, 0x58, 0x01,
+    0x5f, 0x58, 0x80, 0x5f, 0x00, 0x56, 0x86, 0x5f, 0x00, 0x56, 0x80, 0x5f,
+    0x00, 0x03, 0x80, 0x01, 0x80, 0x03, 0x0c, 0x06, 0x02, 0x02, 0x06, 0x10,
+    0x15, 0x1a, 0x21, 0x2a, 0x2f, 0x41, 0x42, 0x49, 0x80, 0x55, 0x0d, 0x51,
+    0x55, 0x55, 0x51, 0x4e, 0x49, 0x35, 0x2c, 0x1f, 0x1f, 0x17, 0x17, 0x10,
+    0x0f, 0x80, 0x02, 0x16, 0x06, 0x03, 0x01, 0x03, 0x03, 0x01, 0x01, 0x06,
+    0x06, 0x0f, 0x0f, 0x07, 0x10, 0x0d, 0x1d, 0x15, 0x15, 0x1d, 0x1d, 0x17,
+    0x10, 0x0f, 0x0f, 0x80, 0x06, 0x00, 0x03, 0x80, 0x00, 0x1f, 0x01, 0x06,
+    0x1d, 0x2e, 0x21, 0x21, 0x25, 0x25, 0x27, 0x27, 0x21, 0x21, 0x27, 0x25,
+    0x25, 0x2a, 0x2a, 0x2e, 0x2a, 0x2a, 0x2f, 0x30, 0x35, 0x42, 0x44, 0x48,
+    0x46, 0x58, 0x5f, 0x56, 0x56, 0x60, 0x80, 0x68, 0x80, 0x6e, 0x01, 0x7d,
+    0x77, 0x80, 0x7e, 0x80, 0x83, 0x06, 0x8a, 0x8a, 0x80, 0x8a, 0x8c, 0x93,
+    0x93, 0x80, 0x9b, 0x83, 0x9e, 0x08, 0xb8, 0xae, 0xb8, 0xc2, 0xc9, 0xc9,
+    0xd5, 0xd5, 0xe2, 0x80, 0xe7, 0x0c, 0xd5, 0xc2, 0xb8, 0xae, 0xac, 0x9f,
+    0x91, 0x82, 0x50, 0x22, 0x18, 0x12, 0x12, 0x80, 0x0a, 0x01, 0x04, 0x0b,
+    0x82, 0x04, 0x01, 0x0b, 0x1e, 0x80, 0x5a, 0x1c, 0x34, 0x39, 0x1e, 0x12,
+    0x04, 0x34, 0xb6, 0xc0, 0xb6, 0xb3, 0xa8, 0x99, 0x99, 0x79, 0x8e, 0x8e,
+    0xb6, 0xdb, 0xdb, 0xd9, 0xe6, 0xdb, 0xdb, 0xde, 0xde, 0xcf, 0xb6, 0xa8,
+    0xa8, 0x81, 0xca, 0x08, 0xb6, 0x9d, 0x79, 0x32, 0x32, 0x99, 0xdc, 0xdb,
+    0xb6, 0x80, 0x79, 0x30, 0x6f, 0x79, 0x8e, 0x8d, 0x8e, 0x8e, 0x9d, 0xad,
+    0x9d, 0x32, 0x24, 0x9d, 0xb6, 0x8e, 0x6f, 0x53, 0x4b, 0x9d, 0xa8, 0x79,
+    0x79, 0x32, 0x32, 0x3f, 0x3f, 0x32, 0x3f, 0x32, 0x32, 0x4b, 0x6f, 0x79,
+    0x6f, 0x6f, 0x79, 0xa8, 0xb6, 0xc0, 0xca, 0x99, 0x5c, 0x79, 0xa8, 0xa8,
+    0xb6, 0xca, 0xb3, 0x34, 0x03, 0x81, 0x00, 0x01, 0x04, 0x00, 0x86, 0x04,
+    0x81, 0x0c, 0x03, 0x0b, 0x0a, 0x18, 0x18, 0x81, 0x23, 0x08, 0x3a, 0x4f,
+    0x56, 0x5f, 0x5f, 0x56, 0x56, 0x58, 0x58, 0x82, 0x5f, 0x82, 0x56, 0x32,
+    0x5f, 0x66, 0x5f, 0x5f, 0x56, 0x56, 0x5f, 0x66, 0x01, 0x03, 0x00, 0x06,
+    0x06, 0x07, 0x10, 0x15, 0x27, 0x2a, 0x30, 0x42, 0x49, 0x4d, 0x51, 0x58,
+    0x63, 0x64, 0x64, 0x71, 0x7a, 0x7a, 0x82, 0x86, 0x86, 0x82, 0x87, 0x86,
+    0x86, 0x7f, 0x7f, 0x71, 0x6c, 0x5b, 0x4d, 0x47, 0x41, 0x31, 0x2c, 0x1f,
+    0x17, 0x10, 0x0f, 0x80, 0x06, 0x07, 0x01, 0x06, 0x06, 0x0f, 0x07, 0x10,
+    0x10, 0x15, 0x82, 0x1d, 0x08, 0x15, 0x10, 0x07, 0x0f, 0x06, 0x06, 0x0f,
+    0x06, 0x01, 0x80, 0x00, 0x05, 0x01, 0x0f, 0x21, 0x27, 0x21, 0x21, 0x80,
+    0x27, 0x81, 0x21, 0x01, 0x27, 0x25, 0x84, 0x2a, 0x09, 0x2f, 0x35, 0x35,
+    0x42, 0x44, 0x51, 0x56, 0x66, 0x68, 0x68, 0x80, 0x6e, 0x05, 0x77, 0x7e,
+    0x7e, 0x83, 0x83, 0x80, 0x80, 0x8a, 0x80, 0x93, 0x00, 0x9f, 0x81, 0x9e,
+    0x01, 0xa7, 0x9e, 0x80, 0xaa, 0x80, 0xb8, 0x02, 0xc2, 0xc9, 0xc9, 0x80,
+    0xd5, 0x83, 0xe7, 0x0f, 0xd5, 0xc2, 0xb8, 0xae, 0xa7, 0x95, 0x87, 0x82,
+    0x67, 0x2d, 0x12, 0x12, 0x0a, 0x12, 0x0a, 0x0b, 0x83, 0x04, 0x83, 0x00,
+    0x00, 0x01, 0x80, 0x00, 0x05, 0x01, 0x00, 0x03, 0x11, 0x5a, 0x7c, 0x80,
+    0x6f, 0x40, 0x5c, 0x6a, 0x4b, 0x4b, 0x6a, 0x84, 0x99, 0x9a, 0xc8, 0xd9,
+    0xca, 0xca, 0xc0, 0xb6, 0xa8, 0x79, 0x79, 0xa2, 0xa8, 0xa8, 0x8e, 0x5c,
+    0x29, 0x1c, 0x1c, 0x79, 0x79, 0xca, 0xca, 0xb3, 0x99, 0xb3, 0xb6, 0x99,
+    0x5c, 0x4b, 0x5c, 0x8e, 0x9d, 0x8e, 0x6f, 0x79, 0x24, 0x1c, 0x9d, 0xbe,
+    0xca, 0x8e, 0x5c, 0x4b, 0x8e, 0xad, 0x9d, 0x9d, 0x5c, 0x4b, 0x53, 0x53,
+    0x4b, 0x4b, 0x53, 0x3f, 0x4b, 0x6f, 0x8e, 0x80, 0x79, 0x0e, 0x8e, 0xa8,
+    0xca, 0xd2, 0xdc, 0xb3, 0x84, 0x8e, 0xb6, 0xb6, 0xca, 0xca, 0x9a, 0x00,
+    0x01, 0x81, 0x00, 0x87, 0x04, 0x83, 0x0c, 0x08, 0x0b, 0x18, 0x18, 0x19,
+    0x23, 0x23, 0x2d, 0x47, 0x58, 0x81, 0x5f, 0x00, 0x56, 0x85, 0x5f, 0x1a,
+    0x56, 0x60, 0x56, 0x66, 0x5f, 0x66, 0x66, 0x5f, 0x56, 0x60, 0x5f, 0x06,
+    0x07, 0x15, 0x1d, 0x27, 0x37, 0x47, 0x4d, 0x59, 0x71, 0x82, 0xa4, 0xac,
+    0xb4, 0xbd, 0xc5, 0x87, 0xd5, 0x00, 0xe2, 0x82, 0xd5, 0x0f, 0xe2, 0xe2,
+    0xd5, 0xd5, 0xce, 0xc5, 0xb7, 0xac, 0xa4, 0x7f, 0x61, 0x47, 0x31, 0x1f,
+    0x17, 0x10, 0x80, 0x0f, 0x03, 0x10, 0x10, 0x15, 0x15, 0x82, 0x1d, 0x02,
+    0x10, 0x07, 0x0f, 0x81, 0x06, 0x0c, 0x03, 0x01, 0x01, 0x00, 0x01, 0x06,
+    0x17, 0x21, 0x21, 0x1d, 0x21, 0x27, 0x27, 0x82, 0x21, 0x01, 0x27, 0x25,
+    0x81, 0x2a, 0x01, 0x2f, 0x2e, 0x81, 0x2a, 0x04, 0x2f, 0x35, 0x42, 0x51,
+    0x66, 0x80, 0x6e, 0x01, 0x7e, 0x87, 0x80, 0x8a, 0x80, 0x93, 0x04, 0x9e,
+    0xa7, 0x9e, 0x9e, 0xaf, 0x80, 0xaa, 0x80, 0xb8, 0x80, 0xc2, 0x06, 0xc9,
+    0xc9, 0xd3, 0xd5, 0xd5, 0xe2, 0xe2, 0x84, 0xe7, 0x0d, 0xe2, 0xce, 0xc2,
+    0xb4, 0xa7, 0x9b, 0x91, 0x82, 0x7a, 0x64, 0x50, 0x3a, 0x22, 0x18, 0x80,
+    0x0a, 0x00, 0x0c, 0x82, 0x04, 0x87, 0x00, 0x26, 0x01, 0x01, 0x00, 0x00,
+    0x03, 0x00, 0x26, 0x39, 0x34, 0x3f, 0x5a, 0x34, 0x5a, 0x9a, 0x34, 0x26,
+    0x5a, 0x6a, 0x5a, 0x9a, 0xc0, 0xc0, 0xb3, 0xa8, 0x79, 0x6f, 0x6f, 0x5c,
+    0x4b, 0x3f, 0x32, 0x1c, 0x1c, 0x24, 0x6f, 0x8e, 0x8e, 0xb6, 0xb6, 0x80,
+    0xc0, 0x17, 0xdb, 0xdb, 0xb6, 0x84, 0x79, 0x9d, 0x9d, 0x5c, 0x6f, 0x6f,
+    0x24, 0x24, 0x99, 0xd2, 0xdb, 0xcf, 0x79, 0x53, 0x6f, 0xb6, 0xb6, 0xbe,
+    0x9d, 0x5c, 0x80, 0x6f, 0x1a, 0x5c, 0x6f, 0x5c, 0x53, 0x6f, 0x8e, 0xa8,
+    0x6f, 0x8e, 0x8e, 0xa8, 0xb6, 0xca, 0xdb, 0xe6, 0xcf, 0xb3, 0xb6, 0xbb,
+    0xd2, 0xca, 0xdb, 0x39, 0x01, 0x00, 0x00, 0x04, 0x80, 0x00, 0x89, 0x04,
+    0x81, 0x0c, 0x0a, 0x13, 0x18, 0x22, 0x38, 0x3a, 0x47, 0x46, 0x4f, 0x5f,
+    0x66, 0x56, 0x82, 0x66, 0x00, 0x56, 0x80, 0x66, 0x01, 0x60, 0x60, 0x81,
+    0x66, 0x0d, 0x5f, 0x5f, 0x6b, 0x66, 0x66, 0x2c, 0x3a, 0x5b, 0x7f, 0x86,
+    0xac, 0xbd, 0xc5, 0xce, 0x82, 0xd5, 0x81, 0xce, 0x81, 0xc5, 0x00, 0xc2,
+    0x85, 0xc5, 0x82, 0xce, 0x84, 0xd5, 0x0b, 0xce, 0xc5, 0xb4, 0x94, 0x69,
+    0x47, 0x2c, 0x15, 0x07, 0x0f, 0x07, 0x10, 0x82, 0x1d, 0x03, 0x17, 0x10,
+    0x0f, 0x0f, 0x82, 0x06, 0x0d, 0x01, 0x00, 0x00, 0x01, 0x06, 0x14, 0x20,
+    0x1f, 0x1d, 0x21, 0x27, 0x25, 0x21, 0x1f, 0x80, 0x21, 0x1d, 0x25, 0x2a,
+    0x2a, 0x25, 0x2a, 0x2a, 0x2f, 0x2f, 0x2a, 0x2a, 0x2c, 0x25, 0x2a, 0x2f,
+    0x35, 0x48, 0x56, 0x68, 0x77, 0x87, 0x91, 0x95, 0x9b, 0x93, 0x9e, 0x9e,
+    0xaa, 0xaa, 0xb4, 0xae, 0x80, 0xb8, 0x01, 0xc2, 0xc2, 0x80, 0xc9, 0x80,
+    0xd5, 0x82, 0xe2, 0x82, 0xe7, 0x80, 0xe2, 0x11, 0xd5, 0xc2, 0xb8, 0xae,
+    0xa7, 0x95, 0x87, 0x7a, 0x71, 0x64, 0x5d, 0x47, 0x31, 0x18, 0x0a, 0x0a,
+    0x0b, 0x0b, 0x82, 0x04, 0x8c, 0x00, 0x3f, 0x01, 0x1e, 0x39, 0x26, 0x26,
+    0x39, 0x26, 0x26, 0x7c, 0xc0, 0x6a, 0x3f, 0x7c, 0x7c, 0x5a, 0x7c, 0xb5,
+    0x99, 0x9a, 0x84, 0x8e, 0x79, 0x5c, 0x4b, 0x32, 0x29, 0x34, 0x34, 0x6a,
+    0x9a, 0xb6, 0xa8, 0x6f, 0x99, 0xb6, 0xb3, 0xa8, 0xb6, 0xc0, 0xca, 0xca,
+    0xb6, 0xa8, 0x8e, 0x6f, 0x53, 0x79, 0x5c, 0x24, 0x24, 0x7c, 0xdc, 0xe9,
+    0xe6, 0xc0, 0x6f, 0x5c, 0xb3, 0xbb, 0xc6, 0xbe, 0x84, 0x84, 0xa2, 0x80,
+    0x84, 0x15, 0x6f, 0x5c, 0x84, 0xa8, 0xa8, 0x6f, 0x7c, 0xa8, 0xa8, 0xb6,
+    0xbb, 0xd2, 0xdb, 0xe6, 0xe6, 0xdb, 0xca, 0xca, 0xc0, 0xe9, 0xb5, 0x19,
+    0x83, 0x00, 0x01, 0x04, 0x00, 0x87, 0x04, 0x81, 0x0c, 0x0a, 0x13, 0x18,
+    0x18, 0x22, 0x3a, 0x4d, 0x56, 0x4f, 0x5f, 0x66, 0x6b, 0x81, 0x66, 0x03,
+    0x60, 0x66, 0x60, 0x60, 0x89, 0x6b, 0x02, 0xb7, 0xc5, 0xc9, 0x80, 0xd5,
+    0x01, 0xce, 0xce, 0x80, 0xc5, 0x02, 0xb8, 0xbd, 0xb8, 0x82, 0xbd, 0x81,
+    0xb4, 0x05, 0xae, 0xb8, 0xae, 0xb4, 0xb8, 0xb8, 0x81, 0xbd, 0x02, 0xb8,
+    0xb8, 0xbd, 0x80, 0xc2, 0x00, 0xc5, 0x81, 0xce, 0x80, 0xd5, 0x10, 0xce,
+    0xc5, 0xb7, 0x7f, 0x3a, 0x17, 0x01, 0x01, 0x0f, 0x10, 0x0d, 0x15, 0x1d,
+    0x15, 0x10, 0x10, 0x0f, 0x80, 0x06, 0x02, 0x02, 0x06, 0x03, 0x80, 0x00,
+    0x13, 0x06, 0x06, 0x0f, 0x20, 0x1f, 0x1d, 0x21, 0x27, 0x21, 0x1f, 0x1f,
+    0x1d, 0x21, 0x21, 0x27, 0x25, 0x25, 0x27, 0x25, 0x2a, 0x80, 0x2f, 0x10,
+    0x2c, 0x2a, 0x25, 0x2a, 0x3b, 0x56, 0x6e, 0x87, 0x9b, 0xa7, 0xa6, 0xaa,
+    0xae, 0xb8, 0xb8, 0xc2, 0xc2, 0x81, 0xc9, 0x80, 0xd5, 0x80, 0xe2, 0x8e,
+    0xe7, 0x11, 0xd5, 0xc2, 0xa6, 0x93, 0x87, 0x82, 0x71, 0x64, 0x59, 0x59,
+    0x43, 0x31, 0x13, 0x0b, 0x18, 0x0b, 0x0c, 0x0c, 0x81, 0x04, 0x8c, 0x00,
+    0x0a, 0x03, 0x26, 0x98, 0x5a, 0x26, 0x1e, 0x1e, 0x11, 0x26, 0x9a, 0xb5,
+    0x80, 0x84, 0x16, 0x6f, 0x7c, 0x6a, 0x7c, 0x7c, 0x53, 0xb6, 0xa8, 0x6f,
+    0x53, 0x3f, 0x32, 0x32, 0x29, 0x6a, 0xed, 0xe9, 0xc6, 0x8e, 0x32, 0x3f,
+    0xb6, 0xc0, 0x82, 0xa8, 0x22, 0x8e, 0x6f, 0x5c, 0x3f, 0x5c, 0x8e, 0x4b,
+    0x29, 0x24, 0x3f, 0xca, 0xe4, 0xe6, 0xe6, 0xa8, 0x84, 0xca, 0xa8, 0xa8,
+    0xc6, 0x84, 0xa8, 0xb6, 0xa8, 0x99, 0x8e, 0x84, 0x84, 0x79, 0xa8, 0xb6,
+    0x79, 0x26, 0x7c, 0xb6, 0x80, 0xca, 0x0a, 0xdb, 0xe9, 0xe6, 0xdb, 0xca,
+    0xb6, 0xb6, 0xca, 0xdc, 0x9a, 0x0b, 0x85, 0x00, 0x85, 0x04, 0x01, 0x0c,
+    0x04, 0x81, 0x0c, 0x00, 0x0a, 0x80, 0x18, 0x02, 0x2d, 0x59, 0x60, 0x80,
+    0x66, 0x04, 0x56, 0x66, 0x66, 0x60, 0x68, 0x84, 0x6b, 0x10, 0x70, 0x68,
+    0x68, 0x70, 0x6b, 0x68, 0x60, 0x6b, 0xce, 0xce, 0xc5, 0xc5, 0xc2, 0xb8,
+    0xbd, 0xb8, 0xae, 0x80, 0xb4, 0x80, 0xac, 0x04, 0xae, 0xa6, 0xa7, 0xac,
+    0xac, 0x80, 0xa7, 0x09, 0x9e, 0xa7, 0xac, 0xa7, 0xa7, 0xa6, 0xac, 0xac,
+    0xa7, 0xac, 0x81, 0xb4, 0x1b, 0xae, 0xb4, 0xbd, 0xb8, 0xb8, 0xae, 0xbd,
+    0xbd, 0xc2, 0xc5, 0xce, 0xce, 0xd5, 0xce, 0xc5, 0xb1, 0x94, 0x4a, 0x17,
+    0x06, 0x0f, 0x0f, 0x06, 0x0f, 0x10, 0x10, 0x0f, 0x02, 0x82, 0x06, 0x2d,
+    0x01, 0x00, 0x00, 0x01, 0x06, 0x06, 0x0f, 0x20, 0x1f, 0x15, 0x21, 0x27,
+    0x21, 0x1d, 0x15, 0x1f, 0x21, 0x21, 0x27, 0x25, 0x27, 0x25, 0x25, 0x2a,
+    0x30, 0x2f, 0x2f, 0x2a, 0x2a, 0x2f, 0x51, 0x68, 0x73, 0x83, 0x8a, 0x9b,
+    0xa7, 0xaa, 0xae, 0xb8, 0xc2, 0xc2, 0xc9, 0xd3, 0xd3, 0xd5, 0x80, 0xe2,
+    0x8e, 0xe7, 0x00, 0xe2, 0x80, 0xe7, 0x10, 0xe2, 0xc9, 0x93, 0x82, 0x7a,
+    0x64, 0x59, 0x4d, 0x4d, 0x47, 0x37, 0x20, 0x13, 0x13, 0x0c, 0x0c, 0x0b,
+    0x81, 0x04, 0x84, 0x00, 0x00, 0x01, 0x85, 0x00, 0x08, 0x01, 0x5a, 0xc8,
+    0xb5, 0x6a, 0x39, 0x26, 0x34, 0x7c, 0x80, 0xda, 0x4e, 0xb5, 0xb5, 0x99,
+    0x7c, 0x53, 0x4b, 0x3f, 0x32, 0x9a, 0xa8, 0x79, 0x5c, 0x53, 0x4b, 0x3f,
+    0x53, 0xc0, 0xed, 0xe8, 0xbb, 0x5c, 0x1c, 0x34, 0xa8, 0xc0, 0xb6, 0xb3,
+    0xb3, 0x99, 0x6f, 0x4b, 0x5c, 0x5c, 0x32, 0x5c, 0x9d, 0x3f, 0x29, 0x34,
+    0x34, 0x7c, 0xdc, 0xdc, 0xdb, 0xbb, 0xc0, 0xe6, 0x9a, 0x34, 0xc6, 0xb6,
+    0xb6, 0xca, 0xb6, 0xa8, 0xb3, 0xa8, 0x8e, 0xa8, 0xca, 0xb6, 0x4b, 0x1c,
+    0x0a, 0x3f, 0xa8, 0xc0, 0xca, 0xdb, 0xe9, 0xe8, 0xed, 0xe8, 0xdb, 0xdb,
+    0xca, 0xca, 0xdc, 0x9a, 0x86, 0x00, 0x87, 0x04, 0x80, 0x0c, 0x0f, 0x0b,
+    0x0a, 0x0a, 0x18, 0x2d, 0x55, 0x6b, 0x60, 0x68, 0x6b, 0x6b, 0x60, 0x60,
+    0x6e, 0x68, 0x68, 0x80, 0x75, 0x0a, 0x6e, 0x68, 0x70, 0x70, 0x75, 0x73,
+    0x75, 0x6e, 0x60, 0x60, 0x73, 0x80, 0xb8, 0x80, 0xb4, 0x00, 0xa6, 0x81,
+    0xa7, 0x06, 0x9f, 0x9f, 0xa7, 0x9f, 0x9f, 0x9b, 0x9f, 0x84, 0x9b, 0x05,
+    0x93, 0x9b, 0x9b, 0x9f, 0x9b, 0x9b, 0x81, 0x9f, 0x81, 0xa7, 0x06, 0xa6,
+    0xa6, 0xac, 0xa7, 0xa6, 0xac, 0xae, 0x80, 0xb8, 0x0f, 0xc2, 0xc2, 0xce,
+    0xce, 0xd5, 0xd5, 0xce, 0xab, 0x4a, 0x2c, 0x31, 0x1f, 0x02, 0x06, 0x06,
+    0x0f, 0x80, 0x06, 0x02, 0x02, 0x06, 0x01, 0x80, 0x00, 0x0e, 0x01, 0x06,
+    0x06, 0x0f, 0x1d, 0x15, 0x17, 0x1d, 0x21, 0x21, 0x1d, 0x15, 0x15, 0x1d,
+    0x21, 0x81, 0x27, 0x19, 0x25, 0x2a, 0x2a, 0x2f, 0x2f, 0x2b, 0x35, 0x46,
+    0x56, 0x68, 0x73, 0x7e, 0x83, 0x91, 0x93, 0x9e, 0xaa, 0xae, 0xb8, 0xc2,
+    0xc2, 0xc9, 0xc9, 0xd3, 0xd3, 0xd5, 0x83, 0xe2, 0x87, 0xe7, 0x00, 0xe2,
+    0x80, 0xe7, 0x10, 0xe2, 0xe2, 0xc2, 0x80, 0x71, 0x64, 0x59, 0x4d, 0x43,
+    0x47, 0x41, 0x31, 0x20, 0x13, 0x0a, 0x0b, 0x0c, 0x80, 0x04, 0x85, 0x00,
+    0x01, 0x01, 0x01, 0x85, 0x00, 0x04, 0x01, 0x19, 0x5a, 0x5a, 0x6a, 0x81,
+    0x5a, 0x35, 0xcf, 0xda, 0xee, 0xeb, 0xda, 0xc7, 0xb5, 0x84, 0x53, 0x24,
+    0x11, 0x34, 0xdb, 0x8e, 0x84, 0x6f, 0x5c, 0x5c, 0xa2, 0xdb, 0xe8, 0xde,
+    0x79, 0x29, 0x1c, 0x34, 0x99, 0xc0, 0xc0, 0xcf, 0xde, 0xde, 0x9a, 0x4b,
+    0x6f, 0x5c, 0x29, 0x79, 0x8e, 0x3f, 0x32, 0x29, 0x34, 0x32, 0x6f, 0xa8,
+    0xb6, 0xa2, 0xc0, 0xdc, 0x5a, 0x0c, 0x7c, 0xd2, 0x80, 0xdb, 0x19, 0xc0,
+    0xb6, 0xb6, 0xc0, 0xdc, 0xdc, 0x5c, 0x34, 0x32, 0x12, 0x03, 0x26, 0x7c,
+    0xb6, 0xca, 0xdb, 0xe6, 0xe6, 0xe9, 0xe9, 0xdb, 0xca, 0xca, 0xdb, 0xe6,
+    0x8b, 0x84, 0x00, 0x86, 0x04, 0x01, 0x0c, 0x04, 0x81, 0x0c, 0x0d, 0x0a,
+    0x18, 0x18, 0x38, 0x66, 0x6b, 0x70, 0x68, 0x75, 0x73, 0x6e, 0x75, 0x73,
+    0x75, 0x81, 0x6e, 0x0f, 0x7d, 0x73, 0x73, 0x7d, 0x85, 0x85, 0x7e, 0x77,
+    0x73, 0x7e, 0x7e, 0xb4, 0xaf, 0xac, 0xac, 0x9f, 0x82, 0x9b, 0x02, 0x9f,
+    0x95, 0x9f, 0x80, 0x95, 0x82, 0x91, 0x02, 0x8c, 0x91, 0x8c, 0x84, 0x91,
+    0x82, 0x95, 0x03, 0x93, 0x9b, 0x93, 0x9f, 0x82, 0x9b, 0x12, 0x9f, 0xa7,
+    0xa6, 0xae, 0xb4, 0xbd, 0xb8, 0xb8, 0xc2, 0xc2, 0xce, 0xd5, 0xd5, 0xc5,
+    0x94, 0x71, 0x54, 0x20, 0x0f, 0x82, 0x06, 0x04, 0x02, 0x06, 0x03, 0x01,
+    0x00, 0x81, 0x01, 0x06, 0x06, 0x15, 0x1d, 0x17, 0x1f, 0x21, 0x21, 0x80,
+    0x15, 0x06, 0x1f, 0x1f, 0x27, 0x27, 0x21, 0x21, 0x25, 0x80, 0x2a, 0x19,
+    0x2b, 0x2f, 0x3b, 0x46, 0x56, 0x60, 0x68, 0x6e, 0x77, 0x83, 0x8c, 0x93,
+    0x9e, 0x9e, 0xaa, 0xaa, 0xb8, 0xc2, 0xc2, 0xc9, 0xc9, 0xd3, 0xd3, 0xc9,
+    0xd3, 0xd5, 0x82, 0xe2, 0x01, 0xd5, 0xd5, 0x84, 0xe2, 0x10, 0xd3, 0xd5,
+    0xd3, 0x9e, 0x64, 0x59, 0x4d, 0x43, 0x43, 0x3b, 0x37, 0x31, 0x2c, 0x14,
+    0x0a, 0x0a, 0x0b, 0x80, 0x04, 0x85, 0x00, 0x01, 0x03, 0x01, 0x88, 0x00,
+    0x06, 0x0b, 0x19, 0x1e, 0x1e, 0x26, 0x26, 0x39, 0x80, 0xb5, 0x0e, 0xc7,
+    0xda, 0xc0, 0xb5, 0x9a, 0x84, 0x6f, 0x4b, 0x3f, 0xd2, 0xb3, 0xc0, 0xe8,
+    0xde, 0xb3, 0x80, 0xe8, 0x12, 0xa2, 0x32, 0x29, 0x29, 0x3f, 0x84, 0x9a,
+    0xb3, 0xc0, 0xcf, 0xde, 0xdb, 0x99, 0xa2, 0x53, 0x24, 0x8e, 0xa8, 0x4b,
+    0x81, 0x32, 0x1c, 0x53, 0x79, 0x6f, 0x99, 0xa8, 0xb6, 0x39, 0x06, 0x0c,
+    0x99, 0xca, 0xdb, 0xe6, 0xe6, 0xdb, 0xc0, 0xca, 0xdf, 0xbb, 0x34, 0x24,
+    0x32, 0x34, 0x01, 0x03, 0x03, 0x34, 0x7c, 0xb3, 0x81, 0xca, 0x06, 0xb6,
+    0x99, 0x9a, 0xc0, 0xee, 0xee, 0x39, 0x84, 0x00, 0x85, 0x04, 0x01, 0x0c,
+    0x04, 0x81, 0x0c, 0x07, 0x13, 0x13, 0x18, 0x2d, 0x64, 0x7d, 0x75, 0x73,
+    0x83, 0x7e, 0x05, 0x83, 0x77, 0x7e, 0x83, 0x83, 0x7e, 0x80, 0x83, 0x10,
+    0x8a, 0x83, 0x85, 0x96, 0x8a, 0x83, 0x9f, 0x9b, 0x9b, 0x95, 0x95, 0x91,
+    0x91, 0x8c, 0x95, 0x95, 0x91, 0x83, 0x87, 0x80, 0x82, 0x8a, 0x87, 0x05,
+    0x91, 0x87, 0x87, 0x80, 0x91, 0x91, 0x80, 0x95, 0x06, 0x93, 0x95, 0x93,
+    0x9b, 0x9b, 0x9f, 0x9f, 0x80, 0x9e, 0x80, 0xaa, 0x0c, 0xb8, 0xc2, 0xc2,
+    0xce, 0xe2, 0xe2, 0xb1, 0xab, 0x61, 0x2c, 0x10, 0x02, 0x01, 0x81, 0x06,
+    0x12, 0x03, 0x03, 0x00, 0x01, 0x01, 0x00, 0x01, 0x06, 0x07, 0x17, 0x17,
+    0x15, 0x21, 0x21, 0x1d, 0x17, 0x15, 0x15, 0x1d, 0x82, 0x21, 0x00, 0x27,
+    0x80, 0x2a, 0x14, 0x2f, 0x3b, 0x46, 0x58, 0x5f, 0x60, 0x68, 0x6e, 0x73,
+    0x7e, 0x91, 0x95, 0x93, 0x9e, 0x9e, 0xaa, 0xaa, 0xb8, 0xb8, 0xc2, 0xc2,
+    0x80, 0xc9, 0x02, 0xd3, 0xd3, 0xd5, 0x80, 0xd3, 0x02, 0xd5, 0xd3, 0xd5,
+    0x83, 0xd3, 0x0b, 0xc9, 0xb8, 0x7a, 0x4d, 0x49, 0x49, 0x41, 0x41, 0x37,
+    0x2f, 0x2c, 0x20, 0x80, 0x0c, 0x01, 0x04, 0x04, 0x86, 0x00, 0x01, 0x01,
+    0x01, 0x8b, 0x00, 0x10, 0x0b, 0x0b, 0x12, 0x19, 0x19, 0x4b, 0x9a, 0x7c,
+    0xb5, 0xcf, 0xc0, 0x99, 0x7c, 0x6a, 0x4b, 0x3f, 0x3f, 0x80, 0xca, 0x0e,
+    0xdb, 0xe9, 0xdc, 0xe6, 0xdb, 0xb5, 0x1c, 0x34, 0x32, 0x4b, 0x5c, 0x53,
+    0x6a, 0x9a, 0xba, 0x80, 0xc0, 0x06, 0xb3, 0xa8, 0x1c, 0x34, 0xa8, 0xdc,
+    0x99, 0x80, 0x3f, 0x0e, 0x4b, 0x5c, 0x8e, 0x32, 0x24, 0x4b, 0x32, 0x0c,
+    0x0f, 0x06, 0x19, 0x99, 0xc0, 0xca, 0xc0, 0x80, 0xb6, 0x17, 0xbe, 0x84,
+    0x24, 0x34, 0x32, 0x3f, 0x26, 0x00, 0x00, 0x03, 0x26, 0x4b, 0x6f, 0x99,
+    0x9a, 0x7c, 0x4b, 0x4b, 0x6a, 0x9a, 0xde, 0xe8, 0xd1, 0x12, 0x83, 0x00,
+    0x84, 0x04, 0x01, 0x0c, 0x04, 0x82, 0x0c, 0x07, 0x0b, 0x0a, 0x18, 0x38,
+    0x7a, 0x8a, 0x85, 0x7e, 0x80, 0x83, 0x03, 0x8a, 0x83, 0x8a, 0x96, 0x80,
+    0x8a, 0x06, 0x8c, 0x95, 0x9b, 0x95, 0x8a, 0x9b, 0x95, 0x80, 0x9b, 0x01,
+    0x9f, 0x95, 0x80, 0x91, 0x80, 0x87, 0x02, 0x91, 0x83, 0x83, 0x80, 0x7e,
+    0x82, 0x82, 0x09, 0x77, 0x77, 0x7d, 0x82, 0x7a, 0x81, 0x7a, 0x7a, 0x77,
+    0x89, 0x82, 0x7e, 0x05, 0x82, 0x82, 0x7e, 0x82, 0x82, 0x83, 0x80, 0x87,
+    0x81, 0x91, 0x80, 0x95, 0x15, 0x93, 0x93, 0x9b, 0x9f, 0xa7, 0x9e, 0xae,
+    0xb4, 0xb4, 0xb8, 0xb8, 0xc2, 0xce, 0xd5, 0xce, 0xb7, 0x69, 0x2c, 0x0f,
+    0x02, 0x01, 0x02, 0x87, 0x01, 0x06, 0x06, 0x07, 0x10, 0x17, 0x1a, 0x21,
+    0x15, 0x80, 0x17, 0x00, 0x15, 0x80, 0x1f, 0x18, 0x1d, 0x21, 0x27, 0x25,
+    0x2a, 0x2a, 0x2f, 0x3b, 0x40, 0x40, 0x51, 0x4f, 0x56, 0x60, 0x68, 0x73,
+    0x83, 0x83, 0x8a, 0x8c, 0x93, 0x93, 0x9e, 0xaa, 0xaa, 0x81, 0xb8, 0x81,
+    0xc2, 0x06, 0xc9, 0xc9, 0xc2, 0xc2, 0xc9, 0xc9, 0xc2, 0x80, 0xc9, 0x10,
+    0xc2, 0xb8, 0x82, 0x4d, 0x42, 0x3b, 0x41, 0x37, 0x37, 0x31, 0x2c, 0x20,
+    0x0b, 0x0c, 0x0c, 0x04, 0x04, 0x82, 0x00, 0x04, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x87, 0x00, 0x0e, 0x01, 0x01, 0x00, 0x00, 0x0a, 0x19, 0x1e, 0x19,
+    0x12, 0x0b, 0x0a, 0x1e, 0x5a, 0x3f, 0x4b, 0x80, 0x6a, 0x07, 0x4b, 0x32,
+    0x34, 0x1c, 0x1e, 0x5a, 0xc0, 0xc0, 0x80, 0xb6, 0x26, 0x9a, 0x4b, 0x1c,
+    0x11, 0x32, 0x53, 0x6f, 0x53, 0x32, 0x1c, 0x5a, 0x7c, 0x9a, 0x9a, 0x99,
+    0x7c, 0x4b, 0x52, 0x39, 0xa8, 0xdb, 0xdb, 0x7c, 0x4b, 0x4b, 0x5c, 0x79,
+    0x79, 0x34, 0x1c, 0x34, 0x1c, 0x05, 0x0f, 0x0f, 0x02, 0x26, 0x6a, 0x99,
+    0x81, 0xa8, 0x17, 0x8e, 0x4b, 0x34, 0x34, 0x32, 0x4b, 0x6a, 0x26, 0x01,
+    0x00, 0x00, 0x1c, 0x4b, 0x6f, 0x99, 0x7c, 0x6a, 0x53, 0x6a, 0x7c, 0xb3,
+    0xe8, 0xed, 0x8b, 0x83, 0x00, 0x80, 0x04, 0x83, 0x0c, 0x80, 0x0b, 0x08,
+    0x0a, 0x0b, 0x0a, 0x13, 0x0a, 0x13, 0x54, 0x87, 0x8a, 0x83, 0x9b, 0x03,
+    0x9f, 0x9f, 0x93, 0x9f, 0x80, 0xa7, 0x02, 0xaf, 0xaf, 0x9e, 0x83, 0xaf,
+    0x81, 0x87, 0x0d, 0x82, 0x7e, 0x82, 0x82, 0x7e, 0x7e, 0x7d, 0x81, 0x73,
+    0x7d, 0x73, 0x7d, 0x7a, 0x7a, 0x80, 0x7d, 0x0b, 0x73, 0x73, 0x7a, 0x6e,
+    0x75, 0x6e, 0x7d, 0x73, 0x73, 0x77, 0x81, 0x77, 0x80, 0x7a, 0x02, 0x7d,
+    0x82, 0x7e, 0x80, 0x82, 0x81, 0x83, 0x0b, 0x87, 0x91, 0x80, 0x91, 0x91,
+    0x95, 0x95, 0x9b, 0x9f, 0xa7, 0xa7, 0x9e, 0x80, 0xaa, 0x11, 0xb8, 0xc2,
+    0xce, 0xd5, 0xce, 0xb1, 0x69, 0x20, 0x0f, 0x02, 0x02, 0x01, 0x03, 0x03,
+    0x00, 0x00, 0x01, 0x03, 0x80, 0x01, 0x27, 0x06, 0x06, 0x07, 0x10, 0x15,
+    0x1d, 0x1f, 0x15, 0x10, 0x17, 0x17, 0x1f, 0x21, 0x1a, 0x1a, 0x21, 0x21,
+    0x25, 0x2c, 0x2a, 0x2a, 0x35, 0x3b, 0x44, 0x4e, 0x51, 0x58, 0x58, 0x56,
+    0x68, 0x6e, 0x73, 0x7e, 0x83, 0x8a, 0x8c, 0x9b, 0x9f, 0x9e, 0x9e, 0x81,
+    0xaa, 0x83, 0xb8, 0x01, 0xc2, 0xc2, 0x81, 0xb8, 0x07, 0xae, 0x95, 0x43,
+    0x42, 0x42, 0x37, 0x37, 0x31, 0x80, 0x2c, 0x01, 0x20, 0x13, 0x82, 0x04,
+    0x80, 0x00, 0x04, 0x01, 0x00, 0x00, 0x03, 0x01, 0x87, 0x00, 0x07, 0x03,
+    0x00, 0x0a, 0x12, 0x19, 0x23, 0x38, 0x18, 0x81, 0x0a, 0x1d, 0x0b, 0x12,
+    0x11, 0x11, 0x12, 0x12, 0x19, 0x11, 0x19, 0x12, 0x0b, 0x04, 0x39, 0xd9,
+    0xd9, 0x7c, 0x5a, 0x34, 0x1c, 0x26, 0x1c, 0x1e, 0x34, 0x79, 0xa2, 0x32,
+    0x1c, 0x11, 0x1c, 0x5a, 0x81, 0x34, 0x33, 0x1e, 0x5e, 0x52, 0x7c, 0xca,
+    0xdb, 0xb3, 0x53, 0x6f, 0x99, 0xa8, 0x3f, 0x34, 0x34, 0x32, 0x32, 0x12,
+    0x0f, 0x0f, 0x06, 0x06, 0x0c, 0x5a, 0xb3, 0xb6, 0xa8, 0x84, 0x6a, 0x4b,
+    0x3f, 0x34, 0x3f, 0x4b, 0x5c, 0x6f, 0x26, 0x03, 0x00, 0x04, 0x34, 0x7c,
+    0x99, 0xa8, 0x99, 0x9a, 0x7c, 0x7c, 0x9a, 0xc4, 0xf1, 0xda, 0x1e, 0x82,
+    0x00, 0x81, 0x04, 0x80, 0x0c, 0x03, 0x0b, 0x0b, 0x18, 0x2d, 0x80, 0x5e,
+    0x09, 0x69, 0x7f, 0x69, 0x2d, 0x18, 0x7f, 0xa7, 0xaf, 0x9e, 0xa7, 0x82,
+    0xaf, 0x0a, 0xaa, 0xaa, 0xaf, 0xaf, 0xbd, 0xb8, 0xbd, 0xbd, 0xb8, 0xc2,
+    0xb8, 0x80, 0xc2, 0x00, 0x7e, 0x80, 0x82, 0x01, 0x77, 0x77, 0x80, 0x6e,
+    0x01, 0x7d, 0x75, 0x80, 0x6e, 0x02, 0x75, 0x7d, 0x75, 0x80, 0x6e, 0x00,
+    0x75, 0x83, 0x6e, 0x07, 0x75, 0x73, 0x73, 0x75, 0x73, 0x7a, 0x73, 0x7a,
+    0x80, 0x6e, 0x08, 0x7a, 0x77, 0x7a, 0x77, 0x7d, 0x7e, 0x7e, 0x82, 0x82,
+    0x80, 0x83, 0x19, 0x80, 0x87, 0x91, 0x91, 0x95, 0x95, 0x9b, 0x93, 0x9e,
+    0xa7, 0xa7, 0xaa, 0xb4, 0xb4, 0xbd, 0xc2, 0xce, 0xce, 0xab, 0x4a, 0x17,
+    0x0f, 0x06, 0x02, 0x03, 0x01, 0x80, 0x00, 0x2a, 0x01, 0x01, 0x00, 0x01,
+    0x03, 0x06, 0x06, 0x10, 0x10, 0x15, 0x1d, 0x15, 0x10, 0x10, 0x15, 0x1d,
+    0x21, 0x1a, 0x15, 0x15, 0x1f, 0x21, 0x27, 0x25, 0x2a, 0x2f, 0x3e, 0x3e,
+    0x44, 0x44, 0x48, 0x4e, 0x4f, 0x56, 0x60, 0x68, 0x6e, 0x73, 0x83, 0x83,
+    0x8a, 0x8a, 0x9b, 0x81, 0x9e, 0x89, 0xaa, 0x01, 0x9b, 0x4d, 0x80, 0x37,
+    0x00, 0x31, 0x80, 0x2c, 0x0e, 0x27, 0x27, 0x20, 0x0c, 0x04, 0x04, 0x00,
+    0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x86, 0x00, 0x0a, 0x03,
+    0x01, 0x6d, 0x11, 0x26, 0x3c, 0x6d, 0x72, 0x38, 0x23, 0x12, 0x83, 0x0a,
+    0x81, 0x0b, 0x4f, 0x04, 0x00, 0x00, 0x04, 0x04, 0x0b, 0x9a, 0xc4, 0xde,
+    0xb5, 0x24, 0x1c, 0x1c, 0x34, 0x24, 0x1c, 0x34, 0xa8, 0xc0, 0x6a, 0x1c,
+    0x11, 0x7c, 0xba, 0xb3, 0x4b, 0x1c, 0x1c, 0x11, 0x02, 0x0c, 0x34, 0xa2,
+    0xc0, 0xb3, 0x84, 0x99, 0x84, 0x3f, 0x24, 0x34, 0x34, 0x3f, 0x32, 0x0c,
+    0x0f, 0x06, 0x06, 0x02, 0x06, 0x0b, 0x7c, 0xb6, 0xca, 0xb3, 0x7c, 0x5c,
+    0x6a, 0x4b, 0x32, 0x53, 0x6a, 0x84, 0x99, 0x26, 0x01, 0x00, 0x04, 0x5a,
+    0x84, 0x99, 0xb6, 0xc0, 0xc0, 0xb5, 0x7c, 0x9a, 0xcf, 0xf0, 0x5a, 0x80,
+    0x00, 0x82, 0x04, 0x11, 0x0c, 0x0c, 0x13, 0x3a, 0x2d, 0x13, 0x0b, 0x22,
+    0x94, 0xbd, 0xc2, 0xc9, 0xc9, 0xc2, 0xb4, 0xab, 0xc5, 0xbd, 0x80, 0xc9,
+    0x82, 0xc2, 0x01, 0xc9, 0xd3, 0x80, 0xc9, 0x04, 0xd3, 0xd3, 0xd5, 0xd3,
+    0xd5, 0x81, 0xe2, 0x04, 0x77, 0x73, 0x7a, 0x73, 0x6e, 0x81, 0x75, 0x0b,
+    0x70, 0x75, 0x68, 0x75, 0x75, 0x68, 0x70, 0x70, 0x68, 0x70, 0x75, 0x75,
+    0x80, 0x6e, 0x06, 0x75, 0x75, 0x68, 0x68, 0x6b, 0x68, 0x71, 0x80, 0x6e,
+    0x05, 0x71, 0x75, 0x75, 0x6e, 0x73, 0x7a, 0x80, 0x6e, 0x03, 0x77, 0x7a,
+    0x77, 0x77, 0x81, 0x7e, 0x81, 0x87, 0x11, 0x91, 0x8a, 0x8a, 0x95, 0x9b,
+    0x9b, 0x9f, 0xa7, 0x9e, 0xae, 0xae, 0xb8, 0xc2, 0xc9, 0xc5, 0x94, 0x2c,
+    0x17, 0x80, 0x06, 0x00, 0x03, 0x80, 0x00, 0x80, 0x01, 0x80, 0x03, 0x0b,
+    0x06, 0x0f, 0x10, 0x15, 0x1f, 0x15, 0x15, 0x10, 0x10, 0x15, 0x1d, 0x1f,
+    0x80, 0x15, 0x14, 0x1f, 0x21, 0x27, 0x25, 0x2a, 0x35, 0x35, 0x3e, 0x3e,
+    0x40, 0x40, 0x48, 0x4e, 0x4f, 0x56, 0x60, 0x68, 0x6e, 0x73, 0x7e, 0x83,
+    0x80, 0x8a, 0x01, 0x8c, 0x93, 0x85, 0x9e, 0x06, 0x93, 0x9f, 0x9f, 0x4d,
+    0x2f, 0x2f, 0x31, 0x80, 0x2c, 0x80, 0x27, 0x03, 0x1f, 0x14, 0x0c, 0x04,
+    0x81, 0x00, 0x02, 0x01, 0x03, 0x03, 0x81, 0x01, 0x85, 0x00, 0x09, 0x19,
+    0x39, 0x76, 0x76, 0xb1, 0xb1, 0x38, 0x3c, 0x52, 0x19, 0x82, 0x12, 0x01,
+    0x0a, 0x0a, 0x84, 0x0b, 0x22, 0x04, 0x04, 0x0b, 0x26, 0x7c, 0x9a, 0x7c,
+    0xbf, 0x98, 0x6a, 0x34, 0x34, 0x24, 0x6a, 0x99, 0xd2, 0xcf, 0x99, 0x6a,
+    0xcf, 0xcf, 0xdb, 0xa8, 0x32, 0x1c, 0x12, 0x00, 0x01, 0x0b, 0x3f, 0x84,
+    0xa8, 0xa8, 0x6a, 0x24, 0x80, 0x34, 0x0e, 0x3f, 0x53, 0x1c, 0x0f, 0x0f,
+    0x06, 0x06, 0x02, 0x02, 0x03, 0x26, 0xb3, 0xca, 0xde, 0xb5, 0x80, 0x6f,
+    0x16, 0x3f, 0x34, 0x6a, 0x6f, 0x99, 0x99, 0x19, 0x03, 0x01, 0x00, 0x5a,
+    0x84, 0xa8, 0xc0, 0xcf, 0xdb, 0xde, 0xb5, 0xb5, 0xd9, 0x98, 0x12, 0x00,
+    0x83, 0x04, 0x80, 0x0c, 0x08, 0x13, 0x2d, 0x61, 0x7f, 0x86, 0xb4, 0xbd,
+    0xc2, 0xc2, 0x80, 0xc9, 0x84, 0xd3, 0x03, 0xd5, 0xd5, 0xd3, 0xd3, 0x86,
+    0xe2, 0x82, 0xe7, 0x03, 0x75, 0x75, 0x70, 0x70, 0x80, 0x75, 0x81, 0x70,
+    0x06, 0x6b, 0x6b, 0x70, 0x68, 0x70, 0x70, 0x68, 0x80, 0x70, 0x03, 0x68,
+    0x71, 0x70, 0x70, 0x84, 0x68, 0x80, 0x70, 0x05, 0x68, 0x75, 0x75, 0x6e,
+    0x6e, 0x75, 0x84, 0x6e, 0x05, 0x7e, 0x77, 0x77, 0x82, 0x7e, 0x7e, 0x81,
+    0x83, 0x05, 0x91, 0x91, 0x95, 0x95, 0x9b, 0x93, 0x80, 0x9e, 0x1a, 0xae,
+    0xbd, 0xb8, 0xce, 0xb1, 0x54, 0x1f, 0x0f, 0x06, 0x06, 0x03, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x03, 0x06, 0x0f, 0x10, 0x17,
+    0x1d, 0x17, 0x80, 0x10, 0x01, 0x15, 0x1d, 0x81, 0x15, 0x23, 0x1f, 0x21,
+    0x21, 0x25, 0x2f, 0x35, 0x30, 0x35, 0x2f, 0x2b, 0x25, 0x35, 0x40, 0x46,
+    0x4f, 0x56, 0x60, 0x6e, 0x6e, 0x77, 0x7e, 0x7e, 0x83, 0x83, 0x8a, 0x8c,
+    0x8c, 0x93, 0x8c, 0x8a, 0x8c, 0x8a, 0x8c, 0x91, 0x64, 0x2a, 0x80, 0x2c,
+    0x81, 0x27, 0x80, 0x1f, 0x01, 0x14, 0x04, 0x82, 0x00, 0x07, 0x03, 0x01,
+    0x03, 0x01, 0x01, 0x00, 0x01, 0x01, 0x81, 0x00, 0x0d, 0x04, 0x19, 0x3c,
+    0x6d, 0xab, 0xce, 0xd5, 0xd5, 0xb1, 0xb1, 0x94, 0x12, 0x12, 0x19, 0x82,
+    0x12, 0x01, 0x0a, 0x0a, 0x84, 0x0b, 0x1f, 0x04, 0x0b, 0x04, 0x1e, 0x5a,
+    0x5a, 0xda, 0xc8, 0xb3, 0xb3, 0x9a, 0x99, 0x99, 0x34, 0x7c, 0xca, 0xb3,
+    0x7c, 0x7c, 0xb3, 0xb6, 0xb6, 0x53, 0x34, 0x0b, 0x00, 0x00, 0x03, 0x1c,
+    0x4b, 0x84, 0x84, 0x80, 0x34, 0x04, 0x5a, 0x9a, 0xa2, 0x3f, 0x00, 0x82,
+    0x06, 0x21, 0x02, 0x00, 0x03, 0x39, 0xc0, 0xdb, 0xde, 0xb5, 0xa2, 0xa2,
+    0x9a, 0x34, 0x4b, 0x7c, 0x84, 0xb3, 0x7c, 0x01, 0x01, 0x00, 0x03, 0x34,
+    0x9a, 0xb3, 0xcf, 0xdb, 0xdb, 0xe9, 0xcf, 0xc0, 0xc0, 0x1e, 0x0c, 0x0c,
+    0x81, 0x04, 0x80, 0x0c, 0x09, 0x0b, 0x0c, 0x0c, 0x0b, 0x38, 0x9b, 0xa7,
+    0xaf, 0xaf, 0xb8, 0x80, 0xc2, 0x01, 0xc9, 0xc9, 0x84, 0xd3, 0x05, 0xc9,
+    0xd3, 0xd5, 0xd3, 0xd5, 0xd3, 0x87, 0xe2, 0x01, 0x75, 0x75, 0x83, 0x70,
+    0x80, 0x6b, 0x01, 0x60, 0x60, 0x81, 0x6b, 0x00, 0x68, 0x85, 0x6b, 0x00,
+    0x60, 0x81, 0x68, 0x01, 0x6b, 0x6b, 0x81, 0x68, 0x80, 0x70, 0x81, 0x68,
+    0x00, 0x75, 0x82, 0x6e, 0x04, 0x7d, 0x73, 0x77, 0x7e, 0x77, 0x80, 0x7e,
+    0x05, 0x83, 0x87, 0x80, 0x8a, 0x95, 0x95, 0x80, 0x93, 0x0a, 0xa7, 0xa7,
+    0xaf, 0xae, 0xb8, 0xc5, 0x7f, 0x2c, 0x10, 0x06, 0x06, 0x80, 0x01, 0x01,
+    0x00, 0x00, 0x83, 0x03, 0x06, 0x06, 0x02, 0x0f, 0x10, 0x15, 0x17, 0x17,
+    0x80, 0x10, 0x18, 0x15, 0x15, 0x17, 0x17, 0x15, 0x15, 0x1a, 0x1f, 0x21,
+    0x25, 0x21, 0x15, 0x15, 0x0d, 0x10, 0x15, 0x21, 0x2a, 0x3b, 0x46, 0x51,
+    0x4f, 0x60, 0x60, 0x68, 0x81, 0x6e, 0x00, 0x82, 0x81, 0x7e, 0x07, 0x77,
+    0x73, 0x6e, 0x4d, 0x2a, 0x27, 0x2c, 0x2c, 0x81, 0x27, 0x06, 0x1f, 0x1f,
+    0x17, 0x0f, 0x04, 0x01, 0x00, 0x80, 0x01, 0x05, 0x03, 0x03, 0x01, 0x03,
+    0x01, 0x01, 0x82, 0x00, 0x0c, 0x04, 0x20, 0x4a, 0x7b, 0xc5, 0xd5, 0xd5,
+    0xc9, 0xc2, 0xae, 0x94, 0x5e, 0x12, 0x80, 0x19, 0x83, 0x12, 0x03, 0x0a,
+    0x0b, 0x0b, 0x0a, 0x84, 0x0b, 0x14, 0x00, 0x0b, 0x12, 0x39, 0x5a, 0x6a,
+    0x5a, 0x4b, 0x32, 0x1e, 0x00, 0x0a, 0x4b, 0x7c, 0x6a, 0x6f, 0x84, 0x84,
+    0x8e, 0x6f, 0x34, 0x80, 0x00, 0x0f, 0x01, 0x12, 0x3f, 0x5c, 0x99, 0x99,
+    0xa2, 0x7c, 0xb5, 0xcf, 0x99, 0x76, 0x1d, 0x05, 0x02, 0x01, 0x81, 0x06,
+    0x1d, 0x01, 0x03, 0x34, 0xcf, 0xe6, 0xde, 0xcf, 0xcf, 0xc0, 0x7c, 0x6a,
+    0x7c, 0x9a, 0xb5, 0xb5, 0x26, 0x01, 0x00, 0x00, 0x03, 0x19, 0x6a, 0x9a,
+    0xc0, 0xdb, 0xcf, 0xb5, 0x7c, 0x39, 0x0b, 0x83, 0x04, 0x84, 0x0c, 0x04,
+    0x22, 0x3a, 0x87, 0x9b, 0x9e, 0x80, 0xa7, 0x02, 0xaa, 0xb8, 0xb8, 0x83,
+    0xc2, 0x06, 0xc9, 0xc2, 0xc9, 0xc9, 0xd3, 0xc9, 0xc2, 0x87, 0xd3, 0x02,
+    0x70, 0x71, 0x68, 0x80, 0x6b, 0x02, 0x68, 0x6b, 0x6b, 0x80, 0x60, 0x01,
+    0x66, 0x60, 0x81, 0x6b, 0x00, 0x60, 0x84, 0x6b, 0x08, 0x60, 0x60, 0x6b,
+    0x6b, 0x60, 0x6b, 0x60, 0x6b, 0x6b, 0x80, 0x60, 0x01, 0x6b, 0x6b, 0x81,
+    0x68, 0x02, 0x70, 0x68, 0x68, 0x82, 0x6e, 0x04, 0x7d, 0x7d, 0x73, 0x73,
+    0x77, 0x80, 0x7e, 0x24, 0x80, 0x83, 0x87, 0x8a, 0x91, 0x91, 0x8c, 0x95,
+    0x9b, 0x93, 0x9e, 0xae, 0xb8, 0xc2, 0xa4, 0x47, 0x15, 0x0f, 0x02, 0x01,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x06,
+    0x06, 0x0f, 0x10, 0x17, 0x17, 0x81, 0x10, 0x19, 0x15, 0x15, 0x17, 0x10,
+    0x0d, 0x15, 0x15, 0x1d, 0x17, 0x05, 0x0f, 0x0f, 0x07, 0x17, 0x1f, 0x27,
+    0x35, 0x3e, 0x3e, 0x40, 0x46, 0x4f, 0x56, 0x56, 0x60, 0x60, 0x81, 0x68,
+    0x80, 0x60, 0x01, 0x46, 0x35, 0x81, 0x27, 0x01, 0x2c, 0x27, 0x80, 0x1f,
+    0x0d, 0x17, 0x10, 0x0f, 0x06, 0x01, 0x03, 0x01, 0x06, 0x06, 0x03, 0x03,
+    0x01, 0x03, 0x03, 0x80, 0x00, 0x12, 0x04, 0x02, 0x10, 0x31, 0x72, 0xab,
+    0xce, 0xd5, 0xce, 0xc5, 0xc5, 0xae, 0x7b, 0x52, 0x19, 0x12, 0x19, 0x19,
+    0x11, 0x83, 0x19, 0x05, 0x12, 0x0a, 0x0b, 0x12, 0x12, 0x0a, 0x83, 0x0b,
+    0x80, 0x04, 0x04, 0x00, 0x00, 0x04, 0x0a, 0x0a, 0x81, 0x00, 0x00, 0x0b,
+    0x80, 0x26, 0x04, 0x1c, 0x26, 0x1c, 0x34, 0x11, 0x82, 0x00, 0x0d, 0x26,
+    0x6a, 0x6f, 0x9a, 0x99, 0xb6, 0xcf, 0x99, 0x39, 0x94, 0xa4, 0x69, 0x2c,
+    0x10, 0x83, 0x01, 0x0e, 0x00, 0x34, 0xc0, 0xe6, 0xed, 0xee, 0xed, 0xcf,
+    0xb5, 0xb5, 0xc0, 0xcf, 0x6a, 0x12, 0x03, 0x80, 0x00, 0x09, 0x01, 0x03,
+    0x19, 0x34, 0x34, 0x39, 0x19, 0x03, 0x03, 0x00, 0x81, 0x04, 0x82, 0x0c,
+    0x07, 0x13, 0x20, 0x22, 0x13, 0x0b, 0x18, 0x54, 0x83, 0x82, 0x8a, 0x08,
+    0x9e, 0xaa, 0xaf, 0xaf, 0xaa, 0xaa, 0xbd, 0xb8, 0xb8, 0x82, 0xc2, 0x04,
+    0xaf, 0xbd, 0xc9, 0xc9, 0xc2, 0x83, 0xc9, 0x02, 0x6b, 0x60, 0x6b, 0x80,
+    0x66, 0x01, 0x60, 0x6b, 0x83, 0x66, 0x03, 0x60, 0x60, 0x66, 0x60, 0x83,
+    0x66, 0x10, 0x6b, 0x66, 0x60, 0x60, 0x66, 0x66, 0x6b, 0x66, 0x66, 0x60,
+    0x60, 0x66, 0x60, 0x60, 0x66, 0x6b, 0x6b, 0x80, 0x60, 0x06, 0x6b, 0x6b,
+    0x68, 0x70, 0x68, 0x70, 0x68, 0x80, 0x75, 0x82, 0x6e, 0x14, 0x77, 0x82,
+    0x82, 0x7e, 0x7e, 0x83, 0x87, 0x80, 0x8a, 0x91, 0x93, 0x9b, 0x9f, 0xa7,
+    0xaa, 0xb4, 0xb4, 0x61, 0x1f, 0x0f, 0x06, 0x82, 0x01, 0x03, 0x00, 0x00,
+    0x01, 0x03, 0x80, 0x01, 0x80, 0x06, 0x00, 0x0f, 0x89, 0x10, 0x06, 0x17,
+    0x15, 0x17, 0x10, 0x10, 0x1d, 0x27, 0x81, 0x2a, 0x09, 0x2f, 0x35, 0x42,
+    0x40, 0x44, 0x4e, 0x46, 0x58, 0x58, 0x4f, 0x80, 0x46, 0x16, 0x43, 0x37,
+    0x27, 0x1f, 0x1f, 0x27, 0x2c, 0x1f, 0x27, 0x1f, 0x20, 0x17, 0x10, 0x0f,
+    0x02, 0x06, 0x01, 0x01, 0x06, 0x01, 0x01, 0x03, 0x03, 0x80, 0x01, 0x11,
+    0x00, 0x00, 0x02, 0x10, 0x1f, 0x3a, 0x94, 0xb1, 0xce, 0xce, 0xc5, 0xc2,
+    0xb8, 0xae, 0x9c, 0x52, 0x3c, 0x1e, 0x87, 0x19, 0x80, 0x12, 0x02, 0x0a,
+    0x12, 0x0a, 0x86, 0x0b, 0x88, 0x04, 0x8b, 0x00, 0x21, 0x1e, 0x1c, 0x34,
+    0x3f, 0x53, 0x4b, 0x11, 0x03, 0x14, 0x5e, 0xa4, 0xac, 0x5b, 0x27, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x39, 0xb3, 0xdb, 0xe6, 0xf2, 0xed,
+    0xde, 0xdb, 0xde, 0xde, 0x6a, 0x0a, 0x03, 0x83, 0x00, 0x01, 0x01, 0x01,
+    0x82, 0x00, 0x80, 0x04, 0x12, 0x0c, 0x13, 0x13, 0x0b, 0x0a, 0x0b, 0x13,
+    0x31, 0x41, 0x37, 0x31, 0x31, 0x47, 0x68, 0x73, 0x73, 0x77, 0x83, 0x83,
+    0x80, 0x8a, 0x03, 0x9f, 0x9f, 0xa7, 0xa7, 0x85, 0xaa, 0x09, 0xaf, 0xaf,
+    0xaa, 0xaf, 0xbd, 0xaa, 0xb8, 0xb8, 0xbd, 0xbd, 0x8b, 0x66, 0x80, 0x60,
+    0x86, 0x66, 0x02, 0x60, 0x60, 0x66, 0x80, 0x60, 0x03, 0x66, 0x66, 0x60,
+    0x60, 0x81, 0x66, 0x09, 0x60, 0x60, 0x66, 0x66, 0x60, 0x6b, 0x60, 0x68,
+    0x68, 0x6b, 0x82, 0x70, 0x01, 0x6e, 0x75, 0x81, 0x6e, 0x02, 0x77, 0x77,
+    0x80, 0x80, 0x7e, 0x12, 0x83, 0x83, 0x91, 0x91, 0x95, 0x9b, 0x93, 0x9e,
+    0xae, 0xae, 0x7f, 0x1f, 0x10, 0x02, 0x01, 0x03, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x04, 0x03, 0x01, 0x01, 0x06, 0x02, 0x80, 0x06, 0x02, 0x0f, 0x0f,
+    0x07, 0x80, 0x10, 0x02, 0x0f, 0x0f, 0x07, 0x81, 0x0f, 0x0f, 0x10, 0x10,
+    0x17, 0x1d, 0x21, 0x25, 0x25, 0x1f, 0x10, 0x21, 0x21, 0x25, 0x2a, 0x30,
+    0x3e, 0x3e, 0x80, 0x40, 0x05, 0x3b, 0x2f, 0x2a, 0x27, 0x1f, 0x1d, 0x83,
+    0x1f, 0x07, 0x17, 0x10, 0x0f, 0x0f, 0x02, 0x06, 0x01, 0x01, 0x80, 0x03,
+    0x01, 0x01, 0x01, 0x81, 0x00, 0x14, 0x05, 0x17, 0x27, 0x54, 0xab, 0xc5,
+    0xce, 0xce, 0xc2, 0xb8, 0xae, 0xae, 0xa6, 0x9e, 0x7f, 0x72, 0x86, 0x5e,
+    0x19, 0x11, 0x1e, 0x83, 0x19, 0x02, 0x11, 0x19, 0x12, 0x80, 0x0a, 0x05,
+    0x0b, 0x04, 0x04, 0x0b, 0x0b, 0x0a, 0x81, 0x0b, 0x00, 0x04, 0x86, 0x0b,
+    0x01, 0x04, 0x0b, 0x81, 0x04, 0x87, 0x00, 0x20, 0x04, 0x0b, 0x0a, 0x0a,
+    0x04, 0x01, 0x00, 0x00, 0x04, 0x20, 0x5e, 0xb8, 0xa4, 0x3a, 0x0f, 0x01,
+    0x01, 0x00, 0x00, 0x03, 0x00, 0x1e, 0x9a, 0xdb, 0xca, 0xde, 0xdb, 0xca,
+    0xcf, 0xc0, 0x99, 0x0a, 0x03, 0x86, 0x00, 0x00, 0x04, 0x81, 0x00, 0x03,
+    0x04, 0x04, 0x0c, 0x14, 0x81, 0x1f, 0x10, 0x27, 0x2f, 0x42, 0x35, 0x35,
+    0x48, 0x4e, 0x58, 0x5f, 0x60, 0x70, 0x75, 0x75, 0x73, 0x77, 0x7e, 0x83,
+    0x80, 0x8a, 0x02, 0x95, 0x95, 0x93, 0x80, 0x9b, 0x0b, 0x9e, 0x9b, 0x9b,
+    0x9f, 0x9f, 0xaf, 0xa7, 0xaa, 0xaf, 0xa7, 0xaf, 0xaf, 0x81, 0x66, 0x80,
+    0x5f, 0x04, 0x66, 0x5f, 0x66, 0x5f, 0x56, 0x83, 0x66, 0x02, 0x5f, 0x66,
+    0x66, 0x81, 0x5f, 0x06, 0x66, 0x5f, 0x56, 0x56, 0x66, 0x60, 0x60, 0x80,
+    0x66, 0x00, 0x60, 0x81, 0x66, 0x05, 0x56, 0x66, 0x66, 0x60, 0x60, 0x66,
+    0x81, 0x60, 0x08, 0x6b, 0x6b, 0x68, 0x68, 0x70, 0x68, 0x70, 0x70, 0x68,
+    0x80, 0x6e, 0x15, 0x7a, 0x73, 0x7a, 0x77, 0x7d, 0x7d, 0x7e, 0x83, 0x83,
+    0x87, 0x91, 0x95, 0x9b, 0x93, 0x9e, 0xaf, 0x86, 0x2c, 0x10, 0x0f, 0x06,
+    0x03, 0x80, 0x00, 0x07, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02, 0x06, 0x02,
+    0x80, 0x06, 0x80, 0x0f, 0x03, 0x07, 0x0f, 0x0f, 0x10, 0x83, 0x0f, 0x00,
+    0x07, 0x80, 0x10, 0x09, 0x15, 0x17, 0x0f, 0x02, 0x01, 0x03, 0x01, 0x02,
+    0x07, 0x21, 0x80, 0x27, 0x01, 0x1f, 0x15, 0x83, 0x17, 0x00, 0x15, 0x80,
+    0x1f, 0x01, 0x10, 0x0f, 0x81, 0x06, 0x00, 0x03, 0x80, 0x01, 0x26, 0x03,
+    0x06, 0x01, 0x00, 0x00, 0x02, 0x0f, 0x1f, 0x27, 0x54, 0xb7, 0xce, 0xce,
+    0xc5, 0xb8, 0xb8, 0xae, 0xae, 0xa7, 0xa6, 0x9e, 0x9b, 0x9c, 0x95, 0x8c,
+    0x4a, 0x19, 0x3c, 0x72, 0x69, 0x23, 0x23, 0x3c, 0x3c, 0x1e, 0x1e, 0x19,
+    0x12, 0x0a, 0x80, 0x12, 0x01, 0x0a, 0x0a, 0x80, 0x12, 0x01, 0x0a, 0x0a,
+    0x85, 0x0b, 0x00, 0x0a, 0x81, 0x0b, 0x00, 0x04, 0x80, 0x0b, 0x80, 0x04,
+    0x8f, 0x00, 0x05, 0x0c, 0x31, 0xb4, 0xbd, 0x5b, 0x10, 0x84, 0x00, 0x08,
+    0x12, 0x12, 0x26, 0x5a, 0x6a, 0x7c, 0x7c, 0x1c, 0x03, 0x83, 0x00, 0x00,
+    0x04, 0x80, 0x00, 0x80, 0x04, 0x00, 0x00, 0x81, 0x04, 0x16, 0x0c, 0x14,
+    0x20, 0x27, 0x27, 0x2c, 0x31, 0x33, 0x30, 0x42, 0x3e, 0x44, 0x48, 0x4e,
+    0x58, 0x4f, 0x5f, 0x5f, 0x6b, 0x6b, 0x68, 0x7d, 0x7d, 0x81, 0x6e, 0x05,
+    0x7e, 0x83, 0x83, 0x7e, 0x83, 0x83, 0x80, 0x8a, 0x02, 0x95, 0x93, 0x9f,
+    0x80, 0x9b, 0x00, 0x9f, 0x81, 0x66, 0x96, 0x5f, 0x01, 0x66, 0x66, 0x81,
+    0x5f, 0x04, 0x56, 0x66, 0x66, 0x56, 0x56, 0x85, 0x66, 0x05, 0x60, 0x60,
+    0x6b, 0x6b, 0x60, 0x68, 0x80, 0x60, 0x04, 0x6b, 0x70, 0x68, 0x70, 0x75,
+    0x83, 0x6e, 0x10, 0x77, 0x77, 0x7e, 0x83, 0x83, 0x80, 0x8c, 0x93, 0x93,
+    0x9f, 0xa7, 0x86, 0x31, 0x17, 0x0f, 0x06, 0x03, 0x84, 0x00, 0x08, 0x01,
+    0x01, 0x06, 0x02, 0x02, 0x06, 0x06, 0x02, 0x05, 0x83, 0x0f, 0x0a, 0x07,
+    0x10, 0x0f, 0x10, 0x0f, 0x0f, 0x05, 0x0f, 0x06, 0x0f, 0x06, 0x83, 0x00,
+    0x00, 0x06, 0x8a, 0x0f, 0x01, 0x10, 0x0f, 0x80, 0x06, 0x18, 0x00, 0x03,
+    0x03, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x06, 0x10, 0x1f, 0x2c,
+    0x47, 0xab, 0xce, 0xce, 0xc2, 0xb8, 0xae, 0xae, 0xa6, 0xac, 0x9e, 0x80,
+    0x93, 0x07, 0x95, 0x8c, 0x80, 0x82, 0x4a, 0x38, 0x7a, 0x7e, 0x80, 0x7a,
+    0x03, 0x7d, 0x81, 0x64, 0x18, 0x81, 0x12, 0x01, 0x0a, 0x0a, 0x81, 0x12,
+    0x80, 0x0a, 0x82, 0x0b, 0x00, 0x0a, 0x80, 0x12, 0x02, 0x0a, 0x0b, 0x0a,
+    0x80, 0x0b, 0x00, 0x04, 0x80, 0x0b, 0x00, 0x04, 0x81, 0x00, 0x80, 0x04,
+    0x89, 0x00, 0x06, 0x0c, 0x3a, 0xb4, 0xc2, 0x7f, 0x17, 0x01, 0x82, 0x00,
+    0x07, 0x01, 0x01, 0x03, 0x03, 0x01, 0x03, 0x01, 0x03, 0x85, 0x00, 0x01,
+    0x0c, 0x02, 0x80, 0x04, 0x01, 0x0c, 0x0c, 0x81, 0x04, 0x08, 0x0c, 0x0c,
+    0x17, 0x1f, 0x27, 0x2e, 0x2e, 0x2f, 0x2f, 0x80, 0x35, 0x80, 0x3b, 0x1e,
+    0x44, 0x48, 0x4e, 0x48, 0x58, 0x5f, 0x5f, 0x66, 0x66, 0x60, 0x66, 0x6b,
+    0x68, 0x75, 0x73, 0x73, 0x7d, 0x75, 0x73, 0x73, 0x7d, 0x85, 0x83, 0x83,
+    0x7e, 0x83, 0x83, 0x8a, 0x5f, 0x5f, 0x59, 0x90, 0x5f, 0x00, 0x56, 0x85,
+    0x5f, 0x00, 0x56, 0x80, 0x5f, 0x03, 0x56, 0x5f, 0x5f, 0x56, 0x85, 0x66,
+    0x82, 0x60, 0x0b, 0x6b, 0x6b, 0x66, 0x66, 0x60, 0x6b, 0x6b, 0x60, 0x60,
+    0x6b, 0x70, 0x70, 0x80, 0x68, 0x80, 0x6e, 0x0f, 0x77, 0x77, 0x7e, 0x83,
+    0x83, 0x91, 0x91, 0x8c, 0x95, 0xa7, 0x82, 0x31, 0x17, 0x07, 0x06, 0x03,
+    0x85, 0x00, 0x80, 0x01, 0x04, 0x06, 0x06, 0x01, 0x01, 0x02, 0x80, 0x0f,
+    0x80, 0x10, 0x08, 0x05, 0x0f, 0x0f, 0x0c, 0x0c, 0x02, 0x04, 0x01, 0x06,
+    0x83, 0x00, 0x00, 0x01, 0x80, 0x06, 0x87, 0x0f, 0x06, 0x06, 0x06, 0x02,
+    0x02, 0x06, 0x01, 0x01, 0x84, 0x00, 0x28, 0x05, 0x17, 0x1f, 0x31, 0x54,
+    0x94, 0xce, 0xce, 0xc2, 0xbd, 0xae, 0xae, 0xa7, 0xa7, 0x9f, 0x9b, 0x95,
+    0x8c, 0x8c, 0x91, 0x87, 0x83, 0x82, 0x7e, 0x7a, 0x7a, 0x71, 0x71, 0x7a,
+    0x73, 0x7a, 0x7a, 0x71, 0x2d, 0x0a, 0x12, 0x23, 0x23, 0x12, 0x12, 0x0a,
+    0x80, 0x12, 0x83, 0x0a, 0x80, 0x0b, 0x80, 0x12, 0x00, 0x0a, 0x81, 0x0b,
+    0x00, 0x0a, 0x82, 0x0b, 0x02, 0x04, 0x04, 0x0b, 0x85, 0x04, 0x87, 0x00,
+    0x05, 0x04, 0x31, 0xa4, 0xc2, 0x86, 0x1f, 0x91, 0x00, 0x03, 0x04, 0x04,
+    0x14, 0x0f, 0x80, 0x04, 0x03, 0x0c, 0x14, 0x0c, 0x04, 0x81, 0x0c, 0x03,
+    0x17, 0x1f, 0x21, 0x27, 0x80, 0x2a, 0x05, 0x2b, 0x2b, 0x25, 0x25, 0x2a,
+    0x30, 0x80, 0x3b, 0x14, 0x44, 0x48, 0x40, 0x51, 0x51, 0x4f, 0x58, 0x58,
+    0x56, 0x5f, 0x66, 0x60, 0x60, 0x6b, 0x60, 0x66, 0x6b, 0x6b, 0x70, 0x70,
+    0x75, 0x80, 0x6e, 0x03, 0x56, 0x5f, 0x56, 0x56, 0x83, 0x5f, 0x01, 0x59,
+    0x58, 0x88, 0x5f, 0x04, 0x56, 0x5f, 0x5f, 0x56, 0x56, 0x80, 0x5f, 0x80,
+    0x56, 0x0a, 0x5f, 0x5f, 0x56, 0x5f, 0x5f, 0x56, 0x5f, 0x5f, 0x56, 0x5f,
+    0x5f, 0x81, 0x66, 0x81, 0x60, 0x82, 0x66, 0x82, 0x60, 0x05, 0x68, 0x71,
+    0x68, 0x60, 0x68, 0x68, 0x81, 0x6e, 0x10, 0x7a, 0x7e, 0x83, 0x87, 0x83,
+    0x8a, 0x8a, 0x9b, 0x82, 0x31, 0x1d, 0x0f, 0x06, 0x06, 0x00, 0x00, 0x01,
+    0x81, 0x00, 0x81, 0x01, 0x09, 0x03, 0x03, 0x06, 0x01, 0x01, 0x02, 0x02,
+    0x07, 0x10, 0x0f, 0x80, 0x02, 0x02, 0x04, 0x04, 0x01, 0x85, 0x00, 0x05,
+    0x01, 0x01, 0x00, 0x00, 0x06, 0x06, 0x83, 0x0f, 0x82, 0x06, 0x81, 0x01,
+    0x83, 0x00, 0x0a, 0x02, 0x15, 0x21, 0x2c, 0x54, 0x94, 0xc5, 0xce, 0xc5,
+    0xb8, 0xb4, 0x80, 0x9e, 0x04, 0x93, 0x9b, 0x95, 0x91, 0x91, 0x80, 0x87,
+    0x09, 0x82, 0x82, 0x77, 0x77, 0x73, 0x71, 0x71, 0x7a, 0x71, 0x6e, 0x80,
+    0x71, 0x05, 0x3a, 0x22, 0x38, 0x5b, 0x3a, 0x0a, 0x81, 0x12, 0x08, 0x23,
+    0x18, 0x0a, 0x0b, 0x0a, 0x12, 0x12, 0x0b, 0x0a, 0x80, 0x12, 0x00, 0x0a,
+    0x81, 0x0b, 0x01, 0x0a, 0x0a, 0x86, 0x0b, 0x00, 0x04, 0x80, 0x0b, 0x84,
+    0x04, 0x85, 0x00, 0x04, 0x3a, 0xa7, 0xbd, 0x91, 0x27, 0x91, 0x00, 0x12,
+    0x06, 0x0f, 0x10, 0x10, 0x05, 0x0c, 0x04, 0x0c, 0x14, 0x14, 0x0f, 0x0c,
+    0x0c, 0x05, 0x10, 0x17, 0x15, 0x1f, 0x21, 0x80, 0x15, 0x0a, 0x1a, 0x0d,
+    0x10, 0x07, 0x0d, 0x21, 0x25, 0x25, 0x2a, 0x2f, 0x35, 0x80, 0x44, 0x80,
+    0x48, 0x81, 0x51, 0x06, 0x58, 0x46, 0x51, 0x58, 0x51, 0x5f, 0x5f, 0x80,
+    0x66, 0x00, 0x6b, 0x84, 0x5f, 0x80, 0x58, 0x00, 0x5f, 0x84, 0x58, 0x09,
+    0x4f, 0x4f, 0x56, 0x58, 0x58, 0x5f, 0x58, 0x5f, 0x56, 0x56, 0x81, 0x5f,
+    0x00, 0x56, 0x84, 0x5f, 0x00, 0x56, 0x80, 0x5f, 0x07, 0x66, 0x66, 0x5f,
+    0x5f, 0x56, 0x56, 0x60, 0x56, 0x81, 0x5f, 0x01, 0x66, 0x66, 0x87, 0x60,
+    0x81, 0x68, 0x80, 0x6e, 0x0d, 0x77, 0x7e, 0x7e, 0x87, 0x91, 0x91, 0x93,
+    0x7f, 0x2c, 0x15, 0x0f, 0x02, 0x01, 0x01, 0x82, 0x00, 0x07, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x80, 0x01, 0x05, 0x03, 0x02, 0x05,
+    0x05, 0x02, 0x01, 0x83, 0x00, 0x00, 0x06, 0x80, 0x00, 0x06, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x02, 0x86, 0x06, 0x01, 0x01, 0x03, 0x82, 0x00,
+    0x14, 0x01, 0x00, 0x00, 0x04, 0x20, 0x2c, 0x2a, 0x47, 0x94, 0xc5, 0xce,
+    0xc2, 0xb8, 0xae, 0xa6, 0xa7, 0x9f, 0x9b, 0x95, 0x8c, 0x8c, 0x80, 0x87,
+    0x0c, 0x82, 0x82, 0x7a, 0x7a, 0x73, 0x7a, 0x7a, 0x73, 0x71, 0x71, 0x6e,
+    0x71, 0x71, 0x80, 0x68, 0x04, 0x60, 0x5b, 0x64, 0x64, 0x3a, 0x80, 0x19,
+    0x04, 0x2d, 0x3a, 0x3a, 0x13, 0x0a, 0x80, 0x0b, 0x00, 0x0a, 0x81, 0x12,
+    0x00, 0x0a, 0x82, 0x0b, 0x00, 0x0a, 0x83, 0x0b, 0x00, 0x04, 0x84, 0x0b,
+    0x02, 0x04, 0x0b, 0x04, 0x80, 0x0b, 0x00, 0x04, 0x85, 0x00, 0x08, 0x02,
+    0x3a, 0x9f, 0xaf, 0x91, 0x27, 0x00, 0x00, 0x01, 0x8e, 0x00, 0x01, 0x06,
+    0x06, 0x80, 0x0f, 0x03, 0x05, 0x0c, 0x0c, 0x05, 0x80, 0x10, 0x00, 0x0f,
+    0x80, 0x10, 0x04, 0x17, 0x15, 0x10, 0x10, 0x07, 0x81, 0x0f, 0x09, 0x07,
+    0x10, 0x15, 0x15, 0x1a, 0x27, 0x2a, 0x35, 0x30, 0x3d, 0x81, 0x3b, 0x86,
+    0x44, 0x81, 0x4d, 0x00, 0x51, 0x81, 0x5f, 0x04, 0x56, 0x5f, 0x58, 0x58,
+    0x4f, 0x85, 0x58, 0x00, 0x5d, 0x80, 0x58, 0x02, 0x4f, 0x58, 0x5f, 0x81,
+    0x58, 0x01, 0x5f, 0x63, 0x81, 0x5f, 0x06, 0x56, 0x5f, 0x5f, 0x63, 0x5f,
+    0x5f, 0x56, 0x83, 0x5f, 0x80, 0x56, 0x82, 0x5f, 0x00, 0x56, 0x80, 0x5f,
+    0x02, 0x56, 0x5f, 0x56, 0x80, 0x60, 0x00, 0x6b, 0x80, 0x60, 0x81, 0x68,
+    0x81, 0x6e, 0x09, 0x77, 0x7e, 0x83, 0x83, 0x8a, 0x95, 0x71, 0x27, 0x15,
+    0x06, 0x81, 0x01, 0x84, 0x00, 0x00, 0x01, 0x86, 0x00, 0x03, 0x06, 0x02,
+    0x06, 0x02, 0x88, 0x00, 0x01, 0x01, 0x00, 0x80, 0x01, 0x08, 0x06, 0x06,
+    0x01, 0x01, 0x06, 0x03, 0x03, 0x01, 0x01, 0x85, 0x00, 0x1a, 0x02, 0x17,
+    0x31, 0x2a, 0x31, 0x86, 0xc5, 0xc5, 0xc2, 0xb8, 0xae, 0xa7, 0xa6, 0x93,
+    0x9b, 0x95, 0x91, 0x80, 0x80, 0x87, 0x82, 0x82, 0x7e, 0x77, 0x7a, 0x7a,
+    0x75, 0x80, 0x6e, 0x00, 0x71, 0x81, 0x68, 0x00, 0x71, 0x80, 0x68, 0x0f,
+    0x71, 0x60, 0x60, 0x64, 0x64, 0x54, 0x4a, 0x50, 0x59, 0x66, 0x37, 0x0a,
+    0x0b, 0x0b, 0x0a, 0x0a, 0x80, 0x12, 0x06, 0x0a, 0x0a, 0x0b, 0x0b, 0x0a,
+    0x0b, 0x0b, 0x80, 0x0a, 0x02, 0x0b, 0x0b, 0x0a, 0x8d, 0x0b, 0x82, 0x04,
+    0x83, 0x00, 0x04, 0x20, 0x95, 0xa7, 0x87, 0x1f, 0x92, 0x00, 0x00, 0x02,
+    0x86, 0x0f, 0x03, 0x10, 0x10, 0x0f, 0x07, 0x83, 0x10, 0x08, 0x07, 0x07,
+    0x10, 0x15, 0x1a, 0x21, 0x27, 0x27, 0x25, 0x81, 0x2a, 0x00, 0x2b, 0x80,
+    0x30, 0x06, 0x35, 0x3d, 0x35, 0x35, 0x3e, 0x3e, 0x35, 0x80, 0x3b, 0x00,
+    0x44, 0x80, 0x3b, 0x86, 0x58, 0x80, 0x4f, 0x87, 0x58, 0x00, 0x4f, 0x84,
+    0x58, 0x02, 0x5f, 0x5f, 0x56, 0x80, 0x5f, 0x04, 0x56, 0x4f, 0x5f, 0x4f,
+    0x4f, 0x81, 0x5f, 0x00, 0x56, 0x87, 0x5f, 0x00, 0x56, 0x80, 0x5f, 0x02,
+    0x56, 0x56, 0x66, 0x83, 0x60, 0x02, 0x6b, 0x60, 0x60, 0x80, 0x68, 0x04,
+    0x6e, 0x75, 0x6e, 0x73, 0x7e, 0x80, 0x83, 0x05, 0x87, 0x5b, 0x21, 0x17,
+    0x06, 0x01, 0x89, 0x00, 0x01, 0x01, 0x01, 0x84, 0x00, 0x08, 0x03, 0x02,
+    0x0f, 0x0f, 0x02, 0x00, 0x00, 0x01, 0x01, 0x81, 0x00, 0x01, 0x01, 0x00,
+    0x81, 0x03, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x86, 0x00, 0x17, 0x02,
+    0x10, 0x2c, 0x37, 0x2f, 0x67, 0xc5, 0xce, 0xc2, 0xb8, 0xae, 0xae, 0x9e,
+    0x9f, 0x93, 0x9c, 0x8c, 0x91, 0x87, 0x80, 0x82, 0x7e, 0x77, 0x7d, 0x82,
+    0x6e, 0x01, 0x75, 0x75, 0x81, 0x68, 0x83, 0x60, 0x0a, 0x64, 0x60, 0x60,
+    0x64, 0x66, 0x6c, 0x64, 0x64, 0x5f, 0x5f, 0x31, 0x80, 0x0b, 0x00, 0x0a,
+    0x80, 0x12, 0x85, 0x0b, 0x03, 0x0a, 0x0b, 0x0b, 0x0a, 0x80, 0x12, 0x00,
+    0x0a, 0x86, 0x0b, 0x01, 0x0a, 0x12, 0x80, 0x0b, 0x01, 0x04, 0x04, 0x80,
+    0x0b, 0x01, 0x04, 0x04, 0x82, 0x00, 0x05, 0x14, 0x87, 0xaf, 0x7a, 0x0d,
+    0x22, 0x90, 0x00, 0x02, 0x01, 0x01, 0x06, 0x80, 0x0f, 0x00, 0x05, 0x87,
+    0x0f, 0x81, 0x10, 0x03, 0x17, 0x17, 0x15, 0x1f, 0x86, 0x21, 0x10, 0x27,
+    0x25, 0x2a, 0x2a, 0x2b, 0x2a, 0x2a, 0x30, 0x2f, 0x2b, 0x30, 0x35, 0x35,
+    0x30, 0x35, 0x30, 0x30, 0x86, 0x58, 0x80, 0x4f, 0x91, 0x58, 0x01, 0x4f,
+    0x58, 0x80, 0x4f, 0x82, 0x58, 0x06, 0x5f, 0x56, 0x56, 0x4f, 0x58, 0x56,
+    0x56, 0x81, 0x5f, 0x00, 0x60, 0x80, 0x5f, 0x00, 0x56, 0x81, 0x5f, 0x08,
+    0x56, 0x56, 0x60, 0x56, 0x66, 0x66, 0x56, 0x66, 0x66, 0x81, 0x60, 0x05,
+    0x68, 0x68, 0x70, 0x6e, 0x73, 0x77, 0x80, 0x7e, 0x05, 0x82, 0x47, 0x21,
+    0x07, 0x06, 0x03, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x82,
+    0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x80, 0x00, 0x05, 0x01, 0x03,
+    0x03, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x03, 0x02, 0x01,
+    0x03, 0x03, 0x80, 0x01, 0x84, 0x00, 0x00, 0x01, 0x80, 0x00, 0x16, 0x0f,
+    0x1f, 0x41, 0x35, 0x47, 0xab, 0xce, 0xc5, 0xb8, 0xae, 0xae, 0xa6, 0x9f,
+    0x93, 0x93, 0x8c, 0x8c, 0x87, 0x87, 0x82, 0x7e, 0x7e, 0x77, 0x82, 0x6e,
+    0x84, 0x68, 0x80, 0x60, 0x00, 0x6b, 0x83, 0x60, 0x0f, 0x66, 0x66, 0x56,
+    0x66, 0x64, 0x59, 0x56, 0x31, 0x0c, 0x0a, 0x0b, 0x19, 0x19, 0x23, 0x18,
+    0x0a, 0x80, 0x0b, 0x02, 0x0a, 0x0b, 0x0a, 0x82, 0x0b, 0x03, 0x0a, 0x12,
+    0x0a, 0x0a, 0x8c, 0x0b, 0x00, 0x04, 0x82, 0x0b, 0x80, 0x04, 0x80, 0x00,
+    0x05, 0x13, 0x7f, 0xaf, 0x59, 0x17, 0x05, 0x90, 0x00, 0x03, 0x06, 0x01,
+    0x04, 0x06, 0x8d, 0x0f, 0x81, 0x10, 0x80, 0x17, 0x07, 0x1d, 0x1f, 0x15,
+    0x07, 0x06, 0x02, 0x10, 0x17, 0x81, 0x15, 0x80, 0x1a, 0x00, 0x21, 0x81,
+    0x25, 0x03, 0x2a, 0x2a, 0x25, 0x51, 0x80, 0x58, 0x00, 0x4f, 0x83, 0x58,
+    0x00, 0x4f, 0x9c, 0x58, 0x04, 0x5f, 0x58, 0x5f, 0x56, 0x4f, 0x80, 0x58,
+    0x04, 0x5f, 0x5f, 0x56, 0x5f, 0x5f, 0x80, 0x56, 0x80, 0x5f, 0x85, 0x56,
+    0x09, 0x5f, 0x56, 0x56, 0x66, 0x66, 0x60, 0x5f, 0x66, 0x70, 0x68, 0x81,
+    0x6e, 0x0f, 0x77, 0x71, 0x37, 0x1f, 0x05, 0x01, 0x03, 0x01, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x03, 0x01, 0x01, 0x85, 0x00, 0x03, 0x01, 0x00, 0x00,
+    0x01, 0x87, 0x00, 0x80, 0x01, 0x01, 0x00, 0x01, 0x8a, 0x00, 0x10, 0x06,
+    0x17, 0x31, 0x42, 0x41, 0x7f, 0xc5, 0xc9, 0xb8, 0xae, 0xae, 0xa6, 0x9f,
+    0x9b, 0x93, 0x8c, 0x8c, 0x80, 0x80, 0x07, 0x82, 0x77, 0x77, 0x7d, 0x75,
+    0x6e, 0x71, 0x6e, 0x84, 0x68, 0x04, 0x64, 0x60, 0x64, 0x60, 0x64, 0x81,
+    0x60, 0x12, 0x66, 0x60, 0x56, 0x66, 0x60, 0x64, 0x56, 0x56, 0x59, 0x56,
+    0x47, 0x22, 0x23, 0x38, 0x3a, 0x54, 0x50, 0x2d, 0x18, 0x83, 0x0b, 0x03,
+    0x04, 0x0b, 0x04, 0x0c, 0x83, 0x0b, 0x00, 0x0a, 0x80, 0x0b, 0x81, 0x0a,
+    0x86, 0x0b, 0x00, 0x0a, 0x81, 0x0b, 0x09, 0x04, 0x0b, 0x04, 0x00, 0x00,
+    0x14, 0x7f, 0xaf, 0x41, 0x01, 0x90, 0x00, 0x80, 0x01, 0x02, 0x06, 0x02,
+    0x06, 0x92, 0x0f, 0x07, 0x07, 0x07, 0x06, 0x06, 0x01, 0x01, 0x00, 0x00,
+    0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x09, 0x03, 0x01, 0x01, 0x06, 0x0f,
+    0x07, 0x10, 0x17, 0x51, 0x51, 0x8d, 0x58, 0x05, 0x5d, 0x4f, 0x58, 0x58,
+    0x5d, 0x4f, 0x82, 0x58, 0x00, 0x4f, 0x80, 0x58, 0x00, 0x4f, 0x88, 0x58,
+    0x8a, 0x5f, 0x08, 0x56, 0x56, 0x5f, 0x5f, 0x56, 0x5f, 0x5f, 0x56, 0x56,
+    0x85, 0x5f, 0x02, 0x56, 0x4f, 0x5f, 0x80, 0x60, 0x08, 0x68, 0x6e, 0x75,
+    0x6e, 0x75, 0x5d, 0x2f, 0x17, 0x01, 0x84, 0x00, 0x05, 0x01, 0x01, 0x00,
+    0x00, 0x01, 0x01, 0xa1, 0x00, 0x15, 0x10, 0x2c, 0x37, 0x42, 0x67, 0xb7,
+    0xce, 0xc5, 0xae, 0xae, 0xa6, 0xa6, 0x93, 0x93, 0x91, 0x8c, 0x80, 0x87,
+    0x80, 0x7e, 0x77, 0x7a, 0x80, 0x6e, 0x00, 0x75, 0x83, 0x68, 0x81, 0x60,
+    0x04, 0x64, 0x64, 0x66, 0x6b, 0x64, 0x80, 0x60, 0x1c, 0x64, 0x66, 0x66,
+    0x56, 0x66, 0x5f, 0x59, 0x56, 0x5f, 0x56, 0x56, 0x59, 0x50, 0x54, 0x63,
+    0x5f, 0x59, 0x59, 0x50, 0x3a, 0x13, 0x04, 0x0b, 0x12, 0x0a, 0x0a, 0x0b,
+    0x0b, 0x04, 0x83, 0x0b, 0x00, 0x04, 0x84, 0x0b, 0x00, 0x0a, 0x8f, 0x0b,
+    0x05, 0x04, 0x00, 0x22, 0x82, 0x9f, 0x2c, 0x95, 0x00, 0x02, 0x01, 0x06,
+    0x06, 0x86, 0x0f, 0x82, 0x05, 0x01, 0x02, 0x02, 0x82, 0x06, 0x01, 0x03,
+    0x01, 0x80, 0x00, 0x05, 0x01, 0x06, 0x06, 0x01, 0x01, 0x00, 0x80, 0x01,
+    0x01, 0x00, 0x00, 0x80, 0x06, 0x01, 0x0f, 0x10, 0x82, 0x51, 0x8e, 0x58,
+    0x00, 0x5d, 0x8e, 0x58, 0x02, 0x4f, 0x58, 0x4f, 0x82, 0x58, 0x06, 0x5f,
+    0x59, 0x58, 0x5f, 0x5f, 0x56, 0x4f, 0x80, 0x5f, 0x07, 0x58, 0x56, 0x66,
+    0x5f, 0x56, 0x56, 0x5f, 0x56, 0x82, 0x5f, 0x13, 0x56, 0x5f, 0x56, 0x58,
+    0x4f, 0x4f, 0x58, 0x58, 0x56, 0x5f, 0x5f, 0x66, 0x6b, 0x68, 0x68, 0x70,
+    0x42, 0x27, 0x0f, 0x06, 0x86, 0x00, 0x80, 0x01, 0x05, 0x00, 0x01, 0x01,
+    0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x01, 0x01, 0x93, 0x00, 0x19, 0x02,
+    0x1f, 0x37, 0x30, 0x5b, 0xab, 0xc5, 0xc5, 0xb8, 0xae, 0xa6, 0x9e, 0x93,
+    0x93, 0x8c, 0x8c, 0x87, 0x87, 0x82, 0x7e, 0x7a, 0x73, 0x73, 0x7a, 0x71,
+    0x6e, 0x83, 0x68, 0x01, 0x60, 0x6b, 0x81, 0x60, 0x00, 0x64, 0x80, 0x66,
+    0x04, 0x64, 0x64, 0x56, 0x66, 0x66, 0x80, 0x56, 0x88, 0x5f, 0x81, 0x59,
+    0x0a, 0x4d, 0x41, 0x13, 0x18, 0x38, 0x2d, 0x22, 0x0a, 0x0b, 0x0b, 0x0a,
+    0x82, 0x0b, 0x04, 0x04, 0x04, 0x0b, 0x12, 0x0a, 0x88, 0x0b, 0x04, 0x0a,
+    0x0a, 0x0b, 0x0b, 0x0a, 0x85, 0x0b, 0x04, 0x00, 0x2d, 0x91, 0x87, 0x1d,
+    0x90, 0x00, 0x00, 0x01, 0x80, 0x00, 0x09, 0x01, 0x06, 0x01, 0x03, 0x06,
+    0x0f, 0x0f, 0x10, 0x0f, 0x01, 0x80, 0x04, 0x81, 0x02, 0x04, 0x01, 0x01,
+    0x02, 0x00, 0x06, 0x82, 0x01, 0x03, 0x00, 0x01, 0x00, 0x01, 0x80, 0x00,
+    0x01, 0x01, 0x01, 0x82, 0x06, 0x09, 0x00, 0x00, 0x06, 0x06, 0x51, 0x4e,
+    0x51, 0x51, 0x58, 0x51, 0x81, 0x58, 0x03, 0x4f, 0x58, 0x58, 0x4f, 0x92,
+    0x58, 0x00, 0x4f, 0x80, 0x58, 0x01, 0x4f, 0x4f, 0x89, 0x58, 0x0a, 0x56,
+    0x58, 0x5f, 0x5f, 0x4f, 0x58, 0x4f, 0x5f, 0x56, 0x5f, 0x56, 0x83, 0x5f,
+    0x81, 0x4f, 0x05, 0x58, 0x58, 0x4f, 0x4f, 0x58, 0x4f, 0x80, 0x5f, 0x08,
+    0x66, 0x60, 0x60, 0x68, 0x5d, 0x35, 0x15, 0x06, 0x01, 0x84, 0x00, 0x00,
+    0x01, 0x83, 0x00, 0x0c, 0x01, 0x03, 0x03, 0x01, 0x00, 0x00, 0x01, 0x03,
+    0x01, 0x01, 0x00, 0x00, 0x01, 0x8d, 0x00, 0x13, 0x01, 0x0f, 0x31, 0x35,
+    0x41, 0x94, 0xc5, 0xc5, 0xb8, 0xae, 0xa6, 0xa7, 0x93, 0x93, 0x8c, 0x8c,
+    0x80, 0x87, 0x82, 0x80, 0x80, 0x7a, 0x03, 0x73, 0x6e, 0x71, 0x6e, 0x82,
+    0x68, 0x84, 0x60, 0x05, 0x66, 0x60, 0x66, 0x66, 0x60, 0x60, 0x84, 0x56,
+    0x04, 0x59, 0x5f, 0x5f, 0x56, 0x5f, 0x81, 0x56, 0x11, 0x59, 0x59, 0x5f,
+    0x5f, 0x59, 0x5f, 0x4f, 0x55, 0x47, 0x47, 0x4d, 0x59, 0x47, 0x2d, 0x0a,
+    0x0a, 0x23, 0x0a, 0x80, 0x0b, 0x05, 0x04, 0x04, 0x0b, 0x0b, 0x0a, 0x0a,
+    0x80, 0x0b, 0x00, 0x0a, 0x84, 0x0b, 0x83, 0x0a, 0x0c, 0x0b, 0x0b, 0x0a,
+    0x0b, 0x0a, 0x0a, 0x0b, 0x0b, 0x00, 0x54, 0x96, 0x64, 0x06, 0x94, 0x00,
+    0x0a, 0x01, 0x01, 0x00, 0x01, 0x00, 0x06, 0x06, 0x0f, 0x06, 0x06, 0x01,
+    0x87, 0x00, 0x03, 0x02, 0x04, 0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x00,
+    0x80, 0x01, 0x0a, 0x00, 0x06, 0x06, 0x0f, 0x03, 0x03, 0x06, 0x00, 0x01,
+    0x01, 0x00, 0x84, 0x51, 0x04, 0x58, 0x51, 0x51, 0x58, 0x51, 0x8e, 0x58,
+    0x01, 0x51, 0x51, 0x86, 0x58, 0x00, 0x4f, 0x88, 0x58, 0x02, 0x4f, 0x58,
+    0x4f, 0x82, 0x58, 0x04, 0x56, 0x56, 0x5f, 0x56, 0x5f, 0x80, 0x56, 0x80,
+    0x5f, 0x02, 0x58, 0x4f, 0x4f, 0x81, 0x58, 0x0d, 0x4f, 0x58, 0x58, 0x4f,
+    0x5f, 0x5f, 0x56, 0x56, 0x60, 0x6b, 0x3b, 0x2f, 0x05, 0x01, 0x8e, 0x00,
+    0x80, 0x01, 0x02, 0x00, 0x01, 0x01, 0x80, 0x00, 0x04, 0x01, 0x01, 0x06,
+    0x01, 0x01, 0x88, 0x00, 0x16, 0x02, 0x15, 0x37, 0x37, 0x5b, 0xc5, 0xc5,
+    0xb8, 0xae, 0xae, 0xa7, 0x9e, 0x93, 0x8c, 0x8c, 0x87, 0x83, 0x83, 0x7e,
+    0x77, 0x7a, 0x73, 0x7a, 0x80, 0x6e, 0x04, 0x68, 0x68, 0x71, 0x68, 0x68,
+    0x85, 0x60, 0x0a, 0x66, 0x66, 0x56, 0x60, 0x66, 0x66, 0x60, 0x56, 0x56,
+    0x5f, 0x56, 0x84, 0x5f, 0x0b, 0x56, 0x56, 0x5f, 0x56, 0x56, 0x5f, 0x5f,
+    0x56, 0x59, 0x4f, 0x58, 0x5f, 0x80, 0x59, 0x0a, 0x4f, 0x56, 0x5f, 0x55,
+    0x2d, 0x12, 0x4a, 0x20, 0x0c, 0x0b, 0x0a, 0x86, 0x0b, 0x00, 0x0a, 0x85,
+    0x0b, 0x01, 0x0a, 0x0a, 0x82, 0x0b, 0x0a, 0x0a, 0x0a, 0x0b, 0x0a, 0x0a,
+    0x0b, 0x0b, 0x0c, 0x74, 0x85, 0x31, 0x93, 0x00, 0x00, 0x01, 0x84, 0x00,
+    0x00, 0x01, 0x80, 0x06, 0x03, 0x01, 0x03, 0x00, 0x01, 0x81, 0x00, 0x03,
+    0x03, 0x01, 0x00, 0x01, 0x84, 0x00, 0x0d, 0x01, 0x03, 0x01, 0x01, 0x00,
+    0x00, 0x03, 0x06, 0x00, 0x01, 0x01, 0x00, 0x03, 0x03, 0x86, 0x51, 0x02,
+    0x58, 0x51, 0x51, 0x81, 0x58, 0x00, 0x51, 0x8e, 0x58, 0x00, 0x4f, 0x82,
+    0x58, 0x03, 0x4f, 0x58, 0x4f, 0x5d, 0x80, 0x58, 0x09, 0x4f, 0x58, 0x58,
+    0x4f, 0x5f, 0x58, 0x4f, 0x4f, 0x58, 0x58, 0x80, 0x5f, 0x80, 0x58, 0x0b,
+    0x4f, 0x56, 0x4f, 0x56, 0x4f, 0x4f, 0x58, 0x4f, 0x58, 0x58, 0x4f, 0x4f,
+    0x83, 0x58, 0x00, 0x4f, 0x80, 0x58, 0x09, 0x4f, 0x56, 0x60, 0x59, 0x41,
+    0x17, 0x02, 0x00, 0x01, 0x01, 0x8a, 0x00, 0x01, 0x01, 0x01, 0x80, 0x00,
+    0x02, 0x01, 0x03, 0x01, 0x82, 0x00, 0x81, 0x01, 0x01, 0x00, 0x01, 0x81,
+    0x00, 0x0f, 0x01, 0x00, 0x07, 0x27, 0x35, 0x47, 0x94, 0xce, 0xc5, 0xb8,
+    0xae, 0xa7, 0x9f, 0x9b, 0x95, 0x8c, 0x81, 0x80, 0x01, 0x77, 0x7a, 0x81,
+    0x6e, 0x05, 0x71, 0x68, 0x68, 0x71, 0x68, 0x68, 0x86, 0x60, 0x80, 0x66,
+    0x07, 0x56, 0x56, 0x66, 0x5f, 0x56, 0x56, 0x59, 0x56, 0x80, 0x5f, 0x00,
+    0x56, 0x82, 0x5f, 0x0c, 0x56, 0x5f, 0x56, 0x56, 0x66, 0x64, 0x64, 0x56,
+    0x4f, 0x58, 0x5f, 0x59, 0x58, 0x80, 0x4f, 0x08, 0x5f, 0x56, 0x71, 0x47,
+    0x59, 0x3a, 0x0a, 0x0a, 0x12, 0x82, 0x0b, 0x00, 0x0a, 0x80, 0x0b, 0x00,
+    0x0a, 0x86, 0x0b, 0x07, 0x0a, 0x0b, 0x0a, 0x0b, 0x0a, 0x0b, 0x0b, 0x12,
+    0x81, 0x0a, 0x05, 0x0b, 0x0b, 0x38, 0x6c, 0x64, 0x17, 0x88, 0x00, 0x00,
+    0x01, 0x83, 0x00, 0x00, 0x01, 0x89, 0x00, 0x07, 0x01, 0x01, 0x0f, 0x0f,
+    0x06, 0x06, 0x01, 0x01, 0x80, 0x00, 0x00, 0x01, 0x82, 0x00, 0x02, 0x01,
+    0x03, 0x01, 0x82, 0x00, 0x02, 0x03, 0x00, 0x01, 0x82, 0x00, 0x01, 0x06,
+    0x01, 0x80, 0x4d, 0x01, 0x51, 0x4d, 0x84, 0x51, 0x00, 0x58, 0x82, 0x51,
+    0x02, 0x58, 0x4f, 0x58, 0x81, 0x51, 0x02, 0x4f, 0x4f, 0x51, 0x83, 0x58,
+    0x00, 0x51, 0x85, 0x58, 0x04, 0x59, 0x4f, 0x58, 0x4f, 0x4f, 0x84, 0x58,
+    0x01, 0x4f, 0x4f, 0x80, 0x58, 0x05, 0x4f, 0x4f, 0x58, 0x58, 0x4f, 0x5f,
+    0x82, 0x4f, 0x01, 0x58, 0x58, 0x80, 0x4f, 0x81, 0x58, 0x03, 0x4f, 0x46,
+    0x51, 0x51, 0x80, 0x46, 0x04, 0x4f, 0x59, 0x35, 0x27, 0x06, 0x80, 0x00,
+    0x02, 0x03, 0x01, 0x01, 0x9e, 0x00, 0x0e, 0x06, 0x15, 0x2a, 0x3b, 0x71,
+    0xc5, 0xc5, 0xb8, 0xae, 0xa6, 0x9e, 0x93, 0x93, 0x91, 0x8c, 0x80, 0x80,
+    0x03, 0x82, 0x73, 0x7a, 0x7a, 0x80, 0x6e, 0x82, 0x68, 0x81, 0x60, 0x00,
+    0x66, 0x83, 0x60, 0x06, 0x66, 0x56, 0x5f, 0x56, 0x56, 0x5f, 0x5f, 0x81,
+    0x56, 0x81, 0x5f, 0x00, 0x56, 0x80, 0x5f, 0x08, 0x56, 0x56, 0x59, 0x59,
+    0x5f, 0x5f, 0x59, 0x56, 0x56, 0x82, 0x59, 0x81, 0x4f, 0x08, 0x59, 0x46,
+    0x5f, 0x4f, 0x59, 0x3a, 0x38, 0x4a, 0x22, 0x81, 0x0b, 0x01, 0x0a, 0x0a,
+    0x8a, 0x0b, 0x80, 0x0a, 0x04, 0x0b, 0x0b, 0x0a, 0x0a, 0x12, 0x81, 0x0a,
+    0x05, 0x0b, 0x0b, 0x5b, 0x59, 0x2f, 0x02, 0x96, 0x00, 0x00, 0x01, 0x85,
+    0x00, 0x05, 0x03, 0x02, 0x06, 0x01, 0x00, 0x00, 0x82, 0x01, 0x83, 0x00,
+    0x11, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x01, 0x01, 0x03, 0x51, 0x55, 0x4e, 0x4e, 0x89, 0x51, 0x03, 0x46, 0x46,
+    0x4f, 0x58, 0x80, 0x51, 0x02, 0x46, 0x46, 0x4f, 0x83, 0x51, 0x00, 0x58,
+    0x81, 0x51, 0x81, 0x58, 0x02, 0x51, 0x51, 0x4f, 0x84, 0x58, 0x01, 0x4f,
+    0x51, 0x81, 0x4f, 0x80, 0x58, 0x00, 0x4f, 0x85, 0x58, 0x03, 0x4f, 0x58,
+    0x58, 0x4f, 0x80, 0x58, 0x06, 0x51, 0x51, 0x46, 0x51, 0x51, 0x4e, 0x46,
+    0x83, 0x4d, 0x0a, 0x41, 0x2c, 0x10, 0x00, 0x04, 0x01, 0x03, 0x00, 0x03,
+    0x01, 0x01, 0x9b, 0x00, 0x1c, 0x0f, 0x1f, 0x2f, 0x5b, 0xa4, 0xc2, 0xb8,
+    0xae, 0xae, 0xa6, 0x93, 0x93, 0x8c, 0x8c, 0x83, 0x87, 0x82, 0x80, 0x77,
+    0x7a, 0x7a, 0x71, 0x6e, 0x68, 0x71, 0x68, 0x68, 0x64, 0x64, 0x89, 0x60,
+    0x83, 0x56, 0x01, 0x5f, 0x5f, 0x89, 0x56, 0x00, 0x58, 0x81, 0x56, 0x0a,
+    0x4f, 0x56, 0x4f, 0x56, 0x4f, 0x4f, 0x56, 0x58, 0x4f, 0x4f, 0x46, 0x80,
+    0x4f, 0x08, 0x58, 0x58, 0x5d, 0x58, 0x56, 0x56, 0x4f, 0x4d, 0x2d, 0x82,
+    0x0a, 0x02, 0x0b, 0x0a, 0x0a, 0x81, 0x0b, 0x00, 0x0a, 0x82, 0x0b, 0x81,
+    0x0a, 0x0d, 0x0b, 0x0b, 0x0a, 0x0a, 0x12, 0x12, 0x0a, 0x0a, 0x0b, 0x0a,
+    0x22, 0x5f, 0x59, 0x15, 0x87, 0x00, 0x00, 0x01, 0x9b, 0x00, 0x04, 0x01,
+    0x01, 0x00, 0x01, 0x01, 0x81, 0x00, 0x80, 0x01, 0x03, 0x00, 0x01, 0x01,
+    0x03, 0x80, 0x01, 0x05, 0x00, 0x00, 0x01, 0x00, 0x06, 0x51, 0x83, 0x4d,
+    0x06, 0x51, 0x4e, 0x4e, 0x51, 0x51, 0x46, 0x4e, 0x87, 0x51, 0x01, 0x46,
+    0x46, 0x8b, 0x51, 0x80, 0x58, 0x03, 0x51, 0x51, 0x58, 0x51, 0x80, 0x58,
+    0x00, 0x4f, 0x90, 0x58, 0x80, 0x4f, 0x80, 0x58, 0x03, 0x51, 0x4e, 0x46,
+    0x51, 0x81, 0x4d, 0x80, 0x48, 0x04, 0x44, 0x49, 0x4d, 0x27, 0x1f, 0x80,
+    0x01, 0x00, 0x03, 0x84, 0x01, 0x8f, 0x00, 0x00, 0x01, 0x84, 0x00, 0x0c,
+    0x17, 0x27, 0x41, 0x86, 0xb1, 0xc5, 0xb8, 0xae, 0xa6, 0x9e, 0x93, 0x8c,
+    0x8c, 0x80, 0x80, 0x02, 0x82, 0x7a, 0x7a, 0x80, 0x6e, 0x0b, 0x71, 0x68,
+    0x68, 0x64, 0x68, 0x60, 0x64, 0x60, 0x64, 0x60, 0x60, 0x64, 0x80, 0x60,
+    0x00, 0x66, 0x84, 0x56, 0x01, 0x59, 0x59, 0x84, 0x56, 0x00, 0x5f, 0x80,
+    0x56, 0x05, 0x5f, 0x56, 0x5f, 0x56, 0x5f, 0x58, 0x81, 0x56, 0x09, 0x59,
+    0x56, 0x4f, 0x4f, 0x58, 0x5f, 0x58, 0x59, 0x58, 0x51, 0x80, 0x4f, 0x0f,
+    0x58, 0x58, 0x4f, 0x58, 0x58, 0x4f, 0x4f, 0x58, 0x46, 0x31, 0x22, 0x12,
+    0x22, 0x20, 0x0b, 0x0a, 0x80, 0x0b, 0x00, 0x0a, 0x86, 0x0b, 0x80, 0x0a,
+    0x02, 0x0b, 0x12, 0x0a, 0x80, 0x12, 0x09, 0x0a, 0x0b, 0x0a, 0x0a, 0x47,
+    0x6b, 0x37, 0x02, 0x00, 0x01, 0x92, 0x00, 0x00, 0x01, 0x96, 0x00, 0x00,
+    0x01, 0x82, 0x00, 0x03, 0x01, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01,
+    0x88, 0x4d, 0x02, 0x51, 0x4e, 0x4d, 0x84, 0x51, 0x07, 0x55, 0x51, 0x51,
+    0x46, 0x51, 0x46, 0x51, 0x46, 0x83, 0x51, 0x00, 0x46, 0x81, 0x51, 0x01,
+    0x58, 0x58, 0x82, 0x51, 0x01, 0x4f, 0x4f, 0x84, 0x58, 0x05, 0x4f, 0x58,
+    0x58, 0x51, 0x58, 0x51, 0x89, 0x58, 0x03, 0x51, 0x4f, 0x4f, 0x51, 0x82,
+    0x4d, 0x00, 0x48, 0x80, 0x44, 0x12, 0x31, 0x31, 0x41, 0x2c, 0x21, 0x06,
+    0x00, 0x00, 0x01, 0x02, 0x06, 0x06, 0x01, 0x01, 0x06, 0x03, 0x01, 0x03,
+    0x01, 0x90, 0x00, 0x14, 0x01, 0x00, 0x06, 0x1f, 0x2a, 0x67, 0xae, 0xc5,
+    0xb8, 0xae, 0xa6, 0xa7, 0x93, 0x93, 0x8c, 0x80, 0x80, 0x82, 0x82, 0x7a,
+    0x7a, 0x80, 0x6e, 0x01, 0x71, 0x71, 0x80, 0x68, 0x00, 0x6b, 0x85, 0x60,
+    0x03, 0x56, 0x66, 0x66, 0x5f, 0x81, 0x56, 0x02, 0x5f, 0x56, 0x5f, 0x80,
+    0x56, 0x02, 0x5f, 0x56, 0x59, 0x80, 0x56, 0x00, 0x5f, 0x81, 0x56, 0x01,
+    0x58, 0x5f, 0x82, 0x56, 0x80, 0x4f, 0x05, 0x56, 0x4f, 0x4f, 0x58, 0x5f,
+    0x4f, 0x81, 0x58, 0x01, 0x4f, 0x58, 0x83, 0x4f, 0x0a, 0x58, 0x4f, 0x58,
+    0x55, 0x4d, 0x47, 0x4d, 0x41, 0x13, 0x0b, 0x04, 0x81, 0x0a, 0x00, 0x0b,
+    0x80, 0x0a, 0x80, 0x0b, 0x81, 0x0a, 0x00, 0x0b, 0x82, 0x12, 0x81, 0x0a,
+    0x04, 0x22, 0x6c, 0x59, 0x15, 0x06, 0x80, 0x00, 0x03, 0x01, 0x00, 0x00,
+    0x01, 0x85, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x01, 0x00, 0x01, 0x81,
+    0x00, 0x80, 0x01, 0x9a, 0x00, 0x01, 0x01, 0x00, 0x8b, 0x4d, 0x02, 0x51,
+    0x46, 0x4e, 0x85, 0x51, 0x03, 0x46, 0x51, 0x51, 0x46, 0x88, 0x51, 0x01,
+    0x46, 0x46, 0x80, 0x51, 0x03, 0x46, 0x46, 0x51, 0x51, 0x80, 0x58, 0x15,
+    0x4f, 0x58, 0x58, 0x51, 0x4f, 0x51, 0x58, 0x51, 0x58, 0x4f, 0x4f, 0x58,
+    0x58, 0x4f, 0x58, 0x58, 0x4f, 0x4f, 0x58, 0x58, 0x51, 0x58, 0x80, 0x51,
+    0x80, 0x4d, 0x0f, 0x40, 0x48, 0x44, 0x44, 0x40, 0x40, 0x44, 0x3a, 0x18,
+    0x13, 0x3a, 0x1d, 0x0f, 0x00, 0x00, 0x01, 0x85, 0x06, 0x81, 0x01, 0x02,
+    0x03, 0x03, 0x01, 0x84, 0x00, 0x00, 0x01, 0x83, 0x00, 0x13, 0x06, 0x0f,
+    0x1f, 0x37, 0x86, 0xc5, 0xb8, 0xae, 0xae, 0xa6, 0x93, 0x9b, 0x8c, 0x8c,
+    0x80, 0x80, 0x82, 0x77, 0x7a, 0x7a, 0x80, 0x6e, 0x81, 0x68, 0x83, 0x60,
+    0x07, 0x66, 0x56, 0x60, 0x56, 0x60, 0x56, 0x56, 0x5f, 0x83, 0x56, 0x00,
+    0x59, 0x80, 0x56, 0x06, 0x5f, 0x59, 0x56, 0x56, 0x5f, 0x4f, 0x59, 0x82,
+    0x56, 0x01, 0x58, 0x56, 0x80, 0x4f, 0x0c, 0x59, 0x59, 0x4f, 0x59, 0x4f,
+    0x4f, 0x58, 0x4f, 0x4f, 0x58, 0x58, 0x4f, 0x4f, 0x80, 0x58, 0x82, 0x4f,
+    0x12, 0x58, 0x4f, 0x4f, 0x58, 0x4f, 0x4f, 0x59, 0x58, 0x4f, 0x58, 0x47,
+    0x31, 0x18, 0x2d, 0x18, 0x12, 0x23, 0x22, 0x0a, 0x81, 0x0b, 0x06, 0x0a,
+    0x0b, 0x0a, 0x0a, 0x0b, 0x0a, 0x0a, 0x82, 0x12, 0x08, 0x0a, 0x0a, 0x12,
+    0x12, 0x54, 0x74, 0x2c, 0x0c, 0x06, 0x81, 0x00, 0x03, 0x01, 0x00, 0x01,
+    0x01, 0x8c, 0x00, 0x05, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x81, 0x00,
+    0x00, 0x01, 0x91, 0x00, 0x01, 0x01, 0x01, 0x83, 0x00, 0x88, 0x4d, 0x00,
+    0x46, 0x83, 0x4d, 0x04, 0x51, 0x51, 0x46, 0x51, 0x51, 0x80, 0x46, 0x80,
+    0x51, 0x03, 0x58, 0x58, 0x51, 0x46, 0x86, 0x51, 0x02, 0x46, 0x51, 0x46,
+    0x81, 0x51, 0x81, 0x58, 0x01, 0x4f, 0x58, 0x82, 0x51, 0x82, 0x58, 0x07,
+    0x4f, 0x58, 0x4f, 0x4f, 0x58, 0x58, 0x4f, 0x4f, 0x81, 0x51, 0x80, 0x4d,
+    0x0f, 0x48, 0x44, 0x44, 0x40, 0x40, 0x3e, 0x3b, 0x22, 0x0b, 0x04, 0x3a,
+    0x17, 0x0f, 0x00, 0x00, 0x01, 0x86, 0x06, 0x04, 0x01, 0x01, 0x06, 0x03,
+    0x03, 0x81, 0x01, 0x80, 0x03, 0x03, 0x00, 0x01, 0x03, 0x00, 0x80, 0x01,
+    0x19, 0x02, 0x17, 0x2c, 0x5b, 0xb1, 0xc5, 0xb8, 0xae, 0xa6, 0x9e, 0x93,
+    0x8c, 0x8c, 0x80, 0x80, 0x82, 0x80, 0x77, 0x7a, 0x77, 0x7a, 0x71, 0x70,
+    0x68, 0x68, 0x64, 0x84, 0x60, 0x00, 0x64, 0x82, 0x56, 0x00, 0x59, 0x85,
+    0x56, 0x03, 0x59, 0x56, 0x56, 0x59, 0x81, 0x56, 0x00, 0x59, 0x80, 0x56,
+    0x02, 0x4f, 0x56, 0x56, 0x81, 0x4f, 0x00, 0x58, 0x81, 0x4f, 0x03, 0x59,
+    0x4f, 0x4f, 0x59, 0x80, 0x58, 0x02, 0x4f, 0x4f, 0x59, 0x83, 0x4f, 0x13,
+    0x59, 0x4f, 0x58, 0x58, 0x4f, 0x51, 0x46, 0x4d, 0x4d, 0x51, 0x4f, 0x4f,
+    0x58, 0x58, 0x5f, 0x5f, 0x4d, 0x50, 0x5d, 0x4d, 0x80, 0x0a, 0x81, 0x0b,
+    0x04, 0x0a, 0x18, 0x18, 0x0a, 0x0a, 0x82, 0x12, 0x0a, 0x0a, 0x0a, 0x12,
+    0x12, 0x38, 0x63, 0x49, 0x17, 0x06, 0x03, 0x01, 0x94, 0x00, 0x81, 0x01,
+    0x90, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x8d, 0x4d, 0x01, 0x46, 0x4e, 0x80,
+    0x51, 0x03, 0x4e, 0x4e, 0x51, 0x55, 0x80, 0x51, 0x00, 0x4e, 0x8a, 0x51,
+    0x00, 0x46, 0x87, 0x51, 0x02, 0x58, 0x51, 0x4f, 0x82, 0x51, 0x02, 0x4f,
+    0x58, 0x51, 0x82, 0x4f, 0x03, 0x58, 0x58, 0x51, 0x4f, 0x82, 0x51, 0x01,
+    0x4e, 0x48, 0x80, 0x44, 0x0c, 0x40, 0x40, 0x3e, 0x37, 0x18, 0x0a, 0x0b,
+    0x2c, 0x20, 0x0f, 0x06, 0x00, 0x01, 0x80, 0x0f, 0x89, 0x06, 0x17, 0x01,
+    0x06, 0x01, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x01, 0x06, 0x0f,
+    0x15, 0x3a, 0x86, 0xc5, 0xc2, 0xae, 0xa6, 0xa6, 0x93, 0x93, 0x8c, 0x81,
+    0x80, 0x05, 0x77, 0x7a, 0x7a, 0x71, 0x73, 0x6e, 0x80, 0x68, 0x02, 0x60,
+    0x64, 0x64, 0x81, 0x60, 0x82, 0x56, 0x01, 0x59, 0x5f, 0x80, 0x56, 0x02,
+    0x5f, 0x56, 0x5f, 0x88, 0x56, 0x03, 0x4f, 0x59, 0x59, 0x56, 0x82, 0x4f,
+    0x02, 0x56, 0x59, 0x59, 0x81, 0x4f, 0x08, 0x59, 0x4f, 0x4f, 0x58, 0x4f,
+    0x4f, 0x58, 0x4f, 0x58, 0x81, 0x4f, 0x05, 0x58, 0x46, 0x46, 0x59, 0x59,
+    0x58, 0x80, 0x4f, 0x01, 0x59, 0x4f, 0x80, 0x58, 0x02, 0x4f, 0x58, 0x58,
+    0x81, 0x4f, 0x0d, 0x58, 0x58, 0x5f, 0x31, 0x0b, 0x0b, 0x18, 0x18, 0x0a,
+    0x0a, 0x12, 0x2d, 0x3a, 0x18, 0x80, 0x12, 0x03, 0x23, 0x12, 0x12, 0x0a,
+    0x80, 0x12, 0x11, 0x2d, 0x50, 0x5d, 0x27, 0x17, 0x01, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x01, 0x03, 0x01, 0x01, 0x00, 0x01, 0x01, 0x93, 0x00, 0x01,
+    0x01, 0x01, 0x80, 0x00, 0x80, 0x01, 0x8d, 0x00, 0x02, 0x01, 0x00, 0x00,
+    0x8d, 0x4d, 0x00, 0x46, 0x85, 0x4d, 0x80, 0x51, 0x83, 0x4d, 0x83, 0x51,
+    0x00, 0x4e, 0x96, 0x51, 0x06, 0x4f, 0x58, 0x58, 0x5f, 0x58, 0x51, 0x46,
+    0x82, 0x51, 0x15, 0x4e, 0x48, 0x44, 0x44, 0x40, 0x40, 0x3b, 0x3e, 0x37,
+    0x18, 0x0b, 0x0b, 0x1f, 0x21, 0x0f, 0x03, 0x00, 0x01, 0x06, 0x10, 0x07,
+    0x07, 0x82, 0x0f, 0x86, 0x06, 0x00, 0x01, 0x81, 0x06, 0x15, 0x01, 0x03,
+    0x02, 0x07, 0x27, 0x61, 0xab, 0xc5, 0xb8, 0xae, 0x9e, 0x9e, 0x9b, 0x95,
+    0x8c, 0x80, 0x82, 0x82, 0x7a, 0x7a, 0x73, 0x6e, 0x80, 0x71, 0x02, 0x68,
+    0x6e, 0x71, 0x82, 0x60, 0x80, 0x56, 0x02, 0x5f, 0x56, 0x59, 0x80, 0x56,
+    0x03, 0x5f, 0x5f, 0x58, 0x5f, 0x80, 0x56, 0x00, 0x5f, 0x80, 0x4f, 0x06,
+    0x56, 0x4f, 0x56, 0x56, 0x4f, 0x4f, 0x58, 0x81, 0x4f, 0x00, 0x58, 0x80,
+    0x4f, 0x06, 0x58, 0x4f, 0x4f, 0x58, 0x58, 0x4f, 0x58, 0x80, 0x4f, 0x06,
+    0x58, 0x58, 0x4f, 0x4f, 0x58, 0x4f, 0x58, 0x81, 0x4f, 0x03, 0x46, 0x51,
+    0x58, 0x4f, 0x82, 0x58, 0x06, 0x4f, 0x58, 0x58, 0x4f, 0x58, 0x4f, 0x4f,
+    0x85, 0x58, 0x0f, 0x55, 0x22, 0x18, 0x3a, 0x47, 0x3a, 0x2d, 0x22, 0x4d,
+    0x58, 0x47, 0x18, 0x12, 0x12, 0x38, 0x18, 0x82, 0x12, 0x09, 0x3a, 0x55,
+    0x55, 0x2f, 0x1f, 0x06, 0x01, 0x03, 0x02, 0x06, 0x82, 0x01, 0x05, 0x03,
+    0x01, 0x01, 0x00, 0x01, 0x01, 0x8b, 0x00, 0x17, 0x01, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x01, 0x03,
+    0x00, 0x00, 0x01, 0x03, 0x01, 0x01, 0x00, 0x00, 0x80, 0x01, 0x04, 0x03,
+    0x01, 0x03, 0x01, 0x00, 0x8e, 0x4d, 0x00, 0x46, 0x86, 0x4d, 0x06, 0x51,
+    0x51, 0x4e, 0x4e, 0x51, 0x51, 0x4e, 0x81, 0x51, 0x00, 0x4e, 0x95, 0x51,
+    0x08, 0x4f, 0x51, 0x4f, 0x51, 0x51, 0x58, 0x58, 0x51, 0x46, 0x82, 0x51,
+    0x80, 0x4d, 0x12, 0x48, 0x44, 0x44, 0x3e, 0x42, 0x3e, 0x31, 0x12, 0x0b,
+    0x0b, 0x1f, 0x0e, 0x0f, 0x01, 0x01, 0x00, 0x06, 0x10, 0x0d, 0x80, 0x10,
+    0x01, 0x0d, 0x07, 0x83, 0x0f, 0x85, 0x06, 0x15, 0x03, 0x03, 0x02, 0x10,
+    0x31, 0x94, 0xc5, 0xb8, 0xae, 0x9e, 0x9e, 0x93, 0x93, 0x8c, 0x87, 0x87,
+    0x7e, 0x82, 0x7a, 0x7a, 0x73, 0x6e, 0x83, 0x68, 0x80, 0x60, 0x00, 0x66,
+    0x82, 0x56, 0x06, 0x5f, 0x5f, 0x56, 0x56, 0x5f, 0x5f, 0x4f, 0x80, 0x58,
+    0x03, 0x56, 0x56, 0x4f, 0x58, 0x80, 0x4f, 0x01, 0x56, 0x58, 0x81, 0x4f,
+    0x01, 0x58, 0x58, 0x82, 0x4f, 0x00, 0x58, 0x80, 0x4f, 0x07, 0x58, 0x4f,
+    0x58, 0x4f, 0x58, 0x58, 0x4f, 0x4f, 0x82, 0x58, 0x80, 0x4f, 0x08, 0x58,
+    0x58, 0x46, 0x4d, 0x4f, 0x58, 0x4f, 0x58, 0x4f, 0x81, 0x58, 0x02, 0x4f,
+    0x58, 0x58, 0x80, 0x4f, 0x01, 0x58, 0x4f, 0x83, 0x58, 0x1e, 0x4f, 0x4d,
+    0x4d, 0x46, 0x58, 0x58, 0x4e, 0x49, 0x58, 0x51, 0x58, 0x47, 0x31, 0x23,
+    0x47, 0x2d, 0x12, 0x12, 0x2d, 0x22, 0x18, 0x47, 0x49, 0x55, 0x3b, 0x21,
+    0x07, 0x01, 0x00, 0x01, 0x02, 0x82, 0x06, 0x05, 0x01, 0x06, 0x03, 0x01,
+    0x00, 0x03, 0x82, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x03, 0x01, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x01, 0x01, 0x81, 0x00, 0x82, 0x48,
+    0x93, 0x4d, 0x02, 0x51, 0x58, 0x51, 0x83, 0x4d, 0x0a, 0x51, 0x4e, 0x51,
+    0x4e, 0x51, 0x4e, 0x51, 0x51, 0x4e, 0x51, 0x4e, 0x85, 0x51, 0x00, 0x46,
+    0x85, 0x51, 0x07, 0x46, 0x51, 0x46, 0x51, 0x58, 0x4f, 0x4f, 0x46, 0x82,
+    0x51, 0x19, 0x46, 0x4e, 0x40, 0x48, 0x40, 0x44, 0x3e, 0x3b, 0x35, 0x22,
+    0x0a, 0x0b, 0x0b, 0x07, 0x09, 0x06, 0x01, 0x00, 0x00, 0x06, 0x15, 0x15,
+    0x1d, 0x15, 0x0d, 0x15, 0x81, 0x10, 0x84, 0x0f, 0x80, 0x06, 0x19, 0x00,
+    0x01, 0x02, 0x17, 0x54, 0xb1, 0xc2, 0xb8, 0xae, 0xa7, 0x9f, 0x93, 0x8c,
+    0x80, 0x80, 0x7e, 0x82, 0x77, 0x73, 0x7a, 0x71, 0x68, 0x68, 0x71, 0x68,
+    0x68, 0x81, 0x60, 0x81, 0x56, 0x09, 0x59, 0x56, 0x56, 0x5f, 0x5f, 0x58,
+    0x56, 0x5f, 0x56, 0x58, 0x81, 0x4f, 0x01, 0x58, 0x58, 0x81, 0x4f, 0x03,
+    0x58, 0x4f, 0x58, 0x58, 0x80, 0x4f, 0x81, 0x58, 0x81, 0x4f, 0x00, 0x58,
+    0x88, 0x4f, 0x03, 0x59, 0x58, 0x51, 0x58, 0x80, 0x4f, 0x03, 0x58, 0x58,
+    0x46, 0x46, 0x81, 0x58, 0x80, 0x4f, 0x80, 0x58, 0x02, 0x4f, 0x4f, 0x58,
+    0x82, 0x4f, 0x83, 0x58, 0x80, 0x4f, 0x82, 0x58, 0x80, 0x51, 0x13, 0x4e,
+    0x43, 0x4e, 0x3a, 0x19, 0x12, 0x42, 0x41, 0x22, 0x3a, 0x49, 0x55, 0x49,
+    0x27, 0x15, 0x03, 0x00, 0x01, 0x06, 0x02, 0x85, 0x06, 0x0c, 0x01, 0x06,
+    0x03, 0x03, 0x01, 0x06, 0x02, 0x03, 0x03, 0x01, 0x00, 0x00, 0x01, 0x84,
+    0x00, 0x80, 0x01, 0x88, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x86,
+    0x00, 0x03, 0x48, 0x4c, 0x48, 0x48, 0x95, 0x4d, 0x00, 0x51, 0x83, 0x4d,
+    0x00, 0x46, 0x87, 0x4d, 0x81, 0x51, 0x04, 0x4e, 0x51, 0x46, 0x51, 0x46,
+    0x82, 0x51, 0x00, 0x46, 0x81, 0x51, 0x00, 0x46, 0x80, 0x51, 0x00, 0x58,
+    0x83, 0x51, 0x80, 0x4d, 0x02, 0x48, 0x48, 0x44, 0x80, 0x3b, 0x07, 0x35,
+    0x22, 0x0a, 0x04, 0x0b, 0x0d, 0x09, 0x02, 0x80, 0x00, 0x04, 0x02, 0x15,
+    0x15, 0x1d, 0x1d, 0x80, 0x15, 0x02, 0x17, 0x0d, 0x17, 0x81, 0x10, 0x15,
+    0x07, 0x10, 0x10, 0x0f, 0x02, 0x01, 0x06, 0x0f, 0x27, 0x7f, 0xc5, 0xb8,
+    0xae, 0xa6, 0x9c, 0x9b, 0x8c, 0x91, 0x87, 0x80, 0x82, 0x7a, 0x81, 0x6e,
+    0x81, 0x68, 0x82, 0x60, 0x81, 0x56, 0x82, 0x5f, 0x08, 0x58, 0x4f, 0x5f,
+    0x56, 0x4f, 0x56, 0x4f, 0x4f, 0x56, 0x80, 0x58, 0x05, 0x4f, 0x4f, 0x58,
+    0x58, 0x4f, 0x58, 0x84, 0x4f, 0x05, 0x58, 0x4f, 0x59, 0x4f, 0x58, 0x58,
+    0x80, 0x4f, 0x80, 0x58, 0x02, 0x4f, 0x4f, 0x58, 0x80, 0x4f, 0x04, 0x59,
+    0x51, 0x46, 0x4f, 0x4f, 0x80, 0x58, 0x04, 0x4f, 0x46, 0x51, 0x58, 0x58,
+    0x82, 0x4f, 0x83, 0x58, 0x80, 0x4f, 0x80, 0x58, 0x05, 0x4f, 0x58, 0x58,
+    0x4f, 0x58, 0x58, 0x82, 0x4f, 0x04, 0x58, 0x51, 0x4f, 0x51, 0x51, 0x80,
+    0x4d, 0x12, 0x49, 0x23, 0x19, 0x3b, 0x49, 0x3a, 0x3a, 0x42, 0x49, 0x55,
+    0x2b, 0x15, 0x01, 0x00, 0x00, 0x02, 0x06, 0x06, 0x02, 0x8a, 0x06, 0x00,
+    0x01, 0x81, 0x03, 0x02, 0x01, 0x03, 0x01, 0x8b, 0x00, 0x00, 0x01, 0x88,
+    0x00, 0x00, 0x01, 0x83, 0x00, 0x03, 0x48, 0x48, 0x4c, 0x48, 0x9f, 0x4d,
+    0x00, 0x46, 0x81, 0x4d, 0x06, 0x51, 0x51, 0x4e, 0x4e, 0x51, 0x51, 0x46,
+    0x81, 0x51, 0x00, 0x4e, 0x87, 0x51, 0x80, 0x46, 0x01, 0x4f, 0x58, 0x84,
+    0x51, 0x1c, 0x4e, 0x4e, 0x48, 0x44, 0x44, 0x3e, 0x42, 0x42, 0x37, 0x22,
+    0x0a, 0x0b, 0x0b, 0x02, 0x0d, 0x04, 0x00, 0x00, 0x01, 0x02, 0x15, 0x1d,
+    0x1d, 0x15, 0x15, 0x1a, 0x1d, 0x15, 0x1d, 0x81, 0x15, 0x1c, 0x1d, 0x1d,
+    0x15, 0x07, 0x01, 0x01, 0x06, 0x17, 0x3a, 0xa4, 0xc2, 0xb8, 0xae, 0xa7,
+    0x9c, 0x95, 0x91, 0x87, 0x87, 0x7e, 0x77, 0x73, 0x7a, 0x6e, 0x71, 0x68,
+    0x71, 0x71, 0x68, 0x82, 0x60, 0x00, 0x66, 0x80, 0x56, 0x0e, 0x5f, 0x5f,
+    0x56, 0x56, 0x5f, 0x5f, 0x56, 0x56, 0x4f, 0x56, 0x4f, 0x58, 0x4f, 0x4f,
+    0x58, 0x80, 0x4f, 0x03, 0x59, 0x4f, 0x58, 0x58, 0x80, 0x4f, 0x00, 0x58,
+    0x84, 0x4f, 0x03, 0x59, 0x4f, 0x4f, 0x58, 0x80, 0x4f, 0x04, 0x58, 0x58,
+    0x59, 0x4f, 0x4f, 0x80, 0x58, 0x80, 0x4f, 0x11, 0x5d, 0x4d, 0x4f, 0x4d,
+    0x46, 0x58, 0x58, 0x4f, 0x46, 0x46, 0x4f, 0x4f, 0x58, 0x4f, 0x58, 0x58,
+    0x4f, 0x4f, 0x80, 0x58, 0x81, 0x4f, 0x83, 0x58, 0x00, 0x4f, 0x80, 0x58,
+    0x81, 0x4f, 0x80, 0x58, 0x01, 0x51, 0x51, 0x81, 0x4d, 0x0f, 0x48, 0x44,
+    0x22, 0x43, 0x43, 0x49, 0x43, 0x42, 0x42, 0x49, 0x30, 0x1f, 0x06, 0x00,
+    0x00, 0x02, 0x84, 0x06, 0x00, 0x02, 0x85, 0x06, 0x01, 0x03, 0x01, 0x81,
+    0x03, 0x04, 0x01, 0x01, 0x00, 0x00, 0x01, 0x9b, 0x00, 0x82, 0x48, 0x83,
+    0x4d, 0x01, 0x48, 0x48, 0x91, 0x4d, 0x00, 0x46, 0x82, 0x4d, 0x04, 0x46,
+    0x4e, 0x51, 0x4e, 0x46, 0x82, 0x4d, 0x04, 0x51, 0x51, 0x4e, 0x4e, 0x46,
+    0x88, 0x51, 0x07, 0x46, 0x51, 0x46, 0x46, 0x4f, 0x51, 0x51, 0x46, 0x81,
+    0x51, 0x09, 0x4e, 0x4e, 0x48, 0x44, 0x44, 0x3e, 0x42, 0x37, 0x2c, 0x18,
+    0x80, 0x0b, 0x06, 0x04, 0x04, 0x06, 0x00, 0x00, 0x01, 0x06, 0x81, 0x1a,
+    0x02, 0x1d, 0x1d, 0x15, 0x82, 0x1a, 0x80, 0x1d, 0x11, 0x10, 0x03, 0x03,
+    0x06, 0x1f, 0x69, 0xb4, 0xb8, 0xae, 0xa6, 0x9e, 0x9b, 0x8c, 0x8c, 0x87,
+    0x82, 0x7e, 0x77, 0x80, 0x6e, 0x82, 0x68, 0x82, 0x60, 0x87, 0x56, 0x82,
+    0x58, 0x82, 0x4f, 0x80, 0x58, 0x02, 0x4f, 0x4f, 0x58, 0x82, 0x4f, 0x00,
+    0x58, 0x88, 0x4f, 0x80, 0x58, 0x05, 0x4f, 0x56, 0x4f, 0x4f, 0x58, 0x58,
+    0x80, 0x4f, 0x01, 0x58, 0x5d, 0x80, 0x4f, 0x06, 0x51, 0x4f, 0x58, 0x58,
+    0x51, 0x51, 0x4f, 0x82, 0x58, 0x81, 0x4f, 0x00, 0x58, 0x83, 0x4f, 0x81,
+    0x58, 0x05, 0x4f, 0x58, 0x58, 0x4f, 0x58, 0x58, 0x80, 0x4f, 0x00, 0x58,
+    0x81, 0x51, 0x05, 0x4e, 0x4e, 0x40, 0x48, 0x42, 0x31, 0x80, 0x44, 0x0c,
+    0x49, 0x41, 0x41, 0x42, 0x1b, 0x21, 0x07, 0x00, 0x00, 0x01, 0x0f, 0x0f,
+    0x06, 0x81, 0x0f, 0x85, 0x06, 0x02, 0x02, 0x06, 0x02, 0x81, 0x06, 0x01,
+    0x01, 0x06, 0x81, 0x01, 0x03, 0x03, 0x01, 0x01, 0x03, 0x82, 0x01, 0x80,
+    0x00, 0x01, 0x01, 0x01, 0x81, 0x00, 0x01, 0x01, 0x01, 0x80, 0x00, 0x01,
+    0x01, 0x00, 0x80, 0x01, 0x00, 0x03,
+};
+
+//
+// lightning.png: 320x216 rle (tolerance 1), 44989 bytes, 99.0 dB.
+//
+const uint8_t g_pui_Lightning_Image[] =
+{
+    0x48, 0x40, 0x01, 0xd8, 0x00, 0xeb, 0x00, 0x38, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x48, 0x00, 0x48, 0x00, 0x48, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50,
+    0x01, 0x50, 0x00, 0x50, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58,
+    0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x68, 0x00, 0x68, 0x00, 0x68,
+    0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x00, 0x78, 0x20, 0x78, 0x00, 0x78,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x20, 0x80, 0x20, 0x80, 0x60, 0x80,
+    0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x20, 0x90, 0xc0, 0x90,
+    0x00, 0x90, 0x00, 0x90, 0x80, 0x90, 0x00, 0x98, 0x00, 0x98, 0x20, 0x98,
+    0x20, 0x98, 0x60, 0x98, 0x00, 0x98, 0x01, 0x98, 0x00, 0xa0, 0xa0, 0xa0,
+    0x80, 0xa1, 0x00, 0xa0, 0x20, 0xa0, 0x40, 0xa8, 0x00, 0xa8, 0x00, 0xa8,
+    0x00, 0xa8, 0x80, 0xa8, 0x00, 0xa9, 0x00, 0xa8, 0x20, 0xb0, 0x20, 0xb0,
+    0xc0, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb8, 0x01, 0xb8, 0x00, 0xb8,
+    0x40, 0xb9, 0x40, 0xb8, 0xe0, 0xb8, 0x00, 0xc0, 0x80, 0xc0, 0x00, 0xc0,
+    0x01, 0xc2, 0x00, 0xc0, 0x00, 0xc9, 0x80, 0xc8, 0x00, 0xc8, 0x01, 0xc8,
+    0x00, 0xd0, 0xe0, 0xd1, 0x00, 0xd0, 0x20, 0xd0, 0x80, 0xd1, 0x00, 0xd8,
+    0xe1, 0xda, 0x20, 0xd9, 0x62, 0xdb, 0xa0, 0xd8, 0x00, 0xd8, 0xa0, 0xd9,
+    0xa1, 0xda, 0x00, 0xd8, 0x00, 0xd8, 0x61, 0xe2, 0x00, 0xe1, 0x40, 0xe2,
+    0x02, 0xe4, 0x20, 0xe3, 0x00, 0xe0, 0x61, 0xe0, 0xc0, 0xe0, 0x01, 0xe2,
+    0xc0, 0xe2, 0x00, 0xe8, 0x40, 0xeb, 0x20, 0xe8, 0xa1, 0xe9, 0x40, 0xe8,
+    0x03, 0xec, 0x20, 0xea, 0x82, 0xeb, 0xa4, 0xec, 0x41, 0xe9, 0x00, 0xe8,
+    0xe0, 0xf1, 0x22, 0xf3, 0xc2, 0xf3, 0x00, 0xf0, 0xa1, 0xf2, 0xe1, 0xf2,
+    0x22, 0xf4, 0x24, 0xf5, 0xa0, 0xf1, 0xc1, 0xf0, 0xa1, 0xf3, 0xc0, 0xf0,
+    0x40, 0xf1, 0x62, 0xf4, 0x00, 0xf0, 0x61, 0xf3, 0xa2, 0xf4, 0x61, 0xf2,
+    0xe3, 0xf4, 0xc7, 0xf5, 0x21, 0xf4, 0x84, 0xf5, 0xc0, 0xfa, 0x00, 0xfb,
+    0x41, 0xfb, 0x43, 0xfd, 0xe5, 0xfd, 0xa0, 0xfa, 0x01, 0xfc, 0xc1, 0xfc,
+    0xe3, 0xfd, 0x26, 0xfe, 0x60, 0xf8, 0x21, 0xfa, 0x21, 0xfd, 0xa0, 0xfb,
+    0x60, 0xfc, 0xa0, 0xfc, 0x00, 0xf8, 0x40, 0xf9, 0xc1, 0xf9, 0xa0, 0xfd,
+    0xe1, 0xfd, 0x43, 0xfe, 0x60, 0xfe, 0x64, 0xfe, 0xa7, 0xfe, 0xa2, 0xfe,
+    0x43, 0xff, 0x80, 0xfa, 0x80, 0xfb, 0x00, 0xfd, 0x80, 0xfd, 0x40, 0xfe,
+    0xc0, 0xfe, 0xc5, 0xfe, 0x01, 0xff, 0x2c, 0xff, 0x84, 0xff, 0xe7, 0xff,
+    0xf8, 0xff, 0xfb, 0xff, 0xc0, 0xf8, 0x00, 0xfa, 0x40, 0xfa, 0xe0, 0xfb,
+    0x20, 0xfc, 0x40, 0xfc, 0xe0, 0xfc, 0x60, 0xfd, 0x00, 0xfe, 0xea, 0xfe,
+    0x20, 0xff, 0x24, 0xff, 0x26, 0xff, 0x29, 0xff, 0x60, 0xff, 0x65, 0xff,
+    0x68, 0xff, 0x80, 0xff, 0x8b, 0xff, 0xa8, 0xff, 0xc0, 0xff, 0xce, 0xff,
+    0xe3, 0xff, 0xeb, 0xff, 0xe5, 0xff, 0xec, 0xff, 0xe9, 0xff, 0xf0, 0xff,
+    0xf2, 0xff, 0xf2, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf8, 0xff, 0xfa, 0xff,
+    0xfd, 0xff, 0x00, 0xf8, 0xe0, 0xf8, 0x40, 0xf9, 0xa0, 0xf9, 0x80, 0xfa,
+    0xc0, 0xfa, 0x00, 0xfb, 0x20, 0xfb, 0x60, 0xfb, 0xa0, 0xfb, 0xc0, 0xfb,
+    0x80, 0xfc, 0xa0, 0xfc, 0x40, 0xfd, 0xc0, 0xfd, 0x80, 0xfe, 0x8a, 0xff,
+    0xa6, 0xff, 0xef, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xf7, 0xff, 0x82, 0x27,
+    0x8a, 0x2a, 0x04, 0x28, 0x27, 0x25, 0x23, 0x25, 0x82, 0x27, 0x82, 0x21,
+    0x85, 0x27, 0x07, 0x31, 0x2a, 0x49, 0x7e, 0x34, 0x2c, 0x31, 0x2b, 0x81,
+    0x27, 0x03, 0x25, 0x25, 0x27, 0x28, 0x83, 0x2a, 0x81, 0x31, 0x04, 0x36,
+    0x4e, 0xb4, 0x67, 0x37, 0x8e, 0x31, 0x08, 0x2b, 0x2b, 0x31, 0x31, 0x2c,
+    0x2b, 0x2c, 0x2b, 0x2b, 0x83, 0x31, 0x01, 0x28, 0x2b, 0x81, 0x31, 0x01,
+    0x2f, 0x2b, 0x8d, 0x31, 0x07, 0x2c, 0x2b, 0x28, 0x28, 0x2b, 0x2b, 0x2c,
+    0x31, 0x82, 0x2a, 0x02, 0x31, 0x2c, 0x2b, 0x86, 0x31, 0x00, 0x2f, 0x85,
+    0x31, 0x05, 0x36, 0x37, 0x37, 0x36, 0x34, 0x36, 0x85, 0x37, 0x0a, 0x3d,
+    0x39, 0x3c, 0x41, 0x42, 0x4a, 0x42, 0x42, 0x48, 0x4f, 0x53, 0x80, 0x56,
+    0x18, 0x6a, 0x83, 0xd6, 0xd7, 0xb5, 0xba, 0xcf, 0xea, 0xe9, 0xe8, 0xc9,
+    0xa9, 0xdd, 0xd8, 0xd6, 0x83, 0x65, 0x53, 0x4c, 0x4c, 0x42, 0x48, 0x42,
+    0x39, 0x39, 0x80, 0x31, 0x00, 0x2c, 0x80, 0x31, 0x01, 0x2b, 0x2b, 0x81,
+    0x27, 0x08, 0x25, 0x25, 0x28, 0x2f, 0x2b, 0x41, 0x8f, 0x72, 0x2b, 0x80,
+    0x25, 0x81, 0x21, 0x00, 0x25, 0x80, 0x27, 0x09, 0x2b, 0x2c, 0x2c, 0x34,
+    0x36, 0x39, 0x68, 0x82, 0x31, 0x28, 0x81, 0x21, 0x08, 0x39, 0x5f, 0x76,
+    0xc8, 0x8f, 0x48, 0x31, 0x23, 0x21, 0x81, 0x17, 0x02, 0x16, 0x15, 0x14,
+    0x80, 0x15, 0x02, 0x14, 0x14, 0x15, 0x82, 0x12, 0x01, 0x16, 0x1d, 0x80,
+    0x21, 0x05, 0x28, 0x28, 0x23, 0x1d, 0x19, 0x15, 0x87, 0x12, 0x87, 0x0f,
+    0x80, 0x27, 0x01, 0x2a, 0x28, 0x83, 0x2a, 0x02, 0x2c, 0x31, 0x31, 0x82,
+    0x2a, 0x88, 0x27, 0x04, 0x25, 0x25, 0x27, 0x28, 0x25, 0x81, 0x27, 0x06,
+    0x2b, 0x28, 0x28, 0x2a, 0x58, 0x5a, 0x31, 0x80, 0x2a, 0x81, 0x27, 0x00,
+    0x25, 0x81, 0x27, 0x0c, 0x2b, 0x2d, 0x2b, 0x2c, 0x31, 0x31, 0x2c, 0x2c,
+    0x3d, 0x61, 0x81, 0x53, 0x3c, 0x8f, 0x31, 0x0f, 0x2b, 0x2c, 0x31, 0x2b,
+    0x2b, 0x2c, 0x2b, 0x2c, 0x2c, 0x2f, 0x31, 0x2f, 0x31, 0x31, 0x2b, 0x28,
+    0x81, 0x2a, 0x00, 0x31, 0x81, 0x2a, 0x87, 0x31, 0x00, 0x2f, 0x80, 0x31,
+    0x82, 0x2a, 0x80, 0x31, 0x00, 0x2c, 0x83, 0x2a, 0x00, 0x2c, 0x86, 0x31,
+    0x01, 0x2c, 0x2f, 0x84, 0x31, 0x01, 0x36, 0x36, 0x80, 0x31, 0x00, 0x36,
+    0x85, 0x37, 0x28, 0x3d, 0x3c, 0x3c, 0x41, 0x42, 0x42, 0x4a, 0x4c, 0x4f,
+    0x51, 0x53, 0x56, 0x5b, 0x65, 0x74, 0x9b, 0xd6, 0xd7, 0x90, 0x9f, 0xd1,
+    0xea, 0xeb, 0xcd, 0xab, 0xb9, 0xdb, 0xd8, 0xd6, 0x83, 0x6a, 0x5b, 0x51,
+    0x4f, 0x48, 0x4c, 0x42, 0x41, 0x3c, 0x39, 0x36, 0x80, 0x31, 0x07, 0x2f,
+    0x2c, 0x2b, 0x2b, 0x28, 0x28, 0x2b, 0x2b, 0x80, 0x25, 0x0d, 0x30, 0x35,
+    0x41, 0x94, 0x63, 0x28, 0x25, 0x27, 0x25, 0x23, 0x23, 0x25, 0x23, 0x25,
+    0x82, 0x27, 0x15, 0x2b, 0x2c, 0x31, 0x34, 0x42, 0x89, 0x45, 0x28, 0x23,
+    0x1f, 0x23, 0x28, 0x25, 0x39, 0x42, 0x7b, 0xc8, 0x5d, 0x39, 0x24, 0x1b,
+    0x1b, 0x81, 0x17, 0x80, 0x15, 0x04, 0x18, 0x15, 0x14, 0x14, 0x15, 0x82,
+    0x12, 0x03, 0x15, 0x1a, 0x1d, 0x1d, 0x81, 0x21, 0x01, 0x1a, 0x18, 0x88,
+    0x12, 0x87, 0x0f, 0x80, 0x27, 0x01, 0x2a, 0x28, 0x82, 0x2a, 0x81, 0x31,
+    0x00, 0x2c, 0x83, 0x2a, 0x8a, 0x27, 0x00, 0x25, 0x83, 0x27, 0x06, 0x31,
+    0x42, 0x9d, 0x3c, 0x25, 0x28, 0x2b, 0x89, 0x27, 0x08, 0x2b, 0x31, 0x2b,
+    0x30, 0x31, 0x42, 0x7d, 0x73, 0x42, 0x81, 0x31, 0x02, 0x2b, 0x2c, 0x2f,
+    0x83, 0x31, 0x00, 0x2c, 0x83, 0x31, 0x14, 0x2b, 0x2c, 0x2f, 0x2c, 0x2b,
+    0x2c, 0x31, 0x31, 0x2b, 0x2c, 0x2b, 0x2b, 0x2c, 0x31, 0x2b, 0x28, 0x2c,
+    0x2b, 0x28, 0x2b, 0x2c, 0x80, 0x2a, 0x00, 0x2c, 0x81, 0x31, 0x01, 0x2f,
+    0x2b, 0x80, 0x2c, 0x01, 0x31, 0x2c, 0x80, 0x31, 0x03, 0x2c, 0x2b, 0x2b,
+    0x2c, 0x81, 0x31, 0x85, 0x2a, 0x03, 0x2c, 0x2b, 0x2c, 0x2b, 0x80, 0x31,
+    0x04, 0x2c, 0x2b, 0x31, 0x2b, 0x2b, 0x89, 0x31, 0x84, 0x37, 0x26, 0x3d,
+    0x41, 0x3d, 0x3d, 0x41, 0x42, 0x46, 0x48, 0x4f, 0x51, 0x51, 0x56, 0x5e,
+    0x65, 0x83, 0x9b, 0x95, 0x95, 0xd9, 0xde, 0xa1, 0xd0, 0xb2, 0xd2, 0xbe,
+    0xb9, 0xa7, 0xb5, 0xd7, 0xd6, 0x83, 0x6a, 0x5e, 0x56, 0x4f, 0x4c, 0x4c,
+    0x42, 0x3d, 0x81, 0x37, 0x02, 0x34, 0x31, 0x2c, 0x81, 0x2a, 0x0e, 0x28,
+    0x2b, 0x28, 0x25, 0x27, 0x2b, 0x37, 0x4c, 0x5c, 0xbf, 0x68, 0x28, 0x27,
+    0x25, 0x25, 0x81, 0x21, 0x00, 0x25, 0x85, 0x27, 0x06, 0x2b, 0x28, 0x55,
+    0x84, 0x5a, 0x36, 0x28, 0x80, 0x21, 0x07, 0x28, 0x31, 0x46, 0x94, 0xa3,
+    0x55, 0x31, 0x1d, 0x81, 0x17, 0x01, 0x16, 0x18, 0x81, 0x15, 0x02, 0x14,
+    0x14, 0x15, 0x83, 0x12, 0x07, 0x18, 0x19, 0x1a, 0x1a, 0x1d, 0x1b, 0x18,
+    0x18, 0x88, 0x12, 0x88, 0x0f, 0x09, 0x28, 0x28, 0x2a, 0x2a, 0x28, 0x2a,
+    0x2c, 0x2b, 0x2b, 0x31, 0x82, 0x2a, 0x80, 0x27, 0x81, 0x2a, 0x84, 0x27,
+    0x0f, 0x25, 0x23, 0x27, 0x25, 0x24, 0x28, 0x2b, 0x28, 0x2b, 0x35, 0x39,
+    0x41, 0x4f, 0x7e, 0x4c, 0x2a, 0x82, 0x27, 0x00, 0x2a, 0x81, 0x27, 0x00,
+    0x25, 0x81, 0x27, 0x81, 0x2a, 0x08, 0x31, 0x6d, 0x61, 0x39, 0x31, 0x2b,
+    0x31, 0x2c, 0x2b, 0x81, 0x2c, 0x81, 0x31, 0x01, 0x2b, 0x2b, 0x81, 0x31,
+    0x0d, 0x2c, 0x2c, 0x2b, 0x2c, 0x31, 0x31, 0x2b, 0x2c, 0x2f, 0x31, 0x2b,
+    0x2c, 0x2b, 0x28, 0x80, 0x2a, 0x02, 0x28, 0x2b, 0x2a, 0x80, 0x27, 0x01,
+    0x2b, 0x2c, 0x81, 0x2a, 0x01, 0x31, 0x31, 0x80, 0x2a, 0x81, 0x2c, 0x80,
+    0x2a, 0x03, 0x2c, 0x2b, 0x2c, 0x2b, 0x81, 0x31, 0x07, 0x2b, 0x2c, 0x2b,
+    0x2c, 0x2b, 0x2c, 0x2c, 0x31, 0x83, 0x2a, 0x05, 0x2c, 0x2c, 0x2b, 0x2c,
+    0x2b, 0x2b, 0x89, 0x31, 0x02, 0x37, 0x36, 0x36, 0x81, 0x37, 0x00, 0x3d,
+    0x81, 0x40, 0x24, 0x42, 0x4c, 0x4c, 0x4f, 0x51, 0x56, 0x5e, 0x6c, 0x78,
+    0x83, 0xd6, 0xb3, 0xd8, 0xda, 0xe1, 0xbe, 0xeb, 0xea, 0xd0, 0xa1, 0x98,
+    0xa6, 0xd8, 0xd7, 0x83, 0x83, 0x65, 0x5b, 0x51, 0x4f, 0x48, 0x4c, 0x41,
+    0x39, 0x39, 0x36, 0x36, 0x80, 0x31, 0x01, 0x2c, 0x2b, 0x83, 0x27, 0x0a,
+    0x25, 0x27, 0x31, 0x5d, 0x9f, 0x93, 0x64, 0x3d, 0x27, 0x25, 0x25, 0x89,
+    0x21, 0x80, 0x25, 0x07, 0x27, 0x34, 0x4e, 0x96, 0x86, 0x73, 0x4e, 0x36,
+    0x80, 0x27, 0x07, 0x31, 0x58, 0xbf, 0x7c, 0x36, 0x22, 0x1d, 0x18, 0x80,
+    0x15, 0x03, 0x18, 0x18, 0x15, 0x16, 0x80, 0x12, 0x00, 0x15, 0x84, 0x12,
+    0x04, 0x15, 0x15, 0x18, 0x19, 0x16, 0x8b, 0x12, 0x87, 0x0f, 0x83, 0x27,
+    0x86, 0x2a, 0x80, 0x27, 0x80, 0x2a, 0x85, 0x27, 0x10, 0x25, 0x25, 0x27,
+    0x24, 0x28, 0x31, 0x42, 0x4e, 0x67, 0x73, 0x7e, 0x7e, 0x6c, 0x42, 0x2b,
+    0x28, 0x2a, 0x81, 0x27, 0x05, 0x2a, 0x28, 0x28, 0x25, 0x25, 0x23, 0x81,
+    0x27, 0x08, 0x2b, 0x2b, 0x28, 0x2c, 0x39, 0x76, 0x3d, 0x31, 0x35, 0x80,
+    0x31, 0x05, 0x2c, 0x2c, 0x2b, 0x2c, 0x2b, 0x2c, 0x80, 0x31, 0x0c, 0x2b,
+    0x2b, 0x31, 0x2f, 0x31, 0x2f, 0x31, 0x2c, 0x2c, 0x31, 0x31, 0x2c, 0x2b,
+    0x80, 0x2c, 0x09, 0x2b, 0x2b, 0x2c, 0x2b, 0x28, 0x2b, 0x2a, 0x28, 0x2a,
+    0x2b, 0x81, 0x27, 0x02, 0x2c, 0x2a, 0x2c, 0x8d, 0x2a, 0x04, 0x2c, 0x2b,
+    0x2b, 0x2c, 0x2c, 0x80, 0x2a, 0x00, 0x31, 0x85, 0x2a, 0x09, 0x2c, 0x2b,
+    0x2b, 0x2c, 0x2b, 0x2b, 0x31, 0x2c, 0x2b, 0x2b, 0x88, 0x31, 0x02, 0x36,
+    0x36, 0x34, 0x81, 0x37, 0x01, 0x3d, 0x41, 0x81, 0x42, 0x1b, 0x4c, 0x51,
+    0x53, 0x5b, 0x65, 0x74, 0x83, 0xd6, 0xd7, 0xd8, 0xa6, 0xb7, 0x9e, 0xc3,
+    0xce, 0xd4, 0xb1, 0xcc, 0xe3, 0x8b, 0xd8, 0xd7, 0x95, 0x78, 0x6a, 0x5b,
+    0x56, 0x4f, 0x80, 0x48, 0x01, 0x41, 0x36, 0x83, 0x31, 0x01, 0x2b, 0x2b,
+    0x82, 0x27, 0x08, 0x25, 0x25, 0x28, 0x39, 0x88, 0x8a, 0x46, 0x2f, 0x28,
+    0x83, 0x21, 0x00, 0x1d, 0x88, 0x21, 0x12, 0x1c, 0x1f, 0x1d, 0x36, 0x41,
+    0x47, 0x7d, 0x68, 0x41, 0x23, 0x23, 0x2a, 0x42, 0x6f, 0xc5, 0x4d, 0x28,
+    0x1c, 0x18, 0x80, 0x15, 0x03, 0x18, 0x18, 0x15, 0x15, 0x8f, 0x12, 0x03,
+    0x11, 0x11, 0x12, 0x12, 0x83, 0x0f, 0x00, 0x12, 0x86, 0x0f, 0x01, 0x0c,
+    0x0e, 0x81, 0x2a, 0x01, 0x28, 0x28, 0x84, 0x2a, 0x02, 0x31, 0x2b, 0x2a,
+    0x84, 0x27, 0x00, 0x23, 0x80, 0x27, 0x12, 0x25, 0x25, 0x23, 0x25, 0x28,
+    0x23, 0x28, 0x44, 0x7e, 0x6c, 0x5a, 0x4c, 0x41, 0x37, 0x31, 0x2b, 0x25,
+    0x27, 0x25, 0x83, 0x27, 0x03, 0x25, 0x23, 0x23, 0x25, 0x81, 0x27, 0x09,
+    0x2b, 0x28, 0x25, 0x2f, 0x49, 0x86, 0x34, 0x28, 0x30, 0x2c, 0x81, 0x2a,
+    0x15, 0x2c, 0x2b, 0x2c, 0x2c, 0x2f, 0x31, 0x2d, 0x2b, 0x2b, 0x2c, 0x2b,
+    0x2c, 0x2f, 0x31, 0x31, 0x2b, 0x31, 0x31, 0x2c, 0x2b, 0x2b, 0x2c, 0x80,
+    0x2a, 0x05, 0x2c, 0x28, 0x2a, 0x2b, 0x28, 0x28, 0x80, 0x2a, 0x80, 0x27,
+    0x81, 0x2a, 0x86, 0x27, 0x03, 0x2b, 0x2b, 0x2c, 0x2c, 0x82, 0x2a, 0x09,
+    0x2c, 0x2b, 0x2c, 0x2b, 0x2c, 0x2b, 0x2c, 0x2b, 0x2b, 0x31, 0x87, 0x2a,
+    0x01, 0x2c, 0x2c, 0x81, 0x2a, 0x84, 0x31, 0x80, 0x36, 0x02, 0x34, 0x34,
+    0x36, 0x80, 0x37, 0x21, 0x41, 0x41, 0x42, 0x46, 0x42, 0x48, 0x4c, 0x53,
+    0x5e, 0x65, 0x78, 0x83, 0xd6, 0xd7, 0xb5, 0xb8, 0xac, 0xc8, 0xd0, 0xd3,
+    0xb2, 0xd3, 0xce, 0xa0, 0xdd, 0xd9, 0xd7, 0xd6, 0x83, 0x74, 0x65, 0x56,
+    0x51, 0x4f, 0x80, 0x48, 0x03, 0x42, 0x37, 0x34, 0x36, 0x81, 0x31, 0x01,
+    0x2b, 0x2b, 0x80, 0x27, 0x00, 0x25, 0x80, 0x21, 0x06, 0x2b, 0x41, 0x94,
+    0xa0, 0x4c, 0x30, 0x25, 0x81, 0x21, 0x81, 0x1b, 0x00, 0x1f, 0x80, 0x21,
+    0x01, 0x1d, 0x1d, 0x80, 0x21, 0x80, 0x1b, 0x11, 0x1e, 0x1f, 0x22, 0x28,
+    0x39, 0x55, 0x68, 0x28, 0x22, 0x25, 0x3d, 0x77, 0xce, 0x71, 0x34, 0x1a,
+    0x19, 0x18, 0x81, 0x15, 0x90, 0x12, 0x80, 0x0f, 0x00, 0x12, 0x8b, 0x0f,
+    0x81, 0x0b, 0x00, 0x0f, 0x80, 0x2a, 0x80, 0x27, 0x81, 0x2a, 0x00, 0x2c,
+    0x81, 0x2a, 0x01, 0x28, 0x2a, 0x81, 0x27, 0x13, 0x25, 0x25, 0x23, 0x25,
+    0x25, 0x23, 0x25, 0x25, 0x23, 0x25, 0x27, 0x23, 0x2b, 0x73, 0x4c, 0x31,
+    0x2b, 0x2c, 0x31, 0x27, 0x82, 0x25, 0x02, 0x28, 0x23, 0x25, 0x80, 0x27,
+    0x00, 0x25, 0x80, 0x21, 0x01, 0x25, 0x25, 0x80, 0x27, 0x0a, 0x23, 0x2b,
+    0x2b, 0x45, 0x68, 0x2b, 0x31, 0x2c, 0x2b, 0x28, 0x28, 0x85, 0x31, 0x80,
+    0x2a, 0x00, 0x28, 0x81, 0x2a, 0x0d, 0x2d, 0x2a, 0x2b, 0x2c, 0x31, 0x2f,
+    0x31, 0x31, 0x2b, 0x28, 0x2c, 0x2c, 0x2b, 0x2c, 0x84, 0x27, 0x01, 0x2a,
+    0x2a, 0x84, 0x27, 0x00, 0x2b, 0x82, 0x27, 0x83, 0x2a, 0x04, 0x2c, 0x2c,
+    0x2a, 0x28, 0x2b, 0x81, 0x31, 0x00, 0x2c, 0x86, 0x2a, 0x00, 0x28, 0x80,
+    0x2a, 0x00, 0x31, 0x80, 0x2a, 0x85, 0x31, 0x08, 0x36, 0x36, 0x39, 0x37,
+    0x36, 0x34, 0x34, 0x39, 0x3c, 0x80, 0x40, 0x24, 0x42, 0x48, 0x4c, 0x4f,
+    0x53, 0x5b, 0x5e, 0x74, 0x9b, 0xd7, 0xd9, 0xdd, 0x9f, 0xc8, 0xeb, 0xe9,
+    0xd4, 0xd3, 0xce, 0xe6, 0x9e, 0xdc, 0xd8, 0xd7, 0x9b, 0x83, 0x6c, 0x5e,
+    0x56, 0x51, 0x4c, 0x4f, 0x4c, 0x42, 0x42, 0x4c, 0x39, 0x83, 0x31, 0x02,
+    0x2f, 0x28, 0x25, 0x82, 0x21, 0x07, 0x25, 0x27, 0x35, 0x55, 0xa0, 0x87,
+    0x36, 0x28, 0x81, 0x21, 0x0a, 0x1d, 0x1b, 0x1a, 0x1b, 0x1d, 0x22, 0x22,
+    0x1d, 0x1d, 0x21, 0x21, 0x80, 0x1b, 0x80, 0x17, 0x15, 0x1b, 0x1d, 0x23,
+    0x28, 0x3a, 0x79, 0x25, 0x28, 0x2b, 0x4e, 0x8f, 0xc0, 0x58, 0x31, 0x1e,
+    0x19, 0x18, 0x15, 0x15, 0x14, 0x14, 0x15, 0x8e, 0x12, 0x8f, 0x0f, 0x82,
+    0x0b, 0x00, 0x0f, 0x83, 0x27, 0x84, 0x2a, 0x85, 0x27, 0x01, 0x25, 0x25,
+    0x80, 0x21, 0x0e, 0x25, 0x25, 0x27, 0x27, 0x23, 0x22, 0x27, 0x53, 0x73,
+    0x31, 0x28, 0x25, 0x28, 0x31, 0x2a, 0x80, 0x27, 0x00, 0x25, 0x83, 0x27,
+    0x00, 0x25, 0x83, 0x21, 0x09, 0x25, 0x28, 0x28, 0x25, 0x25, 0x28, 0x5d,
+    0x58, 0x28, 0x2a, 0x81, 0x27, 0x0d, 0x2f, 0x31, 0x2f, 0x31, 0x31, 0x2f,
+    0x2c, 0x31, 0x2b, 0x2b, 0x2c, 0x2b, 0x2c, 0x2c, 0x80, 0x2a, 0x09, 0x28,
+    0x28, 0x2b, 0x2b, 0x31, 0x31, 0x2f, 0x28, 0x2b, 0x2c, 0x80, 0x2a, 0x80,
+    0x27, 0x02, 0x2b, 0x28, 0x28, 0x80, 0x2a, 0x8a, 0x27, 0x83, 0x2a, 0x04,
+    0x28, 0x2b, 0x2b, 0x28, 0x2a, 0x80, 0x31, 0x00, 0x2c, 0x87, 0x2a, 0x06,
+    0x28, 0x2a, 0x2b, 0x31, 0x31, 0x2c, 0x2c, 0x86, 0x31, 0x86, 0x37, 0x20,
+    0x41, 0x41, 0x42, 0x42, 0x48, 0x4f, 0x56, 0x65, 0x78, 0x83, 0xd6, 0xb3,
+    0xb5, 0xb8, 0xac, 0xcf, 0xe9, 0xb1, 0xcf, 0xe6, 0xac, 0xba, 0x99, 0xdd,
+    0xd8, 0x95, 0x95, 0x78, 0x6a, 0x65, 0x56, 0x51, 0x4f, 0x80, 0x48, 0x0b,
+    0x41, 0x41, 0x4c, 0x42, 0x37, 0x31, 0x2c, 0x31, 0x31, 0x2b, 0x2b, 0x28,
+    0x81, 0x25, 0x09, 0x23, 0x23, 0x25, 0x27, 0x2b, 0x39, 0x55, 0xbf, 0x52,
+    0x28, 0x80, 0x21, 0x02, 0x1d, 0x1b, 0x1a, 0x8a, 0x1b, 0x14, 0x1a, 0x1a,
+    0x1b, 0x1b, 0x21, 0x27, 0x3f, 0x68, 0x28, 0x28, 0x37, 0x72, 0xce, 0xc5,
+    0x77, 0x42, 0x28, 0x1b, 0x18, 0x16, 0x18, 0x80, 0x15, 0x90, 0x12, 0x8e,
+    0x0f, 0x80, 0x0b, 0x01, 0x0f, 0x0f, 0x81, 0x27, 0x00, 0x25, 0x84, 0x27,
+    0x00, 0x2a, 0x82, 0x27, 0x03, 0x2a, 0x28, 0x27, 0x25, 0x82, 0x21, 0x00,
+    0x25, 0x80, 0x27, 0x08, 0x2a, 0x4e, 0x96, 0x4c, 0x2a, 0x28, 0x25, 0x28,
+    0x2a, 0x81, 0x27, 0x00, 0x25, 0x83, 0x27, 0x81, 0x21, 0x81, 0x25, 0x0c,
+    0x27, 0x28, 0x2a, 0x28, 0x34, 0x55, 0x68, 0x2b, 0x2a, 0x28, 0x2b, 0x28,
+    0x28, 0x81, 0x2a, 0x02, 0x31, 0x2b, 0x2b, 0x80, 0x2c, 0x80, 0x31, 0x03,
+    0x2c, 0x2b, 0x28, 0x2b, 0x80, 0x27, 0x01, 0x2a, 0x2c, 0x82, 0x2a, 0x83,
+    0x27, 0x00, 0x2c, 0x80, 0x27, 0x80, 0x2a, 0x04, 0x28, 0x2a, 0x28, 0x28,
+    0x2a, 0x84, 0x27, 0x80, 0x2a, 0x02, 0x28, 0x28, 0x2b, 0x82, 0x27, 0x82,
+    0x2a, 0x00, 0x28, 0x86, 0x2a, 0x03, 0x2c, 0x2b, 0x31, 0x2f, 0x82, 0x31,
+    0x00, 0x2c, 0x82, 0x31, 0x83, 0x37, 0x00, 0x3d, 0x80, 0x40, 0x31, 0x42,
+    0x42, 0x4a, 0x4c, 0x51, 0x5e, 0x78, 0x83, 0xd7, 0xd9, 0xdd, 0xba, 0xe6,
+    0xd2, 0xd4, 0xd3, 0xe6, 0x9f, 0x91, 0xdb, 0xd9, 0xd9, 0x9c, 0xb3, 0x83,
+    0x6c, 0x65, 0x5e, 0x5b, 0x51, 0x4c, 0x4c, 0x42, 0x42, 0x41, 0x3d, 0x3d,
+    0x42, 0x48, 0x42, 0x31, 0x2b, 0x31, 0x31, 0x2b, 0x2b, 0x28, 0x25, 0x27,
+    0x27, 0x80, 0x21, 0x08, 0x25, 0x27, 0x2a, 0x31, 0x55, 0xac, 0x4d, 0x25,
+    0x1a, 0x80, 0x1b, 0x82, 0x17, 0x87, 0x1b, 0x81, 0x17, 0x0e, 0x1b, 0x24,
+    0x3a, 0x8c, 0x34, 0x24, 0x36, 0x5d, 0x8f, 0xac, 0xc8, 0x71, 0x31, 0x1d,
+    0x18, 0x82, 0x15, 0x8b, 0x12, 0x80, 0x0f, 0x01, 0x12, 0x12, 0x93, 0x0f,
+    0x81, 0x25, 0x01, 0x23, 0x25, 0x8c, 0x27, 0x00, 0x25, 0x81, 0x21, 0x00,
+    0x25, 0x80, 0x27, 0x05, 0x36, 0x6c, 0x66, 0x42, 0x2b, 0x2b, 0x80, 0x27,
+    0x08, 0x25, 0x23, 0x25, 0x27, 0x25, 0x25, 0x27, 0x27, 0x25, 0x80, 0x27,
+    0x83, 0x21, 0x08, 0x25, 0x23, 0x28, 0x25, 0x28, 0x31, 0x45, 0x77, 0x5c,
+    0x82, 0x2a, 0x10, 0x28, 0x28, 0x2b, 0x28, 0x2b, 0x31, 0x2a, 0x2a, 0x2c,
+    0x2c, 0x31, 0x2f, 0x31, 0x31, 0x2b, 0x2c, 0x2b, 0x81, 0x27, 0x02, 0x2b,
+    0x2c, 0x2b, 0x80, 0x27, 0x03, 0x2a, 0x28, 0x28, 0x2a, 0x83, 0x27, 0x80,
+    0x2a, 0x80, 0x27, 0x06, 0x2a, 0x28, 0x2a, 0x2a, 0x28, 0x28, 0x2a, 0x80,
+    0x27, 0x01, 0x2b, 0x2a, 0x86, 0x27, 0x01, 0x2f, 0x2a, 0x82, 0x27, 0x04,
+    0x2b, 0x2b, 0x2c, 0x2c, 0x31, 0x80, 0x2a, 0x01, 0x2c, 0x2f, 0x8a, 0x31,
+    0x82, 0x37, 0x04, 0x3d, 0x41, 0x41, 0x42, 0x42, 0x80, 0x48, 0x15, 0x4f,
+    0x5b, 0x6c, 0x83, 0x83, 0x9d, 0xa7, 0xa2, 0xe8, 0xe9, 0xea, 0xd2, 0xe6,
+    0xa8, 0xa6, 0xd8, 0xd7, 0x95, 0x83, 0x83, 0x9b, 0x78, 0x80, 0x56, 0x00,
+    0x51, 0x80, 0x48, 0x01, 0x41, 0x41, 0x80, 0x37, 0x0c, 0x3d, 0x4c, 0x4a,
+    0x31, 0x2c, 0x31, 0x31, 0x28, 0x2b, 0x28, 0x25, 0x28, 0x27, 0x81, 0x21,
+    0x07, 0x27, 0x2b, 0x47, 0xa2, 0x6f, 0x3d, 0x22, 0x1f, 0x80, 0x1b, 0x8e,
+    0x17, 0x00, 0x19, 0x80, 0x17, 0x13, 0x31, 0x71, 0x5d, 0x22, 0x2b, 0x2b,
+    0x41, 0x51, 0x8a, 0xc0, 0x45, 0x25, 0x18, 0x14, 0x15, 0x15, 0x14, 0x14,
+    0x15, 0x15, 0x88, 0x12, 0x81, 0x0f, 0x01, 0x12, 0x12, 0x93, 0x0f, 0x80,
+    0x21, 0x01, 0x25, 0x25, 0x8a, 0x27, 0x10, 0x25, 0x25, 0x23, 0x23, 0x25,
+    0x25, 0x23, 0x23, 0x25, 0x27, 0x28, 0x2b, 0x67, 0x5b, 0x39, 0x28, 0x2b,
+    0x80, 0x27, 0x03, 0x25, 0x23, 0x25, 0x27, 0x81, 0x21, 0x02, 0x25, 0x23,
+    0x25, 0x80, 0x27, 0x0f, 0x23, 0x25, 0x27, 0x23, 0x23, 0x25, 0x23, 0x28,
+    0x27, 0x24, 0x36, 0x7f, 0x92, 0x4e, 0x28, 0x2b, 0x84, 0x27, 0x80, 0x2a,
+    0x00, 0x2c, 0x81, 0x2a, 0x00, 0x2c, 0x82, 0x2a, 0x05, 0x28, 0x2a, 0x28,
+    0x28, 0x2b, 0x2b, 0x80, 0x27, 0x03, 0x2b, 0x28, 0x28, 0x2c, 0x82, 0x27,
+    0x02, 0x2b, 0x2b, 0x2c, 0x88, 0x2a, 0x80, 0x27, 0x00, 0x2a, 0x83, 0x27,
+    0x82, 0x2a, 0x83, 0x27, 0x81, 0x2a, 0x00, 0x2c, 0x80, 0x2a, 0x81, 0x31,
+    0x00, 0x2f, 0x87, 0x31, 0x81, 0x37, 0x02, 0x3d, 0x41, 0x41, 0x80, 0x42,
+    0x20, 0x48, 0x4c, 0x4f, 0x56, 0x65, 0x83, 0x83, 0x9c, 0xdd, 0xa1, 0xd0,
+    0xd4, 0xe9, 0xd0, 0xc0, 0x99, 0xb4, 0xb3, 0xd6, 0x83, 0x9b, 0x78, 0x6a,
+    0x6a, 0x5e, 0x5b, 0x4f, 0x4f, 0x4c, 0x48, 0x42, 0x42, 0x41, 0x81, 0x37,
+    0x09, 0x36, 0x41, 0x4a, 0x31, 0x2b, 0x31, 0x2a, 0x28, 0x2b, 0x28, 0x80,
+    0x25, 0x81, 0x21, 0x07, 0x25, 0x31, 0x6f, 0xc2, 0x47, 0x34, 0x24, 0x22,
+    0x80, 0x1b, 0x82, 0x17, 0x00, 0x19, 0x82, 0x17, 0x00, 0x19, 0x80, 0x17,
+    0x81, 0x19, 0x15, 0x18, 0x1b, 0x1c, 0x4d, 0x87, 0x39, 0x25, 0x25, 0x27,
+    0x37, 0x4d, 0xc5, 0x5d, 0x31, 0x1a, 0x14, 0x15, 0x15, 0x12, 0x14, 0x15,
+    0x15, 0x87, 0x12, 0x82, 0x0f, 0x00, 0x12, 0x94, 0x0f, 0x01, 0x23, 0x23,
+    0x80, 0x25, 0x01, 0x27, 0x25, 0x88, 0x27, 0x81, 0x25, 0x03, 0x27, 0x25,
+    0x23, 0x23, 0x80, 0x27, 0x0c, 0x40, 0x73, 0x3d, 0x28, 0x22, 0x25, 0x2a,
+    0x27, 0x27, 0x25, 0x25, 0x28, 0x28, 0x84, 0x21, 0x80, 0x27, 0x02, 0x23,
+    0x25, 0x27, 0x81, 0x21, 0x06, 0x25, 0x2b, 0x25, 0x31, 0x79, 0x55, 0x3c,
+    0x86, 0x27, 0x82, 0x2a, 0x00, 0x2c, 0x88, 0x2a, 0x82, 0x27, 0x00, 0x2b,
+    0x80, 0x27, 0x01, 0x2c, 0x2a, 0x81, 0x27, 0x01, 0x2b, 0x28, 0x80, 0x2a,
+    0x00, 0x2c, 0x82, 0x2a, 0x00, 0x31, 0x80, 0x2a, 0x81, 0x27, 0x01, 0x23,
+    0x25, 0x80, 0x27, 0x81, 0x2a, 0x06, 0x31, 0x2a, 0x28, 0x2a, 0x2a, 0x28,
+    0x28, 0x81, 0x2a, 0x08, 0x2c, 0x2c, 0x2b, 0x2c, 0x31, 0x2f, 0x31, 0x2c,
+    0x2b, 0x87, 0x31, 0x81, 0x37, 0x1e, 0x3d, 0x41, 0x41, 0x42, 0x41, 0x42,
+    0x4c, 0x4f, 0x51, 0x5e, 0x74, 0xd6, 0xd7, 0xa6, 0x97, 0xca, 0xb2, 0xb2,
+    0xcf, 0xa4, 0x98, 0xb4, 0x95, 0x9b, 0x9b, 0x78, 0x6a, 0x65, 0x5e, 0x56,
+    0x51, 0x80, 0x48, 0x04, 0x42, 0x42, 0x41, 0x41, 0x3d, 0x80, 0x37, 0x80,
+    0x31, 0x0a, 0x40, 0x31, 0x2b, 0x2b, 0x28, 0x2b, 0x2c, 0x28, 0x25, 0x23,
+    0x25, 0x82, 0x21, 0x08, 0x2b, 0x55, 0xc2, 0x5d, 0x34, 0x25, 0x1e, 0x1d,
+    0x1b, 0x86, 0x17, 0x05, 0x19, 0x18, 0x18, 0x19, 0x19, 0x1a, 0x81, 0x19,
+    0x0f, 0x1a, 0x18, 0x1b, 0x1a, 0x2b, 0x68, 0x60, 0x28, 0x1c, 0x21, 0x22,
+    0x3c, 0x88, 0x88, 0x39, 0x22, 0x80, 0x15, 0x80, 0x12, 0x00, 0x15, 0x80,
+    0x12, 0x00, 0x15, 0x83, 0x12, 0x93, 0x0f, 0x03, 0x0c, 0x0c, 0x10, 0x0f,
+    0x80, 0x0b, 0x03, 0x23, 0x25, 0x27, 0x25, 0x86, 0x27, 0x01, 0x2b, 0x2b,
+    0x80, 0x27, 0x15, 0x25, 0x27, 0x27, 0x25, 0x27, 0x25, 0x25, 0x24, 0x28,
+    0x25, 0x2b, 0x67, 0x54, 0x2f, 0x28, 0x23, 0x23, 0x25, 0x25, 0x23, 0x25,
+    0x25, 0x84, 0x21, 0x0b, 0x25, 0x25, 0x27, 0x27, 0x25, 0x23, 0x27, 0x27,
+    0x23, 0x23, 0x25, 0x25, 0x80, 0x27, 0x06, 0x31, 0x73, 0x49, 0x31, 0x25,
+    0x28, 0x2a, 0x83, 0x27, 0x0c, 0x2c, 0x31, 0x2b, 0x2c, 0x2b, 0x2c, 0x2f,
+    0x31, 0x2f, 0x31, 0x2f, 0x31, 0x2c, 0x80, 0x2a, 0x07, 0x28, 0x2b, 0x28,
+    0x28, 0x2b, 0x28, 0x28, 0x2b, 0x80, 0x27, 0x00, 0x2b, 0x84, 0x27, 0x01,
+    0x2b, 0x2b, 0x83, 0x27, 0x81, 0x2a, 0x04, 0x28, 0x28, 0x2b, 0x25, 0x23,
+    0x81, 0x27, 0x07, 0x2a, 0x2a, 0x28, 0x28, 0x2a, 0x2c, 0x2b, 0x2b, 0x83,
+    0x27, 0x0b, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x2c, 0x2c, 0x31, 0x31, 0x2c,
+    0x2f, 0x2c, 0x80, 0x31, 0x02, 0x36, 0x36, 0x34, 0x84, 0x37, 0x00, 0x41,
+    0x80, 0x42, 0x18, 0x4a, 0x4c, 0x51, 0x56, 0x6a, 0x83, 0xd7, 0xb4, 0x97,
+    0xc5, 0xd2, 0xd5, 0xd3, 0xc6, 0xb8, 0xb4, 0xd7, 0x95, 0x83, 0x6a, 0x65,
+    0x5e, 0x56, 0x51, 0x4f, 0x80, 0x48, 0x07, 0x42, 0x41, 0x3d, 0x3d, 0x41,
+    0x39, 0x39, 0x36, 0x81, 0x31, 0x06, 0x37, 0x31, 0x31, 0x2b, 0x28, 0x2b,
+    0x2a, 0x81, 0x27, 0x82, 0x21, 0x0a, 0x2b, 0x36, 0x77, 0xc0, 0x47, 0x28,
+    0x22, 0x1b, 0x1a, 0x19, 0x19, 0x80, 0x17, 0x02, 0x19, 0x1a, 0x1b, 0x82,
+    0x17, 0x00, 0x19, 0x80, 0x17, 0x80, 0x19, 0x12, 0x1a, 0x1a, 0x1b, 0x1d,
+    0x42, 0x82, 0x25, 0x1b, 0x21, 0x21, 0x3d, 0x72, 0xae, 0x3d, 0x22, 0x16,
+    0x14, 0x16, 0x15, 0x88, 0x12, 0x00, 0x11, 0x82, 0x12, 0x90, 0x0f, 0x02,
+    0x0c, 0x0f, 0x0f, 0x80, 0x0b, 0x00, 0x23, 0x8e, 0x27, 0x18, 0x25, 0x25,
+    0x28, 0x27, 0x25, 0x27, 0x28, 0x22, 0x1f, 0x22, 0x28, 0x54, 0x54, 0x25,
+    0x28, 0x23, 0x23, 0x27, 0x23, 0x23, 0x25, 0x23, 0x23, 0x25, 0x25, 0x83,
+    0x21, 0x05, 0x25, 0x27, 0x27, 0x25, 0x27, 0x25, 0x82, 0x21, 0x07, 0x28,
+    0x28, 0x3d, 0x86, 0x39, 0x31, 0x24, 0x28, 0x80, 0x2a, 0x81, 0x27, 0x05,
+    0x2c, 0x31, 0x2a, 0x2a, 0x2c, 0x2b, 0x80, 0x2c, 0x01, 0x31, 0x31, 0x81,
+    0x2a, 0x02, 0x28, 0x28, 0x2b, 0x82, 0x27, 0x04, 0x2b, 0x28, 0x28, 0x2a,
+    0x2b, 0x83, 0x27, 0x06, 0x2c, 0x2c, 0x2b, 0x2b, 0x28, 0x25, 0x25, 0x85,
+    0x27, 0x03, 0x2b, 0x28, 0x27, 0x25, 0x83, 0x27, 0x82, 0x2a, 0x83, 0x27,
+    0x81, 0x2a, 0x03, 0x2c, 0x2c, 0x2b, 0x2f, 0x84, 0x31, 0x02, 0x36, 0x37,
+    0x36, 0x83, 0x37, 0x01, 0x3d, 0x41, 0x80, 0x42, 0x18, 0x4c, 0x4c, 0x51,
+    0x5b, 0x78, 0xd6, 0xd8, 0xa7, 0xc0, 0xd3, 0xea, 0xe9, 0xce, 0xa9, 0xa6,
+    0xd7, 0x83, 0x83, 0x6a, 0x5b, 0x56, 0x53, 0x51, 0x4c, 0x48, 0x80, 0x42,
+    0x01, 0x41, 0x3d, 0x82, 0x37, 0x85, 0x31, 0x06, 0x2b, 0x2b, 0x28, 0x28,
+    0x25, 0x23, 0x25, 0x83, 0x21, 0x09, 0x28, 0x31, 0x58, 0xc5, 0x5c, 0x28,
+    0x1d, 0x1b, 0x1a, 0x19, 0x80, 0x17, 0x04, 0x19, 0x19, 0x1a, 0x1a, 0x19,
+    0x81, 0x17, 0x00, 0x19, 0x80, 0x17, 0x09, 0x19, 0x1a, 0x19, 0x18, 0x19,
+    0x18, 0x21, 0x3a, 0x77, 0x2d, 0x80, 0x21, 0x07, 0x47, 0xae, 0x72, 0x3d,
+    0x22, 0x16, 0x16, 0x14, 0x80, 0x15, 0x86, 0x12, 0x02, 0x11, 0x12, 0x12,
+    0x8b, 0x0f, 0x00, 0x0e, 0x84, 0x0f, 0x02, 0x0c, 0x0f, 0x0f, 0x80, 0x0b,
+    0x03, 0x25, 0x28, 0x28, 0x25, 0x88, 0x27, 0x03, 0x25, 0x23, 0x27, 0x25,
+    0x80, 0x27, 0x0f, 0x25, 0x25, 0x28, 0x22, 0x1f, 0x24, 0x28, 0x44, 0x5f,
+    0x23, 0x2a, 0x22, 0x22, 0x25, 0x23, 0x25, 0x84, 0x21, 0x04, 0x25, 0x27,
+    0x23, 0x23, 0x25, 0x80, 0x27, 0x83, 0x21, 0x08, 0x1f, 0x28, 0x24, 0x3e,
+    0x70, 0x3c, 0x35, 0x24, 0x27, 0x80, 0x2a, 0x81, 0x27, 0x04, 0x2c, 0x31,
+    0x28, 0x2a, 0x28, 0x81, 0x2a, 0x08, 0x2c, 0x2c, 0x2b, 0x28, 0x28, 0x2b,
+    0x28, 0x28, 0x2b, 0x82, 0x27, 0x00, 0x2b, 0x80, 0x27, 0x11, 0x2a, 0x28,
+    0x25, 0x28, 0x28, 0x2a, 0x2b, 0x2c, 0x2c, 0x2a, 0x28, 0x28, 0x23, 0x23,
+    0x25, 0x28, 0x28, 0x25, 0x81, 0x27, 0x00, 0x2b, 0x82, 0x27, 0x01, 0x23,
+    0x25, 0x82, 0x27, 0x80, 0x2a, 0x81, 0x27, 0x82, 0x2a, 0x01, 0x2c, 0x2c,
+    0x86, 0x31, 0x02, 0x36, 0x37, 0x36, 0x83, 0x37, 0x01, 0x41, 0x42, 0x81,
+    0x48, 0x15, 0x51, 0x56, 0x65, 0x83, 0xd7, 0xd9, 0x99, 0xc8, 0xb2, 0xb2,
+    0xe8, 0xa1, 0xdd, 0xd8, 0xd6, 0x83, 0x6a, 0x5b, 0x56, 0x53, 0x4f, 0x4c,
+    0x80, 0x42, 0x01, 0x41, 0x41, 0x83, 0x37, 0x81, 0x31, 0x00, 0x2f, 0x81,
+    0x31, 0x04, 0x2b, 0x2b, 0x27, 0x25, 0x25, 0x80, 0x21, 0x00, 0x1d, 0x81,
+    0x21, 0x0d, 0x2b, 0x39, 0x4d, 0xc3, 0x76, 0x31, 0x1d, 0x1b, 0x1a, 0x19,
+    0x18, 0x18, 0x19, 0x19, 0x85, 0x17, 0x00, 0x19, 0x80, 0x17, 0x00, 0x19,
+    0x80, 0x17, 0x12, 0x16, 0x19, 0x1d, 0x28, 0x76, 0x45, 0x21, 0x1d, 0x22,
+    0x4d, 0xbc, 0x7c, 0x4e, 0x31, 0x1a, 0x1a, 0x15, 0x14, 0x15, 0x8a, 0x12,
+    0x93, 0x0f, 0x83, 0x0b, 0x00, 0x25, 0x8c, 0x27, 0x04, 0x25, 0x28, 0x25,
+    0x27, 0x28, 0x80, 0x21, 0x08, 0x25, 0x23, 0x25, 0x2a, 0x28, 0x49, 0x67,
+    0x27, 0x28, 0x80, 0x21, 0x01, 0x25, 0x25, 0x81, 0x21, 0x81, 0x25, 0x06,
+    0x28, 0x25, 0x23, 0x25, 0x28, 0x27, 0x25, 0x84, 0x21, 0x0b, 0x27, 0x23,
+    0x2c, 0x5a, 0x73, 0x4d, 0x2a, 0x2b, 0x28, 0x25, 0x28, 0x2b, 0x80, 0x27,
+    0x80, 0x2a, 0x03, 0x28, 0x28, 0x2c, 0x2c, 0x82, 0x2a, 0x01, 0x28, 0x28,
+    0x80, 0x2a, 0x81, 0x27, 0x02, 0x25, 0x28, 0x2b, 0x81, 0x27, 0x07, 0x25,
+    0x23, 0x28, 0x28, 0x2b, 0x2c, 0x2c, 0x2b, 0x80, 0x27, 0x03, 0x25, 0x23,
+    0x27, 0x28, 0x81, 0x25, 0x09, 0x28, 0x2a, 0x2c, 0x2b, 0x28, 0x2a, 0x28,
+    0x27, 0x25, 0x25, 0x84, 0x27, 0x00, 0x2a, 0x81, 0x27, 0x83, 0x2a, 0x89,
+    0x31, 0x00, 0x36, 0x83, 0x37, 0x21, 0x41, 0x42, 0x48, 0x4c, 0x4f, 0x51,
+    0x56, 0x65, 0x78, 0xd6, 0xd7, 0xb5, 0xba, 0xe8, 0xea, 0xeb, 0xbf, 0xb7,
+    0xb4, 0xd7, 0x83, 0x6a, 0x5e, 0x56, 0x53, 0x53, 0x4c, 0x48, 0x42, 0x42,
+    0x41, 0x3c, 0x3d, 0x3d, 0x81, 0x37, 0x00, 0x36, 0x85, 0x31, 0x15, 0x2f,
+    0x2b, 0x28, 0x25, 0x23, 0x25, 0x25, 0x23, 0x22, 0x1d, 0x1d, 0x23, 0x24,
+    0x25, 0x34, 0x52, 0xac, 0x8e, 0x44, 0x28, 0x22, 0x1b, 0x8d, 0x17, 0x01,
+    0x19, 0x18, 0x81, 0x15, 0x10, 0x18, 0x14, 0x1a, 0x22, 0x45, 0x7f, 0x25,
+    0x1c, 0x22, 0x35, 0x71, 0xca, 0x88, 0x4d, 0x28, 0x1d, 0x16, 0x8c, 0x12,
+    0x88, 0x0f, 0x80, 0x12, 0x85, 0x0f, 0x83, 0x0b, 0x06, 0x25, 0x27, 0x27,
+    0x25, 0x25, 0x28, 0x25, 0x83, 0x27, 0x01, 0x2a, 0x2a, 0x83, 0x27, 0x80,
+    0x21, 0x08, 0x25, 0x22, 0x28, 0x28, 0x34, 0x66, 0x4a, 0x27, 0x25, 0x80,
+    0x21, 0x01, 0x25, 0x25, 0x84, 0x21, 0x06, 0x27, 0x28, 0x25, 0x23, 0x27,
+    0x27, 0x25, 0x86, 0x21, 0x0a, 0x2a, 0x23, 0x3c, 0x6f, 0x79, 0x2b, 0x28,
+    0x28, 0x24, 0x28, 0x2b, 0x81, 0x27, 0x07, 0x2c, 0x2b, 0x2a, 0x2c, 0x2b,
+    0x2c, 0x2c, 0x31, 0x80, 0x2a, 0x04, 0x28, 0x28, 0x2a, 0x28, 0x2a, 0x81,
+    0x27, 0x02, 0x23, 0x28, 0x2b, 0x81, 0x27, 0x02, 0x23, 0x23, 0x27, 0x81,
+    0x2a, 0x81, 0x27, 0x0a, 0x25, 0x27, 0x28, 0x2b, 0x28, 0x27, 0x23, 0x25,
+    0x28, 0x28, 0x2c, 0x80, 0x2a, 0x01, 0x28, 0x25, 0x8c, 0x27, 0x82, 0x2a,
+    0x88, 0x31, 0x00, 0x36, 0x84, 0x37, 0x1b, 0x41, 0x42, 0x4c, 0x4f, 0x4f,
+    0x56, 0x65, 0x78, 0x9b, 0xd7, 0xd8, 0xdd, 0xe5, 0xd1, 0xea, 0xd1, 0x9e,
+    0xb5, 0xd8, 0x95, 0x78, 0x65, 0x56, 0x53, 0x51, 0x4f, 0x4c, 0x42, 0x80,
+    0x40, 0x00, 0x3d, 0x83, 0x37, 0x00, 0x36, 0x85, 0x31, 0x01, 0x2b, 0x28,
+    0x82, 0x25, 0x82, 0x21, 0x09, 0x25, 0x2b, 0x41, 0xa3, 0x82, 0x4e, 0x31,
+    0x1d, 0x1a, 0x1b, 0x84, 0x17, 0x00, 0x19, 0x81, 0x17, 0x00, 0x16, 0x81,
+    0x17, 0x82, 0x15, 0x11, 0x14, 0x18, 0x16, 0x1d, 0x2b, 0x7b, 0x46, 0x1d,
+    0x21, 0x23, 0x42, 0x71, 0xc5, 0x94, 0x4e, 0x2f, 0x1a, 0x18, 0x8c, 0x12,
+    0x87, 0x0f, 0x01, 0x12, 0x12, 0x86, 0x0f, 0x83, 0x0b, 0x06, 0x25, 0x27,
+    0x27, 0x25, 0x23, 0x28, 0x25, 0x83, 0x27, 0x00, 0x2b, 0x84, 0x27, 0x09,
+    0x23, 0x23, 0x25, 0x28, 0x22, 0x25, 0x23, 0x39, 0x66, 0x36, 0x82, 0x21,
+    0x00, 0x25, 0x86, 0x21, 0x01, 0x27, 0x27, 0x81, 0x25, 0x83, 0x21, 0x0d,
+    0x25, 0x23, 0x22, 0x25, 0x2c, 0x4e, 0x76, 0x41, 0x28, 0x28, 0x2b, 0x27,
+    0x28, 0x2b, 0x81, 0x27, 0x04, 0x2c, 0x2a, 0x2b, 0x2c, 0x2b, 0x82, 0x31,
+    0x05, 0x2c, 0x2b, 0x28, 0x2b, 0x28, 0x2a, 0x80, 0x27, 0x03, 0x25, 0x23,
+    0x28, 0x2b, 0x81, 0x27, 0x08, 0x23, 0x23, 0x27, 0x28, 0x2b, 0x2a, 0x28,
+    0x28, 0x25, 0x81, 0x27, 0x80, 0x2a, 0x01, 0x27, 0x25, 0x80, 0x27, 0x82,
+    0x2a, 0x8d, 0x27, 0x04, 0x2b, 0x2c, 0x2c, 0x2b, 0x2b, 0x86, 0x31, 0x03,
+    0x35, 0x34, 0x36, 0x36, 0x82, 0x37, 0x1e, 0x41, 0x42, 0x42, 0x4c, 0x51,
+    0x51, 0x5b, 0x6a, 0x83, 0x95, 0xd8, 0xa6, 0x99, 0xc3, 0xb1, 0xb2, 0xc8,
+    0x99, 0xd8, 0xd6, 0x9b, 0x83, 0x65, 0x56, 0x51, 0x4f, 0x4a, 0x42, 0x42,
+    0x3d, 0x41, 0x81, 0x37, 0x01, 0x36, 0x36, 0x88, 0x31, 0x04, 0x2b, 0x28,
+    0x25, 0x28, 0x27, 0x84, 0x21, 0x07, 0x28, 0x31, 0x57, 0x8a, 0x42, 0x31,
+    0x27, 0x21, 0x80, 0x17, 0x01, 0x19, 0x19, 0x82, 0x17, 0x02, 0x19, 0x18,
+    0x18, 0x80, 0x15, 0x01, 0x18, 0x18, 0x81, 0x15, 0x80, 0x12, 0x13, 0x18,
+    0x13, 0x1a, 0x23, 0x59, 0x52, 0x21, 0x1a, 0x1b, 0x28, 0x4e, 0x89, 0xc8,
+    0x94, 0x4e, 0x30, 0x22, 0x19, 0x16, 0x15, 0x8b, 0x12, 0x90, 0x0f, 0x83,
+    0x0b, 0x02, 0x23, 0x23, 0x25, 0x80, 0x27, 0x00, 0x25, 0x81, 0x27, 0x00,
+    0x2a, 0x85, 0x27, 0x83, 0x21, 0x05, 0x27, 0x23, 0x2b, 0x66, 0x36, 0x28,
+    0x8a, 0x21, 0x02, 0x25, 0x27, 0x28, 0x87, 0x21, 0x00, 0x25, 0x80, 0x21,
+    0x07, 0x4c, 0x73, 0x42, 0x2f, 0x25, 0x2b, 0x31, 0x2a, 0x82, 0x27, 0x81,
+    0x2a, 0x04, 0x31, 0x31, 0x2f, 0x2c, 0x2b, 0x80, 0x31, 0x82, 0x2a, 0x81,
+    0x27, 0x00, 0x25, 0x83, 0x27, 0x01, 0x25, 0x23, 0x84, 0x27, 0x00, 0x25,
+    0x85, 0x27, 0x03, 0x2a, 0x28, 0x28, 0x2c, 0x80, 0x2a, 0x81, 0x27, 0x01,
+    0x25, 0x25, 0x86, 0x27, 0x09, 0x2a, 0x28, 0x2b, 0x31, 0x2f, 0x31, 0x2f,
+    0x31, 0x2f, 0x2f, 0x85, 0x31, 0x02, 0x39, 0x37, 0x34, 0x80, 0x37, 0x1e,
+    0x3d, 0x41, 0x46, 0x48, 0x4c, 0x51, 0x56, 0x6a, 0x78, 0x83, 0x81, 0xde,
+    0x97, 0xbf, 0xd1, 0xb2, 0xb1, 0xbf, 0xde, 0xd7, 0x9b, 0x83, 0x74, 0x65,
+    0x53, 0x4f, 0x4c, 0x42, 0x41, 0x41, 0x3d, 0x80, 0x37, 0x03, 0x34, 0x34,
+    0x36, 0x36, 0x83, 0x31, 0x00, 0x2d, 0x83, 0x2a, 0x02, 0x28, 0x27, 0x25,
+    0x82, 0x21, 0x0f, 0x1b, 0x28, 0x27, 0x35, 0x93, 0x52, 0x31, 0x25, 0x22,
+    0x1d, 0x1a, 0x1a, 0x19, 0x18, 0x19, 0x19, 0x85, 0x17, 0x84, 0x15, 0x81,
+    0x12, 0x05, 0x15, 0x15, 0x18, 0x23, 0x59, 0x45, 0x80, 0x17, 0x0d, 0x21,
+    0x4a, 0x61, 0x6f, 0xc8, 0x7b, 0x3d, 0x28, 0x1c, 0x18, 0x16, 0x14, 0x14,
+    0x16, 0x85, 0x12, 0x02, 0x11, 0x12, 0x12, 0x90, 0x0f, 0x02, 0x0c, 0x0c,
+    0x0a, 0x80, 0x0b, 0x02, 0x23, 0x25, 0x25, 0x86, 0x27, 0x01, 0x2b, 0x2a,
+    0x81, 0x27, 0x01, 0x25, 0x25, 0x85, 0x21, 0x03, 0x28, 0x5a, 0x3c, 0x25,
+    0x8b, 0x21, 0x01, 0x25, 0x28, 0x80, 0x21, 0x03, 0x27, 0x23, 0x27, 0x25,
+    0x83, 0x21, 0x09, 0x31, 0x7e, 0x54, 0x37, 0x31, 0x27, 0x28, 0x2b, 0x2b,
+    0x2d, 0x81, 0x27, 0x81, 0x2a, 0x00, 0x2c, 0x80, 0x2a, 0x06, 0x2c, 0x2b,
+    0x2c, 0x31, 0x2c, 0x2c, 0x2b, 0x83, 0x27, 0x02, 0x23, 0x28, 0x2a, 0x81,
+    0x27, 0x09, 0x25, 0x23, 0x27, 0x25, 0x23, 0x25, 0x27, 0x27, 0x25, 0x25,
+    0x83, 0x27, 0x01, 0x2a, 0x2a, 0x80, 0x27, 0x80, 0x2a, 0x86, 0x27, 0x00,
+    0x2a, 0x83, 0x27, 0x04, 0x2a, 0x28, 0x2b, 0x31, 0x2f, 0x89, 0x31, 0x80,
+    0x37, 0x00, 0x34, 0x80, 0x37, 0x17, 0x3d, 0x41, 0x42, 0x4c, 0x4c, 0x56,
+    0x5b, 0x6e, 0x86, 0xba, 0xbf, 0xc5, 0xcf, 0xeb, 0xd4, 0xb1, 0xe8, 0x9e,
+    0xb4, 0xd6, 0x78, 0x65, 0x5b, 0x53, 0x80, 0x48, 0x02, 0x42, 0x3d, 0x3d,
+    0x81, 0x37, 0x81, 0x36, 0x07, 0x34, 0x31, 0x2b, 0x2c, 0x2c, 0x2b, 0x2a,
+    0x28, 0x82, 0x2a, 0x12, 0x28, 0x28, 0x25, 0x25, 0x23, 0x25, 0x27, 0x25,
+    0x2b, 0x47, 0x58, 0x77, 0x8a, 0x36, 0x28, 0x22, 0x24, 0x1d, 0x1b, 0x82,
+    0x17, 0x00, 0x19, 0x81, 0x17, 0x81, 0x15, 0x00, 0x14, 0x82, 0x15, 0x81,
+    0x12, 0x05, 0x15, 0x16, 0x1a, 0x22, 0x5d, 0x4b, 0x80, 0x17, 0x0c, 0x1b,
+    0x66, 0x3d, 0x4d, 0xbc, 0xcc, 0x93, 0x63, 0x5d, 0x34, 0x23, 0x15, 0x11,
+    0x8a, 0x12, 0x8e, 0x0f, 0x84, 0x0b, 0x01, 0x23, 0x25, 0x87, 0x27, 0x05,
+    0x2b, 0x2b, 0x28, 0x2a, 0x28, 0x28, 0x83, 0x21, 0x00, 0x25, 0x80, 0x21,
+    0x05, 0x28, 0x5a, 0x35, 0x23, 0x23, 0x25, 0x8a, 0x21, 0x00, 0x27, 0x80,
+    0x25, 0x02, 0x23, 0x22, 0x27, 0x81, 0x21, 0x0a, 0x27, 0x25, 0x2a, 0x2b,
+    0x53, 0xd9, 0x8b, 0x49, 0x28, 0x28, 0x2b, 0x81, 0x27, 0x85, 0x2a, 0x01,
+    0x28, 0x28, 0x84, 0x2a, 0x07, 0x28, 0x28, 0x2a, 0x2a, 0x28, 0x28, 0x25,
+    0x28, 0x81, 0x2a, 0x03, 0x28, 0x25, 0x27, 0x28, 0x80, 0x21, 0x81, 0x25,
+    0x88, 0x27, 0x80, 0x2a, 0x85, 0x27, 0x01, 0x2a, 0x2b, 0x83, 0x27, 0x81,
+    0x2a, 0x00, 0x2c, 0x89, 0x31, 0x84, 0x37, 0x17, 0x41, 0x42, 0x4a, 0x4f,
+    0x54, 0x65, 0x74, 0x7a, 0xb0, 0xad, 0xc6, 0xd3, 0xb2, 0xd3, 0xce, 0xbf,
+    0xa8, 0x90, 0xd7, 0x95, 0x65, 0x56, 0x53, 0x4f, 0x80, 0x48, 0x01, 0x42,
+    0x3d, 0x80, 0x37, 0x03, 0x36, 0x34, 0x36, 0x36, 0x81, 0x31, 0x03, 0x2c,
+    0x31, 0x31, 0x2c, 0x8b, 0x27, 0x09, 0x39, 0x7b, 0xac, 0x91, 0x55, 0x3c,
+    0x27, 0x25, 0x21, 0x22, 0x80, 0x17, 0x03, 0x19, 0x18, 0x18, 0x19, 0x80,
+    0x17, 0x82, 0x15, 0x81, 0x12, 0x01, 0x15, 0x15, 0x82, 0x12, 0x15, 0x15,
+    0x14, 0x17, 0x1b, 0x4d, 0x72, 0x25, 0x19, 0x16, 0x1a, 0x67, 0x31, 0x31,
+    0x55, 0x82, 0x63, 0xac, 0xcd, 0x88, 0x47, 0x23, 0x17, 0x8a, 0x12, 0x8d,
+    0x0f, 0x01, 0x0c, 0x0f, 0x83, 0x0b, 0x00, 0x25, 0x83, 0x27, 0x00, 0x2a,
+    0x82, 0x27, 0x00, 0x2a, 0x81, 0x27, 0x01, 0x25, 0x25, 0x85, 0x21, 0x05,
+    0x27, 0x5a, 0x31, 0x25, 0x22, 0x27, 0x89, 0x21, 0x04, 0x25, 0x41, 0x3e,
+    0x2b, 0x25, 0x80, 0x27, 0x0b, 0x25, 0x22, 0x27, 0x2b, 0x2f, 0x23, 0x28,
+    0x28, 0x6d, 0x9d, 0x8d, 0x55, 0x80, 0x27, 0x03, 0x25, 0x24, 0x28, 0x28,
+    0x83, 0x2a, 0x80, 0x27, 0x80, 0x2a, 0x03, 0x28, 0x2a, 0x2b, 0x2c, 0x82,
+    0x2a, 0x05, 0x2c, 0x28, 0x25, 0x28, 0x2b, 0x2b, 0x80, 0x27, 0x00, 0x25,
+    0x80, 0x27, 0x05, 0x25, 0x23, 0x25, 0x23, 0x25, 0x25, 0x87, 0x27, 0x02,
+    0x2a, 0x2c, 0x2c, 0x80, 0x2a, 0x83, 0x27, 0x01, 0x2a, 0x2b, 0x83, 0x27,
+    0x80, 0x2a, 0x03, 0x2c, 0x2c, 0x31, 0x2f, 0x87, 0x31, 0x82, 0x37, 0x18,
+    0x3d, 0x41, 0x41, 0x42, 0x4c, 0x51, 0x5b, 0x6c, 0x80, 0x94, 0xaf, 0xbe,
+    0xd1, 0xd4, 0xd2, 0xc0, 0xa9, 0xe0, 0xd9, 0xb3, 0x9b, 0x78, 0x5b, 0x53,
+    0x51, 0x80, 0x48, 0x01, 0x42, 0x42, 0x81, 0x37, 0x89, 0x31, 0x05, 0x2b,
+    0x2b, 0x28, 0x28, 0x25, 0x23, 0x81, 0x25, 0x11, 0x23, 0x27, 0x27, 0x2b,
+    0x4d, 0xc3, 0x57, 0x41, 0x31, 0x1d, 0x21, 0x22, 0x1d, 0x1d, 0x19, 0x1a,
+    0x19, 0x19, 0x83, 0x17, 0x82, 0x15, 0x87, 0x12, 0x16, 0x15, 0x15, 0x13,
+    0x16, 0x1c, 0x4d, 0x82, 0x3c, 0x1a, 0x14, 0x16, 0x43, 0x5a, 0x21, 0x22,
+    0x31, 0x39, 0x55, 0xac, 0xce, 0x72, 0x36, 0x16, 0x86, 0x12, 0x94, 0x0f,
+    0x82, 0x0b, 0x91, 0x27, 0x00, 0x25, 0x83, 0x21, 0x06, 0x25, 0x2b, 0x5a,
+    0x31, 0x22, 0x22, 0x27, 0x89, 0x21, 0x15, 0x28, 0x5b, 0x7e, 0x4c, 0x42,
+    0x40, 0x3c, 0x39, 0x34, 0x31, 0x42, 0x5f, 0x6a, 0x3c, 0x2a, 0x2a, 0x67,
+    0x67, 0x42, 0x36, 0x2b, 0x2b, 0x84, 0x27, 0x81, 0x2a, 0x00, 0x28, 0x82,
+    0x2a, 0x80, 0x27, 0x83, 0x2a, 0x01, 0x31, 0x2b, 0x81, 0x27, 0x00, 0x2b,
+    0x8d, 0x27, 0x00, 0x2a, 0x83, 0x27, 0x02, 0x2b, 0x28, 0x2b, 0x87, 0x27,
+    0x00, 0x25, 0x81, 0x27, 0x81, 0x2a, 0x01, 0x2c, 0x2c, 0x88, 0x31, 0x83,
+    0x37, 0x19, 0x41, 0x42, 0x42, 0x4a, 0x51, 0x56, 0x65, 0x81, 0x97, 0xe7,
+    0x8a, 0xc8, 0xb2, 0xe9, 0xe6, 0x97, 0xdd, 0xb4, 0xd6, 0x83, 0x78, 0x6a,
+    0x5b, 0x4f, 0x4f, 0x4c, 0x80, 0x42, 0x00, 0x41, 0x81, 0x37, 0x81, 0x31,
+    0x00, 0x2c, 0x80, 0x31, 0x0c, 0x2c, 0x2f, 0x31, 0x2c, 0x2b, 0x28, 0x27,
+    0x25, 0x25, 0x23, 0x25, 0x27, 0x25, 0x81, 0x21, 0x05, 0x28, 0x4d, 0xc3,
+    0x55, 0x27, 0x1f, 0x80, 0x1b, 0x00, 0x19, 0x80, 0x17, 0x00, 0x19, 0x84,
+    0x17, 0x82, 0x15, 0x80, 0x12, 0x00, 0x15, 0x83, 0x12, 0x17, 0x15, 0x14,
+    0x14, 0x18, 0x2b, 0x68, 0x46, 0x4a, 0x31, 0x18, 0x14, 0x1b, 0x54, 0x35,
+    0x1c, 0x1a, 0x22, 0x39, 0x64, 0xcf, 0xa3, 0x44, 0x1b, 0x15, 0x85, 0x12,
+    0x95, 0x0f, 0x81, 0x0b, 0x82, 0x27, 0x03, 0x25, 0x27, 0x25, 0x23, 0x80,
+    0x27, 0x03, 0x25, 0x27, 0x28, 0x2a, 0x81, 0x27, 0x84, 0x21, 0x06, 0x25,
+    0x2c, 0x66, 0x35, 0x25, 0x22, 0x25, 0x88, 0x21, 0x1f, 0x25, 0x27, 0x39,
+    0x4c, 0x4f, 0x5b, 0x5b, 0x51, 0x53, 0x66, 0x5f, 0x5f, 0x5a, 0x5f, 0x66,
+    0x5a, 0x4f, 0x7e, 0x4a, 0x25, 0x2a, 0x25, 0x2a, 0x2a, 0x28, 0x27, 0x23,
+    0x25, 0x28, 0x25, 0x25, 0x28, 0x81, 0x2a, 0x03, 0x2c, 0x2b, 0x2c, 0x2a,
+    0x82, 0x27, 0x01, 0x2b, 0x2b, 0x81, 0x2c, 0x84, 0x27, 0x03, 0x25, 0x28,
+    0x2b, 0x2b, 0x84, 0x27, 0x00, 0x25, 0x88, 0x27, 0x00, 0x25, 0x82, 0x27,
+    0x0a, 0x25, 0x25, 0x27, 0x28, 0x25, 0x23, 0x25, 0x28, 0x2b, 0x28, 0x28,
+    0x80, 0x2a, 0x02, 0x2c, 0x2b, 0x2c, 0x85, 0x31, 0x80, 0x36, 0x82, 0x37,
+    0x16, 0x3d, 0x42, 0x42, 0x4c, 0x51, 0x5b, 0x6f, 0xbf, 0xbf, 0x92, 0x8e,
+    0xcf, 0xea, 0xb1, 0xbf, 0x99, 0xb5, 0xd7, 0xd6, 0x78, 0x65, 0x65, 0x56,
+    0x80, 0x48, 0x01, 0x42, 0x41, 0x82, 0x37, 0x00, 0x36, 0x81, 0x31, 0x85,
+    0x2a, 0x80, 0x27, 0x03, 0x25, 0x23, 0x23, 0x27, 0x83, 0x21, 0x04, 0x25,
+    0x4d, 0xbf, 0x52, 0x27, 0x80, 0x1b, 0x05, 0x1a, 0x19, 0x1a, 0x19, 0x1a,
+    0x19, 0x86, 0x17, 0x03, 0x16, 0x18, 0x16, 0x15, 0x89, 0x12, 0x15, 0x1d,
+    0x55, 0x55, 0x1a, 0x28, 0x54, 0x2b, 0x18, 0x12, 0x31, 0x4f, 0x5f, 0x4e,
+    0x4a, 0x4e, 0x8f, 0xae, 0xbf, 0x52, 0x1d, 0x13, 0x15, 0x80, 0x12, 0x03,
+    0x11, 0x11, 0x12, 0x12, 0x94, 0x0f, 0x07, 0x0c, 0x0c, 0x0a, 0x0b, 0x0b,
+    0x25, 0x25, 0x23, 0x81, 0x27, 0x04, 0x23, 0x23, 0x28, 0x27, 0x25, 0x81,
+    0x27, 0x02, 0x2a, 0x28, 0x28, 0x85, 0x21, 0x03, 0x25, 0x42, 0x66, 0x36,
+    0x8d, 0x21, 0x11, 0x28, 0x39, 0x39, 0x31, 0x2b, 0x2b, 0x28, 0x39, 0x44,
+    0x34, 0x28, 0x2b, 0x3e, 0x42, 0x4a, 0x44, 0x31, 0x24, 0x80, 0x27, 0x03,
+    0x2a, 0x28, 0x27, 0x25, 0x81, 0x27, 0x84, 0x2a, 0x02, 0x2c, 0x2b, 0x2a,
+    0x82, 0x27, 0x04, 0x2b, 0x2b, 0x28, 0x2b, 0x2b, 0x83, 0x27, 0x01, 0x25,
+    0x25, 0x80, 0x27, 0x00, 0x25, 0x83, 0x27, 0x03, 0x23, 0x25, 0x28, 0x2b,
+    0x84, 0x27, 0x01, 0x25, 0x25, 0x83, 0x27, 0x02, 0x25, 0x28, 0x28, 0x80,
+    0x21, 0x01, 0x28, 0x2a, 0x82, 0x27, 0x80, 0x2a, 0x84, 0x31, 0x85, 0x37,
+    0x1c, 0x40, 0x41, 0x4a, 0x4c, 0x51, 0x51, 0x71, 0xa3, 0x76, 0xb4, 0xb4,
+    0xa8, 0xcc, 0xe9, 0xe9, 0xe8, 0x9e, 0xda, 0xd7, 0x95, 0x78, 0x65, 0x56,
+    0x51, 0x4c, 0x48, 0x42, 0x42, 0x41, 0x82, 0x37, 0x01, 0x34, 0x35, 0x80,
+    0x31, 0x00, 0x2c, 0x83, 0x2a, 0x81, 0x27, 0x01, 0x25, 0x23, 0x80, 0x27,
+    0x83, 0x21, 0x05, 0x41, 0x93, 0x72, 0x31, 0x23, 0x1e, 0x83, 0x17, 0x0c,
+    0x19, 0x18, 0x18, 0x16, 0x15, 0x18, 0x16, 0x15, 0x18, 0x16, 0x16, 0x18,
+    0x16, 0x84, 0x12, 0x00, 0x15, 0x81, 0x12, 0x14, 0x15, 0x2c, 0x76, 0x2e,
+    0x17, 0x1a, 0x4a, 0x3c, 0x15, 0x13, 0x1b, 0x21, 0x35, 0x5a, 0x5b, 0x7a,
+    0xca, 0x60, 0x7b, 0x7c, 0x2c, 0x80, 0x12, 0x02, 0x10, 0x12, 0x11, 0x80,
+    0x12, 0x8b, 0x0f, 0x80, 0x0b, 0x82, 0x0f, 0x83, 0x0b, 0x80, 0x21, 0x00,
+    0x25, 0x84, 0x27, 0x00, 0x25, 0x83, 0x27, 0x0c, 0x23, 0x23, 0x25, 0x25,
+    0x23, 0x23, 0x25, 0x28, 0x2b, 0x4c, 0x6c, 0x42, 0x2b, 0x8e, 0x21, 0x0c,
+    0x31, 0x40, 0x31, 0x23, 0x28, 0x27, 0x22, 0x22, 0x28, 0x28, 0x1e, 0x24,
+    0x24, 0x80, 0x25, 0x00, 0x24, 0x80, 0x27, 0x06, 0x2a, 0x28, 0x28, 0x25,
+    0x28, 0x2c, 0x2c, 0x82, 0x2a, 0x00, 0x2c, 0x85, 0x2a, 0x81, 0x27, 0x03,
+    0x2a, 0x2b, 0x2c, 0x2a, 0x86, 0x27, 0x0b, 0x23, 0x23, 0x25, 0x28, 0x27,
+    0x25, 0x28, 0x27, 0x25, 0x28, 0x2b, 0x2b, 0x83, 0x27, 0x0b, 0x2a, 0x27,
+    0x25, 0x28, 0x28, 0x25, 0x27, 0x25, 0x23, 0x23, 0x25, 0x27, 0x80, 0x21,
+    0x02, 0x28, 0x28, 0x25, 0x80, 0x27, 0x81, 0x2a, 0x82, 0x31, 0x01, 0x36,
+    0x36, 0x81, 0x37, 0x00, 0x41, 0x81, 0x37, 0x1f, 0x42, 0x4c, 0x4c, 0x51,
+    0x62, 0xc3, 0x71, 0x83, 0xd6, 0x9c, 0xde, 0xac, 0xcf, 0xd4, 0xb1, 0xc3,
+    0x98, 0xd8, 0x9b, 0x78, 0x6a, 0x5b, 0x51, 0x4c, 0x48, 0x42, 0x42, 0x41,
+    0x41, 0x3c, 0x39, 0x36, 0x82, 0x31, 0x82, 0x2a, 0x02, 0x2c, 0x2b, 0x2b,
+    0x81, 0x27, 0x83, 0x21, 0x0b, 0x1d, 0x1d, 0x21, 0x22, 0x28, 0x37, 0x64,
+    0x93, 0x41, 0x23, 0x22, 0x1b, 0x85, 0x17, 0x03, 0x15, 0x15, 0x18, 0x18,
+    0x83, 0x15, 0x84, 0x12, 0x00, 0x16, 0x82, 0x12, 0x16, 0x42, 0x55, 0x1a,
+    0x15, 0x15, 0x2b, 0x43, 0x22, 0x18, 0x14, 0x14, 0x15, 0x1b, 0x23, 0x4d,
+    0xbf, 0x7b, 0x61, 0x9e, 0x45, 0x28, 0x16, 0x11, 0x83, 0x12, 0x8b, 0x0f,
+    0x89, 0x0b, 0x04, 0x0f, 0x0e, 0x23, 0x25, 0x23, 0x85, 0x27, 0x00, 0x25,
+    0x80, 0x27, 0x02, 0x25, 0x23, 0x25, 0x83, 0x21, 0x05, 0x28, 0x41, 0x5b,
+    0x66, 0x3c, 0x27, 0x8f, 0x21, 0x06, 0x28, 0x31, 0x2c, 0x25, 0x23, 0x23,
+    0x25, 0x80, 0x21, 0x02, 0x25, 0x25, 0x23, 0x81, 0x27, 0x01, 0x25, 0x25,
+    0x81, 0x27, 0x01, 0x23, 0x28, 0x81, 0x2a, 0x03, 0x2c, 0x2b, 0x2b, 0x2c,
+    0x81, 0x2a, 0x03, 0x31, 0x2c, 0x2c, 0x2a, 0x81, 0x27, 0x03, 0x2a, 0x2b,
+    0x2c, 0x2b, 0x81, 0x27, 0x00, 0x2b, 0x81, 0x27, 0x0b, 0x23, 0x23, 0x25,
+    0x28, 0x25, 0x25, 0x28, 0x27, 0x25, 0x28, 0x2b, 0x2b, 0x83, 0x27, 0x00,
+    0x2b, 0x81, 0x27, 0x00, 0x23, 0x80, 0x25, 0x80, 0x21, 0x01, 0x25, 0x23,
+    0x81, 0x25, 0x80, 0x27, 0x04, 0x2b, 0x2c, 0x2b, 0x2b, 0x2c, 0x83, 0x31,
+    0x85, 0x37, 0x1f, 0x42, 0x53, 0x58, 0x5c, 0x64, 0xbf, 0x7c, 0x65, 0x6c,
+    0x83, 0xd7, 0xd8, 0xb7, 0xe6, 0xb1, 0xd4, 0xce, 0x8e, 0xd9, 0xd6, 0x83,
+    0x6a, 0x5b, 0x51, 0x4c, 0x48, 0x46, 0x42, 0x42, 0x41, 0x3c, 0x36, 0x84,
+    0x31, 0x84, 0x2a, 0x06, 0x27, 0x23, 0x23, 0x28, 0x23, 0x23, 0x27, 0x80,
+    0x21, 0x0d, 0x1d, 0x1a, 0x1b, 0x22, 0x2b, 0x41, 0x70, 0xb0, 0x60, 0x25,
+    0x1b, 0x1b, 0x1a, 0x19, 0x83, 0x17, 0x03, 0x15, 0x16, 0x18, 0x18, 0x80,
+    0x15, 0x02, 0x12, 0x14, 0x15, 0x84, 0x12, 0x07, 0x15, 0x14, 0x14, 0x15,
+    0x15, 0x28, 0x66, 0x38, 0x80, 0x12, 0x04, 0x16, 0x38, 0x4a, 0x2c, 0x18,
+    0x81, 0x12, 0x0e, 0x28, 0x60, 0xbf, 0x8e, 0x91, 0xa9, 0x7b, 0x2f, 0x18,
+    0x15, 0x15, 0x10, 0x0f, 0x12, 0x12, 0x8c, 0x0f, 0x86, 0x0b, 0x81, 0x0f,
+    0x80, 0x25, 0x80, 0x27, 0x00, 0x2a, 0x81, 0x27, 0x00, 0x25, 0x81, 0x27,
+    0x0b, 0x25, 0x25, 0x27, 0x27, 0x25, 0x22, 0x23, 0x28, 0x4c, 0x66, 0x48,
+    0x31, 0x93, 0x21, 0x01, 0x28, 0x28, 0x83, 0x21, 0x05, 0x25, 0x23, 0x23,
+    0x28, 0x2a, 0x25, 0x80, 0x21, 0x81, 0x27, 0x00, 0x23, 0x81, 0x27, 0x83,
+    0x2a, 0x05, 0x2c, 0x2a, 0x2b, 0x31, 0x2b, 0x2b, 0x83, 0x27, 0x01, 0x2b,
+    0x2c, 0x80, 0x2a, 0x85, 0x27, 0x00, 0x25, 0x80, 0x27, 0x00, 0x25, 0x81,
+    0x27, 0x01, 0x2b, 0x2b, 0x88, 0x27, 0x03, 0x23, 0x25, 0x27, 0x27, 0x81,
+    0x21, 0x03, 0x28, 0x27, 0x23, 0x25, 0x82, 0x27, 0x03, 0x2c, 0x2c, 0x2b,
+    0x2b, 0x84, 0x31, 0x82, 0x37, 0x1b, 0x42, 0x41, 0x61, 0x8e, 0x9f, 0x92,
+    0x87, 0xa2, 0x61, 0x65, 0x65, 0x78, 0x9b, 0xd8, 0xa7, 0xa4, 0xd2, 0xb2,
+    0xd0, 0xbb, 0xb4, 0xd6, 0x78, 0x65, 0x56, 0x4f, 0x4c, 0x48, 0x80, 0x42,
+    0x02, 0x3d, 0x3c, 0x36, 0x80, 0x31, 0x02, 0x35, 0x31, 0x31, 0x82, 0x2a,
+    0x09, 0x2c, 0x2b, 0x28, 0x27, 0x25, 0x25, 0x28, 0x25, 0x25, 0x27, 0x80,
+    0x21, 0x10, 0x1d, 0x1a, 0x1b, 0x27, 0x40, 0x5c, 0xa3, 0xe6, 0x60, 0x2f,
+    0x1b, 0x1b, 0x1a, 0x19, 0x18, 0x18, 0x16, 0x80, 0x17, 0x81, 0x15, 0x01,
+    0x14, 0x15, 0x8c, 0x12, 0x03, 0x25, 0x73, 0x4e, 0x1a, 0x80, 0x12, 0x13,
+    0x16, 0x14, 0x28, 0x43, 0x36, 0x15, 0x16, 0x14, 0x14, 0x1a, 0x2b, 0x52,
+    0xc6, 0x77, 0x5c, 0xa4, 0x52, 0x23, 0x18, 0x15, 0x81, 0x12, 0x8c, 0x0f,
+    0x83, 0x0b, 0x01, 0x0a, 0x0a, 0x82, 0x0b, 0x02, 0x23, 0x25, 0x25, 0x82,
+    0x27, 0x03, 0x25, 0x27, 0x25, 0x23, 0x83, 0x27, 0x08, 0x25, 0x25, 0x22,
+    0x23, 0x28, 0x41, 0x66, 0x3d, 0x27, 0x89, 0x21, 0x00, 0x25, 0x81, 0x21,
+    0x03, 0x25, 0x23, 0x23, 0x25, 0x80, 0x21, 0x00, 0x27, 0x81, 0x21, 0x04,
+    0x25, 0x27, 0x23, 0x23, 0x25, 0x80, 0x27, 0x09, 0x25, 0x23, 0x25, 0x28,
+    0x27, 0x25, 0x25, 0x27, 0x28, 0x2a, 0x83, 0x27, 0x06, 0x2b, 0x2c, 0x2b,
+    0x2b, 0x2c, 0x2b, 0x2b, 0x83, 0x27, 0x03, 0x2b, 0x2b, 0x2c, 0x31, 0x80,
+    0x2a, 0x83, 0x27, 0x82, 0x2a, 0x82, 0x27, 0x01, 0x2b, 0x25, 0x88, 0x27,
+    0x04, 0x23, 0x25, 0x28, 0x28, 0x25, 0x80, 0x21, 0x03, 0x28, 0x28, 0x25,
+    0x28, 0x80, 0x2a, 0x81, 0x27, 0x01, 0x2b, 0x2b, 0x84, 0x31, 0x81, 0x37,
+    0x1b, 0x40, 0x48, 0x55, 0xa3, 0x71, 0x53, 0x5b, 0x67, 0xb7, 0x56, 0x56,
+    0x65, 0x6a, 0x83, 0xd6, 0xa6, 0x9f, 0xd0, 0xea, 0xd0, 0x9f, 0xb4, 0xd6,
+    0x78, 0x65, 0x53, 0x4c, 0x48, 0x80, 0x42, 0x05, 0x41, 0x3d, 0x39, 0x36,
+    0x34, 0x36, 0x81, 0x31, 0x00, 0x2b, 0x81, 0x27, 0x00, 0x2b, 0x80, 0x27,
+    0x80, 0x25, 0x81, 0x21, 0x0f, 0x1d, 0x1d, 0x21, 0x1c, 0x1d, 0x2b, 0x4c,
+    0x75, 0xe6, 0x72, 0x42, 0x25, 0x1d, 0x1b, 0x1a, 0x18, 0x87, 0x15, 0x01,
+    0x14, 0x15, 0x8b, 0x12, 0x03, 0x1a, 0x3e, 0x5a, 0x1a, 0x84, 0x12, 0x02,
+    0x22, 0x73, 0x24, 0x80, 0x12, 0x0b, 0x15, 0x1c, 0x31, 0xa3, 0x87, 0x42,
+    0x55, 0x87, 0x32, 0x16, 0x14, 0x15, 0x80, 0x12, 0x81, 0x0f, 0x00, 0x0c,
+    0x88, 0x0f, 0x83, 0x0b, 0x00, 0x0a, 0x82, 0x0b, 0x00, 0x23, 0x80, 0x27,
+    0x00, 0x25, 0x82, 0x27, 0x01, 0x25, 0x25, 0x83, 0x27, 0x08, 0x25, 0x23,
+    0x22, 0x25, 0x41, 0x5b, 0x49, 0x28, 0x28, 0x89, 0x21, 0x00, 0x25, 0x84,
+    0x21, 0x01, 0x25, 0x23, 0x80, 0x25, 0x00, 0x27, 0x88, 0x21, 0x09, 0x25,
+    0x23, 0x23, 0x25, 0x27, 0x27, 0x25, 0x28, 0x2b, 0x2a, 0x80, 0x27, 0x03,
+    0x25, 0x25, 0x28, 0x28, 0x83, 0x2a, 0x82, 0x27, 0x02, 0x2b, 0x2f, 0x31,
+    0x80, 0x2a, 0x85, 0x27, 0x01, 0x2b, 0x2b, 0x8e, 0x27, 0x00, 0x25, 0x80,
+    0x27, 0x01, 0x25, 0x23, 0x81, 0x27, 0x01, 0x25, 0x23, 0x81, 0x27, 0x01,
+    0x2b, 0x2a, 0x80, 0x27, 0x81, 0x2a, 0x82, 0x31, 0x01, 0x2c, 0x34, 0x80,
+    0x37, 0x09, 0x3d, 0x4c, 0x5c, 0xa2, 0x60, 0x51, 0x4c, 0x4c, 0x53, 0x91,
+    0x80, 0x56, 0x13, 0x65, 0x83, 0x9b, 0xb4, 0x97, 0xce, 0xb2, 0xd1, 0xa0,
+    0xb4, 0x9b, 0x78, 0x5e, 0x53, 0x4f, 0x48, 0x42, 0x42, 0x41, 0x41, 0x80,
+    0x37, 0x02, 0x34, 0x34, 0x36, 0x80, 0x31, 0x0e, 0x2c, 0x2b, 0x2b, 0x28,
+    0x28, 0x2b, 0x28, 0x27, 0x25, 0x27, 0x25, 0x25, 0x22, 0x1d, 0x21, 0x83,
+    0x1b, 0x0c, 0x2b, 0x3c, 0x4c, 0x7b, 0x8a, 0x3d, 0x25, 0x21, 0x1a, 0x1b,
+    0x1a, 0x15, 0x18, 0x84, 0x15, 0x80, 0x12, 0x00, 0x15, 0x86, 0x12, 0x00,
+    0x11, 0x80, 0x12, 0x04, 0x23, 0x66, 0x31, 0x16, 0x11, 0x82, 0x12, 0x11,
+    0x15, 0x1b, 0x66, 0x21, 0x14, 0x15, 0x14, 0x14, 0x1c, 0x34, 0xbf, 0x63,
+    0x31, 0x25, 0x63, 0x59, 0x1a, 0x15, 0x81, 0x12, 0x8e, 0x0f, 0x84, 0x0b,
+    0x00, 0x0f, 0x80, 0x0b, 0x00, 0x23, 0x87, 0x27, 0x0e, 0x25, 0x25, 0x28,
+    0x28, 0x2b, 0x2b, 0x28, 0x25, 0x25, 0x28, 0x41, 0x5b, 0x42, 0x2b, 0x28,
+    0x94, 0x21, 0x05, 0x25, 0x28, 0x23, 0x23, 0x25, 0x25, 0x84, 0x21, 0x01,
+    0x25, 0x25, 0x80, 0x21, 0x82, 0x27, 0x05, 0x2a, 0x28, 0x25, 0x28, 0x28,
+    0x23, 0x80, 0x27, 0x80, 0x2a, 0x0a, 0x2c, 0x2c, 0x2b, 0x2b, 0x2d, 0x28,
+    0x2a, 0x28, 0x2c, 0x31, 0x31, 0x80, 0x2a, 0x85, 0x27, 0x03, 0x2a, 0x28,
+    0x25, 0x25, 0x80, 0x27, 0x02, 0x25, 0x25, 0x23, 0x8a, 0x27, 0x01, 0x25,
+    0x23, 0x82, 0x27, 0x00, 0x23, 0x81, 0x27, 0x00, 0x2b, 0x80, 0x27, 0x83,
+    0x2a, 0x80, 0x31, 0x02, 0x35, 0x35, 0x34, 0x80, 0x37, 0x1f, 0x41, 0x4c,
+    0x9e, 0x64, 0x4f, 0x4a, 0x42, 0x48, 0x4c, 0x89, 0x5e, 0x53, 0x5b, 0x6a,
+    0x83, 0xd6, 0xd9, 0x92, 0xe8, 0xea, 0xeb, 0xa1, 0xb5, 0xd7, 0x78, 0x5e,
+    0x53, 0x51, 0x48, 0x42, 0x41, 0x41, 0x80, 0x37, 0x02, 0x36, 0x34, 0x36,
+    0x82, 0x31, 0x80, 0x2a, 0x07, 0x28, 0x2b, 0x28, 0x25, 0x25, 0x28, 0x28,
+    0x25, 0x80, 0x21, 0x02, 0x1d, 0x1d, 0x21, 0x80, 0x1b, 0x07, 0x21, 0x23,
+    0x31, 0x4d, 0x9f, 0x8a, 0x52, 0x31, 0x80, 0x1b, 0x81, 0x17, 0x82, 0x15,
+    0x80, 0x12, 0x00, 0x15, 0x85, 0x12, 0x09, 0x15, 0x12, 0x14, 0x15, 0x18,
+    0x4e, 0x4e, 0x1a, 0x18, 0x11, 0x83, 0x12, 0x03, 0x1c, 0x4a, 0x1a, 0x15,
+    0x80, 0x12, 0x0a, 0x1a, 0x36, 0xc3, 0x72, 0x34, 0x21, 0x4b, 0xa3, 0x36,
+    0x15, 0x15, 0x82, 0x12, 0x8c, 0x0f, 0x83, 0x0b, 0x01, 0x0f, 0x0f, 0x80,
+    0x0b, 0x02, 0x23, 0x27, 0x28, 0x81, 0x25, 0x81, 0x27, 0x0d, 0x25, 0x23,
+    0x25, 0x28, 0x2b, 0x31, 0x2c, 0x28, 0x27, 0x39, 0x5e, 0x41, 0x25, 0x27,
+    0x96, 0x21, 0x04, 0x25, 0x23, 0x23, 0x25, 0x25, 0x84, 0x21, 0x02, 0x25,
+    0x23, 0x23, 0x80, 0x25, 0x81, 0x27, 0x00, 0x2b, 0x80, 0x27, 0x02, 0x2b,
+    0x28, 0x28, 0x80, 0x2a, 0x0a, 0x2c, 0x2f, 0x31, 0x31, 0x2f, 0x2f, 0x2d,
+    0x2b, 0x28, 0x2b, 0x2c, 0x80, 0x31, 0x01, 0x2b, 0x2b, 0x80, 0x27, 0x00,
+    0x25, 0x81, 0x27, 0x02, 0x2b, 0x28, 0x27, 0x80, 0x25, 0x82, 0x21, 0x00,
+    0x25, 0x84, 0x27, 0x05, 0x25, 0x25, 0x28, 0x28, 0x25, 0x23, 0x82, 0x27,
+    0x05, 0x23, 0x28, 0x2b, 0x2b, 0x28, 0x2a, 0x80, 0x27, 0x83, 0x2a, 0x82,
+    0x31, 0x07, 0x35, 0x39, 0x3c, 0x42, 0x4c, 0x55, 0xa2, 0x4d, 0x80, 0x42,
+    0x18, 0x4a, 0x51, 0x91, 0x5e, 0x51, 0x5b, 0x65, 0x83, 0xd6, 0xd9, 0x9a,
+    0xc8, 0xb2, 0xeb, 0xa4, 0xa6, 0xd7, 0x78, 0x5e, 0x53, 0x51, 0x48, 0x42,
+    0x42, 0x41, 0x80, 0x37, 0x85, 0x31, 0x02, 0x2b, 0x2b, 0x2c, 0x80, 0x27,
+    0x04, 0x23, 0x23, 0x25, 0x27, 0x25, 0x81, 0x21, 0x02, 0x1d, 0x23, 0x21,
+    0x81, 0x1b, 0x08, 0x25, 0x2b, 0x4d, 0x85, 0xbe, 0x57, 0x2b, 0x1d, 0x1b,
+    0x80, 0x17, 0x83, 0x15, 0x03, 0x14, 0x14, 0x15, 0x15, 0x84, 0x12, 0x00,
+    0x11, 0x81, 0x15, 0x06, 0x28, 0x73, 0x36, 0x14, 0x14, 0x15, 0x15, 0x80,
+    0x12, 0x12, 0x11, 0x12, 0x15, 0x2b, 0x22, 0x18, 0x15, 0x14, 0x12, 0x18,
+    0x28, 0x71, 0xbf, 0x45, 0x28, 0x3a, 0xbf, 0x47, 0x15, 0x83, 0x12, 0x8a,
+    0x0f, 0x83, 0x0b, 0x03, 0x0f, 0x0c, 0x0f, 0x0f, 0x80, 0x0b, 0x0d, 0x23,
+    0x27, 0x28, 0x25, 0x23, 0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x23, 0x25,
+    0x25, 0x82, 0x27, 0x04, 0x2a, 0x53, 0x51, 0x28, 0x27, 0x96, 0x21, 0x80,
+    0x25, 0x01, 0x23, 0x25, 0x80, 0x21, 0x01, 0x25, 0x25, 0x80, 0x21, 0x02,
+    0x25, 0x23, 0x25, 0x80, 0x27, 0x00, 0x25, 0x80, 0x27, 0x0c, 0x2b, 0x2b,
+    0x28, 0x28, 0x2c, 0x2b, 0x2c, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x2c, 0x81,
+    0x2a, 0x02, 0x2c, 0x2b, 0x2c, 0x82, 0x2a, 0x80, 0x27, 0x02, 0x23, 0x23,
+    0x25, 0x83, 0x27, 0x01, 0x25, 0x25, 0x84, 0x27, 0x00, 0x25, 0x81, 0x27,
+    0x81, 0x25, 0x03, 0x28, 0x28, 0x25, 0x23, 0x80, 0x27, 0x05, 0x25, 0x28,
+    0x23, 0x28, 0x2b, 0x2b, 0x81, 0x27, 0x32, 0x2a, 0x28, 0x2b, 0x2c, 0x2c,
+    0x2b, 0x2b, 0x31, 0x2c, 0x31, 0x34, 0x36, 0x39, 0x3c, 0x42, 0x4e, 0x60,
+    0x93, 0x77, 0x4c, 0x40, 0x42, 0x41, 0x4a, 0x53, 0x91, 0x61, 0x51, 0x5b,
+    0x65, 0x83, 0xd6, 0xd9, 0x99, 0xc5, 0xd4, 0xb1, 0xac, 0xdb, 0xd7, 0x83,
+    0x65, 0x56, 0x51, 0x4c, 0x4a, 0x42, 0x41, 0x3d, 0x3c, 0x39, 0x84, 0x31,
+    0x80, 0x2a, 0x80, 0x27, 0x00, 0x25, 0x81, 0x21, 0x03, 0x25, 0x22, 0x1d,
+    0x21, 0x86, 0x1b, 0x05, 0x21, 0x28, 0x41, 0x8f, 0x7c, 0x34, 0x80, 0x1b,
+    0x03, 0x1a, 0x18, 0x16, 0x15, 0x80, 0x12, 0x04, 0x15, 0x15, 0x14, 0x15,
+    0x15, 0x85, 0x12, 0x07, 0x15, 0x14, 0x14, 0x1a, 0x54, 0x53, 0x12, 0x11,
+    0x86, 0x12, 0x0f, 0x19, 0x28, 0x23, 0x18, 0x14, 0x14, 0x16, 0x22, 0x4d,
+    0xbf, 0x60, 0x28, 0x3f, 0xac, 0x47, 0x16, 0x83, 0x12, 0x89, 0x0f, 0x84,
+    0x0b, 0x00, 0x0f, 0x83, 0x0b, 0x06, 0x23, 0x27, 0x27, 0x25, 0x25, 0x27,
+    0x25, 0x81, 0x27, 0x02, 0x25, 0x28, 0x27, 0x81, 0x25, 0x04, 0x27, 0x4e,
+    0x66, 0x31, 0x27, 0x82, 0x21, 0x00, 0x25, 0x8d, 0x21, 0x00, 0x25, 0x80,
+    0x21, 0x82, 0x27, 0x04, 0x25, 0x25, 0x23, 0x25, 0x27, 0x81, 0x21, 0x01,
+    0x25, 0x25, 0x80, 0x27, 0x05, 0x25, 0x27, 0x27, 0x2b, 0x31, 0x2b, 0x80,
+    0x27, 0x03, 0x2b, 0x2b, 0x2c, 0x31, 0x80, 0x2a, 0x82, 0x27, 0x04, 0x2a,
+    0x2b, 0x31, 0x2b, 0x2b, 0x82, 0x27, 0x01, 0x25, 0x23, 0x89, 0x27, 0x81,
+    0x2a, 0x01, 0x28, 0x23, 0x81, 0x27, 0x81, 0x21, 0x03, 0x28, 0x28, 0x25,
+    0x23, 0x80, 0x27, 0x04, 0x25, 0x27, 0x23, 0x28, 0x2a, 0x82, 0x27, 0x82,
+    0x2a, 0x00, 0x2c, 0x82, 0x31, 0x25, 0x38, 0x3d, 0x46, 0x55, 0x8f, 0xa3,
+    0x89, 0x51, 0x42, 0x42, 0x3d, 0x43, 0x4a, 0x4c, 0x79, 0x86, 0x53, 0x5b,
+    0x65, 0x83, 0xd6, 0xd9, 0xb8, 0xe6, 0xd4, 0xe9, 0xbf, 0xdb, 0xd7, 0x83,
+    0x6a, 0x56, 0x53, 0x4c, 0x48, 0x42, 0x41, 0x41, 0x80, 0x37, 0x00, 0x36,
+    0x82, 0x31, 0x01, 0x2b, 0x2b, 0x80, 0x27, 0x83, 0x21, 0x07, 0x27, 0x23,
+    0x1d, 0x21, 0x1d, 0x1b, 0x1a, 0x1a, 0x80, 0x1b, 0x08, 0x21, 0x22, 0x1d,
+    0x1d, 0x31, 0x7c, 0x7c, 0x34, 0x1c, 0x81, 0x17, 0x84, 0x15, 0x02, 0x14,
+    0x15, 0x15, 0x84, 0x12, 0x00, 0x15, 0x80, 0x12, 0x04, 0x1b, 0x66, 0x37,
+    0x14, 0x14, 0x80, 0x0f, 0x84, 0x12, 0x0f, 0x25, 0x35, 0x1b, 0x14, 0x15,
+    0x16, 0x22, 0x46, 0xbf, 0x72, 0x31, 0x31, 0x8e, 0x59, 0x21, 0x16, 0x82,
+    0x12, 0x89, 0x0f, 0x02, 0x0c, 0x0f, 0x0f, 0x81, 0x0b, 0x00, 0x0f, 0x83,
+    0x0b, 0x04, 0x25, 0x28, 0x2a, 0x25, 0x25, 0x89, 0x27, 0x04, 0x31, 0x4f,
+    0x7e, 0x41, 0x28, 0x9b, 0x21, 0x80, 0x25, 0x03, 0x23, 0x23, 0x27, 0x28,
+    0x80, 0x21, 0x80, 0x25, 0x83, 0x27, 0x02, 0x2b, 0x2c, 0x2a, 0x80, 0x27,
+    0x05, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x2c, 0x80, 0x2a, 0x81, 0x27, 0x06,
+    0x2b, 0x2c, 0x2f, 0x2b, 0x28, 0x2b, 0x2b, 0x85, 0x27, 0x00, 0x2a, 0x84,
+    0x27, 0x80, 0x2a, 0x03, 0x28, 0x28, 0x25, 0x25, 0x80, 0x27, 0x81, 0x21,
+    0x80, 0x27, 0x00, 0x25, 0x80, 0x27, 0x0e, 0x25, 0x28, 0x25, 0x27, 0x25,
+    0x23, 0x27, 0x28, 0x2a, 0x28, 0x28, 0x2a, 0x2a, 0x28, 0x2c, 0x81, 0x31,
+    0x29, 0x35, 0x38, 0x41, 0x4d, 0x89, 0xa2, 0x7b, 0x53, 0x48, 0x42, 0x41,
+    0x3c, 0x41, 0x42, 0x4a, 0x4c, 0x61, 0x84, 0x56, 0x5b, 0x65, 0x83, 0xd6,
+    0xd9, 0xb8, 0xc5, 0xb2, 0xe9, 0xbe, 0x90, 0xd7, 0x83, 0x6c, 0x5b, 0x53,
+    0x4f, 0x48, 0x42, 0x42, 0x41, 0x41, 0x3d, 0x81, 0x37, 0x80, 0x31, 0x80,
+    0x2a, 0x08, 0x28, 0x28, 0x25, 0x25, 0x27, 0x27, 0x25, 0x25, 0x27, 0x80,
+    0x21, 0x85, 0x1b, 0x09, 0x1a, 0x17, 0x1f, 0x2f, 0x55, 0x88, 0x36, 0x1c,
+    0x1b, 0x19, 0x80, 0x17, 0x83, 0x15, 0x02, 0x14, 0x14, 0x15, 0x87, 0x12,
+    0x06, 0x15, 0x16, 0x42, 0x5f, 0x1d, 0x12, 0x12, 0x80, 0x0f, 0x83, 0x12,
+    0x10, 0x1a, 0x43, 0x1d, 0x14, 0x14, 0x16, 0x2b, 0x6f, 0xc8, 0x88, 0x42,
+    0x25, 0x52, 0xa2, 0x3b, 0x16, 0x11, 0x82, 0x12, 0x8c, 0x0f, 0x82, 0x0b,
+    0x80, 0x06, 0x07, 0x0c, 0x0c, 0x23, 0x27, 0x28, 0x23, 0x23, 0x25, 0x82,
+    0x27, 0x0d, 0x22, 0x25, 0x28, 0x28, 0x2b, 0x34, 0x5a, 0x5f, 0x41, 0x28,
+    0x28, 0x25, 0x23, 0x25, 0x96, 0x21, 0x02, 0x25, 0x23, 0x27, 0x81, 0x25,
+    0x01, 0x28, 0x27, 0x80, 0x21, 0x80, 0x25, 0x83, 0x27, 0x80, 0x2a, 0x84,
+    0x27, 0x80, 0x2a, 0x04, 0x31, 0x2c, 0x2a, 0x2a, 0x28, 0x80, 0x2a, 0x04,
+    0x31, 0x2b, 0x2b, 0x28, 0x28, 0x85, 0x2a, 0x82, 0x27, 0x80, 0x2a, 0x00,
+    0x2c, 0x80, 0x2a, 0x02, 0x28, 0x25, 0x25, 0x81, 0x27, 0x04, 0x25, 0x23,
+    0x23, 0x28, 0x2a, 0x80, 0x27, 0x00, 0x2b, 0x82, 0x27, 0x06, 0x25, 0x23,
+    0x25, 0x28, 0x2b, 0x27, 0x28, 0x80, 0x2a, 0x2b, 0x28, 0x31, 0x31, 0x36,
+    0x41, 0x42, 0x4e, 0x7b, 0xa2, 0x82, 0x58, 0x48, 0x42, 0x41, 0x41, 0x3c,
+    0x41, 0x41, 0x42, 0x4a, 0x4c, 0x67, 0x8d, 0x5b, 0x53, 0x6a, 0x83, 0xd6,
+    0xd8, 0x99, 0xc8, 0xb2, 0xe9, 0xad, 0xdc, 0xd8, 0x95, 0x6a, 0x65, 0x53,
+    0x4f, 0x48, 0x42, 0x42, 0x80, 0x40, 0x80, 0x37, 0x00, 0x36, 0x81, 0x31,
+    0x04, 0x2f, 0x2c, 0x2b, 0x2b, 0x27, 0x81, 0x25, 0x00, 0x27, 0x80, 0x21,
+    0x81, 0x1b, 0x16, 0x21, 0x21, 0x1b, 0x1a, 0x19, 0x1a, 0x1a, 0x27, 0x2f,
+    0x57, 0x8f, 0x36, 0x1b, 0x19, 0x19, 0x1a, 0x1a, 0x19, 0x16, 0x14, 0x16,
+    0x15, 0x14, 0x81, 0x15, 0x84, 0x12, 0x08, 0x15, 0x12, 0x14, 0x15, 0x13,
+    0x1d, 0x6c, 0x42, 0x13, 0x82, 0x0f, 0x00, 0x12, 0x80, 0x0f, 0x10, 0x12,
+    0x14, 0x40, 0x23, 0x12, 0x14, 0x17, 0x2f, 0x6f, 0xc5, 0x94, 0x4c, 0x22,
+    0x2b, 0x87, 0x59, 0x1a, 0x83, 0x12, 0x8c, 0x0f, 0x81, 0x0b, 0x01, 0x0a,
+    0x0a, 0x81, 0x0b, 0x06, 0x23, 0x27, 0x27, 0x23, 0x23, 0x25, 0x25, 0x81,
+    0x27, 0x08, 0x22, 0x25, 0x36, 0x4a, 0x4a, 0x66, 0x6a, 0x39, 0x28, 0x82,
+    0x25, 0x95, 0x21, 0x03, 0x25, 0x23, 0x27, 0x27, 0x80, 0x21, 0x02, 0x25,
+    0x28, 0x25, 0x81, 0x21, 0x01, 0x25, 0x25, 0x80, 0x27, 0x02, 0x2a, 0x28,
+    0x27, 0x80, 0x2a, 0x85, 0x27, 0x01, 0x2a, 0x2c, 0x81, 0x2a, 0x00, 0x28,
+    0x80, 0x2a, 0x02, 0x2c, 0x2b, 0x2b, 0x82, 0x27, 0x03, 0x2b, 0x2c, 0x2b,
+    0x2a, 0x85, 0x27, 0x82, 0x2a, 0x85, 0x27, 0x01, 0x25, 0x25, 0x81, 0x27,
+    0x00, 0x2b, 0x87, 0x27, 0x38, 0x25, 0x2b, 0x2b, 0x28, 0x2a, 0x30, 0x31,
+    0x39, 0x41, 0x58, 0x79, 0x7f, 0xa4, 0x8e, 0x6d, 0x4c, 0x42, 0x40, 0x41,
+    0x3d, 0x3c, 0x3d, 0x41, 0x41, 0x42, 0x4a, 0x4c, 0x67, 0x7f, 0x56, 0x5f,
+    0x65, 0x78, 0xd6, 0x9c, 0xb7, 0xca, 0xe9, 0xb2, 0xc6, 0xb7, 0xd9, 0xd6,
+    0x6e, 0x6a, 0x53, 0x4f, 0x4c, 0x42, 0x42, 0x41, 0x3d, 0x41, 0x3c, 0x39,
+    0x36, 0x35, 0x81, 0x31, 0x05, 0x2f, 0x2c, 0x2b, 0x2b, 0x28, 0x25, 0x83,
+    0x21, 0x85, 0x1b, 0x80, 0x17, 0x09, 0x1c, 0x34, 0x4c, 0xa0, 0x63, 0x31,
+    0x19, 0x17, 0x1a, 0x1d, 0x81, 0x17, 0x00, 0x19, 0x84, 0x15, 0x88, 0x12,
+    0x02, 0x1a, 0x4f, 0x4e, 0x80, 0x12, 0x85, 0x0f, 0x10, 0x12, 0x25, 0x30,
+    0x16, 0x15, 0x12, 0x1a, 0x3c, 0x55, 0xbf, 0x7b, 0x2b, 0x22, 0x52, 0x8a,
+    0x29, 0x18, 0x82, 0x12, 0x80, 0x0f, 0x00, 0x12, 0x88, 0x0f, 0x81, 0x0b,
+    0x00, 0x0a, 0x81, 0x0b, 0x14, 0x0a, 0x23, 0x27, 0x27, 0x25, 0x23, 0x25,
+    0x23, 0x25, 0x25, 0x28, 0x28, 0x2b, 0x4a, 0x4e, 0x4a, 0x41, 0x42, 0x31,
+    0x28, 0x25, 0x9c, 0x21, 0x00, 0x25, 0x81, 0x21, 0x02, 0x25, 0x28, 0x25,
+    0x81, 0x21, 0x03, 0x25, 0x25, 0x27, 0x25, 0x80, 0x27, 0x01, 0x25, 0x2b,
+    0x80, 0x27, 0x00, 0x2a, 0x80, 0x27, 0x04, 0x2c, 0x2b, 0x28, 0x2a, 0x2c,
+    0x89, 0x2a, 0x82, 0x27, 0x00, 0x2b, 0x87, 0x27, 0x81, 0x2a, 0x86, 0x27,
+    0x01, 0x25, 0x25, 0x83, 0x27, 0x02, 0x25, 0x23, 0x25, 0x81, 0x27, 0x81,
+    0x2a, 0x01, 0x28, 0x2b, 0x80, 0x31, 0x09, 0x42, 0x60, 0xa2, 0x63, 0x64,
+    0x62, 0x42, 0x39, 0x3c, 0x35, 0x81, 0x37, 0x80, 0x40, 0x1f, 0x42, 0x4a,
+    0x4c, 0x53, 0x8c, 0x67, 0x5b, 0x65, 0x78, 0x83, 0xd8, 0xdc, 0xbf, 0xd3,
+    0xea, 0xd0, 0xa0, 0xa6, 0xd6, 0x83, 0x74, 0x54, 0x4f, 0x4c, 0x42, 0x41,
+    0x41, 0x3d, 0x3d, 0x3c, 0x39, 0x36, 0x83, 0x31, 0x80, 0x2a, 0x01, 0x28,
+    0x27, 0x82, 0x21, 0x00, 0x1f, 0x85, 0x1b, 0x0c, 0x1a, 0x1a, 0x1e, 0x27,
+    0x49, 0x8a, 0x87, 0x42, 0x23, 0x19, 0x1a, 0x1a, 0x1b, 0x81, 0x17, 0x03,
+    0x14, 0x12, 0x15, 0x14, 0x82, 0x15, 0x84, 0x12, 0x05, 0x15, 0x12, 0x12,
+    0x1d, 0x5f, 0x3e, 0x81, 0x12, 0x83, 0x0f, 0x10, 0x0c, 0x12, 0x13, 0x28,
+    0x36, 0x17, 0x13, 0x18, 0x1a, 0x2b, 0x64, 0xc0, 0x47, 0x1b, 0x35, 0x8e,
+    0x45, 0x82, 0x12, 0x00, 0x11, 0x82, 0x12, 0x87, 0x0f, 0x81, 0x0b, 0x00,
+    0x0a, 0x80, 0x0b, 0x16, 0x0a, 0x0a, 0x23, 0x27, 0x27, 0x25, 0x25, 0x27,
+    0x25, 0x24, 0x28, 0x27, 0x25, 0x39, 0x5b, 0x3c, 0x28, 0x2a, 0x28, 0x28,
+    0x25, 0x23, 0x25, 0xa1, 0x21, 0x01, 0x27, 0x27, 0x81, 0x21, 0x08, 0x25,
+    0x23, 0x25, 0x23, 0x23, 0x28, 0x27, 0x25, 0x25, 0x80, 0x27, 0x07, 0x2a,
+    0x2a, 0x28, 0x2b, 0x31, 0x2f, 0x2a, 0x28, 0x81, 0x2a, 0x00, 0x2c, 0x82,
+    0x2a, 0x03, 0x28, 0x28, 0x2a, 0x2a, 0x99, 0x27, 0x03, 0x25, 0x23, 0x25,
+    0x28, 0x80, 0x25, 0x80, 0x21, 0x00, 0x25, 0x80, 0x27, 0x80, 0x2a, 0x81,
+    0x31, 0x07, 0x3c, 0x4c, 0x55, 0x8e, 0xa2, 0x5d, 0x42, 0x3d, 0x80, 0x37,
+    0x00, 0x31, 0x83, 0x37, 0x1d, 0x40, 0x3c, 0x42, 0x42, 0x48, 0x4f, 0x67,
+    0x7a, 0x6a, 0x65, 0x83, 0x83, 0xd7, 0xa6, 0x9e, 0xd0, 0xb2, 0xb1, 0xe6,
+    0xb6, 0xd7, 0x9b, 0x78, 0x5b, 0x51, 0x4c, 0x48, 0x42, 0x41, 0x3d, 0x81,
+    0x37, 0x00, 0x36, 0x81, 0x31, 0x80, 0x2a, 0x80, 0x27, 0x81, 0x21, 0x87,
+    0x1b, 0x13, 0x1a, 0x1a, 0x22, 0x36, 0x85, 0x72, 0x41, 0x37, 0x23, 0x1a,
+    0x1a, 0x16, 0x16, 0x19, 0x25, 0x4a, 0x4a, 0x38, 0x21, 0x18, 0x80, 0x12,
+    0x81, 0x15, 0x85, 0x12, 0x06, 0x11, 0x23, 0x81, 0x39, 0x15, 0x12, 0x11,
+    0x80, 0x12, 0x83, 0x0f, 0x03, 0x12, 0x22, 0x54, 0x18, 0x80, 0x12, 0x08,
+    0x1a, 0x4d, 0xc6, 0x57, 0x1d, 0x23, 0x63, 0x5d, 0x1a, 0x80, 0x12, 0x80,
+    0x0f, 0x81, 0x12, 0x86, 0x0f, 0x00, 0x0c, 0x80, 0x0f, 0x01, 0x0b, 0x0a,
+    0x80, 0x0b, 0x02, 0x0a, 0x0a, 0x23, 0x80, 0x27, 0x0d, 0x25, 0x27, 0x25,
+    0x28, 0x31, 0x28, 0x2b, 0x4a, 0x4a, 0x31, 0x28, 0x24, 0x23, 0x25, 0x80,
+    0x27, 0x9d, 0x21, 0x83, 0x25, 0x81, 0x21, 0x00, 0x25, 0x81, 0x21, 0x03,
+    0x28, 0x27, 0x25, 0x23, 0x84, 0x27, 0x87, 0x2a, 0x02, 0x28, 0x2a, 0x2a,
+    0x99, 0x27, 0x81, 0x25, 0x05, 0x28, 0x25, 0x23, 0x25, 0x28, 0x25, 0x82,
+    0x21, 0x01, 0x28, 0x25, 0x80, 0x27, 0x0c, 0x2b, 0x2b, 0x2c, 0x2a, 0x36,
+    0x3c, 0x41, 0x5a, 0x92, 0x89, 0x4e, 0x3d, 0x39, 0x83, 0x31, 0x83, 0x37,
+    0x1a, 0x3d, 0x41, 0x42, 0x42, 0x51, 0x51, 0x68, 0x86, 0x65, 0x78, 0xd6,
+    0xd6, 0xb4, 0xb7, 0xc6, 0xe9, 0xd4, 0xcf, 0x93, 0xb4, 0x95, 0x83, 0x5e,
+    0x56, 0x4f, 0x4c, 0x46, 0x80, 0x40, 0x00, 0x3d, 0x80, 0x37, 0x81, 0x31,
+    0x01, 0x2c, 0x2b, 0x82, 0x27, 0x00, 0x25, 0x81, 0x21, 0x81, 0x1b, 0x01,
+    0x1a, 0x1a, 0x82, 0x1b, 0x11, 0x36, 0x8e, 0x57, 0x31, 0x28, 0x22, 0x1d,
+    0x1a, 0x17, 0x1d, 0x2c, 0x4a, 0x50, 0x34, 0x35, 0x25, 0x18, 0x15, 0x80,
+    0x12, 0x80, 0x15, 0x85, 0x12, 0x05, 0x11, 0x1b, 0x58, 0x58, 0x1a, 0x0f,
+    0x81, 0x12, 0x81, 0x0f, 0x05, 0x12, 0x11, 0x12, 0x2a, 0x44, 0x15, 0x80,
+    0x12, 0x0d, 0x19, 0x31, 0x7b, 0xa0, 0x5d, 0x41, 0x57, 0x6f, 0x22, 0x15,
+    0x14, 0x12, 0x11, 0x10, 0x81, 0x12, 0x85, 0x0f, 0x80, 0x0b, 0x80, 0x0f,
+    0x01, 0x0b, 0x0a, 0x80, 0x0b, 0x02, 0x0a, 0x0a, 0x22, 0x85, 0x27, 0x08,
+    0x3c, 0x54, 0x4c, 0x2b, 0x28, 0x28, 0x25, 0x28, 0x25, 0x80, 0x27, 0x80,
+    0x21, 0x00, 0x25, 0x97, 0x21, 0x04, 0x25, 0x23, 0x23, 0x25, 0x23, 0x80,
+    0x25, 0x82, 0x21, 0x08, 0x25, 0x25, 0x23, 0x23, 0x28, 0x28, 0x25, 0x23,
+    0x25, 0x81, 0x27, 0x00, 0x2b, 0x80, 0x27, 0x84, 0x2a, 0x88, 0x27, 0x00,
+    0x2a, 0x86, 0x27, 0x80, 0x2a, 0x83, 0x27, 0x00, 0x25, 0x85, 0x21, 0x80,
+    0x27, 0x06, 0x23, 0x25, 0x25, 0x23, 0x27, 0x2b, 0x23, 0x81, 0x27, 0x13,
+    0x2b, 0x31, 0x31, 0x39, 0x42, 0x69, 0x9f, 0x76, 0x46, 0x39, 0x36, 0x31,
+    0x35, 0x34, 0x30, 0x31, 0x35, 0x38, 0x34, 0x36, 0x82, 0x37, 0x00, 0x41,
+    0x81, 0x48, 0x17, 0x56, 0x91, 0x73, 0x78, 0x83, 0xd6, 0xd8, 0xa7, 0xa4,
+    0xd1, 0xb2, 0xd3, 0xc6, 0xdd, 0xd7, 0x83, 0x6a, 0x5b, 0x4f, 0x4f, 0x48,
+    0x42, 0x41, 0x41, 0x81, 0x37, 0x00, 0x36, 0x80, 0x31, 0x01, 0x2c, 0x2b,
+    0x83, 0x27, 0x00, 0x25, 0x80, 0x21, 0x81, 0x1b, 0x01, 0x1a, 0x1a, 0x82,
+    0x1b, 0x15, 0x28, 0x69, 0x93, 0x45, 0x2b, 0x23, 0x1d, 0x1d, 0x22, 0x34,
+    0x4a, 0x31, 0x1a, 0x16, 0x14, 0x16, 0x1a, 0x18, 0x15, 0x14, 0x14, 0x15,
+    0x83, 0x12, 0x00, 0x15, 0x81, 0x12, 0x03, 0x15, 0x27, 0x73, 0x35, 0x82,
+    0x12, 0x81, 0x0f, 0x07, 0x12, 0x11, 0x12, 0x2b, 0x1d, 0x12, 0x11, 0x14,
+    0x80, 0x15, 0x07, 0x31, 0x5d, 0xc3, 0x64, 0x6f, 0x71, 0x1d, 0x18, 0x81,
+    0x12, 0x89, 0x0f, 0x00, 0x0b, 0x81, 0x0f, 0x04, 0x0c, 0x0b, 0x0a, 0x0a,
+    0x0b, 0x80, 0x06, 0x83, 0x27, 0x07, 0x25, 0x28, 0x41, 0x5b, 0x5f, 0x39,
+    0x28, 0x28, 0x81, 0x25, 0x80, 0x27, 0x97, 0x21, 0x03, 0x25, 0x23, 0x23,
+    0x25, 0x83, 0x21, 0x01, 0x25, 0x23, 0x81, 0x25, 0x81, 0x21, 0x07, 0x25,
+    0x28, 0x28, 0x25, 0x23, 0x25, 0x27, 0x25, 0x83, 0x27, 0x04, 0x2b, 0x2b,
+    0x2c, 0x2b, 0x2a, 0x89, 0x27, 0x01, 0x2b, 0x2b, 0x82, 0x27, 0x00, 0x2b,
+    0x8a, 0x27, 0x86, 0x21, 0x09, 0x25, 0x25, 0x22, 0x27, 0x28, 0x23, 0x25,
+    0x28, 0x25, 0x25, 0x80, 0x27, 0x08, 0x2b, 0x37, 0x41, 0x5c, 0x8e, 0x9a,
+    0x55, 0x41, 0x37, 0x84, 0x31, 0x02, 0x36, 0x34, 0x34, 0x83, 0x37, 0x00,
+    0x42, 0x80, 0x48, 0x18, 0x4f, 0x56, 0x7d, 0x8c, 0x6e, 0x83, 0xd6, 0xd8,
+    0xa7, 0xbe, 0xd0, 0xea, 0xb2, 0xca, 0xb6, 0xd8, 0xd6, 0x6c, 0x56, 0x4f,
+    0x4f, 0x48, 0x48, 0x42, 0x3d, 0x81, 0x37, 0x00, 0x36, 0x81, 0x31, 0x80,
+    0x2a, 0x0b, 0x25, 0x27, 0x25, 0x28, 0x25, 0x23, 0x25, 0x23, 0x1f, 0x1b,
+    0x1b, 0x1a, 0x80, 0x1b, 0x00, 0x1a, 0x80, 0x1b, 0x0c, 0x23, 0x42, 0x87,
+    0xac, 0x4c, 0x28, 0x22, 0x28, 0x37, 0x6d, 0x41, 0x18, 0x14, 0x80, 0x15,
+    0x02, 0x18, 0x16, 0x15, 0x8b, 0x12, 0x04, 0x15, 0x1a, 0x58, 0x4d, 0x17,
+    0x80, 0x12, 0x81, 0x0f, 0x05, 0x12, 0x12, 0x11, 0x16, 0x38, 0x18, 0x83,
+    0x12, 0x07, 0x1a, 0x31, 0x6f, 0xc3, 0xa4, 0x52, 0x1d, 0x16, 0x81, 0x12,
+    0x89, 0x0f, 0x02, 0x0c, 0x0f, 0x0f, 0x81, 0x0b, 0x02, 0x0a, 0x0a, 0x0b,
+    0x80, 0x06, 0x84, 0x27, 0x03, 0x31, 0x50, 0x37, 0x34, 0x82, 0x27, 0x03,
+    0x25, 0x25, 0x28, 0x25, 0x9a, 0x21, 0x00, 0x25, 0x80, 0x21, 0x05, 0x25,
+    0x25, 0x23, 0x23, 0x25, 0x23, 0x82, 0x25, 0x80, 0x21, 0x04, 0x25, 0x2a,
+    0x2b, 0x28, 0x23, 0x81, 0x27, 0x00, 0x2b, 0x81, 0x27, 0x03, 0x2b, 0x2c,
+    0x31, 0x2b, 0x86, 0x27, 0x00, 0x2a, 0x80, 0x27, 0x01, 0x2b, 0x2b, 0x82,
+    0x27, 0x03, 0x2a, 0x2b, 0x28, 0x2a, 0x88, 0x27, 0x01, 0x23, 0x25, 0x80,
+    0x21, 0x08, 0x25, 0x23, 0x23, 0x25, 0x23, 0x25, 0x28, 0x22, 0x23, 0x83,
+    0x27, 0x07, 0x34, 0x39, 0x4d, 0x63, 0x9f, 0x60, 0x42, 0x35, 0x80, 0x31,
+    0x00, 0x2b, 0x83, 0x31, 0x00, 0x36, 0x84, 0x37, 0x01, 0x42, 0x42, 0x80,
+    0x48, 0x17, 0x5b, 0x4f, 0x90, 0x81, 0x83, 0xd7, 0xd9, 0xb8, 0xc6, 0xe9,
+    0xea, 0xd1, 0xa5, 0xa7, 0xd8, 0x83, 0x78, 0x5e, 0x53, 0x4f, 0x4c, 0x48,
+    0x42, 0x3d, 0x81, 0x37, 0x82, 0x31, 0x80, 0x2a, 0x00, 0x25, 0x80, 0x27,
+    0x03, 0x23, 0x23, 0x25, 0x22, 0x80, 0x1b, 0x19, 0x1a, 0x1a, 0x1b, 0x1b,
+    0x1a, 0x1a, 0x1b, 0x22, 0x25, 0x4d, 0xa0, 0x59, 0x5b, 0x54, 0x31, 0x2a,
+    0x4c, 0x73, 0x47, 0x1a, 0x15, 0x16, 0x14, 0x12, 0x15, 0x15, 0x8c, 0x12,
+    0x07, 0x15, 0x23, 0x5a, 0x4e, 0x13, 0x16, 0x15, 0x12, 0x81, 0x0f, 0x05,
+    0x12, 0x11, 0x11, 0x1a, 0x4a, 0x18, 0x83, 0x12, 0x08, 0x15, 0x18, 0x3d,
+    0xbf, 0xcb, 0x89, 0x31, 0x1a, 0x1a, 0x80, 0x12, 0x82, 0x0f, 0x01, 0x0c,
+    0x0c, 0x81, 0x0f, 0x86, 0x0b, 0x01, 0x0a, 0x0b, 0x80, 0x06, 0x81, 0x27,
+    0x07, 0x25, 0x27, 0x28, 0x39, 0x4a, 0x2f, 0x28, 0x25, 0x84, 0x27, 0x9c,
+    0x21, 0x00, 0x25, 0x80, 0x21, 0x04, 0x27, 0x27, 0x25, 0x27, 0x27, 0x82,
+    0x25, 0x08, 0x23, 0x25, 0x23, 0x27, 0x2b, 0x2c, 0x28, 0x27, 0x2b, 0x80,
+    0x27, 0x00, 0x2b, 0x81, 0x27, 0x03, 0x2b, 0x2c, 0x2b, 0x2b, 0x83, 0x27,
+    0x01, 0x2a, 0x2a, 0x82, 0x27, 0x01, 0x2b, 0x2b, 0x82, 0x27, 0x00, 0x2a,
+    0x82, 0x27, 0x01, 0x25, 0x23, 0x84, 0x27, 0x02, 0x25, 0x23, 0x25, 0x80,
+    0x27, 0x01, 0x23, 0x23, 0x80, 0x25, 0x10, 0x28, 0x25, 0x25, 0x27, 0x2b,
+    0x28, 0x28, 0x35, 0x41, 0x4d, 0x77, 0x8e, 0x72, 0x4e, 0x39, 0x35, 0x2c,
+    0x80, 0x2a, 0x02, 0x28, 0x28, 0x2b, 0x81, 0x31, 0x84, 0x37, 0x02, 0x3d,
+    0x41, 0x42, 0x80, 0x48, 0x17, 0x4f, 0x51, 0x73, 0x8b, 0x7d, 0x9c, 0xd9,
+    0xe2, 0xc8, 0xea, 0xb2, 0xc8, 0xaa, 0xdd, 0xd8, 0x95, 0x83, 0x65, 0x56,
+    0x51, 0x4c, 0x48, 0x42, 0x41, 0x80, 0x37, 0x00, 0x36, 0x81, 0x31, 0x01,
+    0x2b, 0x2b, 0x83, 0x27, 0x80, 0x25, 0x00, 0x23, 0x84, 0x1b, 0x14, 0x1a,
+    0x1a, 0x1d, 0x1a, 0x31, 0x71, 0x7c, 0x31, 0x31, 0x58, 0x66, 0x4f, 0x5b,
+    0x67, 0x4d, 0x23, 0x1a, 0x18, 0x14, 0x14, 0x15, 0x8d, 0x12, 0x05, 0x15,
+    0x4a, 0x6d, 0x21, 0x12, 0x15, 0x80, 0x12, 0x80, 0x0f, 0x80, 0x12, 0x02,
+    0x16, 0x39, 0x28, 0x84, 0x12, 0x0f, 0x16, 0x23, 0x5d, 0xc6, 0xca, 0x63,
+    0x2e, 0x1a, 0x12, 0x15, 0x11, 0x12, 0x10, 0x0c, 0x0c, 0x0f, 0x80, 0x0b,
+    0x80, 0x0f, 0x83, 0x0b, 0x04, 0x0a, 0x0b, 0x0b, 0x0a, 0x0b, 0x80, 0x06,
+    0x0b, 0x27, 0x27, 0x25, 0x25, 0x23, 0x25, 0x22, 0x39, 0x66, 0x31, 0x28,
+    0x2b, 0x83, 0x27, 0x03, 0x2a, 0x28, 0x27, 0x25, 0x9d, 0x21, 0x01, 0x28,
+    0x28, 0x80, 0x25, 0x86, 0x21, 0x81, 0x27, 0x05, 0x2b, 0x2a, 0x28, 0x28,
+    0x2b, 0x2a, 0x80, 0x27, 0x03, 0x2b, 0x31, 0x2f, 0x2b, 0x82, 0x27, 0x06,
+    0x2b, 0x2b, 0x28, 0x2b, 0x28, 0x2b, 0x28, 0x80, 0x2a, 0x82, 0x27, 0x00,
+    0x2a, 0x82, 0x27, 0x81, 0x25, 0x81, 0x27, 0x00, 0x25, 0x80, 0x21, 0x83,
+    0x27, 0x0e, 0x25, 0x22, 0x2a, 0x2b, 0x2c, 0x3c, 0x4c, 0x58, 0x5c, 0x69,
+    0x92, 0x9a, 0x79, 0x55, 0x3d, 0x80, 0x31, 0x06, 0x28, 0x2b, 0x2a, 0x2d,
+    0x2a, 0x28, 0x2a, 0x81, 0x31, 0x01, 0x36, 0x36, 0x83, 0x37, 0x1d, 0x41,
+    0x42, 0x42, 0x48, 0x4c, 0x4f, 0x53, 0x65, 0x80, 0xb5, 0x91, 0x8c, 0x92,
+    0xca, 0xd4, 0xb2, 0xce, 0xa1, 0x98, 0xd8, 0xd6, 0x83, 0x6a, 0x5e, 0x56,
+    0x4f, 0x4c, 0x42, 0x41, 0x3d, 0x80, 0x37, 0x81, 0x31, 0x82, 0x2a, 0x81,
+    0x27, 0x81, 0x21, 0x83, 0x1b, 0x14, 0x1a, 0x1a, 0x1b, 0x1a, 0x31, 0x89,
+    0x57, 0x28, 0x1b, 0x23, 0x31, 0x36, 0x2b, 0x28, 0x28, 0x1a, 0x16, 0x16,
+    0x14, 0x14, 0x15, 0x89, 0x12, 0x81, 0x15, 0x06, 0x19, 0x54, 0x5f, 0x19,
+    0x12, 0x12, 0x11, 0x80, 0x12, 0x82, 0x0f, 0x04, 0x12, 0x2a, 0x35, 0x12,
+    0x11, 0x83, 0x12, 0x0d, 0x18, 0x2e, 0x5d, 0xc3, 0xcb, 0x7c, 0x31, 0x16,
+    0x15, 0x12, 0x0f, 0x0f, 0x0b, 0x0c, 0x80, 0x0f, 0x86, 0x0b, 0x81, 0x06,
+    0x01, 0x0b, 0x0b, 0x80, 0x06, 0x00, 0x27, 0x80, 0x25, 0x07, 0x23, 0x23,
+    0x25, 0x27, 0x4f, 0x40, 0x23, 0x25, 0x83, 0x27, 0x02, 0x2b, 0x28, 0x28,
+    0x9e, 0x21, 0x80, 0x27, 0x01, 0x25, 0x25, 0x86, 0x21, 0x03, 0x25, 0x27,
+    0x25, 0x25, 0x81, 0x27, 0x00, 0x2b, 0x81, 0x27, 0x03, 0x2b, 0x31, 0x31,
+    0x2b, 0x81, 0x27, 0x84, 0x2a, 0x02, 0x28, 0x2b, 0x2b, 0x80, 0x27, 0x00,
+    0x2a, 0x8c, 0x27, 0x05, 0x25, 0x23, 0x23, 0x25, 0x25, 0x27, 0x81, 0x2a,
+    0x1b, 0x28, 0x27, 0x23, 0x28, 0x2b, 0x36, 0x55, 0x92, 0xac, 0x9e, 0x92,
+    0x62, 0x4c, 0x41, 0x35, 0x2c, 0x28, 0x25, 0x2a, 0x28, 0x2b, 0x2b, 0x31,
+    0x2f, 0x2b, 0x2c, 0x2b, 0x2b, 0x81, 0x31, 0x00, 0x36, 0x82, 0x37, 0x02,
+    0x3d, 0x42, 0x42, 0x80, 0x48, 0x1b, 0x53, 0x5b, 0x74, 0x6e, 0xa6, 0xe1,
+    0xba, 0xe7, 0xd3, 0xea, 0xb1, 0xc6, 0x8a, 0xa6, 0xd7, 0xd6, 0x6e, 0x65,
+    0x56, 0x51, 0x4c, 0x48, 0x42, 0x3d, 0x3d, 0x3c, 0x37, 0x36, 0x80, 0x31,
+    0x80, 0x2a, 0x06, 0x2c, 0x2b, 0x28, 0x28, 0x25, 0x27, 0x25, 0x81, 0x21,
+    0x01, 0x1b, 0x1a, 0x80, 0x1b, 0x06, 0x1a, 0x1a, 0x1b, 0x21, 0x2e, 0x85,
+    0x4b, 0x80, 0x21, 0x0a, 0x17, 0x16, 0x18, 0x18, 0x16, 0x14, 0x14, 0x15,
+    0x14, 0x15, 0x15, 0x88, 0x12, 0x81, 0x15, 0x06, 0x18, 0x1d, 0x41, 0x40,
+    0x35, 0x16, 0x11, 0x84, 0x12, 0x04, 0x0f, 0x10, 0x12, 0x49, 0x25, 0x86,
+    0x12, 0x06, 0x22, 0x47, 0x9f, 0x69, 0xbf, 0x77, 0x28, 0x80, 0x12, 0x04,
+    0x11, 0x0c, 0x0c, 0x0f, 0x0f, 0x85, 0x0b, 0x00, 0x0f, 0x80, 0x0b, 0x00,
+    0x0a, 0x80, 0x0b, 0x04, 0x0a, 0x0a, 0x0b, 0x23, 0x25, 0x81, 0x21, 0x06,
+    0x28, 0x28, 0x2f, 0x4c, 0x39, 0x28, 0x25, 0x84, 0x27, 0x00, 0x25, 0x9e,
+    0x21, 0x03, 0x25, 0x23, 0x23, 0x25, 0x84, 0x21, 0x02, 0x25, 0x23, 0x23,
+    0x80, 0x27, 0x01, 0x23, 0x25, 0x80, 0x27, 0x08, 0x2c, 0x2a, 0x28, 0x28,
+    0x2a, 0x2b, 0x31, 0x31, 0x2b, 0x81, 0x27, 0x87, 0x2a, 0x03, 0x28, 0x28,
+    0x2b, 0x2a, 0x84, 0x27, 0x00, 0x2b, 0x89, 0x27, 0x81, 0x2a, 0x00, 0x2c,
+    0x80, 0x2a, 0x09, 0x31, 0x39, 0x5d, 0x8e, 0x62, 0x46, 0x41, 0x41, 0x37,
+    0x31, 0x81, 0x2a, 0x06, 0x25, 0x2b, 0x30, 0x2b, 0x2b, 0x31, 0x2c, 0x81,
+    0x2a, 0x00, 0x2c, 0x81, 0x31, 0x83, 0x37, 0x1d, 0x42, 0x42, 0x46, 0x48,
+    0x4f, 0x53, 0x56, 0x6a, 0x78, 0x95, 0xb4, 0xdc, 0x9e, 0xcf, 0xb2, 0xea,
+    0xd2, 0xc3, 0x91, 0xd9, 0x9b, 0x83, 0x6a, 0x5e, 0x51, 0x4c, 0x4c, 0x42,
+    0x41, 0x41, 0x80, 0x37, 0x09, 0x36, 0x34, 0x31, 0x2f, 0x2b, 0x2c, 0x2f,
+    0x2b, 0x28, 0x27, 0x80, 0x25, 0x81, 0x21, 0x01, 0x1b, 0x1a, 0x82, 0x1b,
+    0x0b, 0x21, 0x27, 0x2c, 0x97, 0x4b, 0x22, 0x1a, 0x1c, 0x1a, 0x15, 0x18,
+    0x18, 0x80, 0x12, 0x01, 0x16, 0x15, 0x89, 0x12, 0x00, 0x15, 0x81, 0x12,
+    0x05, 0x15, 0x1c, 0x1c, 0x1a, 0x38, 0x28, 0x85, 0x12, 0x04, 0x11, 0x12,
+    0x14, 0x4a, 0x27, 0x85, 0x12, 0x0d, 0x16, 0x18, 0x3b, 0x9f, 0x4c, 0x52,
+    0xbf, 0x57, 0x1a, 0x15, 0x12, 0x12, 0x0f, 0x0c, 0x80, 0x0f, 0x07, 0x0c,
+    0x0b, 0x0a, 0x0a, 0x0c, 0x0a, 0x0b, 0x0f, 0x85, 0x0b, 0x04, 0x0a, 0x0a,
+    0x23, 0x25, 0x25, 0x80, 0x21, 0x0a, 0x25, 0x25, 0x2b, 0x2c, 0x4a, 0x4f,
+    0x31, 0x22, 0x28, 0x23, 0x23, 0x80, 0x27, 0x00, 0x25, 0x99, 0x21, 0x01,
+    0x25, 0x25, 0x89, 0x21, 0x00, 0x25, 0x81, 0x21, 0x09, 0x25, 0x28, 0x2a,
+    0x27, 0x27, 0x23, 0x25, 0x28, 0x2b, 0x2b, 0x89, 0x27, 0x80, 0x2a, 0x85,
+    0x27, 0x00, 0x2c, 0x80, 0x2a, 0x03, 0x28, 0x28, 0x2a, 0x2b, 0x86, 0x27,
+    0x02, 0x2b, 0x28, 0x2b, 0x80, 0x27, 0x19, 0x25, 0x31, 0x31, 0x28, 0x27,
+    0x31, 0x31, 0x37, 0x5c, 0xa2, 0x4d, 0x3c, 0x31, 0x31, 0x2c, 0x2b, 0x2b,
+    0x28, 0x23, 0x25, 0x23, 0x27, 0x2b, 0x31, 0x28, 0x28, 0x80, 0x2a, 0x01,
+    0x31, 0x31, 0x80, 0x2a, 0x80, 0x31, 0x00, 0x36, 0x81, 0x37, 0x21, 0x3d,
+    0x41, 0x42, 0x42, 0x4c, 0x4f, 0x56, 0x5e, 0x6a, 0x78, 0x9b, 0x95, 0xd8,
+    0xa7, 0xc0, 0xb1, 0xd4, 0xea, 0xd1, 0x9f, 0x90, 0xd7, 0x83, 0x74, 0x5e,
+    0x51, 0x4f, 0x48, 0x42, 0x41, 0x3d, 0x39, 0x37, 0x36, 0x81, 0x31, 0x03,
+    0x2c, 0x31, 0x31, 0x2a, 0x82, 0x27, 0x81, 0x21, 0x80, 0x1b, 0x0d, 0x21,
+    0x1b, 0x1a, 0x1a, 0x21, 0x28, 0x36, 0x93, 0x4b, 0x22, 0x1a, 0x19, 0x18,
+    0x18, 0x81, 0x15, 0x80, 0x12, 0x01, 0x15, 0x15, 0x8b, 0x12, 0x08, 0x15,
+    0x1a, 0x15, 0x14, 0x11, 0x1a, 0x3c, 0x22, 0x11, 0x80, 0x12, 0x18, 0x11,
+    0x12, 0x11, 0x10, 0x12, 0x14, 0x35, 0x2c, 0x1a, 0x11, 0x12, 0x12, 0x0f,
+    0x12, 0x11, 0x12, 0x12, 0x15, 0x34, 0xa0, 0x52, 0x2b, 0x72, 0xbc, 0x2d,
+    0x80, 0x12, 0x02, 0x15, 0x11, 0x0b, 0x80, 0x0f, 0x86, 0x0b, 0x01, 0x0a,
+    0x0b, 0x83, 0x06, 0x02, 0x23, 0x25, 0x27, 0x80, 0x21, 0x0a, 0x25, 0x23,
+    0x28, 0x25, 0x31, 0x66, 0x4a, 0x25, 0x27, 0x25, 0x25, 0x80, 0x27, 0x01,
+    0x25, 0x25, 0x98, 0x21, 0x01, 0x25, 0x25, 0x8f, 0x21, 0x80, 0x27, 0x02,
+    0x25, 0x27, 0x25, 0x80, 0x27, 0x00, 0x25, 0x88, 0x27, 0x80, 0x2a, 0x84,
+    0x27, 0x04, 0x2b, 0x2c, 0x2c, 0x2b, 0x2a, 0x82, 0x27, 0x01, 0x2a, 0x2b,
+    0x84, 0x27, 0x12, 0x2a, 0x2b, 0x24, 0x24, 0x28, 0x30, 0x3d, 0x55, 0x79,
+    0x7f, 0x84, 0x79, 0x84, 0x93, 0x76, 0x31, 0x28, 0x2a, 0x2b, 0x81, 0x27,
+    0x80, 0x21, 0x04, 0x28, 0x2b, 0x31, 0x28, 0x28, 0x80, 0x2a, 0x04, 0x31,
+    0x31, 0x2c, 0x2b, 0x2b, 0x80, 0x31, 0x80, 0x36, 0x04, 0x39, 0x3c, 0x3d,
+    0x41, 0x42, 0x80, 0x48, 0x1d, 0x51, 0x5b, 0x65, 0x78, 0x9b, 0xd6, 0xd7,
+    0xb5, 0xa3, 0xce, 0xd1, 0xb2, 0xe9, 0xc0, 0xb7, 0xd8, 0xd6, 0x78, 0x65,
+    0x56, 0x4f, 0x4c, 0x46, 0x42, 0x3d, 0x39, 0x39, 0x36, 0x34, 0x36, 0x82,
+    0x31, 0x01, 0x28, 0x2a, 0x81, 0x27, 0x83, 0x21, 0x0b, 0x1a, 0x1c, 0x19,
+    0x1a, 0x23, 0x31, 0x47, 0x85, 0x8f, 0x3a, 0x21, 0x19, 0x80, 0x17, 0x01,
+    0x16, 0x16, 0x82, 0x12, 0x81, 0x15, 0x83, 0x12, 0x00, 0x11, 0x80, 0x12,
+    0x18, 0x18, 0x1d, 0x28, 0x1c, 0x11, 0x12, 0x12, 0x15, 0x23, 0x2d, 0x12,
+    0x0c, 0x11, 0x11, 0x12, 0x11, 0x12, 0x11, 0x11, 0x14, 0x25, 0x1b, 0x19,
+    0x16, 0x14, 0x80, 0x0f, 0x81, 0x12, 0x12, 0x1b, 0x52, 0x8e, 0x49, 0x4d,
+    0xbf, 0x59, 0x23, 0x10, 0x11, 0x0e, 0x0c, 0x10, 0x0c, 0x11, 0x0f, 0x0c,
+    0x0b, 0x0f, 0x83, 0x0b, 0x85, 0x06, 0x15, 0x23, 0x27, 0x27, 0x25, 0x23,
+    0x25, 0x25, 0x23, 0x25, 0x28, 0x25, 0x56, 0x54, 0x2b, 0x25, 0x25, 0x28,
+    0x27, 0x25, 0x23, 0x25, 0x25, 0xa8, 0x21, 0x81, 0x25, 0x02, 0x23, 0x25,
+    0x23, 0x83, 0x27, 0x02, 0x23, 0x25, 0x28, 0x85, 0x2a, 0x03, 0x28, 0x28,
+    0x2b, 0x2b, 0x82, 0x27, 0x06, 0x2b, 0x28, 0x2b, 0x2c, 0x2c, 0x2b, 0x2a,
+    0x81, 0x27, 0x01, 0x2a, 0x28, 0x80, 0x2a, 0x04, 0x28, 0x28, 0x2b, 0x2c,
+    0x31, 0x80, 0x27, 0x0c, 0x2a, 0x31, 0x3c, 0x7b, 0x7f, 0x58, 0x58, 0x62,
+    0x76, 0x68, 0x4e, 0x3d, 0x2b, 0x88, 0x27, 0x03, 0x2c, 0x2c, 0x2b, 0x2b,
+    0x80, 0x2c, 0x04, 0x2f, 0x31, 0x2c, 0x2b, 0x2c, 0x81, 0x31, 0x00, 0x36,
+    0x80, 0x37, 0x02, 0x3d, 0x41, 0x42, 0x80, 0x48, 0x18, 0x51, 0x5b, 0x5e,
+    0x6e, 0x83, 0x95, 0x9b, 0xb4, 0xa3, 0xca, 0xce, 0xd4, 0xea, 0xe8, 0xa8,
+    0xd8, 0xd6, 0x83, 0x6a, 0x5b, 0x53, 0x4f, 0x4c, 0x4a, 0x41, 0x80, 0x37,
+    0x80, 0x36, 0x81, 0x31, 0x01, 0x2b, 0x2a, 0x81, 0x27, 0x86, 0x21, 0x0d,
+    0x2b, 0x39, 0x5d, 0x9f, 0x92, 0x4d, 0x28, 0x16, 0x18, 0x15, 0x16, 0x18,
+    0x18, 0x16, 0x80, 0x12, 0x03, 0x15, 0x15, 0x14, 0x15, 0x80, 0x17, 0x80,
+    0x15, 0x82, 0x12, 0x03, 0x1a, 0x24, 0x24, 0x1c, 0x80, 0x12, 0x04, 0x11,
+    0x12, 0x14, 0x1b, 0x1b, 0x82, 0x0f, 0x09, 0x12, 0x12, 0x0f, 0x14, 0x1b,
+    0x15, 0x14, 0x15, 0x1a, 0x1a, 0x81, 0x0f, 0x80, 0x12, 0x08, 0x2b, 0x87,
+    0x4b, 0x27, 0x5d, 0xa3, 0x52, 0x16, 0x15, 0x80, 0x0f, 0x01, 0x0c, 0x10,
+    0x80, 0x0b, 0x00, 0x0f, 0x85, 0x0b, 0x01, 0x0a, 0x0b, 0x80, 0x06, 0x10,
+    0x0b, 0x23, 0x28, 0x28, 0x25, 0x23, 0x27, 0x25, 0x22, 0x28, 0x28, 0x31,
+    0x4f, 0x39, 0x2a, 0x28, 0x23, 0x80, 0x25, 0x03, 0x23, 0x23, 0x25, 0x25,
+    0x8b, 0x21, 0x00, 0x25, 0x83, 0x21, 0x00, 0x25, 0x8f, 0x21, 0x01, 0x25,
+    0x23, 0x81, 0x27, 0x13, 0x25, 0x23, 0x23, 0x27, 0x2a, 0x2b, 0x28, 0x25,
+    0x27, 0x25, 0x25, 0x28, 0x2b, 0x28, 0x2b, 0x2c, 0x2c, 0x2b, 0x2c, 0x2b,
+    0x80, 0x27, 0x04, 0x2b, 0x28, 0x2a, 0x28, 0x28, 0x81, 0x2a, 0x04, 0x2c,
+    0x2b, 0x2b, 0x28, 0x2a, 0x81, 0x27, 0x1b, 0x2b, 0x2b, 0x2c, 0x2b, 0x28,
+    0x28, 0x2b, 0x31, 0x30, 0x28, 0x2a, 0x2c, 0x31, 0x3c, 0x7a, 0x8e, 0x4d,
+    0x41, 0x37, 0x3c, 0x41, 0x36, 0x31, 0x28, 0x22, 0x25, 0x23, 0x23, 0x85,
+    0x27, 0x02, 0x2b, 0x2b, 0x2c, 0x81, 0x2a, 0x03, 0x2c, 0x31, 0x31, 0x2f,
+    0x82, 0x31, 0x00, 0x36, 0x81, 0x37, 0x24, 0x41, 0x42, 0x46, 0x48, 0x4c,
+    0x51, 0x56, 0x5e, 0x6a, 0x78, 0x83, 0xd9, 0xa6, 0xbc, 0xcc, 0xcf, 0xb2,
+    0xd4, 0xcc, 0xb9, 0xd8, 0x95, 0x83, 0x78, 0x65, 0x5b, 0x51, 0x4c, 0x4c,
+    0x42, 0x41, 0x3c, 0x39, 0x36, 0x39, 0x37, 0x36, 0x80, 0x31, 0x01, 0x2b,
+    0x2b, 0x81, 0x27, 0x84, 0x21, 0x0d, 0x2a, 0x31, 0x41, 0x69, 0xa4, 0x62,
+    0x36, 0x31, 0x19, 0x19, 0x18, 0x15, 0x16, 0x18, 0x81, 0x15, 0x04, 0x14,
+    0x14, 0x18, 0x19, 0x19, 0x81, 0x17, 0x80, 0x19, 0x00, 0x18, 0x80, 0x15,
+    0x06, 0x1e, 0x1a, 0x15, 0x11, 0x11, 0x14, 0x12, 0x80, 0x0f, 0x06, 0x14,
+    0x22, 0x22, 0x14, 0x11, 0x10, 0x12, 0x80, 0x0f, 0x1b, 0x12, 0x18, 0x19,
+    0x12, 0x12, 0x11, 0x2d, 0x1a, 0x12, 0x12, 0x11, 0x12, 0x15, 0x12, 0x36,
+    0x8a, 0x3a, 0x1a, 0x28, 0x7c, 0xa3, 0x41, 0x1a, 0x14, 0x10, 0x0f, 0x0c,
+    0x0f, 0x80, 0x0b, 0x04, 0x0f, 0x0b, 0x0b, 0x0a, 0x0a, 0x81, 0x0b, 0x01,
+    0x0a, 0x0b, 0x80, 0x06, 0x14, 0x0b, 0x25, 0x28, 0x2a, 0x27, 0x25, 0x28,
+    0x25, 0x23, 0x28, 0x27, 0x39, 0x3c, 0x23, 0x27, 0x28, 0x23, 0x27, 0x25,
+    0x23, 0x23, 0x80, 0x25, 0x02, 0x23, 0x25, 0x25, 0x87, 0x21, 0x00, 0x25,
+    0x99, 0x21, 0x82, 0x27, 0x09, 0x23, 0x27, 0x28, 0x2a, 0x28, 0x28, 0x25,
+    0x28, 0x25, 0x23, 0x80, 0x27, 0x81, 0x2a, 0x04, 0x2c, 0x2b, 0x28, 0x2b,
+    0x2a, 0x85, 0x27, 0x81, 0x2a, 0x01, 0x28, 0x2b, 0x81, 0x27, 0x81, 0x2a,
+    0x14, 0x28, 0x28, 0x2c, 0x2f, 0x2b, 0x2c, 0x31, 0x39, 0x4d, 0x71, 0x82,
+    0x4d, 0x31, 0x31, 0x28, 0x34, 0x28, 0x2a, 0x28, 0x2b, 0x2b, 0x80, 0x21,
+    0x03, 0x27, 0x27, 0x23, 0x25, 0x83, 0x27, 0x82, 0x2a, 0x85, 0x31, 0x80,
+    0x36, 0x22, 0x39, 0x39, 0x3d, 0x41, 0x42, 0x42, 0x48, 0x4c, 0x51, 0x56,
+    0x5b, 0x65, 0x78, 0x83, 0xd8, 0x92, 0xc6, 0xc6, 0xd3, 0xd5, 0xeb, 0xbf,
+    0xb7, 0xd9, 0xb3, 0x9b, 0x83, 0x6a, 0x5e, 0x53, 0x4c, 0x4c, 0x42, 0x41,
+    0x40, 0x81, 0x37, 0x80, 0x31, 0x02, 0x2b, 0x2c, 0x2c, 0x80, 0x2a, 0x00,
+    0x28, 0x81, 0x25, 0x10, 0x28, 0x28, 0x31, 0x45, 0x7f, 0x92, 0x9e, 0x52,
+    0x31, 0x28, 0x22, 0x18, 0x17, 0x15, 0x16, 0x18, 0x18, 0x80, 0x15, 0x05,
+    0x14, 0x14, 0x1a, 0x24, 0x24, 0x1c, 0x82, 0x17, 0x00, 0x19, 0x82, 0x17,
+    0x0f, 0x14, 0x12, 0x11, 0x11, 0x12, 0x12, 0x11, 0x12, 0x0c, 0x10, 0x12,
+    0x16, 0x24, 0x24, 0x15, 0x12, 0x82, 0x0f, 0x01, 0x1a, 0x1a, 0x80, 0x0f,
+    0x15, 0x16, 0x24, 0x1c, 0x11, 0x12, 0x11, 0x11, 0x13, 0x3d, 0x9f, 0x3b,
+    0x15, 0x1a, 0x45, 0x8a, 0xa0, 0x4b, 0x25, 0x1a, 0x14, 0x10, 0x0f, 0x82,
+    0x0b, 0x01, 0x0a, 0x0a, 0x81, 0x0b, 0x84, 0x06, 0x10, 0x25, 0x28, 0x2b,
+    0x28, 0x23, 0x28, 0x27, 0x2b, 0x25, 0x25, 0x34, 0x31, 0x25, 0x23, 0x25,
+    0x28, 0x2f, 0x80, 0x27, 0x81, 0x21, 0x00, 0x28, 0x82, 0x21, 0x00, 0x1d,
+    0x9f, 0x21, 0x00, 0x25, 0x82, 0x27, 0x00, 0x2a, 0x80, 0x27, 0x04, 0x25,
+    0x27, 0x28, 0x23, 0x25, 0x86, 0x27, 0x80, 0x2a, 0x86, 0x27, 0x03, 0x2b,
+    0x2b, 0x28, 0x28, 0x83, 0x2a, 0x01, 0x2c, 0x2b, 0x80, 0x27, 0x09, 0x2b,
+    0x31, 0x38, 0x2b, 0x42, 0x82, 0x85, 0x52, 0x3d, 0x31, 0x83, 0x27, 0x00,
+    0x25, 0x80, 0x27, 0x05, 0x23, 0x25, 0x28, 0x28, 0x25, 0x23, 0x81, 0x27,
+    0x81, 0x2a, 0x01, 0x2c, 0x2c, 0x86, 0x31, 0x02, 0x37, 0x36, 0x34, 0x80,
+    0x37, 0x1a, 0x3d, 0x41, 0x42, 0x48, 0x4c, 0x51, 0x56, 0x5b, 0x65, 0x78,
+    0x83, 0x7f, 0xc3, 0x87, 0xbe, 0xd2, 0xd5, 0xd2, 0xac, 0xb6, 0xb4, 0xd7,
+    0xd6, 0x83, 0x6c, 0x5e, 0x53, 0x80, 0x48, 0x01, 0x41, 0x41, 0x80, 0x37,
+    0x00, 0x36, 0x80, 0x31, 0x82, 0x2a, 0x83, 0x27, 0x0b, 0x2b, 0x34, 0x5d,
+    0xa3, 0x5d, 0x4d, 0x36, 0x31, 0x22, 0x1a, 0x1c, 0x19, 0x82, 0x17, 0x81,
+    0x15, 0x03, 0x1a, 0x28, 0x25, 0x18, 0x8a, 0x12, 0x03, 0x11, 0x11, 0x14,
+    0x14, 0x81, 0x0f, 0x0d, 0x12, 0x11, 0x11, 0x14, 0x25, 0x2d, 0x15, 0x0f,
+    0x11, 0x14, 0x11, 0x11, 0x1a, 0x12, 0x80, 0x0f, 0x15, 0x12, 0x14, 0x22,
+    0x16, 0x12, 0x11, 0x0e, 0x12, 0x23, 0x89, 0x59, 0x18, 0x14, 0x1a, 0x3c,
+    0x57, 0xa3, 0x7c, 0x3a, 0x18, 0x14, 0x11, 0x81, 0x0b, 0x01, 0x0a, 0x0a,
+    0x82, 0x0b, 0x80, 0x06, 0x03, 0x05, 0x07, 0x05, 0x07, 0x81, 0x27, 0x08,
+    0x25, 0x23, 0x23, 0x28, 0x23, 0x28, 0x3c, 0x35, 0x25, 0x80, 0x21, 0x82,
+    0x27, 0x03, 0x23, 0x23, 0x25, 0x28, 0xa8, 0x21, 0x80, 0x25, 0x01, 0x2b,
+    0x2b, 0x90, 0x27, 0x00, 0x2b, 0x81, 0x27, 0x03, 0x25, 0x28, 0x2a, 0x2b,
+    0x84, 0x27, 0x10, 0x30, 0x31, 0x31, 0x2b, 0x31, 0x31, 0x2a, 0x31, 0x2c,
+    0x31, 0x3c, 0x55, 0xa8, 0x7f, 0x46, 0x35, 0x2b, 0x84, 0x27, 0x07, 0x25,
+    0x27, 0x23, 0x25, 0x23, 0x23, 0x27, 0x27, 0x80, 0x25, 0x81, 0x27, 0x02,
+    0x2b, 0x28, 0x28, 0x81, 0x2a, 0x84, 0x31, 0x02, 0x37, 0x37, 0x36, 0x81,
+    0x37, 0x1f, 0x41, 0x42, 0x4a, 0x4c, 0x4f, 0x51, 0x54, 0x5b, 0x6a, 0x80,
+    0xbf, 0x9e, 0xdc, 0xa4, 0xcf, 0xea, 0xeb, 0xbf, 0xb9, 0xa6, 0xd7, 0x9b,
+    0x83, 0x74, 0x6a, 0x5e, 0x53, 0x51, 0x4c, 0x42, 0x41, 0x41, 0x80, 0x37,
+    0x05, 0x36, 0x34, 0x31, 0x2b, 0x2a, 0x31, 0x82, 0x27, 0x0d, 0x24, 0x28,
+    0x2a, 0x31, 0x64, 0xa4, 0x60, 0x37, 0x28, 0x28, 0x23, 0x1d, 0x1a, 0x19,
+    0x80, 0x17, 0x01, 0x19, 0x18, 0x80, 0x15, 0x04, 0x1b, 0x28, 0x24, 0x1c,
+    0x15, 0x8c, 0x12, 0x00, 0x11, 0x80, 0x12, 0x01, 0x11, 0x11, 0x80, 0x12,
+    0x27, 0x11, 0x10, 0x18, 0x31, 0x14, 0x11, 0x14, 0x16, 0x19, 0x18, 0x16,
+    0x11, 0x12, 0x11, 0x14, 0x11, 0x11, 0x22, 0x1d, 0x12, 0x11, 0x11, 0x12,
+    0x18, 0x60, 0x87, 0x19, 0x11, 0x12, 0x19, 0x28, 0x4d, 0x93, 0xbe, 0x59,
+    0x22, 0x14, 0x0f, 0x11, 0x0d, 0x80, 0x06, 0x03, 0x0b, 0x0a, 0x0b, 0x0b,
+    0x80, 0x06, 0x01, 0x05, 0x05, 0x80, 0x06, 0x00, 0x23, 0x80, 0x25, 0x80,
+    0x21, 0x07, 0x27, 0x25, 0x39, 0x43, 0x28, 0x25, 0x28, 0x25, 0x80, 0x27,
+    0x80, 0x25, 0x80, 0x21, 0x01, 0x27, 0x25, 0xa8, 0x21, 0x00, 0x25, 0x80,
+    0x27, 0x00, 0x2a, 0x89, 0x27, 0x00, 0x2a, 0x82, 0x27, 0x01, 0x2b, 0x2b,
+    0x80, 0x27, 0x01, 0x25, 0x28, 0x80, 0x2a, 0x80, 0x27, 0x12, 0x2b, 0x2b,
+    0x28, 0x31, 0x2c, 0x31, 0x3d, 0x52, 0x60, 0x4d, 0x46, 0x4e, 0x55, 0x7a,
+    0x87, 0x55, 0x39, 0x2a, 0x25, 0x80, 0x27, 0x81, 0x25, 0x80, 0x27, 0x08,
+    0x25, 0x25, 0x23, 0x25, 0x27, 0x27, 0x23, 0x25, 0x25, 0x80, 0x27, 0x81,
+    0x2a, 0x02, 0x31, 0x2c, 0x2c, 0x85, 0x31, 0x84, 0x37, 0x1f, 0x41, 0x42,
+    0x42, 0x4c, 0x51, 0x4f, 0x56, 0x6a, 0x78, 0x79, 0xe6, 0x8d, 0xa6, 0xba,
+    0xcc, 0xb1, 0xb2, 0xcf, 0xa4, 0xb7, 0xb5, 0xd8, 0xd7, 0x9b, 0x83, 0x5b,
+    0x54, 0x4f, 0x4c, 0x42, 0x41, 0x41, 0x80, 0x37, 0x16, 0x36, 0x37, 0x36,
+    0x31, 0x31, 0x2c, 0x31, 0x31, 0x28, 0x28, 0x2b, 0x28, 0x28, 0x34, 0x4d,
+    0xac, 0x5d, 0x38, 0x28, 0x22, 0x21, 0x19, 0x1b, 0x81, 0x17, 0x09, 0x1c,
+    0x19, 0x15, 0x18, 0x19, 0x1a, 0x2a, 0x25, 0x1a, 0x15, 0x97, 0x12, 0x27,
+    0x11, 0x19, 0x25, 0x11, 0x10, 0x12, 0x15, 0x1a, 0x1c, 0x14, 0x11, 0x11,
+    0x12, 0x12, 0x11, 0x0f, 0x15, 0x19, 0x12, 0x10, 0x10, 0x12, 0x18, 0x52,
+    0x87, 0x1c, 0x10, 0x0c, 0x12, 0x11, 0x18, 0x36, 0x57, 0xac, 0x57, 0x1a,
+    0x12, 0x0f, 0x0c, 0x0c, 0x80, 0x06, 0x02, 0x05, 0x0a, 0x0b, 0x80, 0x06,
+    0x00, 0x05, 0x81, 0x06, 0x83, 0x21, 0x06, 0x25, 0x23, 0x28, 0x42, 0x41,
+    0x23, 0x25, 0x80, 0x27, 0x01, 0x25, 0x25, 0x83, 0x21, 0x00, 0x25, 0x99,
+    0x21, 0x00, 0x25, 0x88, 0x21, 0x0c, 0x28, 0x25, 0x22, 0x23, 0x27, 0x2b,
+    0x23, 0x27, 0x2b, 0x2a, 0x27, 0x23, 0x25, 0x80, 0x27, 0x01, 0x25, 0x25,
+    0x81, 0x27, 0x00, 0x2a, 0x81, 0x27, 0x03, 0x2b, 0x2b, 0x2c, 0x2b, 0x80,
+    0x27, 0x17, 0x2a, 0x2b, 0x2c, 0x2a, 0x28, 0x28, 0x2a, 0x28, 0x28, 0x31,
+    0x31, 0x48, 0x84, 0x92, 0x84, 0x91, 0xb6, 0x8c, 0xa7, 0x69, 0x49, 0x37,
+    0x2c, 0x2a, 0x80, 0x27, 0x80, 0x25, 0x00, 0x23, 0x80, 0x27, 0x03, 0x25,
+    0x25, 0x27, 0x25, 0x80, 0x27, 0x0c, 0x25, 0x23, 0x23, 0x28, 0x2a, 0x28,
+    0x2b, 0x31, 0x2b, 0x2b, 0x31, 0x31, 0x2f, 0x81, 0x31, 0x03, 0x2c, 0x31,
+    0x31, 0x36, 0x84, 0x37, 0x25, 0x41, 0x42, 0x42, 0x48, 0x4f, 0x4f, 0x5b,
+    0x65, 0x6c, 0x8e, 0xbf, 0xb4, 0xb4, 0x99, 0xe7, 0xce, 0xe9, 0xe9, 0xce,
+    0xbe, 0x97, 0x8b, 0xd8, 0xd6, 0x83, 0x65, 0x5e, 0x51, 0x4c, 0x42, 0x42,
+    0x41, 0x3d, 0x39, 0x39, 0x34, 0x36, 0x36, 0x83, 0x31, 0x09, 0x2c, 0x34,
+    0x37, 0x41, 0x60, 0x93, 0x9e, 0x41, 0x2a, 0x23, 0x80, 0x1b, 0x82, 0x17,
+    0x08, 0x19, 0x18, 0x18, 0x19, 0x1f, 0x28, 0x22, 0x1a, 0x16, 0x8a, 0x12,
+    0x00, 0x11, 0x8b, 0x12, 0x2a, 0x22, 0x18, 0x0f, 0x0f, 0x12, 0x15, 0x19,
+    0x16, 0x12, 0x11, 0x11, 0x12, 0x0f, 0x0f, 0x0c, 0x12, 0x1a, 0x12, 0x10,
+    0x0f, 0x12, 0x14, 0x45, 0x8e, 0x34, 0x14, 0x0c, 0x12, 0x11, 0x12, 0x15,
+    0x22, 0x5d, 0xbf, 0x57, 0x1f, 0x10, 0x10, 0x0c, 0x0a, 0x0b, 0x07, 0x05,
+    0x81, 0x06, 0x0b, 0x0b, 0x0a, 0x05, 0x0a, 0x0a, 0x0b, 0x24, 0x23, 0x25,
+    0x25, 0x23, 0x25, 0x80, 0x27, 0x03, 0x36, 0x3c, 0x31, 0x23, 0x80, 0x25,
+    0x04, 0x23, 0x23, 0x25, 0x23, 0x25, 0xa9, 0x21, 0x06, 0x28, 0x25, 0x22,
+    0x23, 0x27, 0x2b, 0x23, 0x81, 0x27, 0x06, 0x23, 0x25, 0x25, 0x28, 0x28,
+    0x25, 0x23, 0x81, 0x27, 0x01, 0x2b, 0x2b, 0x80, 0x27, 0x04, 0x2b, 0x2b,
+    0x2c, 0x2b, 0x2a, 0x80, 0x27, 0x00, 0x2a, 0x84, 0x27, 0x0b, 0x2b, 0x2b,
+    0x68, 0x9e, 0x4e, 0x43, 0x42, 0x46, 0x3d, 0x42, 0x39, 0x39, 0x80, 0x2a,
+    0x0c, 0x28, 0x27, 0x25, 0x25, 0x23, 0x25, 0x23, 0x28, 0x25, 0x25, 0x23,
+    0x23, 0x25, 0x81, 0x27, 0x02, 0x25, 0x23, 0x25, 0x80, 0x27, 0x01, 0x2b,
+    0x31, 0x83, 0x2a, 0x83, 0x31, 0x00, 0x36, 0x84, 0x37, 0x26, 0x41, 0x41,
+    0x42, 0x4a, 0x50, 0x5e, 0x67, 0x84, 0x93, 0xbe, 0x8b, 0xd9, 0xb5, 0xa6,
+    0xe4, 0xad, 0xce, 0xd4, 0xe9, 0xd1, 0xc5, 0x9f, 0x98, 0xd9, 0xd7, 0x83,
+    0x6c, 0x56, 0x4f, 0x4c, 0x42, 0x42, 0x41, 0x3c, 0x39, 0x34, 0x36, 0x37,
+    0x36, 0x82, 0x31, 0x0d, 0x41, 0x55, 0x77, 0x8a, 0x97, 0x5c, 0x4e, 0x31,
+    0x28, 0x1e, 0x1d, 0x21, 0x1d, 0x19, 0x80, 0x17, 0x08, 0x19, 0x16, 0x18,
+    0x1d, 0x24, 0x22, 0x1b, 0x18, 0x16, 0x8a, 0x12, 0x01, 0x11, 0x11, 0x8a,
+    0x12, 0x09, 0x1a, 0x24, 0x14, 0x0f, 0x10, 0x12, 0x16, 0x17, 0x14, 0x12,
+    0x80, 0x0f, 0x1c, 0x0c, 0x10, 0x0f, 0x19, 0x24, 0x12, 0x10, 0x0c, 0x12,
+    0x12, 0x2b, 0x7b, 0x92, 0x32, 0x18, 0x11, 0x0b, 0x0c, 0x0f, 0x11, 0x25,
+    0x60, 0xbf, 0x45, 0x16, 0x12, 0x0f, 0x0e, 0x0b, 0x87, 0x06, 0x03, 0x0b,
+    0x0a, 0x25, 0x25, 0x83, 0x27, 0x05, 0x25, 0x27, 0x34, 0x3c, 0x28, 0x28,
+    0x80, 0x21, 0x80, 0x25, 0x83, 0x21, 0x01, 0x25, 0x25, 0xa2, 0x21, 0x08,
+    0x28, 0x25, 0x23, 0x23, 0x27, 0x27, 0x22, 0x23, 0x25, 0x84, 0x27, 0x00,
+    0x25, 0x83, 0x27, 0x00, 0x2a, 0x80, 0x27, 0x04, 0x2b, 0x2b, 0x28, 0x2b,
+    0x2c, 0x80, 0x2a, 0x84, 0x27, 0x07, 0x23, 0x28, 0x34, 0x47, 0xa9, 0x52,
+    0x37, 0x3c, 0x81, 0x31, 0x02, 0x2b, 0x28, 0x25, 0x85, 0x21, 0x00, 0x25,
+    0x82, 0x21, 0x82, 0x27, 0x01, 0x23, 0x25, 0x80, 0x27, 0x86, 0x2a, 0x82,
+    0x31, 0x85, 0x37, 0x35, 0x41, 0x42, 0x42, 0x4c, 0x56, 0x55, 0xa3, 0xc5,
+    0x94, 0x79, 0x78, 0xb3, 0x80, 0x7d, 0x9a, 0xb7, 0x9e, 0xc5, 0xd2, 0xea,
+    0xb2, 0xce, 0xac, 0xb7, 0xd9, 0x95, 0x74, 0x65, 0x56, 0x4f, 0x48, 0x42,
+    0x41, 0x3d, 0x39, 0x34, 0x36, 0x36, 0x35, 0x31, 0x35, 0x31, 0x35, 0x3c,
+    0x6f, 0xbf, 0x8e, 0x52, 0x41, 0x31, 0x31, 0x2b, 0x24, 0x22, 0x81, 0x17,
+    0x00, 0x19, 0x80, 0x17, 0x07, 0x16, 0x18, 0x23, 0x2d, 0x19, 0x14, 0x14,
+    0x15, 0x87, 0x12, 0x04, 0x15, 0x15, 0x14, 0x12, 0x11, 0x86, 0x12, 0x80,
+    0x0f, 0x05, 0x12, 0x22, 0x1d, 0x12, 0x0f, 0x11, 0x80, 0x12, 0x80, 0x0f,
+    0x1e, 0x0c, 0x0f, 0x0c, 0x0f, 0x0f, 0x1e, 0x23, 0x10, 0x0f, 0x0c, 0x11,
+    0x11, 0x15, 0x2c, 0x85, 0xa0, 0x4b, 0x1d, 0x11, 0x0f, 0x0d, 0x11, 0x12,
+    0x28, 0x7c, 0x7c, 0x23, 0x15, 0x0f, 0x0f, 0x0b, 0x89, 0x06, 0x81, 0x27,
+    0x0b, 0x2b, 0x28, 0x25, 0x23, 0x27, 0x28, 0x2b, 0x35, 0x31, 0x28, 0x27,
+    0x25, 0x80, 0x27, 0x82, 0x25, 0x80, 0x21, 0x00, 0x25, 0x9b, 0x21, 0x00,
+    0x25, 0x86, 0x21, 0x01, 0x25, 0x25, 0x82, 0x21, 0x87, 0x27, 0x01, 0x25,
+    0x25, 0x85, 0x27, 0x80, 0x2a, 0x01, 0x2c, 0x2c, 0x81, 0x27, 0x80, 0x2a,
+    0x0c, 0x23, 0x27, 0x2a, 0x39, 0x55, 0x99, 0x36, 0x31, 0x2c, 0x2c, 0x2a,
+    0x2a, 0x28, 0x80, 0x2a, 0x02, 0x28, 0x25, 0x25, 0x81, 0x21, 0x00, 0x25,
+    0x82, 0x21, 0x00, 0x25, 0x82, 0x27, 0x04, 0x23, 0x27, 0x25, 0x25, 0x28,
+    0x80, 0x2a, 0x00, 0x2c, 0x81, 0x2a, 0x81, 0x31, 0x00, 0x36, 0x85, 0x37,
+    0x24, 0x41, 0x42, 0x4a, 0x4c, 0x56, 0x71, 0xa3, 0x75, 0x67, 0x6a, 0x83,
+    0x83, 0x80, 0xb7, 0x8b, 0xb4, 0xdc, 0xa8, 0xbf, 0xce, 0xe9, 0xd4, 0xd1,
+    0xbf, 0x99, 0xd9, 0xd7, 0x74, 0x5e, 0x51, 0x4c, 0x42, 0x42, 0x41, 0x39,
+    0x34, 0x36, 0x81, 0x31, 0x07, 0x2e, 0x3d, 0x5d, 0xa4, 0x62, 0x42, 0x2b,
+    0x2a, 0x80, 0x27, 0x00, 0x25, 0x80, 0x1b, 0x80, 0x17, 0x07, 0x19, 0x19,
+    0x18, 0x18, 0x1b, 0x28, 0x23, 0x19, 0x83, 0x15, 0x02, 0x14, 0x14, 0x15,
+    0x80, 0x12, 0x80, 0x15, 0x02, 0x14, 0x12, 0x11, 0x83, 0x12, 0x02, 0x11,
+    0x12, 0x12, 0x80, 0x0f, 0x07, 0x12, 0x24, 0x16, 0x12, 0x0f, 0x0f, 0x12,
+    0x14, 0x81, 0x0f, 0x09, 0x0c, 0x0f, 0x0f, 0x0c, 0x11, 0x22, 0x22, 0x0f,
+    0x0d, 0x0b, 0x80, 0x0f, 0x14, 0x15, 0x4d, 0x8c, 0x89, 0x5d, 0x15, 0x10,
+    0x0f, 0x0c, 0x10, 0x16, 0x4b, 0xbf, 0x7c, 0x57, 0x32, 0x18, 0x11, 0x0c,
+    0x0a, 0x0b, 0x86, 0x06, 0x00, 0x23, 0x82, 0x27, 0x80, 0x21, 0x04, 0x25,
+    0x28, 0x2b, 0x37, 0x31, 0x80, 0x27, 0x00, 0x2a, 0x80, 0x27, 0x02, 0x25,
+    0x23, 0x25, 0x89, 0x21, 0x00, 0x1d, 0x9a, 0x21, 0x00, 0x25, 0x82, 0x21,
+    0x80, 0x25, 0x91, 0x27, 0x01, 0x2b, 0x2c, 0x80, 0x2a, 0x02, 0x28, 0x28,
+    0x2c, 0x81, 0x27, 0x13, 0x24, 0x2a, 0x31, 0x37, 0x55, 0x9e, 0x4c, 0x28,
+    0x31, 0x2c, 0x31, 0x2b, 0x2b, 0x2c, 0x2b, 0x28, 0x23, 0x28, 0x25, 0x25,
+    0x80, 0x27, 0x81, 0x21, 0x03, 0x25, 0x25, 0x23, 0x25, 0x81, 0x27, 0x81,
+    0x21, 0x01, 0x25, 0x28, 0x82, 0x2a, 0x83, 0x31, 0x80, 0x37, 0x01, 0x36,
+    0x36, 0x81, 0x37, 0x31, 0x41, 0x41, 0x4c, 0x61, 0x77, 0xbf, 0x7a, 0x65,
+    0x65, 0x5e, 0x74, 0x80, 0x8b, 0xb4, 0x95, 0xd7, 0xd9, 0xa6, 0xb6, 0xaa,
+    0xca, 0xd3, 0xb2, 0xd2, 0xc3, 0xa7, 0xd7, 0x83, 0x6a, 0x56, 0x4c, 0x48,
+    0x42, 0x3c, 0x40, 0x34, 0x39, 0x35, 0x31, 0x31, 0x41, 0x3d, 0x69, 0xac,
+    0x68, 0x3d, 0x31, 0x2b, 0x28, 0x25, 0x82, 0x21, 0x0a, 0x1d, 0x1b, 0x1a,
+    0x1a, 0x19, 0x19, 0x1a, 0x1d, 0x25, 0x1f, 0x18, 0x83, 0x15, 0x07, 0x14,
+    0x14, 0x15, 0x15, 0x14, 0x14, 0x15, 0x15, 0x80, 0x12, 0x01, 0x11, 0x11,
+    0x84, 0x12, 0x81, 0x0f, 0x0a, 0x12, 0x12, 0x24, 0x16, 0x12, 0x12, 0x10,
+    0x11, 0x12, 0x11, 0x0f, 0x80, 0x0b, 0x81, 0x0f, 0x1c, 0x1e, 0x25, 0x11,
+    0x0c, 0x0f, 0x0f, 0x0b, 0x0f, 0x12, 0x23, 0x67, 0x70, 0x9f, 0x32, 0x14,
+    0x14, 0x0b, 0x0c, 0x10, 0x1b, 0x52, 0x7c, 0xac, 0xac, 0x4b, 0x1b, 0x14,
+    0x10, 0x0f, 0x80, 0x0b, 0x02, 0x0a, 0x0a, 0x0b, 0x80, 0x06, 0x01, 0x23,
+    0x25, 0x80, 0x27, 0x00, 0x25, 0x80, 0x21, 0x05, 0x25, 0x27, 0x28, 0x2c,
+    0x31, 0x2b, 0x81, 0x27, 0x02, 0x25, 0x27, 0x25, 0x8e, 0x21, 0x80, 0x1b,
+    0x02, 0x21, 0x21, 0x1d, 0x94, 0x21, 0x09, 0x25, 0x25, 0x23, 0x23, 0x25,
+    0x27, 0x25, 0x25, 0x28, 0x25, 0x80, 0x27, 0x00, 0x25, 0x80, 0x27, 0x00,
+    0x25, 0x86, 0x27, 0x03, 0x2b, 0x2c, 0x2b, 0x2b, 0x80, 0x27, 0x00, 0x2b,
+    0x80, 0x27, 0x80, 0x2a, 0x08, 0x31, 0x3c, 0x62, 0x7f, 0x3c, 0x31, 0x2b,
+    0x30, 0x2c, 0x81, 0x27, 0x04, 0x23, 0x23, 0x27, 0x25, 0x25, 0x80, 0x27,
+    0x01, 0x25, 0x25, 0x80, 0x21, 0x03, 0x25, 0x23, 0x23, 0x25, 0x80, 0x27,
+    0x04, 0x25, 0x23, 0x23, 0x27, 0x28, 0x80, 0x2a, 0x02, 0x2c, 0x2b, 0x2b,
+    0x85, 0x31, 0x81, 0x36, 0x23, 0x39, 0x39, 0x3d, 0x42, 0x4a, 0x79, 0x9f,
+    0x7f, 0x68, 0x51, 0x5b, 0x65, 0x7d, 0x9d, 0x9c, 0x80, 0x78, 0x9b, 0xd6,
+    0xd7, 0xd8, 0xb5, 0xa7, 0x9e, 0xca, 0xd3, 0xea, 0xcf, 0xa9, 0xd9, 0x83,
+    0x78, 0x65, 0x53, 0x4c, 0x42, 0x80, 0x37, 0x0b, 0x35, 0x38, 0x3d, 0x46,
+    0x60, 0x8e, 0x91, 0x55, 0x34, 0x31, 0x28, 0x28, 0x82, 0x21, 0x81, 0x1b,
+    0x80, 0x17, 0x05, 0x1b, 0x23, 0x28, 0x22, 0x1a, 0x18, 0x81, 0x15, 0x01,
+    0x18, 0x15, 0x91, 0x12, 0x82, 0x0f, 0x02, 0x12, 0x1a, 0x1a, 0x81, 0x0f,
+    0x00, 0x12, 0x81, 0x0f, 0x01, 0x0c, 0x0c, 0x80, 0x0f, 0x02, 0x16, 0x24,
+    0x1a, 0x80, 0x0f, 0x19, 0x0c, 0x0f, 0x10, 0x12, 0x1d, 0x3d, 0x89, 0x8e,
+    0x4b, 0x28, 0x12, 0x11, 0x0d, 0x12, 0x15, 0x34, 0x49, 0x57, 0x8a, 0x85,
+    0x4b, 0x29, 0x1a, 0x14, 0x0b, 0x0b, 0x81, 0x06, 0x03, 0x0b, 0x0a, 0x23,
+    0x23, 0x80, 0x25, 0x82, 0x21, 0x80, 0x27, 0x07, 0x2c, 0x2b, 0x28, 0x27,
+    0x25, 0x27, 0x23, 0x25, 0x90, 0x21, 0x84, 0x1b, 0x92, 0x21, 0x00, 0x25,
+    0x80, 0x21, 0x02, 0x25, 0x28, 0x25, 0x97, 0x27, 0x01, 0x2a, 0x2b, 0x80,
+    0x27, 0x0d, 0x25, 0x28, 0x2a, 0x25, 0x2c, 0x4d, 0x91, 0x39, 0x31, 0x2b,
+    0x2c, 0x2a, 0x25, 0x25, 0x81, 0x21, 0x02, 0x27, 0x25, 0x25, 0x81, 0x27,
+    0x00, 0x25, 0x84, 0x21, 0x81, 0x25, 0x81, 0x27, 0x83, 0x2a, 0x80, 0x31,
+    0x00, 0x2b, 0x85, 0x31, 0x10, 0x39, 0x3d, 0x42, 0x4f, 0x4f, 0x8a, 0x72,
+    0x5e, 0x4f, 0x4f, 0x53, 0x67, 0xb5, 0x6a, 0x74, 0x65, 0x78, 0x80, 0x9b,
+    0x0f, 0xd7, 0xd8, 0xda, 0xb8, 0xc2, 0xeb, 0xb2, 0xce, 0x9f, 0xa6, 0xd7,
+    0x78, 0x65, 0x54, 0x4f, 0x4c, 0x80, 0x42, 0x09, 0x3d, 0x4e, 0x5d, 0x8e,
+    0x8a, 0x62, 0x3d, 0x31, 0x30, 0x28, 0x83, 0x21, 0x81, 0x1b, 0x00, 0x1a,
+    0x81, 0x1b, 0x03, 0x28, 0x28, 0x1b, 0x18, 0x84, 0x15, 0x90, 0x12, 0x01,
+    0x11, 0x12, 0x82, 0x0f, 0x06, 0x12, 0x1c, 0x16, 0x0f, 0x0f, 0x12, 0x12,
+    0x82, 0x0f, 0x07, 0x0b, 0x0c, 0x0f, 0x0e, 0x11, 0x14, 0x1a, 0x1a, 0x80,
+    0x0f, 0x0a, 0x0c, 0x10, 0x12, 0x0b, 0x14, 0x55, 0x8c, 0x87, 0x87, 0x45,
+    0x18, 0x80, 0x0f, 0x10, 0x18, 0x31, 0x1b, 0x3a, 0x59, 0xa2, 0xa3, 0x87,
+    0x59, 0x3b, 0x1b, 0x14, 0x11, 0x0f, 0x0b, 0x0b, 0x0a, 0x87, 0x21, 0x0a,
+    0x25, 0x28, 0x23, 0x2b, 0x31, 0x2b, 0x28, 0x28, 0x23, 0x25, 0x23, 0x80,
+    0x25, 0x8d, 0x21, 0x84, 0x1b, 0x90, 0x21, 0x80, 0x25, 0x80, 0x21, 0x03,
+    0x25, 0x28, 0x25, 0x25, 0x85, 0x27, 0x00, 0x25, 0x86, 0x27, 0x01, 0x25,
+    0x25, 0x82, 0x27, 0x01, 0x2b, 0x2b, 0x80, 0x27, 0x01, 0x2c, 0x2a, 0x80,
+    0x37, 0x06, 0x4d, 0x89, 0x42, 0x28, 0x2a, 0x28, 0x28, 0x83, 0x21, 0x07,
+    0x25, 0x23, 0x23, 0x28, 0x28, 0x25, 0x28, 0x28, 0x85, 0x21, 0x02, 0x25,
+    0x23, 0x23, 0x80, 0x27, 0x03, 0x2b, 0x2b, 0x28, 0x28, 0x81, 0x2a, 0x02,
+    0x31, 0x31, 0x2b, 0x82, 0x31, 0x0f, 0x35, 0x34, 0x36, 0x39, 0x42, 0x4d,
+    0x90, 0x69, 0xac, 0x57, 0x56, 0x4f, 0x4f, 0x56, 0x9d, 0x73, 0x80, 0x65,
+    0x1b, 0x74, 0x83, 0x95, 0xd6, 0xd7, 0xd8, 0xdb, 0xa8, 0xe6, 0xb1, 0xe9,
+    0xca, 0x99, 0x8b, 0x95, 0x6c, 0x5e, 0x56, 0x4f, 0x48, 0x42, 0x42, 0x4c,
+    0x60, 0x8f, 0x8f, 0x63, 0x4c, 0x80, 0x31, 0x02, 0x25, 0x27, 0x25, 0x81,
+    0x21, 0x81, 0x1b, 0x08, 0x1a, 0x1a, 0x1b, 0x1b, 0x1a, 0x1b, 0x25, 0x25,
+    0x1a, 0x84, 0x15, 0x91, 0x12, 0x85, 0x0f, 0x05, 0x12, 0x1a, 0x19, 0x12,
+    0x11, 0x12, 0x81, 0x0f, 0x82, 0x0b, 0x1a, 0x0f, 0x0f, 0x18, 0x30, 0x1e,
+    0x12, 0x10, 0x0f, 0x0c, 0x0b, 0x0f, 0x11, 0x4e, 0x54, 0x2b, 0x52, 0x85,
+    0x64, 0x18, 0x0c, 0x07, 0x11, 0x24, 0x12, 0x12, 0x1b, 0x31, 0x80, 0x7c,
+    0x0d, 0x8f, 0x6f, 0x52, 0x32, 0x26, 0x20, 0x18, 0x12, 0x23, 0x23, 0x25,
+    0x25, 0x23, 0x25, 0x81, 0x21, 0x09, 0x25, 0x27, 0x23, 0x2b, 0x35, 0x2b,
+    0x27, 0x25, 0x23, 0x23, 0x81, 0x25, 0x01, 0x27, 0x25, 0xa7, 0x21, 0x00,
+    0x25, 0x80, 0x21, 0x03, 0x27, 0x27, 0x25, 0x25, 0x90, 0x27, 0x01, 0x23,
+    0x23, 0x85, 0x27, 0x0f, 0x31, 0x39, 0x4d, 0x68, 0x70, 0x68, 0xb5, 0x6d,
+    0x38, 0x28, 0x2b, 0x2a, 0x28, 0x25, 0x23, 0x25, 0x80, 0x21, 0x08, 0x25,
+    0x23, 0x23, 0x28, 0x28, 0x25, 0x28, 0x28, 0x25, 0x84, 0x21, 0x03, 0x25,
+    0x25, 0x23, 0x27, 0x81, 0x2a, 0x80, 0x27, 0x80, 0x2a, 0x86, 0x31, 0x31,
+    0x36, 0x3c, 0x42, 0x7a, 0xa2, 0xa4, 0x93, 0x77, 0x58, 0x4f, 0x4c, 0x4f,
+    0x67, 0x96, 0x5b, 0x56, 0x65, 0x6a, 0x78, 0x83, 0x9b, 0xd6, 0xd7, 0xd9,
+    0x98, 0xa1, 0xcf, 0xb2, 0xd1, 0xa4, 0xdd, 0xb4, 0x9d, 0x80, 0x6c, 0x5e,
+    0x51, 0x46, 0x4c, 0x4c, 0x71, 0xa4, 0x68, 0x4c, 0x3c, 0x39, 0x31, 0x34,
+    0x2c, 0x25, 0x81, 0x27, 0x00, 0x25, 0x80, 0x21, 0x82, 0x1b, 0x80, 0x17,
+    0x02, 0x23, 0x25, 0x18, 0x84, 0x15, 0x02, 0x14, 0x14, 0x15, 0x89, 0x12,
+    0x00, 0x11, 0x80, 0x12, 0x82, 0x0f, 0x07, 0x12, 0x11, 0x11, 0x12, 0x0c,
+    0x12, 0x21, 0x1c, 0x83, 0x0f, 0x01, 0x0c, 0x0f, 0x82, 0x0b, 0x03, 0x0f,
+    0x18, 0x21, 0x12, 0x80, 0x0b, 0x1d, 0x06, 0x0d, 0x1d, 0x6d, 0x43, 0x14,
+    0x18, 0x36, 0xa9, 0x45, 0x12, 0x0b, 0x0b, 0x1c, 0x1f, 0x1a, 0x11, 0x14,
+    0x45, 0x68, 0x21, 0x32, 0x4b, 0x71, 0x89, 0x85, 0x85, 0x7b, 0x4b, 0x23,
+    0x81, 0x25, 0x82, 0x21, 0x05, 0x25, 0x25, 0x22, 0x28, 0x2b, 0x27, 0x82,
+    0x21, 0x01, 0x25, 0x23, 0x80, 0x27, 0x80, 0x21, 0x00, 0x25, 0x9e, 0x21,
+    0x00, 0x25, 0x81, 0x21, 0x07, 0x25, 0x25, 0x23, 0x23, 0x27, 0x27, 0x23,
+    0x25, 0x85, 0x27, 0x00, 0x25, 0x8a, 0x27, 0x12, 0x2b, 0x2b, 0x28, 0x28,
+    0x2b, 0x28, 0x28, 0x31, 0x52, 0x8a, 0x70, 0x58, 0x61, 0x46, 0x39, 0x2b,
+    0x2b, 0x28, 0x2a, 0x81, 0x27, 0x80, 0x21, 0x07, 0x25, 0x25, 0x23, 0x28,
+    0x27, 0x25, 0x28, 0x27, 0x81, 0x21, 0x07, 0x27, 0x23, 0x25, 0x23, 0x23,
+    0x27, 0x23, 0x25, 0x81, 0x2a, 0x00, 0x28, 0x82, 0x2a, 0x85, 0x31, 0x07,
+    0x36, 0x39, 0x42, 0x55, 0xbf, 0x76, 0x67, 0x53, 0x81, 0x48, 0x23, 0x4f,
+    0x81, 0x73, 0x5b, 0x5b, 0x65, 0x6c, 0x78, 0x83, 0x95, 0xd6, 0xd7, 0xa6,
+    0xa8, 0xe6, 0xb1, 0xd4, 0xc8, 0xba, 0xa6, 0xd8, 0x95, 0x95, 0xb3, 0x5e,
+    0x51, 0x4f, 0x4f, 0x62, 0xa0, 0x5c, 0x42, 0x3d, 0x35, 0x36, 0x2c, 0x80,
+    0x31, 0x03, 0x2b, 0x27, 0x25, 0x27, 0x81, 0x21, 0x81, 0x1b, 0x06, 0x1a,
+    0x18, 0x16, 0x1a, 0x27, 0x28, 0x18, 0x81, 0x15, 0x82, 0x12, 0x81, 0x15,
+    0x8b, 0x12, 0x80, 0x0f, 0x03, 0x12, 0x11, 0x12, 0x12, 0x80, 0x0f, 0x02,
+    0x12, 0x1c, 0x18, 0x82, 0x0f, 0x0b, 0x0e, 0x0f, 0x0f, 0x0c, 0x0f, 0x0e,
+    0x0c, 0x0f, 0x0f, 0x14, 0x14, 0x0f, 0x80, 0x0b, 0x12, 0x1c, 0x6d, 0x49,
+    0x18, 0x13, 0x11, 0x1b, 0x5d, 0x8a, 0x3b, 0x14, 0x0d, 0x0f, 0x14, 0x1c,
+    0x11, 0x13, 0x4b, 0x5d, 0x80, 0x12, 0x05, 0x18, 0x1b, 0x26, 0x2e, 0x52,
+    0x8a, 0x83, 0x21, 0x00, 0x25, 0x82, 0x21, 0x01, 0x25, 0x25, 0x86, 0x21,
+    0x01, 0x25, 0x27, 0x9e, 0x21, 0x00, 0x25, 0x87, 0x21, 0x02, 0x25, 0x27,
+    0x25, 0x89, 0x27, 0x08, 0x25, 0x28, 0x28, 0x2b, 0x28, 0x25, 0x27, 0x2a,
+    0x2b, 0x81, 0x27, 0x01, 0x2a, 0x25, 0x80, 0x27, 0x09, 0x2b, 0x2a, 0x31,
+    0x42, 0x89, 0x55, 0x41, 0x31, 0x39, 0x2b, 0x84, 0x27, 0x80, 0x2a, 0x09,
+    0x28, 0x27, 0x23, 0x25, 0x25, 0x27, 0x25, 0x23, 0x28, 0x25, 0x82, 0x21,
+    0x00, 0x25, 0x80, 0x27, 0x00, 0x25, 0x80, 0x27, 0x3d, 0x2b, 0x2b, 0x2c,
+    0x28, 0x28, 0x2b, 0x2b, 0x2c, 0x31, 0x31, 0x30, 0x2a, 0x2b, 0x31, 0x34,
+    0x36, 0x39, 0x39, 0x3d, 0x4e, 0x72, 0x8a, 0x51, 0x4c, 0x4a, 0x42, 0x42,
+    0x46, 0x42, 0x53, 0xdd, 0x65, 0x56, 0x5b, 0x65, 0x65, 0x74, 0x9b, 0xd6,
+    0xb3, 0xd8, 0xdd, 0xa4, 0xd1, 0xea, 0xd2, 0xbf, 0xb7, 0xd9, 0xd7, 0xd6,
+    0x83, 0xb3, 0x80, 0x5b, 0x67, 0x81, 0x82, 0x72, 0x42, 0x3c, 0x39, 0x83,
+    0x31, 0x07, 0x2a, 0x27, 0x27, 0x25, 0x23, 0x22, 0x1d, 0x21, 0x81, 0x1b,
+    0x80, 0x17, 0x04, 0x28, 0x2a, 0x1a, 0x16, 0x15, 0x86, 0x12, 0x81, 0x15,
+    0x8a, 0x12, 0x88, 0x0f, 0x05, 0x16, 0x24, 0x11, 0x0c, 0x0f, 0x12, 0x81,
+    0x0f, 0x00, 0x0c, 0x80, 0x0f, 0x1b, 0x0c, 0x10, 0x12, 0x11, 0x0c, 0x0b,
+    0x0a, 0x10, 0x36, 0x5a, 0x18, 0x0c, 0x10, 0x12, 0x11, 0x28, 0x52, 0x85,
+    0x55, 0x25, 0x0f, 0x0d, 0x0f, 0x0b, 0x14, 0x6f, 0x3b, 0x11, 0x82, 0x0b,
+    0x05, 0x11, 0x15, 0x41, 0x23, 0x23, 0x25, 0x80, 0x21, 0x01, 0x25, 0x25,
+    0x83, 0x21, 0x06, 0x25, 0x23, 0x27, 0x25, 0x25, 0x23, 0x25, 0x80, 0x21,
+    0x00, 0x25, 0x9e, 0x21, 0x00, 0x25, 0x88, 0x21, 0x00, 0x27, 0x80, 0x25,
+    0x80, 0x27, 0x00, 0x25, 0x80, 0x27, 0x13, 0x25, 0x27, 0x27, 0x25, 0x28,
+    0x2b, 0x2c, 0x28, 0x28, 0x23, 0x23, 0x25, 0x27, 0x28, 0x2b, 0x2a, 0x28,
+    0x25, 0x2a, 0x2b, 0x80, 0x27, 0x06, 0x31, 0x76, 0x76, 0x39, 0x31, 0x2b,
+    0x2b, 0x8a, 0x27, 0x07, 0x23, 0x25, 0x25, 0x28, 0x25, 0x23, 0x28, 0x25,
+    0x82, 0x21, 0x00, 0x25, 0x80, 0x27, 0x00, 0x25, 0x80, 0x27, 0x80, 0x2a,
+    0x00, 0x28, 0x80, 0x2a, 0x04, 0x31, 0x2c, 0x31, 0x34, 0x36, 0x81, 0x31,
+    0x0e, 0x3c, 0x42, 0x60, 0x7c, 0xac, 0x55, 0x48, 0x42, 0x3c, 0x42, 0x41,
+    0x42, 0x48, 0x5a, 0x8d, 0x80, 0x56, 0x1b, 0x65, 0x6a, 0x78, 0x9b, 0x9b,
+    0xd7, 0xb4, 0xb7, 0xc6, 0xb1, 0xb2, 0xc8, 0xba, 0xb5, 0x9c, 0x95, 0xd6,
+    0x83, 0x6a, 0x6c, 0x8d, 0x90, 0x5a, 0x69, 0x8e, 0x42, 0x41, 0x36, 0x81,
+    0x31, 0x01, 0x2b, 0x2b, 0x80, 0x27, 0x03, 0x25, 0x25, 0x23, 0x21, 0x83,
+    0x1b, 0x03, 0x1a, 0x19, 0x23, 0x1d, 0x80, 0x15, 0x96, 0x12, 0x89, 0x0f,
+    0x02, 0x12, 0x1e, 0x12, 0x81, 0x0f, 0x07, 0x0e, 0x0f, 0x0f, 0x0c, 0x0e,
+    0x10, 0x10, 0x0c, 0x80, 0x0f, 0x17, 0x0c, 0x0b, 0x0f, 0x11, 0x4e, 0x3f,
+    0x12, 0x0c, 0x0c, 0x07, 0x0f, 0x12, 0x12, 0x32, 0x5d, 0x7c, 0x20, 0x11,
+    0x0b, 0x06, 0x15, 0x6f, 0x20, 0x0d, 0x82, 0x06, 0x01, 0x0b, 0x11, 0x84,
+    0x21, 0x01, 0x27, 0x25, 0x83, 0x21, 0x00, 0x25, 0x83, 0x27, 0x80, 0x21,
+    0x01, 0x25, 0x25, 0xae, 0x21, 0x84, 0x27, 0x81, 0x25, 0x03, 0x28, 0x2b,
+    0x28, 0x25, 0x84, 0x27, 0x01, 0x25, 0x28, 0x80, 0x31, 0x06, 0x41, 0x5a,
+    0x68, 0x7f, 0x41, 0x30, 0x2c, 0x85, 0x27, 0x05, 0x2b, 0x27, 0x25, 0x25,
+    0x23, 0x25, 0x85, 0x27, 0x00, 0x25, 0x80, 0x21, 0x01, 0x25, 0x23, 0x81,
+    0x27, 0x00, 0x25, 0x80, 0x27, 0x80, 0x2a, 0x08, 0x2c, 0x2c, 0x31, 0x2c,
+    0x2b, 0x31, 0x35, 0x31, 0x2c, 0x80, 0x31, 0x09, 0x38, 0x42, 0x62, 0xbf,
+    0x6f, 0x55, 0x46, 0x40, 0x3c, 0x39, 0x80, 0x42, 0x20, 0x4a, 0x51, 0x86,
+    0x5b, 0x53, 0x56, 0x65, 0x6c, 0x78, 0xd6, 0xd6, 0xd7, 0xb5, 0x92, 0xcc,
+    0xd4, 0xb1, 0xe6, 0xb8, 0xb4, 0xd7, 0xd6, 0xd6, 0x83, 0x5b, 0x70, 0x9a,
+    0x67, 0x4f, 0x4e, 0xa9, 0x55, 0x42, 0x80, 0x36, 0x02, 0x31, 0x2c, 0x2b,
+    0x80, 0x27, 0x04, 0x25, 0x25, 0x27, 0x25, 0x22, 0x83, 0x1b, 0x03, 0x1a,
+    0x19, 0x22, 0x1b, 0x80, 0x15, 0x81, 0x12, 0x00, 0x15, 0x8d, 0x12, 0x00,
+    0x11, 0x80, 0x12, 0x88, 0x0f, 0x05, 0x0c, 0x11, 0x16, 0x14, 0x11, 0x0f,
+    0x84, 0x0b, 0x02, 0x0f, 0x10, 0x0c, 0x80, 0x0f, 0x80, 0x0b, 0x16, 0x10,
+    0x58, 0x3f, 0x0f, 0x0c, 0x06, 0x04, 0x0e, 0x12, 0x0f, 0x0f, 0x28, 0x72,
+    0x33, 0x11, 0x0a, 0x0d, 0x12, 0x6f, 0x20, 0x0c, 0x06, 0x08, 0x80, 0x03,
+    0x05, 0x07, 0x0b, 0x12, 0x23, 0x23, 0x25, 0x80, 0x21, 0x01, 0x27, 0x25,
+    0x83, 0x21, 0x00, 0x25, 0x81, 0x27, 0x80, 0x25, 0x80, 0x21, 0x01, 0x25,
+    0x25, 0x8e, 0x21, 0x00, 0x1d, 0x9b, 0x21, 0x03, 0x25, 0x25, 0x27, 0x25,
+    0x80, 0x27, 0x00, 0x25, 0x80, 0x27, 0x08, 0x2b, 0x2b, 0x28, 0x28, 0x2a,
+    0x28, 0x28, 0x31, 0x31, 0x80, 0x2a, 0x17, 0x31, 0x3e, 0x4d, 0x73, 0x81,
+    0x96, 0x5c, 0x4c, 0x2f, 0x2b, 0x34, 0x28, 0x2a, 0x31, 0x2b, 0x2a, 0x28,
+    0x28, 0x2a, 0x2b, 0x28, 0x25, 0x25, 0x23, 0x86, 0x27, 0x00, 0x25, 0x80,
+    0x21, 0x88, 0x27, 0x80, 0x2a, 0x02, 0x2d, 0x31, 0x2f, 0x80, 0x31, 0x32,
+    0x2b, 0x2c, 0x31, 0x35, 0x36, 0x3d, 0x4c, 0x72, 0x94, 0x51, 0x4c, 0x3d,
+    0x40, 0x3c, 0x41, 0x3d, 0x41, 0x42, 0x42, 0x51, 0x80, 0x65, 0x51, 0x56,
+    0x65, 0x6c, 0x83, 0xd6, 0xd7, 0xd7, 0xda, 0xa9, 0xe8, 0xb2, 0xd2, 0xbf,
+    0x87, 0x8c, 0xb4, 0x81, 0x80, 0x80, 0x7d, 0xe0, 0x67, 0x4f, 0x4c, 0x4a,
+    0x6d, 0x8e, 0x55, 0x80, 0x37, 0x07, 0x34, 0x31, 0x2b, 0x2b, 0x28, 0x25,
+    0x27, 0x27, 0x81, 0x21, 0x83, 0x1b, 0x05, 0x1a, 0x22, 0x22, 0x18, 0x18,
+    0x15, 0x80, 0x12, 0x82, 0x15, 0x00, 0x14, 0x83, 0x15, 0x88, 0x12, 0x89,
+    0x0f, 0x02, 0x12, 0x16, 0x14, 0x81, 0x0f, 0x81, 0x0b, 0x03, 0x0f, 0x10,
+    0x0e, 0x0c, 0x80, 0x0f, 0x1e, 0x0c, 0x0f, 0x14, 0x6d, 0x32, 0x0b, 0x0c,
+    0x07, 0x0a, 0x0b, 0x06, 0x0b, 0x0c, 0x11, 0x45, 0x77, 0x1b, 0x0c, 0x0b,
+    0x14, 0x6f, 0x26, 0x0b, 0x0b, 0x05, 0x06, 0x06, 0x05, 0x05, 0x0a, 0x0b,
+    0x81, 0x21, 0x02, 0x25, 0x23, 0x25, 0x82, 0x21, 0x01, 0x25, 0x25, 0x80,
+    0x21, 0x04, 0x25, 0x25, 0x23, 0x23, 0x25, 0x81, 0x21, 0x01, 0x25, 0x25,
+    0xab, 0x21, 0x02, 0x25, 0x23, 0x23, 0x86, 0x27, 0x17, 0x2b, 0x2a, 0x25,
+    0x23, 0x23, 0x25, 0x2b, 0x42, 0x5b, 0x5a, 0x4f, 0x5a, 0x73, 0x79, 0x6d,
+    0x4d, 0x49, 0x39, 0x2b, 0x28, 0x2b, 0x2b, 0x31, 0x28, 0x80, 0x2a, 0x00,
+    0x2c, 0x80, 0x27, 0x01, 0x2b, 0x2a, 0x82, 0x27, 0x01, 0x23, 0x25, 0x82,
+    0x27, 0x03, 0x25, 0x23, 0x25, 0x25, 0x88, 0x27, 0x05, 0x2a, 0x28, 0x2b,
+    0x2c, 0x2c, 0x2f, 0x80, 0x31, 0x2c, 0x2c, 0x31, 0x39, 0x3c, 0x42, 0x62,
+    0x92, 0xbf, 0x71, 0x42, 0x3d, 0x41, 0x3c, 0x3d, 0x42, 0x41, 0x41, 0x42,
+    0x42, 0x4f, 0x6c, 0x5b, 0x51, 0x56, 0x6a, 0x78, 0x83, 0xd6, 0xd7, 0xd9,
+    0xde, 0xe5, 0xd0, 0xd5, 0xd1, 0xbe, 0xad, 0xa9, 0x91, 0x84, 0x8c, 0x90,
+    0xa6, 0x67, 0x5b, 0x80, 0x48, 0x09, 0x42, 0x7b, 0x69, 0x41, 0x39, 0x36,
+    0x34, 0x31, 0x2b, 0x2b, 0x80, 0x27, 0x01, 0x25, 0x25, 0x82, 0x21, 0x09,
+    0x1b, 0x1b, 0x1a, 0x1b, 0x1a, 0x21, 0x1d, 0x18, 0x18, 0x15, 0x80, 0x12,
+    0x85, 0x15, 0x8d, 0x12, 0x89, 0x0f, 0x02, 0x12, 0x16, 0x12, 0x87, 0x0f,
+    0x09, 0x0c, 0x0f, 0x12, 0x0f, 0x0c, 0x10, 0x2b, 0x8d, 0x3f, 0x13, 0x80,
+    0x0b, 0x81, 0x06, 0x0d, 0x0b, 0x1f, 0x7f, 0x4b, 0x18, 0x12, 0x45, 0x77,
+    0x19, 0x0c, 0x0c, 0x06, 0x05, 0x07, 0x80, 0x03, 0x00, 0x07, 0x83, 0x21,
+    0x00, 0x25, 0x83, 0x21, 0x00, 0x25, 0x87, 0x21, 0x81, 0x25, 0xac, 0x21,
+    0x00, 0x25, 0x84, 0x27, 0x03, 0x2a, 0x27, 0x28, 0x2b, 0x80, 0x27, 0x80,
+    0x2a, 0x14, 0x34, 0x4c, 0x73, 0x9d, 0x61, 0x53, 0x3d, 0x31, 0x2b, 0x28,
+    0x28, 0x2a, 0x30, 0x2b, 0x28, 0x24, 0x25, 0x28, 0x28, 0x2b, 0x2c, 0x81,
+    0x27, 0x01, 0x2c, 0x2b, 0x81, 0x27, 0x80, 0x25, 0x81, 0x27, 0x03, 0x25,
+    0x23, 0x23, 0x25, 0x8c, 0x27, 0x01, 0x2b, 0x2f, 0x80, 0x31, 0x0c, 0x39,
+    0x42, 0x4c, 0x4d, 0x85, 0xac, 0x7b, 0x68, 0x5a, 0x42, 0x3c, 0x39, 0x3d,
+    0x81, 0x40, 0x80, 0x48, 0x29, 0x5b, 0x4f, 0x4f, 0x5b, 0x6a, 0x78, 0x83,
+    0xd6, 0xd7, 0xb5, 0xa8, 0xc6, 0xb1, 0xb2, 0xd0, 0xa5, 0xab, 0xa6, 0x80,
+    0x83, 0x83, 0x6c, 0x65, 0x56, 0x56, 0x4f, 0x48, 0x4a, 0x41, 0x55, 0x82,
+    0x48, 0x36, 0x31, 0x31, 0x2b, 0x2b, 0x28, 0x2a, 0x28, 0x27, 0x25, 0x83,
+    0x21, 0x03, 0x1b, 0x1b, 0x1a, 0x1b, 0x80, 0x17, 0x04, 0x16, 0x18, 0x15,
+    0x15, 0x14, 0x84, 0x15, 0x8f, 0x12, 0x88, 0x0f, 0x06, 0x0c, 0x0f, 0x12,
+    0x14, 0x11, 0x0f, 0x0c, 0x84, 0x0f, 0x1c, 0x0c, 0x10, 0x12, 0x11, 0x0c,
+    0x0c, 0x1b, 0x49, 0x6d, 0x4e, 0x0c, 0x07, 0x07, 0x0b, 0x0a, 0x07, 0x0b,
+    0x0f, 0x12, 0x3a, 0x87, 0x5d, 0x47, 0x84, 0x25, 0x11, 0x0b, 0x0b, 0x07,
+    0x82, 0x03, 0x00, 0x08, 0x86, 0x21, 0x00, 0x25, 0x8b, 0x21, 0x00, 0x25,
+    0x92, 0x21, 0x00, 0x1d, 0x83, 0x21, 0x81, 0x1b, 0x86, 0x21, 0x00, 0x25,
+    0x86, 0x21, 0x02, 0x27, 0x25, 0x25, 0x85, 0x27, 0x80, 0x25, 0x11, 0x2a,
+    0x2b, 0x2c, 0x28, 0x2b, 0x31, 0x36, 0x31, 0x2b, 0x2c, 0x2b, 0x2a, 0x27,
+    0x23, 0x28, 0x2a, 0x28, 0x23, 0x80, 0x27, 0x04, 0x2b, 0x28, 0x27, 0x25,
+    0x23, 0x80, 0x27, 0x05, 0x2a, 0x2c, 0x2c, 0x28, 0x28, 0x2b, 0x81, 0x27,
+    0x05, 0x23, 0x25, 0x23, 0x23, 0x25, 0x23, 0x82, 0x27, 0x01, 0x2a, 0x2a,
+    0x81, 0x27, 0x81, 0x2a, 0x0b, 0x28, 0x2c, 0x34, 0x37, 0x41, 0x55, 0x7c,
+    0xa2, 0xac, 0x87, 0x4d, 0x41, 0x84, 0x37, 0x02, 0x41, 0x41, 0x3d, 0x80,
+    0x48, 0x1f, 0x51, 0x4f, 0x51, 0x56, 0x6a, 0x83, 0x83, 0x95, 0xd8, 0xdd,
+    0xa2, 0xd1, 0xea, 0xb1, 0xca, 0xc1, 0x9a, 0xd8, 0xd6, 0x9b, 0x83, 0x6a,
+    0x65, 0x5b, 0x53, 0x4f, 0x4c, 0x4a, 0x42, 0x4e, 0x87, 0x4d, 0x81, 0x31,
+    0x01, 0x2b, 0x31, 0x80, 0x27, 0x02, 0x25, 0x27, 0x25, 0x81, 0x21, 0x02,
+    0x1d, 0x1b, 0x1a, 0x81, 0x1b, 0x03, 0x1a, 0x18, 0x15, 0x15, 0x80, 0x12,
+    0x81, 0x15, 0x8e, 0x12, 0x89, 0x0f, 0x05, 0x0e, 0x0f, 0x10, 0x15, 0x18,
+    0x12, 0x82, 0x0b, 0x83, 0x0f, 0x01, 0x12, 0x11, 0x80, 0x0b, 0x03, 0x11,
+    0x2e, 0x73, 0x22, 0x83, 0x06, 0x11, 0x0b, 0x0b, 0x12, 0x3f, 0x7c, 0x87,
+    0x3a, 0x11, 0x0b, 0x0e, 0x05, 0x0b, 0x06, 0x02, 0x05, 0x0b, 0x05, 0x05,
+    0x86, 0x21, 0x03, 0x27, 0x23, 0x23, 0x25, 0x9e, 0x21, 0x01, 0x1d, 0x1d,
+    0x83, 0x21, 0x80, 0x1b, 0x90, 0x21, 0x02, 0x27, 0x25, 0x25, 0x89, 0x27,
+    0x03, 0x2b, 0x2a, 0x28, 0x28, 0x81, 0x2a, 0x01, 0x28, 0x2b, 0x82, 0x27,
+    0x02, 0x25, 0x25, 0x27, 0x80, 0x2a, 0x03, 0x28, 0x28, 0x25, 0x25, 0x80,
+    0x27, 0x02, 0x2b, 0x2c, 0x2c, 0x81, 0x27, 0x00, 0x25, 0x81, 0x27, 0x80,
+    0x25, 0x89, 0x27, 0x02, 0x2b, 0x2b, 0x28, 0x80, 0x2a, 0x0c, 0x34, 0x42,
+    0x69, 0xa2, 0x85, 0x60, 0x52, 0x42, 0x39, 0x39, 0x36, 0x34, 0x36, 0x81,
+    0x37, 0x80, 0x40, 0x03, 0x42, 0x42, 0x4c, 0x53, 0x80, 0x56, 0x1e, 0x74,
+    0x78, 0x96, 0x91, 0xa7, 0x99, 0xc3, 0xd3, 0xea, 0xcf, 0xa4, 0x92, 0xa6,
+    0xd7, 0x95, 0xd6, 0x83, 0x6c, 0x65, 0x5b, 0x56, 0x4f, 0x4f, 0x4a, 0x42,
+    0x4c, 0x77, 0x77, 0x41, 0x34, 0x35, 0x80, 0x31, 0x07, 0x2a, 0x28, 0x27,
+    0x25, 0x28, 0x28, 0x25, 0x25, 0x80, 0x21, 0x83, 0x1b, 0x02, 0x19, 0x18,
+    0x15, 0x82, 0x12, 0x80, 0x15, 0x8a, 0x12, 0x00, 0x11, 0x81, 0x12, 0x8a,
+    0x0f, 0x05, 0x0c, 0x15, 0x19, 0x11, 0x0c, 0x0f, 0x80, 0x0b, 0x80, 0x0f,
+    0x01, 0x0b, 0x0b, 0x80, 0x0f, 0x80, 0x0b, 0x14, 0x0f, 0x12, 0x49, 0x4d,
+    0x12, 0x0e, 0x0b, 0x08, 0x05, 0x06, 0x0b, 0x0b, 0x0f, 0x1a, 0x4b, 0xac,
+    0x4b, 0x1a, 0x10, 0x0f, 0x0b, 0x80, 0x03, 0x00, 0x0a, 0x80, 0x03, 0x83,
+    0x21, 0x06, 0x25, 0x23, 0x23, 0x27, 0x23, 0x23, 0x25, 0x82, 0x21, 0x01,
+    0x25, 0x25, 0x97, 0x21, 0x81, 0x1b, 0x00, 0x1f, 0x84, 0x1b, 0x8e, 0x21,
+    0x03, 0x25, 0x25, 0x23, 0x25, 0x88, 0x27, 0x80, 0x2a, 0x80, 0x27, 0x81,
+    0x2a, 0x82, 0x27, 0x04, 0x25, 0x25, 0x27, 0x28, 0x2a, 0x89, 0x27, 0x04,
+    0x2a, 0x28, 0x28, 0x25, 0x23, 0x81, 0x27, 0x80, 0x25, 0x85, 0x27, 0x16,
+    0x23, 0x23, 0x28, 0x28, 0x2b, 0x2c, 0x28, 0x2b, 0x2b, 0x31, 0x37, 0x44,
+    0x93, 0x69, 0x42, 0x4a, 0x31, 0x31, 0x37, 0x35, 0x34, 0x34, 0x35, 0x81,
+    0x37, 0x2d, 0x41, 0x41, 0x42, 0x41, 0x42, 0x5b, 0x9d, 0x6a, 0x65, 0x65,
+    0x83, 0x83, 0x99, 0x9f, 0xa5, 0xab, 0xb0, 0xd3, 0xea, 0xce, 0xe4, 0xdd,
+    0xd9, 0xd7, 0x95, 0xd6, 0x83, 0x6a, 0x65, 0x5b, 0x56, 0x4f, 0x4c, 0x4c,
+    0x42, 0x42, 0x5c, 0xac, 0x48, 0x34, 0x31, 0x37, 0x31, 0x31, 0x2c, 0x2a,
+    0x82, 0x27, 0x03, 0x25, 0x25, 0x21, 0x21, 0x82, 0x1b, 0x03, 0x1a, 0x19,
+    0x18, 0x15, 0x84, 0x12, 0x01, 0x15, 0x15, 0x89, 0x12, 0x01, 0x11, 0x11,
+    0x83, 0x12, 0x80, 0x0f, 0x00, 0x0c, 0x84, 0x0f, 0x02, 0x12, 0x16, 0x12,
+    0x80, 0x0f, 0x85, 0x0b, 0x1c, 0x0f, 0x0f, 0x0c, 0x07, 0x0a, 0x0e, 0x0d,
+    0x28, 0x61, 0x15, 0x0b, 0x0b, 0x0a, 0x05, 0x05, 0x0f, 0x0b, 0x0b, 0x12,
+    0x2b, 0x59, 0xbf, 0x72, 0x2e, 0x11, 0x0c, 0x07, 0x0c, 0x08, 0x81, 0x03,
+    0x80, 0x21, 0x0d, 0x25, 0x28, 0x25, 0x25, 0x23, 0x23, 0x27, 0x25, 0x23,
+    0x25, 0x25, 0x23, 0x25, 0x23, 0x81, 0x25, 0x96, 0x21, 0x81, 0x1b, 0x00,
+    0x21, 0x83, 0x1b, 0x8e, 0x21, 0x84, 0x25, 0x85, 0x27, 0x01, 0x2a, 0x2a,
+    0x83, 0x27, 0x02, 0x2b, 0x2b, 0x2c, 0x80, 0x27, 0x04, 0x2a, 0x28, 0x25,
+    0x27, 0x28, 0x80, 0x2a, 0x8b, 0x27, 0x01, 0x25, 0x23, 0x81, 0x27, 0x02,
+    0x25, 0x23, 0x23, 0x89, 0x27, 0x11, 0x2b, 0x2b, 0x28, 0x2b, 0x35, 0x2a,
+    0x37, 0x4d, 0xac, 0x58, 0x39, 0x39, 0x36, 0x37, 0x36, 0x37, 0x38, 0x36,
+    0x82, 0x37, 0x1e, 0x41, 0x41, 0x42, 0x42, 0x48, 0x56, 0xd9, 0xd8, 0x9c,
+    0x67, 0x78, 0x81, 0xa9, 0x75, 0x8b, 0xb8, 0xbf, 0xd3, 0xd5, 0xce, 0x9f,
+    0xde, 0xb4, 0xd7, 0xd6, 0x9b, 0x83, 0x6a, 0x65, 0x5b, 0x56, 0x80, 0x4f,
+    0x0b, 0x46, 0x4a, 0x76, 0xa0, 0x48, 0x36, 0x31, 0x36, 0x31, 0x2c, 0x2c,
+    0x2b, 0x83, 0x27, 0x02, 0x25, 0x22, 0x21, 0x82, 0x1b, 0x80, 0x17, 0x82,
+    0x15, 0x8e, 0x12, 0x01, 0x11, 0x11, 0x80, 0x12, 0x02, 0x11, 0x12, 0x12,
+    0x80, 0x0f, 0x00, 0x0c, 0x86, 0x0f, 0x04, 0x16, 0x12, 0x0b, 0x0f, 0x0f,
+    0x84, 0x0b, 0x80, 0x0f, 0x06, 0x0c, 0x0a, 0x05, 0x0b, 0x2a, 0x61, 0x15,
+    0x80, 0x06, 0x10, 0x05, 0x0b, 0x0b, 0x06, 0x0b, 0x0f, 0x12, 0x19, 0x45,
+    0x94, 0x59, 0x36, 0x3b, 0x25, 0x0f, 0x0c, 0x06, 0x80, 0x03, 0x81, 0x21,
+    0x80, 0x27, 0x06, 0x25, 0x23, 0x27, 0x23, 0x22, 0x27, 0x25, 0x80, 0x21,
+    0x03, 0x25, 0x23, 0x25, 0x25, 0x83, 0x21, 0x01, 0x25, 0x25, 0x90, 0x21,
+    0x02, 0x1d, 0x21, 0x21, 0x83, 0x1b, 0x86, 0x21, 0x02, 0x25, 0x28, 0x25,
+    0x82, 0x21, 0x00, 0x28, 0x82, 0x21, 0x00, 0x25, 0x8a, 0x27, 0x05, 0x2a,
+    0x28, 0x25, 0x28, 0x2a, 0x2a, 0x84, 0x27, 0x82, 0x2a, 0x01, 0x28, 0x28,
+    0x81, 0x2a, 0x84, 0x27, 0x01, 0x25, 0x23, 0x80, 0x27, 0x00, 0x25, 0x80,
+    0x21, 0x04, 0x27, 0x27, 0x23, 0x25, 0x25, 0x83, 0x27, 0x82, 0x2a, 0x0a,
+    0x35, 0x31, 0x3c, 0x62, 0xbe, 0x4e, 0x3d, 0x35, 0x36, 0x34, 0x36, 0x85,
+    0x37, 0x80, 0x40, 0x2b, 0x4a, 0x48, 0x5b, 0x78, 0x6a, 0x7e, 0x9d, 0x83,
+    0x9c, 0x97, 0xa7, 0xb4, 0xb6, 0xbf, 0xd3, 0xea, 0xcf, 0xa4, 0xb7, 0xb5,
+    0xd7, 0xd7, 0xd6, 0x83, 0x78, 0x6a, 0x65, 0x5b, 0x56, 0x51, 0x4c, 0x48,
+    0x51, 0x92, 0x76, 0x42, 0x39, 0x37, 0x36, 0x2c, 0x31, 0x31, 0x2b, 0x2b,
+    0x83, 0x27, 0x01, 0x23, 0x21, 0x81, 0x1b, 0x82, 0x17, 0x82, 0x15, 0x8d,
+    0x12, 0x00, 0x11, 0x80, 0x12, 0x85, 0x0f, 0x01, 0x0c, 0x0c, 0x82, 0x0f,
+    0x03, 0x0c, 0x0f, 0x16, 0x14, 0x85, 0x0b, 0x10, 0x0a, 0x0b, 0x0f, 0x0f,
+    0x0c, 0x0a, 0x0b, 0x0b, 0x10, 0x1b, 0x61, 0x1a, 0x06, 0x06, 0x05, 0x05,
+    0x0b, 0x80, 0x06, 0x0e, 0x0b, 0x0b, 0x10, 0x1a, 0x57, 0x9f, 0x70, 0x86,
+    0x85, 0x3b, 0x0c, 0x08, 0x05, 0x06, 0x05, 0x80, 0x21, 0x80, 0x25, 0x09,
+    0x27, 0x23, 0x25, 0x27, 0x23, 0x22, 0x27, 0x27, 0x23, 0x25, 0x9d, 0x21,
+    0x04, 0x1d, 0x21, 0x21, 0x1d, 0x1d, 0x8a, 0x21, 0x03, 0x25, 0x28, 0x28,
+    0x25, 0x80, 0x21, 0x01, 0x25, 0x25, 0x83, 0x21, 0x8c, 0x27, 0x04, 0x23,
+    0x23, 0x28, 0x28, 0x25, 0x82, 0x27, 0x81, 0x2a, 0x07, 0x2c, 0x2b, 0x28,
+    0x25, 0x28, 0x2b, 0x2c, 0x31, 0x84, 0x27, 0x03, 0x25, 0x23, 0x27, 0x28,
+    0x81, 0x21, 0x02, 0x25, 0x23, 0x25, 0x82, 0x21, 0x00, 0x25, 0x80, 0x27,
+    0x00, 0x2b, 0x81, 0x31, 0x0a, 0x2b, 0x42, 0x67, 0x7b, 0x94, 0x41, 0x36,
+    0x35, 0x30, 0x31, 0x36, 0x85, 0x37, 0x2f, 0x3d, 0x41, 0x3d, 0x42, 0x46,
+    0x53, 0x7e, 0x65, 0x5b, 0x86, 0x86, 0x83, 0x70, 0xe0, 0xb4, 0x92, 0xc8,
+    0xe9, 0xd5, 0xeb, 0xbe, 0x99, 0xda, 0xd8, 0xb3, 0xd6, 0xd6, 0x83, 0x78,
+    0x6c, 0x65, 0x5b, 0x4f, 0x4f, 0x4c, 0x53, 0x8a, 0x60, 0x42, 0x3c, 0x39,
+    0x36, 0x31, 0x35, 0x31, 0x2c, 0x28, 0x2b, 0x82, 0x27, 0x01, 0x25, 0x21,
+    0x81, 0x1b, 0x0a, 0x19, 0x18, 0x18, 0x19, 0x18, 0x18, 0x16, 0x18, 0x17,
+    0x15, 0x15, 0x81, 0x12, 0x00, 0x15, 0x8b, 0x12, 0x86, 0x0f, 0x01, 0x0e,
+    0x0f, 0x81, 0x0b, 0x05, 0x0f, 0x11, 0x12, 0x12, 0x0f, 0x0f, 0x82, 0x0b,
+    0x02, 0x07, 0x05, 0x0a, 0x80, 0x0b, 0x0b, 0x0a, 0x07, 0x0c, 0x0b, 0x18,
+    0x73, 0x25, 0x0a, 0x07, 0x05, 0x02, 0x0b, 0x83, 0x06, 0x08, 0x11, 0x3f,
+    0x71, 0x1b, 0x1d, 0x57, 0x8f, 0x18, 0x0b, 0x80, 0x03, 0x89, 0x21, 0x08,
+    0x27, 0x23, 0x25, 0x23, 0x25, 0x25, 0x23, 0x23, 0x25, 0x86, 0x21, 0x02,
+    0x25, 0x23, 0x25, 0x85, 0x21, 0x00, 0x1d, 0x87, 0x21, 0x00, 0x1d, 0x8e,
+    0x21, 0x00, 0x25, 0x82, 0x21, 0x02, 0x25, 0x23, 0x23, 0x80, 0x27, 0x00,
+    0x23, 0x80, 0x27, 0x00, 0x2a, 0x92, 0x27, 0x01, 0x2b, 0x2b, 0x83, 0x27,
+    0x0c, 0x2b, 0x2c, 0x2b, 0x28, 0x2b, 0x28, 0x28, 0x2b, 0x2b, 0x25, 0x22,
+    0x27, 0x28, 0x82, 0x21, 0x00, 0x27, 0x82, 0x25, 0x01, 0x23, 0x23, 0x80,
+    0x27, 0x04, 0x2b, 0x31, 0x31, 0x42, 0x54, 0x80, 0x56, 0x0b, 0x82, 0x87,
+    0x42, 0x34, 0x31, 0x2d, 0x31, 0x34, 0x39, 0x37, 0x36, 0x36, 0x82, 0x37,
+    0x04, 0x41, 0x42, 0x4a, 0x4c, 0x4f, 0x80, 0x56, 0x23, 0x7a, 0x9f, 0xa6,
+    0x90, 0xa6, 0x90, 0xc3, 0xca, 0xd1, 0xd5, 0xd4, 0xca, 0x9e, 0xa7, 0xb5,
+    0xd7, 0xd7, 0xd6, 0x9b, 0x83, 0x6e, 0x65, 0x5b, 0x56, 0x4f, 0x4f, 0x51,
+    0x69, 0x93, 0x48, 0x42, 0x39, 0x36, 0x37, 0x37, 0x35, 0x81, 0x2a, 0x81,
+    0x27, 0x02, 0x25, 0x22, 0x21, 0x80, 0x1b, 0x83, 0x17, 0x03, 0x15, 0x18,
+    0x19, 0x18, 0x80, 0x15, 0x02, 0x14, 0x15, 0x15, 0x87, 0x12, 0x01, 0x11,
+    0x11, 0x80, 0x12, 0x83, 0x0f, 0x05, 0x0c, 0x0c, 0x0f, 0x0f, 0x0c, 0x0c,
+    0x82, 0x0f, 0x02, 0x0c, 0x0c, 0x0f, 0x81, 0x0b, 0x81, 0x06, 0x10, 0x0c,
+    0x0f, 0x0f, 0x0b, 0x08, 0x0a, 0x0b, 0x1b, 0x73, 0x1f, 0x0c, 0x07, 0x04,
+    0x03, 0x0a, 0x0a, 0x05, 0x81, 0x06, 0x0b, 0x12, 0x26, 0x84, 0x1b, 0x0f,
+    0x2c, 0xa0, 0x25, 0x0b, 0x05, 0x02, 0x03, 0x89, 0x21, 0x01, 0x27, 0x25,
+    0x84, 0x21, 0x00, 0x25, 0x83, 0x21, 0x03, 0x25, 0x23, 0x25, 0x25, 0x86,
+    0x21, 0x80, 0x1b, 0x85, 0x21, 0x00, 0x1d, 0x80, 0x21, 0x00, 0x1d, 0x92,
+    0x21, 0x01, 0x25, 0x27, 0x80, 0x25, 0x01, 0x28, 0x2a, 0x80, 0x27, 0x01,
+    0x25, 0x25, 0x87, 0x27, 0x02, 0x23, 0x23, 0x25, 0x82, 0x27, 0x80, 0x2a,
+    0x82, 0x27, 0x80, 0x2a, 0x09, 0x2c, 0x2b, 0x28, 0x28, 0x2b, 0x2b, 0x25,
+    0x23, 0x28, 0x28, 0x80, 0x21, 0x22, 0x25, 0x23, 0x27, 0x27, 0x25, 0x25,
+    0x27, 0x27, 0x23, 0x23, 0x28, 0x23, 0x25, 0x28, 0x2b, 0x2b, 0x34, 0x4a,
+    0x4c, 0x3c, 0x42, 0x7c, 0x82, 0x39, 0x34, 0x35, 0x31, 0x36, 0x31, 0x36,
+    0x34, 0x36, 0x37, 0x36, 0x34, 0x80, 0x37, 0x1f, 0x3d, 0x42, 0x42, 0x48,
+    0x4c, 0x51, 0x56, 0x5b, 0x65, 0x81, 0x80, 0x83, 0xd7, 0x8d, 0xca, 0xa5,
+    0xcc, 0xea, 0xd5, 0xd0, 0xa5, 0xb9, 0xdb, 0xd9, 0xd7, 0xd6, 0xd6, 0x83,
+    0x78, 0x6a, 0x5e, 0x5b, 0x80, 0x4f, 0x04, 0x61, 0xa2, 0x53, 0x48, 0x3d,
+    0x80, 0x37, 0x03, 0x36, 0x31, 0x2b, 0x2b, 0x83, 0x27, 0x03, 0x23, 0x1d,
+    0x21, 0x21, 0x80, 0x1b, 0x80, 0x17, 0x80, 0x15, 0x80, 0x17, 0x86, 0x15,
+    0x83, 0x12, 0x01, 0x11, 0x11, 0x80, 0x12, 0x84, 0x0f, 0x04, 0x0c, 0x0f,
+    0x0f, 0x0c, 0x0c, 0x82, 0x0f, 0x83, 0x0b, 0x82, 0x06, 0x02, 0x0b, 0x0c,
+    0x0f, 0x81, 0x0b, 0x0a, 0x13, 0x58, 0x3c, 0x10, 0x0b, 0x08, 0x06, 0x0b,
+    0x0a, 0x05, 0x05, 0x80, 0x06, 0x08, 0x0f, 0x52, 0x60, 0x12, 0x0b, 0x36,
+    0x97, 0x22, 0x07, 0x80, 0x03, 0x89, 0x21, 0x04, 0x25, 0x25, 0x23, 0x23,
+    0x25, 0x81, 0x21, 0x00, 0x25, 0x80, 0x21, 0x01, 0x25, 0x25, 0x80, 0x21,
+    0x01, 0x25, 0x25, 0x87, 0x21, 0x80, 0x1b, 0x81, 0x21, 0x07, 0x1d, 0x21,
+    0x21, 0x1d, 0x21, 0x21, 0x1d, 0x1d, 0x92, 0x21, 0x05, 0x25, 0x27, 0x27,
+    0x25, 0x25, 0x2b, 0x80, 0x27, 0x02, 0x25, 0x25, 0x23, 0x87, 0x27, 0x80,
+    0x21, 0x04, 0x27, 0x28, 0x2a, 0x28, 0x28, 0x80, 0x2a, 0x83, 0x27, 0x03,
+    0x2b, 0x2b, 0x2c, 0x2b, 0x80, 0x27, 0x04, 0x2a, 0x27, 0x23, 0x27, 0x27,
+    0x80, 0x21, 0x04, 0x25, 0x25, 0x27, 0x27, 0x25, 0x85, 0x27, 0x80, 0x2a,
+    0x07, 0x31, 0x2b, 0x31, 0x3c, 0x5a, 0xac, 0x64, 0x38, 0x84, 0x31, 0x03,
+    0x36, 0x37, 0x37, 0x36, 0x80, 0x37, 0x27, 0x41, 0x42, 0x42, 0x4a, 0x4c,
+    0x4f, 0x51, 0x51, 0x5e, 0x6c, 0x78, 0x95, 0x95, 0x98, 0xca, 0x9f, 0xbf,
+    0xd1, 0xb2, 0xe9, 0xe8, 0xa4, 0x99, 0xa6, 0xd8, 0xd7, 0xd6, 0x9b, 0x83,
+    0x78, 0x65, 0x65, 0x51, 0x4f, 0x4c, 0x5a, 0xba, 0x5a, 0x42, 0x41, 0x80,
+    0x37, 0x03, 0x36, 0x31, 0x2b, 0x2b, 0x82, 0x27, 0x00, 0x25, 0x81, 0x21,
+    0x81, 0x1b, 0x01, 0x19, 0x18, 0x80, 0x15, 0x01, 0x18, 0x19, 0x86, 0x15,
+    0x84, 0x12, 0x04, 0x11, 0x12, 0x11, 0x12, 0x12, 0x87, 0x0f, 0x00, 0x0c,
+    0x84, 0x0f, 0x80, 0x0b, 0x02, 0x0a, 0x0a, 0x0b, 0x81, 0x06, 0x83, 0x0b,
+    0x1a, 0x08, 0x0d, 0x2b, 0x5f, 0x2b, 0x0a, 0x0a, 0x05, 0x07, 0x0a, 0x05,
+    0x0a, 0x0a, 0x05, 0x05, 0x12, 0x5d, 0x5d, 0x15, 0x16, 0x52, 0x5d, 0x13,
+    0x08, 0x02, 0x07, 0x05, 0x8e, 0x21, 0x00, 0x25, 0x81, 0x21, 0x02, 0x25,
+    0x25, 0x23, 0x80, 0x25, 0x01, 0x27, 0x25, 0x8c, 0x21, 0x08, 0x1d, 0x21,
+    0x21, 0x1d, 0x21, 0x21, 0x1d, 0x1d, 0x21, 0x80, 0x1b, 0x8a, 0x21, 0x00,
+    0x25, 0x85, 0x21, 0x0b, 0x25, 0x25, 0x23, 0x25, 0x2b, 0x2b, 0x28, 0x28,
+    0x25, 0x23, 0x25, 0x25, 0x86, 0x27, 0x80, 0x25, 0x85, 0x27, 0x80, 0x2a,
+    0x81, 0x27, 0x80, 0x2a, 0x80, 0x27, 0x05, 0x2a, 0x28, 0x25, 0x28, 0x25,
+    0x25, 0x89, 0x27, 0x83, 0x2a, 0x0b, 0x2c, 0x2f, 0x34, 0x48, 0x69, 0xbf,
+    0x4d, 0x3c, 0x31, 0x31, 0x2c, 0x2c, 0x81, 0x31, 0x82, 0x37, 0x01, 0x3d,
+    0x41, 0x80, 0x42, 0x22, 0x48, 0x4c, 0x4f, 0x51, 0x5e, 0x65, 0x78, 0x9b,
+    0x80, 0x93, 0xc3, 0x91, 0xb9, 0xbf, 0xd0, 0xd4, 0xd4, 0xce, 0xbf, 0x99,
+    0xb5, 0xd8, 0xd7, 0xd6, 0x9b, 0x83, 0x6a, 0x65, 0x5b, 0x5b, 0x53, 0x7f,
+    0x76, 0x4c, 0x42, 0x82, 0x37, 0x03, 0x31, 0x31, 0x2f, 0x2b, 0x81, 0x27,
+    0x00, 0x25, 0x80, 0x21, 0x80, 0x1b, 0x02, 0x1a, 0x1a, 0x19, 0x84, 0x17,
+    0x80, 0x15, 0x8b, 0x12, 0x03, 0x11, 0x11, 0x12, 0x12, 0x83, 0x0f, 0x04,
+    0x0e, 0x0f, 0x0f, 0x0e, 0x0e, 0x83, 0x0f, 0x80, 0x0b, 0x01, 0x0a, 0x0b,
+    0x80, 0x06, 0x03, 0x0b, 0x0a, 0x0b, 0x0b, 0x83, 0x06, 0x15, 0x10, 0x35,
+    0x66, 0x1f, 0x0a, 0x05, 0x06, 0x0a, 0x05, 0x07, 0x0a, 0x05, 0x0a, 0x0f,
+    0x2e, 0x84, 0x36, 0x4b, 0x76, 0x1d, 0x0c, 0x0d, 0x80, 0x03, 0x8e, 0x21,
+    0x01, 0x25, 0x25, 0x80, 0x21, 0x04, 0x25, 0x25, 0x23, 0x25, 0x25, 0x80,
+    0x27, 0x8e, 0x21, 0x00, 0x1d, 0x81, 0x21, 0x82, 0x1b, 0x93, 0x21, 0x09,
+    0x25, 0x25, 0x23, 0x23, 0x28, 0x2b, 0x28, 0x28, 0x25, 0x23, 0x89, 0x27,
+    0x01, 0x25, 0x25, 0x84, 0x27, 0x81, 0x2a, 0x09, 0x28, 0x28, 0x25, 0x28,
+    0x28, 0x2b, 0x2a, 0x28, 0x27, 0x2a, 0x80, 0x27, 0x01, 0x25, 0x25, 0x87,
+    0x27, 0x05, 0x2b, 0x28, 0x28, 0x2b, 0x2b, 0x2c, 0x82, 0x2a, 0x05, 0x39,
+    0x51, 0x8f, 0x7c, 0x4c, 0x3c, 0x80, 0x31, 0x00, 0x2c, 0x81, 0x31, 0x80,
+    0x37, 0x29, 0x41, 0x3c, 0x3d, 0x41, 0x41, 0x42, 0x42, 0x48, 0x4c, 0x4f,
+    0x54, 0x56, 0x6a, 0x9b, 0x80, 0x7f, 0xc6, 0x87, 0x75, 0xa6, 0xe2, 0xa4,
+    0xce, 0xb1, 0xea, 0xd0, 0xa4, 0xe0, 0xb4, 0xd8, 0xd6, 0xd6, 0x83, 0x78,
+    0x65, 0x5e, 0x5e, 0x68, 0x97, 0x53, 0x4c, 0x42, 0x80, 0x40, 0x01, 0x39,
+    0x39, 0x81, 0x31, 0x03, 0x2b, 0x2b, 0x28, 0x28, 0x81, 0x21, 0x81, 0x1b,
+    0x00, 0x1a, 0x81, 0x19, 0x02, 0x18, 0x19, 0x18, 0x81, 0x15, 0x83, 0x12,
+    0x01, 0x15, 0x15, 0x83, 0x12, 0x80, 0x0f, 0x80, 0x12, 0x81, 0x0f, 0x06,
+    0x0c, 0x0f, 0x0f, 0x0c, 0x0c, 0x0f, 0x0c, 0x81, 0x0f, 0x81, 0x0b, 0x82,
+    0x06, 0x03, 0x0b, 0x0b, 0x0a, 0x05, 0x81, 0x06, 0x16, 0x05, 0x08, 0x0f,
+    0x54, 0x49, 0x0f, 0x08, 0x05, 0x07, 0x05, 0x0a, 0x0a, 0x05, 0x05, 0x0c,
+    0x16, 0x52, 0x76, 0x85, 0x33, 0x10, 0x0a, 0x0a, 0x80, 0x03, 0x8e, 0x21,
+    0x01, 0x25, 0x25, 0x80, 0x21, 0x00, 0x25, 0x81, 0x21, 0x02, 0x25, 0x28,
+    0x25, 0x93, 0x21, 0x01, 0x1d, 0x21, 0x81, 0x1b, 0x01, 0x21, 0x1d, 0x90,
+    0x21, 0x00, 0x25, 0x80, 0x21, 0x01, 0x28, 0x2b, 0x82, 0x27, 0x00, 0x2a,
+    0x8c, 0x27, 0x80, 0x25, 0x00, 0x28, 0x80, 0x2a, 0x06, 0x28, 0x28, 0x25,
+    0x23, 0x27, 0x28, 0x2a, 0x80, 0x27, 0x00, 0x2a, 0x80, 0x27, 0x01, 0x23,
+    0x25, 0x87, 0x27, 0x13, 0x2a, 0x2a, 0x28, 0x28, 0x2b, 0x2b, 0x28, 0x2b,
+    0x2c, 0x2b, 0x2b, 0x36, 0x4c, 0xac, 0x7b, 0x53, 0x39, 0x35, 0x35, 0x36,
+    0x80, 0x31, 0x01, 0x35, 0x31, 0x82, 0x37, 0x2c, 0x3d, 0x3d, 0x41, 0x42,
+    0x42, 0x4c, 0x4c, 0x4f, 0x56, 0x65, 0x6e, 0x7d, 0x93, 0xe7, 0xa0, 0xb4,
+    0xd7, 0xd9, 0xdc, 0x99, 0xad, 0xce, 0xea, 0xd4, 0xc5, 0xb9, 0xa6, 0xd9,
+    0xd7, 0xd6, 0x9b, 0x83, 0x6a, 0x6a, 0x80, 0xa2, 0x70, 0x5b, 0x4c, 0x46,
+    0x42, 0x42, 0x41, 0x3c, 0x39, 0x81, 0x31, 0x03, 0x2c, 0x2b, 0x28, 0x27,
+    0x80, 0x25, 0x80, 0x21, 0x02, 0x1d, 0x1a, 0x1b, 0x80, 0x17, 0x03, 0x19,
+    0x19, 0x18, 0x18, 0x88, 0x15, 0x83, 0x12, 0x81, 0x0f, 0x80, 0x12, 0x81,
+    0x0f, 0x06, 0x0c, 0x0f, 0x0f, 0x0c, 0x0c, 0x0f, 0x0c, 0x81, 0x0f, 0x82,
+    0x0b, 0x81, 0x06, 0x80, 0x0b, 0x0c, 0x07, 0x08, 0x05, 0x05, 0x0a, 0x05,
+    0x0a, 0x0c, 0x4a, 0x49, 0x0a, 0x05, 0x0b, 0x81, 0x06, 0x09, 0x05, 0x06,
+    0x07, 0x0f, 0x47, 0xa9, 0x87, 0x20, 0x0c, 0x06, 0x81, 0x03, 0x99, 0x21,
+    0x01, 0x27, 0x25, 0x88, 0x21, 0x00, 0x1d, 0x80, 0x21, 0x00, 0x1d, 0x83,
+    0x21, 0x87, 0x1b, 0x91, 0x21, 0x02, 0x25, 0x28, 0x28, 0x80, 0x2a, 0x85,
+    0x27, 0x00, 0x25, 0x83, 0x27, 0x00, 0x25, 0x80, 0x21, 0x09, 0x25, 0x25,
+    0x27, 0x25, 0x27, 0x27, 0x25, 0x23, 0x23, 0x25, 0x86, 0x27, 0x80, 0x25,
+    0x02, 0x27, 0x2b, 0x2b, 0x81, 0x27, 0x00, 0x2b, 0x85, 0x27, 0x0c, 0x2b,
+    0x2c, 0x31, 0x2b, 0x2c, 0x31, 0x40, 0x52, 0x93, 0x8e, 0x46, 0x3c, 0x35,
+    0x80, 0x31, 0x03, 0x36, 0x36, 0x31, 0x36, 0x80, 0x37, 0x00, 0x3d, 0x80,
+    0x40, 0x00, 0x42, 0x80, 0x48, 0x28, 0x4f, 0x53, 0x6a, 0x7d, 0xa3, 0xbf,
+    0x91, 0xd8, 0x83, 0xd7, 0xd8, 0xb4, 0xdd, 0x9e, 0xca, 0xe9, 0xb2, 0xce,
+    0x9e, 0xdd, 0xb5, 0xd8, 0xd7, 0x9b, 0x9b, 0x83, 0x78, 0x81, 0xac, 0x67,
+    0x56, 0x4c, 0x48, 0x42, 0x42, 0x41, 0x41, 0x39, 0x39, 0x36, 0x31, 0x80,
+    0x2a, 0x82, 0x27, 0x00, 0x25, 0x80, 0x21, 0x80, 0x1b, 0x04, 0x1a, 0x18,
+    0x16, 0x18, 0x18, 0x88, 0x15, 0x84, 0x12, 0x83, 0x0f, 0x04, 0x12, 0x12,
+    0x10, 0x0f, 0x0c, 0x83, 0x0f, 0x85, 0x0b, 0x82, 0x06, 0x83, 0x0b, 0x0a,
+    0x0a, 0x05, 0x06, 0x07, 0x0b, 0x0f, 0x54, 0x49, 0x05, 0x05, 0x0b, 0x82,
+    0x06, 0x08, 0x05, 0x0a, 0x16, 0x5d, 0x69, 0x7b, 0x19, 0x0a, 0x0a, 0x81,
+    0x03, 0x99, 0x21, 0x01, 0x27, 0x27, 0x88, 0x21, 0x00, 0x1d, 0x80, 0x21,
+    0x00, 0x1d, 0x80, 0x21, 0x89, 0x1b, 0x91, 0x21, 0x01, 0x25, 0x27, 0x80,
+    0x2a, 0x03, 0x28, 0x2b, 0x28, 0x25, 0x83, 0x27, 0x0a, 0x25, 0x27, 0x2a,
+    0x28, 0x28, 0x2b, 0x28, 0x23, 0x27, 0x28, 0x25, 0x80, 0x27, 0x05, 0x25,
+    0x25, 0x27, 0x28, 0x25, 0x25, 0x81, 0x27, 0x03, 0x2a, 0x28, 0x28, 0x2a,
+    0x83, 0x27, 0x01, 0x2b, 0x2b, 0x8a, 0x27, 0x00, 0x2b, 0x80, 0x2c, 0x08,
+    0x31, 0x31, 0x35, 0x42, 0x4e, 0x93, 0x85, 0x41, 0x39, 0x80, 0x31, 0x03,
+    0x36, 0x36, 0x34, 0x36, 0x80, 0x37, 0x00, 0x3d, 0x80, 0x40, 0x0a, 0x42,
+    0x42, 0x46, 0x4c, 0x4c, 0x56, 0x6a, 0x8a, 0xe6, 0x84, 0x95, 0x80, 0x9b,
+    0x14, 0xd7, 0xb5, 0x9e, 0xc9, 0xcb, 0xd2, 0xd5, 0xd2, 0xa5, 0x97, 0xde,
+    0xb4, 0xd8, 0xb3, 0xd6, 0x83, 0x83, 0x5e, 0x93, 0x68, 0x56, 0x80, 0x48,
+    0x05, 0x42, 0x42, 0x41, 0x3c, 0x39, 0x36, 0x80, 0x31, 0x01, 0x2f, 0x2b,
+    0x81, 0x27, 0x00, 0x25, 0x80, 0x21, 0x80, 0x1b, 0x04, 0x1a, 0x18, 0x16,
+    0x18, 0x18, 0x88, 0x15, 0x85, 0x12, 0x82, 0x0f, 0x00, 0x12, 0x8a, 0x0f,
+    0x01, 0x0e, 0x0f, 0x82, 0x0b, 0x80, 0x06, 0x83, 0x0b, 0x01, 0x0a, 0x05,
+    0x80, 0x06, 0x04, 0x0f, 0x5f, 0x3c, 0x04, 0x05, 0x84, 0x06, 0x08, 0x12,
+    0x2e, 0x8c, 0x3d, 0x76, 0x20, 0x0a, 0x0b, 0x06, 0x80, 0x03, 0x99, 0x21,
+    0x01, 0x27, 0x25, 0x8e, 0x21, 0x8a, 0x1b, 0x92, 0x21, 0x03, 0x25, 0x28,
+    0x2b, 0x2b, 0x81, 0x27, 0x01, 0x23, 0x23, 0x82, 0x27, 0x00, 0x25, 0x81,
+    0x27, 0x04, 0x2a, 0x28, 0x25, 0x28, 0x2b, 0x82, 0x27, 0x00, 0x25, 0x84,
+    0x27, 0x06, 0x2a, 0x2d, 0x2b, 0x2b, 0x28, 0x2b, 0x28, 0x82, 0x2a, 0x88,
+    0x27, 0x02, 0x2c, 0x2b, 0x28, 0x81, 0x2a, 0x00, 0x28, 0x80, 0x31, 0x0a,
+    0x41, 0x62, 0xbf, 0x58, 0x39, 0x31, 0x35, 0x34, 0x36, 0x36, 0x34, 0x81,
+    0x37, 0x02, 0x3d, 0x41, 0x41, 0x81, 0x42, 0x25, 0x48, 0x4f, 0x5b, 0x80,
+    0xc0, 0x85, 0x83, 0x78, 0x6a, 0x83, 0xd6, 0xd6, 0xa6, 0xad, 0xa4, 0x9f,
+    0xc8, 0xd4, 0xd4, 0xcf, 0xc3, 0x9f, 0x98, 0xb4, 0xd7, 0xd6, 0x83, 0x9b,
+    0x6e, 0x93, 0x6d, 0x5b, 0x4f, 0x4c, 0x48, 0x42, 0x42, 0x41, 0x80, 0x37,
+    0x00, 0x36, 0x81, 0x31, 0x00, 0x2b, 0x82, 0x27, 0x00, 0x25, 0x80, 0x21,
+    0x00, 0x1b, 0x82, 0x17, 0x01, 0x15, 0x18, 0x86, 0x15, 0x86, 0x12, 0x86,
+    0x0f, 0x8c, 0x0b, 0x02, 0x0a, 0x0b, 0x0b, 0x80, 0x06, 0x81, 0x0b, 0x09,
+    0x0a, 0x05, 0x05, 0x07, 0x0a, 0x0f, 0x54, 0x3e, 0x0b, 0x0a, 0x80, 0x03,
+    0x80, 0x06, 0x08, 0x0f, 0x14, 0x5d, 0x52, 0x1d, 0x60, 0x32, 0x0a, 0x0a,
+    0x81, 0x03, 0x8f, 0x21, 0x00, 0x25, 0x85, 0x21, 0x02, 0x25, 0x28, 0x25,
+    0x86, 0x21, 0x00, 0x25, 0x81, 0x21, 0x01, 0x1d, 0x21, 0x80, 0x1b, 0x00,
+    0x21, 0x87, 0x1b, 0x93, 0x21, 0x84, 0x27, 0x02, 0x25, 0x25, 0x28, 0x83,
+    0x25, 0x80, 0x27, 0x00, 0x2a, 0x80, 0x27, 0x00, 0x2b, 0x8b, 0x27, 0x07,
+    0x2c, 0x2b, 0x2b, 0x28, 0x2a, 0x28, 0x2a, 0x2c, 0x80, 0x2a, 0x83, 0x27,
+    0x81, 0x2a, 0x02, 0x28, 0x2b, 0x2c, 0x82, 0x2a, 0x00, 0x28, 0x80, 0x31,
+    0x0a, 0x41, 0x60, 0xbf, 0x55, 0x39, 0x31, 0x38, 0x34, 0x39, 0x37, 0x36,
+    0x81, 0x37, 0x03, 0x3d, 0x41, 0x41, 0x42, 0x81, 0x48, 0x25, 0x56, 0x6c,
+    0x86, 0xca, 0x76, 0x6e, 0x65, 0x65, 0x6c, 0x83, 0x83, 0xb4, 0xa4, 0xb6,
+    0xa7, 0xa4, 0xd0, 0xe9, 0xb2, 0xd3, 0xc8, 0xa2, 0x98, 0xd9, 0xd7, 0x95,
+    0x9b, 0x90, 0xa2, 0x6c, 0x5b, 0x4f, 0x4c, 0x48, 0x42, 0x41, 0x41, 0x3d,
+    0x81, 0x37, 0x02, 0x36, 0x34, 0x31, 0x80, 0x2a, 0x81, 0x27, 0x07, 0x25,
+    0x22, 0x22, 0x1d, 0x1b, 0x19, 0x18, 0x19, 0x83, 0x17, 0x83, 0x15, 0x87,
+    0x12, 0x85, 0x0f, 0x8c, 0x0b, 0x02, 0x0a, 0x0b, 0x0b, 0x83, 0x06, 0x02,
+    0x0b, 0x0a, 0x05, 0x80, 0x06, 0x13, 0x0f, 0x54, 0x47, 0x0a, 0x05, 0x05,
+    0x06, 0x05, 0x05, 0x0a, 0x0b, 0x0f, 0x25, 0x8e, 0x2e, 0x19, 0x55, 0x5d,
+    0x16, 0x0a, 0x81, 0x03, 0x82, 0x21, 0x00, 0x25, 0x93, 0x21, 0x01, 0x27,
+    0x25, 0x82, 0x21, 0x00, 0x25, 0x80, 0x21, 0x00, 0x25, 0x81, 0x21, 0x81,
+    0x1b, 0x80, 0x21, 0x85, 0x1b, 0x00, 0x21, 0x82, 0x1b, 0x8f, 0x21, 0x86,
+    0x27, 0x02, 0x25, 0x23, 0x23, 0x80, 0x25, 0x04, 0x28, 0x28, 0x25, 0x27,
+    0x28, 0x80, 0x2a, 0x84, 0x27, 0x00, 0x2a, 0x83, 0x27, 0x80, 0x2a, 0x88,
+    0x27, 0x83, 0x2a, 0x02, 0x28, 0x28, 0x2b, 0x80, 0x2c, 0x01, 0x2b, 0x2c,
+    0x81, 0x31, 0x05, 0x35, 0x4a, 0x77, 0x93, 0x4a, 0x39, 0x80, 0x31, 0x84,
+    0x37, 0x03, 0x3d, 0x41, 0x41, 0x42, 0x80, 0x48, 0x27, 0x4f, 0x56, 0x67,
+    0xa0, 0xbc, 0x73, 0x65, 0x66, 0x6a, 0x74, 0x95, 0x98, 0xba, 0xb8, 0xb5,
+    0xb5, 0xb8, 0xbe, 0xc8, 0xeb, 0xb2, 0xb2, 0xc8, 0x9e, 0xdc, 0xd8, 0xd7,
+    0x83, 0x87, 0x9e, 0x6a, 0x5f, 0x53, 0x51, 0x4c, 0x48, 0x42, 0x41, 0x41,
+    0x3d, 0x81, 0x37, 0x04, 0x36, 0x31, 0x31, 0x2b, 0x2b, 0x82, 0x27, 0x80,
+    0x21, 0x00, 0x1b, 0x80, 0x17, 0x00, 0x19, 0x82, 0x17, 0x83, 0x15, 0x87,
+    0x12, 0x81, 0x0f, 0x01, 0x0e, 0x0c, 0x80, 0x0f, 0x8a, 0x0b, 0x80, 0x06,
+    0x00, 0x0b, 0x80, 0x06, 0x03, 0x05, 0x0a, 0x0a, 0x0b, 0x81, 0x03, 0x05,
+    0x0a, 0x0f, 0x3c, 0x5a, 0x1b, 0x0f, 0x80, 0x03, 0x0c, 0x07, 0x0a, 0x0b,
+    0x1a, 0x60, 0x59, 0x14, 0x12, 0x2c, 0x76, 0x60, 0x19, 0x0b, 0x80, 0x03,
+    0x80, 0x21, 0x82, 0x25, 0x82, 0x21, 0x00, 0x25, 0x8b, 0x21, 0x04, 0x27,
+    0x25, 0x23, 0x23, 0x25, 0x83, 0x21, 0x00, 0x25, 0x82, 0x21, 0x80, 0x1b,
+    0x81, 0x21, 0x02, 0x1d, 0x21, 0x21, 0x86, 0x1b, 0x8b, 0x21, 0x01, 0x25,
+    0x25, 0x80, 0x21, 0x00, 0x27, 0x80, 0x25, 0x83, 0x27, 0x08, 0x25, 0x23,
+    0x23, 0x25, 0x25, 0x28, 0x25, 0x23, 0x25, 0x81, 0x2a, 0x05, 0x28, 0x25,
+    0x27, 0x28, 0x2a, 0x2a, 0x80, 0x27, 0x01, 0x2b, 0x2a, 0x80, 0x27, 0x04,
+    0x2b, 0x2b, 0x28, 0x27, 0x23, 0x81, 0x27, 0x04, 0x25, 0x28, 0x28, 0x2b,
+    0x28, 0x80, 0x2a, 0x02, 0x31, 0x2c, 0x2a, 0x80, 0x27, 0x0e, 0x2b, 0x31,
+    0x31, 0x2b, 0x2a, 0x28, 0x2b, 0x2c, 0x31, 0x37, 0x42, 0x85, 0x72, 0x41,
+    0x3c, 0x80, 0x31, 0x00, 0x36, 0x83, 0x37, 0x02, 0x3d, 0x41, 0x41, 0x81,
+    0x42, 0x21, 0x4c, 0x56, 0x71, 0xcc, 0x7f, 0x6a, 0x5e, 0x5b, 0x65, 0x83,
+    0x80, 0x9f, 0x8d, 0x95, 0xd7, 0xd8, 0xa6, 0xb7, 0xaa, 0xc6, 0xd3, 0xd5,
+    0xd2, 0xbe, 0xb7, 0xb4, 0xd8, 0x96, 0xbe, 0x91, 0x74, 0x6a, 0x5b, 0x51,
+    0x80, 0x48, 0x02, 0x42, 0x42, 0x41, 0x81, 0x37, 0x04, 0x36, 0x31, 0x31,
+    0x2b, 0x2b, 0x81, 0x27, 0x00, 0x25, 0x80, 0x21, 0x00, 0x1d, 0x85, 0x17,
+    0x84, 0x15, 0x87, 0x12, 0x82, 0x0f, 0x01, 0x0c, 0x0c, 0x83, 0x0f, 0x86,
+    0x0b, 0x03, 0x0a, 0x0a, 0x0b, 0x0b, 0x80, 0x06, 0x03, 0x05, 0x0a, 0x0a,
+    0x0b, 0x82, 0x03, 0x17, 0x08, 0x12, 0x54, 0x5a, 0x42, 0x1a, 0x0a, 0x05,
+    0x07, 0x0a, 0x12, 0x45, 0x77, 0x18, 0x0b, 0x07, 0x11, 0x25, 0x5d, 0x62,
+    0x14, 0x05, 0x06, 0x05, 0x80, 0x21, 0x04, 0x25, 0x25, 0x27, 0x25, 0x25,
+    0x85, 0x21, 0x01, 0x25, 0x25, 0x83, 0x21, 0x00, 0x25, 0x81, 0x21, 0x81,
+    0x25, 0x88, 0x21, 0x01, 0x1d, 0x21, 0x80, 0x1b, 0x80, 0x21, 0x08, 0x1d,
+    0x22, 0x21, 0x1d, 0x1d, 0x21, 0x21, 0x1b, 0x1b, 0x8f, 0x21, 0x00, 0x25,
+    0x80, 0x21, 0x03, 0x28, 0x27, 0x23, 0x25, 0x8a, 0x27, 0x09, 0x23, 0x25,
+    0x28, 0x2a, 0x2b, 0x28, 0x28, 0x25, 0x23, 0x23, 0x82, 0x27, 0x01, 0x2a,
+    0x2a, 0x80, 0x27, 0x00, 0x2a, 0x80, 0x27, 0x01, 0x25, 0x25, 0x81, 0x27,
+    0x83, 0x2a, 0x19, 0x31, 0x31, 0x2c, 0x2b, 0x2b, 0x28, 0x28, 0x2a, 0x31,
+    0x31, 0x2b, 0x2a, 0x28, 0x2b, 0x2c, 0x31, 0x3c, 0x4d, 0xac, 0x62, 0x3c,
+    0x35, 0x2c, 0x36, 0x34, 0x34, 0x83, 0x37, 0x80, 0x40, 0x01, 0x42, 0x42,
+    0x80, 0x48, 0x03, 0x65, 0x72, 0xe6, 0x67, 0x80, 0x56, 0x1a, 0x66, 0x6c,
+    0x80, 0x9f, 0x91, 0x83, 0xd7, 0xd7, 0xd9, 0x90, 0xb7, 0xa4, 0xce, 0xb2,
+    0xb1, 0xc6, 0xb9, 0xdc, 0x90, 0x9e, 0x92, 0x80, 0x83, 0x5e, 0x5b, 0x51,
+    0x4f, 0x80, 0x48, 0x01, 0x42, 0x41, 0x81, 0x37, 0x00, 0x36, 0x80, 0x31,
+    0x01, 0x2b, 0x2b, 0x80, 0x27, 0x81, 0x21, 0x80, 0x1b, 0x01, 0x1a, 0x19,
+    0x81, 0x17, 0x86, 0x15, 0x86, 0x12, 0x0a, 0x11, 0x12, 0x11, 0x0f, 0x0c,
+    0x0c, 0x0f, 0x0c, 0x0c, 0x0f, 0x0f, 0x87, 0x0b, 0x85, 0x06, 0x02, 0x05,
+    0x07, 0x05, 0x81, 0x06, 0x19, 0x05, 0x05, 0x0a, 0x14, 0x1d, 0x40, 0x5b,
+    0x19, 0x04, 0x0a, 0x0b, 0x1d, 0x71, 0x32, 0x0b, 0x07, 0x06, 0x0b, 0x11,
+    0x1a, 0x5d, 0x32, 0x0a, 0x05, 0x05, 0x25, 0x81, 0x21, 0x80, 0x25, 0x85,
+    0x21, 0x00, 0x25, 0x89, 0x21, 0x00, 0x25, 0x8d, 0x21, 0x01, 0x1f, 0x1d,
+    0x84, 0x21, 0x02, 0x1d, 0x1d, 0x21, 0x80, 0x1b, 0x80, 0x21, 0x00, 0x1d,
+    0x8f, 0x21, 0x03, 0x28, 0x28, 0x23, 0x25, 0x88, 0x27, 0x01, 0x25, 0x25,
+    0x80, 0x27, 0x03, 0x2a, 0x28, 0x27, 0x25, 0x81, 0x21, 0x01, 0x27, 0x25,
+    0x82, 0x27, 0x00, 0x25, 0x88, 0x27, 0x02, 0x2b, 0x2c, 0x2c, 0x80, 0x27,
+    0x08, 0x31, 0x2c, 0x2b, 0x2b, 0x28, 0x2a, 0x2a, 0x28, 0x28, 0x80, 0x2a,
+    0x80, 0x31, 0x0a, 0x35, 0x3c, 0x82, 0x8e, 0x46, 0x40, 0x37, 0x31, 0x39,
+    0x34, 0x36, 0x83, 0x37, 0x02, 0x3d, 0x41, 0x41, 0x80, 0x42, 0x23, 0x4c,
+    0x56, 0x67, 0xbc, 0x8e, 0x65, 0x51, 0x51, 0x5b, 0x5b, 0x65, 0x90, 0xaf,
+    0xa9, 0xd9, 0x9b, 0xd6, 0xd7, 0xd9, 0xdc, 0xe3, 0xcd, 0xd4, 0xea, 0xc8,
+    0xbb, 0x91, 0x8e, 0xa2, 0x7d, 0x95, 0x83, 0x6a, 0x5b, 0x56, 0x51, 0x81,
+    0x48, 0x01, 0x42, 0x3d, 0x80, 0x37, 0x05, 0x36, 0x36, 0x34, 0x31, 0x2f,
+    0x2b, 0x81, 0x27, 0x80, 0x21, 0x80, 0x1b, 0x02, 0x1a, 0x1a, 0x19, 0x82,
+    0x17, 0x84, 0x15, 0x85, 0x12, 0x02, 0x11, 0x11, 0x12, 0x82, 0x0f, 0x03,
+    0x0c, 0x0c, 0x0f, 0x0f, 0x85, 0x0b, 0x8e, 0x06, 0x1b, 0x05, 0x05, 0x08,
+    0x06, 0x05, 0x12, 0x5f, 0x24, 0x10, 0x11, 0x14, 0x45, 0x5d, 0x11, 0x05,
+    0x05, 0x07, 0x0a, 0x0f, 0x11, 0x60, 0x26, 0x07, 0x03, 0x05, 0x25, 0x23,
+    0x25, 0x80, 0x21, 0x01, 0x25, 0x25, 0x85, 0x21, 0x00, 0x25, 0x89, 0x21,
+    0x00, 0x25, 0x82, 0x21, 0x00, 0x25, 0x86, 0x21, 0x80, 0x1b, 0x82, 0x21,
+    0x85, 0x1b, 0x81, 0x21, 0x00, 0x1d, 0x8e, 0x21, 0x03, 0x27, 0x25, 0x23,
+    0x25, 0x84, 0x27, 0x01, 0x2b, 0x2b, 0x87, 0x27, 0x82, 0x21, 0x01, 0x25,
+    0x25, 0x81, 0x27, 0x02, 0x25, 0x23, 0x25, 0x87, 0x27, 0x80, 0x2a, 0x80,
+    0x27, 0x01, 0x2c, 0x2c, 0x83, 0x2a, 0x01, 0x28, 0x2b, 0x82, 0x31, 0x0b,
+    0x35, 0x3c, 0x77, 0xa2, 0x58, 0x42, 0x37, 0x38, 0x34, 0x39, 0x37, 0x36,
+    0x82, 0x37, 0x0d, 0x3d, 0x3d, 0x41, 0x41, 0x3d, 0x40, 0x48, 0x4f, 0x7d,
+    0xae, 0x84, 0x6a, 0x53, 0x51, 0x80, 0x56, 0x1f, 0x73, 0x98, 0x97, 0x90,
+    0x83, 0xd6, 0xd6, 0xd7, 0xb5, 0xe1, 0xaf, 0xe9, 0xea, 0xcf, 0xc2, 0xa4,
+    0xa5, 0x7f, 0xd7, 0xd6, 0x83, 0x78, 0x6a, 0x65, 0x56, 0x51, 0x4f, 0x4f,
+    0x4c, 0x4a, 0x42, 0x3d, 0x81, 0x37, 0x80, 0x31, 0x80, 0x2a, 0x01, 0x28,
+    0x27, 0x80, 0x21, 0x81, 0x1b, 0x80, 0x17, 0x00, 0x19, 0x80, 0x17, 0x84,
+    0x15, 0x85, 0x12, 0x85, 0x0f, 0x02, 0x0c, 0x0c, 0x0f, 0x89, 0x0b, 0x02,
+    0x0a, 0x0a, 0x0b, 0x82, 0x06, 0x00, 0x05, 0x80, 0x06, 0x82, 0x03, 0x0a,
+    0x0b, 0x06, 0x11, 0x5a, 0x25, 0x11, 0x1a, 0x4d, 0x76, 0x3b, 0x0c, 0x80,
+    0x06, 0x0d, 0x0b, 0x0f, 0x45, 0x7b, 0x17, 0x0b, 0x05, 0x04, 0x23, 0x23,
+    0x25, 0x23, 0x23, 0x25, 0x88, 0x21, 0x00, 0x25, 0x8e, 0x21, 0x00, 0x25,
+    0x86, 0x21, 0x01, 0x1d, 0x1d, 0x83, 0x21, 0x89, 0x1b, 0x8f, 0x21, 0x00,
+    0x27, 0x80, 0x21, 0x85, 0x27, 0x01, 0x2b, 0x2b, 0x81, 0x27, 0x00, 0x2b,
+    0x80, 0x27, 0x00, 0x25, 0x80, 0x21, 0x03, 0x25, 0x27, 0x25, 0x25, 0x81,
+    0x27, 0x01, 0x25, 0x25, 0x88, 0x27, 0x00, 0x2b, 0x80, 0x27, 0x82, 0x2a,
+    0x00, 0x2c, 0x81, 0x2a, 0x01, 0x2c, 0x2b, 0x82, 0x31, 0x0c, 0x2e, 0x41,
+    0x81, 0x99, 0xac, 0x69, 0x48, 0x39, 0x31, 0x37, 0x36, 0x34, 0x36, 0x81,
+    0x37, 0x31, 0x3d, 0x41, 0x41, 0x42, 0x41, 0x42, 0x4c, 0x51, 0x7a, 0xc8,
+    0x7f, 0x6c, 0x56, 0x51, 0x5b, 0x5e, 0x65, 0x6a, 0x67, 0x9e, 0x9d, 0x83,
+    0xd6, 0xd6, 0xb3, 0xd9, 0xa7, 0xa4, 0xd0, 0xb2, 0xd4, 0xd1, 0xcd, 0x9f,
+    0xdd, 0xd9, 0xb3, 0xd6, 0x9b, 0x78, 0x6a, 0x65, 0x5b, 0x53, 0x4f, 0x4c,
+    0x48, 0x42, 0x42, 0x41, 0x80, 0x37, 0x00, 0x36, 0x80, 0x31, 0x01, 0x2b,
+    0x2b, 0x81, 0x27, 0x05, 0x22, 0x22, 0x1d, 0x21, 0x1d, 0x1b, 0x83, 0x17,
+    0x84, 0x15, 0x85, 0x12, 0x85, 0x0f, 0x02, 0x0c, 0x0f, 0x0f, 0x86, 0x0b,
+    0x87, 0x06, 0x02, 0x05, 0x05, 0x0a, 0x86, 0x03, 0x19, 0x11, 0x58, 0x25,
+    0x19, 0x60, 0x68, 0x29, 0x12, 0x06, 0x05, 0x05, 0x0a, 0x18, 0x52, 0x7f,
+    0x32, 0x0f, 0x0a, 0x04, 0x05, 0x23, 0x23, 0x25, 0x23, 0x23, 0x25, 0x88,
+    0x21, 0x00, 0x25, 0x8d, 0x21, 0x01, 0x27, 0x25, 0x86, 0x21, 0x01, 0x1d,
+    0x1d, 0x81, 0x21, 0x82, 0x1b, 0x04, 0x21, 0x21, 0x1d, 0x1a, 0x1a, 0x81,
+    0x1b, 0x8f, 0x21, 0x05, 0x25, 0x25, 0x23, 0x23, 0x27, 0x2a, 0x83, 0x27,
+    0x01, 0x2c, 0x2c, 0x81, 0x27, 0x06, 0x2c, 0x2b, 0x28, 0x27, 0x25, 0x23,
+    0x23, 0x80, 0x27, 0x01, 0x23, 0x25, 0x83, 0x27, 0x06, 0x2a, 0x2b, 0x28,
+    0x27, 0x25, 0x2a, 0x2a, 0x85, 0x27, 0x03, 0x2b, 0x2b, 0x28, 0x28, 0x82,
+    0x2a, 0x84, 0x31, 0x0d, 0x35, 0x39, 0x54, 0x7e, 0x53, 0x6b, 0xbe, 0x68,
+    0x3d, 0x39, 0x37, 0x36, 0x34, 0x36, 0x81, 0x37, 0x2c, 0x41, 0x41, 0x3d,
+    0x42, 0x3c, 0x41, 0x4c, 0x56, 0x6f, 0xcc, 0x7c, 0x6e, 0x5b, 0x4f, 0x56,
+    0x56, 0x53, 0x6a, 0x81, 0xe3, 0x81, 0x83, 0xd6, 0xd6, 0x95, 0xd8, 0xdb,
+    0xb9, 0xc6, 0xd1, 0xea, 0xea, 0xd1, 0xad, 0xb7, 0xb5, 0xd7, 0xd6, 0x83,
+    0x83, 0x6c, 0x65, 0x5b, 0x56, 0x4f, 0x80, 0x48, 0x02, 0x42, 0x41, 0x3d,
+    0x80, 0x37, 0x81, 0x31, 0x06, 0x2b, 0x2a, 0x28, 0x28, 0x25, 0x22, 0x21,
+    0x82, 0x1b, 0x04, 0x1a, 0x1a, 0x19, 0x18, 0x18, 0x82, 0x15, 0x02, 0x14,
+    0x15, 0x15, 0x84, 0x12, 0x83, 0x0f, 0x80, 0x0b, 0x01, 0x0f, 0x0f, 0x86,
+    0x0b, 0x01, 0x0a, 0x0b, 0x85, 0x06, 0x02, 0x05, 0x05, 0x0a, 0x84, 0x03,
+    0x15, 0x08, 0x0c, 0x1f, 0x6d, 0x1d, 0x1f, 0x77, 0x20, 0x10, 0x06, 0x09,
+    0x05, 0x03, 0x0a, 0x3b, 0x82, 0x28, 0x0f, 0x0b, 0x0b, 0x0a, 0x05, 0x80,
+    0x21, 0x01, 0x25, 0x25, 0x89, 0x21, 0x00, 0x25, 0x8c, 0x21, 0x01, 0x25,
+    0x25, 0x87, 0x21, 0x00, 0x1d, 0x82, 0x21, 0x82, 0x1b, 0x04, 0x21, 0x21,
+    0x1d, 0x1a, 0x1a, 0x81, 0x1b, 0x8f, 0x21, 0x04, 0x25, 0x23, 0x23, 0x25,
+    0x25, 0x83, 0x27, 0x01, 0x2a, 0x2b, 0x87, 0x27, 0x00, 0x25, 0x83, 0x27,
+    0x03, 0x25, 0x25, 0x28, 0x28, 0x80, 0x2a, 0x81, 0x27, 0x00, 0x2a, 0x80,
+    0x27, 0x01, 0x2b, 0x2b, 0x81, 0x27, 0x08, 0x2b, 0x2b, 0x28, 0x2b, 0x2c,
+    0x2b, 0x2b, 0x31, 0x2b, 0x83, 0x31, 0x0e, 0x35, 0x3d, 0x5f, 0x65, 0x42,
+    0x42, 0x4c, 0x8a, 0x72, 0x48, 0x41, 0x37, 0x34, 0x34, 0x36, 0x82, 0x37,
+    0x80, 0x40, 0x09, 0x3d, 0x42, 0x4a, 0x53, 0x61, 0x94, 0xe8, 0x86, 0x5e,
+    0x54, 0x81, 0x56, 0x20, 0xa7, 0x90, 0x6c, 0x74, 0x83, 0xd6, 0xd6, 0xd7,
+    0xb4, 0xde, 0x9f, 0xca, 0xd3, 0xb2, 0xd4, 0xc6, 0xa9, 0xdd, 0xd8, 0xd7,
+    0xd6, 0x83, 0x6a, 0x65, 0x5e, 0x53, 0x4f, 0x4f, 0x4c, 0x48, 0x46, 0x42,
+    0x41, 0x80, 0x37, 0x81, 0x31, 0x01, 0x2b, 0x2b, 0x80, 0x27, 0x82, 0x21,
+    0x04, 0x1b, 0x1b, 0x1a, 0x1a, 0x19, 0x81, 0x17, 0x82, 0x15, 0x83, 0x12,
+    0x81, 0x0f, 0x00, 0x0c, 0x81, 0x0f, 0x89, 0x0b, 0x02, 0x0a, 0x0a, 0x0b,
+    0x88, 0x06, 0x82, 0x03, 0x0a, 0x0a, 0x02, 0x0a, 0x15, 0x58, 0x49, 0x12,
+    0x2e, 0x71, 0x14, 0x0b, 0x80, 0x03, 0x09, 0x0a, 0x0b, 0x26, 0x60, 0x12,
+    0x0c, 0x0b, 0x08, 0x05, 0x05, 0xa9, 0x21, 0x06, 0x1d, 0x1d, 0x22, 0x22,
+    0x1d, 0x21, 0x22, 0x8e, 0x1b, 0x80, 0x21, 0x00, 0x1d, 0x8d, 0x21, 0x00,
+    0x25, 0x82, 0x27, 0x08, 0x2a, 0x28, 0x27, 0x25, 0x28, 0x27, 0x23, 0x23,
+    0x25, 0x87, 0x27, 0x04, 0x25, 0x23, 0x25, 0x28, 0x2b, 0x85, 0x27, 0x00,
+    0x25, 0x87, 0x2a, 0x08, 0x31, 0x31, 0x2c, 0x31, 0x31, 0x2b, 0x2c, 0x2c,
+    0x31, 0x80, 0x2a, 0x02, 0x39, 0x66, 0x5b, 0x80, 0x37, 0x05, 0x4c, 0x71,
+    0xc5, 0x64, 0x42, 0x39, 0x80, 0x31, 0x82, 0x37, 0x01, 0x3d, 0x40, 0x80,
+    0x42, 0x0f, 0x4a, 0x51, 0x5e, 0x88, 0xc5, 0x75, 0x5e, 0x56, 0x53, 0x56,
+    0x5e, 0x7d, 0xa6, 0x6c, 0x74, 0x78, 0x80, 0x9b, 0x14, 0xd7, 0xd8, 0xb5,
+    0x9e, 0xc9, 0xe8, 0xb2, 0xe9, 0xe6, 0xe4, 0xb7, 0xa6, 0xd8, 0x83, 0x83,
+    0x74, 0x6a, 0x65, 0x56, 0x54, 0x4f, 0x80, 0x48, 0x01, 0x42, 0x41, 0x80,
+    0x37, 0x04, 0x36, 0x36, 0x34, 0x31, 0x2b, 0x82, 0x27, 0x00, 0x25, 0x80,
+    0x21, 0x00, 0x1d, 0x85, 0x17, 0x82, 0x15, 0x83, 0x12, 0x81, 0x0f, 0x00,
+    0x0c, 0x81, 0x0f, 0x89, 0x0b, 0x03, 0x0a, 0x0a, 0x0b, 0x0b, 0x81, 0x06,
+    0x80, 0x0b, 0x01, 0x0a, 0x07, 0x84, 0x03, 0x09, 0x01, 0x11, 0x50, 0x4d,
+    0x15, 0x0f, 0x2e, 0x77, 0x14, 0x0b, 0x81, 0x03, 0x0c, 0x07, 0x26, 0x71,
+    0x11, 0x0b, 0x05, 0x0a, 0x04, 0x05, 0x23, 0x23, 0x25, 0x25, 0x88, 0x21,
+    0x00, 0x25, 0x9a, 0x21, 0x03, 0x1d, 0x22, 0x22, 0x1d, 0x80, 0x21, 0x8f,
+    0x1b, 0x01, 0x22, 0x1d, 0x8b, 0x21, 0x80, 0x25, 0x01, 0x28, 0x2a, 0x86,
+    0x27, 0x02, 0x23, 0x23, 0x25, 0x88, 0x27, 0x04, 0x25, 0x25, 0x28, 0x28,
+    0x2a, 0x84, 0x27, 0x03, 0x25, 0x28, 0x2b, 0x2c, 0x81, 0x2a, 0x02, 0x31,
+    0x2f, 0x2c, 0x82, 0x31, 0x11, 0x2a, 0x2b, 0x31, 0x36, 0x39, 0x3d, 0x42,
+    0x6a, 0x66, 0x41, 0x35, 0x34, 0x36, 0x4c, 0x61, 0x94, 0xa2, 0x4c, 0x80,
+    0x37, 0x00, 0x36, 0x84, 0x37, 0x2a, 0x41, 0x42, 0x42, 0x4c, 0x56, 0x80,
+    0x85, 0xc5, 0x86, 0x5e, 0x56, 0x54, 0x4f, 0x56, 0x96, 0x9d, 0x6a, 0x65,
+    0x65, 0x78, 0xd6, 0x83, 0x81, 0x8b, 0x92, 0xa4, 0xa1, 0xca, 0xd4, 0xb2,
+    0xc8, 0xa1, 0xb8, 0xa7, 0xdc, 0x9d, 0x9b, 0x83, 0x6e, 0x65, 0x56, 0x53,
+    0x51, 0x80, 0x48, 0x02, 0x42, 0x41, 0x3d, 0x81, 0x37, 0x03, 0x36, 0x35,
+    0x2c, 0x2b, 0x82, 0x27, 0x80, 0x21, 0x01, 0x1d, 0x1c, 0x85, 0x17, 0x81,
+    0x15, 0x83, 0x12, 0x86, 0x0f, 0x82, 0x0b, 0x00, 0x0a, 0x82, 0x0b, 0x01,
+    0x0a, 0x0a, 0x80, 0x0b, 0x09, 0x0a, 0x0a, 0x0b, 0x07, 0x0a, 0x0b, 0x0a,
+    0x07, 0x05, 0x07, 0x84, 0x03, 0x08, 0x18, 0x66, 0x1a, 0x07, 0x11, 0x52,
+    0x5d, 0x0c, 0x06, 0x80, 0x03, 0x06, 0x06, 0x0a, 0x1f, 0x71, 0x2e, 0x10,
+    0x0b, 0x80, 0x03, 0x02, 0x23, 0x23, 0x25, 0xa7, 0x21, 0x00, 0x1d, 0x80,
+    0x21, 0x00, 0x1d, 0x80, 0x21, 0x90, 0x1b, 0x8d, 0x21, 0x01, 0x25, 0x25,
+    0x83, 0x27, 0x04, 0x25, 0x2a, 0x2b, 0x28, 0x25, 0x8b, 0x27, 0x00, 0x25,
+    0x89, 0x27, 0x00, 0x2c, 0x81, 0x2a, 0x1a, 0x2c, 0x31, 0x31, 0x2b, 0x2f,
+    0x31, 0x31, 0x2c, 0x31, 0x31, 0x36, 0x41, 0x54, 0x67, 0x6a, 0x5f, 0x4f,
+    0x39, 0x31, 0x36, 0x36, 0x41, 0x58, 0x7b, 0xa2, 0x5d, 0x41, 0x88, 0x37,
+    0x27, 0x41, 0x42, 0x42, 0x4c, 0x53, 0x6a, 0x81, 0xe6, 0x7b, 0x5e, 0x4f,
+    0x53, 0x56, 0x56, 0x6c, 0xde, 0x80, 0x65, 0x5b, 0x74, 0x78, 0xa6, 0x97,
+    0x99, 0xa7, 0xde, 0xe1, 0xc6, 0xeb, 0xea, 0xeb, 0xc6, 0x97, 0xdd, 0xb5,
+    0xd8, 0xd6, 0xd6, 0x83, 0x6a, 0x80, 0x56, 0x00, 0x51, 0x80, 0x48, 0x02,
+    0x41, 0x41, 0x3d, 0x81, 0x37, 0x03, 0x34, 0x31, 0x2c, 0x2b, 0x81, 0x27,
+    0x02, 0x25, 0x22, 0x21, 0x80, 0x1b, 0x01, 0x1a, 0x1a, 0x80, 0x19, 0x01,
+    0x18, 0x18, 0x82, 0x15, 0x82, 0x12, 0x86, 0x0f, 0x82, 0x0b, 0x01, 0x0a,
+    0x0a, 0x81, 0x0b, 0x03, 0x0a, 0x0a, 0x0b, 0x0c, 0x81, 0x06, 0x00, 0x05,
+    0x80, 0x06, 0x02, 0x05, 0x05, 0x0a, 0x83, 0x03, 0x09, 0x0b, 0x1a, 0x5a,
+    0x0f, 0x0b, 0x1b, 0x7b, 0x3b, 0x0b, 0x0a, 0x81, 0x03, 0x08, 0x06, 0x0f,
+    0x3a, 0x96, 0x52, 0x24, 0x0b, 0x0a, 0x05, 0xaa, 0x21, 0x00, 0x1d, 0x80,
+    0x21, 0x00, 0x1d, 0x80, 0x21, 0x83, 0x1b, 0x00, 0x21, 0x87, 0x1b, 0x01,
+    0x21, 0x1d, 0x8d, 0x21, 0x04, 0x25, 0x25, 0x28, 0x28, 0x25, 0x82, 0x27,
+    0x00, 0x2b, 0x96, 0x27, 0x00, 0x2b, 0x80, 0x27, 0x00, 0x2c, 0x81, 0x2a,
+    0x01, 0x31, 0x2c, 0x80, 0x2a, 0x0a, 0x2c, 0x2b, 0x31, 0x36, 0x4c, 0x5b,
+    0x6c, 0x66, 0x4c, 0x3d, 0x37, 0x80, 0x31, 0x07, 0x35, 0x40, 0x4e, 0x94,
+    0x93, 0x5c, 0x4a, 0x3d, 0x88, 0x37, 0x31, 0x3d, 0x42, 0x42, 0x4c, 0x4f,
+    0x5b, 0x65, 0xc0, 0x87, 0x67, 0x4f, 0x4f, 0x56, 0x5b, 0x66, 0x8d, 0x73,
+    0x65, 0x6c, 0x83, 0x8c, 0xa0, 0x98, 0x80, 0xd7, 0xb5, 0xe0, 0xa0, 0xcc,
+    0xe9, 0xb2, 0xeb, 0xbe, 0xb8, 0xb5, 0xd8, 0xd7, 0xd6, 0x9b, 0x6c, 0x65,
+    0x5b, 0x56, 0x51, 0x4f, 0x4c, 0x48, 0x42, 0x41, 0x41, 0x81, 0x37, 0x80,
+    0x31, 0x02, 0x2b, 0x2c, 0x2a, 0x80, 0x27, 0x01, 0x23, 0x21, 0x81, 0x1b,
+    0x83, 0x17, 0x83, 0x15, 0x81, 0x12, 0x85, 0x0f, 0x85, 0x0b, 0x00, 0x0a,
+    0x80, 0x0b, 0x80, 0x06, 0x01, 0x0b, 0x0b, 0x80, 0x06, 0x01, 0x05, 0x05,
+    0x82, 0x06, 0x83, 0x03, 0x0b, 0x07, 0x1c, 0x5f, 0x0b, 0x0a, 0x2e, 0x7c,
+    0x23, 0x0f, 0x07, 0x04, 0x0a, 0x81, 0x03, 0x06, 0x0e, 0x1f, 0x52, 0x7a,
+    0x47, 0x21, 0x12, 0xae, 0x21, 0x01, 0x1d, 0x1f, 0x81, 0x21, 0x81, 0x1b,
+    0x00, 0x21, 0x86, 0x1b, 0x02, 0x21, 0x21, 0x1d, 0x8f, 0x21, 0x04, 0x27,
+    0x28, 0x25, 0x2b, 0x2b, 0x80, 0x27, 0x00, 0x2b, 0x95, 0x27, 0x01, 0x2a,
+    0x2b, 0x80, 0x27, 0x82, 0x2a, 0x03, 0x2c, 0x2b, 0x2b, 0x31, 0x80, 0x2a,
+    0x04, 0x34, 0x41, 0x65, 0x53, 0x41, 0x81, 0x31, 0x0c, 0x3c, 0x42, 0x4e,
+    0x4c, 0x58, 0x7f, 0xc2, 0x58, 0x42, 0x3c, 0x39, 0x34, 0x36, 0x86, 0x37,
+    0x01, 0x3d, 0x42, 0x80, 0x48, 0x2d, 0x51, 0x5e, 0xe6, 0x82, 0x67, 0x51,
+    0x4f, 0x4f, 0x56, 0x6e, 0x8c, 0x81, 0x80, 0x81, 0x8b, 0x91, 0xb5, 0x83,
+    0xd6, 0xd7, 0xd9, 0x90, 0xb8, 0xad, 0xce, 0xd4, 0xb2, 0xcc, 0xbb, 0xdd,
+    0xb4, 0xd7, 0xd6, 0x9b, 0x6e, 0x65, 0x65, 0x5b, 0x53, 0x4f, 0x4c, 0x48,
+    0x42, 0x42, 0x41, 0x41, 0x80, 0x37, 0x81, 0x31, 0x04, 0x2c, 0x2a, 0x2b,
+    0x28, 0x28, 0x80, 0x21, 0x01, 0x1d, 0x1b, 0x82, 0x17, 0x01, 0x19, 0x18,
+    0x83, 0x15, 0x81, 0x12, 0x85, 0x0f, 0x03, 0x0c, 0x0c, 0x0f, 0x0f, 0x85,
+    0x0b, 0x01, 0x0a, 0x07, 0x80, 0x0b, 0x02, 0x0a, 0x0a, 0x0b, 0x85, 0x06,
+    0x83, 0x03, 0x0a, 0x15, 0x66, 0x14, 0x05, 0x1d, 0x68, 0x61, 0x36, 0x29,
+    0x10, 0x0a, 0x81, 0x03, 0x0c, 0x0a, 0x05, 0x12, 0x3a, 0x55, 0x73, 0x49,
+    0x23, 0x25, 0x25, 0x23, 0x23, 0x25, 0xa8, 0x21, 0x01, 0x1f, 0x1f, 0x81,
+    0x21, 0x8c, 0x1b, 0x92, 0x21, 0x83, 0x27, 0x01, 0x2b, 0x2a, 0x82, 0x27,
+    0x00, 0x2b, 0x88, 0x27, 0x01, 0x2a, 0x2b, 0x81, 0x27, 0x82, 0x2a, 0x01,
+    0x28, 0x28, 0x84, 0x2a, 0x81, 0x31, 0x14, 0x39, 0x4a, 0x3d, 0x36, 0x2a,
+    0x28, 0x31, 0x37, 0x49, 0x71, 0x6f, 0x7a, 0x7b, 0x89, 0x8c, 0xac, 0x58,
+    0x41, 0x37, 0x34, 0x34, 0x87, 0x37, 0x00, 0x3d, 0x80, 0x42, 0x2a, 0x48,
+    0x4f, 0x5b, 0xbf, 0x82, 0x5e, 0x51, 0x56, 0x4f, 0x5b, 0x80, 0x99, 0xa9,
+    0x87, 0x8c, 0x7d, 0x83, 0x83, 0x95, 0xd6, 0xd6, 0xd8, 0xb4, 0xdd, 0xba,
+    0xc6, 0xe9, 0xea, 0xe8, 0xa1, 0xb7, 0xdc, 0xb5, 0x95, 0x83, 0x78, 0x6c,
+    0x65, 0x5b, 0x56, 0x51, 0x4f, 0x4c, 0x80, 0x42, 0x00, 0x41, 0x80, 0x37,
+    0x81, 0x31, 0x80, 0x2a, 0x03, 0x28, 0x27, 0x25, 0x22, 0x80, 0x1b, 0x81,
+    0x17, 0x05, 0x19, 0x18, 0x18, 0x16, 0x15, 0x14, 0x80, 0x15, 0x82, 0x12,
+    0x84, 0x0f, 0x02, 0x0c, 0x0c, 0x0f, 0x83, 0x0b, 0x0f, 0x0a, 0x0b, 0x0b,
+    0x0a, 0x05, 0x0b, 0x0b, 0x0a, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07,
+    0x07, 0x84, 0x03, 0x1d, 0x07, 0x05, 0x0f, 0x54, 0x25, 0x05, 0x0f, 0x18,
+    0x2c, 0x3c, 0x6d, 0x3b, 0x14, 0x05, 0x0a, 0x08, 0x03, 0x05, 0x02, 0x05,
+    0x0a, 0x12, 0x1f, 0x4d, 0x23, 0x23, 0x25, 0x23, 0x23, 0x25, 0xa8, 0x21,
+    0x01, 0x1d, 0x1f, 0x81, 0x21, 0x8c, 0x1b, 0x92, 0x21, 0x00, 0x25, 0x82,
+    0x27, 0x00, 0x2a, 0x89, 0x27, 0x00, 0x2a, 0x82, 0x27, 0x01, 0x2a, 0x2b,
+    0x81, 0x27, 0x06, 0x2b, 0x2b, 0x28, 0x2a, 0x2b, 0x28, 0x31, 0x82, 0x37,
+    0x01, 0x36, 0x37, 0x80, 0x31, 0x18, 0x36, 0x39, 0x39, 0x30, 0x2c, 0x30,
+    0x30, 0x3c, 0x5c, 0x8d, 0x6d, 0x4c, 0x3d, 0x42, 0x42, 0x4c, 0x8e, 0x82,
+    0x42, 0x39, 0x35, 0x36, 0x39, 0x39, 0x36, 0x83, 0x37, 0x13, 0x3d, 0x41,
+    0x42, 0x41, 0x41, 0x48, 0x4f, 0x67, 0xc3, 0x7b, 0x5b, 0x56, 0x4f, 0x56,
+    0x6a, 0x7d, 0xaa, 0x99, 0x6a, 0x65, 0x81, 0x78, 0x18, 0xd6, 0xd6, 0xd7,
+    0xb4, 0xdb, 0xb9, 0xa5, 0xd2, 0xd5, 0xd1, 0xa4, 0x98, 0xb5, 0xb4, 0x9d,
+    0x95, 0x83, 0x78, 0x65, 0x5e, 0x5b, 0x51, 0x4f, 0x4c, 0x4c, 0x80, 0x42,
+    0x03, 0x41, 0x3c, 0x39, 0x36, 0x80, 0x31, 0x80, 0x2a, 0x01, 0x28, 0x27,
+    0x80, 0x21, 0x03, 0x1b, 0x1b, 0x1a, 0x19, 0x83, 0x17, 0x00, 0x15, 0x80,
+    0x12, 0x81, 0x15, 0x01, 0x14, 0x12, 0x84, 0x0f, 0x86, 0x0b, 0x06, 0x0a,
+    0x0b, 0x0c, 0x0a, 0x06, 0x0b, 0x0b, 0x80, 0x06, 0x80, 0x03, 0x01, 0x07,
+    0x07, 0x86, 0x03, 0x0d, 0x0a, 0x06, 0x35, 0x54, 0x18, 0x0b, 0x04, 0x06,
+    0x0b, 0x23, 0x86, 0x68, 0x4d, 0x16, 0x85, 0x03, 0x06, 0x0f, 0x23, 0x23,
+    0x25, 0x23, 0x23, 0x25, 0x84, 0x21, 0x00, 0x25, 0xa6, 0x21, 0x8d, 0x1b,
+    0x90, 0x21, 0x81, 0x25, 0x82, 0x27, 0x80, 0x25, 0x84, 0x27, 0x01, 0x2a,
+    0x2b, 0x83, 0x27, 0x00, 0x2b, 0x82, 0x27, 0x1a, 0x2b, 0x36, 0x41, 0x4c,
+    0x54, 0x5b, 0x6c, 0x7e, 0x7e, 0x83, 0x6c, 0x6c, 0x95, 0x5a, 0x58, 0x6d,
+    0x58, 0x41, 0x37, 0x36, 0x31, 0x3c, 0x36, 0x55, 0x99, 0x5a, 0x3d, 0x80,
+    0x31, 0x0a, 0x39, 0x42, 0x63, 0x87, 0x42, 0x36, 0x37, 0x34, 0x39, 0x36,
+    0x36, 0x84, 0x37, 0x15, 0x41, 0x42, 0x41, 0x42, 0x48, 0x51, 0x68, 0xc8,
+    0x64, 0x6a, 0x5b, 0x6c, 0x78, 0x80, 0xb7, 0xa1, 0x7d, 0x65, 0x65, 0x6a,
+    0x83, 0x83, 0x80, 0x9b, 0x1d, 0xd7, 0xd9, 0xdb, 0x9a, 0xad, 0xd0, 0xd5,
+    0xeb, 0xbe, 0x98, 0xd9, 0xd8, 0x9d, 0x9c, 0x83, 0x6c, 0x6a, 0x65, 0x5b,
+    0x51, 0x51, 0x4f, 0x4c, 0x46, 0x42, 0x42, 0x3d, 0x3c, 0x37, 0x36, 0x81,
+    0x31, 0x01, 0x2c, 0x2b, 0x81, 0x27, 0x03, 0x23, 0x21, 0x1d, 0x1b, 0x80,
+    0x17, 0x00, 0x19, 0x80, 0x17, 0x00, 0x15, 0x80, 0x12, 0x81, 0x15, 0x01,
+    0x14, 0x12, 0x85, 0x0f, 0x88, 0x0b, 0x04, 0x0a, 0x07, 0x0b, 0x0a, 0x0a,
+    0x82, 0x03, 0x00, 0x06, 0x80, 0x03, 0x00, 0x07, 0x83, 0x03, 0x0e, 0x07,
+    0x05, 0x0f, 0x43, 0x54, 0x25, 0x0b, 0x03, 0x0a, 0x05, 0x18, 0x3a, 0x5d,
+    0x60, 0x12, 0x85, 0x03, 0x02, 0x23, 0x23, 0x25, 0xb2, 0x21, 0x8b, 0x1b,
+    0x02, 0x21, 0x1d, 0x1d, 0x8c, 0x21, 0x81, 0x25, 0x02, 0x23, 0x23, 0x25,
+    0x80, 0x27, 0x03, 0x25, 0x23, 0x23, 0x25, 0x80, 0x27, 0x00, 0x25, 0x80,
+    0x27, 0x03, 0x2a, 0x2b, 0x28, 0x2b, 0x80, 0x27, 0x01, 0x2a, 0x2b, 0x82,
+    0x27, 0x07, 0x2b, 0x31, 0x3d, 0x4c, 0x4f, 0x4f, 0x4c, 0x42, 0x82, 0x48,
+    0x0b, 0x5f, 0x61, 0x61, 0x9d, 0x61, 0x48, 0x4f, 0x4f, 0x4c, 0x48, 0x5d,
+    0x7b, 0x80, 0x37, 0x05, 0x31, 0x38, 0x37, 0x4c, 0x93, 0x5d, 0x80, 0x37,
+    0x03, 0x34, 0x39, 0x36, 0x34, 0x84, 0x37, 0x15, 0x3d, 0x41, 0x42, 0x42,
+    0x4c, 0x51, 0x6d, 0xc8, 0x6b, 0x6c, 0x5f, 0x5e, 0x7d, 0x99, 0x99, 0xd9,
+    0x6e, 0x65, 0x65, 0x6a, 0x78, 0x83, 0x80, 0x9b, 0x12, 0xb3, 0xd9, 0xdb,
+    0xa8, 0xc2, 0xd2, 0xd5, 0xd1, 0xa4, 0x98, 0xb4, 0xd8, 0x95, 0x9c, 0x95,
+    0x6e, 0x6a, 0x65, 0x5b, 0x80, 0x4f, 0x04, 0x4c, 0x48, 0x42, 0x42, 0x41,
+    0x80, 0x37, 0x82, 0x31, 0x00, 0x2b, 0x82, 0x27, 0x03, 0x22, 0x22, 0x1d,
+    0x1b, 0x83, 0x17, 0x00, 0x15, 0x81, 0x12, 0x80, 0x15, 0x80, 0x12, 0x02,
+    0x11, 0x10, 0x12, 0x82, 0x0f, 0x84, 0x0b, 0x07, 0x0a, 0x0a, 0x0b, 0x0a,
+    0x0a, 0x0b, 0x0b, 0x07, 0x86, 0x03, 0x00, 0x06, 0x83, 0x03, 0x12, 0x08,
+    0x05, 0x05, 0x0f, 0x25, 0x5f, 0x3d, 0x11, 0x02, 0x05, 0x0b, 0x0f, 0x29,
+    0x7a, 0x16, 0x04, 0x05, 0x02, 0x04, 0x80, 0x01, 0x00, 0x04, 0xb7, 0x21,
+    0x8d, 0x1b, 0x8c, 0x21, 0x02, 0x25, 0x23, 0x25, 0x80, 0x21, 0x05, 0x25,
+    0x25, 0x28, 0x25, 0x23, 0x25, 0x86, 0x27, 0x06, 0x2b, 0x28, 0x2b, 0x2c,
+    0x2a, 0x28, 0x28, 0x80, 0x2a, 0x81, 0x27, 0x03, 0x31, 0x31, 0x2f, 0x2b,
+    0x82, 0x31, 0x00, 0x35, 0x81, 0x31, 0x12, 0x3d, 0x4c, 0x73, 0x86, 0x96,
+    0x9d, 0x90, 0x86, 0x89, 0x8d, 0x3d, 0x31, 0x2b, 0x31, 0x31, 0x39, 0x58,
+    0x9f, 0x4c, 0x80, 0x37, 0x03, 0x34, 0x36, 0x34, 0x34, 0x84, 0x37, 0x00,
+    0x41, 0x80, 0x42, 0x2a, 0x48, 0x4f, 0x67, 0xe6, 0x93, 0x81, 0x65, 0x86,
+    0x99, 0x7d, 0x5e, 0x65, 0x6c, 0x65, 0x6a, 0x6c, 0x78, 0x83, 0xd6, 0xd6,
+    0xb3, 0xd7, 0xd9, 0xdd, 0x9e, 0xc8, 0xb2, 0xb2, 0xcc, 0xbb, 0xa7, 0xb5,
+    0xd8, 0xd7, 0xd7, 0xb3, 0xb3, 0x78, 0x65, 0x5b, 0x56, 0x51, 0x4f, 0x80,
+    0x48, 0x01, 0x42, 0x41, 0x80, 0x37, 0x82, 0x31, 0x00, 0x2b, 0x81, 0x27,
+    0x04, 0x25, 0x23, 0x22, 0x1d, 0x1b, 0x83, 0x17, 0x00, 0x15, 0x81, 0x12,
+    0x80, 0x15, 0x81, 0x12, 0x84, 0x0f, 0x84, 0x0b, 0x03, 0x0a, 0x0a, 0x0b,
+    0x0b, 0x81, 0x06, 0x91, 0x03, 0x0c, 0x02, 0x21, 0x5b, 0x4a, 0x12, 0x05,
+    0x03, 0x0b, 0x3f, 0x55, 0x0f, 0x07, 0x05, 0x83, 0x01, 0xb2, 0x21, 0x03,
+    0x1d, 0x1d, 0x21, 0x22, 0x8e, 0x1b, 0x80, 0x21, 0x00, 0x1d, 0x90, 0x21,
+    0x87, 0x27, 0x01, 0x25, 0x25, 0x80, 0x27, 0x01, 0x2b, 0x2c, 0x80, 0x27,
+    0x03, 0x2b, 0x2c, 0x2b, 0x2b, 0x80, 0x27, 0x00, 0x31, 0x82, 0x2a, 0x80,
+    0x31, 0x02, 0x35, 0x31, 0x31, 0x80, 0x35, 0x08, 0x34, 0x3d, 0x4e, 0x4a,
+    0x42, 0x46, 0x4a, 0x4d, 0x3d, 0x82, 0x31, 0x0a, 0x3d, 0x55, 0x87, 0x4c,
+    0x3c, 0x39, 0x36, 0x34, 0x37, 0x34, 0x36, 0x84, 0x37, 0x00, 0x3d, 0x80,
+    0x42, 0x0d, 0x48, 0x4c, 0x56, 0x79, 0xc0, 0x94, 0x98, 0x77, 0x67, 0x5b,
+    0x53, 0x5b, 0x5b, 0x6a, 0x80, 0x78, 0x80, 0x9b, 0x16, 0xb3, 0xd7, 0xd9,
+    0xa7, 0xa1, 0xd0, 0xea, 0xe9, 0xcd, 0xe4, 0xa7, 0xb4, 0xd8, 0xd7, 0xd6,
+    0x95, 0x95, 0x9c, 0x80, 0x6a, 0x65, 0x5b, 0x51, 0x80, 0x48, 0x04, 0x42,
+    0x41, 0x41, 0x3c, 0x39, 0x80, 0x31, 0x04, 0x2b, 0x31, 0x2f, 0x28, 0x27,
+    0x80, 0x25, 0x80, 0x21, 0x01, 0x1b, 0x1b, 0x82, 0x17, 0x00, 0x15, 0x80,
+    0x12, 0x80, 0x15, 0x82, 0x12, 0x82, 0x0f, 0x86, 0x0b, 0x03, 0x0a, 0x07,
+    0x0b, 0x0b, 0x81, 0x06, 0x01, 0x05, 0x06, 0x8b, 0x03, 0x0f, 0x02, 0x05,
+    0x02, 0x02, 0x05, 0x0b, 0x11, 0x35, 0x3e, 0x0a, 0x03, 0x0e, 0x60, 0x26,
+    0x07, 0x08, 0x80, 0x01, 0x03, 0x04, 0x04, 0x02, 0x04, 0x9f, 0x21, 0x00,
+    0x25, 0x8f, 0x21, 0x00, 0x1d, 0x84, 0x21, 0x85, 0x1b, 0x00, 0x21, 0x81,
+    0x1b, 0x81, 0x21, 0x00, 0x1d, 0x8f, 0x21, 0x8d, 0x27, 0x00, 0x2b, 0x81,
+    0x27, 0x00, 0x2b, 0x81, 0x27, 0x81, 0x2a, 0x00, 0x2c, 0x80, 0x2a, 0x93,
+    0x31, 0x05, 0x37, 0x4c, 0x99, 0x7f, 0x42, 0x36, 0x80, 0x37, 0x00, 0x36,
+    0x84, 0x37, 0x01, 0x3d, 0x41, 0x80, 0x42, 0x0d, 0x48, 0x4c, 0x4f, 0x5b,
+    0x76, 0xc8, 0x9e, 0x67, 0x5e, 0x56, 0x53, 0x5f, 0x65, 0x6a, 0x81, 0x78,
+    0x0f, 0xd6, 0xd6, 0xd7, 0xd7, 0xb4, 0x98, 0xa4, 0xd1, 0xea, 0xe9, 0xb0,
+    0x9e, 0xa7, 0xb5, 0xd8, 0xd7, 0x80, 0x9b, 0x0b, 0x83, 0xb3, 0xb3, 0x95,
+    0x6c, 0x56, 0x4f, 0x4f, 0x4c, 0x42, 0x42, 0x41, 0x81, 0x37, 0x81, 0x31,
+    0x00, 0x2b, 0x80, 0x27, 0x00, 0x25, 0x80, 0x21, 0x81, 0x1b, 0x02, 0x19,
+    0x18, 0x18, 0x84, 0x15, 0x82, 0x12, 0x84, 0x0f, 0x84, 0x0b, 0x80, 0x06,
+    0x03, 0x0b, 0x0a, 0x07, 0x05, 0x81, 0x06, 0x8c, 0x03, 0x00, 0x02, 0x81,
+    0x03, 0x0f, 0x0f, 0x39, 0x4a, 0x0f, 0x12, 0x60, 0x1f, 0x03, 0x05, 0x02,
+    0x03, 0x02, 0x04, 0x02, 0x02, 0x04, 0xb2, 0x21, 0x00, 0x1d, 0x83, 0x21,
+    0x82, 0x1b, 0x00, 0x21, 0x87, 0x1b, 0x03, 0x21, 0x21, 0x1b, 0x1f, 0x8b,
+    0x21, 0x05, 0x25, 0x23, 0x23, 0x28, 0x2b, 0x2a, 0x82, 0x27, 0x00, 0x2a,
+    0x85, 0x27, 0x82, 0x2a, 0x81, 0x27, 0x00, 0x2c, 0x80, 0x2a, 0x00, 0x2c,
+    0x80, 0x2a, 0x93, 0x31, 0x05, 0x36, 0x39, 0x4e, 0x87, 0x85, 0x4a, 0x87,
+    0x37, 0x03, 0x3d, 0x41, 0x41, 0x42, 0x82, 0x48, 0x07, 0x51, 0x73, 0xbc,
+    0xa3, 0x6e, 0x6a, 0x5e, 0x5b, 0x80, 0x65, 0x00, 0x6a, 0x80, 0x78, 0x12,
+    0xd6, 0xd6, 0xd7, 0xd7, 0xd9, 0xde, 0x9f, 0xce, 0xea, 0xd4, 0xca, 0xaa,
+    0xb7, 0x90, 0xd9, 0xd7, 0xd7, 0xd6, 0xd6, 0x80, 0x78, 0x08, 0x6e, 0x65,
+    0x56, 0x4f, 0x4f, 0x4c, 0x48, 0x41, 0x40, 0x81, 0x37, 0x81, 0x31, 0x80,
+    0x2a, 0x00, 0x28, 0x80, 0x25, 0x00, 0x21, 0x81, 0x1b, 0x02, 0x19, 0x18,
+    0x18, 0x84, 0x15, 0x83, 0x12, 0x83, 0x0f, 0x84, 0x0b, 0x80, 0x06, 0x01,
+    0x0b, 0x0b, 0x83, 0x06, 0x90, 0x03, 0x08, 0x0a, 0x0a, 0x11, 0x4a, 0x2a,
+    0x19, 0x79, 0x15, 0x0a, 0x82, 0x03, 0x02, 0x02, 0x02, 0x04, 0xb2, 0x21,
+    0x01, 0x1d, 0x1d, 0x80, 0x21, 0x00, 0x1d, 0x80, 0x21, 0x03, 0x1d, 0x21,
+    0x1d, 0x21, 0x88, 0x1b, 0x02, 0x21, 0x1b, 0x1f, 0x8b, 0x21, 0x80, 0x25,
+    0x01, 0x28, 0x2b, 0x87, 0x27, 0x00, 0x2a, 0x82, 0x27, 0x03, 0x2c, 0x2c,
+    0x31, 0x2b, 0x81, 0x27, 0x81, 0x2a, 0x02, 0x2c, 0x31, 0x2f, 0x85, 0x31,
+    0x01, 0x2c, 0x2c, 0x8b, 0x31, 0x04, 0x39, 0x41, 0x55, 0xbf, 0x53, 0x87,
+    0x37, 0x03, 0x3d, 0x41, 0x3d, 0x41, 0x81, 0x48, 0x0f, 0x4f, 0x53, 0x67,
+    0x93, 0xc6, 0x7f, 0x6a, 0x65, 0x56, 0x56, 0x6a, 0x65, 0x65, 0x6c, 0x78,
+    0x83, 0x80, 0x9b, 0x1b, 0xd7, 0xb4, 0xdc, 0xb9, 0xc6, 0xe9, 0xea, 0xd1,
+    0xbe, 0x97, 0xde, 0xb5, 0xd8, 0xd7, 0xd7, 0xd6, 0x9b, 0x83, 0x6c, 0x6a,
+    0x65, 0x5b, 0x4f, 0x4f, 0x4c, 0x48, 0x42, 0x41, 0x81, 0x37, 0x00, 0x36,
+    0x80, 0x31, 0x80, 0x2a, 0x81, 0x27, 0x07, 0x22, 0x1d, 0x21, 0x1d, 0x1b,
+    0x19, 0x18, 0x18, 0x84, 0x15, 0x83, 0x12, 0x82, 0x0f, 0x00, 0x0c, 0x80,
+    0x0f, 0x81, 0x0b, 0x01, 0x0a, 0x0a, 0x80, 0x0b, 0x80, 0x06, 0x93, 0x03,
+    0x09, 0x06, 0x0a, 0x04, 0x25, 0x4a, 0x3d, 0x59, 0x0f, 0x08, 0x05, 0x82,
+    0x01, 0x01, 0x04, 0x02, 0xa5, 0x21, 0x81, 0x25, 0x86, 0x21, 0x00, 0x1d,
+    0x83, 0x21, 0x01, 0x1d, 0x1d, 0x82, 0x21, 0x8a, 0x1b, 0x87, 0x21, 0x80,
+    0x25, 0x05, 0x23, 0x27, 0x27, 0x25, 0x2a, 0x2b, 0x87, 0x27, 0x00, 0x2a,
+    0x81, 0x27, 0x08, 0x2b, 0x2c, 0x31, 0x31, 0x2b, 0x28, 0x28, 0x2a, 0x28,
+    0x82, 0x2a, 0x02, 0x2c, 0x31, 0x2f, 0x8f, 0x31, 0x0a, 0x36, 0x35, 0x31,
+    0x31, 0x36, 0x37, 0x3c, 0x4e, 0x93, 0x5d, 0x3d, 0x86, 0x37, 0x03, 0x3d,
+    0x41, 0x41, 0x42, 0x81, 0x48, 0x0f, 0x51, 0x70, 0x9a, 0x6b, 0x87, 0xa3,
+    0x67, 0x65, 0x5b, 0x5e, 0x65, 0x6a, 0x65, 0x6c, 0x78, 0x83, 0x80, 0x9b,
+    0x23, 0xd7, 0xd9, 0xa6, 0xe0, 0xa4, 0xce, 0xd4, 0xb2, 0xc8, 0xa1, 0xb6,
+    0xdb, 0xd9, 0xd8, 0xd7, 0xd6, 0x9b, 0x83, 0x78, 0x6a, 0x65, 0x5b, 0x53,
+    0x51, 0x4f, 0x48, 0x42, 0x41, 0x41, 0x3c, 0x3d, 0x39, 0x37, 0x35, 0x31,
+    0x31, 0x80, 0x2a, 0x80, 0x27, 0x01, 0x25, 0x22, 0x81, 0x1b, 0x80, 0x17,
+    0x84, 0x15, 0x84, 0x12, 0x84, 0x0f, 0x83, 0x0b, 0x02, 0x0a, 0x0b, 0x0b,
+    0x81, 0x06, 0x80, 0x03, 0x00, 0x02, 0x8e, 0x03, 0x09, 0x02, 0x02, 0x05,
+    0x0a, 0x0f, 0x3c, 0x61, 0x59, 0x0f, 0x07, 0x85, 0x01, 0xa3, 0x21, 0x82,
+    0x25, 0x00, 0x28, 0x8d, 0x21, 0x01, 0x1d, 0x1d, 0x81, 0x21, 0x81, 0x1b,
+    0x00, 0x21, 0x86, 0x1b, 0x8b, 0x21, 0x82, 0x27, 0x00, 0x25, 0x83, 0x27,
+    0x00, 0x2a, 0x85, 0x27, 0x0c, 0x2a, 0x31, 0x31, 0x2b, 0x28, 0x2a, 0x28,
+    0x2b, 0x2a, 0x31, 0x31, 0x2c, 0x2c, 0x80, 0x2a, 0x00, 0x2c, 0x86, 0x31,
+    0x00, 0x2f, 0x81, 0x31, 0x0d, 0x35, 0x35, 0x31, 0x34, 0x35, 0x31, 0x34,
+    0x36, 0x34, 0x42, 0x42, 0x82, 0x77, 0x41, 0x86, 0x37, 0x80, 0x40, 0x00,
+    0x42, 0x81, 0x48, 0x09, 0x67, 0xbf, 0x84, 0x65, 0x70, 0xc3, 0x76, 0x83,
+    0x74, 0x5f, 0x80, 0x6c, 0x01, 0x78, 0x83, 0x81, 0x9b, 0x0e, 0xd7, 0xd8,
+    0xd9, 0xdb, 0xe3, 0xe7, 0xeb, 0xea, 0xeb, 0xc2, 0x9e, 0xb6, 0xb5, 0xd8,
+    0xd7, 0x80, 0x9b, 0x0e, 0x78, 0x6a, 0x65, 0x5e, 0x56, 0x53, 0x4f, 0x4c,
+    0x42, 0x41, 0x41, 0x3c, 0x3c, 0x3d, 0x39, 0x80, 0x31, 0x80, 0x2a, 0x80,
+    0x27, 0x01, 0x23, 0x21, 0x81, 0x1b, 0x09, 0x1a, 0x19, 0x18, 0x18, 0x16,
+    0x16, 0x18, 0x18, 0x15, 0x15, 0x85, 0x12, 0x84, 0x0f, 0x86, 0x0b, 0x80,
+    0x06, 0x92, 0x03, 0x08, 0x02, 0x05, 0x02, 0x0a, 0x05, 0x12, 0x5d, 0x59,
+    0x12, 0x80, 0x03, 0x83, 0x01, 0xa6, 0x21, 0x02, 0x25, 0x28, 0x27, 0x8e,
+    0x21, 0x00, 0x1d, 0x81, 0x21, 0x01, 0x1d, 0x1d, 0x83, 0x21, 0x04, 0x1d,
+    0x1d, 0x21, 0x1d, 0x1b, 0x8a, 0x21, 0x07, 0x25, 0x23, 0x25, 0x27, 0x25,
+    0x27, 0x27, 0x23, 0x85, 0x27, 0x00, 0x2a, 0x84, 0x27, 0x03, 0x2c, 0x31,
+    0x2b, 0x28, 0x80, 0x2a, 0x0a, 0x2c, 0x31, 0x31, 0x2f, 0x31, 0x2b, 0x2b,
+    0x2c, 0x2b, 0x31, 0x2f, 0x8d, 0x31, 0x09, 0x35, 0x31, 0x36, 0x39, 0x39,
+    0x41, 0x62, 0x87, 0x53, 0x3d, 0x86, 0x37, 0x03, 0x41, 0x41, 0x42, 0x42,
+    0x80, 0x48, 0x09, 0x51, 0x68, 0x9f, 0x73, 0x65, 0x6c, 0x85, 0xbf, 0x76,
+    0x6e, 0x80, 0x6a, 0x80, 0x78, 0x81, 0x9b, 0x14, 0xd7, 0xd7, 0xd9, 0xa6,
+    0xb6, 0xaa, 0xcc, 0xd4, 0xb2, 0xd0, 0xc3, 0xa9, 0xde, 0xb4, 0xd8, 0xd7,
+    0xd6, 0xd6, 0x83, 0x6c, 0x6a, 0x80, 0x56, 0x04, 0x51, 0x4c, 0x42, 0x42,
+    0x41, 0x80, 0x3d, 0x01, 0x39, 0x36, 0x80, 0x31, 0x80, 0x2a, 0x03, 0x28,
+    0x2a, 0x28, 0x23, 0x81, 0x1b, 0x84, 0x17, 0x80, 0x15, 0x88, 0x12, 0x81,
+    0x0f, 0x85, 0x0b, 0x00, 0x0a, 0x94, 0x03, 0x0c, 0x02, 0x05, 0x05, 0x02,
+    0x06, 0x07, 0x12, 0x5d, 0x77, 0x3c, 0x14, 0x0e, 0x05, 0x81, 0x01, 0x01,
+    0x00, 0x00, 0x85, 0x21, 0x01, 0x28, 0x28, 0x84, 0x21, 0x00, 0x25, 0x89,
+    0x21, 0x00, 0x1d, 0x87, 0x21, 0x05, 0x25, 0x23, 0x25, 0x23, 0x25, 0x25,
+    0x91, 0x21, 0x0b, 0x1d, 0x21, 0x21, 0x1d, 0x22, 0x21, 0x1d, 0x1d, 0x21,
+    0x22, 0x1d, 0x1d, 0x8c, 0x21, 0x02, 0x25, 0x27, 0x25, 0x80, 0x21, 0x03,
+    0x28, 0x2b, 0x28, 0x2a, 0x81, 0x27, 0x04, 0x2a, 0x2a, 0x28, 0x28, 0x2a,
+    0x81, 0x27, 0x10, 0x2c, 0x2b, 0x2b, 0x2c, 0x2f, 0x2f, 0x31, 0x2f, 0x2c,
+    0x2b, 0x31, 0x2c, 0x31, 0x2c, 0x2b, 0x2b, 0x2c, 0x88, 0x31, 0x0d, 0x36,
+    0x37, 0x37, 0x31, 0x36, 0x39, 0x38, 0x36, 0x39, 0x39, 0x4e, 0x92, 0x61,
+    0x4c, 0x83, 0x37, 0x19, 0x42, 0x41, 0x40, 0x3c, 0x42, 0x3d, 0x42, 0x42,
+    0x51, 0x53, 0x56, 0x5e, 0x8e, 0x8b, 0x56, 0x5f, 0x65, 0x80, 0xa0, 0xbc,
+    0x73, 0x6a, 0x78, 0x6a, 0x6e, 0x83, 0x82, 0x9b, 0x14, 0xd7, 0xd7, 0xd8,
+    0xb5, 0xdd, 0x9a, 0xab, 0xe8, 0xd4, 0xb2, 0xeb, 0xbf, 0xb8, 0xa6, 0xd9,
+    0xd7, 0xd7, 0xd6, 0x9b, 0x78, 0x65, 0x80, 0x56, 0x14, 0x51, 0x4c, 0x48,
+    0x42, 0x41, 0x41, 0x3d, 0x3c, 0x39, 0x34, 0x34, 0x35, 0x31, 0x2b, 0x2b,
+    0x2c, 0x2b, 0x28, 0x28, 0x25, 0x21, 0x80, 0x1b, 0x81, 0x17, 0x02, 0x19,
+    0x18, 0x18, 0x80, 0x15, 0x00, 0x14, 0x80, 0x15, 0x85, 0x12, 0x01, 0x10,
+    0x0f, 0x87, 0x0b, 0x00, 0x06, 0x80, 0x03, 0x01, 0x07, 0x0a, 0x88, 0x03,
+    0x80, 0x01, 0x83, 0x03, 0x0f, 0x02, 0x0a, 0x0f, 0x2e, 0x84, 0x23, 0x4c,
+    0x5f, 0x5b, 0x2d, 0x0f, 0x05, 0x02, 0x00, 0x00, 0x01, 0x84, 0x21, 0x02,
+    0x27, 0x27, 0x25, 0x84, 0x21, 0x00, 0x25, 0x89, 0x21, 0x00, 0x1d, 0x89,
+    0x21, 0x00, 0x25, 0x94, 0x21, 0x0a, 0x1d, 0x22, 0x22, 0x1d, 0x22, 0x21,
+    0x1d, 0x1d, 0x22, 0x22, 0x1d, 0x8d, 0x21, 0x02, 0x25, 0x27, 0x25, 0x80,
+    0x21, 0x00, 0x25, 0x81, 0x27, 0x00, 0x23, 0x87, 0x27, 0x81, 0x2a, 0x0d,
+    0x2c, 0x31, 0x2c, 0x31, 0x2b, 0x2c, 0x2b, 0x31, 0x2c, 0x2b, 0x2c, 0x2f,
+    0x2b, 0x2c, 0x87, 0x31, 0x10, 0x35, 0x34, 0x36, 0x35, 0x31, 0x39, 0x39,
+    0x34, 0x36, 0x36, 0x39, 0x69, 0x82, 0x48, 0x39, 0x39, 0x3d, 0x80, 0x40,
+    0x0e, 0x42, 0x42, 0x41, 0x42, 0x3d, 0x42, 0x43, 0x4a, 0x4f, 0x5a, 0x86,
+    0x8d, 0x91, 0xb6, 0x53, 0x80, 0x56, 0x08, 0x6c, 0x8f, 0xc0, 0x81, 0x66,
+    0x6a, 0x6c, 0x78, 0x83, 0x82, 0x9b, 0x1b, 0xd7, 0xd7, 0xd8, 0xb4, 0xdb,
+    0xa7, 0x97, 0xbe, 0xce, 0xea, 0xd4, 0xc5, 0xe3, 0xdd, 0xb4, 0xd7, 0xd7,
+    0xd6, 0x9b, 0x83, 0x6a, 0x65, 0x5b, 0x56, 0x4f, 0x4c, 0x48, 0x42, 0x80,
+    0x40, 0x01, 0x3c, 0x37, 0x81, 0x31, 0x80, 0x2a, 0x80, 0x27, 0x01, 0x23,
+    0x21, 0x81, 0x1b, 0x02, 0x1a, 0x1a, 0x19, 0x80, 0x17, 0x84, 0x15, 0x85,
+    0x12, 0x01, 0x10, 0x0f, 0x87, 0x0b, 0x00, 0x07, 0x8d, 0x03, 0x80, 0x01,
+    0x82, 0x03, 0x10, 0x02, 0x03, 0x0b, 0x2e, 0x86, 0x3b, 0x0f, 0x12, 0x1a,
+    0x1d, 0x2d, 0x40, 0x23, 0x05, 0x03, 0x00, 0x02, 0x84, 0x21, 0x00, 0x25,
+    0xbd, 0x21, 0x80, 0x1b, 0x90, 0x21, 0x01, 0x25, 0x25, 0x80, 0x21, 0x03,
+    0x25, 0x25, 0x23, 0x25, 0x8b, 0x27, 0x80, 0x2a, 0x00, 0x2c, 0x80, 0x31,
+    0x09, 0x2f, 0x31, 0x2f, 0x2b, 0x2c, 0x2b, 0x2b, 0x31, 0x31, 0x2f, 0x8d,
+    0x31, 0x06, 0x35, 0x31, 0x39, 0x39, 0x42, 0x8e, 0x5d, 0x80, 0x40, 0x81,
+    0x42, 0x83, 0x48, 0x11, 0x55, 0x64, 0x84, 0x84, 0x70, 0x5a, 0x67, 0x5e,
+    0x51, 0x5b, 0x56, 0x6a, 0x7d, 0xc0, 0xa0, 0x83, 0x6e, 0x74, 0x80, 0x78,
+    0x82, 0x9b, 0x1b, 0xd7, 0xd7, 0xd8, 0xb4, 0xa6, 0xdc, 0xb7, 0xe4, 0xcd,
+    0xb1, 0xea, 0xce, 0xaa, 0xe0, 0xb5, 0xd8, 0xd7, 0xd6, 0xd6, 0x83, 0x78,
+    0x6a, 0x65, 0x56, 0x51, 0x4c, 0x4a, 0x42, 0x80, 0x40, 0x80, 0x37, 0x80,
+    0x31, 0x02, 0x2c, 0x2b, 0x2b, 0x80, 0x27, 0x01, 0x23, 0x21, 0x81, 0x1b,
+    0x84, 0x17, 0x83, 0x15, 0x85, 0x12, 0x82, 0x0f, 0x85, 0x0b, 0x04, 0x0a,
+    0x05, 0x05, 0x07, 0x07, 0x88, 0x03, 0x01, 0x02, 0x02, 0x82, 0x03, 0x11,
+    0x06, 0x04, 0x05, 0x0e, 0x55, 0x4b, 0x0f, 0x05, 0x06, 0x07, 0x04, 0x05,
+    0x16, 0x4a, 0x35, 0x08, 0x02, 0x02, 0xa4, 0x21, 0x01, 0x25, 0x25, 0x9b,
+    0x21, 0x81, 0x1b, 0x94, 0x21, 0x03, 0x25, 0x27, 0x27, 0x25, 0x80, 0x27,
+    0x00, 0x2a, 0x87, 0x27, 0x01, 0x2a, 0x2c, 0x80, 0x2a, 0x82, 0x31, 0x03,
+    0x2c, 0x2b, 0x2c, 0x2b, 0x90, 0x31, 0x23, 0x30, 0x37, 0x3d, 0x36, 0x42,
+    0x4e, 0x9e, 0x55, 0x4a, 0x41, 0x41, 0x42, 0x41, 0x42, 0x41, 0x42, 0x48,
+    0x48, 0x4f, 0x51, 0x53, 0xe3, 0x98, 0x7d, 0x53, 0x4c, 0x51, 0x53, 0x4f,
+    0x53, 0x56, 0x65, 0x80, 0x87, 0xc6, 0x79, 0x81, 0x78, 0x83, 0x9b, 0x80,
+    0xd7, 0x18, 0xd8, 0xb4, 0xda, 0xdd, 0xb6, 0xa9, 0xe7, 0xeb, 0xd5, 0xd1,
+    0xa4, 0xb6, 0xb5, 0xd8, 0xd7, 0xd6, 0xd6, 0x83, 0x78, 0x6c, 0x65, 0x56,
+    0x53, 0x4f, 0x4c, 0x80, 0x42, 0x08, 0x41, 0x3d, 0x39, 0x39, 0x36, 0x31,
+    0x2f, 0x2c, 0x2b, 0x81, 0x27, 0x01, 0x25, 0x21, 0x82, 0x1b, 0x02, 0x1a,
+    0x1a, 0x19, 0x82, 0x17, 0x80, 0x15, 0x80, 0x12, 0x00, 0x15, 0x83, 0x12,
+    0x81, 0x0f, 0x85, 0x0b, 0x82, 0x06, 0x80, 0x03, 0x02, 0x06, 0x05, 0x06,
+    0x81, 0x03, 0x01, 0x02, 0x02, 0x84, 0x03, 0x05, 0x0a, 0x05, 0x0f, 0x68,
+    0x5d, 0x0f, 0x82, 0x03, 0x05, 0x02, 0x18, 0x54, 0x18, 0x02, 0x02, 0x99,
+    0x21, 0x00, 0x1d, 0x85, 0x21, 0x03, 0x25, 0x28, 0x27, 0x25, 0xb6, 0x21,
+    0x00, 0x25, 0x83, 0x27, 0x03, 0x2b, 0x28, 0x28, 0x2b, 0x80, 0x27, 0x81,
+    0x2a, 0x01, 0x2c, 0x31, 0x81, 0x2a, 0x82, 0x31, 0x80, 0x2a, 0x88, 0x31,
+    0x02, 0x36, 0x36, 0x37, 0x80, 0x36, 0x01, 0x34, 0x35, 0x80, 0x37, 0x04,
+    0x49, 0x79, 0x89, 0x84, 0x4c, 0x80, 0x37, 0x82, 0x40, 0x12, 0x42, 0x42,
+    0x4c, 0x5b, 0x70, 0x87, 0x53, 0x4c, 0x4c, 0x4f, 0x51, 0x4f, 0x51, 0x5b,
+    0x5e, 0x74, 0x8d, 0xc6, 0x7f, 0x82, 0x78, 0x82, 0x9b, 0x80, 0xd7, 0x0f,
+    0xd8, 0xd9, 0xb5, 0xdb, 0xde, 0xb8, 0xe4, 0xb0, 0xd3, 0xd5, 0xd2, 0xab,
+    0xb7, 0xb5, 0xd8, 0xd7, 0x80, 0x9b, 0x05, 0x83, 0x6c, 0x65, 0x5b, 0x56,
+    0x51, 0x80, 0x48, 0x02, 0x42, 0x41, 0x3d, 0x80, 0x37, 0x80, 0x31, 0x80,
+    0x2a, 0x80, 0x27, 0x01, 0x23, 0x21, 0x83, 0x1b, 0x00, 0x19, 0x81, 0x17,
+    0x80, 0x15, 0x81, 0x12, 0x00, 0x15, 0x85, 0x12, 0x01, 0x11, 0x0f, 0x84,
+    0x0b, 0x83, 0x06, 0x87, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x05, 0x13,
+    0x4d, 0x79, 0x1a, 0x0a, 0x04, 0x80, 0x01, 0x06, 0x04, 0x02, 0x05, 0x38,
+    0x4a, 0x05, 0x02, 0x99, 0x21, 0x00, 0x1d, 0x86, 0x21, 0x05, 0x28, 0x28,
+    0x25, 0x23, 0x23, 0x25, 0xa6, 0x21, 0x00, 0x25, 0x89, 0x21, 0x80, 0x27,
+    0x06, 0x25, 0x23, 0x25, 0x28, 0x28, 0x2b, 0x28, 0x82, 0x2a, 0x07, 0x31,
+    0x2c, 0x2b, 0x31, 0x31, 0x2b, 0x2c, 0x2c, 0x83, 0x31, 0x80, 0x2a, 0x86,
+    0x31, 0x00, 0x36, 0x88, 0x37, 0x04, 0x4d, 0x77, 0x98, 0x58, 0x4c, 0x81,
+    0x37, 0x00, 0x3d, 0x81, 0x40, 0x07, 0x42, 0x42, 0x4f, 0x83, 0x86, 0x76,
+    0x4f, 0x4c, 0x81, 0x4f, 0x06, 0x56, 0x56, 0x65, 0x67, 0xa0, 0x8f, 0x80,
+    0x80, 0x78, 0x01, 0x74, 0x83, 0x81, 0x9b, 0x80, 0xd7, 0x10, 0xd8, 0xd9,
+    0xb4, 0xda, 0xdc, 0xde, 0xe2, 0xe5, 0xcd, 0xb1, 0xd5, 0xd2, 0xbe, 0xb8,
+    0xb5, 0xd8, 0xd7, 0x80, 0x9b, 0x02, 0x83, 0x6a, 0x65, 0x80, 0x56, 0x00,
+    0x4f, 0x80, 0x48, 0x01, 0x42, 0x41, 0x80, 0x37, 0x80, 0x31, 0x82, 0x2a,
+    0x02, 0x28, 0x25, 0x21, 0x83, 0x1b, 0x03, 0x1a, 0x1a, 0x19, 0x18, 0x81,
+    0x15, 0x81, 0x12, 0x00, 0x15, 0x85, 0x12, 0x06, 0x11, 0x0f, 0x0c, 0x0b,
+    0x0a, 0x0a, 0x0b, 0x84, 0x06, 0x03, 0x0b, 0x05, 0x05, 0x06, 0x84, 0x03,
+    0x00, 0x02, 0x84, 0x03, 0x07, 0x06, 0x0c, 0x45, 0x58, 0x19, 0x04, 0x05,
+    0x02, 0x80, 0x03, 0x06, 0x02, 0x02, 0x04, 0x12, 0x4a, 0x0c, 0x02, 0x95,
+    0x21, 0x00, 0x25, 0x87, 0x21, 0x80, 0x25, 0x80, 0x27, 0x00, 0x25, 0x84,
+    0x21, 0x01, 0x25, 0x25, 0x9d, 0x21, 0x00, 0x25, 0x82, 0x21, 0x01, 0x27,
+    0x25, 0x84, 0x21, 0x00, 0x25, 0x82, 0x27, 0x02, 0x2b, 0x2b, 0x2c, 0x81,
+    0x2a, 0x00, 0x2c, 0x85, 0x2a, 0x86, 0x31, 0x00, 0x2f, 0x85, 0x31, 0x03,
+    0x37, 0x36, 0x34, 0x34, 0x81, 0x37, 0x0e, 0x36, 0x34, 0x39, 0x40, 0x41,
+    0x82, 0x70, 0x4c, 0x41, 0x41, 0x3c, 0x41, 0x3d, 0x3d, 0x3c, 0x80, 0x40,
+    0x12, 0x42, 0x48, 0x53, 0x83, 0x65, 0x6d, 0x79, 0x4f, 0x4c, 0x4c, 0x4f,
+    0x4f, 0x56, 0x51, 0x65, 0x6a, 0x7d, 0xc6, 0x7b, 0x81, 0x78, 0x82, 0x9b,
+    0x80, 0xd7, 0x20, 0xd8, 0xd8, 0xb4, 0xda, 0xdd, 0xdf, 0x99, 0x9e, 0xc1,
+    0xe8, 0xb2, 0xea, 0xd3, 0xbe, 0xe2, 0x8b, 0x9d, 0xd7, 0xd7, 0xd6, 0x9b,
+    0x83, 0x6a, 0x65, 0x5e, 0x56, 0x53, 0x51, 0x4c, 0x46, 0x42, 0x41, 0x41,
+    0x80, 0x37, 0x00, 0x36, 0x80, 0x31, 0x03, 0x2b, 0x2b, 0x28, 0x28, 0x81,
+    0x21, 0x83, 0x1b, 0x81, 0x17, 0x80, 0x15, 0x81, 0x12, 0x01, 0x15, 0x15,
+    0x84, 0x12, 0x80, 0x0f, 0x80, 0x0b, 0x02, 0x0a, 0x0b, 0x0b, 0x83, 0x06,
+    0x02, 0x05, 0x05, 0x06, 0x8d, 0x03, 0x05, 0x11, 0x68, 0x20, 0x06, 0x05,
+    0x05, 0x83, 0x01, 0x04, 0x05, 0x0b, 0x43, 0x1b, 0x01, 0xa0, 0x21, 0x80,
+    0x25, 0x80, 0x27, 0x00, 0x25, 0x84, 0x21, 0x01, 0x25, 0x25, 0xa2, 0x21,
+    0x04, 0x25, 0x27, 0x27, 0x25, 0x25, 0x82, 0x21, 0x04, 0x25, 0x28, 0x28,
+    0x25, 0x25, 0x80, 0x27, 0x05, 0x2c, 0x2c, 0x2b, 0x2b, 0x2c, 0x31, 0x82,
+    0x2a, 0x80, 0x2c, 0x02, 0x31, 0x2f, 0x2f, 0x8c, 0x31, 0x80, 0x36, 0x00,
+    0x34, 0x81, 0x37, 0x09, 0x36, 0x34, 0x39, 0x38, 0x4d, 0x8e, 0x4e, 0x42,
+    0x41, 0x3d, 0x80, 0x37, 0x00, 0x3d, 0x81, 0x40, 0x0a, 0x48, 0x5f, 0x6c,
+    0x51, 0x4c, 0x5a, 0x8b, 0x56, 0x51, 0x4c, 0x4f, 0x80, 0x56, 0x04, 0x65,
+    0x74, 0x8d, 0xca, 0x8d, 0x80, 0x78, 0x82, 0x9b, 0x80, 0xd7, 0x18, 0xd8,
+    0xd9, 0xb4, 0xa6, 0xdc, 0x98, 0xb9, 0x9e, 0xad, 0xcc, 0xeb, 0xea, 0xd4,
+    0xeb, 0xc5, 0xb9, 0x90, 0xd9, 0xd8, 0xd7, 0xd6, 0x9b, 0x83, 0x6a, 0x65,
+    0x80, 0x56, 0x05, 0x51, 0x4c, 0x48, 0x42, 0x42, 0x41, 0x81, 0x37, 0x80,
+    0x31, 0x05, 0x2c, 0x2b, 0x2b, 0x28, 0x25, 0x25, 0x81, 0x21, 0x80, 0x1b,
+    0x80, 0x17, 0x04, 0x19, 0x18, 0x18, 0x15, 0x15, 0x82, 0x12, 0x00, 0x15,
+    0x84, 0x12, 0x81, 0x0f, 0x83, 0x0b, 0x01, 0x0a, 0x0b, 0x80, 0x06, 0x02,
+    0x05, 0x05, 0x06, 0x87, 0x03, 0x82, 0x01, 0x04, 0x08, 0x18, 0x68, 0x11,
+    0x05, 0x85, 0x01, 0x04, 0x05, 0x05, 0x16, 0x30, 0x16, 0xa4, 0x21, 0x01,
+    0x25, 0x25, 0xab, 0x21, 0x01, 0x25, 0x27, 0x80, 0x25, 0x83, 0x21, 0x80,
+    0x27, 0x02, 0x23, 0x27, 0x28, 0x84, 0x2a, 0x03, 0x2c, 0x2f, 0x31, 0x2f,
+    0x98, 0x31, 0x85, 0x37, 0x04, 0x47, 0x8e, 0x58, 0x41, 0x41, 0x81, 0x37,
+    0x19, 0x3d, 0x41, 0x3d, 0x48, 0x5b, 0x66, 0x53, 0x4f, 0x4a, 0x4c, 0x53,
+    0x86, 0x86, 0x5b, 0x4c, 0x51, 0x5e, 0x5f, 0x54, 0x6a, 0x83, 0x94, 0xa0,
+    0x80, 0x83, 0x83, 0x82, 0x9b, 0x80, 0xd7, 0x13, 0xd8, 0xd9, 0xb4, 0x90,
+    0xde, 0xb8, 0x9e, 0xad, 0xc6, 0xce, 0xb1, 0xea, 0xe9, 0xce, 0xcc, 0xc5,
+    0x9a, 0xb5, 0xd8, 0x80, 0x80, 0x9b, 0x02, 0x78, 0x6a, 0x65, 0x80, 0x56,
+    0x05, 0x51, 0x4f, 0x4c, 0x48, 0x42, 0x41, 0x81, 0x37, 0x81, 0x31, 0x80,
+    0x2a, 0x03, 0x28, 0x27, 0x25, 0x25, 0x80, 0x21, 0x06, 0x1b, 0x1b, 0x1a,
+    0x1a, 0x19, 0x18, 0x18, 0x81, 0x15, 0x84, 0x12, 0x00, 0x15, 0x81, 0x12,
+    0x82, 0x0f, 0x84, 0x0b, 0x01, 0x0a, 0x07, 0x8a, 0x03, 0x82, 0x01, 0x08,
+    0x05, 0x0f, 0x49, 0x55, 0x0a, 0x0a, 0x02, 0x05, 0x04, 0x81, 0x01, 0x05,
+    0x04, 0x05, 0x0a, 0x02, 0x19, 0x40, 0xab, 0x21, 0x00, 0x25, 0x91, 0x21,
+    0x03, 0x25, 0x25, 0x23, 0x25, 0x8e, 0x21, 0x00, 0x25, 0x84, 0x21, 0x85,
+    0x27, 0x83, 0x2a, 0x01, 0x2c, 0x2c, 0x8e, 0x31, 0x04, 0x36, 0x34, 0x36,
+    0x34, 0x35, 0x82, 0x31, 0x02, 0x36, 0x34, 0x36, 0x84, 0x37, 0x05, 0x42,
+    0x47, 0xa9, 0x4e, 0x42, 0x3d, 0x80, 0x37, 0x17, 0x41, 0x41, 0x42, 0x46,
+    0x56, 0x95, 0x51, 0x4c, 0x42, 0x42, 0x4c, 0x4f, 0x5a, 0x7f, 0x67, 0x56,
+    0x4f, 0x65, 0x65, 0x56, 0x83, 0x7d, 0xae, 0x7b, 0x80, 0x78, 0x82, 0x9b,
+    0x16, 0xd7, 0xd7, 0xd8, 0xd9, 0xda, 0xdc, 0xa7, 0xe2, 0xa1, 0xcd, 0xcf,
+    0xd3, 0xb2, 0xea, 0xd3, 0xcc, 0xa5, 0xc6, 0xc5, 0x99, 0xb4, 0xd8, 0xd7,
+    0x80, 0x9b, 0x0c, 0x78, 0x6a, 0x65, 0x5e, 0x5b, 0x53, 0x4f, 0x4f, 0x4c,
+    0x48, 0x42, 0x42, 0x3d, 0x80, 0x37, 0x81, 0x31, 0x80, 0x2a, 0x80, 0x27,
+    0x0a, 0x25, 0x25, 0x22, 0x21, 0x1d, 0x1d, 0x1a, 0x1a, 0x19, 0x18, 0x18,
+    0x82, 0x15, 0x83, 0x12, 0x01, 0x15, 0x15, 0x81, 0x12, 0x83, 0x0f, 0x82,
+    0x0b, 0x01, 0x0a, 0x0a, 0x8a, 0x03, 0x00, 0x02, 0x82, 0x03, 0x02, 0x2a,
+    0x73, 0x1f, 0x81, 0x03, 0x80, 0x01, 0x07, 0x00, 0x02, 0x02, 0x05, 0x06,
+    0x01, 0x0c, 0x3e, 0xaa, 0x21, 0x02, 0x27, 0x27, 0x25, 0xa3, 0x21, 0x80,
+    0x25, 0x83, 0x21, 0x0a, 0x25, 0x28, 0x2b, 0x2b, 0x27, 0x25, 0x2a, 0x28,
+    0x2a, 0x2b, 0x2c, 0x82, 0x2a, 0x8e, 0x31, 0x04, 0x35, 0x36, 0x36, 0x35,
+    0x36, 0x84, 0x31, 0x00, 0x36, 0x85, 0x37, 0x0e, 0x4c, 0x7f, 0x82, 0x48,
+    0x41, 0x3d, 0x40, 0x3c, 0x41, 0x41, 0x4a, 0x5b, 0x6c, 0x83, 0x5f, 0x82,
+    0x48, 0x0d, 0x4f, 0x53, 0x89, 0x61, 0x5e, 0x4f, 0x5e, 0x65, 0x6a, 0x80,
+    0x7b, 0xc5, 0x8d, 0x83, 0x82, 0x9b, 0x80, 0xd7, 0x20, 0xd8, 0xd9, 0xa6,
+    0xdd, 0xb6, 0xa8, 0xab, 0xca, 0xd3, 0xea, 0xea, 0xe9, 0xd1, 0xca, 0xab,
+    0x97, 0xbf, 0xc8, 0x99, 0xd9, 0xd7, 0xd7, 0xd6, 0xd6, 0x83, 0x78, 0x65,
+    0x65, 0x5e, 0x56, 0x51, 0x51, 0x4f, 0x80, 0x48, 0x01, 0x42, 0x41, 0x80,
+    0x37, 0x00, 0x36, 0x80, 0x31, 0x80, 0x2a, 0x01, 0x28, 0x27, 0x80, 0x25,
+    0x80, 0x21, 0x00, 0x1d, 0x80, 0x17, 0x02, 0x19, 0x18, 0x18, 0x82, 0x15,
+    0x82, 0x12, 0x00, 0x15, 0x83, 0x12, 0x83, 0x0f, 0x81, 0x0b, 0x80, 0x06,
+    0x87, 0x03, 0x80, 0x01, 0x82, 0x03, 0x06, 0x35, 0x68, 0x12, 0x04, 0x00,
+    0x02, 0x04, 0x80, 0x01, 0x01, 0x00, 0x00, 0x81, 0x01, 0x01, 0x0a, 0x1d,
+    0x99, 0x21, 0x00, 0x25, 0x8d, 0x21, 0x03, 0x25, 0x27, 0x25, 0x25, 0x9e,
+    0x21, 0x00, 0x25, 0x88, 0x21, 0x06, 0x25, 0x25, 0x28, 0x2b, 0x2b, 0x28,
+    0x25, 0x80, 0x27, 0x82, 0x2a, 0x00, 0x2c, 0x84, 0x31, 0x01, 0x2c, 0x2f,
+    0x88, 0x31, 0x02, 0x36, 0x37, 0x36, 0x81, 0x31, 0x02, 0x35, 0x31, 0x34,
+    0x85, 0x37, 0x04, 0x41, 0x5a, 0xac, 0x58, 0x42, 0x80, 0x40, 0x08, 0x42,
+    0x42, 0x46, 0x4c, 0x4f, 0x4f, 0x4c, 0x42, 0x42, 0x82, 0x48, 0x01, 0x5a,
+    0x89, 0x81, 0x56, 0x06, 0x65, 0x78, 0x87, 0xe7, 0x85, 0x80, 0x83, 0x81,
+    0x9b, 0x80, 0xd7, 0x1d, 0xd8, 0xd9, 0xb5, 0xdd, 0xb7, 0xba, 0xad, 0xcd,
+    0xeb, 0xea, 0xb2, 0xd1, 0xca, 0xad, 0xaa, 0xb9, 0xb6, 0x8e, 0xe8, 0xa2,
+    0x8b, 0xd8, 0xd7, 0xd6, 0xd6, 0x83, 0x78, 0x6a, 0x65, 0x5b, 0x80, 0x51,
+    0x00, 0x4f, 0x80, 0x48, 0x01, 0x42, 0x3d, 0x80, 0x37, 0x82, 0x31, 0x04,
+    0x2b, 0x28, 0x28, 0x25, 0x23, 0x80, 0x25, 0x80, 0x21, 0x03, 0x1b, 0x1a,
+    0x1a, 0x19, 0x80, 0x17, 0x82, 0x15, 0x89, 0x12, 0x82, 0x0f, 0x82, 0x0b,
+    0x04, 0x0a, 0x0a, 0x05, 0x06, 0x06, 0x84, 0x03, 0x82, 0x01, 0x80, 0x03,
+    0x05, 0x1b, 0x86, 0x1f, 0x05, 0x01, 0x04, 0x84, 0x01, 0x00, 0x00, 0x80,
+    0x01, 0x00, 0x0c, 0x8e, 0x21, 0x01, 0x25, 0x25, 0x95, 0x21, 0x00, 0x25,
+    0x8f, 0x21, 0x01, 0x25, 0x28, 0x93, 0x21, 0x00, 0x25, 0x83, 0x21, 0x02,
+    0x25, 0x27, 0x23, 0x83, 0x27, 0x02, 0x2b, 0x28, 0x28, 0x81, 0x2a, 0x00,
+    0x2c, 0x81, 0x31, 0x00, 0x2c, 0x8f, 0x31, 0x01, 0x36, 0x36, 0x82, 0x31,
+    0x00, 0x36, 0x83, 0x37, 0x0a, 0x41, 0x42, 0x64, 0x92, 0x48, 0x42, 0x41,
+    0x41, 0x4c, 0x54, 0x48, 0x84, 0x42, 0x01, 0x46, 0x43, 0x80, 0x48, 0x01,
+    0x6d, 0x8c, 0x80, 0x56, 0x05, 0x65, 0x6c, 0x7d, 0xe6, 0x87, 0x83, 0x82,
+    0x9b, 0x80, 0xd7, 0x22, 0xd8, 0xd9, 0xb5, 0xdb, 0xb6, 0xa9, 0xaf, 0xe8,
+    0xd3, 0xb2, 0xd5, 0xd2, 0xcd, 0xab, 0xe3, 0xb7, 0xde, 0xdb, 0xde, 0xbc,
+    0xe8, 0xac, 0x8c, 0xd8, 0xd6, 0x9b, 0x83, 0x83, 0x74, 0x65, 0x5e, 0x5b,
+    0x53, 0x4f, 0x4f, 0x80, 0x48, 0x01, 0x42, 0x41, 0x80, 0x37, 0x82, 0x31,
+    0x07, 0x2b, 0x2b, 0x28, 0x28, 0x25, 0x28, 0x28, 0x25, 0x80, 0x21, 0x07,
+    0x1d, 0x1b, 0x1a, 0x19, 0x18, 0x16, 0x18, 0x18, 0x81, 0x15, 0x87, 0x12,
+    0x86, 0x0f, 0x01, 0x0e, 0x0c, 0x80, 0x06, 0x01, 0x05, 0x05, 0x80, 0x06,
+    0x84, 0x03, 0x80, 0x01, 0x07, 0x05, 0x06, 0x0b, 0x1d, 0x5f, 0x3c, 0x0b,
+    0x04, 0x80, 0x01, 0x01, 0x03, 0x02, 0x83, 0x00, 0x01, 0x01, 0x02, 0x8e,
+    0x21, 0x01, 0x25, 0x25, 0x97, 0x21, 0x80, 0x25, 0x02, 0x23, 0x25, 0x25,
+    0x82, 0x21, 0x02, 0x25, 0x23, 0x25, 0x80, 0x21, 0x01, 0x25, 0x28, 0x88,
+    0x21, 0x00, 0x25, 0x82, 0x21, 0x05, 0x25, 0x25, 0x23, 0x23, 0x25, 0x25,
+    0x80, 0x21, 0x80, 0x25, 0x01, 0x28, 0x25, 0x82, 0x21, 0x0e, 0x25, 0x28,
+    0x2b, 0x28, 0x28, 0x2a, 0x2b, 0x28, 0x28, 0x2b, 0x2f, 0x2c, 0x2c, 0x31,
+    0x2c, 0x84, 0x31, 0x01, 0x2c, 0x2c, 0x86, 0x31, 0x01, 0x39, 0x36, 0x80,
+    0x31, 0x01, 0x36, 0x36, 0x80, 0x37, 0x11, 0x40, 0x36, 0x3c, 0x3c, 0x42,
+    0x4e, 0xa9, 0x55, 0x42, 0x41, 0x42, 0x4f, 0x5b, 0x4f, 0x48, 0x42, 0x41,
+    0x41, 0x80, 0x42, 0x82, 0x48, 0x0a, 0x4f, 0x7d, 0x8c, 0x6a, 0x5f, 0x5b,
+    0x6c, 0x86, 0xac, 0xa3, 0x8c, 0x80, 0x78, 0x80, 0x9b, 0x1f, 0xd7, 0xd7,
+    0xd8, 0xd9, 0xb5, 0xdc, 0xa7, 0x97, 0xad, 0xc8, 0xd4, 0xb2, 0xb1, 0xd1,
+    0xc6, 0xe5, 0xa8, 0xe0, 0xdc, 0xa6, 0xb4, 0xb5, 0x98, 0x93, 0xc6, 0xc6,
+    0x87, 0xd9, 0x95, 0x83, 0x78, 0x65, 0x80, 0x56, 0x02, 0x51, 0x4f, 0x4f,
+    0x80, 0x48, 0x01, 0x42, 0x41, 0x80, 0x37, 0x00, 0x36, 0x81, 0x31, 0x01,
+    0x2f, 0x2b, 0x82, 0x27, 0x80, 0x21, 0x04, 0x1d, 0x1b, 0x1a, 0x1a, 0x19,
+    0x81, 0x17, 0x81, 0x15, 0x89, 0x12, 0x85, 0x0f, 0x01, 0x0c, 0x0b, 0x84,
+    0x06, 0x88, 0x03, 0x07, 0x06, 0x0b, 0x16, 0x31, 0x42, 0x3c, 0x12, 0x05,
+    0x80, 0x01, 0x00, 0x04, 0x85, 0x00, 0x8f, 0x21, 0x00, 0x25, 0x96, 0x21,
+    0x80, 0x25, 0x83, 0x27, 0x01, 0x25, 0x23, 0x81, 0x25, 0x80, 0x21, 0x04,
+    0x25, 0x28, 0x25, 0x23, 0x25, 0x84, 0x21, 0x0a, 0x25, 0x27, 0x27, 0x23,
+    0x23, 0x27, 0x25, 0x27, 0x27, 0x23, 0x25, 0x80, 0x27, 0x07, 0x25, 0x23,
+    0x23, 0x25, 0x25, 0x28, 0x25, 0x25, 0x81, 0x21, 0x0c, 0x28, 0x2a, 0x2b,
+    0x28, 0x28, 0x2a, 0x2b, 0x28, 0x28, 0x2b, 0x2c, 0x2b, 0x2b, 0x8e, 0x31,
+    0x82, 0x37, 0x02, 0x36, 0x39, 0x36, 0x82, 0x37, 0x07, 0x41, 0x3c, 0x41,
+    0x42, 0x5a, 0x91, 0x84, 0x4c, 0x80, 0x42, 0x01, 0x53, 0x56, 0x80, 0x42,
+    0x00, 0x41, 0x82, 0x42, 0x81, 0x48, 0x0c, 0x51, 0x5a, 0x7f, 0x67, 0x6c,
+    0x6a, 0x7d, 0xbf, 0x8f, 0x7d, 0xd7, 0x9b, 0x83, 0x80, 0x9b, 0x80, 0xd7,
+    0x23, 0xd8, 0xb4, 0xdb, 0xe0, 0xa8, 0xab, 0xcc, 0xb1, 0xb2, 0xd3, 0xcc,
+    0xaf, 0xaa, 0xb9, 0xe0, 0xdc, 0xb5, 0xd9, 0xd8, 0xd7, 0xd8, 0xb4, 0x8d,
+    0xac, 0xe8, 0x91, 0x95, 0x9b, 0x83, 0x65, 0x65, 0x5e, 0x56, 0x53, 0x4f,
+    0x4f, 0x80, 0x48, 0x02, 0x42, 0x42, 0x41, 0x81, 0x37, 0x00, 0x36, 0x80,
+    0x31, 0x00, 0x2b, 0x80, 0x27, 0x01, 0x2a, 0x27, 0x80, 0x21, 0x00, 0x1d,
+    0x81, 0x17, 0x00, 0x19, 0x81, 0x17, 0x81, 0x15, 0x81, 0x12, 0x00, 0x15,
+    0x83, 0x12, 0x85, 0x0f, 0x01, 0x0e, 0x0b, 0x80, 0x06, 0x80, 0x0b, 0x00,
+    0x07, 0x89, 0x03, 0x0d, 0x0f, 0x1a, 0x0f, 0x11, 0x49, 0x54, 0x35, 0x0a,
+    0x00, 0x02, 0x04, 0x00, 0x01, 0x01, 0x82, 0x00, 0x8c, 0x21, 0x02, 0x25,
+    0x23, 0x25, 0x96, 0x21, 0x03, 0x25, 0x23, 0x23, 0x25, 0x83, 0x27, 0x02,
+    0x25, 0x25, 0x23, 0x81, 0x25, 0x06, 0x23, 0x23, 0x27, 0x28, 0x25, 0x23,
+    0x25, 0x84, 0x21, 0x86, 0x27, 0x00, 0x25, 0x82, 0x27, 0x02, 0x23, 0x23,
+    0x25, 0x86, 0x27, 0x80, 0x2a, 0x00, 0x28, 0x82, 0x2a, 0x02, 0x31, 0x31,
+    0x2c, 0x8e, 0x31, 0x83, 0x37, 0x00, 0x36, 0x83, 0x37, 0x10, 0x41, 0x3d,
+    0x42, 0x4e, 0x99, 0x84, 0x4c, 0x4c, 0x42, 0x42, 0x41, 0x4c, 0x4f, 0x41,
+    0x42, 0x4a, 0x41, 0x81, 0x42, 0x0d, 0x48, 0x48, 0x42, 0x4a, 0x4f, 0x4f,
+    0x56, 0x84, 0x7d, 0x6a, 0x7d, 0xac, 0xac, 0x70, 0x84, 0x9b, 0x15, 0xd7,
+    0xd7, 0xd8, 0xd9, 0xa6, 0xdd, 0xe2, 0xa1, 0xc6, 0xd3, 0xea, 0xd3, 0xcc,
+    0xc1, 0xaa, 0xe2, 0xb6, 0xdd, 0xa6, 0xb4, 0xd9, 0xd8, 0x80, 0xd7, 0x07,
+    0xd8, 0x84, 0xc8, 0xa3, 0x9c, 0x9b, 0x78, 0x65, 0x80, 0x56, 0x08, 0x53,
+    0x4f, 0x4f, 0x4c, 0x4c, 0x46, 0x42, 0x42, 0x41, 0x81, 0x37, 0x08, 0x36,
+    0x31, 0x31, 0x2b, 0x28, 0x25, 0x25, 0x28, 0x28, 0x81, 0x21, 0x01, 0x1b,
+    0x1b, 0x80, 0x17, 0x00, 0x19, 0x81, 0x17, 0x81, 0x15, 0x81, 0x12, 0x00,
+    0x15, 0x83, 0x12, 0x83, 0x0f, 0x05, 0x12, 0x10, 0x0f, 0x0b, 0x0b, 0x0a,
+    0x81, 0x0b, 0x8a, 0x03, 0x0a, 0x0f, 0x14, 0x0b, 0x02, 0x0f, 0x31, 0x50,
+    0x43, 0x22, 0x0a, 0x04, 0x81, 0x01, 0x81, 0x00, 0xa0, 0x21, 0x00, 0x25,
+    0x83, 0x21, 0x02, 0x25, 0x23, 0x25, 0x87, 0x27, 0x00, 0x25, 0x81, 0x27,
+    0x06, 0x25, 0x25, 0x28, 0x28, 0x25, 0x27, 0x25, 0x83, 0x21, 0x00, 0x25,
+    0x98, 0x27, 0x80, 0x2a, 0x00, 0x28, 0x80, 0x2a, 0x00, 0x2c, 0x80, 0x31,
+    0x00, 0x2c, 0x8e, 0x31, 0x02, 0x37, 0x37, 0x36, 0x85, 0x37, 0x80, 0x3d,
+    0x13, 0x39, 0x4a, 0x7f, 0x93, 0x4f, 0x42, 0x42, 0x3d, 0x3c, 0x41, 0x48,
+    0x48, 0x42, 0x42, 0x48, 0x42, 0x46, 0x48, 0x48, 0x42, 0x80, 0x48, 0x0a,
+    0x4f, 0x4c, 0x5b, 0x81, 0x9d, 0x83, 0x81, 0xa2, 0xac, 0x86, 0x83, 0x83,
+    0x9b, 0x20, 0xd7, 0xd7, 0xd8, 0xd9, 0xb5, 0xdc, 0xb7, 0xbb, 0xc6, 0xeb,
+    0xea, 0xe9, 0xe8, 0xad, 0xe4, 0xe2, 0x98, 0xdc, 0xa6, 0xb4, 0xd9, 0xd8,
+    0xd7, 0xd7, 0xb3, 0xd6, 0xd7, 0x8d, 0xc5, 0xa3, 0x80, 0x78, 0x65, 0x81,
+    0x56, 0x07, 0x51, 0x4f, 0x4f, 0x4c, 0x48, 0x42, 0x41, 0x41, 0x81, 0x37,
+    0x81, 0x31, 0x02, 0x2b, 0x2b, 0x28, 0x81, 0x25, 0x80, 0x21, 0x80, 0x1b,
+    0x85, 0x17, 0x81, 0x15, 0x03, 0x14, 0x14, 0x15, 0x15, 0x80, 0x12, 0x02,
+    0x11, 0x12, 0x12, 0x83, 0x0f, 0x02, 0x12, 0x0f, 0x0f, 0x80, 0x0b, 0x04,
+    0x0a, 0x0b, 0x0b, 0x0a, 0x06, 0x88, 0x03, 0x10, 0x02, 0x05, 0x1c, 0x11,
+    0x02, 0x03, 0x03, 0x11, 0x28, 0x3e, 0x2e, 0x05, 0x02, 0x00, 0x00, 0x01,
+    0x02, 0x80, 0x00, 0x9f, 0x21, 0x01, 0x25, 0x25, 0x85, 0x21, 0x00, 0x25,
+    0x80, 0x27, 0x00, 0x23, 0x80, 0x27, 0x07, 0x25, 0x27, 0x27, 0x23, 0x27,
+    0x25, 0x27, 0x2a, 0x81, 0x27, 0x01, 0x25, 0x28, 0x83, 0x21, 0x01, 0x25,
+    0x25, 0x85, 0x27, 0x01, 0x25, 0x25, 0x83, 0x27, 0x00, 0x2a, 0x87, 0x27,
+    0x80, 0x2a, 0x01, 0x28, 0x2a, 0x80, 0x2c, 0x05, 0x31, 0x31, 0x2b, 0x2c,
+    0x31, 0x2f, 0x83, 0x31, 0x00, 0x35, 0x83, 0x31, 0x05, 0x35, 0x36, 0x36,
+    0x37, 0x36, 0x36, 0x83, 0x37, 0x0c, 0x3d, 0x3d, 0x41, 0x3d, 0x41, 0x51,
+    0x9f, 0x7a, 0x48, 0x42, 0x42, 0x41, 0x41, 0x82, 0x48, 0x01, 0x46, 0x42,
+    0x83, 0x48, 0x0e, 0x4f, 0x51, 0x51, 0x6d, 0x84, 0x67, 0x61, 0x8f, 0xac,
+    0x68, 0x95, 0x83, 0x83, 0xb3, 0xd8, 0x81, 0xd7, 0x13, 0xd8, 0xd8, 0xb4,
+    0xdb, 0xa7, 0xa8, 0xbe, 0xd1, 0xea, 0xd4, 0xce, 0xc4, 0xbb, 0xe2, 0xb6,
+    0xdd, 0xda, 0xb4, 0xd9, 0xd8, 0x80, 0xd7, 0x08, 0xd6, 0xd6, 0x81, 0x8f,
+    0xca, 0x84, 0x95, 0x78, 0x65, 0x81, 0x56, 0x06, 0x51, 0x4f, 0x4f, 0x4c,
+    0x48, 0x42, 0x41, 0x81, 0x37, 0x84, 0x31, 0x03, 0x2b, 0x28, 0x25, 0x25,
+    0x80, 0x21, 0x01, 0x25, 0x21, 0x80, 0x1b, 0x80, 0x17, 0x00, 0x19, 0x80,
+    0x17, 0x85, 0x15, 0x05, 0x12, 0x12, 0x11, 0x11, 0x12, 0x12, 0x86, 0x0f,
+    0x07, 0x0c, 0x0c, 0x0f, 0x0a, 0x0a, 0x0b, 0x0a, 0x06, 0x83, 0x03, 0x01,
+    0x02, 0x02, 0x80, 0x03, 0x13, 0x02, 0x02, 0x1c, 0x1e, 0x05, 0x08, 0x05,
+    0x02, 0x08, 0x29, 0x6d, 0x0b, 0x04, 0x02, 0x00, 0x00, 0x02, 0x02, 0x00,
+    0x02, 0x8c, 0x21, 0x00, 0x25, 0x9b, 0x21, 0x06, 0x25, 0x25, 0x23, 0x27,
+    0x2b, 0x28, 0x23, 0x80, 0x25, 0x80, 0x21, 0x81, 0x27, 0x01, 0x23, 0x25,
+    0x80, 0x27, 0x01, 0x25, 0x25, 0x81, 0x21, 0x82, 0x27, 0x0d, 0x25, 0x25,
+    0x23, 0x23, 0x25, 0x27, 0x28, 0x25, 0x27, 0x28, 0x25, 0x28, 0x28, 0x2b,
+    0x82, 0x27, 0x81, 0x2a, 0x80, 0x27, 0x01, 0x2b, 0x2f, 0x81, 0x2c, 0x04,
+    0x2b, 0x31, 0x31, 0x2b, 0x2c, 0x82, 0x31, 0x02, 0x36, 0x34, 0x35, 0x81,
+    0x31, 0x80, 0x36, 0x80, 0x37, 0x00, 0x36, 0x81, 0x37, 0x09, 0x41, 0x41,
+    0x39, 0x3c, 0x3d, 0x4a, 0x62, 0x9a, 0x5e, 0x4a, 0x81, 0x42, 0x84, 0x48,
+    0x00, 0x42, 0x81, 0x48, 0x09, 0x51, 0x53, 0x4c, 0x5e, 0xb6, 0x84, 0x85,
+    0xbe, 0xac, 0x86, 0x81, 0x78, 0x80, 0x9b, 0x80, 0xd7, 0x25, 0xd8, 0xd9,
+    0xa6, 0xdd, 0xb8, 0xbb, 0xc6, 0xeb, 0xea, 0xb1, 0xcd, 0xad, 0xba, 0xb7,
+    0xa7, 0xdb, 0xb5, 0xb4, 0xd9, 0xd8, 0xd7, 0xd7, 0xd6, 0xd7, 0x81, 0x8e,
+    0xc3, 0xc2, 0x6b, 0x81, 0x80, 0x6e, 0x65, 0x5b, 0x56, 0x53, 0x4f, 0x4f,
+    0x80, 0x48, 0x03, 0x42, 0x42, 0x41, 0x3d, 0x80, 0x37, 0x81, 0x31, 0x0a,
+    0x28, 0x2b, 0x2b, 0x28, 0x28, 0x25, 0x25, 0x28, 0x28, 0x23, 0x21, 0x81,
+    0x1b, 0x02, 0x1a, 0x1a, 0x19, 0x81, 0x17, 0x84, 0x15, 0x83, 0x12, 0x86,
+    0x0f, 0x01, 0x0c, 0x0c, 0x84, 0x06, 0x81, 0x03, 0x80, 0x01, 0x07, 0x04,
+    0x05, 0x02, 0x03, 0x04, 0x12, 0x35, 0x04, 0x80, 0x01, 0x04, 0x0a, 0x35,
+    0x27, 0x05, 0x03, 0x84, 0x01, 0x8d, 0x21, 0x00, 0x25, 0x95, 0x21, 0x80,
+    0x25, 0x01, 0x23, 0x23, 0x80, 0x25, 0x03, 0x28, 0x2b, 0x28, 0x27, 0x83,
+    0x21, 0x87, 0x27, 0x01, 0x25, 0x25, 0x84, 0x21, 0x00, 0x25, 0x81, 0x21,
+    0x80, 0x27, 0x03, 0x25, 0x27, 0x28, 0x25, 0x83, 0x27, 0x03, 0x2a, 0x28,
+    0x2a, 0x2a, 0x82, 0x27, 0x80, 0x2a, 0x80, 0x31, 0x04, 0x2b, 0x2f, 0x31,
+    0x2b, 0x2b, 0x82, 0x31, 0x01, 0x37, 0x36, 0x82, 0x31, 0x02, 0x36, 0x37,
+    0x34, 0x85, 0x37, 0x08, 0x41, 0x41, 0x3c, 0x3c, 0x41, 0x61, 0x82, 0x61,
+    0x48, 0x83, 0x42, 0x02, 0x4c, 0x4f, 0x4f, 0x80, 0x48, 0x00, 0x42, 0x80,
+    0x48, 0x09, 0x4f, 0x51, 0x4f, 0x53, 0x6a, 0x9a, 0xbf, 0xa2, 0xb6, 0x81,
+    0x82, 0x78, 0x80, 0x9b, 0x80, 0xd7, 0x12, 0xd8, 0xb4, 0xdb, 0xa7, 0xba,
+    0xc1, 0xca, 0xe9, 0xd5, 0xe9, 0xca, 0xab, 0xb9, 0xb6, 0xde, 0xdb, 0xb5,
+    0xd9, 0xd8, 0x80, 0xd7, 0x0f, 0x95, 0x95, 0x82, 0xc5, 0x7f, 0x98, 0xa1,
+    0xbf, 0x8a, 0x81, 0x6a, 0x5e, 0x56, 0x53, 0x4f, 0x4f, 0x80, 0x48, 0x03,
+    0x42, 0x42, 0x41, 0x41, 0x81, 0x37, 0x08, 0x36, 0x34, 0x31, 0x2b, 0x2c,
+    0x2b, 0x28, 0x27, 0x25, 0x80, 0x27, 0x01, 0x25, 0x21, 0x83, 0x1b, 0x82,
+    0x17, 0x01, 0x15, 0x14, 0x81, 0x15, 0x00, 0x18, 0x82, 0x12, 0x02, 0x11,
+    0x12, 0x12, 0x84, 0x0f, 0x81, 0x0b, 0x83, 0x06, 0x83, 0x03, 0x82, 0x01,
+    0x11, 0x12, 0x40, 0x0a, 0x05, 0x05, 0x01, 0x0f, 0x58, 0x35, 0x0b, 0x05,
+    0x05, 0x02, 0x01, 0x00, 0x00, 0x02, 0x02, 0x8d, 0x21, 0x00, 0x25, 0x80,
+    0x21, 0x00, 0x25, 0x91, 0x21, 0x01, 0x25, 0x25, 0x80, 0x21, 0x81, 0x27,
+    0x02, 0x2b, 0x2b, 0x28, 0x80, 0x25, 0x80, 0x21, 0x01, 0x25, 0x25, 0x86,
+    0x27, 0x00, 0x25, 0x89, 0x21, 0x83, 0x27, 0x00, 0x23, 0x81, 0x27, 0x80,
+    0x2a, 0x0a, 0x28, 0x2a, 0x2a, 0x28, 0x28, 0x2a, 0x28, 0x28, 0x2c, 0x2c,
+    0x2f, 0x80, 0x31, 0x00, 0x2b, 0x85, 0x31, 0x01, 0x35, 0x37, 0x82, 0x31,
+    0x03, 0x36, 0x36, 0x39, 0x34, 0x85, 0x37, 0x08, 0x41, 0x41, 0x3d, 0x42,
+    0x42, 0x7a, 0x7b, 0x51, 0x48, 0x83, 0x42, 0x02, 0x48, 0x4f, 0x4f, 0x84,
+    0x48, 0x0a, 0x51, 0x4f, 0x54, 0x5e, 0x67, 0xa0, 0xc3, 0x70, 0x83, 0x83,
+    0x6a, 0x81, 0x78, 0x80, 0x9b, 0x15, 0xd7, 0xd7, 0xd8, 0xd8, 0xb5, 0xdc,
+    0xb7, 0xbb, 0xc9, 0xe8, 0xb2, 0xd5, 0xe9, 0xcc, 0xab, 0xb9, 0xe0, 0xdd,
+    0xa6, 0xb4, 0xd9, 0xd8, 0x80, 0xd7, 0x0f, 0x95, 0x95, 0x8a, 0xbc, 0x81,
+    0xd7, 0x81, 0x76, 0xc6, 0x84, 0x5e, 0x53, 0x56, 0x51, 0x4f, 0x4f, 0x80,
+    0x48, 0x00, 0x42, 0x81, 0x40, 0x81, 0x37, 0x06, 0x36, 0x31, 0x31, 0x2f,
+    0x2b, 0x28, 0x25, 0x81, 0x27, 0x01, 0x25, 0x21, 0x83, 0x1b, 0x07, 0x1a,
+    0x19, 0x16, 0x18, 0x18, 0x16, 0x14, 0x14, 0x81, 0x15, 0x82, 0x12, 0x00,
+    0x11, 0x80, 0x12, 0x83, 0x0f, 0x82, 0x0b, 0x03, 0x0a, 0x0b, 0x0a, 0x0a,
+    0x82, 0x03, 0x18, 0x02, 0x02, 0x05, 0x05, 0x02, 0x05, 0x0f, 0x1f, 0x28,
+    0x02, 0x03, 0x05, 0x02, 0x05, 0x19, 0x24, 0x30, 0x3c, 0x12, 0x02, 0x01,
+    0x00, 0x00, 0x02, 0x02, 0x8d, 0x21, 0x01, 0x25, 0x25, 0x87, 0x21, 0x00,
+    0x25, 0x8e, 0x21, 0x05, 0x27, 0x28, 0x25, 0x25, 0x28, 0x2b, 0x81, 0x27,
+    0x06, 0x23, 0x25, 0x25, 0x23, 0x23, 0x25, 0x25, 0x82, 0x27, 0x03, 0x25,
+    0x27, 0x25, 0x25, 0x84, 0x21, 0x03, 0x25, 0x27, 0x25, 0x25, 0x83, 0x27,
+    0x00, 0x25, 0x81, 0x27, 0x03, 0x2b, 0x2b, 0x2c, 0x2b, 0x81, 0x27, 0x05,
+    0x2a, 0x28, 0x28, 0x2c, 0x2c, 0x2b, 0x8a, 0x31, 0x01, 0x36, 0x36, 0x81,
+    0x31, 0x03, 0x36, 0x36, 0x39, 0x36, 0x83, 0x37, 0x82, 0x40, 0x06, 0x4a,
+    0x48, 0x7b, 0x76, 0x4c, 0x41, 0x41, 0x82, 0x42, 0x02, 0x48, 0x4f, 0x4f,
+    0x81, 0x48, 0x80, 0x4f, 0x0d, 0x51, 0x53, 0x5b, 0x65, 0x68, 0xc8, 0x87,
+    0x83, 0x83, 0x6a, 0x5e, 0x74, 0x9b, 0x83, 0x81, 0x9b, 0x15, 0xd7, 0xd7,
+    0xd8, 0xd9, 0xda, 0xa7, 0xe2, 0xaa, 0xc4, 0xcf, 0xb2, 0xd5, 0xb1, 0xcd,
+    0xab, 0xe2, 0xdf, 0xdc, 0xb5, 0xd9, 0xd8, 0xd8, 0x80, 0xd7, 0x0e, 0x9b,
+    0x95, 0x85, 0xc0, 0x7d, 0x83, 0x83, 0x67, 0xac, 0x7f, 0x65, 0x65, 0x56,
+    0x51, 0x4f, 0x81, 0x48, 0x01, 0x42, 0x42, 0x80, 0x40, 0x82, 0x37, 0x80,
+    0x31, 0x02, 0x2b, 0x28, 0x25, 0x81, 0x27, 0x01, 0x25, 0x22, 0x84, 0x1b,
+    0x00, 0x19, 0x80, 0x17, 0x84, 0x15, 0x82, 0x12, 0x00, 0x11, 0x81, 0x12,
+    0x81, 0x0f, 0x84, 0x0b, 0x80, 0x06, 0x83, 0x03, 0x08, 0x02, 0x04, 0x05,
+    0x02, 0x11, 0x24, 0x14, 0x05, 0x00, 0x80, 0x01, 0x80, 0x03, 0x08, 0x11,
+    0x1a, 0x0f, 0x05, 0x02, 0x00, 0x00, 0x02, 0x02, 0x8c, 0x21, 0x03, 0x25,
+    0x23, 0x25, 0x25, 0x86, 0x21, 0x00, 0x25, 0x8e, 0x21, 0x03, 0x28, 0x28,
+    0x23, 0x23, 0x83, 0x27, 0x80, 0x25, 0x83, 0x21, 0x82, 0x25, 0x01, 0x23,
+    0x25, 0x83, 0x21, 0x04, 0x25, 0x28, 0x28, 0x25, 0x23, 0x80, 0x27, 0x03,
+    0x25, 0x27, 0x28, 0x25, 0x82, 0x27, 0x01, 0x2b, 0x2c, 0x80, 0x2a, 0x82,
+    0x27, 0x06, 0x2c, 0x2b, 0x2b, 0x31, 0x31, 0x2b, 0x2c, 0x81, 0x31, 0x0b,
+    0x36, 0x37, 0x34, 0x35, 0x34, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x36,
+    0x86, 0x37, 0x81, 0x40, 0x08, 0x42, 0x4a, 0x6d, 0x9a, 0x61, 0x4c, 0x41,
+    0x42, 0x42, 0x81, 0x48, 0x80, 0x4f, 0x81, 0x48, 0x80, 0x4f, 0x0b, 0x51,
+    0x5b, 0x5e, 0x6a, 0x7a, 0xe8, 0x70, 0x78, 0x65, 0x65, 0x6a, 0x83, 0x82,
+    0x9b, 0x18, 0xd7, 0xd7, 0xd8, 0xd9, 0xb4, 0xdc, 0xe0, 0xb9, 0xaa, 0xcb,
+    0xd2, 0xb2, 0xea, 0xd1, 0xcb, 0xe5, 0xe2, 0xdf, 0xdb, 0xb5, 0xd9, 0xd8,
+    0xd8, 0xd7, 0xd7, 0x80, 0x9b, 0x0b, 0x84, 0xc5, 0x75, 0x9b, 0x74, 0x78,
+    0x91, 0x93, 0x67, 0x5e, 0x56, 0x51, 0x82, 0x48, 0x03, 0x42, 0x42, 0x41,
+    0x41, 0x83, 0x37, 0x80, 0x31, 0x00, 0x2f, 0x84, 0x27, 0x81, 0x21, 0x01,
+    0x1d, 0x1d, 0x80, 0x17, 0x03, 0x15, 0x16, 0x18, 0x18, 0x80, 0x15, 0x84,
+    0x12, 0x01, 0x11, 0x11, 0x81, 0x12, 0x81, 0x0f, 0x03, 0x0c, 0x0c, 0x0f,
+    0x0f, 0x80, 0x0b, 0x80, 0x06, 0x85, 0x03, 0x0c, 0x02, 0x0e, 0x1e, 0x16,
+    0x03, 0x00, 0x02, 0x04, 0x02, 0x02, 0x04, 0x02, 0x00, 0x81, 0x03, 0x82,
+    0x01, 0x8d, 0x21, 0x01, 0x25, 0x25, 0x8f, 0x21, 0x04, 0x25, 0x25, 0x23,
+    0x23, 0x25, 0x81, 0x21, 0x06, 0x25, 0x28, 0x27, 0x23, 0x25, 0x28, 0x2a,
+    0x84, 0x27, 0x89, 0x21, 0x02, 0x28, 0x27, 0x25, 0x80, 0x21, 0x00, 0x25,
+    0x81, 0x27, 0x07, 0x25, 0x25, 0x28, 0x28, 0x23, 0x25, 0x27, 0x25, 0x82,
+    0x27, 0x00, 0x2b, 0x80, 0x2c, 0x08, 0x2b, 0x28, 0x28, 0x2a, 0x2a, 0x28,
+    0x2b, 0x2b, 0x28, 0x81, 0x2a, 0x80, 0x31, 0x08, 0x36, 0x36, 0x37, 0x36,
+    0x36, 0x34, 0x35, 0x35, 0x34, 0x8a, 0x37, 0x0c, 0x41, 0x42, 0x41, 0x41,
+    0x42, 0x4c, 0x89, 0xb5, 0x5b, 0x4c, 0x48, 0x42, 0x42, 0x81, 0x48, 0x01,
+    0x56, 0x53, 0x83, 0x4f, 0x80, 0x51, 0x0a, 0x56, 0x5f, 0x6e, 0x87, 0xc6,
+    0x90, 0x6e, 0x83, 0x78, 0x6c, 0x83, 0x82, 0x9b, 0x1e, 0xd7, 0xd7, 0xd8,
+    0xd9, 0xb5, 0xdd, 0xb6, 0xb9, 0xa1, 0xca, 0xe9, 0xb2, 0xb1, 0xca, 0xc1,
+    0x9e, 0xb8, 0xde, 0xdb, 0xb4, 0xd9, 0xd8, 0xd8, 0xd7, 0xd6, 0xd6, 0x95,
+    0x83, 0x7b, 0xc5, 0x9d, 0x80, 0x78, 0x06, 0x6c, 0xa0, 0x92, 0x67, 0x56,
+    0x51, 0x4f, 0x81, 0x48, 0x03, 0x42, 0x42, 0x41, 0x3d, 0x83, 0x37, 0x00,
+    0x36, 0x80, 0x31, 0x00, 0x2a, 0x84, 0x27, 0x03, 0x25, 0x23, 0x22, 0x1d,
+    0x81, 0x17, 0x01, 0x16, 0x16, 0x81, 0x17, 0x00, 0x15, 0x84, 0x12, 0x01,
+    0x11, 0x11, 0x83, 0x12, 0x80, 0x0f, 0x02, 0x0c, 0x0f, 0x0f, 0x81, 0x0b,
+    0x81, 0x06, 0x83, 0x03, 0x04, 0x07, 0x1e, 0x1a, 0x05, 0x04, 0x82, 0x01,
+    0x00, 0x04, 0x83, 0x01, 0x00, 0x04, 0x81, 0x01, 0xa1, 0x21, 0x01, 0x25,
+    0x25, 0x82, 0x21, 0x01, 0x25, 0x25, 0x81, 0x27, 0x04, 0x25, 0x28, 0x2a,
+    0x27, 0x23, 0x80, 0x27, 0x01, 0x25, 0x28, 0x88, 0x21, 0x03, 0x25, 0x28,
+    0x28, 0x25, 0x82, 0x21, 0x80, 0x25, 0x80, 0x27, 0x04, 0x25, 0x23, 0x23,
+    0x25, 0x25, 0x82, 0x27, 0x00, 0x2b, 0x80, 0x2c, 0x82, 0x2a, 0x01, 0x31,
+    0x2c, 0x87, 0x31, 0x81, 0x37, 0x04, 0x36, 0x36, 0x37, 0x39, 0x36, 0x87,
+    0x37, 0x0b, 0x41, 0x41, 0x42, 0x4a, 0x42, 0x4a, 0x4f, 0x58, 0x82, 0x80,
+    0x56, 0x4c, 0x81, 0x42, 0x80, 0x48, 0x06, 0x56, 0x53, 0x51, 0x4f, 0x51,
+    0x4f, 0x4f, 0x80, 0x51, 0x07, 0x56, 0x5b, 0x6a, 0x73, 0xc0, 0x7c, 0x8b,
+    0x80, 0x81, 0x78, 0x81, 0x9b, 0x80, 0xd7, 0x15, 0xd8, 0xd9, 0xda, 0xdd,
+    0xb7, 0xe2, 0xa1, 0xcd, 0xe9, 0xea, 0xd3, 0xcb, 0xad, 0xa8, 0xb7, 0xde,
+    0xdb, 0xb5, 0xd9, 0xd9, 0xd8, 0xd7, 0x80, 0x9b, 0x0e, 0x80, 0x8f, 0xbc,
+    0x81, 0x83, 0x78, 0x6a, 0x6a, 0x75, 0x9f, 0x9e, 0x61, 0x56, 0x4f, 0x4f,
+    0x80, 0x48, 0x80, 0x42, 0x00, 0x41, 0x81, 0x37, 0x02, 0x36, 0x34, 0x36,
+    0x81, 0x31, 0x00, 0x2b, 0x84, 0x27, 0x80, 0x21, 0x0a, 0x1d, 0x1b, 0x19,
+    0x18, 0x16, 0x18, 0x18, 0x16, 0x18, 0x16, 0x15, 0x8d, 0x12, 0x82, 0x0f,
+    0x86, 0x0b, 0x07, 0x0a, 0x05, 0x07, 0x07, 0x05, 0x0c, 0x1e, 0x11, 0x84,
+    0x01, 0x80, 0x03, 0x81, 0x01, 0x80, 0x03, 0x02, 0x02, 0x02, 0x1d, 0x97,
+    0x21, 0x01, 0x25, 0x25, 0x87, 0x21, 0x02, 0x25, 0x25, 0x23, 0x80, 0x25,
+    0x81, 0x27, 0x04, 0x25, 0x28, 0x27, 0x23, 0x23, 0x80, 0x27, 0x05, 0x25,
+    0x28, 0x23, 0x23, 0x25, 0x25, 0x84, 0x21, 0x80, 0x27, 0x00, 0x25, 0x80,
+    0x21, 0x02, 0x25, 0x27, 0x25, 0x82, 0x27, 0x04, 0x25, 0x23, 0x23, 0x25,
+    0x25, 0x80, 0x27, 0x08, 0x25, 0x28, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x2c,
+    0x2b, 0x8b, 0x31, 0x88, 0x37, 0x01, 0x3d, 0x3d, 0x82, 0x37, 0x10, 0x41,
+    0x42, 0x4e, 0x5a, 0x4c, 0x51, 0x81, 0x81, 0x86, 0x61, 0x83, 0x51, 0x42,
+    0x4c, 0x42, 0x42, 0x46, 0x80, 0x48, 0x82, 0x51, 0x03, 0x4f, 0x4f, 0x51,
+    0x53, 0x80, 0x56, 0x05, 0x6c, 0x80, 0xa3, 0x7b, 0xa6, 0x80, 0x81, 0x78,
+    0x81, 0x9b, 0x80, 0xd7, 0x1e, 0xd8, 0xd9, 0xda, 0xdd, 0xb6, 0xe1, 0xbb,
+    0xaf, 0xd2, 0xea, 0xe9, 0xcd, 0xad, 0xa8, 0xb7, 0xde, 0xda, 0xb5, 0xd9,
+    0xd8, 0xd8, 0xd7, 0xd6, 0xd6, 0x95, 0xb5, 0xe6, 0x87, 0x83, 0x83, 0x6c,
+    0x80, 0x6a, 0x0d, 0x67, 0x87, 0x87, 0x5e, 0x53, 0x4f, 0x51, 0x4c, 0x4c,
+    0x42, 0x42, 0x41, 0x39, 0x3d, 0x80, 0x37, 0x00, 0x36, 0x82, 0x31, 0x80,
+    0x2a, 0x80, 0x27, 0x01, 0x25, 0x25, 0x81, 0x21, 0x06, 0x1d, 0x1b, 0x1a,
+    0x19, 0x19, 0x18, 0x18, 0x81, 0x15, 0x8d, 0x12, 0x82, 0x0f, 0x86, 0x0b,
+    0x80, 0x06, 0x08, 0x05, 0x05, 0x14, 0x1c, 0x05, 0x02, 0x02, 0x04, 0x04,
+    0x8c, 0x01, 0x00, 0x1d, 0x81, 0x21, 0x00, 0x25, 0xa0, 0x21, 0x0c, 0x25,
+    0x25, 0x23, 0x23, 0x25, 0x27, 0x28, 0x25, 0x25, 0x28, 0x27, 0x25, 0x23,
+    0x80, 0x27, 0x06, 0x25, 0x28, 0x23, 0x25, 0x27, 0x28, 0x25, 0x83, 0x21,
+    0x80, 0x27, 0x00, 0x25, 0x80, 0x21, 0x88, 0x27, 0x0d, 0x25, 0x27, 0x27,
+    0x25, 0x28, 0x25, 0x28, 0x2b, 0x28, 0x2b, 0x31, 0x2c, 0x2c, 0x2f, 0x8b,
+    0x31, 0x86, 0x37, 0x19, 0x36, 0x39, 0x4f, 0x54, 0x4f, 0x41, 0x3c, 0x42,
+    0x48, 0x4f, 0x51, 0x68, 0x91, 0x8c, 0x84, 0x86, 0x5e, 0x51, 0x51, 0x95,
+    0x56, 0x48, 0x4c, 0x42, 0x46, 0x46, 0x80, 0x48, 0x00, 0x4f, 0x82, 0x51,
+    0x02, 0x4f, 0x53, 0x53, 0x80, 0x56, 0x05, 0x6a, 0x6c, 0x94, 0x8e, 0xa7,
+    0x80, 0x81, 0x78, 0x80, 0x9b, 0x81, 0xd7, 0x13, 0xd8, 0xd9, 0xa6, 0xdd,
+    0xe0, 0xb8, 0xba, 0xad, 0xce, 0xea, 0xb2, 0xcc, 0xad, 0xa8, 0xb7, 0xdd,
+    0xda, 0xb4, 0xd9, 0xd8, 0x81, 0xd7, 0x16, 0x9b, 0x84, 0xc8, 0x84, 0x83,
+    0x83, 0x6e, 0x66, 0x65, 0x65, 0x6a, 0x61, 0xa1, 0x82, 0x73, 0x67, 0x4c,
+    0x4a, 0x42, 0x42, 0x4a, 0x42, 0x41, 0x81, 0x37, 0x00, 0x36, 0x83, 0x31,
+    0x00, 0x2b, 0x81, 0x27, 0x00, 0x25, 0x81, 0x21, 0x80, 0x1b, 0x80, 0x17,
+    0x01, 0x19, 0x18, 0x84, 0x15, 0x85, 0x12, 0x00, 0x11, 0x81, 0x12, 0x81,
+    0x0f, 0x86, 0x0b, 0x81, 0x06, 0x04, 0x03, 0x0f, 0x1c, 0x10, 0x05, 0x80,
+    0x01, 0x80, 0x03, 0x85, 0x01, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x1d,
+    0x9b, 0x21, 0x00, 0x25, 0x83, 0x21, 0x16, 0x25, 0x23, 0x23, 0x25, 0x23,
+    0x25, 0x23, 0x23, 0x25, 0x25, 0x23, 0x25, 0x28, 0x28, 0x25, 0x25, 0x28,
+    0x28, 0x25, 0x25, 0x28, 0x23, 0x23, 0x80, 0x27, 0x00, 0x25, 0x80, 0x21,
+    0x01, 0x25, 0x23, 0x80, 0x27, 0x81, 0x21, 0x82, 0x27, 0x00, 0x25, 0x85,
+    0x27, 0x00, 0x25, 0x80, 0x27, 0x80, 0x2a, 0x01, 0x31, 0x2b, 0x81, 0x31,
+    0x00, 0x2f, 0x88, 0x31, 0x02, 0x36, 0x37, 0x36, 0x83, 0x37, 0x14, 0x36,
+    0x39, 0x48, 0x4f, 0x4f, 0x4a, 0x48, 0x4f, 0x5e, 0x7e, 0x95, 0x81, 0x86,
+    0x60, 0x60, 0x51, 0x4c, 0x4c, 0x4f, 0x74, 0x54, 0x86, 0x48, 0x84, 0x51,
+    0x81, 0x56, 0x04, 0x6a, 0x80, 0x87, 0xc3, 0x91, 0x80, 0x78, 0x83, 0x9b,
+    0x16, 0xd7, 0xd7, 0xd8, 0xd8, 0xd9, 0xb5, 0xdc, 0xa7, 0xb7, 0xa8, 0xab,
+    0xcc, 0xb2, 0xb2, 0xe8, 0xad, 0x97, 0xb7, 0xdd, 0xdb, 0xb4, 0xd9, 0xd8,
+    0x80, 0xd7, 0x08, 0xd6, 0xb3, 0x8c, 0xc8, 0x7f, 0x83, 0x6e, 0x6a, 0x65,
+    0x81, 0x56, 0x06, 0x70, 0x8a, 0x9f, 0x91, 0x68, 0x58, 0x4c, 0x81, 0x42,
+    0x81, 0x37, 0x00, 0x36, 0x83, 0x31, 0x05, 0x2b, 0x28, 0x2a, 0x28, 0x25,
+    0x25, 0x81, 0x21, 0x81, 0x1b, 0x03, 0x1a, 0x1a, 0x19, 0x18, 0x84, 0x15,
+    0x83, 0x12, 0x81, 0x0f, 0x03, 0x12, 0x11, 0x12, 0x12, 0x81, 0x0f, 0x84,
+    0x0b, 0x83, 0x06, 0x09, 0x1a, 0x15, 0x05, 0x06, 0x02, 0x05, 0x04, 0x02,
+    0x04, 0x05, 0x83, 0x01, 0x06, 0x04, 0x02, 0x02, 0x00, 0x01, 0x02, 0x04,
+    0x8c, 0x21, 0x80, 0x25, 0x8f, 0x21, 0x06, 0x25, 0x25, 0x23, 0x25, 0x23,
+    0x25, 0x25, 0x83, 0x21, 0x0b, 0x27, 0x2b, 0x2b, 0x27, 0x25, 0x27, 0x28,
+    0x25, 0x25, 0x28, 0x23, 0x25, 0x83, 0x27, 0x00, 0x25, 0x81, 0x27, 0x03,
+    0x25, 0x23, 0x23, 0x25, 0x82, 0x27, 0x01, 0x25, 0x23, 0x80, 0x27, 0x01,
+    0x2b, 0x2b, 0x83, 0x27, 0x81, 0x2a, 0x03, 0x31, 0x2f, 0x31, 0x31, 0x80,
+    0x2a, 0x00, 0x2c, 0x8a, 0x31, 0x00, 0x36, 0x88, 0x37, 0x01, 0x41, 0x42,
+    0x80, 0x48, 0x02, 0x4f, 0x4c, 0x4f, 0x81, 0x48, 0x01, 0x5b, 0x5b, 0x83,
+    0x48, 0x82, 0x4f, 0x81, 0x51, 0x81, 0x56, 0x09, 0x65, 0x65, 0x6a, 0x95,
+    0x81, 0xa2, 0xa3, 0xb4, 0xd7, 0x83, 0x82, 0x9b, 0x80, 0xd7, 0x14, 0xd8,
+    0xd8, 0xd9, 0xb5, 0xdb, 0xde, 0xb6, 0xb9, 0xab, 0xca, 0xd4, 0xb2, 0xce,
+    0xc4, 0xa9, 0xb8, 0xde, 0xdb, 0xb4, 0xd9, 0xd8, 0x81, 0xd7, 0x06, 0x95,
+    0x90, 0xc8, 0x98, 0x83, 0x6a, 0x6a, 0x84, 0x56, 0x08, 0x5a, 0x5a, 0x8b,
+    0x9f, 0x58, 0x4f, 0x3d, 0x41, 0x3d, 0x82, 0x37, 0x02, 0x36, 0x36, 0x35,
+    0x80, 0x31, 0x81, 0x2a, 0x00, 0x27, 0x81, 0x21, 0x82, 0x1b, 0x82, 0x17,
+    0x04, 0x16, 0x18, 0x18, 0x16, 0x15, 0x8d, 0x12, 0x83, 0x0f, 0x81, 0x0b,
+    0x07, 0x0a, 0x05, 0x06, 0x05, 0x0a, 0x15, 0x16, 0x0a, 0x81, 0x03, 0x87,
+    0x01, 0x00, 0x05, 0x82, 0x01, 0x00, 0x03, 0x8c, 0x21, 0x80, 0x25, 0x86,
+    0x21, 0x01, 0x25, 0x25, 0x86, 0x21, 0x81, 0x25, 0x84, 0x21, 0x0b, 0x27,
+    0x2c, 0x2c, 0x28, 0x23, 0x27, 0x28, 0x25, 0x27, 0x28, 0x25, 0x25, 0x85,
+    0x27, 0x03, 0x2b, 0x2b, 0x27, 0x25, 0x80, 0x21, 0x83, 0x27, 0x00, 0x25,
+    0x80, 0x27, 0x01, 0x2b, 0x2b, 0x81, 0x27, 0x01, 0x2a, 0x2b, 0x80, 0x31,
+    0x00, 0x2b, 0x81, 0x31, 0x80, 0x2a, 0x01, 0x2c, 0x2c, 0x8a, 0x31, 0x81,
+    0x37, 0x00, 0x36, 0x81, 0x37, 0x02, 0x42, 0x3d, 0x3d, 0x81, 0x40, 0x07,
+    0x42, 0x42, 0x43, 0x42, 0x48, 0x4c, 0x4f, 0x5b, 0x83, 0x48, 0x83, 0x4f,
+    0x81, 0x51, 0x80, 0x56, 0x81, 0x65, 0x07, 0x83, 0x83, 0x8e, 0xae, 0x90,
+    0xd7, 0x83, 0x83, 0x81, 0x9b, 0x80, 0xd7, 0x20, 0xd8, 0xd9, 0xd9, 0xb5,
+    0xda, 0xdd, 0xb6, 0xb9, 0xab, 0xca, 0xe9, 0xea, 0xd1, 0xc9, 0x9e, 0xb8,
+    0xde, 0xdb, 0xb4, 0xd9, 0xd8, 0xd7, 0xd7, 0xd6, 0xd6, 0xd7, 0x7f, 0xc5,
+    0x8b, 0x83, 0x74, 0x6c, 0x65, 0x81, 0x56, 0x0b, 0x51, 0x4f, 0x50, 0x4c,
+    0x53, 0x7f, 0x82, 0x53, 0x48, 0x4a, 0x39, 0x41, 0x82, 0x37, 0x00, 0x36,
+    0x81, 0x31, 0x80, 0x2a, 0x03, 0x28, 0x28, 0x23, 0x25, 0x80, 0x21, 0x03,
+    0x1d, 0x21, 0x1b, 0x1b, 0x84, 0x17, 0x80, 0x15, 0x8d, 0x12, 0x84, 0x0f,
+    0x80, 0x0b, 0x06, 0x0a, 0x05, 0x05, 0x0a, 0x11, 0x19, 0x0f, 0x83, 0x03,
+    0x81, 0x01, 0x00, 0x05, 0x81, 0x01, 0x81, 0x03, 0x80, 0x01, 0x9b, 0x21,
+    0x04, 0x25, 0x25, 0x23, 0x25, 0x25, 0x81, 0x21, 0x03, 0x28, 0x25, 0x23,
+    0x23, 0x80, 0x25, 0x84, 0x27, 0x00, 0x23, 0x80, 0x25, 0x01, 0x27, 0x28,
+    0x80, 0x25, 0x06, 0x23, 0x25, 0x27, 0x25, 0x27, 0x25, 0x28, 0x80, 0x25,
+    0x06, 0x27, 0x28, 0x23, 0x23, 0x27, 0x28, 0x2a, 0x81, 0x27, 0x00, 0x2b,
+    0x81, 0x27, 0x09, 0x2b, 0x28, 0x28, 0x2b, 0x2c, 0x2f, 0x31, 0x31, 0x2c,
+    0x2b, 0x86, 0x31, 0x00, 0x2f, 0x86, 0x31, 0x02, 0x36, 0x34, 0x34, 0x86,
+    0x37, 0x01, 0x41, 0x3d, 0x81, 0x40, 0x82, 0x42, 0x03, 0x46, 0x4c, 0x5b,
+    0x51, 0x84, 0x48, 0x83, 0x4f, 0x00, 0x51, 0x83, 0x56, 0x08, 0x65, 0x65,
+    0x78, 0x95, 0xd7, 0x8e, 0xa3, 0xd9, 0xd7, 0x83, 0x9b, 0x80, 0xd7, 0x14,
+    0xd8, 0xd8, 0xb4, 0xb5, 0xdb, 0xde, 0xb6, 0xb9, 0xa1, 0xb0, 0xd2, 0xea,
+    0xeb, 0xcb, 0x9e, 0xb8, 0xdd, 0xa6, 0xb4, 0xd8, 0xd8, 0x80, 0xd7, 0x03,
+    0xd6, 0x9c, 0x94, 0x93, 0x80, 0x78, 0x02, 0x6c, 0x65, 0x65, 0x80, 0x56,
+    0x0a, 0x51, 0x4f, 0x4c, 0x4f, 0x51, 0x5a, 0x97, 0x7f, 0x5a, 0x4a, 0x3d,
+    0x82, 0x37, 0x82, 0x31, 0x80, 0x2a, 0x0e, 0x28, 0x27, 0x25, 0x25, 0x27,
+    0x23, 0x1d, 0x1d, 0x21, 0x22, 0x1d, 0x1c, 0x1a, 0x1a, 0x19, 0x82, 0x17,
+    0x82, 0x15, 0x84, 0x12, 0x02, 0x11, 0x12, 0x12, 0x87, 0x0f, 0x81, 0x0b,
+    0x05, 0x0a, 0x03, 0x0c, 0x15, 0x10, 0x0a, 0x83, 0x03, 0x80, 0x01, 0x81,
+    0x03, 0x86, 0x01, 0x96, 0x21, 0x01, 0x25, 0x25, 0x89, 0x21, 0x00, 0x25,
+    0x81, 0x21, 0x03, 0x25, 0x25, 0x27, 0x25, 0x81, 0x27, 0x05, 0x23, 0x23,
+    0x25, 0x23, 0x23, 0x25, 0x82, 0x27, 0x01, 0x25, 0x23, 0x86, 0x27, 0x03,
+    0x23, 0x23, 0x28, 0x2a, 0x88, 0x27, 0x80, 0x2a, 0x05, 0x2c, 0x2b, 0x31,
+    0x31, 0x2c, 0x2b, 0x92, 0x31, 0x00, 0x36, 0x85, 0x37, 0x08, 0x3d, 0x41,
+    0x3d, 0x42, 0x41, 0x3d, 0x41, 0x42, 0x4a, 0x80, 0x42, 0x03, 0x48, 0x4c,
+    0x56, 0x4f, 0x85, 0x48, 0x81, 0x4f, 0x01, 0x51, 0x51, 0x83, 0x56, 0x07,
+    0x65, 0x78, 0xb3, 0x83, 0x83, 0x8a, 0xa3, 0xd8, 0x84, 0x9b, 0x80, 0xd7,
+    0x14, 0xd8, 0xd9, 0xb4, 0xa6, 0xdc, 0xa7, 0xb7, 0xb9, 0xa1, 0xcb, 0xeb,
+    0xea, 0xb1, 0xe7, 0x9f, 0xb8, 0xdc, 0xda, 0xb5, 0xd8, 0xd8, 0x81, 0xd7,
+    0x07, 0x9d, 0xae, 0x82, 0x9b, 0x78, 0x6a, 0x6a, 0x65, 0x80, 0x56, 0x01,
+    0x51, 0x4f, 0x80, 0x48, 0x06, 0x4f, 0x51, 0x6d, 0xbe, 0x6d, 0x4f, 0x42,
+    0x82, 0x37, 0x00, 0x36, 0x83, 0x31, 0x06, 0x2b, 0x2a, 0x28, 0x25, 0x27,
+    0x27, 0x25, 0x81, 0x21, 0x80, 0x1b, 0x81, 0x17, 0x03, 0x19, 0x19, 0x18,
+    0x18, 0x81, 0x15, 0x8c, 0x12, 0x82, 0x0f, 0x81, 0x0b, 0x05, 0x0a, 0x0b,
+    0x11, 0x0f, 0x05, 0x06, 0x84, 0x03, 0x02, 0x02, 0x04, 0x04, 0x80, 0x01,
+    0x01, 0x04, 0x04, 0x84, 0x01, 0xa4, 0x21, 0x00, 0x28, 0x80, 0x21, 0x09,
+    0x25, 0x25, 0x28, 0x25, 0x23, 0x23, 0x25, 0x27, 0x23, 0x25, 0x83, 0x27,
+    0x00, 0x2a, 0x80, 0x27, 0x01, 0x25, 0x25, 0x86, 0x27, 0x03, 0x25, 0x27,
+    0x28, 0x2a, 0x82, 0x27, 0x0d, 0x2b, 0x28, 0x28, 0x2b, 0x2a, 0x2c, 0x2b,
+    0x2c, 0x31, 0x2c, 0x2b, 0x2f, 0x31, 0x2f, 0x90, 0x31, 0x02, 0x2f, 0x31,
+    0x36, 0x87, 0x37, 0x01, 0x41, 0x3d, 0x80, 0x40, 0x00, 0x42, 0x84, 0x48,
+    0x00, 0x53, 0x86, 0x48, 0x01, 0x4f, 0x4f, 0x81, 0x51, 0x82, 0x56, 0x08,
+    0x6a, 0x6a, 0x83, 0x95, 0xd6, 0x95, 0x8e, 0xe6, 0x8b, 0x83, 0x9b, 0x80,
+    0xd7, 0x15, 0xd8, 0xd8, 0xd9, 0xb4, 0xda, 0xdc, 0xdf, 0xb8, 0xa8, 0xe5,
+    0xcd, 0xb1, 0xd5, 0xd2, 0xcb, 0x9e, 0xb8, 0xdd, 0x90, 0xb4, 0xd8, 0xd8,
+    0x80, 0xd7, 0x0a, 0xd6, 0x7d, 0xbc, 0x82, 0x9b, 0x83, 0x78, 0x6a, 0x65,
+    0x5b, 0x56, 0x80, 0x51, 0x80, 0x4f, 0x06, 0x4c, 0x4f, 0x61, 0xa4, 0x70,
+    0x56, 0x42, 0x82, 0x37, 0x85, 0x31, 0x00, 0x2c, 0x82, 0x27, 0x81, 0x21,
+    0x82, 0x1b, 0x84, 0x17, 0x81, 0x15, 0x8c, 0x12, 0x82, 0x0f, 0x06, 0x0c,
+    0x0f, 0x0e, 0x0c, 0x12, 0x13, 0x06, 0x8e, 0x03, 0x84, 0x01, 0xa3, 0x21,
+    0x01, 0x28, 0x27, 0x80, 0x21, 0x02, 0x25, 0x28, 0x25, 0x80, 0x21, 0x81,
+    0x27, 0x00, 0x2c, 0x81, 0x2a, 0x03, 0x2c, 0x2b, 0x28, 0x2a, 0x86, 0x27,
+    0x80, 0x2a, 0x01, 0x28, 0x28, 0x80, 0x2a, 0x80, 0x27, 0x83, 0x2a, 0x03,
+    0x2c, 0x31, 0x2f, 0x2c, 0x80, 0x2a, 0x00, 0x2c, 0x92, 0x31, 0x01, 0x36,
+    0x36, 0x88, 0x37, 0x00, 0x3d, 0x80, 0x40, 0x00, 0x42, 0x84, 0x48, 0x00,
+    0x4f, 0x85, 0x48, 0x80, 0x4f, 0x80, 0x51, 0x81, 0x56, 0x0b, 0x65, 0x65,
+    0x6a, 0x78, 0x83, 0xd6, 0xd6, 0x80, 0x93, 0xc2, 0x8a, 0x95, 0x82, 0x9b,
+    0x80, 0xd7, 0x15, 0xd8, 0xd9, 0xd9, 0xb5, 0xda, 0xdd, 0xe0, 0xe1, 0xa9,
+    0xad, 0xe8, 0xb2, 0xb2, 0xcc, 0xc1, 0xbb, 0x9a, 0xdd, 0xdb, 0xb4, 0xd9,
+    0xd8, 0x81, 0xd7, 0x07, 0x7d, 0xbf, 0x7f, 0xd6, 0x83, 0x83, 0x6c, 0x65,
+    0x80, 0x56, 0x82, 0x51, 0x08, 0x4f, 0x4c, 0x4f, 0x76, 0xa9, 0x61, 0x4a,
+    0x42, 0x3d, 0x80, 0x37, 0x01, 0x35, 0x35, 0x83, 0x31, 0x05, 0x2c, 0x2b,
+    0x28, 0x27, 0x25, 0x25, 0x80, 0x21, 0x84, 0x1b, 0x80, 0x17, 0x02, 0x19,
+    0x18, 0x18, 0x81, 0x15, 0x80, 0x12, 0x00, 0x15, 0x88, 0x12, 0x86, 0x0f,
+    0x06, 0x12, 0x12, 0x07, 0x05, 0x05, 0x0a, 0x0a, 0x85, 0x03, 0x04, 0x02,
+    0x04, 0x02, 0x02, 0x04, 0x84, 0x01, 0x82, 0x21, 0x00, 0x25, 0x80, 0x21,
+    0x00, 0x27, 0x99, 0x21, 0x01, 0x28, 0x28, 0x80, 0x21, 0x05, 0x27, 0x28,
+    0x25, 0x25, 0x23, 0x25, 0x81, 0x27, 0x81, 0x2a, 0x05, 0x31, 0x31, 0x2a,
+    0x28, 0x2a, 0x2a, 0x81, 0x27, 0x00, 0x2a, 0x80, 0x27, 0x81, 0x2a, 0x03,
+    0x28, 0x2b, 0x31, 0x2c, 0x8c, 0x2a, 0x01, 0x2c, 0x2b, 0x8d, 0x31, 0x03,
+    0x36, 0x36, 0x34, 0x34, 0x8b, 0x37, 0x00, 0x3d, 0x80, 0x40, 0x00, 0x42,
+    0x84, 0x48, 0x00, 0x4f, 0x80, 0x48, 0x01, 0x4f, 0x51, 0x80, 0x4f, 0x83,
+    0x51, 0x80, 0x56, 0x0c, 0x65, 0x6a, 0x6a, 0x6c, 0x78, 0x83, 0x80, 0x80,
+    0x89, 0xa4, 0x89, 0xa2, 0x81, 0x82, 0x9b, 0x18, 0xd7, 0xd7, 0xd8, 0xd8,
+    0xd9, 0xb4, 0xa6, 0xdb, 0xde, 0xb8, 0xa8, 0xe5, 0xb0, 0xeb, 0xea, 0xd2,
+    0xcb, 0xaa, 0xba, 0xe2, 0xdd, 0xda, 0xb5, 0xd9, 0xd8, 0x81, 0xd7, 0x08,
+    0x70, 0xc3, 0x8c, 0x9b, 0x9b, 0x83, 0x74, 0x6a, 0x65, 0x80, 0x56, 0x80,
+    0x51, 0x0a, 0x4f, 0x4f, 0x4c, 0x4f, 0x4c, 0x89, 0x97, 0x53, 0x48, 0x42,
+    0x41, 0x80, 0x37, 0x00, 0x36, 0x82, 0x31, 0x06, 0x2c, 0x2c, 0x2b, 0x28,
+    0x25, 0x23, 0x25, 0x81, 0x21, 0x83, 0x1b, 0x04, 0x1a, 0x1a, 0x19, 0x18,
+    0x18, 0x84, 0x15, 0x00, 0x14, 0x81, 0x15, 0x85, 0x12, 0x87, 0x0f, 0x02,
+    0x0c, 0x0b, 0x07, 0x81, 0x03, 0x00, 0x06, 0x83, 0x03, 0x00, 0x02, 0x85,
+    0x03, 0x80, 0x01, 0x86, 0x21, 0x00, 0x25, 0x99, 0x21, 0x01, 0x27, 0x27,
+    0x80, 0x21, 0x02, 0x25, 0x27, 0x23, 0x80, 0x25, 0x85, 0x27, 0x03, 0x2d,
+    0x2b, 0x2a, 0x28, 0x81, 0x2a, 0x00, 0x28, 0x81, 0x2a, 0x03, 0x28, 0x2c,
+    0x31, 0x2c, 0x81, 0x2a, 0x05, 0x2c, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x80,
+    0x2c, 0x05, 0x2b, 0x2c, 0x2b, 0x2c, 0x2b, 0x2b, 0x80, 0x2c, 0x03, 0x2f,
+    0x31, 0x31, 0x2f, 0x89, 0x31, 0x03, 0x36, 0x37, 0x36, 0x36, 0x8b, 0x37,
+    0x04, 0x41, 0x41, 0x42, 0x41, 0x42, 0x84, 0x48, 0x03, 0x4f, 0x4c, 0x4c,
+    0x4f, 0x88, 0x51, 0x01, 0x56, 0x5e, 0x80, 0x65, 0x0c, 0x6a, 0x80, 0x7d,
+    0x98, 0x92, 0x89, 0xa9, 0x70, 0x8b, 0xa2, 0x75, 0xd7, 0xd6, 0x82, 0xd7,
+    0x23, 0xd8, 0xd8, 0xd9, 0xb5, 0xdb, 0xdd, 0xe0, 0xe2, 0x9e, 0xc1, 0xc8,
+    0xb2, 0xd4, 0xe8, 0xbd, 0xba, 0x99, 0xb7, 0xde, 0xdb, 0xb5, 0xb4, 0xd8,
+    0xd8, 0xd7, 0xd7, 0x9c, 0x6b, 0xe6, 0x77, 0x83, 0xd6, 0x83, 0x6e, 0x6a,
+    0x65, 0x80, 0x56, 0x02, 0x4f, 0x51, 0x51, 0x82, 0x48, 0x04, 0x53, 0x85,
+    0x91, 0x86, 0x55, 0x80, 0x46, 0x02, 0x42, 0x3c, 0x36, 0x81, 0x31, 0x80,
+    0x2a, 0x00, 0x28, 0x80, 0x25, 0x81, 0x21, 0x83, 0x1b, 0x04, 0x1a, 0x1a,
+    0x19, 0x18, 0x18, 0x89, 0x15, 0x86, 0x12, 0x83, 0x0f, 0x01, 0x0c, 0x0f,
+    0x80, 0x0b, 0x05, 0x0a, 0x07, 0x05, 0x05, 0x06, 0x06, 0x84, 0x03, 0x00,
+    0x02, 0x85, 0x03, 0x03, 0x02, 0x02, 0x23, 0x23, 0x80, 0x25, 0x95, 0x21,
+    0x83, 0x27, 0x00, 0x25, 0x80, 0x21, 0x01, 0x25, 0x25, 0x82, 0x21, 0x00,
+    0x25, 0x80, 0x21, 0x80, 0x25, 0x83, 0x27, 0x80, 0x2a, 0x0c, 0x2c, 0x28,
+    0x28, 0x2b, 0x2b, 0x2c, 0x2b, 0x2c, 0x2b, 0x2c, 0x31, 0x2f, 0x2c, 0x86,
+    0x2a, 0x80, 0x31, 0x04, 0x2c, 0x2b, 0x2c, 0x2b, 0x2f, 0x81, 0x2c, 0x01,
+    0x2b, 0x2c, 0x80, 0x31, 0x00, 0x2c, 0x8b, 0x31, 0x04, 0x36, 0x39, 0x37,
+    0x36, 0x36, 0x82, 0x37, 0x03, 0x3d, 0x3d, 0x3c, 0x3d, 0x82, 0x40, 0x00,
+    0x42, 0x81, 0x46, 0x82, 0x48, 0x00, 0x4f, 0x85, 0x51, 0x81, 0x56, 0x12,
+    0x6a, 0x65, 0x6a, 0x68, 0x82, 0x8a, 0x93, 0x91, 0x75, 0x80, 0x80, 0xd6,
+    0x81, 0xa3, 0xa3, 0x87, 0x81, 0xb3, 0x9b, 0x80, 0xd7, 0x22, 0xd8, 0xd9,
+    0xb4, 0xb5, 0xdb, 0xdd, 0xb6, 0xa8, 0xab, 0xb0, 0xeb, 0xd5, 0xeb, 0xb0,
+    0xab, 0xa8, 0xb7, 0xa7, 0xdd, 0xdb, 0xa6, 0xb4, 0xd8, 0xd7, 0xd7, 0x80,
+    0x70, 0xa3, 0x8f, 0xb4, 0xd7, 0x83, 0x6c, 0x6a, 0x65, 0x82, 0x56, 0x01,
+    0x51, 0x4f, 0x81, 0x48, 0x0d, 0x42, 0x4a, 0x4f, 0x4e, 0x5c, 0x82, 0x7c,
+    0x82, 0x87, 0x82, 0x55, 0x44, 0x37, 0x34, 0x82, 0x2a, 0x82, 0x27, 0x00,
+    0x25, 0x83, 0x21, 0x80, 0x1b, 0x05, 0x1a, 0x19, 0x18, 0x16, 0x18, 0x18,
+    0x85, 0x15, 0x88, 0x12, 0x83, 0x0f, 0x82, 0x0b, 0x03, 0x0a, 0x0a, 0x05,
+    0x05, 0x80, 0x06, 0x8b, 0x03, 0x80, 0x01, 0x9a, 0x21, 0x83, 0x27, 0x06,
+    0x25, 0x27, 0x25, 0x27, 0x27, 0x25, 0x25, 0x81, 0x21, 0x02, 0x28, 0x23,
+    0x23, 0x81, 0x27, 0x87, 0x2a, 0x01, 0x28, 0x28, 0x81, 0x2a, 0x00, 0x2c,
+    0x81, 0x2a, 0x05, 0x2c, 0x2b, 0x2b, 0x28, 0x2a, 0x2c, 0x81, 0x2a, 0x02,
+    0x2c, 0x31, 0x31, 0x80, 0x2c, 0x03, 0x2b, 0x2b, 0x2c, 0x2c, 0x92, 0x31,
+    0x00, 0x36, 0x85, 0x37, 0x06, 0x3d, 0x41, 0x41, 0x3d, 0x41, 0x41, 0x3d,
+    0x80, 0x40, 0x00, 0x42, 0x87, 0x48, 0x00, 0x4f, 0x85, 0x51, 0x15, 0x56,
+    0x5b, 0x66, 0x6c, 0x86, 0x9a, 0xe1, 0x85, 0x90, 0x67, 0x80, 0x83, 0x9b,
+    0x83, 0xd6, 0x9b, 0x95, 0x86, 0x7f, 0xa4, 0xa2, 0xa6, 0x80, 0xd7, 0x23,
+    0xd8, 0xd8, 0xd9, 0xb4, 0x90, 0xdc, 0xde, 0xb7, 0xba, 0xad, 0xe8, 0xb2,
+    0xd5, 0xcf, 0xc9, 0xbb, 0xb9, 0xb7, 0xde, 0xdc, 0xa6, 0xb5, 0xb4, 0xd9,
+    0xd7, 0xd8, 0x75, 0x8f, 0xa3, 0x9d, 0x95, 0xd6, 0x83, 0x6a, 0x6a, 0x65,
+    0x81, 0x56, 0x02, 0x53, 0x51, 0x4f, 0x81, 0x48, 0x10, 0x42, 0x4a, 0x4a,
+    0x42, 0x42, 0x4c, 0x4e, 0x5a, 0x5a, 0x70, 0x76, 0x7f, 0x68, 0x4e, 0x36,
+    0x2c, 0x31, 0x80, 0x2a, 0x01, 0x28, 0x25, 0x80, 0x27, 0x81, 0x21, 0x02,
+    0x25, 0x23, 0x21, 0x80, 0x1b, 0x01, 0x1a, 0x19, 0x80, 0x17, 0x84, 0x15,
+    0x88, 0x12, 0x85, 0x0f, 0x83, 0x0b, 0x80, 0x06, 0x03, 0x0b, 0x0b, 0x0a,
+    0x07, 0x8a, 0x03, 0x01, 0x02, 0x02, 0x8b, 0x21, 0x03, 0x25, 0x25, 0x27,
+    0x25, 0x83, 0x21, 0x81, 0x25, 0x01, 0x23, 0x25, 0x8a, 0x27, 0x07, 0x25,
+    0x23, 0x25, 0x28, 0x23, 0x25, 0x28, 0x28, 0x82, 0x2a, 0x0c, 0x2c, 0x2b,
+    0x2b, 0x28, 0x2b, 0x2b, 0x2c, 0x2b, 0x28, 0x2c, 0x2b, 0x2b, 0x2c, 0x85,
+    0x2a, 0x01, 0x28, 0x28, 0x82, 0x2a, 0x0a, 0x31, 0x31, 0x2f, 0x2c, 0x31,
+    0x2c, 0x31, 0x31, 0x2b, 0x2b, 0x2c, 0x8a, 0x31, 0x03, 0x37, 0x39, 0x36,
+    0x35, 0x80, 0x31, 0x00, 0x36, 0x86, 0x37, 0x82, 0x3d, 0x00, 0x3c, 0x80,
+    0x40, 0x00, 0x42, 0x86, 0x48, 0x01, 0x4f, 0x4f, 0x81, 0x51, 0x81, 0x56,
+    0x0d, 0x65, 0x5b, 0x70, 0x9a, 0x99, 0x75, 0x81, 0x80, 0x65, 0x74, 0x83,
+    0xd6, 0x95, 0x83, 0x81, 0x9b, 0x1d, 0xb3, 0xb4, 0x93, 0x9f, 0xd8, 0xb3,
+    0xd7, 0xd8, 0xd9, 0xd9, 0xb5, 0xdb, 0xdd, 0xa7, 0xb8, 0x9f, 0xc4, 0xce,
+    0xea, 0xd5, 0xd0, 0xc9, 0xbb, 0xe2, 0xb6, 0xde, 0xdc, 0xa6, 0xb4, 0xd9,
+    0x80, 0x9c, 0x0a, 0x77, 0xca, 0x8d, 0x95, 0x83, 0xd6, 0x83, 0x83, 0x6a,
+    0x65, 0x65, 0x80, 0x56, 0x02, 0x53, 0x51, 0x4f, 0x81, 0x48, 0x80, 0x42,
+    0x80, 0x40, 0x0a, 0x42, 0x42, 0x39, 0x3d, 0x41, 0x5a, 0x77, 0xa2, 0x68,
+    0x37, 0x31, 0x81, 0x2a, 0x80, 0x27, 0x01, 0x25, 0x25, 0x83, 0x21, 0x80,
+    0x1b, 0x05, 0x1a, 0x1a, 0x19, 0x18, 0x16, 0x18, 0x82, 0x15, 0x89, 0x12,
+    0x89, 0x0f, 0x80, 0x0b, 0x00, 0x0a, 0x80, 0x0b, 0x84, 0x06, 0x85, 0x03,
+    0x01, 0x02, 0x04, 0x82, 0x21, 0x00, 0x25, 0x85, 0x21, 0x03, 0x25, 0x25,
+    0x28, 0x28, 0x82, 0x21, 0x80, 0x25, 0x03, 0x27, 0x27, 0x25, 0x25, 0x8b,
+    0x27, 0x00, 0x23, 0x81, 0x27, 0x85, 0x2a, 0x02, 0x2c, 0x2b, 0x28, 0x82,
+    0x2a, 0x00, 0x31, 0x82, 0x2a, 0x01, 0x28, 0x28, 0x82, 0x2a, 0x02, 0x28,
+    0x2b, 0x2c, 0x80, 0x2a, 0x02, 0x2c, 0x31, 0x2f, 0x81, 0x31, 0x01, 0x2c,
+    0x2b, 0x80, 0x2c, 0x01, 0x2b, 0x2c, 0x87, 0x31, 0x02, 0x36, 0x37, 0x36,
+    0x80, 0x31, 0x00, 0x36, 0x8a, 0x37, 0x08, 0x3d, 0x3c, 0x39, 0x41, 0x42,
+    0x41, 0x42, 0x42, 0x46, 0x84, 0x48, 0x05, 0x4f, 0x4f, 0x53, 0x56, 0x51,
+    0x53, 0x81, 0x56, 0x0b, 0x65, 0x70, 0x9e, 0x75, 0x6e, 0x6a, 0x6a, 0x78,
+    0x78, 0x74, 0x83, 0x83, 0x84, 0x9b, 0x22, 0x80, 0x76, 0xc2, 0xb5, 0xd7,
+    0xd7, 0xd8, 0xd9, 0xb4, 0xb5, 0xdb, 0xde, 0xb6, 0x9a, 0xab, 0xc9, 0xc8,
+    0xd4, 0xea, 0xeb, 0xaf, 0xbb, 0xe2, 0xb6, 0xdd, 0xdc, 0xa6, 0xb4, 0xd9,
+    0xd8, 0xd9, 0x90, 0xac, 0xa0, 0x80, 0x81, 0x9b, 0x05, 0x6e, 0x6a, 0x65,
+    0x65, 0x5b, 0x56, 0x80, 0x51, 0x00, 0x4f, 0x81, 0x48, 0x01, 0x42, 0x42,
+    0x80, 0x40, 0x01, 0x39, 0x36, 0x81, 0x37, 0x07, 0x40, 0x49, 0x7b, 0x8e,
+    0x3d, 0x31, 0x30, 0x2a, 0x83, 0x27, 0x01, 0x25, 0x25, 0x80, 0x21, 0x83,
+    0x1b, 0x80, 0x17, 0x02, 0x15, 0x18, 0x18, 0x80, 0x15, 0x8b, 0x12, 0x88,
+    0x0f, 0x80, 0x0b, 0x00, 0x0a, 0x80, 0x0b, 0x84, 0x06, 0x01, 0x05, 0x07,
+    0x85, 0x03, 0x82, 0x21, 0x00, 0x27, 0x86, 0x21, 0x06, 0x25, 0x28, 0x28,
+    0x25, 0x25, 0x27, 0x27, 0x80, 0x25, 0x81, 0x27, 0x00, 0x25, 0x86, 0x27,
+    0x00, 0x25, 0x80, 0x27, 0x02, 0x25, 0x23, 0x23, 0x80, 0x27, 0x81, 0x2a,
+    0x02, 0x28, 0x2a, 0x2a, 0x82, 0x27, 0x81, 0x2a, 0x00, 0x2c, 0x80, 0x2a,
+    0x01, 0x2c, 0x2f, 0x80, 0x27, 0x80, 0x2a, 0x08, 0x28, 0x28, 0x2b, 0x2c,
+    0x2b, 0x2c, 0x2b, 0x2c, 0x2c, 0x84, 0x31, 0x00, 0x2c, 0x8b, 0x31, 0x02,
+    0x36, 0x39, 0x36, 0x80, 0x31, 0x87, 0x37, 0x84, 0x3d, 0x83, 0x42, 0x00,
+    0x46, 0x83, 0x48, 0x03, 0x4f, 0x4f, 0x53, 0x53, 0x81, 0x56, 0x0c, 0x65,
+    0x65, 0x7d, 0x9e, 0x86, 0x6c, 0x65, 0x6a, 0x65, 0x6a, 0x6c, 0x78, 0x83,
+    0x85, 0x9b, 0x2c, 0x95, 0x77, 0xe7, 0xb4, 0xd7, 0xd8, 0xd8, 0xd9, 0xb4,
+    0xb5, 0xdc, 0xa7, 0x9a, 0xbb, 0xc4, 0xc9, 0xce, 0xb2, 0xb2, 0xd0, 0xc4,
+    0xe4, 0xe2, 0xe0, 0xdd, 0xdc, 0xa6, 0xb4, 0xd9, 0xd8, 0xd8, 0x97, 0xbf,
+    0x8b, 0xb3, 0xd6, 0x95, 0x9b, 0x83, 0x78, 0x6a, 0x6a, 0x65, 0x5e, 0x56,
+    0x80, 0x51, 0x01, 0x4f, 0x4f, 0x80, 0x48, 0x01, 0x42, 0x42, 0x80, 0x40,
+    0x01, 0x3d, 0x3d, 0x81, 0x37, 0x0a, 0x31, 0x39, 0x46, 0x86, 0x61, 0x3c,
+    0x36, 0x31, 0x28, 0x2b, 0x2b, 0x81, 0x27, 0x01, 0x23, 0x25, 0x80, 0x21,
+    0x83, 0x1b, 0x02, 0x1a, 0x18, 0x16, 0x80, 0x17, 0x01, 0x15, 0x15, 0x8e,
+    0x12, 0x01, 0x11, 0x12, 0x83, 0x0f, 0x80, 0x0b, 0x02, 0x0a, 0x0b, 0x0b,
+    0x81, 0x06, 0x03, 0x0b, 0x0a, 0x0b, 0x0a, 0x82, 0x03, 0x04, 0x02, 0x02,
+    0x04, 0x04, 0x02, 0x81, 0x21, 0x80, 0x25, 0x81, 0x21, 0x00, 0x25, 0x81,
+    0x21, 0x85, 0x27, 0x02, 0x25, 0x28, 0x27, 0x80, 0x25, 0x85, 0x27, 0x07,
+    0x25, 0x23, 0x25, 0x28, 0x27, 0x25, 0x23, 0x25, 0x82, 0x27, 0x82, 0x2a,
+    0x01, 0x28, 0x2a, 0x80, 0x27, 0x85, 0x2a, 0x01, 0x2c, 0x2f, 0x81, 0x27,
+    0x80, 0x2a, 0x02, 0x28, 0x2b, 0x2b, 0x81, 0x2c, 0x00, 0x2b, 0x93, 0x31,
+    0x02, 0x36, 0x39, 0x37, 0x80, 0x31, 0x03, 0x36, 0x36, 0x37, 0x36, 0x83,
+    0x37, 0x84, 0x40, 0x84, 0x42, 0x82, 0x48, 0x02, 0x4f, 0x51, 0x4f, 0x82,
+    0x56, 0x10, 0x6a, 0x6c, 0x68, 0x92, 0x75, 0x6a, 0x65, 0x6a, 0x6c, 0x6a,
+    0x6a, 0x65, 0x6a, 0x83, 0xd6, 0xd6, 0x83, 0x82, 0x9b, 0x02, 0xd9, 0xa2,
+    0x97, 0x80, 0x9c, 0x1c, 0xd9, 0xb4, 0xb4, 0xa6, 0xdc, 0xe0, 0x9f, 0xab,
+    0xad, 0xcb, 0xd1, 0xea, 0xb1, 0xcc, 0xc1, 0x9e, 0xe1, 0xe0, 0xdd, 0xdb,
+    0xa6, 0xb4, 0xd9, 0xd8, 0x7d, 0xa3, 0x7c, 0x9c, 0x95, 0x80, 0x9b, 0x04,
+    0x78, 0x78, 0x6a, 0x6a, 0x65, 0x80, 0x56, 0x03, 0x53, 0x53, 0x4f, 0x4f,
+    0x80, 0x48, 0x80, 0x42, 0x01, 0x41, 0x3d, 0x80, 0x37, 0x0b, 0x36, 0x35,
+    0x35, 0x2c, 0x35, 0x34, 0x42, 0x86, 0x68, 0x5a, 0x42, 0x31, 0x80, 0x2a,
+    0x04, 0x28, 0x23, 0x27, 0x27, 0x25, 0x81, 0x21, 0x82, 0x1b, 0x80, 0x17,
+    0x01, 0x19, 0x18, 0x81, 0x15, 0x90, 0x12, 0x82, 0x0f, 0x01, 0x0c, 0x0f,
+    0x83, 0x0b, 0x81, 0x06, 0x04, 0x0b, 0x0a, 0x0a, 0x05, 0x07, 0x83, 0x03,
+    0x00, 0x02, 0x83, 0x21, 0x03, 0x25, 0x23, 0x23, 0x25, 0x83, 0x21, 0x06,
+    0x25, 0x25, 0x28, 0x25, 0x23, 0x25, 0x25, 0x80, 0x27, 0x02, 0x25, 0x25,
+    0x23, 0x85, 0x27, 0x01, 0x25, 0x23, 0x80, 0x25, 0x01, 0x23, 0x25, 0x81,
+    0x27, 0x00, 0x25, 0x81, 0x27, 0x83, 0x2a, 0x80, 0x27, 0x09, 0x2a, 0x28,
+    0x2a, 0x28, 0x28, 0x2b, 0x2c, 0x2b, 0x2b, 0x28, 0x82, 0x2a, 0x03, 0x31,
+    0x2b, 0x2b, 0x2c, 0x88, 0x31, 0x00, 0x2f, 0x88, 0x31, 0x04, 0x36, 0x37,
+    0x31, 0x31, 0x36, 0x80, 0x37, 0x02, 0x36, 0x36, 0x34, 0x80, 0x36, 0x84,
+    0x37, 0x83, 0x40, 0x82, 0x42, 0x06, 0x48, 0x42, 0x46, 0x4c, 0x4f, 0x4c,
+    0x4c, 0x80, 0x51, 0x81, 0x56, 0x0a, 0x67, 0x8d, 0x89, 0xa7, 0x75, 0x6a,
+    0x6c, 0x65, 0x5e, 0x65, 0x6a, 0x81, 0x78, 0x84, 0x9b, 0x23, 0xd7, 0x89,
+    0xa2, 0x7d, 0xd7, 0xd8, 0xd8, 0xd9, 0xb4, 0xb5, 0xdb, 0xde, 0xb7, 0xe5,
+    0xe4, 0xab, 0xb0, 0xeb, 0xea, 0xd2, 0xcb, 0xab, 0xba, 0x99, 0xe0, 0xdd,
+    0xdc, 0xb5, 0xb4, 0xd9, 0x81, 0x7f, 0xc6, 0x91, 0x9c, 0xd7, 0x80, 0x9b,
+    0x80, 0x78, 0x00, 0x6a, 0x83, 0x56, 0x01, 0x51, 0x4f, 0x80, 0x48, 0x80,
+    0x42, 0x01, 0x41, 0x3d, 0x81, 0x37, 0x01, 0x36, 0x37, 0x80, 0x31, 0x0a,
+    0x39, 0x42, 0x42, 0x5a, 0x73, 0x6c, 0x4e, 0x31, 0x28, 0x25, 0x23, 0x80,
+    0x25, 0x81, 0x21, 0x82, 0x1b, 0x82, 0x17, 0x82, 0x15, 0x8d, 0x12, 0x02,
+    0x11, 0x12, 0x12, 0x81, 0x0f, 0x80, 0x0b, 0x01, 0x0f, 0x0f, 0x83, 0x0b,
+    0x04, 0x0a, 0x0b, 0x0a, 0x0a, 0x05, 0x81, 0x06, 0x80, 0x03, 0x00, 0x02,
+    0x83, 0x21, 0x80, 0x25, 0x01, 0x23, 0x25, 0x84, 0x21, 0x05, 0x27, 0x25,
+    0x23, 0x23, 0x25, 0x25, 0x80, 0x27, 0x01, 0x25, 0x25, 0x84, 0x27, 0x05,
+    0x25, 0x25, 0x23, 0x23, 0x25, 0x25, 0x82, 0x27, 0x04, 0x25, 0x23, 0x23,
+    0x25, 0x28, 0x81, 0x2a, 0x00, 0x2c, 0x80, 0x2a, 0x07, 0x28, 0x2a, 0x2a,
+    0x28, 0x2a, 0x2a, 0x28, 0x2a, 0x80, 0x27, 0x04, 0x2b, 0x2b, 0x2c, 0x31,
+    0x2c, 0x84, 0x31, 0x00, 0x2c, 0x82, 0x31, 0x00, 0x2c, 0x8c, 0x31, 0x00,
+    0x36, 0x80, 0x31, 0x80, 0x37, 0x03, 0x36, 0x37, 0x36, 0x36, 0x87, 0x37,
+    0x81, 0x40, 0x82, 0x42, 0x03, 0x48, 0x42, 0x42, 0x43, 0x80, 0x48, 0x00,
+    0x50, 0x80, 0x51, 0x11, 0x56, 0x5e, 0x80, 0x96, 0x9f, 0x92, 0x81, 0x78,
+    0x78, 0x6a, 0x6a, 0x65, 0x65, 0x6a, 0x6c, 0x74, 0x83, 0x83, 0x85, 0x9b,
+    0x22, 0x81, 0xac, 0x91, 0xd8, 0xd7, 0xd8, 0xd8, 0xd9, 0xb4, 0xa6, 0xdc,
+    0x98, 0xb7, 0x9e, 0x9f, 0xa1, 0xb0, 0xd3, 0xea, 0xd1, 0xc9, 0xab, 0x97,
+    0xb8, 0xe0, 0xdd, 0xdc, 0xa6, 0xb4, 0xb4, 0x8d, 0xbf, 0xa2, 0x75, 0xd7,
+    0x82, 0x9b, 0x02, 0x83, 0x78, 0x6a, 0x83, 0x56, 0x01, 0x51, 0x4f, 0x83,
+    0x48, 0x01, 0x42, 0x41, 0x85, 0x37, 0x10, 0x36, 0x36, 0x34, 0x31, 0x39,
+    0x4c, 0x5f, 0x9d, 0x5a, 0x3d, 0x2f, 0x2b, 0x23, 0x23, 0x25, 0x27, 0x25,
+    0x80, 0x21, 0x81, 0x1b, 0x82, 0x17, 0x82, 0x15, 0x03, 0x14, 0x14, 0x15,
+    0x15, 0x83, 0x12, 0x00, 0x15, 0x81, 0x12, 0x02, 0x11, 0x11, 0x12, 0x88,
+    0x0f, 0x02, 0x0c, 0x0f, 0x0f, 0x82, 0x0b, 0x83, 0x06, 0x81, 0x03, 0x86,
+    0x21, 0x00, 0x25, 0x85, 0x21, 0x00, 0x25, 0x81, 0x21, 0x05, 0x25, 0x27,
+    0x28, 0x25, 0x27, 0x25, 0x83, 0x27, 0x01, 0x25, 0x25, 0x81, 0x21, 0x84,
+    0x27, 0x07, 0x25, 0x27, 0x28, 0x2b, 0x2c, 0x2c, 0x2b, 0x2c, 0x80, 0x31,
+    0x84, 0x2a, 0x03, 0x28, 0x2b, 0x28, 0x28, 0x80, 0x2a, 0x88, 0x31, 0x00,
+    0x2f, 0x80, 0x31, 0x01, 0x2f, 0x2b, 0x90, 0x31, 0x00, 0x36, 0x8d, 0x37,
+    0x01, 0x41, 0x41, 0x81, 0x42, 0x02, 0x41, 0x42, 0x42, 0x80, 0x48, 0x16,
+    0x42, 0x4c, 0x4f, 0x53, 0x5b, 0x65, 0x67, 0x80, 0x81, 0x8c, 0x90, 0xa7,
+    0xe1, 0x6e, 0x6a, 0x6c, 0x6a, 0x65, 0x65, 0x6c, 0x78, 0x74, 0x6a, 0x80,
+    0x78, 0x84, 0x9b, 0x03, 0x95, 0x79, 0xbe, 0x96, 0x81, 0x9c, 0x1b, 0xd9,
+    0xb5, 0xdb, 0xdd, 0xa7, 0xb7, 0x9e, 0xe5, 0xab, 0xcb, 0xd2, 0xea, 0xeb,
+    0xcb, 0xe5, 0xa8, 0xb7, 0xa7, 0xdd, 0xdb, 0xb5, 0xb5, 0xa6, 0xa0, 0xbf,
+    0x90, 0xd7, 0xb3, 0x82, 0x9b, 0x04, 0x83, 0x78, 0x6a, 0x65, 0x65, 0x81,
+    0x56, 0x01, 0x51, 0x4f, 0x80, 0x48, 0x00, 0x46, 0x80, 0x42, 0x01, 0x41,
+    0x3d, 0x83, 0x37, 0x0e, 0x36, 0x36, 0x35, 0x31, 0x38, 0x34, 0x2c, 0x31,
+    0x4c, 0x67, 0x6a, 0x4a, 0x2b, 0x23, 0x25, 0x80, 0x27, 0x00, 0x25, 0x80,
+    0x21, 0x80, 0x1b, 0x81, 0x17, 0x01, 0x19, 0x18, 0x81, 0x15, 0x03, 0x14,
+    0x14, 0x15, 0x15, 0x83, 0x12, 0x00, 0x15, 0x81, 0x12, 0x8f, 0x0f, 0x83,
+    0x0b, 0x82, 0x06, 0x80, 0x03, 0x8d, 0x21, 0x11, 0x25, 0x23, 0x25, 0x27,
+    0x25, 0x25, 0x23, 0x23, 0x25, 0x27, 0x25, 0x27, 0x28, 0x23, 0x23, 0x25,
+    0x27, 0x25, 0x82, 0x21, 0x01, 0x25, 0x25, 0x86, 0x27, 0x0e, 0x2b, 0x2f,
+    0x31, 0x2c, 0x28, 0x2a, 0x2c, 0x2c, 0x31, 0x2b, 0x28, 0x2a, 0x2a, 0x28,
+    0x28, 0x80, 0x2a, 0x00, 0x2c, 0x81, 0x2a, 0x81, 0x31, 0x00, 0x2b, 0x82,
+    0x2c, 0x82, 0x31, 0x00, 0x2f, 0x82, 0x31, 0x00, 0x35, 0x84, 0x31, 0x00,
+    0x35, 0x84, 0x31, 0x00, 0x36, 0x8a, 0x37, 0x81, 0x40, 0x84, 0x42, 0x80,
+    0x48, 0x11, 0x4f, 0x5e, 0x61, 0x61, 0x90, 0x8b, 0x90, 0x73, 0x80, 0x67,
+    0x6a, 0x90, 0x7d, 0x5e, 0x65, 0x65, 0x66, 0x66, 0x80, 0x6a, 0x01, 0x65,
+    0x6c, 0x80, 0x78, 0x84, 0x9b, 0x23, 0x83, 0x87, 0x93, 0x81, 0xd7, 0xd9,
+    0xd8, 0xd9, 0xb4, 0xa6, 0xdb, 0xdd, 0xa7, 0xb8, 0xbb, 0xbd, 0xc1, 0xb0,
+    0xeb, 0xb2, 0xd1, 0xcb, 0xaa, 0xb9, 0xb6, 0xde, 0xdc, 0xa6, 0xb5, 0xb5,
+    0x8c, 0xcd, 0x8e, 0x81, 0xd7, 0x95, 0x82, 0x9b, 0x04, 0x83, 0x78, 0x6a,
+    0x65, 0x65, 0x81, 0x56, 0x01, 0x51, 0x4f, 0x80, 0x48, 0x81, 0x42, 0x02,
+    0x41, 0x41, 0x3d, 0x82, 0x37, 0x15, 0x36, 0x36, 0x37, 0x35, 0x31, 0x31,
+    0x2b, 0x31, 0x31, 0x36, 0x37, 0x3c, 0x31, 0x25, 0x22, 0x25, 0x28, 0x28,
+    0x25, 0x25, 0x22, 0x21, 0x83, 0x1b, 0x07, 0x1a, 0x1a, 0x19, 0x18, 0x18,
+    0x16, 0x15, 0x14, 0x80, 0x15, 0x82, 0x12, 0x01, 0x15, 0x15, 0x82, 0x12,
+    0x05, 0x11, 0x12, 0x12, 0x11, 0x11, 0x12, 0x88, 0x0f, 0x83, 0x0b, 0x04,
+    0x0a, 0x0b, 0x0a, 0x0a, 0x0b, 0x80, 0x06, 0x8f, 0x21, 0x81, 0x27, 0x08,
+    0x23, 0x23, 0x25, 0x25, 0x27, 0x25, 0x28, 0x27, 0x25, 0x80, 0x27, 0x04,
+    0x23, 0x25, 0x25, 0x23, 0x23, 0x88, 0x27, 0x80, 0x2a, 0x80, 0x27, 0x80,
+    0x2c, 0x02, 0x2b, 0x28, 0x28, 0x84, 0x2a, 0x02, 0x31, 0x31, 0x2c, 0x93,
+    0x31, 0x00, 0x36, 0x85, 0x31, 0x03, 0x36, 0x37, 0x37, 0x36, 0x81, 0x31,
+    0x8a, 0x37, 0x01, 0x41, 0x42, 0x80, 0x40, 0x02, 0x42, 0x41, 0x41, 0x81,
+    0x42, 0x14, 0x4a, 0x4a, 0x61, 0x8d, 0x89, 0x7b, 0x76, 0x5e, 0x4f, 0x56,
+    0x5e, 0x54, 0x5e, 0x84, 0x73, 0x5b, 0x65, 0x65, 0x66, 0x66, 0x6c, 0x80,
+    0x6a, 0x81, 0x78, 0x84, 0x9b, 0x23, 0x83, 0x93, 0xba, 0xd8, 0xd7, 0xd9,
+    0xd8, 0xd9, 0xb5, 0xda, 0xdc, 0xde, 0xe0, 0xb9, 0xe5, 0xbd, 0xc9, 0xe8,
+    0xe9, 0xd4, 0xcf, 0xc9, 0xbb, 0xe2, 0xb6, 0xa7, 0xdc, 0xa6, 0xb5, 0xa6,
+    0x91, 0xac, 0xbe, 0x7f, 0xb4, 0xd7, 0x81, 0x9b, 0x80, 0x78, 0x01, 0x6a,
+    0x6a, 0x80, 0x65, 0x03, 0x5b, 0x56, 0x53, 0x4f, 0x81, 0x48, 0x02, 0x46,
+    0x4a, 0x42, 0x80, 0x40, 0x00, 0x3d, 0x82, 0x37, 0x84, 0x31, 0x08, 0x2a,
+    0x2b, 0x23, 0x28, 0x2f, 0x25, 0x22, 0x23, 0x25, 0x80, 0x21, 0x87, 0x1b,
+    0x84, 0x17, 0x00, 0x19, 0x81, 0x15, 0x00, 0x14, 0x80, 0x15, 0x89, 0x12,
+    0x87, 0x0f, 0x85, 0x0b, 0x02, 0x0a, 0x0a, 0x0b, 0x80, 0x06, 0x8d, 0x21,
+    0x03, 0x25, 0x25, 0x27, 0x27, 0x80, 0x25, 0x00, 0x23, 0x80, 0x25, 0x84,
+    0x27, 0x81, 0x25, 0x8a, 0x27, 0x05, 0x2b, 0x2b, 0x28, 0x2a, 0x28, 0x28,
+    0x83, 0x2a, 0x03, 0x2c, 0x2c, 0x31, 0x2c, 0x83, 0x31, 0x00, 0x2f, 0x88,
+    0x31, 0x01, 0x2c, 0x2c, 0x85, 0x31, 0x01, 0x37, 0x36, 0x84, 0x31, 0x01,
+    0x37, 0x37, 0x82, 0x31, 0x88, 0x37, 0x1c, 0x3d, 0x40, 0x42, 0x42, 0x41,
+    0x41, 0x42, 0x42, 0x41, 0x42, 0x4a, 0x4a, 0x42, 0x42, 0x4c, 0x5f, 0xe0,
+    0x67, 0x53, 0x56, 0x51, 0x56, 0x5b, 0x53, 0x56, 0x6a, 0x83, 0xb5, 0x6a,
+    0x80, 0x65, 0x05, 0x6a, 0x74, 0x78, 0x6e, 0x6c, 0x6c, 0x80, 0x78, 0x85,
+    0x9b, 0x24, 0x83, 0x97, 0xa9, 0xd8, 0xd7, 0xd9, 0xd9, 0xb4, 0xb5, 0xdb,
+    0xdd, 0xa7, 0xb8, 0xba, 0xaa, 0xc1, 0xcd, 0xd2, 0xb2, 0xb1, 0xcc, 0xc9,
+    0xab, 0xa8, 0xb6, 0xde, 0xdc, 0xda, 0xdb, 0xde, 0xde, 0xa6, 0x99, 0xa4,
+    0xaa, 0xa6, 0x95, 0x81, 0x9b, 0x03, 0x83, 0x78, 0x6c, 0x6a, 0x80, 0x65,
+    0x80, 0x56, 0x00, 0x51, 0x80, 0x4f, 0x81, 0x48, 0x06, 0x42, 0x42, 0x41,
+    0x3d, 0x3c, 0x39, 0x3d, 0x80, 0x37, 0x00, 0x36, 0x83, 0x31, 0x80, 0x2a,
+    0x80, 0x27, 0x02, 0x25, 0x28, 0x25, 0x80, 0x21, 0x86, 0x1b, 0x01, 0x1a,
+    0x19, 0x82, 0x17, 0x01, 0x19, 0x18, 0x84, 0x15, 0x8b, 0x12, 0x86, 0x0f,
+    0x80, 0x0b, 0x01, 0x0f, 0x0f, 0x85, 0x0b, 0x89, 0x21, 0x00, 0x25, 0x81,
+    0x21, 0x03, 0x25, 0x27, 0x27, 0x25, 0x83, 0x21, 0x00, 0x25, 0x83, 0x27,
+    0x80, 0x21, 0x84, 0x27, 0x02, 0x25, 0x27, 0x2b, 0x81, 0x27, 0x05, 0x2a,
+    0x2c, 0x28, 0x2b, 0x28, 0x28, 0x80, 0x2a, 0x02, 0x2c, 0x2c, 0x2f, 0x8b,
+    0x31, 0x00, 0x2c, 0x82, 0x31, 0x00, 0x2c, 0x80, 0x2a, 0x85, 0x31, 0x00,
+    0x37, 0x86, 0x31, 0x01, 0x36, 0x37, 0x80, 0x36, 0x83, 0x37, 0x83, 0x3d,
+    0x01, 0x41, 0x3d, 0x80, 0x40, 0x82, 0x42, 0x07, 0x48, 0x4a, 0x42, 0x48,
+    0x4c, 0x53, 0x8d, 0x65, 0x81, 0x51, 0x05, 0x56, 0x54, 0x6a, 0x9c, 0x83,
+    0x6c, 0x81, 0x65, 0x04, 0x6c, 0x6c, 0x78, 0x74, 0x6c, 0x80, 0x78, 0x86,
+    0x9b, 0x27, 0x95, 0x89, 0x9f, 0xd8, 0xd8, 0xd9, 0xd9, 0xb4, 0xa6, 0xdc,
+    0xde, 0xb6, 0xa8, 0xbb, 0xab, 0xc4, 0xce, 0xb2, 0xd4, 0xce, 0xc9, 0xbd,
+    0xab, 0xab, 0x85, 0xdd, 0xdc, 0xdb, 0xb6, 0xdc, 0xb4, 0xd9, 0xd9, 0xa6,
+    0x9f, 0xac, 0x80, 0xd7, 0xd6, 0x9b, 0x80, 0x78, 0x80, 0x6a, 0x00, 0x65,
+    0x81, 0x56, 0x00, 0x51, 0x80, 0x4f, 0x81, 0x48, 0x01, 0x42, 0x42, 0x81,
+    0x40, 0x82, 0x37, 0x06, 0x36, 0x36, 0x37, 0x36, 0x34, 0x31, 0x2b, 0x83,
+    0x27, 0x00, 0x2b, 0x80, 0x27, 0x01, 0x23, 0x21, 0x80, 0x1b, 0x06, 0x21,
+    0x21, 0x1d, 0x1b, 0x1a, 0x1a, 0x19, 0x83, 0x17, 0x8d, 0x15, 0x83, 0x12,
+    0x01, 0x11, 0x12, 0x88, 0x0f, 0x86, 0x0b, 0x8e, 0x21, 0x00, 0x25, 0x80,
+    0x21, 0x04, 0x25, 0x23, 0x23, 0x25, 0x25, 0x82, 0x27, 0x80, 0x25, 0x02,
+    0x23, 0x25, 0x23, 0x84, 0x27, 0x02, 0x25, 0x27, 0x2b, 0x82, 0x27, 0x84,
+    0x2a, 0x03, 0x2c, 0x31, 0x31, 0x2c, 0x8b, 0x31, 0x00, 0x2c, 0x83, 0x31,
+    0x01, 0x2f, 0x2b, 0x85, 0x31, 0x01, 0x35, 0x36, 0x85, 0x31, 0x00, 0x36,
+    0x88, 0x37, 0x01, 0x41, 0x41, 0x80, 0x3d, 0x81, 0x40, 0x83, 0x42, 0x82,
+    0x48, 0x04, 0x4f, 0x4f, 0x7f, 0x67, 0x4f, 0x80, 0x51, 0x06, 0x56, 0x5b,
+    0x6e, 0xb3, 0x65, 0x5e, 0x5b, 0x80, 0x65, 0x04, 0x74, 0x78, 0x78, 0x74,
+    0x6c, 0x80, 0x78, 0x86, 0x9b, 0x1e, 0x95, 0x97, 0x9f, 0xd9, 0xd8, 0xd9,
+    0xd9, 0xb5, 0xdb, 0xdd, 0xdf, 0xb7, 0xa8, 0xe4, 0xbd, 0xcb, 0xd2, 0xd5,
+    0xe9, 0xcc, 0xc9, 0xbb, 0xa9, 0xab, 0xa1, 0xe2, 0xde, 0xe0, 0xa7, 0xb4,
+    0xd9, 0x80, 0x9c, 0x03, 0x90, 0xc3, 0x8c, 0x83, 0x80, 0x9b, 0x80, 0x78,
+    0x03, 0x6a, 0x6a, 0x65, 0x65, 0x80, 0x56, 0x00, 0x53, 0x81, 0x4f, 0x82,
+    0x48, 0x00, 0x42, 0x80, 0x40, 0x85, 0x37, 0x04, 0x36, 0x34, 0x31, 0x2c,
+    0x2b, 0x86, 0x27, 0x02, 0x25, 0x22, 0x1d, 0x82, 0x21, 0x03, 0x1b, 0x1a,
+    0x1a, 0x19, 0x88, 0x17, 0x87, 0x15, 0x89, 0x12, 0x86, 0x0f, 0x85, 0x0b,
+    0x91, 0x21, 0x01, 0x25, 0x23, 0x80, 0x25, 0x04, 0x27, 0x25, 0x28, 0x27,
+    0x25, 0x82, 0x21, 0x03, 0x25, 0x28, 0x25, 0x27, 0x80, 0x25, 0x04, 0x28,
+    0x27, 0x25, 0x27, 0x2a, 0x83, 0x27, 0x04, 0x2b, 0x2c, 0x2f, 0x31, 0x2c,
+    0x80, 0x2a, 0x03, 0x2c, 0x2b, 0x31, 0x2f, 0x85, 0x31, 0x01, 0x2f, 0x2c,
+    0x87, 0x31, 0x00, 0x2c, 0x87, 0x31, 0x07, 0x36, 0x34, 0x36, 0x36, 0x34,
+    0x34, 0x36, 0x36, 0x89, 0x37, 0x00, 0x41, 0x81, 0x3d, 0x81, 0x40, 0x84,
+    0x42, 0x0f, 0x48, 0x46, 0x4a, 0x4c, 0x4f, 0x5a, 0x9a, 0x67, 0x4f, 0x51,
+    0x54, 0x4f, 0x53, 0x5e, 0x83, 0x83, 0x81, 0x56, 0x01, 0x65, 0x6a, 0x84,
+    0x78, 0x86, 0x9b, 0x26, 0xb3, 0x8b, 0xc3, 0x91, 0xd9, 0xd8, 0xd9, 0xb4,
+    0xb5, 0xdb, 0xdd, 0xe0, 0xb7, 0xb9, 0x9e, 0xc1, 0xb0, 0xeb, 0xea, 0xd4,
+    0xcc, 0xc4, 0xaa, 0xa8, 0x99, 0x9a, 0xba, 0xbb, 0xb9, 0xa6, 0xb4, 0xd8,
+    0xd8, 0xd7, 0xd7, 0xd8, 0x9f, 0x97, 0x80, 0x81, 0x9b, 0x05, 0x83, 0x78,
+    0x6a, 0x6a, 0x65, 0x65, 0x80, 0x56, 0x01, 0x53, 0x51, 0x80, 0x4f, 0x83,
+    0x48, 0x02, 0x42, 0x41, 0x40, 0x84, 0x37, 0x00, 0x36, 0x80, 0x31, 0x86,
+    0x2a, 0x09, 0x28, 0x28, 0x25, 0x23, 0x1d, 0x22, 0x1d, 0x1d, 0x21, 0x21,
+    0x81, 0x1b, 0x84, 0x17, 0x00, 0x19, 0x80, 0x17, 0x87, 0x15, 0x8a, 0x12,
+    0x8a, 0x0f, 0x80, 0x0b, 0x89, 0x21, 0x00, 0x25, 0x86, 0x21, 0x02, 0x25,
+    0x25, 0x23, 0x80, 0x25, 0x01, 0x23, 0x25, 0x81, 0x21, 0x80, 0x27, 0x08,
+    0x25, 0x25, 0x23, 0x27, 0x25, 0x27, 0x27, 0x23, 0x23, 0x84, 0x27, 0x04,
+    0x2b, 0x31, 0x2b, 0x2c, 0x31, 0x83, 0x2a, 0x82, 0x31, 0x05, 0x2c, 0x2c,
+    0x31, 0x2c, 0x2b, 0x2c, 0x90, 0x31, 0x00, 0x35, 0x80, 0x31, 0x00, 0x37,
+    0x80, 0x36, 0x8d, 0x37, 0x83, 0x40, 0x82, 0x42, 0x01, 0x46, 0x42, 0x82,
+    0x48, 0x04, 0x4f, 0x73, 0x8c, 0x56, 0x4f, 0x80, 0x51, 0x03, 0x56, 0x5b,
+    0x6c, 0x80, 0x80, 0x56, 0x02, 0x65, 0x65, 0x6c, 0x83, 0x78, 0x83, 0x9b,
+    0x00, 0x95, 0x80, 0x9b, 0x26, 0x7d, 0x93, 0x8e, 0xb4, 0xd9, 0xd9, 0xb4,
+    0xb4, 0xb5, 0xda, 0xdc, 0xa7, 0xb7, 0xb9, 0xe4, 0xc1, 0xcd, 0xeb, 0xd5,
+    0xb2, 0xca, 0xc1, 0xaa, 0xa8, 0xb8, 0xb6, 0xa8, 0xa1, 0x9f, 0x90, 0xd9,
+    0xd9, 0xd8, 0xd7, 0xd8, 0xd8, 0xb6, 0xbf, 0x86, 0x81, 0x9b, 0x05, 0x83,
+    0x83, 0x6c, 0x6a, 0x6a, 0x65, 0x80, 0x56, 0x81, 0x51, 0x00, 0x4f, 0x83,
+    0x48, 0x03, 0x42, 0x41, 0x41, 0x3d, 0x83, 0x37, 0x80, 0x31, 0x05, 0x2c,
+    0x2b, 0x31, 0x31, 0x2b, 0x2c, 0x82, 0x2a, 0x01, 0x28, 0x28, 0x83, 0x21,
+    0x00, 0x1d, 0x81, 0x21, 0x03, 0x1d, 0x1a, 0x1a, 0x19, 0x85, 0x17, 0x87,
+    0x15, 0x8e, 0x12, 0x84, 0x0f, 0x81, 0x0b, 0x89, 0x21, 0x00, 0x25, 0x80,
+    0x21, 0x00, 0x25, 0x8d, 0x21, 0x00, 0x25, 0x80, 0x27, 0x09, 0x23, 0x23,
+    0x25, 0x27, 0x25, 0x28, 0x28, 0x25, 0x23, 0x25, 0x83, 0x27, 0x01, 0x2b,
+    0x31, 0x86, 0x2a, 0x81, 0x31, 0x05, 0x2f, 0x2c, 0x2c, 0x31, 0x2c, 0x2c,
+    0x91, 0x31, 0x05, 0x35, 0x34, 0x34, 0x36, 0x39, 0x36, 0x8e, 0x37, 0x01,
+    0x3d, 0x3d, 0x82, 0x40, 0x81, 0x42, 0x02, 0x48, 0x42, 0x42, 0x81, 0x48,
+    0x0c, 0x4f, 0x51, 0x8b, 0x67, 0x56, 0x4f, 0x51, 0x4f, 0x51, 0x56, 0x6a,
+    0x81, 0x96, 0x81, 0x65, 0x01, 0x6a, 0x6c, 0x83, 0x78, 0x85, 0x9b, 0x29,
+    0xd7, 0x80, 0x99, 0xa2, 0x70, 0xd8, 0xd9, 0xd9, 0xb4, 0xb5, 0xda, 0xdc,
+    0xdd, 0xa7, 0xb8, 0xa8, 0xe4, 0xc1, 0xca, 0xb1, 0xd5, 0xe9, 0xcd, 0xc1,
+    0xbb, 0xa8, 0x9a, 0xa8, 0xa8, 0x98, 0x97, 0x98, 0xb4, 0xd9, 0xd8, 0xd7,
+    0xd8, 0xd7, 0x75, 0xbf, 0x84, 0xb3, 0x81, 0x9b, 0x07, 0x83, 0x6c, 0x6a,
+    0x6a, 0x65, 0x65, 0x5e, 0x56, 0x81, 0x51, 0x00, 0x4f, 0x83, 0x48, 0x0b,
+    0x42, 0x41, 0x41, 0x3d, 0x39, 0x37, 0x36, 0x34, 0x36, 0x37, 0x37, 0x35,
+    0x84, 0x31, 0x82, 0x2a, 0x01, 0x28, 0x28, 0x82, 0x21, 0x02, 0x1d, 0x1b,
+    0x1f, 0x80, 0x21, 0x00, 0x1b, 0x85, 0x17, 0x8c, 0x15, 0x81, 0x12, 0x01,
+    0x15, 0x15, 0x87, 0x12, 0x83, 0x0f, 0x81, 0x0b, 0x82, 0x21, 0x00, 0x25,
+    0x80, 0x21, 0x04, 0x25, 0x23, 0x23, 0x25, 0x25, 0x91, 0x21, 0x08, 0x27,
+    0x27, 0x23, 0x23, 0x25, 0x28, 0x27, 0x23, 0x25, 0x84, 0x27, 0x02, 0x2b,
+    0x2b, 0x28, 0x80, 0x2c, 0x84, 0x2a, 0x87, 0x31, 0x05, 0x2b, 0x2b, 0x2c,
+    0x2c, 0x2b, 0x2f, 0x91, 0x31, 0x8f, 0x37, 0x04, 0x3d, 0x3c, 0x41, 0x42,
+    0x41, 0x83, 0x42, 0x84, 0x48, 0x0e, 0x51, 0x68, 0x86, 0x5b, 0x56, 0x51,
+    0x4f, 0x53, 0x5e, 0x9c, 0x9c, 0x80, 0x7e, 0x65, 0x65, 0x80, 0x6a, 0x01,
+    0x6c, 0x6c, 0x83, 0x78, 0x85, 0x9b, 0x21, 0xd9, 0xa4, 0x84, 0x9c, 0xd8,
+    0xd9, 0xd9, 0xb5, 0xb5, 0xdb, 0xdd, 0xde, 0xe0, 0xb8, 0xa8, 0x9f, 0xc1,
+    0xca, 0xe9, 0xd5, 0xeb, 0xb0, 0xbd, 0xaa, 0x97, 0xa8, 0x9e, 0xb7, 0xdc,
+    0xdc, 0xb7, 0xdd, 0xb5, 0xb4, 0x80, 0x9c, 0x03, 0x7f, 0xbf, 0x86, 0x95,
+    0x81, 0x9b, 0x04, 0x83, 0x78, 0x6a, 0x6a, 0x65, 0x82, 0x56, 0x02, 0x53,
+    0x51, 0x4f, 0x81, 0x48, 0x80, 0x42, 0x02, 0x41, 0x41, 0x3d, 0x84, 0x37,
+    0x85, 0x31, 0x81, 0x2a, 0x01, 0x28, 0x25, 0x81, 0x27, 0x01, 0x23, 0x22,
+    0x85, 0x1b, 0x84, 0x17, 0x83, 0x15, 0x01, 0x18, 0x18, 0x83, 0x15, 0x8f,
+    0x12, 0x86, 0x0f, 0x80, 0x21, 0x00, 0x25, 0x80, 0x21, 0x01, 0x25, 0x23,
+    0x81, 0x25, 0x93, 0x21, 0x0b, 0x25, 0x23, 0x23, 0x25, 0x28, 0x28, 0x23,
+    0x23, 0x27, 0x28, 0x2b, 0x2b, 0x80, 0x27, 0x80, 0x2a, 0x01, 0x2c, 0x2c,
+    0x83, 0x2a, 0x00, 0x2c, 0x81, 0x31, 0x02, 0x2f, 0x2b, 0x2c, 0x80, 0x31,
+    0x02, 0x2c, 0x2c, 0x2b, 0x80, 0x2c, 0x8a, 0x31, 0x00, 0x36, 0x80, 0x31,
+    0x00, 0x36, 0x80, 0x31, 0x90, 0x37, 0x01, 0x3d, 0x41, 0x81, 0x42, 0x01,
+    0x4a, 0x42, 0x86, 0x48, 0x09, 0x7d, 0x79, 0x5b, 0x56, 0x53, 0x51, 0x56,
+    0x6c, 0xb3, 0x80, 0x80, 0x65, 0x00, 0x5e, 0x80, 0x65, 0x02, 0x6a, 0x6a,
+    0x6c, 0x83, 0x78, 0x83, 0x9b, 0x04, 0xd7, 0xd7, 0xb5, 0xbe, 0xa6, 0x80,
+    0x9c, 0x22, 0xd9, 0xb4, 0xb5, 0xda, 0xdc, 0xde, 0xe0, 0xb8, 0xb9, 0xe4,
+    0xc1, 0xcd, 0xb1, 0xd5, 0xeb, 0xb0, 0xc1, 0xaa, 0x97, 0xa9, 0xba, 0x98,
+    0xdd, 0xdb, 0xdc, 0xdd, 0x8b, 0x8b, 0x96, 0xb4, 0x75, 0x93, 0x8f, 0xd7,
+    0x95, 0x81, 0x9b, 0x04, 0x83, 0x78, 0x6a, 0x6a, 0x65, 0x83, 0x56, 0x05,
+    0x51, 0x4f, 0x4c, 0x4f, 0x4c, 0x48, 0x81, 0x42, 0x02, 0x41, 0x41, 0x3d,
+    0x83, 0x37, 0x84, 0x31, 0x0a, 0x2c, 0x2b, 0x28, 0x2b, 0x28, 0x25, 0x25,
+    0x27, 0x28, 0x2b, 0x28, 0x81, 0x21, 0x83, 0x1b, 0x02, 0x1a, 0x1a, 0x19,
+    0x81, 0x17, 0x80, 0x15, 0x04, 0x18, 0x18, 0x16, 0x18, 0x18, 0x83, 0x15,
+    0x90, 0x12, 0x85, 0x0f, 0x84, 0x21, 0x01, 0x25, 0x23, 0x81, 0x25, 0x84,
+    0x21, 0x01, 0x25, 0x25, 0x81, 0x21, 0x03, 0x25, 0x25, 0x27, 0x25, 0x81,
+    0x21, 0x08, 0x25, 0x27, 0x25, 0x23, 0x23, 0x28, 0x27, 0x23, 0x25, 0x87,
+    0x27, 0x01, 0x2b, 0x28, 0x81, 0x2a, 0x01, 0x31, 0x2c, 0x82, 0x31, 0x80,
+    0x2c, 0x05, 0x31, 0x31, 0x2f, 0x2b, 0x2c, 0x2b, 0x90, 0x31, 0x01, 0x36,
+    0x37, 0x80, 0x31, 0x8e, 0x37, 0x80, 0x40, 0x84, 0x42, 0x85, 0x48, 0x0a,
+    0x5a, 0x90, 0x5a, 0x56, 0x5b, 0x53, 0x53, 0x5b, 0x6e, 0x6a, 0x65, 0x80,
+    0x56, 0x82, 0x65, 0x01, 0x6a, 0x74, 0x82, 0x78, 0x83, 0x9b, 0x05, 0x95,
+    0xd7, 0x95, 0x8d, 0xbe, 0xb5, 0x80, 0x9c, 0x18, 0xd9, 0xb4, 0xb5, 0xda,
+    0xdc, 0xde, 0xe0, 0xb8, 0xb9, 0x9e, 0xc1, 0xcd, 0xeb, 0xd5, 0xd3, 0xcd,
+    0xc1, 0xaa, 0xba, 0xa9, 0xe2, 0xa7, 0xdd, 0xa6, 0xa6, 0x80, 0xb4, 0x07,
+    0xd8, 0xd9, 0xb5, 0x9e, 0x94, 0x95, 0xd6, 0x95, 0x80, 0x9b, 0x06, 0x83,
+    0x78, 0x6e, 0x6a, 0x6a, 0x65, 0x65, 0x81, 0x56, 0x03, 0x51, 0x51, 0x4f,
+    0x4f, 0x80, 0x48, 0x80, 0x42, 0x03, 0x41, 0x41, 0x3d, 0x3d, 0x82, 0x37,
+    0x00, 0x36, 0x83, 0x31, 0x0b, 0x2c, 0x28, 0x28, 0x2b, 0x2b, 0x27, 0x25,
+    0x27, 0x28, 0x2b, 0x28, 0x27, 0x81, 0x21, 0x0c, 0x1d, 0x21, 0x1d, 0x1d,
+    0x21, 0x1d, 0x1a, 0x1a, 0x19, 0x18, 0x16, 0x18, 0x18, 0x81, 0x15, 0x81,
+    0x17, 0x82, 0x15, 0x83, 0x12, 0x00, 0x15, 0x89, 0x12, 0x85, 0x0f, 0x92,
+    0x21, 0x00, 0x25, 0x81, 0x21, 0x05, 0x25, 0x27, 0x28, 0x25, 0x23, 0x23,
+    0x80, 0x25, 0x03, 0x28, 0x27, 0x23, 0x25, 0x8b, 0x27, 0x09, 0x2b, 0x28,
+    0x2c, 0x2b, 0x2c, 0x2b, 0x2b, 0x31, 0x31, 0x2b, 0x80, 0x31, 0x00, 0x2c,
+    0x80, 0x31, 0x00, 0x2f, 0x80, 0x2c, 0x02, 0x31, 0x31, 0x35, 0x8e, 0x31,
+    0x01, 0x36, 0x39, 0x80, 0x36, 0x8b, 0x37, 0x01, 0x3d, 0x3d, 0x81, 0x40,
+    0x84, 0x42, 0x81, 0x48, 0x05, 0x44, 0x53, 0x56, 0x7d, 0x8d, 0x67, 0x80,
+    0x56, 0x01, 0x51, 0x51, 0x84, 0x56, 0x82, 0x65, 0x01, 0x6a, 0x74, 0x80,
+    0x78, 0x85, 0x9b, 0x2b, 0xd7, 0xd7, 0xb4, 0x9f, 0x97, 0xb4, 0xd8, 0xd8,
+    0xd9, 0xd9, 0xb4, 0xa6, 0xdb, 0xdc, 0xde, 0xdf, 0xb7, 0xb9, 0x9e, 0xbd,
+    0xcb, 0xd1, 0xd5, 0xe9, 0xcc, 0xc4, 0xe5, 0xa9, 0xba, 0xe2, 0xa7, 0xdd,
+    0xda, 0xb5, 0xb4, 0xd9, 0xd8, 0xd7, 0xd8, 0x7d, 0x89, 0xc0, 0xb5, 0xb3,
+    0x81, 0x9b, 0x80, 0x78, 0x80, 0x6a, 0x00, 0x65, 0x81, 0x56, 0x03, 0x53,
+    0x51, 0x4f, 0x4f, 0x82, 0x48, 0x01, 0x42, 0x42, 0x80, 0x40, 0x00, 0x3d,
+    0x83, 0x37, 0x00, 0x36, 0x81, 0x31, 0x04, 0x2b, 0x2b, 0x28, 0x2b, 0x2b,
+    0x82, 0x27, 0x00, 0x25, 0x84, 0x21, 0x83, 0x1b, 0x80, 0x17, 0x03, 0x19,
+    0x18, 0x18, 0x16, 0x83, 0x17, 0x84, 0x15, 0x01, 0x14, 0x14, 0x83, 0x15,
+    0x87, 0x12, 0x84, 0x0f, 0x91, 0x21, 0x01, 0x25, 0x25, 0x81, 0x21, 0x81,
+    0x25, 0x01, 0x23, 0x23, 0x82, 0x27, 0x01, 0x23, 0x25, 0x8a, 0x27, 0x03,
+    0x2a, 0x2c, 0x2b, 0x2c, 0x80, 0x2a, 0x83, 0x31, 0x00, 0x2c, 0x90, 0x31,
+    0x06, 0x36, 0x39, 0x37, 0x36, 0x36, 0x37, 0x36, 0x80, 0x31, 0x02, 0x39,
+    0x36, 0x34, 0x88, 0x37, 0x00, 0x40, 0x80, 0x37, 0x01, 0x3d, 0x3d, 0x81,
+    0x40, 0x82, 0x42, 0x83, 0x48, 0x06, 0x4f, 0x56, 0x80, 0x86, 0x67, 0x4f,
+    0x56, 0x83, 0x51, 0x82, 0x56, 0x80, 0x65, 0x80, 0x6a, 0x00, 0x6c, 0x80,
+    0x78, 0x85, 0x9b, 0x04, 0xd7, 0x81, 0x9e, 0xa8, 0xd9, 0x80, 0x9c, 0x2f,
+    0xd9, 0xd9, 0xb4, 0xa6, 0xdb, 0xdd, 0xde, 0xe0, 0xb7, 0xb9, 0x9e, 0xbd,
+    0xc9, 0xcf, 0xea, 0xb2, 0xce, 0xc9, 0xab, 0x9f, 0x9e, 0xb9, 0xa7, 0xdd,
+    0xdb, 0xda, 0xb5, 0xb4, 0xd9, 0xd8, 0xd7, 0x81, 0x8c, 0xc3, 0x98, 0x9c,
+    0x95, 0xd6, 0x83, 0xd6, 0x9b, 0x83, 0x78, 0x6c, 0x6a, 0x6a, 0x65, 0x65,
+    0x81, 0x56, 0x02, 0x51, 0x51, 0x4f, 0x82, 0x48, 0x01, 0x42, 0x42, 0x81,
+    0x40, 0x00, 0x3d, 0x83, 0x37, 0x83, 0x31, 0x03, 0x2c, 0x31, 0x2b, 0x2b,
+    0x81, 0x27, 0x00, 0x25, 0x86, 0x21, 0x06, 0x1d, 0x1d, 0x21, 0x21, 0x1d,
+    0x1a, 0x19, 0x81, 0x17, 0x01, 0x19, 0x19, 0x81, 0x17, 0x84, 0x15, 0x01,
+    0x14, 0x14, 0x83, 0x15, 0x84, 0x12, 0x02, 0x11, 0x12, 0x12, 0x82, 0x0f,
+    0x01, 0x0c, 0x0f, 0x91, 0x21, 0x00, 0x25, 0x88, 0x21, 0x06, 0x25, 0x27,
+    0x28, 0x2a, 0x28, 0x25, 0x25, 0x82, 0x27, 0x00, 0x25, 0x83, 0x27, 0x80,
+    0x2a, 0x01, 0x31, 0x2c, 0x80, 0x2a, 0x99, 0x31, 0x04, 0x36, 0x36, 0x39,
+    0x39, 0x36, 0x80, 0x31, 0x03, 0x36, 0x34, 0x35, 0x36, 0x86, 0x37, 0x01,
+    0x3d, 0x41, 0x80, 0x37, 0x84, 0x40, 0x80, 0x42, 0x02, 0x4a, 0x42, 0x42,
+    0x81, 0x48, 0x04, 0x56, 0x5f, 0x9d, 0x5b, 0x56, 0x85, 0x51, 0x81, 0x56,
+    0x00, 0x65, 0x83, 0x6a, 0x00, 0x6c, 0x80, 0x78, 0x85, 0x9b, 0x04, 0xb3,
+    0x8b, 0xab, 0x75, 0xb3, 0x80, 0x9c, 0x24, 0xd9, 0xb4, 0xb5, 0xda, 0xdc,
+    0xdd, 0xde, 0xe0, 0xb7, 0xb9, 0xa9, 0xad, 0xc9, 0xce, 0xb2, 0xd5, 0xd0,
+    0xc9, 0xad, 0xaa, 0xbb, 0x99, 0xa7, 0xde, 0xdc, 0xdb, 0xb5, 0xb4, 0xd9,
+    0xd8, 0xd7, 0xd8, 0xd9, 0xba, 0xa4, 0x7f, 0xd7, 0x81, 0x9b, 0x05, 0x83,
+    0x78, 0x6c, 0x6a, 0x6a, 0x65, 0x82, 0x56, 0x02, 0x51, 0x51, 0x4f, 0x81,
+    0x48, 0x02, 0x46, 0x42, 0x42, 0x82, 0x40, 0x00, 0x3d, 0x83, 0x37, 0x00,
+    0x36, 0x81, 0x31, 0x01, 0x2c, 0x2c, 0x80, 0x2a, 0x82, 0x27, 0x84, 0x21,
+    0x80, 0x1b, 0x80, 0x21, 0x03, 0x1a, 0x1a, 0x1b, 0x1a, 0x80, 0x19, 0x82,
+    0x17, 0x8c, 0x15, 0x88, 0x12, 0x81, 0x0f, 0x01, 0x0c, 0x0f, 0x9b, 0x21,
+    0x00, 0x25, 0x81, 0x27, 0x03, 0x2c, 0x28, 0x25, 0x25, 0x82, 0x27, 0x00,
+    0x25, 0x81, 0x27, 0x08, 0x2a, 0x2a, 0x28, 0x2b, 0x2b, 0x2c, 0x31, 0x31,
+    0x2f, 0x9a, 0x31, 0x05, 0x36, 0x37, 0x38, 0x36, 0x36, 0x35, 0x81, 0x31,
+    0x87, 0x37, 0x05, 0x3d, 0x3d, 0x41, 0x41, 0x3c, 0x3c, 0x81, 0x40, 0x02,
+    0x42, 0x41, 0x41, 0x82, 0x42, 0x82, 0x48, 0x04, 0x67, 0x9d, 0x7e, 0x5b,
+    0x56, 0x82, 0x51, 0x85, 0x56, 0x01, 0x6a, 0x6a, 0x81, 0x6c, 0x81, 0x78,
+    0x85, 0x9b, 0x03, 0x95, 0x98, 0x9e, 0x81, 0x80, 0x9c, 0x1d, 0xd9, 0xd9,
+    0xb4, 0xb5, 0xdb, 0xdc, 0xdd, 0xde, 0xe0, 0xb7, 0xe2, 0x9e, 0xad, 0xc9,
+    0xce, 0xb2, 0xea, 0xd1, 0xcb, 0xc1, 0xab, 0x9e, 0x99, 0xe0, 0xde, 0xdd,
+    0xdb, 0xb5, 0xb4, 0xd9, 0x81, 0x9c, 0x03, 0x81, 0x92, 0xac, 0x95, 0x81,
+    0x9b, 0x05, 0x83, 0x78, 0x6c, 0x6a, 0x6a, 0x65, 0x82, 0x56, 0x02, 0x51,
+    0x51, 0x4f, 0x83, 0x48, 0x81, 0x42, 0x02, 0x41, 0x3d, 0x3d, 0x85, 0x37,
+    0x83, 0x31, 0x03, 0x2c, 0x2c, 0x2b, 0x2a, 0x83, 0x27, 0x84, 0x21, 0x04,
+    0x1d, 0x1d, 0x21, 0x1d, 0x1b, 0x83, 0x17, 0x03, 0x19, 0x19, 0x18, 0x18,
+    0x89, 0x15, 0x02, 0x14, 0x14, 0x15, 0x88, 0x12, 0x83, 0x0f, 0x9b, 0x21,
+    0x91, 0x27, 0x02, 0x2a, 0x28, 0x28, 0x80, 0x2a, 0x80, 0x31, 0x02, 0x2c,
+    0x2b, 0x2b, 0x95, 0x31, 0x80, 0x36, 0x85, 0x31, 0x86, 0x37, 0x07, 0x3d,
+    0x39, 0x39, 0x41, 0x41, 0x3d, 0x3c, 0x41, 0x81, 0x42, 0x01, 0x41, 0x41,
+    0x82, 0x42, 0x81, 0x48, 0x02, 0x4f, 0x86, 0x67, 0x81, 0x51, 0x03, 0x56,
+    0x56, 0x53, 0x53, 0x83, 0x56, 0x80, 0x65, 0x80, 0x6a, 0x01, 0x6c, 0x74,
+    0x81, 0x78, 0x85, 0x9b, 0x03, 0x80, 0x9e, 0x97, 0xd9, 0x80, 0x9c, 0x1d,
+    0xd9, 0xd9, 0xb4, 0xa6, 0xa6, 0xdc, 0xdd, 0xde, 0xe0, 0xb8, 0xb9, 0xbb,
+    0xc4, 0xc9, 0xe8, 0xb2, 0xea, 0xeb, 0xcd, 0xc4, 0xab, 0x9e, 0xe2, 0xb6,
+    0xa7, 0xdd, 0xdb, 0xb5, 0xb4, 0xd9, 0x80, 0x9c, 0x04, 0xd7, 0xb3, 0x82,
+    0x94, 0x83, 0x81, 0x9b, 0x80, 0x78, 0x03, 0x6c, 0x6a, 0x65, 0x65, 0x81,
+    0x56, 0x80, 0x51, 0x00, 0x4f, 0x84, 0x48, 0x04, 0x42, 0x41, 0x41, 0x3d,
+    0x3d, 0x84, 0x37, 0x02, 0x36, 0x34, 0x36, 0x80, 0x31, 0x07, 0x2f, 0x2b,
+    0x31, 0x2b, 0x2b, 0x28, 0x2b, 0x2b, 0x80, 0x27, 0x84, 0x21, 0x04, 0x1d,
+    0x1d, 0x21, 0x1d, 0x1b, 0x83, 0x17, 0x81, 0x19, 0x80, 0x17, 0x84, 0x15,
+    0x8e, 0x12, 0x80, 0x0f, 0x01, 0x12, 0x12, 0x98, 0x21, 0x02, 0x25, 0x28,
+    0x25, 0x84, 0x27, 0x03, 0x25, 0x25, 0x28, 0x2a, 0x86, 0x27, 0x02, 0x2a,
+    0x28, 0x28, 0x80, 0x2a, 0x02, 0x2c, 0x31, 0x31, 0x80, 0x2a, 0x8c, 0x31,
+    0x00, 0x2c, 0x85, 0x31, 0x02, 0x37, 0x39, 0x36, 0x80, 0x31, 0x04, 0x36,
+    0x36, 0x37, 0x37, 0x36, 0x86, 0x37, 0x02, 0x3d, 0x39, 0x39, 0x84, 0x40,
+    0x02, 0x42, 0x42, 0x41, 0x83, 0x42, 0x81, 0x48, 0x05, 0x53, 0x8b, 0x67,
+    0x4f, 0x51, 0x4f, 0x88, 0x56, 0x07, 0x65, 0x6a, 0x65, 0x6a, 0x6a, 0x6c,
+    0x6e, 0x74, 0x80, 0x78, 0x85, 0x9b, 0x25, 0xd7, 0x81, 0xa4, 0x92, 0xd9,
+    0xd8, 0xd8, 0xd9, 0xd9, 0xb4, 0xb5, 0xa6, 0xdb, 0xdc, 0xdd, 0xde, 0xb6,
+    0xe1, 0xe3, 0xaa, 0xbd, 0xc7, 0xca, 0xd3, 0xd5, 0xb1, 0xca, 0xc7, 0xab,
+    0xa9, 0xe2, 0xb6, 0xa7, 0xdd, 0xdb, 0xb5, 0xb4, 0xd9, 0x80, 0x9c, 0x04,
+    0xd7, 0xd7, 0x82, 0xa3, 0x80, 0x82, 0x9b, 0x80, 0x78, 0x02, 0x6a, 0x65,
+    0x65, 0x82, 0x56, 0x02, 0x53, 0x51, 0x4f, 0x84, 0x48, 0x04, 0x42, 0x42,
+    0x41, 0x41, 0x3d, 0x83, 0x37, 0x04, 0x36, 0x34, 0x31, 0x36, 0x37, 0x80,
+    0x31, 0x01, 0x2b, 0x2c, 0x80, 0x2a, 0x06, 0x2c, 0x2c, 0x2b, 0x28, 0x28,
+    0x25, 0x25, 0x82, 0x21, 0x81, 0x1b, 0x84, 0x17, 0x80, 0x19, 0x85, 0x17,
+    0x82, 0x15, 0x83, 0x12, 0x00, 0x15, 0x8a, 0x12, 0x00, 0x1d, 0x97, 0x21,
+    0x02, 0x28, 0x27, 0x25, 0x80, 0x27, 0x05, 0x23, 0x27, 0x28, 0x25, 0x23,
+    0x25, 0x82, 0x27, 0x03, 0x2a, 0x28, 0x2a, 0x2a, 0x82, 0x27, 0x00, 0x2c,
+    0x81, 0x2a, 0x03, 0x31, 0x2b, 0x2b, 0x2c, 0x92, 0x31, 0x02, 0x36, 0x34,
+    0x36, 0x80, 0x37, 0x02, 0x34, 0x36, 0x36, 0x8b, 0x37, 0x02, 0x3d, 0x39,
+    0x39, 0x85, 0x40, 0x84, 0x42, 0x81, 0x48, 0x06, 0x51, 0x5f, 0x86, 0x65,
+    0x4f, 0x51, 0x54, 0x84, 0x56, 0x00, 0x65, 0x80, 0x56, 0x82, 0x6a, 0x00,
+    0x6c, 0x82, 0x78, 0x84, 0x9b, 0x04, 0xd7, 0xd7, 0x79, 0xaf, 0x98, 0x80,
+    0x9c, 0x1f, 0xd9, 0xd9, 0xb4, 0xb4, 0xa6, 0xdb, 0xdc, 0xdd, 0xdf, 0xb7,
+    0xe1, 0xa8, 0xa9, 0xa1, 0xc4, 0xcb, 0xd1, 0xd5, 0xd4, 0xce, 0xc9, 0xab,
+    0x9e, 0xb9, 0xb7, 0xdf, 0xdd, 0xdb, 0xb5, 0xb5, 0xd9, 0xd9, 0x81, 0x9c,
+    0x03, 0x77, 0xc2, 0x81, 0xd7, 0x81, 0x9b, 0x80, 0x78, 0x02, 0x6a, 0x65,
+    0x65, 0x81, 0x56, 0x80, 0x51, 0x85, 0x48, 0x01, 0x42, 0x42, 0x80, 0x40,
+    0x84, 0x37, 0x03, 0x36, 0x34, 0x36, 0x39, 0x80, 0x31, 0x07, 0x2b, 0x31,
+    0x31, 0x2c, 0x2b, 0x2c, 0x31, 0x2b, 0x81, 0x27, 0x82, 0x21, 0x04, 0x1d,
+    0x1d, 0x21, 0x1b, 0x1a, 0x82, 0x1b, 0x01, 0x1a, 0x19, 0x88, 0x17, 0x82,
+    0x15, 0x81, 0x12, 0x84, 0x15, 0x85, 0x12, 0x8f, 0x21, 0x03, 0x25, 0x27,
+    0x23, 0x25, 0x81, 0x21, 0x80, 0x25, 0x00, 0x23, 0x80, 0x25, 0x05, 0x23,
+    0x27, 0x28, 0x23, 0x25, 0x25, 0x81, 0x27, 0x01, 0x2b, 0x2c, 0x80, 0x2a,
+    0x82, 0x27, 0x00, 0x31, 0x80, 0x2a, 0x04, 0x2c, 0x31, 0x2b, 0x2c, 0x2c,
+    0x92, 0x31, 0x80, 0x36, 0x05, 0x37, 0x37, 0x36, 0x34, 0x36, 0x36, 0x8b,
+    0x37, 0x09, 0x3d, 0x3c, 0x3c, 0x41, 0x42, 0x41, 0x42, 0x42, 0x41, 0x41,
+    0x84, 0x42, 0x00, 0x46, 0x81, 0x48, 0x07, 0x51, 0x56, 0xa6, 0x5f, 0x50,
+    0x4f, 0x51, 0x53, 0x83, 0x56, 0x81, 0x65, 0x04, 0x6c, 0x6c, 0x6a, 0x6a,
+    0x6c, 0x83, 0x78, 0x84, 0x9b, 0x04, 0xd7, 0xd8, 0xa9, 0xa2, 0xb4, 0x80,
+    0x9c, 0x27, 0xd9, 0xd9, 0xb4, 0xb5, 0xa6, 0xdb, 0xdc, 0xdd, 0xdf, 0xb6,
+    0x99, 0xb9, 0xba, 0xbb, 0xad, 0xc9, 0xcf, 0xb2, 0xea, 0xd1, 0xcb, 0xad,
+    0xbb, 0xb9, 0xb7, 0xe0, 0xde, 0xdc, 0xda, 0xb5, 0xb4, 0xd9, 0xd8, 0xd8,
+    0xd7, 0xd7, 0x8c, 0xe7, 0x86, 0x95, 0x81, 0x9b, 0x80, 0x78, 0x02, 0x6a,
+    0x6a, 0x65, 0x81, 0x56, 0x80, 0x51, 0x85, 0x48, 0x00, 0x42, 0x82, 0x40,
+    0x83, 0x37, 0x03, 0x36, 0x34, 0x36, 0x37, 0x83, 0x31, 0x09, 0x2c, 0x2c,
+    0x2f, 0x31, 0x2b, 0x2b, 0x28, 0x2a, 0x28, 0x25, 0x82, 0x21, 0x87, 0x1b,
+    0x89, 0x17, 0x83, 0x15, 0x01, 0x14, 0x14, 0x86, 0x15, 0x84, 0x12, 0x01,
+    0x1d, 0x1d, 0x8d, 0x21, 0x02, 0x27, 0x25, 0x25, 0x82, 0x21, 0x07, 0x27,
+    0x25, 0x23, 0x23, 0x25, 0x23, 0x25, 0x23, 0x82, 0x27, 0x80, 0x25, 0x00,
+    0x28, 0x82, 0x2a, 0x82, 0x27, 0x82, 0x2a, 0x98, 0x31, 0x01, 0x36, 0x34,
+    0x80, 0x36, 0x86, 0x37, 0x00, 0x3d, 0x83, 0x37, 0x02, 0x41, 0x41, 0x3c,
+    0x80, 0x40, 0x01, 0x42, 0x42, 0x80, 0x40, 0x03, 0x42, 0x42, 0x48, 0x4a,
+    0x80, 0x46, 0x06, 0x48, 0x4c, 0x4f, 0x4f, 0x51, 0x56, 0x9c, 0x80, 0x56,
+    0x80, 0x51, 0x83, 0x56, 0x00, 0x65, 0x81, 0x6a, 0x01, 0x6c, 0x6c, 0x81,
+    0x78, 0x87, 0x9b, 0x30, 0xd7, 0xb4, 0xad, 0x91, 0xd8, 0xd7, 0xd8, 0xd8,
+    0xd9, 0xd9, 0xb4, 0xb4, 0xa6, 0xdb, 0xdc, 0xde, 0xde, 0xe0, 0xb8, 0xa8,
+    0xba, 0xbb, 0xad, 0xc9, 0xe8, 0xe9, 0xea, 0xd2, 0xcb, 0xbd, 0xbb, 0xa8,
+    0xb8, 0xe0, 0xa7, 0xdd, 0xdb, 0xb5, 0xb4, 0xd9, 0xd8, 0xd8, 0xd7, 0xd7,
+    0x70, 0xac, 0x9f, 0xa6, 0x95, 0x80, 0x9b, 0x01, 0x83, 0x78, 0x80, 0x6a,
+    0x00, 0x65, 0x81, 0x56, 0x80, 0x51, 0x00, 0x4f, 0x83, 0x48, 0x01, 0x42,
+    0x42, 0x82, 0x40, 0x84, 0x37, 0x02, 0x34, 0x36, 0x36, 0x86, 0x31, 0x07,
+    0x2f, 0x2c, 0x2c, 0x2b, 0x2a, 0x28, 0x28, 0x25, 0x81, 0x21, 0x02, 0x1d,
+    0x22, 0x22, 0x84, 0x1b, 0x88, 0x17, 0x8f, 0x15, 0x02, 0x14, 0x14, 0x15,
+    0x81, 0x12, 0x00, 0x1d, 0x8c, 0x21, 0x00, 0x25, 0x80, 0x21, 0x00, 0x25,
+    0x86, 0x21, 0x15, 0x25, 0x27, 0x27, 0x25, 0x27, 0x28, 0x25, 0x25, 0x27,
+    0x28, 0x25, 0x28, 0x2b, 0x2a, 0x28, 0x2b, 0x2c, 0x31, 0x2b, 0x2b, 0x28,
+    0x28, 0x83, 0x2a, 0x01, 0x2c, 0x2c, 0x96, 0x31, 0x00, 0x36, 0x80, 0x37,
+    0x00, 0x36, 0x87, 0x37, 0x03, 0x3d, 0x3d, 0x39, 0x3c, 0x81, 0x3d, 0x80,
+    0x40, 0x81, 0x42, 0x00, 0x41, 0x82, 0x42, 0x83, 0x48, 0x03, 0x4f, 0x4f,
+    0x6c, 0x7e, 0x89, 0x56, 0x01, 0x65, 0x65, 0x80, 0x6a, 0x01, 0x6c, 0x74,
+    0x81, 0x78, 0x84, 0x9b, 0x00, 0xd7, 0x80, 0xb3, 0x02, 0xb5, 0xa4, 0xb4,
+    0x81, 0x9c, 0x2a, 0xd9, 0xd9, 0xb4, 0xb5, 0xa6, 0xda, 0xdc, 0xde, 0xa7,
+    0xe0, 0xb8, 0xb9, 0xe3, 0xe4, 0xab, 0xc4, 0xcc, 0xd3, 0xb2, 0xd3, 0xcd,
+    0xc1, 0xaa, 0xa8, 0xe1, 0xb6, 0xdf, 0xdd, 0xdb, 0xb5, 0xb4, 0xd9, 0xd8,
+    0xd8, 0xd7, 0xd8, 0xd9, 0x7d, 0x97, 0xbe, 0x89, 0xb5, 0x95, 0x82, 0x78,
+    0x01, 0x74, 0x65, 0x82, 0x56, 0x01, 0x53, 0x53, 0x80, 0x4f, 0x80, 0x48,
+    0x81, 0x42, 0x82, 0x40, 0x00, 0x3d, 0x81, 0x37, 0x81, 0x31, 0x02, 0x36,
+    0x37, 0x36, 0x80, 0x31, 0x02, 0x2c, 0x31, 0x31, 0x80, 0x2a, 0x81, 0x27,
+    0x04, 0x25, 0x23, 0x22, 0x1d, 0x1d, 0x81, 0x21, 0x83, 0x1b, 0x84, 0x17,
+    0x02, 0x19, 0x18, 0x18, 0x82, 0x15, 0x01, 0x18, 0x18, 0x80, 0x15, 0x80,
+    0x12, 0x84, 0x15, 0x02, 0x14, 0x15, 0x15, 0x80, 0x12, 0x01, 0x21, 0x1d,
+    0x94, 0x21, 0x00, 0x25, 0x80, 0x21, 0x01, 0x25, 0x25, 0x82, 0x27, 0x01,
+    0x25, 0x23, 0x81, 0x27, 0x0a, 0x2b, 0x2a, 0x28, 0x2b, 0x2c, 0x31, 0x2b,
+    0x28, 0x28, 0x2b, 0x2b, 0x9d, 0x31, 0x00, 0x36, 0x80, 0x37, 0x01, 0x36,
+    0x36, 0x85, 0x37, 0x82, 0x40, 0x01, 0x3d, 0x3d, 0x80, 0x40, 0x86, 0x42,
+    0x01, 0x46, 0x46, 0x84, 0x48, 0x03, 0x4f, 0x53, 0x73, 0x6a, 0x87, 0x56,
+    0x80, 0x65, 0x04, 0x6a, 0x6a, 0x6c, 0x74, 0x74, 0x82, 0x78, 0x83, 0x9b,
+    0x07, 0x95, 0xb3, 0xd7, 0xd7, 0xd8, 0x87, 0xaa, 0xd9, 0x81, 0x9c, 0x21,
+    0xd9, 0xd9, 0xb4, 0xb5, 0xda, 0xdb, 0xdc, 0xa7, 0xe0, 0xb6, 0xb8, 0xb9,
+    0xe3, 0xbb, 0xad, 0xc7, 0xca, 0xd3, 0xb2, 0xd3, 0xcd, 0xc1, 0xbb, 0xe3,
+    0x9a, 0xb7, 0xe0, 0xdd, 0xdb, 0xb5, 0xb4, 0xd9, 0xd9, 0xd8, 0x81, 0xd7,
+    0x06, 0xd8, 0x98, 0x9e, 0x9e, 0x87, 0xa7, 0x95, 0x80, 0x78, 0x02, 0x6a,
+    0x6a, 0x65, 0x82, 0x56, 0x00, 0x53, 0x80, 0x4f, 0x81, 0x48, 0x80, 0x42,
+    0x82, 0x40, 0x00, 0x3d, 0x82, 0x37, 0x01, 0x36, 0x34, 0x81, 0x37, 0x00,
+    0x36, 0x83, 0x31, 0x02, 0x2b, 0x28, 0x2a, 0x81, 0x27, 0x02, 0x23, 0x22,
+    0x1f, 0x82, 0x21, 0x83, 0x1b, 0x87, 0x17, 0x82, 0x15, 0x01, 0x18, 0x18,
+    0x80, 0x15, 0x80, 0x12, 0x84, 0x15, 0x00, 0x14, 0x80, 0x15, 0x01, 0x14,
+    0x12, 0x92, 0x21, 0x06, 0x25, 0x25, 0x23, 0x23, 0x28, 0x27, 0x23, 0x80,
+    0x25, 0x80, 0x27, 0x03, 0x25, 0x28, 0x25, 0x25, 0x82, 0x27, 0x83, 0x2a,
+    0x02, 0x28, 0x2b, 0x2c, 0x8f, 0x31, 0x05, 0x35, 0x34, 0x34, 0x36, 0x34,
+    0x36, 0x81, 0x31, 0x04, 0x36, 0x34, 0x34, 0x36, 0x36, 0x81, 0x37, 0x01,
+    0x36, 0x34, 0x84, 0x37, 0x00, 0x3d, 0x82, 0x40, 0x03, 0x3d, 0x3d, 0x41,
+    0x41, 0x81, 0x42, 0x89, 0x48, 0x05, 0x51, 0x4f, 0x4f, 0x56, 0x6c, 0x73,
+    0x87, 0x56, 0x04, 0x65, 0x6a, 0x6a, 0x6c, 0x6c, 0x83, 0x78, 0x88, 0x9b,
+    0x04, 0xb3, 0xd8, 0x87, 0xa1, 0x90, 0x80, 0x9c, 0x80, 0xd9, 0x2c, 0xb4,
+    0xb4, 0xda, 0xdb, 0xdb, 0xdd, 0xde, 0x98, 0xb6, 0xb8, 0xb9, 0xba, 0xe4,
+    0xad, 0xc7, 0xcd, 0xd3, 0xea, 0xeb, 0xcb, 0xc1, 0xbb, 0x97, 0xe2, 0xb7,
+    0xe0, 0xdd, 0xdb, 0xa6, 0xb4, 0xd9, 0xd9, 0xd8, 0xd7, 0xb3, 0xb3, 0x95,
+    0xd7, 0x95, 0xb3, 0x9c, 0x90, 0x8e, 0x9f, 0xa6, 0x80, 0x78, 0x03, 0x6a,
+    0x5f, 0x65, 0x65, 0x80, 0x56, 0x00, 0x53, 0x80, 0x4f, 0x81, 0x48, 0x02,
+    0x42, 0x46, 0x42, 0x80, 0x40, 0x02, 0x42, 0x41, 0x3d, 0x83, 0x37, 0x00,
+    0x36, 0x82, 0x37, 0x82, 0x31, 0x03, 0x2b, 0x2c, 0x2a, 0x2a, 0x81, 0x27,
+    0x86, 0x21, 0x82, 0x1b, 0x02, 0x1a, 0x1b, 0x1c, 0x86, 0x17, 0x81, 0x15,
+    0x00, 0x18, 0x82, 0x15, 0x00, 0x14, 0x84, 0x15, 0x02, 0x14, 0x14, 0x15,
+    0x80, 0x12, 0x92, 0x21, 0x09, 0x25, 0x25, 0x23, 0x23, 0x27, 0x25, 0x23,
+    0x27, 0x27, 0x25, 0x83, 0x27, 0x01, 0x23, 0x23, 0x80, 0x27, 0x80, 0x2a,
+    0x01, 0x31, 0x31, 0x80, 0x2a, 0x00, 0x2c, 0x93, 0x31, 0x07, 0x37, 0x36,
+    0x36, 0x37, 0x34, 0x36, 0x37, 0x37, 0x80, 0x31, 0x00, 0x36, 0x81, 0x37,
+    0x01, 0x36, 0x36, 0x81, 0x37, 0x01, 0x3d, 0x3d, 0x80, 0x40, 0x00, 0x42,
+    0x82, 0x40, 0x81, 0x42, 0x00, 0x46, 0x8a, 0x48, 0x04, 0x4f, 0x4f, 0x53,
+    0x6a, 0x95, 0x87, 0x56, 0x00, 0x65, 0x81, 0x6a, 0x83, 0x78, 0x89, 0x9b,
+    0x04, 0x80, 0x9a, 0xa0, 0x70, 0xb3, 0x81, 0x9c, 0x32, 0xd9, 0xb4, 0xb4,
+    0xb5, 0xda, 0xdc, 0xdc, 0xde, 0xa7, 0xe0, 0xb6, 0xe1, 0xa8, 0xba, 0xbb,
+    0xad, 0xc7, 0xca, 0xd3, 0xea, 0xd2, 0xcb, 0xc1, 0xe4, 0xa8, 0xb8, 0xb6,
+    0xde, 0xdd, 0xdb, 0xa6, 0xb4, 0xd9, 0xd9, 0xd8, 0xd8, 0xd7, 0xb3, 0xd7,
+    0xd6, 0x95, 0x83, 0x95, 0x9b, 0x80, 0x8b, 0x97, 0xb6, 0x83, 0x74, 0x78,
+    0x80, 0x65, 0x81, 0x56, 0x00, 0x51, 0x80, 0x4f, 0x82, 0x48, 0x82, 0x42,
+    0x01, 0x41, 0x41, 0x83, 0x37, 0x80, 0x36, 0x02, 0x39, 0x37, 0x36, 0x80,
+    0x31, 0x82, 0x2a, 0x01, 0x28, 0x2b, 0x81, 0x27, 0x00, 0x25, 0x82, 0x21,
+    0x00, 0x1d, 0x80, 0x21, 0x85, 0x1b, 0x84, 0x17, 0x8e, 0x15, 0x02, 0x14,
+    0x14, 0x15, 0x81, 0x12, 0x94, 0x21, 0x82, 0x25, 0x02, 0x28, 0x28, 0x25,
+    0x81, 0x27, 0x03, 0x2b, 0x28, 0x25, 0x25, 0x81, 0x27, 0x09, 0x2b, 0x2c,
+    0x2c, 0x31, 0x2c, 0x2b, 0x2c, 0x2c, 0x2b, 0x31, 0x82, 0x2c, 0x8a, 0x31,
+    0x0b, 0x35, 0x34, 0x35, 0x36, 0x37, 0x37, 0x34, 0x34, 0x37, 0x36, 0x34,
+    0x34, 0x89, 0x37, 0x01, 0x41, 0x41, 0x80, 0x42, 0x83, 0x40, 0x82, 0x42,
+    0x00, 0x46, 0x87, 0x48, 0x80, 0x4f, 0x03, 0x53, 0x5e, 0x83, 0x6a, 0x85,
+    0x56, 0x01, 0x65, 0x65, 0x80, 0x6a, 0x83, 0x78, 0x8a, 0x9b, 0x03, 0xd7,
+    0xd7, 0x9f, 0x85, 0x81, 0x9c, 0x00, 0xd9, 0x80, 0xb4, 0x21, 0xb5, 0xda,
+    0xdb, 0xdd, 0xde, 0xde, 0xa7, 0xe0, 0xb7, 0xe1, 0xa8, 0xa9, 0xaa, 0xbd,
+    0xc7, 0xcc, 0xe9, 0xd5, 0xd3, 0xcc, 0xe7, 0xa4, 0x97, 0xe2, 0xb6, 0xde,
+    0xdc, 0xdb, 0xb5, 0xb4, 0xd9, 0xd9, 0xd8, 0xd8, 0x80, 0xd7, 0x83, 0x9b,
+    0x08, 0x95, 0x80, 0x92, 0x8c, 0x7e, 0x6a, 0x6c, 0x6a, 0x65, 0x81, 0x56,
+    0x80, 0x51, 0x80, 0x4f, 0x81, 0x48, 0x81, 0x42, 0x01, 0x41, 0x41, 0x84,
+    0x37, 0x80, 0x36, 0x82, 0x31, 0x82, 0x2a, 0x00, 0x28, 0x80, 0x2a, 0x81,
+    0x27, 0x04, 0x25, 0x25, 0x22, 0x21, 0x1d, 0x81, 0x21, 0x85, 0x1b, 0x84,
+    0x17, 0x87, 0x15, 0x00, 0x18, 0x82, 0x15, 0x02, 0x14, 0x14, 0x15, 0x81,
+    0x12, 0x95, 0x21, 0x0f, 0x25, 0x25, 0x23, 0x23, 0x27, 0x28, 0x23, 0x25,
+    0x28, 0x28, 0x2b, 0x2b, 0x28, 0x23, 0x25, 0x2a, 0x80, 0x27, 0x09, 0x2a,
+    0x31, 0x2f, 0x2b, 0x2c, 0x2b, 0x2c, 0x31, 0x31, 0x2c, 0x8e, 0x31, 0x00,
+    0x35, 0x81, 0x31, 0x07, 0x37, 0x37, 0x34, 0x36, 0x39, 0x37, 0x36, 0x34,
+    0x89, 0x37, 0x01, 0x41, 0x41, 0x80, 0x42, 0x80, 0x40, 0x86, 0x42, 0x00,
+    0x46, 0x86, 0x48, 0x07, 0x4f, 0x4f, 0x53, 0x65, 0x83, 0x6c, 0x56, 0x53,
+    0x83, 0x56, 0x01, 0x65, 0x65, 0x81, 0x6a, 0x83, 0x78, 0x8a, 0x9b, 0x03,
+    0xd7, 0xd8, 0x9f, 0x7f, 0x81, 0x9c, 0x00, 0xd9, 0x80, 0xb4, 0x20, 0xb5,
+    0xda, 0xdc, 0xdd, 0xde, 0xa7, 0xe0, 0xb6, 0xb8, 0xe2, 0x97, 0xe4, 0xe5,
+    0xc1, 0xc9, 0xc8, 0xd4, 0xea, 0xd2, 0xcc, 0xca, 0xcd, 0xa4, 0x8e, 0xe2,
+    0x98, 0xdc, 0xda, 0xb5, 0xb4, 0xd9, 0xd8, 0xd8, 0x82, 0xd7, 0x83, 0x9b,
+    0x07, 0x83, 0xb5, 0xba, 0x75, 0x78, 0x74, 0x83, 0x65, 0x82, 0x56, 0x01,
+    0x53, 0x53, 0x80, 0x4f, 0x81, 0x48, 0x82, 0x42, 0x01, 0x41, 0x40, 0x85,
+    0x37, 0x83, 0x31, 0x82, 0x2a, 0x00, 0x28, 0x80, 0x2a, 0x82, 0x27, 0x04,
+    0x25, 0x22, 0x21, 0x1b, 0x1d, 0x81, 0x21, 0x84, 0x1b, 0x02, 0x1a, 0x1a,
+    0x19, 0x83, 0x17, 0x83, 0x15, 0x80, 0x17, 0x04, 0x16, 0x15, 0x14, 0x14,
+    0x15, 0x84, 0x12, 0x00, 0x1d, 0x90, 0x21, 0x00, 0x25, 0x80, 0x21, 0x01,
+    0x27, 0x25, 0x81, 0x21, 0x02, 0x27, 0x28, 0x2b, 0x81, 0x27, 0x81, 0x2a,
+    0x01, 0x28, 0x2b, 0x80, 0x31, 0x00, 0x2c, 0x8b, 0x31, 0x00, 0x35, 0x83,
+    0x31, 0x03, 0x36, 0x36, 0x35, 0x34, 0x90, 0x37, 0x81, 0x3d, 0x00, 0x41,
+    0x81, 0x42, 0x01, 0x41, 0x41, 0x80, 0x42, 0x03, 0x4a, 0x4a, 0x42, 0x42,
+    0x85, 0x48, 0x03, 0x4f, 0x4c, 0x4c, 0x4f, 0x80, 0x51, 0x02, 0x5e, 0x6c,
+    0x6c, 0x85, 0x56, 0x01, 0x65, 0x65, 0x82, 0x6a, 0x82, 0x78, 0x01, 0x9b,
+    0x83, 0x88, 0x9b, 0x08, 0x95, 0xd7, 0x9c, 0x9e, 0x8d, 0x81, 0xd8, 0xd9,
+    0xd9, 0x80, 0xb4, 0x22, 0xb5, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf, 0xb6,
+    0xb8, 0xe2, 0xa8, 0x9e, 0xaa, 0xad, 0xc7, 0xb0, 0xd1, 0xb2, 0xd4, 0xc8,
+    0xc9, 0xc1, 0xaf, 0xb0, 0xc9, 0xc9, 0xaa, 0x98, 0xdd, 0xdb, 0xda, 0xb4,
+    0xd9, 0xd9, 0xd8, 0x81, 0xd7, 0x84, 0x9b, 0x08, 0xd7, 0x90, 0xe3, 0xb6,
+    0x81, 0x83, 0x6a, 0x5e, 0x65, 0x82, 0x56, 0x81, 0x51, 0x03, 0x4f, 0x4c,
+    0x4c, 0x46, 0x81, 0x42, 0x05, 0x41, 0x41, 0x3d, 0x3c, 0x41, 0x41, 0x80,
+    0x37, 0x02, 0x36, 0x36, 0x35, 0x80, 0x31, 0x81, 0x2a, 0x00, 0x28, 0x82,
+    0x2a, 0x81, 0x27, 0x02, 0x23, 0x25, 0x25, 0x85, 0x21, 0x81, 0x1b, 0x83,
+    0x17, 0x02, 0x19, 0x18, 0x19, 0x80, 0x17, 0x81, 0x15, 0x81, 0x17, 0x82,
+    0x15, 0x84, 0x12, 0x00, 0x1d, 0x86, 0x21, 0x00, 0x25, 0x85, 0x21, 0x00,
+    0x25, 0x80, 0x21, 0x80, 0x25, 0x81, 0x21, 0x07, 0x25, 0x28, 0x2b, 0x28,
+    0x27, 0x25, 0x28, 0x28, 0x80, 0x2a, 0x01, 0x28, 0x2b, 0x9a, 0x31, 0x8f,
+    0x37, 0x05, 0x3d, 0x41, 0x41, 0x3d, 0x41, 0x41, 0x80, 0x42, 0x01, 0x41,
+    0x41, 0x81, 0x42, 0x03, 0x48, 0x48, 0x42, 0x42, 0x86, 0x48, 0x01, 0x4f,
+    0x4f, 0x8c, 0x56, 0x01, 0x65, 0x65, 0x80, 0x6a, 0x01, 0x6c, 0x6c, 0x82,
+    0x78, 0x01, 0x9b, 0x83, 0x88, 0x9b, 0x06, 0xd7, 0xd7, 0xd9, 0xa0, 0x84,
+    0xd8, 0xd8, 0x80, 0xd9, 0x24, 0xb4, 0xb5, 0xa6, 0xdb, 0xdb, 0xdd, 0xde,
+    0xa7, 0xe0, 0xb7, 0xe1, 0xb9, 0xba, 0xe4, 0xab, 0xc4, 0xc9, 0xc8, 0xb1,
+    0xea, 0xeb, 0xcd, 0xc4, 0xe5, 0x9f, 0xaa, 0x9f, 0xaa, 0xa5, 0xaa, 0xde,
+    0xdb, 0xa6, 0xb4, 0xb4, 0xd9, 0xd8, 0x81, 0xd7, 0x85, 0x9b, 0x08, 0x83,
+    0x80, 0x98, 0xa8, 0x8d, 0x73, 0x6c, 0x65, 0x65, 0x81, 0x56, 0x81, 0x51,
+    0x00, 0x4f, 0x80, 0x48, 0x81, 0x42, 0x05, 0x41, 0x41, 0x3d, 0x3d, 0x41,
+    0x41, 0x80, 0x37, 0x01, 0x36, 0x36, 0x82, 0x31, 0x01, 0x2c, 0x2c, 0x80,
+    0x2a, 0x00, 0x28, 0x80, 0x2a, 0x81, 0x27, 0x03, 0x25, 0x25, 0x28, 0x25,
+    0x84, 0x21, 0x81, 0x1b, 0x01, 0x1a, 0x19, 0x81, 0x17, 0x04, 0x19, 0x1a,
+    0x1a, 0x19, 0x19, 0x86, 0x17, 0x83, 0x15, 0x83, 0x12, 0x8f, 0x21, 0x82,
+    0x25, 0x82, 0x21, 0x04, 0x25, 0x25, 0x23, 0x27, 0x2b, 0x82, 0x27, 0x87,
+    0x2a, 0x01, 0x2c, 0x2b, 0x8e, 0x31, 0x04, 0x36, 0x36, 0x34, 0x34, 0x36,
+    0x8e, 0x37, 0x00, 0x3d, 0x84, 0x40, 0x80, 0x42, 0x00, 0x41, 0x81, 0x42,
+    0x8a, 0x48, 0x00, 0x51, 0x8c, 0x56, 0x01, 0x65, 0x65, 0x81, 0x6a, 0x01,
+    0x6c, 0x6c, 0x81, 0x78, 0x89, 0x9b, 0x81, 0xd7, 0x04, 0xd9, 0xbb, 0x82,
+    0x81, 0xd8, 0x80, 0xd9, 0x24, 0xb4, 0xa6, 0xdb, 0xdc, 0xdd, 0xde, 0xa7,
+    0xe0, 0xb6, 0xb8, 0xe1, 0xa8, 0xa9, 0xbb, 0xad, 0xc7, 0xca, 0xeb, 0xea,
+    0xb2, 0xce, 0xc9, 0xad, 0xbb, 0x97, 0xe2, 0xb7, 0xb8, 0x92, 0xab, 0x9e,
+    0x90, 0xb5, 0xb5, 0xd9, 0xd9, 0xd8, 0x80, 0xd7, 0x86, 0x9b, 0x08, 0x83,
+    0x9b, 0x83, 0x81, 0x84, 0x99, 0x8c, 0x80, 0x6a, 0x81, 0x56, 0x81, 0x51,
+    0x01, 0x4f, 0x4f, 0x80, 0x48, 0x80, 0x42, 0x82, 0x40, 0x00, 0x3d, 0x83,
+    0x37, 0x82, 0x31, 0x03, 0x2c, 0x2b, 0x2c, 0x2b, 0x86, 0x27, 0x02, 0x23,
+    0x27, 0x25, 0x84, 0x21, 0x81, 0x1b, 0x01, 0x1a, 0x19, 0x83, 0x17, 0x00,
+    0x1b, 0x80, 0x17, 0x01, 0x19, 0x19, 0x84, 0x17, 0x82, 0x15, 0x01, 0x14,
+    0x15, 0x80, 0x12, 0x00, 0x15, 0x8f, 0x21, 0x04, 0x25, 0x25, 0x23, 0x25,
+    0x25, 0x81, 0x21, 0x08, 0x25, 0x28, 0x25, 0x23, 0x28, 0x2b, 0x27, 0x27,
+    0x25, 0x80, 0x27, 0x84, 0x2a, 0x00, 0x2c, 0x83, 0x2a, 0x8f, 0x31, 0x81,
+    0x36, 0x8b, 0x37, 0x02, 0x41, 0x41, 0x42, 0x82, 0x40, 0x85, 0x42, 0x89,
+    0x48, 0x00, 0x4f, 0x82, 0x56, 0x03, 0x53, 0x54, 0x53, 0x51, 0x84, 0x56,
+    0x00, 0x65, 0x80, 0x6a, 0x04, 0x6c, 0x78, 0x6c, 0x74, 0x6c, 0x80, 0x78,
+    0x88, 0x9b, 0x80, 0xd7, 0x07, 0x80, 0xd7, 0x9c, 0x92, 0xaa, 0x8b, 0xb4,
+    0xd9, 0x80, 0xb4, 0x23, 0xda, 0xdc, 0xdd, 0xdd, 0xde, 0xdf, 0xe0, 0xb7,
+    0xb8, 0xe2, 0xe3, 0x9e, 0xe5, 0xc4, 0xcb, 0xd0, 0xea, 0xea, 0xd2, 0xcd,
+    0xc7, 0xab, 0x9e, 0xb9, 0xe1, 0xb6, 0xb6, 0xde, 0xa8, 0xaf, 0x98, 0xb5,
+    0xb4, 0xd9, 0xd8, 0xd8, 0x80, 0xd7, 0x87, 0x9b, 0x80, 0x78, 0x05, 0x6e,
+    0x80, 0x99, 0x75, 0x78, 0x6a, 0x80, 0x56, 0x81, 0x51, 0x00, 0x4f, 0x83,
+    0x48, 0x01, 0x42, 0x42, 0x81, 0x40, 0x01, 0x3d, 0x3d, 0x82, 0x37, 0x00,
+    0x36, 0x83, 0x31, 0x02, 0x2b, 0x31, 0x2b, 0x85, 0x27, 0x04, 0x25, 0x27,
+    0x25, 0x23, 0x25, 0x82, 0x21, 0x81, 0x1b, 0x01, 0x1a, 0x19, 0x83, 0x17,
+    0x80, 0x1b, 0x02, 0x1a, 0x1a, 0x19, 0x85, 0x17, 0x87, 0x15, 0x00, 0x1d,
+    0x95, 0x21, 0x05, 0x25, 0x23, 0x25, 0x28, 0x27, 0x23, 0x80, 0x27, 0x03,
+    0x25, 0x23, 0x25, 0x25, 0x80, 0x27, 0x01, 0x2b, 0x2b, 0x80, 0x27, 0x06,
+    0x2c, 0x2b, 0x2c, 0x31, 0x31, 0x2b, 0x2b, 0x89, 0x31, 0x81, 0x36, 0x80,
+    0x37, 0x03, 0x36, 0x34, 0x36, 0x36, 0x8a, 0x37, 0x00, 0x41, 0x81, 0x42,
+    0x02, 0x41, 0x42, 0x41, 0x82, 0x42, 0x02, 0x48, 0x42, 0x42, 0x84, 0x48,
+    0x00, 0x4f, 0x80, 0x48, 0x01, 0x51, 0x53, 0x81, 0x56, 0x80, 0x51, 0x82,
+    0x56, 0x04, 0x65, 0x65, 0x5e, 0x65, 0x65, 0x80, 0x6a, 0x03, 0x6c, 0x74,
+    0x6c, 0x74, 0x80, 0x78, 0x88, 0x9b, 0x81, 0xd7, 0x80, 0x9c, 0x28, 0x90,
+    0xa4, 0x99, 0xdd, 0xb5, 0xb4, 0xb5, 0xb5, 0xdb, 0xdc, 0xdd, 0xde, 0xde,
+    0xe0, 0xb6, 0xb7, 0xe2, 0xa8, 0xa9, 0xa1, 0xc1, 0xc9, 0xe8, 0xe9, 0xea,
+    0xd3, 0xcc, 0xc9, 0xad, 0xbb, 0xba, 0xb9, 0xb8, 0xb6, 0x98, 0xa7, 0x98,
+    0xbf, 0x8a, 0xb5, 0xb4, 0x80, 0x9c, 0x80, 0xd7, 0x88, 0x9b, 0x0a, 0x83,
+    0x6c, 0x6e, 0x83, 0x98, 0x75, 0x6a, 0x65, 0x65, 0x5e, 0x56, 0x81, 0x51,
+    0x01, 0x4f, 0x4f, 0x80, 0x48, 0x00, 0x46, 0x80, 0x42, 0x82, 0x40, 0x00,
+    0x3d, 0x84, 0x37, 0x03, 0x36, 0x37, 0x36, 0x35, 0x81, 0x31, 0x80, 0x2a,
+    0x80, 0x27, 0x08, 0x2a, 0x28, 0x25, 0x27, 0x25, 0x23, 0x27, 0x25, 0x25,
+    0x81, 0x21, 0x80, 0x1b, 0x85, 0x17, 0x01, 0x1b, 0x1b, 0x87, 0x17, 0x01,
+    0x19, 0x18, 0x87, 0x15, 0x01, 0x1b, 0x1d, 0x93, 0x21, 0x80, 0x25, 0x03,
+    0x27, 0x27, 0x25, 0x25, 0x81, 0x27, 0x09, 0x25, 0x25, 0x23, 0x23, 0x28,
+    0x27, 0x2b, 0x2b, 0x28, 0x28, 0x80, 0x2a, 0x80, 0x31, 0x02, 0x2c, 0x2b,
+    0x2c, 0x88, 0x31, 0x03, 0x37, 0x36, 0x34, 0x36, 0x81, 0x37, 0x02, 0x36,
+    0x34, 0x34, 0x89, 0x37, 0x01, 0x3d, 0x41, 0x89, 0x42, 0x02, 0x4a, 0x42,
+    0x42, 0x83, 0x48, 0x82, 0x4f, 0x00, 0x53, 0x80, 0x56, 0x81, 0x51, 0x81,
+    0x56, 0x83, 0x65, 0x81, 0x6a, 0x03, 0x6c, 0x6c, 0x74, 0x6c, 0x80, 0x78,
+    0x88, 0x9b, 0x83, 0xd7, 0x21, 0xd8, 0xb5, 0xaa, 0x7f, 0x91, 0xdd, 0xb5,
+    0xa6, 0xda, 0xdc, 0xde, 0xde, 0xa7, 0xa7, 0xb6, 0xb8, 0x99, 0xa8, 0xba,
+    0xbb, 0xad, 0xc9, 0xcd, 0xeb, 0xea, 0xb1, 0xe8, 0xc9, 0xbd, 0xbb, 0xba,
+    0xb9, 0xe1, 0xb7, 0x80, 0xa7, 0x07, 0xdd, 0xe4, 0xbf, 0x90, 0xd9, 0xd8,
+    0xd9, 0xd8, 0x81, 0xd7, 0x86, 0x9b, 0x82, 0x78, 0x03, 0x91, 0xb6, 0x6c,
+    0x6a, 0x81, 0x56, 0x80, 0x51, 0x00, 0x4f, 0x80, 0x48, 0x81, 0x46, 0x81,
+    0x42, 0x80, 0x40, 0x88, 0x37, 0x03, 0x36, 0x36, 0x31, 0x31, 0x80, 0x2c,
+    0x03, 0x2a, 0x2b, 0x28, 0x2b, 0x80, 0x27, 0x04, 0x23, 0x23, 0x28, 0x28,
+    0x25, 0x81, 0x21, 0x81, 0x1b, 0x83, 0x17, 0x80, 0x1b, 0x80, 0x17, 0x04,
+    0x19, 0x1a, 0x19, 0x18, 0x19, 0x81, 0x17, 0x86, 0x15, 0x05, 0x18, 0x1d,
+    0x1d, 0x21, 0x1d, 0x1d, 0x90, 0x21, 0x06, 0x27, 0x25, 0x23, 0x23, 0x28,
+    0x28, 0x25, 0x87, 0x27, 0x03, 0x2b, 0x2c, 0x2b, 0x28, 0x80, 0x2a, 0x81,
+    0x31, 0x00, 0x2b, 0x88, 0x31, 0x0b, 0x35, 0x37, 0x34, 0x34, 0x39, 0x39,
+    0x35, 0x37, 0x36, 0x34, 0x34, 0x36, 0x85, 0x37, 0x00, 0x3d, 0x82, 0x40,
+    0x05, 0x42, 0x42, 0x41, 0x41, 0x42, 0x41, 0x82, 0x42, 0x80, 0x48, 0x00,
+    0x42, 0x83, 0x48, 0x81, 0x4f, 0x02, 0x51, 0x56, 0x56, 0x81, 0x51, 0x84,
+    0x56, 0x83, 0x65, 0x84, 0x6a, 0x80, 0x78, 0x88, 0x9b, 0x83, 0xd7, 0x2c,
+    0xd8, 0xa6, 0x9f, 0xe4, 0x98, 0xb7, 0xda, 0xa6, 0xdb, 0xdc, 0xde, 0xa7,
+    0xa7, 0xb6, 0xb7, 0xb8, 0x99, 0xa8, 0x9e, 0xab, 0xc4, 0xcb, 0xd1, 0xea,
+    0xb2, 0xcf, 0xcb, 0xc7, 0xab, 0xa9, 0xa8, 0x99, 0xb7, 0xe0, 0xa7, 0xde,
+    0xdd, 0xdd, 0xa7, 0xe7, 0x98, 0xb4, 0xd9, 0xd8, 0xd8, 0x81, 0xd7, 0x86,
+    0x9b, 0x82, 0x78, 0x04, 0x7a, 0xb9, 0x6e, 0x74, 0x65, 0x80, 0x56, 0x00,
+    0x51, 0x83, 0x4f, 0x82, 0x48, 0x82, 0x42, 0x00, 0x41, 0x88, 0x37, 0x81,
+    0x31, 0x06, 0x2c, 0x31, 0x2f, 0x2c, 0x2b, 0x28, 0x2a, 0x80, 0x27, 0x03,
+    0x23, 0x23, 0x27, 0x25, 0x81, 0x21, 0x82, 0x1b, 0x02, 0x1a, 0x1d, 0x1b,
+    0x81, 0x17, 0x80, 0x1b, 0x04, 0x1a, 0x19, 0x1a, 0x1a, 0x19, 0x86, 0x17,
+    0x83, 0x15, 0x00, 0x18, 0x82, 0x1b, 0x90, 0x21, 0x06, 0x25, 0x23, 0x23,
+    0x25, 0x25, 0x27, 0x25, 0x87, 0x27, 0x03, 0x2b, 0x2c, 0x2b, 0x28, 0x81,
+    0x2a, 0x80, 0x31, 0x00, 0x2f, 0x89, 0x31, 0x04, 0x36, 0x34, 0x34, 0x39,
+    0x39, 0x80, 0x36, 0x01, 0x34, 0x36, 0x86, 0x37, 0x00, 0x3d, 0x82, 0x40,
+    0x00, 0x42, 0x81, 0x40, 0x83, 0x42, 0x87, 0x48, 0x81, 0x4f, 0x02, 0x51,
+    0x53, 0x56, 0x80, 0x51, 0x87, 0x56, 0x81, 0x65, 0x80, 0x6a, 0x01, 0x6c,
+    0x74, 0x81, 0x78, 0x89, 0x9b, 0x81, 0xd7, 0x80, 0x9c, 0x21, 0xb4, 0x84,
+    0xa9, 0xb8, 0xb8, 0xde, 0xdb, 0xdc, 0xdd, 0xde, 0xa7, 0xe0, 0xb7, 0xb8,
+    0xe1, 0xe2, 0xe3, 0x9e, 0xab, 0xc9, 0xcc, 0xb1, 0xea, 0xd2, 0xcd, 0xc7,
+    0xad, 0xaa, 0xba, 0xe2, 0xb8, 0xb7, 0xe0, 0xa7, 0x80, 0xdd, 0x06, 0xde,
+    0xc2, 0xde, 0xb4, 0xd9, 0x9d, 0xd8, 0x81, 0xd7, 0x87, 0x9b, 0x81, 0x78,
+    0x04, 0x9d, 0x98, 0x83, 0x6a, 0x65, 0x80, 0x56, 0x03, 0x53, 0x4f, 0x51,
+    0x51, 0x81, 0x4f, 0x81, 0x48, 0x82, 0x42, 0x01, 0x41, 0x3d, 0x87, 0x37,
+    0x84, 0x31, 0x02, 0x2c, 0x2b, 0x28, 0x80, 0x2a, 0x09, 0x28, 0x23, 0x23,
+    0x27, 0x25, 0x25, 0x23, 0x23, 0x25, 0x21, 0x8b, 0x1b, 0x83, 0x17, 0x01,
+    0x1c, 0x19, 0x80, 0x17, 0x02, 0x16, 0x18, 0x18, 0x84, 0x15, 0x01, 0x1d,
+    0x1d, 0x97, 0x21, 0x00, 0x25, 0x80, 0x21, 0x02, 0x25, 0x23, 0x25, 0x83,
+    0x27, 0x00, 0x2b, 0x82, 0x27, 0x82, 0x2a, 0x00, 0x2c, 0x8c, 0x31, 0x05,
+    0x39, 0x39, 0x36, 0x36, 0x37, 0x36, 0x87, 0x37, 0x82, 0x40, 0x80, 0x42,
+    0x00, 0x41, 0x80, 0x42, 0x00, 0x41, 0x82, 0x42, 0x86, 0x48, 0x81, 0x4f,
+    0x02, 0x51, 0x51, 0x56, 0x80, 0x51, 0x87, 0x56, 0x81, 0x65, 0x03, 0x6a,
+    0x78, 0x6e, 0x74, 0x82, 0x78, 0x86, 0x9b, 0x84, 0xd7, 0x81, 0x9c, 0x26,
+    0xb4, 0x90, 0x99, 0xa4, 0xe2, 0xdb, 0xdc, 0xde, 0xde, 0xa7, 0xb6, 0xb7,
+    0xe1, 0xb9, 0x97, 0xba, 0xbb, 0xad, 0xc9, 0xce, 0xd4, 0xb2, 0xce, 0xc9,
+    0xc1, 0xe5, 0xe4, 0xa8, 0xe1, 0xb7, 0xb6, 0xdf, 0xde, 0xdd, 0xdc, 0xdc,
+    0x8b, 0xa4, 0x91, 0x80, 0xd9, 0x82, 0xd7, 0x87, 0x9b, 0x81, 0x78, 0x04,
+    0x80, 0xa7, 0x83, 0x6c, 0x6a, 0x80, 0x56, 0x80, 0x51, 0x82, 0x4f, 0x82,
+    0x48, 0x80, 0x42, 0x01, 0x41, 0x41, 0x81, 0x3d, 0x84, 0x37, 0x85, 0x31,
+    0x08, 0x2c, 0x2b, 0x2b, 0x2c, 0x2b, 0x28, 0x27, 0x25, 0x27, 0x81, 0x25,
+    0x00, 0x27, 0x81, 0x21, 0x89, 0x1b, 0x05, 0x1a, 0x1a, 0x19, 0x1a, 0x1b,
+    0x1d, 0x84, 0x17, 0x84, 0x15, 0x01, 0x1d, 0x1d, 0x86, 0x21, 0x00, 0x25,
+    0x93, 0x21, 0x01, 0x25, 0x23, 0x82, 0x27, 0x05, 0x2a, 0x2a, 0x28, 0x28,
+    0x2b, 0x2c, 0x84, 0x2a, 0x8b, 0x31, 0x80, 0x37, 0x00, 0x34, 0x87, 0x37,
+    0x01, 0x40, 0x3d, 0x82, 0x40, 0x8a, 0x42, 0x84, 0x48, 0x01, 0x4f, 0x4c,
+    0x80, 0x4f, 0x84, 0x51, 0x82, 0x56, 0x82, 0x65, 0x03, 0x6a, 0x6a, 0x65,
+    0x6a, 0x85, 0x78, 0x88, 0x9b, 0x84, 0xd7, 0x80, 0xd9, 0x2a, 0xb4, 0xb5,
+    0xb7, 0x9f, 0xb9, 0xdd, 0xdc, 0xde, 0xa7, 0xe0, 0xb6, 0xe1, 0xe2, 0x97,
+    0xa9, 0xbb, 0xab, 0xc4, 0xcb, 0xd0, 0xb2, 0xd4, 0xcc, 0xc7, 0xad, 0xbb,
+    0xba, 0xb9, 0xb8, 0xb7, 0xe0, 0xa7, 0xde, 0xdc, 0xdb, 0xdb, 0x90, 0xb8,
+    0x9f, 0xa6, 0xd9, 0xd8, 0xd8, 0x83, 0xd7, 0x88, 0x9b, 0x09, 0x83, 0x83,
+    0xe0, 0x80, 0x78, 0x65, 0x5e, 0x65, 0x56, 0x56, 0x80, 0x51, 0x80, 0x4f,
+    0x83, 0x48, 0x81, 0x42, 0x82, 0x40, 0x01, 0x3d, 0x3d, 0x82, 0x37, 0x85,
+    0x31, 0x01, 0x2b, 0x2c, 0x81, 0x27, 0x04, 0x25, 0x23, 0x27, 0x25, 0x23,
+    0x80, 0x27, 0x00, 0x25, 0x81, 0x21, 0x01, 0x1d, 0x1a, 0x88, 0x1b, 0x80,
+    0x17, 0x07, 0x1b, 0x1a, 0x19, 0x18, 0x18, 0x16, 0x18, 0x18, 0x84, 0x15,
+    0x01, 0x1b, 0x1d, 0x96, 0x21, 0x01, 0x25, 0x25, 0x83, 0x21, 0x05, 0x25,
+    0x27, 0x28, 0x2a, 0x28, 0x28, 0x82, 0x2a, 0x00, 0x2c, 0x80, 0x2a, 0x03,
+    0x2c, 0x2b, 0x2b, 0x2c, 0x87, 0x31, 0x03, 0x36, 0x35, 0x31, 0x34, 0x80,
+    0x37, 0x00, 0x36, 0x86, 0x37, 0x85, 0x40, 0x01, 0x42, 0x46, 0x88, 0x42,
+    0x81, 0x48, 0x00, 0x4f, 0x81, 0x48, 0x01, 0x4f, 0x4f, 0x85, 0x51, 0x80,
+    0x56, 0x01, 0x65, 0x5e, 0x82, 0x65, 0x81, 0x6a, 0x82, 0x78, 0x02, 0x9b,
+    0xd6, 0x83, 0x86, 0x9b, 0x85, 0xd7, 0x00, 0xd8, 0x80, 0xd9, 0x2a, 0xb4,
+    0xa6, 0xb7, 0x9a, 0xb9, 0xa7, 0xde, 0xa7, 0xe0, 0xb6, 0xb8, 0xe2, 0xa8,
+    0xba, 0xe4, 0xab, 0xbd, 0xc7, 0xcd, 0xeb, 0xd5, 0xe9, 0xca, 0xc4, 0xab,
+    0x9e, 0xe3, 0xe2, 0xb8, 0xb6, 0xe0, 0xde, 0xdd, 0xdc, 0xdb, 0xda, 0xa6,
+    0x90, 0x8e, 0x97, 0xb4, 0xd9, 0xd8, 0x82, 0xd7, 0x87, 0x9b, 0x0b, 0x83,
+    0x9b, 0x83, 0x83, 0x90, 0x86, 0x83, 0x6a, 0x65, 0x65, 0x5b, 0x56, 0x82,
+    0x51, 0x00, 0x4f, 0x82, 0x48, 0x00, 0x46, 0x80, 0x42, 0x83, 0x40, 0x00,
+    0x3d, 0x84, 0x37, 0x00, 0x36, 0x84, 0x31, 0x01, 0x2b, 0x2a, 0x81, 0x27,
+    0x03, 0x23, 0x27, 0x25, 0x25, 0x80, 0x27, 0x00, 0x25, 0x82, 0x21, 0x8d,
+    0x1b, 0x06, 0x1a, 0x19, 0x18, 0x18, 0x16, 0x18, 0x18, 0x84, 0x15, 0x80,
+    0x1b, 0x94, 0x21, 0x04, 0x25, 0x25, 0x23, 0x23, 0x25, 0x81, 0x21, 0x05,
+    0x25, 0x27, 0x28, 0x2b, 0x28, 0x28, 0x80, 0x2a, 0x01, 0x2c, 0x2c, 0x82,
+    0x31, 0x02, 0x2b, 0x2b, 0x2c, 0x87, 0x31, 0x00, 0x39, 0x80, 0x31, 0x80,
+    0x37, 0x00, 0x34, 0x86, 0x37, 0x04, 0x40, 0x41, 0x3d, 0x41, 0x42, 0x80,
+    0x40, 0x01, 0x42, 0x48, 0x80, 0x42, 0x01, 0x4a, 0x4a, 0x80, 0x42, 0x01,
+    0x4a, 0x42, 0x82, 0x48, 0x02, 0x4f, 0x4c, 0x4c, 0x80, 0x4f, 0x86, 0x51,
+    0x82, 0x56, 0x00, 0x65, 0x80, 0x6a, 0x03, 0x65, 0x6a, 0x6a, 0x6e, 0x83,
+    0x78, 0x89, 0x9b, 0x01, 0xd7, 0xd6, 0x82, 0xd7, 0x00, 0xd8, 0x80, 0xd9,
+    0x23, 0xb4, 0xb5, 0xa6, 0xa7, 0x99, 0xa8, 0x9a, 0x98, 0xdf, 0xb6, 0xb7,
+    0xe1, 0xb9, 0xe3, 0xa9, 0xbb, 0xad, 0xc7, 0xc9, 0xc8, 0xe9, 0xea, 0xd2,
+    0xcb, 0xc1, 0xa1, 0xa9, 0xa8, 0xe1, 0xb7, 0xe0, 0xa7, 0xde, 0xdc, 0xdb,
+    0xda, 0x80, 0xb5, 0x04, 0x8c, 0x9f, 0x9a, 0xd9, 0xd8, 0x82, 0xd7, 0x87,
+    0x9b, 0x81, 0x78, 0x07, 0x9c, 0xb4, 0x78, 0x65, 0x6a, 0x65, 0x5e, 0x56,
+    0x82, 0x51, 0x00, 0x4f, 0x81, 0x48, 0x00, 0x46, 0x81, 0x42, 0x80, 0x40,
+    0x03, 0x42, 0x42, 0x41, 0x41, 0x85, 0x37, 0x84, 0x31, 0x82, 0x2a, 0x83,
+    0x27, 0x03, 0x2a, 0x28, 0x25, 0x25, 0x84, 0x21, 0x8a, 0x1b, 0x86, 0x17,
+    0x81, 0x15, 0x00, 0x18, 0x80, 0x1b, 0x8a, 0x21, 0x01, 0x25, 0x25, 0x89,
+    0x21, 0x04, 0x25, 0x28, 0x25, 0x23, 0x23, 0x82, 0x27, 0x05, 0x2b, 0x2a,
+    0x28, 0x2a, 0x2b, 0x2c, 0x82, 0x31, 0x01, 0x2b, 0x2c, 0x87, 0x31, 0x06,
+    0x36, 0x36, 0x39, 0x36, 0x34, 0x34, 0x36, 0x88, 0x37, 0x00, 0x3d, 0x83,
+    0x40, 0x85, 0x42, 0x85, 0x48, 0x82, 0x4f, 0x87, 0x51, 0x84, 0x56, 0x80,
+    0x65, 0x00, 0x6a, 0x81, 0x6c, 0x00, 0x74, 0x81, 0x78, 0x8a, 0x9b, 0x82,
+    0xd7, 0x80, 0x9c, 0x80, 0xd9, 0x24, 0xb4, 0xa6, 0xda, 0xdb, 0xb6, 0x9a,
+    0xba, 0xb8, 0xb6, 0xb7, 0xb8, 0xe1, 0xa8, 0xba, 0xbb, 0xab, 0xc4, 0xc7,
+    0xca, 0xeb, 0xb2, 0xb1, 0xcc, 0xc7, 0xad, 0xbb, 0xba, 0xb9, 0xb8, 0xb6,
+    0xdf, 0xa7, 0xdd, 0xdb, 0xa6, 0xb5, 0xb5, 0x80, 0xb4, 0x04, 0x8c, 0xa0,
+    0xa7, 0xd9, 0xd8, 0x81, 0xd7, 0x88, 0x9b, 0x80, 0x78, 0x05, 0xb3, 0xd6,
+    0x83, 0x78, 0x6a, 0x65, 0x81, 0x56, 0x00, 0x53, 0x80, 0x4f, 0x81, 0x48,
+    0x01, 0x46, 0x4a, 0x85, 0x42, 0x81, 0x40, 0x82, 0x37, 0x00, 0x36, 0x85,
+    0x31, 0x01, 0x2c, 0x2c, 0x82, 0x2a, 0x82, 0x27, 0x80, 0x25, 0x86, 0x21,
+    0x80, 0x1b, 0x80, 0x17, 0x01, 0x1b, 0x1c, 0x81, 0x17, 0x80, 0x19, 0x81,
+    0x17, 0x82, 0x15, 0x80, 0x1b, 0x8a, 0x21, 0x01, 0x25, 0x25, 0x89, 0x21,
+    0x01, 0x25, 0x27, 0x80, 0x21, 0x85, 0x27, 0x08, 0x2b, 0x2b, 0x2c, 0x31,
+    0x2f, 0x2c, 0x31, 0x31, 0x2c, 0x8a, 0x31, 0x01, 0x37, 0x37, 0x81, 0x31,
+    0x87, 0x37, 0x84, 0x40, 0x01, 0x42, 0x41, 0x83, 0x42, 0x84, 0x48, 0x84,
+    0x4f, 0x86, 0x51, 0x85, 0x56, 0x05, 0x65, 0x6a, 0x65, 0x78, 0x74, 0x6c,
+    0x83, 0x78, 0x8a, 0x9b, 0x81, 0xd7, 0x81, 0x9c, 0x80, 0xd9, 0x23, 0xb4,
+    0xa6, 0xdb, 0xdc, 0xdc, 0x9a, 0x97, 0xa9, 0x9a, 0xb8, 0xe1, 0xe2, 0xe3,
+    0x9e, 0xa1, 0xc1, 0xc9, 0xcc, 0xd2, 0xb2, 0xea, 0xd1, 0xb0, 0xc4, 0xab,
+    0xe4, 0x97, 0xe2, 0xb7, 0xe0, 0xde, 0xde, 0xdd, 0xdb, 0xa6, 0xb5, 0x80,
+    0xb4, 0x09, 0xd9, 0xd9, 0x91, 0x8a, 0x98, 0xa6, 0xd8, 0xb3, 0xd7, 0xd7,
+    0x88, 0x9b, 0x80, 0x78, 0x06, 0x9b, 0x83, 0x95, 0x95, 0x6c, 0x65, 0x65,
+    0x81, 0x56, 0x02, 0x51, 0x4f, 0x4f, 0x81, 0x48, 0x02, 0x46, 0x48, 0x4a,
+    0x83, 0x42, 0x80, 0x40, 0x01, 0x3d, 0x40, 0x82, 0x37, 0x00, 0x36, 0x80,
+    0x31, 0x00, 0x36, 0x82, 0x31, 0x00, 0x2c, 0x82, 0x2a, 0x82, 0x27, 0x81,
+    0x25, 0x87, 0x21, 0x80, 0x1b, 0x05, 0x1a, 0x1b, 0x1b, 0x1a, 0x1a, 0x1c,
+    0x84, 0x17, 0x00, 0x19, 0x80, 0x17, 0x03, 0x16, 0x18, 0x1b, 0x1d, 0x8c,
+    0x21, 0x00, 0x25, 0x89, 0x21, 0x01, 0x25, 0x27, 0x80, 0x21, 0x85, 0x27,
+    0x05, 0x2b, 0x2c, 0x2c, 0x31, 0x2b, 0x2b, 0x93, 0x31, 0x87, 0x37, 0x83,
+    0x40, 0x85, 0x42, 0x84, 0x48, 0x85, 0x4f, 0x86, 0x51, 0x84, 0x56, 0x05,
+    0x65, 0x65, 0x6c, 0x6a, 0x74, 0x6e, 0x83, 0x78, 0x88, 0x9b, 0x83, 0xd7,
+    0x80, 0x9c, 0x81, 0xd9, 0x31, 0xb4, 0xb5, 0xda, 0xdb, 0xdc, 0xde, 0xe2,
+    0x99, 0xa9, 0xba, 0xe2, 0xb9, 0xa8, 0xa9, 0xbb, 0xab, 0xc7, 0xb0, 0xd1,
+    0xb2, 0xea, 0xe9, 0xcc, 0xc7, 0xc1, 0xe5, 0xa9, 0xa8, 0xe2, 0xb7, 0xe0,
+    0xde, 0xdd, 0xdd, 0xdb, 0xa6, 0xa6, 0xb5, 0xb4, 0xb5, 0xd9, 0xb4, 0xd9,
+    0xde, 0xa8, 0x9f, 0x8b, 0xd8, 0xd7, 0xd7, 0x89, 0x9b, 0x82, 0x78, 0x04,
+    0x9b, 0x83, 0x6c, 0x65, 0x65, 0x80, 0x56, 0x80, 0x51, 0x00, 0x4f, 0x83,
+    0x48, 0x04, 0x42, 0x42, 0x46, 0x42, 0x42, 0x82, 0x40, 0x83, 0x37, 0x00,
+    0x36, 0x87, 0x31, 0x80, 0x2c, 0x00, 0x2b, 0x81, 0x27, 0x05, 0x2a, 0x28,
+    0x23, 0x25, 0x27, 0x27, 0x88, 0x21, 0x80, 0x1b, 0x81, 0x17, 0x00, 0x1c,
+    0x80, 0x17, 0x02, 0x1c, 0x1a, 0x1c, 0x80, 0x17, 0x05, 0x19, 0x18, 0x18,
+    0x16, 0x1b, 0x1d, 0x99, 0x21, 0x04, 0x25, 0x28, 0x25, 0x23, 0x25, 0x85,
+    0x27, 0x06, 0x2b, 0x2c, 0x2c, 0x31, 0x31, 0x2b, 0x2b, 0x8d, 0x31, 0x00,
+    0x35, 0x80, 0x31, 0x88, 0x37, 0x84, 0x40, 0x83, 0x42, 0x85, 0x48, 0x85,
+    0x4f, 0x85, 0x51, 0x84, 0x56, 0x02, 0x65, 0x65, 0x6a, 0x80, 0x6c, 0x83,
+    0x78, 0x89, 0x9b, 0x83, 0xd7, 0x01, 0xd8, 0xd8, 0x80, 0xd9, 0x29, 0xb4,
+    0xb4, 0xb5, 0xb5, 0xdb, 0xdc, 0xdd, 0xe1, 0xb8, 0x98, 0x99, 0x9e, 0x97,
+    0x97, 0xba, 0xe4, 0xe5, 0xc1, 0xc7, 0xcd, 0xeb, 0xd5, 0xd4, 0xd1, 0xb0,
+    0xc7, 0xad, 0xbb, 0xba, 0xa8, 0xb9, 0xb7, 0xe0, 0xde, 0xdd, 0xdc, 0xda,
+    0xda, 0xb5, 0xb4, 0xd9, 0xb4, 0x81, 0xd9, 0x07, 0xb4, 0x8c, 0xb6, 0xa7,
+    0xa6, 0xd9, 0xd8, 0xd7, 0x85, 0x9b, 0x02, 0x83, 0x9b, 0x9b, 0x80, 0x78,
+    0x06, 0x74, 0x78, 0x95, 0x9b, 0x78, 0x65, 0x5b, 0x82, 0x51, 0x01, 0x4f,
+    0x4f, 0x82, 0x48, 0x02, 0x42, 0x46, 0x48, 0x80, 0x42, 0x81, 0x40, 0x82,
+    0x37, 0x81, 0x36, 0x87, 0x31, 0x02, 0x2c, 0x2b, 0x2b, 0x80, 0x27, 0x01,
+    0x2b, 0x2b, 0x81, 0x27, 0x02, 0x25, 0x23, 0x25, 0x88, 0x21, 0x88, 0x1b,
+    0x84, 0x17, 0x01, 0x1d, 0x1d, 0x8f, 0x21, 0x00, 0x25, 0x81, 0x21, 0x09,
+    0x25, 0x23, 0x27, 0x25, 0x23, 0x27, 0x28, 0x25, 0x23, 0x25, 0x85, 0x27,
+    0x80, 0x2a, 0x03, 0x31, 0x2f, 0x2b, 0x2c, 0x8d, 0x31, 0x03, 0x35, 0x34,
+    0x35, 0x36, 0x87, 0x37, 0x85, 0x40, 0x80, 0x42, 0x80, 0x46, 0x83, 0x48,
+    0x86, 0x4f, 0x86, 0x51, 0x83, 0x56, 0x01, 0x65, 0x65, 0x81, 0x6a, 0x01,
+    0x6c, 0x6c, 0x81, 0x78, 0x8a, 0x9b, 0x82, 0xd7, 0x80, 0x9c, 0x00, 0xd9,
+    0x80, 0xb4, 0x09, 0xb5, 0xb5, 0xda, 0xdc, 0xdd, 0xa7, 0xe2, 0xb7, 0xb7,
+    0xe1, 0x80, 0xba, 0x19, 0x9e, 0xe5, 0xbd, 0xc7, 0xc9, 0xcc, 0xb1, 0xd5,
+    0xd3, 0xca, 0xc9, 0xbd, 0xa1, 0x9e, 0xe3, 0xe2, 0xe1, 0xb7, 0xdf, 0xde,
+    0xde, 0xdc, 0xdb, 0xda, 0xb5, 0xb4, 0x80, 0xd9, 0x82, 0x9c, 0x08, 0xd9,
+    0xb4, 0x75, 0xb5, 0xb5, 0xd9, 0xd8, 0xd7, 0x83, 0x81, 0x9b, 0x83, 0x78,
+    0x06, 0x6c, 0x6a, 0x6c, 0x6a, 0x6c, 0x74, 0x65, 0x81, 0x56, 0x80, 0x51,
+    0x01, 0x4f, 0x4f, 0x82, 0x48, 0x00, 0x46, 0x82, 0x42, 0x02, 0x41, 0x41,
+    0x3d, 0x81, 0x37, 0x82, 0x36, 0x87, 0x31, 0x01, 0x2c, 0x2c, 0x86, 0x2a,
+    0x80, 0x27, 0x80, 0x25, 0x80, 0x21, 0x03, 0x25, 0x25, 0x23, 0x25, 0x80,
+    0x21, 0x87, 0x1b, 0x02, 0x1a, 0x1a, 0x1b, 0x81, 0x17, 0x82, 0x1b, 0x8c,
+    0x21, 0x01, 0x25, 0x23, 0x80, 0x25, 0x85, 0x27, 0x01, 0x23, 0x25, 0x80,
+    0x27, 0x01, 0x2b, 0x2b, 0x80, 0x27, 0x81, 0x2a, 0x02, 0x31, 0x2c, 0x2b,
+    0x8c, 0x31, 0x02, 0x35, 0x36, 0x34, 0x80, 0x37, 0x00, 0x36, 0x85, 0x37,
+    0x01, 0x41, 0x3d, 0x82, 0x40, 0x81, 0x42, 0x01, 0x4a, 0x46, 0x82, 0x48,
+    0x02, 0x4f, 0x4c, 0x4c, 0x85, 0x4f, 0x86, 0x51, 0x83, 0x56, 0x01, 0x6a,
+    0x65, 0x81, 0x6a, 0x83, 0x78, 0x8a, 0x9b, 0x82, 0xd7, 0x80, 0x9c, 0x2a,
+    0xd9, 0xb4, 0xb4, 0xb5, 0xb5, 0xa6, 0xdb, 0xdd, 0xde, 0x98, 0xb6, 0xb6,
+    0xe2, 0xba, 0xe3, 0xe3, 0xba, 0xbb, 0xab, 0xc7, 0xc9, 0xca, 0xd1, 0xb2,
+    0xd5, 0xcf, 0xc9, 0xc4, 0xab, 0xbb, 0xba, 0xb9, 0xe1, 0xb7, 0xe0, 0xa7,
+    0xdd, 0xdd, 0xdc, 0xda, 0xda, 0xb5, 0xb4, 0x80, 0xd9, 0x02, 0xd8, 0xd7,
+    0xd8, 0x81, 0xd7, 0x06, 0xd6, 0xd7, 0x95, 0xb3, 0x8b, 0x8d, 0x95, 0x81,
+    0x9b, 0x83, 0x78, 0x01, 0x6e, 0x6c, 0x82, 0x65, 0x80, 0x56, 0x82, 0x51,
+    0x00, 0x4f, 0x82, 0x48, 0x83, 0x42, 0x02, 0x41, 0x41, 0x3d, 0x80, 0x37,
+    0x01, 0x36, 0x36, 0x81, 0x37, 0x88, 0x31, 0x80, 0x2a, 0x00, 0x28, 0x83,
+    0x2a, 0x00, 0x2c, 0x81, 0x27, 0x00, 0x25, 0x83, 0x21, 0x81, 0x25, 0x00,
+    0x22, 0x80, 0x1b, 0x00, 0x21, 0x81, 0x1b, 0x01, 0x1a, 0x19, 0x83, 0x17,
+    0x83, 0x1b, 0x90, 0x21, 0x85, 0x27, 0x0d, 0x25, 0x25, 0x28, 0x28, 0x2a,
+    0x2c, 0x2f, 0x31, 0x2b, 0x2c, 0x2b, 0x2b, 0x28, 0x28, 0x80, 0x2a, 0x8c,
+    0x31, 0x06, 0x35, 0x31, 0x34, 0x37, 0x37, 0x34, 0x36, 0x88, 0x37, 0x81,
+    0x40, 0x82, 0x42, 0x87, 0x48, 0x01, 0x4f, 0x4f, 0x80, 0x51, 0x00, 0x56,
+    0x85, 0x51, 0x85, 0x56, 0x00, 0x65, 0x80, 0x6a, 0x00, 0x6c, 0x85, 0x78,
+    0x86, 0x9b, 0x84, 0xd7, 0x81, 0x9c, 0x2c, 0xd9, 0xb4, 0xb4, 0xb5, 0xda,
+    0xda, 0xdb, 0xdd, 0xde, 0xa7, 0xb6, 0xb8, 0xb9, 0xba, 0xba, 0xa9, 0x9f,
+    0xab, 0xc4, 0xc9, 0xcc, 0xeb, 0xea, 0xb2, 0xeb, 0xca, 0xc7, 0xbd, 0xaa,
+    0xa9, 0xa8, 0xb9, 0xb8, 0xb7, 0xe0, 0xde, 0xdd, 0xdc, 0xdc, 0xdb, 0xda,
+    0xda, 0xb5, 0xd9, 0xd9, 0x81, 0x9c, 0x81, 0xd7, 0x81, 0x9b, 0x06, 0x80,
+    0x9d, 0x9c, 0x95, 0x9b, 0x83, 0x9b, 0x81, 0x78, 0x81, 0x6c, 0x04, 0x65,
+    0x65, 0x5e, 0x5e, 0x65, 0x80, 0x56, 0x01, 0x51, 0x51, 0x82, 0x4f, 0x81,
+    0x48, 0x83, 0x42, 0x81, 0x40, 0x00, 0x3d, 0x84, 0x37, 0x88, 0x31, 0x00,
+    0x2b, 0x85, 0x27, 0x05, 0x2b, 0x2b, 0x27, 0x23, 0x25, 0x25, 0x8a, 0x21,
+    0x83, 0x1b, 0x82, 0x17, 0x00, 0x19, 0x81, 0x17, 0x82, 0x1b, 0x91, 0x21,
+    0x80, 0x27, 0x01, 0x25, 0x23, 0x80, 0x25, 0x01, 0x27, 0x25, 0x83, 0x27,
+    0x02, 0x2b, 0x2b, 0x28, 0x85, 0x2a, 0x85, 0x31, 0x00, 0x35, 0x83, 0x31,
+    0x03, 0x37, 0x37, 0x34, 0x36, 0x88, 0x37, 0x81, 0x40, 0x83, 0x42, 0x86,
+    0x48, 0x01, 0x4f, 0x4f, 0x80, 0x51, 0x00, 0x56, 0x82, 0x51, 0x88, 0x56,
+    0x00, 0x65, 0x82, 0x6a, 0x85, 0x78, 0x85, 0x9b, 0x83, 0xd7, 0x81, 0x9c,
+    0x2d, 0xd9, 0xd9, 0xb4, 0xb5, 0xb5, 0xda, 0xdb, 0xdc, 0xde, 0xa7, 0xe0,
+    0xb6, 0xb8, 0xb9, 0xba, 0xa9, 0x9e, 0xaa, 0xbd, 0xc7, 0xca, 0xd2, 0xea,
+    0xb2, 0xd1, 0xcd, 0xc7, 0xc4, 0xab, 0xe4, 0xba, 0xb9, 0xe1, 0xb7, 0xb6,
+    0xe0, 0xde, 0xdd, 0xdc, 0xdb, 0xda, 0xb5, 0xb5, 0xb4, 0xd9, 0xd9, 0x81,
+    0x9c, 0x81, 0xd7, 0x81, 0x9b, 0x01, 0x95, 0xd7, 0x80, 0x9b, 0x01, 0x83,
+    0x9b, 0x81, 0x78, 0x81, 0x6c, 0x02, 0x6a, 0x65, 0x65, 0x82, 0x56, 0x01,
+    0x53, 0x51, 0x81, 0x4f, 0x82, 0x48, 0x82, 0x42, 0x82, 0x40, 0x00, 0x3d,
+    0x84, 0x37, 0x88, 0x31, 0x81, 0x2a, 0x82, 0x27, 0x05, 0x2b, 0x2b, 0x27,
+    0x23, 0x28, 0x27, 0x82, 0x25, 0x02, 0x27, 0x27, 0x25, 0x82, 0x21, 0x87,
+    0x1b, 0x80, 0x17, 0x02, 0x19, 0x1a, 0x1a, 0x82, 0x1b, 0x92, 0x21, 0x07,
+    0x25, 0x28, 0x25, 0x23, 0x25, 0x25, 0x27, 0x27, 0x80, 0x25, 0x81, 0x27,
+    0x07, 0x2a, 0x28, 0x28, 0x2b, 0x2c, 0x2b, 0x2b, 0x2c, 0x80, 0x2a, 0x8c,
+    0x31, 0x02, 0x39, 0x37, 0x34, 0x89, 0x37, 0x81, 0x40, 0x84, 0x42, 0x85,
+    0x48, 0x01, 0x4f, 0x4f, 0x86, 0x51, 0x87, 0x56, 0x80, 0x65, 0x02, 0x6a,
+    0x6a, 0x6c, 0x85, 0x78, 0x86, 0x9b, 0x83, 0xd7, 0x81, 0x9c, 0x2d, 0xd9,
+    0xd9, 0xb4, 0xb5, 0xda, 0xdb, 0xdb, 0xdc, 0xde, 0xe0, 0xb6, 0xb7, 0xe1,
+    0xa8, 0xba, 0xa9, 0xe4, 0xab, 0xc9, 0xcd, 0xd1, 0xd4, 0xd5, 0xeb, 0xca,
+    0xc7, 0xc7, 0xad, 0xaa, 0x9e, 0xe3, 0xb9, 0xb8, 0xb7, 0xb6, 0x98, 0xde,
+    0xdd, 0xdb, 0xdb, 0xb5, 0xb5, 0xb4, 0xb4, 0xd9, 0xd9, 0x81, 0x9c, 0x81,
+    0xd7, 0x86, 0x9b, 0x01, 0x83, 0x9b, 0x81, 0x78, 0x80, 0x6c, 0x81, 0x6a,
+    0x82, 0x56, 0x80, 0x51, 0x01, 0x4f, 0x4f, 0x83, 0x48, 0x03, 0x46, 0x4a,
+    0x42, 0x42, 0x83, 0x40, 0x01, 0x3d, 0x3d, 0x82, 0x37, 0x01, 0x36, 0x36,
+    0x87, 0x31, 0x03, 0x2b, 0x2c, 0x2b, 0x2c, 0x80, 0x2a, 0x80, 0x27, 0x02,
+    0x2b, 0x28, 0x25, 0x86, 0x27, 0x00, 0x25, 0x83, 0x21, 0x87, 0x1b, 0x80,
+    0x17, 0x01, 0x1c, 0x1a, 0x84, 0x1b, 0x89, 0x21, 0x00, 0x25, 0x83, 0x21,
+    0x05, 0x25, 0x27, 0x25, 0x25, 0x23, 0x25, 0x85, 0x27, 0x03, 0x2b, 0x2b,
+    0x28, 0x28, 0x80, 0x2a, 0x05, 0x2c, 0x31, 0x2f, 0x2c, 0x2b, 0x2f, 0x8a,
+    0x31, 0x03, 0x36, 0x39, 0x39, 0x36, 0x85, 0x37, 0x00, 0x40, 0x80, 0x37,
+    0x81, 0x40, 0x85, 0x42, 0x84, 0x48, 0x01, 0x4f, 0x4f, 0x85, 0x51, 0x88,
+    0x56, 0x03, 0x65, 0x65, 0x6a, 0x6c, 0x86, 0x78, 0x87, 0x9b, 0x82, 0xd7,
+    0x81, 0x9c, 0x29, 0xd9, 0xd9, 0xb4, 0xb5, 0xa6, 0xda, 0xdb, 0xdc, 0xdc,
+    0xde, 0xe0, 0xb6, 0xb7, 0xe2, 0xe3, 0xa9, 0x9e, 0xaa, 0xc1, 0xca, 0xd2,
+    0xb2, 0xd5, 0xb2, 0xce, 0xc9, 0xc7, 0xbd, 0xe5, 0xe4, 0xba, 0xa8, 0xe2,
+    0xb8, 0xb6, 0xe0, 0xa7, 0xdd, 0xdd, 0xdb, 0xda, 0xb5, 0x80, 0xb4, 0x01,
+    0xd9, 0xd9, 0x80, 0x9c, 0x82, 0xd7, 0x88, 0x9b, 0x81, 0x78, 0x03, 0x6c,
+    0x6a, 0x6a, 0x65, 0x80, 0x6a, 0x82, 0x56, 0x82, 0x51, 0x00, 0x4f, 0x85,
+    0x48, 0x01, 0x42, 0x42, 0x82, 0x40, 0x02, 0x3d, 0x3d, 0x41, 0x83, 0x37,
+    0x02, 0x36, 0x36, 0x35, 0x84, 0x31, 0x03, 0x2c, 0x2b, 0x2d, 0x2c, 0x80,
+    0x2a, 0x05, 0x27, 0x27, 0x2a, 0x2b, 0x28, 0x25, 0x86, 0x27, 0x00, 0x25,
+    0x84, 0x21, 0x85, 0x1b, 0x83, 0x17, 0x85, 0x1b, 0x8f, 0x21, 0x04, 0x25,
+    0x28, 0x27, 0x25, 0x25, 0x85, 0x27, 0x0f, 0x2b, 0x2c, 0x2b, 0x28, 0x28,
+    0x2b, 0x2c, 0x28, 0x2b, 0x2c, 0x2c, 0x31, 0x2b, 0x2b, 0x2c, 0x2c, 0x88,
+    0x31, 0x00, 0x36, 0x88, 0x37, 0x03, 0x40, 0x41, 0x3c, 0x3c, 0x81, 0x40,
+    0x85, 0x42, 0x00, 0x46, 0x83, 0x48, 0x01, 0x4f, 0x4f, 0x88, 0x51, 0x84,
+    0x56, 0x03, 0x65, 0x65, 0x6a, 0x6c, 0x81, 0x78, 0x00, 0x9b, 0x81, 0x78,
+    0x88, 0x9b, 0x82, 0xd7, 0x01, 0xd8, 0xd8, 0x81, 0xd9, 0x29, 0xb4, 0xb5,
+    0xa6, 0xda, 0xdb, 0xdc, 0xdc, 0xde, 0xe0, 0xb6, 0xb7, 0xe2, 0xba, 0xe4,
+    0xaa, 0xbd, 0xb0, 0xd1, 0xb2, 0xea, 0xd3, 0xce, 0xb0, 0xc7, 0xad, 0xa1,
+    0xe4, 0xba, 0xa8, 0xe2, 0xe1, 0xb7, 0xe0, 0xdf, 0xde, 0xdd, 0xdc, 0xdb,
+    0xda, 0xb5, 0xb4, 0xb4, 0x80, 0xd9, 0x80, 0x9c, 0x83, 0xd7, 0x86, 0x9b,
+    0x82, 0x78, 0x03, 0x74, 0x6c, 0x6a, 0x6a, 0x80, 0x65, 0x84, 0x56, 0x80,
+    0x51, 0x01, 0x4f, 0x4f, 0x84, 0x48, 0x80, 0x42, 0x07, 0x41, 0x41, 0x3d,
+    0x3c, 0x3d, 0x41, 0x3d, 0x3d, 0x82, 0x37, 0x01, 0x36, 0x36, 0x82, 0x31,
+    0x06, 0x2c, 0x31, 0x31, 0x2b, 0x2b, 0x2c, 0x2c, 0x85, 0x27, 0x00, 0x25,
+    0x83, 0x27, 0x03, 0x25, 0x25, 0x27, 0x25, 0x80, 0x21, 0x00, 0x25, 0x83,
+    0x21, 0x82, 0x1b, 0x02, 0x1a, 0x19, 0x19, 0x80, 0x17, 0x85, 0x1b, 0x86,
+    0x21, 0x00, 0x25, 0x82, 0x21, 0x03, 0x25, 0x23, 0x23, 0x25, 0x80, 0x27,
+    0x04, 0x25, 0x23, 0x23, 0x25, 0x25, 0x80, 0x27, 0x07, 0x2b, 0x2b, 0x2c,
+    0x2b, 0x2a, 0x28, 0x28, 0x2a, 0x80, 0x27, 0x80, 0x2a, 0x02, 0x2c, 0x2b,
+    0x2c, 0x89, 0x31, 0x88, 0x37, 0x05, 0x40, 0x41, 0x3c, 0x3c, 0x41, 0x41,
+    0x84, 0x42, 0x00, 0x4a, 0x80, 0x42, 0x84, 0x48, 0x00, 0x4f, 0x84, 0x51,
+    0x80, 0x56, 0x01, 0x53, 0x53, 0x81, 0x56, 0x05, 0x65, 0x5e, 0x65, 0x65,
+    0x6a, 0x6e, 0x86, 0x78, 0x88, 0x9b, 0x82, 0xd7, 0x01, 0xd8, 0xd8, 0x81,
+    0xd9, 0x2b, 0xb4, 0xb5, 0xda, 0xda, 0xdb, 0xdc, 0xdd, 0xdf, 0xb6, 0xb7,
+    0xb8, 0xb9, 0xba, 0xbb, 0xad, 0xc7, 0xca, 0xb1, 0xea, 0xe9, 0xd1, 0xcd,
+    0xc7, 0xc1, 0xa1, 0xe4, 0xba, 0xb9, 0xe2, 0x99, 0xb7, 0xe0, 0xe0, 0xdf,
+    0xde, 0xdd, 0xdc, 0xdb, 0xda, 0xb5, 0xb4, 0xb4, 0xd9, 0xd9, 0x81, 0x9c,
+    0x83, 0xd7, 0x86, 0x9b, 0x82, 0x78, 0x01, 0x74, 0x6c, 0x80, 0x6a, 0x00,
+    0x65, 0x86, 0x56, 0x03, 0x51, 0x51, 0x4f, 0x4f, 0x85, 0x48, 0x05, 0x42,
+    0x42, 0x41, 0x41, 0x3d, 0x3c, 0x80, 0x3d, 0x84, 0x37, 0x00, 0x36, 0x80,
+    0x31, 0x08, 0x35, 0x31, 0x2c, 0x31, 0x31, 0x2b, 0x2c, 0x2b, 0x2a, 0x81,
+    0x27, 0x00, 0x25, 0x80, 0x27, 0x00, 0x25, 0x81, 0x27, 0x04, 0x2a, 0x27,
+    0x23, 0x23, 0x25, 0x81, 0x21, 0x00, 0x25, 0x82, 0x21, 0x83, 0x1b, 0x01,
+    0x1a, 0x19, 0x81, 0x17, 0x81, 0x1b, 0x00, 0x1f, 0x80, 0x1b, 0x92, 0x21,
+    0x02, 0x25, 0x23, 0x23, 0x85, 0x27, 0x01, 0x2b, 0x2b, 0x83, 0x27, 0x82,
+    0x2a, 0x8b, 0x31, 0x85, 0x37, 0x80, 0x40, 0x00, 0x3d, 0x80, 0x37, 0x00,
+    0x41, 0x84, 0x42, 0x88, 0x48, 0x00, 0x4f, 0x85, 0x51, 0x86, 0x56, 0x81,
+    0x65, 0x01, 0x6c, 0x6a, 0x87, 0x78, 0x86, 0x9b, 0x82, 0xd7, 0x80, 0x9c,
+    0x80, 0xd9, 0x29, 0xb4, 0xb4, 0xb5, 0xa6, 0xda, 0xdc, 0xdd, 0xde, 0xe0,
+    0xb6, 0xb7, 0xe2, 0xa8, 0xba, 0xbb, 0xbd, 0xc7, 0xca, 0xd3, 0xea, 0xe9,
+    0xce, 0xb0, 0xc7, 0xad, 0xaa, 0x9e, 0xe3, 0xb9, 0x99, 0xb8, 0xb7, 0xe0,
+    0xa7, 0xde, 0xdd, 0xdc, 0xdb, 0xdb, 0xb5, 0xb5, 0xb4, 0x81, 0xd9, 0x01,
+    0xd8, 0xd8, 0x83, 0xd7, 0x87, 0x9b, 0x82, 0x78, 0x01, 0x6c, 0x6c, 0x80,
+    0x6a, 0x00, 0x65, 0x84, 0x56, 0x01, 0x53, 0x53, 0x81, 0x4f, 0x84, 0x48,
+    0x00, 0x46, 0x81, 0x42, 0x81, 0x40, 0x82, 0x37, 0x02, 0x36, 0x37, 0x36,
+    0x82, 0x31, 0x04, 0x2c, 0x2b, 0x31, 0x31, 0x2c, 0x80, 0x2a, 0x02, 0x28,
+    0x2a, 0x2a, 0x88, 0x27, 0x00, 0x25, 0x80, 0x21, 0x00, 0x25, 0x80, 0x27,
+    0x00, 0x25, 0x82, 0x21, 0x82, 0x1b, 0x06, 0x1a, 0x1b, 0x1a, 0x1a, 0x1b,
+    0x1b, 0x1a, 0x84, 0x1b, 0x00, 0x1f, 0x96, 0x21, 0x00, 0x25, 0x88, 0x27,
+    0x07, 0x2d, 0x28, 0x2b, 0x2b, 0x2c, 0x2c, 0x2b, 0x2c, 0x8c, 0x31, 0x01,
+    0x36, 0x34, 0x82, 0x37, 0x02, 0x41, 0x3d, 0x3d, 0x80, 0x37, 0x01, 0x41,
+    0x41, 0x84, 0x42, 0x87, 0x48, 0x01, 0x4f, 0x4f, 0x84, 0x51, 0x87, 0x56,
+    0x81, 0x65, 0x01, 0x6a, 0x6c, 0x86, 0x78, 0x86, 0x9b, 0x83, 0xd7, 0x80,
+    0x9c, 0x80, 0xd9, 0x01, 0xb4, 0xb5, 0x80, 0xa6, 0x2a, 0xdc, 0xdd, 0xde,
+    0xe0, 0xb7, 0xb8, 0xe2, 0xa8, 0xa9, 0xaa, 0xbd, 0xc7, 0xcd, 0xd2, 0xd5,
+    0xd4, 0xce, 0xb0, 0xc1, 0xe5, 0xbb, 0xba, 0xa8, 0xe2, 0xb8, 0xb7, 0xb6,
+    0xdf, 0xde, 0xdd, 0xdd, 0xdb, 0xdb, 0xda, 0xb5, 0xb4, 0xb4, 0xd9, 0xd9,
+    0xd8, 0xd9, 0xd8, 0xd8, 0x83, 0xd7, 0x87, 0x9b, 0x82, 0x78, 0x01, 0x6e,
+    0x6c, 0x80, 0x6a, 0x00, 0x65, 0x84, 0x56, 0x01, 0x53, 0x51, 0x82, 0x4f,
+    0x83, 0x48, 0x00, 0x46, 0x81, 0x42, 0x81, 0x40, 0x00, 0x3d, 0x84, 0x37,
+    0x83, 0x31, 0x05, 0x2b, 0x31, 0x31, 0x2b, 0x2c, 0x2b, 0x80, 0x27, 0x00,
+    0x2a, 0x87, 0x27, 0x01, 0x25, 0x25, 0x80, 0x21, 0x00, 0x25, 0x81, 0x27,
+    0x00, 0x25, 0x81, 0x21, 0x88, 0x1b, 0x00, 0x1a, 0x85, 0x1b, 0x85, 0x21,
+    0x00, 0x25, 0x8c, 0x21, 0x00, 0x25, 0x89, 0x27, 0x00, 0x2d, 0x81, 0x2a,
+    0x91, 0x31, 0x00, 0x36, 0x81, 0x37, 0x00, 0x41, 0x81, 0x37, 0x02, 0x3d,
+    0x41, 0x41, 0x84, 0x42, 0x87, 0x48, 0x01, 0x4f, 0x4f, 0x84, 0x51, 0x87,
+    0x56, 0x80, 0x65, 0x02, 0x6a, 0x6a, 0x6c, 0x84, 0x78, 0x87, 0x9b, 0x83,
+    0xd7, 0x81, 0x9c, 0x80, 0xd9, 0x28, 0xb4, 0xb5, 0xda, 0xda, 0xdb, 0xdc,
+    0xde, 0xa7, 0xe0, 0xb7, 0xb8, 0xe2, 0xa8, 0xba, 0xaa, 0xbd, 0xc7, 0xcb,
+    0xd0, 0xea, 0xd4, 0xe8, 0xcb, 0xbd, 0xaa, 0x9e, 0xa8, 0xb9, 0xe1, 0xb7,
+    0xb6, 0xe0, 0xdf, 0xde, 0xdd, 0xdc, 0xdb, 0xda, 0xa6, 0xb4, 0xb4, 0x80,
+    0xd9, 0x80, 0x9c, 0x83, 0xd7, 0x88, 0x9b, 0x83, 0x78, 0x05, 0x6c, 0x6a,
+    0x6c, 0x6a, 0x65, 0x65, 0x84, 0x56, 0x80, 0x51, 0x80, 0x4f, 0x83, 0x48,
+    0x00, 0x46, 0x82, 0x42, 0x80, 0x40, 0x01, 0x3d, 0x3d, 0x83, 0x37, 0x00,
+    0x36, 0x82, 0x31, 0x04, 0x2c, 0x31, 0x31, 0x2b, 0x2c, 0x82, 0x2a, 0x01,
+    0x28, 0x2a, 0x83, 0x27, 0x80, 0x25, 0x81, 0x21, 0x01, 0x25, 0x25, 0x81,
+    0x27, 0x00, 0x25, 0x81, 0x21, 0x86, 0x1b, 0x01, 0x1a, 0x1a, 0x81, 0x1b,
+    0x95, 0x21, 0x00, 0x25, 0x8c, 0x27, 0x05, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b,
+    0x2c, 0x85, 0x31, 0x00, 0x2f, 0x88, 0x31, 0x00, 0x36, 0x85, 0x37, 0x01,
+    0x3d, 0x3d, 0x80, 0x40, 0x84, 0x42, 0x86, 0x48, 0x01, 0x4f, 0x4f, 0x84,
+    0x51, 0x87, 0x56, 0x05, 0x65, 0x5e, 0x65, 0x6a, 0x6a, 0x6c, 0x84, 0x78,
+    0x88, 0x9b, 0x82, 0xd7, 0x81, 0x9c, 0x2a, 0xd9, 0xd9, 0xb4, 0xb4, 0xa6,
+    0xda, 0xdb, 0xdb, 0xdd, 0xde, 0xa7, 0xe0, 0xb7, 0x99, 0xe2, 0xe3, 0x9e,
+    0xa1, 0xc1, 0xc7, 0xcd, 0xd0, 0xd4, 0xb1, 0xcc, 0xc9, 0xad, 0xbb, 0xba,
+    0xa8, 0xe2, 0xb8, 0xb7, 0xe0, 0xe0, 0xde, 0xdd, 0xdc, 0xdc, 0xdb, 0xda,
+    0xb5, 0xb4, 0x80, 0xd9, 0x80, 0x9c, 0x83, 0xd7, 0x88, 0x9b, 0x83, 0x78,
+    0x01, 0x6c, 0x6e, 0x80, 0x6a, 0x01, 0x65, 0x65, 0x84, 0x56, 0x81, 0x51,
+    0x80, 0x4f, 0x82, 0x48, 0x00, 0x46, 0x83, 0x42, 0x80, 0x40, 0x01, 0x3d,
+    0x3d, 0x83, 0x37, 0x00, 0x36, 0x81, 0x31, 0x00, 0x2c, 0x80, 0x31, 0x82,
+    0x2a, 0x80, 0x27, 0x80, 0x2a, 0x80, 0x27, 0x00, 0x25, 0x82, 0x21, 0x00,
+    0x25, 0x80, 0x21, 0x02, 0x27, 0x25, 0x25, 0x87, 0x21, 0x81, 0x1b, 0x80,
+    0x17, 0x01, 0x1b, 0x1b, 0x96, 0x21, 0x00, 0x25, 0x88, 0x27, 0x80, 0x2a,
+    0x80, 0x27, 0x81, 0x2a, 0x88, 0x31, 0x02, 0x35, 0x34, 0x36, 0x83, 0x31,
+    0x86, 0x37, 0x03, 0x3d, 0x41, 0x42, 0x41, 0x85, 0x42, 0x86, 0x48, 0x01,
+    0x4f, 0x4f, 0x83, 0x51, 0x83, 0x56, 0x80, 0x65, 0x07, 0x5e, 0x5e, 0x65,
+    0x65, 0x6a, 0x74, 0x6c, 0x6c, 0x84, 0x78, 0x89, 0x9b, 0x81, 0xd7, 0x81,
+    0x9c, 0x2a, 0xd9, 0xd9, 0xb4, 0xb5, 0xa6, 0xdb, 0xdb, 0xdc, 0xdd, 0xa7,
+    0xdf, 0xb6, 0xb7, 0xe1, 0xa8, 0xa9, 0xbb, 0xab, 0xc7, 0xcb, 0xce, 0xb1,
+    0xb2, 0xd1, 0xb0, 0xc7, 0xab, 0x9f, 0xba, 0xa8, 0xe2, 0xb8, 0xb7, 0xe0,
+    0xdf, 0xde, 0xdc, 0xdc, 0xdb, 0xda, 0xb5, 0xb4, 0xb4, 0x80, 0xd9, 0x01,
+    0xd8, 0xd8, 0x85, 0xd7, 0x87, 0x9b, 0x85, 0x78, 0x00, 0x6c, 0x80, 0x6a,
+    0x01, 0x65, 0x65, 0x84, 0x56, 0x80, 0x51, 0x80, 0x4f, 0x81, 0x48, 0x81,
+    0x46, 0x81, 0x42, 0x01, 0x41, 0x41, 0x81, 0x3d, 0x83, 0x37, 0x81, 0x31,
+    0x00, 0x2c, 0x84, 0x31, 0x0a, 0x2b, 0x2b, 0x28, 0x2b, 0x2b, 0x2c, 0x2b,
+    0x2b, 0x28, 0x27, 0x25, 0x82, 0x21, 0x00, 0x25, 0x80, 0x21, 0x00, 0x25,
+    0x8b, 0x21, 0x80, 0x1b, 0x00, 0x1a, 0x81, 0x1b, 0x96, 0x21, 0x00, 0x25,
+    0x81, 0x21, 0x00, 0x25, 0x82, 0x27, 0x01, 0x2b, 0x2b, 0x80, 0x27, 0x81,
+    0x2a, 0x01, 0x2c, 0x2c, 0x88, 0x31, 0x01, 0x36, 0x39, 0x83, 0x31, 0x86,
+    0x37, 0x03, 0x3d, 0x41, 0x42, 0x41, 0x86, 0x42, 0x86, 0x48, 0x01, 0x4f,
+    0x4f, 0x82, 0x51, 0x83, 0x56, 0x80, 0x65, 0x07, 0x5e, 0x5e, 0x65, 0x65,
+    0x6a, 0x78, 0x6c, 0x74, 0x84, 0x78, 0x89, 0x9b, 0x81, 0xd7, 0x80, 0x9c,
+    0x80, 0xd9, 0x27, 0xb4, 0xb4, 0xda, 0xdb, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0xb6, 0xb8, 0xe2, 0xe3, 0x9e, 0xe5, 0xc1, 0xc9, 0xc8, 0xb1, 0xea, 0xeb,
+    0xca, 0xc7, 0xc7, 0xab, 0x9e, 0xe3, 0xa8, 0xe2, 0xb8, 0xb6, 0xe0, 0xa7,
+    0xdd, 0xdc, 0xdc, 0xdb, 0xa6, 0xb5, 0xb4, 0x81, 0xd9, 0x81, 0x9c, 0x82,
+    0xd7, 0x8a, 0x9b, 0x84, 0x78, 0x80, 0x6a, 0x00, 0x65, 0x83, 0x56, 0x01,
+    0x53, 0x56, 0x80, 0x51, 0x81, 0x4f, 0x03, 0x4c, 0x48, 0x46, 0x46, 0x80,
+    0x48, 0x82, 0x42, 0x01, 0x41, 0x41, 0x80, 0x3d, 0x84, 0x37, 0x89, 0x31,
+    0x80, 0x2a, 0x03, 0x2c, 0x2c, 0x2b, 0x2b, 0x80, 0x27, 0x05, 0x25, 0x23,
+    0x25, 0x23, 0x23, 0x25, 0x8f, 0x21, 0x85, 0x1b, 0x80, 0x21, 0x80, 0x1b,
+    0x97, 0x21, 0x03, 0x25, 0x23, 0x27, 0x28, 0x81, 0x2a, 0x00, 0x28, 0x80,
+    0x2a, 0x04, 0x2c, 0x31, 0x31, 0x2b, 0x2c, 0x87, 0x31, 0x00, 0x36, 0x81,
+    0x31, 0x01, 0x36, 0x34, 0x84, 0x37, 0x02, 0x36, 0x39, 0x39, 0x81, 0x40,
+    0x81, 0x42, 0x00, 0x41, 0x81, 0x42, 0x88, 0x48, 0x00, 0x4f, 0x80, 0x51,
+    0x81, 0x56, 0x01, 0x65, 0x5e, 0x83, 0x65, 0x82, 0x6a, 0x84, 0x78, 0x87,
+    0x9b, 0x84, 0xd7, 0x01, 0xd8, 0xd8, 0x80, 0xd9, 0x29, 0xb4, 0xb4, 0xb5,
+    0xda, 0xdb, 0xdc, 0xde, 0xde, 0xdf, 0xb7, 0xe1, 0xb9, 0xe3, 0x9e, 0xab,
+    0xc7, 0xcd, 0xd2, 0xb2, 0xd3, 0xe8, 0xc9, 0xc4, 0xc1, 0xc1, 0x9e, 0xb9,
+    0xb9, 0x99, 0xb8, 0xb6, 0xdf, 0xde, 0xdd, 0xdc, 0xdc, 0xdb, 0xa6, 0xb5,
+    0xb4, 0xd9, 0xd9, 0x82, 0x9c, 0x83, 0xd7, 0x8a, 0x9b, 0x85, 0x78, 0x02,
+    0x6c, 0x6a, 0x6a, 0x82, 0x56, 0x83, 0x51, 0x80, 0x4f, 0x85, 0x48, 0x82,
+    0x42, 0x82, 0x40, 0x84, 0x37, 0x84, 0x31, 0x02, 0x2f, 0x31, 0x2f, 0x80,
+    0x31, 0x80, 0x2c, 0x81, 0x2a, 0x80, 0x27, 0x02, 0x25, 0x27, 0x25, 0x92,
+    0x21, 0x80, 0x1b, 0x05, 0x21, 0x21, 0x1d, 0x1d, 0x21, 0x21, 0x82, 0x1b,
+    0x94, 0x21, 0x03, 0x25, 0x23, 0x23, 0x25, 0x80, 0x27, 0x01, 0x2a, 0x28,
+    0x81, 0x2a, 0x04, 0x28, 0x2b, 0x2c, 0x2c, 0x2b, 0x8f, 0x31, 0x83, 0x37,
+    0x00, 0x36, 0x80, 0x37, 0x00, 0x3d, 0x80, 0x40, 0x86, 0x42, 0x00, 0x46,
+    0x85, 0x48, 0x03, 0x4f, 0x4c, 0x51, 0x53, 0x85, 0x56, 0x02, 0x65, 0x65,
+    0x6a, 0x80, 0x65, 0x80, 0x6a, 0x01, 0x6c, 0x6c, 0x84, 0x78, 0x87, 0x9b,
+    0x84, 0xd7, 0x01, 0xd8, 0xd8, 0x80, 0xd9, 0x29, 0xb4, 0xb4, 0xb5, 0xda,
+    0xdb, 0xdc, 0xde, 0xa7, 0xe0, 0xb7, 0xe1, 0xb9, 0xba, 0xbb, 0xad, 0xc9,
+    0xce, 0xb2, 0xd4, 0xe8, 0xcb, 0xc7, 0xab, 0xe5, 0xc1, 0x9e, 0xe2, 0xe2,
+    0x99, 0xb8, 0xb6, 0xdf, 0xde, 0xdd, 0xdb, 0xdb, 0xda, 0xb5, 0xb4, 0xb4,
+    0xd9, 0xd9, 0x82, 0x9c, 0x82, 0xd7, 0x8b, 0x9b, 0x85, 0x78, 0x02, 0x6e,
+    0x6c, 0x6a, 0x82, 0x56, 0x83, 0x51, 0x80, 0x4f, 0x85, 0x48, 0x83, 0x42,
+    0x81, 0x40, 0x83, 0x37, 0x00, 0x36, 0x88, 0x31, 0x04, 0x2c, 0x2c, 0x31,
+    0x2c, 0x2c, 0x80, 0x2a, 0x01, 0x28, 0x28, 0x82, 0x25, 0x90, 0x21, 0x86,
+    0x1b, 0x00, 0x21, 0x84, 0x1b, 0x93, 0x21, 0x03, 0x25, 0x23, 0x23, 0x25,
+    0x83, 0x27, 0x80, 0x2a, 0x00, 0x28, 0x81, 0x2a, 0x90, 0x31, 0x00, 0x36,
+    0x83, 0x37, 0x03, 0x40, 0x41, 0x3c, 0x3c, 0x81, 0x40, 0x85, 0x42, 0x84,
+    0x48, 0x80, 0x4f, 0x01, 0x51, 0x53, 0x85, 0x56, 0x83, 0x65, 0x81, 0x6a,
+    0x00, 0x6c, 0x83, 0x78, 0x88, 0x9b, 0x84, 0xd7, 0x2e, 0xd8, 0xd9, 0xd9,
+    0xb4, 0xd9, 0xb4, 0xb5, 0xa6, 0xa6, 0xdb, 0xdd, 0xa7, 0xdf, 0xe0, 0xb8,
+    0xe1, 0xb9, 0xba, 0xaa, 0xc1, 0xb0, 0xd2, 0xd5, 0xd3, 0xcd, 0xc7, 0xc7,
+    0xad, 0xa1, 0xe5, 0xba, 0xe2, 0xe2, 0xb8, 0xb7, 0xe0, 0xa7, 0xdd, 0xdc,
+    0xdb, 0xdb, 0xda, 0xb5, 0xb4, 0xb4, 0xd9, 0xd9, 0x81, 0x9c, 0x83, 0xd7,
+    0x8a, 0x9b, 0x86, 0x78, 0x02, 0x6e, 0x6c, 0x65, 0x84, 0x56, 0x81, 0x51,
+    0x80, 0x4f, 0x85, 0x48, 0x01, 0x46, 0x46, 0x81, 0x42, 0x81, 0x40, 0x83,
+    0x37, 0x88, 0x31, 0x02, 0x2c, 0x2b, 0x2b, 0x80, 0x31, 0x02, 0x2b, 0x31,
+    0x2b, 0x80, 0x27, 0x04, 0x25, 0x25, 0x23, 0x25, 0x25, 0x90, 0x21, 0x80,
+    0x1b,
+};
+
+//
+// ../images.c:g_pucBlue50x50: 50x50 sprite, 1178 bytes, 99.0 dB.
+//
+const uint8_t g_pui8ButtonSprite[] =
+{
+    0x51, 0x32, 0x00, 0x32, 0x00, 0x89, 0x00, 0x00, 0x45, 0x04, 0x00, 0x0c,
+    0x00, 0x10, 0x00, 0x13, 0x00, 0x15, 0x00, 0x13, 0x00, 0x92, 0x15, 0x00,
+    0x44, 0x13, 0x00, 0x12, 0x00, 0x0f, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x89,
+    0x00, 0x00, 0x87, 0x00, 0x00, 0x41, 0x0a, 0x00, 0x13, 0x00, 0x85, 0x15,
+    0x00, 0x97, 0x13, 0x00, 0x41, 0x10, 0x00, 0x0a, 0x00, 0x87, 0x00, 0x00,
+    0x85, 0x00, 0x00, 0x41, 0x04, 0x00, 0x13, 0x00, 0x86, 0x15, 0x00, 0x96,
+    0x13, 0x00, 0x81, 0x12, 0x00, 0x81, 0x11, 0x00, 0x41, 0x10, 0x00, 0x04,
+    0x00, 0x85, 0x00, 0x00, 0x84, 0x00, 0x00, 0x40, 0x0c, 0x00, 0x85, 0x15,
+    0x00, 0x84, 0x13, 0x00, 0x93, 0x12, 0x00, 0x81, 0x11, 0x00, 0x40, 0x12,
+    0x00, 0x81, 0x11, 0x00, 0x81, 0x10, 0x00, 0x40, 0x0a, 0x00, 0x84, 0x00,
+    0x00, 0x83, 0x00, 0x00, 0x40, 0x0c, 0x00, 0x84, 0x15, 0x00, 0x82, 0x13,
+    0x00, 0x81, 0x12, 0x00, 0x9b, 0x11, 0x00, 0x42, 0x10, 0x00, 0x0f, 0x00,
+    0x0a, 0x00, 0x83, 0x00, 0x00, 0x82, 0x00, 0x00, 0x40, 0x0c, 0x00, 0x83,
+    0x15, 0x00, 0x82, 0x13, 0x00, 0x40, 0x12, 0x00, 0x82, 0x11, 0x00, 0x99,
+    0x10, 0x00, 0x40, 0x11, 0x00, 0x82, 0x10, 0x00, 0x41, 0x0f, 0x00, 0x0a,
+    0x00, 0x82, 0x00, 0x00, 0x81, 0x00, 0x00, 0x40, 0x04, 0x00, 0x83, 0x15,
+    0x00, 0x81, 0x13, 0x00, 0x40, 0x12, 0x00, 0x82, 0x11, 0x00, 0x83, 0x10,
+    0x00, 0x92, 0x0f, 0x00, 0x88, 0x10, 0x00, 0x42, 0x0f, 0x00, 0x0d, 0x00,
+    0x04, 0x00, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x40, 0x13, 0x00, 0x82,
+    0x15, 0x00, 0x81, 0x13, 0x00, 0x40, 0x12, 0x00, 0x81, 0x11, 0x00, 0x82,
+    0x10, 0x00, 0x98, 0x0f, 0x00, 0x85, 0x10, 0x00, 0x81, 0x0f, 0x00, 0x40,
+    0x0c, 0x00, 0x81, 0x00, 0x00, 0x41, 0x00, 0x00, 0x0a, 0x00, 0x82, 0x15,
+    0x00, 0x81, 0x13, 0x00, 0x40, 0x12, 0x00, 0x81, 0x11, 0x00, 0x81, 0x10,
+    0x00, 0x9c, 0x0f, 0x00, 0x83, 0x10, 0x00, 0x81, 0x0f, 0x00, 0x42, 0x0d,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x12, 0x00, 0x13, 0x00,
+    0x15, 0x00, 0x81, 0x13, 0x00, 0x40, 0x12, 0x00, 0x81, 0x11, 0x00, 0x81,
+    0x10, 0x00, 0x9e, 0x0f, 0x00, 0x81, 0x10, 0x00, 0x82, 0x0f, 0x00, 0x42,
+    0x0d, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x42, 0x04, 0x00, 0x13, 0x00, 0x15,
+    0x00, 0x81, 0x13, 0x00, 0x40, 0x12, 0x00, 0x81, 0x11, 0x00, 0x81, 0x10,
+    0x00, 0xa5, 0x0f, 0x00, 0x41, 0x0d, 0x00, 0x04, 0x00, 0x42, 0x0c, 0x00,
+    0x13, 0x00, 0x15, 0x00, 0x81, 0x13, 0x00, 0x41, 0x12, 0x00, 0x11, 0x00,
+    0x81, 0x10, 0x00, 0xa6, 0x0f, 0x00, 0x41, 0x0d, 0x00, 0x04, 0x00, 0x40,
+    0x0f, 0x00, 0x82, 0x13, 0x00, 0x40, 0x12, 0x00, 0x81, 0x11, 0x00, 0x40,
+    0x10, 0x00, 0xa7, 0x0f, 0x00, 0x41, 0x0d, 0x00, 0x0a, 0x00, 0x41, 0x11,
+    0x00, 0x12, 0x00, 0x81, 0x13, 0x00, 0x41, 0x12, 0x00, 0x11, 0x00, 0x81,
+    0x10, 0x00, 0xa7, 0x0f, 0x00, 0x41, 0x0d, 0x00, 0x0a, 0x00, 0x81, 0x11,
+    0x00, 0x41, 0x13, 0x00, 0x12, 0x00, 0x81, 0x11, 0x00, 0x40, 0x10, 0x00,
+    0xa8, 0x0f, 0x00, 0x41, 0x0d, 0x00, 0x0c, 0x00, 0x81, 0x11, 0x00, 0x81,
+    0x12, 0x00, 0x40, 0x11, 0x00, 0x81, 0x10, 0x00, 0xa8, 0x0f, 0x00, 0x41,
+    0x0d, 0x00, 0x0a, 0x00, 0x81, 0x11, 0x00, 0x40, 0x12, 0x00, 0x81, 0x11,
+    0x00, 0x81, 0x10, 0x00, 0xa8, 0x0f, 0x00, 0x41, 0x0d, 0x00, 0x0a, 0x00,
+    0x81, 0x11, 0x00, 0x40, 0x12, 0x00, 0x81, 0x11, 0x00, 0x40, 0x10, 0x00,
+    0xa9, 0x0f, 0x00, 0x41, 0x0c, 0x00, 0x0a, 0x00, 0x81, 0x11, 0x00, 0x41,
+    0x12, 0x00, 0x11, 0x00, 0x81, 0x10, 0x00, 0xa9, 0x0f, 0x00, 0x41, 0x0c,
+    0x00, 0x0a, 0x00, 0x81, 0x11, 0x00, 0x41, 0x12, 0x00, 0x11, 0x00, 0x81,
+    0x10, 0x00, 0xa9, 0x0f, 0x00, 0x41, 0x0c, 0x00, 0x0a, 0x00, 0x81, 0x11,
+    0x00, 0x41, 0x12, 0x00, 0x11, 0x00, 0x81, 0x10, 0x00, 0xa9, 0x0f, 0x00,
+    0x41, 0x0c, 0x00, 0x0a, 0x00, 0x81, 0x11, 0x00, 0x41, 0x12, 0x00, 0x11,
+    0x00, 0x81, 0x10, 0x00, 0xa9, 0x0f, 0x00, 0x41, 0x0c, 0x00, 0x0a, 0x00,
+    0x81, 0x11, 0x00, 0x41, 0x12, 0x00, 0x11, 0x00, 0x81, 0x10, 0x00, 0xa9,
+    0x0f, 0x00, 0x41, 0x0c, 0x00, 0x0a, 0x00, 0x81, 0x11, 0x00, 0x41, 0x12,
+    0x00, 0x11, 0x00, 0x81, 0x10, 0x00, 0xa9, 0x0f, 0x00, 0x41, 0x0c, 0x00,
+    0x0a, 0x00, 0x81, 0x11, 0x00, 0x41, 0x12, 0x00, 0x11, 0x00, 0x81, 0x10,
+    0x00, 0xa9, 0x0f, 0x00, 0x41, 0x0c, 0x00, 0x0a, 0x00, 0x81, 0x11, 0x00,
+    0x41, 0x12, 0x00, 0x11, 0x00, 0x81, 0x10, 0x00, 0xa9, 0x0f, 0x00, 0x41,
+    0x0c, 0x00, 0x0a, 0x00, 0x81, 0x11, 0x00, 0x41, 0x12, 0x00, 0x11, 0x00,
+    0x81, 0x10, 0x00, 0xa9, 0x0f, 0x00, 0x41, 0x0c, 0x00, 0x0a, 0x00, 0x81,
+    0x11, 0x00, 0x41, 0x12, 0x00, 0x11, 0x00, 0x81, 0x10, 0x00, 0xa9, 0x0f,
+    0x00, 0x41, 0x0c, 0x00, 0x0a, 0x00, 0x81, 0x11, 0x00, 0x41, 0x12, 0x00,
+    0x11, 0x00, 0x81, 0x10, 0x00, 0xa9, 0x0f, 0x00, 0x41, 0x0c, 0x00, 0x0a,
+    0x00, 0x81, 0x11, 0x00, 0x41, 0x12, 0x00, 0x11, 0x00, 0x81, 0x10, 0x00,
+    0xa9, 0x0f, 0x00, 0x41, 0x0c, 0x00, 0x0a, 0x00, 0x81, 0x11, 0x00, 0x41,
+    0x12, 0x00, 0x11, 0x00, 0x81, 0x10, 0x00, 0xa9, 0x0f, 0x00, 0x41, 0x0c,
+    0x00, 0x0a, 0x00, 0x81, 0x11, 0x00, 0x41, 0x12, 0x00, 0x11, 0x00, 0x81,
+    0x10, 0x00, 0xa9, 0x0f, 0x00, 0x41, 0x0c, 0x00, 0x0a, 0x00, 0x81, 0x11,
+    0x00, 0x41, 0x12, 0x00, 0x11, 0x00, 0x81, 0x10, 0x00, 0xa9, 0x0f, 0x00,
+    0x41, 0x0c, 0x00, 0x0a, 0x00, 0x81, 0x11, 0x00, 0x41, 0x12, 0x00, 0x11,
+    0x00, 0x81, 0x10, 0x00, 0xa9, 0x0f, 0x00, 0x41, 0x0c, 0x00, 0x0a, 0x00,
+    0x81, 0x11, 0x00, 0x41, 0x12, 0x00, 0x11, 0x00, 0x81, 0x10, 0x00, 0xa8,
+    0x0f, 0x00, 0x42, 0x0d, 0x00, 0x0c, 0x00, 0x0a, 0x00, 0x83, 0x11, 0x00,
+    0x81, 0x10, 0x00, 0xa8, 0x0f, 0x00, 0x42, 0x0d, 0x00, 0x0c, 0x00, 0x0a,
+    0x00, 0x40, 0x10, 0x00, 0x82, 0x11, 0x00, 0x81, 0x10, 0x00, 0xa8, 0x0f,
+    0x00, 0x42, 0x0d, 0x00, 0x0c, 0x00, 0x0a, 0x00, 0x42, 0x0d, 0x00, 0x10,
+    0x00, 0x11, 0x00, 0x83, 0x10, 0x00, 0xa7, 0x0f, 0x00, 0x42, 0x0d, 0x00,
+    0x0c, 0x00, 0x0a, 0x00, 0x40, 0x0a, 0x00, 0x84, 0x10, 0x00, 0xa7, 0x0f,
+    0x00, 0x43, 0x0d, 0x00, 0x0c, 0x00, 0x0a, 0x00, 0x04, 0x00, 0x42, 0x04,
+    0x00, 0x10, 0x00, 0x0f, 0x00, 0x82, 0x10, 0x00, 0xa7, 0x0f, 0x00, 0x43,
+    0x0d, 0x00, 0x0c, 0x00, 0x0a, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x81,
+    0x0d, 0x00, 0x81, 0x10, 0x00, 0x41, 0x0f, 0x00, 0x10, 0x00, 0xa5, 0x0f,
+    0x00, 0x40, 0x0d, 0x00, 0x81, 0x0c, 0x00, 0x41, 0x0a, 0x00, 0x00, 0x00,
+    0x42, 0x00, 0x00, 0x0a, 0x00, 0x0d, 0x00, 0xa9, 0x0f, 0x00, 0x44, 0x0d,
+    0x00, 0x0c, 0x00, 0x0a, 0x00, 0x04, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00,
+    0x81, 0x0d, 0x00, 0xa7, 0x0f, 0x00, 0x40, 0x0d, 0x00, 0x81, 0x0c, 0x00,
+    0x40, 0x0a, 0x00, 0x81, 0x00, 0x00, 0x81, 0x00, 0x00, 0x42, 0x04, 0x00,
+    0x0c, 0x00, 0x0d, 0x00, 0xa5, 0x0f, 0x00, 0x40, 0x0d, 0x00, 0x81, 0x0c,
+    0x00, 0x41, 0x0a, 0x00, 0x04, 0x00, 0x81, 0x00, 0x00, 0x82, 0x00, 0x00,
+    0x41, 0x04, 0x00, 0x0c, 0x00, 0x81, 0x0d, 0x00, 0xa1, 0x0f, 0x00, 0x81,
+    0x0d, 0x00, 0x81, 0x0c, 0x00, 0x41, 0x0a, 0x00, 0x04, 0x00, 0x82, 0x00,
+    0x00, 0x83, 0x00, 0x00, 0x41, 0x04, 0x00, 0x0a, 0x00, 0x82, 0x0d, 0x00,
+    0x9e, 0x0f, 0x00, 0x81, 0x0d, 0x00, 0x81, 0x0c, 0x00, 0x41, 0x0a, 0x00,
+    0x04, 0x00, 0x83, 0x00, 0x00, 0x84, 0x00, 0x00, 0x42, 0x04, 0x00, 0x0a,
+    0x00, 0x0c, 0x00, 0x83, 0x0d, 0x00, 0x98, 0x0f, 0x00, 0x82, 0x0d, 0x00,
+    0x81, 0x0c, 0x00, 0x81, 0x0a, 0x00, 0x40, 0x04, 0x00, 0x84, 0x00, 0x00,
+    0x85, 0x00, 0x00, 0x41, 0x04, 0x00, 0x0a, 0x00, 0x82, 0x0c, 0x00, 0x99,
+    0x0d, 0x00, 0x82, 0x0c, 0x00, 0x82, 0x0a, 0x00, 0x40, 0x04, 0x00, 0x85,
+    0x00, 0x00, 0x87, 0x00, 0x00, 0x40, 0x04, 0x00, 0x81, 0x0a, 0x00, 0x99,
+    0x0c, 0x00, 0x83, 0x0a, 0x00, 0x40, 0x04, 0x00, 0x87, 0x00, 0x00, 0x8a,
+    0x00, 0x00, 0x81, 0x04, 0x00, 0x97, 0x0a, 0x00, 0x81, 0x04, 0x00, 0x8a,
+    0x00, 0x00,
+};
+
+//
+// ../images.c:g_pucBlue50x50Press: 50x50 sprite, 1178 bytes, 99.0 dB.
+//
+const uint8_t g_pui8ButtonPressSprite[] =
+{
+    0x51, 0x32, 0x00, 0x32, 0x00, 0x8a, 0x00, 0x00, 0x81, 0x04, 0x00, 0x97,
+    0x0a, 0x00, 0x81, 0x04, 0x00, 0x8a, 0x00, 0x00, 0x87, 0x00, 0x00, 0x40,
+    0x04, 0x00, 0x83, 0x0a, 0x00, 0x99, 0x0c, 0x00, 0x81, 0x0a, 0x00, 0x40,
+    0x04, 0x00, 0x87, 0x00, 0x00, 0x85, 0x00, 0x00, 0x40, 0x04, 0x00, 0x82,
+    0x0a, 0x00, 0x82, 0x0c, 0x00, 0x99, 0x0d, 0x00, 0x82, 0x0c, 0x00, 0x41,
+    0x0a, 0x00, 0x04, 0x00, 0x85, 0x00, 0x00, 0x84, 0x00, 0x00, 0x40, 0x04,
+    0x00, 0x81, 0x0a, 0x00, 0x81, 0x0c, 0x00, 0x82, 0x0d, 0x00, 0x98, 0x0f,
+    0x00, 0x83, 0x0d, 0x00, 0x42, 0x0c, 0x00, 0x0a, 0x00, 0x04, 0x00, 0x84,
+    0x00, 0x00, 0x83, 0x00, 0x00, 0x41, 0x04, 0x00, 0x0a, 0x00, 0x81, 0x0c,
+    0x00, 0x81, 0x0d, 0x00, 0x9e, 0x0f, 0x00, 0x82, 0x0d, 0x00, 0x41, 0x0a,
+    0x00, 0x04, 0x00, 0x83, 0x00, 0x00, 0x82, 0x00, 0x00, 0x41, 0x04, 0x00,
+    0x0a, 0x00, 0x81, 0x0c, 0x00, 0x81, 0x0d, 0x00, 0xa1, 0x0f, 0x00, 0x81,
+    0x0d, 0x00, 0x41, 0x0c, 0x00, 0x04, 0x00, 0x82, 0x00, 0x00, 0x81, 0x00,
+    0x00, 0x41, 0x04, 0x00, 0x0a, 0x00, 0x81, 0x0c, 0x00, 0x40, 0x0d, 0x00,
+    0xa5, 0x0f, 0x00, 0x42, 0x0d, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x81, 0x00,
+    0x00, 0x81, 0x00, 0x00, 0x40, 0x0a, 0x00, 0x81, 0x0c, 0x00, 0x40, 0x0d,
+    0x00, 0xa7, 0x0f, 0x00, 0x81, 0x0d, 0x00, 0x81, 0x00, 0x00, 0x44, 0x00,
+    0x00, 0x04, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0xa9, 0x0f, 0x00,
+    0x42, 0x0d, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x0a, 0x00,
+    0x81, 0x0c, 0x00, 0x40, 0x0d, 0x00, 0xa5, 0x0f, 0x00, 0x41, 0x10, 0x00,
+    0x0f, 0x00, 0x81, 0x10, 0x00, 0x81, 0x0d, 0x00, 0x40, 0x00, 0x00, 0x43,
+    0x04, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0xa7, 0x0f, 0x00, 0x82,
+    0x10, 0x00, 0x42, 0x0f, 0x00, 0x10, 0x00, 0x04, 0x00, 0x43, 0x04, 0x00,
+    0x0a, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0xa7, 0x0f, 0x00, 0x84, 0x10, 0x00,
+    0x40, 0x0a, 0x00, 0x42, 0x0a, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0xa7, 0x0f,
+    0x00, 0x83, 0x10, 0x00, 0x42, 0x11, 0x00, 0x10, 0x00, 0x0d, 0x00, 0x42,
+    0x0a, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0xa8, 0x0f, 0x00, 0x81, 0x10, 0x00,
+    0x82, 0x11, 0x00, 0x40, 0x10, 0x00, 0x42, 0x0a, 0x00, 0x0c, 0x00, 0x0d,
+    0x00, 0xa8, 0x0f, 0x00, 0x81, 0x10, 0x00, 0x83, 0x11, 0x00, 0x42, 0x0a,
+    0x00, 0x0c, 0x00, 0x0d, 0x00, 0xa8, 0x0f, 0x00, 0x81, 0x10, 0x00, 0x41,
+    0x11, 0x00, 0x12, 0x00, 0x81, 0x11, 0x00, 0x41, 0x0a, 0x00, 0x0c, 0x00,
+    0xa9, 0x0f, 0x00, 0x81, 0x10, 0x00, 0x41, 0x11, 0x00, 0x12, 0x00, 0x81,
+    0x11, 0x00, 0x41, 0x0a, 0x00, 0x0c, 0x00, 0xa9, 0x0f, 0x00, 0x81, 0x10,
+    0x00, 0x41, 0x11, 0x00, 0x12, 0x00, 0x81, 0x11, 0x00, 0x41, 0x0a, 0x00,
+    0x0c, 0x00, 0xa9, 0x0f, 0x00, 0x81, 0x10, 0x00, 0x41, 0x11, 0x00, 0x12,
+    0x00, 0x81, 0x11, 0x00, 0x41, 0x0a, 0x00, 0x0c, 0x00, 0xa9, 0x0f, 0x00,
+    0x81, 0x10, 0x00, 0x41, 0x11, 0x00, 0x12, 0x00, 0x81, 0x11, 0x00, 0x41,
+    0x0a, 0x00, 0x0c, 0x00, 0xa9, 0x0f, 0x00, 0x81, 0x10, 0x00, 0x41, 0x11,
+    0x00, 0x12, 0x00, 0x81, 0x11, 0x00, 0x41, 0x0a, 0x00, 0x0c, 0x00, 0xa9,
+    0x0f, 0x00, 0x81, 0x10, 0x00, 0x41, 0x11, 0x00, 0x12, 0x00, 0x81, 0x11,
+    0x00, 0x41, 0x0a, 0x00, 0x0c, 0x00, 0xa9, 0x0f, 0x00, 0x81, 0x10, 0x00,
+    0x41, 0x11, 0x00, 0x12, 0x00, 0x81, 0x11, 0x00, 0x41, 0x0a, 0x00, 0x0c,
+    0x00, 0xa9, 0x0f, 0x00, 0x81, 0x10, 0x00, 0x41, 0x11, 0x00, 0x12, 0x00,
+    0x81, 0x11, 0x00, 0x41, 0x0a, 0x00, 0x0c, 0x00, 0xa9, 0x0f, 0x00, 0x81,
+    0x10, 0x00, 0x41, 0x11, 0x00, 0x12, 0x00, 0x81, 0x11, 0x00, 0x41, 0x0a,
+    0x00, 0x0c, 0x00, 0xa9, 0x0f, 0x00, 0x81, 0x10, 0x00, 0x41, 0x11, 0x00,
+    0x12, 0x00, 0x81, 0x11, 0x00, 0x41, 0x0a, 0x00, 0x0c, 0x00, 0xa9, 0x0f,
+    0x00, 0x81, 0x10, 0x00, 0x41, 0x11, 0x00, 0x12, 0x00, 0x81, 0x11, 0x00,
+    0x41, 0x0a, 0x00, 0x0c, 0x00, 0xa9, 0x0f, 0x00, 0x81, 0x10, 0x00, 0x41,
+    0x11, 0x00, 0x12, 0x00, 0x81, 0x11, 0x00, 0x41, 0x0a, 0x00, 0x0c, 0x00,
+    0xa9, 0x0f, 0x00, 0x81, 0x10, 0x00, 0x41, 0x11, 0x00, 0x12, 0x00, 0x81,
+    0x11, 0x00, 0x41, 0x0a, 0x00, 0x0c, 0x00, 0xa9, 0x0f, 0x00, 0x81, 0x10,
+    0x00, 0x41, 0x11, 0x00, 0x12, 0x00, 0x81, 0x11, 0x00, 0x41, 0x0a, 0x00,
+    0x0c, 0x00, 0xa9, 0x0f, 0x00, 0x81, 0x10, 0x00, 0x41, 0x11, 0x00, 0x12,
+    0x00, 0x81, 0x11, 0x00, 0x41, 0x0a, 0x00, 0x0c, 0x00, 0xa9, 0x0f, 0x00,
+    0x81, 0x10, 0x00, 0x41, 0x11, 0x00, 0x12, 0x00, 0x81, 0x11, 0x00, 0x41,
+    0x0a, 0x00, 0x0c, 0x00, 0xa9, 0x0f, 0x00, 0x40, 0x10, 0x00, 0x81, 0x11,
+    0x00, 0x40, 0x12, 0x00, 0x81, 0x11, 0x00, 0x41, 0x0a, 0x00, 0x0d, 0x00,
+    0xa8, 0x0f, 0x00, 0x81, 0x10, 0x00, 0x81, 0x11, 0x00, 0x40, 0x12, 0x00,
+    0x81, 0x11, 0x00, 0x41, 0x0a, 0x00, 0x0d, 0x00, 0xa8, 0x0f, 0x00, 0x81,
+    0x10, 0x00, 0x40, 0x11, 0x00, 0x81, 0x12, 0x00, 0x81, 0x11, 0x00, 0x41,
+    0x0c, 0x00, 0x0d, 0x00, 0xa8, 0x0f, 0x00, 0x40, 0x10, 0x00, 0x81, 0x11,
+    0x00, 0x41, 0x12, 0x00, 0x13, 0x00, 0x81, 0x11, 0x00, 0x41, 0x0a, 0x00,
+    0x0d, 0x00, 0xa7, 0x0f, 0x00, 0x81, 0x10, 0x00, 0x41, 0x11, 0x00, 0x12,
+    0x00, 0x81, 0x13, 0x00, 0x41, 0x12, 0x00, 0x11, 0x00, 0x41, 0x0a, 0x00,
+    0x0d, 0x00, 0xa7, 0x0f, 0x00, 0x40, 0x10, 0x00, 0x81, 0x11, 0x00, 0x40,
+    0x12, 0x00, 0x82, 0x13, 0x00, 0x40, 0x0f, 0x00, 0x41, 0x04, 0x00, 0x0d,
+    0x00, 0xa6, 0x0f, 0x00, 0x81, 0x10, 0x00, 0x41, 0x11, 0x00, 0x12, 0x00,
+    0x81, 0x13, 0x00, 0x42, 0x15, 0x00, 0x13, 0x00, 0x0c, 0x00, 0x41, 0x04,
+    0x00, 0x0d, 0x00, 0xa5, 0x0f, 0x00, 0x81, 0x10, 0x00, 0x81, 0x11, 0x00,
+    0x40, 0x12, 0x00, 0x81, 0x13, 0x00, 0x42, 0x15, 0x00, 0x13, 0x00, 0x04,
+    0x00, 0x42, 0x00, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x82, 0x0f, 0x00, 0x81,
+    0x10, 0x00, 0x9e, 0x0f, 0x00, 0x81, 0x10, 0x00, 0x81, 0x11, 0x00, 0x40,
+    0x12, 0x00, 0x81, 0x13, 0x00, 0x43, 0x15, 0x00, 0x13, 0x00, 0x12, 0x00,
+    0x00, 0x00, 0x42, 0x00, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x81, 0x0f, 0x00,
+    0x83, 0x10, 0x00, 0x9c, 0x0f, 0x00, 0x81, 0x10, 0x00, 0x81, 0x11, 0x00,
+    0x40, 0x12, 0x00, 0x81, 0x13, 0x00, 0x82, 0x15, 0x00, 0x41, 0x0a, 0x00,
+    0x00, 0x00, 0x81, 0x00, 0x00, 0x40, 0x0c, 0x00, 0x81, 0x0f, 0x00, 0x85,
+    0x10, 0x00, 0x98, 0x0f, 0x00, 0x82, 0x10, 0x00, 0x81, 0x11, 0x00, 0x40,
+    0x12, 0x00, 0x81, 0x13, 0x00, 0x82, 0x15, 0x00, 0x40, 0x13, 0x00, 0x81,
+    0x00, 0x00, 0x81, 0x00, 0x00, 0x42, 0x04, 0x00, 0x0d, 0x00, 0x0f, 0x00,
+    0x88, 0x10, 0x00, 0x92, 0x0f, 0x00, 0x83, 0x10, 0x00, 0x82, 0x11, 0x00,
+    0x40, 0x12, 0x00, 0x81, 0x13, 0x00, 0x83, 0x15, 0x00, 0x40, 0x04, 0x00,
+    0x81, 0x00, 0x00, 0x82, 0x00, 0x00, 0x41, 0x0a, 0x00, 0x0f, 0x00, 0x82,
+    0x10, 0x00, 0x40, 0x11, 0x00, 0x99, 0x10, 0x00, 0x82, 0x11, 0x00, 0x40,
+    0x12, 0x00, 0x82, 0x13, 0x00, 0x83, 0x15, 0x00, 0x40, 0x0c, 0x00, 0x82,
+    0x00, 0x00, 0x83, 0x00, 0x00, 0x42, 0x0a, 0x00, 0x0f, 0x00, 0x10, 0x00,
+    0x9b, 0x11, 0x00, 0x81, 0x12, 0x00, 0x82, 0x13, 0x00, 0x84, 0x15, 0x00,
+    0x40, 0x0c, 0x00, 0x83, 0x00, 0x00, 0x84, 0x00, 0x00, 0x40, 0x0a, 0x00,
+    0x81, 0x10, 0x00, 0x81, 0x11, 0x00, 0x40, 0x12, 0x00, 0x81, 0x11, 0x00,
+    0x93, 0x12, 0x00, 0x84, 0x13, 0x00, 0x85, 0x15, 0x00, 0x40, 0x0c, 0x00,
+    0x84, 0x00, 0x00, 0x85, 0x00, 0x00, 0x41, 0x04, 0x00, 0x10, 0x00, 0x81,
+    0x11, 0x00, 0x81, 0x12, 0x00, 0x96, 0x13, 0x00, 0x86, 0x15, 0x00, 0x41,
+    0x13, 0x00, 0x04, 0x00, 0x85, 0x00, 0x00, 0x87, 0x00, 0x00, 0x41, 0x0a,
+    0x00, 0x10, 0x00, 0x97, 0x13, 0x00, 0x85, 0x15, 0x00, 0x41, 0x13, 0x00,
+    0x0a, 0x00, 0x87, 0x00, 0x00, 0x89, 0x00, 0x00, 0x44, 0x04, 0x00, 0x0c,
+    0x00, 0x0f, 0x00, 0x12, 0x00, 0x13, 0x00, 0x92, 0x15, 0x00, 0x45, 0x13,
+    0x00, 0x15, 0x00, 0x13, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x89,
+    0x00, 0x00,
+};
+
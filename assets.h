@@ -0,0 +1,22 @@
+//*****************************************************************************
+//
+// assets.h - Prototypes for the images of the application.
+//
+// Generated by tools/assets.py; do not edit.
+//
+//*****************************************************************************
+
+#ifndef __ASSETS_H__
+#define __ASSETS_H__
+
+//*****************************************************************************
+//
+// The images, to be drawn with AssetDraw().
+//
+//*****************************************************************************
+extern const uint8_t g_pui_Flower_Image[];
+extern const uint8_t g_pui_Lightning_Image[];
+extern const uint8_t g_pui8ButtonSprite[];
+extern const uint8_t g_pui8ButtonPressSprite[];
+
+#endif // __ASSETS_H__
@@ -1,6676 +0,0 @@
-
-#include <stdint.h>
-#include <stdbool.h>
-#include "grlib/grlib.h"
-
-
-
-
-const uint8_t g_pui_Blue_Moon_Image[] =
-{
-    IMAGE_FMT_8BPP_UNCOMP,
-//    64, 1,
-//    240, 0,
-
-    64, 1,
-    216, 0,
-
-    255,
-    0x00, 0x02, 0x00,
-    0x08, 0x05, 0x00,
-    0x08, 0x02, 0x06,
-    0x0c, 0x08, 0x02,
-    0x14, 0x0d, 0x02,
-    0x0f, 0x0d, 0x06,
-    0x17, 0x10, 0x07,
-    0x1d, 0x12, 0x06,
-    0x14, 0x12, 0x0c,
-    0x23, 0x15, 0x04,
-    0x19, 0x12, 0x11,
-    0x1a, 0x14, 0x0d,
-    0x20, 0x16, 0x0b,
-    0x26, 0x16, 0x0c,
-    0x1d, 0x19, 0x0a,
-    0x23, 0x1a, 0x07,
-    0x27, 0x19, 0x09,
-    0x1e, 0x18, 0x11,
-    0x23, 0x19, 0x0e,
-    0x27, 0x1e, 0x0b,
-    0x2b, 0x1d, 0x0d,
-    0x26, 0x1c, 0x12,
-    0x23, 0x1f, 0x11,
-    0x33, 0x20, 0x0b,
-    0x30, 0x23, 0x0a,
-    0x2e, 0x1e, 0x16,
-    0x2b, 0x22, 0x10,
-    0x30, 0x21, 0x12,
-    0x2b, 0x21, 0x16,
-    0x34, 0x27, 0x0f,
-    0x39, 0x26, 0x11,
-    0x2f, 0x26, 0x15,
-    0x34, 0x25, 0x16,
-    0x2f, 0x25, 0x1a,
-    0x41, 0x29, 0x0e,
-    0x39, 0x2b, 0x14,
-    0x3d, 0x2a, 0x15,
-    0x38, 0x29, 0x1a,
-    0x34, 0x2b, 0x19,
-    0x3c, 0x2e, 0x17,
-    0x47, 0x2f, 0x14,
-    0x43, 0x31, 0x13,
-    0x42, 0x2e, 0x1a,
-    0x3c, 0x2d, 0x1f,
-    0x38, 0x2f, 0x1d,
-    0x3f, 0x31, 0x1a,
-    0x50, 0x33, 0x10,
-    0x50, 0x31, 0x16,
-    0x43, 0x36, 0x16,
-    0x48, 0x35, 0x18,
-    0x37, 0x32, 0x25,
-    0x4c, 0x34, 0x1a,
-    0x3e, 0x34, 0x21,
-    0x47, 0x33, 0x20,
-    0x43, 0x35, 0x1e,
-    0x33, 0x33, 0x28,
-    0x42, 0x33, 0x24,
-    0x5f, 0x36, 0x1a,
-    0x56, 0x39, 0x18,
-    0x48, 0x3b, 0x1b,
-    0x5e, 0x3c, 0x11,
-    0x4d, 0x3a, 0x1e,
-    0x48, 0x39, 0x23,
-    0x52, 0x39, 0x20,
-    0x5e, 0x3a, 0x1b,
-    0x43, 0x39, 0x27,
-    0x54, 0x3d, 0x19,
-    0x51, 0x3f, 0x19,
-    0x45, 0x3d, 0x23,
-    0x3f, 0x3a, 0x2c,
-    0x5b, 0x3d, 0x1d,
-    0x4c, 0x3f, 0x20,
-    0x41, 0x39, 0x30,
-    0x51, 0x3e, 0x22,
-    0x42, 0x3e, 0x29,
-    0x4c, 0x3e, 0x28,
-    0x52, 0x3d, 0x2a,
-    0x64, 0x42, 0x1b,
-    0x56, 0x44, 0x1f,
-    0x5f, 0x41, 0x22,
-    0x5b, 0x43, 0x21,
-    0x51, 0x44, 0x25,
-    0x6d, 0x44, 0x1b,
-    0x63, 0x46, 0x1c,
-    0x56, 0x43, 0x27,
-    0x50, 0x42, 0x2c,
-    0x56, 0x41, 0x2e,
-    0x4d, 0x44, 0x2f,
-    0x6a, 0x47, 0x20,
-    0x5b, 0x49, 0x24,
-    0x64, 0x46, 0x28,
-    0x60, 0x48, 0x26,
-    0x56, 0x48, 0x2a,
-    0x4a, 0x44, 0x38,
-    0x5b, 0x47, 0x2c,
-    0x56, 0x47, 0x31,
-    0x7b, 0x4c, 0x1d,
-    0x60, 0x4d, 0x29,
-    0x76, 0x4e, 0x20,
-    0x72, 0x50, 0x1e,
-    0x65, 0x4c, 0x2b,
-    0x5a, 0x4d, 0x2f,
-    0x70, 0x4d, 0x27,
-    0x6b, 0x4e, 0x27,
-    0x68, 0x50, 0x25,
-    0x61, 0x4d, 0x32,
-    0x64, 0x51, 0x2d,
-    0x57, 0x4e, 0x38,
-    0x69, 0x50, 0x30,
-    0x52, 0x4d, 0x3f,
-    0x5f, 0x51, 0x33,
-    0x6d, 0x55, 0x2b,
-    0x78, 0x55, 0x2a,
-    0x68, 0x55, 0x32,
-    0x80, 0x56, 0x28,
-    0x73, 0x56, 0x2e,
-    0x64, 0x56, 0x38,
-    0x70, 0x59, 0x2e,
-    0x6f, 0x56, 0x36,
-    0x6b, 0x58, 0x35,
-    0x7a, 0x5d, 0x2c,
-    0x61, 0x57, 0x42,
-    0x74, 0x5c, 0x32,
-    0x7f, 0x5c, 0x2e,
-    0x5c, 0x56, 0x49,
-    0x79, 0x5b, 0x35,
-    0x6f, 0x5c, 0x38,
-    0x6a, 0x5c, 0x3d,
-    0x7a, 0x63, 0x2f,
-    0x7f, 0x62, 0x32,
-    0x8c, 0x63, 0x2e,
-    0x7a, 0x62, 0x38,
-    0x79, 0x5f, 0x3f,
-    0x74, 0x61, 0x3d,
-    0x7f, 0x61, 0x3b,
-    0x86, 0x63, 0x35,
-    0x6f, 0x61, 0x42,
-    0x7f, 0x68, 0x35,
-    0x84, 0x67, 0x37,
-    0x6c, 0x62, 0x4c,
-    0x7f, 0x67, 0x3e,
-    0x79, 0x67, 0x43,
-    0x67, 0x62, 0x54,
-    0x8a, 0x6c, 0x3d,
-    0x85, 0x6e, 0x3b,
-    0x82, 0x68, 0x49,
-    0x89, 0x6a, 0x45,
-    0x98, 0x6e, 0x38,
-    0x85, 0x6c, 0x43,
-    0x8e, 0x71, 0x37,
-    0x92, 0x6f, 0x3b,
-    0x7f, 0x6c, 0x48,
-    0x82, 0x70, 0x44,
-    0x7c, 0x6e, 0x4f,
-    0x8a, 0x73, 0x41,
-    0x8f, 0x72, 0x43,
-    0x8a, 0x71, 0x49,
-    0x85, 0x71, 0x4e,
-    0x95, 0x79, 0x40,
-    0x9f, 0x76, 0x45,
-    0x7b, 0x72, 0x5b,
-    0x95, 0x77, 0x48,
-    0x90, 0x79, 0x46,
-    0x9e, 0x7c, 0x3b,
-    0x9c, 0x79, 0x43,
-    0x8f, 0x77, 0x4e,
-    0x8c, 0x7a, 0x4e,
-    0x8b, 0x78, 0x54,
-    0x9a, 0x7e, 0x45,
-    0x95, 0x7d, 0x4b,
-    0x88, 0x79, 0x5a,
-    0x9a, 0x7c, 0x4e,
-    0x95, 0x7c, 0x53,
-    0xa6, 0x83, 0x43,
-    0xa5, 0x81, 0x4c,
-    0xa0, 0x83, 0x4b,
-    0xa0, 0x81, 0x53,
-    0x9b, 0x83, 0x51,
-    0x95, 0x82, 0x58,
-    0x9a, 0x81, 0x59,
-    0xac, 0x89, 0x4b,
-    0xa6, 0x89, 0x52,
-    0x91, 0x84, 0x67,
-    0xa1, 0x89, 0x58,
-    0x9c, 0x88, 0x5e,
-    0xb6, 0x94, 0x49,
-    0xac, 0x8f, 0x57,
-    0xa6, 0x8e, 0x5d,
-    0xb4, 0x8e, 0x58,
-    0xb5, 0x92, 0x53,
-    0xa3, 0x90, 0x66,
-    0xb1, 0x94, 0x5c,
-    0x9c, 0x8e, 0x71,
-    0xac, 0x94, 0x62,
-    0xbd, 0x99, 0x5b,
-    0xc0, 0x9d, 0x53,
-    0xb7, 0x99, 0x61,
-    0xbd, 0x98, 0x64,
-    0xb1, 0x99, 0x67,
-    0xc2, 0x9f, 0x61,
-    0xaf, 0x9b, 0x71,
-    0xbd, 0x9f, 0x66,
-    0xa7, 0x99, 0x7c,
-    0xb7, 0x9f, 0x6c,
-    0xc9, 0xa5, 0x68,
-    0xc1, 0xa1, 0x74,
-    0xcc, 0xa9, 0x61,
-    0xc5, 0xa8, 0x67,
-    0xc4, 0xa6, 0x6f,
-    0xbe, 0xa6, 0x74,
-    0xb9, 0xa5, 0x7b,
-    0xb2, 0xa4, 0x85,
-    0xa8, 0xa2, 0x92,
-    0xd2, 0xb0, 0x6a,
-    0xcd, 0xb0, 0x6f,
-    0xcd, 0xae, 0x77,
-    0xc7, 0xae, 0x7b,
-    0xc1, 0xae, 0x83,
-    0xd4, 0xb6, 0x77,
-    0xbf, 0xb0, 0x8e,
-    0xb7, 0xae, 0x96,
-    0xce, 0xb5, 0x82,
-    0xc0, 0xae, 0x97,
-    0xc8, 0xb4, 0x89,
-    0xda, 0xbc, 0x80,
-    0xd6, 0xbf, 0x84,
-    0xd6, 0xbd, 0x8c,
-    0xd0, 0xbc, 0x91,
-    0xcb, 0xbb, 0x9a,
-    0xc4, 0xba, 0xa2,
-    0xd9, 0xc4, 0x9a,
-    0xe0, 0xc7, 0x94,
-    0xd3, 0xc4, 0xa3,
-    0xd1, 0xc6, 0xac,
-    0xdf, 0xcb, 0xa0,
-    0xd9, 0xc9, 0xa9,
-    0xe5, 0xd1, 0xa4,
-    0xd1, 0xcb, 0xbd,
-    0xe0, 0xd0, 0xaf,
-    0xe7, 0xd2, 0xad,
-    0xdd, 0xd2, 0xb7,
-    0xe5, 0xd5, 0xb4,
-    0xec, 0xdb, 0xba,
-    0xe6, 0xdb, 0xbf,
-    0xe7, 0xda, 0xc6,
-    0xe3, 0xdd, 0xcd,
-    0xf1, 0xe5, 0xce,
-    0xea, 0xe4, 0xd3,
-    0xe8, 0xe7, 0xde,
-    0xf0, 0xe9, 0xda,
-    0xf6, 0xef, 0xe1,
-    0xf3, 0xf2, 0xe5,
-    0xec, 0xef, 0xef,
-    0xf4, 0xf2, 0xec,
-    0xfc, 0xfa, 0xf5,
-    0xfb, 0xfe, 0xfc,
-
-    0x22, 0x07, 0x01, 0x01, 0x06, 0x01, 0x01, 0x02, 0x01, 0x0c, 0x01, 0x01,
-    0x28, 0x22, 0x04, 0x01, 0x10, 0x22, 0x09, 0x10, 0x02, 0x01, 0x01, 0x02,
-    0x01, 0x04, 0x05, 0x07, 0x1e, 0x28, 0x17, 0x46, 0x4d, 0x22, 0x10, 0x1b,
-    0x0c, 0x1e, 0x15, 0x06, 0x14, 0x0b, 0x24, 0x33, 0x17, 0x1b, 0x15, 0x13,
-    0x5a, 0x42, 0x66, 0x5a, 0x67, 0x5a, 0x73, 0x73, 0x3f, 0x4c, 0x18, 0x14,
-    0x12, 0x2b, 0x1d, 0x2b, 0x04, 0x06, 0x05, 0x06, 0x0b, 0x0b, 0x05, 0x03,
-    0x05, 0x01, 0x05, 0x15, 0x2d, 0x3e, 0x73, 0x6c, 0x6c, 0x54, 0x86, 0x6c,
-    0x9b, 0x6c, 0x27, 0x5e, 0x1a, 0x27, 0x25, 0x51, 0x36, 0x5e, 0x7a, 0x54,
-    0x0f, 0x01, 0x15, 0x2d, 0x05, 0x06, 0x12, 0x2c, 0x54, 0x5e, 0x55, 0x23,
-    0x54, 0x34, 0x06, 0x03, 0x01, 0x01, 0x15, 0x23, 0x4b, 0x5e, 0x69, 0x1c,
-    0x7e, 0x85, 0x77, 0x4b, 0x11, 0x03, 0x5f, 0x51, 0x3e, 0x2d, 0x5e, 0x1a,
-    0x16, 0x0b, 0x05, 0x05, 0x05, 0x0b, 0x06, 0x05, 0x05, 0x03, 0x05, 0x05,
-    0x4b, 0x65, 0x9c, 0xa1, 0x85, 0x5c, 0x83, 0x5f, 0x51, 0x69, 0x5c, 0x65,
-    0xa2, 0x71, 0x65, 0x85, 0x5c, 0x7e, 0x7e, 0x55, 0x8d, 0x0e, 0x77, 0x94,
-    0x8c, 0x5c, 0x77, 0xa5, 0xa1, 0x7a, 0x8c, 0x69, 0x85, 0x49, 0x5e, 0x5c,
-    0x9c, 0xab, 0x69, 0x94, 0x8f, 0x9a, 0x76, 0xa9, 0xa1, 0x71, 0xa1, 0xa1,
-    0x9b, 0x8c, 0x9c, 0xa1, 0x71, 0x8c, 0x5c, 0x1c, 0x1f, 0x34, 0x26, 0x13,
-    0x1c, 0x1f, 0x06, 0x26, 0x04, 0x16, 0x5e, 0x8a, 0x9b, 0x69, 0x05, 0x04,
-    0x05, 0x36, 0x23, 0x15, 0x15, 0x5e, 0x55, 0x49, 0x27, 0x0b, 0x23, 0x2d,
-    0x36, 0x3e, 0x49, 0x15, 0x03, 0x15, 0x20, 0x3d, 0x54, 0x3d, 0x75, 0x54,
-    0x36, 0x14, 0x36, 0x73, 0x73, 0x5b, 0x0e, 0x15, 0x2d, 0x21, 0x13, 0x0f,
-    0x1d, 0x20, 0x20, 0x14, 0x0b, 0x0b, 0x06, 0x10, 0x15, 0x0c, 0x0b, 0x1c,
-    0x03, 0x06, 0x0b, 0x09, 0x12, 0x1b, 0x15, 0x04, 0x01, 0x01, 0x01, 0x05,
-    0x06, 0x05, 0x01, 0x01, 0x01, 0x0c, 0x13, 0x09, 0x07, 0x03, 0x07, 0x29,
-    0x2e, 0x10, 0x07, 0x1e, 0x1e, 0x07, 0x1b, 0x04, 0x1e, 0x07, 0x01, 0x01,
-    0x03, 0x06, 0x2e, 0x42, 0x09, 0x07, 0x28, 0x2e, 0x2e, 0x22, 0x07, 0x10,
-    0x2e, 0x17, 0x10, 0x17, 0x22, 0x17, 0x07, 0x07, 0x04, 0x01, 0x02, 0x02,
-    0x01, 0x02, 0x02, 0x01, 0x04, 0x19, 0x04, 0x01, 0x22, 0x2e, 0x17, 0x01,
-    0x17, 0x2f, 0x22, 0x24, 0x01, 0x01, 0x01, 0x01, 0x02, 0x07, 0x05, 0x07,
-    0x28, 0x3f, 0x33, 0x28, 0x4f, 0x4d, 0x24, 0x33, 0x10, 0x04, 0x17, 0x1b,
-    0x35, 0x1b, 0x2a, 0x1e, 0x0c, 0x07, 0x14, 0x0c, 0x29, 0x24, 0x67, 0x50,
-    0x42, 0x1e, 0x24, 0x20, 0x31, 0x3d, 0x1d, 0x04, 0x15, 0x67, 0x50, 0x29,
-    0x1f, 0x0c, 0x06, 0x07, 0x0b, 0x06, 0x05, 0x05, 0x03, 0x01, 0x03, 0x01,
-    0x05, 0x2b, 0x6c, 0x64, 0x64, 0x54, 0x6c, 0x54, 0x92, 0x54, 0x5b, 0x71,
-    0x4b, 0x54, 0x15, 0x54, 0x8f, 0x84, 0x49, 0x12, 0x36, 0x4c, 0x2d, 0x54,
-    0x03, 0x01, 0x01, 0x26, 0x36, 0x21, 0x27, 0x0b, 0x2d, 0x23, 0x08, 0x0b,
-    0x05, 0x05, 0x02, 0x0b, 0x36, 0x69, 0x7e, 0x77, 0x77, 0x85, 0x54, 0x08,
-    0x05, 0x05, 0x15, 0x69, 0x55, 0x36, 0x97, 0x55, 0x4b, 0x54, 0x2c, 0x08,
-    0x05, 0x05, 0x05, 0x1f, 0x54, 0x08, 0x02, 0x03, 0x01, 0x15, 0x85, 0x71,
-    0x4b, 0x77, 0x54, 0x71, 0x7e, 0x6a, 0x6a, 0xa1, 0x9c, 0x83, 0x94, 0x55,
-    0x15, 0x51, 0x97, 0xac, 0xa5, 0x4b, 0x36, 0x61, 0x5c, 0x55, 0x4b, 0x83,
-    0x9c, 0x5f, 0x2d, 0x25, 0x34, 0x8d, 0x76, 0x6a, 0x71, 0x9c, 0x2c, 0xa5,
-    0x9c, 0xa1, 0x94, 0x84, 0x8d, 0x8c, 0x8c, 0xa5, 0xa1, 0xa1, 0x9b, 0x83,
-    0x8c, 0x7e, 0x7e, 0x54, 0x7e, 0x15, 0x0c, 0x5f, 0x1f, 0x34, 0x15, 0x23,
-    0x4b, 0x84, 0x3d, 0x4b, 0x75, 0x3d, 0x08, 0x15, 0x0b, 0x12, 0x11, 0x23,
-    0x15, 0x27, 0x54, 0x54, 0x3d, 0x38, 0x26, 0x25, 0x12, 0x3d, 0x5e, 0x54,
-    0x0f, 0x1f, 0x2b, 0x2d, 0x3d, 0x3d, 0x1a, 0x31, 0x23, 0x31, 0x29, 0x54,
-    0x54, 0x54, 0x23, 0x1c, 0x1f, 0x14, 0x06, 0x0c, 0x23, 0x1b, 0x06, 0x0b,
-    0x07, 0x04, 0x03, 0x35, 0x12, 0x0c, 0x0b, 0x07, 0x04, 0x23, 0x23, 0x50,
-    0x14, 0x1c, 0x14, 0x06, 0x05, 0x01, 0x01, 0x03, 0x01, 0x03, 0x01, 0x05,
-    0x03, 0x15, 0x10, 0x14, 0x06, 0x06, 0x0c, 0x01, 0x0c, 0x2a, 0x14, 0x1b,
-    0x1b, 0x15, 0x0c, 0x07, 0x14, 0x05, 0x01, 0x01, 0x04, 0x07, 0x33, 0x17,
-    0x10, 0x0d, 0x17, 0x28, 0x28, 0x17, 0x28, 0x22, 0x17, 0x14, 0x10, 0x14,
-    0x09, 0x17, 0x07, 0x22, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x01,
-    0x04, 0x07, 0x01, 0x01, 0x17, 0x2e, 0x1e, 0x04, 0x2e, 0x3a, 0x3a, 0x3a,
-    0x22, 0x04, 0x0b, 0x01, 0x01, 0x10, 0x07, 0x10, 0x33, 0x24, 0x3a, 0x3a,
-    0x28, 0x28, 0x1e, 0x1b, 0x12, 0x04, 0x24, 0x1e, 0x1e, 0x17, 0x33, 0x33,
-    0x29, 0x15, 0x14, 0x14, 0x53, 0x3f, 0x20, 0x3f, 0x67, 0x50, 0x3f, 0x73,
-    0x73, 0x50, 0x20, 0x0c, 0x10, 0x73, 0x5b, 0x20, 0x15, 0x04, 0x05, 0x0b,
-    0x0c, 0x21, 0x04, 0x05, 0x03, 0x02, 0x01, 0x01, 0x03, 0x2c, 0x54, 0x61,
-    0x54, 0x6f, 0x8f, 0x78, 0x76, 0x54, 0x76, 0x3e, 0x26, 0x21, 0x3e, 0x47,
-    0x76, 0x8f, 0x36, 0x15, 0x69, 0x31, 0x61, 0x49, 0x1f, 0x01, 0x02, 0x01,
-    0x20, 0x36, 0x0b, 0x0b, 0x06, 0x02, 0x01, 0x4b, 0x54, 0x16, 0x05, 0x03,
-    0x16, 0x55, 0x71, 0x94, 0x7e, 0x9b, 0x5c, 0x01, 0x04, 0x36, 0x4b, 0x2c,
-    0x3e, 0x55, 0x1f, 0x23, 0x5f, 0x4b, 0x5f, 0x21, 0x05, 0x01, 0x1a, 0x26,
-    0x27, 0x34, 0x05, 0x03, 0x03, 0x08, 0x3e, 0x27, 0x55, 0x77, 0x77, 0x71,
-    0x61, 0x61, 0x94, 0x9c, 0x7e, 0x94, 0xa2, 0x4b, 0x08, 0x5c, 0x94, 0xa8,
-    0x9c, 0x5c, 0x0b, 0x13, 0x0c, 0x1f, 0x11, 0x2c, 0x36, 0x4b, 0x27, 0x5c,
-    0xa9, 0xb0, 0x7a, 0xa2, 0x8c, 0x54, 0x5c, 0x9c, 0x9c, 0xab, 0xab, 0x7a,
-    0x77, 0x8c, 0x71, 0x94, 0xa1, 0xa1, 0x9b, 0x9c, 0x9c, 0x69, 0x3e, 0x3e,
-    0x69, 0x51, 0x1c, 0x11, 0x2c, 0x1c, 0x1f, 0x4b, 0x2d, 0x3e, 0x54, 0x23,
-    0x5e, 0x69, 0x26, 0x5e, 0x11, 0x11, 0x1c, 0x4b, 0x5e, 0x21, 0x4b, 0x54,
-    0x49, 0x1f, 0x1c, 0x23, 0x15, 0x06, 0x54, 0x3d, 0x64, 0x49, 0x3e, 0x5e,
-    0x3d, 0x3e, 0x23, 0x3e, 0x36, 0x1d, 0x54, 0x54, 0x35, 0x49, 0x49, 0x25,
-    0x3d, 0x38, 0x13, 0x12, 0x0b, 0x0c, 0x05, 0x05, 0x04, 0x06, 0x0c, 0x12,
-    0x13, 0x23, 0x14, 0x20, 0x04, 0x20, 0x27, 0x10, 0x01, 0x04, 0x06, 0x05,
-    0x01, 0x03, 0x04, 0x01, 0x01, 0x0c, 0x05, 0x03, 0x02, 0x01, 0x04, 0x06,
-    0x15, 0x07, 0x0c, 0x01, 0x07, 0x28, 0x46, 0x1b, 0x04, 0x04, 0x09, 0x07,
-    0x06, 0x24, 0x07, 0x01, 0x04, 0x07, 0x14, 0x10, 0x14, 0x07, 0x14, 0x17,
-    0x22, 0x10, 0x10, 0x09, 0x07, 0x07, 0x07, 0x09, 0x09, 0x07, 0x06, 0x22,
-    0x01, 0x01, 0x02, 0x01, 0x07, 0x06, 0x01, 0x01, 0x10, 0x09, 0x01, 0x0d,
-    0x14, 0x14, 0x17, 0x17, 0x46, 0x3c, 0x3c, 0x4d, 0x3c, 0x17, 0x33, 0x01,
-    0x01, 0x06, 0x0c, 0x14, 0x17, 0x3a, 0x46, 0x4d, 0x46, 0x1e, 0x03, 0x14,
-    0x14, 0x04, 0x03, 0x24, 0x62, 0x46, 0x20, 0x1e, 0x2a, 0x10, 0x13, 0x1e,
-    0x14, 0x24, 0x1a, 0x2a, 0x33, 0x23, 0x73, 0x67, 0x53, 0x3d, 0x1c, 0x15,
-    0x12, 0x64, 0x3d, 0x0c, 0x01, 0x04, 0x05, 0x12, 0x0b, 0x04, 0x03, 0x03,
-    0x05, 0x01, 0x05, 0x01, 0x01, 0x11, 0x49, 0x5e, 0x35, 0x86, 0x92, 0x76,
-    0x27, 0x5e, 0x5e, 0x23, 0x0b, 0x49, 0x6c, 0x5e, 0x54, 0x69, 0x20, 0x54,
-    0x2d, 0x35, 0x3e, 0x3e, 0x5e, 0x0b, 0x01, 0x01, 0x27, 0x83, 0x69, 0x0b,
-    0x01, 0x03, 0x01, 0x4b, 0x8d, 0x69, 0x36, 0x0b, 0x65, 0x77, 0x54, 0x8c,
-    0x94, 0x8c, 0x7e, 0x1c, 0x15, 0x77, 0xab, 0x69, 0x3e, 0x4b, 0x55, 0x2c,
-    0x1f, 0x3e, 0x0e, 0x34, 0x06, 0x0b, 0x34, 0x0b, 0x05, 0x11, 0x0b, 0x05,
-    0x05, 0x03, 0x16, 0x13, 0x55, 0x85, 0x6a, 0x5c, 0x9c, 0x83, 0x8d, 0x83,
-    0x8c, 0x94, 0x94, 0x6a, 0x27, 0x8d, 0x85, 0xa2, 0x9c, 0x83, 0x6a, 0x85,
-    0x26, 0x34, 0x0b, 0x16, 0x36, 0x74, 0x36, 0x55, 0x59, 0x9c, 0x8c, 0xa1,
-    0x9c, 0x4b, 0x6e, 0x77, 0x9c, 0xa5, 0xa1, 0x8d, 0x69, 0x7a, 0x71, 0x69,
-    0x83, 0x83, 0x8c, 0x94, 0x77, 0x61, 0x3e, 0x36, 0x2d, 0x69, 0x4b, 0x16,
-    0x08, 0x0b, 0x21, 0x34, 0x26, 0x2c, 0x4b, 0x4b, 0x26, 0x1c, 0x21, 0x69,
-    0x16, 0x0b, 0x0b, 0x2d, 0x27, 0x2d, 0x26, 0x54, 0x3e, 0x1f, 0x0b, 0x0b,
-    0x1a, 0x01, 0x15, 0x27, 0x64, 0x27, 0x84, 0x61, 0x3d, 0x64, 0x64, 0x6c,
-    0x25, 0x15, 0x31, 0x1b, 0x36, 0x3d, 0x49, 0x25, 0x31, 0x0c, 0x15, 0x0b,
-    0x06, 0x06, 0x1c, 0x06, 0x0c, 0x12, 0x07, 0x15, 0x1a, 0x12, 0x0b, 0x0e,
-    0x1b, 0x1d, 0x06, 0x12, 0x06, 0x18, 0x1d, 0x03, 0x06, 0x20, 0x15, 0x03,
-    0x03, 0x12, 0x23, 0x14, 0x03, 0x02, 0x02, 0x01, 0x05, 0x0c, 0x0c, 0x06,
-    0x0c, 0x0c, 0x2a, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01,
-    0x07, 0x14, 0x14, 0x17, 0x14, 0x10, 0x14, 0x28, 0x17, 0x10, 0x17, 0x09,
-    0x10, 0x09, 0x06, 0x10, 0x04, 0x0c, 0x04, 0x10, 0x01, 0x01, 0x04, 0x09,
-    0x04, 0x09, 0x01, 0x07, 0x2e, 0x28, 0x10, 0x3a, 0x28, 0x03, 0x09, 0x3c,
-    0x3c, 0x4d, 0x3c, 0x4d, 0x3c, 0x2e, 0x3a, 0x04, 0x01, 0x01, 0x10, 0x1b,
-    0x28, 0x3a, 0x2e, 0x3a, 0x3a, 0x2a, 0x01, 0x1e, 0x24, 0x04, 0x03, 0x24,
-    0x53, 0x4f, 0x33, 0x1d, 0x20, 0x12, 0x0e, 0x1e, 0x1b, 0x0c, 0x0f, 0x14,
-    0x3f, 0x29, 0x31, 0x29, 0x50, 0x2a, 0x15, 0x15, 0x13, 0x3d, 0x0b, 0x05,
-    0x0b, 0x15, 0x0b, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x03, 0x05,
-    0x03, 0x05, 0x12, 0x5e, 0x36, 0x5e, 0x76, 0x5e, 0x15, 0x1a, 0x27, 0x5e,
-    0x3e, 0x69, 0x75, 0x75, 0x49, 0x75, 0x54, 0x51, 0x12, 0x23, 0x1f, 0x1c,
-    0x36, 0x11, 0x01, 0x01, 0x0b, 0x83, 0x59, 0x01, 0x01, 0x03, 0x01, 0x3e,
-    0x4b, 0x69, 0x7e, 0x3e, 0x51, 0x3e, 0x27, 0x85, 0x8c, 0x94, 0x77, 0x71,
-    0x3e, 0x0e, 0x77, 0x3e, 0x61, 0x4b, 0x65, 0x3e, 0x69, 0x71, 0x11, 0x26,
-    0x3e, 0x5c, 0x11, 0x03, 0x05, 0x03, 0x13, 0x1f, 0x04, 0x0b, 0x0b, 0x55,
-    0x4b, 0x5c, 0x69, 0x6a, 0x94, 0x83, 0x8d, 0x8c, 0x85, 0x6a, 0x85, 0x83,
-    0x8d, 0x7a, 0x83, 0xa9, 0x98, 0x7e, 0x61, 0x65, 0x77, 0xac, 0x3e, 0x08,
-    0x36, 0x7e, 0x71, 0x65, 0x47, 0x71, 0x69, 0x71, 0x85, 0x61, 0x7e, 0x55,
-    0x69, 0x71, 0x7a, 0x69, 0x36, 0x77, 0x5c, 0x3e, 0x6a, 0x5e, 0x6a, 0x61,
-    0x3e, 0x55, 0x71, 0x5e, 0x55, 0x83, 0x7a, 0x3e, 0x2d, 0x1c, 0x1f, 0x3e,
-    0x26, 0x5f, 0x2c, 0x36, 0x15, 0x03, 0x0b, 0x21, 0x12, 0x08, 0x1f, 0x26,
-    0x1f, 0x2c, 0x26, 0x15, 0x36, 0x2d, 0x1a, 0x03, 0x4b, 0x05, 0x1a, 0x3d,
-    0x27, 0x25, 0x6c, 0x6c, 0x49, 0x54, 0x38, 0x49, 0x64, 0x27, 0x23, 0x1c,
-    0x15, 0x1c, 0x31, 0x36, 0x12, 0x04, 0x11, 0x0b, 0x0b, 0x0b, 0x06, 0x12,
-    0x0c, 0x0b, 0x0c, 0x01, 0x05, 0x15, 0x05, 0x13, 0x25, 0x10, 0x20, 0x12,
-    0x06, 0x13, 0x12, 0x06, 0x12, 0x24, 0x2a, 0x04, 0x04, 0x53, 0x70, 0x29,
-    0x24, 0x12, 0x01, 0x02, 0x05, 0x04, 0x07, 0x06, 0x05, 0x01, 0x05, 0x06,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x10, 0x14, 0x28, 0x17, 0x33,
-    0x14, 0x17, 0x1e, 0x22, 0x10, 0x1e, 0x10, 0x0c, 0x09, 0x07, 0x07, 0x01,
-    0x02, 0x07, 0x04, 0x01, 0x03, 0x04, 0x17, 0x10, 0x04, 0x09, 0x03, 0x17,
-    0x2e, 0x2f, 0x2e, 0x2f, 0x3a, 0x14, 0x04, 0x28, 0x3c, 0x3c, 0x3c, 0x40,
-    0x3a, 0x3c, 0x46, 0x0a, 0x01, 0x10, 0x1b, 0x33, 0x2e, 0x46, 0x46, 0x2e,
-    0x46, 0x29, 0x06, 0x46, 0x3f, 0x04, 0x04, 0x18, 0x24, 0x33, 0x1b, 0x33,
-    0x24, 0x13, 0x0c, 0x14, 0x14, 0x23, 0x20, 0x12, 0x31, 0x29, 0x31, 0x50,
-    0x67, 0x1a, 0x0c, 0x12, 0x13, 0x1b, 0x04, 0x15, 0x6c, 0x15, 0x05, 0x03,
-    0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x03, 0x05, 0x05, 0x05, 0x0e, 0x6c,
-    0x3d, 0x3d, 0x49, 0x3d, 0x3d, 0x36, 0x1d, 0x6c, 0x76, 0x6a, 0x77, 0x8a,
-    0x54, 0x69, 0x55, 0x1c, 0x26, 0x5f, 0x0b, 0x05, 0x1f, 0x01, 0x01, 0x01,
-    0x05, 0x7a, 0x3e, 0x01, 0x11, 0x01, 0x00, 0x3e, 0x4b, 0x65, 0x5e, 0x69,
-    0x1a, 0x01, 0x05, 0x65, 0x8c, 0x77, 0x71, 0x8c, 0x27, 0x05, 0x34, 0x27,
-    0x34, 0x05, 0x65, 0x4b, 0x55, 0x1f, 0x0b, 0x0b, 0x3e, 0x55, 0x1f, 0x6e,
-    0x41, 0x3e, 0x36, 0x4b, 0x1a, 0x3e, 0x3e, 0x69, 0x77, 0x83, 0x4b, 0x2d,
-    0x9c, 0x85, 0x94, 0x8c, 0x7e, 0x77, 0x8c, 0xa2, 0xa5, 0x7e, 0x6a, 0xab,
-    0x9a, 0x6a, 0x6a, 0x71, 0xa9, 0xa2, 0x94, 0x1a, 0x16, 0x83, 0x71, 0x4b,
-    0xa5, 0x8c, 0x8c, 0x59, 0x6a, 0x6a, 0x6a, 0x7e, 0x77, 0x5c, 0x61, 0x77,
-    0x55, 0x65, 0x71, 0x5f, 0x85, 0x34, 0x2d, 0x4b, 0x2c, 0x5e, 0x61, 0x4b,
-    0x36, 0x26, 0x55, 0x54, 0x54, 0x3e, 0x16, 0x55, 0x36, 0x4b, 0x3e, 0x36,
-    0x05, 0x05, 0x0c, 0x1f, 0x05, 0x11, 0x2d, 0x54, 0x2d, 0x36, 0x34, 0x06,
-    0x26, 0x3e, 0x27, 0x2b, 0x3e, 0x20, 0x23, 0x84, 0x69, 0x2d, 0x1d, 0x27,
-    0x76, 0x36, 0x26, 0x1c, 0x3d, 0x20, 0x2d, 0x1d, 0x1c, 0x11, 0x12, 0x12,
-    0x01, 0x05, 0x04, 0x06, 0x05, 0x0b, 0x05, 0x0c, 0x03, 0x05, 0x0c, 0x06,
-    0x01, 0x04, 0x03, 0x25, 0x1b, 0x06, 0x23, 0x10, 0x06, 0x07, 0x14, 0x1b,
-    0x1b, 0x31, 0x29, 0x06, 0x14, 0x53, 0x4f, 0x29, 0x5a, 0x5a, 0x2a, 0x04,
-    0x01, 0x02, 0x04, 0x05, 0x01, 0x01, 0x03, 0x0c, 0x06, 0x01, 0x01, 0x06,
-    0x03, 0x01, 0x00, 0x14, 0x1e, 0x24, 0x06, 0x28, 0x10, 0x33, 0x17, 0x10,
-    0x10, 0x1e, 0x14, 0x14, 0x07, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x02,
-    0x04, 0x07, 0x0d, 0x04, 0x04, 0x07, 0x10, 0x2e, 0x2f, 0x3c, 0x3c, 0x40,
-    0x2e, 0x2e, 0x10, 0x07, 0x3a, 0x3c, 0x3a, 0x46, 0x3c, 0x3c, 0x3a, 0x04,
-    0x04, 0x20, 0x28, 0x3c, 0x3a, 0x4d, 0x4d, 0x4d, 0x4f, 0x1e, 0x33, 0x4f,
-    0x4f, 0x14, 0x06, 0x29, 0x33, 0x33, 0x14, 0x2a, 0x2a, 0x13, 0x06, 0x14,
-    0x29, 0x33, 0x2a, 0x04, 0x27, 0x42, 0x3d, 0x67, 0x42, 0x15, 0x0b, 0x12,
-    0x0e, 0x12, 0x05, 0x31, 0x73, 0x23, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x03, 0x05, 0x05, 0x05, 0x11, 0x56, 0x1b, 0x25, 0x1f, 0x49,
-    0x49, 0x69, 0x25, 0x8c, 0x76, 0x8f, 0x83, 0x9b, 0x69, 0x1f, 0x25, 0x26,
-    0x54, 0x61, 0x01, 0x05, 0x15, 0x11, 0x01, 0x01, 0x01, 0x4b, 0x3e, 0x26,
-    0x15, 0x01, 0x16, 0x83, 0x4b, 0x34, 0x23, 0x16, 0x13, 0x05, 0x05, 0x0b,
-    0x7e, 0x71, 0x69, 0xa5, 0x1f, 0x05, 0x2c, 0x5c, 0x11, 0x05, 0x5c, 0x26,
-    0x15, 0x3e, 0x05, 0x05, 0x05, 0x08, 0x16, 0x5f, 0x2c, 0x26, 0x11, 0x21,
-    0x6e, 0x77, 0x7e, 0x77, 0x9c, 0xa5, 0x8d, 0x8c, 0x8c, 0x9c, 0xa5, 0x9c,
-    0x6a, 0x9c, 0xa9, 0x9a, 0x9c, 0x9c, 0x65, 0xa1, 0x9c, 0xa1, 0x7e, 0x8c,
-    0x9c, 0xab, 0xa9, 0x8d, 0x7e, 0x7e, 0x85, 0x4b, 0x85, 0x94, 0xaf, 0x8c,
-    0xa5, 0x7e, 0x59, 0x94, 0xa2, 0xa5, 0x94, 0x8c, 0x4b, 0x77, 0x85, 0x4b,
-    0x6e, 0x36, 0x4b, 0x5e, 0x2d, 0x2d, 0x36, 0x36, 0x27, 0x4b, 0x34, 0x1a,
-    0x2c, 0x2c, 0x26, 0x1c, 0x1f, 0x65, 0x4b, 0x26, 0x03, 0x05, 0x1c, 0x11,
-    0x03, 0x0b, 0x49, 0x4b, 0x3e, 0x3e, 0x36, 0x2c, 0x06, 0x1f, 0x27, 0x3d,
-    0x23, 0x1b, 0x15, 0x31, 0x2b, 0x1f, 0x0c, 0x05, 0x12, 0x0c, 0x15, 0x0b,
-    0x06, 0x08, 0x0b, 0x0b, 0x0c, 0x05, 0x06, 0x05, 0x03, 0x05, 0x05, 0x01,
-    0x07, 0x0b, 0x0c, 0x15, 0x1a, 0x15, 0x05, 0x04, 0x01, 0x01, 0x01, 0x14,
-    0x15, 0x06, 0x1c, 0x0c, 0x06, 0x14, 0x20, 0x35, 0x1b, 0x20, 0x35, 0x0b,
-    0x23, 0x2a, 0x3f, 0x33, 0x2a, 0x3a, 0x67, 0x3f, 0x10, 0x03, 0x02, 0x01,
-    0x01, 0x01, 0x05, 0x0c, 0x06, 0x01, 0x01, 0x06, 0x07, 0x1e, 0x1b, 0x04,
-    0x14, 0x04, 0x10, 0x10, 0x10, 0x3c, 0x3a, 0x14, 0x10, 0x24, 0x14, 0x07,
-    0x05, 0x01, 0x01, 0x01, 0x01, 0x03, 0x07, 0x07, 0x07, 0x17, 0x2e, 0x0d,
-    0x04, 0x07, 0x28, 0x2e, 0x2e, 0x40, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x04,
-    0x10, 0x4d, 0x3c, 0x3c, 0x3c, 0x4d, 0x17, 0x04, 0x07, 0x2a, 0x46, 0x3c,
-    0x4f, 0x46, 0x4d, 0x58, 0x46, 0x33, 0x4d, 0x4f, 0x4f, 0x0f, 0x14, 0x33,
-    0x3a, 0x3f, 0x20, 0x35, 0x33, 0x0b, 0x03, 0x23, 0x31, 0x24, 0x23, 0x1b,
-    0x0f, 0x20, 0x23, 0x2a, 0x23, 0x0b, 0x06, 0x12, 0x06, 0x0b, 0x0b, 0x76,
-    0x2a, 0x15, 0x03, 0x01, 0x01, 0x02, 0x01, 0x03, 0x01, 0x01, 0x05, 0x05,
-    0x0b, 0x05, 0x07, 0x1c, 0x1c, 0x1f, 0x1f, 0x36, 0x27, 0x38, 0x3e, 0x83,
-    0x86, 0x9b, 0x8c, 0x8f, 0x5e, 0x08, 0x04, 0x55, 0x1f, 0x15, 0x1c, 0x0b,
-    0x08, 0x05, 0x05, 0x05, 0x03, 0x15, 0x5e, 0x51, 0x2c, 0x2c, 0x4b, 0x3e,
-    0x4b, 0x77, 0x2c, 0x13, 0x05, 0x08, 0x05, 0x01, 0x2c, 0x8c, 0x71, 0x26,
-    0x05, 0x0b, 0x55, 0x6a, 0x15, 0x05, 0x55, 0x1c, 0x04, 0x77, 0x06, 0x1f,
-    0x03, 0x05, 0x05, 0x08, 0x05, 0x05, 0x05, 0x05, 0x51, 0x83, 0x9c, 0x5c,
-    0x3e, 0x77, 0xa9, 0x98, 0x8c, 0xa2, 0x9a, 0x7e, 0x94, 0xaf, 0x94, 0x9c,
-    0xa8, 0xa2, 0x4b, 0x8d, 0x9c, 0xab, 0x77, 0x6a, 0xa1, 0xa9, 0xb0, 0xa2,
-    0x8c, 0x94, 0xa2, 0x9a, 0x23, 0x6a, 0xb0, 0x8d, 0x8c, 0x94, 0x9c, 0x5e,
-    0x94, 0x9c, 0xa5, 0x85, 0x55, 0x91, 0x61, 0x6e, 0x36, 0x85, 0x85, 0x6e,
-    0x71, 0x6e, 0x6a, 0x4b, 0x1c, 0x1f, 0x1a, 0x06, 0x06, 0x05, 0x0b, 0x05,
-    0x0b, 0x15, 0x16, 0x06, 0x04, 0x03, 0x08, 0x05, 0x08, 0x05, 0x2b, 0x1a,
-    0x1f, 0x1f, 0x2d, 0x13, 0x05, 0x03, 0x0b, 0x0b, 0x11, 0x15, 0x2c, 0x0c,
-    0x15, 0x1c, 0x0b, 0x1f, 0x15, 0x4b, 0x1c, 0x1f, 0x23, 0x0b, 0x11, 0x15,
-    0x5e, 0x23, 0x05, 0x05, 0x06, 0x05, 0x0b, 0x05, 0x0c, 0x0b, 0x15, 0x1b,
-    0x23, 0x1f, 0x1c, 0x05, 0x01, 0x01, 0x21, 0x0c, 0x0b, 0x06, 0x0c, 0x0e,
-    0x2a, 0x25, 0x14, 0x20, 0x12, 0x04, 0x2d, 0x14, 0x35, 0x53, 0x67, 0x4f,
-    0x14, 0x2a, 0x53, 0x3a, 0x42, 0x24, 0x07, 0x01, 0x02, 0x01, 0x04, 0x07,
-    0x07, 0x01, 0x01, 0x03, 0x04, 0x1b, 0x28, 0x20, 0x04, 0x01, 0x1e, 0x33,
-    0x0c, 0x22, 0x22, 0x28, 0x1e, 0x04, 0x01, 0x01, 0x07, 0x09, 0x01, 0x01,
-    0x01, 0x04, 0x07, 0x14, 0x09, 0x2f, 0x2e, 0x22, 0x14, 0x07, 0x07, 0x28,
-    0x2e, 0x40, 0x40, 0x3a, 0x3c, 0x3a, 0x3a, 0x2e, 0x04, 0x22, 0x4d, 0x4d,
-    0x4d, 0x46, 0x07, 0x05, 0x1b, 0x3c, 0x33, 0x3a, 0x46, 0x46, 0x33, 0x3a,
-    0x4f, 0x3c, 0x42, 0x4f, 0x66, 0x1e, 0x29, 0x46, 0x50, 0x29, 0x14, 0x24,
-    0x35, 0x04, 0x06, 0x1b, 0x20, 0x24, 0x23, 0x2a, 0x3f, 0x14, 0x12, 0x15,
-    0x12, 0x12, 0x0c, 0x04, 0x01, 0x03, 0x05, 0x1b, 0x05, 0x02, 0x01, 0x01,
-    0x15, 0x0e, 0x01, 0x05, 0x01, 0x03, 0x06, 0x06, 0x11, 0x15, 0x0f, 0x12,
-    0x2d, 0x15, 0x54, 0x3e, 0x54, 0x20, 0x84, 0x8a, 0x8a, 0x92, 0x8c, 0x9b,
-    0x36, 0x06, 0x69, 0x21, 0x03, 0x01, 0x11, 0x0b, 0x0b, 0x01, 0x03, 0x0b,
-    0x1a, 0x54, 0x8c, 0x5e, 0x5f, 0x76, 0x69, 0x08, 0x15, 0x1a, 0x05, 0x05,
-    0x03, 0x05, 0x06, 0x34, 0x12, 0x5c, 0x69, 0x21, 0x0b, 0x61, 0x6a, 0x7a,
-    0x51, 0x11, 0x65, 0x26, 0x05, 0x5f, 0x36, 0x77, 0x0b, 0x05, 0x08, 0x0b,
-    0x05, 0x05, 0x05, 0x05, 0x12, 0x8d, 0x9c, 0x0b, 0x15, 0xa9, 0x9a, 0x77,
-    0x83, 0x85, 0x8c, 0x85, 0xa1, 0x8c, 0xa5, 0x94, 0x94, 0xa5, 0x71, 0x8d,
-    0x9c, 0x90, 0x8d, 0x59, 0xab, 0xa9, 0x9c, 0x7a, 0xa5, 0x9a, 0xab, 0xb0,
-    0x97, 0x26, 0x44, 0x61, 0x9b, 0xab, 0xa9, 0x7e, 0x65, 0xa1, 0x94, 0x71,
-    0x8d, 0x76, 0x85, 0x69, 0x55, 0x5c, 0x61, 0x49, 0x54, 0x54, 0x77, 0x55,
-    0x3e, 0x77, 0x75, 0x7e, 0x7e, 0x6a, 0x36, 0x16, 0x0b, 0x26, 0x36, 0x26,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0e, 0x05, 0x06, 0x01, 0x0c, 0x02,
-    0x05, 0x15, 0x8c, 0x15, 0x36, 0x49, 0x5e, 0x3e, 0x2d, 0x1a, 0x2d, 0x20,
-    0x2d, 0x5e, 0x27, 0x35, 0x31, 0x23, 0x3e, 0x27, 0x20, 0x05, 0x01, 0x01,
-    0x15, 0x05, 0x0b, 0x04, 0x0a, 0x05, 0x06, 0x2d, 0x14, 0x27, 0x10, 0x12,
-    0x15, 0x05, 0x1d, 0x15, 0x0f, 0x2b, 0x0c, 0x1a, 0x24, 0x24, 0x23, 0x35,
-    0x1e, 0x2a, 0x1c, 0x14, 0x31, 0x3f, 0x24, 0x20, 0x0c, 0x1b, 0x33, 0x3f,
-    0x1e, 0x1d, 0x0c, 0x02, 0x02, 0x06, 0x06, 0x0b, 0x06, 0x01, 0x02, 0x01,
-    0x01, 0x1b, 0x05, 0x04, 0x01, 0x01, 0x07, 0x04, 0x05, 0x04, 0x07, 0x09,
-    0x04, 0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x01, 0x0c, 0x07, 0x04, 0x09,
-    0x07, 0x2f, 0x40, 0x3c, 0x22, 0x10, 0x04, 0x10, 0x22, 0x2f, 0x40, 0x3c,
-    0x3c, 0x3a, 0x33, 0x4d, 0x28, 0x04, 0x28, 0x4d, 0x4d, 0x28, 0x04, 0x07,
-    0x42, 0x4d, 0x42, 0x2e, 0x3f, 0x46, 0x33, 0x28, 0x58, 0x5a, 0x3a, 0x58,
-    0x66, 0x33, 0x5a, 0x5a, 0x3f, 0x29, 0x1e, 0x2a, 0x14, 0x0b, 0x1b, 0x24,
-    0x31, 0x29, 0x42, 0x42, 0x64, 0x7b, 0x3d, 0x07, 0x07, 0x06, 0x05, 0x03,
-    0x03, 0x01, 0x02, 0x01, 0x05, 0x05, 0x05, 0x05, 0x15, 0x05, 0x05, 0x0c,
-    0x05, 0x03, 0x36, 0x5e, 0x0c, 0x15, 0x1a, 0x12, 0x15, 0x2d, 0x7a, 0x25,
-    0x2d, 0x25, 0x69, 0x7a, 0x96, 0x92, 0x36, 0x26, 0x13, 0x5e, 0x2d, 0x05,
-    0x03, 0x05, 0x01, 0x03, 0x36, 0x6a, 0x69, 0x7a, 0x7e, 0x54, 0x5e, 0x3b,
-    0x4b, 0x0b, 0x0b, 0x05, 0x05, 0x26, 0x26, 0x69, 0x0c, 0x02, 0x05, 0x51,
-    0x83, 0x9c, 0x71, 0x26, 0x4b, 0x2d, 0x7e, 0x8d, 0x76, 0x9c, 0x5c, 0x5e,
-    0x11, 0x0b, 0x2c, 0x9c, 0x55, 0x0b, 0x0b, 0x0b, 0x06, 0x05, 0x05, 0x05,
-    0x05, 0x5f, 0x4b, 0x0b, 0x6e, 0xa9, 0x77, 0x7e, 0x8d, 0x9c, 0x7e, 0x9a,
-    0x8c, 0x8d, 0x77, 0x8c, 0xa9, 0xb1, 0x94, 0x85, 0x9c, 0x83, 0x83, 0x94,
-    0x7e, 0x8c, 0x8d, 0xa2, 0x9c, 0xa2, 0xaf, 0xa9, 0xab, 0x8c, 0x34, 0x16,
-    0x69, 0x8c, 0x85, 0x6a, 0x6e, 0x71, 0x85, 0x9c, 0x94, 0x51, 0x55, 0x3e,
-    0x69, 0x26, 0x9c, 0x94, 0x85, 0x4b, 0x26, 0x9c, 0x4b, 0x77, 0x94, 0xa5,
-    0x9c, 0xa1, 0x5e, 0x7e, 0x21, 0x05, 0x06, 0x0b, 0x05, 0x05, 0x0b, 0x0b,
-    0x01, 0x05, 0x13, 0x11, 0x1f, 0x1f, 0x2c, 0x05, 0x06, 0x05, 0x06, 0x08,
-    0x0b, 0x36, 0x27, 0x36, 0x2d, 0x1b, 0x84, 0x1a, 0x1c, 0x5e, 0x2d, 0x2c,
-    0x1c, 0x36, 0x20, 0x3e, 0x26, 0x06, 0x01, 0x07, 0x3e, 0x04, 0x04, 0x01,
-    0x0b, 0x15, 0x05, 0x25, 0x0c, 0x20, 0x18, 0x07, 0x15, 0x14, 0x15, 0x2a,
-    0x25, 0x15, 0x0c, 0x2a, 0x2a, 0x31, 0x5b, 0x42, 0x3d, 0x07, 0x1f, 0x29,
-    0x24, 0x67, 0x28, 0x29, 0x14, 0x0b, 0x0c, 0x42, 0x14, 0x29, 0x1b, 0x23,
-    0x03, 0x05, 0x03, 0x01, 0x05, 0x01, 0x02, 0x01, 0x01, 0x1b, 0x03, 0x01,
-    0x01, 0x04, 0x17, 0x1b, 0x09, 0x01, 0x01, 0x01, 0x07, 0x05, 0x01, 0x04,
-    0x17, 0x14, 0x17, 0x07, 0x09, 0x04, 0x06, 0x10, 0x07, 0x2f, 0x40, 0x40,
-    0x2e, 0x22, 0x05, 0x07, 0x28, 0x40, 0x40, 0x3c, 0x3c, 0x2e, 0x2e, 0x3a,
-    0x3c, 0x18, 0x07, 0x3c, 0x4d, 0x1e, 0x04, 0x28, 0x24, 0x4d, 0x46, 0x58,
-    0x3a, 0x28, 0x4d, 0x2a, 0x28, 0x46, 0x3f, 0x33, 0x3f, 0x42, 0x3f, 0x3f,
-    0x24, 0x1e, 0x29, 0x18, 0x15, 0x04, 0x0c, 0x53, 0x67, 0x53, 0x67, 0x67,
-    0x4c, 0x35, 0x31, 0x50, 0x67, 0x0c, 0x0b, 0x03, 0x01, 0x01, 0x01, 0x03,
-    0x05, 0x0b, 0x05, 0x03, 0x03, 0x03, 0x0e, 0x49, 0x1c, 0x05, 0x6c, 0x76,
-    0x1c, 0x06, 0x26, 0x12, 0x1c, 0x1c, 0x1a, 0x2b, 0x1a, 0x1f, 0x54, 0x78,
-    0xa1, 0x76, 0x2d, 0x05, 0x05, 0x2d, 0x13, 0x01, 0x21, 0x54, 0x01, 0x01,
-    0x0b, 0x4b, 0x69, 0x8c, 0x61, 0x54, 0x5c, 0x5e, 0x3e, 0x05, 0x0b, 0x41,
-    0x36, 0x06, 0x4b, 0x5e, 0x34, 0x0b, 0x05, 0x0b, 0x98, 0x77, 0x55, 0x36,
-    0x77, 0x6a, 0x69, 0x05, 0x1a, 0x5f, 0x8d, 0x85, 0x5e, 0x71, 0x1f, 0x55,
-    0x4b, 0x5f, 0x55, 0x77, 0x34, 0x05, 0x05, 0x05, 0x05, 0x15, 0x34, 0x1f,
-    0x8c, 0x77, 0x97, 0x85, 0x77, 0x6a, 0x77, 0x7a, 0x8d, 0x7a, 0xa9, 0xa2,
-    0x9c, 0x9a, 0xac, 0x6a, 0x9a, 0xa5, 0xa5, 0x85, 0x65, 0x8c, 0x8c, 0xa1,
-    0x9c, 0xb1, 0xa9, 0x9c, 0xb0, 0x8c, 0x94, 0x7e, 0x15, 0x71, 0xa5, 0x8c,
-    0x85, 0x9c, 0x69, 0x65, 0x4b, 0x7e, 0x71, 0x85, 0x8c, 0xab, 0x59, 0x6a,
-    0x71, 0xac, 0x5e, 0x2d, 0x26, 0x5f, 0x61, 0x7e, 0x55, 0x5c, 0x61, 0x15,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x11, 0x26, 0x12, 0x05, 0x6b, 0x12,
-    0x5c, 0x4b, 0x2d, 0x27, 0x3e, 0x36, 0x55, 0x38, 0x01, 0x0b, 0x12, 0x26,
-    0x54, 0x6a, 0x5e, 0x1a, 0x1d, 0x49, 0x8f, 0x0c, 0x1f, 0x26, 0x15, 0x05,
-    0x06, 0x0b, 0x06, 0x25, 0x1f, 0x01, 0x05, 0x01, 0x05, 0x07, 0x15, 0x23,
-    0x06, 0x20, 0x2b, 0x0b, 0x05, 0x06, 0x35, 0x20, 0x5b, 0x0c, 0x31, 0x24,
-    0x23, 0x14, 0x29, 0x0c, 0x03, 0x25, 0x2a, 0x35, 0x1b, 0x50, 0x24, 0x24,
-    0x29, 0x0c, 0x24, 0x14, 0x35, 0x33, 0x33, 0x5a, 0x1e, 0x05, 0x02, 0x01,
-    0x05, 0x01, 0x01, 0x01, 0x01, 0x10, 0x05, 0x01, 0x01, 0x01, 0x17, 0x22,
-    0x22, 0x07, 0x01, 0x01, 0x01, 0x02, 0x10, 0x17, 0x17, 0x07, 0x3a, 0x2f,
-    0x0d, 0x01, 0x10, 0x10, 0x07, 0x17, 0x3c, 0x40, 0x2f, 0x2e, 0x06, 0x04,
-    0x22, 0x22, 0x2e, 0x2e, 0x3c, 0x3c, 0x40, 0x3a, 0x40, 0x4d, 0x10, 0x14,
-    0x46, 0x14, 0x06, 0x3c, 0x28, 0x4f, 0x4d, 0x4d, 0x46, 0x28, 0x58, 0x33,
-    0x33, 0x58, 0x66, 0x66, 0x4f, 0x4f, 0x33, 0x46, 0x73, 0x24, 0x29, 0x1b,
-    0x1e, 0x04, 0x29, 0x3f, 0x53, 0x67, 0x50, 0x67, 0x42, 0x50, 0x42, 0x7d,
-    0x67, 0x0c, 0x15, 0x05, 0x03, 0x01, 0x01, 0x05, 0x15, 0x14, 0x0e, 0x01,
-    0x03, 0x04, 0x0b, 0x1a, 0x2d, 0x07, 0x54, 0x2d, 0x23, 0x0b, 0x26, 0x2d,
-    0x12, 0x1a, 0x20, 0x1c, 0x21, 0x1a, 0x15, 0x54, 0x4b, 0x2b, 0x4b, 0x1f,
-    0x13, 0x26, 0x05, 0x08, 0x15, 0x2d, 0x15, 0x01, 0x05, 0x5e, 0x69, 0x2d,
-    0x23, 0x5e, 0x7e, 0x71, 0x5e, 0x0b, 0x65, 0x2d, 0x65, 0x0b, 0x3e, 0x65,
-    0x83, 0x3e, 0x34, 0x2d, 0x4b, 0x77, 0xa5, 0xab, 0x9c, 0x8c, 0x8d, 0x16,
-    0x01, 0x04, 0x8d, 0x71, 0x5f, 0x9c, 0x34, 0x06, 0x0e, 0x0e, 0x26, 0x97,
-    0x49, 0x34, 0x0b, 0x05, 0x05, 0x05, 0x26, 0xac, 0x94, 0x7e, 0x6a, 0x97,
-    0x5c, 0x7f, 0x90, 0x8c, 0x94, 0x83, 0x8c, 0x9c, 0x9c, 0xa8, 0x7e, 0x3e,
-    0x94, 0x94, 0x94, 0xa2, 0x85, 0x55, 0x71, 0x9a, 0xa5, 0xac, 0xac, 0x9c,
-    0x83, 0x9c, 0xb1, 0xab, 0x9a, 0x4b, 0x55, 0x8d, 0x94, 0x94, 0x77, 0x2d,
-    0x94, 0xbf, 0x51, 0x9c, 0x77, 0x4b, 0x5e, 0x71, 0xa1, 0xb0, 0xb0, 0xb0,
-    0x77, 0x44, 0x23, 0x1f, 0x55, 0x5c, 0x1f, 0x0b, 0x0b, 0x1f, 0x1c, 0x05,
-    0x05, 0x05, 0x4b, 0x83, 0x69, 0x1a, 0x4b, 0x1c, 0x15, 0x05, 0x0b, 0x21,
-    0x27, 0x1c, 0x27, 0x23, 0x2c, 0x2c, 0x1c, 0x01, 0x05, 0x2d, 0x25, 0x5e,
-    0x94, 0x3d, 0x3e, 0x15, 0x2b, 0x11, 0x06, 0x0b, 0x0b, 0x08, 0x2b, 0x26,
-    0x04, 0x03, 0x0b, 0x05, 0x03, 0x23, 0x31, 0x12, 0x05, 0x05, 0x15, 0x25,
-    0x3d, 0x20, 0x3d, 0x15, 0x15, 0x23, 0x2a, 0x73, 0x35, 0x1e, 0x20, 0x0b,
-    0x12, 0x25, 0x42, 0x1b, 0x0c, 0x67, 0x29, 0x1d, 0x23, 0x33, 0x50, 0x42,
-    0x12, 0x1e, 0x53, 0x4f, 0x1e, 0x09, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x02, 0x19, 0x0c, 0x04, 0x04, 0x04, 0x22, 0x46, 0x1e, 0x09, 0x14, 0x01,
-    0x02, 0x01, 0x02, 0x04, 0x09, 0x2e, 0x33, 0x17, 0x1e, 0x07, 0x07, 0x04,
-    0x04, 0x04, 0x17, 0x2f, 0x3a, 0x2e, 0x22, 0x07, 0x07, 0x2e, 0x28, 0x28,
-    0x3a, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x2e, 0x07, 0x14, 0x06, 0x14, 0x4d,
-    0x46, 0x28, 0x46, 0x4d, 0x2e, 0x58, 0x42, 0x24, 0x14, 0x42, 0x46, 0x46,
-    0x50, 0x33, 0x4f, 0x53, 0x4f, 0x2a, 0x3d, 0x1d, 0x24, 0x06, 0x42, 0x53,
-    0x53, 0x53, 0x67, 0x70, 0x53, 0x73, 0x53, 0x67, 0x67, 0x12, 0x0b, 0x04,
-    0x05, 0x01, 0x06, 0x1d, 0x69, 0x1f, 0x12, 0x01, 0x0b, 0x1b, 0x12, 0x06,
-    0x20, 0x1a, 0x21, 0x3e, 0x1c, 0x3e, 0x56, 0x54, 0x15, 0x3e, 0x3e, 0x54,
-    0x59, 0x25, 0x3e, 0x54, 0x21, 0x05, 0x13, 0x2c, 0x20, 0x1a, 0x01, 0x01,
-    0x05, 0x06, 0x26, 0x05, 0x05, 0x12, 0x1f, 0x2d, 0x44, 0x36, 0x15, 0x13,
-    0x2c, 0x11, 0x71, 0x0b, 0x05, 0x08, 0x23, 0x3e, 0x85, 0x77, 0x77, 0x83,
-    0x85, 0x65, 0x94, 0xab, 0x75, 0x9c, 0x4b, 0x0b, 0x05, 0x0b, 0x5f, 0x61,
-    0x05, 0x11, 0x05, 0x0e, 0x4b, 0x4b, 0x1a, 0x3e, 0x3e, 0x6e, 0x16, 0x0b,
-    0x05, 0x05, 0x2c, 0xa8, 0x8c, 0xac, 0x77, 0x5c, 0x51, 0x7e, 0x94, 0x8c,
-    0x8c, 0x94, 0x9c, 0xa2, 0xaf, 0x9c, 0x61, 0x71, 0x7e, 0xa2, 0xaf, 0x9a,
-    0x94, 0x8d, 0x71, 0x77, 0x7e, 0x8c, 0x8c, 0x9c, 0xb1, 0xb0, 0xa9, 0x85,
-    0x8d, 0x85, 0x69, 0x26, 0x3e, 0x8d, 0x94, 0xa5, 0x94, 0x9c, 0x8d, 0x5e,
-    0x85, 0x55, 0xb0, 0x83, 0x71, 0xa1, 0xab, 0xa5, 0x7a, 0x4b, 0x71, 0x61,
-    0x55, 0x71, 0x2d, 0x4b, 0x3e, 0xab, 0x2c, 0x06, 0x0b, 0x0e, 0x2d, 0x4b,
-    0x69, 0x51, 0x9b, 0x23, 0x11, 0x0b, 0x0b, 0x0c, 0x0b, 0x0b, 0x15, 0x69,
-    0x2b, 0x54, 0x4b, 0x0b, 0x15, 0x05, 0x05, 0x15, 0x64, 0x3d, 0x23, 0x0b,
-    0x15, 0x0b, 0x1c, 0x0b, 0x04, 0x01, 0x0b, 0x06, 0x0b, 0x05, 0x06, 0x0b,
-    0x0c, 0x12, 0x36, 0x1f, 0x04, 0x0b, 0x0b, 0x31, 0x29, 0x67, 0x1d, 0x1b,
-    0x20, 0x2d, 0x1d, 0x20, 0x50, 0x27, 0x05, 0x06, 0x1e, 0x24, 0x67, 0x3f,
-    0x1d, 0x10, 0x14, 0x17, 0x29, 0x1e, 0x3d, 0x33, 0x0b, 0x3f, 0x2a, 0x1e,
-    0x20, 0x24, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x04,
-    0x04, 0x17, 0x28, 0x28, 0x07, 0x09, 0x14, 0x01, 0x02, 0x01, 0x01, 0x17,
-    0x22, 0x28, 0x22, 0x17, 0x1e, 0x07, 0x04, 0x01, 0x0d, 0x05, 0x01, 0x17,
-    0x2e, 0x40, 0x28, 0x17, 0x02, 0x17, 0x28, 0x2e, 0x2e, 0x3a, 0x3c, 0x46,
-    0x3a, 0x3a, 0x3c, 0x22, 0x07, 0x04, 0x1e, 0x4d, 0x3a, 0x28, 0x46, 0x4d,
-    0x2e, 0x4d, 0x4d, 0x28, 0x04, 0x14, 0x29, 0x33, 0x33, 0x42, 0x4f, 0x2a,
-    0x20, 0x24, 0x29, 0x1b, 0x14, 0x0b, 0x50, 0x53, 0x67, 0x73, 0x70, 0x67,
-    0x67, 0x73, 0x70, 0x5b, 0x5b, 0x0b, 0x05, 0x06, 0x01, 0x01, 0x0c, 0x2d,
-    0x1b, 0x1a, 0x06, 0x05, 0x49, 0x54, 0x5e, 0x15, 0x15, 0x0b, 0x20, 0x0b,
-    0x1c, 0x6c, 0x76, 0x25, 0x49, 0x9b, 0x3d, 0xa1, 0x76, 0x27, 0x54, 0x5e,
-    0x36, 0x06, 0x2d, 0x4b, 0x06, 0x08, 0x0b, 0x01, 0x08, 0x1c, 0x16, 0x1f,
-    0x1c, 0x15, 0x26, 0x2d, 0x4b, 0x0b, 0x0b, 0x1f, 0x3e, 0x05, 0x0b, 0x08,
-    0x03, 0x05, 0x36, 0x5c, 0x6a, 0x8d, 0x61, 0x47, 0x05, 0x0b, 0x85, 0x9a,
-    0x85, 0x83, 0x77, 0x2b, 0x03, 0x57, 0x69, 0x97, 0x05, 0x05, 0x0b, 0x5e,
-    0xa6, 0xa5, 0x0e, 0x03, 0x05, 0x41, 0x15, 0x05, 0x05, 0x0b, 0x57, 0x9a,
-    0x9a, 0xb5, 0x8c, 0x61, 0x7e, 0x6a, 0x8d, 0x6a, 0x85, 0x9a, 0x8c, 0x9a,
-    0x97, 0x71, 0x71, 0x83, 0x94, 0xaf, 0xa8, 0xa2, 0x83, 0xa2, 0x8c, 0x8c,
-    0xa2, 0xb0, 0xab, 0xaf, 0xaf, 0xa9, 0xaf, 0x8c, 0xa2, 0x9c, 0x77, 0x5c,
-    0x71, 0x54, 0x5c, 0x7e, 0x94, 0x77, 0x8c, 0x71, 0x5e, 0x71, 0x7e, 0xa1,
-    0x4b, 0x55, 0x7e, 0x77, 0x85, 0x8d, 0x61, 0x71, 0x4b, 0x69, 0x26, 0x5e,
-    0x69, 0x83, 0x1f, 0x08, 0x26, 0x3e, 0x4b, 0x1a, 0x3e, 0x1c, 0x21, 0x36,
-    0x55, 0x1f, 0x1f, 0x21, 0x1c, 0x15, 0x1f, 0x26, 0x3e, 0x77, 0x2d, 0x1f,
-    0x26, 0x27, 0x2c, 0x1c, 0x01, 0x04, 0x05, 0x20, 0x6f, 0x3d, 0x0b, 0x05,
-    0x01, 0x05, 0x0b, 0x0b, 0x15, 0x05, 0x06, 0x11, 0x1f, 0x20, 0x14, 0x11,
-    0x06, 0x0b, 0x05, 0x12, 0x23, 0x50, 0x23, 0x23, 0x20, 0x27, 0x35, 0x1e,
-    0x25, 0x06, 0x1b, 0x14, 0x27, 0x2a, 0x31, 0x50, 0x2a, 0x1d, 0x0c, 0x1b,
-    0x1b, 0x1e, 0x20, 0x14, 0x07, 0x14, 0x18, 0x1e, 0x2a, 0x1b, 0x12, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x14, 0x10, 0x33, 0x1e, 0x07,
-    0x02, 0x02, 0x06, 0x07, 0x01, 0x02, 0x07, 0x28, 0x19, 0x22, 0x28, 0x09,
-    0x01, 0x17, 0x17, 0x01, 0x2e, 0x0d, 0x01, 0x04, 0x0d, 0x22, 0x2e, 0x2e,
-    0x04, 0x04, 0x22, 0x2e, 0x2e, 0x46, 0x3c, 0x3a, 0x33, 0x4d, 0x3c, 0x28,
-    0x1e, 0x07, 0x09, 0x2e, 0x3f, 0x33, 0x3a, 0x46, 0x2e, 0x4f, 0x4f, 0x33,
-    0x2a, 0x17, 0x20, 0x24, 0x33, 0x33, 0x31, 0x23, 0x10, 0x25, 0x1d, 0x06,
-    0x04, 0x0b, 0x53, 0x50, 0x5b, 0x53, 0x67, 0x53, 0x70, 0x7b, 0x7b, 0x67,
-    0x24, 0x06, 0x06, 0x06, 0x03, 0x01, 0x0b, 0x1c, 0x06, 0x21, 0x05, 0x05,
-    0x3d, 0x3d, 0x49, 0x23, 0x1c, 0x1b, 0x20, 0x05, 0x1c, 0x6c, 0x49, 0x1f,
-    0x5e, 0x76, 0x5e, 0x7a, 0x64, 0x27, 0x49, 0x71, 0x15, 0x05, 0x1c, 0x36,
-    0x3e, 0x36, 0x4b, 0x01, 0x01, 0x13, 0x69, 0x7e, 0x36, 0x1f, 0x3e, 0x59,
-    0x7e, 0x13, 0x2c, 0x61, 0x7a, 0x0f, 0x01, 0x06, 0x34, 0x06, 0x5e, 0x1a,
-    0x5c, 0x85, 0x7e, 0x0b, 0x1f, 0x3e, 0x85, 0x71, 0x9b, 0xa5, 0x55, 0x5e,
-    0x16, 0x74, 0x4b, 0xab, 0x36, 0x05, 0x16, 0x77, 0x5c, 0x8d, 0x0e, 0x05,
-    0x05, 0x16, 0x1f, 0x01, 0x03, 0x2c, 0x65, 0x8c, 0xb0, 0x8d, 0x6a, 0x94,
-    0x9a, 0x85, 0x7e, 0x7e, 0x97, 0x98, 0x71, 0x7e, 0x77, 0x9c, 0x94, 0x90,
-    0x85, 0xa2, 0x9c, 0x9c, 0x77, 0x94, 0xa2, 0x94, 0x8d, 0x8c, 0xa9, 0xaf,
-    0xb1, 0xa9, 0xb0, 0x94, 0xa9, 0x8d, 0x77, 0x85, 0xa9, 0xa9, 0x71, 0x59,
-    0x6a, 0x71, 0x4b, 0x8c, 0xac, 0x83, 0x3e, 0x77, 0x55, 0x55, 0x71, 0x8c,
-    0x9c, 0x71, 0x55, 0x3e, 0x5e, 0x65, 0x5c, 0x6a, 0x76, 0x8c, 0x4b, 0x26,
-    0x8c, 0x9c, 0x6c, 0x5e, 0x55, 0x16, 0x1f, 0x36, 0x23, 0x2d, 0x55, 0x23,
-    0x2c, 0x23, 0x1f, 0x0c, 0x27, 0x5e, 0x1f, 0x1c, 0x1f, 0x3e, 0x5e, 0x36,
-    0x06, 0x05, 0x01, 0x0c, 0x49, 0x56, 0x0e, 0x06, 0x03, 0x05, 0x03, 0x05,
-    0x05, 0x05, 0x11, 0x0b, 0x1c, 0x1a, 0x06, 0x0b, 0x1b, 0x15, 0x0b, 0x1b,
-    0x1d, 0x15, 0x23, 0x36, 0x04, 0x1b, 0x2a, 0x20, 0x15, 0x0b, 0x23, 0x23,
-    0x42, 0x2a, 0x25, 0x20, 0x56, 0x29, 0x14, 0x1d, 0x1e, 0x14, 0x20, 0x2a,
-    0x2a, 0x07, 0x0c, 0x1d, 0x1b, 0x14, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x07, 0x01, 0x06, 0x14, 0x1e, 0x10, 0x01, 0x01, 0x02, 0x07, 0x1e,
-    0x04, 0x01, 0x17, 0x28, 0x1b, 0x17, 0x07, 0x01, 0x02, 0x07, 0x07, 0x01,
-    0x2f, 0x2f, 0x07, 0x04, 0x07, 0x04, 0x17, 0x3c, 0x10, 0x01, 0x17, 0x3c,
-    0x3c, 0x3a, 0x46, 0x3c, 0x3a, 0x2e, 0x1e, 0x4d, 0x28, 0x14, 0x04, 0x33,
-    0x33, 0x2e, 0x42, 0x33, 0x4f, 0x4f, 0x46, 0x46, 0x46, 0x46, 0x20, 0x04,
-    0x42, 0x35, 0x2a, 0x14, 0x14, 0x14, 0x23, 0x05, 0x01, 0x05, 0x42, 0x67,
-    0x53, 0x67, 0x67, 0x67, 0x70, 0x7b, 0x7b, 0x87, 0x20, 0x05, 0x07, 0x07,
-    0x05, 0x12, 0x05, 0x01, 0x04, 0x23, 0x06, 0x03, 0x27, 0x23, 0x0b, 0x0b,
-    0x3e, 0x1f, 0x0b, 0x01, 0x0b, 0x5e, 0x3d, 0x26, 0x54, 0x76, 0x94, 0x6c,
-    0x23, 0x15, 0x2c, 0x1c, 0x06, 0x13, 0x21, 0x0b, 0x4b, 0x3e, 0x4b, 0x05,
-    0x03, 0x1f, 0x7a, 0x7a, 0x69, 0x34, 0x26, 0x69, 0x69, 0x4b, 0x55, 0x5e,
-    0x7a, 0x36, 0x01, 0x1f, 0x65, 0x15, 0x77, 0x71, 0x13, 0x3e, 0x1f, 0x05,
-    0x3e, 0x94, 0x94, 0x77, 0x83, 0x94, 0x77, 0x55, 0x16, 0x26, 0x16, 0x69,
-    0x8d, 0x1f, 0x16, 0x57, 0x2c, 0x34, 0x11, 0x05, 0x05, 0x08, 0x05, 0x0b,
-    0x1f, 0x3e, 0x65, 0x55, 0x85, 0x5c, 0x85, 0x85, 0x77, 0x9c, 0x94, 0x90,
-    0xa2, 0x8c, 0x94, 0x9c, 0x85, 0x90, 0xa2, 0xa2, 0x71, 0xa2, 0xa2, 0xa2,
-    0x94, 0x9c, 0xa9, 0xaf, 0xa9, 0x94, 0x8c, 0x9a, 0xb5, 0xab, 0xa9, 0xa9,
-    0x7e, 0x94, 0x8d, 0x8c, 0x9c, 0xa9, 0xa9, 0xb1, 0x94, 0x85, 0x65, 0x5e,
-    0x5c, 0x55, 0x36, 0x34, 0x85, 0x8d, 0xa2, 0x71, 0x69, 0x69, 0x7e, 0x6a,
-    0x3e, 0x4b, 0x5c, 0x55, 0x94, 0x7a, 0x71, 0x4b, 0x71, 0x8c, 0x55, 0x5e,
-    0x54, 0x71, 0x47, 0x55, 0x1a, 0x1f, 0x2d, 0x2d, 0x3e, 0x49, 0x1a, 0x1f,
-    0x36, 0x69, 0x11, 0x1c, 0x0b, 0x1c, 0x27, 0x12, 0x0c, 0x26, 0x23, 0x25,
-    0x21, 0x1c, 0x1c, 0x1a, 0x08, 0x07, 0x05, 0x05, 0x06, 0x06, 0x1f, 0x15,
-    0x0e, 0x0c, 0x0b, 0x25, 0x25, 0x1b, 0x13, 0x21, 0x14, 0x12, 0x1a, 0x15,
-    0x12, 0x1b, 0x15, 0x2d, 0x1b, 0x0c, 0x1d, 0x0b, 0x20, 0x29, 0x35, 0x1b,
-    0x20, 0x1b, 0x10, 0x15, 0x12, 0x1b, 0x24, 0x35, 0x66, 0x14, 0x1b, 0x14,
-    0x1b, 0x0c, 0x03, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x14, 0x0c,
-    0x10, 0x1b, 0x07, 0x02, 0x01, 0x01, 0x12, 0x1e, 0x1e, 0x01, 0x07, 0x07,
-    0x07, 0x01, 0x06, 0x10, 0x04, 0x09, 0x01, 0x01, 0x17, 0x2f, 0x22, 0x17,
-    0x07, 0x01, 0x04, 0x22, 0x17, 0x02, 0x04, 0x2e, 0x3a, 0x3c, 0x40, 0x3a,
-    0x3c, 0x22, 0x10, 0x3a, 0x28, 0x17, 0x07, 0x28, 0x4d, 0x46, 0x3a, 0x46,
-    0x4d, 0x46, 0x4d, 0x58, 0x58, 0x4f, 0x24, 0x01, 0x1d, 0x12, 0x07, 0x03,
-    0x04, 0x07, 0x12, 0x05, 0x01, 0x01, 0x10, 0x7b, 0x67, 0x7b, 0x7b, 0x70,
-    0x73, 0x7b, 0x73, 0x87, 0x15, 0x06, 0x06, 0x05, 0x2b, 0x31, 0x05, 0x05,
-    0x0c, 0x3d, 0x04, 0x0a, 0x23, 0x13, 0x05, 0x1f, 0x49, 0x1f, 0x07, 0x05,
-    0x06, 0x49, 0x13, 0x5e, 0x5e, 0x8a, 0xa1, 0x76, 0x1f, 0x05, 0x0b, 0x03,
-    0x26, 0x36, 0x0b, 0x05, 0x08, 0x1f, 0x55, 0x05, 0x03, 0x54, 0xa5, 0x9b,
-    0xa1, 0x83, 0x55, 0x55, 0x6a, 0x6c, 0x6a, 0x55, 0x5e, 0x77, 0x15, 0x2c,
-    0x1f, 0x0b, 0x83, 0xb0, 0x6a, 0x0b, 0x01, 0x05, 0x0c, 0x7e, 0x71, 0x5c,
-    0x5c, 0x94, 0x94, 0xa5, 0x26, 0x05, 0x05, 0x0e, 0x2d, 0x65, 0x6e, 0x5c,
-    0x1a, 0x06, 0x1f, 0x05, 0x05, 0x05, 0x0e, 0x65, 0x77, 0x71, 0x7e, 0x13,
-    0x16, 0x5c, 0x8d, 0x8d, 0x94, 0x8c, 0x85, 0x9c, 0x9a, 0x9c, 0x9c, 0x83,
-    0x9a, 0xa9, 0xaf, 0xa9, 0x8c, 0x85, 0xaf, 0xaf, 0xaf, 0x8c, 0xaf, 0xaf,
-    0xaf, 0xb0, 0xa5, 0x85, 0x75, 0x94, 0xb5, 0xa9, 0x8d, 0x7e, 0x7e, 0x8d,
-    0x8c, 0xa5, 0xb1, 0xab, 0xaf, 0x9c, 0x9c, 0x77, 0x4b, 0x3e, 0x51, 0x15,
-    0x65, 0x9c, 0x7e, 0x77, 0x5e, 0x4b, 0x49, 0x8c, 0x54, 0x65, 0x3e, 0x25,
-    0x77, 0x8c, 0x85, 0x55, 0x84, 0x36, 0x77, 0x5e, 0x54, 0x7a, 0x83, 0x4b,
-    0x2d, 0x5e, 0x4b, 0x1c, 0x54, 0x94, 0x2d, 0x27, 0x25, 0x21, 0x05, 0x0b,
-    0x0b, 0x05, 0x0b, 0x26, 0x31, 0x5e, 0x69, 0x49, 0x36, 0x27, 0x15, 0x2d,
-    0x08, 0x12, 0x0e, 0x07, 0x2c, 0x12, 0x15, 0x12, 0x0b, 0x0b, 0x0b, 0x25,
-    0x13, 0x0c, 0x0c, 0x1c, 0x0c, 0x1d, 0x15, 0x2a, 0x18, 0x25, 0x5b, 0x2a,
-    0x1d, 0x2a, 0x64, 0x0c, 0x1b, 0x0c, 0x24, 0x29, 0x20, 0x20, 0x35, 0x1b,
-    0x14, 0x18, 0x24, 0x24, 0x31, 0x1b, 0x10, 0x13, 0x14, 0x07, 0x07, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x06, 0x0b, 0x06, 0x06, 0x02,
-    0x01, 0x02, 0x14, 0x1e, 0x17, 0x04, 0x01, 0x09, 0x06, 0x02, 0x07, 0x1e,
-    0x17, 0x07, 0x04, 0x02, 0x17, 0x2e, 0x2e, 0x3c, 0x2e, 0x07, 0x01, 0x04,
-    0x10, 0x05, 0x07, 0x10, 0x3a, 0x3a, 0x3c, 0x4d, 0x2e, 0x1e, 0x1e, 0x14,
-    0x17, 0x28, 0x15, 0x14, 0x4d, 0x3a, 0x46, 0x4d, 0x33, 0x46, 0x58, 0x58,
-    0x66, 0x3f, 0x10, 0x14, 0x42, 0x53, 0x24, 0x3f, 0x0c, 0x0c, 0x06, 0x03,
-    0x03, 0x03, 0x10, 0x53, 0x67, 0x67, 0x7b, 0x7b, 0x67, 0x73, 0x7d, 0x87,
-    0x07, 0x06, 0x0b, 0x06, 0x6c, 0x29, 0x05, 0x07, 0x27, 0x64, 0x06, 0x0b,
-    0x1f, 0x0b, 0x1c, 0x59, 0x23, 0x5e, 0x15, 0x0b, 0x01, 0x21, 0x30, 0x7a,
-    0x76, 0x8f, 0x9b, 0x5e, 0x16, 0x03, 0x01, 0x3e, 0x84, 0x1a, 0x03, 0x03,
-    0x05, 0x0b, 0x3e, 0x08, 0x16, 0x85, 0xab, 0xb0, 0x9c, 0x9c, 0x8c, 0x83,
-    0x71, 0x8c, 0x94, 0x61, 0x5e, 0x9a, 0x8c, 0x3e, 0x16, 0x51, 0x85, 0xab,
-    0x9c, 0x61, 0x1f, 0x0c, 0x2d, 0x8d, 0x8c, 0x34, 0x0e, 0x6a, 0x90, 0x9c,
-    0x2c, 0x05, 0x05, 0x05, 0x05, 0x41, 0x6e, 0x26, 0x0b, 0x08, 0x06, 0x05,
-    0x05, 0x26, 0x85, 0x94, 0x85, 0x4b, 0x71, 0x6b, 0x13, 0x7e, 0x9a, 0xa2,
-    0xa8, 0x9c, 0x6a, 0x85, 0x85, 0x85, 0x94, 0xa2, 0xa9, 0xaf, 0xaf, 0xa2,
-    0x9c, 0x77, 0xaf, 0xaf, 0xb5, 0x71, 0xb5, 0xaf, 0xaf, 0xb0, 0xaf, 0xa5,
-    0x9c, 0x7e, 0x71, 0x77, 0x94, 0x74, 0x83, 0x8d, 0x8d, 0x9a, 0xab, 0xaf,
-    0xa5, 0xb1, 0x8c, 0x8d, 0x77, 0x4b, 0x2d, 0x0b, 0x1f, 0x26, 0x36, 0x77,
-    0x61, 0x71, 0x2d, 0x55, 0x77, 0x94, 0x85, 0x54, 0x5c, 0x2d, 0x23, 0x26,
-    0x71, 0x85, 0x69, 0x6a, 0x9c, 0x77, 0x5e, 0x54, 0x5e, 0x54, 0x2c, 0x06,
-    0x0b, 0x16, 0x0b, 0x04, 0x06, 0x04, 0x03, 0x01, 0x01, 0x02, 0x02, 0x05,
-    0x06, 0x0b, 0x15, 0x15, 0x20, 0x36, 0x1f, 0x0b, 0x36, 0x07, 0x36, 0x3d,
-    0x1f, 0x21, 0x0f, 0x1f, 0x0b, 0x06, 0x0f, 0x1c, 0x1f, 0x0b, 0x35, 0x0b,
-    0x1a, 0x20, 0x23, 0x64, 0x31, 0x1b, 0x3d, 0x3d, 0x2a, 0x2d, 0x67, 0x29,
-    0x25, 0x25, 0x14, 0x3f, 0x42, 0x29, 0x25, 0x24, 0x42, 0x2a, 0x14, 0x10,
-    0x14, 0x14, 0x06, 0x0f, 0x14, 0x1b, 0x01, 0x01, 0x06, 0x01, 0x02, 0x02,
-    0x05, 0x01, 0x06, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x02, 0x04, 0x10,
-    0x07, 0x14, 0x28, 0x22, 0x14, 0x01, 0x07, 0x1e, 0x09, 0x01, 0x04, 0x01,
-    0x0d, 0x3c, 0x40, 0x3c, 0x40, 0x2e, 0x07, 0x01, 0x04, 0x10, 0x0c, 0x05,
-    0x10, 0x22, 0x28, 0x28, 0x17, 0x3a, 0x46, 0x17, 0x14, 0x28, 0x17, 0x07,
-    0x4d, 0x46, 0x40, 0x50, 0x2e, 0x3a, 0x4d, 0x58, 0x4d, 0x17, 0x1b, 0x4f,
-    0x5a, 0x3f, 0x42, 0x63, 0x1b, 0x06, 0x04, 0x05, 0x01, 0x03, 0x3f, 0x1b,
-    0x0c, 0x1b, 0x50, 0x5a, 0x7b, 0x73, 0x7b, 0x64, 0x04, 0x05, 0x04, 0x0c,
-    0x7d, 0x23, 0x03, 0x1d, 0x67, 0x81, 0x12, 0x0b, 0x13, 0x27, 0x3e, 0x3d,
-    0x54, 0x0c, 0x0b, 0x03, 0x05, 0x1c, 0x75, 0x86, 0x83, 0x83, 0x68, 0x3e,
-    0x08, 0x26, 0x3e, 0x8f, 0x83, 0x2d, 0x11, 0x03, 0x03, 0x05, 0x11, 0x13,
-    0x55, 0x54, 0x7e, 0xa1, 0xaf, 0x94, 0xab, 0x9c, 0x75, 0x8c, 0x6a, 0x69,
-    0x6a, 0x83, 0x8f, 0x6a, 0x8d, 0x3e, 0x26, 0x71, 0xaf, 0x9c, 0x7e, 0x6a,
-    0xa5, 0x7a, 0x85, 0x51, 0x08, 0x34, 0x9c, 0x9a, 0x26, 0x03, 0x05, 0x05,
-    0x06, 0x1a, 0x2c, 0x2c, 0x5f, 0x08, 0x05, 0x05, 0x05, 0x34, 0xac, 0x71,
-    0x47, 0x85, 0x1f, 0x0b, 0x34, 0x7e, 0xa9, 0xa9, 0xb1, 0x77, 0xa9, 0xa5,
-    0x83, 0x9a, 0x94, 0xb5, 0xaf, 0xa8, 0xaf, 0xaf, 0x9a, 0x94, 0x9c, 0x71,
-    0x7e, 0x6e, 0x90, 0x8d, 0x9c, 0x7e, 0xb1, 0xb0, 0x8c, 0x8d, 0x9a, 0x9a,
-    0x7e, 0x36, 0x51, 0x51, 0x85, 0x8d, 0xb3, 0xa5, 0x94, 0x6a, 0xa2, 0x85,
-    0x7e, 0x54, 0xa2, 0x4b, 0x77, 0x85, 0x69, 0x1f, 0x13, 0x3e, 0x34, 0x26,
-    0x5f, 0x83, 0x8c, 0x71, 0x9c, 0x94, 0x94, 0x4b, 0x44, 0x4b, 0x1c, 0x15,
-    0x26, 0x1c, 0x0e, 0x0b, 0x06, 0x06, 0x07, 0x15, 0x0c, 0x41, 0x26, 0x55,
-    0x51, 0x5e, 0x12, 0x06, 0x12, 0x15, 0x21, 0x27, 0x36, 0x15, 0x1c, 0x0c,
-    0x05, 0x06, 0x04, 0x05, 0x15, 0x0c, 0x23, 0x64, 0x27, 0x06, 0x12, 0x0e,
-    0x12, 0x0c, 0x11, 0x23, 0x1c, 0x0b, 0x1b, 0x1f, 0x35, 0x2d, 0x3d, 0x64,
-    0x35, 0x23, 0x50, 0x31, 0x50, 0x1b, 0x23, 0x50, 0x2d, 0x14, 0x2d, 0x2a,
-    0x3d, 0x1d, 0x1b, 0x23, 0x24, 0x1d, 0x14, 0x09, 0x05, 0x06, 0x0c, 0x29,
-    0x0c, 0x05, 0x01, 0x02, 0x01, 0x03, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01,
-    0x07, 0x07, 0x17, 0x0c, 0x01, 0x07, 0x04, 0x07, 0x10, 0x17, 0x3a, 0x2e,
-    0x3c, 0x04, 0x07, 0x04, 0x01, 0x01, 0x01, 0x09, 0x14, 0x3c, 0x3c, 0x2e,
-    0x3c, 0x3a, 0x2e, 0x04, 0x04, 0x0c, 0x05, 0x01, 0x07, 0x3a, 0x2f, 0x3a,
-    0x46, 0x4d, 0x4d, 0x22, 0x33, 0x1e, 0x10, 0x04, 0x33, 0x33, 0x58, 0x33,
-    0x4f, 0x58, 0x58, 0x58, 0x3a, 0x46, 0x66, 0x58, 0x58, 0x24, 0x67, 0x5a,
-    0x27, 0x06, 0x1c, 0x05, 0x05, 0x3f, 0x13, 0x1b, 0x2b, 0x05, 0x13, 0x29,
-    0x67, 0x7b, 0x73, 0x1d, 0x05, 0x03, 0x03, 0x01, 0x86, 0x23, 0x13, 0x23,
-    0x6c, 0x50, 0x15, 0x01, 0x49, 0x54, 0x49, 0x12, 0x15, 0x1b, 0x11, 0x06,
-    0x05, 0x1a, 0x6a, 0x76, 0x71, 0x3d, 0x71, 0x23, 0x1b, 0xab, 0x6c, 0x94,
-    0x7a, 0x54, 0x1f, 0x12, 0x3e, 0x3e, 0x4b, 0x27, 0x4b, 0x90, 0x61, 0x36,
-    0x83, 0x71, 0x8f, 0x94, 0x8c, 0x71, 0x77, 0x3e, 0x55, 0x7a, 0x9a, 0x7a,
-    0x9c, 0x15, 0x0e, 0x0b, 0x5e, 0x85, 0x1a, 0x3e, 0xa9, 0x83, 0x8d, 0x71,
-    0x23, 0x6a, 0x97, 0x7e, 0x69, 0x2c, 0x0b, 0x02, 0x0b, 0x1f, 0x05, 0x08,
-    0x06, 0x05, 0x05, 0x2c, 0x03, 0x11, 0x6a, 0x8d, 0x5c, 0xa5, 0x34, 0x03,
-    0x08, 0x44, 0x51, 0x8d, 0x8d, 0x9c, 0xa2, 0xaf, 0x8c, 0x8d, 0xb1, 0xa2,
-    0xa9, 0xb5, 0xaf, 0xaf, 0xa1, 0x90, 0x65, 0x77, 0x26, 0x26, 0x71, 0x7e,
-    0x90, 0x85, 0xb1, 0x9c, 0x9a, 0x6a, 0xb0, 0xaf, 0x7e, 0x61, 0x65, 0x4b,
-    0x2d, 0x5c, 0x41, 0x54, 0x51, 0x5c, 0x7e, 0x69, 0x6e, 0x71, 0x71, 0x6e,
-    0x4b, 0x77, 0x85, 0x36, 0x5f, 0x16, 0x08, 0x0a, 0x0b, 0x0c, 0x0e, 0x0b,
-    0x0b, 0x15, 0x0f, 0x0b, 0x15, 0x06, 0x04, 0x0b, 0x15, 0x11, 0x08, 0x55,
-    0x3e, 0x55, 0x61, 0x5f, 0x4b, 0x36, 0x13, 0x1f, 0x65, 0x26, 0x06, 0x1f,
-    0x54, 0x49, 0x3e, 0x5e, 0x75, 0x76, 0x69, 0x3e, 0x0b, 0x0e, 0x06, 0x05,
-    0x05, 0x0f, 0x6c, 0x2d, 0x1d, 0x23, 0x2c, 0x1d, 0x0c, 0x16, 0x0b, 0x25,
-    0x1c, 0x0b, 0x04, 0x23, 0x36, 0x18, 0x36, 0x49, 0x23, 0x1b, 0x1d, 0x23,
-    0x49, 0x67, 0x23, 0x1d, 0x1b, 0x14, 0x13, 0x27, 0x24, 0x42, 0x20, 0x20,
-    0x13, 0x07, 0x04, 0x3d, 0x1b, 0x0c, 0x04, 0x12, 0x0c, 0x01, 0x01, 0x01,
-    0x04, 0x07, 0x02, 0x01, 0x01, 0x01, 0x01, 0x07, 0x05, 0x07, 0x24, 0x1e,
-    0x05, 0x04, 0x0d, 0x14, 0x10, 0x2a, 0x17, 0x22, 0x33, 0x01, 0x02, 0x04,
-    0x07, 0x02, 0x01, 0x07, 0x09, 0x2f, 0x40, 0x3c, 0x40, 0x40, 0x2e, 0x28,
-    0x07, 0x01, 0x01, 0x01, 0x02, 0x28, 0x4d, 0x4d, 0x3c, 0x4f, 0x3a, 0x22,
-    0x4d, 0x3a, 0x2a, 0x09, 0x0c, 0x3a, 0x46, 0x3a, 0x33, 0x4f, 0x53, 0x46,
-    0x5a, 0x66, 0x58, 0x58, 0x42, 0x4f, 0x70, 0x53, 0x20, 0x07, 0x15, 0x01,
-    0x04, 0x67, 0x0c, 0x14, 0x0c, 0x06, 0x31, 0x67, 0x87, 0x7b, 0x87, 0x20,
-    0x04, 0x04, 0x03, 0x14, 0x5b, 0x31, 0x35, 0x05, 0x06, 0x26, 0x20, 0x0b,
-    0x54, 0x6c, 0x49, 0x3b, 0x1c, 0x75, 0x54, 0x13, 0x0b, 0x11, 0x0c, 0x1a,
-    0x1c, 0x2c, 0x26, 0x15, 0x59, 0x3d, 0x06, 0x3e, 0x2d, 0x4b, 0x49, 0x8c,
-    0x8f, 0x83, 0x8c, 0x36, 0x36, 0x59, 0x77, 0x7e, 0x6a, 0x54, 0x8c, 0x8c,
-    0x8c, 0x3e, 0x61, 0x3e, 0x0b, 0x94, 0x6a, 0x7e, 0xa2, 0x7e, 0x0b, 0x05,
-    0x0c, 0x3e, 0x8c, 0x98, 0x94, 0xa9, 0x3e, 0x15, 0x85, 0x8c, 0x69, 0x7e,
-    0x77, 0x83, 0x98, 0x44, 0x34, 0x65, 0x06, 0x05, 0x05, 0x0b, 0x15, 0x4b,
-    0x0b, 0x02, 0x85, 0x69, 0x65, 0x59, 0x55, 0x13, 0x05, 0x1f, 0x8d, 0x69,
-    0x69, 0x9c, 0x9c, 0x9c, 0x8d, 0x94, 0x8c, 0x8c, 0xa9, 0xb5, 0xb5, 0xa2,
-    0x8d, 0xb1, 0x85, 0x8d, 0xb1, 0x5c, 0x3e, 0xab, 0xa2, 0xa5, 0x98, 0xa2,
-    0xa5, 0x7e, 0x85, 0x8d, 0x71, 0x6e, 0x5f, 0x77, 0x77, 0xaf, 0x98, 0x9c,
-    0x94, 0x9c, 0x9c, 0x83, 0x71, 0x2c, 0x69, 0x4b, 0x51, 0x71, 0x3e, 0x71,
-    0x7e, 0x9c, 0x65, 0x77, 0x8d, 0x5f, 0x55, 0x5e, 0x7f, 0x94, 0x8d, 0x6a,
-    0x36, 0x69, 0x94, 0x9c, 0x9c, 0x6a, 0x3e, 0x54, 0x85, 0x69, 0x6a, 0x38,
-    0x4b, 0x5f, 0x55, 0x06, 0x12, 0x11, 0x1a, 0x1f, 0x15, 0x36, 0x1a, 0x1d,
-    0x3e, 0x27, 0x23, 0x1f, 0x1c, 0x2d, 0x36, 0x15, 0x06, 0x01, 0x06, 0x14,
-    0x4b, 0x36, 0x1d, 0x36, 0x1b, 0x15, 0x0c, 0x15, 0x0c, 0x15, 0x0b, 0x1f,
-    0x3d, 0x31, 0x23, 0x3d, 0x1f, 0x14, 0x0c, 0x23, 0x20, 0x3f, 0x29, 0x35,
-    0x15, 0x1d, 0x23, 0x1b, 0x14, 0x20, 0x15, 0x1b, 0x1c, 0x1b, 0x20, 0x07,
-    0x06, 0x12, 0x10, 0x05, 0x0c, 0x0b, 0x0c, 0x04, 0x04, 0x07, 0x01, 0x01,
-    0x06, 0x01, 0x06, 0x14, 0x03, 0x04, 0x06, 0x28, 0x10, 0x07, 0x10, 0x0c,
-    0x17, 0x1e, 0x10, 0x1e, 0x04, 0x01, 0x02, 0x07, 0x07, 0x04, 0x02, 0x01,
-    0x04, 0x28, 0x2e, 0x40, 0x3c, 0x3c, 0x2e, 0x17, 0x14, 0x01, 0x01, 0x01,
-    0x02, 0x10, 0x40, 0x40, 0x3a, 0x28, 0x4d, 0x2e, 0x4d, 0x4d, 0x2e, 0x14,
-    0x04, 0x28, 0x1e, 0x4f, 0x58, 0x46, 0x46, 0x5a, 0x33, 0x5a, 0x58, 0x63,
-    0x46, 0x66, 0x66, 0x33, 0x12, 0x05, 0x03, 0x03, 0x07, 0x49, 0x0c, 0x05,
-    0x03, 0x0c, 0x20, 0x87, 0x7b, 0x87, 0x73, 0x13, 0x05, 0x05, 0x0b, 0x73,
-    0x5b, 0x3d, 0x49, 0x03, 0x01, 0x04, 0x1c, 0x06, 0x2b, 0x27, 0x6c, 0x5e,
-    0x36, 0x5b, 0x4b, 0x4b, 0x13, 0x01, 0x11, 0x12, 0x4b, 0x2d, 0x2d, 0x1f,
-    0x20, 0x05, 0x01, 0x0b, 0x26, 0x76, 0x1c, 0x8f, 0x8f, 0x83, 0x77, 0x5f,
-    0x4b, 0xa5, 0x7a, 0x75, 0x85, 0x51, 0x59, 0x7a, 0x7e, 0x51, 0x8c, 0x6a,
-    0x05, 0x34, 0x9a, 0x26, 0x34, 0x77, 0x5c, 0x26, 0x4b, 0x6a, 0x6a, 0xa9,
-    0x8c, 0xa5, 0xa9, 0x0e, 0x1f, 0x8c, 0x41, 0x13, 0x51, 0x83, 0x8d, 0x07,
-    0x11, 0x3e, 0x1f, 0x05, 0x06, 0x65, 0x34, 0x51, 0x74, 0x03, 0x47, 0x5e,
-    0x5c, 0xa6, 0x5c, 0x3e, 0x0e, 0x0e, 0x7e, 0x7e, 0x8d, 0x6a, 0x97, 0x90,
-    0xb5, 0xb5, 0xa9, 0xa2, 0xa9, 0x9e, 0xa9, 0x8c, 0xa9, 0xa2, 0x6a, 0x83,
-    0xa2, 0xa9, 0x77, 0x94, 0xa2, 0xa9, 0x71, 0x9c, 0x8d, 0x9c, 0x8d, 0x9c,
-    0x9c, 0x85, 0x8d, 0x77, 0x65, 0xb3, 0x9c, 0x83, 0x9c, 0xaf, 0xac, 0x9c,
-    0x54, 0xb1, 0xa5, 0x9c, 0xa5, 0x83, 0x8d, 0x9c, 0x9c, 0x77, 0x7a, 0x98,
-    0x71, 0x65, 0x1f, 0x16, 0x21, 0x1a, 0x26, 0x69, 0x5e, 0x7a, 0x85, 0x83,
-    0x83, 0x4b, 0x7e, 0x69, 0x4b, 0x36, 0x1f, 0x12, 0x13, 0x1f, 0x1a, 0x1f,
-    0x15, 0x15, 0x23, 0x1b, 0x1c, 0x1f, 0x15, 0x08, 0x02, 0x2d, 0x69, 0x27,
-    0x0e, 0x21, 0x26, 0x1a, 0x84, 0x31, 0x15, 0x06, 0x05, 0x1c, 0x26, 0x1c,
-    0x25, 0x3e, 0x07, 0x11, 0x20, 0x13, 0x12, 0x3e, 0x1d, 0x31, 0x23, 0x0c,
-    0x27, 0x35, 0x1b, 0x1b, 0x23, 0x3d, 0x42, 0x50, 0x27, 0x14, 0x1a, 0x0e,
-    0x2a, 0x2a, 0x1e, 0x3f, 0x18, 0x20, 0x29, 0x20, 0x06, 0x07, 0x10, 0x14,
-    0x1e, 0x06, 0x14, 0x06, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x05, 0x0c,
-    0x05, 0x02, 0x02, 0x0c, 0x1e, 0x28, 0x06, 0x07, 0x10, 0x14, 0x10, 0x07,
-    0x01, 0x01, 0x04, 0x10, 0x04, 0x07, 0x04, 0x01, 0x02, 0x09, 0x17, 0x2e,
-    0x22, 0x22, 0x2f, 0x3a, 0x2e, 0x17, 0x02, 0x01, 0x03, 0x04, 0x46, 0x14,
-    0x1e, 0x4d, 0x4d, 0x3c, 0x2e, 0x58, 0x4d, 0x0c, 0x10, 0x3a, 0x33, 0x58,
-    0x4d, 0x3a, 0x4f, 0x46, 0x58, 0x46, 0x4f, 0x66, 0x33, 0x63, 0x42, 0x07,
-    0x03, 0x01, 0x01, 0x01, 0x06, 0x20, 0x12, 0x05, 0x01, 0x03, 0x0c, 0x7b,
-    0x73, 0x7b, 0x67, 0x0c, 0x05, 0x03, 0x1f, 0x64, 0x31, 0x54, 0x54, 0x05,
-    0x01, 0x01, 0x06, 0x05, 0x1a, 0x61, 0x5e, 0x64, 0x31, 0x7a, 0x54, 0x54,
-    0x1a, 0x06, 0x0b, 0x11, 0x3d, 0x1c, 0x16, 0x15, 0x15, 0x0b, 0x03, 0x03,
-    0x26, 0x21, 0x0b, 0x7e, 0x8c, 0x61, 0x75, 0x71, 0x36, 0x8c, 0xa8, 0x83,
-    0x7e, 0x36, 0x7e, 0x7e, 0x6a, 0x8c, 0xa2, 0x77, 0x1f, 0x2c, 0x94, 0x7e,
-    0x04, 0x54, 0x8d, 0x77, 0x65, 0x55, 0x26, 0x51, 0x71, 0x83, 0x90, 0x69,
-    0x0b, 0x55, 0x34, 0x4b, 0x47, 0x71, 0x34, 0x05, 0x01, 0x4b, 0x6e, 0x06,
-    0x05, 0x5c, 0x2d, 0xa5, 0x65, 0x08, 0x06, 0x8d, 0x65, 0x0b, 0x7e, 0x7e,
-    0x7e, 0x1f, 0x85, 0xa9, 0x85, 0xa6, 0x85, 0x7e, 0x9a, 0xa2, 0xa9, 0x9a,
-    0xa2, 0xa2, 0x7e, 0x8c, 0x9a, 0x8d, 0x71, 0x8d, 0x77, 0x94, 0x90, 0x90,
-    0x7e, 0x71, 0x8d, 0x8d, 0x8d, 0xa9, 0xa9, 0xb5, 0x8d, 0x77, 0xa9, 0x7e,
-    0x6e, 0x85, 0x9a, 0xa9, 0x71, 0x98, 0x71, 0x5c, 0xac, 0xaf, 0x5c, 0x83,
-    0x94, 0x77, 0x85, 0x83, 0x84, 0x94, 0x85, 0x61, 0x77, 0x83, 0x71, 0x51,
-    0x71, 0x2d, 0x2c, 0x85, 0x61, 0x21, 0x2c, 0x3e, 0x5f, 0x3e, 0x34, 0x6a,
-    0x26, 0x71, 0x5e, 0x36, 0x5e, 0x3e, 0x21, 0x15, 0x2d, 0x1f, 0x69, 0x7a,
-    0x6a, 0x36, 0x16, 0x0b, 0x05, 0x15, 0x0f, 0x26, 0x26, 0x0c, 0x1a, 0x3e,
-    0x7a, 0x50, 0x36, 0x06, 0x05, 0x01, 0x12, 0x2a, 0x1f, 0x1b, 0x12, 0x1c,
-    0x15, 0x0b, 0x1b, 0x3d, 0x15, 0x2a, 0x15, 0x0b, 0x20, 0x64, 0x4c, 0x31,
-    0x73, 0x3d, 0x5b, 0x5b, 0x1d, 0x18, 0x0c, 0x0f, 0x1c, 0x24, 0x50, 0x35,
-    0x42, 0x14, 0x1b, 0x1b, 0x01, 0x01, 0x01, 0x0c, 0x3f, 0x2a, 0x04, 0x03,
-    0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x04, 0x04, 0x01, 0x01, 0x01,
-    0x17, 0x1e, 0x04, 0x10, 0x06, 0x04, 0x06, 0x0c, 0x01, 0x07, 0x04, 0x10,
-    0x04, 0x07, 0x1b, 0x19, 0x04, 0x2e, 0x22, 0x17, 0x17, 0x2e, 0x40, 0x3a,
-    0x22, 0x2e, 0x07, 0x01, 0x01, 0x04, 0x3a, 0x07, 0x46, 0x4d, 0x4d, 0x4f,
-    0x28, 0x58, 0x4d, 0x10, 0x0c, 0x24, 0x2e, 0x33, 0x33, 0x46, 0x46, 0x4f,
-    0x58, 0x58, 0x4f, 0x3f, 0x42, 0x66, 0x20, 0x12, 0x05, 0x04, 0x01, 0x01,
-    0x27, 0x2a, 0x05, 0x0c, 0x0c, 0x05, 0x01, 0x3d, 0x7d, 0x73, 0x2d, 0x0b,
-    0x06, 0x05, 0x2d, 0x5b, 0x64, 0x86, 0x76, 0x12, 0x01, 0x01, 0x01, 0x06,
-    0x1a, 0x8f, 0x5e, 0x64, 0x23, 0x5b, 0x76, 0x76, 0x11, 0x1c, 0x0b, 0x04,
-    0x05, 0x13, 0x2d, 0x21, 0x06, 0x05, 0x05, 0x05, 0x3e, 0x12, 0x05, 0x1a,
-    0x54, 0x8c, 0x8c, 0x65, 0x1f, 0x5e, 0x8c, 0x69, 0x6a, 0x5c, 0x6a, 0xa1,
-    0x65, 0x94, 0xa1, 0x71, 0x6e, 0x94, 0x9c, 0xa9, 0x36, 0x16, 0x97, 0x77,
-    0x55, 0x0b, 0x01, 0x2c, 0x85, 0x6a, 0x77, 0x71, 0x6a, 0x36, 0x85, 0x2c,
-    0x3e, 0x1f, 0x4b, 0x11, 0x05, 0x0e, 0x69, 0x1f, 0x05, 0x65, 0x1f, 0x5c,
-    0x0b, 0x16, 0x2c, 0x27, 0x65, 0x01, 0x03, 0x7f, 0xa9, 0x8d, 0x7e, 0xa2,
-    0x97, 0x8c, 0xa2, 0xb1, 0xb7, 0x8d, 0x7e, 0x85, 0x7e, 0x90, 0x9c, 0x9a,
-    0x8c, 0x7e, 0x85, 0x9a, 0x6a, 0x9a, 0x9a, 0x77, 0x97, 0x8d, 0x98, 0x90,
-    0xa9, 0xb0, 0xa9, 0xaf, 0x8c, 0xa2, 0xa2, 0x9a, 0x77, 0x7e, 0x7e, 0x85,
-    0x4b, 0x65, 0x5c, 0x8d, 0x9c, 0x65, 0x65, 0x85, 0x85, 0x85, 0x7e, 0x9c,
-    0x94, 0x83, 0x69, 0x71, 0x77, 0x77, 0xa5, 0xb0, 0xbc, 0x6a, 0x94, 0x9c,
-    0x9c, 0x5e, 0x3e, 0x3e, 0x34, 0x3e, 0x77, 0x9c, 0x55, 0x5e, 0x85, 0x77,
-    0x69, 0x26, 0x34, 0x27, 0x3e, 0x1f, 0x2d, 0x5f, 0x51, 0x2d, 0x11, 0x06,
-    0x11, 0x0b, 0x0b, 0x21, 0x15, 0x16, 0x20, 0x69, 0x5b, 0x7a, 0x20, 0x1f,
-    0x27, 0x1c, 0x05, 0x06, 0x21, 0x13, 0x0b, 0x1f, 0x15, 0x13, 0x15, 0x25,
-    0x12, 0x1b, 0x27, 0x0c, 0x2b, 0x2a, 0x31, 0x1f, 0x3d, 0x1b, 0x20, 0x50,
-    0x27, 0x1b, 0x20, 0x06, 0x25, 0x14, 0x14, 0x2a, 0x31, 0x1b, 0x0b, 0x12,
-    0x03, 0x01, 0x01, 0x01, 0x20, 0x1e, 0x14, 0x01, 0x01, 0x02, 0x01, 0x01,
-    0x01, 0x02, 0x00, 0x01, 0x07, 0x03, 0x05, 0x01, 0x10, 0x1e, 0x09, 0x19,
-    0x07, 0x04, 0x05, 0x10, 0x04, 0x07, 0x0c, 0x07, 0x06, 0x10, 0x04, 0x09,
-    0x07, 0x22, 0x3c, 0x3c, 0x22, 0x17, 0x1e, 0x22, 0x3c, 0x2e, 0x2e, 0x01,
-    0x01, 0x01, 0x09, 0x14, 0x58, 0x40, 0x4d, 0x3a, 0x3a, 0x58, 0x58, 0x1b,
-    0x12, 0x17, 0x4f, 0x3a, 0x3f, 0x46, 0x4f, 0x5a, 0x4f, 0x5a, 0x58, 0x28,
-    0x67, 0x4f, 0x06, 0x29, 0x06, 0x0b, 0x01, 0x01, 0x12, 0x29, 0x05, 0x1b,
-    0x1d, 0x05, 0x0c, 0x20, 0x3d, 0x87, 0x13, 0x05, 0x01, 0x06, 0x42, 0x78,
-    0x6c, 0x31, 0x78, 0x49, 0x03, 0x03, 0x03, 0x05, 0x06, 0x64, 0x64, 0x81,
-    0x2d, 0x6c, 0x6c, 0x1a, 0x06, 0x34, 0x23, 0x05, 0x05, 0x0e, 0x55, 0x06,
-    0x03, 0x05, 0x05, 0x05, 0x11, 0x0e, 0x03, 0x0b, 0x3e, 0x7a, 0x77, 0x55,
-    0x1f, 0x36, 0x6a, 0x54, 0x8d, 0x8c, 0x61, 0x94, 0x9c, 0xaf, 0x9c, 0x61,
-    0x6e, 0x61, 0x47, 0xa5, 0x94, 0x1f, 0x7e, 0x9a, 0x9c, 0x3e, 0x16, 0x5c,
-    0x77, 0xa8, 0xa2, 0x83, 0x8c, 0x1a, 0x2d, 0x26, 0x05, 0x03, 0x1f, 0x5c,
-    0x0b, 0x1f, 0x34, 0x7e, 0x1f, 0x4b, 0x1f, 0x0b, 0x55, 0x85, 0x98, 0x2c,
-    0x6e, 0x2c, 0x03, 0x26, 0xb1, 0xa2, 0xa9, 0xac, 0xa9, 0x90, 0x8d, 0x9c,
-    0xa2, 0xa2, 0xa2, 0xa9, 0x8d, 0x8d, 0xa2, 0xa9, 0xb5, 0x90, 0x8d, 0x71,
-    0x7e, 0x77, 0x85, 0x71, 0x34, 0x65, 0x94, 0x90, 0xba, 0xb5, 0xb5, 0xaf,
-    0xa9, 0xaf, 0xa9, 0x8c, 0x9a, 0xa9, 0x9a, 0x77, 0x5f, 0x94, 0x8d, 0x8d,
-    0x55, 0x65, 0x61, 0x5c, 0x71, 0x94, 0x94, 0x65, 0x5c, 0x55, 0x71, 0x97,
-    0xac, 0xac, 0xaf, 0xb5, 0xa8, 0x9c, 0x9c, 0x8c, 0x9c, 0x94, 0x4b, 0x4b,
-    0x61, 0x4b, 0x76, 0x71, 0x5e, 0x7e, 0x69, 0x3e, 0x21, 0x3e, 0x4b, 0x69,
-    0x54, 0x4b, 0x4b, 0x5e, 0x15, 0x1f, 0x1f, 0x16, 0x21, 0x15, 0x13, 0x26,
-    0x2d, 0x15, 0x23, 0x49, 0x3d, 0x69, 0x54, 0x23, 0x76, 0x76, 0x23, 0x0b,
-    0x03, 0x0b, 0x11, 0x0b, 0x1a, 0x27, 0x13, 0x06, 0x0b, 0x12, 0x1c, 0x0b,
-    0x1d, 0x23, 0x20, 0x1d, 0x13, 0x0c, 0x0b, 0x20, 0x2a, 0x42, 0x3d, 0x1b,
-    0x15, 0x18, 0x10, 0x20, 0x31, 0x1e, 0x10, 0x14, 0x14, 0x03, 0x02, 0x01,
-    0x01, 0x06, 0x12, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x0b, 0x07, 0x01, 0x01, 0x02, 0x17, 0x17, 0x17, 0x07, 0x06, 0x04, 0x17,
-    0x07, 0x07, 0x14, 0x07, 0x06, 0x09, 0x03, 0x01, 0x04, 0x2f, 0x3c, 0x3c,
-    0x3c, 0x3a, 0x2e, 0x22, 0x1e, 0x17, 0x28, 0x04, 0x01, 0x01, 0x17, 0x22,
-    0x28, 0x2f, 0x46, 0x3a, 0x4d, 0x58, 0x52, 0x24, 0x10, 0x1e, 0x3a, 0x46,
-    0x46, 0x3a, 0x4f, 0x63, 0x66, 0x67, 0x66, 0x35, 0x58, 0x35, 0x07, 0x33,
-    0x04, 0x03, 0x01, 0x01, 0x0b, 0x29, 0x06, 0x0c, 0x03, 0x03, 0x1d, 0x54,
-    0x0c, 0x64, 0x05, 0x05, 0x01, 0x15, 0x54, 0x73, 0x6c, 0x03, 0x1f, 0x49,
-    0x1d, 0x01, 0x03, 0x05, 0x05, 0x64, 0x8a, 0x8a, 0x4b, 0x49, 0x49, 0x06,
-    0x2d, 0x26, 0x3e, 0x05, 0x05, 0x05, 0x11, 0x05, 0x01, 0x03, 0x03, 0x03,
-    0x01, 0x03, 0x03, 0x05, 0x3e, 0x71, 0x54, 0x51, 0x2d, 0x69, 0x94, 0x83,
-    0x7e, 0x94, 0x85, 0x71, 0xb0, 0xaf, 0xb5, 0xa8, 0x71, 0x5e, 0x05, 0x26,
-    0x9a, 0x71, 0x85, 0xa2, 0x9b, 0xa2, 0x8d, 0x94, 0x7e, 0x61, 0xa9, 0x9a,
-    0x94, 0x2c, 0x0b, 0x05, 0x05, 0x05, 0x08, 0x8d, 0x13, 0x1c, 0x41, 0xb5,
-    0x85, 0x6e, 0x34, 0x3e, 0x8d, 0x9c, 0xa6, 0x5c, 0x69, 0x44, 0x05, 0x16,
-    0xbb, 0xa2, 0xa2, 0x9c, 0x9a, 0x90, 0xa2, 0x98, 0x9a, 0x8d, 0x94, 0xb1,
-    0xb1, 0x9a, 0x9a, 0xa5, 0x9a, 0x8c, 0x9c, 0x94, 0x94, 0x6a, 0x65, 0x97,
-    0x0b, 0x16, 0x7e, 0x85, 0x9a, 0xa2, 0xa9, 0x8c, 0x9d, 0xaf, 0xb1, 0x85,
-    0xa2, 0xb5, 0xa2, 0x9a, 0x6a, 0x71, 0x6e, 0x77, 0x77, 0x8d, 0x97, 0x97,
-    0x5c, 0x5c, 0x27, 0x71, 0x8c, 0x8c, 0x8d, 0x8c, 0x94, 0x9c, 0xab, 0xb0,
-    0xab, 0xa5, 0x94, 0x9c, 0xab, 0x9b, 0x94, 0x77, 0x77, 0x6a, 0x77, 0x83,
-    0x84, 0x55, 0x2c, 0x4b, 0x4b, 0x5e, 0x83, 0x69, 0x3e, 0x4b, 0x5c, 0x49,
-    0x1f, 0x55, 0x1f, 0x36, 0x3e, 0x4b, 0x2d, 0x26, 0x26, 0x12, 0x15, 0x49,
-    0x1f, 0x20, 0x54, 0x3e, 0x69, 0x84, 0x3d, 0x36, 0x0c, 0x0c, 0x06, 0x0b,
-    0x12, 0x27, 0x1c, 0x12, 0x0b, 0x0b, 0x1c, 0x06, 0x0c, 0x07, 0x23, 0x1b,
-    0x12, 0x1f, 0x13, 0x29, 0x35, 0x53, 0x67, 0x31, 0x23, 0x29, 0x24, 0x50,
-    0x31, 0x2a, 0x2a, 0x1e, 0x2a, 0x15, 0x04, 0x04, 0x01, 0x10, 0x0c, 0x00,
-    0x01, 0x01, 0x03, 0x01, 0x0c, 0x07, 0x01, 0x01, 0x03, 0x07, 0x01, 0x01,
-    0x01, 0x01, 0x0c, 0x07, 0x01, 0x09, 0x07, 0x07, 0x07, 0x07, 0x14, 0x09,
-    0x0c, 0x07, 0x04, 0x04, 0x01, 0x2e, 0x3c, 0x3c, 0x40, 0x3a, 0x40, 0x3c,
-    0x17, 0x17, 0x14, 0x06, 0x01, 0x01, 0x22, 0x2e, 0x2e, 0x3c, 0x3a, 0x40,
-    0x4d, 0x4d, 0x58, 0x2a, 0x0d, 0x1e, 0x46, 0x3f, 0x2e, 0x42, 0x4f, 0x53,
-    0x58, 0x63, 0x5a, 0x53, 0x5a, 0x24, 0x1b, 0x23, 0x03, 0x01, 0x01, 0x01,
-    0x06, 0x0b, 0x1b, 0x2d, 0x03, 0x01, 0x06, 0x12, 0x05, 0x1b, 0x03, 0x03,
-    0x03, 0x23, 0x6f, 0x7d, 0x73, 0x0f, 0x01, 0x15, 0x3d, 0x15, 0x06, 0x08,
-    0x11, 0x3d, 0x9b, 0x78, 0x3d, 0x3e, 0x15, 0x23, 0x69, 0x1f, 0x23, 0x1f,
-    0x0b, 0x05, 0x05, 0x15, 0x15, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x05,
-    0x1f, 0x54, 0x65, 0x3e, 0x4b, 0x6a, 0x9a, 0x8c, 0x8c, 0x77, 0x83, 0x85,
-    0xb1, 0xab, 0xb5, 0xb5, 0x85, 0x9c, 0x16, 0x02, 0x4b, 0x9c, 0x94, 0x8c,
-    0xa5, 0xb5, 0xab, 0xaf, 0x9a, 0x36, 0x77, 0xa2, 0xa9, 0x85, 0x77, 0x0b,
-    0x06, 0x1f, 0x21, 0x85, 0x08, 0x21, 0x2c, 0x9a, 0xa5, 0x9a, 0x5f, 0x6e,
-    0x1a, 0x4b, 0x74, 0x7e, 0x65, 0x08, 0x05, 0x16, 0xb7, 0x9c, 0x9a, 0xac,
-    0x9a, 0xa9, 0xaf, 0xb5, 0xb5, 0xa5, 0x9a, 0xa2, 0xa2, 0x9c, 0xb1, 0xa9,
-    0xa9, 0xa2, 0x90, 0xb1, 0xb5, 0xb1, 0x85, 0x7e, 0x08, 0x05, 0x65, 0xa6,
-    0xa2, 0xa9, 0x9a, 0x9c, 0x85, 0xa9, 0xa2, 0x8c, 0xa9, 0xb0, 0xa5, 0xa2,
-    0x85, 0x7e, 0x85, 0x9c, 0x8d, 0x83, 0xa5, 0x71, 0xa2, 0x6a, 0x8d, 0xb0,
-    0xb5, 0x9c, 0x8d, 0x77, 0x55, 0x77, 0xa5, 0xb0, 0xb0, 0xb0, 0xa5, 0xaf,
-    0xa2, 0xac, 0xb0, 0x94, 0x85, 0x77, 0x5f, 0x6a, 0x2c, 0x2d, 0x55, 0x75,
-    0x83, 0x8f, 0xb0, 0x83, 0x7a, 0x69, 0x71, 0x15, 0x2c, 0x55, 0x38, 0x1a,
-    0x27, 0x3e, 0x3e, 0x3e, 0x1c, 0x1c, 0x11, 0x20, 0x5e, 0x3e, 0x36, 0x15,
-    0x1b, 0x36, 0x21, 0x1f, 0x1d, 0x26, 0x03, 0x01, 0x05, 0x13, 0x21, 0x0c,
-    0x06, 0x15, 0x12, 0x05, 0x02, 0x05, 0x05, 0x15, 0x20, 0x15, 0x15, 0x23,
-    0x49, 0x50, 0x29, 0x15, 0x3d, 0x29, 0x50, 0x66, 0x49, 0x12, 0x0c, 0x06,
-    0x0c, 0x20, 0x20, 0x06, 0x06, 0x5a, 0x0c, 0x01, 0x01, 0x01, 0x01, 0x06,
-    0x33, 0x1b, 0x05, 0x05, 0x02, 0x01, 0x04, 0x01, 0x01, 0x01, 0x0c, 0x0c,
-    0x01, 0x14, 0x10, 0x04, 0x07, 0x09, 0x3a, 0x14, 0x09, 0x10, 0x14, 0x04,
-    0x04, 0x2f, 0x3c, 0x3c, 0x3c, 0x40, 0x3a, 0x3c, 0x22, 0x33, 0x09, 0x04,
-    0x02, 0x01, 0x22, 0x46, 0x4d, 0x3c, 0x46, 0x4d, 0x4d, 0x4d, 0x58, 0x28,
-    0x10, 0x1b, 0x33, 0x28, 0x46, 0x4f, 0x4d, 0x72, 0x46, 0x28, 0x29, 0x23,
-    0x28, 0x29, 0x0c, 0x06, 0x04, 0x05, 0x03, 0x01, 0x01, 0x03, 0x1a, 0x23,
-    0x0c, 0x01, 0x01, 0x04, 0x03, 0x12, 0x05, 0x03, 0x0b, 0x31, 0x64, 0x73,
-    0x54, 0x27, 0x03, 0x05, 0x1b, 0x7d, 0x5b, 0x0c, 0x1c, 0x15, 0x75, 0x5e,
-    0x3d, 0x51, 0x12, 0x61, 0x36, 0x1f, 0x1f, 0x3e, 0x11, 0x05, 0x01, 0x05,
-    0x4b, 0x4b, 0x0c, 0x03, 0x05, 0x01, 0x01, 0x05, 0x1f, 0x1f, 0x34, 0x36,
-    0x21, 0x47, 0x8c, 0xa1, 0xaf, 0xa1, 0x77, 0x5e, 0x6a, 0x43, 0x83, 0x94,
-    0x6a, 0x1f, 0x0b, 0x05, 0x1f, 0xa9, 0x8c, 0x85, 0x98, 0xb0, 0x90, 0xa2,
-    0xb5, 0x8d, 0x3e, 0xa2, 0x9c, 0x6a, 0x85, 0x2d, 0x26, 0x55, 0x65, 0x85,
-    0x4b, 0x0b, 0x34, 0x74, 0x83, 0xa9, 0x5f, 0x16, 0x05, 0x08, 0x26, 0x8d,
-    0x97, 0x15, 0x03, 0x1a, 0x9c, 0x9d, 0x8d, 0xb1, 0x9d, 0xb1, 0xb1, 0xa9,
-    0xb1, 0xa2, 0xa9, 0xaf, 0xa9, 0x94, 0xa2, 0xa9, 0xa8, 0x9c, 0xa9, 0xb5,
-    0xb5, 0x9a, 0x7e, 0x16, 0x08, 0x05, 0x5f, 0xb7, 0xb5, 0xa9, 0x77, 0x9a,
-    0xa2, 0x6a, 0xa5, 0xa6, 0x7e, 0x8d, 0x7e, 0x71, 0x85, 0x8d, 0x98, 0x8d,
-    0x9c, 0x74, 0xa8, 0x8c, 0x6e, 0x97, 0x8d, 0xaf, 0xb5, 0xa5, 0x71, 0x65,
-    0x5c, 0xa2, 0x8c, 0xa9, 0xb5, 0xb0, 0x94, 0xa9, 0xab, 0x94, 0x77, 0x5c,
-    0x71, 0x34, 0x36, 0x5e, 0x36, 0x85, 0x85, 0x75, 0x8c, 0xab, 0xa1, 0x83,
-    0x8a, 0x7e, 0x8c, 0x3e, 0x1f, 0x2d, 0x2b, 0x2c, 0x36, 0x1f, 0x2c, 0x1f,
-    0x0b, 0x1c, 0x0e, 0x27, 0x3e, 0x2c, 0x3e, 0x1f, 0x1c, 0x49, 0x25, 0x1f,
-    0x26, 0x12, 0x05, 0x01, 0x01, 0x05, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x06, 0x03, 0x01, 0x03, 0x15, 0x20, 0x20, 0x50, 0x35, 0x29, 0x20, 0x31,
-    0x23, 0x23, 0x42, 0x67, 0x3f, 0x06, 0x01, 0x01, 0x01, 0x42, 0x29, 0x04,
-    0x06, 0x2a, 0x07, 0x02, 0x01, 0x01, 0x01, 0x15, 0x2a, 0x14, 0x10, 0x04,
-    0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x0c, 0x14, 0x10, 0x07, 0x06, 0x10,
-    0x07, 0x04, 0x17, 0x10, 0x22, 0x10, 0x10, 0x01, 0x04, 0x2e, 0x3c, 0x40,
-    0x3c, 0x3c, 0x3c, 0x28, 0x2f, 0x17, 0x07, 0x01, 0x02, 0x01, 0x19, 0x3c,
-    0x33, 0x4d, 0x3a, 0x4d, 0x4d, 0x58, 0x46, 0x33, 0x07, 0x1b, 0x46, 0x3c,
-    0x33, 0x66, 0x2a, 0x2a, 0x42, 0x66, 0x29, 0x3f, 0x3d, 0x14, 0x10, 0x03,
-    0x25, 0x0c, 0x03, 0x01, 0x06, 0x29, 0x2d, 0x31, 0x2d, 0x04, 0x01, 0x1f,
-    0x12, 0x0b, 0x06, 0x05, 0x0c, 0x64, 0x06, 0x12, 0x1d, 0x1c, 0x0b, 0x03,
-    0x25, 0x9b, 0x6f, 0x12, 0x1c, 0x16, 0x3d, 0x6a, 0x61, 0x3d, 0x83, 0x54,
-    0x1c, 0x0f, 0x27, 0x71, 0x0b, 0x05, 0x01, 0x23, 0x4b, 0x2d, 0x0b, 0x05,
-    0x05, 0x01, 0x03, 0x11, 0x26, 0x34, 0x69, 0x7a, 0x26, 0x34, 0x8c, 0x94,
-    0x9b, 0x9c, 0x77, 0x5f, 0xa1, 0xa9, 0x83, 0xa2, 0x90, 0x3e, 0x05, 0x03,
-    0x1f, 0x90, 0x94, 0x94, 0x8c, 0x8c, 0x8c, 0x94, 0x8c, 0x9c, 0x71, 0x85,
-    0x85, 0x65, 0x97, 0x94, 0x61, 0x7f, 0x9c, 0x8d, 0xa5, 0x85, 0x4b, 0x74,
-    0x71, 0x8d, 0x0b, 0x0e, 0x11, 0x44, 0x0e, 0x74, 0xa6, 0x74, 0x0e, 0x21,
-    0xa9, 0x8d, 0x85, 0x98, 0x8d, 0xa2, 0xb1, 0xb1, 0xaf, 0xb1, 0xb5, 0xb5,
-    0xb1, 0xb1, 0xa9, 0xb5, 0xb1, 0xa9, 0xa9, 0xb1, 0xaf, 0xb5, 0x4b, 0x08,
-    0x06, 0x05, 0x5c, 0xa5, 0xb5, 0xa9, 0x98, 0xb1, 0x8d, 0x7e, 0x6e, 0x65,
-    0x85, 0xa9, 0x85, 0x8c, 0x7e, 0x9c, 0xb1, 0x61, 0x9c, 0xa2, 0x90, 0xa8,
-    0xa9, 0xb1, 0x94, 0x9a, 0x77, 0x7e, 0x8d, 0x7e, 0x85, 0x9c, 0xb1, 0x71,
-    0x83, 0xa2, 0x8c, 0xb0, 0x90, 0x9b, 0xa9, 0x9c, 0x6e, 0x1f, 0x3e, 0x5c,
-    0x8c, 0xa1, 0x8c, 0x7e, 0x84, 0xa8, 0xa5, 0x8c, 0xab, 0x83, 0x76, 0x77,
-    0x2c, 0x4b, 0x1f, 0x23, 0x27, 0x36, 0x23, 0x1c, 0x11, 0x06, 0x06, 0x1f,
-    0x76, 0x36, 0x23, 0x3e, 0x1f, 0x5e, 0x3d, 0x64, 0x2d, 0x03, 0x1f, 0x06,
-    0x05, 0x02, 0x01, 0x06, 0x1c, 0x03, 0x0b, 0x1b, 0x3d, 0x20, 0x20, 0x07,
-    0x31, 0x07, 0x05, 0x0f, 0x15, 0x29, 0x5b, 0x29, 0x31, 0x0c, 0x2a, 0x3d,
-    0x50, 0x42, 0x20, 0x04, 0x12, 0x1b, 0x1e, 0x01, 0x01, 0x14, 0x20, 0x01,
-    0x01, 0x05, 0x01, 0x07, 0x12, 0x17, 0x20, 0x07, 0x04, 0x05, 0x01, 0x01,
-    0x01, 0x02, 0x05, 0x04, 0x06, 0x01, 0x07, 0x1e, 0x10, 0x07, 0x10, 0x07,
-    0x1e, 0x09, 0x07, 0x07, 0x01, 0x22, 0x3a, 0x3c, 0x40, 0x3c, 0x2e, 0x28,
-    0x22, 0x0c, 0x04, 0x01, 0x01, 0x01, 0x04, 0x46, 0x2e, 0x2e, 0x46, 0x33,
-    0x3a, 0x46, 0x52, 0x3a, 0x04, 0x1e, 0x60, 0x62, 0x24, 0x10, 0x18, 0x2a,
-    0x28, 0x1e, 0x10, 0x17, 0x1b, 0x10, 0x0b, 0x05, 0x29, 0x1b, 0x01, 0x05,
-    0x29, 0x5b, 0x31, 0x50, 0x3d, 0x2a, 0x1a, 0x0c, 0x15, 0x06, 0x05, 0x03,
-    0x18, 0x7d, 0x0b, 0x04, 0x21, 0x23, 0x12, 0x13, 0x1f, 0x7a, 0x8a, 0x18,
-    0x15, 0x06, 0x2d, 0x61, 0x6a, 0x75, 0x54, 0x26, 0x0b, 0x11, 0x4b, 0x3e,
-    0x04, 0x05, 0x0b, 0x69, 0x4b, 0x11, 0x05, 0x05, 0x05, 0x05, 0x0b, 0x08,
-    0x3e, 0x6a, 0x3e, 0x5c, 0x13, 0x4b, 0x94, 0x94, 0x94, 0x94, 0x77, 0x69,
-    0x83, 0xa5, 0x71, 0x94, 0x9a, 0xab, 0x8d, 0x34, 0x2d, 0xb1, 0xab, 0xb1,
-    0xa1, 0xaf, 0x9a, 0x8c, 0x9a, 0x9a, 0x8d, 0x61, 0x1f, 0x0e, 0x1a, 0x9c,
-    0x85, 0x71, 0x8d, 0xa5, 0xba, 0xba, 0x8d, 0x3e, 0x47, 0x4b, 0x26, 0x4b,
-    0x71, 0x8d, 0x44, 0x16, 0x26, 0x74, 0x65, 0x26, 0xa6, 0xb7, 0x7e, 0x97,
-    0x8d, 0xb1, 0xa9, 0xb7, 0xb5, 0xb7, 0xba, 0xb7, 0xb1, 0xba, 0xa9, 0xb5,
-    0xb1, 0x9c, 0xa2, 0xb5, 0xb5, 0xb0, 0x34, 0x08, 0x05, 0x03, 0x6e, 0x9c,
-    0xa2, 0xa9, 0x98, 0xb7, 0x77, 0xa2, 0x88, 0x5c, 0xba, 0x8d, 0x77, 0x7e,
-    0xa2, 0xb0, 0xa5, 0x59, 0x9d, 0x98, 0x85, 0xa2, 0xa5, 0xa9, 0x9a, 0xb1,
-    0x9c, 0xa9, 0xa2, 0x83, 0x85, 0xa2, 0xa2, 0x9a, 0x55, 0x59, 0xa9, 0xaf,
-    0xac, 0x83, 0x77, 0x36, 0x1a, 0x5e, 0x26, 0x77, 0x61, 0x83, 0xab, 0x69,
-    0x94, 0x7a, 0x4b, 0xa1, 0xb0, 0x71, 0x55, 0x4c, 0x21, 0x2d, 0x0e, 0x15,
-    0x0b, 0x4b, 0x1f, 0x0b, 0x15, 0x0b, 0x0b, 0x2c, 0x36, 0x36, 0x49, 0x1c,
-    0x36, 0x3d, 0x5e, 0x31, 0x0b, 0x0b, 0x16, 0x15, 0x15, 0x3e, 0x06, 0x03,
-    0x0e, 0x4b, 0x20, 0x25, 0x3d, 0x25, 0x1b, 0x25, 0x0f, 0x12, 0x01, 0x12,
-    0x20, 0x13, 0x0c, 0x12, 0x0c, 0x12, 0x2b, 0x42, 0x42, 0x4c, 0x53, 0x50,
-    0x31, 0x04, 0x1b, 0x02, 0x02, 0x04, 0x14, 0x07, 0x01, 0x07, 0x1b, 0x10,
-    0x15, 0x06, 0x10, 0x07, 0x0c, 0x0b, 0x05, 0x04, 0x03, 0x05, 0x01, 0x05,
-    0x04, 0x05, 0x07, 0x10, 0x1e, 0x09, 0x10, 0x10, 0x10, 0x07, 0x10, 0x07,
-    0x04, 0x3a, 0x22, 0x2e, 0x3c, 0x2f, 0x2f, 0x3a, 0x10, 0x06, 0x01, 0x22,
-    0x14, 0x01, 0x01, 0x0d, 0x2e, 0x2e, 0x46, 0x40, 0x4d, 0x3c, 0x4d, 0x33,
-    0x04, 0x0c, 0x2e, 0x28, 0x33, 0x3a, 0x4d, 0x53, 0x58, 0x66, 0x42, 0x50,
-    0x2a, 0x20, 0x07, 0x0b, 0x3d, 0x0c, 0x05, 0x0c, 0x67, 0x50, 0x67, 0x67,
-    0x50, 0x12, 0x12, 0x73, 0x27, 0x05, 0x01, 0x01, 0x1f, 0x23, 0x15, 0x1a,
-    0x13, 0x81, 0x31, 0x13, 0x3e, 0x8a, 0x8a, 0x35, 0x0e, 0x15, 0x13, 0x5b,
-    0x54, 0x64, 0x4e, 0x11, 0x0b, 0x0b, 0x6c, 0x23, 0x05, 0x05, 0x08, 0x23,
-    0x1f, 0x05, 0x05, 0x05, 0x01, 0x1f, 0x4b, 0x06, 0x71, 0x94, 0x2d, 0x12,
-    0x1a, 0x94, 0x9c, 0xab, 0xb5, 0x9c, 0x94, 0x71, 0xb0, 0xb5, 0xb5, 0x1a,
-    0x8c, 0xa5, 0xa8, 0x83, 0x8d, 0xb0, 0xaf, 0x9a, 0xa2, 0xb0, 0xa2, 0x85,
-    0x9a, 0xa5, 0xaf, 0xb5, 0xa1, 0xac, 0x85, 0x4b, 0x5f, 0x6a, 0xb1, 0x85,
-    0x83, 0x5f, 0x5c, 0x77, 0xa6, 0xa6, 0x51, 0x51, 0x44, 0x65, 0xb1, 0x3e,
-    0x08, 0x11, 0x7f, 0x98, 0x97, 0x85, 0x8d, 0x6e, 0x98, 0xa6, 0x94, 0xb7,
-    0xb1, 0xb7, 0xb5, 0xb1, 0xb1, 0xba, 0xb7, 0x9a, 0xb5, 0xbb, 0xb5, 0xb5,
-    0xba, 0x94, 0x6a, 0x0b, 0x05, 0x32, 0x5e, 0x9d, 0xa2, 0x85, 0x77, 0xb1,
-    0xb1, 0x98, 0xb1, 0x9c, 0xb1, 0x85, 0x6e, 0x65, 0xb0, 0xb1, 0x9c, 0xb5,
-    0x6e, 0x71, 0x61, 0x8d, 0xb1, 0x9c, 0xaf, 0xaf, 0x94, 0xb5, 0xa5, 0x9c,
-    0x8c, 0x8d, 0xaf, 0xab, 0x8d, 0x97, 0x69, 0x51, 0x55, 0x36, 0x15, 0x4b,
-    0x3e, 0xa6, 0x49, 0x71, 0x54, 0x94, 0x84, 0x85, 0x6a, 0x5f, 0x7e, 0xb0,
-    0x9b, 0x5e, 0x4b, 0x61, 0x54, 0x5c, 0x1c, 0x0c, 0x21, 0x0c, 0x06, 0x11,
-    0x13, 0x16, 0x11, 0x2d, 0x3e, 0x2d, 0x2d, 0x16, 0x1a, 0x4b, 0x5e, 0x1f,
-    0x0b, 0x21, 0x0c, 0x15, 0x26, 0x50, 0x6f, 0x05, 0x01, 0x07, 0x20, 0x0e,
-    0x1a, 0x1c, 0x0b, 0x03, 0x02, 0x03, 0x01, 0x01, 0x0b, 0x1a, 0x12, 0x14,
-    0x0b, 0x06, 0x0c, 0x33, 0x18, 0x3d, 0x67, 0x67, 0x1b, 0x01, 0x0b, 0x04,
-    0x01, 0x15, 0x09, 0x2a, 0x03, 0x1d, 0x1b, 0x0c, 0x04, 0x04, 0x06, 0x0c,
-    0x10, 0x07, 0x06, 0x05, 0x01, 0x04, 0x06, 0x06, 0x07, 0x01, 0x01, 0x10,
-    0x24, 0x0d, 0x0b, 0x07, 0x0c, 0x04, 0x03, 0x01, 0x04, 0x40, 0x2e, 0x2f,
-    0x22, 0x33, 0x40, 0x24, 0x07, 0x0a, 0x17, 0x3c, 0x2e, 0x04, 0x01, 0x01,
-    0x1b, 0x46, 0x52, 0x52, 0x4d, 0x3c, 0x4d, 0x1e, 0x06, 0x0b, 0x4f, 0x46,
-    0x33, 0x58, 0x58, 0x66, 0x66, 0x63, 0x3f, 0x70, 0x5a, 0x24, 0x0c, 0x05,
-    0x3f, 0x06, 0x06, 0x1d, 0x3d, 0x64, 0x70, 0x31, 0x3d, 0x04, 0x20, 0x68,
-    0x0b, 0x03, 0x01, 0x01, 0x01, 0x04, 0x3e, 0x0e, 0x05, 0x31, 0x6f, 0x1d,
-    0x15, 0x75, 0x81, 0x81, 0x12, 0x1f, 0x25, 0x5b, 0x6f, 0x77, 0x1f, 0x1f,
-    0x26, 0x3e, 0x77, 0x13, 0x1f, 0x13, 0x05, 0x05, 0x05, 0x05, 0x3e, 0x1f,
-    0x03, 0x06, 0x8c, 0x4b, 0x75, 0xa1, 0x5c, 0x05, 0x5e, 0x9a, 0x9e, 0xaf,
-    0xb5, 0x9c, 0x89, 0x9c, 0x8d, 0xab, 0xb5, 0x71, 0x69, 0xa9, 0x94, 0xa2,
-    0x9c, 0xb5, 0x9a, 0xa1, 0x9a, 0xaf, 0xa2, 0x77, 0xa9, 0x90, 0xaf, 0xb1,
-    0x8d, 0x8c, 0x65, 0x05, 0x1f, 0x94, 0x8d, 0x77, 0x65, 0x74, 0x98, 0x71,
-    0x94, 0x97, 0x36, 0x16, 0x36, 0x8d, 0x6a, 0xb7, 0x2c, 0x0b, 0x51, 0xac,
-    0x8d, 0xa6, 0xa2, 0x9c, 0x74, 0xa9, 0xb1, 0xa9, 0x8d, 0xa9, 0xb7, 0xa9,
-    0xb1, 0xbb, 0x9a, 0xb1, 0xaf, 0xb5, 0xa9, 0xbb, 0xb1, 0x8d, 0xb1, 0x13,
-    0x08, 0x1a, 0x65, 0x2c, 0x8d, 0x5c, 0x9d, 0x97, 0x8d, 0xa5, 0xb1, 0x85,
-    0xa5, 0xa2, 0x6e, 0x85, 0xb1, 0xa2, 0xb1, 0xba, 0x9a, 0xb1, 0x97, 0x7e,
-    0x85, 0x94, 0xa9, 0x8c, 0xa2, 0xa8, 0xb0, 0x7e, 0x8d, 0xb0, 0x8c, 0x8d,
-    0x77, 0x5e, 0x65, 0x44, 0x4b, 0x2d, 0x6e, 0x9c, 0x51, 0x5c, 0x3e, 0x6a,
-    0x71, 0x84, 0x51, 0x71, 0x71, 0xab, 0x8d, 0x94, 0x7a, 0x71, 0x36, 0x4b,
-    0x69, 0x4b, 0x16, 0x2d, 0x15, 0x26, 0x11, 0x0a, 0x26, 0x15, 0x21, 0x2b,
-    0x23, 0x1f, 0x54, 0x23, 0x1f, 0x26, 0x1c, 0x06, 0x15, 0x15, 0x21, 0x1c,
-    0x0b, 0x3d, 0x3d, 0x16, 0x05, 0x01, 0x27, 0x15, 0x03, 0x0c, 0x0c, 0x0f,
-    0x2a, 0x2d, 0x06, 0x05, 0x05, 0x01, 0x05, 0x2a, 0x1b, 0x12, 0x0b, 0x07,
-    0x18, 0x24, 0x67, 0x23, 0x25, 0x01, 0x06, 0x0b, 0x02, 0x0c, 0x12, 0x12,
-    0x04, 0x14, 0x1b, 0x10, 0x2a, 0x15, 0x04, 0x12, 0x06, 0x07, 0x01, 0x01,
-    0x01, 0x03, 0x06, 0x04, 0x07, 0x01, 0x01, 0x07, 0x10, 0x05, 0x04, 0x06,
-    0x03, 0x02, 0x01, 0x02, 0x04, 0x3a, 0x22, 0x3c, 0x3c, 0x2e, 0x3a, 0x17,
-    0x03, 0x04, 0x22, 0x2f, 0x46, 0x2e, 0x01, 0x01, 0x04, 0x22, 0x28, 0x28,
-    0x46, 0x58, 0x22, 0x10, 0x04, 0x07, 0x28, 0x33, 0x66, 0x58, 0x63, 0x58,
-    0x66, 0x5a, 0x46, 0x63, 0x66, 0x23, 0x07, 0x05, 0x0c, 0x13, 0x05, 0x27,
-    0x42, 0x70, 0x7d, 0x10, 0x0b, 0x06, 0x1d, 0x3d, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x3d, 0x2d, 0x06, 0x13, 0x96, 0x54, 0x1f, 0x23, 0x8f, 0x8a,
-    0x3e, 0x01, 0x2b, 0x2d, 0x9b, 0x83, 0x2d, 0x1a, 0x27, 0x7a, 0x54, 0x4b,
-    0x7a, 0x3e, 0x01, 0x03, 0x05, 0x0b, 0x2d, 0x8c, 0x15, 0x05, 0x71, 0x8c,
-    0xa1, 0x9b, 0x6a, 0x16, 0x8c, 0xa1, 0xae, 0xaf, 0xaf, 0x9b, 0xa2, 0x89,
-    0x75, 0x71, 0x94, 0x90, 0x4e, 0x94, 0x54, 0x7e, 0x94, 0xa2, 0x9c, 0x8c,
-    0x98, 0x85, 0x90, 0x9a, 0xa2, 0xb5, 0x9a, 0x94, 0x8c, 0x9a, 0x16, 0x03,
-    0x34, 0x9c, 0x71, 0x77, 0x65, 0x7e, 0x8d, 0x47, 0xa9, 0x8d, 0x16, 0x26,
-    0x6e, 0x1c, 0x1f, 0x8d, 0x98, 0x5e, 0x47, 0xac, 0x98, 0x97, 0x85, 0x97,
-    0x8d, 0x9c, 0xb1, 0xb1, 0xb1, 0xb1, 0xa9, 0xb1, 0xb5, 0xaf, 0xb7, 0xb1,
-    0xb7, 0xb1, 0xb1, 0xb5, 0x97, 0xa9, 0xbb, 0x34, 0x0b, 0x0b, 0x5c, 0x34,
-    0x16, 0x4b, 0xa6, 0x6a, 0x74, 0xb5, 0x7e, 0x5c, 0xbb, 0x85, 0x85, 0xbf,
-    0x8d, 0xb7, 0x9a, 0xb5, 0x9a, 0xaf, 0xba, 0xb5, 0x94, 0x8c, 0x94, 0x83,
-    0x8d, 0x8c, 0x9a, 0x84, 0x77, 0x83, 0x69, 0x6e, 0x5f, 0x65, 0x65, 0x71,
-    0x5c, 0x6a, 0x6a, 0x85, 0x77, 0x69, 0x4b, 0x85, 0x69, 0x94, 0x83, 0x9c,
-    0x83, 0x85, 0x77, 0x69, 0x8c, 0x85, 0x69, 0x3e, 0x36, 0x3e, 0x2b, 0x2d,
-    0x16, 0x0b, 0x15, 0x2c, 0x1a, 0x21, 0x1f, 0x26, 0x21, 0x0e, 0x49, 0x6c,
-    0x36, 0x1a, 0x0b, 0x16, 0x15, 0x1f, 0x23, 0x15, 0x1c, 0x26, 0x1c, 0x1d,
-    0x2b, 0x02, 0x01, 0x02, 0x0b, 0x49, 0x3d, 0x2a, 0x25, 0x13, 0x14, 0x29,
-    0x3d, 0x1b, 0x0b, 0x01, 0x04, 0x13, 0x15, 0x13, 0x35, 0x07, 0x1b, 0x31,
-    0x14, 0x01, 0x1b, 0x0b, 0x01, 0x05, 0x0c, 0x06, 0x07, 0x23, 0x2a, 0x0c,
-    0x1b, 0x0b, 0x04, 0x10, 0x07, 0x10, 0x04, 0x03, 0x02, 0x03, 0x03, 0x04,
-    0x0c, 0x06, 0x01, 0x04, 0x03, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01,
-    0x04, 0x28, 0x2f, 0x3c, 0x3c, 0x3a, 0x17, 0x07, 0x01, 0x17, 0x46, 0x4d,
-    0x4d, 0x3c, 0x0d, 0x01, 0x01, 0x1b, 0x28, 0x22, 0x17, 0x1e, 0x18, 0x0c,
-    0x06, 0x07, 0x28, 0x58, 0x66, 0x58, 0x66, 0x53, 0x5a, 0x33, 0x63, 0x53,
-    0x66, 0x1d, 0x0c, 0x0c, 0x06, 0x20, 0x05, 0x23, 0x67, 0x67, 0x67, 0x23,
-    0x05, 0x04, 0x3d, 0x27, 0x01, 0x01, 0x03, 0x05, 0x05, 0x01, 0x23, 0x78,
-    0x1d, 0x1f, 0x78, 0x64, 0x36, 0x15, 0x68, 0x7a, 0x81, 0x13, 0x15, 0x05,
-    0x49, 0x1f, 0x15, 0x1a, 0x59, 0x69, 0x3d, 0x69, 0x7a, 0x54, 0x05, 0x05,
-    0x08, 0x05, 0x2d, 0x9b, 0x51, 0x13, 0x5e, 0xa1, 0xab, 0x94, 0x4b, 0x0b,
-    0xa2, 0xb0, 0xb0, 0xb0, 0x9a, 0xa8, 0xb0, 0x9a, 0x8c, 0xab, 0x94, 0xba,
-    0x9c, 0xb7, 0x94, 0x71, 0x85, 0x94, 0x94, 0x94, 0x8c, 0x9a, 0x90, 0xa9,
-    0xaf, 0xa9, 0x94, 0x9a, 0x9a, 0x94, 0x05, 0x05, 0x77, 0x9a, 0x61, 0x77,
-    0x9a, 0xb5, 0xa9, 0x77, 0x6e, 0x6e, 0x27, 0x74, 0x06, 0x03, 0x05, 0x06,
-    0x7f, 0x8d, 0x9d, 0xa5, 0xa6, 0x85, 0xb1, 0xa5, 0xa9, 0xb1, 0x9a, 0xb1,
-    0xb7, 0xa9, 0xb1, 0xa2, 0xb1, 0xba, 0xa2, 0xa2, 0xa9, 0xa9, 0xb1, 0x9c,
-    0xa6, 0xb1, 0xbb, 0x98, 0x1f, 0x11, 0x74, 0x74, 0x0e, 0x4b, 0xb1, 0xb1,
-    0x8d, 0xbf, 0xa6, 0x6e, 0x9d, 0x77, 0x9a, 0xac, 0xac, 0x90, 0x97, 0xb3,
-    0x8d, 0xb1, 0xb5, 0xb5, 0xba, 0xa2, 0xa2, 0xac, 0xb7, 0xb5, 0xa2, 0x9c,
-    0x65, 0x61, 0x74, 0x83, 0x7e, 0x8d, 0x8c, 0xb1, 0x8d, 0x85, 0x77, 0x8d,
-    0x77, 0x77, 0x83, 0x5f, 0x69, 0x8c, 0x94, 0x7a, 0x8c, 0x1a, 0x54, 0x94,
-    0x71, 0x54, 0x4b, 0x3e, 0x4b, 0x36, 0x26, 0x54, 0x2c, 0x08, 0x3e, 0x64,
-    0x34, 0x15, 0x0b, 0x11, 0x15, 0x05, 0x1f, 0x36, 0x26, 0x1c, 0x1a, 0x27,
-    0x1c, 0x1f, 0x15, 0x0b, 0x0c, 0x15, 0x23, 0x23, 0x0b, 0x0b, 0x05, 0x01,
-    0x05, 0x2d, 0x36, 0x15, 0x1d, 0x59, 0x49, 0x29, 0x5b, 0x49, 0x35, 0x1b,
-    0x01, 0x02, 0x01, 0x03, 0x15, 0x29, 0x31, 0x3f, 0x14, 0x06, 0x1b, 0x07,
-    0x06, 0x05, 0x06, 0x06, 0x0c, 0x1e, 0x1d, 0x0c, 0x07, 0x07, 0x02, 0x07,
-    0x07, 0x0b, 0x07, 0x01, 0x04, 0x07, 0x04, 0x07, 0x0c, 0x01, 0x02, 0x02,
-    0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x07, 0x3c, 0x40, 0x40,
-    0x3c, 0x28, 0x10, 0x01, 0x01, 0x2e, 0x40, 0x4d, 0x3c, 0x46, 0x2e, 0x04,
-    0x01, 0x02, 0x46, 0x3a, 0x28, 0x33, 0x14, 0x14, 0x07, 0x06, 0x46, 0x62,
-    0x66, 0x58, 0x58, 0x4f, 0x5a, 0x53, 0x66, 0x58, 0x53, 0x13, 0x15, 0x3f,
-    0x14, 0x1b, 0x04, 0x0c, 0x3d, 0x53, 0x3d, 0x23, 0x15, 0x0b, 0x49, 0x0b,
-    0x05, 0x01, 0x05, 0x13, 0x36, 0x05, 0x23, 0x86, 0x73, 0x49, 0x31, 0x4e,
-    0x54, 0x4e, 0x12, 0x5e, 0x96, 0x59, 0x11, 0x07, 0x0b, 0x0e, 0x0c, 0x36,
-    0x7a, 0x54, 0x36, 0x59, 0x7a, 0x23, 0x05, 0x05, 0x05, 0x05, 0x1a, 0x94,
-    0x77, 0x77, 0x6a, 0x9b, 0x9c, 0xa5, 0x5e, 0x0b, 0xaf, 0xa8, 0xb0, 0xa1,
-    0xa2, 0xaf, 0xb5, 0xa9, 0x94, 0xb5, 0x83, 0xb5, 0xaf, 0xb1, 0x94, 0xaf,
-    0xa2, 0x85, 0x85, 0x8d, 0xa9, 0xb1, 0xb1, 0xa2, 0xa5, 0xa2, 0xa9, 0x9b,
-    0xb5, 0x9c, 0x06, 0x0b, 0x98, 0x98, 0x9c, 0x61, 0xb1, 0xb1, 0xa9, 0xb1,
-    0x5c, 0x55, 0x5c, 0xb7, 0x4b, 0x05, 0x05, 0x05, 0x0b, 0x7f, 0x98, 0x98,
-    0x97, 0xb2, 0x8d, 0xa2, 0xb7, 0xa6, 0xa2, 0xa2, 0xa6, 0xa2, 0x97, 0xa6,
-    0xa2, 0xa2, 0x8d, 0x98, 0xa9, 0xa2, 0x8d, 0x97, 0xb7, 0xbf, 0xbb, 0xb1,
-    0x65, 0x26, 0x7e, 0x65, 0x08, 0x5c, 0x71, 0x85, 0x85, 0x98, 0x85, 0x7e,
-    0x51, 0x85, 0xa9, 0xa5, 0xa2, 0x97, 0xac, 0xb1, 0x9c, 0xb0, 0xb7, 0xaf,
-    0xba, 0xb5, 0x71, 0x9c, 0x9a, 0xa8, 0x8c, 0xa9, 0x7e, 0x4b, 0x47, 0x84,
-    0xa2, 0x90, 0xba, 0xb0, 0xa9, 0x9c, 0xac, 0x71, 0x8d, 0x9a, 0xb5, 0x8c,
-    0xb0, 0xab, 0x85, 0x2c, 0x77, 0x55, 0x5e, 0xab, 0x7e, 0x9c, 0x69, 0x36,
-    0x26, 0x3e, 0x2b, 0x5e, 0x3e, 0x1f, 0x69, 0x9b, 0x71, 0x5e, 0x15, 0x12,
-    0x1c, 0x0b, 0x08, 0x11, 0x21, 0x0b, 0x23, 0x2c, 0x15, 0x26, 0x1c, 0x06,
-    0x16, 0x1f, 0x06, 0x0b, 0x54, 0x54, 0x0c, 0x03, 0x03, 0x06, 0x1c, 0x18,
-    0x31, 0x29, 0x27, 0x49, 0x50, 0x2a, 0x29, 0x3d, 0x15, 0x0b, 0x03, 0x05,
-    0x01, 0x01, 0x06, 0x05, 0x0b, 0x07, 0x1b, 0x14, 0x03, 0x01, 0x01, 0x01,
-    0x06, 0x07, 0x04, 0x05, 0x03, 0x12, 0x0b, 0x1b, 0x1e, 0x0c, 0x07, 0x01,
-    0x06, 0x0b, 0x06, 0x04, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03,
-    0x04, 0x01, 0x02, 0x06, 0x09, 0x40, 0x3a, 0x2e, 0x2e, 0x17, 0x10, 0x01,
-    0x10, 0x40, 0x3c, 0x2e, 0x4d, 0x52, 0x3a, 0x22, 0x01, 0x01, 0x10, 0x33,
-    0x33, 0x28, 0x28, 0x2a, 0x14, 0x04, 0x58, 0x62, 0x58, 0x4f, 0x58, 0x66,
-    0x67, 0x53, 0x66, 0x70, 0x29, 0x0c, 0x14, 0x7b, 0x31, 0x04, 0x06, 0x07,
-    0x15, 0x64, 0x31, 0x50, 0x1d, 0x06, 0x15, 0x05, 0x05, 0x01, 0x04, 0x50,
-    0x81, 0x2d, 0x31, 0x81, 0x7d, 0x6c, 0x3d, 0x6f, 0x49, 0x8f, 0x49, 0x0c,
-    0x75, 0x75, 0x0b, 0x0b, 0x0b, 0x0b, 0x13, 0x6f, 0x6a, 0x43, 0x59, 0x8c,
-    0x36, 0x05, 0x05, 0x05, 0x03, 0x03, 0x05, 0x83, 0x83, 0xa2, 0x8c, 0xaf,
-    0xa8, 0x9e, 0x55, 0x1c, 0xb5, 0xa1, 0x9c, 0x9c, 0xa2, 0xb5, 0xb5, 0xaf,
-    0x94, 0xa2, 0xa9, 0x9c, 0xa8, 0xaf, 0xa5, 0x97, 0x8c, 0xb1, 0xa1, 0x85,
-    0x85, 0x77, 0xa9, 0xa9, 0xb1, 0x9a, 0x9a, 0xaf, 0xb7, 0x9a, 0x5e, 0x5c,
-    0xa2, 0x71, 0x9a, 0x61, 0xac, 0xb7, 0xb5, 0xb1, 0x5c, 0x55, 0x8d, 0x8d,
-    0x51, 0x34, 0x06, 0x01, 0x01, 0x26, 0x51, 0x74, 0x8d, 0x97, 0x8d, 0xa2,
-    0xa9, 0xa9, 0xb1, 0x97, 0x85, 0x9d, 0x85, 0x98, 0x9a, 0x97, 0x97, 0xa6,
-    0x8d, 0x71, 0x85, 0xb7, 0xb7, 0xbf, 0xbb, 0xba, 0x41, 0x77, 0x74, 0x26,
-    0x08, 0x34, 0xa6, 0x8d, 0x5c, 0x6e, 0xb3, 0x97, 0x77, 0x97, 0xa5, 0xb7,
-    0x71, 0x9d, 0xb1, 0xb1, 0xb7, 0xba, 0xb7, 0xa9, 0xa9, 0xb1, 0x97, 0x8d,
-    0x9a, 0x94, 0x89, 0x98, 0x65, 0x26, 0x6e, 0xa8, 0xba, 0xa9, 0x94, 0x85,
-    0x9c, 0x8d, 0xa5, 0x61, 0x94, 0x94, 0xa5, 0x8d, 0x71, 0x8c, 0x94, 0x5e,
-    0x69, 0x51, 0x71, 0x85, 0x54, 0x6a, 0x4b, 0x34, 0x2d, 0x2d, 0x27, 0x84,
-    0x1f, 0x1f, 0x3e, 0x9b, 0x6c, 0x7a, 0x69, 0x20, 0x1f, 0x0c, 0x06, 0x1f,
-    0x06, 0x0b, 0x25, 0x0b, 0x1c, 0x27, 0x36, 0x23, 0x15, 0x0c, 0x11, 0x20,
-    0x86, 0x73, 0x15, 0x05, 0x06, 0x0b, 0x07, 0x49, 0x27, 0x1c, 0x2b, 0x49,
-    0x49, 0x31, 0x29, 0x3d, 0x20, 0x18, 0x0c, 0x04, 0x15, 0x06, 0x0b, 0x06,
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x05, 0x06, 0x01, 0x04, 0x06,
-    0x0c, 0x10, 0x05, 0x06, 0x06, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
-    0x00, 0x01, 0x01, 0x02, 0x03, 0x06, 0x04, 0x0c, 0x17, 0x0d, 0x10, 0x09,
-    0x0d, 0x3c, 0x2e, 0x2f, 0x1e, 0x10, 0x04, 0x01, 0x2e, 0x4d, 0x28, 0x28,
-    0x40, 0x3a, 0x3c, 0x46, 0x04, 0x01, 0x03, 0x33, 0x2e, 0x24, 0x4d, 0x3a,
-    0x25, 0x01, 0x33, 0x58, 0x58, 0x63, 0x66, 0x66, 0x63, 0x4f, 0x63, 0x72,
-    0x24, 0x0b, 0x29, 0x7b, 0x42, 0x01, 0x05, 0x1d, 0x06, 0x42, 0x73, 0x31,
-    0x0c, 0x25, 0x05, 0x04, 0x04, 0x03, 0x0f, 0x81, 0x81, 0x7a, 0x3d, 0x78,
-    0x78, 0x5b, 0x8a, 0x59, 0x3d, 0x96, 0x78, 0x27, 0x15, 0x36, 0x06, 0x0b,
-    0x05, 0x05, 0x3e, 0x36, 0x3d, 0x61, 0x94, 0x54, 0x0b, 0x01, 0x05, 0x05,
-    0x05, 0x0b, 0x0e, 0x9b, 0x75, 0x9c, 0x7a, 0xb0, 0xb0, 0x9e, 0x5e, 0x1a,
-    0xaf, 0x83, 0x9a, 0xa1, 0xa2, 0xaf, 0xaf, 0xb5, 0x9c, 0xb1, 0xac, 0x61,
-    0x77, 0x5c, 0x5e, 0x51, 0x90, 0xba, 0x9c, 0xa2, 0xa5, 0x77, 0x71, 0x7e,
-    0x8d, 0xaf, 0x9c, 0xb7, 0xb5, 0xaf, 0xb5, 0xa9, 0x85, 0x9a, 0xa5, 0x8d,
-    0x77, 0xbf, 0x9c, 0x4b, 0x2c, 0x57, 0x5c, 0x7f, 0x85, 0xa7, 0x85, 0x6e,
-    0x41, 0x1f, 0x85, 0x7e, 0x51, 0x5c, 0x97, 0x8d, 0x7f, 0x97, 0x98, 0x97,
-    0x8d, 0x9d, 0x94, 0x9d, 0x77, 0x71, 0x8d, 0x8d, 0x8d, 0x98, 0xa9, 0xb1,
-    0xb1, 0xc1, 0xba, 0xa9, 0x26, 0xb7, 0x85, 0x1f, 0x0e, 0x26, 0xbb, 0x98,
-    0x47, 0xa9, 0xbf, 0xb1, 0xa5, 0x8d, 0xba, 0x9c, 0x9c, 0x7e, 0x9c, 0xa9,
-    0xbf, 0xbf, 0xb5, 0xba, 0x9c, 0xb7, 0x9a, 0xa5, 0x8d, 0x71, 0x71, 0x77,
-    0x65, 0x65, 0x7e, 0xb5, 0xa5, 0xb5, 0x77, 0x8d, 0x94, 0x9c, 0xb1, 0x85,
-    0x85, 0x4b, 0x7e, 0x85, 0x98, 0xa1, 0x94, 0xa5, 0x5c, 0x1f, 0x4b, 0x34,
-    0x3e, 0x3e, 0x1f, 0x2d, 0x36, 0x1c, 0x1a, 0x36, 0x15, 0x2c, 0x11, 0x36,
-    0x1f, 0x54, 0x55, 0x25, 0x0b, 0x2c, 0x15, 0x1c, 0x1f, 0x0b, 0x1f, 0x20,
-    0x26, 0x26, 0x23, 0x1c, 0x04, 0x0b, 0x25, 0x1f, 0x2d, 0x23, 0x36, 0x05,
-    0x0c, 0x03, 0x0c, 0x3d, 0x2a, 0x20, 0x10, 0x3e, 0x31, 0x31, 0x18, 0x1d,
-    0x2b, 0x3d, 0x23, 0x15, 0x06, 0x1b, 0x14, 0x1f, 0x07, 0x04, 0x01, 0x01,
-    0x04, 0x20, 0x1b, 0x0c, 0x07, 0x14, 0x0c, 0x14, 0x42, 0x10, 0x03, 0x01,
-    0x01, 0x02, 0x01, 0x02, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0c,
-    0x0a, 0x0c, 0x07, 0x09, 0x17, 0x2e, 0x1e, 0x1e, 0x04, 0x0d, 0x28, 0x22,
-    0x09, 0x09, 0x10, 0x1b, 0x3c, 0x3c, 0x17, 0x2f, 0x40, 0x40, 0x28, 0x28,
-    0x22, 0x01, 0x01, 0x1b, 0x28, 0x3a, 0x58, 0x46, 0x1e, 0x06, 0x07, 0x66,
-    0x66, 0x66, 0x66, 0x62, 0x70, 0x5a, 0x53, 0x70, 0x1d, 0x05, 0x42, 0x7b,
-    0x24, 0x04, 0x08, 0x0b, 0x03, 0x42, 0x31, 0x50, 0x50, 0x50, 0x05, 0x0b,
-    0x03, 0x03, 0x2d, 0x78, 0x78, 0x8a, 0x42, 0x81, 0x50, 0x5b, 0x78, 0x6f,
-    0x3d, 0x96, 0x6c, 0x75, 0x13, 0x13, 0x3e, 0x02, 0x03, 0x05, 0x1f, 0x59,
-    0x7a, 0x3e, 0x26, 0x0e, 0x05, 0x01, 0x0e, 0x06, 0x05, 0x15, 0x34, 0x7a,
-    0x94, 0x6a, 0x61, 0x76, 0x7a, 0xa8, 0x6a, 0x13, 0x9e, 0x83, 0x90, 0xaf,
-    0xa8, 0xb1, 0xb5, 0xb5, 0xa5, 0x71, 0x54, 0x3e, 0x71, 0x85, 0x97, 0xa9,
-    0x9c, 0x8c, 0x9a, 0x9a, 0xaf, 0x9a, 0x7e, 0x9a, 0xb1, 0xba, 0xb0, 0xa9,
-    0xb1, 0xb5, 0xb5, 0xa2, 0x9c, 0xa2, 0x98, 0xb1, 0x98, 0xa6, 0x51, 0x2c,
-    0x1f, 0x2d, 0x6a, 0xb1, 0xbf, 0x98, 0x9d, 0xa5, 0x8d, 0x7e, 0xa6, 0xbb,
-    0x9d, 0x97, 0xac, 0x8d, 0xb1, 0xb2, 0xb7, 0xbf, 0xb1, 0xa9, 0xb1, 0x9c,
-    0x97, 0x88, 0x85, 0x85, 0x97, 0xb7, 0xbb, 0xbb, 0xbb, 0xa2, 0xa9, 0x7e,
-    0x69, 0xbb, 0x5f, 0x3e, 0x6e, 0x41, 0x9d, 0x9c, 0x2d, 0xbb, 0xc6, 0xa5,
-    0xb5, 0xb7, 0xb5, 0xb1, 0xb1, 0x8c, 0x97, 0x85, 0xbf, 0xbf, 0xb7, 0xb7,
-    0x6a, 0x9a, 0x9c, 0xb1, 0x8d, 0x77, 0x8c, 0x85, 0x65, 0x4b, 0x7e, 0xa9,
-    0x8d, 0x8c, 0x7e, 0x9c, 0x9c, 0x9c, 0xa2, 0x94, 0xb0, 0x77, 0x55, 0x94,
-    0xa1, 0xaf, 0xab, 0x9c, 0x71, 0x18, 0x5c, 0x69, 0x94, 0xa2, 0x54, 0x2b,
-    0x36, 0x34, 0x3e, 0x8f, 0x77, 0x1f, 0x2d, 0x2d, 0x15, 0x3e, 0x12, 0x1c,
-    0x0b, 0x0b, 0x0b, 0x06, 0x0b, 0x05, 0x06, 0x15, 0x0b, 0x1f, 0x0b, 0x04,
-    0x0b, 0x26, 0x0f, 0x15, 0x0b, 0x05, 0x12, 0x05, 0x1f, 0x12, 0x15, 0x2d,
-    0x29, 0x14, 0x13, 0x1b, 0x07, 0x20, 0x0b, 0x27, 0x67, 0x56, 0x29, 0x3d,
-    0x20, 0x06, 0x15, 0x07, 0x06, 0x14, 0x05, 0x14, 0x23, 0x33, 0x2a, 0x06,
-    0x05, 0x18, 0x0c, 0x10, 0x0c, 0x04, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02,
-    0x01, 0x02, 0x01, 0x01, 0x03, 0x01, 0x06, 0x07, 0x01, 0x12, 0x07, 0x09,
-    0x17, 0x17, 0x10, 0x09, 0x01, 0x01, 0x07, 0x1b, 0x06, 0x04, 0x07, 0x17,
-    0x2e, 0x17, 0x1e, 0x17, 0x4d, 0x2f, 0x28, 0x40, 0x2e, 0x07, 0x01, 0x07,
-    0x33, 0x33, 0x3a, 0x3a, 0x33, 0x0c, 0x03, 0x46, 0x63, 0x58, 0x66, 0x72,
-    0x72, 0x5a, 0x53, 0x5a, 0x18, 0x05, 0x5a, 0x67, 0x50, 0x05, 0x0b, 0x23,
-    0x29, 0x7b, 0x50, 0x73, 0x73, 0x50, 0x05, 0x05, 0x05, 0x04, 0x64, 0x86,
-    0x87, 0x86, 0x68, 0x78, 0x64, 0x6f, 0x8a, 0x8f, 0x31, 0x64, 0x8f, 0x96,
-    0x81, 0x06, 0x25, 0x01, 0x01, 0x0b, 0x1f, 0x96, 0x71, 0x06, 0x05, 0x05,
-    0x05, 0x01, 0x3e, 0x0b, 0x05, 0x05, 0x20, 0x76, 0x8f, 0x65, 0x0e, 0x7a,
-    0x9b, 0x90, 0x59, 0x12, 0x90, 0x94, 0xa8, 0xb0, 0xb5, 0x94, 0xa2, 0x85,
-    0x36, 0x85, 0x85, 0xa9, 0x85, 0xa8, 0xa9, 0xb5, 0x8d, 0xa8, 0xaf, 0xa2,
-    0x9a, 0x9a, 0x9c, 0xa9, 0xbf, 0xba, 0xaf, 0xb1, 0xa2, 0xb1, 0xa2, 0xb1,
-    0x9a, 0xbb, 0xb1, 0x97, 0x85, 0x55, 0x3e, 0x65, 0x74, 0xbb, 0x8d, 0x71,
-    0xbb, 0xb7, 0xb7, 0xb1, 0x8d, 0x9d, 0xb1, 0xb1, 0xb2, 0xa5, 0xbb, 0xb7,
-    0xa6, 0x9d, 0x97, 0x98, 0x98, 0x8d, 0x97, 0x97, 0x97, 0x97, 0x85, 0x97,
-    0xc1, 0xbb, 0xb7, 0xb5, 0xb7, 0xb7, 0x7e, 0x65, 0xa6, 0xb1, 0x3e, 0x34,
-    0x41, 0x7f, 0x71, 0xb2, 0xa5, 0xc6, 0xb7, 0xa9, 0xb7, 0xb1, 0xa9, 0x85,
-    0xb3, 0x98, 0x97, 0xa5, 0xbf, 0xbb, 0xba, 0x7e, 0x6e, 0x7e, 0x94, 0x8d,
-    0x76, 0x77, 0x9a, 0x85, 0xba, 0x98, 0x65, 0xa2, 0xb5, 0x5e, 0x6e, 0xab,
-    0xb5, 0x94, 0x9c, 0xab, 0xb5, 0x9c, 0x51, 0xab, 0xb0, 0xa5, 0xbc, 0x85,
-    0x7e, 0x1a, 0x55, 0x83, 0x71, 0x8c, 0x59, 0x0b, 0x69, 0x34, 0x7a, 0xa1,
-    0x7a, 0x2d, 0x1a, 0x71, 0x11, 0x0b, 0x06, 0x05, 0x05, 0x06, 0x05, 0x06,
-    0x0b, 0x01, 0x05, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x05,
-    0x05, 0x06, 0x26, 0x04, 0x20, 0x2d, 0x06, 0x54, 0x31, 0x3d, 0x31, 0x27,
-    0x6c, 0x36, 0x31, 0x42, 0x33, 0x15, 0x0c, 0x10, 0x1b, 0x03, 0x02, 0x06,
-    0x15, 0x06, 0x14, 0x31, 0x3f, 0x67, 0x28, 0x0c, 0x03, 0x04, 0x01, 0x01,
-    0x01, 0x02, 0x00, 0x02, 0x01, 0x01, 0x01, 0x03, 0x0c, 0x04, 0x0b, 0x01,
-    0x01, 0x01, 0x03, 0x03, 0x04, 0x04, 0x03, 0x06, 0x14, 0x17, 0x17, 0x0c,
-    0x1e, 0x02, 0x01, 0x04, 0x04, 0x01, 0x02, 0x24, 0x22, 0x2e, 0x28, 0x09,
-    0x3a, 0x40, 0x52, 0x40, 0x46, 0x22, 0x01, 0x01, 0x3a, 0x46, 0x46, 0x3c,
-    0x33, 0x1b, 0x04, 0x17, 0x66, 0x58, 0x53, 0x70, 0x70, 0x63, 0x53, 0x5a,
-    0x0c, 0x10, 0x5b, 0x67, 0x67, 0x0c, 0x08, 0x53, 0x73, 0x7b, 0x67, 0x87,
-    0x7d, 0x1d, 0x06, 0x04, 0x05, 0x0c, 0x31, 0x50, 0x68, 0x67, 0x75, 0x78,
-    0x75, 0x78, 0x81, 0x96, 0x81, 0x43, 0x8a, 0x96, 0xa4, 0x59, 0x06, 0x05,
-    0x03, 0x01, 0x01, 0x8c, 0x1f, 0x05, 0x05, 0x08, 0x01, 0x16, 0x0b, 0x69,
-    0x4b, 0x1a, 0x5c, 0x1a, 0x76, 0x9a, 0x0e, 0x13, 0x83, 0x9a, 0x5e, 0x12,
-    0x98, 0x71, 0x8c, 0xab, 0xb5, 0xab, 0x34, 0x59, 0xbb, 0x85, 0xb0, 0xb5,
-    0x6a, 0xaf, 0x94, 0x8d, 0xa9, 0xba, 0xba, 0xb1, 0x90, 0xa2, 0xb5, 0xa8,
-    0x9a, 0xb5, 0xb5, 0xb7, 0xb1, 0xa9, 0x9a, 0xa9, 0xa9, 0xb1, 0x6e, 0x5c,
-    0x26, 0x65, 0x6e, 0x97, 0x8d, 0x97, 0xa5, 0xbb, 0x85, 0x8d, 0xc6, 0xbf,
-    0xb1, 0x8d, 0xa6, 0xb1, 0xac, 0xa9, 0xb1, 0xb1, 0xb7, 0xb7, 0xa6, 0xa7,
-    0x85, 0x9d, 0x98, 0x8d, 0xb1, 0xb1, 0x8d, 0x98, 0x85, 0xa6, 0xb1, 0xbb,
-    0xc4, 0xb7, 0xa6, 0x8d, 0x77, 0xb7, 0x51, 0x74, 0x41, 0x65, 0x74, 0x4b,
-    0x97, 0xc4, 0xc4, 0xb3, 0xb7, 0x5c, 0xa2, 0xb7, 0x65, 0xa6, 0x85, 0x8d,
-    0xa9, 0xa2, 0x9c, 0x94, 0x5f, 0xa6, 0x65, 0xac, 0xa2, 0xa2, 0x85, 0x6a,
-    0xba, 0xa5, 0x77, 0x36, 0x8d, 0xc9, 0x8d, 0x8d, 0xb5, 0x94, 0x7e, 0xa9,
-    0xb5, 0x83, 0xa5, 0xb5, 0xab, 0xb5, 0xb5, 0xa5, 0x9c, 0x55, 0x85, 0x69,
-    0x3e, 0x85, 0x7a, 0x55, 0x25, 0x55, 0x5c, 0x51, 0x3e, 0x12, 0x03, 0x05,
-    0x05, 0x03, 0x0b, 0x13, 0x12, 0x1c, 0x1a, 0x26, 0x1c, 0x26, 0x1c, 0x16,
-    0x0b, 0x23, 0x1a, 0x0e, 0x2c, 0x15, 0x05, 0x0c, 0x0c, 0x01, 0x01, 0x01,
-    0x23, 0x2b, 0x02, 0x1c, 0x5b, 0x54, 0x1b, 0x3d, 0x50, 0x5b, 0x50, 0x73,
-    0x87, 0x23, 0x20, 0x20, 0x12, 0x2a, 0x04, 0x02, 0x03, 0x01, 0x0b, 0x2a,
-    0x33, 0x2a, 0x10, 0x04, 0x06, 0x02, 0x01, 0x01, 0x02, 0x00, 0x12, 0x12,
-    0x01, 0x06, 0x24, 0x07, 0x07, 0x05, 0x14, 0x14, 0x04, 0x05, 0x01, 0x02,
-    0x03, 0x04, 0x01, 0x01, 0x1e, 0x17, 0x0c, 0x04, 0x17, 0x17, 0x01, 0x01,
-    0x01, 0x01, 0x02, 0x3c, 0x46, 0x22, 0x28, 0x0d, 0x3c, 0x3c, 0x3c, 0x3c,
-    0x3a, 0x3a, 0x01, 0x01, 0x24, 0x2e, 0x58, 0x4f, 0x3a, 0x24, 0x06, 0x0b,
-    0x58, 0x66, 0x63, 0x63, 0x66, 0x63, 0x53, 0x29, 0x0f, 0x1a, 0x12, 0x50,
-    0x67, 0x20, 0x07, 0x67, 0x73, 0x5b, 0x7b, 0x7b, 0x78, 0x25, 0x0b, 0x03,
-    0x06, 0x64, 0x78, 0x96, 0x78, 0x6f, 0x6f, 0x6f, 0x81, 0x6f, 0x81, 0x96,
-    0x96, 0x54, 0x8a, 0x96, 0x96, 0x27, 0x0b, 0x0b, 0x0c, 0x03, 0x01, 0x23,
-    0x3d, 0x11, 0x06, 0x0b, 0x05, 0x54, 0x05, 0x27, 0x83, 0x83, 0x6a, 0x05,
-    0x34, 0x71, 0x3e, 0x11, 0x4b, 0x61, 0x71, 0x06, 0xb1, 0x9c, 0xa1, 0xa2,
-    0xa5, 0x61, 0x5e, 0xa5, 0x94, 0xa2, 0xb5, 0xa9, 0x9a, 0x83, 0x8c, 0xba,
-    0xb5, 0xba, 0xba, 0xba, 0xa9, 0x97, 0xb1, 0xb1, 0xba, 0xba, 0xb5, 0xb1,
-    0x8c, 0xb1, 0xbb, 0x8d, 0x9d, 0x1f, 0x1a, 0x2c, 0x88, 0xb1, 0xb1, 0xbb,
-    0xb1, 0x77, 0x65, 0x8d, 0xa6, 0x98, 0x65, 0x9c, 0xbb, 0xb3, 0x97, 0x7e,
-    0x97, 0x8d, 0xb1, 0xa5, 0xb1, 0xb7, 0xb2, 0xa6, 0xb7, 0xbb, 0xb2, 0xb1,
-    0xb1, 0xa5, 0xb7, 0xac, 0xb1, 0xb7, 0xb7, 0xb7, 0xbb, 0x77, 0x6e, 0x85,
-    0x7f, 0x74, 0x69, 0x85, 0x6e, 0x9d, 0x44, 0x34, 0x74, 0xc9, 0xc4, 0xb7,
-    0x97, 0x57, 0xb1, 0x9d, 0x65, 0x65, 0x97, 0x8d, 0xba, 0xb1, 0xc4, 0xba,
-    0x3e, 0x55, 0x85, 0xba, 0xa2, 0x9d, 0x8d, 0x7e, 0x9a, 0x9c, 0x94, 0x5c,
-    0x55, 0xb0, 0x7e, 0x7e, 0xa9, 0x9c, 0x9c, 0x61, 0x9c, 0x83, 0xa5, 0x9c,
-    0xb0, 0xb5, 0xb0, 0xa5, 0x77, 0x8c, 0x7a, 0x9b, 0x7e, 0xab, 0xa1, 0x55,
-    0x1f, 0x41, 0x16, 0x0c, 0x1c, 0x0b, 0x0a, 0x12, 0x27, 0x1f, 0x51, 0x2d,
-    0x2d, 0x61, 0x4b, 0x1b, 0x11, 0x0b, 0x0b, 0x0b, 0x12, 0x3e, 0x20, 0x0b,
-    0x21, 0x5e, 0x14, 0x54, 0x1f, 0x5e, 0x5e, 0x0a, 0x01, 0x02, 0x02, 0x02,
-    0x5b, 0x6c, 0x3d, 0x2b, 0x3d, 0x7d, 0x2a, 0x3d, 0x42, 0x20, 0x0f, 0x0c,
-    0x20, 0x20, 0x50, 0x73, 0x23, 0x05, 0x02, 0x04, 0x03, 0x04, 0x01, 0x01,
-    0x02, 0x00, 0x02, 0x02, 0x06, 0x09, 0x31, 0x14, 0x06, 0x29, 0x1e, 0x10,
-    0x20, 0x10, 0x20, 0x0d, 0x06, 0x06, 0x01, 0x02, 0x04, 0x07, 0x01, 0x07,
-    0x28, 0x22, 0x14, 0x03, 0x40, 0x3c, 0x0d, 0x02, 0x01, 0x01, 0x1e, 0x3a,
-    0x2e, 0x22, 0x17, 0x17, 0x3a, 0x4d, 0x52, 0x3a, 0x46, 0x4f, 0x10, 0x0b,
-    0x07, 0x33, 0x58, 0x46, 0x2f, 0x3f, 0x07, 0x03, 0x46, 0x63, 0x62, 0x72,
-    0x70, 0x63, 0x67, 0x1b, 0x06, 0x20, 0x03, 0x67, 0x67, 0x1d, 0x1f, 0x50,
-    0x7b, 0x67, 0x7b, 0x67, 0x53, 0x15, 0x04, 0x05, 0x1a, 0x6f, 0x87, 0x78,
-    0x81, 0x75, 0x6f, 0x73, 0x68, 0x6f, 0x7a, 0x49, 0x81, 0x68, 0x68, 0x78,
-    0x31, 0x0e, 0x06, 0x0b, 0x16, 0x05, 0x01, 0x01, 0x71, 0x0b, 0x08, 0x08,
-    0x23, 0x06, 0x03, 0x1f, 0x6a, 0xab, 0x9b, 0x0c, 0x11, 0xab, 0xaf, 0xa8,
-    0x83, 0x9c, 0x8c, 0x06, 0x94, 0xa1, 0x9a, 0xaf, 0x9a, 0x51, 0xba, 0xa8,
-    0xb0, 0xb0, 0xa2, 0xba, 0x90, 0x83, 0x8d, 0xa2, 0xb5, 0xb5, 0xba, 0xab,
-    0xaf, 0xa2, 0x90, 0xa9, 0xb1, 0xbb, 0xa9, 0xa2, 0x8d, 0x85, 0x98, 0x7f,
-    0x16, 0x16, 0x98, 0xc6, 0xb5, 0xc4, 0xbb, 0xc4, 0xbb, 0xa7, 0x98, 0x8d,
-    0x26, 0x7e, 0x98, 0x97, 0x8d, 0x97, 0x9d, 0x9d, 0x8d, 0x7f, 0x74, 0xa7,
-    0x97, 0xb2, 0xbb, 0xb1, 0xb1, 0xb1, 0x9c, 0xbb, 0xc6, 0xa9, 0xbb, 0xb7,
-    0xb7, 0xbb, 0xb7, 0xa6, 0xa5, 0xa6, 0xb1, 0x69, 0x7e, 0x9d, 0xb1, 0x8d,
-    0x6e, 0x57, 0x6a, 0x88, 0xa6, 0xc4, 0xc4, 0xb3, 0xb7, 0x5c, 0xac, 0xa6,
-    0x8d, 0x7e, 0x5c, 0xb1, 0xbf, 0xbb, 0xb1, 0x85, 0x2c, 0x51, 0xa2, 0xa9,
-    0x9a, 0x98, 0x51, 0x8d, 0x8d, 0xa2, 0xa2, 0xb1, 0xb1, 0x5c, 0x8d, 0x85,
-    0x4b, 0x9d, 0x71, 0xac, 0x5e, 0x71, 0x71, 0x94, 0x65, 0xaf, 0xab, 0x85,
-    0x85, 0x77, 0x2c, 0x7a, 0x71, 0x71, 0x94, 0x0b, 0x06, 0x15, 0x69, 0x6e,
-    0x8c, 0x36, 0x4b, 0x34, 0x3e, 0x0b, 0x20, 0x36, 0x3b, 0x69, 0x23, 0x1f,
-    0x0b, 0x05, 0x01, 0x55, 0x23, 0x15, 0x23, 0x05, 0x1b, 0x76, 0x54, 0x8f,
-    0x36, 0x3e, 0x36, 0x0c, 0x08, 0x02, 0x03, 0x00, 0x01, 0x0c, 0x12, 0x2a,
-    0x92, 0x50, 0x29, 0x1b, 0x0c, 0x1a, 0x35, 0x5a, 0x25, 0x3f, 0x7b, 0x70,
-    0x33, 0x10, 0x1f, 0x0a, 0x01, 0x02, 0x01, 0x02, 0x02, 0x03, 0x24, 0x2a,
-    0x20, 0x1b, 0x3f, 0x0c, 0x1e, 0x33, 0x14, 0x10, 0x10, 0x0d, 0x29, 0x0d,
-    0x1b, 0x12, 0x0b, 0x04, 0x03, 0x02, 0x05, 0x06, 0x09, 0x28, 0x22, 0x07,
-    0x2e, 0x2e, 0x14, 0x01, 0x01, 0x06, 0x3c, 0x2e, 0x46, 0x1e, 0x06, 0x2e,
-    0x3c, 0x4d, 0x3c, 0x33, 0x4d, 0x4d, 0x24, 0x0c, 0x04, 0x24, 0x4d, 0x4d,
-    0x46, 0x42, 0x17, 0x06, 0x0f, 0x66, 0x66, 0x66, 0x66, 0x53, 0x53, 0x0c,
-    0x04, 0x1a, 0x07, 0x67, 0x73, 0x13, 0x0c, 0x5b, 0x7b, 0x73, 0x7b, 0x67,
-    0x29, 0x0f, 0x0b, 0x05, 0x29, 0x68, 0x73, 0x68, 0x7d, 0x50, 0x64, 0x78,
-    0x36, 0x1d, 0x13, 0x1b, 0x1f, 0x54, 0x2d, 0x1a, 0x05, 0x05, 0x05, 0x06,
-    0x1f, 0x0b, 0x03, 0x01, 0x0c, 0x15, 0x04, 0x1a, 0x54, 0x11, 0x06, 0x26,
-    0xa1, 0x9c, 0x65, 0x2d, 0x1f, 0xb5, 0xaf, 0xa8, 0xa8, 0xa8, 0x9c, 0x0e,
-    0x6a, 0xb0, 0xa2, 0x9a, 0x2d, 0x9c, 0xab, 0xab, 0xa2, 0xb5, 0xaf, 0xa9,
-    0x7e, 0xb1, 0xb1, 0xa9, 0x8d, 0xa2, 0xa9, 0xa9, 0xa9, 0x94, 0x8d, 0xbf,
-    0xb5, 0xb5, 0xa2, 0xa9, 0x7e, 0x77, 0x51, 0x36, 0x44, 0x4b, 0xba, 0xbf,
-    0xbb, 0xc1, 0xbf, 0xbb, 0xb2, 0xa5, 0xa9, 0xb1, 0x74, 0x34, 0x34, 0x7f,
-    0x98, 0x9d, 0x9c, 0x97, 0x6e, 0x97, 0x97, 0xa6, 0xa6, 0xac, 0xb7, 0xa6,
-    0xb1, 0xb1, 0xb7, 0xbb, 0xc6, 0xbb, 0xb1, 0xb7, 0x98, 0xb1, 0x9d, 0x85,
-    0xa6, 0xa5, 0xbb, 0x77, 0xa7, 0x98, 0xbb, 0xb1, 0x88, 0x3e, 0x5c, 0xa5,
-    0x97, 0xb2, 0x9d, 0x74, 0xb3, 0x85, 0x98, 0x74, 0xb7, 0x6e, 0x77, 0x98,
-    0x97, 0xb1, 0x9c, 0x5c, 0x85, 0xa5, 0xbb, 0xb1, 0x94, 0xa5, 0x9c, 0x8d,
-    0xa9, 0x9c, 0x85, 0x61, 0xa2, 0x85, 0x6e, 0x4b, 0x34, 0x54, 0x2c, 0x47,
-    0x55, 0x2c, 0x44, 0x36, 0x36, 0x77, 0x6a, 0x5c, 0x1f, 0x36, 0x23, 0x36,
-    0x51, 0x12, 0x16, 0x1f, 0x26, 0x83, 0x94, 0x3e, 0x55, 0x1f, 0x23, 0x21,
-    0x16, 0x55, 0x2d, 0x0b, 0x15, 0x2d, 0x71, 0x1f, 0x05, 0x05, 0x0b, 0x14,
-    0x69, 0x2d, 0x03, 0x05, 0x1b, 0x75, 0x54, 0x3e, 0x1a, 0x49, 0x23, 0x6c,
-    0x1f, 0x0a, 0x1a, 0x07, 0x03, 0x01, 0x01, 0x21, 0x73, 0x73, 0x1f, 0x0c,
-    0x07, 0x31, 0x5b, 0x3d, 0x42, 0x73, 0x67, 0x35, 0x0c, 0x03, 0x01, 0x01,
-    0x01, 0x01, 0x02, 0x12, 0x4f, 0x3f, 0x4f, 0x4f, 0x1b, 0x1e, 0x1e, 0x17,
-    0x1b, 0x14, 0x07, 0x1b, 0x0c, 0x07, 0x10, 0x46, 0x24, 0x28, 0x09, 0x04,
-    0x07, 0x03, 0x07, 0x04, 0x01, 0x02, 0x06, 0x09, 0x2e, 0x33, 0x04, 0x01,
-    0x02, 0x1e, 0x2e, 0x2f, 0x2e, 0x28, 0x10, 0x3a, 0x3a, 0x40, 0x40, 0x2e,
-    0x4d, 0x4d, 0x28, 0x07, 0x03, 0x28, 0x58, 0x58, 0x58, 0x46, 0x33, 0x0c,
-    0x01, 0x46, 0x70, 0x63, 0x70, 0x53, 0x50, 0x15, 0x0b, 0x54, 0x29, 0x70,
-    0x53, 0x13, 0x0b, 0x3d, 0x50, 0x73, 0x70, 0x73, 0x1d, 0x15, 0x06, 0x04,
-    0x3d, 0x6f, 0x5b, 0x75, 0x73, 0x5e, 0x5b, 0x5b, 0x0f, 0x3e, 0x49, 0x3d,
-    0x49, 0x49, 0x6f, 0x2d, 0x0b, 0x0b, 0x26, 0x1a, 0x1f, 0x0b, 0x05, 0x01,
-    0x0b, 0x11, 0x01, 0x3e, 0x06, 0x06, 0x0c, 0x30, 0x8c, 0x5e, 0x77, 0x83,
-    0x83, 0xb5, 0xb5, 0xa8, 0x9c, 0x8f, 0x9c, 0x16, 0x4b, 0xb5, 0xa5, 0x2c,
-    0x6a, 0x94, 0xb5, 0xb5, 0xb1, 0xa5, 0xa2, 0x94, 0x9c, 0x9a, 0xaf, 0xba,
-    0xb1, 0x85, 0x9c, 0xa9, 0xa2, 0x8c, 0xb1, 0xb5, 0xb5, 0xb1, 0xa2, 0x8d,
-    0x5c, 0x6e, 0x6e, 0x2d, 0x5c, 0x8d, 0xbf, 0xbb, 0xba, 0xba, 0xb1, 0x97,
-    0x97, 0xa9, 0xa9, 0xc1, 0x9c, 0xa6, 0x44, 0x5c, 0xb7, 0x8d, 0xb1, 0xb1,
-    0x88, 0x9d, 0x9d, 0xa7, 0x9d, 0xb1, 0xa6, 0xb2, 0xa6, 0xb2, 0xa9, 0xc4,
-    0xbb, 0xc1, 0xc6, 0xc1, 0xc6, 0xa6, 0x8d, 0xc6, 0xb1, 0xa6, 0xb7, 0xbb,
-    0xb7, 0xa6, 0xbb, 0xb1, 0xb1, 0x88, 0x9d, 0x98, 0x97, 0x7e, 0x8d, 0x6e,
-    0x98, 0xc6, 0x97, 0x6e, 0xa6, 0x97, 0x8d, 0x8d, 0x8d, 0x97, 0x7e, 0x74,
-    0xb1, 0xa2, 0xb5, 0xa5, 0x9d, 0xa2, 0xb1, 0x85, 0xa9, 0x8d, 0x61, 0x8d,
-    0x5c, 0x85, 0x98, 0xa5, 0x77, 0x6e, 0x4b, 0x34, 0x51, 0x55, 0x77, 0x2c,
-    0x2c, 0x3e, 0x2c, 0x2c, 0x1f, 0x36, 0x4b, 0x08, 0x05, 0x1f, 0x5e, 0x4b,
-    0x65, 0x2c, 0x1c, 0x1f, 0x1a, 0x71, 0x54, 0x26, 0x84, 0x75, 0x69, 0x26,
-    0x55, 0x23, 0x49, 0x0e, 0x0b, 0x0b, 0x11, 0x0b, 0x1c, 0x5e, 0x12, 0x0b,
-    0x13, 0x6f, 0x8f, 0x5e, 0x1a, 0x36, 0x5b, 0x64, 0x15, 0x06, 0x20, 0x49,
-    0x20, 0x08, 0x01, 0x01, 0x04, 0x15, 0x15, 0x23, 0x12, 0x31, 0x15, 0x14,
-    0x25, 0x07, 0x03, 0x01, 0x01, 0x01, 0x02, 0x05, 0x01, 0x01, 0x10, 0x50,
-    0x72, 0x66, 0x4f, 0x58, 0x06, 0x24, 0x09, 0x3f, 0x1e, 0x07, 0x0b, 0x07,
-    0x10, 0x07, 0x2a, 0x46, 0x28, 0x3a, 0x1e, 0x04, 0x09, 0x07, 0x0c, 0x06,
-    0x05, 0x04, 0x04, 0x0a, 0x3c, 0x17, 0x01, 0x02, 0x04, 0x2e, 0x3a, 0x3a,
-    0x40, 0x14, 0x24, 0x3c, 0x3c, 0x40, 0x58, 0x3a, 0x4d, 0x3c, 0x46, 0x14,
-    0x01, 0x10, 0x66, 0x58, 0x62, 0x46, 0x58, 0x1b, 0x04, 0x10, 0x66, 0x70,
-    0x63, 0x33, 0x35, 0x15, 0x01, 0x13, 0x5b, 0x7b, 0x2d, 0x13, 0x07, 0x3d,
-    0x67, 0x67, 0x7b, 0x73, 0x1a, 0x15, 0x0b, 0x07, 0x3d, 0x5b, 0x78, 0x81,
-    0x81, 0x75, 0x50, 0x1f, 0x1c, 0x3d, 0x7a, 0x8f, 0x8f, 0x96, 0x8a, 0x1a,
-    0x05, 0x0f, 0x8a, 0x8a, 0x83, 0x36, 0x0b, 0x05, 0x08, 0x01, 0x0b, 0x36,
-    0x05, 0x05, 0x05, 0x0b, 0x16, 0x1a, 0x7a, 0x59, 0x83, 0x94, 0xa1, 0xa1,
-    0x94, 0x7a, 0x6a, 0x1a, 0x2c, 0xa2, 0x61, 0x11, 0x6e, 0x9c, 0xa8, 0xaf,
-    0xa9, 0xaf, 0x94, 0x8c, 0xb5, 0xab, 0xa9, 0xa9, 0xaf, 0xb5, 0xa2, 0x9a,
-    0xb1, 0x9a, 0xb0, 0xa2, 0x98, 0x9a, 0x5c, 0x65, 0x9a, 0x85, 0x1f, 0x44,
-    0xa9, 0x98, 0xc1, 0xc4, 0xbb, 0xa9, 0xa5, 0xbb, 0xcb, 0xc9, 0xb1, 0xbb,
-    0xb7, 0xa6, 0xa5, 0x74, 0xbb, 0x97, 0x8d, 0xb7, 0xb1, 0x8d, 0x9d, 0xa6,
-    0xa6, 0xa6, 0xa6, 0x9d, 0xa7, 0xb8, 0xbb, 0xbb, 0xbb, 0xc1, 0xc9, 0xc1,
-    0xbb, 0xbb, 0xb7, 0xbb, 0xbb, 0xbb, 0xb7, 0xc9, 0xcb, 0xbb, 0xb1, 0xbb,
-    0xc1, 0xc6, 0xa6, 0xb7, 0x9d, 0x8d, 0xa7, 0x4b, 0xb2, 0xc1, 0x8d, 0xc6,
-    0xa6, 0xb7, 0x9d, 0x97, 0x7e, 0x8d, 0x8d, 0xa5, 0x8d, 0x97, 0xbf, 0xa2,
-    0xb7, 0xb5, 0xa5, 0x6a, 0x85, 0x65, 0x65, 0x65, 0x77, 0x77, 0x9c, 0x77,
-    0xa9, 0xac, 0xa9, 0x6a, 0x71, 0x5c, 0x5c, 0x71, 0x77, 0x55, 0x3e, 0x2c,
-    0x05, 0x0b, 0x0b, 0x11, 0x16, 0x41, 0x7a, 0x5f, 0x4b, 0x26, 0x36, 0x2c,
-    0x54, 0x94, 0x69, 0x77, 0x94, 0x4b, 0x2c, 0x55, 0x3e, 0x26, 0x2c, 0x1f,
-    0x15, 0x06, 0x12, 0x05, 0x0c, 0x54, 0x6a, 0x11, 0x06, 0x59, 0x6c, 0x5b,
-    0x2d, 0x1c, 0x29, 0x5b, 0x2d, 0x1a, 0x05, 0x31, 0x35, 0x3e, 0x31, 0x12,
-    0x01, 0x01, 0x05, 0x07, 0x0c, 0x2b, 0x06, 0x06, 0x02, 0x01, 0x02, 0x02,
-    0x02, 0x12, 0x24, 0x1b, 0x0b, 0x12, 0x42, 0x42, 0x70, 0x4f, 0x4f, 0x5a,
-    0x0c, 0x1b, 0x17, 0x20, 0x1e, 0x0c, 0x0c, 0x09, 0x14, 0x07, 0x28, 0x33,
-    0x3f, 0x3a, 0x3a, 0x09, 0x0b, 0x09, 0x01, 0x03, 0x07, 0x10, 0x03, 0x04,
-    0x40, 0x07, 0x01, 0x02, 0x22, 0x3c, 0x3a, 0x22, 0x10, 0x1e, 0x28, 0x28,
-    0x4d, 0x40, 0x52, 0x3a, 0x4d, 0x46, 0x58, 0x22, 0x04, 0x01, 0x33, 0x66,
-    0x58, 0x46, 0x62, 0x20, 0x06, 0x04, 0x46, 0x72, 0x33, 0x07, 0x14, 0x07,
-    0x01, 0x04, 0x50, 0x31, 0x23, 0x0c, 0x0b, 0x3d, 0x7b, 0x73, 0x64, 0x3d,
-    0x0b, 0x12, 0x06, 0x0c, 0x3d, 0x67, 0x68, 0x73, 0x49, 0x3e, 0x1d, 0x23,
-    0x23, 0x59, 0x8a, 0x96, 0x96, 0x96, 0x7a, 0x0f, 0x05, 0x3d, 0xa4, 0x96,
-    0xa4, 0x8f, 0x13, 0x05, 0x01, 0x02, 0x23, 0x77, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x0b, 0x6a, 0x61, 0x6a, 0x3e, 0x4b, 0x5e, 0x55, 0x3e, 0x54, 0x1a,
-    0x12, 0x3e, 0x0e, 0x05, 0x27, 0xa9, 0xb7, 0xb5, 0xa1, 0xa2, 0xa2, 0x90,
-    0xaf, 0xac, 0xa2, 0xb5, 0xba, 0xb7, 0xb5, 0x90, 0x85, 0x85, 0x97, 0xb1,
-    0x9c, 0x5c, 0x65, 0x97, 0x65, 0x1a, 0x6e, 0x98, 0xbf, 0xa5, 0xb1, 0xc4,
-    0x8d, 0xb1, 0xc4, 0xc1, 0xbb, 0xcb, 0xa5, 0xa6, 0xbe, 0x9d, 0xac, 0xb2,
-    0xac, 0xb1, 0xac, 0x9d, 0xb1, 0xa6, 0xb7, 0xbb, 0xb2, 0xb7, 0xbb, 0x9d,
-    0xb1, 0xc1, 0xcb, 0xc6, 0xbb, 0xc6, 0xc9, 0xcb, 0xbb, 0xc1, 0xc6, 0xbb,
-    0xb7, 0xbb, 0xbb, 0xbb, 0xc1, 0xc1, 0xbb, 0xc6, 0xcb, 0xcb, 0xc6, 0xb7,
-    0xcb, 0xb7, 0x7f, 0x55, 0xb7, 0xb7, 0xbb, 0xbb, 0xa7, 0x8d, 0xa6, 0x98,
-    0xa6, 0xa6, 0xbb, 0xb1, 0x8d, 0xa5, 0xa6, 0x9c, 0xc1, 0xa5, 0xa9, 0x71,
-    0x4b, 0x77, 0x5c, 0x97, 0xbb, 0x7e, 0x71, 0xa2, 0xb1, 0xb0, 0xa2, 0xa5,
-    0xab, 0xa5, 0xb5, 0xb1, 0x6a, 0x65, 0x2c, 0x0e, 0x03, 0x0e, 0x0b, 0x2c,
-    0x26, 0x1c, 0x2c, 0x1a, 0x1c, 0x12, 0x3e, 0x5e, 0x6a, 0x4b, 0x76, 0x94,
-    0x5e, 0x5e, 0x1f, 0x23, 0x15, 0x0b, 0x21, 0x1f, 0x26, 0x15, 0x11, 0x06,
-    0x0e, 0x13, 0x54, 0x13, 0x01, 0x54, 0x54, 0x2d, 0x49, 0x3e, 0x36, 0x36,
-    0x6c, 0x54, 0x04, 0x49, 0x5b, 0x5b, 0x5b, 0x2d, 0x0c, 0x06, 0x01, 0x02,
-    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x24, 0x5a, 0x73, 0x33, 0x3f,
-    0x07, 0x53, 0x42, 0x53, 0x66, 0x53, 0x5a, 0x3f, 0x07, 0x18, 0x10, 0x0c,
-    0x3a, 0x3f, 0x10, 0x0c, 0x09, 0x1e, 0x22, 0x17, 0x33, 0x33, 0x28, 0x1b,
-    0x06, 0x06, 0x07, 0x04, 0x14, 0x17, 0x03, 0x01, 0x3c, 0x01, 0x02, 0x01,
-    0x2e, 0x3a, 0x17, 0x09, 0x22, 0x2e, 0x2e, 0x2f, 0x3c, 0x4d, 0x52, 0x3c,
-    0x46, 0x4d, 0x4d, 0x24, 0x0c, 0x01, 0x07, 0x58, 0x46, 0x46, 0x66, 0x33,
-    0x06, 0x05, 0x0c, 0x35, 0x06, 0x06, 0x35, 0x06, 0x01, 0x06, 0x67, 0x0f,
-    0x20, 0x0f, 0x23, 0x49, 0x50, 0x5b, 0x64, 0x31, 0x04, 0x06, 0x03, 0x18,
-    0x54, 0x64, 0x2d, 0x1b, 0x2d, 0x3e, 0x5e, 0x73, 0x3d, 0x5b, 0x75, 0x96,
-    0x96, 0x96, 0x68, 0x0f, 0x05, 0x83, 0xa4, 0x9e, 0xa4, 0x9e, 0x1f, 0x06,
-    0x05, 0x02, 0x13, 0x4b, 0x06, 0x05, 0x04, 0x05, 0x0b, 0x26, 0x83, 0x71,
-    0x75, 0x8c, 0x61, 0x26, 0x83, 0x8c, 0x7e, 0x36, 0x16, 0x08, 0x69, 0x55,
-    0x71, 0x61, 0x9c, 0xa8, 0xab, 0x7e, 0xa2, 0x8c, 0xa5, 0x9c, 0xb5, 0xa9,
-    0xa9, 0xa9, 0xa2, 0x98, 0x77, 0x8d, 0x8d, 0x77, 0xa6, 0x36, 0x41, 0x26,
-    0x2c, 0x85, 0xb1, 0xa9, 0xc1, 0xa5, 0xa5, 0xa9, 0xb1, 0xc1, 0xc4, 0xc6,
-    0xb7, 0xbb, 0xa6, 0x8d, 0x55, 0x7f, 0xa6, 0xbb, 0xa7, 0x97, 0x9d, 0xb7,
-    0x9d, 0xa6, 0xbb, 0xc6, 0xbb, 0xb7, 0xd0, 0xbb, 0xc1, 0xbb, 0xc1, 0xbb,
-    0xb2, 0xcb, 0xc9, 0xcb, 0xc6, 0xc6, 0xc6, 0xd1, 0xcb, 0xc6, 0xc6, 0xbb,
-    0xbb, 0xbb, 0xc6, 0xc6, 0xc6, 0xc1, 0xc6, 0xbb, 0xbb, 0xcb, 0xb2, 0x7f,
-    0x74, 0xb1, 0xcb, 0xb7, 0xb7, 0x65, 0x97, 0x6e, 0x7e, 0xb1, 0xbf, 0x7e,
-    0x71, 0xb8, 0x65, 0x7e, 0x98, 0x5f, 0x8d, 0x85, 0x6e, 0xa5, 0x47, 0x71,
-    0x85, 0xa5, 0xa2, 0x6a, 0x85, 0x85, 0x7e, 0x69, 0x8d, 0x85, 0x8d, 0x5c,
-    0x5e, 0x44, 0x0b, 0x26, 0x2c, 0x16, 0x16, 0x26, 0x44, 0x4b, 0x26, 0x1c,
-    0x2c, 0x0b, 0x15, 0x4b, 0x5e, 0x2c, 0x16, 0x4b, 0x36, 0x55, 0x34, 0x15,
-    0x11, 0x54, 0x15, 0x13, 0x1f, 0x36, 0x0b, 0x05, 0x0b, 0x0e, 0x0b, 0x27,
-    0x06, 0x1c, 0x83, 0x27, 0x3d, 0x81, 0x76, 0x1d, 0x54, 0x76, 0x1d, 0x5b,
-    0x73, 0x7d, 0x13, 0x0b, 0x05, 0x03, 0x01, 0x02, 0x01, 0x00, 0x00, 0x05,
-    0x12, 0x2b, 0x1b, 0x67, 0x7b, 0x5b, 0x20, 0x1e, 0x10, 0x53, 0x42, 0x5a,
-    0x67, 0x3f, 0x33, 0x1e, 0x3f, 0x53, 0x1e, 0x13, 0x2a, 0x33, 0x24, 0x0c,
-    0x07, 0x24, 0x28, 0x33, 0x4f, 0x28, 0x33, 0x1e, 0x07, 0x04, 0x10, 0x03,
-    0x09, 0x17, 0x07, 0x01, 0x22, 0x01, 0x02, 0x07, 0x33, 0x10, 0x14, 0x28,
-    0x28, 0x3c, 0x52, 0x3c, 0x40, 0x3a, 0x58, 0x3a, 0x40, 0x52, 0x33, 0x1e,
-    0x14, 0x05, 0x01, 0x33, 0x4d, 0x46, 0x58, 0x58, 0x1b, 0x05, 0x03, 0x07,
-    0x1e, 0x24, 0x27, 0x0b, 0x06, 0x50, 0x31, 0x07, 0x15, 0x0c, 0x50, 0x5b,
-    0x50, 0x7b, 0x73, 0x31, 0x15, 0x06, 0x05, 0x29, 0x54, 0x0f, 0x13, 0x54,
-    0x68, 0x68, 0x75, 0x5b, 0x68, 0x75, 0x78, 0x8f, 0x96, 0x96, 0x68, 0x0c,
-    0x13, 0xa4, 0xa4, 0xa4, 0x96, 0x96, 0x36, 0x04, 0x06, 0x03, 0x08, 0x85,
-    0x27, 0x03, 0x05, 0x1a, 0x83, 0x3e, 0x1a, 0x1a, 0x71, 0x59, 0x6a, 0x26,
-    0x71, 0x76, 0x94, 0x3e, 0x1f, 0x15, 0x3e, 0xa2, 0xb5, 0x90, 0x7e, 0xb1,
-    0x94, 0x8c, 0x7e, 0x77, 0x71, 0xac, 0xba, 0x90, 0xa2, 0xb1, 0x9c, 0xb7,
-    0xa6, 0x94, 0xa2, 0xa6, 0x98, 0x1f, 0x11, 0x65, 0xa9, 0xbf, 0x9c, 0xb1,
-    0xb1, 0xac, 0xa9, 0xa6, 0xb7, 0xa9, 0xb7, 0xc1, 0xc4, 0xbb, 0xc1, 0xa6,
-    0x74, 0x3e, 0x2c, 0xb8, 0xbe, 0xb1, 0x97, 0xb2, 0xb7, 0x97, 0x98, 0xc1,
-    0xb7, 0xa9, 0xbe, 0xb1, 0xbe, 0xb2, 0xb2, 0xb8, 0x9d, 0xc6, 0xc1, 0xbb,
-    0xcb, 0xc9, 0xc6, 0xc6, 0xd1, 0xd1, 0xd1, 0xcb, 0xbb, 0xc1, 0xcb, 0xc6,
-    0xbe, 0xc6, 0xcb, 0xcb, 0xb2, 0xc6, 0xbb, 0x9d, 0x41, 0x74, 0xb2, 0xb2,
-    0xbb, 0x8d, 0x65, 0x41, 0x98, 0x9d, 0xbf, 0x7e, 0x98, 0x9c, 0x6e, 0x9d,
-    0x65, 0x5f, 0x34, 0x85, 0x85, 0x71, 0x71, 0x74, 0x97, 0xb5, 0xb5, 0xa5,
-    0xa9, 0x9a, 0xa9, 0x61, 0x5e, 0x8c, 0x94, 0x69, 0x4b, 0x0b, 0x11, 0x0e,
-    0x16, 0x12, 0x1a, 0x21, 0x16, 0x4b, 0x4b, 0x2c, 0x51, 0x7a, 0x77, 0x71,
-    0x5f, 0x0b, 0x05, 0x15, 0x18, 0x5f, 0x13, 0x1d, 0x54, 0x5e, 0x3e, 0x2d,
-    0x4b, 0x2d, 0x36, 0x03, 0x06, 0x05, 0x0b, 0x15, 0x0b, 0x11, 0x3e, 0x49,
-    0x23, 0x8a, 0x8f, 0x81, 0x3d, 0x5b, 0x54, 0x1c, 0x49, 0x2b, 0x06, 0x01,
-    0x01, 0x01, 0x00, 0x01, 0x01, 0x04, 0x1b, 0x7d, 0x50, 0x3f, 0x4c, 0x42,
-    0x1d, 0x15, 0x42, 0x04, 0x64, 0x1e, 0x31, 0x24, 0x24, 0x46, 0x0c, 0x14,
-    0x5a, 0x4f, 0x24, 0x10, 0x17, 0x14, 0x3f, 0x1e, 0x1e, 0x17, 0x33, 0x53,
-    0x58, 0x14, 0x33, 0x14, 0x10, 0x10, 0x14, 0x0c, 0x07, 0x10, 0x14, 0x04,
-    0x04, 0x02, 0x01, 0x0d, 0x07, 0x17, 0x28, 0x2e, 0x3a, 0x4d, 0x52, 0x52,
-    0x40, 0x3a, 0x46, 0x3c, 0x4d, 0x52, 0x4d, 0x22, 0x3a, 0x06, 0x01, 0x06,
-    0x53, 0x4f, 0x58, 0x62, 0x42, 0x10, 0x06, 0x05, 0x50, 0x53, 0x1d, 0x0c,
-    0x0c, 0x50, 0x0c, 0x07, 0x12, 0x3d, 0x42, 0x67, 0x31, 0x50, 0x54, 0x23,
-    0x1a, 0x05, 0x06, 0x0f, 0x13, 0x1a, 0x64, 0x64, 0x78, 0x68, 0x78, 0x68,
-    0x81, 0x6f, 0x78, 0x75, 0x96, 0x96, 0x59, 0x0b, 0x2d, 0xa4, 0xa4, 0xa4,
-    0xa4, 0x96, 0x61, 0x0e, 0x08, 0x01, 0x03, 0x16, 0x1c, 0x05, 0x03, 0x2c,
-    0x36, 0x0b, 0x05, 0x0a, 0x77, 0xa8, 0x83, 0x94, 0x55, 0x1f, 0x34, 0x15,
-    0x26, 0x1f, 0x2c, 0x77, 0xab, 0x90, 0x77, 0x61, 0x6a, 0x71, 0xa8, 0xb0,
-    0x94, 0x65, 0x7e, 0x9a, 0xb1, 0xb1, 0xa5, 0x94, 0x90, 0x98, 0x8d, 0xb1,
-    0x57, 0x1f, 0x6e, 0xb7, 0xbf, 0xbb, 0xa9, 0x98, 0xb1, 0xb1, 0xc1, 0xb1,
-    0xc6, 0xc6, 0xb3, 0xc1, 0xa5, 0x98, 0xcb, 0xb7, 0xbe, 0xa7, 0x88, 0x85,
-    0xbb, 0xc6, 0xb7, 0xb8, 0xb2, 0xb3, 0x8d, 0xb2, 0xc1, 0x9d, 0xb2, 0xb8,
-    0xb8, 0xb2, 0xbb, 0xb8, 0xb2, 0xb2, 0xc6, 0xc6, 0xc6, 0xc9, 0xd1, 0xc6,
-    0xc6, 0xcb, 0xd1, 0xd1, 0xcb, 0xbe, 0xbb, 0xc1, 0x65, 0x97, 0xd0, 0xd1,
-    0xc6, 0xa7, 0x97, 0xc1, 0x7f, 0x97, 0x41, 0xb8, 0xb1, 0xa7, 0x74, 0x36,
-    0xc1, 0x65, 0xac, 0x7e, 0xa6, 0xa2, 0x8d, 0xa5, 0xba, 0x7e, 0x8d, 0x85,
-    0x98, 0x69, 0x4b, 0x77, 0xa2, 0xb0, 0x9c, 0xba, 0xba, 0xa6, 0x8c, 0xb1,
-    0x9c, 0x94, 0x98, 0x27, 0x71, 0x51, 0x06, 0x5f, 0x44, 0x1c, 0x1f, 0x2c,
-    0x6e, 0x85, 0x5c, 0x6a, 0x7a, 0x6a, 0xac, 0x69, 0x54, 0x36, 0x55, 0x2d,
-    0x1f, 0x06, 0x1c, 0x71, 0x36, 0x5e, 0x55, 0x13, 0x3e, 0x3e, 0x54, 0x1f,
-    0x12, 0x11, 0x06, 0x0b, 0x0b, 0x08, 0x05, 0x23, 0x15, 0x31, 0x8a, 0x81,
-    0x1d, 0x54, 0x6f, 0x0b, 0x05, 0x01, 0x06, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x7d, 0x31, 0x67, 0x42, 0x2a, 0x87, 0x42, 0x0c, 0x14, 0x06, 0x1b,
-    0x5a, 0x4c, 0x46, 0x24, 0x2a, 0x1b, 0x10, 0x42, 0x29, 0x50, 0x17, 0x2a,
-    0x28, 0x10, 0x2a, 0x3a, 0x46, 0x46, 0x24, 0x17, 0x1e, 0x1b, 0x10, 0x07,
-    0x0c, 0x04, 0x0b, 0x06, 0x01, 0x03, 0x07, 0x04, 0x01, 0x02, 0x01, 0x04,
-    0x17, 0x3a, 0x3a, 0x40, 0x4d, 0x4d, 0x4d, 0x3c, 0x4d, 0x4d, 0x46, 0x3a,
-    0x4d, 0x52, 0x58, 0x58, 0x24, 0x14, 0x03, 0x01, 0x17, 0x4f, 0x53, 0x66,
-    0x67, 0x29, 0x0b, 0x04, 0x15, 0x0c, 0x04, 0x04, 0x1d, 0x0c, 0x12, 0x0c,
-    0x1b, 0x7b, 0x49, 0x64, 0x53, 0x67, 0x23, 0x06, 0x0c, 0x05, 0x06, 0x3d,
-    0x23, 0x15, 0x81, 0x31, 0x78, 0x49, 0x67, 0x68, 0x81, 0x76, 0x8f, 0x68,
-    0x7a, 0x96, 0x36, 0x0b, 0x49, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0x81, 0x1a,
-    0x05, 0x02, 0x01, 0x03, 0x04, 0x16, 0x04, 0x12, 0x08, 0x05, 0x0b, 0x65,
-    0x83, 0x8c, 0xb0, 0xa2, 0x1f, 0x04, 0x34, 0x0b, 0x1f, 0x26, 0xac, 0x2c,
-    0x34, 0x5f, 0x7a, 0xb1, 0xb5, 0x77, 0xb5, 0xba, 0xaf, 0xba, 0x9c, 0x74,
-    0x77, 0x71, 0x98, 0xb3, 0xb1, 0x98, 0xa9, 0x77, 0x13, 0x7f, 0xb7, 0xa6,
-    0x98, 0x98, 0xbb, 0xb1, 0xa9, 0xb7, 0xc6, 0xb7, 0xc1, 0xc9, 0xb8, 0x65,
-    0xb2, 0xbb, 0xb7, 0xb8, 0xbb, 0xc6, 0xc6, 0xbb, 0xb2, 0xc1, 0xc6, 0xbb,
-    0x9d, 0xb1, 0xb2, 0x85, 0xa6, 0xbb, 0xb1, 0xb2, 0xb2, 0xb2, 0xb3, 0x9d,
-    0xbe, 0xc1, 0xc1, 0xc6, 0xc6, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1,
-    0xcb, 0xd1, 0xc6, 0xcb, 0xbe, 0x99, 0x51, 0x97, 0xcb, 0xb2, 0xbe, 0xd1,
-    0x7f, 0xb2, 0x7f, 0x57, 0xb2, 0xb8, 0x9d, 0x97, 0x85, 0xb1, 0xa5, 0xc1,
-    0xc1, 0xb7, 0xb7, 0xa9, 0xbf, 0xbb, 0x7e, 0xbb, 0x8d, 0x97, 0x8c, 0x74,
-    0x94, 0xbf, 0xb1, 0xaf, 0xb7, 0x7e, 0x6a, 0x71, 0x8d, 0x4b, 0x13, 0x51,
-    0x5c, 0x11, 0x2c, 0x26, 0x5c, 0x12, 0x02, 0x6e, 0x8d, 0x77, 0x5e, 0xa5,
-    0x8d, 0x4b, 0x54, 0x34, 0x26, 0x15, 0x15, 0x0b, 0x16, 0x03, 0x12, 0x69,
-    0x51, 0x7a, 0x69, 0x3e, 0x3e, 0x36, 0x36, 0x9b, 0x2d, 0x13, 0x16, 0x11,
-    0x12, 0x1c, 0x15, 0x0c, 0x3e, 0x5e, 0x31, 0x23, 0x26, 0x0b, 0x06, 0x01,
-    0x00, 0x01, 0x01, 0x01, 0x0b, 0x0c, 0x3d, 0x0c, 0x1b, 0x7d, 0x67, 0x50,
-    0x24, 0x2a, 0x2a, 0x1b, 0x20, 0x56, 0x01, 0x31, 0x67, 0x70, 0x4f, 0x31,
-    0x2a, 0x1b, 0x67, 0x53, 0x33, 0x33, 0x4f, 0x58, 0x58, 0x1b, 0x18, 0x33,
-    0x33, 0x28, 0x1e, 0x24, 0x17, 0x1b, 0x17, 0x17, 0x17, 0x07, 0x04, 0x01,
-    0x01, 0x01, 0x01, 0x07, 0x01, 0x01, 0x03, 0x22, 0x3a, 0x3c, 0x52, 0x40,
-    0x40, 0x40, 0x4d, 0x4d, 0x4d, 0x58, 0x4d, 0x40, 0x3c, 0x52, 0x58, 0x62,
-    0x4f, 0x1e, 0x06, 0x03, 0x04, 0x24, 0x3f, 0x58, 0x58, 0x53, 0x14, 0x15,
-    0x04, 0x01, 0x05, 0x06, 0x29, 0x0b, 0x13, 0x13, 0x56, 0x73, 0x31, 0x67,
-    0x5b, 0x6c, 0x1f, 0x01, 0x0b, 0x0b, 0x08, 0x42, 0x1a, 0x04, 0x54, 0x5b,
-    0x68, 0x81, 0x5e, 0x87, 0x8a, 0x75, 0x81, 0x95, 0x7d, 0x68, 0x1f, 0x05,
-    0x3d, 0x95, 0xa4, 0xa4, 0x9b, 0xa4, 0x9b, 0x1d, 0x0b, 0x03, 0x00, 0x03,
-    0x03, 0x0b, 0x12, 0x1a, 0x2c, 0x1c, 0x74, 0x8f, 0x3e, 0x77, 0x51, 0x13,
-    0x5c, 0x9c, 0x0e, 0x05, 0x0b, 0x26, 0x4b, 0x65, 0x4b, 0x71, 0x7e, 0x85,
-    0x9c, 0x8c, 0x83, 0xba, 0xb5, 0xbf, 0xa2, 0x9a, 0xb7, 0xb1, 0xb7, 0xa2,
-    0x9c, 0x9c, 0x8d, 0x1f, 0x57, 0x85, 0x85, 0x98, 0xb7, 0xb1, 0xba, 0xa6,
-    0xbb, 0xc6, 0xc4, 0xc6, 0xbb, 0xb2, 0x77, 0xbb, 0xbb, 0xa6, 0xa6, 0x3e,
-    0x16, 0x34, 0xc6, 0xc6, 0xb3, 0xbb, 0xc1, 0xb2, 0xb7, 0xaa, 0x9d, 0xb8,
-    0x9d, 0xa6, 0xbb, 0xbb, 0x8d, 0x99, 0xb7, 0xb8, 0xc1, 0xc6, 0xcb, 0xc1,
-    0xc1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xc8, 0xa7, 0xcb, 0xcb,
-    0xd1, 0xc6, 0xd1, 0xbe, 0x8d, 0x99, 0x9d, 0xd1, 0xb3, 0x7f, 0xd1, 0x99,
-    0x55, 0xbe, 0x97, 0x9c, 0x7f, 0x9d, 0xb2, 0x9d, 0xbb, 0xc1, 0xc1, 0x97,
-    0xc4, 0xb1, 0xb1, 0x77, 0x85, 0xb7, 0xa2, 0x7e, 0x65, 0x77, 0xb7, 0xa9,
-    0xb5, 0x85, 0x97, 0x74, 0x2c, 0x4b, 0x3e, 0x7e, 0x2d, 0x0e, 0x26, 0x7e,
-    0x8d, 0x15, 0x26, 0x7e, 0x36, 0x26, 0x26, 0x16, 0x06, 0x04, 0x0b, 0x15,
-    0x1f, 0x16, 0x0b, 0x11, 0x05, 0x01, 0x05, 0x03, 0x06, 0x0b, 0x15, 0x13,
-    0x41, 0x69, 0x26, 0x75, 0x64, 0x1f, 0x1c, 0x1c, 0x27, 0x11, 0x2d, 0x21,
-    0x8a, 0x84, 0x92, 0x06, 0x0b, 0x01, 0x01, 0x01, 0x02, 0x01, 0x0c, 0x21,
-    0x0b, 0x2b, 0x67, 0x06, 0x87, 0x67, 0x23, 0x29, 0x7b, 0x67, 0x23, 0x20,
-    0x20, 0x07, 0x0c, 0x3f, 0x42, 0x67, 0x67, 0x0c, 0x14, 0x53, 0x58, 0x67,
-    0x33, 0x33, 0x53, 0x4f, 0x58, 0x33, 0x1b, 0x2a, 0x33, 0x33, 0x1e, 0x1e,
-    0x17, 0x24, 0x17, 0x28, 0x14, 0x14, 0x04, 0x01, 0x01, 0x01, 0x02, 0x1b,
-    0x01, 0x01, 0x04, 0x40, 0x3a, 0x3c, 0x40, 0x40, 0x4d, 0x52, 0x52, 0x4d,
-    0x40, 0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x15, 0x0c,
-    0x03, 0x06, 0x3f, 0x5a, 0x5a, 0x62, 0x42, 0x20, 0x07, 0x01, 0x05, 0x07,
-    0x1d, 0x0e, 0x0b, 0x1b, 0x73, 0x67, 0x29, 0x67, 0x50, 0x64, 0x06, 0x01,
-    0x13, 0x08, 0x05, 0x3d, 0x54, 0x0e, 0x3e, 0x73, 0x3d, 0x5b, 0x6c, 0x8a,
-    0x96, 0x68, 0x6f, 0x96, 0x96, 0x81, 0x1d, 0x05, 0x59, 0x75, 0x96, 0x9b,
-    0x96, 0x95, 0x9e, 0x36, 0x15, 0x0b, 0x00, 0x01, 0x08, 0x0b, 0x43, 0x71,
-    0x5c, 0x05, 0x0e, 0x13, 0x26, 0x27, 0x4b, 0xa5, 0x9c, 0x1f, 0x05, 0x05,
-    0x1a, 0x61, 0x85, 0xb1, 0xb1, 0x5c, 0x94, 0x9c, 0x4b, 0x77, 0x8d, 0x8c,
-    0xa9, 0xac, 0xb1, 0xb5, 0xb5, 0xba, 0xba, 0xa2, 0xa2, 0xb2, 0x2d, 0x1f,
-    0x9c, 0xb1, 0xac, 0xb1, 0xb7, 0xc6, 0xc4, 0xb7, 0xbb, 0xc4, 0xc6, 0xbb,
-    0xa6, 0x98, 0xd0, 0xc6, 0xb8, 0x98, 0xc1, 0xc6, 0xc6, 0x97, 0xa7, 0xcb,
-    0xcb, 0xbb, 0xc1, 0xb1, 0xbe, 0x99, 0xa6, 0x97, 0xb2, 0xbe, 0xc1, 0xbb,
-    0xbe, 0xc1, 0xc6, 0xc1, 0xd1, 0xb8, 0xc6, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1,
-    0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xcb, 0xc6, 0xbe, 0xcb, 0xc6, 0xd1, 0xd1,
-    0xc8, 0x7f, 0x97, 0xb8, 0xb2, 0x5f, 0xd1, 0x41, 0x5f, 0x41, 0x7f, 0x98,
-    0x88, 0x7f, 0x4b, 0xa6, 0x71, 0xb3, 0x98, 0x74, 0xb7, 0x9d, 0xb7, 0xa5,
-    0x65, 0x9c, 0x8d, 0x74, 0x65, 0x16, 0xa5, 0xa9, 0x9a, 0x74, 0x4b, 0x2c,
-    0x51, 0x61, 0x8c, 0x51, 0x1f, 0x26, 0x5f, 0x26, 0x16, 0x15, 0x2c, 0x1f,
-    0x0e, 0x06, 0x11, 0x1f, 0x77, 0x6a, 0xac, 0x85, 0x94, 0x2d, 0x36, 0x36,
-    0x0e, 0x26, 0x4b, 0x1c, 0x11, 0x0b, 0x05, 0x0b, 0x08, 0x0b, 0x11, 0x0b,
-    0x36, 0x47, 0x21, 0x1f, 0x12, 0x1a, 0x1f, 0x0e, 0x64, 0x4b, 0x1f, 0x03,
-    0x01, 0x05, 0x05, 0x03, 0x06, 0x06, 0x54, 0x23, 0x1b, 0x31, 0x15, 0x15,
-    0x87, 0x67, 0x23, 0x24, 0x73, 0x5b, 0x14, 0x31, 0x42, 0x03, 0x25, 0x33,
-    0x24, 0x50, 0x3f, 0x0c, 0x70, 0x67, 0x66, 0x63, 0x53, 0x5a, 0x3f, 0x46,
-    0x33, 0x1e, 0x1e, 0x28, 0x17, 0x28, 0x1e, 0x1e, 0x28, 0x2a, 0x33, 0x14,
-    0x10, 0x07, 0x01, 0x01, 0x01, 0x01, 0x04, 0x09, 0x02, 0x01, 0x0d, 0x3c,
-    0x3a, 0x3a, 0x3c, 0x40, 0x52, 0x4d, 0x4d, 0x4d, 0x4d, 0x52, 0x4d, 0x4d,
-    0x58, 0x52, 0x3a, 0x4d, 0x4d, 0x4d, 0x4f, 0x17, 0x0b, 0x01, 0x33, 0x5a,
-    0x5a, 0x62, 0x63, 0x29, 0x12, 0x06, 0x04, 0x12, 0x15, 0x0e, 0x06, 0x3d,
-    0x5b, 0x64, 0x50, 0x68, 0x3f, 0x2d, 0x0b, 0x01, 0x20, 0x01, 0x04, 0x1f,
-    0x50, 0x1d, 0x13, 0x2d, 0x49, 0x31, 0x7a, 0x75, 0x75, 0x81, 0x78, 0x75,
-    0x81, 0x83, 0x2d, 0x06, 0x3e, 0xa4, 0x9b, 0x7a, 0x8f, 0x8a, 0x9b, 0x61,
-    0x0b, 0x06, 0x01, 0x01, 0x5e, 0x36, 0x90, 0x61, 0x06, 0x16, 0x7e, 0xa1,
-    0xb5, 0xaf, 0x5e, 0x36, 0x05, 0x05, 0x06, 0x71, 0x61, 0x59, 0x9a, 0x85,
-    0x8d, 0xb5, 0x9a, 0x77, 0x5e, 0x8d, 0x94, 0xa2, 0x98, 0x94, 0xb5, 0xb5,
-    0xba, 0xb1, 0xa5, 0x8d, 0xb1, 0x5c, 0x5f, 0x51, 0x88, 0x9d, 0xb7, 0xb1,
-    0xbb, 0xc6, 0xc1, 0xb1, 0xb7, 0xb7, 0xb7, 0xb7, 0xb8, 0xc9, 0xc6, 0x6e,
-    0x4b, 0xbb, 0xc1, 0xc6, 0xc9, 0xc1, 0xd1, 0xd0, 0xcb, 0xc6, 0xcb, 0xc6,
-    0xa6, 0xa7, 0xb2, 0xb8, 0x99, 0xa7, 0xbe, 0xbe, 0xbe, 0xbb, 0xbb, 0xb8,
-    0xc6, 0xc1, 0xcb, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1,
-    0xd1, 0xd1, 0xd1, 0xc6, 0xc6, 0xd1, 0xd1, 0xd1, 0xc6, 0xc6, 0x9d, 0x6e,
-    0x34, 0x44, 0x97, 0x97, 0x8d, 0x34, 0x74, 0x9d, 0x41, 0x88, 0x7f, 0x74,
-    0xbb, 0xb7, 0x8d, 0x5f, 0x4b, 0x9d, 0xac, 0x98, 0x9c, 0x88, 0x7e, 0x77,
-    0x8d, 0x98, 0x8c, 0x71, 0x26, 0x13, 0x26, 0x9c, 0x55, 0x3e, 0x16, 0x55,
-    0x65, 0x7e, 0x5c, 0x34, 0x11, 0x05, 0x0e, 0x26, 0x36, 0x55, 0x5f, 0x4b,
-    0x94, 0x9c, 0x3b, 0x3e, 0x3e, 0x2d, 0x4b, 0x11, 0x3e, 0x6a, 0x69, 0x26,
-    0x36, 0x5e, 0x36, 0x5e, 0x1f, 0x0b, 0x05, 0x05, 0x0b, 0x0c, 0x05, 0x0b,
-    0x0e, 0x12, 0x1a, 0x15, 0x0b, 0x05, 0x01, 0x01, 0x05, 0x1a, 0x54, 0x26,
-    0x13, 0x06, 0x20, 0x10, 0x54, 0x1a, 0x05, 0x25, 0x73, 0x64, 0x50, 0x3d,
-    0x82, 0x54, 0x12, 0x73, 0x2a, 0x20, 0x2a, 0x67, 0x3d, 0x67, 0x2a, 0x24,
-    0x42, 0x3f, 0x35, 0x67, 0x5a, 0x7b, 0x2e, 0x33, 0x58, 0x2a, 0x2a, 0x28,
-    0x1b, 0x1e, 0x33, 0x33, 0x17, 0x1e, 0x1e, 0x1e, 0x29, 0x09, 0x05, 0x02,
-    0x03, 0x04, 0x05, 0x07, 0x02, 0x01, 0x46, 0x3a, 0x2e, 0x40, 0x52, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x3c, 0x52, 0x4d, 0x58, 0x4d, 0x58, 0x4f, 0x52,
-    0x62, 0x58, 0x62, 0x3a, 0x20, 0x04, 0x1b, 0x4f, 0x53, 0x66, 0x63, 0x53,
-    0x23, 0x12, 0x0c, 0x14, 0x12, 0x06, 0x1d, 0x5b, 0x3d, 0x3d, 0x5b, 0x42,
-    0x49, 0x29, 0x27, 0x0b, 0x13, 0x08, 0x04, 0x1f, 0x3d, 0x5b, 0x1d, 0x0b,
-    0x54, 0x49, 0x49, 0x68, 0x78, 0x81, 0x78, 0x7a, 0x75, 0x75, 0x36, 0x0b,
-    0x1f, 0xa4, 0x8a, 0x68, 0x6f, 0x7a, 0x8f, 0x7a, 0x05, 0x01, 0x00, 0x0c,
-    0x9e, 0x94, 0x69, 0x1a, 0x26, 0x6a, 0x9e, 0x8c, 0x8c, 0x71, 0x16, 0x05,
-    0x01, 0x11, 0x71, 0xb5, 0xab, 0x51, 0x5c, 0x9a, 0xa9, 0xa2, 0xaf, 0xa2,
-    0x98, 0x9a, 0x8c, 0x85, 0x85, 0xb2, 0xa5, 0xac, 0xa9, 0x97, 0x9c, 0x8d,
-    0x7f, 0x2c, 0x44, 0x4b, 0x34, 0x5c, 0x65, 0x6e, 0x9d, 0xa6, 0xa6, 0x9c,
-    0xac, 0x9d, 0xb7, 0xc6, 0xbb, 0xc1, 0x99, 0x26, 0xb8, 0xa6, 0xb8, 0xcb,
-    0xcb, 0xc6, 0xd1, 0xd1, 0xd1, 0xcb, 0xc6, 0xc1, 0xa6, 0xb2, 0xb8, 0xb8,
-    0xa7, 0xb8, 0xb8, 0xc8, 0xb8, 0xb2, 0xb8, 0xb8, 0xc1, 0xd1, 0xc6, 0xd8,
-    0xd1, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd1, 0xd1, 0xd1, 0xd1, 0xcb, 0xd1,
-    0xbb, 0xd1, 0xd1, 0xc6, 0xcb, 0xcb, 0xb3, 0xd1, 0x97, 0x99, 0x6e, 0x77,
-    0xa7, 0x98, 0xc9, 0x97, 0x34, 0x34, 0x5f, 0x8d, 0xac, 0xac, 0xc1, 0xa5,
-    0x6e, 0x41, 0x44, 0x94, 0xc1, 0x77, 0x85, 0x8d, 0xa2, 0xba, 0x77, 0x3e,
-    0x0e, 0x4b, 0x3e, 0x4b, 0x47, 0x5c, 0x4b, 0x4b, 0x2c, 0x12, 0x1f, 0x15,
-    0x1c, 0x1f, 0x5f, 0x36, 0x6a, 0x2c, 0x69, 0x5e, 0x65, 0x6a, 0x15, 0x27,
-    0x7a, 0xa1, 0x54, 0x27, 0xab, 0x83, 0x6a, 0x3e, 0x4b, 0x1d, 0x71, 0x64,
-    0x69, 0x2d, 0x26, 0x27, 0x1c, 0x15, 0x1a, 0x15, 0x01, 0x01, 0x06, 0x04,
-    0x01, 0x01, 0x11, 0x1c, 0x49, 0x84, 0x15, 0x36, 0x12, 0x0b, 0x12, 0x1a,
-    0x31, 0x18, 0x1c, 0x29, 0x7d, 0x6c, 0x29, 0x67, 0x82, 0x49, 0x18, 0x56,
-    0x0c, 0x7b, 0x24, 0x67, 0x67, 0x1e, 0x23, 0x66, 0x67, 0x2a, 0x1e, 0x3f,
-    0x63, 0x63, 0x58, 0x70, 0x66, 0x3f, 0x33, 0x33, 0x33, 0x10, 0x24, 0x28,
-    0x1e, 0x33, 0x0c, 0x0d, 0x07, 0x04, 0x01, 0x01, 0x0b, 0x07, 0x06, 0x03,
-    0x01, 0x17, 0x40, 0x40, 0x40, 0x40, 0x40, 0x4d, 0x4d, 0x4d, 0x40, 0x4d,
-    0x3c, 0x40, 0x4d, 0x58, 0x4d, 0x52, 0x58, 0x62, 0x58, 0x58, 0x62, 0x4f,
-    0x1e, 0x06, 0x04, 0x5a, 0x42, 0x66, 0x66, 0x66, 0x50, 0x12, 0x15, 0x12,
-    0x06, 0x04, 0x42, 0x50, 0x50, 0x23, 0x31, 0x29, 0x31, 0x5b, 0x5b, 0x27,
-    0x1a, 0x11, 0x06, 0x3e, 0x3d, 0x81, 0x1d, 0x23, 0x4e, 0x49, 0x3d, 0x31,
-    0x4e, 0x68, 0x6f, 0x5e, 0x4e, 0x68, 0x4e, 0x0b, 0x4b, 0x75, 0x6f, 0x7a,
-    0x68, 0x8c, 0x8a, 0x9b, 0x0b, 0x01, 0x01, 0x20, 0x95, 0x75, 0x23, 0x1f,
-    0x83, 0x83, 0x8f, 0x77, 0x1f, 0x05, 0x01, 0x06, 0x3e, 0x8c, 0xba, 0xab,
-    0xa9, 0xa5, 0x5c, 0x51, 0x94, 0xaf, 0x9a, 0xa9, 0xb1, 0xa9, 0xb1, 0x98,
-    0x8c, 0xb7, 0x97, 0x8d, 0x8d, 0x9d, 0xa2, 0x6e, 0x1f, 0x6e, 0xb1, 0x8d,
-    0x7f, 0xb1, 0xa6, 0x7e, 0x71, 0x98, 0x85, 0x85, 0x8d, 0x97, 0xa6, 0xb7,
-    0xb2, 0xb8, 0x55, 0xa7, 0xb8, 0x85, 0xc8, 0xbb, 0xd1, 0xcb, 0xc1, 0xd1,
-    0xcb, 0xd1, 0xd1, 0xc6, 0xbe, 0xcb, 0xb2, 0xb8, 0xb8, 0x99, 0xb8, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xd1, 0xd2, 0xd1, 0xc6, 0xd1, 0xd8, 0xd8, 0xd8, 0xd8,
-    0xd8, 0xd8, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xd1, 0xd1, 0xc6,
-    0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc9, 0xb2, 0x41, 0x85, 0xac, 0xac, 0xbb,
-    0xac, 0x6e, 0x44, 0x5e, 0xa6, 0x6e, 0x69, 0x8d, 0x6e, 0x41, 0x26, 0x65,
-    0x8d, 0x74, 0x4b, 0x6e, 0x8d, 0x69, 0x16, 0x11, 0x1f, 0x1f, 0x6e, 0x6e,
-    0x85, 0x26, 0x0b, 0x1f, 0x12, 0x2c, 0x85, 0x55, 0x1c, 0x65, 0x83, 0x5c,
-    0x8d, 0x2d, 0x85, 0xac, 0x8c, 0x55, 0x16, 0x6a, 0xb0, 0x7a, 0x1f, 0x83,
-    0xa1, 0x54, 0x7e, 0x8c, 0x8c, 0x4b, 0x83, 0x83, 0x8c, 0x69, 0x36, 0x4b,
-    0x1f, 0x4b, 0x23, 0x5e, 0x1f, 0x05, 0x01, 0x01, 0x02, 0x01, 0x6a, 0x6c,
-    0x86, 0x27, 0x20, 0x49, 0x07, 0x0b, 0x06, 0x15, 0x3d, 0x12, 0x64, 0x5b,
-    0x5b, 0x54, 0x49, 0x64, 0x87, 0x14, 0x25, 0x15, 0x07, 0x70, 0x33, 0x67,
-    0x82, 0x20, 0x20, 0x70, 0x7b, 0x3f, 0x33, 0x53, 0x63, 0x66, 0x46, 0x70,
-    0x4d, 0x66, 0x58, 0x58, 0x3a, 0x1d, 0x1e, 0x1e, 0x46, 0x33, 0x1b, 0x0a,
-    0x05, 0x10, 0x01, 0x01, 0x04, 0x01, 0x04, 0x03, 0x02, 0x2e, 0x52, 0x40,
-    0x40, 0x4d, 0x4d, 0x4d, 0x52, 0x4d, 0x4d, 0x3c, 0x3a, 0x52, 0x58, 0x58,
-    0x58, 0x52, 0x58, 0x4d, 0x4d, 0x66, 0x66, 0x58, 0x2a, 0x06, 0x04, 0x1d,
-    0x29, 0x63, 0x66, 0x63, 0x70, 0x20, 0x15, 0x06, 0x05, 0x12, 0x42, 0x5b,
-    0x42, 0x23, 0x29, 0x5b, 0x64, 0x54, 0x78, 0x1d, 0x0b, 0x0b, 0x0b, 0x3d,
-    0x3d, 0x6c, 0x13, 0x36, 0x59, 0x59, 0x68, 0x68, 0x68, 0x59, 0x54, 0x54,
-    0x5e, 0x3d, 0x2d, 0x0e, 0x3d, 0x7a, 0x75, 0x9b, 0x6f, 0x95, 0x9e, 0x8f,
-    0x01, 0x01, 0x01, 0x26, 0x7a, 0x27, 0x0b, 0x61, 0x9c, 0x59, 0x26, 0x0b,
-    0x01, 0x08, 0x26, 0x4b, 0x94, 0xb5, 0xa8, 0xa1, 0x90, 0xa8, 0xa9, 0x5c,
-    0x3e, 0x9a, 0x9c, 0xa9, 0xa2, 0xa9, 0xb7, 0xa9, 0x85, 0x85, 0x97, 0xa2,
-    0xc1, 0xa9, 0x8d, 0x26, 0x26, 0xb1, 0xc1, 0xb7, 0x97, 0xc1, 0xbb, 0xb1,
-    0xbb, 0xb1, 0xb2, 0xa6, 0x9d, 0x88, 0x74, 0xc1, 0xb1, 0xa6, 0x9d, 0xc6,
-    0xb8, 0x9d, 0x88, 0xbe, 0xd1, 0xbb, 0xb2, 0xcb, 0xd1, 0xd1, 0xd1, 0xc6,
-    0xbe, 0xcb, 0xa7, 0xb2, 0xb8, 0xb2, 0xcb, 0xd1, 0xd1, 0xd8, 0xbe, 0xd1,
-    0xc6, 0xcb, 0xd8, 0xd1, 0xd8, 0xd8, 0xd8, 0xd8, 0xd1, 0xd8, 0xd8, 0xd8,
-    0xd1, 0xd1, 0xd1, 0xd1, 0xc6, 0xcb, 0xd1, 0xd1, 0xc6, 0xd1, 0xd0, 0xbb,
-    0xbb, 0xc9, 0xb1, 0x1c, 0x8d, 0x8d, 0x77, 0xac, 0xb1, 0x9d, 0xa5, 0x9d,
-    0x6e, 0x3e, 0x6e, 0x74, 0x65, 0x34, 0x16, 0x2c, 0x6e, 0x74, 0x34, 0x2c,
-    0x16, 0x05, 0x0b, 0x41, 0x34, 0x36, 0x5c, 0x0e, 0x16, 0x0e, 0x65, 0x6a,
-    0x55, 0x61, 0x7e, 0x6e, 0x2d, 0x3e, 0x84, 0xa5, 0x4b, 0x26, 0x54, 0x6a,
-    0x4b, 0x5c, 0x1a, 0x51, 0x77, 0x27, 0x83, 0xa1, 0x71, 0x5e, 0x83, 0x9c,
-    0x8c, 0x36, 0x8a, 0xab, 0x69, 0x3e, 0x1f, 0x1a, 0x16, 0x23, 0x23, 0x36,
-    0x26, 0x05, 0x05, 0x0b, 0x06, 0x01, 0x27, 0x76, 0x3e, 0x13, 0x23, 0x23,
-    0x12, 0x0c, 0x01, 0x0f, 0x2d, 0x3d, 0x54, 0x73, 0x86, 0x67, 0x73, 0x64,
-    0x33, 0x2d, 0x35, 0x05, 0x24, 0x3f, 0x50, 0x2a, 0x82, 0x24, 0x15, 0x53,
-    0x46, 0x24, 0x18, 0x33, 0x33, 0x46, 0x33, 0x67, 0x53, 0x66, 0x66, 0x58,
-    0x3a, 0x24, 0x33, 0x1b, 0x28, 0x28, 0x17, 0x06, 0x14, 0x1b, 0x01, 0x01,
-    0x04, 0x03, 0x06, 0x01, 0x0a, 0x40, 0x40, 0x40, 0x3a, 0x4d, 0x4d, 0x4d,
-    0x52, 0x40, 0x4d, 0x40, 0x3a, 0x52, 0x52, 0x52, 0x52, 0x62, 0x52, 0x4f,
-    0x33, 0x3f, 0x33, 0x46, 0x33, 0x0b, 0x04, 0x0f, 0x20, 0x42, 0x5a, 0x66,
-    0x72, 0x2d, 0x0b, 0x05, 0x05, 0x3d, 0x53, 0x67, 0x64, 0x31, 0x42, 0x73,
-    0x7b, 0x50, 0x6f, 0x1a, 0x15, 0x06, 0x0b, 0x2d, 0x54, 0x36, 0x04, 0x0b,
-    0x23, 0x75, 0x8a, 0x8a, 0x81, 0x75, 0x7a, 0x6f, 0x7a, 0x59, 0x1d, 0x0b,
-    0x59, 0x76, 0x6a, 0x7a, 0x61, 0x81, 0x7a, 0x59, 0x01, 0x01, 0x01, 0x1f,
-    0x75, 0x3e, 0x0c, 0x71, 0x3e, 0x12, 0x05, 0x01, 0x1a, 0x26, 0x94, 0xa9,
-    0x83, 0x85, 0x9a, 0xaf, 0xb1, 0xb5, 0xb1, 0xa2, 0x8d, 0x5c, 0x51, 0x61,
-    0x6a, 0x77, 0x7e, 0x8d, 0xa5, 0x94, 0xba, 0xba, 0xb1, 0xb1, 0x5c, 0x16,
-    0x9d, 0xb7, 0xc4, 0xbb, 0xa6, 0xc6, 0xbf, 0xbb, 0xb1, 0xb7, 0xc1, 0xcb,
-    0xbb, 0xb7, 0x7e, 0x7f, 0xc6, 0xa6, 0xb3, 0xc6, 0x9d, 0xb2, 0x74, 0xc1,
-    0xd1, 0xc1, 0xb2, 0xc1, 0xd1, 0xd1, 0xd1, 0xbb, 0xb7, 0xbe, 0xbb, 0xaa,
-    0xb8, 0xbe, 0xb2, 0xd8, 0xd1, 0xd1, 0xc8, 0xc8, 0xc8, 0xd2, 0xd8, 0xd1,
-    0xd1, 0xd8, 0xd1, 0xd1, 0xd1, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8,
-    0xd8, 0xd1, 0xcb, 0xd1, 0xcb, 0xd1, 0xd1, 0xa6, 0xcb, 0xc9, 0xc1, 0x16,
-    0x85, 0x9d, 0x97, 0x65, 0x8d, 0xa9, 0x9d, 0xa7, 0xac, 0xa6, 0x74, 0x5c,
-    0x6e, 0x26, 0x0b, 0x08, 0x26, 0x5c, 0x57, 0x15, 0x16, 0x57, 0x8d, 0x85,
-    0x74, 0x21, 0x0e, 0x0e, 0x26, 0x6e, 0xa9, 0x9c, 0x85, 0x77, 0x5f, 0x36,
-    0x34, 0x26, 0xa5, 0x85, 0x26, 0x1f, 0x16, 0x26, 0x5c, 0x65, 0x5c, 0x4b,
-    0x16, 0x77, 0xa2, 0x9b, 0x6a, 0x61, 0x7a, 0x94, 0x2d, 0x1a, 0x75, 0x9c,
-    0x18, 0x12, 0x1f, 0x1f, 0x3e, 0x69, 0x23, 0x1f, 0x03, 0x27, 0x05, 0x1c,
-    0x15, 0x03, 0x06, 0x27, 0x15, 0x1b, 0x23, 0x11, 0x20, 0x27, 0x06, 0x0e,
-    0x07, 0x76, 0x2a, 0x7d, 0x82, 0x7d, 0x93, 0x67, 0x1d, 0x2a, 0x35, 0x07,
-    0x3d, 0x42, 0x7b, 0x3f, 0x67, 0x1e, 0x2a, 0x63, 0x5a, 0x2a, 0x24, 0x46,
-    0x3f, 0x28, 0x18, 0x63, 0x66, 0x66, 0x42, 0x3f, 0x33, 0x28, 0x33, 0x1e,
-    0x0c, 0x09, 0x07, 0x06, 0x0c, 0x05, 0x01, 0x06, 0x04, 0x03, 0x05, 0x01,
-    0x0d, 0x3c, 0x40, 0x40, 0x3c, 0x40, 0x4d, 0x4d, 0x40, 0x40, 0x40, 0x4d,
-    0x40, 0x58, 0x52, 0x58, 0x52, 0x3c, 0x3a, 0x33, 0x14, 0x09, 0x12, 0x10,
-    0x10, 0x15, 0x03, 0x07, 0x4f, 0x18, 0x33, 0x73, 0x50, 0x14, 0x06, 0x03,
-    0x05, 0x50, 0x73, 0x50, 0x3d, 0x31, 0x4c, 0x50, 0x73, 0x6c, 0x5b, 0x1b,
-    0x1d, 0x0c, 0x0b, 0x49, 0x31, 0x3e, 0x36, 0x03, 0x05, 0x3d, 0x8a, 0x8a,
-    0x8f, 0x75, 0x8f, 0x96, 0x96, 0x7a, 0x13, 0x0b, 0x59, 0x8f, 0x83, 0x5e,
-    0x8a, 0x68, 0x83, 0x49, 0x01, 0x02, 0x01, 0x1f, 0x90, 0x0b, 0x06, 0x11,
-    0x05, 0x03, 0x03, 0x1a, 0x6a, 0x55, 0x94, 0xa2, 0x8c, 0x8c, 0x8c, 0xa8,
-    0xb5, 0xa2, 0xb1, 0xa9, 0xba, 0x9c, 0x71, 0xa2, 0xa5, 0x98, 0xa5, 0xa9,
-    0xbf, 0xba, 0xb7, 0xc4, 0xa5, 0x65, 0x16, 0x85, 0x88, 0x5c, 0x85, 0xc6,
-    0xb7, 0x97, 0xc6, 0xc1, 0xbb, 0xb7, 0xc6, 0xc4, 0xbb, 0xbb, 0xbb, 0x65,
-    0xa6, 0xcb, 0x98, 0xa6, 0xb8, 0xb7, 0xb8, 0xc6, 0xc6, 0xc6, 0xc6, 0xc8,
-    0xd1, 0xd1, 0xd8, 0xbb, 0xc6, 0xcb, 0xcb, 0xbe, 0xbe, 0xb8, 0xaa, 0xc8,
-    0xc8, 0xd2, 0xd9, 0xd1, 0xd8, 0xd8, 0xd8, 0xd8, 0xcb, 0xc6, 0xd1, 0xd1,
-    0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd1, 0xd1, 0xd1,
-    0xc6, 0xc1, 0xcb, 0xbb, 0xcb, 0xb7, 0xa7, 0x16, 0x7f, 0x85, 0xc9, 0xb7,
-    0xa7, 0x8d, 0x85, 0x8d, 0xb1, 0xb3, 0xb7, 0xb8, 0xa5, 0x7f, 0x0e, 0x26,
-    0x2c, 0x74, 0x2c, 0x26, 0x55, 0xa9, 0xb2, 0x36, 0x1a, 0x44, 0x5f, 0x5c,
-    0x5e, 0x77, 0xac, 0x7e, 0x4b, 0x65, 0x1f, 0x6a, 0x41, 0x16, 0x6a, 0x85,
-    0x21, 0x11, 0x0b, 0x1f, 0x1a, 0x0b, 0x3e, 0x16, 0x12, 0x27, 0x65, 0x5e,
-    0x3e, 0x4b, 0x3e, 0x61, 0x1f, 0x08, 0x15, 0x26, 0x3e, 0x1c, 0x15, 0x23,
-    0x61, 0x27, 0x12, 0x1a, 0x05, 0x15, 0x0b, 0x15, 0x0b, 0x03, 0x04, 0x0b,
-    0x06, 0x12, 0x0b, 0x23, 0x35, 0x6c, 0x0f, 0x04, 0x6c, 0x7d, 0x3d, 0x87,
-    0x8a, 0x67, 0x87, 0x87, 0x3d, 0x12, 0x0c, 0x12, 0x24, 0x14, 0x29, 0x2a,
-    0x29, 0x1a, 0x3f, 0x82, 0x70, 0x4f, 0x3f, 0x5a, 0x3f, 0x5a, 0x42, 0x2a,
-    0x70, 0x58, 0x58, 0x3f, 0x4d, 0x46, 0x14, 0x0c, 0x10, 0x10, 0x04, 0x07,
-    0x04, 0x01, 0x01, 0x07, 0x10, 0x09, 0x03, 0x04, 0x22, 0x52, 0x3a, 0x40,
-    0x3c, 0x3c, 0x4d, 0x4d, 0x3c, 0x4d, 0x4d, 0x52, 0x4d, 0x40, 0x2e, 0x14,
-    0x07, 0x07, 0x07, 0x07, 0x1b, 0x46, 0x58, 0x4f, 0x28, 0x10, 0x0b, 0x03,
-    0x46, 0x3f, 0x17, 0x31, 0x14, 0x06, 0x06, 0x05, 0x06, 0x42, 0x67, 0x3f,
-    0x3d, 0x5b, 0x3d, 0x64, 0x53, 0x64, 0x23, 0x1b, 0x13, 0x15, 0x0b, 0x50,
-    0x2d, 0x13, 0x27, 0x54, 0x0c, 0x0b, 0x49, 0x8a, 0x81, 0x8a, 0x8a, 0x8f,
-    0x96, 0x75, 0x1a, 0x0b, 0x75, 0x8a, 0x8a, 0x75, 0x8f, 0x7d, 0x89, 0x23,
-    0x01, 0x02, 0x01, 0x0b, 0x0f, 0x08, 0x05, 0x05, 0x05, 0x1f, 0x5c, 0x08,
-    0x47, 0xa8, 0x9a, 0x7a, 0xaf, 0xa1, 0xa8, 0xa2, 0x9c, 0x9a, 0xa2, 0xaf,
-    0xb5, 0xba, 0x97, 0x8d, 0xa5, 0x9a, 0x9c, 0xb7, 0xba, 0xb1, 0xb1, 0x8d,
-    0x3e, 0x26, 0x5c, 0x3e, 0x88, 0xb2, 0x74, 0x8d, 0xb7, 0xa6, 0x98, 0xb1,
-    0xbb, 0xb1, 0xc1, 0xc1, 0xb1, 0xb7, 0xcb, 0xc6, 0x7e, 0xbe, 0xb3, 0xb8,
-    0xb2, 0xa6, 0xb2, 0xb8, 0xbb, 0xbb, 0xb7, 0xc6, 0xcb, 0xd1, 0xd8, 0xc1,
-    0xd1, 0xbe, 0xcb, 0xd1, 0xd1, 0xc8, 0xa7, 0xa7, 0xbe, 0xbe, 0xd2, 0xc8,
-    0xcb, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8,
-    0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1,
-    0xb8, 0xd0, 0x9d, 0x1f, 0x8d, 0x71, 0xd0, 0xd1, 0xc9, 0xb7, 0x8d, 0x88,
-    0x41, 0x4b, 0x5f, 0x74, 0x7e, 0x51, 0x97, 0x3e, 0x41, 0x26, 0x2c, 0x6e,
-    0x41, 0x26, 0x1a, 0x5c, 0x8d, 0xb1, 0x61, 0x98, 0x59, 0x85, 0x77, 0x85,
-    0x9c, 0xa5, 0x57, 0x36, 0x26, 0x41, 0x27, 0x2c, 0x1f, 0x1f, 0x1f, 0x34,
-    0x13, 0x55, 0x05, 0x21, 0x44, 0x2c, 0x4b, 0x8d, 0x55, 0x54, 0x77, 0x23,
-    0x2c, 0x05, 0x1a, 0x0b, 0x26, 0x54, 0x5e, 0x2d, 0x0b, 0x06, 0x0b, 0x1f,
-    0x0b, 0x05, 0x4b, 0x49, 0x1a, 0x0b, 0x05, 0x05, 0x0b, 0x13, 0x06, 0x75,
-    0x23, 0x50, 0x23, 0x03, 0x87, 0x86, 0x29, 0x7d, 0x93, 0x64, 0x87, 0x87,
-    0x31, 0x20, 0x06, 0x7b, 0x5a, 0x67, 0x7b, 0x7b, 0x1d, 0x0c, 0x56, 0x53,
-    0x50, 0x31, 0x33, 0x2a, 0x50, 0x4f, 0x33, 0x0c, 0x42, 0x63, 0x46, 0x14,
-    0x63, 0x58, 0x24, 0x24, 0x33, 0x0d, 0x04, 0x17, 0x07, 0x01, 0x01, 0x10,
-    0x33, 0x09, 0x06, 0x03, 0x2e, 0x3c, 0x3c, 0x2e, 0x2e, 0x4d, 0x40, 0x52,
-    0x4d, 0x3c, 0x40, 0x40, 0x1e, 0x07, 0x04, 0x17, 0x3a, 0x58, 0x58, 0x46,
-    0x62, 0x58, 0x62, 0x53, 0x5a, 0x1e, 0x04, 0x05, 0x07, 0x53, 0x15, 0x0b,
-    0x0b, 0x05, 0x04, 0x06, 0x04, 0x50, 0x5a, 0x64, 0x24, 0x73, 0x5b, 0x42,
-    0x49, 0x67, 0x54, 0x13, 0x0c, 0x0b, 0x0b, 0x75, 0x31, 0x36, 0x49, 0x06,
-    0x03, 0x0b, 0x27, 0x36, 0x8a, 0x8f, 0x8a, 0x8a, 0x95, 0x75, 0x2d, 0x0f,
-    0x8f, 0x83, 0xa4, 0x8a, 0x95, 0xa8, 0x75, 0x0b, 0x01, 0x02, 0x01, 0x05,
-    0x05, 0x03, 0x02, 0x05, 0x2c, 0x9c, 0xa8, 0x2c, 0x0b, 0xab, 0xb5, 0xa8,
-    0xb5, 0xaf, 0xa8, 0xb5, 0xaf, 0xb1, 0x9c, 0xa9, 0xb5, 0xb1, 0x83, 0x9a,
-    0x98, 0xa5, 0xbb, 0xbb, 0xb7, 0xb8, 0x6e, 0x57, 0x57, 0x1f, 0x5f, 0x97,
-    0x9d, 0xbb, 0xac, 0x4b, 0x98, 0xcb, 0xbb, 0x98, 0xb3, 0x8d, 0xb7, 0xbb,
-    0xc1, 0xcb, 0xb7, 0xd1, 0x8d, 0xa7, 0xc1, 0xcb, 0xc1, 0xc6, 0xb7, 0xd1,
-    0xd1, 0xd8, 0xd1, 0xd1, 0xc6, 0xd1, 0xd8, 0xc6, 0xd1, 0xc8, 0xcb, 0xc6,
-    0xd8, 0xd1, 0xd2, 0xbe, 0xb6, 0xca, 0xc8, 0xc8, 0xd8, 0xd8, 0xd8, 0xd8,
-    0xd8, 0xd8, 0xd8, 0xd8, 0xd1, 0xd8, 0xd8, 0xd8, 0xd8, 0xd1, 0xd8, 0xd8,
-    0xd8, 0xd8, 0xd8, 0xd8, 0xd1, 0xb7, 0xd8, 0xd8, 0xbb, 0xcb, 0xb2, 0xb8,
-    0x74, 0x5c, 0xa6, 0x7e, 0x85, 0x8d, 0x5f, 0x26, 0x2c, 0x5f, 0x32, 0x16,
-    0x16, 0x4b, 0x65, 0x44, 0x26, 0x6b, 0x21, 0x0e, 0x0b, 0x6e, 0xb3, 0xb1,
-    0xa5, 0x6e, 0x61, 0xa5, 0x8d, 0x9c, 0xba, 0x9a, 0x77, 0x6a, 0x71, 0x1f,
-    0x3e, 0x2d, 0x5c, 0x5f, 0x6a, 0x71, 0x3e, 0x08, 0x69, 0x1f, 0x1f, 0x77,
-    0x47, 0x2d, 0x54, 0x55, 0x47, 0x3e, 0x30, 0x5e, 0x77, 0x1d, 0x2c, 0x5c,
-    0x54, 0x64, 0x06, 0x06, 0x01, 0x08, 0x0b, 0x0b, 0x15, 0x27, 0x76, 0x8a,
-    0x3e, 0x1c, 0x07, 0x1f, 0x0b, 0x06, 0x12, 0x8a, 0x27, 0x26, 0x06, 0x01,
-    0x3d, 0x7d, 0x23, 0x64, 0x93, 0x64, 0x7b, 0x7b, 0x1b, 0x73, 0x14, 0x92,
-    0x53, 0x73, 0x87, 0x7b, 0x3f, 0x4c, 0x24, 0x3d, 0x25, 0x3f, 0x3f, 0x2a,
-    0x2a, 0x53, 0x5b, 0x35, 0x07, 0x1b, 0x14, 0x1b, 0x29, 0x28, 0x50, 0x3a,
-    0x58, 0x18, 0x07, 0x10, 0x1e, 0x01, 0x01, 0x0c, 0x3a, 0x14, 0x10, 0x04,
-    0x22, 0x3c, 0x3c, 0x3c, 0x4d, 0x4d, 0x4d, 0x4d, 0x40, 0x4d, 0x2f, 0x06,
-    0x04, 0x22, 0x4d, 0x58, 0x4d, 0x62, 0x52, 0x4d, 0x62, 0x53, 0x4d, 0x53,
-    0x5a, 0x53, 0x14, 0x05, 0x05, 0x20, 0x07, 0x06, 0x05, 0x04, 0x05, 0x05,
-    0x0b, 0x67, 0x73, 0x67, 0x3d, 0x67, 0x73, 0x3d, 0x29, 0x29, 0x50, 0x0f,
-    0x0b, 0x0b, 0x13, 0x4e, 0x3d, 0x23, 0x50, 0x05, 0x01, 0x05, 0x0b, 0x54,
-    0x8a, 0x9b, 0x8f, 0x81, 0x8a, 0x5e, 0x10, 0x26, 0x83, 0xa4, 0xa4, 0x8a,
-    0xa4, 0x83, 0x75, 0x0b, 0x01, 0x02, 0x05, 0x05, 0x01, 0x03, 0x1f, 0x51,
-    0x59, 0x59, 0x7e, 0x65, 0x26, 0x2d, 0xa8, 0xb5, 0xaf, 0xb5, 0xb5, 0xba,
-    0xaf, 0xaf, 0xb5, 0xb1, 0x90, 0xb1, 0xa6, 0xb7, 0x8d, 0xa6, 0xba, 0xbf,
-    0xa5, 0x5e, 0x1f, 0x0b, 0x15, 0xa6, 0xc1, 0x9c, 0xb1, 0xa6, 0x8d, 0xd1,
-    0x36, 0x97, 0x9c, 0xb2, 0xa6, 0xc6, 0xc1, 0xcb, 0xc4, 0xc1, 0xa6, 0xa5,
-    0x99, 0x97, 0xc6, 0xc6, 0xcb, 0xd1, 0xd1, 0xcb, 0xd1, 0xcb, 0xd1, 0xd1,
-    0xd1, 0xd1, 0xd1, 0xcb, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xcb, 0xd2, 0xd2,
-    0xd9, 0xc8, 0xbe, 0xb8, 0xb8, 0xd2, 0xd8, 0xd8, 0xd1, 0xd8, 0xd8, 0xcb,
-    0xd1, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd1, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8,
-    0xd8, 0xaa, 0xd1, 0xcb, 0xd8, 0xa6, 0xcb, 0xd0, 0xa7, 0xb8, 0xb2, 0xc6,
-    0xb2, 0x51, 0x74, 0x55, 0x74, 0x1f, 0x79, 0x7f, 0x65, 0x57, 0x15, 0x16,
-    0x41, 0x26, 0x0b, 0x11, 0x44, 0x6e, 0xb7, 0xbb, 0x77, 0x4b, 0x7f, 0xa9,
-    0xba, 0xb1, 0xba, 0xba, 0xb0, 0xac, 0xa9, 0x4b, 0x5c, 0x1f, 0xa9, 0x29,
-    0xa9, 0x8c, 0x34, 0x51, 0x1f, 0x3e, 0x85, 0x3e, 0x61, 0x9a, 0x94, 0x5e,
-    0x6a, 0x26, 0x83, 0x69, 0x4b, 0x26, 0x2c, 0x0c, 0x16, 0x05, 0x05, 0x06,
-    0x0b, 0x1f, 0x3e, 0x13, 0x36, 0x36, 0x75, 0x96, 0x7a, 0x15, 0x1f, 0x1a,
-    0x06, 0x0c, 0x23, 0x4e, 0x23, 0x2a, 0x0b, 0x05, 0x1d, 0x6c, 0x23, 0x73,
-    0x96, 0x7b, 0x3d, 0x49, 0x42, 0x3f, 0x42, 0x73, 0x29, 0x2a, 0x50, 0x5b,
-    0x10, 0x12, 0x14, 0x17, 0x1d, 0x07, 0x07, 0x07, 0x0c, 0x10, 0x04, 0x09,
-    0x06, 0x03, 0x07, 0x06, 0x28, 0x58, 0x58, 0x4f, 0x66, 0x33, 0x14, 0x0a,
-    0x04, 0x01, 0x04, 0x14, 0x09, 0x10, 0x10, 0x07, 0x10, 0x3c, 0x3c, 0x40,
-    0x40, 0x40, 0x40, 0x3c, 0x2e, 0x10, 0x04, 0x22, 0x33, 0x58, 0x4d, 0x58,
-    0x4d, 0x62, 0x58, 0x62, 0x62, 0x4d, 0x5a, 0x58, 0x4f, 0x66, 0x33, 0x12,
-    0x05, 0x06, 0x06, 0x05, 0x05, 0x04, 0x05, 0x05, 0x13, 0x5b, 0x5b, 0x67,
-    0x35, 0x67, 0x7b, 0x3d, 0x5b, 0x49, 0x6c, 0x23, 0x0b, 0x06, 0x15, 0x5e,
-    0x31, 0x54, 0x76, 0x1f, 0x05, 0x07, 0x43, 0x7a, 0x78, 0x8f, 0x81, 0x78,
-    0x81, 0x59, 0x0b, 0x1f, 0x8a, 0xa3, 0x9e, 0x8f, 0x9e, 0x54, 0x59, 0x05,
-    0x01, 0x01, 0x01, 0x03, 0x08, 0x1f, 0x77, 0x7a, 0x8c, 0x4b, 0x54, 0x7a,
-    0x71, 0x36, 0x7e, 0x9e, 0xa9, 0xb5, 0xb5, 0xb5, 0xaf, 0xb0, 0xaf, 0xa9,
-    0xb5, 0xa2, 0x94, 0xa9, 0xb5, 0x85, 0xbb, 0xac, 0x5c, 0x1a, 0x16, 0x74,
-    0xbb, 0xc6, 0xbb, 0xb3, 0xa6, 0xcb, 0x9d, 0xa6, 0xbb, 0x4b, 0x65, 0xb3,
-    0xc1, 0xbb, 0xc1, 0xbb, 0xb7, 0xac, 0xb8, 0xc6, 0xb7, 0xb2, 0xcb, 0xc6,
-    0xc6, 0xc6, 0xc6, 0xcb, 0xc6, 0xc1, 0xd1, 0xd8, 0xd8, 0xd0, 0xd8, 0xd1,
-    0xd8, 0xd1, 0xd1, 0xd8, 0xd1, 0xdd, 0xd2, 0xd2, 0xdf, 0xdd, 0xd8, 0xd9,
-    0xd9, 0xb2, 0xb8, 0xbe, 0xbe, 0xd1, 0xd1, 0xd8, 0xd7, 0xd8, 0xd8, 0xd8,
-    0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xbe, 0xd1, 0x9d, 0xcb, 0xd8,
-    0xd8, 0xc6, 0x97, 0xd1, 0xb2, 0x5f, 0x6e, 0x44, 0x44, 0x5f, 0x5f, 0x4b,
-    0x7e, 0xc6, 0xd0, 0xcb, 0xa6, 0x6e, 0x6b, 0x5f, 0x03, 0x1f, 0x26, 0x34,
-    0x55, 0x2c, 0x65, 0x2d, 0x8d, 0x6e, 0x94, 0x85, 0x8d, 0xa8, 0xb1, 0xb1,
-    0xb1, 0xa2, 0x8c, 0x3e, 0x1f, 0x1f, 0x83, 0xb5, 0xb0, 0x98, 0x2d, 0x5c,
-    0x20, 0x65, 0x3e, 0x1a, 0x94, 0xb0, 0x8d, 0x54, 0x55, 0x3e, 0x1f, 0x3e,
-    0x3e, 0x16, 0x0b, 0x03, 0x02, 0x05, 0x05, 0x0e, 0x20, 0x7e, 0x7a, 0x36,
-    0x23, 0x94, 0x75, 0x6f, 0x6a, 0x3e, 0x15, 0x0b, 0x06, 0x0e, 0x0b, 0x86,
-    0x2b, 0x03, 0x49, 0x12, 0x06, 0x49, 0x13, 0x6c, 0x64, 0x7d, 0x31, 0x13,
-    0x86, 0x15, 0x31, 0x66, 0x73, 0x50, 0x29, 0x67, 0x25, 0x24, 0x29, 0x42,
-    0x3f, 0x5a, 0x73, 0x67, 0x53, 0x53, 0x0c, 0x5a, 0x33, 0x2a, 0x1e, 0x14,
-    0x0c, 0x07, 0x10, 0x33, 0x28, 0x1e, 0x14, 0x04, 0x01, 0x01, 0x1b, 0x2e,
-    0x33, 0x17, 0x07, 0x04, 0x07, 0x52, 0x3c, 0x3c, 0x40, 0x40, 0x3c, 0x40,
-    0x17, 0x07, 0x46, 0x52, 0x46, 0x52, 0x52, 0x52, 0x52, 0x58, 0x4d, 0x62,
-    0x58, 0x46, 0x5a, 0x62, 0x4f, 0x66, 0x4f, 0x20, 0x06, 0x04, 0x04, 0x05,
-    0x04, 0x05, 0x06, 0x07, 0x3d, 0x53, 0x67, 0x7b, 0x1d, 0x67, 0x50, 0x49,
-    0x27, 0x20, 0x54, 0x1a, 0x0b, 0x06, 0x1f, 0x3d, 0x36, 0x86, 0x59, 0x3d,
-    0x49, 0x64, 0x9b, 0x8a, 0x73, 0x81, 0x83, 0x8f, 0x8f, 0x4e, 0x12, 0x1c,
-    0x9b, 0x9b, 0x95, 0xa1, 0x9b, 0x83, 0x6a, 0x03, 0x02, 0x01, 0x01, 0x12,
-    0x2d, 0x59, 0x8c, 0x95, 0x83, 0x59, 0x36, 0xab, 0x9a, 0x7a, 0x6a, 0x77,
-    0x61, 0x90, 0xa2, 0xa5, 0xb1, 0xb5, 0xaf, 0xa2, 0xa9, 0xa9, 0x8c, 0x98,
-    0xa9, 0xb1, 0x98, 0x3e, 0x16, 0x2c, 0xb7, 0xbb, 0xb1, 0xb7, 0xb7, 0xa5,
-    0xb7, 0xc6, 0xb1, 0x88, 0x7e, 0x9d, 0x44, 0x74, 0xac, 0xb8, 0xb8, 0xbb,
-    0xc6, 0xc6, 0xd1, 0xc9, 0xbb, 0xa7, 0xd8, 0xc6, 0xc6, 0xcb, 0xcb, 0xbb,
-    0xcb, 0xd1, 0xd1, 0xd1, 0xd1, 0xd0, 0xd8, 0xcb, 0xd8, 0xd1, 0xd2, 0xd9,
-    0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xdf, 0xdd, 0xd9, 0xdd, 0xdd, 0xd1, 0xc8,
-    0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8,
-    0xd8, 0xd8, 0xd8, 0xc8, 0x7e, 0xc6, 0xa6, 0xcb, 0xd1, 0xd8, 0xb2, 0xa6,
-    0x99, 0x6b, 0x88, 0xb2, 0xa6, 0x74, 0x74, 0x2c, 0x26, 0x9d, 0xbb, 0x9d,
-    0x2c, 0x41, 0x26, 0x26, 0x1c, 0x5c, 0x57, 0x74, 0x4b, 0x3e, 0x2c, 0x2c,
-    0x26, 0x85, 0xb5, 0x85, 0xa9, 0xb0, 0xba, 0xb5, 0x85, 0x94, 0x61, 0x34,
-    0x1f, 0x2c, 0x36, 0xa5, 0xa9, 0x65, 0x5c, 0x12, 0x7e, 0x7a, 0x61, 0x1a,
-    0x3e, 0x5e, 0x2c, 0x2d, 0x71, 0x5f, 0x26, 0x16, 0x05, 0x05, 0x06, 0x11,
-    0x0b, 0x26, 0x1f, 0x61, 0x36, 0x5e, 0x15, 0x3e, 0x3d, 0x8a, 0x8f, 0x2d,
-    0x31, 0x3e, 0x27, 0x16, 0x12, 0x15, 0x03, 0x0c, 0x0c, 0x01, 0x3e, 0x13,
-    0x05, 0x54, 0x20, 0x73, 0x31, 0x42, 0x92, 0x23, 0x1b, 0x04, 0x67, 0x7b,
-    0x42, 0x64, 0x67, 0x70, 0x20, 0x31, 0x1e, 0x35, 0x2a, 0x53, 0x66, 0x58,
-    0x70, 0x2a, 0x14, 0x53, 0x1e, 0x33, 0x5a, 0x72, 0x46, 0x33, 0x33, 0x1e,
-    0x04, 0x01, 0x14, 0x05, 0x01, 0x01, 0x33, 0x46, 0x52, 0x3a, 0x10, 0x04,
-    0x04, 0x3c, 0x40, 0x3c, 0x40, 0x3c, 0x2f, 0x10, 0x09, 0x3c, 0x4d, 0x52,
-    0x3c, 0x40, 0x52, 0x52, 0x52, 0x4f, 0x58, 0x62, 0x4d, 0x46, 0x62, 0x62,
-    0x53, 0x66, 0x4f, 0x18, 0x0c, 0x05, 0x05, 0x03, 0x06, 0x05, 0x15, 0x42,
-    0x29, 0x3f, 0x64, 0x67, 0x1d, 0x3d, 0x42, 0x49, 0x49, 0x03, 0x21, 0x1a,
-    0x0b, 0x04, 0x36, 0x3d, 0x3d, 0x59, 0x0c, 0x3d, 0x76, 0x75, 0x75, 0x7a,
-    0x7d, 0x8a, 0x75, 0x8a, 0x8c, 0x31, 0x16, 0x1a, 0x8a, 0x9b, 0x8a, 0x8f,
-    0x81, 0x95, 0x3e, 0x01, 0x01, 0x01, 0x0e, 0x4b, 0x6a, 0x71, 0x8f, 0x94,
-    0x83, 0x71, 0x75, 0x3e, 0x8c, 0x5e, 0x61, 0x85, 0x6a, 0x71, 0x90, 0x90,
-    0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x94, 0x85, 0x65, 0x85, 0x85, 0x1f, 0x0b,
-    0x16, 0x94, 0xba, 0xc9, 0xbb, 0xac, 0xbb, 0xb1, 0xb1, 0xb1, 0xc9, 0xbb,
-    0x74, 0x85, 0x74, 0x85, 0x5f, 0x65, 0xb2, 0xc6, 0xc6, 0xc6, 0xcb, 0xd0,
-    0xc1, 0x85, 0xd8, 0xcb, 0xc1, 0xbb, 0xd1, 0xd1, 0xd1, 0xd7, 0xd1, 0xd1,
-    0xd0, 0xd0, 0xd8, 0xc6, 0xd8, 0xd8, 0xd9, 0xd9, 0xdf, 0xdd, 0xdf, 0xe3,
-    0xdf, 0xe3, 0xe3, 0xdf, 0xd9, 0xd8, 0xd8, 0xcb, 0xc8, 0xd8, 0xd1, 0xd8,
-    0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd1, 0xd9, 0xbe,
-    0x88, 0xd1, 0xd1, 0xb2, 0xa7, 0xb8, 0xbe, 0x88, 0x6b, 0x74, 0x88, 0xc6,
-    0xcb, 0x74, 0x8d, 0x5f, 0x74, 0x74, 0x26, 0x0b, 0x44, 0x97, 0xb8, 0x26,
-    0x41, 0xa7, 0x5c, 0x9c, 0x6e, 0x8d, 0x1f, 0x34, 0x57, 0x2c, 0x4b, 0x8d,
-    0x77, 0x9c, 0x94, 0x85, 0x51, 0x85, 0x97, 0x77, 0x5c, 0x4b, 0x6a, 0x77,
-    0x9a, 0x71, 0x1f, 0x65, 0x76, 0x61, 0x94, 0x6a, 0x5e, 0x4b, 0x1f, 0x55,
-    0x3e, 0x3e, 0x1a, 0x16, 0x11, 0x11, 0x11, 0x0b, 0x16, 0x3d, 0x9c, 0x61,
-    0x83, 0x23, 0x13, 0x71, 0x1f, 0x6a, 0x49, 0x54, 0x49, 0x6f, 0x6a, 0x0c,
-    0x0c, 0x06, 0x06, 0x0b, 0x15, 0x0b, 0x23, 0x15, 0x05, 0x3d, 0x12, 0x67,
-    0x92, 0x73, 0x73, 0x3d, 0x0c, 0x12, 0x23, 0x3d, 0x7b, 0x87, 0x5b, 0x35,
-    0x12, 0x1b, 0x3f, 0x29, 0x53, 0x24, 0x70, 0x67, 0x33, 0x3f, 0x14, 0x17,
-    0x66, 0x72, 0x66, 0x4f, 0x4f, 0x1e, 0x3f, 0x66, 0x1b, 0x01, 0x02, 0x06,
-    0x01, 0x01, 0x4d, 0x52, 0x4d, 0x58, 0x14, 0x04, 0x03, 0x2e, 0x40, 0x40,
-    0x2e, 0x17, 0x07, 0x10, 0x3c, 0x4d, 0x4d, 0x4d, 0x3c, 0x2e, 0x62, 0x52,
-    0x52, 0x3c, 0x66, 0x58, 0x4f, 0x46, 0x58, 0x66, 0x4f, 0x58, 0x1b, 0x15,
-    0x0c, 0x05, 0x06, 0x04, 0x06, 0x20, 0x27, 0x3d, 0x23, 0x29, 0x50, 0x67,
-    0x27, 0x23, 0x50, 0x54, 0x1f, 0x03, 0x05, 0x15, 0x0e, 0x06, 0x2b, 0x31,
-    0x2d, 0x0e, 0x01, 0x0e, 0x2d, 0x1a, 0x23, 0x3e, 0x3d, 0x7a, 0x6f, 0x8f,
-    0x8c, 0x36, 0x0b, 0x1f, 0x81, 0x8a, 0x78, 0x83, 0x8f, 0x9b, 0x0e, 0x01,
-    0x01, 0x01, 0x36, 0x6c, 0x6a, 0x59, 0x3e, 0x77, 0x47, 0x8c, 0x8c, 0x36,
-    0x61, 0x94, 0xb5, 0xb5, 0x9a, 0x9c, 0xb5, 0xaf, 0xba, 0xb5, 0xbf, 0xb5,
-    0x9a, 0x85, 0x85, 0x55, 0x44, 0x15, 0x08, 0x0b, 0x65, 0xa6, 0x98, 0xb1,
-    0xa5, 0xb3, 0xac, 0xb2, 0xb1, 0xb1, 0xd0, 0xb7, 0x97, 0xa7, 0x65, 0x97,
-    0xb7, 0x34, 0x85, 0xbb, 0xcb, 0xc6, 0xc6, 0xd0, 0xc6, 0x79, 0xd1, 0xc6,
-    0xd1, 0xc6, 0xcb, 0xd1, 0xd1, 0xd8, 0xd1, 0xd1, 0xd1, 0xd8, 0xdd, 0xd1,
-    0xd8, 0xd8, 0xd9, 0xd9, 0xdf, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3,
-    0xd9, 0xd9, 0xdd, 0xd9, 0x99, 0xdd, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8,
-    0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd2, 0xb8, 0xa6, 0xc1, 0xc1,
-    0x9d, 0x88, 0xd2, 0xd1, 0x79, 0x32, 0x41, 0x99, 0xb8, 0x8d, 0xb8, 0x88,
-    0x41, 0x4b, 0x2c, 0x41, 0xb7, 0x8d, 0x5d, 0x55, 0xa6, 0xc6, 0x7e, 0xb1,
-    0x9d, 0x4b, 0x34, 0x97, 0x74, 0x41, 0x34, 0x26, 0x2c, 0x65, 0x6e, 0x3e,
-    0x85, 0xbf, 0xba, 0xac, 0x7e, 0x4b, 0xa9, 0x8c, 0x7e, 0x4b, 0x06, 0x55,
-    0x8d, 0x8d, 0x71, 0x7a, 0x77, 0x6a, 0x4b, 0x55, 0x0b, 0x36, 0x16, 0x0c,
-    0x36, 0x12, 0x03, 0x12, 0x3e, 0xa1, 0x7a, 0x8c, 0x9b, 0x3e, 0x54, 0x3e,
-    0x26, 0x61, 0x54, 0x61, 0xab, 0x73, 0x54, 0x2d, 0x0b, 0x04, 0x13, 0x0b,
-    0x0c, 0x2d, 0x3d, 0x5b, 0x0c, 0x23, 0x1b, 0x96, 0x96, 0x7b, 0x3d, 0x5b,
-    0x12, 0x15, 0x31, 0x64, 0x73, 0x4c, 0x20, 0x06, 0x12, 0x29, 0x35, 0x14,
-    0x5a, 0x53, 0x7b, 0x72, 0x3a, 0x4f, 0x1e, 0x46, 0x72, 0x70, 0x5a, 0x10,
-    0x33, 0x2a, 0x33, 0x46, 0x24, 0x01, 0x03, 0x14, 0x06, 0x04, 0x53, 0x58,
-    0x46, 0x28, 0x09, 0x0a, 0x01, 0x1e, 0x40, 0x17, 0x07, 0x07, 0x28, 0x3a,
-    0x3c, 0x4d, 0x40, 0x46, 0x4f, 0x46, 0x52, 0x62, 0x58, 0x58, 0x62, 0x62,
-    0x4d, 0x46, 0x58, 0x58, 0x4d, 0x46, 0x14, 0x06, 0x13, 0x0c, 0x06, 0x06,
-    0x13, 0x50, 0x3d, 0x29, 0x29, 0x3d, 0x42, 0x5b, 0x36, 0x25, 0x50, 0x54,
-    0x0f, 0x03, 0x06, 0x0b, 0x0b, 0x06, 0x27, 0x64, 0x3d, 0x1a, 0x01, 0x06,
-    0x36, 0x06, 0x05, 0x06, 0x12, 0x36, 0x68, 0x6f, 0x75, 0x2d, 0x0b, 0x27,
-    0x95, 0xa1, 0x83, 0x83, 0xa4, 0x8f, 0x03, 0x01, 0x01, 0x01, 0x6a, 0x59,
-    0x9e, 0x83, 0x6a, 0x2d, 0x30, 0x54, 0x71, 0x7a, 0x9e, 0x9e, 0xa8, 0xb5,
-    0xaf, 0x9a, 0xa9, 0xaf, 0xb5, 0x9a, 0x85, 0x5c, 0x2c, 0x16, 0x11, 0x08,
-    0x0e, 0x12, 0x1f, 0x3e, 0x88, 0x6e, 0x65, 0x85, 0xa5, 0xb1, 0xac, 0x8d,
-    0x9d, 0xc9, 0xc6, 0xa7, 0xa6, 0xbb, 0xb3, 0x85, 0xc6, 0x85, 0x7f, 0x8d,
-    0xd0, 0xc9, 0xd0, 0xbb, 0xc6, 0x7f, 0xbb, 0xcb, 0xd1, 0xc6, 0xbb, 0xcb,
-    0xc6, 0xd1, 0xd1, 0xd1, 0xd8, 0xd8, 0xdd, 0xd8, 0xd8, 0xd8, 0xd9, 0xe3,
-    0xdf, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xdf, 0xd9, 0xd8,
-    0xb6, 0xb8, 0xd1, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xdd, 0xdd, 0xd2, 0xd1,
-    0xd9, 0xdd, 0xdd, 0xd8, 0xc8, 0xc6, 0xc1, 0xb8, 0xb8, 0xbe, 0xd1, 0xc8,
-    0x5f, 0x74, 0x6b, 0x57, 0x41, 0x6e, 0x99, 0x34, 0x32, 0x97, 0x5f, 0x74,
-    0x97, 0x34, 0x41, 0xbb, 0xcb, 0xc6, 0x8d, 0x74, 0x5c, 0x4b, 0x74, 0xb7,
-    0xa6, 0x5f, 0x57, 0x34, 0x51, 0x34, 0x41, 0x34, 0x85, 0xa2, 0xb5, 0xa2,
-    0x77, 0x26, 0x85, 0x5e, 0x41, 0x08, 0x16, 0x4b, 0x94, 0x77, 0x8d, 0x7a,
-    0x9c, 0x4b, 0x21, 0x34, 0x55, 0x1f, 0x2c, 0x16, 0x1a, 0x0b, 0x0e, 0x0b,
-    0x6f, 0xaf, 0x54, 0x76, 0x71, 0x3d, 0x47, 0x36, 0x49, 0x6a, 0x3d, 0x83,
-    0x81, 0x75, 0x5e, 0x54, 0x1a, 0x0b, 0x15, 0x06, 0x0b, 0x1f, 0x5b, 0x96,
-    0x31, 0x05, 0x13, 0x73, 0x64, 0x67, 0x7b, 0x31, 0x06, 0x13, 0x2b, 0x20,
-    0x1c, 0x04, 0x03, 0x0b, 0x67, 0x70, 0x33, 0x10, 0x50, 0x66, 0x70, 0x72,
-    0x72, 0x29, 0x33, 0x2a, 0x72, 0x63, 0x33, 0x14, 0x2a, 0x22, 0x1e, 0x17,
-    0x1b, 0x06, 0x04, 0x33, 0x2e, 0x10, 0x14, 0x2e, 0x1b, 0x10, 0x17, 0x04,
-    0x01, 0x07, 0x0d, 0x07, 0x22, 0x2e, 0x52, 0x4d, 0x4d, 0x40, 0x3c, 0x46,
-    0x52, 0x52, 0x4d, 0x52, 0x4d, 0x58, 0x58, 0x62, 0x46, 0x4f, 0x58, 0x66,
-    0x66, 0x1e, 0x12, 0x01, 0x07, 0x1b, 0x06, 0x06, 0x2a, 0x42, 0x29, 0x2b,
-    0x31, 0x3d, 0x3f, 0x31, 0x25, 0x49, 0x3d, 0x1a, 0x04, 0x03, 0x05, 0x08,
-    0x0b, 0x0b, 0x36, 0x3d, 0x23, 0x15, 0x01, 0x05, 0x2d, 0x3e, 0x1f, 0x1f,
-    0x1a, 0x1f, 0x61, 0x83, 0x68, 0x1f, 0x06, 0x43, 0x9b, 0x95, 0x7a, 0x8a,
-    0x8a, 0x4b, 0x01, 0x01, 0x01, 0x1a, 0x81, 0x7a, 0x95, 0x7a, 0x85, 0x1f,
-    0x34, 0x2d, 0x5c, 0x94, 0xaf, 0xaf, 0xa8, 0xba, 0xb5, 0xbf, 0x9a, 0x7a,
-    0x4b, 0x26, 0x0e, 0x0b, 0x0b, 0x05, 0x03, 0x1f, 0x5f, 0x8d, 0xa2, 0xb1,
-    0xac, 0x7e, 0x98, 0xac, 0x74, 0xb7, 0xc6, 0x9d, 0xb7, 0xc4, 0xac, 0xc6,
-    0xb3, 0xd1, 0xc6, 0xa7, 0x97, 0xb3, 0xb7, 0x79, 0xb3, 0xc9, 0xd0, 0xc6,
-    0xc9, 0x98, 0xb3, 0xd1, 0xd0, 0xd0, 0xcb, 0xc6, 0xb3, 0xbb, 0xcb, 0xd1,
-    0xd8, 0xdd, 0xdd, 0xdd, 0xd2, 0xdf, 0xdf, 0xdf, 0xe3, 0xe3, 0xe3, 0xdf,
-    0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xdf, 0xdf, 0xdf, 0x79, 0xc8, 0xd8,
-    0xbb, 0xd8, 0xd8, 0xdd, 0xdd, 0xdd, 0xd9, 0xb8, 0xdf, 0xd2, 0xbe, 0x99,
-    0x6e, 0x99, 0x9d, 0xb6, 0xa7, 0x88, 0x7f, 0x88, 0x41, 0x6b, 0x88, 0x79,
-    0x16, 0x16, 0x16, 0x34, 0x41, 0xa7, 0x7f, 0x88, 0x57, 0x74, 0xa9, 0xc6,
-    0xc6, 0x8d, 0x55, 0x44, 0x9d, 0xb7, 0x8d, 0xb7, 0x98, 0x8d, 0x55, 0x69,
-    0x2c, 0x34, 0x1f, 0x26, 0x34, 0x4b, 0x51, 0x85, 0x65, 0x2d, 0x34, 0x2c,
-    0x11, 0x34, 0x26, 0x51, 0xa5, 0x6a, 0x71, 0x36, 0x4b, 0x0b, 0x1f, 0x4b,
-    0x36, 0x16, 0x13, 0x3e, 0x0b, 0x34, 0x0b, 0x1f, 0x1a, 0x76, 0x27, 0x27,
-    0x23, 0x76, 0x61, 0x83, 0x61, 0x9b, 0x59, 0x6c, 0x73, 0x69, 0x49, 0x6c,
-    0x49, 0x15, 0x06, 0x05, 0x15, 0x16, 0x3f, 0x9f, 0x6c, 0x04, 0x07, 0x35,
-    0x5b, 0x92, 0x5b, 0x20, 0x31, 0x18, 0x14, 0x0b, 0x1b, 0x20, 0x20, 0x20,
-    0x67, 0x7b, 0x70, 0x2a, 0x1d, 0x67, 0x66, 0x72, 0x72, 0x3f, 0x28, 0x2a,
-    0x4d, 0x53, 0x20, 0x24, 0x31, 0x28, 0x0c, 0x14, 0x20, 0x07, 0x0c, 0x33,
-    0x63, 0x33, 0x07, 0x07, 0x07, 0x10, 0x09, 0x04, 0x01, 0x01, 0x17, 0x3c,
-    0x40, 0x3a, 0x52, 0x52, 0x52, 0x46, 0x52, 0x4d, 0x52, 0x62, 0x4d, 0x52,
-    0x4d, 0x66, 0x58, 0x4d, 0x4f, 0x42, 0x4d, 0x66, 0x4f, 0x15, 0x06, 0x01,
-    0x03, 0x1b, 0x06, 0x04, 0x2a, 0x54, 0x31, 0x2a, 0x23, 0x31, 0x31, 0x2b,
-    0x18, 0x35, 0x23, 0x1f, 0x05, 0x03, 0x03, 0x05, 0x06, 0x06, 0x2d, 0x0f,
-    0x05, 0x05, 0x05, 0x05, 0x0c, 0x3d, 0x6c, 0x76, 0x76, 0x59, 0x61, 0x8f,
-    0x5b, 0x16, 0x12, 0x61, 0xa4, 0x7a, 0x9b, 0x9e, 0x94, 0x0e, 0x03, 0x01,
-    0x01, 0x61, 0xa8, 0x90, 0x61, 0x1a, 0x16, 0x05, 0x08, 0x0b, 0x0b, 0x15,
-    0x1f, 0x23, 0x47, 0x59, 0x6a, 0x47, 0x1f, 0x0e, 0x05, 0x03, 0x01, 0x0b,
-    0x2c, 0x51, 0x74, 0x97, 0xb3, 0xc4, 0xc9, 0xc4, 0xb1, 0xbb, 0xbb, 0xb7,
-    0x85, 0x8d, 0xcb, 0x6e, 0x85, 0x7f, 0x8d, 0xb7, 0xc1, 0xba, 0xbb, 0xbb,
-    0x7f, 0xa7, 0xb7, 0xb8, 0x85, 0xa6, 0x9d, 0xa5, 0xc6, 0xb7, 0xb3, 0xcb,
-    0xd1, 0xcb, 0xd1, 0xd0, 0xc1, 0xc6, 0xd1, 0xd7, 0xd8, 0xdd, 0xdd, 0xdd,
-    0xd9, 0xd9, 0xe3, 0xe4, 0xe6, 0xe6, 0xe3, 0xdf, 0xe3, 0xe3, 0xe3, 0xe3,
-    0xe8, 0xe3, 0xe3, 0xe3, 0xe3, 0xb6, 0x99, 0xd7, 0xb2, 0xd1, 0xdd, 0xd8,
-    0xdf, 0xe3, 0xd9, 0x8b, 0x5f, 0xaa, 0xc0, 0xc8, 0xc8, 0x9d, 0xb2, 0xa7,
-    0xbe, 0xb6, 0x79, 0x99, 0x6b, 0x26, 0x2c, 0x34, 0x57, 0x79, 0x88, 0x79,
-    0x99, 0x88, 0x57, 0x65, 0x4b, 0xc1, 0xcb, 0xbb, 0x85, 0x99, 0x7f, 0xb7,
-    0xbb, 0xd1, 0xb7, 0xa5, 0xa6, 0x77, 0x65, 0x4b, 0x16, 0x34, 0x26, 0x2c,
-    0x41, 0x55, 0x2c, 0x36, 0x34, 0x4b, 0x26, 0x16, 0x06, 0x2c, 0x1f, 0x4b,
-    0x97, 0x7e, 0x1f, 0x06, 0x05, 0x0b, 0x15, 0x34, 0x65, 0x61, 0x77, 0x61,
-    0x0f, 0x1f, 0x23, 0x83, 0x23, 0x1f, 0x54, 0x4e, 0x3e, 0x61, 0x54, 0x83,
-    0x9b, 0xa3, 0xa1, 0x81, 0x83, 0x2d, 0x5e, 0x76, 0x3e, 0x54, 0x01, 0x12,
-    0x12, 0x12, 0x10, 0x96, 0x86, 0x15, 0x06, 0x67, 0x64, 0x50, 0x86, 0x29,
-    0x73, 0x3d, 0x1f, 0x0c, 0x25, 0x31, 0x31, 0x42, 0x2a, 0x7b, 0x82, 0x7b,
-    0x29, 0x50, 0x4f, 0x82, 0x46, 0x20, 0x53, 0x28, 0x70, 0x4f, 0x67, 0x33,
-    0x28, 0x17, 0x0c, 0x14, 0x28, 0x1e, 0x28, 0x22, 0x33, 0x1b, 0x0c, 0x01,
-    0x05, 0x04, 0x04, 0x05, 0x01, 0x02, 0x3a, 0x52, 0x52, 0x3a, 0x4d, 0x52,
-    0x62, 0x52, 0x52, 0x40, 0x4d, 0x58, 0x58, 0x46, 0x4d, 0x58, 0x62, 0x58,
-    0x46, 0x3a, 0x5a, 0x66, 0x1e, 0x12, 0x03, 0x01, 0x06, 0x06, 0x12, 0x04,
-    0x0f, 0x42, 0x50, 0x53, 0x25, 0x42, 0x31, 0x0e, 0x04, 0x2a, 0x31, 0x64,
-    0x15, 0x03, 0x03, 0x05, 0x06, 0x06, 0x0b, 0x06, 0x06, 0x0c, 0x04, 0x05,
-    0x05, 0x2d, 0x12, 0x0c, 0x36, 0x61, 0x83, 0x76, 0x26, 0x0b, 0x16, 0x54,
-    0x8a, 0x95, 0xa4, 0xa8, 0x81, 0x05, 0x01, 0x01, 0x01, 0x3e, 0x47, 0x1c,
-    0x08, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x05, 0x05, 0x05,
-    0x08, 0x05, 0x05, 0x01, 0x11, 0x3e, 0x65, 0x97, 0x8d, 0x4b, 0x77, 0x7e,
-    0x6a, 0x71, 0xb5, 0xc9, 0xba, 0xbb, 0xc4, 0xcb, 0xb1, 0x7e, 0x7e, 0xa6,
-    0xc6, 0xb7, 0xbb, 0xb3, 0xa5, 0xb3, 0xb3, 0xac, 0xb1, 0x65, 0xa7, 0xc9,
-    0x9d, 0x6e, 0xc9, 0xc6, 0xa7, 0x94, 0x97, 0xd0, 0xd0, 0xd8, 0xcb, 0xd1,
-    0xc6, 0xcb, 0xd1, 0xd1, 0xd1, 0xd8, 0xdd, 0xe3, 0xdf, 0xe3, 0xdf, 0xdb,
-    0xe8, 0xe6, 0xe4, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe4, 0xe3, 0xe3, 0xe3,
-    0xe3, 0xd9, 0x88, 0xa6, 0xd1, 0xbe, 0xe2, 0xc0, 0x88, 0x88, 0x5d, 0xaa,
-    0xd9, 0xd9, 0xdf, 0xd9, 0xbe, 0xc8, 0xc8, 0xd2, 0x88, 0x88, 0x8b, 0xb6,
-    0x41, 0x0b, 0x57, 0xd2, 0xbe, 0x88, 0xbe, 0x99, 0x97, 0x9d, 0xb2, 0x8d,
-    0xa7, 0xc1, 0xa7, 0x7e, 0xbb, 0x85, 0xa7, 0xd0, 0x97, 0xb7, 0xc6, 0x97,
-    0x88, 0x2c, 0x4b, 0x55, 0x2c, 0x41, 0x26, 0x5f, 0x65, 0x2c, 0x1f, 0x16,
-    0x26, 0x74, 0x41, 0x05, 0x1f, 0x1a, 0x1a, 0x6e, 0x8c, 0x41, 0x1a, 0x26,
-    0x05, 0x23, 0x8c, 0x9c, 0x8c, 0xa9, 0x36, 0x0c, 0x15, 0x1a, 0x69, 0x83,
-    0x54, 0x1f, 0x27, 0x9c, 0x1d, 0x61, 0x75, 0x83, 0xa1, 0xa1, 0xae, 0x8a,
-    0x68, 0x54, 0x54, 0x54, 0x1f, 0x38, 0x01, 0x12, 0x26, 0x12, 0x05, 0x3d,
-    0x96, 0x2d, 0x04, 0x49, 0x5b, 0x92, 0x67, 0x14, 0x6c, 0x1d, 0x0b, 0x0b,
-    0x31, 0x56, 0x53, 0x73, 0x42, 0x67, 0x70, 0x7b, 0x70, 0x29, 0x31, 0x70,
-    0x1e, 0x42, 0x3f, 0x24, 0x3a, 0x24, 0x28, 0x1e, 0x24, 0x1b, 0x15, 0x09,
-    0x1e, 0x24, 0x46, 0x1e, 0x0c, 0x01, 0x01, 0x01, 0x06, 0x03, 0x0a, 0x03,
-    0x02, 0x02, 0x22, 0x52, 0x52, 0x3c, 0x52, 0x40, 0x52, 0x4d, 0x4d, 0x52,
-    0x3c, 0x4d, 0x4d, 0x4d, 0x3c, 0x58, 0x58, 0x58, 0x3a, 0x3f, 0x14, 0x33,
-    0x1b, 0x0c, 0x04, 0x05, 0x04, 0x2a, 0x1b, 0x0b, 0x04, 0x2a, 0x5b, 0x31,
-    0x35, 0x50, 0x1d, 0x01, 0x12, 0x35, 0x50, 0x50, 0x54, 0x14, 0x02, 0x05,
-    0x04, 0x05, 0x06, 0x0e, 0x06, 0x54, 0x2d, 0x06, 0x05, 0x26, 0x0e, 0x1f,
-    0x3e, 0x3d, 0x78, 0x4e, 0x1f, 0x0b, 0x0b, 0x9e, 0x8a, 0xa8, 0xa1, 0x9e,
-    0x4e, 0x05, 0x01, 0x01, 0x03, 0x05, 0x05, 0x05, 0x03, 0x01, 0x34, 0x5e,
-    0x21, 0x3e, 0x1f, 0x06, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 0x05, 0x5c,
-    0xa2, 0x9c, 0x5c, 0x36, 0x5c, 0xa2, 0xba, 0xb0, 0xbf, 0xb7, 0xa5, 0xa9,
-    0xba, 0xcb, 0xc6, 0x85, 0x7e, 0xb2, 0xbb, 0xbb, 0xd0, 0xc1, 0xbb, 0xc1,
-    0x9c, 0xc6, 0xc4, 0x97, 0xbb, 0x77, 0xb3, 0xac, 0xc6, 0x9d, 0xb3, 0xd0,
-    0xc6, 0xb2, 0x97, 0xbb, 0xd0, 0xbf, 0xc6, 0xcb, 0xd1, 0xcb, 0xc1, 0xc6,
-    0xb2, 0xcb, 0xdd, 0xd9, 0xe3, 0xe3, 0xe4, 0xe4, 0xe4, 0xe4, 0xe6, 0xdf,
-    0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xdf, 0xdf, 0xdd, 0xa6, 0xc8,
-    0xaa, 0x57, 0xaa, 0x8b, 0xaa, 0xaa, 0xd9, 0xdf, 0xd9, 0xd9, 0xd2, 0xdf,
-    0xd2, 0xc8, 0xb8, 0x88, 0xaa, 0x8b, 0x16, 0x32, 0x41, 0xa0, 0x99, 0xd9,
-    0xd2, 0x99, 0xb6, 0xd1, 0xbe, 0x88, 0x2c, 0x74, 0xb2, 0x74, 0x74, 0x99,
-    0x7f, 0x85, 0xbb, 0xbb, 0xa6, 0xac, 0x7f, 0x55, 0x2c, 0x16, 0x4b, 0x2c,
-    0x1c, 0x77, 0x4b, 0x65, 0x83, 0x9d, 0x98, 0x4b, 0x16, 0x1f, 0x16, 0x57,
-    0x26, 0x41, 0x06, 0x1f, 0x2c, 0x1c, 0x1f, 0x0b, 0x1f, 0x77, 0x76, 0xab,
-    0x4b, 0x7e, 0x36, 0x05, 0x26, 0x1a, 0x8c, 0x83, 0x71, 0x2b, 0x2d, 0x90,
-    0x0c, 0x8f, 0x7a, 0x7a, 0x69, 0x31, 0x76, 0x4b, 0x7a, 0x43, 0x8c, 0x2a,
-    0x1f, 0x05, 0x3e, 0x1c, 0x23, 0x0b, 0x05, 0x1b, 0x5e, 0x54, 0x0b, 0x64,
-    0x87, 0x5b, 0x64, 0x0b, 0x15, 0x07, 0x0c, 0x73, 0x50, 0x54, 0x50, 0x33,
-    0x24, 0x31, 0x3f, 0x7b, 0x66, 0x33, 0x07, 0x17, 0x14, 0x42, 0x4f, 0x4f,
-    0x5a, 0x53, 0x5a, 0x2a, 0x25, 0x0c, 0x15, 0x07, 0x0c, 0x04, 0x05, 0x04,
-    0x01, 0x04, 0x10, 0x0c, 0x28, 0x14, 0x04, 0x14, 0x02, 0x01, 0x04, 0x3c,
-    0x52, 0x3c, 0x3a, 0x40, 0x3c, 0x52, 0x40, 0x46, 0x52, 0x46, 0x3c, 0x4d,
-    0x4d, 0x4d, 0x58, 0x58, 0x3a, 0x3f, 0x3f, 0x24, 0x14, 0x0c, 0x06, 0x05,
-    0x01, 0x46, 0x2a, 0x0c, 0x05, 0x0c, 0x35, 0x67, 0x50, 0x20, 0x05, 0x05,
-    0x0b, 0x1c, 0x78, 0x64, 0x73, 0x6c, 0x0c, 0x0b, 0x05, 0x04, 0x0b, 0x49,
-    0x05, 0x06, 0x6f, 0x14, 0x4b, 0x4b, 0x23, 0x06, 0x54, 0x61, 0x7a, 0x27,
-    0x1a, 0x0c, 0x3e, 0x8a, 0x89, 0xa4, 0x9b, 0x54, 0x0e, 0x01, 0x01, 0x01,
-    0x05, 0x05, 0x01, 0x01, 0x05, 0x5c, 0x54, 0x90, 0x49, 0xaf, 0x9c, 0xa2,
-    0xa5, 0x7a, 0x5c, 0x4b, 0x2d, 0x5c, 0x83, 0xa2, 0xb0, 0x51, 0x85, 0xa9,
-    0xb7, 0xb5, 0xb1, 0xc4, 0xbf, 0xc4, 0xc4, 0xb7, 0x97, 0x9d, 0x6e, 0xc1,
-    0xc1, 0xb1, 0xbb, 0xc1, 0xc1, 0xb7, 0xbb, 0xbb, 0xb7, 0xb3, 0xc1, 0xc1,
-    0xac, 0x8d, 0xc1, 0xb3, 0xb7, 0xb0, 0xa5, 0xb1, 0xac, 0x97, 0xb2, 0x85,
-    0xa6, 0xbe, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd8, 0xc6, 0xd2, 0xd9,
-    0xe6, 0xdb, 0xe4, 0xe6, 0xeb, 0xe6, 0xe6, 0xe6, 0xe6, 0xe3, 0xdd, 0xd8,
-    0xdf, 0xdf, 0xdd, 0xd8, 0xd8, 0xd2, 0xd1, 0xaa, 0xd3, 0xdb, 0xe8, 0xe6,
-    0xe8, 0xe6, 0xe3, 0xe3, 0xe3, 0xc0, 0xd3, 0xbe, 0xaa, 0xaa, 0xb8, 0xaa,
-    0x65, 0x74, 0x6b, 0x88, 0xb8, 0x99, 0x99, 0xd9, 0xc8, 0xe4, 0xb8, 0xbe,
-    0xd1, 0x57, 0x65, 0x88, 0x5f, 0x97, 0xa7, 0x88, 0x7f, 0xd0, 0xc6, 0xb7,
-    0xb3, 0xcb, 0x55, 0x2c, 0x34, 0x1a, 0xa6, 0x2c, 0x08, 0x5c, 0x85, 0x65,
-    0x41, 0x4b, 0x8d, 0x11, 0x16, 0x57, 0x26, 0x4b, 0x2c, 0x14, 0x1f, 0x1f,
-    0x05, 0x1c, 0x4b, 0x11, 0x2d, 0x1f, 0x16, 0x0e, 0x15, 0x13, 0x0b, 0x1c,
-    0x15, 0x54, 0x61, 0x69, 0x1f, 0x1f, 0x26, 0x26, 0x3e, 0x94, 0x8f, 0xa4,
-    0xae, 0xa1, 0x81, 0x5e, 0x6c, 0x61, 0x4b, 0x61, 0x3d, 0x0b, 0x75, 0x2d,
-    0x23, 0x1d, 0x12, 0x06, 0x04, 0x2a, 0x12, 0x29, 0x43, 0x92, 0x67, 0x20,
-    0x29, 0x01, 0x50, 0x87, 0x67, 0x25, 0x66, 0x4f, 0x50, 0x2a, 0x2d, 0x1e,
-    0x53, 0x70, 0x1b, 0x33, 0x1b, 0x4f, 0x7b, 0x5a, 0x28, 0x28, 0x14, 0x04,
-    0x04, 0x05, 0x01, 0x01, 0x04, 0x07, 0x04, 0x0c, 0x19, 0x17, 0x28, 0x24,
-    0x24, 0x10, 0x0d, 0x33, 0x01, 0x02, 0x03, 0x40, 0x46, 0x28, 0x17, 0x33,
-    0x46, 0x52, 0x4d, 0x4d, 0x4d, 0x3c, 0x3c, 0x62, 0x62, 0x46, 0x4d, 0x62,
-    0x3a, 0x46, 0x3f, 0x3f, 0x15, 0x12, 0x0b, 0x01, 0x06, 0x70, 0x66, 0x13,
-    0x05, 0x04, 0x25, 0x67, 0x5a, 0x1a, 0x05, 0x05, 0x0c, 0x20, 0x54, 0x50,
-    0x73, 0x5b, 0x12, 0x0b, 0x03, 0x05, 0x15, 0x5b, 0x05, 0x05, 0x3e, 0x5e,
-    0x23, 0x76, 0x49, 0x36, 0x0c, 0x59, 0x4b, 0x1f, 0x0b, 0x0b, 0x75, 0x8a,
-    0x83, 0x80, 0x61, 0x0b, 0x05, 0x01, 0x01, 0x01, 0x12, 0x13, 0x0b, 0x0e,
-    0x12, 0x75, 0x8c, 0x94, 0x26, 0x83, 0xa8, 0xa1, 0xb5, 0x9e, 0x9a, 0x9c,
-    0xa9, 0x9a, 0x9c, 0x9a, 0x47, 0x9a, 0xaf, 0xb5, 0xbb, 0xbb, 0x9c, 0xbb,
-    0xbf, 0xbf, 0xa2, 0xb1, 0xb7, 0x97, 0xbb, 0xcb, 0xbb, 0xd0, 0xbb, 0xd0,
-    0xc9, 0xb7, 0xc1, 0xbb, 0xbb, 0xb7, 0xb7, 0xa5, 0x97, 0xa5, 0xb8, 0xb5,
-    0xa5, 0xb2, 0xb3, 0x97, 0xd7, 0xbb, 0xb3, 0xb2, 0xc1, 0xb7, 0xb7, 0xd1,
-    0xd1, 0xd0, 0xd1, 0xd7, 0xd1, 0xd8, 0xdd, 0xd2, 0xe6, 0xd9, 0xe4, 0xe8,
-    0xeb, 0xeb, 0xe8, 0xeb, 0xe6, 0xe3, 0xdd, 0xd8, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0x88, 0xc8, 0xdb, 0x8b, 0xe4, 0xe6, 0xe6, 0xe6, 0xe4, 0xe6, 0xdf,
-    0xca, 0xd2, 0xc0, 0xd3, 0xb6, 0xaa, 0x79, 0x99, 0xb8, 0x6b, 0x6b, 0xd2,
-    0xdd, 0x99, 0xdf, 0xaa, 0xaa, 0xb6, 0xd2, 0x79, 0x45, 0x34, 0x88, 0x57,
-    0xa7, 0xb8, 0x5f, 0x41, 0xb8, 0xcb, 0xb3, 0x7f, 0x98, 0xb3, 0x88, 0x41,
-    0x85, 0x74, 0x9d, 0x26, 0x2c, 0xa6, 0xb2, 0x55, 0x2c, 0x74, 0x34, 0x05,
-    0x15, 0x0e, 0x69, 0x74, 0x98, 0x41, 0x15, 0x0e, 0x12, 0x0b, 0x16, 0x06,
-    0x11, 0x1f, 0x2b, 0x3e, 0x1f, 0x0b, 0x0e, 0x15, 0x1f, 0x36, 0x1f, 0x13,
-    0x21, 0x3e, 0x1f, 0x06, 0x1f, 0x83, 0x9e, 0x8f, 0xa4, 0xa1, 0x54, 0x64,
-    0x83, 0x49, 0x42, 0x83, 0x15, 0x27, 0x3d, 0x4b, 0x13, 0x0b, 0x14, 0x0f,
-    0x05, 0x03, 0x06, 0x20, 0x42, 0x87, 0x50, 0x0b, 0x13, 0x15, 0x64, 0x3d,
-    0x73, 0x87, 0x5b, 0x70, 0x33, 0x31, 0x3f, 0x7b, 0x63, 0x50, 0x2a, 0x24,
-    0x23, 0x14, 0x24, 0x28, 0x12, 0x0b, 0x05, 0x05, 0x04, 0x06, 0x0c, 0x0c,
-    0x06, 0x06, 0x1e, 0x17, 0x28, 0x66, 0x3a, 0x24, 0x0c, 0x09, 0x1e, 0x14,
-    0x01, 0x02, 0x03, 0x33, 0x2e, 0x40, 0x4d, 0x52, 0x46, 0x40, 0x40, 0x3a,
-    0x4d, 0x4f, 0x3c, 0x4d, 0x58, 0x58, 0x3a, 0x4f, 0x28, 0x46, 0x46, 0x33,
-    0x1b, 0x0c, 0x04, 0x01, 0x14, 0x66, 0x67, 0x1d, 0x04, 0x03, 0x15, 0x35,
-    0x3d, 0x0c, 0x05, 0x0c, 0x23, 0x20, 0x23, 0x5b, 0x64, 0x49, 0x15, 0x0b,
-    0x03, 0x05, 0x15, 0x2d, 0x11, 0x05, 0x23, 0x7a, 0x27, 0x54, 0x68, 0x9b,
-    0x68, 0x4e, 0x1f, 0x0b, 0x13, 0x27, 0x7a, 0x61, 0x6f, 0x4b, 0x04, 0x05,
-    0x01, 0x01, 0x01, 0x01, 0x69, 0x94, 0x71, 0x9a, 0x8c, 0x36, 0x47, 0x61,
-    0x23, 0xa2, 0x83, 0xa2, 0xaf, 0xa8, 0x83, 0x6e, 0x1f, 0x26, 0x30, 0x3b,
-    0x77, 0xa2, 0xa9, 0xa2, 0xa2, 0xb5, 0xbb, 0xb1, 0xbb, 0xb1, 0xc9, 0xc9,
-    0xb7, 0xc1, 0x98, 0xa7, 0xc1, 0xc1, 0xc1, 0xc9, 0xc6, 0xb1, 0xac, 0xb7,
-    0xb7, 0xbb, 0xc9, 0xba, 0xac, 0xa5, 0xb3, 0xac, 0xa9, 0x9c, 0xd0, 0x9d,
-    0xbb, 0xc1, 0xbb, 0xb7, 0xac, 0xac, 0xb2, 0xbb, 0xc1, 0xc6, 0xcb, 0xcb,
-    0xd0, 0xd1, 0xd1, 0xdf, 0xdf, 0xe6, 0xe8, 0xeb, 0xe9, 0xeb, 0xeb, 0xeb,
-    0xe6, 0xe3, 0xe3, 0xdd, 0xdd, 0xe3, 0xe3, 0xe3, 0xe3, 0xc8, 0xc0, 0xe3,
-    0xdb, 0xc0, 0xd3, 0xe4, 0xeb, 0xd3, 0xea, 0xe4, 0xaa, 0xdb, 0xca, 0xaa,
-    0x79, 0xaa, 0xd9, 0xaa, 0x9d, 0xb6, 0xb6, 0xe3, 0xb6, 0xd9, 0xaa, 0x99,
-    0xc0, 0xaa, 0xaa, 0x57, 0x26, 0x88, 0x88, 0x5f, 0x44, 0x69, 0x9d, 0xa6,
-    0xa7, 0xc6, 0xc1, 0x9d, 0xbb, 0xbb, 0xa6, 0x7f, 0xac, 0x7e, 0x74, 0x47,
-    0x99, 0x71, 0xac, 0xa9, 0x97, 0x7e, 0x2c, 0x0b, 0x16, 0x4b, 0x8d, 0x44,
-    0x3e, 0x65, 0x26, 0x6e, 0x61, 0x4b, 0x26, 0x26, 0x36, 0x6a, 0x4b, 0x36,
-    0x1a, 0x0b, 0x1f, 0x16, 0x4b, 0x51, 0x36, 0x44, 0x3e, 0x49, 0x3e, 0x1c,
-    0x36, 0x2d, 0x30, 0x6a, 0x7a, 0x64, 0x54, 0x8c, 0x3d, 0x49, 0x76, 0x3d,
-    0x04, 0x7a, 0x27, 0x49, 0x50, 0x0b, 0x12, 0x12, 0x05, 0x05, 0x1d, 0x0c,
-    0x5b, 0x67, 0x0c, 0x04, 0x05, 0x25, 0x1d, 0x12, 0x50, 0x53, 0x67, 0x35,
-    0x67, 0x33, 0x5a, 0x63, 0x82, 0x63, 0x70, 0x29, 0x5a, 0x14, 0x1b, 0x14,
-    0x04, 0x0b, 0x1b, 0x24, 0x33, 0x28, 0x04, 0x0c, 0x17, 0x33, 0x46, 0x1e,
-    0x46, 0x3a, 0x17, 0x1e, 0x17, 0x07, 0x17, 0x28, 0x03, 0x01, 0x01, 0x17,
-    0x4d, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x4d, 0x46, 0x4d, 0x4d, 0x46, 0x58,
-    0x58, 0x58, 0x4f, 0x33, 0x2a, 0x46, 0x4f, 0x24, 0x18, 0x12, 0x04, 0x01,
-    0x14, 0x66, 0x50, 0x31, 0x12, 0x04, 0x05, 0x27, 0x13, 0x0b, 0x0e, 0x1b,
-    0x2d, 0x1c, 0x0c, 0x27, 0x23, 0x27, 0x12, 0x05, 0x05, 0x05, 0x15, 0x76,
-    0x2d, 0x0e, 0x54, 0x54, 0x23, 0x68, 0x6c, 0x75, 0x81, 0x36, 0x1a, 0x05,
-    0x11, 0x4b, 0x61, 0x1a, 0x06, 0x01, 0x01, 0x05, 0x03, 0x01, 0x01, 0x05,
-    0x7a, 0xad, 0x75, 0x9b, 0xaf, 0xa8, 0x1f, 0x4b, 0x23, 0xb5, 0xa8, 0x83,
-    0x90, 0xa1, 0x7e, 0x59, 0xa2, 0xa9, 0xa8, 0xb5, 0x8c, 0x7e, 0x77, 0x7e,
-    0x4b, 0x97, 0x9a, 0xa9, 0xb7, 0xb7, 0xd0, 0xc4, 0xa6, 0x97, 0xa7, 0x8d,
-    0xa6, 0xa9, 0xc1, 0xc9, 0xbb, 0x9d, 0xa7, 0xbb, 0xbb, 0x9d, 0xba, 0xb5,
-    0xb3, 0x85, 0xac, 0xa5, 0xbb, 0xc1, 0xb7, 0xbf, 0xa5, 0xbb, 0xb1, 0xc9,
-    0xb7, 0xa5, 0xbb, 0xc1, 0xcb, 0xbb, 0xcb, 0xc1, 0xcb, 0xcb, 0xbe, 0xd9,
-    0xe3, 0xe8, 0xe4, 0xeb, 0xf0, 0xf0, 0xf0, 0xeb, 0xe6, 0xe3, 0xe3, 0xe3,
-    0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xd9, 0x99, 0xd8, 0xd9, 0xe8, 0xd3, 0xca,
-    0xdc, 0xa0, 0xee, 0xe4, 0x79, 0xb6, 0xaa, 0xb6, 0xb6, 0xbe, 0xb8, 0xbe,
-    0xd2, 0x99, 0xe3, 0xd3, 0xaa, 0xd9, 0xc0, 0xaa, 0xb6, 0x8b, 0x6b, 0x79,
-    0x88, 0x57, 0x74, 0xa6, 0x99, 0xc1, 0xd7, 0xd8, 0xbb, 0xd1, 0xc9, 0xb2,
-    0xb7, 0xa6, 0xa7, 0x8d, 0x9d, 0x85, 0x97, 0x7f, 0x6e, 0x85, 0x9a, 0xbb,
-    0x9c, 0x7e, 0x65, 0x0b, 0x1f, 0x9c, 0x7e, 0x4b, 0x5f, 0x51, 0x9c, 0x65,
-    0xa5, 0x8d, 0x4b, 0xb5, 0x71, 0x9c, 0xa9, 0x61, 0x1f, 0x2d, 0x1f, 0x3d,
-    0x83, 0x5e, 0x6a, 0x6a, 0x36, 0x36, 0x27, 0x1c, 0x21, 0x4b, 0x36, 0x0f,
-    0x13, 0x27, 0x7a, 0x76, 0x69, 0x30, 0x4b, 0x0c, 0x0b, 0x49, 0x36, 0x3d,
-    0x76, 0x23, 0x1f, 0x15, 0x0b, 0x03, 0x15, 0x0b, 0x5b, 0x86, 0x12, 0x05,
-    0x06, 0x23, 0x3d, 0x3d, 0x87, 0x70, 0x50, 0x3f, 0x1b, 0x31, 0x67, 0x50,
-    0x82, 0x53, 0x2a, 0x25, 0x14, 0x10, 0x06, 0x14, 0x20, 0x42, 0x53, 0x33,
-    0x1e, 0x07, 0x0c, 0x33, 0x33, 0x1b, 0x1e, 0x62, 0x42, 0x14, 0x14, 0x06,
-    0x17, 0x22, 0x58, 0x3a, 0x01, 0x02, 0x01, 0x0d, 0x52, 0x52, 0x52, 0x4d,
-    0x4d, 0x4d, 0x52, 0x3c, 0x4d, 0x4d, 0x46, 0x52, 0x4f, 0x4f, 0x33, 0x4f,
-    0x58, 0x3f, 0x46, 0x3f, 0x1b, 0x0c, 0x06, 0x01, 0x05, 0x67, 0x2a, 0x31,
-    0x2a, 0x05, 0x06, 0x0b, 0x1e, 0x25, 0x27, 0x23, 0x27, 0x23, 0x0b, 0x0b,
-    0x3d, 0x50, 0x12, 0x06, 0x05, 0x01, 0x15, 0x6c, 0x3d, 0x0b, 0x3e, 0x36,
-    0x54, 0x6f, 0x7a, 0x71, 0x61, 0x18, 0x13, 0x0b, 0x0b, 0x0b, 0x01, 0x03,
-    0x05, 0x05, 0x0e, 0x05, 0x03, 0x03, 0x01, 0x13, 0x9b, 0xa8, 0x9e, 0x83,
-    0xb4, 0xaf, 0x47, 0x2c, 0x13, 0x9e, 0xaf, 0x9e, 0x83, 0x6a, 0x3b, 0xa2,
-    0xb5, 0xa8, 0x9a, 0xb5, 0xba, 0x9a, 0x54, 0x8d, 0xa2, 0x77, 0x74, 0x7e,
-    0x6e, 0x85, 0x97, 0x8d, 0x77, 0x74, 0xac, 0xb2, 0x9d, 0x97, 0x97, 0xa7,
-    0xa6, 0x98, 0xa5, 0xa5, 0xa5, 0x8d, 0xb3, 0xac, 0xb3, 0x8d, 0xb5, 0xc4,
-    0xac, 0xc9, 0xa5, 0xb3, 0xa7, 0xb2, 0xb1, 0xc6, 0xc6, 0xc6, 0xb7, 0xbb,
-    0xbb, 0xd1, 0xd1, 0xd7, 0xcb, 0xc6, 0xd2, 0xdf, 0xe6, 0xe4, 0xe4, 0xeb,
-    0xee, 0xf0, 0xf0, 0xeb, 0xe6, 0xe6, 0xe6, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6,
-    0xe4, 0xc0, 0xca, 0xc8, 0xa7, 0xdb, 0xeb, 0xeb, 0xd4, 0x7c, 0xd4, 0xb6,
-    0x8b, 0xb6, 0xe4, 0xc0, 0xb6, 0xc8, 0xd9, 0xd9, 0x99, 0xc8, 0xd3, 0xb6,
-    0xd9, 0xd2, 0xd9, 0xb6, 0x79, 0xa0, 0xd2, 0xaa, 0x99, 0x8b, 0xb8, 0xc1,
-    0xbb, 0xc6, 0xc6, 0xc6, 0xbb, 0x9d, 0xbb, 0x8d, 0xa7, 0xa6, 0xbb, 0xb1,
-    0xb1, 0x9d, 0x8d, 0x88, 0x55, 0x8d, 0x65, 0x97, 0x6e, 0x97, 0x7f, 0x11,
-    0x2c, 0x51, 0x26, 0x34, 0x5f, 0x8c, 0x85, 0x9c, 0x6a, 0x51, 0x83, 0xa2,
-    0x8c, 0x8c, 0x7a, 0x4b, 0x13, 0x5c, 0x1f, 0x3e, 0x77, 0x75, 0xb5, 0x9b,
-    0x6a, 0x83, 0x55, 0x54, 0x49, 0x54, 0x3e, 0x1a, 0x21, 0x3e, 0x1c, 0x36,
-    0x26, 0x23, 0x1c, 0x05, 0x1f, 0x69, 0x61, 0x5b, 0x49, 0x5e, 0x36, 0x3e,
-    0x2d, 0x15, 0x1b, 0x0b, 0x31, 0x6c, 0x06, 0x0b, 0x2d, 0x5b, 0x3f, 0x5b,
-    0x50, 0x73, 0x87, 0x73, 0x31, 0x14, 0x24, 0x1e, 0x2a, 0x1b, 0x20, 0x24,
-    0x29, 0x35, 0x33, 0x3a, 0x31, 0x46, 0x2a, 0x1e, 0x0c, 0x07, 0x2a, 0x33,
-    0x14, 0x10, 0x33, 0x4d, 0x33, 0x10, 0x17, 0x14, 0x46, 0x3a, 0x46, 0x33,
-    0x01, 0x02, 0x02, 0x04, 0x52, 0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x4d, 0x58,
-    0x4d, 0x52, 0x4d, 0x46, 0x4f, 0x33, 0x46, 0x4d, 0x58, 0x3f, 0x53, 0x46,
-    0x20, 0x07, 0x06, 0x03, 0x02, 0x35, 0x29, 0x42, 0x42, 0x0c, 0x04, 0x06,
-    0x23, 0x35, 0x3d, 0x50, 0x29, 0x36, 0x23, 0x15, 0x14, 0x50, 0x12, 0x0b,
-    0x03, 0x03, 0x0b, 0x54, 0x49, 0x06, 0x1f, 0x76, 0x75, 0x54, 0x75, 0x3e,
-    0x1b, 0x0b, 0x0b, 0x05, 0x02, 0x01, 0x01, 0x01, 0x0b, 0x27, 0x26, 0x05,
-    0x03, 0x01, 0x01, 0x61, 0x9b, 0x94, 0x9e, 0x71, 0x90, 0x9a, 0x59, 0x16,
-    0x0b, 0x3e, 0x85, 0x83, 0x51, 0x1a, 0x1f, 0x36, 0x47, 0x77, 0x89, 0x90,
-    0x7e, 0x5c, 0xa2, 0xaf, 0x9a, 0xa2, 0xc1, 0x9c, 0x97, 0x85, 0x85, 0x85,
-    0x97, 0x8d, 0x8d, 0x7f, 0x9d, 0x9d, 0x77, 0x5f, 0x74, 0x4b, 0x74, 0x9c,
-    0x97, 0xb1, 0x97, 0xb3, 0xa5, 0x85, 0xba, 0xb7, 0xb1, 0xba, 0xb7, 0xbb,
-    0xa9, 0xb7, 0x9c, 0xc6, 0xcb, 0xc1, 0xc1, 0xcb, 0xbb, 0xb7, 0xc8, 0xd8,
-    0xd1, 0xd8, 0xdf, 0xe3, 0xdf, 0xdb, 0xe8, 0xeb, 0xee, 0xee, 0xf0, 0xeb,
-    0xe6, 0xe6, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xe8, 0xe4, 0xc0, 0xc8, 0x7f,
-    0x99, 0xd9, 0xdb, 0xc0, 0xc0, 0x6d, 0xb6, 0xd3, 0xeb, 0xd3, 0xa0, 0xb6,
-    0xd9, 0xe3, 0xd2, 0xdd, 0x79, 0xd9, 0xaa, 0xca, 0xe3, 0xd2, 0xca, 0x8b,
-    0xaa, 0xca, 0xca, 0xb6, 0x79, 0xb6, 0xcb, 0xbe, 0xb8, 0xd1, 0xc6, 0xc6,
-    0xb7, 0x97, 0xac, 0xb3, 0x9d, 0x9d, 0xc6, 0xc1, 0xb1, 0x97, 0x85, 0xb2,
-    0x9c, 0x88, 0x1f, 0x8d, 0xa6, 0x77, 0x16, 0x16, 0x26, 0x11, 0x11, 0x26,
-    0x5c, 0xa2, 0x77, 0xa5, 0x71, 0x7e, 0x77, 0x59, 0x8d, 0x4b, 0x2d, 0x3e,
-    0x5e, 0x94, 0x34, 0x61, 0x9a, 0xab, 0xb5, 0xa8, 0xaf, 0xb4, 0x5e, 0xa1,
-    0xab, 0x83, 0x49, 0x36, 0x15, 0x4b, 0x1f, 0x1c, 0x15, 0x15, 0x06, 0x1f,
-    0x1d, 0x8f, 0x7a, 0x96, 0x2d, 0x6f, 0x3d, 0x26, 0x3d, 0x3d, 0x26, 0x0b,
-    0x0b, 0x1b, 0x01, 0x15, 0x2d, 0x50, 0x67, 0x50, 0x3d, 0x18, 0x31, 0x23,
-    0x31, 0x1b, 0x01, 0x01, 0x04, 0x3f, 0x70, 0x82, 0x4f, 0x35, 0x35, 0x46,
-    0x24, 0x1b, 0x10, 0x2a, 0x33, 0x24, 0x2a, 0x1e, 0x14, 0x17, 0x14, 0x14,
-    0x04, 0x17, 0x17, 0x1e, 0x2e, 0x58, 0x33, 0x2e, 0x01, 0x01, 0x01, 0x01,
-    0x40, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x3a, 0x58, 0x4d, 0x62, 0x58, 0x46,
-    0x46, 0x17, 0x24, 0x66, 0x58, 0x58, 0x42, 0x3a, 0x13, 0x0c, 0x06, 0x03,
-    0x01, 0x10, 0x5a, 0x7b, 0x67, 0x2a, 0x06, 0x06, 0x0b, 0x49, 0x50, 0x5b,
-    0x50, 0x1d, 0x27, 0x49, 0x15, 0x07, 0x15, 0x0b, 0x05, 0x05, 0x04, 0x26,
-    0x3d, 0x0c, 0x15, 0x8f, 0x64, 0x27, 0x15, 0x0c, 0x05, 0x01, 0x01, 0x01,
-    0x02, 0x05, 0x11, 0x0b, 0x2d, 0x75, 0x1a, 0x05, 0x01, 0x01, 0x06, 0x61,
-    0x9b, 0x9e, 0x95, 0x8c, 0x54, 0x71, 0x26, 0x1f, 0x0b, 0x0b, 0x16, 0x13,
-    0x16, 0x1f, 0x61, 0x59, 0x4b, 0x1f, 0x36, 0x26, 0x44, 0x4b, 0xc1, 0xba,
-    0xb5, 0xa2, 0xb1, 0xb7, 0xc6, 0xbf, 0xba, 0xbb, 0xc4, 0xb3, 0x74, 0x8d,
-    0x97, 0x85, 0x9d, 0x9d, 0xa6, 0x9c, 0x8d, 0x9c, 0x9c, 0xb3, 0x9c, 0x9c,
-    0x9d, 0x5c, 0xa5, 0xb1, 0xbf, 0xc9, 0xc4, 0xc9, 0xb3, 0xbb, 0xa9, 0xb7,
-    0xd0, 0xbb, 0xb3, 0xbb, 0xd1, 0xbb, 0xb2, 0xbe, 0xd1, 0xd8, 0xd1, 0xd9,
-    0xc8, 0xdf, 0xe8, 0xee, 0xeb, 0xeb, 0xeb, 0xe8, 0xeb, 0xeb, 0xeb, 0xeb,
-    0xeb, 0xe8, 0xeb, 0xe8, 0xe6, 0xe6, 0xdb, 0xca, 0xaa, 0xc0, 0xca, 0xdc,
-    0xaa, 0xd3, 0xca, 0xf1, 0xe4, 0xca, 0xaa, 0xdb, 0xe3, 0xdf, 0xc8, 0xc0,
-    0xaa, 0x79, 0xca, 0xa0, 0xca, 0xb6, 0x79, 0xb6, 0xc0, 0xc0, 0xd2, 0xaa,
-    0x79, 0xd2, 0xe2, 0xcb, 0xbe, 0xc1, 0xbb, 0xc6, 0xc1, 0xc6, 0xc6, 0xc6,
-    0xb8, 0xb2, 0xac, 0xcb, 0x7e, 0xbb, 0xa9, 0x97, 0x85, 0x97, 0x9d, 0x5c,
-    0x8d, 0x26, 0x1c, 0x16, 0x1f, 0x4b, 0x1f, 0x4b, 0x4b, 0x85, 0x77, 0x69,
-    0x2c, 0x85, 0x85, 0x71, 0x55, 0x36, 0x7a, 0x1f, 0x83, 0x61, 0x69, 0x7a,
-    0xb0, 0x9a, 0xb0, 0xb5, 0xa8, 0x83, 0x2d, 0x9b, 0x8c, 0x83, 0x9b, 0x8a,
-    0x2c, 0x15, 0x0b, 0x0c, 0x1f, 0x12, 0x0b, 0x27, 0x54, 0x6c, 0x73, 0x8f,
-    0x54, 0x92, 0x50, 0x23, 0x23, 0x5e, 0x23, 0x15, 0x01, 0x06, 0x01, 0x1d,
-    0x3d, 0x27, 0x50, 0x67, 0x35, 0x23, 0x20, 0x0b, 0x07, 0x35, 0x1b, 0x42,
-    0x50, 0x33, 0x53, 0x63, 0x33, 0x1b, 0x20, 0x2a, 0x07, 0x0c, 0x2a, 0x4f,
-    0x3f, 0x28, 0x46, 0x2a, 0x14, 0x06, 0x06, 0x09, 0x17, 0x22, 0x06, 0x28,
-    0x2e, 0x46, 0x1e, 0x3a, 0x01, 0x01, 0x01, 0x01, 0x22, 0x52, 0x52, 0x52,
-    0x52, 0x4d, 0x40, 0x4d, 0x4d, 0x62, 0x62, 0x3c, 0x46, 0x33, 0x22, 0x46,
-    0x28, 0x62, 0x4f, 0x66, 0x1e, 0x0b, 0x06, 0x05, 0x05, 0x0c, 0x66, 0x70,
-    0x70, 0x3f, 0x0c, 0x0b, 0x05, 0x35, 0x42, 0x49, 0x53, 0x49, 0x4c, 0x2d,
-    0x1d, 0x12, 0x0b, 0x06, 0x05, 0x04, 0x0b, 0x2b, 0x54, 0x34, 0x06, 0x27,
-    0x0c, 0x05, 0x03, 0x05, 0x01, 0x02, 0x0b, 0x01, 0x05, 0x04, 0x15, 0x0e,
-    0x2d, 0x4b, 0x05, 0x05, 0x03, 0x01, 0x3e, 0x83, 0x9b, 0xad, 0xa4, 0xb5,
-    0x77, 0x4b, 0x0c, 0x3b, 0x54, 0x8c, 0x65, 0x85, 0x89, 0x9a, 0x94, 0xa2,
-    0xa9, 0x9c, 0x2d, 0x98, 0xa2, 0x71, 0x77, 0xbf, 0xbf, 0xba, 0xb5, 0xba,
-    0xc6, 0xba, 0xbb, 0xc1, 0xb7, 0xbb, 0xa7, 0x8d, 0xb2, 0x9d, 0x8d, 0xbb,
-    0xc9, 0xbf, 0xba, 0xb1, 0xb3, 0xac, 0xb0, 0xac, 0x7e, 0x74, 0xb3, 0xbb,
-    0xc9, 0xd0, 0xc4, 0xd0, 0xbb, 0xb1, 0xb7, 0x9d, 0xc6, 0xd1, 0x98, 0xcb,
-    0xcb, 0xcb, 0xc1, 0xbe, 0xd2, 0xbe, 0xc8, 0xd2, 0xc8, 0xd9, 0xeb, 0xee,
-    0xee, 0xeb, 0xeb, 0xe8, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xe8, 0xeb, 0xeb,
-    0xeb, 0xeb, 0xeb, 0xe8, 0xdb, 0xd9, 0xd2, 0xc0, 0xaa, 0xdf, 0xc0, 0xd3,
-    0xc0, 0xe4, 0xe4, 0xdb, 0xca, 0xc8, 0xb6, 0xaa, 0xaa, 0xaa, 0xca, 0xdb,
-    0xdf, 0x6d, 0x8b, 0xc0, 0xca, 0xb6, 0xdf, 0x99, 0xd9, 0xd2, 0xd2, 0xd8,
-    0xd1, 0xcb, 0xd1, 0xbb, 0x97, 0x97, 0x7e, 0xa6, 0xc6, 0xc6, 0x97, 0xbb,
-    0x77, 0xd1, 0xa5, 0xa9, 0x51, 0x9d, 0x85, 0x97, 0x44, 0x05, 0x11, 0x1f,
-    0x4b, 0xa2, 0x55, 0x1f, 0x41, 0x3e, 0x3e, 0x7e, 0x85, 0x83, 0x5f, 0x4b,
-    0x16, 0x7e, 0x5f, 0x2d, 0x8c, 0x36, 0x94, 0x9b, 0x94, 0xa8, 0x6f, 0x5e,
-    0x49, 0x26, 0x13, 0x49, 0x23, 0x71, 0xae, 0x9b, 0x6a, 0x1a, 0x12, 0x0b,
-    0x12, 0x0b, 0x0b, 0x36, 0x27, 0x83, 0x6f, 0x7a, 0x73, 0x92, 0x49, 0x49,
-    0x54, 0x25, 0x49, 0x2d, 0x12, 0x01, 0x0b, 0x23, 0x73, 0x5b, 0x7d, 0x50,
-    0x1d, 0x24, 0x07, 0x50, 0x50, 0x2a, 0x1b, 0x4f, 0x5a, 0x2a, 0x2a, 0x29,
-    0x2a, 0x1d, 0x12, 0x14, 0x33, 0x20, 0x2a, 0x25, 0x10, 0x20, 0x14, 0x14,
-    0x0c, 0x14, 0x09, 0x24, 0x14, 0x10, 0x06, 0x33, 0x4d, 0x14, 0x4d, 0x4f,
-    0x01, 0x01, 0x01, 0x02, 0x09, 0x62, 0x52, 0x4d, 0x3c, 0x4d, 0x58, 0x3c,
-    0x28, 0x4d, 0x52, 0x58, 0x33, 0x33, 0x3a, 0x33, 0x58, 0x58, 0x4f, 0x66,
-    0x4f, 0x07, 0x04, 0x05, 0x03, 0x06, 0x5a, 0x70, 0x3f, 0x24, 0x20, 0x07,
-    0x05, 0x0b, 0x36, 0x49, 0x29, 0x49, 0x1d, 0x2d, 0x15, 0x0b, 0x04, 0x06,
-    0x04, 0x0b, 0x0b, 0x1f, 0x25, 0x1a, 0x05, 0x05, 0x01, 0x01, 0x01, 0x05,
-    0x06, 0x11, 0x15, 0x81, 0x7a, 0x5e, 0x23, 0x3d, 0x26, 0x0e, 0x05, 0x0a,
-    0x03, 0x01, 0x8c, 0xa8, 0xab, 0xa8, 0x7a, 0x5c, 0x1f, 0x0e, 0x0e, 0x51,
-    0x83, 0xb5, 0x95, 0xaf, 0xa2, 0xb5, 0x9a, 0xa2, 0xaf, 0xb5, 0xa2, 0x7a,
-    0x94, 0xaf, 0x6e, 0x77, 0x61, 0x97, 0xa2, 0xbb, 0xb7, 0xa9, 0xa6, 0xa6,
-    0xc1, 0xc1, 0xbf, 0xa7, 0x9d, 0xb7, 0xbb, 0x8d, 0xb1, 0xb7, 0xb0, 0xac,
-    0xb0, 0xba, 0xb3, 0xb3, 0x94, 0x8d, 0x9d, 0xc4, 0xc4, 0xd0, 0xbb, 0xc4,
-    0xb7, 0xa6, 0x97, 0x9d, 0xb7, 0xd0, 0xa6, 0xc6, 0xcb, 0xbe, 0xd8, 0xd1,
-    0xd9, 0xe4, 0xe8, 0xe3, 0xd9, 0xe3, 0xe8, 0xee, 0xeb, 0xeb, 0xe8, 0xeb,
-    0xee, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xe9, 0xeb, 0xeb, 0xe9, 0xe9,
-    0xeb, 0xe6, 0xb6, 0xd2, 0xbe, 0x99, 0x6b, 0xdb, 0xdc, 0xdc, 0xe5, 0xd3,
-    0xe4, 0xdf, 0xd2, 0xd2, 0xc0, 0xd2, 0xa0, 0xb6, 0xa0, 0x45, 0xaa, 0xdf,
-    0xe3, 0xdb, 0x99, 0xbe, 0xe3, 0xbe, 0xc8, 0xd2, 0xc6, 0xcb, 0x88, 0xb7,
-    0xbe, 0x55, 0x88, 0x97, 0xb1, 0xb3, 0x8d, 0x55, 0x6b, 0xc9, 0xbb, 0xb1,
-    0x9d, 0xb3, 0x97, 0x36, 0x1f, 0x74, 0x3e, 0x41, 0x85, 0x8d, 0x98, 0x3e,
-    0x0e, 0x55, 0x26, 0x55, 0x1f, 0x47, 0x7e, 0x1f, 0x4b, 0x13, 0x3e, 0x7e,
-    0x6a, 0xa9, 0x83, 0xb5, 0x9a, 0xb5, 0x7e, 0x3e, 0x77, 0x16, 0x49, 0x61,
-    0x77, 0x1f, 0x6c, 0x64, 0x61, 0x8f, 0x7a, 0x2d, 0x0e, 0x05, 0x15, 0x20,
-    0x23, 0x83, 0x7d, 0x3d, 0x54, 0x42, 0x49, 0x23, 0x54, 0x3d, 0x2d, 0x25,
-    0x23, 0x06, 0x12, 0x31, 0x87, 0x81, 0x42, 0x0b, 0x0c, 0x36, 0x67, 0x8a,
-    0x67, 0x42, 0x35, 0x42, 0x56, 0x53, 0x3f, 0x1b, 0x14, 0x03, 0x14, 0x2a,
-    0x42, 0x50, 0x4f, 0x3f, 0x2a, 0x1e, 0x04, 0x29, 0x17, 0x24, 0x10, 0x33,
-    0x10, 0x1e, 0x17, 0x22, 0x1e, 0x3c, 0x62, 0x28, 0x01, 0x02, 0x02, 0x01,
-    0x04, 0x52, 0x52, 0x4d, 0x46, 0x2e, 0x4d, 0x40, 0x28, 0x46, 0x3c, 0x52,
-    0x4d, 0x33, 0x4d, 0x46, 0x3a, 0x4d, 0x66, 0x46, 0x5a, 0x1b, 0x05, 0x05,
-    0x01, 0x05, 0x2a, 0x42, 0x42, 0x56, 0x3d, 0x0b, 0x04, 0x05, 0x15, 0x3d,
-    0x31, 0x29, 0x23, 0x29, 0x2d, 0x04, 0x15, 0x05, 0x06, 0x0b, 0x03, 0x0b,
-    0x05, 0x01, 0x05, 0x03, 0x03, 0x11, 0x1a, 0x1c, 0x13, 0x0b, 0x83, 0x9b,
-    0x78, 0x94, 0xa1, 0x1d, 0x0b, 0x05, 0x05, 0x01, 0x03, 0x03, 0x5e, 0x59,
-    0x54, 0x27, 0x0b, 0x0c, 0x0b, 0x0b, 0x2d, 0xaf, 0x6a, 0xb5, 0xa8, 0xaf,
-    0x9e, 0xa8, 0xaf, 0x90, 0x90, 0xaf, 0xaf, 0xba, 0xa2, 0x77, 0x65, 0xb7,
-    0xba, 0x8d, 0x71, 0xa6, 0xb1, 0xa6, 0x9c, 0xbb, 0xc4, 0xbf, 0xc1, 0xb7,
-    0xa9, 0xb2, 0xb1, 0xb1, 0x97, 0x9c, 0xc6, 0xb3, 0xab, 0xba, 0xb0, 0xc4,
-    0x97, 0xb3, 0xb3, 0x85, 0xb1, 0xa9, 0xa2, 0xb7, 0x97, 0xb1, 0xa6, 0xbb,
-    0xa6, 0xb7, 0xb2, 0xb2, 0xd1, 0xd2, 0xd2, 0xd2, 0xe6, 0xeb, 0xe6, 0xe3,
-    0xd9, 0xe3, 0xe4, 0xeb, 0xf0, 0xf0, 0xeb, 0xf0, 0xf0, 0xf0, 0xeb, 0xeb,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xeb, 0xf0, 0xeb, 0xe8, 0xe3, 0xe3,
-    0xe3, 0xe4, 0x99, 0xdb, 0xe9, 0xe9, 0xe4, 0xe4, 0xe8, 0xe3, 0xd9, 0xc0,
-    0xdf, 0xaa, 0xc0, 0xca, 0xd3, 0xc0, 0xd3, 0xe3, 0xdf, 0xb6, 0x8b, 0xdf,
-    0xbe, 0xca, 0xc8, 0xd9, 0xd1, 0xbe, 0x74, 0x97, 0xbe, 0xa7, 0x9d, 0x5c,
-    0x9d, 0xc1, 0xa7, 0x65, 0x57, 0x74, 0x6e, 0x7e, 0x74, 0x4b, 0x8d, 0x3e,
-    0x9d, 0x5f, 0xa5, 0xb7, 0xa5, 0x9c, 0xb1, 0xa5, 0x5c, 0x2d, 0xa5, 0x85,
-    0x6a, 0xba, 0x4b, 0x3e, 0x7e, 0x47, 0x07, 0x59, 0x94, 0xaf, 0xb0, 0xb4,
-    0xaf, 0xb4, 0x7a, 0x94, 0x77, 0x14, 0x47, 0x9e, 0x64, 0x36, 0xa1, 0xad,
-    0xab, 0x83, 0x3d, 0x54, 0x15, 0x0b, 0x11, 0x15, 0x0e, 0x7a, 0x7d, 0x36,
-    0x36, 0x64, 0x6f, 0x54, 0x76, 0x49, 0x12, 0x1f, 0x0b, 0x03, 0x06, 0x49,
-    0x64, 0x07, 0x23, 0x64, 0x64, 0x67, 0x70, 0x53, 0x87, 0x53, 0x5a, 0x67,
-    0x7b, 0x82, 0x70, 0x31, 0x20, 0x53, 0x5a, 0x1b, 0x2a, 0x5a, 0x4f, 0x5a,
-    0x12, 0x20, 0x24, 0x2a, 0x3a, 0x33, 0x66, 0x33, 0x1e, 0x46, 0x33, 0x17,
-    0x24, 0x3a, 0x17, 0x33, 0x01, 0x02, 0x00, 0x01, 0x01, 0x46, 0x3c, 0x40,
-    0x46, 0x3a, 0x3c, 0x52, 0x52, 0x58, 0x3a, 0x46, 0x4d, 0x4f, 0x1e, 0x33,
-    0x2a, 0x4f, 0x46, 0x58, 0x66, 0x2a, 0x06, 0x05, 0x05, 0x04, 0x1b, 0x66,
-    0x53, 0x53, 0x3f, 0x49, 0x06, 0x05, 0x07, 0x5b, 0x23, 0x3d, 0x1d, 0x2d,
-    0x5b, 0x0b, 0x14, 0x05, 0x06, 0x05, 0x05, 0x05, 0x01, 0x01, 0x05, 0x13,
-    0x16, 0x4b, 0x1d, 0x16, 0x06, 0x2c, 0x81, 0x76, 0x6f, 0x6a, 0x61, 0x5e,
-    0x06, 0x08, 0x03, 0x01, 0x05, 0x05, 0x05, 0x05, 0x08, 0x11, 0x0e, 0x0e,
-    0x0b, 0x6a, 0x4e, 0xaf, 0x47, 0x94, 0xa8, 0xaf, 0x9e, 0xb5, 0xa8, 0x90,
-    0x9a, 0xba, 0xb5, 0xaf, 0xb5, 0xbf, 0x8d, 0xb5, 0xbf, 0xba, 0xb7, 0x61,
-    0x9d, 0xb7, 0xb1, 0xbb, 0xb1, 0xc9, 0xc6, 0xb3, 0xa6, 0xac, 0xbb, 0xc9,
-    0xac, 0x8d, 0x85, 0x9c, 0xb3, 0xb1, 0xa5, 0xc4, 0xb5, 0x8c, 0xbb, 0x8d,
-    0xbb, 0xb7, 0xc1, 0xbb, 0xb7, 0xc9, 0xbe, 0xa6, 0xb8, 0xa7, 0xc8, 0xc8,
-    0xc0, 0xd9, 0xe4, 0xdb, 0xe4, 0xeb, 0xeb, 0xe6, 0xdf, 0xe3, 0xe8, 0xe9,
-    0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf0, 0xe9, 0xf0, 0xf0, 0xf4, 0xf4, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xeb, 0xe6, 0xe4, 0xe6, 0xe4, 0xd9, 0xd9,
-    0xe4, 0xdb, 0xdb, 0xe4, 0xe3, 0xbe, 0x99, 0xdb, 0xd9, 0xca, 0xdb, 0xdb,
-    0xdb, 0xdb, 0xe6, 0xe3, 0xd3, 0xa0, 0xca, 0xca, 0xdf, 0xc8, 0xe3, 0xd2,
-    0xd8, 0xcb, 0xc8, 0xd1, 0x8d, 0x74, 0xbb, 0xa7, 0x4b, 0x97, 0x7f, 0x16,
-    0x16, 0x32, 0x1f, 0x2d, 0x57, 0x1f, 0x2c, 0x74, 0xbb, 0x5f, 0xac, 0xa5,
-    0x3e, 0xa6, 0xb5, 0x94, 0x5c, 0x71, 0x26, 0x4b, 0x7e, 0x3e, 0x65, 0x6a,
-    0x9a, 0x3e, 0x16, 0x7e, 0xb0, 0xa8, 0xb0, 0xb5, 0xb5, 0xae, 0x9e, 0x94,
-    0x6a, 0x59, 0x8f, 0xae, 0x6a, 0x6a, 0x76, 0x8f, 0x75, 0x3e, 0x36, 0x36,
-    0x06, 0x2d, 0x13, 0x11, 0x0f, 0x3e, 0x3d, 0x23, 0x18, 0x36, 0x5e, 0x3d,
-    0x1b, 0x64, 0x2d, 0x3d, 0x23, 0x04, 0x05, 0x15, 0x04, 0x5b, 0x67, 0x6c,
-    0x93, 0x5a, 0x50, 0x82, 0x87, 0x5a, 0x87, 0x67, 0x31, 0x31, 0x0c, 0x2a,
-    0x70, 0x63, 0x82, 0x42, 0x42, 0x24, 0x2a, 0x07, 0x3a, 0x58, 0x33, 0x33,
-    0x28, 0x62, 0x66, 0x28, 0x62, 0x66, 0x2a, 0x1e, 0x66, 0x28, 0x22, 0x17,
-    0x06, 0x01, 0x00, 0x01, 0x01, 0x2f, 0x40, 0x46, 0x46, 0x24, 0x3a, 0x58,
-    0x58, 0x62, 0x58, 0x3c, 0x58, 0x24, 0x33, 0x3a, 0x1e, 0x2a, 0x33, 0x3f,
-    0x4f, 0x33, 0x06, 0x06, 0x03, 0x03, 0x05, 0x53, 0x5a, 0x46, 0x67, 0x42,
-    0x0b, 0x05, 0x04, 0x20, 0x13, 0x36, 0x1b, 0x54, 0x23, 0x12, 0x15, 0x05,
-    0x05, 0x03, 0x05, 0x01, 0x01, 0x15, 0x6c, 0x2d, 0x36, 0x23, 0x13, 0x0e,
-    0x12, 0x26, 0x49, 0x81, 0x83, 0x3d, 0x7e, 0x94, 0x1a, 0x05, 0x01, 0x01,
-    0x01, 0x05, 0x0b, 0x08, 0x0b, 0x16, 0x1f, 0x55, 0x8c, 0xa2, 0x6a, 0xa8,
-    0x90, 0x3d, 0x94, 0xa8, 0x94, 0xa8, 0xa8, 0xaf, 0xa9, 0xa9, 0xba, 0xa8,
-    0xb5, 0xb0, 0xb1, 0xa2, 0xc4, 0xb5, 0xb5, 0xa6, 0x8d, 0xc1, 0xbb, 0xb7,
-    0xcb, 0xc4, 0xc9, 0xbb, 0xa9, 0xa6, 0xc4, 0xbb, 0xb7, 0x8c, 0xa6, 0x7e,
-    0x97, 0xa5, 0x9b, 0xba, 0xbf, 0xb3, 0xab, 0xbb, 0xa2, 0x98, 0xd0, 0xd0,
-    0xb1, 0xc4, 0xc1, 0xc6, 0xc8, 0x99, 0xb6, 0xdb, 0xca, 0xd3, 0xca, 0xe4,
-    0xca, 0xe4, 0xe5, 0xdb, 0xdf, 0xd9, 0xe4, 0xe9, 0xf0, 0xf0, 0xf4, 0xf5,
-    0xf4, 0xf4, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf4, 0xf0, 0xf4, 0xf0,
-    0xf0, 0xeb, 0xe8, 0xe8, 0xe3, 0xdb, 0xd2, 0xd9, 0xd9, 0xdf, 0xe8, 0xdb,
-    0xd2, 0xca, 0x8e, 0xd3, 0xdb, 0xea, 0xea, 0xdb, 0xca, 0xdb, 0xe4, 0xd9,
-    0xa0, 0xe4, 0xca, 0xca, 0xe4, 0xdf, 0xd2, 0xd9, 0xbe, 0xc8, 0xb8, 0xbe,
-    0xb8, 0x51, 0x74, 0x88, 0x57, 0x6e, 0x41, 0x2c, 0x5d, 0x41, 0x41, 0xbb,
-    0x7f, 0x21, 0x34, 0x97, 0x6b, 0x74, 0xc6, 0x97, 0x97, 0x71, 0x6e, 0x4b,
-    0xb3, 0x44, 0x71, 0x7e, 0x71, 0x5e, 0xb3, 0x61, 0x55, 0x4b, 0x2d, 0xbf,
-    0xba, 0xb5, 0xab, 0x9e, 0xaf, 0xa8, 0xaf, 0x64, 0x59, 0x8c, 0xaf, 0xae,
-    0x8c, 0x8f, 0x9b, 0xad, 0x8c, 0x49, 0x3e, 0x2d, 0x0b, 0x6a, 0x5e, 0x36,
-    0x26, 0x1a, 0x12, 0x31, 0x2d, 0x5e, 0x5b, 0x3e, 0x12, 0x2b, 0x76, 0x31,
-    0x16, 0x05, 0x02, 0x04, 0x2d, 0x29, 0x1d, 0x50, 0x67, 0x31, 0x87, 0x82,
-    0x67, 0x73, 0x53, 0x67, 0x64, 0x0c, 0x3d, 0x42, 0x46, 0x67, 0x53, 0x33,
-    0x1b, 0x14, 0x20, 0x42, 0x63, 0x28, 0x5a, 0x28, 0x63, 0x66, 0x24, 0x4d,
-    0x53, 0x3a, 0x10, 0x3a, 0x17, 0x33, 0x66, 0x62, 0x10, 0x01, 0x00, 0x01,
-    0x01, 0x28, 0x4d, 0x3c, 0x4d, 0x4d, 0x46, 0x3c, 0x4d, 0x40, 0x4f, 0x4f,
-    0x62, 0x62, 0x4d, 0x3f, 0x33, 0x33, 0x22, 0x33, 0x42, 0x33, 0x0b, 0x04,
-    0x01, 0x03, 0x03, 0x24, 0x4f, 0x67, 0x3d, 0x23, 0x27, 0x06, 0x05, 0x04,
-    0x1b, 0x12, 0x49, 0x31, 0x50, 0x0c, 0x0c, 0x05, 0x03, 0x03, 0x05, 0x0b,
-    0x2d, 0x54, 0x75, 0x54, 0x23, 0x36, 0x15, 0x11, 0x2c, 0x3e, 0x5b, 0x8f,
-    0x75, 0x7a, 0x8f, 0x8a, 0x71, 0x03, 0x03, 0x01, 0x05, 0x3e, 0x61, 0x54,
-    0x3e, 0x83, 0x9c, 0x9a, 0x8c, 0x9a, 0x75, 0xaf, 0xbd, 0x61, 0x7e, 0xaf,
-    0xa9, 0x9e, 0xa2, 0x9e, 0xaf, 0xaf, 0xba, 0x9a, 0xb1, 0xbf, 0xba, 0x94,
-    0xbf, 0xb7, 0xb5, 0xa9, 0x9c, 0xa9, 0xbb, 0xb1, 0xbf, 0xc9, 0xbf, 0xbb,
-    0xbb, 0xa2, 0xbb, 0xba, 0xbb, 0x94, 0xa5, 0xa5, 0xb1, 0x85, 0x94, 0xac,
-    0xbf, 0xb0, 0xb7, 0xb7, 0xb7, 0xc6, 0x9a, 0xb1, 0xc6, 0xd1, 0xcb, 0xc8,
-    0xbe, 0xc0, 0xaa, 0xdb, 0xdc, 0xd3, 0xd3, 0xdc, 0xd3, 0xe4, 0xe9, 0xe4,
-    0xeb, 0xe6, 0xeb, 0xf0, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf4, 0xf4,
-    0xf5, 0xf4, 0xf5, 0xf5, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xeb, 0xe8,
-    0xe6, 0xdb, 0xdb, 0xc8, 0xcb, 0xd1, 0xd9, 0xd3, 0xc0, 0xa0, 0xb6, 0xe4,
-    0xeb, 0xeb, 0xe4, 0xd3, 0xe4, 0xe4, 0xe8, 0xa0, 0xa0, 0xd3, 0xd9, 0xd2,
-    0xc0, 0xb6, 0xc8, 0xbe, 0xb2, 0xb2, 0x97, 0x6e, 0xa6, 0x74, 0x5f, 0x65,
-    0x6e, 0xa7, 0xac, 0xbe, 0x97, 0x41, 0x5f, 0x88, 0x74, 0x26, 0x8d, 0x5c,
-    0x26, 0x4b, 0x8d, 0xa5, 0xa2, 0xac, 0x44, 0x97, 0x65, 0x71, 0xa9, 0x9c,
-    0x4b, 0x71, 0x3e, 0x4b, 0x85, 0x55, 0x98, 0x9c, 0xba, 0xb4, 0xb5, 0x83,
-    0x71, 0x7a, 0x9b, 0x7e, 0x7a, 0xa1, 0xae, 0xa1, 0xa4, 0x8f, 0x9b, 0x8f,
-    0x71, 0x75, 0x2c, 0x1c, 0x2d, 0x6f, 0x4e, 0x54, 0x36, 0x0e, 0x1f, 0x54,
-    0x1f, 0x20, 0x23, 0x20, 0x2d, 0x5e, 0x29, 0x15, 0x0b, 0x05, 0x15, 0x26,
-    0x1c, 0x2d, 0x36, 0x5b, 0x67, 0x73, 0x67, 0x7d, 0x3f, 0x50, 0x70, 0x53,
-    0x3f, 0x67, 0x24, 0x53, 0x50, 0x67, 0x50, 0x33, 0x1a, 0x3f, 0x29, 0x58,
-    0x42, 0x29, 0x33, 0x62, 0x63, 0x1e, 0x29, 0x46, 0x1e, 0x17, 0x3a, 0x28,
-    0x28, 0x62, 0x62, 0x58, 0x1e, 0x01, 0x02, 0x02, 0x01, 0x17, 0x46, 0x3a,
-    0x3c, 0x4d, 0x4d, 0x4d, 0x62, 0x4f, 0x33, 0x2e, 0x58, 0x62, 0x46, 0x33,
-    0x42, 0x33, 0x2e, 0x24, 0x2a, 0x33, 0x13, 0x03, 0x01, 0x04, 0x0b, 0x0c,
-    0x42, 0x25, 0x23, 0x50, 0x20, 0x0b, 0x04, 0x06, 0x13, 0x2b, 0x42, 0x49,
-    0x50, 0x1a, 0x04, 0x06, 0x03, 0x03, 0x05, 0x3d, 0x54, 0x8a, 0x6c, 0x59,
-    0x15, 0x2b, 0x2c, 0x1c, 0x05, 0x3e, 0x8a, 0x4b, 0x5e, 0x83, 0x9b, 0xab,
-    0x6a, 0x05, 0x03, 0x01, 0x0e, 0x8c, 0xa8, 0xb4, 0xa8, 0x95, 0xa8, 0xa8,
-    0x8c, 0x9a, 0x71, 0xaf, 0xb4, 0x85, 0x9c, 0x7a, 0x9e, 0xa2, 0xaf, 0xa8,
-    0xb5, 0xba, 0xba, 0xa8, 0xb1, 0xba, 0xbf, 0x85, 0xb1, 0xb1, 0xa9, 0xba,
-    0xb7, 0xb1, 0xbb, 0xb1, 0xb7, 0xc4, 0xbb, 0xb1, 0xc6, 0xac, 0xb1, 0xbb,
-    0xbf, 0xac, 0x9c, 0xb3, 0xbf, 0x9c, 0x94, 0x7e, 0xa9, 0xb0, 0x90, 0xc4,
-    0xb1, 0xa2, 0xa2, 0xb2, 0xc6, 0xb8, 0xbe, 0xb2, 0xbe, 0xd3, 0xc0, 0xca,
-    0xe5, 0xdc, 0xe5, 0xe5, 0xe9, 0xe5, 0xf0, 0xf0, 0xeb, 0xeb, 0xeb, 0xf4,
-    0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf5,
-    0xf5, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xeb, 0xeb, 0xeb, 0xe5, 0xd3, 0xc8,
-    0xcb, 0xbe, 0x9d, 0xd2, 0xb6, 0xdc, 0xca, 0xee, 0xeb, 0xe4, 0xd3, 0xeb,
-    0xe6, 0xe4, 0xb6, 0xa0, 0xdb, 0xe4, 0xdb, 0xdb, 0xb6, 0xc0, 0xb8, 0xc8,
-    0xc8, 0xa7, 0xb2, 0x88, 0x9d, 0xb1, 0xa7, 0x57, 0x7f, 0x74, 0x6e, 0x74,
-    0x97, 0x44, 0x41, 0x2c, 0x11, 0x74, 0xbb, 0x8d, 0x7f, 0x7f, 0x41, 0x26,
-    0x55, 0x47, 0x4b, 0x85, 0x9c, 0x9a, 0x69, 0x2c, 0x5c, 0x3d, 0x6a, 0x6e,
-    0x5e, 0x55, 0xb5, 0x7e, 0xb5, 0xb5, 0xba, 0x61, 0x47, 0x6a, 0x71, 0x59,
-    0x61, 0xaf, 0xab, 0x9a, 0x9e, 0x8f, 0x5e, 0x59, 0x36, 0x6f, 0x3e, 0x0b,
-    0x15, 0x3b, 0x54, 0x54, 0x1f, 0x15, 0x21, 0x36, 0x1f, 0x13, 0x49, 0x3d,
-    0x36, 0x5e, 0x29, 0x0b, 0x1c, 0x15, 0x2b, 0x1d, 0x1a, 0x31, 0x92, 0x92,
-    0x7b, 0x42, 0x42, 0x42, 0x73, 0x73, 0x33, 0x53, 0x7b, 0x67, 0x53, 0x2a,
-    0x4f, 0x66, 0x7b, 0x42, 0x42, 0x33, 0x3f, 0x3f, 0x10, 0x1b, 0x4f, 0x66,
-    0x4f, 0x29, 0x58, 0x66, 0x4f, 0x4d, 0x4d, 0x58, 0x4d, 0x62, 0x62, 0x3c,
-    0x28, 0x01, 0x01, 0x01, 0x01, 0x10, 0x28, 0x3c, 0x3a, 0x3c, 0x28, 0x4d,
-    0x62, 0x33, 0x2e, 0x3a, 0x4f, 0x58, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x2a,
-    0x24, 0x31, 0x1e, 0x04, 0x06, 0x06, 0x06, 0x0b, 0x31, 0x15, 0x25, 0x2a,
-    0x1c, 0x13, 0x06, 0x05, 0x05, 0x3d, 0x3d, 0x50, 0x54, 0x1f, 0x04, 0x05,
-    0x03, 0x05, 0x0b, 0x49, 0x54, 0x7d, 0x6c, 0x54, 0x1c, 0x26, 0x1d, 0x13,
-    0x08, 0x5e, 0x81, 0x3b, 0x84, 0x7a, 0x8f, 0xae, 0x4b, 0x05, 0x03, 0x01,
-    0x1f, 0x8f, 0x9b, 0xb4, 0xa8, 0x94, 0xb0, 0xb5, 0x94, 0x9e, 0x59, 0xa8,
-    0xa8, 0x9e, 0x7a, 0x9a, 0x7a, 0xa2, 0xa8, 0xb5, 0xa8, 0xb5, 0xb5, 0xbf,
-    0xa2, 0xba, 0xc4, 0x9a, 0xa5, 0xb1, 0xa2, 0xba, 0xb5, 0xc4, 0xbf, 0xc4,
-    0xbb, 0xc6, 0xc4, 0xbb, 0xc4, 0xbb, 0xa2, 0xc1, 0xbf, 0xbf, 0xb0, 0xb5,
-    0xb1, 0xa5, 0xb1, 0x7e, 0x85, 0xac, 0x9c, 0xbb, 0xb7, 0x88, 0xc6, 0xc1,
-    0xb8, 0xc1, 0xd8, 0xd2, 0xd3, 0xdb, 0xca, 0xca, 0xdc, 0xdc, 0xe9, 0xe5,
-    0xf3, 0xed, 0xe5, 0xe9, 0xf0, 0xf0, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5,
-    0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf4,
-    0xf4, 0xf0, 0xf0, 0xf0, 0xe5, 0xe5, 0xe5, 0xe4, 0xdf, 0xd8, 0x88, 0x88,
-    0xc8, 0xe4, 0xca, 0xeb, 0xe4, 0xdb, 0xeb, 0xe6, 0xe4, 0xb6, 0xc0, 0xca,
-    0xdb, 0xdb, 0xdb, 0xd9, 0xd3, 0xdf, 0xb8, 0xa7, 0xb8, 0xc6, 0xd8, 0xd0,
-    0xb1, 0xc6, 0xb1, 0xa6, 0xb7, 0xa7, 0x55, 0x88, 0xa7, 0x65, 0x8d, 0x41,
-    0x85, 0xa7, 0xa7, 0x5f, 0xb2, 0x97, 0x41, 0x74, 0xac, 0x8d, 0x7e, 0xbf,
-    0xb7, 0x85, 0x55, 0x9c, 0xb5, 0xa5, 0x8c, 0x5c, 0x26, 0x4b, 0x8c, 0x83,
-    0xaf, 0xba, 0xb5, 0x9a, 0x2d, 0x5c, 0x1f, 0x77, 0x3e, 0x83, 0x9e, 0x94,
-    0x4e, 0x3e, 0x69, 0x4b, 0x11, 0x55, 0x1f, 0x0b, 0x36, 0x23, 0x2d, 0x1f,
-    0x23, 0x1f, 0x23, 0x5e, 0x26, 0x0b, 0x23, 0x5e, 0x07, 0x36, 0x50, 0x23,
-    0x1c, 0x1c, 0x1a, 0x15, 0x0b, 0x25, 0x7d, 0x92, 0x87, 0x67, 0x54, 0x29,
-    0x3f, 0x14, 0x31, 0x67, 0x67, 0x67, 0x66, 0x67, 0x70, 0x67, 0x3f, 0x1e,
-    0x42, 0x29, 0x29, 0x33, 0x14, 0x3f, 0x5a, 0x58, 0x3f, 0x4f, 0x4f, 0x3a,
-    0x58, 0x4d, 0x62, 0x62, 0x62, 0x66, 0x62, 0x62, 0x1e, 0x02, 0x01, 0x01,
-    0x01, 0x0d, 0x28, 0x40, 0x3c, 0x3a, 0x1e, 0x4d, 0x3a, 0x3a, 0x33, 0x42,
-    0x4f, 0x4d, 0x33, 0x33, 0x33, 0x46, 0x24, 0x46, 0x31, 0x20, 0x25, 0x0b,
-    0x06, 0x06, 0x04, 0x06, 0x20, 0x29, 0x29, 0x1b, 0x31, 0x20, 0x0b, 0x05,
-    0x05, 0x20, 0x2d, 0x35, 0x1f, 0x15, 0x0b, 0x06, 0x06, 0x05, 0x1c, 0x71,
-    0x2d, 0x36, 0x49, 0x3d, 0x1a, 0x23, 0x1c, 0x0e, 0x0b, 0x54, 0x6c, 0x54,
-    0x7a, 0x7a, 0x83, 0xb4, 0x36, 0x08, 0x01, 0x03, 0x2d, 0xa1, 0x8c, 0xad,
-    0xa8, 0x9e, 0xa8, 0xa8, 0x7a, 0xaf, 0x75, 0x9e, 0xa8, 0xaf, 0x59, 0xaf,
-    0x75, 0x6a, 0x83, 0xb5, 0xaf, 0xb5, 0xb5, 0xbf, 0xa2, 0xb1, 0xb1, 0xaf,
-    0xa5, 0xba, 0xb1, 0xbf, 0xb1, 0xc4, 0xb7, 0xc9, 0xbb, 0xb7, 0xc9, 0xbf,
-    0xbb, 0xc1, 0xa5, 0xba, 0xbf, 0xba, 0xc4, 0xa5, 0xbf, 0xac, 0xa5, 0xa2,
-    0x9d, 0x8d, 0x97, 0xb1, 0xb1, 0x88, 0xc6, 0xd7, 0xb2, 0xd1, 0xd1, 0xbe,
-    0xd3, 0xdb, 0xca, 0xdc, 0xe8, 0xe4, 0xe9, 0xe9, 0xf0, 0xf0, 0xf0, 0xed,
-    0xe9, 0xf0, 0xf4, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xe5, 0xe9, 0xe8, 0xe4, 0xe6, 0xdf, 0x99, 0xa7, 0xd9, 0xe4, 0xe9, 0xdc,
-    0xdc, 0xeb, 0xef, 0xe8, 0xb6, 0xc0, 0xe4, 0xca, 0xaa, 0xca, 0xc0, 0xdf,
-    0xdf, 0xdd, 0xd2, 0xbe, 0xb8, 0xcb, 0xcb, 0xd1, 0xb2, 0xbb, 0xc1, 0xbb,
-    0xb1, 0xb7, 0x55, 0x5f, 0xa7, 0x88, 0x79, 0xb7, 0xb3, 0x85, 0x34, 0x7e,
-    0x9d, 0xa5, 0x34, 0xa5, 0xd0, 0x69, 0x7e, 0xa2, 0x97, 0x2d, 0x6a, 0xba,
-    0xaf, 0xac, 0xa9, 0x71, 0x34, 0x83, 0x83, 0x71, 0x71, 0xbd, 0xaf, 0xaf,
-    0x83, 0x5c, 0x54, 0x7a, 0x2d, 0x61, 0x47, 0x6f, 0x6a, 0x51, 0x59, 0x27,
-    0x13, 0x26, 0x06, 0x1a, 0x23, 0x2d, 0x2c, 0x12, 0x3e, 0x36, 0x36, 0x54,
-    0x27, 0x1c, 0x15, 0x1a, 0x36, 0x5e, 0x50, 0x13, 0x07, 0x36, 0x1f, 0x1f,
-    0x12, 0x12, 0x64, 0x73, 0x67, 0x73, 0x1d, 0x2a, 0x35, 0x3f, 0x67, 0x67,
-    0x73, 0x70, 0x63, 0x63, 0x66, 0x42, 0x14, 0x42, 0x1e, 0x5a, 0x33, 0x3f,
-    0x24, 0x4f, 0x66, 0x72, 0x3a, 0x46, 0x46, 0x58, 0x58, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x22, 0x01, 0x01, 0x02, 0x01, 0x06, 0x3a, 0x46,
-    0x3a, 0x33, 0x24, 0x4f, 0x1e, 0x5a, 0x2a, 0x22, 0x58, 0x3a, 0x1e, 0x3f,
-    0x53, 0x3f, 0x5a, 0x66, 0x5a, 0x33, 0x42, 0x14, 0x05, 0x05, 0x0b, 0x0b,
-    0x06, 0x2a, 0x5b, 0x29, 0x3d, 0x35, 0x0c, 0x06, 0x0b, 0x0b, 0x12, 0x11,
-    0x1f, 0x1c, 0x0b, 0x06, 0x06, 0x03, 0x27, 0x2d, 0x1f, 0x3e, 0x6c, 0x54,
-    0x13, 0x54, 0x1f, 0x11, 0x0b, 0x2d, 0x5e, 0x75, 0x7a, 0x76, 0x7a, 0x8a,
-    0x1d, 0x05, 0x05, 0x05, 0x54, 0x9b, 0x8c, 0x9a, 0x9e, 0xa8, 0xae, 0xad,
-    0x6a, 0xb5, 0xa1, 0x89, 0xb5, 0xad, 0x61, 0xb5, 0x77, 0x4b, 0x83, 0xba,
-    0xb5, 0xba, 0xb5, 0xba, 0xb1, 0xa9, 0xaf, 0x9a, 0x6e, 0xa2, 0xb7, 0xc1,
-    0xb1, 0xc9, 0xbb, 0xc4, 0xbb, 0xc4, 0xd0, 0xc4, 0xb1, 0xb3, 0xb7, 0xb3,
-    0xb0, 0xb5, 0xbf, 0xb5, 0xac, 0xba, 0xb0, 0xb5, 0xb5, 0xac, 0x9d, 0x8d,
-    0xc6, 0xa6, 0xbb, 0xcb, 0xbb, 0xd8, 0xd2, 0xbe, 0xdb, 0xd3, 0xdc, 0xdc,
-    0xe8, 0xe4, 0xe9, 0xed, 0xe5, 0xf0, 0xf0, 0xf4, 0xf0, 0xed, 0xf7, 0xf7,
-    0xf9, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf5, 0xf5,
-    0xf5, 0xf5, 0xf5, 0xf4, 0xf0, 0xf0, 0xe9, 0xe9, 0xe5, 0xe9, 0xdc, 0xd3,
-    0xdf, 0xd9, 0xb2, 0xb8, 0xdf, 0xe4, 0xe9, 0x8e, 0xe5, 0xee, 0xeb, 0xb6,
-    0xc0, 0xd3, 0xd3, 0xd9, 0x8b, 0xa0, 0xa0, 0xd3, 0xe3, 0xdd, 0xdd, 0xd8,
-    0xcb, 0xc6, 0xb7, 0xc1, 0xa6, 0xa6, 0xb7, 0xc1, 0xd1, 0x97, 0xb2, 0x6e,
-    0x65, 0x57, 0x9d, 0xc6, 0x74, 0x97, 0x41, 0x41, 0xa9, 0xbb, 0x65, 0xb3,
-    0x98, 0x85, 0x74, 0xb7, 0x3e, 0x71, 0x85, 0x9e, 0xb7, 0xb5, 0xb1, 0x5e,
-    0x65, 0xa5, 0xb5, 0x9b, 0x61, 0x83, 0xaf, 0xaf, 0xa8, 0x94, 0x94, 0x8c,
-    0x4b, 0x59, 0x36, 0x61, 0x83, 0x61, 0x7a, 0x54, 0x2c, 0x3e, 0x11, 0x36,
-    0x5e, 0x2c, 0x36, 0x13, 0x64, 0x5e, 0x1d, 0x69, 0x54, 0x1f, 0x15, 0x1f,
-    0x27, 0x27, 0x23, 0x1c, 0x06, 0x54, 0x36, 0x13, 0x13, 0x0e, 0x3d, 0x87,
-    0x5b, 0x29, 0x1c, 0x1d, 0x53, 0x82, 0x87, 0x7b, 0x7b, 0x7b, 0x53, 0x42,
-    0x70, 0x2a, 0x1e, 0x3f, 0x24, 0x5a, 0x33, 0x7b, 0x2a, 0x53, 0x5a, 0x28,
-    0x46, 0x66, 0x72, 0x62, 0x62, 0x62, 0x62, 0x4d, 0x66, 0x58, 0x4d, 0x3a,
-    0x2f, 0x04, 0x01, 0x02, 0x01, 0x04, 0x58, 0x3c, 0x3a, 0x2e, 0x1e, 0x4d,
-    0x3a, 0x52, 0x24, 0x28, 0x4d, 0x29, 0x14, 0x33, 0x46, 0x33, 0x4f, 0x72,
-    0x46, 0x50, 0x53, 0x33, 0x04, 0x05, 0x06, 0x06, 0x04, 0x13, 0x14, 0x1b,
-    0x23, 0x25, 0x49, 0x12, 0x0b, 0x05, 0x0b, 0x0b, 0x20, 0x0b, 0x05, 0x05,
-    0x01, 0x06, 0x3d, 0x55, 0x23, 0x75, 0x84, 0x36, 0x25, 0x6c, 0x21, 0x13,
-    0x0a, 0x23, 0x6a, 0x83, 0x7a, 0x9b, 0x2d, 0x47, 0x11, 0x05, 0x05, 0x08,
-    0x75, 0xae, 0x90, 0x94, 0x9e, 0xaf, 0xad, 0xaf, 0x6a, 0xaf, 0xaf, 0x80,
-    0xb4, 0xb4, 0x71, 0x9a, 0x85, 0x83, 0x89, 0xaf, 0xb5, 0xba, 0xba, 0xb5,
-    0xaf, 0xa2, 0xb7, 0x8d, 0x7e, 0xba, 0x9c, 0xbb, 0xb0, 0xc6, 0xbf, 0xb1,
-    0x9d, 0xc6, 0xc4, 0xbf, 0xa2, 0xb7, 0xc4, 0xbb, 0xb0, 0xb0, 0xc9, 0xc4,
-    0xb1, 0xbf, 0xbf, 0xba, 0xbf, 0x9c, 0xb1, 0xb7, 0xb1, 0xb7, 0xb8, 0xcb,
-    0xcb, 0xbe, 0xd2, 0xc8, 0xe3, 0xe4, 0xe5, 0xca, 0xe8, 0xe4, 0xe9, 0xed,
-    0xf4, 0xe9, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf8, 0xf8, 0xf9, 0xf7, 0xf7,
-    0xf9, 0xf9, 0xf9, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf5, 0xf5, 0xf4, 0xf4,
-    0xf4, 0xf0, 0xe5, 0xe9, 0xe9, 0xe9, 0xdc, 0xdc, 0xa0, 0xdf, 0xaa, 0xd1,
-    0xdf, 0xd3, 0xca, 0x8e, 0xca, 0xeb, 0xb6, 0x6d, 0xb6, 0xc0, 0xd3, 0xc0,
-    0x8b, 0xd3, 0xb6, 0x57, 0xdf, 0xdf, 0xdd, 0xd8, 0xd1, 0xd1, 0xbb, 0xd1,
-    0xc6, 0xc1, 0xa6, 0xc1, 0xbb, 0xb2, 0x97, 0xac, 0x34, 0x16, 0x97, 0xa5,
-    0x57, 0x85, 0x5f, 0x32, 0x65, 0xa7, 0x7e, 0xb3, 0xa6, 0x9d, 0x41, 0x4b,
-    0x74, 0x85, 0xac, 0xb5, 0xbf, 0xb5, 0xb7, 0x23, 0x7e, 0xa5, 0xb5, 0x94,
-    0x6a, 0x71, 0x94, 0xaf, 0x51, 0x9c, 0x94, 0x65, 0x5e, 0x4b, 0x51, 0xa8,
-    0xae, 0x61, 0x61, 0x5c, 0x1f, 0x0c, 0x13, 0x54, 0x51, 0x1f, 0x36, 0x36,
-    0x54, 0x6c, 0x76, 0x36, 0x25, 0x05, 0x0c, 0x36, 0x1f, 0x1f, 0x1f, 0x06,
-    0x36, 0x54, 0x1d, 0x0b, 0x0b, 0x1f, 0x07, 0x92, 0x50, 0x0c, 0x5b, 0x31,
-    0x53, 0x70, 0x87, 0x82, 0x87, 0x82, 0x50, 0x70, 0x63, 0x33, 0x70, 0x42,
-    0x14, 0x35, 0x53, 0x42, 0x28, 0x3a, 0x33, 0x28, 0x72, 0x72, 0x72, 0x72,
-    0x62, 0x62, 0x62, 0x58, 0x46, 0x3a, 0x3a, 0x33, 0x2e, 0x04, 0x01, 0x01,
-    0x02, 0x01, 0x46, 0x3a, 0x28, 0x4d, 0x33, 0x33, 0x46, 0x58, 0x4d, 0x5a,
-    0x33, 0x33, 0x1e, 0x24, 0x3f, 0x2a, 0x50, 0x3f, 0x33, 0x3d, 0x50, 0x42,
-    0x06, 0x04, 0x06, 0x05, 0x04, 0x2a, 0x0c, 0x12, 0x31, 0x23, 0x1d, 0x15,
-    0x06, 0x05, 0x12, 0x23, 0x2d, 0x05, 0x03, 0x03, 0x01, 0x12, 0x54, 0x64,
-    0x49, 0x7d, 0x6c, 0x15, 0x5e, 0x7a, 0x1a, 0x0e, 0x0c, 0x5c, 0xab, 0x8f,
-    0x7a, 0x8a, 0x59, 0x08, 0x05, 0x03, 0x01, 0x08, 0x5e, 0xaf, 0x9b, 0x8c,
-    0x8a, 0xb4, 0xaf, 0xa1, 0x61, 0xaf, 0xaf, 0x9a, 0xb4, 0xb5, 0x89, 0x8c,
-    0xa8, 0x9a, 0x77, 0xa2, 0xb5, 0xba, 0xb5, 0xb5, 0xa9, 0xa9, 0xb7, 0xa2,
-    0x6a, 0xbf, 0xb1, 0xa5, 0xbf, 0xbb, 0xba, 0xb1, 0x85, 0xc9, 0xbb, 0xbb,
-    0xac, 0xb3, 0xc4, 0xa5, 0xc4, 0xba, 0xc9, 0xc7, 0xb1, 0xc4, 0xc4, 0xbf,
-    0xa5, 0x98, 0xb1, 0x97, 0x9d, 0xcb, 0xa6, 0xd1, 0xd1, 0xc0, 0xc8, 0xc8,
-    0xdf, 0xdb, 0xf0, 0xca, 0xdb, 0xe8, 0xe5, 0xf0, 0xf4, 0xe9, 0xf4, 0xf4,
-    0xf5, 0xf7, 0xf5, 0xed, 0xf8, 0xf9, 0xf9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7,
-    0xf7, 0xf7, 0xf7, 0xf7, 0xf5, 0xf5, 0xf4, 0xf4, 0xf4, 0xe9, 0xf0, 0xf0,
-    0xe9, 0xe5, 0xca, 0xdc, 0x79, 0xd3, 0x8b, 0xd9, 0xb6, 0xb6, 0x8e, 0x5d,
-    0x8e, 0xd3, 0xa0, 0xca, 0xca, 0xe3, 0xe3, 0xd2, 0xc8, 0xe3, 0xd9, 0x32,
-    0xaa, 0xc8, 0xd1, 0xd1, 0xb8, 0xc1, 0xbb, 0xcb, 0xcb, 0xa6, 0xc6, 0xb1,
-    0xd7, 0xb3, 0x97, 0x3e, 0xa7, 0xa7, 0x1c, 0x5f, 0x99, 0x16, 0x11, 0x16,
-    0x1f, 0x74, 0x8d, 0xa5, 0x97, 0x47, 0x5c, 0xb3, 0x7e, 0xb7, 0xb5, 0xa2,
-    0xa5, 0xa9, 0x51, 0x9c, 0x71, 0x7e, 0xb5, 0x8c, 0x4e, 0xa5, 0x61, 0x77,
-    0x34, 0x3e, 0x27, 0x0e, 0x34, 0x5e, 0x8c, 0xb5, 0xa1, 0x1f, 0x55, 0x3e,
-    0x7e, 0x13, 0x23, 0x3e, 0x54, 0x5e, 0x1f, 0x2d, 0x6c, 0x4e, 0x6c, 0x84,
-    0x3e, 0x54, 0x15, 0x23, 0x54, 0x1c, 0x27, 0x1d, 0x3e, 0x64, 0x54, 0x04,
-    0x0b, 0x0c, 0x25, 0x36, 0x3d, 0x50, 0x73, 0x87, 0x7b, 0x42, 0x87, 0x7b,
-    0x82, 0x87, 0x7b, 0x67, 0x50, 0x63, 0x70, 0x35, 0x14, 0x2a, 0x2a, 0x33,
-    0x53, 0x72, 0x3f, 0x63, 0x62, 0x72, 0x72, 0x72, 0x62, 0x62, 0x62, 0x62,
-    0x58, 0x58, 0x66, 0x2e, 0x28, 0x04, 0x01, 0x02, 0x01, 0x01, 0x3f, 0x4d,
-    0x33, 0x46, 0x3a, 0x1e, 0x46, 0x62, 0x58, 0x28, 0x28, 0x4f, 0x33, 0x28,
-    0x53, 0x33, 0x33, 0x5a, 0x53, 0x24, 0x1e, 0x2a, 0x0b, 0x05, 0x06, 0x0b,
-    0x05, 0x0c, 0x20, 0x13, 0x1b, 0x3d, 0x31, 0x1b, 0x06, 0x05, 0x05, 0x1f,
-    0x12, 0x05, 0x0b, 0x05, 0x01, 0x1d, 0x64, 0x76, 0x49, 0x84, 0x61, 0x27,
-    0x61, 0x3d, 0x15, 0x12, 0x0c, 0x3d, 0xa4, 0xa1, 0xa4, 0x8a, 0x9c, 0x1a,
-    0x05, 0x03, 0x01, 0x08, 0x77, 0x83, 0x8a, 0xa1, 0x83, 0x9a, 0xa1, 0x75,
-    0x7a, 0x9b, 0xaf, 0x6f, 0xb5, 0xb4, 0xa2, 0x59, 0x94, 0xa8, 0x6a, 0xb1,
-    0xa8, 0xba, 0xba, 0xaf, 0xb7, 0xb1, 0x9a, 0xa9, 0x94, 0xa2, 0xb7, 0xa9,
-    0xbf, 0xb1, 0xb1, 0xbb, 0xa9, 0xc9, 0xba, 0xc9, 0xbf, 0xa9, 0xba, 0x9c,
-    0xbb, 0xb0, 0xc4, 0xbf, 0xb0, 0xbf, 0xc9, 0xc4, 0xb1, 0xc1, 0xbb, 0xb2,
-    0x88, 0x9d, 0xb8, 0xbe, 0xd2, 0xd9, 0xbe, 0xd2, 0xd9, 0xe4, 0xe4, 0xdb,
-    0xca, 0xe9, 0xdc, 0xf5, 0xf4, 0xe9, 0xe5, 0xe9, 0xf5, 0xf7, 0xf5, 0xf8,
-    0xed, 0xf9, 0xf8, 0xf8, 0xf9, 0xf8, 0xf9, 0xf9, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xf7, 0xf5, 0xf5, 0xf5, 0xf4, 0xf4, 0xf0, 0xf0, 0xe9, 0xf0, 0xe9, 0xd4,
-    0x6d, 0xdc, 0x57, 0xc8, 0xdf, 0xaa, 0x6d, 0x48, 0xc0, 0xee, 0xa0, 0xeb,
-    0xdb, 0xdb, 0xe2, 0xdf, 0xd8, 0xc8, 0xd3, 0xb6, 0xca, 0xb6, 0xaa, 0xbe,
-    0x6e, 0xa6, 0xb8, 0xc1, 0xa6, 0xb2, 0xb2, 0xa6, 0x9c, 0xb2, 0x74, 0x5f,
-    0x8d, 0x8d, 0xa6, 0x45, 0x16, 0x1c, 0x07, 0x41, 0x65, 0x97, 0x6e, 0x41,
-    0x34, 0x74, 0x77, 0x9d, 0x8d, 0x9c, 0x9c, 0x98, 0x3e, 0x65, 0x3e, 0xb5,
-    0xb7, 0x77, 0x9a, 0x9c, 0x7e, 0x8c, 0x85, 0x65, 0x2d, 0x77, 0x59, 0x1f,
-    0x54, 0x61, 0x7a, 0xa1, 0x77, 0x12, 0x27, 0x30, 0x49, 0x15, 0x30, 0x2d,
-    0x75, 0x75, 0x23, 0x59, 0x9b, 0x86, 0x5e, 0x23, 0x67, 0xa4, 0x76, 0x15,
-    0x18, 0x13, 0x0b, 0x2d, 0x07, 0x86, 0x67, 0x11, 0x05, 0x06, 0x0b, 0x12,
-    0x87, 0x87, 0x50, 0x82, 0x82, 0x73, 0x29, 0x29, 0x66, 0x67, 0x5a, 0x35,
-    0x53, 0x82, 0x73, 0x2a, 0x42, 0x50, 0x3f, 0x46, 0x53, 0x53, 0x46, 0x72,
-    0x72, 0x66, 0x62, 0x62, 0x66, 0x62, 0x62, 0x62, 0x66, 0x62, 0x58, 0x3a,
-    0x28, 0x07, 0x01, 0x02, 0x03, 0x01, 0x1e, 0x4d, 0x33, 0x4d, 0x33, 0x1e,
-    0x4f, 0x4d, 0x46, 0x58, 0x58, 0x33, 0x1e, 0x29, 0x33, 0x29, 0x42, 0x63,
-    0x53, 0x24, 0x2a, 0x14, 0x0c, 0x05, 0x04, 0x04, 0x07, 0x06, 0x15, 0x20,
-    0x0b, 0x20, 0x6c, 0x35, 0x1a, 0x05, 0x05, 0x01, 0x06, 0x05, 0x04, 0x01,
-    0x01, 0x54, 0x5e, 0x76, 0x5b, 0x73, 0x36, 0x3d, 0x6c, 0x4b, 0x15, 0x1f,
-    0x06, 0x27, 0x68, 0x75, 0xab, 0x8f, 0x75, 0x2d, 0x03, 0x01, 0x01, 0x05,
-    0x7a, 0xa4, 0x8c, 0x75, 0x7e, 0x8c, 0xa8, 0x71, 0x8f, 0xa8, 0x95, 0x94,
-    0xb5, 0xb5, 0xa9, 0x36, 0x77, 0x9a, 0x9e, 0x7a, 0xb5, 0xba, 0xbf, 0xb5,
-    0xa9, 0x8c, 0xa2, 0xb1, 0x85, 0xb1, 0xa5, 0x9a, 0xa5, 0xa5, 0xbb, 0xbf,
-    0xc1, 0xb7, 0xc9, 0xc9, 0xc9, 0xab, 0xb7, 0xa5, 0xa5, 0xb0, 0xc9, 0xc2,
-    0xc4, 0xc9, 0xcf, 0xc4, 0xba, 0xcb, 0xc6, 0xb1, 0xa6, 0x9d, 0xb8, 0xc8,
-    0xd2, 0xc8, 0xb6, 0xd9, 0xd9, 0xe4, 0xdb, 0xd3, 0xd3, 0xdc, 0xe9, 0xf0,
-    0xf4, 0xf0, 0xe9, 0xf0, 0xed, 0xed, 0xed, 0xf8, 0xf8, 0xf5, 0xf8, 0xf8,
-    0xf8, 0xf8, 0xf8, 0xf9, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf5, 0xf5, 0xed,
-    0xf5, 0xf4, 0xf0, 0xe9, 0xe9, 0xf0, 0xdc, 0x37, 0x6b, 0xca, 0xd3, 0xe3,
-    0xca, 0xd3, 0x8b, 0x5d, 0xdc, 0xeb, 0xa0, 0xeb, 0xdb, 0xdb, 0xc8, 0xd1,
-    0xd1, 0xd9, 0xc0, 0xdb, 0xaa, 0xb6, 0x99, 0xbe, 0xcb, 0xa7, 0x97, 0xbb,
-    0xb7, 0xcb, 0xac, 0x97, 0xbe, 0x77, 0x51, 0x8d, 0xa7, 0xbb, 0xbb, 0x88,
-    0x44, 0x8d, 0x16, 0x16, 0x5f, 0x74, 0x5c, 0x97, 0xa6, 0xbb, 0xa5, 0xb2,
-    0x7e, 0x77, 0x8d, 0x77, 0x6a, 0x4b, 0x85, 0xa2, 0xac, 0x71, 0xa2, 0x9a,
-    0x49, 0x7e, 0x3e, 0x83, 0x47, 0xa9, 0x69, 0x8c, 0x9c, 0x83, 0x54, 0x8c,
-    0x61, 0x1f, 0x36, 0x5e, 0x06, 0x2d, 0x3d, 0x2d, 0x75, 0x69, 0x23, 0x49,
-    0x83, 0x64, 0x14, 0x9b, 0x8a, 0x96, 0x76, 0x1a, 0x12, 0x08, 0x0b, 0x15,
-    0x0c, 0x2d, 0x50, 0x23, 0x06, 0x06, 0x05, 0x05, 0x42, 0x92, 0x7b, 0x5b,
-    0x7b, 0x87, 0x7b, 0x73, 0x73, 0x42, 0x31, 0x3f, 0x7b, 0x7b, 0x33, 0x67,
-    0x7b, 0x24, 0x4f, 0x70, 0x33, 0x17, 0x63, 0x72, 0x72, 0x72, 0x62, 0x62,
-    0x62, 0x63, 0x58, 0x62, 0x62, 0x62, 0x58, 0x2e, 0x17, 0x06, 0x01, 0x01,
-    0x05, 0x04, 0x1e, 0x4d, 0x33, 0x58, 0x2a, 0x46, 0x4d, 0x62, 0x62, 0x62,
-    0x62, 0x58, 0x1b, 0x42, 0x42, 0x46, 0x23, 0x3f, 0x3f, 0x3f, 0x14, 0x1a,
-    0x15, 0x06, 0x06, 0x04, 0x04, 0x04, 0x20, 0x0c, 0x15, 0x1b, 0x5b, 0x87,
-    0x50, 0x05, 0x05, 0x05, 0x0b, 0x05, 0x05, 0x01, 0x0b, 0x64, 0x31, 0x84,
-    0x54, 0x30, 0x3e, 0xa4, 0x8a, 0x27, 0x1f, 0x1f, 0x0c, 0x2d, 0x94, 0x6c,
-    0x83, 0x94, 0x75, 0x55, 0x01, 0x01, 0x03, 0x05, 0x83, 0xa1, 0xa8, 0x9b,
-    0x4e, 0x6a, 0x83, 0x75, 0xa2, 0x8c, 0x95, 0xa8, 0xaf, 0xb5, 0xa2, 0x8c,
-    0x59, 0xb5, 0x90, 0xa9, 0x9a, 0xb5, 0xba, 0xba, 0xa2, 0x8d, 0xa2, 0xa2,
-    0x51, 0x8d, 0x97, 0xb7, 0xc1, 0xb1, 0xc9, 0xc6, 0xc1, 0x9a, 0xba, 0xbf,
-    0xc9, 0xba, 0xbb, 0xb7, 0x9c, 0xba, 0xc9, 0xc2, 0xc4, 0xc9, 0xc9, 0xc4,
-    0xd0, 0xc9, 0xc1, 0xc6, 0xb2, 0x99, 0xc8, 0xb6, 0xc0, 0xc8, 0xc8, 0xb8,
-    0xc8, 0xca, 0xca, 0xdc, 0xee, 0xdb, 0xd3, 0xe9, 0xf0, 0xee, 0xeb, 0xe9,
-    0xed, 0xf5, 0xf5, 0xf5, 0xf8, 0xfd, 0xf5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
-    0xf9, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf5, 0xf5, 0xed, 0xf0, 0xf0, 0xf3,
-    0xf0, 0xe9, 0xb6, 0xca, 0xca, 0xc0, 0x8b, 0xc0, 0xb6, 0xd3, 0xd3, 0xa0,
-    0xe8, 0xe4, 0x8e, 0xe6, 0xe3, 0xe6, 0xc8, 0xd2, 0xd9, 0x99, 0xa0, 0xb6,
-    0x45, 0xca, 0xc8, 0xc6, 0xc8, 0x99, 0x99, 0x97, 0xb2, 0xb7, 0xb3, 0xb2,
-    0x74, 0x06, 0xb2, 0xac, 0xbb, 0xd0, 0xcb, 0x34, 0xb3, 0x7f, 0x41, 0x55,
-    0xb7, 0xbb, 0xa5, 0xa6, 0x9c, 0xb2, 0xa6, 0x90, 0xc4, 0xac, 0x97, 0x8c,
-    0x88, 0x3e, 0xa2, 0x61, 0x94, 0x8c, 0x77, 0x9a, 0x26, 0x94, 0x7e, 0x7a,
-    0x94, 0x27, 0x3e, 0xa8, 0x9b, 0x94, 0x59, 0x69, 0x3b, 0x54, 0x6a, 0x1f,
-    0x0e, 0x2d, 0x26, 0x2c, 0x1c, 0x2c, 0x5e, 0x9b, 0x2d, 0x0b, 0x76, 0xae,
-    0x96, 0x73, 0x0f, 0x27, 0x15, 0x12, 0x15, 0x25, 0x64, 0x96, 0x87, 0x6c,
-    0x07, 0x05, 0x06, 0x05, 0x0c, 0x87, 0x87, 0x5b, 0x67, 0x53, 0x53, 0x3f,
-    0x42, 0x70, 0x87, 0x7b, 0x82, 0x53, 0x7b, 0x66, 0x82, 0x46, 0x7b, 0x58,
-    0x24, 0x67, 0x4f, 0x70, 0x72, 0x72, 0x66, 0x62, 0x62, 0x72, 0x3a, 0x63,
-    0x62, 0x62, 0x2e, 0x3a, 0x1e, 0x04, 0x01, 0x04, 0x04, 0x03, 0x0d, 0x4d,
-    0x2e, 0x52, 0x3f, 0x33, 0x58, 0x58, 0x62, 0x58, 0x4d, 0x58, 0x53, 0x28,
-    0x3f, 0x3f, 0x33, 0x33, 0x31, 0x35, 0x35, 0x20, 0x24, 0x20, 0x04, 0x05,
-    0x04, 0x05, 0x07, 0x0b, 0x29, 0x5b, 0x14, 0x67, 0x54, 0x06, 0x08, 0x05,
-    0x06, 0x05, 0x08, 0x01, 0x3e, 0x84, 0x3d, 0x86, 0x1d, 0x0c, 0x6c, 0x92,
-    0x8a, 0x2d, 0x16, 0x15, 0x0c, 0x3e, 0x61, 0x83, 0x6a, 0x7a, 0x8a, 0x77,
-    0x05, 0x01, 0x03, 0x05, 0x7a, 0xa8, 0x8f, 0x9e, 0x75, 0x51, 0xa8, 0x75,
-    0xa8, 0x61, 0x83, 0xa1, 0xab, 0xaf, 0xaf, 0x9e, 0x3d, 0xaf, 0x8c, 0xa8,
-    0x94, 0xb5, 0xb5, 0xa9, 0x8c, 0xb7, 0xa2, 0xa9, 0x65, 0xb7, 0x8d, 0x9d,
-    0xac, 0xac, 0xb7, 0xba, 0xc9, 0xc1, 0xc4, 0xba, 0xbf, 0xbf, 0xc4, 0xba,
-    0xac, 0xc4, 0xbb, 0xbf, 0xc9, 0xc4, 0xbf, 0xc4, 0xcf, 0xcb, 0xc6, 0xb2,
-    0xbe, 0xaa, 0xb8, 0xb6, 0xb6, 0xd9, 0xd2, 0xd2, 0xd9, 0xd1, 0xe4, 0xe5,
-    0xe5, 0xdb, 0xe5, 0xe9, 0xe5, 0xe8, 0xe5, 0xf0, 0xf4, 0xf5, 0xf9, 0xf8,
-    0xfb, 0xfd, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0xf9, 0xf7, 0xf7,
-    0xf7, 0xf7, 0xf5, 0xf5, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xe5, 0xe5, 0xef,
-    0xdb, 0x6b, 0x6d, 0xd2, 0xb6, 0xd2, 0xe6, 0x8b, 0xdc, 0xc0, 0x8b, 0xe4,
-    0xe3, 0xe3, 0xd3, 0xb8, 0xbe, 0xc8, 0x8b, 0xca, 0x8b, 0xaa, 0xaa, 0xc8,
-    0xbe, 0x6b, 0x41, 0x99, 0x7f, 0xa6, 0x97, 0x4b, 0x8d, 0x74, 0xa7, 0xa5,
-    0x8d, 0xbb, 0xc6, 0xa7, 0x99, 0x9d, 0x97, 0x74, 0x65, 0xac, 0xac, 0xc1,
-    0xb7, 0x5c, 0x74, 0x85, 0x8d, 0x97, 0x8d, 0x7e, 0x27, 0x69, 0x5c, 0x36,
-    0x8c, 0x7e, 0x3e, 0x61, 0x8c, 0x61, 0x71, 0x71, 0x9c, 0x61, 0x3e, 0x9e,
-    0xa1, 0x61, 0x83, 0x83, 0xa1, 0x8c, 0x8c, 0x12, 0x55, 0x2d, 0x26, 0x1f,
-    0x12, 0x26, 0x5e, 0x31, 0x0e, 0x23, 0x8a, 0xa4, 0x96, 0x81, 0x6c, 0x54,
-    0x13, 0x1f, 0x2d, 0x13, 0x9b, 0x96, 0x9f, 0x81, 0x23, 0x05, 0x0b, 0x06,
-    0x05, 0x50, 0x64, 0x67, 0x93, 0x93, 0x82, 0x82, 0x4f, 0x70, 0x70, 0x70,
-    0x63, 0x67, 0x66, 0x70, 0x67, 0x53, 0x7b, 0x4f, 0x46, 0x70, 0x66, 0x66,
-    0x66, 0x72, 0x63, 0x53, 0x60, 0x62, 0x4f, 0x58, 0x62, 0x46, 0x22, 0x4d,
-    0x2e, 0x04, 0x01, 0x04, 0x04, 0x01, 0x10, 0x46, 0x3a, 0x3a, 0x3c, 0x4d,
-    0x46, 0x52, 0x58, 0x46, 0x58, 0x66, 0x62, 0x58, 0x31, 0x3f, 0x66, 0x66,
-    0x1d, 0x25, 0x31, 0x33, 0x67, 0x25, 0x05, 0x04, 0x0b, 0x05, 0x0b, 0x0b,
-    0x20, 0x56, 0x54, 0x13, 0x2b, 0x0b, 0x0b, 0x05, 0x05, 0x05, 0x05, 0x06,
-    0x6c, 0x7d, 0x5b, 0x4b, 0x0f, 0x0b, 0x81, 0x83, 0x5e, 0x23, 0x0b, 0x0e,
-    0x0b, 0x61, 0x59, 0x6f, 0x6a, 0x59, 0x83, 0x71, 0x08, 0x01, 0x05, 0x05,
-    0x6c, 0x9b, 0xa1, 0x9e, 0xa1, 0x59, 0x6a, 0x89, 0xa8, 0x94, 0x77, 0x90,
-    0x9e, 0x9e, 0x9a, 0x9a, 0x8c, 0x71, 0xa9, 0x9a, 0x94, 0x90, 0x9a, 0x71,
-    0xb7, 0xaf, 0xb1, 0x9a, 0x74, 0x98, 0xa5, 0x97, 0x97, 0xbb, 0xa9, 0xd0,
-    0xbf, 0xba, 0xbf, 0xba, 0xc9, 0xbf, 0xc4, 0xc4, 0xa5, 0xbf, 0xb5, 0xbf,
-    0xc7, 0xc9, 0xbf, 0xc4, 0xd6, 0xc6, 0xd1, 0xb8, 0xb8, 0xc8, 0xbe, 0xc8,
-    0xb6, 0xb8, 0xb8, 0xc8, 0xdf, 0xd9, 0xdb, 0xe5, 0xe9, 0xe9, 0xf0, 0xf0,
-    0xeb, 0xeb, 0xeb, 0xf0, 0xf0, 0xf4, 0xf7, 0xf9, 0xfd, 0xfd, 0xf8, 0xf8,
-    0xf8, 0xf9, 0xf8, 0xf8, 0xf8, 0xf9, 0xf9, 0xf7, 0xf7, 0xf7, 0xf5, 0xf5,
-    0xf5, 0xf4, 0xf0, 0xf0, 0xe9, 0xe8, 0xe8, 0xe6, 0xdb, 0x45, 0x57, 0xdf,
-    0xd2, 0xd8, 0xe2, 0xb6, 0xdc, 0x7c, 0x8e, 0xd3, 0xdb, 0xd3, 0xd2, 0xdf,
-    0xc8, 0xd1, 0x99, 0xd3, 0xd3, 0xc0, 0x79, 0x88, 0xa7, 0x79, 0x5f, 0x32,
-    0x41, 0x74, 0x97, 0x97, 0x65, 0xc6, 0xac, 0xb3, 0xb8, 0x69, 0xb7, 0xbb,
-    0x7f, 0xc1, 0xd0, 0xc6, 0x8d, 0x9d, 0x9c, 0x85, 0x74, 0x8d, 0x8d, 0x7e,
-    0x65, 0x5f, 0x71, 0x41, 0x1f, 0xac, 0x98, 0x9c, 0x77, 0x3e, 0x55, 0x5f,
-    0x4b, 0x97, 0x55, 0x5e, 0x4b, 0x1f, 0x4b, 0x69, 0x71, 0x5e, 0x8c, 0x9e,
-    0xae, 0x75, 0x54, 0x2d, 0x77, 0x2d, 0x3e, 0x1c, 0x0e, 0x49, 0x61, 0x3d,
-    0x2d, 0x76, 0x7d, 0xa4, 0x92, 0x8f, 0x7d, 0x31, 0x27, 0x36, 0x1a, 0x06,
-    0x81, 0x93, 0x87, 0x42, 0x64, 0x25, 0x11, 0x0c, 0x05, 0x07, 0x73, 0x87,
-    0x87, 0x82, 0x82, 0x82, 0x87, 0x67, 0x82, 0x53, 0x33, 0x7b, 0x67, 0x42,
-    0x29, 0x42, 0x4f, 0x67, 0x53, 0x70, 0x58, 0x70, 0x63, 0x72, 0x72, 0x4d,
-    0x62, 0x62, 0x63, 0x3a, 0x58, 0x2e, 0x4d, 0x2e, 0x33, 0x07, 0x01, 0x01,
-    0x0a, 0x01, 0x07, 0x1e, 0x24, 0x33, 0x62, 0x4d, 0x58, 0x58, 0x46, 0x53,
-    0x4d, 0x46, 0x58, 0x46, 0x42, 0x58, 0x53, 0x4f, 0x1d, 0x27, 0x35, 0x4c,
-    0x73, 0x28, 0x0b, 0x04, 0x06, 0x05, 0x04, 0x0b, 0x1b, 0x73, 0x64, 0x23,
-    0x0e, 0x0b, 0x05, 0x05, 0x05, 0x05, 0x05, 0x1c, 0x7d, 0x6c, 0x76, 0x49,
-    0x0e, 0x06, 0x84, 0x8a, 0x76, 0x23, 0x0e, 0x13, 0x15, 0x8f, 0x71, 0x75,
-    0x7a, 0x59, 0x59, 0x61, 0x06, 0x01, 0x03, 0x05, 0x61, 0xa1, 0x9b, 0x95,
-    0x94, 0x71, 0x36, 0x83, 0x9a, 0x9a, 0xb5, 0x8a, 0x9a, 0xa8, 0x9a, 0x94,
-    0x9a, 0x59, 0x9c, 0x9c, 0x9a, 0x89, 0x85, 0x83, 0xba, 0xa2, 0x90, 0x71,
-    0x51, 0x9c, 0x8d, 0x9c, 0xac, 0xbb, 0x97, 0xb1, 0xb1, 0xb5, 0xba, 0xba,
-    0xc4, 0xc5, 0xc9, 0xc9, 0xa5, 0xb7, 0xb0, 0xb7, 0xc4, 0xc4, 0xbb, 0xc9,
-    0xcf, 0xc6, 0xd1, 0xc6, 0xb8, 0xbe, 0xc8, 0xc8, 0xca, 0xbe, 0xd3, 0xc0,
-    0xd9, 0xe3, 0xc0, 0xe5, 0xe9, 0xe9, 0xf4, 0xe9, 0xe9, 0xe9, 0xe9, 0xf0,
-    0xf4, 0xf4, 0xf7, 0xf8, 0xfd, 0xfd, 0xfd, 0xfd, 0xf8, 0xf8, 0xf8, 0xf8,
-    0xf8, 0xf8, 0xf9, 0xf9, 0xf7, 0xf7, 0xf7, 0xf5, 0xf5, 0xf4, 0xf0, 0xf0,
-    0xe8, 0xe4, 0xeb, 0xe6, 0xe3, 0xc0, 0xd9, 0xd8, 0xd7, 0xd8, 0xdd, 0xdb,
-    0xf0, 0x8b, 0x5d, 0x7c, 0xc0, 0xc0, 0xd2, 0xd2, 0xc6, 0xc1, 0x8d, 0xbe,
-    0xdf, 0xb6, 0xa0, 0x99, 0x8b, 0x41, 0x2c, 0x57, 0x41, 0x97, 0xd1, 0x99,
-    0x8d, 0x9d, 0xa5, 0xac, 0xb3, 0x65, 0xb2, 0x8d, 0x97, 0xd0, 0xd0, 0xb1,
-    0xb1, 0x9d, 0x9c, 0xb2, 0x6e, 0xbb, 0x9d, 0x9c, 0x97, 0x61, 0x26, 0x1c,
-    0x5f, 0x6e, 0x7e, 0x94, 0x6a, 0x3e, 0x65, 0x3e, 0x77, 0x83, 0x3e, 0x27,
-    0x3e, 0x7e, 0x9c, 0x71, 0x51, 0x8f, 0xab, 0x7a, 0xab, 0x7e, 0x16, 0x3e,
-    0x23, 0x27, 0x2d, 0x3e, 0x4b, 0x54, 0x8c, 0x76, 0x76, 0x69, 0x5b, 0x8f,
-    0x81, 0x49, 0x31, 0x54, 0x1d, 0x23, 0x06, 0x03, 0x31, 0x87, 0x42, 0x64,
-    0x9f, 0x73, 0x06, 0x0f, 0x06, 0x04, 0x3d, 0x87, 0x87, 0x87, 0x7b, 0x82,
-    0x87, 0x70, 0x67, 0x53, 0x67, 0x53, 0x67, 0x33, 0x31, 0x42, 0x66, 0x67,
-    0x58, 0x53, 0x72, 0x72, 0x63, 0x70, 0x62, 0x66, 0x46, 0x66, 0x72, 0x58,
-    0x22, 0x4d, 0x62, 0x2e, 0x28, 0x07, 0x01, 0x04, 0x04, 0x03, 0x06, 0x24,
-    0x17, 0x46, 0x62, 0x4d, 0x4f, 0x4d, 0x58, 0x3f, 0x3f, 0x46, 0x3a, 0x33,
-    0x46, 0x5a, 0x46, 0x3f, 0x24, 0x3f, 0x42, 0x42, 0x29, 0x35, 0x0b, 0x04,
-    0x06, 0x05, 0x01, 0x0b, 0x42, 0x2a, 0x31, 0x3d, 0x1a, 0x06, 0x05, 0x05,
-    0x03, 0x05, 0x01, 0x23, 0x76, 0x49, 0x54, 0x3e, 0x15, 0x0e, 0x76, 0x92,
-    0x7a, 0x23, 0x16, 0x13, 0x1c, 0x8a, 0x8f, 0x69, 0x8c, 0x94, 0x4e, 0x75,
-    0x0b, 0x03, 0x01, 0x05, 0x59, 0x8c, 0x7a, 0x95, 0x8c, 0x83, 0x3b, 0x7a,
-    0x8c, 0x95, 0x9e, 0x90, 0x75, 0xa8, 0x90, 0xa8, 0x7a, 0x77, 0x7a, 0xa2,
-    0xb1, 0x90, 0x8c, 0x9a, 0x9a, 0x8c, 0x8d, 0x8d, 0x7e, 0x9c, 0x85, 0x98,
-    0xa5, 0xb1, 0xa9, 0x9d, 0x9c, 0xb7, 0xbf, 0xbf, 0xc4, 0xc7, 0xc9, 0xc2,
-    0xb5, 0xb3, 0xb3, 0xba, 0xbf, 0xc9, 0xc4, 0xc9, 0xc1, 0xd1, 0xd8, 0xcb,
-    0xd1, 0xc8, 0xbe, 0xc8, 0xc8, 0xc0, 0xd3, 0xca, 0xca, 0xca, 0xca, 0xdb,
-    0xe9, 0xe5, 0xf0, 0xf0, 0xeb, 0xf0, 0xe9, 0xf0, 0xf3, 0xf7, 0xf7, 0xf9,
-    0xf8, 0xfd, 0xfd, 0xfd, 0xfd, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0xf9,
-    0xf9, 0xf7, 0xf7, 0xf4, 0xf4, 0xf0, 0xee, 0xe8, 0xe8, 0xe4, 0xe4, 0xe6,
-    0xe6, 0xe6, 0xdd, 0xdd, 0xdd, 0xd8, 0xd8, 0xdf, 0xdb, 0x45, 0x6b, 0x79,
-    0xa0, 0x8b, 0xc0, 0xd8, 0xd8, 0xc1, 0xb2, 0xcb, 0xd2, 0xbe, 0xb6, 0xb6,
-    0xb6, 0x41, 0x26, 0xa7, 0x7f, 0xc6, 0xb2, 0x6e, 0xb1, 0xb1, 0x85, 0xac,
-    0x97, 0x7f, 0xb3, 0xb1, 0xb3, 0x97, 0x97, 0x6e, 0xb1, 0xc1, 0xb7, 0xbb,
-    0x7e, 0x9d, 0xb7, 0xbb, 0x71, 0x8d, 0x16, 0x26, 0x5f, 0x74, 0x55, 0x77,
-    0x34, 0x4b, 0x1f, 0x2d, 0xac, 0xb5, 0x4b, 0x55, 0x2c, 0x8c, 0xb5, 0xb0,
-    0x4e, 0x76, 0x7a, 0x71, 0xab, 0x3e, 0x16, 0x54, 0x1f, 0x23, 0x83, 0x83,
-    0x7a, 0x54, 0x59, 0x84, 0x7a, 0x36, 0x3d, 0x96, 0x96, 0x8c, 0x64, 0x36,
-    0x6c, 0x27, 0x05, 0x05, 0x0b, 0x73, 0x67, 0x96, 0x93, 0x96, 0x15, 0x06,
-    0x06, 0x05, 0x0b, 0x78, 0x7b, 0x7b, 0x73, 0x70, 0x67, 0x67, 0x2a, 0x50,
-    0x7b, 0x67, 0x67, 0x53, 0x70, 0x70, 0x53, 0x70, 0x53, 0x53, 0x66, 0x7b,
-    0x62, 0x63, 0x66, 0x62, 0x66, 0x4d, 0x58, 0x4d, 0x46, 0x3a, 0x4d, 0x33,
-    0x1e, 0x06, 0x03, 0x04, 0x04, 0x05, 0x0c, 0x28, 0x17, 0x33, 0x46, 0x46,
-    0x58, 0x58, 0x58, 0x3f, 0x33, 0x4f, 0x46, 0x5a, 0x4f, 0x42, 0x5a, 0x4f,
-    0x3f, 0x2a, 0x31, 0x31, 0x12, 0x1d, 0x12, 0x05, 0x06, 0x05, 0x05, 0x0b,
-    0x67, 0x5b, 0x23, 0x27, 0x2a, 0x06, 0x05, 0x04, 0x05, 0x03, 0x03, 0x15,
-    0x36, 0x3d, 0x4b, 0x2b, 0x26, 0x35, 0x86, 0x75, 0x6c, 0x2c, 0x0f, 0x0e,
-    0x2d, 0x8c, 0x83, 0x61, 0x83, 0x83, 0x7a, 0x61, 0x0b, 0x08, 0x05, 0x05,
-    0x2d, 0x83, 0x7a, 0x68, 0x94, 0x94, 0x51, 0x83, 0x75, 0x90, 0xa1, 0x90,
-    0x83, 0x80, 0x83, 0x9e, 0x71, 0x59, 0x59, 0xb5, 0x9a, 0x8d, 0x9a, 0x90,
-    0x9a, 0x8c, 0x98, 0x8d, 0x8d, 0x98, 0xa9, 0x98, 0xa2, 0x9d, 0xb7, 0xb1,
-    0xa2, 0xa5, 0xc1, 0xc9, 0xc5, 0xbf, 0xc4, 0xc4, 0xc4, 0xbf, 0xb0, 0xb7,
-    0xc9, 0xcf, 0xbf, 0xc9, 0xcb, 0xd1, 0xd6, 0xd1, 0xdd, 0xd9, 0xd2, 0xc8,
-    0xbe, 0xbe, 0xdb, 0xd3, 0xb6, 0xc0, 0xe4, 0xe8, 0xe4, 0xe8, 0xeb, 0xeb,
-    0xeb, 0xee, 0xf0, 0xf0, 0xf5, 0xf7, 0xf7, 0xf9, 0xf8, 0xf8, 0xf8, 0xfd,
-    0xfd, 0xfd, 0xf8, 0xfa, 0xf9, 0xf8, 0xf9, 0xf7, 0xf7, 0xf7, 0xf7, 0xf4,
-    0xf4, 0xf0, 0xeb, 0xe8, 0xeb, 0xe4, 0xe4, 0xe6, 0xca, 0xd9, 0xe2, 0xdf,
-    0xdd, 0xd8, 0xd8, 0xb2, 0xa7, 0x99, 0xb6, 0xb2, 0xd2, 0xb8, 0x99, 0xbe,
-    0xcf, 0xb7, 0xd6, 0xc4, 0xcb, 0xc6, 0xb6, 0x8b, 0x57, 0x57, 0x5f, 0xbe,
-    0xb2, 0xc1, 0x6e, 0xc6, 0xc6, 0xd0, 0x88, 0x7f, 0xc1, 0x9d, 0xa5, 0xb3,
-    0xbb, 0x7f, 0x3e, 0x7e, 0xc4, 0xbb, 0xb3, 0xb1, 0x8d, 0x34, 0x65, 0x9d,
-    0x77, 0x6e, 0x2c, 0x2c, 0x5c, 0x85, 0x9c, 0x90, 0x69, 0x3e, 0x61, 0x5c,
-    0x59, 0x74, 0x34, 0x27, 0x36, 0x51, 0xb5, 0x9b, 0x77, 0x23, 0x6a, 0x7a,
-    0x6a, 0x36, 0x0e, 0x54, 0x4b, 0x36, 0xae, 0x8c, 0x61, 0x47, 0x54, 0x69,
-    0x54, 0x27, 0x69, 0xae, 0xa4, 0x5e, 0x64, 0x31, 0x3d, 0x25, 0x05, 0x03,
-    0x1c, 0x73, 0x7d, 0x93, 0x96, 0x96, 0x42, 0x01, 0x0b, 0x04, 0x03, 0x1b,
-    0x67, 0x93, 0x82, 0x7b, 0x42, 0x50, 0x3d, 0x42, 0x3f, 0x67, 0x53, 0x7b,
-    0x82, 0x72, 0x67, 0x53, 0x63, 0x5a, 0x66, 0x66, 0x72, 0x63, 0x63, 0x72,
-    0x72, 0x62, 0x66, 0x28, 0x46, 0x46, 0x46, 0x1e, 0x22, 0x06, 0x03, 0x03,
-    0x04, 0x01, 0x07, 0x46, 0x28, 0x4f, 0x58, 0x46, 0x58, 0x66, 0x46, 0x46,
-    0x46, 0x3f, 0x3f, 0x66, 0x66, 0x4f, 0x58, 0x46, 0x33, 0x35, 0x33, 0x25,
-    0x1e, 0x20, 0x15, 0x04, 0x06, 0x05, 0x05, 0x04, 0x67, 0x5b, 0x5b, 0x18,
-    0x3e, 0x02, 0x01, 0x05, 0x01, 0x03, 0x06, 0x0f, 0x27, 0x34, 0x2d, 0x1d,
-    0x2b, 0x4e, 0x75, 0x61, 0x3d, 0x1a, 0x0b, 0x16, 0x5e, 0x83, 0x71, 0x61,
-    0x75, 0x7a, 0x8c, 0x77, 0x0b, 0x05, 0x05, 0x05, 0x1f, 0x83, 0xa1, 0x8a,
-    0x8c, 0x71, 0x61, 0x7a, 0x47, 0x83, 0x95, 0x9e, 0x89, 0x7a, 0x71, 0x7a,
-    0x80, 0x83, 0x61, 0xa9, 0x90, 0x61, 0x85, 0x8c, 0x90, 0x97, 0x9a, 0x8d,
-    0x9c, 0x85, 0xb7, 0xba, 0xac, 0x9c, 0xb1, 0xb7, 0x98, 0xa5, 0xbf, 0xb0,
-    0xbf, 0xbf, 0xc7, 0xbf, 0xbf, 0xc4, 0xc4, 0x94, 0xc4, 0xc9, 0xc9, 0xc6,
-    0xd1, 0xbb, 0xd8, 0xdd, 0xd2, 0xd9, 0xd9, 0xe3, 0xc8, 0xd9, 0xd2, 0xdb,
-    0xdb, 0xd2, 0xe3, 0xe4, 0xdb, 0xeb, 0xeb, 0xe9, 0xeb, 0xf0, 0xf0, 0xf5,
-    0xf7, 0xf7, 0xf7, 0xf7, 0xf9, 0xf9, 0xf9, 0xf8, 0xfb, 0xfb, 0xf8, 0xf9,
-    0xf7, 0xf8, 0xf9, 0xf7, 0xf5, 0xf4, 0xf5, 0xf5, 0xf0, 0xf0, 0xe8, 0xeb,
-    0xeb, 0xe4, 0xeb, 0xd3, 0xb6, 0x8b, 0xdf, 0xe3, 0xdd, 0xd9, 0xc1, 0xbe,
-    0xa6, 0xc8, 0xbe, 0xd2, 0xbb, 0xd8, 0xbb, 0x97, 0xb1, 0xb5, 0xcb, 0xc6,
-    0xd1, 0xa7, 0x79, 0x57, 0x45, 0x6b, 0x99, 0xd1, 0xb8, 0x7f, 0xb8, 0xd7,
-    0xd0, 0xd0, 0xb1, 0x85, 0xa5, 0x8d, 0x97, 0xd0, 0xa7, 0x74, 0x55, 0xac,
-    0xc4, 0xd1, 0xac, 0x85, 0x5c, 0x5c, 0x5c, 0x55, 0x26, 0x5c, 0x55, 0x5f,
-    0x34, 0x55, 0x71, 0x8d, 0x77, 0x61, 0x7e, 0x83, 0x77, 0x5e, 0x1f, 0x16,
-    0x23, 0x8d, 0x8c, 0x94, 0x8c, 0x4b, 0x26, 0x71, 0x3e, 0x16, 0x4b, 0x4e,
-    0x94, 0x51, 0x83, 0x9b, 0x36, 0x69, 0x75, 0x75, 0x69, 0x69, 0x6c, 0xa4,
-    0x73, 0x3d, 0x8f, 0x64, 0x23, 0x2d, 0x0b, 0x06, 0x3e, 0x49, 0x7d, 0x87,
-    0x93, 0x9f, 0x92, 0x0b, 0x06, 0x05, 0x03, 0x06, 0x2a, 0x73, 0x93, 0x93,
-    0x3d, 0x53, 0x7b, 0x70, 0x67, 0x24, 0x7b, 0x82, 0x82, 0x72, 0x7b, 0x67,
-    0x4f, 0x63, 0x66, 0x66, 0x72, 0x72, 0x62, 0x72, 0x72, 0x72, 0x46, 0x58,
-    0x3a, 0x3c, 0x46, 0x46, 0x3a, 0x07, 0x01, 0x01, 0x03, 0x01, 0x09, 0x4d,
-    0x2e, 0x46, 0x4f, 0x33, 0x4f, 0x33, 0x3a, 0x5a, 0x22, 0x3a, 0x3f, 0x46,
-    0x66, 0x53, 0x58, 0x35, 0x24, 0x2a, 0x2a, 0x2a, 0x35, 0x23, 0x31, 0x04,
-    0x04, 0x04, 0x05, 0x05, 0x3d, 0x49, 0x50, 0x1b, 0x0e, 0x05, 0x01, 0x03,
-    0x01, 0x05, 0x20, 0x13, 0x1f, 0x23, 0x6f, 0x5e, 0x1d, 0x6a, 0x76, 0x8f,
-    0x23, 0x1c, 0x0b, 0x0e, 0x8a, 0x6f, 0x6a, 0x83, 0x8a, 0x81, 0x8c, 0x6a,
-    0x0e, 0x05, 0x03, 0x05, 0x0b, 0x83, 0x9e, 0x8f, 0x89, 0x59, 0x71, 0x75,
-    0x43, 0x83, 0x94, 0x83, 0x61, 0x77, 0x94, 0x8c, 0x83, 0x7e, 0x51, 0x5c,
-    0x8c, 0x9a, 0x9c, 0xa9, 0xb5, 0xb1, 0xb5, 0xa9, 0x97, 0x8d, 0xb1, 0xc4,
-    0xbb, 0xac, 0xa5, 0xa9, 0xb7, 0x9c, 0x9c, 0xb0, 0xbf, 0xba, 0xc7, 0xc9,
-    0xc4, 0xb5, 0xc4, 0xa5, 0xc9, 0xc9, 0xcf, 0xc4, 0xcf, 0xd1, 0xb7, 0xd8,
-    0xd9, 0xea, 0xe8, 0xe8, 0xd2, 0xe3, 0xdf, 0xd3, 0xeb, 0xd3, 0xe6, 0xea,
-    0xe4, 0xf0, 0xf0, 0xf0, 0xf1, 0xf0, 0xf5, 0xf7, 0xf5, 0xf7, 0xf5, 0xf5,
-    0xf7, 0xf9, 0xf7, 0xf9, 0xfb, 0xf8, 0xf9, 0xf9, 0xf7, 0xf7, 0xf9, 0xf5,
-    0xf0, 0xf0, 0xf4, 0xf4, 0xe9, 0xe9, 0xe9, 0xf0, 0xee, 0xe4, 0xf0, 0xee,
-    0x79, 0xc0, 0xdf, 0xd2, 0xd2, 0xbe, 0xb2, 0xbb, 0xcb, 0xac, 0xbb, 0xcb,
-    0xc6, 0x98, 0xbb, 0xb5, 0x7e, 0xa9, 0xc6, 0xd1, 0x97, 0x5c, 0x4a, 0x41,
-    0x32, 0x45, 0x7f, 0xbe, 0x74, 0x5f, 0xd1, 0xd7, 0xd6, 0xcb, 0xa9, 0x7f,
-    0x7f, 0xa5, 0xc1, 0xd7, 0xa7, 0x55, 0x7f, 0xa7, 0xcd, 0xc1, 0xc1, 0x6e,
-    0x34, 0x4b, 0x41, 0x0b, 0x1f, 0x7e, 0x4b, 0x1f, 0x34, 0x5f, 0x4b, 0x65,
-    0x7e, 0x8c, 0x8c, 0x8c, 0xa2, 0x71, 0x3e, 0x5c, 0x61, 0x26, 0x71, 0x7e,
-    0x83, 0x3e, 0x65, 0x94, 0x0f, 0x0b, 0x7a, 0x8f, 0x61, 0x47, 0x7e, 0x61,
-    0x85, 0x42, 0x83, 0x7a, 0x75, 0x7a, 0x31, 0x49, 0x8c, 0x49, 0x96, 0x6f,
-    0x1b, 0x1c, 0x1c, 0x07, 0x1a, 0x1b, 0x81, 0x78, 0x73, 0x67, 0x93, 0x64,
-    0x03, 0x0b, 0x05, 0x05, 0x0c, 0x64, 0x67, 0x87, 0x29, 0x7d, 0x87, 0x67,
-    0x67, 0x53, 0x53, 0x82, 0x82, 0x7b, 0x82, 0x63, 0x46, 0x58, 0x66, 0x70,
-    0x66, 0x66, 0x72, 0x72, 0x72, 0x58, 0x46, 0x66, 0x58, 0x62, 0x62, 0x4d,
-    0x3c, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4f, 0x4d, 0x40, 0x28, 0x66,
-    0x3a, 0x63, 0x4f, 0x33, 0x3f, 0x3f, 0x46, 0x33, 0x3f, 0x46, 0x33, 0x24,
-    0x24, 0x3d, 0x23, 0x5a, 0x1e, 0x50, 0x31, 0x06, 0x05, 0x04, 0x03, 0x05,
-    0x06, 0x27, 0x31, 0x3e, 0x06, 0x05, 0x01, 0x05, 0x05, 0x07, 0x3e, 0x13,
-    0x0c, 0x5e, 0x6c, 0x54, 0x1f, 0x5e, 0x61, 0x78, 0x1f, 0x13, 0x06, 0x0b,
-    0x75, 0x6f, 0x9b, 0x8c, 0x6f, 0x8c, 0x7a, 0x6c, 0x1f, 0x05, 0x01, 0x01,
-    0x15, 0x4b, 0x61, 0x83, 0xa1, 0x59, 0xaf, 0x8f, 0x83, 0x94, 0x83, 0x90,
-    0x8d, 0x3b, 0x71, 0x9c, 0x61, 0x44, 0x4b, 0x3e, 0x90, 0xa9, 0xa1, 0xb5,
-    0xa9, 0x94, 0xa2, 0xa2, 0x9a, 0xb7, 0x85, 0xac, 0xa6, 0xa2, 0xc6, 0xb3,
-    0x8c, 0x98, 0x7e, 0xb0, 0xc4, 0xba, 0xc9, 0xbf, 0xc9, 0xb5, 0xb5, 0xb7,
-    0xd0, 0xcf, 0xd6, 0xc9, 0xd7, 0xd7, 0xd8, 0xb8, 0xc8, 0xe6, 0xeb, 0xeb,
-    0xdf, 0xd9, 0xd9, 0xd9, 0xdb, 0xdb, 0xe4, 0xe8, 0xe9, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf5, 0xf5, 0xf7, 0xf7, 0xf7,
-    0xf8, 0xf9, 0xf7, 0xf7, 0xf5, 0xf5, 0xf7, 0xf5, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xe9, 0xf0, 0xf0, 0xf0, 0xee, 0xe8, 0xf0, 0xf0, 0xaa, 0xe3, 0xd9, 0x99,
-    0xdf, 0xdd, 0xd8, 0xd1, 0xc1, 0x8d, 0xcb, 0xd8, 0xa6, 0x6e, 0x61, 0xbf,
-    0x7a, 0x7a, 0x74, 0x97, 0xbe, 0x74, 0x45, 0x57, 0xb6, 0xa0, 0xc8, 0xd9,
-    0x74, 0x99, 0xc1, 0xd7, 0xd7, 0xbb, 0xb2, 0x5f, 0x16, 0x8d, 0xc9, 0xb3,
-    0x3e, 0x5f, 0x34, 0x2c, 0x47, 0xbb, 0x9d, 0x34, 0x41, 0x7f, 0x34, 0x2c,
-    0x57, 0x8d, 0x47, 0x5f, 0x65, 0x85, 0x77, 0x4b, 0x9c, 0x8d, 0x36, 0x69,
-    0x2c, 0x16, 0x55, 0x47, 0x7e, 0x1f, 0x71, 0x3e, 0x77, 0x76, 0x54, 0x61,
-    0x12, 0x23, 0x83, 0x75, 0x3e, 0x3d, 0x3e, 0x23, 0x54, 0x71, 0x3e, 0x7a,
-    0x83, 0x56, 0x1f, 0x27, 0x86, 0x64, 0x92, 0x31, 0x12, 0x15, 0x2d, 0x11,
-    0x1d, 0x1a, 0x84, 0x64, 0x2d, 0x23, 0x67, 0x7d, 0x1b, 0x07, 0x06, 0x05,
-    0x0c, 0x0c, 0x18, 0x1b, 0x50, 0x82, 0x70, 0x4c, 0x63, 0x82, 0x7b, 0x33,
-    0x82, 0x72, 0x72, 0x70, 0x66, 0x46, 0x66, 0x66, 0x70, 0x33, 0x62, 0x58,
-    0x4f, 0x2a, 0x72, 0x62, 0x58, 0x62, 0x62, 0x58, 0x3a, 0x07, 0x01, 0x03,
-    0x01, 0x01, 0x05, 0x22, 0x4d, 0x4f, 0x28, 0x28, 0x28, 0x3a, 0x24, 0x20,
-    0x33, 0x1e, 0x46, 0x5a, 0x3f, 0x5a, 0x53, 0x2a, 0x35, 0x1b, 0x67, 0x53,
-    0x5a, 0x42, 0x50, 0x15, 0x05, 0x05, 0x05, 0x05, 0x05, 0x31, 0x42, 0x1d,
-    0x05, 0x05, 0x03, 0x04, 0x02, 0x06, 0x64, 0x2d, 0x0b, 0x73, 0x6c, 0x3e,
-    0x26, 0x27, 0x6c, 0x49, 0x1a, 0x11, 0x0b, 0x1f, 0x69, 0x54, 0x83, 0x71,
-    0x75, 0x7a, 0x7a, 0x94, 0x1f, 0x05, 0x01, 0x01, 0x0b, 0x75, 0x61, 0x8c,
-    0x85, 0x89, 0xad, 0x8a, 0x85, 0x69, 0x9e, 0x83, 0x71, 0x83, 0xa2, 0x9a,
-    0x4b, 0x2d, 0x65, 0x30, 0xa9, 0xb5, 0x98, 0xb5, 0xb1, 0x94, 0xa2, 0xab,
-    0xb1, 0xa5, 0x8c, 0x8d, 0xbb, 0xb5, 0xb0, 0xa6, 0xa5, 0x9c, 0x8d, 0x61,
-    0xac, 0xa9, 0xbf, 0xbf, 0xba, 0xaf, 0xc1, 0xbf, 0xd0, 0xcf, 0xd6, 0xd0,
-    0xd7, 0xd8, 0xd8, 0xdd, 0xc8, 0xdb, 0xea, 0xe3, 0xe3, 0xe3, 0xe4, 0xe4,
-    0xe4, 0xe4, 0xe8, 0xee, 0xf0, 0xe9, 0xf0, 0xf3, 0xf0, 0xf5, 0xf7, 0xf7,
-    0xf7, 0xf7, 0xf7, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf7, 0xf7, 0xf5, 0xf5,
-    0xf5, 0xf3, 0xf4, 0xf5, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf4, 0xf5, 0xf3,
-    0xf0, 0xe9, 0xf3, 0xf4, 0xf0, 0xe6, 0xe3, 0xd9, 0xd2, 0xdd, 0xd8, 0xd8,
-    0xd8, 0x9d, 0xc1, 0xcf, 0x97, 0x6e, 0xa9, 0xa5, 0x8c, 0x69, 0x1f, 0x97,
-    0x44, 0xac, 0x44, 0xa7, 0xdd, 0xdf, 0xd9, 0x88, 0xc8, 0x99, 0xa7, 0xd1,
-    0xc6, 0x97, 0xb7, 0x85, 0x6e, 0x74, 0xb3, 0x65, 0x55, 0x97, 0x44, 0x5f,
-    0x7f, 0x51, 0xbb, 0x8d, 0x97, 0x34, 0x44, 0x26, 0x5f, 0x5e, 0x9d, 0x5c,
-    0x9c, 0xb0, 0x8c, 0x9c, 0x8d, 0x9c, 0x7e, 0x65, 0x36, 0x41, 0x55, 0x1f,
-    0x23, 0x21, 0xa2, 0x54, 0x69, 0x23, 0x6a, 0x1d, 0x41, 0x76, 0x83, 0x4b,
-    0x4b, 0x2d, 0x36, 0x71, 0x54, 0x1f, 0x35, 0x5c, 0x76, 0x36, 0x15, 0x54,
-    0x61, 0x54, 0x7a, 0x69, 0x2c, 0x20, 0x81, 0x50, 0x49, 0x23, 0x5b, 0x6c,
-    0x12, 0x06, 0x06, 0x07, 0x12, 0x0b, 0x13, 0x3d, 0x1c, 0x0b, 0x06, 0x49,
-    0x42, 0x3f, 0x31, 0x67, 0x7b, 0x82, 0x82, 0x72, 0x42, 0x70, 0x72, 0x67,
-    0x72, 0x58, 0x67, 0x58, 0x72, 0x4f, 0x24, 0x58, 0x3a, 0x4d, 0x62, 0x62,
-    0x58, 0x4d, 0x58, 0x62, 0x3a, 0x07, 0x01, 0x01, 0x03, 0x02, 0x04, 0x24,
-    0x1e, 0x33, 0x33, 0x09, 0x2a, 0x18, 0x29, 0x2a, 0x33, 0x4c, 0x46, 0x72,
-    0x58, 0x3a, 0x53, 0x24, 0x23, 0x33, 0x70, 0x67, 0x70, 0x5b, 0x67, 0x2a,
-    0x04, 0x06, 0x04, 0x04, 0x05, 0x04, 0x49, 0x0c, 0x05, 0x01, 0x06, 0x15,
-    0x05, 0x0b, 0x5b, 0x3e, 0x1c, 0x27, 0x5e, 0x6f, 0x27, 0x6c, 0x61, 0x25,
-    0x0c, 0x0b, 0x06, 0x1f, 0x5e, 0x5e, 0x6f, 0x49, 0x71, 0x5e, 0x75, 0xa1,
-    0x2d, 0x05, 0x01, 0x01, 0x03, 0x61, 0x7a, 0x6a, 0x59, 0x9e, 0x9e, 0x80,
-    0x7a, 0x47, 0x5e, 0x61, 0x80, 0x7a, 0xa8, 0xaf, 0x7e, 0x23, 0x85, 0x4b,
-    0x65, 0x9a, 0x9a, 0xb1, 0xb5, 0x90, 0xb1, 0x8d, 0xa2, 0x8d, 0x9c, 0xb1,
-    0xa2, 0xba, 0xb2, 0xa5, 0x97, 0xb0, 0xb0, 0x71, 0x9c, 0xba, 0xc9, 0xc7,
-    0xc7, 0xc9, 0xaf, 0xbf, 0xc9, 0xcf, 0xcf, 0xd1, 0xcb, 0xd8, 0xe1, 0xe2,
-    0xd9, 0xc8, 0xe3, 0xe6, 0xe3, 0xe3, 0xe6, 0xe3, 0xe4, 0xe6, 0xe4, 0xf0,
-    0xf3, 0xf0, 0xf0, 0xf4, 0xf4, 0xf5, 0xf7, 0xf5, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xf5, 0xf5, 0xf5, 0xf5, 0xf4, 0xf5, 0xf4, 0xf4, 0xf3, 0xf0, 0xf0, 0xf4,
-    0xf4, 0xf0, 0xee, 0xf0, 0xf0, 0xf5, 0xf7, 0xf5, 0xf0, 0xe9, 0xf3, 0xf3,
-    0xf1, 0xe8, 0xe3, 0xe3, 0xdd, 0xd2, 0xd8, 0xd8, 0xd1, 0x7f, 0xb1, 0xb1,
-    0xb7, 0x85, 0xb5, 0x8d, 0x4b, 0x9c, 0x4b, 0x1f, 0x7e, 0xc4, 0x88, 0xe2,
-    0xdf, 0xe3, 0x88, 0x41, 0x88, 0x99, 0xa7, 0x6e, 0x98, 0xb3, 0xb1, 0x8d,
-    0x79, 0x1f, 0x57, 0x26, 0x55, 0x85, 0x65, 0x8d, 0xac, 0x85, 0xac, 0x65,
-    0x1f, 0x74, 0x7f, 0x57, 0x36, 0x85, 0x65, 0x44, 0x8d, 0x7e, 0xa5, 0xa9,
-    0xb5, 0xaf, 0xac, 0x54, 0x51, 0x8d, 0x65, 0x2b, 0x26, 0x26, 0x36, 0x85,
-    0x61, 0x5c, 0x5e, 0x1f, 0x1c, 0x8c, 0x5e, 0x94, 0x3e, 0x55, 0x26, 0x69,
-    0x9b, 0x7a, 0x76, 0x2c, 0x69, 0x2b, 0x23, 0x83, 0x64, 0x4b, 0x31, 0x5e,
-    0x18, 0x31, 0x49, 0x3d, 0x23, 0x54, 0x1d, 0x5b, 0x06, 0x7d, 0x96, 0x73,
-    0x50, 0x24, 0x15, 0x5e, 0x07, 0x0c, 0x05, 0x2a, 0x27, 0x18, 0x42, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x7b, 0x46, 0x66, 0x58, 0x72, 0x66, 0x66, 0x63,
-    0x66, 0x72, 0x46, 0x28, 0x2a, 0x66, 0x62, 0x62, 0x62, 0x58, 0x46, 0x58,
-    0x46, 0x07, 0x01, 0x01, 0x03, 0x01, 0x04, 0x0c, 0x22, 0x33, 0x10, 0x18,
-    0x33, 0x2a, 0x1e, 0x3f, 0x46, 0x3f, 0x46, 0x72, 0x66, 0x4f, 0x3f, 0x1b,
-    0x29, 0x66, 0x53, 0x53, 0x42, 0x5b, 0x53, 0x3d, 0x0c, 0x12, 0x06, 0x06,
-    0x05, 0x05, 0x13, 0x0b, 0x03, 0x01, 0x01, 0x0b, 0x05, 0x12, 0x54, 0x54,
-    0x2d, 0x0b, 0x2d, 0x8a, 0x18, 0x8a, 0x3d, 0x12, 0x0b, 0x05, 0x06, 0x3e,
-    0x6f, 0x77, 0x68, 0x6a, 0x6f, 0x9b, 0x7a, 0x94, 0x5e, 0x05, 0x03, 0x01,
-    0x01, 0x6a, 0x59, 0x71, 0x59, 0x7a, 0x8c, 0x83, 0x75, 0x4e, 0x77, 0x77,
-    0x7a, 0x71, 0x8c, 0xa1, 0x4e, 0xa2, 0x89, 0x8c, 0x61, 0x9a, 0x9a, 0xb5,
-    0xbb, 0xa9, 0xa9, 0x98, 0x5c, 0x71, 0xa9, 0xbb, 0xac, 0x9d, 0xa2, 0xba,
-    0xb0, 0xc4, 0xb7, 0x69, 0x9c, 0xb1, 0xb0, 0xba, 0xba, 0xba, 0xb5, 0xb5,
-    0xb7, 0xc9, 0xcf, 0xcf, 0xd7, 0xd1, 0xe2, 0xe2, 0xe6, 0xd9, 0xdf, 0xe3,
-    0xe3, 0xdf, 0xe3, 0xe6, 0xe8, 0xe6, 0xe4, 0xf4, 0xf0, 0xf0, 0xf5, 0xf4,
-    0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf7, 0xf7, 0xf7, 0xf5, 0xf5, 0xf5,
-    0xf4, 0xf4, 0xf4, 0xf0, 0xf4, 0xf0, 0xf0, 0xf3, 0xf4, 0xf0, 0xee, 0xf0,
-    0xf0, 0xf4, 0xf7, 0xf7, 0xf3, 0xe8, 0xf0, 0xf0, 0xeb, 0xe6, 0xe3, 0xe2,
-    0xe3, 0xd9, 0xd1, 0xcb, 0xc8, 0xa6, 0xa6, 0xc9, 0xb7, 0x3b, 0x8d, 0x27,
-    0x3e, 0x5e, 0x2c, 0x2c, 0x8c, 0xb1, 0xc6, 0xca, 0xd2, 0xaa, 0x57, 0xaa,
-    0x79, 0x88, 0xaa, 0x41, 0x99, 0x8d, 0xa7, 0x44, 0x34, 0x55, 0x34, 0x88,
-    0x9d, 0x97, 0xc1, 0xc9, 0x97, 0x65, 0x88, 0x26, 0x57, 0x97, 0x8d, 0x44,
-    0x3e, 0x8d, 0x8d, 0x7e, 0x77, 0x77, 0x7e, 0x9a, 0xb5, 0x7e, 0x34, 0x36,
-    0x65, 0x5e, 0x8c, 0x3e, 0x26, 0x21, 0x3e, 0x5c, 0x2d, 0x23, 0x15, 0x4b,
-    0x1f, 0x5c, 0x77, 0x54, 0x23, 0x27, 0x21, 0x5e, 0x9b, 0xa4, 0x83, 0x69,
-    0x49, 0x59, 0x54, 0x20, 0x3e, 0x0f, 0x2d, 0x49, 0x54, 0x76, 0x8a, 0x36,
-    0x05, 0x0c, 0x23, 0x23, 0x1d, 0x9f, 0x96, 0x93, 0x93, 0x96, 0x18, 0x15,
-    0x23, 0x05, 0x0b, 0x01, 0x13, 0x3d, 0x5b, 0x87, 0x82, 0x82, 0x82, 0x82,
-    0x72, 0x82, 0x33, 0x33, 0x70, 0x66, 0x63, 0x63, 0x66, 0x72, 0x4d, 0x24,
-    0x24, 0x66, 0x62, 0x62, 0x62, 0x62, 0x4d, 0x2e, 0x3a, 0x07, 0x03, 0x05,
-    0x01, 0x01, 0x06, 0x14, 0x33, 0x24, 0x14, 0x1b, 0x1b, 0x1e, 0x1e, 0x46,
-    0x66, 0x4f, 0x53, 0x66, 0x58, 0x33, 0x17, 0x35, 0x5a, 0x5a, 0x5a, 0x3f,
-    0x18, 0x33, 0x67, 0x3f, 0x29, 0x12, 0x04, 0x05, 0x05, 0x03, 0x04, 0x0b,
-    0x03, 0x03, 0x05, 0x06, 0x0c, 0x1c, 0x5b, 0x3e, 0x54, 0x0b, 0x1f, 0x6c,
-    0x1f, 0x7a, 0x49, 0x0b, 0x0b, 0x05, 0x0b, 0x51, 0x78, 0x83, 0x5e, 0x4e,
-    0x8c, 0x9b, 0x8f, 0x95, 0x7a, 0x06, 0x05, 0x01, 0x01, 0x61, 0x7a, 0x2d,
-    0x61, 0x95, 0x7a, 0x7a, 0xa8, 0x75, 0x83, 0x61, 0x83, 0x6a, 0x7a, 0x61,
-    0x83, 0x89, 0x90, 0x9a, 0x47, 0x3b, 0x85, 0xb7, 0xb0, 0x8d, 0x8d, 0x61,
-    0x85, 0x7e, 0xb1, 0xa9, 0xbb, 0xb5, 0xb0, 0xb5, 0xb5, 0xbb, 0xc8, 0x57,
-    0xaa, 0xaa, 0xb3, 0xba, 0xb0, 0xbf, 0xb5, 0xc4, 0xcf, 0xc9, 0xc9, 0xd0,
-    0xda, 0xd7, 0xdd, 0xe1, 0xe2, 0xe3, 0xd9, 0xe3, 0xe3, 0xe6, 0xea, 0xe6,
-    0xe6, 0xe8, 0xe9, 0xf0, 0xed, 0xf7, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5,
-    0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf5, 0xf5, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xf0, 0xf0, 0xf0, 0xf3, 0xf4,
-    0xf0, 0xf0, 0xf0, 0xee, 0xeb, 0xe6, 0xe3, 0xe3, 0xe2, 0xdd, 0xd9, 0xb2,
-    0xcb, 0x98, 0xa6, 0xbb, 0xbb, 0x61, 0xa2, 0x51, 0x4b, 0x2c, 0x55, 0x61,
-    0xab, 0xa5, 0xd2, 0xeb, 0xd3, 0xaa, 0xb2, 0xe3, 0xbe, 0x99, 0x8b, 0x34,
-    0xa7, 0xbe, 0xb8, 0x57, 0x6e, 0xc6, 0xb3, 0xd0, 0x97, 0x5f, 0xb1, 0xb3,
-    0x5f, 0x1f, 0x6e, 0x65, 0x65, 0x8d, 0x74, 0x65, 0x7f, 0x65, 0x77, 0x8c,
-    0x8d, 0x8d, 0x51, 0x69, 0xa2, 0x8d, 0x7e, 0x4b, 0x61, 0x5c, 0x8d, 0x65,
-    0x2c, 0x1f, 0x61, 0x77, 0x71, 0x4b, 0x1a, 0x0b, 0x1f, 0x5e, 0x1f, 0x26,
-    0x0b, 0x1f, 0x27, 0x75, 0x83, 0x7a, 0x6a, 0x69, 0x54, 0x2d, 0x2d, 0x21,
-    0x0b, 0x54, 0x81, 0x76, 0x54, 0x8a, 0x75, 0x54, 0x12, 0x21, 0x31, 0x1f,
-    0x54, 0x73, 0x96, 0x96, 0x96, 0x87, 0x42, 0x4b, 0x1a, 0x0c, 0x13, 0x05,
-    0x10, 0x87, 0x53, 0x50, 0x82, 0x82, 0x82, 0x82, 0x7b, 0x66, 0x63, 0x33,
-    0x46, 0x70, 0x66, 0x70, 0x66, 0x58, 0x3a, 0x3a, 0x3a, 0x3f, 0x46, 0x58,
-    0x66, 0x58, 0x2e, 0x3c, 0x14, 0x06, 0x04, 0x04, 0x01, 0x01, 0x06, 0x17,
-    0x1b, 0x33, 0x28, 0x20, 0x10, 0x42, 0x31, 0x66, 0x58, 0x63, 0x66, 0x5a,
-    0x53, 0x2a, 0x33, 0x4f, 0x67, 0x67, 0x33, 0x3f, 0x23, 0x20, 0x53, 0x2b,
-    0x3d, 0x0c, 0x05, 0x05, 0x05, 0x05, 0x06, 0x05, 0x05, 0x03, 0x03, 0x06,
-    0x0b, 0x21, 0x5e, 0x23, 0x5e, 0x27, 0x1a, 0x69, 0x1a, 0x54, 0x1f, 0x08,
-    0x06, 0x08, 0x11, 0x59, 0x81, 0x83, 0x43, 0x49, 0x89, 0xa1, 0x95, 0x8f,
-    0x8a, 0x06, 0x05, 0x03, 0x01, 0x36, 0x61, 0x3e, 0x8c, 0x83, 0x77, 0x7a,
-    0x9a, 0x8c, 0x6f, 0x9a, 0x6a, 0x51, 0x4b, 0x7a, 0xa8, 0x90, 0xaf, 0x7a,
-    0x8d, 0x85, 0x36, 0x7e, 0xa5, 0x85, 0x98, 0x77, 0x8d, 0x97, 0xac, 0xa5,
-    0xbf, 0xc4, 0xba, 0xaf, 0xc6, 0xc8, 0xdb, 0xa0, 0xca, 0xca, 0xc6, 0xb0,
-    0xc4, 0xc4, 0xc4, 0xc4, 0xcf, 0xcf, 0xd6, 0xd0, 0xd8, 0xdd, 0xdd, 0xe1,
-    0xe2, 0xe3, 0xe2, 0xe3, 0xdf, 0xe4, 0xe8, 0xe8, 0xe6, 0xeb, 0xf4, 0xf5,
-    0xf5, 0xf7, 0xf7, 0xf9, 0xf5, 0xf4, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xf7, 0xf5, 0xf4, 0xf4, 0xf0, 0xf3, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xeb,
-    0xea, 0xe6, 0xe6, 0xdf, 0xd9, 0xe2, 0xd8, 0xd2, 0xc1, 0x99, 0x65, 0x97,
-    0xb7, 0xa2, 0xba, 0xaf, 0x8c, 0x51, 0x71, 0x83, 0xab, 0xa2, 0xdb, 0xe4,
-    0x8b, 0xe3, 0xe2, 0xdf, 0xe3, 0x99, 0xb8, 0x9d, 0xbe, 0x97, 0xc6, 0x85,
-    0xc1, 0xd0, 0xd7, 0xc4, 0xa6, 0x74, 0x74, 0x41, 0x34, 0x41, 0x9d, 0x44,
-    0x34, 0x74, 0x85, 0x97, 0x57, 0xb3, 0x7e, 0x4b, 0xa5, 0xa9, 0x8d, 0xb1,
-    0xb5, 0x6a, 0x7e, 0x5c, 0x85, 0x8d, 0x77, 0x61, 0x34, 0x59, 0xa1, 0x85,
-    0x71, 0x5f, 0x2c, 0x1a, 0x34, 0x26, 0x0e, 0x1f, 0x12, 0x36, 0x3e, 0x83,
-    0xa1, 0x81, 0x54, 0x3e, 0x3e, 0x1f, 0x27, 0x15, 0x2d, 0x6c, 0x6c, 0x54,
-    0x27, 0x86, 0x81, 0x73, 0x23, 0x0c, 0x36, 0x1b, 0x75, 0x50, 0x86, 0x93,
-    0x87, 0x87, 0x5b, 0x5b, 0x18, 0x27, 0x0c, 0x06, 0x12, 0x7b, 0x82, 0x33,
-    0x7b, 0x82, 0x82, 0x82, 0x82, 0x70, 0x7b, 0x70, 0x53, 0x4f, 0x63, 0x7b,
-    0x4f, 0x58, 0x66, 0x24, 0x72, 0x4f, 0x33, 0x33, 0x4d, 0x58, 0x1e, 0x4d,
-    0x14, 0x04, 0x04, 0x03, 0x01, 0x01, 0x04, 0x14, 0x14, 0x1b, 0x33, 0x2a,
-    0x1b, 0x33, 0x24, 0x4f, 0x72, 0x66, 0x66, 0x58, 0x5a, 0x3f, 0x3f, 0x53,
-    0x53, 0x53, 0x29, 0x50, 0x33, 0x29, 0x31, 0x31, 0x31, 0x23, 0x0b, 0x0b,
-    0x05, 0x06, 0x06, 0x05, 0x03, 0x05, 0x05, 0x0b, 0x05, 0x0c, 0x3d, 0x23,
-    0x73, 0x5e, 0x12, 0x3e, 0x20, 0x36, 0x1f, 0x06, 0x06, 0x05, 0x1f, 0x83,
-    0x83, 0xa1, 0x68, 0x59, 0x6a, 0x95, 0x81, 0x80, 0x7a, 0x16, 0x03, 0x03,
-    0x01, 0x16, 0x3b, 0x75, 0x83, 0x83, 0x4e, 0x61, 0x77, 0x7a, 0x61, 0x95,
-    0x8c, 0x36, 0x2d, 0xa2, 0xb4, 0xb5, 0xa8, 0x8c, 0x85, 0x9e, 0x77, 0x71,
-    0x55, 0xb3, 0xa2, 0x6a, 0x98, 0x8d, 0x9c, 0xa6, 0xc4, 0xb1, 0xc9, 0xbb,
-    0xd2, 0xc8, 0xd3, 0xc0, 0xe4, 0xe4, 0xdb, 0xbf, 0xc4, 0xc4, 0xc4, 0xbf,
-    0xcf, 0xcf, 0xd6, 0xd7, 0xd8, 0xdd, 0xdd, 0xe1, 0xe2, 0xe3, 0xe3, 0xe6,
-    0xe6, 0xe3, 0xe6, 0xe8, 0xea, 0xee, 0xf7, 0xf5, 0xf7, 0xf7, 0xf7, 0xf9,
-    0xf9, 0xf7, 0xf7, 0xf7, 0xf7, 0xf9, 0xf9, 0xf7, 0xf7, 0xf5, 0xf4, 0xf4,
-    0xf3, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xee, 0xee, 0xf0, 0xeb, 0xeb, 0xeb, 0xe8, 0xe6, 0xe3, 0xaa,
-    0x8b, 0xe3, 0xe2, 0xbe, 0xc6, 0xa7, 0x85, 0x97, 0xb7, 0x61, 0xb1, 0xbd,
-    0xba, 0x59, 0x83, 0x4b, 0x8f, 0xc9, 0xe6, 0xb6, 0xca, 0xe3, 0xd9, 0xdf,
-    0xe3, 0xb6, 0xc8, 0xd1, 0x99, 0x99, 0xbb, 0xd0, 0xcb, 0xc9, 0xd7, 0xd0,
-    0xd0, 0xbb, 0x6e, 0x5f, 0x9d, 0x97, 0x8d, 0x88, 0x3e, 0x57, 0x8d, 0x8d,
-    0x65, 0xaf, 0xb7, 0x55, 0x85, 0xb5, 0xa9, 0xb1, 0x5c, 0x69, 0x65, 0x8d,
-    0xa9, 0xa5, 0x8c, 0x65, 0x5c, 0x61, 0x9c, 0x6a, 0x25, 0x11, 0x1f, 0x71,
-    0x5e, 0x4b, 0x26, 0x1c, 0x15, 0x21, 0x15, 0x2d, 0xa1, 0xae, 0x7a, 0x27,
-    0x1f, 0x27, 0x12, 0x36, 0x3e, 0x23, 0x27, 0x2d, 0x1d, 0x5e, 0x31, 0x73,
-    0x0c, 0x05, 0x0b, 0x36, 0x3d, 0x86, 0x86, 0x93, 0x87, 0x92, 0x50, 0x50,
-    0x54, 0x23, 0x0f, 0x12, 0x1b, 0x73, 0x82, 0x7b, 0x42, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x70, 0x42, 0x82, 0x53, 0x46, 0x67, 0x4f, 0x46, 0x46, 0x24,
-    0x58, 0x70, 0x4d, 0x3a, 0x33, 0x22, 0x03, 0x46, 0x28, 0x07, 0x03, 0x01,
-    0x01, 0x01, 0x04, 0x1b, 0x0c, 0x07, 0x14, 0x2a, 0x14, 0x33, 0x20, 0x33,
-    0x58, 0x66, 0x53, 0x66, 0x33, 0x46, 0x3f, 0x53, 0x46, 0x50, 0x67, 0x35,
-    0x3d, 0x50, 0x42, 0x3f, 0x3d, 0x4c, 0x20, 0x0b, 0x04, 0x04, 0x06, 0x05,
-    0x01, 0x03, 0x04, 0x1c, 0x06, 0x0b, 0x50, 0x49, 0x81, 0x75, 0x1c, 0x1c,
-    0x3e, 0x1a, 0x0c, 0x05, 0x05, 0x05, 0x4b, 0x8f, 0x83, 0x95, 0x81, 0x61,
-    0x6f, 0x8c, 0x8f, 0x75, 0x81, 0x26, 0x03, 0x01, 0x01, 0x06, 0x7a, 0x8a,
-    0x43, 0x59, 0x61, 0x7a, 0x83, 0x89, 0x64, 0x90, 0x90, 0x23, 0x47, 0x80,
-    0xb5, 0xaf, 0x90, 0x9b, 0x89, 0xa9, 0x77, 0x94, 0x34, 0x6a, 0xa6, 0x74,
-    0x8d, 0x7e, 0x8d, 0x9d, 0xc1, 0xb8, 0xd1, 0xd8, 0xc8, 0xd9, 0xe4, 0xca,
-    0xdf, 0xee, 0xde, 0xb7, 0xbf, 0xbf, 0xbf, 0xc4, 0xce, 0xcf, 0xcf, 0xd6,
-    0xd7, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe3, 0xe6, 0xea, 0xe6, 0xea, 0xeb,
-    0xeb, 0xf3, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf9, 0xf9, 0xf7, 0xf7, 0xf7,
-    0xf9, 0xf9, 0xf9, 0xf7, 0xf7, 0xf7, 0xf5, 0xf4, 0xf4, 0xf0, 0xf3, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xeb,
-    0xeb, 0xeb, 0xeb, 0xeb, 0xe6, 0xe6, 0xdb, 0x8b, 0x99, 0xd9, 0xb6, 0xbe,
-    0xb8, 0xbe, 0xd9, 0xca, 0xaa, 0x6a, 0xbb, 0xb0, 0xa1, 0x75, 0xb5, 0x5e,
-    0xae, 0xcf, 0xdb, 0xc0, 0xd3, 0xdf, 0xdf, 0xe3, 0xdf, 0xb3, 0xd9, 0xe2,
-    0xb8, 0xa7, 0x97, 0xc9, 0xd1, 0xcb, 0xc1, 0xa7, 0xac, 0x7f, 0xb7, 0xcb,
-    0xac, 0x9d, 0x6e, 0x88, 0x5f, 0x34, 0x4b, 0x8d, 0xb3, 0xb5, 0xb1, 0x9c,
-    0x7e, 0x77, 0x97, 0x5c, 0x26, 0x3e, 0x3e, 0x5c, 0x77, 0x7e, 0x69, 0x4b,
-    0x2c, 0x69, 0x6a, 0x77, 0x2d, 0x11, 0x04, 0x7a, 0x7e, 0x36, 0x54, 0x71,
-    0x27, 0x0e, 0x0b, 0x0e, 0x7a, 0x8f, 0x54, 0x27, 0x1f, 0x2c, 0x0b, 0x25,
-    0x36, 0x12, 0x23, 0x20, 0x27, 0x49, 0x6f, 0x64, 0x13, 0x0b, 0x1f, 0x27,
-    0x23, 0x54, 0x73, 0x7b, 0x7b, 0x67, 0x73, 0x7b, 0x31, 0x0c, 0x13, 0x18,
-    0x1d, 0x31, 0x82, 0x82, 0x63, 0x53, 0x82, 0x7b, 0x70, 0x82, 0x67, 0x29,
-    0x5a, 0x29, 0x33, 0x3a, 0x58, 0x2a, 0x4d, 0x58, 0x1e, 0x4f, 0x2a, 0x4d,
-    0x17, 0x20, 0x09, 0x10, 0x22, 0x07, 0x03, 0x03, 0x01, 0x01, 0x0a, 0x0f,
-    0x31, 0x1e, 0x17, 0x10, 0x1b, 0x14, 0x1b, 0x66, 0x66, 0x66, 0x46, 0x4f,
-    0x24, 0x42, 0x33, 0x42, 0x42, 0x2a, 0x3f, 0x2a, 0x67, 0x42, 0x42, 0x35,
-    0x5b, 0x5b, 0x2d, 0x06, 0x05, 0x06, 0x05, 0x01, 0x05, 0x0b, 0x05, 0x2b,
-    0x16, 0x12, 0x49, 0x64, 0x7d, 0x78, 0x25, 0x11, 0x2d, 0x11, 0x05, 0x05,
-    0x05, 0x05, 0x6f, 0x9b, 0xa1, 0x81, 0x75, 0x59, 0x6f, 0x8c, 0x75, 0x8f,
-    0x7a, 0x1d, 0x05, 0x01, 0x03, 0x05, 0x1d, 0x47, 0x2d, 0x6f, 0x8c, 0x7a,
-    0x90, 0x9e, 0x68, 0xa8, 0x61, 0x51, 0x89, 0x85, 0xa2, 0xa8, 0x90, 0xa8,
-    0xaf, 0x8c, 0x77, 0x5c, 0x7e, 0x51, 0x7e, 0x9d, 0xa5, 0x7f, 0x88, 0xa6,
-    0xbe, 0xc8, 0xd2, 0xe3, 0xc8, 0xd2, 0xea, 0xd2, 0xdf, 0xeb, 0xd3, 0xc1,
-    0xb5, 0xbf, 0xbf, 0xd0, 0xce, 0xcf, 0xd6, 0xcf, 0xd6, 0xe1, 0xe1, 0xe1,
-    0xe2, 0xe2, 0xe3, 0xe6, 0xea, 0xea, 0xea, 0xeb, 0xef, 0xf4, 0xf7, 0xf7,
-    0xf7, 0xf7, 0xf7, 0xf8, 0xf9, 0xf9, 0xf7, 0xf9, 0xf9, 0xfa, 0xfa, 0xf9,
-    0xf9, 0xf7, 0xf5, 0xf5, 0xf4, 0xf4, 0xf3, 0xf0, 0xf3, 0xf0, 0xf0, 0xf0,
-    0xf1, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb,
-    0xeb, 0xe6, 0xca, 0xb6, 0xdf, 0xe3, 0x99, 0xc0, 0x79, 0xd3, 0xc0, 0xa0,
-    0x8b, 0x57, 0x8d, 0x7e, 0x5c, 0xa8, 0xb1, 0x83, 0xc2, 0xd6, 0x8b, 0xca,
-    0xe4, 0xe6, 0xe6, 0xe4, 0xd3, 0xca, 0xdf, 0xc8, 0xd1, 0xbe, 0x8d, 0x79,
-    0x85, 0x51, 0x5c, 0x41, 0x88, 0xbb, 0xd0, 0xc4, 0xbb, 0xb2, 0x7e, 0xa6,
-    0x2c, 0x34, 0x44, 0x41, 0xba, 0xc9, 0xa2, 0xbb, 0x8c, 0x5c, 0x2c, 0x4b,
-    0x2c, 0x1f, 0x1f, 0x51, 0x51, 0x7e, 0x69, 0x2c, 0x3e, 0x2d, 0x61, 0x69,
-    0x4b, 0x16, 0x34, 0x36, 0x5e, 0x61, 0x84, 0x7a, 0x2b, 0x0b, 0x1f, 0x06,
-    0x36, 0x3e, 0x26, 0x23, 0x4b, 0x3e, 0x1c, 0x0e, 0x1c, 0x13, 0x1c, 0x1a,
-    0x2d, 0x3d, 0x54, 0x5b, 0x16, 0x1f, 0x2d, 0x15, 0x12, 0x7d, 0x3d, 0x31,
-    0x5b, 0x7b, 0x96, 0x93, 0x67, 0x0c, 0x15, 0x1a, 0x0c, 0x05, 0x87, 0x82,
-    0x87, 0x29, 0x70, 0x42, 0x1e, 0x24, 0x10, 0x0c, 0x0b, 0x04, 0x3f, 0x5a,
-    0x33, 0x42, 0x62, 0x72, 0x50, 0x22, 0x18, 0x28, 0x46, 0x1e, 0x1e, 0x01,
-    0x28, 0x07, 0x03, 0x01, 0x01, 0x01, 0x03, 0x33, 0x28, 0x33, 0x3a, 0x46,
-    0x14, 0x14, 0x1b, 0x22, 0x70, 0x66, 0x53, 0x53, 0x42, 0x29, 0x42, 0x53,
-    0x4c, 0x42, 0x42, 0x35, 0x67, 0x73, 0x29, 0x35, 0x42, 0x33, 0x31, 0x07,
-    0x05, 0x06, 0x03, 0x05, 0x0b, 0x0c, 0x05, 0x49, 0x20, 0x0b, 0x2b, 0x64,
-    0x64, 0x3e, 0x2d, 0x0b, 0x15, 0x06, 0x08, 0x05, 0x05, 0x0b, 0x8a, 0x75,
-    0x81, 0x6f, 0x59, 0x8c, 0x75, 0x83, 0x6f, 0x61, 0x6f, 0x5e, 0x03, 0x01,
-    0x03, 0x05, 0x12, 0x7a, 0x61, 0x89, 0x8c, 0x6a, 0x9a, 0xa8, 0x61, 0x7a,
-    0x51, 0x9a, 0x95, 0x9c, 0x90, 0xa8, 0x83, 0xba, 0xa9, 0xa8, 0x90, 0x51,
-    0x8c, 0xa9, 0x36, 0x51, 0x88, 0x88, 0xb2, 0xbe, 0xb8, 0xd2, 0xd9, 0xc8,
-    0xdf, 0xe4, 0xe4, 0xd2, 0xe4, 0xeb, 0xe4, 0xc9, 0xc4, 0xba, 0xba, 0xcc,
-    0xcf, 0xc4, 0xd0, 0xd6, 0xda, 0xd8, 0xe2, 0xe1, 0xe2, 0xe2, 0xe3, 0xe6,
-    0xea, 0xeb, 0xeb, 0xee, 0xee, 0xf7, 0xf9, 0xf7, 0xf7, 0xf7, 0xf9, 0xfd,
-    0xfa, 0xf9, 0xf7, 0xf7, 0xf9, 0xfa, 0xfd, 0xfd, 0xfd, 0xf9, 0xf7, 0xf5,
-    0xf4, 0xf4, 0xf3, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xeb, 0xeb, 0xe8, 0xeb, 0xeb, 0xe8, 0xe4, 0xdf,
-    0xe3, 0xe3, 0xc8, 0xc8, 0x7c, 0x8e, 0x5d, 0x48, 0x7c, 0x8b, 0xa0, 0x5f,
-    0x55, 0xa6, 0x6a, 0x4b, 0xba, 0x98, 0x99, 0xca, 0xe6, 0xe6, 0xea, 0xdb,
-    0xe3, 0xca, 0xd2, 0xdd, 0xd8, 0xd7, 0xc8, 0x6e, 0x8d, 0x6e, 0x55, 0x97,
-    0x99, 0x8d, 0xbb, 0xac, 0x71, 0x5c, 0x55, 0x57, 0x2c, 0x2c, 0x51, 0x2c,
-    0x9d, 0xb1, 0x8d, 0x6a, 0x5e, 0x77, 0x2c, 0x3e, 0x4b, 0x41, 0x51, 0x94,
-    0x69, 0x3b, 0x51, 0x61, 0x26, 0x2d, 0x85, 0x55, 0x26, 0x16, 0x26, 0x69,
-    0x1d, 0x36, 0x69, 0x4b, 0x5e, 0x11, 0x13, 0x26, 0x36, 0x13, 0x3e, 0x54,
-    0x1a, 0x15, 0x13, 0x0b, 0x12, 0x69, 0x5b, 0x1f, 0x25, 0x83, 0x23, 0x36,
-    0x54, 0x27, 0x1b, 0x07, 0x01, 0x87, 0x5b, 0x86, 0x5b, 0x96, 0x96, 0x93,
-    0x96, 0x24, 0x13, 0x1d, 0x12, 0x03, 0x35, 0x82, 0x87, 0x2a, 0x07, 0x42,
-    0x67, 0x50, 0x53, 0x50, 0x04, 0x06, 0x10, 0x1e, 0x1e, 0x33, 0x66, 0x72,
-    0x46, 0x33, 0x28, 0x1e, 0x2e, 0x28, 0x07, 0x09, 0x10, 0x07, 0x03, 0x01,
-    0x01, 0x01, 0x01, 0x2e, 0x33, 0x33, 0x4f, 0x33, 0x66, 0x2a, 0x17, 0x3f,
-    0x28, 0x53, 0x46, 0x4d, 0x35, 0x1b, 0x33, 0x67, 0x66, 0x50, 0x50, 0x50,
-    0x23, 0x3f, 0x42, 0x42, 0x33, 0x54, 0x3d, 0x11, 0x05, 0x0b, 0x06, 0x05,
-    0x0b, 0x06, 0x05, 0x3d, 0x23, 0x0b, 0x5e, 0x27, 0x2d, 0x49, 0x2d, 0x5e,
-    0x03, 0x05, 0x06, 0x05, 0x05, 0x15, 0x8c, 0x75, 0x83, 0x68, 0x5b, 0x80,
-    0x68, 0x49, 0x54, 0x6f, 0x83, 0x7a, 0x05, 0x01, 0x03, 0x03, 0x0b, 0x61,
-    0x61, 0x7e, 0x68, 0x77, 0x18, 0x30, 0x26, 0x26, 0x36, 0x9a, 0x89, 0x9a,
-    0x90, 0xaf, 0x83, 0xb7, 0xa8, 0xaf, 0x8c, 0x85, 0x98, 0x9a, 0x7e, 0x88,
-    0xb1, 0x5c, 0x9d, 0xc6, 0xc1, 0xc8, 0xa7, 0xd9, 0xe3, 0xe6, 0xdb, 0xdb,
-    0xe4, 0xeb, 0xe3, 0xc7, 0xc9, 0xb5, 0xba, 0xcf, 0xcc, 0xcf, 0xc4, 0xda,
-    0xd7, 0xd8, 0xe1, 0xe2, 0xe2, 0xe3, 0xe3, 0xe6, 0xea, 0xea, 0xeb, 0xee,
-    0xee, 0xf7, 0xf9, 0xf9, 0xf7, 0xf7, 0xf9, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xfa, 0xfb, 0xfb, 0xfd, 0xf9, 0xf7, 0xf7, 0xf4, 0xf4, 0xf3, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xf0, 0xee, 0xee, 0xee,
-    0xee, 0xeb, 0xeb, 0xeb, 0xeb, 0xe6, 0xe6, 0xe6, 0xe3, 0xdf, 0xdf, 0xdb,
-    0xd4, 0x7c, 0x8e, 0x48, 0xa0, 0x7c, 0xe5, 0xc0, 0x79, 0xd9, 0x74, 0x5c,
-    0x51, 0x26, 0xc0, 0xd3, 0xe4, 0xe6, 0xc0, 0xa0, 0xe3, 0xca, 0xb6, 0xdf,
-    0xa7, 0xa6, 0xb3, 0xcb, 0xd1, 0x74, 0x7e, 0x1f, 0x5f, 0x41, 0xb2, 0x8d,
-    0x57, 0x97, 0xb2, 0x34, 0x65, 0x65, 0xbb, 0x88, 0x65, 0x8d, 0xbb, 0xb3,
-    0x9a, 0x77, 0x71, 0x44, 0x36, 0x16, 0x3e, 0xa5, 0x61, 0x47, 0x8d, 0x61,
-    0x77, 0x6a, 0x26, 0x11, 0x26, 0x54, 0x2d, 0x4b, 0x1a, 0x2d, 0x12, 0x36,
-    0x4b, 0x8c, 0x2c, 0x34, 0x3d, 0x55, 0x1a, 0x1d, 0x0b, 0x1f, 0x0b, 0x11,
-    0x25, 0x2d, 0x54, 0x38, 0x23, 0x3d, 0x1a, 0x1c, 0x7d, 0x54, 0x27, 0x0a,
-    0x01, 0x6c, 0x96, 0x5b, 0x64, 0x96, 0x87, 0x93, 0x93, 0x6f, 0x15, 0x1a,
-    0x2b, 0x04, 0x06, 0x3d, 0x20, 0x53, 0x67, 0x20, 0x7b, 0x53, 0x66, 0x70,
-    0x46, 0x1d, 0x7b, 0x1e, 0x1e, 0x42, 0x28, 0x28, 0x07, 0x14, 0x17, 0x1e,
-    0x28, 0x2e, 0x07, 0x2e, 0x33, 0x07, 0x05, 0x01, 0x01, 0x01, 0x01, 0x2a,
-    0x1e, 0x33, 0x33, 0x46, 0x46, 0x5a, 0x33, 0x14, 0x29, 0x13, 0x33, 0x53,
-    0x1e, 0x29, 0x33, 0x67, 0x53, 0x31, 0x42, 0x31, 0x25, 0x42, 0x42, 0x67,
-    0x31, 0x31, 0x1b, 0x1c, 0x04, 0x05, 0x03, 0x01, 0x04, 0x0b, 0x07, 0x73,
-    0x54, 0x06, 0x3d, 0x2d, 0x6c, 0x2d, 0x3e, 0x8f, 0x23, 0x05, 0x0b, 0x0b,
-    0x04, 0x54, 0x59, 0x68, 0x83, 0x7a, 0x68, 0x95, 0x75, 0x59, 0x6a, 0x8a,
-    0x61, 0x83, 0x06, 0x01, 0x01, 0x01, 0x1a, 0x3b, 0x27, 0x30, 0x8c, 0x7a,
-    0x90, 0x61, 0x51, 0x61, 0x61, 0x75, 0x90, 0x9b, 0xaf, 0x83, 0x7e, 0x7a,
-    0xb5, 0xa9, 0x9a, 0x7e, 0xb1, 0xa2, 0x85, 0x77, 0xb7, 0xa7, 0x5f, 0x6b,
-    0x99, 0x88, 0xbe, 0xd9, 0xe3, 0xe3, 0xd9, 0xd3, 0xeb, 0xe8, 0xdd, 0xc7,
-    0xc7, 0xbf, 0xa2, 0xb0, 0xba, 0xc9, 0xc4, 0xd6, 0xda, 0xdd, 0xdd, 0xe2,
-    0xe2, 0xdf, 0xe3, 0xe6, 0xea, 0xea, 0xef, 0xeb, 0xf1, 0xf9, 0xf9, 0xf9,
-    0xf7, 0xf7, 0xf7, 0xf9, 0xfd, 0xf9, 0xf9, 0xf9, 0xf8, 0xfd, 0xfd, 0xfb,
-    0xfd, 0xfa, 0xf9, 0xf7, 0xf5, 0xf4, 0xf4, 0xf3, 0xf3, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf1, 0xf1, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xeb, 0xeb, 0xeb,
-    0xeb, 0xe8, 0xe6, 0xe6, 0xe6, 0xdf, 0xe3, 0xeb, 0xe9, 0xc0, 0xe5, 0xd4,
-    0xd4, 0xb6, 0xdc, 0xe4, 0xd3, 0xe4, 0x99, 0xcb, 0xa7, 0x79, 0x97, 0xa0,
-    0xca, 0xdb, 0xca, 0xb6, 0xd2, 0xaa, 0x88, 0x88, 0xd2, 0xdd, 0xdd, 0xd7,
-    0xd1, 0xa6, 0x9d, 0x88, 0x15, 0x41, 0x65, 0x8d, 0x97, 0xb7, 0xb7, 0x77,
-    0x9d, 0xbf, 0xa9, 0x1a, 0x77, 0x9c, 0x85, 0xbb, 0xb7, 0xb5, 0x7e, 0x77,
-    0x5c, 0x15, 0x0e, 0x1f, 0x85, 0x7e, 0x30, 0x4b, 0x5c, 0x3b, 0x1f, 0x16,
-    0x11, 0x27, 0x69, 0x2d, 0x1c, 0x27, 0x57, 0x15, 0x1a, 0x27, 0x13, 0x0c,
-    0x38, 0x25, 0x20, 0x1c, 0x16, 0x1f, 0x1f, 0x15, 0x1c, 0x13, 0x0c, 0x1a,
-    0x6c, 0x6c, 0x0c, 0x54, 0x31, 0x5e, 0x05, 0x15, 0x06, 0x36, 0x86, 0x31,
-    0x31, 0x31, 0x50, 0x33, 0x23, 0x0f, 0x0a, 0x04, 0x06, 0x06, 0x03, 0x1b,
-    0x68, 0x82, 0x82, 0x33, 0x33, 0x53, 0x5a, 0x63, 0x72, 0x5a, 0x33, 0x53,
-    0x29, 0x33, 0x66, 0x33, 0x06, 0x07, 0x0c, 0x1b, 0x33, 0x2a, 0x1b, 0x17,
-    0x14, 0x04, 0x03, 0x01, 0x01, 0x01, 0x03, 0x17, 0x17, 0x28, 0x17, 0x3f,
-    0x33, 0x66, 0x46, 0x18, 0x24, 0x4f, 0x24, 0x25, 0x14, 0x33, 0x28, 0x3d,
-    0x1e, 0x53, 0x3f, 0x31, 0x33, 0x23, 0x3d, 0x3f, 0x3d, 0x27, 0x13, 0x06,
-    0x05, 0x05, 0x03, 0x01, 0x03, 0x0b, 0x23, 0x76, 0x2d, 0x12, 0x3e, 0x23,
-    0x2d, 0x36, 0x3e, 0x49, 0x3d, 0x03, 0x04, 0x08, 0x0b, 0x6a, 0x7a, 0x5e,
-    0x61, 0x6f, 0x5e, 0x89, 0x59, 0x7a, 0x6f, 0x85, 0x75, 0x2c, 0x05, 0x01,
-    0x01, 0x05, 0x0b, 0x2d, 0x3b, 0x23, 0x3b, 0x36, 0x59, 0x7a, 0x47, 0x61,
-    0x69, 0x85, 0x6a, 0x7a, 0x83, 0x85, 0x6a, 0x9a, 0xba, 0xa1, 0xa2, 0x7e,
-    0xb7, 0x8d, 0x85, 0x51, 0x74, 0x6e, 0x5c, 0x88, 0x5f, 0x5d, 0x79, 0xb6,
-    0xdf, 0xd1, 0xd9, 0xd3, 0xe8, 0xe4, 0xc7, 0xc7, 0xc3, 0xb5, 0xc4, 0xc4,
-    0xb1, 0xb1, 0xcf, 0xc9, 0xd7, 0xdd, 0xd8, 0xe2, 0xe3, 0xd9, 0xe6, 0xe6,
-    0xe6, 0xeb, 0xeb, 0xeb, 0xf3, 0xf9, 0xf9, 0xf9, 0xf9, 0xf7, 0xf9, 0xf9,
-    0xfd, 0xfd, 0xf9, 0xf9, 0xfa, 0xfd, 0xfd, 0xfb, 0xf8, 0xf9, 0xf9, 0xf7,
-    0xf7, 0xf6, 0xf4, 0xf3, 0xf4, 0xf3, 0xf0, 0xf0, 0xf1, 0xf1, 0xf0, 0xee,
-    0xf0, 0xee, 0xee, 0xee, 0xee, 0xeb, 0xeb, 0xeb, 0xe8, 0xe8, 0xe6, 0xe6,
-    0xe3, 0xd2, 0xe3, 0xe6, 0xeb, 0xe4, 0xf0, 0xf6, 0xe5, 0xe5, 0xe5, 0xee,
-    0xef, 0xdb, 0xb6, 0xc8, 0x79, 0x8d, 0x88, 0xd2, 0xdc, 0xa0, 0xb6, 0xa0,
-    0xa0, 0x57, 0xe3, 0xd2, 0xd1, 0xd7, 0xd1, 0xd1, 0xd1, 0x74, 0x8d, 0x7f,
-    0x79, 0x41, 0x41, 0x74, 0x71, 0xbb, 0xb1, 0x71, 0x88, 0xbb, 0x97, 0x9c,
-    0x5f, 0x7e, 0x47, 0xac, 0x77, 0x85, 0x97, 0x85, 0x2d, 0x1f, 0x0e, 0x0e,
-    0x44, 0x4b, 0x74, 0x55, 0x4b, 0x85, 0x26, 0x16, 0x16, 0x26, 0x36, 0x4b,
-    0x1f, 0x26, 0x15, 0x0b, 0x05, 0x16, 0x0b, 0x1f, 0x51, 0x1a, 0x2d, 0x15,
-    0x15, 0x3e, 0x4b, 0x15, 0x1c, 0x15, 0x20, 0x3e, 0x6c, 0x2d, 0x1f, 0x54,
-    0x81, 0x54, 0x05, 0x04, 0x05, 0x1b, 0x23, 0x1a, 0x0c, 0x1a, 0x31, 0x5b,
-    0x50, 0x33, 0x49, 0x0b, 0x05, 0x0e, 0x04, 0x13, 0x3f, 0x50, 0x82, 0x63,
-    0x2a, 0x31, 0x50, 0x20, 0x2a, 0x17, 0x25, 0x07, 0x0c, 0x01, 0x10, 0x20,
-    0x04, 0x33, 0x33, 0x12, 0x07, 0x0d, 0x09, 0x17, 0x28, 0x10, 0x04, 0x03,
-    0x01, 0x02, 0x01, 0x17, 0x28, 0x46, 0x28, 0x1e, 0x14, 0x28, 0x4f, 0x4f,
-    0x1e, 0x2a, 0x3f, 0x20, 0x1e, 0x15, 0x24, 0x1b, 0x1b, 0x24, 0x1b, 0x35,
-    0x20, 0x1d, 0x18, 0x1b, 0x1b, 0x20, 0x1b, 0x20, 0x04, 0x05, 0x03, 0x01,
-    0x05, 0x06, 0x23, 0x5b, 0x12, 0x06, 0x2d, 0x5e, 0x64, 0x2c, 0x49, 0x6c,
-    0x23, 0x05, 0x05, 0x06, 0x1f, 0x68, 0x61, 0x75, 0x6f, 0x59, 0x61, 0x68,
-    0x3e, 0x83, 0x83, 0x31, 0x23, 0x2d, 0x0b, 0x03, 0x01, 0x05, 0x1a, 0x4e,
-    0x6c, 0x71, 0x51, 0x1f, 0x2d, 0x51, 0x2c, 0x61, 0x6f, 0x90, 0x94, 0x89,
-    0x80, 0x61, 0xa2, 0x9c, 0xa2, 0x85, 0x8d, 0x77, 0xa9, 0x9c, 0x6a, 0x85,
-    0x71, 0xb1, 0xa6, 0x9d, 0xb8, 0x7f, 0x99, 0x79, 0x99, 0xc0, 0xd9, 0xd9,
-    0xe4, 0xc8, 0xc4, 0xbf, 0xc2, 0xba, 0xb5, 0xd0, 0x94, 0xb7, 0xcf, 0xd1,
-    0xda, 0xdd, 0xd8, 0xe3, 0xd9, 0xe3, 0xe6, 0xe6, 0xe6, 0xe4, 0xeb, 0xee,
-    0xf4, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfa, 0xf9,
-    0xfa, 0xfd, 0xfd, 0xfb, 0xfa, 0xf9, 0xf9, 0xf7, 0xf7, 0xf5, 0xf5, 0xf4,
-    0xf4, 0xf3, 0xf0, 0xf0, 0xf1, 0xf0, 0xf1, 0xee, 0xee, 0xee, 0xf0, 0xee,
-    0xee, 0xee, 0xeb, 0xeb, 0xe8, 0xe6, 0xe6, 0xe6, 0xd9, 0xc8, 0xdf, 0xe3,
-    0xe3, 0xe6, 0xee, 0xf4, 0xf4, 0xf0, 0xdb, 0xeb, 0xeb, 0xaa, 0x57, 0xb8,
-    0x98, 0xd8, 0xa7, 0xdb, 0xe5, 0xca, 0xca, 0xc0, 0xdf, 0x8b, 0xd2, 0xd8,
-    0xd1, 0xbe, 0x57, 0x74, 0x88, 0x97, 0xbb, 0xb1, 0x6e, 0x36, 0x51, 0x6e,
-    0x97, 0xb1, 0xcf, 0xbf, 0xb7, 0xbb, 0xb1, 0xcb, 0xa2, 0xc4, 0x98, 0x98,
-    0x98, 0xa9, 0x9c, 0x36, 0x5f, 0x15, 0x2c, 0x5f, 0x26, 0x69, 0x55, 0x71,
-    0x85, 0x2d, 0x77, 0x54, 0x3e, 0x36, 0x1a, 0x16, 0x15, 0x2d, 0x6a, 0x1f,
-    0x0e, 0x15, 0x1c, 0x54, 0x8f, 0x20, 0x36, 0x26, 0x1f, 0x0b, 0x2d, 0x36,
-    0x27, 0x13, 0x75, 0x1b, 0x3d, 0x54, 0x1c, 0x3d, 0x5b, 0x1d, 0x06, 0x05,
-    0x05, 0x05, 0x6c, 0x8a, 0x73, 0x31, 0x50, 0x96, 0x73, 0x53, 0x67, 0x20,
-    0x12, 0x29, 0x20, 0x07, 0x7b, 0x50, 0x33, 0x24, 0x0c, 0x14, 0x14, 0x33,
-    0x25, 0x17, 0x2a, 0x24, 0x04, 0x1e, 0x07, 0x01, 0x01, 0x07, 0x24, 0x33,
-    0x17, 0x2a, 0x07, 0x22, 0x22, 0x1b, 0x04, 0x03, 0x01, 0x01, 0x01, 0x28,
-    0x33, 0x3a, 0x2e, 0x2a, 0x28, 0x4f, 0x46, 0x3f, 0x3f, 0x1b, 0x14, 0x5a,
-    0x3f, 0x1d, 0x20, 0x14, 0x18, 0x20, 0x07, 0x0c, 0x15, 0x12, 0x2d, 0x24,
-    0x0c, 0x20, 0x1d, 0x23, 0x05, 0x05, 0x03, 0x03, 0x05, 0x04, 0x3d, 0x64,
-    0x0c, 0x08, 0x49, 0x27, 0x31, 0x54, 0x5b, 0x59, 0x1a, 0x06, 0x05, 0x05,
-    0x2d, 0x83, 0x6a, 0x61, 0x6a, 0x61, 0x61, 0x61, 0x54, 0x83, 0x4e, 0x26,
-    0x4e, 0x8c, 0x0b, 0x03, 0x05, 0x05, 0x1f, 0x80, 0x9e, 0x83, 0x2d, 0x59,
-    0x61, 0x26, 0x26, 0x4b, 0x90, 0x83, 0x59, 0x7a, 0x8d, 0x83, 0x9e, 0xa2,
-    0x94, 0x9c, 0x9a, 0x61, 0x90, 0x9c, 0x8d, 0xb1, 0x65, 0xa6, 0xb1, 0xb1,
-    0xbe, 0xc6, 0x88, 0x88, 0x97, 0x99, 0xd9, 0xc8, 0xd9, 0xc9, 0xbf, 0xbf,
-    0xc2, 0xc7, 0xaf, 0xba, 0x98, 0xbb, 0xcf, 0xd0, 0xda, 0xdd, 0xd8, 0xe2,
-    0xd2, 0xe3, 0xe3, 0xdf, 0xdf, 0xe8, 0xef, 0xee, 0xf7, 0xfa, 0xfa, 0xf9,
-    0xf9, 0xf9, 0xfa, 0xfa, 0xfd, 0xfd, 0xfd, 0xf9, 0xfd, 0xfb, 0xfd, 0xfd,
-    0xfd, 0xfa, 0xf9, 0xf9, 0xf9, 0xf7, 0xf7, 0xf5, 0xf4, 0xf4, 0xf3, 0xf0,
-    0xf0, 0xf0, 0xf1, 0xee, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xeb, 0xeb, 0xeb,
-    0xe8, 0xe6, 0xe6, 0xdf, 0xd9, 0xdf, 0xdf, 0xdf, 0xe2, 0xe3, 0xe6, 0xee,
-    0xed, 0xf0, 0xe8, 0xe4, 0xd3, 0x6b, 0x6b, 0x99, 0xd1, 0xcb, 0xa7, 0xe4,
-    0xe8, 0xd3, 0xc0, 0xeb, 0xd3, 0xca, 0xaa, 0xb2, 0xa7, 0x7f, 0x6b, 0x6b,
-    0x97, 0xd1, 0xb1, 0x8d, 0xa9, 0xa2, 0xb7, 0x77, 0x5f, 0x97, 0xc9, 0xc9,
-    0xbb, 0xc4, 0xb7, 0xb1, 0xc9, 0xc9, 0xba, 0x9c, 0xb7, 0xb1, 0xa9, 0x4b,
-    0x7e, 0x2d, 0x4b, 0x8d, 0x4b, 0x47, 0x23, 0x3e, 0x44, 0x54, 0x8d, 0x83,
-    0x5c, 0x4b, 0x26, 0x26, 0x1f, 0x1a, 0x83, 0x54, 0x16, 0x1f, 0x55, 0x7a,
-    0x54, 0x23, 0x5e, 0x1f, 0x27, 0x1a, 0x12, 0x2d, 0x25, 0x23, 0x75, 0x23,
-    0x0b, 0x06, 0x15, 0x0c, 0x23, 0x23, 0x06, 0x06, 0x05, 0x06, 0x50, 0x9f,
-    0x87, 0x78, 0x29, 0x67, 0x7b, 0x7d, 0x70, 0x3d, 0x14, 0x24, 0x13, 0x25,
-    0x27, 0x1b, 0x03, 0x42, 0x67, 0x53, 0x67, 0x63, 0x63, 0x67, 0x4f, 0x10,
-    0x33, 0x5a, 0x35, 0x28, 0x1e, 0x0c, 0x06, 0x04, 0x1b, 0x07, 0x1b, 0x3a,
-    0x07, 0x0c, 0x03, 0x03, 0x01, 0x01, 0x01, 0x28, 0x28, 0x33, 0x4f, 0x3f,
-    0x3f, 0x33, 0x2a, 0x2a, 0x2a, 0x24, 0x04, 0x1e, 0x20, 0x0c, 0x2a, 0x53,
-    0x3d, 0x33, 0x14, 0x1b, 0x31, 0x0c, 0x24, 0x3d, 0x29, 0x14, 0x27, 0x12,
-    0x05, 0x05, 0x04, 0x05, 0x05, 0x01, 0x54, 0x6a, 0x0c, 0x15, 0x75, 0x15,
-    0x5b, 0x47, 0x96, 0x47, 0x04, 0x0b, 0x05, 0x05, 0x49, 0x78, 0x59, 0x6a,
-    0x7a, 0x68, 0x6a, 0x6a, 0x4e, 0x4b, 0x23, 0x75, 0x6a, 0x3e, 0x05, 0x05,
-    0x05, 0x01, 0x1a, 0x7a, 0x8f, 0x68, 0x61, 0x51, 0xb4, 0x3b, 0x6a, 0x4e,
-    0x80, 0xa8, 0x90, 0x59, 0x59, 0xa2, 0x90, 0x9e, 0x8c, 0x9a, 0x85, 0x74,
-    0x9a, 0x94, 0x85, 0x94, 0x77, 0x97, 0xc9, 0xc6, 0xcb, 0xcb, 0xbb, 0xa7,
-    0x97, 0x99, 0xaa, 0xb8, 0xc6, 0xc9, 0xc2, 0xc7, 0xc2, 0xc7, 0xaf, 0x8d,
-    0x8d, 0xc4, 0xd0, 0xd6, 0xcb, 0xe1, 0xd8, 0xd9, 0xd2, 0xd9, 0xe3, 0xea,
-    0xea, 0xeb, 0xee, 0xee, 0xf9, 0xfd, 0xfa, 0xfa, 0xfa, 0xfa, 0xfd, 0xfd,
-    0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfa, 0xfd, 0xfa, 0xf9, 0xf9,
-    0xf9, 0xf7, 0xf7, 0xf7, 0xf7, 0xf4, 0xf3, 0xf3, 0xf0, 0xf0, 0xf1, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xeb, 0xeb, 0xea, 0xe6, 0xe8, 0xdf,
-    0xd9, 0xe3, 0xe2, 0xdd, 0xdd, 0xe2, 0xe3, 0xe8, 0xdc, 0xdc, 0xdb, 0xd3,
-    0xca, 0xaa, 0x8b, 0xb6, 0xd9, 0xc8, 0xe3, 0xea, 0xdc, 0xc0, 0xa0, 0xca,
-    0xe3, 0xe6, 0xc8, 0xbe, 0xbe, 0x79, 0x5c, 0x55, 0xb8, 0xb1, 0xa5, 0xc9,
-    0xd7, 0xd7, 0xb1, 0xba, 0x97, 0x51, 0xbf, 0xd0, 0xb3, 0xcf, 0xba, 0xc4,
-    0xc9, 0xba, 0xba, 0xc4, 0xaf, 0x9c, 0xa5, 0x8d, 0x6a, 0x77, 0x90, 0x8c,
-    0x5c, 0x6a, 0x36, 0x47, 0x2c, 0x36, 0x8d, 0x94, 0x55, 0x26, 0x26, 0x69,
-    0x5c, 0x36, 0x77, 0x34, 0x15, 0x3e, 0x47, 0x1d, 0x36, 0x23, 0x2d, 0x3e,
-    0x0b, 0x15, 0x20, 0x1f, 0x06, 0x1a, 0x36, 0x15, 0x06, 0x06, 0x0b, 0x1b,
-    0x27, 0x23, 0x04, 0x01, 0x05, 0x05, 0x25, 0x87, 0x6c, 0x96, 0x86, 0x29,
-    0x5b, 0x50, 0x67, 0x35, 0x0c, 0x06, 0x0e, 0x06, 0x03, 0x4f, 0x29, 0x7b,
-    0x82, 0x42, 0x70, 0x33, 0x53, 0x46, 0x42, 0x20, 0x2a, 0x14, 0x1e, 0x4d,
-    0x72, 0x58, 0x2a, 0x28, 0x04, 0x04, 0x01, 0x10, 0x10, 0x03, 0x01, 0x03,
-    0x01, 0x04, 0x01, 0x22, 0x33, 0x33, 0x46, 0x24, 0x33, 0x33, 0x33, 0x1b,
-    0x12, 0x14, 0x33, 0x1b, 0x12, 0x1b, 0x4f, 0x46, 0x24, 0x24, 0x5b, 0x2a,
-    0x25, 0x18, 0x14, 0x31, 0x3d, 0x20, 0x5b, 0x1b, 0x04, 0x06, 0x06, 0x04,
-    0x01, 0x01, 0x7d, 0x73, 0x0b, 0x20, 0x6c, 0x1d, 0x3d, 0x75, 0x96, 0x61,
-    0x05, 0x05, 0x05, 0x05, 0x76, 0x6f, 0x75, 0x61, 0x83, 0x75, 0x61, 0x30,
-    0x1f, 0x23, 0x6a, 0x4e, 0x4e, 0x0b, 0x0b, 0x05, 0x05, 0x01, 0x1a, 0x61,
-    0x61, 0x75, 0x90, 0x6a, 0x8f, 0x61, 0x36, 0x77, 0x59, 0x75, 0xb5, 0x7e,
-    0x6a, 0xa8, 0x9a, 0xb5, 0x89, 0x7e, 0x77, 0x9a, 0x9a, 0x9a, 0x71, 0x8d,
-    0x77, 0x85, 0xa9, 0xb7, 0xbb, 0xc9, 0xbb, 0xd2, 0xbe, 0xaa, 0xb8, 0xa2,
-    0xb5, 0xb5, 0xc2, 0xc2, 0xbf, 0xbf, 0x94, 0xa9, 0xa2, 0xcf, 0xd6, 0xd6,
-    0xb7, 0xd8, 0xd1, 0xd2, 0xdf, 0xe7, 0xe6, 0xea, 0xea, 0xea, 0xee, 0xee,
-    0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfb, 0xfd, 0xfd, 0xfd, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfd, 0xfd, 0xfd, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf7,
-    0xf7, 0xf7, 0xf4, 0xf3, 0xf3, 0xf0, 0xf1, 0xee, 0xf0, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xeb, 0xeb, 0xea, 0xe6, 0xd9, 0xe3, 0xe3, 0xe3, 0xe2, 0xe2,
-    0xdf, 0xdd, 0xe2, 0xe6, 0xe4, 0xdc, 0xdc, 0xe4, 0xe4, 0xc0, 0xd3, 0xdf,
-    0xdf, 0xe3, 0xe6, 0xe4, 0xe4, 0xdb, 0xd3, 0xc0, 0xe3, 0xe6, 0xd2, 0xe1,
-    0xbe, 0x7f, 0x34, 0x7f, 0x65, 0x6e, 0xc1, 0xd0, 0xd0, 0xbb, 0x7e, 0xb7,
-    0xd0, 0x9c, 0x71, 0xc9, 0xb5, 0xc9, 0xba, 0xc9, 0xc9, 0xb1, 0xbf, 0xc4,
-    0xbf, 0xba, 0x9c, 0x77, 0x5f, 0x51, 0x90, 0x71, 0x5c, 0x94, 0x54, 0x71,
-    0x27, 0x44, 0x5e, 0x6a, 0x3e, 0x4b, 0x3e, 0x3e, 0x51, 0x7a, 0x83, 0x2d,
-    0x36, 0x1a, 0x15, 0x1f, 0x2d, 0x27, 0x26, 0x36, 0x05, 0x12, 0x15, 0x0b,
-    0x05, 0x12, 0x1f, 0x06, 0x12, 0x23, 0x15, 0x1a, 0x0b, 0x1b, 0x07, 0x15,
-    0x05, 0x03, 0x05, 0x29, 0x29, 0x35, 0x31, 0x36, 0x23, 0x35, 0x49, 0x50,
-    0x23, 0x01, 0x05, 0x05, 0x06, 0x33, 0x7b, 0x53, 0x82, 0x70, 0x63, 0x70,
-    0x33, 0x24, 0x1e, 0x42, 0x28, 0x5a, 0x4f, 0x33, 0x46, 0x72, 0x3c, 0x46,
-    0x33, 0x14, 0x1e, 0x01, 0x24, 0x14, 0x01, 0x05, 0x03, 0x03, 0x01, 0x22,
-    0x33, 0x28, 0x24, 0x31, 0x33, 0x3f, 0x1b, 0x20, 0x17, 0x1b, 0x2a, 0x25,
-    0x0b, 0x10, 0x50, 0x4f, 0x31, 0x3f, 0x31, 0x33, 0x50, 0x3d, 0x13, 0x20,
-    0x1b, 0x0c, 0x50, 0x31, 0x05, 0x05, 0x05, 0x05, 0x01, 0x01, 0x92, 0x5b,
-    0x05, 0x64, 0x54, 0x54, 0x27, 0x96, 0xa4, 0x54, 0x05, 0x05, 0x06, 0x06,
-    0x83, 0x6a, 0x9b, 0x4e, 0x83, 0x94, 0x3d, 0x13, 0x27, 0x30, 0x3e, 0x59,
-    0x36, 0x30, 0x1f, 0x05, 0x01, 0x05, 0x0b, 0x4e, 0x95, 0x95, 0x95, 0x95,
-    0x49, 0x6a, 0x4e, 0x61, 0x75, 0x6a, 0xa2, 0x9a, 0x7a, 0x9b, 0xa2, 0xb5,
-    0x8c, 0x7e, 0x83, 0x9c, 0xaf, 0xba, 0x8c, 0xa2, 0x9c, 0x97, 0x85, 0xb1,
-    0xa2, 0xa9, 0x97, 0x99, 0xb6, 0xd9, 0xd1, 0xa8, 0xc2, 0xba, 0xab, 0xa8,
-    0xa5, 0xba, 0x8d, 0xb1, 0xcf, 0xcf, 0xd7, 0xd0, 0x9d, 0xc6, 0xd1, 0xe2,
-    0xe2, 0xe7, 0xe6, 0xea, 0xeb, 0xeb, 0xee, 0xee, 0xf9, 0xfd, 0xfb, 0xfd,
-    0xfd, 0xfd, 0xfb, 0xfd, 0xfd, 0xfe, 0xfd, 0xfd, 0xfb, 0xfd, 0xfb, 0xfd,
-    0xfd, 0xfd, 0xf9, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xf7, 0xf6, 0xf4,
-    0xf3, 0xf0, 0xf1, 0xf0, 0xf1, 0xee, 0xee, 0xee, 0xee, 0xee, 0xeb, 0xeb,
-    0xeb, 0xe4, 0xd9, 0xe3, 0xe6, 0xe3, 0xe2, 0xe2, 0xdd, 0xdd, 0xdd, 0xe3,
-    0xe8, 0xd3, 0xe5, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xe3, 0xe3, 0xea, 0xe4,
-    0xeb, 0xe8, 0xdb, 0xe8, 0xe3, 0xc8, 0xe2, 0xc6, 0xa7, 0x4b, 0x65, 0x74,
-    0x6e, 0x85, 0x5c, 0xb3, 0xbb, 0x85, 0x41, 0x85, 0x9d, 0xba, 0xa7, 0x69,
-    0xb1, 0xc9, 0xa2, 0xc5, 0xc4, 0x90, 0xc4, 0xc4, 0xc4, 0xbf, 0x9c, 0x7e,
-    0x2c, 0x3b, 0x8c, 0xa2, 0xa5, 0x8c, 0x4b, 0x7e, 0x61, 0x2c, 0x36, 0x27,
-    0x36, 0x55, 0x3e, 0x83, 0x3e, 0x77, 0x94, 0x55, 0x4b, 0x27, 0x3e, 0x20,
-    0x13, 0x36, 0x16, 0x0b, 0x0b, 0x06, 0x0b, 0x05, 0x06, 0x06, 0x1a, 0x49,
-    0x15, 0x23, 0x21, 0x23, 0x14, 0x54, 0x18, 0x5e, 0x0b, 0x03, 0x0b, 0x42,
-    0x67, 0x64, 0x5b, 0x49, 0x06, 0x07, 0x1d, 0x1d, 0x20, 0x03, 0x05, 0x0b,
-    0x07, 0x1d, 0x70, 0x53, 0x7b, 0x82, 0x53, 0x7b, 0x5a, 0x06, 0x58, 0x53,
-    0x58, 0x72, 0x72, 0x63, 0x3a, 0x28, 0x46, 0x3a, 0x2e, 0x17, 0x14, 0x0a,
-    0x33, 0x1e, 0x03, 0x01, 0x03, 0x01, 0x01, 0x1e, 0x1e, 0x22, 0x1d, 0x1e,
-    0x2a, 0x09, 0x14, 0x1e, 0x2a, 0x2a, 0x24, 0x1b, 0x1e, 0x12, 0x14, 0x28,
-    0x67, 0x35, 0x29, 0x50, 0x3f, 0x31, 0x25, 0x07, 0x0c, 0x07, 0x5b, 0x2a,
-    0x03, 0x03, 0x05, 0x05, 0x01, 0x04, 0x7d, 0x2d, 0x05, 0x73, 0x6c, 0x5e,
-    0x3d, 0x83, 0x76, 0x23, 0x03, 0x03, 0x05, 0x06, 0x7a, 0x7a, 0x75, 0x54,
-    0x8f, 0x6a, 0x13, 0x59, 0x6a, 0x61, 0x68, 0x6a, 0x3e, 0x61, 0x1f, 0x05,
-    0x01, 0x01, 0x16, 0x75, 0xa8, 0x80, 0x95, 0x95, 0x77, 0x36, 0x89, 0x75,
-    0x4e, 0x80, 0x43, 0x83, 0x7a, 0x7a, 0x7a, 0x89, 0x7e, 0xa2, 0x77, 0x9a,
-    0xbf, 0xb5, 0xab, 0x9c, 0xa5, 0xa9, 0xa5, 0xc9, 0xbb, 0xb7, 0xb7, 0xb8,
-    0x97, 0xa7, 0xb7, 0xd1, 0xc9, 0xb5, 0xb5, 0xb5, 0xba, 0xa2, 0x85, 0x9c,
-    0xa2, 0xb7, 0xc6, 0xcb, 0xb8, 0xd1, 0xdd, 0xe2, 0xe2, 0xe7, 0xe6, 0xea,
-    0xeb, 0xeb, 0xee, 0xee, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
-    0xfd, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfb, 0xfb, 0xfb, 0xfd, 0xfa, 0xfb,
-    0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xf7, 0xf4, 0xf4, 0xf3, 0xf0, 0xf1,
-    0xf0, 0xf1, 0xee, 0xee, 0xee, 0xee, 0xeb, 0xea, 0xea, 0xe4, 0xe4, 0xe3,
-    0xe6, 0xe3, 0xe2, 0xe2, 0xdd, 0xe3, 0xe2, 0xe3, 0xc8, 0xb6, 0x7c, 0x6d,
-    0x79, 0xdb, 0xa0, 0xd2, 0xe3, 0xe3, 0xe6, 0xe4, 0xeb, 0xeb, 0xe6, 0xe8,
-    0xb6, 0x57, 0xd9, 0xaa, 0x9d, 0x41, 0x5f, 0xbb, 0xbb, 0xb1, 0x77, 0x74,
-    0x71, 0x85, 0x34, 0x26, 0x85, 0xb7, 0xc9, 0x69, 0x5c, 0xa5, 0x98, 0xc9,
-    0xb1, 0xac, 0xc4, 0xbb, 0xa9, 0xba, 0xa2, 0x77, 0x71, 0x9a, 0x69, 0x7e,
-    0x9a, 0x3e, 0x47, 0x55, 0x65, 0x36, 0x3e, 0x54, 0x26, 0x26, 0x38, 0x9b,
-    0x85, 0x3e, 0x1c, 0x23, 0x5e, 0x83, 0xa4, 0x61, 0x3d, 0x21, 0x0b, 0x05,
-    0x05, 0x03, 0x08, 0x11, 0x11, 0x1c, 0x15, 0x23, 0x54, 0x23, 0x23, 0x5b,
-    0x7a, 0x86, 0x73, 0x78, 0x11, 0x01, 0x04, 0x31, 0x96, 0x73, 0x53, 0x50,
-    0x23, 0x23, 0x20, 0x04, 0x01, 0x03, 0x05, 0x0b, 0x04, 0x0c, 0x70, 0x53,
-    0x46, 0x82, 0x42, 0x7b, 0x3f, 0x2a, 0x53, 0x70, 0x72, 0x58, 0x4d, 0x4d,
-    0x53, 0x46, 0x17, 0x28, 0x22, 0x22, 0x03, 0x07, 0x22, 0x1e, 0x04, 0x05,
-    0x02, 0x01, 0x04, 0x1e, 0x24, 0x14, 0x24, 0x1b, 0x14, 0x1b, 0x3f, 0x3f,
-    0x31, 0x1d, 0x20, 0x24, 0x33, 0x4c, 0x1f, 0x1e, 0x50, 0x20, 0x49, 0x20,
-    0x1d, 0x2a, 0x27, 0x14, 0x06, 0x15, 0x5b, 0x27, 0x03, 0x05, 0x01, 0x05,
-    0x01, 0x0b, 0x29, 0x2d, 0x05, 0x78, 0x64, 0x86, 0x29, 0x3e, 0x49, 0x26,
-    0x03, 0x01, 0x03, 0x05, 0x7a, 0x68, 0x8a, 0x30, 0x85, 0x15, 0x59, 0x6f,
-    0x4e, 0x6a, 0x95, 0x47, 0x2d, 0x59, 0x36, 0x01, 0x02, 0x01, 0x0b, 0x6a,
-    0x8f, 0x9b, 0x9a, 0xa8, 0x95, 0x47, 0x89, 0x8c, 0x2d, 0x95, 0x89, 0x61,
-    0xa9, 0x89, 0x94, 0x9a, 0x71, 0x85, 0x5c, 0xb7, 0xba, 0xa9, 0xb5, 0x85,
-    0xa5, 0xb5, 0xba, 0xc9, 0xc9, 0xb7, 0xbf, 0xd8, 0xc1, 0xb2, 0xa7, 0x99,
-    0xa7, 0x8c, 0xaf, 0xaf, 0xaf, 0xaf, 0xb7, 0xb1, 0xba, 0xbb, 0xcb, 0xc1,
-    0xd8, 0xcb, 0xe1, 0xe2, 0xe2, 0xe6, 0xe6, 0xea, 0xe8, 0xef, 0xee, 0xee,
-    0xf9, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfd,
-    0xfb, 0xfd, 0xfd, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfd, 0xfd, 0xfa, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf5, 0xf4, 0xf4, 0xf3, 0xf0, 0xf1, 0xf1, 0xee, 0xee,
-    0xee, 0xee, 0xeb, 0xeb, 0xeb, 0xeb, 0xdb, 0xe6, 0xe6, 0xe3, 0xe2, 0xe3,
-    0xe2, 0xe6, 0xe3, 0xd8, 0x99, 0x99, 0x45, 0xa0, 0x32, 0xb6, 0x99, 0xe3,
-    0xe2, 0xe2, 0xe6, 0xdb, 0xeb, 0xeb, 0xeb, 0xea, 0xe3, 0xc0, 0xc8, 0x57,
-    0x74, 0x5c, 0x85, 0xbb, 0x77, 0xb7, 0x8d, 0xba, 0xa2, 0x9d, 0x5c, 0x85,
-    0xc4, 0x7a, 0xc1, 0x8d, 0x4b, 0x57, 0x34, 0x97, 0x77, 0x7e, 0x94, 0x36,
-    0xa5, 0xbf, 0x9c, 0xa1, 0xba, 0x51, 0x61, 0x3e, 0x6a, 0x4b, 0x7e, 0x1c,
-    0x26, 0x3e, 0x2c, 0x6a, 0x27, 0x5f, 0x1f, 0x7a, 0x6a, 0x55, 0x1f, 0x7e,
-    0x5e, 0x2d, 0x7d, 0x5e, 0x1a, 0x26, 0x19, 0x03, 0x0b, 0x04, 0x04, 0x0e,
-    0x15, 0x1d, 0x2b, 0x2d, 0x8f, 0x73, 0x31, 0x7d, 0x96, 0x87, 0x96, 0x96,
-    0x12, 0x03, 0x01, 0x0f, 0x96, 0x64, 0x7d, 0x93, 0x67, 0x7b, 0x8a, 0x53,
-    0x1c, 0x01, 0x01, 0x06, 0x0b, 0x06, 0x3f, 0x7b, 0x5a, 0x70, 0x70, 0x42,
-    0x2a, 0x70, 0x1b, 0x14, 0x10, 0x33, 0x50, 0x53, 0x33, 0x14, 0x1e, 0x28,
-    0x33, 0x07, 0x1b, 0x46, 0x46, 0x1e, 0x05, 0x01, 0x02, 0x01, 0x01, 0x06,
-    0x06, 0x06, 0x07, 0x17, 0x28, 0x29, 0x24, 0x33, 0x2a, 0x17, 0x1e, 0x33,
-    0x2a, 0x2a, 0x18, 0x1b, 0x04, 0x2a, 0x14, 0x18, 0x2d, 0x42, 0x3f, 0x33,
-    0x50, 0x06, 0x20, 0x0f, 0x05, 0x05, 0x01, 0x02, 0x01, 0x1b, 0x4b, 0x23,
-    0x06, 0x9b, 0x73, 0x8f, 0x23, 0x51, 0x5b, 0x23, 0x05, 0x02, 0x01, 0x05,
-    0x75, 0x75, 0x75, 0x3e, 0x13, 0x5c, 0x29, 0x83, 0x7a, 0x36, 0x36, 0x2d,
-    0x71, 0x75, 0x47, 0x01, 0x01, 0x02, 0x0c, 0x4e, 0x9e, 0x95, 0x95, 0xad,
-    0x9e, 0x54, 0x9a, 0x9e, 0x5c, 0x7a, 0x83, 0x7a, 0x89, 0x9b, 0xa8, 0x4e,
-    0x89, 0x98, 0x7e, 0x85, 0xa2, 0xab, 0xb5, 0x85, 0xa5, 0xb0, 0xc2, 0xb0,
-    0xbf, 0xb5, 0xbb, 0xbb, 0xc1, 0xc6, 0xa6, 0xbe, 0xc0, 0xa5, 0xc1, 0xb0,
-    0xa9, 0xb5, 0xd0, 0xa9, 0xd6, 0xcb, 0xb7, 0xd8, 0xd1, 0xdd, 0xdd, 0xe2,
-    0xe3, 0xe6, 0xea, 0xeb, 0xe8, 0xef, 0xee, 0xee, 0xf7, 0xed, 0xfe, 0xfd,
-    0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfb, 0xfa,
-    0xfd, 0xfb, 0xfb, 0xfd, 0xfd, 0xfb, 0xfa, 0xf9, 0xf9, 0xf9, 0xf7, 0xf7,
-    0xf5, 0xf4, 0xf3, 0xf0, 0xf1, 0xf1, 0xee, 0xee, 0xee, 0xee, 0xee, 0xeb,
-    0xe4, 0xe4, 0xe4, 0xe6, 0xe6, 0xe3, 0xe3, 0xe2, 0xe2, 0xe2, 0xe3, 0xd8,
-    0xc6, 0xaa, 0xb1, 0xd8, 0xbe, 0xb6, 0xd9, 0xe3, 0xe2, 0xe7, 0xd2, 0xe6,
-    0xea, 0xeb, 0xeb, 0xeb, 0xe6, 0xe2, 0xc8, 0x41, 0x34, 0x7f, 0x6e, 0x6e,
-    0x41, 0xb1, 0xba, 0xc9, 0xc7, 0xac, 0x85, 0x77, 0xc7, 0xac, 0x7e, 0x6a,
-    0x34, 0x2c, 0x1c, 0x2d, 0x4b, 0x2d, 0x1f, 0x65, 0xb7, 0x9c, 0xa2, 0xb5,
-    0xba, 0x94, 0xba, 0x9c, 0x44, 0x9a, 0x5c, 0x1f, 0x77, 0x76, 0x47, 0x7a,
-    0x65, 0x54, 0x3e, 0x71, 0x0f, 0x1f, 0x6a, 0x36, 0x75, 0x69, 0x27, 0x1f,
-    0x21, 0x12, 0x1f, 0x23, 0x15, 0x4b, 0x2d, 0x08, 0x05, 0x03, 0x2c, 0x54,
-    0x96, 0xa4, 0x18, 0x75, 0x8a, 0x92, 0x9f, 0x9f, 0x20, 0x0b, 0x05, 0x04,
-    0x50, 0x92, 0x67, 0x7b, 0x67, 0x82, 0x87, 0x87, 0x56, 0x07, 0x1c, 0x04,
-    0x01, 0x01, 0x04, 0x82, 0x82, 0x4f, 0x82, 0x14, 0x17, 0x33, 0x58, 0x66,
-    0x58, 0x46, 0x2e, 0x4f, 0x53, 0x4d, 0x62, 0x17, 0x03, 0x17, 0x58, 0x10,
-    0x2e, 0x28, 0x05, 0x04, 0x01, 0x01, 0x01, 0x05, 0x1e, 0x14, 0x1b, 0x42,
-    0x3f, 0x1e, 0x46, 0x58, 0x2a, 0x4f, 0x66, 0x29, 0x29, 0x14, 0x42, 0x1e,
-    0x14, 0x14, 0x3f, 0x1d, 0x2a, 0x29, 0x31, 0x5b, 0x50, 0x31, 0x12, 0x0b,
-    0x05, 0x04, 0x03, 0x02, 0x01, 0x1c, 0x7d, 0x25, 0x06, 0x75, 0x8a, 0x1d,
-    0x1d, 0x59, 0x92, 0x3e, 0x01, 0x05, 0x01, 0x01, 0x6c, 0x9b, 0x7a, 0x1a,
-    0x5e, 0x71, 0x6f, 0x59, 0x59, 0x36, 0x1f, 0x71, 0x6f, 0x95, 0x1a, 0x01,
-    0x01, 0x01, 0x0b, 0x7e, 0x75, 0x89, 0xa8, 0xa3, 0xa8, 0x59, 0x7e, 0xb4,
-    0x4e, 0x4e, 0x9b, 0x89, 0x65, 0x8c, 0x85, 0xb5, 0x7e, 0x65, 0x77, 0xb1,
-    0x94, 0x94, 0xba, 0x8d, 0x6a, 0xa1, 0xbd, 0xab, 0xb0, 0xb0, 0xaf, 0xbf,
-    0xba, 0xb1, 0xb7, 0xc6, 0xd1, 0xd9, 0x9c, 0x9a, 0xc4, 0xc4, 0xbf, 0xbb,
-    0xb1, 0xb1, 0xcb, 0xcb, 0xd1, 0xd8, 0xdd, 0xe3, 0xe3, 0xe6, 0xe6, 0xea,
-    0xe6, 0xef, 0xee, 0xee, 0xed, 0xd4, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe,
-    0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfd, 0xfd, 0xfa, 0xfa, 0xfd, 0xfd, 0xfd,
-    0xfd, 0xfb, 0xf9, 0xf9, 0xfa, 0xf9, 0xf6, 0xf6, 0xf5, 0xf3, 0xf3, 0xf3,
-    0xf1, 0xf1, 0xf0, 0xee, 0xee, 0xee, 0xee, 0xeb, 0xe8, 0xf1, 0xe8, 0xeb,
-    0xe6, 0xe6, 0xe6, 0xe3, 0xe2, 0xe2, 0xdd, 0xdd, 0xd0, 0x97, 0xd6, 0xbf,
-    0xb2, 0xd8, 0xdd, 0xdd, 0xe3, 0xe6, 0xc8, 0xdd, 0xe6, 0xeb, 0xe6, 0xeb,
-    0xe6, 0xe3, 0xc8, 0x74, 0x99, 0x55, 0x26, 0x34, 0x6e, 0xba, 0xbf, 0xc9,
-    0xc7, 0xbf, 0xd0, 0xb1, 0xbf, 0xa2, 0x3e, 0x5f, 0x3e, 0x41, 0x1f, 0x34,
-    0x34, 0x1f, 0x1a, 0x8d, 0xa9, 0xb5, 0x4e, 0xaf, 0xa8, 0x5e, 0x7a, 0x8c,
-    0x83, 0x71, 0x4b, 0x83, 0x94, 0x4b, 0xa9, 0x94, 0x36, 0x5e, 0x7a, 0x94,
-    0x1f, 0x1f, 0x23, 0x1f, 0x76, 0x71, 0x69, 0x23, 0x0b, 0x3e, 0x83, 0x71,
-    0x26, 0x1d, 0x3e, 0x0b, 0x11, 0x06, 0x0c, 0x0b, 0x1d, 0x9b, 0x1d, 0x6f,
-    0x7a, 0x31, 0x86, 0xa4, 0x54, 0x0b, 0x01, 0x03, 0x42, 0x93, 0x67, 0x73,
-    0x7b, 0x93, 0x87, 0x67, 0x49, 0x12, 0x04, 0x01, 0x01, 0x01, 0x01, 0x1e,
-    0x42, 0x3f, 0x14, 0x04, 0x5a, 0x66, 0x66, 0x72, 0x72, 0x70, 0x46, 0x33,
-    0x10, 0x1e, 0x09, 0x01, 0x0c, 0x07, 0x01, 0x04, 0x17, 0x17, 0x03, 0x03,
-    0x01, 0x01, 0x01, 0x07, 0x1e, 0x28, 0x1e, 0x42, 0x28, 0x3f, 0x46, 0x33,
-    0x29, 0x4f, 0x33, 0x46, 0x1b, 0x1d, 0x07, 0x24, 0x3f, 0x13, 0x12, 0x1b,
-    0x50, 0x1e, 0x2d, 0x15, 0x0c, 0x49, 0x50, 0x06, 0x01, 0x05, 0x01, 0x03,
-    0x01, 0x1f, 0x86, 0x2d, 0x07, 0x3e, 0x14, 0x1a, 0x36, 0x8f, 0x96, 0x36,
-    0x01, 0x01, 0x05, 0x03, 0x36, 0x71, 0x2d, 0x20, 0x75, 0x8f, 0x75, 0x54,
-    0x2d, 0x1f, 0x7e, 0x83, 0x7e, 0x2d, 0x0f, 0x01, 0x01, 0x03, 0x0b, 0x8a,
-    0x59, 0x9b, 0xa3, 0xa8, 0xa8, 0x80, 0x47, 0x9e, 0x9a, 0x36, 0x75, 0x7e,
-    0x71, 0x51, 0x89, 0xba, 0xa9, 0x8d, 0x98, 0xb1, 0xa9, 0x7e, 0x7e, 0x65,
-    0x5e, 0xac, 0xbc, 0xbc, 0xb5, 0x9c, 0xb5, 0xbc, 0x9c, 0xb1, 0xc4, 0xbf,
-    0xc9, 0xd9, 0xc1, 0x8c, 0xb1, 0xd6, 0xa9, 0xa9, 0xc1, 0xc1, 0xd8, 0xdd,
-    0xd8, 0xe2, 0xd8, 0xdd, 0xe7, 0xe6, 0xe3, 0xe4, 0xeb, 0xe8, 0xef, 0xee,
-    0xf0, 0xf8, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd,
-    0xfd, 0xfd, 0xfd, 0xfa, 0xf9, 0xfa, 0xfd, 0xfd, 0xfd, 0xfd, 0xfb, 0xf9,
-    0xfa, 0xf9, 0xf7, 0xf7, 0xf7, 0xf6, 0xf4, 0xf3, 0xf0, 0xf1, 0xf1, 0xee,
-    0xee, 0xee, 0xee, 0xe8, 0xee, 0xee, 0xf0, 0xeb, 0xe6, 0xe6, 0xe6, 0xe3,
-    0xe2, 0xdd, 0xdd, 0xdd, 0xb8, 0xa6, 0xcf, 0x77, 0x83, 0xc9, 0xd0, 0xd2,
-    0xd2, 0xca, 0xb8, 0xc1, 0xc8, 0xe4, 0xeb, 0xe6, 0xe3, 0xaa, 0x8b, 0x88,
-    0x7f, 0x55, 0x16, 0x88, 0xd0, 0xba, 0xba, 0xc4, 0xc2, 0xa9, 0xc4, 0xb7,
-    0xa5, 0x85, 0x5c, 0x26, 0x69, 0x77, 0x6e, 0x25, 0x9c, 0x4b, 0x6a, 0xaf,
-    0x7e, 0x9a, 0xaf, 0xba, 0x9a, 0x90, 0x83, 0x5c, 0x9c, 0x7a, 0x4b, 0x83,
-    0x4b, 0x77, 0x7e, 0xaf, 0x5e, 0x36, 0x7e, 0x1d, 0x26, 0x77, 0x1a, 0x0b,
-    0x36, 0x20, 0x05, 0x2c, 0x1c, 0x61, 0x8f, 0x54, 0x23, 0xa1, 0x6c, 0x13,
-    0x12, 0x12, 0x21, 0x69, 0x0c, 0x36, 0x2d, 0x92, 0x54, 0x49, 0x2a, 0x67,
-    0x86, 0x06, 0x05, 0x01, 0x15, 0x93, 0x96, 0x78, 0x87, 0x82, 0x7b, 0x73,
-    0x10, 0x31, 0x06, 0x01, 0x05, 0x04, 0x02, 0x01, 0x3f, 0x1e, 0x07, 0x46,
-    0x4f, 0x72, 0x3a, 0x3f, 0x17, 0x04, 0x01, 0x01, 0x02, 0x04, 0x04, 0x05,
-    0x0d, 0x04, 0x04, 0x0b, 0x4f, 0x24, 0x04, 0x03, 0x05, 0x03, 0x01, 0x07,
-    0x33, 0x28, 0x3a, 0x24, 0x1e, 0x66, 0x66, 0x33, 0x46, 0x53, 0x33, 0x24,
-    0x0c, 0x1b, 0x23, 0x25, 0x1d, 0x25, 0x0c, 0x15, 0x20, 0x0c, 0x0c, 0x1b,
-    0x1a, 0x0b, 0x35, 0x0b, 0x01, 0x03, 0x01, 0x05, 0x03, 0x15, 0x31, 0x12,
-    0x05, 0x15, 0x15, 0x1f, 0x49, 0x75, 0x8f, 0x4b, 0x01, 0x03, 0x08, 0x0b,
-    0x13, 0x6f, 0x06, 0x83, 0x68, 0x9e, 0x6f, 0x75, 0x51, 0x0e, 0x68, 0x59,
-    0x29, 0x6a, 0x3e, 0x01, 0x01, 0x03, 0x06, 0x8f, 0x89, 0x95, 0xa8, 0xa8,
-    0xa8, 0x9e, 0x1f, 0x95, 0x89, 0x75, 0x59, 0x89, 0x61, 0x4b, 0x51, 0xa2,
-    0xb1, 0x85, 0x6e, 0x9c, 0x85, 0x6a, 0x6e, 0x55, 0x69, 0x9c, 0xb0, 0x9b,
-    0x9b, 0x9b, 0xbc, 0xba, 0xb1, 0xb5, 0xc4, 0xc9, 0xc4, 0xd1, 0xb8, 0xc1,
-    0xb8, 0xca, 0x88, 0xb3, 0xda, 0xd0, 0xcb, 0xd8, 0xd8, 0xd8, 0xd9, 0xe3,
-    0xe6, 0xe6, 0xe3, 0xe4, 0xeb, 0xeb, 0xef, 0xee, 0xeb, 0xfd, 0xfe, 0xfe,
-    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfa,
-    0xfa, 0xfb, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9,
-    0xf9, 0xf7, 0xf4, 0xf4, 0xf3, 0xf0, 0xf1, 0xee, 0xee, 0xee, 0xeb, 0xeb,
-    0xee, 0xee, 0xee, 0xe8, 0xe6, 0xe6, 0xe3, 0xe2, 0xe2, 0xdd, 0xd8, 0xd1,
-    0xbe, 0x51, 0xb7, 0x85, 0x77, 0xa2, 0xc6, 0xd2, 0xeb, 0xdb, 0xe2, 0xdd,
-    0xda, 0xd9, 0xdb, 0xd3, 0xc0, 0xc0, 0x41, 0x1f, 0x26, 0x34, 0x57, 0x5c,
-    0xbf, 0xaf, 0xb1, 0xb0, 0x98, 0x4b, 0x77, 0xa9, 0x69, 0x77, 0x2c, 0x65,
-    0x85, 0xac, 0x8d, 0x3e, 0x97, 0x8c, 0xb1, 0x8d, 0x85, 0xa9, 0x7a, 0xaf,
-    0xb5, 0x9c, 0x7a, 0x3e, 0x61, 0x8d, 0x4b, 0x5c, 0x59, 0x31, 0x71, 0x9c,
-    0x36, 0x0e, 0x0b, 0x15, 0x7e, 0x54, 0x1c, 0x1f, 0x1a, 0x15, 0x15, 0x36,
-    0x13, 0x69, 0x49, 0x49, 0x54, 0x64, 0x9b, 0x36, 0x0c, 0x11, 0x12, 0x73,
-    0x49, 0x06, 0x13, 0x81, 0x1d, 0x0c, 0x3d, 0x64, 0x9f, 0x0e, 0x05, 0x02,
-    0x06, 0x93, 0x93, 0x67, 0x92, 0x73, 0x67, 0x29, 0x31, 0x1b, 0x49, 0x05,
-    0x05, 0x05, 0x01, 0x02, 0x03, 0x53, 0x20, 0x5a, 0x1b, 0x14, 0x04, 0x06,
-    0x07, 0x33, 0x42, 0x1b, 0x04, 0x14, 0x0c, 0x46, 0x72, 0x58, 0x3c, 0x10,
-    0x22, 0x1e, 0x04, 0x01, 0x01, 0x03, 0x01, 0x0b, 0x3a, 0x58, 0x62, 0x4f,
-    0x1e, 0x66, 0x46, 0x58, 0x4f, 0x29, 0x1b, 0x1b, 0x1e, 0x33, 0x33, 0x14,
-    0x1e, 0x25, 0x12, 0x06, 0x12, 0x1f, 0x2a, 0x31, 0x31, 0x18, 0x15, 0x06,
-    0x02, 0x01, 0x03, 0x01, 0x01, 0x0b, 0x31, 0x15, 0x05, 0x5e, 0x50, 0x27,
-    0x27, 0x86, 0x78, 0x36, 0x01, 0x05, 0x06, 0x06, 0x0b, 0x36, 0x1f, 0x9b,
-    0x3d, 0x9e, 0x9b, 0x68, 0x8c, 0x0e, 0x61, 0x23, 0x7a, 0x9e, 0x3b, 0x01,
-    0x01, 0x01, 0x05, 0x89, 0x95, 0x89, 0xa8, 0xa3, 0xaf, 0x95, 0x83, 0x6a,
-    0x75, 0x83, 0x6a, 0x61, 0x47, 0x61, 0x5c, 0x5c, 0x77, 0x51, 0xa2, 0xc1,
-    0xa9, 0xb5, 0xb0, 0x59, 0x61, 0x71, 0x9c, 0xb0, 0x8c, 0x94, 0x9b, 0x8c,
-    0x83, 0x94, 0x9a, 0x9c, 0x9a, 0xb7, 0xa7, 0xd3, 0xdb, 0xd4, 0x6d, 0xbe,
-    0xcb, 0xd1, 0xe0, 0xd1, 0xd8, 0xd2, 0xc8, 0xe3, 0xe6, 0xe3, 0xe6, 0xea,
-    0xdb, 0xe8, 0xeb, 0xe4, 0xee, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfb, 0xfb, 0xfd,
-    0xfd, 0xfa, 0xfd, 0xfa, 0xfa, 0xf9, 0xfa, 0xfa, 0xf9, 0xf7, 0xf6, 0xf6,
-    0xf3, 0xf0, 0xf1, 0xf0, 0xf1, 0xee, 0xeb, 0xf0, 0xee, 0xee, 0xeb, 0xe6,
-    0xe6, 0xe6, 0xe3, 0xe2, 0xe2, 0xe2, 0xb8, 0x99, 0x99, 0x8d, 0xa2, 0x9d,
-    0x2d, 0xc1, 0xc1, 0xd9, 0xe6, 0xd9, 0xdf, 0xd0, 0xc9, 0xd2, 0xc0, 0xd3,
-    0xd3, 0xc0, 0x45, 0x11, 0x6e, 0x74, 0xc1, 0xd0, 0xcf, 0xd0, 0xb0, 0xa1,
-    0x2c, 0x77, 0x8d, 0x5f, 0xac, 0x77, 0x54, 0xb1, 0xb1, 0x8d, 0x8c, 0x8c,
-    0x34, 0xa9, 0x8c, 0x8d, 0x5c, 0x94, 0x4b, 0x7e, 0x83, 0x5e, 0x94, 0x5c,
-    0x2d, 0x47, 0x69, 0x55, 0x94, 0x8c, 0x61, 0x3e, 0x13, 0x11, 0x1a, 0x2d,
-    0x77, 0x2b, 0x77, 0x21, 0x0e, 0x1f, 0x0e, 0x1a, 0x3e, 0x0b, 0x1f, 0x69,
-    0x5e, 0x83, 0x49, 0x25, 0x1f, 0x15, 0x15, 0x75, 0x5b, 0x1b, 0x0b, 0x3d,
-    0x0b, 0x05, 0x0b, 0x27, 0x96, 0x2d, 0x06, 0x01, 0x01, 0x86, 0x87, 0x29,
-    0x50, 0x73, 0x67, 0x15, 0x20, 0x31, 0x87, 0x1b, 0x05, 0x01, 0x01, 0x01,
-    0x02, 0x07, 0x06, 0x0b, 0x0d, 0x17, 0x3f, 0x53, 0x42, 0x66, 0x33, 0x06,
-    0x07, 0x1b, 0x58, 0x72, 0x62, 0x4d, 0x58, 0x28, 0x2e, 0x17, 0x04, 0x01,
-    0x01, 0x03, 0x03, 0x05, 0x14, 0x3a, 0x46, 0x4f, 0x33, 0x28, 0x5a, 0x66,
-    0x33, 0x10, 0x18, 0x3f, 0x33, 0x2a, 0x24, 0x31, 0x1b, 0x24, 0x0b, 0x0c,
-    0x0c, 0x14, 0x29, 0x5b, 0x50, 0x25, 0x15, 0x05, 0x04, 0x01, 0x03, 0x01,
-    0x01, 0x3d, 0x6c, 0x12, 0x04, 0x6c, 0x3d, 0x49, 0x12, 0x86, 0xa4, 0x49,
-    0x01, 0x01, 0x05, 0x08, 0x0b, 0x05, 0x75, 0x9b, 0x2d, 0x9b, 0x75, 0x75,
-    0x7a, 0x04, 0x1a, 0x49, 0x89, 0x95, 0x4e, 0x03, 0x01, 0x01, 0x01, 0x89,
-    0x9e, 0x6f, 0x9e, 0xa8, 0xaf, 0x89, 0xaf, 0x47, 0x6a, 0x8c, 0x59, 0x4b,
-    0x59, 0x6a, 0x71, 0x3e, 0x2c, 0x65, 0x98, 0xb7, 0xa9, 0xa9, 0x94, 0x5c,
-    0x7e, 0x3e, 0x55, 0x4b, 0x36, 0x3e, 0x54, 0x5e, 0x3e, 0x71, 0x7a, 0x61,
-    0x85, 0x8d, 0x6e, 0xaa, 0xca, 0xdb, 0xca, 0xca, 0xaa, 0xb7, 0xc6, 0xc8,
-    0xb8, 0xb8, 0xb8, 0xc0, 0xd3, 0xdb, 0xe4, 0xe4, 0xca, 0xdc, 0xe4, 0xeb,
-    0xe4, 0xf8, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
-    0xfa, 0xf9, 0xfa, 0xfa, 0xf9, 0xf9, 0xf7, 0xf6, 0xf3, 0xf3, 0xf0, 0xf0,
-    0xf1, 0xee, 0xf1, 0xf1, 0xee, 0xee, 0xeb, 0xea, 0xe6, 0xe6, 0xe3, 0xe2,
-    0xe2, 0xdd, 0xb2, 0x57, 0x65, 0xc1, 0xb7, 0x9c, 0x85, 0xc1, 0xb7, 0xd1,
-    0xd9, 0xc8, 0xbe, 0xc1, 0xb2, 0xbe, 0xca, 0xa0, 0xa0, 0x45, 0x32, 0x74,
-    0xc6, 0xc1, 0xd7, 0xd7, 0xd0, 0xc9, 0xb5, 0xa5, 0x77, 0x7e, 0xc4, 0x77,
-    0xb0, 0x75, 0x59, 0xa5, 0x94, 0xa5, 0xbf, 0xbf, 0x69, 0x2d, 0x8c, 0xb5,
-    0xa5, 0x61, 0x77, 0x4b, 0x47, 0x83, 0xa9, 0x2d, 0x2c, 0x26, 0x2d, 0x5c,
-    0x83, 0xa1, 0x36, 0x71, 0x5e, 0x5e, 0x83, 0x36, 0x61, 0x54, 0x6a, 0x1c,
-    0x06, 0x1f, 0x23, 0x27, 0x83, 0x36, 0x3e, 0x1f, 0x54, 0x64, 0x2d, 0x1a,
-    0x23, 0x0c, 0x12, 0x5e, 0x6c, 0x3d, 0x54, 0x05, 0x23, 0x1b, 0x0b, 0x0c,
-    0x3d, 0x3d, 0x06, 0x05, 0x03, 0x42, 0x9f, 0x67, 0x24, 0x2d, 0x29, 0x1d,
-    0x35, 0x31, 0x50, 0x42, 0x04, 0x03, 0x01, 0x01, 0x02, 0x05, 0x3f, 0x67,
-    0x5a, 0x72, 0x82, 0x58, 0x4f, 0x28, 0x04, 0x06, 0x04, 0x24, 0x22, 0x24,
-    0x22, 0x17, 0x09, 0x1b, 0x33, 0x2e, 0x06, 0x01, 0x05, 0x03, 0x01, 0x04,
-    0x0c, 0x1e, 0x17, 0x24, 0x24, 0x46, 0x46, 0x42, 0x14, 0x29, 0x33, 0x33,
-    0x24, 0x33, 0x56, 0x42, 0x3f, 0x24, 0x05, 0x1b, 0x31, 0x35, 0x12, 0x42,
-    0x50, 0x23, 0x25, 0x04, 0x05, 0x05, 0x05, 0x03, 0x01, 0x49, 0x54, 0x0b,
-    0x27, 0x76, 0x49, 0x6c, 0x0b, 0x76, 0x8f, 0x54, 0x03, 0x01, 0x01, 0x05,
-    0x0b, 0x26, 0x96, 0xa1, 0x29, 0x83, 0x83, 0x8c, 0x61, 0x0c, 0x4e, 0x95,
-    0x8a, 0x9e, 0x61, 0x05, 0x01, 0x01, 0x01, 0x83, 0x9e, 0x75, 0x83, 0xa8,
-    0xa8, 0x95, 0x95, 0x54, 0x71, 0x8a, 0x61, 0x54, 0x59, 0x85, 0x83, 0x61,
-    0x26, 0x6e, 0x8d, 0x71, 0x77, 0x5c, 0x65, 0x36, 0x3e, 0x54, 0x75, 0x47,
-    0x5e, 0x84, 0x8c, 0x8f, 0x8c, 0xa1, 0xc7, 0xb1, 0xc4, 0xbb, 0x97, 0x88,
-    0xb6, 0xc0, 0xd3, 0xb6, 0x8e, 0x74, 0xa7, 0x99, 0x88, 0xb6, 0xb8, 0xbe,
-    0xd2, 0xdb, 0xdf, 0xdb, 0xdb, 0xdb, 0xe8, 0xe8, 0xeb, 0xfa, 0xfe, 0xff,
-    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd,
-    0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfb, 0xfb, 0xfd, 0xfa, 0xfa, 0xf9,
-    0xf9, 0xf9, 0xf7, 0xf7, 0xf4, 0xf3, 0xf3, 0xf3, 0xf0, 0xf1, 0xf1, 0xf3,
-    0xf1, 0xee, 0xee, 0xeb, 0xea, 0xe6, 0xe6, 0xe3, 0xe2, 0xdf, 0xbe, 0x57,
-    0x74, 0xc1, 0xb2, 0xcf, 0xc7, 0xbf, 0xc9, 0xcb, 0xbe, 0xca, 0xcb, 0xbb,
-    0xd1, 0x99, 0x6d, 0x45, 0x48, 0x79, 0x8b, 0xd1, 0xd6, 0xbb, 0xd7, 0xcf,
-    0xcf, 0xc7, 0xb1, 0xa9, 0xa5, 0x6a, 0x69, 0x71, 0x77, 0x55, 0x94, 0xb0,
-    0xbf, 0xba, 0x94, 0x8c, 0xb1, 0x4b, 0x71, 0xba, 0x85, 0x36, 0x77, 0x77,
-    0x5e, 0x77, 0x76, 0x2d, 0x1f, 0x1f, 0x23, 0x6e, 0x65, 0x71, 0x2c, 0x9c,
-    0x8c, 0xa1, 0xbd, 0x94, 0x1d, 0x26, 0x20, 0x1f, 0x1a, 0x55, 0x3e, 0x55,
-    0x30, 0x36, 0x5c, 0x13, 0x49, 0x5e, 0x23, 0x0c, 0x1f, 0x07, 0x0b, 0x16,
-    0x0f, 0x25, 0x2a, 0x01, 0x15, 0x15, 0x03, 0x01, 0x01, 0x0b, 0x01, 0x05,
-    0x01, 0x0c, 0x67, 0x73, 0x23, 0x0c, 0x01, 0x23, 0x20, 0x2a, 0x12, 0x14,
-    0x01, 0x01, 0x02, 0x02, 0x01, 0x04, 0x2a, 0x5a, 0x29, 0x66, 0x53, 0x42,
-    0x14, 0x04, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02,
-    0x22, 0x46, 0x07, 0x01, 0x05, 0x05, 0x01, 0x04, 0x14, 0x28, 0x1b, 0x4f,
-    0x28, 0x33, 0x1b, 0x14, 0x42, 0x3f, 0x33, 0x50, 0x2a, 0x33, 0x5a, 0x42,
-    0x3f, 0x20, 0x0c, 0x20, 0x67, 0x73, 0x31, 0x0c, 0x2a, 0x23, 0x35, 0x04,
-    0x05, 0x01, 0x05, 0x03, 0x01, 0x12, 0x1b, 0x0b, 0x36, 0x8a, 0x54, 0x54,
-    0x07, 0x4b, 0x76, 0x3e, 0x01, 0x03, 0x02, 0x05, 0x06, 0x1f, 0x7a, 0xa4,
-    0x36, 0x61, 0x7a, 0x95, 0x2d, 0x2c, 0x61, 0x7a, 0x81, 0x95, 0x4e, 0x01,
-    0x01, 0x02, 0x01, 0x7a, 0xa8, 0x9e, 0x59, 0x9e, 0xa8, 0x89, 0x8c, 0x61,
-    0x83, 0x71, 0x9a, 0x6f, 0x4e, 0x61, 0x90, 0x61, 0x36, 0x44, 0x2d, 0x44,
-    0x2d, 0x55, 0x85, 0x71, 0x75, 0x94, 0xae, 0x9b, 0x8f, 0x8c, 0x9b, 0xae,
-    0xa1, 0xb0, 0xa1, 0xa1, 0xb1, 0xa2, 0xb7, 0xcb, 0xbe, 0xaa, 0xdf, 0xdb,
-    0xb6, 0xa0, 0x99, 0xc8, 0xc8, 0xc8, 0xd9, 0xe3, 0xdf, 0xdf, 0xdb, 0xe8,
-    0xee, 0xeb, 0xe8, 0xdc, 0xee, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe,
-    0xfd, 0xfd, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe,
-    0xfd, 0xfd, 0xfd, 0xfb, 0xfd, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf7,
-    0xf6, 0xf4, 0xf3, 0xf3, 0xf1, 0xf0, 0xf3, 0xf0, 0xf1, 0xee, 0xeb, 0xeb,
-    0xea, 0xe6, 0xe6, 0xe3, 0xe2, 0xe2, 0xb8, 0xc0, 0xb8, 0xd0, 0xb1, 0xb2,
-    0xc9, 0xb1, 0xb7, 0xbb, 0xbb, 0xc6, 0xe1, 0xc6, 0xc1, 0x41, 0x5d, 0x8b,
-    0x8b, 0xd3, 0xca, 0xe2, 0xd6, 0xbb, 0xcf, 0xcf, 0xc9, 0xb5, 0xa2, 0xb5,
-    0xb5, 0x8c, 0x1f, 0x2c, 0x26, 0x1f, 0xaf, 0xbd, 0x94, 0x69, 0x55, 0x7a,
-    0xb5, 0xb5, 0x5c, 0x7e, 0x51, 0x71, 0x59, 0x7e, 0x7e, 0x36, 0x23, 0x1c,
-    0x1f, 0x23, 0x3e, 0x51, 0x1a, 0x27, 0x5e, 0xa9, 0x51, 0x6a, 0x7a, 0x3e,
-    0x36, 0x47, 0x4b, 0x13, 0x6a, 0x83, 0x69, 0x2d, 0x5e, 0x1c, 0x54, 0x7a,
-    0x6a, 0x23, 0x15, 0x11, 0x0c, 0x05, 0x03, 0x03, 0x0b, 0x05, 0x06, 0x27,
-    0x01, 0x3d, 0x0b, 0x0b, 0x25, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x0b, 0x0c,
-    0x0b, 0x06, 0x01, 0x0c, 0x07, 0x05, 0x04, 0x12, 0x07, 0x0b, 0x01, 0x01,
-    0x01, 0x01, 0x07, 0x12, 0x06, 0x0c, 0x06, 0x05, 0x01, 0x05, 0x06, 0x0c,
-    0x07, 0x22, 0x22, 0x33, 0x2e, 0x33, 0x1e, 0x2e, 0x33, 0x46, 0x07, 0x01,
-    0x03, 0x04, 0x01, 0x01, 0x0c, 0x3f, 0x1e, 0x1e, 0x28, 0x14, 0x1b, 0x07,
-    0x24, 0x0c, 0x20, 0x2a, 0x24, 0x28, 0x3a, 0x35, 0x2a, 0x0c, 0x24, 0x33,
-    0x4f, 0x2a, 0x50, 0x07, 0x0c, 0x0c, 0x1a, 0x05, 0x05, 0x03, 0x03, 0x01,
-    0x05, 0x1c, 0x15, 0x08, 0x06, 0x1d, 0x54, 0x54, 0x11, 0x1b, 0x7d, 0x2d,
-    0x01, 0x05, 0x01, 0x01, 0x01, 0x76, 0x49, 0x8c, 0x2d, 0x71, 0x5e, 0x75,
-    0x13, 0x3b, 0x8f, 0x7e, 0x7e, 0x9e, 0x6a, 0x01, 0x01, 0x01, 0x01, 0x80,
-    0x9e, 0xa8, 0x80, 0x61, 0x9e, 0x95, 0x95, 0x80, 0x3e, 0x59, 0x9e, 0x94,
-    0x34, 0x4e, 0x77, 0x26, 0x26, 0x6e, 0x85, 0x3e, 0x77, 0x7e, 0x5e, 0x83,
-    0x6a, 0x84, 0x9b, 0xa1, 0xad, 0x83, 0x81, 0x8f, 0x8c, 0xa1, 0x75, 0xb5,
-    0xa8, 0xb5, 0xbf, 0xd8, 0xd8, 0xb8, 0xc0, 0xdb, 0xe4, 0xf0, 0xca, 0xc0,
-    0xe2, 0xd2, 0xdf, 0xe3, 0xe3, 0xe3, 0xe6, 0xe4, 0xdb, 0xd3, 0xe4, 0xeb,
-    0xeb, 0xf0, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe,
-    0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd,
-    0xfd, 0xfd, 0xfd, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf7, 0xf4, 0xf4, 0xf3,
-    0xf0, 0xf3, 0xf3, 0xf1, 0xee, 0xee, 0xeb, 0xeb, 0xea, 0xea, 0xeb, 0xeb,
-    0xee, 0xe3, 0xd8, 0xc8, 0x99, 0xb2, 0x7e, 0x9d, 0xa9, 0xc4, 0xc9, 0xc9,
-    0xc9, 0xc9, 0xc1, 0xc9, 0xd9, 0x57, 0x6d, 0xa0, 0xd3, 0xdb, 0xc0, 0xe3,
-    0xdd, 0xc1, 0xd6, 0xc9, 0xb5, 0xbf, 0xb5, 0xbf, 0x9a, 0xa5, 0x26, 0x26,
-    0x1f, 0x1f, 0xa1, 0xba, 0x47, 0x36, 0x5e, 0xb1, 0xa9, 0xa2, 0x85, 0x26,
-    0x1f, 0x8c, 0xa2, 0x83, 0x85, 0x2c, 0x5c, 0x5e, 0x13, 0x8c, 0x4b, 0x16,
-    0x36, 0x3e, 0x3e, 0x2d, 0x26, 0x23, 0x36, 0x8c, 0x59, 0x77, 0x55, 0x23,
-    0x6a, 0x69, 0x83, 0x6f, 0x27, 0x0b, 0x3e, 0x64, 0x23, 0x0c, 0x05, 0x05,
-    0x06, 0x06, 0x05, 0x01, 0x54, 0x1f, 0x12, 0x36, 0x06, 0x54, 0x23, 0x12,
-    0x49, 0x5b, 0x04, 0x05, 0x01, 0x01, 0x31, 0x54, 0x06, 0x04, 0x0b, 0x03,
-    0x04, 0x49, 0x31, 0x25, 0x50, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01,
-    0x01, 0x05, 0x04, 0x02, 0x10, 0x10, 0x4f, 0x28, 0x4f, 0x58, 0x4d, 0x28,
-    0x58, 0x28, 0x58, 0x66, 0x4d, 0x4d, 0x14, 0x01, 0x03, 0x03, 0x01, 0x01,
-    0x04, 0x29, 0x4f, 0x1e, 0x4f, 0x2a, 0x14, 0x28, 0x35, 0x17, 0x28, 0x29,
-    0x1e, 0x70, 0x67, 0x2a, 0x1e, 0x0c, 0x0c, 0x1e, 0x3f, 0x42, 0x23, 0x50,
-    0x35, 0x04, 0x0c, 0x03, 0x01, 0x01, 0x03, 0x02, 0x03, 0x3e, 0x25, 0x04,
-    0x27, 0x31, 0x14, 0x2d, 0x11, 0x1d, 0xa4, 0x23, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x64, 0x59, 0x75, 0x4e, 0x5e, 0x2c, 0x61, 0x0e, 0x54, 0x6a, 0x3d,
-    0x43, 0x68, 0x49, 0x03, 0x01, 0x01, 0x01, 0x75, 0x9e, 0xa8, 0x95, 0x6f,
-    0x9e, 0x9e, 0x95, 0x90, 0x1f, 0x5e, 0x9a, 0x75, 0x3e, 0x7e, 0x61, 0x12,
-    0x61, 0x4b, 0x90, 0x8d, 0x5c, 0xa5, 0x83, 0x83, 0x8c, 0x7e, 0x7a, 0x94,
-    0xab, 0xa1, 0xae, 0x9b, 0x6c, 0x84, 0xab, 0x8c, 0x9c, 0xbf, 0xbf, 0xd1,
-    0xc8, 0xd1, 0xc0, 0xd3, 0xe4, 0xb6, 0xe5, 0xa0, 0xdd, 0xe3, 0xc8, 0xdf,
-    0xe6, 0xe6, 0xea, 0xeb, 0xeb, 0xe4, 0xe4, 0xeb, 0xeb, 0xe9, 0xfd, 0xfe,
-    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd,
-    0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfb, 0xfa, 0xfd, 0xfd,
-    0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xf7, 0xf6, 0xf3, 0xf3, 0xf1, 0xf0, 0xf1,
-    0xee, 0xee, 0xee, 0xef, 0xe4, 0xe4, 0xf3, 0xf4, 0xf0, 0xdb, 0xc8, 0xa7,
-    0xa7, 0xc8, 0xc6, 0xc1, 0xbf, 0xcf, 0xcf, 0xd1, 0xd1, 0xc9, 0xc9, 0xd8,
-    0xe6, 0xca, 0xd3, 0xd3, 0xee, 0xe4, 0xd2, 0xe3, 0xe3, 0xd1, 0xb7, 0xbb,
-    0xc7, 0xba, 0xb5, 0xd0, 0x4b, 0x2c, 0x2d, 0x16, 0x5e, 0x36, 0xaf, 0xbc,
-    0x9e, 0xb5, 0xaf, 0x49, 0xa1, 0xa9, 0xb5, 0x61, 0x1f, 0x9a, 0x54, 0x6a,
-    0x69, 0x36, 0x34, 0x71, 0x1f, 0x61, 0x34, 0x1a, 0x5e, 0x6a, 0x1f, 0x5c,
-    0x2d, 0x47, 0xa1, 0x9c, 0x7a, 0x54, 0x27, 0x3e, 0x1f, 0x6c, 0x83, 0x3e,
-    0x6a, 0x0b, 0x0c, 0x1f, 0x05, 0x04, 0x5e, 0x4e, 0x1f, 0x1f, 0x0b, 0x01,
-    0x81, 0x75, 0x3d, 0x6c, 0x06, 0x06, 0x13, 0x15, 0x0a, 0x23, 0x12, 0x01,
-    0x01, 0x05, 0x2b, 0x33, 0x3d, 0x15, 0x01, 0x06, 0x35, 0x1e, 0x18, 0x1b,
-    0x2a, 0x0c, 0x01, 0x01, 0x02, 0x00, 0x01, 0x0b, 0x29, 0x28, 0x1b, 0x0c,
-    0x5a, 0x1b, 0x4d, 0x72, 0x3a, 0x66, 0x66, 0x33, 0x22, 0x58, 0x62, 0x1e,
-    0x4f, 0x33, 0x22, 0x01, 0x03, 0x01, 0x01, 0x01, 0x0c, 0x22, 0x33, 0x24,
-    0x17, 0x24, 0x5a, 0x4f, 0x24, 0x53, 0x33, 0x5a, 0x42, 0x2a, 0x67, 0x42,
-    0x42, 0x24, 0x0c, 0x29, 0x24, 0x18, 0x14, 0x3f, 0x5b, 0x2d, 0x03, 0x03,
-    0x01, 0x01, 0x01, 0x03, 0x05, 0x7d, 0x23, 0x0b, 0x3d, 0x3e, 0x49, 0x1c,
-    0x0a, 0x1c, 0x6f, 0x20, 0x05, 0x05, 0x05, 0x05, 0x05, 0x81, 0x7a, 0x47,
-    0x75, 0x1f, 0x3d, 0x4e, 0x0e, 0x61, 0x3d, 0x61, 0x61, 0x6f, 0x59, 0x03,
-    0x01, 0x01, 0x01, 0x29, 0x80, 0x90, 0x7a, 0x9e, 0x75, 0x9e, 0x75, 0x83,
-    0x4b, 0x1d, 0x55, 0x61, 0x77, 0x6a, 0x1f, 0x6e, 0x9c, 0x77, 0x7a, 0x7a,
-    0x9c, 0x69, 0x83, 0x71, 0x8d, 0x54, 0x9a, 0x83, 0xa1, 0x6f, 0x7a, 0x84,
-    0x8a, 0x7a, 0x84, 0x9c, 0x8c, 0xaf, 0xba, 0xbb, 0xc1, 0xd8, 0xdd, 0xc8,
-    0xd3, 0xe4, 0xd4, 0xd4, 0xbe, 0xe3, 0xe3, 0xd9, 0xd9, 0xe4, 0xea, 0xeb,
-    0xe6, 0xee, 0xe8, 0xee, 0xee, 0xe9, 0xf7, 0xff, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfd,
-    0xfe, 0xfd, 0xfd, 0xfb, 0xfb, 0xfd, 0xfb, 0xfb, 0xfa, 0xfa, 0xfa, 0xfa,
-    0xf9, 0xf7, 0xf6, 0xf3, 0xf3, 0xf1, 0xf1, 0xee, 0xee, 0xee, 0xeb, 0xdb,
-    0xd3, 0xa0, 0xdc, 0xe9, 0xf0, 0xf1, 0xeb, 0xe6, 0xd9, 0xbb, 0xb2, 0xc6,
-    0xc9, 0xd1, 0xd1, 0xea, 0xd2, 0xc6, 0xcb, 0xea, 0xe6, 0xe8, 0xdb, 0xe8,
-    0xef, 0x79, 0xdc, 0xdb, 0xe3, 0xe3, 0xb8, 0x8d, 0xcc, 0xbf, 0xc4, 0xc4,
-    0xa6, 0x55, 0x57, 0x3e, 0x71, 0x49, 0xa8, 0xb5, 0xba, 0xba, 0x9a, 0x27,
-    0xb7, 0xaf, 0xa9, 0x9a, 0x61, 0x5c, 0x76, 0x3e, 0x4b, 0x6a, 0x2d, 0x0b,
-    0x16, 0x3e, 0x1a, 0x34, 0x9c, 0x47, 0x1f, 0x3e, 0x34, 0x49, 0x83, 0x77,
-    0x36, 0x2d, 0x69, 0x27, 0x0e, 0x6f, 0x83, 0x6c, 0x5e, 0x26, 0x03, 0x05,
-    0x13, 0x18, 0x6c, 0x7a, 0x26, 0x0c, 0x11, 0x03, 0x49, 0x8f, 0x20, 0x36,
-    0x06, 0x03, 0x05, 0x03, 0x05, 0x0c, 0x0b, 0x05, 0x01, 0x05, 0x07, 0x86,
-    0x7d, 0x07, 0x24, 0x08, 0x06, 0x2d, 0x09, 0x05, 0x01, 0x01, 0x01, 0x02,
-    0x01, 0x01, 0x01, 0x01, 0x14, 0x23, 0x10, 0x28, 0x3a, 0x58, 0x66, 0x3a,
-    0x63, 0x52, 0x72, 0x4d, 0x46, 0x17, 0x04, 0x01, 0x09, 0x33, 0x1e, 0x01,
-    0x04, 0x01, 0x03, 0x01, 0x07, 0x2a, 0x3f, 0x09, 0x1b, 0x42, 0x62, 0x2a,
-    0x33, 0x28, 0x5a, 0x53, 0x72, 0x42, 0x24, 0x50, 0x2a, 0x3f, 0x33, 0x7b,
-    0x7b, 0x3d, 0x50, 0x73, 0x5b, 0x24, 0x07, 0x05, 0x05, 0x01, 0x01, 0x02,
-    0x06, 0x50, 0x07, 0x15, 0x23, 0x49, 0x73, 0x75, 0x27, 0x0e, 0x64, 0x27,
-    0x01, 0x05, 0x01, 0x05, 0x0b, 0x8f, 0x8a, 0x6f, 0x83, 0x2d, 0x59, 0x49,
-    0x0b, 0x61, 0x8f, 0x80, 0x8f, 0x7a, 0x2d, 0x05, 0x01, 0x01, 0x01, 0x71,
-    0x68, 0x77, 0x7a, 0xa8, 0x6c, 0x8c, 0x7e, 0x75, 0x94, 0x30, 0x34, 0x7a,
-    0x55, 0x0c, 0x5c, 0x61, 0x9e, 0x9a, 0x7e, 0x7a, 0x83, 0xa5, 0xb5, 0x94,
-    0x85, 0x2d, 0x6a, 0x6a, 0x75, 0x8c, 0x6a, 0x76, 0x84, 0x8f, 0xa1, 0x7a,
-    0x8f, 0xb5, 0xa5, 0xb1, 0xc1, 0xd1, 0xdd, 0xd2, 0xd3, 0xe4, 0xf0, 0xf0,
-    0xb6, 0xc8, 0xe2, 0xe6, 0xe3, 0xca, 0xdb, 0xe4, 0xeb, 0xee, 0xee, 0xeb,
-    0xf1, 0xf3, 0xf0, 0xfc, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfd, 0xfd,
-    0xfb, 0xfb, 0xfb, 0xfd, 0xfd, 0xfd, 0xfa, 0xfa, 0xfa, 0xf9, 0xf7, 0xf3,
-    0xf3, 0xf3, 0xf1, 0xf1, 0xee, 0xee, 0xf0, 0xf4, 0xe4, 0xee, 0xf1, 0xf3,
-    0xf3, 0xf0, 0xee, 0xeb, 0xe2, 0xbe, 0xd1, 0xc1, 0xd0, 0xe2, 0xea, 0xe6,
-    0xc0, 0xd9, 0xe3, 0xe8, 0xe4, 0xe8, 0xe4, 0xee, 0xeb, 0x6d, 0xd3, 0xdb,
-    0xdb, 0xe3, 0xd9, 0x44, 0xb5, 0xba, 0xba, 0xbf, 0xc1, 0x8d, 0x9c, 0x77,
-    0x36, 0x71, 0xa8, 0xa1, 0xa1, 0xa8, 0x9b, 0x89, 0x85, 0xab, 0xb1, 0x85,
-    0xb5, 0x2b, 0x51, 0x51, 0x77, 0x5e, 0x2c, 0x16, 0x15, 0x1f, 0x5c, 0x54,
-    0x2c, 0x12, 0x0b, 0x41, 0x54, 0xaf, 0xaf, 0x8c, 0x83, 0x7a, 0x54, 0x36,
-    0x1f, 0x36, 0x6a, 0x69, 0x13, 0x0c, 0x1f, 0x0b, 0x6a, 0x75, 0x6f, 0x83,
-    0x23, 0x1f, 0x18, 0x08, 0x13, 0x4e, 0x64, 0x8a, 0x49, 0x6f, 0x20, 0x1d,
-    0x0b, 0x05, 0x05, 0x03, 0x01, 0x03, 0x12, 0x73, 0x07, 0x5b, 0x67, 0x05,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x35, 0x01, 0x05, 0x01, 0x01, 0x01,
-    0x06, 0x03, 0x63, 0x24, 0x63, 0x72, 0x46, 0x58, 0x4d, 0x4d, 0x4f, 0x10,
-    0x04, 0x10, 0x06, 0x28, 0x04, 0x07, 0x14, 0x04, 0x03, 0x01, 0x01, 0x01,
-    0x01, 0x33, 0x09, 0x25, 0x2e, 0x3a, 0x58, 0x46, 0x53, 0x33, 0x4c, 0x66,
-    0x33, 0x35, 0x42, 0x2a, 0x23, 0x50, 0x33, 0x66, 0x67, 0x31, 0x66, 0x5a,
-    0x67, 0x67, 0x2a, 0x05, 0x05, 0x01, 0x05, 0x05, 0x0b, 0x31, 0x04, 0x3d,
-    0x3d, 0x27, 0x6c, 0x8a, 0x8a, 0x0b, 0x8a, 0x16, 0x01, 0x03, 0x01, 0x06,
-    0x0c, 0x8a, 0x83, 0x43, 0x8f, 0x36, 0x6a, 0x23, 0x0f, 0x94, 0x6f, 0x8f,
-    0x80, 0xa8, 0x3d, 0x03, 0x03, 0x01, 0x01, 0x5e, 0x83, 0x4e, 0x80, 0x9e,
-    0x80, 0x6f, 0x8c, 0x6a, 0x8f, 0x59, 0x34, 0x7a, 0x0c, 0x4b, 0x51, 0x75,
-    0x6a, 0x94, 0x83, 0x6c, 0x7e, 0x8c, 0x9a, 0x8c, 0x7a, 0x5e, 0xa8, 0x9c,
-    0x83, 0x83, 0x54, 0x7a, 0xa1, 0xab, 0xa1, 0xa1, 0x9b, 0x77, 0x71, 0xbf,
-    0xd1, 0xd2, 0xd9, 0xca, 0xe3, 0xdb, 0xe8, 0xee, 0xbe, 0xc8, 0xd9, 0xe6,
-    0xea, 0xea, 0xeb, 0xee, 0xee, 0xeb, 0xf1, 0xf2, 0xeb, 0xf0, 0xf3, 0xfd,
-    0xfe, 0xed, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfb, 0xfb, 0xfd,
-    0xfd, 0xfd, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf7, 0xf3, 0xf3, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf3, 0xf0, 0xf1, 0xef, 0xea, 0xea, 0xee, 0xf1, 0xee, 0xea,
-    0xe6, 0xe2, 0xd1, 0xd1, 0xd6, 0xdd, 0xdb, 0xaa, 0x45, 0xca, 0xee, 0xeb,
-    0xe8, 0xf1, 0xdb, 0xe8, 0xa0, 0x5d, 0xdb, 0xd3, 0xe4, 0xc0, 0x7f, 0x57,
-    0x4b, 0x61, 0xc9, 0xc9, 0xb1, 0xa5, 0x2d, 0x5e, 0x1f, 0x36, 0xaf, 0xba,
-    0xb0, 0x9e, 0xb0, 0x7e, 0x9a, 0xa8, 0xa2, 0x47, 0x9a, 0x65, 0x2b, 0x71,
-    0xba, 0x77, 0x2c, 0x1f, 0x1f, 0x36, 0x61, 0x83, 0x55, 0x1a, 0x2d, 0x1a,
-    0x13, 0x1b, 0x1a, 0x0b, 0x2c, 0x27, 0x0e, 0x0b, 0x0e, 0x0c, 0x0b, 0x05,
-    0x36, 0x8a, 0x71, 0x0b, 0x6f, 0xa1, 0x78, 0x6c, 0x54, 0x0c, 0x5e, 0x3d,
-    0x0b, 0x64, 0x96, 0x96, 0x64, 0x96, 0x96, 0x6c, 0x15, 0x06, 0x05, 0x05,
-    0x01, 0x01, 0x06, 0x01, 0x0b, 0x12, 0x01, 0x02, 0x01, 0x1b, 0x31, 0x15,
-    0x18, 0x25, 0x50, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x04, 0x35, 0x46, 0x2a,
-    0x58, 0x72, 0x28, 0x62, 0x4d, 0x14, 0x04, 0x14, 0x17, 0x14, 0x1e, 0x72,
-    0x06, 0x05, 0x04, 0x06, 0x03, 0x01, 0x01, 0x01, 0x02, 0x1e, 0x14, 0x3a,
-    0x46, 0x58, 0x58, 0x66, 0x4f, 0x5a, 0x3a, 0x53, 0x20, 0x24, 0x24, 0x50,
-    0x31, 0x2a, 0x50, 0x53, 0x42, 0x42, 0x7b, 0x73, 0x73, 0x67, 0x14, 0x03,
-    0x05, 0x03, 0x01, 0x01, 0x0b, 0x54, 0x05, 0x54, 0x86, 0x3d, 0x3e, 0x7d,
-    0x96, 0x07, 0x6c, 0x0b, 0x01, 0x03, 0x01, 0x06, 0x07, 0x59, 0x8c, 0x59,
-    0x61, 0x27, 0x3d, 0x0e, 0x54, 0x75, 0x2d, 0x61, 0x9e, 0xa3, 0x36, 0x05,
-    0x01, 0x02, 0x01, 0x3b, 0x75, 0x71, 0x61, 0x9e, 0x89, 0x89, 0x59, 0x85,
-    0x89, 0x6a, 0x12, 0x26, 0x2c, 0x54, 0x71, 0x85, 0x94, 0x7a, 0x83, 0x6a,
-    0x8d, 0x6a, 0x9b, 0xaf, 0x8c, 0x4b, 0xa1, 0x83, 0x75, 0x6a, 0x6a, 0x75,
-    0x92, 0xa4, 0x8c, 0xae, 0x8f, 0x6e, 0x61, 0xb1, 0xbb, 0xbe, 0xe4, 0xc8,
-    0xd8, 0xe2, 0xd2, 0xc8, 0xc8, 0xc8, 0xc8, 0xd2, 0xe3, 0xe6, 0xe6, 0xef,
-    0xef, 0xeb, 0xee, 0xee, 0xf1, 0xe9, 0xf0, 0xf7, 0xff, 0xf8, 0xf5, 0xfe,
-    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfb, 0xfb, 0xfb, 0xfb, 0xfd, 0xfa,
-    0xfa, 0xfa, 0xf7, 0xf6, 0xf4, 0xf3, 0xf3, 0xf1, 0xf1, 0xf1, 0xf2, 0xee,
-    0xef, 0xea, 0xe6, 0xea, 0xea, 0xf1, 0xea, 0xea, 0xea, 0xea, 0xd2, 0xd9,
-    0xb8, 0xb6, 0x41, 0x32, 0x37, 0xa0, 0xe8, 0xe8, 0xf1, 0xe5, 0xa0, 0x8b,
-    0x79, 0xa0, 0xe4, 0xd3, 0xdf, 0xdb, 0x41, 0x1f, 0x4b, 0x74, 0xcf, 0xbf,
-    0x77, 0x5f, 0x61, 0x5e, 0x1a, 0x34, 0x83, 0xbc, 0xbd, 0xb5, 0xb0, 0xaf,
-    0xb5, 0xc4, 0xb5, 0x94, 0x9a, 0xa2, 0x83, 0x2d, 0x6a, 0x15, 0x2c, 0x44,
-    0x4b, 0x94, 0x71, 0x9a, 0x59, 0x5e, 0x3e, 0x1f, 0x83, 0xaf, 0x3e, 0x55,
-    0x16, 0x23, 0x26, 0x11, 0x0b, 0x12, 0x01, 0x26, 0x5e, 0x8a, 0x8f, 0x0c,
-    0x61, 0x9b, 0xae, 0x83, 0x6f, 0x1a, 0x23, 0x81, 0x01, 0x73, 0x96, 0x96,
-    0x86, 0x54, 0x96, 0x78, 0x5b, 0x12, 0x03, 0x03, 0x01, 0x02, 0x01, 0x06,
-    0x06, 0x0b, 0x12, 0x67, 0x18, 0x67, 0x25, 0x1b, 0x50, 0x12, 0x01, 0x4f,
-    0x01, 0x02, 0x01, 0x01, 0x03, 0x5b, 0x1e, 0x24, 0x33, 0x3a, 0x24, 0x1b,
-    0x07, 0x2a, 0x58, 0x33, 0x22, 0x07, 0x46, 0x4d, 0x10, 0x06, 0x02, 0x04,
-    0x04, 0x01, 0x01, 0x02, 0x01, 0x07, 0x4f, 0x66, 0x3f, 0x3f, 0x33, 0x5a,
-    0x66, 0x66, 0x5a, 0x24, 0x42, 0x2a, 0x1e, 0x42, 0x33, 0x50, 0x42, 0x42,
-    0x2a, 0x33, 0x87, 0x7b, 0x5a, 0x54, 0x0c, 0x01, 0x01, 0x03, 0x03, 0x01,
-    0x0b, 0x1f, 0x06, 0x73, 0x96, 0x50, 0x2b, 0x69, 0x9b, 0x1b, 0x23, 0x06,
-    0x01, 0x01, 0x01, 0x08, 0x1a, 0x76, 0x6a, 0x68, 0x1f, 0x27, 0x83, 0x13,
-    0x4e, 0x68, 0x8a, 0x9e, 0x95, 0x9e, 0x27, 0x03, 0x01, 0x01, 0x01, 0x51,
-    0x75, 0x43, 0x7e, 0x6f, 0x9b, 0x47, 0x71, 0x8c, 0x80, 0x36, 0x1c, 0x77,
-    0x6a, 0x6a, 0x7e, 0x8c, 0x8c, 0x8c, 0x83, 0x77, 0x6a, 0x8d, 0x77, 0xa8,
-    0x9c, 0x55, 0x71, 0x7a, 0x7a, 0x69, 0x69, 0x6c, 0xa4, 0xbc, 0x83, 0x83,
-    0x7a, 0xa1, 0xb1, 0x7f, 0x9d, 0xd2, 0xe4, 0xe3, 0xc6, 0xd7, 0xdd, 0xc6,
-    0xe2, 0xc8, 0xe6, 0xa0, 0xb6, 0xe3, 0xea, 0xea, 0xe4, 0xe4, 0xeb, 0xeb,
-    0xeb, 0xee, 0xee, 0xf0, 0xfe, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xfd, 0xfd, 0xfd, 0xfb, 0xfb, 0xfb, 0xfd, 0xfd, 0xfa, 0xfa, 0xf9, 0xf6,
-    0xf6, 0xf3, 0xf2, 0xf1, 0xf1, 0xf1, 0xee, 0xef, 0xea, 0xea, 0xe6, 0xe6,
-    0xee, 0xf2, 0xeb, 0xea, 0xf1, 0xf3, 0xe9, 0xc0, 0x7c, 0x5d, 0x7c, 0x48,
-    0x32, 0x5d, 0xdb, 0xf1, 0xf1, 0xc0, 0xca, 0x8b, 0xe4, 0xeb, 0xeb, 0xd2,
-    0xdb, 0xd2, 0xb6, 0x44, 0x97, 0xa5, 0xba, 0x51, 0x3e, 0x2d, 0x23, 0x9c,
-    0x26, 0x69, 0x6a, 0xa2, 0xba, 0xb5, 0xb5, 0x9c, 0x54, 0xc4, 0x71, 0x90,
-    0x71, 0x8d, 0x9a, 0x2d, 0x44, 0x16, 0x2d, 0x94, 0x77, 0x77, 0x65, 0x23,
-    0x2d, 0x77, 0x77, 0x59, 0xa1, 0x9b, 0x1f, 0x2d, 0x54, 0x51, 0x27, 0x06,
-    0x03, 0x15, 0x11, 0x5e, 0x83, 0x6f, 0x3d, 0x16, 0x61, 0x8a, 0x8a, 0x54,
-    0x1a, 0x54, 0x0b, 0x49, 0x01, 0x1d, 0x68, 0x78, 0x31, 0x31, 0x54, 0x5e,
-    0x3d, 0x20, 0x05, 0x01, 0x01, 0x01, 0x01, 0x26, 0x2d, 0x29, 0x1d, 0x50,
-    0x42, 0x49, 0x12, 0x0c, 0x29, 0x14, 0x06, 0x4c, 0x0b, 0x02, 0x01, 0x01,
-    0x01, 0x03, 0x33, 0x53, 0x33, 0x24, 0x07, 0x22, 0x66, 0x62, 0x24, 0x28,
-    0x10, 0x2e, 0x62, 0x2e, 0x33, 0x10, 0x07, 0x05, 0x04, 0x03, 0x01, 0x01,
-    0x01, 0x07, 0x46, 0x4f, 0x5a, 0x17, 0x24, 0x3f, 0x5a, 0x66, 0x42, 0x14,
-    0x2a, 0x42, 0x2a, 0x3f, 0x2a, 0x4f, 0x7b, 0x33, 0x0c, 0x35, 0x70, 0x64,
-    0x56, 0x27, 0x06, 0x01, 0x03, 0x05, 0x03, 0x03, 0x05, 0x05, 0x14, 0x73,
-    0x86, 0x3d, 0x5e, 0x31, 0x78, 0x49, 0x0b, 0x03, 0x01, 0x01, 0x05, 0x05,
-    0x15, 0x9b, 0x3d, 0x71, 0x13, 0x83, 0x7a, 0x0b, 0x4e, 0x95, 0x9b, 0x9e,
-    0x95, 0x95, 0x1f, 0x05, 0x01, 0x01, 0x01, 0x2d, 0x7a, 0x61, 0x59, 0x6a,
-    0x75, 0x3e, 0xa1, 0x89, 0x4e, 0x1f, 0x61, 0x61, 0x8c, 0x7e, 0x83, 0x7e,
-    0x6a, 0x7e, 0x83, 0x7e, 0x85, 0x77, 0x94, 0x75, 0x83, 0x4b, 0x5e, 0x69,
-    0x61, 0x69, 0x6a, 0x54, 0xa4, 0xa1, 0x7a, 0x71, 0x75, 0xa9, 0xbf, 0xa2,
-    0xa7, 0xd9, 0xdf, 0xeb, 0xd2, 0xd1, 0xb7, 0xd1, 0xd9, 0xd9, 0xdf, 0xc0,
-    0x99, 0xdb, 0xea, 0xe8, 0xe4, 0xe4, 0xeb, 0xef, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf3, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfd,
-    0xfd, 0xfd, 0xfd, 0xfd, 0xfb, 0xfa, 0xf9, 0xf9, 0xf6, 0xf3, 0xf3, 0xf1,
-    0xf1, 0xee, 0xef, 0xef, 0xea, 0xea, 0xea, 0xea, 0xf1, 0xf3, 0xf2, 0xf2,
-    0xf6, 0xed, 0xc0, 0xd3, 0xca, 0x6d, 0xdc, 0x48, 0x48, 0x8e, 0xf2, 0xf2,
-    0xdc, 0xa0, 0xf2, 0xca, 0xeb, 0xe6, 0xca, 0xca, 0xdf, 0xe6, 0xb8, 0xb7,
-    0xbb, 0x61, 0x5c, 0x2d, 0x41, 0x2d, 0x36, 0xb5, 0x1f, 0x54, 0x55, 0x7a,
-    0xbc, 0xc2, 0xbd, 0x71, 0x26, 0x9a, 0x94, 0x71, 0x26, 0x47, 0x54, 0x26,
-    0x08, 0x36, 0x94, 0x51, 0x2d, 0x2d, 0x2c, 0x16, 0x15, 0x77, 0x49, 0x90,
-    0x8c, 0x71, 0x3e, 0x3d, 0x8c, 0x6a, 0x27, 0x0b, 0x1c, 0x4b, 0x3e, 0x8c,
-    0x83, 0x6a, 0x1f, 0x3e, 0x43, 0x64, 0x49, 0x49, 0x0b, 0x15, 0x0b, 0x0b,
-    0x08, 0x01, 0x3d, 0x8a, 0x3e, 0x15, 0x0f, 0x06, 0x05, 0x06, 0x12, 0x01,
-    0x03, 0x05, 0x05, 0x04, 0x73, 0x3d, 0x20, 0x13, 0x50, 0x42, 0x20, 0x12,
-    0x13, 0x10, 0x29, 0x07, 0x04, 0x05, 0x03, 0x01, 0x01, 0x04, 0x2a, 0x46,
-    0x07, 0x07, 0x4f, 0x72, 0x62, 0x28, 0x24, 0x07, 0x24, 0x62, 0x62, 0x46,
-    0x3c, 0x1e, 0x28, 0x06, 0x06, 0x03, 0x01, 0x01, 0x04, 0x04, 0x3a, 0x53,
-    0x3f, 0x22, 0x33, 0x24, 0x2a, 0x33, 0x1e, 0x2a, 0x35, 0x42, 0x3f, 0x3f,
-    0x67, 0x42, 0x7b, 0x31, 0x1d, 0x3f, 0x73, 0x67, 0x25, 0x15, 0x06, 0x05,
-    0x04, 0x05, 0x05, 0x01, 0x01, 0x01, 0x2a, 0x6c, 0x54, 0x3d, 0x54, 0x2d,
-    0x54, 0x5e, 0x0c, 0x03, 0x01, 0x01, 0x05, 0x05, 0x1c, 0x7a, 0x5e, 0x2d,
-    0x59, 0xa1, 0x51, 0x06, 0x75, 0x9e, 0x95, 0xa8, 0x9e, 0x95, 0x13, 0x05,
-    0x01, 0x01, 0x01, 0x1f, 0x7a, 0x8c, 0x7a, 0x89, 0xa2, 0x77, 0x8a, 0x3b,
-    0x0f, 0x5c, 0x3e, 0x61, 0x9e, 0x9c, 0x71, 0x71, 0x59, 0x5e, 0x71, 0x5e,
-    0x94, 0x5c, 0x7a, 0x94, 0x69, 0x6a, 0x36, 0x3e, 0x94, 0x6a, 0x61, 0x61,
-    0x7a, 0x8a, 0x83, 0x8c, 0x7a, 0x94, 0xb1, 0xa2, 0xc6, 0xc8, 0xca, 0xd3,
-    0xeb, 0xe8, 0xc0, 0xeb, 0xdb, 0xdb, 0xd3, 0xd2, 0xdb, 0xdb, 0xdf, 0xe8,
-    0xef, 0xef, 0xeb, 0xee, 0xee, 0xf1, 0xf1, 0xeb, 0xe9, 0xfa, 0xff, 0xfe,
-    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd,
-    0xfa, 0xfa, 0xf9, 0xf9, 0xf6, 0xf4, 0xf3, 0xf1, 0xf1, 0xee, 0xee, 0xea,
-    0xea, 0xea, 0xea, 0xea, 0xf1, 0xf3, 0xf6, 0xf4, 0xe5, 0xd4, 0x5d, 0xb6,
-    0xdc, 0x5d, 0xe9, 0x5d, 0xa0, 0xb6, 0xf3, 0xf2, 0xd4, 0x5d, 0xe9, 0xe4,
-    0xef, 0xe4, 0xaa, 0xaa, 0xdf, 0xe6, 0xc8, 0xcb, 0x94, 0x4b, 0x55, 0x51,
-    0x1f, 0x16, 0x54, 0xb0, 0x1f, 0x16, 0x94, 0x69, 0x94, 0x9b, 0xa1, 0x9b,
-    0x94, 0x77, 0xa8, 0x3b, 0x4b, 0x1f, 0x27, 0x51, 0x15, 0x2c, 0x8c, 0x26,
-    0x1f, 0x4b, 0x0b, 0x0c, 0x59, 0x59, 0x75, 0xae, 0x90, 0x9b, 0x9e, 0xa8,
-    0x77, 0x1f, 0x54, 0x27, 0x26, 0x15, 0x13, 0x5e, 0x13, 0x0c, 0x1d, 0x76,
-    0x9b, 0xae, 0x8a, 0xa1, 0x23, 0x13, 0x3d, 0x0b, 0x06, 0x03, 0x0b, 0x1a,
-    0x04, 0x04, 0x01, 0x13, 0x13, 0x1c, 0x07, 0x05, 0x03, 0x05, 0x01, 0x06,
-    0x92, 0x2a, 0x0c, 0x06, 0x13, 0x1b, 0x05, 0x14, 0x0b, 0x14, 0x53, 0x0c,
-    0x05, 0x01, 0x01, 0x01, 0x05, 0x07, 0x0b, 0x14, 0x28, 0x58, 0x72, 0x66,
-    0x28, 0x2e, 0x1e, 0x3a, 0x28, 0x58, 0x62, 0x28, 0x4d, 0x22, 0x58, 0x10,
-    0x06, 0x03, 0x01, 0x05, 0x02, 0x01, 0x17, 0x1e, 0x46, 0x3f, 0x3f, 0x1b,
-    0x1b, 0x2a, 0x35, 0x67, 0x2a, 0x33, 0x42, 0x46, 0x42, 0x42, 0x29, 0x31,
-    0x29, 0x20, 0x42, 0x67, 0x35, 0x31, 0x06, 0x05, 0x03, 0x01, 0x05, 0x01,
-    0x01, 0x01, 0x49, 0x7d, 0x36, 0x54, 0x49, 0x54, 0x3d, 0x64, 0x36, 0x03,
-    0x01, 0x01, 0x05, 0x03, 0x15, 0x68, 0x83, 0x23, 0x6a, 0x83, 0x0c, 0x26,
-    0x54, 0x8c, 0x9e, 0x9b, 0xa8, 0x83, 0x05, 0x05, 0x01, 0x02, 0x01, 0x2d,
-    0x6a, 0x7a, 0x89, 0x89, 0xa8, 0x61, 0x7e, 0x26, 0x36, 0x61, 0x51, 0x77,
-    0xaf, 0x8c, 0x7a, 0x7e, 0x7e, 0x6a, 0x55, 0x55, 0x77, 0x5e, 0x6e, 0x71,
-    0x54, 0x4b, 0x3e, 0x26, 0x3e, 0x4b, 0x6a, 0x77, 0x76, 0x9b, 0x92, 0xb0,
-    0xa1, 0x83, 0x8d, 0xac, 0xc1, 0xa7, 0xd9, 0xd3, 0xeb, 0xe5, 0xd4, 0xe5,
-    0xed, 0xe5, 0xdc, 0xeb, 0xe8, 0xdb, 0xdb, 0xe4, 0xe4, 0xef, 0xef, 0xeb,
-    0xee, 0xf1, 0xf1, 0xe4, 0xee, 0xf3, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xfe, 0xfe, 0xfd, 0xfe, 0xfd, 0xfe, 0xfd, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9,
-    0xf6, 0xf4, 0xf3, 0xf2, 0xf1, 0xee, 0xee, 0xea, 0xec, 0xef, 0xeb, 0xef,
-    0xef, 0xf1, 0xf3, 0xf6, 0xd4, 0x8e, 0x6d, 0x8e, 0xf0, 0xd4, 0xf1, 0xc0,
-    0xe9, 0xe5, 0xf3, 0xe9, 0x8e, 0x37, 0xca, 0xe8, 0xee, 0xe4, 0xb6, 0x79,
-    0xc8, 0xd9, 0xd8, 0xc1, 0x3e, 0x36, 0x77, 0x2c, 0x0e, 0x16, 0x71, 0x94,
-    0x15, 0x26, 0xaf, 0x94, 0x9a, 0xab, 0x8c, 0x7a, 0x8c, 0x47, 0x44, 0x1a,
-    0x3e, 0x4b, 0x51, 0x3e, 0x1f, 0x26, 0x1c, 0x0b, 0x2d, 0x9c, 0x23, 0x2c,
-    0x9c, 0x8c, 0x7a, 0xb5, 0x8c, 0x8f, 0x90, 0x49, 0x36, 0x1f, 0x5e, 0x26,
-    0x06, 0x0b, 0x59, 0x86, 0x4e, 0x6a, 0x69, 0x3e, 0x4b, 0x75, 0x9b, 0x67,
-    0x1f, 0x36, 0x7a, 0x15, 0x02, 0x01, 0x0c, 0x05, 0x06, 0x0b, 0x36, 0x2d,
-    0x07, 0x0b, 0x2d, 0x31, 0x04, 0x0b, 0x05, 0x05, 0x50, 0x49, 0x0c, 0x1a,
-    0x0c, 0x06, 0x06, 0x27, 0x0c, 0x14, 0x67, 0x31, 0x0c, 0x1c, 0x01, 0x0b,
-    0x01, 0x01, 0x02, 0x5a, 0x63, 0x46, 0x4d, 0x33, 0x22, 0x24, 0x2e, 0x62,
-    0x3c, 0x3c, 0x2e, 0x3c, 0x3a, 0x46, 0x2f, 0x28, 0x06, 0x03, 0x01, 0x04,
-    0x01, 0x01, 0x14, 0x3f, 0x3f, 0x1e, 0x46, 0x14, 0x24, 0x24, 0x42, 0x53,
-    0x2a, 0x33, 0x1b, 0x33, 0x2a, 0x42, 0x2a, 0x18, 0x0c, 0x15, 0x07, 0x35,
-    0x3d, 0x42, 0x04, 0x02, 0x03, 0x03, 0x05, 0x03, 0x05, 0x01, 0x6f, 0x86,
-    0x76, 0x5b, 0x64, 0x4b, 0x54, 0x68, 0x5b, 0x05, 0x03, 0x02, 0x01, 0x05,
-    0x0e, 0x68, 0x8f, 0x1d, 0x5e, 0x26, 0x06, 0x8c, 0x7a, 0x75, 0xa3, 0x9b,
-    0x9e, 0x61, 0x03, 0x03, 0x01, 0x01, 0x0b, 0x75, 0x71, 0x75, 0x75, 0x8c,
-    0xa8, 0x3e, 0x5c, 0x0b, 0x5c, 0x47, 0x55, 0x77, 0x7e, 0x83, 0x61, 0x7e,
-    0x8d, 0x51, 0x3e, 0x77, 0x55, 0x51, 0x71, 0x7e, 0x5c, 0x69, 0x77, 0x83,
-    0x5e, 0x61, 0x7a, 0x9b, 0x8a, 0x8c, 0x8c, 0x9b, 0x8a, 0xab, 0x94, 0xa5,
-    0xa9, 0xa7, 0xb8, 0xd9, 0xd3, 0xd4, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe5,
-    0xf5, 0xe5, 0xeb, 0xdb, 0xeb, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xeb, 0xeb,
-    0xf1, 0xf1, 0xf7, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xfe, 0xfd, 0xfd, 0xfa, 0xfa, 0xf9, 0xf9, 0xf6, 0xf6, 0xf6, 0xf3, 0xf2,
-    0xf1, 0xee, 0xee, 0xef, 0xef, 0xf1, 0xf1, 0xf1, 0xf1, 0xef, 0xf2, 0xe5,
-    0xa0, 0x5d, 0x37, 0xe5, 0xf2, 0xf3, 0xf2, 0xee, 0xf3, 0xf1, 0xf3, 0xdc,
-    0x5d, 0x8e, 0xdb, 0xee, 0xef, 0xeb, 0xc0, 0x79, 0x99, 0xd1, 0xa6, 0xb7,
-    0x6e, 0x26, 0x2c, 0x1f, 0x16, 0x1a, 0x71, 0x3e, 0x11, 0x2c, 0xb5, 0xb4,
-    0x8c, 0xc2, 0xaf, 0x9b, 0x77, 0x11, 0x1f, 0x0b, 0x34, 0x15, 0x1f, 0x26,
-    0x0e, 0x26, 0x1f, 0x1c, 0x59, 0x8c, 0x27, 0x1f, 0x77, 0xba, 0x94, 0x83,
-    0x69, 0x54, 0x13, 0x55, 0x4e, 0x1f, 0x1a, 0x0e, 0x13, 0x83, 0xae, 0x9b,
-    0x13, 0x3e, 0x23, 0x83, 0x23, 0x07, 0x59, 0x3d, 0x1f, 0x06, 0x07, 0x1a,
-    0x1c, 0x01, 0x0b, 0x1a, 0x1c, 0x0f, 0x3d, 0x07, 0x49, 0x73, 0x31, 0x49,
-    0x0e, 0x0b, 0x05, 0x04, 0x23, 0x25, 0x06, 0x3d, 0x0e, 0x06, 0x0c, 0x0c,
-    0x0c, 0x3d, 0x67, 0x4f, 0x53, 0x10, 0x04, 0x03, 0x01, 0x02, 0x01, 0x4f,
-    0x58, 0x2a, 0x42, 0x3f, 0x24, 0x1b, 0x62, 0x62, 0x62, 0x46, 0x1e, 0x62,
-    0x62, 0x4d, 0x14, 0x28, 0x10, 0x04, 0x05, 0x03, 0x01, 0x01, 0x0c, 0x1e,
-    0x33, 0x12, 0x1e, 0x24, 0x31, 0x46, 0x5a, 0x33, 0x10, 0x2a, 0x53, 0x33,
-    0x31, 0x33, 0x20, 0x0c, 0x12, 0x13, 0x5b, 0x35, 0x29, 0x5b, 0x01, 0x0a,
-    0x05, 0x04, 0x06, 0x03, 0x11, 0x01, 0x86, 0x86, 0x92, 0x61, 0x6c, 0x5e,
-    0x3d, 0x2d, 0x36, 0x04, 0x03, 0x01, 0x05, 0x05, 0x1f, 0x7a, 0x7a, 0x1f,
-    0x2d, 0x08, 0x35, 0x9b, 0x6f, 0x75, 0x8f, 0x9e, 0x95, 0x1b, 0x05, 0x03,
-    0x03, 0x05, 0x1f, 0x9e, 0x7a, 0x9e, 0x83, 0x80, 0x71, 0x36, 0x06, 0x26,
-    0x34, 0x23, 0x3e, 0x34, 0x5c, 0x77, 0x85, 0x7e, 0x4e, 0x2d, 0x36, 0x5e,
-    0x51, 0x65, 0x4b, 0x77, 0x71, 0x71, 0x54, 0x6a, 0x5e, 0x83, 0x76, 0xa5,
-    0xb5, 0x7a, 0x9c, 0x9c, 0x8f, 0x7a, 0x7a, 0xa1, 0x9a, 0xc9, 0xa7, 0xd9,
-    0xe4, 0xe9, 0xf3, 0xf9, 0xed, 0xed, 0xed, 0xd4, 0xf9, 0xed, 0xf1, 0xe8,
-    0xeb, 0xef, 0xef, 0xeb, 0xe4, 0xee, 0xee, 0xee, 0xf1, 0xf1, 0xf1, 0xfb,
-    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff,
-    0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfd, 0xfb, 0xfa,
-    0xf9, 0xf6, 0xf6, 0xf9, 0xf9, 0xf6, 0xf3, 0xf3, 0xf1, 0xef, 0xef, 0xef,
-    0xef, 0xf1, 0xf2, 0xf3, 0xf3, 0xf1, 0xe8, 0x8e, 0x5d, 0xa0, 0x21, 0xc0,
-    0xf2, 0xf1, 0xf1, 0xf2, 0xf0, 0xf2, 0xdc, 0xa0, 0x6d, 0xdc, 0xe4, 0xf1,
-    0xef, 0xeb, 0x79, 0x57, 0x34, 0x6e, 0x9d, 0x77, 0x3e, 0x85, 0x1a, 0x15,
-    0x41, 0x44, 0x2c, 0x2c, 0x26, 0x7a, 0xb0, 0xbd, 0xb5, 0x83, 0xaf, 0xaf,
-    0x26, 0x13, 0x0e, 0x11, 0x15, 0x0b, 0x0b, 0x0e, 0x05, 0x0b, 0x11, 0x1c,
-    0x8d, 0x8c, 0x71, 0x3e, 0x2d, 0x54, 0x2d, 0x2c, 0x0b, 0x0e, 0x21, 0x16,
-    0x4b, 0x23, 0x3e, 0x15, 0x68, 0x96, 0xa8, 0x8f, 0x7a, 0x2d, 0x16, 0x2d,
-    0x8a, 0x6a, 0x06, 0x06, 0x05, 0x26, 0x7a, 0x54, 0x49, 0x15, 0x05, 0x25,
-    0x2d, 0x0f, 0x0b, 0x50, 0x96, 0x96, 0x0c, 0x18, 0x0f, 0x05, 0x0b, 0x05,
-    0x06, 0x05, 0x06, 0x42, 0x06, 0x0c, 0x04, 0x05, 0x04, 0x23, 0x2a, 0x17,
-    0x67, 0x04, 0x01, 0x01, 0x01, 0x0a, 0x01, 0x14, 0x72, 0x1b, 0x22, 0x46,
-    0x07, 0x2e, 0x72, 0x66, 0x52, 0x33, 0x28, 0x62, 0x60, 0x58, 0x22, 0x28,
-    0x28, 0x04, 0x04, 0x04, 0x04, 0x01, 0x01, 0x2a, 0x28, 0x14, 0x1b, 0x1e,
-    0x22, 0x33, 0x53, 0x33, 0x20, 0x46, 0x31, 0x1b, 0x5a, 0x42, 0x1b, 0x20,
-    0x35, 0x24, 0x67, 0x3f, 0x2a, 0x14, 0x01, 0x01, 0x01, 0x05, 0x01, 0x03,
-    0x05, 0x01, 0x81, 0x75, 0x73, 0x3d, 0x27, 0x12, 0x0b, 0x0e, 0x08, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x1a, 0x7a, 0x8c, 0x51, 0x47, 0x1f, 0x75, 0x9e,
-    0x75, 0x7a, 0x71, 0xa3, 0x9e, 0x05, 0x05, 0x01, 0x05, 0x05, 0x47, 0xa8,
-    0x7a, 0x9b, 0x71, 0x90, 0x61, 0x0c, 0x3e, 0x71, 0x25, 0x1f, 0x2c, 0x1f,
-    0x26, 0x2c, 0x59, 0x9c, 0x9a, 0x85, 0x65, 0x85, 0x77, 0x9c, 0x44, 0x26,
-    0x26, 0x54, 0x4b, 0x5c, 0x74, 0x84, 0xab, 0x6a, 0x64, 0xab, 0xb0, 0xba,
-    0xab, 0x75, 0x94, 0xa2, 0xaf, 0xcb, 0xc8, 0xd2, 0xe4, 0xee, 0xe9, 0xdc,
-    0xed, 0xed, 0xed, 0xd4, 0xed, 0xf5, 0xf4, 0xee, 0xe4, 0xee, 0xeb, 0xeb,
-    0xeb, 0xf1, 0xeb, 0xee, 0xf1, 0xf1, 0xf1, 0xf3, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd,
-    0xfa, 0xfa, 0xfb, 0xfe, 0xfe, 0xfd, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf6, 0xf6, 0xf2, 0xee, 0xee, 0xef, 0xef, 0xef, 0xee, 0xef, 0xf1,
-    0xf3, 0xeb, 0x79, 0x7c, 0xc0, 0xd4, 0xe5, 0xb6, 0xf2, 0xf1, 0xef, 0xd3,
-    0x6d, 0xa0, 0x7c, 0xf2, 0xca, 0xeb, 0xe4, 0xee, 0xee, 0xeb, 0x8b, 0x32,
-    0x34, 0x26, 0x9d, 0xaf, 0x6c, 0x5c, 0x1c, 0x20, 0x85, 0x5c, 0x2d, 0x36,
-    0x7f, 0xbc, 0x8c, 0xb5, 0xba, 0xb5, 0x1d, 0xa9, 0xa9, 0x69, 0x1f, 0x0e,
-    0x0e, 0x11, 0x16, 0x0e, 0x16, 0x15, 0x44, 0x36, 0x0b, 0x1a, 0x4b, 0x25,
-    0x69, 0x61, 0x27, 0x04, 0x1f, 0x23, 0x1f, 0x0e, 0x27, 0x61, 0xae, 0x8c,
-    0xb4, 0x8f, 0xae, 0xa3, 0x83, 0x13, 0x11, 0x23, 0x54, 0x0c, 0x01, 0x15,
-    0x69, 0x5b, 0x54, 0x14, 0x23, 0x31, 0x08, 0x1f, 0x0b, 0x29, 0x13, 0x23,
-    0x4e, 0x7d, 0x20, 0x0f, 0x06, 0x05, 0x05, 0x01, 0x05, 0x03, 0x1b, 0x31,
-    0x05, 0x0c, 0x06, 0x04, 0x04, 0x42, 0x2a, 0x7b, 0x14, 0x01, 0x06, 0x07,
-    0x02, 0x01, 0x01, 0x01, 0x33, 0x17, 0x58, 0x28, 0x3a, 0x4d, 0x22, 0x58,
-    0x62, 0x1e, 0x4d, 0x52, 0x4d, 0x4d, 0x07, 0x3f, 0x28, 0x05, 0x03, 0x01,
-    0x04, 0x01, 0x01, 0x2a, 0x58, 0x46, 0x1e, 0x50, 0x33, 0x66, 0x66, 0x46,
-    0x42, 0x2a, 0x58, 0x50, 0x1e, 0x29, 0x27, 0x13, 0x14, 0x31, 0x29, 0x35,
-    0x14, 0x15, 0x01, 0x01, 0x03, 0x05, 0x01, 0x02, 0x08, 0x03, 0x35, 0x35,
-    0x1b, 0x05, 0x23, 0x2d, 0x86, 0x3d, 0x27, 0x05, 0x08, 0x05, 0x05, 0x01,
-    0x1a, 0x8f, 0x75, 0x54, 0x0c, 0x75, 0x96, 0x8c, 0x75, 0x9b, 0x94, 0x8c,
-    0x75, 0x05, 0x05, 0x01, 0x05, 0x03, 0x54, 0x68, 0x85, 0x83, 0x75, 0x61,
-    0x16, 0x2c, 0x77, 0x36, 0x44, 0x1a, 0x71, 0x6a, 0x85, 0x2d, 0x8d, 0xa9,
-    0x9a, 0x71, 0x94, 0x71, 0x84, 0x9c, 0xb5, 0x9c, 0x54, 0x7e, 0x6e, 0x8c,
-    0x71, 0x69, 0x76, 0x94, 0xa1, 0x9c, 0x94, 0x77, 0x83, 0x8c, 0x84, 0xab,
-    0xb7, 0xb7, 0xcb, 0xbe, 0xe4, 0xef, 0xf1, 0xf0, 0xed, 0xe5, 0xed, 0xed,
-    0xdc, 0xd4, 0xf7, 0xf1, 0xeb, 0xe4, 0xe8, 0xeb, 0xe4, 0xe8, 0xeb, 0xee,
-    0xf1, 0xf1, 0xf1, 0xf0, 0xf3, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfd, 0xfa, 0xfa, 0xfb, 0xfe,
-    0xfe, 0xfd, 0xfb, 0xfa, 0xfa, 0xfa, 0xf9, 0xf6, 0xf9, 0xf6, 0xf6, 0xf1,
-    0xef, 0xef, 0xec, 0xec, 0xea, 0xea, 0xea, 0xd3, 0x8b, 0x79, 0x45, 0x6b,
-    0xeb, 0xe5, 0xca, 0xef, 0xee, 0xef, 0xec, 0xaa, 0x48, 0x6d, 0x7c, 0xf2,
-    0xf1, 0xeb, 0xeb, 0xeb, 0xe8, 0xca, 0x5d, 0x41, 0x41, 0x16, 0x8d, 0xa9,
-    0xab, 0xab, 0x2d, 0xb0, 0xc4, 0xba, 0xaf, 0xb5, 0x94, 0x94, 0x83, 0x69,
-    0x77, 0x4b, 0x36, 0x59, 0x9a, 0x61, 0x26, 0x23, 0x1a, 0x34, 0x26, 0x11,
-    0x1a, 0x15, 0x13, 0x26, 0x05, 0x61, 0x26, 0x08, 0x0e, 0x11, 0x13, 0x1f,
-    0x4b, 0x3e, 0x0e, 0x0b, 0x2c, 0x2d, 0x8c, 0xa1, 0xae, 0x8f, 0x8f, 0xae,
-    0x36, 0x1c, 0x1a, 0x0b, 0x1a, 0x05, 0x2d, 0x1a, 0x27, 0x18, 0x1a, 0x0f,
-    0x27, 0x78, 0x04, 0x06, 0x14, 0x54, 0x5b, 0x75, 0x14, 0x23, 0x76, 0x05,
-    0x06, 0x0b, 0x03, 0x05, 0x04, 0x06, 0x13, 0x12, 0x07, 0x0b, 0x0c, 0x23,
-    0x4c, 0x24, 0x24, 0x0c, 0x01, 0x15, 0x0c, 0x06, 0x05, 0x01, 0x03, 0x01,
-    0x24, 0x66, 0x62, 0x17, 0x53, 0x72, 0x40, 0x4d, 0x62, 0x10, 0x4f, 0x28,
-    0x1e, 0x33, 0x07, 0x33, 0x09, 0x07, 0x04, 0x01, 0x04, 0x01, 0x01, 0x1e,
-    0x4f, 0x4f, 0x46, 0x28, 0x33, 0x50, 0x5a, 0x72, 0x1e, 0x4c, 0x33, 0x3f,
-    0x42, 0x20, 0x1b, 0x1d, 0x25, 0x12, 0x31, 0x2a, 0x67, 0x0b, 0x01, 0x01,
-    0x05, 0x03, 0x01, 0x01, 0x0b, 0x01, 0x06, 0x0f, 0x2d, 0x36, 0x7d, 0x86,
-    0x7d, 0x49, 0x1f, 0x04, 0x0b, 0x01, 0x01, 0x05, 0x1c, 0xa4, 0x6a, 0x2c,
-    0x0c, 0x7a, 0x9b, 0x75, 0x86, 0x8c, 0x9b, 0x8c, 0x4b, 0x03, 0x05, 0x05,
-    0x01, 0x06, 0x6a, 0x75, 0x8a, 0x89, 0x6a, 0x2c, 0x16, 0x26, 0x18, 0x5c,
-    0x4b, 0x2c, 0x71, 0x7a, 0x90, 0x71, 0x85, 0x9b, 0x61, 0x5e, 0x6a, 0x5f,
-    0x6e, 0xa9, 0xa2, 0xa9, 0x69, 0x9c, 0x7e, 0x85, 0x51, 0x6e, 0xac, 0x84,
-    0x71, 0x7a, 0x61, 0x75, 0x8c, 0x77, 0x3e, 0x94, 0x98, 0xbf, 0xbb, 0xc8,
-    0xc0, 0xe4, 0xe4, 0xe4, 0xdc, 0xd4, 0xf4, 0xf7, 0xd4, 0xdc, 0xed, 0xf4,
-    0xe5, 0xca, 0xdb, 0xe4, 0xe4, 0xeb, 0xeb, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf3, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff,
-    0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd,
-    0xfb, 0xfa, 0xf9, 0xf6, 0xf9, 0xf6, 0xf1, 0xf1, 0xee, 0xef, 0xec, 0xea,
-    0xea, 0xea, 0xec, 0xa0, 0x5d, 0x79, 0x8b, 0x6d, 0xe6, 0xc0, 0xd3, 0xec,
-    0xea, 0xe7, 0xe7, 0xe3, 0x79, 0xd4, 0xf0, 0xf2, 0xee, 0xe8, 0xef, 0xe4,
-    0xa0, 0x6b, 0x6d, 0x41, 0x34, 0x2c, 0x74, 0x5c, 0x94, 0x4b, 0x8f, 0xc2,
-    0xbd, 0xbf, 0xb0, 0xb4, 0xc2, 0xbc, 0xbf, 0x59, 0x3e, 0x71, 0x7a, 0x94,
-    0x94, 0x5f, 0x3b, 0xa6, 0x54, 0x85, 0x47, 0x3e, 0x1f, 0x7e, 0x1f, 0x1f,
-    0x08, 0x0f, 0x16, 0x0b, 0x06, 0x3e, 0x3e, 0x3e, 0x8c, 0x07, 0x1a, 0x34,
-    0x26, 0x1a, 0x7a, 0xb4, 0x9e, 0xa4, 0xb4, 0x3d, 0x1f, 0x0b, 0x1d, 0x23,
-    0x23, 0x0f, 0x2d, 0x2c, 0x0b, 0x0b, 0x13, 0x1a, 0x3b, 0x64, 0x03, 0x06,
-    0x9b, 0x23, 0x81, 0x96, 0x31, 0x0c, 0x1a, 0x0c, 0x04, 0x03, 0x05, 0x04,
-    0x05, 0x13, 0x0f, 0x13, 0x0b, 0x0c, 0x14, 0x07, 0x1c, 0x01, 0x01, 0x03,
-    0x2a, 0x14, 0x07, 0x04, 0x03, 0x01, 0x06, 0x07, 0x14, 0x4d, 0x2a, 0x20,
-    0x62, 0x72, 0x72, 0x46, 0x14, 0x28, 0x28, 0x17, 0x10, 0x17, 0x10, 0x1b,
-    0x14, 0x14, 0x05, 0x01, 0x03, 0x01, 0x01, 0x07, 0x1e, 0x3f, 0x3a, 0x46,
-    0x33, 0x42, 0x42, 0x28, 0x46, 0x66, 0x31, 0x3f, 0x46, 0x4c, 0x1d, 0x1c,
-    0x1b, 0x0c, 0x25, 0x7b, 0x67, 0x14, 0x01, 0x01, 0x04, 0x04, 0x05, 0x01,
-    0x21, 0x01, 0x12, 0x6c, 0x64, 0x64, 0x96, 0x8a, 0x5b, 0x76, 0x1f, 0x04,
-    0x06, 0x03, 0x01, 0x08, 0x15, 0x9b, 0x59, 0x06, 0x23, 0x7a, 0x8a, 0x7a,
-    0x75, 0x6f, 0x75, 0x8f, 0x13, 0x01, 0x03, 0x05, 0x03, 0x20, 0x6a, 0x8c,
-    0x83, 0x5e, 0x1f, 0x16, 0x26, 0x54, 0x51, 0x6a, 0x61, 0x3e, 0x90, 0x89,
-    0x94, 0x8c, 0x6a, 0xaf, 0x9a, 0x8d, 0x3e, 0x51, 0x94, 0xb5, 0x9a, 0xb5,
-    0x85, 0x9c, 0x71, 0x36, 0x5f, 0x36, 0x71, 0x83, 0xb0, 0x9c, 0xb5, 0x9c,
-    0x7a, 0x7e, 0x71, 0x61, 0xa9, 0xc4, 0xc6, 0xd8, 0xc0, 0xd9, 0xd3, 0xd3,
-    0xca, 0xd3, 0xe5, 0xf0, 0xed, 0xd4, 0xd4, 0xed, 0xe9, 0xe8, 0xe4, 0xe8,
-    0xeb, 0xee, 0xef, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf3, 0xfd,
-    0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
-    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfa, 0xf9, 0xf6, 0xfa,
-    0xf6, 0xf2, 0xef, 0xf1, 0xee, 0xec, 0xec, 0xea, 0xe7, 0xea, 0xef, 0xb6,
-    0xca, 0xc0, 0xe3, 0x99, 0xd2, 0xc0, 0xb6, 0xea, 0xe7, 0xda, 0xe0, 0xe7,
-    0xdb, 0xd4, 0xe9, 0xde, 0xc0, 0xdb, 0xeb, 0xdb, 0xd3, 0xb6, 0x57, 0x7f,
-    0x41, 0x6b, 0x2d, 0x1a, 0x55, 0x76, 0x9c, 0xab, 0x7a, 0xaf, 0xb0, 0xc2,
-    0xb5, 0xbd, 0xb5, 0xaf, 0xb5, 0xbd, 0xaf, 0x94, 0x7e, 0x1c, 0x16, 0x1f,
-    0x4b, 0x83, 0x5e, 0x4b, 0x1f, 0x71, 0x36, 0x06, 0x13, 0x0b, 0x08, 0x0e,
-    0x4b, 0x30, 0x0e, 0x34, 0x43, 0x2d, 0x54, 0x3e, 0x5e, 0x30, 0xa1, 0xb4,
-    0xad, 0xa4, 0x9b, 0x1f, 0x13, 0x64, 0x6a, 0x8f, 0x75, 0x26, 0x0c, 0x0b,
-    0x0b, 0x27, 0x1d, 0x3d, 0x4e, 0x1a, 0x1a, 0x01, 0x8f, 0x30, 0x87, 0x96,
-    0x7a, 0x0b, 0x07, 0x0a, 0x0c, 0x0c, 0x05, 0x05, 0x06, 0x15, 0x0c, 0x2d,
-    0x06, 0x25, 0x64, 0x07, 0x01, 0x15, 0x12, 0x14, 0x7b, 0x1b, 0x1b, 0x0c,
-    0x04, 0x03, 0x04, 0x04, 0x0b, 0x33, 0x0d, 0x3a, 0x72, 0x62, 0x72, 0x3a,
-    0x1e, 0x17, 0x10, 0x58, 0x10, 0x14, 0x09, 0x14, 0x1e, 0x22, 0x04, 0x01,
-    0x03, 0x04, 0x01, 0x01, 0x06, 0x33, 0x33, 0x46, 0x3f, 0x33, 0x14, 0x3f,
-    0x63, 0x3f, 0x2a, 0x4f, 0x24, 0x35, 0x2a, 0x12, 0x1a, 0x1b, 0x20, 0x23,
-    0x3d, 0x0b, 0x01, 0x01, 0x05, 0x0b, 0x06, 0x05, 0x20, 0x05, 0x20, 0x73,
-    0x73, 0x7d, 0x73, 0x75, 0x49, 0x6c, 0x2d, 0x02, 0x06, 0x01, 0x01, 0x05,
-    0x0e, 0x8a, 0x54, 0x04, 0x61, 0x61, 0x7a, 0x61, 0x3d, 0x94, 0x83, 0x6a,
-    0x08, 0x01, 0x05, 0x03, 0x01, 0x77, 0x71, 0x71, 0x3e, 0x0f, 0x1f, 0x26,
-    0x59, 0xa8, 0x59, 0x5c, 0x36, 0x54, 0x71, 0x8d, 0x83, 0x9c, 0x77, 0x7e,
-    0x8d, 0x83, 0x47, 0x8d, 0x9c, 0x9c, 0x8c, 0xa5, 0x6a, 0x77, 0x77, 0x55,
-    0xb0, 0x8c, 0x8c, 0x85, 0xab, 0x7e, 0x83, 0xa1, 0xac, 0x8c, 0x8c, 0x94,
-    0xab, 0xa2, 0xac, 0xbe, 0xbe, 0xb6, 0xaa, 0xc0, 0xca, 0xe4, 0xe8, 0xf2,
-    0xf4, 0xdc, 0xe5, 0xed, 0xf4, 0xdb, 0xe4, 0xe8, 0xee, 0xe6, 0xef, 0xef,
-    0xef, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xfa, 0xfe, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xfa, 0xf6, 0xf2, 0xf1, 0xef, 0xef,
-    0xef, 0xec, 0xec, 0xea, 0xe7, 0xea, 0xec, 0xe9, 0xee, 0xe7, 0xe2, 0xe2,
-    0xbe, 0x79, 0xc0, 0xe2, 0xe0, 0xda, 0xda, 0xdd, 0xca, 0xc0, 0xca, 0x79,
-    0x32, 0xb6, 0xc8, 0xdf, 0xe7, 0x99, 0x2c, 0xa0, 0x55, 0x55, 0x26, 0x51,
-    0x8c, 0xa1, 0xc2, 0x54, 0x5e, 0x9b, 0xa8, 0xbd, 0xab, 0x9a, 0xa1, 0x83,
-    0x5e, 0x77, 0x2d, 0x36, 0x26, 0x16, 0x2d, 0x7e, 0x2c, 0x36, 0x85, 0x5c,
-    0x1f, 0x34, 0x15, 0x0b, 0x21, 0x0c, 0x08, 0x1a, 0x55, 0x6a, 0x27, 0x59,
-    0xaf, 0x6a, 0x36, 0x1c, 0x3e, 0x54, 0x59, 0x9b, 0x8c, 0x75, 0x27, 0x26,
-    0x9b, 0x8a, 0x8f, 0x78, 0x54, 0x5e, 0x06, 0x0b, 0x0e, 0x8a, 0x4e, 0x23,
-    0x1d, 0x8f, 0x81, 0x02, 0x3d, 0x81, 0x50, 0x96, 0x78, 0x42, 0x49, 0x13,
-    0x31, 0x50, 0x05, 0x05, 0x05, 0x05, 0x06, 0x15, 0x1d, 0x35, 0x35, 0x06,
-    0x04, 0x0c, 0x24, 0x2a, 0x4f, 0x67, 0x2a, 0x29, 0x04, 0x04, 0x06, 0x01,
-    0x04, 0x01, 0x06, 0x28, 0x72, 0x58, 0x46, 0x28, 0x33, 0x17, 0x3a, 0x62,
-    0x2e, 0x14, 0x14, 0x3c, 0x58, 0x2e, 0x04, 0x03, 0x03, 0x03, 0x01, 0x01,
-    0x0c, 0x28, 0x33, 0x14, 0x4f, 0x3f, 0x12, 0x33, 0x31, 0x1e, 0x2a, 0x31,
-    0x24, 0x2a, 0x2a, 0x35, 0x42, 0x33, 0x2a, 0x18, 0x0c, 0x05, 0x01, 0x01,
-    0x04, 0x05, 0x01, 0x05, 0x49, 0x05, 0x23, 0x8a, 0x73, 0x7d, 0x73, 0x75,
-    0x69, 0x6c, 0x49, 0x04, 0x05, 0x01, 0x01, 0x01, 0x0b, 0x61, 0x1b, 0x06,
-    0x84, 0x5e, 0x9b, 0x49, 0x7a, 0x8f, 0x7a, 0x3e, 0x05, 0x03, 0x05, 0x05,
-    0x05, 0x9e, 0x8c, 0x2d, 0x1a, 0x47, 0x5e, 0x36, 0x8c, 0xa1, 0x2c, 0x55,
-    0x36, 0x5c, 0x8c, 0x7e, 0x6a, 0x6a, 0x71, 0x55, 0x55, 0x55, 0x4b, 0x6a,
-    0x7e, 0x8d, 0x8d, 0x83, 0x71, 0x5e, 0x97, 0x97, 0xb1, 0x9b, 0x9c, 0x77,
-    0x61, 0x8c, 0x83, 0xa9, 0x8c, 0x75, 0x94, 0x94, 0xb1, 0x8c, 0xb5, 0xd1,
-    0xbe, 0xd2, 0xd2, 0xd9, 0xd9, 0xe6, 0xe3, 0xeb, 0xf0, 0xe5, 0xd3, 0xdc,
-    0xe9, 0xdb, 0xe4, 0xe8, 0xef, 0xeb, 0xeb, 0xee, 0xee, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
-    0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xfa, 0xf9, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1, 0xee, 0xec, 0xec, 0xea, 0xea,
-    0xe7, 0xe7, 0xe7, 0xec, 0xea, 0xe7, 0xe1, 0xdd, 0x99, 0x99, 0xaa, 0xe1,
-    0xe0, 0xda, 0xda, 0xdd, 0xdf, 0xca, 0xe4, 0xa0, 0xb6, 0xd2, 0xc8, 0xdd,
-    0xbe, 0x97, 0x41, 0x5f, 0xa7, 0xb7, 0x71, 0x9c, 0xbd, 0xc2, 0xc2, 0xa8,
-    0x54, 0xbd, 0xa1, 0xba, 0x71, 0x36, 0x61, 0x1f, 0x16, 0x1a, 0x11, 0x26,
-    0x11, 0x71, 0x94, 0x8c, 0x65, 0x5c, 0x61, 0x59, 0x1a, 0x0b, 0x23, 0x34,
-    0x0b, 0x1a, 0x26, 0x0b, 0x26, 0x36, 0x4b, 0x9b, 0x94, 0x1c, 0x15, 0x0e,
-    0x69, 0x59, 0x3e, 0x25, 0x23, 0x43, 0x71, 0x76, 0x9e, 0x78, 0xa4, 0x68,
-    0x3e, 0x0e, 0x1f, 0x36, 0x49, 0x68, 0x0c, 0x1f, 0x5b, 0x8f, 0x81, 0x06,
-    0x1b, 0x76, 0x18, 0x68, 0x96, 0xa4, 0x75, 0x50, 0x2d, 0x2a, 0x1d, 0x05,
-    0x05, 0x01, 0x03, 0x27, 0x42, 0x12, 0x06, 0x31, 0x0c, 0x0c, 0x10, 0x29,
-    0x67, 0x7b, 0x24, 0x2a, 0x0b, 0x01, 0x05, 0x03, 0x03, 0x03, 0x06, 0x17,
-    0x72, 0x66, 0x28, 0x58, 0x22, 0x4d, 0x52, 0x62, 0x52, 0x17, 0x17, 0x58,
-    0x4d, 0x3c, 0x04, 0x03, 0x04, 0x01, 0x01, 0x01, 0x1e, 0x33, 0x4f, 0x17,
-    0x72, 0x3f, 0x3f, 0x33, 0x5a, 0x33, 0x33, 0x31, 0x3f, 0x42, 0x50, 0x33,
-    0x5a, 0x31, 0x67, 0x29, 0x06, 0x03, 0x03, 0x01, 0x04, 0x05, 0x02, 0x06,
-    0x7d, 0x0b, 0x14, 0x8a, 0x86, 0x73, 0x8a, 0x3d, 0x2d, 0x64, 0x3d, 0x04,
-    0x03, 0x03, 0x03, 0x05, 0x05, 0x16, 0x08, 0x3e, 0x8f, 0x59, 0x61, 0x7a,
-    0x9b, 0x9b, 0x8c, 0x1c, 0x05, 0x05, 0x05, 0x05, 0x1f, 0x9e, 0x75, 0x0b,
-    0x4b, 0xa8, 0x27, 0x77, 0x95, 0xa2, 0x6a, 0x83, 0x71, 0x47, 0x8c, 0x9c,
-    0x6a, 0x98, 0x6a, 0x7e, 0x71, 0x4b, 0x6a, 0x85, 0xa9, 0x9c, 0x9c, 0x74,
-    0x77, 0x8d, 0xa5, 0x6a, 0x8d, 0x8d, 0x9c, 0x8d, 0x8d, 0xbf, 0x9c, 0xa5,
-    0x85, 0x8d, 0xab, 0x75, 0x7e, 0x69, 0x9a, 0x97, 0xb8, 0xd2, 0xd2, 0xd3,
-    0xd3, 0xd9, 0xdf, 0xe6, 0xe8, 0xe8, 0xca, 0xdb, 0xe5, 0xee, 0xe6, 0xe4,
-    0xee, 0xee, 0xeb, 0xf1, 0xee, 0xef, 0xef, 0xef, 0xef, 0xeb, 0xef, 0xf1,
-    0xf1, 0xf1, 0xf3, 0xf6, 0xfb, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfa, 0xf6, 0xf2, 0xf1, 0xf2,
-    0xf1, 0xf1, 0xf1, 0xec, 0xec, 0xec, 0xec, 0xea, 0xea, 0xe7, 0xe7, 0xea,
-    0xea, 0xea, 0xe7, 0xbe, 0x79, 0x8b, 0xb8, 0xdd, 0xda, 0xda, 0xd7, 0xd7,
-    0xe0, 0xd2, 0xca, 0x6b, 0x99, 0xe7, 0xe0, 0xda, 0x8d, 0xc9, 0xb1, 0x65,
-    0x74, 0xb7, 0xbf, 0xb4, 0xc2, 0xc2, 0xc2, 0xc2, 0xae, 0xbd, 0xb0, 0x83,
-    0x71, 0x2c, 0x65, 0x13, 0x26, 0x36, 0x4b, 0x8d, 0x3e, 0x98, 0x71, 0x59,
-    0x36, 0x1a, 0x26, 0x0c, 0x0b, 0x3e, 0x85, 0x5c, 0x12, 0x5e, 0x83, 0x11,
-    0x16, 0x36, 0x36, 0x61, 0x49, 0x06, 0x1a, 0x0c, 0x5e, 0x59, 0x12, 0x06,
-    0x23, 0x9b, 0x7a, 0x7a, 0x3d, 0xad, 0x8a, 0x3d, 0x3e, 0x05, 0x5e, 0x8a,
-    0x36, 0x0f, 0x23, 0x96, 0x78, 0x5b, 0x81, 0x13, 0x01, 0x54, 0x73, 0x3d,
-    0xa4, 0x78, 0x3d, 0x1e, 0x1a, 0x1a, 0x23, 0x05, 0x05, 0x03, 0x03, 0x0c,
-    0x23, 0x0b, 0x23, 0x35, 0x10, 0x15, 0x03, 0x07, 0x63, 0x46, 0x1b, 0x15,
-    0x0c, 0x07, 0x05, 0x03, 0x01, 0x01, 0x04, 0x3a, 0x72, 0x3a, 0x72, 0x3a,
-    0x3c, 0x72, 0x58, 0x62, 0x1e, 0x10, 0x33, 0x28, 0x46, 0x4d, 0x04, 0x04,
-    0x04, 0x01, 0x01, 0x01, 0x1e, 0x22, 0x66, 0x2e, 0x58, 0x2e, 0x2a, 0x3f,
-    0x58, 0x66, 0x66, 0x33, 0x5a, 0x46, 0x33, 0x3f, 0x50, 0x50, 0x42, 0x0c,
-    0x2a, 0x05, 0x05, 0x05, 0x03, 0x03, 0x01, 0x0b, 0x50, 0x15, 0x0c, 0x86,
-    0x96, 0x92, 0x96, 0x64, 0x13, 0x5e, 0x2d, 0x05, 0x05, 0x05, 0x01, 0x05,
-    0x05, 0x05, 0x1a, 0x75, 0x84, 0x3d, 0x75, 0x83, 0x8f, 0x8c, 0x85, 0x04,
-    0x05, 0x08, 0x06, 0x06, 0x3e, 0x71, 0x1a, 0x51, 0x77, 0x6a, 0x1f, 0x8c,
-    0x9a, 0x83, 0x61, 0xa1, 0x77, 0x4b, 0x4b, 0x6a, 0x77, 0x94, 0x8c, 0x6a,
-    0x61, 0x3e, 0x74, 0x90, 0xb5, 0xa5, 0xa2, 0x65, 0x7e, 0xb1, 0x8d, 0x8d,
-    0x6e, 0xb5, 0xc9, 0xbf, 0x9c, 0xac, 0xb5, 0xc2, 0xbd, 0xac, 0xa1, 0x9c,
-    0x9d, 0x5f, 0xb2, 0xa6, 0xbb, 0xd1, 0xd2, 0xd9, 0xd9, 0xd2, 0xdf, 0xe6,
-    0xe6, 0xe6, 0xd3, 0xe4, 0xdb, 0xf1, 0xf1, 0xdb, 0xe4, 0xea, 0xe8, 0xf2,
-    0xf1, 0xf2, 0xf1, 0xef, 0xf1, 0xe4, 0xee, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf2, 0xf6, 0xf9, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe,
-    0xfa, 0xf9, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xef, 0xf1, 0xf1, 0xec,
-    0xec, 0xec, 0xea, 0xec, 0xec, 0xea, 0xea, 0xec, 0xef, 0xef, 0xea, 0x6b,
-    0x74, 0x88, 0xc6, 0xd6, 0xd5, 0xd5, 0xcc, 0xce, 0xd5, 0xbe, 0xd9, 0x5d,
-    0x2c, 0xe0, 0xda, 0xd7, 0xbb, 0xd5, 0xb5, 0x26, 0x71, 0xba, 0xc7, 0xc7,
-    0xc2, 0xc2, 0xbd, 0xc2, 0xaf, 0xb4, 0x89, 0x6a, 0x49, 0x9a, 0x49, 0x16,
-    0x75, 0xa8, 0xa5, 0xb5, 0x3b, 0x26, 0x1f, 0x3e, 0x0e, 0x06, 0x0b, 0x0b,
-    0x05, 0x1a, 0x2d, 0x0b, 0x05, 0x1f, 0x1f, 0x08, 0x05, 0x0e, 0x0e, 0x0b,
-    0x05, 0x05, 0x0b, 0x12, 0x1f, 0x1f, 0x0b, 0x0c, 0x3e, 0xa4, 0xae, 0x78,
-    0x7a, 0x61, 0x81, 0x6f, 0x61, 0x23, 0x27, 0x1d, 0x1f, 0x10, 0x83, 0xae,
-    0x96, 0x7a, 0x49, 0x3d, 0x02, 0x68, 0x87, 0x5b, 0x96, 0x3d, 0x54, 0x14,
-    0x15, 0x1c, 0x0c, 0x0f, 0x04, 0x03, 0x05, 0x04, 0x06, 0x23, 0x3d, 0x14,
-    0x49, 0x20, 0x05, 0x03, 0x1d, 0x46, 0x1e, 0x0c, 0x31, 0x33, 0x01, 0x05,
-    0x01, 0x01, 0x02, 0x33, 0x33, 0x3a, 0x2a, 0x3a, 0x72, 0x72, 0x3c, 0x62,
-    0x06, 0x1e, 0x28, 0x28, 0x17, 0x28, 0x04, 0x03, 0x04, 0x05, 0x01, 0x01,
-    0x0c, 0x33, 0x72, 0x5a, 0x28, 0x4f, 0x3f, 0x28, 0x58, 0x53, 0x33, 0x67,
-    0x46, 0x67, 0x42, 0x67, 0x56, 0x1d, 0x09, 0x4c, 0x5b, 0x03, 0x01, 0x03,
-    0x03, 0x03, 0x02, 0x0b, 0x3f, 0x12, 0x06, 0x5b, 0x67, 0x6c, 0x7d, 0x6f,
-    0x54, 0x23, 0x2d, 0x05, 0x05, 0x05, 0x03, 0x05, 0x05, 0x03, 0x69, 0x59,
-    0x21, 0x27, 0x8f, 0x8c, 0x8f, 0x94, 0x4b, 0x05, 0x05, 0x05, 0x05, 0x04,
-    0x3e, 0x1f, 0x13, 0x7a, 0x71, 0x26, 0x69, 0x77, 0x9a, 0x49, 0x3e, 0x51,
-    0x2d, 0x36, 0x3e, 0x47, 0x76, 0xb1, 0xaf, 0x69, 0x47, 0x5c, 0x7e, 0x8c,
-    0xb0, 0xbb, 0x5c, 0x51, 0x8d, 0x71, 0x77, 0x94, 0xac, 0xa5, 0xa9, 0xb7,
-    0xb7, 0x94, 0xb7, 0xb1, 0xba, 0xbc, 0xc2, 0xb5, 0xb1, 0xb7, 0x99, 0xc6,
-    0xc6, 0xcb, 0xd8, 0xd9, 0xe3, 0xe3, 0xdf, 0xe3, 0xd9, 0xe3, 0xdf, 0xd3,
-    0xe6, 0xd3, 0xee, 0xdf, 0xdf, 0xdb, 0xeb, 0xf3, 0xf5, 0xf9, 0xf4, 0xf1,
-    0xef, 0xdb, 0xe4, 0xee, 0xf1, 0xee, 0xf1, 0xef, 0xf1, 0xf1, 0xf1, 0xf2,
-    0xf3, 0xf6, 0xf6, 0xf9, 0xf9, 0xf6, 0xf6, 0xf3, 0xf2, 0xf2, 0xf1, 0xf1,
-    0xf2, 0xf1, 0xef, 0xf1, 0xef, 0xef, 0xec, 0xec, 0xea, 0xea, 0xec, 0xf1,
-    0xec, 0xea, 0xec, 0xec, 0xea, 0xea, 0xdf, 0xb8, 0xc1, 0xc6, 0xb7, 0xd5,
-    0xd5, 0xce, 0xd5, 0xd7, 0x94, 0x85, 0xd9, 0xa7, 0x9d, 0xda, 0xd6, 0xcc,
-    0xcc, 0xc7, 0x8c, 0x51, 0x71, 0xc7, 0xc7, 0xc2, 0xc2, 0xc2, 0xa1, 0x94,
-    0x3e, 0xaf, 0x3d, 0xa1, 0x9a, 0xab, 0x7a, 0x23, 0x85, 0x94, 0x9c, 0x8d,
-    0x1c, 0x0e, 0x0b, 0x26, 0x0e, 0x11, 0x3e, 0x0b, 0x1f, 0x1f, 0x0e, 0x7e,
-    0x2d, 0x1f, 0x0b, 0x3e, 0x44, 0x1f, 0x26, 0x06, 0x1f, 0x06, 0x05, 0x05,
-    0x05, 0x03, 0x05, 0x08, 0x23, 0x36, 0x6a, 0x6a, 0x8a, 0x7a, 0x75, 0x83,
-    0x4e, 0x0c, 0x06, 0x4e, 0x81, 0x76, 0x61, 0x81, 0x8a, 0x6f, 0x75, 0x36,
-    0x05, 0x3d, 0x87, 0x5e, 0x1d, 0x24, 0x2d, 0x20, 0x07, 0x05, 0x1a, 0x15,
-    0x04, 0x05, 0x05, 0x05, 0x05, 0x13, 0x42, 0x42, 0x82, 0x33, 0x04, 0x06,
-    0x06, 0x3f, 0x53, 0x0d, 0x70, 0x46, 0x0b, 0x01, 0x03, 0x02, 0x01, 0x1e,
-    0x2e, 0x4d, 0x1e, 0x4d, 0x72, 0x58, 0x40, 0x72, 0x04, 0x24, 0x3c, 0x33,
-    0x3a, 0x62, 0x1e, 0x01, 0x04, 0x03, 0x01, 0x01, 0x04, 0x46, 0x4f, 0x2a,
-    0x3a, 0x3f, 0x58, 0x66, 0x4f, 0x58, 0x67, 0x3f, 0x5a, 0x67, 0x35, 0x18,
-    0x07, 0x0c, 0x33, 0x23, 0x33, 0x05, 0x05, 0x06, 0x05, 0x01, 0x01, 0x1a,
-    0x56, 0x13, 0x03, 0x3d, 0x78, 0x86, 0x5b, 0x24, 0x7d, 0x23, 0x2d, 0x03,
-    0x05, 0x05, 0x03, 0x05, 0x06, 0x15, 0x69, 0x0e, 0x0b, 0x4b, 0x8c, 0xb4,
-    0x8a, 0x7a, 0x1f, 0x0b, 0x06, 0x05, 0x05, 0x14, 0x69, 0x05, 0x4b, 0x71,
-    0x3e, 0x34, 0x6a, 0x9b, 0x7a, 0x6a, 0x4e, 0x5e, 0x3b, 0x7e, 0x7e, 0x6a,
-    0x47, 0x6a, 0x6a, 0x1f, 0x36, 0x3e, 0x6e, 0x5c, 0x85, 0x71, 0x26, 0x1f,
-    0x5c, 0xac, 0x9c, 0x9c, 0xc4, 0xbf, 0xbf, 0xb7, 0xb7, 0xb7, 0xbb, 0xa9,
-    0xc9, 0xc7, 0xc7, 0xc9, 0xb5, 0xc9, 0xc6, 0xbe, 0xc1, 0xc1, 0xc6, 0xcb,
-    0xd2, 0xe2, 0xd9, 0xd8, 0xe3, 0xe2, 0xe7, 0xc8, 0xe3, 0xe4, 0xd3, 0xc8,
-    0xd3, 0xca, 0xe5, 0xf7, 0xf9, 0xf9, 0xf9, 0xf6, 0xf1, 0xe8, 0xee, 0xef,
-    0xef, 0xef, 0xef, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2,
-    0xf1, 0xf2, 0xf2, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xef, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xef, 0xec, 0xe7, 0xec, 0xea,
-    0xe7, 0xe7, 0xd1, 0xdd, 0xd7, 0xda, 0xd6, 0xd7, 0xd5, 0xce, 0xd5, 0xda,
-    0xa6, 0xa6, 0xc6, 0xdd, 0xd7, 0xd6, 0xd7, 0xd5, 0xcc, 0xbf, 0x83, 0x7a,
-    0xb9, 0xc2, 0xc7, 0xc2, 0xb5, 0x7a, 0x47, 0x3e, 0x2d, 0x9c, 0x1f, 0x1d,
-    0x77, 0x5c, 0x83, 0x6e, 0x3e, 0x71, 0x71, 0x7a, 0x7e, 0x85, 0x0b, 0x0e,
-    0x16, 0x5c, 0x13, 0x1a, 0x26, 0x2c, 0x0b, 0x27, 0x7e, 0x83, 0x61, 0x9e,
-    0x6a, 0x61, 0x1f, 0x30, 0x8c, 0x7e, 0x0b, 0x01, 0x05, 0x1f, 0x23, 0x08,
-    0x04, 0x01, 0x0c, 0x06, 0x0b, 0x47, 0x8f, 0x76, 0x15, 0x05, 0x1a, 0x5e,
-    0x36, 0x12, 0x23, 0x76, 0x54, 0x4b, 0x68, 0x3d, 0x05, 0x0c, 0x5e, 0x07,
-    0x0c, 0x78, 0x5b, 0x26, 0x12, 0x20, 0x12, 0x04, 0x0c, 0x05, 0x05, 0x01,
-    0x01, 0x0b, 0x14, 0x27, 0x73, 0x23, 0x0c, 0x05, 0x0b, 0x29, 0x5a, 0x4f,
-    0x66, 0x70, 0x14, 0x03, 0x04, 0x01, 0x01, 0x0c, 0x4d, 0x58, 0x4d, 0x58,
-    0x4d, 0x4d, 0x72, 0x72, 0x06, 0x33, 0x4d, 0x1e, 0x3a, 0x40, 0x22, 0x01,
-    0x04, 0x04, 0x04, 0x01, 0x01, 0x4f, 0x24, 0x5a, 0x33, 0x46, 0x58, 0x58,
-    0x4f, 0x53, 0x33, 0x66, 0x67, 0x1b, 0x12, 0x2a, 0x20, 0x53, 0x64, 0x1e,
-    0x2a, 0x06, 0x06, 0x04, 0x06, 0x05, 0x01, 0x0b, 0x1d, 0x15, 0x03, 0x76,
-    0x5b, 0x73, 0x73, 0xa4, 0x50, 0x54, 0x23, 0x03, 0x05, 0x0b, 0x01, 0x05,
-    0x0b, 0x26, 0x06, 0x26, 0x7a, 0x3d, 0x23, 0x3d, 0x61, 0x59, 0x0b, 0x05,
-    0x03, 0x01, 0x01, 0x71, 0x1a, 0x27, 0x80, 0x3e, 0x26, 0x5e, 0x61, 0xa8,
-    0x94, 0x61, 0x5c, 0x69, 0x2d, 0xa5, 0x8c, 0x9a, 0x5c, 0x4b, 0x2c, 0x55,
-    0x47, 0x65, 0x54, 0x65, 0x74, 0x4b, 0x1f, 0x97, 0xa5, 0xc4, 0xc9, 0xb7,
-    0xbf, 0xba, 0xbf, 0xc4, 0xcf, 0xd1, 0xc1, 0xd1, 0xba, 0xb5, 0xbf, 0xc4,
-    0xba, 0xb5, 0xc9, 0xd8, 0xd1, 0xd7, 0xd0, 0xb8, 0xb8, 0xdd, 0xd9, 0xd8,
-    0xdd, 0xe2, 0xe7, 0xd2, 0xdf, 0xe6, 0xb6, 0xc0, 0xe5, 0xe5, 0xe9, 0xf7,
-    0xf6, 0xf9, 0xfa, 0xf9, 0xf0, 0xeb, 0xec, 0xef, 0xef, 0xef, 0xee, 0xee,
-    0xee, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xef, 0xef, 0xf1, 0xef, 0xef, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xef, 0xef, 0xec, 0xec, 0xec, 0xec, 0xea,
-    0xec, 0xef, 0xec, 0xec, 0xea, 0xe7, 0xe7, 0xe1, 0xe1, 0xe1, 0xe0, 0xda,
-    0xd7, 0xd5, 0xda, 0xe0, 0xda, 0xd5, 0xd5, 0xd6, 0xda, 0xc9, 0xd6, 0xe0,
-    0xdd, 0xd5, 0xce, 0xce, 0xce, 0x7a, 0x68, 0x9e, 0xc2, 0xc2, 0xc2, 0xc2,
-    0xa8, 0x4e, 0xa8, 0x83, 0x36, 0xb4, 0x7a, 0x83, 0x9c, 0x1a, 0x4b, 0xa6,
-    0x5e, 0x13, 0xba, 0xba, 0x8c, 0x16, 0x11, 0x1a, 0x2d, 0x3e, 0x0b, 0x0e,
-    0x61, 0x0c, 0x05, 0x2d, 0x7a, 0x83, 0x71, 0x61, 0x27, 0x59, 0x0c, 0x83,
-    0x6f, 0x1f, 0x05, 0x1a, 0x7a, 0xa4, 0x9e, 0x8f, 0x89, 0x36, 0x64, 0x23,
-    0x0b, 0x01, 0x06, 0x08, 0x03, 0x05, 0x01, 0x05, 0x03, 0x01, 0x01, 0x03,
-    0x03, 0x04, 0x0e, 0x11, 0x03, 0x03, 0x04, 0x23, 0x1a, 0x18, 0x64, 0x3d,
-    0x75, 0x5b, 0x54, 0x0c, 0x06, 0x03, 0x05, 0x01, 0x01, 0x01, 0x31, 0x10,
-    0x14, 0x20, 0x06, 0x04, 0x07, 0x3f, 0x33, 0x7b, 0x33, 0x14, 0x04, 0x06,
-    0x06, 0x01, 0x01, 0x01, 0x66, 0x72, 0x4d, 0x58, 0x4d, 0x3a, 0x2e, 0x2e,
-    0x0b, 0x28, 0x28, 0x4d, 0x3a, 0x52, 0x4f, 0x01, 0x01, 0x02, 0x04, 0x01,
-    0x02, 0x33, 0x33, 0x24, 0x10, 0x24, 0x66, 0x66, 0x70, 0x3f, 0x5a, 0x7b,
-    0x07, 0x20, 0x20, 0x5a, 0x66, 0x70, 0x5b, 0x3f, 0x15, 0x05, 0x05, 0x05,
-    0x04, 0x03, 0x01, 0x2b, 0x3d, 0x0b, 0x04, 0x31, 0x96, 0x92, 0x86, 0xa4,
-    0x8a, 0x5b, 0x1b, 0x05, 0x05, 0x05, 0x01, 0x05, 0x06, 0x1f, 0x3e, 0x49,
-    0x75, 0x9b, 0xa1, 0x76, 0x3e, 0x06, 0x05, 0x03, 0x05, 0x03, 0x0b, 0x23,
-    0x1a, 0x83, 0x8c, 0x1a, 0x6a, 0x59, 0x47, 0x9b, 0x55, 0x75, 0x59, 0x5c,
-    0x4b, 0x83, 0x8c, 0x8c, 0x65, 0x3e, 0x65, 0x9c, 0x77, 0x4b, 0x8d, 0x6a,
-    0x34, 0x55, 0x8d, 0xb3, 0xa9, 0xb1, 0xba, 0xa1, 0xa5, 0xb0, 0xb5, 0xc9,
-    0xc9, 0xd7, 0xbb, 0xd8, 0xc4, 0xd0, 0xd0, 0xcc, 0xc4, 0xc7, 0xb1, 0xd0,
-    0xe0, 0xd1, 0xda, 0xc6, 0xd1, 0xbe, 0xd1, 0xd8, 0xe2, 0xe2, 0xe1, 0xd2,
-    0xd2, 0xd2, 0xd3, 0xd3, 0xe4, 0xee, 0xf1, 0xed, 0xf6, 0xf6, 0xfa, 0xf5,
-    0xf1, 0xee, 0xea, 0xea, 0xea, 0xec, 0xec, 0xec, 0xee, 0xef, 0xee, 0xee,
-    0xee, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xef, 0xef, 0xf1, 0xef,
-    0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xea, 0xe7, 0xea, 0xec, 0xec, 0xea,
-    0xe7, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xda, 0xd5, 0xd5, 0xd5, 0xd5,
-    0xd5, 0xd5, 0xd5, 0xd5, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce,
-    0xcc, 0x90, 0x6f, 0xb9, 0xc2, 0xc2, 0xc2, 0xc2, 0xbd, 0x83, 0x8f, 0xb4,
-    0xbd, 0xb5, 0xbd, 0x6a, 0xb0, 0x1f, 0x2d, 0x3e, 0x06, 0x36, 0x9a, 0xa8,
-    0x41, 0x0e, 0x2c, 0x7e, 0x41, 0x06, 0x26, 0x2c, 0x25, 0x47, 0x0f, 0x55,
-    0x84, 0x59, 0x94, 0xa8, 0x26, 0x54, 0x3e, 0x4e, 0x26, 0x05, 0x1f, 0x80,
-    0x6f, 0x9b, 0xa4, 0xb4, 0x9b, 0x5e, 0xaf, 0xa3, 0x7a, 0x71, 0x05, 0x03,
-    0x07, 0x3d, 0x27, 0x23, 0x64, 0x50, 0x31, 0x23, 0x12, 0x06, 0x03, 0x05,
-    0x03, 0x01, 0x01, 0x02, 0x02, 0x02, 0x04, 0x01, 0x03, 0x0b, 0x1a, 0x0b,
-    0x0b, 0x01, 0x01, 0x01, 0x05, 0x03, 0x0c, 0x5b, 0x29, 0x12, 0x3f, 0x14,
-    0x15, 0x50, 0x42, 0x14, 0x33, 0x24, 0x28, 0x04, 0x05, 0x01, 0x01, 0x01,
-    0x3a, 0x58, 0x1e, 0x2e, 0x4d, 0x62, 0x72, 0x72, 0x09, 0x3c, 0x4d, 0x2e,
-    0x22, 0x4d, 0x62, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2e, 0x53, 0x20,
-    0x24, 0x04, 0x1e, 0x58, 0x63, 0x5a, 0x66, 0x46, 0x1e, 0x33, 0x50, 0x50,
-    0x72, 0x7b, 0x67, 0x67, 0x0b, 0x03, 0x05, 0x01, 0x01, 0x03, 0x01, 0x25,
-    0x5b, 0x3d, 0x05, 0x50, 0x87, 0x8a, 0x6c, 0x96, 0x75, 0x8f, 0x15, 0x03,
-    0x01, 0x08, 0x05, 0x0a, 0x27, 0x6a, 0x36, 0x47, 0x76, 0x8f, 0x75, 0x49,
-    0x6a, 0x4b, 0x04, 0x01, 0x03, 0x03, 0x2c, 0x0c, 0x54, 0x75, 0x36, 0x71,
-    0x64, 0x94, 0x55, 0x4b, 0x61, 0x77, 0x61, 0x5c, 0x5c, 0x77, 0x75, 0x5c,
-    0x4b, 0x27, 0x94, 0x90, 0x71, 0x44, 0x6a, 0x2c, 0x65, 0x98, 0x9c, 0xc4,
-    0xc4, 0xbf, 0xbb, 0xc4, 0xd0, 0xb7, 0xbf, 0xd0, 0xd0, 0xc9, 0xb1, 0xcb,
-    0xd1, 0xd7, 0xd0, 0xcc, 0xc2, 0xc2, 0xb5, 0xbf, 0xd7, 0xd0, 0xd7, 0xd1,
-    0xc6, 0xc1, 0xd8, 0xe1, 0xe2, 0xe2, 0xe2, 0xc8, 0xa7, 0xd2, 0xe3, 0xe4,
-    0xe6, 0xef, 0xee, 0xf1, 0xed, 0xed, 0xf5, 0xf9, 0xf2, 0xec, 0xea, 0xea,
-    0xea, 0xea, 0xea, 0xea, 0xea, 0xec, 0xec, 0xec, 0xef, 0xef, 0xee, 0xef,
-    0xf1, 0xef, 0xee, 0xef, 0xef, 0xef, 0xef, 0xec, 0xec, 0xec, 0xec, 0xec,
-    0xea, 0xea, 0xea, 0xea, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe1, 0xe1, 0xe1,
-    0xe0, 0xe0, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xce, 0xce,
-    0xce, 0xc3, 0xc3, 0xc3, 0xc3, 0xce, 0xc3, 0xc3, 0xc3, 0xc3, 0xad, 0xb9,
-    0xbd, 0xbd, 0xc2, 0xb9, 0x9e, 0xbd, 0x83, 0xbd, 0xb5, 0xad, 0x9e, 0x6a,
-    0x47, 0x85, 0x2c, 0x0b, 0x2b, 0x51, 0xaf, 0x77, 0x0e, 0x16, 0x61, 0x26,
-    0x0b, 0x0e, 0xa5, 0x1a, 0xa2, 0x36, 0x2d, 0x61, 0xba, 0x83, 0x71, 0x6c,
-    0x1f, 0x1c, 0x3e, 0x77, 0x04, 0x65, 0x30, 0xa8, 0x59, 0x7a, 0xad, 0xa4,
-    0x6f, 0xad, 0x81, 0x8a, 0x81, 0x0f, 0x0f, 0x2d, 0x59, 0xa4, 0x78, 0x8a,
-    0xad, 0xad, 0xa4, 0xa4, 0x96, 0x96, 0x7d, 0x5e, 0x54, 0x06, 0x01, 0x03,
-    0x06, 0x0c, 0x08, 0x06, 0x05, 0x01, 0x06, 0x03, 0x06, 0x05, 0x01, 0x03,
-    0x03, 0x04, 0x04, 0x0f, 0x29, 0x2a, 0x50, 0x23, 0x06, 0x0c, 0x17, 0x63,
-    0x66, 0x28, 0x82, 0x1e, 0x01, 0x01, 0x0a, 0x03, 0x07, 0x58, 0x3a, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x09, 0x58, 0x58, 0x60, 0x62, 0x1e, 0x2e, 0x14,
-    0x01, 0x01, 0x01, 0x03, 0x01, 0x1e, 0x33, 0x1e, 0x5a, 0x14, 0x1e, 0x4f,
-    0x58, 0x5a, 0x66, 0x1b, 0x3f, 0x66, 0x5b, 0x53, 0x66, 0x67, 0x53, 0x42,
-    0x07, 0x03, 0x03, 0x01, 0x01, 0x01, 0x05, 0x3d, 0x64, 0x42, 0x04, 0x23,
-    0x6c, 0x67, 0x87, 0x96, 0x8a, 0x73, 0x1c, 0x05, 0x01, 0x08, 0x04, 0x15,
-    0x7a, 0x8c, 0x13, 0x26, 0x27, 0x49, 0x9b, 0x75, 0x94, 0x27, 0x05, 0x03,
-    0x05, 0x0b, 0x0b, 0x26, 0x9b, 0x7e, 0x2d, 0x94, 0x61, 0x61, 0x6a, 0x5c,
-    0x61, 0x77, 0x6e, 0x5e, 0x2c, 0x61, 0x6a, 0x74, 0x1f, 0x51, 0x6a, 0x7a,
-    0x8d, 0x3e, 0x26, 0x65, 0x77, 0xa2, 0x83, 0xba, 0xc4, 0xb7, 0xa9, 0xba,
-    0xb5, 0xc9, 0xbf, 0xbf, 0xc4, 0xc6, 0xc9, 0xbb, 0xd0, 0xd0, 0xd0, 0xc4,
-    0xc4, 0xb0, 0xc2, 0xc4, 0xbf, 0xd0, 0xc4, 0xc9, 0xd1, 0xd7, 0xd1, 0xd8,
-    0xdd, 0xdd, 0xbe, 0xbe, 0xbe, 0xd8, 0xe2, 0xe3, 0xe6, 0xe6, 0xea, 0xef,
-    0xc0, 0xf5, 0xfa, 0xfa, 0xf6, 0xef, 0xec, 0xea, 0xea, 0xea, 0xea, 0xea,
-    0xea, 0xec, 0xec, 0xec, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef,
-    0xef, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xea, 0xe7, 0xe7, 0xe7,
-    0xe7, 0xe7, 0xe7, 0xe7, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xda, 0xda, 0xda,
-    0xd5, 0xd5, 0xd5, 0xd5, 0xce, 0xce, 0xce, 0xce, 0xce, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xbd, 0xa3,
-    0xb4, 0x6f, 0x9b, 0xad, 0xb4, 0xad, 0x8f, 0x54, 0x5e, 0x51, 0x0b, 0x16,
-    0x1d, 0x98, 0xa2, 0x1f, 0x11, 0x05, 0x16, 0x27, 0x54, 0x26, 0x26, 0x1f,
-    0x5e, 0x1f, 0x59, 0x13, 0xaf, 0xbd, 0xbd, 0xa1, 0x1f, 0x59, 0x5e, 0x0e,
-    0x54, 0x71, 0x3e, 0x8f, 0x8a, 0x9b, 0x5e, 0x6f, 0xae, 0x8f, 0xa4, 0x9e,
-    0x61, 0x31, 0x23, 0x23, 0x7a, 0x8f, 0x81, 0xad, 0xa3, 0xae, 0x96, 0x8f,
-    0x78, 0x78, 0x59, 0x36, 0x42, 0x36, 0x01, 0x02, 0x1f, 0x3d, 0x1d, 0x36,
-    0x1f, 0x05, 0x02, 0x01, 0x03, 0x01, 0x05, 0x01, 0x06, 0x06, 0x05, 0x05,
-    0x07, 0x15, 0x35, 0x14, 0x04, 0x1b, 0x66, 0x82, 0x46, 0x7b, 0x72, 0x46,
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x58, 0x2e, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x09, 0x4d, 0x3c, 0x52, 0x62, 0x4d, 0x58, 0x17, 0x02, 0x02, 0x01, 0x03,
-    0x01, 0x06, 0x17, 0x46, 0x46, 0x20, 0x33, 0x58, 0x58, 0x66, 0x14, 0x1b,
-    0x70, 0x72, 0x66, 0x7b, 0x66, 0x67, 0x67, 0x42, 0x04, 0x03, 0x03, 0x01,
-    0x01, 0x01, 0x0b, 0x3d, 0x73, 0x50, 0x05, 0x12, 0x25, 0x3d, 0x9f, 0x9f,
-    0xa4, 0x64, 0x07, 0x08, 0x03, 0x04, 0x05, 0x4b, 0x76, 0x8f, 0x1f, 0x23,
-    0x23, 0x6a, 0x8a, 0x81, 0x61, 0x05, 0x01, 0x05, 0x01, 0x08, 0x15, 0x5c,
-    0x61, 0x23, 0x61, 0x83, 0x71, 0x9b, 0x6a, 0x36, 0x3b, 0x69, 0x61, 0x3e,
-    0x4b, 0x85, 0x83, 0x55, 0x4b, 0x77, 0x4b, 0x8d, 0x6a, 0x16, 0x5c, 0xa9,
-    0xa2, 0x71, 0xa2, 0xbf, 0xc4, 0xc4, 0xc4, 0xba, 0xb1, 0xbf, 0xd0, 0xc4,
-    0xc9, 0xc4, 0xd0, 0xb7, 0xcb, 0xc1, 0xc4, 0xc4, 0xc4, 0xb0, 0xc7, 0xc4,
-    0xba, 0xbf, 0xcf, 0xbb, 0xc9, 0xc6, 0xd1, 0xd8, 0xd1, 0xd1, 0xc6, 0xd8,
-    0xc6, 0xd8, 0xd8, 0xdf, 0xe6, 0xe3, 0xe6, 0xec, 0xe9, 0xed, 0xf5, 0xf6,
-    0xf6, 0xf2, 0xec, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xec, 0xec,
-    0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xec, 0xec, 0xec, 0xec, 0xec,
-    0xec, 0xec, 0xec, 0xec, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe1, 0xe1,
-    0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xda, 0xda, 0xda, 0xd5, 0xd5, 0xd5,
-    0xce, 0xce, 0xce, 0xce, 0xce, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xa3, 0x81, 0x81, 0xb9, 0xb9, 0xbd, 0xbd, 0x9b, 0x9e, 0xb4, 0x59, 0xa8,
-    0xb4, 0xb4, 0x94, 0x54, 0x2c, 0x13, 0x1f, 0x1c, 0x6a, 0x7e, 0x36, 0x5f,
-    0x0b, 0x1f, 0x2c, 0x98, 0x83, 0x36, 0x9a, 0x2c, 0x7a, 0x2d, 0x26, 0x26,
-    0x9a, 0xb4, 0x94, 0x3e, 0x1f, 0x3d, 0x6a, 0x61, 0x71, 0x13, 0x59, 0xa4,
-    0x95, 0xad, 0x5e, 0x8c, 0x8f, 0x68, 0x59, 0x49, 0x7a, 0x9e, 0x54, 0x61,
-    0x54, 0x6c, 0x8a, 0xad, 0xa4, 0xa4, 0x9e, 0x8f, 0x6c, 0x6f, 0x4e, 0x49,
-    0x78, 0x8a, 0x31, 0x01, 0x0b, 0x23, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x05, 0x04, 0x06, 0x03, 0x01, 0x01, 0x01, 0x03, 0x06, 0x18,
-    0x0b, 0x20, 0x53, 0x66, 0x33, 0x66, 0x4f, 0x28, 0x03, 0x01, 0x01, 0x02,
-    0x01, 0x28, 0x2e, 0x72, 0x72, 0x72, 0x72, 0x58, 0x07, 0x40, 0x2e, 0x4d,
-    0x62, 0x40, 0x52, 0x33, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3a, 0x58,
-    0x58, 0x46, 0x42, 0x46, 0x4f, 0x2a, 0x07, 0x63, 0x82, 0x7b, 0x72, 0x7b,
-    0x66, 0x50, 0x53, 0x50, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x06, 0x29,
-    0x73, 0x64, 0x04, 0x1f, 0x64, 0x31, 0x67, 0x7d, 0xa4, 0x73, 0x04, 0x05,
-    0x05, 0x03, 0x13, 0x75, 0x6c, 0x6c, 0x1f, 0x76, 0x8a, 0x7a, 0x6c, 0x8c,
-    0x5e, 0x01, 0x05, 0x03, 0x05, 0x08, 0x77, 0x54, 0x1a, 0x3e, 0x7e, 0x61,
-    0x85, 0xb0, 0x77, 0x3e, 0x2d, 0x27, 0x61, 0x3e, 0x54, 0x89, 0x6e, 0x23,
-    0x9a, 0xa8, 0x5e, 0x3e, 0x1f, 0x6e, 0x65, 0xb5, 0x9c, 0x9c, 0x85, 0xb5,
-    0xbf, 0xc4, 0xaf, 0xb7, 0xba, 0xbf, 0xba, 0xc4, 0xc4, 0xc4, 0xc6, 0xc1,
-    0xb7, 0xcb, 0xbb, 0xd0, 0xd0, 0xaf, 0xc9, 0xcc, 0xbf, 0xbf, 0xbb, 0xb7,
-    0xbf, 0xcb, 0xc1, 0xc6, 0xd1, 0xe1, 0xcb, 0xc6, 0xd1, 0xd1, 0xdd, 0xe2,
-    0xe2, 0xe6, 0xe4, 0xe8, 0xe8, 0xf3, 0xe5, 0xf2, 0xf3, 0xf2, 0xea, 0xe7,
-    0xe7, 0xea, 0xea, 0xea, 0xea, 0xea, 0xec, 0xec, 0xec, 0xec, 0xef, 0xef,
-    0xef, 0xef, 0xef, 0xec, 0xec, 0xec, 0xec, 0xea, 0xea, 0xea, 0xea, 0xe7,
-    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0,
-    0xe0, 0xda, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xce, 0xce, 0xce, 0xce, 0xce,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xb9, 0xb9, 0xa3, 0x95, 0x23, 0x6f,
-    0xa3, 0xbc, 0xbd, 0x4e, 0x9b, 0x7a, 0x9b, 0x9b, 0x9b, 0x94, 0xab, 0x51,
-    0x1f, 0x36, 0x5c, 0x36, 0x77, 0x1f, 0x2c, 0x2d, 0x0b, 0x5c, 0x71, 0x59,
-    0x6a, 0x3e, 0x90, 0x1f, 0x55, 0x0b, 0x08, 0x26, 0x75, 0x75, 0x47, 0x1f,
-    0x2d, 0x75, 0x8f, 0x7a, 0x75, 0x23, 0x61, 0x8f, 0x83, 0x9b, 0x9e, 0x81,
-    0x81, 0x9e, 0x54, 0x59, 0x9b, 0x7a, 0x59, 0x78, 0x7a, 0x6f, 0x78, 0x8f,
-    0x8a, 0x9b, 0xa3, 0xa4, 0x96, 0x6f, 0x3d, 0x68, 0x8f, 0x96, 0xa4, 0x15,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x06, 0x06, 0x08, 0x05, 0x07,
-    0x06, 0x03, 0x03, 0x03, 0x01, 0x03, 0x05, 0x05, 0x03, 0x1b, 0x20, 0x14,
-    0x20, 0x31, 0x4f, 0x46, 0x14, 0x01, 0x01, 0x01, 0x02, 0x14, 0x2f, 0x62,
-    0x62, 0x62, 0x4d, 0x28, 0x07, 0x40, 0x52, 0x3c, 0x58, 0x4d, 0x2e, 0x28,
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x4f, 0x58, 0x72, 0x72, 0x5a, 0x2a,
-    0x17, 0x07, 0x46, 0x4f, 0x53, 0x5a, 0x66, 0x4f, 0x35, 0x42, 0x70, 0x35,
-    0x01, 0x05, 0x01, 0x01, 0x02, 0x01, 0x06, 0x31, 0x67, 0x87, 0x12, 0x06,
-    0x96, 0x73, 0x31, 0x1c, 0x50, 0x54, 0x01, 0x05, 0x05, 0x01, 0x23, 0xa4,
-    0x83, 0x84, 0x0e, 0x8a, 0xa4, 0x8f, 0x7a, 0x69, 0x1a, 0x05, 0x05, 0x01,
-    0x05, 0x15, 0x71, 0x54, 0x1f, 0x7e, 0x6a, 0x54, 0x89, 0x8c, 0x5e, 0x26,
-    0x2d, 0x36, 0x59, 0x65, 0x8c, 0x9e, 0x2c, 0x4b, 0x71, 0x94, 0x61, 0x34,
-    0x44, 0x7e, 0x65, 0x85, 0x69, 0x7e, 0x6e, 0x85, 0x94, 0xb1, 0x9a, 0xa2,
-    0xcc, 0xcf, 0xbf, 0xc9, 0xbf, 0xc4, 0xc4, 0xc6, 0xc6, 0xb7, 0xc6, 0xd7,
-    0xd7, 0xbf, 0xc4, 0xbf, 0xc4, 0xb7, 0xbb, 0xb1, 0xa2, 0xa5, 0xc4, 0xbb,
-    0xd1, 0xd1, 0xc6, 0xd1, 0xd8, 0xc6, 0xd8, 0xdd, 0xe2, 0xe3, 0xe4, 0xe5,
-    0xee, 0xf3, 0xf2, 0xec, 0xee, 0xf1, 0xea, 0xe7, 0xe7, 0xea, 0xea, 0xea,
-    0xea, 0xea, 0xea, 0xea, 0xec, 0xec, 0xec, 0xec, 0xec, 0xef, 0xef, 0xec,
-    0xec, 0xec, 0xec, 0xec, 0xea, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe1,
-    0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xda, 0xda, 0xda, 0xd5,
-    0xda, 0xd5, 0xd5, 0xd5, 0xce, 0xce, 0xce, 0xc3, 0xc3, 0xd5, 0xd7, 0xdd,
-    0xd7, 0xc7, 0xcc, 0xcf, 0xb4, 0xad, 0x68, 0x27, 0x75, 0x8a, 0x8f, 0x31,
-    0x7a, 0x27, 0xab, 0xbd, 0xaf, 0x71, 0x7e, 0x83, 0x7a, 0x5e, 0x4b, 0x1f,
-    0x0b, 0x0b, 0x11, 0x1f, 0x2c, 0x8d, 0xab, 0x71, 0x7e, 0x89, 0x1f, 0x0b,
-    0x0b, 0x03, 0x1f, 0x0e, 0x2d, 0x2c, 0x83, 0x23, 0x75, 0xb4, 0x8f, 0x4e,
-    0x2d, 0x2c, 0x61, 0xb4, 0x6f, 0xad, 0xad, 0x95, 0x95, 0x49, 0x49, 0x8f,
-    0x6f, 0x61, 0x5b, 0x7a, 0x8a, 0xa4, 0xa4, 0x8a, 0x31, 0x5b, 0x96, 0xae,
-    0x81, 0x49, 0x5b, 0x81, 0x78, 0x8a, 0x78, 0x15, 0x02, 0x01, 0x01, 0x01,
-    0x03, 0x0b, 0x1b, 0x12, 0x0c, 0x23, 0x04, 0x1b, 0x0c, 0x06, 0x03, 0x05,
-    0x02, 0x02, 0x01, 0x01, 0x06, 0x03, 0x06, 0x01, 0x35, 0x58, 0x4f, 0x4f,
-    0x46, 0x01, 0x01, 0x01, 0x02, 0x01, 0x46, 0x66, 0x62, 0x58, 0x22, 0x3a,
-    0x07, 0x3a, 0x4d, 0x3a, 0x4f, 0x3c, 0x2f, 0x28, 0x04, 0x01, 0x01, 0x01,
-    0x03, 0x01, 0x33, 0x62, 0x58, 0x62, 0x24, 0x20, 0x24, 0x33, 0x58, 0x66,
-    0x5a, 0x46, 0x53, 0x53, 0x29, 0x0d, 0x42, 0x14, 0x01, 0x03, 0x02, 0x01,
-    0x01, 0x02, 0x0c, 0x67, 0x5b, 0x9f, 0x29, 0x04, 0x76, 0x9f, 0x87, 0x2a,
-    0x20, 0x1f, 0x03, 0x05, 0x05, 0x05, 0x1f, 0x96, 0xa1, 0x6c, 0x0f, 0x8a,
-    0xae, 0x83, 0x83, 0x49, 0x06, 0x03, 0x05, 0x03, 0x01, 0x5f, 0x30, 0x1f,
-    0x3d, 0x6a, 0x6a, 0x54, 0x6f, 0x59, 0x26, 0x26, 0x59, 0x5e, 0x13, 0x47,
-    0xab, 0x5e, 0x69, 0x4e, 0x8c, 0x26, 0x36, 0x7e, 0x71, 0x65, 0x55, 0x47,
-    0x5e, 0x85, 0x9c, 0x9c, 0x6a, 0x94, 0xc1, 0xb5, 0xbb, 0xba, 0xc4, 0xbf,
-    0xc1, 0xb3, 0xb7, 0xcb, 0xd1, 0xb7, 0xc6, 0xbb, 0xc6, 0xc6, 0xc9, 0xb7,
-    0xd0, 0xc4, 0xb7, 0x8d, 0x9c, 0xa5, 0xcf, 0xc4, 0xc6, 0xbe, 0xc6, 0xcb,
-    0xd1, 0xb7, 0xd1, 0xd1, 0xdf, 0xe6, 0xe8, 0xf0, 0xf6, 0xf3, 0xf2, 0xec,
-    0xec, 0xef, 0xea, 0xe6, 0xe7, 0xe7, 0xe7, 0xea, 0xea, 0xea, 0xea, 0xea,
-    0xea, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec,
-    0xec, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0,
-    0xe0, 0xe0, 0xe0, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xd5,
-    0xce, 0xce, 0xce, 0xce, 0xda, 0xea, 0xea, 0xe7, 0xe7, 0xe2, 0xe7, 0xdd,
-    0xd6, 0xb5, 0xad, 0x5b, 0x95, 0xa3, 0x9b, 0x59, 0xa3, 0x7a, 0xb4, 0xc2,
-    0x9b, 0x7a, 0x61, 0x9a, 0xa8, 0x61, 0x15, 0x0b, 0x0a, 0x1f, 0x2d, 0x85,
-    0x5e, 0x89, 0x69, 0x51, 0x7a, 0x90, 0x1a, 0x0b, 0x27, 0x26, 0x6a, 0x16,
-    0x13, 0x54, 0x47, 0x68, 0xb4, 0xb4, 0x83, 0x0c, 0x3e, 0x1a, 0x59, 0x9b,
-    0x7a, 0xb4, 0xad, 0xb4, 0x6f, 0x75, 0x61, 0x68, 0x50, 0x8a, 0x6f, 0x68,
-    0xad, 0x96, 0xa4, 0xa4, 0x75, 0x78, 0x78, 0x31, 0x2d, 0x31, 0x81, 0xa4,
-    0x78, 0x3d, 0x1d, 0x01, 0x01, 0x01, 0x15, 0x18, 0x12, 0x0b, 0x24, 0x1d,
-    0x0b, 0x0f, 0x12, 0x23, 0x29, 0x0c, 0x05, 0x03, 0x01, 0x02, 0x06, 0x15,
-    0x06, 0x01, 0x01, 0x04, 0x20, 0x58, 0x42, 0x72, 0x62, 0x03, 0x01, 0x01,
-    0x00, 0x01, 0x3a, 0x58, 0x62, 0x3a, 0x4f, 0x52, 0x07, 0x28, 0x3c, 0x3c,
-    0x3a, 0x33, 0x62, 0x28, 0x06, 0x01, 0x01, 0x03, 0x01, 0x01, 0x1e, 0x62,
-    0x58, 0x40, 0x13, 0x4f, 0x28, 0x4f, 0x66, 0x82, 0x82, 0x72, 0x72, 0x33,
-    0x24, 0x3d, 0x20, 0x05, 0x05, 0x05, 0x01, 0x01, 0x02, 0x01, 0x10, 0x8a,
-    0x5b, 0x87, 0x2d, 0x05, 0x23, 0x9f, 0xa4, 0x87, 0x7d, 0x15, 0x0b, 0x05,
-    0x01, 0x0b, 0x31, 0x9b, 0x9b, 0x3e, 0x3d, 0xa4, 0x9b, 0x54, 0x94, 0x64,
-    0x06, 0x05, 0x03, 0x05, 0x15, 0x55, 0x15, 0x1f, 0x51, 0x2d, 0x55, 0x59,
-    0x23, 0x47, 0x4b, 0x4b, 0x71, 0x65, 0x51, 0x61, 0x2d, 0x3e, 0x8c, 0x61,
-    0x34, 0x61, 0x4b, 0x61, 0x65, 0x4b, 0x97, 0x7a, 0x77, 0x6e, 0xac, 0x9a,
-    0x85, 0x8d, 0x94, 0xa2, 0xa2, 0xb1, 0xb5, 0xd0, 0xc9, 0xbb, 0xb3, 0xba,
-    0xb7, 0xb7, 0xb2, 0xb2, 0xb8, 0xcb, 0xd1, 0xb1, 0xc6, 0xba, 0x9c, 0xba,
-    0xa9, 0x9c, 0xa9, 0xbf, 0xc9, 0xbb, 0xd7, 0xd8, 0xc8, 0xd8, 0xdd, 0xdd,
-    0xe6, 0xea, 0xec, 0xee, 0xf2, 0xf4, 0xf3, 0xee, 0xf1, 0xf1, 0xea, 0xe7,
-    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xea, 0xea, 0xea, 0xea, 0xea, 0xec, 0xec,
-    0xec, 0xec, 0xec, 0xec, 0xea, 0xec, 0xec, 0xec, 0xec, 0xea, 0xec, 0xe7,
-    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
-    0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xce, 0xce, 0xe1,
-    0xf2, 0xf2, 0xec, 0xe3, 0xe2, 0xe7, 0xe2, 0xd7, 0xcc, 0xcc, 0xaf, 0x9e,
-    0x95, 0x9b, 0x90, 0x75, 0xa1, 0xa1, 0xc2, 0x9b, 0x94, 0xbd, 0xb4, 0x9a,
-    0x2d, 0x7a, 0x3e, 0x1f, 0x59, 0xa2, 0x90, 0x61, 0x6a, 0xa9, 0x16, 0x5c,
-    0x7a, 0x6a, 0x3e, 0x0b, 0x3e, 0x47, 0x30, 0x13, 0x1c, 0x23, 0x0f, 0xa8,
-    0xa8, 0x81, 0x5e, 0x2d, 0x6f, 0x27, 0x6f, 0x8a, 0xae, 0xa3, 0x95, 0x6f,
-    0x7a, 0x95, 0x50, 0x95, 0x9b, 0x95, 0x81, 0x8f, 0xad, 0xad, 0xad, 0xa4,
-    0xa4, 0x96, 0x8f, 0x68, 0x49, 0x31, 0x67, 0x96, 0x50, 0x8a, 0x36, 0x05,
-    0x20, 0x31, 0x3d, 0x30, 0x73, 0x2d, 0x0c, 0x2a, 0x06, 0x0c, 0x0c, 0x12,
-    0x12, 0x13, 0x06, 0x03, 0x01, 0x05, 0x0c, 0x15, 0x07, 0x01, 0x01, 0x03,
-    0x05, 0x07, 0x1b, 0x58, 0x82, 0x07, 0x01, 0x01, 0x01, 0x02, 0x1e, 0x72,
-    0x46, 0x58, 0x72, 0x2e, 0x04, 0x2e, 0x62, 0x3a, 0x52, 0x3c, 0x40, 0x28,
-    0x04, 0x01, 0x01, 0x05, 0x01, 0x01, 0x1e, 0x58, 0x4d, 0x3f, 0x17, 0x2a,
-    0x66, 0x66, 0x70, 0x82, 0x70, 0x46, 0x33, 0x42, 0x67, 0x72, 0x42, 0x03,
-    0x01, 0x05, 0x05, 0x01, 0x01, 0x02, 0x23, 0x93, 0x42, 0x7b, 0x3d, 0x05,
-    0x14, 0x87, 0x9f, 0x9f, 0x96, 0x05, 0x06, 0x0b, 0x04, 0x0b, 0x5e, 0x92,
-    0x9b, 0x13, 0x5e, 0x75, 0x7a, 0x6f, 0x83, 0x36, 0x05, 0x03, 0x05, 0x05,
-    0x2d, 0x2c, 0x23, 0x3e, 0x4b, 0x1c, 0x1f, 0x47, 0x55, 0x6a, 0x3d, 0x5e,
-    0x9c, 0x49, 0x83, 0x5c, 0x4b, 0x71, 0x77, 0x2d, 0x3e, 0xaf, 0x8c, 0xa5,
-    0x9c, 0xba, 0x90, 0x8c, 0x94, 0x77, 0x9a, 0x94, 0x34, 0x8d, 0xa9, 0xa6,
-    0x85, 0xba, 0xb1, 0xa9, 0xb7, 0xb7, 0xb7, 0xb2, 0xb2, 0xac, 0xbe, 0xd1,
-    0xcb, 0xd8, 0xd8, 0xbb, 0xbb, 0xa9, 0xb2, 0xb5, 0x94, 0xc7, 0xc7, 0xc4,
-    0xbf, 0xa9, 0xd0, 0xd1, 0xcb, 0xdd, 0xe2, 0xe2, 0xe6, 0xea, 0xe6, 0xeb,
-    0xf1, 0xf3, 0xf3, 0xf1, 0xf1, 0xea, 0xea, 0xd2, 0xea, 0xe7, 0xe7, 0xe7,
-    0xe7, 0xe7, 0xe7, 0xea, 0xea, 0xea, 0xea, 0xec, 0xec, 0xec, 0xea, 0xea,
-    0xea, 0xec, 0xea, 0xea, 0xea, 0xe7, 0xea, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
-    0xe7, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xda, 0xda,
-    0xda, 0xda, 0xd5, 0xd5, 0xd6, 0xda, 0xe2, 0xf2, 0xf6, 0xf2, 0xef, 0xe2,
-    0xdf, 0xe2, 0xe2, 0xd7, 0xc7, 0xc3, 0xba, 0x7a, 0x7a, 0x51, 0x23, 0x36,
-    0x9e, 0xab, 0x8f, 0xa8, 0xc2, 0xba, 0xb1, 0x27, 0x2d, 0x5c, 0x16, 0x2c,
-    0xb5, 0xbd, 0xaf, 0x6f, 0xb5, 0x61, 0x1f, 0x7e, 0xbd, 0x9a, 0x16, 0x26,
-    0x7e, 0xa2, 0x94, 0x36, 0x2d, 0x0b, 0x34, 0x64, 0x83, 0xaf, 0x77, 0x89,
-    0x8f, 0x7a, 0xad, 0x96, 0xb4, 0xad, 0xa1, 0x61, 0xa8, 0x64, 0x9e, 0x81,
-    0x81, 0x6c, 0x7a, 0x8a, 0xa3, 0x9b, 0xae, 0xa4, 0x96, 0x9b, 0x96, 0x96,
-    0x8a, 0x81, 0x24, 0x31, 0x54, 0x50, 0x1a, 0x1d, 0x75, 0x96, 0x87, 0x96,
-    0xa4, 0x6f, 0x04, 0x35, 0x06, 0x06, 0x23, 0x0c, 0x31, 0x06, 0x06, 0x01,
-    0x01, 0x05, 0x03, 0x07, 0x14, 0x06, 0x01, 0x02, 0x01, 0x00, 0x01, 0x04,
-    0x33, 0x1e, 0x01, 0x01, 0x01, 0x01, 0x04, 0x3a, 0x66, 0x60, 0x40, 0x52,
-    0x04, 0x22, 0x3c, 0x52, 0x4d, 0x4d, 0x2f, 0x3a, 0x07, 0x01, 0x01, 0x04,
-    0x01, 0x01, 0x14, 0x58, 0x28, 0x0c, 0x33, 0x58, 0x63, 0x5a, 0x3a, 0x33,
-    0x46, 0x5a, 0x70, 0x70, 0x72, 0x7b, 0x50, 0x04, 0x01, 0x01, 0x01, 0x01,
-    0x05, 0x06, 0x12, 0x1d, 0x13, 0x3d, 0x2d, 0x04, 0x12, 0x86, 0x86, 0x92,
-    0x92, 0x01, 0x05, 0x06, 0x0b, 0x05, 0x36, 0x6f, 0x76, 0x1a, 0x76, 0x61,
-    0xa4, 0x8a, 0x83, 0x15, 0x05, 0x05, 0x0b, 0x01, 0x5e, 0x0e, 0x61, 0x77,
-    0x1f, 0x69, 0x1f, 0x3b, 0x6a, 0x9c, 0x1f, 0x47, 0x9c, 0x4b, 0x77, 0x47,
-    0x7a, 0x94, 0x1f, 0x2d, 0x61, 0xa9, 0x9a, 0x8c, 0xa2, 0x94, 0x83, 0x94,
-    0x77, 0xba, 0x77, 0x8c, 0x55, 0x8d, 0xb7, 0x9c, 0xb5, 0x9c, 0xb7, 0xb5,
-    0xb1, 0xc9, 0xa5, 0x6e, 0xb7, 0xcb, 0x85, 0xdd, 0xbe, 0xbe, 0xc8, 0xd8,
-    0xd7, 0xa6, 0x9d, 0xbb, 0xba, 0xb7, 0xa2, 0xaf, 0xa2, 0xba, 0xb1, 0xc9,
-    0xd1, 0xe2, 0xe7, 0xe7, 0xef, 0xe6, 0xe3, 0xea, 0xea, 0xeb, 0xf1, 0xeb,
-    0xea, 0xe2, 0xe2, 0xb8, 0xb2, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xea, 0xe7,
-    0xea, 0xea, 0xea, 0xec, 0xea, 0xec, 0xea, 0xea, 0xea, 0xe7, 0xe7, 0xe7,
-    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe1, 0xe1, 0xe1,
-    0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xe0,
-    0xef, 0xf1, 0xf2, 0xf6, 0xf6, 0xf2, 0xea, 0xe7, 0xdd, 0xc1, 0xd0, 0xcc,
-    0xc3, 0xc2, 0xc7, 0xb5, 0x94, 0x9c, 0x1d, 0x23, 0xab, 0x54, 0x94, 0xc2,
-    0xba, 0x34, 0x26, 0xa5, 0x8c, 0x75, 0x94, 0xba, 0xbd, 0xbd, 0xb5, 0x8c,
-    0x8c, 0x2c, 0x0b, 0x8c, 0xbd, 0x59, 0x0b, 0x59, 0x75, 0x95, 0x8f, 0x2c,
-    0x27, 0x2d, 0x54, 0x47, 0xb4, 0x9e, 0x8f, 0xa4, 0xad, 0xa8, 0x95, 0x68,
-    0x75, 0x6f, 0x27, 0x8a, 0x68, 0x3b, 0x5e, 0x81, 0x7a, 0xa3, 0x73, 0x4e,
-    0x7a, 0x81, 0xad, 0xa4, 0x96, 0x81, 0xa4, 0x81, 0x1a, 0x50, 0x81, 0x8a,
-    0x6c, 0x3d, 0x81, 0x96, 0x96, 0x96, 0x87, 0x9f, 0x9f, 0x5b, 0x2d, 0x0c,
-    0x20, 0x0f, 0x23, 0x07, 0x13, 0x1b, 0x07, 0x01, 0x01, 0x02, 0x01, 0x01,
-    0x20, 0x2a, 0x01, 0x01, 0x01, 0x01, 0x07, 0x05, 0x02, 0x03, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x46, 0x72, 0x4d, 0x62, 0x72, 0x09, 0x14, 0x2f, 0x3c,
-    0x4d, 0x3c, 0x62, 0x60, 0x1e, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x28,
-    0x1e, 0x24, 0x33, 0x66, 0x1e, 0x1e, 0x66, 0x7b, 0x72, 0x72, 0x72, 0x70,
-    0x82, 0x70, 0x12, 0x05, 0x06, 0x03, 0x03, 0x01, 0x01, 0x05, 0x7b, 0x92,
-    0x3f, 0x3d, 0x12, 0x05, 0x06, 0x23, 0x1b, 0x10, 0x18, 0x06, 0x05, 0x03,
-    0x0b, 0x06, 0x3d, 0x1f, 0x13, 0x1a, 0x6c, 0x75, 0x76, 0x6c, 0x6c, 0x04,
-    0x06, 0x0b, 0x06, 0x05, 0x1c, 0x1a, 0x5c, 0x36, 0x69, 0x61, 0x36, 0x6a,
-    0x6a, 0x2d, 0x1c, 0x36, 0x1f, 0x5c, 0x71, 0x2c, 0x7e, 0x69, 0x1f, 0x85,
-    0x4b, 0x94, 0xa9, 0xac, 0xa2, 0xa9, 0xb5, 0x8c, 0x9c, 0xa2, 0x77, 0x94,
-    0x94, 0x85, 0xb0, 0x98, 0xc9, 0xbf, 0x94, 0xc9, 0x94, 0x98, 0x94, 0xb2,
-    0x7f, 0x55, 0x41, 0x6e, 0x34, 0x32, 0x34, 0x34, 0x57, 0x6e, 0x6e, 0x5c,
-    0x3e, 0x8d, 0xa2, 0xd0, 0x94, 0xbf, 0xc4, 0xc6, 0xc6, 0xdd, 0xe7, 0xea,
-    0xeb, 0xeb, 0xe7, 0xe7, 0xe3, 0xe6, 0xe3, 0xe3, 0xe2, 0xdd, 0xe2, 0xe1,
-    0xdd, 0xe1, 0xe2, 0xe2, 0xe7, 0xe6, 0xea, 0xe7, 0xe7, 0xe7, 0xea, 0xea,
-    0xea, 0xea, 0xe7, 0xe7, 0xea, 0xea, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
-    0xe7, 0xe7, 0xe7, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
-    0xe0, 0xe0, 0xe0, 0xda, 0xda, 0xda, 0xe0, 0xef, 0xf2, 0xf2, 0xf1, 0xf2,
-    0xf6, 0xf1, 0xe7, 0xe0, 0xd6, 0x36, 0x47, 0x83, 0xc2, 0x9e, 0xa1, 0xc4,
-    0xa6, 0x9a, 0x69, 0x9c, 0x5e, 0x8d, 0xc4, 0xc4, 0x85, 0x55, 0xa8, 0x83,
-    0x83, 0xc2, 0xc2, 0xc2, 0xc2, 0xb5, 0xba, 0x49, 0x1f, 0x1f, 0x1c, 0x69,
-    0x6a, 0x1a, 0x1a, 0x8f, 0xaf, 0xbd, 0xb4, 0x49, 0x61, 0x71, 0xab, 0x51,
-    0x75, 0x80, 0xad, 0xb4, 0xaf, 0xad, 0x9e, 0x75, 0x36, 0x2d, 0x75, 0x7a,
-    0xad, 0x68, 0x43, 0x8a, 0x75, 0x95, 0x8f, 0x81, 0x75, 0x96, 0xa3, 0xa4,
-    0xa4, 0x78, 0x68, 0x5b, 0x1a, 0x8f, 0x50, 0x64, 0x5b, 0x6f, 0x9f, 0x96,
-    0x7b, 0x8a, 0x8f, 0x9f, 0x9f, 0x29, 0x67, 0x03, 0x14, 0x1b, 0x31, 0x15,
-    0x3d, 0x50, 0x07, 0x05, 0x05, 0x01, 0x01, 0x02, 0x02, 0x2a, 0x1b, 0x01,
-    0x01, 0x01, 0x07, 0x06, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x2e,
-    0x2e, 0x72, 0x72, 0x72, 0x1b, 0x04, 0x46, 0x3c, 0x2f, 0x46, 0x62, 0x52,
-    0x4d, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x24, 0x28, 0x2a, 0x1b, 0x28,
-    0x72, 0x42, 0x66, 0x72, 0x5a, 0x72, 0x82, 0x63, 0x72, 0x2a, 0x0b, 0x01,
-    0x06, 0x03, 0x01, 0x02, 0x00, 0x05, 0x7b, 0x93, 0x73, 0x3f, 0x42, 0x0b,
-    0x03, 0x87, 0x64, 0x87, 0x27, 0x05, 0x05, 0x05, 0x05, 0x06, 0x27, 0x0c,
-    0x0b, 0x3e, 0x81, 0x8f, 0x75, 0x83, 0x3e, 0x08, 0x11, 0x03, 0x05, 0x0b,
-    0x0b, 0x4b, 0x20, 0x4b, 0x36, 0x6a, 0x5e, 0x1f, 0x3e, 0x41, 0x25, 0x2d,
-    0x6e, 0x69, 0x77, 0x1d, 0x51, 0x23, 0x6a, 0x71, 0x94, 0x64, 0x61, 0x71,
-    0x6a, 0xb5, 0x9c, 0xb1, 0x75, 0x83, 0x7e, 0x9c, 0x77, 0x8c, 0x71, 0xb1,
-    0xa2, 0xb5, 0xbb, 0xa2, 0xb1, 0x5c, 0x5c, 0x65, 0x2c, 0x26, 0x1f, 0x6b,
-    0x88, 0x79, 0x99, 0xb8, 0x85, 0xc1, 0xc1, 0xa6, 0x8d, 0xb1, 0xb1, 0x85,
-    0x97, 0xb7, 0xcf, 0xc9, 0xc6, 0xc6, 0xd1, 0xdd, 0xef, 0xf2, 0xef, 0xe3,
-    0xe7, 0xdf, 0xdd, 0xe2, 0xe7, 0xe2, 0xe2, 0xe1, 0xdd, 0xe2, 0xe1, 0xe1,
-    0xe2, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xea, 0xea, 0xea,
-    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0,
-    0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xda, 0xe2, 0xec, 0xea, 0xe2,
-    0xda, 0xe1, 0xf2, 0xf6, 0xf6, 0xf1, 0xea, 0xea, 0xec, 0xe7, 0xe0, 0xd6,
-    0xce, 0x77, 0x75, 0xa8, 0xb4, 0x71, 0x26, 0x26, 0x69, 0x77, 0x65, 0x8c,
-    0x98, 0xba, 0xb3, 0x51, 0x69, 0x9c, 0xa2, 0x8c, 0xc2, 0xc2, 0xc2, 0xc2,
-    0xc2, 0xaf, 0x8c, 0x16, 0x47, 0x0b, 0x3b, 0x16, 0x59, 0x49, 0x9a, 0x9e,
-    0xa8, 0xb4, 0x6a, 0x64, 0x71, 0x68, 0xb4, 0x68, 0x3b, 0x94, 0x9e, 0xb4,
-    0xad, 0xb4, 0xa3, 0xa3, 0x54, 0x1f, 0x83, 0xad, 0x9e, 0x3e, 0x8f, 0xad,
-    0x5b, 0x78, 0x81, 0x81, 0x81, 0x6f, 0x8a, 0x96, 0x95, 0x68, 0x3d, 0x54,
-    0x31, 0x8a, 0x96, 0x68, 0x81, 0x68, 0x96, 0x8a, 0x68, 0x68, 0x92, 0x96,
-    0x5b, 0x50, 0x5b, 0x05, 0x07, 0x1a, 0x23, 0x29, 0x12, 0x31, 0x06, 0x0b,
-    0x01, 0x03, 0x04, 0x01, 0x01, 0x01, 0x10, 0x14, 0x33, 0x28, 0x07, 0x0a,
-    0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x14, 0x62, 0x72, 0x62, 0x58,
-    0x2e, 0x04, 0x17, 0x52, 0x3c, 0x22, 0x3a, 0x46, 0x33, 0x01, 0x01, 0x03,
-    0x01, 0x01, 0x02, 0x04, 0x28, 0x1b, 0x1e, 0x5a, 0x66, 0x3f, 0x28, 0x58,
-    0x53, 0x66, 0x7b, 0x5a, 0x2a, 0x20, 0x07, 0x01, 0x06, 0x03, 0x06, 0x03,
-    0x02, 0x25, 0x73, 0x93, 0x87, 0x3f, 0x20, 0x1c, 0x01, 0x96, 0x96, 0x9f,
-    0x29, 0x01, 0x05, 0x01, 0x05, 0x06, 0x0b, 0x06, 0x21, 0x54, 0x6c, 0x9b,
-    0x8a, 0x75, 0x0f, 0x0b, 0x03, 0x03, 0x0b, 0x07, 0x11, 0x1a, 0x4b, 0x54,
-    0x6a, 0x3e, 0x51, 0x61, 0x0e, 0x27, 0x1f, 0x5e, 0x47, 0x7e, 0x4b, 0x16,
-    0x21, 0x8c, 0x83, 0x69, 0x83, 0xa2, 0xa9, 0xa1, 0x8d, 0x7a, 0x5c, 0x85,
-    0x8d, 0x77, 0xb5, 0x8c, 0x9c, 0xb1, 0x71, 0xa9, 0xab, 0xb5, 0xc9, 0xc9,
-    0x8d, 0x65, 0x4b, 0x2c, 0x2c, 0xb8, 0x74, 0xb8, 0xcb, 0xd8, 0xa7, 0xc1,
-    0xd8, 0xb2, 0xa5, 0xbf, 0xb1, 0xc4, 0xd7, 0xbb, 0x9c, 0x8d, 0xba, 0xbf,
-    0xd0, 0xc4, 0xe1, 0xe0, 0xe7, 0xef, 0xee, 0xe8, 0xd2, 0xdd, 0xe2, 0xe2,
-    0xe2, 0xdd, 0xdd, 0xe0, 0xda, 0xdd, 0xe7, 0xe7, 0xe7, 0xe2, 0xe7, 0xe7,
-    0xe7, 0xe7, 0xe7, 0xea, 0xf1, 0xf6, 0xf6, 0xee, 0xea, 0xe1, 0xe1, 0xe2,
-    0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
-    0xda, 0xda, 0xda, 0xe0, 0xf2, 0xf6, 0xf2, 0xf2, 0xea, 0xf6, 0xf6, 0xf6,
-    0xf2, 0xef, 0xe7, 0xe2, 0xe2, 0xe0, 0xda, 0xcc, 0xce, 0xaf, 0xbd, 0xc7,
-    0xad, 0x3e, 0x26, 0x26, 0x71, 0x2c, 0x74, 0xb3, 0x8d, 0x97, 0x26, 0x26,
-    0x83, 0xbd, 0xb0, 0x9c, 0xc2, 0xc2, 0xc2, 0xbd, 0xab, 0x83, 0x61, 0x3e,
-    0x26, 0x1f, 0xa2, 0x83, 0x7e, 0x83, 0xb4, 0xbd, 0x9e, 0x8c, 0x27, 0x95,
-    0x75, 0x95, 0x95, 0xa1, 0x83, 0x83, 0x7a, 0x9e, 0xad, 0xa8, 0xa3, 0x7a,
-    0x23, 0x83, 0x75, 0x7a, 0x68, 0x7a, 0x96, 0xad, 0x96, 0x8f, 0x96, 0xa4,
-    0x78, 0x78, 0x49, 0x36, 0x5b, 0x7a, 0x8a, 0x2d, 0x5e, 0x64, 0x73, 0x73,
-    0x49, 0x78, 0x73, 0x6f, 0x5b, 0x42, 0x5b, 0x3d, 0x18, 0x3d, 0x24, 0x0c,
-    0x0b, 0x1b, 0x70, 0x70, 0x29, 0x20, 0x24, 0x1c, 0x06, 0x04, 0x04, 0x03,
-    0x02, 0x02, 0x04, 0x2a, 0x29, 0x72, 0x53, 0x1e, 0x01, 0x02, 0x02, 0x01,
-    0x01, 0x01, 0x01, 0x10, 0x58, 0x4d, 0x2e, 0x10, 0x52, 0x09, 0x04, 0x22,
-    0x2e, 0x2e, 0x2e, 0x40, 0x2e, 0x06, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x24, 0x33, 0x46, 0x2e, 0x42, 0x46, 0x53, 0x4f, 0x53, 0x62, 0x5a, 0x31,
-    0x10, 0x35, 0x0b, 0x01, 0x01, 0x01, 0x01, 0x05, 0x05, 0x3d, 0x53, 0x7b,
-    0x87, 0x31, 0x29, 0x1c, 0x01, 0x92, 0x7d, 0x92, 0x15, 0x02, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x06, 0x1b, 0x5e, 0x5e, 0x5b, 0x7a, 0x54, 0x05, 0x05,
-    0x03, 0x08, 0x05, 0x0b, 0x1a, 0x23, 0x27, 0x3e, 0x5c, 0x6a, 0x3e, 0x3e,
-    0x36, 0x3d, 0x77, 0x5c, 0x55, 0x59, 0x13, 0x16, 0x69, 0x7e, 0x7e, 0x77,
-    0x77, 0x8c, 0x94, 0x85, 0x94, 0x9e, 0x85, 0x77, 0x6a, 0x51, 0xa2, 0xb1,
-    0x9a, 0xa9, 0x9a, 0x9c, 0xa2, 0xa9, 0xba, 0xc4, 0xb5, 0xb7, 0x5c, 0x34,
-    0x77, 0xa6, 0x9d, 0x8d, 0xa6, 0xc6, 0xd8, 0xa7, 0xa7, 0xcb, 0xd0, 0xa9,
-    0xc9, 0x9c, 0xbf, 0xbf, 0xcc, 0xbf, 0x94, 0x97, 0xc4, 0xd0, 0xda, 0xd7,
-    0xd7, 0xdf, 0xdb, 0xf1, 0xd9, 0xd7, 0xda, 0xe0, 0xc6, 0xe1, 0xd0, 0xd6,
-    0xda, 0xe6, 0xf2, 0xf3, 0xf2, 0xea, 0xe7, 0xe7, 0xe7, 0xea, 0xec, 0xf6,
-    0xfa, 0xfa, 0xf6, 0xf6, 0xf2, 0xe7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
-    0xe0, 0xe0, 0xe0, 0xe0, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xe0, 0xea,
-    0xf6, 0xf6, 0xf2, 0xf1, 0xf2, 0xf6, 0xf6, 0xf6, 0xf2, 0xea, 0xe7, 0xe2,
-    0xe0, 0xd7, 0xd5, 0xce, 0xce, 0xc7, 0xc7, 0xc7, 0xbd, 0x6a, 0x26, 0x98,
-    0x51, 0x32, 0x16, 0x44, 0x15, 0x34, 0x2d, 0x85, 0xc2, 0xbf, 0x75, 0xaf,
-    0xba, 0xc2, 0xc2, 0xb5, 0x27, 0xa1, 0x2d, 0x26, 0x26, 0x3e, 0x9e, 0x9e,
-    0x75, 0x61, 0xb4, 0x9e, 0x65, 0x43, 0x95, 0xad, 0xa8, 0x95, 0x8a, 0x71,
-    0x95, 0x68, 0x8a, 0x6f, 0x75, 0x7a, 0x75, 0x23, 0x6f, 0x8f, 0x8a, 0x4e,
-    0x9b, 0x9e, 0x9b, 0x95, 0xa4, 0x75, 0x8a, 0x9b, 0x8f, 0x8c, 0x68, 0x4e,
-    0xa4, 0x8a, 0x5b, 0x36, 0x73, 0x78, 0x5b, 0x68, 0x54, 0x5b, 0x96, 0x96,
-    0x3d, 0x6c, 0x5b, 0x23, 0x29, 0x5b, 0x0c, 0x06, 0x0b, 0x10, 0x73, 0x7b,
-    0x49, 0x04, 0x14, 0x13, 0x12, 0x06, 0x03, 0x03, 0x02, 0x01, 0x01, 0x04,
-    0x10, 0x53, 0x4d, 0x72, 0x24, 0x14, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x14, 0x24, 0x1e, 0x1e, 0x3c, 0x17, 0x04, 0x22, 0x33, 0x4d, 0x4d, 0x60,
-    0x3c, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x33, 0x33, 0x58, 0x4d,
-    0x53, 0x4f, 0x72, 0x53, 0x5a, 0x5a, 0x33, 0x35, 0x13, 0x1b, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x04, 0x3f, 0x33, 0x50, 0x53, 0x27, 0x73, 0x27,
-    0x01, 0x7d, 0x73, 0x6c, 0x0c, 0x01, 0x05, 0x05, 0x05, 0x0e, 0x06, 0x26,
-    0x25, 0x49, 0x75, 0x92, 0x61, 0x23, 0x08, 0x08, 0x06, 0x03, 0x0b, 0x0b,
-    0x3e, 0x49, 0x61, 0x2d, 0x59, 0x6a, 0x8a, 0x76, 0x51, 0x27, 0x6a, 0x55,
-    0x2c, 0x1f, 0x16, 0x2d, 0x7e, 0x83, 0x7e, 0x7e, 0x71, 0x94, 0x7a, 0x83,
-    0xaf, 0xa2, 0x8c, 0xa9, 0x94, 0x8d, 0x61, 0xb1, 0xaf, 0xb5, 0x94, 0x7e,
-    0x83, 0xb1, 0xb5, 0xb5, 0xb1, 0xac, 0x41, 0xa2, 0x9c, 0x74, 0x8d, 0x85,
-    0x6e, 0x9d, 0xb2, 0xbb, 0x7f, 0x97, 0xcb, 0xc6, 0xc1, 0xa9, 0x85, 0xc2,
-    0xcc, 0xcc, 0xcc, 0x90, 0x9c, 0xb7, 0xda, 0xd0, 0xd1, 0xd1, 0xea, 0xf2,
-    0xec, 0xdd, 0xda, 0xd8, 0x7f, 0xe2, 0xdd, 0xe3, 0xea, 0xf4, 0xfa, 0xf6,
-    0xf2, 0xf6, 0xec, 0xe7, 0xe7, 0xec, 0xf6, 0xfa, 0xfa, 0xf6, 0xf6, 0xf6,
-    0xf2, 0xe7, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xda, 0xda, 0xda, 0xda,
-    0xda, 0xda, 0xda, 0xda, 0xda, 0xe7, 0xf2, 0xf6, 0xf6, 0xf6, 0xf2, 0xef,
-    0xf2, 0xf6, 0xf6, 0xf3, 0xf1, 0xe7, 0xe2, 0xe0, 0xdd, 0xd6, 0xd5, 0xcc,
-    0xcc, 0xc7, 0xc3, 0xc2, 0xb4, 0xb4, 0x85, 0xbf, 0x7f, 0x1f, 0x5f, 0x4b,
-    0x34, 0x6a, 0xab, 0xc2, 0xba, 0xb0, 0x85, 0xba, 0x9b, 0xba, 0xbd, 0x6a,
-    0x1f, 0x1f, 0x2c, 0x1a, 0x1f, 0x26, 0x9a, 0x47, 0x1f, 0x3e, 0x83, 0x4b,
-    0x1a, 0x95, 0x95, 0x9e, 0xb4, 0x95, 0x95, 0x95, 0x9e, 0x95, 0x8a, 0x81,
-    0x75, 0x83, 0x6f, 0x3d, 0x8c, 0x7a, 0xa3, 0x7a, 0x8a, 0x75, 0x75, 0x81,
-    0x8f, 0x78, 0x4e, 0x75, 0x78, 0x8f, 0xa4, 0x78, 0x8f, 0x75, 0x3d, 0x4e,
-    0x75, 0x78, 0x78, 0x6f, 0x5b, 0x29, 0x5b, 0x5b, 0x2d, 0x3d, 0x86, 0x3d,
-    0x50, 0x14, 0x0b, 0x14, 0x23, 0x20, 0x23, 0x50, 0x18, 0x12, 0x5b, 0x31,
-    0x13, 0x06, 0x05, 0x04, 0x01, 0x01, 0x01, 0x03, 0x20, 0x67, 0x4d, 0x63,
-    0x4d, 0x4d, 0x14, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x03, 0x04, 0x33,
-    0x2f, 0x28, 0x04, 0x1e, 0x3a, 0x40, 0x3c, 0x40, 0x4d, 0x1e, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x02, 0x14, 0x14, 0x33, 0x1e, 0x3a, 0x4f, 0x72, 0x58,
-    0x24, 0x35, 0x28, 0x2a, 0x3d, 0x3f, 0x02, 0x03, 0x03, 0x01, 0x01, 0x01,
-    0x06, 0x25, 0x35, 0x5b, 0x50, 0x31, 0x7d, 0x29, 0x01, 0x31, 0x73, 0x7d,
-    0x0c, 0x05, 0x06, 0x06, 0x04, 0x13, 0x2d, 0x5b, 0x14, 0x54, 0x9b, 0xae,
-    0x9b, 0x23, 0x05, 0x05, 0x06, 0x08, 0x06, 0x3b, 0x83, 0x8c, 0xbc, 0x59,
-    0x61, 0x7a, 0x8f, 0x7a, 0x5c, 0x5e, 0x1f, 0x1f, 0x13, 0x16, 0x26, 0x55,
-    0x6a, 0x71, 0x94, 0x71, 0x7e, 0x83, 0x83, 0x83, 0xaf, 0x8c, 0x90, 0x9c,
-    0x83, 0xba, 0x4b, 0x8c, 0xba, 0xbf, 0x6a, 0xa2, 0x9c, 0xa2, 0xb1, 0xa2,
-    0x7f, 0x4b, 0x85, 0xd0, 0xa5, 0xa5, 0x98, 0xa2, 0xa6, 0xac, 0xb7, 0xbb,
-    0xc6, 0x9d, 0x97, 0xb8, 0xb1, 0xc1, 0x98, 0xae, 0xc7, 0xcc, 0xc7, 0xc9,
-    0xbf, 0x8d, 0xb7, 0xd6, 0xd1, 0xd8, 0xe3, 0xf2, 0xf2, 0xeb, 0xdf, 0xeb,
-    0xc0, 0xf1, 0xf2, 0xf2, 0xf3, 0xf4, 0xf6, 0xf2, 0xf2, 0xf6, 0xf6, 0xf2,
-    0xf1, 0xf6, 0xfa, 0xfa, 0xf6, 0xf6, 0xf6, 0xf3, 0xf2, 0xec, 0xe0, 0xe0,
-    0xe0, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xda, 0xda,
-    0xe0, 0xf2, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xef, 0xf2, 0xf6, 0xf6, 0xf2,
-    0xef, 0xe2, 0xe0, 0xda, 0xd6, 0xd5, 0xcc, 0xcc, 0xc7, 0xc7, 0xc7, 0xc7,
-    0xc3, 0xc2, 0x9c, 0x90, 0x85, 0x5e, 0xa6, 0xa5, 0x94, 0xa2, 0xc7, 0xc2,
-    0xc2, 0xaf, 0xaf, 0xba, 0x85, 0x61, 0x61, 0x16, 0x1f, 0x16, 0x83, 0x2d,
-    0x21, 0x0e, 0x8c, 0x71, 0x59, 0x59, 0x61, 0x16, 0x94, 0xb4, 0xad, 0x9e,
-    0xb4, 0xb4, 0x95, 0x9e, 0x8a, 0x9e, 0x9e, 0x8f, 0x81, 0x81, 0x43, 0x8f,
-    0x9e, 0xad, 0x95, 0xa3, 0x8f, 0x8a, 0xa3, 0xa4, 0xad, 0xad, 0x81, 0x75,
-    0xa3, 0xa3, 0x81, 0x75, 0x78, 0x78, 0x78, 0x50, 0x5b, 0x78, 0x4e, 0x73,
-    0x29, 0x3d, 0x27, 0x23, 0x1b, 0x1b, 0x2d, 0x23, 0x1d, 0x1d, 0x20, 0x54,
-    0x29, 0x49, 0x0c, 0x50, 0x14, 0x07, 0x87, 0x33, 0x0c, 0x0b, 0x14, 0x03,
-    0x05, 0x01, 0x01, 0x01, 0x06, 0x33, 0x33, 0x66, 0x58, 0x3a, 0x46, 0x09,
-    0x01, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x01, 0x4d, 0x2e, 0x04, 0x10,
-    0x3a, 0x22, 0x33, 0x2e, 0x2e, 0x28, 0x05, 0x01, 0x01, 0x01, 0x03, 0x01,
-    0x20, 0x28, 0x1b, 0x09, 0x1e, 0x1d, 0x3a, 0x2a, 0x24, 0x28, 0x5a, 0x1e,
-    0x33, 0x17, 0x01, 0x0b, 0x06, 0x01, 0x01, 0x01, 0x04, 0x1b, 0x1b, 0x3f,
-    0x73, 0x64, 0x53, 0x3d, 0x03, 0x31, 0x67, 0x86, 0x13, 0x02, 0x06, 0x05,
-    0x06, 0x2d, 0x73, 0x92, 0x1a, 0x1a, 0x54, 0x64, 0x49, 0x15, 0x03, 0x03,
-    0x06, 0x0b, 0x0a, 0x9e, 0x8a, 0x9b, 0xae, 0x90, 0x6a, 0x71, 0x8c, 0x83,
-    0x59, 0x7a, 0x21, 0x0c, 0x2c, 0x1a, 0x61, 0x61, 0x5c, 0x55, 0x94, 0x71,
-    0x94, 0x61, 0x8c, 0xa1, 0x94, 0xa8, 0x9a, 0x9c, 0x77, 0xbf, 0x98, 0x54,
-    0xb7, 0xb5, 0x8d, 0xb7, 0xbb, 0x94, 0xba, 0x94, 0x3e, 0x8d, 0x8d, 0xb1,
-    0xac, 0xa2, 0x98, 0xa2, 0xbb, 0xc1, 0xb1, 0xc1, 0xc9, 0xcb, 0xa6, 0x88,
-    0x9c, 0xcb, 0xbb, 0xb0, 0xb0, 0xc2, 0xc2, 0xcc, 0xbf, 0xc1, 0x85, 0xb1,
-    0xc6, 0xd1, 0xd9, 0xe4, 0xe5, 0xe5, 0xee, 0xe5, 0xe9, 0xf0, 0xf6, 0xf2,
-    0xf0, 0xf6, 0xf6, 0xf2, 0xf1, 0xf2, 0xf6, 0xf6, 0xf6, 0xf9, 0xfa, 0xf6,
-    0xf6, 0xf2, 0xf2, 0xf2, 0xf6, 0xf2, 0xe0, 0xda, 0xda, 0xda, 0xd5, 0xda,
-    0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xef, 0xf6, 0xf6, 0xf2,
-    0xf2, 0xef, 0xec, 0xef, 0xf2, 0xf2, 0xf6, 0xf2, 0xec, 0xe2, 0xe0, 0xd7,
-    0xd5, 0xce, 0xce, 0xc7, 0xc2, 0xc7, 0xb5, 0xb4, 0x9e, 0x7a, 0x7e, 0x61,
-    0x8d, 0xbb, 0x94, 0xb5, 0x94, 0xbf, 0xc2, 0xc2, 0xc2, 0x9a, 0xc2, 0x9c,
-    0x51, 0x36, 0x13, 0x1a, 0x61, 0x0e, 0x61, 0x1f, 0x0b, 0x1f, 0xb5, 0x9b,
-    0xa2, 0x4e, 0x36, 0x43, 0xaf, 0xad, 0xb4, 0xad, 0x9e, 0xb4, 0x9e, 0xb4,
-    0x9e, 0x95, 0x9b, 0x9e, 0xa3, 0x68, 0x75, 0xb4, 0xad, 0xad, 0xa3, 0xa3,
-    0x8f, 0x7a, 0x95, 0x9b, 0xad, 0xad, 0xa4, 0x83, 0x73, 0xa4, 0x7a, 0x81,
-    0x81, 0x8a, 0x81, 0x1d, 0x6f, 0x81, 0x5b, 0x49, 0x13, 0x1d, 0x1d, 0x23,
-    0x0b, 0x07, 0x27, 0x1d, 0x06, 0x20, 0x12, 0x31, 0x0f, 0x42, 0x49, 0x23,
-    0x13, 0x0c, 0x42, 0x2a, 0x06, 0x0b, 0x23, 0x20, 0x01, 0x03, 0x03, 0x01,
-    0x01, 0x06, 0x33, 0x72, 0x63, 0x28, 0x2a, 0x10, 0x01, 0x02, 0x02, 0x00,
-    0x01, 0x01, 0x02, 0x02, 0x3c, 0x3a, 0x0b, 0x07, 0x28, 0x28, 0x2e, 0x17,
-    0x40, 0x4f, 0x06, 0x01, 0x01, 0x01, 0x02, 0x01, 0x10, 0x33, 0x62, 0x33,
-    0x04, 0x04, 0x06, 0x04, 0x13, 0x46, 0x5a, 0x3f, 0x70, 0x13, 0x01, 0x05,
-    0x05, 0x01, 0x01, 0x01, 0x0c, 0x29, 0x42, 0x49, 0x2a, 0x73, 0x50, 0x3f,
-    0x01, 0x50, 0x73, 0x50, 0x13, 0x04, 0x05, 0x01, 0x01, 0x31, 0x86, 0x8a,
-    0x2b, 0x0b, 0x6c, 0x81, 0x36, 0x0b, 0x03, 0x04, 0x0b, 0x05, 0x25, 0xa4,
-    0x8f, 0x8f, 0x9b, 0x59, 0x61, 0x75, 0x7a, 0x9e, 0x71, 0x7e, 0x15, 0x26,
-    0x21, 0x55, 0x6a, 0x5c, 0x69, 0x65, 0x83, 0x61, 0x83, 0x6a, 0x77, 0x83,
-    0x8c, 0xa9, 0x7e, 0x9c, 0x85, 0x9e, 0xa8, 0x71, 0x94, 0xbf, 0x8c, 0xb1,
-    0xa9, 0x9c, 0x98, 0x2d, 0x8c, 0x8d, 0x8d, 0x9c, 0xbf, 0xb1, 0xb7, 0xa5,
-    0xba, 0xc9, 0xc1, 0xbb, 0xd0, 0xc4, 0xd7, 0xc1, 0x97, 0x77, 0xc4, 0xb0,
-    0xbc, 0xb0, 0xb5, 0xb5, 0xbf, 0xc9, 0xb1, 0x8d, 0xd0, 0xda, 0xe6, 0xe6,
-    0xeb, 0xf0, 0xe8, 0xe4, 0xeb, 0xea, 0xf1, 0xf2, 0xf1, 0xf6, 0xf2, 0xec,
-    0xef, 0xf1, 0xf2, 0xf1, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xf2, 0xef, 0xf2,
-    0xf2, 0xec, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5,
-    0xd5, 0xd5, 0xd5, 0xe7, 0xf6, 0xf6, 0xf6, 0xf2, 0xf2, 0xef, 0xea, 0xec,
-    0xef, 0xec, 0xf1, 0xef, 0xea, 0xe2, 0xdd, 0xd6, 0xd7, 0xce, 0xcc, 0xc7,
-    0xc7, 0xc2, 0xbd, 0x8c, 0x75, 0x7a, 0x77, 0x2d, 0xba, 0x9c, 0xbf, 0x9c,
-    0xa9, 0xc2, 0xc3, 0xc7, 0xa1, 0xb5, 0xbd, 0x83, 0x26, 0xa1, 0x2d, 0x83,
-    0x89, 0x5e, 0x3e, 0x0e, 0x0e, 0x1f, 0x9a, 0x27, 0x61, 0x36, 0x95, 0x9e,
-    0x9e, 0x9e, 0xb4, 0xb4, 0xa3, 0xa8, 0xad, 0xa4, 0xb4, 0xb4, 0xad, 0xb4,
-    0x8a, 0x3e, 0xa3, 0xad, 0xad, 0xad, 0xad, 0xa3, 0x96, 0x59, 0x9b, 0x8f,
-    0xa3, 0xa4, 0x96, 0x9b, 0x75, 0x68, 0x6f, 0x96, 0x96, 0x8a, 0x8f, 0x49,
-    0x78, 0x96, 0x43, 0x29, 0x5b, 0x43, 0x5b, 0x1a, 0x31, 0x31, 0x2d, 0x1b,
-    0x3d, 0x50, 0x15, 0x2a, 0x2d, 0x67, 0x31, 0x0c, 0x15, 0x1b, 0x1d, 0x31,
-    0x06, 0x04, 0x13, 0x63, 0x14, 0x05, 0x01, 0x01, 0x01, 0x02, 0x14, 0x46,
-    0x46, 0x46, 0x28, 0x10, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x00, 0x01,
-    0x2f, 0x4d, 0x17, 0x01, 0x22, 0x28, 0x17, 0x22, 0x3a, 0x24, 0x02, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x06, 0x2a, 0x2a, 0x2f, 0x28, 0x17, 0x33, 0x1e,
-    0x12, 0x0d, 0x0c, 0x18, 0x3f, 0x0c, 0x01, 0x01, 0x05, 0x01, 0x01, 0x02,
-    0x1e, 0x2a, 0x5b, 0x53, 0x50, 0x1b, 0x3d, 0x24, 0x03, 0x35, 0x9f, 0x96,
-    0x15, 0x06, 0x03, 0x03, 0x03, 0x15, 0x5b, 0x8a, 0x31, 0x36, 0x81, 0x6c,
-    0x64, 0x05, 0x03, 0x0b, 0x05, 0x01, 0x3e, 0x83, 0x83, 0x9b, 0x8c, 0x61,
-    0x76, 0x75, 0x9b, 0xaf, 0x75, 0x7a, 0x0c, 0x11, 0x27, 0x65, 0x8a, 0x59,
-    0x75, 0x8c, 0x9a, 0x6a, 0x5e, 0xa2, 0x7e, 0x94, 0x8c, 0xab, 0x85, 0xaf,
-    0xa1, 0x9e, 0x90, 0x94, 0x55, 0xbf, 0x8c, 0xb1, 0x9a, 0x85, 0x36, 0xb7,
-    0xb1, 0x36, 0xa9, 0xba, 0xc9, 0xa9, 0xba, 0xac, 0x9a, 0xb7, 0xc1, 0xc6,
-    0xb7, 0xc4, 0xd6, 0xd0, 0xc4, 0xbb, 0x77, 0x77, 0x85, 0x7a, 0x8d, 0xb0,
-    0xbf, 0xcf, 0xd7, 0xc9, 0x98, 0xd0, 0xe7, 0xe2, 0xea, 0xe4, 0xe6, 0xe6,
-    0xe7, 0xe2, 0xea, 0xf1, 0xf1, 0xf2, 0xf2, 0xec, 0xec, 0xef, 0xec, 0xea,
-    0xf2, 0xf6, 0xf6, 0xf6, 0xf2, 0xef, 0xec, 0xec, 0xf2, 0xe7, 0xda, 0xd5,
-    0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd5, 0xe7,
-    0xf6, 0xf2, 0xf6, 0xf2, 0xf1, 0xec, 0xe2, 0xe7, 0xe7, 0xe7, 0xef, 0xef,
-    0xe7, 0xe2, 0xda, 0xd6, 0xd5, 0xcf, 0xc7, 0xce, 0xc7, 0xba, 0xa2, 0xa8,
-    0x9a, 0x9c, 0x54, 0x71, 0xb1, 0xbf, 0xab, 0x9e, 0xba, 0xc3, 0xc2, 0xaf,
-    0x9e, 0xc2, 0xaf, 0xaf, 0x8c, 0xbd, 0xb4, 0xbd, 0x94, 0x9a, 0x4b, 0x0e,
-    0x1f, 0x1c, 0x59, 0x7a, 0x59, 0x7a, 0xb5, 0x9e, 0xa8, 0x8f, 0x9e, 0xb4,
-    0xad, 0xaf, 0xad, 0xa4, 0xad, 0x95, 0xad, 0x81, 0x8a, 0x1d, 0xad, 0xad,
-    0xad, 0xad, 0xad, 0xad, 0xad, 0x78, 0x68, 0x8c, 0x78, 0x95, 0x96, 0x96,
-    0x9b, 0x81, 0x75, 0x75, 0x96, 0x7a, 0x75, 0x49, 0x4e, 0x6f, 0x49, 0x68,
-    0x8a, 0x96, 0x73, 0x0c, 0x42, 0x1d, 0x10, 0x1d, 0x5b, 0x31, 0x1b, 0x1b,
-    0x1d, 0x1b, 0x54, 0x2a, 0x06, 0x5b, 0x2a, 0x42, 0x0b, 0x0c, 0x10, 0x93,
-    0x1b, 0x06, 0x05, 0x03, 0x01, 0x02, 0x02, 0x28, 0x66, 0x46, 0x46, 0x4d,
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x07, 0x01, 0x00, 0x2e, 0x28, 0x28, 0x03,
-    0x2f, 0x4d, 0x28, 0x24, 0x07, 0x04, 0x07, 0x01, 0x01, 0x03, 0x05, 0x01,
-    0x01, 0x19, 0x4d, 0x58, 0x28, 0x4f, 0x62, 0x72, 0x62, 0x66, 0x4f, 0x33,
-    0x24, 0x04, 0x05, 0x01, 0x03, 0x01, 0x01, 0x02, 0x56, 0x2a, 0x5a, 0x7d,
-    0x70, 0x3f, 0x1b, 0x25, 0x01, 0x49, 0x9f, 0x73, 0x0b, 0x05, 0x01, 0x01,
-    0x01, 0x23, 0x86, 0x78, 0x27, 0x23, 0xa1, 0x49, 0x1c, 0x01, 0x05, 0x05,
-    0x02, 0x06, 0x71, 0x23, 0x54, 0x31, 0x5e, 0x54, 0x31, 0x3d, 0x59, 0x9c,
-    0x7a, 0x61, 0x0b, 0x0b, 0x59, 0x7e, 0x61, 0x94, 0x85, 0x94, 0x54, 0x89,
-    0x9a, 0x6c, 0x9c, 0xaf, 0x83, 0xaf, 0x9b, 0xbd, 0xa9, 0xb5, 0x9c, 0x9a,
-    0x90, 0x94, 0xaf, 0xa1, 0x77, 0x1a, 0x71, 0x97, 0xa2, 0x85, 0xb5, 0xc4,
-    0xbf, 0xb1, 0xb5, 0xb1, 0xc6, 0xc9, 0xcb, 0xb1, 0xbf, 0xb1, 0xcb, 0xd0,
-    0xc9, 0xc4, 0xb5, 0x8d, 0x94, 0x61, 0x83, 0xc7, 0xce, 0xcc, 0xd5, 0xcc,
-    0xa9, 0x8d, 0xd1, 0xd1, 0xd8, 0xe3, 0xe7, 0xe2, 0xe2, 0xe2, 0xea, 0xf1,
-    0xee, 0xf2, 0xf1, 0xec, 0xea, 0xef, 0xea, 0xea, 0xf2, 0xf6, 0xf6, 0xf3,
-    0xf2, 0xef, 0xe7, 0xea, 0xec, 0xe7, 0xe1, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5,
-    0xd5, 0xd5, 0xd5, 0xd5, 0xce, 0xe7, 0xec, 0xec, 0xf6, 0xf2, 0xf2, 0xf1,
-    0xec, 0xe7, 0xe1, 0xe0, 0xea, 0xea, 0xec, 0xea, 0xe2, 0xe2, 0xe0, 0xd6,
-    0xce, 0xcc, 0xc2, 0xc7, 0xc7, 0xb5, 0x83, 0xba, 0xae, 0x9a, 0x9c, 0xa9,
-    0x8c, 0xb7, 0xa5, 0xc2, 0xba, 0xc2, 0xc2, 0x9a, 0xc2, 0xbd, 0xc2, 0xbd,
-    0xc2, 0xbd, 0xbd, 0xbd, 0x9e, 0x71, 0x11, 0x0e, 0x51, 0x4e, 0x9e, 0xa5,
-    0x27, 0x54, 0xaf, 0xaf, 0xa4, 0xaf, 0x95, 0x8a, 0x9e, 0xad, 0xa3, 0xa8,
-    0xa3, 0x9e, 0x75, 0x75, 0x9e, 0x83, 0xa3, 0x75, 0xa4, 0xad, 0xad, 0xad,
-    0xa3, 0x8f, 0x43, 0x6f, 0x73, 0x6f, 0x42, 0x6f, 0x96, 0x23, 0x49, 0x81,
-    0x3d, 0x43, 0x18, 0x30, 0x81, 0x96, 0x5b, 0x4e, 0x8f, 0x96, 0x31, 0x07,
-    0x1f, 0x26, 0x1a, 0x1b, 0x29, 0x10, 0x64, 0x23, 0x13, 0x1b, 0x33, 0x31,
-    0x1b, 0x53, 0x2a, 0x20, 0x20, 0x0b, 0x1b, 0x67, 0x42, 0x1b, 0x03, 0x03,
-    0x03, 0x05, 0x04, 0x04, 0x66, 0x46, 0x24, 0x4f, 0x0c, 0x01, 0x01, 0x02,
-    0x01, 0x0d, 0x07, 0x01, 0x2e, 0x22, 0x14, 0x04, 0x22, 0x1e, 0x0d, 0x07,
-    0x3a, 0x14, 0x1e, 0x01, 0x03, 0x04, 0x01, 0x01, 0x01, 0x66, 0x4d, 0x2e,
-    0x72, 0x46, 0x5a, 0x72, 0x72, 0x58, 0x72, 0x5a, 0x67, 0x01, 0x01, 0x03,
-    0x03, 0x03, 0x01, 0x01, 0x50, 0x25, 0x42, 0x5a, 0x73, 0x42, 0x73, 0x01,
-    0x01, 0x31, 0x87, 0x25, 0x0b, 0x02, 0x01, 0x05, 0x01, 0x04, 0x23, 0x78,
-    0x35, 0x0c, 0x8a, 0x54, 0x01, 0x05, 0x0b, 0x03, 0x01, 0x20, 0x9b, 0x7a,
-    0x9b, 0xa1, 0x8f, 0xa1, 0x83, 0x5e, 0x8c, 0x49, 0x61, 0x27, 0x11, 0x3e,
-    0x4b, 0x7a, 0x85, 0x59, 0x49, 0x77, 0x77, 0x7a, 0x8c, 0x71, 0x7a, 0xaf,
-    0x94, 0x8c, 0x90, 0xb5, 0xb0, 0x61, 0x85, 0x8c, 0x94, 0x65, 0xb5, 0x71,
-    0x15, 0x51, 0x98, 0x71, 0xb1, 0xa5, 0xc4, 0xba, 0xba, 0xa2, 0xb1, 0xb1,
-    0xbf, 0xc9, 0xc9, 0xc1, 0xd6, 0xbb, 0xb1, 0xba, 0xc9, 0xc4, 0xc4, 0x83,
-    0xa5, 0xba, 0x77, 0xa1, 0xc9, 0xd0, 0xd6, 0xd6, 0xc9, 0xc4, 0x97, 0xb7,
-    0xcf, 0xd7, 0xe2, 0xe7, 0xe7, 0xe7, 0xea, 0xe6, 0xf1, 0xef, 0xee, 0xef,
-    0xf2, 0xf1, 0xec, 0xec, 0xf2, 0xf6, 0xf3, 0xf2, 0xf2, 0xec, 0xe7, 0xe7,
-    0xe7, 0xe7, 0xe7, 0xd7, 0xd5, 0xd5, 0xd5, 0xd5, 0xce, 0xce, 0xce, 0xce,
-    0xd5, 0xef, 0xf6, 0xf2, 0xf6, 0xf2, 0xf2, 0xec, 0xe7, 0xe0, 0xe0, 0xdd,
-    0xe2, 0xe7, 0xe7, 0xe2, 0xe0, 0xe7, 0xe0, 0xd7, 0xce, 0xcc, 0xc7, 0xb5,
-    0xcf, 0xa7, 0x9c, 0xb1, 0x9a, 0x75, 0x94, 0x77, 0x71, 0x8c, 0xa8, 0xc2,
-    0xbd, 0xc2, 0x9c, 0xb4, 0xc2, 0xc2, 0xc2, 0xbd, 0xbd, 0xb4, 0xbd, 0xb4,
-    0x61, 0x07, 0x1f, 0x5e, 0xb5, 0xaf, 0xa8, 0x54, 0x89, 0x71, 0x61, 0x8a,
-    0x94, 0x8a, 0x95, 0x89, 0x80, 0x75, 0x68, 0xa3, 0x95, 0x7a, 0x43, 0x95,
-    0x81, 0x95, 0xa3, 0x8f, 0xad, 0xad, 0xad, 0x8f, 0x9e, 0x78, 0xa3, 0x75,
-    0x31, 0xa4, 0x8f, 0x68, 0x50, 0x54, 0x49, 0x4e, 0x50, 0x31, 0x2d, 0x64,
-    0x6f, 0x78, 0x78, 0x1f, 0x27, 0x54, 0x06, 0x13, 0x23, 0x14, 0x1f, 0x13,
-    0x36, 0x12, 0x23, 0x18, 0x13, 0x29, 0x6f, 0x2a, 0x73, 0x2a, 0x50, 0x1b,
-    0x1b, 0x0c, 0x33, 0x53, 0x1e, 0x07, 0x06, 0x04, 0x01, 0x02, 0x01, 0x01,
-    0x07, 0x28, 0x63, 0x58, 0x28, 0x02, 0x01, 0x02, 0x01, 0x04, 0x07, 0x04,
-    0x22, 0x17, 0x2a, 0x05, 0x03, 0x14, 0x22, 0x22, 0x22, 0x28, 0x3a, 0x01,
-    0x0a, 0x05, 0x01, 0x01, 0x02, 0x22, 0x28, 0x58, 0x3c, 0x4d, 0x3a, 0x72,
-    0x3a, 0x66, 0x4f, 0x5a, 0x1e, 0x01, 0x01, 0x01, 0x03, 0x04, 0x03, 0x07,
-    0x31, 0x1b, 0x3f, 0x27, 0x73, 0x50, 0x2d, 0x0c, 0x05, 0x20, 0x54, 0x04,
-    0x0b, 0x03, 0x01, 0x06, 0x03, 0x01, 0x27, 0x73, 0x27, 0x0c, 0x5e, 0x3e,
-    0x01, 0x0b, 0x0b, 0x01, 0x01, 0x36, 0x68, 0x8a, 0x94, 0x81, 0x83, 0x7a,
-    0x9b, 0xa1, 0x4e, 0x59, 0x3d, 0x16, 0x2d, 0x75, 0x69, 0x8c, 0x54, 0x59,
-    0x3e, 0x77, 0x8c, 0x83, 0x69, 0x9a, 0x94, 0x94, 0x83, 0x8c, 0x94, 0xbd,
-    0xbd, 0xba, 0xa9, 0x80, 0x71, 0x85, 0x54, 0x1f, 0x1a, 0x34, 0x47, 0x6a,
-    0xbf, 0x94, 0xc9, 0xb5, 0xb1, 0xa9, 0xa2, 0xba, 0xb5, 0xbf, 0xc9, 0xc4,
-    0xc9, 0xc9, 0xa9, 0xba, 0xc4, 0xc9, 0xd0, 0x9c, 0xa5, 0xb0, 0xa5, 0x9b,
-    0x94, 0xc9, 0xd6, 0xd6, 0xd0, 0xc4, 0xbf, 0x9c, 0xc9, 0xcf, 0xe2, 0xe2,
-    0xe2, 0xdd, 0xea, 0xe6, 0xec, 0xec, 0xec, 0xec, 0xea, 0xea, 0xe7, 0xec,
-    0xf1, 0xf2, 0xf2, 0xf2, 0xef, 0xea, 0xe7, 0xe1, 0xe1, 0xe1, 0xe1, 0xda,
-    0xd5, 0xd5, 0xd5, 0xce, 0xce, 0xce, 0xce, 0xce, 0xdd, 0xf2, 0xf2, 0xf2,
-    0xf6, 0xf2, 0xf2, 0xea, 0xe0, 0xe0, 0xdd, 0xda, 0xda, 0xe0, 0xda, 0xd7,
-    0xe2, 0xe7, 0xdd, 0xcf, 0xcc, 0xcc, 0xc7, 0xc7, 0x97, 0x2c, 0xa5, 0x77,
-    0x9c, 0x83, 0x8c, 0x94, 0x8c, 0x8c, 0xbd, 0xbd, 0xba, 0x94, 0xb5, 0xc2,
-    0xbd, 0xbd, 0xc2, 0xbd, 0xba, 0xbd, 0xb5, 0x6a, 0x0e, 0x1a, 0xaf, 0x9e,
-    0xad, 0xa1, 0x59, 0xa8, 0x95, 0xa8, 0x8c, 0x81, 0xa8, 0x9e, 0xa8, 0xa8,
-    0xae, 0xa8, 0x59, 0x3d, 0x43, 0x7a, 0x8a, 0xad, 0x59, 0x83, 0xad, 0xad,
-    0xad, 0xad, 0xa3, 0x61, 0x89, 0x6f, 0xa3, 0x6f, 0x4e, 0x6f, 0x7a, 0x73,
-    0x75, 0x9b, 0x81, 0x95, 0x5b, 0x7a, 0x6f, 0x27, 0x6f, 0x68, 0x78, 0x23,
-    0x27, 0x0b, 0x05, 0x05, 0x23, 0x18, 0x29, 0x3e, 0x20, 0x0f, 0x49, 0x23,
-    0x12, 0x1b, 0x06, 0x31, 0x5b, 0x14, 0x1d, 0x20, 0x1b, 0x13, 0x14, 0x28,
-    0x14, 0x07, 0x1e, 0x07, 0x01, 0x03, 0x04, 0x01, 0x01, 0x17, 0x66, 0x28,
-    0x4f, 0x01, 0x02, 0x02, 0x01, 0x01, 0x06, 0x14, 0x22, 0x19, 0x28, 0x07,
-    0x06, 0x3a, 0x40, 0x1e, 0x10, 0x33, 0x28, 0x04, 0x04, 0x01, 0x03, 0x03,
-    0x01, 0x04, 0x46, 0x46, 0x33, 0x62, 0x58, 0x66, 0x72, 0x66, 0x3f, 0x46,
-    0x10, 0x01, 0x01, 0x01, 0x03, 0x05, 0x04, 0x14, 0x31, 0x3d, 0x50, 0x23,
-    0x5b, 0x3d, 0x15, 0x2a, 0x03, 0x15, 0x09, 0x20, 0x20, 0x03, 0x05, 0x05,
-    0x01, 0x01, 0x5b, 0x76, 0x1c, 0x3e, 0x36, 0x1b, 0x0b, 0x03, 0x01, 0x00,
-    0x06, 0x49, 0x71, 0x8f, 0xae, 0xa8, 0x8f, 0x6f, 0x7a, 0x8a, 0xa1, 0x6a,
-    0x77, 0x0c, 0x77, 0x69, 0x47, 0x3e, 0x83, 0x3d, 0x27, 0x75, 0x83, 0x8c,
-    0x9c, 0x8c, 0x77, 0x8c, 0x83, 0x8c, 0x89, 0xaf, 0xbf, 0xbf, 0x83, 0xa9,
-    0x71, 0x13, 0x13, 0x55, 0x98, 0x6a, 0x77, 0x65, 0xb1, 0x71, 0xbf, 0xab,
-    0xa2, 0x98, 0xa9, 0xba, 0xbf, 0xaf, 0xc9, 0xc4, 0xb0, 0xb7, 0xc9, 0xb1,
-    0xc9, 0xcc, 0xc7, 0xb0, 0x9c, 0xab, 0xb5, 0xba, 0xbf, 0x94, 0xb7, 0xd0,
-    0xb1, 0xc4, 0xcc, 0xa6, 0xba, 0xd0, 0xe2, 0xe2, 0xd8, 0xd7, 0xdf, 0xea,
-    0xe7, 0xea, 0xea, 0xea, 0xe7, 0xe7, 0xe2, 0xe2, 0xe7, 0xf2, 0xf2, 0xec,
-    0xea, 0xea, 0xe2, 0xe2, 0xe0, 0xe0, 0xe0, 0xda, 0xce, 0xce, 0xce, 0xce,
-    0xce, 0xce, 0xce, 0xd5, 0xec, 0xf6, 0xf2, 0xef, 0xf2, 0xf2, 0xf2, 0xef,
-    0xe2, 0xda, 0xda, 0xd6, 0xd6, 0xd7, 0xd7, 0xda, 0xe2, 0xe2, 0xe2, 0xc4,
-    0xc4, 0xc4, 0xba, 0xbb, 0x8d, 0x55, 0x2c, 0x34, 0x6a, 0x61, 0x47, 0xab,
-    0x8c, 0xbd, 0xb0, 0xb5, 0x9b, 0xbd, 0xc2, 0xc2, 0x9a, 0x9a, 0xc2, 0xbd,
-    0x8c, 0xa8, 0x6f, 0x7a, 0x47, 0x30, 0xa8, 0xa2, 0xaf, 0x6f, 0x8c, 0xaf,
-    0x95, 0x9e, 0xb4, 0xb4, 0x7a, 0x7a, 0x8a, 0x89, 0x68, 0x6a, 0x6f, 0xa8,
-    0x9b, 0x68, 0x49, 0x6f, 0x2c, 0x31, 0xa3, 0xa3, 0xa3, 0xad, 0x95, 0x47,
-    0x3d, 0x54, 0x3b, 0x5e, 0x68, 0x78, 0x7a, 0x96, 0x61, 0x50, 0x5b, 0x3d,
-    0x29, 0x78, 0x6f, 0x1d, 0x6f, 0x43, 0x68, 0x29, 0x23, 0x31, 0x1f, 0x05,
-    0x13, 0x12, 0x27, 0x1d, 0x24, 0x26, 0x31, 0x1e, 0x18, 0x06, 0x15, 0x1b,
-    0x50, 0x3d, 0x01, 0x12, 0x1b, 0x12, 0x1b, 0x63, 0x33, 0x1e, 0x17, 0x24,
-    0x04, 0x01, 0x03, 0x01, 0x01, 0x02, 0x1b, 0x28, 0x2e, 0x01, 0x01, 0x02,
-    0x01, 0x02, 0x10, 0x1e, 0x22, 0x3a, 0x2e, 0x04, 0x04, 0x52, 0x2f, 0x1e,
-    0x3a, 0x3c, 0x3c, 0x07, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x2a, 0x33,
-    0x28, 0x62, 0x58, 0x46, 0x66, 0x66, 0x33, 0x66, 0x12, 0x01, 0x01, 0x01,
-    0x01, 0x05, 0x01, 0x15, 0x14, 0x3d, 0x42, 0x42, 0x2a, 0x1a, 0x1a, 0x3d,
-    0x05, 0x05, 0x05, 0x50, 0x27, 0x05, 0x05, 0x03, 0x01, 0x01, 0x3d, 0x76,
-    0x0f, 0x20, 0x1d, 0x1c, 0x05, 0x01, 0x00, 0x00, 0x36, 0x59, 0x75, 0x83,
-    0x8f, 0x9b, 0x71, 0x7a, 0x75, 0xa8, 0x8f, 0x6a, 0x1f, 0x2d, 0x4b, 0x54,
-    0x61, 0x5e, 0x8d, 0x6a, 0x59, 0x54, 0x61, 0x77, 0x8f, 0x83, 0x8c, 0x94,
-    0x77, 0x5c, 0x83, 0xaf, 0xab, 0xa8, 0x77, 0x2d, 0x36, 0x85, 0x9c, 0x61,
-    0xa2, 0x94, 0xb5, 0x89, 0x77, 0x5e, 0xb1, 0xb1, 0x9c, 0x7e, 0xac, 0xba,
-    0xa9, 0xb5, 0xb5, 0xb5, 0xb7, 0xb5, 0xc4, 0xbf, 0xb0, 0xc4, 0xc4, 0xb0,
-    0xaf, 0xa9, 0xb5, 0xb0, 0xba, 0xc9, 0xa6, 0xa9, 0xa7, 0xc6, 0xc4, 0x98,
-    0x8c, 0xb5, 0xcb, 0xd0, 0xc9, 0xcf, 0xd8, 0xe2, 0xe2, 0xe2, 0xe2, 0xe6,
-    0xe2, 0xe0, 0xe2, 0xe0, 0xe2, 0xf1, 0xf1, 0xea, 0xe7, 0xe7, 0xe2, 0xe0,
-    0xe0, 0xe0, 0xe0, 0xd5, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xe0,
-    0xf2, 0xf2, 0xef, 0xef, 0xf2, 0xef, 0xef, 0xec, 0xe7, 0xe0, 0xd6, 0xd5,
-    0xd6, 0xdd, 0xdd, 0xe0, 0xe2, 0xe2, 0xdd, 0xc9, 0xd0, 0xcc, 0xbf, 0xbf,
-    0xa6, 0xb3, 0x2c, 0x1f, 0x36, 0x2c, 0x77, 0x94, 0xb5, 0xc7, 0x83, 0x8c,
-    0xba, 0xc2, 0xc2, 0xc2, 0x7e, 0x7e, 0xc2, 0xaf, 0x61, 0x6f, 0xaf, 0x8c,
-    0xa8, 0x3b, 0x36, 0x94, 0x75, 0xa8, 0x9e, 0xb4, 0x95, 0xad, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xad, 0x9e, 0x9e, 0xad, 0xad, 0xad, 0x59, 0x4e,
-    0x1f, 0x4e, 0x9b, 0x7a, 0xad, 0xad, 0x75, 0x3d, 0x4e, 0x75, 0x47, 0x18,
-    0x31, 0x9b, 0x68, 0x68, 0x68, 0x54, 0x5b, 0x4e, 0x3d, 0x6f, 0x31, 0x0c,
-    0x26, 0x43, 0x3d, 0x43, 0x50, 0x23, 0x1f, 0x1a, 0x15, 0x06, 0x18, 0x5b,
-    0x1b, 0x36, 0x2a, 0x15, 0x0f, 0x12, 0x1d, 0x3d, 0x53, 0x67, 0x12, 0x05,
-    0x20, 0x10, 0x10, 0x42, 0x28, 0x53, 0x2a, 0x28, 0x24, 0x01, 0x01, 0x01,
-    0x01, 0x02, 0x03, 0x1e, 0x46, 0x04, 0x01, 0x02, 0x02, 0x02, 0x0c, 0x22,
-    0x2e, 0x22, 0x14, 0x03, 0x07, 0x62, 0x22, 0x1e, 0x58, 0x28, 0x22, 0x1b,
-    0x01, 0x01, 0x01, 0x04, 0x01, 0x02, 0x17, 0x3a, 0x46, 0x66, 0x58, 0x4f,
-    0x58, 0x4f, 0x2a, 0x4f, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x2a,
-    0x25, 0x14, 0x15, 0x1e, 0x23, 0x14, 0x15, 0x2d, 0x0c, 0x01, 0x04, 0x5b,
-    0x49, 0x03, 0x05, 0x03, 0x01, 0x01, 0x49, 0x25, 0x36, 0x0c, 0x0c, 0x05,
-    0x01, 0x01, 0x01, 0x01, 0x69, 0x5e, 0x69, 0x54, 0x68, 0x75, 0x81, 0x7a,
-    0x83, 0x6c, 0x6a, 0x23, 0x16, 0x5e, 0x59, 0x7a, 0x54, 0x5e, 0x27, 0x6a,
-    0x8c, 0x4b, 0x59, 0x83, 0xa8, 0xa2, 0x7e, 0x94, 0x54, 0x51, 0x94, 0x94,
-    0x59, 0x4b, 0x36, 0x9a, 0xb5, 0xa8, 0xb5, 0x4b, 0x85, 0xba, 0x9a, 0xb7,
-    0xb5, 0x2c, 0x8d, 0xa2, 0x9c, 0x5c, 0xa6, 0xa5, 0x9a, 0xb7, 0xb0, 0xba,
-    0xba, 0xb5, 0xbf, 0xcc, 0xb0, 0xb0, 0xb0, 0xba, 0xc4, 0xab, 0xba, 0xc4,
-    0xb0, 0xba, 0xc4, 0xb1, 0xba, 0xbb, 0xb7, 0x9a, 0x69, 0x85, 0x9c, 0xba,
-    0xc4, 0xbf, 0xcf, 0xd7, 0xd7, 0xd8, 0xe2, 0xe2, 0xe2, 0xe1, 0xe2, 0xe2,
-    0xe2, 0xec, 0xec, 0xea, 0xe7, 0xe2, 0xdd, 0xe0, 0xdd, 0xe0, 0xe0, 0xda,
-    0xda, 0xd7, 0xd5, 0xce, 0xd5, 0xda, 0xd5, 0xe0, 0xea, 0xea, 0xe7, 0xea,
-    0xec, 0xec, 0xec, 0xea, 0xe7, 0xe7, 0xd7, 0xd6, 0xd6, 0xd7, 0xd7, 0xd7,
-    0xdd, 0xdd, 0xda, 0xd0, 0xc9, 0xc4, 0x85, 0x7e, 0xc1, 0xb1, 0x69, 0x1f,
-    0x26, 0x7e, 0xa1, 0x90, 0xb5, 0xab, 0x7e, 0x9a, 0xb5, 0xb5, 0xb5, 0xa8,
-    0x77, 0x8c, 0x9e, 0x7a, 0x71, 0x77, 0x61, 0x49, 0x6a, 0x26, 0x1a, 0x59,
-    0x6a, 0x9e, 0xa8, 0xb4, 0x95, 0xad, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xad,
-    0xad, 0xad, 0x9e, 0x81, 0x9b, 0x95, 0x68, 0x5e, 0x27, 0x59, 0x43, 0x4e,
-    0xa3, 0xa3, 0x95, 0x3b, 0x54, 0x78, 0x68, 0x1d, 0x23, 0x95, 0xa3, 0x75,
-    0x8a, 0x75, 0x49, 0x61, 0x78, 0x81, 0x81, 0x1d, 0x3d, 0x31, 0x3d, 0x54,
-    0x42, 0x14, 0x1f, 0x18, 0x0f, 0x0b, 0x23, 0x5b, 0x14, 0x13, 0x23, 0x1d,
-    0x1b, 0x1d, 0x1d, 0x29, 0x29, 0x67, 0x15, 0x03, 0x07, 0x10, 0x0c, 0x1b,
-    0x14, 0x3f, 0x33, 0x28, 0x53, 0x14, 0x02, 0x01, 0x01, 0x02, 0x02, 0x07,
-    0x58, 0x04, 0x01, 0x02, 0x01, 0x01, 0x0a, 0x3a, 0x2e, 0x1e, 0x2f, 0x04,
-    0x10, 0x2f, 0x2f, 0x22, 0x2e, 0x24, 0x2e, 0x2e, 0x06, 0x01, 0x01, 0x05,
-    0x01, 0x01, 0x09, 0x28, 0x46, 0x33, 0x33, 0x46, 0x46, 0x28, 0x20, 0x24,
-    0x04, 0x03, 0x01, 0x01, 0x01, 0x01, 0x03, 0x27, 0x31, 0x67, 0x3f, 0x2a,
-    0x14, 0x0c, 0x11, 0x29, 0x15, 0x01, 0x05, 0x20, 0x23, 0x05, 0x01, 0x05,
-    0x01, 0x01, 0x31, 0x20, 0x3e, 0x13, 0x08, 0x03, 0x01, 0x01, 0x02, 0x0b,
-    0x3d, 0x64, 0x83, 0x8f, 0x6a, 0x4b, 0xa1, 0xa4, 0x8c, 0x54, 0x69, 0x0b,
-    0x1c, 0x5e, 0x9c, 0xa1, 0x7a, 0x47, 0x3e, 0x4b, 0x5e, 0x7a, 0x27, 0x71,
-    0x8c, 0x8c, 0x8c, 0xa2, 0x51, 0x8c, 0x71, 0x2c, 0x51, 0x7e, 0x85, 0xbf,
-    0xb5, 0xa2, 0xba, 0x51, 0xb1, 0xa8, 0xa5, 0xaf, 0xa5, 0x6e, 0x65, 0x4b,
-    0x94, 0x65, 0x85, 0xa2, 0xba, 0xb5, 0xb5, 0xc4, 0xba, 0xb1, 0xba, 0xbf,
-    0xba, 0xbf, 0xba, 0xba, 0xc4, 0xaf, 0xb0, 0xcc, 0xba, 0xbf, 0xc7, 0xba,
-    0xb7, 0xc9, 0xc9, 0xc7, 0xb1, 0x8c, 0xb2, 0xb1, 0xb5, 0xc4, 0xc9, 0xd0,
-    0xd6, 0xda, 0xe0, 0xe1, 0xe1, 0xe0, 0xe2, 0xe2, 0xe7, 0xea, 0xea, 0xe7,
-    0xe7, 0xe2, 0xd8, 0xdd, 0xd7, 0xe1, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe2,
-    0xe7, 0xec, 0xe7, 0xe2, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
-    0xe7, 0xe2, 0xd6, 0xd6, 0xd7, 0xd6, 0xda, 0xd7, 0xd8, 0xe1, 0xdd, 0xd0,
-    0xc9, 0xc4, 0x90, 0x8d, 0xb1, 0xa5, 0x5c, 0x34, 0x6a, 0xb0, 0x7e, 0x7e,
-    0xa1, 0xa8, 0x85, 0x6a, 0x94, 0xb5, 0xb4, 0xaf, 0x71, 0x75, 0x80, 0x83,
-    0x83, 0x26, 0x1d, 0x6a, 0x23, 0x26, 0x36, 0x1a, 0x95, 0xa3, 0xb4, 0x95,
-    0xad, 0xad, 0xb4, 0xb4, 0xb4, 0xb4, 0xad, 0xad, 0xad, 0xad, 0xad, 0x95,
-    0x8a, 0x81, 0x6f, 0x49, 0x36, 0x23, 0x2d, 0x36, 0x7a, 0xad, 0xa3, 0x43,
-    0x54, 0x6f, 0x31, 0x3b, 0x5b, 0x78, 0x78, 0x49, 0x8a, 0x78, 0x68, 0x49,
-    0x54, 0x6f, 0x68, 0x49, 0x31, 0x31, 0x76, 0x73, 0x68, 0x4e, 0x3d, 0x31,
-    0x1d, 0x0f, 0x23, 0x1b, 0x23, 0x27, 0x31, 0x29, 0x15, 0x18, 0x20, 0x0f,
-    0x13, 0x31, 0x10, 0x15, 0x05, 0x18, 0x10, 0x33, 0x1d, 0x22, 0x29, 0x19,
-    0x42, 0x1e, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x10, 0x01, 0x01, 0x01,
-    0x02, 0x02, 0x02, 0x46, 0x2e, 0x2f, 0x40, 0x04, 0x14, 0x2e, 0x52, 0x14,
-    0x17, 0x22, 0x2e, 0x1e, 0x07, 0x03, 0x01, 0x04, 0x01, 0x02, 0x04, 0x1e,
-    0x58, 0x4f, 0x58, 0x4f, 0x3f, 0x24, 0x14, 0x24, 0x06, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x04, 0x24, 0x50, 0x7b, 0x4f, 0x67, 0x5b, 0x3d, 0x04, 0x20,
-    0x13, 0x03, 0x06, 0x04, 0x05, 0x04, 0x01, 0x01, 0x03, 0x02, 0x20, 0x3d,
-    0x31, 0x06, 0x03, 0x05, 0x01, 0x02, 0x01, 0x49, 0x8a, 0x6f, 0x75, 0xa4,
-    0xa1, 0x0f, 0x5e, 0xaf, 0x8f, 0x83, 0x2d, 0x0e, 0x15, 0x83, 0x95, 0x8c,
-    0x8c, 0x59, 0x6a, 0x36, 0x76, 0x77, 0x2d, 0x36, 0x8c, 0x71, 0x83, 0xb5,
-    0x94, 0x61, 0x26, 0x71, 0x9b, 0xa2, 0x85, 0x83, 0xaf, 0xa8, 0xa2, 0x54,
-    0x9a, 0xa2, 0x94, 0xaf, 0x6a, 0xa2, 0xa5, 0x4b, 0x77, 0x6a, 0x98, 0xb1,
-    0xaf, 0xb5, 0xbf, 0xbf, 0xba, 0xba, 0xba, 0xbf, 0xba, 0xc4, 0xbf, 0xb0,
-    0xc7, 0xb0, 0xa5, 0xc4, 0xb5, 0xba, 0xc7, 0xba, 0xc4, 0xc1, 0xd7, 0xc9,
-    0xc7, 0xa2, 0xbb, 0xba, 0xbf, 0xb0, 0xc7, 0xcc, 0xd6, 0xd6, 0xe0, 0xe1,
-    0xe1, 0xe1, 0xe1, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe1, 0xdd, 0xc6, 0xe1,
-    0xda, 0xdd, 0xe7, 0xe7, 0xe0, 0xe2, 0xe7, 0xe7, 0xec, 0xec, 0xe7, 0xe7,
-    0xe7, 0xe7, 0xe2, 0xe7, 0xe2, 0xe2, 0xe2, 0xe7, 0xe7, 0xe0, 0xd6, 0xd6,
-    0xd6, 0xd6, 0xe0, 0xe1, 0xdd, 0xdd, 0xd8, 0xcf, 0xd0, 0xcc, 0xa9, 0xa9,
-    0xa5, 0x9c, 0x8d, 0x6a, 0x71, 0x85, 0x6a, 0x77, 0xbd, 0xc7, 0x8c, 0x71,
-    0x9a, 0xaf, 0xc2, 0x94, 0x83, 0xa8, 0x90, 0x83, 0x83, 0x61, 0x71, 0x71,
-    0x5e, 0x0f, 0x36, 0x71, 0x61, 0xb4, 0xad, 0x95, 0xb4, 0xad, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xad, 0xb4, 0xad, 0xad, 0xad, 0xad, 0x81, 0x75, 0x83, 0x23,
-    0x1f, 0x26, 0x43, 0x75, 0x23, 0x68, 0x8f, 0x95, 0x6f, 0x4e, 0x1d, 0x68,
-    0x50, 0x7a, 0x2d, 0x1d, 0x5b, 0x29, 0x54, 0x23, 0x4e, 0x54, 0x31, 0x31,
-    0x1a, 0x3d, 0x4e, 0x3d, 0x81, 0x50, 0x36, 0x5b, 0x5e, 0x1f, 0x12, 0x06,
-    0x5b, 0x18, 0x29, 0x1d, 0x0f, 0x0f, 0x1d, 0x29, 0x50, 0x23, 0x12, 0x14,
-    0x0b, 0x0c, 0x10, 0x53, 0x31, 0x0c, 0x0c, 0x10, 0x24, 0x04, 0x12, 0x02,
-    0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x4d,
-    0x22, 0x3a, 0x3a, 0x04, 0x0d, 0x3c, 0x22, 0x3c, 0x2e, 0x10, 0x1b, 0x28,
-    0x17, 0x03, 0x01, 0x04, 0x03, 0x02, 0x01, 0x1e, 0x58, 0x4d, 0x33, 0x46,
-    0x58, 0x2a, 0x24, 0x14, 0x05, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x31,
-    0x42, 0x31, 0x42, 0x3f, 0x5a, 0x73, 0x06, 0x1d, 0x06, 0x05, 0x03, 0x01,
-    0x04, 0x05, 0x05, 0x05, 0x03, 0x05, 0x0b, 0x23, 0x1c, 0x01, 0x05, 0x02,
-    0x01, 0x02, 0x01, 0x6c, 0x9b, 0x8f, 0x8a, 0x31, 0x5e, 0x1a, 0x2d, 0x27,
-    0x36, 0x1f, 0x1f, 0x0b, 0x27, 0x6a, 0x9b, 0xa1, 0x8a, 0x59, 0x7a, 0x71,
-    0x71, 0x83, 0x3e, 0x2d, 0x94, 0x7a, 0x7a, 0x6a, 0x51, 0x2c, 0x59, 0xa8,
-    0x90, 0x51, 0x1f, 0x0b, 0x1f, 0x61, 0x94, 0x3e, 0x4b, 0xa9, 0x7e, 0xbf,
-    0x71, 0xba, 0x9c, 0x7e, 0x6a, 0x85, 0xaf, 0xa2, 0xb5, 0xba, 0xb5, 0xb5,
-    0xbf, 0xba, 0xc4, 0xbf, 0xb1, 0xc2, 0xd0, 0xa5, 0xc4, 0xba, 0x94, 0xc7,
-    0xba, 0xc2, 0xc2, 0xbf, 0xc9, 0xc4, 0xc1, 0xc4, 0xcc, 0xc1, 0xac, 0xbb,
-    0xba, 0xba, 0xaf, 0xc9, 0xcc, 0xcc, 0xda, 0xe1, 0xe1, 0xe1, 0xe2, 0xe1,
-    0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xcb, 0xd8, 0xd7, 0xda, 0xd6, 0xda, 0xe0,
-    0xdd, 0xda, 0xda, 0xe0, 0xe7, 0xe7, 0xe0, 0xe1, 0xe0, 0xe0, 0xe0, 0xe2,
-    0xe2, 0xe2, 0xe1, 0xe2, 0xe2, 0xe0, 0xda, 0xd7, 0xda, 0xd7, 0xe1, 0xe1,
-    0xe1, 0xe1, 0xd8, 0xa9, 0x97, 0xa5, 0xa5, 0xa5, 0xba, 0xba, 0xb5, 0x77,
-    0x55, 0x6e, 0x71, 0x7a, 0xc7, 0xc2, 0x8c, 0x83, 0x71, 0x71, 0x7e, 0x71,
-    0x5e, 0x7a, 0x4e, 0x61, 0x94, 0x95, 0xa8, 0x61, 0x9a, 0x47, 0x71, 0x61,
-    0x47, 0xb4, 0xa8, 0xa8, 0xad, 0xad, 0xb4, 0xb4, 0xb4, 0xb4, 0xad, 0xad,
-    0xad, 0xad, 0xad, 0xad, 0x95, 0x95, 0x9b, 0x0f, 0x4b, 0x27, 0x59, 0x4e,
-    0x1f, 0x4b, 0x59, 0x68, 0x75, 0x83, 0x23, 0x3e, 0x50, 0x8a, 0x43, 0x6f,
-    0x68, 0x13, 0x23, 0x61, 0x5b, 0x59, 0x81, 0x81, 0x3d, 0x68, 0x25, 0x1f,
-    0x1d, 0x1a, 0x0b, 0x1b, 0x1d, 0x12, 0x12, 0x0b, 0x3d, 0x1b, 0x29, 0x31,
-    0x1a, 0x12, 0x29, 0x42, 0x50, 0x1e, 0x06, 0x0c, 0x10, 0x06, 0x10, 0x50,
-    0x42, 0x33, 0x07, 0x0c, 0x14, 0x07, 0x07, 0x03, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x3c, 0x22, 0x2e, 0x28, 0x01,
-    0x33, 0x19, 0x28, 0x33, 0x22, 0x09, 0x1e, 0x33, 0x3a, 0x01, 0x01, 0x03,
-    0x03, 0x01, 0x01, 0x1e, 0x4f, 0x46, 0x42, 0x66, 0x53, 0x1e, 0x14, 0x42,
-    0x06, 0x01, 0x01, 0x05, 0x01, 0x06, 0x01, 0x50, 0x24, 0x12, 0x35, 0x31,
-    0x67, 0x73, 0x42, 0x0c, 0x05, 0x01, 0x01, 0x01, 0x6c, 0x0c, 0x05, 0x0b,
-    0x05, 0x05, 0x03, 0x06, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x02, 0x49,
-    0x7d, 0xa4, 0xa1, 0x5e, 0x1f, 0x1b, 0x3e, 0x27, 0x05, 0x05, 0x11, 0x0b,
-    0x3e, 0x6f, 0x9e, 0xae, 0x6a, 0x54, 0x61, 0x8c, 0x61, 0xb5, 0x47, 0x6a,
-    0x47, 0x9a, 0x8c, 0x65, 0x0e, 0x26, 0x26, 0x12, 0x1a, 0x4b, 0x8c, 0xa2,
-    0x65, 0x15, 0x1a, 0x34, 0x11, 0x55, 0x44, 0x71, 0x4b, 0xb1, 0x83, 0x77,
-    0x65, 0x61, 0xb1, 0xb1, 0xa1, 0xb5, 0xbf, 0xbf, 0xaf, 0xa9, 0xbf, 0xba,
-    0xb0, 0xc7, 0xc9, 0xb1, 0xb5, 0xc4, 0x94, 0xb5, 0xc9, 0xba, 0xc7, 0xc9,
-    0xbf, 0xcf, 0xbb, 0xc9, 0xc4, 0xbf, 0x9d, 0xb7, 0xb0, 0xb5, 0xbf, 0xb0,
-    0xb5, 0xcc, 0xda, 0xe0, 0xe0, 0xe1, 0xdd, 0xe0, 0xdd, 0xe0, 0xe1, 0xd8,
-    0xd1, 0xdd, 0xe0, 0xe0, 0xd7, 0xd6, 0xd5, 0xd7, 0xda, 0xd6, 0xd6, 0xda,
-    0xe0, 0xe0, 0xda, 0xe1, 0xe1, 0xe2, 0xe2, 0xe1, 0xe2, 0xe1, 0xe2, 0xe0,
-    0xdd, 0xdd, 0xdd, 0xda, 0xda, 0xdd, 0xe0, 0xda, 0xdd, 0xdd, 0xd7, 0x97,
-    0xb7, 0xc4, 0xaf, 0xb5, 0xc9, 0x9a, 0x9a, 0x85, 0x8c, 0x6a, 0x65, 0x8f,
-    0xc2, 0x9c, 0x90, 0x94, 0x5c, 0x36, 0xb5, 0x71, 0x2b, 0x83, 0x61, 0x94,
-    0x61, 0x4e, 0xad, 0x7a, 0x68, 0x51, 0x59, 0x26, 0x1d, 0xb4, 0x9b, 0xad,
-    0xad, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xad, 0xad, 0xad, 0xad, 0xad,
-    0xad, 0x8a, 0x68, 0x3d, 0x2d, 0x3d, 0x61, 0x23, 0x0b, 0x0e, 0x61, 0x68,
-    0x4e, 0x3d, 0x13, 0x15, 0x75, 0x81, 0x78, 0x4e, 0x3d, 0x1d, 0x23, 0x4e,
-    0x3d, 0x68, 0x75, 0x73, 0x31, 0x43, 0x1d, 0x1d, 0x25, 0x27, 0x0c, 0x18,
-    0x0c, 0x0b, 0x1a, 0x1d, 0x20, 0x36, 0x20, 0x1b, 0x15, 0x07, 0x13, 0x42,
-    0x1e, 0x29, 0x1b, 0x0c, 0x14, 0x06, 0x1e, 0x1d, 0x1b, 0x0c, 0x04, 0x05,
-    0x18, 0x53, 0x14, 0x0c, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
-    0x02, 0x01, 0x01, 0x22, 0x14, 0x22, 0x10, 0x01, 0x09, 0x17, 0x17, 0x2f,
-    0x40, 0x28, 0x4d, 0x3a, 0x3a, 0x04, 0x01, 0x03, 0x04, 0x01, 0x01, 0x07,
-    0x4f, 0x33, 0x46, 0x3a, 0x33, 0x33, 0x46, 0x46, 0x06, 0x05, 0x01, 0x05,
-    0x01, 0x03, 0x03, 0x31, 0x42, 0x3d, 0x1e, 0x23, 0x3f, 0x67, 0x3f, 0x05,
-    0x05, 0x01, 0x02, 0x02, 0x3d, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x03, 0x04,
-    0x03, 0x03, 0x01, 0x02, 0x02, 0x02, 0x01, 0x54, 0x9b, 0xa4, 0x86, 0x61,
-    0x69, 0x3e, 0x1f, 0x0b, 0x06, 0x08, 0x47, 0x11, 0x36, 0x8c, 0xb5, 0x8f,
-    0x7e, 0x69, 0x51, 0x6f, 0x75, 0xab, 0x59, 0x5e, 0x4b, 0x71, 0x77, 0x0b,
-    0x0c, 0x2c, 0x55, 0x6e, 0x94, 0xaf, 0xa8, 0xb0, 0x9e, 0xb5, 0x0f, 0x2c,
-    0x15, 0x1f, 0x44, 0x1f, 0x16, 0x61, 0x5c, 0x65, 0x94, 0xa5, 0x51, 0xbf,
-    0xa9, 0xb5, 0xcc, 0xc4, 0xc9, 0xc9, 0xb5, 0xaf, 0xb5, 0xbf, 0xc4, 0xb0,
-    0xc9, 0x9c, 0xc4, 0x8c, 0xaf, 0xb5, 0xbf, 0xd0, 0xcf, 0xc9, 0xc9, 0xc9,
-    0xd0, 0xbb, 0xcb, 0xc6, 0xd8, 0xd0, 0xc7, 0xc2, 0xbd, 0xb5, 0xb1, 0xc1,
-    0xd1, 0xd1, 0xc6, 0xd1, 0xd1, 0xd0, 0xcf, 0xd1, 0xda, 0xe0, 0xdd, 0xda,
-    0xdd, 0xba, 0xce, 0xd5, 0xd5, 0xcc, 0xd5, 0xd5, 0xd7, 0xda, 0xdd, 0xe0,
-    0xe0, 0xe0, 0xe0, 0xe1, 0xe1, 0xe0, 0xe0, 0xdd, 0xdd, 0xda, 0xda, 0xd7,
-    0xd6, 0xd7, 0xda, 0xdd, 0xda, 0xd6, 0xcb, 0xb5, 0xc4, 0xb5, 0xba, 0xa2,
-    0x2c, 0x1f, 0x1f, 0xb3, 0xbf, 0x71, 0x7e, 0x90, 0xc7, 0x75, 0xa2, 0x8c,
-    0x1d, 0x8c, 0x71, 0x75, 0x3d, 0x6a, 0x44, 0x6f, 0xa2, 0x75, 0xad, 0x7a,
-    0x71, 0x68, 0x9a, 0x4b, 0x16, 0x7a, 0x9e, 0xb4, 0xaf, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xad, 0xad, 0xad, 0xae, 0xad, 0xad, 0x95, 0x59, 0x71, 0x5b, 0x80,
-    0x6f, 0x27, 0x36, 0x23, 0x36, 0x13, 0x7a, 0x1d, 0x54, 0x8f, 0x68, 0x23,
-    0x1d, 0x3d, 0x3d, 0x1f, 0x2d, 0x3d, 0x2d, 0x15, 0x36, 0x8a, 0x43, 0x78,
-    0x68, 0x3d, 0x47, 0x2d, 0x49, 0x49, 0x24, 0x54, 0x5b, 0x04, 0x27, 0x0f,
-    0x29, 0x31, 0x3d, 0x1d, 0x42, 0x13, 0x0c, 0x14, 0x42, 0x15, 0x06, 0x0c,
-    0x14, 0x07, 0x1e, 0x2a, 0x2a, 0x0b, 0x04, 0x04, 0x1b, 0x33, 0x2a, 0x3a,
-    0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x00, 0x10,
-    0x04, 0x04, 0x01, 0x04, 0x46, 0x22, 0x3a, 0x4d, 0x40, 0x3a, 0x40, 0x33,
-    0x3a, 0x17, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x46, 0x46, 0x24, 0x33,
-    0x33, 0x28, 0x58, 0x3a, 0x06, 0x03, 0x01, 0x04, 0x05, 0x03, 0x03, 0x5a,
-    0x29, 0x31, 0x29, 0x25, 0x50, 0x3f, 0x31, 0x04, 0x05, 0x01, 0x02, 0x01,
-    0x1b, 0x7d, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x05, 0x05, 0x02, 0x02,
-    0x01, 0x01, 0x05, 0x86, 0x96, 0x8f, 0xa4, 0x54, 0x59, 0x8f, 0x26, 0x05,
-    0x26, 0x13, 0x7a, 0x15, 0x49, 0x8a, 0x8a, 0xab, 0x83, 0x9e, 0x61, 0x7a,
-    0x71, 0x8d, 0x71, 0x83, 0x5c, 0x1d, 0x16, 0x1d, 0xa5, 0x9c, 0x9a, 0x8c,
-    0x9c, 0x7e, 0x90, 0xa8, 0xc2, 0xbd, 0x9c, 0x23, 0x51, 0x8c, 0x8c, 0x94,
-    0x4b, 0x26, 0x3e, 0x7e, 0x5c, 0x94, 0x6e, 0x5c, 0xa2, 0xbf, 0xc4, 0xba,
-    0xc7, 0xc7, 0xc4, 0xa5, 0xab, 0xcf, 0xba, 0xa2, 0xb7, 0xa9, 0xb0, 0x9c,
-    0xba, 0xbd, 0xba, 0xc9, 0xc9, 0xc6, 0xd6, 0xc4, 0xc9, 0xc4, 0xbf, 0xbb,
-    0xcf, 0xcc, 0xbd, 0xc2, 0xbd, 0xc2, 0xd0, 0xc6, 0xc6, 0xda, 0xd7, 0xd0,
-    0xd7, 0xd7, 0xc9, 0xd6, 0xd6, 0xda, 0xda, 0xd7, 0xda, 0xd0, 0xcf, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xd6, 0xda, 0xe0, 0xdd, 0xdd, 0xe0, 0xe0,
-    0xe0, 0xdd, 0xda, 0xd7, 0xd7, 0xda, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6,
-    0xd6, 0xcf, 0xba, 0xcc, 0xc4, 0xb5, 0xb5, 0xb5, 0x65, 0x26, 0x6a, 0xaf,
-    0xb5, 0x9a, 0xb5, 0xab, 0xb5, 0x71, 0x71, 0x6e, 0x1c, 0x47, 0x6f, 0x9a,
-    0x7e, 0x77, 0x4b, 0x7e, 0x9b, 0x75, 0xa8, 0x6f, 0xaf, 0x3e, 0x6f, 0x14,
-    0x75, 0x4e, 0x89, 0xad, 0xad, 0xb4, 0xb4, 0xb4, 0xb4, 0xad, 0xad, 0xa3,
-    0xad, 0xad, 0xad, 0x95, 0x43, 0x31, 0x59, 0x68, 0x59, 0x3e, 0x31, 0x6f,
-    0x75, 0x43, 0x75, 0x2c, 0x18, 0x5b, 0x2d, 0x68, 0x54, 0x83, 0x23, 0x2d,
-    0x49, 0x8a, 0x23, 0x13, 0x14, 0x81, 0x50, 0x68, 0x20, 0x20, 0x31, 0x3d,
-    0x27, 0x29, 0x20, 0x3d, 0x50, 0x12, 0x23, 0x0c, 0x31, 0x35, 0x3f, 0x5b,
-    0x3f, 0x1e, 0x12, 0x0c, 0x0b, 0x03, 0x07, 0x07, 0x42, 0x1b, 0x05, 0x2a,
-    0x33, 0x14, 0x06, 0x04, 0x0f, 0x22, 0x33, 0x14, 0x33, 0x17, 0x03, 0x01,
-    0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x10, 0x01, 0x01, 0x04,
-    0x40, 0x2e, 0x52, 0x40, 0x62, 0x40, 0x4d, 0x22, 0x3c, 0x2f, 0x01, 0x01,
-    0x04, 0x01, 0x02, 0x02, 0x33, 0x33, 0x28, 0x33, 0x3f, 0x28, 0x2a, 0x33,
-    0x04, 0x03, 0x01, 0x04, 0x01, 0x01, 0x03, 0x2d, 0x2a, 0x31, 0x35, 0x49,
-    0x18, 0x23, 0x04, 0x05, 0x04, 0x0c, 0x01, 0x01, 0x0b, 0x42, 0x05, 0x03,
-    0x03, 0x05, 0x05, 0x05, 0x0b, 0x12, 0x05, 0x06, 0x03, 0x01, 0x23, 0x81,
-    0x75, 0x5b, 0x8f, 0x59, 0x27, 0x6c, 0x26, 0x0b, 0x1f, 0x1a, 0x83, 0x0f,
-    0x26, 0x8c, 0x83, 0x9b, 0x83, 0xa1, 0x83, 0x77, 0x75, 0x3e, 0x2d, 0x59,
-    0x54, 0x0e, 0x23, 0x6a, 0x6a, 0x90, 0x7a, 0x9a, 0x83, 0xaf, 0xa8, 0xb4,
-    0xbf, 0xb5, 0x8c, 0x5c, 0x94, 0xa2, 0x9a, 0x9a, 0x85, 0x59, 0x4b, 0x27,
-    0x3e, 0x8d, 0x34, 0x85, 0x61, 0x9a, 0xb5, 0xba, 0xc4, 0xc9, 0xb0, 0x9a,
-    0xc6, 0xb0, 0xb5, 0x9c, 0xb7, 0xc9, 0xb1, 0xa5, 0xb3, 0xc4, 0xb5, 0xba,
-    0xc4, 0xd7, 0xd6, 0xd0, 0xbf, 0xbf, 0xc4, 0xba, 0xba, 0xc2, 0xbf, 0xb5,
-    0xba, 0xbc, 0xc9, 0xda, 0xda, 0xcb, 0xc9, 0xcf, 0xd0, 0xc4, 0xcc, 0xd6,
-    0xd6, 0xd7, 0xd7, 0xd7, 0xd7, 0xd0, 0xd5, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xd5, 0xd7, 0xd7, 0xdd, 0xdd, 0xe0, 0xe0, 0xe0, 0xda, 0xd7, 0xd6,
-    0xd6, 0xd6, 0xcf, 0xcf, 0xd6, 0xd6, 0xd6, 0xcf, 0xcf, 0xba, 0xcc, 0xcc,
-    0xc4, 0xbf, 0xb5, 0xce, 0x94, 0x94, 0x85, 0xb5, 0x59, 0xa9, 0xa5, 0x77,
-    0xb5, 0x7e, 0x61, 0x55, 0x1f, 0x27, 0x5c, 0x83, 0x89, 0x71, 0x36, 0x75,
-    0xa3, 0x95, 0x6f, 0xa8, 0x75, 0x3b, 0x9b, 0x30, 0x6f, 0x4e, 0x83, 0xa8,
-    0xb4, 0xb4, 0xb4, 0xad, 0xad, 0xad, 0x95, 0x95, 0xa8, 0xad, 0xa3, 0xa8,
-    0x68, 0x23, 0x30, 0x23, 0x68, 0x30, 0x23, 0x23, 0x6a, 0x68, 0x75, 0x4b,
-    0x36, 0x2d, 0x31, 0x6a, 0x13, 0x23, 0x4e, 0x30, 0x20, 0x59, 0x54, 0x1d,
-    0x26, 0x31, 0x5b, 0x23, 0x0b, 0x13, 0x1f, 0x2d, 0x30, 0x50, 0x3e, 0x12,
-    0x18, 0x27, 0x31, 0x14, 0x42, 0x31, 0x23, 0x1e, 0x33, 0x5b, 0x24, 0x12,
-    0x0c, 0x07, 0x1e, 0x24, 0x1b, 0x0c, 0x05, 0x10, 0x67, 0x1b, 0x14, 0x12,
-    0x10, 0x1e, 0x10, 0x04, 0x1e, 0x28, 0x09, 0x01, 0x02, 0x01, 0x01, 0x01,
-    0x02, 0x01, 0x01, 0x01, 0x2e, 0x07, 0x01, 0x0d, 0x52, 0x2e, 0x52, 0x52,
-    0x62, 0x52, 0x3a, 0x2e, 0x52, 0x3c, 0x04, 0x01, 0x04, 0x01, 0x01, 0x01,
-    0x06, 0x33, 0x1e, 0x58, 0x33, 0x24, 0x1d, 0x28, 0x06, 0x01, 0x01, 0x03,
-    0x04, 0x05, 0x01, 0x1d, 0x1b, 0x14, 0x14, 0x12, 0x15, 0x12, 0x07, 0x05,
-    0x0b, 0x0b, 0x07, 0x00, 0x0b, 0x87, 0x13, 0x01, 0x05, 0x06, 0x06, 0x06,
-    0x07, 0x0b, 0x03, 0x05, 0x01, 0x03, 0x11, 0x18, 0x2d, 0x69, 0x6c, 0x59,
-    0x55, 0x36, 0x0f, 0x31, 0x51, 0x0b, 0x4b, 0x0b, 0x3e, 0x8a, 0x83, 0x7a,
-    0x81, 0x9b, 0x9e, 0x83, 0x83, 0x3e, 0x3e, 0x4b, 0x0b, 0x1f, 0x71, 0x7e,
-    0x77, 0x90, 0x9c, 0xa9, 0x83, 0xb5, 0xa2, 0xbd, 0xba, 0xaf, 0x8c, 0x8c,
-    0x94, 0xaf, 0x7a, 0x8d, 0x5e, 0xb1, 0x94, 0xa6, 0x5e, 0x3e, 0x55, 0x94,
-    0xb1, 0x98, 0xa5, 0xba, 0xaf, 0xaf, 0xb7, 0x9c, 0xb1, 0x94, 0xb1, 0x85,
-    0xb1, 0xb5, 0xb0, 0xaf, 0xb0, 0xaf, 0xbf, 0xc7, 0xbf, 0xd0, 0xcf, 0xcc,
-    0xc7, 0xba, 0xc5, 0xba, 0xb0, 0xc2, 0xc2, 0xc2, 0xaf, 0xbd, 0xc9, 0xd6,
-    0xd6, 0xd6, 0xc9, 0xba, 0xba, 0xd0, 0xcc, 0xd7, 0xd6, 0xd7, 0xd7, 0xd7,
-    0xd7, 0xd6, 0xcc, 0xce, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xd7, 0xd7,
-    0xdd, 0xdd, 0xda, 0xdd, 0xdd, 0xd7, 0xd6, 0xd6, 0xd0, 0xcc, 0xcf, 0xcf,
-    0xcf, 0xd0, 0xd0, 0xd0, 0xc4, 0xc9, 0xcc, 0xc4, 0x47, 0xb1, 0xba, 0xbf,
-    0xb5, 0xa8, 0x4b, 0x94, 0x8c, 0xb5, 0x85, 0x6a, 0x9c, 0x4e, 0x7e, 0x34,
-    0x44, 0x83, 0x61, 0x59, 0x8c, 0x59, 0x6f, 0x59, 0xad, 0x9e, 0x71, 0x75,
-    0x7a, 0x4e, 0x6f, 0x75, 0x95, 0x90, 0x81, 0x95, 0xad, 0xb4, 0xb4, 0xad,
-    0xad, 0xad, 0xad, 0xa4, 0x80, 0x9b, 0x8a, 0x81, 0x31, 0x3e, 0x2d, 0x47,
-    0x1f, 0x27, 0x27, 0x23, 0x3d, 0x27, 0x5b, 0x43, 0x27, 0x36, 0x1d, 0x15,
-    0x0f, 0x1d, 0x68, 0x1f, 0x59, 0x64, 0x31, 0x1f, 0x2d, 0x49, 0x4e, 0x1a,
-    0x07, 0x21, 0x29, 0x7d, 0x73, 0x49, 0x2d, 0x13, 0x50, 0x23, 0x5b, 0x1d,
-    0x29, 0x31, 0x0f, 0x2a, 0x50, 0x24, 0x24, 0x12, 0x07, 0x14, 0x1d, 0x31,
-    0x14, 0x0c, 0x06, 0x10, 0x5a, 0x1e, 0x1e, 0x10, 0x07, 0x15, 0x09, 0x0b,
-    0x1e, 0x17, 0x12, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02,
-    0x2f, 0x1e, 0x03, 0x06, 0x52, 0x40, 0x4d, 0x4d, 0x52, 0x52, 0x4d, 0x28,
-    0x46, 0x46, 0x17, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x28, 0x2e,
-    0x2a, 0x28, 0x3f, 0x24, 0x04, 0x01, 0x03, 0x04, 0x04, 0x03, 0x01, 0x35,
-    0x42, 0x2a, 0x1b, 0x14, 0x06, 0x05, 0x04, 0x12, 0x0f, 0x20, 0x5b, 0x01,
-    0x01, 0x7d, 0x35, 0x05, 0x05, 0x05, 0x01, 0x02, 0x0b, 0x0b, 0x01, 0x02,
-    0x01, 0x01, 0x0b, 0x1f, 0x05, 0x1f, 0x1f, 0x2d, 0x12, 0x1f, 0x0f, 0x75,
-    0x23, 0x05, 0x05, 0x0b, 0x83, 0x8c, 0x8f, 0x8c, 0x7a, 0x95, 0x8f, 0x83,
-    0x83, 0x6a, 0x27, 0x21, 0x1f, 0x7a, 0x75, 0x8c, 0x7a, 0xa9, 0x94, 0x77,
-    0x83, 0x9e, 0xaf, 0xbd, 0xc2, 0xa8, 0x9b, 0xa8, 0x6a, 0x85, 0x6a, 0x61,
-    0xba, 0xaf, 0xa2, 0x7a, 0xa2, 0x71, 0x47, 0x6a, 0x6e, 0x85, 0xa9, 0xbf,
-    0xbf, 0xc7, 0xc2, 0xa9, 0xa9, 0xaf, 0xb0, 0x94, 0xba, 0xbd, 0xaf, 0xb7,
-    0xb5, 0x9b, 0xb5, 0xc4, 0xc4, 0xc4, 0xc7, 0xc7, 0xc7, 0xc4, 0xb5, 0xc2,
-    0xb5, 0xa8, 0xba, 0xbd, 0xc2, 0xbd, 0xc2, 0xcf, 0xd1, 0xd0, 0xc9, 0xc4,
-    0xc4, 0xbf, 0xc4, 0xcf, 0xd0, 0xd0, 0xd0, 0xd0, 0xd7, 0xd7, 0xd6, 0xd6,
-    0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xd6, 0xd7, 0xda, 0xda, 0xda, 0xda,
-    0xd7, 0xd7, 0xd6, 0xcf, 0xd0, 0xcc, 0xc7, 0xc7, 0xc7, 0xc7, 0xcc, 0xcf,
-    0xbf, 0xc7, 0xce, 0x9a, 0x98, 0x77, 0xb5, 0xb5, 0xa2, 0x6a, 0x36, 0x9a,
-    0x83, 0xaf, 0x71, 0x9a, 0x8c, 0x83, 0x6a, 0x23, 0x1f, 0x9e, 0x71, 0x6a,
-    0x89, 0x89, 0x6a, 0x6a, 0x90, 0x83, 0x3e, 0x47, 0x61, 0x75, 0x47, 0x59,
-    0x9e, 0x9e, 0xad, 0x8a, 0x8a, 0x9e, 0xa4, 0xb4, 0x9b, 0x96, 0xad, 0xad,
-    0x8f, 0x75, 0x8a, 0x7a, 0x80, 0x95, 0x1d, 0x1a, 0x27, 0x36, 0x2d, 0x43,
-    0x36, 0x31, 0x4e, 0x81, 0x5b, 0x59, 0x75, 0x36, 0x23, 0x27, 0x1d, 0x27,
-    0x3d, 0x8a, 0x4e, 0x10, 0x23, 0x36, 0x50, 0x68, 0x2d, 0x1d, 0x54, 0x50,
-    0x6c, 0x1d, 0x0b, 0x0c, 0x0c, 0x31, 0x50, 0x42, 0x1b, 0x1d, 0x0c, 0x20,
-    0x0c, 0x67, 0x50, 0x14, 0x0c, 0x20, 0x0f, 0x14, 0x15, 0x0c, 0x07, 0x06,
-    0x15, 0x14, 0x10, 0x0c, 0x07, 0x0c, 0x0c, 0x06, 0x04, 0x07, 0x04, 0x07,
-    0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x2e, 0x2e, 0x04, 0x04,
-    0x3c, 0x3c, 0x52, 0x52, 0x52, 0x52, 0x52, 0x33, 0x2e, 0x4d, 0x22, 0x01,
-    0x03, 0x05, 0x05, 0x01, 0x01, 0x1e, 0x33, 0x17, 0x2a, 0x2e, 0x4f, 0x24,
-    0x04, 0x01, 0x03, 0x04, 0x01, 0x01, 0x01, 0x1e, 0x2a, 0x33, 0x31, 0x20,
-    0x05, 0x03, 0x05, 0x12, 0x14, 0x67, 0x87, 0x0c, 0x02, 0x29, 0x67, 0x06,
-    0x06, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x02, 0x01, 0x01, 0x1f, 0x49,
-    0x1c, 0x26, 0x23, 0x26, 0x0b, 0x1c, 0x1a, 0x61, 0x0b, 0x05, 0x06, 0x4b,
-    0x61, 0x6f, 0x6f, 0x7a, 0x94, 0x75, 0x9b, 0x71, 0x83, 0x49, 0x0b, 0x16,
-    0x4b, 0x77, 0x94, 0x71, 0x7a, 0x7a, 0x9c, 0x83, 0xa1, 0xb5, 0x9c, 0xaf,
-    0xba, 0xa8, 0xaf, 0xa8, 0x47, 0x77, 0xa5, 0x8c, 0xbd, 0xbf, 0xaf, 0x90,
-    0x9a, 0xa2, 0x77, 0x71, 0x74, 0x8c, 0x71, 0xa5, 0xb5, 0xbf, 0xba, 0xb5,
-    0xac, 0xb5, 0x9c, 0xc9, 0xbf, 0xbf, 0xab, 0xb5, 0x9c, 0xa8, 0xaf, 0xba,
-    0xc7, 0xc2, 0xc4, 0xc7, 0xc7, 0xc7, 0xab, 0xc7, 0xb0, 0xc2, 0xb5, 0xb5,
-    0xb5, 0xba, 0xc7, 0xd6, 0xcf, 0xcf, 0xc9, 0xc7, 0xc7, 0xc2, 0xb5, 0xcf,
-    0xa9, 0x9a, 0xc9, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xcc, 0xcc, 0xcf,
-    0xcc, 0xcc, 0xd6, 0xd7, 0xda, 0xda, 0xda, 0xd7, 0xd6, 0xd6, 0xd6, 0xcf,
-    0xd0, 0xcc, 0xc7, 0xc7, 0xc7, 0xc7, 0xba, 0xa9, 0xc9, 0xc7, 0xc7, 0x8d,
-    0xa9, 0x6a, 0x6a, 0xaf, 0x65, 0x26, 0x9c, 0xa9, 0x8c, 0x9a, 0x83, 0x80,
-    0xb5, 0x90, 0x7e, 0x27, 0x47, 0xa8, 0x8c, 0x94, 0x9e, 0x7a, 0x47, 0x7a,
-    0x59, 0x90, 0x54, 0x3b, 0x27, 0x59, 0x3b, 0x95, 0x9e, 0xad, 0x80, 0xa8,
-    0x95, 0x6a, 0x4e, 0x95, 0x59, 0x75, 0x95, 0x95, 0x68, 0x36, 0x50, 0xa3,
-    0x9e, 0x59, 0x1a, 0x1d, 0x6f, 0x5b, 0x4b, 0x6f, 0x43, 0x68, 0x81, 0x78,
-    0x6c, 0x95, 0x8f, 0x68, 0x6f, 0x36, 0x1a, 0x49, 0x2d, 0x36, 0x26, 0x23,
-    0x0e, 0x13, 0x31, 0x83, 0x42, 0x18, 0x5b, 0x27, 0x1d, 0x0b, 0x0c, 0x0c,
-    0x15, 0x1f, 0x29, 0x64, 0x23, 0x0f, 0x1b, 0x0c, 0x1d, 0x53, 0x1b, 0x0c,
-    0x12, 0x14, 0x07, 0x0b, 0x07, 0x0c, 0x14, 0x03, 0x1e, 0x14, 0x28, 0x14,
-    0x07, 0x15, 0x06, 0x01, 0x06, 0x0c, 0x04, 0x28, 0x17, 0x02, 0x01, 0x01,
-    0x02, 0x01, 0x01, 0x01, 0x52, 0x40, 0x04, 0x01, 0x2e, 0x52, 0x52, 0x52,
-    0x3c, 0x60, 0x62, 0x2e, 0x3a, 0x3c, 0x46, 0x01, 0x04, 0x03, 0x01, 0x01,
-    0x02, 0x07, 0x33, 0x2a, 0x2a, 0x3a, 0x4f, 0x24, 0x05, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x12, 0x2a, 0x53, 0x3f, 0x15, 0x02, 0x01, 0x01, 0x1d,
-    0x1b, 0x73, 0x82, 0x23, 0x01, 0x06, 0x31, 0x06, 0x05, 0x02, 0x01, 0x01,
-    0x01, 0x05, 0x01, 0x02, 0x01, 0x01, 0x5e, 0x6c, 0x5e, 0x05, 0x12, 0x36,
-    0x0b, 0x06, 0x15, 0x0b, 0x06, 0x06, 0x4b, 0x75, 0x36, 0x8c, 0x7a, 0x8f,
-    0x6f, 0x77, 0x7a, 0x71, 0x51, 0x0b, 0x0b, 0x1f, 0x0b, 0x1f, 0x3e, 0x36,
-    0x3e, 0x51, 0x59, 0x83, 0x9b, 0x94, 0xad, 0xaf, 0xa8, 0x9a, 0x9a, 0x8c,
-    0x4b, 0xaf, 0xb0, 0x75, 0xbf, 0xba, 0xa8, 0x8d, 0x9c, 0x7e, 0xa2, 0x69,
-    0x8d, 0xb1, 0x94, 0x65, 0xa8, 0xbf, 0xc4, 0xac, 0xb5, 0xa5, 0xa8, 0xa9,
-    0xa9, 0xb5, 0xbf, 0xbf, 0xba, 0xbf, 0xa9, 0xa8, 0xc7, 0xc3, 0xc2, 0xc7,
-    0xc7, 0xc7, 0xa1, 0xc2, 0xb5, 0xba, 0xc2, 0xc2, 0xb5, 0xb5, 0xb5, 0xba,
-    0xbf, 0xd6, 0xcc, 0xc7, 0xb7, 0xb5, 0xbf, 0xbf, 0x77, 0x7e, 0xcb, 0xc9,
-    0xcf, 0xd6, 0xd6, 0xd6, 0xd6, 0xd7, 0xd7, 0xd7, 0xd6, 0xd6, 0xd6, 0xd7,
-    0xd7, 0xd7, 0xd7, 0xd6, 0xd6, 0xd6, 0xcf, 0xcf, 0xcc, 0xc7, 0xc3, 0xc7,
-    0xc3, 0xc7, 0x7e, 0x69, 0x8d, 0xb5, 0x9a, 0x65, 0x54, 0x51, 0x59, 0xa9,
-    0x34, 0x36, 0xaf, 0xb5, 0xa1, 0x9e, 0xab, 0x9a, 0xb4, 0x7a, 0x65, 0x27,
-    0x9a, 0xaf, 0x83, 0x90, 0x77, 0x6a, 0x59, 0x59, 0x8a, 0x89, 0x59, 0x1f,
-    0x1a, 0x13, 0x36, 0x4e, 0x95, 0xa8, 0x68, 0xa8, 0xa3, 0x59, 0x81, 0x8a,
-    0x89, 0x6f, 0x95, 0x95, 0x83, 0x30, 0x43, 0x68, 0x6f, 0x2d, 0x26, 0x23,
-    0x3d, 0x8f, 0x3b, 0x23, 0x54, 0x59, 0x6f, 0x6a, 0x49, 0xb4, 0x8a, 0x61,
-    0x81, 0x23, 0x1d, 0x1f, 0x3d, 0x1d, 0x15, 0x0b, 0x15, 0x0e, 0x0c, 0x1d,
-    0x27, 0x13, 0x2d, 0x1d, 0x18, 0x12, 0x18, 0x0c, 0x12, 0x12, 0x0f, 0x25,
-    0x23, 0x23, 0x1d, 0x12, 0x25, 0x1d, 0x10, 0x0c, 0x12, 0x12, 0x0c, 0x06,
-    0x06, 0x06, 0x0b, 0x04, 0x20, 0x14, 0x1e, 0x1e, 0x0c, 0x07, 0x09, 0x14,
-    0x09, 0x05, 0x17, 0x58, 0x2a, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
-    0x52, 0x40, 0x04, 0x01, 0x3a, 0x60, 0x52, 0x40, 0x4d, 0x52, 0x60, 0x52,
-    0x52, 0x4d, 0x52, 0x06, 0x04, 0x01, 0x01, 0x01, 0x01, 0x00, 0x1e, 0x4f,
-    0x28, 0x58, 0x58, 0x28, 0x05, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x04,
-    0x29, 0x33, 0x2a, 0x01, 0x02, 0x01, 0x05, 0x42, 0x50, 0x67, 0x93, 0x29,
-    0x01, 0x05, 0x0b, 0x05, 0x03, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01,
-    0x01, 0x05, 0x35, 0x3e, 0x54, 0x1f, 0x01, 0x12, 0x0b, 0x0e, 0x12, 0x06,
-    0x26, 0x06, 0x6a, 0x6a, 0x75, 0x83, 0x83, 0x9b, 0x83, 0x8a, 0x85, 0x1a,
-    0x06, 0x0b, 0x15, 0x36, 0x3e, 0x55, 0x51, 0x77, 0x59, 0x3e, 0x51, 0x54,
-    0x51, 0x77, 0xb5, 0xb5, 0x9b, 0x83, 0x90, 0x6a, 0x5c, 0x75, 0xba, 0x90,
-    0xa8, 0xba, 0xaf, 0x83, 0xab, 0x94, 0xb1, 0x61, 0x6e, 0xba, 0xa9, 0x7e,
-    0x8c, 0xcc, 0xcc, 0xab, 0xaf, 0x85, 0xb1, 0xb1, 0xba, 0xc4, 0xc4, 0xc2,
-    0xc2, 0xbd, 0xb5, 0xb5, 0xb5, 0xc4, 0xc7, 0xc7, 0xc7, 0xc3, 0xb5, 0xb5,
-    0xc2, 0xab, 0xbd, 0xc2, 0xc2, 0xbd, 0xbd, 0xbf, 0xc1, 0xba, 0xc9, 0xcf,
-    0xb7, 0x5c, 0xb1, 0x94, 0x85, 0x6a, 0x98, 0x9c, 0xcf, 0xd6, 0xd6, 0xd6,
-    0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd7, 0xd6, 0xd6, 0xd6,
-    0xcf, 0xcf, 0xcf, 0xd0, 0xc7, 0xc7, 0xc3, 0xc7, 0xc7, 0xb5, 0x7e, 0x94,
-    0x71, 0xa5, 0x8d, 0x85, 0x5c, 0x1a, 0x6e, 0x3e, 0x1f, 0x4b, 0xb7, 0xb5,
-    0x9a, 0xaf, 0x9a, 0x7a, 0xa2, 0x75, 0x34, 0x1f, 0x6a, 0x7a, 0x54, 0x6a,
-    0x61, 0x75, 0x3e, 0x2d, 0x8f, 0x7a, 0x59, 0x4e, 0x26, 0x27, 0x71, 0x64,
-    0x9e, 0x6f, 0x59, 0xad, 0x81, 0x75, 0xb4, 0x9e, 0x95, 0x89, 0xae, 0x9e,
-    0xa3, 0x49, 0x6a, 0x2d, 0x36, 0x4e, 0x61, 0x4b, 0x43, 0xa4, 0x3b, 0x1f,
-    0x30, 0x27, 0x75, 0x68, 0x31, 0x95, 0x8a, 0x4e, 0x75, 0x3b, 0x23, 0x14,
-    0x5e, 0x31, 0x15, 0x0b, 0x13, 0x07, 0x0b, 0x0b, 0x0b, 0x0b, 0x06, 0x0b,
-    0x0b, 0x1d, 0x23, 0x13, 0x0f, 0x13, 0x0f, 0x29, 0x13, 0x25, 0x23, 0x0b,
-    0x18, 0x0c, 0x12, 0x0c, 0x14, 0x12, 0x1b, 0x04, 0x05, 0x0b, 0x0b, 0x06,
-    0x06, 0x1e, 0x1e, 0x07, 0x0c, 0x10, 0x1b, 0x22, 0x10, 0x01, 0x22, 0x3a,
-    0x10, 0x04, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x52, 0x52, 0x04, 0x01,
-    0x40, 0x60, 0x60, 0x52, 0x3c, 0x52, 0x62, 0x60, 0x52, 0x52, 0x2e, 0x14,
-    0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x28, 0x2a, 0x46, 0x3f, 0x33,
-    0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x35, 0x33, 0x03, 0x01,
-    0x01, 0x01, 0x1b, 0x35, 0x67, 0x73, 0x86, 0x04, 0x01, 0x04, 0x05, 0x0b,
-    0x06, 0x01, 0x01, 0x01, 0x02, 0x05, 0x01, 0x02, 0x01, 0x01, 0x2b, 0x23,
-    0x75, 0x2d, 0x0b, 0x0b, 0x23, 0x06, 0x0b, 0x26, 0x3e, 0x15, 0x1f, 0x7a,
-    0x75, 0x2d, 0x75, 0x81, 0x95, 0x8c, 0x18, 0x12, 0x2c, 0x69, 0x7e, 0x3e,
-    0x36, 0x3e, 0x71, 0x71, 0x61, 0x3e, 0x5e, 0x9c, 0x94, 0x61, 0x4b, 0x3e,
-    0x6a, 0x83, 0x69, 0x6a, 0x51, 0x6a, 0x8c, 0xb5, 0xb5, 0xba, 0xa2, 0x85,
-    0xa8, 0xa2, 0xbf, 0x85, 0x77, 0x90, 0xaf, 0xbf, 0x6a, 0xb1, 0xbf, 0xb5,
-    0xa5, 0xb5, 0xc4, 0xbf, 0xc3, 0xc7, 0xbf, 0xc7, 0xc9, 0xc2, 0xbd, 0xc4,
-    0xaf, 0xb5, 0xbf, 0xc2, 0xc2, 0xc3, 0xc4, 0xaf, 0xbd, 0xaf, 0xb4, 0xc2,
-    0xc2, 0xc2, 0xc7, 0xd0, 0xc4, 0xc4, 0xb5, 0xc9, 0xa9, 0x8c, 0xb7, 0x8c,
-    0x94, 0x71, 0x77, 0x85, 0xcc, 0xcc, 0xd6, 0xcf, 0xd7, 0xd6, 0xd6, 0xd6,
-    0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xcf, 0xd0, 0xcf, 0xce, 0xc7,
-    0xc9, 0xc7, 0xc2, 0xc7, 0xc4, 0xb5, 0xba, 0xc2, 0xb5, 0xba, 0x8c, 0x51,
-    0xab, 0x34, 0x54, 0x1f, 0x65, 0x71, 0x83, 0x7e, 0x94, 0xaf, 0x7e, 0x5e,
-    0x80, 0x4b, 0x5c, 0x1a, 0x61, 0x71, 0x69, 0x61, 0x51, 0x47, 0x5c, 0x0f,
-    0x8f, 0x89, 0x49, 0x7e, 0x36, 0x54, 0x59, 0x90, 0x75, 0x3d, 0x59, 0x75,
-    0x9b, 0x9e, 0x95, 0x95, 0x9b, 0x9e, 0xad, 0x6f, 0x81, 0x6a, 0x43, 0x6f,
-    0x36, 0x36, 0x68, 0x31, 0x27, 0x5b, 0x36, 0x47, 0x27, 0x23, 0x30, 0x3e,
-    0x27, 0x8a, 0x68, 0x1a, 0x1f, 0x47, 0x59, 0x31, 0x36, 0x49, 0x23, 0x15,
-    0x13, 0x0b, 0x0e, 0x0c, 0x0e, 0x06, 0x05, 0x06, 0x0b, 0x25, 0x29, 0x29,
-    0x31, 0x14, 0x0f, 0x67, 0x31, 0x10, 0x1a, 0x0a, 0x0c, 0x06, 0x0f, 0x0c,
-    0x14, 0x1b, 0x42, 0x0c, 0x06, 0x0b, 0x04, 0x0c, 0x02, 0x18, 0x14, 0x03,
-    0x1b, 0x10, 0x14, 0x0c, 0x04, 0x04, 0x17, 0x1e, 0x07, 0x33, 0x10, 0x02,
-    0x02, 0x01, 0x02, 0x01, 0x40, 0x60, 0x06, 0x01, 0x2f, 0x60, 0x60, 0x40,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x3c, 0x3a, 0x09, 0x04, 0x01, 0x01, 0x01,
-    0x01, 0x02, 0x02, 0x33, 0x2a, 0x28, 0x33, 0x28, 0x05, 0x02, 0x01, 0x01,
-    0x02, 0x01, 0x01, 0x01, 0x12, 0x06, 0x01, 0x01, 0x01, 0x0c, 0x67, 0x23,
-    0x7b, 0x7b, 0x1b, 0x01, 0x05, 0x06, 0x05, 0x49, 0x0b, 0x04, 0x02, 0x02,
-    0x02, 0x03, 0x02, 0x01, 0x00, 0x01, 0x49, 0x3d, 0x5e, 0x23, 0x05, 0x05,
-    0x0c, 0x05, 0x27, 0x6f, 0x27, 0x2b, 0x54, 0x1d, 0x5e, 0x3e, 0x3e, 0xa1,
-    0x71, 0x1f, 0x0c, 0x54, 0x54, 0x77, 0x5e, 0x61, 0x7e, 0x47, 0x51, 0x6a,
-    0x69, 0x83, 0x9c, 0x8c, 0x75, 0x83, 0x9c, 0x83, 0x51, 0x71, 0x61, 0x1f,
-    0x4b, 0x3e, 0x5c, 0xb0, 0xa8, 0xbf, 0xa1, 0xb5, 0xbf, 0xbf, 0x94, 0x7e,
-    0x6a, 0x71, 0x8d, 0xc4, 0xaf, 0x30, 0xba, 0xb5, 0xb5, 0xc7, 0xbf, 0xc4,
-    0xbf, 0xc7, 0xc2, 0xc7, 0xc7, 0xc3, 0xbf, 0xbf, 0xbf, 0xb5, 0xa8, 0xc4,
-    0xc2, 0xc3, 0xcf, 0xb5, 0xb4, 0xaf, 0xb5, 0xbd, 0xbd, 0xc2, 0xc7, 0xc3,
-    0xc4, 0xce, 0xbf, 0xba, 0xba, 0xb5, 0x8c, 0x8c, 0x4b, 0x65, 0x55, 0x6a,
-    0xba, 0xcf, 0xcf, 0xcf, 0xcf, 0xd7, 0xd6, 0xd0, 0xcf, 0xd0, 0xd6, 0xd6,
-    0xcf, 0xcf, 0xcf, 0xcf, 0xcc, 0xc9, 0x83, 0xc9, 0xc7, 0xc3, 0xc7, 0xbf,
-    0x6a, 0xc4, 0xc2, 0xc3, 0xbd, 0xc4, 0xa5, 0x2d, 0xa2, 0x94, 0x1f, 0x36,
-    0x77, 0x47, 0x36, 0x6a, 0x94, 0x61, 0x83, 0x6a, 0xa8, 0x7a, 0xa8, 0x5e,
-    0x80, 0x77, 0x7e, 0x61, 0x75, 0x6a, 0x54, 0x7e, 0x83, 0x90, 0x49, 0x44,
-    0x1d, 0x16, 0x1f, 0x49, 0x75, 0x6a, 0x59, 0x6a, 0xad, 0x78, 0x3b, 0x81,
-    0x9e, 0xa3, 0xa8, 0x78, 0x75, 0xa3, 0x3d, 0x6f, 0x2d, 0x26, 0x36, 0x80,
-    0x1d, 0x1f, 0x27, 0x43, 0x34, 0x1f, 0x3b, 0x31, 0x13, 0x3d, 0x1f, 0x1c,
-    0x18, 0x54, 0x31, 0x78, 0x54, 0x2d, 0x49, 0x13, 0x0e, 0x0b, 0x0f, 0x12,
-    0x15, 0x0b, 0x01, 0x05, 0x06, 0x12, 0x31, 0x42, 0x24, 0x23, 0x64, 0x67,
-    0x73, 0x31, 0x14, 0x0b, 0x0b, 0x0c, 0x14, 0x20, 0x12, 0x2a, 0x53, 0x12,
-    0x06, 0x06, 0x01, 0x0c, 0x03, 0x04, 0x05, 0x04, 0x09, 0x0b, 0x10, 0x04,
-    0x04, 0x06, 0x0c, 0x14, 0x0c, 0x1e, 0x22, 0x19, 0x02, 0x01, 0x02, 0x01,
-    0x04, 0x17, 0x04, 0x01, 0x22, 0x60, 0x52, 0x52, 0x60, 0x60, 0x60, 0x62,
-    0x28, 0x4d, 0x1e, 0x46, 0x07, 0x01, 0x02, 0x01, 0x01, 0x01, 0x04, 0x24,
-    0x3a, 0x4d, 0x22, 0x46, 0x06, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01,
-    0x03, 0x01, 0x02, 0x01, 0x01, 0x1d, 0x31, 0x2a, 0x50, 0x4f, 0x05, 0x05,
-    0x04, 0x05, 0x05, 0x12, 0x0b, 0x04, 0x03, 0x01, 0x01, 0x05, 0x01, 0x02,
-    0x02, 0x03, 0x64, 0x5e, 0x31, 0x1c, 0x06, 0x0b, 0x04, 0x12, 0x54, 0x83,
-    0x2d, 0x15, 0x5e, 0x27, 0x1f, 0x18, 0x77, 0x30, 0x0b, 0x08, 0x61, 0x6c,
-    0x2d, 0x36, 0x54, 0x61, 0x71, 0x5e, 0x5c, 0x3e, 0x6a, 0x6f, 0x8c, 0x9b,
-    0x9c, 0x47, 0x4e, 0x7e, 0x55, 0x75, 0xb5, 0x5c, 0x94, 0xa9, 0x65, 0x3e,
-    0x9b, 0x94, 0x7a, 0xc4, 0xc4, 0xb5, 0x9a, 0x7e, 0x77, 0x9c, 0x8d, 0xa8,
-    0xb5, 0x51, 0xa5, 0x9a, 0xbf, 0xc7, 0xc4, 0xb5, 0xc2, 0xba, 0xbf, 0xc7,
-    0xc3, 0xc3, 0xc9, 0xad, 0xc4, 0xc2, 0xbd, 0xaf, 0xba, 0xbd, 0xc4, 0xb5,
-    0xb5, 0xb5, 0xa8, 0xc2, 0xb5, 0xc2, 0xc2, 0xce, 0xc9, 0xc4, 0xbf, 0xc4,
-    0xb5, 0xa2, 0x7e, 0x77, 0x77, 0x6a, 0x65, 0x5e, 0x8c, 0xd0, 0xcc, 0xcc,
-    0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xce, 0xcc, 0xce,
-    0xc7, 0xb5, 0xa2, 0xb5, 0xa9, 0xb5, 0xa8, 0x94, 0x1f, 0xc2, 0xbd, 0xc2,
-    0xc2, 0x85, 0x3e, 0x3b, 0x2d, 0x51, 0x83, 0x61, 0x8c, 0x61, 0x4b, 0x77,
-    0xa2, 0x51, 0x71, 0x61, 0x83, 0x83, 0x83, 0x75, 0x8c, 0x6a, 0x59, 0x4e,
-    0x7a, 0x4e, 0x23, 0x7a, 0x43, 0x61, 0x6a, 0x47, 0x1f, 0x1f, 0x13, 0x18,
-    0xa8, 0x6c, 0x30, 0x4e, 0x9e, 0x43, 0x3b, 0x7e, 0x7a, 0x81, 0x9e, 0x68,
-    0x95, 0xa3, 0x7a, 0x95, 0x83, 0x1f, 0x43, 0x6f, 0x5b, 0x59, 0x6f, 0x43,
-    0x4e, 0x2d, 0x59, 0x43, 0x13, 0x13, 0x1d, 0x59, 0x50, 0x54, 0x1f, 0x36,
-    0x43, 0x3d, 0x23, 0x0e, 0x0b, 0x0b, 0x12, 0x15, 0x1f, 0x0c, 0x23, 0x0b,
-    0x01, 0x04, 0x20, 0x23, 0x1a, 0x23, 0x23, 0x31, 0x70, 0x29, 0x1d, 0x14,
-    0x15, 0x10, 0x1b, 0x1b, 0x10, 0x1b, 0x24, 0x06, 0x06, 0x06, 0x05, 0x04,
-    0x03, 0x0b, 0x06, 0x04, 0x07, 0x07, 0x07, 0x01, 0x01, 0x03, 0x04, 0x04,
-    0x07, 0x1b, 0x14, 0x28, 0x01, 0x02, 0x01, 0x01, 0x17, 0x07, 0x07, 0x02,
-    0x10, 0x60, 0x40, 0x60, 0x60, 0x60, 0x52, 0x4d, 0x4d, 0x22, 0x33, 0x3c,
-    0x10, 0x01, 0x02, 0x01, 0x01, 0x01, 0x06, 0x04, 0x2a, 0x46, 0x33, 0x42,
-    0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05,
-    0x3d, 0x33, 0x53, 0x2a, 0x29, 0x0c, 0x02, 0x06, 0x01, 0x12, 0x06, 0x04,
-    0x05, 0x0b, 0x04, 0x01, 0x01, 0x05, 0x02, 0x02, 0x01, 0x1b, 0x54, 0x8a,
-    0x3f, 0x1a, 0x08, 0x05, 0x06, 0x69, 0x75, 0x6f, 0x26, 0x75, 0x3d, 0x26,
-    0x15, 0x1c, 0x18, 0x11, 0x04, 0x36, 0x2d, 0x2d, 0x77, 0x59, 0x8a, 0x89,
-    0x61, 0x64, 0x5e, 0x54, 0x83, 0x83, 0x77, 0x7e, 0x9b, 0x83, 0xb0, 0x59,
-    0x4b, 0x6a, 0x77, 0x83, 0xab, 0xa2, 0x77, 0x8c, 0x71, 0x61, 0x61, 0x9c,
-    0xb5, 0xb0, 0x83, 0xaf, 0xa2, 0x8d, 0xa2, 0x6a, 0x9a, 0x94, 0x5c, 0x8c,
-    0xc2, 0xce, 0xc7, 0xb5, 0xb5, 0x8c, 0xb5, 0xc7, 0xc7, 0xc3, 0xc3, 0xcf,
-    0xaf, 0xba, 0xc4, 0xbf, 0xbf, 0xc3, 0xb5, 0xc3, 0xba, 0xbd, 0xa2, 0xa9,
-    0xb5, 0xbf, 0xbd, 0x9e, 0xba, 0x71, 0xb7, 0xb1, 0x94, 0x8d, 0x61, 0x7f,
-    0x44, 0x65, 0x65, 0x94, 0xa5, 0xbf, 0xcf, 0xcc, 0xcf, 0xcf, 0xcf, 0xcf,
-    0xcf, 0xcf, 0xce, 0xcc, 0xcc, 0xcc, 0xc7, 0xc7, 0xc7, 0xc3, 0xbf, 0x23,
-    0x26, 0x1a, 0x1f, 0x77, 0x5e, 0xc3, 0xc2, 0xbd, 0xa2, 0x27, 0x2c, 0x7e,
-    0x5c, 0x23, 0x8c, 0x5c, 0x9a, 0x77, 0x65, 0x1d, 0x1f, 0x36, 0x7a, 0x69,
-    0x61, 0x4b, 0x61, 0x61, 0x71, 0x6a, 0x8c, 0x61, 0x59, 0x2d, 0x6a, 0x43,
-    0x4b, 0x54, 0x61, 0x1d, 0x13, 0x26, 0x13, 0x15, 0x8a, 0x75, 0x3d, 0x71,
-    0x68, 0x7a, 0x1d, 0x68, 0x75, 0x83, 0xa3, 0x95, 0x95, 0x9e, 0xad, 0xad,
-    0xad, 0x59, 0x54, 0x3d, 0x6f, 0x81, 0x59, 0x2d, 0x7a, 0x5e, 0x1a, 0x2d,
-    0x43, 0x1f, 0x1f, 0x78, 0x81, 0x78, 0x36, 0x27, 0x18, 0x1d, 0x1d, 0x12,
-    0x0e, 0x1a, 0x3d, 0x26, 0x0b, 0x0b, 0x0c, 0x0b, 0x02, 0x03, 0x05, 0x12,
-    0x12, 0x12, 0x0f, 0x3f, 0x63, 0x64, 0x29, 0x20, 0x1d, 0x1b, 0x24, 0x06,
-    0x1b, 0x13, 0x12, 0x06, 0x04, 0x06, 0x01, 0x05, 0x06, 0x03, 0x05, 0x04,
-    0x01, 0x0c, 0x04, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0c, 0x06, 0x07, 0x17,
-    0x12, 0x01, 0x01, 0x01, 0x40, 0x10, 0x01, 0x01, 0x0d, 0x52, 0x60, 0x60,
-    0x60, 0x60, 0x52, 0x40, 0x28, 0x22, 0x3a, 0x46, 0x17, 0x01, 0x01, 0x01,
-    0x01, 0x02, 0x01, 0x04, 0x3f, 0x1e, 0x1e, 0x46, 0x10, 0x02, 0x02, 0x01,
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x05, 0x14, 0x67, 0x24, 0x35, 0x0c,
-    0x13, 0x01, 0x01, 0x01, 0x0b, 0x27, 0x56, 0x29, 0x04, 0x04, 0x06, 0x05,
-    0x01, 0x01, 0x01, 0x00, 0x01, 0x2d, 0x2b, 0x9e, 0x64, 0x05, 0x05, 0x0b,
-    0x06, 0x23, 0x6a, 0x76, 0x31, 0x75, 0xa4, 0x4e, 0x0e, 0x12, 0x08, 0x0b,
-    0x3e, 0x4b, 0x36, 0x8a, 0x75, 0x77, 0x83, 0x9b, 0x71, 0x6a, 0x47, 0xb0,
-    0x75, 0x8c, 0x7a, 0x7a, 0x89, 0x71, 0xa8, 0xa1, 0x85, 0x51, 0x23, 0x9a,
-    0x9a, 0x75, 0x83, 0x75, 0x49, 0xb0, 0x6a, 0xa5, 0xba, 0xa5, 0x83, 0x9a,
-    0xa2, 0xb1, 0x83, 0x9a, 0x77, 0x7e, 0x8d, 0x61, 0xc2, 0xc4, 0xbf, 0xa8,
-    0xbf, 0xbf, 0xc7, 0xc3, 0xc3, 0xc7, 0xc7, 0xc3, 0xbf, 0xbd, 0xba, 0xc4,
-    0xc2, 0xbd, 0xc2, 0xbf, 0xba, 0xaf, 0xb5, 0xb5, 0xba, 0xb5, 0x9c, 0x65,
-    0x5e, 0x2d, 0x94, 0x90, 0xa2, 0x98, 0x3e, 0x51, 0x74, 0x4b, 0x4b, 0xb1,
-    0xb1, 0xcf, 0xd0, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc7,
-    0xc7, 0xc7, 0xc7, 0xc7, 0xc3, 0xc7, 0x90, 0xa9, 0x2d, 0x26, 0x7e, 0xba,
-    0xc9, 0xc2, 0xc2, 0xc4, 0x59, 0x3e, 0x8c, 0xa8, 0xbf, 0x47, 0x26, 0x1f,
-    0x4b, 0x7e, 0x5e, 0x2c, 0x36, 0x2c, 0x71, 0x7a, 0x71, 0x7a, 0x71, 0x95,
-    0x85, 0x59, 0x9e, 0x61, 0x3e, 0x26, 0x54, 0x47, 0x36, 0x36, 0x80, 0x89,
-    0x27, 0x23, 0x1a, 0x13, 0x8a, 0x4e, 0x36, 0x7a, 0x1d, 0x47, 0x49, 0x83,
-    0x5b, 0x4e, 0x68, 0xa8, 0xa3, 0x81, 0xa3, 0xad, 0xad, 0x9e, 0x43, 0x1f,
-    0x4e, 0x54, 0x43, 0x5b, 0x47, 0x31, 0x36, 0x68, 0x2d, 0x31, 0x12, 0x1f,
-    0x7a, 0x31, 0x1d, 0x13, 0x2d, 0x31, 0x0b, 0x1f, 0x12, 0x1d, 0x13, 0x13,
-    0x12, 0x13, 0x13, 0x1d, 0x07, 0x06, 0x05, 0x06, 0x0c, 0x13, 0x12, 0x67,
-    0x42, 0x20, 0x2b, 0x25, 0x14, 0x23, 0x1b, 0x04, 0x1b, 0x09, 0x15, 0x06,
-    0x04, 0x04, 0x01, 0x0a, 0x04, 0x01, 0x03, 0x03, 0x03, 0x05, 0x04, 0x01,
-    0x03, 0x05, 0x04, 0x04, 0x07, 0x07, 0x10, 0x10, 0x10, 0x04, 0x02, 0x01,
-    0x2f, 0x2f, 0x04, 0x02, 0x07, 0x52, 0x60, 0x60, 0x52, 0x60, 0x52, 0x2f,
-    0x24, 0x17, 0x22, 0x22, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06,
-    0x2e, 0x2a, 0x1e, 0x33, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x0c, 0x42, 0x24, 0x1b, 0x25, 0x12, 0x06, 0x05, 0x01, 0x01,
-    0x23, 0x67, 0x67, 0x3d, 0x3d, 0x15, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x3d, 0x0f, 0x64, 0x1b, 0x05, 0x0b, 0x3e, 0x23, 0x08, 0x54, 0x8f,
-    0x36, 0x7d, 0x8f, 0x7a, 0x0b, 0x0e, 0x1f, 0x3e, 0x1a, 0x77, 0x5e, 0x51,
-    0x61, 0x4e, 0x49, 0x9e, 0x7a, 0x2d, 0x75, 0x7a, 0x71, 0x5e, 0x47, 0x5e,
-    0x89, 0x8c, 0x83, 0x9a, 0xa8, 0x51, 0x4b, 0x7e, 0xa9, 0xab, 0x9c, 0x7e,
-    0x71, 0x6a, 0x71, 0xa9, 0xaf, 0x89, 0xb5, 0xaf, 0x77, 0x9a, 0xba, 0x89,
-    0xa2, 0x85, 0x61, 0x5c, 0x94, 0xba, 0xa9, 0xb5, 0xbd, 0xc7, 0xc7, 0xc3,
-    0xc7, 0xc2, 0xc7, 0xc3, 0xc2, 0xc3, 0xc2, 0xc2, 0xc3, 0xba, 0xbf, 0xc2,
-    0xba, 0xba, 0xba, 0xa8, 0xc3, 0xaf, 0x71, 0x5c, 0x51, 0x47, 0x71, 0x7e,
-    0x77, 0x8d, 0x71, 0x94, 0x51, 0x51, 0x77, 0x90, 0xc4, 0x8c, 0xbf, 0xce,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
-    0xc7, 0xc2, 0xc9, 0xc4, 0xa2, 0x7e, 0xa9, 0xc3, 0xc2, 0xc4, 0xc3, 0xaf,
-    0x9a, 0x6a, 0xbd, 0x9a, 0x9a, 0x61, 0x77, 0x6a, 0x1f, 0x8d, 0x6a, 0x77,
-    0x71, 0x54, 0x90, 0x83, 0x71, 0x47, 0x90, 0x95, 0x8c, 0x7a, 0x6a, 0x61,
-    0x2c, 0x34, 0x59, 0x59, 0x59, 0x3b, 0x61, 0x6f, 0x4e, 0x26, 0x13, 0x1f,
-    0x8f, 0x4e, 0x3e, 0x43, 0x30, 0x64, 0x7a, 0x75, 0x75, 0x75, 0x68, 0x80,
-    0xa4, 0x95, 0xa3, 0xad, 0xad, 0xa3, 0x4e, 0x1a, 0x23, 0x23, 0x49, 0x43,
-    0x4e, 0x78, 0x75, 0x81, 0x54, 0x1d, 0x26, 0x23, 0x49, 0x1a, 0x15, 0x1f,
-    0x64, 0x64, 0x1a, 0x20, 0x0f, 0x0c, 0x12, 0x1a, 0x1a, 0x2a, 0x13, 0x20,
-    0x06, 0x06, 0x05, 0x06, 0x07, 0x2b, 0x13, 0x10, 0x0c, 0x05, 0x07, 0x1d,
-    0x33, 0x29, 0x1e, 0x06, 0x07, 0x0b, 0x12, 0x20, 0x0b, 0x06, 0x06, 0x10,
-    0x04, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x04, 0x04, 0x04, 0x0c, 0x04,
-    0x06, 0x14, 0x10, 0x09, 0x1e, 0x22, 0x01, 0x02, 0x22, 0x52, 0x07, 0x01,
-    0x01, 0x40, 0x52, 0x60, 0x60, 0x52, 0x2e, 0x22, 0x2e, 0x4d, 0x3c, 0x4d,
-    0x17, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x3a, 0x1e, 0x33, 0x3a,
-    0x12, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x0c, 0x14, 0x23,
-    0x1e, 0x33, 0x0b, 0x1b, 0x05, 0x03, 0x01, 0x15, 0x35, 0x64, 0x67, 0x67,
-    0x7b, 0x31, 0x0b, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x76, 0x0c, 0x49,
-    0x0b, 0x05, 0x76, 0x49, 0x54, 0x0e, 0x36, 0x8f, 0x2d, 0x9b, 0x36, 0x02,
-    0x0b, 0x4b, 0x36, 0x2d, 0x2d, 0x69, 0x8a, 0x49, 0x6a, 0x61, 0x54, 0x59,
-    0x3e, 0x3d, 0x83, 0x8c, 0x4e, 0x2d, 0x69, 0x6f, 0xa8, 0x9b, 0x83, 0x9b,
-    0x9a, 0x36, 0x5e, 0xa8, 0x77, 0xab, 0x85, 0x8c, 0x77, 0x5e, 0x77, 0x83,
-    0xa9, 0xb5, 0xb5, 0xaf, 0x77, 0x9a, 0xa2, 0x94, 0x98, 0x61, 0x6a, 0x77,
-    0x6a, 0x94, 0xa9, 0xc2, 0xc7, 0xc7, 0xc7, 0xc7, 0xc2, 0xc2, 0xc2, 0xc2,
-    0xc3, 0xc2, 0xc3, 0xc2, 0xc2, 0xbd, 0xc2, 0xc2, 0xba, 0xb5, 0xb4, 0xaf,
-    0xbd, 0xa8, 0x77, 0x6e, 0x3e, 0x41, 0x34, 0x7f, 0x59, 0xa2, 0x77, 0x71,
-    0x5c, 0x4b, 0x51, 0x9a, 0xb7, 0x47, 0xb5, 0xce, 0xce, 0xce, 0xc7, 0xc7,
-    0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc3, 0xc2, 0xc2, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xbf, 0xc3, 0xc3, 0xb9, 0xb9, 0xbf, 0xbd, 0xba, 0xa8, 0xc2, 0x30,
-    0x4e, 0x6a, 0xba, 0xa8, 0x6a, 0xa2, 0x71, 0x77, 0x7e, 0x54, 0x83, 0x59,
-    0x51, 0x6a, 0x9e, 0xa8, 0x75, 0x4b, 0x61, 0x83, 0x47, 0x3e, 0x6a, 0x6f,
-    0x6f, 0x36, 0x26, 0x2d, 0x36, 0x0e, 0x0c, 0x34, 0x61, 0x71, 0x59, 0x23,
-    0x61, 0x61, 0x49, 0x6f, 0x68, 0x68, 0x7a, 0x81, 0x9e, 0x95, 0xa3, 0xa3,
-    0xad, 0x95, 0x68, 0x23, 0x23, 0x68, 0x59, 0x54, 0x68, 0x78, 0x8a, 0x6f,
-    0x4e, 0x27, 0x1a, 0x75, 0x5b, 0x23, 0x0b, 0x0f, 0x3d, 0x27, 0x1a, 0x23,
-    0x23, 0x0c, 0x20, 0x20, 0x15, 0x27, 0x2a, 0x1d, 0x0e, 0x06, 0x0b, 0x06,
-    0x04, 0x23, 0x25, 0x0b, 0x06, 0x05, 0x12, 0x1d, 0x1e, 0x42, 0x1b, 0x07,
-    0x07, 0x06, 0x0b, 0x07, 0x24, 0x14, 0x10, 0x2a, 0x07, 0x06, 0x03, 0x07,
-    0x06, 0x01, 0x03, 0x05, 0x04, 0x01, 0x06, 0x04, 0x06, 0x10, 0x17, 0x10,
-    0x22, 0x10, 0x10, 0x01, 0x17, 0x3c, 0x22, 0x01, 0x01, 0x52, 0x40, 0x52,
-    0x40, 0x33, 0x2f, 0x2e, 0x52, 0x60, 0x52, 0x3c, 0x22, 0x04, 0x01, 0x01,
-    0x02, 0x01, 0x01, 0x01, 0x17, 0x3a, 0x33, 0x17, 0x14, 0x01, 0x02, 0x02,
-    0x02, 0x01, 0x01, 0x01, 0x04, 0x15, 0x14, 0x14, 0x3f, 0x1b, 0x29, 0x0c,
-    0x05, 0x01, 0x01, 0x0c, 0x2a, 0x73, 0x50, 0x7d, 0x7d, 0x54, 0x25, 0x05,
-    0x01, 0x01, 0x02, 0x01, 0x01, 0x31, 0x13, 0x21, 0x0b, 0x1a, 0xa1, 0x54,
-    0x36, 0x0c, 0x06, 0x54, 0x2d, 0x27, 0x01, 0x11, 0x0b, 0x59, 0x3d, 0x47,
-    0x69, 0x3e, 0x5e, 0x8a, 0x75, 0x8f, 0x6a, 0x54, 0x71, 0x3d, 0x61, 0x71,
-    0x7a, 0x2d, 0x7a, 0x83, 0x83, 0x83, 0x8c, 0xbd, 0x94, 0x55, 0x54, 0xb5,
-    0xa1, 0x8c, 0x6a, 0x83, 0x9c, 0x5e, 0x59, 0x5e, 0x9a, 0xbf, 0xa8, 0xb1,
-    0x8c, 0x9c, 0x61, 0x8c, 0x90, 0x61, 0x71, 0x71, 0x6a, 0x7e, 0x83, 0xc3,
-    0xc7, 0xc3, 0xc7, 0xc7, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc3, 0xc2,
-    0xbd, 0xc2, 0xc2, 0xc2, 0xbd, 0xaf, 0xb5, 0xaf, 0x9e, 0xbd, 0x85, 0x7e,
-    0x36, 0x4b, 0x5c, 0x85, 0x61, 0x6a, 0x47, 0x5c, 0x26, 0x2d, 0x2c, 0x90,
-    0xb1, 0x7e, 0x9a, 0xc3, 0xc7, 0xcf, 0xc7, 0xc3, 0xc3, 0xc3, 0xc3, 0xc7,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xb9, 0xb9,
-    0xb9, 0xb9, 0xb9, 0xbf, 0xc2, 0xb9, 0xaf, 0x30, 0xaf, 0x90, 0xc2, 0x9e,
-    0x7a, 0x7e, 0x61, 0x61, 0x6a, 0x83, 0x71, 0x51, 0x6a, 0x75, 0x8f, 0x8c,
-    0x6f, 0x3e, 0x47, 0x6a, 0x51, 0x36, 0x47, 0x77, 0x71, 0x43, 0x1a, 0x1a,
-    0x1a, 0x1a, 0x13, 0x20, 0x68, 0x7a, 0x3d, 0x1f, 0x59, 0x75, 0x59, 0x6a,
-    0x4e, 0x61, 0x6a, 0x8a, 0xa3, 0xa3, 0x8f, 0x6f, 0xa3, 0x6f, 0x36, 0x3b,
-    0x43, 0x6f, 0x3d, 0x5b, 0x7a, 0x95, 0x96, 0x8a, 0x78, 0x5b, 0x18, 0x36,
-    0x4e, 0x49, 0x15, 0x13, 0x36, 0x1c, 0x3d, 0x1d, 0x13, 0x23, 0x1d, 0x27,
-    0x1f, 0x1d, 0x15, 0x12, 0x07, 0x0c, 0x0c, 0x0c, 0x06, 0x0c, 0x1d, 0x13,
-    0x0b, 0x05, 0x06, 0x0c, 0x1d, 0x14, 0x1d, 0x0c, 0x07, 0x07, 0x0b, 0x12,
-    0x14, 0x07, 0x04, 0x10, 0x07, 0x06, 0x07, 0x10, 0x04, 0x01, 0x04, 0x06,
-    0x04, 0x04, 0x07, 0x07, 0x04, 0x06, 0x10, 0x14, 0x07, 0x14, 0x1e, 0x01,
-    0x2f, 0x2f, 0x2e, 0x01, 0x01, 0x40, 0x52, 0x40, 0x2f, 0x22, 0x40, 0x40,
-    0x52, 0x52, 0x62, 0x52, 0x1e, 0x04, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x14, 0x58, 0x33, 0x0c, 0x1b, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x14, 0x20, 0x24, 0x14, 0x2a, 0x14, 0x31, 0x05, 0x01, 0x04, 0x03, 0x2a,
-    0x42, 0x53, 0x73, 0x42, 0x5b, 0x64, 0x3f, 0x05, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x0b, 0x15, 0x0b, 0x0b, 0x5e, 0x78, 0x61, 0x13, 0x54, 0x20, 0x05,
-    0x11, 0x01, 0x27, 0x5c, 0x27, 0x4b, 0x59, 0x27, 0x54, 0x7a, 0x5e, 0x7a,
-    0x5e, 0x75, 0x59, 0x6a, 0x6a, 0x43, 0x69, 0x7a, 0x9e, 0x75, 0x7a, 0x77,
-    0x3e, 0x7a, 0xa8, 0x9b, 0x90, 0x71, 0xab, 0x61, 0xb4, 0x9a, 0x75, 0x71,
-    0x7e, 0x83, 0x7e, 0x83, 0x94, 0xa8, 0x94, 0x94, 0x83, 0x85, 0x90, 0x7e,
-    0xba, 0x6a, 0x77, 0x9a, 0x7e, 0x9a, 0x8c, 0xa8, 0xc7, 0xc2, 0xc2, 0xc2,
-    0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xb9, 0xc4, 0xc2, 0xb5, 0xc2, 0xc2, 0xc2,
-    0xba, 0xb5, 0xba, 0x9e, 0x83, 0x9a, 0x61, 0x90, 0x3b, 0x3e, 0x65, 0x59,
-    0x5c, 0x51, 0x4b, 0x47, 0x1f, 0x2c, 0x34, 0x61, 0x7e, 0x5c, 0x7e, 0xc3,
-    0xc9, 0xc3, 0xc3, 0xc3, 0xc9, 0xc3, 0xc3, 0xc3, 0xc9, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xb9, 0xb9, 0xc2, 0xb9, 0xbd, 0xb9, 0xb9, 0xb9, 0xbf,
-    0xbd, 0xbd, 0x9e, 0x7a, 0xc2, 0xa8, 0xbf, 0xa8, 0x83, 0x7a, 0x51, 0x5c,
-    0x47, 0x75, 0x71, 0x6a, 0x77, 0x61, 0x83, 0x89, 0x7a, 0x71, 0x2d, 0x47,
-    0x47, 0x1f, 0x26, 0x4e, 0x6f, 0x59, 0x30, 0x2c, 0x26, 0x1f, 0x16, 0x23,
-    0x4e, 0x3b, 0x2d, 0x43, 0x51, 0x95, 0x59, 0x51, 0x27, 0x5e, 0x59, 0x7a,
-    0x8a, 0x75, 0x8a, 0x59, 0x8f, 0xa4, 0x78, 0x6f, 0x81, 0x6f, 0x68, 0x75,
-    0x81, 0x8a, 0x95, 0x8f, 0x54, 0x68, 0x18, 0x13, 0x0b, 0x23, 0x0f, 0x27,
-    0x23, 0x1f, 0x49, 0x1f, 0x15, 0x1b, 0x1a, 0x1d, 0x13, 0x0c, 0x0c, 0x0c,
-    0x04, 0x12, 0x15, 0x12, 0x0c, 0x0b, 0x0c, 0x15, 0x04, 0x05, 0x04, 0x07,
-    0x14, 0x10, 0x10, 0x0f, 0x07, 0x0c, 0x06, 0x12, 0x06, 0x05, 0x06, 0x06,
-    0x04, 0x06, 0x07, 0x12, 0x01, 0x01, 0x07, 0x0c, 0x06, 0x06, 0x07, 0x10,
-    0x07, 0x06, 0x07, 0x10, 0x1e, 0x07, 0x07, 0x01, 0x40, 0x40, 0x52, 0x01,
-    0x01, 0x2f, 0x40, 0x2f, 0x22, 0x22, 0x40, 0x52, 0x60, 0x3c, 0x2e, 0x2f,
-    0x3a, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1b, 0x28, 0x0d, 0x24,
-    0x10, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x14, 0x1e, 0x1e, 0x24,
-    0x42, 0x12, 0x12, 0x01, 0x01, 0x1c, 0x24, 0x7b, 0x73, 0x67, 0x73, 0x67,
-    0x64, 0x23, 0x64, 0x0b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0c, 0x0b, 0x03,
-    0x36, 0x68, 0x50, 0x3e, 0x2d, 0x8f, 0x76, 0x04, 0x03, 0x3b, 0x6f, 0x59,
-    0x23, 0x26, 0x2b, 0x3e, 0x1d, 0x54, 0x94, 0x83, 0x54, 0x61, 0x6f, 0x47,
-    0x61, 0x6a, 0x69, 0x7a, 0x8c, 0x9b, 0x77, 0x61, 0x69, 0x4e, 0x9b, 0xa2,
-    0x9c, 0x71, 0x83, 0x59, 0x8c, 0x94, 0x83, 0x4e, 0x4b, 0x69, 0x94, 0x75,
-    0x83, 0x65, 0x6a, 0x9e, 0x90, 0x61, 0xaf, 0x8c, 0x94, 0x7e, 0x89, 0xb5,
-    0x71, 0xaf, 0xb5, 0xaf, 0xa1, 0xc3, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2,
-    0xc2, 0xc3, 0xc4, 0xba, 0xbd, 0xc2, 0xc2, 0xbd, 0xba, 0xba, 0xa8, 0xb4,
-    0x89, 0x8d, 0x75, 0x8c, 0x6a, 0x3e, 0x47, 0x59, 0x65, 0x47, 0x36, 0x34,
-    0x2c, 0x6e, 0x61, 0x1f, 0x1f, 0x2c, 0xb1, 0xc9, 0xc9, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xb9, 0xb9, 0xb9, 0xb9,
-    0xb9, 0xbf, 0xb9, 0xbd, 0xb9, 0xb9, 0xbd, 0xbd, 0xbd, 0xbd, 0xb5, 0xa8,
-    0xa8, 0x83, 0xb5, 0x77, 0x9c, 0x68, 0x3e, 0x47, 0x61, 0x75, 0x75, 0x75,
-    0x59, 0x83, 0x8c, 0x89, 0x9e, 0x94, 0x61, 0x36, 0x36, 0x13, 0x51, 0x59,
-    0x64, 0x4e, 0x49, 0x59, 0x61, 0x1f, 0x1a, 0x1d, 0x2c, 0x61, 0x7a, 0x81,
-    0x59, 0x9e, 0x95, 0x36, 0x3e, 0x54, 0x61, 0x7a, 0x6f, 0x75, 0x81, 0x83,
-    0x5b, 0x8f, 0x81, 0x75, 0xa3, 0x81, 0x8a, 0x81, 0x75, 0x6f, 0x68, 0x49,
-    0x12, 0x23, 0x06, 0x07, 0x15, 0x1b, 0x0f, 0x1d, 0x2d, 0x1d, 0x18, 0x1d,
-    0x13, 0x0c, 0x13, 0x13, 0x0b, 0x10, 0x1d, 0x15, 0x0c, 0x0b, 0x1c, 0x0b,
-    0x12, 0x10, 0x08, 0x07, 0x14, 0x0b, 0x05, 0x04, 0x07, 0x0c, 0x1a, 0x0f,
-    0x07, 0x0c, 0x07, 0x14, 0x06, 0x04, 0x06, 0x03, 0x06, 0x06, 0x04, 0x06,
-    0x04, 0x05, 0x06, 0x0c, 0x07, 0x04, 0x07, 0x10, 0x07, 0x17, 0x17, 0x22,
-    0x0d, 0x09, 0x24, 0x04, 0x2e, 0x40, 0x22, 0x03, 0x01, 0x0d, 0x2f, 0x2f,
-    0x28, 0x3c, 0x52, 0x3a, 0x2f, 0x40, 0x52, 0x22, 0x3c, 0x0d, 0x01, 0x01,
-    0x01, 0x01, 0x02, 0x02, 0x1e, 0x10, 0x1e, 0x4f, 0x1b, 0x02, 0x01, 0x02,
-    0x02, 0x01, 0x01, 0x01, 0x07, 0x33, 0x42, 0x35, 0x14, 0x25, 0x04, 0x02,
-    0x00, 0x24, 0x50, 0x82, 0x93, 0x67, 0x50, 0x7b, 0x42, 0x73, 0x29, 0x06,
-    0x01, 0x02, 0x01, 0x01, 0x05, 0x0b, 0x05, 0x0b, 0x6c, 0x68, 0x2b, 0x54,
-    0x31, 0x6a, 0x1f, 0x04, 0x27, 0x47, 0x86, 0x49, 0x3e, 0x59, 0x8c, 0x4e,
-    0x7a, 0x18, 0x25, 0x9b, 0x81, 0x54, 0x6a, 0x3e, 0x69, 0x61, 0x6a, 0x61,
-    0x71, 0x7a, 0x94, 0x54, 0x54, 0x36, 0x3e, 0x36, 0x6a, 0x2d, 0xb5, 0x83,
-    0x6a, 0x83, 0x8f, 0x7e, 0x4b, 0x7a, 0x6a, 0x69, 0x65, 0x61, 0x77, 0x9a,
-    0x98, 0x9a, 0x9c, 0xb5, 0x7e, 0x7e, 0x75, 0xa9, 0x61, 0xc2, 0xb5, 0xc7,
-    0x90, 0x9e, 0xb5, 0xba, 0xc3, 0xc2, 0xc2, 0xc2, 0xc3, 0xbf, 0x9e, 0xb5,
-    0xc2, 0xc2, 0xc2, 0xb4, 0xc2, 0xb4, 0xaf, 0x89, 0x83, 0x75, 0x80, 0x59,
-    0x6a, 0x5c, 0x4b, 0x71, 0x71, 0x44, 0x26, 0x44, 0x23, 0x51, 0x55, 0x1f,
-    0x44, 0x27, 0x90, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xbd,
-    0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xa1, 0x59, 0xad, 0xb4, 0x90, 0x83, 0x83,
-    0x9a, 0x8c, 0x2d, 0x6a, 0x75, 0x7a, 0x77, 0x6a, 0x6a, 0x71, 0x61, 0x49,
-    0xbd, 0x83, 0x7e, 0x3e, 0x49, 0x1a, 0x2c, 0x61, 0x8c, 0x49, 0x5c, 0x54,
-    0x2d, 0x13, 0x15, 0x47, 0x23, 0x89, 0x8a, 0x80, 0x68, 0x68, 0x8a, 0x59,
-    0x59, 0x31, 0x5b, 0x96, 0x96, 0x95, 0x68, 0x5e, 0x61, 0x7a, 0x95, 0x81,
-    0x96, 0x6f, 0x7a, 0x68, 0x43, 0x68, 0x5b, 0x1f, 0x1f, 0x3d, 0x23, 0x6c,
-    0x1f, 0x23, 0x12, 0x14, 0x18, 0x0b, 0x0c, 0x3d, 0x1a, 0x12, 0x0f, 0x23,
-    0x1a, 0x0c, 0x13, 0x0e, 0x0b, 0x12, 0x12, 0x0b, 0x05, 0x07, 0x06, 0x07,
-    0x20, 0x0c, 0x04, 0x04, 0x05, 0x04, 0x0c, 0x0e, 0x07, 0x14, 0x07, 0x0c,
-    0x07, 0x03, 0x04, 0x04, 0x04, 0x06, 0x1e, 0x06, 0x03, 0x07, 0x24, 0x0c,
-    0x0a, 0x06, 0x10, 0x10, 0x09, 0x10, 0x17, 0x17, 0x10, 0x03, 0x09, 0x01,
-    0x2f, 0x2f, 0x22, 0x07, 0x01, 0x09, 0x22, 0x2e, 0x2f, 0x2f, 0x40, 0x28,
-    0x52, 0x3c, 0x3c, 0x40, 0x62, 0x22, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03,
-    0x0a, 0x03, 0x3a, 0x10, 0x12, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02,
-    0x06, 0x3f, 0x29, 0x13, 0x10, 0x2a, 0x02, 0x02, 0x01, 0x73, 0x53, 0x70,
-    0x87, 0x50, 0x53, 0x31, 0x25, 0x7b, 0x49, 0x05, 0x01, 0x01, 0x01, 0x03,
-    0x05, 0x05, 0x01, 0x23, 0x75, 0x49, 0x27, 0x8f, 0x1d, 0x0b, 0x05, 0x13,
-    0x27, 0x75, 0x71, 0x68, 0x7a, 0x2b, 0x2d, 0x49, 0x78, 0x7a, 0x49, 0x27,
-    0xa2, 0x61, 0x54, 0x4b, 0x2d, 0x3e, 0x3e, 0x31, 0x36, 0x3b, 0x3e, 0x16,
-    0x36, 0x47, 0x85, 0x8c, 0x1d, 0x2d, 0x83, 0x7e, 0x6f, 0x8c, 0x94, 0x75,
-    0x51, 0x71, 0x4b, 0x71, 0x6f, 0x7e, 0x71, 0x8c, 0xaf, 0x9c, 0xbd, 0xba,
-    0x77, 0x9a, 0x55, 0x90, 0xab, 0xb5, 0xba, 0xbf, 0xb5, 0x9e, 0xbd, 0xbd,
-    0xaf, 0xbd, 0xc2, 0xc2, 0xc2, 0xba, 0xb5, 0xaf, 0xbf, 0xaf, 0x90, 0xaf,
-    0xb4, 0xb9, 0xb4, 0x7e, 0x75, 0x61, 0x47, 0x83, 0x4e, 0x44, 0x59, 0x8c,
-    0x85, 0x6a, 0x65, 0x2c, 0x34, 0x26, 0x44, 0x26, 0x26, 0x26, 0x4b, 0x9a,
-    0xc2, 0xc3, 0xc3, 0xc2, 0xc3, 0xc3, 0xc3, 0xc3, 0xb9, 0xb9, 0xb9, 0xb9,
-    0xb9, 0xb9, 0xb9, 0xb9, 0xbd, 0xbd, 0xb9, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd,
-    0x9e, 0x4e, 0x26, 0xa8, 0xb5, 0xb5, 0x6a, 0x75, 0x9a, 0x94, 0x51, 0x4e,
-    0x36, 0x5c, 0x4e, 0x2c, 0x3e, 0x59, 0x61, 0x59, 0x71, 0x8c, 0x61, 0x47,
-    0x4e, 0x47, 0x2d, 0x75, 0x4e, 0x6a, 0x54, 0x3b, 0x15, 0x1f, 0x26, 0x23,
-    0x1a, 0x2d, 0x4e, 0x64, 0x80, 0x77, 0x75, 0x68, 0x75, 0x4e, 0x54, 0x8a,
-    0x83, 0xa3, 0x54, 0x7a, 0x5b, 0x78, 0x95, 0x8a, 0x6f, 0x8a, 0x8a, 0x49,
-    0x23, 0x43, 0x27, 0x1f, 0x64, 0x75, 0x50, 0x23, 0x36, 0x23, 0x31, 0x27,
-    0x50, 0x06, 0x13, 0x13, 0x18, 0x06, 0x12, 0x23, 0x1a, 0x1c, 0x0c, 0x06,
-    0x12, 0x12, 0x0c, 0x0b, 0x05, 0x15, 0x07, 0x15, 0x06, 0x13, 0x06, 0x0b,
-    0x0c, 0x14, 0x03, 0x01, 0x0c, 0x0c, 0x06, 0x04, 0x05, 0x04, 0x01, 0x04,
-    0x01, 0x0c, 0x10, 0x06, 0x01, 0x09, 0x33, 0x18, 0x05, 0x12, 0x07, 0x07,
-    0x10, 0x03, 0x07, 0x07, 0x07, 0x07, 0x04, 0x05, 0x0d, 0x07, 0x40, 0x07,
-    0x01, 0x09, 0x22, 0x2e, 0x40, 0x52, 0x28, 0x60, 0x60, 0x52, 0x2f, 0x60,
-    0x60, 0x40, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 0x0c, 0x09, 0x20, 0x33,
-    0x12, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x14, 0x53, 0x0c, 0x0c,
-    0x31, 0x04, 0x02, 0x01, 0x06, 0x87, 0x42, 0x67, 0x67, 0x82, 0x82, 0x54,
-    0x20, 0x3d, 0x15, 0x05, 0x01, 0x01, 0x05, 0x02, 0x05, 0x02, 0x01, 0x1f,
-    0x64, 0x49, 0x1f, 0x06, 0x01, 0x07, 0x54, 0x23, 0x1f, 0x49, 0x27, 0x4b,
-    0x27, 0x0b, 0x04, 0x1f, 0x9b, 0x5e, 0x8a, 0x4b, 0x3e, 0x27, 0x1f, 0x3d,
-    0x75, 0x5c, 0x49, 0x4b, 0xb0, 0x55, 0x3e, 0x5e, 0x71, 0x59, 0x7a, 0x8c,
-    0x83, 0x3e, 0x9e, 0x9b, 0x6c, 0x3e, 0x4e, 0x6a, 0x75, 0x83, 0x51, 0x6a,
-    0x8c, 0x59, 0x61, 0xa5, 0x8c, 0xa8, 0xbd, 0xa9, 0x71, 0x8c, 0xa9, 0x75,
-    0xb5, 0xa8, 0xba, 0xb4, 0xc2, 0xa8, 0xa8, 0xc2, 0xc2, 0xba, 0xb5, 0xb9,
-    0xba, 0xbf, 0xaf, 0xbf, 0xb9, 0xbd, 0x80, 0xa8, 0xaf, 0xaf, 0x80, 0x6a,
-    0x3b, 0x59, 0x51, 0x89, 0x4e, 0x4e, 0x59, 0x65, 0x61, 0x65, 0x80, 0x51,
-    0x36, 0x4b, 0x2c, 0x25, 0x26, 0x26, 0x36, 0xb1, 0xc2, 0xc2, 0xc3, 0xc3,
-    0xc3, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9,
-    0xbd, 0xbd, 0xbd, 0xb4, 0xb4, 0xb4, 0xbd, 0xb4, 0x95, 0x61, 0x80, 0x90,
-    0x80, 0xaf, 0x54, 0x75, 0x7a, 0x51, 0x47, 0x27, 0x4b, 0x30, 0x59, 0x23,
-    0x4b, 0x7a, 0x9e, 0x61, 0x61, 0x8c, 0x90, 0x71, 0x6c, 0x43, 0x36, 0x8a,
-    0x47, 0x61, 0x1a, 0x1a, 0x0f, 0x51, 0x54, 0x3e, 0x36, 0x26, 0x23, 0x6a,
-    0x9e, 0x3d, 0x47, 0x3e, 0x49, 0x2d, 0x59, 0x4e, 0x75, 0xad, 0x75, 0x68,
-    0x68, 0x78, 0xa4, 0x78, 0x7a, 0x68, 0x3d, 0x3b, 0x61, 0x49, 0x2d, 0x54,
-    0x4e, 0x49, 0x3d, 0x1d, 0x11, 0x0b, 0x27, 0x23, 0x23, 0x3d, 0x0c, 0x0c,
-    0x1a, 0x0c, 0x27, 0x25, 0x0c, 0x0c, 0x07, 0x06, 0x0c, 0x06, 0x0b, 0x04,
-    0x04, 0x20, 0x15, 0x13, 0x0c, 0x06, 0x0c, 0x0c, 0x06, 0x09, 0x07, 0x0c,
-    0x07, 0x07, 0x10, 0x04, 0x03, 0x06, 0x03, 0x03, 0x01, 0x04, 0x06, 0x07,
-    0x04, 0x07, 0x14, 0x10, 0x01, 0x10, 0x0c, 0x04, 0x09, 0x01, 0x20, 0x22,
-    0x07, 0x06, 0x03, 0x04, 0x04, 0x0d, 0x22, 0x06, 0x01, 0x07, 0x2e, 0x2f,
-    0x52, 0x40, 0x60, 0x40, 0x60, 0x52, 0x2f, 0x52, 0x60, 0x40, 0x01, 0x01,
-    0x03, 0x01, 0x02, 0x01, 0x1e, 0x1e, 0x0a, 0x20, 0x0a, 0x01, 0x02, 0x01,
-    0x01, 0x01, 0x01, 0x02, 0x07, 0x0f, 0x15, 0x1b, 0x07, 0x02, 0x01, 0x02,
-    0x0c, 0x87, 0x73, 0x50, 0x53, 0x7b, 0x67, 0x5b, 0x31, 0x64, 0x2a, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x0b, 0x1b, 0x07, 0x03, 0x05,
-    0x23, 0x8c, 0x4e, 0x23, 0x03, 0x05, 0x06, 0x05, 0x05, 0x08, 0x05, 0x03,
-    0x83, 0x75, 0x47, 0x1f, 0x06, 0x27, 0x4b, 0x61, 0x9b, 0x7a, 0x7e, 0x59,
-    0x59, 0x5e, 0x71, 0x83, 0x7a, 0x94, 0xaf, 0x7a, 0x89, 0x47, 0x9b, 0x8c,
-    0x94, 0x59, 0x7a, 0x77, 0x94, 0x9c, 0x71, 0x6a, 0x47, 0x36, 0x7e, 0x59,
-    0xb0, 0xaf, 0x9a, 0x7a, 0x98, 0xb4, 0xb5, 0x71, 0xa8, 0x9c, 0xbd, 0xb5,
-    0xc2, 0xb5, 0xaf, 0xba, 0xc2, 0xc2, 0xbf, 0xa8, 0xa8, 0xaf, 0xaf, 0xbf,
-    0xb9, 0xbd, 0xaf, 0x89, 0x9a, 0x9e, 0x71, 0x59, 0x59, 0x75, 0x65, 0x7a,
-    0x89, 0x78, 0x9e, 0x75, 0x65, 0x47, 0x61, 0x51, 0x47, 0x47, 0x47, 0x1f,
-    0x1f, 0x1f, 0x36, 0x61, 0x85, 0xc2, 0xc2, 0xb9, 0xc2, 0xc4, 0xb9, 0xb9,
-    0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xbd, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xaf, 0xaf, 0xb4, 0x51, 0x26, 0xaf, 0x9e, 0x90,
-    0x75, 0x36, 0x1a, 0x1f, 0x3e, 0x27, 0x59, 0xa1, 0x43, 0xa1, 0x6a, 0x59,
-    0x59, 0x59, 0x49, 0x4e, 0x61, 0x68, 0x36, 0x6f, 0x83, 0x36, 0x34, 0x23,
-    0x4e, 0x26, 0x61, 0x1f, 0x3e, 0x27, 0x3e, 0x6f, 0x8f, 0x43, 0x3e, 0x2d,
-    0x43, 0x3e, 0x49, 0x6f, 0x75, 0x6f, 0x59, 0x43, 0x75, 0x75, 0x8f, 0x8a,
-    0x7a, 0x27, 0x54, 0x3d, 0x64, 0x49, 0x27, 0x4e, 0x31, 0x68, 0x3d, 0x0f,
-    0x0b, 0x06, 0x18, 0x2d, 0x23, 0x13, 0x0c, 0x1a, 0x31, 0x18, 0x29, 0x13,
-    0x15, 0x0e, 0x0b, 0x0b, 0x07, 0x15, 0x0b, 0x12, 0x23, 0x20, 0x10, 0x07,
-    0x20, 0x06, 0x04, 0x0b, 0x07, 0x1c, 0x07, 0x0c, 0x0c, 0x07, 0x0c, 0x04,
-    0x06, 0x04, 0x04, 0x01, 0x04, 0x04, 0x0c, 0x0c, 0x04, 0x06, 0x07, 0x05,
-    0x1b, 0x10, 0x06, 0x02, 0x01, 0x0c, 0x22, 0x22, 0x0c, 0x04, 0x06, 0x04,
-    0x06, 0x17, 0x22, 0x09, 0x01, 0x04, 0x17, 0x28, 0x3c, 0x40, 0x52, 0x52,
-    0x52, 0x62, 0x40, 0x52, 0x52, 0x52, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x20, 0x1e, 0x10, 0x1e, 0x09, 0x01, 0x00, 0x02, 0x02, 0x01, 0x01, 0x01,
-    0x05, 0x0c, 0x24, 0x29, 0x01, 0x05, 0x01, 0x01, 0x04, 0x7b, 0x53, 0x2a,
-    0x7b, 0x50, 0x13, 0x35, 0x29, 0x7d, 0x15, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x08, 0x0b, 0x31, 0x54, 0x1d, 0x6c, 0x20, 0x05,
-    0x05, 0x06, 0x05, 0x05, 0x08, 0x0b, 0x08, 0x05, 0x03, 0x1b, 0x26, 0x3e,
-    0x12, 0x6a, 0x3d, 0x51, 0x6a, 0x7a, 0x75, 0x6f, 0x83, 0x71, 0x68, 0x75,
-    0x9a, 0x8c, 0x75, 0x83, 0x94, 0x4b, 0x9b, 0x83, 0x9b, 0x59, 0x36, 0x85,
-    0x4b, 0x9a, 0x94, 0x3e, 0x47, 0x77, 0x4e, 0xb5, 0x7a, 0xaf, 0x9c, 0x7e,
-    0xa2, 0xa8, 0x94, 0x77, 0xa8, 0x75, 0xa8, 0xbd, 0xc2, 0xaf, 0xb5, 0xad,
-    0xbd, 0xbd, 0xad, 0x9e, 0xb5, 0xb5, 0xb9, 0xb9, 0xba, 0x9e, 0xaf, 0x89,
-    0x80, 0x80, 0x71, 0x80, 0x59, 0x80, 0x59, 0x2d, 0x83, 0x95, 0x89, 0x47,
-    0x49, 0x59, 0x47, 0x2d, 0x30, 0x4b, 0x36, 0x47, 0x27, 0x1f, 0x23, 0x6a,
-    0x77, 0xaf, 0xaf, 0xba, 0xbf, 0xb9, 0xc2, 0xbd, 0xbd, 0xbd, 0xb9, 0xbd,
-    0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xaf, 0x8a, 0x3b, 0x23, 0x89, 0xb4, 0x95, 0x7a, 0x1a, 0x18, 0x2c,
-    0x16, 0x69, 0x9e, 0x3d, 0x8c, 0x75, 0x4e, 0x59, 0x71, 0x61, 0x95, 0x7a,
-    0x59, 0x7a, 0x68, 0x51, 0x5e, 0x61, 0x47, 0x47, 0x68, 0x27, 0x36, 0x1d,
-    0x47, 0x3e, 0x51, 0x36, 0x71, 0x30, 0x3e, 0x3e, 0x71, 0x2d, 0x27, 0x1d,
-    0x1d, 0x2d, 0x3b, 0x75, 0x83, 0x5e, 0x75, 0x8a, 0x54, 0x54, 0x4e, 0x61,
-    0x64, 0x1d, 0x49, 0x3d, 0x2d, 0x68, 0x27, 0x13, 0x0b, 0x0b, 0x10, 0x1f,
-    0x1a, 0x1b, 0x05, 0x0f, 0x0f, 0x23, 0x31, 0x25, 0x13, 0x07, 0x13, 0x25,
-    0x0b, 0x07, 0x0c, 0x12, 0x12, 0x14, 0x25, 0x06, 0x0c, 0x31, 0x06, 0x05,
-    0x05, 0x01, 0x0c, 0x14, 0x0c, 0x0c, 0x10, 0x03, 0x12, 0x06, 0x07, 0x03,
-    0x05, 0x06, 0x04, 0x04, 0x01, 0x06, 0x04, 0x07, 0x07, 0x0b, 0x04, 0x06,
-    0x07, 0x06, 0x17, 0x10, 0x09, 0x10, 0x10, 0x09, 0x04, 0x10, 0x04, 0x04,
-    0x01, 0x04, 0x17, 0x0d, 0x2f, 0x52, 0x60, 0x60, 0x52, 0x2f, 0x52, 0x60,
-    0x40, 0x52, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x0c, 0x22, 0x1e, 0x06,
-    0x0c, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x06, 0x33, 0x3f, 0x10,
-    0x03, 0x07, 0x02, 0x00, 0x20, 0x3f, 0x3d, 0x1b, 0x2a, 0x42, 0x31, 0x67,
-    0x23, 0x1b, 0x04, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01,
-    0x38, 0x3d, 0x31, 0x1c, 0x06, 0x06, 0x05, 0x05, 0x06, 0x06, 0x1c, 0x1a,
-    0x49, 0x31, 0x1f, 0x01, 0x05, 0x05, 0x0b, 0x0b, 0x06, 0x06, 0x27, 0x1f,
-    0x7e, 0x8f, 0x7a, 0x8a, 0x71, 0x9e, 0x7e, 0x71, 0x8c, 0x9b, 0x89, 0xaf,
-    0xa8, 0x4b, 0x89, 0x90, 0xb0, 0xab, 0x2d, 0x4b, 0x8c, 0x9c, 0x77, 0x1b,
-    0x34, 0x9b, 0xa2, 0xb5, 0xbf, 0x85, 0x4b, 0x7a, 0xbf, 0x9e, 0x90, 0x9c,
-    0x9a, 0x9b, 0xb5, 0xb4, 0xb5, 0xaf, 0xb5, 0xb5, 0xa8, 0xaf, 0xaf, 0xbd,
-    0xba, 0xb9, 0xb9, 0xbd, 0xa8, 0xaf, 0xa8, 0x80, 0xb5, 0x5c, 0x3e, 0x6a,
-    0x7e, 0x30, 0x51, 0x61, 0xaf, 0xb9, 0x4e, 0x47, 0x83, 0x75, 0x3b, 0x30,
-    0x47, 0x3b, 0x5c, 0x3b, 0x2c, 0x26, 0x2c, 0x9a, 0xb5, 0x8c, 0x51, 0x7a,
-    0xa1, 0xb9, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xb9, 0xbd, 0xb9, 0xb9,
-    0xb9, 0xb4, 0xb9, 0xb9, 0xb4, 0xb4, 0xb4, 0xb4, 0x95, 0x47, 0x13, 0x94,
-    0xa8, 0x89, 0x90, 0x75, 0x6a, 0x3e, 0x4e, 0x61, 0x13, 0x6a, 0x83, 0x36,
-    0x59, 0x36, 0x75, 0x77, 0x43, 0x26, 0x71, 0x7a, 0x64, 0x4e, 0x83, 0x36,
-    0x51, 0x51, 0x47, 0x3d, 0x59, 0x1f, 0x27, 0x2c, 0x27, 0x27, 0x23, 0x43,
-    0x83, 0x61, 0x27, 0x36, 0x2d, 0x3e, 0x59, 0x26, 0x20, 0x6f, 0x75, 0x64,
-    0x59, 0x68, 0x8a, 0xa4, 0x6f, 0x31, 0x7a, 0x68, 0x81, 0x61, 0x50, 0x59,
-    0x23, 0x1d, 0x1f, 0x26, 0x23, 0x0c, 0x06, 0x15, 0x0c, 0x0b, 0x0c, 0x07,
-    0x1a, 0x23, 0x31, 0x13, 0x15, 0x0c, 0x25, 0x1d, 0x15, 0x06, 0x12, 0x0c,
-    0x06, 0x06, 0x07, 0x20, 0x14, 0x14, 0x04, 0x04, 0x03, 0x01, 0x01, 0x05,
-    0x12, 0x24, 0x42, 0x14, 0x05, 0x06, 0x0b, 0x07, 0x07, 0x04, 0x03, 0x01,
-    0x01, 0x07, 0x14, 0x10, 0x17, 0x07, 0x09, 0x07, 0x10, 0x07, 0x0f, 0x19,
-    0x07, 0x14, 0x09, 0x22, 0x01, 0x02, 0x05, 0x09, 0x01, 0x04, 0x17, 0x17,
-    0x10, 0x2f, 0x3c, 0x40, 0x52, 0x22, 0x52, 0x52, 0x3c, 0x3c, 0x01, 0x02,
-    0x01, 0x01, 0x03, 0x01, 0x07, 0x3a, 0x1e, 0x0c, 0x07, 0x01, 0x01, 0x02,
-    0x02, 0x02, 0x02, 0x01, 0x0c, 0x53, 0x29, 0x01, 0x24, 0x33, 0x02, 0x01,
-    0x20, 0x20, 0x20, 0x5b, 0x7b, 0x70, 0x73, 0x7b, 0x67, 0x15, 0x01, 0x01,
-    0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x04, 0x06, 0x06, 0x05,
-    0x03, 0x05, 0x03, 0x0b, 0x1d, 0x3d, 0x83, 0x54, 0x83, 0x59, 0x54, 0x12,
-    0x05, 0x05, 0x03, 0x03, 0x08, 0x08, 0x04, 0x15, 0x61, 0x71, 0x7a, 0x6a,
-    0x7a, 0x83, 0x8f, 0x83, 0x61, 0x61, 0xab, 0xb0, 0x9e, 0x3e, 0xb5, 0x90,
-    0x8c, 0x9e, 0x69, 0x2c, 0x8c, 0x9a, 0x83, 0x36, 0x51, 0x9e, 0x94, 0xaf,
-    0x94, 0x61, 0x8c, 0x61, 0x89, 0x90, 0xab, 0x9a, 0xb5, 0x9a, 0xaf, 0xbd,
-    0xbd, 0xaf, 0xb4, 0x94, 0x90, 0xaf, 0xb5, 0x94, 0x9a, 0xbd, 0xb5, 0xaf,
-    0xb5, 0xaf, 0x7a, 0x80, 0x95, 0x61, 0x71, 0x43, 0x59, 0x2d, 0x3b, 0x6f,
-    0x75, 0x83, 0x47, 0x71, 0x80, 0x95, 0x71, 0x47, 0x43, 0x47, 0x59, 0x30,
-    0x47, 0x1f, 0x26, 0x7e, 0x75, 0x47, 0x36, 0x8d, 0xba, 0xbf, 0xbd, 0xbf,
-    0xbf, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xb4, 0xb4, 0xb4, 0xb9, 0xb9,
-    0xb4, 0xb9, 0xb4, 0xb4, 0x95, 0x90, 0x68, 0xb4, 0xad, 0x75, 0x6f, 0x7a,
-    0x47, 0x26, 0x65, 0x59, 0x47, 0x6a, 0x90, 0x61, 0x6a, 0x2d, 0x6a, 0x59,
-    0x3e, 0x49, 0x4e, 0x6f, 0x6a, 0x61, 0x6a, 0x3e, 0x4e, 0x31, 0x2d, 0x47,
-    0x2d, 0x47, 0x23, 0x26, 0x36, 0x4e, 0x36, 0x47, 0x3e, 0x6f, 0x1f, 0x16,
-    0x47, 0x3d, 0x5e, 0x3e, 0x54, 0x59, 0x6f, 0x68, 0x54, 0x59, 0x49, 0x8a,
-    0x6f, 0x54, 0x8f, 0x96, 0x6f, 0x31, 0x31, 0x50, 0x2d, 0x15, 0x13, 0x23,
-    0x3d, 0x23, 0x0f, 0x49, 0x1d, 0x0e, 0x06, 0x13, 0x15, 0x0b, 0x1a, 0x13,
-    0x07, 0x13, 0x07, 0x0f, 0x0c, 0x06, 0x13, 0x07, 0x12, 0x0b, 0x06, 0x20,
-    0x3d, 0x1b, 0x07, 0x07, 0x06, 0x03, 0x01, 0x0b, 0x06, 0x10, 0x17, 0x14,
-    0x10, 0x04, 0x06, 0x06, 0x04, 0x04, 0x04, 0x04, 0x06, 0x04, 0x07, 0x10,
-    0x07, 0x06, 0x10, 0x06, 0x04, 0x07, 0x28, 0x10, 0x07, 0x04, 0x09, 0x14,
-    0x01, 0x02, 0x10, 0x17, 0x01, 0x03, 0x10, 0x28, 0x17, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x2e, 0x2f, 0x2e, 0x2e, 0x01, 0x02, 0x01, 0x01, 0x05, 0x01,
-    0x07, 0x46, 0x3a, 0x14, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02,
-    0x0c, 0x4f, 0x0c, 0x1b, 0x70, 0x35, 0x02, 0x01, 0x0c, 0x3f, 0x5b, 0x63,
-    0x67, 0x7b, 0x67, 0x7b, 0x67, 0x03, 0x01, 0x01, 0x02, 0x01, 0x02, 0x05,
-    0x01, 0x01, 0x05, 0x05, 0x01, 0x03, 0x01, 0x01, 0x01, 0x0f, 0x23, 0x49,
-    0x49, 0x8f, 0x81, 0x6f, 0x4e, 0x76, 0x5e, 0x61, 0x1f, 0x2d, 0x2d, 0x4b,
-    0x23, 0x1c, 0x0b, 0x06, 0x2d, 0x59, 0x6a, 0x8c, 0x83, 0x9b, 0xa1, 0x9e,
-    0x8f, 0x71, 0x7a, 0x75, 0xa8, 0x4b, 0x9e, 0xaf, 0xaf, 0x8c, 0x77, 0x61,
-    0x51, 0x71, 0x51, 0x1c, 0x5e, 0x8d, 0x94, 0x61, 0x47, 0x77, 0xa8, 0xa2,
-    0x94, 0x7a, 0x9a, 0x9c, 0xb5, 0xa8, 0xbd, 0xba, 0xaf, 0x95, 0x9e, 0x94,
-    0xb5, 0xaf, 0x9e, 0x77, 0x61, 0xad, 0xaf, 0xb5, 0xb4, 0xb4, 0x80, 0x7a,
-    0x80, 0x83, 0x59, 0x54, 0x7a, 0x71, 0x43, 0x7a, 0x6f, 0x3b, 0x61, 0x83,
-    0x90, 0xb5, 0x9b, 0x71, 0x59, 0x36, 0x61, 0x51, 0x54, 0x30, 0x2c, 0x1f,
-    0x5c, 0x30, 0x3e, 0x4e, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xba,
-    0xba, 0xba, 0xba, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xad, 0xb4, 0xb4, 0xb9,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0x95, 0x6f, 0x59, 0x3b, 0x26, 0x4e, 0x83,
-    0x83, 0x75, 0x95, 0x6f, 0x7a, 0x49, 0x71, 0x54, 0x51, 0x4b, 0x59, 0x6a,
-    0x83, 0x75, 0x36, 0x47, 0x36, 0x3e, 0x23, 0x23, 0x36, 0x61, 0x36, 0x23,
-    0x3d, 0x30, 0x23, 0x2c, 0x27, 0x61, 0x2d, 0x1a, 0x3e, 0x27, 0x4e, 0x30,
-    0x23, 0x27, 0x49, 0x3d, 0x54, 0x2d, 0x36, 0x4e, 0x68, 0x59, 0x8f, 0xa4,
-    0x64, 0x49, 0x54, 0x3d, 0x23, 0x23, 0x23, 0x13, 0x49, 0x23, 0x15, 0x3d,
-    0x54, 0x20, 0x0c, 0x1d, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0c,
-    0x05, 0x04, 0x1a, 0x0b, 0x14, 0x14, 0x1b, 0x0c, 0x0c, 0x12, 0x0c, 0x06,
-    0x04, 0x04, 0x04, 0x04, 0x05, 0x12, 0x0c, 0x14, 0x10, 0x0c, 0x04, 0x03,
-    0x04, 0x05, 0x05, 0x06, 0x07, 0x04, 0x01, 0x07, 0x07, 0x0b, 0x07, 0x06,
-    0x07, 0x07, 0x09, 0x1e, 0x07, 0x04, 0x10, 0x07, 0x04, 0x01, 0x0d, 0x17,
-    0x01, 0x01, 0x17, 0x2e, 0x3c, 0x17, 0x1e, 0x17, 0x17, 0x22, 0x2e, 0x22,
-    0x3c, 0x4d, 0x04, 0x01, 0x01, 0x01, 0x03, 0x01, 0x07, 0x58, 0x4f, 0x1e,
-    0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x06, 0x20, 0x01, 0x4f,
-    0x70, 0x1b, 0x01, 0x01, 0x2a, 0x70, 0x3f, 0x7b, 0x7b, 0x82, 0x67, 0x93,
-    0x33, 0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x03, 0x01, 0x0b, 0x05,
-    0x03, 0x05, 0x05, 0x1a, 0x27, 0x3d, 0x75, 0x64, 0x6f, 0x8a, 0x6f, 0x64,
-    0x5e, 0x54, 0x2d, 0x71, 0x3d, 0x61, 0x8f, 0xa4, 0x7a, 0x3d, 0x1a, 0x05,
-    0x0b, 0x69, 0x61, 0x9b, 0xa1, 0xb4, 0x9e, 0x9e, 0x9b, 0x83, 0x76, 0x83,
-    0x8c, 0x2d, 0xa8, 0x9e, 0xba, 0x94, 0x9e, 0x7a, 0x83, 0x54, 0x26, 0x1f,
-    0x6a, 0x89, 0x8c, 0x6a, 0x9a, 0x7e, 0x61, 0x8c, 0xa8, 0x9a, 0x89, 0x77,
-    0xa8, 0xb4, 0xb5, 0x9e, 0x9e, 0x9e, 0xad, 0x95, 0xbd, 0xaf, 0x9a, 0x7a,
-    0x6a, 0xaf, 0xb9, 0xb4, 0xb4, 0xb4, 0x95, 0x90, 0x83, 0x6a, 0x61, 0x61,
-    0x9e, 0x9e, 0x51, 0x83, 0x7a, 0x75, 0x95, 0x75, 0xb5, 0xa3, 0x9e, 0x6a,
-    0x75, 0x47, 0x47, 0x6f, 0x51, 0x77, 0x27, 0x26, 0x2c, 0x7e, 0x9a, 0xa9,
-    0xc4, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba,
-    0xba, 0xb4, 0xb5, 0xb5, 0xad, 0xaf, 0xb4, 0xaf, 0x9e, 0xb4, 0xb4, 0xb4,
-    0xb4, 0x95, 0x75, 0x1f, 0x77, 0x61, 0x6a, 0x95, 0x7a, 0x80, 0x83, 0x7a,
-    0x83, 0x61, 0x61, 0x3e, 0x59, 0x3e, 0x51, 0x61, 0x75, 0x75, 0x47, 0x61,
-    0x3e, 0x4e, 0x1d, 0x30, 0x3e, 0x54, 0x4b, 0x2d, 0x2d, 0x4e, 0x47, 0x51,
-    0x5e, 0x3e, 0x27, 0x27, 0x3d, 0x3e, 0x4e, 0x3e, 0x1f, 0x1a, 0x36, 0x54,
-    0x75, 0x49, 0x2d, 0x4e, 0x54, 0x36, 0x5b, 0x75, 0x23, 0x36, 0x49, 0x27,
-    0x31, 0x49, 0x1d, 0x15, 0x59, 0x23, 0x14, 0x3e, 0x54, 0x31, 0x18, 0x1d,
-    0x1d, 0x0b, 0x0c, 0x0c, 0x0c, 0x06, 0x0b, 0x0b, 0x05, 0x06, 0x1b, 0x0c,
-    0x0b, 0x15, 0x1e, 0x15, 0x04, 0x04, 0x06, 0x05, 0x05, 0x04, 0x04, 0x0c,
-    0x02, 0x09, 0x04, 0x04, 0x0c, 0x0c, 0x04, 0x04, 0x05, 0x03, 0x06, 0x07,
-    0x07, 0x04, 0x01, 0x06, 0x0b, 0x04, 0x06, 0x07, 0x07, 0x04, 0x10, 0x1e,
-    0x10, 0x07, 0x04, 0x03, 0x04, 0x10, 0x17, 0x22, 0x01, 0x01, 0x28, 0x40,
-    0x3c, 0x17, 0x2e, 0x28, 0x22, 0x2e, 0x2e, 0x2e, 0x52, 0x40, 0x04, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x04, 0x33, 0x2e, 0x22, 0x02, 0x02, 0x02, 0x01,
-    0x02, 0x02, 0x02, 0x02, 0x06, 0x07, 0x04, 0x24, 0x2a, 0x07, 0x01, 0x00,
-    0x5a, 0x63, 0x70, 0x67, 0x73, 0x82, 0x82, 0x87, 0x14, 0x02, 0x00, 0x01,
-    0x02, 0x01, 0x01, 0x02, 0x01, 0x05, 0x31, 0x05, 0x05, 0x01, 0x0c, 0x54,
-    0x31, 0x69, 0x64, 0x6f, 0x78, 0x96, 0x75, 0x6c, 0x3d, 0x5e, 0x4b, 0x4b,
-    0x6a, 0x5e, 0x9b, 0xae, 0x9b, 0x54, 0x4b, 0x0b, 0x03, 0x3e, 0x71, 0xb4,
-    0xad, 0xbd, 0xa8, 0xb4, 0x6f, 0x83, 0xad, 0xae, 0xa8, 0x2d, 0xab, 0xa1,
-    0xa8, 0x9b, 0xbd, 0x9c, 0xa8, 0x77, 0x4b, 0x26, 0x51, 0x61, 0x3b, 0x8a,
-    0xa8, 0x9e, 0xaf, 0x9c, 0x71, 0xaf, 0x90, 0x94, 0x83, 0x83, 0x9b, 0x89,
-    0x95, 0x9e, 0xbd, 0xb4, 0xb4, 0xa1, 0x6a, 0x5e, 0x5c, 0x9e, 0xb4, 0xbd,
-    0xbd, 0xb4, 0xb5, 0x95, 0x71, 0x4e, 0x8f, 0x9e, 0xb9, 0x8f, 0x47, 0x6f,
-    0x7a, 0x7a, 0x90, 0x95, 0xaf, 0x9e, 0x80, 0x7a, 0x89, 0x59, 0x51, 0x4e,
-    0x51, 0x51, 0x2c, 0x1a, 0x2c, 0x85, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4,
-    0xbf, 0xbf, 0xbf, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb5, 0xba, 0xb5,
-    0xb5, 0xa8, 0xb4, 0xa8, 0x83, 0xb4, 0xad, 0xb4, 0xad, 0x95, 0xad, 0x2c,
-    0x6a, 0x61, 0x75, 0x8c, 0x61, 0x77, 0x4e, 0x7e, 0x8a, 0x4e, 0x59, 0x34,
-    0x64, 0x51, 0x3e, 0x6a, 0x4e, 0x47, 0x36, 0x71, 0x54, 0x5e, 0x2d, 0x4b,
-    0x43, 0x23, 0x3e, 0x1f, 0x2d, 0x47, 0x43, 0x36, 0x61, 0x59, 0x26, 0x36,
-    0x64, 0x61, 0x4e, 0x1d, 0x13, 0x1f, 0x54, 0x68, 0x7a, 0x64, 0x6f, 0x78,
-    0x54, 0x1d, 0x6c, 0x8a, 0x1d, 0x2d, 0x31, 0x3d, 0x50, 0x6c, 0x18, 0x1d,
-    0x2d, 0x23, 0x12, 0x11, 0x12, 0x1b, 0x1a, 0x15, 0x0c, 0x07, 0x07, 0x06,
-    0x15, 0x1b, 0x12, 0x06, 0x15, 0x0c, 0x2a, 0x12, 0x04, 0x0c, 0x0c, 0x07,
-    0x06, 0x05, 0x06, 0x04, 0x04, 0x04, 0x06, 0x07, 0x04, 0x01, 0x03, 0x04,
-    0x06, 0x04, 0x04, 0x04, 0x05, 0x03, 0x07, 0x0c, 0x07, 0x04, 0x03, 0x04,
-    0x04, 0x04, 0x06, 0x06, 0x10, 0x04, 0x07, 0x10, 0x07, 0x0a, 0x01, 0x02,
-    0x04, 0x10, 0x22, 0x22, 0x01, 0x01, 0x22, 0x52, 0x2e, 0x22, 0x3a, 0x2f,
-    0x2e, 0x40, 0x40, 0x3c, 0x52, 0x52, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x04, 0x33, 0x4d, 0x3a, 0x01, 0x02, 0x02, 0x02, 0x00, 0x01, 0x02, 0x02,
-    0x06, 0x04, 0x06, 0x0c, 0x1b, 0x20, 0x02, 0x02, 0x5a, 0x5a, 0x82, 0x42,
-    0x67, 0x82, 0x82, 0x42, 0x01, 0x02, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x03, 0x3d, 0x0b, 0x05, 0x01, 0x03, 0x73, 0x64, 0x2d, 0x31, 0x94,
-    0x64, 0x81, 0x9b, 0x6c, 0x36, 0x5e, 0x59, 0x36, 0x68, 0x9b, 0x68, 0x8c,
-    0x6f, 0x76, 0x77, 0x47, 0x03, 0x0e, 0x6c, 0xb0, 0xae, 0xa8, 0xb4, 0xab,
-    0x83, 0x8f, 0xb5, 0xa8, 0xa8, 0x5e, 0x8c, 0xa1, 0xab, 0x9b, 0xbd, 0x9e,
-    0x75, 0x8c, 0x54, 0x36, 0x2c, 0x1f, 0x51, 0x64, 0x83, 0xb5, 0xc7, 0xaf,
-    0x8c, 0xa8, 0x90, 0x9a, 0x90, 0x83, 0x8f, 0x8c, 0x8c, 0x95, 0xb4, 0xb4,
-    0xa8, 0xa8, 0x61, 0x4e, 0x2d, 0x83, 0xbd, 0xbd, 0xb9, 0xaf, 0x95, 0xa3,
-    0xa8, 0x3b, 0x59, 0xa8, 0xb4, 0x95, 0x89, 0x5e, 0x59, 0x43, 0x59, 0x75,
-    0x68, 0x75, 0x75, 0x8a, 0x68, 0x6f, 0x51, 0x2c, 0x51, 0x3b, 0x1f, 0x65,
-    0x6a, 0x7e, 0xa2, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xba, 0xba, 0xba, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0x9e, 0xb4, 0xb5,
-    0x95, 0xa8, 0x80, 0xad, 0x9e, 0x75, 0xaf, 0x75, 0x71, 0x59, 0x8c, 0x3e,
-    0x3e, 0x8c, 0x83, 0x59, 0x9b, 0x6a, 0x61, 0x36, 0x3d, 0x54, 0x30, 0x59,
-    0x5e, 0x61, 0x49, 0x71, 0x3d, 0x61, 0x4b, 0x3e, 0x43, 0x26, 0x2d, 0x36,
-    0x1d, 0x2c, 0x1c, 0x36, 0x43, 0x4e, 0x2d, 0x26, 0x3e, 0x36, 0x27, 0x4e,
-    0x78, 0x64, 0x2d, 0x6f, 0x75, 0x59, 0x5e, 0xa3, 0x59, 0x49, 0x78, 0x9b,
-    0x27, 0x23, 0x23, 0x3d, 0x35, 0x54, 0x27, 0x23, 0x27, 0x23, 0x0c, 0x08,
-    0x07, 0x1a, 0x12, 0x05, 0x06, 0x15, 0x1c, 0x04, 0x14, 0x3d, 0x23, 0x0c,
-    0x15, 0x0b, 0x07, 0x0c, 0x03, 0x06, 0x0b, 0x04, 0x04, 0x10, 0x0c, 0x0b,
-    0x0b, 0x04, 0x04, 0x04, 0x07, 0x03, 0x01, 0x04, 0x05, 0x04, 0x14, 0x01,
-    0x04, 0x04, 0x04, 0x0c, 0x04, 0x04, 0x01, 0x05, 0x04, 0x06, 0x07, 0x04,
-    0x10, 0x0c, 0x06, 0x04, 0x04, 0x07, 0x05, 0x01, 0x01, 0x22, 0x2f, 0x17,
-    0x01, 0x01, 0x2e, 0x2f, 0x52, 0x2f, 0x2f, 0x2f, 0x2f, 0x52, 0x52, 0x52,
-    0x52, 0x62, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3a, 0x3f, 0x14,
-    0x02, 0x01, 0x01, 0x02, 0x00, 0x00, 0x01, 0x01, 0x03, 0x01, 0x12, 0x2a,
-    0x1e, 0x07, 0x01, 0x02, 0x3f, 0x66, 0x93, 0x66, 0x7b, 0x87, 0x7b, 0x04,
-    0x02, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x05, 0x54, 0x06,
-    0x05, 0x01, 0x01, 0x49, 0x7d, 0x75, 0x1c, 0x13, 0x07, 0x0f, 0x18, 0x54,
-    0x3d, 0x7a, 0x54, 0x54, 0x6c, 0xa4, 0xa1, 0x6f, 0x49, 0x7a, 0x27, 0x61,
-    0x06, 0x0b, 0x7a, 0x96, 0xb4, 0x8f, 0xb4, 0x9b, 0x8f, 0x83, 0xa4, 0xad,
-    0x9b, 0x59, 0x31, 0xb0, 0xb4, 0x9e, 0xc2, 0x9b, 0x94, 0xa1, 0x83, 0x8c,
-    0x0e, 0x2c, 0x49, 0x51, 0x83, 0x68, 0x7a, 0x95, 0x7a, 0x83, 0x9e, 0x83,
-    0x9a, 0x9e, 0xb4, 0x9e, 0x9b, 0x75, 0x9e, 0xa2, 0x90, 0x9e, 0x94, 0x77,
-    0x59, 0x7e, 0xb9, 0xbd, 0xb9, 0x9e, 0x95, 0xaf, 0xb4, 0x8a, 0x80, 0x7a,
-    0xad, 0xa3, 0x68, 0x30, 0x61, 0x59, 0x61, 0x68, 0x6f, 0x59, 0x4e, 0x75,
-    0x89, 0x6f, 0x54, 0x2c, 0x51, 0x6a, 0x51, 0x5c, 0x51, 0x8d, 0xa2, 0xc4,
-    0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xbf, 0xbf, 0xbf, 0xbf, 0xba, 0xba,
-    0xba, 0xb5, 0xb5, 0xb5, 0xb5, 0x9e, 0xa8, 0x89, 0x89, 0x89, 0x31, 0xad,
-    0xad, 0x61, 0x80, 0x6f, 0x8f, 0x83, 0x83, 0x61, 0x7a, 0x59, 0x7a, 0x61,
-    0x43, 0x4e, 0x75, 0x83, 0x59, 0x6a, 0x36, 0x3d, 0x75, 0x6a, 0x6a, 0x61,
-    0x36, 0x4e, 0x54, 0x27, 0x61, 0x75, 0x4e, 0x23, 0x2d, 0x23, 0x36, 0x3d,
-    0x2d, 0x26, 0x3d, 0x36, 0x36, 0x1f, 0x36, 0x75, 0x81, 0x6f, 0x54, 0x83,
-    0x68, 0x6c, 0x49, 0x8a, 0x5b, 0x96, 0x42, 0x50, 0x1c, 0x13, 0x23, 0x3d,
-    0x27, 0x43, 0x2d, 0x20, 0x15, 0x23, 0x1f, 0x0c, 0x20, 0x07, 0x0c, 0x0c,
-    0x27, 0x23, 0x1a, 0x0c, 0x15, 0x42, 0x18, 0x1b, 0x14, 0x0c, 0x05, 0x06,
-    0x0b, 0x06, 0x06, 0x12, 0x12, 0x35, 0x07, 0x0b, 0x0a, 0x03, 0x01, 0x06,
-    0x06, 0x06, 0x07, 0x07, 0x07, 0x05, 0x01, 0x01, 0x04, 0x07, 0x14, 0x24,
-    0x04, 0x04, 0x03, 0x03, 0x07, 0x04, 0x07, 0x01, 0x07, 0x07, 0x04, 0x07,
-    0x07, 0x01, 0x02, 0x01, 0x01, 0x0d, 0x28, 0x0d, 0x01, 0x02, 0x22, 0x3c,
-    0x40, 0x2e, 0x17, 0x3c, 0x28, 0x3c, 0x40, 0x52, 0x3c, 0x4d, 0x09, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x17, 0x14, 0x01, 0x02, 0x00, 0x00,
-    0x02, 0x02, 0x01, 0x01, 0x01, 0x04, 0x5a, 0x53, 0x50, 0x15, 0x01, 0x01,
-    0x2a, 0x7b, 0x93, 0x82, 0x82, 0x7b, 0x1b, 0x01, 0x02, 0x01, 0x00, 0x01,
-    0x02, 0x01, 0x03, 0x01, 0x01, 0x04, 0x92, 0x29, 0x05, 0x05, 0x01, 0x06,
-    0x31, 0x10, 0x0b, 0x1d, 0x5e, 0x86, 0x77, 0x07, 0x7a, 0x6f, 0x6c, 0x1d,
-    0x64, 0x83, 0xa4, 0x9b, 0x75, 0x83, 0x20, 0x51, 0x12, 0x08, 0x75, 0x83,
-    0xb4, 0xa8, 0x8a, 0xa1, 0xab, 0x8f, 0x94, 0x7a, 0x9b, 0xab, 0x1f, 0x71,
-    0x54, 0x59, 0x9b, 0x23, 0x6a, 0x61, 0xa1, 0x2b, 0x36, 0x65, 0x55, 0x5c,
-    0x49, 0xa8, 0xb5, 0xa2, 0xa8, 0x8c, 0xb5, 0x6f, 0x95, 0x9a, 0x9e, 0xb4,
-    0xa8, 0x95, 0x89, 0x89, 0x9e, 0xba, 0x95, 0x77, 0x30, 0x2d, 0x6a, 0x9e,
-    0xa3, 0x7a, 0x4e, 0x9b, 0xb4, 0xb4, 0xa3, 0x4e, 0x80, 0x9e, 0x6a, 0x43,
-    0x4e, 0x61, 0x4e, 0x7a, 0x80, 0x4e, 0x4e, 0x3b, 0x7a, 0x47, 0x71, 0x6a,
-    0x7a, 0x59, 0x77, 0x2c, 0x51, 0x71, 0x65, 0xbf, 0xc4, 0xc4, 0xc4, 0xc6,
-    0xc6, 0xc4, 0xbf, 0xbf, 0xbf, 0xbf, 0xba, 0xba, 0xba, 0xb5, 0xb5, 0xb5,
-    0xaf, 0xb5, 0xaf, 0x83, 0xa8, 0x95, 0x95, 0xad, 0xaf, 0x95, 0xaf, 0xa8,
-    0xb4, 0x95, 0x95, 0x61, 0x8c, 0x89, 0x7a, 0x59, 0x61, 0x77, 0x68, 0x85,
-    0x3d, 0x49, 0x4b, 0x6f, 0x75, 0x83, 0x75, 0x69, 0x54, 0x61, 0x54, 0x3e,
-    0x3e, 0x47, 0x4e, 0x23, 0x3e, 0x26, 0x69, 0x7a, 0x49, 0x2d, 0x4b, 0x49,
-    0x1f, 0x36, 0x27, 0x5e, 0x6c, 0x7a, 0x75, 0x36, 0x47, 0x23, 0x2d, 0x64,
-    0x78, 0x9b, 0x61, 0x3d, 0x2d, 0x23, 0x27, 0x3e, 0x49, 0x18, 0x42, 0x31,
-    0x1b, 0x1f, 0x2d, 0x1b, 0x0b, 0x1f, 0x14, 0x13, 0x31, 0x14, 0x1a, 0x0f,
-    0x1b, 0x2a, 0x1a, 0x0c, 0x1b, 0x1c, 0x04, 0x06, 0x06, 0x06, 0x06, 0x0c,
-    0x06, 0x0c, 0x12, 0x05, 0x01, 0x06, 0x06, 0x04, 0x01, 0x07, 0x0c, 0x04,
-    0x01, 0x01, 0x02, 0x01, 0x01, 0x04, 0x07, 0x0c, 0x04, 0x10, 0x04, 0x04,
-    0x07, 0x10, 0x04, 0x01, 0x03, 0x0b, 0x04, 0x04, 0x01, 0x01, 0x01, 0x07,
-    0x01, 0x04, 0x0d, 0x09, 0x01, 0x02, 0x3a, 0x52, 0x2f, 0x2e, 0x22, 0x3c,
-    0x22, 0x3a, 0x60, 0x60, 0x3c, 0x2e, 0x17, 0x01, 0x03, 0x01, 0x01, 0x01,
-    0x01, 0x2e, 0x1e, 0x1b, 0x01, 0x01, 0x01, 0x00, 0x02, 0x02, 0x01, 0x05,
-    0x03, 0x2a, 0x58, 0x72, 0x67, 0x10, 0x02, 0x01, 0x24, 0x82, 0x93, 0x70,
-    0x7b, 0x4c, 0x04, 0x02, 0x02, 0x01, 0x00, 0x01, 0x01, 0x02, 0x01, 0x01,
-    0x01, 0x05, 0x7b, 0x73, 0x12, 0x03, 0x01, 0x05, 0x06, 0x4b, 0x68, 0x5b,
-    0x5e, 0x6f, 0x9b, 0x6c, 0x13, 0x7a, 0x31, 0x54, 0x54, 0x75, 0x8f, 0x75,
-    0x4e, 0x61, 0x3e, 0x7a, 0x1a, 0x05, 0x5e, 0x8a, 0xa1, 0xa1, 0x83, 0x8a,
-    0xa4, 0x9b, 0x7a, 0x9a, 0xab, 0xaf, 0x1a, 0x83, 0x8c, 0x71, 0x4b, 0x61,
-    0x77, 0x8c, 0x51, 0x4b, 0x83, 0x94, 0x54, 0xa2, 0x83, 0x90, 0xbd, 0xa8,
-    0xba, 0x9a, 0x3b, 0x83, 0xa8, 0x90, 0x8c, 0xa8, 0x8f, 0xa8, 0xad, 0xb4,
-    0x9e, 0x9e, 0x9e, 0x4e, 0x30, 0x6a, 0x6a, 0x75, 0x8f, 0x75, 0x80, 0x6f,
-    0xb4, 0xb4, 0xb4, 0x95, 0x95, 0x81, 0x68, 0x59, 0x3d, 0x43, 0x68, 0x59,
-    0x43, 0x4e, 0x4e, 0x75, 0x36, 0x6f, 0x61, 0x61, 0x6a, 0x5c, 0x51, 0x34,
-    0x3e, 0x74, 0xba, 0xc4, 0xc6, 0xc6, 0xc6, 0xc6, 0xc4, 0xc4, 0xc4, 0xbf,
-    0xbf, 0xbf, 0xba, 0xba, 0xba, 0xb5, 0xb5, 0xb5, 0xba, 0xad, 0xa8, 0xaf,
-    0x89, 0x78, 0xad, 0xaf, 0xad, 0x6f, 0x95, 0xb4, 0xad, 0x83, 0x78, 0x80,
-    0x95, 0xad, 0x95, 0x49, 0x36, 0x59, 0x5e, 0x75, 0x2d, 0x61, 0x7a, 0x61,
-    0x9b, 0x61, 0x3d, 0x61, 0x6a, 0x49, 0x2d, 0x4b, 0x26, 0x1d, 0x30, 0x4e,
-    0x3e, 0x23, 0x2d, 0x3e, 0x3d, 0x2d, 0x2d, 0x2d, 0x76, 0x54, 0x54, 0x54,
-    0x2d, 0x6f, 0x81, 0x61, 0x3d, 0x3e, 0x3e, 0x54, 0x64, 0x31, 0x4e, 0x23,
-    0x2d, 0x27, 0x20, 0x1d, 0x49, 0x2d, 0x31, 0x49, 0x23, 0x20, 0x18, 0x0b,
-    0x0b, 0x13, 0x13, 0x23, 0x29, 0x07, 0x1b, 0x15, 0x07, 0x2d, 0x0c, 0x14,
-    0x42, 0x20, 0x0f, 0x05, 0x04, 0x04, 0x06, 0x04, 0x0c, 0x0f, 0x06, 0x06,
-    0x03, 0x05, 0x07, 0x03, 0x01, 0x01, 0x04, 0x04, 0x03, 0x04, 0x0b, 0x06,
-    0x04, 0x06, 0x03, 0x06, 0x06, 0x1e, 0x04, 0x06, 0x04, 0x04, 0x04, 0x06,
-    0x01, 0x04, 0x07, 0x14, 0x01, 0x01, 0x06, 0x04, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x02, 0x40, 0x52, 0x52, 0x22, 0x2e, 0x2f, 0x40, 0x2f, 0x60, 0x52,
-    0x2f, 0x62, 0x22, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3a, 0x28, 0x28,
-    0x01, 0x02, 0x00, 0x02, 0x02, 0x01, 0x03, 0x04, 0x0c, 0x46, 0x63, 0x70,
-    0x53, 0x1b, 0x02, 0x01, 0x33, 0x82, 0x82, 0x82, 0x50, 0x70, 0x01, 0x02,
-    0x02, 0x01, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x87, 0x9f,
-    0x25, 0x05, 0x02, 0x05, 0x27, 0x1d, 0x5e, 0x5b, 0x3d, 0x64, 0x76, 0x81,
-    0x54, 0x1a, 0x5b, 0x43, 0x5e, 0x75, 0x8c, 0x8f, 0x75, 0x6c, 0x7a, 0x61,
-    0x1d, 0x05, 0x1a, 0xa1, 0x83, 0xae, 0x9b, 0x8f, 0xae, 0xad, 0xae, 0xa1,
-    0xaf, 0xab, 0x27, 0x83, 0x9b, 0x75, 0x30, 0x5e, 0x2d, 0x0e, 0x61, 0xa1,
-    0x8c, 0x6a, 0xa2, 0x61, 0x83, 0x71, 0xb4, 0xaf, 0x9a, 0xbd, 0x6a, 0x90,
-    0x7a, 0x6f, 0x7a, 0xaf, 0xb4, 0xbd, 0xa8, 0x95, 0xbd, 0xb5, 0x83, 0x43,
-    0x4b, 0x71, 0x95, 0x59, 0xa8, 0x95, 0x6a, 0x80, 0xad, 0xad, 0xa3, 0x95,
-    0xa3, 0x9e, 0x75, 0x30, 0x47, 0x4e, 0x43, 0x71, 0x27, 0x4e, 0x61, 0x59,
-    0x61, 0x6f, 0x59, 0x6a, 0x71, 0x34, 0x36, 0x3e, 0x65, 0x65, 0xa5, 0xbb,
-    0xa6, 0xc6, 0xc4, 0xc6, 0xc6, 0xc4, 0xbf, 0xc1, 0xbf, 0xbf, 0xba, 0xba,
-    0xba, 0xba, 0xb5, 0xb5, 0xb5, 0xaf, 0xaf, 0xb4, 0x89, 0x9e, 0xa3, 0xa3,
-    0x9e, 0xa8, 0x9e, 0x9e, 0x90, 0x89, 0x7a, 0x80, 0x9b, 0x95, 0x83, 0x47,
-    0x71, 0x61, 0x59, 0x75, 0x7a, 0x83, 0x6a, 0x47, 0x8c, 0x6a, 0x4b, 0x6a,
-    0x47, 0x69, 0x4e, 0x54, 0x27, 0x30, 0x2d, 0x64, 0x1a, 0x3e, 0x27, 0x23,
-    0x3e, 0x2d, 0x3e, 0x54, 0x30, 0x54, 0x31, 0x83, 0x8a, 0x4e, 0x64, 0x54,
-    0x29, 0x1a, 0x23, 0x27, 0x49, 0x3d, 0x31, 0x3d, 0x23, 0x1d, 0x2d, 0x23,
-    0x2d, 0x2d, 0x0f, 0x1c, 0x18, 0x2d, 0x29, 0x0c, 0x15, 0x1b, 0x1b, 0x1a,
-    0x1b, 0x07, 0x49, 0x0b, 0x06, 0x1b, 0x14, 0x29, 0x3f, 0x23, 0x18, 0x1b,
-    0x04, 0x06, 0x03, 0x0b, 0x04, 0x04, 0x15, 0x10, 0x07, 0x0c, 0x0c, 0x04,
-    0x05, 0x05, 0x04, 0x06, 0x04, 0x04, 0x04, 0x04, 0x0c, 0x07, 0x04, 0x05,
-    0x06, 0x04, 0x04, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0x01,
-    0x01, 0x0c, 0x0d, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x22,
-    0x40, 0x28, 0x22, 0x28, 0x3a, 0x2f, 0x52, 0x40, 0x52, 0x60, 0x22, 0x01,
-    0x03, 0x01, 0x01, 0x01, 0x01, 0x22, 0x33, 0x24, 0x02, 0x01, 0x01, 0x02,
-    0x02, 0x01, 0x01, 0x01, 0x10, 0x4f, 0x62, 0x66, 0x72, 0x1b, 0x02, 0x02,
-    0x35, 0x70, 0x72, 0x7b, 0x58, 0x53, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00,
-    0x01, 0x02, 0x01, 0x01, 0x02, 0x0b, 0x7b, 0x9f, 0x67, 0x05, 0x05, 0x05,
-    0x49, 0x42, 0x1f, 0x49, 0x76, 0x5b, 0x31, 0x8a, 0x81, 0x2d, 0x36, 0x54,
-    0x49, 0x81, 0x76, 0x76, 0x31, 0x71, 0x8f, 0x68, 0x1c, 0x03, 0x1f, 0x3e,
-    0x59, 0xab, 0x8a, 0x8f, 0xaf, 0xa8, 0xa4, 0xae, 0x9e, 0xad, 0x3e, 0x7a,
-    0x8f, 0x5c, 0x12, 0x1a, 0x2c, 0x2d, 0x8f, 0x94, 0x77, 0x3e, 0xb0, 0x61,
-    0x4b, 0x7a, 0x9e, 0xb5, 0xb5, 0x8f, 0xa8, 0x68, 0x71, 0x90, 0xa8, 0x81,
-    0xa8, 0xb4, 0xa8, 0x9e, 0xb4, 0x95, 0x43, 0x47, 0x54, 0x4e, 0x3b, 0x27,
-    0x59, 0x80, 0x43, 0x8a, 0x7a, 0x80, 0x75, 0x9e, 0x9e, 0x5b, 0x71, 0x54,
-    0x3b, 0x71, 0x1f, 0x30, 0x30, 0x36, 0x59, 0x75, 0x4e, 0x61, 0x61, 0x4e,
-    0x7e, 0x55, 0x4b, 0x51, 0x5f, 0x6e, 0x74, 0x55, 0x6e, 0xc1, 0xc6, 0xc6,
-    0xc4, 0xc4, 0xbf, 0xbf, 0xbf, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xa8, 0x9e, 0xaf, 0xad, 0xa3, 0x9e, 0x95, 0x95, 0x68, 0x6a,
-    0x4b, 0x54, 0x83, 0xa4, 0x7a, 0x95, 0xa1, 0x54, 0x3d, 0x95, 0x6a, 0x71,
-    0x75, 0x59, 0x4b, 0x61, 0x8a, 0x61, 0x49, 0x61, 0x36, 0x54, 0x47, 0x31,
-    0x2d, 0x2d, 0x54, 0x3e, 0x2d, 0x2d, 0x1f, 0x23, 0x26, 0x3d, 0x27, 0x1d,
-    0x26, 0x54, 0x3d, 0x54, 0x54, 0x2d, 0x43, 0x31, 0x36, 0x23, 0x2d, 0x54,
-    0x5b, 0x3d, 0x23, 0x1d, 0x59, 0x27, 0x23, 0x2d, 0x27, 0x23, 0x18, 0x1a,
-    0x18, 0x23, 0x23, 0x25, 0x1d, 0x27, 0x15, 0x2a, 0x23, 0x20, 0x15, 0x05,
-    0x06, 0x1b, 0x20, 0x15, 0x0f, 0x1b, 0x2a, 0x1b, 0x0b, 0x04, 0x05, 0x04,
-    0x01, 0x06, 0x07, 0x07, 0x1b, 0x10, 0x0c, 0x04, 0x06, 0x06, 0x0b, 0x07,
-    0x04, 0x04, 0x04, 0x06, 0x07, 0x07, 0x07, 0x04, 0x0a, 0x04, 0x06, 0x05,
-    0x01, 0x04, 0x04, 0x01, 0x02, 0x03, 0x01, 0x01, 0x10, 0x17, 0x33, 0x06,
-    0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x04, 0x07, 0x17, 0x22, 0x0d, 0x28,
-    0x28, 0x2f, 0x2e, 0x60, 0x60, 0x52, 0x2e, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x02, 0x28, 0x22, 0x28, 0x03, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x0a,
-    0x33, 0x17, 0x58, 0x5a, 0x70, 0x24, 0x02, 0x02, 0x31, 0x3f, 0x72, 0x70,
-    0x67, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x15, 0x02, 0x00, 0x02,
-    0x02, 0x03, 0x64, 0x96, 0x81, 0x14, 0x04, 0x03, 0x36, 0x6c, 0x50, 0x23,
-    0x78, 0x8a, 0x5e, 0x5a, 0x49, 0x69, 0x1a, 0x3d, 0x54, 0x75, 0x83, 0x59,
-    0x3d, 0x6f, 0x7a, 0x61, 0x15, 0x05, 0x71, 0x83, 0x1d, 0x7e, 0x9b, 0x9b,
-    0x7a, 0x8f, 0x9b, 0xa1, 0xb4, 0x94, 0x36, 0x4b, 0x59, 0x1a, 0x36, 0x75,
-    0x7a, 0x5e, 0x61, 0x8a, 0x83, 0x6a, 0x77, 0x94, 0x76, 0x59, 0x9a, 0xad,
-    0xaf, 0x8a, 0x6f, 0x8c, 0x4e, 0x95, 0xa8, 0x8a, 0x9e, 0xaf, 0xad, 0xaf,
-    0xb4, 0x90, 0x54, 0x3e, 0x3b, 0x4e, 0x43, 0x47, 0x95, 0x80, 0x80, 0x90,
-    0x75, 0x7a, 0x6f, 0x43, 0x68, 0x30, 0x43, 0x36, 0x3b, 0x4e, 0x26, 0x27,
-    0x3b, 0x36, 0x27, 0x59, 0x4e, 0x68, 0x7a, 0x43, 0x54, 0x44, 0x3e, 0x7f,
-    0x3e, 0x4b, 0x2c, 0x34, 0x57, 0x97, 0xcb, 0xc6, 0xc4, 0xc4, 0xbf, 0xbf,
-    0xbf, 0xba, 0xba, 0xba, 0xba, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0x94, 0x90,
-    0x9e, 0xad, 0x8a, 0x75, 0x8a, 0x61, 0x61, 0x7a, 0x4e, 0x6a, 0x61, 0x75,
-    0x7a, 0xa3, 0x95, 0x7a, 0x71, 0x83, 0x6c, 0x6a, 0x69, 0x47, 0x3d, 0x4e,
-    0x8c, 0x59, 0x61, 0x59, 0x43, 0x54, 0x59, 0x36, 0x1a, 0x26, 0x49, 0x26,
-    0x2d, 0x6a, 0x49, 0x1a, 0x1f, 0x4b, 0x15, 0x2d, 0x1a, 0x1d, 0x64, 0x2d,
-    0x2d, 0x5e, 0x78, 0x5b, 0x4b, 0x23, 0x2d, 0x3d, 0x54, 0x49, 0x6c, 0x29,
-    0x3d, 0x31, 0x1a, 0x1a, 0x20, 0x1d, 0x2b, 0x1b, 0x26, 0x0c, 0x23, 0x23,
-    0x2b, 0x20, 0x20, 0x20, 0x1a, 0x29, 0x1d, 0x0e, 0x0c, 0x1b, 0x06, 0x0c,
-    0x0c, 0x33, 0x1a, 0x04, 0x06, 0x0c, 0x06, 0x03, 0x01, 0x04, 0x04, 0x06,
-    0x0c, 0x07, 0x04, 0x0c, 0x0c, 0x04, 0x07, 0x14, 0x0c, 0x0b, 0x04, 0x06,
-    0x06, 0x06, 0x07, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x04, 0x03, 0x04,
-    0x07, 0x03, 0x01, 0x10, 0x52, 0x07, 0x07, 0x07, 0x01, 0x02, 0x01, 0x01,
-    0x01, 0x01, 0x04, 0x10, 0x22, 0x2f, 0x0d, 0x2e, 0x2f, 0x40, 0x3c, 0x40,
-    0x52, 0x3c, 0x2e, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x1e, 0x17, 0x33,
-    0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x09, 0x66, 0x33, 0x14, 0x33,
-    0x5a, 0x18, 0x02, 0x01, 0x3f, 0x67, 0x82, 0x82, 0x67, 0x01, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x3d, 0x14, 0x02, 0x01, 0x02, 0x01, 0x0c, 0x27, 0x7d,
-    0x96, 0x2a, 0x01, 0x01, 0x27, 0x64, 0x8a, 0x76, 0x3d, 0x8c, 0x5b, 0x86,
-    0x6f, 0x7a, 0x76, 0x1f, 0x1f, 0x4e, 0x75, 0x5e, 0x76, 0x7a, 0x7a, 0x5e,
-    0x08, 0x06, 0x8f, 0x8a, 0x6a, 0x23, 0x8c, 0x9b, 0xa4, 0xa1, 0x8a, 0x61,
-    0xaf, 0x94, 0x1c, 0x0e, 0x1f, 0x4b, 0x61, 0xa1, 0x94, 0x23, 0x94, 0xa1,
-    0x8c, 0x49, 0x51, 0x6c, 0x85, 0x8c, 0x61, 0x83, 0x94, 0x83, 0x61, 0x90,
-    0x61, 0x8c, 0x81, 0x90, 0x75, 0x90, 0xb4, 0xad, 0xad, 0x95, 0x61, 0x61,
-    0x59, 0x59, 0x5c, 0x43, 0x7e, 0x4e, 0x75, 0x61, 0x9e, 0x75, 0x80, 0x75,
-    0x6f, 0x4e, 0x59, 0x3b, 0x23, 0x23, 0x1d, 0x36, 0x30, 0x1f, 0x26, 0x61,
-    0x61, 0x68, 0x3b, 0x59, 0x4e, 0x4b, 0x26, 0x3e, 0x47, 0x44, 0x26, 0x41,
-    0x5c, 0x85, 0xc4, 0xc4, 0xc4, 0xbf, 0xbf, 0xbf, 0xbf, 0xba, 0xba, 0xba,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb4, 0xa8, 0x59, 0x95, 0x95, 0xad, 0x95, 0x95,
-    0x61, 0x6f, 0x75, 0x7a, 0x6f, 0x61, 0x59, 0x68, 0x90, 0x7a, 0x68, 0x59,
-    0x6a, 0x4e, 0x61, 0x59, 0x59, 0x49, 0x61, 0x75, 0x75, 0x4e, 0x71, 0x49,
-    0x54, 0x5e, 0x4e, 0x4b, 0x26, 0x3e, 0x54, 0x26, 0x36, 0x75, 0x9b, 0x3e,
-    0x27, 0x2d, 0x1f, 0x5e, 0x36, 0x23, 0x6c, 0x54, 0x31, 0x61, 0x49, 0x36,
-    0x1d, 0x27, 0x1d, 0x23, 0x5b, 0x54, 0x31, 0x23, 0x23, 0x1d, 0x2d, 0x15,
-    0x1f, 0x18, 0x18, 0x15, 0x20, 0x1a, 0x2b, 0x12, 0x20, 0x0c, 0x18, 0x13,
-    0x23, 0x15, 0x1d, 0x15, 0x12, 0x15, 0x0c, 0x10, 0x0b, 0x06, 0x0e, 0x0c,
-    0x0c, 0x12, 0x04, 0x03, 0x05, 0x01, 0x03, 0x03, 0x03, 0x04, 0x0b, 0x1b,
-    0x07, 0x03, 0x04, 0x20, 0x10, 0x06, 0x04, 0x03, 0x01, 0x03, 0x04, 0x06,
-    0x04, 0x01, 0x01, 0x03, 0x04, 0x06, 0x04, 0x04, 0x06, 0x01, 0x0a, 0x0d,
-    0x3a, 0x01, 0x0c, 0x17, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x07, 0x22,
-    0x2f, 0x22, 0x22, 0x40, 0x3c, 0x2f, 0x52, 0x40, 0x3c, 0x3c, 0x40, 0x01,
-    0x01, 0x01, 0x01, 0x02, 0x02, 0x1b, 0x17, 0x33, 0x01, 0x00, 0x01, 0x01,
-    0x02, 0x02, 0x01, 0x14, 0x66, 0x46, 0x28, 0x24, 0x66, 0x1b, 0x02, 0x02,
-    0x31, 0x72, 0x72, 0x66, 0x50, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x87,
-    0x15, 0x02, 0x02, 0x01, 0x01, 0x1b, 0x6c, 0x50, 0x87, 0x06, 0x03, 0x01,
-    0x36, 0x50, 0x73, 0x7d, 0x2d, 0x59, 0x81, 0x78, 0x86, 0x78, 0xa4, 0x6f,
-    0x1b, 0x23, 0x54, 0x6f, 0x64, 0x81, 0x83, 0x75, 0x03, 0x06, 0x8a, 0x9b,
-    0x6f, 0x36, 0x26, 0x7a, 0xad, 0xb4, 0x9b, 0x75, 0xa8, 0x75, 0x06, 0x61,
-    0x54, 0x6f, 0x7a, 0xb0, 0x6a, 0x36, 0xbd, 0x8c, 0x69, 0x36, 0x6a, 0x49,
-    0x51, 0x8c, 0x6f, 0x75, 0x83, 0x75, 0x6a, 0x7a, 0x54, 0x61, 0x3b, 0x4e,
-    0x7a, 0x95, 0x9e, 0xb4, 0xad, 0x9e, 0x6f, 0x59, 0x71, 0x47, 0x27, 0x59,
-    0x30, 0x47, 0x7a, 0x61, 0x9e, 0x7a, 0x9e, 0x61, 0x6a, 0x75, 0x7a, 0x4e,
-    0x27, 0x36, 0x2d, 0x2d, 0x30, 0x23, 0x1f, 0x6a, 0x4e, 0x43, 0x47, 0x6f,
-    0x47, 0x3e, 0x1f, 0x4b, 0x5c, 0x26, 0x1f, 0x3e, 0x77, 0x9c, 0xb7, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xba, 0xba, 0xba, 0xba, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xa8, 0x81, 0x9e, 0x95, 0x95, 0xad, 0xa3, 0x7a, 0x7a, 0x7a, 0x6f,
-    0x59, 0x75, 0x61, 0x59, 0x59, 0x68, 0x7a, 0x43, 0x83, 0x61, 0x4e, 0x59,
-    0x49, 0x47, 0x68, 0x59, 0x61, 0x3e, 0x51, 0x36, 0x49, 0x3e, 0x3d, 0x4b,
-    0x23, 0x54, 0x54, 0x36, 0x23, 0x8c, 0x68, 0x3d, 0x23, 0x26, 0x23, 0x36,
-    0x36, 0x5e, 0x5e, 0x3d, 0x3d, 0x54, 0x27, 0x23, 0x23, 0x2d, 0x54, 0x3d,
-    0x54, 0x54, 0x25, 0x1a, 0x2d, 0x31, 0x54, 0x23, 0x2d, 0x25, 0x1d, 0x27,
-    0x27, 0x20, 0x14, 0x0c, 0x15, 0x0c, 0x12, 0x0c, 0x18, 0x14, 0x15, 0x1b,
-    0x42, 0x29, 0x14, 0x07, 0x06, 0x05, 0x06, 0x07, 0x0c, 0x12, 0x14, 0x04,
-    0x04, 0x04, 0x05, 0x01, 0x04, 0x04, 0x05, 0x0c, 0x04, 0x01, 0x03, 0x07,
-    0x06, 0x07, 0x07, 0x06, 0x04, 0x01, 0x01, 0x04, 0x03, 0x01, 0x02, 0x01,
-    0x01, 0x04, 0x04, 0x01, 0x01, 0x03, 0x09, 0x04, 0x07, 0x06, 0x07, 0x10,
-    0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x2f, 0x2f, 0x2e, 0x2e, 0x39,
-    0x3c, 0x3c, 0x2e, 0x40, 0x3c, 0x52, 0x40, 0x03, 0x01, 0x01, 0x01, 0x01,
-    0x02, 0x07, 0x1e, 0x28, 0x01, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x17,
-    0x46, 0x66, 0x72, 0x1e, 0x3f, 0x2a, 0x02, 0x01, 0x33, 0x72, 0x82, 0x5a,
-    0x1b, 0x01, 0x01, 0x00, 0x01, 0x00, 0x0c, 0x93, 0x1b, 0x02, 0x02, 0x01,
-    0x01, 0x1b, 0x86, 0x31, 0x24, 0x01, 0x05, 0x01, 0x31, 0x7d, 0x8a, 0x6c,
-    0x49, 0x18, 0x6c, 0x64, 0x8a, 0x61, 0x73, 0x6c, 0x2d, 0x0e, 0x36, 0x49,
-    0x61, 0x8f, 0x8f, 0x5e, 0x01, 0x05, 0x1b, 0x27, 0x15, 0x16, 0x06, 0x06,
-    0x8a, 0x7a, 0x7a, 0x8f, 0x8c, 0x13, 0x34, 0x71, 0x6a, 0x59, 0x76, 0x94,
-    0x6a, 0x59, 0x75, 0x61, 0x83, 0x77, 0x61, 0x51, 0x3e, 0x7a, 0x94, 0x83,
-    0x9c, 0x6a, 0x55, 0x5e, 0x47, 0x59, 0x4b, 0x83, 0x4e, 0x89, 0x9e, 0x9e,
-    0xb4, 0x9e, 0x59, 0x5b, 0x80, 0x59, 0x47, 0x4e, 0x30, 0x6a, 0x3b, 0x75,
-    0xa3, 0x95, 0xa8, 0x75, 0x59, 0x81, 0x6a, 0x75, 0x43, 0x2d, 0x47, 0x3b,
-    0x27, 0x61, 0x1a, 0x59, 0x3d, 0x59, 0x3d, 0x75, 0x3e, 0x26, 0x2d, 0x5c,
-    0x34, 0x2c, 0x0e, 0x41, 0xa9, 0x7e, 0x7e, 0xbf, 0xbf, 0xba, 0xba, 0xba,
-    0xba, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xad, 0x95, 0x9b,
-    0xa3, 0x81, 0x95, 0x95, 0x95, 0x68, 0x75, 0x4e, 0x47, 0x75, 0x8c, 0x3d,
-    0x77, 0x6f, 0x83, 0x61, 0x8a, 0x7a, 0x2d, 0x7a, 0x59, 0x36, 0x5e, 0x71,
-    0x4e, 0x61, 0x49, 0x3d, 0x3e, 0x4b, 0x5e, 0x4e, 0x2d, 0x27, 0x27, 0x23,
-    0x3e, 0x5e, 0x36, 0x35, 0x4b, 0x23, 0x54, 0x3e, 0x2d, 0x3e, 0x54, 0x36,
-    0x31, 0x36, 0x1b, 0x23, 0x26, 0x2b, 0x23, 0x29, 0x31, 0x35, 0x2d, 0x1d,
-    0x2d, 0x23, 0x1e, 0x23, 0x1d, 0x27, 0x2d, 0x23, 0x23, 0x0f, 0x0c, 0x0b,
-    0x12, 0x0b, 0x1b, 0x06, 0x06, 0x0f, 0x10, 0x24, 0x31, 0x25, 0x15, 0x0c,
-    0x03, 0x06, 0x04, 0x04, 0x0c, 0x1b, 0x24, 0x07, 0x06, 0x04, 0x06, 0x0c,
-    0x04, 0x04, 0x06, 0x04, 0x04, 0x07, 0x07, 0x04, 0x01, 0x04, 0x0c, 0x07,
-    0x06, 0x04, 0x04, 0x04, 0x01, 0x05, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01,
-    0x07, 0x22, 0x0c, 0x04, 0x01, 0x04, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01,
-    0x02, 0x01, 0x07, 0x2f, 0x40, 0x2f, 0x2f, 0x2e, 0x2e, 0x52, 0x40, 0x40,
-    0x52, 0x52, 0x40, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x17, 0x10,
-    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x2a, 0x24, 0x72, 0x72, 0x46,
-    0x3f, 0x3a, 0x02, 0x01, 0x2a, 0x58, 0x70, 0x67, 0x01, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x42, 0x93, 0x15, 0x01, 0x02, 0x01, 0x01, 0x15, 0x7d, 0x54,
-    0x06, 0x01, 0x05, 0x01, 0x27, 0x92, 0xae, 0x6c, 0x3d, 0x2a, 0x50, 0x5b,
-    0x31, 0x54, 0x64, 0x81, 0x49, 0x11, 0x3d, 0x69, 0x69, 0x6c, 0x7d, 0x4b,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x04, 0x03, 0x25, 0x8c, 0x77, 0x54,
-    0x16, 0x01, 0x1a, 0x3e, 0x55, 0x36, 0x59, 0x5e, 0x71, 0x2d, 0x54, 0x7a,
-    0x83, 0x51, 0x55, 0x6a, 0x26, 0x7a, 0xa1, 0x89, 0x90, 0x61, 0x36, 0x23,
-    0x47, 0x61, 0x9c, 0x59, 0x61, 0x75, 0xaf, 0xa8, 0x59, 0x6f, 0x8c, 0x80,
-    0x61, 0x59, 0x64, 0x59, 0x3e, 0xad, 0x61, 0x78, 0x9e, 0x7a, 0x78, 0x9e,
-    0x5b, 0x61, 0x43, 0x5b, 0x43, 0x2d, 0x59, 0x80, 0x23, 0x61, 0x1a, 0x6f,
-    0x61, 0x61, 0x75, 0x59, 0x30, 0x3e, 0x3e, 0x47, 0x26, 0x26, 0x3e, 0x61,
-    0x3e, 0x36, 0x85, 0xbf, 0xba, 0xba, 0xba, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xaf, 0xad, 0xad, 0x80, 0x8a, 0x75, 0x95, 0xa4, 0x8a,
-    0x95, 0x96, 0x95, 0x75, 0x6a, 0x81, 0x9e, 0x43, 0x8a, 0x80, 0x59, 0x8f,
-    0x8c, 0x68, 0x61, 0x68, 0x6a, 0x3e, 0x54, 0x54, 0x6f, 0x59, 0x59, 0x54,
-    0x54, 0x36, 0x49, 0x2c, 0x3e, 0x23, 0x4b, 0x1d, 0x2d, 0x23, 0x1c, 0x23,
-    0x27, 0x2d, 0x5e, 0x5b, 0x1a, 0x23, 0x51, 0x31, 0x3e, 0x54, 0x5e, 0x5e,
-    0x23, 0x12, 0x13, 0x27, 0x3d, 0x54, 0x31, 0x6c, 0x3d, 0x36, 0x25, 0x1b,
-    0x23, 0x23, 0x1c, 0x15, 0x2a, 0x1d, 0x20, 0x1b, 0x15, 0x13, 0x3d, 0x0c,
-    0x05, 0x06, 0x23, 0x14, 0x12, 0x07, 0x04, 0x05, 0x04, 0x18, 0x0c, 0x04,
-    0x05, 0x07, 0x14, 0x04, 0x04, 0x0b, 0x06, 0x04, 0x03, 0x06, 0x10, 0x0b,
-    0x06, 0x09, 0x0d, 0x04, 0x05, 0x06, 0x01, 0x05, 0x04, 0x04, 0x04, 0x0a,
-    0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x1e, 0x62, 0x19, 0x04,
-    0x01, 0x01, 0x04, 0x07, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x04, 0x22,
-    0x2f, 0x40, 0x40, 0x40, 0x40, 0x3c, 0x2f, 0x60, 0x60, 0x60, 0x2e, 0x04,
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x0b, 0x28, 0x03, 0x02, 0x01, 0x01, 0x01,
-    0x01, 0x05, 0x02, 0x1b, 0x3a, 0x58, 0x72, 0x62, 0x14, 0x2a, 0x01, 0x02,
-    0x2a, 0x5a, 0x53, 0x33, 0x02, 0x01, 0x00, 0x00, 0x01, 0x02, 0x53, 0x82,
-    0x06, 0x01, 0x01, 0x01, 0x01, 0x20, 0x7b, 0x73, 0x20, 0x01, 0x04, 0x01,
-    0x54, 0x73, 0xa4, 0x5b, 0x5b, 0x3d, 0x7a, 0x49, 0x54, 0x76, 0x5b, 0x8f,
-    0x5b, 0x1f, 0x49, 0x5e, 0x3d, 0x5e, 0x81, 0x11, 0x13, 0x49, 0x59, 0x61,
-    0x81, 0x8c, 0x69, 0x05, 0x05, 0x0c, 0x0b, 0x06, 0x03, 0x15, 0x3b, 0x49,
-    0x1a, 0x49, 0x4b, 0x27, 0x5b, 0x7a, 0x7a, 0x7a, 0x7a, 0x71, 0x54, 0x51,
-    0x77, 0x6a, 0x68, 0x7a, 0x85, 0x4b, 0x34, 0x51, 0x2d, 0x47, 0x90, 0x3d,
-    0x8c, 0x9b, 0x95, 0xad, 0x89, 0x68, 0xad, 0x61, 0x43, 0x83, 0x71, 0x68,
-    0x75, 0x80, 0x49, 0x80, 0xb4, 0x81, 0x9e, 0xad, 0x75, 0x7a, 0x47, 0x95,
-    0x30, 0x3d, 0x6a, 0x43, 0x1f, 0x4e, 0x30, 0x75, 0x59, 0x43, 0x5e, 0x47,
-    0x3d, 0x30, 0x1f, 0x36, 0x4b, 0x26, 0x1f, 0x3e, 0x26, 0x44, 0x9e, 0xaf,
-    0xb5, 0xb4, 0xb4, 0xb5, 0xb5, 0xb5, 0xb5, 0xad, 0xad, 0xad, 0xad, 0xad,
-    0xad, 0xad, 0x6f, 0x75, 0x4e, 0x9e, 0xa3, 0x83, 0x95, 0x95, 0x8a, 0x9e,
-    0x81, 0x9b, 0x89, 0x6f, 0x8f, 0x75, 0x90, 0x6f, 0x9b, 0xa1, 0x61, 0x59,
-    0x59, 0x5e, 0x3b, 0x54, 0x5b, 0x59, 0x3d, 0x49, 0x2d, 0x3d, 0x36, 0x1a,
-    0x23, 0x1f, 0x2d, 0x27, 0x23, 0x1a, 0x1d, 0x2d, 0x23, 0x3d, 0x27, 0x54,
-    0x3d, 0x23, 0x36, 0x31, 0x2d, 0x49, 0x31, 0x68, 0x29, 0x6c, 0x1a, 0x3e,
-    0x23, 0x23, 0x54, 0x54, 0x23, 0x23, 0x54, 0x0b, 0x2b, 0x18, 0x07, 0x0b,
-    0x23, 0x29, 0x4c, 0x31, 0x15, 0x15, 0x20, 0x04, 0x05, 0x05, 0x1a, 0x0c,
-    0x05, 0x06, 0x04, 0x06, 0x06, 0x12, 0x06, 0x06, 0x07, 0x05, 0x05, 0x01,
-    0x04, 0x06, 0x01, 0x06, 0x04, 0x07, 0x0c, 0x07, 0x07, 0x06, 0x07, 0x04,
-    0x06, 0x06, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
-    0x04, 0x0c, 0x01, 0x01, 0x04, 0x3c, 0x22, 0x01, 0x01, 0x01, 0x07, 0x04,
-    0x01, 0x01, 0x01, 0x06, 0x02, 0x03, 0x01, 0x22, 0x22, 0x40, 0x2e, 0x2f,
-    0x1e, 0x2f, 0x40, 0x52, 0x60, 0x2f, 0x3c, 0x06, 0x01, 0x01, 0x01, 0x01,
-    0x02, 0x01, 0x24, 0x00, 0x02, 0x01, 0x02, 0x01, 0x01, 0x03, 0x01, 0x10,
-    0x5a, 0x62, 0x66, 0x72, 0x1e, 0x1e, 0x01, 0x01, 0x2a, 0x72, 0x33, 0x06,
-    0x01, 0x01, 0x01, 0x02, 0x00, 0x0c, 0x93, 0x9f, 0x06, 0x01, 0x01, 0x01,
-    0x02, 0x2b, 0x96, 0x50, 0x2d, 0x02, 0x05, 0x01, 0x3d, 0x73, 0x7d, 0x5b,
-    0x81, 0x2d, 0x73, 0x7a, 0x64, 0x81, 0x59, 0x83, 0x49, 0x3d, 0x1d, 0x6a,
-    0x61, 0x81, 0x3e, 0x03, 0x04, 0x8c, 0x9f, 0xa3, 0xae, 0x8f, 0xa4, 0x5e,
-    0x1b, 0x08, 0x0b, 0x12, 0x5c, 0x83, 0x59, 0x8a, 0x76, 0x7a, 0x83, 0x5e,
-    0x6a, 0xa8, 0x7a, 0xab, 0x5e, 0x94, 0x71, 0x54, 0x68, 0x69, 0x2d, 0x36,
-    0x7a, 0x5e, 0x47, 0x36, 0x27, 0x4b, 0x43, 0x61, 0x4e, 0x68, 0x4e, 0xb4,
-    0xa3, 0x9e, 0x7a, 0x5c, 0x75, 0x6a, 0x73, 0x81, 0x80, 0x59, 0x9e, 0x5b,
-    0x54, 0x43, 0x95, 0x75, 0x75, 0x6a, 0x30, 0x3b, 0x49, 0x3b, 0x3b, 0x30,
-    0x2d, 0x27, 0x75, 0x80, 0x61, 0x3b, 0x31, 0x43, 0x2d, 0x26, 0x2d, 0x26,
-    0x1f, 0x26, 0x51, 0x1f, 0x26, 0x26, 0x6f, 0x94, 0xb4, 0xb9, 0xb5, 0xb4,
-    0xb4, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x83, 0x75,
-    0x7a, 0x8f, 0x95, 0x68, 0x4e, 0x61, 0x95, 0x81, 0x6f, 0x7a, 0x80, 0x8a,
-    0xa3, 0xad, 0xa3, 0x8a, 0x61, 0x6f, 0x47, 0x49, 0x54, 0x4e, 0x59, 0x1d,
-    0x5e, 0x7a, 0x35, 0x4e, 0x36, 0x30, 0x36, 0x1f, 0x36, 0x5e, 0x3d, 0x3e,
-    0x36, 0x26, 0x55, 0x59, 0x8c, 0x49, 0x3d, 0x5e, 0x2d, 0x21, 0x2d, 0x49,
-    0x49, 0x31, 0x3d, 0x31, 0x25, 0x1d, 0x20, 0x13, 0x27, 0x42, 0x64, 0x49,
-    0x0f, 0x16, 0x13, 0x0b, 0x15, 0x0f, 0x15, 0x1a, 0x23, 0x18, 0x18, 0x0b,
-    0x0b, 0x06, 0x07, 0x1f, 0x0c, 0x14, 0x1e, 0x07, 0x06, 0x06, 0x0c, 0x12,
-    0x04, 0x0c, 0x06, 0x04, 0x25, 0x04, 0x04, 0x06, 0x06, 0x01, 0x07, 0x05,
-    0x03, 0x04, 0x0c, 0x33, 0x10, 0x06, 0x1b, 0x07, 0x1b, 0x04, 0x03, 0x01,
-    0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x04, 0x07,
-    0x01, 0x0a, 0x04, 0x01, 0x01, 0x04, 0x01, 0x04, 0x01, 0x02, 0x03, 0x01,
-    0x01, 0x04, 0x01, 0x22, 0x2f, 0x40, 0x52, 0x10, 0x10, 0x2e, 0x40, 0x40,
-    0x40, 0x2e, 0x2f, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x00,
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x17, 0x3a, 0x58, 0x58, 0x63,
-    0x1e, 0x28, 0x02, 0x02, 0x2a, 0x72, 0x14, 0x01, 0x02, 0x01, 0x01, 0x01,
-    0x01, 0x53, 0x70, 0x93, 0x07, 0x01, 0x01, 0x02, 0x02, 0x23, 0x7b, 0x67,
-    0x31, 0x02, 0x03, 0x04, 0x3d, 0x73, 0x29, 0x49, 0x73, 0x76, 0x31, 0x78,
-    0x73, 0x81, 0x31, 0x3d, 0x54, 0x49, 0x1f, 0x36, 0x5b, 0x75, 0x0b, 0x05,
-    0x1f, 0xad, 0xad, 0xad, 0xa4, 0xb0, 0xae, 0x8c, 0xa1, 0x1a, 0x15, 0x77,
-    0x5e, 0x7a, 0x83, 0xa8, 0x73, 0x89, 0x69, 0x8c, 0x7a, 0xa1, 0x8c, 0x83,
-    0x61, 0x5e, 0x61, 0x61, 0x77, 0x7e, 0x83, 0x69, 0x3d, 0x7a, 0x36, 0x26,
-    0x36, 0x51, 0x51, 0x3b, 0x5e, 0x59, 0x7a, 0x95, 0x90, 0xb4, 0x95, 0x43,
-    0x59, 0x59, 0x80, 0x43, 0x3b, 0x4e, 0x75, 0x6f, 0x83, 0x30, 0x54, 0xad,
-    0x75, 0x5b, 0x3b, 0x27, 0x23, 0x2d, 0x68, 0x27, 0x1f, 0x30, 0x8f, 0x95,
-    0x43, 0x59, 0x4e, 0x47, 0x51, 0x3b, 0x26, 0x54, 0x1f, 0x2c, 0x1f, 0x1f,
-    0x26, 0x1a, 0x83, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xad, 0xad, 0xad, 0xad,
-    0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x6f, 0x8f, 0x80, 0x75, 0x49, 0x6f,
-    0x43, 0x2d, 0x7a, 0x68, 0x59, 0x8a, 0x75, 0x8a, 0x95, 0x8f, 0x9e, 0x47,
-    0x61, 0x3e, 0x59, 0x61, 0x43, 0x49, 0x49, 0x51, 0x47, 0x7a, 0x59, 0x49,
-    0x3b, 0x1d, 0x36, 0x36, 0x3e, 0x8c, 0x69, 0x23, 0x2d, 0x1f, 0x1d, 0x15,
-    0x4e, 0x27, 0x49, 0x3e, 0x3e, 0x36, 0x36, 0x54, 0x81, 0x6c, 0x54, 0x1f,
-    0x1c, 0x31, 0x26, 0x3d, 0x25, 0x73, 0x31, 0x3d, 0x07, 0x0c, 0x13, 0x0c,
-    0x0c, 0x21, 0x0c, 0x06, 0x0b, 0x15, 0x1b, 0x13, 0x10, 0x0b, 0x0c, 0x15,
-    0x06, 0x12, 0x1f, 0x12, 0x0c, 0x14, 0x2a, 0x0b, 0x07, 0x06, 0x03, 0x01,
-    0x04, 0x04, 0x05, 0x06, 0x06, 0x04, 0x12, 0x03, 0x04, 0x04, 0x06, 0x06,
-    0x14, 0x0c, 0x03, 0x04, 0x07, 0x04, 0x01, 0x01, 0x01, 0x04, 0x03, 0x01,
-    0x05, 0x04, 0x01, 0x02, 0x01, 0x02, 0x04, 0x07, 0x04, 0x01, 0x07, 0x01,
-    0x01, 0x04, 0x0a, 0x04, 0x01, 0x01, 0x01, 0x06, 0x01, 0x01, 0x01, 0x0d,
-    0x3c, 0x2f, 0x3c, 0x09, 0x17, 0x40, 0x22, 0x3a, 0x28, 0x28, 0x33, 0x07,
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01,
-    0x02, 0x01, 0x10, 0x17, 0x5a, 0x46, 0x66, 0x72, 0x46, 0x24, 0x02, 0x02,
-    0x2a, 0x72, 0x20, 0x01, 0x01, 0x02, 0x01, 0x01, 0x04, 0x93, 0x82, 0x53,
-    0x04, 0x01, 0x01, 0x02, 0x01, 0x25, 0x86, 0x5b, 0x29, 0x01, 0x01, 0x06,
-    0x73, 0x5b, 0x76, 0x23, 0x73, 0x3d, 0x54, 0x67, 0x81, 0x76, 0x75, 0x59,
-    0x35, 0x2d, 0x0b, 0x23, 0x5c, 0x0f, 0x05, 0x26, 0x1d, 0xa4, 0xad, 0xbc,
-    0x8a, 0xa4, 0xb4, 0x8f, 0xa3, 0xab, 0x0f, 0x76, 0x43, 0x6c, 0xae, 0xae,
-    0x6c, 0xae, 0x6a, 0x8f, 0xaf, 0x9b, 0x9b, 0x54, 0x5e, 0x77, 0x7a, 0x77,
-    0x75, 0x77, 0x7d, 0x6a, 0x3d, 0x6a, 0x2d, 0x26, 0x26, 0x4e, 0x2d, 0x51,
-    0x47, 0x71, 0x9e, 0x95, 0x75, 0x81, 0xb4, 0x95, 0x80, 0x30, 0x80, 0x4e,
-    0x26, 0x4e, 0x5b, 0x6a, 0x95, 0x4e, 0x4e, 0x3b, 0x3b, 0x59, 0x8a, 0x75,
-    0x47, 0x51, 0x27, 0x36, 0x26, 0x23, 0x2d, 0x68, 0x4e, 0x59, 0x4e, 0x47,
-    0x59, 0x27, 0x3e, 0x3e, 0x1f, 0x1f, 0x1a, 0x59, 0x1a, 0x1f, 0x89, 0xa8,
-    0xb4, 0xb4, 0x9e, 0x95, 0xaf, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad,
-    0xad, 0xad, 0xa3, 0x95, 0x78, 0x75, 0x47, 0x6f, 0x75, 0x61, 0x6f, 0xa8,
-    0x95, 0x80, 0x54, 0x68, 0x89, 0x8f, 0x4e, 0x54, 0x3d, 0x7a, 0x50, 0x54,
-    0x68, 0x59, 0x59, 0x75, 0x64, 0x83, 0x71, 0x47, 0x59, 0x54, 0x3d, 0x1f,
-    0x3e, 0x49, 0x83, 0x1f, 0x1f, 0x23, 0x5e, 0x27, 0x2d, 0x49, 0x27, 0x27,
-    0x5b, 0x54, 0x3e, 0x31, 0x96, 0x3e, 0x3d, 0x23, 0x0f, 0x2d, 0x1d, 0x49,
-    0x64, 0x5b, 0x3f, 0x5b, 0x0c, 0x1b, 0x1f, 0x1b, 0x12, 0x23, 0x14, 0x15,
-    0x12, 0x1b, 0x13, 0x0c, 0x15, 0x14, 0x0b, 0x06, 0x06, 0x05, 0x07, 0x2a,
-    0x1a, 0x12, 0x18, 0x12, 0x49, 0x10, 0x05, 0x06, 0x06, 0x07, 0x04, 0x05,
-    0x04, 0x03, 0x01, 0x01, 0x06, 0x06, 0x04, 0x0b, 0x04, 0x0c, 0x05, 0x01,
-    0x04, 0x10, 0x01, 0x01, 0x03, 0x06, 0x04, 0x04, 0x0b, 0x04, 0x04, 0x01,
-    0x01, 0x01, 0x04, 0x04, 0x07, 0x10, 0x05, 0x04, 0x02, 0x04, 0x07, 0x04,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0d, 0x40, 0x22, 0x0d, 0x06,
-    0x17, 0x40, 0x40, 0x2f, 0x22, 0x17, 0x2e, 0x09, 0x01, 0x01, 0x04, 0x01,
-    0x02, 0x01, 0x00, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x1e, 0x17,
-    0x66, 0x3c, 0x72, 0x72, 0x58, 0x14, 0x01, 0x01, 0x20, 0x66, 0x06, 0x02,
-    0x01, 0x01, 0x01, 0x02, 0x1e, 0x82, 0x82, 0x87, 0x01, 0x02, 0x01, 0x01,
-    0x01, 0x31, 0x67, 0x7b, 0x12, 0x01, 0x01, 0x0b, 0x5b, 0x42, 0x64, 0x96,
-    0x7d, 0x50, 0x7d, 0x92, 0x8f, 0x81, 0x7d, 0x50, 0x54, 0x1f, 0x0b, 0x0b,
-    0x05, 0x0b, 0x5e, 0x54, 0x26, 0x96, 0xae, 0xae, 0xa1, 0xa4, 0xb4, 0x9b,
-    0x9b, 0xad, 0xa1, 0x27, 0xb0, 0x54, 0x9b, 0xae, 0x8f, 0xa1, 0x59, 0x9b,
-    0xbc, 0x83, 0xa1, 0x8f, 0x69, 0x83, 0x3e, 0x75, 0x83, 0x75, 0x6f, 0x7a,
-    0x4b, 0x54, 0x36, 0x36, 0x49, 0x4b, 0x59, 0x3b, 0x5e, 0x6a, 0x6f, 0x83,
-    0x43, 0x61, 0x61, 0x75, 0x68, 0x47, 0x30, 0x26, 0x1f, 0x23, 0x27, 0x89,
-    0x9e, 0x4e, 0x4e, 0x3b, 0x59, 0x4e, 0x7a, 0x68, 0x43, 0x75, 0x59, 0x68,
-    0x30, 0x23, 0x3b, 0x30, 0x36, 0x4e, 0x54, 0x30, 0x47, 0x23, 0x3e, 0x30,
-    0x23, 0x34, 0x1f, 0x71, 0x43, 0x47, 0x89, 0x95, 0xb4, 0xb4, 0x95, 0x83,
-    0x9e, 0xa3, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xa3,
-    0x68, 0x8c, 0x75, 0x61, 0x47, 0x49, 0x59, 0x80, 0xa8, 0x83, 0x6a, 0x4e,
-    0x61, 0x49, 0x6f, 0x6c, 0x51, 0x59, 0x6f, 0x47, 0x3d, 0x54, 0x54, 0x81,
-    0x75, 0x49, 0x3e, 0x3d, 0x3d, 0x64, 0x54, 0x23, 0x1f, 0x54, 0x54, 0x26,
-    0x2d, 0x2d, 0x1c, 0x1f, 0x23, 0x8a, 0x64, 0x2d, 0x4b, 0x49, 0x54, 0x36,
-    0x54, 0x49, 0x50, 0x27, 0x3e, 0x29, 0x31, 0x1d, 0x6c, 0x50, 0x78, 0x3d,
-    0x36, 0x49, 0x25, 0x3d, 0x2b, 0x1b, 0x29, 0x27, 0x12, 0x15, 0x07, 0x0c,
-    0x1f, 0x0b, 0x0b, 0x12, 0x24, 0x07, 0x0b, 0x23, 0x24, 0x09, 0x20, 0x0c,
-    0x09, 0x13, 0x04, 0x06, 0x06, 0x04, 0x05, 0x05, 0x03, 0x04, 0x06, 0x04,
-    0x04, 0x06, 0x03, 0x03, 0x04, 0x01, 0x04, 0x04, 0x04, 0x01, 0x01, 0x03,
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x02, 0x01, 0x00, 0x01, 0x07, 0x07,
-    0x04, 0x04, 0x01, 0x04, 0x01, 0x04, 0x07, 0x01, 0x01, 0x01, 0x01, 0x07,
-    0x07, 0x01, 0x01, 0x10, 0x2f, 0x17, 0x04, 0x07, 0x22, 0x52, 0x52, 0x52,
-    0x2f, 0x1e, 0x2f, 0x22, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x1e, 0x10, 0x24, 0x46, 0x72, 0x72,
-    0x53, 0x14, 0x01, 0x01, 0x1b, 0x66, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01,
-    0x4f, 0x93, 0x93, 0x7b, 0x01, 0x02, 0x01, 0x02, 0x02, 0x35, 0x87, 0x73,
-    0x15, 0x01, 0x01, 0x0b, 0x54, 0x64, 0x7d, 0x9f, 0x96, 0x81, 0x7d, 0x76,
-    0xa4, 0xa4, 0x9b, 0x64, 0x61, 0x2d, 0x05, 0x05, 0x06, 0x3d, 0x64, 0x3e,
-    0x31, 0x8a, 0xae, 0xa4, 0xa4, 0xad, 0xae, 0x8a, 0x9b, 0x8a, 0x9b, 0x3d,
-    0xaf, 0x68, 0x8f, 0x8f, 0x8f, 0x76, 0x8f, 0xa1, 0xab, 0x7a, 0xae, 0xb0,
-    0x7a, 0x75, 0x5c, 0x8c, 0x7a, 0x8c, 0x83, 0x59, 0x61, 0x6a, 0x27, 0x54,
-    0x3b, 0x59, 0x59, 0x59, 0x51, 0x61, 0x95, 0x68, 0x4b, 0x3b, 0x68, 0x71,
-    0x61, 0x4e, 0x1a, 0x1f, 0x13, 0x36, 0x36, 0x4e, 0x6a, 0x3d, 0x6f, 0x4e,
-    0x2d, 0x26, 0x3d, 0x36, 0x43, 0x51, 0x3b, 0x49, 0x30, 0x27, 0x3b, 0x3b,
-    0x3b, 0x49, 0x4e, 0x30, 0x26, 0x1f, 0x2d, 0x26, 0x2d, 0x47, 0x34, 0x3d,
-    0x61, 0x7a, 0x7a, 0x80, 0xad, 0xad, 0xb4, 0xad, 0x80, 0x8a, 0xad, 0xad,
-    0xad, 0xad, 0xad, 0xad, 0xad, 0xa3, 0x81, 0x81, 0x68, 0x59, 0x43, 0x54,
-    0x3b, 0x3b, 0x36, 0x43, 0x6f, 0x27, 0x6f, 0x68, 0x59, 0x31, 0x94, 0x3e,
-    0x36, 0x2d, 0x3e, 0x47, 0x5e, 0x59, 0x75, 0x61, 0x54, 0x5e, 0x2d, 0x3e,
-    0x31, 0x2d, 0x3e, 0x3e, 0x27, 0x2d, 0x36, 0x3e, 0x49, 0x49, 0x36, 0x1f,
-    0x26, 0x49, 0x5e, 0x2d, 0x26, 0x31, 0x54, 0x3e, 0x23, 0x64, 0x5b, 0x3d,
-    0x64, 0x1d, 0x6c, 0x31, 0x50, 0x3d, 0x50, 0x31, 0x36, 0x49, 0x1d, 0x31,
-    0x18, 0x12, 0x20, 0x31, 0x27, 0x12, 0x0b, 0x0b, 0x15, 0x04, 0x0b, 0x14,
-    0x31, 0x1b, 0x1d, 0x24, 0x20, 0x20, 0x14, 0x14, 0x05, 0x06, 0x03, 0x04,
-    0x04, 0x04, 0x0b, 0x12, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x03, 0x04,
-    0x04, 0x05, 0x0c, 0x06, 0x03, 0x04, 0x03, 0x04, 0x03, 0x03, 0x01, 0x04,
-    0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x01, 0x04, 0x01, 0x03, 0x04, 0x04,
-    0x02, 0x01, 0x07, 0x04, 0x01, 0x01, 0x01, 0x09, 0x0d, 0x01, 0x01, 0x09,
-    0x22, 0x10, 0x06, 0x10, 0x28, 0x52, 0x52, 0x52, 0x2e, 0x2f, 0x22, 0x1e,
-    0x02, 0x01, 0x02, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01,
-    0x02, 0x01, 0x1e, 0x07, 0x28, 0x4f, 0x58, 0x72, 0x33, 0x1e, 0x01, 0x01,
-    0x24, 0x28, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x82, 0x93, 0x93, 0x70,
-    0x01, 0x02, 0x01, 0x01, 0x02, 0x42, 0x50, 0x50, 0x0c, 0x01, 0x01, 0x06,
-    0x49, 0x50, 0x86, 0x92, 0x9f, 0x96, 0x7d, 0x3d, 0x96, 0x96, 0x81, 0x54,
-    0x64, 0x6f, 0x0b, 0x01, 0x0c, 0x54, 0x54, 0x2d, 0x54, 0x75, 0xa4, 0xae,
-    0xae, 0xae, 0xa4, 0xa4, 0xa1, 0x9e, 0x96, 0x6f, 0x5e, 0x6c, 0x83, 0x8a,
-    0x86, 0x75, 0x8c, 0x8f, 0xa1, 0x8f, 0xa1, 0xa1, 0x7a, 0x69, 0x6a, 0x6a,
-    0x75, 0x77, 0x9b, 0x6c, 0x6a, 0x7a, 0x27, 0x4b, 0x5e, 0x7a, 0x4e, 0x47,
-    0x61, 0x2d, 0x6f, 0x3b, 0x36, 0x2c, 0x43, 0x61, 0x4b, 0x43, 0x1d, 0x27,
-    0x3b, 0x27, 0x13, 0x54, 0x75, 0x4e, 0x61, 0x3b, 0x30, 0x1f, 0x36, 0x68,
-    0x6a, 0x59, 0x47, 0x4e, 0x26, 0x2c, 0x36, 0x4e, 0x59, 0x4e, 0x59, 0x3e,
-    0x26, 0x23, 0x26, 0x1f, 0x59, 0x6a, 0x61, 0x2d, 0x59, 0x75, 0x2d, 0x80,
-    0xad, 0x95, 0xa8, 0x95, 0x71, 0x7a, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad,
-    0xad, 0xad, 0x8a, 0x6f, 0xa8, 0x59, 0x3b, 0x61, 0x61, 0x3e, 0x30, 0x36,
-    0x23, 0x4b, 0x6f, 0x8c, 0x59, 0x54, 0x7a, 0x75, 0x49, 0x49, 0x3e, 0x61,
-    0x59, 0x5e, 0x59, 0x61, 0x3e, 0x3e, 0x3e, 0x4b, 0x3d, 0x54, 0x27, 0x54,
-    0x49, 0x23, 0x3e, 0x29, 0x5e, 0x64, 0x49, 0x23, 0x2d, 0x2d, 0x2d, 0x49,
-    0x3d, 0x49, 0x27, 0x49, 0x49, 0x7d, 0x49, 0x54, 0x64, 0x64, 0x73, 0x31,
-    0x64, 0x49, 0x5b, 0x49, 0x1d, 0x3d, 0x2d, 0x42, 0x23, 0x0b, 0x0f, 0x1d,
-    0x14, 0x0c, 0x0c, 0x0c, 0x0c, 0x06, 0x04, 0x06, 0x15, 0x1d, 0x20, 0x14,
-    0x0c, 0x25, 0x1d, 0x0b, 0x01, 0x05, 0x01, 0x04, 0x07, 0x12, 0x0c, 0x0c,
-    0x06, 0x0b, 0x04, 0x04, 0x04, 0x0c, 0x04, 0x03, 0x04, 0x0b, 0x09, 0x10,
-    0x0c, 0x0c, 0x03, 0x04, 0x04, 0x04, 0x01, 0x01, 0x01, 0x05, 0x04, 0x05,
-    0x01, 0x04, 0x02, 0x01, 0x04, 0x04, 0x06, 0x04, 0x04, 0x01, 0x01, 0x04,
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x09, 0x01, 0x04, 0x09,
-    0x22, 0x3c, 0x40, 0x22, 0x2e, 0x40, 0x2e, 0x0d, 0x01, 0x01, 0x02, 0x01,
-    0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x02, 0x02, 0x06, 0x07,
-    0x46, 0x46, 0x22, 0x33, 0x2a, 0x1b, 0x05, 0x02, 0x10, 0x06, 0x01, 0x02,
-    0x02, 0x01, 0x01, 0x14, 0x93, 0x93, 0x93, 0x67, 0x01, 0x01, 0x02, 0x01,
-    0x01, 0x50, 0x67, 0x5b, 0x06, 0x01, 0x01, 0x0b, 0x49, 0x31, 0x7d, 0x96,
-    0x96, 0x96, 0x86, 0x6c, 0x7d, 0x86, 0x81, 0x71, 0x3d, 0x96, 0x1d, 0x05,
-    0x0b, 0x49, 0x2d, 0x2d, 0x54, 0x7d, 0x9b, 0x96, 0xbc, 0xbc, 0xa4, 0xa4,
-    0x96, 0xad, 0xa4, 0xab, 0x24, 0x81, 0x8f, 0xae, 0xae, 0x6f, 0x83, 0x8a,
-    0xae, 0xa1, 0xa1, 0xb5, 0xa1, 0x6f, 0x75, 0x4b, 0x5e, 0x59, 0x7a, 0x6c,
-    0x61, 0x83, 0x4b, 0x36, 0x61, 0x68, 0x54, 0x30, 0x2d, 0x27, 0x27, 0x3b,
-    0x43, 0x30, 0x4e, 0x3d, 0x59, 0x47, 0x27, 0x2d, 0x3b, 0x36, 0x27, 0x4e,
-    0x4e, 0x2d, 0x75, 0x59, 0x3e, 0x1f, 0x4e, 0x89, 0x61, 0x68, 0x59, 0x61,
-    0x3e, 0x30, 0x3d, 0x3d, 0x3b, 0x2d, 0x61, 0x49, 0x2d, 0x36, 0x2c, 0x2c,
-    0x3d, 0x75, 0x75, 0x47, 0x2d, 0x89, 0x83, 0x89, 0x96, 0x9e, 0x81, 0x89,
-    0x61, 0x95, 0xad, 0xa3, 0xad, 0xad, 0xad, 0xad, 0xad, 0xa3, 0x9e, 0x78,
-    0x9e, 0x8f, 0x61, 0x59, 0x43, 0x59, 0x68, 0x43, 0x3d, 0x3e, 0x75, 0x8a,
-    0x75, 0x8f, 0x7a, 0x75, 0x75, 0x54, 0x68, 0x76, 0x51, 0x49, 0x3e, 0x3e,
-    0x54, 0x2d, 0x3d, 0x2d, 0x54, 0x5e, 0x2d, 0x4b, 0x3d, 0x1f, 0x1d, 0x31,
-    0x49, 0x6c, 0x27, 0x1f, 0x23, 0x27, 0x3d, 0x54, 0x5b, 0x3d, 0x27, 0x31,
-    0x67, 0x6c, 0x3d, 0x76, 0x96, 0x81, 0x73, 0x3d, 0x3d, 0x5b, 0x5b, 0x31,
-    0x50, 0x27, 0x23, 0x49, 0x49, 0x12, 0x13, 0x0b, 0x12, 0x0c, 0x0b, 0x07,
-    0x15, 0x10, 0x15, 0x0c, 0x1b, 0x1b, 0x13, 0x15, 0x04, 0x07, 0x20, 0x06,
-    0x01, 0x06, 0x04, 0x06, 0x07, 0x12, 0x0b, 0x07, 0x06, 0x06, 0x04, 0x04,
-    0x04, 0x04, 0x07, 0x05, 0x10, 0x10, 0x04, 0x06, 0x07, 0x06, 0x04, 0x04,
-    0x06, 0x05, 0x01, 0x01, 0x04, 0x04, 0x03, 0x06, 0x01, 0x04, 0x04, 0x04,
-    0x03, 0x03, 0x03, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x02, 0x03, 0x0a, 0x04, 0x09, 0x07, 0x22, 0x2f, 0x17, 0x22,
-    0x2e, 0x3c, 0x2f, 0x22, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x1e, 0x46, 0x3a, 0x1b,
-    0x5a, 0x1e, 0x03, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x02, 0x00, 0x66,
-    0x93, 0x93, 0x82, 0x53, 0x01, 0x01, 0x02, 0x01, 0x02, 0x50, 0x5b, 0x31,
-    0x04, 0x02, 0x01, 0x0b, 0x3d, 0x64, 0x5b, 0x42, 0x5b, 0x5b, 0x92, 0x5b,
-    0x7d, 0x76, 0x7d, 0x6c, 0x6f, 0x73, 0x2d, 0x0b, 0x05, 0x3e, 0x2d, 0x54,
-    0x31, 0x8a, 0xa4, 0x7d, 0xae, 0xbd, 0xae, 0x81, 0xa4, 0xae, 0xae, 0x73,
-    0xa1, 0xa4, 0xa4, 0xb4, 0xae, 0x8f, 0x6a, 0x9b, 0xab, 0x8a, 0x8f, 0x94,
-    0x8f, 0x8c, 0xab, 0x6f, 0x51, 0x61, 0x4b, 0x3e, 0x71, 0x61, 0x8c, 0x36,
-    0x4b, 0x61, 0x36, 0x4e, 0x23, 0x2d, 0x2d, 0x47, 0x6a, 0x26, 0x3b, 0x23,
-    0x2d, 0x2d, 0x2c, 0x1a, 0x1f, 0x1f, 0x1f, 0x59, 0x7a, 0x36, 0x4e, 0x2d,
-    0x30, 0x13, 0x23, 0x43, 0x61, 0x5b, 0x61, 0x61, 0x59, 0x27, 0x34, 0x2d,
-    0x1a, 0x47, 0x68, 0x43, 0x3e, 0x2c, 0x23, 0x30, 0x75, 0x9e, 0x43, 0x30,
-    0x36, 0x7a, 0x9e, 0x9e, 0x80, 0xad, 0xa3, 0x9e, 0x6a, 0x8a, 0x9e, 0x78,
-    0x95, 0x9e, 0xad, 0xad, 0xad, 0x8f, 0x80, 0x8f, 0x95, 0xa4, 0x6a, 0x4e,
-    0x30, 0x2d, 0x7a, 0x54, 0x3b, 0x23, 0x61, 0x7a, 0x8f, 0x8f, 0xa1, 0x61,
-    0x49, 0x3d, 0x6f, 0x6c, 0x3e, 0x2d, 0x54, 0x3e, 0x64, 0x3e, 0x23, 0x3e,
-    0x59, 0x3e, 0x2d, 0x3e, 0x3d, 0x25, 0x23, 0x2d, 0x3d, 0x6c, 0x2d, 0x54,
-    0x54, 0x54, 0x2d, 0x2d, 0x2d, 0x2d, 0x1a, 0x25, 0x73, 0x73, 0x3d, 0x67,
-    0x67, 0x31, 0x36, 0x25, 0x23, 0x64, 0x2d, 0x23, 0x64, 0x1b, 0x27, 0x50,
-    0x35, 0x0b, 0x1b, 0x15, 0x0b, 0x15, 0x0b, 0x06, 0x0c, 0x0c, 0x14, 0x07,
-    0x12, 0x15, 0x12, 0x07, 0x05, 0x12, 0x20, 0x04, 0x05, 0x04, 0x0b, 0x04,
-    0x04, 0x05, 0x06, 0x06, 0x04, 0x05, 0x05, 0x04, 0x03, 0x04, 0x07, 0x14,
-    0x2a, 0x1b, 0x07, 0x06, 0x04, 0x04, 0x04, 0x04, 0x01, 0x01, 0x01, 0x04,
-    0x04, 0x01, 0x01, 0x05, 0x01, 0x04, 0x04, 0x01, 0x01, 0x03, 0x01, 0x02,
-    0x02, 0x01, 0x01, 0x04, 0x01, 0x02, 0x07, 0x17, 0x01, 0x01, 0x02, 0x01,
-    0x01, 0x07, 0x2f, 0x22, 0x40, 0x40, 0x17, 0x22, 0x1e, 0x22, 0x40, 0x4d,
-    0x10, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
-    0x00, 0x02, 0x17, 0x04, 0x14, 0x58, 0x4f, 0x33, 0x33, 0x24, 0x01, 0x03,
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x7b, 0x93, 0x82, 0x82, 0x1d,
-    0x02, 0x01, 0x02, 0x01, 0x01, 0x4c, 0x50, 0x67, 0x04, 0x01, 0x01, 0x06,
-    0x49, 0x73, 0x53, 0x81, 0x87, 0x68, 0x3f, 0x81, 0x78, 0x49, 0x7d, 0x8a,
-    0x8f, 0x50, 0x30, 0x0c, 0x05, 0x23, 0x59, 0x83, 0x47, 0x96, 0x8a, 0x78,
-    0x9b, 0x81, 0x8f, 0x81, 0x96, 0xbc, 0xa4, 0x64, 0xc2, 0xae, 0xbd, 0x9b,
-    0x8f, 0xae, 0x83, 0x8c, 0xae, 0x7a, 0x6f, 0x8a, 0x9b, 0x7a, 0x94, 0x8a,
-    0x6a, 0x7a, 0x5e, 0x4b, 0x54, 0x49, 0x75, 0x6a, 0x36, 0x23, 0x26, 0x23,
-    0x30, 0x36, 0x49, 0x61, 0x6f, 0x36, 0x23, 0x30, 0x34, 0x59, 0x3d, 0x13,
-    0x2d, 0x1a, 0x1a, 0x6a, 0x80, 0x2d, 0x43, 0x3b, 0x36, 0x13, 0x1f, 0x1f,
-    0x36, 0x68, 0x30, 0x43, 0x47, 0x36, 0x3b, 0x59, 0x27, 0x27, 0x4e, 0x30,
-    0x43, 0x23, 0x16, 0x49, 0x8f, 0x83, 0x2d, 0x23, 0x27, 0x95, 0x95, 0x8f,
-    0xa3, 0xa3, 0xa4, 0x89, 0x83, 0x6f, 0x8f, 0xa3, 0x95, 0x8f, 0xad, 0xad,
-    0x9e, 0x9e, 0x8c, 0x6a, 0x7e, 0x59, 0x3b, 0x61, 0x49, 0x49, 0x3b, 0x26,
-    0x51, 0x2d, 0x36, 0x36, 0x49, 0x68, 0x7a, 0x68, 0x59, 0x36, 0x36, 0x54,
-    0x49, 0x5e, 0x5e, 0x3e, 0x54, 0x2d, 0x23, 0x4b, 0x2d, 0x2d, 0x2d, 0x3d,
-    0x36, 0x3d, 0x49, 0x2d, 0x3d, 0x5b, 0x49, 0x49, 0x5e, 0x54, 0x3d, 0x0e,
-    0x23, 0x23, 0x3d, 0x54, 0x76, 0x87, 0x5e, 0x50, 0x50, 0x1d, 0x15, 0x3d,
-    0x49, 0x43, 0x1e, 0x2a, 0x31, 0x15, 0x23, 0x23, 0x24, 0x06, 0x07, 0x49,
-    0x1b, 0x0c, 0x06, 0x0b, 0x06, 0x07, 0x0c, 0x0b, 0x07, 0x0b, 0x06, 0x10,
-    0x23, 0x20, 0x15, 0x03, 0x0b, 0x04, 0x05, 0x04, 0x01, 0x05, 0x04, 0x14,
-    0x06, 0x01, 0x01, 0x04, 0x04, 0x0b, 0x07, 0x1b, 0x09, 0x0c, 0x04, 0x06,
-    0x04, 0x04, 0x05, 0x01, 0x02, 0x01, 0x01, 0x06, 0x04, 0x03, 0x01, 0x02,
-    0x01, 0x03, 0x04, 0x03, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01,
-    0x01, 0x02, 0x01, 0x07, 0x01, 0x01, 0x01, 0x01, 0x07, 0x04, 0x0d, 0x2e,
-    0x40, 0x40, 0x2e, 0x3c, 0x22, 0x40, 0x3c, 0x52, 0x1e, 0x02, 0x01, 0x01,
-    0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x00, 0x07, 0x62, 0x22,
-    0x04, 0x2f, 0x4d, 0x4d, 0x17, 0x09, 0x02, 0x04, 0x01, 0x01, 0x01, 0x02,
-    0x01, 0x01, 0x33, 0x70, 0x72, 0x70, 0x67, 0x0b, 0x02, 0x01, 0x02, 0x02,
-    0x02, 0x31, 0x73, 0x73, 0x04, 0x01, 0x01, 0x05, 0x2d, 0x50, 0x64, 0x96,
-    0x96, 0x5b, 0x64, 0x6c, 0x50, 0x3d, 0x29, 0x81, 0x7d, 0x50, 0x5e, 0x23,
-    0x1c, 0x0b, 0x54, 0x86, 0x43, 0x86, 0x78, 0x96, 0x81, 0xa4, 0x8a, 0x78,
-    0x8f, 0x6f, 0xab, 0x76, 0xae, 0xae, 0xbd, 0xae, 0x75, 0x8f, 0xa1, 0x8f,
-    0xae, 0xa4, 0x83, 0xa1, 0xab, 0x75, 0x61, 0x6a, 0x64, 0x61, 0x6a, 0x71,
-    0x59, 0x4b, 0x4e, 0x61, 0x2d, 0x5c, 0x1f, 0x4b, 0x27, 0x3b, 0x36, 0x61,
-    0x68, 0x61, 0x4e, 0x4e, 0x54, 0x6a, 0x8f, 0x3b, 0x49, 0x47, 0x30, 0x61,
-    0x80, 0x23, 0x30, 0x1f, 0x30, 0x2d, 0x1a, 0x0f, 0x1d, 0x6a, 0x31, 0x4b,
-    0x3b, 0x26, 0x30, 0x36, 0x4e, 0x47, 0x36, 0x51, 0x59, 0x36, 0x1a, 0x49,
-    0x61, 0x27, 0x94, 0x59, 0x49, 0x49, 0x7a, 0x61, 0x8a, 0xa8, 0x8a, 0x83,
-    0x95, 0x7a, 0x8f, 0xa8, 0xa3, 0x95, 0xad, 0xad, 0x9b, 0x71, 0x68, 0x75,
-    0x54, 0x43, 0x6f, 0x68, 0x7a, 0x59, 0x47, 0x49, 0x4b, 0x1f, 0x6a, 0x47,
-    0x30, 0x8c, 0x68, 0x68, 0x3e, 0x2d, 0x36, 0x54, 0x64, 0x27, 0x51, 0x4e,
-    0x26, 0x36, 0x6c, 0x27, 0x27, 0x31, 0x27, 0x23, 0x49, 0x1a, 0x20, 0x27,
-    0x2d, 0x36, 0x3f, 0x2d, 0x2a, 0x54, 0x1b, 0x1f, 0x15, 0x1c, 0x23, 0x2d,
-    0x31, 0x5e, 0x50, 0x3e, 0x5b, 0x25, 0x23, 0x29, 0x3d, 0x67, 0x23, 0x13,
-    0x1b, 0x14, 0x15, 0x1b, 0x23, 0x04, 0x23, 0x42, 0x1a, 0x0b, 0x07, 0x04,
-    0x06, 0x06, 0x06, 0x0b, 0x06, 0x05, 0x0b, 0x1b, 0x24, 0x2a, 0x14, 0x01,
-    0x06, 0x0c, 0x01, 0x03, 0x04, 0x15, 0x20, 0x14, 0x07, 0x01, 0x01, 0x05,
-    0x05, 0x07, 0x14, 0x14, 0x03, 0x04, 0x07, 0x0c, 0x07, 0x04, 0x03, 0x01,
-    0x01, 0x03, 0x01, 0x04, 0x04, 0x17, 0x14, 0x02, 0x01, 0x01, 0x05, 0x01,
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01,
-    0x01, 0x02, 0x01, 0x03, 0x17, 0x10, 0x22, 0x17, 0x22, 0x09, 0x17, 0x40,
-    0x28, 0x1e, 0x22, 0x40, 0x17, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01,
-    0x01, 0x01, 0x00, 0x02, 0x00, 0x28, 0x58, 0x62, 0x01, 0x1e, 0x72, 0x82,
-    0x17, 0x14, 0x03, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x33, 0x5a,
-    0x33, 0x46, 0x67, 0x06, 0x02, 0x01, 0x00, 0x02, 0x01, 0x4c, 0x82, 0x7b,
-    0x04, 0x01, 0x01, 0x06, 0x64, 0x18, 0x31, 0x96, 0x96, 0x5b, 0x5b, 0x42,
-    0x73, 0x7d, 0x76, 0x7a, 0x49, 0x78, 0x6c, 0x18, 0x54, 0x04, 0x29, 0x9b,
-    0x75, 0x54, 0x6c, 0x3d, 0x6c, 0x68, 0x5b, 0x86, 0x7d, 0xae, 0x81, 0x3d,
-    0xae, 0xae, 0xbd, 0xae, 0xae, 0x8a, 0xae, 0x8f, 0x9b, 0xa4, 0x9b, 0xab,
-    0xb0, 0x8f, 0x75, 0x61, 0x94, 0x8c, 0x6f, 0x6f, 0xab, 0x5e, 0x77, 0x36,
-    0x71, 0x54, 0x2c, 0x1a, 0x1f, 0x1a, 0x1f, 0x54, 0x8c, 0x68, 0x83, 0x4e,
-    0x75, 0x7a, 0x80, 0x6f, 0x3e, 0x3b, 0x75, 0x6a, 0x9e, 0x49, 0x43, 0x4e,
-    0x26, 0x0c, 0x0e, 0x12, 0x1f, 0x30, 0x43, 0x36, 0x30, 0x26, 0x23, 0x2c,
-    0x68, 0x23, 0x23, 0x51, 0x30, 0x59, 0x5c, 0x27, 0x3b, 0x3e, 0x75, 0x6f,
-    0x59, 0x1f, 0x7a, 0x6a, 0x61, 0x68, 0x30, 0x75, 0x75, 0x43, 0x96, 0x8a,
-    0xa3, 0x95, 0xad, 0xad, 0x8a, 0x6f, 0x59, 0x4e, 0x43, 0x61, 0x75, 0x61,
-    0x6a, 0x61, 0x75, 0x47, 0x43, 0x59, 0x5e, 0x43, 0x54, 0x3d, 0x75, 0x6a,
-    0x59, 0x1f, 0x49, 0x6a, 0x2d, 0x27, 0x51, 0x49, 0x3e, 0x49, 0x76, 0x2d,
-    0x3d, 0x5e, 0x26, 0x1d, 0x5b, 0x1f, 0x1a, 0x23, 0x49, 0x1a, 0x49, 0x59,
-    0x50, 0x23, 0x1d, 0x25, 0x2d, 0x20, 0x1f, 0x13, 0x2d, 0x0f, 0x1d, 0x31,
-    0x25, 0x23, 0x2d, 0x23, 0x31, 0x3f, 0x25, 0x15, 0x13, 0x15, 0x15, 0x0c,
-    0x49, 0x14, 0x31, 0x18, 0x0c, 0x06, 0x07, 0x0b, 0x0b, 0x12, 0x0b, 0x06,
-    0x07, 0x07, 0x07, 0x29, 0x35, 0x07, 0x04, 0x14, 0x17, 0x0c, 0x01, 0x04,
-    0x04, 0x14, 0x0c, 0x04, 0x04, 0x01, 0x05, 0x07, 0x0c, 0x05, 0x09, 0x14,
-    0x04, 0x06, 0x0c, 0x09, 0x07, 0x02, 0x04, 0x01, 0x01, 0x01, 0x04, 0x03,
-    0x01, 0x04, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x07,
-    0x07, 0x09, 0x10, 0x04, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x09, 0x52, 0x2f, 0x2e, 0x52, 0x0d, 0x09, 0x0d, 0x22, 0x22, 0x2e, 0x28,
-    0x17, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02,
-    0x01, 0x4f, 0x62, 0x62, 0x07, 0x10, 0x82, 0x58, 0x0d, 0x04, 0x01, 0x01,
-    0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x46, 0x53, 0x67, 0x82, 0x93, 0x06,
-    0x01, 0x02, 0x01, 0x01, 0x01, 0x2a, 0x18, 0x4c, 0x05, 0x01, 0x02, 0x0c,
-    0x67, 0x31, 0x73, 0x31, 0x5b, 0x5b, 0x76, 0x49, 0x64, 0x86, 0x42, 0x29,
-    0x5b, 0x92, 0x49, 0x1b, 0x31, 0x1f, 0x2b, 0x86, 0xae, 0xa4, 0x54, 0x86,
-    0x54, 0xae, 0x8f, 0x75, 0xad, 0x8f, 0xae, 0x3e, 0x96, 0x9b, 0xbc, 0xae,
-    0xb4, 0xae, 0x9b, 0x8f, 0x84, 0x9b, 0x81, 0xbc, 0x73, 0x83, 0x86, 0x7e,
-    0x76, 0x75, 0x94, 0x54, 0x59, 0x7a, 0x51, 0x4b, 0x68, 0x9b, 0x54, 0x36,
-    0x23, 0x43, 0x49, 0x2d, 0x61, 0x47, 0x50, 0x2d, 0x61, 0x75, 0x29, 0x36,
-    0x1a, 0x23, 0x71, 0x81, 0xb4, 0x80, 0x89, 0x6f, 0x61, 0x2c, 0x0c, 0x0e,
-    0x0b, 0x49, 0x2d, 0x4e, 0x3b, 0x27, 0x3e, 0x30, 0x2d, 0x4e, 0x49, 0x47,
-    0x1f, 0x49, 0x71, 0x75, 0x3b, 0x1d, 0x1f, 0x26, 0x1a, 0x16, 0x2d, 0x23,
-    0x30, 0x9e, 0x8a, 0x43, 0x3d, 0x68, 0x68, 0x95, 0x78, 0xa8, 0xa3, 0xad,
-    0x95, 0xad, 0x9e, 0x9b, 0x80, 0x36, 0x61, 0x43, 0x3e, 0x59, 0x75, 0x75,
-    0x68, 0x6f, 0x61, 0x81, 0x6f, 0x4e, 0x5e, 0x3d, 0x6a, 0x54, 0x3b, 0x49,
-    0x6f, 0x4c, 0x47, 0x36, 0x50, 0x3e, 0x68, 0x49, 0x3d, 0x25, 0x20, 0x1d,
-    0x3d, 0x2d, 0x14, 0x1c, 0x5b, 0x2d, 0x54, 0x36, 0x35, 0x2d, 0x27, 0x27,
-    0x23, 0x1a, 0x49, 0x20, 0x13, 0x12, 0x2d, 0x27, 0x0c, 0x14, 0x13, 0x20,
-    0x23, 0x21, 0x14, 0x25, 0x12, 0x0b, 0x07, 0x0b, 0x10, 0x12, 0x12, 0x0b,
-    0x0e, 0x07, 0x0b, 0x06, 0x0b, 0x06, 0x04, 0x20, 0x0c, 0x0c, 0x14, 0x14,
-    0x2a, 0x14, 0x06, 0x28, 0x29, 0x10, 0x05, 0x0c, 0x03, 0x12, 0x01, 0x06,
-    0x04, 0x04, 0x04, 0x07, 0x06, 0x04, 0x04, 0x07, 0x07, 0x04, 0x06, 0x12,
-    0x03, 0x05, 0x01, 0x03, 0x01, 0x01, 0x04, 0x04, 0x06, 0x06, 0x04, 0x01,
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x07, 0x14, 0x22, 0x17, 0x09,
-    0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x0d, 0x2e, 0x2f, 0x2f, 0x2f,
-    0x28, 0x40, 0x28, 0x10, 0x04, 0x04, 0x01, 0x04, 0x01, 0x02, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x2e, 0x46, 0x2e,
-    0x28, 0x01, 0x4d, 0x46, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x01,
-    0x01, 0x06, 0x58, 0x63, 0x53, 0x66, 0x82, 0x05, 0x02, 0x01, 0x02, 0x02,
-    0x05, 0x67, 0x67, 0x42, 0x02, 0x01, 0x02, 0x1b, 0x5b, 0x64, 0x42, 0x5b,
-    0x87, 0x73, 0x42, 0x50, 0x3d, 0x6c, 0x86, 0x54, 0x6c, 0x86, 0x8f, 0x15,
-    0x3d, 0x34, 0x04, 0x64, 0x6c, 0x8f, 0x54, 0x68, 0xae, 0x8f, 0x8f, 0x86,
-    0xa4, 0x7d, 0x96, 0x49, 0xa3, 0x8f, 0xa1, 0x9b, 0xae, 0xae, 0xab, 0xbc,
-    0x6f, 0xa1, 0x7a, 0xae, 0xaf, 0x8f, 0x7a, 0x64, 0x71, 0x75, 0x6f, 0x47,
-    0x5e, 0x5e, 0x49, 0x36, 0x75, 0x95, 0x6a, 0x2d, 0x6a, 0x31, 0x59, 0x2d,
-    0x27, 0x4b, 0x27, 0x2d, 0x36, 0x54, 0x59, 0x26, 0x1f, 0x1f, 0x1a, 0x4e,
-    0xad, 0xa3, 0x54, 0x75, 0x6f, 0x26, 0x1d, 0x2d, 0x13, 0x6a, 0x16, 0x61,
-    0x36, 0x47, 0x49, 0x1d, 0x3b, 0x30, 0x36, 0x36, 0x1f, 0x1d, 0x30, 0x3d,
-    0x23, 0x61, 0x47, 0x1a, 0x15, 0x2d, 0x2c, 0x27, 0x36, 0x61, 0x80, 0x6a,
-    0x30, 0x4e, 0x75, 0x8a, 0x9e, 0xa3, 0xad, 0xad, 0x95, 0x8a, 0x8f, 0x9e,
-    0x68, 0x43, 0x8a, 0x54, 0x27, 0x61, 0x6a, 0x30, 0x59, 0x6f, 0x7a, 0x36,
-    0x4e, 0x3b, 0x4e, 0x47, 0x54, 0x4e, 0x35, 0x4b, 0x3d, 0x5e, 0x61, 0x68,
-    0x54, 0x49, 0x2d, 0x3d, 0x36, 0x3d, 0x23, 0x2b, 0x2d, 0x49, 0x36, 0x1a,
-    0x49, 0x31, 0x36, 0x35, 0x4e, 0x2d, 0x1a, 0x23, 0x3d, 0x36, 0x64, 0x3d,
-    0x1c, 0x1d, 0x27, 0x29, 0x23, 0x12, 0x1b, 0x36, 0x87, 0x3d, 0x25, 0x10,
-    0x11, 0x0b, 0x06, 0x1b, 0x0b, 0x0c, 0x06, 0x18, 0x0b, 0x0c, 0x07, 0x05,
-    0x04, 0x0c, 0x06, 0x10, 0x1b, 0x14, 0x10, 0x1e, 0x15, 0x07, 0x42, 0x46,
-    0x3a, 0x20, 0x06, 0x05, 0x03, 0x06, 0x04, 0x01, 0x01, 0x06, 0x12, 0x1b,
-    0x04, 0x0b, 0x04, 0x04, 0x05, 0x01, 0x07, 0x01, 0x04, 0x03, 0x03, 0x01,
-    0x01, 0x04, 0x04, 0x04, 0x06, 0x07, 0x17, 0x04, 0x05, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x09, 0x07, 0x14, 0x07, 0x07, 0x02, 0x02, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x17, 0x40, 0x40, 0x17, 0x2e, 0x2f, 0x17, 0x07, 0x17,
-    0x1e, 0x09, 0x06, 0x0d, 0x09, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01,
-    0x01, 0x00, 0x01, 0x00, 0x07, 0x10, 0x24, 0x58, 0x28, 0x01, 0x2e, 0x62,
-    0x01, 0x01, 0x01, 0x02, 0x05, 0x02, 0x01, 0x01, 0x01, 0x17, 0x66, 0x82,
-    0x82, 0x70, 0x67, 0x01, 0x01, 0x02, 0x01, 0x01, 0x04, 0x67, 0x93, 0x67,
-    0x01, 0x01, 0x01, 0x23, 0x87, 0x42, 0x50, 0x73, 0x96, 0x96, 0x93, 0x8a,
-    0x50, 0x42, 0x96, 0x67, 0x49, 0x73, 0x73, 0x1d, 0x4b, 0x04, 0x0c, 0x11,
-    0x0c, 0x0b, 0x0b, 0x76, 0x75, 0x64, 0x76, 0x8a, 0xae, 0x96, 0xa4, 0x5e,
-    0x8a, 0x9b, 0x8a, 0x73, 0x9b, 0xbc, 0xa4, 0xa4, 0x75, 0x75, 0x9b, 0x9b,
-    0xa4, 0x9e, 0x8a, 0x54, 0x6f, 0x9b, 0x9b, 0x76, 0x83, 0x7a, 0x85, 0x36,
-    0x8f, 0x8a, 0x54, 0x2d, 0x83, 0x54, 0x3e, 0x59, 0x3e, 0x43, 0x2d, 0x36,
-    0x1f, 0x36, 0x59, 0x2d, 0x1f, 0x1f, 0x1f, 0x6f, 0x95, 0x95, 0x6f, 0x80,
-    0x4e, 0x36, 0x6f, 0x27, 0x1f, 0x59, 0x13, 0x54, 0x4e, 0x59, 0x43, 0x47,
-    0x23, 0x3e, 0x36, 0x30, 0x23, 0x1f, 0x3b, 0x4e, 0x47, 0x6f, 0x54, 0x26,
-    0x27, 0x1a, 0x26, 0x3e, 0x49, 0x68, 0x71, 0x3e, 0x71, 0x2d, 0x7a, 0x59,
-    0x81, 0xad, 0xad, 0xad, 0x81, 0x7a, 0x78, 0x83, 0x31, 0x7a, 0x75, 0x75,
-    0x54, 0x54, 0x6f, 0x59, 0x4e, 0x23, 0x61, 0x49, 0x43, 0x5e, 0x54, 0x27,
-    0x2d, 0x2d, 0x47, 0x27, 0x59, 0x54, 0x36, 0x6f, 0x27, 0x4b, 0x49, 0x54,
-    0x49, 0x6c, 0x2d, 0x27, 0x23, 0x6c, 0x49, 0x23, 0x54, 0x3d, 0x25, 0x25,
-    0x6c, 0x3d, 0x0f, 0x20, 0x64, 0x23, 0x31, 0x64, 0x29, 0x50, 0x42, 0x3d,
-    0x31, 0x13, 0x15, 0x20, 0x67, 0x67, 0x0c, 0x15, 0x0c, 0x06, 0x0c, 0x1c,
-    0x14, 0x0b, 0x06, 0x15, 0x07, 0x0b, 0x1b, 0x08, 0x06, 0x29, 0x06, 0x0b,
-    0x07, 0x07, 0x1b, 0x3f, 0x12, 0x1b, 0x42, 0x28, 0x29, 0x14, 0x05, 0x04,
-    0x03, 0x04, 0x0b, 0x04, 0x03, 0x01, 0x04, 0x07, 0x07, 0x14, 0x09, 0x0c,
-    0x07, 0x04, 0x06, 0x04, 0x04, 0x01, 0x05, 0x01, 0x04, 0x04, 0x04, 0x09,
-    0x07, 0x07, 0x17, 0x07, 0x07, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x10,
-    0x09, 0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x17,
-    0x39, 0x40, 0x22, 0x2e, 0x19, 0x0d, 0x22, 0x3a, 0x07, 0x04, 0x17, 0x40,
-    0x3c, 0x0a, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01,
-    0x28, 0x28, 0x24, 0x3a, 0x58, 0x0a, 0x10, 0x58, 0x04, 0x01, 0x02, 0x02,
-    0x05, 0x02, 0x02, 0x01, 0x01, 0x46, 0x66, 0x63, 0x7b, 0x66, 0x46, 0x01,
-    0x02, 0x02, 0x02, 0x00, 0x07, 0x82, 0x70, 0x31, 0x01, 0x01, 0x02, 0x31,
-    0x73, 0x64, 0x50, 0x67, 0x87, 0x87, 0x87, 0x7b, 0x73, 0x35, 0x78, 0x64,
-    0x6f, 0x3d, 0x49, 0x1c, 0x06, 0x3d, 0x5b, 0x12, 0x3d, 0x21, 0x07, 0x8f,
-    0xa4, 0x81, 0x8a, 0x81, 0x8f, 0xae, 0xa4, 0x76, 0xa4, 0xae, 0xae, 0x5e,
-    0x8a, 0x9b, 0x8f, 0x96, 0x81, 0x75, 0xae, 0x8f, 0x8a, 0x8f, 0x83, 0x75,
-    0x71, 0x83, 0x61, 0x75, 0x7a, 0x6a, 0x47, 0x3e, 0x76, 0x68, 0x68, 0x43,
-    0x54, 0x59, 0x23, 0x71, 0x3e, 0x43, 0x2d, 0x1a, 0x23, 0x2d, 0x36, 0x43,
-    0x3b, 0x36, 0x4e, 0x1d, 0x8a, 0x81, 0x95, 0x47, 0x1a, 0x4e, 0x75, 0x1f,
-    0x27, 0x2d, 0x2c, 0x59, 0x3e, 0x3b, 0x23, 0x61, 0x7a, 0x2d, 0x4e, 0x47,
-    0x36, 0x2d, 0x2d, 0x30, 0x3e, 0x43, 0x23, 0x47, 0x6a, 0x26, 0x1a, 0x3e,
-    0x23, 0x36, 0x3b, 0x3e, 0x54, 0x59, 0x59, 0x75, 0x8f, 0x81, 0x8f, 0x8f,
-    0x59, 0x4e, 0x6f, 0x75, 0x59, 0x75, 0x59, 0x4e, 0x43, 0x49, 0x68, 0x59,
-    0x59, 0x3b, 0x36, 0x68, 0x75, 0x81, 0x5e, 0x1a, 0x1d, 0x1f, 0x36, 0x54,
-    0x43, 0x47, 0x3e, 0x49, 0x31, 0x49, 0x27, 0x36, 0x54, 0x31, 0x5b, 0x43,
-    0x3d, 0x23, 0x5b, 0x3e, 0x2d, 0x5e, 0x50, 0x5b, 0x76, 0x2d, 0x1a, 0x23,
-    0x3d, 0x27, 0x31, 0x86, 0x67, 0x73, 0x67, 0x3d, 0x23, 0x18, 0x0c, 0x20,
-    0x31, 0x50, 0x0c, 0x0c, 0x0b, 0x05, 0x0b, 0x12, 0x07, 0x12, 0x04, 0x0b,
-    0x0f, 0x15, 0x10, 0x06, 0x07, 0x1b, 0x0c, 0x12, 0x06, 0x04, 0x14, 0x14,
-    0x09, 0x1e, 0x24, 0x1b, 0x2a, 0x0c, 0x10, 0x07, 0x0b, 0x05, 0x06, 0x04,
-    0x01, 0x05, 0x01, 0x03, 0x06, 0x14, 0x07, 0x07, 0x0b, 0x03, 0x03, 0x04,
-    0x01, 0x03, 0x04, 0x01, 0x01, 0x03, 0x03, 0x22, 0x1e, 0x07, 0x09, 0x04,
-    0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x17, 0x09, 0x09, 0x09, 0x01,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x0d, 0x60, 0x22, 0x10, 0x19,
-    0x17, 0x40, 0x2e, 0x07, 0x01, 0x07, 0x2f, 0x2f, 0x2f, 0x0d, 0x01, 0x02,
-    0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x01, 0x3a, 0x52, 0x22, 0x33,
-    0x3c, 0x04, 0x04, 0x58, 0x07, 0x02, 0x01, 0x02, 0x05, 0x02, 0x01, 0x01,
-    0x01, 0x4f, 0x82, 0x82, 0x82, 0x7b, 0x35, 0x02, 0x01, 0x02, 0x02, 0x00,
-    0x33, 0x93, 0x67, 0x14, 0x01, 0x01, 0x01, 0x50, 0x7b, 0x86, 0x50, 0x53,
-    0x73, 0x7d, 0x64, 0x73, 0x7d, 0x2d, 0x64, 0x42, 0x50, 0x3f, 0x35, 0x05,
-    0x21, 0x3d, 0x7d, 0x31, 0x75, 0x18, 0x54, 0x7d, 0xa4, 0xae, 0xa4, 0x96,
-    0x9b, 0xa4, 0x64, 0x6c, 0xbc, 0xae, 0xbc, 0x75, 0x84, 0x75, 0x61, 0x7d,
-    0x7a, 0x49, 0xae, 0x9b, 0x68, 0x8a, 0x61, 0x83, 0x7a, 0x76, 0x76, 0x6f,
-    0x61, 0x5b, 0x47, 0x5e, 0x5e, 0x6f, 0x71, 0x3b, 0x2d, 0x61, 0x23, 0x59,
-    0x49, 0x59, 0x36, 0x2c, 0x3e, 0x1f, 0x26, 0x3e, 0x3d, 0x3e, 0x3e, 0x36,
-    0x75, 0x9e, 0xad, 0x3b, 0x13, 0x1f, 0x13, 0x1f, 0x49, 0x1f, 0x23, 0x47,
-    0x54, 0x30, 0x23, 0x7a, 0xad, 0x59, 0x36, 0x5e, 0x26, 0x3e, 0x36, 0x2c,
-    0x1f, 0x1d, 0x51, 0x1f, 0x59, 0x4b, 0x23, 0x30, 0x54, 0x2d, 0x2d, 0x61,
-    0x49, 0x59, 0x4e, 0x59, 0x8f, 0x68, 0x68, 0x7a, 0x61, 0x4e, 0x2d, 0x95,
-    0x8f, 0x75, 0x6f, 0x68, 0x3b, 0x47, 0x54, 0x43, 0x75, 0x59, 0x4e, 0x29,
-    0x54, 0x6f, 0x54, 0x1d, 0x36, 0x2d, 0x23, 0x2d, 0x36, 0x54, 0x49, 0x4e,
-    0x36, 0x2d, 0x23, 0x1d, 0x2d, 0x2d, 0x5e, 0x54, 0x54, 0x5e, 0x5b, 0x36,
-    0x2d, 0x54, 0x64, 0x64, 0x50, 0x54, 0x49, 0x23, 0x23, 0x54, 0x1b, 0x86,
-    0x73, 0x5b, 0x5b, 0x5b, 0x27, 0x15, 0x05, 0x29, 0x64, 0x54, 0x12, 0x3d,
-    0x07, 0x0b, 0x14, 0x15, 0x12, 0x12, 0x06, 0x06, 0x15, 0x0c, 0x13, 0x07,
-    0x0f, 0x07, 0x12, 0x12, 0x06, 0x04, 0x0c, 0x05, 0x14, 0x2a, 0x35, 0x07,
-    0x14, 0x1b, 0x14, 0x12, 0x06, 0x03, 0x06, 0x03, 0x01, 0x0c, 0x07, 0x03,
-    0x04, 0x06, 0x04, 0x03, 0x03, 0x04, 0x05, 0x04, 0x01, 0x05, 0x04, 0x01,
-    0x03, 0x01, 0x01, 0x04, 0x09, 0x0c, 0x04, 0x01, 0x02, 0x02, 0x01, 0x10,
-    0x0d, 0x01, 0x00, 0x07, 0x09, 0x17, 0x09, 0x04, 0x02, 0x02, 0x01, 0x01,
-    0x02, 0x01, 0x02, 0x07, 0x2f, 0x09, 0x0d, 0x2f, 0x2e, 0x22, 0x09, 0x04,
-    0x01, 0x22, 0x52, 0x3c, 0x22, 0x17, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01,
-    0x00, 0x00, 0x00, 0x02, 0x33, 0x52, 0x2e, 0x62, 0x4d, 0x10, 0x01, 0x66,
-    0x07, 0x01, 0x00, 0x00, 0x03, 0x02, 0x01, 0x02, 0x04, 0x42, 0x72, 0x93,
-    0x82, 0x82, 0x24, 0x02, 0x02, 0x01, 0x02, 0x01, 0x42, 0x7b, 0x5b, 0x04,
-    0x01, 0x02, 0x06, 0x73, 0x87, 0x7b, 0x3d, 0x31, 0x64, 0x70, 0x67, 0x50,
-    0x7d, 0x2d, 0x31, 0x73, 0x78, 0x49, 0x13, 0x0c, 0x13, 0x3d, 0x75, 0x7d,
-    0x49, 0x27, 0x64, 0x96, 0x81, 0xbc, 0x96, 0x96, 0xae, 0x6c, 0x75, 0x6c,
-    0xbc, 0xbc, 0xae, 0x8a, 0x76, 0x69, 0x5e, 0x54, 0x54, 0x5e, 0xae, 0x8a,
-    0x3d, 0x5e, 0x54, 0x75, 0x61, 0x6c, 0x54, 0x5e, 0x49, 0x75, 0x36, 0x6a,
-    0x6a, 0x61, 0x61, 0x3e, 0x3d, 0x75, 0x4b, 0x47, 0x61, 0x47, 0x27, 0x36,
-    0x3e, 0x27, 0x2c, 0x23, 0x3e, 0x3d, 0x68, 0x43, 0x2d, 0x75, 0xa4, 0x80,
-    0x4e, 0x13, 0x2c, 0x3d, 0x26, 0x1a, 0x12, 0x1f, 0x68, 0x3b, 0x30, 0x83,
-    0x9e, 0x36, 0x49, 0x5e, 0x2d, 0x61, 0x83, 0x3b, 0x2d, 0x16, 0x47, 0x30,
-    0x30, 0x1f, 0x1a, 0x1a, 0x36, 0x26, 0x1d, 0x6a, 0x3d, 0x47, 0x30, 0x36,
-    0x8c, 0x8a, 0x83, 0x61, 0x54, 0x43, 0x1d, 0x7a, 0x9e, 0x75, 0x81, 0x75,
-    0x43, 0x3e, 0x3d, 0x43, 0x6f, 0x59, 0x54, 0x3e, 0x54, 0x61, 0x1f, 0x1d,
-    0x2d, 0x3e, 0x54, 0x4b, 0x23, 0x3e, 0x49, 0x49, 0x23, 0x3d, 0x3e, 0x14,
-    0x3e, 0x3e, 0x36, 0x49, 0x50, 0x6c, 0x5e, 0x27, 0x23, 0x5e, 0x54, 0x54,
-    0x2d, 0x3d, 0x64, 0x1f, 0x23, 0x6c, 0x1d, 0x6c, 0x7b, 0x5b, 0x27, 0x31,
-    0x2a, 0x15, 0x1b, 0x2a, 0x3d, 0x67, 0x3d, 0x50, 0x23, 0x1a, 0x2b, 0x07,
-    0x15, 0x0c, 0x06, 0x0b, 0x12, 0x06, 0x13, 0x06, 0x14, 0x06, 0x06, 0x06,
-    0x04, 0x06, 0x05, 0x05, 0x06, 0x07, 0x14, 0x12, 0x20, 0x12, 0x0c, 0x07,
-    0x06, 0x05, 0x04, 0x03, 0x07, 0x07, 0x10, 0x04, 0x0a, 0x04, 0x03, 0x01,
-    0x01, 0x01, 0x01, 0x04, 0x04, 0x04, 0x04, 0x01, 0x04, 0x04, 0x03, 0x07,
-    0x04, 0x07, 0x01, 0x01, 0x00, 0x02, 0x01, 0x10, 0x06, 0x06, 0x01, 0x01,
-    0x04, 0x17, 0x09, 0x10, 0x00, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x0a,
-    0x07, 0x22, 0x17, 0x2f, 0x22, 0x0d, 0x01, 0x01, 0x04, 0x2f, 0x52, 0x3c,
-    0x52, 0x22, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x01,
-    0x3a, 0x72, 0x28, 0x62, 0x60, 0x3a, 0x01, 0x1e, 0x07, 0x01, 0x02, 0x01,
-    0x03, 0x01, 0x01, 0x01, 0x2a, 0x3f, 0x4f, 0x82, 0x7b, 0x72, 0x1e, 0x02,
-    0x01, 0x02, 0x02, 0x02, 0x3f, 0x82, 0x42, 0x01, 0x01, 0x01, 0x3d, 0x93,
-    0x67, 0x87, 0x29, 0x25, 0x67, 0x96, 0x7b, 0x7b, 0x64, 0x7d, 0x3d, 0x20,
-    0x31, 0x18, 0x05, 0x15, 0x0b, 0x25, 0x81, 0x8a, 0x21, 0x13, 0x3d, 0xa4,
-    0x73, 0xae, 0xa4, 0x9b, 0x7d, 0x75, 0x96, 0x8a, 0x9f, 0xbc, 0xae, 0xa4,
-    0x86, 0x6f, 0x69, 0x76, 0x54, 0x5c, 0x81, 0x6c, 0x69, 0x36, 0x5e, 0x61,
-    0x5e, 0x5e, 0x49, 0x54, 0x71, 0x6a, 0x55, 0x54, 0x4e, 0x75, 0x61, 0x73,
-    0x7a, 0x7a, 0x6f, 0x43, 0x61, 0x4e, 0x3d, 0x26, 0x23, 0x30, 0x4b, 0x3e,
-    0x2d, 0x6f, 0x81, 0x49, 0x3b, 0x31, 0x7a, 0x95, 0x68, 0x31, 0x2d, 0x26,
-    0x27, 0x2d, 0x23, 0x36, 0x54, 0x36, 0x2d, 0x59, 0x59, 0x3b, 0x54, 0x59,
-    0x30, 0x36, 0x59, 0x30, 0x59, 0x36, 0x61, 0x30, 0x23, 0x47, 0x3b, 0x1f,
-    0x36, 0x2d, 0x1f, 0x4e, 0x43, 0x43, 0x47, 0x36, 0x30, 0x8a, 0x83, 0x68,
-    0x47, 0x27, 0x61, 0x78, 0x8f, 0x7a, 0x59, 0x75, 0x3b, 0x43, 0x36, 0x3d,
-    0x47, 0x59, 0x6f, 0x31, 0x36, 0x49, 0x1f, 0x26, 0x2d, 0x4b, 0x2d, 0x2d,
-    0x31, 0x3d, 0x49, 0x27, 0x2a, 0x54, 0x3e, 0x3e, 0x2d, 0x2d, 0x27, 0x42,
-    0x54, 0x31, 0x36, 0x27, 0x36, 0x49, 0x5e, 0x49, 0x49, 0x27, 0x54, 0x27,
-    0x49, 0x7d, 0x2d, 0x3d, 0x73, 0x3d, 0x31, 0x64, 0x29, 0x31, 0x64, 0x73,
-    0x31, 0x42, 0x31, 0x1b, 0x23, 0x1d, 0x1b, 0x1d, 0x23, 0x0f, 0x12, 0x12,
-    0x20, 0x0c, 0x0c, 0x06, 0x20, 0x0f, 0x06, 0x04, 0x07, 0x0a, 0x04, 0x05,
-    0x01, 0x03, 0x10, 0x1b, 0x1b, 0x10, 0x10, 0x04, 0x07, 0x04, 0x07, 0x04,
-    0x06, 0x04, 0x05, 0x03, 0x01, 0x03, 0x03, 0x05, 0x01, 0x03, 0x01, 0x04,
-    0x04, 0x04, 0x01, 0x01, 0x07, 0x04, 0x09, 0x09, 0x07, 0x04, 0x01, 0x02,
-    0x01, 0x01, 0x01, 0x07, 0x01, 0x04, 0x0a, 0x00, 0x01, 0x07, 0x17, 0x10,
-    0x00, 0x02, 0x02, 0x01, 0x01, 0x02, 0x00, 0x0a, 0x22, 0x40, 0x19, 0x04,
-    0x04, 0x01, 0x02, 0x02, 0x10, 0x22, 0x52, 0x40, 0x60, 0x17, 0x01, 0x01,
-    0x02, 0x01, 0x02, 0x01, 0x01, 0x00, 0x02, 0x01, 0x58, 0x72, 0x33, 0x72,
-    0x72, 0x4d, 0x01, 0x01, 0x05, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x66, 0x67, 0x4f, 0x3f, 0x66, 0x82, 0x1e, 0x01, 0x01, 0x02, 0x01, 0x02,
-    0x70, 0x93, 0x10, 0x01, 0x02, 0x01, 0x67, 0x82, 0x67, 0x42, 0x3d, 0x35,
-    0x5b, 0x93, 0x87, 0x50, 0x7b, 0xa4, 0x29, 0x2a, 0x6c, 0x23, 0x05, 0x07,
-    0x12, 0x15, 0x23, 0x1a, 0x10, 0x29, 0x50, 0x86, 0x86, 0x6f, 0x96, 0x54,
-    0x64, 0xa4, 0xa4, 0xae, 0x50, 0xbc, 0xae, 0xa4, 0x8f, 0x68, 0x5e, 0x76,
-    0x5e, 0x68, 0x54, 0x73, 0x69, 0x54, 0x61, 0x78, 0x76, 0x5e, 0x6a, 0x49,
-    0x6c, 0x54, 0x6f, 0x54, 0x36, 0x3d, 0x59, 0x9b, 0x8f, 0x61, 0x6f, 0x68,
-    0x54, 0x54, 0x4e, 0x30, 0x13, 0x1f, 0x47, 0x3e, 0x1a, 0x43, 0x9e, 0x83,
-    0x4e, 0x61, 0x80, 0xae, 0x8a, 0x59, 0x47, 0x0f, 0x49, 0x47, 0x27, 0x61,
-    0x54, 0x47, 0x49, 0x68, 0x51, 0x61, 0x81, 0x23, 0x36, 0x1d, 0x2c, 0x1d,
-    0x61, 0xad, 0x9b, 0x49, 0x68, 0x8a, 0x3b, 0x1a, 0x47, 0x61, 0x30, 0x49,
-    0x5e, 0x68, 0x8a, 0x49, 0x27, 0x8f, 0x78, 0x7a, 0x68, 0x4e, 0x83, 0x78,
-    0x8f, 0x95, 0x6f, 0x5b, 0x3d, 0x4b, 0x3d, 0x2d, 0x2d, 0x43, 0x3b, 0x2d,
-    0x2d, 0x3d, 0x3b, 0x2d, 0x49, 0x47, 0x27, 0x1a, 0x77, 0x36, 0x2d, 0x23,
-    0x27, 0x23, 0x20, 0x1d, 0x54, 0x29, 0x3d, 0x1a, 0x23, 0x3e, 0x76, 0x4b,
-    0x50, 0x23, 0x54, 0x31, 0x3e, 0x3d, 0x31, 0x23, 0x31, 0x7d, 0x3d, 0x24,
-    0x3d, 0x50, 0x49, 0x50, 0x23, 0x2b, 0x53, 0x87, 0x67, 0x53, 0x27, 0x29,
-    0x16, 0x1d, 0x14, 0x14, 0x20, 0x18, 0x0c, 0x12, 0x12, 0x0b, 0x06, 0x06,
-    0x0f, 0x0c, 0x06, 0x04, 0x1b, 0x0c, 0x03, 0x07, 0x07, 0x07, 0x14, 0x12,
-    0x0c, 0x0c, 0x06, 0x06, 0x04, 0x06, 0x06, 0x04, 0x04, 0x04, 0x04, 0x02,
-    0x05, 0x06, 0x04, 0x04, 0x01, 0x12, 0x03, 0x04, 0x04, 0x02, 0x01, 0x02,
-    0x04, 0x04, 0x09, 0x10, 0x04, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x07,
-    0x07, 0x04, 0x06, 0x01, 0x02, 0x04, 0x0d, 0x07, 0x00, 0x01, 0x02, 0x01,
-    0x01, 0x02, 0x01, 0x10, 0x22, 0x0d, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x04, 0x09, 0x40, 0x40, 0x4d, 0x22, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02,
-    0x01, 0x00, 0x00, 0x0d, 0x58, 0x60, 0x46, 0x40, 0x22, 0x2f, 0x0d, 0x01,
-    0x01, 0x01, 0x02, 0x03, 0x01, 0x01, 0x02, 0x06, 0x4d, 0x66, 0x3f, 0x46,
-    0x42, 0x63, 0x0c, 0x02, 0x01, 0x01, 0x01, 0x01, 0x93, 0x5a, 0x01, 0x02,
-    0x02, 0x06, 0x87, 0x82, 0x64, 0x42, 0x3d, 0x3d, 0x50, 0x5b, 0x64, 0x29,
-    0x7d, 0x29, 0x78, 0x5b, 0x50, 0x31, 0x0b, 0x0f, 0x49, 0x3d, 0x1b, 0x54,
-    0x76, 0x5b, 0x5b, 0x6c, 0x96, 0x8a, 0x86, 0x3d, 0xa4, 0xa4, 0xae, 0xa4,
-    0x53, 0xae, 0xbc, 0xae, 0x8a, 0x59, 0x69, 0x5e, 0x81, 0x7a, 0x76, 0x8f,
-    0x75, 0x8a, 0x7a, 0xa1, 0x64, 0x76, 0x6f, 0x5e, 0x5b, 0x36, 0x47, 0x77,
-    0x3e, 0x8a, 0x95, 0x8f, 0x81, 0x47, 0x3d, 0x77, 0x9e, 0x95, 0x75, 0x2d,
-    0x61, 0x23, 0x59, 0x3b, 0x1a, 0x26, 0x80, 0x30, 0x30, 0x4e, 0x27, 0x7a,
-    0x68, 0x80, 0x30, 0x6f, 0x59, 0x31, 0x61, 0x75, 0x43, 0x36, 0x54, 0x6f,
-    0x43, 0x61, 0x4e, 0x26, 0x2c, 0x3d, 0x3e, 0x26, 0x47, 0x59, 0x8c, 0x2d,
-    0x68, 0x42, 0x34, 0x15, 0x3d, 0x64, 0x4e, 0x61, 0x30, 0x59, 0x7a, 0x36,
-    0x47, 0x68, 0x83, 0x4e, 0x36, 0x4e, 0x2d, 0x6f, 0x81, 0x95, 0x68, 0x61,
-    0x59, 0x49, 0x59, 0x36, 0x3b, 0x4b, 0x47, 0x1a, 0x1f, 0x64, 0x54, 0x36,
-    0x3d, 0x49, 0x3e, 0x26, 0x54, 0x3d, 0x3e, 0x23, 0x26, 0x49, 0x50, 0x1c,
-    0x27, 0x36, 0x2d, 0x1d, 0x4b, 0x5b, 0x50, 0x50, 0x73, 0x50, 0x15, 0x31,
-    0x2b, 0x23, 0x3e, 0x1b, 0x23, 0x5b, 0x54, 0x3d, 0x53, 0x2a, 0x3d, 0x31,
-    0x31, 0x18, 0x53, 0x7b, 0x50, 0x1e, 0x3d, 0x54, 0x20, 0x20, 0x0c, 0x20,
-    0x12, 0x35, 0x0c, 0x07, 0x15, 0x06, 0x06, 0x15, 0x10, 0x0b, 0x04, 0x04,
-    0x14, 0x07, 0x15, 0x20, 0x0f, 0x06, 0x0c, 0x06, 0x04, 0x07, 0x04, 0x04,
-    0x03, 0x04, 0x03, 0x01, 0x03, 0x04, 0x04, 0x04, 0x04, 0x07, 0x07, 0x04,
-    0x15, 0x04, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x04, 0x1e, 0x0a,
-    0x01, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x07, 0x17, 0x09, 0x17, 0x22, 0x10,
-    0x02, 0x03, 0x07, 0x06, 0x00, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x04,
-    0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x04, 0x02, 0x10, 0x52, 0x52, 0x2f,
-    0x1e, 0x17, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x22,
-    0x3c, 0x2f, 0x28, 0x1e, 0x3c, 0x72, 0x46, 0x01, 0x04, 0x02, 0x02, 0x03,
-    0x02, 0x01, 0x01, 0x09, 0x66, 0x58, 0x33, 0x46, 0x70, 0x46, 0x06, 0x01,
-    0x01, 0x01, 0x01, 0x04, 0x93, 0x2a, 0x02, 0x01, 0x02, 0x14, 0x82, 0x7b,
-    0x70, 0x67, 0x31, 0x3f, 0x31, 0x23, 0x27, 0x3d, 0x14, 0x64, 0x67, 0x50,
-    0x5b, 0x6c, 0x04, 0x20, 0x54, 0x2a, 0x27, 0x54, 0x54, 0x29, 0x6c, 0x5e,
-    0x67, 0x9f, 0x92, 0x5e, 0xa4, 0x96, 0xbc, 0x96, 0xa4, 0x8f, 0xbd, 0x76,
-    0x6c, 0x76, 0x6c, 0x59, 0x5e, 0x83, 0x81, 0x7a, 0x81, 0xbc, 0xad, 0x78,
-    0x5e, 0x76, 0x6f, 0x8f, 0x6a, 0x3d, 0x2d, 0x2d, 0x59, 0x9b, 0x83, 0x8a,
-    0x8a, 0x54, 0x2d, 0x6f, 0x8f, 0x75, 0x6f, 0x2d, 0x4e, 0x59, 0x2d, 0x4e,
-    0x36, 0x2d, 0x30, 0x2d, 0x59, 0x6a, 0x47, 0x36, 0x36, 0x4e, 0x59, 0x68,
-    0x3b, 0x36, 0x47, 0x2d, 0x1f, 0x3e, 0x31, 0x4e, 0x2d, 0x2d, 0x68, 0x6a,
-    0x26, 0x2d, 0x36, 0x1a, 0x27, 0x6a, 0x23, 0x23, 0x26, 0x59, 0x1f, 0x59,
-    0x8c, 0x7a, 0x54, 0x49, 0x59, 0x6f, 0x83, 0x36, 0x47, 0x59, 0x4e, 0x6a,
-    0x3d, 0x27, 0x6a, 0x75, 0x7a, 0x64, 0x3b, 0x6f, 0x31, 0x49, 0x4e, 0x2d,
-    0x6c, 0x31, 0x30, 0x23, 0x1d, 0x83, 0x49, 0x27, 0x49, 0x23, 0x27, 0x15,
-    0x2d, 0x51, 0x5b, 0x54, 0x20, 0x31, 0x49, 0x1d, 0x36, 0x3d, 0x54, 0x3d,
-    0x2d, 0x31, 0x49, 0x5b, 0x49, 0x27, 0x20, 0x3d, 0x23, 0x23, 0x1a, 0x50,
-    0x29, 0x73, 0x18, 0x3f, 0x53, 0x1b, 0x2a, 0x23, 0x1d, 0x3d, 0x73, 0x3d,
-    0x2a, 0x1e, 0x29, 0x25, 0x56, 0x15, 0x1a, 0x20, 0x31, 0x13, 0x07, 0x07,
-    0x07, 0x0b, 0x0b, 0x0c, 0x12, 0x05, 0x0b, 0x06, 0x06, 0x0c, 0x04, 0x07,
-    0x07, 0x07, 0x07, 0x05, 0x04, 0x05, 0x01, 0x04, 0x04, 0x04, 0x06, 0x03,
-    0x04, 0x04, 0x04, 0x0c, 0x07, 0x07, 0x04, 0x04, 0x04, 0x01, 0x04, 0x05,
-    0x01, 0x04, 0x03, 0x01, 0x01, 0x06, 0x0d, 0x01, 0x01, 0x02, 0x03, 0x04,
-    0x19, 0x04, 0x04, 0x09, 0x01, 0x0c, 0x09, 0x0d, 0x02, 0x01, 0x07, 0x04,
-};
@@ -0,0 +1,451 @@
+//*****************************************************************************
+//
+// compositor.c - Damage tracking display compositor.
+//
+// The compositor is a grlib display that sits between the widgets and the
+// display driver.  A panel is painted back to front: the panel canvas fills
+// its whole area, a child canvas may fill it again, and the children draw
+// over both, so many pixels used to be written two or three times.
+//
+// The compositor holds rectangle fills back instead of drawing them.  Each
+// drawing operation that follows, a fill included, covers a rectangle of
+// the display completely, so the part of any pending fill under it would
+// only be drawn over.  That part is cut away: a pending fill that is covered
+// entirely is dropped, and one that is covered in part is cut into up to
+// four smaller fills around the covered rectangle, when that saves more
+// pixels than the extra fills cost.  When it does not, as for a run of text
+// across a fill, the pending fill is drawn first.  A new fill is merged with
+// any pending fill of the same color that it extends into a larger
+// rectangle.  The pending fills never overlap, so they can be drawn in any
+// order; CompositorFlush() draws them at the end of each widget task pass.
+//
+// Code that draws on the display directly, bypassing grlib, must call
+// CompositorRectDraw() first, so that no pending fill is drawn over it later,
+// or CompositorRectBlend() if it leaves pixels of the rectangle as they are.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup compositor_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "grlib/grlib.h"
+#include "defines.h"
+#include "compositor.h"
+
+//*****************************************************************************
+//
+// A fill that has not been drawn yet.
+//
+//*****************************************************************************
+typedef struct
+{
+    tRectangle sRect;
+    uint32_t ui32Value;
+}
+tCompositorFill;
+
+//*****************************************************************************
+//
+// The pending fills and the display they are drawn on.
+//
+//*****************************************************************************
+static tCompositorFill g_psCompositorFills[COMPOSITOR_MAX_FILLS];
+static uint32_t g_ui32CompositorFills;
+static const tDisplay *g_psCompositorTarget;
+
+//*****************************************************************************
+//
+// Returns the number of pixels in a rectangle.
+//
+//*****************************************************************************
+static int32_t
+CompositorArea(const tRectangle *psRect)
+{
+    return((psRect->i16XMax - psRect->i16XMin + 1) *
+           (psRect->i16YMax - psRect->i16YMin + 1));
+}
+
+//*****************************************************************************
+//
+// Draws a pending fill and removes it from the list.
+//
+//*****************************************************************************
+static void
+CompositorFillDraw(uint32_t ui32Fill)
+{
+    DpyRectFill(g_psCompositorTarget, &g_psCompositorFills[ui32Fill].sRect,
+                g_psCompositorFills[ui32Fill].ui32Value);
+    g_psCompositorFills[ui32Fill] =
+        g_psCompositorFills[--g_ui32CompositorFills];
+}
+
+//*****************************************************************************
+//
+// Cuts the parts of the pending fills that lie under a rectangle about to be
+// drawn over, or draws the fills that are not worth cutting.
+//
+//*****************************************************************************
+static void
+CompositorCover(const tRectangle *psRect)
+{
+    tRectangle psPiece[4], sOverlap, sFill;
+    uint32_t ui32Fill, ui32Pieces, ui32Piece;
+
+    for(ui32Fill = 0; ui32Fill < g_ui32CompositorFills; )
+    {
+        sFill = g_psCompositorFills[ui32Fill].sRect;
+        if(!GrRectIntersectGet(&sFill, (tRectangle *)psRect, &sOverlap))
+        {
+            ui32Fill++;
+            continue;
+        }
+
+        //
+        // The parts of the fill above and below the rectangle, and to its
+        // left and right.
+        //
+        ui32Pieces = 0;
+        if(sFill.i16YMin < sOverlap.i16YMin)
+        {
+            psPiece[ui32Pieces] = sFill;
+            psPiece[ui32Pieces++].i16YMax = sOverlap.i16YMin - 1;
+        }
+        if(sFill.i16YMax > sOverlap.i16YMax)
+        {
+            psPiece[ui32Pieces] = sFill;
+            psPiece[ui32Pieces++].i16YMin = sOverlap.i16YMax + 1;
+        }
+        if(sFill.i16XMin < sOverlap.i16XMin)
+        {
+            psPiece[ui32Pieces] = sOverlap;
+            psPiece[ui32Pieces].i16XMin = sFill.i16XMin;
+            psPiece[ui32Pieces++].i16XMax = sOverlap.i16XMin - 1;
+        }
+        if(sFill.i16XMax > sOverlap.i16XMax)
+        {
+            psPiece[ui32Pieces] = sOverlap;
+            psPiece[ui32Pieces].i16XMin = sOverlap.i16XMax + 1;
+            psPiece[ui32Pieces++].i16XMax = sFill.i16XMax;
+        }
+
+        //
+        // Drop the fill if it is covered entirely.
+        //
+        if(ui32Pieces == 0)
+        {
+            g_psCompositorFills[ui32Fill] =
+                g_psCompositorFills[--g_ui32CompositorFills];
+            continue;
+        }
+
+        //
+        // Draw the fill as it is if cutting it does not pay or the pieces do
+        // not fit in the list.
+        //
+        if((CompositorArea(&sOverlap) <=
+            (int32_t)((ui32Pieces - 1) * COMPOSITOR_FILL_COST)) ||
+           ((g_ui32CompositorFills + ui32Pieces - 1) > COMPOSITOR_MAX_FILLS))
+        {
+            CompositorFillDraw(ui32Fill);
+            continue;
+        }
+
+        //
+        // Replace the fill by its pieces, none of which overlaps the
+        // rectangle, so they need not be looked at again.
+        //
+        g_psCompositorFills[ui32Fill].sRect = psPiece[0];
+        for(ui32Piece = 1; ui32Piece < ui32Pieces; ui32Piece++)
+        {
+            g_psCompositorFills[g_ui32CompositorFills] =
+                g_psCompositorFills[ui32Fill];
+            g_psCompositorFills[g_ui32CompositorFills++].sRect =
+                psPiece[ui32Piece];
+        }
+        ui32Fill++;
+    }
+}
+
+//*****************************************************************************
+//
+// Adds a fill to the pending fills, merging it with any pending fill of the
+// same color that it extends into a larger rectangle.
+//
+//*****************************************************************************
+static void
+CompositorFillAdd(const tRectangle *psRect, uint32_t ui32Value)
+{
+    tRectangle sRect, *psFill;
+    uint32_t ui32Fill;
+
+    sRect = *psRect;
+    CompositorCover(&sRect);
+
+    for(ui32Fill = 0; ui32Fill < g_ui32CompositorFills; )
+    {
+        psFill = &g_psCompositorFills[ui32Fill].sRect;
+        if((g_psCompositorFills[ui32Fill].ui32Value != ui32Value) ||
+           !(((psFill->i16XMin == sRect.i16XMin) &&
+              (psFill->i16XMax == sRect.i16XMax) &&
+              ((psFill->i16YMax + 1) >= sRect.i16YMin) &&
+              (psFill->i16YMin <= (sRect.i16YMax + 1))) ||
+             ((psFill->i16YMin == sRect.i16YMin) &&
+              (psFill->i16YMax == sRect.i16YMax) &&
+              ((psFill->i16XMax + 1) >= sRect.i16XMin) &&
+              (psFill->i16XMin <= (sRect.i16XMax + 1)))))
+        {
+            ui32Fill++;
+            continue;
+        }
+
+        //
+        // Take the pending fill into the new one and start over, since the
+        // larger fill may now line up with another.
+        //
+        if(psFill->i16XMin < sRect.i16XMin)
+        {
+            sRect.i16XMin = psFill->i16XMin;
+        }
+        if(psFill->i16XMax > sRect.i16XMax)
+        {
+            sRect.i16XMax = psFill->i16XMax;
+        }
+        if(psFill->i16YMin < sRect.i16YMin)
+        {
+            sRect.i16YMin = psFill->i16YMin;
+        }
+        if(psFill->i16YMax > sRect.i16YMax)
+        {
+            sRect.i16YMax = psFill->i16YMax;
+        }
+        g_psCompositorFills[ui32Fill] =
+            g_psCompositorFills[--g_ui32CompositorFills];
+        ui32Fill = 0;
+    }
+
+    if(g_ui32CompositorFills == COMPOSITOR_MAX_FILLS)
+    {
+        DpyRectFill(g_psCompositorTarget, &sRect, ui32Value);
+        return;
+    }
+
+    g_psCompositorFills[g_ui32CompositorFills].sRect = sRect;
+    g_psCompositorFills[g_ui32CompositorFills++].ui32Value = ui32Value;
+}
+
+//*****************************************************************************
+//
+// The grlib display functions of the compositor.  All but the rectangle fill
+// cut their rectangle out of the pending fills and pass the drawing on.
+//
+//*****************************************************************************
+static void
+CompositorPixelDraw(void *pvDisplayData, int32_t i32X, int32_t i32Y,
+                    uint32_t ui32Value)
+{
+    tRectangle sRect;
+
+    sRect.i16XMin = sRect.i16XMax = i32X;
+    sRect.i16YMin = sRect.i16YMax = i32Y;
+    CompositorCover(&sRect);
+    DpyPixelDraw(g_psCompositorTarget, i32X, i32Y, ui32Value);
+}
+
+static void
+CompositorPixelDrawMultiple(void *pvDisplayData, int32_t i32X, int32_t i32Y,
+                            int32_t i32X0, int32_t i32Count, int32_t i32BPP,
+                            const uint8_t *pui8Data,
+                            const uint8_t *pui8Palette)
+{
+    tRectangle sRect;
+
+    sRect.i16XMin = i32X;
+    sRect.i16XMax = i32X + i32Count - 1;
+    sRect.i16YMin = sRect.i16YMax = i32Y;
+    CompositorCover(&sRect);
+    DpyPixelDrawMultiple(g_psCompositorTarget, i32X, i32Y, i32X0, i32Count,
+                         i32BPP, pui8Data, pui8Palette);
+}
+
+static void
+CompositorLineDrawH(void *pvDisplayData, int32_t i32X1, int32_t i32X2,
+                    int32_t i32Y, uint32_t ui32Value)
+{
+    tRectangle sRect;
+
+    sRect.i16XMin = i32X1;
+    sRect.i16XMax = i32X2;
+    sRect.i16YMin = sRect.i16YMax = i32Y;
+    CompositorCover(&sRect);
+    DpyLineDrawH(g_psCompositorTarget, i32X1, i32X2, i32Y, ui32Value);
+}
+
+static void
+CompositorLineDrawV(void *pvDisplayData, int32_t i32X, int32_t i32Y1,
+                    int32_t i32Y2, uint32_t ui32Value)
+{
+    tRectangle sRect;
+
+    sRect.i16XMin = sRect.i16XMax = i32X;
+    sRect.i16YMin = i32Y1;
+    sRect.i16YMax = i32Y2;
+    CompositorCover(&sRect);
+    DpyLineDrawV(g_psCompositorTarget, i32X, i32Y1, i32Y2, ui32Value);
+}
+
+static void
+CompositorRectFill(void *pvDisplayData, const tRectangle *psRect,
+                   uint32_t ui32Value)
+{
+#ifdef COMPOSITOR_ENABLE
+    CompositorFillAdd(psRect, ui32Value);
+#else
+    DpyRectFill(g_psCompositorTarget, psRect, ui32Value);
+#endif
+}
+
+static uint32_t
+CompositorColorTranslate(void *pvDisplayData, uint32_t ui32Value)
+{
+    return(DpyColorTranslate(g_psCompositorTarget, ui32Value));
+}
+
+static void
+CompositorDisplayFlush(void *pvDisplayData)
+{
+    CompositorFlush();
+    DpyFlush(g_psCompositorTarget);
+}
+
+//*****************************************************************************
+//
+//! The compositor display.  Widgets are drawn on this display instead of the
+//! display driver; it takes the size of the driver's display when the
+//! compositor is initialized.
+//
+//*****************************************************************************
+tDisplay g_sCompositorDisplay =
+{
+    sizeof(tDisplay),
+    0,
+    0,
+    0,
+    CompositorPixelDraw,
+    CompositorPixelDrawMultiple,
+    CompositorLineDrawH,
+    CompositorLineDrawV,
+    CompositorRectFill,
+    CompositorColorTranslate,
+    CompositorDisplayFlush
+};
+
+//*****************************************************************************
+//
+//! Initializes the compositor.
+//!
+//! \param psDisplay is the display the compositor draws on.
+//!
+//! This function must be called before anything is drawn on
+//! g_sCompositorDisplay.  If COMPOSITOR_ENABLE is not defined (see
+//! defines.h), fills are drawn at once and the compositor only passes the
+//! drawing on.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+CompositorInit(const tDisplay *psDisplay)
+{
+    g_psCompositorTarget = psDisplay;
+    g_sCompositorDisplay.ui16Width = DpyWidthGet(psDisplay);
+    g_sCompositorDisplay.ui16Height = DpyHeightGet(psDisplay);
+    g_ui32CompositorFills = 0;
+}
+
+//*****************************************************************************
+//
+//! Prepares a rectangle for drawing directly on the display.
+//!
+//! \param psRect is the rectangle about to be drawn, which must be covered
+//! completely.
+//!
+//! Any pending fill under the rectangle is cut away or drawn, so that no
+//! pending fill is drawn over the rectangle later.  This function must be
+//! called before drawing on the display other than through
+//! g_sCompositorDisplay.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+CompositorRectDraw(const tRectangle *psRect)
+{
+    CompositorCover(psRect);
+}
+
+//*****************************************************************************
+//
+//! Prepares a rectangle for drawing directly on the display, in part.
+//!
+//! \param psRect is the rectangle about to be drawn, which need not be
+//! covered completely.
+//!
+//! Any pending fill under the rectangle is drawn, so that what shows through
+//! the pixels that are not drawn, as the transparent pixels of a sprite, is
+//! there already.  This function must be called instead of
+//! CompositorRectDraw() before such drawing.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+CompositorRectBlend(const tRectangle *psRect)
+{
+    tRectangle sOverlap;
+    uint32_t ui32Fill;
+
+    for(ui32Fill = 0; ui32Fill < g_ui32CompositorFills; )
+    {
+        if(GrRectIntersectGet(&g_psCompositorFills[ui32Fill].sRect,
+                              (tRectangle *)psRect, &sOverlap))
+        {
+            CompositorFillDraw(ui32Fill);
+        }
+        else
+        {
+            ui32Fill++;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Draws the pending fills.
+//!
+//! This function is called once the widgets are painted, and before anything
+//! is drawn on the display that may not call CompositorRectDraw().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+CompositorFlush(void)
+{
+    while(g_ui32CompositorFills)
+    {
+        CompositorFillDraw(g_ui32CompositorFills - 1);
+    }
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
@@ -0,0 +1,39 @@
+//*****************************************************************************
+//
+// compositor.h - Prototypes for the damage tracking display compositor.
+//
+//*****************************************************************************
+
+#ifndef __COMPOSITOR_H__
+#define __COMPOSITOR_H__
+
+//*****************************************************************************
+//
+// The most rectangle fills the compositor holds back at a time.  A fill that
+// does not fit is drawn at once.
+//
+//*****************************************************************************
+#define COMPOSITOR_MAX_FILLS    16
+
+//*****************************************************************************
+//
+// The cost, in pixels, of drawing one more rectangle fill: about the number
+// of bus writes that program the display window for it.  A pending fill is
+// only cut around something drawn over it when that saves more pixels than
+// the extra fills cost; otherwise the fill is drawn first.
+//
+//*****************************************************************************
+#define COMPOSITOR_FILL_COST    20
+
+//*****************************************************************************
+//
+// Prototypes for the globals and functions exported by the compositor.
+//
+//*****************************************************************************
+extern tDisplay g_sCompositorDisplay;
+extern void CompositorInit(const tDisplay *psDisplay);
+extern void CompositorRectDraw(const tRectangle *psRect);
+extern void CompositorRectBlend(const tRectangle *psRect);
+extern void CompositorFlush(void);
+
+#endif // __COMPOSITOR_H__
@@ -9,6 +9,117 @@
 //*****************************************************************************
 #define NUM_SSI_DATA 128
 
+//*****************************************************************************
+//
+// Display frame rate in Hz.  The received data are sampled separately at
+// ACQ_RATE_HZ (see acquire.h).
+//
+//*****************************************************************************
+#define DISPLAY_RATE_HZ 10
+
+//*****************************************************************************
+//
+// The interrupt priorities, in the top three bits; 0x00 is the most urgent.
+// The SPI link receive FIFO holds only eight words, so SSI1 preempts all else.
+// The acquisition timer keeps the sample clock, and the touch screen and the
+// UART follow.  The paint jobs run from PendSV at the lowest priority, below
+// every interrupt but above the tasks of the main loop.  The priorities of
+// the interrupts can also be changed from the console (see irq.c).
+//
+//*****************************************************************************
+#define INT_PRIORITY_SSI1       0x00
+#define INT_PRIORITY_TIMER0A    0x20
+#define INT_PRIORITY_TOUCH      0x40
+#define INT_PRIORITY_UART0      0x60
+#define INT_PRIORITY_SYSTICK    0x80
+#define INT_PRIORITY_PENDSV     0xe0
+
+//*****************************************************************************
+//
+// The number of the priority bits, from the top, that decide preemption; the
+// remaining bits only order pending interrupts of the same group.  With all
+// three bits every more urgent interrupt preempts a less urgent one.  With
+// fewer, interrupts whose priorities differ only in the remaining bits do not
+// preempt each other, so each may have to wait for the whole of the other.
+//
+//*****************************************************************************
+#define INT_PRIORITY_PREEMPT_BITS 3
+
+//*****************************************************************************
+//
+// The number of rows of a full-screen image drawn per run of the image task.
+// A band of 16 rows takes about 1.6 ms, which bounds the time that the image
+// holds off the tasks of the main loop.
+//
+//*****************************************************************************
+#define IMAGE_SLICE_ROWS 16
+
+//*****************************************************************************
+//
+// Enables the sampling of the touch screen through uDMA (see touch.c): each
+// axis is read eight times by one ADC sequence, and the readings are moved to
+// memory by the uDMA, so that there is one interrupt per axis instead of two.
+// The median of the readings is then smoothed by a first-order IIR filter
+// whose weight for the new reading is 1 / 2^TOUCH_IIR_SHIFT; 0 turns the
+// filter off.  Comment TOUCH_DMA_ENABLE out to read one sample per interrupt.
+//
+//*****************************************************************************
+#define TOUCH_DMA_ENABLE
+#define TOUCH_IIR_SHIFT 1
+
+//*****************************************************************************
+//
+// Enables the cycle count profiler (see profile.h).  Comment this out to
+// remove all profiling code from the build.
+//
+//*****************************************************************************
+#define PROFILE_ENABLE
+
+//*****************************************************************************
+//
+// Enables the bus transfer counters of the display driver (see
+// Kentec320x240x16_ssd2119_8bit.h) and the per-panel bus report on the
+// console.  Comment this out to remove the counters from the build.
+//
+//*****************************************************************************
+#define LCD_STATS_ENABLE
+
+//*****************************************************************************
+//
+// Enables the measurement of the interrupt latencies (see irq.h) and their
+// report on the console.  Comment this out to remove the measurement from
+// the interrupt handlers.
+//
+//*****************************************************************************
+#define IRQ_STATS_ENABLE
+
+//*****************************************************************************
+//
+// Enables the holding back of rectangle fills by the widget compositor (see
+// compositor.c), which keeps panel paints from drawing pixels that are drawn
+// over later.  Comment this out to draw every fill at once.
+//
+//*****************************************************************************
+#define COMPOSITOR_ENABLE
+
+//*****************************************************************************
+//
+// Enables the merging and dropping of the primitives drawn through the
+// display list (see displaylist.c), which the scopes are drawn through.
+// Comment this out to draw each primitive at once.
+//
+//*****************************************************************************
+#define DISPLAY_LIST_ENABLE
+
+//*****************************************************************************
+//
+// Starts the binary telemetry stream on UART0 (see telemetry.c) at power-up.
+// Telemetry frames and console text can share the UART.  Comment this out to
+// start with the console text only.
+//
+//*****************************************************************************
+#define TELEMETRY_ENABLE
+
 
 #define Display_Width   320                         //!< Display Width
 #define Display_Height  240                         //!< Display Height
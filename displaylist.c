@@ -0,0 +1,484 @@
+//*****************************************************************************
+//
+// displaylist.c - Display list recorder.
+//
+// The display list is a grlib display that sits between the code that draws
+// and the display driver, like the compositor, for drawing made of many
+// small primitives.  UpdateScope() is the case in point: each frame it draws
+// the grid, then each curve segment in black and again in yellow, pixel by
+// pixel, so that most pixels are written twice and each pixel costs a cursor
+// setup of its own.
+//
+// The display list holds the last DISPLAY_LIST_SIZE primitives back instead
+// of drawing them, each as a rectangle and a color, and optimizes each new
+// primitive against them:
+//
+// - A held primitive that the new one covers entirely is dropped.
+// - A held primitive of the same color that the new one extends into a
+//   larger rectangle, as the next pixel of a column or an overlapping span of
+//   a row, is merged with it, if none of the primitives in between is drawn
+//   in another color where the merged one is moved over them.
+// - A horizontal or vertical span is moved back next to the last held span
+//   of the same direction, past primitives it does not touch, so that the
+//   driver sets its entry mode once for both.
+//
+// The oldest primitive is drawn when the list is full, and all of them when
+// DisplayListFlush() is called.  Pixel runs are passed on at once, after the
+// held primitives.  Code that draws through the display list must flush it
+// before drawing on the display in any other way.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup displaylist_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "grlib/grlib.h"
+#include "defines.h"
+#include "displaylist.h"
+
+//*****************************************************************************
+//
+// A primitive that has not been drawn yet.
+//
+//*****************************************************************************
+typedef struct
+{
+    tRectangle sRect;
+    uint32_t ui32Value;
+}
+tDisplayListEntry;
+
+//*****************************************************************************
+//
+// The shapes of the primitives, by the driver function that draws them.
+//
+//*****************************************************************************
+#define DISPLAY_LIST_PIXEL      0
+#define DISPLAY_LIST_LINE_H     1
+#define DISPLAY_LIST_LINE_V     2
+#define DISPLAY_LIST_RECT       3
+
+//*****************************************************************************
+//
+// The held primitives, oldest first, and the display they are drawn on.
+//
+//*****************************************************************************
+static tDisplayListEntry g_psDisplayList[DISPLAY_LIST_SIZE];
+static uint32_t g_ui32DisplayListCount;
+static const tDisplay *g_psDisplayListTarget;
+
+//*****************************************************************************
+//
+// Returns the shape of a primitive.
+//
+//*****************************************************************************
+static uint32_t
+DisplayListShape(const tRectangle *psRect)
+{
+    if(psRect->i16YMin == psRect->i16YMax)
+    {
+        return((psRect->i16XMin == psRect->i16XMax) ? DISPLAY_LIST_PIXEL :
+               DISPLAY_LIST_LINE_H);
+    }
+    return((psRect->i16XMin == psRect->i16XMax) ? DISPLAY_LIST_LINE_V :
+           DISPLAY_LIST_RECT);
+}
+
+//*****************************************************************************
+//
+// Draws a primitive with the driver function that suits its shape.
+//
+//*****************************************************************************
+static void
+DisplayListPrimitiveDraw(const tRectangle *psRect, uint32_t ui32Value)
+{
+    switch(DisplayListShape(psRect))
+    {
+        case DISPLAY_LIST_PIXEL:
+        {
+            DpyPixelDraw(g_psDisplayListTarget, psRect->i16XMin,
+                         psRect->i16YMin, ui32Value);
+            break;
+        }
+        case DISPLAY_LIST_LINE_H:
+        {
+            DpyLineDrawH(g_psDisplayListTarget, psRect->i16XMin,
+                         psRect->i16XMax, psRect->i16YMin, ui32Value);
+            break;
+        }
+        case DISPLAY_LIST_LINE_V:
+        {
+            DpyLineDrawV(g_psDisplayListTarget, psRect->i16XMin,
+                         psRect->i16YMin, psRect->i16YMax, ui32Value);
+            break;
+        }
+        default:
+        {
+            DpyRectFill(g_psDisplayListTarget, psRect, ui32Value);
+            break;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Removes a held primitive from the list, keeping the others in order.
+//
+//*****************************************************************************
+static void
+DisplayListRemove(uint32_t ui32Entry)
+{
+    g_ui32DisplayListCount--;
+    for(; ui32Entry < g_ui32DisplayListCount; ui32Entry++)
+    {
+        g_psDisplayList[ui32Entry] = g_psDisplayList[ui32Entry + 1];
+    }
+}
+
+//*****************************************************************************
+//
+// Determines whether one rectangle contains another.
+//
+//*****************************************************************************
+static bool
+DisplayListContains(const tRectangle *psOuter, const tRectangle *psInner)
+{
+    return((psOuter->i16XMin <= psInner->i16XMin) &&
+           (psOuter->i16XMax >= psInner->i16XMax) &&
+           (psOuter->i16YMin <= psInner->i16YMin) &&
+           (psOuter->i16YMax >= psInner->i16YMax));
+}
+
+//*****************************************************************************
+//
+// Determines whether a primitive can be moved over the held primitives from
+// ui32First on, that is whether none of them has a pixel of another color
+// under it.
+//
+//*****************************************************************************
+static bool
+DisplayListClear(uint32_t ui32First, const tRectangle *psRect,
+                 uint32_t ui32Value)
+{
+    const tRectangle *psHeld;
+
+    for(; ui32First < g_ui32DisplayListCount; ui32First++)
+    {
+        psHeld = &g_psDisplayList[ui32First].sRect;
+        if((g_psDisplayList[ui32First].ui32Value != ui32Value) &&
+           (psHeld->i16XMin <= psRect->i16XMax) &&
+           (psHeld->i16XMax >= psRect->i16XMin) &&
+           (psHeld->i16YMin <= psRect->i16YMax) &&
+           (psHeld->i16YMax >= psRect->i16YMin))
+        {
+            return(false);
+        }
+    }
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Determines whether two rectangles make up a larger one, as the spans of one
+// row or one column that overlap or touch, or one containing the other, and
+// returns the larger one.
+//
+//*****************************************************************************
+static bool
+DisplayListJoin(const tRectangle *psA, const tRectangle *psB,
+                tRectangle *psJoin)
+{
+    if(((psA->i16YMin == psB->i16YMin) && (psA->i16YMax == psB->i16YMax) &&
+        ((psA->i16XMax + 1) >= psB->i16XMin) &&
+        (psA->i16XMin <= (psB->i16XMax + 1))) ||
+       ((psA->i16XMin == psB->i16XMin) && (psA->i16XMax == psB->i16XMax) &&
+        ((psA->i16YMax + 1) >= psB->i16YMin) &&
+        (psA->i16YMin <= (psB->i16YMax + 1))) ||
+       DisplayListContains(psA, psB) || DisplayListContains(psB, psA))
+    {
+        psJoin->i16XMin = (psA->i16XMin < psB->i16XMin) ? psA->i16XMin :
+                          psB->i16XMin;
+        psJoin->i16XMax = (psA->i16XMax > psB->i16XMax) ? psA->i16XMax :
+                          psB->i16XMax;
+        psJoin->i16YMin = (psA->i16YMin < psB->i16YMin) ? psA->i16YMin :
+                          psB->i16YMin;
+        psJoin->i16YMax = (psA->i16YMax > psB->i16YMax) ? psA->i16YMax :
+                          psB->i16YMax;
+        return(true);
+    }
+
+    return(false);
+}
+
+//*****************************************************************************
+//
+// Adds a primitive to the list: drops the held primitives it covers, merges
+// it with a held primitive it extends, or moves it next to the last span of
+// its direction, and draws the oldest primitive if the list is full.
+//
+//*****************************************************************************
+static void
+DisplayListAdd(const tRectangle *psRect, uint32_t ui32Value)
+{
+#ifdef DISPLAY_LIST_ENABLE
+    tDisplayListEntry *psHeld;
+    tRectangle sRect, sJoin;
+    uint32_t ui32Entry, ui32Shape, ui32HeldShape, ui32Pos;
+    bool bMerged;
+
+    sRect = *psRect;
+
+    do
+    {
+        //
+        // Drop the held primitives that the new one covers.
+        //
+        for(ui32Entry = 0; ui32Entry < g_ui32DisplayListCount; )
+        {
+            if(DisplayListContains(&sRect, &g_psDisplayList[ui32Entry].sRect))
+            {
+                DisplayListRemove(ui32Entry);
+            }
+            else
+            {
+                ui32Entry++;
+            }
+        }
+
+        //
+        // Merge the new primitive with the latest held primitive that it
+        // extends.  The held primitive is taken forward into the new one if
+        // it can be moved over the primitives after it, and the new one is
+        // taken back otherwise, if it can be.  In the first case the merged
+        // primitive is added like a new one, since it may now cover or extend
+        // others.
+        //
+        bMerged = false;
+        for(ui32Entry = g_ui32DisplayListCount; ui32Entry--; )
+        {
+            psHeld = &g_psDisplayList[ui32Entry];
+            if((psHeld->ui32Value != ui32Value) ||
+               !DisplayListJoin(&psHeld->sRect, &sRect, &sJoin))
+            {
+                continue;
+            }
+            if(DisplayListClear(ui32Entry + 1, &psHeld->sRect, ui32Value))
+            {
+                DisplayListRemove(ui32Entry);
+                sRect = sJoin;
+                bMerged = true;
+                break;
+            }
+            if(DisplayListClear(ui32Entry + 1, &sRect, ui32Value))
+            {
+                psHeld->sRect = sJoin;
+                return;
+            }
+        }
+    }
+    while(bMerged);
+
+    //
+    // Find where the new primitive goes: at the end, or after the last held
+    // span of its direction if the last held span has the other direction
+    // and it can be moved back over the primitives in between.
+    //
+    ui32Pos = g_ui32DisplayListCount;
+    ui32Shape = DisplayListShape(&sRect);
+    if((ui32Shape == DISPLAY_LIST_LINE_H) || (ui32Shape == DISPLAY_LIST_LINE_V))
+    {
+        for(ui32Entry = g_ui32DisplayListCount; ui32Entry--; )
+        {
+            ui32HeldShape = DisplayListShape(&g_psDisplayList[ui32Entry].sRect);
+            if(ui32HeldShape == DISPLAY_LIST_PIXEL)
+            {
+                continue;
+            }
+            if(ui32HeldShape == ui32Shape)
+            {
+                if(DisplayListClear(ui32Entry + 1, &sRect, ui32Value))
+                {
+                    ui32Pos = ui32Entry + 1;
+                }
+            }
+            break;
+        }
+    }
+
+    //
+    // Make room and add the primitive.
+    //
+    if(g_ui32DisplayListCount == DISPLAY_LIST_SIZE)
+    {
+        DisplayListPrimitiveDraw(&g_psDisplayList[0].sRect,
+                                 g_psDisplayList[0].ui32Value);
+        DisplayListRemove(0);
+        if(ui32Pos)
+        {
+            ui32Pos--;
+        }
+    }
+    for(ui32Entry = g_ui32DisplayListCount; ui32Entry > ui32Pos; ui32Entry--)
+    {
+        g_psDisplayList[ui32Entry] = g_psDisplayList[ui32Entry - 1];
+    }
+    g_psDisplayList[ui32Pos].sRect = sRect;
+    g_psDisplayList[ui32Pos].ui32Value = ui32Value;
+    g_ui32DisplayListCount++;
+#else
+    DisplayListPrimitiveDraw(psRect, ui32Value);
+#endif
+}
+
+//*****************************************************************************
+//
+// The grlib display functions of the display list.  The pixels and lines are
+// recorded as rectangles; pixel runs are drawn after the held primitives.
+//
+//*****************************************************************************
+static void
+DisplayListPixelDraw(void *pvDisplayData, int32_t i32X, int32_t i32Y,
+                     uint32_t ui32Value)
+{
+    tRectangle sRect;
+
+    sRect.i16XMin = sRect.i16XMax = i32X;
+    sRect.i16YMin = sRect.i16YMax = i32Y;
+    DisplayListAdd(&sRect, ui32Value);
+}
+
+static void
+DisplayListPixelDrawMultiple(void *pvDisplayData, int32_t i32X, int32_t i32Y,
+                             int32_t i32X0, int32_t i32Count, int32_t i32BPP,
+                             const uint8_t *pui8Data,
+                             const uint8_t *pui8Palette)
+{
+    DisplayListFlush();
+    DpyPixelDrawMultiple(g_psDisplayListTarget, i32X, i32Y, i32X0, i32Count,
+                         i32BPP, pui8Data, pui8Palette);
+}
+
+static void
+DisplayListLineDrawH(void *pvDisplayData, int32_t i32X1, int32_t i32X2,
+                     int32_t i32Y, uint32_t ui32Value)
+{
+    tRectangle sRect;
+
+    sRect.i16XMin = (i32X1 < i32X2) ? i32X1 : i32X2;
+    sRect.i16XMax = (i32X1 < i32X2) ? i32X2 : i32X1;
+    sRect.i16YMin = sRect.i16YMax = i32Y;
+    DisplayListAdd(&sRect, ui32Value);
+}
+
+static void
+DisplayListLineDrawV(void *pvDisplayData, int32_t i32X, int32_t i32Y1,
+                     int32_t i32Y2, uint32_t ui32Value)
+{
+    tRectangle sRect;
+
+    sRect.i16XMin = sRect.i16XMax = i32X;
+    sRect.i16YMin = (i32Y1 < i32Y2) ? i32Y1 : i32Y2;
+    sRect.i16YMax = (i32Y1 < i32Y2) ? i32Y2 : i32Y1;
+    DisplayListAdd(&sRect, ui32Value);
+}
+
+static void
+DisplayListRectFill(void *pvDisplayData, const tRectangle *psRect,
+                    uint32_t ui32Value)
+{
+    DisplayListAdd(psRect, ui32Value);
+}
+
+static uint32_t
+DisplayListColorTranslate(void *pvDisplayData, uint32_t ui32Value)
+{
+    return(DpyColorTranslate(g_psDisplayListTarget, ui32Value));
+}
+
+static void
+DisplayListDisplayFlush(void *pvDisplayData)
+{
+    DisplayListFlush();
+    DpyFlush(g_psDisplayListTarget);
+}
+
+//*****************************************************************************
+//
+//! The display list display.  It takes the size of the driver's display when
+//! the display list is initialized.
+//
+//*****************************************************************************
+tDisplay g_sDisplayListDisplay =
+{
+    sizeof(tDisplay),
+    0,
+    0,
+    0,
+    DisplayListPixelDraw,
+    DisplayListPixelDrawMultiple,
+    DisplayListLineDrawH,
+    DisplayListLineDrawV,
+    DisplayListRectFill,
+    DisplayListColorTranslate,
+    DisplayListDisplayFlush
+};
+
+//*****************************************************************************
+//
+//! Initializes the display list.
+//!
+//! \param psDisplay is the display the display list draws on.
+//!
+//! This function must be called before anything is drawn on
+//! g_sDisplayListDisplay.  If DISPLAY_LIST_ENABLE is not defined (see
+//! defines.h), each primitive is drawn at once.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+DisplayListInit(const tDisplay *psDisplay)
+{
+    g_psDisplayListTarget = psDisplay;
+    g_sDisplayListDisplay.ui16Width = DpyWidthGet(psDisplay);
+    g_sDisplayListDisplay.ui16Height = DpyHeightGet(psDisplay);
+    g_ui32DisplayListCount = 0;
+}
+
+//*****************************************************************************
+//
+//! Draws the held primitives.
+//!
+//! This function is called when a drawing made through the display list is
+//! complete, and before anything is drawn on the display in another way.
+//! GrFlush() on a context of g_sDisplayListDisplay calls it.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+DisplayListFlush(void)
+{
+    uint32_t ui32Entry;
+
+    for(ui32Entry = 0; ui32Entry < g_ui32DisplayListCount; ui32Entry++)
+    {
+        DisplayListPrimitiveDraw(&g_psDisplayList[ui32Entry].sRect,
+                                 g_psDisplayList[ui32Entry].ui32Value);
+    }
+    g_ui32DisplayListCount = 0;
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
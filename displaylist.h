@@ -0,0 +1,29 @@
+//*****************************************************************************
+//
+// displaylist.h - Prototypes for the display list recorder.
+//
+//*****************************************************************************
+
+#ifndef __DISPLAYLIST_H__
+#define __DISPLAYLIST_H__
+
+//*****************************************************************************
+//
+// The number of recent primitives the display list holds.  A primitive is
+// merged with, or drops, only those of the primitives before it that are still
+// held; older ones are drawn.  Each primitive held costs a compare or two per
+// primitive recorded after it.  The scopes merge as well with 8 as with 32.
+//
+//*****************************************************************************
+#define DISPLAY_LIST_SIZE       8
+
+//*****************************************************************************
+//
+// Prototypes for the globals and functions exported by the display list.
+//
+//*****************************************************************************
+extern tDisplay g_sDisplayListDisplay;
+extern void DisplayListInit(const tDisplay *psDisplay);
+extern void DisplayListFlush(void);
+
+#endif // __DISPLAYLIST_H__
@@ -1,6673 +0,0 @@
-
-#include <stdint.h>
-#include <stdbool.h>
-#include "grlib/grlib.h"
-
-
-
-
-const uint8_t g_pui_Flower_Image[] =
-{
-    IMAGE_FMT_8BPP_UNCOMP,
-    64, 1,
-//    240, 0,
-    216, 0,
-
-    254,
-    0x00, 0x03, 0x00,
-    0x08, 0x04, 0x00,
-    0x09, 0x03, 0x06,
-    0x0d, 0x0a, 0x03,
-    0x06, 0x0a, 0x07,
-    0x0d, 0x08, 0x0b,
-    0x02, 0x0d, 0x0e,
-    0x16, 0x0d, 0x0c,
-    0x12, 0x10, 0x0a,
-    0x0c, 0x10, 0x0e,
-    0x12, 0x0e, 0x11,
-    0x07, 0x13, 0x0d,
-    0x1d, 0x11, 0x0e,
-    0x24, 0x11, 0x0c,
-    0x1b, 0x13, 0x12,
-    0x07, 0x18, 0x14,
-    0x32, 0x17, 0x0e,
-    0x1a, 0x17, 0x17,
-    0x16, 0x19, 0x16,
-    0x3e, 0x17, 0x0c,
-    0x02, 0x20, 0x13,
-    0x06, 0x1d, 0x18,
-    0x20, 0x19, 0x18,
-    0x2d, 0x17, 0x18,
-    0x14, 0x1c, 0x18,
-    0x27, 0x1b, 0x17,
-    0x28, 0x1b, 0x1d,
-    0x2e, 0x1c, 0x19,
-    0x0a, 0x28, 0x1e,
-    0x2a, 0x22, 0x22,
-    0x2e, 0x22, 0x21,
-    0x35, 0x23, 0x22,
-    0x45, 0x24, 0x1c,
-    0x26, 0x27, 0x24,
-    0x1e, 0x29, 0x24,
-    0x02, 0x33, 0x1c,
-    0x06, 0x30, 0x26,
-    0x3f, 0x28, 0x25,
-    0x3a, 0x29, 0x28,
-    0x01, 0x3d, 0x24,
-    0x40, 0x2f, 0x2e,
-    0x46, 0x30, 0x2b,
-    0x4c, 0x2f, 0x2c,
-    0x33, 0x33, 0x2e,
-    0x47, 0x2f, 0x31,
-    0x4d, 0x36, 0x31,
-    0x01, 0x48, 0x2a,
-    0x47, 0x36, 0x34,
-    0x4d, 0x34, 0x37,
-    0x53, 0x35, 0x33,
-    0x03, 0x49, 0x37,
-    0x01, 0x53, 0x29,
-    0x54, 0x3c, 0x3a,
-    0x14, 0x48, 0x3c,
-    0x5b, 0x3a, 0x3e,
-    0x5b, 0x3d, 0x39,
-    0x44, 0x41, 0x3c,
-    0x2d, 0x46, 0x3d,
-    0x50, 0x40, 0x3d,
-    0x02, 0x53, 0x35,
-    0x5c, 0x43, 0x42,
-    0x62, 0x45, 0x3d,
-    0x61, 0x43, 0x42,
-    0x67, 0x44, 0x3f,
-    0x02, 0x5f, 0x3f,
-    0x6d, 0x4a, 0x45,
-    0x55, 0x4d, 0x49,
-    0x63, 0x4b, 0x48,
-    0x69, 0x4c, 0x44,
-    0x6e, 0x48, 0x4b,
-    0x69, 0x4a, 0x49,
-    0x70, 0x4e, 0x41,
-    0x01, 0x69, 0x39,
-    0x71, 0x4d, 0x48,
-    0x74, 0x50, 0x4c,
-    0x0a, 0x60, 0x54,
-    0x65, 0x52, 0x50,
-    0x76, 0x54, 0x47,
-    0x71, 0x53, 0x4b,
-    0x6b, 0x53, 0x4e,
-    0x53, 0x57, 0x4f,
-    0x01, 0x69, 0x4a,
-    0x71, 0x51, 0x51,
-    0x78, 0x54, 0x4f,
-    0x00, 0x6e, 0x4f,
-    0x7c, 0x59, 0x4d,
-    0x7b, 0x57, 0x52,
-    0x77, 0x57, 0x57,
-    0x68, 0x5b, 0x57,
-    0x73, 0x5a, 0x55,
-    0x3b, 0x63, 0x59,
-    0x79, 0x5b, 0x53,
-    0x6f, 0x5b, 0x58,
-    0x00, 0x7a, 0x45,
-    0x80, 0x5d, 0x51,
-    0x80, 0x5b, 0x57,
-    0x7b, 0x5b, 0x5a,
-    0x08, 0x73, 0x5d,
-    0x79, 0x60, 0x5b,
-    0x84, 0x5f, 0x5b,
-    0x02, 0x7b, 0x56,
-    0x75, 0x62, 0x5d,
-    0x80, 0x62, 0x5a,
-    0x62, 0x65, 0x60,
-    0x86, 0x63, 0x57,
-    0x80, 0x60, 0x60,
-    0x88, 0x62, 0x5e,
-    0x00, 0x85, 0x51,
-    0x8c, 0x68, 0x5c,
-    0x74, 0x6a, 0x64,
-    0x8c, 0x67, 0x62,
-    0x87, 0x66, 0x66,
-    0x52, 0x71, 0x66,
-    0x88, 0x6a, 0x62,
-    0x03, 0x80, 0x69,
-    0x00, 0x85, 0x61,
-    0x90, 0x6c, 0x60,
-    0x90, 0x6a, 0x66,
-    0x94, 0x6f, 0x64,
-    0x7d, 0x72, 0x69,
-    0x94, 0x6e, 0x6a,
-    0x00, 0x92, 0x5a,
-    0x8f, 0x70, 0x69,
-    0x8f, 0x6e, 0x6e,
-    0x88, 0x71, 0x6b,
-    0x96, 0x72, 0x66,
-    0x37, 0x80, 0x73,
-    0x00, 0x90, 0x68,
-    0x02, 0x8e, 0x6f,
-    0x9a, 0x75, 0x6a,
-    0x95, 0x75, 0x6e,
-    0x95, 0x73, 0x73,
-    0x9a, 0x74, 0x70,
-    0x8f, 0x78, 0x72,
-    0x80, 0x7b, 0x72,
-    0x60, 0x80, 0x75,
-    0x9e, 0x7a, 0x6e,
-    0x9a, 0x7c, 0x6d,
-    0x99, 0x7a, 0x72,
-    0x99, 0x78, 0x78,
-    0x00, 0x9e, 0x67,
-    0x2c, 0x8e, 0x7c,
-    0x0d, 0x93, 0x7e,
-    0x00, 0x9b, 0x74,
-    0x9e, 0x7e, 0x77,
-    0xa4, 0x7f, 0x73,
-    0x03, 0x99, 0x7c,
-    0xa0, 0x7d, 0x7c,
-    0xa0, 0x82, 0x73,
-    0x80, 0x84, 0x7c,
-    0x94, 0x81, 0x7b,
-    0xa2, 0x82, 0x7b,
-    0x0b, 0xa4, 0x73,
-    0xa7, 0x86, 0x7f,
-    0x5a, 0x92, 0x84,
-    0x00, 0xaa, 0x76,
-    0xa6, 0x84, 0x84,
-    0xa7, 0x89, 0x7a,
-    0x00, 0xa8, 0x7f,
-    0xa2, 0x8a, 0x7f,
-    0x8d, 0x8d, 0x85,
-    0xa3, 0x89, 0x85,
-    0x00, 0xa7, 0x87,
-    0xab, 0x8a, 0x83,
-    0x18, 0xa5, 0x84,
-    0x78, 0x93, 0x88,
-    0x09, 0xa6, 0x92,
-    0xaf, 0x90, 0x81,
-    0x0a, 0xa5, 0x98,
-    0xaf, 0x8f, 0x87,
-    0xab, 0x91, 0x86,
-    0xa4, 0x90, 0x8b,
-    0xab, 0x90, 0x8c,
-    0x00, 0xb5, 0x84,
-    0x24, 0xa7, 0x94,
-    0x00, 0xb5, 0x8d,
-    0x06, 0xb1, 0x94,
-    0xb7, 0x98, 0x89,
-    0xab, 0x95, 0x95,
-    0xb7, 0x96, 0x8f,
-    0xb3, 0x99, 0x8e,
-    0x98, 0x9c, 0x92,
-    0xaa, 0x99, 0x92,
-    0x00, 0xb6, 0x98,
-    0xb3, 0x97, 0x94,
-    0x12, 0xb1, 0x9d,
-    0x1b, 0xac, 0xa6,
-    0x15, 0xb0, 0xa2,
-    0x59, 0xa6, 0x9d,
-    0x02, 0xbf, 0x90,
-    0x9b, 0xa4, 0x98,
-    0xbb, 0xa1, 0x96,
-    0x0c, 0xbf, 0x9c,
-    0xbb, 0x9f, 0x9c,
-    0x74, 0xaa, 0xa1,
-    0x88, 0xa8, 0x9e,
-    0x0b, 0xbc, 0xa6,
-    0x00, 0xc6, 0x99,
-    0x00, 0xc4, 0xa3,
-    0x23, 0xbc, 0xa9,
-    0x19, 0xb9, 0xb3,
-    0x00, 0xc3, 0xac,
-    0x53, 0xb7, 0xaa,
-    0xc3, 0xa8, 0x9f,
-    0xbe, 0xa9, 0xa3,
-    0x3b, 0xc3, 0xa5,
-    0xa4, 0xae, 0xa9,
-    0x00, 0xce, 0xa9,
-    0x01, 0xcd, 0xb0,
-    0xb7, 0xb0, 0xa7,
-    0xbe, 0xb0, 0xa8,
-    0xca, 0xaf, 0xa6,
-    0x47, 0xc1, 0xb3,
-    0x14, 0xca, 0xb5,
-    0x00, 0xcd, 0xb7,
-    0x22, 0xc8, 0xb5,
-    0xc5, 0xb0, 0xa9,
-    0x33, 0xc8, 0xb7,
-    0xa7, 0xb9, 0xae,
-    0xc4, 0xb5, 0xb1,
-    0x71, 0xc2, 0xb6,
-    0x12, 0xd5, 0xb7,
-    0xd2, 0xb7, 0xae,
-    0xcd, 0xb7, 0xb0,
-    0xc2, 0xb9, 0xb1,
-    0x00, 0xd8, 0xbc,
-    0x00, 0xd7, 0xc3,
-    0x1a, 0xd6, 0xc0,
-    0x93, 0xc4, 0xb9,
-    0x22, 0xd5, 0xc6,
-    0x33, 0xd6, 0xc4,
-    0x41, 0xd6, 0xc5,
-    0x00, 0xe0, 0xcd,
-    0xd8, 0xc2, 0xbb,
-    0x14, 0xdf, 0xcb,
-    0x56, 0xdd, 0xce,
-    0x31, 0xe2, 0xd2,
-    0x74, 0xd9, 0xcd,
-    0x64, 0xdc, 0xd0,
-    0x42, 0xe2, 0xd3,
-    0x14, 0xe8, 0xd9,
-    0xe1, 0xcc, 0xc5,
-    0x4e, 0xe2, 0xd3,
-    0x00, 0xed, 0xdc,
-    0x28, 0xe9, 0xda,
-    0x8a, 0xdd, 0xd2,
-    0x3f, 0xed, 0xe0,
-    0x50, 0xee, 0xe2,
-    0x5d, 0xef, 0xe3,
-    0x68, 0xef, 0xe3,
-    0x71, 0xef, 0xe4,
-    0xac, 0xe8, 0xde,
-    0x7d, 0xf1, 0xe6,
-    0x89, 0xf0, 0xe5,
-    0x9c, 0xef, 0xe6,
-
-    0x74, 0x90, 0xa3, 0xa9, 0xb8, 0xaa, 0xaa, 0xa3, 0x99, 0x99, 0x97, 0x90,
-    0x90, 0x90, 0x90, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89,
-    0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x90, 0x90, 0x90, 0x90, 0x91, 0x90, 0x8a, 0x94, 0x94, 0x94,
-    0x94, 0x90, 0x97, 0x97, 0x94, 0x9d, 0x99, 0x99, 0x99, 0x99, 0xa7, 0xaa,
-    0xaa, 0xa9, 0xac, 0xb4, 0xb4, 0xb4, 0xb8, 0xbf, 0xbf, 0xbf, 0xcb, 0xd8,
-    0xd8, 0xd8, 0xcc, 0xbf, 0xb8, 0x97, 0x71, 0x44, 0x28, 0x16, 0x03, 0x05,
-    0x01, 0x01, 0x05, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x0e, 0x0e, 0x16,
-    0x16, 0x19, 0x19, 0x19, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f,
-    0x26, 0x26, 0x26, 0x28, 0x29, 0x2d, 0x30, 0x34, 0x37, 0x3c, 0x3c, 0x3d,
-    0x3e, 0x46, 0x46, 0x44, 0x46, 0x44, 0x3c, 0x3c, 0x3c, 0x34, 0x34, 0x2d,
-    0x2f, 0x28, 0x26, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x28, 0x34, 0x44, 0x5b,
-    0x6c, 0x8a, 0x99, 0xaa, 0xb4, 0xcc, 0xcc, 0xcc, 0xd8, 0xd8, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xd8, 0xd8, 0xd8, 0xcc, 0xcc, 0xcc, 0xcc, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb3, 0xb3,
-    0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa3, 0xa3, 0xa3, 0xa3, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x99, 0x99, 0x99, 0x99, 0x9d, 0x9d, 0x9d, 0x9d, 0x99, 0x9d, 0x99, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x91, 0x97, 0x97, 0x91, 0x97, 0x97, 0x97, 0x94,
-    0x97, 0x97, 0x90, 0x90, 0x90, 0x90, 0x91, 0x90, 0x90, 0x91, 0x90, 0x91,
-    0x91, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x88, 0x91, 0x8a,
-    0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x84, 0x84, 0x88,
-    0x89, 0x8a, 0x89, 0x91, 0x91, 0x91, 0x91, 0x91, 0x90, 0x97, 0x97, 0x9d,
-    0xa7, 0xa7, 0xa9, 0xa9, 0x99, 0x88, 0x6e, 0x56, 0x3d, 0x29, 0x1f, 0x1a,
-    0x1b, 0x1f, 0x1f, 0x25, 0x25, 0x25, 0x25, 0x2a, 0x2a, 0x2a, 0x31, 0x31,
-    0x31, 0x36, 0x36, 0x2a, 0x25, 0x25, 0x26, 0x2d, 0x8a, 0x99, 0xac, 0xaa,
-    0xac, 0xa3, 0x99, 0x99, 0x97, 0x90, 0x90, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x8a,
-    0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x90, 0x8a, 0x8a, 0x91, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
-    0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x9d, 0xa7, 0xa7, 0xa9, 0xaa, 0xaa,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xbf, 0xbf, 0xbf, 0xcc, 0xd8, 0xd3, 0xd8, 0xcc,
-    0xc1, 0xac, 0x90, 0x66, 0x43, 0x26, 0x16, 0x05, 0x05, 0x01, 0x01, 0x01,
-    0x05, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0e, 0x0e, 0x0e, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x19, 0x16, 0x19, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1f, 0x26, 0x26, 0x28, 0x2c, 0x29, 0x28, 0x2d, 0x2d,
-    0x29, 0x28, 0x28, 0x28, 0x26, 0x26, 0x1e, 0x1e, 0x1d, 0x16, 0x16, 0x16,
-    0x19, 0x1e, 0x1f, 0x2f, 0x3c, 0x4e, 0x66, 0x89, 0x97, 0xaa, 0xb8, 0xbf,
-    0xcc, 0xd8, 0xd8, 0xdf, 0xdf, 0xdf, 0xd8, 0xd8, 0xd8, 0xd8, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcb, 0xbf, 0xbf, 0xbf, 0xbf, 0xb4, 0xb4, 0xb4, 0xb4, 0xb8,
-    0xb8, 0xb8, 0xb4, 0xaa, 0xaa, 0xaa, 0xa7, 0xaa, 0xa9, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9d, 0x9d, 0xa7,
-    0xa3, 0x9d, 0x99, 0xa3, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x91, 0x94, 0x94, 0x94, 0x94, 0x91, 0x94, 0x91, 0x91, 0x90,
-    0x91, 0x91, 0x91, 0x91, 0x90, 0x91, 0x91, 0x91, 0x88, 0x88, 0x88, 0x8a,
-    0x89, 0x88, 0x88, 0x88, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x91, 0x91, 0x94, 0x99, 0xa3, 0xa9,
-    0x9d, 0x91, 0x81, 0x6a, 0x4a, 0x3e, 0x2c, 0x1f, 0x1f, 0x25, 0x25, 0x25,
-    0x25, 0x2a, 0x2a, 0x2a, 0x2a, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2c,
-    0x25, 0x25, 0x25, 0x2d, 0x90, 0xa3, 0xa9, 0xaa, 0xa3, 0x97, 0x97, 0x90,
-    0x8a, 0x8a, 0x8a, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81,
-    0x82, 0x82, 0x82, 0x88, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x94, 0x94, 0x94, 0x90, 0x94, 0x90, 0x97, 0x94, 0x9d,
-    0x9d, 0x99, 0x99, 0xa3, 0x9f, 0xaa, 0xaa, 0xa9, 0xaa, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xbf, 0xbf, 0xcb, 0xcc, 0xd8, 0xd8, 0xd8, 0xcc, 0xc1, 0xaa, 0x90,
-    0x66, 0x3d, 0x26, 0x0e, 0x03, 0x01, 0x01, 0x00, 0x01, 0x05, 0x05, 0x05,
-    0x03, 0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x16,
-    0x16, 0x16, 0x16, 0x1a, 0x1a, 0x1e, 0x1e, 0x1e, 0x1a, 0x1e, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x0e, 0x11, 0x0e, 0x0e, 0x16, 0x1e, 0x26, 0x2d, 0x44,
-    0x66, 0x7a, 0x9f, 0xaa, 0xb4, 0xbf, 0xcc, 0xd8, 0xd8, 0xdf, 0xdf, 0xdf,
-    0xd8, 0xd8, 0xd8, 0xcc, 0xcc, 0xcc, 0xcc, 0xcb, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xb4, 0xb4, 0xb4, 0xb8, 0xb4, 0xb4, 0xb8, 0xb4, 0xac, 0xaa, 0xaa,
-    0xaa, 0xa7, 0xa9, 0xa7, 0xa7, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9d, 0x9d, 0x9d, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9d, 0x97, 0x97, 0x9d, 0x9d, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x91, 0x90,
-    0x94, 0x94, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x89,
-    0x91, 0x90, 0x91, 0x88, 0x88, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x84, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x88, 0x88, 0x91, 0x91, 0x99, 0x99, 0x99, 0x88, 0x76,
-    0x5f, 0x41, 0x37, 0x29, 0x25, 0x25, 0x2a, 0x2a, 0x2c, 0x2a, 0x2a, 0x31,
-    0x31, 0x36, 0x36, 0x36, 0x36, 0x36, 0x31, 0x2a, 0x25, 0x25, 0x26, 0x2d,
-    0x97, 0xa3, 0xa9, 0x99, 0x97, 0x90, 0x8a, 0x8a, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x7a, 0x7d, 0x7d, 0x7a, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x8a, 0x82, 0x88, 0x8a, 0x82,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x89,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90,
-    0x90, 0x90, 0x94, 0x94, 0x90, 0x90, 0x94, 0x94, 0x97, 0x99, 0x99, 0x99,
-    0xa3, 0xa7, 0xaa, 0xa7, 0xaa, 0xaa, 0xaa, 0xb4, 0xb4, 0xb8, 0xbf, 0xbf,
-    0xcb, 0xcb, 0xd8, 0xd8, 0xd8, 0xcc, 0xbf, 0xaa, 0x89, 0x66, 0x37, 0x26,
-    0x0e, 0x03, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x05,
-    0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x08, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0e, 0x11, 0x11, 0x0e, 0x11, 0x0a, 0x0a, 0x08, 0x0a, 0x0a, 0x0a, 0x08,
-    0x0a, 0x07, 0x0e, 0x19, 0x26, 0x37, 0x4e, 0x71, 0x89, 0x9f, 0xb4, 0xcc,
-    0xcc, 0xd8, 0xd8, 0xdf, 0xdf, 0xdf, 0xd8, 0xd8, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xaa, 0xaa, 0xaa, 0xaa, 0xa7, 0xaa, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa3, 0xa7, 0x9d, 0x9d, 0x9d, 0x9d, 0xa3, 0xa3,
-    0xa3, 0x9d, 0x9d, 0x9d, 0x99, 0x99, 0x99, 0x99, 0x9d, 0x99, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x94, 0x97, 0x97, 0x97, 0x94, 0x97, 0x97, 0x94,
-    0x97, 0x97, 0x94, 0x90, 0x94, 0x94, 0x91, 0x91, 0x91, 0x94, 0x91, 0x90,
-    0x91, 0x91, 0x91, 0x8a, 0x88, 0x88, 0x88, 0x8a, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x88, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x78, 0x7d, 0x78, 0x81, 0x7d, 0x81, 0x81, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x76, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x81, 0x81, 0x88, 0x91, 0x91, 0x97, 0x91, 0x78, 0x6a, 0x53, 0x3e, 0x31,
-    0x29, 0x25, 0x2a, 0x2a, 0x2a, 0x31, 0x31, 0x31, 0x36, 0x36, 0x36, 0x37,
-    0x36, 0x36, 0x31, 0x2a, 0x1f, 0x1f, 0x26, 0x2d, 0x97, 0x9d, 0x99, 0x90,
-    0x8a, 0x82, 0x81, 0x82, 0x7a, 0x7d, 0x7a, 0x76, 0x7a, 0x76, 0x76, 0x76,
-    0x76, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7a, 0x82, 0x82, 0x81, 0x81, 0x81,
-    0x82, 0x82, 0x89, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x88, 0x8a, 0x82, 0x88, 0x8a, 0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x88, 0x8a,
-    0x8a, 0x8a, 0x88, 0x88, 0x8a, 0x89, 0x8a, 0x89, 0x89, 0x89, 0x94, 0x94,
-    0x94, 0x90, 0x90, 0x94, 0x9d, 0x97, 0x99, 0x99, 0x99, 0x99, 0xa3, 0xa7,
-    0xa7, 0xac, 0xa9, 0xaa, 0xb4, 0xb4, 0xb4, 0xbf, 0xbf, 0xcb, 0xcb, 0xd8,
-    0xd8, 0xd8, 0xcc, 0xbf, 0xaa, 0x89, 0x5b, 0x34, 0x1f, 0x0e, 0x05, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x05, 0x05, 0x05,
-    0x03, 0x04, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0a, 0x0e, 0x1e, 0x28,
-    0x3d, 0x5b, 0x7a, 0x9d, 0xaa, 0xb6, 0xcc, 0xd8, 0xd8, 0xdf, 0xdf, 0xd8,
-    0xd8, 0xd8, 0xcc, 0xcc, 0xcc, 0xcb, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xaa, 0xaa, 0xaa, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa9, 0xa3, 0xa7, 0xa3, 0x9d, 0xa3, 0xa3, 0x9d, 0xa3,
-    0xa3, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x99, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x99, 0x99, 0x99, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x94, 0x94,
-    0x94, 0x97, 0x97, 0x90, 0x97, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x90,
-    0x94, 0x94, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x88, 0x8a, 0x88,
-    0x88, 0x88, 0x88, 0x8a, 0x88, 0x8a, 0x88, 0x88, 0x81, 0x88, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x7d, 0x81, 0x7d, 0x76, 0x7d, 0x7d,
-    0x76, 0x76, 0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x76, 0x76, 0x76, 0x76, 0x76, 0x81,
-    0x88, 0x88, 0x91, 0x81, 0x6e, 0x5f, 0x44, 0x2d, 0x2a, 0x2a, 0x2a, 0x31,
-    0x31, 0x36, 0x31, 0x37, 0x36, 0x36, 0x36, 0x36, 0x3f, 0x36, 0x31, 0x25,
-    0x1f, 0x1f, 0x26, 0x2d, 0x97, 0x97, 0x90, 0x8a, 0x83, 0x7a, 0x7a, 0x7a,
-    0x76, 0x7a, 0x76, 0x76, 0x75, 0x7b, 0x71, 0x74, 0x7a, 0x7a, 0x7a, 0x7a,
-    0x76, 0x7a, 0x7a, 0x7a, 0x7a, 0x7d, 0x7d, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x84, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x82, 0x8a, 0x8a, 0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x89, 0x90, 0x90, 0x8a, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x97, 0x97, 0x97, 0x97, 0x9d, 0x9d, 0x9d, 0xa7, 0xa9, 0xa9, 0xac, 0xaa,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xc1, 0xbf, 0xcb, 0xcc, 0xd8, 0xd8, 0xd8, 0xcc,
-    0xbf, 0xaa, 0x82, 0x5b, 0x34, 0x1f, 0x07, 0x03, 0x02, 0x00, 0x02, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x05, 0x03, 0x03, 0x03, 0x03,
-    0x05, 0x05, 0x05, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x04, 0x01,
-    0x01, 0x03, 0x03, 0x0a, 0x0e, 0x1e, 0x29, 0x44, 0x66, 0x89, 0x9f, 0xb4,
-    0xcc, 0xcc, 0xd8, 0xd8, 0xdf, 0xdf, 0xd8, 0xd8, 0xcc, 0xcc, 0xcb, 0xbf,
-    0xcc, 0xbf, 0xc1, 0xb4, 0xb4, 0xb4, 0xb4, 0xb8, 0xb4, 0xb4, 0xb4, 0xaa,
-    0xaa, 0xaa, 0xa7, 0xaa, 0xaa, 0xa7, 0xa7, 0xa7, 0xa9, 0xa7, 0xa7, 0xa3,
-    0xa3, 0x99, 0x99, 0x9d, 0x9d, 0x9d, 0x99, 0x9d, 0x99, 0x9d, 0x99, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x99, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x9d, 0x97, 0x97, 0x9d, 0x94, 0x91, 0x97, 0x94, 0x91, 0x90, 0x90, 0x90,
-    0x90, 0x91, 0x90, 0x94, 0x90, 0x90, 0x91, 0x91, 0x94, 0x90, 0x91, 0x91,
-    0x91, 0x91, 0x89, 0x91, 0x8a, 0x88, 0x8a, 0x88, 0x8a, 0x88, 0x88, 0x84,
-    0x88, 0x88, 0x88, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x78, 0x7d,
-    0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x78, 0x75, 0x78,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x75, 0x74, 0x75, 0x74, 0x74,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x6c, 0x74, 0x74, 0x76, 0x7d, 0x81, 0x81,
-    0x6e, 0x5f, 0x41, 0x37, 0x31, 0x2a, 0x2a, 0x31, 0x31, 0x36, 0x36, 0x36,
-    0x3f, 0x3f, 0x36, 0x3f, 0x36, 0x36, 0x31, 0x25, 0x1f, 0x1f, 0x26, 0x29,
-    0x90, 0x8b, 0x8a, 0x83, 0x7b, 0x7b, 0x71, 0x74, 0x6f, 0x6f, 0x6f, 0x75,
-    0x6f, 0x6f, 0x71, 0x75, 0x6f, 0x71, 0x74, 0x75, 0x75, 0x7b, 0x7a, 0x78,
-    0x76, 0x76, 0x7d, 0x7a, 0x7d, 0x82, 0x7d, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x88, 0x82, 0x81, 0x81, 0x82, 0x82,
-    0x88, 0x88, 0x8a, 0x82, 0x8a, 0x82, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x89, 0x8a, 0x8a, 0x90, 0x94, 0x90, 0x94, 0x90, 0x94, 0x97, 0x97, 0x9d,
-    0x9d, 0x99, 0x99, 0x99, 0xa3, 0xa9, 0xa9, 0xac, 0xa9, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xbf, 0xbf, 0xcb, 0xcb, 0xd8, 0xd8, 0xd8, 0xcc, 0xb4, 0x9d, 0x82,
-    0x4e, 0x2d, 0x1b, 0x0a, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x0e,
-    0x1e, 0x2d, 0x44, 0x66, 0x89, 0xaa, 0xbf, 0xcc, 0xd8, 0xd8, 0xd8, 0xdf,
-    0xd8, 0xd8, 0xcc, 0xcc, 0xcc, 0xbf, 0xbf, 0xbf, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb8, 0xb3, 0xaa, 0xaa, 0xaa, 0xaa, 0xa7, 0xa7, 0xa9,
-    0xaa, 0xa7, 0xa7, 0xa3, 0xa3, 0xa3, 0xa3, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x9d, 0x99, 0x9d, 0x9d, 0x9d, 0x99, 0x99, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x94, 0x94, 0x97, 0x97, 0x94,
-    0x91, 0x97, 0x97, 0x97, 0x97, 0x90, 0x91, 0x90, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x89, 0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x81, 0x88, 0x81, 0x81, 0x81,
-    0x84, 0x81, 0x84, 0x7d, 0x7d, 0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x76, 0x75, 0x74, 0x75,
-    0x75, 0x74, 0x75, 0x75, 0x75, 0x6e, 0x6c, 0x6e, 0x6e, 0x6e, 0x6e, 0x6c,
-    0x6e, 0x6c, 0x6c, 0x6a, 0x6c, 0x75, 0x76, 0x76, 0x71, 0x56, 0x41, 0x3e,
-    0x37, 0x31, 0x31, 0x31, 0x36, 0x37, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
-    0x3f, 0x36, 0x31, 0x26, 0x1f, 0x1f, 0x26, 0x28, 0x8a, 0x88, 0x7a, 0x7a,
-    0x71, 0x6f, 0x6c, 0x6c, 0x6e, 0x71, 0x6c, 0x71, 0x6c, 0x6c, 0x71, 0x71,
-    0x6c, 0x6e, 0x74, 0x74, 0x75, 0x7a, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
-    0x7a, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82,
-    0x81, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x89, 0x88, 0x88, 0x88, 0x8a, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x89, 0x94, 0x90, 0x94, 0x94, 0x97, 0x97, 0x94, 0x97, 0x99, 0x99, 0x99,
-    0xa3, 0xa7, 0xa7, 0xa7, 0xa9, 0xaa, 0xb3, 0xb4, 0xb4, 0xb8, 0xbf, 0xbf,
-    0xcb, 0xcc, 0xd8, 0xd8, 0xd8, 0xcb, 0xb4, 0xa3, 0x7a, 0x4e, 0x2d, 0x19,
-    0x0a, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x02, 0x01, 0x05, 0x0e, 0x1e, 0x2d, 0x4e, 0x71, 0x90,
-    0xaa, 0xbf, 0xcc, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xcc, 0xcc, 0xcc, 0xbf,
-    0xbf, 0xbf, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xaa, 0xaa, 0xa7,
-    0xaa, 0xa7, 0xa7, 0xa7, 0xa7, 0xaa, 0xaa, 0xa7, 0xa9, 0xa7, 0xa7, 0xa3,
-    0xa3, 0xa3, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x99, 0x99, 0x9d, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x99, 0x99, 0x97, 0x9d, 0x9d, 0x99, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x97, 0x97, 0x9d, 0x97, 0x94, 0x94, 0x97, 0x94, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x90, 0x91, 0x90, 0x91, 0x91, 0x94, 0x91, 0x91, 0x91, 0x89, 0x91,
-    0x8a, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81,
-    0x88, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x74, 0x74, 0x75,
-    0x75, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x6e, 0x6c, 0x6e, 0x6e, 0x6e, 0x6e, 0x6a, 0x6a, 0x6a, 0x6a, 0x63, 0x63,
-    0x68, 0x63, 0x6a, 0x6c, 0x63, 0x53, 0x3e, 0x37, 0x2d, 0x2c, 0x31, 0x36,
-    0x36, 0x36, 0x3f, 0x45, 0x45, 0x45, 0x45, 0x45, 0x3f, 0x37, 0x2a, 0x25,
-    0x1b, 0x1a, 0x1e, 0x26, 0x8b, 0x78, 0x7a, 0x75, 0x6f, 0x6f, 0x6e, 0x6c,
-    0x6f, 0x6a, 0x6c, 0x6c, 0x6c, 0x6c, 0x71, 0x71, 0x6f, 0x6e, 0x6e, 0x6e,
-    0x74, 0x75, 0x75, 0x71, 0x7a, 0x7a, 0x76, 0x76, 0x7a, 0x7a, 0x78, 0x7d,
-    0x7d, 0x7d, 0x7a, 0x7d, 0x82, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x88, 0x88,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x94, 0x94,
-    0x90, 0x90, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0xa3, 0xa3, 0xa9,
-    0xac, 0xaa, 0xaa, 0xb4, 0xb4, 0xb4, 0xbf, 0xbf, 0xbf, 0xcb, 0xcb, 0xd8,
-    0xd8, 0xd8, 0xcb, 0xb4, 0x99, 0x7a, 0x4e, 0x29, 0x19, 0x08, 0x05, 0x02,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
-    0x01, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x01,
-    0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x02, 0x05,
-    0x05, 0x0e, 0x1f, 0x34, 0x4e, 0x71, 0x94, 0xac, 0xbf, 0xcc, 0xcc, 0xd8,
-    0xd8, 0xd8, 0xcc, 0xcc, 0xcc, 0xbf, 0xbf, 0xbf, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb8, 0xb4, 0xaa, 0xaa, 0xa9, 0xa7, 0xaa, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa3, 0xa3, 0xa3, 0xa7, 0xa3, 0x9d, 0x99, 0x9d, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x99, 0x99, 0x9d, 0x9d, 0x97, 0x9d, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x9d, 0x97, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x94,
-    0x97, 0x91, 0x97, 0x94, 0x97, 0x97, 0x91, 0x91, 0x90, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x84, 0x84, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x7d, 0x78, 0x76, 0x76, 0x78, 0x76, 0x76, 0x75, 0x75, 0x76,
-    0x76, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x74, 0x75, 0x75, 0x75, 0x75, 0x6c, 0x6c, 0x6e, 0x6c, 0x6e, 0x6e,
-    0x6e, 0x6a, 0x6c, 0x6a, 0x6a, 0x63, 0x63, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x53, 0x41, 0x37, 0x31, 0x2c, 0x29, 0x2c, 0x31, 0x36, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x3f, 0x36, 0x2a, 0x25, 0x1a, 0x19, 0x1e, 0x26,
-    0x83, 0x7b, 0x75, 0x6f, 0x66, 0x69, 0x6a, 0x6a, 0x69, 0x69, 0x6a, 0x6a,
-    0x6a, 0x6a, 0x69, 0x66, 0x6a, 0x6a, 0x6e, 0x6e, 0x6e, 0x75, 0x75, 0x74,
-    0x71, 0x76, 0x76, 0x7b, 0x78, 0x78, 0x7a, 0x7a, 0x78, 0x76, 0x76, 0x7d,
-    0x7a, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x90, 0x94, 0x90, 0x90, 0x97, 0x97,
-    0x94, 0x94, 0x9d, 0x9d, 0x99, 0x9d, 0xa3, 0xaa, 0xa7, 0xaa, 0xaa, 0xac,
-    0xb4, 0xb4, 0xb4, 0xbf, 0xbf, 0xbf, 0xcb, 0xcc, 0xd8, 0xd8, 0xd8, 0xcb,
-    0xb4, 0x99, 0x71, 0x44, 0x29, 0x19, 0x05, 0x05, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x0e, 0x1f, 0x34, 0x4f,
-    0x71, 0x9f, 0xaa, 0xbf, 0xcc, 0xcc, 0xd8, 0xcc, 0xcc, 0xcc, 0xcc, 0xbf,
-    0xbf, 0xc1, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xac, 0xac, 0xaa, 0xa9,
-    0xa9, 0xa9, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa3, 0xa7, 0xa7, 0xa7, 0xa3,
-    0xa3, 0x9d, 0xa3, 0x99, 0x99, 0x99, 0x9d, 0x9d, 0x99, 0x99, 0x9d, 0x9d,
-    0x97, 0x97, 0x97, 0x9d, 0x97, 0x97, 0x97, 0x97, 0x97, 0x9d, 0x9d, 0x97,
-    0x97, 0x97, 0x9d, 0x94, 0x9d, 0x91, 0x97, 0x97, 0x97, 0x97, 0x97, 0x94,
-    0x97, 0x97, 0x90, 0x97, 0x91, 0x91, 0x90, 0x91, 0x91, 0x91, 0x90, 0x91,
-    0x91, 0x88, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x7d, 0x7d, 0x7d, 0x76, 0x76, 0x78,
-    0x76, 0x76, 0x76, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x6e, 0x75, 0x75, 0x75, 0x74, 0x75, 0x75, 0x74,
-    0x74, 0x75, 0x75, 0x74, 0x74, 0x6c, 0x75, 0x6e, 0x6e, 0x6c, 0x6c, 0x68,
-    0x63, 0x63, 0x5f, 0x56, 0x56, 0x56, 0x53, 0x4a, 0x41, 0x37, 0x31, 0x2a,
-    0x2c, 0x25, 0x2c, 0x31, 0x36, 0x45, 0x45, 0x45, 0x45, 0x45, 0x41, 0x45,
-    0x45, 0x36, 0x2c, 0x1f, 0x1e, 0x16, 0x16, 0x1e, 0x7b, 0x75, 0x6f, 0x66,
-    0x6a, 0x63, 0x63, 0x63, 0x69, 0x63, 0x63, 0x63, 0x68, 0x6a, 0x69, 0x6a,
-    0x6a, 0x6c, 0x6a, 0x6e, 0x6e, 0x6e, 0x6e, 0x74, 0x75, 0x75, 0x74, 0x75,
-    0x75, 0x78, 0x76, 0x7a, 0x76, 0x78, 0x76, 0x7a, 0x78, 0x78, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x81, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x89, 0x90, 0x90, 0x90, 0x90, 0x97, 0x97, 0x97, 0x99,
-    0x99, 0x99, 0x99, 0xa7, 0xa7, 0xa7, 0xa9, 0xa9, 0xb3, 0xb4, 0xb4, 0xb4,
-    0xbf, 0xbf, 0xcb, 0xcc, 0xd8, 0xd8, 0xd8, 0xd8, 0xcb, 0xb4, 0x97, 0x71,
-    0x44, 0x28, 0x0e, 0x03, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x01, 0x03, 0x0e, 0x1e, 0x34, 0x4e, 0x7a, 0x9f, 0xac, 0xbf, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xbf, 0xbf, 0xbf, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb8, 0xb4, 0xa9, 0xac, 0xa9, 0xa9, 0xa7, 0xa9, 0xa9, 0xa7, 0xa7, 0xa7,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa7, 0x9d, 0x9d, 0xa3, 0xa3, 0x9d, 0x99, 0x99,
-    0x99, 0x9d, 0x99, 0x9d, 0x99, 0x97, 0x97, 0x9d, 0x97, 0x97, 0x97, 0x94,
-    0x94, 0x97, 0x97, 0x94, 0x94, 0x94, 0x97, 0x9d, 0x9d, 0x97, 0x97, 0x97,
-    0x91, 0x94, 0x97, 0x94, 0x94, 0x97, 0x97, 0x97, 0x94, 0x94, 0x94, 0x97,
-    0x90, 0x91, 0x91, 0x94, 0x90, 0x90, 0x91, 0x88, 0x91, 0x8a, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x76, 0x75,
-    0x74, 0x75, 0x74, 0x75, 0x6c, 0x6c, 0x6c, 0x75, 0x6e, 0x75, 0x6e, 0x6e,
-    0x6c, 0x6c, 0x75, 0x74, 0x74, 0x75, 0x75, 0x74, 0x75, 0x75, 0x74, 0x74,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x6c, 0x6c, 0x6a, 0x63, 0x5f, 0x56, 0x56,
-    0x4a, 0x49, 0x45, 0x3f, 0x36, 0x31, 0x2a, 0x25, 0x25, 0x26, 0x2c, 0x36,
-    0x36, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x36, 0x2c, 0x1f,
-    0x1a, 0x1a, 0x16, 0x16, 0x6c, 0x71, 0x69, 0x66, 0x69, 0x63, 0x63, 0x68,
-    0x63, 0x63, 0x63, 0x63, 0x66, 0x68, 0x68, 0x63, 0x6a, 0x6a, 0x6a, 0x6c,
-    0x6f, 0x6e, 0x6e, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x76, 0x76, 0x7a, 0x76, 0x76, 0x7d, 0x7d, 0x81, 0x81, 0x81, 0x82, 0x81,
-    0x82, 0x81, 0x81, 0x82, 0x82, 0x81, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82,
-    0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x90, 0x94, 0x90, 0x90, 0x97, 0x97, 0x97, 0x99, 0x9d, 0x9d, 0xa3,
-    0xa7, 0xa7, 0xa9, 0xa9, 0xaa, 0xb4, 0xb4, 0xb4, 0xb8, 0xc1, 0xbf, 0xc1,
-    0xcb, 0xd8, 0xd8, 0xd8, 0xd8, 0xcb, 0xb4, 0x9d, 0x71, 0x3d, 0x26, 0x0e,
-    0x03, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x01, 0x00,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x08, 0x1e,
-    0x34, 0x5b, 0x7a, 0xa1, 0xb4, 0xb6, 0xcc, 0xcc, 0xcb, 0xcc, 0xc1, 0xbf,
-    0xbf, 0xb4, 0xb4, 0xb4, 0xb4, 0xb8, 0xb4, 0xaa, 0xa9, 0xaa, 0xaa, 0xa9,
-    0xa7, 0xaa, 0xaa, 0xa7, 0xa7, 0xa3, 0xa3, 0x9d, 0x99, 0x99, 0xa3, 0x99,
-    0x9d, 0x9d, 0x99, 0x9d, 0x99, 0x99, 0x99, 0x9d, 0x9d, 0x99, 0x99, 0x9d,
-    0x9d, 0x97, 0x97, 0x94, 0x97, 0x97, 0x94, 0x97, 0x94, 0x94, 0x97, 0x97,
-    0x94, 0x97, 0x97, 0x97, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x97, 0x91,
-    0x94, 0x97, 0x97, 0x97, 0x97, 0x91, 0x90, 0x91, 0x90, 0x90, 0x91, 0x91,
-    0x91, 0x91, 0x93, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x7d, 0x76, 0x76, 0x78,
-    0x75, 0x75, 0x75, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74, 0x6e,
-    0x75, 0x6e, 0x6c, 0x6e, 0x6c, 0x6c, 0x6e, 0x6e, 0x6c, 0x6e, 0x75, 0x74,
-    0x74, 0x75, 0x75, 0x75, 0x74, 0x76, 0x76, 0x76, 0x76, 0x76, 0x78, 0x78,
-    0x75, 0x75, 0x6e, 0x6a, 0x68, 0x5f, 0x56, 0x4a, 0x41, 0x3f, 0x3f, 0x3f,
-    0x2a, 0x25, 0x1b, 0x1b, 0x1b, 0x1f, 0x25, 0x31, 0x3f, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x36, 0x2c, 0x1f, 0x1a, 0x0e, 0x0a, 0x16,
-    0x69, 0x6a, 0x66, 0x63, 0x66, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f, 0x63, 0x5f,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x6a, 0x6a, 0x6a, 0x6a, 0x6e, 0x6e, 0x6e,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x74, 0x75, 0x75, 0x75, 0x76, 0x76, 0x76,
-    0x7a, 0x7a, 0x7d, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x89, 0x82, 0x82, 0x8a, 0x8a, 0x8a,
-    0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x90, 0x90,
-    0x94, 0x94, 0x94, 0x97, 0x99, 0x9d, 0x9d, 0x99, 0xa3, 0xa3, 0xa7, 0xaa,
-    0xaa, 0xaa, 0xb3, 0xb4, 0xb8, 0xc1, 0xbf, 0xbf, 0xcb, 0xcb, 0xd8, 0xd8,
-    0xd8, 0xd8, 0xcb, 0xb4, 0x90, 0x66, 0x3d, 0x26, 0x0e, 0x03, 0x01, 0x01,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x05, 0x0a, 0x1e, 0x2d, 0x4e, 0x7a, 0x99, 0xb8,
-    0xbf, 0xcc, 0xcc, 0xcc, 0xcc, 0xbf, 0xb8, 0xb8, 0xb8, 0xb8, 0xb4, 0xb4,
-    0xac, 0xb1, 0xaa, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0x9d, 0x9d, 0x9d, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9d, 0x99,
-    0x9d, 0x99, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x94,
-    0x94, 0x94, 0x97, 0x97, 0x94, 0x94, 0x97, 0x97, 0x97, 0x91, 0x97, 0x94,
-    0x97, 0x94, 0x97, 0x94, 0x94, 0x97, 0x97, 0x91, 0x94, 0x97, 0x97, 0x97,
-    0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x90, 0x89, 0x8a, 0x8a, 0x8a,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x82, 0x81, 0x7d, 0x76, 0x76, 0x76, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x74, 0x75, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
-    0x6c, 0x6c, 0x6c, 0x6e, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-    0x76, 0x76, 0x7d, 0x7d, 0x81, 0x81, 0x81, 0x84, 0x81, 0x76, 0x75, 0x6a,
-    0x63, 0x5f, 0x53, 0x41, 0x3f, 0x36, 0x31, 0x20, 0x20, 0x17, 0x17, 0x0c,
-    0x19, 0x1b, 0x25, 0x2a, 0x36, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x3f, 0x37, 0x2a, 0x25, 0x1b, 0x0e, 0x0a, 0x08, 0x69, 0x5b, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x63, 0x68,
-    0x63, 0x6a, 0x6a, 0x6a, 0x6a, 0x6e, 0x6e, 0x6e, 0x6e, 0x6c, 0x74, 0x75,
-    0x74, 0x76, 0x75, 0x75, 0x76, 0x7a, 0x76, 0x76, 0x7a, 0x7a, 0x7d, 0x7a,
-    0x81, 0x81, 0x82, 0x7d, 0x78, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82,
-    0x89, 0x81, 0x81, 0x82, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x88, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x90, 0x90, 0x90, 0x90, 0x97, 0x97, 0x9d,
-    0x97, 0x99, 0x9d, 0x9d, 0x99, 0xa7, 0xaa, 0xa7, 0xaa, 0xaa, 0xac, 0xb4,
-    0xb4, 0xb4, 0xc1, 0xbf, 0xbf, 0xcb, 0xcc, 0xd8, 0xdf, 0xd8, 0xd3, 0xbf,
-    0xac, 0x90, 0x66, 0x3d, 0x1f, 0x0e, 0x03, 0x05, 0x02, 0x01, 0x00, 0x02,
-    0x02, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x00, 0x01, 0x01, 0x01,
-    0x0a, 0x19, 0x2d, 0x4e, 0x71, 0x97, 0xac, 0xbf, 0xcc, 0xcc, 0xcb, 0xbf,
-    0xbf, 0xb4, 0xb4, 0xb8, 0xb4, 0xb8, 0xa9, 0xaa, 0xa7, 0xaa, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0x9d, 0x9d, 0x99, 0x9d, 0x9d, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x9d, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9d, 0x99, 0x99, 0x99,
-    0x99, 0x9d, 0x9d, 0x99, 0x9d, 0x9d, 0x97, 0x97, 0x97, 0x9d, 0x97, 0x91,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x94, 0x97, 0x97, 0x97,
-    0x97, 0x94, 0x91, 0x91, 0x97, 0x91, 0x91, 0x90, 0x90, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x8a, 0x89, 0x89, 0x88, 0x8a, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x81, 0x7d, 0x7d, 0x7d,
-    0x76, 0x76, 0x75, 0x74, 0x75, 0x75, 0x75, 0x75, 0x6e, 0x6c, 0x75, 0x6c,
-    0x6e, 0x6e, 0x6c, 0x6e, 0x6c, 0x6e, 0x6e, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x75, 0x75, 0x74, 0x76, 0x76, 0x76, 0x78, 0x7d, 0x81, 0x81, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x81, 0x7d, 0x75, 0x6e, 0x63, 0x56, 0x49, 0x3f,
-    0x3f, 0x2a, 0x20, 0x20, 0x20, 0x17, 0x0c, 0x0c, 0x0c, 0x19, 0x1f, 0x2a,
-    0x36, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x3f, 0x37, 0x2a, 0x25,
-    0x1a, 0x0e, 0x0a, 0x0a, 0x5b, 0x5f, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x63, 0x63, 0x63, 0x63, 0x6a, 0x6a,
-    0x6a, 0x6a, 0x6e, 0x6e, 0x6c, 0x75, 0x74, 0x74, 0x74, 0x75, 0x74, 0x74,
-    0x74, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x78, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x81, 0x84, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x82,
-    0x82, 0x8a, 0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x90, 0x90, 0x90, 0x90, 0x94, 0x94, 0x9d, 0x97, 0x99, 0x9d, 0x99,
-    0xa3, 0xa3, 0xa7, 0xa9, 0xaa, 0xac, 0xac, 0xac, 0xb4, 0xb8, 0xb8, 0xbf,
-    0xc1, 0xbf, 0xcb, 0xcc, 0xd8, 0xd8, 0xd8, 0xd8, 0xbf, 0xaa, 0x89, 0x66,
-    0x37, 0x1e, 0x07, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01,
-    0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01,
-    0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x05, 0x03, 0x19, 0x28, 0x44, 0x71,
-    0x90, 0xac, 0xc1, 0xcc, 0xcc, 0xcc, 0xbf, 0xb4, 0xb4, 0xb4, 0xb8, 0xaa,
-    0xaa, 0xaa, 0xac, 0xa9, 0xaa, 0xaa, 0xa7, 0xa7, 0xa3, 0x9d, 0x9d, 0x9d,
-    0x9d, 0x99, 0x99, 0x9d, 0x99, 0x99, 0x99, 0x9d, 0x99, 0x99, 0x9d, 0x99,
-    0x99, 0x9d, 0x99, 0x99, 0x9d, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9d,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x94, 0x94, 0x94, 0x97, 0x97, 0x97, 0x97,
-    0x94, 0x97, 0x97, 0x94, 0x97, 0x97, 0x97, 0x91, 0x97, 0x97, 0x91, 0x97,
-    0x94, 0x91, 0x91, 0x91, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x88, 0x88, 0x8a, 0x89, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x76, 0x76, 0x76, 0x75, 0x74,
-    0x74, 0x75, 0x6c, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6c, 0x6c,
-    0x6e, 0x6e, 0x6e, 0x6e, 0x75, 0x75, 0x74, 0x74, 0x74, 0x78, 0x76, 0x7d,
-    0x7d, 0x81, 0x81, 0x88, 0x88, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x88, 0x81, 0x75, 0x6e, 0x63, 0x53, 0x41, 0x3f, 0x31, 0x20, 0x20, 0x20,
-    0x10, 0x0d, 0x0c, 0x07, 0x07, 0x19, 0x1f, 0x2a, 0x36, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x3f, 0x37, 0x2a, 0x25, 0x1a, 0x0e, 0x0a, 0x05,
-    0x57, 0x56, 0x53, 0x53, 0x53, 0x53, 0x4e, 0x55, 0x56, 0x56, 0x5b, 0x56,
-    0x55, 0x5e, 0x5f, 0x5f, 0x63, 0x63, 0x63, 0x6a, 0x6a, 0x6a, 0x6e, 0x6e,
-    0x6e, 0x75, 0x6f, 0x6f, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74, 0x74, 0x76,
-    0x7a, 0x76, 0x7a, 0x78, 0x76, 0x78, 0x7d, 0x7d, 0x7d, 0x82, 0x7a, 0x7a,
-    0x7d, 0x7d, 0x81, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x94, 0x94, 0x97, 0x99, 0x99, 0x99, 0x99, 0x9d, 0xa7, 0xa9,
-    0xa9, 0xac, 0xac, 0xa9, 0xb8, 0xb8, 0xb8, 0xb4, 0xc1, 0xbf, 0xcb, 0xcb,
-    0xd3, 0xd8, 0xd8, 0xd8, 0xd3, 0xbf, 0xac, 0x8a, 0x5b, 0x34, 0x1e, 0x08,
-    0x03, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x05, 0x05, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x02, 0x05, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x02,
-    0x01, 0x01, 0x03, 0x0e, 0x26, 0x3c, 0x66, 0x8a, 0xaa, 0xb4, 0xbf, 0xcb,
-    0xcc, 0xbf, 0xb4, 0xb4, 0xb4, 0xaa, 0xac, 0xaa, 0xac, 0xa9, 0xa9, 0xa7,
-    0x9f, 0x9f, 0xa3, 0x9d, 0x9d, 0x9d, 0x9d, 0x99, 0x9d, 0x9d, 0x99, 0x99,
-    0x99, 0x99, 0x9d, 0x9d, 0x99, 0x97, 0x9d, 0x97, 0x97, 0x9d, 0x9d, 0x97,
-    0x9d, 0x9d, 0x9d, 0x97, 0x9d, 0x97, 0x97, 0x9d, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x94, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x90, 0x90, 0x91, 0x91,
-    0x90, 0x90, 0x90, 0x94, 0x91, 0x91, 0x91, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x81, 0x82, 0x81, 0x81, 0x81, 0x7d, 0x78, 0x7d, 0x78,
-    0x76, 0x76, 0x76, 0x78, 0x75, 0x76, 0x74, 0x74, 0x71, 0x74, 0x6c, 0x6e,
-    0x6e, 0x6e, 0x6e, 0x6e, 0x6c, 0x6e, 0x6c, 0x6c, 0x6e, 0x6e, 0x6e, 0x6e,
-    0x74, 0x74, 0x76, 0x76, 0x76, 0x7d, 0x81, 0x81, 0x88, 0x91, 0x91, 0x91,
-    0x97, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x90, 0x88, 0x81, 0x75, 0x6a,
-    0x5f, 0x4a, 0x3f, 0x31, 0x2a, 0x20, 0x20, 0x10, 0x0d, 0x0c, 0x07, 0x07,
-    0x07, 0x19, 0x1f, 0x2c, 0x36, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x3f, 0x37, 0x2c, 0x25, 0x1a, 0x0e, 0x0a, 0x05, 0x53, 0x53, 0x52, 0x52,
-    0x4a, 0x4a, 0x53, 0x4d, 0x52, 0x53, 0x57, 0x56, 0x56, 0x56, 0x5b, 0x5f,
-    0x66, 0x5e, 0x68, 0x66, 0x6a, 0x6a, 0x6a, 0x6e, 0x6e, 0x6e, 0x6f, 0x6f,
-    0x75, 0x75, 0x75, 0x71, 0x75, 0x75, 0x75, 0x74, 0x74, 0x7a, 0x76, 0x78,
-    0x78, 0x76, 0x7a, 0x7a, 0x7d, 0x7a, 0x7d, 0x7d, 0x82, 0x82, 0x81, 0x82,
-    0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x90, 0x90, 0x90, 0x90, 0x94, 0x90, 0x97, 0x97, 0x94,
-    0x97, 0x99, 0x99, 0x9d, 0x99, 0xa3, 0xa3, 0xa9, 0xa9, 0xa9, 0xac, 0xaa,
-    0xac, 0xb8, 0xb4, 0xb4, 0xb4, 0xbf, 0xc1, 0xcb, 0xcb, 0xd8, 0xd8, 0xdf,
-    0xd8, 0xcc, 0xbf, 0xac, 0x8a, 0x5b, 0x34, 0x1e, 0x07, 0x03, 0x05, 0x05,
-    0x05, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x03, 0x03, 0x05, 0x05,
-    0x05, 0x05, 0x03, 0x03, 0x05, 0x05, 0x03, 0x05, 0x01, 0x05, 0x0a, 0x1e,
-    0x2d, 0x4e, 0x82, 0x99, 0xb4, 0xbf, 0xcc, 0xcc, 0xbf, 0xb4, 0xb4, 0xaa,
-    0xac, 0xaa, 0xac, 0xa9, 0xa7, 0xa3, 0x9d, 0x9f, 0x99, 0x9d, 0x9d, 0x99,
-    0x9d, 0x9d, 0x99, 0x97, 0x9d, 0x97, 0x9d, 0x97, 0x97, 0x99, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x94, 0x94, 0x97, 0x9d, 0x9d, 0x9d, 0x97, 0x97,
-    0x97, 0x9d, 0x97, 0x97, 0x9d, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x94,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x91, 0x94, 0x94, 0x94, 0x94, 0x97,
-    0x91, 0x91, 0x97, 0x97, 0x91, 0x90, 0x91, 0x94, 0x90, 0x90, 0x91, 0x91,
-    0x91, 0x88, 0x88, 0x91, 0x89, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81,
-    0x82, 0x81, 0x81, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x76, 0x76, 0x78, 0x76,
-    0x75, 0x74, 0x74, 0x75, 0x75, 0x75, 0x6c, 0x6c, 0x6e, 0x6c, 0x6e, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x6e, 0x75, 0x75, 0x76, 0x76, 0x78, 0x84,
-    0x81, 0x88, 0x88, 0x91, 0x91, 0x99, 0x99, 0xa3, 0xa9, 0xa9, 0xa9, 0xa9,
-    0xa3, 0x99, 0x97, 0x91, 0x88, 0x7a, 0x75, 0x63, 0x56, 0x41, 0x36, 0x31,
-    0x20, 0x20, 0x10, 0x10, 0x0d, 0x0c, 0x07, 0x05, 0x0a, 0x16, 0x1f, 0x2c,
-    0x36, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x36, 0x36, 0x2c, 0x25,
-    0x1b, 0x0e, 0x0a, 0x05, 0x49, 0x49, 0x46, 0x52, 0x46, 0x52, 0x52, 0x4a,
-    0x52, 0x4a, 0x53, 0x53, 0x53, 0x56, 0x56, 0x56, 0x5e, 0x5f, 0x63, 0x63,
-    0x63, 0x63, 0x6a, 0x6c, 0x6a, 0x6e, 0x6e, 0x6e, 0x6e, 0x6c, 0x6f, 0x6c,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x78, 0x7a, 0x76, 0x76,
-    0x76, 0x7d, 0x7d, 0x7a, 0x7d, 0x7d, 0x82, 0x81, 0x81, 0x82, 0x81, 0x81,
-    0x82, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x8a, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x97, 0x97, 0x94, 0x97, 0x97, 0x99, 0x9d,
-    0x99, 0xa3, 0xa3, 0xa7, 0xa9, 0xac, 0xac, 0xa7, 0xa9, 0xac, 0xb8, 0xb4,
-    0xb4, 0xbf, 0xc1, 0xbf, 0xcb, 0xcc, 0xd8, 0xd8, 0xdf, 0xd8, 0xcc, 0xbf,
-    0xac, 0x82, 0x5b, 0x34, 0x1e, 0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x08, 0x19, 0x29, 0x43, 0x71, 0x97, 0xac,
-    0xbf, 0xcc, 0xb6, 0xb4, 0xb4, 0xb4, 0xaa, 0xac, 0xa9, 0xa3, 0xa3, 0xa3,
-    0x9d, 0x9d, 0x9d, 0x99, 0x99, 0x9d, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x9d, 0x97, 0x9d, 0x9d, 0x97, 0x97, 0x97, 0x97, 0x94, 0x94,
-    0x97, 0x94, 0x97, 0x97, 0x97, 0x97, 0x9d, 0x9d, 0x9d, 0x9d, 0x97, 0x97,
-    0x9d, 0x97, 0x97, 0x91, 0x9d, 0x97, 0x97, 0x94, 0x94, 0x91, 0x97, 0x94,
-    0x97, 0x97, 0x97, 0x97, 0x91, 0x94, 0x97, 0x91, 0x97, 0x91, 0x97, 0x91,
-    0x91, 0x91, 0x90, 0x91, 0x91, 0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x8a, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x8a, 0x88, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7d,
-    0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x78, 0x75, 0x75, 0x74, 0x74, 0x75,
-    0x75, 0x75, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6c, 0x74,
-    0x74, 0x74, 0x76, 0x76, 0x76, 0x81, 0x81, 0x88, 0x91, 0x91, 0x99, 0xa3,
-    0xa7, 0xa7, 0xa9, 0xb1, 0xb3, 0xb3, 0xa9, 0xa9, 0xa9, 0xa3, 0x97, 0x93,
-    0x84, 0x75, 0x69, 0x60, 0x52, 0x45, 0x36, 0x2a, 0x20, 0x20, 0x10, 0x10,
-    0x0c, 0x07, 0x07, 0x05, 0x0a, 0x1a, 0x1f, 0x2c, 0x36, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x3f, 0x3f, 0x37, 0x2a, 0x25, 0x1f, 0x0e, 0x0a, 0x05,
-    0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x49, 0x49, 0x49, 0x4a, 0x4a, 0x4a,
-    0x4d, 0x53, 0x56, 0x56, 0x56, 0x5f, 0x5f, 0x63, 0x68, 0x63, 0x63, 0x6a,
-    0x68, 0x6c, 0x6c, 0x6a, 0x6e, 0x6e, 0x6c, 0x6c, 0x71, 0x6c, 0x71, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x76, 0x78, 0x76, 0x78, 0x76, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x82, 0x81, 0x81, 0x82, 0x81, 0x81, 0x82, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x90, 0x90, 0x90, 0x94, 0x90, 0x90,
-    0x94, 0x90, 0x97, 0x97, 0x9d, 0x99, 0x99, 0x9d, 0x99, 0x99, 0xa3, 0xa3,
-    0xa7, 0xa9, 0xaa, 0xa9, 0xa9, 0xac, 0xaa, 0xb4, 0xb4, 0xb4, 0xb4, 0xbf,
-    0xbf, 0xcc, 0xcc, 0xd8, 0xd8, 0xdf, 0xd8, 0xd3, 0xbf, 0xa9, 0x82, 0x5b,
-    0x37, 0x1b, 0x0e, 0x0a, 0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x05,
-    0x0a, 0x0e, 0x26, 0x3c, 0x66, 0x8a, 0xa1, 0xb4, 0xbf, 0xbf, 0xb4, 0xac,
-    0xac, 0xaa, 0xa9, 0xa3, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x9d, 0x9d, 0x9d, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x94, 0x97,
-    0x94, 0x9d, 0x94, 0x97, 0x97, 0x94, 0x97, 0x97, 0x94, 0x97, 0x97, 0x94,
-    0x94, 0x97, 0x9d, 0x97, 0x91, 0x97, 0x97, 0x97, 0x9d, 0x97, 0x97, 0x9d,
-    0x9d, 0x97, 0x97, 0x97, 0x97, 0x94, 0x97, 0x94, 0x94, 0x97, 0x97, 0x97,
-    0x94, 0x94, 0x91, 0x91, 0x97, 0x90, 0x90, 0x94, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x91, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x8a, 0x84, 0x88,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x7d, 0x7d, 0x76, 0x76, 0x76,
-    0x76, 0x75, 0x75, 0x76, 0x74, 0x74, 0x74, 0x74, 0x75, 0x6c, 0x6e, 0x6e,
-    0x6c, 0x6e, 0x6e, 0x6e, 0x75, 0x75, 0x74, 0x74, 0x76, 0x76, 0x7d, 0x81,
-    0x88, 0x88, 0x91, 0x91, 0x99, 0xa3, 0xa9, 0xb1, 0xb1, 0xb3, 0xb8, 0xb1,
-    0xb3, 0xb3, 0xb3, 0xa9, 0xa3, 0x99, 0x90, 0x88, 0x78, 0x6e, 0x69, 0x57,
-    0x49, 0x3f, 0x31, 0x20, 0x20, 0x10, 0x10, 0x0d, 0x0c, 0x07, 0x05, 0x05,
-    0x07, 0x1a, 0x1f, 0x30, 0x37, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x3f, 0x31, 0x2a, 0x25, 0x1f, 0x19, 0x0a, 0x05, 0x3e, 0x3e, 0x3e, 0x3e,
-    0x46, 0x44, 0x46, 0x46, 0x49, 0x49, 0x49, 0x4a, 0x4a, 0x4a, 0x53, 0x56,
-    0x56, 0x56, 0x5b, 0x5e, 0x5e, 0x5e, 0x63, 0x63, 0x68, 0x66, 0x6a, 0x6a,
-    0x6a, 0x6c, 0x6c, 0x6a, 0x6c, 0x6c, 0x71, 0x6c, 0x75, 0x74, 0x75, 0x75,
-    0x74, 0x76, 0x76, 0x75, 0x78, 0x78, 0x78, 0x78, 0x76, 0x7d, 0x7d, 0x82,
-    0x81, 0x82, 0x81, 0x89, 0x82, 0x81, 0x82, 0x82, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x89, 0x89, 0x89, 0x94, 0x94, 0x94, 0x90, 0x90, 0x90, 0x90, 0x97, 0x97,
-    0x97, 0x9d, 0x9d, 0x99, 0x99, 0x99, 0x9d, 0xa3, 0xa7, 0xa7, 0xa7, 0xaa,
-    0xa9, 0xa9, 0xaa, 0xaa, 0xb4, 0xb4, 0xb4, 0xbf, 0xbf, 0xbf, 0xcb, 0xcc,
-    0xd8, 0xd8, 0xdf, 0xd8, 0xcb, 0xbf, 0xa9, 0x89, 0x5b, 0x2d, 0x1e, 0x0e,
-    0x0a, 0x0a, 0x07, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
-    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x0a, 0x0e, 0x1e, 0x2d, 0x4e,
-    0x7a, 0x97, 0xac, 0xb8, 0xb8, 0xb4, 0xac, 0xac, 0xaa, 0xa3, 0xa1, 0x9f,
-    0x99, 0x97, 0x97, 0x97, 0x9d, 0x9d, 0x97, 0x97, 0x97, 0x94, 0x9d, 0x97,
-    0x97, 0x97, 0x94, 0x94, 0x97, 0x97, 0x94, 0x94, 0x94, 0x94, 0x94, 0x97,
-    0x94, 0x97, 0x97, 0x97, 0x94, 0x97, 0x94, 0x94, 0x97, 0x97, 0x97, 0x94,
-    0x97, 0x97, 0x9d, 0x94, 0x9d, 0x97, 0x97, 0x91, 0x97, 0x97, 0x94, 0x9d,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x94, 0x97, 0x94, 0x94, 0x97, 0x97,
-    0x91, 0x91, 0x90, 0x91, 0x90, 0x90, 0x94, 0x90, 0x8a, 0x8a, 0x8a, 0x89,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x6c, 0x6c, 0x6e, 0x6e, 0x6c, 0x6c, 0x6c, 0x74,
-    0x75, 0x75, 0x76, 0x76, 0x7d, 0x81, 0x88, 0x91, 0x91, 0x9d, 0x9d, 0xa7,
-    0xa7, 0xb1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb8, 0xb3, 0xa9, 0xa9,
-    0x99, 0x90, 0x8a, 0x7a, 0x6f, 0x66, 0x57, 0x4a, 0x3f, 0x36, 0x2a, 0x20,
-    0x10, 0x10, 0x0d, 0x0c, 0x0c, 0x05, 0x05, 0x05, 0x0e, 0x1a, 0x26, 0x31,
-    0x3e, 0x45, 0x46, 0x41, 0x45, 0x45, 0x41, 0x3e, 0x37, 0x31, 0x31, 0x26,
-    0x1e, 0x1a, 0x0e, 0x0a, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x41, 0x46,
-    0x46, 0x46, 0x49, 0x49, 0x49, 0x4a, 0x52, 0x53, 0x56, 0x56, 0x56, 0x57,
-    0x5f, 0x5b, 0x5f, 0x66, 0x5e, 0x68, 0x63, 0x63, 0x6a, 0x68, 0x6a, 0x6a,
-    0x6e, 0x6e, 0x6e, 0x6f, 0x71, 0x6e, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x76, 0x78, 0x76, 0x7d, 0x82, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x88, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x89, 0x94,
-    0x94, 0x90, 0x94, 0x90, 0x90, 0x94, 0x97, 0x94, 0x94, 0x97, 0x97, 0x99,
-    0x99, 0x99, 0x99, 0xa3, 0x9d, 0xa7, 0xa3, 0xa9, 0xa9, 0xa9, 0xa7, 0xaa,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xbf, 0xbf, 0xbf, 0xcb, 0xcc, 0xd8, 0xd8, 0xdf,
-    0xd8, 0xcc, 0xbf, 0xa7, 0x89, 0x4e, 0x2d, 0x1f, 0x19, 0x0e, 0x0e, 0x19,
-    0x19, 0x19, 0x19, 0x1a, 0x1a, 0x19, 0x19, 0x16, 0x1a, 0x19, 0x19, 0x19,
-    0x1a, 0x0c, 0x0e, 0x0e, 0x19, 0x28, 0x3d, 0x66, 0x8a, 0xac, 0xb4, 0xb8,
-    0xb8, 0xaa, 0xa9, 0xa1, 0x99, 0x99, 0x97, 0x97, 0x97, 0x94, 0x94, 0x97,
-    0x94, 0x94, 0x97, 0x94, 0x97, 0x97, 0x97, 0x97, 0x97, 0x94, 0x97, 0x94,
-    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x97, 0x94, 0x97, 0x94, 0x97,
-    0x97, 0x97, 0x94, 0x94, 0x97, 0x97, 0x97, 0x97, 0x97, 0x9d, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x94, 0x9d, 0x94, 0x94, 0x97, 0x97, 0x97,
-    0x94, 0x97, 0x97, 0x91, 0x91, 0x97, 0x97, 0x94, 0x91, 0x90, 0x90, 0x91,
-    0x91, 0x91, 0x91, 0x94, 0x89, 0x8a, 0x88, 0x88, 0x88, 0x89, 0x88, 0x8a,
-    0x88, 0x88, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x7d, 0x7d, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x74, 0x74, 0x74, 0x74, 0x6c, 0x75,
-    0x75, 0x74, 0x75, 0x75, 0x6e, 0x6c, 0x74, 0x74, 0x76, 0x76, 0x7d, 0x81,
-    0x88, 0x88, 0x91, 0x97, 0xa3, 0xa9, 0xb1, 0xb1, 0xb1, 0xbf, 0xc1, 0xc1,
-    0xc1, 0xc1, 0xb3, 0xb3, 0xb3, 0xa9, 0xa9, 0x99, 0x90, 0x82, 0x7a, 0x6e,
-    0x63, 0x5b, 0x52, 0x3e, 0x36, 0x2a, 0x20, 0x20, 0x10, 0x0d, 0x0c, 0x0c,
-    0x07, 0x03, 0x05, 0x0a, 0x0e, 0x1a, 0x26, 0x30, 0x36, 0x45, 0x45, 0x46,
-    0x41, 0x45, 0x45, 0x3e, 0x37, 0x31, 0x30, 0x25, 0x1f, 0x1a, 0x0e, 0x0a,
-    0x34, 0x37, 0x3e, 0x3e, 0x3e, 0x3e, 0x3f, 0x3d, 0x3e, 0x46, 0x46, 0x46,
-    0x49, 0x49, 0x4a, 0x4a, 0x53, 0x53, 0x56, 0x56, 0x56, 0x56, 0x56, 0x5f,
-    0x5e, 0x5e, 0x63, 0x63, 0x63, 0x63, 0x6a, 0x6a, 0x6a, 0x6a, 0x6e, 0x6e,
-    0x6c, 0x6e, 0x6e, 0x6c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x76,
-    0x78, 0x76, 0x7d, 0x7a, 0x81, 0x81, 0x81, 0x84, 0x81, 0x81, 0x88, 0x88,
-    0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x90, 0x90, 0x90, 0x94,
-    0x90, 0x90, 0x97, 0x97, 0x97, 0x97, 0x97, 0x9d, 0x99, 0x99, 0x99, 0x99,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa9, 0xac, 0xa9, 0xaa, 0xaa, 0xb4, 0xb8, 0xb4,
-    0xb4, 0xbf, 0xc1, 0xbf, 0xcc, 0xcc, 0xd8, 0xd8, 0xdf, 0xd8, 0xcc, 0xbf,
-    0xaa, 0x89, 0x4e, 0x2d, 0x1f, 0x19, 0x19, 0x19, 0x19, 0x1a, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1a, 0x19, 0x0c, 0x19,
-    0x26, 0x34, 0x4e, 0x7a, 0xa1, 0xac, 0xb8, 0xb4, 0xac, 0xa1, 0x9d, 0xa1,
-    0x97, 0x97, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x94, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x94, 0x90, 0x94, 0x94, 0x90, 0x94, 0x94, 0x90, 0x97,
-    0x97, 0x94, 0x97, 0x97, 0x94, 0x97, 0x97, 0x97, 0x94, 0x97, 0x97, 0x97,
-    0x94, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x91, 0x94, 0x94,
-    0x94, 0x94, 0x94, 0x94, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x94,
-    0x97, 0x97, 0x94, 0x94, 0x94, 0x91, 0x90, 0x91, 0x94, 0x94, 0x91, 0x90,
-    0x8a, 0x88, 0x88, 0x88, 0x88, 0x8a, 0x88, 0x82, 0x82, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x78, 0x78, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6c, 0x75, 0x75, 0x75,
-    0x74, 0x74, 0x76, 0x78, 0x7d, 0x81, 0x88, 0x88, 0x91, 0x91, 0xa3, 0xa9,
-    0xb3, 0xb3, 0xb4, 0xc1, 0xc1, 0xc1, 0xbf, 0xbf, 0xc1, 0xc1, 0xb3, 0xb3,
-    0xa9, 0xa3, 0x9c, 0x8a, 0x82, 0x7a, 0x6f, 0x69, 0x57, 0x4e, 0x46, 0x37,
-    0x31, 0x2a, 0x20, 0x17, 0x0d, 0x0d, 0x0c, 0x07, 0x05, 0x05, 0x05, 0x0a,
-    0x16, 0x1e, 0x2c, 0x31, 0x36, 0x41, 0x45, 0x45, 0x45, 0x45, 0x45, 0x3e,
-    0x37, 0x31, 0x2a, 0x2c, 0x1f, 0x1a, 0x0e, 0x0a, 0x29, 0x2d, 0x37, 0x37,
-    0x37, 0x37, 0x3e, 0x3e, 0x3e, 0x3e, 0x3d, 0x46, 0x41, 0x41, 0x49, 0x49,
-    0x4a, 0x4a, 0x53, 0x53, 0x53, 0x56, 0x56, 0x56, 0x56, 0x5f, 0x5e, 0x5e,
-    0x5f, 0x63, 0x63, 0x63, 0x6a, 0x6a, 0x6a, 0x6c, 0x6e, 0x6c, 0x6c, 0x71,
-    0x6c, 0x6c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x76, 0x7d,
-    0x7d, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x82, 0x88, 0x8a, 0x8a, 0x8a,
-    0x89, 0x8a, 0x8a, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x94,
-    0x94, 0x97, 0x97, 0x97, 0x9d, 0x99, 0x99, 0x99, 0x99, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa7, 0xa9, 0xa7, 0xaa, 0xb4, 0xb8, 0xb4, 0xb4, 0xbf, 0xbf, 0xbf,
-    0xcb, 0xcc, 0xcc, 0xd8, 0xdf, 0xdf, 0xd8, 0xcc, 0xbf, 0xa3, 0x7a, 0x4e,
-    0x2d, 0x1f, 0x19, 0x19, 0x1a, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1a, 0x19, 0x1f, 0x29, 0x44, 0x66, 0x85,
-    0xac, 0xb4, 0xb4, 0xaa, 0x9f, 0x99, 0x97, 0x94, 0x90, 0x94, 0x89, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x90, 0x94, 0x90, 0x94, 0x94,
-    0x90, 0x94, 0x90, 0x90, 0x94, 0x94, 0x94, 0x91, 0x94, 0x94, 0x94, 0x94,
-    0x94, 0x97, 0x94, 0x94, 0x97, 0x91, 0x94, 0x94, 0x94, 0x94, 0x94, 0x97,
-    0x97, 0x94, 0x94, 0x97, 0x97, 0x97, 0x94, 0x94, 0x94, 0x94, 0x94, 0x97,
-    0x94, 0x97, 0x97, 0x97, 0x97, 0x97, 0x94, 0x94, 0x97, 0x94, 0x94, 0x91,
-    0x91, 0x91, 0x94, 0x91, 0x91, 0x91, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-    0x75, 0x6e, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x76, 0x76, 0x76, 0x7d,
-    0x81, 0x88, 0x91, 0x91, 0x99, 0xa9, 0xa7, 0xb1, 0xb4, 0xbf, 0xbf, 0xbf,
-    0xc1, 0xc1, 0xc1, 0xc1, 0xb8, 0xb3, 0xa9, 0xa3, 0x97, 0x8a, 0x82, 0x78,
-    0x6c, 0x69, 0x60, 0x57, 0x4e, 0x44, 0x37, 0x31, 0x2a, 0x25, 0x17, 0x17,
-    0x0d, 0x0c, 0x07, 0x07, 0x01, 0x03, 0x05, 0x0a, 0x16, 0x1f, 0x2c, 0x37,
-    0x3f, 0x45, 0x45, 0x45, 0x45, 0x46, 0x3e, 0x3e, 0x37, 0x31, 0x2a, 0x25,
-    0x1f, 0x1a, 0x0e, 0x0a, 0x26, 0x29, 0x2d, 0x31, 0x30, 0x34, 0x37, 0x37,
-    0x3e, 0x3e, 0x3e, 0x3f, 0x3f, 0x41, 0x41, 0x49, 0x49, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x53, 0x53, 0x57, 0x56, 0x56, 0x56, 0x5e, 0x5f, 0x5f, 0x63, 0x63,
-    0x63, 0x6a, 0x6a, 0x6a, 0x6e, 0x6e, 0x6e, 0x6e, 0x6c, 0x6e, 0x6e, 0x6e,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x76, 0x76, 0x7d, 0x82, 0x81, 0x82,
-    0x81, 0x81, 0x81, 0x82, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x9d, 0x99, 0x99, 0x9f, 0x9d, 0xa3, 0xa3, 0xa7, 0xa7, 0xa9, 0xa9,
-    0xaa, 0xaa, 0xb4, 0xb8, 0xb4, 0xb4, 0xb4, 0xbf, 0xc1, 0xcb, 0xcb, 0xd3,
-    0xd8, 0xdf, 0xdf, 0xd8, 0xcc, 0xbf, 0x9d, 0x7a, 0x4e, 0x37, 0x26, 0x1f,
-    0x1b, 0x1f, 0x1f, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x1f, 0x1a, 0x1a, 0x26, 0x34, 0x4e, 0x71, 0xa1, 0xac, 0xb4, 0xaa, 0xaa,
-    0x99, 0x97, 0x90, 0x94, 0x89, 0x89, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x89, 0x8a, 0x8a, 0x90, 0x89, 0x89, 0x90, 0x90, 0x90, 0x91, 0x94, 0x90,
-    0x94, 0x94, 0x94, 0x90, 0x97, 0x97, 0x94, 0x94, 0x94, 0x97, 0x97, 0x97,
-    0x94, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x94, 0x97, 0x94, 0x97,
-    0x97, 0x94, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x91, 0x97, 0x97, 0x94, 0x94, 0x94, 0x91, 0x90, 0x90, 0x90, 0x91,
-    0x91, 0x91, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x7d, 0x7d, 0x7d, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x74, 0x74, 0x75, 0x76, 0x76, 0x7d, 0x81, 0x81, 0x88, 0x91, 0x9d, 0xa7,
-    0xa7, 0xb1, 0xb4, 0xc1, 0xc1, 0xc1, 0xbf, 0xc1, 0xc1, 0xc1, 0xc1, 0xb3,
-    0xb3, 0xa9, 0x97, 0x90, 0x84, 0x7b, 0x71, 0x6a, 0x63, 0x57, 0x52, 0x46,
-    0x3e, 0x37, 0x31, 0x2a, 0x20, 0x17, 0x17, 0x0d, 0x0c, 0x07, 0x07, 0x05,
-    0x05, 0x05, 0x05, 0x0e, 0x1a, 0x26, 0x31, 0x36, 0x3f, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x3e, 0x3e, 0x37, 0x36, 0x2a, 0x25, 0x1f, 0x1a, 0x0e, 0x0a,
-    0x1a, 0x1f, 0x28, 0x2c, 0x2d, 0x2d, 0x37, 0x37, 0x37, 0x37, 0x3e, 0x3e,
-    0x3f, 0x3f, 0x41, 0x41, 0x46, 0x49, 0x49, 0x49, 0x4a, 0x4a, 0x53, 0x53,
-    0x56, 0x56, 0x56, 0x56, 0x5f, 0x5f, 0x5f, 0x63, 0x63, 0x6a, 0x6a, 0x6a,
-    0x6a, 0x6e, 0x6c, 0x6a, 0x6e, 0x6e, 0x75, 0x75, 0x75, 0x75, 0x74, 0x74,
-    0x75, 0x76, 0x76, 0x78, 0x7d, 0x7a, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x81, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x94,
-    0x94, 0x90, 0x90, 0x90, 0x90, 0x94, 0x97, 0x97, 0x94, 0x97, 0x9f, 0x99,
-    0x99, 0x99, 0x9d, 0xa7, 0xa9, 0xa7, 0xa9, 0xaa, 0xa9, 0xaa, 0xaa, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xbf, 0xbf, 0xcc, 0xcc, 0xcc, 0xd8, 0xd8, 0xdf, 0xdf,
-    0xd8, 0xcc, 0xbf, 0x9f, 0x7a, 0x4e, 0x37, 0x25, 0x1f, 0x1f, 0x25, 0x25,
-    0x25, 0x25, 0x2c, 0x29, 0x29, 0x2c, 0x25, 0x25, 0x1f, 0x1a, 0x1e, 0x28,
-    0x3c, 0x5b, 0x7a, 0x99, 0xac, 0xaa, 0xaa, 0x9f, 0x97, 0x94, 0x8a, 0x8a,
-    0x8a, 0x89, 0x82, 0x82, 0x82, 0x82, 0x82, 0x8a, 0x8a, 0x8a, 0x89, 0x8a,
-    0x8a, 0x89, 0x89, 0x89, 0x90, 0x94, 0x94, 0x90, 0x90, 0x94, 0x90, 0x90,
-    0x90, 0x94, 0x94, 0x94, 0x97, 0x97, 0x97, 0x97, 0x91, 0x97, 0x94, 0x97,
-    0x97, 0x94, 0x97, 0x97, 0x94, 0x97, 0x94, 0x97, 0x97, 0x97, 0x97, 0x94,
-    0x97, 0x94, 0x94, 0x94, 0x97, 0x97, 0x97, 0x97, 0x97, 0x94, 0x91, 0x97,
-    0x97, 0x94, 0x91, 0x91, 0x91, 0x94, 0x90, 0x90, 0x8a, 0x91, 0x88, 0x88,
-    0x88, 0x8a, 0x88, 0x84, 0x88, 0x82, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x78, 0x78, 0x78, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x74, 0x74, 0x74,
-    0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74, 0x76, 0x76, 0x76,
-    0x7d, 0x81, 0x8a, 0x91, 0x91, 0x99, 0xa9, 0xb3, 0xb1, 0xb4, 0xbf, 0xc1,
-    0xbf, 0xc1, 0xbf, 0xc1, 0xc1, 0xb8, 0xb3, 0xa9, 0x99, 0x91, 0x84, 0x75,
-    0x6f, 0x69, 0x60, 0x56, 0x52, 0x52, 0x46, 0x3e, 0x37, 0x31, 0x2a, 0x25,
-    0x17, 0x17, 0x0c, 0x0c, 0x07, 0x07, 0x03, 0x01, 0x05, 0x05, 0x0a, 0x0e,
-    0x1a, 0x26, 0x30, 0x37, 0x3f, 0x45, 0x45, 0x45, 0x45, 0x3e, 0x3f, 0x3e,
-    0x36, 0x31, 0x2c, 0x25, 0x1f, 0x1a, 0x1a, 0x0e, 0x16, 0x1a, 0x1f, 0x28,
-    0x29, 0x2d, 0x2d, 0x31, 0x31, 0x37, 0x37, 0x37, 0x3e, 0x3f, 0x3f, 0x3f,
-    0x41, 0x46, 0x41, 0x45, 0x49, 0x52, 0x4a, 0x53, 0x53, 0x56, 0x56, 0x56,
-    0x56, 0x5f, 0x5f, 0x66, 0x66, 0x63, 0x6a, 0x6a, 0x6a, 0x6c, 0x71, 0x6e,
-    0x6c, 0x6e, 0x6e, 0x6e, 0x75, 0x75, 0x74, 0x75, 0x75, 0x75, 0x76, 0x78,
-    0x76, 0x76, 0x78, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x94, 0x94, 0x94, 0x94, 0x97, 0x97, 0x9d, 0x9d, 0x99, 0x99, 0x9f, 0x9d,
-    0xaa, 0xaa, 0xa7, 0xaa, 0xa9, 0xaa, 0xaa, 0xaa, 0xb8, 0xb4, 0xb4, 0xb4,
-    0xc1, 0xbf, 0xbf, 0xcc, 0xcc, 0xcc, 0xd8, 0xdf, 0xdf, 0xd8, 0xcc, 0xb4,
-    0x99, 0x7a, 0x4e, 0x37, 0x25, 0x1f, 0x1f, 0x25, 0x2c, 0x2c, 0x2c, 0x2c,
-    0x2c, 0x2a, 0x2c, 0x25, 0x1f, 0x1b, 0x1f, 0x2f, 0x3c, 0x5b, 0x82, 0xa1,
-    0xaa, 0xaa, 0x9d, 0x97, 0x90, 0x8a, 0x8a, 0x81, 0x82, 0x82, 0x82, 0x81,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x8a, 0x8a, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x8a, 0x90, 0x94, 0x90, 0x90, 0x90, 0x94, 0x91, 0x90, 0x90, 0x90,
-    0x90, 0x97, 0x94, 0x94, 0x94, 0x97, 0x97, 0x94, 0x94, 0x94, 0x94, 0x97,
-    0x94, 0x97, 0x97, 0x94, 0x94, 0x97, 0x94, 0x91, 0x91, 0x91, 0x94, 0x97,
-    0x97, 0x94, 0x97, 0x97, 0x97, 0x97, 0x97, 0x90, 0x94, 0x94, 0x91, 0x91,
-    0x94, 0x94, 0x90, 0x90, 0x91, 0x8a, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x88,
-    0x88, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x7d, 0x78, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x75, 0x74, 0x75, 0x75, 0x76, 0x76, 0x7d, 0x81, 0x88, 0x88, 0x91, 0x99,
-    0xa3, 0xa9, 0xb3, 0xb3, 0xb3, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xb8, 0xb3,
-    0xb3, 0xa9, 0x99, 0x93, 0x88, 0x76, 0x6e, 0x69, 0x57, 0x52, 0x52, 0x46,
-    0x46, 0x3e, 0x3e, 0x37, 0x31, 0x2a, 0x25, 0x17, 0x17, 0x0d, 0x0c, 0x07,
-    0x07, 0x05, 0x05, 0x01, 0x05, 0x05, 0x07, 0x1a, 0x1f, 0x25, 0x30, 0x37,
-    0x36, 0x45, 0x45, 0x41, 0x41, 0x3e, 0x3f, 0x3f, 0x37, 0x31, 0x2c, 0x25,
-    0x1f, 0x1a, 0x19, 0x0e, 0x0e, 0x16, 0x1e, 0x1f, 0x26, 0x29, 0x2c, 0x30,
-    0x2d, 0x31, 0x31, 0x37, 0x37, 0x37, 0x3e, 0x3f, 0x3f, 0x46, 0x46, 0x41,
-    0x49, 0x49, 0x4a, 0x4a, 0x4a, 0x53, 0x56, 0x56, 0x56, 0x5f, 0x5f, 0x5f,
-    0x63, 0x63, 0x63, 0x6a, 0x6a, 0x6a, 0x6c, 0x6e, 0x6f, 0x6f, 0x6e, 0x6e,
-    0x6e, 0x75, 0x75, 0x75, 0x74, 0x75, 0x75, 0x78, 0x78, 0x78, 0x78, 0x7d,
-    0x7d, 0x81, 0x81, 0x84, 0x81, 0x81, 0x82, 0x82, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x88, 0x8a, 0x8a, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x97, 0x97,
-    0x97, 0x97, 0x99, 0x99, 0x9d, 0x99, 0x99, 0xa3, 0x9f, 0xaa, 0xa7, 0xa7,
-    0xa9, 0xa7, 0xaa, 0xac, 0xb8, 0xb8, 0xb4, 0xb4, 0xb8, 0xbf, 0xbf, 0xbf,
-    0xcb, 0xcb, 0xd8, 0xd8, 0xdf, 0xdf, 0xd8, 0xcc, 0xb8, 0x9d, 0x7a, 0x4e,
-    0x37, 0x25, 0x26, 0x25, 0x2c, 0x2a, 0x31, 0x31, 0x31, 0x31, 0x2c, 0x25,
-    0x1f, 0x1f, 0x1f, 0x2d, 0x44, 0x66, 0x8a, 0x99, 0xa3, 0x9d, 0x94, 0x90,
-    0x8a, 0x8a, 0x82, 0x81, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7d,
-    0x81, 0x81, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x89, 0x90,
-    0x89, 0x90, 0x90, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x91, 0x90,
-    0x94, 0x90, 0x90, 0x94, 0x94, 0x94, 0x94, 0x94, 0x97, 0x94, 0x94, 0x94,
-    0x94, 0x94, 0x97, 0x91, 0x91, 0x94, 0x94, 0x94, 0x90, 0x94, 0x90, 0x94,
-    0x94, 0x94, 0x94, 0x94, 0x91, 0x90, 0x90, 0x94, 0x94, 0x91, 0x91, 0x8a,
-    0x8a, 0x88, 0x88, 0x8a, 0x89, 0x88, 0x88, 0x88, 0x88, 0x81, 0x81, 0x81,
-    0x88, 0x7d, 0x81, 0x7d, 0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x74, 0x74, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x76,
-    0x76, 0x7d, 0x81, 0x88, 0x91, 0x97, 0x99, 0xa9, 0xa9, 0xb3, 0xb8, 0xc1,
-    0xc1, 0xc1, 0xc1, 0xb8, 0xb8, 0xb8, 0xa9, 0xa9, 0x99, 0x93, 0x84, 0x78,
-    0x6e, 0x63, 0x5f, 0x52, 0x46, 0x46, 0x3e, 0x3e, 0x3e, 0x37, 0x31, 0x2a,
-    0x2a, 0x25, 0x17, 0x17, 0x0c, 0x0c, 0x07, 0x07, 0x05, 0x05, 0x01, 0x01,
-    0x05, 0x0a, 0x0e, 0x1a, 0x1f, 0x29, 0x30, 0x37, 0x3e, 0x3e, 0x45, 0x45,
-    0x41, 0x45, 0x3f, 0x37, 0x31, 0x31, 0x2c, 0x25, 0x1f, 0x1a, 0x19, 0x0e,
-    0x0a, 0x0e, 0x16, 0x1a, 0x1f, 0x26, 0x2c, 0x2c, 0x2c, 0x2d, 0x2d, 0x30,
-    0x31, 0x37, 0x37, 0x3e, 0x3e, 0x3e, 0x3f, 0x41, 0x41, 0x41, 0x49, 0x4a,
-    0x4a, 0x53, 0x53, 0x56, 0x56, 0x56, 0x5f, 0x5f, 0x5f, 0x63, 0x63, 0x63,
-    0x6a, 0x6a, 0x66, 0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x6e, 0x6e, 0x75, 0x6e,
-    0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x78, 0x7a, 0x7d, 0x7d, 0x78, 0x81,
-    0x81, 0x81, 0x81, 0x82, 0x82, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x97, 0x94, 0x97, 0x97, 0x97,
-    0x99, 0x99, 0x99, 0x99, 0xa3, 0xa3, 0xaa, 0xa9, 0xa9, 0xa9, 0xa9, 0xaa,
-    0xac, 0xb8, 0xb4, 0xb4, 0xb4, 0xb8, 0xc1, 0xbf, 0xbf, 0xcb, 0xcc, 0xd8,
-    0xd8, 0xdf, 0xdf, 0xd8, 0xcb, 0xb4, 0x99, 0x7a, 0x4e, 0x37, 0x29, 0x25,
-    0x25, 0x2c, 0x31, 0x31, 0x31, 0x31, 0x2c, 0x2c, 0x1f, 0x1f, 0x26, 0x2d,
-    0x44, 0x66, 0x8a, 0x9f, 0x99, 0x97, 0x90, 0x8a, 0x82, 0x82, 0x7a, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x71, 0x7a, 0x7a, 0x7a, 0x7a, 0x82, 0x82, 0x82,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90,
-    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x90, 0x90, 0x94, 0x94, 0x90, 0x94,
-    0x94, 0x90, 0x90, 0x94, 0x90, 0x94, 0x94, 0x90, 0x97, 0x90, 0x90, 0x94,
-    0x90, 0x90, 0x91, 0x91, 0x90, 0x90, 0x94, 0x90, 0x94, 0x90, 0x90, 0x91,
-    0x90, 0x91, 0x91, 0x90, 0x90, 0x91, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x84, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7d,
-    0x7d, 0x78, 0x76, 0x78, 0x76, 0x75, 0x76, 0x74, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x74, 0x75, 0x74, 0x76, 0x78, 0x7d, 0x81, 0x88, 0x91,
-    0x91, 0x99, 0xa9, 0xa9, 0xb3, 0xb3, 0xb8, 0xc1, 0xb3, 0xb8, 0xb8, 0xa9,
-    0xa9, 0xa3, 0x97, 0x90, 0x82, 0x7a, 0x6f, 0x63, 0x5f, 0x52, 0x46, 0x46,
-    0x3e, 0x3e, 0x37, 0x37, 0x31, 0x2a, 0x2a, 0x25, 0x1f, 0x1b, 0x0d, 0x0c,
-    0x0c, 0x07, 0x07, 0x03, 0x05, 0x01, 0x01, 0x03, 0x05, 0x0a, 0x0e, 0x1a,
-    0x1f, 0x25, 0x2c, 0x31, 0x37, 0x37, 0x36, 0x3f, 0x36, 0x36, 0x37, 0x36,
-    0x31, 0x31, 0x2c, 0x25, 0x1f, 0x1f, 0x19, 0x19, 0x05, 0x0a, 0x0e, 0x16,
-    0x1a, 0x1f, 0x25, 0x2c, 0x29, 0x29, 0x2c, 0x30, 0x30, 0x2d, 0x37, 0x37,
-    0x3e, 0x3e, 0x3e, 0x3e, 0x41, 0x41, 0x41, 0x49, 0x4a, 0x4a, 0x53, 0x53,
-    0x56, 0x56, 0x56, 0x5f, 0x5f, 0x5f, 0x5f, 0x63, 0x63, 0x63, 0x69, 0x6a,
-    0x6a, 0x66, 0x6a, 0x6e, 0x71, 0x6e, 0x6e, 0x6e, 0x6e, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x7a, 0x7a, 0x78, 0x78, 0x7d, 0x7d, 0x81, 0x82, 0x81,
-    0x82, 0x82, 0x88, 0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x94, 0x94, 0x97, 0x97, 0x99, 0x99, 0x99, 0x99,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa9, 0xa9, 0xaa, 0xac, 0xaa, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xc1, 0xbf, 0xcc, 0xcc, 0xcc, 0xd8, 0xd8, 0xdf, 0xdf,
-    0xd8, 0xcb, 0xb4, 0x9d, 0x71, 0x4e, 0x37, 0x29, 0x25, 0x2c, 0x31, 0x31,
-    0x37, 0x31, 0x31, 0x2c, 0x1f, 0x1f, 0x26, 0x2f, 0x43, 0x66, 0x82, 0x97,
-    0x97, 0x90, 0x8a, 0x82, 0x82, 0x7a, 0x7a, 0x7a, 0x7a, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x74, 0x7a, 0x7a, 0x89, 0x82, 0x82, 0x82, 0x82, 0x8a,
-    0x88, 0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x90, 0x90, 0x94,
-    0x94, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x94, 0x94, 0x94, 0x94,
-    0x90, 0x94, 0x94, 0x90, 0x90, 0x90, 0x94, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x94, 0x94, 0x90, 0x90, 0x94, 0x90, 0x91, 0x94, 0x90, 0x8a, 0x8a,
-    0x8a, 0x89, 0x8a, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8a, 0x88, 0x88,
-    0x81, 0x82, 0x81, 0x81, 0x81, 0x7d, 0x7d, 0x7d, 0x78, 0x78, 0x76, 0x76,
-    0x75, 0x75, 0x75, 0x75, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x78, 0x78, 0x84, 0x88, 0x91, 0x97, 0x99, 0xa9, 0xa9, 0xb3,
-    0xb3, 0xb8, 0xb8, 0xb8, 0xb8, 0xa9, 0xa9, 0x99, 0x90, 0x88, 0x78, 0x6f,
-    0x71, 0x69, 0x57, 0x52, 0x46, 0x46, 0x3e, 0x3e, 0x34, 0x34, 0x30, 0x29,
-    0x2c, 0x25, 0x1f, 0x1b, 0x1b, 0x0c, 0x0c, 0x07, 0x07, 0x05, 0x05, 0x01,
-    0x01, 0x01, 0x05, 0x03, 0x0a, 0x07, 0x16, 0x1e, 0x1f, 0x29, 0x30, 0x30,
-    0x37, 0x3e, 0x3e, 0x46, 0x46, 0x41, 0x41, 0x46, 0x46, 0x3e, 0x3e, 0x37,
-    0x37, 0x2d, 0x2d, 0x29, 0x00, 0x05, 0x0a, 0x0e, 0x16, 0x1e, 0x1f, 0x26,
-    0x29, 0x29, 0x29, 0x29, 0x2c, 0x30, 0x31, 0x31, 0x37, 0x37, 0x3e, 0x3e,
-    0x3e, 0x3f, 0x46, 0x41, 0x49, 0x52, 0x4a, 0x4a, 0x53, 0x56, 0x56, 0x56,
-    0x56, 0x5f, 0x5f, 0x5f, 0x63, 0x63, 0x69, 0x63, 0x6a, 0x68, 0x66, 0x6a,
-    0x6c, 0x6c, 0x6e, 0x6e, 0x6e, 0x6e, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x78, 0x7a, 0x7d, 0x7a, 0x7d, 0x78, 0x82, 0x81, 0x81, 0x84, 0x84, 0x82,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x94, 0x97, 0x97, 0x97, 0x9d, 0x9f, 0x9d, 0x9f, 0x99, 0xa3, 0xa3,
-    0xa1, 0xa9, 0xaa, 0xac, 0xac, 0xaa, 0xaa, 0xac, 0xb8, 0xb4, 0xb4, 0xb8,
-    0xbf, 0xbf, 0xbf, 0xcb, 0xcc, 0xd8, 0xd8, 0xdf, 0xdf, 0xd8, 0xcc, 0xb4,
-    0x94, 0x71, 0x4e, 0x37, 0x29, 0x2c, 0x2c, 0x31, 0x37, 0x37, 0x31, 0x2c,
-    0x1f, 0x1f, 0x1f, 0x28, 0x3c, 0x69, 0x82, 0x90, 0x90, 0x82, 0x82, 0x7a,
-    0x7a, 0x7a, 0x71, 0x74, 0x71, 0x6c, 0x71, 0x71, 0x71, 0x71, 0x71, 0x6c,
-    0x74, 0x76, 0x7d, 0x81, 0x81, 0x89, 0x82, 0x81, 0x82, 0x89, 0x89, 0x82,
-    0x8a, 0x8a, 0x89, 0x89, 0x89, 0x8a, 0x8a, 0x90, 0x90, 0x8a, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x94, 0x90, 0x94, 0x94, 0x90, 0x94, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x94, 0x94, 0x90, 0x90, 0x94, 0x90, 0x91, 0x90, 0x91,
-    0x90, 0x90, 0x91, 0x94, 0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88,
-    0x8a, 0x88, 0x88, 0x88, 0x88, 0x8a, 0x8a, 0x88, 0x81, 0x81, 0x81, 0x81,
-    0x7d, 0x7d, 0x7a, 0x7a, 0x76, 0x78, 0x78, 0x76, 0x75, 0x75, 0x75, 0x75,
-    0x74, 0x6c, 0x6c, 0x6e, 0x6e, 0x75, 0x75, 0x75, 0x75, 0x76, 0x78, 0x84,
-    0x88, 0x90, 0x91, 0x99, 0xa3, 0xa9, 0xa9, 0xb3, 0xb3, 0xb8, 0xb3, 0xa9,
-    0xa9, 0x99, 0x90, 0x82, 0x78, 0x6f, 0x69, 0x60, 0x57, 0x52, 0x46, 0x46,
-    0x3e, 0x3e, 0x34, 0x30, 0x30, 0x2c, 0x25, 0x25, 0x1f, 0x1b, 0x19, 0x0c,
-    0x0c, 0x07, 0x07, 0x07, 0x03, 0x05, 0x03, 0x03, 0x03, 0x05, 0x0a, 0x0e,
-    0x19, 0x1f, 0x25, 0x2d, 0x37, 0x3e, 0x46, 0x52, 0x60, 0x63, 0x6a, 0x71,
-    0x6c, 0x6c, 0x74, 0x74, 0x75, 0x6e, 0x6c, 0x6c, 0x6a, 0x68, 0x68, 0x5b,
-    0x00, 0x00, 0x05, 0x0a, 0x0e, 0x16, 0x1e, 0x1f, 0x26, 0x2c, 0x29, 0x29,
-    0x29, 0x2c, 0x30, 0x31, 0x30, 0x34, 0x37, 0x3e, 0x3e, 0x3e, 0x3e, 0x41,
-    0x41, 0x49, 0x46, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x56, 0x56, 0x60, 0x5f,
-    0x5f, 0x60, 0x63, 0x63, 0x63, 0x63, 0x6a, 0x6a, 0x6a, 0x68, 0x6c, 0x6a,
-    0x6e, 0x6e, 0x6e, 0x75, 0x75, 0x75, 0x75, 0x76, 0x75, 0x78, 0x76, 0x7a,
-    0x7d, 0x7d, 0x82, 0x81, 0x84, 0x81, 0x81, 0x8a, 0x8a, 0x88, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x94, 0x90, 0x90, 0x94, 0x94,
-    0x97, 0x9d, 0x99, 0x99, 0x99, 0x99, 0x99, 0xa3, 0xa3, 0xa3, 0xa7, 0xaa,
-    0xac, 0xa9, 0xaa, 0xaa, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xbf, 0xbf, 0xbf,
-    0xcb, 0xcc, 0xcc, 0xd8, 0xdf, 0xdf, 0xd8, 0xcb, 0xb4, 0x94, 0x71, 0x4e,
-    0x37, 0x29, 0x2c, 0x31, 0x37, 0x37, 0x31, 0x2c, 0x1f, 0x1a, 0x1e, 0x28,
-    0x3c, 0x5b, 0x7a, 0x8a, 0x82, 0x82, 0x7a, 0x7a, 0x71, 0x71, 0x6c, 0x6c,
-    0x6c, 0x66, 0x68, 0x66, 0x68, 0x68, 0x66, 0x6c, 0x71, 0x76, 0x76, 0x7a,
-    0x7d, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x8a, 0x8a, 0x88, 0x89, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x91, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x91, 0x90, 0x91, 0x90, 0x89, 0x94, 0x91, 0x91, 0x90, 0x94, 0x90,
-    0x94, 0x94, 0x94, 0x94, 0x90, 0x90, 0x90, 0x90, 0x91, 0x94, 0x91, 0x91,
-    0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x8a,
-    0x88, 0x88, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x78, 0x7d, 0x78, 0x7d,
-    0x76, 0x76, 0x75, 0x76, 0x76, 0x74, 0x74, 0x74, 0x74, 0x75, 0x6c, 0x6e,
-    0x6e, 0x74, 0x75, 0x75, 0x76, 0x7d, 0x81, 0x88, 0x91, 0x97, 0x99, 0xa3,
-    0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xac, 0xa3, 0x99, 0x97, 0x8a, 0x78, 0x6f,
-    0x69, 0x60, 0x52, 0x52, 0x46, 0x3e, 0x3e, 0x37, 0x34, 0x30, 0x2d, 0x29,
-    0x25, 0x25, 0x1f, 0x1a, 0x19, 0x0c, 0x0c, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x0a, 0x0a, 0x07, 0x0e, 0x19, 0x1f, 0x26, 0x2d, 0x34, 0x44, 0x4e, 0x5b,
-    0x66, 0x71, 0x7a, 0x82, 0x8a, 0x90, 0x90, 0x97, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x00, 0x01, 0x03,
-    0x0a, 0x0e, 0x19, 0x1a, 0x1f, 0x26, 0x2c, 0x29, 0x29, 0x29, 0x29, 0x2c,
-    0x2d, 0x2d, 0x30, 0x30, 0x37, 0x3e, 0x3e, 0x3e, 0x46, 0x46, 0x49, 0x49,
-    0x4a, 0x4a, 0x53, 0x4e, 0x56, 0x56, 0x56, 0x56, 0x56, 0x5b, 0x5e, 0x5e,
-    0x63, 0x63, 0x69, 0x63, 0x6a, 0x6a, 0x68, 0x68, 0x6a, 0x6c, 0x6c, 0x6e,
-    0x75, 0x75, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x7a, 0x7a, 0x7d, 0x81,
-    0x82, 0x82, 0x81, 0x82, 0x82, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x90, 0x90, 0x90, 0x90, 0x90, 0x97, 0x94, 0x97, 0x97, 0x97, 0x99,
-    0x9d, 0x99, 0x9d, 0x99, 0xa3, 0xa3, 0xaa, 0xaa, 0xa9, 0xac, 0xac, 0xac,
-    0xaa, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xbf, 0xc1, 0xbf, 0xcb, 0xcc, 0xcc,
-    0xd8, 0xdf, 0xdf, 0xd8, 0xcb, 0xb4, 0x94, 0x71, 0x4e, 0x34, 0x2a, 0x2c,
-    0x31, 0x37, 0x31, 0x29, 0x1f, 0x1a, 0x1e, 0x28, 0x3a, 0x57, 0x6f, 0x82,
-    0x7a, 0x7a, 0x71, 0x71, 0x71, 0x71, 0x71, 0x68, 0x68, 0x68, 0x63, 0x68,
-    0x66, 0x68, 0x66, 0x66, 0x71, 0x71, 0x74, 0x76, 0x76, 0x7d, 0x7d, 0x7d,
-    0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x88, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x90, 0x90, 0x90, 0x8a, 0x90,
-    0x8a, 0x89, 0x90, 0x90, 0x90, 0x90, 0x91, 0x90, 0x89, 0x90, 0x89, 0x89,
-    0x90, 0x90, 0x89, 0x94, 0x90, 0x94, 0x91, 0x8a, 0x88, 0x88, 0x89, 0x88,
-    0x88, 0x8a, 0x8a, 0x88, 0x88, 0x88, 0x8a, 0x8a, 0x88, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x7d, 0x7d, 0x76, 0x76, 0x76, 0x7a, 0x75, 0x75,
-    0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x6e, 0x75, 0x75, 0x74, 0x74, 0x75,
-    0x78, 0x81, 0x81, 0x88, 0x91, 0x97, 0x99, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0x99, 0x99, 0x90, 0x8a, 0x82, 0x7b, 0x69, 0x60, 0x52, 0x52, 0x46, 0x3e,
-    0x3e, 0x34, 0x34, 0x2f, 0x2f, 0x28, 0x26, 0x1f, 0x1f, 0x1a, 0x19, 0x0e,
-    0x0c, 0x07, 0x07, 0x08, 0x07, 0x07, 0x0c, 0x19, 0x1e, 0x26, 0x28, 0x34,
-    0x3d, 0x4e, 0x5b, 0x6a, 0x7a, 0x82, 0x8a, 0x97, 0x99, 0xa3, 0xa9, 0xa9,
-    0xb1, 0xb3, 0xb3, 0xb3, 0xb8, 0xb8, 0xb3, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1,
-    0xc1, 0xc1, 0xc1, 0xc1, 0x00, 0x00, 0x00, 0x05, 0x05, 0x0a, 0x0e, 0x1a,
-    0x1a, 0x1f, 0x26, 0x25, 0x29, 0x29, 0x29, 0x29, 0x29, 0x2d, 0x30, 0x30,
-    0x37, 0x34, 0x37, 0x3e, 0x3e, 0x3e, 0x41, 0x41, 0x49, 0x4a, 0x4a, 0x4e,
-    0x53, 0x53, 0x56, 0x56, 0x56, 0x56, 0x56, 0x5e, 0x5f, 0x5f, 0x5f, 0x63,
-    0x63, 0x63, 0x63, 0x6a, 0x68, 0x6c, 0x6c, 0x6f, 0x6c, 0x71, 0x6c, 0x74,
-    0x74, 0x76, 0x76, 0x7a, 0x76, 0x7d, 0x7d, 0x81, 0x82, 0x81, 0x81, 0x81,
-    0x82, 0x82, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x97, 0x97, 0x97, 0x97, 0x9f, 0x9d, 0x99, 0x9d,
-    0x99, 0xa3, 0xaa, 0xa7, 0xa9, 0xa9, 0xac, 0xac, 0xaa, 0xaa, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb8, 0xbf, 0xbf, 0xbf, 0xcb, 0xcc, 0xd3, 0xd8, 0xd8, 0xd8,
-    0xd8, 0xcc, 0xac, 0x8a, 0x71, 0x44, 0x2d, 0x2c, 0x2a, 0x31, 0x31, 0x2c,
-    0x1f, 0x1a, 0x19, 0x26, 0x2f, 0x52, 0x69, 0x7a, 0x7a, 0x71, 0x71, 0x71,
-    0x66, 0x66, 0x68, 0x68, 0x63, 0x68, 0x66, 0x68, 0x66, 0x68, 0x63, 0x66,
-    0x66, 0x71, 0x6c, 0x74, 0x76, 0x76, 0x76, 0x76, 0x7d, 0x7a, 0x89, 0x82,
-    0x82, 0x82, 0x81, 0x81, 0x88, 0x88, 0x88, 0x88, 0x8a, 0x89, 0x89, 0x8a,
-    0x89, 0x8a, 0x89, 0x8a, 0x8a, 0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x89, 0x89, 0x89, 0x90, 0x8a, 0x89,
-    0x89, 0x90, 0x89, 0x89, 0x89, 0x89, 0x8a, 0x88, 0x8a, 0x8a, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x7d,
-    0x7d, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x74, 0x74, 0x74, 0x6c, 0x6c,
-    0x6e, 0x6e, 0x6c, 0x75, 0x75, 0x74, 0x75, 0x78, 0x78, 0x81, 0x88, 0x91,
-    0x90, 0x97, 0x99, 0x99, 0x99, 0x99, 0x97, 0x97, 0x8a, 0x8a, 0x82, 0x7b,
-    0x6f, 0x63, 0x60, 0x52, 0x46, 0x46, 0x3e, 0x34, 0x34, 0x2d, 0x28, 0x28,
-    0x26, 0x1f, 0x1e, 0x19, 0x19, 0x16, 0x0e, 0x0e, 0x07, 0x0e, 0x0e, 0x19,
-    0x1b, 0x26, 0x29, 0x37, 0x44, 0x4e, 0x66, 0x71, 0x82, 0x90, 0x99, 0xa3,
-    0xa9, 0xb4, 0xb8, 0xb4, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xcb, 0xcb, 0xcb,
-    0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd3, 0xd3, 0xd3,
-    0x00, 0x00, 0x00, 0x02, 0x05, 0x05, 0x0a, 0x0e, 0x16, 0x1a, 0x1f, 0x25,
-    0x26, 0x26, 0x29, 0x29, 0x29, 0x28, 0x29, 0x2c, 0x2d, 0x31, 0x31, 0x37,
-    0x3e, 0x3e, 0x3f, 0x41, 0x41, 0x49, 0x49, 0x4a, 0x4a, 0x4a, 0x53, 0x53,
-    0x56, 0x56, 0x56, 0x5b, 0x56, 0x5b, 0x5f, 0x5f, 0x63, 0x63, 0x63, 0x63,
-    0x68, 0x6a, 0x6a, 0x6a, 0x6c, 0x71, 0x6c, 0x6c, 0x75, 0x75, 0x76, 0x7a,
-    0x76, 0x76, 0x7a, 0x7a, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82,
-    0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x90, 0x90, 0x90,
-    0x94, 0x97, 0x97, 0x9d, 0x9d, 0x99, 0x99, 0x9f, 0x99, 0xa3, 0x9d, 0xa7,
-    0xaa, 0xa7, 0xa9, 0xa9, 0xaa, 0xaa, 0xaa, 0xb1, 0xb8, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xbf, 0xbf, 0xcb, 0xcb, 0xcc, 0xd3, 0xd8, 0xd8, 0xd8, 0xbf, 0xac,
-    0x89, 0x66, 0x44, 0x37, 0x2c, 0x2c, 0x2c, 0x25, 0x1f, 0x19, 0x19, 0x1e,
-    0x2f, 0x3e, 0x5b, 0x71, 0x71, 0x71, 0x66, 0x66, 0x66, 0x68, 0x68, 0x68,
-    0x5e, 0x66, 0x5b, 0x66, 0x5e, 0x5e, 0x68, 0x68, 0x68, 0x66, 0x6c, 0x6c,
-    0x74, 0x74, 0x76, 0x76, 0x76, 0x7d, 0x7d, 0x7d, 0x81, 0x81, 0x81, 0x81,
-    0x82, 0x82, 0x88, 0x88, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x89, 0x89, 0x8a,
-    0x88, 0x8a, 0x88, 0x8a, 0x8a, 0x8a, 0x88, 0x89, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x88, 0x89, 0x8a, 0x89, 0x8a, 0x89, 0x8a, 0x8a, 0x89, 0x89,
-    0x89, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x81, 0x81,
-    0x81, 0x84, 0x81, 0x81, 0x81, 0x7d, 0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x74, 0x74, 0x74, 0x75, 0x75, 0x6e, 0x6e, 0x6c, 0x6c, 0x6e,
-    0x75, 0x74, 0x76, 0x7d, 0x81, 0x81, 0x88, 0x91, 0x90, 0x90, 0x97, 0x97,
-    0x90, 0x90, 0x8a, 0x83, 0x7a, 0x75, 0x75, 0x6a, 0x5f, 0x56, 0x52, 0x46,
-    0x3e, 0x3e, 0x34, 0x30, 0x29, 0x28, 0x26, 0x1e, 0x1a, 0x19, 0x16, 0x16,
-    0x0e, 0x0e, 0x0c, 0x0c, 0x19, 0x1f, 0x29, 0x2d, 0x3d, 0x4e, 0x66, 0x7a,
-    0x8a, 0x97, 0xa3, 0xa9, 0xb4, 0xc1, 0xc1, 0xc1, 0xcb, 0xcb, 0xcb, 0xd3,
-    0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd8, 0xd3, 0xd3,
-    0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0x00, 0x00, 0x00, 0x02,
-    0x02, 0x05, 0x05, 0x0a, 0x0e, 0x1a, 0x1a, 0x1f, 0x1f, 0x26, 0x26, 0x25,
-    0x25, 0x28, 0x28, 0x29, 0x29, 0x30, 0x2d, 0x30, 0x37, 0x37, 0x3e, 0x3e,
-    0x44, 0x41, 0x49, 0x49, 0x4a, 0x4a, 0x4a, 0x4d, 0x53, 0x53, 0x56, 0x56,
-    0x56, 0x5b, 0x56, 0x5f, 0x5f, 0x5f, 0x63, 0x63, 0x68, 0x68, 0x68, 0x68,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x75, 0x75, 0x74, 0x74, 0x76, 0x76, 0x7a, 0x7d,
-    0x7d, 0x82, 0x81, 0x81, 0x82, 0x81, 0x81, 0x82, 0x82, 0x8a, 0x82, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x89, 0x90, 0x90, 0x90, 0x94, 0x94, 0x97, 0x97, 0x9d,
-    0x9d, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9f, 0xa3, 0xa3, 0xa7, 0xa7, 0xa7,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xac, 0xaa, 0xb4, 0xb4, 0xb8, 0xb4, 0xbf, 0xbf,
-    0xcb, 0xcc, 0xcc, 0xd8, 0xd8, 0xd8, 0xd8, 0xbf, 0xac, 0x8a, 0x66, 0x44,
-    0x31, 0x2c, 0x2c, 0x1f, 0x1a, 0x19, 0x16, 0x16, 0x26, 0x34, 0x4f, 0x5b,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x5b, 0x5e, 0x5e, 0x5b, 0x5b, 0x5e, 0x5b,
-    0x5e, 0x5f, 0x5e, 0x66, 0x68, 0x68, 0x68, 0x6c, 0x6c, 0x6c, 0x74, 0x74,
-    0x75, 0x76, 0x76, 0x76, 0x7d, 0x7d, 0x82, 0x84, 0x81, 0x82, 0x81, 0x82,
-    0x88, 0x88, 0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x88, 0x8a,
-    0x8a, 0x88, 0x88, 0x8a, 0x8a, 0x89, 0x89, 0x8a, 0x8a, 0x88, 0x88, 0x88,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x75, 0x74,
-    0x75, 0x6c, 0x6c, 0x6c, 0x6e, 0x6c, 0x75, 0x74, 0x74, 0x76, 0x76, 0x7d,
-    0x81, 0x88, 0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x82, 0x7a, 0x7b, 0x6f,
-    0x66, 0x69, 0x60, 0x57, 0x52, 0x46, 0x46, 0x3e, 0x37, 0x30, 0x29, 0x2c,
-    0x26, 0x1e, 0x1a, 0x16, 0x16, 0x16, 0x0e, 0x0e, 0x19, 0x19, 0x1f, 0x29,
-    0x34, 0x44, 0x5b, 0x6c, 0x82, 0x90, 0xa3, 0xac, 0xb8, 0xbf, 0xbf, 0xcb,
-    0xcb, 0xd3, 0xd3, 0xd3, 0xd3, 0xd8, 0xd8, 0xd8, 0xd3, 0xd8, 0xd3, 0xd3,
-    0xd3, 0xd3, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb,
-    0xcb, 0xcb, 0xcb, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05,
-    0x0a, 0x0e, 0x16, 0x19, 0x1f, 0x26, 0x25, 0x26, 0x25, 0x26, 0x26, 0x28,
-    0x2c, 0x29, 0x2c, 0x30, 0x30, 0x34, 0x37, 0x3e, 0x3d, 0x46, 0x41, 0x49,
-    0x49, 0x49, 0x4a, 0x4d, 0x4e, 0x4d, 0x53, 0x53, 0x56, 0x56, 0x56, 0x5b,
-    0x5f, 0x5f, 0x5f, 0x63, 0x66, 0x68, 0x68, 0x6a, 0x6a, 0x6a, 0x6e, 0x71,
-    0x6f, 0x6f, 0x74, 0x71, 0x7a, 0x7a, 0x76, 0x76, 0x7d, 0x7a, 0x7d, 0x81,
-    0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x8a, 0x8a, 0x8a, 0x8a, 0x89,
-    0x90, 0x90, 0x94, 0x90, 0x94, 0x97, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99,
-    0x99, 0x99, 0x9f, 0xa3, 0x9f, 0xa7, 0xa7, 0xa9, 0xac, 0xa9, 0xa9, 0xa9,
-    0xaa, 0xaa, 0xaa, 0xb4, 0xb4, 0xb4, 0xbf, 0xbf, 0xbf, 0xbf, 0xcb, 0xcc,
-    0xd8, 0xd8, 0xd8, 0xcc, 0xbf, 0xaa, 0x89, 0x66, 0x44, 0x2d, 0x26, 0x1e,
-    0x16, 0x0e, 0x0e, 0x16, 0x1e, 0x2f, 0x3c, 0x4e, 0x5b, 0x66, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x55, 0x55, 0x56, 0x55, 0x55, 0x5b, 0x5b, 0x55, 0x5e, 0x5b,
-    0x5b, 0x66, 0x66, 0x66, 0x66, 0x6c, 0x6c, 0x71, 0x74, 0x74, 0x76, 0x78,
-    0x78, 0x76, 0x7d, 0x78, 0x7d, 0x82, 0x82, 0x81, 0x82, 0x82, 0x81, 0x81,
-    0x82, 0x82, 0x8a, 0x88, 0x88, 0x88, 0x8a, 0x88, 0x88, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x88, 0x89, 0x89, 0x8a, 0x88, 0x88, 0x88, 0x8a, 0x8a, 0x88, 0x88,
-    0x8a, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x81,
-    0x81, 0x82, 0x81, 0x81, 0x78, 0x7d, 0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x6c, 0x6e, 0x6c,
-    0x6c, 0x74, 0x75, 0x75, 0x75, 0x78, 0x7d, 0x81, 0x84, 0x81, 0x81, 0x82,
-    0x82, 0x82, 0x82, 0x7a, 0x7b, 0x6f, 0x66, 0x5b, 0x57, 0x57, 0x52, 0x52,
-    0x46, 0x3e, 0x37, 0x37, 0x2c, 0x29, 0x26, 0x1e, 0x1a, 0x1a, 0x16, 0x0e,
-    0x0e, 0x0e, 0x19, 0x1e, 0x26, 0x2d, 0x3d, 0x57, 0x71, 0x82, 0x97, 0xac,
-    0xb8, 0xc1, 0xbf, 0xcb, 0xcc, 0xd8, 0xd3, 0xd8, 0xd8, 0xd3, 0xd3, 0xd8,
-    0xd3, 0xd3, 0xd3, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc1, 0xc1, 0xc1, 0xc1,
-    0xc1, 0xc1, 0xc1, 0xbf, 0xbf, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x05, 0x05, 0x0a, 0x0a, 0x16,
-    0x1a, 0x1f, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x28, 0x28, 0x29,
-    0x2d, 0x30, 0x34, 0x37, 0x3e, 0x3d, 0x3f, 0x41, 0x41, 0x41, 0x46, 0x52,
-    0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x56, 0x56, 0x57, 0x56, 0x5e, 0x5f, 0x5f,
-    0x5e, 0x66, 0x63, 0x63, 0x6a, 0x6a, 0x6a, 0x6a, 0x6e, 0x71, 0x6f, 0x74,
-    0x74, 0x74, 0x76, 0x78, 0x78, 0x7d, 0x7a, 0x82, 0x82, 0x81, 0x82, 0x82,
-    0x82, 0x89, 0x82, 0x82, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x94, 0x94,
-    0x94, 0x90, 0x97, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0x9d, 0x9d, 0x9d,
-    0x9f, 0x9f, 0xa3, 0xa7, 0xa9, 0xa9, 0xa7, 0xa7, 0xa9, 0xa9, 0xa7, 0xb3,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xbf, 0xbf, 0xbf, 0xcb, 0xcc, 0xd8, 0xd8, 0xd8,
-    0xcc, 0xbf, 0xaa, 0x82, 0x5b, 0x3d, 0x29, 0x1a, 0x16, 0x0e, 0x0a, 0x0a,
-    0x16, 0x26, 0x2f, 0x43, 0x4e, 0x5b, 0x5b, 0x57, 0x5b, 0x57, 0x55, 0x5b,
-    0x56, 0x5b, 0x4e, 0x55, 0x55, 0x56, 0x55, 0x5b, 0x5e, 0x5f, 0x5e, 0x68,
-    0x68, 0x66, 0x6c, 0x6c, 0x6c, 0x71, 0x74, 0x76, 0x76, 0x7a, 0x76, 0x76,
-    0x7d, 0x7d, 0x7a, 0x82, 0x82, 0x82, 0x89, 0x81, 0x82, 0x81, 0x81, 0x81,
-    0x81, 0x88, 0x88, 0x82, 0x88, 0x88, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x8a,
-    0x88, 0x88, 0x88, 0x8a, 0x88, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x8a, 0x88,
-    0x88, 0x81, 0x81, 0x88, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81,
-    0x7d, 0x7d, 0x76, 0x7a, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x74, 0x74,
-    0x74, 0x74, 0x75, 0x74, 0x75, 0x6c, 0x75, 0x6e, 0x6c, 0x74, 0x74, 0x74,
-    0x76, 0x76, 0x7d, 0x7d, 0x81, 0x78, 0x7d, 0x78, 0x7a, 0x7a, 0x71, 0x71,
-    0x69, 0x69, 0x57, 0x52, 0x46, 0x46, 0x3e, 0x3d, 0x37, 0x31, 0x2d, 0x28,
-    0x26, 0x1e, 0x1a, 0x19, 0x19, 0x0e, 0x0e, 0x0e, 0x19, 0x1e, 0x28, 0x34,
-    0x4e, 0x66, 0x7a, 0x97, 0xac, 0xb8, 0xbf, 0xcb, 0xcb, 0xd3, 0xd8, 0xd8,
-    0xd8, 0xd8, 0xd3, 0xd3, 0xd3, 0xcb, 0xcb, 0xcb, 0xcb, 0xc1, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xc1, 0xbf, 0xb8, 0xb8, 0xb4, 0xb8, 0xb8, 0xb8, 0xb8, 0xb4,
-    0xb3, 0xb3, 0xb3, 0xb3, 0xb8, 0xb3, 0xb4, 0xb3, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x01, 0x01, 0x05, 0x05, 0x0a, 0x0e, 0x16, 0x19, 0x1a, 0x1f,
-    0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x28, 0x29, 0x28, 0x2c, 0x2d, 0x34,
-    0x34, 0x37, 0x3e, 0x3f, 0x3f, 0x46, 0x46, 0x46, 0x49, 0x4a, 0x4a, 0x4a,
-    0x53, 0x53, 0x56, 0x56, 0x56, 0x55, 0x55, 0x5e, 0x5f, 0x5f, 0x63, 0x63,
-    0x63, 0x6a, 0x6a, 0x6a, 0x6a, 0x6e, 0x6f, 0x6e, 0x74, 0x75, 0x75, 0x75,
-    0x7b, 0x76, 0x7d, 0x7a, 0x7a, 0x7a, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x90, 0x94, 0x90, 0x90, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x99, 0x9d, 0x9d, 0x9d, 0x99, 0x99, 0xa3, 0xa7,
-    0xa3, 0xa7, 0xa7, 0xa7, 0xaa, 0xaa, 0xaa, 0xaa, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb8, 0xbf, 0xc1, 0xbf, 0xcb, 0xcb, 0xd8, 0xd8, 0xd8, 0xcc, 0xbf, 0x9f,
-    0x7a, 0x4e, 0x2d, 0x1e, 0x0e, 0x0a, 0x0a, 0x0a, 0x0e, 0x1e, 0x28, 0x34,
-    0x43, 0x4e, 0x52, 0x52, 0x4e, 0x4e, 0x4d, 0x53, 0x4d, 0x53, 0x53, 0x53,
-    0x53, 0x4e, 0x4e, 0x5b, 0x55, 0x5f, 0x5f, 0x63, 0x66, 0x66, 0x68, 0x68,
-    0x6c, 0x6c, 0x71, 0x71, 0x74, 0x74, 0x74, 0x7a, 0x76, 0x76, 0x76, 0x7d,
-    0x7d, 0x78, 0x7d, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82,
-    0x82, 0x81, 0x81, 0x81, 0x88, 0x88, 0x82, 0x82, 0x88, 0x82, 0x81, 0x88,
-    0x88, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x7d, 0x7d, 0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76,
-    0x78, 0x78, 0x76, 0x76, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x6c, 0x74,
-    0x75, 0x6e, 0x6e, 0x6c, 0x75, 0x74, 0x75, 0x76, 0x76, 0x76, 0x7a, 0x78,
-    0x7a, 0x75, 0x6f, 0x71, 0x71, 0x69, 0x69, 0x66, 0x60, 0x57, 0x52, 0x46,
-    0x3e, 0x37, 0x31, 0x2d, 0x29, 0x26, 0x1f, 0x1e, 0x19, 0x19, 0x0e, 0x0e,
-    0x0e, 0x0e, 0x16, 0x1e, 0x29, 0x3e, 0x4e, 0x71, 0x8a, 0x99, 0xb8, 0xbf,
-    0xc1, 0xcb, 0xd3, 0xd8, 0xd8, 0xd8, 0xd8, 0xd3, 0xd3, 0xcb, 0xcb, 0xcb,
-    0xc1, 0xc1, 0xbf, 0xbf, 0xc1, 0xb8, 0xb4, 0xb4, 0xb3, 0xb1, 0xb3, 0xb8,
-    0xb3, 0xb8, 0xb3, 0xb3, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xa7,
-    0xa9, 0xa7, 0xa9, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x01, 0x03, 0x05, 0x0a, 0x0a, 0x16, 0x19, 0x1e, 0x1e, 0x1f, 0x26, 0x25,
-    0x26, 0x26, 0x26, 0x26, 0x29, 0x29, 0x2c, 0x2d, 0x2d, 0x34, 0x37, 0x3e,
-    0x3e, 0x3e, 0x3e, 0x41, 0x46, 0x49, 0x49, 0x4a, 0x4a, 0x53, 0x53, 0x56,
-    0x56, 0x56, 0x55, 0x5b, 0x5e, 0x5f, 0x5f, 0x63, 0x63, 0x63, 0x63, 0x66,
-    0x6a, 0x6a, 0x6f, 0x6f, 0x6f, 0x6f, 0x74, 0x71, 0x75, 0x76, 0x7a, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x7d, 0x82, 0x82, 0x82, 0x82, 0x82, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x90, 0x90, 0x90, 0x90, 0x94, 0x97, 0x97, 0x97, 0x94, 0x97,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9d, 0x9d, 0x9f, 0xaa, 0xa7, 0xa9,
-    0xa7, 0xaa, 0xaa, 0xa9, 0xaa, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xbf, 0xbf,
-    0xc1, 0xcb, 0xcb, 0xd8, 0xd8, 0xd8, 0xcb, 0xb8, 0x9f, 0x71, 0x44, 0x26,
-    0x0e, 0x0a, 0x05, 0x05, 0x0a, 0x16, 0x1e, 0x28, 0x34, 0x43, 0x4e, 0x52,
-    0x4e, 0x4e, 0x52, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x52, 0x53,
-    0x55, 0x5b, 0x56, 0x5e, 0x5e, 0x5e, 0x68, 0x68, 0x6a, 0x6c, 0x6c, 0x71,
-    0x71, 0x6c, 0x74, 0x71, 0x74, 0x76, 0x76, 0x7a, 0x76, 0x76, 0x7d, 0x7d,
-    0x7d, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81,
-    0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x78, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x74,
-    0x74, 0x74, 0x75, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6e, 0x75,
-    0x74, 0x74, 0x75, 0x75, 0x76, 0x78, 0x7b, 0x7b, 0x71, 0x71, 0x66, 0x69,
-    0x60, 0x60, 0x5b, 0x57, 0x52, 0x46, 0x3e, 0x37, 0x31, 0x2a, 0x2c, 0x25,
-    0x1f, 0x1a, 0x19, 0x16, 0x0e, 0x0e, 0x0e, 0x0e, 0x19, 0x1e, 0x29, 0x3c,
-    0x5b, 0x7a, 0x90, 0xac, 0xb8, 0xbf, 0xcc, 0xcc, 0xd8, 0xd8, 0xd8, 0xd8,
-    0xd8, 0xcb, 0xcb, 0xc1, 0xc1, 0xc1, 0xbf, 0xb8, 0xb8, 0xb8, 0xb3, 0xb8,
-    0xb3, 0xb3, 0xb4, 0xb3, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9,
-    0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa9, 0xa7, 0xa9, 0xa9, 0xa9, 0xa9,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x05,
-    0x0a, 0x0a, 0x0e, 0x16, 0x1e, 0x1e, 0x1f, 0x26, 0x26, 0x25, 0x26, 0x26,
-    0x26, 0x29, 0x29, 0x29, 0x2c, 0x2d, 0x31, 0x37, 0x37, 0x3e, 0x3e, 0x3e,
-    0x46, 0x46, 0x46, 0x49, 0x4a, 0x4a, 0x53, 0x53, 0x4e, 0x55, 0x57, 0x5b,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x63, 0x68, 0x66, 0x6a, 0x6c, 0x6c, 0x71,
-    0x6e, 0x6e, 0x74, 0x71, 0x75, 0x75, 0x7a, 0x78, 0x76, 0x78, 0x7d, 0x7a,
-    0x7a, 0x7a, 0x82, 0x89, 0x82, 0x82, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90,
-    0x94, 0x94, 0x90, 0x90, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x9d,
-    0x9f, 0x9d, 0x9d, 0x9d, 0xa3, 0x9d, 0x9d, 0xa3, 0xa7, 0xa7, 0xaa, 0xaa,
-    0xac, 0xaa, 0xaa, 0xb4, 0xb4, 0xb4, 0xb4, 0xb8, 0xbf, 0xbf, 0xbf, 0xcb,
-    0xd8, 0xd8, 0xd8, 0xbf, 0xaa, 0x8a, 0x57, 0x2d, 0x19, 0x0a, 0x05, 0x05,
-    0x05, 0x0a, 0x19, 0x1e, 0x2f, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44, 0x47,
-    0x46, 0x44, 0x46, 0x46, 0x4e, 0x4e, 0x4a, 0x53, 0x53, 0x55, 0x56, 0x55,
-    0x5f, 0x5f, 0x5e, 0x68, 0x68, 0x66, 0x68, 0x6c, 0x6c, 0x6e, 0x6c, 0x6c,
-    0x74, 0x74, 0x76, 0x76, 0x7a, 0x76, 0x76, 0x76, 0x7d, 0x7d, 0x7d, 0x7a,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x81, 0x81, 0x7d, 0x81, 0x81, 0x82, 0x81, 0x81,
-    0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x7d, 0x7d, 0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x78, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x75,
-    0x75, 0x74, 0x74, 0x75, 0x74, 0x74, 0x75, 0x75, 0x74, 0x76, 0x76, 0x76,
-    0x75, 0x7a, 0x6f, 0x6f, 0x71, 0x66, 0x66, 0x57, 0x57, 0x52, 0x46, 0x46,
-    0x3e, 0x37, 0x31, 0x29, 0x25, 0x25, 0x1f, 0x1b, 0x19, 0x0e, 0x0e, 0x0a,
-    0x0a, 0x07, 0x0c, 0x1e, 0x28, 0x3c, 0x5b, 0x7a, 0x97, 0xac, 0xb4, 0xbf,
-    0xcb, 0xd8, 0xd8, 0xd8, 0xd3, 0xd3, 0xcb, 0xcb, 0xcb, 0xbf, 0xbf, 0xbf,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb3, 0xb3, 0xb1, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9,
-    0xa7, 0xa9, 0xa9, 0xa9, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa7, 0xa7, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x01, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x05, 0x0a, 0x0a, 0x11,
-    0x16, 0x19, 0x1e, 0x1f, 0x1f, 0x26, 0x26, 0x26, 0x26, 0x26, 0x28, 0x28,
-    0x29, 0x29, 0x2d, 0x2d, 0x37, 0x37, 0x3d, 0x3e, 0x3f, 0x46, 0x41, 0x46,
-    0x46, 0x4a, 0x4a, 0x4a, 0x4e, 0x4e, 0x52, 0x57, 0x56, 0x56, 0x56, 0x5f,
-    0x5f, 0x5f, 0x5e, 0x68, 0x68, 0x6a, 0x6c, 0x66, 0x71, 0x6e, 0x6c, 0x74,
-    0x74, 0x74, 0x74, 0x7a, 0x76, 0x78, 0x7a, 0x7a, 0x78, 0x7a, 0x7a, 0x82,
-    0x82, 0x82, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x90, 0x94, 0x94,
-    0x94, 0x94, 0x97, 0x90, 0x94, 0x97, 0x97, 0x97, 0x9d, 0x97, 0x99, 0x9d,
-    0x99, 0x99, 0x99, 0x9d, 0xa3, 0x9d, 0xaa, 0xa9, 0xac, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xb4, 0xb4, 0xb4, 0xbf, 0xbf, 0xbf, 0xcb, 0xcc, 0xd8, 0xcc,
-    0xc1, 0x99, 0x71, 0x3d, 0x1f, 0x07, 0x03, 0x01, 0x01, 0x03, 0x0e, 0x19,
-    0x26, 0x2d, 0x3c, 0x3e, 0x44, 0x44, 0x44, 0x47, 0x41, 0x46, 0x41, 0x46,
-    0x44, 0x46, 0x49, 0x4a, 0x4d, 0x4e, 0x55, 0x56, 0x5b, 0x5b, 0x5e, 0x5e,
-    0x68, 0x68, 0x66, 0x68, 0x68, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x71, 0x71,
-    0x7a, 0x74, 0x7a, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x7a, 0x7a, 0x76,
-    0x7d, 0x76, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7a, 0x7a, 0x7a, 0x7a, 0x7d,
-    0x82, 0x7d, 0x7d, 0x7d, 0x7d, 0x7a, 0x7a, 0x7d, 0x7d, 0x7d, 0x7d, 0x78,
-    0x78, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x7a, 0x75, 0x75, 0x76, 0x76, 0x76,
-    0x76, 0x75, 0x74, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x75, 0x76, 0x71, 0x74, 0x74, 0x71, 0x6f, 0x6a,
-    0x69, 0x60, 0x57, 0x52, 0x46, 0x3e, 0x3e, 0x37, 0x2d, 0x2a, 0x25, 0x25,
-    0x1b, 0x19, 0x0c, 0x0e, 0x07, 0x0a, 0x08, 0x0a, 0x0e, 0x19, 0x26, 0x34,
-    0x4e, 0x7a, 0x97, 0xac, 0xb8, 0xcb, 0xcc, 0xd8, 0xd8, 0xd8, 0xd8, 0xcc,
-    0xcb, 0xcb, 0xbf, 0xc1, 0xc1, 0xb4, 0xb4, 0xb1, 0xb3, 0xb1, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa9, 0xa9, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x05, 0x03, 0x03, 0x0a, 0x0a, 0x16, 0x19, 0x1a,
-    0x1f, 0x1f, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x29, 0x29, 0x29, 0x29,
-    0x2d, 0x37, 0x37, 0x37, 0x3e, 0x3e, 0x3e, 0x46, 0x44, 0x44, 0x52, 0x47,
-    0x4a, 0x4a, 0x4e, 0x52, 0x56, 0x56, 0x56, 0x56, 0x5f, 0x5f, 0x5e, 0x66,
-    0x68, 0x68, 0x68, 0x66, 0x66, 0x6c, 0x6e, 0x6e, 0x6c, 0x71, 0x71, 0x71,
-    0x74, 0x74, 0x7a, 0x7a, 0x78, 0x7a, 0x7a, 0x7a, 0x82, 0x82, 0x82, 0x82,
-    0x8a, 0x88, 0x8a, 0x8a, 0x90, 0x90, 0x94, 0x90, 0x90, 0x90, 0x90, 0x94,
-    0x94, 0x94, 0x97, 0x97, 0x97, 0x97, 0x97, 0x9d, 0x9d, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0xa3, 0xa7, 0xa3, 0xa9, 0xaa, 0xa7, 0xaa, 0xa9, 0xaa, 0xaa,
-    0xb4, 0xb4, 0xb4, 0xc1, 0xbf, 0xcb, 0xcc, 0xcc, 0xbf, 0xaa, 0x8a, 0x4e,
-    0x29, 0x0e, 0x03, 0x01, 0x01, 0x03, 0x0a, 0x0e, 0x1e, 0x26, 0x2d, 0x34,
-    0x3e, 0x3d, 0x3e, 0x3d, 0x3d, 0x3d, 0x3e, 0x44, 0x46, 0x44, 0x47, 0x47,
-    0x4a, 0x4e, 0x4e, 0x4d, 0x55, 0x5b, 0x56, 0x5f, 0x5e, 0x5e, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x6c, 0x6c, 0x6c, 0x6c, 0x71, 0x71, 0x74, 0x74, 0x74,
-    0x74, 0x76, 0x7a, 0x7a, 0x7a, 0x76, 0x7a, 0x7a, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x7d, 0x7d, 0x7d, 0x7a, 0x76, 0x7a, 0x7a, 0x7a, 0x7a,
-    0x7a, 0x7a, 0x76, 0x76, 0x78, 0x76, 0x76, 0x78, 0x76, 0x78, 0x76, 0x78,
-    0x7a, 0x75, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75,
-    0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x76, 0x76,
-    0x76, 0x74, 0x71, 0x6c, 0x6e, 0x69, 0x66, 0x60, 0x57, 0x52, 0x46, 0x3e,
-    0x37, 0x31, 0x31, 0x2a, 0x25, 0x25, 0x1b, 0x19, 0x0c, 0x0c, 0x07, 0x05,
-    0x05, 0x05, 0x0a, 0x0e, 0x1e, 0x2f, 0x44, 0x66, 0x8a, 0xac, 0xb4, 0xc1,
-    0xcc, 0xd8, 0xd8, 0xd8, 0xd8, 0xcc, 0xcb, 0xbf, 0xbf, 0xb8, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb1, 0xa7, 0xa9, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa3,
-    0xa3, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x91, 0x97, 0x97, 0x97, 0x91, 0x97, 0x97, 0x97,
-    0x01, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x01, 0x02, 0x03, 0x05, 0x0a, 0x0e, 0x0e, 0x1a, 0x1a, 0x1f, 0x1f, 0x26,
-    0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x28, 0x29, 0x29, 0x2d, 0x2d, 0x30,
-    0x37, 0x37, 0x3e, 0x3e, 0x46, 0x46, 0x46, 0x44, 0x49, 0x4a, 0x4d, 0x4e,
-    0x53, 0x56, 0x56, 0x56, 0x56, 0x5e, 0x5f, 0x5f, 0x66, 0x63, 0x63, 0x6a,
-    0x69, 0x66, 0x6e, 0x6c, 0x6c, 0x6e, 0x71, 0x71, 0x74, 0x75, 0x71, 0x7a,
-    0x76, 0x76, 0x78, 0x7d, 0x82, 0x82, 0x82, 0x89, 0x82, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x90, 0x94, 0x85, 0x94, 0x94, 0x94, 0x90, 0x94, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x9d, 0x9d, 0x99, 0x99, 0x99, 0xa3,
-    0xa3, 0xa7, 0xa9, 0xa7, 0xaa, 0xa9, 0xa9, 0xa9, 0xa7, 0xb1, 0xb4, 0xb4,
-    0xb4, 0xbf, 0xbf, 0xcb, 0xcb, 0xb4, 0x97, 0x66, 0x37, 0x1e, 0x08, 0x01,
-    0x01, 0x01, 0x03, 0x08, 0x16, 0x1e, 0x26, 0x2f, 0x34, 0x37, 0x3e, 0x3d,
-    0x3e, 0x3d, 0x3e, 0x3f, 0x3f, 0x44, 0x44, 0x47, 0x47, 0x4d, 0x4e, 0x4d,
-    0x4d, 0x55, 0x56, 0x55, 0x56, 0x5e, 0x5e, 0x5e, 0x68, 0x68, 0x68, 0x68,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x71, 0x76, 0x74, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x7a, 0x7a, 0x76,
-    0x78, 0x76, 0x7a, 0x76, 0x76, 0x76, 0x76, 0x7a, 0x7a, 0x76, 0x76, 0x7a,
-    0x78, 0x76, 0x76, 0x76, 0x76, 0x75, 0x75, 0x75, 0x76, 0x76, 0x76, 0x76,
-    0x74, 0x75, 0x75, 0x74, 0x75, 0x74, 0x74, 0x75, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x71, 0x6e,
-    0x6a, 0x69, 0x60, 0x5b, 0x52, 0x46, 0x3e, 0x37, 0x31, 0x2a, 0x20, 0x25,
-    0x1b, 0x17, 0x0c, 0x0c, 0x07, 0x05, 0x03, 0x05, 0x05, 0x0a, 0x16, 0x26,
-    0x3c, 0x5b, 0x82, 0xa1, 0xb8, 0xc1, 0xcb, 0xd8, 0xd8, 0xd8, 0xd3, 0xcb,
-    0xcb, 0xbf, 0xbf, 0xb8, 0xb8, 0xb4, 0xb3, 0xb1, 0xa7, 0xa9, 0xa7, 0xa9,
-    0xa3, 0xa3, 0xa3, 0xa3, 0x99, 0x99, 0x99, 0x9d, 0x9d, 0x99, 0x99, 0x97,
-    0x97, 0x97, 0x9c, 0x91, 0x97, 0x91, 0x91, 0x91, 0x91, 0x97, 0x97, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x97, 0x97, 0x97, 0x97, 0x03, 0x05, 0x02, 0x01,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x05,
-    0x05, 0x0a, 0x0a, 0x0e, 0x19, 0x1e, 0x1e, 0x1f, 0x1f, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x26, 0x25, 0x29, 0x29, 0x2d, 0x2d, 0x31, 0x37, 0x37, 0x3e,
-    0x3e, 0x3e, 0x46, 0x46, 0x49, 0x49, 0x4a, 0x4e, 0x53, 0x53, 0x53, 0x56,
-    0x55, 0x55, 0x56, 0x5f, 0x5e, 0x5e, 0x68, 0x63, 0x63, 0x68, 0x68, 0x6c,
-    0x6c, 0x6e, 0x71, 0x71, 0x75, 0x75, 0x75, 0x71, 0x76, 0x76, 0x76, 0x7d,
-    0x7d, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82, 0x8a, 0x8a, 0x8a, 0x89, 0x8a,
-    0x8a, 0x89, 0x89, 0x90, 0x90, 0x94, 0x90, 0x90, 0x94, 0x94, 0x94, 0x97,
-    0x97, 0x97, 0x94, 0x94, 0x97, 0x97, 0x99, 0x99, 0x9d, 0x9d, 0x9d, 0xa3,
-    0xa7, 0xa3, 0xa3, 0xa7, 0xa9, 0xa7, 0xa7, 0xb3, 0xb1, 0xb4, 0xb4, 0xbf,
-    0xbf, 0xbf, 0xaa, 0x82, 0x4e, 0x26, 0x0e, 0x03, 0x01, 0x02, 0x02, 0x05,
-    0x0a, 0x16, 0x1e, 0x26, 0x2d, 0x34, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x3d,
-    0x3f, 0x3e, 0x44, 0x47, 0x47, 0x47, 0x4e, 0x4d, 0x4d, 0x53, 0x53, 0x56,
-    0x56, 0x56, 0x5e, 0x5e, 0x5e, 0x63, 0x68, 0x68, 0x68, 0x6c, 0x6c, 0x6c,
-    0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x7a, 0x76, 0x7a, 0x7a, 0x76, 0x75, 0x76, 0x76, 0x76, 0x76, 0x75, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x76, 0x74, 0x74, 0x76, 0x76, 0x76, 0x76, 0x76, 0x78, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x78, 0x75, 0x6f, 0x6e, 0x69, 0x69, 0x60, 0x57, 0x52,
-    0x46, 0x37, 0x31, 0x2a, 0x20, 0x20, 0x10, 0x17, 0x0d, 0x0c, 0x0c, 0x07,
-    0x03, 0x05, 0x03, 0x05, 0x0e, 0x1e, 0x29, 0x4e, 0x71, 0x97, 0xac, 0xc1,
-    0xcb, 0xd8, 0xd8, 0xd8, 0xd8, 0xcc, 0xcc, 0xbf, 0xbf, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa7, 0xa3, 0x9d, 0x9d, 0x99,
-    0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x91, 0x91, 0x97, 0x91, 0x97, 0x91,
-    0x97, 0x91, 0x91, 0x97, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x05, 0x05, 0x05, 0x02, 0x02, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x01, 0x01, 0x05, 0x05, 0x08,
-    0x0e, 0x19, 0x19, 0x1e, 0x1e, 0x1f, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
-    0x26, 0x29, 0x29, 0x29, 0x2d, 0x2d, 0x31, 0x37, 0x37, 0x3e, 0x3e, 0x3e,
-    0x41, 0x41, 0x49, 0x4a, 0x4a, 0x4a, 0x53, 0x56, 0x56, 0x56, 0x56, 0x5e,
-    0x5f, 0x5f, 0x5e, 0x5e, 0x63, 0x68, 0x68, 0x68, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6e, 0x6c, 0x74, 0x75, 0x75, 0x76, 0x76, 0x7d, 0x7d, 0x7d, 0x82,
-    0x82, 0x82, 0x81, 0x82, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x90, 0x94, 0x90, 0x94, 0x94, 0x90, 0x90, 0x90, 0x94,
-    0x94, 0x97, 0x94, 0x97, 0x99, 0x99, 0x9d, 0x99, 0x99, 0x99, 0x9d, 0xa3,
-    0xa3, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xb1, 0xb4, 0xbf, 0xbf, 0xaa, 0x90,
-    0x5b, 0x2d, 0x19, 0x03, 0x01, 0x02, 0x02, 0x01, 0x05, 0x0a, 0x16, 0x1e,
-    0x26, 0x29, 0x2d, 0x31, 0x37, 0x37, 0x37, 0x37, 0x3e, 0x3e, 0x3d, 0x3d,
-    0x44, 0x47, 0x47, 0x47, 0x4d, 0x4a, 0x53, 0x53, 0x56, 0x56, 0x55, 0x56,
-    0x5f, 0x5f, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x74, 0x74, 0x6c, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x74, 0x76, 0x76, 0x74, 0x74, 0x76,
-    0x76, 0x74, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x76,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x75,
-    0x75, 0x6f, 0x63, 0x60, 0x57, 0x52, 0x46, 0x3f, 0x36, 0x31, 0x2a, 0x20,
-    0x17, 0x10, 0x0d, 0x0c, 0x0c, 0x07, 0x03, 0x05, 0x05, 0x05, 0x05, 0x0e,
-    0x1f, 0x34, 0x5b, 0x82, 0xa1, 0xb8, 0xcb, 0xcb, 0xd8, 0xd8, 0xd8, 0xcb,
-    0xc1, 0xbf, 0xbf, 0xb4, 0xb4, 0xb4, 0xb1, 0xaa, 0xa7, 0xa9, 0xa9, 0xa9,
-    0xa3, 0xa3, 0x99, 0x9d, 0x9d, 0x99, 0x97, 0x97, 0x97, 0x97, 0x91, 0x91,
-    0x91, 0x91, 0x90, 0x94, 0x97, 0x97, 0x97, 0x97, 0x91, 0x91, 0x90, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x05, 0x05, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x05, 0x0a, 0x0e, 0x0e, 0x16,
-    0x1e, 0x1e, 0x1f, 0x26, 0x26, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x2c,
-    0x29, 0x29, 0x2d, 0x2d, 0x37, 0x37, 0x3e, 0x3f, 0x3d, 0x47, 0x46, 0x41,
-    0x49, 0x4a, 0x4a, 0x53, 0x53, 0x56, 0x56, 0x56, 0x56, 0x5f, 0x5f, 0x5f,
-    0x5e, 0x68, 0x68, 0x68, 0x68, 0x6a, 0x6a, 0x6a, 0x6c, 0x6e, 0x6c, 0x6e,
-    0x75, 0x7a, 0x75, 0x76, 0x76, 0x76, 0x78, 0x7d, 0x82, 0x81, 0x81, 0x81,
-    0x81, 0x82, 0x82, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x90, 0x90, 0x90, 0x94, 0x90, 0x90, 0x90, 0x90, 0x94, 0x94, 0x90, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x99, 0x97, 0x99, 0x99, 0x99, 0x9d, 0x99, 0xa3,
-    0xa3, 0xa9, 0xa7, 0xa7, 0xb4, 0xb4, 0xb8, 0x97, 0x71, 0x3d, 0x26, 0x07,
-    0x01, 0x02, 0x02, 0x01, 0x01, 0x05, 0x08, 0x16, 0x1e, 0x26, 0x29, 0x30,
-    0x2d, 0x2d, 0x34, 0x34, 0x37, 0x37, 0x3e, 0x3e, 0x3e, 0x46, 0x44, 0x49,
-    0x49, 0x4a, 0x4a, 0x53, 0x4d, 0x56, 0x55, 0x56, 0x5f, 0x5f, 0x5f, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x74, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x7d, 0x7d, 0x7d, 0x81, 0x78,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x76, 0x74, 0x6c, 0x6a, 0x5f, 0x56,
-    0x52, 0x44, 0x3f, 0x36, 0x2a, 0x20, 0x20, 0x17, 0x17, 0x0d, 0x0c, 0x07,
-    0x07, 0x05, 0x05, 0x05, 0x05, 0x08, 0x16, 0x26, 0x3d, 0x66, 0x90, 0xac,
-    0xc1, 0xcb, 0xd8, 0xd8, 0xd8, 0xcc, 0xcb, 0xbf, 0xbf, 0xbf, 0xb4, 0xb4,
-    0xb4, 0xa9, 0xa9, 0xa7, 0xa7, 0xa3, 0xa3, 0xa3, 0x99, 0x99, 0x9d, 0x9d,
-    0x99, 0x97, 0x91, 0x97, 0x97, 0x91, 0x91, 0x91, 0x90, 0x91, 0x93, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x88, 0x88, 0x88, 0x88, 0x91, 0x0a, 0x05, 0x05, 0x05,
-    0x05, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x05, 0x03, 0x0a, 0x0a, 0x0e, 0x1a, 0x1a, 0x1e, 0x1f,
-    0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x28, 0x29, 0x28, 0x29,
-    0x2d, 0x30, 0x37, 0x3e, 0x3e, 0x3e, 0x3e, 0x46, 0x41, 0x49, 0x4a, 0x4a,
-    0x53, 0x53, 0x53, 0x56, 0x56, 0x56, 0x56, 0x5f, 0x5f, 0x5f, 0x63, 0x63,
-    0x68, 0x6a, 0x6a, 0x6c, 0x6a, 0x6e, 0x6c, 0x75, 0x75, 0x74, 0x74, 0x76,
-    0x76, 0x7a, 0x76, 0x76, 0x7d, 0x81, 0x81, 0x82, 0x82, 0x83, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x81, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x97, 0x97, 0x94, 0x97, 0x9d, 0x99, 0x99, 0x9d, 0xa3, 0xa9,
-    0xa7, 0xb1, 0xa9, 0x99, 0x7a, 0x4e, 0x29, 0x0e, 0x03, 0x02, 0x01, 0x01,
-    0x02, 0x05, 0x05, 0x0e, 0x16, 0x1e, 0x26, 0x28, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x31, 0x37, 0x37, 0x3e, 0x3e, 0x3e, 0x3f, 0x46, 0x46, 0x44, 0x4a, 0x4a,
-    0x53, 0x53, 0x56, 0x56, 0x56, 0x5e, 0x5e, 0x5e, 0x5e, 0x68, 0x68, 0x66,
-    0x68, 0x68, 0x68, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e,
-    0x6e, 0x6e, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75,
-    0x75, 0x74, 0x74, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x75, 0x75, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x78, 0x78,
-    0x78, 0x7d, 0x81, 0x81, 0x81, 0x88, 0x88, 0x84, 0x84, 0x88, 0x88, 0x81,
-    0x84, 0x78, 0x75, 0x6e, 0x66, 0x60, 0x57, 0x52, 0x46, 0x3e, 0x2d, 0x2a,
-    0x20, 0x20, 0x10, 0x0d, 0x0c, 0x0c, 0x07, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x08, 0x16, 0x29, 0x43, 0x71, 0x9d, 0xb4, 0xbf, 0xcc, 0xd8, 0xd8, 0xcc,
-    0xcb, 0xbf, 0xc1, 0xb4, 0xb8, 0xb4, 0xac, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9,
-    0xa3, 0xa3, 0xa3, 0x99, 0x99, 0x99, 0x99, 0x97, 0x97, 0x91, 0x97, 0x97,
-    0x90, 0x90, 0x91, 0x91, 0x91, 0x90, 0x90, 0x94, 0x94, 0x91, 0x90, 0x90,
-    0x91, 0x91, 0x93, 0x91, 0x91, 0x93, 0x91, 0x91, 0x8a, 0x91, 0x88, 0x88,
-    0x84, 0x88, 0x88, 0x88, 0x07, 0x0a, 0x0a, 0x05, 0x05, 0x05, 0x01, 0x01,
-    0x02, 0x01, 0x00, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01,
-    0x01, 0x05, 0x05, 0x0a, 0x11, 0x16, 0x19, 0x1e, 0x1f, 0x1f, 0x1f, 0x26,
-    0x26, 0x25, 0x25, 0x26, 0x26, 0x26, 0x28, 0x29, 0x29, 0x2d, 0x2d, 0x34,
-    0x37, 0x3e, 0x3e, 0x3e, 0x41, 0x41, 0x49, 0x4e, 0x4a, 0x52, 0x53, 0x53,
-    0x53, 0x56, 0x55, 0x5b, 0x5e, 0x5f, 0x5f, 0x63, 0x68, 0x66, 0x66, 0x66,
-    0x6a, 0x6a, 0x71, 0x6e, 0x6c, 0x6e, 0x74, 0x75, 0x75, 0x7a, 0x7a, 0x76,
-    0x76, 0x7d, 0x7a, 0x7d, 0x82, 0x7d, 0x82, 0x83, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x89, 0x8a, 0x88, 0x8a, 0x8a, 0x89, 0x90, 0x90, 0x90, 0x94,
-    0x94, 0x94, 0x90, 0x94, 0x94, 0x97, 0x9d, 0x9d, 0xa3, 0xa9, 0xa9, 0xa3,
-    0x82, 0x55, 0x2d, 0x19, 0x03, 0x01, 0x01, 0x00, 0x00, 0x01, 0x05, 0x0a,
-    0x0e, 0x16, 0x1e, 0x26, 0x28, 0x29, 0x2c, 0x2d, 0x30, 0x2d, 0x31, 0x37,
-    0x37, 0x3d, 0x3d, 0x3d, 0x46, 0x41, 0x49, 0x4a, 0x4a, 0x4a, 0x4e, 0x56,
-    0x56, 0x55, 0x5e, 0x5e, 0x5e, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x6c, 0x71, 0x6c, 0x6c, 0x71, 0x6c, 0x6e, 0x6e, 0x6c, 0x6c, 0x6e, 0x75,
-    0x74, 0x6c, 0x75, 0x74, 0x74, 0x74, 0x71, 0x71, 0x75, 0x75, 0x75, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x7d, 0x7d, 0x7d, 0x7d, 0x81, 0x81, 0x84, 0x81, 0x88, 0x88, 0x88,
-    0x88, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8a, 0x82, 0x83, 0x75, 0x6f, 0x69,
-    0x60, 0x57, 0x52, 0x46, 0x37, 0x31, 0x2a, 0x20, 0x20, 0x10, 0x0d, 0x0c,
-    0x0c, 0x07, 0x07, 0x05, 0x01, 0x01, 0x03, 0x0a, 0x16, 0x2f, 0x4e, 0x7a,
-    0x9d, 0xb4, 0xcc, 0xcc, 0xd8, 0xcc, 0xcc, 0xbf, 0xbf, 0xb4, 0xb4, 0xb8,
-    0xac, 0xa7, 0xa9, 0xa9, 0xa9, 0xa3, 0xa3, 0xa3, 0xa3, 0x99, 0x9d, 0x99,
-    0x9d, 0x9d, 0x97, 0x97, 0x97, 0x91, 0x91, 0x90, 0x90, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x8a, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x88, 0x88, 0x91, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x0e, 0x0e, 0x0a, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x05, 0x05,
-    0x0a, 0x0e, 0x0e, 0x19, 0x1a, 0x1f, 0x1f, 0x26, 0x26, 0x26, 0x26, 0x25,
-    0x26, 0x26, 0x25, 0x25, 0x29, 0x29, 0x2d, 0x30, 0x37, 0x37, 0x37, 0x3e,
-    0x3e, 0x46, 0x41, 0x49, 0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x56, 0x55,
-    0x5b, 0x5b, 0x5e, 0x5f, 0x63, 0x68, 0x66, 0x63, 0x66, 0x66, 0x6c, 0x71,
-    0x6e, 0x6c, 0x6c, 0x74, 0x74, 0x74, 0x71, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
-    0x7a, 0x7d, 0x7d, 0x7d, 0x82, 0x7a, 0x82, 0x82, 0x82, 0x82, 0x82, 0x89,
-    0x82, 0x89, 0x82, 0x82, 0x82, 0x8a, 0x8a, 0x8a, 0x8a, 0x82, 0x82, 0x8a,
-    0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x89,
-    0x91, 0x8a, 0x90, 0x90, 0x97, 0x99, 0xa3, 0x99, 0x88, 0x63, 0x37, 0x1e,
-    0x0a, 0x05, 0x01, 0x00, 0x00, 0x00, 0x02, 0x05, 0x0a, 0x0a, 0x16, 0x1e,
-    0x26, 0x25, 0x29, 0x29, 0x2c, 0x30, 0x2d, 0x2d, 0x37, 0x37, 0x37, 0x3d,
-    0x3d, 0x44, 0x41, 0x49, 0x49, 0x4a, 0x53, 0x53, 0x56, 0x56, 0x56, 0x5f,
-    0x5f, 0x5e, 0x68, 0x68, 0x63, 0x68, 0x68, 0x68, 0x6c, 0x66, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c, 0x74, 0x71, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x7d, 0x7d, 0x7d, 0x81, 0x81, 0x81, 0x81,
-    0x88, 0x88, 0x88, 0x88, 0x91, 0x90, 0x91, 0x94, 0x94, 0x97, 0x97, 0x97,
-    0x90, 0x90, 0x8a, 0x82, 0x7b, 0x6f, 0x69, 0x60, 0x57, 0x52, 0x41, 0x37,
-    0x31, 0x2a, 0x20, 0x10, 0x10, 0x0d, 0x0c, 0x0c, 0x07, 0x05, 0x05, 0x01,
-    0x05, 0x05, 0x0a, 0x19, 0x2d, 0x5b, 0x82, 0xac, 0xbf, 0xcc, 0xd8, 0xd8,
-    0xcc, 0xcb, 0xbf, 0xc1, 0xb4, 0xb4, 0xb4, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9,
-    0xa7, 0xa3, 0x9d, 0x99, 0x99, 0x9d, 0x99, 0x97, 0x97, 0x9d, 0x94, 0x91,
-    0x97, 0x91, 0x91, 0x91, 0x94, 0x91, 0x90, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x91, 0x88, 0x93, 0x88, 0x88, 0x91, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x84, 0x88, 0x88, 0x88, 0x88, 0x84, 0x0e, 0x0e, 0x0e, 0x0a,
-    0x0a, 0x05, 0x05, 0x05, 0x05, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x00,
-    0x02, 0x01, 0x00, 0x00, 0x02, 0x01, 0x01, 0x03, 0x05, 0x0a, 0x0a, 0x0e,
-    0x16, 0x19, 0x1e, 0x1e, 0x1f, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
-    0x26, 0x28, 0x29, 0x2d, 0x30, 0x2d, 0x37, 0x37, 0x3e, 0x3e, 0x3e, 0x41,
-    0x41, 0x49, 0x49, 0x46, 0x4a, 0x4a, 0x53, 0x56, 0x57, 0x56, 0x56, 0x5f,
-    0x5e, 0x5e, 0x66, 0x63, 0x66, 0x66, 0x6a, 0x6a, 0x6a, 0x71, 0x71, 0x6f,
-    0x6f, 0x74, 0x74, 0x71, 0x71, 0x7a, 0x7a, 0x7a, 0x7a, 0x76, 0x78, 0x76,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82,
-    0x82, 0x81, 0x82, 0x82, 0x82, 0x82, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x88,
-    0x8a, 0x90, 0x97, 0x97, 0x8a, 0x6a, 0x3d, 0x26, 0x0e, 0x03, 0x01, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x05, 0x0a, 0x0a, 0x16, 0x1e, 0x26, 0x26, 0x29,
-    0x29, 0x29, 0x28, 0x2d, 0x2d, 0x2d, 0x37, 0x37, 0x3d, 0x3d, 0x3e, 0x46,
-    0x46, 0x49, 0x4a, 0x53, 0x53, 0x5b, 0x55, 0x5f, 0x5f, 0x5e, 0x5e, 0x63,
-    0x68, 0x68, 0x68, 0x68, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x74, 0x74, 0x71, 0x71, 0x75, 0x74, 0x74, 0x76, 0x76, 0x76,
-    0x76, 0x7a, 0x76, 0x76, 0x76, 0x78, 0x76, 0x76, 0x7d, 0x7d, 0x81, 0x81,
-    0x82, 0x81, 0x81, 0x88, 0x88, 0x88, 0x91, 0x91, 0x91, 0x97, 0x97, 0x99,
-    0x99, 0x9d, 0xa3, 0xa3, 0xa3, 0xa3, 0x99, 0x99, 0x97, 0x90, 0x8a, 0x7a,
-    0x6f, 0x69, 0x69, 0x57, 0x52, 0x46, 0x37, 0x31, 0x2a, 0x25, 0x17, 0x10,
-    0x0d, 0x0c, 0x07, 0x07, 0x03, 0x05, 0x01, 0x05, 0x05, 0x0a, 0x19, 0x2f,
-    0x5b, 0x8a, 0xac, 0xbf, 0xcc, 0xcc, 0xcc, 0xcb, 0xbf, 0xc1, 0xb8, 0xb8,
-    0xb8, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa3, 0xa3, 0x99, 0x99, 0x99, 0x99,
-    0x97, 0x9d, 0x97, 0x97, 0x97, 0x91, 0x97, 0x97, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x88, 0x84, 0x88, 0x88, 0x88, 0x88,
-    0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x84, 0x19, 0x1a, 0x0e, 0x0e, 0x0e, 0x0a, 0x0a, 0x05,
-    0x05, 0x05, 0x05, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x05, 0x05, 0x0a, 0x0a, 0x0e, 0x16, 0x1a,
-    0x1e, 0x1f, 0x1f, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x28, 0x29,
-    0x2c, 0x2d, 0x30, 0x30, 0x37, 0x3e, 0x3d, 0x3e, 0x46, 0x46, 0x46, 0x46,
-    0x4a, 0x4a, 0x4e, 0x53, 0x53, 0x57, 0x57, 0x56, 0x5f, 0x5e, 0x5e, 0x5f,
-    0x63, 0x63, 0x63, 0x63, 0x66, 0x6c, 0x6c, 0x6f, 0x6f, 0x6c, 0x71, 0x71,
-    0x71, 0x71, 0x74, 0x71, 0x71, 0x75, 0x76, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x82, 0x7a, 0x7a, 0x82,
-    0x82, 0x82, 0x81, 0x7d, 0x82, 0x82, 0x81, 0x82, 0x89, 0x7d, 0x7d, 0x82,
-    0x81, 0x82, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x82, 0x82, 0x88, 0x90,
-    0x8a, 0x66, 0x46, 0x28, 0x19, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x05, 0x0a, 0x0e, 0x16, 0x1e, 0x1f, 0x25, 0x28, 0x29, 0x29, 0x29,
-    0x29, 0x2d, 0x2d, 0x37, 0x37, 0x37, 0x3e, 0x3d, 0x46, 0x44, 0x4e, 0x4d,
-    0x4e, 0x5b, 0x55, 0x56, 0x5f, 0x5e, 0x5e, 0x63, 0x63, 0x68, 0x6a, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x76,
-    0x7a, 0x7a, 0x76, 0x76, 0x76, 0x76, 0x76, 0x7d, 0x7a, 0x7d, 0x81, 0x82,
-    0x81, 0x81, 0x81, 0x81, 0x88, 0x88, 0x88, 0x88, 0x91, 0x91, 0x91, 0x91,
-    0x97, 0x97, 0x99, 0x99, 0xa3, 0xa7, 0xa9, 0xa9, 0xa7, 0xa7, 0xa7, 0xa9,
-    0xa9, 0xa9, 0xa3, 0x99, 0x90, 0x8a, 0x82, 0x7a, 0x66, 0x69, 0x57, 0x52,
-    0x46, 0x37, 0x2d, 0x2a, 0x25, 0x10, 0x10, 0x0d, 0x0c, 0x07, 0x07, 0x01,
-    0x01, 0x02, 0x05, 0x03, 0x0a, 0x19, 0x2d, 0x5b, 0x8a, 0xac, 0xc1, 0xcc,
-    0xd8, 0xcc, 0xcc, 0xc1, 0xb8, 0xb8, 0xb4, 0xb4, 0xa9, 0xa9, 0xa9, 0xa3,
-    0xa3, 0x99, 0x99, 0x9d, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x90, 0x91, 0x91, 0x90, 0x91, 0x91, 0x90, 0x8a, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x84, 0x84, 0x88, 0x88, 0x84, 0x88, 0x84, 0x84, 0x88,
-    0x88, 0x88, 0x88, 0x84, 0x88, 0x88, 0x88, 0x81, 0x81, 0x81, 0x81, 0x84,
-    0x1a, 0x1a, 0x19, 0x1a, 0x0e, 0x0e, 0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x01,
-    0x02, 0x05, 0x05, 0x05, 0x0a, 0x0a, 0x0e, 0x16, 0x1a, 0x1e, 0x1e, 0x1f,
-    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x28, 0x28, 0x29, 0x29, 0x2d, 0x2d,
-    0x34, 0x37, 0x37, 0x3e, 0x3d, 0x3f, 0x46, 0x46, 0x49, 0x52, 0x4a, 0x4a,
-    0x53, 0x52, 0x56, 0x55, 0x56, 0x56, 0x5f, 0x5f, 0x5e, 0x66, 0x66, 0x68,
-    0x63, 0x68, 0x6a, 0x6a, 0x71, 0x6c, 0x6c, 0x71, 0x6e, 0x6f, 0x6e, 0x75,
-    0x74, 0x74, 0x71, 0x71, 0x71, 0x7a, 0x71, 0x7b, 0x7a, 0x7b, 0x7a, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x76, 0x7a, 0x7a, 0x7a, 0x7a, 0x78, 0x76,
-    0x76, 0x7a, 0x76, 0x7a, 0x7a, 0x76, 0x76, 0x76, 0x7a, 0x7a, 0x7a, 0x76,
-    0x76, 0x76, 0x78, 0x76, 0x76, 0x7d, 0x81, 0x82, 0x82, 0x68, 0x44, 0x29,
-    0x19, 0x03, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x0a,
-    0x0e, 0x16, 0x1a, 0x1f, 0x26, 0x25, 0x25, 0x29, 0x29, 0x29, 0x29, 0x2d,
-    0x2d, 0x37, 0x37, 0x3e, 0x3e, 0x3d, 0x41, 0x44, 0x4e, 0x4e, 0x53, 0x56,
-    0x56, 0x5f, 0x5f, 0x63, 0x68, 0x68, 0x6c, 0x6c, 0x6c, 0x74, 0x74, 0x74,
-    0x75, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x7d, 0x82, 0x81, 0x81, 0x82,
-    0x81, 0x81, 0x82, 0x82, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8a, 0x94, 0x94,
-    0x91, 0x91, 0x97, 0x99, 0x99, 0xa3, 0xa7, 0xa7, 0xa7, 0xa7, 0xb3, 0xb3,
-    0xb3, 0xb1, 0xb4, 0xb8, 0xb4, 0xb8, 0xb4, 0xb3, 0xa9, 0xa9, 0xa3, 0x97,
-    0x90, 0x82, 0x7a, 0x6f, 0x66, 0x57, 0x52, 0x46, 0x3e, 0x31, 0x2a, 0x25,
-    0x10, 0x0d, 0x0c, 0x0c, 0x07, 0x05, 0x05, 0x02, 0x01, 0x01, 0x05, 0x08,
-    0x19, 0x2d, 0x5b, 0x82, 0xac, 0xc1, 0xcc, 0xcc, 0xcb, 0xcb, 0xbf, 0xb8,
-    0xb8, 0xb4, 0xac, 0xac, 0xa9, 0xa3, 0xa3, 0x99, 0x99, 0x99, 0x99, 0x9d,
-    0x9d, 0x97, 0x91, 0x97, 0x91, 0x90, 0x93, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x88, 0x88, 0x8a, 0x88, 0x88, 0x84, 0x84, 0x84, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0x84, 0x84, 0x81, 0x88, 0x88,
-    0x88, 0x88, 0x81, 0x81, 0x81, 0x84, 0x84, 0x81, 0x1a, 0x1a, 0x1a, 0x1a,
-    0x16, 0x0e, 0x0e, 0x0a, 0x0a, 0x05, 0x05, 0x03, 0x05, 0x05, 0x01, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01,
-    0x05, 0x05, 0x0a, 0x0a, 0x0e, 0x16, 0x1a, 0x1e, 0x1e, 0x1e, 0x26, 0x26,
-    0x26, 0x26, 0x26, 0x26, 0x29, 0x29, 0x28, 0x2c, 0x2d, 0x2d, 0x34, 0x37,
-    0x3e, 0x3e, 0x3e, 0x44, 0x46, 0x44, 0x44, 0x4a, 0x4a, 0x4a, 0x4d, 0x4e,
-    0x55, 0x55, 0x56, 0x56, 0x5e, 0x5e, 0x5b, 0x5e, 0x63, 0x66, 0x6a, 0x6a,
-    0x6a, 0x6a, 0x66, 0x71, 0x71, 0x66, 0x68, 0x6c, 0x6c, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x6f, 0x75, 0x75, 0x74, 0x74, 0x7a, 0x75, 0x7a, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x76, 0x76, 0x7a, 0x76, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
-    0x7a, 0x76, 0x74, 0x75, 0x76, 0x76, 0x76, 0x74, 0x71, 0x74, 0x74, 0x75,
-    0x74, 0x75, 0x76, 0x76, 0x76, 0x63, 0x46, 0x29, 0x19, 0x0a, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x0a, 0x0e, 0x19, 0x1a,
-    0x1f, 0x25, 0x26, 0x26, 0x25, 0x25, 0x28, 0x29, 0x2d, 0x2d, 0x37, 0x34,
-    0x37, 0x3d, 0x3d, 0x3e, 0x46, 0x46, 0x4e, 0x4a, 0x53, 0x56, 0x5f, 0x63,
-    0x68, 0x68, 0x6e, 0x6c, 0x74, 0x76, 0x76, 0x7d, 0x7d, 0x81, 0x81, 0x81,
-    0x81, 0x88, 0x8a, 0x88, 0x88, 0x89, 0x8a, 0x91, 0x91, 0x91, 0x94, 0x94,
-    0x91, 0x97, 0x97, 0x97, 0x9d, 0x99, 0x9d, 0xa7, 0xa7, 0xa9, 0xa7, 0xb1,
-    0xb1, 0xb4, 0xbf, 0xbf, 0xcb, 0xcb, 0xcb, 0xd3, 0xcb, 0xcb, 0xcb, 0xbf,
-    0xbf, 0xc1, 0xb8, 0xb8, 0xa9, 0xa9, 0x99, 0x90, 0x82, 0x7a, 0x71, 0x66,
-    0x60, 0x52, 0x46, 0x3e, 0x31, 0x2a, 0x25, 0x10, 0x0d, 0x0c, 0x0c, 0x07,
-    0x05, 0x01, 0x01, 0x02, 0x02, 0x03, 0x05, 0x16, 0x28, 0x4e, 0x82, 0xac,
-    0xc1, 0xcb, 0xcc, 0xcb, 0xbf, 0xbf, 0xb8, 0xb4, 0xac, 0xac, 0xa9, 0xa7,
-    0xa3, 0x9d, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x90,
-    0x90, 0x91, 0x90, 0x91, 0x90, 0x90, 0x91, 0x91, 0x91, 0x88, 0x88, 0x8a,
-    0x88, 0x88, 0x88, 0x84, 0x88, 0x84, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x81, 0x81, 0x81, 0x81, 0x88, 0x81, 0x88, 0x81, 0x81, 0x81,
-    0x7d, 0x78, 0x7d, 0x78, 0x1a, 0x1e, 0x1a, 0x1a, 0x19, 0x19, 0x19, 0x19,
-    0x0e, 0x0e, 0x0e, 0x0a, 0x0a, 0x05, 0x03, 0x05, 0x03, 0x05, 0x01, 0x01,
-    0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x03, 0x05, 0x0a,
-    0x0a, 0x0e, 0x16, 0x1a, 0x1d, 0x1e, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25,
-    0x28, 0x29, 0x29, 0x29, 0x29, 0x2d, 0x2d, 0x31, 0x37, 0x37, 0x3e, 0x3e,
-    0x3f, 0x46, 0x41, 0x46, 0x49, 0x4a, 0x52, 0x4e, 0x4d, 0x56, 0x56, 0x5b,
-    0x55, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f, 0x63, 0x63, 0x6a, 0x6a, 0x6a, 0x66,
-    0x68, 0x6a, 0x68, 0x68, 0x6c, 0x6c, 0x71, 0x71, 0x71, 0x71, 0x71, 0x6f,
-    0x6e, 0x6c, 0x74, 0x74, 0x75, 0x74, 0x75, 0x75, 0x71, 0x7a, 0x7a, 0x75,
-    0x75, 0x7a, 0x76, 0x76, 0x7a, 0x7a, 0x76, 0x75, 0x75, 0x71, 0x74, 0x71,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x5b, 0x3e, 0x29, 0x19, 0x0a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x05, 0x0a, 0x0e, 0x1a, 0x1b, 0x1f, 0x26, 0x25,
-    0x25, 0x25, 0x25, 0x29, 0x29, 0x2a, 0x2d, 0x2d, 0x30, 0x37, 0x37, 0x3e,
-    0x3d, 0x3d, 0x44, 0x46, 0x46, 0x4a, 0x53, 0x56, 0x63, 0x68, 0x6c, 0x74,
-    0x76, 0x7d, 0x81, 0x88, 0x8a, 0x89, 0x89, 0x94, 0x94, 0x94, 0x94, 0x97,
-    0x9d, 0x99, 0x99, 0x9d, 0x9d, 0xa3, 0xa9, 0xa7, 0xa7, 0xa7, 0xa9, 0xb1,
-    0xb1, 0xb1, 0xb4, 0xbf, 0xbf, 0xbf, 0xcb, 0xcb, 0xd3, 0xd3, 0xd3, 0xde,
-    0xde, 0xde, 0xdf, 0xdf, 0xde, 0xd3, 0xd3, 0xcb, 0xbf, 0xc1, 0xb8, 0xac,
-    0xa9, 0x99, 0x90, 0x82, 0x7a, 0x71, 0x66, 0x5b, 0x52, 0x46, 0x3e, 0x31,
-    0x2a, 0x25, 0x1b, 0x0d, 0x0c, 0x0c, 0x07, 0x05, 0x05, 0x02, 0x02, 0x01,
-    0x01, 0x03, 0x0e, 0x26, 0x44, 0x7a, 0xa1, 0xbf, 0xcc, 0xcc, 0xcc, 0xbf,
-    0xbf, 0xb4, 0xb8, 0xa9, 0xa9, 0xac, 0xa9, 0xa7, 0x9d, 0x99, 0x99, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x90, 0x91,
-    0x91, 0x91, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x84, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x88, 0x81, 0x81, 0x81, 0x7d, 0x78, 0x7d, 0x7d,
-    0x29, 0x34, 0x34, 0x34, 0x3c, 0x3c, 0x3c, 0x3c, 0x34, 0x34, 0x2f, 0x2f,
-    0x28, 0x28, 0x26, 0x1e, 0x1e, 0x19, 0x16, 0x0e, 0x0a, 0x0a, 0x05, 0x05,
-    0x05, 0x01, 0x01, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x0a, 0x0a, 0x0e,
-    0x16, 0x1d, 0x1e, 0x1f, 0x26, 0x26, 0x26, 0x26, 0x26, 0x28, 0x28, 0x29,
-    0x29, 0x2c, 0x2c, 0x30, 0x30, 0x37, 0x37, 0x3e, 0x3e, 0x3e, 0x41, 0x44,
-    0x41, 0x46, 0x46, 0x52, 0x4a, 0x53, 0x53, 0x55, 0x56, 0x56, 0x56, 0x5b,
-    0x5f, 0x5f, 0x5f, 0x63, 0x63, 0x63, 0x69, 0x69, 0x6a, 0x6a, 0x6a, 0x6a,
-    0x66, 0x66, 0x6c, 0x71, 0x71, 0x6e, 0x71, 0x6f, 0x6e, 0x6c, 0x6c, 0x6c,
-    0x71, 0x75, 0x74, 0x74, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-    0x7a, 0x76, 0x75, 0x75, 0x75, 0x74, 0x75, 0x74, 0x74, 0x75, 0x75, 0x6c,
-    0x6e, 0x6c, 0x6c, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x4e, 0x3e, 0x28,
-    0x1a, 0x0a, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x05, 0x03, 0x0a, 0x0e, 0x19, 0x1e, 0x1f, 0x1f, 0x26, 0x26, 0x26, 0x26,
-    0x25, 0x29, 0x29, 0x29, 0x30, 0x2d, 0x34, 0x37, 0x37, 0x37, 0x3e, 0x3e,
-    0x3e, 0x46, 0x4e, 0x4e, 0x5e, 0x6a, 0x74, 0x76, 0x81, 0x88, 0x90, 0x94,
-    0x9d, 0x9d, 0x9d, 0xa3, 0xa7, 0xa9, 0xa9, 0xa7, 0xb1, 0xb1, 0xb4, 0xb4,
-    0xb1, 0xbf, 0xbf, 0xbf, 0xbf, 0xcb, 0xcb, 0xcb, 0xd3, 0xd3, 0xd3, 0xde,
-    0xde, 0xde, 0xdf, 0xdf, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xdf, 0xdf, 0xd3, 0xcb, 0xc1, 0xb8, 0xac, 0xa3, 0x97, 0x90, 0x82, 0x7b,
-    0x6f, 0x66, 0x57, 0x52, 0x43, 0x3e, 0x31, 0x2a, 0x25, 0x1b, 0x0c, 0x0c,
-    0x0c, 0x07, 0x05, 0x01, 0x01, 0x02, 0x01, 0x01, 0x03, 0x0a, 0x1f, 0x3e,
-    0x71, 0xa1, 0xb8, 0xcb, 0xcc, 0xcb, 0xbf, 0xbf, 0xb4, 0xb8, 0xa9, 0xa9,
-    0xa9, 0xa7, 0xa3, 0x99, 0x9d, 0x9d, 0x97, 0x97, 0x97, 0x97, 0x97, 0x91,
-    0x90, 0x90, 0x90, 0x90, 0x8a, 0x91, 0x8a, 0x88, 0x88, 0x88, 0x8a, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0x84, 0x84, 0x84, 0x81, 0x81, 0x88,
-    0x88, 0x81, 0x81, 0x81, 0x84, 0x84, 0x81, 0x7d, 0x69, 0x71, 0x7a, 0x7a,
-    0x85, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7a, 0x7a, 0x71, 0x66, 0x66, 0x59,
-    0x4f, 0x43, 0x3c, 0x34, 0x2f, 0x28, 0x1e, 0x1e, 0x16, 0x0e, 0x0a, 0x03,
-    0x04, 0x01, 0x01, 0x05, 0x03, 0x05, 0x0a, 0x0a, 0x0a, 0x0e, 0x16, 0x1e,
-    0x1f, 0x26, 0x26, 0x26, 0x26, 0x26, 0x28, 0x28, 0x28, 0x29, 0x29, 0x29,
-    0x2d, 0x30, 0x31, 0x34, 0x37, 0x3e, 0x3e, 0x3e, 0x46, 0x46, 0x46, 0x46,
-    0x4e, 0x4d, 0x53, 0x53, 0x53, 0x56, 0x57, 0x57, 0x56, 0x56, 0x5f, 0x5f,
-    0x5e, 0x5e, 0x63, 0x66, 0x68, 0x63, 0x63, 0x6a, 0x66, 0x66, 0x68, 0x6a,
-    0x6a, 0x71, 0x71, 0x6c, 0x6c, 0x71, 0x71, 0x6e, 0x6c, 0x6c, 0x71, 0x6c,
-    0x74, 0x74, 0x74, 0x74, 0x75, 0x74, 0x75, 0x74, 0x7a, 0x75, 0x76, 0x75,
-    0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x6c, 0x6c, 0x66, 0x68, 0x63,
-    0x66, 0x5e, 0x5b, 0x55, 0x57, 0x52, 0x34, 0x28, 0x19, 0x08, 0x05, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x0a,
-    0x0e, 0x16, 0x19, 0x1e, 0x1f, 0x1f, 0x26, 0x26, 0x25, 0x26, 0x25, 0x28,
-    0x29, 0x29, 0x2d, 0x30, 0x2d, 0x37, 0x37, 0x37, 0x3e, 0x3e, 0x44, 0x4a,
-    0x56, 0x66, 0x74, 0x7d, 0x88, 0x90, 0x97, 0x99, 0xa7, 0xa7, 0xb1, 0xb3,
-    0xb1, 0xb4, 0xbf, 0xbf, 0xbf, 0xcb, 0xcb, 0xcb, 0xcb, 0xd3, 0xd3, 0xd3,
-    0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe9, 0xe9, 0xdf, 0xd8, 0xbf,
-    0xb8, 0xa9, 0x99, 0x90, 0x8a, 0x7a, 0x71, 0x6f, 0x66, 0x57, 0x52, 0x46,
-    0x3e, 0x31, 0x2a, 0x25, 0x1b, 0x0d, 0x0c, 0x07, 0x07, 0x05, 0x01, 0x01,
-    0x01, 0x01, 0x05, 0x05, 0x0a, 0x1e, 0x3c, 0x69, 0x97, 0xb8, 0xc1, 0xcc,
-    0xcb, 0xbf, 0xb8, 0xb8, 0xac, 0xa9, 0xa9, 0xa9, 0xa7, 0x9d, 0x99, 0x9d,
-    0x99, 0x97, 0x97, 0x97, 0x97, 0x97, 0x90, 0x91, 0x90, 0x90, 0x91, 0x88,
-    0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84,
-    0x84, 0x88, 0x88, 0x88, 0x88, 0x84, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x81, 0x82, 0x81, 0x84, 0x81, 0x81, 0x81, 0x81, 0x81, 0x88, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0xac, 0xac, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xc1,
-    0xc1, 0xc1, 0xb8, 0xb8, 0xb8, 0xac, 0xac, 0xa1, 0x99, 0x97, 0x90, 0x82,
-    0x7a, 0x71, 0x5b, 0x4e, 0x3c, 0x34, 0x28, 0x1e, 0x16, 0x0e, 0x0a, 0x03,
-    0x05, 0x05, 0x05, 0x05, 0x0a, 0x0a, 0x11, 0x1a, 0x1a, 0x1e, 0x1f, 0x26,
-    0x26, 0x26, 0x26, 0x2c, 0x2c, 0x29, 0x29, 0x29, 0x29, 0x2d, 0x2d, 0x31,
-    0x37, 0x37, 0x37, 0x3e, 0x3e, 0x3e, 0x46, 0x46, 0x46, 0x4a, 0x4a, 0x4a,
-    0x53, 0x53, 0x53, 0x56, 0x57, 0x55, 0x55, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e,
-    0x5e, 0x5e, 0x68, 0x68, 0x66, 0x68, 0x6a, 0x68, 0x6a, 0x6a, 0x6a, 0x66,
-    0x6c, 0x6c, 0x6c, 0x6e, 0x6c, 0x6c, 0x6c, 0x75, 0x6c, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x75, 0x75, 0x75, 0x6e, 0x6c, 0x68, 0x68, 0x69, 0x60, 0x57, 0x52, 0x52,
-    0x46, 0x3e, 0x34, 0x26, 0x19, 0x0a, 0x05, 0x02, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x05, 0x0a, 0x0e, 0x16, 0x19,
-    0x1e, 0x1f, 0x1f, 0x26, 0x26, 0x26, 0x26, 0x26, 0x29, 0x29, 0x29, 0x2c,
-    0x2d, 0x2d, 0x2d, 0x37, 0x37, 0x37, 0x3d, 0x44, 0x4e, 0x66, 0x71, 0x7d,
-    0x82, 0x90, 0x97, 0xa3, 0xa9, 0xb1, 0xb4, 0xc1, 0xc1, 0xbf, 0xcb, 0xcb,
-    0xd3, 0xd3, 0xd8, 0xd3, 0xde, 0xde, 0xdf, 0xdf, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xe9, 0xdf, 0xcb, 0xb8, 0xa3, 0x97, 0x8a, 0x82,
-    0x7a, 0x71, 0x69, 0x5b, 0x57, 0x52, 0x46, 0x3e, 0x31, 0x2a, 0x25, 0x1b,
-    0x0d, 0x0c, 0x07, 0x05, 0x05, 0x01, 0x01, 0x01, 0x02, 0x01, 0x05, 0x0a,
-    0x19, 0x2d, 0x5b, 0x8a, 0xac, 0xbf, 0xcb, 0xbf, 0xbf, 0xb8, 0xb8, 0xb3,
-    0xa9, 0xa9, 0xa3, 0xa3, 0x99, 0x9d, 0x9d, 0x9d, 0x97, 0x97, 0x97, 0x97,
-    0x90, 0x90, 0x90, 0x90, 0x91, 0x88, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x84, 0x88, 0x88, 0x88, 0x84, 0x88, 0x88, 0x88, 0x88, 0x81, 0x88,
-    0x81, 0x81, 0x88, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x84,
-    0xcc, 0xcc, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8,
-    0xd8, 0xd8, 0xcc, 0xcb, 0xc1, 0xc1, 0xbf, 0xc1, 0xb8, 0xb8, 0xa9, 0x99,
-    0x8a, 0x7a, 0x66, 0x59, 0x43, 0x34, 0x26, 0x1e, 0x0e, 0x0a, 0x03, 0x03,
-    0x05, 0x0a, 0x0a, 0x0e, 0x16, 0x19, 0x1e, 0x1e, 0x1f, 0x26, 0x26, 0x26,
-    0x26, 0x29, 0x29, 0x28, 0x29, 0x29, 0x29, 0x30, 0x31, 0x31, 0x34, 0x37,
-    0x3e, 0x3f, 0x3e, 0x46, 0x46, 0x49, 0x49, 0x4a, 0x4a, 0x53, 0x53, 0x55,
-    0x56, 0x5b, 0x57, 0x57, 0x60, 0x5e, 0x5e, 0x5f, 0x5e, 0x5e, 0x63, 0x66,
-    0x66, 0x68, 0x63, 0x6a, 0x66, 0x6a, 0x66, 0x6c, 0x66, 0x71, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6e, 0x75, 0x74, 0x74, 0x71, 0x7a, 0x76, 0x76, 0x76, 0x76,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x76, 0x7a, 0x76, 0x74,
-    0x6c, 0x66, 0x66, 0x5b, 0x57, 0x4a, 0x46, 0x3e, 0x3e, 0x37, 0x2c, 0x1f,
-    0x16, 0x0a, 0x05, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x01, 0x02, 0x05, 0x05, 0x0a, 0x0e, 0x16, 0x16, 0x1e, 0x1e, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x26, 0x25, 0x26, 0x25, 0x29, 0x29, 0x2d, 0x2d, 0x2d,
-    0x2d, 0x37, 0x37, 0x3d, 0x47, 0x55, 0x66, 0x71, 0x82, 0x8a, 0x97, 0x99,
-    0xa9, 0xb1, 0xb4, 0xbf, 0xc1, 0xcb, 0xcb, 0xd3, 0xd3, 0xd3, 0xd3, 0xde,
-    0xde, 0xdf, 0xdf, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe9,
-    0xe9, 0xd3, 0xbf, 0xa9, 0x90, 0x82, 0x71, 0x6f, 0x66, 0x5b, 0x57, 0x4e,
-    0x46, 0x46, 0x3e, 0x31, 0x2a, 0x25, 0x1b, 0x0c, 0x0c, 0x07, 0x05, 0x05,
-    0x02, 0x01, 0x01, 0x02, 0x02, 0x05, 0x05, 0x0e, 0x28, 0x4e, 0x82, 0xac,
-    0xbf, 0xcc, 0xcb, 0xbf, 0xb4, 0xb4, 0xb3, 0xa9, 0xa9, 0xa3, 0x99, 0x99,
-    0x99, 0x97, 0x97, 0x97, 0x97, 0x90, 0x91, 0x91, 0x90, 0x90, 0x90, 0x90,
-    0x88, 0x88, 0x8a, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x84, 0x84, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x81, 0x84, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xdf, 0xdf, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xd8, 0xd8,
-    0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xcc, 0xcc, 0xcc, 0xb2, 0xb4, 0xac, 0xa1,
-    0xa1, 0x7a, 0x66, 0x4f, 0x34, 0x28, 0x19, 0x0e, 0x0a, 0x05, 0x0a, 0x0a,
-    0x0a, 0x0e, 0x16, 0x19, 0x1a, 0x1e, 0x1f, 0x26, 0x26, 0x25, 0x25, 0x29,
-    0x29, 0x28, 0x29, 0x2c, 0x2d, 0x30, 0x2d, 0x34, 0x37, 0x37, 0x3e, 0x3e,
-    0x3e, 0x41, 0x41, 0x49, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x56, 0x56,
-    0x56, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x68, 0x5e, 0x68, 0x63, 0x6a,
-    0x66, 0x68, 0x68, 0x6a, 0x6c, 0x6f, 0x6e, 0x71, 0x6f, 0x71, 0x75, 0x75,
-    0x76, 0x76, 0x7a, 0x7d, 0x7d, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x88,
-    0x88, 0x8a, 0x89, 0x89, 0x82, 0x82, 0x7a, 0x71, 0x71, 0x66, 0x5b, 0x57,
-    0x46, 0x3f, 0x3f, 0x36, 0x31, 0x2a, 0x25, 0x1b, 0x0e, 0x05, 0x05, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x01, 0x05, 0x08, 0x0a, 0x0e, 0x16, 0x19, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x26, 0x25, 0x29, 0x29, 0x29, 0x2a, 0x2d, 0x30, 0x37, 0x3e,
-    0x44, 0x4a, 0x5e, 0x68, 0x74, 0x81, 0x88, 0x90, 0x9d, 0xa7, 0xa9, 0xb1,
-    0xb4, 0xbf, 0xc1, 0xcb, 0xcb, 0xd3, 0xd3, 0xd3, 0xde, 0xde, 0xdf, 0xdf,
-    0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe9, 0xe9, 0xde, 0xcb, 0xb4, 0x97,
-    0x78, 0x6a, 0x5f, 0x57, 0x52, 0x4e, 0x46, 0x46, 0x3e, 0x37, 0x30, 0x2c,
-    0x25, 0x1b, 0x0c, 0x0c, 0x05, 0x03, 0x05, 0x02, 0x00, 0x00, 0x00, 0x02,
-    0x01, 0x05, 0x0a, 0x1e, 0x3c, 0x71, 0xa1, 0xb8, 0xcb, 0xbf, 0xbf, 0xb4,
-    0xb4, 0xaa, 0xa9, 0xa9, 0xa3, 0x9d, 0x99, 0x97, 0x97, 0x97, 0x97, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x8a, 0x88, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x81, 0x88, 0x88, 0x88, 0x88, 0x81, 0x81, 0x88, 0x84, 0x81,
-    0x81, 0x84, 0x84, 0x81, 0x81, 0x81, 0x81, 0x81, 0x84, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8,
-    0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xcc, 0xcc, 0xcc, 0xbf, 0xb8, 0xac, 0xa1,
-    0x85, 0x66, 0x43, 0x2f, 0x1e, 0x16, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0e,
-    0x16, 0x19, 0x1e, 0x1e, 0x1f, 0x26, 0x26, 0x25, 0x28, 0x29, 0x29, 0x29,
-    0x29, 0x29, 0x2d, 0x2d, 0x30, 0x37, 0x37, 0x3e, 0x3e, 0x3e, 0x46, 0x44,
-    0x49, 0x52, 0x4a, 0x52, 0x53, 0x4e, 0x52, 0x56, 0x56, 0x56, 0x5b, 0x5f,
-    0x5f, 0x5f, 0x5e, 0x66, 0x68, 0x66, 0x68, 0x68, 0x66, 0x68, 0x68, 0x6c,
-    0x71, 0x71, 0x6c, 0x74, 0x7a, 0x7a, 0x76, 0x76, 0x7d, 0x81, 0x81, 0x82,
-    0x88, 0x88, 0x8a, 0x91, 0x90, 0x94, 0x94, 0x94, 0x97, 0x94, 0x97, 0x94,
-    0x94, 0x8a, 0x82, 0x7a, 0x71, 0x66, 0x57, 0x52, 0x3e, 0x37, 0x31, 0x2a,
-    0x20, 0x25, 0x1b, 0x19, 0x07, 0x03, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0x05,
-    0x0a, 0x0e, 0x0e, 0x16, 0x1a, 0x1a, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x26,
-    0x26, 0x25, 0x28, 0x29, 0x29, 0x29, 0x2d, 0x37, 0x3e, 0x46, 0x4e, 0x56,
-    0x63, 0x6a, 0x75, 0x7d, 0x8a, 0x90, 0x97, 0xa7, 0xa7, 0xb4, 0xb1, 0xbf,
-    0xbf, 0xbf, 0xcb, 0xcb, 0xcb, 0xd3, 0xd3, 0xd3, 0xde, 0xdf, 0xdf, 0xdf,
-    0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xe9, 0xde, 0xd3, 0xb8, 0x99, 0x82, 0x63, 0x57, 0x52, 0x46,
-    0x46, 0x44, 0x3e, 0x3e, 0x34, 0x31, 0x25, 0x1f, 0x1b, 0x0c, 0x07, 0x05,
-    0x03, 0x01, 0x01, 0x02, 0x00, 0x00, 0x01, 0x00, 0x03, 0x0a, 0x16, 0x2d,
-    0x5b, 0x8a, 0xb8, 0xbf, 0xbf, 0xbf, 0xb8, 0xb4, 0xaa, 0xa7, 0xa3, 0xa3,
-    0x99, 0x9d, 0x97, 0x97, 0x97, 0x90, 0x97, 0x90, 0x90, 0x90, 0x94, 0x8a,
-    0x91, 0x91, 0x91, 0x8a, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x84, 0x88, 0x88,
-    0x88, 0x88, 0x81, 0x81, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x84, 0x81, 0x81, 0x81, 0x81,
-    0x84, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0xcb, 0xbf, 0xbf, 0xcc, 0xcc, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xc1, 0xc1, 0xc1, 0xcc, 0xcc, 0xc1, 0xcc, 0xcc, 0xcc, 0xcc, 0xd8, 0xd8,
-    0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xcc, 0xcc, 0xb8, 0xac, 0x90, 0x7a,
-    0x59, 0x3c, 0x26, 0x16, 0x0a, 0x08, 0x0a, 0x0a, 0x0e, 0x0e, 0x16, 0x16,
-    0x19, 0x1e, 0x1f, 0x26, 0x25, 0x25, 0x29, 0x28, 0x29, 0x29, 0x29, 0x2c,
-    0x30, 0x30, 0x31, 0x37, 0x37, 0x3e, 0x3e, 0x46, 0x46, 0x49, 0x4a, 0x4a,
-    0x4e, 0x4e, 0x52, 0x57, 0x57, 0x57, 0x5b, 0x56, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5e, 0x68, 0x68, 0x6a, 0x6c, 0x6c, 0x71, 0x6c, 0x74, 0x71, 0x76, 0x76,
-    0x89, 0x81, 0x81, 0x88, 0x88, 0x89, 0x89, 0x94, 0x97, 0x97, 0x9d, 0x9d,
-    0x9d, 0xa7, 0xa7, 0xa7, 0xa7, 0xac, 0xa9, 0x99, 0x97, 0x90, 0x82, 0x7a,
-    0x71, 0x60, 0x52, 0x46, 0x37, 0x2a, 0x20, 0x20, 0x20, 0x10, 0x17, 0x0c,
-    0x08, 0x05, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x0a, 0x0a, 0x0e,
-    0x16, 0x19, 0x19, 0x1a, 0x1f, 0x1e, 0x1f, 0x1f, 0x26, 0x26, 0x25, 0x26,
-    0x25, 0x25, 0x29, 0x2d, 0x2d, 0x37, 0x3d, 0x46, 0x4a, 0x56, 0x5b, 0x68,
-    0x6c, 0x71, 0x7d, 0x8a, 0x94, 0x97, 0x99, 0xa7, 0xa7, 0xa9, 0xb3, 0xb3,
-    0xb1, 0xbf, 0xbf, 0xcb, 0xcb, 0xcb, 0xd3, 0xd3, 0xd3, 0xd3, 0xdf, 0xde,
-    0xde, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xd3, 0xcb,
-    0xb8, 0xa3, 0x82, 0x69, 0x4e, 0x46, 0x3c, 0x3c, 0x3c, 0x34, 0x34, 0x30,
-    0x29, 0x25, 0x1f, 0x1b, 0x0c, 0x07, 0x05, 0x05, 0x01, 0x02, 0x01, 0x00,
-    0x00, 0x01, 0x00, 0x03, 0x05, 0x0e, 0x26, 0x43, 0x7a, 0xac, 0xb8, 0xbf,
-    0xbf, 0xb4, 0xb3, 0xac, 0xa9, 0xa7, 0x99, 0x99, 0x97, 0x97, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x88, 0x8a, 0x8a, 0x88,
-    0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0x84, 0x81, 0x81, 0x84, 0x84,
-    0x81, 0x88, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x84, 0x84, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x84, 0xb8, 0xb4, 0xb4, 0xb8,
-    0xb8, 0xb4, 0xb8, 0xb8, 0xb8, 0xb4, 0xb8, 0xb4, 0xb4, 0xb8, 0xb8, 0xb8,
-    0xb8, 0xc1, 0xc1, 0xc1, 0xbf, 0xc1, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xd8,
-    0xd8, 0xd8, 0xd8, 0xd8, 0xcc, 0xcc, 0xc1, 0xb8, 0xa1, 0x82, 0x62, 0x3c,
-    0x28, 0x16, 0x0e, 0x0a, 0x0a, 0x0a, 0x0a, 0x0e, 0x0e, 0x19, 0x1a, 0x1f,
-    0x26, 0x26, 0x26, 0x28, 0x29, 0x29, 0x29, 0x29, 0x2c, 0x2c, 0x30, 0x30,
-    0x37, 0x37, 0x3e, 0x3e, 0x3e, 0x46, 0x49, 0x49, 0x4a, 0x4e, 0x53, 0x53,
-    0x56, 0x56, 0x5b, 0x55, 0x5f, 0x5f, 0x63, 0x63, 0x63, 0x68, 0x68, 0x6e,
-    0x6e, 0x74, 0x74, 0x76, 0x76, 0x7d, 0x81, 0x82, 0x8a, 0x90, 0x90, 0x97,
-    0x99, 0x99, 0x9d, 0xa7, 0xa7, 0xb1, 0xb1, 0xb4, 0xbf, 0xbf, 0xb4, 0xb8,
-    0xb8, 0xb8, 0xac, 0xa9, 0x99, 0x90, 0x82, 0x71, 0x66, 0x57, 0x46, 0x3f,
-    0x31, 0x20, 0x20, 0x20, 0x10, 0x10, 0x0c, 0x07, 0x05, 0x03, 0x02, 0x01,
-    0x01, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x01, 0x05, 0x05, 0x0a, 0x0e, 0x16, 0x1a, 0x19,
-    0x1a, 0x1a, 0x1e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x26, 0x25, 0x25,
-    0x29, 0x2d, 0x2d, 0x37, 0x3f, 0x46, 0x46, 0x4d, 0x55, 0x5e, 0x68, 0x68,
-    0x6c, 0x76, 0x7d, 0x81, 0x88, 0x90, 0x91, 0x99, 0xa3, 0xa7, 0xa7, 0xb1,
-    0xb4, 0xb4, 0xc1, 0xbf, 0xbf, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb,
-    0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xbf, 0xc1, 0xa9, 0x97, 0x7a, 0x66, 0x46,
-    0x3c, 0x3c, 0x34, 0x34, 0x34, 0x2d, 0x30, 0x29, 0x26, 0x1f, 0x19, 0x0c,
-    0x07, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05,
-    0x0a, 0x1e, 0x34, 0x69, 0x97, 0xb8, 0xbf, 0xc1, 0xb4, 0xb4, 0xa9, 0xa9,
-    0xa3, 0x99, 0x99, 0x97, 0x97, 0x90, 0x90, 0x90, 0x91, 0x91, 0x90, 0x90,
-    0x88, 0x88, 0x88, 0x8a, 0x88, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x84, 0x84, 0x81, 0x81, 0x84, 0x81, 0x84, 0x84, 0x84, 0x84,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x84, 0x81, 0x81, 0x81,
-    0x84, 0x81, 0x81, 0x81, 0xac, 0xaa, 0xac, 0xac, 0xac, 0xa9, 0xac, 0xac,
-    0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xb3, 0xb8, 0xb8, 0xb8, 0xb8,
-    0xb8, 0xb8, 0xb8, 0xb8, 0xbf, 0xbf, 0xbf, 0xcc, 0xcc, 0xcc, 0xcc, 0xd8,
-    0xd8, 0xd8, 0xd8, 0xcc, 0xcc, 0xb8, 0xa1, 0x82, 0x5b, 0x3c, 0x1e, 0x16,
-    0x0a, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x16, 0x16, 0x1a, 0x1f, 0x26, 0x26,
-    0x25, 0x25, 0x29, 0x29, 0x28, 0x29, 0x2c, 0x2d, 0x2d, 0x30, 0x37, 0x37,
-    0x3e, 0x3e, 0x46, 0x41, 0x46, 0x4e, 0x4a, 0x52, 0x56, 0x57, 0x55, 0x5b,
-    0x5e, 0x63, 0x68, 0x68, 0x6a, 0x6e, 0x6c, 0x74, 0x76, 0x7d, 0x81, 0x81,
-    0x88, 0x8a, 0x90, 0x97, 0x9d, 0xa7, 0xa7, 0xa7, 0xb1, 0xb4, 0xb4, 0xbf,
-    0xcb, 0xcb, 0xd3, 0xd8, 0xd8, 0xd8, 0xd3, 0xcb, 0xbf, 0xb8, 0xb8, 0xac,
-    0x99, 0x90, 0x83, 0x71, 0x66, 0x52, 0x46, 0x31, 0x2a, 0x20, 0x10, 0x10,
-    0x10, 0x0d, 0x0c, 0x07, 0x05, 0x05, 0x01, 0x02, 0x00, 0x02, 0x02, 0x01,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x01, 0x01, 0x05, 0x05, 0x0a, 0x0e, 0x16, 0x19, 0x19, 0x1a, 0x1e, 0x1a,
-    0x1a, 0x1e, 0x1a, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x26, 0x26, 0x29, 0x29,
-    0x2d, 0x31, 0x3e, 0x3e, 0x46, 0x44, 0x44, 0x4e, 0x4e, 0x53, 0x55, 0x5e,
-    0x68, 0x6c, 0x76, 0x81, 0x88, 0x91, 0x91, 0x99, 0x9d, 0xa3, 0xa9, 0xa9,
-    0xb3, 0xb1, 0xb1, 0xb1, 0xb3, 0xb3, 0xb3, 0xb1, 0xb3, 0xb3, 0xb3, 0xb1,
-    0xb3, 0xa9, 0x97, 0x8a, 0x71, 0x5b, 0x43, 0x3c, 0x34, 0x30, 0x2f, 0x2f,
-    0x28, 0x28, 0x26, 0x1f, 0x1a, 0x19, 0x07, 0x0a, 0x05, 0x01, 0x02, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0e, 0x28, 0x52, 0x82,
-    0xac, 0xb8, 0xc1, 0xb8, 0xb8, 0xaa, 0xa9, 0xa3, 0x99, 0x99, 0x9d, 0x97,
-    0x90, 0x90, 0x90, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x88,
-    0x88, 0x8a, 0x8a, 0x84, 0x88, 0x84, 0x88, 0x88, 0x81, 0x81, 0x84, 0x84,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x84, 0x84, 0x81, 0x81, 0x81, 0x84, 0x84,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa3, 0xa1, 0xa3, 0xa3, 0xa3, 0xa1,
-    0xa1, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xac, 0xac, 0xac, 0xac, 0xac, 0xb8,
-    0xb4, 0xb8, 0xb8, 0xb8, 0xc1, 0xc1, 0xbf, 0xcc, 0xcc, 0xcc, 0xd8, 0xd8,
-    0xd8, 0xcc, 0xcc, 0xb8, 0xa1, 0x7a, 0x4f, 0x2f, 0x1a, 0x0a, 0x03, 0x05,
-    0x05, 0x0a, 0x0a, 0x0e, 0x16, 0x1a, 0x1f, 0x1f, 0x26, 0x26, 0x25, 0x26,
-    0x25, 0x29, 0x29, 0x29, 0x2c, 0x2d, 0x2d, 0x37, 0x37, 0x3e, 0x3e, 0x3e,
-    0x46, 0x46, 0x46, 0x52, 0x4a, 0x53, 0x57, 0x5b, 0x5f, 0x66, 0x66, 0x6c,
-    0x6e, 0x76, 0x76, 0x81, 0x88, 0x89, 0x94, 0x97, 0x9d, 0xa7, 0xa7, 0xb1,
-    0xb4, 0xbf, 0xcb, 0xcb, 0xcb, 0xd8, 0xd3, 0xdf, 0xdf, 0xdf, 0xe9, 0xe9,
-    0xe9, 0xdf, 0xdf, 0xd3, 0xcb, 0xb8, 0xb4, 0xaa, 0xa1, 0x8a, 0x7c, 0x66,
-    0x60, 0x43, 0x3e, 0x31, 0x20, 0x20, 0x10, 0x10, 0x17, 0x0c, 0x07, 0x03,
-    0x05, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03,
-    0x05, 0x0a, 0x0a, 0x0e, 0x16, 0x16, 0x19, 0x19, 0x19, 0x19, 0x1a, 0x1e,
-    0x1e, 0x1a, 0x1a, 0x1e, 0x1e, 0x1f, 0x1e, 0x26, 0x26, 0x29, 0x29, 0x2d,
-    0x2d, 0x31, 0x34, 0x34, 0x34, 0x37, 0x3d, 0x3f, 0x41, 0x4a, 0x56, 0x63,
-    0x6e, 0x74, 0x76, 0x81, 0x88, 0x88, 0x90, 0x90, 0x97, 0x99, 0x99, 0x99,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x99, 0x99, 0x97, 0x8a, 0x84, 0x71, 0x66,
-    0x52, 0x3c, 0x34, 0x30, 0x2f, 0x28, 0x28, 0x28, 0x26, 0x1e, 0x1a, 0x16,
-    0x0e, 0x0a, 0x05, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x03, 0x05, 0x0a, 0x1e, 0x34, 0x66, 0xa1, 0xb8, 0xb8, 0xb8, 0xb8,
-    0xa9, 0xa7, 0xa3, 0x99, 0x99, 0x97, 0x97, 0x90, 0x90, 0x90, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x88, 0x8a, 0x88, 0x8a, 0x88, 0x84, 0x84,
-    0x84, 0x84, 0x88, 0x88, 0x81, 0x84, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x84, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x84, 0x81, 0x81, 0x81,
-    0x81, 0x84, 0x84, 0x81, 0x84, 0x84, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x84, 0x78, 0x81, 0x81, 0x81, 0x81, 0x81, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xa1,
-    0x99, 0xa3, 0xa1, 0xa3, 0xa1, 0xac, 0xac, 0xac, 0xac, 0xac, 0xa9, 0xac,
-    0xb8, 0xb8, 0xb8, 0xb8, 0xc1, 0xc1, 0xc1, 0xcc, 0xcc, 0xd8, 0xcc, 0xcc,
-    0xb2, 0xac, 0x8a, 0x66, 0x3c, 0x1e, 0x0e, 0x05, 0x05, 0x03, 0x03, 0x0a,
-    0x0a, 0x0e, 0x1a, 0x1a, 0x1e, 0x1f, 0x26, 0x26, 0x25, 0x28, 0x28, 0x29,
-    0x29, 0x29, 0x2d, 0x2d, 0x30, 0x37, 0x37, 0x3e, 0x3d, 0x3e, 0x3e, 0x46,
-    0x41, 0x49, 0x52, 0x52, 0x56, 0x63, 0x6a, 0x74, 0x76, 0x81, 0x8a, 0x90,
-    0x99, 0xa7, 0xa7, 0xb4, 0xb4, 0xbf, 0xcb, 0xcb, 0xd3, 0xd3, 0xdf, 0xdf,
-    0xdf, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xf1, 0xf1, 0xe9, 0xe9, 0xdf, 0xd8,
-    0xc1, 0xb4, 0xaa, 0xa1, 0x85, 0x7a, 0x71, 0x60, 0x52, 0x3e, 0x31, 0x2a,
-    0x20, 0x10, 0x10, 0x10, 0x0d, 0x0c, 0x07, 0x03, 0x05, 0x01, 0x02, 0x00,
-    0x00, 0x05, 0x05, 0x01, 0x01, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x03, 0x05, 0x0a,
-    0x0a, 0x0e, 0x16, 0x19, 0x19, 0x1a, 0x19, 0x19, 0x19, 0x19, 0x1a, 0x1a,
-    0x1a, 0x1a, 0x1e, 0x1e, 0x1f, 0x1f, 0x1e, 0x26, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x29, 0x2d, 0x37, 0x37, 0x3f, 0x46, 0x52, 0x5b, 0x5e, 0x63,
-    0x6a, 0x6c, 0x76, 0x76, 0x7d, 0x81, 0x81, 0x8a, 0x88, 0x88, 0x81, 0x81,
-    0x7a, 0x76, 0x74, 0x71, 0x66, 0x57, 0x52, 0x3e, 0x34, 0x2f, 0x28, 0x28,
-    0x28, 0x26, 0x26, 0x1e, 0x1a, 0x16, 0x0e, 0x0a, 0x0a, 0x05, 0x04, 0x01,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0a, 0x16,
-    0x28, 0x52, 0x82, 0xac, 0xb8, 0xb8, 0xac, 0xac, 0xa9, 0x9d, 0x99, 0x97,
-    0x97, 0x90, 0x90, 0x90, 0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x8a, 0x8a, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x82, 0x82, 0x81,
-    0x84, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x84, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x84, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x7d, 0x81,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99,
-    0x99, 0xa1, 0x99, 0xa3, 0xa3, 0xa3, 0xa3, 0xac, 0xac, 0xac, 0xac, 0xb8,
-    0xb8, 0xb8, 0xb8, 0xb2, 0xbf, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xb8, 0xa1,
-    0x7a, 0x4f, 0x28, 0x16, 0x03, 0x05, 0x05, 0x05, 0x05, 0x0a, 0x0e, 0x16,
-    0x16, 0x1a, 0x1f, 0x26, 0x26, 0x26, 0x26, 0x28, 0x29, 0x28, 0x29, 0x29,
-    0x2d, 0x2d, 0x30, 0x34, 0x37, 0x37, 0x3e, 0x3d, 0x3d, 0x3f, 0x41, 0x49,
-    0x53, 0x5f, 0x6c, 0x7a, 0x8a, 0x94, 0x9d, 0xa7, 0xb1, 0xb4, 0xbf, 0xcb,
-    0xcb, 0xd3, 0xd3, 0xde, 0xdf, 0xe9, 0xe9, 0xe9, 0xe9, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe9, 0xdf, 0xcc, 0xb8, 0xa1, 0xa1, 0x82,
-    0x7a, 0x71, 0x66, 0x52, 0x43, 0x37, 0x2a, 0x25, 0x20, 0x10, 0x10, 0x0d,
-    0x0c, 0x07, 0x05, 0x05, 0x02, 0x02, 0x00, 0x05, 0x05, 0x05, 0x05, 0x03,
-    0x03, 0x05, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x05, 0x05, 0x0a, 0x07, 0x0e,
-    0x0e, 0x16, 0x16, 0x19, 0x19, 0x19, 0x19, 0x1a, 0x19, 0x19, 0x19, 0x1a,
-    0x19, 0x19, 0x1e, 0x1a, 0x1a, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f,
-    0x26, 0x29, 0x2d, 0x37, 0x37, 0x37, 0x3d, 0x3d, 0x46, 0x4e, 0x4e, 0x5b,
-    0x5b, 0x5b, 0x68, 0x66, 0x66, 0x69, 0x60, 0x57, 0x52, 0x4e, 0x44, 0x43,
-    0x3c, 0x34, 0x2f, 0x2f, 0x28, 0x28, 0x26, 0x26, 0x1e, 0x1e, 0x1d, 0x16,
-    0x0e, 0x07, 0x08, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x0a, 0x1e, 0x34, 0x66, 0x90, 0xac,
-    0xb8, 0xb8, 0xac, 0xa3, 0x99, 0x97, 0x97, 0x94, 0x94, 0x90, 0x89, 0x8a,
-    0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x82, 0x81,
-    0x82, 0x81, 0x88, 0x81, 0x81, 0x84, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x84, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x78, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x7d, 0x84, 0x78, 0x78, 0x7d, 0x7d, 0x78, 0x78, 0x78,
-    0x90, 0x97, 0x97, 0x97, 0x97, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x97, 0x97, 0x97, 0x97, 0x99,
-    0x99, 0xa1, 0x99, 0xa3, 0xa3, 0x9f, 0xa9, 0xac, 0xa9, 0xa9, 0xac, 0xb8,
-    0xb8, 0xbf, 0xc1, 0xcb, 0xcb, 0xcc, 0xcc, 0xc1, 0xac, 0x8a, 0x57, 0x2f,
-    0x19, 0x0a, 0x05, 0x05, 0x05, 0x03, 0x0a, 0x0a, 0x0e, 0x16, 0x19, 0x1f,
-    0x1f, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x29, 0x29, 0x2c, 0x30, 0x2d,
-    0x31, 0x34, 0x37, 0x37, 0x37, 0x3f, 0x3e, 0x46, 0x4a, 0x5f, 0x75, 0x81,
-    0x90, 0x9d, 0xa7, 0xb4, 0xbf, 0xbf, 0xcb, 0xd3, 0xd3, 0xde, 0xdf, 0xdf,
-    0xe9, 0xe9, 0xe9, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xe9, 0xe9, 0xd8, 0xc1, 0xa1, 0x8a, 0x7a, 0x71, 0x69, 0x5b, 0x5b, 0x46,
-    0x3e, 0x31, 0x20, 0x20, 0x10, 0x10, 0x0d, 0x0c, 0x07, 0x03, 0x01, 0x01,
-    0x01, 0x01, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x01,
-    0x02, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x05, 0x03, 0x05, 0x0a, 0x0a, 0x07, 0x0a, 0x0e, 0x0e,
-    0x0e, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x19, 0x19, 0x1e, 0x1f, 0x1f, 0x26,
-    0x26, 0x26, 0x26, 0x29, 0x29, 0x2d, 0x2d, 0x34, 0x3c, 0x3d, 0x3d, 0x3d,
-    0x3e, 0x3e, 0x37, 0x34, 0x34, 0x2d, 0x2f, 0x28, 0x26, 0x26, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1d, 0x16, 0x16, 0x0e, 0x0a, 0x0a, 0x05, 0x03, 0x01,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x05, 0x0a, 0x0e, 0x26, 0x4e, 0x7a, 0xa1, 0xac, 0xb8, 0xaa, 0xa3, 0x99,
-    0x9d, 0x97, 0x90, 0x94, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x82, 0x81,
-    0x88, 0x88, 0x81, 0x81, 0x81, 0x88, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x84, 0x81, 0x81, 0x81, 0x81, 0x78, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x84, 0x78, 0x81, 0x81, 0x7d, 0x78, 0x81, 0x7d, 0x81, 0x81,
-    0x7d, 0x81, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x90, 0x90, 0x90, 0x93, 0x90, 0x90, 0x97, 0x97, 0x97, 0x97, 0x97, 0x99,
-    0x99, 0x99, 0x99, 0xa3, 0xa1, 0xa9, 0xac, 0xac, 0xac, 0xb8, 0xb8, 0xbf,
-    0xbf, 0xcb, 0xcc, 0xcc, 0xc1, 0xb8, 0x90, 0x69, 0x34, 0x1a, 0x07, 0x03,
-    0x05, 0x05, 0x05, 0x05, 0x0a, 0x07, 0x0e, 0x19, 0x1e, 0x1f, 0x26, 0x26,
-    0x26, 0x25, 0x26, 0x26, 0x26, 0x29, 0x2c, 0x2c, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x31, 0x34, 0x37, 0x3e, 0x4a, 0x5f, 0x75, 0x84, 0x90, 0x9d, 0xa7, 0xb4,
-    0xbf, 0xcb, 0xcb, 0xd3, 0xd8, 0xde, 0xdf, 0xdf, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xf1, 0xf1, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xdf, 0xcb, 0xb8,
-    0x90, 0x71, 0x66, 0x62, 0x57, 0x52, 0x43, 0x3e, 0x31, 0x2a, 0x25, 0x10,
-    0x10, 0x0d, 0x0c, 0x0c, 0x07, 0x05, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05,
-    0x05, 0x0a, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x01, 0x01,
-    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x02,
-    0x02, 0x01, 0x05, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e,
-    0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
-    0x0e, 0x0e, 0x16, 0x16, 0x16, 0x16, 0x19, 0x16, 0x16, 0x16, 0x16, 0x19,
-    0x19, 0x1e, 0x1e, 0x1e, 0x26, 0x26, 0x28, 0x28, 0x28, 0x26, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1d, 0x1d, 0x16, 0x19, 0x16, 0x1a, 0x16, 0x16, 0x16, 0x11,
-    0x11, 0x0a, 0x0a, 0x05, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0a, 0x16, 0x2d,
-    0x5b, 0x8a, 0xa9, 0xaa, 0xaa, 0xa7, 0x99, 0x97, 0x94, 0x90, 0x8a, 0x8a,
-    0x88, 0x88, 0x88, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x84, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x78,
-    0x7d, 0x7d, 0x7d, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x8a, 0x8a, 0x90, 0x90, 0x90, 0x90, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x90, 0x90, 0x90, 0x90, 0x90, 0x97, 0x97, 0x97, 0x97, 0x9c, 0x99,
-    0x99, 0x99, 0x99, 0xa1, 0xa9, 0xa9, 0xb8, 0xb8, 0xb8, 0xc1, 0xbf, 0xcb,
-    0xcb, 0xc1, 0xb8, 0x90, 0x66, 0x34, 0x1a, 0x0a, 0x05, 0x05, 0x05, 0x01,
-    0x05, 0x05, 0x0a, 0x0e, 0x16, 0x1a, 0x1f, 0x1f, 0x26, 0x26, 0x1f, 0x1f,
-    0x26, 0x25, 0x29, 0x29, 0x29, 0x29, 0x2d, 0x2d, 0x2d, 0x2d, 0x37, 0x3e,
-    0x41, 0x56, 0x6e, 0x81, 0x91, 0x99, 0xa7, 0xb1, 0xb8, 0xbf, 0xcb, 0xcb,
-    0xd3, 0xd3, 0xd3, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe9, 0xe9, 0xe9,
-    0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xcb, 0xb8, 0x97, 0x7a, 0x5b, 0x5b, 0x4f,
-    0x43, 0x43, 0x3c, 0x2d, 0x2a, 0x25, 0x10, 0x10, 0x0d, 0x0c, 0x0c, 0x07,
-    0x05, 0x01, 0x02, 0x01, 0x05, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x02, 0x02, 0x02, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x0e, 0x0a, 0x08, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x08, 0x08, 0x0a, 0x0a, 0x08, 0x11, 0x11,
-    0x11, 0x11, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x11, 0x11, 0x11,
-    0x39, 0x5a, 0x7e, 0x7e, 0x35, 0x12, 0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x02,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x05, 0x07, 0x1e, 0x3c, 0x71, 0x97, 0xa9, 0xa9,
-    0xa3, 0x9d, 0x97, 0x90, 0x94, 0x8a, 0x88, 0x88, 0x88, 0x82, 0x81, 0x81,
-    0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x78, 0x81,
-    0x81, 0x7d, 0x7d, 0x81, 0x81, 0x7d, 0x7d, 0x7d, 0x81, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x81, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x7d, 0x7d, 0x78, 0x78,
-    0x84, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x97, 0x97, 0x97, 0x99, 0x99, 0x99, 0x99,
-    0xa1, 0xa1, 0xa9, 0xac, 0xb8, 0xb8, 0xb4, 0xc1, 0xbf, 0xcb, 0xc1, 0xb8,
-    0x90, 0x66, 0x34, 0x19, 0x0a, 0x03, 0x03, 0x01, 0x05, 0x05, 0x05, 0x0a,
-    0x0a, 0x1a, 0x19, 0x1a, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x26, 0x26, 0x25,
-    0x29, 0x29, 0x29, 0x29, 0x2c, 0x2d, 0x31, 0x37, 0x46, 0x53, 0x6a, 0x7a,
-    0x81, 0x91, 0x9d, 0x9d, 0xa9, 0xb1, 0xb4, 0xb4, 0xbf, 0xbf, 0xcb, 0xcb,
-    0xcb, 0xd3, 0xd3, 0xd3, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd3, 0xd3,
-    0xcc, 0xb4, 0x99, 0x7a, 0x60, 0x52, 0x43, 0x43, 0x3c, 0x34, 0x2d, 0x2a,
-    0x25, 0x1b, 0x17, 0x0d, 0x0c, 0x0c, 0x07, 0x03, 0x01, 0x02, 0x02, 0x01,
-    0x05, 0x05, 0x05, 0x0a, 0x07, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x0a, 0x05,
-    0x05, 0x05, 0x05, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00,
-    0x00, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x05, 0x05, 0x05,
-    0x05, 0x03, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e,
-    0x0e, 0x0e, 0x0e, 0x0e, 0x08, 0x0a, 0x08, 0x0a, 0x0a, 0x08, 0x05, 0x05,
-    0x05, 0x05, 0x03, 0x03, 0x04, 0x04, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x0a, 0x08, 0x0a, 0x08, 0x0a, 0x0a, 0x35, 0xca, 0xee, 0xee, 0xee,
-    0xed, 0x7e, 0x0f, 0x05, 0x02, 0x0b, 0x1c, 0x1c, 0x00, 0x00, 0x02, 0x06,
-    0x4b, 0x8e, 0x32, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05,
-    0x0a, 0x0e, 0x28, 0x4f, 0x7a, 0x99, 0xa9, 0xa7, 0x99, 0x97, 0x90, 0x90,
-    0x89, 0x8a, 0x88, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x81, 0x7d, 0x7d, 0x7d, 0x7d, 0x81, 0x7d, 0x7d, 0x7d, 0x81,
-    0x81, 0x81, 0x81, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x7d, 0x76,
-    0x78, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x76, 0x76, 0x78, 0x76, 0x76, 0x84, 0x81, 0x88, 0x8a,
-    0x8a, 0x82, 0x88, 0x88, 0x88, 0x82, 0x84, 0x82, 0x82, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x97, 0x97, 0x97, 0x99, 0x99, 0xa3, 0xa9,
-    0xa9, 0xac, 0xb3, 0xb8, 0xb4, 0xc1, 0xc1, 0xc1, 0xac, 0x90, 0x60, 0x34,
-    0x19, 0x0a, 0x03, 0x05, 0x02, 0x02, 0x02, 0x05, 0x05, 0x0a, 0x0e, 0x1a,
-    0x1a, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x1f, 0x26, 0x25, 0x25, 0x29, 0x29,
-    0x2c, 0x29, 0x31, 0x37, 0x3e, 0x52, 0x55, 0x68, 0x6c, 0x76, 0x81, 0x88,
-    0x90, 0x97, 0x99, 0xa3, 0xa9, 0xa7, 0xb1, 0xb4, 0xb4, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xc1, 0xbf, 0xbf, 0xc1, 0xac, 0x97, 0x7a, 0x5b,
-    0x43, 0x3c, 0x3c, 0x34, 0x34, 0x2d, 0x2a, 0x1f, 0x1b, 0x0d, 0x0c, 0x0c,
-    0x0c, 0x07, 0x03, 0x01, 0x01, 0x01, 0x02, 0x05, 0x05, 0x05, 0x0a, 0x0a,
-    0x0e, 0x0e, 0x0e, 0x16, 0x0e, 0x0e, 0x0e, 0x0a, 0x0a, 0x05, 0x05, 0x05,
-    0x05, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x05, 0x03, 0x03,
-    0x03, 0x03, 0x03, 0x03, 0x08, 0x0a, 0x07, 0x0e, 0x0e, 0x0e, 0x16, 0x19,
-    0x19, 0x19, 0x1e, 0x1e, 0x1e, 0x1e, 0x1b, 0x1e, 0x1b, 0x1b, 0x1b, 0x19,
-    0x19, 0x19, 0x16, 0x0e, 0x0e, 0x0e, 0x07, 0x0a, 0x08, 0x03, 0x03, 0x05,
-    0x03, 0x04, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 0x05, 0x0a,
-    0x03, 0x04, 0x09, 0x7e, 0xee, 0xed, 0xed, 0xfc, 0xfd, 0xfe, 0x5a, 0x0f,
-    0x8d, 0xed, 0xfd, 0xca, 0x0f, 0x01, 0x15, 0xd4, 0xf7, 0xf6, 0xd9, 0x1c,
-    0x02, 0x00, 0x01, 0x02, 0x00, 0x01, 0x05, 0x05, 0x05, 0x16, 0x2f, 0x5b,
-    0x82, 0x99, 0xa9, 0x99, 0x94, 0x90, 0x8a, 0x8a, 0x82, 0x82, 0x81, 0x81,
-    0x81, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x7d, 0x7d, 0x76, 0x7d, 0x7d, 0x7d,
-    0x78, 0x7d, 0x7d, 0x7a, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x7d, 0x7d, 0x7d, 0x78, 0x7d, 0x7d,
-    0x78, 0x78, 0x7d, 0x7d, 0x78, 0x76, 0x7d, 0x76, 0x76, 0x76, 0x78, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x7d, 0x7d, 0x76, 0x76, 0x78,
-    0x76, 0x78, 0x78, 0x78, 0x84, 0x82, 0x82, 0x82, 0x82, 0x81, 0x84, 0x84,
-    0x82, 0x82, 0x84, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x90, 0x90,
-    0x94, 0x90, 0x90, 0x97, 0x97, 0x97, 0x99, 0xa3, 0xa3, 0xa9, 0xa9, 0xac,
-    0xac, 0xb8, 0xb4, 0xbf, 0xb8, 0xa9, 0x8a, 0x5b, 0x2d, 0x16, 0x05, 0x05,
-    0x02, 0x01, 0x00, 0x01, 0x05, 0x05, 0x0a, 0x07, 0x0e, 0x19, 0x19, 0x1e,
-    0x1e, 0x1e, 0x1f, 0x1e, 0x1f, 0x26, 0x26, 0x26, 0x29, 0x29, 0x29, 0x2d,
-    0x37, 0x3e, 0x46, 0x53, 0x56, 0x63, 0x68, 0x6c, 0x71, 0x76, 0x82, 0x8a,
-    0x90, 0x97, 0x9d, 0x9d, 0xa7, 0xa9, 0xa9, 0xb1, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb1, 0xb4, 0xa9, 0x99, 0x8a, 0x71, 0x59, 0x43, 0x34, 0x34, 0x30, 0x2f,
-    0x29, 0x25, 0x1f, 0x19, 0x0c, 0x0c, 0x0c, 0x07, 0x05, 0x03, 0x01, 0x02,
-    0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x0a, 0x0a, 0x0e, 0x16, 0x19, 0x1a,
-    0x19, 0x16, 0x0e, 0x0e, 0x07, 0x0a, 0x0a, 0x05, 0x05, 0x05, 0x03, 0x03,
-    0x03, 0x05, 0x05, 0x03, 0x0a, 0x07, 0x0e, 0x19, 0x19, 0x19, 0x1f, 0x26,
-    0x28, 0x29, 0x2d, 0x34, 0x34, 0x3d, 0x3c, 0x44, 0x44, 0x44, 0x4f, 0x4e,
-    0x4e, 0x4e, 0x4e, 0x4e, 0x44, 0x44, 0x44, 0x3d, 0x34, 0x2d, 0x2d, 0x28,
-    0x26, 0x26, 0x1f, 0x1e, 0x19, 0x19, 0x16, 0x0e, 0x08, 0x08, 0x0a, 0x09,
-    0x04, 0x04, 0x04, 0x04, 0x09, 0x24, 0x24, 0x04, 0x04, 0x04, 0x15, 0xca,
-    0xed, 0xf5, 0xf5, 0xf5, 0xf5, 0xfe, 0xdc, 0xd4, 0xf9, 0xf8, 0xf8, 0xd4,
-    0x24, 0x04, 0xae, 0xf7, 0xf8, 0xeb, 0xf6, 0x40, 0x4b, 0xae, 0xc7, 0x61,
-    0x0f, 0x00, 0x09, 0x35, 0x8d, 0x39, 0x3a, 0x66, 0x8a, 0x99, 0x99, 0x97,
-    0x94, 0x8a, 0x85, 0x85, 0x82, 0x81, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7d,
-    0x76, 0x7d, 0x76, 0x76, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7d, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x7d, 0x76, 0x76, 0x7d,
-    0x76, 0x7d, 0x7d, 0x76, 0x7d, 0x7d, 0x78, 0x7d, 0x78, 0x78, 0x7d, 0x76,
-    0x76, 0x76, 0x78, 0x76, 0x76, 0x76, 0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x78, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x76, 0x78, 0x76,
-    0x84, 0x81, 0x82, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x84,
-    0x82, 0x81, 0x8b, 0x82, 0x82, 0x81, 0x83, 0x82, 0x8a, 0x8a, 0x8a, 0x88,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8b, 0x8a, 0x8a, 0x91, 0x90, 0x90,
-    0x90, 0x97, 0x9d, 0x99, 0x99, 0xa3, 0xa3, 0xa9, 0xa9, 0xac, 0xaa, 0xb4,
-    0xbf, 0xb8, 0xac, 0x82, 0x4e, 0x26, 0x0e, 0x05, 0x01, 0x00, 0x01, 0x01,
-    0x00, 0x01, 0x05, 0x05, 0x0a, 0x0e, 0x16, 0x16, 0x1e, 0x1a, 0x1f, 0x1e,
-    0x1e, 0x1f, 0x1f, 0x1f, 0x26, 0x26, 0x25, 0x29, 0x31, 0x31, 0x3e, 0x3e,
-    0x46, 0x49, 0x47, 0x4e, 0x4e, 0x5b, 0x5b, 0x68, 0x74, 0x7d, 0x82, 0x88,
-    0x8a, 0x91, 0x97, 0x9d, 0x9d, 0x99, 0x99, 0x9d, 0x9d, 0x90, 0x8a, 0x7a,
-    0x63, 0x52, 0x3c, 0x34, 0x2f, 0x2f, 0x28, 0x26, 0x1f, 0x1f, 0x1b, 0x0c,
-    0x0c, 0x07, 0x07, 0x05, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x05,
-    0x05, 0x05, 0x0a, 0x0e, 0x19, 0x1a, 0x1a, 0x1a, 0x1a, 0x19, 0x19, 0x16,
-    0x0e, 0x0e, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x0e, 0x16, 0x19, 0x1e, 0x26,
-    0x2f, 0x2d, 0x3d, 0x44, 0x4e, 0x5b, 0x66, 0x71, 0x7a, 0x89, 0x89, 0x85,
-    0x90, 0x97, 0x9f, 0x9d, 0x9d, 0x9f, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9d, 0x94, 0x90, 0x8a, 0x82, 0x7a, 0x71, 0x66, 0x5b, 0x4e,
-    0x44, 0x37, 0x2d, 0x28, 0x26, 0x1e, 0x1e, 0x16, 0x11, 0x08, 0x08, 0x09,
-    0x35, 0xf2, 0xe7, 0x24, 0x06, 0x04, 0x7e, 0xee, 0xed, 0xf5, 0xf5, 0xf5,
-    0xf5, 0xf5, 0xfe, 0xfa, 0xfc, 0xf9, 0xf8, 0xfa, 0xeb, 0xae, 0xf8, 0xfa,
-    0xee, 0xee, 0xfc, 0xeb, 0xf8, 0xf7, 0xf7, 0xf6, 0xd4, 0x24, 0x8d, 0xf6,
-    0xf7, 0xf8, 0x9a, 0x7c, 0x90, 0x99, 0x94, 0x94, 0x9f, 0xbe, 0xdc, 0xdc,
-    0xa0, 0x7d, 0x76, 0x76, 0x7a, 0x76, 0x7a, 0x76, 0x76, 0x76, 0x76, 0x75,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x78, 0x76, 0x76, 0x76, 0x76, 0x76, 0x78,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x78, 0x78, 0x7d, 0x7d, 0x7d,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x78, 0x78,
-    0x78, 0x78, 0x76, 0x76, 0x78, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x78, 0x78, 0x76, 0x78, 0x76, 0x76, 0x76, 0x76, 0x78, 0x81, 0x78, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x84, 0x82, 0x81, 0x81, 0x81, 0x83, 0x82, 0x82,
-    0x81, 0x82, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x8b, 0x8a,
-    0x8a, 0x84, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x90, 0x90, 0x90, 0x97,
-    0x99, 0x99, 0x99, 0xa3, 0xa3, 0xa9, 0xa9, 0xaa, 0xb4, 0xbf, 0xb4, 0x99,
-    0x71, 0x3c, 0x1e, 0x0a, 0x05, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
-    0x05, 0x0a, 0x0a, 0x0e, 0x16, 0x19, 0x1a, 0x1a, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1f, 0x1f, 0x26, 0x26, 0x25, 0x29, 0x2d, 0x2d, 0x34, 0x37, 0x37, 0x37,
-    0x37, 0x3d, 0x44, 0x4e, 0x5b, 0x68, 0x6c, 0x6c, 0x75, 0x78, 0x81, 0x82,
-    0x81, 0x82, 0x82, 0x7a, 0x7a, 0x71, 0x5b, 0x4e, 0x3c, 0x34, 0x2f, 0x28,
-    0x28, 0x26, 0x26, 0x1f, 0x19, 0x1a, 0x0c, 0x07, 0x07, 0x03, 0x03, 0x01,
-    0x01, 0x01, 0x02, 0x00, 0x05, 0x01, 0x05, 0x05, 0x05, 0x0a, 0x0a, 0x0e,
-    0x19, 0x19, 0x1a, 0x1a, 0x1e, 0x19, 0x19, 0x1a, 0x19, 0x19, 0x19, 0x19,
-    0x1f, 0x26, 0x2d, 0x34, 0x44, 0x4e, 0x66, 0x71, 0x82, 0x96, 0x9f, 0xaa,
-    0xac, 0xb4, 0xb4, 0xbf, 0xcc, 0xcc, 0xcc, 0xcc, 0xcb, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xcc, 0xd3, 0xcc, 0xcb, 0xcc,
-    0xcb, 0xc1, 0xcc, 0xbf, 0xb4, 0xb4, 0xa7, 0xa7, 0x99, 0x90, 0x82, 0x71,
-    0x66, 0x4e, 0x3d, 0x34, 0x29, 0x26, 0x1e, 0x39, 0xeb, 0xf7, 0xf9, 0xca,
-    0x7e, 0x5a, 0xd4, 0xfd, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfd, 0xfc,
-    0xfd, 0xfa, 0xeb, 0xf8, 0xf8, 0xf8, 0xf9, 0xfc, 0xee, 0xfc, 0xfd, 0xfa,
-    0xf8, 0xf2, 0xeb, 0xf7, 0xf9, 0xd4, 0xef, 0xf8, 0xef, 0xf8, 0xfa, 0xa5,
-    0x8a, 0x94, 0x9f, 0xb5, 0xe4, 0xfd, 0xfa, 0xf8, 0xed, 0xc3, 0xa0, 0x71,
-    0x71, 0x76, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x76,
-    0x75, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x78, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x78, 0x76, 0x76, 0x78,
-    0x78, 0x78, 0x76, 0x76, 0x76, 0x75, 0x76, 0x76, 0x78, 0x76, 0x76, 0x78,
-    0x78, 0x76, 0x76, 0x78, 0x78, 0x84, 0x7d, 0x7d, 0x81, 0x7d, 0x7d, 0x78,
-    0x7d, 0x84, 0x84, 0x78, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x83, 0x83,
-    0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x8a, 0x8a, 0x82, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x90, 0x90, 0x97, 0x97, 0x99, 0x99,
-    0x99, 0xa3, 0xa9, 0xa9, 0xaa, 0xb4, 0xb8, 0xac, 0x90, 0x60, 0x2d, 0x16,
-    0x03, 0x05, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x05, 0x0a, 0x0a,
-    0x0e, 0x0e, 0x16, 0x16, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1e, 0x1e, 0x1e,
-    0x1f, 0x1f, 0x26, 0x26, 0x28, 0x28, 0x25, 0x25, 0x29, 0x29, 0x2d, 0x37,
-    0x3e, 0x46, 0x4e, 0x52, 0x57, 0x60, 0x63, 0x66, 0x63, 0x69, 0x60, 0x4e,
-    0x52, 0x43, 0x3c, 0x34, 0x2f, 0x28, 0x26, 0x26, 0x1e, 0x1e, 0x19, 0x19,
-    0x0e, 0x07, 0x05, 0x05, 0x03, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x0a, 0x0a, 0x0e, 0x19, 0x1a, 0x1a, 0x1a,
-    0x1b, 0x1b, 0x1f, 0x1f, 0x25, 0x2d, 0x34, 0x43, 0x5b, 0x71, 0x82, 0x96,
-    0xa1, 0xaa, 0xb4, 0xbf, 0xcc, 0xcc, 0xcc, 0xd8, 0xd8, 0xd8, 0xd8, 0xdf,
-    0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xd8,
-    0xd8, 0xd8, 0xd8, 0xcc, 0xcb, 0xcb, 0xc1, 0xb4, 0xb4, 0xaa, 0x97, 0x89,
-    0x71, 0x5b, 0x44, 0xbc, 0xf7, 0xf2, 0xeb, 0xfc, 0xfc, 0xfd, 0xfe, 0xfd,
-    0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfd, 0xfd, 0xfd, 0xf8, 0xf8, 0xf8,
-    0xf9, 0xf6, 0xf6, 0xf7, 0xf9, 0xfa, 0xfa, 0xf8, 0xf8, 0xf2, 0xef, 0xf7,
-    0xfc, 0xfc, 0xf8, 0xee, 0xf2, 0xfa, 0xfc, 0xe4, 0x96, 0x94, 0xab, 0xfb,
-    0xfe, 0xfd, 0xf5, 0xed, 0xeb, 0xef, 0xed, 0x95, 0x71, 0x74, 0x74, 0x74,
-    0x75, 0x71, 0x6c, 0x6e, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x74, 0x74,
-    0x75, 0x76, 0x74, 0x76, 0x76, 0x78, 0x78, 0x76, 0x76, 0x74, 0x74, 0x76,
-    0x76, 0x7d, 0x7d, 0x7d, 0x78, 0x78, 0x75, 0x78, 0x76, 0x76, 0x75, 0x76,
-    0x75, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x75, 0x76,
-    0x78, 0x7d, 0x81, 0x7d, 0x7d, 0x7d, 0x7d, 0x7a, 0x7a, 0x7d, 0x7d, 0x78,
-    0x78, 0x78, 0x82, 0x82, 0x81, 0x81, 0x83, 0x82, 0x78, 0x82, 0x82, 0x82,
-    0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x84, 0x82, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x90, 0x90, 0x97, 0x97, 0x97, 0x97, 0x99, 0x99, 0xa3,
-    0xa9, 0xb3, 0xb8, 0xb4, 0xa9, 0x82, 0x52, 0x26, 0x07, 0x05, 0x02, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x0e,
-    0x16, 0x16, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x19, 0x1a, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x1f, 0x1e, 0x1e, 0x1f, 0x1f, 0x26, 0x29, 0x2c, 0x2d, 0x2d, 0x37,
-    0x3c, 0x3e, 0x3d, 0x44, 0x3e, 0x3e, 0x37, 0x34, 0x2f, 0x28, 0x28, 0x1e,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x16, 0x16, 0x0e, 0x0a, 0x0a, 0x03, 0x03, 0x01,
-    0x02, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x05, 0x05, 0x05, 0x05,
-    0x0a, 0x0a, 0x0e, 0x0e, 0x19, 0x19, 0x1b, 0x1f, 0x25, 0x2d, 0x3d, 0x4e,
-    0x66, 0x7a, 0x8a, 0xa1, 0xb4, 0xb8, 0xcc, 0xcc, 0xd8, 0xd8, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xd8, 0xd8, 0xd8, 0xcc, 0xcc, 0xbf, 0xbf, 0xaa, 0xa3, 0xdc,
-    0xf8, 0xee, 0xee, 0xee, 0xfc, 0xfc, 0xfe, 0xfe, 0xf5, 0xf5, 0xfb, 0xf5,
-    0xf5, 0xf5, 0xfd, 0xfc, 0xfa, 0xf8, 0xf8, 0xf8, 0xf7, 0xf6, 0xf6, 0xf6,
-    0xf7, 0xf8, 0xf8, 0xf6, 0xf2, 0xef, 0xef, 0xf8, 0xfc, 0xfd, 0xfa, 0xee,
-    0xe7, 0xf8, 0xfa, 0xed, 0x9f, 0x89, 0xb5, 0xfe, 0xfe, 0xfd, 0xf5, 0xf5,
-    0xee, 0xeb, 0xf8, 0xf5, 0x77, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x7a, 0x86,
-    0x6c, 0x74, 0x74, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x75, 0x75, 0x76, 0x74, 0x74, 0x74, 0x75, 0x76, 0x78, 0x76, 0x76,
-    0x76, 0x76, 0x75, 0x75, 0x75, 0x75, 0x76, 0x76, 0x76, 0x76, 0x75, 0x75,
-    0x75, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x76, 0x75, 0x75,
-    0x75, 0x76, 0x76, 0x74, 0x75, 0x75, 0x75, 0x75, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7a, 0x7d, 0x7d, 0x7d, 0x76, 0x78, 0x78, 0x78, 0x7a, 0x7d, 0x7a, 0x78,
-    0x84, 0x7d, 0x78, 0x84, 0x83, 0x78, 0x82, 0x82, 0x81, 0x81, 0x82, 0x81,
-    0x82, 0x82, 0x82, 0x82, 0x8a, 0x84, 0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x8a,
-    0x90, 0x90, 0x94, 0x90, 0x97, 0x97, 0x99, 0x99, 0xa3, 0xa9, 0xa7, 0xb4,
-    0xb3, 0x97, 0x6f, 0x34, 0x1e, 0x0a, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x05, 0x05, 0x0a, 0x0a, 0x0e, 0x0e, 0x16, 0x16,
-    0x19, 0x1a, 0x1a, 0x19, 0x16, 0x16, 0x19, 0x19, 0x19, 0x19, 0x16, 0x16,
-    0x16, 0x19, 0x1e, 0x1e, 0x1a, 0x1e, 0x1e, 0x1f, 0x26, 0x26, 0x28, 0x28,
-    0x28, 0x28, 0x26, 0x1e, 0x1e, 0x1d, 0x16, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x0e, 0x0a, 0x0a, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
-    0x02, 0x01, 0x01, 0x01, 0x05, 0x05, 0x03, 0x05, 0x0a, 0x0a, 0x0e, 0x19,
-    0x1e, 0x26, 0x2d, 0x3d, 0x5b, 0x71, 0x89, 0x9f, 0xaa, 0xb6, 0xcc, 0xd8,
-    0xd8, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xdf, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xd8, 0xd8, 0xd8, 0xd8,
-    0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xdf, 0xd8, 0xd8, 0xd8, 0xcc, 0xf5, 0xf8, 0xee, 0xee, 0xee,
-    0xfa, 0xfa, 0xfc, 0xfe, 0xf5, 0xfd, 0xfe, 0xfb, 0xf5, 0xf5, 0xf9, 0xf8,
-    0xf8, 0xfa, 0xf8, 0xf6, 0xf4, 0xf4, 0xf6, 0xf6, 0xf6, 0xf7, 0xf8, 0xf6,
-    0xf8, 0xef, 0xef, 0xf7, 0xf7, 0xfc, 0xfc, 0xee, 0xeb, 0xef, 0xf8, 0xee,
-    0x96, 0x8a, 0xce, 0xfb, 0xfe, 0xfe, 0xf5, 0xf5, 0xed, 0xed, 0xee, 0xfa,
-    0xa5, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xc2, 0xd4, 0x96, 0x6e, 0x6e, 0x75,
-    0x6c, 0x74, 0x75, 0x74, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75,
-    0x75, 0x74, 0x75, 0x75, 0x76, 0x76, 0x75, 0x76, 0x76, 0x75, 0x76, 0x76,
-    0x75, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x76, 0x76, 0x75,
-    0x76, 0x75, 0x75, 0x76, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74,
-    0x74, 0x74, 0x75, 0x74, 0x7d, 0x7d, 0x7a, 0x7a, 0x7a, 0x78, 0x7d, 0x78,
-    0x78, 0x78, 0x7a, 0x7a, 0x7a, 0x7d, 0x78, 0x78, 0x7b, 0x7a, 0x78, 0x78,
-    0x83, 0x78, 0x83, 0x82, 0x84, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x8b, 0x8a, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x94, 0x90,
-    0x90, 0x97, 0x97, 0x99, 0x99, 0xa7, 0xa9, 0xa9, 0xb3, 0xa9, 0x82, 0x52,
-    0x28, 0x0e, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02,
-    0x05, 0x03, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x0e, 0x0e, 0x0e, 0x16, 0x16,
-    0x16, 0x0e, 0x0e, 0x16, 0x0e, 0x11, 0x11, 0x0e, 0x16, 0x16, 0x0e, 0x0e,
-    0x0e, 0x0e, 0x0e, 0x0e, 0x16, 0x16, 0x16, 0x19, 0x16, 0x16, 0x16, 0x16,
-    0x11, 0x11, 0x08, 0x12, 0x0a, 0x08, 0x08, 0x0a, 0x0a, 0x05, 0x05, 0x01,
-    0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x05,
-    0x05, 0x05, 0x05, 0x0a, 0x07, 0x19, 0x1f, 0x29, 0x3d, 0x5b, 0x7a, 0x90,
-    0xaa, 0xb4, 0xcc, 0xcc, 0xd8, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xdf, 0xdf, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xcc, 0xcc,
-    0xcb, 0xcc, 0xcc, 0xcb, 0xcc, 0xcb, 0xcb, 0xcc, 0xcc, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xcb, 0xcc, 0xcb, 0xc1, 0xcb, 0xcb, 0xcb,
-    0xcc, 0xcc, 0xcb, 0xcc, 0xd8, 0xd8, 0xd2, 0xe0, 0xdb, 0xdf, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xdf, 0xf5, 0xf8, 0xee, 0xee, 0xee, 0xfa, 0xfa, 0xfa, 0xfd,
-    0xf5, 0xf5, 0xfe, 0xfb, 0xfe, 0xfd, 0xf8, 0xf8, 0xf8, 0xfa, 0xf8, 0xf6,
-    0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf7, 0xf7, 0xf7, 0xf6, 0xf6, 0xf6,
-    0xf4, 0xf6, 0xf8, 0xf6, 0xf6, 0xf6, 0xfc, 0xfc, 0xa0, 0x82, 0xda, 0xfe,
-    0xfe, 0xfe, 0xf5, 0xf5, 0xf5, 0xed, 0xee, 0xfd, 0xe4, 0x66, 0x68, 0x71,
-    0x71, 0xb5, 0xd4, 0xfa, 0xc3, 0x71, 0x6e, 0x6c, 0x6e, 0x6e, 0x75, 0x6c,
-    0x6e, 0x6e, 0x6c, 0x6c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74,
-    0x74, 0x75, 0x74, 0x74, 0x75, 0x74, 0x75, 0x74, 0x75, 0x75, 0x75, 0x74,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x74, 0x74, 0x75, 0x75, 0x74, 0x74, 0x74,
-    0x78, 0x7a, 0x76, 0x78, 0x78, 0x78, 0x7d, 0x78, 0x78, 0x76, 0x76, 0x7a,
-    0x7d, 0x78, 0x7a, 0x7d, 0x7a, 0x7d, 0x7d, 0x7b, 0x7a, 0x7d, 0x78, 0x7d,
-    0x7d, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x81,
-    0x88, 0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x90, 0x90, 0x97,
-    0x99, 0x99, 0xa3, 0xa9, 0xb3, 0xa9, 0x91, 0x6f, 0x3d, 0x1a, 0x0a, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x03,
-    0x03, 0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x03, 0x05, 0x03, 0x05, 0x05,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x09, 0x08, 0x08, 0x09, 0x09,
-    0x0a, 0x08, 0x03, 0x05, 0x03, 0x01, 0x01, 0x02, 0x00, 0x00, 0x01, 0x02,
-    0x00, 0x02, 0x01, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x07, 0x19,
-    0x26, 0x34, 0x4e, 0x71, 0x94, 0xaa, 0xb4, 0xcc, 0xcc, 0xd8, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xd8, 0xd8, 0xd8, 0xd8, 0xcc,
-    0xcc, 0xcc, 0xcb, 0xcb, 0xc1, 0xcb, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xb4, 0xb4, 0xbf, 0xb4, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xcc, 0xd1, 0xe4, 0xed, 0xe4, 0xdb, 0xd3, 0xd8, 0xd8, 0xd8, 0xdf, 0xfd,
-    0xf7, 0xf8, 0xeb, 0xeb, 0xfa, 0xf9, 0xf8, 0xfa, 0xfd, 0xfc, 0xf8, 0xf8,
-    0xf9, 0xf9, 0xf7, 0xf8, 0xf8, 0xf9, 0xf8, 0xf6, 0xf0, 0xf4, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf6, 0xf7, 0xf6, 0xec, 0xf4, 0xf4, 0xf0, 0xf4, 0xf6, 0xf4,
-    0xf6, 0xf4, 0xf9, 0xfd, 0xdc, 0x85, 0xc3, 0xfe, 0xfe, 0xfe, 0xfe, 0xf5,
-    0xf5, 0xed, 0xed, 0xfc, 0xf5, 0x7c, 0x68, 0x71, 0xbe, 0xfb, 0xfe, 0xfa,
-    0xf5, 0xa5, 0x71, 0x6c, 0x6e, 0x6e, 0x6e, 0x6c, 0x6c, 0x6e, 0x6c, 0x6e,
-    0x6e, 0x6e, 0x6e, 0x74, 0x6c, 0x75, 0x75, 0x75, 0x75, 0x74, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x74, 0x74, 0x75, 0x74, 0x74, 0x75, 0x75, 0x75, 0x74,
-    0x75, 0x75, 0x75, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x76, 0x78, 0x78, 0x78, 0x78, 0x78, 0x7d, 0x7a, 0x76, 0x76, 0x7d,
-    0x7a, 0x7d, 0x7d, 0x7a, 0x7d, 0x76, 0x76, 0x7d, 0x7a, 0x7a, 0x78, 0x82,
-    0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x88, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x90, 0x91, 0x90, 0x97, 0x99, 0x99, 0xa3,
-    0xa9, 0xa9, 0xa9, 0x82, 0x52, 0x28, 0x0e, 0x05, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x05,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x03, 0x05, 0x03, 0x03, 0x00, 0x01, 0x05, 0x01, 0x03, 0x05, 0x05, 0x05,
-    0x05, 0x09, 0x08, 0x04, 0x03, 0x04, 0x04, 0x03, 0x05, 0x03, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02,
-    0x05, 0x05, 0x03, 0x03, 0x0e, 0x1e, 0x2d, 0x43, 0x66, 0x89, 0xaa, 0xb4,
-    0xcc, 0xd8, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xd8,
-    0xd8, 0xd8, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xbf, 0xcc, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xb4, 0xb8, 0xb8, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb8, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb8, 0xb4, 0xb4, 0xb4, 0xb4, 0xbf, 0xd2, 0xe4, 0xf8, 0xf6,
-    0xfc, 0xe4, 0xd2, 0xcc, 0xcc, 0xcc, 0xdb, 0xfa, 0xf8, 0xf8, 0xf8, 0xf9,
-    0xf9, 0xf8, 0xf8, 0xf8, 0xfa, 0xf7, 0xf4, 0xf6, 0xf4, 0xf7, 0xf7, 0xf7,
-    0xf7, 0xf7, 0xf6, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf3, 0xf0, 0xf4,
-    0xf6, 0xf4, 0xf0, 0xf0, 0xf0, 0xf4, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf8,
-    0xfa, 0xa5, 0xc3, 0xfd, 0xfa, 0xfd, 0xfe, 0xfe, 0xf5, 0xf5, 0xed, 0xfc,
-    0xf5, 0x77, 0x66, 0xa5, 0xfe, 0xfe, 0xfc, 0xee, 0xf9, 0xdc, 0x7c, 0x6a,
-    0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x6c, 0x6c, 0x6e, 0x6e, 0x6c, 0x6c, 0x6c,
-    0x6e, 0x6e, 0x6e, 0x6c, 0x75, 0x75, 0x75, 0x74, 0x6c, 0x75, 0x74, 0x74,
-    0x74, 0x75, 0x74, 0x6c, 0x75, 0x75, 0x75, 0x74, 0x74, 0x75, 0x75, 0x75,
-    0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74, 0x75, 0x75, 0x75,
-    0x74, 0x6c, 0x6e, 0x6c, 0x75, 0x7a, 0x76, 0x78, 0x76, 0x76, 0x78, 0x78,
-    0x78, 0x7b, 0x7a, 0x78, 0x78, 0x76, 0x76, 0x7a, 0x7a, 0x76, 0x7a, 0x7d,
-    0x7d, 0x78, 0x76, 0x78, 0x78, 0x7d, 0x82, 0x78, 0x78, 0x81, 0x82, 0x82,
-    0x82, 0x81, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x8a, 0x88, 0x88, 0x89,
-    0x8a, 0x8a, 0x8a, 0x90, 0x97, 0x97, 0x97, 0x99, 0xa3, 0xa7, 0xa9, 0x97,
-    0x69, 0x34, 0x19, 0x05, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x05, 0x05, 0x03, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x08, 0x0a, 0x03, 0x05, 0x03, 0x03, 0x00, 0x01,
-    0x00, 0x02, 0x01, 0x01, 0x00, 0x01, 0x03, 0x05, 0x05, 0x03, 0x03, 0x03,
-    0x04, 0x04, 0x01, 0x01, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x05, 0x05, 0x03, 0x03, 0x0e, 0x1f,
-    0x2d, 0x59, 0x7a, 0x9f, 0xb4, 0xcb, 0xd8, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xdf, 0xd8, 0xd8, 0xd8, 0xd8, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xbf, 0xc1, 0xbf, 0xbf, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb8, 0xb8, 0xaa, 0xaa, 0xaa, 0xb4, 0xb4, 0xa9, 0xaa, 0xac, 0xaa,
-    0xaa, 0xac, 0xaa, 0xaa, 0xb4, 0xaa, 0xb4, 0xaa, 0xb1, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb6, 0xe4, 0xf9, 0xf2, 0xeb, 0xfc, 0xfe, 0xe4, 0xd1,
-    0xbf, 0xbf, 0xd1, 0xf9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7,
-    0xf7, 0xf6, 0xfc, 0xfc, 0xf6, 0xf8, 0xfa, 0xf8, 0xf6, 0xf6, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf6, 0xf8, 0xf6, 0xf6, 0xf4, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf6, 0xf8, 0xca, 0xe4, 0xf8,
-    0xf8, 0xfc, 0xfc, 0xf8, 0xf9, 0xfa, 0xeb, 0xfc, 0xfd, 0x95, 0xa5, 0xfe,
-    0xfd, 0xfa, 0xee, 0xed, 0xeb, 0xed, 0x77, 0x68, 0x68, 0x6c, 0x6a, 0x6a,
-    0x6a, 0x6a, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
-    0x75, 0x6e, 0x6c, 0x6c, 0x6c, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x6e,
-    0x6c, 0x6c, 0x6e, 0x75, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x75, 0x6e, 0x6e,
-    0x6e, 0x6c, 0x6c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6e, 0x6e, 0x6e, 0x6c,
-    0x7a, 0x76, 0x75, 0x76, 0x76, 0x76, 0x7b, 0x78, 0x76, 0x7a, 0x7a, 0x7a,
-    0x78, 0x76, 0x76, 0x7a, 0x76, 0x76, 0x78, 0x76, 0x76, 0x76, 0x7a, 0x7a,
-    0x78, 0x7d, 0x7a, 0x7a, 0x7a, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82,
-    0x82, 0x81, 0x82, 0x81, 0x88, 0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x90,
-    0x90, 0x97, 0x97, 0x97, 0x9d, 0xa9, 0xa9, 0x99, 0x7b, 0x4e, 0x26, 0x07,
-    0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x01, 0x05, 0x03, 0x05, 0x05, 0x05, 0x0a, 0x05,
-    0x05, 0x05, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
-    0x02, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x02, 0x02, 0x01,
-    0x05, 0x03, 0x03, 0x08, 0x19, 0x26, 0x3a, 0x5b, 0x8a, 0xaa, 0xb6, 0xcc,
-    0xd8, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xd8, 0xd8, 0xd8, 0xcc, 0xd8,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xbf, 0xbf, 0xbf, 0xbf, 0xb8, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb8, 0xb4, 0xb4, 0xb4, 0xaa, 0xaa, 0xa7, 0xaa, 0xaa, 0xaa,
-    0xa9, 0xa9, 0xaa, 0xa7, 0xa7, 0xaa, 0xa7, 0xa9, 0xac, 0xac, 0xaa, 0xa9,
-    0xa9, 0xaa, 0xa7, 0xaa, 0xa7, 0xa7, 0xa9, 0xac, 0xa9, 0xa7, 0xaa, 0xb6,
-    0xed, 0xf7, 0xee, 0xeb, 0xf7, 0xfa, 0xfe, 0xfb, 0xd1, 0xbf, 0xd1, 0xf8,
-    0xf7, 0xf8, 0xf8, 0xf8, 0xf7, 0xf8, 0xf7, 0xf6, 0xf6, 0xf4, 0xfc, 0xfe,
-    0xfc, 0xf6, 0xf6, 0xf7, 0xf6, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf3,
-    0xf4, 0xf7, 0xfc, 0xfd, 0xf8, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf4, 0xf6, 0xf6, 0xf4, 0xf4, 0xee, 0xca, 0xf4, 0xf6, 0xf7, 0xf6, 0xf6,
-    0xf8, 0xf9, 0xf6, 0xf8, 0xfc, 0xdc, 0xfd, 0xfc, 0xfa, 0xf9, 0xf9, 0xf8,
-    0xf8, 0xee, 0x86, 0x6a, 0x68, 0x68, 0x68, 0x6c, 0x6a, 0x6a, 0x6a, 0x6c,
-    0x6e, 0x6e, 0x6e, 0x6c, 0x6e, 0x6c, 0x6e, 0x6e, 0x6e, 0x6e, 0x6c, 0x6e,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x6e, 0x6c, 0x6c, 0x6c, 0x6e, 0x6e,
-    0x6e, 0x6c, 0x6e, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x6c, 0x6e,
-    0x6e, 0x6e, 0x6c, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x7a, 0x74, 0x76, 0x7a,
-    0x7a, 0x78, 0x78, 0x78, 0x78, 0x76, 0x7a, 0x7a, 0x7a, 0x76, 0x78, 0x78,
-    0x76, 0x76, 0x76, 0x78, 0x78, 0x78, 0x7a, 0x7a, 0x78, 0x7a, 0x81, 0x7a,
-    0x7b, 0x78, 0x81, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81,
-    0x82, 0x82, 0x88, 0x88, 0x8a, 0x88, 0x88, 0x8a, 0x90, 0x91, 0x91, 0x97,
-    0x97, 0x99, 0xa9, 0xa3, 0x8a, 0x60, 0x2d, 0x16, 0x05, 0x05, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x01, 0x02, 0x05, 0x05, 0x05, 0x05, 0x03, 0x01, 0x00, 0x01,
-    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x00, 0x02, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x02, 0x01, 0x02, 0x02, 0x05, 0x03, 0x03, 0x07, 0x19, 0x26,
-    0x43, 0x66, 0xa1, 0xaa, 0xcc, 0xd8, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-    0xd8, 0xd8, 0xd8, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xbf, 0xcc, 0xbf,
-    0xbf, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xac, 0xac, 0xac, 0xaa, 0xa9, 0xaa, 0xaa, 0xa7, 0xa9, 0xa9, 0xa9, 0xa7,
-    0xa9, 0xa9, 0xa9, 0xa9, 0xa3, 0xa7, 0xa7, 0xa7, 0xaa, 0xa9, 0xa9, 0xa9,
-    0xa7, 0xa7, 0xa9, 0xa9, 0xa7, 0xa9, 0xaa, 0xb5, 0xeb, 0xf8, 0xf8, 0xf6,
-    0xf4, 0xf7, 0xf9, 0xfc, 0xfb, 0xce, 0xb6, 0xf9, 0xf6, 0xf8, 0xf8, 0xf8,
-    0xf7, 0xf7, 0xf7, 0xf6, 0xf6, 0xf4, 0xf4, 0xfc, 0xfa, 0xf7, 0xf4, 0xf0,
-    0xf4, 0xf0, 0xf0, 0xf0, 0xf4, 0xf8, 0xfd, 0xf8, 0xf4, 0xf4, 0xf9, 0xfc,
-    0xfc, 0xf4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf8, 0xfc, 0xfe, 0xf8,
-    0xf0, 0xf4, 0xec, 0xf6, 0xf6, 0xf4, 0xf0, 0xf0, 0xf7, 0xf8, 0xf6, 0xf6,
-    0xf8, 0xf9, 0xf8, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf8, 0xee, 0x86, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x6a, 0x6a, 0x6a, 0x6a, 0x6c, 0x6c, 0x6e, 0x6e,
-    0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e,
-    0x6c, 0x6e, 0x6e, 0x6e, 0x6c, 0x6c, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
-    0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6c, 0x6e,
-    0x6e, 0x6e, 0x6e, 0x6e, 0x74, 0x76, 0x76, 0x75, 0x75, 0x78, 0x78, 0x78,
-    0x78, 0x75, 0x78, 0x78, 0x78, 0x78, 0x78, 0x7b, 0x78, 0x78, 0x7a, 0x76,
-    0x78, 0x76, 0x76, 0x7a, 0x7d, 0x78, 0x81, 0x7d, 0x7d, 0x7d, 0x81, 0x78,
-    0x84, 0x84, 0x81, 0x84, 0x7a, 0x84, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82,
-    0x82, 0x88, 0x8a, 0x8a, 0x8a, 0x90, 0x91, 0x94, 0x97, 0x97, 0x9d, 0xa3,
-    0x97, 0x75, 0x3d, 0x1e, 0x0a, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01,
-    0x05, 0x05, 0x08, 0x0e, 0x19, 0x29, 0x43, 0x71, 0x9f, 0xb8, 0xcc, 0xd8,
-    0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xd8, 0xd8, 0xd8, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xbf, 0xcc, 0xbf, 0xc1, 0xb4, 0xb8, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xaa, 0xaa, 0xac, 0xa7, 0xaa, 0xa7, 0xa9, 0xa7, 0xa9, 0xa7, 0xa9,
-    0xa7, 0xa7, 0xa3, 0xa3, 0xa7, 0x9d, 0xa3, 0xa7, 0x9f, 0xa3, 0xa3, 0x9d,
-    0xa3, 0x9d, 0x9d, 0x9d, 0xa3, 0x9d, 0xa3, 0xa7, 0xa7, 0xa3, 0x99, 0x9f,
-    0x99, 0xa3, 0xa3, 0xb6, 0xee, 0xf7, 0xf6, 0xf4, 0xf6, 0xf8, 0xfc, 0xfc,
-    0xfc, 0xfe, 0xda, 0xfa, 0xf7, 0xf9, 0xf8, 0xf8, 0xf7, 0xf7, 0xf6, 0xf6,
-    0xf6, 0xf0, 0xf0, 0xf6, 0xf9, 0xf8, 0xf6, 0xf0, 0xf4, 0xf4, 0xf0, 0xf0,
-    0xf6, 0xf6, 0xfd, 0xfc, 0xf0, 0xf0, 0xf8, 0xfa, 0xf9, 0xf6, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf7, 0xf7, 0xfc, 0xfd, 0xfa, 0xf0, 0xf0, 0xf4, 0xf4,
-    0xf4, 0xf0, 0xf0, 0xf0, 0xf6, 0xf7, 0xf4, 0xf4, 0xf7, 0xf7, 0xf6, 0xf6,
-    0xf4, 0xf0, 0xf0, 0xf4, 0xf8, 0xf8, 0x87, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x6a, 0x6a, 0x6c, 0x6a, 0x6c, 0x6a, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e,
-    0x6c, 0x6c, 0x6e, 0x6e, 0x6c, 0x6e, 0x6e, 0x6c, 0x6e, 0x6e, 0x6c, 0x6c,
-    0x6e, 0x6e, 0x6c, 0x6e, 0x6e, 0x6c, 0x6e, 0x6e, 0x6e, 0x6e, 0x6c, 0x6e,
-    0x6e, 0x6c, 0x6e, 0x6c, 0x6e, 0x6e, 0x6e, 0x6e, 0x6c, 0x6e, 0x6e, 0x6e,
-    0x75, 0x76, 0x76, 0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x75, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x76, 0x76, 0x7a, 0x7a, 0x78, 0x76, 0x78, 0x76,
-    0x7a, 0x7d, 0x7a, 0x7d, 0x78, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x81, 0x7d,
-    0x82, 0x7a, 0x82, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x88, 0x81, 0x88,
-    0x8a, 0x8a, 0x90, 0x90, 0x90, 0x97, 0x9d, 0x99, 0x97, 0x78, 0x52, 0x29,
-    0x0e, 0x05, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x05, 0x08, 0x0e, 0x19, 0x28,
-    0x44, 0x71, 0x9d, 0xb4, 0xcb, 0xd8, 0xdf, 0xdf, 0xdf, 0xdf, 0xd8, 0xd8,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xbf, 0xbf, 0xbf, 0xbf, 0xb4, 0xb8, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xaa, 0xa9, 0xaa, 0xa7, 0xa9, 0xa9, 0xaa, 0xa9,
-    0xa7, 0xa7, 0xa3, 0xa7, 0x9d, 0xa3, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x9d, 0x9f, 0x99, 0x9d, 0x9f, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9f, 0x99, 0x99, 0x99, 0xab,
-    0xdc, 0xf7, 0xf7, 0xf7, 0xf6, 0xf6, 0xf6, 0xf7, 0xf9, 0xfa, 0xfd, 0xfc,
-    0xfa, 0xfa, 0xf8, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf0, 0xf0, 0xf0,
-    0xf7, 0xf8, 0xf7, 0xf0, 0xf0, 0xf4, 0xf3, 0xf4, 0xf8, 0xf6, 0xfa, 0xf9,
-    0xf6, 0xf0, 0xf4, 0xfc, 0xf9, 0xf8, 0xf6, 0xf0, 0xf0, 0xf0, 0xf6, 0xf6,
-    0xf4, 0xfa, 0xfc, 0xf8, 0xf4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe8,
-    0xf4, 0xf6, 0xf4, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xf4,
-    0xf6, 0xf6, 0x87, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x6a, 0x6a, 0x6a, 0x6c, 0x6c, 0x6a, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e,
-    0x6e, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x6e,
-    0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6c, 0x6a, 0x6a, 0x6e, 0x6e, 0x6c,
-    0x6c, 0x6e, 0x6e, 0x6c, 0x6c, 0x6e, 0x6e, 0x6a, 0x74, 0x74, 0x75, 0x74,
-    0x75, 0x75, 0x76, 0x76, 0x76, 0x75, 0x75, 0x75, 0x75, 0x75, 0x78, 0x78,
-    0x78, 0x78, 0x76, 0x78, 0x76, 0x76, 0x76, 0x76, 0x76, 0x7d, 0x7a, 0x7d,
-    0x76, 0x76, 0x7d, 0x7d, 0x7d, 0x7d, 0x81, 0x81, 0x7d, 0x7d, 0x78, 0x7d,
-    0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x91, 0x94, 0x94, 0x97, 0x97, 0x8a, 0x60, 0x34, 0x19, 0x03, 0x05, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x02, 0x01,
-    0x02, 0x01, 0x05, 0x0e, 0x19, 0x29, 0x44, 0x71, 0x9d, 0xb4, 0xcc, 0xd8,
-    0xdf, 0xdf, 0xdf, 0xdf, 0xd8, 0xcc, 0xcc, 0xcc, 0xcc, 0xbf, 0xcc, 0xbf,
-    0xc1, 0xb8, 0xb4, 0xb4, 0xb4, 0xb8, 0xac, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xa9, 0xac, 0xa7, 0xa7, 0xa3, 0xa3, 0x9f, 0x9d, 0x9d, 0x9d, 0x9d, 0x99,
-    0x99, 0x99, 0x9d, 0x9d, 0x99, 0x9d, 0x9d, 0x9d, 0x99, 0x9d, 0x99, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x97, 0x97, 0x9d, 0x9d, 0x9d, 0x99, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x99, 0x9d, 0x9d, 0x9f, 0xdc, 0xf6, 0xf7, 0xfc,
-    0xf8, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xf9, 0xf9, 0xf9, 0xf8, 0xf7,
-    0xf6, 0xf6, 0xf6, 0xf4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf6, 0xf6, 0xf0,
-    0xf3, 0xf3, 0xf0, 0xf6, 0xf8, 0xf6, 0xf4, 0xf8, 0xf6, 0xf0, 0xf0, 0xf8,
-    0xfd, 0xf7, 0xf7, 0xf0, 0xf3, 0xf0, 0xf4, 0xe8, 0xf4, 0xf8, 0xf7, 0xf6,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe8, 0xe8, 0xe8, 0xf0, 0xf6, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf4, 0xf6, 0xec, 0x87, 0x68,
-    0x63, 0x68, 0x63, 0x63, 0x68, 0x6a, 0x68, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6e, 0x6a, 0x6a, 0x6e, 0x6c, 0x6c, 0x6c, 0x6e, 0x6c, 0x6a, 0x6e,
-    0x6c, 0x6a, 0x6c, 0x6c, 0x6a, 0x6a, 0x6a, 0x6c, 0x6c, 0x6a, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6a, 0x6a, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x76,
-    0x7a, 0x75, 0x76, 0x76, 0x76, 0x76, 0x78, 0x78, 0x78, 0x76, 0x78, 0x78,
-    0x76, 0x76, 0x76, 0x7a, 0x76, 0x76, 0x76, 0x76, 0x7d, 0x7d, 0x7d, 0x7a,
-    0x7d, 0x7d, 0x7a, 0x7d, 0x82, 0x7d, 0x7d, 0x7d, 0x7d, 0x82, 0x81, 0x81,
-    0x81, 0x82, 0x81, 0x88, 0x8a, 0x88, 0x8a, 0x8a, 0x89, 0x94, 0x94, 0x97,
-    0x97, 0x90, 0x6c, 0x3e, 0x1f, 0x0a, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x01, 0x01, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x05, 0x07, 0x19, 0x28,
-    0x43, 0x71, 0x99, 0xb4, 0xcc, 0xd8, 0xdf, 0xdf, 0xdf, 0xd8, 0xd8, 0xcc,
-    0xcc, 0xcb, 0xbf, 0xbf, 0xbf, 0xbf, 0xb4, 0xb8, 0xb8, 0xb8, 0xb8, 0xaa,
-    0xaa, 0xaa, 0xa9, 0xa7, 0xa7, 0xa7, 0xa7, 0xaa, 0xa9, 0xa3, 0xa3, 0xa3,
-    0x9d, 0x99, 0x99, 0x9d, 0x9d, 0x99, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x97,
-    0x97, 0x9d, 0x9d, 0x97, 0x97, 0x94, 0x94, 0x9d, 0x97, 0x97, 0x94, 0x94,
-    0x94, 0x94, 0x94, 0x97, 0x97, 0x97, 0x97, 0x9d, 0x9d, 0x9d, 0x97, 0x97,
-    0xb6, 0xe4, 0xe4, 0xe4, 0xf2, 0xf4, 0xf4, 0xf8, 0xfc, 0xfa, 0xf6, 0xf6,
-    0xf6, 0xf4, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xf6, 0xf6, 0xf6, 0xf4,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf3, 0xf0, 0xf6,
-    0xf6, 0xf0, 0xe8, 0xf4, 0xf6, 0xf0, 0xf0, 0xf8, 0xf8, 0xf6, 0xf7, 0xf8,
-    0xf0, 0xf0, 0xe8, 0xe8, 0xea, 0xf8, 0xf6, 0xf6, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xe8, 0xe8, 0xe8, 0xf0, 0xf4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf4, 0xf6, 0xe7, 0x86, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x6c, 0x6e,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a,
-    0x6c, 0x68, 0x6c, 0x68, 0x6a, 0x6a, 0x6a, 0x6a, 0x68, 0x68, 0x68, 0x6c,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x74, 0x76, 0x75, 0x75, 0x74, 0x76, 0x76,
-    0x75, 0x76, 0x76, 0x76, 0x76, 0x75, 0x78, 0x76, 0x78, 0x78, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x7a, 0x7a, 0x78, 0x76, 0x7d, 0x7a, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7a, 0x7d, 0x78, 0x84, 0x84, 0x82, 0x81, 0x81, 0x81,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x91, 0x97, 0x90, 0x7a, 0x52,
-    0x29, 0x0e, 0x05, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02,
-    0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00,
-    0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x01, 0x01, 0x05, 0x0a, 0x0e, 0x26, 0x3d, 0x66, 0x94, 0xb4, 0xcc, 0xd8,
-    0xdf, 0xdf, 0xdf, 0xd8, 0xd8, 0xcc, 0xcc, 0xcb, 0xbf, 0xc1, 0xc1, 0xb8,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb8, 0xac, 0xaa, 0xa9, 0xac, 0xa9, 0xa7, 0xa7,
-    0xa7, 0xa7, 0x9d, 0x9d, 0xa3, 0x99, 0x99, 0x99, 0x9d, 0x9d, 0x97, 0x9d,
-    0x97, 0x97, 0x9d, 0x97, 0x9d, 0x94, 0x9d, 0x97, 0x97, 0x94, 0x97, 0x97,
-    0x97, 0x97, 0x94, 0x97, 0x97, 0x97, 0x97, 0x94, 0x94, 0x94, 0x94, 0x94,
-    0x97, 0x97, 0x97, 0x94, 0x94, 0x97, 0x97, 0xb6, 0xdc, 0xf8, 0xeb, 0xf8,
-    0xf4, 0xf6, 0xf4, 0xf6, 0xf9, 0xfd, 0xf8, 0xf4, 0xf4, 0xf6, 0xfc, 0xfc,
-    0xf9, 0xf6, 0xf6, 0xf6, 0xf6, 0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf3, 0xf0, 0xf6, 0xf4, 0xe8, 0xe8, 0xe8,
-    0xf4, 0xf0, 0xf4, 0xf6, 0xf0, 0xf0, 0xf4, 0xf7, 0xf6, 0xf0, 0xe8, 0xe8,
-    0xea, 0xf8, 0xf6, 0xf4, 0xe8, 0xf0, 0xf0, 0xf0, 0xe8, 0xe8, 0xe8, 0xe8,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf4,
-    0xf0, 0xca, 0x77, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6a, 0x6a,
-    0x6c, 0x6c, 0x6a, 0x6a, 0x6c, 0x6c, 0x6a, 0x6a, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x6c, 0x6c, 0x6c, 0x6e, 0x6c, 0x6c, 0x6e,
-    0x6e, 0x6c, 0x6c, 0x6e, 0x6a, 0x6a, 0x6a, 0x6a, 0x68, 0x6c, 0x68, 0x6a,
-    0x68, 0x6a, 0x6a, 0x68, 0x6a, 0x68, 0x68, 0x68, 0x75, 0x74, 0x75, 0x74,
-    0x74, 0x75, 0x75, 0x76, 0x75, 0x75, 0x76, 0x75, 0x7a, 0x76, 0x75, 0x76,
-    0x76, 0x78, 0x76, 0x76, 0x78, 0x76, 0x7a, 0x76, 0x76, 0x78, 0x78, 0x76,
-    0x76, 0x7a, 0x7a, 0x78, 0x78, 0x76, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7a, 0x7d, 0x7d, 0x78, 0x84, 0x81, 0x81, 0x82, 0x81, 0x81, 0x8a, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x91, 0x90, 0x82, 0x55, 0x2d, 0x19, 0x03, 0x01,
-    0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-    0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x05, 0x0e, 0x1b,
-    0x34, 0x5b, 0x94, 0xb4, 0xcc, 0xd8, 0xdf, 0xdf, 0xdf, 0xd8, 0xd8, 0xcc,
-    0xcb, 0xc1, 0xcc, 0xbf, 0xbf, 0xb4, 0xb4, 0xb4, 0xb4, 0xaa, 0xa9, 0xaa,
-    0xac, 0xa9, 0xa7, 0xaa, 0xa3, 0x9d, 0x9f, 0x9d, 0x9d, 0x99, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x99, 0x9d, 0x9d, 0x9d, 0x97, 0x9d, 0x97, 0x94, 0x97,
-    0x94, 0x94, 0x94, 0x97, 0x97, 0x97, 0x94, 0x94, 0x94, 0x94, 0x94, 0x90,
-    0x97, 0x94, 0x94, 0x94, 0x94, 0x94, 0x90, 0x94, 0x97, 0x97, 0x94, 0x9f,
-    0x9f, 0x94, 0x96, 0xc2, 0xef, 0xf2, 0xf2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6,
-    0xf6, 0xf9, 0xf8, 0xf4, 0xf4, 0xf4, 0xf7, 0xfa, 0xfa, 0xfd, 0xf9, 0xf6,
-    0xf6, 0xf7, 0xf4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf4, 0xf0, 0xe8, 0xe8, 0xe8, 0xf0, 0xf4, 0xf4, 0xf4,
-    0xe8, 0xe8, 0xe8, 0xf4, 0xf4, 0xe8, 0xe8, 0xe8, 0xe8, 0xf6, 0xf6, 0xf4,
-    0xe8, 0xf0, 0xf0, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xe8, 0xf0, 0xf0, 0xf0, 0xf0, 0xf4, 0x9a, 0x68, 0x66,
-    0x66, 0x66, 0x6a, 0x68, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e,
-    0x6c, 0x6c, 0x6e, 0x6c, 0x6c, 0x6e, 0x6c, 0x6e, 0x6e, 0x6c, 0x6c, 0x6c,
-    0x6e, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6a,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6a,
-    0x6c, 0x6a, 0x6a, 0x6c, 0x75, 0x71, 0x74, 0x71, 0x75, 0x7a, 0x76, 0x76,
-    0x76, 0x75, 0x7a, 0x7a, 0x7a, 0x76, 0x75, 0x76, 0x75, 0x78, 0x78, 0x78,
-    0x7b, 0x78, 0x78, 0x76, 0x78, 0x78, 0x78, 0x76, 0x7d, 0x7a, 0x7d, 0x78,
-    0x76, 0x78, 0x7a, 0x7d, 0x7a, 0x7a, 0x7d, 0x78, 0x7a, 0x7d, 0x7d, 0x78,
-    0x84, 0x81, 0x82, 0x82, 0x81, 0x81, 0x82, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x91, 0x90, 0x82, 0x66, 0x3c, 0x1e, 0x08, 0x05, 0x02, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x03, 0x08, 0x19, 0x28, 0x4e, 0x82, 0xaa, 0xcc, 0xd8,
-    0xdf, 0xdf, 0xdf, 0xd8, 0xd8, 0xcc, 0xcc, 0xcc, 0xbf, 0xbf, 0xb8, 0xb4,
-    0xb4, 0xb4, 0xb8, 0xac, 0xa9, 0xa9, 0xa9, 0xac, 0xac, 0xa9, 0xa7, 0x9d,
-    0x99, 0x99, 0x9d, 0x9d, 0x9d, 0x99, 0x9d, 0x9d, 0x99, 0x97, 0x9d, 0x97,
-    0x94, 0x94, 0x94, 0x94, 0x97, 0x94, 0x94, 0x94, 0x94, 0x97, 0x97, 0x97,
-    0x90, 0x90, 0x90, 0x94, 0x94, 0x94, 0x94, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x94, 0x94, 0x90, 0x90, 0x97, 0x97, 0xb5, 0xdc, 0xe4, 0xbe, 0xda, 0xeb,
-    0xf4, 0xf2, 0xeb, 0xec, 0xf6, 0xf6, 0xf4, 0xf4, 0xf4, 0xf6, 0xf6, 0xf4,
-    0xf4, 0xf4, 0xf0, 0xf6, 0xf8, 0xf9, 0xf9, 0xf8, 0xfd, 0xf9, 0xfd, 0xf6,
-    0xf0, 0xf0, 0xf0, 0xe8, 0xe8, 0xe8, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xf0, 0xea, 0xe8, 0xe8, 0xe8, 0xe8, 0xea,
-    0xf4, 0xe8, 0xe8, 0xe8, 0xe8, 0xf4, 0xf4, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
-    0xe8, 0xe8, 0xe8, 0xe8, 0xf0, 0xf0, 0xe8, 0xf0, 0xf0, 0xf0, 0xf0, 0xf4,
-    0xf6, 0xf0, 0xf0, 0xf0, 0xd7, 0x95, 0x66, 0x65, 0x7c, 0x6d, 0x7c, 0x71,
-    0x71, 0x7c, 0x95, 0xc3, 0xa5, 0x95, 0x86, 0x7c, 0x6c, 0x6c, 0x75, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6e, 0x75, 0x6e, 0x6e, 0x6c, 0x6e, 0x6c, 0x75, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x6c, 0x6c, 0x6c, 0x6e,
-    0x6c, 0x6c, 0x68, 0x68, 0x68, 0x6a, 0x6a, 0x6c, 0x6a, 0x6a, 0x6a, 0x6a,
-    0x75, 0x75, 0x74, 0x75, 0x74, 0x76, 0x75, 0x75, 0x75, 0x75, 0x76, 0x78,
-    0x7a, 0x76, 0x76, 0x76, 0x76, 0x75, 0x78, 0x78, 0x78, 0x78, 0x75, 0x78,
-    0x76, 0x76, 0x76, 0x76, 0x7d, 0x76, 0x78, 0x78, 0x7a, 0x78, 0x76, 0x7d,
-    0x7a, 0x7a, 0x7a, 0x78, 0x76, 0x7a, 0x7d, 0x78, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x90, 0x8a, 0x6c,
-    0x44, 0x26, 0x0a, 0x03, 0x01, 0x01, 0x05, 0x05, 0x01, 0x05, 0x00, 0x00,
-    0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0e,
-    0x26, 0x3c, 0x71, 0xa3, 0xbf, 0xcc, 0xdf, 0xdf, 0xdf, 0xd8, 0xd8, 0xcb,
-    0xcc, 0xbf, 0xbf, 0xbf, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xac, 0xaa, 0xac,
-    0xaa, 0xa7, 0xa9, 0xa1, 0xa3, 0xa3, 0x99, 0x99, 0x97, 0x9d, 0x94, 0x94,
-    0x97, 0x94, 0x94, 0x94, 0x94, 0x94, 0x97, 0x97, 0x94, 0x94, 0x97, 0x97,
-    0x94, 0x94, 0x94, 0x97, 0x90, 0x94, 0x94, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x94, 0x94, 0x94, 0x94, 0x90, 0x94, 0x94, 0x90, 0x90, 0x90, 0x90, 0x94,
-    0x90, 0xab, 0xdc, 0xf7, 0xfa, 0xfd, 0xfc, 0xf6, 0xf6, 0xf2, 0xeb, 0xec,
-    0xf6, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf0, 0xf4, 0xf6, 0xf6,
-    0xf4, 0xf6, 0xf7, 0xfc, 0xf8, 0xf4, 0xfa, 0xfe, 0xf6, 0xf0, 0xe8, 0xe8,
-    0xe8, 0xf4, 0xf7, 0xfa, 0xfc, 0xf8, 0xf4, 0xf0, 0xe8, 0xe8, 0xe8, 0xe8,
-    0xe8, 0xe8, 0xea, 0xe8, 0xea, 0xe8, 0xe8, 0xea, 0xea, 0xe8, 0xe8, 0xea,
-    0xe8, 0xe8, 0xea, 0xe8, 0xe8, 0xe8, 0xe8, 0xf4, 0xf6, 0xf4, 0xe8, 0xe8,
-    0xf0, 0xe8, 0xe8, 0xf0, 0xf0, 0xf0, 0xf6, 0xf6, 0xf4, 0xf4, 0xf0, 0xf0,
-    0xd4, 0x87, 0xbc, 0xeb, 0xe7, 0xef, 0xf2, 0x9a, 0xc3, 0xed, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf7, 0xbc, 0x71, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-    0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x74, 0x75, 0x74,
-    0x74, 0x75, 0x6c, 0x6c, 0x6e, 0x6c, 0x6e, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6e, 0x6e, 0x6c, 0x6e, 0x6e, 0x6e, 0x6e, 0x74, 0x74, 0x75, 0x74,
-    0x75, 0x76, 0x74, 0x76, 0x76, 0x7a, 0x75, 0x75, 0x75, 0x75, 0x78, 0x75,
-    0x76, 0x76, 0x76, 0x78, 0x75, 0x78, 0x75, 0x75, 0x78, 0x7a, 0x7a, 0x76,
-    0x7d, 0x7d, 0x78, 0x7a, 0x7a, 0x76, 0x76, 0x76, 0x7a, 0x7a, 0x7a, 0x78,
-    0x78, 0x76, 0x7a, 0x78, 0x78, 0x7d, 0x78, 0x82, 0x82, 0x81, 0x81, 0x81,
-    0x81, 0x88, 0x88, 0x88, 0x88, 0x91, 0x8a, 0x75, 0x52, 0x28, 0x0e, 0x05,
-    0x01, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x05, 0x05, 0x01, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x01, 0x01, 0x03, 0x0a, 0x19, 0x2d, 0x5b, 0x90, 0xb4, 0xcc,
-    0xd8, 0xdf, 0xdf, 0xd8, 0xd8, 0xcc, 0xcc, 0xbf, 0xbf, 0xb8, 0xb4, 0xb4,
-    0xb4, 0xaa, 0xac, 0xaa, 0xaa, 0xac, 0xac, 0xaa, 0x9f, 0xa3, 0xa3, 0x99,
-    0x9d, 0x99, 0x99, 0x97, 0x97, 0x94, 0x94, 0x94, 0x94, 0x94, 0x97, 0x94,
-    0x94, 0x97, 0x94, 0x94, 0x94, 0x90, 0x94, 0x94, 0x94, 0x94, 0x90, 0x90,
-    0x94, 0x90, 0x94, 0x90, 0x94, 0x94, 0x94, 0x94, 0x90, 0x90, 0x8a, 0x89,
-    0x89, 0x89, 0x8a, 0x90, 0x89, 0x90, 0x89, 0x94, 0x90, 0xb5, 0xee, 0xef,
-    0xee, 0xee, 0xfa, 0xef, 0xf6, 0xf8, 0xeb, 0xef, 0xf6, 0xf6, 0xf4, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf7, 0xf9, 0xf0, 0xf0, 0xf7, 0xf8,
-    0xf4, 0xf0, 0xf6, 0xfc, 0xfd, 0xf4, 0xf0, 0xe8, 0xe8, 0xf0, 0xf0, 0xf4,
-    0xf9, 0xfc, 0xfa, 0xf0, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xea, 0xea, 0xea,
-    0xe2, 0xe2, 0xea, 0xec, 0xea, 0xe8, 0xe8, 0xe2, 0xea, 0xe8, 0xe8, 0xe8,
-    0xe2, 0xe8, 0xe8, 0xf6, 0xf0, 0xf6, 0xea, 0xe8, 0xf0, 0xe8, 0xe8, 0xe8,
-    0xf0, 0xf6, 0xf6, 0xf4, 0xf0, 0xf0, 0xf4, 0xec, 0xd9, 0xef, 0xf0, 0xf4,
-    0xf4, 0xf4, 0xf4, 0xfa, 0xf9, 0xf7, 0xf7, 0xf7, 0xf6, 0xf4, 0xf0, 0xf0,
-    0xa5, 0x76, 0x76, 0x76, 0x76, 0x76, 0x78, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x75, 0x76, 0x75, 0x75, 0x75, 0x75, 0x76, 0x74,
-    0x75, 0x75, 0x75, 0x75, 0x74, 0x74, 0x74, 0x6c, 0x6c, 0x6c, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x74, 0x75, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x76, 0x76, 0x75, 0x75, 0x76, 0x78, 0x78, 0x75, 0x76, 0x76, 0x76,
-    0x78, 0x75, 0x75, 0x76, 0x7a, 0x78, 0x7a, 0x76, 0x7d, 0x78, 0x78, 0x7d,
-    0x7a, 0x78, 0x7a, 0x7d, 0x7a, 0x76, 0x76, 0x78, 0x78, 0x76, 0x76, 0x7a,
-    0x7d, 0x7d, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x88, 0x88, 0x88, 0x78, 0x57, 0x2d, 0x16, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x02,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x02, 0x01, 0x02, 0x05, 0x03,
-    0x0e, 0x1f, 0x44, 0x7a, 0xaa, 0xbf, 0xd8, 0xdf, 0xdf, 0xd8, 0xd8, 0xcc,
-    0xcc, 0xcc, 0xbf, 0xb4, 0xb8, 0xb8, 0xb8, 0xaa, 0xaa, 0xaa, 0xa7, 0xaa,
-    0xaa, 0x9f, 0xa3, 0x9f, 0x99, 0x99, 0x9f, 0x9d, 0x9d, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x94, 0x94, 0x90, 0x90, 0x94, 0x90, 0x94, 0x94,
-    0x90, 0x90, 0x94, 0x90, 0x90, 0x90, 0x94, 0x8a, 0x89, 0x94, 0x94, 0x94,
-    0x94, 0x94, 0x94, 0x94, 0x90, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x89, 0x89, 0x89, 0x8a, 0xa0, 0xdc, 0xeb, 0xeb, 0xed, 0xed, 0xed, 0xeb,
-    0xf6, 0xf8, 0xf8, 0xef, 0xf4, 0xf6, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf6, 0xf6, 0xea, 0xe8, 0xf6, 0xf4, 0xf0, 0xf0, 0xf0, 0xf6,
-    0xf9, 0xf7, 0xf0, 0xe8, 0xe8, 0xe8, 0xe8, 0xf0, 0xf0, 0xf4, 0xf6, 0xec,
-    0xe8, 0xe8, 0xe8, 0xe2, 0xea, 0xea, 0xea, 0xe2, 0xe2, 0xe2, 0xe2, 0xea,
-    0xea, 0xea, 0xe2, 0xe2, 0xe8, 0xe8, 0xe8, 0xe8, 0xe1, 0xe8, 0xea, 0xea,
-    0xe8, 0xf4, 0xea, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xf4, 0xf6, 0xea, 0xe8,
-    0xe8, 0xf6, 0xf4, 0xf6, 0xf4, 0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf9,
-    0xf8, 0xf4, 0xf0, 0xf0, 0xf4, 0xea, 0xea, 0xe8, 0xd9, 0xa5, 0x7d, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x76,
-    0x7d, 0x7d, 0x76, 0x76, 0x78, 0x78, 0x7d, 0x76, 0x78, 0x78, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x76, 0x76, 0x75, 0x76, 0x76,
-    0x74, 0x74, 0x6f, 0x74, 0x75, 0x7b, 0x75, 0x75, 0x75, 0x76, 0x71, 0x75,
-    0x75, 0x75, 0x78, 0x78, 0x75, 0x78, 0x7a, 0x76, 0x75, 0x75, 0x75, 0x76,
-    0x76, 0x78, 0x78, 0x76, 0x7d, 0x78, 0x78, 0x7d, 0x76, 0x76, 0x7a, 0x78,
-    0x76, 0x76, 0x78, 0x76, 0x7a, 0x78, 0x7a, 0x7a, 0x7a, 0x7d, 0x7a, 0x82,
-    0x7d, 0x81, 0x7d, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x88, 0x88, 0x7d,
-    0x5f, 0x30, 0x19, 0x03, 0x01, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01,
-    0x02, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x05, 0x05, 0x19, 0x2d, 0x5b, 0x90, 0xb4,
-    0xcc, 0xd8, 0xdf, 0xd8, 0xd8, 0xcc, 0xcc, 0xcc, 0xbf, 0xbf, 0xb4, 0xb4,
-    0xb4, 0xaa, 0xaa, 0xa9, 0xaa, 0xa3, 0x9f, 0x9d, 0x9f, 0x9f, 0x9f, 0x99,
-    0x97, 0x97, 0x97, 0x9d, 0x94, 0x97, 0x94, 0x90, 0x90, 0x90, 0x97, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x94, 0x94, 0x90, 0x94, 0x94, 0x90, 0x90,
-    0x90, 0x91, 0x94, 0x90, 0x90, 0x90, 0x90, 0x94, 0x94, 0x94, 0x94, 0x90,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x89, 0x8a, 0x9f,
-    0xed, 0xf6, 0xf9, 0xfd, 0xfe, 0xed, 0xee, 0xeb, 0xf6, 0xf7, 0xf8, 0xf2,
-    0xf4, 0xf4, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4,
-    0xe8, 0xe8, 0xea, 0xea, 0xe8, 0xe8, 0xe8, 0xf0, 0xf6, 0xf7, 0xf6, 0xe8,
-    0xe8, 0xe8, 0xe8, 0xea, 0xe8, 0xe8, 0xf0, 0xf4, 0xea, 0xe2, 0xe2, 0xe2,
-    0xe2, 0xea, 0xea, 0xea, 0xe2, 0xe2, 0xe1, 0xea, 0xea, 0xe2, 0xe2, 0xe2,
-    0xe8, 0xe8, 0xe8, 0xe1, 0xe1, 0xe8, 0xea, 0xea, 0xea, 0xea, 0xe8, 0xe8,
-    0xe8, 0xe8, 0xe8, 0xf0, 0xf4, 0xe8, 0xe8, 0xe8, 0xf4, 0xf7, 0xf6, 0xf4,
-    0xe8, 0xea, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf6, 0xf6, 0xf0, 0xf4, 0xea,
-    0xea, 0xea, 0xea, 0xe2, 0xe5, 0xca, 0x81, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x7d, 0x7d, 0x81, 0x81, 0x7d, 0x7d, 0x81, 0x7d, 0x71, 0x74, 0x74, 0x74,
-    0x75, 0x71, 0x7b, 0x75, 0x7a, 0x71, 0x7a, 0x74, 0x75, 0x75, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x75, 0x75, 0x75, 0x78, 0x78, 0x78, 0x76, 0x76, 0x76,
-    0x78, 0x82, 0x7d, 0x7d, 0x76, 0x7a, 0x76, 0x76, 0x76, 0x76, 0x78, 0x76,
-    0x7a, 0x78, 0x7a, 0x7a, 0x7a, 0x7d, 0x7d, 0x7d, 0x78, 0x7d, 0x7d, 0x7d,
-    0x81, 0x84, 0x81, 0x81, 0x81, 0x88, 0x88, 0x82, 0x63, 0x34, 0x1a, 0x03,
-    0x01, 0x05, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x0a, 0x0a, 0x05, 0x05,
-    0x05, 0x05, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x02, 0x02,
-    0x01, 0x01, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x05, 0x05, 0x03, 0x03,
-    0x05, 0x07, 0x1e, 0x3d, 0x71, 0xac, 0xbf, 0xd8, 0xdf, 0xdf, 0xd8, 0xd8,
-    0xcc, 0xcc, 0xbf, 0xbf, 0xb4, 0xb4, 0xb4, 0xaa, 0xaa, 0xa9, 0xa7, 0xa7,
-    0xa3, 0x9f, 0x99, 0x9f, 0x9d, 0x9d, 0x97, 0x97, 0x97, 0x94, 0x97, 0x97,
-    0x94, 0x94, 0x94, 0x90, 0x90, 0x90, 0x90, 0x94, 0x90, 0x94, 0x94, 0x90,
-    0x90, 0x90, 0x94, 0x90, 0x91, 0x90, 0x90, 0x90, 0x94, 0x94, 0x94, 0x89,
-    0x8a, 0x8a, 0x90, 0x94, 0x90, 0x90, 0x90, 0x8a, 0x8a, 0x8a, 0x8a, 0x89,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0xb5, 0xed, 0xf5, 0xf6, 0xf6, 0xf7, 0xf8,
-    0xf8, 0xf7, 0xf7, 0xf7, 0xf6, 0xf8, 0xf9, 0xf2, 0xf4, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf4, 0xea, 0xe8, 0xe8, 0xf4,
-    0xe8, 0xe8, 0xe8, 0xe8, 0xf6, 0xf6, 0xf6, 0xea, 0xe8, 0xe8, 0xe8, 0xe1,
-    0xea, 0xea, 0xe8, 0xea, 0xea, 0xe2, 0xe2, 0xe1, 0xe1, 0xea, 0xea, 0xe1,
-    0xe1, 0xe1, 0xe1, 0xea, 0xe2, 0xe2, 0xe2, 0xe2, 0xe8, 0xe8, 0xea, 0xe1,
-    0xe2, 0xea, 0xea, 0xe2, 0xea, 0xea, 0xea, 0xe8, 0xea, 0xea, 0xf0, 0xf4,
-    0xe8, 0xe8, 0xe8, 0xe8, 0xec, 0xf7, 0xf6, 0xec, 0xe8, 0xe8, 0xf0, 0xf4,
-    0xf4, 0xf0, 0xf0, 0xf6, 0xec, 0xf4, 0xea, 0xea, 0xea, 0xea, 0xe5, 0xe5,
-    0xef, 0xc2, 0x91, 0x91, 0x97, 0x91, 0x91, 0x94, 0x94, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x74, 0x75, 0x75, 0x75, 0x74, 0x75, 0x71, 0x75,
-    0x76, 0x71, 0x76, 0x76, 0x75, 0x78, 0x76, 0x78, 0x78, 0x76, 0x76, 0x75,
-    0x74, 0x76, 0x75, 0x78, 0x76, 0x78, 0x76, 0x76, 0x78, 0x7a, 0x7a, 0x7d,
-    0x76, 0x76, 0x78, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x88, 0x88, 0x81, 0x6a, 0x3c, 0x1e, 0x0a, 0x01, 0x05, 0x0a, 0x0e,
-    0x19, 0x1a, 0x1a, 0x0e, 0x0e, 0x0e, 0x07, 0x0a, 0x0a, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x03, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0a, 0x0c, 0x28, 0x4e, 0x90,
-    0xb4, 0xcc, 0xd8, 0xdf, 0xd8, 0xd8, 0xcc, 0xcc, 0xbf, 0xbf, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xac, 0xac, 0xac, 0xa3, 0xa7, 0x9d, 0x9f, 0x9d, 0x9d, 0x97,
-    0x94, 0x97, 0x97, 0x97, 0x90, 0x90, 0x97, 0x90, 0x94, 0x94, 0x90, 0x90,
-    0x94, 0x90, 0x90, 0x94, 0x90, 0x90, 0x94, 0x94, 0x94, 0x89, 0x94, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8a, 0x8a, 0x8a, 0x8a, 0x90,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x8a,
-    0x96, 0xed, 0xf6, 0xf6, 0xf8, 0xfa, 0xf7, 0xf6, 0xf6, 0xf6, 0xf4, 0xf6,
-    0xf6, 0xf6, 0xf7, 0xf8, 0xf6, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf4, 0xe8, 0xe8, 0xe8, 0xe8, 0xf4, 0xe8, 0xe8, 0xe8,
-    0xf0, 0xf4, 0xf0, 0xea, 0xe8, 0xe8, 0xe8, 0xe1, 0xea, 0xea, 0xe8, 0xe8,
-    0xea, 0xea, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1,
-    0xe2, 0xe2, 0xe2, 0xe2, 0xe8, 0xe8, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1,
-    0xea, 0xea, 0xea, 0xf4, 0xfa, 0xec, 0xe8, 0xe8, 0xea, 0xea, 0xe8, 0xe8,
-    0xec, 0xf6, 0xec, 0xea, 0xe8, 0xf0, 0xf0, 0xf4, 0xf0, 0xf0, 0xf4, 0xf4,
-    0xf4, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe5, 0xef, 0xed, 0xaa, 0xa3, 0xa3,
-    0xa3, 0xa3, 0x9d, 0xa3, 0xa9, 0xa7, 0xa7, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0x9d, 0xa3, 0x9d, 0x9d, 0xa3, 0xa3, 0x99, 0x99, 0x99, 0x9d, 0x99, 0x99,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x91, 0x91, 0x91, 0x91, 0x94, 0x91,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x78, 0x75, 0x76, 0x7a, 0x7a, 0x76, 0x75, 0x75, 0x75, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x78, 0x76, 0x7b, 0x7a, 0x76, 0x7a, 0x78, 0x7a,
-    0x7a, 0x7a, 0x76, 0x7a, 0x76, 0x76, 0x78, 0x78, 0x76, 0x7d, 0x7d, 0x76,
-    0x7d, 0x7d, 0x78, 0x78, 0x7d, 0x7d, 0x7d, 0x81, 0x81, 0x81, 0x88, 0x81,
-    0x6e, 0x44, 0x1e, 0x0a, 0x05, 0x05, 0x0a, 0x19, 0x1a, 0x1a, 0x1a, 0x1a,
-    0x19, 0x0c, 0x0e, 0x0e, 0x07, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x0a, 0x07, 0x1e, 0x34, 0x71, 0x9f, 0xcc, 0xd8, 0xdf, 0xd8, 0xd8,
-    0xcc, 0xcc, 0xbf, 0xbf, 0xb4, 0xb4, 0xb4, 0xb4, 0xaa, 0xaa, 0xaa, 0xa3,
-    0xa3, 0xa1, 0x99, 0x9f, 0x9f, 0x9d, 0x9d, 0x94, 0x97, 0x90, 0x90, 0x90,
-    0x90, 0x94, 0x94, 0x94, 0x94, 0x94, 0x90, 0x90, 0x90, 0x90, 0x90, 0x94,
-    0x94, 0x8a, 0x8a, 0x89, 0x89, 0x8a, 0x90, 0x90, 0x90, 0x8a, 0x8a, 0x90,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x88, 0x82, 0x82, 0x8a, 0x8a, 0x8a, 0x8a, 0xc3, 0xf2, 0xef, 0xec,
-    0xf8, 0xfd, 0xfc, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf0, 0xf4, 0xf6,
-    0xf8, 0xf6, 0xf0, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf0, 0xe8, 0xf0, 0xf0,
-    0xf0, 0xe8, 0xe8, 0xe8, 0xea, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xea,
-    0xea, 0xe2, 0xe8, 0xea, 0xea, 0xe1, 0xea, 0xe8, 0xea, 0xea, 0xe1, 0xe1,
-    0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2,
-    0xe8, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xea, 0xe2, 0xea, 0xf6,
-    0xf8, 0xec, 0xe8, 0xe2, 0xe2, 0xe2, 0xea, 0xe8, 0xf4, 0xf6, 0xea, 0xe8,
-    0xe8, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf4, 0xea, 0xea, 0xf4, 0xea, 0xea,
-    0xea, 0xec, 0xef, 0xef, 0xc2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb1, 0xb1,
-    0xb1, 0xb4, 0xb1, 0xb3, 0xb1, 0xb1, 0xb1, 0xb3, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb1, 0xb3, 0xb3, 0xa9, 0xa7, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9,
-    0xa9, 0xa7, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0x6f, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x71, 0x75, 0x75, 0x75, 0x78, 0x78, 0x76,
-    0x76, 0x76, 0x75, 0x7a, 0x75, 0x75, 0x75, 0x75, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x7a, 0x7a, 0x76, 0x7a, 0x7a, 0x78, 0x78, 0x76, 0x7a, 0x78, 0x76,
-    0x76, 0x76, 0x76, 0x78, 0x76, 0x7d, 0x7d, 0x76, 0x78, 0x76, 0x7d, 0x78,
-    0x78, 0x7d, 0x7d, 0x7d, 0x81, 0x81, 0x81, 0x81, 0x6e, 0x46, 0x1f, 0x0a,
-    0x05, 0x05, 0x07, 0x1a, 0x1a, 0x1f, 0x1a, 0x1b, 0x1b, 0x1a, 0x1a, 0x19,
-    0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x0c, 0x26, 0x43,
-    0x89, 0xb4, 0xcc, 0xd8, 0xdf, 0xd8, 0xd8, 0xcc, 0xcc, 0xcc, 0xbf, 0xb4,
-    0xb4, 0xb8, 0xac, 0xac, 0xac, 0xa7, 0xaa, 0x9d, 0xa3, 0xa1, 0x99, 0x99,
-    0x9d, 0x97, 0x97, 0x94, 0x97, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x94,
-    0x94, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x90, 0x8a, 0x8a, 0x90, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x8a, 0x8a, 0x96, 0xdc, 0xf7, 0xec, 0xea, 0xf6, 0xfa, 0xfc, 0xf7,
-    0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xf6, 0xf4, 0xf4, 0xf8, 0xf8, 0xf4, 0xf0,
-    0xf0, 0xf0, 0xf4, 0xf4, 0xf0, 0xe8, 0xe8, 0xf0, 0xf0, 0xe8, 0xe8, 0xe8,
-    0xe8, 0xea, 0xe8, 0xea, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe2, 0xe2, 0xea,
-    0xea, 0xe1, 0xe1, 0xe1, 0xea, 0xea, 0xe1, 0xd6, 0xe1, 0xe1, 0xe1, 0xe1,
-    0xdd, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xea, 0xea, 0xe1, 0xe1, 0xe1,
-    0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xea, 0xec, 0xea, 0xec, 0xea, 0xe2, 0xe2,
-    0xe2, 0xe2, 0xe8, 0xe8, 0xf4, 0xf6, 0xf6, 0xe8, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xea, 0xea, 0xf4, 0xf4, 0xf4, 0xec, 0xf6, 0xef, 0xef, 0xd4,
-    0xb6, 0xb3, 0xb8, 0xc1, 0xbf, 0xbf, 0xbf, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb,
-    0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb,
-    0xcb, 0xc1, 0xcb, 0xbf, 0xbf, 0xbf, 0xbf, 0xc1, 0xc1, 0xbf, 0xbf, 0xc1,
-    0xc1, 0xbf, 0xc1, 0xc1, 0x75, 0x71, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x78, 0x76, 0x76, 0x76, 0x76, 0x7a, 0x7a,
-    0x7b, 0x7b, 0x7a, 0x7a, 0x76, 0x7a, 0x7a, 0x76, 0x76, 0x7a, 0x7a, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x78, 0x76, 0x78, 0x76, 0x76, 0x76, 0x76, 0x78, 0x76,
-    0x7d, 0x76, 0x7a, 0x78, 0x78, 0x76, 0x76, 0x7d, 0x78, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x81, 0x81, 0x81, 0x6e, 0x46, 0x1f, 0x0a, 0x01, 0x03, 0x07, 0x16,
-    0x1e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1a, 0x1a, 0x1a, 0x19, 0x19, 0x1a, 0x1a,
-    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
-    0x0e, 0x0a, 0x0a, 0x07, 0x19, 0x29, 0x5b, 0x9f, 0xbf, 0xd8, 0xdf, 0xdf,
-    0xd8, 0xcc, 0xcc, 0xbf, 0xbf, 0xb4, 0xb4, 0xac, 0xaa, 0xac, 0xaa, 0xaa,
-    0xaa, 0xa3, 0xa3, 0x99, 0x9d, 0x9f, 0x9f, 0x9d, 0x97, 0x94, 0x97, 0x97,
-    0x90, 0x94, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x94, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x8a, 0x8a, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x89, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x89, 0x96,
-    0xca, 0xef, 0xea, 0xea, 0xf4, 0xf6, 0xf8, 0xf7, 0xf4, 0xf0, 0xf0, 0xf0,
-    0xf6, 0xf9, 0xf6, 0xe8, 0xec, 0xec, 0xf6, 0xf0, 0xf0, 0xe8, 0xea, 0xf0,
-    0xf0, 0xf4, 0xef, 0xfa, 0xf9, 0xf6, 0xe8, 0xea, 0xe2, 0xea, 0xea, 0xea,
-    0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1,
-    0xe1, 0xea, 0xe1, 0xd0, 0xe1, 0xe1, 0xe1, 0xd0, 0xd0, 0xdd, 0xe1, 0xe1,
-    0xe3, 0xe3, 0xe2, 0xe2, 0xe1, 0xe1, 0xd0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2,
-    0xea, 0xec, 0xe1, 0xea, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe8, 0xf4,
-    0xf6, 0xf6, 0xf7, 0xea, 0xe8, 0xf4, 0xf6, 0xf6, 0xf4, 0xf6, 0xec, 0xf0,
-    0xf0, 0xf4, 0xf4, 0xf4, 0xf4, 0xe5, 0xe5, 0xc3, 0xb3, 0xb1, 0xb3, 0xc1,
-    0xc1, 0xc1, 0xcb, 0xcb, 0xcb, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xde,
-    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
-    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
-    0x6f, 0x6f, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x75,
-    0x78, 0x75, 0x78, 0x76, 0x75, 0x7b, 0x78, 0x78, 0x7a, 0x7a, 0x76, 0x76,
-    0x76, 0x78, 0x7a, 0x76, 0x76, 0x76, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x76,
-    0x78, 0x78, 0x78, 0x7d, 0x78, 0x76, 0x78, 0x78, 0x76, 0x76, 0x7a, 0x78,
-    0x76, 0x76, 0x76, 0x76, 0x7d, 0x76, 0x7d, 0x7d, 0x78, 0x7d, 0x81, 0x82,
-    0x6e, 0x46, 0x1e, 0x0a, 0x01, 0x03, 0x0a, 0x1a, 0x1f, 0x1f, 0x26, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x1e, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a,
-    0x1a, 0x16, 0x16, 0x19, 0x16, 0x1a, 0x1a, 0x1a, 0x0e, 0x07, 0x07, 0x19,
-    0x34, 0x66, 0xa1, 0xbf, 0xd8, 0xd8, 0xd8, 0xd8, 0xcc, 0xcc, 0xbf, 0xb4,
-    0xb4, 0xb8, 0xb8, 0xa9, 0xac, 0xa7, 0xaa, 0x9f, 0x9d, 0x9d, 0x99, 0x9d,
-    0x9d, 0x97, 0x9d, 0x97, 0x97, 0x90, 0x90, 0x90, 0x90, 0x94, 0x90, 0x90,
-    0x90, 0x94, 0x90, 0x90, 0x8a, 0x89, 0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x89, 0x8a, 0x8a,
-    0x8a, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x82, 0x82, 0x8a,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x85, 0xca, 0xec, 0xec, 0xe2,
-    0xea, 0xf4, 0xf6, 0xf6, 0xf4, 0xf0, 0xf0, 0xf0, 0xf4, 0xf7, 0xf7, 0xf0,
-    0xe8, 0xe8, 0xf4, 0xf4, 0xf0, 0xe8, 0xe8, 0xf0, 0xec, 0xec, 0xf7, 0xf8,
-    0xf6, 0xec, 0xf4, 0xea, 0xe2, 0xe2, 0xe2, 0xea, 0xe1, 0xe2, 0xe2, 0xe2,
-    0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xd0,
-    0xe1, 0xe1, 0xe1, 0xd0, 0xd0, 0xd0, 0xe1, 0xef, 0xfa, 0xf7, 0xe2, 0xe2,
-    0xe1, 0xe1, 0xd0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe3, 0xe1, 0xe1, 0xdd,
-    0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xf4, 0xf6, 0xf6, 0xf0, 0xf6, 0xef,
-    0xf4, 0xf6, 0xf6, 0xf4, 0xf0, 0xf6, 0xf9, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xe5, 0xec, 0xca, 0x9f, 0x99, 0xa9, 0xa9, 0xb8, 0xce, 0xe4, 0xc1, 0xc1,
-    0xcb, 0xcb, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xde, 0xde, 0xde, 0xde, 0xde,
-    0xde, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xde, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0x75, 0x6f, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x76, 0x7a, 0x76, 0x78, 0x76,
-    0x75, 0x78, 0x78, 0x76, 0x76, 0x75, 0x7a, 0x76, 0x76, 0x78, 0x76, 0x7a,
-    0x76, 0x7d, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7d, 0x78, 0x7d, 0x7a,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x7a, 0x78, 0x78, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x7d, 0x7d, 0x81, 0x81, 0x74, 0x46, 0x1e, 0x0a,
-    0x05, 0x03, 0x0a, 0x1a, 0x1f, 0x26, 0x25, 0x26, 0x25, 0x25, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1a, 0x1a, 0x19, 0x1a, 0x1a,
-    0x1a, 0x1a, 0x1a, 0x0e, 0x0e, 0x0e, 0x19, 0x3d, 0x7a, 0xac, 0xcc, 0xd8,
-    0xd8, 0xd8, 0xcc, 0xcc, 0xbf, 0xc1, 0xb4, 0xb4, 0xb8, 0xac, 0xac, 0xa9,
-    0xa9, 0xa7, 0x9d, 0x9f, 0x9d, 0x9d, 0x9d, 0x9d, 0x97, 0x97, 0x94, 0x94,
-    0x97, 0x90, 0x90, 0x90, 0x94, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x90,
-    0x90, 0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x8a,
-    0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x82, 0x89, 0x8a, 0x8a, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x7a, 0x82, 0xbc, 0xec, 0xec, 0xe2, 0xe2, 0xea, 0xf4, 0xf4,
-    0xf4, 0xf0, 0xf0, 0xf0, 0xe8, 0xf4, 0xf6, 0xf6, 0xea, 0xe8, 0xe8, 0xf4,
-    0xf7, 0xf4, 0xea, 0xea, 0xec, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
-    0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe2, 0xe2, 0xe1, 0xe1, 0xea, 0xfa, 0xf2,
-    0xe1, 0xe1, 0xdd, 0xe1, 0xe1, 0xe1, 0xe1, 0xd0, 0xe1, 0xe1, 0xdd, 0xd0,
-    0xd0, 0xdd, 0xea, 0xea, 0xea, 0xea, 0xe2, 0xe1, 0xe1, 0xd0, 0xd0, 0xd0,
-    0xd0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xdd, 0xdd, 0xdd, 0xe1, 0xe1, 0xe2,
-    0xe2, 0xea, 0xf4, 0xf4, 0xea, 0xf4, 0xf6, 0xf4, 0xf0, 0xe8, 0xe8, 0xea,
-    0xf0, 0xf4, 0xf8, 0xf6, 0xf0, 0xf4, 0xf4, 0xef, 0xef, 0xe6, 0x95, 0x81,
-    0x82, 0x90, 0xa0, 0xbc, 0xc8, 0xca, 0xce, 0xb6, 0xb1, 0xb3, 0xc1, 0xbf,
-    0xcb, 0xcb, 0xcb, 0xd3, 0xd3, 0xd3, 0xd3, 0xde, 0xde, 0xde, 0xde, 0xde,
-    0xde, 0xdf, 0xde, 0xde, 0xde, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xe9, 0xe9, 0x75, 0x75, 0x74, 0x75, 0x75, 0x75, 0x75, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x78, 0x7a,
-    0x76, 0x75, 0x7a, 0x78, 0x78, 0x78, 0x78, 0x78, 0x76, 0x76, 0x7a, 0x7a,
-    0x7a, 0x78, 0x78, 0x78, 0x7d, 0x7d, 0x7d, 0x7a, 0x7a, 0x76, 0x76, 0x76,
-    0x76, 0x7a, 0x7a, 0x78, 0x76, 0x78, 0x78, 0x76, 0x76, 0x76, 0x7d, 0x76,
-    0x7d, 0x7d, 0x81, 0x81, 0x71, 0x46, 0x26, 0x08, 0x01, 0x05, 0x0a, 0x19,
-    0x1f, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x1f, 0x25,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1a, 0x16, 0x0e,
-    0x0e, 0x1f, 0x3d, 0x82, 0xb4, 0xcc, 0xd8, 0xd8, 0xd8, 0xcc, 0xcc, 0xc1,
-    0xb4, 0xb8, 0xb4, 0xac, 0xac, 0xac, 0xaa, 0xaa, 0xa3, 0x9d, 0x99, 0x99,
-    0x99, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x90, 0x94, 0x90, 0x90, 0x90,
-    0x94, 0x90, 0x90, 0x90, 0x90, 0x8a, 0x89, 0x8a, 0x90, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x88, 0x89, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x82, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x89, 0x88, 0x88, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x78,
-    0xc3, 0xe5, 0xea, 0xea, 0xe2, 0xe2, 0xea, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf6, 0xec, 0xec, 0xf6, 0xf6, 0xea, 0xea, 0xf6, 0xf4, 0xf4, 0xf4, 0xec,
-    0xe3, 0xea, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2,
-    0xe1, 0xe1, 0xe1, 0xe1, 0xea, 0xf9, 0xfc, 0xfa, 0xea, 0xe1, 0xd0, 0xd0,
-    0xe1, 0xe1, 0xe1, 0xd0, 0xdd, 0xe1, 0xd0, 0xc6, 0xd0, 0xef, 0xfa, 0xe3,
-    0xe1, 0xe1, 0xe1, 0xe1, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xe1, 0xe1,
-    0xe1, 0xe1, 0xdd, 0xd0, 0xd0, 0xd0, 0xd6, 0xe1, 0xea, 0xea, 0xea, 0xea,
-    0xe8, 0xef, 0xea, 0xe8, 0xe8, 0xea, 0xea, 0xea, 0xea, 0xf4, 0xf6, 0xf4,
-    0xf4, 0xf4, 0xf4, 0xf4, 0xec, 0x9a, 0x7c, 0xa0, 0xc3, 0xe4, 0xed, 0xeb,
-    0xe7, 0xc8, 0xc8, 0xa0, 0x99, 0xa3, 0xa7, 0xa9, 0xb3, 0xb1, 0xb3, 0xb3,
-    0xc1, 0xbf, 0xcb, 0xcb, 0xcb, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xde,
-    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe9,
-    0x75, 0x71, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x7a, 0x7a, 0x7a,
-    0x7a, 0x78, 0x78, 0x76, 0x7a, 0x7b, 0x71, 0x7a, 0x76, 0x7a, 0x7a, 0x76,
-    0x76, 0x78, 0x78, 0x78, 0x78, 0x7a, 0x7a, 0x7d, 0x7a, 0x7d, 0x7d, 0x78,
-    0x78, 0x7d, 0x7d, 0x7d, 0x7a, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x76, 0x78,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x7d, 0x7d, 0x81,
-    0x74, 0x46, 0x26, 0x0a, 0x01, 0x03, 0x0e, 0x1a, 0x26, 0x2c, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x25, 0x25, 0x25, 0x26, 0x25, 0x1f,
-    0x25, 0x25, 0x1f, 0x1f, 0x1a, 0x19, 0x0e, 0x16, 0x26, 0x4e, 0x90, 0xbf,
-    0xd8, 0xd8, 0xd8, 0xcc, 0xcc, 0xbf, 0xbf, 0xb8, 0xb8, 0xb8, 0xac, 0xaa,
-    0xa9, 0xa9, 0x9f, 0x99, 0x99, 0x9f, 0x99, 0x97, 0x97, 0x97, 0x94, 0x90,
-    0x94, 0x90, 0x94, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x89, 0x8a, 0x89, 0x89, 0x8a, 0x89, 0x89, 0x8a, 0x8a, 0x89, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x82, 0x82,
-    0x88, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x78, 0xa0, 0xd9, 0xea, 0xea,
-    0xe2, 0xd6, 0xe2, 0xe8, 0xf0, 0xf0, 0xf4, 0xf6, 0xf8, 0xfa, 0xf6, 0xf4,
-    0xf6, 0xea, 0xea, 0xec, 0xe2, 0xe2, 0xe2, 0xea, 0xe2, 0xe3, 0xe1, 0xe1,
-    0xdd, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xd6, 0xd6, 0xe1, 0xe1, 0xe1, 0xd6,
-    0xec, 0xec, 0xe1, 0xe1, 0xea, 0xe1, 0xd0, 0xd0, 0xd0, 0xe1, 0xe1, 0xe3,
-    0xe6, 0xe1, 0xd0, 0xc6, 0xe3, 0xf2, 0xec, 0xe1, 0xdd, 0xdd, 0xdd, 0xe1,
-    0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xdd, 0xe1, 0xe1, 0xdd, 0xdd, 0xdd, 0xd0,
-    0xd0, 0xd6, 0xd6, 0xe2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea,
-    0xe2, 0xe2, 0xe2, 0xea, 0xf6, 0xf6, 0xea, 0xe8, 0xea, 0xf4, 0xf4, 0xf4,
-    0xc7, 0x87, 0xc2, 0xfd, 0xfd, 0xfc, 0xee, 0xd4, 0xd4, 0xeb, 0xeb, 0xa0,
-    0x81, 0x88, 0x91, 0x91, 0x94, 0x99, 0xa3, 0xa9, 0xa9, 0xa9, 0xb1, 0xb3,
-    0xb1, 0xb3, 0xb1, 0xbf, 0xbf, 0xbf, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb,
-    0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0x74, 0x71, 0x75, 0x75,
-    0x75, 0x6f, 0x75, 0x75, 0x75, 0x75, 0x7b, 0x7b, 0x7a, 0x7a, 0x78, 0x76,
-    0x75, 0x75, 0x75, 0x75, 0x76, 0x78, 0x78, 0x78, 0x78, 0x7a, 0x78, 0x78,
-    0x76, 0x7a, 0x78, 0x78, 0x7a, 0x7a, 0x78, 0x7d, 0x78, 0x78, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x76, 0x76,
-    0x76, 0x78, 0x78, 0x78, 0x76, 0x76, 0x7d, 0x81, 0x71, 0x43, 0x26, 0x0a,
-    0x01, 0x05, 0x0e, 0x1a, 0x26, 0x29, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x2c, 0x2c, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x1f, 0x1e,
-    0x1a, 0x0e, 0x19, 0x28, 0x5b, 0xa1, 0xcc, 0xd8, 0xd8, 0xd8, 0xcc, 0xcc,
-    0xcc, 0xbf, 0xb8, 0xb8, 0xb8, 0xaa, 0xaa, 0xa9, 0xa3, 0xa3, 0x99, 0x99,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x94, 0x90, 0x94, 0x94, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x8a, 0x8a, 0x8a, 0x89, 0x89, 0x8a, 0x8a, 0x89,
-    0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x8a,
-    0x82, 0x88, 0x88, 0x82, 0x8a, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0xbc, 0xe5, 0xea, 0xea, 0xe2, 0xd6, 0xe2,
-    0xf0, 0xf0, 0xf4, 0xf4, 0xf6, 0xf6, 0xf7, 0xec, 0xf4, 0xf4, 0xea, 0xe2,
-    0xe3, 0xe3, 0xe2, 0xe1, 0xdd, 0xe3, 0xdd, 0xdd, 0xd0, 0xdd, 0xe1, 0xe1,
-    0xe1, 0xe1, 0xd0, 0xd6, 0xd6, 0xe1, 0xe1, 0xdd, 0xdd, 0xdd, 0xe1, 0xdd,
-    0xdd, 0xe1, 0xd0, 0xd0, 0xd0, 0xe1, 0xec, 0xf8, 0xec, 0xdd, 0xd0, 0xdd,
-    0xe3, 0xe3, 0xdd, 0xd0, 0xcf, 0xcf, 0xe1, 0xec, 0xdd, 0xd0, 0xd0, 0xd0,
-    0xd0, 0xdd, 0xe1, 0xe1, 0xcf, 0xdd, 0xd0, 0xd0, 0xd0, 0xd6, 0xe2, 0xea,
-    0xe1, 0xe1, 0xe1, 0xea, 0xec, 0xea, 0xe2, 0xe2, 0xe2, 0xe2, 0xea, 0xf6,
-    0xec, 0xf4, 0xea, 0xe8, 0xe8, 0xec, 0xf7, 0xf4, 0xe5, 0xe6, 0xf6, 0xf6,
-    0xf6, 0xf6, 0xf7, 0xef, 0xeb, 0xfd, 0xed, 0x86, 0x6a, 0x6e, 0x75, 0x76,
-    0x7d, 0x81, 0x88, 0x88, 0x91, 0x91, 0x91, 0x99, 0x99, 0xa3, 0xa3, 0xa9,
-    0xa7, 0xa9, 0xb3, 0xb1, 0xb1, 0xb3, 0xb1, 0xb3, 0xb3, 0xb3, 0xc1, 0xc1,
-    0xc1, 0xc1, 0xc1, 0xc1, 0x6c, 0x6c, 0x75, 0x75, 0x75, 0x75, 0x74, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x78, 0x7a, 0x7b, 0x6f, 0x74, 0x75,
-    0x75, 0x75, 0x78, 0x78, 0x78, 0x78, 0x76, 0x76, 0x76, 0x7d, 0x7d, 0x78,
-    0x7a, 0x7a, 0x7d, 0x7d, 0x78, 0x78, 0x7d, 0x7d, 0x7d, 0x78, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x78, 0x78,
-    0x76, 0x76, 0x7d, 0x81, 0x6f, 0x46, 0x26, 0x0a, 0x05, 0x05, 0x0e, 0x1a,
-    0x25, 0x29, 0x2c, 0x2c, 0x2c, 0x2a, 0x2a, 0x2a, 0x2c, 0x2c, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x2a, 0x2a, 0x2c, 0x2c, 0x1f, 0x1a, 0x0e, 0x19, 0x2f, 0x66,
-    0xac, 0xcc, 0xd8, 0xd8, 0xd8, 0xcc, 0xcc, 0xbf, 0xb4, 0xb8, 0xb8, 0xaa,
-    0xaa, 0xaa, 0xa7, 0xa3, 0xa3, 0x99, 0x99, 0x99, 0x9d, 0x97, 0x97, 0x94,
-    0x90, 0x90, 0x94, 0x94, 0x94, 0x90, 0x90, 0x90, 0x94, 0x90, 0x90, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x82, 0x82, 0x8a, 0x89, 0x82, 0x8a, 0x8a, 0x82, 0x82, 0x82, 0x89,
-    0x82, 0x82, 0x82, 0x82, 0x8a, 0x82, 0x89, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x96, 0xcd, 0xea, 0xea, 0xea, 0xe3, 0xe3, 0xea, 0xe8, 0xe8, 0xea,
-    0xea, 0xf4, 0xec, 0xec, 0xea, 0xf4, 0xea, 0xe3, 0xdd, 0xd6, 0xd6, 0xd0,
-    0xd0, 0xd0, 0xdd, 0xdd, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xdd, 0xdd, 0xd6,
-    0xd6, 0xd0, 0xdd, 0xdd, 0xcf, 0xd0, 0xdd, 0xcf, 0xcf, 0xd0, 0xd0, 0xd0,
-    0xdd, 0xe3, 0xec, 0xe2, 0xd0, 0xd0, 0xd0, 0xdd, 0xdd, 0xcf, 0xc6, 0xcf,
-    0xcf, 0xcf, 0xdd, 0xe1, 0xdd, 0xd0, 0xd0, 0xcf, 0xd0, 0xe1, 0xe1, 0xcf,
-    0xcf, 0xdd, 0xcf, 0xd0, 0xd0, 0xe6, 0xf9, 0xef, 0xe1, 0xe1, 0xe1, 0xea,
-    0xea, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xf4, 0xf4, 0xea, 0xea, 0xe8, 0xe8,
-    0xf0, 0xf8, 0xf8, 0xea, 0xec, 0xf4, 0xf4, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6,
-    0xf6, 0xfa, 0xdc, 0x4f, 0x53, 0x56, 0x56, 0x5f, 0x5f, 0x63, 0x6a, 0x6c,
-    0x75, 0x75, 0x76, 0x81, 0x81, 0x88, 0x88, 0x91, 0x91, 0x91, 0x91, 0x97,
-    0x99, 0x9d, 0x99, 0xa3, 0xa3, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9,
-    0x6c, 0x74, 0x75, 0x75, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x76,
-    0x76, 0x75, 0x78, 0x78, 0x75, 0x6f, 0x75, 0x7b, 0x78, 0x76, 0x7a, 0x76,
-    0x7a, 0x76, 0x76, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x78, 0x7d, 0x7d, 0x78,
-    0x84, 0x81, 0x82, 0x78, 0x78, 0x78, 0x78, 0x7d, 0x7d, 0x78, 0x78, 0x7d,
-    0x78, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x7d, 0x81,
-    0x6f, 0x46, 0x26, 0x0a, 0x01, 0x03, 0x0e, 0x1f, 0x2c, 0x2c, 0x30, 0x31,
-    0x30, 0x2a, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x2a, 0x2c, 0x31, 0x31,
-    0x2c, 0x25, 0x1a, 0x0e, 0x19, 0x2d, 0x71, 0xac, 0xcc, 0xdf, 0xd8, 0xcc,
-    0xcc, 0xbf, 0xbf, 0xb4, 0xb4, 0xb8, 0xac, 0xaa, 0xa7, 0xaa, 0xa3, 0x99,
-    0x99, 0x99, 0x9d, 0x97, 0x94, 0x97, 0x97, 0x94, 0x90, 0x90, 0x94, 0x94,
-    0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x8a, 0x8a, 0x89, 0x89, 0x8a, 0x89,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x82,
-    0x82, 0x82, 0x8a, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xc3,
-    0xe4, 0xe4, 0xe4, 0xbe, 0x96, 0x82, 0x89, 0x82, 0x89, 0x96, 0xf5, 0xf9,
-    0xf9, 0xfc, 0xf9, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xea, 0xe2, 0xea, 0xea,
-    0xea, 0xea, 0xea, 0xd6, 0xd6, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xd0, 0xdd,
-    0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xc9, 0xc9, 0xd0, 0xcf,
-    0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xc6, 0xcf, 0xcf, 0xdd, 0xdd, 0xd0, 0xc6,
-    0xc6, 0xd0, 0xdd, 0xdd, 0xc6, 0xbd, 0xc6, 0xc6, 0xc6, 0xcf, 0xfc, 0xf2,
-    0xdd, 0xd0, 0xd0, 0xc6, 0xd0, 0xdd, 0xdd, 0xcf, 0xcf, 0xdd, 0xdd, 0xc6,
-    0xd6, 0xef, 0xf7, 0xef, 0xe6, 0xe1, 0xea, 0xe1, 0xe1, 0xe2, 0xea, 0xe2,
-    0xe2, 0xea, 0xf4, 0xea, 0xea, 0xea, 0xe8, 0xe8, 0xf6, 0xf8, 0xef, 0xea,
-    0xf4, 0xf4, 0xf4, 0xf4, 0xf6, 0xef, 0xef, 0xef, 0xec, 0xf7, 0x70, 0x37,
-    0x37, 0x3e, 0x3e, 0x3f, 0x3f, 0x3f, 0x3f, 0x41, 0x49, 0x4a, 0x56, 0x5f,
-    0x68, 0x6c, 0x6e, 0x75, 0x74, 0x76, 0x7d, 0x81, 0x81, 0x81, 0x88, 0x88,
-    0x88, 0x88, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x75, 0x74, 0x75, 0x6f,
-    0x74, 0x75, 0x75, 0x76, 0x75, 0x75, 0x75, 0x76, 0x76, 0x76, 0x76, 0x78,
-    0x76, 0x75, 0x6f, 0x75, 0x7a, 0x76, 0x76, 0x7a, 0x7a, 0x76, 0x76, 0x7d,
-    0x78, 0x78, 0x78, 0x7d, 0x7a, 0x78, 0x7d, 0x7d, 0x84, 0x78, 0x78, 0x81,
-    0x82, 0x81, 0x81, 0x78, 0x7d, 0x7d, 0x78, 0x7d, 0x78, 0x78, 0x76, 0x7a,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x7d, 0x7d, 0x81, 0x6f, 0x46, 0x1e, 0x0a,
-    0x00, 0x05, 0x0e, 0x1e, 0x2c, 0x2c, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31,
-    0x31, 0x36, 0x36, 0x30, 0x31, 0x31, 0x31, 0x30, 0x2c, 0x1e, 0x16, 0x19,
-    0x34, 0x71, 0xb8, 0xcc, 0xd8, 0xd8, 0xcc, 0xcc, 0xbf, 0xb4, 0xb4, 0xb4,
-    0xac, 0xac, 0xac, 0xa9, 0xa3, 0xa3, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x90, 0x94, 0x90, 0x90, 0x90, 0x90, 0x8a, 0x90, 0x90, 0x90,
-    0x8a, 0x8a, 0x89, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x88, 0x8a,
-    0x8a, 0x88, 0x8a, 0x8a, 0x8a, 0x82, 0x82, 0x89, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xdc, 0xfa, 0xfd, 0xfe, 0xfe,
-    0xfb, 0xda, 0xbe, 0xda, 0xe4, 0xed, 0xf6, 0xf6, 0xf9, 0xf7, 0xea, 0xea,
-    0xe2, 0xe2, 0xea, 0xea, 0xea, 0xea, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
-    0xd6, 0xdd, 0xd0, 0xd0, 0xd0, 0xcf, 0xcf, 0xd0, 0xdd, 0xd0, 0xcf, 0xd0,
-    0xd0, 0xd0, 0xcf, 0xcf, 0xc6, 0xc6, 0xc6, 0xcf, 0xc6, 0xcf, 0xcf, 0xcf,
-    0xcf, 0xc6, 0xc6, 0xd0, 0xcf, 0xc6, 0xc6, 0xc6, 0xc0, 0xcf, 0xcf, 0xc5,
-    0xbd, 0xbd, 0xc6, 0xc6, 0xc6, 0xdd, 0xef, 0xf7, 0xe6, 0xc6, 0xc6, 0xc6,
-    0xd0, 0xdd, 0xd0, 0xd0, 0xcf, 0xcf, 0xd0, 0xc6, 0xe3, 0xef, 0xec, 0xea,
-    0xe3, 0xe1, 0xe1, 0xe1, 0xdd, 0xea, 0xef, 0xec, 0xe1, 0xe8, 0xea, 0xea,
-    0xea, 0xe8, 0xe8, 0xf4, 0xf6, 0xf6, 0xf4, 0xea, 0xf4, 0xf4, 0xf4, 0xf4,
-    0xec, 0xef, 0xec, 0xec, 0xe5, 0xec, 0x39, 0x26, 0x26, 0x26, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x29, 0x29, 0x31, 0x31, 0x3e, 0x3f, 0x41, 0x49, 0x4a,
-    0x53, 0x56, 0x5f, 0x63, 0x6a, 0x6a, 0x6e, 0x6e, 0x6c, 0x74, 0x75, 0x75,
-    0x75, 0x76, 0x78, 0x78, 0x75, 0x74, 0x6f, 0x71, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x78, 0x78, 0x78, 0x78, 0x7a, 0x7a, 0x71, 0x6f, 0x75,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x76, 0x7a, 0x78, 0x78, 0x78, 0x82,
-    0x7d, 0x7a, 0x7a, 0x78, 0x82, 0x81, 0x81, 0x7d, 0x7a, 0x81, 0x81, 0x78,
-    0x7a, 0x7a, 0x7d, 0x7d, 0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x76, 0x78,
-    0x76, 0x7d, 0x84, 0x81, 0x71, 0x46, 0x1e, 0x05, 0x05, 0x03, 0x0c, 0x1f,
-    0x2c, 0x2c, 0x30, 0x36, 0x36, 0x31, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-    0x36, 0x37, 0x31, 0x2c, 0x1f, 0x1a, 0x19, 0x34, 0x7a, 0xb8, 0xcc, 0xd8,
-    0xd8, 0xcc, 0xcb, 0xbf, 0xb8, 0xb8, 0xb4, 0xac, 0xac, 0xa9, 0xa9, 0xa3,
-    0x99, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x90, 0x94, 0x90, 0x90, 0x94,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x94, 0x90, 0x8a, 0x8a, 0x89, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x89, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x82, 0x8a,
-    0x8a, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0xc2, 0xeb, 0xed, 0xfd, 0xfe, 0xfe, 0xfd, 0xfd, 0xfc,
-    0xf8, 0xef, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xe2, 0xe2, 0xe2, 0xd6,
-    0xe2, 0xe2, 0xe2, 0xd6, 0xe3, 0xe1, 0xe1, 0xe2, 0xd0, 0xd0, 0xd0, 0xd0,
-    0xd0, 0xc6, 0xc6, 0xc6, 0xd0, 0xdd, 0xcf, 0xc6, 0xc6, 0xc6, 0xc6, 0xcf,
-    0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc0, 0xc6, 0xc6,
-    0xc5, 0xc5, 0xc6, 0xc0, 0xc6, 0xcf, 0xc5, 0xbd, 0xbd, 0xbd, 0xbd, 0xc6,
-    0xc6, 0xd0, 0xe1, 0xe1, 0xdd, 0xcf, 0xc6, 0xcf, 0xcf, 0xcf, 0xcf, 0xc6,
-    0xcf, 0xcf, 0xc6, 0xd5, 0xec, 0xe3, 0xe3, 0xd6, 0xe1, 0xe1, 0xe1, 0xdd,
-    0xea, 0xea, 0xec, 0xec, 0xe2, 0xea, 0xea, 0xea, 0xe2, 0xe2, 0xe2, 0xf4,
-    0xec, 0xf4, 0xea, 0xea, 0xf4, 0xf4, 0xec, 0xec, 0xec, 0xec, 0xec, 0xe5,
-    0xef, 0xec, 0x24, 0x16, 0x16, 0x16, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x1a, 0x1e, 0x1f, 0x25, 0x29, 0x31, 0x31, 0x37, 0x37, 0x3f, 0x3f, 0x41,
-    0x4a, 0x53, 0x56, 0x56, 0x56, 0x5f, 0x5f, 0x5f, 0x63, 0x63, 0x63, 0x6a,
-    0x75, 0x74, 0x6f, 0x71, 0x75, 0x75, 0x75, 0x78, 0x75, 0x76, 0x7a, 0x75,
-    0x78, 0x76, 0x76, 0x7a, 0x7a, 0x71, 0x75, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x76, 0x7d, 0x78, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7a, 0x7a, 0x7a,
-    0x81, 0x81, 0x81, 0x7d, 0x7a, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x76, 0x78, 0x78, 0x76, 0x76, 0x76, 0x76, 0x76, 0x81, 0x81, 0x81,
-    0x71, 0x44, 0x1e, 0x05, 0x01, 0x05, 0x0e, 0x1f, 0x25, 0x2c, 0x31, 0x36,
-    0x36, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x26,
-    0x1a, 0x19, 0x34, 0x7a, 0xb4, 0xd8, 0xd8, 0xd8, 0xcc, 0xbf, 0xbf, 0xb8,
-    0xb4, 0xb8, 0xac, 0xac, 0xa9, 0xa3, 0xa3, 0xa3, 0x9f, 0x99, 0x97, 0x97,
-    0x97, 0x94, 0x97, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89,
-    0x90, 0x90, 0x90, 0x89, 0x8a, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x88, 0x8a, 0x82, 0x82, 0x82, 0x89, 0x82,
-    0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xc2,
-    0xef, 0xeb, 0xed, 0xf5, 0xee, 0xef, 0xef, 0xec, 0xec, 0xea, 0xea, 0xec,
-    0xef, 0xf8, 0xf9, 0xf9, 0xf2, 0xef, 0xe3, 0xd6, 0xd6, 0xd6, 0xd6, 0xd0,
-    0xd0, 0xd6, 0xdd, 0xe2, 0xe1, 0xc6, 0xd5, 0xd0, 0xd0, 0xc6, 0xc6, 0xe6,
-    0xe6, 0xdd, 0xd0, 0xcf, 0xc6, 0xc6, 0xc6, 0xc6, 0xd5, 0xe6, 0xe7, 0xd5,
-    0xc6, 0xc6, 0xc0, 0xc6, 0xc6, 0xaf, 0xc6, 0xc5, 0xbd, 0xbd, 0xc6, 0xc0,
-    0xc5, 0xc5, 0xbd, 0xad, 0xbd, 0xbd, 0xbd, 0xbd, 0xaf, 0xc6, 0xcf, 0xcf,
-    0xdd, 0xe6, 0xd7, 0xc6, 0xcf, 0xcf, 0xc6, 0xcf, 0xcf, 0xc6, 0xc0, 0xe3,
-    0xdd, 0xd0, 0xd0, 0xd0, 0xe1, 0xe1, 0xd0, 0xe1, 0xea, 0xea, 0xec, 0xea,
-    0xea, 0xea, 0xe2, 0xe2, 0xe2, 0xe2, 0xf4, 0xf7, 0xf8, 0xf8, 0xea, 0xea,
-    0xf4, 0xec, 0xec, 0xec, 0xec, 0xea, 0xec, 0xef, 0xef, 0xe5, 0x0f, 0x12,
-    0x12, 0x08, 0x22, 0x22, 0x0a, 0x11, 0x16, 0x16, 0x16, 0x19, 0x1a, 0x1f,
-    0x1f, 0x26, 0x25, 0x29, 0x29, 0x2d, 0x2d, 0x37, 0x37, 0x3e, 0x3d, 0x3f,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x4a, 0x4a, 0x74, 0x75, 0x71, 0x71,
-    0x7b, 0x75, 0x75, 0x75, 0x7b, 0x75, 0x7a, 0x7a, 0x75, 0x78, 0x7a, 0x7a,
-    0x7b, 0x75, 0x75, 0x76, 0x76, 0x76, 0x78, 0x78, 0x78, 0x7a, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x81, 0x82, 0x81, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x78, 0x7d, 0x78, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x7d, 0x81, 0x81, 0x6c, 0x3e, 0x1e, 0x03,
-    0x01, 0x05, 0x0e, 0x1f, 0x25, 0x2c, 0x31, 0x36, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x36, 0x36, 0x36, 0x31, 0x26, 0x1a, 0x19, 0x2d, 0x7a, 0xb4,
-    0xd8, 0xd8, 0xd8, 0xcc, 0xbf, 0xbf, 0xb8, 0xb8, 0xb8, 0xac, 0xa9, 0xa9,
-    0xa3, 0x99, 0x99, 0x9d, 0x9d, 0x97, 0x97, 0x94, 0x90, 0x97, 0x90, 0x90,
-    0x90, 0x94, 0x90, 0x90, 0x90, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x8a, 0x8a,
-    0x8a, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x82, 0x82,
-    0x82, 0x82, 0x8a, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xc3, 0xef, 0xf2, 0xee, 0xee,
-    0xf2, 0xec, 0xef, 0xef, 0xef, 0xec, 0xec, 0xf7, 0xf9, 0xf8, 0xf7, 0xf8,
-    0xf8, 0xf8, 0xf7, 0xec, 0xe3, 0xd6, 0xc6, 0xc6, 0xd0, 0xd0, 0xd0, 0xdd,
-    0xd0, 0xd0, 0xc6, 0xd0, 0xc6, 0xc6, 0xc6, 0xf8, 0xfd, 0xef, 0xdd, 0xcf,
-    0xc6, 0xc0, 0xc6, 0xe3, 0xef, 0xfa, 0xfd, 0xf2, 0xc6, 0xc6, 0xc6, 0xc6,
-    0xc5, 0xaf, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xc5, 0xc5, 0xbd, 0xad, 0xad,
-    0xad, 0xad, 0xad, 0xbd, 0xad, 0xbd, 0xc5, 0xc5, 0xdd, 0xf7, 0xf8, 0xdd,
-    0xcf, 0xc5, 0xc6, 0xcf, 0xcf, 0xc6, 0xcf, 0xdd, 0xd0, 0xc6, 0xc6, 0xdd,
-    0xe1, 0xd0, 0xdd, 0xe1, 0xe1, 0xec, 0xec, 0xe1, 0xea, 0xe2, 0xe2, 0xe2,
-    0xea, 0xec, 0xf8, 0xf7, 0xf6, 0xf4, 0xf6, 0xf4, 0xec, 0xec, 0xf6, 0xec,
-    0xec, 0xec, 0xec, 0xef, 0xf6, 0x61, 0x09, 0x09, 0x09, 0x09, 0x39, 0x8d,
-    0x0b, 0x08, 0x11, 0x16, 0x16, 0x16, 0x16, 0x1e, 0x1e, 0x1f, 0x26, 0x25,
-    0x26, 0x25, 0x29, 0x29, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x31, 0x31, 0x31, 0x37, 0x74, 0x75, 0x74, 0x71, 0x76, 0x75, 0x76, 0x75,
-    0x78, 0x76, 0x76, 0x7a, 0x78, 0x78, 0x78, 0x78, 0x76, 0x75, 0x76, 0x78,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x78, 0x7d, 0x81, 0x82, 0x81, 0x7d, 0x7d, 0x82, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x7d, 0x7d, 0x7d, 0x6a, 0x3d, 0x19, 0x05, 0x05, 0x0a, 0x0c, 0x1f,
-    0x2c, 0x31, 0x31, 0x36, 0x36, 0x36, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x36, 0x2c, 0x19, 0x19, 0x2d, 0x71, 0xb8, 0xd8, 0xd8, 0xd8, 0xcc, 0xc1,
-    0xbf, 0xb4, 0xb8, 0xaa, 0xac, 0xac, 0xa9, 0xa3, 0x99, 0x99, 0x97, 0x97,
-    0x94, 0x94, 0x97, 0x94, 0x94, 0x90, 0x90, 0x90, 0x90, 0x8a, 0x8a, 0x8a,
-    0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x88, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x82, 0x82, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x88, 0x82, 0x82, 0x88, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x81, 0xa5, 0xef, 0xf7, 0xf9, 0xf2, 0xef, 0xef, 0xef, 0xef,
-    0xef, 0xe3, 0xec, 0xec, 0xf6, 0xf4, 0xf4, 0xf4, 0xea, 0xea, 0xea, 0xea,
-    0xea, 0xec, 0xe3, 0xc9, 0xc6, 0xc6, 0xc6, 0xc6, 0xd0, 0xc6, 0xc6, 0xc6,
-    0xcf, 0xc6, 0xc6, 0xe3, 0xef, 0xec, 0xe3, 0xc6, 0xc6, 0xc6, 0xd5, 0xd0,
-    0xe3, 0xe3, 0xd0, 0xe3, 0xc6, 0xec, 0xf2, 0xe7, 0xc0, 0xad, 0xbd, 0xbd,
-    0xbd, 0xad, 0xbd, 0xc5, 0xbd, 0xad, 0xad, 0xad, 0xad, 0xad, 0xbd, 0xbd,
-    0xad, 0xbd, 0xbd, 0xbd, 0xdd, 0xe3, 0xec, 0xe3, 0xc6, 0xbd, 0xc6, 0xcf,
-    0xc5, 0xcf, 0xdd, 0xcf, 0xc6, 0xc6, 0xcf, 0xe1, 0xd0, 0xd0, 0xe1, 0xe1,
-    0xe3, 0xe3, 0xe1, 0xe2, 0xe2, 0xd6, 0xe2, 0xea, 0xec, 0xf6, 0xf6, 0xf6,
-    0xea, 0xf4, 0xf8, 0xf4, 0xf4, 0xf6, 0xf6, 0xf6, 0xf7, 0xfc, 0xfa, 0xf6,
-    0xc7, 0x0f, 0x04, 0x00, 0x01, 0x01, 0x1c, 0xe7, 0x5a, 0x04, 0x12, 0x11,
-    0x11, 0x11, 0x11, 0x16, 0x16, 0x1d, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x26,
-    0x26, 0x1f, 0x1f, 0x1f, 0x1e, 0x1b, 0x1b, 0x1b, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x75, 0x74, 0x75, 0x74, 0x76, 0x76, 0x7a, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x78, 0x78, 0x78, 0x78, 0x76, 0x76, 0x76, 0x78, 0x78, 0x78, 0x78, 0x76,
-    0x7d, 0x7d, 0x7d, 0x7a, 0x7d, 0x7d, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x81,
-    0x82, 0x81, 0x81, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x7d, 0x7d,
-    0x63, 0x37, 0x19, 0x03, 0x05, 0x0a, 0x19, 0x1f, 0x2c, 0x31, 0x37, 0x37,
-    0x3e, 0x36, 0x36, 0x3e, 0x3e, 0x3e, 0x36, 0x36, 0x2c, 0x1b, 0x19, 0x29,
-    0x66, 0xb4, 0xcc, 0xd8, 0xd8, 0xcc, 0xbf, 0xb8, 0xb4, 0xb4, 0xaa, 0xaa,
-    0xac, 0xa3, 0xa3, 0x99, 0x99, 0x9d, 0x9d, 0x97, 0x94, 0x94, 0x90, 0x94,
-    0x94, 0x90, 0x90, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x89, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x88, 0x8a, 0x8a,
-    0x8a, 0x88, 0x88, 0x8a, 0x81, 0x88, 0x8a, 0x88, 0x89, 0x89, 0x82, 0x81,
-    0x82, 0x81, 0x81, 0x88, 0x8a, 0x8a, 0x88, 0x8a, 0x81, 0x82, 0x81, 0x84,
-    0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0xa0,
-    0xe7, 0xe5, 0xef, 0xef, 0xec, 0xef, 0xef, 0xf8, 0xf2, 0xe5, 0xea, 0xec,
-    0xec, 0xec, 0xef, 0xef, 0xef, 0xef, 0xe3, 0xe2, 0xe2, 0xe2, 0xea, 0xe2,
-    0xc6, 0xc6, 0xd5, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xcf, 0xc6, 0xc6,
-    0xd5, 0xe3, 0xdd, 0xc6, 0xc6, 0xc6, 0xc6, 0xc0, 0xc6, 0xbd, 0xad, 0xaf,
-    0xc0, 0xd5, 0xef, 0xe3, 0xc0, 0xad, 0xad, 0xad, 0xad, 0xcf, 0xe3, 0xe3,
-    0xdd, 0xad, 0xad, 0xc0, 0xcf, 0xc6, 0xd7, 0xe7, 0xc0, 0xad, 0xad, 0xbd,
-    0xc6, 0xd0, 0xdd, 0xdd, 0xd5, 0xaf, 0xc6, 0xc6, 0xc6, 0xdd, 0xcf, 0xc6,
-    0xc5, 0xc6, 0xcf, 0xcf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xe1, 0xe1,
-    0xd6, 0xd6, 0xea, 0xea, 0xec, 0xf6, 0xf7, 0xea, 0xea, 0xf4, 0xf4, 0xf4,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf6, 0xf7, 0xe7, 0x24, 0x0b, 0x15, 0x35,
-    0x7e, 0x8d, 0xd4, 0xee, 0xca, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x11, 0x11, 0x11, 0x16, 0x16, 0x16, 0x16, 0x19, 0x16, 0x16, 0x0e, 0x0e,
-    0x07, 0x07, 0x0a, 0x08, 0x0a, 0x07, 0x0e, 0x0e, 0x75, 0x74, 0x75, 0x75,
-    0x75, 0x76, 0x75, 0x76, 0x76, 0x75, 0x75, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x76, 0x76, 0x76, 0x78, 0x78, 0x78, 0x76, 0x76, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7a, 0x78, 0x78, 0x7d, 0x7d, 0x81, 0x82, 0x82, 0x81, 0x78, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x76, 0x7d, 0x7d, 0x7d, 0x78, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x60, 0x34, 0x0c, 0x05,
-    0x05, 0x08, 0x1a, 0x1f, 0x2c, 0x30, 0x37, 0x37, 0x3e, 0x3f, 0x36, 0x36,
-    0x3e, 0x36, 0x37, 0x2c, 0x1f, 0x19, 0x26, 0x66, 0xac, 0xcc, 0xd8, 0xcc,
-    0xcc, 0xcc, 0xbf, 0xb4, 0xb8, 0xac, 0xac, 0xa9, 0xa3, 0x99, 0x99, 0x99,
-    0x9d, 0x97, 0x97, 0x97, 0x94, 0x90, 0x90, 0x90, 0x94, 0x90, 0x90, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x88, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x8a, 0x88, 0x8a, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x81, 0x82,
-    0x82, 0x89, 0x89, 0x82, 0x82, 0x82, 0x82, 0x96, 0xca, 0xc8, 0xe5, 0xec,
-    0xec, 0xef, 0xf8, 0xf8, 0xef, 0xec, 0xe3, 0xec, 0xec, 0xea, 0xe3, 0xef,
-    0xf2, 0xf8, 0xef, 0xef, 0xe3, 0xd0, 0xe1, 0xe2, 0xdd, 0xd0, 0xe6, 0xf2,
-    0xd5, 0xc0, 0xc0, 0xaf, 0xaf, 0xc0, 0xc6, 0xc0, 0xc0, 0xc6, 0xc6, 0xc5,
-    0xad, 0xbd, 0xbd, 0xaf, 0xad, 0xad, 0xad, 0x9b, 0xad, 0xc0, 0xd0, 0xc0,
-    0xdd, 0xec, 0xdd, 0xbd, 0xbd, 0xdd, 0xec, 0xfa, 0xeb, 0xc0, 0xdd, 0xe3,
-    0xef, 0xe6, 0xdd, 0xec, 0xc0, 0xad, 0xad, 0xad, 0xbd, 0xc6, 0xc6, 0xcf,
-    0xc0, 0xaf, 0xdd, 0xdd, 0xcf, 0xcf, 0xcf, 0xc5, 0xc5, 0xc6, 0xcf, 0xdd,
-    0xdd, 0xcf, 0xcf, 0xdd, 0xcf, 0xdd, 0xe1, 0xd0, 0xd6, 0xe1, 0xea, 0xea,
-    0xea, 0xf4, 0xf8, 0xec, 0xea, 0xea, 0xea, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
-    0xf4, 0xec, 0xf4, 0xf2, 0xdc, 0xf5, 0xdc, 0xed, 0xed, 0xee, 0xed, 0xee,
-    0xca, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x08, 0x08, 0x08, 0x08, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03,
-    0x05, 0x05, 0x05, 0x05, 0x75, 0x75, 0x75, 0x75, 0x7a, 0x7a, 0x75, 0x75,
-    0x75, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x7a, 0x7a, 0x78, 0x76, 0x78,
-    0x78, 0x7b, 0x7b, 0x76, 0x7d, 0x78, 0x78, 0x78, 0x7a, 0x7d, 0x7a, 0x7d,
-    0x7d, 0x78, 0x81, 0x82, 0x81, 0x81, 0x78, 0x78, 0x78, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x57, 0x2d, 0x0e, 0x05, 0x05, 0x0a, 0x1a, 0x1f,
-    0x2c, 0x31, 0x31, 0x37, 0x3e, 0x3e, 0x36, 0x36, 0x3e, 0x3e, 0x30, 0x1f,
-    0x19, 0x26, 0x5b, 0xaa, 0xcc, 0xd8, 0xcc, 0xcc, 0xcc, 0xbf, 0xb8, 0xb4,
-    0xaa, 0xac, 0xa1, 0xa3, 0xa1, 0x99, 0x99, 0x9d, 0x97, 0x97, 0x97, 0x90,
-    0x90, 0x94, 0x94, 0x90, 0x94, 0x89, 0x90, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x89, 0x81, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7a,
-    0x7a, 0x82, 0x82, 0x82, 0xa5, 0xba, 0xd7, 0xe5, 0xec, 0xef, 0xef, 0xef,
-    0xef, 0xe5, 0xe3, 0xe2, 0xea, 0xea, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xec,
-    0xe3, 0xd6, 0xd0, 0xd0, 0xd6, 0xe3, 0xd0, 0xe5, 0xe7, 0xdd, 0xb7, 0xaf,
-    0xaf, 0x9e, 0xaf, 0xc0, 0xc0, 0xc0, 0xbd, 0xbd, 0xbd, 0xad, 0xbd, 0xad,
-    0xad, 0x9b, 0x9b, 0x9b, 0xad, 0x8c, 0x8c, 0xad, 0xf2, 0xfc, 0xf2, 0xc6,
-    0xad, 0xc6, 0xef, 0xfa, 0xc0, 0xaf, 0xdd, 0xef, 0xfa, 0xeb, 0xc0, 0xc0,
-    0xad, 0x9b, 0x9b, 0x9b, 0xad, 0xad, 0xbd, 0xc5, 0xad, 0xc6, 0xe1, 0xe1,
-    0xcf, 0xcf, 0xcf, 0xc5, 0xc5, 0xc6, 0xcf, 0xcf, 0xcf, 0xcf, 0xdd, 0xcf,
-    0xcf, 0xd0, 0xc6, 0xd0, 0xe1, 0xe1, 0xe1, 0xe2, 0xea, 0xf4, 0xf8, 0xef,
-    0xea, 0xea, 0xea, 0xe8, 0xe8, 0xea, 0xea, 0xf4, 0xf6, 0xf9, 0xec, 0xf4,
-    0xee, 0xf5, 0xf5, 0xf5, 0xf5, 0xed, 0xed, 0xee, 0x5a, 0x00, 0x00, 0x00,
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03,
-    0x03, 0x03, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x7a, 0x75, 0x75, 0x75, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x76, 0x76, 0x76, 0x76, 0x76, 0x78, 0x78, 0x76, 0x7d, 0x76,
-    0x7d, 0x7a, 0x78, 0x78, 0x7d, 0x7a, 0x7a, 0x7d, 0x7d, 0x7d, 0x7d, 0x81,
-    0x81, 0x7d, 0x81, 0x78, 0x7d, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x78, 0x76, 0x76, 0x7d, 0x7d, 0x7d, 0x76, 0x76, 0x76, 0x7a,
-    0x52, 0x28, 0x07, 0x05, 0x05, 0x0a, 0x19, 0x1f, 0x2c, 0x31, 0x37, 0x37,
-    0x3e, 0x36, 0x3f, 0x3f, 0x3f, 0x31, 0x1f, 0x19, 0x1e, 0x4f, 0xa1, 0xcc,
-    0xd8, 0xd8, 0xcc, 0xcc, 0xbf, 0xb4, 0xb8, 0xaa, 0xaa, 0xa9, 0xa3, 0x9d,
-    0x99, 0x97, 0x97, 0x97, 0x90, 0x94, 0x94, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x88, 0x88, 0x88, 0x8a, 0x8a, 0x88, 0x88, 0x89, 0x82, 0x88,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x8a, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x81,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7a, 0x7a, 0x7a, 0x82, 0x82, 0x84,
-    0x86, 0xa8, 0xc8, 0xe5, 0xe5, 0xef, 0xec, 0xef, 0xec, 0xe3, 0xe3, 0xe2,
-    0xe2, 0xea, 0xea, 0xe2, 0xe3, 0xd6, 0xd6, 0xd6, 0xd6, 0xe3, 0xd6, 0xc9,
-    0xc6, 0xd0, 0xd6, 0xc6, 0xd5, 0xe6, 0xd0, 0xc0, 0xaf, 0x9b, 0x8f, 0xaf,
-    0xbd, 0xbd, 0xbd, 0xad, 0xbd, 0x9b, 0xad, 0xad, 0x9b, 0x8c, 0x9b, 0x9b,
-    0x9b, 0xad, 0xad, 0xc0, 0xeb, 0xee, 0xc6, 0x9b, 0x98, 0x8c, 0xaf, 0x9e,
-    0x79, 0x8c, 0xaf, 0xef, 0xfd, 0xfc, 0xc0, 0x9e, 0xad, 0x9b, 0x8c, 0x9b,
-    0x9b, 0xad, 0xbd, 0xc5, 0xad, 0xcf, 0xe3, 0xe6, 0xd5, 0xcf, 0xc5, 0xc5,
-    0xc5, 0xc6, 0xcf, 0xcf, 0xc6, 0xcf, 0xcf, 0xcf, 0xc6, 0xc0, 0xc6, 0xe1,
-    0xe1, 0xe1, 0xe1, 0xea, 0xea, 0xea, 0xf8, 0xef, 0xe2, 0xe2, 0xe2, 0xe2,
-    0xe2, 0xe2, 0xea, 0xf4, 0xf4, 0xef, 0xec, 0xe2, 0xef, 0xf5, 0xfb, 0xfb,
-    0xf5, 0xed, 0xfc, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x74, 0x76, 0x76, 0x7a, 0x76, 0x78, 0x7a, 0x78, 0x76, 0x7a, 0x76,
-    0x76, 0x76, 0x7a, 0x76, 0x76, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x78,
-    0x7d, 0x7d, 0x7d, 0x82, 0x7a, 0x7d, 0x7d, 0x7d, 0x81, 0x81, 0x7d, 0x7d,
-    0x78, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x76, 0x78, 0x76,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x84, 0x78, 0x71, 0x43, 0x26, 0x0a, 0x01,
-    0x05, 0x0e, 0x1a, 0x26, 0x2c, 0x31, 0x36, 0x36, 0x3e, 0x36, 0x36, 0x36,
-    0x31, 0x26, 0x19, 0x1b, 0x3d, 0x97, 0xbf, 0xd8, 0xd8, 0xcb, 0xcc, 0xbf,
-    0xb4, 0xb4, 0xaa, 0xac, 0xa1, 0xa3, 0x99, 0x9d, 0x9d, 0x97, 0x97, 0x97,
-    0x90, 0x90, 0x94, 0x90, 0x90, 0x90, 0x90, 0x8a, 0x89, 0x89, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x82, 0x88, 0x8a,
-    0x82, 0x8a, 0x89, 0x82, 0x88, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82,
-    0x81, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81,
-    0x82, 0x7a, 0x7a, 0x7a, 0x82, 0x81, 0x7d, 0x81, 0x86, 0xae, 0xc8, 0xd7,
-    0xe5, 0xef, 0xef, 0xef, 0xef, 0xec, 0xe3, 0xe3, 0xe3, 0xe2, 0xe2, 0xe2,
-    0xe2, 0xd6, 0xc9, 0xc9, 0xe5, 0xef, 0xe5, 0xe3, 0xd5, 0xc6, 0xc6, 0xc6,
-    0xc6, 0xd5, 0xd5, 0xd5, 0xc0, 0x9b, 0x98, 0x9e, 0xbd, 0xbd, 0xbd, 0xad,
-    0xad, 0xad, 0x9b, 0x9b, 0x9b, 0xad, 0xc0, 0xcd, 0xbd, 0xad, 0xd5, 0xe6,
-    0x79, 0x79, 0x79, 0x8c, 0xad, 0x9b, 0x79, 0x8c, 0xad, 0xad, 0x9b, 0x8f,
-    0xd4, 0xd9, 0xe7, 0xf2, 0xcf, 0xbd, 0x8c, 0x8c, 0x9b, 0xad, 0xbd, 0xad,
-    0xc5, 0xdd, 0xef, 0xf2, 0xe7, 0xd5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc6,
-    0xdd, 0xec, 0xd0, 0xc0, 0xb7, 0xc6, 0xdd, 0xe1, 0xd0, 0xd0, 0xe1, 0xea,
-    0xea, 0xec, 0xef, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xea, 0xea,
-    0xea, 0xec, 0xe5, 0xe5, 0xeb, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xbc, 0x04,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x75, 0x75, 0x75, 0x75, 0x71, 0x76, 0x76, 0x76,
-    0x76, 0x78, 0x78, 0x78, 0x78, 0x76, 0x76, 0x78, 0x76, 0x7d, 0x7a, 0x76,
-    0x78, 0x76, 0x7d, 0x7a, 0x78, 0x7d, 0x7a, 0x7d, 0x7d, 0x81, 0x81, 0x81,
-    0x7d, 0x7d, 0x7a, 0x81, 0x81, 0x81, 0x7d, 0x7d, 0x76, 0x76, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x76, 0x7d, 0x78, 0x76, 0x81, 0x88, 0x88, 0x84,
-    0x84, 0x81, 0x81, 0x6f, 0x43, 0x1e, 0x03, 0x05, 0x05, 0x0e, 0x1a, 0x26,
-    0x2c, 0x31, 0x37, 0x37, 0x3e, 0x3e, 0x3e, 0x34, 0x26, 0x19, 0x16, 0x34,
-    0x8a, 0xbf, 0xd8, 0xd8, 0xcc, 0xbf, 0xbf, 0xb4, 0xb4, 0xac, 0xa9, 0xa7,
-    0x9d, 0x99, 0x9d, 0x9d, 0x94, 0x94, 0x94, 0x94, 0x90, 0x90, 0x94, 0x90,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x82, 0x88, 0x88, 0x88, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82,
-    0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82,
-    0x82, 0x81, 0x82, 0x82, 0x82, 0x82, 0x7a, 0x7d, 0x7d, 0x82, 0x7a, 0x7a,
-    0x82, 0x82, 0x7d, 0x76, 0x96, 0xd4, 0xc4, 0xd7, 0xe5, 0xf2, 0xf9, 0xfa,
-    0xfc, 0xfc, 0xf9, 0xef, 0xe3, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xd6, 0xf2,
-    0xf8, 0xe3, 0xe3, 0xe2, 0xdd, 0xdd, 0xdd, 0xc6, 0xc0, 0xb7, 0xc6, 0xd5,
-    0xd5, 0xc0, 0x9b, 0x8c, 0x9b, 0xbd, 0xbd, 0xad, 0xad, 0x9b, 0x8c, 0x9b,
-    0xc0, 0xdd, 0xec, 0xf8, 0xee, 0x98, 0x9b, 0x9b, 0x48, 0x6b, 0x9e, 0xad,
-    0xe6, 0xf2, 0xad, 0x7f, 0xc6, 0xdd, 0xc6, 0x6b, 0x79, 0x9b, 0xd5, 0xe5,
-    0xc0, 0xad, 0x8c, 0x8c, 0xc0, 0xc0, 0xbd, 0xbd, 0xc6, 0xec, 0xef, 0xe5,
-    0xe6, 0xe5, 0xc5, 0xc6, 0xc6, 0xc5, 0xbd, 0xc6, 0xea, 0xef, 0xeb, 0xb0,
-    0xc6, 0xcf, 0xcf, 0xc6, 0xc6, 0xdd, 0xe1, 0xea, 0xec, 0xec, 0xe3, 0xd6,
-    0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe3, 0xe5,
-    0xee, 0xee, 0xee, 0xeb, 0xee, 0xed, 0xbc, 0x5a, 0x18, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05,
-    0x75, 0x6f, 0x74, 0x75, 0x71, 0x76, 0x76, 0x78, 0x7b, 0x75, 0x78, 0x78,
-    0x78, 0x76, 0x76, 0x76, 0x76, 0x78, 0x78, 0x78, 0x78, 0x78, 0x7a, 0x76,
-    0x78, 0x7a, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x7d, 0x7d, 0x81,
-    0x81, 0x7d, 0x7d, 0x78, 0x7a, 0x76, 0x7d, 0x7d, 0x7d, 0x7d, 0x76, 0x76,
-    0x78, 0x76, 0x76, 0x76, 0x81, 0x81, 0x7d, 0x76, 0x7d, 0x7d, 0x78, 0x69,
-    0x3c, 0x1e, 0x05, 0x05, 0x05, 0x0e, 0x1a, 0x25, 0x2c, 0x30, 0x37, 0x3e,
-    0x3e, 0x3e, 0x36, 0x2c, 0x1a, 0x0e, 0x28, 0x71, 0xb4, 0xd8, 0xd8, 0xcc,
-    0xcc, 0xbf, 0xb4, 0xb8, 0xac, 0xac, 0xa3, 0xa3, 0x9d, 0x9d, 0x9d, 0x97,
-    0x97, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x8a, 0x82, 0x89,
-    0x82, 0x82, 0x88, 0x82, 0x88, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82,
-    0x81, 0x81, 0x88, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x82, 0x82, 0x82, 0x81,
-    0x78, 0x82, 0x7a, 0x82, 0x7a, 0x7a, 0x7a, 0x7a, 0x82, 0x89, 0x96, 0x86,
-    0xc2, 0xba, 0xc4, 0xd7, 0xd5, 0xe7, 0xeb, 0xef, 0xf2, 0xeb, 0xef, 0xef,
-    0xec, 0xe3, 0xe3, 0xd6, 0xd6, 0xd6, 0xe3, 0xfc, 0xef, 0xc9, 0xd5, 0xc6,
-    0xd0, 0xd0, 0xd0, 0xd0, 0xc6, 0xc6, 0xb7, 0xc0, 0xc6, 0xc6, 0xc0, 0x9b,
-    0x79, 0xad, 0xbd, 0xad, 0x9b, 0x9b, 0x9b, 0xaf, 0xc6, 0xc6, 0xc6, 0xaf,
-    0xc0, 0x6b, 0x33, 0x33, 0x33, 0x98, 0xa4, 0x6b, 0x8f, 0xa4, 0x6b, 0x33,
-    0xaf, 0xef, 0xee, 0x9e, 0x9b, 0xaf, 0x9e, 0xaf, 0x98, 0x8c, 0x79, 0x8c,
-    0xef, 0xf9, 0xe3, 0xc6, 0xcf, 0xdd, 0xe3, 0xd6, 0xd0, 0xcf, 0xc0, 0xf2,
-    0xf9, 0xc0, 0xbd, 0xdd, 0xe1, 0xec, 0xe7, 0xc0, 0xc6, 0xc6, 0xc0, 0xcf,
-    0xe1, 0xe1, 0xe1, 0xea, 0xe3, 0xe3, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xe2,
-    0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xd6, 0xe5, 0xe5, 0xe7, 0xd7, 0xd7, 0xd7,
-    0xee, 0xed, 0xed, 0xdc, 0xca, 0x5a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x74, 0x74, 0x75, 0x75,
-    0x76, 0x75, 0x78, 0x78, 0x78, 0x78, 0x7b, 0x78, 0x76, 0x76, 0x76, 0x76,
-    0x78, 0x76, 0x78, 0x7a, 0x78, 0x78, 0x7a, 0x7d, 0x7d, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x78, 0x7d, 0x81, 0x82, 0x81, 0x81, 0x7d, 0x7d, 0x7d,
-    0x76, 0x76, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x76, 0x78, 0x76, 0x76, 0x78,
-    0x76, 0x76, 0x75, 0x74, 0x76, 0x78, 0x75, 0x69, 0x34, 0x16, 0x05, 0x05,
-    0x0a, 0x0e, 0x1f, 0x25, 0x31, 0x36, 0x37, 0x3e, 0x3e, 0x3e, 0x30, 0x1e,
-    0x0e, 0x1e, 0x5b, 0xac, 0xcc, 0xd8, 0xcc, 0xcc, 0xbf, 0xb4, 0xb4, 0xac,
-    0xac, 0xa3, 0xa3, 0xa1, 0x99, 0x97, 0x97, 0x97, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x89, 0x89, 0x8a,
-    0x8a, 0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x82, 0x82, 0x89, 0x82, 0x82, 0x82,
-    0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x81, 0x81, 0x82, 0x81, 0x88, 0x81,
-    0x81, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82,
-    0x81, 0x82, 0x82, 0x84, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x7d,
-    0x7d, 0x7d, 0x7a, 0x7d, 0x7d, 0x96, 0xc2, 0xca, 0xd9, 0xc8, 0xc4, 0xc4,
-    0xc4, 0xd7, 0xe5, 0xe5, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6,
-    0xd6, 0xd6, 0xe5, 0xef, 0xd6, 0xd5, 0xd5, 0xd5, 0xc6, 0xd0, 0xd0, 0xd0,
-    0xd6, 0xd6, 0xd5, 0xc6, 0xb7, 0xc0, 0xc0, 0xc0, 0x9b, 0x98, 0xad, 0xad,
-    0xc0, 0xe6, 0xf2, 0xeb, 0xad, 0x8c, 0x8c, 0x98, 0x7f, 0x33, 0x33, 0x48,
-    0x33, 0x6b, 0x33, 0x27, 0x27, 0x33, 0x48, 0x33, 0x3b, 0xae, 0xee, 0xa4,
-    0x8f, 0x6b, 0x33, 0x5d, 0x64, 0x7f, 0x9b, 0x8f, 0xe5, 0xec, 0xe3, 0xc0,
-    0xc6, 0xd5, 0xc6, 0xc6, 0xc6, 0xcf, 0xad, 0xe1, 0xea, 0xdd, 0xc6, 0xdd,
-    0xe1, 0xe3, 0xe5, 0xc0, 0xaf, 0xaf, 0xd0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe3,
-    0xe3, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
-    0xd6, 0xe3, 0xe5, 0xd9, 0xd7, 0xd7, 0xeb, 0xed, 0xfe, 0xfb, 0xed, 0xed,
-    0xed, 0xca, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x00, 0x01,
-    0x01, 0x00, 0x00, 0x01, 0x74, 0x75, 0x75, 0x75, 0x75, 0x7a, 0x76, 0x75,
-    0x78, 0x7a, 0x76, 0x78, 0x78, 0x76, 0x7a, 0x76, 0x76, 0x76, 0x7a, 0x7a,
-    0x7d, 0x7a, 0x7a, 0x7d, 0x7d, 0x78, 0x81, 0x81, 0x81, 0x82, 0x81, 0x7d,
-    0x7d, 0x81, 0x81, 0x7d, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x78, 0x78, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x74,
-    0x74, 0x74, 0x75, 0x60, 0x30, 0x16, 0x05, 0x05, 0x0a, 0x19, 0x1f, 0x2c,
-    0x2a, 0x31, 0x37, 0x3e, 0x36, 0x31, 0x1f, 0x16, 0x0c, 0x34, 0x90, 0xcb,
-    0xd8, 0xcc, 0xcc, 0xbf, 0xb4, 0xb4, 0xa9, 0xa9, 0xa3, 0xa3, 0x9d, 0x9d,
-    0x9d, 0x97, 0x90, 0x94, 0x90, 0x90, 0x90, 0x90, 0x8a, 0x8a, 0x91, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x82, 0x88, 0x82, 0x8a, 0x8a, 0x8a,
-    0x82, 0x89, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82, 0x89, 0x82, 0x81, 0x82, 0x81,
-    0x81, 0x82, 0x81, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x7a, 0x7d, 0x7a, 0x7a, 0x7a,
-    0x7d, 0x85, 0xdc, 0xee, 0xd9, 0xd7, 0xd7, 0xd7, 0xc4, 0xc9, 0xe5, 0xe6,
-    0xe5, 0xd5, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xd6, 0xd6, 0xd5, 0xc9,
-    0xe3, 0xd6, 0xd6, 0xd5, 0xc6, 0xc6, 0xc6, 0xd0, 0xd0, 0xd0, 0xc9, 0xc6,
-    0xc6, 0xaf, 0xaf, 0xaf, 0xaf, 0x9b, 0x9b, 0xc0, 0xe6, 0xf2, 0xfc, 0xe7,
-    0x8c, 0x79, 0x5d, 0x48, 0x48, 0x48, 0x6b, 0xc0, 0x64, 0x27, 0x27, 0x48,
-    0x33, 0xa4, 0x9e, 0x48, 0x40, 0x33, 0x40, 0x2e, 0x40, 0x2e, 0x27, 0x3b,
-    0xd4, 0xf2, 0xc6, 0x9e, 0xa2, 0xdd, 0xc6, 0xcf, 0xc5, 0xc5, 0xbd, 0xbd,
-    0xc5, 0xc5, 0x9b, 0xc5, 0xdd, 0xdd, 0xc6, 0xcf, 0xdd, 0xdd, 0xd0, 0xc0,
-    0xaf, 0xcf, 0xe1, 0xe3, 0xe7, 0xd9, 0xe3, 0xe1, 0xdd, 0xd0, 0xc6, 0xc9,
-    0xc9, 0xd6, 0xe2, 0xea, 0xea, 0xe2, 0xe2, 0xe3, 0xd6, 0xd6, 0xd7, 0xd9,
-    0xd9, 0xee, 0xfd, 0xfb, 0xfb, 0xfb, 0xd4, 0x7e, 0x87, 0xbc, 0x5a, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x05, 0x03,
-    0x74, 0x74, 0x75, 0x75, 0x75, 0x7b, 0x76, 0x75, 0x78, 0x75, 0x78, 0x78,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x78, 0x7a, 0x7a, 0x7d, 0x7d, 0x7d, 0x76,
-    0x7a, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x76,
-    0x76, 0x76, 0x76, 0x74, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x6e, 0x4e,
-    0x2f, 0x0e, 0x05, 0x05, 0x0a, 0x19, 0x1f, 0x25, 0x31, 0x31, 0x37, 0x3e,
-    0x37, 0x2c, 0x1a, 0x0e, 0x26, 0x71, 0xb4, 0xd8, 0xcc, 0xcc, 0xbf, 0xb4,
-    0xb4, 0xac, 0xa9, 0xa9, 0xa3, 0x99, 0x99, 0x94, 0x94, 0x90, 0x94, 0x94,
-    0x94, 0x90, 0x90, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x8a,
-    0x82, 0x88, 0x8a, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81,
-    0x82, 0x81, 0x81, 0x81, 0x82, 0x89, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81,
-    0x81, 0x82, 0x89, 0x89, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x82,
-    0x81, 0x81, 0x82, 0x81, 0x81, 0x82, 0x7a, 0x7d, 0x7d, 0x82, 0x82, 0x81,
-    0x7d, 0x7d, 0x7d, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x76, 0x7a, 0xc2, 0xeb,
-    0xd4, 0xd9, 0xd7, 0xd7, 0xd7, 0xc8, 0xc8, 0xe5, 0xe3, 0xd6, 0xc9, 0xc4,
-    0xc4, 0xc4, 0xb7, 0xb7, 0xc4, 0xc9, 0xd5, 0xc9, 0xe5, 0xe3, 0xd6, 0xd6,
-    0xd5, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xd5, 0xd0, 0xc6, 0xaf, 0xb7,
-    0xc0, 0xad, 0x9b, 0xc0, 0xc6, 0xd5, 0xe5, 0xc0, 0x79, 0x79, 0x79, 0x9b,
-    0xa4, 0x64, 0x33, 0x64, 0x40, 0x2e, 0x3b, 0x64, 0x33, 0x72, 0x72, 0x73,
-    0x8f, 0x2e, 0x54, 0x8f, 0x5d, 0x48, 0x33, 0x54, 0xd7, 0xc6, 0x9b, 0x79,
-    0x98, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xc5, 0xbd, 0x8c, 0xc5,
-    0xcf, 0xdd, 0xcf, 0xcf, 0xdd, 0xcf, 0xd5, 0xc0, 0xcf, 0xdd, 0xdd, 0xef,
-    0xef, 0xe6, 0xe5, 0xdd, 0xc6, 0xb7, 0xc6, 0xc9, 0xc9, 0xe2, 0xea, 0xf4,
-    0xf4, 0xf6, 0xef, 0xef, 0xef, 0xe5, 0xe6, 0xf2, 0xeb, 0xfa, 0xeb, 0xeb,
-    0xee, 0xca, 0x35, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x02, 0x01, 0x05, 0x0a, 0x07, 0x19, 0x1e, 0x29, 0x71, 0x71, 0x75, 0x71,
-    0x71, 0x75, 0x7a, 0x75, 0x76, 0x75, 0x78, 0x78, 0x7a, 0x78, 0x78, 0x78,
-    0x76, 0x78, 0x78, 0x76, 0x78, 0x81, 0x7a, 0x7d, 0x78, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x76, 0x7d, 0x76, 0x78, 0x78, 0x7d, 0x7d, 0x7a, 0x7d, 0x7d, 0x76,
-    0x78, 0x76, 0x76, 0x7a, 0x7d, 0x7d, 0x76, 0x78, 0x76, 0x76, 0x76, 0x76,
-    0x74, 0x74, 0x75, 0x74, 0x74, 0x6c, 0x66, 0x4e, 0x28, 0x0e, 0x05, 0x05,
-    0x0a, 0x19, 0x1f, 0x2c, 0x31, 0x31, 0x37, 0x37, 0x2c, 0x1a, 0x08, 0x19,
-    0x44, 0xa1, 0xcc, 0xcc, 0xcb, 0xbf, 0xb4, 0xb4, 0xaa, 0xa9, 0xa9, 0xa3,
-    0x99, 0x99, 0x97, 0x97, 0x90, 0x94, 0x90, 0x90, 0x94, 0x90, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x88, 0x81, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x89, 0x89, 0x89, 0x82,
-    0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81,
-    0x7d, 0x7a, 0x7d, 0x81, 0x82, 0x7a, 0x82, 0x82, 0x7d, 0x7d, 0x7d, 0x7a,
-    0x7d, 0x7a, 0x7a, 0x7a, 0x76, 0x76, 0xa0, 0xd4, 0xe7, 0xe7, 0xc8, 0xc8,
-    0xc8, 0xc8, 0xc8, 0xd7, 0xd5, 0xd6, 0xd6, 0xd5, 0xc4, 0xb0, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xc4, 0xc4, 0xc9, 0xd6, 0xe3, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5,
-    0xd5, 0xd5, 0xc6, 0xc6, 0xc0, 0xaf, 0xc6, 0xeb, 0xf2, 0xc0, 0xad, 0xc0,
-    0xc0, 0xaf, 0xc0, 0xaf, 0x79, 0x79, 0x8c, 0xc0, 0xd9, 0xae, 0x33, 0x40,
-    0x3b, 0x7f, 0x54, 0x23, 0x23, 0x51, 0x27, 0x61, 0x64, 0x27, 0x40, 0x80,
-    0x64, 0x40, 0x48, 0x54, 0x6b, 0x6b, 0x6b, 0x5d, 0x79, 0x9b, 0xd9, 0xe7,
-    0xbd, 0xad, 0xbd, 0xbd, 0xbd, 0xad, 0x9b, 0xbd, 0xc5, 0xc5, 0xc5, 0xcf,
-    0xc6, 0xc6, 0xc6, 0xcf, 0xd0, 0xd0, 0xe3, 0xe3, 0xd6, 0xd5, 0xdd, 0xc6,
-    0xb7, 0xb7, 0xb7, 0xc9, 0xe2, 0xea, 0xea, 0xea, 0xea, 0xec, 0xf7, 0xf9,
-    0xfa, 0xf8, 0xec, 0xef, 0xef, 0xef, 0xef, 0xe5, 0xec, 0xbb, 0x15, 0x00,
-    0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x04, 0x05, 0x0a, 0x0e, 0x19, 0x1f, 0x29,
-    0x34, 0x43, 0x5b, 0x7b, 0x6f, 0x71, 0x74, 0x71, 0x71, 0x7b, 0x75, 0x75,
-    0x75, 0x75, 0x78, 0x76, 0x76, 0x76, 0x7a, 0x76, 0x76, 0x78, 0x78, 0x7a,
-    0x78, 0x82, 0x7a, 0x7d, 0x78, 0x78, 0x76, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x78, 0x78, 0x83, 0x78, 0x7b, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x7d, 0x76, 0x76, 0x78, 0x76, 0x76, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x6c, 0x6c, 0x66, 0x4e, 0x28, 0x0e, 0x03, 0x03, 0x0a, 0x1a, 0x1f, 0x2c,
-    0x31, 0x31, 0x36, 0x2c, 0x1e, 0x0e, 0x0e, 0x2d, 0x82, 0xbf, 0xcc, 0xcc,
-    0xbf, 0xb4, 0xb8, 0xa9, 0xa9, 0xa9, 0xa3, 0x99, 0x99, 0x97, 0x97, 0x90,
-    0x90, 0x94, 0x90, 0x90, 0x90, 0x90, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x88, 0x8a, 0x8a, 0x82, 0x88, 0x82, 0x81, 0x82, 0x82, 0x8a, 0x8a, 0x8a,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x81, 0x89, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x81, 0x81,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x89, 0x81, 0x7d, 0x7a, 0x82, 0x81,
-    0x7d, 0x7d, 0x7a, 0x7d, 0x7d, 0x7d, 0x7a, 0x7a, 0x76, 0x7d, 0x7d, 0x7a,
-    0x7a, 0x7a, 0x7a, 0xc2, 0xef, 0xf2, 0xe6, 0xd7, 0xc8, 0xc8, 0xc8, 0xc4,
-    0xc4, 0xc9, 0xd6, 0xd6, 0xd5, 0xb7, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2,
-    0xb0, 0xc4, 0xc6, 0xd0, 0xe3, 0xec, 0xf2, 0xf2, 0xe6, 0xd5, 0xc0, 0xaf,
-    0xaf, 0xb0, 0xe7, 0xe7, 0xe6, 0xbd, 0x9b, 0xad, 0xad, 0x9b, 0x79, 0x6b,
-    0x5d, 0x6b, 0x6b, 0x6b, 0x7f, 0x7f, 0x5d, 0xa4, 0x54, 0x27, 0x27, 0x3b,
-    0x2e, 0x40, 0x23, 0x27, 0x40, 0x73, 0x54, 0x8d, 0x92, 0x73, 0x8d, 0xee,
-    0xcd, 0xa4, 0x7f, 0x5d, 0x5d, 0x79, 0xe6, 0xf2, 0xcf, 0xad, 0xad, 0xbd,
-    0xbd, 0x9b, 0xad, 0xad, 0xbd, 0xc5, 0xc5, 0xc5, 0xc5, 0xc6, 0xc6, 0xcf,
-    0xc6, 0xd0, 0xe3, 0xd6, 0xd5, 0xd0, 0xc6, 0xb0, 0xb0, 0xb7, 0xd0, 0xe2,
-    0xe2, 0xe2, 0xe2, 0xe2, 0xea, 0xef, 0xef, 0xf6, 0xf7, 0xef, 0xe5, 0xe5,
-    0xe5, 0xe5, 0xe6, 0xf2, 0xf8, 0xf6, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x04, 0x05, 0x05, 0x0a,
-    0x0e, 0x19, 0x25, 0x2d, 0x3e, 0x52, 0x71, 0x7a, 0x90, 0xa9, 0xb8, 0xc1,
-    0x75, 0x74, 0x75, 0x75, 0x71, 0x75, 0x75, 0x75, 0x75, 0x76, 0x78, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x78, 0x76, 0x76, 0x78, 0x76, 0x7a, 0x82, 0x81, 0x7d,
-    0x76, 0x78, 0x78, 0x78, 0x7d, 0x78, 0x7d, 0x7a, 0x7a, 0x83, 0x83, 0x78,
-    0x7d, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x7a, 0x78, 0x76, 0x76, 0x78,
-    0x76, 0x74, 0x74, 0x74, 0x75, 0x74, 0x75, 0x74, 0x6e, 0x6a, 0x66, 0x52,
-    0x28, 0x0e, 0x05, 0x03, 0x07, 0x1a, 0x1f, 0x29, 0x31, 0x36, 0x30, 0x1f,
-    0x0e, 0x0a, 0x1e, 0x59, 0xac, 0xcc, 0xcc, 0xc1, 0xbf, 0xb8, 0xac, 0xac,
-    0xa9, 0x9f, 0x99, 0x99, 0x97, 0x97, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x82, 0x82, 0x82, 0x88,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x8a, 0x90, 0x8a, 0x82, 0x82, 0x81, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7d,
-    0x7a, 0x7d, 0x7d, 0x81, 0x82, 0x82, 0x7a, 0x7a, 0x7d, 0x7a, 0x7a, 0x7d,
-    0x7d, 0x7d, 0x7a, 0x7d, 0x7a, 0x76, 0x7a, 0x76, 0x7a, 0x7a, 0x7a, 0xa0,
-    0xd9, 0xef, 0xf2, 0xd9, 0xd7, 0xbb, 0xc8, 0xc4, 0xc4, 0xb7, 0xc4, 0xc9,
-    0xd5, 0xd5, 0xc9, 0xc4, 0xb7, 0xb0, 0xa2, 0xa2, 0xa2, 0xa2, 0xb0, 0xb7,
-    0xc6, 0xe3, 0xef, 0xd5, 0xa2, 0x7f, 0x9e, 0x9e, 0x9e, 0xc7, 0xe6, 0xe5,
-    0xc0, 0xad, 0x9b, 0x8c, 0x9b, 0x8c, 0x6b, 0x73, 0xa4, 0x7f, 0x48, 0x33,
-    0x33, 0x40, 0x48, 0x7f, 0x3b, 0x27, 0x40, 0x2e, 0x40, 0x27, 0x15, 0x51,
-    0x54, 0x40, 0xd4, 0xee, 0xc7, 0x7f, 0x80, 0xe6, 0xee, 0xf2, 0xcf, 0xad,
-    0x98, 0x79, 0xc0, 0xd0, 0xc6, 0xc5, 0xbd, 0xad, 0x9b, 0x9b, 0xf2, 0xeb,
-    0xbd, 0xbd, 0xc5, 0xc5, 0xc5, 0xc5, 0xc6, 0xc6, 0xc6, 0xd0, 0xd6, 0xd5,
-    0xd5, 0xc0, 0x9e, 0xa2, 0xb7, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xea,
-    0xec, 0xec, 0xec, 0xec, 0xec, 0xe5, 0xe5, 0xe5, 0xe5, 0xef, 0xf2, 0xf8,
-    0xfc, 0xf7, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x05, 0x05, 0x05, 0x08, 0x16, 0x1a, 0x26, 0x34, 0x44, 0x66, 0x7a, 0x90,
-    0xa3, 0xb8, 0xc1, 0xc1, 0xcb, 0xcc, 0xd3, 0xd3, 0x75, 0x74, 0x75, 0x75,
-    0x74, 0x75, 0x75, 0x76, 0x7b, 0x75, 0x75, 0x78, 0x7a, 0x78, 0x78, 0x78,
-    0x7b, 0x78, 0x78, 0x76, 0x7b, 0x83, 0x82, 0x81, 0x76, 0x78, 0x76, 0x78,
-    0x7d, 0x78, 0x7d, 0x7d, 0x7a, 0x7a, 0x7b, 0x78, 0x78, 0x78, 0x76, 0x78,
-    0x78, 0x76, 0x76, 0x76, 0x78, 0x78, 0x78, 0x75, 0x76, 0x74, 0x75, 0x74,
-    0x74, 0x75, 0x6e, 0x6e, 0x6a, 0x6a, 0x60, 0x46, 0x26, 0x07, 0x05, 0x03,
-    0x07, 0x1a, 0x26, 0x2c, 0x31, 0x36, 0x2c, 0x1a, 0x0a, 0x0e, 0x34, 0x8a,
-    0xbf, 0xcc, 0xbf, 0xbf, 0xb4, 0xac, 0xac, 0xa3, 0xa3, 0x9d, 0x9f, 0x9d,
-    0x94, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x88, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82,
-    0x81, 0x82, 0x8a, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x7a, 0x82, 0x7d, 0x81,
-    0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x82, 0x7d, 0x82, 0x82, 0x7d, 0x7d,
-    0x7d, 0x7a, 0x7a, 0x7d, 0x7d, 0x7d, 0x7a, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7a, 0x7a, 0x76, 0x7a, 0x76, 0x76, 0x76, 0x85, 0xca, 0xe5, 0xeb, 0xd9,
-    0xc8, 0xc8, 0xbb, 0xd7, 0xd7, 0xc9, 0xb0, 0xb0, 0xc9, 0xc9, 0xe3, 0xec,
-    0xe3, 0xe3, 0xd0, 0xd0, 0xc6, 0xc6, 0xb7, 0xb0, 0xa2, 0xb0, 0xb0, 0xb0,
-    0x8f, 0x73, 0x64, 0x73, 0x8f, 0xc0, 0xc6, 0xc0, 0xaf, 0xad, 0x9b, 0x79,
-    0x8c, 0x9b, 0xc0, 0xe7, 0xee, 0xcd, 0x33, 0x2e, 0x48, 0xa4, 0xcd, 0x2e,
-    0x14, 0x3b, 0x3b, 0x15, 0x40, 0x40, 0x3b, 0x27, 0x23, 0x23, 0x72, 0x80,
-    0x73, 0x51, 0x3b, 0x73, 0xc0, 0xdd, 0xc5, 0xad, 0x9b, 0x9b, 0xc0, 0xc6,
-    0xbd, 0xbd, 0xbd, 0xad, 0x8c, 0xad, 0xec, 0xf2, 0xc6, 0xbd, 0xbd, 0xbd,
-    0xbd, 0xc5, 0xdd, 0xe7, 0xc0, 0xd0, 0xd5, 0xc6, 0xc6, 0xb0, 0xb0, 0xc6,
-    0xe1, 0xe2, 0xd6, 0xd6, 0xe2, 0xe2, 0xe2, 0xec, 0xec, 0xec, 0xe5, 0xe5,
-    0xe3, 0xd6, 0xe5, 0xe5, 0xea, 0xef, 0xef, 0xef, 0xf7, 0xef, 0xe6, 0x35,
-    0xbc, 0x7e, 0x00, 0x00, 0x01, 0x05, 0x03, 0x08, 0x16, 0x1e, 0x26, 0x34,
-    0x4e, 0x71, 0x8a, 0x99, 0xac, 0xc1, 0xc1, 0xcc, 0xd8, 0xd8, 0xd3, 0xd3,
-    0xd3, 0xcb, 0xcb, 0xcb, 0x6e, 0x75, 0x75, 0x75, 0x74, 0x74, 0x7a, 0x71,
-    0x75, 0x75, 0x78, 0x78, 0x78, 0x75, 0x78, 0x78, 0x76, 0x7a, 0x78, 0x76,
-    0x78, 0x83, 0x84, 0x84, 0x78, 0x76, 0x78, 0x76, 0x76, 0x76, 0x76, 0x78,
-    0x7d, 0x78, 0x78, 0x78, 0x78, 0x78, 0x76, 0x78, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x78, 0x75, 0x76, 0x75, 0x74, 0x6e, 0x6e, 0x6c, 0x6e, 0x6c, 0x6c,
-    0x6a, 0x69, 0x5b, 0x3c, 0x1e, 0x0a, 0x05, 0x05, 0x07, 0x1a, 0x26, 0x29,
-    0x30, 0x2c, 0x1e, 0x0e, 0x0a, 0x1e, 0x5b, 0xac, 0xcc, 0xcb, 0xbf, 0xb4,
-    0xb8, 0xa7, 0xac, 0xa3, 0x9d, 0x99, 0x9d, 0x97, 0x90, 0x90, 0x90, 0x90,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x8a, 0x82, 0x82,
-    0x88, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x81, 0x82, 0x7a, 0x7d, 0x7d,
-    0x78, 0x7a, 0x81, 0x82, 0x7a, 0x7a, 0x7d, 0x82, 0x81, 0x82, 0x7a, 0x7d,
-    0x7d, 0x81, 0x7a, 0x7d, 0x7a, 0x7d, 0x7d, 0x7d, 0x7a, 0x7a, 0x7d, 0x82,
-    0x7a, 0x7d, 0x7d, 0x7a, 0x7d, 0x76, 0x76, 0x7d, 0x76, 0x76, 0x76, 0x78,
-    0x76, 0x78, 0x7a, 0x76, 0x87, 0xc8, 0xe5, 0xd9, 0xc8, 0xc8, 0xbb, 0xd7,
-    0xd7, 0xe5, 0xd5, 0xe6, 0xe7, 0xe6, 0xe5, 0xe3, 0xd6, 0xd6, 0xd5, 0xc6,
-    0xc6, 0xc6, 0xc6, 0xc6, 0xc0, 0xb0, 0xa6, 0xa6, 0xa2, 0x8f, 0x73, 0x54,
-    0x51, 0x9e, 0xaf, 0x9e, 0xad, 0xad, 0x9b, 0x8c, 0x9b, 0xbd, 0xc0, 0xc0,
-    0xaf, 0x5d, 0x2e, 0x48, 0x5d, 0x7f, 0x51, 0x7f, 0x3b, 0x23, 0x23, 0x32,
-    0x2e, 0x23, 0x40, 0x2e, 0x2e, 0x54, 0x23, 0x4b, 0xd4, 0xaf, 0x7f, 0x64,
-    0x48, 0x9b, 0xad, 0x8c, 0xad, 0xfd, 0xfd, 0xcf, 0xad, 0xad, 0xbd, 0x9b,
-    0x79, 0x8c, 0xd6, 0xd6, 0xd5, 0xbd, 0xbd, 0xbd, 0xbd, 0xd0, 0xe3, 0xf2,
-    0xe5, 0xd0, 0xc6, 0xc6, 0xc6, 0xb7, 0xd0, 0xe1, 0xd6, 0xd6, 0xd6, 0xe2,
-    0xd6, 0xe2, 0xe2, 0xe3, 0xe3, 0xe3, 0xe3, 0xd6, 0xd6, 0xd6, 0xe2, 0xea,
-    0xea, 0xec, 0xec, 0xec, 0xec, 0xe5, 0xeb, 0xfa, 0xee, 0xd4, 0x1c, 0x07,
-    0x16, 0x1e, 0x28, 0x34, 0x4e, 0x71, 0x90, 0xa9, 0xb8, 0xc1, 0xcb, 0xcb,
-    0xd3, 0xd8, 0xd8, 0xcc, 0xcc, 0xcb, 0xc1, 0xbf, 0xc1, 0xc1, 0xb4, 0xb8,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x74, 0x76, 0x75, 0x76, 0x75, 0x75, 0x7a,
-    0x76, 0x78, 0x78, 0x76, 0x76, 0x7d, 0x78, 0x78, 0x76, 0x7d, 0x7a, 0x7d,
-    0x76, 0x76, 0x7a, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x78,
-    0x76, 0x76, 0x78, 0x78, 0x76, 0x76, 0x78, 0x78, 0x78, 0x76, 0x76, 0x74,
-    0x75, 0x75, 0x6e, 0x6e, 0x6e, 0x6e, 0x6c, 0x6c, 0x68, 0x66, 0x57, 0x34,
-    0x16, 0x03, 0x05, 0x03, 0x0e, 0x1a, 0x26, 0x2c, 0x2c, 0x26, 0x1a, 0x0a,
-    0x0e, 0x34, 0x8a, 0xbf, 0xcc, 0xbf, 0xb4, 0xb4, 0xaa, 0xa7, 0xa3, 0x99,
-    0x9d, 0x99, 0x97, 0x94, 0x90, 0x90, 0x90, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x82, 0x8a, 0x82, 0x82, 0x82, 0x84, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x89, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82,
-    0x81, 0x82, 0x7a, 0x82, 0x7d, 0x7d, 0x7a, 0x7a, 0x7d, 0x7d, 0x7a, 0x7a,
-    0x7a, 0x7a, 0x82, 0x7a, 0x7d, 0x7a, 0x7a, 0x7d, 0x7a, 0x82, 0x7a, 0x7a,
-    0x7d, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7d, 0x7d, 0x78, 0x7d, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x7a, 0x7a, 0x76, 0x76, 0x7a, 0x7a, 0x7a, 0x76,
-    0x7c, 0x9a, 0xc7, 0xc8, 0xbb, 0xb9, 0xbb, 0x8e, 0x61, 0xb9, 0xd5, 0xd5,
-    0xe5, 0xd7, 0xd5, 0xd6, 0xd6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc0, 0xc6, 0xc6,
-    0xd5, 0xd5, 0xeb, 0xf9, 0xe5, 0xa2, 0x8f, 0x7f, 0x51, 0x7f, 0x9e, 0x9b,
-    0xad, 0x9b, 0x9b, 0x9e, 0xc0, 0xad, 0x9b, 0x79, 0x5d, 0x48, 0x7f, 0xa4,
-    0x64, 0x48, 0x27, 0x3b, 0x3b, 0x73, 0x51, 0x32, 0x35, 0x24, 0x32, 0x3b,
-    0x4b, 0x61, 0x64, 0xa2, 0xe7, 0xeb, 0xc0, 0x9b, 0x6b, 0x48, 0x6b, 0x79,
-    0x9b, 0xe7, 0xf2, 0xe6, 0xdd, 0xbd, 0xad, 0x9b, 0x79, 0x8c, 0xc0, 0xc6,
-    0xc6, 0xbd, 0xbd, 0xbd, 0xd0, 0xef, 0xe5, 0xe5, 0xd0, 0xc6, 0xc6, 0xc6,
-    0xc6, 0xd0, 0xd0, 0xd0, 0xd6, 0xd6, 0xd6, 0xd6, 0xe2, 0xea, 0xe2, 0xe3,
-    0xe3, 0xe3, 0xd6, 0xd6, 0xd6, 0xe2, 0xea, 0xea, 0xea, 0xea, 0xec, 0xec,
-    0xe5, 0xe7, 0xeb, 0xd9, 0xef, 0xd4, 0x2b, 0x34, 0x4f, 0x71, 0x90, 0xac,
-    0xc1, 0xcb, 0xd8, 0xd3, 0xd8, 0xd8, 0xd3, 0xcb, 0xcb, 0xcb, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xb8, 0xb3, 0xb3, 0xb3, 0xa7, 0xa9, 0x75, 0x75, 0x75, 0x75,
-    0x74, 0x74, 0x75, 0x75, 0x75, 0x76, 0x75, 0x76, 0x75, 0x78, 0x75, 0x76,
-    0x76, 0x76, 0x76, 0x78, 0x78, 0x78, 0x76, 0x7a, 0x76, 0x76, 0x78, 0x76,
-    0x76, 0x76, 0x76, 0x7a, 0x76, 0x7a, 0x76, 0x78, 0x78, 0x78, 0x75, 0x76,
-    0x76, 0x75, 0x75, 0x75, 0x75, 0x76, 0x74, 0x74, 0x74, 0x6e, 0x6c, 0x6e,
-    0x6c, 0x6e, 0x68, 0x6a, 0x66, 0x66, 0x52, 0x2f, 0x0e, 0x03, 0x01, 0x05,
-    0x0e, 0x1a, 0x26, 0x2c, 0x25, 0x1a, 0x0a, 0x0a, 0x1f, 0x5b, 0xac, 0xcc,
-    0xcc, 0xbf, 0xb4, 0xac, 0xa9, 0xa3, 0x99, 0x99, 0x99, 0x99, 0x97, 0x90,
-    0x94, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x82, 0x82, 0x81, 0x82,
-    0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x7a, 0x82, 0x82, 0x82,
-    0x7d, 0x81, 0x82, 0x7a, 0x7d, 0x7d, 0x7d, 0x82, 0x89, 0x7a, 0x7a, 0x7a,
-    0x7d, 0x7a, 0x82, 0x7a, 0x7a, 0x7a, 0x7d, 0x7a, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7a, 0x7a, 0x76, 0x76, 0x76, 0x76, 0x7a, 0x7a, 0x76, 0x76, 0x76, 0x76,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x76, 0x7a, 0x7c, 0x9a, 0xc4,
-    0xc7, 0xb9, 0xb9, 0xa6, 0x8e, 0x8e, 0xa6, 0xd5, 0xd5, 0xc9, 0xc4, 0xc6,
-    0xc6, 0xc6, 0xc0, 0xc6, 0xc6, 0xc0, 0xc6, 0xd5, 0xd5, 0xd7, 0xe7, 0xd5,
-    0xc6, 0xc0, 0xaf, 0x9e, 0x7f, 0x64, 0x9e, 0x9b, 0x9b, 0x9b, 0xaf, 0xd9,
-    0xd7, 0xaf, 0x6b, 0x48, 0x5d, 0x79, 0xc0, 0xe7, 0xa4, 0x8f, 0x40, 0x51,
-    0x3b, 0x51, 0x3b, 0x72, 0x72, 0x4b, 0x4b, 0x8e, 0x4b, 0x40, 0xae, 0xa4,
-    0xe6, 0xf2, 0xd7, 0xaf, 0x9e, 0x8f, 0x6b, 0x79, 0x8c, 0xc6, 0xd5, 0xd5,
-    0xdd, 0xc6, 0xbd, 0x98, 0x6b, 0x79, 0xaf, 0xaf, 0xaf, 0xbd, 0xad, 0xc0,
-    0xe6, 0xe6, 0xe6, 0xe5, 0xd5, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
-    0xc6, 0xd6, 0xd6, 0xe2, 0xe2, 0xe2, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3,
-    0xe2, 0xe2, 0xea, 0xea, 0xea, 0xea, 0xe5, 0xe5, 0xe5, 0xd7, 0xe7, 0xe5,
-    0xe5, 0xd4, 0x85, 0xac, 0xc1, 0xcb, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8,
-    0xd3, 0xcb, 0xc1, 0xbf, 0xc1, 0xb4, 0xb8, 0xb4, 0xb4, 0xb3, 0xa9, 0xa9,
-    0xa9, 0xa9, 0xa7, 0xa3, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x74, 0x71, 0x76, 0x74, 0x75, 0x75, 0x76, 0x76, 0x75, 0x7a, 0x76,
-    0x75, 0x76, 0x7a, 0x7a, 0x75, 0x7a, 0x75, 0x76, 0x76, 0x76, 0x78, 0x7a,
-    0x7a, 0x76, 0x78, 0x78, 0x78, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x74, 0x75, 0x75, 0x6e, 0x6e, 0x6c, 0x6c, 0x6c, 0x6a, 0x68, 0x63,
-    0x63, 0x60, 0x43, 0x26, 0x0a, 0x03, 0x01, 0x05, 0x0e, 0x1a, 0x1f, 0x25,
-    0x1f, 0x0e, 0x0a, 0x0e, 0x34, 0x8a, 0xc1, 0xcc, 0xbf, 0xb4, 0xac, 0xac,
-    0xa3, 0x99, 0x99, 0x97, 0x97, 0x94, 0x94, 0x90, 0x89, 0x89, 0x8a, 0x8a,
-    0x8a, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x82,
-    0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82,
-    0x7d, 0x7d, 0x7a, 0x7d, 0x7a, 0x7a, 0x89, 0x81, 0x7d, 0x7a, 0x7a, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7a, 0x7a, 0x7d, 0x7a, 0x7a, 0x76, 0x7a, 0x7a, 0x7a,
-    0x7a, 0x7a, 0x7d, 0x7a, 0x7a, 0x82, 0x7d, 0x76, 0x7a, 0x7a, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x7a, 0x76, 0x76, 0x76, 0x76, 0x7a, 0x76, 0x7a, 0x71,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x71, 0x74, 0x7c, 0x9a, 0xc7, 0xc4, 0xc4, 0xb9,
-    0xa6, 0x92, 0x92, 0xc4, 0xc0, 0xb7, 0xb0, 0xaf, 0xaf, 0xb7, 0xb7, 0xc0,
-    0xb7, 0xc0, 0xc0, 0xc6, 0xd5, 0xd7, 0xc0, 0xb7, 0xb7, 0xaf, 0xaf, 0xc0,
-    0xaf, 0x9e, 0x9e, 0x9b, 0x9b, 0xaf, 0xc6, 0xd5, 0xd5, 0x9e, 0x48, 0x5d,
-    0x6b, 0x79, 0xad, 0xaf, 0x48, 0x7f, 0x51, 0x64, 0x40, 0x2e, 0x51, 0x72,
-    0x61, 0x61, 0x61, 0x8e, 0x72, 0x8e, 0xcd, 0xc7, 0x9e, 0x9b, 0xaf, 0xe7,
-    0xf2, 0xdd, 0xbd, 0x9b, 0x8c, 0x9b, 0xc0, 0xc0, 0xc6, 0xc6, 0xbd, 0x8c,
-    0x5d, 0x6b, 0xad, 0xad, 0xad, 0xad, 0xad, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5,
-    0xc6, 0xc6, 0xc6, 0xc0, 0xc0, 0xb7, 0xb7, 0xc6, 0xd0, 0xe2, 0xe2, 0xe2,
-    0xe2, 0xe2, 0xe2, 0xe3, 0xe2, 0xe2, 0xe2, 0xea, 0xea, 0xec, 0xe2, 0xe2,
-    0xe2, 0xe2, 0xe3, 0xe5, 0xe5, 0xe6, 0xef, 0xe5, 0xd5, 0xc2, 0xd3, 0xd8,
-    0xd8, 0xd3, 0xd3, 0xd3, 0xcb, 0xcb, 0xc1, 0xbf, 0xbf, 0xb4, 0xb8, 0xb8,
-    0xb3, 0xa7, 0xaa, 0xa7, 0xa9, 0xa9, 0xa3, 0xa3, 0x99, 0x99, 0x99, 0x99,
-    0x6c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74,
-    0x74, 0x75, 0x75, 0x76, 0x74, 0x76, 0x74, 0x74, 0x75, 0x7a, 0x7a, 0x7a,
-    0x75, 0x75, 0x76, 0x75, 0x76, 0x76, 0x75, 0x7a, 0x75, 0x75, 0x76, 0x76,
-    0x76, 0x75, 0x71, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x6e,
-    0x6a, 0x6a, 0x6c, 0x6c, 0x68, 0x6a, 0x68, 0x68, 0x69, 0x57, 0x3c, 0x1e,
-    0x0a, 0x05, 0x02, 0x03, 0x0e, 0x1b, 0x1f, 0x1f, 0x19, 0x0a, 0x08, 0x1e,
-    0x5b, 0xaa, 0xcc, 0xcc, 0xb4, 0xac, 0xac, 0xa9, 0x9f, 0x9d, 0x97, 0x90,
-    0x90, 0x94, 0x89, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x82, 0x82, 0x82, 0x89,
-    0x82, 0x81, 0x81, 0x81, 0x82, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81,
-    0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x81, 0x82, 0x7d, 0x7a, 0x7d, 0x7d,
-    0x7d, 0x7a, 0x89, 0x81, 0x81, 0x7d, 0x82, 0x7d, 0x7d, 0x7d, 0x7d, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x7d, 0x76, 0x76, 0x7d, 0x7a, 0x7a, 0x7d, 0x7a, 0x7a,
-    0x7d, 0x89, 0x7a, 0x76, 0x7a, 0x7a, 0x76, 0x7a, 0x76, 0x76, 0x76, 0x76,
-    0x7a, 0x7a, 0x7a, 0x76, 0x76, 0x7a, 0x76, 0x74, 0x71, 0x7a, 0x7a, 0x71,
-    0x71, 0x74, 0x74, 0x95, 0xca, 0xd9, 0xc4, 0xc4, 0xb0, 0xb9, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xaf, 0x9e, 0x9e, 0xb0, 0xb0, 0xb0, 0xb7, 0xb7, 0xb7, 0xc0,
-    0xc9, 0xc4, 0xb0, 0xaf, 0xc0, 0xaf, 0xaf, 0xc0, 0xaf, 0xaf, 0xaf, 0xaf,
-    0x9e, 0xc0, 0xb7, 0xaf, 0xad, 0x79, 0x48, 0x5d, 0x5d, 0x6b, 0x6b, 0x64,
-    0x73, 0x40, 0x2e, 0x2e, 0xa4, 0x7f, 0x73, 0x40, 0x8e, 0xa8, 0x8e, 0x61,
-    0x4b, 0x72, 0xe7, 0xeb, 0x8c, 0x48, 0x33, 0xa6, 0xd5, 0xbd, 0xad, 0x9b,
-    0x8c, 0x79, 0x8c, 0xad, 0xad, 0xbd, 0xbd, 0x98, 0x48, 0x6b, 0x9b, 0x9b,
-    0x9b, 0x9b, 0xad, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xaf, 0xb0,
-    0xaf, 0xc6, 0xd0, 0xd6, 0xd6, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe2,
-    0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xec, 0xf7, 0xec, 0xea, 0xd6, 0xd7, 0xd7,
-    0xe7, 0xe7, 0xe5, 0xe5, 0xc7, 0xdb, 0xd8, 0xd8, 0xcb, 0xcb, 0xc1, 0xbf,
-    0xbf, 0xb4, 0xb1, 0xb8, 0xb3, 0xb3, 0xa7, 0xa9, 0xa9, 0xa3, 0xa3, 0xa3,
-    0x99, 0x99, 0x99, 0x97, 0x91, 0x91, 0x91, 0x91, 0x6e, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x74, 0x76, 0x74, 0x75, 0x74, 0x74, 0x75, 0x74, 0x75, 0x75,
-    0x75, 0x74, 0x74, 0x75, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75,
-    0x74, 0x76, 0x75, 0x75, 0x75, 0x75, 0x76, 0x75, 0x75, 0x74, 0x75, 0x75,
-    0x75, 0x75, 0x74, 0x74, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x68, 0x68, 0x68,
-    0x68, 0x63, 0x68, 0x5e, 0x63, 0x52, 0x2d, 0x16, 0x05, 0x01, 0x01, 0x05,
-    0x0e, 0x1f, 0x1f, 0x1a, 0x0e, 0x05, 0x0e, 0x2d, 0x89, 0xbf, 0xcc, 0xbf,
-    0xb4, 0xaa, 0xa9, 0x9d, 0x9d, 0x9d, 0x97, 0x90, 0x90, 0x90, 0x8a, 0x89,
-    0x89, 0x8a, 0x8a, 0x88, 0x82, 0x82, 0x82, 0x89, 0x81, 0x81, 0x82, 0x81,
-    0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81,
-    0x7d, 0x82, 0x81, 0x81, 0x82, 0x7d, 0x7a, 0x7a, 0x7a, 0x7a, 0x7d, 0x81,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7a, 0x7d, 0x7d, 0x7d,
-    0x76, 0x76, 0x7d, 0x7d, 0x7a, 0x76, 0x76, 0x7a, 0x7a, 0x7a, 0x76, 0x76,
-    0x7a, 0x76, 0x7a, 0x7a, 0x76, 0x76, 0x76, 0x76, 0x7a, 0x7a, 0x76, 0x76,
-    0x76, 0x76, 0x7a, 0x74, 0x74, 0x71, 0x71, 0x74, 0x74, 0x7c, 0xa5, 0xdc,
-    0xd4, 0xc7, 0xa6, 0xa2, 0xa2, 0xa2, 0x92, 0x7f, 0x8f, 0x8f, 0x8f, 0x8f,
-    0x9e, 0xb0, 0xc7, 0xc7, 0xb0, 0xa2, 0xa2, 0xb0, 0xb0, 0xb0, 0xaf, 0xaf,
-    0xc6, 0xc0, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0x9e, 0xaf, 0xd9, 0xc0, 0x98,
-    0x79, 0x5d, 0x5d, 0x6b, 0x48, 0x48, 0x79, 0xc0, 0xb0, 0x7f, 0x73, 0x51,
-    0x98, 0x6b, 0x7f, 0xa4, 0x80, 0x8e, 0xae, 0x72, 0x4b, 0x61, 0xa2, 0xc0,
-    0xbd, 0x6b, 0x73, 0x8f, 0x98, 0x9b, 0x9b, 0x79, 0x79, 0x79, 0x6b, 0x79,
-    0x98, 0xad, 0xad, 0xe7, 0xcd, 0x79, 0x8c, 0x8c, 0x9b, 0x98, 0x9b, 0xad,
-    0xbd, 0xc0, 0xc0, 0xc6, 0xc6, 0xaf, 0xaf, 0xc6, 0xc6, 0xd0, 0xd0, 0xd0,
-    0xd0, 0xe2, 0xe2, 0xe2, 0xe1, 0xe2, 0xd0, 0xc6, 0xd6, 0xd6, 0xd6, 0xd6,
-    0xd6, 0xe2, 0xea, 0xf4, 0xe5, 0xc4, 0xc4, 0xd9, 0xe7, 0xe5, 0xe5, 0xd7,
-    0xc2, 0xcb, 0xcb, 0xbf, 0xbf, 0xc1, 0xb8, 0xb8, 0xb8, 0xb4, 0xa7, 0xa9,
-    0xa9, 0xa9, 0xa9, 0xa3, 0x99, 0x99, 0x9d, 0x91, 0x91, 0x97, 0x90, 0x91,
-    0x91, 0x91, 0x91, 0x88, 0x6e, 0x6e, 0x6e, 0x6e, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74, 0x74,
-    0x74, 0x75, 0x75, 0x74, 0x74, 0x75, 0x75, 0x75, 0x74, 0x75, 0x74, 0x75,
-    0x76, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74, 0x75, 0x74, 0x74, 0x74, 0x75,
-    0x6c, 0x6c, 0x6c, 0x6a, 0x68, 0x68, 0x68, 0x68, 0x63, 0x63, 0x5e, 0x63,
-    0x5f, 0x46, 0x26, 0x07, 0x05, 0x01, 0x01, 0x05, 0x0e, 0x1f, 0x1e, 0x16,
-    0x0a, 0x0a, 0x19, 0x4f, 0xa1, 0xbf, 0xbf, 0xb4, 0xaa, 0xa7, 0xa3, 0x99,
-    0x9d, 0x97, 0x94, 0x90, 0x90, 0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x82, 0x81,
-    0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x7d, 0x7d, 0x7a, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x7d, 0x7a, 0x7a, 0x7a, 0x7a, 0x7d, 0x76, 0x7d,
-    0x7d, 0x7a, 0x7d, 0x76, 0x7a, 0x7d, 0x7d, 0x7d, 0x76, 0x76, 0x7d, 0x7d,
-    0x76, 0x76, 0x76, 0x76, 0x7a, 0x76, 0x76, 0x76, 0x76, 0x76, 0x7a, 0x76,
-    0x7a, 0x76, 0x76, 0x74, 0x7a, 0x74, 0x76, 0x71, 0x74, 0x76, 0x76, 0x74,
-    0x74, 0x74, 0x71, 0x74, 0x85, 0xc2, 0xca, 0xd4, 0xd9, 0xa6, 0x92, 0x8e,
-    0x72, 0x72, 0x64, 0x64, 0x64, 0x7f, 0x8f, 0x9e, 0xb0, 0xc4, 0xd7, 0xd7,
-    0xd7, 0xc4, 0xb0, 0xa6, 0xa4, 0x8f, 0x9e, 0xaf, 0xc0, 0xc6, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xe6, 0xf2, 0xef, 0x8f, 0x6b, 0x5d, 0x9b, 0xe6,
-    0x73, 0x5d, 0x79, 0x8c, 0x79, 0x5d, 0x7f, 0x73, 0x7f, 0x40, 0xa4, 0xa4,
-    0x54, 0x72, 0x72, 0xae, 0xcd, 0xee, 0xcd, 0xb0, 0x9b, 0x8c, 0xe7, 0xc0,
-    0xc0, 0xfc, 0xf2, 0xbd, 0x8c, 0x6b, 0x5d, 0x48, 0x79, 0x8c, 0x9b, 0xd5,
-    0xe3, 0x8c, 0x79, 0x8c, 0x9b, 0xbd, 0xad, 0xad, 0xad, 0xaf, 0xc0, 0xbd,
-    0xaf, 0xaf, 0xb7, 0xc6, 0xc6, 0xc6, 0xd0, 0xd0, 0xd0, 0xdd, 0xe2, 0xdd,
-    0xd0, 0xc6, 0xc0, 0xc9, 0xc9, 0xd6, 0xd6, 0xd6, 0xe5, 0xef, 0xef, 0xef,
-    0xeb, 0xc7, 0xc7, 0xd7, 0xe5, 0xe5, 0xd9, 0xc2, 0xc1, 0xbf, 0xbf, 0xb8,
-    0xb8, 0xb8, 0xb3, 0xa9, 0xa9, 0xa9, 0xa9, 0xa3, 0xa3, 0x99, 0x99, 0x97,
-    0x97, 0x97, 0x90, 0x91, 0x91, 0x91, 0x8a, 0x88, 0x88, 0x84, 0x88, 0x88,
-    0x6a, 0x6e, 0x6e, 0x6c, 0x6e, 0x6e, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74, 0x74,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x6c, 0x6c, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x5f, 0x5f, 0x5f, 0x5b, 0x57, 0x3c, 0x1a, 0x05,
-    0x05, 0x01, 0x01, 0x0a, 0x19, 0x1f, 0x1a, 0x07, 0x05, 0x07, 0x28, 0x7a,
-    0xb4, 0xbf, 0xb4, 0xac, 0xa9, 0xa3, 0x99, 0x9d, 0x94, 0x90, 0x94, 0x89,
-    0x8a, 0x88, 0x8a, 0x8a, 0x8a, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82,
-    0x81, 0x82, 0x82, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x82, 0x82, 0x82, 0x82, 0x7d, 0x82, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x76, 0x7a, 0x7a, 0x7a, 0x76, 0x7d, 0x7d, 0x7d, 0x7a, 0x7a, 0x7d, 0x7a,
-    0x7a, 0x76, 0x7a, 0x7a, 0x7a, 0x7a, 0x76, 0x76, 0x78, 0x76, 0x78, 0x76,
-    0x81, 0x81, 0x76, 0x76, 0x76, 0x7a, 0x7a, 0x76, 0x7a, 0x76, 0x76, 0x76,
-    0x71, 0x74, 0x76, 0x74, 0x74, 0x74, 0x7a, 0x74, 0x74, 0x74, 0x71, 0x74,
-    0xa5, 0xd4, 0xee, 0xeb, 0xc4, 0xb9, 0xa6, 0x92, 0x8e, 0x8e, 0x72, 0x61,
-    0x51, 0x51, 0x64, 0x92, 0xa2, 0xb0, 0xb0, 0xb7, 0xc6, 0xc4, 0xc4, 0xc4,
-    0xc4, 0xc4, 0xb0, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0x9e, 0x9e, 0xc6,
-    0xc6, 0xd5, 0xc6, 0x79, 0x5d, 0x79, 0x9b, 0xc0, 0x7f, 0x48, 0x5d, 0x5d,
-    0x48, 0x54, 0x48, 0x9e, 0x9e, 0x73, 0xc0, 0xa4, 0xb9, 0xd4, 0xd4, 0xee,
-    0xe7, 0xeb, 0xfa, 0xf9, 0xdd, 0x98, 0xcd, 0xcd, 0x9e, 0xd5, 0xe6, 0xc6,
-    0xbd, 0x8c, 0x48, 0x33, 0x48, 0x79, 0x9b, 0xd5, 0xd5, 0x98, 0x6b, 0x8c,
-    0xad, 0xc6, 0xc0, 0xc0, 0xad, 0xbd, 0xbd, 0xaf, 0xad, 0xaf, 0xaf, 0xc0,
-    0xc6, 0xc6, 0xd0, 0xc6, 0xc6, 0xc6, 0xc6, 0xb7, 0xb7, 0xb7, 0xc4, 0xc9,
-    0xc9, 0xd6, 0xd6, 0xe5, 0xef, 0xf8, 0xef, 0xef, 0xe6, 0xe3, 0xe5, 0xe3,
-    0xe5, 0xd4, 0xbe, 0xb3, 0xb8, 0xb8, 0xb3, 0xb3, 0xa9, 0xa9, 0xa9, 0xa9,
-    0xa3, 0xa3, 0x99, 0x99, 0x9d, 0x97, 0x97, 0x97, 0x91, 0x91, 0x91, 0x91,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x78, 0x81, 0x6a, 0x6a, 0x6a, 0x6e,
-    0x6e, 0x6f, 0x6f, 0x6c, 0x6c, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
-    0x6e, 0x6c, 0x6c, 0x6e, 0x6e, 0x6e, 0x75, 0x75, 0x75, 0x75, 0x6c, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6e, 0x6e,
-    0x6e, 0x6e, 0x6e, 0x6a, 0x6a, 0x6c, 0x6a, 0x68, 0x68, 0x63, 0x63, 0x5f,
-    0x5f, 0x56, 0x56, 0x5b, 0x4e, 0x2f, 0x16, 0x05, 0x01, 0x01, 0x05, 0x0a,
-    0x19, 0x19, 0x0e, 0x0a, 0x03, 0x0c, 0x3c, 0xa1, 0xbf, 0xb4, 0xb4, 0xaa,
-    0x9d, 0x99, 0x9d, 0x94, 0x90, 0x90, 0x8a, 0x89, 0x8a, 0x88, 0x8a, 0x82,
-    0x82, 0x82, 0x82, 0x81, 0x84, 0x81, 0x82, 0x82, 0x82, 0x7d, 0x81, 0x82,
-    0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x81, 0x7d, 0x82, 0x7a,
-    0x7d, 0x7d, 0x7d, 0x7a, 0x7d, 0x7d, 0x7d, 0x76, 0x7a, 0x7a, 0x76, 0x7d,
-    0x76, 0x7d, 0x7d, 0x76, 0x7d, 0x76, 0x76, 0x76, 0x7d, 0x76, 0x76, 0x76,
-    0x78, 0x7a, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x7d, 0x7a, 0x7a, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x74, 0x74, 0x74, 0x74, 0x75,
-    0x74, 0x74, 0x71, 0x71, 0x74, 0x74, 0x74, 0x85, 0xdc, 0xe7, 0xee, 0xee,
-    0xeb, 0xe6, 0xe5, 0xd5, 0xd7, 0xc7, 0xb9, 0xa6, 0x92, 0x8e, 0x61, 0x51,
-    0x64, 0x73, 0x7f, 0xa4, 0xc6, 0xc6, 0xb7, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2,
-    0x9e, 0xaf, 0xaf, 0xaf, 0xbd, 0xad, 0xc0, 0xc0, 0xaf, 0xaf, 0xad, 0x79,
-    0x5d, 0x79, 0x79, 0x98, 0xcd, 0x64, 0x48, 0x48, 0x7f, 0xc0, 0x64, 0xa2,
-    0xc0, 0xa4, 0xe7, 0xcd, 0xb0, 0xd9, 0xeb, 0xee, 0xe7, 0xc0, 0xc6, 0xd5,
-    0xc6, 0xbd, 0xe6, 0xf2, 0xb7, 0xaf, 0xc0, 0xbd, 0xad, 0x9b, 0x6b, 0x27,
-    0x33, 0x5d, 0x9b, 0xc0, 0xc0, 0x98, 0x6b, 0x8c, 0x9b, 0xad, 0xc0, 0xc0,
-    0xad, 0xaf, 0xaf, 0x98, 0x9b, 0x9b, 0xad, 0xaf, 0xaf, 0xaf, 0xaf, 0x9e,
-    0x9e, 0xb0, 0xb7, 0xb7, 0xc0, 0xc9, 0xc9, 0xc9, 0xc9, 0xd6, 0xe2, 0xec,
-    0xef, 0xec, 0xe5, 0xd6, 0xe3, 0xe5, 0xe5, 0xe6, 0xbc, 0xb6, 0xb3, 0xb3,
-    0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0x9d, 0x9d, 0x9d, 0x99, 0x97, 0x97, 0x97,
-    0x97, 0x91, 0x91, 0x91, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x81,
-    0x81, 0x7d, 0x78, 0x7d, 0x6a, 0x6a, 0x6a, 0x6c, 0x6a, 0x6a, 0x6a, 0x66,
-    0x6e, 0x6c, 0x6c, 0x6e, 0x6e, 0x6c, 0x6e, 0x6c, 0x6e, 0x6c, 0x6e, 0x6c,
-    0x6c, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x75,
-    0x75, 0x75, 0x75, 0x6e, 0x6c, 0x6c, 0x6e, 0x6c, 0x6e, 0x6e, 0x6a, 0x6a,
-    0x68, 0x68, 0x63, 0x68, 0x68, 0x5f, 0x5f, 0x56, 0x56, 0x56, 0x56, 0x57,
-    0x43, 0x26, 0x0a, 0x01, 0x01, 0x02, 0x05, 0x0a, 0x19, 0x1a, 0x0a, 0x03,
-    0x05, 0x1e, 0x5b, 0xac, 0xc1, 0xb8, 0xac, 0xa3, 0x9d, 0x97, 0x97, 0x90,
-    0x90, 0x8a, 0x8a, 0x8a, 0x88, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82,
-    0x82, 0x81, 0x82, 0x82, 0x81, 0x7d, 0x7d, 0x7d, 0x81, 0x82, 0x82, 0x81,
-    0x81, 0x81, 0x7d, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7d, 0x76, 0x7a, 0x7a,
-    0x7a, 0x7a, 0x76, 0x7d, 0x7d, 0x76, 0x78, 0x7d, 0x76, 0x7a, 0x7d, 0x7d,
-    0x76, 0x7a, 0x76, 0x76, 0x7a, 0x7a, 0x76, 0x76, 0x76, 0x76, 0x7a, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x7a, 0x76, 0x76, 0x7a, 0x76, 0x76, 0x76, 0x74,
-    0x74, 0x74, 0x71, 0x74, 0x71, 0x74, 0x74, 0x74, 0x74, 0x74, 0x71, 0x74,
-    0x74, 0x6c, 0x6c, 0xa5, 0xef, 0xe7, 0xee, 0xfa, 0xf8, 0xe5, 0xe5, 0xe5,
-    0xe5, 0xe5, 0xd5, 0xc6, 0xc6, 0xc4, 0xc4, 0xa6, 0x80, 0x73, 0x64, 0x64,
-    0x80, 0xc0, 0xc6, 0xc0, 0xb0, 0xa2, 0xb0, 0xa2, 0x9e, 0x9e, 0x8f, 0x8f,
-    0x8f, 0x98, 0xc0, 0xaf, 0xad, 0x9b, 0x79, 0x6b, 0x5d, 0x6b, 0x6b, 0xad,
-    0xe6, 0x73, 0x48, 0x7f, 0xcd, 0xaf, 0xb0, 0xe7, 0xaf, 0xd7, 0xe6, 0xe6,
-    0xc0, 0x9b, 0xe6, 0xf2, 0xf2, 0xaf, 0x98, 0xad, 0xad, 0xad, 0xc6, 0xd5,
-    0xd5, 0x9e, 0x8c, 0x9b, 0x9b, 0x8c, 0x79, 0x33, 0x33, 0x48, 0xad, 0xaf,
-    0xaf, 0x9b, 0x79, 0x8c, 0x8c, 0x9b, 0xad, 0xad, 0xad, 0xc6, 0xeb, 0x9e,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x8f, 0x9e, 0xaf, 0xc6, 0xc6, 0xdd, 0xe3, 0xec,
-    0xec, 0xef, 0xec, 0xec, 0xec, 0xe3, 0xe3, 0xec, 0xe5, 0xe5, 0xe5, 0xe5,
-    0xd7, 0xc4, 0xba, 0xc3, 0xb6, 0xa9, 0xac, 0xa9, 0xa3, 0xa3, 0xa3, 0x99,
-    0x99, 0x99, 0x9d, 0x94, 0x94, 0x90, 0x91, 0x90, 0x91, 0x91, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x78,
-    0x63, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x66, 0x6a, 0x6c, 0x6c,
-    0x6e, 0x6c, 0x6c, 0x6e, 0x6e, 0x6e, 0x6c, 0x6e, 0x6c, 0x6c, 0x6c, 0x6e,
-    0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6c, 0x75, 0x6e, 0x74, 0x75, 0x6e,
-    0x6c, 0x6e, 0x6e, 0x6c, 0x6e, 0x6a, 0x68, 0x6a, 0x6a, 0x68, 0x63, 0x63,
-    0x5e, 0x5e, 0x56, 0x56, 0x56, 0x56, 0x53, 0x52, 0x3c, 0x1a, 0x05, 0x01,
-    0x02, 0x02, 0x05, 0x0a, 0x16, 0x0e, 0x05, 0x05, 0x0a, 0x2f, 0x82, 0xb8,
-    0xb8, 0xac, 0xa1, 0x99, 0x99, 0x97, 0x90, 0x89, 0x8a, 0x8a, 0x88, 0x82,
-    0x82, 0x82, 0x89, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x82, 0x7a, 0x7d, 0x81, 0x81, 0x81, 0x7d, 0x7d,
-    0x7d, 0x82, 0x7a, 0x7d, 0x7a, 0x7a, 0x7a, 0x76, 0x7d, 0x7a, 0x7d, 0x7a,
-    0x7d, 0x7d, 0x76, 0x76, 0x7d, 0x7a, 0x7a, 0x76, 0x7d, 0x76, 0x76, 0x7a,
-    0x76, 0x76, 0x76, 0x76, 0x7a, 0x7a, 0x76, 0x76, 0x76, 0x7a, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x74, 0x74, 0x74, 0x76, 0x74, 0x74, 0x74, 0x75,
-    0x71, 0x6c, 0x74, 0x74, 0x71, 0x74, 0x71, 0x6e, 0x75, 0x85, 0x85, 0xca,
-    0xf2, 0xeb, 0xee, 0xd4, 0xbc, 0xd4, 0xe5, 0xd5, 0xe5, 0xd5, 0xd5, 0xc9,
-    0xc9, 0xc4, 0xc4, 0xc6, 0xc6, 0xb0, 0x92, 0x80, 0x64, 0x64, 0xa2, 0xc6,
-    0xc6, 0xc6, 0xc6, 0xc0, 0xc0, 0xb0, 0xaf, 0x9e, 0x8f, 0x7f, 0x9e, 0xbd,
-    0xad, 0x98, 0x79, 0x6b, 0x6b, 0xcd, 0xa4, 0x9b, 0xc6, 0x79, 0x5d, 0xc6,
-    0xdd, 0xaf, 0xaf, 0xd5, 0xad, 0xc0, 0xfc, 0xee, 0xe6, 0x79, 0xb0, 0xdd,
-    0xdd, 0xc6, 0x79, 0x79, 0x8c, 0x8c, 0xaf, 0xb7, 0xc0, 0xad, 0x5d, 0x79,
-    0x8c, 0x8c, 0x79, 0x48, 0x2e, 0x5d, 0xad, 0x9b, 0x9b, 0x9b, 0x79, 0x8c,
-    0x8c, 0x8c, 0x9b, 0x9b, 0xad, 0xe5, 0xfc, 0xed, 0xa4, 0x9e, 0xaf, 0xc0,
-    0xc6, 0xd0, 0xd0, 0xdd, 0xe1, 0xe1, 0xd6, 0xe3, 0xef, 0xf9, 0xf8, 0xf7,
-    0xef, 0xef, 0xe5, 0xe3, 0xd6, 0xd6, 0xe5, 0xeb, 0xee, 0xa8, 0xa0, 0xa9,
-    0xa9, 0xa3, 0xa3, 0x99, 0x99, 0x99, 0x97, 0x9d, 0x97, 0x97, 0x97, 0x90,
-    0x90, 0x90, 0x91, 0x88, 0x88, 0x88, 0x88, 0x84, 0x8a, 0x88, 0x88, 0x81,
-    0x81, 0x81, 0x81, 0x7d, 0x78, 0x78, 0x76, 0x76, 0x63, 0x63, 0x63, 0x63,
-    0x6a, 0x6a, 0x6a, 0x6a, 0x68, 0x68, 0x6a, 0x6a, 0x6a, 0x6c, 0x6a, 0x6a,
-    0x6c, 0x6c, 0x6c, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x6c, 0x6c,
-    0x6e, 0x6c, 0x6c, 0x6e, 0x6e, 0x74, 0x75, 0x6e, 0x6e, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6a, 0x6a, 0x6a, 0x63, 0x68, 0x63, 0x5f, 0x5f, 0x55, 0x56, 0x53,
-    0x53, 0x53, 0x52, 0x46, 0x2f, 0x0e, 0x05, 0x01, 0x01, 0x02, 0x03, 0x07,
-    0x0e, 0x0a, 0x05, 0x03, 0x0e, 0x43, 0xa1, 0xb8, 0xb8, 0xac, 0xa3, 0x9f,
-    0x97, 0x90, 0x89, 0x8a, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81,
-    0x81, 0x89, 0x7a, 0x7a, 0x7a, 0x7d, 0x82, 0x7d, 0x7a, 0x7d, 0x7d, 0x7a,
-    0x7d, 0x7a, 0x7a, 0x7d, 0x81, 0x82, 0x7d, 0x7a, 0x7d, 0x7a, 0x7a, 0x7a,
-    0x7d, 0x7d, 0x76, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7d, 0x76, 0x7a, 0x76,
-    0x76, 0x7a, 0x7a, 0x7a, 0x76, 0x76, 0x76, 0x7a, 0x7a, 0x76, 0x76, 0x7a,
-    0x76, 0x76, 0x7a, 0x7a, 0x76, 0x7a, 0x7a, 0x76, 0x76, 0x76, 0x76, 0x74,
-    0x74, 0x74, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x6c, 0x6c, 0x6c,
-    0x74, 0x71, 0x71, 0x6e, 0xa5, 0xee, 0xee, 0xef, 0xef, 0xe5, 0xbc, 0x7c,
-    0xb5, 0xe7, 0xd5, 0xe5, 0xe5, 0xe5, 0xd5, 0xd5, 0xc9, 0xc9, 0xc0, 0xb7,
-    0xb7, 0xb7, 0xc9, 0xd5, 0xc0, 0xb9, 0x92, 0x80, 0x8f, 0xa2, 0xb0, 0xb7,
-    0xb7, 0xaf, 0xaf, 0x9e, 0x8f, 0x8f, 0x79, 0x9b, 0x9b, 0x8c, 0x79, 0x79,
-    0xc0, 0xe6, 0xc0, 0x9b, 0xdd, 0x8f, 0x79, 0xaf, 0x9b, 0x9e, 0xcd, 0x9b,
-    0x79, 0x98, 0xec, 0xec, 0xe6, 0xad, 0x7f, 0xc6, 0xc0, 0xc0, 0xad, 0x5d,
-    0x79, 0x79, 0x9b, 0xaf, 0xaf, 0xbd, 0x6b, 0x48, 0x79, 0x8c, 0x79, 0x48,
-    0x27, 0x5d, 0x9b, 0x9b, 0x9b, 0x98, 0x79, 0x8c, 0x8c, 0x98, 0xaf, 0xc0,
-    0xb7, 0xc6, 0xd7, 0xed, 0xc0, 0xaf, 0xc0, 0xc6, 0xc6, 0xd0, 0xd0, 0xd0,
-    0xc6, 0xc6, 0xd0, 0xe3, 0xec, 0xf7, 0xef, 0xef, 0xe3, 0xe3, 0xd6, 0xd6,
-    0xc9, 0xd6, 0xe5, 0xf2, 0xeb, 0xc8, 0xa1, 0x99, 0x99, 0x9d, 0x9d, 0x97,
-    0x97, 0x97, 0x97, 0x94, 0x90, 0x90, 0x90, 0x91, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x88, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x7d,
-    0x7d, 0x76, 0x76, 0x75, 0x5e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6a,
-    0x6a, 0x6a, 0x68, 0x68, 0x68, 0x6a, 0x6a, 0x6a, 0x68, 0x66, 0x68, 0x68,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6a, 0x6e, 0x6a, 0x6a, 0x6a, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6e, 0x6c, 0x6c, 0x68, 0x6c, 0x68, 0x6a, 0x68, 0x63, 0x63,
-    0x63, 0x5e, 0x5f, 0x5f, 0x56, 0x55, 0x53, 0x53, 0x4a, 0x4a, 0x46, 0x3c,
-    0x26, 0x08, 0x01, 0x01, 0x01, 0x01, 0x03, 0x07, 0x0a, 0x05, 0x05, 0x03,
-    0x19, 0x5b, 0xac, 0xb4, 0xac, 0xa1, 0x99, 0x97, 0x90, 0x8a, 0x8a, 0x82,
-    0x82, 0x84, 0x7a, 0x82, 0x82, 0x82, 0x81, 0x89, 0x82, 0x7d, 0x7a, 0x7a,
-    0x7d, 0x7a, 0x7a, 0x7d, 0x7a, 0x7d, 0x7d, 0x7a, 0x7d, 0x7a, 0x7d, 0x7d,
-    0x7d, 0x7a, 0x7a, 0x7a, 0x7d, 0x78, 0x7a, 0x7a, 0x76, 0x7a, 0x7a, 0x76,
-    0x76, 0x78, 0x7a, 0x7a, 0x7a, 0x76, 0x7d, 0x7a, 0x7a, 0x7a, 0x7a, 0x76,
-    0x7a, 0x76, 0x76, 0x76, 0x7a, 0x7a, 0x76, 0x7a, 0x7a, 0x71, 0x76, 0x76,
-    0x74, 0x76, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x6c, 0x74, 0x6c, 0x6c, 0x6c, 0x71, 0x6c, 0x6e,
-    0xa5, 0xe6, 0xef, 0xef, 0xe5, 0xd7, 0x87, 0x86, 0xee, 0xd5, 0xd5, 0xe5,
-    0xe5, 0xe5, 0xe6, 0xe6, 0xf2, 0xf2, 0xef, 0xef, 0xd0, 0xb7, 0xb7, 0xc6,
-    0xd5, 0xd5, 0xd5, 0xc9, 0xc4, 0xa2, 0x8f, 0x80, 0x73, 0x64, 0x54, 0x51,
-    0x51, 0x54, 0x54, 0x54, 0x98, 0x8c, 0x79, 0xad, 0xaf, 0xc0, 0xc0, 0xc0,
-    0xe6, 0xd7, 0x8f, 0xe6, 0x9e, 0x98, 0xe6, 0xcd, 0x7f, 0x6b, 0xc0, 0xd0,
-    0xcf, 0xbd, 0x98, 0xad, 0xc0, 0xc0, 0xc0, 0x79, 0x48, 0x6b, 0x8c, 0xaf,
-    0xcd, 0xc0, 0xaf, 0x48, 0x48, 0x6b, 0x6b, 0x48, 0x23, 0x6b, 0x9b, 0x9b,
-    0x9b, 0xb7, 0x8c, 0x79, 0x8c, 0xaf, 0xe6, 0xf2, 0xf9, 0xf2, 0xd7, 0xeb,
-    0xb7, 0xaf, 0xb7, 0xb7, 0xb7, 0xc0, 0xc0, 0xc6, 0xd0, 0xe1, 0xea, 0xec,
-    0xec, 0xec, 0xe3, 0xe3, 0xd6, 0xd6, 0xd6, 0xc9, 0xd5, 0xe5, 0xf9, 0xeb,
-    0xc8, 0xbb, 0xb5, 0xa1, 0x90, 0x90, 0x90, 0x90, 0x91, 0x8a, 0x8a, 0x94,
-    0x89, 0x88, 0x88, 0x88, 0x88, 0x82, 0x81, 0x84, 0x84, 0x81, 0x7d, 0x81,
-    0x81, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75,
-    0x5f, 0x5f, 0x5f, 0x63, 0x66, 0x63, 0x63, 0x63, 0x66, 0x63, 0x63, 0x68,
-    0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x68, 0x68, 0x66, 0x6c, 0x6a, 0x6a, 0x6a,
-    0x6c, 0x6a, 0x6a, 0x6e, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6c,
-    0x6c, 0x6c, 0x68, 0x68, 0x68, 0x68, 0x68, 0x63, 0x63, 0x5e, 0x5e, 0x56,
-    0x56, 0x53, 0x4a, 0x4a, 0x46, 0x46, 0x43, 0x34, 0x1a, 0x05, 0x01, 0x00,
-    0x01, 0x01, 0x05, 0x0a, 0x0a, 0x05, 0x03, 0x03, 0x26, 0x7a, 0xb8, 0xb8,
-    0xac, 0xa1, 0x97, 0x90, 0x8a, 0x8a, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x7a, 0x7a, 0x82, 0x82, 0x7a, 0x7d, 0x7a, 0x7a, 0x7a, 0x7a, 0x7d, 0x7d,
-    0x7a, 0x76, 0x7a, 0x7a, 0x7a, 0x7a, 0x7d, 0x7d, 0x76, 0x7a, 0x7a, 0x76,
-    0x7a, 0x76, 0x7a, 0x76, 0x76, 0x7a, 0x76, 0x76, 0x78, 0x76, 0x7a, 0x76,
-    0x7a, 0x78, 0x78, 0x76, 0x76, 0x7a, 0x76, 0x76, 0x76, 0x76, 0x76, 0x7a,
-    0x7a, 0x7a, 0x76, 0x7a, 0x76, 0x76, 0x76, 0x7a, 0x7a, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x6c, 0x6c,
-    0x6c, 0x74, 0x71, 0x6c, 0x6c, 0x71, 0x6c, 0x6e, 0x87, 0xd9, 0xef, 0xe5,
-    0xc8, 0xca, 0x77, 0xc2, 0xe5, 0xe5, 0xe5, 0xef, 0xef, 0xef, 0xee, 0xf8,
-    0xfa, 0xf9, 0xf2, 0xf2, 0xdd, 0xc6, 0xc6, 0xc6, 0xc9, 0xc0, 0xc4, 0xc4,
-    0xb0, 0xb0, 0xd9, 0xe6, 0xe6, 0xdd, 0xc6, 0xc0, 0xc0, 0xc0, 0xb0, 0x9e,
-    0x8f, 0x79, 0x9e, 0xe6, 0xeb, 0x8f, 0xcd, 0xe7, 0xc0, 0xbd, 0xad, 0xc6,
-    0xc0, 0x8f, 0xc0, 0xeb, 0xef, 0x8f, 0xcd, 0xf2, 0xe7, 0xad, 0x8c, 0x8c,
-    0xad, 0xd9, 0xee, 0xd9, 0x6b, 0x48, 0x79, 0xcd, 0xfd, 0xee, 0xfc, 0xa4,
-    0x2e, 0x33, 0x48, 0x27, 0x2e, 0x98, 0x9b, 0xaf, 0xd9, 0xeb, 0xeb, 0x9e,
-    0x9b, 0xd5, 0xd6, 0xd6, 0xe5, 0xe6, 0xd5, 0xc0, 0x9e, 0xa2, 0xb0, 0xb7,
-    0xc0, 0xc6, 0xdd, 0xe1, 0xe2, 0xe1, 0xe3, 0xd0, 0xd6, 0xd0, 0xd0, 0xd6,
-    0xd6, 0xe3, 0xe2, 0xea, 0xe2, 0xef, 0xeb, 0xe6, 0xa8, 0xd7, 0xd4, 0xc2,
-    0xa5, 0x96, 0x84, 0x8a, 0x96, 0x88, 0x88, 0x8a, 0x8a, 0x84, 0x81, 0x81,
-    0x81, 0x7d, 0x78, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x78, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x75, 0x75, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x63, 0x63, 0x63, 0x63, 0x68, 0x68, 0x68, 0x63, 0x63, 0x6a,
-    0x63, 0x63, 0x6a, 0x68, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a,
-    0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6c, 0x68, 0x68, 0x6a,
-    0x68, 0x6a, 0x63, 0x68, 0x6a, 0x5f, 0x56, 0x56, 0x53, 0x53, 0x4a, 0x49,
-    0x46, 0x3c, 0x3c, 0x2c, 0x0e, 0x02, 0x01, 0x01, 0x00, 0x02, 0x05, 0x0a,
-    0x05, 0x05, 0x05, 0x08, 0x34, 0x90, 0xb4, 0xaa, 0xa1, 0x97, 0x90, 0x8a,
-    0x8a, 0x82, 0x82, 0x82, 0x7a, 0x7d, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x82,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x76, 0x76, 0x7a, 0x7a, 0x76, 0x7a,
-    0x7a, 0x76, 0x76, 0x7a, 0x7a, 0x7a, 0x7a, 0x76, 0x7a, 0x7a, 0x7a, 0x76,
-    0x7a, 0x76, 0x7a, 0x76, 0x7a, 0x7a, 0x7a, 0x7a, 0x76, 0x78, 0x76, 0x76,
-    0x7a, 0x76, 0x7a, 0x76, 0x76, 0x76, 0x75, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x74, 0x76, 0x76, 0x74, 0x74, 0x74, 0x71, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x71, 0x6c, 0x75, 0x74, 0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x71, 0x6c, 0x77, 0xd4, 0xef, 0xd7, 0xc8, 0xae, 0xbc, 0xd4,
-    0xe5, 0xef, 0xf2, 0xf2, 0xef, 0xec, 0xef, 0xf8, 0xfc, 0xfc, 0xe6, 0xc0,
-    0xaf, 0x9e, 0xaf, 0xad, 0x9e, 0xa2, 0xa2, 0xb0, 0xb9, 0xd9, 0xfa, 0xf8,
-    0xec, 0xdd, 0xc5, 0xbd, 0xc0, 0xc0, 0xaf, 0xaf, 0x98, 0x8f, 0xc0, 0xe7,
-    0xee, 0xae, 0xf2, 0xf2, 0xe6, 0x9b, 0x79, 0x8c, 0xc0, 0xc7, 0xaf, 0xc6,
-    0xc6, 0xc0, 0xe6, 0xe7, 0xef, 0xd7, 0x9b, 0x79, 0x9b, 0xc0, 0xe5, 0xe6,
-    0xc0, 0x48, 0x5d, 0xd7, 0xe7, 0xe7, 0xe7, 0xe6, 0x73, 0x23, 0x2e, 0x48,
-    0xb0, 0xeb, 0xcd, 0xc0, 0xee, 0xee, 0xee, 0xdd, 0xc0, 0xc6, 0xc6, 0xc6,
-    0xc0, 0xc6, 0xc6, 0xaf, 0xaf, 0xc6, 0xd5, 0xd0, 0xec, 0xec, 0xd0, 0xd0,
-    0xd0, 0xd0, 0xc6, 0xc6, 0xc6, 0xc6, 0xd0, 0xd6, 0xe3, 0xec, 0xe3, 0xe3,
-    0xe5, 0xe6, 0xf2, 0xd9, 0xba, 0xe5, 0xef, 0xee, 0xc8, 0xca, 0xa5, 0x82,
-    0xe4, 0xa0, 0x78, 0x81, 0x81, 0x81, 0x78, 0x7d, 0x76, 0x76, 0x78, 0x76,
-    0x76, 0x7d, 0x81, 0x7d, 0x76, 0x76, 0x76, 0x76, 0x75, 0x76, 0x76, 0x76,
-    0x76, 0x75, 0x74, 0x74, 0x56, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x63, 0x63, 0x63, 0x66, 0x63, 0x63, 0x63, 0x63, 0x63, 0x68, 0x63,
-    0x63, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x68, 0x68, 0x6a,
-    0x6a, 0x6a, 0x6a, 0x68, 0x68, 0x68, 0x68, 0x63, 0x63, 0x68, 0x63, 0x6a,
-    0x6a, 0x63, 0x56, 0x56, 0x4d, 0x4a, 0x46, 0x46, 0x3c, 0x3c, 0x34, 0x1f,
-    0x05, 0x01, 0x01, 0x00, 0x01, 0x01, 0x05, 0x0a, 0x05, 0x01, 0x05, 0x0e,
-    0x43, 0x9f, 0xaa, 0xa1, 0xa1, 0x97, 0x8a, 0x8a, 0x82, 0x82, 0x83, 0x7a,
-    0x7a, 0x76, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7d, 0x7a, 0x7a, 0x7a, 0x7a,
-    0x78, 0x76, 0x7a, 0x76, 0x78, 0x76, 0x76, 0x78, 0x7a, 0x76, 0x76, 0x76,
-    0x7a, 0x7a, 0x76, 0x76, 0x76, 0x7a, 0x7a, 0x7a, 0x76, 0x76, 0x76, 0x7a,
-    0x7a, 0x76, 0x7a, 0x7a, 0x7a, 0x75, 0x78, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x74, 0x74, 0x71, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x71, 0x74, 0x74, 0x74, 0x74, 0x6c, 0x74,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x71, 0x71, 0x71,
-    0x6c, 0x9a, 0xe5, 0xe6, 0xe6, 0xd7, 0xd7, 0xe6, 0xef, 0xef, 0xef, 0xe6,
-    0xe6, 0xe3, 0xd6, 0xe5, 0xef, 0xf2, 0xe6, 0xdd, 0xc6, 0xaf, 0xaf, 0xc0,
-    0xaf, 0xb0, 0xb7, 0xc6, 0xd7, 0xe6, 0xe5, 0xd5, 0xc0, 0xc6, 0xc0, 0xbd,
-    0xbd, 0xad, 0xad, 0xad, 0x9b, 0x9b, 0xc0, 0xd5, 0xc6, 0x8f, 0xc6, 0xd5,
-    0xe3, 0xaf, 0x48, 0x79, 0xd5, 0xe5, 0xaf, 0x9b, 0xaf, 0xaf, 0xc0, 0xc9,
-    0xd5, 0xd5, 0xc0, 0x79, 0x79, 0xc0, 0xc6, 0xc6, 0xc6, 0x98, 0x48, 0xc6,
-    0xd5, 0xc0, 0xc6, 0xd5, 0x9e, 0x27, 0x40, 0x8c, 0xdd, 0xee, 0xe7, 0xd5,
-    0xd5, 0xd7, 0xd7, 0xd5, 0xc6, 0xc0, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xc0, 0xc6, 0xc6, 0xdd, 0xd5, 0xc0, 0xc0, 0xb7, 0xb7, 0xb7, 0xc0,
-    0xc9, 0xd5, 0xd6, 0xd6, 0xe5, 0xef, 0xef, 0xef, 0xe5, 0xe5, 0xe5, 0xc4,
-    0xd7, 0xe5, 0xe6, 0xd9, 0xe5, 0xef, 0xeb, 0xc2, 0xee, 0xe4, 0x7a, 0x7a,
-    0x78, 0x76, 0x7a, 0x76, 0x78, 0x76, 0x75, 0x75, 0x76, 0x81, 0x7d, 0x76,
-    0x76, 0x76, 0x74, 0x74, 0x75, 0x75, 0x74, 0x75, 0x75, 0x6e, 0x6c, 0x6c,
-    0x56, 0x56, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x63, 0x63, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6a, 0x63, 0x6a,
-    0x6a, 0x6a, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6a, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x68, 0x68, 0x6a, 0x6a, 0x68, 0x68, 0x63, 0x68, 0x68, 0x63, 0x56, 0x53,
-    0x4a, 0x46, 0x44, 0x3c, 0x34, 0x30, 0x25, 0x0e, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x05, 0x05, 0x01, 0x03, 0x03, 0x19, 0x5b, 0xa1, 0xaa, 0xa1,
-    0x97, 0x90, 0x8a, 0x82, 0x81, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x81, 0x82, 0x7a, 0x76, 0x7a, 0x7a, 0x7a, 0x76, 0x76,
-    0x78, 0x76, 0x7a, 0x76, 0x76, 0x76, 0x75, 0x76, 0x7a, 0x76, 0x76, 0x78,
-    0x7a, 0x7a, 0x76, 0x76, 0x76, 0x76, 0x76, 0x7a, 0x7a, 0x76, 0x7a, 0x7a,
-    0x7a, 0x76, 0x75, 0x76, 0x76, 0x76, 0x76, 0x76, 0x74, 0x76, 0x74, 0x74,
-    0x71, 0x71, 0x74, 0x71, 0x71, 0x74, 0x74, 0x71, 0x71, 0x74, 0x74, 0x71,
-    0x71, 0x74, 0x6c, 0x74, 0x71, 0x71, 0x6c, 0x6c, 0x74, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x71, 0x71, 0x6c, 0x71, 0x71, 0x71, 0x71, 0x6c, 0x7c, 0xca, 0xf2,
-    0xeb, 0xe7, 0xe5, 0xe5, 0xd5, 0xe3, 0xe3, 0xd6, 0xd6, 0xd5, 0xc6, 0xc6,
-    0xc6, 0xe3, 0xe3, 0xe3, 0xe3, 0xec, 0xf2, 0xf2, 0xf2, 0xe6, 0xf2, 0xe6,
-    0xe5, 0xd7, 0xb0, 0xaf, 0xad, 0xaf, 0xbd, 0xc0, 0xbd, 0xad, 0xad, 0x9b,
-    0x98, 0x9b, 0xaf, 0xaf, 0x98, 0x6b, 0xad, 0xaf, 0xaf, 0xad, 0x48, 0x6b,
-    0xc6, 0xc0, 0x8f, 0x7f, 0xeb, 0xe7, 0xc0, 0xaf, 0xc0, 0xc0, 0xbd, 0x9b,
-    0x6b, 0x9b, 0xaf, 0xaf, 0xbd, 0xad, 0x98, 0xaf, 0xaf, 0xaf, 0xb7, 0xc0,
-    0xc0, 0x6b, 0x6b, 0x9b, 0xc6, 0xe6, 0xc0, 0xc6, 0xc9, 0xc4, 0xc6, 0xc0,
-    0xaf, 0xad, 0xad, 0xaf, 0xaf, 0xaf, 0x9e, 0xad, 0xaf, 0xaf, 0xaf, 0xc6,
-    0xc6, 0x9e, 0x9b, 0x9e, 0x9e, 0xaf, 0xc6, 0xc6, 0xd6, 0xd6, 0xd6, 0xe3,
-    0xe5, 0xef, 0xe5, 0xd5, 0xd5, 0xd5, 0xc9, 0xd7, 0xe5, 0xc8, 0xe5, 0xc8,
-    0xc8, 0xd4, 0xee, 0xe7, 0xee, 0xdc, 0x71, 0x76, 0x7a, 0x74, 0x74, 0x75,
-    0x75, 0x74, 0x75, 0x75, 0x76, 0x78, 0x76, 0x74, 0x74, 0x74, 0x6c, 0x6e,
-    0x6c, 0x6e, 0x6e, 0x75, 0x6e, 0x6e, 0x6e, 0x6e, 0x56, 0x56, 0x55, 0x5f,
-    0x55, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x68, 0x63,
-    0x66, 0x68, 0x63, 0x68, 0x68, 0x6a, 0x6a, 0x6a, 0x68, 0x68, 0x68, 0x6a,
-    0x6c, 0x6c, 0x6a, 0x6c, 0x6e, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x68,
-    0x6a, 0x68, 0x68, 0x68, 0x68, 0x68, 0x5e, 0x53, 0x46, 0x46, 0x3c, 0x34,
-    0x2d, 0x2a, 0x1b, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x05,
-    0x01, 0x01, 0x05, 0x1f, 0x71, 0xac, 0xa1, 0x99, 0x90, 0x8a, 0x82, 0x82,
-    0x7d, 0x7a, 0x71, 0x6f, 0x76, 0x76, 0x7a, 0x7a, 0x71, 0x76, 0x76, 0x7a,
-    0x7a, 0x7a, 0x76, 0x7a, 0x76, 0x7a, 0x76, 0x76, 0x76, 0x76, 0x7a, 0x76,
-    0x76, 0x7a, 0x7a, 0x76, 0x76, 0x76, 0x76, 0x78, 0x7a, 0x7a, 0x76, 0x7a,
-    0x76, 0x76, 0x76, 0x7a, 0x76, 0x7a, 0x7a, 0x7a, 0x76, 0x7a, 0x76, 0x76,
-    0x7a, 0x71, 0x71, 0x74, 0x74, 0x74, 0x74, 0x74, 0x71, 0x71, 0x74, 0x74,
-    0x74, 0x74, 0x71, 0x74, 0x71, 0x74, 0x74, 0x74, 0x6c, 0x74, 0x71, 0x71,
-    0x71, 0x71, 0x6c, 0x6c, 0x71, 0x6c, 0x6c, 0x6c, 0x71, 0x6c, 0x71, 0x6c,
-    0x71, 0x6c, 0x6c, 0x6c, 0x71, 0x71, 0x7c, 0xca, 0xef, 0xef, 0xe6, 0xe6,
-    0xe5, 0xd5, 0xc9, 0xd5, 0xc6, 0xc6, 0xc0, 0xb7, 0xa2, 0xb0, 0xc6, 0xdd,
-    0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xdd, 0xd0, 0xd0, 0xc6, 0xa2, 0xaf,
-    0x9b, 0x9b, 0xad, 0xad, 0xad, 0xad, 0x9b, 0x9b, 0x8c, 0x9b, 0x9b, 0x8c,
-    0x6b, 0x48, 0x9b, 0x9b, 0x9b, 0x9b, 0x48, 0x5d, 0x9b, 0x9b, 0x79, 0xc7,
-    0xd7, 0xb7, 0x98, 0x9b, 0xad, 0xad, 0xad, 0xad, 0x8c, 0x6b, 0x9b, 0xad,
-    0xad, 0xad, 0xad, 0xad, 0xad, 0xaf, 0xaf, 0xaf, 0xaf, 0x8c, 0x79, 0x8c,
-    0xad, 0xc6, 0x9b, 0xaf, 0xb7, 0xaf, 0xaf, 0xaf, 0xad, 0x9b, 0x9b, 0xad,
-    0xad, 0x9b, 0x98, 0x9b, 0x9b, 0xad, 0xaf, 0xd7, 0x92, 0x7f, 0x9e, 0xaf,
-    0xc6, 0xc6, 0xc6, 0xd5, 0xd6, 0xd6, 0xd6, 0xd6, 0xe3, 0xd5, 0xd5, 0xc9,
-    0xc9, 0xc9, 0xc9, 0xd6, 0xe5, 0xc8, 0xe5, 0xba, 0xba, 0xd4, 0xe6, 0xef,
-    0xed, 0x87, 0x75, 0x75, 0x75, 0x71, 0x74, 0x71, 0x74, 0x74, 0x75, 0x75,
-    0x6c, 0x6c, 0x74, 0x6c, 0x74, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x6c, 0x6c,
-    0x6c, 0x6e, 0x6e, 0x6c, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x63, 0x63, 0x63, 0x68, 0x6a, 0x6a,
-    0x6a, 0x6a, 0x6a, 0x68, 0x6a, 0x6c, 0x6c, 0x71, 0x71, 0x6c, 0x6e, 0x6e,
-    0x6c, 0x6c, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x68, 0x6a, 0x6c,
-    0x6a, 0x6a, 0x5f, 0x52, 0x46, 0x3c, 0x34, 0x2d, 0x2a, 0x17, 0x0c, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x01, 0x05, 0x05, 0x29,
-    0x7a, 0xac, 0xa1, 0x97, 0x8a, 0x89, 0x82, 0x7a, 0x7a, 0x7a, 0x74, 0x74,
-    0x7a, 0x76, 0x7a, 0x71, 0x74, 0x74, 0x75, 0x71, 0x7a, 0x76, 0x7a, 0x71,
-    0x74, 0x7a, 0x76, 0x76, 0x76, 0x76, 0x7a, 0x7a, 0x76, 0x7a, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x7a, 0x7a, 0x76, 0x76, 0x76,
-    0x7a, 0x7a, 0x7a, 0x76, 0x75, 0x76, 0x76, 0x76, 0x74, 0x74, 0x74, 0x74,
-    0x71, 0x74, 0x74, 0x74, 0x71, 0x71, 0x74, 0x74, 0x71, 0x74, 0x74, 0x74,
-    0x6c, 0x71, 0x6c, 0x6c, 0x6c, 0x71, 0x6c, 0x6e, 0x6c, 0x6c, 0x6c, 0x6e,
-    0x6c, 0x6c, 0x71, 0x6c, 0x6c, 0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x71,
-    0x71, 0x71, 0x74, 0x7c, 0xca, 0xd7, 0xd7, 0xc4, 0xc4, 0xb9, 0xb0, 0xd5,
-    0xe5, 0xe5, 0xe5, 0xd5, 0xd5, 0xd5, 0xd5, 0xe3, 0xec, 0xea, 0xe1, 0xe1,
-    0xe2, 0xe3, 0xe1, 0xe1, 0xdd, 0xd0, 0xaf, 0x9b, 0x9b, 0xad, 0xad, 0xad,
-    0xad, 0x9b, 0x9b, 0x8c, 0x79, 0x79, 0x8c, 0x6b, 0x6b, 0x5d, 0x8c, 0x98,
-    0xcd, 0xa4, 0x6b, 0x48, 0x79, 0x79, 0x6b, 0xb0, 0xc4, 0x9b, 0x6b, 0x79,
-    0x9b, 0x9b, 0x9b, 0x9b, 0x98, 0x79, 0x8c, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b,
-    0xad, 0xad, 0x9b, 0xad, 0xaf, 0x79, 0x5d, 0x6b, 0x98, 0xbd, 0xad, 0xad,
-    0xaf, 0xad, 0xad, 0xad, 0x9b, 0x9b, 0x9b, 0x98, 0x79, 0x6b, 0x79, 0x98,
-    0x9b, 0xad, 0xaf, 0xb0, 0xb0, 0xd0, 0xd0, 0xc6, 0xc6, 0xc9, 0xc6, 0xc6,
-    0xd6, 0xd6, 0xd6, 0xd6, 0xc9, 0xc9, 0xc4, 0xc4, 0xc4, 0xc4, 0xc9, 0xd7,
-    0xd6, 0xc8, 0xc8, 0xc8, 0xd7, 0xe6, 0xef, 0xe7, 0xd4, 0x71, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x6e, 0x6e, 0x75, 0x6c, 0x6e, 0x6a, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6e, 0x6c, 0x6c, 0x6a, 0x6a, 0x6a, 0x6a, 0x6e, 0x75, 0x6e,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5e, 0x63, 0x63, 0x63, 0x68, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6c,
-    0x6e, 0x6c, 0x6c, 0x75, 0x74, 0x74, 0x75, 0x76, 0x74, 0x74, 0x75, 0x74,
-    0x74, 0x74, 0x75, 0x75, 0x6e, 0x6e, 0x6a, 0x6a, 0x6a, 0x5f, 0x52, 0x46,
-    0x3c, 0x34, 0x2c, 0x20, 0x10, 0x0d, 0x07, 0x01, 0x00, 0x01, 0x00, 0x00,
-    0x01, 0x05, 0x05, 0x01, 0x02, 0x05, 0x0a, 0x2d, 0x8a, 0xa1, 0x97, 0x90,
-    0x8a, 0x81, 0x7a, 0x7a, 0x7a, 0x74, 0x75, 0x6c, 0x74, 0x76, 0x76, 0x7a,
-    0x71, 0x74, 0x75, 0x71, 0x74, 0x74, 0x74, 0x74, 0x75, 0x71, 0x74, 0x76,
-    0x76, 0x76, 0x7a, 0x7a, 0x7a, 0x76, 0x76, 0x76, 0x74, 0x76, 0x74, 0x76,
-    0x76, 0x74, 0x76, 0x74, 0x74, 0x76, 0x76, 0x76, 0x7a, 0x7a, 0x7a, 0x76,
-    0x76, 0x74, 0x74, 0x71, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x76,
-    0x74, 0x74, 0x74, 0x71, 0x6c, 0x71, 0x6c, 0x71, 0x6c, 0x71, 0x74, 0x6c,
-    0x6c, 0x6c, 0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x71, 0x74, 0x74,
-    0x77, 0xbc, 0xd9, 0xc7, 0xd7, 0xe5, 0xec, 0xec, 0xe3, 0xe3, 0xe3, 0xe3,
-    0xe3, 0xe6, 0xf7, 0xf4, 0xea, 0xdd, 0xdd, 0xd0, 0xdd, 0xdd, 0xd0, 0xd0,
-    0xd0, 0xc6, 0xb7, 0x9e, 0xad, 0x9b, 0xad, 0xad, 0xad, 0x9b, 0x8c, 0x79,
-    0x7f, 0x6b, 0x6b, 0x79, 0x9b, 0x79, 0x79, 0xc7, 0xe6, 0xe3, 0x6b, 0x33,
-    0x6b, 0x6b, 0x6b, 0x8f, 0x9e, 0x98, 0x5d, 0x6b, 0x8c, 0x8c, 0x8c, 0x8c,
-    0x8c, 0x8c, 0x79, 0x8c, 0x9b, 0x8c, 0x8c, 0x9b, 0xad, 0xad, 0x9b, 0xad,
-    0xad, 0x7f, 0x33, 0x5d, 0x8c, 0x9b, 0x9b, 0xad, 0xad, 0xad, 0x9e, 0x9b,
-    0x79, 0x6b, 0x6b, 0x5d, 0x5d, 0x6b, 0x79, 0x98, 0xaf, 0xc0, 0xc6, 0xc6,
-    0xd0, 0xd5, 0xdd, 0xe3, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xc4, 0xc9, 0xd5, 0xd6, 0xc8, 0xbb, 0xc4,
-    0xe5, 0xe5, 0xe5, 0xe6, 0x9a, 0x75, 0x75, 0x75, 0x74, 0x74, 0x74, 0x6e,
-    0x6e, 0x6e, 0x6c, 0x74, 0x6e, 0x6a, 0x6a, 0x6c, 0x6c, 0x6c, 0x6a, 0x68,
-    0x68, 0x6c, 0x6a, 0x6a, 0x6a, 0x6c, 0x6e, 0x6a, 0x55, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x5f, 0x5f, 0x5f, 0x5f, 0x63, 0x63, 0x63, 0x68, 0x68, 0x6a,
-    0x6a, 0x6a, 0x6e, 0x6e, 0x6c, 0x75, 0x74, 0x74, 0x74, 0x74, 0x76, 0x76,
-    0x76, 0x76, 0x7d, 0x7d, 0x7d, 0x78, 0x7d, 0x7d, 0x81, 0x7d, 0x76, 0x78,
-    0x75, 0x75, 0x6c, 0x63, 0x57, 0x52, 0x46, 0x3e, 0x34, 0x2a, 0x20, 0x10,
-    0x10, 0x0c, 0x03, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x05, 0x05, 0x01,
-    0x01, 0x05, 0x0a, 0x34, 0x90, 0x99, 0x90, 0x8a, 0x83, 0x78, 0x76, 0x71,
-    0x6c, 0x6c, 0x6e, 0x6c, 0x74, 0x76, 0x76, 0x7a, 0x71, 0x74, 0x6e, 0x6e,
-    0x6e, 0x6c, 0x6c, 0x74, 0x75, 0x71, 0x71, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x7a, 0x75, 0x74, 0x74, 0x74, 0x74, 0x7a, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x76, 0x76, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x71,
-    0x6c, 0x6c, 0x71, 0x6c, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x74, 0x71, 0x74, 0x74, 0x71, 0x6e, 0x69, 0x65, 0xa5, 0xeb,
-    0xef, 0xef, 0xec, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xd6, 0xe5, 0xe5, 0xe3,
-    0xd0, 0xd0, 0xd0, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xb7, 0xb7, 0xb0, 0xb0,
-    0xc0, 0xc0, 0xc0, 0x9e, 0x9b, 0x98, 0x8c, 0x8f, 0xcd, 0xa4, 0x54, 0x79,
-    0x79, 0x6b, 0x6b, 0xc0, 0xd5, 0xc6, 0x79, 0x33, 0x5d, 0x7f, 0x6b, 0x7f,
-    0x79, 0x79, 0x6b, 0x6b, 0x6b, 0x8c, 0x9b, 0x8c, 0x79, 0x79, 0x79, 0x8c,
-    0x8c, 0xad, 0xaf, 0x8c, 0x9b, 0x9b, 0xad, 0x9b, 0xad, 0x79, 0x7f, 0x48,
-    0x5d, 0x79, 0x8c, 0x9b, 0x9b, 0xaf, 0xd9, 0xa4, 0x54, 0x48, 0x33, 0x48,
-    0x48, 0x6b, 0x98, 0xaf, 0xc0, 0xc6, 0xc0, 0xc0, 0xc6, 0xc6, 0xd0, 0xdd,
-    0xe3, 0xc6, 0xb7, 0xb7, 0xaf, 0xaf, 0xaf, 0xb0, 0xb7, 0xb0, 0xa2, 0xa2,
-    0xa2, 0xc4, 0xc4, 0xc4, 0xc9, 0xd7, 0xd9, 0xe6, 0xe5, 0xe5, 0xe5, 0xc7,
-    0x77, 0x75, 0x6c, 0x6e, 0x6e, 0x6c, 0x6c, 0x6e, 0x6e, 0x6c, 0x6c, 0x74,
-    0x6e, 0x6c, 0x68, 0x6a, 0x68, 0x68, 0x68, 0x68, 0x6a, 0x6c, 0x6a, 0x68,
-    0x6c, 0x6a, 0x68, 0x68, 0x53, 0x56, 0x56, 0x56, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x63, 0x63, 0x63, 0x63, 0x6a, 0x6a, 0x6a, 0x6c, 0x6c, 0x6c, 0x75, 0x75,
-    0x75, 0x76, 0x76, 0x76, 0x7d, 0x7d, 0x81, 0x81, 0x81, 0x84, 0x88, 0x84,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0x84, 0x7d, 0x75, 0x71, 0x5b,
-    0x52, 0x46, 0x3e, 0x37, 0x2a, 0x10, 0x10, 0x10, 0x0d, 0x07, 0x01, 0x00,
-    0x01, 0x01, 0x00, 0x00, 0x01, 0x05, 0x05, 0x01, 0x01, 0x01, 0x0a, 0x3d,
-    0x97, 0x97, 0x8a, 0x82, 0x82, 0x7a, 0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x71, 0x71, 0x74, 0x71, 0x74, 0x6c, 0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6e, 0x71, 0x74, 0x74, 0x76, 0x76, 0x76, 0x7a, 0x76, 0x76, 0x76, 0x74,
-    0x74, 0x74, 0x74, 0x71, 0x71, 0x71, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x6c, 0x71, 0x74, 0x74, 0x6c, 0x6c, 0x71, 0x71, 0x71, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x71, 0x6c, 0x6c, 0x6c, 0x6e,
-    0x6c, 0x71, 0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x75, 0x71, 0x71, 0x66,
-    0x66, 0x4f, 0x43, 0x2f, 0x2b, 0x1d, 0x70, 0xe7, 0xef, 0xef, 0xec, 0xe3,
-    0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xc9, 0xc4, 0xd6, 0xd0, 0xd0, 0xd0, 0xc6,
-    0xc6, 0xc6, 0xc6, 0xc6, 0xb7, 0xb7, 0xb0, 0xc0, 0xd9, 0xc4, 0xc6, 0xbd,
-    0xad, 0xad, 0x9b, 0xb0, 0xe6, 0xd9, 0xa4, 0x5d, 0x5d, 0x5d, 0x64, 0x9e,
-    0xb0, 0x9e, 0x7f, 0x40, 0xae, 0xd9, 0xcd, 0x7f, 0x6b, 0x8f, 0xd9, 0xa4,
-    0x48, 0xcd, 0xeb, 0xc0, 0x79, 0x6b, 0x5d, 0x79, 0xaf, 0xf2, 0xeb, 0x98,
-    0x8c, 0x9b, 0x9b, 0x9b, 0x9b, 0x8c, 0xbd, 0x48, 0x33, 0x48, 0x79, 0x8c,
-    0xc0, 0xe6, 0xf2, 0xd9, 0xc7, 0x73, 0x48, 0x7f, 0x8f, 0x9e, 0x9e, 0xaf,
-    0xaf, 0xaf, 0xb7, 0xc6, 0xe5, 0xe6, 0xe6, 0xe6, 0xec, 0xb0, 0x8f, 0x8f,
-    0x9e, 0x9e, 0xa2, 0xa4, 0x8f, 0x8f, 0x8f, 0xa2, 0xa2, 0xa2, 0xb0, 0xc4,
-    0xd5, 0xe5, 0xef, 0xe5, 0xe3, 0xd6, 0xae, 0x87, 0x75, 0x75, 0x74, 0x6e,
-    0x6c, 0x6c, 0x6c, 0x6a, 0x6a, 0x6c, 0x6c, 0x6c, 0x6a, 0x68, 0x68, 0x68,
-    0x6a, 0x68, 0x68, 0x6a, 0x6a, 0x68, 0x6a, 0x68, 0x68, 0x6a, 0x6a, 0x6a,
-    0x56, 0x56, 0x56, 0x5f, 0x5f, 0x5f, 0x63, 0x63, 0x63, 0x6a, 0x6a, 0x6e,
-    0x6c, 0x6c, 0x75, 0x74, 0x74, 0x76, 0x78, 0x7d, 0x81, 0x81, 0x81, 0x88,
-    0x88, 0x8a, 0x91, 0x91, 0x94, 0x94, 0x91, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x90, 0x82, 0x71, 0x66, 0x57, 0x46, 0x46, 0x34, 0x25,
-    0x10, 0x10, 0x10, 0x10, 0x0c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x05, 0x05, 0x01, 0x01, 0x01, 0x0e, 0x44, 0x90, 0x90, 0x82, 0x82,
-    0x76, 0x71, 0x71, 0x6c, 0x6c, 0x68, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6c,
-    0x71, 0x71, 0x6c, 0x71, 0x71, 0x71, 0x71, 0x71, 0x75, 0x74, 0x74, 0x74,
-    0x76, 0x76, 0x76, 0x74, 0x7a, 0x76, 0x76, 0x76, 0x76, 0x74, 0x71, 0x74,
-    0x74, 0x71, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x71, 0x74, 0x74, 0x74, 0x74, 0x74, 0x6c, 0x71, 0x71, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x71, 0x6c, 0x6c, 0x71, 0x6c, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6e, 0x6c, 0x6c, 0x6c, 0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x71, 0x71, 0x59, 0x3a, 0x2b, 0x21, 0x18, 0x0b,
-    0x0b, 0x0b, 0x8d, 0xef, 0xef, 0xec, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3,
-    0xd6, 0xd5, 0xc4, 0xd5, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xc6, 0xc6, 0xc6,
-    0xc0, 0xb7, 0xb7, 0xc0, 0xc7, 0xc6, 0xaf, 0xbd, 0xbd, 0xad, 0x9b, 0x9e,
-    0xc0, 0xc9, 0xd7, 0x6b, 0x5d, 0x48, 0x48, 0x98, 0x7f, 0x8f, 0x5d, 0x92,
-    0xd7, 0xc4, 0xe3, 0x8f, 0x7f, 0x8f, 0xd5, 0xd7, 0xa6, 0xeb, 0xf2, 0xe5,
-    0x98, 0x5d, 0x48, 0x7f, 0xd5, 0xf2, 0xd9, 0x7f, 0x79, 0x9b, 0x9b, 0x9b,
-    0x8c, 0x5d, 0x79, 0x9b, 0x33, 0x33, 0x5d, 0x8f, 0xd5, 0xe5, 0xd5, 0xd7,
-    0xd5, 0xaf, 0x6b, 0x79, 0x79, 0x7f, 0x8f, 0x9e, 0xb7, 0xd5, 0xe6, 0xf2,
-    0xeb, 0xee, 0xfd, 0xf2, 0xa2, 0x7f, 0x7f, 0x73, 0x7f, 0x8f, 0xa2, 0xb0,
-    0xb7, 0xb7, 0xc4, 0xc9, 0xc9, 0xc9, 0xc9, 0xd6, 0xd6, 0xd6, 0xd5, 0xc4,
-    0x8d, 0x87, 0x7c, 0x71, 0x74, 0x6c, 0x6c, 0x74, 0x6e, 0x6c, 0x6a, 0x6a,
-    0x6a, 0x6a, 0x6a, 0x68, 0x63, 0x68, 0x68, 0x63, 0x68, 0x68, 0x63, 0x68,
-    0x6a, 0x6a, 0x6a, 0x68, 0x68, 0x68, 0x6a, 0x6a, 0x56, 0x5f, 0x5f, 0x5f,
-    0x63, 0x63, 0x6a, 0x6a, 0x6e, 0x6c, 0x75, 0x74, 0x75, 0x78, 0x76, 0x78,
-    0x81, 0x81, 0x88, 0x88, 0x88, 0x91, 0x90, 0x91, 0x91, 0x99, 0x9d, 0xa3,
-    0xa7, 0xa7, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0xb3, 0xa9, 0xa9, 0x99, 0x90,
-    0x7a, 0x66, 0x5b, 0x4f, 0x46, 0x3e, 0x2a, 0x10, 0x10, 0x10, 0x10, 0x0d,
-    0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x01, 0x01,
-    0x00, 0x03, 0x0c, 0x4e, 0x90, 0x8a, 0x82, 0x7a, 0x74, 0x71, 0x71, 0x66,
-    0x66, 0x66, 0x66, 0x68, 0x68, 0x68, 0x66, 0x68, 0x68, 0x66, 0x6a, 0x68,
-    0x6e, 0x6c, 0x71, 0x6c, 0x6e, 0x71, 0x74, 0x71, 0x76, 0x76, 0x74, 0x74,
-    0x76, 0x75, 0x76, 0x76, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x71, 0x6c, 0x6c, 0x6c, 0x6e, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x6c, 0x6c, 0x6e, 0x6e, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x75, 0x6c,
-    0x74, 0x66, 0x3a, 0x18, 0x0f, 0x0f, 0x0b, 0x06, 0x06, 0x15, 0xae, 0xec,
-    0xec, 0xec, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe5, 0xe5, 0xd5, 0xc4, 0xd5,
-    0xe3, 0xe3, 0xe3, 0xdd, 0xdd, 0xdd, 0xe3, 0xdd, 0xdd, 0xd0, 0xd0, 0xc6,
-    0xaf, 0xc0, 0xad, 0x9b, 0x9b, 0x9b, 0x8c, 0x98, 0x9e, 0xaf, 0xaf, 0x79,
-    0x5d, 0x48, 0x48, 0x79, 0x79, 0x79, 0x79, 0x9e, 0xb7, 0xb0, 0xc0, 0x7f,
-    0x5d, 0x8f, 0xc9, 0xd7, 0xd7, 0xd5, 0xe5, 0xd5, 0x9b, 0x48, 0x33, 0x7f,
-    0xd5, 0xd7, 0xc4, 0x54, 0x48, 0x8c, 0x98, 0x79, 0x6b, 0x48, 0x5d, 0x9b,
-    0xad, 0x23, 0x3b, 0xb0, 0xc6, 0xc6, 0xc0, 0xc4, 0xc6, 0x8f, 0x48, 0x54,
-    0x64, 0x8f, 0xb7, 0xdd, 0xe3, 0xe3, 0xec, 0xef, 0xef, 0xe7, 0xe5, 0xd5,
-    0x73, 0x7f, 0x7f, 0x7f, 0x7f, 0x8f, 0xa2, 0xa2, 0xb0, 0xb7, 0xc4, 0xc9,
-    0xc9, 0xd5, 0xc4, 0xae, 0x8d, 0x7e, 0x87, 0x7c, 0x75, 0x71, 0x6c, 0x6e,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x68, 0x68, 0x6a, 0x68, 0x68, 0x68, 0x63,
-    0x68, 0x63, 0x63, 0x68, 0x68, 0x68, 0x6a, 0x63, 0x63, 0x68, 0x6a, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x5f, 0x5f, 0x63, 0x63, 0x6a, 0x6e, 0x75, 0x75,
-    0x75, 0x78, 0x7d, 0x81, 0x88, 0x84, 0x88, 0x91, 0x91, 0x91, 0x97, 0x99,
-    0x99, 0xa3, 0xa9, 0xa9, 0xb3, 0xb1, 0xb3, 0xb1, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xb4, 0xa9, 0x97, 0x82, 0x71, 0x69, 0x57, 0x52,
-    0x46, 0x3c, 0x2a, 0x10, 0x10, 0x10, 0x10, 0x0c, 0x03, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x05, 0x05, 0x01, 0x02, 0x05, 0x05, 0x0c, 0x4e,
-    0x8a, 0x82, 0x7a, 0x71, 0x6c, 0x6c, 0x66, 0x6a, 0x66, 0x66, 0x63, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x63, 0x6a, 0x6a, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x71, 0x6c, 0x6c, 0x74, 0x74, 0x75, 0x74, 0x74, 0x74, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x74, 0x74, 0x6c, 0x74, 0x74,
-    0x74, 0x6c, 0x74, 0x6c, 0x75, 0x6c, 0x71, 0x74, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x71, 0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x74, 0x76, 0x74, 0x6c, 0x59, 0x38, 0x22,
-    0x0f, 0x0f, 0x0b, 0x06, 0x06, 0x0f, 0x8e, 0xe5, 0xe5, 0xe3, 0xe3, 0xe3,
-    0xe3, 0xe3, 0xe3, 0xe5, 0xe5, 0xe3, 0xd5, 0xc9, 0xe3, 0xe3, 0xdd, 0xd5,
-    0xcf, 0xd0, 0xd0, 0xd0, 0xd5, 0xc6, 0xc6, 0xaf, 0xaf, 0xad, 0x9b, 0x9b,
-    0x9b, 0x8c, 0x8c, 0x79, 0x9b, 0x9b, 0x9b, 0x79, 0x48, 0x48, 0x48, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x8f, 0x9e, 0x8f, 0x9b, 0x6b, 0x33, 0x7f, 0xaf, 0xc0,
-    0xc4, 0xc4, 0xc0, 0xc0, 0x98, 0x33, 0x27, 0x98, 0xaf, 0xb0, 0xa2, 0x3b,
-    0x23, 0x48, 0x5d, 0x48, 0x2e, 0x23, 0x33, 0x79, 0xad, 0x33, 0x64, 0xc6,
-    0xaf, 0xaf, 0xb7, 0xb7, 0xc0, 0x92, 0x64, 0x8f, 0xc6, 0xc6, 0xd0, 0xd0,
-    0xd0, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd5, 0xb0, 0x80, 0x64, 0x73,
-    0x7f, 0x7f, 0x8f, 0xa2, 0xa2, 0xb0, 0xb0, 0xc4, 0xc4, 0xd9, 0xa5, 0x6a,
-    0x6a, 0x6e, 0x6e, 0x6e, 0x6c, 0x68, 0x6c, 0x6c, 0x6e, 0x6c, 0x6c, 0x6c,
-    0x68, 0x68, 0x71, 0x68, 0x68, 0x68, 0x68, 0x63, 0x68, 0x68, 0x6a, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x63, 0x6a, 0x68, 0x6a, 0x6a, 0x63, 0x6a,
-    0x63, 0x6a, 0x6a, 0x6e, 0x75, 0x78, 0x7d, 0x81, 0x88, 0x84, 0x91, 0x91,
-    0x97, 0x99, 0xa3, 0xa9, 0xa9, 0xa9, 0xb3, 0xb1, 0xb1, 0xbf, 0xc1, 0xc1,
-    0xcb, 0xd3, 0xd3, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xde, 0xd3, 0xcb, 0xc1,
-    0xb3, 0x99, 0x90, 0x7a, 0x6f, 0x69, 0x52, 0x46, 0x46, 0x37, 0x25, 0x10,
-    0x10, 0x10, 0x0d, 0x05, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x05, 0x05, 0x02, 0x01, 0x05, 0x05, 0x19, 0x49, 0x83, 0x7a, 0x7a, 0x71,
-    0x71, 0x66, 0x66, 0x66, 0x66, 0x5e, 0x5f, 0x5b, 0x5e, 0x66, 0x68, 0x68,
-    0x68, 0x63, 0x63, 0x63, 0x68, 0x68, 0x68, 0x68, 0x6e, 0x6c, 0x6c, 0x6c,
-    0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x74, 0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x75, 0x6c, 0x71, 0x71, 0x6c, 0x71, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x6c, 0x6c, 0x6e, 0x6e,
-    0x6c, 0x76, 0x7d, 0x71, 0x5c, 0x38, 0x2b, 0x22, 0x22, 0x22, 0x18, 0x06,
-    0x06, 0x04, 0x4b, 0xc4, 0xe5, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe5,
-    0xe5, 0xd6, 0xd6, 0xd5, 0xd5, 0xc6, 0xc6, 0xc6, 0xc6, 0xd0, 0xd0, 0xc6,
-    0xc6, 0xc0, 0xb7, 0xa2, 0x8f, 0x8f, 0x8c, 0x9b, 0x9b, 0x98, 0x79, 0x6b,
-    0x7f, 0x8c, 0x98, 0x8c, 0x5d, 0x48, 0x48, 0x40, 0x6b, 0x6b, 0x6b, 0x79,
-    0x98, 0x79, 0x8c, 0x6b, 0x23, 0x40, 0xad, 0xaf, 0xaf, 0xb7, 0xaf, 0xad,
-    0x9b, 0x40, 0x23, 0x79, 0x9b, 0x9e, 0x73, 0x23, 0x23, 0x14, 0x23, 0x14,
-    0x14, 0x23, 0x27, 0x40, 0x48, 0x5d, 0xad, 0xaf, 0xad, 0xaf, 0xaf, 0xaf,
-    0xad, 0x9b, 0xad, 0xad, 0xc0, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc9, 0xc6,
-    0xc9, 0xc9, 0xd6, 0xe5, 0xf7, 0xf2, 0xa4, 0x64, 0x7f, 0x7f, 0x8f, 0xa2,
-    0xa2, 0xb0, 0xb0, 0xc4, 0xc4, 0xe7, 0xe4, 0x7c, 0x6c, 0x6e, 0x6e, 0x6a,
-    0x6a, 0x6a, 0x6a, 0x6a, 0x63, 0x68, 0x68, 0x68, 0x63, 0x6a, 0x76, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x6e, 0x6a, 0x6a, 0x68, 0x63, 0x68, 0x63, 0x68,
-    0x63, 0x63, 0x68, 0x68, 0x68, 0x63, 0x68, 0x63, 0x6a, 0x75, 0x78, 0x7d,
-    0x81, 0x88, 0x91, 0x91, 0x97, 0x99, 0xa9, 0xa9, 0xb3, 0xb3, 0xb3, 0xc1,
-    0xbf, 0xcb, 0xd3, 0xd3, 0xd3, 0xde, 0xde, 0xde, 0xe9, 0xe9, 0xe9, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xe9, 0xd3, 0xbf, 0xb8, 0xa1, 0x97, 0x82, 0x71,
-    0x66, 0x60, 0x52, 0x46, 0x3e, 0x2a, 0x17, 0x10, 0x10, 0x0d, 0x07, 0x03,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x05, 0x05, 0x02, 0x01,
-    0x05, 0x03, 0x16, 0x46, 0x7a, 0x7a, 0x71, 0x66, 0x66, 0x68, 0x66, 0x5f,
-    0x5f, 0x5e, 0x5f, 0x5b, 0x5e, 0x5e, 0x5f, 0x5b, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x68, 0x6a, 0x68, 0x68, 0x6c, 0x68, 0x68, 0x69, 0x68, 0x6c, 0x6c,
-    0x6c, 0x71, 0x6c, 0x6c, 0x71, 0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x71, 0x6c, 0x6c, 0x6e, 0x6c, 0x6e, 0x6e, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x71, 0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6a, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6e, 0x6c, 0x74, 0x75, 0x74, 0x74, 0x7a, 0x7a, 0x62,
-    0x38, 0x38, 0x42, 0x5c, 0x5c, 0x38, 0x21, 0x06, 0x06, 0x04, 0x15, 0x72,
-    0xc4, 0xd6, 0xd6, 0xe3, 0xe3, 0xe3, 0xd6, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5,
-    0xc9, 0xc0, 0xb7, 0xc0, 0xc0, 0xc0, 0xc6, 0xc6, 0xb7, 0xb7, 0xb0, 0x8f,
-    0x64, 0x51, 0x64, 0x73, 0x7f, 0x7f, 0x6b, 0x64, 0x64, 0x64, 0x6b, 0x6b,
-    0x5d, 0x48, 0x40, 0x2e, 0x33, 0x64, 0x5d, 0x64, 0x79, 0x79, 0x79, 0x79,
-    0x33, 0x40, 0xa2, 0x9e, 0x9e, 0xad, 0x9b, 0x98, 0x8c, 0x7f, 0x40, 0x8c,
-    0x98, 0x98, 0x79, 0x2e, 0x23, 0x23, 0x23, 0x23, 0x14, 0x23, 0x33, 0x33,
-    0x40, 0x8c, 0xbd, 0xad, 0xad, 0xaf, 0xad, 0x8f, 0x98, 0x98, 0x9b, 0xaf,
-    0xaf, 0xc0, 0xc0, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc9, 0xe5, 0xef,
-    0xf2, 0xeb, 0xcd, 0x73, 0x73, 0x7f, 0xa2, 0xb0, 0xa2, 0xb0, 0xb0, 0xc4,
-    0xc4, 0xe5, 0xeb, 0x9a, 0x6a, 0x63, 0x71, 0x86, 0x95, 0xa5, 0x95, 0x95,
-    0x71, 0x63, 0x6a, 0x63, 0x63, 0x68, 0x68, 0x68, 0x63, 0x63, 0x68, 0x6a,
-    0x6a, 0x6a, 0x6a, 0x6a, 0x63, 0x63, 0x63, 0x63, 0x68, 0x63, 0x63, 0x63,
-    0x68, 0x63, 0x63, 0x63, 0x6a, 0x76, 0x81, 0x91, 0x97, 0x99, 0xa9, 0xa9,
-    0xb3, 0xc1, 0xc1, 0xcb, 0xcb, 0xd3, 0xde, 0xde, 0xde, 0xe9, 0xe9, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe9,
-    0xd3, 0xc1, 0xac, 0x99, 0x90, 0x8a, 0x7a, 0x69, 0x60, 0x57, 0x52, 0x3c,
-    0x30, 0x25, 0x10, 0x10, 0x10, 0x0c, 0x05, 0x01, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x05, 0x05, 0x05, 0x01, 0x01, 0x05, 0x05, 0x0e, 0x43,
-    0x71, 0x66, 0x69, 0x66, 0x66, 0x60, 0x5f, 0x5f, 0x56, 0x56, 0x57, 0x57,
-    0x56, 0x56, 0x5e, 0x5f, 0x5e, 0x5f, 0x63, 0x63, 0x63, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x6a, 0x68, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x66, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x71, 0x6c, 0x6c, 0x6c, 0x71,
-    0x6c, 0x6c, 0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x6c,
-    0x74, 0x74, 0x75, 0x74, 0x76, 0x7d, 0x7a, 0x62, 0x5c, 0x62, 0x71, 0x59,
-    0x3a, 0x21, 0x09, 0x06, 0x04, 0x04, 0x00, 0x14, 0x61, 0xd7, 0xd6, 0xd6,
-    0xe3, 0xe3, 0xe3, 0xd6, 0xd6, 0xd6, 0xd7, 0xd6, 0xd5, 0xc4, 0xb7, 0xb7,
-    0xb7, 0xc0, 0xc4, 0xc4, 0xb7, 0xb0, 0x7f, 0x73, 0x80, 0x8f, 0x8f, 0x7f,
-    0x7f, 0x7f, 0x73, 0x7f, 0x6b, 0x64, 0x64, 0x5d, 0x5d, 0x48, 0x33, 0x2e,
-    0x27, 0x2e, 0x2e, 0x2e, 0x6b, 0x79, 0x79, 0x6b, 0x92, 0xd9, 0xd9, 0xb9,
-    0x9e, 0x9b, 0x9b, 0x8c, 0x8c, 0x8c, 0x64, 0x8c, 0x98, 0x98, 0x9b, 0x5d,
-    0x2e, 0x33, 0x2e, 0x2e, 0x3b, 0x54, 0x92, 0x6b, 0xa4, 0xc0, 0xad, 0x9b,
-    0xad, 0x8c, 0x51, 0x3b, 0x40, 0x64, 0x7f, 0x9b, 0xaf, 0xc0, 0xc0, 0xc0,
-    0xc0, 0xc0, 0xc6, 0xc6, 0xc9, 0xc9, 0xd5, 0xa6, 0x8e, 0xa6, 0xb0, 0xb0,
-    0xc9, 0xd6, 0xd6, 0xe3, 0xe3, 0xd7, 0xc4, 0xd7, 0xe5, 0xe5, 0xd5, 0xae,
-    0xbc, 0xca, 0xd4, 0xd4, 0xeb, 0xeb, 0xee, 0xee, 0xed, 0x95, 0x5f, 0x63,
-    0x5e, 0x63, 0x63, 0x68, 0x68, 0x68, 0x68, 0x63, 0x63, 0x63, 0x68, 0x63,
-    0x68, 0x68, 0x6a, 0x63, 0x5e, 0x63, 0x63, 0x63, 0x6a, 0x63, 0x63, 0x63,
-    0x7d, 0x91, 0x99, 0x99, 0xa7, 0xb1, 0xbf, 0xcb, 0xd3, 0xde, 0xde, 0xde,
-    0xe9, 0xe9, 0xe9, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe9, 0xde, 0xc1, 0xa9, 0x97, 0x8a,
-    0x7b, 0x7a, 0x6f, 0x60, 0x52, 0x46, 0x43, 0x3c, 0x2c, 0x1b, 0x0d, 0x10,
-    0x0d, 0x0a, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05,
-    0x05, 0x05, 0x00, 0x00, 0x03, 0x03, 0x0e, 0x34, 0x5b, 0x5b, 0x69, 0x66,
-    0x60, 0x5b, 0x5b, 0x57, 0x57, 0x57, 0x56, 0x57, 0x57, 0x56, 0x55, 0x56,
-    0x5b, 0x5e, 0x5e, 0x5e, 0x68, 0x68, 0x68, 0x68, 0x63, 0x68, 0x63, 0x68,
-    0x66, 0x6a, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x71, 0x71, 0x6e, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x71, 0x6c, 0x6c, 0x6e, 0x6c,
-    0x6c, 0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x71, 0x71, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c, 0x74, 0x75, 0x71, 0x76, 0x76,
-    0x7d, 0x82, 0x7a, 0x7a, 0x7a, 0x59, 0x38, 0x21, 0x09, 0x06, 0x06, 0x04,
-    0x04, 0x04, 0x00, 0x00, 0x61, 0xc4, 0xd5, 0xd6, 0xe3, 0xe3, 0xe3, 0xd6,
-    0xd6, 0xd5, 0xd5, 0xd5, 0xc9, 0xc4, 0xc4, 0xc9, 0xc9, 0xc9, 0xc9, 0xc4,
-    0xb7, 0xa2, 0xb0, 0xb7, 0xb7, 0xb0, 0xb0, 0xa2, 0xa2, 0xa2, 0xaf, 0x9b,
-    0x9b, 0x8f, 0x8f, 0x6b, 0x48, 0x33, 0x33, 0x2e, 0x2e, 0x27, 0x23, 0x27,
-    0x2e, 0x6b, 0x6b, 0x7f, 0xc4, 0xd7, 0xc4, 0xb9, 0xc0, 0x9b, 0x98, 0x8c,
-    0x79, 0x6b, 0x40, 0x79, 0x79, 0x8c, 0x79, 0x40, 0x2e, 0x48, 0x48, 0x6b,
-    0xc6, 0xe5, 0xe6, 0xd9, 0xd9, 0xe7, 0xb9, 0x64, 0x40, 0x3b, 0x40, 0x54,
-    0x64, 0x6b, 0x6b, 0x6b, 0x6b, 0x7f, 0x98, 0x9e, 0xaf, 0xaf, 0xb7, 0xc6,
-    0xc6, 0xc6, 0xb0, 0xc4, 0xb7, 0xc9, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xe5,
-    0xe5, 0xef, 0xf2, 0xd6, 0xe5, 0xe5, 0xc9, 0xd7, 0xe6, 0xe5, 0xe6, 0xef,
-    0xe7, 0xeb, 0xeb, 0xeb, 0xeb, 0xfd, 0xc3, 0x65, 0x5b, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x63, 0x63, 0x63, 0x63, 0x68, 0x63, 0x5e, 0x68, 0x68, 0x74,
-    0x68, 0x68, 0x63, 0x63, 0x6a, 0x6a, 0x63, 0x68, 0x91, 0xa3, 0xa9, 0xb1,
-    0xb1, 0xc1, 0xc1, 0xd3, 0xd3, 0xde, 0xde, 0xde, 0xde, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xdf, 0xb8, 0x90, 0x82, 0x6f, 0x69, 0x69, 0x60, 0x57,
-    0x46, 0x3e, 0x3e, 0x30, 0x1f, 0x0e, 0x0e, 0x0c, 0x07, 0x05, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x05, 0x05, 0x05, 0x01, 0x02,
-    0x05, 0x05, 0x07, 0x2d, 0x4f, 0x52, 0x57, 0x5b, 0x60, 0x57, 0x4e, 0x4e,
-    0x4e, 0x53, 0x52, 0x4e, 0x57, 0x56, 0x56, 0x5b, 0x5b, 0x5b, 0x5f, 0x5b,
-    0x5f, 0x5f, 0x5e, 0x68, 0x63, 0x63, 0x68, 0x68, 0x68, 0x68, 0x68, 0x66,
-    0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x71, 0x6c, 0x71, 0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x74, 0x74, 0x76, 0x7a, 0x7a, 0x7d, 0x81, 0x81, 0x88, 0x71,
-    0x42, 0x21, 0x0b, 0x06, 0x06, 0x06, 0x04, 0x04, 0x04, 0x00, 0x00, 0x4b,
-    0xe6, 0xe5, 0xe5, 0xd5, 0xe5, 0xd6, 0xe3, 0xe3, 0xe5, 0xe5, 0xd5, 0xc9,
-    0xc9, 0xc9, 0xc9, 0xd6, 0xd6, 0xc9, 0xc9, 0xc9, 0xc9, 0xd5, 0xc6, 0xc0,
-    0xb7, 0xb7, 0xb7, 0xd7, 0xd5, 0xd5, 0xc6, 0xaf, 0xb7, 0xe5, 0xc0, 0x6b,
-    0x48, 0x48, 0x33, 0x33, 0x2e, 0x2e, 0x2e, 0x27, 0x23, 0x27, 0x48, 0x92,
-    0xa2, 0xb0, 0xb0, 0xa2, 0xaf, 0x9b, 0x79, 0x79, 0x6b, 0x40, 0x23, 0x33,
-    0x54, 0x6b, 0x54, 0x23, 0x2e, 0x5d, 0x6b, 0x9b, 0xd0, 0xd5, 0xe6, 0xd7,
-    0xd7, 0xe5, 0xb0, 0x3b, 0x27, 0x27, 0x2e, 0x40, 0x64, 0x6b, 0x8c, 0x9b,
-    0xad, 0x9e, 0x9b, 0x9e, 0xaf, 0xb0, 0xaf, 0xaf, 0x9e, 0x8f, 0xa2, 0xb0,
-    0xb7, 0xc4, 0xc9, 0xc9, 0xd6, 0xd5, 0xd6, 0xd6, 0xd6, 0xec, 0xfd, 0xee,
-    0xd5, 0xc4, 0xb9, 0xd4, 0xca, 0xca, 0xca, 0xd4, 0xd4, 0xe7, 0xe6, 0xd7,
-    0xd7, 0xbb, 0xed, 0xa0, 0x5f, 0x63, 0x5f, 0x63, 0x68, 0x68, 0x68, 0x63,
-    0x63, 0x68, 0x6c, 0x6a, 0x68, 0x5e, 0x68, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x68, 0x5e, 0x5f, 0x88, 0x91, 0x99, 0xa9, 0xa9, 0xb3, 0xb1, 0xbf,
-    0xbf, 0xcb, 0xd3, 0xd3, 0xd3, 0xde, 0xde, 0xde, 0xdf, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xdf,
-    0xac, 0x7a, 0x69, 0x60, 0x52, 0x52, 0x52, 0x52, 0x46, 0x3c, 0x34, 0x28,
-    0x11, 0x09, 0x09, 0x07, 0x05, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x02, 0x05, 0x05, 0x03, 0x01, 0x00, 0x01, 0x03, 0x05, 0x0a, 0x29,
-    0x4e, 0x4e, 0x57, 0x5b, 0x56, 0x52, 0x52, 0x52, 0x4e, 0x4a, 0x4a, 0x4d,
-    0x55, 0x55, 0x56, 0x5b, 0x5b, 0x56, 0x5f, 0x60, 0x5f, 0x5f, 0x5f, 0x5e,
-    0x66, 0x5e, 0x68, 0x63, 0x68, 0x68, 0x68, 0x68, 0x66, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x6c, 0x68, 0x68, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6a,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x66, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x6c,
-    0x6c, 0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x74, 0x74, 0x74, 0x74, 0x76, 0x76,
-    0x76, 0x7d, 0x81, 0x81, 0x88, 0x8a, 0x7a, 0x3a, 0x18, 0x0b, 0x0b, 0x06,
-    0x06, 0x06, 0x04, 0x04, 0x04, 0x00, 0x00, 0x35, 0xc4, 0xe5, 0xe5, 0xe5,
-    0xe5, 0xe3, 0xe3, 0xe3, 0xe3, 0xd6, 0xd6, 0xd5, 0xc9, 0xd6, 0xd6, 0xd6,
-    0xd6, 0xd5, 0xd5, 0xe5, 0xd6, 0xd0, 0xc6, 0xc6, 0xc0, 0xc0, 0xeb, 0xf9,
-    0xf2, 0xe3, 0xc0, 0x9e, 0xd7, 0xa2, 0x9b, 0x98, 0x6b, 0x48, 0x48, 0x48,
-    0x40, 0x33, 0x2e, 0x27, 0x27, 0x23, 0x14, 0x73, 0x8f, 0x8f, 0x8f, 0x9e,
-    0x9b, 0x9b, 0x33, 0x27, 0x2e, 0x23, 0x23, 0x23, 0x23, 0x14, 0x14, 0x14,
-    0x27, 0x6b, 0x9b, 0xbd, 0xc6, 0xd5, 0xd7, 0xd7, 0xc9, 0xd5, 0xb0, 0x40,
-    0x33, 0x2e, 0x2e, 0x3b, 0x40, 0x64, 0x7f, 0x8f, 0x9e, 0xaf, 0xc0, 0xc0,
-    0xc0, 0xc6, 0x9e, 0x64, 0x64, 0x73, 0xa4, 0x8f, 0xa2, 0xa2, 0xb0, 0xc4,
-    0xc9, 0xc9, 0xd6, 0xd6, 0xd6, 0xe5, 0xf7, 0xfc, 0xeb, 0xa6, 0xa6, 0xa6,
-    0xb9, 0xc7, 0xd9, 0xd7, 0xe5, 0xe5, 0xe6, 0xd7, 0xa6, 0x70, 0x62, 0x65,
-    0x63, 0x5f, 0x5f, 0x5e, 0x5e, 0x5e, 0x63, 0x63, 0x63, 0x6a, 0x6e, 0x6a,
-    0x68, 0x63, 0x5e, 0x5f, 0x63, 0x6a, 0x63, 0x5f, 0x5e, 0x5e, 0x5f, 0x5f,
-    0x74, 0x7d, 0x88, 0x91, 0x91, 0x99, 0xa9, 0xa9, 0xb1, 0xb1, 0xb1, 0xbf,
-    0xc1, 0xcb, 0xcb, 0xd3, 0xd3, 0xd3, 0xd3, 0xde, 0xde, 0xde, 0xde, 0xde,
-    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xd3, 0x90, 0x5b, 0x57, 0x52,
-    0x43, 0x3e, 0x46, 0x46, 0x3e, 0x34, 0x28, 0x11, 0x09, 0x09, 0x08, 0x05,
-    0x05, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x05,
-    0x05, 0x01, 0x01, 0x02, 0x05, 0x05, 0x08, 0x26, 0x44, 0x4e, 0x52, 0x53,
-    0x52, 0x4e, 0x52, 0x4a, 0x49, 0x49, 0x49, 0x4a, 0x56, 0x55, 0x56, 0x56,
-    0x57, 0x56, 0x56, 0x56, 0x5f, 0x56, 0x56, 0x5b, 0x5f, 0x5f, 0x5e, 0x5e,
-    0x63, 0x63, 0x5e, 0x63, 0x68, 0x68, 0x68, 0x68, 0x6a, 0x6a, 0x68, 0x6a,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x66, 0x66, 0x6c, 0x6c, 0x6c, 0x66, 0x6c, 0x68, 0x6c, 0x71,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x71, 0x71, 0x6c, 0x74,
-    0x6c, 0x6c, 0x74, 0x74, 0x76, 0x76, 0x7d, 0x7d, 0x81, 0x82, 0x8a, 0x88,
-    0x8a, 0x82, 0x4f, 0x21, 0x0f, 0x0b, 0x06, 0x09, 0x09, 0x04, 0x04, 0x04,
-    0x04, 0x00, 0x00, 0x00, 0x32, 0xb9, 0xd6, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3,
-    0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xd6, 0xe3, 0xef, 0xe6, 0xd6,
-    0xc6, 0xc6, 0xc0, 0xb7, 0xb0, 0xee, 0xfd, 0xee, 0xe7, 0xb7, 0x9e, 0x9e,
-    0xa6, 0x92, 0xb0, 0x9e, 0x79, 0x6b, 0x5d, 0x5d, 0x48, 0x33, 0x33, 0x2e,
-    0x27, 0x23, 0x14, 0x73, 0x8f, 0x79, 0x8c, 0x98, 0x9b, 0x98, 0x2e, 0x15,
-    0x14, 0x23, 0x23, 0x2e, 0x2e, 0x14, 0x15, 0x24, 0x23, 0x54, 0x9b, 0xbd,
-    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x7f, 0x2e, 0x54, 0x6b, 0x64, 0x51,
-    0x51, 0x54, 0x64, 0x7f, 0x8f, 0x9e, 0xa2, 0xa2, 0xb0, 0xb0, 0xd5, 0x92,
-    0x51, 0x54, 0x73, 0x64, 0x73, 0x7f, 0x8f, 0xa2, 0xa2, 0xb0, 0xc4, 0xc9,
-    0xd5, 0xd6, 0xe5, 0xef, 0xfc, 0xe7, 0xc4, 0xd7, 0xd5, 0xd7, 0xd7, 0xd7,
-    0xd7, 0xd7, 0xc7, 0x8d, 0x70, 0x5f, 0x5f, 0x56, 0x56, 0x56, 0x56, 0x55,
-    0x56, 0x56, 0x56, 0x5f, 0x63, 0x5e, 0x63, 0x63, 0x63, 0x63, 0x5f, 0x63,
-    0x63, 0x6c, 0x63, 0x63, 0x5f, 0x5f, 0x5f, 0x5f, 0x63, 0x6c, 0x74, 0x76,
-    0x81, 0x88, 0x91, 0x91, 0x99, 0xa3, 0xa9, 0xa9, 0xb3, 0xb1, 0xb1, 0xbf,
-    0xbf, 0xbf, 0xcb, 0xcb, 0xcb, 0xcb, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
-    0xd3, 0xd3, 0xd3, 0xb8, 0x69, 0x46, 0x46, 0x3c, 0x3c, 0x34, 0x3c, 0x3c,
-    0x34, 0x2f, 0x1d, 0x09, 0x04, 0x04, 0x05, 0x05, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x02, 0x01, 0x03, 0x05, 0x05, 0x01, 0x01, 0x01,
-    0x03, 0x05, 0x08, 0x1f, 0x43, 0x52, 0x52, 0x52, 0x52, 0x4e, 0x49, 0x49,
-    0x41, 0x46, 0x46, 0x4a, 0x56, 0x56, 0x56, 0x57, 0x56, 0x56, 0x56, 0x55,
-    0x55, 0x56, 0x56, 0x55, 0x56, 0x5f, 0x5b, 0x5b, 0x5f, 0x5f, 0x5e, 0x5e,
-    0x68, 0x68, 0x68, 0x63, 0x63, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x66,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6c, 0x6c, 0x68, 0x6c, 0x6c, 0x6c,
-    0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x68, 0x6c, 0x6c, 0x68, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6e, 0x6c, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c, 0x74, 0x74, 0x76, 0x76,
-    0x76, 0x7a, 0x82, 0x81, 0x88, 0x8a, 0x8a, 0x94, 0x91, 0x7a, 0x3a, 0x18,
-    0x0b, 0x0b, 0x06, 0x09, 0x09, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x24, 0xb9, 0xd6, 0xd6, 0xe3, 0xe3, 0xe3, 0xec, 0xec, 0xe3, 0xd6,
-    0xc6, 0xc6, 0xc9, 0xd7, 0xf2, 0xf2, 0xc6, 0xc6, 0xc0, 0xb7, 0xaf, 0xaf,
-    0xb9, 0xeb, 0xe6, 0xd7, 0xb7, 0x9e, 0x98, 0x79, 0x80, 0x92, 0xd5, 0xc0,
-    0x98, 0x6b, 0x6b, 0x6b, 0x5d, 0x48, 0x33, 0x2e, 0x27, 0x27, 0x27, 0x40,
-    0x79, 0x79, 0x8c, 0x8f, 0x98, 0x79, 0x23, 0x14, 0x23, 0x2e, 0x27, 0x3b,
-    0x40, 0x27, 0x15, 0x23, 0x23, 0x2e, 0x7f, 0xad, 0xbd, 0xaf, 0xaf, 0xaf,
-    0xbd, 0x9e, 0x7f, 0x40, 0x51, 0x7f, 0x8c, 0x8f, 0x7f, 0x73, 0x6b, 0x7f,
-    0x7f, 0x8f, 0xa2, 0xb0, 0xb0, 0xb7, 0xd7, 0xe6, 0x92, 0x64, 0x73, 0x73,
-    0x7f, 0x8f, 0x8f, 0xa2, 0xa2, 0xa2, 0xb0, 0xc4, 0xc4, 0xc9, 0xc9, 0xe5,
-    0xef, 0xe7, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xb9, 0x8d, 0x7e, 0x70, 0x5c,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x5f, 0x5f, 0x63, 0x63, 0x63, 0x68, 0x6a, 0x63, 0x5e, 0x5e, 0x5e, 0x5f,
-    0x5f, 0x63, 0x5f, 0x5f, 0x53, 0x56, 0x5f, 0x68, 0x6c, 0x74, 0x76, 0x81,
-    0x81, 0x88, 0x91, 0x91, 0x99, 0xa3, 0xa7, 0xa7, 0xa7, 0xb1, 0xb1, 0xb3,
-    0xb3, 0xb1, 0xbf, 0xbf, 0xbf, 0xc1, 0xbf, 0xbf, 0xbf, 0xbf, 0xb3, 0x7b,
-    0x46, 0x3c, 0x3c, 0x34, 0x34, 0x2d, 0x34, 0x34, 0x30, 0x1e, 0x09, 0x04,
-    0x04, 0x05, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x02, 0x01, 0x05, 0x03, 0x05, 0x05, 0x00, 0x00, 0x03, 0x05, 0x0a, 0x19,
-    0x3c, 0x46, 0x46, 0x46, 0x44, 0x44, 0x44, 0x46, 0x44, 0x44, 0x46, 0x46,
-    0x52, 0x53, 0x53, 0x52, 0x53, 0x53, 0x53, 0x55, 0x55, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x5b, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x66, 0x5e, 0x63,
-    0x68, 0x68, 0x68, 0x68, 0x63, 0x68, 0x68, 0x68, 0x66, 0x68, 0x68, 0x68,
-    0x68, 0x6a, 0x68, 0x68, 0x68, 0x68, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x68, 0x68, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x74, 0x74, 0x74, 0x76, 0x76, 0x76, 0x7d, 0x81, 0x82, 0x82,
-    0x89, 0x89, 0x94, 0x94, 0x9d, 0x89, 0x3a, 0x18, 0x06, 0x06, 0x06, 0x04,
-    0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xae, 0xc4,
-    0xc9, 0xd5, 0xe3, 0xec, 0xe3, 0xd6, 0xc9, 0xc6, 0xb7, 0xb7, 0xb0, 0xeb,
-    0xe7, 0xc9, 0xb7, 0xb7, 0xb7, 0xb7, 0xaf, 0xb0, 0xb0, 0xb0, 0xc4, 0xb0,
-    0xa2, 0x7f, 0x6b, 0x6b, 0x6b, 0x9e, 0xaf, 0xad, 0x98, 0x79, 0x79, 0x6b,
-    0x64, 0x48, 0x33, 0x33, 0x3b, 0x2e, 0x23, 0x27, 0x3b, 0x40, 0x40, 0x51,
-    0x64, 0x3b, 0x24, 0x23, 0x61, 0x92, 0x2e, 0x51, 0x7f, 0x33, 0x0f, 0x27,
-    0x27, 0x24, 0x2e, 0x64, 0x9b, 0x9b, 0x7f, 0x6b, 0x40, 0x54, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x9b, 0x9e, 0xaf, 0x8f, 0x8f, 0x8f, 0xb0, 0xd7, 0xe7, 0xeb,
-    0xeb, 0xe5, 0xe5, 0xf2, 0xeb, 0xa6, 0x92, 0x7f, 0x7f, 0x8f, 0xa2, 0xa2,
-    0xa2, 0xb0, 0xb0, 0xc4, 0xc4, 0xc4, 0xc4, 0xe5, 0xe5, 0xc7, 0x8d, 0x8d,
-    0x7e, 0x7e, 0x70, 0x6d, 0x65, 0x5b, 0x56, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x56, 0x56, 0x55, 0x4d, 0x53, 0x4a, 0x4a, 0x56, 0x5f, 0x5f, 0x63, 0x63,
-    0x68, 0x68, 0x63, 0x63, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x56,
-    0x41, 0x49, 0x4a, 0x53, 0x55, 0x5e, 0x63, 0x6a, 0x6c, 0x74, 0x76, 0x81,
-    0x81, 0x88, 0x91, 0x91, 0x99, 0x99, 0xa3, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9,
-    0xa7, 0xa9, 0xb1, 0xa7, 0xa9, 0xa9, 0x82, 0x46, 0x34, 0x34, 0x30, 0x2f,
-    0x30, 0x2f, 0x2d, 0x2f, 0x26, 0x11, 0x04, 0x04, 0x03, 0x05, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x01, 0x01, 0x05, 0x05,
-    0x05, 0x03, 0x01, 0x01, 0x00, 0x05, 0x0a, 0x19, 0x37, 0x44, 0x3e, 0x46,
-    0x46, 0x44, 0x3e, 0x3d, 0x3e, 0x3d, 0x46, 0x46, 0x4a, 0x4a, 0x52, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x4e, 0x4e, 0x53, 0x55, 0x56, 0x56, 0x56, 0x55,
-    0x56, 0x5e, 0x5e, 0x5f, 0x5f, 0x5b, 0x5e, 0x5e, 0x5e, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x6a, 0x68, 0x68, 0x68, 0x68, 0x66, 0x6c, 0x6c, 0x68, 0x68, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x74, 0x74, 0x76,
-    0x76, 0x76, 0x7d, 0x81, 0x81, 0x88, 0x88, 0x91, 0x94, 0x94, 0x9d, 0x9d,
-    0xa7, 0x85, 0x38, 0x0b, 0x06, 0x06, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xc7, 0x92, 0xa6, 0xd7, 0xef, 0xe3,
-    0xd6, 0xc9, 0xc0, 0xb7, 0xb7, 0xb0, 0xc4, 0xe5, 0xc9, 0xc6, 0xb7, 0xb7,
-    0xb7, 0xaf, 0xaf, 0xb0, 0xb0, 0xa2, 0xa2, 0xa2, 0x8f, 0x7f, 0x6b, 0x6b,
-    0x54, 0x54, 0x7f, 0x9b, 0x8c, 0x79, 0x6b, 0x6b, 0x5d, 0x48, 0x48, 0x40,
-    0x2e, 0x23, 0x2e, 0x33, 0x2e, 0x14, 0x14, 0x27, 0x23, 0x23, 0x27, 0x40,
-    0xe6, 0xc7, 0x72, 0xd9, 0xcd, 0x6b, 0x14, 0x2e, 0x33, 0x23, 0x23, 0x2e,
-    0x40, 0x6b, 0x79, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x9b, 0xad, 0x9b, 0x9e,
-    0xc0, 0xc6, 0xc0, 0xd5, 0xe5, 0xef, 0xf2, 0xf2, 0xef, 0xef, 0xe5, 0xef,
-    0xef, 0xe5, 0xc9, 0xc9, 0xc0, 0xc4, 0xa2, 0xa2, 0xb0, 0xb0, 0xc4, 0xc9,
-    0xd7, 0xd7, 0xe5, 0xe5, 0xd7, 0x9a, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x60,
-    0x5b, 0x5b, 0x5e, 0x5f, 0x56, 0x55, 0x56, 0x56, 0x56, 0x53, 0x4d, 0x53,
-    0x4a, 0x4a, 0x4d, 0x56, 0x5f, 0x5e, 0x5e, 0x5f, 0x68, 0x68, 0x68, 0x5f,
-    0x5e, 0x5e, 0x5f, 0x5f, 0x56, 0x56, 0x56, 0x56, 0x3f, 0x3f, 0x45, 0x3f,
-    0x3e, 0x3e, 0x41, 0x53, 0x56, 0x5e, 0x68, 0x6c, 0x75, 0x76, 0x7d, 0x81,
-    0x88, 0x88, 0x91, 0x91, 0x91, 0x97, 0x91, 0x97, 0x99, 0x97, 0x91, 0x91,
-    0x97, 0x7a, 0x44, 0x2f, 0x2d, 0x2f, 0x28, 0x28, 0x28, 0x28, 0x2c, 0x26,
-    0x19, 0x09, 0x04, 0x05, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x01, 0x01, 0x02, 0x01, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x00,
-    0x01, 0x05, 0x0a, 0x0e, 0x29, 0x3e, 0x37, 0x3c, 0x3c, 0x3e, 0x3d, 0x3d,
-    0x3e, 0x3e, 0x44, 0x52, 0x52, 0x4a, 0x4a, 0x4a, 0x53, 0x4d, 0x4a, 0x4a,
-    0x4a, 0x4d, 0x4d, 0x53, 0x53, 0x56, 0x55, 0x55, 0x56, 0x56, 0x56, 0x5f,
-    0x5f, 0x5b, 0x5e, 0x5e, 0x5e, 0x63, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x66, 0x68, 0x68, 0x68, 0x66, 0x68, 0x68, 0x68, 0x68, 0x66, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x6c, 0x68, 0x6c, 0x68, 0x68, 0x68, 0x6c, 0x6c, 0x6c,
-    0x6e, 0x6c, 0x75, 0x74, 0x74, 0x74, 0x76, 0x7d, 0x7a, 0x7d, 0x81, 0x81,
-    0x88, 0x8a, 0x94, 0x94, 0x9d, 0x99, 0xa7, 0xa7, 0x96, 0x3a, 0x0b, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x8e, 0xd7, 0x80, 0x92, 0xe6, 0xe3, 0xd5, 0xc9, 0xc4, 0xb7, 0xb7,
-    0xc4, 0xb7, 0xb0, 0xc4, 0xd7, 0xc9, 0xc0, 0xc0, 0xc0, 0xaf, 0xb0, 0xb0,
-    0xa2, 0xb0, 0xb7, 0xaf, 0x9e, 0x7f, 0x64, 0x5d, 0x48, 0x51, 0x51, 0x54,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x5d, 0x40, 0x2e, 0x2e, 0x3b, 0x54, 0x40,
-    0x24, 0x1c, 0x2e, 0x2e, 0x24, 0x1c, 0x32, 0xa6, 0xd7, 0xc4, 0xae, 0xc4,
-    0xe5, 0xc0, 0x3b, 0x2e, 0x48, 0x40, 0x2e, 0x2e, 0x3b, 0x51, 0x7f, 0x9e,
-    0xaf, 0xc6, 0xd5, 0x8f, 0x9e, 0xaf, 0xc6, 0xc0, 0xc0, 0xd0, 0xd0, 0xd0,
-    0xd0, 0xd6, 0xe3, 0xe5, 0xe5, 0xe5, 0xd7, 0xd7, 0xd7, 0xd5, 0xc9, 0xd5,
-    0xd6, 0xd6, 0xc9, 0xc4, 0xc9, 0xd5, 0xd6, 0xd6, 0xe5, 0xe5, 0xe5, 0xd5,
-    0x8e, 0x5b, 0x60, 0x60, 0x55, 0x5b, 0x5b, 0x56, 0x55, 0x55, 0x5e, 0x5f,
-    0x56, 0x56, 0x55, 0x56, 0x56, 0x53, 0x53, 0x4d, 0x4a, 0x4d, 0x55, 0x5e,
-    0x56, 0x5e, 0x5e, 0x5f, 0x5e, 0x5e, 0x5e, 0x5e, 0x5f, 0x5e, 0x5e, 0x5f,
-    0x56, 0x56, 0x56, 0x56, 0x31, 0x31, 0x2d, 0x29, 0x25, 0x1b, 0x25, 0x2d,
-    0x37, 0x49, 0x55, 0x56, 0x5f, 0x68, 0x6a, 0x6c, 0x74, 0x76, 0x76, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x74, 0x69, 0x3e, 0x28, 0x28,
-    0x28, 0x28, 0x28, 0x26, 0x26, 0x26, 0x1f, 0x1b, 0x08, 0x04, 0x05, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x00, 0x00, 0x03, 0x05, 0x0a,
-    0x1f, 0x37, 0x37, 0x34, 0x34, 0x37, 0x3e, 0x3e, 0x3d, 0x3e, 0x3e, 0x46,
-    0x49, 0x49, 0x49, 0x4a, 0x4a, 0x4a, 0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x4e,
-    0x53, 0x53, 0x53, 0x55, 0x56, 0x56, 0x56, 0x56, 0x5f, 0x5e, 0x5f, 0x5f,
-    0x5b, 0x5e, 0x5e, 0x68, 0x68, 0x68, 0x63, 0x68, 0x68, 0x68, 0x63, 0x63,
-    0x6a, 0x6a, 0x68, 0x68, 0x68, 0x6a, 0x68, 0x6a, 0x6a, 0x68, 0x68, 0x68,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x74, 0x76,
-    0x76, 0x76, 0x76, 0x7d, 0x81, 0x81, 0x88, 0x88, 0x90, 0x94, 0x9d, 0x99,
-    0xa7, 0xa7, 0xb1, 0xb1, 0x65, 0x0b, 0x0b, 0x0f, 0x0b, 0x06, 0x06, 0x04,
-    0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xd7, 0xc4, 0x92,
-    0xb9, 0xe5, 0xe5, 0xd7, 0xc9, 0xc9, 0xc4, 0xc4, 0xc4, 0xc4, 0xb0, 0xa8,
-    0xa8, 0xd5, 0xc0, 0xb7, 0xc0, 0xc0, 0xb7, 0xc0, 0xc0, 0xd7, 0xe6, 0xd7,
-    0xb0, 0x8f, 0x6b, 0x6b, 0x5d, 0x92, 0xe5, 0xd9, 0xa4, 0x7f, 0x8c, 0x79,
-    0x6b, 0x48, 0x51, 0x48, 0x6b, 0x7f, 0x48, 0x23, 0x24, 0x3b, 0x3b, 0x23,
-    0x23, 0x23, 0x61, 0xb7, 0xb0, 0xb0, 0xa6, 0xb0, 0xc9, 0xc6, 0x73, 0x27,
-    0x6b, 0x6b, 0x51, 0x51, 0x7f, 0xb7, 0xd5, 0xdd, 0xb7, 0xd5, 0xef, 0xa4,
-    0x73, 0xa2, 0xc0, 0xd0, 0xc6, 0xc6, 0xc6, 0xd0, 0xd0, 0xc6, 0xc9, 0xc9,
-    0xc9, 0xc9, 0xc4, 0xc4, 0xb0, 0xa2, 0xb7, 0xc9, 0xd5, 0xd6, 0xe3, 0xe5,
-    0xd6, 0xd6, 0xd6, 0xd6, 0xe3, 0xd6, 0xc4, 0x8d, 0x5b, 0x57, 0x57, 0x5b,
-    0x56, 0x56, 0x5e, 0x5b, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x55, 0x56, 0x53, 0x4a, 0x49, 0x4d, 0x4d, 0x53, 0x56, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x63, 0x5f, 0x5e, 0x5f, 0x5f, 0x56, 0x56, 0x56, 0x53,
-    0x1f, 0x1f, 0x19, 0x16, 0x0e, 0x0e, 0x19, 0x1f, 0x29, 0x37, 0x41, 0x41,
-    0x49, 0x4a, 0x56, 0x56, 0x5e, 0x63, 0x68, 0x6a, 0x6a, 0x6c, 0x6a, 0x68,
-    0x6a, 0x63, 0x4e, 0x43, 0x2d, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
-    0x1e, 0x1f, 0x0d, 0x07, 0x03, 0x05, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x05, 0x05, 0x05, 0x05, 0x0a,
-    0x05, 0x05, 0x02, 0x00, 0x01, 0x01, 0x05, 0x0a, 0x19, 0x30, 0x34, 0x30,
-    0x2d, 0x30, 0x30, 0x37, 0x37, 0x37, 0x3d, 0x3e, 0x46, 0x44, 0x41, 0x46,
-    0x46, 0x46, 0x49, 0x49, 0x49, 0x4a, 0x4a, 0x4e, 0x4d, 0x4d, 0x4d, 0x53,
-    0x56, 0x56, 0x56, 0x56, 0x5b, 0x56, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x5f,
-    0x5e, 0x68, 0x68, 0x63, 0x63, 0x63, 0x63, 0x68, 0x68, 0x6a, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x6a, 0x6c, 0x6c, 0x6c, 0x6a, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x74, 0x74, 0x78, 0x7a, 0x7d, 0x81, 0x81, 0x81,
-    0x81, 0x88, 0x91, 0x94, 0x94, 0x9d, 0x9d, 0xa7, 0xb1, 0xb4, 0xbf, 0xbf,
-    0x85, 0x22, 0x15, 0x15, 0x0f, 0x0b, 0x06, 0x06, 0x04, 0x04, 0x04, 0x04,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x61, 0xb9, 0xc4, 0xd7, 0xe5, 0xd7, 0xd7,
-    0xc9, 0xc9, 0xc9, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xb9, 0xb9, 0xc4, 0xd5,
-    0xe6, 0xe6, 0xe3, 0xd5, 0xc6, 0xb0, 0xc4, 0xc4, 0xc6, 0xc6, 0xc0, 0x9e,
-    0x7f, 0x8f, 0xb9, 0xd7, 0xe5, 0xd5, 0xc0, 0xa2, 0x92, 0x8f, 0x9e, 0x9b,
-    0x79, 0x64, 0x23, 0x27, 0x51, 0x40, 0x27, 0x2e, 0x2e, 0x23, 0x7f, 0x9e,
-    0x9e, 0xb0, 0xb0, 0xa2, 0xa2, 0xaf, 0x73, 0x24, 0x64, 0x8c, 0x9e, 0xaf,
-    0xaf, 0xc0, 0xd5, 0xe5, 0xb9, 0xa6, 0xd7, 0xa4, 0x64, 0x64, 0x7f, 0xb9,
-    0xe3, 0xdd, 0xd5, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xb7, 0xb0, 0xa2, 0x92,
-    0x7f, 0x8f, 0xa2, 0xb0, 0xc4, 0xd5, 0xd6, 0xd6, 0xe5, 0xd5, 0xc9, 0xc9,
-    0xc4, 0x8d, 0x67, 0x56, 0x56, 0x56, 0x56, 0x57, 0x56, 0x5b, 0x5b, 0x4e,
-    0x57, 0x56, 0x57, 0x5f, 0x56, 0x55, 0x5b, 0x53, 0x53, 0x53, 0x56, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x56, 0x56, 0x56, 0x56, 0x5f, 0x56, 0x5f, 0x63,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x56, 0x56, 0x4a, 0x4a, 0x19, 0x19, 0x0e, 0x0a,
-    0x0e, 0x19, 0x1f, 0x29, 0x29, 0x31, 0x2d, 0x37, 0x3e, 0x3e, 0x41, 0x49,
-    0x4a, 0x53, 0x53, 0x56, 0x56, 0x53, 0x4a, 0x46, 0x3d, 0x37, 0x28, 0x26,
-    0x1f, 0x26, 0x26, 0x26, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1a, 0x07, 0x05,
-    0x05, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x01, 0x02, 0x05, 0x05, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x00,
-    0x01, 0x02, 0x03, 0x05, 0x0e, 0x28, 0x2d, 0x2d, 0x2d, 0x30, 0x30, 0x30,
-    0x31, 0x37, 0x37, 0x3e, 0x3e, 0x3e, 0x3e, 0x3f, 0x3f, 0x46, 0x44, 0x46,
-    0x41, 0x49, 0x49, 0x4a, 0x53, 0x4e, 0x4e, 0x53, 0x56, 0x56, 0x56, 0x55,
-    0x5f, 0x5b, 0x5e, 0x5e, 0x5f, 0x5f, 0x5e, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x66, 0x68, 0x6a, 0x6a, 0x68, 0x68, 0x66, 0x68, 0x68, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6a, 0x6c, 0x71, 0x6c, 0x6c, 0x6c, 0x6c, 0x74, 0x74, 0x74,
-    0x76, 0x76, 0x7d, 0x7d, 0x81, 0x84, 0x88, 0x88, 0x8a, 0x90, 0x94, 0x9d,
-    0x9d, 0xa9, 0xa7, 0xb4, 0xbf, 0xbf, 0xcb, 0xbf, 0x96, 0x58, 0x50, 0x2b,
-    0x0f, 0x0b, 0x06, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
-    0x00, 0x0b, 0x4b, 0xc4, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd5, 0xe5,
-    0xd5, 0xd7, 0xd5, 0xd6, 0xd6, 0xc4, 0xc4, 0xd5, 0xd5, 0xd0, 0xc0, 0xa2,
-    0xa2, 0x8f, 0x7f, 0xa4, 0x9e, 0x9e, 0x8f, 0x8f, 0x8c, 0x79, 0x7f, 0xb0,
-    0xc4, 0xc0, 0xc0, 0xc0, 0xaf, 0x9e, 0x9e, 0x73, 0x40, 0x3b, 0x51, 0x64,
-    0x51, 0x3b, 0x3b, 0x3b, 0x3b, 0x2e, 0x64, 0x8f, 0x8f, 0xaf, 0xaf, 0x9e,
-    0x9e, 0x7f, 0x2e, 0x0f, 0x2e, 0x7f, 0x9b, 0x9e, 0xb0, 0xb0, 0xc0, 0xc0,
-    0x92, 0x80, 0xb0, 0xa2, 0x7f, 0x73, 0x7f, 0x7f, 0xc7, 0xf2, 0xf2, 0xe5,
-    0xc4, 0xa2, 0xb0, 0xb0, 0xb0, 0xa2, 0x92, 0x92, 0x92, 0xa2, 0xa2, 0xa6,
-    0xb0, 0xc4, 0xd5, 0xd5, 0xd6, 0xe5, 0xb9, 0xc4, 0xc7, 0xbc, 0x87, 0x52,
-    0x53, 0x56, 0x53, 0x53, 0x56, 0x57, 0x4a, 0x46, 0x4e, 0x53, 0x53, 0x53,
-    0x56, 0x56, 0x56, 0x56, 0x53, 0x53, 0x56, 0x56, 0x55, 0x56, 0x56, 0x55,
-    0x56, 0x56, 0x55, 0x56, 0x55, 0x56, 0x55, 0x56, 0x5e, 0x5f, 0x56, 0x56,
-    0x56, 0x53, 0x53, 0x56, 0x0e, 0x16, 0x16, 0x16, 0x19, 0x1f, 0x25, 0x25,
-    0x1f, 0x19, 0x19, 0x1e, 0x1f, 0x1f, 0x25, 0x2a, 0x37, 0x37, 0x3e, 0x37,
-    0x34, 0x2d, 0x28, 0x26, 0x1e, 0x1e, 0x1e, 0x1a, 0x1e, 0x1e, 0x26, 0x1e,
-    0x1e, 0x1d, 0x16, 0x1d, 0x16, 0x0e, 0x05, 0x01, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x05, 0x05,
-    0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x00, 0x02, 0x02, 0x01, 0x03,
-    0x0a, 0x1f, 0x2d, 0x2d, 0x2d, 0x29, 0x29, 0x2c, 0x2c, 0x30, 0x31, 0x30,
-    0x37, 0x37, 0x3e, 0x3e, 0x3f, 0x3e, 0x44, 0x46, 0x47, 0x49, 0x4a, 0x4a,
-    0x53, 0x4a, 0x4e, 0x52, 0x56, 0x56, 0x56, 0x55, 0x55, 0x5b, 0x5e, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5e, 0x68, 0x68, 0x68, 0x68, 0x66, 0x66, 0x68, 0x6a,
-    0x6a, 0x68, 0x68, 0x68, 0x66, 0x66, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x71,
-    0x71, 0x71, 0x74, 0x75, 0x74, 0x76, 0x76, 0x76, 0x7d, 0x7d, 0x81, 0x81,
-    0x88, 0x8a, 0x91, 0x91, 0x90, 0x97, 0x9d, 0xa7, 0xa7, 0xb3, 0xb8, 0xbf,
-    0xbf, 0xcb, 0xd3, 0xcc, 0xb6, 0xab, 0xa1, 0x58, 0x18, 0x06, 0x06, 0x06,
-    0x06, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x15, 0x35, 0x7e, 0xca, 0xc7,
-    0xa6, 0xb9, 0xd5, 0xe5, 0xe5, 0xe5, 0xd5, 0xe5, 0xe5, 0xd6, 0xd6, 0xd6,
-    0xc6, 0xc6, 0xa2, 0x73, 0x51, 0x51, 0x51, 0x80, 0x73, 0x51, 0x51, 0x54,
-    0x64, 0x6b, 0x6b, 0x5d, 0x48, 0x33, 0x3b, 0x64, 0x64, 0x73, 0x8f, 0x8f,
-    0x7f, 0x6b, 0x64, 0x51, 0x73, 0x8f, 0x7f, 0x64, 0x51, 0x40, 0x51, 0x51,
-    0x51, 0x3b, 0x51, 0x51, 0x2e, 0x54, 0x64, 0x51, 0x2e, 0x2e, 0x23, 0x0f,
-    0x24, 0x27, 0x64, 0x9e, 0x9e, 0x9e, 0xa2, 0x9e, 0xa2, 0xa2, 0x9e, 0xaf,
-    0xaf, 0xaf, 0xb0, 0xa2, 0xa2, 0xeb, 0xfc, 0xeb, 0xf2, 0xc7, 0x8f, 0x9e,
-    0xb0, 0xb7, 0xc4, 0xc4, 0xc9, 0xc9, 0xd7, 0xd7, 0xc4, 0xc4, 0xc4, 0xc9,
-    0xd7, 0xc4, 0x8e, 0xae, 0xc7, 0xd9, 0xca, 0xc2, 0x50, 0x28, 0x42, 0x67,
-    0x42, 0x4f, 0x46, 0x4a, 0x4e, 0x4e, 0x4e, 0x56, 0x56, 0x56, 0x56, 0x53,
-    0x53, 0x56, 0x53, 0x56, 0x56, 0x63, 0x5f, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x5f, 0x56, 0x55, 0x5e, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x0a, 0x0a, 0x0e, 0x0e, 0x16, 0x16, 0x19, 0x1a, 0x0e, 0x05, 0x03, 0x03,
-    0x03, 0x05, 0x05, 0x0a, 0x0e, 0x19, 0x1e, 0x19, 0x16, 0x16, 0x0e, 0x11,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x11, 0x16, 0x16, 0x1e, 0x1e, 0x1d, 0x16, 0x16,
-    0x0a, 0x05, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01,
-    0x01, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x05, 0x05, 0x02, 0x01, 0x01, 0x01, 0x05, 0x05, 0x19, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x29, 0x29, 0x2d, 0x31, 0x37, 0x37, 0x3e,
-    0x3f, 0x3e, 0x3f, 0x44, 0x46, 0x47, 0x4d, 0x4a, 0x53, 0x4e, 0x4e, 0x4e,
-    0x53, 0x56, 0x56, 0x56, 0x55, 0x5f, 0x5e, 0x5f, 0x5f, 0x63, 0x5e, 0x63,
-    0x68, 0x68, 0x63, 0x63, 0x63, 0x68, 0x68, 0x6a, 0x68, 0x6c, 0x6c, 0x6a,
-    0x6c, 0x6e, 0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x75, 0x74, 0x75, 0x76, 0x76,
-    0x76, 0x76, 0x7d, 0x7d, 0x81, 0x81, 0x88, 0x88, 0x91, 0x94, 0x91, 0x97,
-    0x99, 0xa3, 0xa9, 0xb1, 0xb4, 0xc1, 0xbf, 0xcb, 0xcb, 0xd8, 0xd3, 0xcb,
-    0xbf, 0xac, 0x85, 0x38, 0x12, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x04,
-    0x1c, 0x4b, 0x8d, 0xca, 0xed, 0xee, 0xd9, 0xcd, 0xc7, 0xae, 0xc4, 0xef,
-    0xe5, 0xd5, 0xd5, 0xd5, 0xd5, 0xc6, 0xc0, 0xb0, 0x92, 0x61, 0x40, 0x40,
-    0x3b, 0x3b, 0x73, 0x73, 0x51, 0x54, 0x64, 0x6b, 0x6b, 0x64, 0x54, 0x40,
-    0x40, 0x54, 0x64, 0x54, 0x64, 0x8f, 0x7f, 0x7f, 0x6b, 0x6b, 0x64, 0x8f,
-    0xb0, 0xa2, 0x7f, 0x64, 0x54, 0x64, 0x64, 0x64, 0x64, 0x51, 0x73, 0x3b,
-    0x2e, 0x40, 0x3b, 0x27, 0x23, 0x27, 0x3b, 0x14, 0x23, 0x14, 0x14, 0x27,
-    0x64, 0x8c, 0x8f, 0x9e, 0x9e, 0x64, 0x32, 0x7f, 0xaf, 0xc6, 0xd0, 0xd0,
-    0xb7, 0xc7, 0xeb, 0xf2, 0xe5, 0xe7, 0xa4, 0x8f, 0xb0, 0xb7, 0xc4, 0xc9,
-    0xc9, 0xd6, 0xe5, 0xf2, 0xf2, 0xe5, 0xd7, 0xc4, 0xb9, 0x80, 0x73, 0x80,
-    0xae, 0xc7, 0xd9, 0xca, 0xdc, 0x9a, 0xca, 0xae, 0x39, 0x2b, 0x2f, 0x43,
-    0x57, 0x4e, 0x52, 0x53, 0x53, 0x53, 0x56, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x55, 0x5e,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x78, 0x0e, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x05, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x08, 0x0a, 0x0a, 0x16, 0x1a, 0x16, 0x0e, 0x0a, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01,
-    0x03, 0x05, 0x05, 0x0a, 0x0a, 0x07, 0x0a, 0x07, 0x0a, 0x0a, 0x05, 0x01,
-    0x01, 0x00, 0x01, 0x01, 0x05, 0x0e, 0x26, 0x2c, 0x29, 0x29, 0x2c, 0x2c,
-    0x29, 0x29, 0x29, 0x29, 0x29, 0x30, 0x31, 0x37, 0x37, 0x3e, 0x3f, 0x3f,
-    0x44, 0x47, 0x49, 0x49, 0x4a, 0x4a, 0x52, 0x53, 0x53, 0x56, 0x56, 0x55,
-    0x55, 0x5f, 0x5f, 0x5f, 0x5e, 0x5e, 0x5e, 0x63, 0x68, 0x63, 0x68, 0x63,
-    0x6a, 0x68, 0x68, 0x68, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x74, 0x74,
-    0x75, 0x75, 0x75, 0x75, 0x76, 0x78, 0x7d, 0x7d, 0x7d, 0x84, 0x84, 0x88,
-    0x8a, 0x8a, 0x91, 0x91, 0x91, 0x9d, 0x9d, 0xa7, 0xa7, 0xb1, 0xb1, 0xbf,
-    0xcb, 0xcb, 0xcb, 0xd3, 0xd8, 0xcb, 0xc1, 0xb8, 0xa3, 0x71, 0x2b, 0x06,
-    0x0b, 0x06, 0x06, 0x06, 0x06, 0x1c, 0x4b, 0xae, 0xeb, 0xeb, 0xd9, 0xb9,
-    0xb9, 0xb9, 0xb9, 0xb9, 0xc7, 0xd9, 0xd7, 0xd7, 0xc4, 0xc4, 0xb0, 0xa6,
-    0x92, 0x73, 0x54, 0x51, 0x51, 0x40, 0x40, 0x40, 0x40, 0x64, 0x7f, 0x54,
-    0x73, 0x8f, 0x9e, 0x7f, 0x7f, 0x64, 0x54, 0x73, 0xa4, 0xa2, 0xb0, 0xb7,
-    0xaf, 0x9e, 0x8f, 0x7f, 0x7f, 0x7f, 0x73, 0xc0, 0xb0, 0xa2, 0x7f, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x64, 0xa2, 0x3b, 0x40, 0x48, 0x3b, 0x27,
-    0x23, 0x32, 0x40, 0x23, 0x27, 0x1c, 0x14, 0x14, 0x23, 0x48, 0x6b, 0x8f,
-    0x64, 0x24, 0x23, 0x2e, 0x7f, 0xc0, 0xd0, 0xdd, 0xd0, 0xc9, 0xd5, 0xe5,
-    0xd7, 0xc9, 0x61, 0x51, 0x8f, 0xb0, 0xb7, 0xc4, 0xc4, 0xc4, 0xd6, 0xe5,
-    0xe5, 0xd7, 0xd7, 0xc4, 0xb0, 0x80, 0x80, 0x92, 0xae, 0xae, 0xd9, 0xeb,
-    0xee, 0xee, 0xcd, 0x61, 0x22, 0x22, 0x18, 0x2b, 0x3c, 0x4e, 0x52, 0x4a,
-    0x44, 0x4a, 0x56, 0x56, 0x56, 0x4a, 0x4a, 0x4a, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x5f, 0x56, 0x56, 0x5e, 0x53, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x55, 0x56, 0x5f, 0x0a, 0x0a, 0x0a, 0x0a, 0x04, 0x04, 0x03, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x00, 0x00, 0x05, 0x05, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x08, 0x08, 0x08, 0x0a, 0x0a, 0x0a, 0x03, 0x05, 0x0a,
-    0x0a, 0x0a, 0x05, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02,
-    0x05, 0x05, 0x01, 0x01, 0x02, 0x01, 0x02, 0x05, 0x05, 0x0a, 0x0a, 0x0e,
-    0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x0a, 0x05, 0x05, 0x01, 0x00, 0x01, 0x02,
-    0x01, 0x05, 0x1e, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x28, 0x2c, 0x29,
-    0x29, 0x29, 0x2c, 0x30, 0x37, 0x37, 0x3e, 0x3e, 0x3f, 0x41, 0x41, 0x41,
-    0x49, 0x4a, 0x4a, 0x53, 0x53, 0x56, 0x56, 0x55, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5e, 0x5e, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6c, 0x6c,
-    0x6c, 0x71, 0x74, 0x74, 0x74, 0x74, 0x76, 0x7d, 0x7d, 0x78, 0x7d, 0x7d,
-    0x81, 0x81, 0x81, 0x81, 0x88, 0x88, 0x88, 0x90, 0x94, 0x94, 0x9d, 0x9d,
-    0x9d, 0xa7, 0xa7, 0xb1, 0xb4, 0xbf, 0xbf, 0xcb, 0xcb, 0xd3, 0xd3, 0xd3,
-    0xcb, 0xbf, 0xb4, 0x97, 0x62, 0x2b, 0x0b, 0x06, 0x06, 0x06, 0x06, 0x0f,
-    0x4b, 0xae, 0xd9, 0xe7, 0xd9, 0xa6, 0x8e, 0x72, 0x72, 0x61, 0x61, 0x61,
-    0xa6, 0xd7, 0xd7, 0xc4, 0xc4, 0xa6, 0x92, 0x80, 0x64, 0x64, 0x54, 0x54,
-    0x51, 0x51, 0x54, 0x54, 0x73, 0xa6, 0xb0, 0xc4, 0xc4, 0xb0, 0x9e, 0x7f,
-    0x7f, 0x92, 0xc7, 0xe7, 0xe6, 0xd7, 0xc4, 0xc4, 0xb0, 0xa2, 0x8f, 0x8f,
-    0xa2, 0x8f, 0x73, 0xb0, 0xd5, 0xc4, 0xa2, 0x8f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0xb0, 0x51, 0x64, 0x64, 0x40, 0x2e, 0x27, 0x2e, 0x64, 0x3b,
-    0x2e, 0x23, 0x1c, 0x1c, 0x23, 0x40, 0x8f, 0xb0, 0x73, 0x24, 0x27, 0x23,
-    0x3b, 0x7f, 0xb7, 0xc6, 0xd5, 0xe3, 0xd6, 0xc9, 0xb0, 0x8f, 0xa2, 0xa4,
-    0x7f, 0xa2, 0xb0, 0xb0, 0xb7, 0xc6, 0xc9, 0xc9, 0xc4, 0xb9, 0xb9, 0xb0,
-    0xa6, 0xa6, 0xb9, 0xb9, 0xd7, 0xd7, 0xeb, 0xeb, 0xee, 0xc7, 0x92, 0x32,
-    0x18, 0x18, 0x18, 0x22, 0x38, 0x43, 0x52, 0x57, 0x55, 0x55, 0x56, 0x56,
-    0x56, 0x53, 0x53, 0x53, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x5e, 0x5e, 0x55, 0x56, 0x5f, 0x5f, 0x5f, 0x5f, 0x56, 0x56, 0x5f, 0x5f,
-    0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05,
-    0x05, 0x05, 0x02, 0x01, 0x05, 0x05, 0x05, 0x05, 0x0a, 0x0a, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01,
-    0x01, 0x02, 0x02, 0x05, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x05, 0x05, 0x0a, 0x07, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
-    0x0a, 0x0a, 0x05, 0x05, 0x02, 0x01, 0x02, 0x01, 0x01, 0x05, 0x0e, 0x26,
-    0x26, 0x26, 0x29, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x29,
-    0x2d, 0x34, 0x37, 0x3e, 0x3e, 0x3e, 0x41, 0x41, 0x49, 0x4a, 0x4a, 0x53,
-    0x56, 0x56, 0x55, 0x55, 0x5f, 0x5f, 0x5f, 0x63, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x6a, 0x6a, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x74, 0x74, 0x76, 0x76,
-    0x76, 0x78, 0x7d, 0x7d, 0x81, 0x81, 0x81, 0x81, 0x82, 0x88, 0x88, 0x91,
-    0x91, 0x94, 0x94, 0x9d, 0x9d, 0xa3, 0xa7, 0xa7, 0xb1, 0xb1, 0xbf, 0xbf,
-    0xbf, 0xcb, 0xcc, 0xd8, 0xdf, 0xd3, 0xcb, 0xbf, 0xb3, 0xa9, 0x8a, 0x4c,
-    0x21, 0x18, 0x0b, 0x09, 0x09, 0x06, 0x06, 0x24, 0x8e, 0xb9, 0xc8, 0xc8,
-    0xa8, 0x92, 0x8e, 0x8e, 0x72, 0x72, 0x61, 0x72, 0xd7, 0xd7, 0xc4, 0xb0,
-    0xa6, 0x92, 0x73, 0x73, 0x64, 0x64, 0x64, 0x64, 0x64, 0x73, 0x73, 0x92,
-    0xc7, 0xd7, 0xd7, 0xd7, 0xc4, 0xb0, 0xa2, 0xa2, 0xc7, 0xeb, 0xeb, 0xeb,
-    0xe6, 0xd7, 0xc4, 0xb7, 0xb0, 0xb0, 0xa2, 0xb0, 0xb0, 0xa4, 0x64, 0x72,
-    0xc9, 0xd7, 0xc4, 0xa6, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0xa2, 0xb7, 0x92,
-    0x7f, 0x73, 0x51, 0x3b, 0x2e, 0x3b, 0x6b, 0x48, 0x3b, 0x2e, 0x23, 0x23,
-    0x23, 0x2e, 0x73, 0x80, 0x40, 0x2e, 0x27, 0x2e, 0x2e, 0x51, 0x73, 0x8f,
-    0xb0, 0xa2, 0x92, 0x80, 0x73, 0x73, 0x8f, 0xa2, 0xa2, 0x8f, 0x8f, 0x54,
-    0x4b, 0x72, 0x72, 0x72, 0x72, 0x80, 0xa2, 0xb0, 0xc4, 0xc4, 0xc4, 0xd7,
-    0xd7, 0xd7, 0xd9, 0xc7, 0xb9, 0xae, 0x61, 0x1c, 0x06, 0x18, 0x18, 0x22,
-    0x2b, 0x38, 0x3a, 0x43, 0x4e, 0x55, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55,
-    0x53, 0x53, 0x56, 0x56, 0x56, 0x56, 0x55, 0x56, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x56, 0x56, 0x56, 0x5f, 0x5f, 0x5e, 0x5e, 0x05, 0x00, 0x01, 0x01,
-    0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x05, 0x05, 0x05, 0x05,
-    0x07, 0x0e, 0x0c, 0x0c, 0x19, 0x19, 0x0e, 0x0e, 0x0e, 0x0a, 0x05, 0x05,
-    0x05, 0x02, 0x01, 0x00, 0x01, 0x02, 0x03, 0x1f, 0x29, 0x26, 0x2c, 0x29,
-    0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x2a, 0x2d, 0x2d, 0x34,
-    0x37, 0x3e, 0x3f, 0x41, 0x41, 0x47, 0x4a, 0x53, 0x53, 0x56, 0x5e, 0x55,
-    0x5f, 0x63, 0x5e, 0x68, 0x68, 0x68, 0x68, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x74, 0x74, 0x74, 0x74, 0x76, 0x7d, 0x76, 0x7d, 0x81, 0x81, 0x81, 0x88,
-    0x88, 0x88, 0x8a, 0x91, 0x91, 0x91, 0x94, 0x97, 0x99, 0x9d, 0xa7, 0xa7,
-    0xa7, 0xb1, 0xb1, 0xb4, 0xbf, 0xcb, 0xcb, 0xcb, 0xd3, 0xdf, 0xdf, 0xdf,
-    0xcb, 0xbf, 0xb4, 0xa7, 0x97, 0x8a, 0x62, 0x2b, 0x0b, 0x12, 0x09, 0x06,
-    0x06, 0x06, 0x06, 0x15, 0x35, 0x4b, 0x8e, 0xd7, 0xc8, 0xd9, 0xc8, 0xb9,
-    0xb9, 0xa6, 0x8e, 0x92, 0xc4, 0xc4, 0xb9, 0xb9, 0xa6, 0x92, 0x92, 0x80,
-    0x80, 0x80, 0x92, 0x8f, 0x92, 0x80, 0xa6, 0xd9, 0xe7, 0xe6, 0xe6, 0xd7,
-    0xd7, 0xc4, 0xc4, 0xd5, 0xef, 0xeb, 0xe7, 0xe6, 0xd7, 0xd7, 0xc4, 0xb7,
-    0xb0, 0x9e, 0xa2, 0xc0, 0xb0, 0x7f, 0x54, 0x64, 0xa6, 0xc4, 0xb0, 0xa6,
-    0x92, 0x8f, 0x80, 0xa2, 0xa2, 0xb7, 0xc6, 0xb0, 0x7f, 0x7f, 0x64, 0x51,
-    0x3b, 0x40, 0x7f, 0x6b, 0x48, 0x40, 0x23, 0x27, 0x27, 0x27, 0x3b, 0x2e,
-    0x2e, 0x40, 0x40, 0x3b, 0x40, 0x51, 0x64, 0x7f, 0x8f, 0x7f, 0x51, 0x40,
-    0x64, 0x73, 0x7f, 0x92, 0xb0, 0xb0, 0x8f, 0x61, 0x02, 0x00, 0x04, 0x0b,
-    0x15, 0x24, 0x35, 0x4b, 0x72, 0x8e, 0x8e, 0xae, 0xb9, 0x8e, 0x4b, 0x35,
-    0x32, 0x35, 0x1c, 0x0b, 0x06, 0x0b, 0x18, 0x21, 0x2b, 0x2b, 0x22, 0x21,
-    0x3a, 0x4e, 0x56, 0x56, 0x56, 0x56, 0x5e, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x56, 0x56, 0x5f,
-    0x5e, 0x5f, 0x5f, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05,
-    0x01, 0x01, 0x05, 0x03, 0x05, 0x03, 0x03, 0x05, 0x05, 0x05, 0x0a, 0x0a,
-    0x07, 0x0a, 0x0a, 0x0a, 0x08, 0x08, 0x07, 0x0a, 0x03, 0x03, 0x03, 0x05,
-    0x01, 0x00, 0x02, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x02, 0x00, 0x01, 0x01, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x0e, 0x19, 0x19,
-    0x19, 0x19, 0x1a, 0x0e, 0x0e, 0x0a, 0x0a, 0x05, 0x03, 0x02, 0x02, 0x00,
-    0x01, 0x01, 0x05, 0x0e, 0x26, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25,
-    0x25, 0x25, 0x26, 0x25, 0x29, 0x29, 0x2a, 0x2d, 0x2d, 0x37, 0x3e, 0x3e,
-    0x47, 0x41, 0x4a, 0x4a, 0x53, 0x56, 0x5e, 0x5f, 0x5e, 0x68, 0x68, 0x68,
-    0x68, 0x6c, 0x6c, 0x74, 0x76, 0x76, 0x74, 0x76, 0x7a, 0x7d, 0x7d, 0x81,
-    0x81, 0x81, 0x88, 0x88, 0x88, 0x88, 0x89, 0x94, 0x90, 0x94, 0x97, 0x9d,
-    0x9d, 0x99, 0x9d, 0xa9, 0xa9, 0xa7, 0xb1, 0xb1, 0xb1, 0xbf, 0xcb, 0xcb,
-    0xd3, 0xd8, 0xdf, 0xe9, 0xe9, 0xe9, 0xd3, 0xbf, 0xbf, 0xb4, 0xa7, 0x97,
-    0x82, 0x59, 0x2b, 0x18, 0x0b, 0x0b, 0x0b, 0x0b, 0x06, 0x06, 0x04, 0x06,
-    0x06, 0x06, 0x15, 0x4b, 0xb9, 0xc4, 0xc4, 0xb9, 0xa6, 0xa6, 0x8e, 0x72,
-    0x72, 0xb0, 0xc4, 0xc4, 0xb9, 0xb0, 0xa6, 0xa2, 0xa2, 0xa2, 0xb0, 0xb0,
-    0xd7, 0xd7, 0xe6, 0xe6, 0xef, 0xe6, 0xe7, 0xd7, 0xd7, 0xc4, 0xc4, 0xc4,
-    0xd7, 0xe6, 0xe6, 0xe6, 0xd5, 0xd7, 0xc0, 0xb0, 0x9e, 0x7f, 0xb0, 0xc9,
-    0xb0, 0x7f, 0x73, 0x73, 0x7f, 0xb0, 0x8f, 0x8f, 0x7f, 0x7f, 0xa2, 0xb0,
-    0xb9, 0xc0, 0xb7, 0x54, 0x8f, 0x9e, 0x73, 0x64, 0x40, 0x51, 0x8f, 0x8f,
-    0x6b, 0x64, 0x32, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x32, 0x3b, 0x54, 0x64,
-    0x54, 0x64, 0x64, 0x7f, 0xa2, 0xa2, 0xa6, 0x73, 0x54, 0x64, 0x7f, 0x92,
-    0xa2, 0xc4, 0xa6, 0x80, 0x0b, 0x01, 0x00, 0x00, 0x01, 0x01, 0x03, 0x09,
-    0x0f, 0x0f, 0x15, 0x15, 0x15, 0x0f, 0x04, 0x04, 0x04, 0x09, 0x09, 0x06,
-    0x06, 0x09, 0x18, 0x18, 0x22, 0x22, 0x22, 0x22, 0x21, 0x43, 0x55, 0x55,
-    0x55, 0x5f, 0x56, 0x56, 0x56, 0x5f, 0x56, 0x5f, 0x5f, 0x5f, 0x5e, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x5f, 0x5f, 0x5f,
-    0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x05, 0x03, 0x03, 0x05, 0x0e,
-    0x19, 0x1b, 0x1f, 0x29, 0x2d, 0x3c, 0x3e, 0x46, 0x52, 0x52, 0x52, 0x53,
-    0x52, 0x52, 0x53, 0x4a, 0x46, 0x37, 0x28, 0x1e, 0x1e, 0x16, 0x16, 0x0e,
-    0x0a, 0x03, 0x03, 0x03, 0x05, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x05,
-    0x05, 0x0a, 0x0a, 0x07, 0x0e, 0x0c, 0x1a, 0x19, 0x19, 0x1a, 0x1a, 0x16,
-    0x0e, 0x0a, 0x0a, 0x05, 0x05, 0x05, 0x02, 0x00, 0x00, 0x00, 0x01, 0x05,
-    0x1a, 0x2c, 0x1f, 0x1f, 0x25, 0x25, 0x26, 0x26, 0x1f, 0x1f, 0x26, 0x25,
-    0x25, 0x29, 0x29, 0x2c, 0x29, 0x29, 0x2d, 0x31, 0x37, 0x3e, 0x41, 0x49,
-    0x4d, 0x56, 0x5f, 0x5e, 0x5e, 0x68, 0x6c, 0x6c, 0x6c, 0x74, 0x74, 0x76,
-    0x78, 0x7d, 0x81, 0x81, 0x81, 0x88, 0x88, 0x88, 0x91, 0x91, 0x89, 0x91,
-    0x94, 0x9d, 0x9d, 0x99, 0x99, 0x99, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xbf, 0xb4, 0xbf, 0xcb, 0xd3, 0xd3, 0xdf, 0xdf, 0xe9, 0xf1, 0xf1, 0xf1,
-    0xdf, 0xcb, 0xbf, 0xb4, 0xac, 0xa3, 0x90, 0x82, 0x4f, 0x21, 0x18, 0x0f,
-    0x0f, 0x0b, 0x0b, 0x0b, 0x04, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06,
-    0x1c, 0x4b, 0x4b, 0x4b, 0x32, 0x35, 0x1c, 0x0f, 0x04, 0x32, 0xb0, 0xb9,
-    0xb0, 0xa6, 0xa2, 0x92, 0x92, 0x7f, 0x8f, 0x8f, 0xb0, 0xd7, 0xd7, 0xc8,
-    0xe6, 0xd7, 0xd7, 0xd9, 0xd9, 0xc7, 0xb0, 0xa2, 0xa2, 0xc4, 0xc4, 0xc4,
-    0xc4, 0xb0, 0x9e, 0x7f, 0x3b, 0x3b, 0x92, 0xd5, 0xd7, 0xb0, 0x7f, 0x7f,
-    0x7f, 0x73, 0x7f, 0x8f, 0x98, 0x8f, 0x8f, 0x9e, 0xaf, 0x9e, 0x3b, 0x27,
-    0x9e, 0xb0, 0x8f, 0x73, 0x54, 0x51, 0x9e, 0xa2, 0x7f, 0x7f, 0x3b, 0x3b,
-    0x40, 0x40, 0x3b, 0x40, 0x3b, 0x3b, 0x51, 0x73, 0x7f, 0x73, 0x73, 0x7f,
-    0xa2, 0xb0, 0xb9, 0xc4, 0x92, 0x64, 0x7f, 0xa2, 0xa2, 0xb0, 0xc4, 0xa6,
-    0x32, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04,
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x09, 0x09, 0x09, 0x09, 0x06, 0x0b, 0x18,
-    0x18, 0x22, 0x22, 0x22, 0x22, 0x3a, 0x55, 0x5e, 0x5f, 0x5f, 0x5e, 0x5e,
-    0x56, 0x56, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x5f, 0x63, 0x5f, 0x5f, 0x5e, 0x5e, 0x5f, 0x63, 0x01, 0x02, 0x00, 0x05,
-    0x05, 0x07, 0x0e, 0x19, 0x26, 0x29, 0x31, 0x3e, 0x46, 0x4e, 0x53, 0x56,
-    0x60, 0x66, 0x66, 0x71, 0x7a, 0x7a, 0x82, 0x85, 0x85, 0x82, 0x8a, 0x85,
-    0x85, 0x7c, 0x7c, 0x71, 0x69, 0x59, 0x4e, 0x43, 0x3c, 0x2f, 0x28, 0x1e,
-    0x16, 0x0e, 0x0a, 0x05, 0x05, 0x05, 0x01, 0x05, 0x05, 0x0a, 0x07, 0x0e,
-    0x0e, 0x19, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x19, 0x0e, 0x07, 0x0a, 0x05,
-    0x05, 0x0a, 0x05, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x1f, 0x26, 0x1f,
-    0x1f, 0x26, 0x26, 0x26, 0x1f, 0x1f, 0x1f, 0x1f, 0x26, 0x25, 0x29, 0x29,
-    0x29, 0x29, 0x29, 0x29, 0x29, 0x2d, 0x37, 0x37, 0x3e, 0x41, 0x53, 0x5e,
-    0x63, 0x6c, 0x6c, 0x74, 0x76, 0x76, 0x7d, 0x81, 0x81, 0x88, 0x88, 0x89,
-    0x91, 0x91, 0x91, 0x9d, 0x9d, 0x9d, 0xa3, 0xa7, 0xa7, 0xa7, 0xa7, 0xa9,
-    0xa7, 0xb1, 0xb4, 0xb4, 0xbf, 0xbf, 0xbf, 0xcb, 0xd3, 0xd3, 0xdf, 0xdf,
-    0xdf, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xdf, 0xcb, 0xbf, 0xb4, 0xa9,
-    0x97, 0x8a, 0x82, 0x62, 0x2b, 0x0f, 0x0f, 0x0b, 0x0f, 0x0b, 0x06, 0x04,
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x14, 0x4b, 0x72, 0x73, 0x73, 0x73,
-    0x64, 0x61, 0x51, 0x51, 0x61, 0x80, 0x92, 0x8e, 0xba, 0xc8, 0xc4, 0xc4,
-    0xb9, 0xb0, 0xa2, 0x7f, 0x7f, 0xa4, 0xa2, 0xa2, 0x8f, 0x64, 0x2e, 0x23,
-    0x23, 0x7f, 0x7f, 0xc4, 0xc4, 0xa6, 0x92, 0xa6, 0xb0, 0x92, 0x64, 0x51,
-    0x64, 0x8f, 0x9e, 0x8f, 0x73, 0x7f, 0x27, 0x23, 0x9e, 0xc0, 0xc4, 0x8f,
-    0x64, 0x51, 0x8f, 0xaf, 0x9e, 0x9e, 0x64, 0x51, 0x54, 0x54, 0x51, 0x51,
-    0x54, 0x40, 0x51, 0x73, 0x8f, 0x7f, 0x7f, 0x7f, 0x8f, 0xa2, 0xc4, 0xc9,
-    0xd5, 0xa6, 0x80, 0x8f, 0xb0, 0xb0, 0xc4, 0xc4, 0x8e, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-    0x04, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x18, 0x18, 0x15, 0x22,
-    0x22, 0x2b, 0x43, 0x56, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x68, 0x5e, 0x63, 0x5f, 0x63, 0x63,
-    0x5f, 0x5e, 0x68, 0x5f, 0x05, 0x07, 0x19, 0x1a, 0x26, 0x34, 0x43, 0x4e,
-    0x5b, 0x71, 0x82, 0xa1, 0xac, 0xb8, 0xc1, 0xcc, 0xdf, 0xdf, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe9, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-    0xe9, 0xe9, 0xdf, 0xdf, 0xd8, 0xcc, 0xb2, 0xac, 0xa1, 0x7c, 0x5c, 0x43,
-    0x2f, 0x1e, 0x16, 0x0e, 0x0a, 0x0a, 0x0a, 0x0e, 0x0e, 0x19, 0x19, 0x1a,
-    0x1a, 0x1a, 0x1a, 0x1a, 0x0e, 0x07, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x02,
-    0x01, 0x01, 0x00, 0x01, 0x05, 0x16, 0x1f, 0x1f, 0x1a, 0x1f, 0x26, 0x26,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x26, 0x25, 0x29, 0x29, 0x29, 0x29, 0x2d,
-    0x2c, 0x29, 0x29, 0x29, 0x29, 0x2d, 0x37, 0x3e, 0x53, 0x63, 0x74, 0x74,
-    0x76, 0x81, 0x8a, 0x91, 0x91, 0x91, 0x9d, 0x9d, 0x9d, 0xa7, 0xa9, 0xa7,
-    0xa7, 0xb3, 0xb1, 0xb4, 0xb4, 0xbf, 0xbf, 0xbf, 0xcb, 0xcb, 0xcb, 0xd3,
-    0xd3, 0xde, 0xdf, 0xdf, 0xe9, 0xe9, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xe9, 0xd8, 0xcb, 0xb8, 0xa9, 0x99, 0x90, 0x82, 0x7a, 0x66, 0x4f,
-    0x3a, 0x21, 0x18, 0x0b, 0x0b, 0x0b, 0x09, 0x04, 0x04, 0x04, 0x04, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x00, 0x00, 0x02, 0x00, 0x24, 0x35, 0x32, 0x40, 0x4b, 0x32, 0x4b, 0x8e,
-    0x32, 0x24, 0x4b, 0x61, 0x4b, 0x8e, 0xb9, 0xb9, 0xa6, 0xa2, 0x7f, 0x73,
-    0x73, 0x64, 0x51, 0x40, 0x3b, 0x23, 0x23, 0x27, 0x73, 0x8f, 0x8f, 0xb0,
-    0xb0, 0xb9, 0xb9, 0xb9, 0xd7, 0xd7, 0xb0, 0x80, 0x7f, 0x9e, 0x9e, 0x64,
-    0x73, 0x73, 0x27, 0x27, 0x92, 0xc9, 0xd7, 0xc7, 0x7f, 0x54, 0x73, 0xb0,
-    0xb0, 0xc0, 0x9e, 0x64, 0x73, 0x73, 0x73, 0x64, 0x73, 0x64, 0x54, 0x73,
-    0x8f, 0xa2, 0x73, 0x8f, 0x8f, 0xa2, 0xb0, 0xc4, 0xd7, 0xe6, 0xc7, 0xa6,
-    0xb0, 0xb7, 0xc9, 0xc4, 0xd7, 0x35, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-    0x04, 0x09, 0x09, 0x09, 0x09, 0x12, 0x18, 0x21, 0x38, 0x3a, 0x43, 0x4d,
-    0x55, 0x5f, 0x63, 0x5e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x5e, 0x63, 0x63,
-    0x63, 0x68, 0x68, 0x63, 0x63, 0x63, 0x63, 0x5f, 0x5f, 0x6a, 0x63, 0x63,
-    0x28, 0x3a, 0x59, 0x7c, 0x85, 0xac, 0xc1, 0xcc, 0xd8, 0xdf, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xd8, 0xd8, 0xd8, 0xd8, 0xcc, 0xcc, 0xcc, 0xcc, 0xcb, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8,
-    0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xd8, 0xcc, 0xb8, 0x96, 0x65,
-    0x43, 0x28, 0x19, 0x07, 0x0a, 0x07, 0x0e, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a,
-    0x16, 0x0e, 0x0a, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x00, 0x00,
-    0x01, 0x05, 0x11, 0x1d, 0x1e, 0x1a, 0x1f, 0x26, 0x25, 0x1f, 0x1e, 0x1f,
-    0x1f, 0x1f, 0x25, 0x29, 0x29, 0x25, 0x29, 0x29, 0x2d, 0x2d, 0x29, 0x29,
-    0x28, 0x25, 0x29, 0x2d, 0x37, 0x49, 0x5e, 0x6c, 0x7d, 0x8a, 0x90, 0x97,
-    0x99, 0x9d, 0xa7, 0xa7, 0xb1, 0xb1, 0xb8, 0xb4, 0xbf, 0xbf, 0xbf, 0xcb,
-    0xcb, 0xd3, 0xd3, 0xd3, 0xdf, 0xdf, 0xdf, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe9, 0xe9, 0xe9, 0xdf, 0xcb, 0xbf, 0xb4,
-    0xa9, 0x97, 0x8a, 0x7a, 0x71, 0x66, 0x57, 0x43, 0x2f, 0x18, 0x0b, 0x0b,
-    0x06, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1c,
-    0x35, 0x24, 0x24, 0x35, 0x24, 0x24, 0x72, 0xb9, 0x61, 0x40, 0x72, 0x72,
-    0x4b, 0x72, 0xae, 0x92, 0x8e, 0x80, 0x8f, 0x7f, 0x64, 0x51, 0x3b, 0x2e,
-    0x32, 0x32, 0x61, 0x8e, 0xb0, 0xa2, 0x73, 0x92, 0xb0, 0xa6, 0xa2, 0xb0,
-    0xb9, 0xc4, 0xc4, 0xb0, 0xa2, 0x8f, 0x73, 0x54, 0x7f, 0x64, 0x27, 0x27,
-    0x72, 0xd5, 0xe5, 0xe6, 0xb9, 0x73, 0x64, 0xa6, 0xb7, 0xc6, 0xc0, 0x80,
-    0x80, 0xa4, 0x80, 0x80, 0x80, 0x73, 0x64, 0x80, 0xa2, 0xa2, 0x73, 0x72,
-    0xa2, 0xa2, 0xb0, 0xb7, 0xc9, 0xd7, 0xe6, 0xe6, 0xd7, 0xc4, 0xc4, 0xb9,
-    0xe5, 0xae, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04,
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x09, 0x09, 0x09,
-    0x09, 0x12, 0x18, 0x18, 0x21, 0x3a, 0x4e, 0x5e, 0x55, 0x5f, 0x63, 0x6a,
-    0x63, 0x63, 0x63, 0x63, 0x68, 0x63, 0x68, 0x68, 0x6a, 0x6a, 0x6a, 0x6a,
-    0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0xb2, 0xcc, 0xd3, 0xdf,
-    0xdf, 0xdf, 0xd8, 0xd8, 0xcc, 0xcc, 0xcc, 0xbf, 0xc1, 0xbf, 0xc1, 0xc1,
-    0xc1, 0xc1, 0xc1, 0xb8, 0xb8, 0xb8, 0xb8, 0xb4, 0xbf, 0xb4, 0xb8, 0xbf,
-    0xbf, 0xc1, 0xc1, 0xc1, 0xc1, 0xbf, 0xbf, 0xc1, 0xcb, 0xcb, 0xcb, 0xcc,
-    0xd8, 0xd8, 0xd8, 0xd8, 0xdf, 0xdf, 0xdf, 0xd8, 0xcc, 0xb2, 0x7c, 0x3a,
-    0x16, 0x01, 0x01, 0x0a, 0x0e, 0x0c, 0x19, 0x1a, 0x19, 0x0e, 0x0e, 0x0a,
-    0x05, 0x05, 0x05, 0x03, 0x05, 0x02, 0x00, 0x00, 0x00, 0x05, 0x05, 0x0a,
-    0x1d, 0x1e, 0x1a, 0x1f, 0x26, 0x1f, 0x1e, 0x1e, 0x1a, 0x1f, 0x1f, 0x26,
-    0x25, 0x25, 0x26, 0x25, 0x29, 0x2d, 0x2d, 0x2d, 0x28, 0x29, 0x25, 0x29,
-    0x3d, 0x5e, 0x74, 0x8a, 0x99, 0xa9, 0xaa, 0xb1, 0xb4, 0xbf, 0xbf, 0xcb,
-    0xcb, 0xd3, 0xd3, 0xd3, 0xd3, 0xdf, 0xdf, 0xdf, 0xe9, 0xe9, 0xe9, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xdf, 0xcb, 0xaa, 0x9d, 0x8a, 0x82, 0x71, 0x66,
-    0x5b, 0x5b, 0x44, 0x2f, 0x12, 0x06, 0x18, 0x06, 0x09, 0x09, 0x04, 0x04,
-    0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x24, 0x8d, 0x4b, 0x24, 0x1c, 0x1c,
-    0x14, 0x24, 0x8e, 0xae, 0x80, 0x80, 0x80, 0x73, 0x72, 0x61, 0x72, 0x72,
-    0x54, 0xb0, 0xa2, 0x73, 0x54, 0x40, 0x3b, 0x3b, 0x2e, 0x61, 0xeb, 0xe5,
-    0xc6, 0x8f, 0x3b, 0x40, 0xb0, 0xb9, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0x8f,
-    0x73, 0x64, 0x40, 0x64, 0x8f, 0x51, 0x2e, 0x27, 0x40, 0xc4, 0xe3, 0xe6,
-    0xe6, 0xa2, 0x80, 0xc4, 0xa2, 0xa2, 0xc6, 0x80, 0xa2, 0xb0, 0xa2, 0x92,
-    0x8f, 0x80, 0x80, 0x7f, 0xa2, 0xb0, 0x7f, 0x24, 0x72, 0xb0, 0xc4, 0xc4,
-    0xc4, 0xd7, 0xe5, 0xe6, 0xd7, 0xc4, 0xb0, 0xb0, 0xc4, 0xd5, 0x8e, 0x06,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04,
-    0x04, 0x04, 0x04, 0x04, 0x09, 0x04, 0x09, 0x09, 0x09, 0x09, 0x0b, 0x18,
-    0x18, 0x18, 0x2b, 0x5b, 0x68, 0x63, 0x63, 0x63, 0x5e, 0x63, 0x63, 0x68,
-    0x6c, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6e, 0x6c, 0x6c, 0x6e,
-    0x6a, 0x6c, 0x68, 0x6a, 0xd8, 0xd8, 0xcc, 0xcc, 0xcb, 0xbf, 0xc1, 0xbf,
-    0xb4, 0xb8, 0xb8, 0xb8, 0xac, 0xac, 0xac, 0xb4, 0xaa, 0xa9, 0xac, 0xac,
-    0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xac, 0xa9, 0xa9, 0xaa, 0xac, 0xac, 0xa9,
-    0xac, 0xb8, 0xb8, 0xb8, 0xb8, 0xb4, 0xb8, 0xc1, 0xbf, 0xbf, 0xb4, 0xc1,
-    0xc1, 0xcb, 0xcc, 0xd8, 0xd8, 0xdf, 0xd8, 0xcc, 0xb6, 0x96, 0x42, 0x16,
-    0x05, 0x0a, 0x0a, 0x05, 0x0a, 0x0e, 0x0e, 0x0a, 0x03, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x01, 0x00, 0x00, 0x01, 0x05, 0x05, 0x0a, 0x1d, 0x1e, 0x19,
-    0x1f, 0x26, 0x1f, 0x1a, 0x19, 0x1e, 0x1f, 0x1f, 0x26, 0x25, 0x26, 0x25,
-    0x25, 0x29, 0x31, 0x2d, 0x2d, 0x29, 0x29, 0x2d, 0x53, 0x6c, 0x76, 0x88,
-    0x91, 0x99, 0xa9, 0xb1, 0xb4, 0xbf, 0xcb, 0xcb, 0xd3, 0xde, 0xde, 0xdf,
-    0xe9, 0xe9, 0xe9, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe9, 0xf1, 0xf1, 0xf1,
-    0xe9, 0xd3, 0x9d, 0x82, 0x7a, 0x66, 0x5b, 0x4e, 0x4e, 0x43, 0x34, 0x1d,
-    0x12, 0x12, 0x09, 0x09, 0x06, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x4b, 0xba, 0xae, 0x61, 0x35, 0x24, 0x32, 0x72, 0xd4, 0xd4,
-    0xd4, 0xae, 0xae, 0x92, 0x72, 0x54, 0x51, 0x40, 0x3b, 0x8e, 0xa2, 0x7f,
-    0x64, 0x54, 0x51, 0x40, 0x54, 0xb9, 0xeb, 0xe7, 0xb7, 0x64, 0x23, 0x32,
-    0xa2, 0xb9, 0xb0, 0xa6, 0xa6, 0x92, 0x73, 0x51, 0x64, 0x64, 0x3b, 0x64,
-    0x9e, 0x40, 0x2e, 0x32, 0x32, 0x72, 0xd5, 0xd5, 0xd7, 0xb7, 0xb9, 0xe6,
-    0x8e, 0x32, 0xc6, 0xb0, 0xb0, 0xc4, 0xb0, 0xa2, 0xa6, 0xa2, 0x8f, 0xa2,
-    0xc4, 0xb0, 0x51, 0x23, 0x0b, 0x40, 0xa2, 0xb9, 0xc4, 0xd7, 0xe5, 0xe7,
-    0xeb, 0xe7, 0xd7, 0xd7, 0xc4, 0xc4, 0xd5, 0x8e, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-    0x04, 0x04, 0x04, 0x09, 0x09, 0x09, 0x06, 0x0b, 0x0b, 0x18, 0x2b, 0x52,
-    0x6a, 0x68, 0x6c, 0x6a, 0x6a, 0x68, 0x68, 0x74, 0x6c, 0x6c, 0x75, 0x75,
-    0x75, 0x74, 0x6c, 0x6e, 0x6e, 0x75, 0x76, 0x75, 0x74, 0x68, 0x68, 0x76,
-    0xbf, 0xbf, 0xbf, 0xb8, 0xb8, 0xb8, 0xaa, 0xa9, 0xa9, 0xa9, 0xa9, 0xa3,
-    0xa3, 0xa9, 0xa3, 0xa3, 0x99, 0xa3, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x9d, 0x99, 0x99, 0xa3, 0x99, 0x99, 0xa3, 0xa3, 0xa3, 0xa3, 0xa9,
-    0xa9, 0xa9, 0xa9, 0xaa, 0xaa, 0xac, 0xa9, 0xaa, 0xac, 0xb4, 0xbf, 0xbf,
-    0xbf, 0xcb, 0xcb, 0xd8, 0xd8, 0xdf, 0xdf, 0xd8, 0xab, 0x42, 0x28, 0x2f,
-    0x1e, 0x03, 0x05, 0x05, 0x0a, 0x05, 0x05, 0x05, 0x03, 0x05, 0x01, 0x00,
-    0x00, 0x00, 0x01, 0x05, 0x05, 0x0a, 0x1a, 0x19, 0x16, 0x1a, 0x1f, 0x1f,
-    0x1a, 0x19, 0x19, 0x1a, 0x1f, 0x26, 0x26, 0x26, 0x26, 0x25, 0x29, 0x29,
-    0x2d, 0x2d, 0x2a, 0x37, 0x4d, 0x5e, 0x6c, 0x76, 0x81, 0x88, 0x90, 0x9d,
-    0xa7, 0xb1, 0xb4, 0xbf, 0xcb, 0xcb, 0xd3, 0xd3, 0xde, 0xde, 0xdf, 0xe9,
-    0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xe9, 0xf1, 0xf1, 0xf1, 0xe9, 0xe9, 0xcb, 0x89, 0x71,
-    0x66, 0x5b, 0x4e, 0x44, 0x43, 0x3c, 0x2f, 0x1d, 0x12, 0x0b, 0x06, 0x09,
-    0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x15, 0x4b,
-    0x4b, 0x61, 0x4b, 0x4b, 0x4b, 0x4b, 0xc7, 0xd4, 0xee, 0xed, 0xd4, 0xcd,
-    0xae, 0x80, 0x54, 0x27, 0x14, 0x32, 0xd7, 0x8f, 0x80, 0x73, 0x64, 0x64,
-    0xa4, 0xd7, 0xe7, 0xd9, 0x7f, 0x2e, 0x23, 0x32, 0x92, 0xb9, 0xb9, 0xc7,
-    0xd9, 0xd9, 0x8e, 0x51, 0x73, 0x64, 0x2e, 0x7f, 0x8f, 0x40, 0x3b, 0x2e,
-    0x32, 0x3b, 0x73, 0xa2, 0xb0, 0xa4, 0xb9, 0xd5, 0x4b, 0x09, 0x72, 0xc9,
-    0xd7, 0xd7, 0xd7, 0xb9, 0xb0, 0xb0, 0xb9, 0xd5, 0xd5, 0x64, 0x32, 0x3b,
-    0x0f, 0x02, 0x24, 0x72, 0xb0, 0xc4, 0xd7, 0xe6, 0xe6, 0xe5, 0xe5, 0xd7,
-    0xc4, 0xc4, 0xd7, 0xe6, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x09, 0x04, 0x09,
-    0x09, 0x09, 0x09, 0x0b, 0x18, 0x18, 0x38, 0x63, 0x6a, 0x6e, 0x6c, 0x75,
-    0x76, 0x74, 0x75, 0x76, 0x75, 0x76, 0x76, 0x76, 0x76, 0x78, 0x76, 0x76,
-    0x78, 0x84, 0x84, 0x81, 0x7d, 0x76, 0x81, 0x81, 0xb8, 0xb3, 0xac, 0xac,
-    0xa3, 0x99, 0x99, 0x99, 0x99, 0x99, 0xa3, 0x97, 0xa3, 0x97, 0x97, 0x97,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x94, 0x90, 0x94, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x97, 0x97, 0x97, 0x97, 0x97, 0x9d, 0x99, 0x9d, 0xa3,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0xa3, 0xa9, 0xaa, 0xb4, 0xb8, 0xc1, 0xbf,
-    0xbf, 0xcb, 0xcb, 0xd8, 0xdf, 0xdf, 0xcc, 0x96, 0x71, 0x4c, 0x1d, 0x0a,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x05, 0x02, 0x01, 0x00, 0x01, 0x01,
-    0x01, 0x01, 0x05, 0x19, 0x1a, 0x16, 0x1e, 0x1f, 0x1f, 0x19, 0x19, 0x19,
-    0x1e, 0x1e, 0x26, 0x26, 0x1f, 0x1f, 0x25, 0x29, 0x29, 0x29, 0x2a, 0x2d,
-    0x3d, 0x4d, 0x5e, 0x68, 0x6c, 0x74, 0x7d, 0x88, 0x94, 0x9d, 0xa7, 0xa7,
-    0xb1, 0xb1, 0xbf, 0xcb, 0xcb, 0xd3, 0xd3, 0xde, 0xde, 0xd3, 0xde, 0xdf,
-    0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xdf, 0xdf, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xde, 0xdf, 0xde, 0xa7, 0x66, 0x5b, 0x4e, 0x44, 0x44, 0x3d,
-    0x34, 0x2f, 0x28, 0x11, 0x0b, 0x0b, 0x06, 0x04, 0x04, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x15, 0x1c, 0x1c, 0x24,
-    0x24, 0x35, 0xae, 0xae, 0xae, 0xcd, 0xd4, 0xb9, 0xae, 0x8e, 0x80, 0x73,
-    0x51, 0x40, 0xc9, 0xa6, 0xb9, 0xe7, 0xd9, 0xa6, 0xe7, 0xe7, 0xe7, 0xa4,
-    0x3b, 0x2e, 0x2e, 0x40, 0x80, 0x8e, 0xa6, 0xb9, 0xc7, 0xd9, 0xd7, 0x92,
-    0xa4, 0x54, 0x27, 0x8f, 0xa2, 0x51, 0x3b, 0x3b, 0x3b, 0x3b, 0x54, 0x7f,
-    0x73, 0x92, 0xa2, 0xb0, 0x35, 0x05, 0x09, 0x92, 0xc4, 0xd7, 0xe6, 0xe6,
-    0xd7, 0xb9, 0xc4, 0xd6, 0xb7, 0x32, 0x27, 0x3b, 0x32, 0x01, 0x02, 0x02,
-    0x32, 0x72, 0xa6, 0xc4, 0xc4, 0xc4, 0xc4, 0xb0, 0x92, 0x8e, 0xb9, 0xee,
-    0xee, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04,
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x09, 0x04, 0x09, 0x09, 0x09, 0x09, 0x12,
-    0x12, 0x18, 0x2b, 0x66, 0x78, 0x75, 0x76, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x88, 0x7d, 0x81, 0x88, 0x88, 0x81, 0x88, 0x88, 0x88, 0x91, 0x88,
-    0x84, 0x93, 0x91, 0x88, 0xa3, 0x99, 0x99, 0x97, 0x97, 0x90, 0x90, 0x94,
-    0x97, 0x97, 0x90, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x82, 0x82, 0x82,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x90, 0x8a, 0x8a, 0x89, 0x90, 0x90, 0x97, 0x97, 0x97, 0x9d, 0x97,
-    0x9d, 0x99, 0x99, 0xa3, 0xa3, 0xa7, 0xaa, 0xa7, 0xb1, 0xb4, 0xb4, 0xbf,
-    0xcb, 0xcb, 0xd8, 0xe9, 0xe9, 0xb6, 0xab, 0x5c, 0x28, 0x0e, 0x03, 0x01,
-    0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x00, 0x01, 0x01, 0x00, 0x01, 0x05,
-    0x07, 0x16, 0x16, 0x19, 0x1f, 0x1f, 0x1a, 0x16, 0x19, 0x19, 0x1a, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x26, 0x29, 0x29, 0x29, 0x2d, 0x3d, 0x4d, 0x56,
-    0x5f, 0x68, 0x6c, 0x74, 0x76, 0x81, 0x90, 0x97, 0x9d, 0xa7, 0xa7, 0xb1,
-    0xb1, 0xbf, 0xbf, 0xcb, 0xcb, 0xd3, 0xd3, 0xd3, 0xde, 0xde, 0xdf, 0xde,
-    0xde, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xd3,
-    0xbf, 0x7a, 0x4e, 0x46, 0x46, 0x3c, 0x3c, 0x34, 0x2d, 0x28, 0x1d, 0x09,
-    0x09, 0x09, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x0f, 0x15, 0x15, 0x51, 0x8e,
-    0x72, 0xae, 0xc7, 0xb9, 0x92, 0x72, 0x61, 0x51, 0x40, 0x40, 0xc4, 0xc4,
-    0xc4, 0xd7, 0xe5, 0xd5, 0xe6, 0xd7, 0xae, 0x23, 0x32, 0x3b, 0x51, 0x64,
-    0x54, 0x61, 0x8e, 0xa8, 0xb9, 0xb9, 0xb9, 0xa6, 0xa2, 0x23, 0x32, 0xa2,
-    0xd5, 0x92, 0x40, 0x40, 0x40, 0x51, 0x64, 0x8f, 0x3b, 0x27, 0x51, 0x3b,
-    0x09, 0x0a, 0x05, 0x15, 0x92, 0xb9, 0xc4, 0xb9, 0xb0, 0xb0, 0xb0, 0xc0,
-    0x80, 0x27, 0x32, 0x3b, 0x40, 0x24, 0x00, 0x00, 0x02, 0x24, 0x51, 0x73,
-    0x92, 0x8e, 0x72, 0x51, 0x51, 0x61, 0x8e, 0xd9, 0xe7, 0xca, 0x0f, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-    0x09, 0x04, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x0b, 0x18, 0x38, 0x7a,
-    0x91, 0x84, 0x81, 0x88, 0x88, 0x88, 0x91, 0x88, 0x91, 0x93, 0x91, 0x91,
-    0x91, 0x94, 0x97, 0x99, 0x97, 0x91, 0x99, 0x97, 0x99, 0x99, 0x99, 0xa3,
-    0x97, 0x90, 0x90, 0x90, 0x8a, 0x8a, 0x8a, 0x90, 0x88, 0x88, 0x81, 0x81,
-    0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7d, 0x7d, 0x78, 0x82, 0x7a, 0x7b,
-    0x7a, 0x7a, 0x7d, 0x83, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81,
-    0x82, 0x82, 0x88, 0x8a, 0x8a, 0x8a, 0x90, 0x90, 0x90, 0x90, 0x97, 0x97,
-    0x97, 0x9d, 0x9d, 0x99, 0xa3, 0xa9, 0xa7, 0xb4, 0xb8, 0xb8, 0xbf, 0xbf,
-    0xcb, 0xd8, 0xdf, 0xd8, 0xb2, 0x65, 0x28, 0x0a, 0x03, 0x01, 0x03, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x07, 0x0e,
-    0x16, 0x1b, 0x1f, 0x19, 0x16, 0x16, 0x16, 0x19, 0x1e, 0x1e, 0x1e, 0x1a,
-    0x1f, 0x26, 0x25, 0x29, 0x29, 0x2d, 0x3d, 0x47, 0x47, 0x53, 0x55, 0x5e,
-    0x68, 0x6c, 0x76, 0x88, 0x88, 0x91, 0x94, 0x9d, 0x9d, 0xa7, 0xb1, 0xb1,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xcb, 0xcb, 0xcb, 0xcb, 0xd3, 0xd3, 0xcb, 0xcb,
-    0xd3, 0xd3, 0xcb, 0xd3, 0xd3, 0xd3, 0xcb, 0xbf, 0x82, 0x4e, 0x3e, 0x3d,
-    0x3c, 0x34, 0x34, 0x2f, 0x28, 0x1d, 0x06, 0x09, 0x09, 0x04, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x0b,
-    0x15, 0x1c, 0x15, 0x0f, 0x06, 0x0b, 0x1c, 0x4b, 0x40, 0x51, 0x61, 0x61,
-    0x61, 0x51, 0x3b, 0x32, 0x23, 0x1c, 0x4b, 0xb9, 0xb9, 0xb0, 0xb0, 0xb0,
-    0x8e, 0x51, 0x23, 0x14, 0x3b, 0x54, 0x73, 0x54, 0x3b, 0x23, 0x4b, 0x72,
-    0x8e, 0x8e, 0x92, 0x72, 0x51, 0x50, 0x35, 0xa2, 0xd7, 0xd7, 0x72, 0x51,
-    0x51, 0x64, 0x7f, 0x7f, 0x32, 0x23, 0x32, 0x23, 0x08, 0x0a, 0x0a, 0x03,
-    0x24, 0x61, 0x92, 0xa2, 0xa2, 0xa2, 0xa2, 0x8f, 0x51, 0x32, 0x32, 0x3b,
-    0x51, 0x61, 0x24, 0x01, 0x00, 0x00, 0x23, 0x51, 0x73, 0x92, 0x72, 0x61,
-    0x54, 0x61, 0x72, 0xa6, 0xe7, 0xeb, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x04, 0x04, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x06,
-    0x06, 0x0b, 0x06, 0x0b, 0x12, 0x0b, 0x12, 0x4c, 0x8a, 0x91, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0xa3, 0xa3, 0x9d, 0xa3, 0xa9, 0xa9, 0xa9, 0xb3,
-    0xb3, 0xa7, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x82, 0x81, 0x82, 0x82, 0x81, 0x81, 0x78, 0x7b, 0x76, 0x78, 0x76, 0x78,
-    0x7a, 0x7a, 0x78, 0x78, 0x78, 0x76, 0x76, 0x7a, 0x74, 0x75, 0x74, 0x78,
-    0x76, 0x76, 0x7d, 0x7b, 0x7d, 0x7a, 0x7a, 0x7a, 0x78, 0x82, 0x81, 0x82,
-    0x82, 0x82, 0x88, 0x88, 0x88, 0x88, 0x8a, 0x90, 0x89, 0x90, 0x90, 0x97,
-    0x97, 0x99, 0xa3, 0xa9, 0xa9, 0xa7, 0xb4, 0xb4, 0xb4, 0xbf, 0xcb, 0xd8,
-    0xdf, 0xd8, 0xb6, 0x65, 0x1d, 0x0a, 0x03, 0x03, 0x01, 0x02, 0x02, 0x00,
-    0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x05, 0x05, 0x07, 0x0e, 0x19, 0x1a,
-    0x1e, 0x19, 0x0e, 0x16, 0x16, 0x1e, 0x1f, 0x1b, 0x1b, 0x1f, 0x1f, 0x25,
-    0x28, 0x29, 0x29, 0x37, 0x3d, 0x41, 0x4a, 0x53, 0x56, 0x56, 0x5e, 0x6c,
-    0x74, 0x76, 0x81, 0x88, 0x91, 0x94, 0x99, 0xa3, 0xa7, 0xa7, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xcb, 0xcb, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xb4, 0x97, 0x44, 0x3e, 0x3e, 0x34, 0x34, 0x2f, 0x28, 0x28,
-    0x28, 0x1d, 0x12, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x0b, 0x0f, 0x15, 0x22, 0x38, 0x18, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x06, 0x0f, 0x14, 0x14, 0x0f, 0x0f, 0x15, 0x14, 0x15, 0x0f,
-    0x06, 0x04, 0x35, 0xc8, 0xc8, 0x72, 0x4b, 0x32, 0x23, 0x24, 0x23, 0x1c,
-    0x32, 0x7f, 0xa4, 0x3b, 0x23, 0x14, 0x23, 0x4b, 0x32, 0x32, 0x32, 0x32,
-    0x1c, 0x58, 0x50, 0x72, 0xc4, 0xd7, 0xa6, 0x54, 0x73, 0x92, 0xa2, 0x40,
-    0x32, 0x32, 0x3b, 0x3b, 0x0f, 0x0a, 0x0a, 0x05, 0x05, 0x09, 0x4b, 0xa6,
-    0xb0, 0xa2, 0x80, 0x61, 0x51, 0x40, 0x32, 0x40, 0x51, 0x64, 0x73, 0x24,
-    0x02, 0x00, 0x04, 0x32, 0x72, 0x92, 0xa2, 0x92, 0x8e, 0x72, 0x72, 0x8e,
-    0xbb, 0xef, 0xd4, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04,
-    0x04, 0x09, 0x09, 0x09, 0x06, 0x06, 0x18, 0x2b, 0x58, 0x58, 0x58, 0x65,
-    0x7c, 0x65, 0x2b, 0x18, 0x7c, 0xa9, 0xb3, 0xa7, 0xa9, 0xb3, 0xb3, 0xb3,
-    0xb3, 0xb3, 0xb1, 0xb1, 0xb3, 0xb3, 0xc1, 0xbf, 0xc1, 0xc1, 0xbf, 0xcb,
-    0xbf, 0xcb, 0xcb, 0xcb, 0x81, 0x82, 0x82, 0x82, 0x7d, 0x7d, 0x76, 0x76,
-    0x76, 0x78, 0x75, 0x76, 0x74, 0x74, 0x75, 0x78, 0x75, 0x74, 0x74, 0x74,
-    0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x76, 0x76, 0x75, 0x76,
-    0x7a, 0x76, 0x7a, 0x76, 0x76, 0x76, 0x7a, 0x7d, 0x7a, 0x7d, 0x78, 0x81,
-    0x81, 0x82, 0x82, 0x88, 0x88, 0x88, 0x89, 0x8a, 0x90, 0x90, 0x97, 0x97,
-    0x99, 0x9d, 0xa7, 0xa9, 0xa9, 0xb1, 0xb8, 0xb8, 0xc1, 0xcb, 0xd8, 0xd8,
-    0xab, 0x42, 0x16, 0x0a, 0x05, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00, 0x01,
-    0x01, 0x00, 0x01, 0x02, 0x05, 0x05, 0x0e, 0x0e, 0x19, 0x1a, 0x19, 0x0e,
-    0x0e, 0x19, 0x1a, 0x1f, 0x1b, 0x19, 0x19, 0x1e, 0x1f, 0x26, 0x25, 0x29,
-    0x2d, 0x3f, 0x3f, 0x41, 0x41, 0x49, 0x4a, 0x55, 0x5e, 0x68, 0x6c, 0x74,
-    0x76, 0x88, 0x88, 0x91, 0x91, 0x99, 0xa7, 0xa7, 0xa7, 0xa7, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x99, 0x4e,
-    0x34, 0x34, 0x34, 0x2f, 0x28, 0x28, 0x28, 0x26, 0x26, 0x1d, 0x09, 0x04,
-    0x04, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x67, 0x14, 0x24,
-    0x39, 0x67, 0x6d, 0x38, 0x22, 0x0f, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x06, 0x06, 0x06, 0x06, 0x04, 0x00, 0x00, 0x04, 0x04, 0x06, 0x8e, 0xbb,
-    0xd9, 0xae, 0x27, 0x23, 0x23, 0x32, 0x27, 0x23, 0x32, 0xa2, 0xb9, 0x61,
-    0x23, 0x14, 0x72, 0xa8, 0xa6, 0x51, 0x23, 0x23, 0x14, 0x03, 0x09, 0x32,
-    0xa4, 0xb9, 0xa6, 0x80, 0x92, 0x80, 0x40, 0x27, 0x32, 0x32, 0x40, 0x3b,
-    0x09, 0x0a, 0x05, 0x05, 0x03, 0x05, 0x06, 0x72, 0xb0, 0xc4, 0xa6, 0x72,
-    0x64, 0x61, 0x51, 0x3b, 0x54, 0x61, 0x80, 0x92, 0x24, 0x01, 0x00, 0x04,
-    0x4b, 0x80, 0x92, 0xb0, 0xb9, 0xb9, 0xae, 0x72, 0x8e, 0xc7, 0xec, 0x4b,
-    0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x09, 0x09, 0x12, 0x3a,
-    0x2b, 0x12, 0x06, 0x21, 0x96, 0xc1, 0xcb, 0xd3, 0xd3, 0xcb, 0xb8, 0xab,
-    0xcc, 0xc1, 0xd3, 0xd3, 0xd3, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd3, 0xde,
-    0xd3, 0xd3, 0xd3, 0xde, 0xde, 0xdf, 0xde, 0xdf, 0xe9, 0xe9, 0xe9, 0xe9,
-    0x7d, 0x76, 0x7a, 0x76, 0x74, 0x75, 0x75, 0x75, 0x75, 0x6e, 0x75, 0x6c,
-    0x75, 0x75, 0x6c, 0x6e, 0x6e, 0x6c, 0x6e, 0x75, 0x75, 0x74, 0x74, 0x74,
-    0x75, 0x75, 0x6c, 0x6c, 0x6a, 0x6c, 0x71, 0x74, 0x74, 0x74, 0x71, 0x75,
-    0x75, 0x74, 0x76, 0x7a, 0x76, 0x76, 0x76, 0x7d, 0x7a, 0x7d, 0x7d, 0x81,
-    0x81, 0x81, 0x81, 0x8a, 0x8a, 0x8a, 0x8a, 0x90, 0x91, 0x91, 0x97, 0x99,
-    0x99, 0xa3, 0xa9, 0xa7, 0xb4, 0xb4, 0xbf, 0xcb, 0xd3, 0xcc, 0x96, 0x28,
-    0x16, 0x05, 0x05, 0x05, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02,
-    0x02, 0x02, 0x05, 0x0a, 0x0e, 0x19, 0x1e, 0x19, 0x19, 0x0e, 0x0e, 0x19,
-    0x1a, 0x1e, 0x19, 0x19, 0x19, 0x1e, 0x1f, 0x26, 0x25, 0x29, 0x37, 0x37,
-    0x3f, 0x3f, 0x47, 0x47, 0x49, 0x4a, 0x55, 0x5e, 0x68, 0x6c, 0x74, 0x76,
-    0x81, 0x88, 0x91, 0x91, 0x91, 0x94, 0x9d, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0x9d, 0xa3, 0xa3, 0x4e, 0x2d, 0x2d, 0x2f, 0x28, 0x28,
-    0x28, 0x26, 0x26, 0x26, 0x1e, 0x11, 0x09, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x35, 0x70, 0x70, 0xb6, 0xb6, 0x38, 0x39, 0x50,
-    0x15, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0b, 0x0b, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x04, 0x04, 0x06, 0x24, 0x72, 0x8e, 0x72, 0xbc, 0x8d,
-    0x61, 0x32, 0x32, 0x27, 0x61, 0x92, 0xc9, 0xc7, 0x92, 0x61, 0xc7, 0xc7,
-    0xd7, 0xa2, 0x3b, 0x23, 0x0f, 0x00, 0x01, 0x06, 0x40, 0x80, 0xa2, 0xa2,
-    0x61, 0x27, 0x32, 0x32, 0x32, 0x40, 0x54, 0x23, 0x0a, 0x0a, 0x05, 0x05,
-    0x03, 0x03, 0x02, 0x24, 0xa6, 0xc4, 0xd9, 0xae, 0x73, 0x73, 0x73, 0x40,
-    0x32, 0x61, 0x73, 0x92, 0x92, 0x15, 0x02, 0x01, 0x00, 0x4b, 0x80, 0xa2,
-    0xb9, 0xc7, 0xd7, 0xd9, 0xae, 0xae, 0xc8, 0x8d, 0x0f, 0x00, 0x04, 0x04,
-    0x04, 0x04, 0x04, 0x04, 0x09, 0x09, 0x09, 0x12, 0x2b, 0x5c, 0x7c, 0x85,
-    0xb8, 0xc1, 0xcb, 0xcb, 0xd3, 0xd3, 0xd3, 0xde, 0xde, 0xde, 0xde, 0xde,
-    0xde, 0xde, 0xdf, 0xdf, 0xde, 0xde, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xe9, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0x75, 0x75, 0x6e, 0x6e,
-    0x75, 0x75, 0x75, 0x6e, 0x6e, 0x6e, 0x6e, 0x6a, 0x6a, 0x6e, 0x6c, 0x6e,
-    0x6e, 0x6c, 0x6e, 0x6e, 0x6e, 0x6c, 0x71, 0x6e, 0x6e, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x6e, 0x6c, 0x75, 0x75, 0x74, 0x74,
-    0x75, 0x74, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x81, 0x7d, 0x7d, 0x82,
-    0x81, 0x81, 0x88, 0x88, 0x88, 0x88, 0x90, 0x90, 0x97, 0x97, 0x99, 0x9d,
-    0xa7, 0xa7, 0xaa, 0xb4, 0xc1, 0xbf, 0xd8, 0xb6, 0x4c, 0x1e, 0x0a, 0x05,
-    0x05, 0x02, 0x00, 0x02, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02,
-    0x05, 0x0a, 0x0e, 0x16, 0x1a, 0x16, 0x0e, 0x0e, 0x0e, 0x19, 0x1a, 0x19,
-    0x19, 0x19, 0x19, 0x1e, 0x1f, 0x1f, 0x25, 0x2d, 0x37, 0x31, 0x37, 0x2d,
-    0x2a, 0x25, 0x37, 0x47, 0x4d, 0x55, 0x5e, 0x68, 0x74, 0x74, 0x7d, 0x81,
-    0x81, 0x88, 0x88, 0x91, 0x94, 0x94, 0x9d, 0x94, 0x91, 0x94, 0x91, 0x94,
-    0x90, 0x66, 0x29, 0x28, 0x28, 0x28, 0x26, 0x26, 0x26, 0x26, 0x1e, 0x1e,
-    0x1d, 0x11, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x02, 0x01,
-    0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x15, 0x39, 0x67,
-    0xab, 0xd8, 0xdf, 0xdf, 0xb6, 0xb6, 0x96, 0x0f, 0x0f, 0x15, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0b, 0x0b, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x04, 0x06, 0x04, 0x1c, 0x4b, 0x4b, 0xd4, 0xba, 0xa6, 0xa6, 0x8e, 0x92,
-    0x92, 0x32, 0x72, 0xc4, 0xa6, 0x72, 0x72, 0xa6, 0xb0, 0xb0, 0x54, 0x32,
-    0x06, 0x00, 0x00, 0x02, 0x23, 0x51, 0x80, 0x80, 0x32, 0x32, 0x32, 0x4b,
-    0x8e, 0xa4, 0x40, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x00, 0x02,
-    0x35, 0xb9, 0xd7, 0xd9, 0xae, 0xa4, 0xa4, 0x8e, 0x32, 0x51, 0x72, 0x80,
-    0xa6, 0x72, 0x01, 0x01, 0x00, 0x02, 0x32, 0x8e, 0xa6, 0xc7, 0xd7, 0xd7,
-    0xe5, 0xc7, 0xb9, 0xb9, 0x1c, 0x09, 0x09, 0x04, 0x04, 0x04, 0x04, 0x09,
-    0x09, 0x09, 0x06, 0x09, 0x09, 0x06, 0x38, 0x99, 0xa9, 0xb3, 0xb3, 0xbf,
-    0xcb, 0xcb, 0xcb, 0xd3, 0xd3, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
-    0xd3, 0xde, 0xdf, 0xde, 0xdf, 0xde, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xe9, 0xe9, 0x75, 0x75, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
-    0x6a, 0x6a, 0x6a, 0x68, 0x68, 0x6a, 0x6a, 0x6a, 0x6a, 0x6c, 0x6a, 0x6a,
-    0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x68, 0x6c, 0x6c, 0x6c, 0x6c, 0x6a,
-    0x6a, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x75, 0x74, 0x74, 0x74, 0x76, 0x76, 0x78, 0x76, 0x7d, 0x81, 0x7d, 0x81,
-    0x81, 0x81, 0x88, 0x8a, 0x89, 0x91, 0x97, 0x97, 0x9d, 0x9d, 0x9d, 0xa9,
-    0xa9, 0xb3, 0xb4, 0xbf, 0xcc, 0x7c, 0x28, 0x0e, 0x05, 0x05, 0x01, 0x01,
-    0x01, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x03, 0x0a,
-    0x0e, 0x19, 0x16, 0x16, 0x0e, 0x0e, 0x0e, 0x19, 0x19, 0x16, 0x16, 0x19,
-    0x19, 0x1b, 0x1e, 0x1f, 0x25, 0x1f, 0x19, 0x19, 0x0c, 0x0e, 0x19, 0x1f,
-    0x29, 0x3d, 0x4d, 0x53, 0x55, 0x68, 0x68, 0x6c, 0x74, 0x74, 0x74, 0x76,
-    0x82, 0x81, 0x81, 0x81, 0x81, 0x7d, 0x76, 0x74, 0x4e, 0x29, 0x26, 0x28,
-    0x28, 0x26, 0x26, 0x26, 0x26, 0x1e, 0x1e, 0x16, 0x0a, 0x04, 0x01, 0x00,
-    0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x1d, 0x42, 0x77, 0xcc, 0xdf, 0xdf, 0xd3, 0xcb, 0xb4,
-    0x96, 0x58, 0x0f, 0x15, 0x15, 0x15, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0b, 0x06, 0x06, 0x0b, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00,
-    0x06, 0x0f, 0x35, 0x4b, 0x61, 0x4b, 0x51, 0x3b, 0x1c, 0x00, 0x0b, 0x51,
-    0x72, 0x61, 0x73, 0x80, 0x80, 0x8f, 0x73, 0x32, 0x00, 0x00, 0x00, 0x01,
-    0x0f, 0x40, 0x64, 0x92, 0x92, 0xa4, 0x72, 0xae, 0xc7, 0x92, 0x70, 0x1a,
-    0x08, 0x03, 0x01, 0x05, 0x05, 0x05, 0x05, 0x01, 0x02, 0x32, 0xc7, 0xe6,
-    0xd9, 0xc7, 0xc7, 0xb9, 0x72, 0x61, 0x72, 0x8e, 0xae, 0xae, 0x24, 0x01,
-    0x00, 0x00, 0x02, 0x15, 0x61, 0x8e, 0xb9, 0xd7, 0xc7, 0xae, 0x72, 0x35,
-    0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x09, 0x21, 0x3a, 0x8a, 0x99, 0xa7, 0xa9, 0xa9, 0xa9, 0xb1, 0xbf,
-    0xbf, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xd3, 0xcb, 0xd3, 0xd3, 0xde,
-    0xd3, 0xcb, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
-    0x6e, 0x71, 0x6c, 0x6a, 0x6a, 0x6a, 0x6c, 0x6a, 0x6a, 0x68, 0x68, 0x68,
-    0x63, 0x68, 0x6a, 0x6a, 0x6a, 0x6a, 0x68, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a,
-    0x6a, 0x6a, 0x68, 0x68, 0x6a, 0x6a, 0x68, 0x6a, 0x68, 0x6a, 0x6a, 0x68,
-    0x68, 0x68, 0x6a, 0x6a, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x6c, 0x6c, 0x74,
-    0x74, 0x74, 0x74, 0x76, 0x78, 0x78, 0x76, 0x76, 0x7d, 0x81, 0x81, 0x81,
-    0x89, 0x88, 0x8a, 0x91, 0x90, 0x90, 0x94, 0x97, 0x99, 0x9d, 0xa7, 0xb4,
-    0xbf, 0xcb, 0xa1, 0x43, 0x19, 0x0a, 0x03, 0x01, 0x01, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x05, 0x05, 0x0a, 0x0e, 0x16,
-    0x16, 0x0e, 0x0e, 0x0e, 0x0e, 0x19, 0x19, 0x16, 0x0e, 0x0c, 0x19, 0x19,
-    0x1a, 0x16, 0x08, 0x0a, 0x0a, 0x07, 0x16, 0x1e, 0x26, 0x37, 0x3f, 0x3f,
-    0x47, 0x4d, 0x55, 0x5e, 0x5e, 0x68, 0x68, 0x6c, 0x6c, 0x6c, 0x6c, 0x68,
-    0x68, 0x68, 0x4d, 0x37, 0x26, 0x26, 0x26, 0x26, 0x28, 0x26, 0x1e, 0x1e,
-    0x1e, 0x16, 0x0e, 0x0a, 0x05, 0x01, 0x02, 0x01, 0x05, 0x05, 0x02, 0x02,
-    0x01, 0x02, 0x02, 0x00, 0x00, 0x00, 0x04, 0x03, 0x0e, 0x2f, 0x6d, 0xab,
-    0xd8, 0xdf, 0xd8, 0xcc, 0xcc, 0xb4, 0x77, 0x50, 0x15, 0x0f, 0x15, 0x15,
-    0x14, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0f, 0x0b, 0x06, 0x0f, 0x0f,
-    0x0b, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x04, 0x00, 0x00,
-    0x04, 0x0b, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x06, 0x24, 0x24, 0x24, 0x23,
-    0x24, 0x23, 0x32, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x61, 0x73,
-    0x8e, 0x92, 0xb0, 0xc7, 0x92, 0x35, 0x96, 0xa1, 0x65, 0x28, 0x0e, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x32, 0xb9, 0xe6, 0xeb, 0xee, 0xeb,
-    0xc7, 0xae, 0xae, 0xb9, 0xc7, 0x61, 0x0f, 0x02, 0x00, 0x00, 0x00, 0x01,
-    0x02, 0x15, 0x32, 0x32, 0x35, 0x15, 0x02, 0x02, 0x00, 0x04, 0x04, 0x04,
-    0x04, 0x09, 0x09, 0x09, 0x09, 0x09, 0x12, 0x1d, 0x21, 0x12, 0x06, 0x18,
-    0x4c, 0x88, 0x91, 0x91, 0x91, 0x91, 0x91, 0xa7, 0xb1, 0xb3, 0xb3, 0xb1,
-    0xb1, 0xc1, 0xbf, 0xbf, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xb3, 0xc1, 0xd3,
-    0xd3, 0xcb, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0x6a, 0x68, 0x6a, 0x63,
-    0x63, 0x63, 0x68, 0x6a, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x68, 0x68,
-    0x63, 0x68, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6a, 0x63, 0x68, 0x68,
-    0x63, 0x63, 0x6a, 0x63, 0x63, 0x68, 0x68, 0x63, 0x68, 0x68, 0x63, 0x6a,
-    0x6a, 0x68, 0x68, 0x68, 0x6a, 0x6a, 0x6c, 0x6e, 0x6c, 0x6e, 0x6c, 0x75,
-    0x75, 0x75, 0x74, 0x76, 0x76, 0x76, 0x76, 0x7d, 0x82, 0x82, 0x81, 0x81,
-    0x88, 0x8a, 0x89, 0x91, 0x90, 0x9d, 0x99, 0xa3, 0xa9, 0xb1, 0xb8, 0xb8,
-    0x5c, 0x1e, 0x0a, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01,
-    0x02, 0x01, 0x01, 0x01, 0x05, 0x05, 0x05, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e,
-    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x16, 0x19, 0x16, 0x0e,
-    0x0e, 0x1a, 0x26, 0x29, 0x29, 0x29, 0x29, 0x2d, 0x37, 0x3e, 0x47, 0x41,
-    0x4a, 0x4d, 0x56, 0x56, 0x55, 0x4d, 0x4d, 0x4d, 0x44, 0x34, 0x26, 0x1e,
-    0x1e, 0x26, 0x28, 0x1e, 0x26, 0x1e, 0x1d, 0x16, 0x0e, 0x0a, 0x03, 0x05,
-    0x01, 0x01, 0x05, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00,
-    0x03, 0x0e, 0x1e, 0x3a, 0x96, 0xb6, 0xd8, 0xd8, 0xcc, 0xcb, 0xbf, 0xb4,
-    0x9f, 0x50, 0x39, 0x1c, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
-    0x15, 0x15, 0x0f, 0x0f, 0x0f, 0x0b, 0x0f, 0x0b, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-    0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x23, 0x32, 0x40, 0x54, 0x51,
-    0x14, 0x02, 0x11, 0x58, 0xa1, 0xac, 0x59, 0x26, 0x01, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x35, 0xa6, 0xd7, 0xe6, 0xf2, 0xeb, 0xd9, 0xd7, 0xd9,
-    0xd9, 0x61, 0x0b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x09, 0x12, 0x12, 0x06,
-    0x0b, 0x06, 0x12, 0x2f, 0x3c, 0x34, 0x2f, 0x2f, 0x43, 0x6c, 0x76, 0x76,
-    0x7d, 0x88, 0x88, 0x91, 0x91, 0x91, 0xa3, 0xa3, 0xa9, 0xa9, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb3, 0xb3, 0xb1, 0xb3, 0xc1, 0xb1,
-    0xbf, 0xbf, 0xc1, 0xc1, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x68, 0x68, 0x68, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x68, 0x68, 0x63, 0x68, 0x68, 0x68,
-    0x63, 0x63, 0x68, 0x68, 0x63, 0x63, 0x63, 0x63, 0x68, 0x68, 0x63, 0x63,
-    0x68, 0x6a, 0x68, 0x6c, 0x6c, 0x6a, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x74,
-    0x75, 0x74, 0x74, 0x76, 0x76, 0x7d, 0x7d, 0x89, 0x81, 0x81, 0x81, 0x88,
-    0x88, 0x90, 0x90, 0x97, 0x99, 0x9d, 0xa7, 0xb4, 0xb4, 0x7c, 0x1e, 0x0e,
-    0x03, 0x01, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x01, 0x01,
-    0x05, 0x03, 0x05, 0x05, 0x05, 0x0a, 0x0a, 0x07, 0x0e, 0x0e, 0x0e, 0x0a,
-    0x0a, 0x07, 0x0a, 0x0a, 0x0a, 0x0a, 0x0e, 0x0e, 0x16, 0x1a, 0x1f, 0x25,
-    0x25, 0x1e, 0x0e, 0x1f, 0x1f, 0x25, 0x29, 0x31, 0x3f, 0x3f, 0x47, 0x47,
-    0x47, 0x3d, 0x2d, 0x29, 0x26, 0x1e, 0x1a, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x16, 0x0e, 0x0a, 0x0a, 0x03, 0x05, 0x01, 0x01, 0x02, 0x02, 0x02,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x16, 0x26, 0x4c, 0xab, 0xcc,
-    0xd8, 0xd8, 0xcb, 0xbf, 0xb4, 0xb4, 0xaa, 0xa7, 0x7c, 0x6d, 0x85, 0x58,
-    0x15, 0x14, 0x1c, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x14, 0x15, 0x0f,
-    0x0b, 0x0b, 0x0b, 0x06, 0x04, 0x04, 0x06, 0x06, 0x0b, 0x06, 0x06, 0x06,
-    0x06, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04,
-    0x06, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x06, 0x0b, 0x0b, 0x04, 0x01, 0x00, 0x00, 0x04,
-    0x1d, 0x58, 0xbf, 0xa1, 0x3a, 0x0a, 0x01, 0x01, 0x00, 0x00, 0x02, 0x00,
-    0x1c, 0x8e, 0xd7, 0xc4, 0xd9, 0xd7, 0xc4, 0xc7, 0xb9, 0x92, 0x0b, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x04, 0x09, 0x11, 0x1d, 0x1e, 0x1d, 0x1d, 0x26, 0x2d,
-    0x3e, 0x37, 0x37, 0x49, 0x4a, 0x56, 0x5f, 0x68, 0x6e, 0x75, 0x75, 0x76,
-    0x7d, 0x81, 0x88, 0x91, 0x91, 0x91, 0x97, 0x97, 0x9d, 0x99, 0x99, 0x99,
-    0xa7, 0x99, 0x99, 0xa3, 0xa3, 0xb3, 0xa9, 0xb1, 0xb3, 0xa9, 0xb3, 0xb3,
-    0x63, 0x63, 0x63, 0x63, 0x5f, 0x5f, 0x5f, 0x63, 0x5f, 0x63, 0x5f, 0x5e,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x5f, 0x63, 0x63, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x63, 0x5f, 0x5e, 0x5e, 0x63, 0x68, 0x68, 0x63, 0x63, 0x63, 0x68,
-    0x63, 0x63, 0x63, 0x63, 0x5e, 0x63, 0x63, 0x68, 0x68, 0x63, 0x68, 0x68,
-    0x68, 0x68, 0x6a, 0x6a, 0x6c, 0x6c, 0x6e, 0x6c, 0x6e, 0x6e, 0x6c, 0x74,
-    0x76, 0x76, 0x7a, 0x76, 0x7a, 0x7d, 0x78, 0x78, 0x81, 0x88, 0x88, 0x8a,
-    0x90, 0x97, 0x99, 0x9d, 0xa7, 0xb3, 0x85, 0x28, 0x0e, 0x0a, 0x05, 0x02,
-    0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x03, 0x05, 0x03, 0x05,
-    0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x07, 0x0a, 0x0a, 0x0e, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x07, 0x0e, 0x0e, 0x0e, 0x19, 0x16, 0x0a, 0x03, 0x01,
-    0x02, 0x01, 0x03, 0x07, 0x1f, 0x26, 0x26, 0x26, 0x1e, 0x19, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x19, 0x1d, 0x1e, 0x1e, 0x0e, 0x0a, 0x05, 0x05,
-    0x05, 0x05, 0x02, 0x01, 0x01, 0x01, 0x02, 0x05, 0x01, 0x00, 0x00, 0x03,
-    0x0a, 0x1e, 0x26, 0x4c, 0xb2, 0xd8, 0xd8, 0xcc, 0xbf, 0xbf, 0xb4, 0xb4,
-    0xa9, 0xaa, 0xa7, 0x99, 0x9f, 0x97, 0x94, 0x42, 0x15, 0x39, 0x6d, 0x65,
-    0x22, 0x22, 0x39, 0x39, 0x1c, 0x1c, 0x15, 0x0f, 0x0b, 0x0f, 0x0f, 0x0f,
-    0x0b, 0x0b, 0x0f, 0x0f, 0x0f, 0x0b, 0x0b, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x0b, 0x06, 0x06, 0x06, 0x06, 0x04, 0x06, 0x06, 0x06,
-    0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x2f, 0xb8,
-    0xc1, 0x59, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
-    0x24, 0x4b, 0x61, 0x72, 0x72, 0x23, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04,
-    0x04, 0x09, 0x11, 0x1d, 0x26, 0x26, 0x28, 0x2f, 0x30, 0x31, 0x3e, 0x3f,
-    0x41, 0x49, 0x4a, 0x56, 0x55, 0x5f, 0x5f, 0x6a, 0x6a, 0x6c, 0x78, 0x78,
-    0x76, 0x76, 0x76, 0x76, 0x81, 0x88, 0x88, 0x81, 0x88, 0x88, 0x91, 0x91,
-    0x91, 0x97, 0x9d, 0xa3, 0x99, 0x99, 0x99, 0xa3, 0x63, 0x63, 0x63, 0x63,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x63, 0x63, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x63, 0x63, 0x5e, 0x5e,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x68, 0x68, 0x6a, 0x6a,
-    0x68, 0x6c, 0x68, 0x68, 0x68, 0x6a, 0x6e, 0x6c, 0x6e, 0x75, 0x74, 0x74,
-    0x74, 0x74, 0x76, 0x76, 0x7d, 0x7d, 0x81, 0x88, 0x88, 0x89, 0x94, 0x9d,
-    0x9d, 0xa3, 0xa9, 0x85, 0x2f, 0x16, 0x0a, 0x05, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x03, 0x03, 0x05, 0x05, 0x03,
-    0x08, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x0e, 0x0a, 0x0e, 0x0a,
-    0x0a, 0x08, 0x0a, 0x05, 0x0a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0e, 0x0a, 0x05, 0x05, 0x05, 0x00, 0x02, 0x02, 0x01, 0x00,
-    0x01, 0x01, 0x00, 0x01, 0x01, 0x05, 0x0e, 0x1e, 0x28, 0x43, 0xab, 0xd8,
-    0xd8, 0xcb, 0xbf, 0xb4, 0xb4, 0xaa, 0xac, 0xa7, 0x9d, 0x9d, 0x9d, 0x97,
-    0x94, 0x89, 0x82, 0x42, 0x38, 0x7a, 0x81, 0x7a, 0x7c, 0x7a, 0x78, 0x7b,
-    0x66, 0x18, 0x0f, 0x0f, 0x0f, 0x0f, 0x0b, 0x0b, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0b, 0x0b, 0x0b, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0b, 0x0f, 0x0f, 0x0f,
-    0x0b, 0x06, 0x0b, 0x06, 0x06, 0x06, 0x04, 0x06, 0x06, 0x06, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x3a, 0xb8, 0xcb, 0x7c, 0x16,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02,
-    0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x03,
-    0x04, 0x04, 0x04, 0x09, 0x09, 0x04, 0x04, 0x04, 0x04, 0x09, 0x09, 0x16,
-    0x1e, 0x26, 0x2c, 0x2c, 0x2d, 0x2d, 0x37, 0x37, 0x37, 0x3f, 0x3f, 0x3d,
-    0x41, 0x49, 0x4a, 0x49, 0x56, 0x5f, 0x5f, 0x63, 0x63, 0x68, 0x63, 0x6a,
-    0x6c, 0x75, 0x76, 0x76, 0x78, 0x75, 0x76, 0x76, 0x78, 0x84, 0x88, 0x88,
-    0x81, 0x88, 0x88, 0x91, 0x5f, 0x5f, 0x5b, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e,
-    0x5f, 0x5f, 0x5f, 0x5e, 0x5f, 0x5f, 0x5e, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6a, 0x6a, 0x63, 0x63,
-    0x68, 0x6a, 0x6a, 0x68, 0x68, 0x6a, 0x6e, 0x6e, 0x6c, 0x6c, 0x6c, 0x74,
-    0x74, 0x76, 0x7d, 0x7d, 0x81, 0x88, 0x88, 0x90, 0x90, 0x94, 0x97, 0xa9,
-    0x82, 0x2f, 0x16, 0x07, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x05, 0x05, 0x01, 0x01, 0x03, 0x0a, 0x0a,
-    0x0a, 0x0e, 0x0e, 0x0e, 0x08, 0x0a, 0x0a, 0x09, 0x09, 0x03, 0x04, 0x01,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x05, 0x05, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x03,
-    0x03, 0x05, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-    0x16, 0x1e, 0x2f, 0x4c, 0x96, 0xd8, 0xd8, 0xcb, 0xc1, 0xb4, 0xb4, 0xa9,
-    0xa9, 0xa3, 0x99, 0x97, 0x94, 0x94, 0x90, 0x8a, 0x88, 0x82, 0x81, 0x7a,
-    0x7a, 0x71, 0x71, 0x7a, 0x76, 0x7a, 0x7a, 0x71, 0x2b, 0x0b, 0x0f, 0x22,
-    0x22, 0x0f, 0x0f, 0x0b, 0x0f, 0x0f, 0x0f, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x06, 0x06, 0x06, 0x0f, 0x0f, 0x0f, 0x0b, 0x06, 0x06, 0x06, 0x06,
-    0x0b, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x06, 0x04, 0x04, 0x04,
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x2f, 0xa1, 0xcb, 0x85, 0x1e, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x11, 0x0a, 0x04, 0x04, 0x04,
-    0x09, 0x11, 0x09, 0x04, 0x09, 0x09, 0x09, 0x09, 0x16, 0x1e, 0x1f, 0x26,
-    0x29, 0x29, 0x29, 0x2a, 0x2a, 0x25, 0x25, 0x29, 0x31, 0x3f, 0x3f, 0x3f,
-    0x41, 0x49, 0x47, 0x53, 0x53, 0x55, 0x56, 0x56, 0x5e, 0x5f, 0x63, 0x68,
-    0x68, 0x6a, 0x68, 0x63, 0x6a, 0x6a, 0x6e, 0x6e, 0x75, 0x74, 0x74, 0x74,
-    0x5e, 0x5f, 0x5e, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5b, 0x56,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e,
-    0x5f, 0x5f, 0x5e, 0x5e, 0x5f, 0x5f, 0x5f, 0x5e, 0x5e, 0x5e, 0x5f, 0x5f,
-    0x5e, 0x5f, 0x5f, 0x5e, 0x5f, 0x5f, 0x5e, 0x5f, 0x5f, 0x63, 0x63, 0x63,
-    0x63, 0x68, 0x68, 0x68, 0x68, 0x63, 0x63, 0x63, 0x63, 0x63, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x6c, 0x71, 0x6c, 0x68, 0x6c, 0x6c, 0x76, 0x74, 0x74,
-    0x76, 0x7a, 0x81, 0x88, 0x8a, 0x88, 0x91, 0x91, 0x99, 0x82, 0x2f, 0x1a,
-    0x0a, 0x05, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x01, 0x01, 0x02, 0x02, 0x05, 0x01, 0x01, 0x03, 0x03, 0x07, 0x0e, 0x0a,
-    0x03, 0x03, 0x03, 0x04, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x19, 0x1f, 0x28, 0x4c, 0x96, 0xcc,
-    0xd8, 0xcc, 0xbf, 0xb8, 0xaa, 0xaa, 0xaa, 0x9d, 0x99, 0x97, 0x90, 0x90,
-    0x8a, 0x8a, 0x8a, 0x82, 0x82, 0x7d, 0x7d, 0x76, 0x71, 0x71, 0x7a, 0x71,
-    0x74, 0x71, 0x71, 0x71, 0x3a, 0x21, 0x38, 0x59, 0x3a, 0x0b, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x22, 0x18, 0x0b, 0x06, 0x0b, 0x0f, 0x0f, 0x06, 0x0b, 0x0f,
-    0x0f, 0x0f, 0x0b, 0x06, 0x06, 0x06, 0x06, 0x0b, 0x0b, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x06, 0x06, 0x06, 0x04, 0x04,
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3a, 0xa9, 0xc1, 0x90, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x0a, 0x0e, 0x0e, 0x08, 0x09, 0x04, 0x09, 0x11, 0x11,
-    0x0a, 0x09, 0x09, 0x08, 0x0e, 0x16, 0x19, 0x1e, 0x1f, 0x19, 0x19, 0x19,
-    0x1b, 0x0c, 0x0e, 0x07, 0x0c, 0x1f, 0x25, 0x25, 0x29, 0x2d, 0x37, 0x41,
-    0x41, 0x41, 0x49, 0x49, 0x49, 0x53, 0x53, 0x53, 0x53, 0x56, 0x4d, 0x53,
-    0x56, 0x53, 0x5f, 0x5f, 0x63, 0x63, 0x63, 0x6a, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x56, 0x56, 0x56, 0x5f, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x55, 0x55, 0x5e, 0x56, 0x56, 0x5f, 0x56, 0x5f, 0x5e, 0x5e,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5e, 0x5f, 0x5f, 0x5f, 0x63, 0x63, 0x5f, 0x5f, 0x5e, 0x5e, 0x68, 0x5e,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x63, 0x63, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x6c, 0x6c, 0x6c, 0x6c, 0x74, 0x76, 0x76, 0x7d,
-    0x81, 0x81, 0x8a, 0x90, 0x90, 0x9d, 0x7c, 0x28, 0x19, 0x0a, 0x03, 0x01,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x02, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x08, 0x08, 0x03, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x00, 0x01, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04,
-    0x1d, 0x28, 0x29, 0x43, 0x96, 0xcc, 0xd8, 0xcb, 0xbf, 0xb4, 0xaa, 0xa9,
-    0xa3, 0x99, 0x97, 0x94, 0x94, 0x8a, 0x8a, 0x8a, 0x82, 0x82, 0x7a, 0x7a,
-    0x76, 0x7a, 0x7a, 0x76, 0x71, 0x71, 0x74, 0x71, 0x71, 0x6c, 0x6c, 0x6c,
-    0x68, 0x59, 0x66, 0x66, 0x3a, 0x15, 0x15, 0x15, 0x2b, 0x3a, 0x3a, 0x12,
-    0x0b, 0x06, 0x06, 0x06, 0x0b, 0x0f, 0x0f, 0x0f, 0x0f, 0x0b, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x0b, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x06, 0x04, 0x06, 0x06, 0x06,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3a, 0xa3,
-    0xb3, 0x90, 0x26, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x05, 0x0a, 0x0a, 0x0a, 0x08, 0x09, 0x09, 0x08, 0x0e, 0x0e, 0x0e, 0x0a,
-    0x0e, 0x0e, 0x0e, 0x16, 0x19, 0x0e, 0x0e, 0x07, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x07, 0x0e, 0x19, 0x19, 0x1b, 0x26, 0x29, 0x37, 0x31, 0x36, 0x3f, 0x3f,
-    0x3f, 0x3f, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x53, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x5f, 0x56, 0x56,
-    0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x57, 0x56, 0x56,
-    0x56, 0x55, 0x56, 0x5f, 0x56, 0x56, 0x56, 0x56, 0x5f, 0x60, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5e, 0x5f, 0x5f, 0x60, 0x5f, 0x5f, 0x5e, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5e, 0x5e, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e,
-    0x5f, 0x5f, 0x5f, 0x5e, 0x5f, 0x5e, 0x68, 0x68, 0x68, 0x6a, 0x68, 0x68,
-    0x68, 0x6c, 0x6c, 0x6c, 0x6c, 0x74, 0x74, 0x74, 0x76, 0x7d, 0x81, 0x88,
-    0x88, 0x91, 0x97, 0x71, 0x26, 0x19, 0x05, 0x01, 0x01, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01,
-    0x05, 0x05, 0x01, 0x01, 0x05, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x16, 0x2f, 0x29, 0x2f, 0x85, 0xcc,
-    0xcc, 0xcb, 0xbf, 0xb4, 0xa9, 0xaa, 0x9d, 0x99, 0x97, 0x90, 0x89, 0x89,
-    0x8a, 0x82, 0x82, 0x81, 0x7d, 0x7a, 0x7a, 0x75, 0x74, 0x74, 0x74, 0x71,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x71, 0x6c, 0x6c, 0x6c, 0x71, 0x68, 0x68, 0x66,
-    0x66, 0x4c, 0x42, 0x4f, 0x5b, 0x63, 0x34, 0x0b, 0x06, 0x06, 0x0b, 0x0b,
-    0x0f, 0x0f, 0x0f, 0x0b, 0x0b, 0x06, 0x06, 0x0b, 0x06, 0x06, 0x0b, 0x0b,
-    0x0b, 0x06, 0x06, 0x0b, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x04, 0x04,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x97, 0xa9, 0x8a, 0x1e,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0e, 0x0e, 0x0a, 0x07, 0x0e,
-    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x0e, 0x19, 0x1b, 0x1f, 0x26,
-    0x26, 0x25, 0x29, 0x29, 0x29, 0x29, 0x2a, 0x31, 0x31, 0x31, 0x37, 0x36,
-    0x37, 0x37, 0x3f, 0x3f, 0x37, 0x3f, 0x3f, 0x3f, 0x41, 0x3f, 0x3f, 0x3f,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x55, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x5f, 0x5f, 0x5e, 0x5f, 0x5f, 0x5f,
-    0x5e, 0x55, 0x5f, 0x55, 0x55, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x5f, 0x5f, 0x5f,
-    0x5e, 0x5e, 0x63, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6a, 0x68, 0x68,
-    0x6c, 0x6c, 0x6c, 0x74, 0x75, 0x74, 0x76, 0x81, 0x88, 0x88, 0x88, 0x8a,
-    0x59, 0x1f, 0x16, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x03, 0x0a, 0x0a, 0x03, 0x00, 0x00, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x0e, 0x28, 0x34, 0x2d, 0x62, 0xcc, 0xd8, 0xcb, 0xbf, 0xb4, 0xb4, 0xa7,
-    0xa3, 0x9d, 0x9f, 0x94, 0x90, 0x8a, 0x89, 0x82, 0x81, 0x7d, 0x78, 0x76,
-    0x76, 0x76, 0x76, 0x74, 0x75, 0x75, 0x6c, 0x6c, 0x6c, 0x6c, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x66, 0x68, 0x68, 0x66, 0x63, 0x69, 0x66, 0x66,
-    0x5f, 0x5f, 0x2f, 0x06, 0x06, 0x06, 0x0b, 0x0f, 0x0f, 0x0f, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0b, 0x06, 0x06, 0x0b, 0x0f, 0x0f,
-    0x0f, 0x0b, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0b,
-    0x0f, 0x06, 0x06, 0x06, 0x04, 0x04, 0x06, 0x06, 0x06, 0x04, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x8a, 0xb3, 0x7a, 0x0c, 0x21, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x0a, 0x0a, 0x0a, 0x08,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0e, 0x0e,
-    0x0e, 0x0e, 0x16, 0x16, 0x19, 0x1e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x26, 0x25, 0x29, 0x29, 0x2a, 0x29, 0x29, 0x31, 0x2d,
-    0x2a, 0x31, 0x37, 0x37, 0x31, 0x37, 0x31, 0x31, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x55, 0x56, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x5f, 0x5e, 0x5e, 0x55, 0x56, 0x5e, 0x5e, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x68, 0x5f, 0x5f, 0x5f, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x5e,
-    0x68, 0x5e, 0x63, 0x63, 0x5e, 0x63, 0x63, 0x68, 0x68, 0x68, 0x68, 0x6c,
-    0x6c, 0x6e, 0x74, 0x76, 0x7d, 0x81, 0x81, 0x81, 0x82, 0x43, 0x1f, 0x07,
-    0x05, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x02, 0x02,
-    0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x1e, 0x3c, 0x37, 0x43, 0xab,
-    0xd8, 0xcc, 0xbf, 0xb4, 0xb4, 0xaa, 0xa3, 0x9d, 0x9d, 0x94, 0x94, 0x8a,
-    0x8a, 0x82, 0x81, 0x81, 0x7d, 0x76, 0x76, 0x76, 0x74, 0x74, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x68, 0x68, 0x68, 0x6a, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x63, 0x63, 0x5e, 0x63, 0x66, 0x5b, 0x5e, 0x2f, 0x09,
-    0x0b, 0x06, 0x15, 0x15, 0x22, 0x18, 0x0b, 0x06, 0x06, 0x06, 0x0b, 0x06,
-    0x0b, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0b, 0x0f, 0x0b, 0x0b, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x04, 0x00, 0x00,
-    0x00, 0x12, 0x7c, 0xb3, 0x5b, 0x16, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x01, 0x04, 0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0e, 0x0e,
-    0x0e, 0x0e, 0x16, 0x16, 0x16, 0x1a, 0x1e, 0x19, 0x07, 0x05, 0x03, 0x0e,
-    0x16, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0x1b, 0x1f, 0x25, 0x25, 0x25,
-    0x25, 0x29, 0x29, 0x25, 0x53, 0x56, 0x56, 0x56, 0x55, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x5f,
-    0x56, 0x5f, 0x5e, 0x55, 0x56, 0x56, 0x56, 0x5f, 0x5f, 0x5e, 0x5f, 0x5f,
-    0x5e, 0x5e, 0x5e, 0x5f, 0x5f, 0x5f, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x5e, 0x5e, 0x5f, 0x5e, 0x5e, 0x63, 0x63, 0x68, 0x5f, 0x63, 0x6e, 0x6c,
-    0x74, 0x76, 0x76, 0x76, 0x7d, 0x71, 0x34, 0x1e, 0x08, 0x01, 0x02, 0x01,
-    0x01, 0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x16, 0x2f, 0x3e, 0x3c, 0x7c, 0xcc, 0xd3, 0xbf, 0xb4, 0xb4, 0xaa,
-    0xa3, 0x99, 0x9d, 0x94, 0x94, 0x89, 0x89, 0x89, 0x82, 0x7d, 0x7d, 0x78,
-    0x75, 0x74, 0x71, 0x74, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x66,
-    0x68, 0x66, 0x68, 0x66, 0x68, 0x68, 0x68, 0x68, 0x63, 0x68, 0x5e, 0x63,
-    0x68, 0x66, 0x5e, 0x5e, 0x5b, 0x5e, 0x43, 0x21, 0x22, 0x38, 0x3a, 0x4c,
-    0x4f, 0x2b, 0x18, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x06, 0x04,
-    0x09, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0b, 0x06, 0x06, 0x06, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x0b, 0x06, 0x06, 0x06, 0x06, 0x04, 0x06, 0x04, 0x00, 0x00, 0x11, 0x7c,
-    0xb3, 0x3c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x01, 0x05, 0x03, 0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x07, 0x07, 0x05, 0x05, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01,
-    0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x05, 0x0a, 0x07, 0x0e, 0x16,
-    0x53, 0x53, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x57, 0x55, 0x56, 0x56, 0x57, 0x55,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x55, 0x56, 0x56, 0x56, 0x55, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x5e,
-    0x5f, 0x5f, 0x5e, 0x5f, 0x5f, 0x5e, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5e, 0x55, 0x5f, 0x68, 0x68, 0x68, 0x6c, 0x74, 0x75,
-    0x74, 0x75, 0x57, 0x2d, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x28, 0x34, 0x3e, 0x62,
-    0xb2, 0xd8, 0xcc, 0xb4, 0xb4, 0xaa, 0xaa, 0x9d, 0x9d, 0x90, 0x94, 0x89,
-    0x8a, 0x89, 0x81, 0x7d, 0x7a, 0x76, 0x76, 0x74, 0x75, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x68, 0x68, 0x68, 0x68, 0x66, 0x66, 0x63, 0x6a, 0x66,
-    0x68, 0x68, 0x68, 0x66, 0x63, 0x63, 0x5e, 0x63, 0x5f, 0x5b, 0x5e, 0x5f,
-    0x5e, 0x5e, 0x5b, 0x4f, 0x4c, 0x60, 0x5f, 0x5b, 0x5b, 0x4f, 0x3a, 0x12,
-    0x04, 0x06, 0x0f, 0x0b, 0x0b, 0x06, 0x06, 0x04, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0b, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x00, 0x21, 0x82, 0xa3, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02,
-    0x01, 0x00, 0x00, 0x00, 0x01, 0x05, 0x05, 0x01, 0x01, 0x00, 0x01, 0x01,
-    0x01, 0x00, 0x00, 0x05, 0x05, 0x05, 0x0a, 0x0e, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x57, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x55, 0x56, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x5f, 0x5b, 0x56, 0x5f,
-    0x5f, 0x5e, 0x55, 0x5f, 0x5f, 0x5f, 0x56, 0x5e, 0x63, 0x5f, 0x5e, 0x5e,
-    0x5f, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x5f, 0x5e, 0x56, 0x55,
-    0x55, 0x56, 0x56, 0x5e, 0x5f, 0x5f, 0x63, 0x6a, 0x6c, 0x6c, 0x6e, 0x3e,
-    0x26, 0x0a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x1e, 0x34, 0x31, 0x59, 0xab, 0xcc, 0xcc, 0xbf, 0xb4, 0xaa,
-    0xa7, 0x9d, 0x9d, 0x94, 0x94, 0x8a, 0x8a, 0x82, 0x81, 0x7a, 0x76, 0x76,
-    0x7a, 0x71, 0x74, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x68, 0x6a, 0x68,
-    0x68, 0x68, 0x68, 0x66, 0x63, 0x63, 0x63, 0x66, 0x66, 0x5e, 0x63, 0x63,
-    0x5e, 0x5e, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5b, 0x5b, 0x5b, 0x5b, 0x4e, 0x3c, 0x12, 0x18, 0x38, 0x2b,
-    0x21, 0x0b, 0x06, 0x06, 0x0b, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04,
-    0x06, 0x0f, 0x0b, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x0b, 0x0b, 0x06, 0x06, 0x0b, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x00, 0x2b, 0x90, 0x8a, 0x1a, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x05, 0x01, 0x02, 0x05,
-    0x0a, 0x0a, 0x0e, 0x0a, 0x01, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03,
-    0x01, 0x01, 0x03, 0x00, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x00, 0x00, 0x05, 0x05, 0x53, 0x4a, 0x53, 0x53, 0x56, 0x53, 0x56, 0x56,
-    0x56, 0x56, 0x55, 0x56, 0x56, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x55, 0x56, 0x56, 0x56, 0x55, 0x55, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x5e, 0x56, 0x5f,
-    0x5f, 0x55, 0x56, 0x55, 0x5f, 0x5e, 0x5f, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x55, 0x55, 0x56, 0x55,
-    0x5f, 0x5f, 0x5f, 0x63, 0x68, 0x68, 0x6c, 0x57, 0x37, 0x19, 0x05, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x02, 0x02, 0x01, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x2f, 0x37, 0x3c,
-    0x96, 0xcc, 0xcc, 0xbf, 0xb4, 0xaa, 0xa9, 0x9d, 0x9d, 0x94, 0x94, 0x89,
-    0x8a, 0x82, 0x89, 0x7a, 0x7a, 0x7a, 0x76, 0x74, 0x71, 0x74, 0x6c, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x63, 0x68,
-    0x63, 0x63, 0x68, 0x68, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5b,
-    0x5f, 0x5f, 0x5e, 0x5f, 0x5e, 0x5e, 0x5e, 0x5e, 0x5b, 0x5b, 0x5f, 0x5f,
-    0x5b, 0x5f, 0x55, 0x52, 0x43, 0x43, 0x4e, 0x5b, 0x43, 0x2b, 0x0b, 0x0b,
-    0x22, 0x0b, 0x06, 0x06, 0x06, 0x04, 0x04, 0x06, 0x06, 0x0b, 0x0b, 0x06,
-    0x06, 0x06, 0x0b, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x06, 0x06, 0x0b, 0x06, 0x0b, 0x0b, 0x06, 0x06,
-    0x00, 0x4c, 0x93, 0x66, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x05, 0x05, 0x0a,
-    0x05, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x04, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01,
-    0x01, 0x00, 0x05, 0x05, 0x0a, 0x02, 0x02, 0x05, 0x00, 0x01, 0x01, 0x00,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x56, 0x53, 0x53, 0x56, 0x53,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x53, 0x53, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x55, 0x56, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x5e, 0x5e, 0x5f, 0x5e, 0x5f, 0x5e, 0x5e, 0x5e, 0x5f, 0x5f, 0x5f, 0x56,
-    0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x55, 0x56, 0x56, 0x55, 0x5f, 0x5f,
-    0x5e, 0x5e, 0x68, 0x6a, 0x3d, 0x2d, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x05, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x19, 0x34, 0x34, 0x59, 0xcc, 0xcc, 0xbf, 0xb4, 0xb4,
-    0xa9, 0xa7, 0x9d, 0x94, 0x94, 0x8a, 0x88, 0x88, 0x81, 0x7d, 0x7a, 0x76,
-    0x7a, 0x74, 0x74, 0x74, 0x6c, 0x6c, 0x71, 0x6c, 0x6c, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x63, 0x63, 0x5e, 0x68, 0x63, 0x63, 0x68,
-    0x5e, 0x5e, 0x5f, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e,
-    0x5e, 0x5f, 0x5e, 0x5e, 0x5f, 0x5f, 0x5e, 0x5b, 0x55, 0x56, 0x5f, 0x5b,
-    0x5b, 0x5b, 0x55, 0x5e, 0x5f, 0x52, 0x2b, 0x0f, 0x42, 0x1d, 0x09, 0x06,
-    0x0b, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0b, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0b, 0x0b, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x0b, 0x0b, 0x06, 0x0b, 0x0b, 0x06, 0x06, 0x09, 0x6f, 0x84,
-    0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x05, 0x05, 0x01,
-    0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x00, 0x00,
-    0x02, 0x05, 0x00, 0x01, 0x01, 0x00, 0x02, 0x02, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x56, 0x53, 0x53, 0x56, 0x56, 0x56, 0x56,
-    0x53, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x55, 0x56, 0x55, 0x57, 0x56, 0x56, 0x56, 0x55, 0x56, 0x56, 0x55, 0x5f,
-    0x56, 0x55, 0x55, 0x56, 0x56, 0x5f, 0x5f, 0x5f, 0x56, 0x56, 0x56, 0x55,
-    0x5e, 0x55, 0x5e, 0x55, 0x55, 0x56, 0x55, 0x56, 0x56, 0x55, 0x55, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x55, 0x56, 0x56, 0x56, 0x55, 0x5e, 0x68,
-    0x5b, 0x3c, 0x16, 0x03, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
-    0x00, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
-    0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x26, 0x37,
-    0x43, 0x96, 0xd8, 0xcc, 0xbf, 0xb4, 0xa9, 0xa3, 0x99, 0x97, 0x94, 0x89,
-    0x89, 0x89, 0x89, 0x7d, 0x7a, 0x76, 0x76, 0x74, 0x74, 0x71, 0x6c, 0x6c,
-    0x71, 0x6c, 0x6c, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x63, 0x63, 0x63, 0x5e, 0x5e, 0x63, 0x5f, 0x5e, 0x5e, 0x5b, 0x5e, 0x5f,
-    0x5f, 0x5f, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x5f, 0x5e, 0x5e,
-    0x63, 0x66, 0x66, 0x5e, 0x55, 0x56, 0x5f, 0x5b, 0x56, 0x55, 0x55, 0x55,
-    0x5f, 0x5e, 0x71, 0x43, 0x5b, 0x3a, 0x0b, 0x0b, 0x0f, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x0b, 0x06, 0x06, 0x06, 0x0b, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x0b, 0x06, 0x0b, 0x06, 0x0b, 0x06, 0x06, 0x0f,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x06, 0x06, 0x38, 0x69, 0x66, 0x16, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x0a, 0x0a, 0x05, 0x05, 0x01,
-    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x01, 0x4a, 0x4a, 0x4a, 0x53, 0x4e, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x56, 0x53, 0x53, 0x53, 0x53, 0x53, 0x56, 0x55,
-    0x56, 0x53, 0x53, 0x53, 0x53, 0x55, 0x55, 0x53, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x53, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x5b,
-    0x55, 0x56, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x55,
-    0x55, 0x56, 0x56, 0x56, 0x55, 0x55, 0x56, 0x56, 0x55, 0x5f, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x56, 0x56, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56,
-    0x55, 0x4d, 0x53, 0x53, 0x4d, 0x4d, 0x4d, 0x55, 0x5b, 0x37, 0x26, 0x05,
-    0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x19, 0x29, 0x3d, 0x71, 0xcc, 0xcc, 0xbf, 0xb4,
-    0xaa, 0xa7, 0x9d, 0x9d, 0x90, 0x94, 0x89, 0x89, 0x89, 0x82, 0x76, 0x7a,
-    0x7a, 0x74, 0x74, 0x74, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x68, 0x68, 0x68,
-    0x68, 0x63, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x63, 0x5e, 0x5f, 0x5e,
-    0x5e, 0x5f, 0x5f, 0x5e, 0x5e, 0x5e, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e,
-    0x5f, 0x5f, 0x5f, 0x5e, 0x5e, 0x5b, 0x5b, 0x5f, 0x5f, 0x5b, 0x5e, 0x5e,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x55, 0x55, 0x55, 0x55, 0x5b, 0x4d, 0x5f,
-    0x55, 0x5b, 0x3a, 0x38, 0x42, 0x21, 0x06, 0x06, 0x06, 0x06, 0x0b, 0x0b,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x0b, 0x0b, 0x0b, 0x06, 0x06, 0x0b, 0x0b, 0x0f, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x06, 0x06, 0x59, 0x5b, 0x2d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x05, 0x01, 0x00, 0x00, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x00, 0x02, 0x01, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x01, 0x02,
-    0x53, 0x52, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x4d, 0x4d, 0x55, 0x56, 0x53, 0x53, 0x53, 0x4d,
-    0x4d, 0x55, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x56, 0x53, 0x53, 0x53,
-    0x53, 0x56, 0x56, 0x56, 0x56, 0x53, 0x53, 0x55, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x55, 0x53, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56,
-    0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x55, 0x56, 0x56,
-    0x55, 0x56, 0x56, 0x56, 0x53, 0x53, 0x4d, 0x53, 0x53, 0x4a, 0x4d, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4e, 0x3c, 0x28, 0x0e, 0x00, 0x04, 0x01, 0x02,
-    0x00, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1e,
-    0x2d, 0x59, 0xa1, 0xcb, 0xbf, 0xb4, 0xb4, 0xaa, 0x9d, 0x9d, 0x94, 0x94,
-    0x88, 0x8a, 0x82, 0x89, 0x7d, 0x7a, 0x7a, 0x71, 0x74, 0x6c, 0x71, 0x6c,
-    0x6c, 0x66, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5f, 0x5f, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x56,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x55, 0x5e, 0x55, 0x5e, 0x55, 0x55, 0x5e, 0x56,
-    0x55, 0x55, 0x4d, 0x55, 0x55, 0x55, 0x56, 0x56, 0x57, 0x56, 0x5e, 0x5e,
-    0x55, 0x4e, 0x2b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x06, 0x0b, 0x0b, 0x06,
-    0x06, 0x06, 0x06, 0x0b, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x06, 0x06, 0x0b, 0x0b, 0x0f, 0x0f, 0x0b, 0x0b, 0x06, 0x0b, 0x21,
-    0x5f, 0x5b, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02,
-    0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x05, 0x53, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x53, 0x4a, 0x4a, 0x53, 0x53, 0x4d, 0x4a, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x4d, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x56, 0x56, 0x56, 0x53, 0x53, 0x56, 0x53, 0x56, 0x56, 0x56, 0x55, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56,
-    0x53, 0x4a, 0x4d, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x49, 0x41,
-    0x46, 0x4e, 0x26, 0x1e, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x26, 0x3c, 0x85, 0xb6, 0xcc, 0xbf,
-    0xb4, 0xaa, 0xa7, 0x9d, 0x94, 0x94, 0x89, 0x89, 0x89, 0x82, 0x7a, 0x7a,
-    0x76, 0x74, 0x74, 0x71, 0x6c, 0x6c, 0x66, 0x6c, 0x68, 0x66, 0x68, 0x66,
-    0x68, 0x68, 0x66, 0x68, 0x68, 0x68, 0x63, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x5e, 0x5e, 0x5b, 0x5b, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5f,
-    0x5e, 0x5e, 0x5e, 0x5f, 0x5e, 0x5f, 0x5e, 0x5f, 0x56, 0x5e, 0x5e, 0x5e,
-    0x5e, 0x5b, 0x5e, 0x55, 0x55, 0x56, 0x5f, 0x56, 0x5b, 0x56, 0x53, 0x55,
-    0x55, 0x55, 0x56, 0x56, 0x55, 0x56, 0x56, 0x55, 0x55, 0x56, 0x4d, 0x2f,
-    0x21, 0x0f, 0x21, 0x1d, 0x06, 0x0b, 0x06, 0x06, 0x06, 0x0b, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0b, 0x0b, 0x0b, 0x06, 0x0f,
-    0x0b, 0x0f, 0x0f, 0x0f, 0x0b, 0x06, 0x0b, 0x0b, 0x43, 0x6a, 0x34, 0x03,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x53, 0x4a, 0x4e, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x52, 0x53, 0x53, 0x4d, 0x53, 0x4d, 0x53, 0x4d, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x4d, 0x53, 0x53, 0x53, 0x53, 0x56, 0x56, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x55, 0x56, 0x56, 0x53, 0x56, 0x53, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x53, 0x55, 0x55, 0x53, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x49, 0x41, 0x41, 0x41, 0x2f, 0x2f, 0x3c, 0x28, 0x1f,
-    0x05, 0x00, 0x00, 0x01, 0x03, 0x05, 0x05, 0x01, 0x01, 0x05, 0x02, 0x01,
-    0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05,
-    0x1e, 0x29, 0x62, 0xb4, 0xcc, 0xbf, 0xb4, 0xaa, 0xa9, 0x9d, 0x9d, 0x94,
-    0x89, 0x89, 0x82, 0x82, 0x7a, 0x7a, 0x76, 0x74, 0x74, 0x71, 0x71, 0x6c,
-    0x6c, 0x6c, 0x6a, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x5e,
-    0x63, 0x63, 0x5f, 0x5e, 0x5e, 0x5e, 0x5e, 0x5f, 0x5e, 0x5f, 0x5e, 0x5e,
-    0x5e, 0x5f, 0x5e, 0x5b, 0x5e, 0x5e, 0x5e, 0x5f, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x56, 0x5f, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x55, 0x55, 0x55, 0x5e, 0x55,
-    0x55, 0x56, 0x5f, 0x55, 0x56, 0x56, 0x56, 0x56, 0x55, 0x56, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x56, 0x52, 0x4e, 0x43, 0x4e, 0x3c,
-    0x12, 0x06, 0x04, 0x0b, 0x0b, 0x0b, 0x0b, 0x06, 0x0b, 0x0b, 0x0b, 0x06,
-    0x06, 0x06, 0x0b, 0x0b, 0x0b, 0x0b, 0x06, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x21, 0x69, 0x5b, 0x19, 0x05, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x53, 0x4d, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x4d, 0x53, 0x53, 0x4d, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x4d, 0x4d, 0x53, 0x53, 0x53, 0x4d, 0x4d, 0x53,
-    0x53, 0x56, 0x56, 0x56, 0x55, 0x56, 0x56, 0x53, 0x55, 0x53, 0x56, 0x53,
-    0x56, 0x55, 0x55, 0x56, 0x56, 0x55, 0x56, 0x56, 0x55, 0x55, 0x56, 0x56,
-    0x53, 0x56, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x47, 0x49, 0x41, 0x41,
-    0x47, 0x47, 0x41, 0x3a, 0x18, 0x12, 0x3a, 0x1a, 0x0a, 0x00, 0x00, 0x01,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01,
-    0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0a, 0x1e, 0x34, 0x85, 0xcc, 0xbf,
-    0xb4, 0xb4, 0xaa, 0x9d, 0x99, 0x94, 0x94, 0x89, 0x89, 0x82, 0x7d, 0x7a,
-    0x7a, 0x74, 0x74, 0x74, 0x6c, 0x6c, 0x6c, 0x6c, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x63, 0x5e, 0x68, 0x5e, 0x68, 0x5e, 0x5e, 0x5f, 0x5e, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x5b, 0x5e, 0x5e, 0x5e, 0x5f, 0x5b, 0x5e, 0x5e,
-    0x5f, 0x55, 0x5b, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x56, 0x5e, 0x55, 0x55,
-    0x55, 0x5b, 0x5b, 0x55, 0x5b, 0x55, 0x55, 0x56, 0x55, 0x55, 0x56, 0x56,
-    0x55, 0x55, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55,
-    0x55, 0x56, 0x55, 0x55, 0x5b, 0x56, 0x55, 0x56, 0x43, 0x2f, 0x18, 0x2b,
-    0x18, 0x0f, 0x22, 0x21, 0x0b, 0x06, 0x06, 0x06, 0x06, 0x0b, 0x06, 0x0b,
-    0x0b, 0x06, 0x0b, 0x0b, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0b, 0x0b, 0x0f,
-    0x0f, 0x4c, 0x6f, 0x28, 0x09, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x53, 0x53, 0x4d, 0x53, 0x53, 0x4d, 0x4d, 0x4d, 0x53, 0x53,
-    0x53, 0x56, 0x56, 0x53, 0x4d, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x4d, 0x53, 0x4d, 0x53, 0x53, 0x53, 0x53, 0x56, 0x56, 0x56,
-    0x56, 0x55, 0x56, 0x53, 0x53, 0x53, 0x53, 0x53, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x55, 0x56, 0x55, 0x55, 0x56, 0x56, 0x55, 0x55, 0x53, 0x53, 0x53,
-    0x53, 0x4a, 0x4a, 0x4a, 0x49, 0x41, 0x41, 0x47, 0x47, 0x3f, 0x3d, 0x21,
-    0x06, 0x04, 0x3a, 0x16, 0x0a, 0x00, 0x00, 0x01, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x01, 0x05, 0x02, 0x02, 0x01, 0x01,
-    0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0x01, 0x02, 0x00, 0x01, 0x01, 0x01,
-    0x03, 0x16, 0x28, 0x59, 0xb6, 0xcc, 0xbf, 0xb4, 0xaa, 0xa7, 0x9d, 0x94,
-    0x94, 0x89, 0x89, 0x82, 0x89, 0x7d, 0x7a, 0x7d, 0x7a, 0x71, 0x6e, 0x6c,
-    0x6c, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x66, 0x5e, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x5b, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x5b, 0x5e, 0x5e, 0x5b, 0x5e, 0x5e, 0x5e, 0x5e, 0x5b, 0x5e, 0x5e, 0x5e,
-    0x55, 0x5e, 0x5e, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55,
-    0x5b, 0x55, 0x55, 0x5b, 0x56, 0x56, 0x56, 0x55, 0x55, 0x5b, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x5b, 0x55, 0x56, 0x56, 0x55, 0x53, 0x4d, 0x4e,
-    0x4e, 0x53, 0x55, 0x55, 0x56, 0x56, 0x5f, 0x5f, 0x4e, 0x4f, 0x57, 0x4e,
-    0x0b, 0x0b, 0x0b, 0x06, 0x06, 0x06, 0x06, 0x0b, 0x18, 0x18, 0x0b, 0x0b,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0b, 0x0b, 0x0f, 0x0f, 0x38, 0x60, 0x46,
-    0x16, 0x05, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d, 0x4a, 0x53, 0x53,
-    0x53, 0x4a, 0x4a, 0x53, 0x52, 0x53, 0x53, 0x53, 0x4a, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x56, 0x53, 0x55,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x55, 0x56, 0x53, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x56, 0x56, 0x53, 0x55, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x49,
-    0x41, 0x41, 0x41, 0x47, 0x47, 0x3f, 0x34, 0x18, 0x0b, 0x06, 0x28, 0x1d,
-    0x0a, 0x05, 0x00, 0x01, 0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x05, 0x01, 0x02, 0x02,
-    0x01, 0x01, 0x02, 0x01, 0x00, 0x01, 0x05, 0x0a, 0x19, 0x3a, 0x85, 0xcc,
-    0xcb, 0xb4, 0xaa, 0xaa, 0x9d, 0x9d, 0x94, 0x89, 0x89, 0x89, 0x89, 0x7d,
-    0x7a, 0x7a, 0x71, 0x76, 0x74, 0x6c, 0x6c, 0x6c, 0x68, 0x66, 0x66, 0x68,
-    0x68, 0x68, 0x68, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5b, 0x5f, 0x5e, 0x5e,
-    0x5e, 0x5f, 0x5e, 0x5f, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x55, 0x5b, 0x5b, 0x5e, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x5e, 0x5b, 0x5b, 0x55, 0x55, 0x55, 0x55, 0x5b, 0x55, 0x55, 0x56, 0x55,
-    0x55, 0x56, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x56, 0x4d, 0x4d, 0x5b,
-    0x5b, 0x56, 0x55, 0x55, 0x55, 0x5b, 0x55, 0x56, 0x56, 0x56, 0x55, 0x56,
-    0x56, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x5f, 0x2f, 0x06, 0x06, 0x18,
-    0x18, 0x0b, 0x0b, 0x0f, 0x2b, 0x3a, 0x18, 0x0f, 0x0f, 0x0f, 0x22, 0x0f,
-    0x0f, 0x0b, 0x0f, 0x0f, 0x0f, 0x2b, 0x4f, 0x57, 0x26, 0x16, 0x01, 0x00,
-    0x00, 0x01, 0x01, 0x00, 0x01, 0x02, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4d, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x55, 0x56, 0x56, 0x5f, 0x56, 0x53,
-    0x4d, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x49, 0x41, 0x41, 0x47, 0x47,
-    0x3d, 0x3f, 0x34, 0x18, 0x06, 0x06, 0x1e, 0x1f, 0x0a, 0x02, 0x00, 0x01,
-    0x05, 0x0e, 0x07, 0x07, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x05, 0x05, 0x05, 0x05, 0x01,
-    0x02, 0x03, 0x07, 0x26, 0x5c, 0xab, 0xcc, 0xbf, 0xb4, 0xa7, 0xa7, 0x99,
-    0x97, 0x94, 0x89, 0x82, 0x82, 0x7a, 0x7a, 0x76, 0x74, 0x71, 0x71, 0x71,
-    0x6c, 0x74, 0x71, 0x68, 0x68, 0x68, 0x68, 0x68, 0x5e, 0x5e, 0x5e, 0x5f,
-    0x5e, 0x5b, 0x5e, 0x5e, 0x5e, 0x5f, 0x5f, 0x56, 0x5f, 0x5e, 0x5e, 0x5e,
-    0x5f, 0x55, 0x55, 0x55, 0x5e, 0x55, 0x5e, 0x5e, 0x55, 0x55, 0x56, 0x55,
-    0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x56, 0x56,
-    0x55, 0x56, 0x55, 0x55, 0x55, 0x56, 0x56, 0x55, 0x55, 0x56, 0x55, 0x56,
-    0x55, 0x55, 0x55, 0x55, 0x4d, 0x53, 0x56, 0x55, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x55, 0x56, 0x56, 0x55, 0x56, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x52, 0x21, 0x18, 0x3a, 0x43, 0x3a, 0x2b, 0x21,
-    0x4e, 0x56, 0x43, 0x18, 0x0f, 0x0f, 0x38, 0x18, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x3a, 0x52, 0x52, 0x2d, 0x1e, 0x05, 0x01, 0x02, 0x03, 0x05, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02,
-    0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4d, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53,
-    0x53, 0x4a, 0x4a, 0x53, 0x53, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x55,
-    0x53, 0x55, 0x53, 0x53, 0x56, 0x56, 0x53, 0x4d, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x4a, 0x4a, 0x4a, 0x49, 0x41, 0x41, 0x3f, 0x3e, 0x3f, 0x2f, 0x0f,
-    0x06, 0x06, 0x1e, 0x10, 0x0a, 0x01, 0x01, 0x00, 0x05, 0x0e, 0x0c, 0x0e,
-    0x0e, 0x0e, 0x0c, 0x07, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x03, 0x0e, 0x2f, 0x96,
-    0xcc, 0xbf, 0xb4, 0xa7, 0xa7, 0x9d, 0x9d, 0x94, 0x8a, 0x8a, 0x81, 0x82,
-    0x7a, 0x7a, 0x76, 0x74, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x68, 0x68,
-    0x68, 0x63, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5f, 0x5f, 0x5e, 0x5e, 0x5f,
-    0x5f, 0x55, 0x56, 0x56, 0x56, 0x5e, 0x5e, 0x55, 0x56, 0x55, 0x55, 0x55,
-    0x5e, 0x56, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x56, 0x55, 0x55, 0x55, 0x56, 0x55, 0x56, 0x55, 0x56, 0x56, 0x55,
-    0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x56, 0x56, 0x4d,
-    0x4e, 0x55, 0x56, 0x55, 0x56, 0x55, 0x56, 0x56, 0x56, 0x56, 0x55, 0x56,
-    0x56, 0x55, 0x55, 0x55, 0x56, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x55, 0x4e, 0x4e, 0x4d, 0x56, 0x56, 0x4a, 0x46, 0x56, 0x53, 0x56, 0x43,
-    0x2f, 0x22, 0x43, 0x2b, 0x0f, 0x0f, 0x2b, 0x21, 0x18, 0x43, 0x46, 0x52,
-    0x3d, 0x1f, 0x07, 0x01, 0x00, 0x01, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x01, 0x05, 0x02, 0x01, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x56, 0x53, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x4a, 0x53, 0x4a, 0x53, 0x4a, 0x53, 0x53,
-    0x4a, 0x53, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x53, 0x4d, 0x53,
-    0x56, 0x55, 0x55, 0x4d, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x4a, 0x47,
-    0x49, 0x47, 0x41, 0x3f, 0x3d, 0x37, 0x21, 0x0b, 0x06, 0x06, 0x07, 0x13,
-    0x05, 0x01, 0x00, 0x00, 0x05, 0x19, 0x19, 0x1a, 0x19, 0x0c, 0x19, 0x0e,
-    0x0e, 0x0e, 0x0e, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x05, 0x05,
-    0x05, 0x00, 0x01, 0x03, 0x16, 0x4c, 0xb6, 0xcb, 0xbf, 0xb4, 0xa9, 0xa3,
-    0x9d, 0x94, 0x89, 0x89, 0x81, 0x82, 0x7d, 0x76, 0x7a, 0x71, 0x6c, 0x6c,
-    0x71, 0x6c, 0x6c, 0x68, 0x68, 0x68, 0x68, 0x5e, 0x5e, 0x5e, 0x5e, 0x5b,
-    0x5e, 0x5e, 0x5f, 0x5f, 0x56, 0x5e, 0x5f, 0x5e, 0x56, 0x55, 0x55, 0x55,
-    0x55, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x56, 0x56, 0x55,
-    0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5b, 0x56,
-    0x53, 0x56, 0x55, 0x55, 0x55, 0x56, 0x56, 0x4d, 0x4d, 0x56, 0x56, 0x56,
-    0x56, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x55, 0x55, 0x56, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x53, 0x53, 0x53, 0x4a, 0x44, 0x4a, 0x3a,
-    0x15, 0x0f, 0x3e, 0x3c, 0x21, 0x3a, 0x46, 0x52, 0x46, 0x26, 0x19, 0x02,
-    0x00, 0x01, 0x05, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x01, 0x05, 0x02, 0x02, 0x01, 0x05, 0x03, 0x02, 0x02, 0x01, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x49, 0x45, 0x49, 0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53,
-    0x53, 0x53, 0x4a, 0x53, 0x4d, 0x53, 0x4d, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x4d, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x53, 0x53, 0x53, 0x56, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x41, 0x3f, 0x3f,
-    0x3f, 0x37, 0x21, 0x0b, 0x04, 0x06, 0x0c, 0x13, 0x03, 0x00, 0x00, 0x00,
-    0x03, 0x19, 0x19, 0x1a, 0x1a, 0x19, 0x19, 0x19, 0x16, 0x0c, 0x16, 0x0e,
-    0x0e, 0x0e, 0x0e, 0x07, 0x0e, 0x0e, 0x0a, 0x03, 0x01, 0x05, 0x0a, 0x26,
-    0x7c, 0xcc, 0xbf, 0xb4, 0xaa, 0x9f, 0x99, 0x94, 0x90, 0x8a, 0x89, 0x82,
-    0x7a, 0x76, 0x76, 0x74, 0x74, 0x6c, 0x6c, 0x6c, 0x6c, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x5e, 0x5e, 0x5e, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x56,
-    0x55, 0x5f, 0x5e, 0x55, 0x5e, 0x55, 0x55, 0x5e, 0x56, 0x56, 0x56, 0x55,
-    0x55, 0x56, 0x56, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x56, 0x55, 0x5b, 0x55, 0x56, 0x56, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56,
-    0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x5b, 0x53, 0x4d, 0x55, 0x55, 0x56,
-    0x56, 0x56, 0x55, 0x4d, 0x53, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56,
-    0x55, 0x56, 0x56, 0x55, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56,
-    0x53, 0x55, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x46, 0x22, 0x15, 0x3d, 0x46,
-    0x3a, 0x3a, 0x3e, 0x46, 0x52, 0x2a, 0x19, 0x01, 0x00, 0x00, 0x03, 0x05,
-    0x05, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x49, 0x45, 0x49,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4e, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x4a, 0x4a, 0x53, 0x53, 0x4d, 0x53, 0x53,
-    0x53, 0x53, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x4d, 0x4d, 0x4d, 0x55, 0x56, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x4a, 0x4a, 0x49, 0x41, 0x41, 0x3f, 0x3e, 0x3e, 0x34, 0x21, 0x0b,
-    0x06, 0x06, 0x03, 0x0c, 0x04, 0x00, 0x00, 0x01, 0x03, 0x19, 0x1a, 0x1a,
-    0x19, 0x19, 0x1b, 0x1a, 0x19, 0x1a, 0x19, 0x19, 0x19, 0x19, 0x1a, 0x1a,
-    0x19, 0x07, 0x01, 0x01, 0x05, 0x16, 0x3a, 0xa1, 0xcb, 0xbf, 0xb4, 0xa9,
-    0x9f, 0x97, 0x90, 0x8a, 0x8a, 0x81, 0x7d, 0x76, 0x7a, 0x74, 0x71, 0x6c,
-    0x71, 0x71, 0x6c, 0x68, 0x68, 0x68, 0x68, 0x68, 0x63, 0x5e, 0x5e, 0x5e,
-    0x5f, 0x5f, 0x5e, 0x5e, 0x5f, 0x5f, 0x5e, 0x5e, 0x55, 0x5e, 0x55, 0x56,
-    0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x5b, 0x55, 0x56, 0x56, 0x55, 0x55,
-    0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5b, 0x55, 0x55,
-    0x56, 0x55, 0x55, 0x55, 0x56, 0x56, 0x5b, 0x55, 0x55, 0x56, 0x56, 0x56,
-    0x55, 0x55, 0x55, 0x57, 0x4e, 0x55, 0x4e, 0x4d, 0x56, 0x56, 0x55, 0x4d,
-    0x4d, 0x55, 0x55, 0x56, 0x55, 0x56, 0x56, 0x55, 0x55, 0x56, 0x56, 0x56,
-    0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x55, 0x56,
-    0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x53, 0x53, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x49, 0x41, 0x21, 0x44, 0x44, 0x46, 0x44, 0x3e, 0x3e,
-    0x46, 0x31, 0x1e, 0x05, 0x00, 0x00, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02,
-    0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4d, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d, 0x4a, 0x53, 0x4a, 0x4d,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x4a, 0x4a, 0x4d, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x53, 0x4d,
-    0x4d, 0x55, 0x53, 0x53, 0x4d, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x49,
-    0x41, 0x41, 0x3f, 0x3e, 0x34, 0x28, 0x18, 0x06, 0x06, 0x06, 0x04, 0x04,
-    0x05, 0x00, 0x00, 0x01, 0x05, 0x1b, 0x1b, 0x1b, 0x1b, 0x1a, 0x1a, 0x19,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1a, 0x1a, 0x1a, 0x0e, 0x02, 0x02, 0x05,
-    0x1e, 0x65, 0xb8, 0xbf, 0xb4, 0xaa, 0xa7, 0x99, 0x94, 0x94, 0x8a, 0x82,
-    0x81, 0x7d, 0x76, 0x74, 0x74, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x5e, 0x56, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56,
-    0x56, 0x56, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56,
-    0x56, 0x55, 0x5e, 0x55, 0x55, 0x56, 0x56, 0x55, 0x55, 0x55, 0x56, 0x57,
-    0x55, 0x55, 0x55, 0x53, 0x55, 0x56, 0x56, 0x53, 0x53, 0x55, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x55, 0x56, 0x56, 0x55, 0x56, 0x56,
-    0x55, 0x55, 0x55, 0x56, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x47, 0x49,
-    0x3e, 0x2f, 0x41, 0x41, 0x41, 0x46, 0x3c, 0x3c, 0x3e, 0x20, 0x1f, 0x07,
-    0x00, 0x00, 0x01, 0x0a, 0x0a, 0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x05, 0x03, 0x05, 0x05, 0x05,
-    0x05, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4a, 0x4a, 0x49, 0x49,
-    0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4d, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x53, 0x53, 0x4d, 0x53, 0x53, 0x4d, 0x53, 0x53, 0x53, 0x55, 0x4d, 0x4d,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x49, 0x47, 0x3f, 0x3f, 0x3e,
-    0x2d, 0x28, 0x0b, 0x06, 0x06, 0x06, 0x12, 0x04, 0x03, 0x00, 0x00, 0x01,
-    0x05, 0x1a, 0x1f, 0x1f, 0x1f, 0x1b, 0x1f, 0x1b, 0x1b, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x1a, 0x0a, 0x01, 0x01, 0x0a, 0x2f, 0x85, 0xbf, 0xbf, 0xb8,
-    0xaa, 0xa3, 0x9d, 0x94, 0x89, 0x89, 0x81, 0x7d, 0x7a, 0x76, 0x74, 0x6c,
-    0x6c, 0x6c, 0x6c, 0x68, 0x68, 0x6c, 0x68, 0x68, 0x68, 0x68, 0x5e, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x55, 0x55, 0x55, 0x56,
-    0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x55, 0x56,
-    0x56, 0x55, 0x55, 0x56, 0x55, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55,
-    0x56, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x55,
-    0x55, 0x56, 0x56, 0x56, 0x55, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x53, 0x53,
-    0x55, 0x55, 0x55, 0x53, 0x53, 0x53, 0x55, 0x55, 0x56, 0x56, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x55, 0x55, 0x55, 0x56, 0x55, 0x5b,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x56, 0x53, 0x55,
-    0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x41, 0x47, 0x41, 0x41,
-    0x44, 0x3d, 0x34, 0x34, 0x3e, 0x13, 0x25, 0x0e, 0x01, 0x00, 0x01, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x05, 0x05, 0x05, 0x05, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01,
-    0x03, 0x01, 0x05, 0x05, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01,
-    0x00, 0x00, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x00, 0x02,
-    0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4a, 0x49, 0x49, 0x4a,
-    0x49, 0x49, 0x49, 0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x47, 0x47, 0x47, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4d, 0x4d, 0x4a, 0x4a, 0x4a, 0x4d, 0x4d, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x53, 0x53, 0x53, 0x53,
-    0x4d, 0x4a, 0x49, 0x41, 0x41, 0x3f, 0x3e, 0x34, 0x2d, 0x21, 0x06, 0x04,
-    0x04, 0x06, 0x09, 0x04, 0x01, 0x00, 0x00, 0x01, 0x0a, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x26, 0x25, 0x26, 0x1b, 0x05, 0x02,
-    0x01, 0x0e, 0x4c, 0xaa, 0xbf, 0xb4, 0xaa, 0xa7, 0x9d, 0x97, 0x89, 0x89,
-    0x81, 0x7d, 0x7d, 0x7a, 0x76, 0x74, 0x6c, 0x6c, 0x6c, 0x68, 0x68, 0x68,
-    0x6c, 0x6c, 0x68, 0x68, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x5e, 0x55, 0x55, 0x56, 0x55, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x56, 0x55, 0x55, 0x56, 0x56, 0x55, 0x55, 0x56, 0x56, 0x56, 0x55, 0x56,
-    0x55, 0x56, 0x53, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x4d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x53, 0x53,
-    0x56, 0x53, 0x4d, 0x4d, 0x55, 0x55, 0x55, 0x53, 0x53, 0x55, 0x53, 0x56,
-    0x56, 0x53, 0x55, 0x56, 0x56, 0x56, 0x55, 0x53, 0x53, 0x4d, 0x55, 0x53,
-    0x56, 0x56, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55,
-    0x55, 0x56, 0x55, 0x55, 0x56, 0x53, 0x53, 0x56, 0x55, 0x53, 0x53, 0x53,
-    0x4a, 0x4a, 0x4a, 0x49, 0x41, 0x41, 0x41, 0x41, 0x46, 0x3e, 0x34, 0x34,
-    0x37, 0x13, 0x20, 0x0e, 0x01, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0e, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x05, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x03, 0x05, 0x01, 0x05, 0x05, 0x05, 0x01, 0x05, 0x02,
-    0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x01, 0x01,
-    0x01, 0x05, 0x02, 0x01, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x45,
-    0x4a, 0x49, 0x4a, 0x4a, 0x4a, 0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d, 0x4d, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x55, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x4a, 0x49, 0x41,
-    0x41, 0x3d, 0x34, 0x2f, 0x28, 0x18, 0x06, 0x04, 0x06, 0x04, 0x00, 0x03,
-    0x00, 0x00, 0x01, 0x01, 0x08, 0x1f, 0x1f, 0x25, 0x1f, 0x1f, 0x26, 0x1f,
-    0x1f, 0x25, 0x1f, 0x25, 0x1b, 0x05, 0x00, 0x01, 0x1a, 0x7c, 0xbf, 0xbf,
-    0xb8, 0xaa, 0x9f, 0x9d, 0x90, 0x8a, 0x82, 0x89, 0x7d, 0x7a, 0x74, 0x74,
-    0x74, 0x6c, 0x71, 0x71, 0x68, 0x68, 0x68, 0x68, 0x66, 0x68, 0x68, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x56, 0x5e, 0x55, 0x55, 0x56,
-    0x55, 0x56, 0x56, 0x56, 0x56, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x56,
-    0x56, 0x55, 0x56, 0x56, 0x53, 0x53, 0x4e, 0x56, 0x55, 0x55, 0x53, 0x53,
-    0x53, 0x55, 0x55, 0x53, 0x53, 0x53, 0x56, 0x53, 0x56, 0x56, 0x5b, 0x55,
-    0x5b, 0x55, 0x4e, 0x55, 0x55, 0x55, 0x56, 0x55, 0x53, 0x53, 0x53, 0x4d,
-    0x4d, 0x53, 0x55, 0x53, 0x4d, 0x53, 0x53, 0x53, 0x55, 0x53, 0x56, 0x56,
-    0x53, 0x55, 0x55, 0x53, 0x53, 0x53, 0x55, 0x53, 0x56, 0x56, 0x56, 0x56,
-    0x56, 0x56, 0x53, 0x53, 0x56, 0x56, 0x55, 0x55, 0x56, 0x55, 0x55, 0x56,
-    0x56, 0x56, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x49, 0x49,
-    0x41, 0x41, 0x41, 0x3f, 0x3e, 0x3e, 0x34, 0x34, 0x31, 0x13, 0x20, 0x0e,
-    0x01, 0x01, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0e, 0x0e, 0x0e, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0e, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x05, 0x05, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x01, 0x02, 0x05,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x45, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d, 0x4d, 0x53, 0x53, 0x4a, 0x53,
-    0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x56, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x49, 0x41, 0x3e, 0x3e, 0x2d, 0x2c,
-    0x28, 0x18, 0x06, 0x04, 0x06, 0x06, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01,
-    0x0e, 0x1f, 0x1f, 0x1f, 0x26, 0x25, 0x26, 0x1f, 0x1f, 0x1f, 0x26, 0x19,
-    0x02, 0x01, 0x05, 0x28, 0x96, 0xbf, 0xb4, 0xac, 0xa9, 0x99, 0x97, 0x89,
-    0x89, 0x81, 0x81, 0x76, 0x74, 0x71, 0x71, 0x6e, 0x6c, 0x6c, 0x68, 0x66,
-    0x68, 0x68, 0x68, 0x5e, 0x68, 0x5e, 0x5e, 0x5e, 0x5f, 0x5f, 0x5e, 0x5e,
-    0x5e, 0x5e, 0x56, 0x55, 0x55, 0x55, 0x57, 0x56, 0x56, 0x55, 0x56, 0x56,
-    0x56, 0x56, 0x53, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x53,
-    0x53, 0x4d, 0x4d, 0x4d, 0x4d, 0x55, 0x53, 0x53, 0x53, 0x4d, 0x4d, 0x55,
-    0x56, 0x53, 0x53, 0x53, 0x53, 0x55, 0x56, 0x55, 0x53, 0x53, 0x53, 0x4e,
-    0x53, 0x53, 0x55, 0x53, 0x4d, 0x53, 0x53, 0x4d, 0x4d, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x4e, 0x4d, 0x4d, 0x4d, 0x53, 0x55, 0x53, 0x53, 0x4d, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x56, 0x56, 0x55, 0x56, 0x56,
-    0x56, 0x55, 0x56, 0x56, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x53, 0x4d, 0x4d, 0x53, 0x4a, 0x4a, 0x4a, 0x49, 0x41, 0x41, 0x3f, 0x3f,
-    0x3e, 0x34, 0x2f, 0x2f, 0x20, 0x13, 0x13, 0x0c, 0x05, 0x00, 0x00, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
-    0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x0e, 0x07, 0x0a, 0x07, 0x0e, 0x0e, 0x0e,
-    0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x01, 0x05, 0x05, 0x0a, 0x16, 0x26, 0x49, 0x41, 0x41, 0x49,
-    0x49, 0x46, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x49, 0x45, 0x49, 0x49, 0x49, 0x49, 0x4a, 0x49, 0x49, 0x4a,
-    0x49, 0x4a, 0x49, 0x4a, 0x4a, 0x47, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d,
-    0x4d, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x4a, 0x53, 0x53, 0x53,
-    0x4d, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x56, 0x53, 0x53, 0x53, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x46, 0x3d, 0x34, 0x30, 0x28, 0x26, 0x0b, 0x06, 0x06,
-    0x04, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01, 0x05, 0x0e, 0x1e, 0x1f, 0x1f,
-    0x26, 0x1f, 0x26, 0x2c, 0x1f, 0x1f, 0x1a, 0x02, 0x00, 0x0a, 0x3a, 0xac,
-    0xbf, 0xb4, 0xaa, 0xa3, 0x97, 0x90, 0x89, 0x89, 0x89, 0x7a, 0x76, 0x76,
-    0x74, 0x6c, 0x6c, 0x6e, 0x6c, 0x68, 0x68, 0x68, 0x68, 0x68, 0x5e, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x56, 0x56, 0x56, 0x5e, 0x55, 0x5f, 0x56, 0x55,
-    0x55, 0x56, 0x56, 0x56, 0x56, 0x53, 0x53, 0x5b, 0x56, 0x56, 0x56, 0x56,
-    0x55, 0x55, 0x55, 0x53, 0x53, 0x4d, 0x4d, 0x53, 0x4d, 0x53, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x53, 0x53, 0x53, 0x53, 0x55,
-    0x4d, 0x53, 0x55, 0x4d, 0x53, 0x53, 0x53, 0x4e, 0x4e, 0x4d, 0x53, 0x53,
-    0x4d, 0x4d, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x53, 0x4e, 0x4d, 0x53,
-    0x4e, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x55, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x53, 0x53, 0x56, 0x55, 0x56, 0x53, 0x53, 0x53,
-    0x4d, 0x4a, 0x4a, 0x49, 0x41, 0x41, 0x41, 0x3f, 0x3d, 0x30, 0x2f, 0x2d,
-    0x13, 0x13, 0x13, 0x0c, 0x05, 0x00, 0x00, 0x05, 0x0a, 0x11, 0x16, 0x16,
-    0x0e, 0x16, 0x16, 0x0e, 0x16, 0x0e, 0x19, 0x0e, 0x19, 0x0e, 0x1a, 0x1a,
-    0x1a, 0x0e, 0x0e, 0x07, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x0e, 0x0e, 0x0a,
-    0x07, 0x0a, 0x07, 0x07, 0x0a, 0x07, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07,
-    0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x05, 0x03, 0x03, 0x03, 0x08, 0x0e, 0x1a,
-    0x26, 0x34, 0x43, 0x57, 0x49, 0x41, 0x49, 0x49, 0x49, 0x47, 0x49, 0x41,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d,
-    0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x46,
-    0x37, 0x2d, 0x30, 0x2c, 0x1a, 0x0b, 0x04, 0x04, 0x04, 0x00, 0x00, 0x03,
-    0x01, 0x01, 0x02, 0x05, 0x16, 0x1e, 0x1f, 0x26, 0x26, 0x28, 0x2c, 0x30,
-    0x1f, 0x0c, 0x02, 0x01, 0x16, 0x5c, 0xb4, 0xbf, 0xb4, 0xaa, 0x9d, 0x94,
-    0x94, 0x89, 0x89, 0x89, 0x76, 0x76, 0x75, 0x6c, 0x6c, 0x6c, 0x71, 0x68,
-    0x68, 0x68, 0x68, 0x5e, 0x5e, 0x5e, 0x5e, 0x5f, 0x5f, 0x5e, 0x55, 0x55,
-    0x55, 0x55, 0x56, 0x55, 0x56, 0x56, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x53, 0x53, 0x56, 0x56, 0x56, 0x53, 0x53, 0x55, 0x56, 0x4d, 0x53,
-    0x53, 0x53, 0x53, 0x4d, 0x53, 0x4d, 0x53, 0x4d, 0x53, 0x53, 0x4d, 0x53,
-    0x4d, 0x4d, 0x53, 0x53, 0x4d, 0x4d, 0x4d, 0x53, 0x53, 0x4d, 0x4d, 0x4d,
-    0x53, 0x53, 0x53, 0x53, 0x4d, 0x4d, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x4d, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x4d, 0x53, 0x53, 0x4d, 0x53, 0x53, 0x53, 0x4d, 0x55,
-    0x56, 0x53, 0x56, 0x53, 0x56, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x53, 0x56, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x49,
-    0x41, 0x41, 0x3f, 0x3f, 0x37, 0x30, 0x30, 0x29, 0x13, 0x13, 0x13, 0x0c,
-    0x01, 0x01, 0x00, 0x05, 0x16, 0x0e, 0x0e, 0x16, 0x0e, 0x16, 0x16, 0x16,
-    0x0e, 0x1a, 0x19, 0x16, 0x1a, 0x16, 0x1d, 0x1a, 0x1a, 0x16, 0x19, 0x1a,
-    0x16, 0x0e, 0x16, 0x19, 0x16, 0x1a, 0x1a, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
-    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x0a, 0x05, 0x05, 0x05,
-    0x05, 0x0a, 0x0e, 0x19, 0x1f, 0x2d, 0x3c, 0x52, 0x69, 0x8a, 0xa1, 0xb8,
-    0x41, 0x41, 0x41, 0x49, 0x41, 0x47, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49,
-    0x41, 0x49, 0x49, 0x49, 0x49, 0x41, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d, 0x4a, 0x4a,
-    0x53, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x4a, 0x4a, 0x47, 0x46, 0x3d, 0x2f, 0x2d, 0x2c, 0x1f,
-    0x07, 0x06, 0x04, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x05,
-    0x1e, 0x1a, 0x26, 0x26, 0x26, 0x28, 0x25, 0x25, 0x07, 0x01, 0x02, 0x1e,
-    0x85, 0xbf, 0xbf, 0xb4, 0xaa, 0x9d, 0x94, 0x89, 0x89, 0x82, 0x7a, 0x76,
-    0x74, 0x74, 0x6c, 0x6c, 0x68, 0x68, 0x6a, 0x68, 0x68, 0x5e, 0x5f, 0x5e,
-    0x5e, 0x5e, 0x56, 0x56, 0x55, 0x56, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55,
-    0x56, 0x55, 0x55, 0x56, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x4d, 0x55,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x4d, 0x53, 0x53, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x53, 0x53, 0x53, 0x4d, 0x4d, 0x53, 0x4d, 0x4d, 0x4a,
-    0x53, 0x53, 0x53, 0x53, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x53, 0x53, 0x4d,
-    0x4d, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x53, 0x53, 0x4d, 0x53, 0x53,
-    0x53, 0x53, 0x4d, 0x4d, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x4d, 0x53, 0x56, 0x56, 0x56, 0x53, 0x55, 0x55, 0x55,
-    0x55, 0x56, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x53, 0x56, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x4a, 0x4d, 0x49, 0x49, 0x41, 0x47, 0x3f, 0x3d,
-    0x30, 0x30, 0x2f, 0x25, 0x13, 0x13, 0x13, 0x0c, 0x05, 0x00, 0x00, 0x05,
-    0x11, 0x0e, 0x11, 0x16, 0x16, 0x16, 0x16, 0x1a, 0x1e, 0x19, 0x19, 0x16,
-    0x19, 0x1a, 0x1a, 0x1a, 0x16, 0x16, 0x1a, 0x1a, 0x1a, 0x1a, 0x19, 0x1a,
-    0x1a, 0x1a, 0x1a, 0x19, 0x0e, 0x16, 0x16, 0x1a, 0x1a, 0x16, 0x1a, 0x1a,
-    0x07, 0x0a, 0x05, 0x05, 0x03, 0x0a, 0x07, 0x19, 0x1f, 0x28, 0x34, 0x52,
-    0x71, 0x8a, 0x99, 0xa9, 0xb3, 0xb1, 0xa9, 0xa9, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x47, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x49, 0x49, 0x41, 0x41, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x45, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4a, 0x4a, 0x49,
-    0x49, 0x49, 0x4a, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x4d, 0x4a, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a,
-    0x49, 0x41, 0x3e, 0x34, 0x2d, 0x2d, 0x25, 0x0d, 0x08, 0x04, 0x04, 0x04,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x0a, 0x1e, 0x19, 0x1e, 0x26,
-    0x26, 0x29, 0x1f, 0x0a, 0x02, 0x05, 0x3a, 0x9f, 0xbf, 0xbf, 0xa9, 0xa7,
-    0x94, 0x94, 0x89, 0x89, 0x89, 0x7a, 0x76, 0x6c, 0x6c, 0x71, 0x66, 0x68,
-    0x68, 0x68, 0x63, 0x63, 0x5f, 0x5e, 0x5f, 0x5e, 0x56, 0x55, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x55, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53,
-    0x4d, 0x53, 0x4d, 0x55, 0x4d, 0x4d, 0x4d, 0x56, 0x53, 0x53, 0x4d, 0x4d,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x53, 0x4d, 0x4d, 0x53, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x53, 0x4a, 0x4a, 0x4a, 0x4d, 0x4d, 0x53, 0x4d, 0x53, 0x53,
-    0x53, 0x4d, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x53, 0x4d, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x53, 0x4d, 0x4d, 0x4d,
-    0x53, 0x4d, 0x4d, 0x53, 0x4d, 0x4d, 0x53, 0x4d, 0x4d, 0x4d, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x56, 0x53, 0x53, 0x53, 0x55, 0x56, 0x55, 0x56, 0x56,
-    0x56, 0x53, 0x55, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d,
-    0x4d, 0x4a, 0x49, 0x49, 0x41, 0x47, 0x3d, 0x3c, 0x2d, 0x2f, 0x2d, 0x10,
-    0x13, 0x13, 0x13, 0x0c, 0x01, 0x00, 0x00, 0x05, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x1e, 0x1e, 0x1a, 0x1e, 0x19, 0x1e, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a,
-    0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x19, 0x1a, 0x1a, 0x16,
-    0x16, 0x1a, 0x1a, 0x1a, 0x1a, 0x0e, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x07,
-    0x1a, 0x1f, 0x2d, 0x4e, 0x71, 0x85, 0x97, 0xa3, 0xa9, 0xb1, 0xa9, 0xa9,
-    0xa3, 0xa3, 0x99, 0x97, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x49,
-    0x49, 0x41, 0x49, 0x49, 0x49, 0x49, 0x49, 0x45, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4a, 0x47,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x4a, 0x49, 0x49, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x4d, 0x4d, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x56, 0x56, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x49, 0x46, 0x37, 0x34,
-    0x30, 0x29, 0x1b, 0x0d, 0x08, 0x06, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x01, 0x0e, 0x16, 0x1a, 0x1f, 0x26, 0x26, 0x1f, 0x05, 0x02,
-    0x0a, 0x4c, 0xab, 0xbf, 0xb4, 0xa9, 0x9d, 0x94, 0x89, 0x8a, 0x89, 0x7d,
-    0x76, 0x75, 0x6c, 0x6c, 0x68, 0x68, 0x68, 0x68, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x5b, 0x5e, 0x56, 0x55, 0x55, 0x55, 0x56, 0x56, 0x55, 0x56, 0x56, 0x55,
-    0x5b, 0x56, 0x53, 0x56, 0x55, 0x4d, 0x53, 0x4d, 0x4d, 0x4d, 0x55, 0x53,
-    0x53, 0x53, 0x53, 0x4d, 0x4d, 0x53, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x4a, 0x4d, 0x4d, 0x4a,
-    0x4d, 0x4a, 0x4d, 0x4a, 0x53, 0x53, 0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d,
-    0x4a, 0x4a, 0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x53,
-    0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4a, 0x53, 0x4d, 0x53, 0x53, 0x53, 0x53,
-    0x4a, 0x53, 0x4d, 0x4d, 0x4d, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x55,
-    0x55, 0x4d, 0x53, 0x53, 0x56, 0x56, 0x56, 0x56, 0x56, 0x53, 0x53, 0x4d,
-    0x53, 0x53, 0x4d, 0x53, 0x53, 0x55, 0x53, 0x53, 0x4a, 0x4a, 0x49, 0x49,
-    0x47, 0x41, 0x3e, 0x34, 0x30, 0x2d, 0x25, 0x10, 0x13, 0x13, 0x13, 0x0c,
-    0x05, 0x00, 0x01, 0x05, 0x16, 0x16, 0x16, 0x16, 0x1a, 0x1e, 0x1a, 0x19,
-    0x16, 0x1e, 0x1e, 0x1a, 0x1a, 0x1a, 0x1e, 0x1a, 0x1a, 0x1e, 0x1e, 0x1e,
-    0x1a, 0x1a, 0x1e, 0x1e, 0x1e, 0x1a, 0x1e, 0x19, 0x19, 0x1a, 0x19, 0x07,
-    0x05, 0x05, 0x05, 0x05, 0x0a, 0x16, 0x1e, 0x2f, 0x4f, 0x7c, 0xa1, 0xb8,
-    0xb4, 0xb1, 0xa9, 0xa3, 0x97, 0x90, 0x97, 0x94, 0x94, 0x90, 0x91, 0x88,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x49, 0x41, 0x49, 0x49, 0x49,
-    0x41, 0x41, 0x49, 0x41, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x47, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x49, 0x4a, 0x4a, 0x4a, 0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4d, 0x4d, 0x53, 0x53, 0x53, 0x4d, 0x4d, 0x53, 0x53, 0x53, 0x56, 0x53,
-    0x53, 0x53, 0x4a, 0x4a, 0x47, 0x3e, 0x34, 0x2d, 0x2d, 0x25, 0x0d, 0x0c,
-    0x09, 0x04, 0x04, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x05, 0x0e,
-    0x1a, 0x1e, 0x1f, 0x26, 0x1e, 0x05, 0x05, 0x1e, 0x4c, 0xb4, 0xbf, 0xb4,
-    0xa7, 0x9d, 0x94, 0x8a, 0x81, 0x82, 0x76, 0x76, 0x74, 0x6c, 0x6c, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x5e, 0x5f, 0x5e, 0x5e, 0x5e, 0x56, 0x56, 0x55,
-    0x55, 0x55, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x53, 0x55,
-    0x55, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x53, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x4d, 0x4d, 0x53, 0x4d, 0x4d, 0x53,
-    0x4a, 0x4d, 0x4a, 0x4a, 0x4a, 0x4d, 0x4a, 0x4d, 0x4d, 0x4d, 0x4a, 0x4d,
-    0x53, 0x53, 0x4d, 0x53, 0x4d, 0x4a, 0x4a, 0x53, 0x4d, 0x4a, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x53, 0x53, 0x4d, 0x53, 0x53, 0x4d,
-    0x4d, 0x53, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x53, 0x4d,
-    0x4d, 0x53, 0x4d, 0x4d, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x53, 0x53,
-    0x53, 0x55, 0x56, 0x56, 0x55, 0x53, 0x56, 0x4d, 0x53, 0x4d, 0x53, 0x53,
-    0x53, 0x4d, 0x53, 0x53, 0x53, 0x4a, 0x49, 0x41, 0x41, 0x3f, 0x3e, 0x30,
-    0x30, 0x2d, 0x17, 0x10, 0x13, 0x13, 0x13, 0x0c, 0x02, 0x00, 0x00, 0x0a,
-    0x16, 0x19, 0x1e, 0x1a, 0x1e, 0x1f, 0x1a, 0x19, 0x1a, 0x1a, 0x1a, 0x1e,
-    0x1e, 0x1a, 0x1e, 0x1e, 0x1a, 0x1a, 0x1a, 0x1a, 0x1e, 0x1a, 0x1a, 0x1a,
-    0x1e, 0x1e, 0x1e, 0x19, 0x0e, 0x05, 0x05, 0x05, 0x0a, 0x0e, 0x16, 0x26,
-    0x3a, 0x5c, 0x85, 0xaa, 0xb8, 0xb8, 0xb4, 0xa9, 0xa9, 0xa3, 0x99, 0x91,
-    0x81, 0x81, 0x88, 0x88, 0x88, 0x88, 0x81, 0x81, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x49, 0x49, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x49,
-    0x41, 0x41, 0x49, 0x49, 0x41, 0x41, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4a,
-    0x4a, 0x49, 0x41, 0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53,
-    0x53, 0x4d, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4e,
-    0x46, 0x37, 0x34, 0x2d, 0x29, 0x17, 0x0d, 0x0c, 0x09, 0x04, 0x04, 0x04,
-    0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0x05, 0x0e, 0x19, 0x1a, 0x1f, 0x1a,
-    0x05, 0x03, 0x1e, 0x66, 0xb8, 0xb4, 0xaa, 0xa7, 0x97, 0x90, 0x88, 0x81,
-    0x7d, 0x7a, 0x74, 0x6c, 0x6c, 0x68, 0x68, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x5f, 0x5e, 0x5f, 0x56, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x56, 0x55, 0x55, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x53, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x53, 0x4d,
-    0x53, 0x4d, 0x4d, 0x4d, 0x4a, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4e, 0x4a, 0x4d, 0x4a, 0x4a, 0x4d, 0x53, 0x4a, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4a, 0x4d, 0x4d, 0x4d, 0x4a, 0x53, 0x53, 0x4d, 0x4d, 0x4a,
-    0x4a, 0x4a, 0x4d, 0x4d, 0x4d, 0x4d, 0x53, 0x4d, 0x53, 0x53, 0x4d, 0x4d,
-    0x53, 0x4a, 0x4d, 0x4d, 0x4d, 0x53, 0x53, 0x4d, 0x4d, 0x53, 0x4d, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x4d, 0x53, 0x55, 0x55, 0x53, 0x53, 0x55, 0x53,
-    0x53, 0x53, 0x55, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x4a, 0x4a, 0x49, 0x41, 0x41, 0x3d, 0x37, 0x30, 0x2d, 0x29, 0x10, 0x10,
-    0x13, 0x13, 0x13, 0x0c, 0x01, 0x00, 0x01, 0x05, 0x16, 0x19, 0x1a, 0x1a,
-    0x1a, 0x1f, 0x1f, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x1e, 0x1f,
-    0x1a, 0x1e, 0x1a, 0x1a, 0x1f, 0x1e, 0x26, 0x1a, 0x1a, 0x1a, 0x0a, 0x05,
-    0x05, 0x05, 0x0a, 0x16, 0x26, 0x3a, 0x65, 0x8a, 0xac, 0xac, 0xa7, 0xb1,
-    0xa9, 0xa9, 0x99, 0x97, 0x97, 0x91, 0x91, 0x88, 0x81, 0x81, 0x81, 0x81,
-    0x7d, 0x7d, 0x78, 0x75, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49,
-    0x49, 0x41, 0x49, 0x49, 0x41, 0x41, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x4d, 0x55, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x44, 0x3d, 0x34, 0x30, 0x2d,
-    0x1b, 0x0d, 0x0d, 0x08, 0x04, 0x04, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x01, 0x05, 0x0a, 0x0e, 0x19, 0x1e, 0x0c, 0x03, 0x03, 0x1e, 0x62, 0xa9,
-    0xb4, 0xaa, 0x9d, 0x94, 0x8a, 0x81, 0x81, 0x78, 0x74, 0x6c, 0x6c, 0x6c,
-    0x68, 0x68, 0x5e, 0x56, 0x56, 0x5e, 0x5e, 0x5e, 0x5e, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x53, 0x4d, 0x4d, 0x4d, 0x4d, 0x53, 0x4d, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4e, 0x4d,
-    0x4a, 0x4a, 0x4d, 0x4d, 0x4a, 0x4d, 0x4d, 0x4a, 0x4a, 0x4a, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4a, 0x4d, 0x4d, 0x4a, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x4a, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x4a, 0x4d, 0x4d, 0x4d, 0x4a, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4a, 0x4d, 0x4d, 0x4d, 0x53, 0x53, 0x4d, 0x53, 0x53, 0x4d,
-    0x4d, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x4d, 0x4d, 0x53, 0x53, 0x4d, 0x53,
-    0x53, 0x53, 0x53, 0x55, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x49, 0x41,
-    0x46, 0x3e, 0x30, 0x30, 0x2d, 0x25, 0x10, 0x10, 0x13, 0x13, 0x13, 0x0c,
-    0x00, 0x00, 0x01, 0x0a, 0x16, 0x19, 0x1a, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f,
-    0x1e, 0x26, 0x1a, 0x1e, 0x1e, 0x1e, 0x1f, 0x1e, 0x1e, 0x1f, 0x1f, 0x1a,
-    0x1a, 0x1a, 0x1a, 0x0e, 0x05, 0x01, 0x02, 0x05, 0x11, 0x1d, 0x3a, 0x65,
-    0x8a, 0xac, 0xb8, 0xb1, 0xa7, 0x9d, 0x97, 0x9d, 0x97, 0x90, 0x88, 0x88,
-    0x88, 0x81, 0x81, 0x81, 0x7d, 0x7d, 0x76, 0x76, 0x76, 0x75, 0x75, 0x75,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x46, 0x41, 0x41, 0x41, 0x41, 0x41, 0x46, 0x46, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4d, 0x4d, 0x4d, 0x53, 0x53, 0x4d, 0x53, 0x53, 0x53,
-    0x4d, 0x4a, 0x47, 0x3d, 0x34, 0x34, 0x2d, 0x29, 0x0d, 0x0d, 0x0c, 0x09,
-    0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x07, 0x16,
-    0x16, 0x0e, 0x05, 0x05, 0x1e, 0x62, 0xac, 0xb4, 0xa7, 0x9d, 0x94, 0x88,
-    0x81, 0x7d, 0x76, 0x74, 0x6c, 0x6c, 0x68, 0x68, 0x68, 0x5e, 0x5e, 0x55,
-    0x56, 0x56, 0x56, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x53, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x53, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x53, 0x4a, 0x4a, 0x4a, 0x53, 0x4d, 0x4d, 0x4d, 0x53, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x4a, 0x4d,
-    0x4d, 0x4a, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x4d, 0x4d, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4d, 0x4d, 0x4a, 0x4d, 0x4a, 0x4a, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4a, 0x4d, 0x4d, 0x4a, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4a, 0x4d, 0x4d, 0x4a, 0x4a, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4a,
-    0x4a, 0x53, 0x4d, 0x4d, 0x4d, 0x53, 0x53, 0x4d, 0x4d, 0x4d, 0x53, 0x53,
-    0x53, 0x53, 0x4d, 0x4d, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x49, 0x41, 0x3d, 0x34, 0x30, 0x2d,
-    0x29, 0x10, 0x10, 0x10, 0x13, 0x13, 0x13, 0x07, 0x00, 0x00, 0x01, 0x0a,
-    0x16, 0x1e, 0x1a, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f, 0x26, 0x1e, 0x1f,
-    0x1e, 0x1e, 0x1f, 0x1e, 0x1f, 0x1f, 0x1e, 0x19, 0x16, 0x07, 0x05, 0x01,
-    0x00, 0x05, 0x1d, 0x3a, 0x65, 0xa1, 0xac, 0xb3, 0xa9, 0x9d, 0x9d, 0x89,
-    0x89, 0x90, 0x88, 0x88, 0x81, 0x81, 0x81, 0x7d, 0x76, 0x76, 0x76, 0x76,
-    0x74, 0x74, 0x75, 0x6e, 0x6e, 0x6e, 0x6a, 0x6a, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x45, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x49, 0x41, 0x41, 0x49, 0x49, 0x49, 0x41, 0x49, 0x41, 0x49, 0x49, 0x49,
-    0x49, 0x45, 0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d,
-    0x53, 0x53, 0x53, 0x53, 0x56, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x46, 0x34,
-    0x30, 0x30, 0x30, 0x1b, 0x0c, 0x0d, 0x07, 0x09, 0x04, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x0a, 0x0e, 0x0a, 0x02, 0x05, 0x1a,
-    0x62, 0xb4, 0xb8, 0xa9, 0x9d, 0x94, 0x89, 0x7d, 0x76, 0x76, 0x74, 0x6c,
-    0x68, 0x68, 0x68, 0x68, 0x5e, 0x5e, 0x5e, 0x55, 0x56, 0x56, 0x55, 0x55,
-    0x56, 0x56, 0x55, 0x4e, 0x4d, 0x53, 0x53, 0x4d, 0x53, 0x4d, 0x4d, 0x4d,
-    0x53, 0x4a, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x4d, 0x4d, 0x4a, 0x4a, 0x4d,
-    0x4d, 0x4d, 0x4a, 0x4d, 0x4d, 0x4d, 0x4d, 0x4a, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4a, 0x4a, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x4d, 0x4a, 0x4a, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x4a, 0x4d, 0x4a, 0x4a, 0x4d,
-    0x4a, 0x4d, 0x4a, 0x4a, 0x4a, 0x4d, 0x4a, 0x4d, 0x4d, 0x4d, 0x4d, 0x4a,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x4e, 0x4d, 0x4a, 0x4a, 0x4d, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d, 0x4d, 0x53, 0x4a, 0x4a, 0x4d, 0x4d,
-    0x4d, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a,
-    0x4a, 0x4a, 0x53, 0x53, 0x4d, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d,
-    0x4d, 0x4a, 0x47, 0x41, 0x3e, 0x34, 0x30, 0x2d, 0x25, 0x10, 0x10, 0x10,
-    0x13, 0x13, 0x13, 0x07, 0x00, 0x01, 0x05, 0x0a, 0x19, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x26, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1e, 0x1f, 0x1f, 0x26, 0x26,
-    0x1e, 0x1e, 0x0e, 0x05, 0x05, 0x00, 0x00, 0x11, 0x2f, 0x65, 0x96, 0xaa,
-    0xa7, 0xa3, 0x89, 0x62, 0x4c, 0x3a, 0x38, 0x2b, 0x42, 0x71, 0x81, 0x7d,
-    0x76, 0x76, 0x76, 0x76, 0x74, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x6a, 0x6a,
-    0x68, 0x6a, 0x63, 0x68, 0x41, 0x3f, 0x41, 0x41, 0x3f, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x49, 0x49, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x49, 0x49, 0x49, 0x4a,
-    0x4a, 0x4a, 0x4d, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x56, 0x53, 0x4a, 0x49, 0x3e, 0x34, 0x30, 0x30, 0x25, 0x0d,
-    0x0d, 0x0d, 0x08, 0x04, 0x04, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x0a, 0x0a, 0x0a, 0x01, 0x01, 0x0e, 0x4c, 0xaa, 0xb8, 0xa3, 0x97,
-    0x8a, 0x82, 0x7a, 0x7a, 0x74, 0x6c, 0x6c, 0x68, 0x68, 0x5e, 0x5e, 0x5f,
-    0x5b, 0x5e, 0x55, 0x56, 0x56, 0x55, 0x55, 0x56, 0x56, 0x55, 0x4d, 0x53,
-    0x53, 0x53, 0x4d, 0x4e, 0x4e, 0x4d, 0x4a, 0x4a, 0x4d, 0x4d, 0x4d, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4d, 0x4d, 0x4d, 0x4a, 0x4d, 0x4e, 0x4d, 0x4d, 0x4a,
-    0x4a, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4a, 0x4d, 0x4d, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d, 0x4a, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4a, 0x4d, 0x4d, 0x4d, 0x4d, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d, 0x4d, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4d, 0x4a, 0x4d, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x4a,
-    0x4d, 0x53, 0x53, 0x4d, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x4a, 0x4e, 0x49, 0x41,
-    0x34, 0x2d, 0x30, 0x29, 0x1b, 0x10, 0x10, 0x10, 0x13, 0x13, 0x13, 0x07,
-    0x00, 0x00, 0x05, 0x07, 0x1e, 0x1e, 0x1e, 0x1f, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1f, 0x1f, 0x1e, 0x1f, 0x26, 0x26, 0x1e, 0x1e, 0x19, 0x05, 0x02, 0x00,
-    0x01, 0x1d, 0x42, 0x96, 0xac, 0xa7, 0x89, 0x59, 0x3a, 0x2b, 0x21, 0x18,
-    0x18, 0x15, 0x22, 0x18, 0x2b, 0x62, 0x75, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
-    0x6c, 0x68, 0x68, 0x6a, 0x6a, 0x68, 0x68, 0x68, 0x63, 0x5f, 0x5f, 0x5e,
-    0x3f, 0x3f, 0x41, 0x3f, 0x41, 0x41, 0x41, 0x41, 0x3f, 0x3f, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x47, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x45, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x49, 0x41, 0x41, 0x41, 0x47, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x49, 0x49, 0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4d, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x56, 0x56, 0x53, 0x4d,
-    0x4a, 0x44, 0x34, 0x34, 0x2d, 0x30, 0x1b, 0x0d, 0x0d, 0x0c, 0x04, 0x04,
-    0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x05, 0x0a, 0x05, 0x00,
-    0x03, 0x07, 0x34, 0x9f, 0xb4, 0x9d, 0x97, 0x8a, 0x82, 0x76, 0x76, 0x6c,
-    0x6e, 0x6a, 0x68, 0x63, 0x5e, 0x5f, 0x5f, 0x5e, 0x55, 0x56, 0x55, 0x55,
-    0x56, 0x56, 0x55, 0x53, 0x53, 0x4d, 0x4d, 0x53, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4e, 0x4d, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x4d, 0x4a, 0x4a,
-    0x4d, 0x4d, 0x4a, 0x49, 0x4a, 0x4a, 0x4a, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4a, 0x4d, 0x4a, 0x4a, 0x4a, 0x4d, 0x4a, 0x4d, 0x4d, 0x47,
-    0x47, 0x4d, 0x4a, 0x4a, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x47, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d, 0x4a, 0x4a,
-    0x4d, 0x4d, 0x4a, 0x4a, 0x4d, 0x47, 0x4a, 0x4d, 0x4d, 0x4d, 0x4a, 0x4d,
-    0x4a, 0x4d, 0x4d, 0x53, 0x53, 0x4a, 0x4a, 0x4d, 0x4a, 0x4a, 0x53, 0x53,
-    0x4d, 0x4d, 0x53, 0x4d, 0x4d, 0x53, 0x53, 0x4d, 0x53, 0x53, 0x56, 0x53,
-    0x55, 0x56, 0x53, 0x4a, 0x4a, 0x49, 0x41, 0x3e, 0x34, 0x30, 0x2c, 0x25,
-    0x10, 0x10, 0x10, 0x10, 0x13, 0x13, 0x13, 0x05, 0x00, 0x00, 0x05, 0x0e,
-    0x1a, 0x1e, 0x1a, 0x26, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x1f, 0x26,
-    0x26, 0x1f, 0x1a, 0x07, 0x01, 0x02, 0x05, 0x1d, 0x4c, 0x96, 0xaa, 0x89,
-    0x4f, 0x2f, 0x21, 0x0b, 0x0b, 0x0b, 0x0f, 0x0f, 0x0f, 0x18, 0x22, 0x22,
-    0x38, 0x62, 0x6a, 0x6a, 0x6a, 0x68, 0x6a, 0x68, 0x63, 0x68, 0x63, 0x63,
-    0x68, 0x63, 0x5f, 0x5e, 0x5e, 0x5f, 0x5e, 0x56, 0x3f, 0x3f, 0x41, 0x41,
-    0x41, 0x41, 0x3f, 0x41, 0x41, 0x41, 0x3f, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x45, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x49, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49,
-    0x49, 0x49, 0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53,
-    0x53, 0x56, 0x53, 0x53, 0x56, 0x53, 0x53, 0x4a, 0x49, 0x37, 0x34, 0x2d,
-    0x2d, 0x25, 0x0d, 0x0c, 0x0c, 0x08, 0x04, 0x04, 0x04, 0x01, 0x02, 0x01,
-    0x00, 0x00, 0x00, 0x02, 0x05, 0x0a, 0x01, 0x05, 0x0a, 0x28, 0x8a, 0xb4,
-    0xa7, 0x94, 0x8a, 0x82, 0x7a, 0x74, 0x6c, 0x6c, 0x6a, 0x68, 0x68, 0x5e,
-    0x5f, 0x5f, 0x5e, 0x55, 0x55, 0x56, 0x56, 0x56, 0x53, 0x53, 0x4d, 0x53,
-    0x53, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4a, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a,
-    0x4d, 0x4d, 0x4a, 0x4d, 0x4a, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4a, 0x4d, 0x4a, 0x4d, 0x4a, 0x4d, 0x47, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x49, 0x4a, 0x4a, 0x47, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x47, 0x47, 0x47, 0x47, 0x4d, 0x4d,
-    0x47, 0x4d, 0x4d, 0x47, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d, 0x4a,
-    0x4a, 0x4e, 0x47, 0x47, 0x4a, 0x4a, 0x4d, 0x4a, 0x4a, 0x4d, 0x4d, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x56, 0x56, 0x53, 0x53, 0x53, 0x53, 0x4a,
-    0x4a, 0x49, 0x41, 0x37, 0x30, 0x30, 0x29, 0x10, 0x0d, 0x10, 0x10, 0x10,
-    0x13, 0x13, 0x10, 0x03, 0x00, 0x01, 0x05, 0x0e, 0x1e, 0x1e, 0x26, 0x26,
-    0x1f, 0x1f, 0x26, 0x1e, 0x1f, 0x26, 0x26, 0x1f, 0x1e, 0x0e, 0x05, 0x02,
-    0x03, 0x1d, 0x4c, 0x7c, 0x65, 0x59, 0x2f, 0x16, 0x09, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0f, 0x0f, 0x22, 0x2b, 0x42, 0x59, 0x68, 0x68, 0x63, 0x63,
-    0x63, 0x63, 0x68, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x5e, 0x5e, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x3f, 0x3f, 0x3f, 0x41, 0x41, 0x41, 0x3f, 0x47,
-    0x41, 0x3f, 0x41, 0x41, 0x3f, 0x3f, 0x3f, 0x41, 0x41, 0x41, 0x41, 0x46,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3f, 0x3f, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x47, 0x41, 0x41, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x56, 0x56, 0x53,
-    0x53, 0x53, 0x53, 0x4a, 0x3e, 0x34, 0x34, 0x2d, 0x29, 0x1b, 0x0c, 0x0c,
-    0x0c, 0x09, 0x04, 0x04, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x05, 0x01, 0x00, 0x08, 0x26, 0x7a, 0xaa, 0xa3, 0x97, 0x8a, 0x82, 0x7a,
-    0x6c, 0x6c, 0x6c, 0x68, 0x63, 0x5e, 0x5e, 0x5e, 0x56, 0x55, 0x56, 0x55,
-    0x55, 0x53, 0x53, 0x4d, 0x53, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4a, 0x4d, 0x4a, 0x4a, 0x4a, 0x4d, 0x4d, 0x47, 0x4d, 0x4e, 0x4a,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4a, 0x4d, 0x4d, 0x4d, 0x47, 0x4d, 0x4d, 0x47,
-    0x4d, 0x47, 0x4d, 0x4a, 0x4d, 0x47, 0x47, 0x47, 0x4a, 0x4d, 0x49, 0x49,
-    0x49, 0x49, 0x4a, 0x4d, 0x4d, 0x4a, 0x4a, 0x47, 0x4e, 0x4a, 0x4a, 0x4a,
-    0x49, 0x47, 0x47, 0x4d, 0x4a, 0x47, 0x47, 0x47, 0x4a, 0x4a, 0x47, 0x4a,
-    0x49, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x47, 0x47, 0x4d, 0x4a, 0x47, 0x49, 0x4a,
-    0x49, 0x49, 0x47, 0x4d, 0x4d, 0x4a, 0x4d, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x4d, 0x53, 0x4a, 0x49, 0x49, 0x3e, 0x34,
-    0x30, 0x30, 0x25, 0x10, 0x0d, 0x10, 0x10, 0x10, 0x13, 0x13, 0x0d, 0x01,
-    0x00, 0x02, 0x05, 0x0e, 0x1a, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x26, 0x1f,
-    0x1f, 0x26, 0x26, 0x19, 0x0a, 0x02, 0x00, 0x11, 0x3a, 0x65, 0x4c, 0x1d,
-    0x09, 0x04, 0x06, 0x0b, 0x0b, 0x0b, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x22,
-    0x38, 0x59, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x56,
-    0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x56, 0x56, 0x53, 0x53, 0x53, 0x4d,
-    0x3f, 0x3f, 0x3f, 0x3f, 0x41, 0x41, 0x3f, 0x3f, 0x3f, 0x3f, 0x41, 0x41,
-    0x41, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x41, 0x41, 0x41, 0x47, 0x41,
-    0x41, 0x41, 0x41, 0x3f, 0x3f, 0x45, 0x41, 0x41, 0x3f, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x49, 0x49, 0x49, 0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x56, 0x56, 0x53, 0x53, 0x4a, 0x46,
-    0x37, 0x30, 0x2d, 0x2d, 0x26, 0x0d, 0x0c, 0x0c, 0x07, 0x04, 0x04, 0x04,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x01, 0x01, 0x03, 0x1a,
-    0x62, 0xa9, 0x9d, 0x90, 0x8a, 0x81, 0x76, 0x6c, 0x6c, 0x68, 0x66, 0x5f,
-    0x5e, 0x5e, 0x5e, 0x55, 0x56, 0x55, 0x55, 0x56, 0x56, 0x53, 0x4d, 0x53,
-    0x4d, 0x4d, 0x53, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4d, 0x4d, 0x47, 0x47, 0x4a, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4a,
-    0x4d, 0x47, 0x47, 0x47, 0x47, 0x47, 0x49, 0x49, 0x49, 0x47, 0x47, 0x47,
-    0x4a, 0x49, 0x4a, 0x4a, 0x47, 0x47, 0x4a, 0x4a, 0x4a, 0x49, 0x4a, 0x47,
-    0x4a, 0x47, 0x47, 0x47, 0x4e, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x47, 0x47,
-    0x49, 0x4a, 0x4a, 0x47, 0x47, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4a, 0x49,
-    0x49, 0x49, 0x49, 0x4a, 0x47, 0x47, 0x49, 0x49, 0x47, 0x47, 0x47, 0x4a,
-    0x4a, 0x49, 0x47, 0x47, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x4a, 0x4d, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x4a,
-    0x53, 0x4d, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x56, 0x53,
-    0x56, 0x53, 0x53, 0x4a, 0x4a, 0x41, 0x37, 0x30, 0x30, 0x30, 0x17, 0x0d,
-    0x0d, 0x10, 0x10, 0x13, 0x13, 0x13, 0x0c, 0x01, 0x01, 0x05, 0x05, 0x16,
-    0x1e, 0x1e, 0x1f, 0x1f, 0x26, 0x25, 0x26, 0x25, 0x1f, 0x1f, 0x19, 0x05,
-    0x02, 0x05, 0x16, 0x2f, 0x2f, 0x1d, 0x09, 0x06, 0x06, 0x0b, 0x0b, 0x0b,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x18, 0x2b, 0x4e, 0x5f, 0x5f, 0x55,
-    0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4d, 0x3f, 0x3f, 0x3f, 0x3f,
-    0x3f, 0x41, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
-    0x3f, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3f, 0x3f, 0x3f, 0x3f,
-    0x3f, 0x45, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x45, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49,
-    0x49, 0x4a, 0x49, 0x49, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x56, 0x56, 0x56, 0x56, 0x53, 0x53, 0x4e, 0x3c, 0x34, 0x30, 0x2d, 0x29,
-    0x1b, 0x0d, 0x0c, 0x0c, 0x09, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x16, 0x4f, 0x99, 0x99, 0x90, 0x8a,
-    0x82, 0x7b, 0x75, 0x6a, 0x68, 0x68, 0x5e, 0x5f, 0x5e, 0x55, 0x56, 0x55,
-    0x56, 0x53, 0x53, 0x4d, 0x53, 0x4d, 0x4d, 0x4a, 0x4d, 0x4a, 0x4a, 0x4a,
-    0x4d, 0x4a, 0x4a, 0x4a, 0x4d, 0x47, 0x47, 0x47, 0x4a, 0x4a, 0x4a, 0x47,
-    0x47, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d, 0x4d, 0x4a, 0x4a, 0x49, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x49, 0x49, 0x49, 0x47, 0x47, 0x4a, 0x49, 0x49, 0x49,
-    0x47, 0x47, 0x49, 0x4a, 0x4a, 0x49, 0x4a, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x4a, 0x49, 0x47, 0x47, 0x49, 0x49, 0x47, 0x49, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4a, 0x49, 0x49, 0x4a, 0x4a,
-    0x47, 0x49, 0x49, 0x49, 0x47, 0x47, 0x4a, 0x49, 0x4a, 0x4a, 0x49, 0x4a,
-    0x47, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4a, 0x4a, 0x4a, 0x4d, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d, 0x4a, 0x4a, 0x53, 0x53, 0x4d, 0x4d,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a,
-    0x49, 0x3d, 0x34, 0x34, 0x30, 0x25, 0x0d, 0x0d, 0x0d, 0x10, 0x10, 0x10,
-    0x13, 0x13, 0x0c, 0x01, 0x00, 0x05, 0x0a, 0x16, 0x1a, 0x1f, 0x1e, 0x1e,
-    0x26, 0x1f, 0x1f, 0x1f, 0x26, 0x0c, 0x01, 0x01, 0x00, 0x04, 0x16, 0x11,
-    0x09, 0x06, 0x0b, 0x06, 0x06, 0x0b, 0x0b, 0x0f, 0x0b, 0x0f, 0x18, 0x18,
-    0x22, 0x22, 0x38, 0x4e, 0x56, 0x56, 0x56, 0x56, 0x56, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3d,
-    0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x41, 0x3f,
-    0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x45, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
-    0x3f, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x47, 0x41, 0x41, 0x41, 0x41, 0x49, 0x49, 0x49, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x56, 0x53, 0x53, 0x56, 0x56,
-    0x53, 0x4a, 0x3d, 0x34, 0x34, 0x2d, 0x2d, 0x25, 0x0d, 0x0c, 0x0c, 0x0c,
-    0x04, 0x04, 0x01, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x05, 0x03,
-    0x05, 0x0e, 0x3c, 0x90, 0x9f, 0x90, 0x82, 0x7d, 0x76, 0x6e, 0x6a, 0x68,
-    0x5e, 0x5b, 0x5e, 0x55, 0x56, 0x56, 0x56, 0x4d, 0x4d, 0x4d, 0x53, 0x4d,
-    0x4d, 0x4a, 0x4a, 0x4d, 0x4e, 0x4d, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x4a,
-    0x47, 0x47, 0x49, 0x46, 0x47, 0x47, 0x47, 0x47, 0x47, 0x49, 0x49, 0x47,
-    0x47, 0x47, 0x49, 0x47, 0x49, 0x47, 0x49, 0x47, 0x47, 0x47, 0x47, 0x49,
-    0x49, 0x49, 0x49, 0x47, 0x49, 0x49, 0x49, 0x47, 0x49, 0x47, 0x4a, 0x49,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x47, 0x49, 0x49, 0x49, 0x47,
-    0x47, 0x47, 0x47, 0x49, 0x47, 0x4a, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x47, 0x49, 0x49, 0x49, 0x47, 0x47, 0x47, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x49, 0x47, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x41, 0x49,
-    0x49, 0x49, 0x49, 0x4a, 0x4a, 0x4a, 0x4d, 0x4a, 0x4a, 0x4a, 0x4d, 0x4a,
-    0x4a, 0x4d, 0x4d, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x4d, 0x4d, 0x53, 0x4d,
-    0x55, 0x53, 0x55, 0x55, 0x53, 0x53, 0x53, 0x4a, 0x46, 0x37, 0x34, 0x2d,
-    0x2d, 0x1b, 0x0d, 0x0d, 0x0d, 0x10, 0x10, 0x13, 0x13, 0x13, 0x07, 0x00,
-    0x00, 0x05, 0x0a, 0x16, 0x19, 0x1a, 0x1e, 0x1f, 0x26, 0x1f, 0x1f, 0x1a,
-    0x07, 0x03, 0x0a, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x06, 0x06, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0f, 0x0f, 0x0f, 0x2b, 0x3a, 0x43, 0x44, 0x52, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4d, 0x4d, 0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x49, 0x49,
-    0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
-    0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x45, 0x3f, 0x3f, 0x41, 0x41,
-    0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x47, 0x3f, 0x3f, 0x3f,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x49, 0x41, 0x49, 0x49, 0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53,
-    0x53, 0x53, 0x53, 0x56, 0x53, 0x53, 0x56, 0x55, 0x53, 0x46, 0x37, 0x34,
-    0x2d, 0x2f, 0x29, 0x1b, 0x0d, 0x0c, 0x0d, 0x0e, 0x04, 0x04, 0x01, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x01, 0x0a, 0x0a, 0x05, 0x07, 0x28, 0x7a, 0x9f,
-    0x90, 0x82, 0x7a, 0x74, 0x6c, 0x66, 0x66, 0x5e, 0x5e, 0x5e, 0x55, 0x56,
-    0x53, 0x53, 0x53, 0x53, 0x4a, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x4a, 0x4d,
-    0x4d, 0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x49, 0x47, 0x47, 0x47, 0x49, 0x49,
-    0x47, 0x4e, 0x49, 0x47, 0x47, 0x49, 0x47, 0x47, 0x47, 0x49, 0x47, 0x49,
-    0x49, 0x47, 0x49, 0x47, 0x47, 0x49, 0x47, 0x49, 0x47, 0x49, 0x47, 0x47,
-    0x47, 0x49, 0x49, 0x47, 0x49, 0x49, 0x49, 0x47, 0x49, 0x49, 0x47, 0x49,
-    0x49, 0x49, 0x49, 0x49, 0x47, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x47,
-    0x47, 0x49, 0x49, 0x47, 0x47, 0x49, 0x47, 0x41, 0x49, 0x49, 0x49, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x49, 0x47, 0x49, 0x49, 0x49, 0x49, 0x49, 0x47,
-    0x49, 0x49, 0x49, 0x49, 0x47, 0x49, 0x47, 0x41, 0x49, 0x49, 0x49, 0x4a,
-    0x4a, 0x47, 0x47, 0x47, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4d, 0x53, 0x53, 0x53, 0x4d, 0x4d, 0x53, 0x53, 0x53, 0x56, 0x53,
-    0x53, 0x53, 0x4a, 0x4a, 0x3e, 0x34, 0x30, 0x30, 0x2a, 0x10, 0x0d, 0x0d,
-    0x0d, 0x10, 0x10, 0x13, 0x13, 0x10, 0x02, 0x01, 0x02, 0x05, 0x07, 0x19,
-    0x19, 0x1e, 0x1f, 0x1f, 0x29, 0x2d, 0x1a, 0x0a, 0x01, 0x05, 0x16, 0x16,
-    0x09, 0x06, 0x06, 0x06, 0x06, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x18, 0x18,
-    0x38, 0x3a, 0x43, 0x4e, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x4a, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x49, 0x49, 0x47, 0x49, 0x49, 0x49, 0x3f, 0x3f, 0x3f, 0x3f,
-    0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
-    0x3f, 0x3f, 0x3f, 0x45, 0x3f, 0x3d, 0x41, 0x41, 0x41, 0x3e, 0x3f, 0x3f,
-    0x3e, 0x3e, 0x3f, 0x3f, 0x3f, 0x3f, 0x41, 0x3f, 0x3f, 0x3f, 0x41, 0x47,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x49, 0x47,
-    0x49, 0x4a, 0x4d, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x56, 0x56, 0x52, 0x3e, 0x37, 0x2d, 0x2f, 0x2f, 0x25, 0x0d,
-    0x0c, 0x0d, 0x0c, 0x08, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x03, 0x0a, 0x1e, 0x62, 0x97, 0x94, 0x82, 0x7a, 0x74, 0x6c,
-    0x68, 0x66, 0x5e, 0x56, 0x55, 0x55, 0x4e, 0x55, 0x53, 0x53, 0x4a, 0x4a,
-    0x4a, 0x4d, 0x4a, 0x4a, 0x4a, 0x4a, 0x47, 0x47, 0x47, 0x49, 0x47, 0x47,
-    0x49, 0x49, 0x49, 0x49, 0x47, 0x47, 0x49, 0x49, 0x47, 0x47, 0x49, 0x49,
-    0x49, 0x47, 0x47, 0x47, 0x49, 0x49, 0x47, 0x47, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x49, 0x47, 0x47, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x47, 0x47, 0x49, 0x49, 0x49, 0x47,
-    0x47, 0x47, 0x49, 0x49, 0x49, 0x47, 0x47, 0x47, 0x47, 0x49, 0x49, 0x49,
-    0x49, 0x41, 0x47, 0x49, 0x49, 0x49, 0x47, 0x49, 0x47, 0x47, 0x47, 0x47,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x47, 0x41, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x41, 0x41, 0x49, 0x47, 0x47, 0x47, 0x4a, 0x49, 0x4a, 0x4d,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4d, 0x4d, 0x53, 0x4a, 0x4d, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x56, 0x56, 0x56, 0x53, 0x53, 0x4a, 0x41,
-    0x37, 0x34, 0x30, 0x30, 0x25, 0x0d, 0x0d, 0x0d, 0x0d, 0x10, 0x10, 0x13,
-    0x13, 0x0d, 0x01, 0x00, 0x05, 0x05, 0x0e, 0x19, 0x1a, 0x1f, 0x1f, 0x1f,
-    0x25, 0x19, 0x07, 0x00, 0x00, 0x0a, 0x11, 0x09, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x0b, 0x18, 0x18, 0x38, 0x3c, 0x46, 0x4a, 0x4a, 0x4a,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x4a, 0x4a, 0x49, 0x47, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x41, 0x49,
-    0x49, 0x41, 0x49, 0x41, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
-    0x3f, 0x3f, 0x3f, 0x3f, 0x3d, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x45,
-    0x3f, 0x3f, 0x3d, 0x41, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
-    0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x41, 0x47, 0x47, 0x3f, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x49, 0x49, 0x49, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x56, 0x56, 0x55, 0x56, 0x53,
-    0x3e, 0x37, 0x31, 0x2d, 0x2d, 0x28, 0x1b, 0x0d, 0x0c, 0x0c, 0x0c, 0x03,
-    0x05, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x05, 0x1a,
-    0x43, 0x90, 0x90, 0x82, 0x7a, 0x74, 0x6c, 0x68, 0x5e, 0x5e, 0x55, 0x56,
-    0x57, 0x55, 0x4d, 0x4d, 0x4d, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x4a,
-    0x47, 0x49, 0x49, 0x41, 0x47, 0x47, 0x47, 0x47, 0x49, 0x49, 0x49, 0x41,
-    0x47, 0x47, 0x47, 0x47, 0x49, 0x41, 0x49, 0x49, 0x49, 0x49, 0x49, 0x47,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x41, 0x41, 0x47, 0x49, 0x49,
-    0x41, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x47, 0x49, 0x47, 0x49, 0x47,
-    0x49, 0x49, 0x49, 0x47, 0x47, 0x49, 0x49, 0x47, 0x47, 0x47, 0x49, 0x49,
-    0x49, 0x47, 0x47, 0x47, 0x47, 0x49, 0x49, 0x49, 0x41, 0x41, 0x41, 0x49,
-    0x49, 0x47, 0x47, 0x49, 0x41, 0x47, 0x47, 0x47, 0x47, 0x47, 0x41, 0x41,
-    0x49, 0x47, 0x47, 0x49, 0x49, 0x49, 0x49, 0x47, 0x49, 0x41, 0x41, 0x41,
-    0x49, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x4a, 0x4a, 0x4a, 0x4a, 0x4e,
-    0x4d, 0x4d, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x56, 0x55, 0x56, 0x53, 0x53, 0x4a, 0x4a, 0x3e, 0x37, 0x34, 0x30, 0x2d,
-    0x25, 0x0d, 0x0d, 0x0d, 0x10, 0x10, 0x10, 0x13, 0x13, 0x0c, 0x01, 0x00,
-    0x05, 0x05, 0x0e, 0x1a, 0x1f, 0x1f, 0x1e, 0x1f, 0x1f, 0x07, 0x01, 0x00,
-    0x00, 0x03, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x21,
-    0x3a, 0x2f, 0x44, 0x4a, 0x49, 0x49, 0x49, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x49, 0x47, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-};
@@ -1,6671 +0,0 @@
-
-#include <stdint.h>
-#include <stdbool.h>
-#include "grlib/grlib.h"
-
-
-
-const uint8_t g_pui_Harmony_Image[] =
-{
-    IMAGE_FMT_8BPP_UNCOMP,
-    64, 1,
-    216, 0,
-
-    254,
-    0x03, 0x13, 0x0a,
-    0x0a, 0x13, 0x18,
-    0x05, 0x1c, 0x0d,
-    0x03, 0x21, 0x11,
-    0x04, 0x20, 0x17,
-    0x01, 0x25, 0x13,
-    0x09, 0x29, 0x17,
-    0x01, 0x2d, 0x13,
-    0x02, 0x2b, 0x18,
-    0x06, 0x2c, 0x1f,
-    0x05, 0x33, 0x19,
-    0x0b, 0x31, 0x1d,
-    0x04, 0x32, 0x1f,
-    0x00, 0x35, 0x1d,
-    0x0d, 0x2f, 0x29,
-    0x1e, 0x33, 0x1c,
-    0x05, 0x3b, 0x1c,
-    0x17, 0x36, 0x22,
-    0x06, 0x3a, 0x22,
-    0x0e, 0x3a, 0x20,
-    0x01, 0x3e, 0x20,
-    0x10, 0x3a, 0x26,
-    0x08, 0x3a, 0x29,
-    0x25, 0x2c, 0x3b,
-    0x12, 0x3b, 0x2f,
-    0x05, 0x40, 0x2a,
-    0x00, 0x44, 0x25,
-    0x07, 0x43, 0x25,
-    0x0f, 0x41, 0x27,
-    0x06, 0x4b, 0x28,
-    0x0e, 0x49, 0x2c,
-    0x06, 0x4a, 0x2e,
-    0x18, 0x4c, 0x2c,
-    0x10, 0x4a, 0x34,
-    0x19, 0x4a, 0x32,
-    0x03, 0x53, 0x2b,
-    0x0a, 0x4c, 0x37,
-    0x17, 0x4a, 0x39,
-    0x26, 0x4b, 0x32,
-    0x05, 0x52, 0x31,
-    0x0e, 0x52, 0x2f,
-    0x05, 0x51, 0x37,
-    0x15, 0x51, 0x32,
-    0x0e, 0x51, 0x35,
-    0x04, 0x5b, 0x33,
-    0x15, 0x59, 0x36,
-    0x0d, 0x5a, 0x39,
-    0x15, 0x57, 0x3d,
-    0x11, 0x5e, 0x36,
-    0x1f, 0x5c, 0x37,
-    0x01, 0x62, 0x39,
-    0x1f, 0x5a, 0x3e,
-    0x27, 0x5b, 0x3a,
-    0x23, 0x59, 0x42,
-    0x12, 0x5c, 0x43,
-    0x0c, 0x62, 0x3a,
-    0x42, 0x4a, 0x57,
-    0x02, 0x61, 0x43,
-    0x0d, 0x60, 0x41,
-    0x49, 0x46, 0x5f,
-    0x36, 0x5a, 0x3f,
-    0x1c, 0x60, 0x3d,
-    0x15, 0x60, 0x40,
-    0x24, 0x59, 0x49,
-    0x1d, 0x5f, 0x44,
-    0x3b, 0x55, 0x51,
-    0x09, 0x6a, 0x3d,
-    0x0b, 0x69, 0x44,
-    0x15, 0x69, 0x42,
-    0x1d, 0x69, 0x41,
-    0x15, 0x67, 0x49,
-    0x1d, 0x67, 0x48,
-    0x24, 0x68, 0x44,
-    0x2c, 0x68, 0x43,
-    0x1d, 0x65, 0x52,
-    0x0f, 0x72, 0x45,
-    0x27, 0x69, 0x4f,
-    0x11, 0x6d, 0x50,
-    0x2f, 0x69, 0x4e,
-    0x3b, 0x69, 0x4b,
-    0x13, 0x70, 0x4c,
-    0x1d, 0x70, 0x49,
-    0x30, 0x67, 0x57,
-    0x25, 0x71, 0x49,
-    0x1e, 0x6f, 0x51,
-    0x24, 0x6f, 0x50,
-    0x2d, 0x70, 0x4b,
-    0x17, 0x79, 0x4c,
-    0x1b, 0x78, 0x54,
-    0x4f, 0x70, 0x51,
-    0x25, 0x78, 0x51,
-    0x0d, 0x7f, 0x50,
-    0x01, 0x81, 0x51,
-    0x4d, 0x69, 0x65,
-    0x2c, 0x76, 0x58,
-    0x53, 0x5e, 0x7b,
-    0x2e, 0x7b, 0x53,
-    0x27, 0x79, 0x5b,
-    0x6a, 0x73, 0x4f,
-    0x1f, 0x7a, 0x5d,
-    0x35, 0x7a, 0x56,
-    0x64, 0x60, 0x78,
-    0x10, 0x7e, 0x5c,
-    0x3c, 0x7a, 0x54,
-    0x1f, 0x80, 0x54,
-    0x35, 0x78, 0x5d,
-    0x3d, 0x79, 0x5b,
-    0x22, 0x7f, 0x5b,
-    0x2b, 0x7f, 0x58,
-    0x3b, 0x77, 0x62,
-    0x49, 0x78, 0x5b,
-    0x32, 0x7d, 0x5f,
-    0x1e, 0x89, 0x57,
-    0x21, 0x88, 0x5e,
-    0x2c, 0x88, 0x5b,
-    0x22, 0x86, 0x64,
-    0x2c, 0x86, 0x63,
-    0x33, 0x86, 0x63,
-    0x16, 0x8e, 0x5e,
-    0x39, 0x86, 0x62,
-    0x40, 0x86, 0x61,
-    0x0c, 0x91, 0x5f,
-    0x38, 0x8c, 0x5e,
-    0x3a, 0x87, 0x6e,
-    0x28, 0x92, 0x60,
-    0x4c, 0x8a, 0x63,
-    0x43, 0x87, 0x6d,
-    0x2a, 0x90, 0x67,
-    0x51, 0x87, 0x6b,
-    0x4a, 0x88, 0x6d,
-    0x34, 0x91, 0x64,
-    0x2b, 0x8f, 0x6d,
-    0x34, 0x8f, 0x6c,
-    0x3b, 0x8f, 0x6b,
-    0x42, 0x8f, 0x6b,
-    0x48, 0x8f, 0x69,
-    0x30, 0x9a, 0x68,
-    0x1e, 0x9d, 0x6e,
-    0x27, 0x9d, 0x6b,
-    0x70, 0x76, 0x9e,
-    0x45, 0x98, 0x6f,
-    0x15, 0xa0, 0x71,
-    0x28, 0x9b, 0x74,
-    0x65, 0x8f, 0x76,
-    0x6a, 0x95, 0x6a,
-    0x47, 0x96, 0x77,
-    0x6a, 0x87, 0x88,
-    0x3f, 0x9c, 0x6f,
-    0x35, 0x9c, 0x73,
-    0x97, 0x8c, 0x72,
-    0x36, 0x9b, 0x79,
-    0x3f, 0x9b, 0x76,
-    0x3f, 0x99, 0x7c,
-    0x89, 0x7d, 0x99,
-    0x53, 0x9c, 0x71,
-    0x59, 0x9c, 0x6f,
-    0x38, 0xa2, 0x70,
-    0x60, 0x99, 0x75,
-    0x78, 0x94, 0x77,
-    0x53, 0x9a, 0x79,
-    0x59, 0x9a, 0x78,
-    0x5c, 0x97, 0x81,
-    0x4d, 0xa0, 0x77,
-    0x4e, 0x9e, 0x7e,
-    0x24, 0xac, 0x7b,
-    0x4b, 0xa9, 0x7b,
-    0x42, 0xa8, 0x81,
-    0x38, 0xad, 0x7c,
-    0x53, 0xa9, 0x7a,
-    0x30, 0xae, 0x7e,
-    0x55, 0xa7, 0x80,
-    0x43, 0xad, 0x7b,
-    0x56, 0xa6, 0x87,
-    0x39, 0xac, 0x86,
-    0x5f, 0xa6, 0x86,
-    0x4e, 0xaa, 0x86,
-    0x4e, 0xa9, 0x8c,
-    0x62, 0xac, 0x81,
-    0x68, 0xab, 0x84,
-    0x45, 0xab, 0x92,
-    0x70, 0xaa, 0x86,
-    0x53, 0xb2, 0x83,
-    0x4a, 0xb1, 0x89,
-    0x69, 0xaa, 0x8c,
-    0x5b, 0xb2, 0x82,
-    0x7c, 0xa9, 0x89,
-    0x70, 0xa8, 0x90,
-    0x5d, 0xb0, 0x89,
-    0x5e, 0xaf, 0x8f,
-    0x90, 0xb0, 0x7d,
-    0x67, 0xaf, 0x8e,
-    0x3f, 0xbb, 0x8e,
-    0x38, 0xbf, 0x8d,
-    0x50, 0xbd, 0x8c,
-    0x5c, 0xbd, 0x89,
-    0xa8, 0x9b, 0xb0,
-    0x93, 0xae, 0x95,
-    0x48, 0xbb, 0x97,
-    0x65, 0xb8, 0x93,
-    0xaa, 0xae, 0x8e,
-    0x54, 0xbb, 0x94,
-    0x65, 0xbc, 0x8d,
-    0x5d, 0xbb, 0x93,
-    0xc0, 0xa9, 0x94,
-    0x70, 0xbb, 0x90,
-    0x53, 0xb9, 0xa3,
-    0x71, 0xba, 0x98,
-    0x77, 0xbb, 0x94,
-    0x67, 0xb8, 0xa1,
-    0x77, 0xb9, 0x9b,
-    0x7f, 0xbb, 0x97,
-    0x7f, 0xb8, 0x9f,
-    0x8c, 0xb8, 0x9c,
-    0x6c, 0xbf, 0x9a,
-    0x4e, 0xcb, 0xa1,
-    0x73, 0xc9, 0x9f,
-    0x62, 0xcc, 0xa2,
-    0x75, 0xc7, 0xa7,
-    0x6d, 0xcc, 0xa2,
-    0x65, 0xc9, 0xaf,
-    0x7f, 0xca, 0xa4,
-    0x85, 0xca, 0xa3,
-    0x6d, 0xca, 0xad,
-    0x7f, 0xc8, 0xac,
-    0x85, 0xc8, 0xaa,
-    0x8e, 0xca, 0xa6,
-    0x77, 0xca, 0xb3,
-    0x90, 0xc8, 0xae,
-    0x9c, 0xc9, 0xab,
-    0xa9, 0xc9, 0xa9,
-    0x7e, 0xd4, 0xaa,
-    0x80, 0xd3, 0xb2,
-    0x8d, 0xda, 0xaf,
-    0x94, 0xda, 0xb2,
-    0x8e, 0xd9, 0xb7,
-    0x9d, 0xd9, 0xb5,
-    0xb8, 0xcf, 0xbf,
-    0x95, 0xd9, 0xbb,
-    0x9f, 0xd7, 0xbd,
-    0x8a, 0xdf, 0xba,
-    0xaa, 0xda, 0xb9,
-    0xd3, 0xd5, 0xb7,
-    0xb9, 0xd8, 0xbb,
-    0xac, 0xd8, 0xc0,
-    0xeb, 0xd1, 0xbc,
-    0x9b, 0xe7, 0xc3,
-    0xa2, 0xe8, 0xc5,
-    0xab, 0xe8, 0xc5,
-    0xac, 0xe3, 0xcf,
-    0xaf, 0xe8, 0xcc,
-    0xbb, 0xe9, 0xcc,
-    0xfc, 0xdf, 0xce,
-    0xcd, 0xec, 0xd3,
-    0xb9, 0xf4, 0xd4,
-    0xc8, 0xf6, 0xd9,
-
-    0xdd, 0xc9, 0xb8, 0xa2, 0x84, 0x61, 0x61, 0x61, 0x5e, 0x61, 0x7b, 0x91,
-    0x91, 0xa3, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xc9, 0xc9, 0xb8, 0xa8, 0xa8,
-    0xa5, 0x9c, 0x9c, 0xab, 0xab, 0xab, 0xb5, 0xc9, 0xdd, 0xeb, 0xeb, 0xeb,
-    0xeb, 0xeb, 0xeb, 0xdd, 0xcf, 0xe1, 0xeb, 0xe1, 0xb2, 0xb7, 0xd1, 0xbe,
-    0xa3, 0xb7, 0xe4, 0xe4, 0xdc, 0xca, 0xbc, 0xac, 0x85, 0x54, 0x4a, 0x4a,
-    0x55, 0x4a, 0x4a, 0x52, 0x69, 0x61, 0x52, 0x52, 0x52, 0x69, 0x61, 0x61,
-    0x54, 0x4a, 0x3a, 0x46, 0x54, 0x58, 0x58, 0x6f, 0x80, 0x9f, 0x85, 0x60,
-    0xb9, 0xae, 0x85, 0x9f, 0xae, 0x98, 0x84, 0x84, 0x84, 0x63, 0x63, 0x75,
-    0x7e, 0x8f, 0x8f, 0xf2, 0xfc, 0xec, 0xf2, 0xfc, 0xec, 0xec, 0xec, 0xec,
-    0xc7, 0xfc, 0xfc, 0xfc, 0xf0, 0xeb, 0xe3, 0xd3, 0x9d, 0xec, 0xf2, 0xf3,
-    0xf3, 0xf0, 0xdd, 0xbb, 0xa2, 0x7c, 0x8c, 0x72, 0x42, 0x44, 0x78, 0xaa,
-    0x93, 0x72, 0x5a, 0x44, 0x27, 0x1d, 0x28, 0x1c, 0x0a, 0x12, 0x33, 0x33,
-    0x34, 0x2a, 0x2b, 0x1e, 0x1e, 0x12, 0x0c, 0x0c, 0x1c, 0x4c, 0x55, 0x56,
-    0x7e, 0xa0, 0xa1, 0x9f, 0x80, 0xba, 0xd3, 0xd3, 0xd3, 0xe1, 0xe3, 0xe4,
-    0xe4, 0xee, 0xee, 0xf3, 0xee, 0xed, 0xf8, 0xf8, 0xed, 0xed, 0xe2, 0xdc,
-    0xe0, 0xe1, 0xd3, 0xd4, 0xd3, 0xd3, 0xd1, 0xb2, 0xb2, 0xb4, 0x81, 0x81,
-    0x9f, 0x91, 0x86, 0x33, 0x21, 0x1f, 0x27, 0x2b, 0x1f, 0x24, 0x21, 0x12,
-    0x0a, 0x05, 0x02, 0x0c, 0x21, 0x19, 0x19, 0x36, 0x3a, 0x2e, 0x27, 0x1f,
-    0x19, 0x19, 0x1e, 0x2b, 0x48, 0x47, 0x4a, 0x4a, 0x2e, 0x29, 0x1f, 0x1a,
-    0x2b, 0x2e, 0x2d, 0x2e, 0x27, 0x2e, 0x45, 0x56, 0x49, 0x3d, 0x56, 0x67,
-    0x6e, 0x56, 0x78, 0x9b, 0x7d, 0x1d, 0x27, 0x2c, 0x2c, 0x43, 0x42, 0x57,
-    0x57, 0x71, 0x71, 0x7f, 0x8c, 0x7a, 0x5a, 0x4b, 0x4b, 0x6c, 0x7a, 0x9b,
-    0xb9, 0xb2, 0xcc, 0xb2, 0xc9, 0xcc, 0xcc, 0xcf, 0xe1, 0xb2, 0x9a, 0xa2,
-    0xb1, 0xb1, 0xa8, 0xa5, 0xc9, 0xd2, 0xe4, 0xe5, 0xe5, 0xf2, 0xf3, 0xf0,
-    0x90, 0x6c, 0x68, 0x68, 0x70, 0x7a, 0x86, 0x87, 0x78, 0x60, 0x7a, 0x7a,
-    0x9b, 0xc4, 0xf1, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xdc, 0xce, 0xce, 0xaa,
-    0x8c, 0x75, 0x5a, 0x6f, 0x7e, 0x7e, 0x77, 0x86, 0x91, 0x97, 0x97, 0x93,
-    0xa2, 0xa8, 0xa8, 0x93, 0x93, 0xa5, 0xa5, 0xa2, 0x93, 0x7c, 0x7c, 0x88,
-    0x9c, 0xa5, 0xb8, 0xcc, 0xdd, 0xe9, 0xe8, 0xdc, 0xe9, 0xe9, 0xea, 0xd5,
-    0xc6, 0xdd, 0xeb, 0xe0, 0xbe, 0xce, 0xce, 0xbc, 0xa3, 0x9f, 0xd3, 0xe3,
-    0xe1, 0xe0, 0xd1, 0xd3, 0xa1, 0x7e, 0x46, 0x46, 0x4a, 0x6d, 0x4a, 0x36,
-    0x36, 0x36, 0x40, 0x24, 0x24, 0x36, 0x4a, 0x6d, 0x6d, 0x6d, 0x4a, 0x2b,
-    0x40, 0x4a, 0x6a, 0xa1, 0xd1, 0xbe, 0xaa, 0x8c, 0x78, 0x53, 0x56, 0x8f,
-    0xba, 0xac, 0x97, 0x84, 0x91, 0x7e, 0xa1, 0xc4, 0xc4, 0xec, 0xec, 0xec,
-    0xec, 0xec, 0xec, 0xfc, 0xec, 0xec, 0xf2, 0xec, 0xec, 0xec, 0xec, 0xfc,
-    0xf2, 0xeb, 0xe1, 0xba, 0xd4, 0xd4, 0xd4, 0xf0, 0xe3, 0xd2, 0xbb, 0x94,
-    0x8c, 0x71, 0x7a, 0x6b, 0x37, 0x51, 0x51, 0x78, 0x8c, 0x7a, 0x51, 0x37,
-    0x23, 0x1d, 0x14, 0x0a, 0x08, 0x13, 0x31, 0x3d, 0x2f, 0x2d, 0x2e, 0x2b,
-    0x1f, 0x0d, 0x08, 0x08, 0x34, 0x67, 0x67, 0x52, 0x52, 0x81, 0xba, 0xd3,
-    0xba, 0xd3, 0xd3, 0xd4, 0xc4, 0xe4, 0xe4, 0xee, 0xe0, 0xdf, 0xea, 0xee,
-    0xee, 0xdf, 0xe2, 0xe2, 0xe2, 0xe2, 0xd0, 0xd0, 0xd0, 0xd1, 0xd2, 0xd3,
-    0xd3, 0xb7, 0xcf, 0xbc, 0xac, 0xae, 0x7e, 0x7b, 0x86, 0x75, 0x75, 0x2f,
-    0x0d, 0x12, 0x14, 0x1b, 0x1b, 0x14, 0x19, 0x19, 0x0d, 0x03, 0x00, 0x06,
-    0x21, 0x19, 0x0a, 0x14, 0x2b, 0x2b, 0x1a, 0x19, 0x0d, 0x0d, 0x1e, 0x2f,
-    0x55, 0x54, 0x54, 0x54, 0x36, 0x29, 0x2b, 0x1b, 0x1a, 0x1a, 0x2b, 0x29,
-    0x2e, 0x46, 0x55, 0x53, 0x56, 0x47, 0x64, 0x67, 0x67, 0x56, 0x77, 0x87,
-    0x7d, 0x1b, 0x1a, 0x27, 0x2c, 0x2c, 0x32, 0x50, 0x42, 0x68, 0x71, 0xa2,
-    0xb1, 0x9a, 0x78, 0x60, 0x60, 0x78, 0x9d, 0xbd, 0xc4, 0xb1, 0xb8, 0xcc,
-    0xc9, 0xcc, 0xb8, 0xca, 0xc6, 0xd2, 0xb1, 0xa2, 0x9a, 0x9a, 0xaa, 0xb1,
-    0xb1, 0xcf, 0xe1, 0xe1, 0xe4, 0xeb, 0xeb, 0xf0, 0xd3, 0x9d, 0x7d, 0x7a,
-    0x7a, 0x8c, 0xa2, 0x9a, 0x9a, 0x87, 0x87, 0x87, 0xb4, 0xc4, 0xf1, 0xf4,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xf4, 0xf4, 0xf4, 0xe1, 0xe3, 0xd2, 0xb1, 0xa2, 0x86, 0x7e, 0xae,
-    0xae, 0x91, 0x77, 0x75, 0x7b, 0x74, 0x74, 0x85, 0xa2, 0xa8, 0x93, 0x7f,
-    0x93, 0xa2, 0xa2, 0x8c, 0x82, 0x71, 0x7f, 0x88, 0x93, 0xa2, 0xbb, 0xcc,
-    0xdd, 0xdc, 0xd7, 0xd7, 0xd7, 0xdc, 0xd9, 0xc9, 0xb8, 0xcf, 0xe3, 0xe1,
-    0xcf, 0xbe, 0xce, 0xbe, 0x91, 0x81, 0xba, 0xe3, 0xf3, 0xf3, 0xe3, 0xd1,
-    0xae, 0x7b, 0x4d, 0x4d, 0x5e, 0x4a, 0x4a, 0x36, 0x36, 0x46, 0x4a, 0x3f,
-    0x25, 0x25, 0x6d, 0xa1, 0x9f, 0x91, 0x6d, 0x52, 0x35, 0x52, 0xa1, 0xd1,
-    0xce, 0xc6, 0xaf, 0xa5, 0x85, 0x51, 0x6a, 0xba, 0xa1, 0xbe, 0xac, 0xae,
-    0xb9, 0xc4, 0xe5, 0xf2, 0xf2, 0xec, 0xec, 0xec, 0xec, 0xf2, 0xf2, 0xec,
-    0xec, 0xec, 0xf2, 0xf2, 0xec, 0xec, 0xec, 0xf2, 0xf2, 0xf0, 0xe1, 0xba,
-    0xc4, 0xc4, 0xb4, 0xcf, 0xbe, 0xaa, 0x94, 0x75, 0x85, 0x68, 0x72, 0x4b,
-    0x37, 0x45, 0x49, 0x9d, 0x9d, 0x78, 0x7d, 0x87, 0x5a, 0x23, 0x14, 0x0a,
-    0x07, 0x07, 0x1e, 0x28, 0x3e, 0x47, 0x2e, 0x29, 0x1a, 0x0c, 0x03, 0x02,
-    0x4f, 0x80, 0x80, 0x6d, 0x6e, 0xa1, 0xd1, 0xd2, 0xd3, 0xd3, 0xd4, 0xd4,
-    0xd4, 0xe4, 0xe1, 0xe3, 0xe0, 0xdf, 0xe2, 0xea, 0xe2, 0xde, 0xcd, 0xcd,
-    0xcd, 0xcd, 0xb3, 0xb0, 0xbc, 0xbe, 0xd1, 0xb7, 0xb2, 0xae, 0xbc, 0xbc,
-    0xac, 0xa0, 0x87, 0x78, 0x61, 0x63, 0x61, 0x2f, 0x0c, 0x0c, 0x0a, 0x0a,
-    0x16, 0x12, 0x0a, 0x13, 0x0c, 0x05, 0x02, 0x05, 0x1c, 0x1b, 0x19, 0x12,
-    0x21, 0x1f, 0x19, 0x12, 0x0d, 0x12, 0x1e, 0x29, 0x46, 0x4d, 0x61, 0x54,
-    0x3e, 0x2e, 0x2b, 0x1f, 0x1b, 0x1f, 0x2b, 0x36, 0x3a, 0x46, 0x5e, 0x53,
-    0x3e, 0x44, 0x60, 0x7d, 0x3d, 0x47, 0x50, 0x75, 0x48, 0x1b, 0x1a, 0x1d,
-    0x3e, 0x27, 0x37, 0x51, 0x42, 0x4b, 0x5b, 0x7c, 0x94, 0xaa, 0x9b, 0x64,
-    0x60, 0x7d, 0x90, 0xbd, 0xb9, 0xa2, 0xa5, 0xbb, 0xb8, 0xbb, 0xb5, 0xa5,
-    0xaf, 0xbb, 0xbb, 0xa2, 0xa2, 0xa2, 0xaa, 0xb1, 0xb2, 0xcf, 0xcf, 0xcc,
-    0xdd, 0xdd, 0xdd, 0xe1, 0xd2, 0xd2, 0xd4, 0xb4, 0x7d, 0xa2, 0xaa, 0xb1,
-    0xae, 0x9f, 0x9a, 0x9a, 0xb4, 0xc4, 0xf1, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4,
-    0xe4, 0xf0, 0xe1, 0xce, 0xae, 0x9f, 0xb7, 0xd1, 0xbc, 0x8c, 0x85, 0x85,
-    0x85, 0x75, 0x75, 0xa3, 0xbc, 0xaf, 0x93, 0x82, 0xa2, 0xaa, 0x93, 0x82,
-    0x82, 0x82, 0x93, 0x82, 0x93, 0xa2, 0xb1, 0xc6, 0xc9, 0xc9, 0xc2, 0xc2,
-    0xc9, 0xd5, 0xd5, 0xca, 0xaa, 0xd3, 0xf0, 0xeb, 0xd2, 0xd3, 0xd2, 0xbe,
-    0x9f, 0x8f, 0xe4, 0xee, 0xeb, 0xee, 0xe3, 0xce, 0xbc, 0x84, 0x63, 0x4d,
-    0x61, 0x6d, 0x6d, 0x4a, 0x4a, 0x4a, 0x4a, 0x3f, 0x3f, 0x52, 0x7e, 0xac,
-    0xb0, 0x98, 0x91, 0x7b, 0x4a, 0x6d, 0xa1, 0xbc, 0xd5, 0xc8, 0xb6, 0x88,
-    0x7f, 0x51, 0x48, 0x31, 0x2d, 0xb2, 0xb4, 0xb9, 0xe5, 0xec, 0xf2, 0xf3,
-    0xf3, 0xf3, 0xec, 0xec, 0xec, 0xf2, 0xf3, 0xf2, 0xe5, 0xec, 0xf2, 0xe5,
-    0xec, 0xc4, 0xe5, 0xe5, 0xf2, 0xe4, 0xd3, 0xc4, 0xc4, 0xe5, 0xd4, 0xd4,
-    0xb2, 0x84, 0x85, 0x8f, 0x6a, 0x4b, 0x58, 0x37, 0x3d, 0x7d, 0x9d, 0xb9,
-    0xb2, 0x87, 0x9a, 0xa2, 0x58, 0x43, 0x14, 0x08, 0x05, 0x05, 0x05, 0x0b,
-    0x28, 0x2e, 0x2b, 0x19, 0x0c, 0x03, 0x02, 0x02, 0x6d, 0xb4, 0x9d, 0xa1,
-    0xa1, 0xd3, 0xd2, 0xd1, 0xd3, 0xd4, 0xd4, 0xd3, 0xd2, 0xe1, 0xdc, 0xe1,
-    0xe3, 0xe0, 0xe2, 0xde, 0xde, 0xcd, 0xcd, 0xcd, 0xcd, 0xb3, 0xb3, 0xa6,
-    0xac, 0xae, 0xae, 0xae, 0xb2, 0xb2, 0xae, 0xae, 0x9f, 0x9f, 0xae, 0xa0,
-    0x6f, 0x61, 0x69, 0x3f, 0x15, 0x0c, 0x09, 0x05, 0x08, 0x0c, 0x0c, 0x05,
-    0x08, 0x06, 0x03, 0x0b, 0x1c, 0x21, 0x1e, 0x1b, 0x2f, 0x21, 0x19, 0x19,
-    0x14, 0x1b, 0x14, 0x1f, 0x2e, 0x46, 0x50, 0x46, 0x36, 0x2f, 0x1f, 0x1b,
-    0x19, 0x1f, 0x1f, 0x27, 0x2e, 0x46, 0x47, 0x3e, 0x2e, 0x46, 0x60, 0x45,
-    0x27, 0x2e, 0x3a, 0x3d, 0x10, 0x14, 0x14, 0x27, 0x2c, 0x2c, 0x2c, 0x43,
-    0x32, 0x42, 0x4b, 0x5b, 0x70, 0x94, 0x9a, 0x64, 0x60, 0x7d, 0xbd, 0xbd,
-    0xb9, 0x9a, 0x82, 0x94, 0xa2, 0xa5, 0x9c, 0xb8, 0xa6, 0xa5, 0xaa, 0x8c,
-    0x8c, 0xa2, 0xaa, 0xbb, 0xcf, 0xb1, 0xbb, 0xa8, 0xc6, 0xc6, 0xcc, 0xcf,
-    0xd2, 0xdd, 0xe1, 0xe3, 0xd4, 0xb2, 0xaa, 0xb1, 0xbe, 0xae, 0x9f, 0x9a,
-    0x9b, 0xbd, 0xf1, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf2, 0xf3, 0xe1, 0xcf,
-    0xb7, 0xb7, 0xd1, 0xbe, 0xaa, 0x8c, 0x85, 0x91, 0x91, 0x85, 0x85, 0xaa,
-    0xaa, 0xaf, 0x93, 0x93, 0xa5, 0xaf, 0x97, 0x84, 0x82, 0x93, 0x93, 0x93,
-    0x82, 0x8c, 0xa2, 0xa8, 0xa5, 0xab, 0x9c, 0xab, 0xb5, 0xc9, 0xc6, 0xbb,
-    0xb1, 0xd2, 0xf0, 0xee, 0xe3, 0xe3, 0xe3, 0xcf, 0xb7, 0xd4, 0xf3, 0xed,
-    0xdc, 0xe1, 0xe3, 0xd1, 0xac, 0x98, 0x74, 0x63, 0x54, 0x55, 0x4c, 0x2f,
-    0x36, 0x4a, 0x4a, 0x40, 0x3f, 0x3f, 0x7b, 0x98, 0xb0, 0x96, 0x84, 0x54,
-    0x28, 0x4c, 0x9f, 0xac, 0xb6, 0xad, 0x89, 0x8a, 0x71, 0x5a, 0x48, 0x1b,
-    0x10, 0x7d, 0xb4, 0xd4, 0xec, 0xfc, 0xf8, 0xee, 0xee, 0xee, 0xe3, 0xe4,
-    0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xd4, 0xe4, 0xc4, 0xc4, 0xc7, 0xc4, 0xe4,
-    0xe4, 0xe1, 0xd2, 0xc4, 0x9e, 0xc4, 0xd4, 0xe4, 0xd2, 0x9a, 0x90, 0x9e,
-    0x4c, 0x42, 0x53, 0x48, 0x60, 0x7d, 0x90, 0xb9, 0x9b, 0x8c, 0x86, 0x6b,
-    0x57, 0x43, 0x14, 0x03, 0x03, 0x05, 0x05, 0x05, 0x0a, 0x0d, 0x0a, 0x05,
-    0x02, 0x02, 0x02, 0x3c, 0xb7, 0xbe, 0xb7, 0xa1, 0xae, 0xce, 0xd1, 0xba,
-    0xd3, 0xe3, 0xe4, 0xd3, 0xd2, 0xe1, 0xe1, 0xe1, 0xe0, 0xdf, 0xde, 0xca,
-    0xca, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x96, 0x96, 0xa3, 0xa3, 0xa3, 0xae,
-    0xb7, 0xb2, 0xae, 0xae, 0xa0, 0x9f, 0xac, 0xae, 0x87, 0x69, 0x6d, 0x35,
-    0x35, 0x35, 0x25, 0x15, 0x08, 0x0b, 0x08, 0x05, 0x08, 0x08, 0x06, 0x15,
-    0x21, 0x33, 0x1f, 0x1f, 0x40, 0x2f, 0x21, 0x35, 0x1b, 0x1b, 0x0a, 0x19,
-    0x1f, 0x27, 0x2e, 0x36, 0x29, 0x1a, 0x1f, 0x1e, 0x1e, 0x1e, 0x1e, 0x1b,
-    0x1f, 0x2b, 0x28, 0x27, 0x2b, 0x27, 0x27, 0x1d, 0x1d, 0x28, 0x2d, 0x20,
-    0x22, 0x13, 0x10, 0x1d, 0x30, 0x23, 0x31, 0x30, 0x44, 0x50, 0x43, 0x4b,
-    0x68, 0x71, 0x7a, 0x53, 0x53, 0x7d, 0x90, 0x90, 0xb9, 0x9b, 0x71, 0x7a,
-    0x72, 0x7a, 0x93, 0x88, 0x7f, 0x94, 0x82, 0x8c, 0xa2, 0xaa, 0xaa, 0xb6,
-    0xb8, 0xaa, 0xa2, 0xcc, 0xb2, 0xb2, 0xb1, 0xbb, 0xc6, 0xcc, 0xe1, 0xd5,
-    0xdc, 0xd2, 0xaa, 0xbb, 0xb1, 0xae, 0x9a, 0x8c, 0x9a, 0xbd, 0xf1, 0xf4,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xf2, 0xe4, 0xdd, 0xb1, 0xd1, 0xd1, 0xce, 0xbb,
-    0xa2, 0x72, 0x85, 0x86, 0x91, 0x75, 0x75, 0x85, 0x84, 0x82, 0x7f, 0x82,
-    0x94, 0x96, 0x93, 0x82, 0x82, 0x93, 0x93, 0x82, 0x7a, 0x85, 0x8c, 0x82,
-    0x7c, 0x7c, 0x7c, 0x7c, 0xa5, 0xb1, 0xb1, 0xb2, 0x9b, 0xb2, 0xdd, 0xe0,
-    0xe3, 0xee, 0xeb, 0xe0, 0xb7, 0xd3, 0xe0, 0xe2, 0xd9, 0xe0, 0xe3, 0xe3,
-    0xac, 0x98, 0x73, 0x4d, 0x55, 0x4a, 0x36, 0x2f, 0x35, 0x6d, 0x4a, 0x2b,
-    0x25, 0x3f, 0x7b, 0x84, 0x83, 0x83, 0x63, 0x3a, 0x1e, 0x40, 0x7b, 0xa3,
-    0x94, 0x8a, 0x76, 0x70, 0x57, 0x51, 0x3e, 0x14, 0x10, 0x31, 0xa0, 0xe3,
-    0xee, 0xf8, 0xed, 0xe2, 0xe2, 0xe2, 0xdf, 0xd3, 0xd3, 0xd4, 0xd3, 0xd3,
-    0xd3, 0xd3, 0xd2, 0xd4, 0xc4, 0xc4, 0xd2, 0xd2, 0xd3, 0xb4, 0xb9, 0x8f,
-    0x9e, 0xc4, 0xd4, 0xd4, 0xd2, 0xb1, 0xb9, 0x8f, 0x44, 0x44, 0x56, 0x45,
-    0x56, 0x7d, 0x9d, 0x9d, 0xb4, 0x87, 0x6c, 0x50, 0x57, 0x43, 0x19, 0x03,
-    0x02, 0x03, 0x05, 0x08, 0x05, 0x06, 0x05, 0x05, 0x11, 0x26, 0x3f, 0xba,
-    0xd5, 0xce, 0xae, 0x91, 0xae, 0xce, 0xce, 0xbe, 0xe0, 0xe9, 0xe0, 0xdf,
-    0xdc, 0xe1, 0xe3, 0xe1, 0xdf, 0xd0, 0xb0, 0xb6, 0xb6, 0xb3, 0xb3, 0xb3,
-    0xb3, 0x96, 0x83, 0x83, 0x98, 0x85, 0x91, 0x91, 0x9f, 0xac, 0xa3, 0xac,
-    0xa0, 0x9f, 0xa3, 0xa2, 0x91, 0x6f, 0x4c, 0x2f, 0x24, 0x33, 0x34, 0x35,
-    0x22, 0x0b, 0x05, 0x05, 0x08, 0x08, 0x03, 0x15, 0x1c, 0x21, 0x19, 0x33,
-    0x40, 0x40, 0x40, 0x4c, 0x1f, 0x1f, 0x19, 0x19, 0x1e, 0x1f, 0x1a, 0x1f,
-    0x24, 0x1f, 0x2b, 0x2b, 0x2b, 0x2d, 0x2a, 0x10, 0x10, 0x10, 0x1b, 0x1e,
-    0x0a, 0x07, 0x07, 0x08, 0x07, 0x1b, 0x2d, 0x56, 0x56, 0x4e, 0x14, 0x28,
-    0x37, 0x51, 0x7d, 0x77, 0x58, 0x5a, 0x45, 0x44, 0x4b, 0x60, 0x67, 0x56,
-    0x53, 0x7d, 0x9d, 0x9d, 0xb1, 0xa2, 0x72, 0x75, 0x68, 0x86, 0x85, 0x7f,
-    0x82, 0x8c, 0x85, 0xb1, 0xa0, 0x9a, 0x93, 0x9c, 0xaa, 0xaa, 0xaa, 0xcc,
-    0xb2, 0xb1, 0xaa, 0xa2, 0x97, 0xaa, 0xcc, 0xb5, 0xd5, 0xd2, 0x9a, 0xb2,
-    0xb4, 0xa0, 0x87, 0x9b, 0x9d, 0xc4, 0xf1, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xf2, 0xe1, 0xc6, 0xb2, 0xe3, 0xdf, 0xbb, 0xa2, 0x7a, 0x6c, 0x75, 0x77,
-    0x75, 0x61, 0x61, 0x74, 0x71, 0x72, 0x72, 0x72, 0x72, 0x82, 0x82, 0x82,
-    0x72, 0x72, 0x82, 0x82, 0x7a, 0x72, 0x72, 0x71, 0x72, 0x71, 0x68, 0x70,
-    0x8c, 0xb2, 0xb2, 0x9b, 0x7d, 0x78, 0x9a, 0xcc, 0xe1, 0xeb, 0xe0, 0xce,
-    0xbc, 0xac, 0xce, 0xd9, 0xca, 0xbb, 0xce, 0xd1, 0xac, 0x96, 0x73, 0x61,
-    0x81, 0x7e, 0x4c, 0x6d, 0x6d, 0x81, 0x6d, 0x52, 0x3f, 0x35, 0x4c, 0x5e,
-    0x7b, 0x63, 0x46, 0x52, 0x3f, 0x35, 0x61, 0x74, 0x83, 0x71, 0x66, 0x66,
-    0x42, 0x37, 0x23, 0x1c, 0x20, 0x22, 0x8f, 0xee, 0xee, 0xf8, 0xe2, 0xe2,
-    0xde, 0xd0, 0xd0, 0xd1, 0xba, 0xba, 0xd3, 0xd3, 0xd3, 0xba, 0xd4, 0xb9,
-    0xc4, 0xb9, 0xcf, 0xd2, 0xb4, 0x9d, 0x8f, 0x80, 0xc4, 0xc4, 0xb9, 0xb9,
-    0xb4, 0xa0, 0x9e, 0x6e, 0x3e, 0x6e, 0x8f, 0x4e, 0x4f, 0x90, 0x9d, 0x87,
-    0x9d, 0x77, 0x5a, 0x44, 0x37, 0x2e, 0x14, 0x03, 0x02, 0x02, 0x05, 0x05,
-    0x08, 0x0b, 0x22, 0x35, 0x52, 0x35, 0x6d, 0xce, 0xc6, 0xd0, 0xae, 0x91,
-    0x91, 0xbe, 0xce, 0xbc, 0xd1, 0xdc, 0xdc, 0xd5, 0xd5, 0xdc, 0xe3, 0xce,
-    0xce, 0xce, 0xb0, 0xb3, 0xa6, 0xa6, 0xa6, 0x96, 0x96, 0x83, 0x73, 0x73,
-    0x85, 0x85, 0x91, 0x9f, 0x91, 0xa2, 0xa2, 0xac, 0xae, 0xb7, 0x9f, 0x91,
-    0x7b, 0x5e, 0x36, 0x2b, 0x40, 0x4c, 0x4c, 0x4e, 0x35, 0x22, 0x08, 0x02,
-    0x03, 0x02, 0x00, 0x02, 0x05, 0x12, 0x1e, 0x33, 0x4c, 0x36, 0x47, 0x4a,
-    0x2f, 0x2f, 0x2b, 0x19, 0x1b, 0x19, 0x21, 0x19, 0x1f, 0x2f, 0x2f, 0x2e,
-    0x3e, 0x2e, 0x31, 0x20, 0x1c, 0x13, 0x0a, 0x0a, 0x08, 0x07, 0x0a, 0x13,
-    0x1c, 0x2f, 0x64, 0x78, 0x87, 0x80, 0x2a, 0x44, 0x46, 0x51, 0x87, 0x60,
-    0x58, 0x60, 0x56, 0x48, 0x56, 0x67, 0x80, 0x67, 0x78, 0xa3, 0xae, 0xb1,
-    0x93, 0x82, 0x6f, 0x6c, 0x72, 0x9a, 0x86, 0x82, 0xaa, 0xa2, 0xaa, 0xaa,
-    0xb4, 0xa0, 0x8c, 0xa2, 0x9a, 0xb1, 0xb2, 0xb1, 0xa8, 0xbb, 0xb2, 0xb2,
-    0xcc, 0xcf, 0xb2, 0xb2, 0xcf, 0xe1, 0xd4, 0xe4, 0xe4, 0xb4, 0x9b, 0x90,
-    0xc4, 0xc7, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf3, 0xdd, 0xc6, 0xd2,
-    0xe1, 0xd5, 0xaa, 0x82, 0x6c, 0x86, 0x7b, 0x6c, 0x5a, 0x5e, 0x61, 0x74,
-    0x58, 0x58, 0x5a, 0x75, 0x85, 0x85, 0x72, 0x6b, 0x6b, 0x75, 0x82, 0x7a,
-    0x82, 0x72, 0x58, 0x58, 0x6c, 0x6c, 0x72, 0x7a, 0x9a, 0x9b, 0x7d, 0x67,
-    0x64, 0x53, 0x7a, 0xb2, 0xe3, 0xe1, 0xdd, 0xc6, 0xa2, 0x91, 0xae, 0xc6,
-    0xb6, 0xa6, 0xac, 0xd1, 0xce, 0xa3, 0x84, 0x86, 0x7e, 0x6f, 0x6d, 0xa1,
-    0x91, 0x91, 0x7b, 0x6d, 0x4c, 0x2f, 0x36, 0x36, 0x4a, 0x36, 0x2f, 0x52,
-    0x52, 0x2f, 0x2e, 0x54, 0x58, 0x58, 0x42, 0x32, 0x23, 0x23, 0x23, 0x2d,
-    0x33, 0x8f, 0xd4, 0xee, 0xe2, 0xe2, 0xe2, 0xe2, 0xcd, 0xcd, 0xb3, 0xac,
-    0xb7, 0xb7, 0xae, 0xb7, 0xb7, 0xb4, 0xba, 0x8f, 0x8f, 0x8f, 0xa0, 0xb4,
-    0x8f, 0x80, 0x80, 0x80, 0xb9, 0xb9, 0xb4, 0xb4, 0x9d, 0x8f, 0x9e, 0x6e,
-    0x4f, 0x9e, 0xc7, 0xc4, 0xc4, 0xb9, 0x9d, 0x67, 0x7d, 0x60, 0x67, 0x49,
-    0x2b, 0x1a, 0x12, 0x03, 0x00, 0x03, 0x05, 0x05, 0x0c, 0x35, 0x67, 0x78,
-    0x64, 0x4c, 0x77, 0xbb, 0xbb, 0xbc, 0xac, 0xa1, 0x80, 0xa1, 0xd1, 0xcf,
-    0xd1, 0xce, 0xd0, 0xce, 0xce, 0xdc, 0xdc, 0xd5, 0xce, 0xbc, 0xb0, 0x96,
-    0xb0, 0xa6, 0x96, 0x96, 0x96, 0x83, 0x73, 0x73, 0x75, 0x7b, 0x86, 0x9f,
-    0x91, 0x8c, 0xaa, 0xac, 0xae, 0xae, 0xa0, 0x9f, 0x81, 0x4c, 0x2f, 0x36,
-    0x4a, 0x55, 0x55, 0x69, 0x4c, 0x4c, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x12, 0x1e, 0x4e, 0x36, 0x47, 0x47, 0x4a, 0x36, 0x29, 0x1f, 0x1b,
-    0x19, 0x12, 0x21, 0x21, 0x2b, 0x36, 0x2e, 0x3e, 0x47, 0x3d, 0x2d, 0x20,
-    0x20, 0x1c, 0x0a, 0x0b, 0x0b, 0x07, 0x0d, 0x1e, 0x2d, 0x5e, 0x87, 0x9f,
-    0x8c, 0x9a, 0xa0, 0x77, 0x5e, 0x45, 0x87, 0x78, 0x6c, 0x77, 0x7d, 0x80,
-    0x90, 0x90, 0x80, 0x9d, 0x9b, 0x97, 0x97, 0xaa, 0xa2, 0xa2, 0x9f, 0x5e,
-    0x75, 0x8c, 0x86, 0x9a, 0xb1, 0xae, 0xa2, 0xaa, 0xb1, 0x9b, 0x9f, 0xb4,
-    0x9a, 0xb1, 0xb1, 0x9a, 0xaa, 0xb2, 0xb4, 0xb4, 0xbb, 0xbb, 0xaa, 0xcf,
-    0xcf, 0xe1, 0xe4, 0xe1, 0xd2, 0xd2, 0xb9, 0xc4, 0xc7, 0xf4, 0xf4, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xf0, 0xdd, 0xcf, 0xe3, 0xdd, 0xc6, 0x97, 0x75,
-    0x85, 0x91, 0x85, 0x6c, 0x5a, 0x75, 0x91, 0x74, 0x5a, 0x51, 0x61, 0x91,
-    0xa3, 0x97, 0x82, 0x6b, 0x75, 0x91, 0xa2, 0xa2, 0x8c, 0x6c, 0x5a, 0x60,
-    0x77, 0x86, 0x87, 0x9a, 0x9a, 0x9b, 0x67, 0x67, 0x53, 0x60, 0x87, 0xb4,
-    0xe4, 0xe3, 0xe0, 0xc6, 0xa3, 0x86, 0x91, 0xac, 0xaf, 0x84, 0xa0, 0xe3,
-    0xd1, 0xb7, 0xae, 0xac, 0x91, 0x7b, 0x7b, 0xa1, 0xac, 0x98, 0x98, 0x7b,
-    0x4a, 0x24, 0x21, 0x25, 0x52, 0x6d, 0x81, 0x81, 0x4c, 0x36, 0x2b, 0x36,
-    0x3e, 0x3a, 0x37, 0x46, 0x27, 0x3e, 0x2e, 0x28, 0x4f, 0xe5, 0xee, 0xed,
-    0xe2, 0xcd, 0xcd, 0xcd, 0xcd, 0xb3, 0xb3, 0x98, 0xac, 0xa1, 0x91, 0x91,
-    0xa1, 0x8f, 0xa0, 0x7e, 0x7e, 0x8f, 0x81, 0x80, 0x6e, 0x7e, 0x6a, 0x8f,
-    0xb9, 0xb9, 0xb2, 0x9a, 0x9d, 0x8f, 0x8f, 0x59, 0x6e, 0xc4, 0xc4, 0xd4,
-    0xb4, 0xb2, 0xb2, 0x7d, 0x64, 0x44, 0x4e, 0x48, 0x2b, 0x14, 0x0a, 0x03,
-    0x03, 0x05, 0x03, 0x03, 0x25, 0x81, 0x85, 0x75, 0x75, 0x54, 0x6f, 0xac,
-    0xbc, 0xac, 0xa1, 0xb9, 0x92, 0x8f, 0xb7, 0xcf, 0xd1, 0xd1, 0xae, 0xd3,
-    0xd2, 0xdc, 0xd5, 0xd5, 0xce, 0xbc, 0xa3, 0x98, 0x97, 0x97, 0x97, 0x91,
-    0x91, 0x85, 0x63, 0x6b, 0x74, 0x86, 0x87, 0x9f, 0x91, 0x85, 0x97, 0x97,
-    0x97, 0xa3, 0x9f, 0x9f, 0x81, 0x6d, 0x35, 0x2f, 0x29, 0x4a, 0x69, 0x69,
-    0x55, 0x5e, 0x2f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x2a, 0x4c,
-    0x47, 0x54, 0x47, 0x46, 0x36, 0x36, 0x2f, 0x2b, 0x1b, 0x12, 0x19, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x47, 0x56, 0x48, 0x28, 0x2a, 0x34, 0x1c, 0x0a, 0x0a,
-    0x13, 0x0a, 0x0a, 0x1a, 0x37, 0x75, 0xa2, 0xa2, 0x8c, 0xa2, 0x93, 0x85,
-    0x84, 0x44, 0x7a, 0x78, 0x78, 0x78, 0x7d, 0x80, 0x80, 0x7d, 0xb1, 0xb1,
-    0xae, 0x91, 0x91, 0xa3, 0xae, 0xb4, 0x9f, 0x75, 0x72, 0x72, 0xa2, 0xb1,
-    0xaa, 0xbb, 0xbc, 0xaa, 0xa8, 0xaa, 0xb1, 0xb4, 0xb2, 0xb1, 0x9a, 0x9f,
-    0xae, 0xb2, 0x9d, 0xb1, 0xaa, 0xaa, 0xae, 0xcf, 0xcf, 0xd2, 0xe1, 0xcf,
-    0xce, 0xd2, 0xe4, 0xc4, 0xf1, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xf0, 0xe1, 0xe1, 0xe1, 0xcc, 0xbb, 0xa2, 0x85, 0x91, 0x91, 0x85, 0x75,
-    0x6c, 0x86, 0x91, 0x84, 0x6b, 0x6b, 0x91, 0xac, 0xaf, 0x94, 0x82, 0x7a,
-    0x86, 0xac, 0xbb, 0xa8, 0x93, 0x7a, 0x60, 0x64, 0x87, 0x9a, 0xb1, 0xb1,
-    0x9b, 0x90, 0x90, 0x7d, 0x67, 0x87, 0x9a, 0xd3, 0xe4, 0xe3, 0xe3, 0xd2,
-    0xb7, 0x9f, 0x86, 0x91, 0x91, 0x9f, 0xa0, 0xd3, 0xd3, 0xd3, 0xd3, 0xce,
-    0xa3, 0x84, 0x7b, 0xae, 0xac, 0x98, 0x83, 0x7b, 0x54, 0x24, 0x3f, 0x8f,
-    0xb9, 0xb7, 0x9f, 0x7b, 0x6f, 0x46, 0x2b, 0x1f, 0x1f, 0x29, 0x27, 0x2e,
-    0x47, 0x55, 0x53, 0x3d, 0xc4, 0xfc, 0xf3, 0xed, 0xdb, 0xcd, 0xb3, 0xb3,
-    0xad, 0xb3, 0x98, 0x91, 0x7e, 0xa1, 0xa1, 0x7e, 0x7b, 0xa1, 0x81, 0x81,
-    0x6a, 0x80, 0x80, 0x6e, 0x6d, 0x69, 0x80, 0x80, 0x9d, 0x9d, 0x9f, 0x86,
-    0x87, 0x80, 0x4e, 0x4f, 0x6e, 0x9e, 0xb9, 0xb2, 0xa2, 0xb2, 0x9a, 0x86,
-    0x60, 0x2e, 0x33, 0x2a, 0x1e, 0x1c, 0x0a, 0x08, 0x09, 0x05, 0x03, 0x0b,
-    0x80, 0xb7, 0x8c, 0x75, 0x61, 0x54, 0x56, 0xb2, 0xac, 0xac, 0xd3, 0xd4,
-    0xba, 0xba, 0xae, 0xd5, 0xce, 0xba, 0xba, 0xd3, 0xd2, 0xd5, 0xd5, 0xce,
-    0xbc, 0xaa, 0xbe, 0xa3, 0xa2, 0x97, 0x98, 0x91, 0x9f, 0x7b, 0x63, 0x63,
-    0x58, 0x75, 0x86, 0x91, 0x9f, 0x9f, 0x9f, 0x86, 0x75, 0x8c, 0x91, 0x6f,
-    0x6f, 0x81, 0x6d, 0x4c, 0x4a, 0x5e, 0x5e, 0x5e, 0x5e, 0x54, 0x36, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x2a, 0x2d, 0x3e, 0x47, 0x55, 0x54,
-    0x46, 0x36, 0x2b, 0x1f, 0x19, 0x0d, 0x19, 0x2b, 0x2b, 0x27, 0x2e, 0x3e,
-    0x3e, 0x2d, 0x2b, 0x31, 0x34, 0x22, 0x0a, 0x07, 0x0a, 0x0a, 0x10, 0x1f,
-    0x43, 0x58, 0x84, 0x8c, 0x85, 0x84, 0x8c, 0x86, 0x58, 0x44, 0x6b, 0x87,
-    0x7d, 0x7d, 0x9d, 0x7d, 0x7d, 0x8c, 0xa5, 0xb1, 0xb2, 0xae, 0xae, 0x9f,
-    0xbe, 0xd3, 0x91, 0x6c, 0x57, 0x57, 0x8c, 0x93, 0xa5, 0xa6, 0xa6, 0x94,
-    0x8c, 0x82, 0x82, 0x9f, 0xb2, 0xa2, 0x9a, 0x9f, 0x8c, 0xaa, 0xaa, 0xa8,
-    0x8c, 0x8c, 0xb1, 0xaa, 0xb1, 0xcf, 0xcc, 0xcf, 0xce, 0xce, 0xe1, 0xe5,
-    0xf1, 0xf4, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xe5, 0xe4, 0xe1, 0xe1,
-    0xcc, 0xbb, 0xaa, 0x8c, 0x85, 0x85, 0x85, 0x6c, 0x6c, 0x75, 0x74, 0x74,
-    0x6b, 0x6b, 0x84, 0x97, 0x94, 0x7f, 0x72, 0x72, 0x85, 0x97, 0xa5, 0xa5,
-    0x88, 0x72, 0x75, 0x87, 0x9a, 0xb1, 0xbb, 0xb2, 0xb9, 0xbd, 0xbd, 0x90,
-    0x7d, 0xb1, 0xce, 0xcf, 0xe1, 0xf0, 0xf3, 0xe4, 0xd3, 0x9f, 0x86, 0xa0,
-    0xba, 0xba, 0xb7, 0xd3, 0xe3, 0xd1, 0xd3, 0xce, 0xac, 0x98, 0x7b, 0x91,
-    0x91, 0x83, 0x73, 0x63, 0x4a, 0x2f, 0x6d, 0xba, 0xd1, 0xd0, 0xac, 0xa3,
-    0x74, 0x54, 0x47, 0x1f, 0x1b, 0x1f, 0x40, 0x64, 0x78, 0x86, 0x77, 0x64,
-    0xe4, 0xf2, 0xfa, 0xea, 0xdb, 0xb3, 0xad, 0x8e, 0x8e, 0x96, 0x98, 0x7b,
-    0x7b, 0xa1, 0x7e, 0x81, 0x7b, 0x7b, 0x7e, 0x7e, 0x81, 0x80, 0x8f, 0x80,
-    0x6d, 0x6e, 0x80, 0x9d, 0x9d, 0x80, 0x81, 0x80, 0x6e, 0x52, 0x35, 0x4f,
-    0x67, 0x90, 0xb9, 0xa0, 0x9f, 0x8c, 0x84, 0x72, 0x51, 0x2b, 0x3c, 0x26,
-    0x1c, 0x12, 0x0c, 0x0c, 0x08, 0x08, 0x08, 0x20, 0xa0, 0xac, 0x84, 0x74,
-    0x63, 0x54, 0x69, 0xa0, 0xa3, 0xae, 0xe3, 0xe3, 0xd1, 0xae, 0xac, 0xcc,
-    0xbe, 0xba, 0xd3, 0xbe, 0xac, 0xbb, 0xce, 0xd1, 0xbe, 0xaa, 0xac, 0xa2,
-    0xac, 0xa3, 0x91, 0x91, 0x91, 0x7b, 0x61, 0x54, 0x50, 0x6b, 0x75, 0x91,
-    0x9f, 0x9f, 0xa0, 0x81, 0x6f, 0x75, 0x6f, 0x5e, 0x77, 0x9d, 0xa0, 0x5e,
-    0x46, 0x3a, 0x46, 0x5e, 0x5e, 0x46, 0x2b, 0x02, 0x00, 0x00, 0x00, 0x02,
-    0x04, 0x05, 0x12, 0x28, 0x2e, 0x46, 0x55, 0x47, 0x47, 0x29, 0x1f, 0x19,
-    0x13, 0x03, 0x0c, 0x19, 0x1a, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x28, 0x31,
-    0x31, 0x20, 0x0a, 0x08, 0x0b, 0x0a, 0x14, 0x1f, 0x3a, 0x50, 0x6b, 0x74,
-    0x74, 0x84, 0x84, 0x75, 0x50, 0x60, 0x6b, 0x8c, 0x9d, 0x90, 0x90, 0x80,
-    0x7d, 0x82, 0x88, 0xaa, 0xa3, 0x98, 0x73, 0x7b, 0x98, 0xa2, 0x8c, 0x61,
-    0x37, 0x44, 0x75, 0x82, 0x7f, 0x7c, 0x7f, 0x71, 0x85, 0x77, 0x86, 0xaa,
-    0x8c, 0x97, 0xa2, 0xa0, 0x9f, 0x86, 0x71, 0x94, 0x8c, 0x9a, 0xb2, 0x9a,
-    0xb2, 0xb2, 0xcf, 0xcf, 0xcf, 0xce, 0xcf, 0xf0, 0xf2, 0xec, 0xf1, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xe5, 0xe5, 0xe4, 0xe3, 0xcf, 0xb1, 0xbc, 0xa2,
-    0x86, 0x86, 0x86, 0x77, 0x77, 0x6c, 0x6b, 0x6b, 0x5a, 0x5a, 0x74, 0x71,
-    0x71, 0x71, 0x74, 0x74, 0x72, 0x7f, 0x7f, 0x7f, 0x7c, 0x72, 0x6c, 0x86,
-    0x8c, 0xa2, 0xaa, 0xb4, 0xbd, 0xbd, 0xbd, 0x90, 0x9b, 0xbe, 0xd5, 0xd5,
-    0xcf, 0xf0, 0xf3, 0xe3, 0xce, 0xae, 0xa0, 0xd4, 0xe4, 0xe3, 0xd1, 0xd3,
-    0xd2, 0xd1, 0xe3, 0xe1, 0xb7, 0x91, 0x7b, 0x61, 0x7b, 0x84, 0x63, 0x5e,
-    0x55, 0x6d, 0xa1, 0xd1, 0xd9, 0xb6, 0xa6, 0x96, 0x6b, 0x58, 0x46, 0x1f,
-    0x19, 0x24, 0x7e, 0x9f, 0xa2, 0xa2, 0x8c, 0x9d, 0xec, 0xf2, 0xee, 0xea,
-    0xcd, 0xb3, 0x8e, 0x96, 0x83, 0x83, 0x7b, 0x7b, 0x61, 0x7e, 0x7b, 0x6f,
-    0x7e, 0x69, 0x6f, 0x7b, 0x7e, 0x80, 0x6a, 0x7e, 0x81, 0x80, 0x81, 0xa0,
-    0x9f, 0x81, 0x6e, 0x59, 0x5d, 0x5d, 0x59, 0x9e, 0x6e, 0x6e, 0x80, 0x8f,
-    0x80, 0x77, 0x6b, 0x58, 0x46, 0x33, 0x3c, 0x15, 0x16, 0x0d, 0x0a, 0x0c,
-    0x08, 0x0a, 0x0a, 0x2a, 0x86, 0x97, 0x74, 0x75, 0x61, 0x4a, 0x6e, 0x6e,
-    0xa1, 0xd3, 0xe3, 0xd3, 0xba, 0xb7, 0xae, 0xbc, 0xd1, 0xd1, 0xce, 0xbc,
-    0xbe, 0xae, 0xcf, 0xd3, 0xbe, 0x97, 0xa3, 0x91, 0xa3, 0xa3, 0x9f, 0x7e,
-    0x61, 0x75, 0x6f, 0x54, 0x43, 0x58, 0x58, 0x6b, 0x74, 0x75, 0x77, 0x77,
-    0x78, 0x77, 0x78, 0x78, 0x81, 0xa0, 0x9f, 0x7e, 0x40, 0x36, 0x3e, 0x55,
-    0x55, 0x36, 0x19, 0x00, 0x00, 0x00, 0x03, 0x06, 0x03, 0x05, 0x0c, 0x1e,
-    0x29, 0x2e, 0x3a, 0x3a, 0x2e, 0x1f, 0x19, 0x0b, 0x03, 0x00, 0x02, 0x08,
-    0x0d, 0x0d, 0x14, 0x14, 0x1b, 0x1f, 0x2d, 0x3d, 0x33, 0x0a, 0x05, 0x0b,
-    0x0c, 0x07, 0x1b, 0x1d, 0x2e, 0x32, 0x43, 0x58, 0x58, 0x58, 0x74, 0x51,
-    0x57, 0x72, 0x68, 0x86, 0xd4, 0xe5, 0xb9, 0x90, 0x7d, 0x72, 0x70, 0x71,
-    0x66, 0x63, 0x61, 0x54, 0x74, 0x9f, 0x75, 0x50, 0x55, 0x69, 0x51, 0x6b,
-    0x4b, 0x72, 0x5a, 0x75, 0x87, 0xb4, 0x9f, 0x9a, 0x85, 0x82, 0x8c, 0xa2,
-    0x9f, 0x87, 0x74, 0x88, 0xa8, 0xaa, 0xb1, 0x8c, 0xaa, 0xb1, 0xaa, 0xaa,
-    0xbe, 0xcc, 0xcf, 0xcf, 0xe3, 0xe4, 0xe5, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xf1, 0xec, 0xe5, 0xe4, 0xe1, 0xcc, 0xbc, 0xaa, 0x85, 0x86, 0x9f, 0x91,
-    0x86, 0x6c, 0x5a, 0x53, 0x53, 0x53, 0x58, 0x58, 0x57, 0x58, 0x58, 0x51,
-    0x50, 0x58, 0x68, 0x68, 0x68, 0x58, 0x58, 0x75, 0x85, 0x86, 0x9b, 0xb9,
-    0xbd, 0xbd, 0xbd, 0x90, 0x9b, 0xc6, 0xc6, 0xb5, 0xcc, 0xee, 0xee, 0xe0,
-    0xc6, 0xb7, 0xd4, 0xf3, 0xf3, 0xee, 0xe0, 0xc6, 0xbb, 0xbe, 0xf0, 0xe3,
-    0xd3, 0xa1, 0x6f, 0x6f, 0x7e, 0x7b, 0x7e, 0x80, 0x6d, 0x69, 0xa1, 0xd1,
-    0xd5, 0xb6, 0x94, 0x94, 0x71, 0x4b, 0x2c, 0x1f, 0x1b, 0x48, 0x87, 0xaa,
-    0xbb, 0xa5, 0x7f, 0xa0, 0xf2, 0xf3, 0xee, 0xdf, 0xde, 0xb3, 0x96, 0x83,
-    0x73, 0x7b, 0x7e, 0x7b, 0x63, 0x6d, 0x6d, 0x4d, 0x6d, 0x6e, 0x6d, 0x6d,
-    0x6d, 0x6a, 0x6f, 0x87, 0x86, 0x77, 0x80, 0x80, 0x87, 0x81, 0x8f, 0x59,
-    0x59, 0x9e, 0x9e, 0x90, 0x8f, 0x6e, 0x6a, 0x80, 0x6d, 0x6f, 0x54, 0x54,
-    0x3a, 0x2d, 0x2a, 0x19, 0x0a, 0x0b, 0x0b, 0x08, 0x08, 0x0a, 0x0a, 0x2a,
-    0x61, 0x74, 0x75, 0x58, 0x4d, 0x6d, 0x6e, 0x52, 0xa1, 0xe3, 0xe3, 0xa1,
-    0xa1, 0xa1, 0x7e, 0xa1, 0xb4, 0xd2, 0xce, 0xd3, 0xd3, 0xd3, 0xd2, 0xcf,
-    0xbc, 0xa2, 0x91, 0x74, 0x84, 0x74, 0x77, 0x6f, 0x4d, 0x61, 0x78, 0x54,
-    0x50, 0x5a, 0x61, 0x54, 0x61, 0x6c, 0x6f, 0x77, 0x78, 0x77, 0x87, 0x7d,
-    0x81, 0x91, 0xa3, 0x9f, 0x64, 0x3e, 0x3e, 0x4a, 0x4a, 0x40, 0x0b, 0x00,
-    0x00, 0x03, 0x06, 0x06, 0x05, 0x05, 0x05, 0x0d, 0x19, 0x19, 0x1f, 0x27,
-    0x1f, 0x0d, 0x08, 0x05, 0x03, 0x02, 0x00, 0x06, 0x0b, 0x07, 0x12, 0x19,
-    0x19, 0x1e, 0x2b, 0x2d, 0x1c, 0x05, 0x05, 0x08, 0x0a, 0x07, 0x10, 0x1d,
-    0x27, 0x2c, 0x32, 0x43, 0x50, 0x6c, 0x75, 0x60, 0x51, 0x51, 0x4b, 0x85,
-    0xd2, 0xe4, 0xd3, 0x9d, 0x7d, 0x7a, 0x7a, 0x72, 0x58, 0x63, 0x77, 0x77,
-    0x74, 0x74, 0x6c, 0x47, 0x75, 0x87, 0x55, 0x47, 0x44, 0x78, 0x87, 0x9b,
-    0xb4, 0xb4, 0xa0, 0x9a, 0x9f, 0xb2, 0xaa, 0xaf, 0xa2, 0x7a, 0x50, 0x71,
-    0xa5, 0xb1, 0x9a, 0x84, 0x84, 0xa2, 0xb1, 0xae, 0xae, 0xb1, 0xbb, 0xce,
-    0xe1, 0xe4, 0xe4, 0xf1, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf1, 0xf1, 0xec, 0xf3,
-    0xdd, 0xcc, 0xbb, 0xaa, 0x8c, 0xac, 0xbc, 0xbc, 0x8c, 0x6b, 0x45, 0x45,
-    0x5e, 0x61, 0x58, 0x50, 0x51, 0x44, 0x37, 0x30, 0x44, 0x50, 0x50, 0x4b,
-    0x58, 0x4b, 0x51, 0x6c, 0x77, 0x7d, 0xbd, 0xc4, 0xbd, 0xbd, 0xbd, 0x90,
-    0x9b, 0xb8, 0xb5, 0xab, 0xb1, 0xe0, 0xed, 0xd7, 0xc9, 0xd2, 0xf3, 0xfa,
-    0xee, 0xed, 0xd9, 0xb5, 0x9c, 0xa2, 0xe1, 0xe3, 0xb4, 0x91, 0x61, 0xa1,
-    0xae, 0x91, 0x7b, 0x81, 0x61, 0x54, 0x9f, 0xbc, 0xb6, 0xad, 0x8e, 0x76,
-    0x71, 0x50, 0x2e, 0x1f, 0x1f, 0x48, 0x86, 0xbb, 0xbb, 0xa6, 0x76, 0x86,
-    0xfc, 0xf3, 0xee, 0xdf, 0xd5, 0xbc, 0x98, 0x83, 0x7b, 0x63, 0x7b, 0x6f,
-    0x61, 0x6d, 0x4c, 0x55, 0x55, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x69, 0x86,
-    0x86, 0x81, 0x6e, 0x80, 0x69, 0x6a, 0x6d, 0x4e, 0x80, 0x90, 0x9d, 0xa0,
-    0x7d, 0x7d, 0x6a, 0x4c, 0x4a, 0x4a, 0x46, 0x4a, 0x40, 0x24, 0x19, 0x16,
-    0x08, 0x0c, 0x06, 0x03, 0x08, 0x0a, 0x0d, 0x1b, 0x56, 0x61, 0x6f, 0x5e,
-    0x4a, 0x4a, 0x6a, 0xa0, 0x9f, 0xce, 0xe0, 0xae, 0x7e, 0x7b, 0x8f, 0xb9,
-    0xba, 0xce, 0xce, 0xd3, 0xd1, 0xbe, 0xbc, 0xbb, 0xc6, 0xaa, 0x91, 0x75,
-    0x63, 0x6b, 0x61, 0x7b, 0x5e, 0x54, 0x5e, 0x54, 0x4d, 0x61, 0x78, 0x6f,
-    0x5e, 0x5e, 0x77, 0x78, 0x77, 0x85, 0xa2, 0x9f, 0x86, 0x85, 0x8c, 0x91,
-    0x4c, 0x2f, 0x40, 0x48, 0x3e, 0x2f, 0x09, 0x00, 0x02, 0x03, 0x06, 0x09,
-    0x09, 0x08, 0x0c, 0x0a, 0x12, 0x0d, 0x0c, 0x19, 0x19, 0x0a, 0x0c, 0x0c,
-    0x08, 0x05, 0x02, 0x00, 0x03, 0x08, 0x0c, 0x13, 0x0a, 0x0d, 0x12, 0x0a,
-    0x05, 0x08, 0x05, 0x08, 0x0a, 0x0a, 0x10, 0x1e, 0x1f, 0x27, 0x3a, 0x2e,
-    0x43, 0x50, 0x44, 0x37, 0x60, 0x67, 0x64, 0x97, 0xbb, 0xcf, 0xbb, 0xaa,
-    0x85, 0x6c, 0x72, 0x6b, 0x50, 0x58, 0x86, 0x6c, 0x43, 0x43, 0x86, 0x9d,
-    0x87, 0xa0, 0x9d, 0x7d, 0x60, 0x8c, 0x87, 0xa2, 0xb2, 0xb2, 0x9a, 0x86,
-    0xa2, 0xb1, 0x97, 0x83, 0x83, 0x6b, 0x51, 0x5a, 0x75, 0x9a, 0x9a, 0x86,
-    0x85, 0x97, 0xd2, 0xd2, 0x9f, 0x8c, 0xaa, 0xc6, 0xce, 0xce, 0xe1, 0xe5,
-    0xf1, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf1, 0xec, 0xf0, 0xdd, 0xc6, 0xbc, 0xbb,
-    0xac, 0xbe, 0xbc, 0xaf, 0x83, 0x6b, 0x51, 0x6f, 0x7b, 0x91, 0x74, 0x5a,
-    0x46, 0x2e, 0x28, 0x2e, 0x46, 0x51, 0x5a, 0x51, 0x4b, 0x44, 0x44, 0x53,
-    0x64, 0x90, 0xc7, 0xe5, 0xbd, 0xbd, 0x90, 0x90, 0x9a, 0x93, 0x9c, 0x88,
-    0xa8, 0xdc, 0xd9, 0xc9, 0xb8, 0xe3, 0xfa, 0xfa, 0xeb, 0xdc, 0xd9, 0xb5,
-    0x94, 0xa2, 0xe1, 0xe1, 0xce, 0x97, 0x91, 0xae, 0xb7, 0xa3, 0x91, 0x75,
-    0x63, 0x43, 0x77, 0xa3, 0x96, 0x94, 0x8e, 0x71, 0x58, 0x43, 0x2e, 0x29,
-    0x2f, 0x64, 0x8c, 0xaa, 0xa6, 0x8a, 0x7c, 0x87, 0xfc, 0xfc, 0xee, 0xe0,
-    0xd1, 0xbc, 0x98, 0x7b, 0xa1, 0x63, 0x4d, 0x5e, 0x4c, 0x6d, 0x52, 0x4a,
-    0x4a, 0x6d, 0x6d, 0x52, 0x52, 0x4c, 0x69, 0x6a, 0x7e, 0x6a, 0x6d, 0x52,
-    0x4c, 0x52, 0x3f, 0x35, 0x6e, 0x8f, 0x9d, 0xa0, 0xa0, 0x86, 0x64, 0x40,
-    0x40, 0x36, 0x4a, 0x36, 0x2b, 0x21, 0x16, 0x15, 0x08, 0x09, 0x05, 0x05,
-    0x08, 0x0c, 0x0d, 0x10, 0x2d, 0x47, 0x54, 0x4c, 0x80, 0x8f, 0xba, 0xb4,
-    0xa0, 0xbe, 0xbc, 0xac, 0xa1, 0xa1, 0x8f, 0xb9, 0xd3, 0xac, 0xbc, 0xce,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xac, 0x91, 0x75, 0x63, 0x6b, 0x6c, 0x87,
-    0x81, 0x46, 0x46, 0x4d, 0x54, 0x6f, 0x7e, 0x7e, 0x69, 0x6f, 0x77, 0x75,
-    0x6c, 0x84, 0xa2, 0x91, 0x6b, 0x74, 0x84, 0x75, 0x4a, 0x2f, 0x2f, 0x2b,
-    0x2b, 0x22, 0x02, 0x00, 0x00, 0x02, 0x05, 0x05, 0x08, 0x0c, 0x12, 0x0d,
-    0x12, 0x0c, 0x0d, 0x19, 0x19, 0x19, 0x1c, 0x0d, 0x0c, 0x0b, 0x03, 0x00,
-    0x00, 0x02, 0x02, 0x03, 0x03, 0x05, 0x05, 0x03, 0x05, 0x08, 0x05, 0x03,
-    0x0a, 0x13, 0x12, 0x14, 0x1f, 0x27, 0x2e, 0x2e, 0x23, 0x2c, 0x2e, 0x37,
-    0x71, 0xaa, 0xb2, 0xbe, 0xaa, 0xce, 0xb2, 0x8c, 0x66, 0x57, 0x4b, 0x58,
-    0x50, 0x50, 0x75, 0x46, 0x44, 0x7a, 0x9a, 0xcc, 0xb2, 0xcf, 0xb2, 0x87,
-    0x5a, 0x72, 0x82, 0xaa, 0xcf, 0xbe, 0xa2, 0x6c, 0x74, 0x72, 0x73, 0x6b,
-    0x58, 0x54, 0x56, 0x6e, 0x9d, 0x8c, 0x8c, 0x8c, 0x85, 0xa2, 0xb1, 0xbb,
-    0x85, 0x8c, 0xa2, 0x97, 0xac, 0xac, 0xbb, 0xd3, 0xf2, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xf4, 0xf4, 0xec, 0xf0, 0xcf, 0xc6, 0xce, 0xbe, 0xac, 0xac, 0xaa, 0x97,
-    0x7f, 0x6b, 0x6c, 0x91, 0xac, 0xa3, 0x84, 0x6b, 0x51, 0x2e, 0x2d, 0x47,
-    0x6f, 0x77, 0x61, 0x5a, 0x44, 0x30, 0x30, 0x45, 0x6e, 0xc4, 0xc7, 0xe5,
-    0xbd, 0xbd, 0x90, 0x90, 0x82, 0x7c, 0x7c, 0x7c, 0x93, 0xcc, 0xd5, 0xc9,
-    0xbb, 0xe3, 0xfa, 0xf7, 0xe7, 0xd5, 0xca, 0xab, 0x93, 0xa3, 0xce, 0xe1,
-    0xd1, 0xbe, 0xac, 0xbe, 0xd0, 0xaf, 0x96, 0x73, 0x58, 0x58, 0x61, 0x75,
-    0x97, 0x83, 0x71, 0x66, 0x43, 0x46, 0x2e, 0x2f, 0x2b, 0x47, 0x84, 0x94,
-    0x9c, 0x8a, 0x84, 0xd4, 0xf2, 0xfc, 0xf3, 0xe3, 0xd1, 0xbe, 0xac, 0x84,
-    0x7b, 0x61, 0x54, 0x69, 0x6d, 0x4c, 0x52, 0x40, 0x4c, 0x52, 0x4c, 0x4c,
-    0x52, 0x33, 0x4c, 0x6d, 0x69, 0x4c, 0x4a, 0x35, 0x35, 0x35, 0x35, 0x35,
-    0x52, 0x6e, 0x81, 0x86, 0x86, 0x74, 0x5e, 0x35, 0x2f, 0x2f, 0x24, 0x24,
-    0x19, 0x16, 0x16, 0x19, 0x0c, 0x11, 0x11, 0x06, 0x0c, 0x0c, 0x0d, 0x12,
-    0x19, 0x1f, 0x36, 0x4c, 0xb9, 0xd4, 0xd3, 0xb7, 0xa3, 0xa3, 0xac, 0xac,
-    0x91, 0x91, 0xba, 0xd3, 0xb1, 0xaa, 0xa3, 0xae, 0xac, 0xa6, 0xa6, 0xaf,
-    0xa3, 0x91, 0x9f, 0x7b, 0x63, 0x63, 0x58, 0x6f, 0x6f, 0x46, 0x46, 0x55,
-    0x55, 0x5a, 0x61, 0x69, 0x81, 0x64, 0x61, 0x6c, 0x77, 0x75, 0x84, 0x75,
-    0x6f, 0x61, 0x63, 0x63, 0x36, 0x2b, 0x1f, 0x2a, 0x1b, 0x0a, 0x00, 0x00,
-    0x00, 0x02, 0x03, 0x09, 0x0c, 0x0a, 0x0d, 0x0d, 0x19, 0x19, 0x19, 0x19,
-    0x1b, 0x1f, 0x1e, 0x1c, 0x13, 0x08, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x08, 0x0a, 0x0a,
-    0x28, 0x1d, 0x1a, 0x1d, 0x2e, 0x51, 0x2e, 0x27, 0x58, 0x71, 0x93, 0xaf,
-    0xaa, 0xaa, 0xbe, 0x9f, 0x58, 0x32, 0x32, 0x6b, 0x6c, 0x44, 0x3a, 0x2e,
-    0x44, 0x8c, 0xaa, 0xb8, 0xc6, 0xcc, 0xcf, 0x9f, 0x64, 0x37, 0x71, 0x88,
-    0xa5, 0xa5, 0x84, 0x54, 0x3a, 0x44, 0x61, 0x3a, 0x37, 0x60, 0x9d, 0xb4,
-    0x87, 0x6c, 0x72, 0x7a, 0x71, 0x94, 0xa6, 0x93, 0x8c, 0xae, 0xae, 0xac,
-    0xae, 0xac, 0xbb, 0xd2, 0xe5, 0xf1, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf1, 0xec, 0xe4,
-    0xdd, 0xcf, 0xd1, 0xce, 0xaa, 0x8c, 0x8c, 0x98, 0x84, 0x6c, 0x75, 0xa3,
-    0xbc, 0xa6, 0x7f, 0x68, 0x51, 0x30, 0x55, 0x7b, 0x91, 0x91, 0x85, 0x6b,
-    0x51, 0x45, 0x3d, 0x4f, 0x9e, 0xc7, 0xf2, 0xe5, 0xbd, 0xbd, 0xbd, 0x9b,
-    0x7a, 0x72, 0x82, 0x82, 0x82, 0xa2, 0xbb, 0xbb, 0xbb, 0xe1, 0xee, 0xed,
-    0xda, 0xc1, 0xab, 0x9c, 0x94, 0x7f, 0x82, 0xb4, 0xd4, 0xd2, 0xbb, 0xbb,
-    0xbc, 0xa6, 0x94, 0x7f, 0x71, 0x50, 0x63, 0x58, 0x50, 0x58, 0x6b, 0x50,
-    0x2c, 0x23, 0x2b, 0x35, 0x2b, 0x40, 0x61, 0x7f, 0x7f, 0x7f, 0x7a, 0xba,
-    0xec, 0xfc, 0xf3, 0xe3, 0xce, 0xbc, 0xbe, 0x91, 0x7b, 0x61, 0x55, 0x6d,
-    0x6d, 0x4a, 0x4c, 0x2f, 0x52, 0x52, 0x4c, 0x4a, 0x52, 0x6e, 0x4a, 0x4c,
-    0x4c, 0x52, 0x52, 0x35, 0x4e, 0x52, 0x52, 0x35, 0x4a, 0x4c, 0x69, 0x6f,
-    0x74, 0x63, 0x5e, 0x33, 0x25, 0x26, 0x22, 0x16, 0x19, 0x16, 0x25, 0x22,
-    0x25, 0x41, 0x41, 0x11, 0x15, 0x15, 0x0a, 0x0d, 0x0d, 0x21, 0x1f, 0x80,
-    0xd3, 0xd2, 0xd3, 0xac, 0x84, 0x86, 0xa3, 0xac, 0x91, 0x91, 0xb2, 0xce,
-    0xc6, 0x91, 0xa0, 0xba, 0xac, 0x96, 0x96, 0x8c, 0x91, 0x9f, 0x9f, 0x86,
-    0x61, 0x54, 0x54, 0x54, 0x69, 0x6a, 0x64, 0x55, 0x4e, 0x46, 0x54, 0x6f,
-    0x7e, 0x6f, 0x5e, 0x77, 0x7e, 0x6f, 0x6b, 0x6c, 0x5e, 0x55, 0x54, 0x53,
-    0x2b, 0x2b, 0x2f, 0x19, 0x0c, 0x0c, 0x03, 0x00, 0x02, 0x03, 0x05, 0x08,
-    0x0a, 0x13, 0x0c, 0x0a, 0x12, 0x19, 0x1e, 0x1f, 0x1f, 0x2b, 0x1f, 0x1e,
-    0x12, 0x0b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x02, 0x00,
-    0x02, 0x05, 0x05, 0x02, 0x00, 0x02, 0x08, 0x0a, 0x14, 0x14, 0x14, 0x1a,
-    0x1d, 0x30, 0x28, 0x27, 0x75, 0x72, 0x93, 0x97, 0xaf, 0xaa, 0x97, 0x84,
-    0x6c, 0x53, 0x2c, 0x32, 0x44, 0x49, 0x81, 0x78, 0x60, 0x6b, 0x94, 0xbb,
-    0xcf, 0xcc, 0xaa, 0x86, 0x53, 0x51, 0x58, 0x71, 0x71, 0x71, 0x58, 0x51,
-    0x2a, 0x29, 0x3e, 0x55, 0x56, 0x60, 0x75, 0x72, 0x4b, 0x4b, 0x68, 0x6b,
-    0x57, 0x70, 0x7f, 0x73, 0x84, 0x8c, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xcc,
-    0xd4, 0xf1, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf4,
-    0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xec, 0xe4, 0xdd, 0xdd, 0xe0, 0xd5,
-    0xaa, 0x85, 0x91, 0x91, 0x75, 0x6c, 0x77, 0x8c, 0x97, 0x94, 0x71, 0x6b,
-    0x51, 0x55, 0x6f, 0x91, 0xac, 0xaf, 0x94, 0x71, 0x58, 0x45, 0x56, 0x9e,
-    0xc4, 0xe5, 0xf2, 0xe5, 0xbd, 0xbd, 0x90, 0x9b, 0x7a, 0x7a, 0x8c, 0x82,
-    0x82, 0x82, 0x93, 0xa2, 0xaa, 0xcf, 0xe9, 0xe7, 0xc1, 0xa7, 0xa7, 0x8a,
-    0x7c, 0x70, 0x57, 0x87, 0xb4, 0xbe, 0xaa, 0xbc, 0xbc, 0xaf, 0x96, 0x7f,
-    0x71, 0x58, 0x43, 0x3a, 0x47, 0x61, 0x50, 0x43, 0x46, 0x2e, 0x27, 0x28,
-    0x1a, 0x1d, 0x51, 0x6b, 0x87, 0xb9, 0xb9, 0xe5, 0xec, 0xfc, 0xf0, 0xe1,
-    0xdc, 0xaf, 0xac, 0xa3, 0x63, 0x63, 0x46, 0x4c, 0x6d, 0x52, 0x52, 0x3f,
-    0x3f, 0x52, 0x4a, 0x40, 0x52, 0x52, 0x35, 0x4c, 0x56, 0x4e, 0x6d, 0x52,
-    0x52, 0x6a, 0x4c, 0x40, 0x2f, 0x4a, 0x4c, 0x69, 0x5e, 0x54, 0x55, 0x35,
-    0x25, 0x18, 0x18, 0x16, 0x12, 0x25, 0x3f, 0x3f, 0x6e, 0x8f, 0x8f, 0x6e,
-    0x6e, 0x22, 0x0c, 0x13, 0x0a, 0x0c, 0x1c, 0x9d, 0xd1, 0xce, 0xbc, 0x96,
-    0x91, 0x91, 0x74, 0x7e, 0xa1, 0xa1, 0xbe, 0xd9, 0xbb, 0xa2, 0xa1, 0xba,
-    0xac, 0x84, 0x85, 0x91, 0x9f, 0xa0, 0x86, 0x86, 0x80, 0x69, 0x46, 0x46,
-    0x5e, 0x7e, 0x69, 0x4a, 0x40, 0x44, 0x61, 0x5e, 0x5e, 0x55, 0x55, 0x5a,
-    0x61, 0x5e, 0x54, 0x44, 0x51, 0x44, 0x47, 0x48, 0x40, 0x2a, 0x12, 0x0d,
-    0x12, 0x13, 0x0c, 0x03, 0x06, 0x09, 0x08, 0x08, 0x0a, 0x0c, 0x0c, 0x12,
-    0x19, 0x1f, 0x1f, 0x1f, 0x2b, 0x2d, 0x28, 0x1e, 0x12, 0x08, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x03, 0x02, 0x02, 0x03, 0x08, 0x08, 0x08, 0x05,
-    0x05, 0x05, 0x0b, 0x0a, 0x0a, 0x0d, 0x1b, 0x14, 0x14, 0x10, 0x1a, 0x3e,
-    0x50, 0x68, 0x93, 0xaa, 0xac, 0x84, 0x74, 0x74, 0x58, 0x5a, 0x30, 0x31,
-    0x49, 0x48, 0x60, 0x72, 0x75, 0x72, 0x94, 0xa5, 0xbb, 0xbb, 0x97, 0x85,
-    0x53, 0x2c, 0x51, 0x4b, 0x4b, 0x50, 0x37, 0x3e, 0x4e, 0x34, 0x47, 0x55,
-    0x51, 0x45, 0x2c, 0x37, 0x2c, 0x44, 0x5a, 0x54, 0x43, 0x6c, 0x86, 0xa0,
-    0xa0, 0x9f, 0xa0, 0xa3, 0x84, 0x83, 0x96, 0xaa, 0xbe, 0xe5, 0xf1, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4,
-    0xf4, 0xf1, 0xec, 0xeb, 0xdd, 0xe1, 0xe0, 0xce, 0xaa, 0x85, 0x86, 0x87,
-    0x86, 0x77, 0x77, 0x7b, 0x7f, 0x71, 0x68, 0x58, 0x54, 0x5e, 0x75, 0xa3,
-    0xaf, 0x94, 0x94, 0x71, 0x58, 0x53, 0x6e, 0xc4, 0xbd, 0xe5, 0xf3, 0xe5,
-    0xbd, 0x90, 0x90, 0x9b, 0x9b, 0x9d, 0xb4, 0xb1, 0x93, 0x72, 0x7a, 0x8c,
-    0xa2, 0xb2, 0xdd, 0xd7, 0xc1, 0xa7, 0x8a, 0x8a, 0x76, 0x5b, 0x57, 0x5a,
-    0x60, 0x9a, 0xbe, 0xd1, 0xd1, 0xc6, 0xaf, 0x97, 0x91, 0x75, 0x46, 0x55,
-    0x7b, 0x75, 0x6b, 0x58, 0x4d, 0x39, 0x27, 0x27, 0x1f, 0x28, 0x3e, 0x30,
-    0x8f, 0xec, 0xec, 0xec, 0xfc, 0xfc, 0xfa, 0xee, 0xe1, 0xce, 0xac, 0xa1,
-    0x7e, 0x63, 0x46, 0x4a, 0x52, 0x52, 0x52, 0x4a, 0x3f, 0x3f, 0x52, 0x52,
-    0x35, 0x3f, 0x3f, 0x4c, 0x69, 0x69, 0x6d, 0x52, 0x4c, 0x69, 0x69, 0x4c,
-    0x2f, 0x35, 0x52, 0x4c, 0x4c, 0x4a, 0x40, 0x24, 0x19, 0x16, 0x16, 0x0c,
-    0x19, 0x21, 0x3f, 0x6e, 0x6e, 0x80, 0x81, 0x77, 0x64, 0x33, 0x0c, 0x0c,
-    0x0c, 0x08, 0x0b, 0x9d, 0xd2, 0xce, 0xaf, 0xa3, 0xa3, 0x6b, 0x39, 0x6d,
-    0x6d, 0x7e, 0xa3, 0xbc, 0xaf, 0x97, 0xa1, 0xa1, 0xac, 0xa2, 0x91, 0x91,
-    0xaa, 0xac, 0x8c, 0x7b, 0x7e, 0x5e, 0x47, 0x55, 0x54, 0x54, 0x47, 0x3a,
-    0x3e, 0x43, 0x51, 0x5e, 0x64, 0x55, 0x5e, 0x45, 0x44, 0x55, 0x47, 0x30,
-    0x3e, 0x2e, 0x40, 0x40, 0x2f, 0x22, 0x16, 0x12, 0x19, 0x1e, 0x16, 0x0c,
-    0x0b, 0x15, 0x15, 0x0c, 0x0c, 0x0c, 0x0d, 0x0d, 0x19, 0x24, 0x1f, 0x2b,
-    0x2d, 0x3d, 0x2d, 0x2a, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x03, 0x03, 0x03, 0x08, 0x0a, 0x0a, 0x0c, 0x08, 0x0d, 0x0a, 0x08, 0x08,
-    0x08, 0x05, 0x12, 0x10, 0x0d, 0x0a, 0x14, 0x28, 0x43, 0x68, 0x83, 0x97,
-    0x97, 0x84, 0x74, 0x50, 0x44, 0x3a, 0x28, 0x20, 0x20, 0x28, 0x2e, 0x44,
-    0x7a, 0x68, 0x7f, 0x94, 0x94, 0x94, 0x83, 0x58, 0x3e, 0x28, 0x27, 0x45,
-    0x37, 0x3e, 0x2e, 0x2e, 0x64, 0x56, 0x47, 0x3a, 0x46, 0x47, 0x2e, 0x56,
-    0x67, 0x78, 0x6f, 0x47, 0x45, 0x87, 0xa0, 0xb2, 0xa2, 0xa2, 0xa2, 0x91,
-    0x74, 0x74, 0x73, 0x83, 0xac, 0xe4, 0xf1, 0xf1, 0xf4, 0xf4, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf1, 0xf2, 0xeb,
-    0xdd, 0xe0, 0xdc, 0xc6, 0xa5, 0x82, 0x86, 0xa0, 0x9f, 0x9f, 0x86, 0x75,
-    0x6b, 0x4b, 0x4b, 0x54, 0x54, 0x54, 0x61, 0x84, 0x83, 0x7f, 0x71, 0x68,
-    0x5a, 0x6e, 0x9e, 0xbd, 0xbd, 0xe1, 0xf3, 0xe5, 0xbd, 0x9b, 0x9a, 0x9b,
-    0xb9, 0xe4, 0xe3, 0xdd, 0xb1, 0x82, 0x7a, 0x8c, 0x9a, 0xd2, 0xe3, 0xdc,
-    0xca, 0xab, 0x88, 0x76, 0x70, 0x68, 0x57, 0x4b, 0x4b, 0x7a, 0xb1, 0xe1,
-    0xe0, 0xd9, 0xaa, 0xa2, 0x86, 0x61, 0x44, 0x86, 0xa3, 0x8c, 0x84, 0x73,
-    0x58, 0x43, 0x3a, 0x2e, 0x27, 0x1f, 0x1e, 0x4f, 0xe5, 0xfc, 0xfc, 0xfc,
-    0xfc, 0xfa, 0xf0, 0xf0, 0xe1, 0xd5, 0xbc, 0xa3, 0x91, 0x75, 0x5e, 0x6d,
-    0x6d, 0x36, 0x36, 0x52, 0x3f, 0x21, 0x21, 0x21, 0x35, 0x3f, 0x3f, 0x4c,
-    0x6f, 0x6f, 0x69, 0x4c, 0x4c, 0x64, 0x5e, 0x4a, 0x21, 0x3f, 0x3f, 0x2f,
-    0x52, 0x40, 0x2f, 0x16, 0x15, 0x18, 0x18, 0x18, 0x19, 0x2a, 0x4f, 0x6e,
-    0x80, 0x7e, 0x86, 0x9f, 0x9f, 0x6f, 0x40, 0x22, 0x08, 0x05, 0x0b, 0x9f,
-    0xbc, 0xaf, 0x96, 0x96, 0x73, 0x50, 0x29, 0x6d, 0xa1, 0x87, 0x9f, 0xa3,
-    0xa2, 0x8c, 0x81, 0x9f, 0xbc, 0xaa, 0xa2, 0x97, 0xaa, 0xac, 0x97, 0x73,
-    0x63, 0x4d, 0x5e, 0x64, 0x54, 0x54, 0x47, 0x3e, 0x47, 0x54, 0x54, 0x6f,
-    0x6d, 0x6a, 0x60, 0x45, 0x45, 0x55, 0x47, 0x3e, 0x2e, 0x3d, 0x6a, 0x6a,
-    0x35, 0x13, 0x12, 0x1b, 0x1f, 0x2b, 0x21, 0x16, 0x0a, 0x15, 0x15, 0x16,
-    0x15, 0x0c, 0x12, 0x1c, 0x1c, 0x1e, 0x1f, 0x29, 0x36, 0x2f, 0x2d, 0x1f,
-    0x0d, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x06, 0x08, 0x0c, 0x0c, 0x0a,
-    0x13, 0x12, 0x12, 0x1c, 0x19, 0x12, 0x0a, 0x0a, 0x08, 0x03, 0x05, 0x0a,
-    0x0d, 0x1c, 0x1e, 0x1a, 0x37, 0x4b, 0x66, 0x73, 0x73, 0x66, 0x58, 0x58,
-    0x5e, 0x27, 0x1d, 0x1b, 0x10, 0x2a, 0x2a, 0x30, 0x43, 0x6b, 0x73, 0x71,
-    0x71, 0x66, 0x50, 0x3a, 0x2f, 0x14, 0x14, 0x28, 0x2d, 0x2d, 0x56, 0x64,
-    0x6f, 0x5e, 0x47, 0x2e, 0x3e, 0x3e, 0x3d, 0x67, 0x87, 0x86, 0x5a, 0x2e,
-    0x37, 0x51, 0x85, 0x85, 0x85, 0x85, 0x75, 0x74, 0x6c, 0x61, 0x4d, 0x63,
-    0xa3, 0xe1, 0xf2, 0xec, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf2, 0xf1, 0xf4,
-    0xf4, 0xcb, 0xcb, 0xcb, 0xf1, 0xf2, 0xeb, 0xdd, 0xe1, 0xed, 0xdc, 0xc6,
-    0xa5, 0x8c, 0xae, 0xd1, 0xce, 0xac, 0x91, 0x72, 0x5a, 0x51, 0x51, 0x54,
-    0x44, 0x45, 0x61, 0x63, 0x73, 0x6b, 0x68, 0x6b, 0x67, 0x90, 0xc4, 0xbd,
-    0xcf, 0xe1, 0xf3, 0xf0, 0xb4, 0x9b, 0x9a, 0xb4, 0xe4, 0xf3, 0xeb, 0xdd,
-    0xbb, 0xa2, 0x8c, 0x8c, 0x9b, 0xd2, 0xeb, 0xdd, 0xc9, 0x9c, 0x7c, 0x7c,
-    0x71, 0x68, 0x57, 0x57, 0x42, 0x51, 0xa0, 0xe4, 0xeb, 0xd5, 0xa5, 0x94,
-    0x68, 0x58, 0x6c, 0xae, 0xbe, 0xbc, 0x97, 0x7f, 0x74, 0x6b, 0x5e, 0x45,
-    0x3d, 0x2d, 0x20, 0xe5, 0xfc, 0xfc, 0xfa, 0xfc, 0xfc, 0xf2, 0xf3, 0xf3,
-    0xe3, 0xce, 0xd1, 0xb7, 0x91, 0x74, 0x7b, 0x7e, 0x69, 0x4a, 0x36, 0x5d,
-    0x52, 0x21, 0x35, 0x21, 0x21, 0x3f, 0x3f, 0x4c, 0x5e, 0x5e, 0x6d, 0x52,
-    0x52, 0x4c, 0x4c, 0x52, 0x3f, 0x3c, 0x25, 0x21, 0x25, 0x24, 0x21, 0x25,
-    0x25, 0x3f, 0x25, 0x18, 0x16, 0x35, 0x6e, 0x6e, 0x81, 0x7b, 0x7b, 0xa3,
-    0x91, 0x74, 0x46, 0x19, 0x05, 0x05, 0x05, 0x67, 0xa5, 0x96, 0x83, 0x73,
-    0x6b, 0x43, 0x36, 0x8f, 0xd4, 0xd3, 0xb7, 0x8c, 0x85, 0x86, 0x9f, 0xbe,
-    0xaa, 0x97, 0xa3, 0x8c, 0xa3, 0xbe, 0x97, 0x66, 0x50, 0x39, 0x3a, 0x54,
-    0x5e, 0x47, 0x3e, 0x3e, 0x3e, 0x3e, 0x46, 0x5e, 0x69, 0x6f, 0x5e, 0x45,
-    0x53, 0x6f, 0x56, 0x40, 0x3e, 0x55, 0x7e, 0x81, 0x80, 0x35, 0x19, 0x1f,
-    0x2b, 0x2f, 0x33, 0x20, 0x12, 0x16, 0x16, 0x1c, 0x15, 0x0c, 0x0c, 0x0d,
-    0x12, 0x14, 0x1f, 0x29, 0x2f, 0x2f, 0x2b, 0x19, 0x05, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x09, 0x0a, 0x0a, 0x12, 0x1c, 0x22, 0x21, 0x33, 0x21,
-    0x21, 0x1b, 0x12, 0x12, 0x0c, 0x03, 0x03, 0x08, 0x0d, 0x12, 0x1f, 0x2b,
-    0x37, 0x43, 0x50, 0x50, 0x50, 0x58, 0x58, 0x44, 0x27, 0x27, 0x1a, 0x0a,
-    0x20, 0x2a, 0x2a, 0x28, 0x45, 0x51, 0x50, 0x58, 0x58, 0x50, 0x43, 0x27,
-    0x1b, 0x1c, 0x33, 0x19, 0x1b, 0x2d, 0x78, 0x87, 0x77, 0x77, 0x55, 0x3d,
-    0x1d, 0x29, 0x28, 0x45, 0x53, 0x44, 0x44, 0x2e, 0x3e, 0x3a, 0x5a, 0x7a,
-    0x7a, 0x74, 0x6b, 0x54, 0x54, 0x54, 0x4d, 0x74, 0xb1, 0xdd, 0xeb, 0xf0,
-    0xe5, 0xe4, 0xe1, 0xdd, 0xdd, 0xf0, 0xf2, 0xec, 0xf1, 0xcb, 0xcb, 0xcb,
-    0xf2, 0xf0, 0xdd, 0xd7, 0xdc, 0xea, 0xd7, 0xc9, 0xaf, 0xac, 0xe0, 0xe0,
-    0xd9, 0xbc, 0xa2, 0x72, 0x58, 0x51, 0x51, 0x44, 0x30, 0x3d, 0x47, 0x51,
-    0x5a, 0x5a, 0x6c, 0x7d, 0x90, 0xc4, 0xe5, 0xd2, 0xcf, 0xeb, 0xf0, 0xe3,
-    0xb4, 0x9b, 0x9b, 0xd2, 0xf0, 0xeb, 0xdd, 0xc9, 0xb8, 0xa2, 0x8c, 0x7a,
-    0x9a, 0xd2, 0xe1, 0xdc, 0xb8, 0x9c, 0x88, 0x7c, 0x71, 0x6b, 0x6b, 0x58,
-    0x45, 0x45, 0xb4, 0xf0, 0xdd, 0xca, 0xa6, 0x88, 0x71, 0x6b, 0x86, 0xd1,
-    0xce, 0xca, 0xa6, 0x96, 0xa3, 0xd1, 0xd3, 0xa0, 0x7d, 0x4e, 0x9e, 0xf2,
-    0xfc, 0xfa, 0xf9, 0xf3, 0xf2, 0xf2, 0xf3, 0xf3, 0xeb, 0xdf, 0xbe, 0xb4,
-    0x9f, 0x7b, 0x75, 0x46, 0x3a, 0x4a, 0x4a, 0x59, 0x52, 0x2f, 0x40, 0x52,
-    0x35, 0x3f, 0x3f, 0x52, 0x4c, 0x4c, 0x52, 0x3f, 0x3f, 0x2f, 0x2f, 0x25,
-    0x25, 0x18, 0x25, 0x25, 0x19, 0x25, 0x3f, 0x52, 0x52, 0x52, 0x35, 0x25,
-    0x21, 0x2f, 0x4c, 0x6d, 0x80, 0x7e, 0x7b, 0x85, 0x84, 0x63, 0x46, 0x19,
-    0x05, 0x03, 0x02, 0x20, 0x5a, 0x6b, 0x6b, 0x6b, 0x58, 0x43, 0x69, 0xd4,
-    0xd2, 0xbe, 0xae, 0x8c, 0x75, 0x81, 0x9d, 0xb2, 0xa3, 0x97, 0x84, 0x85,
-    0xa2, 0xac, 0x98, 0x63, 0x4d, 0x4a, 0x36, 0x46, 0x5e, 0x47, 0x46, 0x47,
-    0x47, 0x55, 0x47, 0x44, 0x61, 0x61, 0x5e, 0x5e, 0x6f, 0x77, 0x60, 0x56,
-    0x47, 0x54, 0x77, 0x7e, 0x81, 0x6a, 0x2a, 0x1f, 0x2f, 0x40, 0x33, 0x20,
-    0x12, 0x16, 0x12, 0x1c, 0x12, 0x0c, 0x05, 0x07, 0x0a, 0x0d, 0x14, 0x1b,
-    0x1a, 0x1a, 0x19, 0x0a, 0x05, 0x03, 0x02, 0x00, 0x00, 0x00, 0x02, 0x08,
-    0x13, 0x12, 0x19, 0x1e, 0x2b, 0x1f, 0x2e, 0x40, 0x35, 0x33, 0x2a, 0x2b,
-    0x1e, 0x0a, 0x08, 0x05, 0x05, 0x08, 0x07, 0x10, 0x14, 0x37, 0x3a, 0x43,
-    0x43, 0x3a, 0x3a, 0x37, 0x27, 0x1d, 0x10, 0x1c, 0x34, 0x34, 0x2a, 0x2d,
-    0x45, 0x37, 0x51, 0x51, 0x3a, 0x3a, 0x28, 0x1f, 0x40, 0x4e, 0x4e, 0x52,
-    0x33, 0x3e, 0x51, 0x6b, 0x85, 0x86, 0x55, 0x2b, 0x14, 0x2a, 0x2a, 0x48,
-    0x48, 0x47, 0x3e, 0x47, 0x67, 0x67, 0x48, 0x45, 0x51, 0x51, 0x61, 0x5e,
-    0x46, 0x54, 0x5a, 0x77, 0xd2, 0xdd, 0xdd, 0xd2, 0xd2, 0xcc, 0xcc, 0xc9,
-    0xc9, 0xcf, 0xdd, 0xe4, 0xf2, 0xf1, 0xcb, 0xcb, 0xe5, 0xe1, 0xd7, 0xd7,
-    0xe6, 0xd7, 0xc9, 0xb5, 0xa5, 0xbe, 0xe0, 0xdc, 0xd5, 0xaf, 0x97, 0x84,
-    0x74, 0x58, 0x44, 0x37, 0x30, 0x49, 0x67, 0x64, 0x64, 0x7d, 0xa0, 0xb9,
-    0xe5, 0xf2, 0xfa, 0xeb, 0xeb, 0xeb, 0xf0, 0xe4, 0xd2, 0x9b, 0xb2, 0xd2,
-    0xe1, 0xe0, 0xc6, 0xa5, 0x9c, 0x93, 0x82, 0x82, 0x87, 0xcf, 0xd5, 0xc9,
-    0xa5, 0x88, 0x70, 0x68, 0x4b, 0x60, 0x5a, 0x44, 0x30, 0x48, 0xb4, 0xf0,
-    0xea, 0xca, 0xb6, 0x9c, 0x7f, 0x71, 0x82, 0xbb, 0xd9, 0xc8, 0xa6, 0xae,
-    0xf0, 0xf3, 0xee, 0xe1, 0xd3, 0xc4, 0xf2, 0xfc, 0xfe, 0xfa, 0xf9, 0xee,
-    0xf3, 0xf2, 0xf3, 0xf0, 0xeb, 0xdf, 0xaf, 0xae, 0xba, 0x91, 0x74, 0x54,
-    0x4a, 0x4c, 0x2f, 0x52, 0x4a, 0x36, 0x4a, 0x4a, 0x52, 0x3f, 0x24, 0x2f,
-    0x40, 0x35, 0x3f, 0x25, 0x25, 0x25, 0x25, 0x25, 0x18, 0x0e, 0x18, 0x3f,
-    0x3f, 0x52, 0x6e, 0x8f, 0x80, 0x80, 0x4f, 0x3f, 0x3f, 0x21, 0x35, 0x6d,
-    0x6d, 0x6f, 0x61, 0x63, 0x63, 0x63, 0x46, 0x1e, 0x08, 0x03, 0x02, 0x02,
-    0x08, 0x56, 0x61, 0x54, 0x54, 0x46, 0x5e, 0xb2, 0xce, 0xbc, 0xaf, 0x97,
-    0x75, 0xa1, 0xb9, 0xa1, 0x9f, 0x84, 0x6b, 0x43, 0x86, 0x91, 0x74, 0x7b,
-    0x54, 0x36, 0x36, 0x36, 0x4a, 0x46, 0x54, 0x46, 0x47, 0x4a, 0x47, 0x46,
-    0x54, 0x46, 0x61, 0x5e, 0x75, 0x75, 0x60, 0x55, 0x55, 0x6f, 0x77, 0x86,
-    0x87, 0x69, 0x2b, 0x1f, 0x2f, 0x40, 0x33, 0x21, 0x0a, 0x16, 0x1c, 0x12,
-    0x12, 0x15, 0x08, 0x08, 0x06, 0x05, 0x0a, 0x0a, 0x0d, 0x0d, 0x0c, 0x0c,
-    0x0c, 0x05, 0x03, 0x02, 0x00, 0x00, 0x02, 0x08, 0x0a, 0x0d, 0x1b, 0x2b,
-    0x2f, 0x33, 0x2f, 0x48, 0x4c, 0x69, 0x4c, 0x33, 0x1e, 0x0d, 0x0a, 0x08,
-    0x08, 0x08, 0x05, 0x07, 0x1e, 0x2e, 0x2e, 0x30, 0x2c, 0x2e, 0x1d, 0x27,
-    0x1a, 0x10, 0x26, 0x3c, 0x34, 0x20, 0x2a, 0x3d, 0x45, 0x23, 0x45, 0x3e,
-    0x29, 0x2b, 0x14, 0x2f, 0x5e, 0x69, 0x6a, 0x47, 0x28, 0x3e, 0x55, 0x6c,
-    0x6b, 0x63, 0x3e, 0x1f, 0x1d, 0x31, 0x28, 0x28, 0x48, 0x47, 0x44, 0x55,
-    0x64, 0x64, 0x47, 0x2e, 0x3a, 0x5a, 0x60, 0x47, 0x46, 0x54, 0x60, 0xb4,
-    0xf0, 0xe1, 0xf0, 0xe5, 0xd2, 0xb2, 0xb1, 0xa8, 0xa5, 0xb8, 0xcc, 0xd2,
-    0xe4, 0xe5, 0xf1, 0xc7, 0xe5, 0xdd, 0xc9, 0xda, 0xda, 0xda, 0xca, 0xab,
-    0xa8, 0xcc, 0xdc, 0xd9, 0xca, 0xa6, 0x94, 0x7f, 0x74, 0x58, 0x44, 0x48,
-    0x6a, 0x8f, 0xb4, 0xb4, 0xb9, 0xd4, 0xe4, 0xf3, 0xf2, 0xfc, 0xfa, 0xfa,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xd2, 0xb2, 0xb1, 0xcc, 0xce, 0xbc, 0xa5, 0x94,
-    0x88, 0x7f, 0x71, 0x7a, 0x7a, 0xa2, 0xa8, 0xa5, 0x94, 0x7f, 0x68, 0x57,
-    0x4b, 0x51, 0x45, 0x45, 0x53, 0x60, 0xb2, 0xe1, 0xdc, 0xca, 0xb6, 0x9c,
-    0x88, 0x7c, 0x7c, 0x94, 0xbb, 0xb6, 0xaf, 0xe4, 0xfa, 0xf3, 0xf0, 0xe3,
-    0xd4, 0xd4, 0xf9, 0xfe, 0xfa, 0xf3, 0xfa, 0xee, 0xe3, 0xf2, 0xf2, 0xf0,
-    0xe0, 0xd9, 0xca, 0xac, 0xae, 0x84, 0x74, 0x61, 0x6d, 0x6d, 0x36, 0x52,
-    0x4a, 0x46, 0x55, 0x46, 0x4a, 0x52, 0x24, 0x24, 0x35, 0x3f, 0x3f, 0x25,
-    0x3f, 0x3c, 0x6e, 0x59, 0x41, 0x0e, 0x0e, 0x3f, 0x3c, 0x52, 0x8f, 0x8f,
-    0x80, 0x81, 0x81, 0x52, 0x3f, 0x21, 0x4c, 0x4c, 0x46, 0x5e, 0x54, 0x4d,
-    0x4d, 0x39, 0x36, 0x19, 0x06, 0x03, 0x02, 0x00, 0x02, 0x1c, 0x40, 0x4a,
-    0x4a, 0x29, 0x48, 0xae, 0xce, 0xbb, 0x97, 0x97, 0x75, 0xa1, 0xd4, 0xba,
-    0x9f, 0xa2, 0x58, 0x3a, 0x6f, 0x7e, 0x75, 0x81, 0x6d, 0x55, 0x47, 0x3e,
-    0x46, 0x46, 0x51, 0x54, 0x46, 0x2e, 0x3a, 0x47, 0x46, 0x3a, 0x46, 0x4d,
-    0x58, 0x5a, 0x51, 0x5e, 0x5e, 0x6f, 0x75, 0x75, 0x91, 0x78, 0x2b, 0x1f,
-    0x2b, 0x2f, 0x2a, 0x12, 0x0c, 0x16, 0x1c, 0x16, 0x12, 0x16, 0x15, 0x06,
-    0x04, 0x02, 0x03, 0x05, 0x0c, 0x0a, 0x0c, 0x15, 0x0c, 0x08, 0x05, 0x02,
-    0x00, 0x00, 0x02, 0x0b, 0x0d, 0x12, 0x1b, 0x1f, 0x48, 0x6a, 0x67, 0x64,
-    0x78, 0x6f, 0x5e, 0x61, 0x33, 0x12, 0x07, 0x08, 0x08, 0x08, 0x07, 0x19,
-    0x1f, 0x1f, 0x10, 0x1e, 0x2d, 0x1d, 0x1a, 0x1f, 0x1a, 0x2a, 0x34, 0x34,
-    0x34, 0x20, 0x2a, 0x56, 0x64, 0x3e, 0x3d, 0x29, 0x1b, 0x1b, 0x33, 0x6a,
-    0x46, 0x6f, 0x87, 0x5e, 0x4a, 0x1f, 0x27, 0x44, 0x37, 0x3a, 0x27, 0x2d,
-    0x3d, 0x2d, 0x28, 0x28, 0x53, 0x47, 0x45, 0x23, 0x30, 0x45, 0x44, 0x2c,
-    0x37, 0x53, 0x60, 0x53, 0x5e, 0x60, 0x9a, 0xeb, 0xeb, 0xeb, 0xf0, 0xf0,
-    0xf0, 0xd2, 0x9a, 0xa8, 0x93, 0xcc, 0xdd, 0xcf, 0xd2, 0xe5, 0xe5, 0xe4,
-    0xe5, 0xe1, 0xc9, 0xc8, 0xd8, 0xca, 0xc2, 0xca, 0xbb, 0xce, 0xdc, 0xd5,
-    0xb6, 0x9c, 0x88, 0x71, 0x6b, 0x58, 0x53, 0x6e, 0xd4, 0xe5, 0xf3, 0xe5,
-    0xf2, 0xf3, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xeb, 0xeb,
-    0xd2, 0xd2, 0xce, 0xc6, 0xc6, 0xaa, 0xaa, 0xa2, 0xa2, 0x82, 0x71, 0x72,
-    0x6b, 0x7a, 0x7a, 0x82, 0x82, 0x72, 0x72, 0x58, 0x4b, 0x44, 0x45, 0x60,
-    0x85, 0x7a, 0xa2, 0xce, 0xd5, 0xc9, 0xa5, 0xa6, 0xa2, 0xa2, 0x93, 0x82,
-    0xae, 0xbe, 0xd2, 0xec, 0xf2, 0xfa, 0xf0, 0xf3, 0xd4, 0xd3, 0xee, 0xf9,
-    0xfa, 0xfc, 0xfc, 0xfa, 0xf3, 0xfc, 0xfa, 0xf0, 0xeb, 0xdd, 0xce, 0xd1,
-    0xbe, 0xa3, 0x8c, 0x74, 0x7e, 0x4c, 0x36, 0x6d, 0x6d, 0x4a, 0x55, 0x4a,
-    0x4c, 0x52, 0x52, 0x40, 0x4a, 0x4a, 0x35, 0x22, 0x52, 0x6e, 0x80, 0x6d,
-    0x6e, 0x26, 0x16, 0x3f, 0x52, 0x6e, 0x80, 0x81, 0x7b, 0x86, 0x86, 0x5e,
-    0x35, 0x21, 0x29, 0x29, 0x36, 0x4c, 0x54, 0x54, 0x46, 0x36, 0x21, 0x08,
-    0x03, 0x02, 0x02, 0x00, 0x02, 0x03, 0x08, 0x12, 0x24, 0x2b, 0x3e, 0x75,
-    0xaf, 0xaf, 0x83, 0x83, 0x63, 0xba, 0xd4, 0xd3, 0xbb, 0x91, 0x6b, 0x5a,
-    0x6f, 0xa0, 0x91, 0x81, 0x6d, 0x5e, 0x46, 0x3a, 0x46, 0x3a, 0x46, 0x4c,
-    0x4a, 0x47, 0x46, 0x3e, 0x2e, 0x3a, 0x46, 0x44, 0x44, 0x2e, 0x3e, 0x46,
-    0x61, 0x61, 0x61, 0x74, 0x91, 0x69, 0x1e, 0x1b, 0x1f, 0x1e, 0x12, 0x0c,
-    0x0b, 0x16, 0x16, 0x0c, 0x0d, 0x16, 0x15, 0x06, 0x02, 0x02, 0x05, 0x08,
-    0x0c, 0x12, 0x12, 0x12, 0x16, 0x08, 0x05, 0x03, 0x02, 0x00, 0x00, 0x0b,
-    0x12, 0x10, 0x31, 0x3d, 0x47, 0x5e, 0x5a, 0x6c, 0x61, 0x61, 0x61, 0x46,
-    0x4c, 0x33, 0x0d, 0x0c, 0x08, 0x05, 0x07, 0x21, 0x2b, 0x1f, 0x1e, 0x1b,
-    0x14, 0x1d, 0x2f, 0x1f, 0x1a, 0x1d, 0x28, 0x2a, 0x20, 0x20, 0x31, 0x53,
-    0x64, 0x55, 0x48, 0x36, 0x14, 0x33, 0x69, 0x55, 0x50, 0x75, 0x86, 0x5e,
-    0x36, 0x1f, 0x1f, 0x2e, 0x2e, 0x3e, 0x1d, 0x2d, 0x48, 0x3e, 0x28, 0x28,
-    0x45, 0x3e, 0x2e, 0x23, 0x45, 0x53, 0x55, 0x47, 0x47, 0x55, 0x60, 0x64,
-    0x7d, 0xb4, 0xe1, 0xeb, 0xdd, 0xdd, 0xeb, 0xe1, 0xdd, 0xeb, 0xd2, 0xcf,
-    0xb2, 0xf0, 0xe1, 0xdd, 0xe1, 0xf2, 0xf2, 0xe4, 0xf1, 0xe4, 0xd7, 0xc8,
-    0xc8, 0xc2, 0xc9, 0xc6, 0xcc, 0xdc, 0xdc, 0xc6, 0xa6, 0x88, 0x7c, 0x71,
-    0x75, 0x78, 0x9d, 0xd4, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfa, 0xfa, 0xf0,
-    0xf0, 0xf0, 0xfa, 0xfa, 0xfa, 0xf9, 0xe9, 0xdd, 0xdd, 0xcf, 0xce, 0xc6,
-    0xbb, 0xb2, 0xd3, 0xd2, 0xcc, 0xa8, 0x82, 0x72, 0x6b, 0x57, 0x6c, 0x6c,
-    0x60, 0x7a, 0x7a, 0x6c, 0x58, 0x51, 0x78, 0x91, 0xa2, 0x93, 0x82, 0xa2,
-    0xce, 0xbb, 0xbb, 0xaa, 0xb2, 0xb4, 0xae, 0xb4, 0xc4, 0xd4, 0xc4, 0xf2,
-    0xfc, 0xf3, 0xf0, 0xe4, 0xd4, 0xd3, 0xee, 0xee, 0xee, 0xfc, 0xfc, 0xec,
-    0xf2, 0xfc, 0xfc, 0xee, 0xeb, 0xeb, 0xdd, 0xce, 0xbc, 0xaa, 0x97, 0x84,
-    0x75, 0x55, 0x36, 0x52, 0x4c, 0x4c, 0x69, 0x4c, 0x35, 0x52, 0x52, 0x4a,
-    0x55, 0x4a, 0x35, 0x35, 0x52, 0x6d, 0x69, 0x6f, 0x6d, 0x52, 0x25, 0x3f,
-    0x52, 0x52, 0x80, 0x77, 0x7b, 0x9f, 0x85, 0x6f, 0x2f, 0x19, 0x3f, 0x35,
-    0x36, 0x4a, 0x46, 0x4a, 0x36, 0x2b, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
-    0x05, 0x05, 0x06, 0x15, 0x22, 0x2f, 0x2b, 0x2f, 0x91, 0x84, 0x83, 0x6b,
-    0x61, 0xd3, 0xe1, 0xbc, 0xaa, 0x97, 0x84, 0x58, 0x51, 0x9f, 0xa3, 0x91,
-    0x7e, 0x63, 0x4d, 0x46, 0x3a, 0x3a, 0x47, 0x4c, 0x69, 0x5e, 0x5e, 0x28,
-    0x1d, 0x2e, 0x3e, 0x47, 0x2d, 0x28, 0x2e, 0x36, 0x4d, 0x4d, 0x63, 0x6b,
-    0x74, 0x3d, 0x12, 0x12, 0x12, 0x0d, 0x0a, 0x08, 0x0b, 0x0c, 0x12, 0x16,
-    0x1c, 0x16, 0x08, 0x06, 0x02, 0x03, 0x05, 0x0c, 0x16, 0x12, 0x1c, 0x12,
-    0x16, 0x0c, 0x05, 0x03, 0x02, 0x00, 0x00, 0x03, 0x12, 0x14, 0x1d, 0x28,
-    0x2e, 0x46, 0x58, 0x75, 0x75, 0x75, 0x77, 0x69, 0x47, 0x2b, 0x1e, 0x13,
-    0x08, 0x05, 0x05, 0x2a, 0x2d, 0x27, 0x36, 0x4a, 0x27, 0x27, 0x36, 0x2b,
-    0x1a, 0x1d, 0x1d, 0x1d, 0x20, 0x20, 0x3d, 0x5a, 0x5e, 0x61, 0x6f, 0x47,
-    0x2d, 0x48, 0x36, 0x37, 0x50, 0x74, 0x85, 0x54, 0x29, 0x1a, 0x1f, 0x1f,
-    0x28, 0x28, 0x3d, 0x48, 0x2d, 0x28, 0x1d, 0x2b, 0x64, 0x4c, 0x1e, 0x28,
-    0x47, 0x60, 0x6f, 0x78, 0x87, 0x86, 0xa2, 0xcc, 0xe9, 0xeb, 0xeb, 0xe1,
-    0xdd, 0xe1, 0xdd, 0xdc, 0xe8, 0xeb, 0xf0, 0xf0, 0xf0, 0xf2, 0xe3, 0xdd,
-    0xdd, 0xf0, 0xf2, 0xe4, 0xf1, 0xf2, 0xdd, 0xc8, 0xc8, 0xca, 0xd5, 0xdc,
-    0xdd, 0xe0, 0xdc, 0xc6, 0xa5, 0x94, 0x82, 0x85, 0x9d, 0xb9, 0xe4, 0xf2,
-    0xfc, 0xfc, 0xfc, 0xfc, 0xfa, 0xee, 0xeb, 0xeb, 0xe3, 0xf0, 0xfa, 0xfa,
-    0xf9, 0xed, 0xd7, 0xd7, 0xd9, 0xce, 0xd5, 0xcc, 0xd3, 0xe4, 0xf3, 0xf0,
-    0xeb, 0xc9, 0xa2, 0x82, 0x6c, 0x5a, 0x45, 0x53, 0x64, 0x87, 0x86, 0x75,
-    0x6c, 0x78, 0xae, 0xbc, 0xaa, 0xae, 0xa0, 0xa0, 0xd4, 0xd3, 0xd3, 0xbe,
-    0xd4, 0xc4, 0xe4, 0xf2, 0xec, 0xe4, 0xd4, 0xe5, 0xf3, 0xf0, 0xee, 0xee,
-    0xe1, 0xd1, 0xe3, 0xee, 0xf2, 0xfc, 0xfc, 0xd4, 0xec, 0xf2, 0xf2, 0xf3,
-    0xee, 0xeb, 0xdc, 0xce, 0xac, 0x91, 0x98, 0x85, 0x61, 0x61, 0x5e, 0x5e,
-    0x4c, 0x52, 0x4a, 0x2f, 0x25, 0x35, 0x4a, 0x4a, 0x4a, 0x40, 0x21, 0x52,
-    0x6d, 0x5e, 0x7b, 0x7b, 0x5e, 0x4c, 0x3f, 0x3f, 0x2f, 0x6d, 0x81, 0x7b,
-    0x7b, 0x91, 0x84, 0x61, 0x2f, 0x19, 0x35, 0x35, 0x2b, 0x36, 0x36, 0x36,
-    0x36, 0x21, 0x0b, 0x00, 0x00, 0x00, 0x06, 0x0b, 0x0b, 0x08, 0x0b, 0x22,
-    0x35, 0x2f, 0x35, 0x52, 0x69, 0x75, 0x63, 0x4d, 0x5a, 0x9f, 0xce, 0xbc,
-    0xbc, 0x97, 0x73, 0x58, 0x50, 0x6c, 0x85, 0x8c, 0x8c, 0x73, 0x58, 0x46,
-    0x3e, 0x3e, 0x3a, 0x46, 0x61, 0x61, 0x46, 0x2e, 0x2f, 0x48, 0x48, 0x56,
-    0x4e, 0x2b, 0x2b, 0x3e, 0x46, 0x46, 0x4d, 0x50, 0x3e, 0x19, 0x0a, 0x0a,
-    0x07, 0x08, 0x0c, 0x0c, 0x08, 0x16, 0x19, 0x1c, 0x1c, 0x0d, 0x0c, 0x08,
-    0x05, 0x05, 0x05, 0x0c, 0x0d, 0x12, 0x12, 0x0d, 0x0c, 0x0c, 0x05, 0x03,
-    0x02, 0x00, 0x00, 0x00, 0x05, 0x10, 0x1f, 0x27, 0x3e, 0x44, 0x58, 0x75,
-    0x85, 0x75, 0x6b, 0x54, 0x55, 0x1f, 0x1b, 0x10, 0x07, 0x05, 0x08, 0x1e,
-    0x1d, 0x2e, 0x47, 0x46, 0x3e, 0x29, 0x29, 0x36, 0x2a, 0x1a, 0x1a, 0x1b,
-    0x1b, 0x2d, 0x53, 0x87, 0x78, 0x86, 0x54, 0x51, 0x55, 0x47, 0x1f, 0x2e,
-    0x44, 0x50, 0x5a, 0x36, 0x29, 0x1b, 0x2b, 0x2d, 0x2f, 0x1f, 0x1d, 0x2d,
-    0x2b, 0x1d, 0x2b, 0x2b, 0x56, 0x56, 0x33, 0x2f, 0x30, 0x51, 0x75, 0x8c,
-    0xb8, 0xc9, 0xc9, 0xc2, 0xda, 0xd7, 0xdd, 0xdd, 0xf0, 0xf0, 0xe1, 0xcc,
-    0xc9, 0xe8, 0xdd, 0xdd, 0xe9, 0xeb, 0xe1, 0xdd, 0xe1, 0xf0, 0xe5, 0xe1,
-    0xf1, 0xf2, 0xe1, 0xd7, 0xd7, 0xd5, 0xdc, 0xe1, 0xeb, 0xe1, 0xdc, 0xbb,
-    0xa2, 0x9a, 0xa0, 0xb4, 0xe5, 0xfc, 0xfc, 0xfc, 0xfc, 0xfa, 0xfa, 0xf3,
-    0xee, 0xe1, 0xe0, 0xe0, 0xe0, 0xe3, 0xf3, 0xee, 0xed, 0xd9, 0xc6, 0xca,
-    0xca, 0xc6, 0xc6, 0xcf, 0xe4, 0xf2, 0xfa, 0xfa, 0xe9, 0xd7, 0xb8, 0x8c,
-    0x7a, 0x60, 0x45, 0x3d, 0x67, 0x87, 0x87, 0x86, 0x87, 0xb4, 0xd1, 0xd1,
-    0xd3, 0xd4, 0xd4, 0xba, 0xd4, 0xe4, 0xf3, 0xe3, 0xe4, 0xe5, 0xf3, 0xf3,
-    0xf3, 0xe4, 0xd4, 0xe4, 0xe4, 0xf0, 0xeb, 0xe1, 0xd3, 0xae, 0xbe, 0xe1,
-    0xfc, 0xfc, 0xfe, 0xed, 0xf8, 0xe3, 0xeb, 0xe1, 0xe1, 0xe1, 0xe0, 0xd1,
-    0xae, 0x7b, 0x7e, 0xba, 0x7e, 0x61, 0x61, 0x61, 0x5e, 0x4c, 0x3f, 0x3f,
-    0x19, 0x2f, 0x35, 0x40, 0x4a, 0x35, 0x3f, 0x35, 0x4c, 0x54, 0x75, 0x74,
-    0x54, 0x4c, 0x3f, 0x3f, 0x3f, 0x6d, 0x69, 0x61, 0x63, 0x74, 0x63, 0x54,
-    0x2f, 0x19, 0x1f, 0x1f, 0x1f, 0x2b, 0x1f, 0x24, 0x24, 0x19, 0x15, 0x06,
-    0x00, 0x02, 0x09, 0x08, 0x0b, 0x08, 0x08, 0x22, 0x33, 0x4e, 0x3f, 0x3f,
-    0x35, 0x36, 0x1a, 0x40, 0x55, 0x6f, 0xa3, 0xbc, 0xbc, 0x96, 0x66, 0x58,
-    0x4d, 0x4d, 0x46, 0x61, 0x74, 0x58, 0x54, 0x47, 0x40, 0x36, 0x46, 0x43,
-    0x50, 0x51, 0x4a, 0x3e, 0x48, 0x67, 0x67, 0x6a, 0x4e, 0x1f, 0x1f, 0x36,
-    0x3e, 0x3a, 0x47, 0x1e, 0x05, 0x03, 0x06, 0x06, 0x05, 0x05, 0x08, 0x0c,
-    0x0c, 0x0d, 0x19, 0x1c, 0x12, 0x16, 0x16, 0x0a, 0x09, 0x03, 0x05, 0x0c,
-    0x0c, 0x0a, 0x0d, 0x0a, 0x08, 0x08, 0x05, 0x03, 0x00, 0x00, 0x00, 0x02,
-    0x0b, 0x10, 0x1f, 0x2e, 0x3a, 0x43, 0x58, 0x6b, 0x75, 0x75, 0x6b, 0x46,
-    0x46, 0x1f, 0x10, 0x0d, 0x10, 0x10, 0x2a, 0x3e, 0x56, 0x44, 0x54, 0x46,
-    0x6f, 0x55, 0x47, 0x6f, 0x4c, 0x1a, 0x1a, 0x1b, 0x1d, 0x53, 0x6c, 0x86,
-    0x86, 0x75, 0x74, 0x58, 0x54, 0x47, 0x2b, 0x2f, 0x47, 0x2e, 0x2e, 0x1f,
-    0x1f, 0x2b, 0x2d, 0x48, 0x3d, 0x1f, 0x1f, 0x28, 0x2b, 0x27, 0x28, 0x2e,
-    0x28, 0x3d, 0x48, 0x47, 0x77, 0x9d, 0x9d, 0xa0, 0xbb, 0xb5, 0xa7, 0xc1,
-    0xc9, 0xc9, 0xdc, 0xdd, 0xeb, 0xeb, 0xe1, 0xcc, 0xc9, 0xc9, 0xc2, 0xc2,
-    0xcc, 0xdd, 0xdd, 0xdd, 0xf0, 0xf2, 0xe1, 0xc9, 0xf1, 0xf2, 0xeb, 0xd7,
-    0xd7, 0xdc, 0xdd, 0xeb, 0xee, 0xeb, 0xdc, 0xbb, 0xb1, 0xd4, 0xd4, 0xf3,
-    0xfc, 0xfa, 0xfc, 0xfc, 0xfc, 0xfa, 0xf0, 0xe4, 0xe1, 0xe0, 0xe1, 0xe3,
-    0xe1, 0xe1, 0xe1, 0xe0, 0xd5, 0xc6, 0xb6, 0xa6, 0xa6, 0xaf, 0xbb, 0xd1,
-    0xf3, 0xf0, 0xf7, 0xea, 0xe6, 0xca, 0xca, 0xa5, 0x8c, 0x78, 0x53, 0x56,
-    0x67, 0x78, 0x86, 0x77, 0x9f, 0xd3, 0xd2, 0xd2, 0xf3, 0xf3, 0xee, 0xe4,
-    0xe4, 0xf3, 0xf3, 0xee, 0xe3, 0xe4, 0xf3, 0xe3, 0xe3, 0xe3, 0xe4, 0xd4,
-    0xe4, 0xe4, 0xeb, 0xe1, 0xd3, 0xae, 0xb4, 0xe4, 0xfc, 0xfe, 0xfa, 0xfa,
-    0xeb, 0xed, 0xed, 0xe1, 0xf3, 0xe1, 0xd1, 0xd1, 0xbe, 0xae, 0xba, 0xb9,
-    0xa1, 0x7b, 0x75, 0x75, 0x61, 0x55, 0x52, 0x35, 0x1f, 0x2f, 0x21, 0x2f,
-    0x3f, 0x25, 0x41, 0x35, 0x6d, 0x54, 0x54, 0x54, 0x4a, 0x24, 0x25, 0x3f,
-    0x3f, 0x4a, 0x4a, 0x6f, 0x63, 0x4d, 0x4d, 0x46, 0x12, 0x16, 0x21, 0x24,
-    0x1f, 0x2b, 0x2f, 0x21, 0x0c, 0x16, 0x0c, 0x03, 0x02, 0x05, 0x05, 0x05,
-    0x0c, 0x15, 0x35, 0x4f, 0x52, 0x6a, 0x52, 0x52, 0x69, 0x2e, 0x1a, 0x2f,
-    0x4e, 0x69, 0x78, 0x8c, 0x97, 0x83, 0x66, 0x58, 0x54, 0x36, 0x29, 0x5e,
-    0x61, 0x54, 0x54, 0x47, 0x4a, 0x36, 0x36, 0x1f, 0x29, 0x44, 0x47, 0x4a,
-    0x5e, 0x64, 0x64, 0x6a, 0x34, 0x1e, 0x1f, 0x1f, 0x28, 0x2d, 0x1c, 0x03,
-    0x03, 0x03, 0x02, 0x03, 0x03, 0x08, 0x0a, 0x1c, 0x15, 0x13, 0x12, 0x12,
-    0x0c, 0x0c, 0x0a, 0x0a, 0x05, 0x03, 0x05, 0x0b, 0x0c, 0x0c, 0x0a, 0x0c,
-    0x08, 0x05, 0x05, 0x03, 0x00, 0x00, 0x00, 0x03, 0x15, 0x1e, 0x1d, 0x27,
-    0x2c, 0x32, 0x50, 0x58, 0x6b, 0x58, 0x50, 0x46, 0x27, 0x1b, 0x10, 0x0d,
-    0x10, 0x2b, 0x2e, 0x3e, 0x6f, 0x5a, 0x77, 0x6f, 0x91, 0x77, 0x78, 0x46,
-    0x36, 0x2e, 0x28, 0x14, 0x48, 0x78, 0x6c, 0x75, 0x74, 0x74, 0x74, 0x74,
-    0x4d, 0x3e, 0x28, 0x14, 0x19, 0x14, 0x1e, 0x1b, 0x2a, 0x2f, 0x3d, 0x47,
-    0x48, 0x28, 0x28, 0x27, 0x2e, 0x36, 0x3e, 0x2d, 0x28, 0x3d, 0x45, 0x7a,
-    0xc9, 0xd7, 0xe1, 0xe1, 0xdc, 0xb8, 0xab, 0xb5, 0xc9, 0xc9, 0xc2, 0xc8,
-    0xc8, 0xc9, 0xc9, 0xc9, 0xb8, 0xb8, 0xab, 0xa5, 0xb8, 0xc9, 0xb8, 0xc9,
-    0xcc, 0xcc, 0xcc, 0xc9, 0xf1, 0xf2, 0xf0, 0xe8, 0xe8, 0xe9, 0xeb, 0xeb,
-    0xeb, 0xe1, 0xe0, 0xd3, 0xd4, 0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xfc, 0xfa,
-    0xf9, 0xeb, 0xe1, 0xe1, 0xd3, 0xe3, 0xf3, 0xf0, 0xeb, 0xe1, 0xd1, 0xbe,
-    0xbe, 0xac, 0xa6, 0x96, 0x96, 0x97, 0xac, 0xd3, 0xe3, 0xe3, 0xdc, 0xde,
-    0xc8, 0xb6, 0xab, 0x9c, 0x93, 0x7a, 0x60, 0x60, 0x64, 0x64, 0x77, 0x77,
-    0x87, 0xb4, 0xe4, 0xf2, 0xfa, 0xed, 0xed, 0xee, 0xee, 0xee, 0xe0, 0xe0,
-    0xe0, 0xd3, 0xd3, 0xce, 0xd0, 0xce, 0xd2, 0xd3, 0xe3, 0xeb, 0xea, 0xd9,
-    0xce, 0xbe, 0xe1, 0xf3, 0xfe, 0xfa, 0xfa, 0xeb, 0xee, 0xf0, 0xeb, 0xf0,
-    0xf0, 0xeb, 0xce, 0xbc, 0xe1, 0xce, 0xb7, 0xa1, 0x7b, 0x7b, 0x77, 0x63,
-    0x61, 0x4a, 0x4a, 0x29, 0x2f, 0x36, 0x4a, 0x2f, 0x21, 0x25, 0x25, 0x35,
-    0x4c, 0x4a, 0x55, 0x4a, 0x40, 0x25, 0x25, 0x24, 0x25, 0x24, 0x4a, 0x4a,
-    0x46, 0x54, 0x46, 0x2f, 0x16, 0x25, 0x25, 0x25, 0x19, 0x21, 0x24, 0x19,
-    0x16, 0x09, 0x05, 0x03, 0x05, 0x05, 0x06, 0x05, 0x16, 0x22, 0x34, 0x4e,
-    0x6a, 0x5e, 0x54, 0x46, 0x55, 0x3a, 0x2e, 0x4e, 0x80, 0x6d, 0x81, 0x6f,
-    0x91, 0x74, 0x58, 0x50, 0x3a, 0x2e, 0x56, 0x64, 0x6f, 0x6f, 0x61, 0x5e,
-    0x55, 0x55, 0x3e, 0x2b, 0x29, 0x36, 0x47, 0x47, 0x61, 0x61, 0x60, 0x64,
-    0x40, 0x1e, 0x1f, 0x2a, 0x20, 0x1c, 0x0b, 0x03, 0x02, 0x02, 0x02, 0x05,
-    0x1c, 0x21, 0x3d, 0x56, 0x4e, 0x33, 0x1c, 0x0a, 0x0b, 0x08, 0x0a, 0x0b,
-    0x03, 0x03, 0x03, 0x05, 0x08, 0x08, 0x08, 0x08, 0x05, 0x06, 0x03, 0x02,
-    0x00, 0x00, 0x04, 0x0b, 0x0a, 0x1c, 0x1b, 0x28, 0x2e, 0x2c, 0x37, 0x43,
-    0x50, 0x43, 0x44, 0x44, 0x27, 0x1e, 0x0d, 0x0a, 0x14, 0x28, 0x27, 0x3a,
-    0x50, 0x58, 0x75, 0x91, 0x91, 0x85, 0x61, 0x46, 0x69, 0x27, 0x27, 0x0d,
-    0x49, 0x77, 0x5a, 0x85, 0x6b, 0x74, 0x84, 0x85, 0x61, 0x36, 0x2b, 0x10,
-    0x1b, 0x1c, 0x1e, 0x1e, 0x2a, 0x2b, 0x2d, 0x2e, 0x28, 0x1f, 0x2f, 0x3d,
-    0x3a, 0x54, 0x55, 0x3d, 0x3d, 0x56, 0x60, 0xa5, 0xab, 0xa7, 0xc1, 0xc8,
-    0xc9, 0xc9, 0x9c, 0xa5, 0xab, 0xab, 0xab, 0xa7, 0xab, 0xb5, 0xb5, 0xc9,
-    0xd2, 0xe1, 0xcf, 0x82, 0x9c, 0xa8, 0x9c, 0xa5, 0xb8, 0xa2, 0x86, 0xb8,
-    0xfb, 0xf1, 0xf2, 0xeb, 0xe9, 0xe9, 0xeb, 0xeb, 0xeb, 0xeb, 0xee, 0xf3,
-    0xf2, 0xfc, 0xfa, 0xf0, 0xf0, 0xf3, 0xf3, 0xf3, 0xe1, 0xdc, 0xce, 0xd1,
-    0xd3, 0xf3, 0xf3, 0xeb, 0xe9, 0xdc, 0xd1, 0xb7, 0xb7, 0xb2, 0xaa, 0xaa,
-    0x97, 0x97, 0x8c, 0xae, 0xd1, 0xce, 0xc6, 0xb6, 0xab, 0x94, 0x88, 0x88,
-    0x7c, 0x7a, 0x7a, 0x60, 0x60, 0x78, 0x7a, 0x6c, 0x87, 0xd4, 0xfc, 0xfc,
-    0xf9, 0xeb, 0xea, 0xdc, 0xe0, 0xe0, 0xd0, 0xd0, 0xd1, 0xd1, 0xd0, 0xbc,
-    0xac, 0xce, 0xd1, 0xd1, 0xce, 0xd5, 0xca, 0xb6, 0xaf, 0xac, 0xce, 0xdd,
-    0xfd, 0xf7, 0xeb, 0xdf, 0xf2, 0xfc, 0xee, 0xeb, 0xf9, 0xe9, 0xd5, 0xaa,
-    0xe3, 0xe0, 0xce, 0x97, 0x84, 0x75, 0x77, 0x75, 0x54, 0x4a, 0x52, 0x36,
-    0x4a, 0x4a, 0x4a, 0x40, 0x35, 0x16, 0x16, 0x21, 0x21, 0x2b, 0x4a, 0x4a,
-    0x19, 0x25, 0x26, 0x25, 0x3f, 0x3f, 0x40, 0x4c, 0x36, 0x4a, 0x24, 0x24,
-    0x25, 0x25, 0x25, 0x16, 0x16, 0x0c, 0x08, 0x0c, 0x0c, 0x06, 0x05, 0x06,
-    0x05, 0x05, 0x0b, 0x0b, 0x0d, 0x1c, 0x35, 0x6e, 0x64, 0x5e, 0x54, 0x46,
-    0x4a, 0x3e, 0x27, 0x40, 0x6a, 0x6a, 0x9d, 0x9f, 0x9f, 0x86, 0x50, 0x39,
-    0x3a, 0x29, 0x56, 0x6f, 0x77, 0x75, 0x75, 0x75, 0x5a, 0x55, 0x3e, 0x2b,
-    0x29, 0x36, 0x46, 0x54, 0x58, 0x63, 0x75, 0x55, 0x2b, 0x1e, 0x2a, 0x31,
-    0x20, 0x22, 0x06, 0x06, 0x03, 0x02, 0x05, 0x1e, 0x30, 0x51, 0x6c, 0x75,
-    0x87, 0x78, 0x4e, 0x1c, 0x0c, 0x0c, 0x08, 0x09, 0x05, 0x03, 0x03, 0x03,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x03, 0x02, 0x00, 0x00, 0x03, 0x0b,
-    0x0a, 0x0a, 0x10, 0x1e, 0x2d, 0x2e, 0x2e, 0x37, 0x37, 0x2c, 0x30, 0x28,
-    0x1b, 0x12, 0x07, 0x0d, 0x14, 0x1d, 0x27, 0x45, 0x5a, 0x75, 0x84, 0x84,
-    0x84, 0x84, 0x85, 0x61, 0x64, 0x28, 0x1f, 0x0a, 0x2a, 0x47, 0x46, 0x72,
-    0x6b, 0x6b, 0x74, 0x84, 0x54, 0x36, 0x1f, 0x1b, 0x1e, 0x2b, 0x2d, 0x28,
-    0x1f, 0x2b, 0x28, 0x28, 0x1b, 0x2a, 0x2d, 0x47, 0x3e, 0x55, 0x47, 0x47,
-    0x56, 0x77, 0x82, 0x88, 0x8a, 0x8a, 0x8a, 0xa7, 0xb5, 0xa5, 0xb5, 0xbb,
-    0x94, 0x88, 0x88, 0x8a, 0x9c, 0xa5, 0xb5, 0xc9, 0xdd, 0xe1, 0xcf, 0xaa,
-    0x93, 0xb1, 0x9a, 0x93, 0x93, 0x85, 0x77, 0xbb, 0xfb, 0xf1, 0xf2, 0xeb,
-    0xeb, 0xeb, 0xeb, 0xeb, 0xee, 0xf3, 0xfa, 0xfa, 0xfa, 0xf3, 0xee, 0xeb,
-    0xee, 0xe4, 0xe4, 0xe1, 0xce, 0xbc, 0xac, 0xae, 0xd3, 0xe3, 0xdf, 0xd7,
-    0xde, 0xc6, 0xbe, 0xd3, 0xd4, 0xd4, 0xd2, 0xb2, 0xaa, 0x8c, 0x85, 0x9f,
-    0xae, 0xbc, 0xaf, 0x94, 0x94, 0x94, 0x7f, 0x7c, 0x8c, 0x86, 0x87, 0x7d,
-    0x9d, 0x9d, 0x9b, 0x78, 0x80, 0xec, 0xfc, 0xf9, 0xed, 0xed, 0xdf, 0xdf,
-    0xdf, 0xd1, 0xbc, 0xb0, 0xce, 0xbe, 0xb0, 0x98, 0xac, 0xd1, 0xd1, 0xae,
-    0xaa, 0xbb, 0xa6, 0x84, 0x83, 0x94, 0xaf, 0xaf, 0xe7, 0xed, 0xf0, 0xf3,
-    0xfc, 0xfc, 0xeb, 0xeb, 0xeb, 0xe6, 0xca, 0xaa, 0xdd, 0xdd, 0xd5, 0x94,
-    0x84, 0x61, 0x54, 0x46, 0x29, 0x3f, 0x5d, 0x4a, 0x5e, 0x5e, 0x54, 0x4a,
-    0x35, 0x19, 0x16, 0x25, 0x25, 0x19, 0x24, 0x24, 0x19, 0x16, 0x18, 0x18,
-    0x25, 0x21, 0x21, 0x2b, 0x24, 0x24, 0x16, 0x0c, 0x16, 0x18, 0x16, 0x16,
-    0x16, 0x0c, 0x08, 0x0c, 0x08, 0x0c, 0x0b, 0x08, 0x08, 0x0b, 0x15, 0x15,
-    0x0d, 0x22, 0x6d, 0x80, 0x87, 0x6f, 0x61, 0x54, 0x6a, 0x3d, 0x2e, 0x2e,
-    0x36, 0x80, 0xba, 0xb2, 0xa3, 0x85, 0x63, 0x4d, 0x36, 0x29, 0x47, 0x5a,
-    0x75, 0x75, 0x84, 0x74, 0x58, 0x47, 0x27, 0x2f, 0x36, 0x36, 0x46, 0x54,
-    0x50, 0x63, 0x54, 0x2e, 0x1f, 0x2b, 0x2d, 0x31, 0x2a, 0x22, 0x03, 0x03,
-    0x0b, 0x08, 0x12, 0x3e, 0x44, 0x5e, 0x75, 0x84, 0x86, 0x86, 0x6f, 0x33,
-    0x13, 0x0c, 0x09, 0x09, 0x03, 0x02, 0x02, 0x02, 0x05, 0x09, 0x06, 0x05,
-    0x06, 0x06, 0x05, 0x03, 0x02, 0x02, 0x03, 0x08, 0x08, 0x0a, 0x10, 0x1b,
-    0x1a, 0x1f, 0x28, 0x1d, 0x30, 0x2e, 0x1d, 0x1a, 0x1b, 0x10, 0x07, 0x1c,
-    0x14, 0x1b, 0x3e, 0x51, 0x6c, 0x6b, 0x73, 0x84, 0x91, 0x91, 0x74, 0x63,
-    0x55, 0x2b, 0x1f, 0x0a, 0x10, 0x1e, 0x1e, 0x30, 0x51, 0x50, 0x58, 0x50,
-    0x3a, 0x29, 0x1b, 0x1e, 0x2d, 0x2e, 0x3e, 0x3d, 0x2b, 0x1b, 0x1f, 0x2f,
-    0x28, 0x31, 0x40, 0x2d, 0x3d, 0x45, 0x3e, 0x47, 0x6c, 0x7a, 0x70, 0x5c,
-    0x76, 0x7c, 0x76, 0x8a, 0xab, 0xb8, 0xbb, 0xcf, 0xcf, 0xbb, 0x82, 0x70,
-    0x7c, 0x9c, 0xb5, 0xab, 0xb5, 0xb5, 0xb5, 0xa8, 0xa8, 0xcf, 0xe5, 0xb2,
-    0x9a, 0x72, 0x8c, 0x82, 0xf1, 0xf1, 0xf2, 0xf0, 0xeb, 0xeb, 0xeb, 0xf0,
-    0xfa, 0xfa, 0xfa, 0xf0, 0xeb, 0xed, 0xe0, 0xe1, 0xf0, 0xee, 0xe3, 0xd1,
-    0xb7, 0xb7, 0xae, 0xb7, 0xba, 0xd1, 0xbc, 0xaf, 0xaf, 0xac, 0xae, 0xe4,
-    0xf3, 0xf3, 0xee, 0xe1, 0xc6, 0x8c, 0x77, 0x91, 0xa3, 0x97, 0x96, 0x83,
-    0x83, 0x82, 0x9b, 0xb4, 0xb4, 0xba, 0xb4, 0xb9, 0xe4, 0xe4, 0xb4, 0x9d,
-    0xd4, 0xfc, 0xfc, 0xed, 0xe7, 0xe2, 0xdf, 0xe3, 0xe3, 0xbe, 0xae, 0xb7,
-    0xbc, 0xac, 0x98, 0x98, 0xac, 0xae, 0xba, 0xa3, 0x97, 0xbb, 0xa2, 0x7b,
-    0x7b, 0x75, 0x84, 0x8c, 0xa0, 0xe9, 0xeb, 0xfc, 0xfc, 0xf3, 0xe9, 0xe0,
-    0xeb, 0xe6, 0xca, 0xa6, 0x97, 0xce, 0xc6, 0xa6, 0x97, 0x7b, 0x54, 0x3a,
-    0x29, 0x35, 0x3f, 0x4c, 0x5e, 0x54, 0x46, 0x4c, 0x35, 0x21, 0x25, 0x3f,
-    0x3f, 0x35, 0x35, 0x21, 0x22, 0x15, 0x05, 0x06, 0x16, 0x21, 0x25, 0x24,
-    0x24, 0x25, 0x18, 0x0c, 0x0c, 0x16, 0x16, 0x0c, 0x09, 0x09, 0x0c, 0x15,
-    0x15, 0x15, 0x16, 0x09, 0x08, 0x0c, 0x0c, 0x0c, 0x12, 0x2a, 0x69, 0xa0,
-    0x78, 0x6c, 0x6c, 0x4d, 0x54, 0x54, 0x6a, 0x4c, 0x2f, 0x9d, 0xb4, 0xac,
-    0x8c, 0x84, 0x6b, 0x54, 0x46, 0x3a, 0x2e, 0x3a, 0x5a, 0x6c, 0x74, 0x58,
-    0x4d, 0x2b, 0x1a, 0x28, 0x1f, 0x2b, 0x47, 0x46, 0x44, 0x3e, 0x1f, 0x1f,
-    0x2f, 0x33, 0x2d, 0x3d, 0x31, 0x22, 0x06, 0x05, 0x1e, 0x1e, 0x2b, 0x47,
-    0x3a, 0x61, 0x77, 0x74, 0x75, 0x77, 0x60, 0x56, 0x13, 0x08, 0x05, 0x06,
-    0x03, 0x02, 0x02, 0x06, 0x1c, 0x1c, 0x08, 0x0b, 0x22, 0x2a, 0x2a, 0x33,
-    0x22, 0x0b, 0x02, 0x02, 0x02, 0x08, 0x19, 0x10, 0x14, 0x1e, 0x1e, 0x1b,
-    0x1d, 0x1f, 0x1e, 0x10, 0x14, 0x10, 0x07, 0x05, 0x07, 0x1e, 0x3e, 0x37,
-    0x4b, 0x58, 0x73, 0x84, 0x8c, 0x91, 0x63, 0x43, 0x2e, 0x1f, 0x14, 0x0a,
-    0x05, 0x0a, 0x1d, 0x30, 0x30, 0x3e, 0x30, 0x2e, 0x2b, 0x1f, 0x33, 0x2a,
-    0x2e, 0x37, 0x45, 0x47, 0x2f, 0x1f, 0x1e, 0x2f, 0x2d, 0x3d, 0x3d, 0x3d,
-    0x2d, 0x3e, 0x56, 0x51, 0x4b, 0x68, 0x5b, 0x5b, 0x5b, 0x5b, 0x5c, 0x88,
-    0x9c, 0xb8, 0xc9, 0xdd, 0xf0, 0xd2, 0xbb, 0x72, 0x70, 0x88, 0x7c, 0x7c,
-    0x88, 0x7c, 0xa5, 0xb8, 0xa8, 0xcc, 0xcf, 0xb1, 0xa2, 0x9a, 0x9b, 0x9d,
-    0xf1, 0xf1, 0xfc, 0xf0, 0xeb, 0xee, 0xee, 0xf9, 0xee, 0xee, 0xee, 0xed,
-    0xd9, 0xdc, 0xe1, 0xf0, 0xee, 0xe3, 0xd2, 0xd1, 0xd2, 0xd3, 0xd2, 0xb7,
-    0xba, 0xa3, 0x98, 0x98, 0x98, 0x91, 0xb4, 0xf3, 0xf3, 0xf0, 0xeb, 0xdc,
-    0xd5, 0xaa, 0x86, 0x85, 0x85, 0x74, 0x74, 0x85, 0x87, 0xb9, 0xf2, 0xf3,
-    0xf0, 0xf3, 0xe3, 0xe4, 0xf0, 0xf0, 0xe3, 0xd4, 0xf2, 0xfc, 0xf8, 0xe2,
-    0xdb, 0xde, 0xce, 0xd1, 0xbc, 0xb0, 0xa3, 0xac, 0x83, 0x91, 0x91, 0x98,
-    0xaf, 0xac, 0xae, 0x91, 0x91, 0xac, 0x91, 0x86, 0xa0, 0xa0, 0xa3, 0x9f,
-    0x9d, 0xb4, 0xee, 0xfc, 0xfc, 0xf3, 0xe0, 0xd2, 0xd3, 0xe0, 0xdc, 0xa6,
-    0x97, 0xa1, 0xb7, 0xaa, 0x84, 0x74, 0x61, 0x5e, 0x5e, 0x4a, 0x29, 0x36,
-    0x55, 0x4a, 0x36, 0x2f, 0x24, 0x25, 0x52, 0x6e, 0x6e, 0x6e, 0x6e, 0x52,
-    0x25, 0x0c, 0x03, 0x06, 0x18, 0x16, 0x25, 0x19, 0x19, 0x25, 0x18, 0x05,
-    0x03, 0x09, 0x0c, 0x18, 0x0c, 0x15, 0x16, 0x16, 0x25, 0x18, 0x16, 0x16,
-    0x12, 0x12, 0x12, 0x19, 0x12, 0x2a, 0x6f, 0x87, 0x9f, 0xa0, 0x78, 0x6f,
-    0x39, 0x3a, 0x6f, 0x54, 0x47, 0x81, 0xae, 0xa2, 0xa2, 0x84, 0x6b, 0x50,
-    0x54, 0x46, 0x2e, 0x27, 0x27, 0x3e, 0x46, 0x3a, 0x2e, 0x2b, 0x1f, 0x2b,
-    0x14, 0x1b, 0x1b, 0x1f, 0x2d, 0x3e, 0x1f, 0x40, 0x4c, 0x4e, 0x48, 0x45,
-    0x49, 0x35, 0x0b, 0x08, 0x1f, 0x2f, 0x40, 0x47, 0x46, 0x77, 0x75, 0x74,
-    0x75, 0x77, 0x60, 0x64, 0x0a, 0x05, 0x06, 0x0c, 0x0b, 0x05, 0x0b, 0x13,
-    0x20, 0x20, 0x22, 0x34, 0x33, 0x3d, 0x48, 0x56, 0x69, 0x52, 0x15, 0x03,
-    0x02, 0x03, 0x05, 0x05, 0x07, 0x0a, 0x12, 0x12, 0x14, 0x1f, 0x1b, 0x14,
-    0x14, 0x0d, 0x08, 0x02, 0x06, 0x1e, 0x1d, 0x23, 0x44, 0x50, 0x57, 0x71,
-    0x73, 0x73, 0x50, 0x46, 0x2e, 0x1f, 0x14, 0x10, 0x07, 0x10, 0x1a, 0x28,
-    0x48, 0x2b, 0x28, 0x1d, 0x1e, 0x21, 0x21, 0x21, 0x27, 0x2e, 0x47, 0x3d,
-    0x2b, 0x2b, 0x2f, 0x2e, 0x3e, 0x47, 0x55, 0x48, 0x3d, 0x56, 0x67, 0x6c,
-    0x5a, 0x68, 0x4b, 0x42, 0x68, 0x57, 0x57, 0x7c, 0x88, 0x9c, 0xab, 0xb5,
-    0xc9, 0xc9, 0xa8, 0x7a, 0x7a, 0x7a, 0x82, 0x68, 0x7f, 0x70, 0x7f, 0x7c,
-    0x93, 0x93, 0x93, 0x93, 0x82, 0xb1, 0xb1, 0x9b, 0xf1, 0xfc, 0xfa, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xee, 0xed, 0xe3, 0xed, 0xd9, 0xd9, 0xdd, 0xeb, 0xeb,
-    0xe0, 0xdc, 0xbc, 0xbc, 0xe0, 0xe0, 0xdc, 0xbe, 0xb7, 0x91, 0x74, 0x7b,
-    0x7b, 0x81, 0xd4, 0xe4, 0xeb, 0xed, 0xe6, 0xd8, 0xca, 0xbb, 0x8c, 0x74,
-    0x6b, 0x75, 0x7b, 0x78, 0xc4, 0xfc, 0xfc, 0xf9, 0xeb, 0xeb, 0xd2, 0xe0,
-    0xe1, 0xe1, 0xe1, 0xe4, 0xf3, 0xf8, 0xed, 0xde, 0xcd, 0xb3, 0xbc, 0xac,
-    0x96, 0x83, 0xa3, 0xa3, 0x73, 0x85, 0x91, 0x91, 0x97, 0x96, 0x96, 0x84,
-    0x85, 0x84, 0x84, 0x85, 0xb2, 0xb1, 0x97, 0x8c, 0x9f, 0xa0, 0xe4, 0xfc,
-    0xf9, 0xee, 0xe1, 0xd1, 0xbb, 0xd3, 0xf0, 0xce, 0xac, 0x8f, 0xa1, 0x86,
-    0x91, 0x9f, 0xa0, 0xa0, 0x7e, 0x5e, 0x4a, 0x36, 0x36, 0x2f, 0x3f, 0x25,
-    0x3f, 0x52, 0x6d, 0x6d, 0x81, 0x6d, 0x6d, 0x6d, 0x3f, 0x0c, 0x09, 0x15,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x35, 0x3c, 0x15, 0x06, 0x03, 0x06, 0x09,
-    0x16, 0x16, 0x25, 0x25, 0x21, 0x25, 0x25, 0x16, 0x12, 0x0d, 0x12, 0x19,
-    0x12, 0x2f, 0x60, 0x85, 0x91, 0x86, 0x86, 0x61, 0x3a, 0x54, 0x46, 0x2e,
-    0x3a, 0x46, 0x61, 0x8c, 0xa2, 0x84, 0x6b, 0x50, 0x44, 0x3a, 0x2e, 0x29,
-    0x29, 0x36, 0x2e, 0x3e, 0x3e, 0x3e, 0x2d, 0x2b, 0x1f, 0x1c, 0x12, 0x10,
-    0x1e, 0x3e, 0x2b, 0x36, 0x55, 0x5e, 0x5e, 0x55, 0x56, 0x34, 0x08, 0x08,
-    0x1f, 0x40, 0x5e, 0x46, 0x54, 0x77, 0x58, 0x58, 0x77, 0x77, 0x60, 0x64,
-    0x1c, 0x0b, 0x15, 0x13, 0x1c, 0x1c, 0x22, 0x1e, 0x1e, 0x33, 0x33, 0x49,
-    0x48, 0x48, 0x64, 0x64, 0x5e, 0x6f, 0x4c, 0x09, 0x02, 0x02, 0x03, 0x03,
-    0x03, 0x03, 0x03, 0x03, 0x08, 0x12, 0x0d, 0x12, 0x10, 0x0a, 0x03, 0x00,
-    0x03, 0x22, 0x1b, 0x14, 0x2d, 0x44, 0x42, 0x4b, 0x57, 0x50, 0x37, 0x2e,
-    0x28, 0x1f, 0x14, 0x10, 0x0d, 0x1b, 0x1d, 0x28, 0x56, 0x2f, 0x1a, 0x3d,
-    0x35, 0x1e, 0x1e, 0x14, 0x28, 0x1d, 0x28, 0x1f, 0x28, 0x33, 0x2f, 0x2d,
-    0x3e, 0x47, 0x47, 0x47, 0x45, 0x60, 0x9b, 0xb2, 0x9a, 0x6b, 0x42, 0x42,
-    0x68, 0x4b, 0x4b, 0x70, 0x70, 0x70, 0x76, 0x8a, 0x88, 0x9c, 0x88, 0xa5,
-    0xa8, 0xb2, 0x9b, 0x8c, 0x6c, 0x4b, 0x57, 0x57, 0x68, 0x71, 0x82, 0x7a,
-    0xa2, 0xa2, 0x82, 0x7a, 0xf2, 0xf2, 0xf3, 0xf0, 0xfa, 0xf3, 0xf3, 0xf3,
-    0xe3, 0xe3, 0xe3, 0xdf, 0xd5, 0xce, 0xdf, 0xdc, 0xc6, 0xbb, 0xac, 0xbc,
-    0xce, 0xd5, 0xca, 0xaa, 0x91, 0x9f, 0x86, 0x77, 0x6f, 0x80, 0xb9, 0xd3,
-    0xdf, 0xd5, 0xc8, 0xa7, 0xa6, 0xa6, 0x82, 0x72, 0x6b, 0x6c, 0x6f, 0x8f,
-    0xf2, 0xfc, 0xfa, 0xed, 0xdc, 0xe0, 0xd1, 0xbe, 0xbe, 0xbe, 0xbc, 0xd1,
-    0xf0, 0xed, 0xdf, 0xe2, 0xcd, 0xb3, 0xac, 0xac, 0x98, 0x73, 0x83, 0x83,
-    0x73, 0x7b, 0x7b, 0x84, 0x83, 0x83, 0x66, 0x73, 0x91, 0x91, 0x73, 0x74,
-    0xa2, 0x97, 0x96, 0x83, 0x74, 0x86, 0xe3, 0xfa, 0xee, 0xed, 0xd5, 0xaf,
-    0x94, 0xe3, 0xfc, 0xf0, 0xce, 0xa0, 0x86, 0x9f, 0xba, 0xd4, 0xd3, 0xb7,
-    0x87, 0x7e, 0x61, 0x4c, 0x36, 0x24, 0x3f, 0x25, 0x40, 0x6d, 0x6d, 0x5e,
-    0x61, 0x61, 0x61, 0x69, 0x35, 0x25, 0x16, 0x16, 0x25, 0x25, 0x24, 0x3f,
-    0x3f, 0x3f, 0x3f, 0x25, 0x25, 0x09, 0x09, 0x16, 0x16, 0x25, 0x2f, 0x3f,
-    0x35, 0x2f, 0x2f, 0x21, 0x19, 0x16, 0x16, 0x12, 0x19, 0x1f, 0x64, 0x91,
-    0x85, 0x84, 0x63, 0x4d, 0x54, 0x5e, 0x3a, 0x2e, 0x27, 0x3a, 0x3a, 0x75,
-    0x74, 0x73, 0x58, 0x51, 0x2e, 0x2e, 0x3e, 0x29, 0x36, 0x47, 0x47, 0x54,
-    0x54, 0x46, 0x3e, 0x3d, 0x19, 0x0a, 0x0d, 0x21, 0x1f, 0x2b, 0x40, 0x47,
-    0x61, 0x5a, 0x5e, 0x5e, 0x47, 0x34, 0x07, 0x0a, 0x2b, 0x2e, 0x51, 0x58,
-    0x43, 0x6b, 0x4d, 0x50, 0x6c, 0x77, 0x5a, 0x45, 0x33, 0x26, 0x13, 0x20,
-    0x20, 0x34, 0x33, 0x2a, 0x48, 0x7d, 0x87, 0x87, 0x78, 0x67, 0x56, 0x5e,
-    0x6c, 0x5e, 0x55, 0x19, 0x02, 0x02, 0x03, 0x05, 0x03, 0x03, 0x03, 0x02,
-    0x02, 0x05, 0x0a, 0x0d, 0x08, 0x05, 0x02, 0x00, 0x00, 0x03, 0x03, 0x03,
-    0x2a, 0x37, 0x37, 0x37, 0x37, 0x3a, 0x2e, 0x2b, 0x10, 0x14, 0x14, 0x0a,
-    0x10, 0x1d, 0x2d, 0x2d, 0x48, 0x3e, 0x48, 0x40, 0x40, 0x2f, 0x1e, 0x1b,
-    0x1b, 0x1b, 0x28, 0x2d, 0x31, 0x31, 0x2d, 0x2d, 0x2d, 0x3e, 0x45, 0x53,
-    0x6c, 0xa2, 0xcf, 0xe4, 0xb4, 0x8c, 0x5a, 0x42, 0x57, 0x4b, 0x4b, 0x57,
-    0x57, 0x71, 0x71, 0x68, 0x70, 0x7f, 0x93, 0x93, 0xa8, 0xcf, 0xd2, 0xaa,
-    0x8c, 0x42, 0x78, 0x86, 0x51, 0x6c, 0x68, 0x68, 0x75, 0x4b, 0x58, 0x7a,
-    0xf2, 0xf3, 0xf0, 0xf3, 0xfa, 0xfc, 0xf2, 0xf3, 0xe4, 0xe3, 0xe3, 0xdf,
-    0xd5, 0xbc, 0xbe, 0xbe, 0x97, 0xa2, 0xac, 0xac, 0xac, 0xa3, 0x97, 0x91,
-    0x9f, 0xb7, 0xb7, 0x9f, 0x7e, 0x81, 0xa1, 0xae, 0xac, 0xa6, 0x8e, 0x8a,
-    0x8a, 0x7f, 0x7f, 0x72, 0x6b, 0x5a, 0x64, 0xd4, 0xfc, 0xfa, 0xea, 0xd7,
-    0xd9, 0xce, 0xbe, 0xae, 0xae, 0xac, 0xaa, 0xac, 0xe3, 0xdf, 0xdf, 0xdf,
-    0xca, 0x8e, 0x98, 0x98, 0x98, 0x73, 0x66, 0x63, 0x7b, 0x63, 0x84, 0x6b,
-    0x58, 0x63, 0x63, 0x83, 0x97, 0x83, 0x6b, 0x5e, 0x81, 0x75, 0x71, 0x58,
-    0x50, 0x6c, 0xbe, 0xf6, 0xed, 0xdf, 0xbc, 0xa6, 0x83, 0xe4, 0xfc, 0xeb,
-    0xce, 0xac, 0x91, 0x9f, 0xd4, 0xe4, 0xd1, 0xac, 0x97, 0x74, 0x61, 0x55,
-    0x36, 0x24, 0x21, 0x25, 0x52, 0x6d, 0x6f, 0x7b, 0x7b, 0x7b, 0x63, 0x5e,
-    0x2f, 0x25, 0x19, 0x19, 0x25, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x24,
-    0x25, 0x16, 0x16, 0x16, 0x21, 0x21, 0x2f, 0x4a, 0x4a, 0x4a, 0x36, 0x2f,
-    0x24, 0x19, 0x0d, 0x16, 0x12, 0x0d, 0x40, 0x86, 0x85, 0x6b, 0x58, 0x63,
-    0x5e, 0x3a, 0x3a, 0x3a, 0x29, 0x3e, 0x27, 0x1f, 0x1a, 0x27, 0x3e, 0x36,
-    0x2b, 0x1f, 0x3d, 0x3d, 0x48, 0x64, 0x61, 0x58, 0x5a, 0x51, 0x47, 0x3d,
-    0x19, 0x0c, 0x12, 0x1b, 0x2f, 0x2b, 0x2f, 0x4a, 0x46, 0x5a, 0x6f, 0x64,
-    0x47, 0x2a, 0x35, 0x80, 0x4e, 0x3d, 0x47, 0x44, 0x2c, 0x44, 0x51, 0x44,
-    0x51, 0x60, 0x45, 0x30, 0x4e, 0x6e, 0x6e, 0x6e, 0x4f, 0x6a, 0x48, 0x67,
-    0x78, 0x77, 0x86, 0xa2, 0xb1, 0xb4, 0x78, 0x55, 0x5e, 0x5e, 0x47, 0x2f,
-    0x03, 0x05, 0x06, 0x06, 0x05, 0x06, 0x03, 0x02, 0x02, 0x02, 0x05, 0x08,
-    0x08, 0x0c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1e, 0x1a, 0x1f, 0x1f,
-    0x1f, 0x1d, 0x1a, 0x1a, 0x07, 0x07, 0x0a, 0x0a, 0x1b, 0x2b, 0x3d, 0x3e,
-    0x47, 0x47, 0x55, 0x3e, 0x3d, 0x2d, 0x2f, 0x1f, 0x1e, 0x28, 0x28, 0x3d,
-    0x2d, 0x3d, 0x48, 0x3d, 0x48, 0x56, 0x7d, 0x7a, 0x93, 0xa5, 0xa8, 0xcf,
-    0xcc, 0xaa, 0x77, 0x37, 0x4b, 0x8c, 0x77, 0x5a, 0x57, 0x58, 0x42, 0x57,
-    0x68, 0x72, 0xa2, 0x8c, 0x93, 0xa5, 0xa5, 0x93, 0x7a, 0x7a, 0x82, 0x9a,
-    0x9d, 0x78, 0x44, 0x7a, 0x9b, 0xa0, 0x9a, 0x78, 0xe5, 0xf3, 0xf0, 0xf2,
-    0xf3, 0xf3, 0xf3, 0xe4, 0xe4, 0xd2, 0xd1, 0xce, 0xbc, 0xbe, 0xb7, 0xa3,
-    0x97, 0xac, 0xbc, 0xac, 0xac, 0x91, 0x77, 0x9f, 0xb7, 0xe0, 0xe0, 0xbe,
-    0xac, 0x9f, 0x87, 0x7b, 0x91, 0x83, 0x7f, 0x71, 0x71, 0x71, 0x71, 0x6b,
-    0x6c, 0x60, 0x7d, 0xe4, 0xee, 0xed, 0xd9, 0xca, 0xb0, 0xbc, 0xac, 0xae,
-    0xa3, 0xa3, 0x97, 0x91, 0xba, 0xd3, 0xd0, 0xca, 0xb3, 0x98, 0x98, 0x7b,
-    0x7b, 0x74, 0x4d, 0x61, 0x7e, 0x63, 0x58, 0x58, 0x61, 0x75, 0x7b, 0x63,
-    0x74, 0x73, 0x63, 0x5e, 0x69, 0x4d, 0x50, 0x43, 0x37, 0x6c, 0x85, 0xd7,
-    0xd9, 0xe0, 0xc6, 0xaf, 0xae, 0xf2, 0xfa, 0xeb, 0xe0, 0xbe, 0x97, 0x85,
-    0xb4, 0xe3, 0xd1, 0xce, 0x97, 0x73, 0x75, 0x61, 0x4a, 0x2f, 0x19, 0x25,
-    0x35, 0x6d, 0x6f, 0x75, 0x85, 0x74, 0x4d, 0x55, 0x24, 0x25, 0x25, 0x3f,
-    0x3f, 0x6d, 0x81, 0x81, 0x6d, 0x6d, 0x6d, 0x52, 0x16, 0x16, 0x16, 0x16,
-    0x21, 0x35, 0x4c, 0x4a, 0x4a, 0x55, 0x46, 0x36, 0x1f, 0x19, 0x0a, 0x0c,
-    0x0a, 0x0d, 0x19, 0x54, 0x73, 0x58, 0x58, 0x54, 0x46, 0x46, 0x46, 0x2e,
-    0x1f, 0x2b, 0x2b, 0x19, 0x12, 0x14, 0x1a, 0x21, 0x21, 0x19, 0x14, 0x2d,
-    0x56, 0x78, 0x6c, 0x6b, 0x6b, 0x58, 0x47, 0x2a, 0x0a, 0x0c, 0x1c, 0x19,
-    0x1b, 0x2b, 0x40, 0x47, 0x46, 0x51, 0x5e, 0x5e, 0x6f, 0xa0, 0xd1, 0xb2,
-    0xb7, 0x9f, 0x87, 0x64, 0x30, 0x5a, 0x6f, 0x60, 0x44, 0x45, 0x56, 0x67,
-    0x9d, 0xcf, 0xdd, 0xe3, 0xd2, 0xa0, 0x7d, 0x78, 0x86, 0x8c, 0x8c, 0xaa,
-    0xb1, 0xb2, 0xa0, 0x55, 0x55, 0x55, 0x47, 0x21, 0x03, 0x05, 0x0b, 0x08,
-    0x08, 0x06, 0x03, 0x03, 0x03, 0x05, 0x08, 0x07, 0x0a, 0x0d, 0x0c, 0x03,
-    0x00, 0x00, 0x00, 0x0b, 0x10, 0x0d, 0x19, 0x12, 0x07, 0x0a, 0x14, 0x1f,
-    0x0d, 0x0a, 0x0a, 0x0a, 0x1e, 0x1d, 0x2d, 0x47, 0x47, 0x55, 0x47, 0x47,
-    0x46, 0x3e, 0x2f, 0x1e, 0x1f, 0x28, 0x2d, 0x3e, 0x30, 0x45, 0x48, 0x3d,
-    0x48, 0x56, 0x60, 0x68, 0x5b, 0x70, 0x88, 0x9c, 0xa5, 0xa5, 0x6c, 0x53,
-    0x5a, 0xb1, 0x7d, 0xb4, 0x9a, 0x87, 0x45, 0x37, 0x4b, 0x57, 0x68, 0x7f,
-    0x71, 0x71, 0x7f, 0x71, 0x7a, 0x7a, 0xa2, 0xb2, 0xb4, 0x78, 0x60, 0x87,
-    0x9a, 0x9a, 0xa0, 0x81, 0xf3, 0xf3, 0xe4, 0xe4, 0xe4, 0xe3, 0xe4, 0xe3,
-    0xd3, 0xb7, 0xbe, 0xac, 0xae, 0xd3, 0xce, 0xa3, 0x91, 0xaa, 0xaf, 0xa3,
-    0x91, 0x86, 0x78, 0x9f, 0xbe, 0xdf, 0xd9, 0xc6, 0xaf, 0x85, 0x6f, 0x5e,
-    0x61, 0x6b, 0x58, 0x58, 0x57, 0x57, 0x58, 0x6c, 0x77, 0x78, 0x9d, 0xe4,
-    0xe3, 0xe2, 0xde, 0xb0, 0xb0, 0xac, 0xa3, 0x91, 0x98, 0x96, 0x7f, 0x85,
-    0xa1, 0xd3, 0xd0, 0xb3, 0x96, 0x96, 0x83, 0x7b, 0x63, 0x6b, 0x4d, 0x50,
-    0x4d, 0x63, 0x63, 0x63, 0x74, 0x85, 0x84, 0x63, 0x63, 0x4d, 0x37, 0x3a,
-    0x29, 0x36, 0x3a, 0x37, 0x30, 0x51, 0x4b, 0x72, 0xdd, 0xe0, 0xca, 0xa6,
-    0x97, 0xdc, 0xeb, 0xdc, 0xdc, 0xbe, 0x97, 0x73, 0x75, 0xdf, 0xd1, 0xbc,
-    0xa6, 0x83, 0x74, 0x61, 0x4a, 0x2f, 0x19, 0x12, 0x21, 0x4c, 0x69, 0x61,
-    0x63, 0x4d, 0x46, 0x40, 0x19, 0x24, 0x24, 0x52, 0x6d, 0x81, 0x7b, 0x7b,
-    0x7b, 0x77, 0x6a, 0x6d, 0x2f, 0x24, 0x16, 0x19, 0x2f, 0x40, 0x4a, 0x46,
-    0x61, 0x61, 0x4d, 0x3a, 0x29, 0x19, 0x05, 0x05, 0x08, 0x0b, 0x09, 0x0c,
-    0x1e, 0x3e, 0x46, 0x54, 0x29, 0x21, 0x36, 0x2f, 0x12, 0x24, 0x2b, 0x1e,
-    0x2b, 0x2b, 0x1a, 0x1e, 0x2a, 0x2a, 0x19, 0x2f, 0x28, 0x60, 0x5a, 0x6b,
-    0x58, 0x50, 0x2e, 0x0d, 0x07, 0x08, 0x0b, 0x13, 0x10, 0x1e, 0x3d, 0x3e,
-    0x3e, 0x3a, 0x53, 0x86, 0xbb, 0xdc, 0xe0, 0xdc, 0xbc, 0xbb, 0xae, 0xa0,
-    0x55, 0x5e, 0x5e, 0x47, 0x2c, 0x53, 0x7d, 0xb4, 0xd1, 0xd9, 0xd9, 0xe0,
-    0xdd, 0xce, 0xb4, 0x86, 0x74, 0x8c, 0x8c, 0xaa, 0xa2, 0xaa, 0x9f, 0x64,
-    0x47, 0x55, 0x40, 0x22, 0x03, 0x03, 0x0b, 0x0c, 0x08, 0x06, 0x05, 0x05,
-    0x07, 0x0c, 0x0d, 0x12, 0x1c, 0x19, 0x12, 0x0a, 0x03, 0x00, 0x02, 0x13,
-    0x14, 0x12, 0x14, 0x0d, 0x0d, 0x0a, 0x0d, 0x19, 0x10, 0x1b, 0x1c, 0x10,
-    0x2a, 0x28, 0x1f, 0x3e, 0x3e, 0x44, 0x51, 0x51, 0x54, 0x47, 0x28, 0x1f,
-    0x1f, 0x2d, 0x2d, 0x2d, 0x3e, 0x48, 0x48, 0x67, 0x67, 0x45, 0x37, 0x32,
-    0x42, 0x4b, 0x5b, 0x5c, 0x7c, 0x7f, 0x72, 0x8c, 0x8c, 0xb1, 0xd3, 0xd4,
-    0xb4, 0xb1, 0x87, 0x30, 0x37, 0x2c, 0x37, 0x57, 0x4b, 0x57, 0x6b, 0x51,
-    0x86, 0x86, 0x8c, 0x8c, 0x82, 0x7a, 0x7a, 0x9a, 0x7a, 0xa2, 0xae, 0x7e,
-    0xee, 0xe3, 0xd4, 0xd4, 0xd3, 0xe3, 0xd3, 0xd3, 0xd3, 0xb7, 0x9f, 0x9f,
-    0xae, 0xce, 0xbc, 0x97, 0x91, 0x98, 0x84, 0x85, 0x91, 0x9f, 0x91, 0x91,
-    0xa3, 0xaf, 0xaf, 0xa6, 0x96, 0x75, 0x54, 0x46, 0x46, 0x4d, 0x43, 0x50,
-    0x4d, 0x43, 0x5e, 0x86, 0x9f, 0xb2, 0xd3, 0xf3, 0xee, 0xdf, 0xbc, 0xbc,
-    0xac, 0xa3, 0x84, 0x73, 0x83, 0x7f, 0x7f, 0x75, 0x7e, 0xd1, 0xbe, 0xac,
-    0x98, 0x83, 0x73, 0x74, 0x63, 0x4d, 0x46, 0x4d, 0x4d, 0x4d, 0x7b, 0x61,
-    0x63, 0x74, 0x74, 0x54, 0x4d, 0x46, 0x2e, 0x27, 0x1f, 0x36, 0x47, 0x5e,
-    0x60, 0x51, 0x43, 0x42, 0x60, 0xdf, 0xce, 0xbc, 0xaf, 0xbb, 0xee, 0xe7,
-    0xc8, 0xca, 0x97, 0x84, 0x6b, 0x75, 0xce, 0xac, 0x96, 0x83, 0x73, 0x4d,
-    0x46, 0x36, 0x2b, 0x24, 0x24, 0x2f, 0x4c, 0x47, 0x5e, 0x1f, 0x24, 0x3f,
-    0x25, 0x19, 0x40, 0x81, 0x6d, 0x61, 0x74, 0x84, 0x75, 0x6b, 0x6f, 0x6a,
-    0x19, 0x0c, 0x16, 0x19, 0x24, 0x36, 0x46, 0x4d, 0x63, 0x61, 0x4d, 0x3a,
-    0x27, 0x19, 0x08, 0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x03, 0x05, 0x0b,
-    0x02, 0x0b, 0x21, 0x05, 0x16, 0x19, 0x1f, 0x1f, 0x3e, 0x2e, 0x27, 0x1f,
-    0x2d, 0x2f, 0x1b, 0x10, 0x0d, 0x10, 0x2f, 0x3e, 0x46, 0x37, 0x27, 0x1b,
-    0x0d, 0x0a, 0x0c, 0x0c, 0x12, 0x20, 0x33, 0x2f, 0x28, 0x1d, 0x53, 0xaf,
-    0xca, 0xd9, 0xd9, 0xd5, 0xbc, 0xc6, 0xaa, 0xae, 0x6f, 0x7d, 0x6a, 0x40,
-    0x40, 0x6f, 0xae, 0xcf, 0xce, 0xd5, 0xd9, 0xd9, 0xd5, 0xd5, 0xcf, 0xa0,
-    0x86, 0x8c, 0x7f, 0x8c, 0xa2, 0xa2, 0x9a, 0x64, 0x55, 0x55, 0x48, 0x35,
-    0x03, 0x03, 0x06, 0x08, 0x08, 0x03, 0x03, 0x08, 0x0a, 0x12, 0x0d, 0x16,
-    0x19, 0x19, 0x12, 0x0a, 0x05, 0x02, 0x02, 0x13, 0x1b, 0x14, 0x10, 0x14,
-    0x1e, 0x19, 0x14, 0x10, 0x14, 0x1e, 0x1e, 0x10, 0x1e, 0x2a, 0x14, 0x2a,
-    0x3e, 0x37, 0x44, 0x51, 0x55, 0x2d, 0x1e, 0x2b, 0x2b, 0x3d, 0x3d, 0x49,
-    0x3d, 0x56, 0x64, 0x87, 0x78, 0x30, 0x2c, 0x2c, 0x32, 0x32, 0x42, 0x4b,
-    0x68, 0x58, 0x6c, 0x8c, 0x93, 0xa5, 0xaa, 0xcf, 0xbe, 0xaa, 0xa3, 0x30,
-    0x23, 0x45, 0x64, 0x45, 0x30, 0x51, 0x51, 0x51, 0x86, 0x7a, 0x7a, 0x58,
-    0x58, 0x53, 0x51, 0x7a, 0x86, 0x72, 0x84, 0x6b, 0xce, 0xb7, 0xd3, 0xd3,
-    0xd3, 0xd3, 0xb7, 0xb7, 0xba, 0xa1, 0xa0, 0xa0, 0x9f, 0xa3, 0x97, 0x84,
-    0x7b, 0x75, 0x6f, 0x86, 0xae, 0xae, 0x91, 0x85, 0x84, 0x83, 0x83, 0x83,
-    0x74, 0x61, 0x3e, 0x3e, 0x3e, 0x3a, 0x3a, 0x47, 0x3e, 0x47, 0x7e, 0x9f,
-    0xbc, 0xce, 0xe1, 0xee, 0xe3, 0xce, 0xa3, 0xa3, 0xa3, 0x91, 0x84, 0x73,
-    0x73, 0x71, 0x73, 0x85, 0x91, 0x86, 0xb7, 0xd1, 0xb0, 0x83, 0x73, 0x63,
-    0x63, 0x4d, 0x7b, 0x61, 0x4d, 0x54, 0x7b, 0x61, 0x63, 0x63, 0x6d, 0x6d,
-    0x54, 0x61, 0x5e, 0x2a, 0x2b, 0x47, 0x77, 0x75, 0x6b, 0x43, 0x37, 0x2c,
-    0x30, 0x8f, 0xe5, 0xe4, 0xbb, 0xae, 0xe1, 0xe6, 0xc8, 0xaf, 0x96, 0x83,
-    0x66, 0x63, 0x91, 0x75, 0xac, 0xa3, 0x75, 0x4d, 0x46, 0x55, 0x4a, 0x40,
-    0x4a, 0x2f, 0x2b, 0x1f, 0x2f, 0x1b, 0x19, 0x3c, 0x3f, 0x35, 0x2f, 0x55,
-    0x7e, 0x75, 0x74, 0x91, 0x98, 0x74, 0x61, 0x4c, 0x16, 0x0c, 0x16, 0x24,
-    0x24, 0x36, 0x36, 0x4d, 0x4d, 0x63, 0x4d, 0x3a, 0x29, 0x12, 0x09, 0x00,
-    0x00, 0x00, 0x03, 0x05, 0x03, 0x02, 0x03, 0x06, 0x03, 0x03, 0x03, 0x08,
-    0x16, 0x12, 0x24, 0x2f, 0x3e, 0x2e, 0x2e, 0x3e, 0x27, 0x27, 0x1a, 0x1e,
-    0x12, 0x0d, 0x1e, 0x48, 0x55, 0x53, 0x3e, 0x2e, 0x2b, 0x1e, 0x1c, 0x12,
-    0x0a, 0x0a, 0x05, 0x06, 0x20, 0x2a, 0x9f, 0xbb, 0xca, 0xca, 0xca, 0xca,
-    0xbc, 0xbc, 0xbb, 0x9f, 0x91, 0x86, 0x77, 0x5e, 0x77, 0x6c, 0xac, 0xbc,
-    0xce, 0xbc, 0xd9, 0xca, 0xca, 0xc6, 0xbe, 0xb1, 0x85, 0x85, 0x85, 0x8c,
-    0x8c, 0x8c, 0x87, 0x78, 0x55, 0x3e, 0x40, 0x16, 0x06, 0x02, 0x03, 0x08,
-    0x08, 0x08, 0x08, 0x07, 0x12, 0x19, 0x19, 0x0d, 0x19, 0x19, 0x0d, 0x07,
-    0x05, 0x05, 0x03, 0x0a, 0x10, 0x14, 0x10, 0x14, 0x1f, 0x1a, 0x1e, 0x1e,
-    0x14, 0x1b, 0x1f, 0x1b, 0x14, 0x21, 0x0a, 0x10, 0x28, 0x2e, 0x28, 0x28,
-    0x2e, 0x1f, 0x1b, 0x2b, 0x2d, 0x3d, 0x2a, 0x49, 0x49, 0x56, 0x45, 0x60,
-    0x53, 0x23, 0x23, 0x23, 0x23, 0x23, 0x37, 0x32, 0x43, 0x37, 0x51, 0x7a,
-    0x68, 0x71, 0x7f, 0x94, 0x97, 0x97, 0x85, 0x5e, 0x3d, 0x56, 0x9b, 0x7d,
-    0xb9, 0x3d, 0x45, 0x1d, 0x28, 0x37, 0x44, 0x2c, 0x5a, 0x45, 0x64, 0x9b,
-    0x77, 0x51, 0x44, 0x3a, 0xac, 0xac, 0xae, 0xb7, 0xba, 0xba, 0xb7, 0xa1,
-    0xa1, 0xa1, 0x80, 0xa1, 0xa1, 0x91, 0x84, 0x63, 0x7b, 0x7b, 0x7e, 0x87,
-    0xac, 0xac, 0xa3, 0x77, 0x61, 0x4d, 0x63, 0x58, 0x54, 0x55, 0x4c, 0x4c,
-    0x48, 0x3e, 0x2e, 0x2e, 0x36, 0x55, 0x7b, 0xac, 0xbc, 0xc6, 0xce, 0xe0,
-    0xe0, 0xac, 0x98, 0x91, 0x84, 0x7b, 0x74, 0x6b, 0x6b, 0x6b, 0x74, 0x84,
-    0x84, 0x7b, 0xb7, 0xd1, 0xbc, 0x96, 0x83, 0x73, 0x6b, 0x58, 0x54, 0x69,
-    0x61, 0x4d, 0x36, 0x3a, 0x4d, 0x39, 0x4a, 0x6d, 0x63, 0x63, 0x5e, 0x52,
-    0x35, 0x46, 0x6b, 0x74, 0x58, 0x51, 0x48, 0x34, 0x31, 0xd4, 0xe5, 0xe1,
-    0xdc, 0xe5, 0xe5, 0xdd, 0xd5, 0xbc, 0x96, 0x83, 0x73, 0x6b, 0x58, 0x54,
-    0x9f, 0x9f, 0x61, 0x6f, 0x5e, 0x69, 0x69, 0x69, 0x6d, 0x4a, 0x4a, 0x2b,
-    0x2f, 0x2b, 0x19, 0x22, 0x25, 0x2f, 0x40, 0x55, 0x7e, 0x75, 0x73, 0x84,
-    0x73, 0x6b, 0x46, 0x24, 0x25, 0x16, 0x25, 0x24, 0x24, 0x29, 0x36, 0x46,
-    0x39, 0x4d, 0x39, 0x2e, 0x1f, 0x03, 0x02, 0x00, 0x02, 0x06, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x08, 0x08, 0x08, 0x05, 0x0c, 0x13, 0x2f, 0x48,
-    0x47, 0x3e, 0x55, 0x47, 0x2e, 0x2e, 0x28, 0x2b, 0x19, 0x1b, 0x47, 0x6f,
-    0x6f, 0x60, 0x51, 0x47, 0x3d, 0x33, 0x2a, 0x12, 0x0a, 0x12, 0x13, 0x05,
-    0x4e, 0x77, 0xac, 0xbc, 0xce, 0xb6, 0xb6, 0xb0, 0xbc, 0xac, 0xac, 0xa0,
-    0x8c, 0x86, 0x61, 0x61, 0x77, 0x75, 0xa3, 0xaa, 0xce, 0xce, 0xaf, 0xb6,
-    0xb6, 0xbb, 0xd1, 0xb2, 0x7d, 0x9d, 0x87, 0x84, 0x82, 0x85, 0x87, 0x60,
-    0x2d, 0x2f, 0x1f, 0x1c, 0x03, 0x02, 0x06, 0x08, 0x0a, 0x13, 0x12, 0x12,
-    0x14, 0x1f, 0x1f, 0x1b, 0x19, 0x12, 0x0a, 0x07, 0x0a, 0x0a, 0x07, 0x0a,
-    0x0a, 0x0d, 0x14, 0x1b, 0x1a, 0x14, 0x1f, 0x1d, 0x1f, 0x1f, 0x1f, 0x2f,
-    0x1e, 0x19, 0x0d, 0x0d, 0x14, 0x1d, 0x1b, 0x14, 0x1d, 0x2f, 0x2b, 0x2d,
-    0x3d, 0x48, 0x49, 0x4f, 0x3d, 0x30, 0x45, 0x45, 0x30, 0x1d, 0x1a, 0x1a,
-    0x1d, 0x27, 0x23, 0x2c, 0x37, 0x2c, 0x53, 0x4b, 0x4b, 0x57, 0x66, 0x66,
-    0x71, 0x85, 0x6c, 0x77, 0x9d, 0x67, 0xb2, 0xb4, 0xb4, 0x7d, 0x7d, 0x2a,
-    0x28, 0x60, 0x47, 0x56, 0x67, 0x33, 0x48, 0x45, 0x2c, 0x51, 0x2e, 0x2e,
-    0xac, 0x9f, 0x9f, 0x9f, 0xa1, 0xa1, 0xa1, 0x7e, 0x7e, 0x7e, 0x81, 0xa1,
-    0x7e, 0x75, 0x63, 0x61, 0x7b, 0x7b, 0x77, 0x7b, 0x97, 0x97, 0x84, 0x61,
-    0x55, 0x47, 0x47, 0x47, 0x5e, 0x7e, 0x7e, 0x7e, 0x64, 0x45, 0x2e, 0x1f,
-    0x24, 0x4c, 0x86, 0xa2, 0xaf, 0xb5, 0xb6, 0xbb, 0xd1, 0xce, 0x98, 0x97,
-    0x84, 0x74, 0x74, 0x58, 0x58, 0x58, 0x73, 0x83, 0x83, 0x74, 0x91, 0xd3,
-    0xb7, 0xac, 0x98, 0x73, 0x50, 0x4d, 0x54, 0x4a, 0x54, 0x4d, 0x3a, 0x36,
-    0x3a, 0x46, 0x36, 0x46, 0x63, 0x63, 0x54, 0x4c, 0x4a, 0x44, 0x50, 0x58,
-    0x50, 0x44, 0x47, 0x4e, 0x4f, 0xc4, 0xf3, 0xe8, 0xd7, 0xf2, 0xf2, 0xd2,
-    0xd3, 0xd1, 0xaf, 0x83, 0x91, 0x74, 0x43, 0x46, 0x80, 0x6d, 0x7e, 0x7e,
-    0x81, 0xa1, 0xa0, 0x7e, 0x6d, 0x69, 0x4c, 0x36, 0x40, 0x24, 0x1b, 0x12,
-    0x21, 0x19, 0x2b, 0x5e, 0x7e, 0x61, 0x6b, 0x6b, 0x58, 0x4d, 0x4a, 0x1c,
-    0x18, 0x15, 0x16, 0x19, 0x24, 0x29, 0x36, 0x36, 0x3a, 0x3a, 0x27, 0x2b,
-    0x19, 0x02, 0x00, 0x06, 0x16, 0x19, 0x19, 0x12, 0x1c, 0x1c, 0x12, 0x0c,
-    0x0c, 0x12, 0x12, 0x0c, 0x05, 0x1c, 0x2d, 0x48, 0x55, 0x55, 0x5e, 0x46,
-    0x46, 0x3e, 0x1d, 0x1f, 0x0a, 0x1e, 0x55, 0x75, 0x75, 0x6b, 0x50, 0x51,
-    0x47, 0x2b, 0x2f, 0x1c, 0x1c, 0x1c, 0x12, 0x07, 0x33, 0x91, 0xac, 0xbb,
-    0xb0, 0xa6, 0x98, 0xbc, 0xac, 0xac, 0xa3, 0xae, 0x84, 0x75, 0x5e, 0x61,
-    0x6f, 0x9f, 0xb7, 0x97, 0xa6, 0xbc, 0xa6, 0xc6, 0xbb, 0xaa, 0xd3, 0xd3,
-    0xb4, 0xb4, 0xa0, 0x75, 0x86, 0xa0, 0x9d, 0x7d, 0x81, 0x4e, 0x21, 0x15,
-    0x03, 0x06, 0x0b, 0x13, 0x1c, 0x12, 0x12, 0x1b, 0x1f, 0x2b, 0x2b, 0x1f,
-    0x19, 0x0d, 0x0d, 0x12, 0x1c, 0x10, 0x0d, 0x0a, 0x12, 0x10, 0x1e, 0x2b,
-    0x1f, 0x1d, 0x28, 0x27, 0x29, 0x40, 0x2f, 0x2f, 0x1e, 0x1e, 0x14, 0x10,
-    0x14, 0x1f, 0x1f, 0x1f, 0x1f, 0x28, 0x28, 0x3d, 0x56, 0x56, 0x56, 0x49,
-    0x3d, 0x56, 0x64, 0x49, 0x2d, 0x1d, 0x1a, 0x1d, 0x1a, 0x27, 0x1a, 0x1a,
-    0x27, 0x37, 0x51, 0x2c, 0x37, 0x43, 0x50, 0x50, 0x50, 0x6c, 0x51, 0x4b,
-    0x93, 0x8c, 0xa2, 0xb1, 0xb4, 0x9a, 0x87, 0x48, 0x3d, 0x64, 0x87, 0x87,
-    0x7d, 0x6a, 0x1e, 0x1d, 0x28, 0x1d, 0x1d, 0x1d, 0xac, 0x91, 0x7e, 0x7e,
-    0x81, 0x81, 0x7e, 0x7b, 0x61, 0x5e, 0x5e, 0x7b, 0x7b, 0x61, 0x54, 0x61,
-    0x7b, 0x7b, 0x7b, 0x61, 0x63, 0x63, 0x61, 0x5e, 0x55, 0x4c, 0x4c, 0x4c,
-    0x7e, 0x9f, 0xac, 0xa3, 0x86, 0x5e, 0x28, 0x1b, 0x21, 0x4a, 0x75, 0x97,
-    0xa6, 0x94, 0x94, 0xcf, 0xe4, 0xd1, 0xac, 0x97, 0x84, 0x63, 0x63, 0x58,
-    0x43, 0x50, 0x6b, 0x68, 0x57, 0x58, 0x77, 0xa0, 0xd3, 0xd1, 0x9f, 0x84,
-    0x63, 0x61, 0x61, 0x4d, 0x4d, 0x4d, 0x3a, 0x3a, 0x46, 0x46, 0x36, 0x46,
-    0x4d, 0x4d, 0x43, 0x43, 0x4d, 0x44, 0x37, 0x3a, 0x46, 0x27, 0x1d, 0x4f,
-    0xe5, 0xfc, 0xfc, 0xeb, 0xe3, 0xe4, 0xe4, 0xd4, 0xb9, 0xbe, 0xaf, 0x97,
-    0xac, 0x74, 0x50, 0x37, 0x4c, 0x36, 0x81, 0xb7, 0xba, 0xba, 0xb7, 0x91,
-    0x9f, 0x7b, 0x5e, 0x55, 0x4a, 0x2f, 0x2b, 0x0d, 0x21, 0x19, 0x14, 0x47,
-    0x47, 0x4a, 0x61, 0x50, 0x46, 0x2b, 0x19, 0x09, 0x05, 0x0c, 0x12, 0x19,
-    0x1b, 0x2b, 0x29, 0x36, 0x29, 0x29, 0x1f, 0x19, 0x0c, 0x02, 0x05, 0x19,
-    0x1f, 0x1f, 0x1f, 0x21, 0x21, 0x21, 0x19, 0x12, 0x12, 0x1c, 0x19, 0x0d,
-    0x08, 0x1c, 0x2d, 0x64, 0x64, 0x6f, 0x5e, 0x51, 0x44, 0x2e, 0x1d, 0x14,
-    0x0d, 0x1e, 0x54, 0x6b, 0x74, 0x6b, 0x6c, 0x44, 0x64, 0x4c, 0x2a, 0x33,
-    0x33, 0x4e, 0x4e, 0x0a, 0x20, 0x9f, 0xa2, 0xaf, 0x96, 0x98, 0x98, 0xac,
-    0x98, 0x98, 0x83, 0xa2, 0x91, 0x84, 0x69, 0x5e, 0x6f, 0x9f, 0xb4, 0xa3,
-    0x96, 0x96, 0x96, 0xbc, 0x97, 0xaa, 0xd3, 0xe3, 0xe1, 0xeb, 0xeb, 0xe3,
-    0xd3, 0xd2, 0xd2, 0xd2, 0xcf, 0xd3, 0x8f, 0x22, 0x05, 0x08, 0x08, 0x0d,
-    0x10, 0x12, 0x12, 0x19, 0x1f, 0x1d, 0x28, 0x1f, 0x19, 0x19, 0x1b, 0x1e,
-    0x1b, 0x0d, 0x0a, 0x0a, 0x1b, 0x14, 0x1b, 0x1d, 0x1a, 0x27, 0x2e, 0x27,
-    0x3e, 0x3e, 0x2e, 0x33, 0x33, 0x1e, 0x1b, 0x1b, 0x1e, 0x1e, 0x1d, 0x28,
-    0x1f, 0x2e, 0x2e, 0x3d, 0x56, 0x56, 0x67, 0x49, 0x3d, 0x64, 0x7d, 0x7d,
-    0x64, 0x48, 0x1e, 0x14, 0x14, 0x27, 0x1d, 0x1e, 0x14, 0x27, 0x30, 0x27,
-    0x27, 0x27, 0x2e, 0x44, 0x2e, 0x30, 0x30, 0x2c, 0x57, 0x71, 0x93, 0xa2,
-    0x9a, 0xa2, 0x6c, 0x51, 0x7d, 0x87, 0x7a, 0x87, 0x78, 0x67, 0x1e, 0x1e,
-    0x33, 0x2b, 0x2a, 0x1e, 0xac, 0x7b, 0x7b, 0x6f, 0x5e, 0x5e, 0x5e, 0x54,
-    0x4a, 0x4a, 0x55, 0x61, 0x63, 0x4d, 0x46, 0x54, 0x63, 0x63, 0x61, 0x4a,
-    0x4a, 0x55, 0x6d, 0x7e, 0x7e, 0x81, 0x69, 0x69, 0x7b, 0xac, 0xbc, 0xaa,
-    0x93, 0x61, 0x2a, 0x1c, 0x21, 0x4a, 0x61, 0x74, 0x71, 0x70, 0x70, 0xa2,
-    0xe3, 0xe1, 0xd1, 0xbc, 0x91, 0x74, 0x57, 0x50, 0x43, 0x54, 0x61, 0x58,
-    0x4b, 0x63, 0x63, 0x58, 0x6c, 0xb7, 0xd3, 0xbc, 0xa3, 0x7e, 0x7b, 0x58,
-    0x63, 0x4d, 0x46, 0x36, 0x46, 0x54, 0x55, 0x36, 0x27, 0x3a, 0x50, 0x50,
-    0x58, 0x46, 0x27, 0x27, 0x2e, 0x1a, 0x1b, 0x6a, 0xec, 0xfc, 0xfa, 0xeb,
-    0xe1, 0xdd, 0xdc, 0xdd, 0xba, 0xce, 0xbc, 0xaa, 0xaf, 0x73, 0x81, 0x81,
-    0x51, 0x27, 0x6a, 0xba, 0xd3, 0xd3, 0xae, 0x97, 0x84, 0x74, 0x75, 0x5e,
-    0x4c, 0x36, 0x36, 0x12, 0x0a, 0x0c, 0x19, 0x2b, 0x36, 0x2b, 0x4a, 0x36,
-    0x2b, 0x1c, 0x0c, 0x18, 0x05, 0x08, 0x16, 0x16, 0x0d, 0x19, 0x1f, 0x1a,
-    0x1f, 0x19, 0x12, 0x0c, 0x03, 0x03, 0x16, 0x2b, 0x36, 0x36, 0x2f, 0x2f,
-    0x2b, 0x2b, 0x1e, 0x19, 0x1c, 0x1e, 0x1b, 0x0d, 0x07, 0x12, 0x33, 0x56,
-    0x64, 0x6f, 0x61, 0x50, 0x43, 0x3a, 0x2b, 0x1b, 0x0a, 0x2f, 0x5a, 0x6c,
-    0x6b, 0x6b, 0x5a, 0x60, 0x78, 0x81, 0x4e, 0x49, 0x48, 0x47, 0x69, 0x22,
-    0x4e, 0x91, 0x97, 0xaf, 0x97, 0xa3, 0x98, 0x98, 0x98, 0x91, 0x73, 0x71,
-    0x83, 0x84, 0x81, 0x9f, 0xaa, 0xdc, 0xe0, 0xe1, 0xbe, 0x91, 0x91, 0x91,
-    0x91, 0xd1, 0xe4, 0xe3, 0xeb, 0xed, 0xeb, 0xeb, 0xe0, 0xd2, 0xd2, 0xce,
-    0xd9, 0xdd, 0xe3, 0x4f, 0x0b, 0x08, 0x0b, 0x0a, 0x0d, 0x0d, 0x0d, 0x1b,
-    0x1f, 0x1d, 0x1f, 0x1f, 0x1b, 0x2a, 0x2a, 0x1f, 0x1b, 0x0a, 0x07, 0x07,
-    0x1b, 0x10, 0x1b, 0x1a, 0x1d, 0x2e, 0x27, 0x27, 0x3a, 0x3a, 0x3e, 0x48,
-    0x3d, 0x1e, 0x1b, 0x14, 0x1e, 0x1e, 0x1d, 0x27, 0x2f, 0x27, 0x3d, 0x2d,
-    0x47, 0x56, 0x49, 0x3d, 0x45, 0x64, 0x87, 0x87, 0x60, 0x45, 0x1c, 0x0a,
-    0x0a, 0x14, 0x28, 0x64, 0x4e, 0x1d, 0x1d, 0x2d, 0x1a, 0x1a, 0x27, 0x3e,
-    0x1d, 0x14, 0x31, 0x48, 0x44, 0x4b, 0x68, 0x7f, 0x7f, 0x72, 0x44, 0x37,
-    0x51, 0x58, 0x82, 0x9f, 0xa0, 0x64, 0x31, 0x49, 0x48, 0x48, 0x4e, 0x21,
-    0xac, 0x84, 0x7b, 0x7b, 0x69, 0x5e, 0x54, 0x55, 0x4c, 0x4a, 0x4a, 0x54,
-    0x4d, 0x3a, 0x36, 0x46, 0x46, 0x46, 0x4a, 0x36, 0x36, 0x6d, 0xa1, 0xae,
-    0xa3, 0x91, 0x6f, 0x5e, 0x7b, 0x98, 0x96, 0x96, 0x7f, 0x58, 0x2f, 0x2a,
-    0x2a, 0x2f, 0x54, 0x58, 0x58, 0x57, 0x57, 0x6b, 0xa0, 0xd3, 0xd3, 0xce,
-    0xa3, 0x83, 0x58, 0x4d, 0x4d, 0x61, 0x7b, 0x75, 0x58, 0x61, 0x61, 0x54,
-    0x6f, 0xba, 0xe3, 0xdc, 0xbc, 0xae, 0x7b, 0x63, 0x63, 0x61, 0x69, 0x46,
-    0x46, 0x47, 0x6d, 0x36, 0x27, 0x3a, 0x63, 0x58, 0x50, 0x47, 0x2f, 0x1f,
-    0x1f, 0x1f, 0x2a, 0x9e, 0xfc, 0xfa, 0xeb, 0xdc, 0xd7, 0xca, 0xca, 0xa5,
-    0xe4, 0xe3, 0xd5, 0xbc, 0xac, 0xa3, 0xba, 0xa0, 0x6c, 0x3a, 0x80, 0xb9,
-    0xe4, 0xe3, 0xbe, 0xac, 0xa3, 0x73, 0x63, 0x54, 0x5e, 0x29, 0x2b, 0x19,
-    0x12, 0x12, 0x21, 0x24, 0x19, 0x14, 0x14, 0x19, 0x21, 0x1c, 0x19, 0x16,
-    0x15, 0x08, 0x08, 0x08, 0x05, 0x0b, 0x19, 0x16, 0x08, 0x08, 0x05, 0x00,
-    0x00, 0x09, 0x21, 0x36, 0x47, 0x36, 0x36, 0x36, 0x2f, 0x2f, 0x21, 0x2a,
-    0x2a, 0x1e, 0x14, 0x12, 0x0d, 0x0d, 0x1c, 0x4e, 0x5e, 0x5a, 0x6c, 0x54,
-    0x44, 0x2c, 0x27, 0x19, 0x0a, 0x1e, 0x61, 0x5a, 0x61, 0x85, 0xa2, 0x8c,
-    0x85, 0x91, 0x9f, 0x64, 0x7e, 0x5e, 0x5e, 0x47, 0x46, 0x77, 0x6b, 0x74,
-    0xa3, 0x98, 0x73, 0x73, 0x73, 0xac, 0x91, 0x6b, 0x50, 0x73, 0xac, 0xce,
-    0xd9, 0xea, 0xeb, 0xed, 0xdc, 0xd1, 0xa0, 0xa1, 0xb7, 0xce, 0xe0, 0xe1,
-    0xea, 0xed, 0xed, 0xe7, 0xdd, 0xe1, 0xcf, 0xce, 0xc6, 0xd5, 0xd5, 0x9d,
-    0x4f, 0x59, 0x3c, 0x13, 0x12, 0x12, 0x1c, 0x33, 0x2f, 0x28, 0x2b, 0x1f,
-    0x28, 0x2d, 0x2d, 0x1b, 0x12, 0x07, 0x05, 0x05, 0x07, 0x14, 0x1f, 0x28,
-    0x2f, 0x2e, 0x2e, 0x3a, 0x37, 0x46, 0x47, 0x3e, 0x3d, 0x1b, 0x1c, 0x1b,
-    0x1b, 0x1e, 0x1e, 0x1d, 0x2e, 0x2e, 0x2d, 0x2e, 0x44, 0x48, 0x2d, 0x45,
-    0x64, 0x7d, 0x87, 0x86, 0x77, 0x53, 0x49, 0x13, 0x07, 0x10, 0x1d, 0x51,
-    0x47, 0x3d, 0x3d, 0x48, 0x1b, 0x10, 0x1d, 0x28, 0x14, 0x10, 0x2d, 0x45,
-    0x30, 0x43, 0x43, 0x50, 0x4b, 0x46, 0x2e, 0x1d, 0x56, 0x51, 0x58, 0x75,
-    0x6c, 0x47, 0x1f, 0x3d, 0x45, 0x53, 0x69, 0x2a, 0xac, 0x84, 0x75, 0x7b,
-    0x7e, 0x69, 0x5e, 0x55, 0x4a, 0x40, 0x4a, 0x36, 0x36, 0x36, 0x36, 0x36,
-    0x36, 0x36, 0x36, 0x4a, 0x4c, 0x7e, 0xa3, 0xac, 0x97, 0x84, 0x61, 0x55,
-    0x61, 0x73, 0x73, 0x73, 0x6b, 0x54, 0x40, 0x2f, 0x2a, 0x2f, 0x3e, 0x3a,
-    0x44, 0x43, 0x42, 0x44, 0x78, 0xd3, 0xd2, 0xce, 0xaa, 0x98, 0x75, 0x7b,
-    0x61, 0x6f, 0x7b, 0x75, 0x6b, 0x61, 0x61, 0x54, 0x6c, 0x85, 0xb2, 0xd2,
-    0xbe, 0xbc, 0x98, 0x73, 0x63, 0x7b, 0x5e, 0x54, 0x3a, 0x36, 0x4a, 0x36,
-    0x36, 0x36, 0x46, 0x4d, 0x44, 0x3e, 0x40, 0x2f, 0x3d, 0x28, 0x34, 0xec,
-    0xfc, 0xfa, 0xf3, 0xe3, 0xdd, 0xd2, 0xcc, 0xb1, 0xf3, 0xf0, 0xe1, 0xe1,
-    0xce, 0x97, 0x75, 0x91, 0x75, 0x47, 0x6a, 0xa0, 0xb4, 0xd2, 0xbe, 0xbc,
-    0x98, 0x83, 0x66, 0x58, 0x54, 0x1a, 0x1a, 0x1f, 0x1f, 0x21, 0x24, 0x2b,
-    0x1f, 0x28, 0x2f, 0x1f, 0x21, 0x22, 0x19, 0x16, 0x08, 0x06, 0x05, 0x05,
-    0x03, 0x03, 0x0c, 0x09, 0x05, 0x05, 0x05, 0x06, 0x02, 0x0c, 0x24, 0x3e,
-    0x47, 0x46, 0x36, 0x36, 0x40, 0x40, 0x24, 0x24, 0x24, 0x1e, 0x1b, 0x1e,
-    0x19, 0x12, 0x0c, 0x1b, 0x47, 0x54, 0x61, 0x50, 0x3a, 0x27, 0x19, 0x0a,
-    0x20, 0x2d, 0x55, 0x77, 0xa3, 0xbe, 0xc6, 0xbb, 0x97, 0xa2, 0x97, 0x75,
-    0x7b, 0x7e, 0x7b, 0x36, 0x3a, 0x77, 0x6f, 0x6e, 0xae, 0x97, 0x84, 0x91,
-    0x74, 0xa3, 0x9f, 0x7b, 0x4d, 0x74, 0xce, 0xdc, 0xe7, 0xe7, 0xe7, 0xdc,
-    0xd5, 0xce, 0xba, 0xba, 0xac, 0xc6, 0xd5, 0xd7, 0xd5, 0xe0, 0xe0, 0xd5,
-    0xd9, 0xd2, 0xc6, 0xbb, 0xce, 0xc6, 0xce, 0xb2, 0xb4, 0xb4, 0xb4, 0x7d,
-    0x34, 0x1e, 0x1b, 0x2b, 0x2e, 0x27, 0x1d, 0x28, 0x2e, 0x2e, 0x27, 0x1d,
-    0x14, 0x1c, 0x13, 0x08, 0x07, 0x1b, 0x1d, 0x2b, 0x1d, 0x27, 0x27, 0x3a,
-    0x43, 0x54, 0x55, 0x3d, 0x1e, 0x14, 0x20, 0x1b, 0x1c, 0x0a, 0x0a, 0x0a,
-    0x13, 0x1b, 0x1f, 0x1f, 0x28, 0x1d, 0x27, 0x44, 0x60, 0x78, 0x86, 0x77,
-    0x87, 0x64, 0x2a, 0x10, 0x08, 0x07, 0x1b, 0x30, 0x48, 0x45, 0x53, 0x51,
-    0x56, 0x34, 0x33, 0x14, 0x1b, 0x19, 0x12, 0x1c, 0x28, 0x2e, 0x2e, 0x2e,
-    0x3a, 0x2e, 0x1f, 0x3d, 0x67, 0x64, 0x37, 0x44, 0x37, 0x2e, 0x2b, 0x33,
-    0x31, 0x3d, 0x2f, 0x1e, 0x9f, 0x91, 0x7b, 0x7b, 0x6d, 0x69, 0x54, 0x54,
-    0x46, 0x4a, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x4a, 0x4a,
-    0x4c, 0x69, 0x98, 0x96, 0x7f, 0x73, 0x54, 0x47, 0x36, 0x4d, 0x50, 0x50,
-    0x43, 0x3e, 0x3d, 0x40, 0x33, 0x2f, 0x2b, 0x28, 0x27, 0x2e, 0x2c, 0x30,
-    0x67, 0xd4, 0xe1, 0xd5, 0xa5, 0x91, 0x91, 0x85, 0x61, 0x51, 0x5e, 0x75,
-    0x74, 0x63, 0x61, 0x54, 0x58, 0x6f, 0xb9, 0xe4, 0xd2, 0xaa, 0x91, 0x83,
-    0x63, 0x4d, 0x4d, 0x63, 0x3a, 0x29, 0x36, 0x36, 0x2f, 0x24, 0x36, 0x36,
-    0x2e, 0x3e, 0x5e, 0x5e, 0x5e, 0x47, 0x6e, 0xfc, 0xfc, 0xfa, 0xee, 0xd9,
-    0xe0, 0xe1, 0xc6, 0xe4, 0xfc, 0xfc, 0xee, 0xd9, 0xaf, 0x94, 0x71, 0x58,
-    0x61, 0x4a, 0x36, 0x46, 0x3e, 0xcf, 0xbb, 0xaf, 0x97, 0x83, 0x6b, 0x58,
-    0x27, 0x1a, 0x2b, 0x29, 0x36, 0x40, 0x36, 0x29, 0x27, 0x36, 0x2f, 0x24,
-    0x21, 0x25, 0x16, 0x08, 0x03, 0x02, 0x04, 0x03, 0x09, 0x08, 0x0c, 0x0c,
-    0x0c, 0x08, 0x08, 0x08, 0x03, 0x0c, 0x24, 0x3e, 0x3a, 0x46, 0x46, 0x4a,
-    0x4a, 0x36, 0x36, 0x1f, 0x2d, 0x2b, 0x1f, 0x1f, 0x2b, 0x1b, 0x0d, 0x13,
-    0x1e, 0x2d, 0x3e, 0x2e, 0x1f, 0x12, 0x05, 0x03, 0x20, 0x3d, 0x47, 0x86,
-    0xce, 0xe1, 0xdd, 0xc6, 0xbc, 0xbe, 0xa3, 0x86, 0x7b, 0x75, 0x61, 0x36,
-    0x2b, 0x61, 0x6d, 0xa1, 0xbc, 0xbc, 0xd9, 0xe0, 0xb7, 0x9f, 0xa3, 0x91,
-    0x7b, 0x85, 0xbc, 0xe0, 0xdf, 0xd9, 0xdb, 0xd7, 0xd5, 0xd1, 0xce, 0xce,
-    0xbc, 0xce, 0xbb, 0xce, 0xbe, 0xce, 0xd9, 0xca, 0xd5, 0xce, 0xbb, 0xbb,
-    0xb2, 0xbb, 0xcf, 0xb2, 0xbe, 0xb1, 0xbb, 0xb2, 0xba, 0x35, 0x1b, 0x1f,
-    0x1f, 0x29, 0x28, 0x3d, 0x2e, 0x27, 0x27, 0x1f, 0x2b, 0x1e, 0x21, 0x12,
-    0x0a, 0x12, 0x10, 0x10, 0x1b, 0x27, 0x27, 0x2c, 0x43, 0x46, 0x47, 0x33,
-    0x1b, 0x14, 0x20, 0x20, 0x22, 0x13, 0x03, 0x02, 0x02, 0x05, 0x0a, 0x0a,
-    0x0a, 0x1a, 0x27, 0x37, 0x51, 0x6c, 0x75, 0x77, 0x86, 0x64, 0x33, 0x1c,
-    0x13, 0x34, 0x56, 0x60, 0x86, 0x78, 0x78, 0x67, 0x86, 0x80, 0x4e, 0x33,
-    0x19, 0x1c, 0x07, 0x07, 0x10, 0x1f, 0x1f, 0x1a, 0x2b, 0x1b, 0x1c, 0x12,
-    0x2a, 0x28, 0x28, 0x27, 0x2d, 0x1e, 0x2d, 0x67, 0x6a, 0x2a, 0x19, 0x1e,
-    0xa0, 0x9f, 0x77, 0x77, 0x5e, 0x5e, 0x61, 0x61, 0x5e, 0x5e, 0x4a, 0x36,
-    0x36, 0x36, 0x4a, 0x4a, 0x36, 0x36, 0x46, 0x4a, 0x4a, 0x4a, 0x63, 0x6b,
-    0x58, 0x50, 0x46, 0x36, 0x2b, 0x36, 0x2e, 0x2e, 0x2e, 0x36, 0x4c, 0x6d,
-    0x4c, 0x3e, 0x27, 0x1f, 0x1f, 0x1f, 0x1d, 0x2d, 0x56, 0xd3, 0xe3, 0xce,
-    0xaa, 0xa3, 0xac, 0x91, 0x75, 0x5e, 0x5e, 0x75, 0x83, 0x73, 0x6b, 0x4d,
-    0x43, 0x6f, 0xb9, 0xf3, 0xe4, 0xd3, 0xae, 0x91, 0x63, 0x63, 0x54, 0x54,
-    0x29, 0x29, 0x36, 0x29, 0x2f, 0x2f, 0x2b, 0x24, 0x2f, 0x5e, 0x61, 0x6b,
-    0x6c, 0x5a, 0x67, 0xfa, 0xfa, 0xf0, 0xd9, 0xc6, 0xc6, 0x9c, 0xaa, 0xf2,
-    0xfc, 0xfa, 0xd9, 0xca, 0xce, 0x98, 0x73, 0x85, 0xa1, 0x7e, 0x46, 0x3a,
-    0x3e, 0x46, 0x6f, 0x97, 0x73, 0x74, 0x54, 0x3a, 0x1a, 0x1f, 0x3e, 0x3a,
-    0x2e, 0x4a, 0x36, 0x36, 0x2f, 0x2e, 0x36, 0x24, 0x24, 0x25, 0x18, 0x05,
-    0x03, 0x05, 0x05, 0x08, 0x08, 0x0c, 0x16, 0x12, 0x16, 0x0c, 0x0c, 0x0c,
-    0x09, 0x0c, 0x1f, 0x36, 0x36, 0x3e, 0x47, 0x36, 0x4a, 0x29, 0x29, 0x2e,
-    0x3e, 0x36, 0x28, 0x1e, 0x1e, 0x19, 0x12, 0x19, 0x0d, 0x0a, 0x0a, 0x08,
-    0x08, 0x05, 0x03, 0x02, 0x03, 0x22, 0x4e, 0xae, 0xe1, 0xe1, 0xdc, 0xc6,
-    0xca, 0xac, 0xae, 0xb7, 0x91, 0x6b, 0x4d, 0x36, 0x36, 0x5e, 0x91, 0xbc,
-    0xd9, 0xed, 0xed, 0xe7, 0xd0, 0xbe, 0xa3, 0x96, 0x91, 0xa3, 0xae, 0xe0,
-    0xe1, 0xd9, 0xca, 0xd5, 0xaf, 0xd1, 0xce, 0xd9, 0xed, 0xe1, 0xd1, 0xce,
-    0xd1, 0xce, 0xca, 0xca, 0xdc, 0xcf, 0xcf, 0xb2, 0xa0, 0xae, 0xbe, 0xb1,
-    0xa5, 0xaa, 0xc6, 0xce, 0xd3, 0x9d, 0x33, 0x28, 0x28, 0x28, 0x28, 0x47,
-    0x2e, 0x27, 0x28, 0x2d, 0x2f, 0x2b, 0x1e, 0x1c, 0x0a, 0x07, 0x05, 0x05,
-    0x0a, 0x1f, 0x1d, 0x28, 0x2e, 0x2e, 0x28, 0x2a, 0x1e, 0x1c, 0x20, 0x20,
-    0x20, 0x26, 0x06, 0x02, 0x02, 0x05, 0x08, 0x0a, 0x10, 0x14, 0x27, 0x3a,
-    0x44, 0x50, 0x6c, 0x6c, 0x5a, 0x5a, 0x5e, 0x3d, 0x56, 0x55, 0x54, 0x50,
-    0x7a, 0x87, 0x9a, 0xb2, 0xa0, 0xb4, 0x80, 0x4c, 0x19, 0x07, 0x0a, 0x1e,
-    0x19, 0x1f, 0x10, 0x10, 0x1b, 0x0d, 0x12, 0x07, 0x12, 0x1b, 0x1f, 0x1e,
-    0x1b, 0x12, 0x0d, 0x1e, 0x3d, 0x21, 0x22, 0x1e, 0x90, 0x9d, 0x7d, 0x77,
-    0x6f, 0x77, 0x9f, 0x7e, 0x77, 0x6f, 0x5e, 0x46, 0x46, 0x4a, 0x5e, 0x4a,
-    0x36, 0x36, 0x36, 0x4c, 0x4a, 0x36, 0x36, 0x46, 0x46, 0x46, 0x47, 0x3d,
-    0x2b, 0x2b, 0x1f, 0x21, 0x35, 0x52, 0x69, 0x7b, 0x6f, 0x55, 0x3e, 0x28,
-    0x1b, 0x10, 0x1e, 0x40, 0x78, 0xb2, 0xe1, 0xcf, 0xaa, 0xae, 0xbe, 0xac,
-    0x85, 0x61, 0x75, 0x84, 0x83, 0x73, 0x6b, 0x50, 0x43, 0x50, 0x6c, 0xd2,
-    0xf2, 0xe4, 0xba, 0xb7, 0xa3, 0x7b, 0x7b, 0x5e, 0x36, 0x36, 0x36, 0x4a,
-    0x4a, 0x4a, 0x36, 0x24, 0x36, 0x54, 0x74, 0x83, 0x73, 0x58, 0x60, 0xf0,
-    0xf0, 0xeb, 0xdc, 0xd5, 0xa6, 0x88, 0xaa, 0xf3, 0xfa, 0xf0, 0xed, 0xe3,
-    0xe1, 0xb0, 0x73, 0x86, 0xb9, 0x7b, 0x4d, 0x46, 0x55, 0x46, 0x2e, 0x46,
-    0x2e, 0x3a, 0x36, 0x2e, 0x27, 0x27, 0x2e, 0x47, 0x55, 0x3e, 0x4c, 0x6d,
-    0x4a, 0x36, 0x40, 0x33, 0x33, 0x33, 0x35, 0x09, 0x06, 0x09, 0x0c, 0x12,
-    0x12, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x19, 0x2f,
-    0x36, 0x36, 0x2f, 0x40, 0x36, 0x36, 0x29, 0x3e, 0x47, 0x36, 0x27, 0x1b,
-    0x10, 0x1e, 0x1f, 0x1f, 0x12, 0x0a, 0x0a, 0x08, 0x05, 0x03, 0x03, 0x02,
-    0x05, 0x22, 0x81, 0xc6, 0xd7, 0xd9, 0xca, 0xc6, 0xaf, 0x96, 0xbc, 0xa3,
-    0x84, 0x84, 0x7b, 0x4a, 0x3a, 0x46, 0x91, 0xd9, 0xea, 0xed, 0xea, 0xe7,
-    0xde, 0xc6, 0xac, 0xa3, 0xac, 0xbc, 0xce, 0xdc, 0xdc, 0xd9, 0xd5, 0xc6,
-    0xbc, 0xe0, 0xdc, 0xea, 0xeb, 0xe3, 0xe1, 0xd1, 0xe1, 0xdd, 0xbc, 0xce,
-    0xe3, 0xe3, 0xd3, 0xe3, 0xd1, 0xbe, 0xb2, 0xb2, 0x8c, 0xa2, 0xaa, 0xc6,
-    0xbe, 0xae, 0x56, 0x28, 0x2e, 0x3e, 0x3e, 0x2e, 0x2e, 0x47, 0x4c, 0x48,
-    0x2b, 0x1f, 0x1b, 0x12, 0x07, 0x08, 0x05, 0x05, 0x0a, 0x14, 0x1b, 0x1b,
-    0x19, 0x19, 0x19, 0x14, 0x1b, 0x1e, 0x20, 0x20, 0x34, 0x26, 0x06, 0x02,
-    0x03, 0x03, 0x08, 0x0a, 0x14, 0x1b, 0x1d, 0x27, 0x2c, 0x43, 0x42, 0x5a,
-    0x55, 0x47, 0x47, 0x3e, 0x3d, 0x30, 0x45, 0x37, 0x6c, 0x9a, 0x9a, 0xaa,
-    0xae, 0xae, 0x81, 0x6a, 0x1c, 0x0a, 0x1c, 0x2a, 0x1e, 0x28, 0x1e, 0x1c,
-    0x1c, 0x0a, 0x07, 0x08, 0x10, 0x1e, 0x1f, 0x33, 0x2a, 0x20, 0x12, 0x1c,
-    0x1e, 0x2b, 0x2b, 0x2b, 0xc7, 0x90, 0x7d, 0x7d, 0x87, 0xa0, 0xb7, 0xb7,
-    0x9f, 0x86, 0x77, 0x5a, 0x50, 0x54, 0x55, 0x47, 0x36, 0x3e, 0x4a, 0x4c,
-    0x36, 0x29, 0x2b, 0x2f, 0x4a, 0x55, 0x5e, 0x55, 0x47, 0x2f, 0x1f, 0x35,
-    0x52, 0x7e, 0x9f, 0x91, 0x91, 0x77, 0x55, 0x30, 0x1b, 0x12, 0x1e, 0x47,
-    0x77, 0xb4, 0xd3, 0xd3, 0xb1, 0xbe, 0xbe, 0xac, 0x91, 0x75, 0x61, 0x74,
-    0x73, 0x6b, 0x58, 0x50, 0x50, 0x50, 0x51, 0x9d, 0xe4, 0xe4, 0xd3, 0xb7,
-    0xbe, 0xac, 0x7b, 0x63, 0x54, 0x4a, 0x54, 0x75, 0x74, 0x61, 0x46, 0x2e,
-    0x4a, 0x61, 0x84, 0x83, 0x71, 0x4b, 0x44, 0xee, 0xed, 0xd7, 0xd5, 0xca,
-    0xaa, 0xaf, 0x7f, 0xeb, 0xf3, 0xf9, 0xe0, 0xf3, 0xce, 0x96, 0x73, 0x75,
-    0xa1, 0x61, 0x32, 0x3a, 0x55, 0x46, 0x3a, 0x3a, 0x2e, 0x27, 0x2f, 0x2f,
-    0x3e, 0x2e, 0x47, 0x69, 0x7e, 0x55, 0x7e, 0x7e, 0x5e, 0x6d, 0x69, 0x4c,
-    0x52, 0x2b, 0x2f, 0x18, 0x09, 0x0c, 0x0d, 0x19, 0x19, 0x19, 0x16, 0x25,
-    0x19, 0x19, 0x19, 0x19, 0x1b, 0x0d, 0x0a, 0x21, 0x24, 0x40, 0x4a, 0x4a,
-    0x36, 0x36, 0x2b, 0x47, 0x3e, 0x36, 0x27, 0x1f, 0x14, 0x1f, 0x28, 0x28,
-    0x1b, 0x19, 0x0a, 0x05, 0x06, 0x03, 0x02, 0x03, 0x1c, 0x3d, 0x91, 0xca,
-    0xca, 0xca, 0xc8, 0xb6, 0xaf, 0x97, 0x96, 0x96, 0x83, 0x83, 0x98, 0x75,
-    0x3a, 0x3a, 0xa3, 0xd9, 0xe2, 0xea, 0xe7, 0xdb, 0xde, 0xd5, 0xaf, 0xca,
-    0xd5, 0xd9, 0xed, 0xf7, 0xed, 0xe7, 0xd7, 0xd9, 0xdc, 0xe7, 0xd7, 0xdd,
-    0xe1, 0xe3, 0xe1, 0xe1, 0xeb, 0xeb, 0xeb, 0xe1, 0xe3, 0xd1, 0xb7, 0xe0,
-    0xee, 0xd2, 0xe4, 0xe3, 0xd3, 0xb2, 0xaa, 0xbb, 0xb1, 0xa3, 0x4e, 0x33,
-    0x28, 0x2d, 0x48, 0x3e, 0x3a, 0x55, 0x64, 0x56, 0x40, 0x2b, 0x1e, 0x0a,
-    0x03, 0x05, 0x08, 0x08, 0x0a, 0x0a, 0x0a, 0x0d, 0x14, 0x10, 0x14, 0x21,
-    0x1b, 0x1e, 0x33, 0x31, 0x34, 0x34, 0x06, 0x03, 0x02, 0x05, 0x07, 0x0a,
-    0x14, 0x14, 0x1a, 0x27, 0x2e, 0x2c, 0x44, 0x44, 0x56, 0x2d, 0x1d, 0x28,
-    0x27, 0x23, 0x48, 0x48, 0x51, 0x72, 0x82, 0xa2, 0xb1, 0xaa, 0xae, 0x9d,
-    0x34, 0x1e, 0x1b, 0x2b, 0x49, 0x48, 0x48, 0x4e, 0x33, 0x22, 0x0a, 0x0a,
-    0x1e, 0x28, 0x2f, 0x3d, 0x3d, 0x2f, 0x2a, 0x1c, 0x2a, 0x2d, 0x2f, 0x33,
-    0xc7, 0xc7, 0x90, 0x7d, 0x78, 0x9d, 0xb7, 0xae, 0x9f, 0x9f, 0x91, 0x74,
-    0x58, 0x50, 0x46, 0x3e, 0x36, 0x4a, 0x54, 0x54, 0x4a, 0x36, 0x2b, 0x40,
-    0x5e, 0x7b, 0x7b, 0x75, 0x5e, 0x47, 0x2f, 0x52, 0x6d, 0x91, 0xa3, 0xa3,
-    0x97, 0x84, 0x51, 0x30, 0x1d, 0x1b, 0x2b, 0x55, 0x78, 0xba, 0xd3, 0xd2,
-    0xd2, 0xbe, 0xbe, 0xb4, 0xa0, 0x75, 0x58, 0x58, 0x6b, 0x61, 0x5e, 0x54,
-    0x50, 0x57, 0x4b, 0x60, 0xd2, 0xe3, 0xe1, 0xbc, 0xbc, 0xbc, 0x96, 0x73,
-    0x63, 0x4d, 0x75, 0x98, 0x83, 0x73, 0x63, 0x36, 0x2e, 0x54, 0x6b, 0x73,
-    0x58, 0x43, 0x2c, 0x91, 0xe7, 0xca, 0xd5, 0xaf, 0xbb, 0xa6, 0x7c, 0x8c,
-    0xfc, 0xed, 0xee, 0xe3, 0xd2, 0xbc, 0x83, 0x85, 0x74, 0x50, 0x43, 0x3a,
-    0x46, 0x46, 0x43, 0x43, 0x3a, 0x27, 0x2e, 0x29, 0x3a, 0x37, 0x6f, 0x7e,
-    0x7e, 0x7e, 0x75, 0x61, 0x75, 0x61, 0x5e, 0x5e, 0x52, 0x21, 0x24, 0x0c,
-    0x0c, 0x16, 0x19, 0x19, 0x19, 0x21, 0x24, 0x24, 0x24, 0x24, 0x19, 0x19,
-    0x19, 0x12, 0x13, 0x24, 0x2f, 0x40, 0x36, 0x29, 0x29, 0x2e, 0x27, 0x2e,
-    0x2f, 0x1f, 0x1f, 0x2b, 0x1f, 0x1f, 0x28, 0x1f, 0x1a, 0x1b, 0x0a, 0x0a,
-    0x0c, 0x03, 0x02, 0x0b, 0x2a, 0x2d, 0x9f, 0xc9, 0xca, 0xb6, 0xb6, 0xb6,
-    0xaf, 0x97, 0x96, 0x83, 0x71, 0x73, 0x71, 0x58, 0x27, 0x48, 0xbe, 0xd9,
-    0xde, 0xde, 0xdb, 0xc5, 0xc8, 0xc8, 0xad, 0xb6, 0xd9, 0xef, 0xf6, 0xf6,
-    0xea, 0xe6, 0xc8, 0xca, 0xe6, 0xe8, 0xe9, 0xeb, 0xe3, 0xee, 0xdf, 0xdc,
-    0xed, 0xeb, 0xeb, 0xe0, 0xd1, 0xd1, 0xce, 0xe3, 0xe3, 0xe3, 0xe3, 0xe1,
-    0xe1, 0xe1, 0xbb, 0xa2, 0xaa, 0x9a, 0xa0, 0xa0, 0x9d, 0x7d, 0x56, 0x30,
-    0x64, 0x45, 0x44, 0x47, 0x55, 0x40, 0x2a, 0x07, 0x03, 0x05, 0x05, 0x0b,
-    0x0c, 0x07, 0x0a, 0x12, 0x19, 0x12, 0x14, 0x1f, 0x2b, 0x2b, 0x33, 0x31,
-    0x31, 0x22, 0x03, 0x02, 0x02, 0x05, 0x0a, 0x0d, 0x1b, 0x1b, 0x1b, 0x1d,
-    0x27, 0x30, 0x37, 0x47, 0x48, 0x1d, 0x28, 0x28, 0x27, 0x48, 0x48, 0x60,
-    0x60, 0x58, 0x72, 0x93, 0xaa, 0xae, 0x8c, 0x75, 0x4c, 0x1e, 0x2f, 0x2e,
-    0x55, 0x53, 0x6f, 0x5e, 0x48, 0x2f, 0x19, 0x1c, 0x33, 0x3d, 0x3e, 0x47,
-    0x5e, 0x4c, 0x33, 0x21, 0x1e, 0x2b, 0x2b, 0x1e, 0xf4, 0xc7, 0xbd, 0x7d,
-    0x67, 0x7d, 0x9b, 0x87, 0x87, 0xae, 0xa3, 0x85, 0x74, 0x58, 0x54, 0x47,
-    0x4a, 0x5e, 0x61, 0x63, 0x54, 0x3e, 0x36, 0x5e, 0x7b, 0x91, 0x98, 0x84,
-    0x63, 0x47, 0x2f, 0x4a, 0x69, 0x91, 0x98, 0x96, 0x7f, 0x68, 0x50, 0x30,
-    0x1a, 0x1b, 0x2b, 0x47, 0x6c, 0x75, 0x9a, 0xd2, 0xd2, 0xcf, 0xb2, 0xae,
-    0x91, 0x74, 0x74, 0x6b, 0x58, 0x43, 0x46, 0x44, 0x50, 0x50, 0x43, 0x44,
-    0xa0, 0xd1, 0xdc, 0xca, 0xaf, 0xa6, 0x96, 0x83, 0x6b, 0x63, 0x75, 0x97,
-    0x83, 0x66, 0x63, 0x39, 0x27, 0x3a, 0x50, 0x50, 0x43, 0x37, 0x27, 0x28,
-    0x77, 0xca, 0xaf, 0xb6, 0xa6, 0x94, 0x71, 0xbb, 0xf7, 0xe1, 0xdf, 0xca,
-    0xca, 0xa6, 0x98, 0x91, 0x6b, 0x6b, 0x50, 0x4d, 0x50, 0x4d, 0x43, 0x44,
-    0x37, 0x2e, 0x27, 0x29, 0x3e, 0x51, 0x77, 0x78, 0xb7, 0x9f, 0x84, 0x84,
-    0x73, 0x63, 0x63, 0x61, 0x4c, 0x1c, 0x08, 0x08, 0x08, 0x12, 0x19, 0x24,
-    0x24, 0x24, 0x36, 0x36, 0x24, 0x29, 0x24, 0x21, 0x19, 0x12, 0x0a, 0x1e,
-    0x1f, 0x2b, 0x2b, 0x29, 0x36, 0x2e, 0x2e, 0x3e, 0x4a, 0x2b, 0x1f, 0x2f,
-    0x28, 0x1a, 0x2b, 0x1f, 0x1b, 0x10, 0x10, 0x12, 0x0d, 0x08, 0x03, 0x1c,
-    0x2a, 0x2d, 0x9f, 0xc6, 0xb6, 0xad, 0xa6, 0xbc, 0xb0, 0x8e, 0x8e, 0x71,
-    0x4b, 0x63, 0x58, 0x2c, 0x1e, 0xa3, 0xc6, 0xdc, 0xd9, 0xdb, 0xc8, 0xcd,
-    0xb0, 0x94, 0x89, 0xa6, 0xea, 0xe7, 0xef, 0xef, 0xde, 0xd7, 0xd9, 0xd9,
-    0xef, 0xf7, 0xf6, 0xdc, 0xeb, 0xed, 0xd9, 0xe7, 0xe7, 0xdc, 0xce, 0xce,
-    0xd1, 0xdf, 0xe0, 0xee, 0xe3, 0xe1, 0xd2, 0xe1, 0xd2, 0xe0, 0xce, 0xac,
-    0xa2, 0x9a, 0x9a, 0xa0, 0x9a, 0xae, 0x9f, 0x64, 0x64, 0x60, 0x60, 0x47,
-    0x47, 0x3d, 0x2a, 0x08, 0x03, 0x03, 0x05, 0x05, 0x08, 0x07, 0x0a, 0x12,
-    0x19, 0x19, 0x14, 0x1f, 0x1f, 0x2b, 0x2f, 0x2d, 0x49, 0x22, 0x02, 0x02,
-    0x02, 0x03, 0x05, 0x0a, 0x14, 0x14, 0x14, 0x1a, 0x1d, 0x28, 0x27, 0x28,
-    0x2b, 0x14, 0x1e, 0x1f, 0x1a, 0x3e, 0x47, 0x2c, 0x44, 0x43, 0x68, 0x71,
-    0x84, 0x8c, 0x85, 0x61, 0x4c, 0x22, 0x1f, 0x3e, 0x45, 0x5a, 0x6f, 0x78,
-    0x69, 0x40, 0x21, 0x1e, 0x1d, 0x2e, 0x37, 0x51, 0x6f, 0x69, 0x35, 0x21,
-    0x1e, 0x2a, 0x2a, 0x1e, 0xfb, 0xf1, 0xc7, 0x90, 0x67, 0x67, 0x67, 0x78,
-    0x9b, 0xb7, 0xae, 0xa3, 0x8c, 0x85, 0x6f, 0x5e, 0x55, 0x61, 0x63, 0x58,
-    0x46, 0x36, 0x36, 0x5e, 0x75, 0x98, 0x83, 0x71, 0x58, 0x46, 0x28, 0x40,
-    0x61, 0x74, 0x83, 0x7f, 0x71, 0x57, 0x44, 0x27, 0x1b, 0x1b, 0x28, 0x3a,
-    0x50, 0x4b, 0x72, 0xb2, 0xcf, 0xd1, 0xbe, 0xa3, 0x74, 0x75, 0x74, 0x74,
-    0x58, 0x43, 0x3a, 0x46, 0x50, 0x43, 0x44, 0x37, 0x53, 0xae, 0xce, 0xc6,
-    0xa5, 0xaf, 0xac, 0xa3, 0x74, 0x63, 0x74, 0x84, 0x83, 0x6b, 0x4d, 0x46,
-    0x29, 0x27, 0x3a, 0x2e, 0x2e, 0x27, 0x2b, 0x40, 0x55, 0x85, 0xaa, 0xa5,
-    0xa6, 0x7f, 0x7f, 0x82, 0x8c, 0xea, 0xe2, 0xc8, 0xb3, 0xa6, 0x96, 0x66,
-    0x74, 0x6b, 0x50, 0x58, 0x61, 0x50, 0x50, 0x51, 0x5e, 0x37, 0x27, 0x1a,
-    0x2e, 0x54, 0x61, 0x87, 0xb7, 0x91, 0x83, 0x98, 0x84, 0x73, 0x58, 0x54,
-    0x36, 0x22, 0x05, 0x08, 0x12, 0x1f, 0x1f, 0x29, 0x36, 0x36, 0x36, 0x46,
-    0x36, 0x36, 0x36, 0x2f, 0x19, 0x1c, 0x0c, 0x0c, 0x0d, 0x19, 0x1f, 0x2f,
-    0x36, 0x2e, 0x2e, 0x3e, 0x36, 0x29, 0x29, 0x27, 0x27, 0x1f, 0x1e, 0x1b,
-    0x14, 0x14, 0x1e, 0x1e, 0x1c, 0x09, 0x06, 0x15, 0x33, 0x6f, 0x77, 0xbb,
-    0xa6, 0xa6, 0xca, 0xbc, 0xb0, 0x83, 0x98, 0x97, 0x58, 0x74, 0x91, 0x46,
-    0x27, 0x8c, 0xaf, 0xd9, 0xd9, 0xde, 0xc8, 0xc6, 0xd0, 0x91, 0x73, 0x96,
-    0xdf, 0xea, 0xe6, 0xde, 0xde, 0xd5, 0xe0, 0xea, 0xe7, 0xea, 0xea, 0xdf,
-    0xee, 0xee, 0xea, 0xe7, 0xe7, 0xd9, 0xd1, 0xd1, 0xe3, 0xe3, 0xee, 0xee,
-    0xe0, 0xe0, 0xe0, 0xd3, 0xba, 0xd1, 0xce, 0xb2, 0xa0, 0x87, 0x85, 0x8c,
-    0x9a, 0xaa, 0xa2, 0x9f, 0x60, 0x51, 0x5a, 0x53, 0x55, 0x3d, 0x1c, 0x03,
-    0x02, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x0c, 0x0a, 0x13, 0x12, 0x10, 0x1e,
-    0x1e, 0x2b, 0x28, 0x2d, 0x33, 0x13, 0x02, 0x02, 0x05, 0x03, 0x03, 0x0c,
-    0x0a, 0x12, 0x1b, 0x1b, 0x1a, 0x1a, 0x1f, 0x14, 0x0d, 0x0b, 0x07, 0x10,
-    0x14, 0x1b, 0x1d, 0x23, 0x23, 0x32, 0x43, 0x58, 0x74, 0x6b, 0x6c, 0x5e,
-    0x21, 0x0a, 0x1b, 0x2e, 0x44, 0x50, 0x75, 0x77, 0x6f, 0x2f, 0x1e, 0x1e,
-    0x2f, 0x28, 0x2e, 0x46, 0x5e, 0x4c, 0x21, 0x12, 0x21, 0x33, 0x4e, 0x40,
-    0xfb, 0xf1, 0xc7, 0xbd, 0x90, 0x67, 0x67, 0x7d, 0x7d, 0xa0, 0xa0, 0xb2,
-    0xae, 0xa2, 0x86, 0x6f, 0x6f, 0x61, 0x61, 0x63, 0x46, 0x36, 0x40, 0x4a,
-    0x63, 0x73, 0x71, 0x57, 0x50, 0x3a, 0x2b, 0x28, 0x3e, 0x63, 0x6b, 0x68,
-    0x57, 0x43, 0x2e, 0x1d, 0x1b, 0x1b, 0x1f, 0x2e, 0x37, 0x37, 0x44, 0x78,
-    0xb4, 0xba, 0xb7, 0xa3, 0x75, 0x86, 0x84, 0x72, 0x58, 0x46, 0x47, 0x61,
-    0x6b, 0x58, 0x50, 0x3a, 0x2e, 0x64, 0xb1, 0xcf, 0xce, 0xbc, 0xce, 0xbe,
-    0xa3, 0x75, 0x63, 0x4d, 0x6b, 0x58, 0x54, 0x5e, 0x39, 0x2e, 0x2e, 0x2e,
-    0x29, 0x1f, 0x4c, 0x69, 0x77, 0x75, 0x8c, 0xa5, 0x7f, 0x68, 0x72, 0x7f,
-    0x7f, 0xaa, 0xd9, 0xc8, 0xad, 0x8e, 0x7f, 0x73, 0x74, 0x6b, 0x6b, 0x61,
-    0x6b, 0x6b, 0x58, 0x6c, 0x60, 0x44, 0x27, 0x28, 0x27, 0x3e, 0x51, 0x87,
-    0xae, 0xac, 0x97, 0xac, 0x98, 0x83, 0x58, 0x54, 0x2e, 0x22, 0x03, 0x08,
-    0x19, 0x1f, 0x29, 0x36, 0x3a, 0x4d, 0x4d, 0x4d, 0x4d, 0x46, 0x36, 0x2f,
-    0x19, 0x19, 0x0c, 0x03, 0x05, 0x16, 0x1f, 0x2b, 0x36, 0x2e, 0x2e, 0x3e,
-    0x36, 0x36, 0x1f, 0x1b, 0x2b, 0x1f, 0x1e, 0x2f, 0x1b, 0x14, 0x1d, 0x2a,
-    0x22, 0x25, 0x25, 0x2a, 0x40, 0x6f, 0xa2, 0xaa, 0xaf, 0xa6, 0xb6, 0xa6,
-    0x94, 0x96, 0xbc, 0x97, 0x66, 0x73, 0x98, 0x75, 0x36, 0x75, 0xbb, 0xc8,
-    0xc8, 0xc8, 0xc8, 0xc8, 0xd0, 0xae, 0xa3, 0x9f, 0xb7, 0xdf, 0xe7, 0xd7,
-    0xd5, 0xce, 0xe0, 0xe7, 0xe7, 0xe7, 0xdf, 0xdf, 0xeb, 0xed, 0xed, 0xea,
-    0xe7, 0xdf, 0xe3, 0xe0, 0xe3, 0xe3, 0xe3, 0xdf, 0xd0, 0xdf, 0xe0, 0xd2,
-    0xd3, 0xd1, 0xce, 0xd2, 0xb4, 0xa0, 0x74, 0x84, 0xa3, 0xaa, 0xae, 0xae,
-    0x7d, 0x60, 0x5a, 0x53, 0x48, 0x20, 0x0b, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x08, 0x05, 0x05, 0x0a, 0x1c, 0x1c, 0x19, 0x1e, 0x1f, 0x1e,
-    0x13, 0x08, 0x08, 0x05, 0x08, 0x06, 0x03, 0x09, 0x08, 0x0a, 0x14, 0x1b,
-    0x19, 0x14, 0x1f, 0x0a, 0x03, 0x02, 0x02, 0x13, 0x1e, 0x1e, 0x14, 0x1d,
-    0x27, 0x2c, 0x32, 0x43, 0x43, 0x51, 0x55, 0x4a, 0x21, 0x12, 0x1b, 0x1d,
-    0x2e, 0x46, 0x4d, 0x63, 0x54, 0x1f, 0x19, 0x2b, 0x33, 0x2a, 0x2b, 0x2e,
-    0x3d, 0x2a, 0x19, 0x19, 0x1e, 0x28, 0x2d, 0x4c, 0xfb, 0xf1, 0xf1, 0xbd,
-    0x90, 0x9d, 0x7d, 0x87, 0x7d, 0x7d, 0x7d, 0xb2, 0xb2, 0xb1, 0x9f, 0x86,
-    0x7e, 0x86, 0x75, 0x58, 0x54, 0x47, 0x36, 0x36, 0x54, 0x63, 0x50, 0x50,
-    0x37, 0x2e, 0x1e, 0x1f, 0x2b, 0x36, 0x46, 0x44, 0x37, 0x2e, 0x27, 0x28,
-    0x2b, 0x1f, 0x1f, 0x1f, 0x27, 0x23, 0x30, 0x48, 0x80, 0x8f, 0xba, 0x9f,
-    0x91, 0xa3, 0x97, 0x71, 0x5a, 0x47, 0x69, 0x75, 0x84, 0x73, 0x58, 0x37,
-    0x30, 0x2e, 0x48, 0xb4, 0xd3, 0xce, 0xce, 0xbc, 0xac, 0x97, 0x63, 0x4d,
-    0x46, 0x55, 0x7e, 0x7b, 0x63, 0x4d, 0x3a, 0x3a, 0x2e, 0x2b, 0x69, 0x86,
-    0x8c, 0x82, 0x71, 0x5b, 0x4b, 0x32, 0x37, 0x2c, 0x23, 0x45, 0xa2, 0xc6,
-    0xa6, 0x94, 0x7f, 0x7f, 0x7f, 0x71, 0x71, 0x75, 0x72, 0x74, 0x71, 0x68,
-    0x75, 0x43, 0x37, 0x55, 0x27, 0x1d, 0x51, 0x77, 0xac, 0x97, 0x93, 0xa6,
-    0x96, 0x73, 0x50, 0x46, 0x1e, 0x16, 0x05, 0x0c, 0x1c, 0x1f, 0x36, 0x46,
-    0x4d, 0x63, 0x63, 0x63, 0x4d, 0x4d, 0x3a, 0x36, 0x24, 0x21, 0x0c, 0x05,
-    0x08, 0x19, 0x1e, 0x1b, 0x1a, 0x27, 0x28, 0x1f, 0x2f, 0x27, 0x2d, 0x1f,
-    0x2f, 0x2b, 0x28, 0x2f, 0x14, 0x14, 0x1e, 0x1e, 0x1e, 0x33, 0x48, 0x56,
-    0x4e, 0x48, 0x8c, 0x93, 0xbb, 0xaa, 0xa6, 0x89, 0x66, 0x7f, 0x97, 0x96,
-    0x58, 0x74, 0xa1, 0xa1, 0x7b, 0x74, 0xaa, 0xca, 0xd5, 0xd5, 0xd9, 0xd5,
-    0xdf, 0xd1, 0xbc, 0xbc, 0xdf, 0xdf, 0xe0, 0xe0, 0xdc, 0xdf, 0xe7, 0xd9,
-    0xd9, 0xd9, 0xed, 0xe7, 0xe7, 0xe7, 0xe7, 0xdc, 0xdf, 0xe0, 0xee, 0xd9,
-    0xd9, 0xdf, 0xe0, 0xdf, 0xd0, 0xdf, 0xdc, 0xdf, 0xce, 0xcf, 0xbe, 0xd1,
-    0xcf, 0xce, 0xb7, 0x9f, 0x97, 0x97, 0xaa, 0xaa, 0x9f, 0x60, 0x53, 0x53,
-    0x33, 0x0b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
-    0x02, 0x03, 0x0b, 0x0c, 0x0a, 0x0d, 0x0a, 0x0c, 0x08, 0x0c, 0x15, 0x0b,
-    0x09, 0x08, 0x03, 0x02, 0x02, 0x03, 0x0a, 0x12, 0x0d, 0x0d, 0x12, 0x08,
-    0x03, 0x02, 0x02, 0x13, 0x1e, 0x14, 0x14, 0x1d, 0x1d, 0x27, 0x3a, 0x3a,
-    0x44, 0x47, 0x3e, 0x40, 0x1c, 0x1c, 0x2a, 0x1e, 0x27, 0x27, 0x3a, 0x3e,
-    0x2f, 0x1e, 0x12, 0x1b, 0x1e, 0x1e, 0x1f, 0x1a, 0x2a, 0x1c, 0x12, 0x19,
-    0x2a, 0x2d, 0x3e, 0x56, 0xfb, 0xf1, 0xec, 0xe5, 0xb9, 0xb9, 0xb4, 0x9b,
-    0x9b, 0x87, 0x87, 0x9b, 0xb2, 0xb2, 0xa0, 0xa0, 0xa0, 0xa2, 0x82, 0x73,
-    0x50, 0x46, 0x2e, 0x2f, 0x36, 0x46, 0x46, 0x46, 0x3e, 0x29, 0x1f, 0x14,
-    0x1c, 0x21, 0x1f, 0x27, 0x27, 0x28, 0x27, 0x2e, 0x2e, 0x2b, 0x1a, 0x1b,
-    0x1a, 0x1f, 0x1d, 0x2a, 0x34, 0x8f, 0xd4, 0xb4, 0xae, 0xa3, 0x97, 0x73,
-    0x63, 0x47, 0x69, 0x85, 0x84, 0x71, 0x58, 0x43, 0x23, 0x27, 0x2d, 0x81,
-    0xb7, 0xca, 0xc6, 0xc6, 0xaf, 0x96, 0x73, 0x4d, 0x44, 0x7e, 0x9f, 0x8c,
-    0x84, 0x74, 0x50, 0x37, 0x27, 0x40, 0x6f, 0x91, 0xa2, 0x94, 0x7c, 0x5c,
-    0x5b, 0x42, 0x23, 0x23, 0x23, 0x45, 0x9b, 0xb2, 0xbb, 0xa8, 0x93, 0x88,
-    0x5b, 0x7f, 0x8c, 0xa2, 0xa8, 0x93, 0x7c, 0x68, 0x85, 0x58, 0x54, 0x5e,
-    0x27, 0x1f, 0x27, 0x3e, 0x75, 0x85, 0x83, 0x83, 0x73, 0x50, 0x3e, 0x2b,
-    0x15, 0x0b, 0x05, 0x0a, 0x1c, 0x33, 0x47, 0x54, 0x63, 0x73, 0x74, 0x73,
-    0x6b, 0x43, 0x3a, 0x29, 0x1f, 0x19, 0x16, 0x05, 0x09, 0x25, 0x19, 0x1b,
-    0x1f, 0x2b, 0x1f, 0x1f, 0x3d, 0x3e, 0x3e, 0x1d, 0x27, 0x3e, 0x3e, 0x28,
-    0x1b, 0x14, 0x14, 0x14, 0x4e, 0x69, 0x64, 0x78, 0x6a, 0x2d, 0x6c, 0x93,
-    0xaa, 0xaa, 0xa6, 0x8a, 0x8e, 0x83, 0xa3, 0x91, 0x7b, 0x91, 0xb7, 0xce,
-    0x98, 0x73, 0x83, 0xb0, 0xd9, 0xe7, 0xe7, 0xdf, 0xe3, 0xdf, 0xbc, 0xbc,
-    0xe0, 0xed, 0xeb, 0xeb, 0xdf, 0xe7, 0xe6, 0xea, 0xe7, 0xe6, 0xe7, 0xea,
-    0xea, 0xea, 0xe7, 0xde, 0xde, 0xd9, 0xd9, 0xdb, 0xc5, 0xd9, 0xdf, 0xd0,
-    0xd5, 0xd0, 0xca, 0xd5, 0xd9, 0xdc, 0xcf, 0xd1, 0xce, 0xdc, 0xe1, 0x9f,
-    0x71, 0x82, 0x93, 0xa2, 0x9f, 0x45, 0x45, 0x2d, 0x22, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x05,
-    0x05, 0x08, 0x08, 0x08, 0x0c, 0x0a, 0x13, 0x15, 0x0c, 0x0c, 0x08, 0x03,
-    0x03, 0x03, 0x08, 0x16, 0x0c, 0x0b, 0x07, 0x0c, 0x25, 0x15, 0x08, 0x05,
-    0x07, 0x05, 0x0a, 0x1f, 0x1f, 0x1d, 0x27, 0x2d, 0x28, 0x1f, 0x1f, 0x12,
-    0x0a, 0x10, 0x35, 0x12, 0x14, 0x28, 0x2b, 0x1e, 0x12, 0x0a, 0x12, 0x1b,
-    0x1b, 0x1b, 0x1e, 0x2a, 0x34, 0x35, 0x22, 0x1b, 0x2b, 0x2f, 0x3d, 0x3d,
-    0xf1, 0xfc, 0xf2, 0xe4, 0xe4, 0xd2, 0xd2, 0xd2, 0xb2, 0x9b, 0x9b, 0x87,
-    0x9b, 0x9d, 0x9d, 0xb4, 0xb7, 0xac, 0x93, 0x73, 0x58, 0x4d, 0x3e, 0x40,
-    0x4c, 0x5e, 0x54, 0x46, 0x46, 0x2e, 0x28, 0x1b, 0x12, 0x19, 0x1e, 0x2b,
-    0x29, 0x36, 0x2e, 0x30, 0x30, 0x27, 0x1a, 0x14, 0x14, 0x12, 0x14, 0x14,
-    0x20, 0x8f, 0xd4, 0xd3, 0xae, 0xa3, 0x97, 0x74, 0x58, 0x54, 0x5e, 0x6f,
-    0x74, 0x58, 0x50, 0x3a, 0x2e, 0x3e, 0x47, 0x6c, 0x8c, 0xa5, 0xaa, 0xc6,
-    0xbb, 0x96, 0x73, 0x63, 0x58, 0x9f, 0xac, 0xaa, 0x97, 0x83, 0x6b, 0x43,
-    0x37, 0x3e, 0x5e, 0x85, 0xaf, 0xa6, 0x7c, 0x5b, 0x4b, 0x32, 0x2c, 0x23,
-    0x2c, 0x60, 0xb2, 0xcf, 0xb1, 0xa8, 0x93, 0x7c, 0x5b, 0x4b, 0xa2, 0xa8,
-    0xbb, 0xa5, 0x94, 0xa2, 0xae, 0x74, 0x61, 0x51, 0x23, 0x2e, 0x27, 0x1f,
-    0x1a, 0x1f, 0x1f, 0x40, 0x36, 0x12, 0x05, 0x03, 0x05, 0x08, 0x05, 0x07,
-    0x1c, 0x33, 0x47, 0x5e, 0x58, 0x74, 0x74, 0x73, 0x58, 0x43, 0x2e, 0x29,
-    0x1f, 0x0a, 0x09, 0x03, 0x00, 0x05, 0x0d, 0x10, 0x1e, 0x2b, 0x1f, 0x28,
-    0x3e, 0x3e, 0x2e, 0x1d, 0x28, 0x2d, 0x2e, 0x2f, 0x33, 0x2a, 0x1c, 0x20,
-    0x6a, 0x69, 0x69, 0x5e, 0x64, 0x56, 0x51, 0x7a, 0x8c, 0x93, 0x93, 0x93,
-    0x94, 0xaf, 0xbb, 0xd5, 0xd9, 0xbc, 0xb6, 0xc8, 0xaf, 0x6b, 0x74, 0xbc,
-    0xde, 0xde, 0xe2, 0xe2, 0xdf, 0xd9, 0xca, 0xdc, 0xeb, 0xf7, 0xf6, 0xe7,
-    0xd9, 0xd7, 0xea, 0xf5, 0xef, 0xdb, 0xd8, 0xe6, 0xef, 0xf6, 0xea, 0xd8,
-    0xc5, 0xd9, 0xd9, 0xdb, 0xdb, 0xd9, 0xd0, 0xcd, 0xb3, 0xc8, 0xc8, 0xca,
-    0xc6, 0xcf, 0xe1, 0xd2, 0xd1, 0xbe, 0xcc, 0xaa, 0x86, 0x86, 0x85, 0x85,
-    0x6f, 0x2d, 0x1e, 0x13, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x03, 0x05, 0x08, 0x0b, 0x08, 0x13,
-    0x22, 0x1c, 0x10, 0x1c, 0x1c, 0x1c, 0x1c, 0x0a, 0x0b, 0x08, 0x08, 0x0c,
-    0x08, 0x03, 0x06, 0x22, 0x21, 0x21, 0x0d, 0x08, 0x03, 0x05, 0x0a, 0x1b,
-    0x1e, 0x1a, 0x1f, 0x2a, 0x1f, 0x1f, 0x19, 0x0a, 0x0d, 0x19, 0x0d, 0x0a,
-    0x0a, 0x19, 0x12, 0x0a, 0x0a, 0x0a, 0x10, 0x1b, 0x2b, 0x28, 0x2f, 0x3d,
-    0x49, 0x4e, 0x22, 0x1e, 0x28, 0x40, 0x3d, 0x49, 0xfc, 0xfc, 0xee, 0xeb,
-    0xe3, 0xe3, 0xe3, 0xe3, 0xd2, 0xb2, 0x9b, 0x9b, 0x9d, 0x9d, 0x90, 0xb9,
-    0xd3, 0xbc, 0x93, 0x74, 0x58, 0x44, 0x3e, 0x4c, 0x7b, 0x75, 0x6b, 0x58,
-    0x4d, 0x46, 0x2e, 0x21, 0x21, 0x21, 0x2f, 0x40, 0x3e, 0x3e, 0x3e, 0x47,
-    0x2e, 0x27, 0x1a, 0x10, 0x0d, 0x12, 0x1b, 0x1e, 0x2a, 0x8f, 0xe3, 0xd1,
-    0xaa, 0x84, 0x7b, 0x86, 0x75, 0x54, 0x54, 0x61, 0x58, 0x50, 0x46, 0x4a,
-    0x3e, 0x54, 0x5a, 0x6b, 0x68, 0x7a, 0xb2, 0xd2, 0xd1, 0xbc, 0x91, 0x75,
-    0x6c, 0x91, 0xac, 0xbc, 0x96, 0x7f, 0x66, 0x50, 0x43, 0x3a, 0x55, 0x75,
-    0x94, 0x94, 0x76, 0x66, 0x4b, 0x32, 0x2c, 0x2c, 0x51, 0xa0, 0xd2, 0xd2,
-    0xb1, 0xa8, 0x93, 0x7c, 0x71, 0x7a, 0xaa, 0xa2, 0xc6, 0xb5, 0xa6, 0xbb,
-    0xaa, 0x84, 0x58, 0x43, 0x55, 0x55, 0x2e, 0x1a, 0x1a, 0x19, 0x0d, 0x0a,
-    0x07, 0x05, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x08, 0x0c, 0x20, 0x48, 0x56,
-    0x6c, 0x6b, 0x73, 0x58, 0x43, 0x3a, 0x27, 0x1f, 0x12, 0x06, 0x00, 0x00,
-    0x00, 0x05, 0x08, 0x0a, 0x10, 0x1f, 0x1a, 0x28, 0x28, 0x2e, 0x2e, 0x1a,
-    0x28, 0x2f, 0x2f, 0x4c, 0x6d, 0x6d, 0x52, 0x4e, 0x78, 0x77, 0x86, 0x58,
-    0x45, 0x56, 0x6c, 0x86, 0xa2, 0x93, 0x93, 0xaa, 0xa2, 0xc6, 0xd5, 0xd9,
-    0xe0, 0xdf, 0xd9, 0xca, 0xa6, 0x7b, 0xbe, 0xdf, 0xe2, 0xd0, 0xe2, 0xdb,
-    0xe2, 0xc8, 0xb6, 0xe7, 0xf7, 0xf7, 0xf5, 0xde, 0xde, 0xe6, 0xef, 0xef,
-    0xde, 0xdb, 0xde, 0xdb, 0xde, 0xe6, 0xdb, 0xc8, 0xd0, 0xe3, 0xe0, 0xd9,
-    0xdf, 0xce, 0xb6, 0xad, 0xa9, 0xbf, 0xad, 0xb6, 0xd5, 0xdc, 0xd1, 0xd1,
-    0xb7, 0xbe, 0xbb, 0x86, 0x85, 0x8c, 0x85, 0x75, 0x3d, 0x1c, 0x13, 0x0b,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02,
-    0x05, 0x03, 0x03, 0x08, 0x0c, 0x0c, 0x0c, 0x12, 0x1e, 0x1b, 0x1e, 0x33,
-    0x2a, 0x1e, 0x20, 0x1c, 0x1c, 0x12, 0x0a, 0x08, 0x03, 0x02, 0x08, 0x1e,
-    0x1e, 0x1b, 0x19, 0x1c, 0x0d, 0x0d, 0x12, 0x0d, 0x0d, 0x1b, 0x19, 0x0d,
-    0x19, 0x1e, 0x1c, 0x0d, 0x19, 0x19, 0x19, 0x19, 0x12, 0x19, 0x12, 0x0a,
-    0x13, 0x1c, 0x1e, 0x1a, 0x28, 0x3e, 0x4c, 0x47, 0x56, 0x4e, 0x34, 0x2a,
-    0x2b, 0x3d, 0x3d, 0x56, 0xfa, 0xf8, 0xeb, 0xed, 0xe1, 0xe1, 0xe3, 0xe3,
-    0xd2, 0xcf, 0xb2, 0xb2, 0xb4, 0x9d, 0x90, 0xd4, 0xd2, 0xbe, 0x93, 0x72,
-    0x58, 0x44, 0x47, 0x69, 0x86, 0x84, 0x7f, 0x6b, 0x63, 0x46, 0x2e, 0x1f,
-    0x21, 0x40, 0x55, 0x5e, 0x54, 0x54, 0x55, 0x47, 0x2e, 0x28, 0x1a, 0x10,
-    0x10, 0x1b, 0x1f, 0x2b, 0x3d, 0x7d, 0xbe, 0xc6, 0xa6, 0x7f, 0x77, 0x7b,
-    0x77, 0x77, 0x77, 0x75, 0x58, 0x4d, 0x47, 0x40, 0x3e, 0x54, 0x6b, 0x68,
-    0x57, 0x6c, 0xb4, 0xe4, 0xee, 0xd1, 0xae, 0x86, 0x6c, 0x85, 0xac, 0xaf,
-    0x94, 0x76, 0x66, 0x50, 0x43, 0x2c, 0x3e, 0x6c, 0x71, 0x71, 0x66, 0x4b,
-    0x43, 0x23, 0x23, 0x37, 0x6c, 0xb4, 0xe3, 0xe1, 0xcc, 0xa8, 0x82, 0x93,
-    0x72, 0x72, 0x77, 0x9a, 0xdd, 0xd5, 0xc6, 0xa5, 0xaa, 0xae, 0x74, 0x50,
-    0x46, 0x5e, 0x2e, 0x14, 0x1e, 0x19, 0x0a, 0x0a, 0x0a, 0x08, 0x08, 0x0c,
-    0x12, 0x12, 0x0d, 0x0a, 0x08, 0x0a, 0x1b, 0x49, 0x60, 0x5a, 0x50, 0x50,
-    0x3a, 0x29, 0x1f, 0x21, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x03, 0x05, 0x07,
-    0x12, 0x1e, 0x1e, 0x1f, 0x2b, 0x2d, 0x28, 0x1b, 0x1b, 0x14, 0x10, 0x56,
-    0x7e, 0x7e, 0x7e, 0x6f, 0x8c, 0xa3, 0x86, 0x6b, 0x44, 0x7d, 0x6c, 0x6c,
-    0x85, 0x93, 0x7f, 0x68, 0x97, 0xe2, 0xe7, 0xde, 0xe2, 0xde, 0xd9, 0xc8,
-    0xad, 0xaf, 0xd9, 0xe2, 0xcd, 0xd0, 0xe2, 0xde, 0xdf, 0xd5, 0xca, 0xea,
-    0xed, 0xf5, 0xde, 0xd8, 0xc8, 0xd9, 0xde, 0xdb, 0xdb, 0xca, 0xde, 0xc5,
-    0xc5, 0xc5, 0xc5, 0xd0, 0xe3, 0xee, 0xf0, 0xe3, 0xdf, 0xca, 0xad, 0x8d,
-    0x8d, 0xa4, 0xad, 0xad, 0xb6, 0xca, 0xc6, 0xce, 0xe1, 0xd2, 0xd3, 0xa0,
-    0x77, 0x6c, 0x6c, 0x75, 0x4e, 0x1c, 0x1c, 0x22, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x03, 0x08,
-    0x0a, 0x0d, 0x1c, 0x1c, 0x1b, 0x1a, 0x1d, 0x2d, 0x2d, 0x2a, 0x1e, 0x1b,
-    0x19, 0x19, 0x12, 0x0b, 0x06, 0x03, 0x0a, 0x14, 0x1f, 0x1e, 0x1b, 0x2b,
-    0x1f, 0x19, 0x19, 0x0d, 0x10, 0x1b, 0x0c, 0x08, 0x05, 0x07, 0x0a, 0x0d,
-    0x12, 0x14, 0x14, 0x1f, 0x1f, 0x2b, 0x1e, 0x19, 0x12, 0x1e, 0x2b, 0x2b,
-    0x27, 0x2e, 0x3a, 0x54, 0x5e, 0x4e, 0x33, 0x2b, 0x2f, 0x3e, 0x47, 0x60,
-    0xee, 0xee, 0xeb, 0xed, 0xe0, 0xdd, 0xdd, 0xdd, 0xdd, 0xcf, 0xcf, 0xcf,
-    0xb2, 0xb2, 0xb4, 0xd4, 0xe1, 0xcc, 0x93, 0x72, 0x58, 0x51, 0x55, 0x64,
-    0x86, 0x84, 0x73, 0x66, 0x50, 0x46, 0x2e, 0x2b, 0x40, 0x5e, 0x7b, 0x75,
-    0x61, 0x61, 0x54, 0x54, 0x37, 0x23, 0x1d, 0x14, 0x10, 0x1e, 0x2f, 0x3d,
-    0x48, 0x60, 0x8c, 0xaa, 0x93, 0x83, 0x74, 0x61, 0x78, 0xa0, 0xa3, 0x97,
-    0x74, 0x50, 0x44, 0x36, 0x2e, 0x54, 0x6b, 0x6b, 0x57, 0x5a, 0xb4, 0xee,
-    0xeb, 0xdc, 0xbc, 0x85, 0x73, 0x6b, 0x97, 0x96, 0x94, 0x71, 0x66, 0x43,
-    0x43, 0x2c, 0x2e, 0x37, 0x51, 0x44, 0x42, 0x43, 0x37, 0x27, 0x27, 0x37,
-    0x6c, 0xb4, 0xe1, 0xdd, 0xc6, 0x93, 0x93, 0x71, 0x57, 0x42, 0x64, 0xe4,
-    0xe1, 0xe0, 0xce, 0xce, 0xcf, 0xb7, 0x85, 0x4b, 0x32, 0x3a, 0x27, 0x1d,
-    0x1f, 0x19, 0x0d, 0x0d, 0x0a, 0x12, 0x12, 0x19, 0x12, 0x12, 0x13, 0x13,
-    0x0c, 0x08, 0x05, 0x1c, 0x1c, 0x33, 0x4c, 0x3e, 0x27, 0x1a, 0x12, 0x0b,
-    0x08, 0x02, 0x00, 0x01, 0x00, 0x03, 0x03, 0x05, 0x12, 0x1e, 0x2a, 0x2a,
-    0x1f, 0x1f, 0x1f, 0x2a, 0x1e, 0x10, 0x13, 0x67, 0x9f, 0x91, 0x91, 0x84,
-    0x84, 0x91, 0x7b, 0x63, 0x51, 0x77, 0x75, 0x6c, 0x74, 0x6b, 0x6b, 0xaa,
-    0xdc, 0xea, 0xea, 0xdb, 0xdb, 0xdb, 0xdf, 0xb6, 0xaf, 0xb6, 0xd7, 0xe2,
-    0xcd, 0xd0, 0xcd, 0xcd, 0xc5, 0xad, 0xb6, 0xd9, 0xe7, 0xe6, 0xdb, 0xc8,
-    0xb0, 0xde, 0xdb, 0xd8, 0xd7, 0xd5, 0xc8, 0xc5, 0xc5, 0xc5, 0xca, 0xe3,
-    0xe4, 0xf3, 0xf3, 0xe3, 0xca, 0xb6, 0x8e, 0x76, 0x89, 0x8e, 0x8e, 0x8e,
-    0xad, 0xad, 0xb6, 0xd5, 0xe1, 0xe1, 0xd3, 0xb4, 0x81, 0x67, 0x64, 0x56,
-    0x2a, 0x1e, 0x2a, 0x20, 0x11, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x02, 0x05, 0x06, 0x0b, 0x0a, 0x0d, 0x1e, 0x34,
-    0x2a, 0x28, 0x2d, 0x2d, 0x33, 0x2a, 0x2a, 0x2f, 0x21, 0x19, 0x0d, 0x0c,
-    0x06, 0x05, 0x0d, 0x14, 0x1a, 0x1f, 0x1f, 0x1f, 0x1f, 0x1a, 0x2b, 0x2b,
-    0x1e, 0x1e, 0x16, 0x08, 0x05, 0x08, 0x12, 0x19, 0x1b, 0x1f, 0x28, 0x27,
-    0x2b, 0x29, 0x2b, 0x1b, 0x14, 0x1f, 0x1f, 0x27, 0x2e, 0x2e, 0x39, 0x54,
-    0x5e, 0x4c, 0x2d, 0x2e, 0x30, 0x45, 0x51, 0x77, 0xdd, 0xeb, 0xed, 0xe9,
-    0xdd, 0xdc, 0xdc, 0xdc, 0xdd, 0xdd, 0xcc, 0xcc, 0xcc, 0xb2, 0xb4, 0xe3,
-    0xe1, 0xc6, 0x93, 0x7f, 0x6b, 0x6b, 0x5a, 0x6f, 0x86, 0x84, 0x73, 0x58,
-    0x43, 0x3e, 0x27, 0x2f, 0x4c, 0x7b, 0x85, 0x84, 0x74, 0x6b, 0x58, 0x44,
-    0x3e, 0x2e, 0x1a, 0x14, 0x1b, 0x2f, 0x47, 0x64, 0x6f, 0x60, 0x77, 0x86,
-    0x91, 0x75, 0x5a, 0x61, 0x78, 0xb7, 0xaa, 0x94, 0x7f, 0x57, 0x43, 0x2c,
-    0x27, 0x3a, 0x46, 0x51, 0x42, 0x37, 0xa0, 0xe1, 0xe0, 0xdc, 0xca, 0x94,
-    0x7f, 0x6b, 0x58, 0x6b, 0x6b, 0x4b, 0x42, 0x44, 0x51, 0x37, 0x2c, 0x23,
-    0x23, 0x23, 0x30, 0x27, 0x1d, 0x1d, 0x1a, 0x30, 0x53, 0x9a, 0xcc, 0xd5,
-    0xb8, 0x93, 0x71, 0x72, 0x6b, 0x42, 0x7d, 0xcc, 0xcf, 0xe0, 0xe0, 0xdf,
-    0xbc, 0xac, 0x84, 0x57, 0x50, 0x3a, 0x2e, 0x2e, 0x1d, 0x1a, 0x12, 0x1c,
-    0x33, 0x47, 0x36, 0x2f, 0x21, 0x1c, 0x12, 0x0d, 0x13, 0x08, 0x05, 0x02,
-    0x08, 0x20, 0x31, 0x2f, 0x1a, 0x12, 0x03, 0x02, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x03, 0x08, 0x0a, 0x14, 0x14, 0x19, 0x0d, 0x1e, 0x2a, 0x33,
-    0x3d, 0x33, 0x6a, 0x9a, 0xaa, 0xbb, 0xb0, 0x7f, 0xa2, 0xa3, 0x98, 0x58,
-    0x58, 0x75, 0x85, 0x72, 0x57, 0x30, 0x69, 0xce, 0xea, 0xf9, 0xed, 0xde,
-    0xde, 0xdb, 0xc8, 0xb6, 0xc6, 0xca, 0xd9, 0xde, 0xcd, 0xde, 0xcd, 0xcd,
-    0xad, 0x8e, 0x94, 0xd5, 0xd9, 0xd7, 0xc8, 0xca, 0xd1, 0xd9, 0xe2, 0xe7,
-    0xea, 0xe7, 0xdb, 0xc5, 0xc5, 0xde, 0xe3, 0xe4, 0xe3, 0xf3, 0xe3, 0xd5,
-    0xa6, 0xa6, 0x83, 0x66, 0x66, 0x73, 0x83, 0x7f, 0x94, 0xa6, 0xb5, 0xbb,
-    0xbc, 0xce, 0xbe, 0xb7, 0xd3, 0xd4, 0x80, 0x33, 0x34, 0x2a, 0x31, 0x34,
-    0x26, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x03, 0x06, 0x0b, 0x0c, 0x13, 0x12, 0x1c, 0x2a, 0x2a, 0x2d, 0x3d, 0x56,
-    0x56, 0x4e, 0x3d, 0x48, 0x33, 0x12, 0x0a, 0x08, 0x03, 0x06, 0x0a, 0x1c,
-    0x2a, 0x40, 0x2b, 0x1f, 0x1f, 0x29, 0x2f, 0x2f, 0x1f, 0x2b, 0x21, 0x12,
-    0x12, 0x0d, 0x10, 0x1e, 0x1a, 0x1d, 0x2e, 0x2e, 0x47, 0x47, 0x36, 0x2b,
-    0x1e, 0x1f, 0x1f, 0x27, 0x2e, 0x2c, 0x46, 0x55, 0x48, 0x3d, 0x30, 0x47,
-    0x45, 0x51, 0x7a, 0x93, 0xcc, 0xdd, 0xe9, 0xe9, 0xd7, 0xc9, 0xd5, 0xdd,
-    0xe1, 0xdd, 0xdd, 0xcc, 0xcc, 0xcf, 0xd2, 0xe3, 0xe1, 0xd5, 0xa5, 0x82,
-    0x82, 0x75, 0x77, 0x78, 0x77, 0x75, 0x58, 0x50, 0x43, 0x2e, 0x27, 0x2d,
-    0x5e, 0x75, 0x91, 0x84, 0x71, 0x68, 0x50, 0x44, 0x3e, 0x28, 0x1b, 0x10,
-    0x1e, 0x40, 0x5e, 0x77, 0x75, 0x75, 0x60, 0x64, 0x7d, 0x64, 0x67, 0x7e,
-    0x91, 0xa3, 0xaf, 0x94, 0x71, 0x68, 0x50, 0x32, 0x30, 0x3e, 0x3e, 0x3a,
-    0x37, 0x23, 0x78, 0xce, 0xd7, 0xd9, 0xca, 0x9c, 0x94, 0x71, 0x57, 0x43,
-    0x2c, 0x2c, 0x30, 0x53, 0x5a, 0x50, 0x43, 0x44, 0x30, 0x23, 0x27, 0x1a,
-    0x20, 0x21, 0x1c, 0x2a, 0x48, 0x87, 0xcc, 0xc6, 0xa5, 0x88, 0x68, 0x7a,
-    0x58, 0x2c, 0x6c, 0x86, 0xe4, 0xeb, 0xe1, 0xce, 0xbc, 0xbc, 0x84, 0x75,
-    0x6c, 0x44, 0x2c, 0x30, 0x1d, 0x1d, 0x1b, 0x56, 0x86, 0x85, 0x6c, 0x5e,
-    0x4c, 0x21, 0x22, 0x13, 0x13, 0x1c, 0x0a, 0x08, 0x13, 0x2a, 0x2d, 0x2f,
-    0x1f, 0x1c, 0x0c, 0x03, 0x03, 0x00, 0x00, 0x02, 0x02, 0x05, 0x0c, 0x1c,
-    0x1e, 0x1e, 0x1b, 0x0a, 0x07, 0x20, 0x2a, 0x2d, 0x64, 0x91, 0xac, 0xac,
-    0xac, 0xbc, 0x98, 0x7f, 0xaa, 0xac, 0x97, 0x50, 0x37, 0x6c, 0x6b, 0x75,
-    0x44, 0x2e, 0x81, 0xd5, 0xea, 0xf9, 0xed, 0xde, 0xdb, 0xcd, 0xb6, 0xa6,
-    0x8e, 0x8e, 0xd5, 0xde, 0xdb, 0xc8, 0xc5, 0xad, 0xb0, 0xa3, 0x97, 0xbc,
-    0xca, 0xc8, 0xd5, 0xe2, 0xdf, 0xde, 0xdb, 0xe7, 0xed, 0xe7, 0xde, 0xde,
-    0xa6, 0xd3, 0xf3, 0xe0, 0xdf, 0xe3, 0xe3, 0xbc, 0xaa, 0xaa, 0x86, 0x6c,
-    0x6b, 0x6b, 0x84, 0x83, 0x93, 0xcc, 0xb1, 0xbc, 0xbb, 0xc6, 0xd1, 0x7e,
-    0xb2, 0xce, 0xd1, 0x81, 0x49, 0x2a, 0x2a, 0x31, 0x34, 0x26, 0x11, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x05, 0x0b, 0x13,
-    0x12, 0x12, 0x1e, 0x1e, 0x2b, 0x2e, 0x37, 0x44, 0x53, 0x56, 0x48, 0x3e,
-    0x2f, 0x12, 0x0b, 0x03, 0x08, 0x13, 0x19, 0x2a, 0x2b, 0x48, 0x2e, 0x3e,
-    0x48, 0x56, 0x48, 0x2e, 0x4a, 0x40, 0x1e, 0x19, 0x12, 0x0d, 0x0d, 0x14,
-    0x1f, 0x27, 0x2c, 0x3a, 0x46, 0x55, 0x4c, 0x2b, 0x1b, 0x1f, 0x2b, 0x1d,
-    0x27, 0x2e, 0x3e, 0x3e, 0x2d, 0x2d, 0x45, 0x53, 0x7a, 0xa2, 0xb8, 0xc9,
-    0xc6, 0xcc, 0xdc, 0xdc, 0xd7, 0xd7, 0xdd, 0xe3, 0xeb, 0xe1, 0xdd, 0xd5,
-    0xc6, 0xce, 0xe1, 0xe3, 0xdd, 0xd5, 0xb8, 0xa2, 0x8c, 0x86, 0x87, 0xa0,
-    0x9f, 0x75, 0x58, 0x43, 0x37, 0x30, 0x27, 0x2e, 0x55, 0x75, 0x84, 0x83,
-    0x68, 0x58, 0x43, 0x37, 0x27, 0x1d, 0x14, 0x10, 0x1e, 0x4a, 0x61, 0x75,
-    0x72, 0x74, 0x5a, 0x53, 0x48, 0x49, 0x80, 0xb7, 0xae, 0x8c, 0x97, 0x7f,
-    0x68, 0x58, 0x51, 0x51, 0x55, 0x5a, 0x54, 0x46, 0x2e, 0x23, 0x30, 0xa2,
-    0xc6, 0xdd, 0xd5, 0xa6, 0x94, 0x5c, 0x4b, 0x32, 0x2c, 0x27, 0x3d, 0x87,
-    0x86, 0x74, 0x6b, 0x50, 0x37, 0x2c, 0x27, 0x1f, 0x20, 0x20, 0x34, 0x6e,
-    0xb4, 0xb1, 0xc6, 0xb5, 0x94, 0x7f, 0x68, 0x4b, 0x37, 0x2c, 0x23, 0x67,
-    0xf3, 0xf3, 0xee, 0xe0, 0xd5, 0xaa, 0x83, 0x72, 0x58, 0x43, 0x3a, 0x2e,
-    0x1d, 0x1d, 0x48, 0x87, 0xa3, 0x8c, 0x85, 0x6f, 0x4c, 0x2f, 0x33, 0x81,
-    0xa0, 0x86, 0x4a, 0x21, 0x21, 0x2a, 0x2f, 0x2b, 0x2b, 0x1f, 0x19, 0x0c,
-    0x09, 0x04, 0x02, 0x05, 0x05, 0x0c, 0x19, 0x1e, 0x2f, 0x3d, 0x2f, 0x1b,
-    0x0a, 0x0a, 0x1b, 0x33, 0x4c, 0xce, 0xbc, 0xbe, 0xac, 0xac, 0x98, 0x83,
-    0xa2, 0xa3, 0x91, 0x61, 0x69, 0x5e, 0x43, 0x58, 0x43, 0x44, 0x85, 0xd5,
-    0xe6, 0xea, 0xe7, 0xc5, 0xc8, 0xcd, 0xc6, 0xb6, 0x7f, 0x5b, 0x93, 0xde,
-    0xde, 0xd9, 0xb6, 0x8e, 0x8e, 0x94, 0x97, 0xae, 0xc6, 0xca, 0xdc, 0xd9,
-    0xc8, 0xc5, 0xc5, 0xdb, 0xe6, 0xde, 0xd7, 0xd5, 0xbc, 0xe3, 0xdf, 0xe2,
-    0xdf, 0xe2, 0xdf, 0xbc, 0xaa, 0xb4, 0x9d, 0x7d, 0x75, 0x6c, 0x75, 0x73,
-    0xa6, 0xce, 0xb2, 0xa3, 0xaa, 0xbb, 0xcf, 0xae, 0xaa, 0xbb, 0xbc, 0xce,
-    0x9d, 0x49, 0x31, 0x3d, 0x48, 0x49, 0x4f, 0x11, 0x03, 0x02, 0x02, 0x04,
-    0x02, 0x02, 0x02, 0x03, 0x03, 0x05, 0x07, 0x0a, 0x0d, 0x12, 0x1e, 0x1d,
-    0x27, 0x3e, 0x45, 0x51, 0x54, 0x5a, 0x64, 0x3d, 0x3d, 0x34, 0x06, 0x03,
-    0x0b, 0x1c, 0x2a, 0x1f, 0x1d, 0x27, 0x27, 0x3e, 0x5e, 0x5e, 0x6f, 0x55,
-    0x5e, 0x69, 0x4e, 0x21, 0x0d, 0x07, 0x0d, 0x14, 0x1d, 0x2e, 0x30, 0x3a,
-    0x54, 0x5e, 0x4c, 0x2b, 0x14, 0x1a, 0x1f, 0x1d, 0x28, 0x2e, 0x3e, 0x40,
-    0x31, 0x3d, 0x60, 0x72, 0x9c, 0xab, 0xc2, 0xc9, 0xbb, 0xbb, 0xd5, 0xd7,
-    0xcc, 0xdd, 0xf3, 0xf0, 0xeb, 0xeb, 0xdd, 0xc9, 0xc9, 0xcc, 0xcf, 0xe0,
-    0xdc, 0xd5, 0xb8, 0xa8, 0xa2, 0x7a, 0xa0, 0xb7, 0x9f, 0x85, 0x6b, 0x50,
-    0x37, 0x3a, 0x2e, 0x2e, 0x45, 0x5a, 0x6b, 0x6b, 0x58, 0x43, 0x37, 0x2e,
-    0x1d, 0x1b, 0x19, 0x19, 0x1e, 0x47, 0x58, 0x74, 0x72, 0x6b, 0x4b, 0x44,
-    0x30, 0x49, 0x9d, 0xd3, 0xbe, 0xa2, 0x85, 0x72, 0x58, 0x54, 0x5e, 0x77,
-    0x86, 0x74, 0x6b, 0x43, 0x2c, 0x27, 0x27, 0x48, 0xb2, 0xeb, 0xe0, 0xc6,
-    0x9c, 0x5b, 0x4b, 0x43, 0x2c, 0x28, 0x55, 0x91, 0xa2, 0x7f, 0x71, 0x57,
-    0x42, 0x2c, 0x27, 0x1d, 0x2a, 0x6e, 0xd4, 0xe3, 0xe1, 0xdc, 0xb5, 0x9c,
-    0x70, 0x57, 0x42, 0x32, 0x2c, 0x23, 0x14, 0x6a, 0xe3, 0xf0, 0xdd, 0xd5,
-    0xb6, 0x94, 0x7f, 0x73, 0x50, 0x43, 0x43, 0x27, 0x27, 0x28, 0x78, 0xb4,
-    0xb7, 0xa3, 0x74, 0x7e, 0x4c, 0x52, 0xa1, 0xae, 0xae, 0xa3, 0x74, 0x5e,
-    0x21, 0x1c, 0x22, 0x21, 0x40, 0x56, 0x69, 0x4c, 0x25, 0x06, 0x04, 0x06,
-    0x0b, 0x15, 0x21, 0x2a, 0x2e, 0x47, 0x3e, 0x1d, 0x10, 0x05, 0x08, 0xa1,
-    0xce, 0xce, 0xdf, 0xd3, 0xd0, 0xb7, 0xa3, 0x97, 0xae, 0xa1, 0x7b, 0x86,
-    0x7e, 0x7e, 0x54, 0x43, 0x2c, 0x51, 0x58, 0x93, 0xde, 0xdb, 0xd8, 0xc5,
-    0xc5, 0xb0, 0xb3, 0x8e, 0x71, 0x97, 0xa2, 0xc6, 0xc8, 0xd5, 0xca, 0x96,
-    0x83, 0x66, 0x75, 0xba, 0xce, 0xd7, 0xe9, 0xe8, 0xc8, 0xad, 0xad, 0xdb,
-    0xdb, 0xc5, 0xc8, 0xc6, 0xc6, 0xe0, 0xd9, 0xd9, 0xde, 0xdb, 0xd0, 0xae,
-    0xb2, 0xb4, 0xb9, 0x7d, 0x77, 0x6f, 0x61, 0x74, 0x7f, 0x94, 0xaa, 0xa0,
-    0xa0, 0xae, 0xae, 0xa3, 0xaa, 0xbc, 0xbb, 0xce, 0xb2, 0x56, 0x48, 0x48,
-    0x56, 0x56, 0x67, 0x4e, 0x13, 0x06, 0x06, 0x05, 0x05, 0x03, 0x03, 0x03,
-    0x05, 0x05, 0x0b, 0x0a, 0x0a, 0x19, 0x1b, 0x1d, 0x2e, 0x44, 0x51, 0x5e,
-    0x55, 0x51, 0x5e, 0x3d, 0x3d, 0x34, 0x08, 0x05, 0x0a, 0x10, 0x14, 0x1a,
-    0x1d, 0x2e, 0x45, 0x54, 0x44, 0x5a, 0x6c, 0x6c, 0x5a, 0x5e, 0x6a, 0x33,
-    0x14, 0x0a, 0x19, 0x1e, 0x1b, 0x28, 0x2e, 0x37, 0x44, 0x55, 0x3d, 0x1e,
-    0x1b, 0x1a, 0x1f, 0x27, 0x27, 0x3e, 0x48, 0x4e, 0x49, 0x53, 0x6c, 0x71,
-    0x88, 0xab, 0xc9, 0xc9, 0xaa, 0xa8, 0xc6, 0xcc, 0xcf, 0xe4, 0xf0, 0xe4,
-    0xe1, 0xdd, 0xc9, 0xb8, 0xa8, 0xbb, 0xcc, 0xcc, 0xd5, 0xc9, 0xb8, 0xa8,
-    0x8c, 0x7a, 0x87, 0xb7, 0xae, 0x85, 0x73, 0x50, 0x43, 0x3a, 0x2e, 0x27,
-    0x28, 0x3e, 0x44, 0x43, 0x37, 0x3a, 0x2e, 0x28, 0x1d, 0x1b, 0x1b, 0x12,
-    0x1e, 0x3d, 0x51, 0x6b, 0x6b, 0x58, 0x43, 0x37, 0x28, 0x49, 0xb4, 0xd1,
-    0xce, 0xaa, 0x8c, 0x72, 0x58, 0x6f, 0x78, 0x9f, 0x8c, 0x82, 0x68, 0x4b,
-    0x37, 0x23, 0x28, 0x31, 0xd3, 0xe3, 0xe0, 0xd5, 0xa6, 0x70, 0x68, 0x50,
-    0x37, 0x27, 0x47, 0x86, 0xaa, 0x94, 0x71, 0x57, 0x42, 0x37, 0x2d, 0x31,
-    0x49, 0xe4, 0xee, 0xeb, 0xeb, 0xd5, 0xab, 0x88, 0x70, 0x58, 0x37, 0x2c,
-    0x23, 0x14, 0x0d, 0x1c, 0x4e, 0xe3, 0xdd, 0xd5, 0xb6, 0x8e, 0x71, 0x71,
-    0x57, 0x42, 0x32, 0x23, 0x1d, 0x2a, 0x87, 0xb2, 0xac, 0x91, 0x74, 0x87,
-    0x81, 0xa1, 0xba, 0xb7, 0xae, 0x91, 0x75, 0x69, 0x52, 0x3f, 0x3f, 0x3f,
-    0x6d, 0x7b, 0x75, 0x61, 0x55, 0x19, 0x06, 0x09, 0x0c, 0x19, 0x1f, 0x2b,
-    0x2e, 0x2e, 0x2e, 0x2b, 0x1c, 0x08, 0x03, 0x9d, 0xd5, 0xd7, 0xd9, 0xd0,
-    0xd0, 0xbe, 0xae, 0x96, 0x98, 0x98, 0x66, 0x50, 0x63, 0x74, 0x58, 0x1d,
-    0x30, 0x51, 0x75, 0xc9, 0xca, 0xc8, 0xc8, 0xc8, 0xb6, 0x8e, 0x8e, 0x66,
-    0x71, 0x93, 0xaa, 0xc6, 0xc6, 0xc8, 0xad, 0x96, 0x97, 0x83, 0x91, 0xb7,
-    0xd0, 0xd7, 0xe9, 0xea, 0xd8, 0xad, 0xb6, 0xca, 0xc8, 0xc5, 0xb6, 0xca,
-    0xaf, 0xdf, 0xd9, 0xdb, 0xc8, 0xca, 0xbc, 0xb2, 0xb4, 0xb9, 0x90, 0x81,
-    0x78, 0x64, 0x61, 0x6b, 0x68, 0x93, 0xb2, 0xb4, 0xd3, 0xb4, 0xae, 0x9f,
-    0xb2, 0xac, 0xaa, 0xbb, 0xae, 0x30, 0x37, 0x53, 0x53, 0x53, 0x56, 0x67,
-    0x20, 0x0b, 0x08, 0x08, 0x06, 0x05, 0x05, 0x05, 0x05, 0x08, 0x0a, 0x0a,
-    0x0a, 0x12, 0x1b, 0x1d, 0x27, 0x44, 0x44, 0x5e, 0x5e, 0x47, 0x5e, 0x56,
-    0x33, 0x19, 0x08, 0x05, 0x0a, 0x10, 0x14, 0x1a, 0x2e, 0x2e, 0x37, 0x43,
-    0x43, 0x58, 0x74, 0x75, 0x61, 0x6f, 0x6a, 0x4e, 0x1e, 0x1c, 0x10, 0x1e,
-    0x19, 0x2b, 0x28, 0x27, 0x2e, 0x2b, 0x1f, 0x1b, 0x1d, 0x1f, 0x28, 0x2e,
-    0x2c, 0x47, 0x64, 0x49, 0x49, 0x64, 0x7d, 0x72, 0x88, 0x9c, 0xb5, 0xb5,
-    0xb1, 0xb1, 0xb1, 0xcf, 0xe3, 0xe4, 0xe3, 0xe1, 0xce, 0xbb, 0xa5, 0x94,
-    0x93, 0xa2, 0xbb, 0xc6, 0xc9, 0xb8, 0xa8, 0x8c, 0x72, 0x72, 0x87, 0x9f,
-    0xa2, 0x82, 0x6b, 0x50, 0x44, 0x2c, 0x2e, 0x27, 0x2b, 0x29, 0x36, 0x2e,
-    0x2e, 0x27, 0x27, 0x1d, 0x1f, 0x1f, 0x1b, 0x19, 0x1b, 0x2b, 0x3e, 0x51,
-    0x50, 0x43, 0x37, 0x23, 0x1d, 0x49, 0xb4, 0xce, 0xc6, 0xb1, 0xaa, 0xa2,
-    0x8c, 0xa3, 0x9f, 0xa2, 0x8c, 0x7f, 0x68, 0x4b, 0x37, 0x2d, 0x49, 0x9d,
-    0xe3, 0xee, 0xe0, 0xc6, 0x96, 0x97, 0x85, 0x83, 0x58, 0x37, 0x2c, 0x60,
-    0xa2, 0x94, 0x71, 0x4b, 0x42, 0x2c, 0x31, 0x9d, 0xb4, 0xf0, 0xeb, 0xea,
-    0xe6, 0xca, 0xa7, 0x76, 0x5b, 0x4b, 0x42, 0x30, 0x10, 0x07, 0x07, 0x05,
-    0x06, 0xb9, 0xe1, 0xd7, 0xb6, 0x89, 0x76, 0x71, 0x57, 0x42, 0x37, 0x23,
-    0x1d, 0x31, 0xa0, 0xce, 0xc6, 0xaa, 0x91, 0xd1, 0xce, 0xd0, 0xac, 0xa1,
-    0x7e, 0x7b, 0xa3, 0xae, 0x9f, 0x6d, 0x52, 0x4a, 0x6d, 0x5e, 0x61, 0x6f,
-    0x54, 0x36, 0x0c, 0x08, 0x0a, 0x19, 0x1e, 0x1f, 0x2b, 0x28, 0x27, 0x1f,
-    0x10, 0x05, 0x3c, 0xce, 0xdc, 0xe7, 0xd9, 0xd9, 0xbc, 0x96, 0x98, 0x83,
-    0x73, 0x73, 0x63, 0x50, 0x58, 0x50, 0x32, 0x30, 0x2c, 0x44, 0x78, 0xa3,
-    0xb5, 0xca, 0xc8, 0xad, 0xb3, 0x8e, 0x76, 0x66, 0x57, 0x74, 0xa2, 0xa6,
-    0xa6, 0xb6, 0x8e, 0x7f, 0xbe, 0xd3, 0xe1, 0xd1, 0xca, 0xd7, 0xe7, 0xe6,
-    0xc8, 0xb6, 0xb6, 0xd5, 0xbc, 0xca, 0xc6, 0xd5, 0xca, 0xd9, 0xd7, 0xc5,
-    0xc5, 0xca, 0xbc, 0xae, 0xb4, 0xb9, 0x8f, 0x80, 0x6a, 0x69, 0x54, 0x58,
-    0x71, 0x93, 0xbb, 0xbe, 0xb2, 0xcf, 0xb4, 0xa1, 0xa0, 0xa2, 0xa2, 0xa2,
-    0x77, 0x37, 0x44, 0x51, 0x45, 0x53, 0x64, 0x60, 0x4e, 0x15, 0x0c, 0x0c,
-    0x0b, 0x08, 0x05, 0x03, 0x05, 0x05, 0x07, 0x07, 0x0a, 0x12, 0x14, 0x1a,
-    0x27, 0x37, 0x44, 0x51, 0x51, 0x51, 0x47, 0x3e, 0x35, 0x19, 0x0a, 0x08,
-    0x0a, 0x0d, 0x1b, 0x1d, 0x27, 0x23, 0x23, 0x43, 0x43, 0x58, 0x75, 0x86,
-    0x77, 0x78, 0x6a, 0x33, 0x1b, 0x19, 0x0d, 0x10, 0x1b, 0x1b, 0x1b, 0x1f,
-    0x1d, 0x1e, 0x1e, 0x1b, 0x1d, 0x1d, 0x28, 0x2e, 0x30, 0x47, 0x48, 0x56,
-    0x56, 0x7d, 0x9d, 0x8c, 0x7f, 0x7c, 0x9c, 0xa5, 0xd2, 0xcc, 0xb1, 0xcf,
-    0xd2, 0xe1, 0xce, 0xbb, 0xaa, 0x93, 0x7f, 0x71, 0x68, 0x82, 0xa2, 0xbb,
-    0xbb, 0xa8, 0x93, 0x82, 0x72, 0x68, 0x72, 0x8c, 0x86, 0x74, 0x58, 0x43,
-    0x37, 0x30, 0x2e, 0x2e, 0x2f, 0x2f, 0x36, 0x2e, 0x27, 0x27, 0x29, 0x27,
-    0x28, 0x1f, 0x1b, 0x14, 0x19, 0x1e, 0x2b, 0x2e, 0x3a, 0x2e, 0x27, 0x1d,
-    0x1b, 0x49, 0xa0, 0xbb, 0xb8, 0xbe, 0xdd, 0xdc, 0xce, 0xce, 0xbc, 0x97,
-    0x7f, 0x71, 0x58, 0x51, 0x45, 0x6e, 0xe5, 0xfa, 0xf6, 0xea, 0xdc, 0xbc,
-    0xac, 0xbc, 0xa2, 0x8c, 0x75, 0x42, 0x2c, 0x2c, 0x72, 0x71, 0x68, 0x42,
-    0x2c, 0x23, 0x49, 0xd3, 0xe3, 0xeb, 0xe6, 0xea, 0xd5, 0xab, 0x9c, 0x76,
-    0x5b, 0x4b, 0x42, 0x30, 0x10, 0x0a, 0x08, 0x05, 0x08, 0x6e, 0xdd, 0xc9,
-    0xb6, 0x89, 0x76, 0x5b, 0x57, 0x4b, 0x2c, 0x23, 0x4c, 0x80, 0xe3, 0xe7,
-    0xd5, 0xbe, 0xe0, 0xea, 0xe7, 0xca, 0xa3, 0xa1, 0xa1, 0x9f, 0xae, 0xbc,
-    0xbc, 0x91, 0x5e, 0x4a, 0x4a, 0x4a, 0x55, 0x69, 0x55, 0x36, 0x19, 0x0c,
-    0x16, 0x19, 0x2a, 0x2f, 0x2d, 0x28, 0x1f, 0x1b, 0x0d, 0x0b, 0x80, 0xdd,
-    0xf0, 0xed, 0xd9, 0xc8, 0xca, 0xce, 0xac, 0xac, 0x84, 0x58, 0x85, 0x7e,
-    0x61, 0x32, 0x37, 0x5a, 0x23, 0x3e, 0x7e, 0x8c, 0xa5, 0xca, 0xc8, 0xad,
-    0x8e, 0x8e, 0x7f, 0x71, 0x6b, 0xbe, 0xbb, 0x9c, 0x7f, 0x98, 0x96, 0xbb,
-    0xe3, 0xee, 0xeb, 0xd9, 0xb6, 0xd7, 0xe6, 0xde, 0xca, 0xa5, 0xaa, 0xd1,
-    0xd3, 0xd5, 0xd7, 0xd7, 0xca, 0xc8, 0xd8, 0xbf, 0xa9, 0xb6, 0xbb, 0xae,
-    0xb4, 0xb9, 0x8f, 0x6a, 0x6a, 0x48, 0x44, 0x50, 0x68, 0x7f, 0x96, 0xaa,
-    0xd1, 0xd3, 0xba, 0xa1, 0xa1, 0x91, 0x93, 0x86, 0x2e, 0x2e, 0x44, 0x5e,
-    0x60, 0x60, 0x60, 0x78, 0x6a, 0x22, 0x0a, 0x0c, 0x0c, 0x0b, 0x08, 0x03,
-    0x05, 0x05, 0x05, 0x0a, 0x0d, 0x10, 0x10, 0x1a, 0x1d, 0x27, 0x37, 0x30,
-    0x45, 0x45, 0x3e, 0x2e, 0x33, 0x12, 0x08, 0x05, 0x0a, 0x14, 0x1a, 0x1f,
-    0x1d, 0x1d, 0x23, 0x2c, 0x43, 0x58, 0x6b, 0x86, 0x75, 0x60, 0x56, 0x2d,
-    0x1e, 0x1b, 0x14, 0x14, 0x2a, 0x1e, 0x1b, 0x1e, 0x1e, 0x2a, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x28, 0x2b, 0x2d, 0x2d, 0x3d, 0x49, 0x56, 0x7d, 0x9d, 0x87,
-    0x72, 0x7c, 0xa5, 0xa8, 0xe1, 0xcc, 0xb1, 0xcc, 0xcf, 0xcf, 0xbb, 0xaa,
-    0x97, 0x74, 0x6b, 0x58, 0x57, 0x6b, 0x8c, 0xa2, 0xa8, 0xa2, 0x82, 0x7a,
-    0x7a, 0x6c, 0x5a, 0x6c, 0x75, 0x6b, 0x50, 0x44, 0x30, 0x2e, 0x2d, 0x4c,
-    0x4c, 0x36, 0x3e, 0x2e, 0x2e, 0x29, 0x29, 0x27, 0x28, 0x1f, 0x1b, 0x14,
-    0x12, 0x19, 0x12, 0x1c, 0x1e, 0x1f, 0x1d, 0x1b, 0x10, 0x33, 0x78, 0x9a,
-    0xb1, 0xe1, 0xeb, 0xe7, 0xd7, 0xd5, 0xbb, 0x94, 0x82, 0x84, 0x6c, 0x5a,
-    0x80, 0xf2, 0xfc, 0xf9, 0xea, 0xe7, 0xd9, 0xce, 0xbc, 0xbc, 0xaa, 0xa3,
-    0x91, 0x75, 0x44, 0x37, 0x44, 0x51, 0x44, 0x30, 0x2d, 0x2d, 0x67, 0xd3,
-    0xeb, 0xdd, 0xde, 0xdc, 0xd5, 0xb5, 0x88, 0x5b, 0x5b, 0x42, 0x4b, 0x37,
-    0x1a, 0x14, 0x0d, 0x08, 0x0b, 0x6e, 0xdc, 0xd7, 0xb5, 0x9c, 0x7c, 0x70,
-    0x5b, 0x6b, 0x51, 0x23, 0x4c, 0xba, 0xdf, 0xe7, 0xd5, 0xb7, 0xe3, 0xe3,
-    0xdf, 0xd0, 0xbc, 0xb7, 0xa1, 0x7e, 0xa1, 0xae, 0xae, 0x9f, 0x7b, 0x40,
-    0x52, 0x52, 0x55, 0x5e, 0x4a, 0x36, 0x21, 0x21, 0x3f, 0x35, 0x55, 0x6f,
-    0x6f, 0x55, 0x1d, 0x14, 0x0d, 0x08, 0x6a, 0xdc, 0xf9, 0xed, 0xde, 0xc8,
-    0xa6, 0xac, 0xac, 0xa3, 0x73, 0x58, 0x74, 0x85, 0x63, 0x43, 0x50, 0x5a,
-    0x58, 0x6c, 0x97, 0xa2, 0xb5, 0xab, 0x9c, 0xa6, 0x88, 0x94, 0xaf, 0x83,
-    0x9f, 0xbc, 0xc6, 0xca, 0xa5, 0xaf, 0xaa, 0xcf, 0xeb, 0xed, 0xea, 0xca,
-    0xb6, 0xd7, 0xde, 0xc8, 0xc6, 0xd1, 0xd1, 0xd2, 0xdd, 0xca, 0xc8, 0xc8,
-    0xc5, 0xc5, 0xc5, 0xa9, 0x8d, 0xb6, 0xaa, 0x9f, 0x9d, 0x9d, 0x80, 0x67,
-    0x4e, 0x3d, 0x3e, 0x43, 0x57, 0x71, 0x94, 0xaf, 0xce, 0xbe, 0xae, 0xd1,
-    0xd1, 0x9a, 0x75, 0x55, 0x1d, 0x27, 0x37, 0x46, 0x53, 0x53, 0x5a, 0x78,
-    0x80, 0x20, 0x0a, 0x13, 0x0b, 0x0b, 0x0b, 0x03, 0x02, 0x03, 0x03, 0x08,
-    0x0b, 0x0d, 0x10, 0x14, 0x1a, 0x27, 0x27, 0x2e, 0x30, 0x3d, 0x2f, 0x1c,
-    0x0c, 0x05, 0x03, 0x05, 0x0c, 0x1c, 0x14, 0x14, 0x1a, 0x1d, 0x27, 0x2c,
-    0x43, 0x50, 0x58, 0x6c, 0x5a, 0x5e, 0x3d, 0x2b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1d, 0x1f, 0x2b, 0x2b, 0x2f, 0x2a, 0x2a, 0x1e, 0x1e, 0x1e, 0x1d, 0x1d,
-    0x2d, 0x3e, 0x30, 0x56, 0x56, 0x7d, 0x9d, 0x64, 0x68, 0x7c, 0x94, 0x82,
-    0xdc, 0xc6, 0xbb, 0xb1, 0xb1, 0xaa, 0xa2, 0x8c, 0x82, 0x6b, 0x58, 0x4b,
-    0x4b, 0x4b, 0x6c, 0x86, 0x8c, 0x8c, 0x7a, 0x7a, 0x7a, 0x60, 0x53, 0x53,
-    0x60, 0x5a, 0x51, 0x30, 0x27, 0x28, 0x33, 0x69, 0x69, 0x55, 0x46, 0x3e,
-    0x36, 0x36, 0x29, 0x27, 0x1d, 0x1f, 0x1a, 0x14, 0x0d, 0x0c, 0x0b, 0x13,
-    0x12, 0x12, 0x19, 0x10, 0x12, 0x1c, 0x48, 0x7d, 0xb4, 0xeb, 0xed, 0xe7,
-    0xd7, 0xc6, 0xa5, 0x94, 0x97, 0x8c, 0x85, 0x78, 0xd4, 0xfe, 0xf9, 0xf9,
-    0xea, 0xd9, 0xd0, 0xbc, 0xaf, 0xa6, 0xaf, 0xa3, 0xa3, 0x86, 0x7e, 0x5a,
-    0x4b, 0x51, 0x30, 0x2d, 0x4e, 0x80, 0xb4, 0xd2, 0xe1, 0xdc, 0xd9, 0xdc,
-    0xc6, 0xa5, 0x93, 0x71, 0x57, 0x42, 0x42, 0x2c, 0x23, 0x1d, 0x10, 0x0a,
-    0x0a, 0x67, 0xdc, 0xd7, 0xc8, 0x9c, 0x94, 0x7f, 0x70, 0x72, 0x7a, 0x77,
-    0x81, 0xe0, 0xd9, 0xd9, 0xce, 0xd3, 0xd1, 0xe0, 0xe0, 0xe0, 0xea, 0xd9,
-    0xac, 0x7e, 0x8f, 0xd3, 0xbe, 0xd0, 0xa3, 0x5e, 0x6d, 0x7e, 0x7b, 0x91,
-    0x5e, 0x36, 0x24, 0x2f, 0x4c, 0x6f, 0x74, 0x84, 0x91, 0x75, 0x46, 0x1b,
-    0x0a, 0x05, 0x22, 0xce, 0xdc, 0xd9, 0xc8, 0xb6, 0xb6, 0x96, 0x98, 0x84,
-    0x6b, 0x4d, 0x66, 0x66, 0x43, 0x43, 0x58, 0x6c, 0x74, 0x43, 0x7a, 0xbc,
-    0xca, 0xa7, 0x8a, 0xa6, 0x9c, 0x94, 0x94, 0xbe, 0xe1, 0xd7, 0xd9, 0xe0,
-    0xce, 0x97, 0xbe, 0xdd, 0xeb, 0xf7, 0xea, 0xd8, 0xca, 0xc9, 0xca, 0xc6,
-    0xe0, 0xe0, 0xdd, 0xdc, 0xc6, 0xc8, 0xb6, 0xb6, 0xad, 0xad, 0xad, 0xad,
-    0x8e, 0xa6, 0xaa, 0x86, 0xa0, 0x9d, 0x6e, 0x67, 0x4e, 0x2d, 0x47, 0x44,
-    0x50, 0x66, 0x7f, 0x94, 0xaf, 0xac, 0xae, 0xbe, 0xce, 0xb2, 0x67, 0x28,
-    0x2d, 0x3e, 0x3e, 0x44, 0x51, 0x51, 0x5a, 0x6f, 0x67, 0x2a, 0x20, 0x22,
-    0x13, 0x15, 0x0c, 0x06, 0x02, 0x02, 0x02, 0x03, 0x05, 0x0a, 0x0d, 0x10,
-    0x14, 0x1e, 0x1f, 0x28, 0x2d, 0x2d, 0x1e, 0x05, 0x02, 0x02, 0x02, 0x05,
-    0x08, 0x0a, 0x10, 0x0a, 0x10, 0x1d, 0x27, 0x23, 0x2c, 0x32, 0x43, 0x44,
-    0x47, 0x3e, 0x28, 0x1b, 0x14, 0x1a, 0x1f, 0x1a, 0x1d, 0x1f, 0x28, 0x2d,
-    0x48, 0x40, 0x33, 0x2a, 0x28, 0x28, 0x28, 0x1d, 0x27, 0x30, 0x30, 0x56,
-    0x64, 0x78, 0x9b, 0x60, 0x72, 0x71, 0x7f, 0x68, 0xa5, 0xa5, 0xa2, 0xb1,
-    0xb1, 0xb1, 0x9a, 0x9a, 0x7a, 0x6b, 0x51, 0x51, 0x51, 0x51, 0x5a, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x60, 0x45, 0x30, 0x45, 0x45, 0x30, 0x28,
-    0x1d, 0x1e, 0x4e, 0x69, 0x7e, 0x6f, 0x54, 0x46, 0x3a, 0x36, 0x36, 0x29,
-    0x2b, 0x1f, 0x1a, 0x12, 0x0a, 0x0b, 0x0a, 0x12, 0x12, 0x12, 0x12, 0x12,
-    0x13, 0x10, 0x2a, 0x67, 0xd2, 0xed, 0xea, 0xd9, 0xd5, 0xb6, 0xa6, 0x94,
-    0x97, 0x8c, 0x85, 0x7d, 0xfa, 0xfa, 0xf9, 0xee, 0xdf, 0xd9, 0xd0, 0xb0,
-    0x96, 0x96, 0x97, 0xac, 0xa3, 0x91, 0x9f, 0x75, 0x4b, 0x42, 0x30, 0x49,
-    0xa1, 0xba, 0xd2, 0xdc, 0xdd, 0xd9, 0xd5, 0xe1, 0xaf, 0x94, 0x8c, 0x72,
-    0x4b, 0x32, 0x32, 0x2c, 0x23, 0x1d, 0x14, 0x0a, 0x0a, 0x34, 0xce, 0xd5,
-    0xc8, 0x8a, 0x8a, 0x97, 0x82, 0x8c, 0xce, 0xd5, 0xee, 0xf9, 0xea, 0xdc,
-    0xe0, 0xe3, 0xd0, 0xbc, 0xe0, 0xdf, 0xe7, 0xd9, 0xb0, 0x7e, 0xba, 0xbe,
-    0xce, 0xc6, 0xb0, 0x84, 0x6d, 0x7b, 0xa3, 0xac, 0x91, 0x54, 0x36, 0x36,
-    0x55, 0x6f, 0x75, 0x84, 0x84, 0x73, 0x50, 0x28, 0x0a, 0x03, 0x06, 0xa3,
-    0xca, 0xc8, 0xb3, 0xad, 0x8e, 0x8e, 0x98, 0x84, 0x75, 0x63, 0x50, 0x4b,
-    0x58, 0x32, 0x50, 0x50, 0x43, 0x23, 0x9b, 0xdc, 0xd5, 0xb6, 0x76, 0x94,
-    0x94, 0x66, 0x71, 0xd1, 0xe0, 0xe7, 0xdc, 0xe0, 0xdf, 0xbe, 0xce, 0xca,
-    0xe9, 0xed, 0xe7, 0xc8, 0xb6, 0x94, 0xaa, 0xd1, 0xe0, 0xdc, 0xdc, 0xd5,
-    0xbb, 0xb5, 0xa5, 0xa6, 0x7f, 0xaf, 0xbe, 0x97, 0x94, 0xa6, 0xaa, 0x77,
-    0x78, 0x80, 0x6e, 0x67, 0x4e, 0x3d, 0x47, 0x44, 0x50, 0x58, 0x73, 0x83,
-    0x8c, 0xa0, 0xb4, 0xb7, 0xce, 0xd1, 0x6a, 0x28, 0x28, 0x2e, 0x3e, 0x3a,
-    0x44, 0x51, 0x51, 0x60, 0x53, 0x45, 0x56, 0x4f, 0x26, 0x15, 0x0b, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x0d, 0x12, 0x12, 0x1b, 0x1b, 0x1b,
-    0x1f, 0x1f, 0x12, 0x03, 0x02, 0x02, 0x03, 0x05, 0x07, 0x07, 0x07, 0x08,
-    0x0a, 0x1a, 0x28, 0x23, 0x30, 0x30, 0x30, 0x3e, 0x2e, 0x1f, 0x1b, 0x1b,
-    0x1e, 0x1a, 0x1f, 0x1d, 0x27, 0x2e, 0x2e, 0x3e, 0x47, 0x48, 0x49, 0x3d,
-    0x2d, 0x2d, 0x2d, 0x30, 0x30, 0x30, 0x37, 0x53, 0x60, 0x77, 0x87, 0x77,
-    0x72, 0x57, 0x57, 0x4b, 0x94, 0x84, 0xb4, 0xe3, 0xe1, 0xd2, 0xd3, 0xd4,
-    0xb4, 0x78, 0x67, 0x7d, 0x60, 0x51, 0x51, 0x53, 0x5a, 0x60, 0x6c, 0x7a,
-    0x60, 0x53, 0x30, 0x2d, 0x2d, 0x2d, 0x28, 0x1e, 0x1b, 0x1b, 0x34, 0x81,
-    0x87, 0x75, 0x6b, 0x50, 0x46, 0x3a, 0x2e, 0x27, 0x1f, 0x1b, 0x14, 0x16,
-    0x0b, 0x13, 0x12, 0x1c, 0x1b, 0x1b, 0x1b, 0x14, 0x10, 0x1c, 0x2a, 0x67,
-    0xd2, 0xed, 0xea, 0xd9, 0xca, 0xb6, 0xa6, 0x94, 0x97, 0x97, 0x85, 0x9d,
-    0xfc, 0xfa, 0xee, 0xee, 0xdf, 0xca, 0xb6, 0x8e, 0x83, 0x83, 0x98, 0x97,
-    0x83, 0x84, 0x91, 0x75, 0x4b, 0x32, 0x30, 0x4e, 0xa0, 0xb2, 0xd1, 0xd5,
-    0xdc, 0xce, 0xca, 0xc9, 0x94, 0x7f, 0x84, 0x68, 0x42, 0x42, 0x2c, 0x2c,
-    0x2c, 0x23, 0x14, 0x10, 0x0b, 0x3c, 0xcf, 0xc6, 0xca, 0x9c, 0x9c, 0xaf,
-    0xcf, 0xeb, 0xe7, 0xd9, 0xf9, 0xf6, 0xea, 0xea, 0xf7, 0xea, 0xe2, 0xd3,
-    0xd1, 0xdf, 0xba, 0xd0, 0xac, 0xba, 0xd1, 0xae, 0xbc, 0xac, 0x91, 0x7b,
-    0x69, 0x6f, 0x91, 0x91, 0x97, 0x63, 0x4a, 0x36, 0x46, 0x61, 0x63, 0x74,
-    0x74, 0x6b, 0x50, 0x27, 0x0a, 0x06, 0x03, 0x4e, 0xa5, 0xb6, 0xa6, 0x8e,
-    0x7f, 0x71, 0x73, 0x73, 0x6b, 0x4d, 0x43, 0x58, 0x63, 0x43, 0x43, 0x5e,
-    0xb4, 0xae, 0xc6, 0xdc, 0xda, 0xb6, 0x94, 0xa2, 0xa2, 0x71, 0x74, 0xeb,
-    0xf7, 0xed, 0xea, 0xdc, 0xca, 0xaf, 0xaa, 0xca, 0xd7, 0xe6, 0xd8, 0xad,
-    0xad, 0xa2, 0xd3, 0xe3, 0xdc, 0xe9, 0xe9, 0xd7, 0xaf, 0x97, 0xa3, 0x84,
-    0x6b, 0xa3, 0xb7, 0xaf, 0xaf, 0xaf, 0xac, 0x87, 0x77, 0x81, 0x6a, 0x78,
-    0x87, 0x5e, 0x47, 0x46, 0x43, 0x58, 0x73, 0x74, 0x9f, 0xb4, 0xb4, 0xaa,
-    0xbb, 0xbc, 0x81, 0x48, 0x1d, 0x27, 0x2e, 0x3e, 0x3a, 0x44, 0x44, 0x45,
-    0x30, 0x37, 0x53, 0x67, 0x4e, 0x22, 0x0b, 0x06, 0x02, 0x00, 0x00, 0x02,
-    0x03, 0x08, 0x0c, 0x0a, 0x13, 0x12, 0x10, 0x14, 0x19, 0x19, 0x0c, 0x02,
-    0x02, 0x03, 0x08, 0x08, 0x0a, 0x0a, 0x0a, 0x07, 0x08, 0x10, 0x1d, 0x1d,
-    0x1e, 0x1d, 0x2d, 0x1e, 0x1e, 0x10, 0x14, 0x14, 0x1b, 0x1d, 0x1d, 0x28,
-    0x23, 0x30, 0x37, 0x37, 0x53, 0x56, 0x48, 0x53, 0x3d, 0x56, 0x48, 0x45,
-    0x30, 0x45, 0x56, 0x60, 0x7a, 0xa2, 0x9a, 0x9a, 0x5a, 0x42, 0x42, 0x42,
-    0x84, 0xa0, 0xf3, 0xf8, 0xee, 0xee, 0xf3, 0xf3, 0xe4, 0xb4, 0xb4, 0xd4,
-    0xa0, 0x77, 0x60, 0x53, 0x53, 0x64, 0x78, 0x7d, 0x7d, 0x64, 0x48, 0x31,
-    0x2a, 0x2a, 0x1e, 0x1c, 0x10, 0x10, 0x20, 0x6a, 0x78, 0x75, 0x6b, 0x50,
-    0x43, 0x44, 0x37, 0x30, 0x28, 0x1b, 0x1c, 0x16, 0x16, 0x19, 0x1e, 0x1e,
-    0x2a, 0x28, 0x28, 0x28, 0x1e, 0x33, 0x4e, 0x7d, 0xcf, 0xe0, 0xdc, 0xd5,
-    0xb6, 0xa6, 0xaf, 0x94, 0x97, 0x97, 0x74, 0xd2, 0xf3, 0xf9, 0xed, 0xee,
-    0xd9, 0xb3, 0x8e, 0x96, 0x83, 0x73, 0x84, 0x73, 0x71, 0x74, 0x85, 0x77,
-    0x60, 0x60, 0x64, 0x6a, 0x9f, 0xaa, 0xc6, 0xca, 0xc6, 0xca, 0xa7, 0x9c,
-    0x88, 0x71, 0x71, 0x4b, 0x4b, 0x50, 0x37, 0x2c, 0x23, 0x23, 0x14, 0x10,
-    0x0a, 0x0a, 0x67, 0xbb, 0xc9, 0xd5, 0xc6, 0xb6, 0xdd, 0xeb, 0xea, 0xdc,
-    0xed, 0xf7, 0xee, 0xf6, 0xf6, 0xef, 0xde, 0xdf, 0xe0, 0xd1, 0xa1, 0xa1,
-    0xd4, 0xd3, 0xe3, 0xdf, 0xbc, 0xac, 0xa1, 0x7b, 0x7b, 0x9f, 0x91, 0x84,
-    0x84, 0x61, 0x36, 0x36, 0x36, 0x54, 0x54, 0x75, 0x61, 0x61, 0x46, 0x27,
-    0x1c, 0x0a, 0x05, 0x0b, 0x86, 0x93, 0x7f, 0x66, 0x66, 0x91, 0x83, 0x50,
-    0x50, 0x43, 0x43, 0x5a, 0x74, 0x54, 0x6f, 0xd3, 0xd2, 0xdc, 0xd7, 0xd7,
-    0xd5, 0xbc, 0x93, 0xaa, 0xa2, 0x71, 0x86, 0xe1, 0xe9, 0xea, 0xe7, 0xdb,
-    0xb6, 0x94, 0x7f, 0x94, 0xca, 0xc8, 0xc8, 0xca, 0xaf, 0xe4, 0xd4, 0xdf,
-    0xd5, 0xea, 0xdc, 0xca, 0xa6, 0xaa, 0xd1, 0xa2, 0x8c, 0xac, 0xbc, 0xa6,
-    0xaf, 0xa6, 0xaf, 0xac, 0xa3, 0xa3, 0x9f, 0x91, 0xaa, 0x86, 0x6f, 0x64,
-    0x54, 0x54, 0x61, 0x86, 0xb4, 0xb9, 0xa0, 0x8c, 0x97, 0xaa, 0xa0, 0x49,
-    0x28, 0x1f, 0x27, 0x1d, 0x27, 0x2e, 0x2e, 0x27, 0x30, 0x37, 0x51, 0x60,
-    0x64, 0x31, 0x13, 0x0b, 0x03, 0x02, 0x03, 0x05, 0x05, 0x08, 0x05, 0x05,
-    0x08, 0x0c, 0x0d, 0x12, 0x0c, 0x0c, 0x05, 0x02, 0x02, 0x05, 0x0c, 0x0c,
-    0x0a, 0x0d, 0x12, 0x0a, 0x0a, 0x10, 0x1b, 0x14, 0x10, 0x14, 0x1e, 0x14,
-    0x12, 0x0a, 0x10, 0x14, 0x1a, 0x1d, 0x1d, 0x28, 0x30, 0x2c, 0x37, 0x44,
-    0x60, 0x64, 0x48, 0x53, 0x53, 0x64, 0x60, 0x60, 0x6c, 0x77, 0xa0, 0xb4,
-    0xb2, 0xcc, 0xb1, 0x9a, 0x53, 0x44, 0x2c, 0x42, 0x75, 0xd4, 0xfa, 0xed,
-    0xea, 0xdf, 0xe3, 0xe4, 0xe3, 0xd3, 0xd3, 0xe3, 0xd3, 0xae, 0x8c, 0x60,
-    0x56, 0x67, 0x7d, 0x9d, 0x9d, 0x7d, 0x67, 0x49, 0x34, 0x34, 0x20, 0x13,
-    0x13, 0x0a, 0x1c, 0x34, 0x64, 0x75, 0x6b, 0x50, 0x5a, 0x60, 0x64, 0x64,
-    0x3d, 0x1d, 0x1e, 0x1e, 0x24, 0x2f, 0x2f, 0x2d, 0x49, 0x56, 0x53, 0x48,
-    0x49, 0x67, 0x7e, 0x87, 0xbe, 0xdc, 0xd9, 0xca, 0xa6, 0xa6, 0xaf, 0x94,
-    0x7f, 0x73, 0x74, 0xb4, 0xf0, 0xed, 0xe7, 0xde, 0xc8, 0xad, 0x96, 0xa3,
-    0x83, 0x73, 0x84, 0x71, 0x74, 0x85, 0x85, 0x85, 0x7d, 0x80, 0x81, 0x6f,
-    0x87, 0xae, 0xaa, 0xa5, 0xa5, 0xb6, 0xa6, 0xaa, 0xa2, 0x7c, 0x57, 0x42,
-    0x42, 0x43, 0x2c, 0x23, 0x1d, 0x1d, 0x1a, 0x14, 0x10, 0x07, 0x34, 0xb4,
-    0xea, 0xd9, 0xd5, 0xb6, 0xd5, 0xed, 0xed, 0xed, 0xed, 0xee, 0xe0, 0xea,
-    0xea, 0xde, 0xe7, 0xe3, 0xe0, 0xd0, 0xd0, 0xac, 0xd1, 0xbe, 0xd1, 0xd9,
-    0xca, 0x98, 0x7b, 0x7b, 0x91, 0xac, 0xbb, 0xa2, 0x74, 0x69, 0x4a, 0x52,
-    0x52, 0x4a, 0x54, 0x63, 0x50, 0x39, 0x3a, 0x1d, 0x1b, 0x0a, 0x08, 0x02,
-    0x49, 0x7b, 0x84, 0x73, 0x73, 0x84, 0x58, 0x58, 0x6b, 0x58, 0x43, 0x58,
-    0x63, 0x4d, 0x54, 0xa3, 0xce, 0xe1, 0xdd, 0xdd, 0xe3, 0xbe, 0x94, 0x71,
-    0x82, 0x86, 0xcf, 0xe9, 0xea, 0xf7, 0xe7, 0xc8, 0xa7, 0x8e, 0x70, 0x66,
-    0x94, 0xaf, 0xb6, 0xb6, 0xbc, 0xe3, 0xe0, 0xd9, 0xca, 0xca, 0xc8, 0xb6,
-    0x8a, 0xaa, 0xd2, 0xbc, 0xce, 0xbb, 0xa6, 0xa6, 0xa6, 0xa6, 0x96, 0xaf,
-    0xa3, 0xaa, 0xac, 0xa3, 0x97, 0xa3, 0x91, 0x64, 0x55, 0x55, 0x6f, 0x86,
-    0xae, 0xb4, 0xa0, 0x85, 0x84, 0xa2, 0x9d, 0x6a, 0x2a, 0x1e, 0x1f, 0x1f,
-    0x1e, 0x1d, 0x28, 0x2d, 0x3e, 0x37, 0x51, 0x53, 0x60, 0x56, 0x22, 0x0b,
-    0x05, 0x03, 0x03, 0x08, 0x08, 0x08, 0x05, 0x03, 0x05, 0x08, 0x0c, 0x0c,
-    0x08, 0x08, 0x05, 0x00, 0x00, 0x03, 0x0b, 0x0c, 0x0a, 0x0a, 0x0d, 0x0d,
-    0x14, 0x10, 0x10, 0x14, 0x1b, 0x14, 0x14, 0x1b, 0x1e, 0x0d, 0x0d, 0x1b,
-    0x1f, 0x1d, 0x1d, 0x27, 0x30, 0x2c, 0x37, 0x51, 0x53, 0x56, 0x48, 0x48,
-    0x56, 0x45, 0x45, 0x44, 0x58, 0x7a, 0x9b, 0xb4, 0xb2, 0xb1, 0xb1, 0xa2,
-    0x60, 0x44, 0x30, 0x37, 0x87, 0xf3, 0xf8, 0xe7, 0xe2, 0xdf, 0xe3, 0xd3,
-    0xd3, 0xd3, 0xbe, 0xd3, 0xd3, 0xd1, 0xd3, 0xb4, 0x7d, 0xb9, 0xb9, 0xb9,
-    0xb9, 0xb4, 0x9a, 0x64, 0x56, 0x49, 0x20, 0x20, 0x20, 0x1c, 0x13, 0x34,
-    0x4e, 0x60, 0x6c, 0x64, 0x7d, 0xb4, 0xb4, 0xae, 0x77, 0x56, 0x3d, 0x40,
-    0x36, 0x47, 0x48, 0x6a, 0x7d, 0xa0, 0x9a, 0x86, 0x78, 0x78, 0x87, 0x87,
-    0x9a, 0xcf, 0xce, 0xc6, 0xaf, 0xaa, 0x97, 0x7c, 0x68, 0x72, 0x77, 0xd4,
-    0xf0, 0xeb, 0xdf, 0xde, 0xad, 0x89, 0x94, 0x96, 0x94, 0x7f, 0x7f, 0x7f,
-    0x87, 0xa0, 0xae, 0x9a, 0x9d, 0x80, 0x64, 0x6c, 0x9b, 0xbe, 0xaa, 0xbb,
-    0xaa, 0xaa, 0x93, 0xaa, 0xaa, 0x7f, 0x4b, 0x4b, 0x43, 0x32, 0x23, 0x1a,
-    0x1a, 0x1d, 0x1b, 0x14, 0x0d, 0x0a, 0x6e, 0xeb, 0xe7, 0xd7, 0xde, 0xaf,
-    0xbe, 0xf9, 0xf9, 0xeb, 0xee, 0xe3, 0xee, 0xed, 0xea, 0xea, 0xe3, 0xee,
-    0xf3, 0xdf, 0xb0, 0xb0, 0xbc, 0xbc, 0xbc, 0xaf, 0xa3, 0x7b, 0x63, 0x7e,
-    0x91, 0xa3, 0xaa, 0xaf, 0x84, 0x61, 0x4c, 0x69, 0x7e, 0x69, 0x54, 0x3a,
-    0x3a, 0x2e, 0x1d, 0x1e, 0x10, 0x10, 0x13, 0x0b, 0x22, 0x12, 0x33, 0x63,
-    0x73, 0x50, 0x43, 0x50, 0x58, 0x50, 0x43, 0x4b, 0x37, 0x23, 0x30, 0xb7,
-    0xe3, 0xe3, 0xe3, 0xe0, 0xbc, 0xaf, 0x7f, 0xa2, 0xb2, 0xae, 0xaa, 0xd7,
-    0xe8, 0xea, 0xde, 0xbf, 0x89, 0x8a, 0x66, 0x72, 0x9f, 0xbb, 0xa6, 0xb5,
-    0xdd, 0xe0, 0xdc, 0xca, 0xa6, 0xa6, 0xa6, 0xa6, 0x96, 0xaa, 0xbb, 0xc6,
-    0xbb, 0x94, 0x94, 0x96, 0x8e, 0x8e, 0x8e, 0x83, 0x97, 0xaf, 0x97, 0x97,
-    0x84, 0xa3, 0xa0, 0x81, 0x6a, 0x64, 0x77, 0x85, 0xa2, 0xae, 0x9f, 0x75,
-    0x86, 0xa2, 0xb4, 0x9d, 0x20, 0x10, 0x12, 0x0a, 0x0a, 0x10, 0x1d, 0x27,
-    0x3e, 0x37, 0x51, 0x53, 0x53, 0x56, 0x22, 0x07, 0x03, 0x03, 0x03, 0x08,
-    0x08, 0x0b, 0x08, 0x05, 0x08, 0x07, 0x0a, 0x0c, 0x0c, 0x0c, 0x09, 0x02,
-    0x02, 0x02, 0x08, 0x08, 0x0a, 0x10, 0x10, 0x10, 0x1b, 0x1e, 0x14, 0x1b,
-    0x1f, 0x1a, 0x1f, 0x1f, 0x1e, 0x10, 0x10, 0x1b, 0x1b, 0x1a, 0x1a, 0x1d,
-    0x28, 0x1d, 0x30, 0x30, 0x30, 0x45, 0x49, 0x2d, 0x2d, 0x23, 0x23, 0x2c,
-    0x37, 0x58, 0x7a, 0x8c, 0x8c, 0xb1, 0xaa, 0xa2, 0x77, 0x45, 0x30, 0x44,
-    0xae, 0xee, 0xea, 0xdb, 0xde, 0xd5, 0xce, 0xd3, 0xba, 0xb7, 0xbc, 0xd1,
-    0xd3, 0xd3, 0xe3, 0xd2, 0xd3, 0xe4, 0xe4, 0xd4, 0xd4, 0xb4, 0x9a, 0x87,
-    0x67, 0x49, 0x4f, 0x6e, 0x67, 0x49, 0x34, 0x34, 0x4e, 0x67, 0x67, 0x9d,
-    0xe4, 0xf0, 0xeb, 0xdd, 0xbe, 0x9f, 0x6f, 0x5e, 0x54, 0x55, 0x6a, 0xba,
-    0xd2, 0xdd, 0xcc, 0xaa, 0x9a, 0x87, 0x87, 0x87, 0xa0, 0xb4, 0xd2, 0xd1,
-    0xbe, 0xb7, 0xac, 0x82, 0x72, 0x86, 0xa0, 0xe4, 0xf3, 0xee, 0xe3, 0xd9,
-    0xb6, 0x96, 0x94, 0x7c, 0x71, 0x71, 0x71, 0xb4, 0xe4, 0xfa, 0xeb, 0xdd,
-    0xe1, 0xb2, 0x87, 0x75, 0x9a, 0xaa, 0xa2, 0xaa, 0xaa, 0xac, 0xaf, 0x7f,
-    0x7f, 0x57, 0x4b, 0x58, 0x58, 0x43, 0x2c, 0x23, 0x23, 0x1d, 0x1b, 0x14,
-    0x10, 0x0a, 0x90, 0xeb, 0xe7, 0xd7, 0xc8, 0xc6, 0xd1, 0xe3, 0xf7, 0xf9,
-    0xee, 0xe0, 0xee, 0xf8, 0xee, 0xe3, 0xf3, 0xe3, 0xf3, 0xd3, 0xd1, 0xd3,
-    0xc6, 0xd0, 0xbc, 0xac, 0x9f, 0x7b, 0x91, 0xae, 0xae, 0xa3, 0x97, 0x97,
-    0x74, 0x61, 0x6f, 0x75, 0x91, 0x85, 0x91, 0x54, 0x3a, 0x29, 0x2b, 0x1e,
-    0x10, 0x1e, 0x33, 0x20, 0x1c, 0x0b, 0x06, 0x40, 0x58, 0x43, 0x43, 0x50,
-    0x43, 0x2c, 0x37, 0x4b, 0x43, 0x30, 0xa0, 0xf0, 0xeb, 0xe0, 0xee, 0xdf,
-    0xce, 0xbe, 0x97, 0xb4, 0xac, 0x7f, 0x50, 0x6b, 0xc9, 0xde, 0xc5, 0xa9,
-    0x89, 0x76, 0x66, 0xb2, 0xcc, 0x9c, 0x93, 0xdd, 0xdc, 0xdc, 0xdc, 0xc6,
-    0xa6, 0x7f, 0x84, 0x97, 0x97, 0xac, 0xb0, 0xbc, 0xbc, 0x83, 0x73, 0x73,
-    0x66, 0x66, 0x66, 0x73, 0x96, 0x97, 0x83, 0x83, 0x73, 0x84, 0x9f, 0xa0,
-    0x81, 0x87, 0x87, 0x85, 0x97, 0xa3, 0x77, 0x6b, 0x86, 0xa0, 0xb2, 0xb4,
-    0x4f, 0x0a, 0x0a, 0x0a, 0x0a, 0x14, 0x1d, 0x28, 0x2e, 0x44, 0x5a, 0x53,
-    0x53, 0x3d, 0x1c, 0x08, 0x03, 0x03, 0x05, 0x08, 0x0b, 0x0a, 0x0a, 0x0b,
-    0x0a, 0x12, 0x0d, 0x0a, 0x12, 0x12, 0x0c, 0x05, 0x03, 0x05, 0x05, 0x07,
-    0x0a, 0x10, 0x10, 0x1b, 0x14, 0x1e, 0x1e, 0x1f, 0x2b, 0x28, 0x28, 0x28,
-    0x1b, 0x10, 0x10, 0x14, 0x1b, 0x1b, 0x1a, 0x1a, 0x1f, 0x1a, 0x28, 0x2d,
-    0x30, 0x56, 0x49, 0x1e, 0x1a, 0x1a, 0x1d, 0x23, 0x2c, 0x43, 0x58, 0x72,
-    0x72, 0x8c, 0xa2, 0x8c, 0x75, 0x5a, 0x44, 0x5a, 0xb7, 0xdf, 0xde, 0xcd,
-    0xb0, 0xd0, 0xbe, 0xb7, 0xb7, 0xac, 0xac, 0xce, 0xd1, 0xd1, 0xd2, 0xd1,
-    0xce, 0xe3, 0xe3, 0xd2, 0xd3, 0xd2, 0xb2, 0xa0, 0x7d, 0x80, 0x9e, 0xd4,
-    0xe4, 0xb4, 0x9d, 0x6e, 0x80, 0x9d, 0xb4, 0xe4, 0xf3, 0xee, 0xeb, 0xdf,
-    0xce, 0xae, 0x9f, 0x77, 0x61, 0x64, 0x9d, 0xe4, 0xee, 0xdd, 0xcc, 0xcc,
-    0xd2, 0xb4, 0xb4, 0xa0, 0xb4, 0xd3, 0xe3, 0xd3, 0xd3, 0xd3, 0xd3, 0xb7,
-    0xb2, 0xb4, 0xd4, 0xe4, 0xee, 0xeb, 0xd9, 0xca, 0xd0, 0xd1, 0xaf, 0x76,
-    0x73, 0x86, 0xb4, 0xfc, 0xfe, 0xfa, 0xf7, 0xe6, 0xd5, 0xbc, 0xac, 0x72,
-    0x7a, 0x8c, 0x8c, 0x93, 0x7f, 0x7f, 0x83, 0x66, 0x4b, 0x50, 0x43, 0x50,
-    0x5a, 0x44, 0x2c, 0x2c, 0x23, 0x27, 0x1d, 0x1b, 0x10, 0x0a, 0x7d, 0xea,
-    0xea, 0xdc, 0xca, 0xb6, 0xbe, 0xe3, 0xf9, 0xf7, 0xee, 0xe3, 0xee, 0xee,
-    0xf3, 0xf3, 0xf3, 0xee, 0xe0, 0xdf, 0xd1, 0xce, 0xb0, 0x97, 0x98, 0xa3,
-    0x91, 0x7b, 0xa0, 0xbc, 0xce, 0xbc, 0x97, 0x7b, 0x6d, 0x4a, 0x61, 0x7b,
-    0x98, 0xa3, 0xa3, 0x84, 0x3a, 0x2b, 0x2b, 0x1f, 0x14, 0x2b, 0x28, 0x1d,
-    0x1b, 0x1c, 0x13, 0x1e, 0x54, 0x51, 0x5a, 0x58, 0x43, 0x37, 0x43, 0x50,
-    0x43, 0x77, 0xcf, 0xe9, 0xea, 0xed, 0xe7, 0xd9, 0xe3, 0xd1, 0x83, 0x73,
-    0x71, 0x50, 0x50, 0x4b, 0xa5, 0xb6, 0xb6, 0x8a, 0x89, 0x76, 0x71, 0xbe,
-    0xaf, 0xa6, 0xd1, 0xdc, 0xb6, 0xca, 0xdc, 0xca, 0x94, 0x7f, 0x84, 0xa0,
-    0xae, 0xa3, 0xaf, 0xaf, 0x96, 0x66, 0x58, 0x4d, 0x39, 0x39, 0x39, 0x73,
-    0x83, 0x7f, 0x83, 0x73, 0x63, 0x74, 0x91, 0x9f, 0x7e, 0x6f, 0x63, 0x63,
-    0x83, 0x91, 0x6a, 0x60, 0x87, 0x9a, 0x9a, 0xb2, 0x9d, 0x13, 0x0a, 0x1c,
-    0x10, 0x1a, 0x2e, 0x3d, 0x2e, 0x43, 0x43, 0x44, 0x45, 0x3d, 0x34, 0x15,
-    0x06, 0x15, 0x08, 0x1c, 0x34, 0x49, 0x4e, 0x34, 0x20, 0x20, 0x1c, 0x10,
-    0x1c, 0x1c, 0x1c, 0x13, 0x0c, 0x0b, 0x07, 0x0a, 0x10, 0x10, 0x1c, 0x1b,
-    0x1e, 0x1a, 0x28, 0x28, 0x28, 0x2e, 0x3e, 0x2e, 0x1e, 0x0d, 0x0d, 0x10,
-    0x1b, 0x1b, 0x1d, 0x1d, 0x1a, 0x28, 0x27, 0x30, 0x30, 0x56, 0x34, 0x10,
-    0x14, 0x14, 0x1a, 0x1a, 0x23, 0x2c, 0x37, 0x50, 0x6b, 0x72, 0x71, 0x82,
-    0x50, 0x4b, 0x6b, 0x72, 0xb7, 0xdf, 0xcd, 0xb3, 0xbc, 0xb7, 0xac, 0x9f,
-    0x91, 0x98, 0x83, 0xac, 0xac, 0xaf, 0xaa, 0xaf, 0xa5, 0xcf, 0xcf, 0xcf,
-    0xcf, 0xd2, 0xd3, 0xba, 0xb9, 0xb9, 0xf2, 0xf3, 0xf0, 0xe3, 0xd3, 0xb9,
-    0xb9, 0xd4, 0xe4, 0xf3, 0xee, 0xed, 0xdc, 0xd5, 0xbb, 0xaa, 0xa2, 0x91,
-    0x77, 0x9d, 0xd4, 0xf0, 0xeb, 0xeb, 0xe1, 0xf0, 0xf2, 0xf3, 0xe3, 0xd1,
-    0xd3, 0xe3, 0xe1, 0xe0, 0xe1, 0xe1, 0xe0, 0xd2, 0xd2, 0xe4, 0xe4, 0xe4,
-    0xe3, 0xeb, 0xd9, 0xc8, 0xc8, 0xd0, 0xb3, 0x7f, 0xa3, 0xd4, 0xfc, 0xfe,
-    0xf9, 0xf6, 0xe6, 0xd8, 0xc8, 0xb5, 0xa5, 0x71, 0x58, 0x77, 0x7a, 0x68,
-    0x57, 0x58, 0x6b, 0x4b, 0x6c, 0x75, 0x50, 0x37, 0x37, 0x37, 0x2c, 0x2c,
-    0x23, 0x1d, 0x1d, 0x1b, 0x14, 0x0a, 0x4f, 0xdd, 0xdc, 0xd7, 0xc8, 0xd5,
-    0xe1, 0xee, 0xee, 0xf9, 0xee, 0xee, 0xed, 0xed, 0xee, 0xed, 0xed, 0xdf,
-    0xdb, 0xca, 0xb0, 0xa6, 0x97, 0x91, 0x91, 0x85, 0x73, 0x91, 0x7e, 0xac,
-    0xbb, 0xbb, 0x96, 0x7b, 0x6d, 0x5e, 0x4a, 0x61, 0x73, 0x98, 0x98, 0x83,
-    0x46, 0x1f, 0x1b, 0x1b, 0x2a, 0x40, 0x2d, 0x2d, 0x49, 0x49, 0x2d, 0x3d,
-    0x2d, 0x2e, 0x46, 0x54, 0x43, 0x50, 0x54, 0x50, 0x43, 0x53, 0xdd, 0xea,
-    0xea, 0xe7, 0xe7, 0xdf, 0xdf, 0xb0, 0x91, 0x6b, 0x50, 0x50, 0x75, 0x72,
-    0x58, 0xaa, 0xa5, 0x9c, 0x8e, 0x7f, 0xbe, 0xe1, 0xdd, 0xe1, 0xd1, 0xbb,
-    0x88, 0xb6, 0xc8, 0xb6, 0x8e, 0x70, 0x8c, 0xd3, 0xb2, 0x9f, 0x84, 0x94,
-    0x83, 0x66, 0x50, 0x43, 0x2c, 0x37, 0x2c, 0x50, 0x6b, 0x63, 0x63, 0x4d,
-    0x61, 0x75, 0x91, 0x91, 0x77, 0x61, 0x5a, 0x6c, 0x77, 0xa0, 0x9d, 0x60,
-    0x77, 0x86, 0x8c, 0xaa, 0xb2, 0x34, 0x1c, 0x1e, 0x1e, 0x1d, 0x45, 0x30,
-    0x30, 0x30, 0x37, 0x37, 0x45, 0x48, 0x31, 0x1c, 0x20, 0x34, 0x34, 0x64,
-    0x86, 0x8c, 0xa2, 0xb1, 0xb4, 0x4f, 0x34, 0x34, 0x20, 0x34, 0x4e, 0x6d,
-    0x4e, 0x34, 0x20, 0x1c, 0x10, 0x10, 0x14, 0x14, 0x1d, 0x1d, 0x28, 0x23,
-    0x30, 0x3e, 0x3e, 0x3d, 0x2a, 0x0b, 0x07, 0x13, 0x14, 0x14, 0x1e, 0x1e,
-    0x1d, 0x28, 0x2e, 0x30, 0x45, 0x48, 0x20, 0x10, 0x10, 0x14, 0x14, 0x1a,
-    0x1d, 0x27, 0x2e, 0x43, 0x58, 0x58, 0x58, 0x74, 0x51, 0x51, 0x72, 0x8c,
-    0x9f, 0xd1, 0xd0, 0xac, 0xb7, 0xb7, 0xa3, 0x7b, 0x7b, 0x74, 0x98, 0xac,
-    0xae, 0x7f, 0x71, 0x7f, 0xbc, 0xcf, 0xcf, 0xcf, 0xd2, 0xd2, 0xd2, 0xd3,
-    0xd4, 0xe4, 0xf0, 0xeb, 0xeb, 0xd2, 0xd3, 0xd2, 0xd4, 0xe4, 0xf3, 0xe1,
-    0xe0, 0xdc, 0xce, 0xc6, 0xae, 0xae, 0xaa, 0x9f, 0x9d, 0xd4, 0xf3, 0xf0,
-    0xee, 0xfa, 0xfa, 0xfa, 0xf3, 0xee, 0xdf, 0xe0, 0xe3, 0xe3, 0xdf, 0xd9,
-    0xdc, 0xdd, 0xd2, 0xe1, 0xe1, 0xdd, 0xcf, 0xe3, 0xee, 0xeb, 0xd9, 0xc8,
-    0xa7, 0xa6, 0x94, 0x7f, 0xac, 0xf3, 0xfc, 0xf9, 0xf5, 0xe7, 0xdb, 0xc8,
-    0xb6, 0xa6, 0x94, 0x7f, 0x6c, 0x77, 0x5a, 0x44, 0x44, 0x64, 0x77, 0x78,
-    0xa0, 0x77, 0x60, 0x67, 0x67, 0x78, 0x45, 0x30, 0x1d, 0x1b, 0x1e, 0x14,
-    0x14, 0x0d, 0x34, 0xd2, 0xdc, 0xd9, 0xce, 0xed, 0xed, 0xed, 0xee, 0xee,
-    0xf0, 0xee, 0xed, 0xed, 0xf9, 0xf7, 0xea, 0xd9, 0xdc, 0xe1, 0xce, 0xa6,
-    0x94, 0x84, 0x91, 0x91, 0x83, 0x83, 0x91, 0xa3, 0xaf, 0x96, 0x84, 0x7b,
-    0x61, 0x75, 0x63, 0x63, 0x63, 0x83, 0x83, 0x63, 0x46, 0x1f, 0x14, 0x1b,
-    0x40, 0x4a, 0x3e, 0x53, 0x56, 0x47, 0x45, 0x28, 0x1c, 0x10, 0x2b, 0x3d,
-    0x46, 0x43, 0x4d, 0x54, 0x27, 0x55, 0xd5, 0xea, 0xee, 0xea, 0xd9, 0xd9,
-    0xca, 0x96, 0x91, 0x58, 0x50, 0x58, 0x57, 0x43, 0x55, 0xb2, 0x7f, 0x7f,
-    0x94, 0xce, 0xf0, 0xee, 0xf3, 0xeb, 0xcf, 0xc6, 0x7f, 0x94, 0x94, 0x94,
-    0x7f, 0x71, 0xa2, 0xcf, 0xbb, 0x91, 0x84, 0x66, 0x6b, 0x74, 0x50, 0x50,
-    0x43, 0x46, 0x3a, 0x3a, 0x54, 0x54, 0x46, 0x3a, 0x39, 0x4d, 0x73, 0x84,
-    0x75, 0x5e, 0x6f, 0x9d, 0x9d, 0xa0, 0x7d, 0x5a, 0x77, 0x86, 0x86, 0xa2,
-    0xb1, 0x4e, 0x1d, 0x28, 0x1f, 0x27, 0x30, 0x23, 0x30, 0x45, 0x47, 0x45,
-    0x45, 0x47, 0x45, 0x2b, 0x49, 0x64, 0x60, 0x6c, 0x86, 0xa2, 0x93, 0xa8,
-    0xb1, 0xb7, 0x80, 0x4e, 0x48, 0x33, 0x6a, 0x80, 0x78, 0x78, 0x7d, 0x80,
-    0x20, 0x1c, 0x14, 0x14, 0x1d, 0x1d, 0x23, 0x2c, 0x37, 0x51, 0x55, 0x2f,
-    0x13, 0x08, 0x05, 0x05, 0x0a, 0x0d, 0x1c, 0x1c, 0x1e, 0x28, 0x2d, 0x30,
-    0x30, 0x28, 0x10, 0x0a, 0x10, 0x10, 0x14, 0x1a, 0x1a, 0x27, 0x27, 0x37,
-    0x51, 0x51, 0x51, 0x6b, 0x60, 0x6c, 0x72, 0xa2, 0x75, 0xd1, 0xd0, 0xd1,
-    0xb7, 0xac, 0x84, 0x7b, 0x7b, 0x74, 0x84, 0x98, 0x91, 0x84, 0x6b, 0x8c,
-    0xce, 0xd9, 0xc6, 0xbc, 0xcf, 0xcf, 0xcf, 0xcf, 0xe1, 0xe3, 0xe1, 0xdc,
-    0xdc, 0xcf, 0xd3, 0xe4, 0xeb, 0xee, 0xe1, 0xdc, 0xce, 0xbe, 0xbc, 0xbe,
-    0xd2, 0xd3, 0xcf, 0xbe, 0xd2, 0xe3, 0xf3, 0xee, 0xf2, 0xfc, 0xfe, 0xfa,
-    0xee, 0xe3, 0xce, 0xd2, 0xe4, 0xe0, 0xd5, 0xca, 0xcf, 0xe4, 0xe4, 0xe3,
-    0xdc, 0xc9, 0xc9, 0xe1, 0xeb, 0xdc, 0xc8, 0xb6, 0xa6, 0xac, 0xaf, 0xa2,
-    0xb2, 0xf3, 0xf9, 0xee, 0xe7, 0xde, 0xd7, 0xca, 0xa6, 0x94, 0x94, 0x82,
-    0x8c, 0x75, 0x44, 0x23, 0x49, 0x78, 0x60, 0x9d, 0xb2, 0xb4, 0xd4, 0xe4,
-    0xd2, 0xb1, 0x60, 0x30, 0x1b, 0x10, 0x10, 0x0d, 0x19, 0x1e, 0x20, 0x9a,
-    0xd5, 0xc6, 0xeb, 0xf7, 0xea, 0xea, 0xed, 0xee, 0xee, 0xf9, 0xfe, 0xfc,
-    0xfc, 0xfa, 0xf9, 0xed, 0xe3, 0xe3, 0xd1, 0x96, 0x7f, 0x83, 0x84, 0x84,
-    0x83, 0x83, 0x97, 0x97, 0x84, 0x73, 0x61, 0x61, 0x86, 0x91, 0xa3, 0x7b,
-    0x63, 0x63, 0x63, 0x4d, 0x36, 0x1e, 0x1b, 0x1f, 0x2e, 0x44, 0x44, 0x55,
-    0x60, 0x5a, 0x46, 0x30, 0x1d, 0x12, 0x13, 0x1b, 0x1b, 0x28, 0x45, 0x3e,
-    0x27, 0x48, 0xbb, 0xe9, 0xee, 0xea, 0xde, 0xca, 0xa6, 0x96, 0x83, 0x58,
-    0x75, 0x72, 0x43, 0x2e, 0x54, 0x85, 0x71, 0x71, 0x88, 0xce, 0xe1, 0xee,
-    0xee, 0xe0, 0xdd, 0xaa, 0x94, 0x7a, 0x68, 0x7f, 0x84, 0x93, 0xd2, 0xcf,
-    0xc6, 0xaa, 0x7f, 0x57, 0x50, 0x91, 0x86, 0x58, 0x63, 0x54, 0x46, 0x3e,
-    0x2e, 0x3e, 0x36, 0x36, 0x46, 0x4d, 0x63, 0x63, 0x6f, 0x64, 0x9d, 0x9d,
-    0x9d, 0xa0, 0xa0, 0x5e, 0x6f, 0x86, 0x86, 0x8c, 0xa2, 0x78, 0x64, 0x2d,
-    0x1e, 0x1d, 0x2e, 0x23, 0x37, 0x51, 0x54, 0x47, 0x30, 0x30, 0x51, 0x47,
-    0x5a, 0x6c, 0x58, 0x7a, 0x8c, 0xa2, 0xa2, 0xa8, 0xa8, 0xaa, 0x9f, 0x67,
-    0x48, 0x69, 0x78, 0x75, 0x87, 0x87, 0x9f, 0xa0, 0x6a, 0x20, 0x14, 0x1b,
-    0x1a, 0x1d, 0x23, 0x2c, 0x44, 0x53, 0x56, 0x22, 0x07, 0x05, 0x02, 0x03,
-    0x07, 0x0a, 0x13, 0x1c, 0x20, 0x2a, 0x31, 0x2a, 0x20, 0x13, 0x07, 0x07,
-    0x0a, 0x0d, 0x14, 0x14, 0x1a, 0x28, 0x27, 0x30, 0x44, 0x55, 0x44, 0x5a,
-    0x60, 0x6c, 0x72, 0x8c, 0x51, 0x86, 0xac, 0xac, 0xa3, 0x98, 0x73, 0x74,
-    0x7b, 0x74, 0x73, 0x6b, 0x63, 0x58, 0x5a, 0x7b, 0xae, 0xbc, 0xbe, 0xaa,
-    0xae, 0xb2, 0xcc, 0xcf, 0xdd, 0xdc, 0xd5, 0xc6, 0xc6, 0xce, 0xd2, 0xee,
-    0xeb, 0xe9, 0xdc, 0xce, 0xb4, 0xb7, 0xae, 0xd3, 0xf3, 0xf0, 0xeb, 0xdd,
-    0xdd, 0xe0, 0xe0, 0xe1, 0xfc, 0xfc, 0xfa, 0xf0, 0xe3, 0xdf, 0xce, 0xd1,
-    0xd1, 0xd1, 0xce, 0xce, 0xd2, 0xe4, 0xf0, 0xe3, 0xe3, 0xf0, 0xf0, 0xeb,
-    0xf3, 0xcf, 0xca, 0xbb, 0xbe, 0xce, 0xbc, 0xd1, 0xd3, 0xeb, 0xea, 0xed,
-    0xdf, 0xdf, 0xd5, 0xbb, 0xbb, 0xaa, 0xa2, 0xa8, 0x8c, 0x72, 0x45, 0x33,
-    0x6a, 0x78, 0x78, 0xd3, 0xd2, 0xe4, 0xe4, 0xeb, 0xdc, 0xcc, 0xa8, 0x7a,
-    0x1d, 0x07, 0x05, 0x0a, 0x1c, 0x3d, 0x48, 0x64, 0xaa, 0xdd, 0xe3, 0xe0,
-    0xed, 0xeb, 0xf7, 0xf3, 0xed, 0xfa, 0xfc, 0xfc, 0xfc, 0xf9, 0xed, 0xdf,
-    0xd9, 0xd5, 0xaf, 0x96, 0x83, 0x84, 0x83, 0x73, 0x96, 0x73, 0x91, 0x86,
-    0x73, 0x63, 0x7b, 0x6f, 0x74, 0x97, 0xac, 0xa3, 0x61, 0x61, 0x54, 0x46,
-    0x29, 0x1e, 0x1e, 0x2b, 0x2f, 0x47, 0x6f, 0x6f, 0x6c, 0x58, 0x5a, 0x53,
-    0x2d, 0x10, 0x0a, 0x0a, 0x1c, 0x1a, 0x14, 0x14, 0x1f, 0x2e, 0x75, 0xd7,
-    0xd7, 0xde, 0xc8, 0xad, 0x94, 0x7f, 0x6b, 0x6b, 0x75, 0x74, 0x32, 0x43,
-    0x50, 0x58, 0x71, 0x5b, 0x50, 0xcf, 0xeb, 0xf7, 0xed, 0xd9, 0xca, 0xa6,
-    0x93, 0x6b, 0x50, 0x32, 0x87, 0x9a, 0xbe, 0xa8, 0xb8, 0xaf, 0x7f, 0x57,
-    0x58, 0xb4, 0x91, 0x74, 0x74, 0x61, 0x54, 0x3e, 0x36, 0x36, 0x36, 0x36,
-    0x46, 0x54, 0x54, 0x61, 0x64, 0x78, 0x9a, 0x9d, 0x78, 0x8c, 0xa0, 0x48,
-    0x5a, 0x58, 0x58, 0x74, 0xa2, 0xae, 0x86, 0x77, 0x3d, 0x3d, 0x48, 0x2e,
-    0x23, 0x37, 0x37, 0x37, 0x2e, 0x30, 0x60, 0x60, 0x58, 0x58, 0x6b, 0x68,
-    0x82, 0x82, 0x93, 0xaa, 0xaa, 0xaa, 0xae, 0x77, 0x60, 0x77, 0x60, 0x6c,
-    0x85, 0x87, 0x9a, 0x8c, 0x87, 0x2a, 0x1b, 0x14, 0x1b, 0x1d, 0x27, 0x2e,
-    0x37, 0x47, 0x3d, 0x1e, 0x07, 0x03, 0x03, 0x05, 0x08, 0x0a, 0x13, 0x22,
-    0x20, 0x34, 0x31, 0x49, 0x34, 0x20, 0x12, 0x0a, 0x0a, 0x0a, 0x14, 0x14,
-    0x1a, 0x1d, 0x1d, 0x27, 0x2e, 0x2e, 0x30, 0x51, 0x5a, 0x5a, 0x58, 0x72,
-    0x37, 0x47, 0x7e, 0xae, 0x98, 0x83, 0x66, 0x58, 0x61, 0x7b, 0x58, 0x43,
-    0x5a, 0x6f, 0x64, 0x81, 0xb7, 0xb7, 0xbe, 0xaa, 0xae, 0xcf, 0xdd, 0xce,
-    0xc6, 0xbb, 0xaf, 0xbb, 0xce, 0xe1, 0xe1, 0xdd, 0xdc, 0xce, 0xc6, 0xbb,
-    0xae, 0x9f, 0xb4, 0xe4, 0xf0, 0xf7, 0xeb, 0xe7, 0xd5, 0xc6, 0xc6, 0xcf,
-    0xfa, 0xf9, 0xf7, 0xea, 0xdf, 0xd9, 0xce, 0xe0, 0xe4, 0xf3, 0xf3, 0xf3,
-    0xf0, 0xf3, 0xf3, 0xf3, 0xfc, 0xfe, 0xfd, 0xf9, 0xee, 0xeb, 0xee, 0xf2,
-    0xe4, 0xdc, 0xcc, 0xce, 0xe3, 0xed, 0xea, 0xe7, 0xd9, 0xe0, 0xd2, 0xf0,
-    0xf3, 0xfa, 0xfa, 0xdd, 0xb1, 0x78, 0x6e, 0x6e, 0x80, 0xa0, 0xa0, 0xcf,
-    0xd2, 0xf2, 0xf0, 0xd7, 0xdc, 0xd5, 0xb6, 0x94, 0x45, 0x10, 0x0a, 0x1c,
-    0x33, 0x56, 0x60, 0x78, 0xa0, 0xe3, 0xeb, 0xce, 0xe0, 0xee, 0xfa, 0xf0,
-    0xed, 0xf6, 0xf9, 0xf9, 0xf9, 0xe2, 0xde, 0xcd, 0xb6, 0xa6, 0x96, 0x83,
-    0x73, 0x74, 0x73, 0x83, 0x96, 0x96, 0x91, 0x91, 0x83, 0x75, 0x7b, 0x91,
-    0x7b, 0x97, 0x96, 0x98, 0x61, 0x4a, 0x36, 0x24, 0x1f, 0x25, 0x25, 0x2f,
-    0x2f, 0x4a, 0x5e, 0x54, 0x58, 0x58, 0x58, 0x50, 0x37, 0x14, 0x0a, 0x12,
-    0x21, 0x1e, 0x14, 0x0d, 0x1e, 0x2e, 0x51, 0xaf, 0xca, 0xc8, 0xad, 0x8e,
-    0x7f, 0x73, 0x71, 0x50, 0x50, 0x4b, 0x32, 0x50, 0x91, 0xaa, 0x93, 0x8c,
-    0xae, 0xdc, 0xe9, 0xed, 0xe9, 0xd7, 0xca, 0xa6, 0x83, 0x6b, 0x43, 0x37,
-    0xa0, 0x9f, 0xa2, 0xaa, 0x84, 0x82, 0x6b, 0x57, 0x58, 0x9f, 0x86, 0x74,
-    0x74, 0x58, 0x46, 0x3a, 0x3a, 0x54, 0x4a, 0x36, 0x3e, 0x47, 0x4c, 0x69,
-    0x5e, 0x6f, 0x86, 0xa0, 0x75, 0x85, 0x77, 0x47, 0x44, 0x50, 0x58, 0x85,
-    0xb1, 0xae, 0xa2, 0x8c, 0x86, 0x64, 0x48, 0x3e, 0x27, 0x27, 0x27, 0x2e,
-    0x2e, 0x56, 0x60, 0x51, 0x4b, 0x6b, 0x58, 0x57, 0x68, 0x7f, 0x82, 0x94,
-    0x93, 0xaa, 0xa2, 0x77, 0x6c, 0x75, 0x77, 0x6c, 0x7a, 0x8c, 0x9a, 0x9f,
-    0xa0, 0x34, 0x10, 0x10, 0x1b, 0x1b, 0x1d, 0x1d, 0x27, 0x28, 0x28, 0x2a,
-    0x0a, 0x03, 0x05, 0x05, 0x07, 0x0a, 0x13, 0x1c, 0x20, 0x34, 0x49, 0x56,
-    0x67, 0x49, 0x20, 0x13, 0x0a, 0x0a, 0x0d, 0x12, 0x14, 0x1a, 0x1d, 0x1a,
-    0x1a, 0x1d, 0x1d, 0x30, 0x51, 0x51, 0x51, 0x6c, 0x2e, 0x3e, 0x6a, 0xd3,
-    0xce, 0x96, 0x73, 0x58, 0x61, 0x61, 0x54, 0x6f, 0x9f, 0xa0, 0xa0, 0xa0,
-    0xd3, 0xe0, 0xd5, 0xb8, 0xbb, 0xce, 0xd5, 0xc6, 0xaf, 0x84, 0x84, 0xbb,
-    0xdd, 0xe1, 0xdc, 0xcc, 0xcc, 0xbe, 0xaa, 0xa2, 0xa3, 0x9f, 0xb4, 0xe3,
-    0xeb, 0xea, 0xe6, 0xd8, 0xc8, 0xb5, 0xa5, 0xc6, 0xed, 0xf7, 0xed, 0xd9,
-    0xc8, 0xd5, 0xeb, 0xfa, 0xfc, 0xfc, 0xf3, 0xee, 0xf0, 0xf3, 0xf3, 0xfa,
-    0xfe, 0xf9, 0xf7, 0xea, 0xea, 0xee, 0xfc, 0xfe, 0xf9, 0xed, 0xe1, 0xd2,
-    0xdf, 0xdf, 0xe0, 0xe0, 0xd1, 0xf3, 0xfc, 0xfa, 0xfa, 0xfe, 0xf9, 0xea,
-    0xd7, 0xb2, 0x9e, 0x59, 0x78, 0xa0, 0xb7, 0xce, 0xcf, 0xeb, 0xe1, 0xd5,
-    0xd5, 0xc9, 0xb6, 0x8a, 0x5b, 0x30, 0x1e, 0x2a, 0x3d, 0x5a, 0x60, 0xb4,
-    0xe4, 0xe9, 0xe7, 0xdf, 0xe0, 0xeb, 0xf7, 0xed, 0xed, 0xea, 0xe7, 0xe7,
-    0xe7, 0xcd, 0xc5, 0xad, 0x8e, 0x8e, 0x83, 0x83, 0x73, 0x6b, 0x6b, 0x83,
-    0x83, 0x7f, 0x83, 0x83, 0x66, 0x74, 0x91, 0xaa, 0x91, 0x74, 0x83, 0x73,
-    0x61, 0x4c, 0x40, 0x2f, 0x2b, 0x40, 0x2f, 0x2b, 0x2d, 0x3e, 0x47, 0x51,
-    0x50, 0x50, 0x58, 0x50, 0x3a, 0x14, 0x0a, 0x12, 0x21, 0x1e, 0x1f, 0x14,
-    0x0a, 0x1c, 0x28, 0x47, 0xa5, 0xa6, 0x8e, 0x8e, 0x73, 0x83, 0x6b, 0x4b,
-    0x4b, 0x57, 0x43, 0x51, 0xcf, 0xbb, 0xb8, 0xe1, 0xbe, 0xca, 0xd7, 0xea,
-    0xdc, 0xde, 0xb6, 0x94, 0x66, 0x58, 0x50, 0x50, 0x9f, 0xaa, 0xaa, 0xa3,
-    0x74, 0x50, 0x3a, 0x5a, 0x5e, 0x6c, 0x77, 0x6c, 0x50, 0x46, 0x46, 0x46,
-    0x46, 0x54, 0x55, 0x4c, 0x3d, 0x47, 0x4e, 0x48, 0x55, 0x6b, 0x85, 0x77,
-    0x61, 0x47, 0x2d, 0x47, 0x37, 0x43, 0x57, 0x71, 0x97, 0xa2, 0xa2, 0xa2,
-    0x8c, 0x78, 0x53, 0x47, 0x28, 0x28, 0x2f, 0x1f, 0x47, 0x6f, 0x6f, 0x51,
-    0x5a, 0x75, 0x75, 0x58, 0x68, 0x5b, 0x71, 0x7f, 0x82, 0x93, 0x8c, 0x7a,
-    0x7a, 0x6c, 0x75, 0x6c, 0x72, 0x7a, 0x7a, 0x8c, 0x9a, 0x6e, 0x1c, 0x0a,
-    0x10, 0x14, 0x1b, 0x1a, 0x1a, 0x28, 0x28, 0x33, 0x13, 0x05, 0x05, 0x06,
-    0x07, 0x0a, 0x10, 0x10, 0x1e, 0x2a, 0x49, 0x67, 0x6e, 0x67, 0x4f, 0x1c,
-    0x0b, 0x08, 0x0a, 0x0c, 0x10, 0x1b, 0x1f, 0x14, 0x10, 0x1b, 0x14, 0x1d,
-    0x37, 0x44, 0x44, 0x51, 0x2d, 0x52, 0x8f, 0xe4, 0xe0, 0xac, 0x8c, 0x91,
-    0x91, 0x7b, 0x61, 0xa3, 0xd1, 0xae, 0xa3, 0xae, 0xce, 0xd9, 0xca, 0xaf,
-    0xa6, 0xa6, 0xa6, 0xa6, 0x94, 0x71, 0x85, 0xbb, 0xd5, 0xd5, 0xca, 0xca,
-    0xbb, 0xb2, 0x9f, 0xb1, 0xae, 0xae, 0xb7, 0xd1, 0xdc, 0xd7, 0xc8, 0xc5,
-    0xa7, 0x9c, 0x9c, 0xb8, 0xea, 0xee, 0xe0, 0xde, 0xc8, 0xee, 0xfe, 0xfe,
-    0xfa, 0xf9, 0xee, 0xeb, 0xee, 0xf3, 0xf3, 0xf8, 0xf6, 0xf9, 0xf7, 0xe7,
-    0xdc, 0xfe, 0xfe, 0xfd, 0xf5, 0xef, 0xe0, 0xe1, 0xce, 0xce, 0xd4, 0xd4,
-    0xe4, 0xfa, 0xfa, 0xfa, 0xf9, 0xed, 0xe7, 0xdb, 0xc8, 0xb5, 0x9d, 0x81,
-    0x6c, 0x8c, 0xae, 0xbe, 0xc6, 0xd5, 0xd5, 0xc6, 0xb5, 0xa7, 0x8a, 0x76,
-    0x5b, 0x37, 0x2d, 0x3d, 0x56, 0x60, 0x78, 0xf0, 0xfa, 0xeb, 0xe6, 0xdc,
-    0xeb, 0xeb, 0xed, 0xea, 0xeb, 0xed, 0xdc, 0xc8, 0xc5, 0xc5, 0xad, 0x8e,
-    0x8e, 0x83, 0x73, 0x66, 0x66, 0x58, 0x58, 0x68, 0x73, 0x50, 0x6b, 0x63,
-    0x61, 0x74, 0x97, 0xac, 0x98, 0x63, 0x63, 0x4d, 0x46, 0x36, 0x4a, 0x4c,
-    0x4c, 0x5e, 0x36, 0x36, 0x40, 0x2e, 0x3a, 0x54, 0x50, 0x50, 0x50, 0x43,
-    0x27, 0x14, 0x1c, 0x1b, 0x1b, 0x1e, 0x1f, 0x1f, 0x1e, 0x1e, 0x28, 0x28,
-    0x5e, 0x97, 0x7f, 0x7f, 0x71, 0x73, 0x58, 0x4b, 0x6b, 0x68, 0x42, 0x51,
-    0xce, 0x9c, 0xbb, 0xe1, 0xc8, 0xa6, 0xc9, 0xd7, 0xd7, 0xc8, 0x8e, 0x8e,
-    0x66, 0x58, 0x43, 0x6c, 0x8c, 0xaa, 0xaa, 0x8c, 0x63, 0x50, 0x37, 0x77,
-    0x87, 0x77, 0x64, 0x5e, 0x36, 0x3a, 0x51, 0x54, 0x4d, 0x58, 0x5e, 0x47,
-    0x28, 0x36, 0x36, 0x47, 0x46, 0x54, 0x55, 0x56, 0x3d, 0x2a, 0x1e, 0x1d,
-    0x2e, 0x32, 0x50, 0x68, 0x7f, 0x97, 0x8c, 0x9f, 0x8c, 0x85, 0x60, 0x5e,
-    0x47, 0x44, 0x60, 0x45, 0x85, 0xa2, 0x9f, 0x77, 0x6c, 0x75, 0x7a, 0x6b,
-    0x58, 0x6b, 0x72, 0x93, 0x7f, 0x93, 0x8c, 0x8c, 0x86, 0x7a, 0x77, 0x77,
-    0x77, 0x87, 0x9a, 0x9a, 0xa0, 0x6e, 0x1c, 0x0d, 0x0d, 0x14, 0x1b, 0x1a,
-    0x1d, 0x27, 0x2e, 0x34, 0x0a, 0x05, 0x06, 0x08, 0x07, 0x0a, 0x10, 0x14,
-    0x1a, 0x2d, 0x45, 0x67, 0x80, 0x67, 0x67, 0x34, 0x22, 0x0a, 0x0a, 0x0c,
-    0x0d, 0x0d, 0x12, 0x08, 0x07, 0x0a, 0x10, 0x1b, 0x27, 0x47, 0x47, 0x37,
-    0x4c, 0xa1, 0xd4, 0xee, 0xdf, 0xb7, 0xd1, 0xbc, 0x96, 0x83, 0x77, 0x9f,
-    0xbc, 0xa3, 0x91, 0xa3, 0xaf, 0xb6, 0xb6, 0xa6, 0x83, 0x84, 0x71, 0x7f,
-    0x84, 0x8c, 0x8c, 0xa3, 0xbc, 0xaf, 0xa6, 0xa6, 0xa2, 0xb2, 0xd3, 0xe1,
-    0xdd, 0xce, 0xbe, 0xbe, 0xc6, 0xb6, 0xa6, 0x8e, 0x8a, 0x8a, 0x7c, 0x8c,
-    0xe0, 0xe3, 0xe2, 0xc8, 0xce, 0xfe, 0xfe, 0xf9, 0xfa, 0xee, 0xee, 0xe0,
-    0xe0, 0xe3, 0xf3, 0xfa, 0xf6, 0xed, 0xe7, 0xe7, 0xfe, 0xfe, 0xf9, 0xf6,
-    0xef, 0xe7, 0xd9, 0xd9, 0xd9, 0xd1, 0xb9, 0x8f, 0xee, 0xee, 0xfa, 0xf8,
-    0xea, 0xe7, 0xde, 0xc8, 0xc1, 0xa6, 0xaa, 0x8c, 0x58, 0x72, 0x97, 0xa5,
-    0xbb, 0xce, 0xc6, 0xbb, 0xaf, 0x8e, 0x76, 0x76, 0x5b, 0x42, 0x37, 0x45,
-    0x53, 0x60, 0xb2, 0xf0, 0xeb, 0xdc, 0xca, 0xdd, 0xfa, 0xeb, 0xed, 0xe6,
-    0xd9, 0xdf, 0xe0, 0xca, 0xb6, 0xad, 0x8e, 0x94, 0x73, 0x73, 0x74, 0x66,
-    0x58, 0x63, 0x58, 0x50, 0x61, 0x6f, 0x6f, 0x75, 0x9f, 0x75, 0x84, 0x97,
-    0x83, 0x63, 0x5e, 0x36, 0x2f, 0x2b, 0x36, 0x4a, 0x69, 0x9f, 0x7e, 0x7b,
-    0x55, 0x2e, 0x2e, 0x37, 0x43, 0x43, 0x43, 0x3a, 0x1f, 0x10, 0x1e, 0x2a,
-    0x1e, 0x1e, 0x28, 0x2e, 0x2e, 0x1d, 0x1d, 0x28, 0x6f, 0x5a, 0x72, 0x82,
-    0x71, 0x68, 0x57, 0x57, 0x58, 0x42, 0x37, 0x75, 0x86, 0xaa, 0xe3, 0xdc,
-    0xb6, 0xc6, 0xcc, 0xbb, 0xb5, 0x9c, 0x7f, 0x71, 0x66, 0x4b, 0x43, 0x6b,
-    0x7a, 0xa2, 0xaa, 0xa2, 0x84, 0x50, 0x43, 0x77, 0x86, 0x86, 0x6f, 0x55,
-    0x47, 0x3e, 0x47, 0x54, 0x54, 0x51, 0x55, 0x3e, 0x2d, 0x3e, 0x48, 0x47,
-    0x48, 0x4e, 0x20, 0x13, 0x13, 0x1c, 0x1b, 0x1f, 0x27, 0x2c, 0x43, 0x58,
-    0x74, 0x85, 0x91, 0x91, 0x86, 0x85, 0x86, 0x60, 0x51, 0x6b, 0x72, 0x93,
-    0xa5, 0xc6, 0xce, 0xb1, 0xa2, 0x84, 0x68, 0x6c, 0x72, 0x72, 0x93, 0x82,
-    0x70, 0x7c, 0x8c, 0xa2, 0x7a, 0x7a, 0x87, 0x87, 0x87, 0xa0, 0xa0, 0x87,
-    0x87, 0x34, 0x1c, 0x10, 0x10, 0x14, 0x1a, 0x1d, 0x28, 0x2d, 0x2f, 0x1c,
-    0x07, 0x08, 0x07, 0x07, 0x07, 0x0a, 0x10, 0x14, 0x1d, 0x30, 0x45, 0x64,
-    0x7d, 0x67, 0x67, 0x49, 0x2a, 0x0a, 0x0a, 0x0c, 0x0c, 0x0a, 0x0c, 0x03,
-    0x02, 0x05, 0x1c, 0x21, 0x1b, 0x28, 0x2e, 0x23, 0x75, 0x77, 0xd1, 0xdf,
-    0xd0, 0xbc, 0xd1, 0xb0, 0x83, 0x73, 0x7b, 0x91, 0xa3, 0x84, 0x75, 0x7b,
-    0x91, 0x83, 0x83, 0x83, 0x73, 0x6b, 0x58, 0x84, 0xbc, 0xbb, 0xaa, 0x8c,
-    0x9f, 0x8c, 0x7f, 0x7f, 0x8c, 0xce, 0xe1, 0xee, 0xe9, 0xd7, 0xb8, 0x93,
-    0x94, 0x7f, 0x7f, 0x7f, 0x7c, 0x7f, 0x7f, 0x85, 0xbe, 0xe0, 0xd9, 0xb6,
-    0xd1, 0xfe, 0xfd, 0xf9, 0xf9, 0xed, 0xd9, 0xe0, 0xe3, 0xd3, 0xee, 0xf9,
-    0xed, 0xef, 0xde, 0xd9, 0xfa, 0xf9, 0xed, 0xed, 0xe7, 0xd5, 0xca, 0xce,
-    0xd9, 0xd1, 0xd4, 0xd3, 0xe1, 0xee, 0xee, 0xed, 0xe0, 0xd9, 0xc8, 0xb6,
-    0xa6, 0x97, 0x94, 0x7f, 0x5a, 0x75, 0x85, 0x7f, 0x97, 0x94, 0x94, 0xa2,
-    0x97, 0x8e, 0x71, 0x57, 0x4b, 0x32, 0x2c, 0x37, 0x30, 0x53, 0xe1, 0xf7,
-    0xeb, 0xea, 0xdc, 0xf7, 0xf7, 0xf7, 0xe9, 0xd7, 0xdc, 0xdc, 0xd0, 0xaf,
-    0x98, 0x97, 0x98, 0x83, 0x73, 0x63, 0x63, 0x4d, 0x63, 0x63, 0x58, 0x6b,
-    0x6b, 0x63, 0x7b, 0x91, 0x75, 0x6b, 0x74, 0x63, 0x6b, 0x75, 0x6d, 0x6d,
-    0x6a, 0x4c, 0x54, 0x69, 0x7e, 0x7b, 0x98, 0x84, 0x6b, 0x47, 0x3e, 0x3a,
-    0x3a, 0x3a, 0x2e, 0x27, 0x14, 0x10, 0x1b, 0x2a, 0x40, 0x40, 0x2e, 0x3e,
-    0x2e, 0x27, 0x1d, 0x28, 0x2e, 0x5a, 0x85, 0x8c, 0x84, 0x71, 0x68, 0x72,
-    0x5a, 0x43, 0x44, 0x77, 0xae, 0xf0, 0xe1, 0xdd, 0xe0, 0xe1, 0xbb, 0xa8,
-    0x71, 0x68, 0x68, 0x72, 0x72, 0x6b, 0x58, 0x58, 0x74, 0x84, 0x97, 0x97,
-    0x84, 0x50, 0x46, 0x54, 0x6c, 0x75, 0x75, 0x61, 0x47, 0x2e, 0x2e, 0x47,
-    0x4a, 0x55, 0x47, 0x3e, 0x4c, 0x56, 0x56, 0x48, 0x49, 0x34, 0x20, 0x13,
-    0x0a, 0x10, 0x14, 0x14, 0x27, 0x2e, 0x43, 0x58, 0x58, 0x85, 0x86, 0x85,
-    0x86, 0x85, 0x85, 0x6c, 0x58, 0x74, 0x7f, 0x94, 0xa6, 0xc6, 0xce, 0xd5,
-    0xbb, 0xae, 0x77, 0x75, 0x72, 0x68, 0x7f, 0x75, 0x72, 0x7f, 0x82, 0x86,
-    0x6c, 0x86, 0x9a, 0x9f, 0xb2, 0xb2, 0xa0, 0x9a, 0x7d, 0x34, 0x13, 0x0a,
-    0x10, 0x1b, 0x1b, 0x1e, 0x2a, 0x2a, 0x1c, 0x0a, 0x08, 0x08, 0x07, 0x0a,
-    0x0a, 0x0d, 0x10, 0x14, 0x1d, 0x30, 0x44, 0x53, 0x64, 0x60, 0x64, 0x56,
-    0x31, 0x10, 0x0a, 0x07, 0x08, 0x05, 0x05, 0x02, 0x02, 0x08, 0x21, 0x21,
-    0x1e, 0x1a, 0x27, 0x23, 0x97, 0x84, 0x77, 0xb4, 0xdc, 0xc8, 0xaf, 0xb0,
-    0xa3, 0xac, 0xac, 0xa3, 0x91, 0x7b, 0x69, 0x6d, 0x63, 0x63, 0x6b, 0x58,
-    0x6b, 0x6b, 0x63, 0x97, 0xaf, 0xaf, 0xaf, 0x8c, 0x9f, 0x77, 0x6b, 0x74,
-    0x91, 0xce, 0xd9, 0xd7, 0xde, 0xc8, 0xab, 0x7c, 0x71, 0x73, 0x73, 0x71,
-    0x72, 0x82, 0x8c, 0x82, 0x8c, 0xbb, 0xc6, 0xca, 0xe0, 0xf9, 0xf6, 0xeb,
-    0xeb, 0xe7, 0xd9, 0xe4, 0xe4, 0xba, 0xf3, 0xf9, 0xed, 0xe3, 0xd4, 0xee,
-    0xf3, 0xf9, 0xee, 0xe7, 0xdc, 0xe3, 0xee, 0xfa, 0xf9, 0xee, 0xf0, 0xcc,
-    0xdc, 0xe3, 0xce, 0xe0, 0xd1, 0xce, 0xaf, 0x8e, 0x96, 0x96, 0x7f, 0x68,
-    0x77, 0x77, 0x75, 0x75, 0x85, 0x71, 0x7f, 0x84, 0x71, 0x66, 0x58, 0x58,
-    0x4b, 0x2c, 0x23, 0x2c, 0x30, 0x67, 0xe4, 0xeb, 0xe8, 0xda, 0xd7, 0xe1,
-    0xeb, 0xf9, 0xeb, 0xe1, 0xdd, 0xd7, 0xc6, 0xb0, 0x98, 0x96, 0x83, 0x98,
-    0x73, 0x63, 0x63, 0x4d, 0x4d, 0x50, 0x58, 0x6b, 0x73, 0x85, 0x7b, 0x91,
-    0x85, 0x63, 0x4d, 0x46, 0x43, 0x5e, 0x7e, 0x7e, 0x77, 0x77, 0x6f, 0x7b,
-    0x7b, 0x84, 0x97, 0xa3, 0x84, 0x50, 0x2e, 0x27, 0x2e, 0x2e, 0x1f, 0x14,
-    0x1c, 0x1c, 0x1e, 0x33, 0x4c, 0x3e, 0x27, 0x27, 0x2e, 0x1d, 0x14, 0x1b,
-    0x1a, 0x3e, 0x75, 0x91, 0x8c, 0x71, 0x4b, 0x58, 0x6c, 0x6c, 0x4b, 0x44,
-    0xcf, 0xf0, 0xeb, 0xdc, 0xd5, 0xd5, 0x94, 0x97, 0x58, 0x4b, 0x42, 0x58,
-    0x8c, 0x7a, 0x86, 0x74, 0x85, 0x74, 0x6c, 0x58, 0x43, 0x51, 0x44, 0x51,
-    0x55, 0x55, 0x54, 0x44, 0x47, 0x2e, 0x2e, 0x36, 0x40, 0x3e, 0x3e, 0x47,
-    0x56, 0x64, 0x67, 0x67, 0x6e, 0x4f, 0x20, 0x13, 0x0a, 0x1c, 0x19, 0x1a,
-    0x1d, 0x3a, 0x37, 0x43, 0x50, 0x58, 0x74, 0x74, 0x84, 0x82, 0x72, 0x50,
-    0x6b, 0x73, 0x7f, 0x8e, 0x8e, 0xa6, 0xb6, 0xb6, 0xc9, 0xbb, 0xb1, 0x77,
-    0x58, 0x4b, 0x7c, 0x7a, 0x8c, 0x82, 0x82, 0x86, 0xa2, 0xb1, 0xb1, 0xaa,
-    0xcc, 0xcf, 0xce, 0xcc, 0xcf, 0x8f, 0x26, 0x0a, 0x0a, 0x1c, 0x1e, 0x20,
-    0x2a, 0x20, 0x13, 0x07, 0x08, 0x08, 0x0a, 0x0a, 0x0d, 0x10, 0x14, 0x1a,
-    0x27, 0x27, 0x37, 0x44, 0x5a, 0x60, 0x60, 0x53, 0x33, 0x22, 0x0a, 0x08,
-    0x08, 0x08, 0x05, 0x03, 0x03, 0x05, 0x12, 0x1b, 0x14, 0x1a, 0x27, 0x27,
-    0xa6, 0x94, 0x6c, 0xd4, 0xeb, 0xbc, 0x91, 0xb7, 0xd1, 0xd0, 0xb6, 0xa3,
-    0xa1, 0x7b, 0x55, 0x61, 0x51, 0x46, 0x43, 0x63, 0x98, 0x84, 0x74, 0x84,
-    0x96, 0x96, 0x96, 0x8c, 0xa3, 0x91, 0x7b, 0x6c, 0x91, 0xac, 0xc6, 0xc8,
-    0xb6, 0xa7, 0xa7, 0x70, 0x58, 0x6f, 0x75, 0x6c, 0x9f, 0xbe, 0xcc, 0xa8,
-    0xa2, 0x9a, 0xcc, 0xce, 0xe3, 0xfa, 0xfa, 0xfe, 0xfa, 0xf0, 0xee, 0xf3,
-    0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xe4, 0xd4, 0xf3, 0xee, 0xe4, 0xd1, 0xd5,
-    0xe3, 0xfc, 0xfe, 0xfd, 0xf9, 0xf6, 0xef, 0xdc, 0xce, 0xbc, 0xb6, 0xbc,
-    0xaf, 0x94, 0xa6, 0x8e, 0x8e, 0x7f, 0x7f, 0x71, 0x75, 0x58, 0x58, 0x72,
-    0x74, 0x66, 0x57, 0x58, 0x4b, 0x4b, 0x4b, 0x42, 0x32, 0x2c, 0x23, 0x1d,
-    0x2d, 0x9d, 0xe1, 0xe6, 0xde, 0xc6, 0xce, 0xed, 0xe6, 0xe8, 0xea, 0xeb,
-    0xeb, 0xdd, 0xce, 0xbc, 0x96, 0x96, 0x71, 0x84, 0x74, 0x6b, 0x63, 0x4d,
-    0x61, 0x54, 0x58, 0x50, 0x58, 0x77, 0x75, 0x83, 0x6b, 0x61, 0x46, 0x55,
-    0x69, 0x5e, 0x73, 0x83, 0x97, 0x84, 0x61, 0x4d, 0x63, 0x83, 0x96, 0x97,
-    0x84, 0x58, 0x27, 0x1d, 0x1f, 0x1f, 0x19, 0x10, 0x2a, 0x33, 0x49, 0x48,
-    0x3e, 0x3e, 0x27, 0x1d, 0x27, 0x28, 0x1d, 0x1b, 0x14, 0x1d, 0x6c, 0x85,
-    0xa2, 0x7f, 0x68, 0x58, 0x5a, 0x58, 0x58, 0x37, 0x86, 0xdd, 0xdc, 0xd9,
-    0xdc, 0xd5, 0x88, 0x71, 0x74, 0x58, 0x43, 0x43, 0x85, 0xa2, 0xb1, 0x85,
-    0x86, 0x6f, 0x60, 0x37, 0x2c, 0x44, 0x51, 0x6c, 0x5e, 0x55, 0x54, 0x51,
-    0x53, 0x47, 0x3e, 0x30, 0x2e, 0x3e, 0x46, 0x51, 0x60, 0x60, 0x56, 0x67,
-    0x8f, 0x6e, 0x20, 0x08, 0x05, 0x12, 0x1b, 0x1a, 0x1a, 0x27, 0x27, 0x2e,
-    0x43, 0x43, 0x50, 0x58, 0x57, 0x68, 0x4b, 0x50, 0x57, 0x71, 0x73, 0x8e,
-    0x8e, 0x94, 0xa6, 0xa6, 0xa5, 0xbb, 0xaa, 0x8c, 0x42, 0x68, 0x9c, 0x93,
-    0x93, 0xa5, 0x8c, 0x8c, 0xb1, 0xaa, 0xa8, 0x9c, 0xab, 0xce, 0xcf, 0xce,
-    0xcc, 0xd3, 0x34, 0x13, 0x0d, 0x1b, 0x1e, 0x2a, 0x2a, 0x1c, 0x0a, 0x08,
-    0x07, 0x07, 0x0a, 0x0a, 0x0d, 0x10, 0x14, 0x1a, 0x27, 0x27, 0x2c, 0x44,
-    0x51, 0x5a, 0x60, 0x56, 0x33, 0x2a, 0x22, 0x1c, 0x1c, 0x22, 0x15, 0x0b,
-    0x0b, 0x06, 0x08, 0x0d, 0x14, 0x1a, 0x1f, 0x1f, 0xa6, 0x94, 0x75, 0xd3,
-    0xed, 0xd9, 0xbe, 0xd3, 0xe0, 0xdb, 0xad, 0x96, 0x7b, 0x6b, 0x61, 0x86,
-    0x75, 0x55, 0x46, 0x75, 0x98, 0x96, 0x74, 0x6b, 0x74, 0x74, 0x86, 0xae,
-    0xd1, 0xce, 0xbb, 0x85, 0x87, 0x9f, 0x8c, 0x94, 0x8a, 0x8a, 0x76, 0x71,
-    0x74, 0x64, 0x6f, 0x9a, 0xd2, 0xe1, 0xe1, 0xdc, 0xc6, 0xb1, 0xcc, 0xce,
-    0xf3, 0xfc, 0xfe, 0xfd, 0xf9, 0xfa, 0xee, 0xfc, 0xfc, 0xfd, 0xfd, 0xfa,
-    0xfc, 0xfe, 0xfa, 0xfa, 0xf0, 0xe5, 0xd3, 0xe3, 0xfc, 0xfc, 0xfa, 0xf6,
-    0xef, 0xe6, 0xdb, 0xd5, 0xd5, 0x94, 0x83, 0x97, 0x94, 0x8e, 0x94, 0x98,
-    0x97, 0x71, 0x73, 0x73, 0x58, 0x37, 0x32, 0x42, 0x4b, 0x43, 0x43, 0x50,
-    0x58, 0x50, 0x32, 0x32, 0x2c, 0x23, 0x1a, 0x1b, 0x31, 0xd4, 0xcf, 0xc9,
-    0xca, 0xb5, 0xa6, 0xd7, 0xda, 0xd7, 0xda, 0xe8, 0xe9, 0xe6, 0xb6, 0x94,
-    0xaa, 0xa6, 0x7f, 0x7f, 0x83, 0x58, 0x50, 0x50, 0x63, 0x54, 0x54, 0x3a,
-    0x2e, 0x54, 0x63, 0x50, 0x6b, 0x6f, 0x6f, 0x64, 0x6f, 0x63, 0x84, 0x97,
-    0xa3, 0x91, 0x63, 0x63, 0x7b, 0x83, 0x83, 0x96, 0x83, 0x4d, 0x1d, 0x1f,
-    0x12, 0x12, 0x1c, 0x1e, 0x4e, 0x56, 0x48, 0x47, 0x47, 0x3e, 0x47, 0x55,
-    0x3e, 0x3e, 0x2e, 0x1d, 0x1e, 0x49, 0x78, 0x91, 0x97, 0x7f, 0x97, 0x85,
-    0x51, 0x77, 0x77, 0x75, 0x72, 0xb8, 0xd7, 0xdc, 0xd5, 0xaf, 0x94, 0x83,
-    0x84, 0x50, 0x37, 0x43, 0x86, 0xb1, 0xbe, 0xaa, 0xaa, 0x77, 0x77, 0x46,
-    0x2e, 0x30, 0x60, 0x5a, 0x77, 0x61, 0x61, 0x6c, 0x60, 0x47, 0x2e, 0x30,
-    0x37, 0x44, 0x50, 0x5a, 0x77, 0x64, 0x64, 0x7d, 0x7d, 0x6e, 0x34, 0x13,
-    0x05, 0x08, 0x0d, 0x14, 0x14, 0x1d, 0x3e, 0x3a, 0x3a, 0x32, 0x50, 0x51,
-    0x50, 0x4d, 0x43, 0x50, 0x4b, 0x68, 0x66, 0x71, 0x76, 0x94, 0x94, 0xa6,
-    0x94, 0x97, 0xa5, 0x8c, 0x58, 0x88, 0xa5, 0xa5, 0xb5, 0xc9, 0xdc, 0xcc,
-    0xaa, 0x94, 0xab, 0x88, 0xa8, 0xbe, 0xbb, 0xaa, 0xbb, 0xc6, 0x4e, 0x1c,
-    0x1c, 0x1e, 0x2a, 0x2a, 0x1e, 0x12, 0x07, 0x08, 0x07, 0x07, 0x0a, 0x0d,
-    0x10, 0x14, 0x14, 0x1a, 0x27, 0x27, 0x2e, 0x37, 0x45, 0x51, 0x60, 0x56,
-    0x3d, 0x2a, 0x1e, 0x1e, 0x1f, 0x2f, 0x40, 0x21, 0x1c, 0x0c, 0x08, 0x0a,
-    0x19, 0x19, 0x14, 0x19, 0x7f, 0x71, 0x58, 0xba, 0xe3, 0xe1, 0xe3, 0xd2,
-    0xd0, 0xb3, 0x8e, 0x83, 0x73, 0x58, 0x75, 0x98, 0x7b, 0x5e, 0x54, 0x63,
-    0x83, 0x83, 0x84, 0x6c, 0x61, 0x54, 0x91, 0xce, 0xe0, 0xd7, 0xca, 0xa2,
-    0x81, 0x81, 0x75, 0x7f, 0x7f, 0x71, 0x66, 0x57, 0x58, 0x6f, 0x91, 0xcf,
-    0xdd, 0xeb, 0xe9, 0xe6, 0xda, 0xb8, 0xbb, 0xd2, 0xfc, 0xfe, 0xfd, 0xf9,
-    0xf7, 0xee, 0xf3, 0xfe, 0xfd, 0xfd, 0xfa, 0xf3, 0xfe, 0xfe, 0xf9, 0xfa,
-    0xf0, 0xfc, 0xf3, 0xe4, 0xf3, 0xf3, 0xf9, 0xe7, 0xdb, 0xd8, 0xc8, 0xc8,
-    0xbb, 0x7d, 0x8f, 0xa1, 0x9f, 0xae, 0xb2, 0xba, 0xb7, 0x8c, 0x84, 0x6b,
-    0x51, 0x2e, 0x47, 0x3a, 0x3a, 0x47, 0x54, 0x44, 0x43, 0x37, 0x44, 0x43,
-    0x2e, 0x1a, 0x10, 0x14, 0x67, 0xd2, 0xcf, 0xcc, 0xa8, 0x9c, 0x93, 0xcc,
-    0xd7, 0xc6, 0xdd, 0xf0, 0xf7, 0xd7, 0xb5, 0xbb, 0xbb, 0xca, 0xb6, 0x8e,
-    0x71, 0x4b, 0x50, 0x50, 0x43, 0x39, 0x46, 0x2e, 0x3e, 0x46, 0x39, 0x50,
-    0x54, 0x63, 0x75, 0x75, 0x75, 0x58, 0x83, 0x97, 0xaf, 0x96, 0x4d, 0x4d,
-    0x63, 0x74, 0x66, 0x6b, 0x58, 0x3a, 0x1f, 0x12, 0x08, 0x08, 0x1e, 0x40,
-    0x4c, 0x55, 0x5e, 0x6f, 0x54, 0x46, 0x55, 0x54, 0x37, 0x30, 0x27, 0x1a,
-    0x3d, 0xa0, 0xa0, 0x9f, 0x97, 0x94, 0xac, 0x96, 0x66, 0x85, 0x8c, 0x85,
-    0x6b, 0x82, 0xc6, 0xdc, 0xd5, 0xa6, 0x7f, 0x71, 0x58, 0x50, 0x43, 0x43,
-    0xa2, 0xb2, 0xcf, 0xbb, 0x8c, 0x84, 0x74, 0x39, 0x2e, 0x2e, 0x53, 0x54,
-    0x77, 0x61, 0x75, 0x75, 0x55, 0x2e, 0x2d, 0x27, 0x3a, 0x37, 0x43, 0x58,
-    0x51, 0x51, 0x6c, 0x78, 0x7d, 0x67, 0x49, 0x20, 0x07, 0x07, 0x0a, 0x14,
-    0x1a, 0x27, 0x3a, 0x3a, 0x3a, 0x50, 0x63, 0x5a, 0x61, 0x54, 0x54, 0x6c,
-    0x58, 0x4b, 0x66, 0x71, 0x66, 0x7f, 0x94, 0x97, 0x94, 0x94, 0x93, 0x93,
-    0x82, 0x94, 0xb5, 0xb5, 0xc8, 0xd5, 0xdd, 0xdc, 0xc9, 0x9c, 0x8a, 0x9c,
-    0xbb, 0xb2, 0xae, 0xa3, 0xbb, 0xcc, 0x80, 0x20, 0x20, 0x2a, 0x34, 0x20,
-    0x1c, 0x13, 0x07, 0x08, 0x07, 0x0a, 0x0a, 0x10, 0x14, 0x1b, 0x14, 0x1a,
-    0x28, 0x27, 0x2e, 0x3e, 0x45, 0x47, 0x55, 0x48, 0x2d, 0x28, 0x2b, 0x2f,
-    0x3d, 0x47, 0x4a, 0x40, 0x21, 0x19, 0x0d, 0x0d, 0x12, 0x0d, 0x10, 0x1b,
-    0x66, 0x57, 0x43, 0x64, 0xd3, 0xe3, 0xe0, 0xce, 0xd0, 0x96, 0x83, 0x73,
-    0x63, 0x4d, 0x61, 0x74, 0x7b, 0x6f, 0x46, 0x46, 0x75, 0x85, 0xa2, 0x8c,
-    0x85, 0x6f, 0x91, 0xbb, 0xc6, 0xc8, 0xb6, 0x94, 0x86, 0x77, 0x6c, 0x85,
-    0x82, 0x72, 0x6b, 0x4b, 0x44, 0x61, 0xa3, 0xbc, 0xd7, 0xd9, 0xe6, 0xda,
-    0xc1, 0xab, 0xa5, 0xe1, 0xfe, 0xfd, 0xf9, 0xf9, 0xf7, 0xea, 0xd4, 0xf8,
-    0xfd, 0xf7, 0xf3, 0xd4, 0xfe, 0xf9, 0xfa, 0xfe, 0xfa, 0xf9, 0xf9, 0xf0,
-    0xeb, 0xe3, 0xee, 0xde, 0xc8, 0xca, 0xb6, 0xa6, 0xa3, 0x8f, 0x92, 0x8f,
-    0x9d, 0xe5, 0xe4, 0xf3, 0xf0, 0xe4, 0xd1, 0x77, 0x6c, 0x54, 0x55, 0x4a,
-    0x2e, 0x47, 0x55, 0x37, 0x2e, 0x2e, 0x2c, 0x37, 0x27, 0x14, 0x10, 0x0a,
-    0x7d, 0xcc, 0xc6, 0xa5, 0xa8, 0x88, 0x93, 0xe1, 0xe1, 0xe1, 0xe3, 0xeb,
-    0xe6, 0xc8, 0xad, 0xa5, 0xbb, 0xbb, 0xca, 0x8e, 0x66, 0x50, 0x4d, 0x4d,
-    0x39, 0x50, 0x5a, 0x51, 0x54, 0x5e, 0x6f, 0x78, 0x69, 0x6b, 0x85, 0x8c,
-    0x6b, 0x50, 0x73, 0x83, 0x96, 0x73, 0x4d, 0x46, 0x4d, 0x50, 0x50, 0x50,
-    0x3a, 0x1f, 0x19, 0x0a, 0x08, 0x0a, 0x1e, 0x2d, 0x5e, 0x54, 0x54, 0x50,
-    0x50, 0x54, 0x46, 0x46, 0x23, 0x23, 0x27, 0x1d, 0x78, 0x8c, 0xaa, 0xb1,
-    0xaa, 0x97, 0xa3, 0x7f, 0x66, 0x6b, 0x72, 0x72, 0x58, 0x37, 0x93, 0xb5,
-    0xb6, 0x8e, 0x71, 0x68, 0x43, 0x50, 0x50, 0x43, 0x6c, 0xaa, 0xbe, 0xbb,
-    0xa2, 0x84, 0x58, 0x50, 0x47, 0x3e, 0x2e, 0x3a, 0x51, 0x44, 0x54, 0x44,
-    0x3e, 0x3d, 0x2d, 0x28, 0x27, 0x27, 0x37, 0x51, 0x53, 0x51, 0x77, 0x77,
-    0x78, 0x56, 0x48, 0x2a, 0x12, 0x0a, 0x0d, 0x1e, 0x2b, 0x27, 0x27, 0x1d,
-    0x37, 0x50, 0x63, 0x58, 0x61, 0x54, 0x50, 0x50, 0x58, 0x43, 0x50, 0x57,
-    0x57, 0x7f, 0x7f, 0x97, 0x97, 0x7f, 0x97, 0x7f, 0x68, 0x93, 0xa5, 0xab,
-    0xab, 0xc8, 0xca, 0xca, 0xc9, 0xa8, 0xa2, 0xb1, 0xbb, 0xcc, 0xcc, 0xce,
-    0xcf, 0xcf, 0xb4, 0x6e, 0x4f, 0x49, 0x49, 0x34, 0x1c, 0x0a, 0x07, 0x08,
-    0x07, 0x0a, 0x10, 0x10, 0x14, 0x14, 0x1a, 0x1a, 0x28, 0x27, 0x28, 0x2d,
-    0x30, 0x47, 0x47, 0x28, 0x2a, 0x28, 0x3e, 0x47, 0x45, 0x51, 0x5e, 0x4c,
-    0x33, 0x35, 0x21, 0x12, 0x08, 0x07, 0x0a, 0x10, 0x43, 0x43, 0x2c, 0x2d,
-    0x8f, 0xee, 0xd9, 0xaf, 0x96, 0x83, 0x73, 0x74, 0x61, 0x46, 0x4a, 0x61,
-    0x69, 0x6f, 0x4a, 0x4a, 0x9f, 0xce, 0xd5, 0xbb, 0xaa, 0x85, 0x84, 0x96,
-    0x94, 0x8e, 0x8e, 0x7f, 0x74, 0x75, 0x86, 0xae, 0xbb, 0xa2, 0x8c, 0x6c,
-    0x44, 0x61, 0x8c, 0xaf, 0xc6, 0xca, 0xc1, 0xa7, 0xa7, 0x9c, 0x94, 0xe1,
-    0xfe, 0xf9, 0xf9, 0xea, 0xe3, 0xee, 0xf2, 0xf3, 0xf9, 0xed, 0xf3, 0xec,
-    0xf9, 0xf9, 0xfe, 0xfe, 0xfd, 0xf5, 0xf7, 0xeb, 0xe1, 0xbc, 0xce, 0xd4,
-    0xb0, 0xb6, 0x96, 0x84, 0x7b, 0x8f, 0x8f, 0xba, 0xb4, 0xf2, 0xe3, 0xf7,
-    0xeb, 0xf0, 0xe1, 0xce, 0x7f, 0x6b, 0x54, 0x4a, 0x2e, 0x48, 0x78, 0x45,
-    0x3e, 0x2e, 0x23, 0x27, 0x1d, 0x1b, 0x0a, 0x05, 0x56, 0xaa, 0xa8, 0x93,
-    0x93, 0x68, 0x9a, 0xf0, 0xf0, 0xe1, 0xe3, 0xdd, 0xc9, 0xab, 0x8a, 0xa2,
-    0xbc, 0xce, 0xbc, 0x83, 0x73, 0x50, 0x54, 0x54, 0x4d, 0x6b, 0x58, 0x50,
-    0x6c, 0x75, 0x74, 0x6b, 0x54, 0x58, 0x84, 0x84, 0x50, 0x43, 0x58, 0x6b,
-    0x6b, 0x43, 0x2e, 0x46, 0x46, 0x54, 0x4d, 0x46, 0x2b, 0x16, 0x0c, 0x0c,
-    0x08, 0x12, 0x2a, 0x48, 0x64, 0x55, 0x5a, 0x50, 0x6c, 0x5e, 0x44, 0x2c,
-    0x27, 0x23, 0x1d, 0x28, 0x45, 0x5a, 0x93, 0xcf, 0xaa, 0x93, 0x96, 0x8e,
-    0x73, 0x4b, 0x57, 0x58, 0x6c, 0x2c, 0x50, 0x58, 0x4b, 0x68, 0x57, 0x37,
-    0x45, 0x77, 0x6c, 0x58, 0x58, 0x85, 0xa2, 0xbb, 0xa2, 0x83, 0x58, 0x44,
-    0x2e, 0x3e, 0x47, 0x30, 0x55, 0x51, 0x51, 0x46, 0x46, 0x47, 0x2d, 0x27,
-    0x23, 0x27, 0x2c, 0x51, 0x51, 0x50, 0x75, 0x86, 0x64, 0x64, 0x56, 0x20,
-    0x0d, 0x0d, 0x0d, 0x1f, 0x29, 0x1f, 0x1a, 0x2b, 0x3a, 0x3a, 0x46, 0x2e,
-    0x3a, 0x46, 0x27, 0x3a, 0x54, 0x51, 0x6b, 0x6b, 0x58, 0x6b, 0x6b, 0x7f,
-    0x82, 0x7f, 0x93, 0x68, 0x71, 0x8c, 0xa6, 0xa6, 0xb6, 0xb6, 0xb6, 0xca,
-    0xc6, 0xb5, 0xbb, 0xbb, 0xbb, 0xc6, 0xc9, 0xd5, 0xdc, 0xe1, 0xb4, 0xb4,
-    0xb4, 0x9d, 0x80, 0x67, 0x34, 0x13, 0x0a, 0x0b, 0x07, 0x0a, 0x0d, 0x10,
-    0x14, 0x14, 0x1a, 0x1f, 0x2b, 0x2d, 0x2d, 0x28, 0x30, 0x3e, 0x3d, 0x2d,
-    0x2b, 0x1d, 0x2e, 0x3e, 0x44, 0x51, 0x6f, 0x7e, 0x69, 0x69, 0x40, 0x1c,
-    0x07, 0x05, 0x07, 0x0a, 0x2e, 0x27, 0x27, 0x2a, 0x8f, 0xee, 0xd9, 0xb6,
-    0x96, 0x73, 0x84, 0x85, 0x7b, 0x5e, 0x55, 0x7b, 0x7b, 0x75, 0x69, 0x78,
-    0xae, 0xdf, 0xd5, 0xca, 0xaf, 0x84, 0x6b, 0x6b, 0x73, 0x71, 0x66, 0x6b,
-    0x61, 0x9f, 0xcf, 0xe1, 0xdd, 0xd5, 0xc9, 0x8c, 0x5a, 0x75, 0x8c, 0x93,
-    0xaf, 0xa6, 0xa7, 0x89, 0x8a, 0x7c, 0x7f, 0xe4, 0xfe, 0xf6, 0xea, 0xea,
-    0xee, 0xfa, 0xfe, 0xfa, 0xfa, 0xe4, 0xf3, 0xfa, 0xeb, 0xfa, 0xfe, 0xfd,
-    0xf6, 0xea, 0xea, 0xdc, 0xd3, 0xb4, 0xd4, 0x8f, 0xa1, 0xb2, 0xd1, 0xbe,
-    0x9f, 0xa0, 0xae, 0xae, 0xe4, 0xe3, 0xf0, 0xf9, 0xee, 0xfa, 0xe9, 0xd5,
-    0x7f, 0x58, 0x61, 0x69, 0x5e, 0xa0, 0x9f, 0x77, 0x53, 0x48, 0x3d, 0x28,
-    0x1a, 0x12, 0x03, 0x03, 0x2d, 0x82, 0x94, 0x8c, 0x71, 0x57, 0xb4, 0xeb,
-    0xeb, 0xdd, 0xeb, 0xe8, 0xc9, 0xb8, 0x94, 0x94, 0x83, 0x97, 0x85, 0x74,
-    0x63, 0x58, 0x50, 0x50, 0x50, 0x50, 0x43, 0x43, 0x58, 0x74, 0x84, 0x58,
-    0x58, 0x50, 0x6b, 0x58, 0x50, 0x50, 0x4d, 0x50, 0x43, 0x3e, 0x27, 0x2e,
-    0x36, 0x2e, 0x27, 0x1f, 0x19, 0x08, 0x08, 0x06, 0x0c, 0x1c, 0x33, 0x67,
-    0x78, 0x78, 0x75, 0x50, 0x58, 0x58, 0x51, 0x44, 0x2e, 0x30, 0x30, 0x27,
-    0x1d, 0x27, 0x77, 0xb7, 0xaf, 0xaa, 0x97, 0x7f, 0xa3, 0x74, 0x6b, 0x9f,
-    0x9f, 0x44, 0x51, 0x3a, 0x23, 0x23, 0x23, 0x23, 0x60, 0x87, 0x86, 0x6b,
-    0x72, 0x6c, 0x6b, 0x6b, 0x73, 0x58, 0x46, 0x1d, 0x27, 0x3e, 0x55, 0x53,
-    0x5e, 0x60, 0x5a, 0x61, 0x54, 0x47, 0x28, 0x23, 0x30, 0x37, 0x37, 0x44,
-    0x46, 0x58, 0x74, 0x77, 0x53, 0x60, 0x56, 0x1e, 0x0a, 0x12, 0x19, 0x19,
-    0x19, 0x0d, 0x19, 0x29, 0x36, 0x29, 0x14, 0x1a, 0x27, 0x1f, 0x1a, 0x47,
-    0x54, 0x43, 0x6b, 0x74, 0x58, 0x50, 0x63, 0x58, 0x68, 0x7f, 0x71, 0x6b,
-    0x93, 0xaa, 0x7f, 0x94, 0x9c, 0x8a, 0xa7, 0xb5, 0xb8, 0xa5, 0xa5, 0xbe,
-    0xc6, 0xc9, 0xd7, 0xdc, 0xdc, 0xdd, 0xcf, 0xaa, 0xb1, 0xb4, 0xb4, 0x9d,
-    0x80, 0x34, 0x13, 0x07, 0x0a, 0x0a, 0x10, 0x14, 0x14, 0x1a, 0x1d, 0x1f,
-    0x1f, 0x28, 0x2d, 0x2d, 0x30, 0x3e, 0x2d, 0x28, 0x2b, 0x1d, 0x2e, 0x3e,
-    0x44, 0x5a, 0x75, 0x77, 0x77, 0x77, 0x69, 0x35, 0x1c, 0x08, 0x07, 0x0d,
-    0x27, 0x27, 0x2e, 0x2d, 0x80, 0xe0, 0xdf, 0xc6, 0x94, 0x85, 0xae, 0xb0,
-    0x83, 0x63, 0x7b, 0xae, 0xac, 0x84, 0x75, 0x77, 0xac, 0xca, 0xb6, 0xa6,
-    0x96, 0x85, 0x5e, 0x54, 0x63, 0x50, 0x4d, 0x51, 0x7b, 0xb7, 0xe0, 0xeb,
-    0xdf, 0xd7, 0xca, 0xa5, 0x82, 0x84, 0x84, 0x7f, 0x94, 0x94, 0x7f, 0x76,
-    0x76, 0x71, 0x7a, 0xe4, 0xfe, 0xfe, 0xf9, 0xfa, 0xf8, 0xfe, 0xfd, 0xfa,
-    0xfc, 0xfc, 0xfc, 0xfe, 0xf3, 0xf2, 0xfa, 0xed, 0xed, 0xe4, 0xf0, 0xf2,
-    0xf3, 0xe4, 0xe5, 0xd4, 0xe4, 0xf3, 0xfa, 0xfa, 0xed, 0xaa, 0x85, 0x9f,
-    0xe3, 0xe3, 0xeb, 0xed, 0xed, 0xea, 0xd7, 0xc8, 0xa6, 0x50, 0x61, 0x75,
-    0x86, 0xb2, 0xb1, 0xb1, 0xd2, 0xb1, 0x87, 0x48, 0x1b, 0x08, 0x05, 0x0a,
-    0x1e, 0x51, 0x72, 0x74, 0x58, 0x4b, 0x9a, 0xeb, 0xe9, 0xdd, 0xdc, 0xd7,
-    0xca, 0xcf, 0xcf, 0xbb, 0x83, 0x83, 0x8c, 0x8c, 0x97, 0x84, 0x58, 0x50,
-    0x46, 0x61, 0x54, 0x50, 0x58, 0x6b, 0x6b, 0x50, 0x4d, 0x4d, 0x46, 0x3a,
-    0x55, 0x6d, 0x36, 0x2e, 0x3a, 0x36, 0x29, 0x27, 0x3e, 0x2e, 0x29, 0x1f,
-    0x19, 0x0c, 0x0c, 0x12, 0x0d, 0x12, 0x2f, 0x47, 0x54, 0x75, 0x75, 0x6c,
-    0x58, 0x6c, 0x5a, 0x51, 0x2c, 0x37, 0x45, 0x27, 0x28, 0x1d, 0x78, 0xae,
-    0xaf, 0xd1, 0xbc, 0xaf, 0xae, 0x91, 0x74, 0xae, 0x87, 0x43, 0x43, 0x51,
-    0x27, 0x27, 0x1d, 0x28, 0x78, 0x87, 0x9a, 0x8c, 0x82, 0x75, 0x58, 0x43,
-    0x46, 0x3e, 0x27, 0x28, 0x27, 0x1d, 0x2d, 0x60, 0x60, 0x6c, 0x6c, 0x6c,
-    0x6f, 0x2d, 0x1e, 0x2b, 0x23, 0x45, 0x45, 0x37, 0x46, 0x44, 0x50, 0x51,
-    0x51, 0x60, 0x56, 0x0a, 0x08, 0x0a, 0x19, 0x19, 0x12, 0x08, 0x0d, 0x2b,
-    0x2e, 0x1f, 0x1a, 0x27, 0x28, 0x1f, 0x1a, 0x4a, 0x54, 0x43, 0x58, 0x6b,
-    0x32, 0x50, 0x58, 0x43, 0x71, 0x94, 0x94, 0xb5, 0xca, 0xd5, 0xcc, 0xbb,
-    0x93, 0x76, 0x9c, 0x84, 0x97, 0xab, 0xb8, 0xbc, 0xa5, 0xb5, 0xc6, 0xc6,
-    0xd5, 0xd5, 0xd5, 0xbb, 0xb2, 0xcf, 0xcf, 0xcf, 0x9d, 0x4f, 0x13, 0x08,
-    0x07, 0x10, 0x14, 0x14, 0x14, 0x1a, 0x1a, 0x1f, 0x1f, 0x1d, 0x1d, 0x28,
-    0x3e, 0x2d, 0x2b, 0x1f, 0x1a, 0x28, 0x3e, 0x30, 0x44, 0x50, 0x58, 0x74,
-    0x85, 0x86, 0x77, 0x6a, 0x22, 0x07, 0x05, 0x10, 0x30, 0x3e, 0x36, 0x46,
-    0x47, 0x7d, 0xe3, 0xe0, 0xaf, 0x91, 0xac, 0xa6, 0x83, 0x73, 0x91, 0xce,
-    0xbc, 0x96, 0x75, 0x77, 0x97, 0x94, 0x94, 0x7f, 0x73, 0x77, 0x64, 0x6f,
-    0x60, 0x51, 0x46, 0x55, 0x9f, 0xbe, 0xdc, 0xea, 0xe7, 0xc8, 0xb6, 0x94,
-    0x84, 0x73, 0x68, 0x71, 0x71, 0x71, 0x71, 0x5b, 0x5b, 0x6c, 0xd4, 0xfc,
-    0xfe, 0xfc, 0xfe, 0xfe, 0xfd, 0xf6, 0xf5, 0xfa, 0xfc, 0xfc, 0xfe, 0xfd,
-    0xfa, 0xfc, 0xf3, 0xf3, 0xe4, 0xf2, 0xfc, 0xfc, 0xfe, 0xf7, 0xeb, 0xe4,
-    0xe1, 0xed, 0xeb, 0xf7, 0xea, 0xd5, 0x9f, 0xa1, 0xbe, 0xbc, 0xd9, 0xd9,
-    0xd9, 0xc8, 0xc5, 0xa7, 0x94, 0x50, 0x64, 0x7d, 0xa3, 0xbb, 0xb1, 0xcc,
-    0xd5, 0xc6, 0xbb, 0x7a, 0x3d, 0x22, 0x0a, 0x1b, 0x2d, 0x30, 0x51, 0x51,
-    0x37, 0x37, 0x78, 0xeb, 0xd7, 0xc6, 0xd2, 0xb8, 0xa8, 0xcc, 0xcf, 0xd5,
-    0xaf, 0x7f, 0x85, 0xa2, 0xaa, 0x97, 0x73, 0x63, 0x3a, 0x54, 0x46, 0x43,
-    0x43, 0x50, 0x58, 0x54, 0x46, 0x46, 0x3e, 0x1a, 0x2e, 0x4a, 0x2e, 0x27,
-    0x36, 0x1f, 0x1a, 0x27, 0x2e, 0x29, 0x36, 0x2f, 0x1b, 0x0a, 0x0d, 0x1e,
-    0x12, 0x12, 0x1f, 0x29, 0x54, 0x63, 0x6c, 0x74, 0x58, 0x5a, 0x43, 0x43,
-    0x2c, 0x30, 0x2e, 0x27, 0x28, 0x3d, 0xa0, 0xb4, 0xbe, 0xd1, 0xac, 0xac,
-    0xae, 0x91, 0x6b, 0x8c, 0x5a, 0x37, 0x51, 0x5a, 0x2e, 0x1d, 0x1a, 0x14,
-    0x48, 0x60, 0xa2, 0xa2, 0x8c, 0x85, 0x6b, 0x6b, 0x54, 0x47, 0x2e, 0x27,
-    0x27, 0x1d, 0x1d, 0x2e, 0x3e, 0x3e, 0x44, 0x51, 0x48, 0x34, 0x13, 0x12,
-    0x1f, 0x1f, 0x2b, 0x1f, 0x28, 0x2e, 0x30, 0x37, 0x44, 0x53, 0x20, 0x03,
-    0x02, 0x08, 0x1b, 0x4c, 0x33, 0x35, 0x35, 0x4c, 0x2b, 0x2b, 0x40, 0x2e,
-    0x28, 0x1f, 0x28, 0x55, 0x5a, 0x6c, 0x6c, 0x75, 0x51, 0x6f, 0x5e, 0x51,
-    0x88, 0xab, 0xab, 0xc8, 0xd7, 0xe1, 0xdd, 0xd5, 0xbb, 0x93, 0x9c, 0x94,
-    0xb6, 0xc9, 0xcc, 0xbb, 0xa5, 0xa6, 0xb5, 0xca, 0xca, 0xb8, 0xc9, 0xcf,
-    0xd2, 0xe1, 0xcf, 0xb1, 0xb2, 0x4f, 0x0b, 0x06, 0x07, 0x0d, 0x19, 0x14,
-    0x14, 0x14, 0x14, 0x1f, 0x1f, 0x1d, 0x1a, 0x1f, 0x1f, 0x1e, 0x10, 0x14,
-    0x1f, 0x1d, 0x2e, 0x30, 0x37, 0x43, 0x50, 0x73, 0x85, 0x91, 0x86, 0x69,
-    0x21, 0x0a, 0x08, 0x10, 0x4d, 0x54, 0x54, 0x54, 0x4d, 0x56, 0xd4, 0xeb,
-    0xca, 0x97, 0x91, 0x98, 0x83, 0x73, 0x7b, 0xa3, 0x98, 0x83, 0x81, 0x7e,
-    0x61, 0x58, 0x6b, 0x58, 0x50, 0x61, 0x86, 0x9f, 0x9f, 0x86, 0x6f, 0x5e,
-    0x91, 0xbb, 0xca, 0xca, 0xc8, 0xbf, 0xa7, 0x94, 0x6b, 0x68, 0x58, 0x75,
-    0x6b, 0x57, 0x57, 0x6c, 0xb4, 0xd4, 0xfc, 0xfe, 0xfe, 0xfa, 0xfa, 0xfe,
-    0xfd, 0xf7, 0xf9, 0xfe, 0xfc, 0xf3, 0xf3, 0xf9, 0xfa, 0xfc, 0xfe, 0xf9,
-    0xe4, 0xfc, 0xfa, 0xf9, 0xf5, 0xe7, 0xd7, 0xd2, 0xce, 0xd9, 0xe6, 0xda,
-    0xdb, 0xc8, 0xa3, 0x9f, 0x94, 0xbe, 0xbc, 0xad, 0xb6, 0xb6, 0xad, 0x8e,
-    0x7f, 0x75, 0x80, 0x59, 0x9f, 0xa5, 0xbe, 0xc6, 0xca, 0xdc, 0xc6, 0xab,
-    0x82, 0x3d, 0x1e, 0x31, 0x30, 0x30, 0x3d, 0x30, 0x30, 0x53, 0x9d, 0xcf,
-    0xc8, 0xa5, 0x97, 0x8c, 0xcf, 0xbb, 0xcc, 0xd5, 0xa6, 0x7f, 0x6b, 0x6b,
-    0x84, 0x71, 0x6b, 0x50, 0x43, 0x50, 0x4d, 0x43, 0x43, 0x44, 0x6f, 0x5e,
-    0x50, 0x39, 0x3a, 0x3a, 0x55, 0x47, 0x54, 0x56, 0x4c, 0x1f, 0x2b, 0x36,
-    0x2e, 0x36, 0x36, 0x29, 0x2b, 0x19, 0x12, 0x1b, 0x1c, 0x12, 0x1f, 0x29,
-    0x46, 0x63, 0x58, 0x58, 0x58, 0x50, 0x50, 0x51, 0x37, 0x27, 0x27, 0x28,
-    0x1d, 0x48, 0x9d, 0xd2, 0xd2, 0xbe, 0xaa, 0xbc, 0xac, 0x85, 0x50, 0x6b,
-    0x50, 0x2c, 0x51, 0x47, 0x2e, 0x2d, 0x19, 0x14, 0x1f, 0x3d, 0xb1, 0xb1,
-    0xa2, 0x82, 0x73, 0x6b, 0x58, 0x43, 0x3e, 0x2d, 0x28, 0x2e, 0x27, 0x27,
-    0x27, 0x2e, 0x2e, 0x2e, 0x3d, 0x34, 0x13, 0x0a, 0x0d, 0x0c, 0x0c, 0x16,
-    0x1e, 0x1f, 0x27, 0x27, 0x29, 0x1c, 0x05, 0x02, 0x02, 0x08, 0x1b, 0x47,
-    0x6c, 0x69, 0x69, 0x7e, 0x6d, 0x3a, 0x54, 0x5e, 0x36, 0x2f, 0x60, 0x84,
-    0x97, 0xaa, 0xa8, 0x91, 0x9f, 0x87, 0x64, 0x72, 0x88, 0x9c, 0xab, 0xc8,
-    0xd7, 0xdc, 0xd7, 0xb5, 0xb5, 0x94, 0x94, 0xa6, 0xc8, 0xd7, 0xeb, 0xcc,
-    0xa5, 0xa6, 0xca, 0xc9, 0xca, 0xc9, 0xcc, 0xc6, 0xdc, 0xd2, 0xbe, 0xbb,
-    0xa0, 0x3c, 0x06, 0x06, 0x05, 0x0a, 0x0d, 0x19, 0x19, 0x10, 0x14, 0x1e,
-    0x1f, 0x2b, 0x2b, 0x1e, 0x12, 0x0a, 0x0a, 0x12, 0x1f, 0x1d, 0x27, 0x27,
-    0x2e, 0x37, 0x43, 0x58, 0x74, 0x85, 0x77, 0x5e, 0x2f, 0x1b, 0x19, 0x14,
-    0x63, 0x63, 0x74, 0x74, 0x58, 0x64, 0xd1, 0xde, 0xb6, 0x98, 0x84, 0x84,
-    0x84, 0x74, 0x6c, 0x77, 0x91, 0x91, 0x87, 0x60, 0x46, 0x44, 0x43, 0x3a,
-    0x69, 0xa0, 0xd1, 0xbc, 0xbc, 0xb1, 0x86, 0x6c, 0x85, 0x97, 0xa6, 0xad,
-    0x89, 0x89, 0x8a, 0x7f, 0x73, 0x63, 0x5e, 0x6f, 0x4b, 0x42, 0x60, 0xe4,
-    0xfc, 0xfc, 0xfe, 0xfd, 0xfa, 0xf0, 0xf3, 0xfe, 0xfe, 0xf0, 0xf3, 0xf2,
-    0xfc, 0xf3, 0xec, 0xfc, 0xfc, 0xfd, 0xf9, 0xeb, 0xee, 0xe4, 0xea, 0xdc,
-    0xe6, 0xd9, 0xd5, 0xbc, 0x7b, 0xa1, 0xc6, 0xc8, 0xc5, 0xa6, 0x97, 0x84,
-    0x97, 0xae, 0xaa, 0xbb, 0xa6, 0x96, 0x96, 0x7f, 0x83, 0x74, 0x6f, 0x4a,
-    0x86, 0xb1, 0xbe, 0xc6, 0xca, 0xd5, 0xca, 0xab, 0x7f, 0x30, 0x28, 0x30,
-    0x3d, 0x45, 0x56, 0x56, 0x48, 0x45, 0x67, 0xd3, 0xbb, 0x94, 0x7c, 0x68,
-    0xd2, 0xcf, 0xcc, 0xb5, 0xa6, 0x71, 0x68, 0x43, 0x50, 0x61, 0x5a, 0x43,
-    0x50, 0x6b, 0x50, 0x50, 0x43, 0x43, 0x63, 0x63, 0x6b, 0x50, 0x46, 0x46,
-    0x61, 0x61, 0x61, 0x6f, 0x55, 0x29, 0x29, 0x36, 0x36, 0x4a, 0x4a, 0x36,
-    0x40, 0x2f, 0x24, 0x19, 0x1b, 0x1e, 0x24, 0x2b, 0x46, 0x4d, 0x63, 0x50,
-    0x50, 0x51, 0x3a, 0x2e, 0x2e, 0x27, 0x1d, 0x1f, 0x1f, 0x28, 0x78, 0xb4,
-    0xcf, 0xce, 0xbb, 0xbc, 0xa2, 0x85, 0x6c, 0x75, 0x51, 0x44, 0x46, 0x27,
-    0x37, 0x2d, 0x14, 0x14, 0x1e, 0x1d, 0x6f, 0xa2, 0xa2, 0xa2, 0x97, 0x74,
-    0x58, 0x44, 0x3e, 0x2d, 0x27, 0x3d, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x48,
-    0x48, 0x49, 0x13, 0x08, 0x0c, 0x05, 0x02, 0x02, 0x08, 0x0c, 0x07, 0x05,
-    0x03, 0x02, 0x02, 0x15, 0x1c, 0x33, 0x53, 0x6b, 0x74, 0x85, 0x77, 0x86,
-    0x86, 0x61, 0x61, 0x61, 0x46, 0x4d, 0x71, 0x94, 0xb6, 0xaf, 0xbb, 0xbb,
-    0xac, 0x91, 0x75, 0x5b, 0x88, 0x9c, 0xa6, 0xb6, 0xc8, 0xc8, 0xc8, 0xb5,
-    0xa5, 0x94, 0xa6, 0xb5, 0xc6, 0xdc, 0xd7, 0xc9, 0xb5, 0xb5, 0xc6, 0xc6,
-    0xd7, 0xe9, 0xe1, 0xc6, 0xcc, 0xcf, 0xcc, 0xdd, 0xd4, 0x26, 0x03, 0x03,
-    0x05, 0x0b, 0x13, 0x12, 0x12, 0x0d, 0x14, 0x14, 0x1a, 0x2b, 0x2b, 0x21,
-    0x12, 0x0a, 0x0a, 0x19, 0x1e, 0x1f, 0x1d, 0x29, 0x27, 0x3a, 0x43, 0x50,
-    0x58, 0x6b, 0x61, 0x3d, 0x2b, 0x2b, 0x1b, 0x14, 0x84, 0x84, 0x84, 0x83,
-    0x73, 0x6c, 0xa3, 0xca, 0xc8, 0xa6, 0x83, 0xa3, 0xac, 0xa3, 0x77, 0x81,
-    0xb4, 0xd2, 0xbe, 0x91, 0x6f, 0x55, 0x30, 0x2d, 0xa1, 0xd3, 0xe0, 0xd9,
-    0xd5, 0xc6, 0xa2, 0x84, 0x74, 0x84, 0x94, 0x8e, 0x8e, 0x76, 0x7c, 0x70,
-    0x68, 0x50, 0x54, 0x47, 0x37, 0x64, 0xe5, 0xfc, 0xfe, 0xfe, 0xfd, 0xf7,
-    0xf7, 0xed, 0xf3, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfe, 0xfc, 0xf2, 0xf3,
-    0xf3, 0xf3, 0xf3, 0xee, 0xe3, 0xf2, 0xd3, 0xd4, 0xe4, 0xf3, 0xe1, 0xac,
-    0x7b, 0xa1, 0xe4, 0xd1, 0xce, 0xbe, 0x9f, 0x61, 0x75, 0x73, 0x83, 0x91,
-    0x73, 0x84, 0x84, 0x73, 0x74, 0x63, 0x63, 0x6b, 0x72, 0xa2, 0xac, 0xaa,
-    0xaf, 0xa5, 0xa6, 0x8a, 0x70, 0x23, 0x1d, 0x3d, 0x56, 0x64, 0x67, 0x9d,
-    0x78, 0x64, 0x7d, 0xb2, 0xcc, 0xa8, 0xaa, 0x72, 0xb1, 0xd2, 0xcc, 0xb2,
-    0xac, 0x71, 0x57, 0x50, 0x5a, 0x7e, 0x55, 0x44, 0x44, 0x4d, 0x50, 0x50,
-    0x43, 0x58, 0x73, 0x84, 0x6b, 0x43, 0x39, 0x50, 0x63, 0x74, 0x74, 0x63,
-    0x54, 0x2e, 0x3e, 0x4a, 0x46, 0x61, 0x61, 0x54, 0x36, 0x2f, 0x1f, 0x1f,
-    0x2b, 0x2f, 0x2b, 0x1f, 0x27, 0x46, 0x46, 0x46, 0x46, 0x46, 0x27, 0x27,
-    0x2e, 0x2e, 0x1f, 0x10, 0x12, 0x14, 0x1b, 0x9f, 0xaa, 0xaf, 0xa6, 0xaf,
-    0xaa, 0xa2, 0x74, 0x75, 0x54, 0x54, 0x3a, 0x2e, 0x2e, 0x2b, 0x1b, 0x14,
-    0x2a, 0x1d, 0x1a, 0x55, 0x85, 0x97, 0x93, 0x82, 0x51, 0x2b, 0x1e, 0x2f,
-    0x28, 0x48, 0x45, 0x47, 0x55, 0x55, 0x47, 0x48, 0x48, 0x34, 0x07, 0x05,
-    0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x03, 0x20,
-    0x48, 0x64, 0x6c, 0x84, 0x74, 0x84, 0x84, 0x84, 0x85, 0x74, 0x74, 0x50,
-    0x50, 0x71, 0x94, 0xa6, 0xc6, 0xd9, 0xc6, 0xaf, 0xbb, 0xac, 0x84, 0x68,
-    0x7f, 0x9c, 0x94, 0xa6, 0xa6, 0xad, 0xa9, 0xa6, 0xaa, 0x7f, 0x94, 0xbb,
-    0xcc, 0xc6, 0xb6, 0xb6, 0xb6, 0xab, 0xca, 0xca, 0xd7, 0xd7, 0xd7, 0xd5,
-    0xcc, 0xe1, 0xe1, 0xdd, 0xd3, 0x41, 0x02, 0x02, 0x03, 0x08, 0x0a, 0x12,
-    0x12, 0x0d, 0x0d, 0x10, 0x1a, 0x1f, 0x1e, 0x12, 0x0a, 0x0a, 0x0a, 0x12,
-    0x14, 0x1e, 0x28, 0x29, 0x27, 0x2e, 0x3a, 0x37, 0x43, 0x50, 0x47, 0x2b,
-    0x2b, 0x1f, 0x1f, 0x1d, 0x97, 0x98, 0x97, 0x83, 0x73, 0x6b, 0x5a, 0xac,
-    0xd0, 0xaf, 0xaf, 0xce, 0xd0, 0xbc, 0x9f, 0xd3, 0xee, 0xee, 0xd9, 0xbc,
-    0xa3, 0x77, 0x47, 0x4c, 0xb7, 0xe0, 0xed, 0xe7, 0xca, 0xb6, 0xa6, 0x7f,
-    0x58, 0x58, 0x68, 0x66, 0x66, 0x66, 0x57, 0x57, 0x50, 0x43, 0x46, 0x2e,
-    0x45, 0xd4, 0xfc, 0xfe, 0xfa, 0xfa, 0xf9, 0xf7, 0xed, 0xf3, 0xf2, 0xec,
-    0xfc, 0xf2, 0xfc, 0xec, 0xec, 0xfc, 0xfe, 0xfa, 0xf2, 0xec, 0xec, 0xf3,
-    0xfc, 0xfa, 0xe4, 0xec, 0xf2, 0xfc, 0xf0, 0xe1, 0xb7, 0xd3, 0xe3, 0xf0,
-    0xeb, 0xe3, 0xa0, 0x7e, 0x69, 0x4d, 0x61, 0x75, 0x73, 0x73, 0x58, 0x58,
-    0x4d, 0x43, 0x50, 0x58, 0x75, 0x85, 0x71, 0x97, 0xa2, 0x94, 0x7f, 0x76,
-    0x68, 0x3a, 0x30, 0x53, 0x60, 0x7d, 0x87, 0x87, 0x9b, 0x7a, 0x9d, 0xd4,
-    0xd2, 0xcc, 0xb1, 0x82, 0x72, 0xdd, 0xce, 0xb7, 0x91, 0x68, 0x42, 0x44,
-    0x58, 0x4d, 0x46, 0x2c, 0x3a, 0x46, 0x46, 0x44, 0x43, 0x50, 0x58, 0x6b,
-    0x50, 0x43, 0x50, 0x50, 0x73, 0x84, 0x98, 0x6b, 0x50, 0x3a, 0x55, 0x6f,
-    0x61, 0x63, 0x63, 0x4d, 0x3a, 0x1a, 0x14, 0x1f, 0x2f, 0x2e, 0x2e, 0x27,
-    0x27, 0x29, 0x27, 0x2e, 0x3e, 0x2f, 0x12, 0x12, 0x1f, 0x28, 0x1b, 0x07,
-    0x03, 0x08, 0x0c, 0x60, 0x93, 0xaa, 0xaa, 0xa2, 0x93, 0x71, 0x72, 0x5a,
-    0x54, 0x46, 0x3e, 0x2e, 0x1f, 0x1b, 0x14, 0x1b, 0x2b, 0x1d, 0x1f, 0x28,
-    0x3e, 0x46, 0x4d, 0x3a, 0x1e, 0x0a, 0x0c, 0x21, 0x1c, 0x48, 0x56, 0x53,
-    0x53, 0x53, 0x53, 0x45, 0x49, 0x13, 0x03, 0x02, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x15, 0x15, 0x0b, 0x20, 0x3d, 0x75, 0x85, 0x82, 0x94,
-    0x97, 0x8c, 0xa3, 0x91, 0x5e, 0x63, 0x6b, 0x50, 0x43, 0x7f, 0x8e, 0xa6,
-    0xca, 0xd5, 0xca, 0xb6, 0xa6, 0x97, 0x68, 0x68, 0x7f, 0x7f, 0x96, 0x94,
-    0x94, 0x8e, 0x89, 0xa6, 0x97, 0x74, 0x97, 0xbb, 0xbb, 0xaa, 0x93, 0xa6,
-    0x9c, 0xab, 0xb6, 0xca, 0xdc, 0xcc, 0xc9, 0xc9, 0xd5, 0xdd, 0xdd, 0xce,
-    0xcf, 0x3c, 0x02, 0x02, 0x03, 0x05, 0x0a, 0x12, 0x0a, 0x0c, 0x0a, 0x0a,
-    0x14, 0x1f, 0x19, 0x0a, 0x0c, 0x0c, 0x0c, 0x19, 0x1b, 0x1a, 0x27, 0x29,
-    0x27, 0x27, 0x27, 0x2c, 0x37, 0x3a, 0x36, 0x1b, 0x1b, 0x1f, 0x1f, 0x28,
-    0x97, 0x96, 0x96, 0x94, 0x71, 0x58, 0x45, 0xa1, 0xd3, 0xe0, 0xce, 0xd9,
-    0xd9, 0xbc, 0xb7, 0xee, 0xee, 0xed, 0xd7, 0xca, 0x97, 0x75, 0x5e, 0x69,
-    0xb7, 0xd9, 0xe7, 0xde, 0xc8, 0xa7, 0x94, 0x68, 0x43, 0x37, 0x43, 0x58,
-    0x50, 0x4b, 0x4b, 0x50, 0x32, 0x30, 0x3e, 0x54, 0x81, 0xfa, 0xfc, 0xfc,
-    0xfc, 0xfa, 0xfa, 0xf9, 0xfc, 0xfc, 0xec, 0xec, 0xec, 0xf2, 0xf2, 0xec,
-    0xec, 0xfa, 0xfa, 0xfa, 0xf2, 0xe5, 0xf0, 0xfa, 0xfa, 0xf7, 0xe9, 0xeb,
-    0xed, 0xf7, 0xf7, 0xe8, 0xcf, 0xe1, 0xdd, 0xe9, 0xeb, 0xeb, 0xdd, 0xcf,
-    0x81, 0x6a, 0x6a, 0x9f, 0x6f, 0x4d, 0x4d, 0x4d, 0x46, 0x2e, 0x37, 0x50,
-    0x75, 0x74, 0x74, 0x91, 0x97, 0x83, 0x71, 0x71, 0x6b, 0x3a, 0x23, 0x30,
-    0x51, 0x78, 0x87, 0x9a, 0x8c, 0x9a, 0xd4, 0xe4, 0xe3, 0xbb, 0xa2, 0x82,
-    0x87, 0xb1, 0xb5, 0x94, 0x66, 0x68, 0x50, 0x64, 0x6c, 0x3a, 0x44, 0x44,
-    0x55, 0x46, 0x39, 0x43, 0x37, 0x43, 0x43, 0x43, 0x54, 0x54, 0x4d, 0x6b,
-    0x73, 0x83, 0x83, 0x68, 0x50, 0x54, 0x4d, 0x74, 0x74, 0x73, 0x63, 0x63,
-    0x54, 0x1a, 0x1b, 0x2b, 0x3e, 0x3a, 0x3a, 0x3e, 0x2e, 0x1d, 0x14, 0x12,
-    0x16, 0x0c, 0x02, 0x03, 0x12, 0x1e, 0x0c, 0x03, 0x0b, 0x05, 0x07, 0x31,
-    0x77, 0x93, 0xaa, 0x97, 0x7f, 0x66, 0x57, 0x54, 0x44, 0x37, 0x3e, 0x1d,
-    0x19, 0x14, 0x1b, 0x1e, 0x28, 0x1d, 0x2d, 0x28, 0x28, 0x1f, 0x1f, 0x14,
-    0x12, 0x08, 0x05, 0x0c, 0x0d, 0x33, 0x47, 0x43, 0x50, 0x51, 0x5a, 0x47,
-    0x22, 0x08, 0x05, 0x03, 0x02, 0x02, 0x00, 0x02, 0x02, 0x05, 0x13, 0x22,
-    0x20, 0x1e, 0x2d, 0x51, 0x68, 0x7f, 0x94, 0x94, 0x94, 0x96, 0x83, 0x84,
-    0x54, 0x54, 0x58, 0x4d, 0x43, 0x71, 0x8e, 0x8a, 0xad, 0xa6, 0xa6, 0xa6,
-    0xaf, 0x97, 0x6b, 0x74, 0x7f, 0x71, 0x7f, 0x7f, 0x96, 0x8e, 0x8a, 0x76,
-    0x7f, 0x72, 0x7f, 0xa6, 0x94, 0xa6, 0xab, 0xb8, 0x8c, 0xa5, 0x9c, 0xca,
-    0xd5, 0xd5, 0xc9, 0xca, 0xd5, 0xdc, 0xcc, 0xdc, 0xcf, 0x4f, 0x06, 0x06,
-    0x09, 0x0c, 0x0a, 0x0c, 0x0c, 0x08, 0x08, 0x0a, 0x19, 0x19, 0x16, 0x09,
-    0x03, 0x05, 0x05, 0x08, 0x12, 0x19, 0x19, 0x1f, 0x29, 0x27, 0x27, 0x27,
-    0x27, 0x2b, 0x1b, 0x10, 0x10, 0x1b, 0x2b, 0x36, 0x96, 0x96, 0x94, 0x7f,
-    0x71, 0x50, 0x3a, 0x80, 0xd3, 0xe3, 0xdc, 0xc6, 0xc6, 0xbc, 0xd1, 0xee,
-    0xee, 0xe7, 0xc8, 0xb6, 0x96, 0x84, 0x54, 0x55, 0xac, 0xca, 0xc8, 0xc5,
-    0xa9, 0x89, 0x7f, 0x68, 0x32, 0x23, 0x37, 0x43, 0x43, 0x32, 0x37, 0x2e,
-    0x2e, 0x2d, 0x56, 0x91, 0xd3, 0xfc, 0xfc, 0xfa, 0xfc, 0xe4, 0xe4, 0xfc,
-    0xfc, 0xfc, 0xec, 0xec, 0xfc, 0xfc, 0xfc, 0xfa, 0xeb, 0xfa, 0xfa, 0xfa,
-    0xee, 0xe1, 0xed, 0xed, 0xea, 0xe6, 0xd7, 0xd5, 0xd5, 0xe6, 0xde, 0xda,
-    0xc6, 0xc6, 0xdc, 0xdc, 0xeb, 0xeb, 0xdc, 0xbc, 0xba, 0xb9, 0xe4, 0xcf,
-    0xcf, 0xa3, 0x54, 0x46, 0x29, 0x1a, 0x29, 0x46, 0x43, 0x43, 0x58, 0x58,
-    0x58, 0x58, 0x58, 0x50, 0x43, 0x27, 0x1d, 0x23, 0x30, 0x60, 0x77, 0x9a,
-    0x8c, 0x9a, 0xd2, 0xd2, 0xcc, 0xcf, 0xae, 0x9a, 0x9f, 0x86, 0xaa, 0x83,
-    0x73, 0x58, 0x4d, 0x69, 0x54, 0x46, 0x5e, 0x58, 0x58, 0x4d, 0x50, 0x50,
-    0x43, 0x37, 0x2c, 0x37, 0x54, 0x4a, 0x54, 0x6b, 0x66, 0x71, 0x66, 0x50,
-    0x44, 0x46, 0x4d, 0x6b, 0x73, 0x83, 0x84, 0x6b, 0x39, 0x28, 0x1f, 0x2e,
-    0x3a, 0x3a, 0x46, 0x47, 0x3e, 0x1f, 0x19, 0x08, 0x03, 0x02, 0x00, 0x02,
-    0x05, 0x0b, 0x03, 0x05, 0x1c, 0x15, 0x12, 0x2a, 0x45, 0x72, 0x7f, 0x7f,
-    0x71, 0x57, 0x58, 0x54, 0x3e, 0x2e, 0x1d, 0x10, 0x0d, 0x1b, 0x1b, 0x2a,
-    0x3d, 0x2d, 0x48, 0x2e, 0x28, 0x28, 0x1f, 0x1b, 0x12, 0x09, 0x06, 0x08,
-    0x0a, 0x12, 0x2a, 0x2e, 0x3e, 0x47, 0x3d, 0x10, 0x08, 0x05, 0x03, 0x05,
-    0x06, 0x06, 0x05, 0x03, 0x06, 0x0b, 0x13, 0x1c, 0x20, 0x2a, 0x30, 0x58,
-    0x71, 0x94, 0xa5, 0xaa, 0xaf, 0x94, 0x96, 0x83, 0x7b, 0x75, 0x4d, 0x46,
-    0x2e, 0x57, 0x70, 0x76, 0x8e, 0x8e, 0x8e, 0x94, 0x97, 0x83, 0x71, 0x57,
-    0x57, 0x66, 0x68, 0x71, 0x7f, 0x74, 0x66, 0x7c, 0xb5, 0xaa, 0x97, 0x82,
-    0xa5, 0xa6, 0xca, 0xdd, 0xbe, 0xa5, 0xab, 0xc6, 0xca, 0xda, 0xdc, 0xc6,
-    0xc9, 0xd5, 0xd7, 0xdc, 0xd2, 0x6e, 0x13, 0x13, 0x0c, 0x13, 0x12, 0x0c,
-    0x13, 0x0a, 0x0a, 0x0a, 0x0d, 0x12, 0x16, 0x04, 0x02, 0x00, 0x02, 0x02,
-    0x05, 0x0a, 0x19, 0x1f, 0x1a, 0x1a, 0x1d, 0x1f, 0x1a, 0x19, 0x0a, 0x07,
-    0x10, 0x1b, 0x28, 0x27, 0x83, 0x83, 0x7f, 0x71, 0x57, 0x43, 0x2e, 0x33,
-    0x9d, 0xe4, 0xdd, 0xc6, 0xd1, 0xbe, 0xbe, 0xe3, 0xed, 0xde, 0xc5, 0x8e,
-    0x94, 0x73, 0x50, 0x37, 0x60, 0x97, 0x94, 0x89, 0x8e, 0x76, 0x66, 0x4b,
-    0x44, 0x3e, 0x2e, 0x27, 0x27, 0x2e, 0x27, 0x1d, 0x46, 0x78, 0xb4, 0xe3,
-    0xee, 0xfe, 0xfe, 0xfa, 0xee, 0xe3, 0xec, 0xec, 0xec, 0xfc, 0xfa, 0xf3,
-    0xf3, 0xf3, 0xfe, 0xf9, 0xea, 0xed, 0xf7, 0xf7, 0xdc, 0xca, 0xc6, 0xca,
-    0xd5, 0xca, 0xca, 0xaf, 0xbb, 0xc8, 0xb6, 0xb6, 0xaf, 0xaf, 0xc6, 0xd9,
-    0xd9, 0xd7, 0xc8, 0xb6, 0x77, 0xa0, 0xdd, 0xdd, 0xe1, 0xd5, 0x84, 0x3a,
-    0x36, 0x52, 0x3f, 0x36, 0x23, 0x39, 0x4d, 0x43, 0x43, 0x50, 0x43, 0x43,
-    0x2c, 0x1d, 0x1d, 0x2e, 0x3d, 0x6a, 0x60, 0x7a, 0x7a, 0x8c, 0xb1, 0xb2,
-    0xb1, 0xa8, 0x82, 0x85, 0x58, 0x77, 0xb2, 0x9f, 0x77, 0x6f, 0x61, 0x46,
-    0x46, 0x54, 0x6f, 0x75, 0x6b, 0x73, 0x6b, 0x58, 0x43, 0x2c, 0x27, 0x2e,
-    0x2e, 0x3a, 0x3a, 0x50, 0x50, 0x43, 0x2c, 0x46, 0x46, 0x39, 0x50, 0x6b,
-    0x73, 0x83, 0x74, 0x63, 0x36, 0x1f, 0x1f, 0x2e, 0x2e, 0x46, 0x46, 0x46,
-    0x2e, 0x24, 0x12, 0x06, 0x02, 0x00, 0x00, 0x02, 0x06, 0x06, 0x06, 0x13,
-    0x21, 0x1e, 0x33, 0x2d, 0x47, 0x5a, 0x58, 0x6b, 0x58, 0x58, 0x51, 0x30,
-    0x2e, 0x27, 0x1f, 0x14, 0x12, 0x0d, 0x1e, 0x33, 0x48, 0x48, 0x47, 0x47,
-    0x2e, 0x27, 0x28, 0x1e, 0x13, 0x08, 0x05, 0x08, 0x0b, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0d, 0x0a, 0x0b, 0x08, 0x03, 0x03, 0x05, 0x08, 0x13, 0x13, 0x0b,
-    0x15, 0x1c, 0x13, 0x1c, 0x1e, 0x28, 0x44, 0x58, 0x71, 0x94, 0xbb, 0xbc,
-    0xaf, 0x96, 0x96, 0x97, 0x98, 0x85, 0x63, 0x46, 0x2e, 0x4b, 0x66, 0x71,
-    0x71, 0x8e, 0x8e, 0x7f, 0x96, 0x73, 0x43, 0x2c, 0x2c, 0x68, 0x74, 0x50,
-    0x58, 0x93, 0xa6, 0xca, 0xdc, 0xce, 0xbb, 0xaa, 0xaa, 0xb8, 0xd5, 0xd1,
-    0xaa, 0x94, 0xa5, 0xb5, 0xc8, 0xd7, 0xdd, 0xd5, 0xc9, 0xc6, 0xca, 0xc9,
-    0xcc, 0x9d, 0x35, 0x22, 0x1c, 0x1c, 0x21, 0x19, 0x1c, 0x1c, 0x1e, 0x13,
-    0x0c, 0x0d, 0x0c, 0x04, 0x00, 0x00, 0x00, 0x02, 0x02, 0x08, 0x12, 0x19,
-    0x19, 0x12, 0x14, 0x14, 0x19, 0x0d, 0x07, 0x0a, 0x1b, 0x1f, 0x1d, 0x27,
-    0x6b, 0x73, 0x66, 0x50, 0x43, 0x2c, 0x1a, 0x1c, 0x6e, 0xe4, 0xe0, 0xce,
-    0xd3, 0xd2, 0xbe, 0xdc, 0xdc, 0xc8, 0xa9, 0x8e, 0x76, 0x68, 0x43, 0x23,
-    0x2e, 0x6b, 0x6b, 0x71, 0x71, 0x66, 0x43, 0x37, 0x54, 0x6d, 0x33, 0x28,
-    0x27, 0x27, 0x27, 0x27, 0x5a, 0xa3, 0xe4, 0xfc, 0xfa, 0xfe, 0xfa, 0xf9,
-    0xee, 0xf3, 0xec, 0xfc, 0xfc, 0xfa, 0xf9, 0xf8, 0xee, 0xee, 0xf0, 0xee,
-    0xed, 0xd7, 0xd9, 0xe0, 0xd2, 0xb7, 0xac, 0x96, 0xbe, 0xaf, 0xa3, 0x91,
-    0x84, 0x94, 0x94, 0x96, 0x98, 0x98, 0x94, 0xaf, 0xb6, 0xad, 0xa6, 0x94,
-    0x94, 0xaf, 0xd5, 0xdd, 0xeb, 0xd7, 0xaf, 0x63, 0x54, 0x4c, 0x4a, 0x61,
-    0x46, 0x77, 0x54, 0x32, 0x2c, 0x32, 0x43, 0x3a, 0x27, 0x1f, 0x1f, 0x27,
-    0x27, 0x55, 0x64, 0x78, 0x72, 0x72, 0x7a, 0xaa, 0xa2, 0x82, 0x82, 0x68,
-    0x4b, 0x60, 0xa0, 0xba, 0xa0, 0x7e, 0x75, 0x61, 0x58, 0x54, 0x60, 0x75,
-    0x82, 0x83, 0x71, 0x57, 0x43, 0x2c, 0x2e, 0x3a, 0x3a, 0x3a, 0x2e, 0x3a,
-    0x3a, 0x27, 0x27, 0x3a, 0x2e, 0x37, 0x50, 0x58, 0x58, 0x73, 0x58, 0x2e,
-    0x19, 0x0d, 0x14, 0x2b, 0x29, 0x3e, 0x3a, 0x3a, 0x29, 0x19, 0x08, 0x03,
-    0x02, 0x00, 0x00, 0x02, 0x0b, 0x13, 0x1c, 0x1c, 0x2a, 0x2f, 0x48, 0x3e,
-    0x3e, 0x5e, 0x6c, 0x5a, 0x6c, 0x5a, 0x44, 0x45, 0x2e, 0x2e, 0x28, 0x2b,
-    0x1b, 0x10, 0x1b, 0x31, 0x48, 0x48, 0x47, 0x45, 0x47, 0x2e, 0x28, 0x1e,
-    0x13, 0x05, 0x05, 0x08, 0x08, 0x09, 0x09, 0x08, 0x08, 0x05, 0x08, 0x08,
-    0x05, 0x03, 0x02, 0x05, 0x0b, 0x13, 0x13, 0x12, 0x1e, 0x20, 0x1c, 0x1b,
-    0x33, 0x28, 0x44, 0x57, 0x71, 0x94, 0xaf, 0xaf, 0x96, 0x94, 0x96, 0x84,
-    0x7b, 0x63, 0x4d, 0x3a, 0x27, 0x32, 0x50, 0x71, 0x71, 0x66, 0x7f, 0x66,
-    0x66, 0x6b, 0x50, 0x6c, 0x53, 0x85, 0x91, 0x75, 0x57, 0x9c, 0xca, 0xdc,
-    0xdc, 0xd7, 0xc6, 0xaa, 0xa2, 0xaf, 0xb5, 0xbc, 0xaa, 0x93, 0xaa, 0x93,
-    0xab, 0xc1, 0xca, 0xcf, 0xbe, 0xaa, 0xd5, 0xd7, 0xdd, 0xd2, 0x8f, 0x4f,
-    0x20, 0x2a, 0x2f, 0x2f, 0x2f, 0x33, 0x2a, 0x12, 0x07, 0x07, 0x08, 0x02,
-    0x02, 0x02, 0x03, 0x03, 0x03, 0x05, 0x0a, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0c, 0x12, 0x1e, 0x2b, 0x1d, 0x27, 0x50, 0x50, 0x43, 0x32,
-    0x2c, 0x1d, 0x10, 0x13, 0x9e, 0xe5, 0xe3, 0xce, 0xd2, 0xe3, 0xce, 0xc6,
-    0xb5, 0xb6, 0xa6, 0x8e, 0x71, 0x6b, 0x5a, 0x30, 0x27, 0x3e, 0x3a, 0x43,
-    0x43, 0x50, 0x2c, 0x30, 0x47, 0x69, 0x55, 0x46, 0x2e, 0x27, 0x2b, 0x2f,
-    0x9f, 0xce, 0xee, 0xfe, 0xf9, 0xfa, 0xfa, 0xed, 0xdf, 0xf2, 0xfc, 0xfc,
-    0xfe, 0xfe, 0xf9, 0xed, 0xed, 0xe3, 0xe4, 0xee, 0xde, 0xc6, 0xce, 0xbc,
-    0xcf, 0xd4, 0x9f, 0xb7, 0xb7, 0xa2, 0x85, 0x81, 0xba, 0x9d, 0x84, 0x71,
-    0x61, 0x6f, 0x74, 0x96, 0x94, 0x88, 0x7f, 0x7f, 0x97, 0x97, 0xc6, 0xd5,
-    0xd7, 0xc8, 0xa6, 0x83, 0x63, 0x61, 0x63, 0x74, 0x9f, 0x85, 0x61, 0x51,
-    0x44, 0x3a, 0x27, 0x27, 0x1f, 0x14, 0x14, 0x1b, 0x2d, 0x3d, 0x64, 0x60,
-    0x5a, 0x58, 0x4b, 0x75, 0x84, 0x71, 0x68, 0x57, 0x44, 0x37, 0x5e, 0xba,
-    0xb4, 0xa0, 0xa0, 0x91, 0x63, 0x39, 0x43, 0x58, 0x6b, 0x73, 0x58, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x3a, 0x3e, 0x1a, 0x1e, 0x2e,
-    0x3e, 0x37, 0x51, 0x51, 0x43, 0x43, 0x2e, 0x10, 0x0a, 0x0a, 0x12, 0x19,
-    0x1e, 0x2b, 0x29, 0x1d, 0x1b, 0x0c, 0x05, 0x02, 0x02, 0x00, 0x00, 0x02,
-    0x0b, 0x22, 0x20, 0x1e, 0x2b, 0x28, 0x3e, 0x47, 0x53, 0x60, 0x5a, 0x50,
-    0x75, 0x54, 0x51, 0x37, 0x46, 0x2e, 0x2f, 0x2f, 0x1e, 0x19, 0x1b, 0x2b,
-    0x3d, 0x48, 0x55, 0x55, 0x47, 0x3e, 0x2d, 0x20, 0x13, 0x0a, 0x0b, 0x08,
-    0x09, 0x06, 0x09, 0x08, 0x0b, 0x08, 0x06, 0x05, 0x03, 0x02, 0x02, 0x0a,
-    0x1c, 0x22, 0x1c, 0x1c, 0x1e, 0x2a, 0x1e, 0x10, 0x10, 0x2d, 0x44, 0x4b,
-    0x68, 0x71, 0x7f, 0x7f, 0x8e, 0x96, 0x96, 0x83, 0x74, 0x63, 0x39, 0x37,
-    0x2e, 0x27, 0x2c, 0x50, 0x6b, 0x57, 0x57, 0x50, 0x63, 0x74, 0x82, 0xbb,
-    0xaf, 0xbb, 0xac, 0xac, 0x6b, 0x94, 0xe1, 0xe3, 0xca, 0xb6, 0xa6, 0x94,
-    0x94, 0x97, 0xa6, 0xb6, 0xca, 0xca, 0xc6, 0xaa, 0x93, 0xa5, 0xc6, 0xd3,
-    0xb7, 0xbb, 0xca, 0xd7, 0xe1, 0xe1, 0xe4, 0xd4, 0x80, 0x4e, 0x4e, 0x3d,
-    0x3d, 0x4c, 0x35, 0x22, 0x15, 0x0c, 0x05, 0x03, 0x03, 0x05, 0x08, 0x08,
-    0x05, 0x03, 0x07, 0x0d, 0x10, 0x1b, 0x1c, 0x0c, 0x0a, 0x0d, 0x0c, 0x0c,
-    0x1e, 0x1e, 0x1f, 0x1d, 0x3a, 0x3a, 0x2e, 0x27, 0x27, 0x14, 0x10, 0x13,
-    0xb9, 0xf3, 0xe3, 0xe1, 0xee, 0xeb, 0xdc, 0xa5, 0x7c, 0x9c, 0x94, 0x68,
-    0x72, 0x86, 0x7e, 0x53, 0x23, 0x1d, 0x1a, 0x27, 0x3a, 0x37, 0x46, 0x6f,
-    0x6c, 0x58, 0x73, 0x6b, 0x44, 0x2e, 0x2d, 0x48, 0xae, 0xce, 0xee, 0xf9,
-    0xf9, 0xf9, 0xe7, 0xee, 0xfc, 0xfc, 0xfc, 0xfe, 0xf8, 0xf8, 0xf8, 0xf8,
-    0xf3, 0xf3, 0xe4, 0xe4, 0xdc, 0xe4, 0xe0, 0xd5, 0xd5, 0xc6, 0xbe, 0xae,
-    0xbb, 0xc6, 0xaa, 0xd3, 0xb9, 0xac, 0xa8, 0x82, 0x9f, 0x7e, 0x61, 0x83,
-    0x71, 0x71, 0x73, 0x43, 0x73, 0x97, 0xaf, 0xb6, 0xb6, 0xa6, 0x8a, 0x7f,
-    0x63, 0x7b, 0x75, 0x9f, 0xae, 0xbc, 0x9f, 0xa2, 0x6c, 0x3a, 0x27, 0x1f,
-    0x0d, 0x0a, 0x0a, 0x19, 0x2f, 0x3e, 0x3e, 0x37, 0x54, 0x50, 0x42, 0x37,
-    0x50, 0x50, 0x50, 0x43, 0x37, 0x2c, 0x30, 0x9d, 0xb4, 0xb4, 0xae, 0x85,
-    0x63, 0x54, 0x50, 0x43, 0x32, 0x3a, 0x37, 0x2c, 0x43, 0x50, 0x50, 0x50,
-    0x50, 0x43, 0x43, 0x3a, 0x3e, 0x1a, 0x14, 0x14, 0x1f, 0x2e, 0x2e, 0x27,
-    0x27, 0x27, 0x1b, 0x0a, 0x08, 0x08, 0x0a, 0x12, 0x12, 0x1c, 0x19, 0x10,
-    0x0a, 0x08, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x11, 0x22, 0x34, 0x2f,
-    0x2d, 0x2e, 0x3e, 0x44, 0x51, 0x53, 0x51, 0x51, 0x6c, 0x6f, 0x5e, 0x2e,
-    0x3a, 0x3e, 0x40, 0x2f, 0x1e, 0x12, 0x0d, 0x1c, 0x2a, 0x48, 0x47, 0x55,
-    0x47, 0x3e, 0x28, 0x1c, 0x10, 0x1b, 0x12, 0x0d, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x08, 0x08, 0x09, 0x05, 0x03, 0x03, 0x05, 0x1c, 0x2a, 0x33, 0x33, 0x1e,
-    0x2a, 0x2a, 0x2a, 0x10, 0x07, 0x1e, 0x37, 0x50, 0x57, 0x68, 0x71, 0x71,
-    0x71, 0x73, 0x73, 0x6b, 0x63, 0x54, 0x3a, 0x3a, 0x2e, 0x1a, 0x1f, 0x46,
-    0x43, 0x43, 0x2c, 0x46, 0x61, 0x94, 0xab, 0xc8, 0xd5, 0xc6, 0xaf, 0xbc,
-    0x85, 0x8c, 0xe3, 0xb2, 0xa6, 0x8a, 0x9c, 0x94, 0xa6, 0xaf, 0x94, 0xb6,
-    0xc6, 0xca, 0xdc, 0xeb, 0xb2, 0xa2, 0xbe, 0xb7, 0xd5, 0xd5, 0xd5, 0xca,
-    0xc9, 0xcc, 0xcf, 0xdd, 0xe1, 0xb4, 0x6a, 0x48, 0x55, 0x4c, 0x4e, 0x33,
-    0x22, 0x1c, 0x0c, 0x08, 0x08, 0x0c, 0x16, 0x15, 0x08, 0x05, 0x0a, 0x19,
-    0x1f, 0x2b, 0x24, 0x19, 0x19, 0x19, 0x19, 0x0d, 0x10, 0x19, 0x1f, 0x1d,
-    0x27, 0x27, 0x1f, 0x1a, 0x1f, 0x1a, 0x1b, 0x2a, 0x9d, 0xe3, 0xe3, 0xee,
-    0xee, 0xeb, 0xd7, 0xab, 0x7c, 0x7c, 0x68, 0x72, 0x85, 0x9f, 0x7e, 0x5a,
-    0x44, 0x27, 0x1a, 0x1f, 0x2d, 0x64, 0x91, 0xa3, 0xaf, 0x83, 0x83, 0x83,
-    0x58, 0x54, 0x45, 0x78, 0xbe, 0xce, 0xfa, 0xf9, 0xf7, 0xf8, 0xed, 0xfa,
-    0xfc, 0xfc, 0xfc, 0xfe, 0xf9, 0xf6, 0xf6, 0xf9, 0xf0, 0xee, 0xe3, 0xe1,
-    0xe1, 0xdc, 0xd5, 0xdd, 0xce, 0xc6, 0xb7, 0xaa, 0xdd, 0xe1, 0xc6, 0xaf,
-    0xaf, 0xbb, 0xcc, 0xbb, 0x94, 0x84, 0x58, 0x50, 0x58, 0x61, 0x63, 0x44,
-    0x61, 0x73, 0x84, 0x97, 0x94, 0x94, 0x7f, 0x7f, 0x63, 0x75, 0x91, 0xb7,
-    0xbe, 0xb2, 0xcf, 0xbb, 0x51, 0x27, 0x1b, 0x0d, 0x0a, 0x0a, 0x0a, 0x12,
-    0x19, 0x1e, 0x2f, 0x40, 0x46, 0x44, 0x2c, 0x30, 0x27, 0x1d, 0x1d, 0x1f,
-    0x1b, 0x1d, 0x1a, 0x49, 0xb7, 0xbe, 0xaf, 0x83, 0x73, 0x58, 0x50, 0x37,
-    0x3a, 0x27, 0x27, 0x2c, 0x43, 0x50, 0x58, 0x58, 0x58, 0x50, 0x42, 0x37,
-    0x1f, 0x2b, 0x1f, 0x1b, 0x1a, 0x1d, 0x1d, 0x1f, 0x1f, 0x1f, 0x1b, 0x12,
-    0x08, 0x09, 0x0b, 0x0a, 0x12, 0x12, 0x12, 0x0d, 0x13, 0x0c, 0x06, 0x03,
-    0x02, 0x02, 0x02, 0x06, 0x0b, 0x22, 0x33, 0x3e, 0x30, 0x47, 0x55, 0x5a,
-    0x51, 0x60, 0x55, 0x44, 0x5a, 0x6f, 0x5e, 0x2e, 0x3e, 0x40, 0x2f, 0x2b,
-    0x1c, 0x0c, 0x08, 0x05, 0x1c, 0x28, 0x3e, 0x47, 0x47, 0x28, 0x14, 0x14,
-    0x1f, 0x1e, 0x1b, 0x14, 0x0a, 0x0c, 0x0c, 0x0c, 0x08, 0x0b, 0x09, 0x05,
-    0x09, 0x0b, 0x0c, 0x1c, 0x2a, 0x2d, 0x48, 0x31, 0x34, 0x2a, 0x1e, 0x1b,
-    0x0a, 0x1c, 0x30, 0x51, 0x4b, 0x58, 0x68, 0x73, 0x66, 0x66, 0x73, 0x74,
-    0x63, 0x61, 0x47, 0x2e, 0x1f, 0x14, 0x1b, 0x3a, 0x3a, 0x3a, 0x1a, 0x28,
-    0x7f, 0x94, 0xab, 0xd5, 0xdd, 0xd9, 0xb6, 0xa6, 0x83, 0x97, 0xcf, 0xb4,
-    0x85, 0x94, 0xa6, 0xca, 0xc6, 0xb5, 0x9c, 0xab, 0xc1, 0xc8, 0xd7, 0xd9,
-    0xbb, 0xa2, 0xce, 0xbe, 0xd7, 0xd7, 0xc6, 0xc6, 0xce, 0xdd, 0xd2, 0xe1,
-    0xe3, 0xb4, 0x80, 0x64, 0x56, 0x64, 0x48, 0x49, 0x33, 0x2a, 0x12, 0x12,
-    0x12, 0x19, 0x19, 0x19, 0x12, 0x13, 0x1c, 0x1f, 0x27, 0x2e, 0x29, 0x24,
-    0x1e, 0x1e, 0x1e, 0x0d, 0x0a, 0x1b, 0x1f, 0x28, 0x1b, 0x14, 0x14, 0x1b,
-    0x1f, 0x2b, 0x2f, 0x3e, 0x64, 0xb7, 0xd1, 0xe1, 0xeb, 0xea, 0xca, 0xab,
-    0x88, 0x70, 0x7a, 0xac, 0xbc, 0xbc, 0x97, 0x73, 0x58, 0x2c, 0x36, 0x36,
-    0x5e, 0xae, 0xbc, 0xce, 0xc6, 0xaf, 0xaf, 0x96, 0x74, 0x61, 0x61, 0x86,
-    0xaa, 0xce, 0xfa, 0xfa, 0xee, 0xea, 0xf7, 0xfc, 0xfa, 0xfc, 0xfc, 0xfe,
-    0xf8, 0xf6, 0xea, 0xea, 0xe7, 0xe7, 0xdc, 0xdc, 0xd5, 0xca, 0xc6, 0xd1,
-    0xce, 0xb2, 0xae, 0xa5, 0xbb, 0xca, 0xa6, 0x7c, 0x94, 0xbb, 0xd5, 0xb5,
-    0x7c, 0x82, 0x85, 0x43, 0x86, 0x69, 0x61, 0x77, 0x5e, 0x61, 0x63, 0x73,
-    0x73, 0x83, 0x73, 0x50, 0x63, 0x73, 0xa3, 0xaa, 0xce, 0xce, 0xc6, 0xaf,
-    0x8c, 0x47, 0x12, 0x12, 0x1c, 0x1c, 0x1c, 0x12, 0x12, 0x21, 0x2b, 0x2b,
-    0x2e, 0x3e, 0x2e, 0x2e, 0x1f, 0x10, 0x0d, 0x12, 0x10, 0x1e, 0x1d, 0x1d,
-    0x64, 0xa3, 0x97, 0x7f, 0x66, 0x50, 0x4d, 0x2c, 0x27, 0x27, 0x27, 0x2e,
-    0x43, 0x58, 0x73, 0x73, 0x58, 0x4b, 0x37, 0x27, 0x1d, 0x2d, 0x28, 0x2f,
-    0x27, 0x27, 0x28, 0x2b, 0x1f, 0x1e, 0x14, 0x13, 0x0b, 0x0c, 0x0c, 0x12,
-    0x1c, 0x12, 0x12, 0x12, 0x13, 0x0c, 0x08, 0x03, 0x03, 0x06, 0x0b, 0x13,
-    0x1e, 0x2a, 0x2d, 0x3e, 0x53, 0x47, 0x55, 0x5a, 0x51, 0x64, 0x64, 0x51,
-    0x55, 0x46, 0x47, 0x3d, 0x4e, 0x2f, 0x2b, 0x1e, 0x22, 0x1c, 0x0a, 0x15,
-    0x0c, 0x07, 0x0a, 0x1c, 0x1c, 0x10, 0x1b, 0x1a, 0x1d, 0x28, 0x1d, 0x1b,
-    0x10, 0x0a, 0x0c, 0x15, 0x0c, 0x08, 0x08, 0x08, 0x09, 0x08, 0x0a, 0x1c,
-    0x1e, 0x2d, 0x3d, 0x3d, 0x56, 0x33, 0x2a, 0x2a, 0x1e, 0x1d, 0x2e, 0x51,
-    0x50, 0x50, 0x58, 0x58, 0x63, 0x50, 0x50, 0x63, 0x4d, 0x63, 0x3a, 0x1f,
-    0x1a, 0x1b, 0x1b, 0x29, 0x3a, 0x61, 0x55, 0x2e, 0x71, 0x94, 0xb6, 0xca,
-    0xca, 0xca, 0xa6, 0x96, 0x83, 0x93, 0xcf, 0xac, 0x97, 0xa6, 0xc1, 0xd7,
-    0xdc, 0xc6, 0xa6, 0x8a, 0xa7, 0xb6, 0xb6, 0xb6, 0xa6, 0xa5, 0xc6, 0xca,
-    0xda, 0xdc, 0xce, 0xce, 0xe3, 0xe4, 0xe3, 0xdd, 0xdc, 0xd2, 0xa0, 0x60,
-    0x60, 0x60, 0x64, 0x56, 0x4c, 0x35, 0x1c, 0x1c, 0x1e, 0x1e, 0x14, 0x1b,
-    0x1e, 0x1f, 0x2b, 0x28, 0x2e, 0x2e, 0x2e, 0x2f, 0x2f, 0x2a, 0x1e, 0x12,
-    0x07, 0x12, 0x1b, 0x1b, 0x19, 0x14, 0x1b, 0x1f, 0x2b, 0x2e, 0x44, 0x50,
-    0x5a, 0x75, 0xac, 0xce, 0xdc, 0xd9, 0xc8, 0xab, 0x94, 0x70, 0x8c, 0xce,
-    0xd9, 0xc8, 0xa6, 0x96, 0x74, 0x43, 0x55, 0x5e, 0x91, 0xdf, 0xd9, 0xd9,
-    0xca, 0xca, 0xaf, 0x97, 0x94, 0x74, 0x6c, 0x6c, 0x84, 0xb1, 0xeb, 0xf7,
-    0xee, 0xeb, 0xfe, 0xfa, 0xee, 0xfa, 0xfc, 0xfc, 0xfe, 0xf9, 0xf5, 0xea,
-    0xe7, 0xe7, 0xea, 0xea, 0xdc, 0xca, 0xbb, 0xbe, 0xd3, 0xbe, 0x8c, 0x7f,
-    0x94, 0x97, 0xaa, 0x82, 0x7a, 0x94, 0xa6, 0xa6, 0x8c, 0xa2, 0xaa, 0x82,
-    0x97, 0x75, 0x6b, 0x91, 0x75, 0x4d, 0x50, 0x74, 0x58, 0x58, 0x50, 0x50,
-    0x75, 0x73, 0x73, 0xaf, 0xce, 0xce, 0xd9, 0xd5, 0xa6, 0x51, 0x0d, 0x0d,
-    0x21, 0x24, 0x21, 0x19, 0x19, 0x1e, 0x24, 0x24, 0x1f, 0x1f, 0x28, 0x1f,
-    0x14, 0x0a, 0x0a, 0x12, 0x1e, 0x2b, 0x1f, 0x1f, 0x1f, 0x45, 0x6c, 0x58,
-    0x43, 0x43, 0x44, 0x2c, 0x23, 0x2c, 0x37, 0x3a, 0x37, 0x43, 0x58, 0x58,
-    0x50, 0x2e, 0x29, 0x29, 0x27, 0x27, 0x2e, 0x3e, 0x3e, 0x27, 0x27, 0x2b,
-    0x1f, 0x1b, 0x0d, 0x0b, 0x0c, 0x13, 0x12, 0x12, 0x19, 0x19, 0x19, 0x1c,
-    0x12, 0x13, 0x0b, 0x06, 0x0b, 0x15, 0x12, 0x1e, 0x31, 0x2a, 0x28, 0x2e,
-    0x45, 0x55, 0x54, 0x54, 0x54, 0x5e, 0x53, 0x44, 0x47, 0x3e, 0x2e, 0x56,
-    0x4e, 0x1f, 0x2b, 0x2a, 0x21, 0x1c, 0x12, 0x0c, 0x05, 0x02, 0x02, 0x03,
-    0x0a, 0x12, 0x1e, 0x28, 0x28, 0x2d, 0x28, 0x1e, 0x10, 0x13, 0x13, 0x15,
-    0x0c, 0x08, 0x06, 0x0b, 0x0b, 0x0a, 0x1c, 0x2a, 0x40, 0x4e, 0x4e, 0x3d,
-    0x3e, 0x2d, 0x1d, 0x1a, 0x1e, 0x1d, 0x2d, 0x45, 0x51, 0x51, 0x54, 0x4d,
-    0x39, 0x43, 0x39, 0x43, 0x50, 0x4d, 0x46, 0x29, 0x1a, 0x1b, 0x14, 0x0a,
-    0x64, 0x86, 0x75, 0x44, 0x6b, 0x94, 0xa6, 0xad, 0xad, 0xa6, 0xa6, 0x96,
-    0x73, 0x73, 0xa3, 0x73, 0x8e, 0x8e, 0xbf, 0xc8, 0xd5, 0xb6, 0xa7, 0x8a,
-    0xa7, 0xa6, 0x96, 0x96, 0x94, 0xa6, 0xc8, 0xc8, 0xd8, 0xea, 0xdc, 0xdc,
-    0xe1, 0xf0, 0xe4, 0xe4, 0xe3, 0xb4, 0x64, 0x78, 0x78, 0x7a, 0x77, 0x64,
-    0x4c, 0x33, 0x1e, 0x1b, 0x21, 0x1f, 0x1b, 0x1a, 0x2e, 0x3e, 0x2d, 0x2e,
-    0x3e, 0x3e, 0x3e, 0x47, 0x4a, 0x40, 0x1e, 0x10, 0x07, 0x0a, 0x0d, 0x0d,
-    0x19, 0x24, 0x2b, 0x29, 0x2e, 0x46, 0x50, 0x58, 0x63, 0x6c, 0x72, 0x85,
-    0xa2, 0xaf, 0xb6, 0xa5, 0xa6, 0x88, 0xb1, 0xe9, 0xe7, 0xde, 0xb6, 0xa6,
-    0x84, 0x58, 0x44, 0x69, 0xd1, 0xdf, 0xea, 0xe6, 0xc8, 0xc8, 0xb6, 0xa5,
-    0x94, 0x7f, 0x50, 0x44, 0x6c, 0xa2, 0xce, 0xe7, 0xea, 0xee, 0xfc, 0xfa,
-    0xf9, 0xfa, 0xfe, 0xfe, 0xfa, 0xf9, 0xf6, 0xea, 0xea, 0xed, 0xe9, 0xdd,
-    0xdc, 0xca, 0xaa, 0xac, 0xb4, 0xae, 0x9a, 0x85, 0x75, 0x84, 0x97, 0x91,
-    0xb4, 0x8c, 0x7f, 0x85, 0x93, 0xaa, 0xb8, 0x7f, 0x71, 0x6b, 0x9f, 0xa0,
-    0xa2, 0x6c, 0x58, 0x50, 0x43, 0x50, 0x46, 0x32, 0x58, 0x63, 0x91, 0xbe,
-    0xbc, 0xc6, 0xce, 0xc6, 0xa6, 0x58, 0x1b, 0x14, 0x1f, 0x2f, 0x2f, 0x21,
-    0x19, 0x14, 0x14, 0x1c, 0x14, 0x14, 0x1b, 0x1b, 0x12, 0x0a, 0x0a, 0x21,
-    0x2b, 0x1f, 0x1f, 0x2b, 0x2b, 0x28, 0x2e, 0x2e, 0x3a, 0x3a, 0x50, 0x37,
-    0x44, 0x37, 0x44, 0x2c, 0x37, 0x2c, 0x2c, 0x2c, 0x27, 0x1f, 0x2b, 0x2e,
-    0x2e, 0x47, 0x2e, 0x3a, 0x2e, 0x2e, 0x2e, 0x2e, 0x2f, 0x1e, 0x13, 0x0b,
-    0x0c, 0x12, 0x1c, 0x1b, 0x19, 0x19, 0x19, 0x1c, 0x12, 0x12, 0x0c, 0x08,
-    0x15, 0x21, 0x1e, 0x33, 0x2d, 0x2d, 0x3d, 0x2e, 0x30, 0x47, 0x44, 0x47,
-    0x47, 0x46, 0x37, 0x53, 0x4c, 0x36, 0x3e, 0x47, 0x2d, 0x1f, 0x1f, 0x2a,
-    0x22, 0x1c, 0x0c, 0x08, 0x03, 0x00, 0x00, 0x06, 0x12, 0x1e, 0x2d, 0x2d,
-    0x30, 0x3d, 0x28, 0x20, 0x20, 0x1c, 0x12, 0x15, 0x15, 0x0b, 0x09, 0x0b,
-    0x0a, 0x1c, 0x1e, 0x2d, 0x48, 0x48, 0x4e, 0x48, 0x48, 0x2d, 0x1d, 0x1e,
-    0x14, 0x0a, 0x14, 0x3d, 0x45, 0x51, 0x46, 0x44, 0x44, 0x50, 0x46, 0x3a,
-    0x3a, 0x46, 0x36, 0x1f, 0x1f, 0x1d, 0x48, 0x55, 0x85, 0x75, 0x75, 0x5a,
-    0x74, 0x7f, 0x94, 0x8e, 0x8e, 0x8e, 0x7f, 0x96, 0x58, 0x73, 0x84, 0x73,
-    0x66, 0x96, 0xa7, 0xa9, 0xa9, 0xa9, 0x8a, 0x76, 0x76, 0xa6, 0x97, 0xac,
-    0xbb, 0xa6, 0xa7, 0xc8, 0xc8, 0xda, 0xd7, 0xd7, 0xdc, 0xe0, 0xd1, 0xce,
-    0xf0, 0xf2, 0xd4, 0xb4, 0x9d, 0x87, 0x86, 0x77, 0x64, 0x49, 0x2a, 0x1b,
-    0x19, 0x1a, 0x14, 0x1a, 0x27, 0x3e, 0x3e, 0x3a, 0x51, 0x54, 0x55, 0x5e,
-    0x51, 0x47, 0x2e, 0x28, 0x1c, 0x08, 0x07, 0x07, 0x1f, 0x2b, 0x36, 0x36,
-    0x46, 0x54, 0x58, 0x6b, 0x6b, 0x58, 0x58, 0x58, 0x58, 0x85, 0xa2, 0xb1,
-    0xc6, 0xa5, 0xcf, 0xee, 0xed, 0xde, 0xb6, 0x94, 0x7f, 0x68, 0x44, 0x7d,
-    0xd1, 0xdc, 0xea, 0xe7, 0xde, 0xc5, 0xab, 0x9c, 0x76, 0x57, 0x32, 0x30,
-    0x53, 0x74, 0x8c, 0xd5, 0xd9, 0xe1, 0xf3, 0xf8, 0xf8, 0xfa, 0xf9, 0xf9,
-    0xed, 0xea, 0xe7, 0xd9, 0xde, 0xd9, 0xca, 0xca, 0xca, 0xa5, 0xac, 0xa3,
-    0x91, 0x86, 0x71, 0x8c, 0xb4, 0xa0, 0x85, 0xa2, 0xb2, 0xa2, 0x82, 0x72,
-    0x68, 0x93, 0x94, 0x71, 0x73, 0x91, 0xbb, 0xce, 0xaa, 0xac, 0x77, 0x3a,
-    0x46, 0x46, 0x3e, 0x47, 0x54, 0x6b, 0xa3, 0x97, 0xa6, 0xa6, 0xaf, 0xb6,
-    0x94, 0x73, 0x47, 0x40, 0x2e, 0x3e, 0x3a, 0x2e, 0x2a, 0x40, 0x2d, 0x1e,
-    0x19, 0x12, 0x12, 0x0d, 0x08, 0x08, 0x0c, 0x1e, 0x2b, 0x28, 0x2d, 0x2e,
-    0x27, 0x27, 0x1d, 0x1a, 0x3e, 0x54, 0x54, 0x5a, 0x58, 0x50, 0x44, 0x44,
-    0x44, 0x2c, 0x2e, 0x28, 0x1f, 0x1f, 0x2b, 0x27, 0x2e, 0x47, 0x3e, 0x46,
-    0x36, 0x36, 0x2e, 0x2e, 0x1f, 0x1b, 0x13, 0x0c, 0x0a, 0x12, 0x1c, 0x1b,
-    0x21, 0x1e, 0x1e, 0x21, 0x19, 0x12, 0x0b, 0x0b, 0x15, 0x22, 0x33, 0x33,
-    0x33, 0x2d, 0x3d, 0x47, 0x53, 0x3e, 0x30, 0x55, 0x47, 0x51, 0x45, 0x45,
-    0x47, 0x40, 0x40, 0x2e, 0x2d, 0x2d, 0x2b, 0x1e, 0x20, 0x22, 0x13, 0x08,
-    0x03, 0x02, 0x02, 0x0a, 0x14, 0x1d, 0x2d, 0x3d, 0x3d, 0x30, 0x2d, 0x34,
-    0x20, 0x1b, 0x12, 0x1c, 0x13, 0x0c, 0x0c, 0x13, 0x0a, 0x1b, 0x28, 0x3e,
-    0x46, 0x55, 0x5e, 0x69, 0x69, 0x3d, 0x2f, 0x2b, 0x1a, 0x14, 0x1c, 0x2b,
-    0x2e, 0x30, 0x45, 0x44, 0x44, 0x54, 0x3e, 0x27, 0x2e, 0x28, 0x1a, 0x1a,
-    0x2f, 0x56, 0x9f, 0x91, 0xac, 0xa3, 0x91, 0x75, 0x74, 0x74, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x73, 0x73, 0x68, 0x94, 0x96, 0x96, 0x7f, 0x8a, 0x8a, 0x8a,
-    0x8a, 0xa6, 0x7f, 0x83, 0x66, 0x76, 0x96, 0xaf, 0xb6, 0xb6, 0xb6, 0xd7,
-    0xdc, 0xdc, 0xdc, 0xc8, 0xd7, 0xd9, 0xd9, 0xdf, 0xdc, 0xe1, 0xe3, 0xee,
-    0xd4, 0xa0, 0x87, 0x7d, 0x7d, 0x67, 0x49, 0x1e, 0x19, 0x19, 0x14, 0x1d,
-    0x27, 0x3e, 0x3e, 0x37, 0x44, 0x54, 0x5a, 0x6c, 0x5e, 0x47, 0x47, 0x3d,
-    0x2a, 0x13, 0x0a, 0x0a, 0x1f, 0x36, 0x36, 0x46, 0x5a, 0x6b, 0x74, 0x74,
-    0x6b, 0x6b, 0x58, 0x58, 0x51, 0x64, 0xb2, 0xe1, 0xdc, 0xc6, 0xce, 0xe1,
-    0xea, 0xde, 0xa7, 0x8a, 0x7c, 0x66, 0x42, 0x87, 0xd1, 0xe0, 0xea, 0xe7,
-    0xd8, 0xbf, 0x89, 0x8e, 0x7c, 0x57, 0x2c, 0x23, 0x45, 0x6b, 0x72, 0x82,
-    0xd2, 0xf3, 0xfc, 0xfa, 0xf3, 0xf8, 0xea, 0xe7, 0xde, 0xdb, 0xc8, 0xc5,
-    0xc5, 0xad, 0xad, 0xa6, 0xa6, 0xaa, 0xa2, 0x8c, 0x85, 0x9f, 0x86, 0x85,
-    0x6b, 0x85, 0xaa, 0xbb, 0xb1, 0xa8, 0xaa, 0x86, 0x74, 0x7f, 0x71, 0x74,
-    0x86, 0xa3, 0xbb, 0xca, 0xc6, 0xaf, 0xaa, 0x75, 0x3a, 0x1d, 0x29, 0x36,
-    0x5e, 0x50, 0x63, 0x83, 0x8e, 0x94, 0x94, 0x94, 0x71, 0x57, 0x50, 0x3a,
-    0x46, 0x54, 0x43, 0x46, 0x5e, 0x55, 0x2e, 0x1f, 0x10, 0x0d, 0x0a, 0x0c,
-    0x05, 0x02, 0x0b, 0x2a, 0x40, 0x3d, 0x3e, 0x2e, 0x27, 0x27, 0x27, 0x28,
-    0x47, 0x61, 0x63, 0x75, 0x6b, 0x58, 0x50, 0x50, 0x37, 0x2e, 0x2d, 0x1f,
-    0x1e, 0x28, 0x2b, 0x2f, 0x47, 0x46, 0x3a, 0x55, 0x46, 0x4a, 0x40, 0x2f,
-    0x1e, 0x12, 0x13, 0x0c, 0x13, 0x12, 0x1c, 0x2a, 0x1e, 0x2b, 0x1f, 0x1f,
-    0x21, 0x1c, 0x0b, 0x06, 0x1c, 0x20, 0x2a, 0x31, 0x3d, 0x3d, 0x3e, 0x47,
-    0x47, 0x47, 0x3e, 0x47, 0x47, 0x47, 0x45, 0x37, 0x47, 0x4a, 0x2b, 0x2d,
-    0x3d, 0x2f, 0x2b, 0x20, 0x20, 0x1c, 0x1c, 0x09, 0x06, 0x02, 0x03, 0x12,
-    0x1f, 0x28, 0x2d, 0x3d, 0x30, 0x30, 0x47, 0x2d, 0x1d, 0x14, 0x12, 0x1c,
-    0x12, 0x13, 0x0c, 0x08, 0x13, 0x1e, 0x2d, 0x37, 0x5a, 0x61, 0x5a, 0x61,
-    0x55, 0x47, 0x36, 0x1f, 0x1a, 0x1b, 0x0d, 0x0a, 0x1e, 0x28, 0x45, 0x30,
-    0x46, 0x2e, 0x1d, 0x2e, 0x40, 0x2f, 0x1b, 0x1e, 0x4c, 0x85, 0xa2, 0xaa,
-    0xa6, 0x96, 0x97, 0x8c, 0x50, 0x50, 0x74, 0x6b, 0x71, 0x58, 0x63, 0x63,
-    0x7f, 0xa5, 0xbb, 0xa5, 0x94, 0x71, 0x94, 0x8e, 0x94, 0xce, 0xae, 0x9f,
-    0x58, 0x6b, 0xaf, 0xa6, 0xa7, 0xc8, 0xa7, 0xc8, 0xde, 0xd9, 0xca, 0xc8,
-    0xde, 0xd9, 0xd5, 0xca, 0xc8, 0xca, 0xd5, 0xe1, 0xe4, 0xd2, 0xb4, 0x9d,
-    0x7d, 0x64, 0x48, 0x2a, 0x1e, 0x1e, 0x1e, 0x2b, 0x2e, 0x47, 0x47, 0x44,
-    0x51, 0x51, 0x58, 0x74, 0x75, 0x6f, 0x6f, 0x56, 0x2a, 0x1c, 0x12, 0x12,
-    0x2b, 0x4a, 0x55, 0x61, 0x74, 0x74, 0x84, 0x84, 0x74, 0x6b, 0x58, 0x5a,
-    0x53, 0x7d, 0xd2, 0xee, 0xdc, 0xb8, 0xb5, 0xc6, 0xd5, 0xc8, 0xa7, 0x8a,
-    0x7c, 0x5b, 0x4b, 0x77, 0xcf, 0xdc, 0xe7, 0xd8, 0xc5, 0xa4, 0x89, 0x76,
-    0x70, 0x57, 0x2c, 0x23, 0x37, 0x50, 0x4b, 0x60, 0xf2, 0xfc, 0xfc, 0xfa,
-    0xf3, 0xf3, 0xee, 0xdf, 0xca, 0xc8, 0xc5, 0xad, 0x8e, 0x8e, 0x94, 0x96,
-    0x97, 0x84, 0x86, 0x85, 0x74, 0x7a, 0x8c, 0xb2, 0x72, 0x74, 0xa2, 0xbb,
-    0xcc, 0xa5, 0xaa, 0x9f, 0x9f, 0x75, 0x74, 0x50, 0x8c, 0xac, 0xbb, 0xce,
-    0xdd, 0xc6, 0x94, 0x74, 0x6f, 0x2a, 0x14, 0x4a, 0x6f, 0x4d, 0x50, 0x6b,
-    0x66, 0x83, 0x83, 0x71, 0x68, 0x58, 0x46, 0x3e, 0x46, 0x50, 0x50, 0x58,
-    0x5a, 0x54, 0x47, 0x2a, 0x1c, 0x0a, 0x08, 0x05, 0x02, 0x03, 0x1c, 0x33,
-    0x47, 0x47, 0x47, 0x47, 0x2e, 0x3e, 0x27, 0x27, 0x47, 0x61, 0x58, 0x6b,
-    0x6b, 0x57, 0x4b, 0x50, 0x44, 0x2e, 0x2b, 0x19, 0x19, 0x1e, 0x2b, 0x3d,
-    0x47, 0x47, 0x46, 0x46, 0x4d, 0x46, 0x4c, 0x33, 0x22, 0x13, 0x0b, 0x0b,
-    0x0b, 0x1c, 0x1e, 0x1e, 0x1f, 0x28, 0x2b, 0x1f, 0x1e, 0x1c, 0x0c, 0x06,
-    0x1c, 0x49, 0x49, 0x56, 0x53, 0x48, 0x3e, 0x3e, 0x47, 0x3d, 0x27, 0x27,
-    0x3d, 0x47, 0x2e, 0x2e, 0x2d, 0x2d, 0x2b, 0x1f, 0x2b, 0x2d, 0x2a, 0x1c,
-    0x1b, 0x1e, 0x22, 0x15, 0x09, 0x03, 0x0b, 0x20, 0x2d, 0x3e, 0x45, 0x45,
-    0x30, 0x45, 0x47, 0x3e, 0x1d, 0x1b, 0x1c, 0x12, 0x12, 0x13, 0x0b, 0x05,
-    0x0a, 0x2a, 0x30, 0x44, 0x58, 0x6c, 0x6b, 0x63, 0x54, 0x46, 0x36, 0x1f,
-    0x1b, 0x14, 0x0d, 0x12, 0x2a, 0x1d, 0x28, 0x47, 0x36, 0x1f, 0x10, 0x1b,
-    0x2f, 0x2b, 0x2b, 0x40, 0x54, 0x84, 0xaf, 0xa6, 0xb6, 0xa6, 0xaf, 0x91,
-    0x44, 0x44, 0x30, 0x50, 0x58, 0x50, 0x50, 0x83, 0xa6, 0xd5, 0xd9, 0xaf,
-    0x7f, 0x83, 0xa6, 0xc6, 0xca, 0xe0, 0xb7, 0xa3, 0x7b, 0x86, 0x91, 0x8a,
-    0xad, 0x89, 0x8a, 0x8a, 0xc5, 0xc8, 0xc8, 0xce, 0xc6, 0xd5, 0xca, 0xc8,
-    0xcd, 0xc8, 0xca, 0xdd, 0xe1, 0xdd, 0xd2, 0xb4, 0x9d, 0x67, 0x3d, 0x28,
-    0x28, 0x2b, 0x40, 0x2d, 0x2e, 0x46, 0x54, 0x51, 0x75, 0x75, 0x6b, 0x6b,
-    0x75, 0x77, 0x64, 0x56, 0x33, 0x1e, 0x19, 0x14, 0x36, 0x4a, 0x6f, 0x84,
-    0x97, 0x97, 0x97, 0x84, 0x74, 0x6b, 0x58, 0x51, 0x56, 0xa0, 0xe1, 0xeb,
-    0xdc, 0xb8, 0xa5, 0x94, 0xa5, 0xa6, 0x9c, 0x88, 0x7c, 0x57, 0x4b, 0x6c,
-    0xae, 0xc6, 0xca, 0xbf, 0xa9, 0x89, 0x76, 0x5c, 0x5b, 0x57, 0x32, 0x2c,
-    0x37, 0x32, 0x42, 0x9d, 0xfc, 0xfa, 0xf9, 0xf7, 0xf9, 0xf3, 0xed, 0xd9,
-    0xca, 0xc8, 0xa6, 0x94, 0x94, 0x8c, 0x83, 0x74, 0x85, 0x86, 0x86, 0x9d,
-    0x8c, 0x58, 0x72, 0xa2, 0x8c, 0x6b, 0x82, 0x97, 0xa5, 0x94, 0x71, 0x7f,
-    0x8c, 0x72, 0x43, 0x54, 0x86, 0x91, 0xaf, 0xc6, 0xbc, 0xca, 0x96, 0x74,
-    0x7b, 0x4e, 0x28, 0x4a, 0x54, 0x46, 0x39, 0x50, 0x50, 0x58, 0x57, 0x57,
-    0x51, 0x3a, 0x46, 0x54, 0x44, 0x50, 0x6c, 0x86, 0x75, 0x77, 0x78, 0x64,
-    0x31, 0x12, 0x08, 0x05, 0x02, 0x03, 0x22, 0x48, 0x45, 0x47, 0x55, 0x46,
-    0x2c, 0x30, 0x23, 0x23, 0x2e, 0x51, 0x50, 0x6b, 0x74, 0x6b, 0x50, 0x43,
-    0x2d, 0x1b, 0x1c, 0x0d, 0x12, 0x13, 0x1c, 0x2d, 0x3e, 0x46, 0x51, 0x46,
-    0x46, 0x46, 0x3e, 0x2f, 0x1c, 0x0b, 0x06, 0x0b, 0x13, 0x1c, 0x1e, 0x1f,
-    0x2b, 0x2b, 0x2b, 0x28, 0x1f, 0x1c, 0x0b, 0x08, 0x49, 0xa2, 0xb1, 0xbb,
-    0xaa, 0x8c, 0x77, 0x45, 0x30, 0x30, 0x3d, 0x1e, 0x28, 0x2e, 0x28, 0x1d,
-    0x28, 0x2d, 0x33, 0x20, 0x1e, 0x2a, 0x22, 0x1c, 0x1c, 0x1c, 0x16, 0x0d,
-    0x0b, 0x06, 0x0c, 0x1e, 0x2d, 0x30, 0x56, 0x6e, 0x4f, 0x48, 0x47, 0x3e,
-    0x1f, 0x1e, 0x1c, 0x12, 0x16, 0x0c, 0x08, 0x08, 0x13, 0x2a, 0x2e, 0x50,
-    0x77, 0x91, 0x75, 0x58, 0x61, 0x3e, 0x27, 0x1f, 0x1b, 0x0d, 0x0d, 0x13,
-    0x12, 0x19, 0x1b, 0x1e, 0x1f, 0x1b, 0x1e, 0x33, 0x2f, 0x36, 0x2d, 0x2e,
-    0x5a, 0x71, 0x8e, 0xb6, 0xbc, 0xaf, 0xaf, 0x91, 0x7e, 0x4a, 0x1a, 0x56,
-    0x5e, 0x6f, 0x5a, 0x84, 0xa6, 0xb6, 0xb6, 0xa6, 0x94, 0x96, 0x8e, 0xb6,
-    0xb6, 0xc8, 0xaf, 0x94, 0x97, 0x63, 0x75, 0x84, 0x94, 0xaa, 0xaa, 0xbc,
-    0xce, 0xc6, 0xd9, 0xd1, 0xbc, 0xa6, 0xb6, 0xb3, 0xc8, 0xd5, 0xe0, 0xdf,
-    0xe0, 0xdd, 0xe1, 0xb2, 0xa0, 0x80, 0x34, 0x34, 0x2a, 0x1d, 0x2d, 0x2e,
-    0x23, 0x37, 0x44, 0x42, 0x6c, 0x86, 0x75, 0x72, 0x72, 0x86, 0x78, 0x64,
-    0x49, 0x2b, 0x1e, 0x14, 0x4a, 0x5e, 0x7b, 0xa3, 0xa3, 0xaf, 0x97, 0x84,
-    0x84, 0x6b, 0x58, 0x51, 0x56, 0xb4, 0xe3, 0xeb, 0xdc, 0xc9, 0xb5, 0x94,
-    0x94, 0x88, 0x70, 0x70, 0x68, 0x58, 0x4b, 0x6c, 0x82, 0x93, 0xa5, 0x9c,
-    0x8a, 0x76, 0x5c, 0x5b, 0x57, 0x57, 0x44, 0x45, 0x46, 0x37, 0x48, 0xe5,
-    0xfc, 0xfa, 0xfc, 0xfc, 0xfa, 0xee, 0xee, 0xd9, 0xd5, 0xa6, 0xa3, 0x97,
-    0x71, 0x71, 0x75, 0x75, 0x74, 0xa0, 0x77, 0x77, 0x7a, 0x58, 0x72, 0x9f,
-    0xb4, 0x9f, 0x74, 0x74, 0x71, 0x71, 0x72, 0x8c, 0x8c, 0x7a, 0x6c, 0x55,
-    0x75, 0x84, 0x96, 0xa6, 0xa6, 0x94, 0x73, 0x50, 0x6f, 0x7e, 0x78, 0x7e,
-    0x46, 0x2e, 0x39, 0x50, 0x50, 0x58, 0x58, 0x50, 0x37, 0x27, 0x3a, 0x4d,
-    0x44, 0x61, 0x86, 0x86, 0x75, 0x85, 0x75, 0x6c, 0x30, 0x1e, 0x05, 0x02,
-    0x02, 0x03, 0x1c, 0x40, 0x47, 0x51, 0x54, 0x44, 0x37, 0x45, 0x23, 0x28,
-    0x27, 0x23, 0x30, 0x51, 0x51, 0x51, 0x37, 0x27, 0x14, 0x0d, 0x12, 0x0d,
-    0x0d, 0x12, 0x10, 0x2a, 0x3d, 0x47, 0x46, 0x47, 0x4a, 0x36, 0x2b, 0x1c,
-    0x0b, 0x05, 0x06, 0x11, 0x13, 0x12, 0x1c, 0x1e, 0x2b, 0x2b, 0x2b, 0x28,
-    0x1e, 0x12, 0x07, 0x81, 0xbb, 0xd5, 0xdc, 0xdc, 0xc6, 0xaa, 0xa2, 0x7d,
-    0x49, 0x48, 0x56, 0x56, 0x3d, 0x2d, 0x28, 0x2b, 0x1e, 0x2a, 0x35, 0x20,
-    0x1b, 0x1e, 0x12, 0x13, 0x12, 0x16, 0x15, 0x0c, 0x08, 0x08, 0x08, 0x12,
-    0x1f, 0x2e, 0x56, 0x6a, 0x67, 0x48, 0x3e, 0x2f, 0x2a, 0x20, 0x1c, 0x16,
-    0x15, 0x0c, 0x09, 0x06, 0x0a, 0x1e, 0x2e, 0x44, 0x61, 0x61, 0x63, 0x4d,
-    0x46, 0x47, 0x2e, 0x1e, 0x19, 0x12, 0x0a, 0x08, 0x07, 0x07, 0x08, 0x07,
-    0x1e, 0x2a, 0x4c, 0x5e, 0x54, 0x47, 0x2d, 0x2d, 0x44, 0x7f, 0x94, 0xb6,
-    0xb6, 0xb3, 0x96, 0x84, 0x75, 0x3a, 0x1d, 0x48, 0x81, 0x9f, 0x9f, 0x97,
-    0x7f, 0x94, 0x94, 0x84, 0x96, 0x8e, 0xad, 0xc5, 0xca, 0xd9, 0xca, 0x8e,
-    0x83, 0x7b, 0x7b, 0x7b, 0x83, 0xaf, 0xaf, 0xac, 0xbe, 0xd1, 0xd2, 0xbe,
-    0xac, 0xbc, 0xaf, 0xb6, 0xc8, 0xd9, 0xd3, 0xd3, 0xe3, 0xf0, 0xe4, 0xb4,
-    0xa0, 0x7d, 0x4e, 0x34, 0x1e, 0x1a, 0x1d, 0x27, 0x2e, 0x37, 0x37, 0x43,
-    0x5a, 0x75, 0x86, 0x86, 0x8c, 0x9a, 0x87, 0x7d, 0x49, 0x2a, 0x1b, 0x1b,
-    0x4a, 0x7b, 0x91, 0xac, 0xbc, 0xaf, 0x96, 0x7f, 0x7f, 0x6b, 0x58, 0x51,
-    0x45, 0xa0, 0xd1, 0xea, 0xd7, 0xc9, 0xab, 0x9c, 0x8a, 0x70, 0x5b, 0x5b,
-    0x57, 0x57, 0x6b, 0x72, 0x71, 0x68, 0x72, 0x7f, 0x71, 0x70, 0x68, 0x4b,
-    0x42, 0x37, 0x30, 0x56, 0x55, 0x3e, 0x80, 0xfc, 0xfe, 0xfa, 0xfc, 0xfc,
-    0xfa, 0xf9, 0xee, 0xdf, 0xb6, 0x96, 0xa3, 0x83, 0x6b, 0x74, 0x63, 0x85,
-    0x58, 0x75, 0x6c, 0x51, 0x78, 0x87, 0x75, 0x85, 0x86, 0x5a, 0x51, 0x6c,
-    0x43, 0x4b, 0x72, 0xa2, 0xa2, 0x82, 0xa3, 0x77, 0x50, 0x58, 0x6b, 0x71,
-    0x7f, 0x71, 0x58, 0x43, 0x75, 0x7b, 0x75, 0x74, 0x46, 0x27, 0x37, 0x43,
-    0x37, 0x37, 0x43, 0x37, 0x2e, 0x27, 0x27, 0x46, 0x51, 0x75, 0x77, 0x85,
-    0x8c, 0x8c, 0x7f, 0x72, 0x51, 0x1a, 0x0a, 0x06, 0x03, 0x05, 0x0c, 0x33,
-    0x47, 0x51, 0x51, 0x44, 0x44, 0x45, 0x2d, 0x28, 0x2a, 0x1b, 0x1b, 0x1c,
-    0x12, 0x13, 0x0a, 0x0d, 0x0a, 0x0c, 0x12, 0x12, 0x12, 0x10, 0x1c, 0x3d,
-    0x54, 0x5e, 0x55, 0x55, 0x4c, 0x40, 0x2b, 0x22, 0x08, 0x06, 0x06, 0x06,
-    0x0b, 0x13, 0x1c, 0x1e, 0x1e, 0x2a, 0x2a, 0x1e, 0x1e, 0x20, 0x4e, 0xbc,
-    0xca, 0xd5, 0xd5, 0xd5, 0xca, 0xbb, 0xa3, 0xa0, 0x64, 0x48, 0x48, 0x56,
-    0x3d, 0x2d, 0x2b, 0x35, 0x21, 0x1b, 0x2a, 0x2a, 0x2b, 0x2a, 0x1c, 0x12,
-    0x12, 0x12, 0x16, 0x0c, 0x08, 0x09, 0x09, 0x03, 0x08, 0x2b, 0x56, 0x6a,
-    0x56, 0x47, 0x2d, 0x33, 0x22, 0x22, 0x1c, 0x15, 0x0c, 0x08, 0x05, 0x02,
-    0x05, 0x1c, 0x2b, 0x3a, 0x54, 0x4d, 0x4d, 0x46, 0x46, 0x2e, 0x28, 0x1a,
-    0x19, 0x19, 0x0d, 0x08, 0x08, 0x07, 0x05, 0x07, 0x2d, 0x3e, 0x5e, 0x63,
-    0x75, 0x75, 0x6f, 0x61, 0x43, 0x6b, 0x7f, 0x94, 0x8e, 0x8e, 0x83, 0x58,
-    0x58, 0x30, 0x3d, 0xa0, 0xae, 0xac, 0xaa, 0x84, 0x84, 0x82, 0x82, 0x74,
-    0x96, 0x8e, 0x8e, 0xad, 0xc8, 0xca, 0xb6, 0x8e, 0x84, 0x9f, 0xa1, 0x98,
-    0x7f, 0xa6, 0xaf, 0xaf, 0x96, 0xa6, 0xb0, 0x98, 0x98, 0x91, 0x98, 0x8e,
-    0xb3, 0xca, 0xd0, 0xd0, 0xe0, 0xee, 0xe4, 0xd2, 0x7d, 0x53, 0x2d, 0x1b,
-    0x14, 0x1b, 0x1d, 0x30, 0x47, 0x30, 0x37, 0x5a, 0x75, 0x85, 0x85, 0x8c,
-    0x9a, 0x9a, 0xa0, 0x81, 0x4e, 0x1e, 0x1e, 0x1d, 0x54, 0x75, 0x91, 0xac,
-    0xbb, 0xa6, 0x94, 0x7f, 0x71, 0x6b, 0x50, 0x51, 0x44, 0x53, 0x9f, 0xbc,
-    0xc6, 0xb6, 0xa6, 0x94, 0x8a, 0x70, 0x7c, 0x7c, 0x7f, 0x70, 0x7f, 0x82,
-    0x70, 0x4b, 0x42, 0x58, 0x4b, 0x4b, 0x42, 0x42, 0x32, 0x23, 0x1d, 0x40,
-    0x48, 0x2d, 0xe5, 0xfe, 0xfa, 0xfa, 0xfe, 0xfa, 0xfa, 0xfa, 0xee, 0xe0,
-    0xb6, 0xb0, 0xa3, 0x83, 0x74, 0x91, 0x86, 0x6c, 0x58, 0x6c, 0x6c, 0x51,
-    0x60, 0x75, 0x6c, 0x75, 0x6c, 0x44, 0x44, 0x60, 0x5a, 0x4b, 0x6c, 0x82,
-    0x7f, 0x57, 0x77, 0x60, 0x37, 0x43, 0x6b, 0x6b, 0x58, 0x58, 0x51, 0x58,
-    0x73, 0x84, 0xac, 0x86, 0x75, 0x37, 0x37, 0x46, 0x37, 0x30, 0x27, 0x14,
-    0x1a, 0x1d, 0x27, 0x46, 0x58, 0x63, 0x74, 0x85, 0x84, 0x97, 0x97, 0x73,
-    0x4b, 0x28, 0x10, 0x0a, 0x05, 0x06, 0x0b, 0x1c, 0x3d, 0x44, 0x44, 0x44,
-    0x30, 0x30, 0x28, 0x1e, 0x13, 0x0b, 0x0b, 0x05, 0x02, 0x02, 0x03, 0x06,
-    0x0a, 0x12, 0x12, 0x1c, 0x1c, 0x2a, 0x61, 0x84, 0x84, 0x84, 0x91, 0x6f,
-    0x4c, 0x4c, 0x3e, 0x47, 0x40, 0x22, 0x13, 0x06, 0x06, 0x0b, 0x13, 0x10,
-    0x20, 0x1e, 0x1e, 0x1c, 0x22, 0x78, 0xa2, 0xc6, 0xd9, 0xd9, 0xd5, 0xca,
-    0xbc, 0xac, 0xa3, 0x9f, 0x60, 0x56, 0x48, 0x56, 0x3d, 0x28, 0x2a, 0x2a,
-    0x1b, 0x1c, 0x2a, 0x2d, 0x3d, 0x31, 0x20, 0x1b, 0x1e, 0x19, 0x1c, 0x0c,
-    0x09, 0x09, 0x09, 0x02, 0x02, 0x1c, 0x48, 0x56, 0x49, 0x3d, 0x33, 0x2a,
-    0x1e, 0x1c, 0x15, 0x0c, 0x09, 0x05, 0x02, 0x02, 0x06, 0x0c, 0x1c, 0x1d,
-    0x3a, 0x37, 0x3a, 0x36, 0x3e, 0x29, 0x2f, 0x1b, 0x19, 0x12, 0x12, 0x08,
-    0x05, 0x03, 0x02, 0x13, 0x2f, 0x47, 0x6f, 0x61, 0x75, 0x84, 0x74, 0x63,
-    0x3a, 0x46, 0x73, 0x73, 0x71, 0x66, 0x73, 0x63, 0x46, 0x3e, 0x87, 0x9a,
-    0xaf, 0xaf, 0xaf, 0x97, 0x84, 0x50, 0x6c, 0x6b, 0x84, 0x97, 0x94, 0xa6,
-    0xad, 0xad, 0x8e, 0x76, 0x71, 0x97, 0xae, 0xa3, 0x97, 0xa6, 0xb6, 0xb3,
-    0x8e, 0x94, 0xaa, 0x98, 0x98, 0x91, 0x98, 0x83, 0x8e, 0x96, 0xb3, 0xb3,
-    0xb0, 0xd0, 0xe0, 0xb4, 0x64, 0x48, 0x1e, 0x10, 0x14, 0x1d, 0x1d, 0x27,
-    0x30, 0x3e, 0x37, 0x44, 0x6b, 0x74, 0x82, 0x8c, 0xa2, 0x9a, 0x9f, 0x81,
-    0x4e, 0x1e, 0x1e, 0x1f, 0x54, 0x61, 0x91, 0xac, 0xbb, 0xa5, 0x94, 0x7f,
-    0x66, 0x57, 0x50, 0x44, 0x37, 0x30, 0x53, 0x77, 0x8c, 0x93, 0x94, 0x94,
-    0x88, 0x94, 0x93, 0xbb, 0xa5, 0x9c, 0x94, 0x94, 0x70, 0x4b, 0x42, 0x42,
-    0x32, 0x2c, 0x2c, 0x2c, 0x2c, 0x23, 0x1d, 0x2e, 0x3d, 0x3d, 0xe4, 0xf9,
-    0xf7, 0xfa, 0xfe, 0xfa, 0xfa, 0xfc, 0xf3, 0xee, 0xdf, 0xb0, 0x96, 0x83,
-    0x91, 0x85, 0x75, 0x58, 0x50, 0x77, 0x9d, 0x6c, 0x6b, 0x75, 0x87, 0x60,
-    0x51, 0x5a, 0x6c, 0x6c, 0x5a, 0x51, 0x50, 0x58, 0x68, 0x58, 0x75, 0x87,
-    0x60, 0x2c, 0x43, 0x50, 0x43, 0x51, 0x46, 0x61, 0x74, 0x97, 0xaa, 0xbb,
-    0x86, 0x5a, 0x37, 0x3a, 0x2e, 0x30, 0x27, 0x1d, 0x14, 0x1d, 0x27, 0x2e,
-    0x37, 0x63, 0x6b, 0x74, 0x73, 0x97, 0x97, 0x71, 0x4b, 0x1d, 0x0a, 0x0c,
-    0x08, 0x0b, 0x0c, 0x12, 0x1d, 0x3e, 0x3e, 0x2e, 0x27, 0x28, 0x1b, 0x07,
-    0x05, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 0x0c, 0x13, 0x1c, 0x1c,
-    0x28, 0x75, 0x97, 0xaf, 0xaf, 0x97, 0x97, 0x91, 0x7b, 0x61, 0x54, 0x54,
-    0x55, 0x40, 0x21, 0x0b, 0x06, 0x0b, 0x0c, 0x15, 0x0a, 0x13, 0x13, 0x0a,
-    0x34, 0xae, 0xbe, 0xd9, 0xce, 0xd9, 0xbc, 0xaf, 0xbe, 0x97, 0x97, 0x91,
-    0x6c, 0x78, 0x67, 0x56, 0x3d, 0x3d, 0x2a, 0x1b, 0x19, 0x22, 0x33, 0x3d,
-    0x3e, 0x2d, 0x1e, 0x1b, 0x21, 0x22, 0x1c, 0x0c, 0x0b, 0x09, 0x06, 0x00,
-    0x00, 0x0b, 0x33, 0x4e, 0x3d, 0x2f, 0x2a, 0x1e, 0x19, 0x0a, 0x08, 0x06,
-    0x03, 0x03, 0x02, 0x02, 0x03, 0x05, 0x0c, 0x1e, 0x28, 0x2e, 0x27, 0x2f,
-    0x2b, 0x1f, 0x1e, 0x12, 0x12, 0x0a, 0x0c, 0x08, 0x03, 0x05, 0x12, 0x2f,
-    0x5e, 0x75, 0x9f, 0x91, 0xb7, 0x84, 0x73, 0x6b, 0x3a, 0x30, 0x5a, 0x50,
-    0x58, 0x58, 0x58, 0x46, 0x29, 0x5e, 0x86, 0x97, 0xa6, 0xb6, 0xb0, 0x98,
-    0x75, 0x54, 0x37, 0x78, 0x87, 0xaa, 0x94, 0x8e, 0x8e, 0x8e, 0x8e, 0x73,
-    0xa3, 0xa6, 0xa6, 0x96, 0x94, 0x8e, 0x8e, 0x66, 0x76, 0x96, 0xa3, 0x91,
-    0x98, 0x98, 0x7b, 0x73, 0x66, 0x66, 0x66, 0x73, 0x83, 0xa6, 0xbc, 0x78,
-    0x64, 0x2f, 0x14, 0x10, 0x14, 0x1b, 0x1f, 0x1d, 0x27, 0x23, 0x37, 0x44,
-    0x50, 0x58, 0x72, 0x82, 0x8c, 0x9a, 0xa0, 0x81, 0x52, 0x1e, 0x1e, 0x1e,
-    0x44, 0x61, 0x86, 0xac, 0xaa, 0xa6, 0x94, 0x71, 0x57, 0x4b, 0x43, 0x43,
-    0x2c, 0x30, 0x30, 0x48, 0x56, 0x53, 0x6c, 0x84, 0x93, 0xa5, 0xc6, 0xdd,
-    0xd7, 0xb5, 0x9c, 0x94, 0x7c, 0x5b, 0x57, 0x57, 0x32, 0x2c, 0x23, 0x23,
-    0x23, 0x23, 0x27, 0x2c, 0x37, 0x30, 0xa0, 0xeb, 0xea, 0xf9, 0xfe, 0xfa,
-    0xfc, 0xf3, 0xf0, 0xfc, 0xe0, 0xce, 0xbc, 0x97, 0xa3, 0x85, 0x50, 0x43,
-    0x50, 0x58, 0x77, 0x50, 0x58, 0x81, 0xb4, 0x60, 0x51, 0x75, 0x87, 0x91,
-    0x75, 0x77, 0x51, 0x50, 0x50, 0x75, 0x85, 0x8c, 0x6c, 0x37, 0x37, 0x37,
-    0x2c, 0x47, 0x55, 0x78, 0x9f, 0xac, 0xaf, 0xbb, 0xaa, 0x75, 0x2c, 0x27,
-    0x27, 0x30, 0x2e, 0x30, 0x1b, 0x1a, 0x2c, 0x2e, 0x3a, 0x61, 0x58, 0x74,
-    0x73, 0x83, 0x71, 0x68, 0x43, 0x1b, 0x07, 0x08, 0x0b, 0x13, 0x12, 0x1c,
-    0x1b, 0x1e, 0x1d, 0x1a, 0x1b, 0x10, 0x0a, 0x08, 0x06, 0x03, 0x02, 0x00,
-    0x00, 0x02, 0x02, 0x03, 0x06, 0x15, 0x1c, 0x1e, 0x5e, 0xaa, 0xbc, 0xc6,
-    0xaf, 0xaf, 0xb0, 0x91, 0x7b, 0x6b, 0x73, 0x74, 0x63, 0x46, 0x55, 0x2a,
-    0x22, 0x1e, 0x1c, 0x22, 0x0a, 0x08, 0x06, 0x0b, 0x34, 0xbe, 0xbc, 0xca,
-    0xd5, 0xca, 0xa6, 0xaf, 0xbe, 0x83, 0x83, 0x85, 0x85, 0x87, 0x78, 0x56,
-    0x49, 0x33, 0x20, 0x2a, 0x1e, 0x2a, 0x2a, 0x28, 0x2d, 0x2a, 0x1c, 0x19,
-    0x20, 0x4f, 0x22, 0x3c, 0x35, 0x26, 0x0b, 0x02, 0x02, 0x0c, 0x20, 0x33,
-    0x2b, 0x2a, 0x1e, 0x1c, 0x1c, 0x08, 0x06, 0x05, 0x05, 0x03, 0x03, 0x03,
-    0x03, 0x05, 0x05, 0x13, 0x1e, 0x1e, 0x1e, 0x2b, 0x1e, 0x19, 0x19, 0x0a,
-    0x05, 0x05, 0x08, 0x05, 0x08, 0x1c, 0x2b, 0x3a, 0x6c, 0x85, 0xbe, 0xae,
-    0xb7, 0x91, 0x74, 0x75, 0x55, 0x3e, 0x2e, 0x27, 0x2e, 0x3a, 0x47, 0x3d,
-    0x4c, 0x5e, 0x5a, 0x72, 0xa6, 0xa6, 0x96, 0x83, 0x75, 0x55, 0x53, 0xb1,
-    0x8c, 0x85, 0x72, 0x7f, 0x83, 0x73, 0x7b, 0x7b, 0x97, 0x96, 0xbc, 0xaf,
-    0x7f, 0x71, 0x66, 0x66, 0x66, 0x8c, 0x85, 0x63, 0x83, 0x73, 0x66, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x66, 0x83, 0x74, 0x55, 0x3e, 0x20, 0x0a, 0x10,
-    0x14, 0x14, 0x1a, 0x1d, 0x2e, 0x23, 0x2c, 0x37, 0x43, 0x57, 0x74, 0x84,
-    0x8c, 0x8c, 0xa0, 0x6a, 0x33, 0x1e, 0x1e, 0x1b, 0x30, 0x54, 0x77, 0x91,
-    0x97, 0x96, 0x7f, 0x68, 0x57, 0x4b, 0x43, 0x43, 0x37, 0x30, 0x30, 0x31,
-    0x34, 0x31, 0x3d, 0x51, 0x7a, 0xa2, 0xcf, 0xeb, 0xdc, 0xca, 0xab, 0x9c,
-    0x7c, 0x5b, 0x68, 0x57, 0x42, 0x32, 0x2c, 0x23, 0x23, 0x2c, 0x37, 0x42,
-    0x42, 0x51, 0x5a, 0xaa, 0xdc, 0xf9, 0xf9, 0xed, 0xfa, 0xf9, 0xfa, 0xf3,
-    0xee, 0xe3, 0xce, 0x94, 0x71, 0x6b, 0x50, 0x46, 0x61, 0x77, 0x77, 0x4b,
-    0x50, 0x64, 0x7d, 0x53, 0x4b, 0x75, 0x8c, 0x8c, 0x6b, 0x60, 0x37, 0x37,
-    0x50, 0x75, 0x8c, 0x8c, 0x58, 0x51, 0x44, 0x47, 0x27, 0x3a, 0x61, 0x77,
-    0xa3, 0x97, 0xaf, 0xaf, 0x93, 0x75, 0x30, 0x27, 0x27, 0x3e, 0x46, 0x51,
-    0x55, 0x3e, 0x3e, 0x2e, 0x2e, 0x46, 0x58, 0x6b, 0x58, 0x66, 0x57, 0x42,
-    0x2e, 0x0d, 0x08, 0x08, 0x0c, 0x12, 0x1e, 0x2a, 0x2b, 0x2b, 0x1d, 0x1d,
-    0x1b, 0x10, 0x12, 0x0c, 0x08, 0x05, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02,
-    0x03, 0x0b, 0x1c, 0x2a, 0x85, 0xaf, 0xca, 0xca, 0xb6, 0xaf, 0x96, 0x98,
-    0x84, 0x84, 0x83, 0x73, 0x73, 0x58, 0x61, 0x55, 0x4a, 0x47, 0x3d, 0x2f,
-    0x1c, 0x05, 0x03, 0x6e, 0x49, 0xb2, 0xc6, 0xb6, 0xc8, 0xad, 0xaf, 0xbe,
-    0x96, 0x76, 0x7f, 0x7f, 0x82, 0x82, 0x60, 0x5e, 0x67, 0x33, 0x1e, 0x2a,
-    0x31, 0x28, 0x1b, 0x20, 0x22, 0x22, 0x22, 0x22, 0x4e, 0x8f, 0x9d, 0xb4,
-    0xb4, 0xb4, 0x9d, 0x3c, 0x06, 0x13, 0x22, 0x1e, 0x1e, 0x19, 0x22, 0x22,
-    0x15, 0x0b, 0x09, 0x06, 0x06, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x05,
-    0x15, 0x16, 0x12, 0x12, 0x16, 0x12, 0x16, 0x05, 0x02, 0x03, 0x08, 0x0a,
-    0x12, 0x12, 0x14, 0x3e, 0x91, 0x8c, 0xac, 0xac, 0xac, 0x91, 0x91, 0x7b,
-    0x5e, 0x29, 0x27, 0x1f, 0x1f, 0x1f, 0x2b, 0x80, 0x64, 0x51, 0x2c, 0x72,
-    0x7f, 0x96, 0x83, 0x73, 0x4d, 0x64, 0x7d, 0xa2, 0x8c, 0x85, 0x74, 0x74,
-    0x75, 0x58, 0x75, 0x74, 0x71, 0x94, 0xaf, 0x98, 0x73, 0x6b, 0x74, 0x73,
-    0x58, 0x9a, 0x87, 0x4d, 0x4d, 0x4d, 0x4d, 0x46, 0x39, 0x39, 0x39, 0x4a,
-    0x63, 0x74, 0x64, 0x40, 0x1e, 0x0d, 0x0a, 0x0a, 0x10, 0x14, 0x1a, 0x1d,
-    0x27, 0x23, 0x23, 0x37, 0x42, 0x4b, 0x72, 0x72, 0x8c, 0x86, 0x67, 0x34,
-    0x1e, 0x1b, 0x1b, 0x1c, 0x3a, 0x46, 0x54, 0x75, 0x83, 0x83, 0x73, 0x68,
-    0x4b, 0x50, 0x43, 0x44, 0x44, 0x45, 0x30, 0x3d, 0x34, 0x34, 0x31, 0x30,
-    0x45, 0x87, 0xe1, 0xe9, 0xe6, 0xca, 0xab, 0x88, 0x76, 0x5b, 0x5b, 0x4b,
-    0x42, 0x42, 0x42, 0x2c, 0x37, 0x42, 0x50, 0x58, 0x6b, 0x68, 0x58, 0x6b,
-    0x8c, 0xe1, 0xed, 0xeb, 0xfa, 0xf6, 0xee, 0xf0, 0xeb, 0xee, 0xd9, 0xa6,
-    0x7f, 0x73, 0x6b, 0x54, 0x77, 0x9f, 0x77, 0x4b, 0x37, 0x45, 0x60, 0x60,
-    0x37, 0x4b, 0x6b, 0x58, 0x6c, 0x7d, 0x53, 0x37, 0x50, 0x58, 0x72, 0x50,
-    0x5a, 0x6f, 0x55, 0x55, 0x27, 0x46, 0x61, 0x7b, 0x84, 0x97, 0xbc, 0xc6,
-    0x94, 0x82, 0x51, 0x30, 0x37, 0x54, 0x5a, 0x50, 0x51, 0x44, 0x2e, 0x27,
-    0x2c, 0x2c, 0x37, 0x50, 0x50, 0x50, 0x43, 0x2c, 0x10, 0x05, 0x05, 0x08,
-    0x13, 0x1c, 0x1e, 0x2d, 0x2e, 0x3e, 0x3e, 0x28, 0x1f, 0x1e, 0x1c, 0x0a,
-    0x08, 0x05, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x0b, 0x4e,
-    0xa2, 0xaf, 0xaf, 0xca, 0xb6, 0xaf, 0x96, 0x83, 0x83, 0x83, 0x96, 0x83,
-    0x73, 0x84, 0x6b, 0x58, 0x5a, 0x6f, 0x56, 0x3d, 0x1e, 0x0b, 0x08, 0x9f,
-    0xaa, 0xc6, 0xca, 0xa6, 0xb6, 0xad, 0xd9, 0xaf, 0x94, 0x96, 0x97, 0x93,
-    0x8c, 0x8c, 0xcc, 0xdc, 0xeb, 0xe0, 0xa0, 0x64, 0x49, 0x31, 0x1e, 0x1c,
-    0x22, 0x1c, 0x6e, 0x4f, 0xba, 0xba, 0xb2, 0xd2, 0xcf, 0xcf, 0xcf, 0xb4,
-    0x35, 0x0a, 0x1c, 0x22, 0x1c, 0x1c, 0x1c, 0x1c, 0x15, 0x0c, 0x0c, 0x0b,
-    0x09, 0x06, 0x06, 0x05, 0x03, 0x03, 0x03, 0x03, 0x09, 0x03, 0x05, 0x08,
-    0x0c, 0x16, 0x08, 0x03, 0x02, 0x02, 0x05, 0x0a, 0x12, 0x19, 0x1e, 0x3e,
-    0x8c, 0x97, 0xaf, 0x98, 0x98, 0xb0, 0xa3, 0x7e, 0x69, 0x29, 0x1f, 0x0d,
-    0x0d, 0x10, 0x40, 0x81, 0x61, 0x77, 0x5a, 0x77, 0x6f, 0x74, 0x74, 0x61,
-    0x46, 0x81, 0x78, 0x77, 0xaa, 0x8c, 0x6c, 0x58, 0x5a, 0x87, 0x6c, 0x50,
-    0x50, 0x83, 0x83, 0x73, 0x66, 0x85, 0xa0, 0x7e, 0x75, 0x86, 0x77, 0x4d,
-    0x6f, 0x81, 0x69, 0x4a, 0x4a, 0x36, 0x39, 0x4a, 0x61, 0x77, 0x4e, 0x1c,
-    0x0a, 0x07, 0x07, 0x0a, 0x0d, 0x10, 0x1b, 0x1d, 0x27, 0x23, 0x23, 0x2c,
-    0x37, 0x42, 0x57, 0x6b, 0x6c, 0x60, 0x56, 0x34, 0x20, 0x20, 0x1c, 0x14,
-    0x37, 0x30, 0x30, 0x5a, 0x6b, 0x72, 0x6b, 0x4b, 0x44, 0x44, 0x46, 0x44,
-    0x47, 0x45, 0x45, 0x3d, 0x34, 0x3c, 0x4f, 0x3d, 0x48, 0xb2, 0xeb, 0xe9,
-    0xe6, 0xc8, 0xab, 0x9c, 0x5c, 0x5b, 0x5b, 0x4b, 0x42, 0x4b, 0x4b, 0x42,
-    0x42, 0x58, 0x83, 0x7f, 0x7c, 0x7c, 0x71, 0x68, 0x72, 0xaa, 0xd0, 0xe0,
-    0xf7, 0xef, 0xea, 0xf9, 0xeb, 0xe3, 0xce, 0xc6, 0xaf, 0x97, 0x73, 0x63,
-    0x54, 0x5e, 0x75, 0x42, 0x51, 0x5a, 0x51, 0x60, 0x43, 0x50, 0x43, 0x50,
-    0x55, 0x81, 0x60, 0x44, 0x50, 0x43, 0x50, 0x2c, 0x37, 0x78, 0x5e, 0x60,
-    0x2c, 0x44, 0x63, 0x58, 0x83, 0x94, 0xaa, 0x97, 0x7f, 0x57, 0x51, 0x37,
-    0x50, 0x58, 0x58, 0x50, 0x43, 0x44, 0x30, 0x23, 0x23, 0x2c, 0x2c, 0x44,
-    0x46, 0x37, 0x2e, 0x1e, 0x0a, 0x05, 0x05, 0x0b, 0x13, 0x19, 0x2b, 0x2e,
-    0x47, 0x47, 0x47, 0x3e, 0x27, 0x1d, 0x1b, 0x13, 0x0b, 0x05, 0x03, 0x03,
-    0x03, 0x06, 0x03, 0x02, 0x02, 0x02, 0x05, 0x1e, 0xaa, 0xaf, 0xaf, 0xb6,
-    0xa6, 0xa6, 0x98, 0x83, 0x96, 0x7f, 0x8e, 0x8e, 0x83, 0x84, 0x84, 0xbb,
-    0xdc, 0xdc, 0xae, 0x87, 0x4e, 0x35, 0x4e, 0x9f, 0xbb, 0xca, 0xa6, 0xbb,
-    0xaf, 0xb6, 0xca, 0x8e, 0xa7, 0xbb, 0xaa, 0xa2, 0xdc, 0xdd, 0xf7, 0xed,
-    0xed, 0xed, 0xed, 0xcc, 0xa0, 0x31, 0x20, 0x4f, 0x4f, 0x4f, 0xb9, 0x9d,
-    0xd2, 0xb7, 0xb2, 0xd2, 0xd2, 0xcf, 0xcc, 0xbb, 0xa0, 0x1c, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x1c, 0x12, 0x12, 0x0c, 0x08, 0x08, 0x08, 0x05,
-    0x06, 0x05, 0x03, 0x02, 0x00, 0x00, 0x02, 0x03, 0x06, 0x09, 0x05, 0x03,
-    0x03, 0x05, 0x08, 0x12, 0x19, 0x21, 0x33, 0x55, 0x74, 0x83, 0x96, 0xb0,
-    0x98, 0x96, 0x98, 0x7b, 0x5e, 0x36, 0x2b, 0x14, 0x0d, 0x4e, 0x78, 0x78,
-    0x87, 0x9f, 0x86, 0x78, 0x7e, 0x4a, 0x36, 0x3e, 0x2d, 0x69, 0x54, 0x58,
-    0x82, 0x85, 0x61, 0x46, 0x81, 0xb4, 0x77, 0x6b, 0x6b, 0x74, 0x6b, 0x58,
-    0x63, 0x6f, 0xa1, 0x7e, 0x7b, 0x61, 0x63, 0x39, 0x5e, 0xa1, 0x81, 0x6d,
-    0x4a, 0x46, 0x46, 0x54, 0x5e, 0x47, 0x2a, 0x0b, 0x05, 0x05, 0x05, 0x05,
-    0x07, 0x0d, 0x14, 0x1b, 0x1f, 0x1d, 0x23, 0x23, 0x2c, 0x2c, 0x37, 0x44,
-    0x45, 0x2e, 0x2d, 0x34, 0x34, 0x22, 0x1c, 0x1b, 0x44, 0x23, 0x30, 0x44,
-    0x58, 0x58, 0x50, 0x37, 0x2c, 0x3e, 0x47, 0x47, 0x53, 0x53, 0x53, 0x49,
-    0x34, 0x3c, 0x4f, 0x49, 0x67, 0xd2, 0xeb, 0xe9, 0xd7, 0xc1, 0xab, 0x8a,
-    0x76, 0x5b, 0x5b, 0x57, 0x4b, 0x4b, 0x57, 0x4b, 0x4b, 0x82, 0xaf, 0x9c,
-    0x88, 0x88, 0x88, 0x7c, 0x71, 0x68, 0x8c, 0xc6, 0xdc, 0xe6, 0xdc, 0xee,
-    0xed, 0xdc, 0xdc, 0xdc, 0xbb, 0xaa, 0x8c, 0x7b, 0x75, 0x87, 0x78, 0x6f,
-    0x50, 0x6c, 0x61, 0x60, 0x44, 0x53, 0x37, 0x44, 0x5a, 0x61, 0x51, 0x37,
-    0x2e, 0x3a, 0x46, 0x51, 0x6c, 0x77, 0x75, 0x77, 0x51, 0x2c, 0x43, 0x6b,
-    0x6b, 0x71, 0x7f, 0x7f, 0x57, 0x43, 0x51, 0x55, 0x58, 0x50, 0x6b, 0x85,
-    0x75, 0x6c, 0x44, 0x23, 0x23, 0x23, 0x30, 0x27, 0x27, 0x1d, 0x14, 0x0a,
-    0x0a, 0x07, 0x06, 0x0b, 0x12, 0x19, 0x2b, 0x2e, 0x47, 0x47, 0x46, 0x3e,
-    0x27, 0x1f, 0x1b, 0x0c, 0x0b, 0x05, 0x06, 0x08, 0x0b, 0x0b, 0x0b, 0x03,
-    0x02, 0x00, 0x11, 0x4e, 0xa2, 0xaf, 0xaf, 0xa6, 0xa6, 0x8e, 0x96, 0x8e,
-    0x7f, 0x83, 0x7f, 0x94, 0x96, 0xbc, 0xeb, 0xf7, 0xf7, 0xea, 0xea, 0xdd,
-    0xb7, 0x56, 0x86, 0xa2, 0xa6, 0xa6, 0xa6, 0xbb, 0xca, 0xb6, 0x8a, 0x8a,
-    0x8a, 0xb5, 0x94, 0xcc, 0xe9, 0xf7, 0xf9, 0xf7, 0xed, 0xed, 0xea, 0xd7,
-    0xb1, 0x49, 0x20, 0x8f, 0x8f, 0x9d, 0xb4, 0xcf, 0xd1, 0xd3, 0xd3, 0xc6,
-    0xbb, 0xbe, 0xb1, 0xb8, 0x9a, 0x6a, 0x35, 0x35, 0x35, 0x22, 0x22, 0x35,
-    0x35, 0x35, 0x35, 0x22, 0x12, 0x0c, 0x08, 0x08, 0x08, 0x06, 0x03, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x0b, 0x13, 0x12, 0x12, 0x1c,
-    0x1c, 0x1c, 0x21, 0x28, 0x58, 0x73, 0x96, 0xbc, 0xb0, 0x83, 0x83, 0x63,
-    0x36, 0x36, 0x40, 0x1e, 0x1e, 0x6f, 0x77, 0xb7, 0xba, 0x9f, 0xae, 0x78,
-    0x5e, 0x36, 0x1a, 0x1a, 0x1e, 0x69, 0x5e, 0x5a, 0x5a, 0x44, 0x44, 0x5e,
-    0x8f, 0x8f, 0x5e, 0x58, 0x4d, 0x3a, 0x2e, 0x55, 0x5e, 0x54, 0x39, 0x39,
-    0x4a, 0x5e, 0x52, 0x2f, 0x29, 0x36, 0x46, 0x54, 0x6d, 0x54, 0x46, 0x6f,
-    0x33, 0x2a, 0x12, 0x07, 0x05, 0x05, 0x03, 0x03, 0x05, 0x07, 0x0d, 0x19,
-    0x1a, 0x1a, 0x1d, 0x27, 0x27, 0x2d, 0x1d, 0x1f, 0x1f, 0x1e, 0x28, 0x34,
-    0x34, 0x20, 0x20, 0x1e, 0x43, 0x2c, 0x23, 0x37, 0x50, 0x43, 0x32, 0x2c,
-    0x2c, 0x2e, 0x3a, 0x46, 0x61, 0x60, 0x64, 0x49, 0x34, 0x3c, 0x3c, 0x59,
-    0x80, 0xe1, 0xdd, 0xd7, 0xc8, 0xa7, 0x8a, 0x8a, 0x76, 0x5c, 0x5b, 0x5b,
-    0x5b, 0x57, 0x57, 0x57, 0x82, 0x93, 0xb5, 0xb6, 0xab, 0xb5, 0xab, 0x76,
-    0x70, 0x57, 0x72, 0xa2, 0xf0, 0xf9, 0xee, 0xdf, 0xc6, 0xe1, 0xf0, 0xdd,
-    0xa5, 0x94, 0x8c, 0x8c, 0x8c, 0x74, 0x58, 0x58, 0x46, 0x61, 0x77, 0x60,
-    0x51, 0x44, 0x37, 0x43, 0x5a, 0x51, 0x44, 0x30, 0x1f, 0x2e, 0x55, 0x6f,
-    0x72, 0x85, 0x82, 0x72, 0x37, 0x23, 0x44, 0x43, 0x50, 0x58, 0x68, 0x58,
-    0x37, 0x23, 0x54, 0x75, 0x6b, 0x74, 0x85, 0x75, 0x75, 0x58, 0x51, 0x23,
-    0x1d, 0x1d, 0x1d, 0x10, 0x10, 0x1b, 0x14, 0x0d, 0x0d, 0x0c, 0x08, 0x08,
-    0x0c, 0x19, 0x1f, 0x2e, 0x3e, 0x47, 0x3a, 0x2e, 0x1f, 0x1b, 0x12, 0x0c,
-    0x08, 0x05, 0x0b, 0x13, 0x1c, 0x1c, 0x13, 0x08, 0x03, 0x02, 0x03, 0x4e,
-    0x86, 0x93, 0x93, 0x94, 0x8e, 0x8e, 0x94, 0x8e, 0x94, 0xaf, 0x97, 0x97,
-    0xc6, 0xed, 0xf9, 0xf7, 0xed, 0xe7, 0xe7, 0xdc, 0xce, 0xaa, 0xbb, 0xaa,
-    0xa2, 0xaa, 0xaf, 0xaf, 0xad, 0x8e, 0xa6, 0xbb, 0xaf, 0x94, 0xbb, 0xeb,
-    0xeb, 0xf7, 0xed, 0xee, 0xeb, 0xed, 0xdc, 0xd5, 0xcc, 0x80, 0x4f, 0x9d,
-    0xb4, 0xaa, 0xaa, 0xbe, 0xb7, 0xcf, 0xbe, 0xbb, 0xd1, 0xb2, 0xa8, 0xa8,
-    0x9a, 0x7d, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x6a, 0x69, 0x81, 0x64,
-    0x40, 0x21, 0x0c, 0x0b, 0x09, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x09, 0x0d, 0x12, 0x19, 0x22, 0x2a, 0x1e, 0x1b, 0x1b, 0x2b,
-    0x61, 0x6b, 0x83, 0x96, 0x96, 0x73, 0x63, 0x50, 0x5e, 0x2f, 0x24, 0x1e,
-    0x33, 0x47, 0x77, 0xae, 0xae, 0xac, 0x91, 0x86, 0x7e, 0x4c, 0x2b, 0x28,
-    0x7d, 0x80, 0x87, 0x78, 0x78, 0x3e, 0x2e, 0x64, 0x80, 0x80, 0x4c, 0x46,
-    0x2e, 0x2e, 0x47, 0x6f, 0x7e, 0x54, 0x4d, 0x46, 0x36, 0x4a, 0x36, 0x36,
-    0x36, 0x36, 0x4a, 0x54, 0x55, 0x4a, 0x4a, 0x4e, 0x19, 0x1c, 0x0a, 0x07,
-    0x07, 0x0a, 0x07, 0x05, 0x07, 0x0a, 0x0d, 0x19, 0x14, 0x14, 0x1b, 0x1d,
-    0x1d, 0x1f, 0x14, 0x19, 0x19, 0x1b, 0x1e, 0x2a, 0x34, 0x34, 0x20, 0x2a,
-    0x43, 0x2c, 0x2c, 0x2c, 0x43, 0x43, 0x2c, 0x2c, 0x23, 0x2e, 0x3e, 0x54,
-    0x61, 0x77, 0x78, 0x49, 0x3c, 0x3c, 0x3c, 0x59, 0x8f, 0xe1, 0xd7, 0xca,
-    0xb6, 0xa7, 0x8a, 0x8a, 0x76, 0x76, 0x70, 0x70, 0x70, 0x68, 0x57, 0x71,
-    0xa2, 0xc6, 0xd5, 0xca, 0xca, 0xc8, 0xab, 0x76, 0x70, 0x68, 0x4b, 0x9b,
-    0xfc, 0xfc, 0xeb, 0xe9, 0xd2, 0xe4, 0xe4, 0xdd, 0xbb, 0xaa, 0xaa, 0xaa,
-    0x8c, 0x7f, 0x6b, 0x5a, 0x50, 0x51, 0x61, 0x6c, 0x44, 0x37, 0x44, 0x37,
-    0x37, 0x5a, 0x64, 0x48, 0x27, 0x47, 0x61, 0x75, 0x84, 0x8c, 0x82, 0x72,
-    0x51, 0x37, 0x43, 0x37, 0x43, 0x43, 0x44, 0x30, 0x2c, 0x2c, 0x43, 0x58,
-    0x6b, 0x84, 0xa3, 0x84, 0x74, 0x6c, 0x51, 0x2e, 0x1a, 0x1a, 0x1a, 0x10,
-    0x10, 0x14, 0x14, 0x12, 0x12, 0x0c, 0x08, 0x05, 0x08, 0x12, 0x1b, 0x28,
-    0x28, 0x2e, 0x2e, 0x28, 0x1e, 0x1b, 0x0d, 0x0a, 0x0a, 0x07, 0x13, 0x1c,
-    0x1e, 0x1e, 0x1c, 0x15, 0x06, 0x03, 0x06, 0x20, 0x77, 0x82, 0x93, 0x94,
-    0x8a, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0x94, 0xbc, 0xeb, 0xf7, 0xf6, 0xf6,
-    0xf6, 0xea, 0xde, 0xe6, 0xd5, 0xc6, 0xc6, 0xbc, 0xae, 0xa3, 0x97, 0xaf,
-    0xd5, 0xd7, 0xd9, 0xd1, 0xe1, 0xcf, 0xeb, 0xe9, 0xf5, 0xea, 0xed, 0xed,
-    0xd9, 0xea, 0xdd, 0xdc, 0xcf, 0xb4, 0x9d, 0xb2, 0xae, 0xbe, 0xbb, 0xb2,
-    0xae, 0xaf, 0xbb, 0xb7, 0xaa, 0xae, 0xb2, 0xa2, 0x86, 0x87, 0x6a, 0x6a,
-    0x6a, 0x56, 0x67, 0x80, 0x69, 0x6f, 0x87, 0x86, 0x86, 0x67, 0x20, 0x13,
-    0x08, 0x05, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x02, 0x05, 0x0d,
-    0x19, 0x1e, 0x21, 0x1f, 0x1f, 0x1e, 0x2a, 0x40, 0x3e, 0x51, 0x6b, 0x73,
-    0x66, 0x63, 0x4d, 0x46, 0x4a, 0x19, 0x0a, 0x12, 0x1e, 0x48, 0x85, 0xa2,
-    0x97, 0xac, 0xa3, 0x91, 0x7e, 0x6d, 0x2f, 0x33, 0xa0, 0x78, 0x75, 0x75,
-    0x77, 0x47, 0x3e, 0x81, 0x6a, 0x69, 0x6a, 0x3e, 0x36, 0x3d, 0x56, 0x55,
-    0x4a, 0x54, 0x61, 0x46, 0x29, 0x36, 0x4c, 0x6d, 0x6d, 0x40, 0x48, 0x64,
-    0x4e, 0x19, 0x12, 0x12, 0x12, 0x0a, 0x0a, 0x10, 0x1e, 0x2a, 0x31, 0x20,
-    0x1c, 0x13, 0x0a, 0x0d, 0x0d, 0x0d, 0x10, 0x1b, 0x1b, 0x14, 0x19, 0x19,
-    0x21, 0x19, 0x1b, 0x1e, 0x2d, 0x34, 0x34, 0x22, 0x43, 0x2c, 0x2c, 0x37,
-    0x32, 0x2c, 0x2c, 0x23, 0x23, 0x30, 0x37, 0x51, 0x75, 0x86, 0x7d, 0x4f,
-    0x3c, 0x3c, 0x3c, 0x3c, 0x6e, 0xd1, 0xca, 0xab, 0x9c, 0x9c, 0x8a, 0x7c,
-    0x88, 0x7c, 0x7c, 0x7c, 0x71, 0x57, 0x4b, 0x7f, 0xa8, 0xdc, 0xdc, 0xe6,
-    0xda, 0xc8, 0xab, 0x88, 0x7f, 0x7f, 0x72, 0xb4, 0xfc, 0xfc, 0xf0, 0xe9,
-    0xca, 0xbc, 0xe3, 0xe1, 0xcc, 0xb1, 0xbe, 0xaa, 0xa2, 0x94, 0x6b, 0x50,
-    0x6c, 0x58, 0x58, 0x50, 0x5a, 0x51, 0x27, 0x37, 0x44, 0x5a, 0x78, 0x48,
-    0x2e, 0x46, 0x50, 0x6b, 0x91, 0xa2, 0x82, 0x4b, 0x46, 0x3e, 0x27, 0x3a,
-    0x27, 0x2e, 0x1e, 0x14, 0x27, 0x37, 0x43, 0x75, 0x91, 0x97, 0x83, 0xa2,
-    0x84, 0x85, 0x55, 0x28, 0x14, 0x14, 0x14, 0x10, 0x1b, 0x1e, 0x1b, 0x14,
-    0x0d, 0x08, 0x05, 0x05, 0x08, 0x0c, 0x0d, 0x14, 0x1a, 0x1d, 0x1f, 0x1a,
-    0x1b, 0x10, 0x12, 0x12, 0x20, 0x13, 0x1c, 0x20, 0x1e, 0x1e, 0x22, 0x1c,
-    0x0b, 0x06, 0x22, 0x49, 0x77, 0xa2, 0x94, 0x8a, 0x9c, 0xbb, 0xb6, 0x8e,
-    0x8e, 0x94, 0x71, 0xbe, 0xee, 0xf7, 0xed, 0xea, 0xea, 0xed, 0xdc, 0xde,
-    0xc8, 0xce, 0xc6, 0xc9, 0xcf, 0xce, 0xe1, 0xfd, 0xfe, 0xfd, 0xf6, 0xe9,
-    0xdd, 0xf7, 0xeb, 0xee, 0xea, 0xde, 0xd7, 0xdb, 0xc5, 0xde, 0xd9, 0xc6,
-    0xbb, 0xbe, 0xae, 0xa0, 0x81, 0xa2, 0xa8, 0xbe, 0xac, 0x94, 0xaf, 0xa3,
-    0x97, 0xb7, 0xa3, 0x85, 0x8c, 0x7d, 0x67, 0x56, 0x56, 0x53, 0x64, 0x81,
-    0x64, 0x86, 0x87, 0x86, 0x8c, 0x9f, 0x7d, 0x1c, 0x08, 0x06, 0x03, 0x00,
-    0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x02, 0x0a, 0x1c, 0x21, 0x1e, 0x1f,
-    0x2b, 0x2a, 0x2b, 0x28, 0x1d, 0x28, 0x54, 0x50, 0x50, 0x4d, 0x46, 0x4a,
-    0x2b, 0x1b, 0x0a, 0x12, 0x1c, 0x2d, 0x85, 0x7f, 0x93, 0x97, 0x98, 0x84,
-    0x6c, 0x55, 0x2b, 0x1a, 0x47, 0x75, 0x84, 0x86, 0x5e, 0x46, 0x53, 0xa0,
-    0x80, 0x81, 0x5e, 0x55, 0x3e, 0x64, 0x5e, 0x46, 0x4a, 0x4a, 0x36, 0x36,
-    0x36, 0x3e, 0x4c, 0x4c, 0x55, 0x64, 0x78, 0x9d, 0x0b, 0x08, 0x0a, 0x0d,
-    0x0d, 0x12, 0x1c, 0x31, 0x56, 0x77, 0x86, 0x87, 0x4e, 0x22, 0x10, 0x0a,
-    0x0a, 0x0a, 0x0d, 0x14, 0x14, 0x14, 0x1b, 0x1f, 0x1f, 0x1f, 0x1f, 0x1e,
-    0x2a, 0x34, 0x34, 0x35, 0x42, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2c, 0x2c,
-    0x2e, 0x2e, 0x3a, 0x55, 0x6f, 0x77, 0x67, 0x4f, 0x3c, 0x3c, 0x3c, 0x3c,
-    0x59, 0x80, 0xa2, 0x9c, 0x88, 0x76, 0x7c, 0x7c, 0x88, 0x7c, 0x70, 0x70,
-    0x70, 0x57, 0x58, 0xa2, 0xce, 0xe9, 0xed, 0xe6, 0xda, 0xca, 0xb6, 0x88,
-    0x7c, 0x7c, 0x68, 0xb9, 0xfc, 0xfa, 0xeb, 0xe6, 0xc8, 0xce, 0xe1, 0xe1,
-    0xdc, 0xc6, 0xaa, 0xbe, 0xce, 0x93, 0x6b, 0x6c, 0x75, 0x74, 0x58, 0x50,
-    0x85, 0x54, 0x2e, 0x44, 0x5a, 0x6c, 0x5a, 0x60, 0x23, 0x3a, 0x50, 0x58,
-    0x74, 0x84, 0x6b, 0x2c, 0x46, 0x2e, 0x23, 0x45, 0x45, 0x45, 0x1d, 0x28,
-    0x37, 0x3a, 0x50, 0x85, 0x97, 0x96, 0x96, 0x97, 0x96, 0x84, 0x5e, 0x1b,
-    0x14, 0x14, 0x14, 0x1b, 0x1f, 0x1f, 0x1f, 0x14, 0x0a, 0x08, 0x05, 0x03,
-    0x05, 0x08, 0x0b, 0x0d, 0x14, 0x1e, 0x1e, 0x1b, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x2a, 0x20, 0x20, 0x22, 0x22, 0x22, 0x1c, 0x1c, 0x0b, 0x05, 0x34, 0x60,
-    0x86, 0x93, 0x94, 0x88, 0x94, 0xa6, 0xa6, 0x7c, 0x7f, 0x7f, 0x7f, 0xcf,
-    0xee, 0xea, 0xea, 0xea, 0xe7, 0xde, 0xd8, 0xc5, 0xc8, 0xd7, 0xd5, 0xd5,
-    0xdc, 0xf7, 0xfd, 0xfd, 0xfe, 0xf7, 0xf6, 0xeb, 0xdd, 0xdc, 0xe0, 0xed,
-    0xde, 0xd8, 0xd8, 0xc8, 0xd9, 0xd5, 0xc8, 0xab, 0xb6, 0xaa, 0xb1, 0xa0,
-    0x9f, 0x94, 0x94, 0x97, 0x96, 0x94, 0x96, 0x83, 0x97, 0xa3, 0x84, 0x84,
-    0x86, 0x7d, 0x67, 0x56, 0x53, 0x53, 0x64, 0x69, 0x6f, 0x78, 0x87, 0x85,
-    0x85, 0xa2, 0x9f, 0x33, 0x0b, 0x06, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01,
-    0x01, 0x00, 0x03, 0x0b, 0x1c, 0x21, 0x35, 0x21, 0x35, 0x24, 0x2b, 0x1f,
-    0x1f, 0x2b, 0x4a, 0x36, 0x47, 0x36, 0x40, 0x24, 0x1f, 0x21, 0x12, 0x1e,
-    0x1b, 0x28, 0x6c, 0x73, 0x97, 0xac, 0xa3, 0x63, 0x63, 0x4a, 0x2f, 0x1f,
-    0x48, 0x60, 0x91, 0x91, 0x61, 0x3a, 0x47, 0x78, 0x78, 0x5e, 0x61, 0x46,
-    0x3e, 0x55, 0x54, 0x54, 0x54, 0x36, 0x2b, 0x36, 0x3e, 0x3e, 0x47, 0x55,
-    0x64, 0x60, 0x78, 0x20, 0x05, 0x05, 0x08, 0x0d, 0x1c, 0x2a, 0x3d, 0x64,
-    0x77, 0x8c, 0xa2, 0xb1, 0x9a, 0x49, 0x20, 0x13, 0x0a, 0x0d, 0x0d, 0x14,
-    0x1b, 0x1b, 0x1f, 0x28, 0x2b, 0x24, 0x24, 0x1e, 0x2a, 0x34, 0x34, 0x34,
-    0x42, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2c, 0x2c, 0x2e, 0x2e, 0x37, 0x51,
-    0x61, 0x64, 0x67, 0x4f, 0x3c, 0x3c, 0x3c, 0x59, 0x59, 0x6e, 0x67, 0x6c,
-    0x68, 0x57, 0x71, 0x82, 0x82, 0x7f, 0x71, 0x68, 0x68, 0x58, 0x6c, 0xaa,
-    0xdd, 0xeb, 0xea, 0xd7, 0xca, 0xc8, 0xab, 0x9c, 0x7c, 0x70, 0x57, 0xb4,
-    0xfc, 0xfa, 0xeb, 0xd7, 0xb6, 0xb8, 0xcc, 0xdc, 0xd5, 0xc8, 0xbb, 0xcf,
-    0x97, 0x57, 0x71, 0x75, 0x86, 0x85, 0x72, 0x50, 0x51, 0x3a, 0x3a, 0x51,
-    0x75, 0x6b, 0x50, 0x51, 0x27, 0x2e, 0x46, 0x43, 0x50, 0x51, 0x44, 0x30,
-    0x45, 0x37, 0x37, 0x51, 0x5a, 0x53, 0x53, 0x45, 0x44, 0x2c, 0x43, 0x58,
-    0x73, 0x96, 0x96, 0xaf, 0x94, 0x71, 0x51, 0x1d, 0x1b, 0x14, 0x1a, 0x1d,
-    0x1f, 0x1d, 0x1f, 0x14, 0x0d, 0x0a, 0x08, 0x05, 0x05, 0x08, 0x0b, 0x0a,
-    0x1e, 0x31, 0x3d, 0x28, 0x28, 0x2d, 0x28, 0x2a, 0x31, 0x2d, 0x3d, 0x20,
-    0x20, 0x1c, 0x1c, 0x1c, 0x0b, 0x05, 0x13, 0x55, 0x74, 0x94, 0x76, 0x93,
-    0xa6, 0xa6, 0x88, 0x7f, 0x96, 0x96, 0x82, 0xeb, 0xed, 0xe6, 0xd8, 0xde,
-    0xe7, 0xd8, 0xde, 0xc8, 0xbf, 0xc5, 0xd5, 0xc6, 0xe9, 0xfa, 0xf9, 0xf6,
-    0xf9, 0xf6, 0xea, 0xeb, 0xdd, 0xdc, 0xdc, 0xd7, 0xd7, 0xc8, 0xd8, 0xea,
-    0xf0, 0xd5, 0xab, 0xab, 0xa8, 0xb1, 0xcf, 0xcf, 0xe0, 0xce, 0xaa, 0xaa,
-    0x77, 0x83, 0x7f, 0x84, 0x91, 0x85, 0x84, 0x84, 0x78, 0x7d, 0x67, 0x56,
-    0x53, 0x53, 0x60, 0x60, 0x6c, 0x77, 0x86, 0x86, 0x85, 0x85, 0x86, 0x69,
-    0x13, 0x03, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x15,
-    0x1c, 0x3f, 0x4f, 0x52, 0x3f, 0x24, 0x2b, 0x1f, 0x2f, 0x35, 0x2f, 0x24,
-    0x19, 0x19, 0x1b, 0x19, 0x21, 0x19, 0x2a, 0x2f, 0x2e, 0x2e, 0x53, 0x6b,
-    0x83, 0x98, 0x84, 0x4d, 0x46, 0x36, 0x1f, 0x22, 0x33, 0x3e, 0x61, 0x61,
-    0x47, 0x36, 0x2d, 0x64, 0x5e, 0x7b, 0x7b, 0x4a, 0x2e, 0x47, 0x55, 0x4a,
-    0x36, 0x29, 0x1f, 0x2e, 0x55, 0x69, 0x4c, 0x64, 0x6f, 0x77, 0x6a, 0x13,
-    0x08, 0x07, 0x0a, 0x1c, 0x2a, 0x45, 0x6c, 0x8c, 0xa8, 0xb1, 0xb1, 0xb1,
-    0xb1, 0x87, 0x34, 0x1c, 0x12, 0x10, 0x14, 0x14, 0x1f, 0x2b, 0x1f, 0x28,
-    0x3d, 0x2f, 0x2f, 0x2a, 0x34, 0x34, 0x34, 0x34, 0x42, 0x32, 0x32, 0x42,
-    0x32, 0x32, 0x43, 0x43, 0x37, 0x37, 0x37, 0x51, 0x5a, 0x64, 0x4f, 0x59,
-    0x4f, 0x4f, 0x3c, 0x59, 0x59, 0x59, 0x4f, 0x49, 0x23, 0x23, 0x45, 0x53,
-    0x6c, 0x72, 0x58, 0x51, 0x5a, 0x6c, 0x7a, 0xaa, 0xe1, 0xe9, 0xe6, 0xda,
-    0xc8, 0xab, 0xab, 0x88, 0x70, 0x5b, 0x57, 0xb4, 0xfa, 0xf7, 0xf7, 0xd9,
-    0xc6, 0xd2, 0xcc, 0xce, 0xd5, 0xc8, 0xc6, 0xa5, 0x7f, 0x83, 0x84, 0x85,
-    0x85, 0x84, 0x73, 0x57, 0x42, 0x2c, 0x2c, 0x37, 0x37, 0x37, 0x46, 0x54,
-    0x28, 0x27, 0x2e, 0x45, 0x30, 0x27, 0x27, 0x47, 0x51, 0x44, 0x58, 0x50,
-    0x58, 0x60, 0x64, 0x60, 0x37, 0x37, 0x58, 0x74, 0x66, 0x83, 0xaf, 0xaf,
-    0x94, 0x68, 0x37, 0x1d, 0x1d, 0x1f, 0x28, 0x27, 0x28, 0x1d, 0x28, 0x1f,
-    0x14, 0x12, 0x0a, 0x05, 0x0b, 0x1c, 0x20, 0x35, 0x40, 0x45, 0x45, 0x45,
-    0x47, 0x47, 0x3d, 0x3d, 0x56, 0x47, 0x2e, 0x1e, 0x20, 0x20, 0x20, 0x22,
-    0x0b, 0x03, 0x05, 0x13, 0x47, 0x72, 0x7f, 0x7f, 0x97, 0x94, 0x5b, 0x5b,
-    0x83, 0x7f, 0x68, 0xd7, 0xde, 0xea, 0xe6, 0xc5, 0xd8, 0xd8, 0xea, 0xe9,
-    0xc5, 0xa9, 0xd9, 0xdf, 0xfa, 0xfa, 0xf9, 0xf6, 0xf7, 0xea, 0xef, 0xeb,
-    0xed, 0xdd, 0xdd, 0xd5, 0xce, 0xce, 0xd5, 0xed, 0xee, 0xe9, 0xd7, 0xce,
-    0xd2, 0xf0, 0xf0, 0xf7, 0xf9, 0xf9, 0xe9, 0xb2, 0x9f, 0xa2, 0xa8, 0xae,
-    0xb2, 0x8c, 0x8c, 0x91, 0x87, 0x80, 0x64, 0x5e, 0x47, 0x44, 0x51, 0x5a,
-    0x78, 0x78, 0x87, 0x77, 0x85, 0x86, 0x75, 0x6f, 0x22, 0x03, 0x03, 0x02,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x16, 0x25, 0x52, 0x5d, 0x5d,
-    0x3f, 0x24, 0x29, 0x2b, 0x2f, 0x35, 0x24, 0x24, 0x0d, 0x0a, 0x0d, 0x13,
-    0x0a, 0x19, 0x24, 0x2b, 0x27, 0x3e, 0x64, 0x44, 0x58, 0x58, 0x46, 0x3a,
-    0x36, 0x2a, 0x19, 0x1c, 0x21, 0x2f, 0x3d, 0x2b, 0x1f, 0x1b, 0x20, 0x4e,
-    0x40, 0x47, 0x4a, 0x2e, 0x2b, 0x2f, 0x52, 0x40, 0x36, 0x36, 0x2f, 0x2e,
-    0x48, 0x48, 0x56, 0x6c, 0x7a, 0x77, 0x34, 0x0a, 0x0b, 0x10, 0x2a, 0x3d,
-    0x56, 0x6c, 0x82, 0xa5, 0xc9, 0xcf, 0xdd, 0xce, 0xaa, 0x9a, 0x56, 0x20,
-    0x12, 0x1c, 0x14, 0x14, 0x1a, 0x28, 0x28, 0x2d, 0x48, 0x48, 0x40, 0x33,
-    0x34, 0x34, 0x31, 0x34, 0x4b, 0x42, 0x42, 0x42, 0x43, 0x43, 0x43, 0x43,
-    0x32, 0x37, 0x37, 0x51, 0x5e, 0x56, 0x4f, 0x4f, 0x59, 0x4f, 0x4f, 0x59,
-    0x59, 0x59, 0x59, 0x4f, 0x2a, 0x1b, 0x14, 0x1a, 0x28, 0x2e, 0x28, 0x1d,
-    0x48, 0x86, 0x93, 0xa5, 0xdd, 0xe9, 0xe8, 0xd7, 0xc1, 0xa7, 0x8a, 0x76,
-    0x5c, 0x5b, 0x4b, 0xb4, 0xf9, 0xe6, 0xd7, 0xb6, 0xca, 0xb8, 0x9c, 0x82,
-    0xa2, 0x7f, 0x8c, 0xb8, 0xbb, 0xaa, 0xaa, 0xb2, 0x84, 0x68, 0x4b, 0x75,
-    0x6b, 0x3a, 0x2e, 0x27, 0x3e, 0x2e, 0x47, 0x51, 0x30, 0x30, 0x30, 0x45,
-    0x28, 0x47, 0x3e, 0x44, 0x54, 0x77, 0x85, 0x75, 0x75, 0x6c, 0x60, 0x53,
-    0x37, 0x43, 0x43, 0x50, 0x73, 0x7f, 0x96, 0x96, 0x7f, 0x51, 0x27, 0x1d,
-    0x1d, 0x2e, 0x3e, 0x27, 0x27, 0x2e, 0x27, 0x27, 0x14, 0x0d, 0x08, 0x0c,
-    0x1c, 0x2a, 0x2d, 0x47, 0x51, 0x51, 0x51, 0x5a, 0x53, 0x51, 0x47, 0x48,
-    0x53, 0x53, 0x30, 0x2d, 0x2d, 0x2d, 0x31, 0x20, 0x13, 0x06, 0x06, 0x13,
-    0x7d, 0x8c, 0x8c, 0x88, 0xa6, 0x83, 0x71, 0x68, 0x71, 0x71, 0x8c, 0xd5,
-    0xe8, 0xe9, 0xed, 0xde, 0xbf, 0xbf, 0xe7, 0xd9, 0xc8, 0xc8, 0xe1, 0xeb,
-    0xf7, 0xfd, 0xfd, 0xef, 0xf7, 0xee, 0xe6, 0xdb, 0xde, 0xd7, 0xd7, 0xdc,
-    0xdd, 0xe1, 0xed, 0xfd, 0xfe, 0xf9, 0xe9, 0xeb, 0xfa, 0xfa, 0xfa, 0xf9,
-    0xf6, 0xf6, 0xea, 0xd9, 0xaa, 0x8c, 0x94, 0xae, 0xbe, 0x85, 0xa3, 0xb7,
-    0x9f, 0x86, 0x64, 0x64, 0x48, 0x54, 0x51, 0x60, 0x6c, 0x60, 0x6c, 0x58,
-    0x6c, 0x77, 0x6f, 0x6f, 0x22, 0x08, 0x06, 0x06, 0x03, 0x02, 0x02, 0x00,
-    0x00, 0x02, 0x09, 0x09, 0x16, 0x52, 0x52, 0x3f, 0x24, 0x24, 0x2f, 0x2f,
-    0x21, 0x1f, 0x1f, 0x1e, 0x16, 0x0d, 0x0a, 0x08, 0x0b, 0x22, 0x1f, 0x2d,
-    0x48, 0x64, 0x64, 0x47, 0x51, 0x56, 0x40, 0x35, 0x1e, 0x12, 0x10, 0x19,
-    0x2f, 0x3d, 0x40, 0x2f, 0x2b, 0x1e, 0x21, 0x35, 0x4e, 0x40, 0x2f, 0x29,
-    0x1d, 0x2b, 0x40, 0x3d, 0x3e, 0x47, 0x47, 0x48, 0x55, 0x53, 0x77, 0x86,
-    0x7a, 0x56, 0x20, 0x10, 0x1c, 0x2d, 0x45, 0x5a, 0x6b, 0x72, 0x7f, 0x94,
-    0xb5, 0xd5, 0xdc, 0xd5, 0xbb, 0xae, 0x7d, 0x34, 0x10, 0x10, 0x14, 0x14,
-    0x1a, 0x28, 0x3d, 0x45, 0x60, 0x78, 0x64, 0x56, 0x49, 0x34, 0x31, 0x49,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x50, 0x50, 0x50, 0x43, 0x43, 0x44, 0x51, 0x5a,
-    0x5e, 0x56, 0x4f, 0x4f, 0x4f, 0x49, 0x4f, 0x59, 0x59, 0x59, 0x59, 0x4f,
-    0x34, 0x1b, 0x10, 0x0d, 0x10, 0x19, 0x14, 0x1e, 0x56, 0xa2, 0xb8, 0xb5,
-    0xcc, 0xe9, 0xdc, 0xc9, 0xbf, 0x89, 0x8a, 0x76, 0x5c, 0x5b, 0x4b, 0x60,
-    0xee, 0xe7, 0xca, 0xb6, 0xc6, 0xa6, 0x76, 0x7c, 0x7f, 0x5b, 0x8c, 0xe1,
-    0xe1, 0xcc, 0xc6, 0xc6, 0x93, 0x71, 0x68, 0x75, 0x58, 0x43, 0x2c, 0x2c,
-    0x55, 0x46, 0x54, 0x51, 0x60, 0x51, 0x44, 0x45, 0x27, 0x47, 0x60, 0x6f,
-    0x50, 0x7b, 0x75, 0x8c, 0x7a, 0x72, 0x51, 0x37, 0x2c, 0x32, 0x43, 0x50,
-    0x50, 0x66, 0x66, 0x68, 0x43, 0x2e, 0x27, 0x27, 0x27, 0x2e, 0x3a, 0x37,
-    0x3a, 0x3a, 0x2e, 0x27, 0x1b, 0x0d, 0x07, 0x1c, 0x4c, 0x5e, 0x5e, 0x5e,
-    0x6f, 0x5a, 0x5a, 0x6c, 0x58, 0x5a, 0x5e, 0x55, 0x45, 0x45, 0x45, 0x3d,
-    0x48, 0x48, 0x48, 0x4e, 0x1c, 0x13, 0x0b, 0x4f, 0xa0, 0x8c, 0x93, 0x7c,
-    0x5b, 0x6b, 0x91, 0x8c, 0x75, 0xbe, 0xe0, 0xeb, 0xf7, 0xeb, 0xed, 0xe7,
-    0xde, 0xda, 0xc8, 0xd9, 0xd9, 0xca, 0xe9, 0xf7, 0xf7, 0xf9, 0xf9, 0xea,
-    0xea, 0xea, 0xe7, 0xdb, 0xe7, 0xe9, 0xe9, 0xeb, 0xeb, 0xf9, 0xf9, 0xfd,
-    0xfd, 0xf5, 0xf5, 0xe9, 0xeb, 0xfa, 0xfa, 0xf9, 0xf7, 0xef, 0xe6, 0xd7,
-    0xce, 0xa2, 0x7f, 0xce, 0xcf, 0xe1, 0xeb, 0xeb, 0xeb, 0xcf, 0x81, 0x56,
-    0x47, 0x5e, 0x53, 0x44, 0x51, 0x60, 0x61, 0x81, 0x6a, 0x6f, 0x6f, 0x55,
-    0x22, 0x0b, 0x0c, 0x0b, 0x08, 0x05, 0x02, 0x02, 0x00, 0x02, 0x02, 0x06,
-    0x08, 0x25, 0x3f, 0x3f, 0x24, 0x2f, 0x2f, 0x24, 0x2f, 0x2f, 0x2a, 0x21,
-    0x22, 0x1c, 0x1c, 0x16, 0x0c, 0x1c, 0x33, 0x64, 0x7d, 0x7e, 0x6f, 0x6f,
-    0x5e, 0x4c, 0x2f, 0x21, 0x19, 0x12, 0x19, 0x1f, 0x3d, 0x3e, 0x47, 0x36,
-    0x36, 0x2f, 0x24, 0x2b, 0x40, 0x40, 0x4c, 0x47, 0x27, 0x27, 0x2d, 0x3e,
-    0x3e, 0x46, 0x55, 0x55, 0x60, 0x6c, 0x87, 0x9a, 0x86, 0x56, 0x34, 0x20,
-    0x2d, 0x53, 0x6c, 0x6c, 0x72, 0x7f, 0x88, 0x94, 0xab, 0xb5, 0xca, 0xca,
-    0xbb, 0xb1, 0xa0, 0x4e, 0x1c, 0x14, 0x1b, 0x1a, 0x1d, 0x56, 0x9b, 0xb2,
-    0xb2, 0xcf, 0xb4, 0x9d, 0x67, 0x56, 0x49, 0x56, 0x57, 0x57, 0x58, 0x58,
-    0x58, 0x58, 0x58, 0x5a, 0x5a, 0x5a, 0x6b, 0x6c, 0x5e, 0x56, 0x49, 0x49,
-    0x49, 0x49, 0x4f, 0x59, 0x59, 0x59, 0x59, 0x4f, 0x34, 0x1b, 0x10, 0x0d,
-    0x0a, 0x0d, 0x10, 0x2a, 0x7d, 0xc6, 0xc9, 0xb5, 0xb8, 0xd7, 0xd7, 0xca,
-    0xab, 0x8a, 0x8a, 0x76, 0x5b, 0x57, 0x4b, 0x42, 0x8c, 0xd5, 0xca, 0xce,
-    0xcc, 0x8a, 0x88, 0x93, 0x7f, 0x70, 0x9a, 0xf0, 0xe1, 0xdc, 0xce, 0xc6,
-    0xa5, 0x7f, 0x82, 0x6b, 0x58, 0x32, 0x43, 0x43, 0x6c, 0x5a, 0x6f, 0x51,
-    0x6c, 0x53, 0x51, 0x37, 0x27, 0x3a, 0x5e, 0x77, 0x63, 0x85, 0x82, 0x82,
-    0x93, 0x8c, 0x6c, 0x37, 0x37, 0x43, 0x2c, 0x37, 0x50, 0x32, 0x2c, 0x27,
-    0x1a, 0x1a, 0x27, 0x27, 0x2e, 0x44, 0x37, 0x44, 0x46, 0x39, 0x3a, 0x2e,
-    0x1f, 0x12, 0x12, 0x3e, 0x58, 0x74, 0x75, 0x77, 0x77, 0x6c, 0x6c, 0x6c,
-    0x5a, 0x60, 0x60, 0x50, 0x3a, 0x30, 0x30, 0x48, 0x67, 0x56, 0xa0, 0xb7,
-    0x67, 0x4e, 0x67, 0xa0, 0xbb, 0xaa, 0x8c, 0x71, 0x57, 0x58, 0x8c, 0x91,
-    0xd1, 0xf8, 0xf9, 0xf9, 0xf7, 0xeb, 0xeb, 0xeb, 0xeb, 0xe7, 0xd9, 0xe0,
-    0xe1, 0xea, 0xf7, 0xf7, 0xf9, 0xf9, 0xf8, 0xfa, 0xeb, 0xe7, 0xe7, 0xee,
-    0xfd, 0xfd, 0xf7, 0xf7, 0xfa, 0xf9, 0xf9, 0xf9, 0xf5, 0xef, 0xe9, 0xeb,
-    0xeb, 0xfa, 0xf8, 0xeb, 0xeb, 0xe9, 0xeb, 0xeb, 0xeb, 0xe1, 0xdc, 0xe0,
-    0xe0, 0xeb, 0xe9, 0xe9, 0xf7, 0xeb, 0xb4, 0x40, 0x46, 0x55, 0x60, 0x53,
-    0x47, 0x54, 0x61, 0x64, 0x5e, 0x5e, 0x5e, 0x4c, 0x15, 0x0c, 0x0c, 0x0c,
-    0x0b, 0x06, 0x06, 0x06, 0x02, 0x00, 0x00, 0x03, 0x0b, 0x16, 0x19, 0x3f,
-    0x40, 0x40, 0x2f, 0x2f, 0x36, 0x2f, 0x1f, 0x19, 0x21, 0x19, 0x1c, 0x12,
-    0x0a, 0x12, 0x2f, 0x69, 0x87, 0x7e, 0x6f, 0x61, 0x5e, 0x4c, 0x36, 0x2f,
-    0x21, 0x12, 0x19, 0x21, 0x2f, 0x3e, 0x55, 0x54, 0x4a, 0x24, 0x1f, 0x1f,
-    0x2f, 0x2f, 0x3d, 0x3e, 0x2e, 0x2f, 0x2f, 0x3d, 0x3e, 0x47, 0x55, 0x5e,
-    0x6c, 0x72, 0x85, 0x8c, 0x86, 0x7d, 0x67, 0x48, 0x56, 0x6c, 0x7a, 0x8c,
-    0xa8, 0xbb, 0xbb, 0xa5, 0x9c, 0xab, 0xab, 0xb6, 0xb5, 0xbb, 0xb1, 0x67,
-    0x20, 0x1e, 0x2d, 0x53, 0x45, 0x9a, 0xcf, 0xcf, 0xcf, 0xcf, 0xdd, 0xcf,
-    0xa0, 0x7d, 0x67, 0x87, 0x74, 0x74, 0x74, 0x74, 0x74, 0x6c, 0x77, 0x77,
-    0x77, 0x77, 0x75, 0x75, 0x5a, 0x53, 0x48, 0x48, 0x48, 0x49, 0x59, 0x59,
-    0x62, 0x59, 0x59, 0x4f, 0x4f, 0x1e, 0x10, 0x0d, 0x0d, 0x14, 0x1b, 0x31,
-    0xa0, 0xcc, 0xd5, 0xca, 0xab, 0xb5, 0xc9, 0xb8, 0x9c, 0x88, 0x7c, 0x70,
-    0x5b, 0x57, 0x42, 0x42, 0x42, 0x4b, 0x7a, 0xbe, 0xb5, 0x9c, 0x9c, 0x88,
-    0x76, 0x70, 0xb2, 0xf0, 0xeb, 0xe1, 0xdd, 0xd9, 0xa6, 0x8e, 0x66, 0x71,
-    0x57, 0x43, 0x58, 0x6b, 0x74, 0x6b, 0x77, 0x86, 0x58, 0x78, 0x51, 0x37,
-    0x37, 0x44, 0x6b, 0x74, 0x74, 0x84, 0xa3, 0x97, 0x7f, 0x72, 0x58, 0x37,
-    0x23, 0x23, 0x23, 0x23, 0x27, 0x28, 0x14, 0x14, 0x1a, 0x1d, 0x2e, 0x2e,
-    0x3e, 0x54, 0x54, 0x6f, 0x61, 0x54, 0x54, 0x2e, 0x27, 0x1b, 0x2f, 0x6b,
-    0x85, 0x97, 0x82, 0x85, 0x86, 0x75, 0x6c, 0x77, 0x77, 0x60, 0x6b, 0x44,
-    0x47, 0x53, 0x30, 0xb4, 0xe1, 0xe4, 0xe3, 0xd3, 0xdd, 0xbe, 0xc6, 0xbc,
-    0xac, 0xbc, 0xbc, 0xb1, 0xce, 0xbb, 0xaa, 0xe0, 0xfe, 0xfe, 0xfd, 0xf7,
-    0xf7, 0xeb, 0xe9, 0xe8, 0xe9, 0xe0, 0xdf, 0xeb, 0xf9, 0xfe, 0xfd, 0xf6,
-    0xf7, 0xf7, 0xf7, 0xeb, 0xee, 0xf7, 0xf7, 0xfd, 0xfd, 0xfd, 0xf6, 0xf7,
-    0xeb, 0xf0, 0xee, 0xee, 0xea, 0xf7, 0xf7, 0xfa, 0xfa, 0xfe, 0xf9, 0xeb,
-    0xf7, 0xfa, 0xfa, 0xfa, 0xf9, 0xfd, 0xf9, 0xeb, 0xe7, 0xea, 0xe9, 0xe9,
-    0xe9, 0xea, 0xce, 0x56, 0x3a, 0x46, 0x54, 0x55, 0x47, 0x47, 0x46, 0x54,
-    0x54, 0x54, 0x55, 0x21, 0x15, 0x0d, 0x16, 0x0c, 0x0b, 0x08, 0x09, 0x06,
-    0x03, 0x02, 0x02, 0x05, 0x15, 0x12, 0x21, 0x2b, 0x4c, 0x36, 0x4a, 0x36,
-    0x2e, 0x29, 0x29, 0x1f, 0x19, 0x12, 0x0d, 0x12, 0x0a, 0x1c, 0x2a, 0x69,
-    0x6f, 0x7b, 0x63, 0x63, 0x61, 0x4a, 0x36, 0x2f, 0x21, 0x16, 0x12, 0x21,
-    0x1e, 0x2b, 0x47, 0x47, 0x36, 0x2b, 0x24, 0x1f, 0x2b, 0x2b, 0x2b, 0x29,
-    0x47, 0x3e, 0x3e, 0x40, 0x3d, 0x56, 0x64, 0x53, 0x4b, 0x58, 0x71, 0x72,
-    0x7a, 0x77, 0x77, 0x64, 0x60, 0x72, 0x93, 0xa8, 0xc9, 0xdc, 0xe1, 0xcc,
-    0xa5, 0x9c, 0xab, 0xab, 0xb5, 0xc6, 0xb1, 0x67, 0x49, 0x48, 0x7a, 0xa2,
-    0x9a, 0xb2, 0xcc, 0xcc, 0xcf, 0xcf, 0xcc, 0xe1, 0xd3, 0x9d, 0x9a, 0xa2,
-    0x86, 0x85, 0x85, 0x77, 0x77, 0x91, 0x9f, 0xa2, 0xa2, 0x8c, 0x84, 0x74,
-    0x58, 0x51, 0x45, 0x45, 0x48, 0x49, 0x59, 0x59, 0x62, 0x59, 0x59, 0x4f,
-    0x4f, 0x2a, 0x10, 0x0d, 0x10, 0x14, 0x2a, 0x56, 0x9a, 0xd5, 0xc9, 0xc8,
-    0xab, 0x9c, 0x93, 0x93, 0x93, 0x7f, 0x7f, 0x72, 0x72, 0x4b, 0x37, 0x2c,
-    0x32, 0x37, 0x1d, 0x7d, 0x9b, 0xcf, 0xe6, 0xb5, 0xa5, 0xa5, 0xc6, 0xeb,
-    0xeb, 0xdd, 0xd5, 0xbb, 0xa6, 0x7f, 0x7f, 0x71, 0x42, 0x6c, 0x85, 0x74,
-    0x84, 0x97, 0x84, 0x84, 0x6b, 0x86, 0x51, 0x44, 0x37, 0x50, 0x58, 0x6b,
-    0x71, 0x84, 0xa3, 0x97, 0x7f, 0x4b, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x1d, 0x1d, 0x14, 0x14, 0x1d, 0x27, 0x3e, 0x46, 0x54, 0x61, 0x75, 0x75,
-    0x75, 0x61, 0x54, 0x46, 0x1f, 0x1d, 0x51, 0x84, 0xa2, 0xaa, 0x93, 0x8c,
-    0x85, 0x85, 0x74, 0x6b, 0x68, 0x6b, 0x4b, 0x44, 0x53, 0x78, 0xd2, 0xeb,
-    0xea, 0xdd, 0xe0, 0xe0, 0xd5, 0xd9, 0xca, 0xbc, 0xce, 0xce, 0xce, 0xdd,
-    0xe3, 0xdc, 0xdc, 0xfe, 0xfe, 0xfd, 0xf6, 0xf6, 0xed, 0xed, 0xea, 0xd7,
-    0xe6, 0xed, 0xed, 0xf9, 0xfe, 0xfd, 0xf6, 0xf6, 0xf7, 0xf9, 0xed, 0xed,
-    0xfa, 0xfe, 0xfd, 0xfd, 0xfd, 0xf6, 0xf6, 0xf6, 0xeb, 0xeb, 0xee, 0xee,
-    0xed, 0xfa, 0xfa, 0xf9, 0xfd, 0xf9, 0xfd, 0xf6, 0xe9, 0xf0, 0xfa, 0xfa,
-    0xf9, 0xf7, 0xf7, 0xe9, 0xd9, 0xdc, 0xdc, 0xe9, 0xe1, 0xdf, 0xdc, 0x78,
-    0x3e, 0x47, 0x47, 0x2c, 0x3e, 0x3e, 0x3a, 0x46, 0x46, 0x47, 0x40, 0x35,
-    0x25, 0x19, 0x19, 0x16, 0x15, 0x15, 0x15, 0x0c, 0x0b, 0x08, 0x08, 0x0b,
-    0x0b, 0x13, 0x21, 0x2b, 0x36, 0x46, 0x4a, 0x36, 0x36, 0x36, 0x36, 0x24,
-    0x19, 0x12, 0x0c, 0x0c, 0x0c, 0x13, 0x1e, 0x33, 0x64, 0x61, 0x58, 0x63,
-    0x63, 0x46, 0x36, 0x36, 0x1f, 0x19, 0x19, 0x21, 0x21, 0x1f, 0x2b, 0x2b,
-    0x1f, 0x2b, 0x1f, 0x1f, 0x2b, 0x27, 0x2e, 0x3e, 0x4a, 0x4a, 0x4a, 0x2e,
-    0x47, 0x60, 0x67, 0x45, 0x44, 0x4b, 0x58, 0x58, 0x6b, 0x5a, 0x6c, 0x60,
-    0x6c, 0x68, 0x7c, 0xa5, 0xb8, 0xd5, 0xd5, 0xd5, 0xc9, 0x93, 0xab, 0xab,
-    0xb5, 0xb5, 0xaa, 0x87, 0x78, 0x9a, 0xaa, 0xb1, 0xcc, 0xe1, 0xdd, 0xcc,
-    0xcc, 0xcc, 0xd5, 0xdd, 0xeb, 0xe3, 0xcf, 0xb1, 0xa0, 0x9f, 0x87, 0x87,
-    0x9a, 0xae, 0xbe, 0xbe, 0xaa, 0x93, 0x7f, 0x68, 0x58, 0x4b, 0x44, 0x44,
-    0x45, 0x4f, 0x59, 0x59, 0x62, 0x59, 0x59, 0x4f, 0x49, 0x2a, 0x14, 0x0d,
-    0x10, 0x1e, 0x3d, 0x78, 0xb1, 0xd7, 0xda, 0xca, 0xab, 0x9c, 0x7c, 0x71,
-    0x71, 0x72, 0x6b, 0x6c, 0x58, 0x32, 0x2c, 0x2c, 0x2c, 0x30, 0x1b, 0x10,
-    0x90, 0xf2, 0xf7, 0xeb, 0xe9, 0xdd, 0xdd, 0xeb, 0xeb, 0xd7, 0xca, 0x6b,
-    0x71, 0x71, 0x7f, 0x94, 0x4b, 0x50, 0x85, 0x8c, 0xa2, 0xa2, 0x93, 0x7f,
-    0x7a, 0x75, 0x4b, 0x23, 0x27, 0x43, 0x58, 0x6b, 0x68, 0x73, 0x83, 0x7f,
-    0x58, 0x2c, 0x23, 0x23, 0x23, 0x23, 0x30, 0x23, 0x1d, 0x1a, 0x14, 0x1a,
-    0x28, 0x2e, 0x3a, 0x44, 0x58, 0x58, 0x74, 0x74, 0x74, 0x74, 0x58, 0x43,
-    0x27, 0x27, 0x6c, 0x8c, 0xaa, 0xaa, 0x94, 0x97, 0x84, 0x85, 0x74, 0x58,
-    0x57, 0x6b, 0x6c, 0x51, 0x51, 0xcf, 0xfa, 0xf7, 0xef, 0xe7, 0xdf, 0xd9,
-    0xd9, 0xd5, 0xca, 0xc6, 0xd9, 0xce, 0xce, 0xce, 0xe0, 0xca, 0xe8, 0xfd,
-    0xfd, 0xf6, 0xf5, 0xf5, 0xf5, 0xef, 0xe6, 0xe6, 0xea, 0xe9, 0xf7, 0xfd,
-    0xfd, 0xf6, 0xef, 0xf6, 0xf7, 0xf7, 0xea, 0xea, 0xfe, 0xfe, 0xfd, 0xf9,
-    0xf7, 0xf7, 0xf7, 0xed, 0xed, 0xee, 0xfe, 0xfe, 0xf7, 0xfa, 0xf9, 0xf7,
-    0xf9, 0xee, 0xf6, 0xf6, 0xed, 0xeb, 0xe4, 0xee, 0xed, 0xf5, 0xf5, 0xea,
-    0xdc, 0xd9, 0xd5, 0xdd, 0xe3, 0xe4, 0xeb, 0xe3, 0xd2, 0xd3, 0xb4, 0x7d,
-    0x4e, 0x56, 0x53, 0x47, 0x47, 0x40, 0x21, 0x19, 0x21, 0x21, 0x21, 0x22,
-    0x16, 0x12, 0x12, 0x13, 0x15, 0x0c, 0x0a, 0x08, 0x08, 0x15, 0x21, 0x2b,
-    0x3a, 0x46, 0x46, 0x46, 0x36, 0x2e, 0x2f, 0x24, 0x19, 0x16, 0x0c, 0x06,
-    0x08, 0x0a, 0x19, 0x1b, 0x3d, 0x51, 0x6b, 0x63, 0x61, 0x46, 0x36, 0x1f,
-    0x1f, 0x12, 0x10, 0x1e, 0x2b, 0x2f, 0x2f, 0x36, 0x29, 0x3e, 0x36, 0x2f,
-    0x1f, 0x27, 0x2e, 0x3e, 0x47, 0x47, 0x3e, 0x30, 0x51, 0x6c, 0x60, 0x60,
-    0x5a, 0x5a, 0x51, 0x44, 0x44, 0x51, 0x6c, 0x6c, 0x6b, 0x6b, 0x72, 0x93,
-    0xa5, 0xa5, 0xca, 0xc9, 0xd5, 0xbb, 0xb8, 0xb8, 0xb8, 0xb8, 0xa8, 0x8c,
-    0x8c, 0xb1, 0xbb, 0xc9, 0xdc, 0xdd, 0xeb, 0xdd, 0xc6, 0xc6, 0xc9, 0xd7,
-    0xdc, 0xea, 0xdd, 0xe1, 0xa1, 0xa1, 0xa0, 0xa0, 0xb4, 0xd1, 0xcf, 0xce,
-    0xbb, 0x94, 0x71, 0x68, 0x57, 0x4b, 0x44, 0x44, 0x45, 0x4f, 0x59, 0x59,
-    0x62, 0x59, 0x4f, 0x34, 0x34, 0x2a, 0x14, 0x10, 0x1b, 0x2d, 0x53, 0x86,
-    0xb1, 0xd7, 0xda, 0xc8, 0xab, 0x9c, 0x70, 0x5b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x32, 0x2c, 0x2c, 0x2c, 0x2c, 0x23, 0x14, 0x3c, 0xe5, 0xfa, 0xf0, 0xeb,
-    0xdd, 0xdd, 0xeb, 0xf0, 0xeb, 0xdd, 0xc8, 0x8e, 0x76, 0x76, 0x70, 0x70,
-    0x4b, 0x57, 0x58, 0x8c, 0xac, 0xaa, 0x94, 0x7f, 0x71, 0x50, 0x2c, 0x2c,
-    0x23, 0x2c, 0x43, 0x37, 0x4b, 0x50, 0x4b, 0x43, 0x37, 0x27, 0x23, 0x2c,
-    0x2c, 0x30, 0x30, 0x30, 0x2d, 0x1d, 0x1a, 0x27, 0x23, 0x2c, 0x2c, 0x43,
-    0x50, 0x58, 0x73, 0x73, 0x84, 0x73, 0x6b, 0x43, 0x23, 0x37, 0x75, 0xa2,
-    0xaa, 0x93, 0x94, 0x82, 0x71, 0x71, 0x74, 0x6b, 0x58, 0x6b, 0x6b, 0x58,
-    0x86, 0xeb, 0xfa, 0xf7, 0xea, 0xdf, 0xd9, 0xd9, 0xca, 0xd5, 0xd5, 0xca,
-    0xca, 0xc8, 0xb6, 0xca, 0xbc, 0xce, 0xeb, 0xf6, 0xf5, 0xf5, 0xef, 0xf5,
-    0xef, 0xde, 0xd8, 0xd8, 0xda, 0xe9, 0xfd, 0xfd, 0xf6, 0xef, 0xdb, 0xef,
-    0xf7, 0xef, 0xde, 0xe7, 0xfa, 0xfe, 0xfd, 0xf7, 0xed, 0xf7, 0xf7, 0xed,
-    0xed, 0xee, 0xfe, 0xfe, 0xf9, 0xfa, 0xf9, 0xf7, 0xf9, 0xed, 0xeb, 0xeb,
-    0xe3, 0xf0, 0xee, 0xe1, 0xea, 0xef, 0xe6, 0xe9, 0xe1, 0xdd, 0xdd, 0xe1,
-    0xf0, 0xf3, 0xf0, 0xed, 0xf7, 0xf9, 0xfa, 0xf0, 0xba, 0x6a, 0x5e, 0x55,
-    0x6a, 0x80, 0x4f, 0x1e, 0x1e, 0x33, 0x2f, 0x21, 0x16, 0x19, 0x1c, 0x1c,
-    0x16, 0x12, 0x12, 0x13, 0x13, 0x13, 0x1c, 0x1f, 0x2e, 0x43, 0x4d, 0x4d,
-    0x3a, 0x2e, 0x2b, 0x19, 0x0c, 0x16, 0x09, 0x05, 0x08, 0x0d, 0x21, 0x1f,
-    0x1f, 0x2e, 0x44, 0x54, 0x46, 0x36, 0x2b, 0x14, 0x14, 0x19, 0x12, 0x1a,
-    0x28, 0x2d, 0x2e, 0x3e, 0x36, 0x36, 0x36, 0x28, 0x1f, 0x28, 0x3d, 0x3d,
-    0x27, 0x30, 0x30, 0x44, 0x60, 0x77, 0x5a, 0x6b, 0x7a, 0x86, 0x6f, 0x45,
-    0x30, 0x53, 0x6c, 0x6c, 0x58, 0x58, 0x6b, 0x7f, 0x94, 0xa6, 0xa5, 0xb5,
-    0xc9, 0xcc, 0xcc, 0xbb, 0xb8, 0xb8, 0xa5, 0xa2, 0xa8, 0xb1, 0xb8, 0xc9,
-    0xc9, 0xcc, 0xdd, 0xcf, 0xb1, 0xb1, 0xc9, 0xc9, 0xd5, 0xd7, 0xdd, 0xe1,
-    0x8f, 0xa1, 0x9d, 0x9d, 0xb4, 0xd2, 0xe0, 0xd5, 0xb5, 0x94, 0x7f, 0x68,
-    0x57, 0x4b, 0x44, 0x43, 0x30, 0x49, 0x59, 0x59, 0x59, 0x59, 0x34, 0x20,
-    0x34, 0x31, 0x1b, 0x14, 0x2a, 0x55, 0x60, 0x8c, 0xce, 0xd7, 0xda, 0xc1,
-    0x9c, 0x88, 0x70, 0x5b, 0x42, 0x42, 0x42, 0x32, 0x2c, 0x2c, 0x2c, 0x2c,
-    0x23, 0x1a, 0x10, 0x9e, 0xfc, 0xfa, 0xf7, 0xe9, 0xdc, 0xdd, 0xfa, 0xeb,
-    0xeb, 0xdc, 0xc8, 0x8e, 0x79, 0x76, 0x70, 0x5b, 0x71, 0x7f, 0x68, 0x68,
-    0x71, 0x7f, 0x7f, 0x68, 0x57, 0x42, 0x43, 0x32, 0x37, 0x44, 0x37, 0x2c,
-    0x23, 0x2c, 0x2c, 0x2c, 0x23, 0x23, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x30,
-    0x30, 0x1d, 0x1a, 0x27, 0x2e, 0x2c, 0x2c, 0x43, 0x50, 0x58, 0x68, 0x7f,
-    0x83, 0x83, 0x66, 0x42, 0x23, 0x27, 0x6c, 0x8c, 0x93, 0x94, 0x94, 0x7f,
-    0x71, 0x71, 0x57, 0x57, 0x6b, 0x58, 0x50, 0x51, 0xcf, 0xed, 0xed, 0xea,
-    0xeb, 0xe1, 0xd9, 0xc8, 0xbf, 0xca, 0xd9, 0xd7, 0xc8, 0xa9, 0xc8, 0xd7,
-    0xdc, 0xdc, 0xf7, 0xf5, 0xf6, 0xf7, 0xea, 0xd8, 0xd8, 0xe6, 0xe7, 0xd8,
-    0xe6, 0xf7, 0xfa, 0xfd, 0xf5, 0xf5, 0xdb, 0xd8, 0xf6, 0xe6, 0xde, 0xeb,
-    0xfa, 0xfd, 0xf7, 0xf7, 0xfd, 0xfd, 0xf7, 0xf6, 0xf7, 0xf9, 0xfd, 0xf9,
-    0xf9, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xf9, 0xee, 0xee, 0xf0, 0xfa, 0xf7,
-    0xeb, 0xe9, 0xeb, 0xeb, 0xf0, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xee, 0xea,
-    0xed, 0xf6, 0xf9, 0xf9, 0xe3, 0x87, 0x64, 0x9d, 0xb9, 0xb4, 0xb4, 0x9d,
-    0x48, 0x2f, 0x2f, 0x21, 0x19, 0x1c, 0x21, 0x1e, 0x19, 0x19, 0x19, 0x14,
-    0x12, 0x0a, 0x13, 0x14, 0x1d, 0x3a, 0x46, 0x3a, 0x27, 0x1f, 0x1e, 0x0d,
-    0x0c, 0x0c, 0x09, 0x03, 0x08, 0x1c, 0x21, 0x1f, 0x1f, 0x28, 0x2e, 0x2e,
-    0x36, 0x1f, 0x2b, 0x1e, 0x19, 0x19, 0x12, 0x14, 0x1f, 0x1f, 0x2b, 0x2e,
-    0x47, 0x4a, 0x29, 0x27, 0x2e, 0x3e, 0x40, 0x2b, 0x2d, 0x2e, 0x45, 0x53,
-    0x77, 0x77, 0x60, 0x72, 0x7a, 0x86, 0x77, 0x47, 0x30, 0x51, 0x6c, 0x61,
-    0x54, 0x50, 0x58, 0x66, 0x71, 0x88, 0x94, 0xa6, 0xca, 0xc9, 0xc6, 0xa8,
-    0xa5, 0xa8, 0xb8, 0xc6, 0xe1, 0xe1, 0xcf, 0xc6, 0xc9, 0xbb, 0xcc, 0xb1,
-    0xa8, 0xb8, 0xb8, 0xb6, 0xd7, 0xdc, 0xdd, 0xcf, 0x92, 0x92, 0x8f, 0xa1,
-    0xba, 0xd2, 0xe0, 0xd5, 0xca, 0x9c, 0x7f, 0x71, 0x57, 0x4b, 0x42, 0x32,
-    0x2c, 0x49, 0x4f, 0x59, 0x59, 0x59, 0x31, 0x20, 0x34, 0x31, 0x1d, 0x1d,
-    0x48, 0x60, 0x7a, 0xa2, 0xdd, 0xdc, 0xc9, 0xab, 0x88, 0x88, 0x71, 0x4b,
-    0x4b, 0x42, 0x32, 0x2c, 0x2c, 0x2c, 0x2c, 0x23, 0x1a, 0x10, 0x13, 0xc4,
-    0xfc, 0xf7, 0xeb, 0xeb, 0xdd, 0xcc, 0xf0, 0xf0, 0xe1, 0xdc, 0xc8, 0x89,
-    0x76, 0x5c, 0x5b, 0x57, 0x8c, 0xa2, 0x82, 0x68, 0x5b, 0x57, 0x57, 0x4b,
-    0x32, 0x32, 0x42, 0x32, 0x37, 0x44, 0x37, 0x37, 0x37, 0x32, 0x2c, 0x37,
-    0x37, 0x44, 0x44, 0x44, 0x37, 0x37, 0x37, 0x2c, 0x27, 0x14, 0x1b, 0x28,
-    0x23, 0x30, 0x2c, 0x43, 0x50, 0x58, 0x68, 0x71, 0x71, 0x73, 0x57, 0x43,
-    0x1a, 0x1e, 0x51, 0x71, 0x7f, 0x7f, 0x7f, 0x72, 0x82, 0x72, 0x57, 0x68,
-    0x72, 0x57, 0x50, 0x77, 0xdd, 0xea, 0xe7, 0xe6, 0xd9, 0xed, 0xd9, 0xca,
-    0xad, 0xc8, 0xc1, 0xc8, 0xd5, 0xa7, 0xc8, 0xd5, 0xca, 0xca, 0xea, 0xf6,
-    0xf6, 0xf5, 0xea, 0xe7, 0xd6, 0xef, 0xf6, 0xe6, 0xea, 0xf9, 0xfd, 0xfd,
-    0xf5, 0xf6, 0xef, 0xde, 0xef, 0xf5, 0xf7, 0xf9, 0xfa, 0xf9, 0xf9, 0xfd,
-    0xfd, 0xfd, 0xf7, 0xf7, 0xf9, 0xfd, 0xfe, 0xf9, 0xf9, 0xf0, 0xf0, 0xfa,
-    0xfa, 0xfa, 0xfa, 0xf9, 0xee, 0xf0, 0xf3, 0xfa, 0xf9, 0xf9, 0xfa, 0xf0,
-    0xeb, 0xf9, 0xf9, 0xfa, 0xeb, 0xeb, 0xeb, 0xdc, 0xea, 0xef, 0xea, 0xed,
-    0xe3, 0xd3, 0xb4, 0xd4, 0xd2, 0xcf, 0xe3, 0xe1, 0xcf, 0x87, 0x40, 0x1e,
-    0x21, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x19, 0x1b, 0x1c, 0x0a, 0x13, 0x12,
-    0x1b, 0x1b, 0x1f, 0x1f, 0x1f, 0x19, 0x0d, 0x08, 0x08, 0x08, 0x05, 0x03,
-    0x05, 0x13, 0x22, 0x1e, 0x2b, 0x3d, 0x3d, 0x3e, 0x4c, 0x2b, 0x29, 0x2b,
-    0x1e, 0x19, 0x12, 0x0d, 0x19, 0x19, 0x1f, 0x2b, 0x2e, 0x2f, 0x36, 0x2e,
-    0x3e, 0x48, 0x40, 0x2b, 0x3d, 0x30, 0x30, 0x51, 0x60, 0x77, 0x77, 0x75,
-    0x6c, 0x75, 0x6f, 0x53, 0x51, 0x4b, 0x43, 0x51, 0x50, 0x43, 0x4b, 0x57,
-    0x5b, 0x76, 0x88, 0x9c, 0xab, 0xc8, 0xc9, 0xb8, 0xb8, 0xa8, 0xc9, 0xdc,
-    0xe3, 0xeb, 0xe1, 0xdc, 0xcc, 0xbb, 0xaa, 0x8c, 0x9c, 0x9c, 0xb8, 0xb5,
-    0xc6, 0xc9, 0xc9, 0xb8, 0x8b, 0x92, 0x92, 0x8f, 0xba, 0xd3, 0xe0, 0xd5,
-    0xb6, 0x9c, 0x7f, 0x72, 0x6b, 0x58, 0x4b, 0x32, 0x2c, 0x3d, 0x4f, 0x59,
-    0x59, 0x6e, 0x31, 0x1d, 0x2a, 0x31, 0x31, 0x2d, 0x64, 0x7a, 0x72, 0xb1,
-    0xdd, 0xdc, 0xc9, 0xab, 0x88, 0x7c, 0x68, 0x4b, 0x4b, 0x42, 0x32, 0x2c,
-    0x2c, 0x2c, 0x23, 0x23, 0x14, 0x0d, 0x1c, 0xb9, 0xfa, 0xeb, 0xe9, 0xdc,
-    0xc2, 0xa5, 0xeb, 0xf0, 0xeb, 0xd7, 0xa7, 0x7f, 0x7c, 0x5b, 0x4b, 0x4b,
-    0x68, 0x8c, 0xaa, 0x93, 0x94, 0x71, 0x68, 0x57, 0x4b, 0x42, 0x4b, 0x42,
-    0x42, 0x37, 0x2c, 0x42, 0x32, 0x43, 0x32, 0x43, 0x43, 0x50, 0x50, 0x50,
-    0x42, 0x42, 0x37, 0x2c, 0x1a, 0x0d, 0x10, 0x1a, 0x27, 0x23, 0x2c, 0x37,
-    0x37, 0x43, 0x4b, 0x57, 0x57, 0x4b, 0x43, 0x23, 0x14, 0x0a, 0x45, 0x72,
-    0x71, 0x84, 0x84, 0x72, 0x71, 0x72, 0x57, 0x72, 0x74, 0x58, 0x43, 0x60,
-    0xd5, 0xd7, 0xd9, 0xe7, 0xc8, 0xde, 0xc8, 0xc8, 0xc8, 0xca, 0xc8, 0xc5,
-    0xdf, 0xd7, 0xca, 0xc8, 0xa9, 0xb6, 0xe6, 0xf7, 0xf6, 0xd8, 0xd6, 0xd8,
-    0xd8, 0xda, 0xef, 0xe9, 0xe6, 0xf7, 0xf7, 0xf6, 0xef, 0xef, 0xed, 0xf6,
-    0xf7, 0xfe, 0xfe, 0xfd, 0xfa, 0xfe, 0xfe, 0xf9, 0xfd, 0xf9, 0xf9, 0xf7,
-    0xfa, 0xf9, 0xf9, 0xf9, 0xee, 0xf0, 0xf0, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9,
-    0xed, 0xee, 0xf0, 0xf0, 0xf9, 0xf9, 0xf9, 0xeb, 0xed, 0xf7, 0xf9, 0xf9,
-    0xf7, 0xe0, 0xe0, 0xd9, 0xe6, 0xe6, 0xe7, 0xd9, 0xdc, 0xd3, 0xb2, 0xbc,
-    0xce, 0xce, 0xe3, 0xe1, 0xdc, 0xdc, 0x87, 0x2f, 0x1f, 0x2b, 0x2b, 0x1f,
-    0x2b, 0x2b, 0x21, 0x20, 0x20, 0x22, 0x20, 0x1c, 0x1c, 0x0c, 0x0a, 0x0a,
-    0x15, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x05, 0x02, 0x03, 0x08, 0x13, 0x1e,
-    0x33, 0x40, 0x4a, 0x47, 0x4a, 0x2d, 0x3e, 0x2d, 0x2b, 0x1e, 0x0d, 0x0d,
-    0x0d, 0x12, 0x19, 0x1f, 0x1f, 0x2b, 0x36, 0x3e, 0x47, 0x40, 0x2b, 0x1f,
-    0x27, 0x30, 0x53, 0x60, 0x7a, 0x7a, 0x87, 0x86, 0x75, 0x75, 0x6f, 0x5a,
-    0x5a, 0x43, 0x37, 0x43, 0x43, 0x43, 0x57, 0x68, 0x7f, 0x7f, 0x7c, 0x9c,
-    0xab, 0xab, 0xb6, 0xb8, 0xa2, 0xa8, 0xb5, 0xc6, 0xd5, 0xd7, 0xd7, 0xdc,
-    0xdd, 0xb1, 0x8c, 0x82, 0x93, 0x9c, 0xab, 0xcc, 0xc9, 0xc9, 0xb8, 0xc9,
-    0x8b, 0x8b, 0x92, 0x92, 0xba, 0xd3, 0xe0, 0xd9, 0xca, 0x9c, 0x7f, 0x71,
-    0x72, 0x6b, 0x4b, 0x42, 0x2c, 0x30, 0x49, 0x6e, 0x6e, 0x6e, 0x31, 0x1d,
-    0x28, 0x31, 0x31, 0x3d, 0x64, 0x7a, 0x72, 0xaa, 0xdc, 0xd7, 0xca, 0xab,
-    0x88, 0x70, 0x4b, 0x42, 0x42, 0x42, 0x2c, 0x2c, 0x23, 0x23, 0x23, 0x1a,
-    0x14, 0x0a, 0x1c, 0xb9, 0xeb, 0xeb, 0xdc, 0xc9, 0xb5, 0xa5, 0xdd, 0xeb,
-    0xe6, 0xc1, 0xa7, 0x8e, 0x7c, 0x5b, 0x4b, 0x57, 0x5b, 0x71, 0xbb, 0xb8,
-    0xa5, 0x7f, 0x71, 0x68, 0x57, 0x57, 0x4b, 0x4b, 0x4b, 0x23, 0x23, 0x42,
-    0x42, 0x4b, 0x4b, 0x4b, 0x4b, 0x50, 0x50, 0x57, 0x4b, 0x42, 0x37, 0x27,
-    0x14, 0x0d, 0x10, 0x14, 0x1a, 0x1a, 0x1a, 0x27, 0x37, 0x44, 0x44, 0x42,
-    0x42, 0x37, 0x23, 0x14, 0x07, 0x05, 0x1e, 0x51, 0x6b, 0x74, 0x72, 0x68,
-    0x57, 0x6b, 0x57, 0x57, 0x6b, 0x58, 0x37, 0x2c, 0xaa, 0xc6, 0xca, 0xde,
-    0xc8, 0xa7, 0xc1, 0xc5, 0xb6, 0xdd, 0xd7, 0xa7, 0xc8, 0xc8, 0xa7, 0xa7,
-    0xa7, 0x8a, 0xd5, 0xe9, 0xf6, 0xe6, 0xc5, 0xdb, 0xe6, 0xd8, 0xc5, 0xe9,
-    0xea, 0xe9, 0xf9, 0xf6, 0xef, 0xdb, 0xe7, 0xf7, 0xfe, 0xfe, 0xfd, 0xfd,
-    0xf9, 0xfe, 0xfe, 0xf7, 0xf7, 0xfd, 0xfd, 0xf7, 0xf9, 0xf9, 0xf9, 0xfa,
-    0xf0, 0xf0, 0xfa, 0xfa, 0xf9, 0xf9, 0xeb, 0xeb, 0xe9, 0xe1, 0xf0, 0xf0,
-    0xee, 0xea, 0xef, 0xe7, 0xe7, 0xeb, 0xf7, 0xed, 0xea, 0xd9, 0xdc, 0xd9,
-    0xde, 0xd8, 0xdb, 0xd9, 0xd5, 0xbe, 0xbb, 0xb5, 0xbe, 0xbe, 0xce, 0xdc,
-    0xdc, 0xdc, 0xcf, 0x3d, 0x1f, 0x2b, 0x2b, 0x24, 0x2b, 0x2b, 0x1e, 0x1e,
-    0x1e, 0x2a, 0x20, 0x22, 0x22, 0x12, 0x0c, 0x08, 0x0b, 0x0b, 0x08, 0x08,
-    0x0c, 0x08, 0x09, 0x02, 0x02, 0x04, 0x05, 0x13, 0x2a, 0x3d, 0x40, 0x47,
-    0x47, 0x3e, 0x3e, 0x2e, 0x2b, 0x1b, 0x12, 0x1c, 0x12, 0x0d, 0x12, 0x12,
-    0x21, 0x1f, 0x2e, 0x3e, 0x47, 0x2b, 0x1f, 0x1f, 0x2e, 0x30, 0x60, 0x78,
-    0x7a, 0x7a, 0x86, 0x86, 0x86, 0x86, 0x77, 0x6c, 0x58, 0x51, 0x44, 0x50,
-    0x58, 0x58, 0x57, 0x7f, 0x8c, 0x8c, 0x7f, 0xab, 0xb5, 0xb8, 0x93, 0x93,
-    0x82, 0x94, 0xab, 0xab, 0xc8, 0xca, 0xd5, 0xd5, 0xdc, 0xcc, 0x8c, 0x82,
-    0xa8, 0xaa, 0x9c, 0xb5, 0xb8, 0xc9, 0xb8, 0xb8, 0x8b, 0x8b, 0x8b, 0x92,
-    0x92, 0xe3, 0xe0, 0xdc, 0xca, 0xab, 0x88, 0x7f, 0x68, 0x57, 0x4b, 0x32,
-    0x2c, 0x30, 0x49, 0x59, 0x8f, 0x4f, 0x2d, 0x23, 0x23, 0x3d, 0x3d, 0x30,
-    0x53, 0x75, 0x71, 0x8c, 0xc6, 0xd7, 0xc1, 0x8a, 0x76, 0x5b, 0x4b, 0x42,
-    0x32, 0x32, 0x2c, 0x23, 0x23, 0x23, 0x1a, 0x14, 0x0d, 0x0a, 0x1c, 0x7d,
-    0xdd, 0xdc, 0xd7, 0xb8, 0xb5, 0x9c, 0xab, 0xe6, 0xde, 0xbf, 0x89, 0x8a,
-    0x76, 0x5c, 0x5b, 0x5b, 0x68, 0x8c, 0xcf, 0xcc, 0xb8, 0x94, 0x7c, 0x76,
-    0x66, 0x68, 0x42, 0x42, 0x42, 0x2c, 0x2c, 0x32, 0x43, 0x58, 0x57, 0x57,
-    0x57, 0x68, 0x68, 0x68, 0x57, 0x42, 0x2c, 0x1d, 0x14, 0x14, 0x1a, 0x14,
-    0x14, 0x10, 0x0d, 0x1b, 0x2d, 0x30, 0x28, 0x28, 0x28, 0x1a, 0x10, 0x0a,
-    0x05, 0x03, 0x0a, 0x30, 0x4b, 0x6b, 0x6b, 0x57, 0x68, 0x72, 0x6b, 0x4b,
-    0x4b, 0x43, 0x2c, 0x30, 0x7d, 0xdd, 0xd5, 0xca, 0xad, 0xb6, 0xd9, 0xde,
-    0xb6, 0xdc, 0xe6, 0xc8, 0xa9, 0x8d, 0xa9, 0xc6, 0xdc, 0xd5, 0xe9, 0xe9,
-    0xf6, 0xda, 0xd8, 0xea, 0xf6, 0xd8, 0xc5, 0xea, 0xeb, 0xeb, 0xfa, 0xf9,
-    0xf6, 0xea, 0xf6, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xfa, 0xfd, 0xfd,
-    0xfd, 0xfd, 0xfd, 0xf7, 0xf7, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa,
-    0xf9, 0xf6, 0xea, 0xea, 0xdd, 0xe0, 0xe3, 0xee, 0xe0, 0xd9, 0xde, 0xe2,
-    0xdc, 0xe9, 0xea, 0xe6, 0xe6, 0xd7, 0xd5, 0xd5, 0xd5, 0xc8, 0xc8, 0xd5,
-    0xce, 0xbe, 0xbb, 0xbb, 0xbb, 0xce, 0xbc, 0xce, 0xdd, 0xcf, 0xce, 0x47,
-    0x1f, 0x1f, 0x2b, 0x2b, 0x36, 0x36, 0x2b, 0x1e, 0x1e, 0x33, 0x35, 0x21,
-    0x21, 0x19, 0x19, 0x0a, 0x07, 0x0c, 0x0a, 0x0a, 0x13, 0x0c, 0x08, 0x03,
-    0x00, 0x00, 0x02, 0x05, 0x22, 0x2f, 0x2f, 0x3e, 0x3e, 0x3e, 0x2e, 0x29,
-    0x1e, 0x14, 0x10, 0x1b, 0x1c, 0x13, 0x0b, 0x05, 0x08, 0x0d, 0x1b, 0x1f,
-    0x1f, 0x1f, 0x2b, 0x2d, 0x3e, 0x37, 0x5a, 0x86, 0x7a, 0x7a, 0x86, 0x86,
-    0x86, 0x86, 0x77, 0x58, 0x50, 0x43, 0x44, 0x4b, 0x6b, 0x6b, 0x57, 0x71,
-    0x71, 0x7f, 0x7c, 0x8a, 0x9c, 0x93, 0x82, 0x72, 0x71, 0x7f, 0x94, 0xa6,
-    0xb6, 0xc8, 0xc9, 0xc9, 0xd5, 0xd5, 0xbe, 0x8c, 0xab, 0x9c, 0x88, 0x8a,
-    0x9c, 0xb5, 0xa5, 0x9c, 0x8b, 0x8b, 0x5f, 0x5f, 0x92, 0xe3, 0xe0, 0xdc,
-    0xc9, 0xab, 0x88, 0x7f, 0x71, 0x57, 0x4b, 0x32, 0x2c, 0x30, 0x49, 0x6e,
-    0x6e, 0x67, 0x45, 0x2c, 0x30, 0x45, 0x30, 0x2d, 0x45, 0x6c, 0x68, 0x72,
-    0xa2, 0xb5, 0xab, 0x8a, 0x76, 0x5b, 0x42, 0x42, 0x32, 0x37, 0x23, 0x23,
-    0x27, 0x1d, 0x14, 0x0d, 0x0a, 0x0a, 0x20, 0x48, 0xae, 0xd5, 0xc2, 0xab,
-    0xab, 0x8a, 0x76, 0xc9, 0xd7, 0xad, 0x89, 0x79, 0x76, 0x5c, 0x5b, 0x5b,
-    0x68, 0xb1, 0xe3, 0xcf, 0xc6, 0xb6, 0x8a, 0x76, 0x66, 0x68, 0x4b, 0x32,
-    0x2c, 0x37, 0x37, 0x32, 0x2c, 0x42, 0x68, 0x68, 0x73, 0x7f, 0x7f, 0x71,
-    0x57, 0x37, 0x1a, 0x14, 0x10, 0x14, 0x1a, 0x1a, 0x1a, 0x14, 0x0d, 0x14,
-    0x1d, 0x1a, 0x14, 0x14, 0x14, 0x14, 0x10, 0x0a, 0x05, 0x05, 0x0a, 0x2d,
-    0x51, 0x57, 0x58, 0x6b, 0x6b, 0x6b, 0x6b, 0x50, 0x58, 0x58, 0x37, 0x30,
-    0x56, 0xb2, 0xc6, 0xc8, 0xb6, 0xca, 0xe0, 0xd9, 0xc5, 0xbf, 0xca, 0xb6,
-    0x8a, 0x76, 0xab, 0xbc, 0xdc, 0xdd, 0xea, 0xe6, 0xe6, 0xda, 0xef, 0xf6,
-    0xf9, 0xf7, 0xe6, 0xed, 0xed, 0xfa, 0xfe, 0xfd, 0xfe, 0xf9, 0xfa, 0xfe,
-    0xf9, 0xf9, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf6,
-    0xf7, 0xf9, 0xfa, 0xfa, 0xfe, 0xfe, 0xfe, 0xf8, 0xf9, 0xed, 0xef, 0xdf,
-    0xe0, 0xe3, 0xe3, 0xe3, 0xe1, 0xdf, 0xd9, 0xd9, 0xe0, 0xdd, 0xd7, 0xd7,
-    0xd7, 0xd5, 0xdc, 0xdd, 0xc6, 0xd5, 0xce, 0xbe, 0xbe, 0xbb, 0xbb, 0xac,
-    0xbe, 0xbe, 0xbc, 0xce, 0xc6, 0xbb, 0xbb, 0x56, 0x1e, 0x1e, 0x2f, 0x2b,
-    0x36, 0x36, 0x2b, 0x2b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2b, 0x2b, 0x1f, 0x12,
-    0x0a, 0x0c, 0x13, 0x12, 0x12, 0x0c, 0x08, 0x06, 0x02, 0x00, 0x00, 0x02,
-    0x0b, 0x1c, 0x1f, 0x2e, 0x3e, 0x3e, 0x2f, 0x1f, 0x1e, 0x14, 0x1b, 0x1c,
-    0x20, 0x1c, 0x0c, 0x05, 0x05, 0x08, 0x0a, 0x19, 0x1b, 0x1f, 0x28, 0x48,
-    0x48, 0x51, 0x6c, 0x77, 0x82, 0x72, 0x86, 0x86, 0x86, 0x75, 0x72, 0x44,
-    0x2c, 0x2c, 0x2c, 0x43, 0x43, 0x43, 0x32, 0x57, 0x71, 0x82, 0x82, 0x70,
-    0x71, 0x71, 0x72, 0x6b, 0x68, 0x82, 0x93, 0xa5, 0xa5, 0xb6, 0xb5, 0xca,
-    0xb5, 0xc9, 0xc6, 0x93, 0x88, 0xa5, 0xcc, 0xc9, 0xcc, 0xa8, 0xa8, 0x94,
-    0x8b, 0x5f, 0x5f, 0x5f, 0x92, 0xd3, 0xe0, 0xdc, 0xc9, 0xb5, 0x9c, 0x88,
-    0x71, 0x71, 0x72, 0x72, 0x5a, 0x45, 0x67, 0x6e, 0x6e, 0x60, 0x4b, 0x4b,
-    0x44, 0x45, 0x30, 0x23, 0x23, 0x44, 0x4b, 0x4b, 0x72, 0x93, 0x9c, 0x8a,
-    0x70, 0x57, 0x32, 0x37, 0x37, 0x30, 0x1d, 0x1a, 0x1b, 0x14, 0x0d, 0x0a,
-    0x07, 0x13, 0x34, 0x53, 0x6c, 0x93, 0x93, 0x9c, 0x88, 0x7c, 0x70, 0x7f,
-    0xa6, 0xa6, 0x8a, 0x79, 0x5c, 0x5b, 0x68, 0x68, 0x7a, 0xb4, 0xe4, 0xe3,
-    0xc6, 0xb5, 0x9c, 0x76, 0x5b, 0x4b, 0x42, 0x43, 0x32, 0x2c, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x42, 0x58, 0x73, 0x83, 0x7f, 0x68, 0x42, 0x23, 0x14, 0x14,
-    0x14, 0x14, 0x1a, 0x1a, 0x14, 0x1b, 0x14, 0x14, 0x14, 0x1a, 0x1b, 0x14,
-    0x0d, 0x0d, 0x0d, 0x0a, 0x05, 0x05, 0x0c, 0x1e, 0x45, 0x51, 0x5a, 0x6b,
-    0x6b, 0x58, 0x58, 0x75, 0x77, 0x60, 0x45, 0x60, 0x7a, 0xb1, 0xb5, 0xb6,
-    0xa6, 0xab, 0xab, 0xb6, 0xb6, 0xb6, 0xce, 0xd1, 0xc6, 0xab, 0xd5, 0xd5,
-    0xd7, 0xdc, 0xdc, 0xe6, 0xed, 0xfd, 0xfd, 0xfd, 0xf7, 0xf7, 0xed, 0xeb,
-    0xfa, 0xfe, 0xfe, 0xfd, 0xfd, 0xf7, 0xf9, 0xfe, 0xfd, 0xf9, 0xfe, 0xfe,
-    0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf6, 0xf7, 0xf7, 0xfa, 0xfa, 0xfe,
-    0xfe, 0xfe, 0xf8, 0xf9, 0xed, 0xea, 0xe7, 0xea, 0xeb, 0xe1, 0xe1, 0xe1,
-    0xe3, 0xe1, 0xe0, 0xdd, 0xe1, 0xdd, 0xdc, 0xdd, 0xdd, 0xdd, 0xe1, 0xdd,
-    0xc6, 0xcf, 0xe3, 0xd2, 0xce, 0xbb, 0xbb, 0xae, 0xaa, 0xaf, 0xa6, 0xa6,
-    0x9c, 0xa6, 0xaa, 0x6a, 0x52, 0x52, 0x35, 0x29, 0x2e, 0x36, 0x2f, 0x2d,
-    0x2f, 0x2b, 0x2f, 0x2d, 0x2d, 0x28, 0x2f, 0x1e, 0x12, 0x12, 0x12, 0x13,
-    0x13, 0x0c, 0x08, 0x05, 0x02, 0x00, 0x02, 0x02, 0x06, 0x0c, 0x0d, 0x1b,
-    0x2b, 0x2b, 0x1b, 0x1e, 0x21, 0x1e, 0x2a, 0x20, 0x2a, 0x22, 0x0c, 0x05,
-    0x05, 0x0c, 0x0d, 0x19, 0x19, 0x2b, 0x2e, 0x3d, 0x56, 0x5a, 0x77, 0x77,
-    0x75, 0x72, 0x82, 0x7a, 0x7a, 0x85, 0x6c, 0x2e, 0x30, 0x27, 0x23, 0x2c,
-    0x43, 0x42, 0x37, 0x4b, 0x82, 0x82, 0x82, 0x72, 0x71, 0x72, 0x6b, 0x58,
-    0x68, 0x71, 0x7f, 0x7f, 0x88, 0xb5, 0xb8, 0xcc, 0xb8, 0xb5, 0xb8, 0xa5,
-    0xa5, 0xd7, 0xeb, 0xf0, 0xeb, 0xdd, 0xcf, 0x93, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x92, 0xd3, 0xe0, 0xdc, 0xd7, 0xca, 0xab, 0x9c, 0xa8, 0xb1, 0xcc, 0xc6,
-    0xa8, 0x9a, 0x7d, 0x80, 0x7d, 0x7a, 0x72, 0x68, 0x57, 0x42, 0x37, 0x2c,
-    0x23, 0x30, 0x37, 0x45, 0x6c, 0x82, 0x93, 0x94, 0x71, 0x4b, 0x37, 0x2c,
-    0x30, 0x1a, 0x14, 0x0d, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x1c, 0x49, 0x53,
-    0x4b, 0x4b, 0x58, 0x71, 0x71, 0x71, 0x6b, 0x68, 0x71, 0x71, 0x70, 0x68,
-    0x57, 0x42, 0x44, 0x7a, 0xa2, 0xb2, 0xe1, 0xd5, 0xca, 0xa5, 0x76, 0x76,
-    0x66, 0x4b, 0x5a, 0x58, 0x32, 0x23, 0x23, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
-    0x43, 0x50, 0x4b, 0x32, 0x23, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x14,
-    0x14, 0x1f, 0x1b, 0x14, 0x14, 0x14, 0x14, 0x10, 0x0d, 0x0d, 0x0a, 0x08,
-    0x05, 0x03, 0x03, 0x0b, 0x2a, 0x47, 0x53, 0x5a, 0x6b, 0x4b, 0x6c, 0xa2,
-    0x9b, 0x9a, 0x87, 0x9a, 0xb1, 0xa2, 0xa8, 0xb8, 0xd9, 0xc8, 0xa7, 0xc9,
-    0xd7, 0xab, 0xca, 0xe3, 0xe3, 0xaf, 0xbc, 0xdc, 0xdc, 0xeb, 0xe9, 0xed,
-    0xfe, 0xfe, 0xfd, 0xfd, 0xf7, 0xf6, 0xe6, 0xf5, 0xfe, 0xfe, 0xfe, 0xfd,
-    0xf6, 0xf6, 0xf9, 0xfa, 0xfa, 0xf9, 0xfd, 0xfd, 0xfd, 0xf7, 0xf7, 0xf5,
-    0xef, 0xf5, 0xf6, 0xf9, 0xf9, 0xfa, 0xfe, 0xfe, 0xfd, 0xfd, 0xf9, 0xea,
-    0xe2, 0xde, 0xe7, 0xea, 0xe1, 0xe1, 0xe1, 0xe1, 0xe4, 0xe4, 0xee, 0xeb,
-    0xe0, 0xdc, 0xdc, 0xdd, 0xeb, 0xe1, 0xe1, 0xe1, 0xe1, 0xeb, 0xf0, 0xf0,
-    0xe1, 0xbe, 0xbb, 0xaf, 0xa6, 0x9c, 0x94, 0xbb, 0xbb, 0xaa, 0x9f, 0x81,
-    0x81, 0x4c, 0x40, 0x2f, 0x33, 0x52, 0x40, 0x3d, 0x40, 0x4c, 0x2f, 0x40,
-    0x2e, 0x2e, 0x36, 0x1e, 0x1c, 0x13, 0x1c, 0x15, 0x13, 0x0c, 0x08, 0x03,
-    0x02, 0x02, 0x02, 0x03, 0x05, 0x08, 0x08, 0x0a, 0x12, 0x1c, 0x19, 0x1f,
-    0x21, 0x2a, 0x33, 0x2a, 0x2a, 0x22, 0x09, 0x05, 0x05, 0x0c, 0x12, 0x19,
-    0x24, 0x2b, 0x36, 0x48, 0x56, 0x55, 0x5a, 0x77, 0x60, 0x75, 0x7a, 0x7a,
-    0x84, 0x84, 0x6c, 0x2e, 0x37, 0x37, 0x2e, 0x23, 0x4b, 0x6c, 0x6c, 0x7a,
-    0xa2, 0xa2, 0x8c, 0x7a, 0x8c, 0x60, 0x5a, 0x6b, 0x6b, 0x57, 0x66, 0x5b,
-    0x7c, 0x88, 0x88, 0xb8, 0xb8, 0xb5, 0xbb, 0xb5, 0xc8, 0xda, 0xdc, 0xeb,
-    0xdc, 0xd7, 0xdc, 0xcc, 0x5f, 0x5f, 0x5f, 0x5f, 0x92, 0xd3, 0xed, 0xdc,
-    0xd7, 0xc9, 0xc9, 0xcc, 0xe1, 0xeb, 0xeb, 0xe8, 0xd7, 0xcc, 0xb2, 0x9b,
-    0x9b, 0x9a, 0xa8, 0x93, 0x7f, 0x57, 0x42, 0x2c, 0x2c, 0x30, 0x30, 0x53,
-    0x9a, 0xb1, 0xb8, 0xa5, 0x7f, 0x57, 0x32, 0x23, 0x1d, 0x14, 0x0a, 0x0a,
-    0x08, 0x08, 0x07, 0x07, 0x0a, 0x1c, 0x48, 0x5a, 0x58, 0x4b, 0x42, 0x42,
-    0x4b, 0x42, 0x42, 0x4b, 0x58, 0x58, 0x4b, 0x37, 0x37, 0x2c, 0x3d, 0x9f,
-    0xaa, 0xa8, 0xa8, 0xc6, 0xc9, 0xab, 0x88, 0x7f, 0x8c, 0x68, 0x60, 0x5a,
-    0x42, 0x2c, 0x2c, 0x2c, 0x2c, 0x32, 0x2c, 0x23, 0x27, 0x27, 0x1d, 0x23,
-    0x1d, 0x23, 0x27, 0x27, 0x27, 0x1d, 0x1a, 0x14, 0x1a, 0x1a, 0x1a, 0x1a,
-    0x1b, 0x14, 0x14, 0x10, 0x0a, 0x0d, 0x0a, 0x08, 0x05, 0x03, 0x02, 0x03,
-    0x08, 0x20, 0x56, 0x77, 0x6c, 0x58, 0x6b, 0x8c, 0xa2, 0xa2, 0xa2, 0xbb,
-    0xb1, 0xa8, 0xa8, 0xb8, 0xca, 0xb6, 0xb6, 0xd5, 0xd9, 0xca, 0xca, 0xed,
-    0xed, 0xdc, 0xdc, 0xdc, 0xd7, 0xda, 0xdc, 0xf9, 0xfe, 0xfe, 0xfd, 0xf6,
-    0xf5, 0xef, 0xef, 0xf6, 0xfd, 0xfd, 0xfd, 0xf6, 0xf5, 0xf6, 0xfd, 0xfe,
-    0xfa, 0xf9, 0xfd, 0xfd, 0xf7, 0xf6, 0xf6, 0xef, 0xdb, 0xef, 0xf9, 0xfa,
-    0xfa, 0xfd, 0xfe, 0xfe, 0xfd, 0xf9, 0xed, 0xea, 0xe7, 0xde, 0xde, 0xe2,
-    0xdc, 0xdc, 0xdd, 0xe0, 0xe3, 0xe3, 0xeb, 0xeb, 0xe0, 0xd9, 0xd5, 0xdc,
-    0xe9, 0xe3, 0xd3, 0xd2, 0xe1, 0xeb, 0xeb, 0xeb, 0xeb, 0xe1, 0xce, 0xaf,
-    0x94, 0xa5, 0xaa, 0xb2, 0xae, 0xa3, 0x9f, 0x81, 0x77, 0x78, 0x64, 0x80,
-    0x6e, 0x52, 0x4e, 0x40, 0x4e, 0x4e, 0x4c, 0x40, 0x36, 0x3e, 0x2e, 0x1f,
-    0x1c, 0x15, 0x15, 0x15, 0x15, 0x0c, 0x06, 0x03, 0x02, 0x03, 0x03, 0x03,
-    0x05, 0x06, 0x05, 0x0c, 0x0d, 0x19, 0x19, 0x21, 0x1e, 0x2a, 0x2b, 0x33,
-    0x2a, 0x13, 0x05, 0x05, 0x05, 0x08, 0x12, 0x19, 0x1f, 0x2b, 0x29, 0x2f,
-    0x48, 0x47, 0x43, 0x6c, 0x77, 0x75, 0x6c, 0x75, 0x85, 0x8c, 0x91, 0x47,
-    0x46, 0x3a, 0x3e, 0x2c, 0x58, 0x7a, 0xa2, 0xbb, 0xce, 0xcc, 0xcf, 0xb1,
-    0x86, 0x77, 0x51, 0x58, 0x58, 0x58, 0x57, 0x71, 0xa5, 0x93, 0x88, 0xa8,
-    0xa2, 0x9c, 0x93, 0x9c, 0xa7, 0xc5, 0xc8, 0xda, 0xda, 0xda, 0xd7, 0xcc,
-    0x5f, 0x5f, 0x5d, 0x5d, 0x8f, 0xe3, 0xee, 0xe9, 0xdc, 0xdd, 0xeb, 0xeb,
-    0xf7, 0xf9, 0xf6, 0xe6, 0xd7, 0xd5, 0xbb, 0xb1, 0xcf, 0xe1, 0xdd, 0xd7,
-    0xa5, 0x72, 0x57, 0x42, 0x42, 0x37, 0x53, 0x87, 0xb2, 0xcc, 0xc9, 0xa5,
-    0x7f, 0x57, 0x32, 0x23, 0x1d, 0x14, 0x0a, 0x07, 0x08, 0x05, 0x05, 0x07,
-    0x10, 0x2a, 0x53, 0x6b, 0x6b, 0x57, 0x42, 0x42, 0x32, 0x2c, 0x2c, 0x2c,
-    0x37, 0x2c, 0x23, 0x23, 0x23, 0x2d, 0x67, 0xb2, 0xaa, 0x93, 0xa8, 0xdd,
-    0xdc, 0xa6, 0xa5, 0xcf, 0xa2, 0x71, 0x57, 0x50, 0x42, 0x32, 0x43, 0x32,
-    0x2c, 0x2c, 0x23, 0x23, 0x1d, 0x14, 0x14, 0x1d, 0x23, 0x23, 0x23, 0x23,
-    0x1d, 0x1d, 0x23, 0x1a, 0x1d, 0x1a, 0x1a, 0x1a, 0x1d, 0x1a, 0x14, 0x10,
-    0x10, 0x10, 0x0d, 0x0a, 0x05, 0x02, 0x02, 0x02, 0x02, 0x05, 0x4e, 0xa2,
-    0xb1, 0xa2, 0xa5, 0xbb, 0xcc, 0xa8, 0x8c, 0xaa, 0xa2, 0x93, 0xa5, 0xb5,
-    0xca, 0xb6, 0xa5, 0xdc, 0xed, 0xf9, 0xf7, 0xf9, 0xf7, 0xe8, 0xe9, 0xeb,
-    0xe6, 0xc1, 0xd7, 0xf9, 0xfd, 0xfd, 0xf6, 0xf5, 0xf6, 0xf5, 0xea, 0xf6,
-    0xfd, 0xf6, 0xf6, 0xf7, 0xfd, 0xfd, 0xfd, 0xfd, 0xfa, 0xf9, 0xf9, 0xfd,
-    0xfd, 0xf6, 0xf5, 0xef, 0xe6, 0xf9, 0xfa, 0xfa, 0xfa, 0xf9, 0xfd, 0xfd,
-    0xf9, 0xf6, 0xea, 0xe2, 0xd9, 0xde, 0xde, 0xde, 0xd9, 0xdc, 0xdc, 0xe0,
-    0xe0, 0xe1, 0xeb, 0xeb, 0xe0, 0xdc, 0xd9, 0xdc, 0xdd, 0xe0, 0xd3, 0xd1,
-    0xd9, 0xe9, 0xe9, 0xe9, 0xe9, 0xeb, 0xeb, 0xd1, 0xaa, 0xce, 0xd4, 0xa0,
-    0x85, 0x85, 0x91, 0x77, 0x9a, 0xa0, 0xa0, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x80, 0x4e, 0x33, 0x40, 0x36, 0x29, 0x2b, 0x19, 0x1c, 0x19, 0x1c, 0x1c,
-    0x1c, 0x15, 0x06, 0x06, 0x06, 0x05, 0x09, 0x09, 0x09, 0x09, 0x05, 0x08,
-    0x0c, 0x1c, 0x21, 0x21, 0x1e, 0x2a, 0x2a, 0x2a, 0x21, 0x0c, 0x05, 0x05,
-    0x05, 0x08, 0x0a, 0x12, 0x19, 0x24, 0x1f, 0x2b, 0x3e, 0x2e, 0x37, 0x51,
-    0x5e, 0x58, 0x58, 0x6b, 0x74, 0x82, 0x85, 0x55, 0x47, 0x2c, 0x51, 0x51,
-    0x7a, 0x93, 0xb8, 0xc6, 0xe3, 0xe1, 0xcc, 0xc6, 0xbb, 0xa2, 0x60, 0x37,
-    0x58, 0x75, 0x58, 0x70, 0xaa, 0x97, 0x7f, 0xbb, 0x9f, 0x82, 0x93, 0x94,
-    0x9c, 0xa7, 0xa7, 0xc1, 0xc5, 0xda, 0xca, 0xc9, 0x92, 0x92, 0x92, 0xba,
-    0xe3, 0xe3, 0xeb, 0xe9, 0xe1, 0xeb, 0xf7, 0xf9, 0xf9, 0xf5, 0xef, 0xe6,
-    0xd7, 0xd7, 0xc9, 0xdd, 0xeb, 0xf7, 0xf6, 0xe6, 0xc2, 0xa5, 0x82, 0x6b,
-    0x4b, 0x51, 0x87, 0xcf, 0xdd, 0xd7, 0xc9, 0xab, 0x7f, 0x57, 0x32, 0x2c,
-    0x23, 0x14, 0x0d, 0x07, 0x08, 0x08, 0x08, 0x0a, 0x10, 0x3d, 0x60, 0x72,
-    0x72, 0x68, 0x57, 0x42, 0x32, 0x2c, 0x23, 0x23, 0x23, 0x1d, 0x1d, 0x1a,
-    0x2a, 0x67, 0x9b, 0xb1, 0xab, 0x94, 0xcc, 0xe1, 0xdc, 0xab, 0xb5, 0xa5,
-    0x88, 0x70, 0x71, 0x68, 0x4b, 0x32, 0x42, 0x32, 0x2c, 0x2c, 0x23, 0x23,
-    0x14, 0x0a, 0x0a, 0x2a, 0x30, 0x23, 0x23, 0x23, 0x1d, 0x1a, 0x1d, 0x1d,
-    0x27, 0x23, 0x1d, 0x1d, 0x1d, 0x1a, 0x14, 0x14, 0x14, 0x10, 0x0d, 0x08,
-    0x03, 0x02, 0x00, 0x00, 0x02, 0x05, 0x49, 0xaa, 0xcc, 0xc6, 0xb8, 0xc6,
-    0xcc, 0xaa, 0xa2, 0xaa, 0x93, 0x7c, 0x71, 0xa8, 0xbb, 0xdd, 0xf7, 0xf7,
-    0xf9, 0xf9, 0xee, 0xf7, 0xef, 0xe8, 0xf5, 0xe6, 0xd8, 0xc8, 0xe9, 0xf7,
-    0xf6, 0xf5, 0xf5, 0xef, 0xef, 0xda, 0xd8, 0xf5, 0xf6, 0xf6, 0xf6, 0xfd,
-    0xfe, 0xfd, 0xfd, 0xfd, 0xfa, 0xf9, 0xf9, 0xfe, 0xfd, 0xf6, 0xf5, 0xf5,
-    0xea, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf7, 0xf6, 0xf5, 0xea, 0xe7, 0xe2,
-    0xd9, 0xd7, 0xd7, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xdd, 0xeb, 0xeb,
-    0xe0, 0xdc, 0xd9, 0xd9, 0xd5, 0xd9, 0xd2, 0xd2, 0xcf, 0xdd, 0xeb, 0xeb,
-    0xea, 0xed, 0xeb, 0xe1, 0xdc, 0xdd, 0xb2, 0x85, 0x74, 0x74, 0x82, 0x8c,
-    0x9a, 0x87, 0x8c, 0x8c, 0x86, 0xa0, 0xb7, 0xae, 0xa0, 0x67, 0x48, 0x2d,
-    0x36, 0x29, 0x21, 0x12, 0x12, 0x19, 0x1c, 0x1c, 0x12, 0x0c, 0x08, 0x09,
-    0x09, 0x09, 0x0b, 0x09, 0x09, 0x09, 0x06, 0x06, 0x09, 0x0c, 0x16, 0x16,
-    0x19, 0x19, 0x1e, 0x21, 0x12, 0x03, 0x03, 0x05, 0x09, 0x09, 0x15, 0x16,
-    0x19, 0x1e, 0x1f, 0x2b, 0x2e, 0x2e, 0x47, 0x5e, 0x55, 0x43, 0x50, 0x4b,
-    0x57, 0x68, 0x58, 0x44, 0x54, 0x37, 0x6b, 0x75, 0x72, 0x94, 0xa5, 0xbc,
-    0xdd, 0xdc, 0xd5, 0xd5, 0xcc, 0xb1, 0x77, 0x37, 0x58, 0x74, 0x68, 0x57,
-    0x7f, 0x71, 0x68, 0x93, 0x85, 0x94, 0x88, 0xa6, 0x94, 0xa6, 0xab, 0xa7,
-    0xc1, 0xb5, 0xb6, 0xca, 0xf3, 0xe3, 0xe3, 0xf7, 0xed, 0xe9, 0xe9, 0xdd,
-    0xeb, 0xfa, 0xfa, 0xf9, 0xf6, 0xef, 0xe6, 0xda, 0xd7, 0xd7, 0xd7, 0xeb,
-    0xf7, 0xf6, 0xef, 0xda, 0xc8, 0xb5, 0xa2, 0x82, 0x72, 0x8c, 0xbb, 0xdc,
-    0xd7, 0xc9, 0xca, 0x9c, 0x7c, 0x57, 0x42, 0x2c, 0x23, 0x1a, 0x10, 0x07,
-    0x07, 0x07, 0x07, 0x0a, 0x20, 0x48, 0x6c, 0x82, 0x72, 0x71, 0x57, 0x4b,
-    0x32, 0x2c, 0x23, 0x23, 0x1d, 0x1b, 0x14, 0x14, 0x31, 0x9a, 0xc6, 0xb5,
-    0xa5, 0x9c, 0xa5, 0xa8, 0xc9, 0xca, 0xc8, 0x9c, 0x76, 0x7c, 0x71, 0x71,
-    0x57, 0x32, 0x42, 0x43, 0x37, 0x2c, 0x23, 0x1a, 0x0d, 0x07, 0x0a, 0x2a,
-    0x45, 0x37, 0x23, 0x23, 0x1a, 0x14, 0x1a, 0x27, 0x23, 0x23, 0x27, 0x1d,
-    0x1d, 0x1a, 0x1b, 0x1b, 0x14, 0x10, 0x0a, 0x05, 0x02, 0x00, 0x00, 0x02,
-    0x3c, 0x80, 0x9b, 0xaa, 0xc6, 0xca, 0xca, 0xca, 0xa6, 0x93, 0x93, 0x93,
-    0x88, 0x71, 0x72, 0xa8, 0xcf, 0xf9, 0xf9, 0xf6, 0xf9, 0xed, 0xea, 0xed,
-    0xea, 0xe7, 0xef, 0xd6, 0xc5, 0xd7, 0xf7, 0xf6, 0xf5, 0xef, 0xef, 0xd8,
-    0xd6, 0xc5, 0xda, 0xf7, 0xf9, 0xf6, 0xf6, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
-    0xfa, 0xfa, 0xfa, 0xfe, 0xfd, 0xf6, 0xf5, 0xed, 0xf7, 0xfa, 0xfa, 0xf9,
-    0xf7, 0xf7, 0xf5, 0xf5, 0xef, 0xdb, 0xdb, 0xde, 0xd9, 0xd5, 0xd5, 0xde,
-    0xd5, 0xca, 0xd5, 0xc6, 0xce, 0xdd, 0xeb, 0xeb, 0xe0, 0xdc, 0xdc, 0xce,
-    0xd5, 0xce, 0xd2, 0xe3, 0xe1, 0xe1, 0xe3, 0xe0, 0xe0, 0xed, 0xea, 0xdc,
-    0xdc, 0xdc, 0xdc, 0xcf, 0x9f, 0x75, 0x82, 0x8c, 0x77, 0x7b, 0xa2, 0xa2,
-    0x8c, 0xb4, 0xba, 0xb7, 0xb4, 0xb4, 0x81, 0x33, 0x2b, 0x21, 0x12, 0x16,
-    0x19, 0x1c, 0x1c, 0x12, 0x12, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x09,
-    0x09, 0x0c, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0c, 0x0c, 0x08,
-    0x03, 0x02, 0x02, 0x03, 0x06, 0x0c, 0x0c, 0x12, 0x19, 0x19, 0x2f, 0x2f,
-    0x29, 0x2e, 0x46, 0x6f, 0x55, 0x43, 0x50, 0x50, 0x50, 0x4d, 0x44, 0x37,
-    0x61, 0x51, 0x6b, 0x6b, 0x68, 0x7f, 0x94, 0xaf, 0xca, 0xca, 0xc6, 0xc6,
-    0xce, 0xb1, 0x7a, 0x6c, 0x5a, 0x6b, 0x4b, 0x57, 0x4b, 0x42, 0x68, 0x72,
-    0x93, 0x7c, 0x7f, 0x93, 0x93, 0xa6, 0xab, 0xab, 0xa8, 0xa8, 0xab, 0xc1,
-    0xfa, 0xf6, 0xe9, 0xeb, 0xe9, 0xe8, 0xe8, 0xe9, 0xf7, 0xf9, 0xf7, 0xe9,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xd7, 0xd7, 0xe8, 0xf6, 0xf6, 0xef, 0xe6, 0xd8,
-    0xc1, 0xab, 0xa5, 0x82, 0x8c, 0xbb, 0xd5, 0xd7, 0xd7, 0xc2, 0xab, 0x9c,
-    0x71, 0x57, 0x32, 0x2c, 0x23, 0x1a, 0x14, 0x0d, 0x0a, 0x10, 0x20, 0x34,
-    0x49, 0x64, 0x82, 0x82, 0x82, 0x71, 0x68, 0x4b, 0x32, 0x2c, 0x23, 0x1d,
-    0x1a, 0x14, 0x10, 0x10, 0x31, 0xb2, 0xd5, 0xca, 0xb5, 0xa5, 0x94, 0x8c,
-    0xd5, 0xd5, 0xc9, 0xa6, 0x94, 0x7f, 0x66, 0x66, 0x4b, 0x4b, 0x42, 0x32,
-    0x37, 0x2c, 0x23, 0x14, 0x10, 0x0a, 0x10, 0x2a, 0x3d, 0x30, 0x2c, 0x23,
-    0x27, 0x1f, 0x1d, 0x27, 0x23, 0x23, 0x23, 0x28, 0x1d, 0x1d, 0x1a, 0x14,
-    0x14, 0x0d, 0x08, 0x03, 0x02, 0x00, 0x02, 0x13, 0xb4, 0xe1, 0xe0, 0xd1,
-    0xce, 0xc6, 0xb5, 0xab, 0xab, 0xb8, 0xa8, 0x93, 0x70, 0x82, 0x93, 0xbb,
-    0xf7, 0xfd, 0xfd, 0xf9, 0xf9, 0xed, 0xdb, 0xe7, 0xed, 0xea, 0xde, 0xd8,
-    0xc8, 0xda, 0xe8, 0xf6, 0xf6, 0xef, 0xd8, 0xd6, 0xe6, 0xd8, 0xc8, 0xea,
-    0xf6, 0xef, 0xf5, 0xfd, 0xfd, 0xf6, 0xf7, 0xfd, 0xfa, 0xf9, 0xfd, 0xfd,
-    0xf6, 0xef, 0xea, 0xf7, 0xfa, 0xfa, 0xf9, 0xf7, 0xf7, 0xed, 0xea, 0xe7,
-    0xdb, 0xdb, 0xdb, 0xc8, 0xca, 0xca, 0xc8, 0xc8, 0xca, 0xca, 0xca, 0xca,
-    0xce, 0xdc, 0xdc, 0xdd, 0xe1, 0xdd, 0xcf, 0xdd, 0xdd, 0xe1, 0xe3, 0xf0,
-    0xeb, 0xe1, 0xe1, 0xe1, 0xdd, 0xdc, 0xd9, 0xd9, 0xca, 0xd7, 0xe6, 0xeb,
-    0xe3, 0x9f, 0x75, 0x73, 0x83, 0xaa, 0xa2, 0xa2, 0x9a, 0xb7, 0xba, 0xba,
-    0xb9, 0xb9, 0xae, 0x64, 0x20, 0x0a, 0x0b, 0x0c, 0x12, 0x19, 0x12, 0x16,
-    0x16, 0x16, 0x12, 0x12, 0x16, 0x12, 0x16, 0x0c, 0x0c, 0x0c, 0x0c, 0x0a,
-    0x0a, 0x0b, 0x05, 0x05, 0x05, 0x03, 0x02, 0x02, 0x00, 0x02, 0x02, 0x03,
-    0x08, 0x08, 0x0c, 0x12, 0x19, 0x24, 0x2b, 0x2f, 0x1f, 0x29, 0x2e, 0x47,
-    0x47, 0x51, 0x5e, 0x47, 0x2e, 0x37, 0x46, 0x47, 0x61, 0x61, 0x6c, 0x58,
-    0x57, 0x71, 0x7f, 0x8e, 0x94, 0xa6, 0xb6, 0xb8, 0xc6, 0xaa, 0xaa, 0x97,
-    0x85, 0x44, 0x4b, 0x75, 0x6c, 0x7a, 0x7a, 0x5a, 0x72, 0x68, 0x8c, 0xa2,
-    0x88, 0x7c, 0x76, 0xb5, 0xaa, 0xa8, 0xa5, 0xab, 0xf7, 0xe9, 0xe9, 0xeb,
-    0xeb, 0xe9, 0xe9, 0xeb, 0xf7, 0xf7, 0xe9, 0xef, 0xd7, 0xc2, 0xda, 0xe6,
-    0xd7, 0xe8, 0xe8, 0xe8, 0xef, 0xda, 0xd8, 0xc1, 0xa9, 0x9c, 0x9c, 0x88,
-    0x93, 0xc9, 0xc9, 0xca, 0xca, 0xb6, 0xab, 0x88, 0x70, 0x57, 0x32, 0x2c,
-    0x23, 0x1d, 0x1a, 0x14, 0x20, 0x49, 0x67, 0x9b, 0xae, 0xbb, 0xa5, 0x88,
-    0x7f, 0x68, 0x57, 0x42, 0x2c, 0x23, 0x1a, 0x1a, 0x1b, 0x14, 0x10, 0x10,
-    0x49, 0xb4, 0xdd, 0xd5, 0xb8, 0xbb, 0xa5, 0x8c, 0xaa, 0xdc, 0xdd, 0xcf,
-    0xbb, 0x94, 0x76, 0x5b, 0x4b, 0x4b, 0x42, 0x32, 0x2c, 0x23, 0x1a, 0x10,
-    0x0a, 0x0d, 0x14, 0x1e, 0x28, 0x2d, 0x30, 0x30, 0x23, 0x27, 0x27, 0x2c,
-    0x2c, 0x30, 0x30, 0x30, 0x27, 0x1d, 0x1a, 0x14, 0x10, 0x0a, 0x05, 0x02,
-    0x02, 0x02, 0x0b, 0x9f, 0xd7, 0xd9, 0xdc, 0xdc, 0xce, 0xd9, 0xca, 0xab,
-    0xa5, 0xb5, 0xab, 0x8a, 0x7c, 0x93, 0x7a, 0xb1, 0xfa, 0xfa, 0xfd, 0xf7,
-    0xf6, 0xed, 0xe7, 0xd8, 0xd8, 0xd6, 0xd8, 0xe6, 0xe7, 0xe7, 0xe9, 0xf6,
-    0xf6, 0xef, 0xd8, 0xd6, 0xde, 0xe7, 0xca, 0xd5, 0xeb, 0xf7, 0xf7, 0xf9,
-    0xfd, 0xf6, 0xf7, 0xfd, 0xf9, 0xf9, 0xf6, 0xf5, 0xef, 0xef, 0xf7, 0xfa,
-    0xfa, 0xfa, 0xf7, 0xed, 0xed, 0xed, 0xe7, 0xd9, 0xdb, 0xc8, 0xc8, 0xc8,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xc8, 0xc8, 0xca, 0xca, 0xce, 0xcf, 0xcf, 0xce,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xe1, 0xe3, 0xe3, 0xf0, 0xe4, 0xe1, 0xe1, 0xdc,
-    0xdc, 0xd7, 0xd7, 0xd9, 0xd5, 0xdc, 0xd7, 0xe9, 0xe1, 0xae, 0x74, 0x71,
-    0x7f, 0xaf, 0x93, 0x93, 0xa0, 0xb4, 0xb7, 0x91, 0xac, 0xbe, 0xbc, 0xbe,
-    0x34, 0x03, 0x03, 0x0b, 0x16, 0x16, 0x16, 0x16, 0x1c, 0x19, 0x19, 0x19,
-    0x19, 0x1c, 0x1c, 0x16, 0x16, 0x0c, 0x0c, 0x13, 0x0c, 0x0c, 0x09, 0x05,
-    0x05, 0x03, 0x02, 0x02, 0x00, 0x02, 0x02, 0x05, 0x0c, 0x08, 0x0c, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x1f, 0x2b, 0x29, 0x27, 0x3e, 0x44, 0x5e, 0x3d,
-    0x27, 0x37, 0x51, 0x5e, 0x5e, 0x5e, 0x5a, 0x58, 0x58, 0x73, 0x73, 0x7f,
-    0x94, 0x96, 0x94, 0xa6, 0xbb, 0xcf, 0xbe, 0x8c, 0x82, 0x44, 0x6c, 0xa2,
-    0xb1, 0xcc, 0xcc, 0xb1, 0x7a, 0x7a, 0x85, 0x82, 0x7f, 0x68, 0x71, 0xa5,
-    0xa5, 0xa5, 0xa5, 0xab, 0xf0, 0xeb, 0xeb, 0xf7, 0xf7, 0xeb, 0xeb, 0xeb,
-    0xf7, 0xe9, 0xe9, 0xe9, 0xe6, 0xda, 0xc8, 0xd8, 0xd7, 0xe6, 0xef, 0xef,
-    0xe6, 0xe6, 0xe6, 0xc1, 0xa7, 0xab, 0x9c, 0x88, 0x9c, 0xb5, 0xca, 0xc8,
-    0xca, 0xb6, 0x9c, 0x7c, 0x70, 0x57, 0x32, 0x2c, 0x23, 0x23, 0x28, 0x2d,
-    0x67, 0x9a, 0xcc, 0xcc, 0xd5, 0xc9, 0xab, 0x88, 0x71, 0x57, 0x42, 0x32,
-    0x2c, 0x1a, 0x1a, 0x1a, 0x1d, 0x28, 0x1d, 0x31, 0x90, 0xe4, 0xdd, 0xd5,
-    0xc9, 0xcc, 0xa5, 0x7c, 0x82, 0xcc, 0xd5, 0xc6, 0xb6, 0x8a, 0x76, 0x5c,
-    0x5b, 0x4b, 0x43, 0x32, 0x23, 0x1d, 0x14, 0x0d, 0x0a, 0x0d, 0x10, 0x1b,
-    0x1d, 0x1d, 0x2d, 0x30, 0x30, 0x23, 0x30, 0x2c, 0x37, 0x37, 0x37, 0x37,
-    0x2e, 0x28, 0x1d, 0x1b, 0x10, 0x0a, 0x05, 0x02, 0x02, 0x03, 0x49, 0xd7,
-    0xe6, 0xe7, 0xdc, 0xd5, 0xd5, 0xd5, 0xb6, 0x8a, 0x9c, 0xab, 0x9c, 0x76,
-    0x7f, 0xa2, 0xa2, 0xcf, 0xfa, 0xfd, 0xf7, 0xf6, 0xea, 0xea, 0xe7, 0xd8,
-    0xda, 0xda, 0xc1, 0xda, 0xda, 0xd7, 0xe9, 0xf6, 0xef, 0xd8, 0xd8, 0xd8,
-    0xe6, 0xdd, 0xee, 0xeb, 0xf7, 0xfd, 0xfd, 0xf7, 0xf7, 0xfd, 0xfd, 0xfd,
-    0xf9, 0xf7, 0xf5, 0xef, 0xef, 0xea, 0xfa, 0xfa, 0xf9, 0xf7, 0xed, 0xea,
-    0xdf, 0xdf, 0xd9, 0xd5, 0xca, 0xc8, 0xb3, 0xb3, 0xb3, 0xad, 0xad, 0xad,
-    0xb3, 0xb6, 0xca, 0xbb, 0xce, 0xd2, 0xcf, 0xc6, 0xd5, 0xdd, 0xdd, 0xe1,
-    0xe1, 0xeb, 0xe3, 0xe3, 0xe3, 0xeb, 0xeb, 0xdd, 0xce, 0xc6, 0xc6, 0xce,
-    0xd5, 0xce, 0xd7, 0xd7, 0xdc, 0xbe, 0x85, 0x58, 0x71, 0x97, 0x8c, 0x9f,
-    0xa0, 0x9f, 0x84, 0xa3, 0xb7, 0xb7, 0xbb, 0xbc, 0x80, 0x05, 0x02, 0x02,
-    0x05, 0x08, 0x0c, 0x16, 0x1c, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x12, 0x12, 0x16, 0x16, 0x0c, 0x0c, 0x09, 0x09, 0x05, 0x04, 0x02, 0x00,
-    0x00, 0x02, 0x03, 0x05, 0x08, 0x0c, 0x0c, 0x16, 0x12, 0x19, 0x19, 0x19,
-    0x1f, 0x2f, 0x2b, 0x1f, 0x27, 0x23, 0x47, 0x3e, 0x45, 0x6c, 0x86, 0x6f,
-    0x47, 0x51, 0x51, 0x50, 0x58, 0x74, 0x58, 0x73, 0x83, 0x97, 0x96, 0xbb,
-    0xaa, 0xa5, 0xaa, 0x8c, 0x58, 0x58, 0x8c, 0xbb, 0xc9, 0xd7, 0xd9, 0xdc,
-    0xdc, 0xbb, 0x85, 0x4b, 0x94, 0x71, 0x71, 0x93, 0x93, 0x94, 0x93, 0xa5,
-    0xeb, 0xeb, 0xe9, 0xe8, 0xeb, 0xeb, 0xf7, 0xeb, 0xe9, 0xe9, 0xeb, 0xf7,
-    0xe8, 0xd7, 0xc1, 0xc8, 0xca, 0xd7, 0xe6, 0xe8, 0xe9, 0xeb, 0xe8, 0xda,
-    0xc1, 0xab, 0x8a, 0x88, 0x94, 0x9c, 0xab, 0xab, 0xab, 0xab, 0x9c, 0x88,
-    0x7c, 0x70, 0x4b, 0x37, 0x23, 0x23, 0x45, 0x60, 0xb1, 0xcc, 0xd7, 0xd5,
-    0xc9, 0xca, 0xab, 0x7c, 0x68, 0x4b, 0x37, 0x2c, 0x23, 0x14, 0x1b, 0x28,
-    0x3d, 0x45, 0x45, 0x67, 0xd4, 0xe3, 0xdd, 0xc9, 0xd5, 0xc6, 0xab, 0x76,
-    0x7f, 0xd5, 0xd5, 0xb6, 0xab, 0x8a, 0x76, 0x5c, 0x5b, 0x4b, 0x42, 0x32,
-    0x23, 0x1a, 0x14, 0x10, 0x0a, 0x0a, 0x10, 0x1e, 0x23, 0x23, 0x2d, 0x3d,
-    0x30, 0x2c, 0x30, 0x37, 0x37, 0x44, 0x44, 0x44, 0x37, 0x30, 0x28, 0x1a,
-    0x10, 0x0a, 0x05, 0x03, 0x03, 0x13, 0xb2, 0xeb, 0xe9, 0xea, 0xd9, 0xca,
-    0xbf, 0xbf, 0xa6, 0xa5, 0xa8, 0x94, 0x7c, 0x5c, 0x70, 0x88, 0x7c, 0xdc,
-    0xf7, 0xf7, 0xf6, 0xf6, 0xe7, 0xde, 0xc5, 0xbf, 0xea, 0xeb, 0xd7, 0xd8,
-    0xbf, 0xa9, 0xc8, 0xf5, 0xef, 0xef, 0xe7, 0xf7, 0xf8, 0xeb, 0xeb, 0xfd,
-    0xf7, 0xfd, 0xfd, 0xf7, 0xf9, 0xfd, 0xfd, 0xfd, 0xf7, 0xf5, 0xea, 0xef,
-    0xef, 0xf6, 0xf9, 0xfd, 0xf6, 0xea, 0xea, 0xe7, 0xe2, 0xd0, 0xce, 0xbe,
-    0xbc, 0xbc, 0xb0, 0xa6, 0x96, 0x94, 0x8e, 0xad, 0xb3, 0xaf, 0xaf, 0xbb,
-    0xbe, 0xcf, 0xcf, 0xc6, 0xd5, 0xdd, 0xeb, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1,
-    0xe0, 0xeb, 0xeb, 0xcf, 0xc6, 0xc6, 0xbb, 0xbb, 0xc6, 0xce, 0xd5, 0xd5,
-    0xc6, 0xa3, 0x77, 0x6b, 0x84, 0x85, 0x91, 0x9f, 0xa1, 0x77, 0x84, 0x91,
-    0x9f, 0xbe, 0xaa, 0xbb, 0x81, 0x06, 0x02, 0x02, 0x03, 0x05, 0x0c, 0x12,
-    0x19, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x16, 0x15,
-    0x15, 0x0c, 0x0b, 0x09, 0x06, 0x03, 0x02, 0x00, 0x00, 0x00, 0x02, 0x03,
-    0x09, 0x0b, 0x08, 0x0c, 0x12, 0x19, 0x1e, 0x1f, 0x1e, 0x1f, 0x1f, 0x28,
-    0x2e, 0x2e, 0x51, 0x5a, 0x6c, 0x7a, 0x85, 0x75, 0x46, 0x44, 0x44, 0x50,
-    0x4b, 0x6b, 0x4d, 0x50, 0x71, 0x83, 0x7f, 0x7f, 0x7f, 0x93, 0x82, 0x8c,
-    0x60, 0x7a, 0xa5, 0xb6, 0xd7, 0xdd, 0xeb, 0xdc, 0xd7, 0xc6, 0xaa, 0x58,
-    0x7f, 0x74, 0x72, 0xa8, 0xb1, 0x85, 0x82, 0xa2, 0xda, 0xda, 0xda, 0xd7,
-    0xdc, 0xe9, 0xe9, 0xe8, 0xd7, 0xd7, 0xe6, 0xe8, 0xe6, 0xc8, 0xc1, 0xab,
-    0xc2, 0xd7, 0xe9, 0xeb, 0xf7, 0xf7, 0xe8, 0xd7, 0xc8, 0xab, 0x88, 0x7c,
-    0x7c, 0x88, 0x9c, 0xab, 0x9c, 0x93, 0xb8, 0xb8, 0xc9, 0xbb, 0x93, 0x68,
-    0x37, 0x45, 0x7a, 0xa2, 0xcc, 0xd5, 0xd7, 0xca, 0xca, 0xab, 0x88, 0x70,
-    0x57, 0x42, 0x2c, 0x23, 0x1a, 0x1b, 0x2d, 0x47, 0x53, 0x5a, 0x60, 0x9d,
-    0xe4, 0xeb, 0xdd, 0xdc, 0xc9, 0xa5, 0x9c, 0x7c, 0x7f, 0xaa, 0xca, 0xb6,
-    0xa7, 0x89, 0x79, 0x5b, 0x4b, 0x4b, 0x43, 0x37, 0x23, 0x1a, 0x14, 0x14,
-    0x10, 0x10, 0x1d, 0x45, 0x4b, 0x44, 0x37, 0x30, 0x23, 0x23, 0x3e, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x37, 0x30, 0x28, 0x14, 0x0a, 0x08, 0x08, 0x05,
-    0x08, 0x22, 0xd2, 0xfa, 0xeb, 0xe6, 0xde, 0xde, 0xc8, 0xa7, 0xa6, 0xbb,
-    0xa6, 0x88, 0x88, 0x88, 0x82, 0x82, 0x68, 0xb1, 0xe9, 0xea, 0xea, 0xde,
-    0xde, 0xea, 0xe7, 0xc8, 0xe6, 0xea, 0xe6, 0xbf, 0xc8, 0xd7, 0x7c, 0xd7,
-    0xf6, 0xf6, 0xea, 0xf7, 0xfa, 0xeb, 0xf9, 0xfd, 0xfd, 0xf7, 0xf6, 0xf6,
-    0xfd, 0xfe, 0xfd, 0xf6, 0xf5, 0xef, 0xe7, 0xe7, 0xf5, 0xf7, 0xfd, 0xf7,
-    0xf6, 0xed, 0xdf, 0xd9, 0xd0, 0xd0, 0xb7, 0xb7, 0xae, 0xac, 0xac, 0x98,
-    0x96, 0x96, 0x94, 0x94, 0x96, 0x96, 0xaa, 0xaa, 0xbe, 0xcf, 0xb2, 0xbb,
-    0xc6, 0xd7, 0xdd, 0xdd, 0xdd, 0xcf, 0xcf, 0xce, 0xd9, 0xdc, 0xdd, 0xce,
-    0xac, 0xae, 0xaa, 0xa8, 0xbb, 0xbc, 0xbb, 0xc6, 0xaa, 0x75, 0x74, 0x73,
-    0x83, 0x85, 0x73, 0x73, 0x85, 0x9f, 0xa0, 0x9f, 0xb7, 0xae, 0xa3, 0xa3,
-    0x4e, 0x03, 0x02, 0x02, 0x03, 0x05, 0x08, 0x0d, 0x19, 0x19, 0x19, 0x21,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1c, 0x15, 0x16, 0x15, 0x0c, 0x09,
-    0x06, 0x03, 0x02, 0x02, 0x00, 0x02, 0x00, 0x02, 0x03, 0x05, 0x08, 0x0c,
-    0x16, 0x19, 0x1e, 0x1e, 0x19, 0x1b, 0x2b, 0x4c, 0x48, 0x47, 0x61, 0x77,
-    0x77, 0x75, 0x75, 0x5a, 0x51, 0x44, 0x44, 0x46, 0x42, 0x50, 0x4d, 0x58,
-    0x58, 0x58, 0x68, 0x71, 0x97, 0xaa, 0x7a, 0x82, 0xa2, 0xa6, 0xab, 0xc1,
-    0xd7, 0xe0, 0xeb, 0xe0, 0xd9, 0xd5, 0xc6, 0x6c, 0x72, 0x57, 0x57, 0xb1,
-    0xe3, 0xe3, 0xb1, 0x9a, 0xc2, 0xc1, 0xc2, 0xc9, 0xc9, 0xd7, 0xd7, 0xda,
-    0xc8, 0xab, 0xc9, 0xd7, 0xc2, 0xc1, 0xab, 0xab, 0xc2, 0xd7, 0xe9, 0xeb,
-    0xe8, 0xe6, 0xda, 0xc8, 0xab, 0x9c, 0x9c, 0x88, 0x71, 0x71, 0x88, 0xa5,
-    0x9c, 0xa8, 0xdc, 0xdd, 0xdd, 0xdd, 0xc9, 0x9c, 0x57, 0x5a, 0x8c, 0xb8,
-    0xc9, 0xc9, 0xc2, 0xb5, 0xab, 0x9c, 0x7c, 0x5b, 0x4b, 0x32, 0x2c, 0x23,
-    0x1a, 0x1d, 0x45, 0x53, 0x5a, 0x5a, 0x78, 0xd4, 0xe4, 0xeb, 0xe1, 0xdd,
-    0xc9, 0xab, 0x88, 0x70, 0x7f, 0x82, 0x94, 0xa6, 0xa7, 0x89, 0x5c, 0x5b,
-    0x32, 0x2c, 0x23, 0x27, 0x1d, 0x1a, 0x14, 0x14, 0x1b, 0x2d, 0x60, 0x6b,
-    0x68, 0x57, 0x4b, 0x32, 0x23, 0x23, 0x30, 0x45, 0x51, 0x51, 0x51, 0x51,
-    0x44, 0x30, 0x28, 0x14, 0x08, 0x05, 0x08, 0x0b, 0x0a, 0x34, 0xcf, 0xee,
-    0xea, 0xd7, 0xd7, 0xca, 0xb6, 0xa7, 0x89, 0x8a, 0x8a, 0x8a, 0x93, 0xbb,
-    0xa8, 0x88, 0x57, 0x6c, 0xe9, 0xea, 0xe6, 0xdb, 0xe6, 0xe2, 0xd8, 0xbf,
-    0xc1, 0xc5, 0xa4, 0xc1, 0xdc, 0xd7, 0xc9, 0xeb, 0xfa, 0xfe, 0xfe, 0xfa,
-    0xfe, 0xfa, 0xf9, 0xfd, 0xf5, 0xf5, 0xe9, 0xf7, 0xfd, 0xfd, 0xf6, 0xf5,
-    0xf5, 0xef, 0xe7, 0xed, 0xed, 0xf6, 0xfd, 0xf7, 0xf6, 0xea, 0xdc, 0xd9,
-    0xce, 0xd0, 0xae, 0xb7, 0xae, 0x9f, 0xae, 0x91, 0x91, 0x84, 0x84, 0x8c,
-    0x8c, 0x97, 0xaf, 0xaa, 0xbe, 0xb2, 0xbe, 0xaa, 0xbb, 0xd5, 0xd7, 0xdc,
-    0xce, 0xce, 0xce, 0xd5, 0xc6, 0xd5, 0xd5, 0xc6, 0xae, 0xae, 0xaa, 0xa5,
-    0xa5, 0xaa, 0xaf, 0xaa, 0xa2, 0x5a, 0x72, 0x91, 0xa0, 0x86, 0x73, 0x71,
-    0x74, 0x87, 0xa1, 0x8f, 0x81, 0x85, 0x8c, 0x86, 0x1c, 0x02, 0x00, 0x02,
-    0x03, 0x05, 0x08, 0x0a, 0x19, 0x19, 0x19, 0x19, 0x21, 0x21, 0x21, 0x19,
-    0x19, 0x19, 0x1c, 0x16, 0x12, 0x16, 0x0c, 0x09, 0x03, 0x03, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x06, 0x0c, 0x0c, 0x0d, 0x12, 0x1b,
-    0x1e, 0x1e, 0x3d, 0x64, 0x6a, 0x78, 0x85, 0x91, 0x87, 0x77, 0x60, 0x5e,
-    0x3e, 0x47, 0x46, 0x54, 0x50, 0x50, 0x58, 0x74, 0x6b, 0x50, 0x57, 0x7f,
-    0x93, 0xaa, 0x75, 0x68, 0x68, 0x88, 0x9c, 0xa7, 0xc8, 0xd7, 0xd9, 0xd7,
-    0xca, 0xb6, 0xb6, 0xa5, 0xa2, 0x9a, 0xb1, 0xdc, 0xdc, 0xdc, 0xdc, 0xeb,
-    0xc2, 0xab, 0xc2, 0xc9, 0xb8, 0xc2, 0xc2, 0xc2, 0xab, 0xab, 0xb5, 0xc9,
-    0xbb, 0xb8, 0xab, 0xab, 0xc2, 0xd7, 0xe8, 0xe8, 0xda, 0xc1, 0xc1, 0xa9,
-    0x8a, 0x8a, 0x9c, 0x94, 0x7f, 0x7f, 0x93, 0xa8, 0xb8, 0xc9, 0xe9, 0xe8,
-    0xdc, 0xd7, 0xca, 0xab, 0x7c, 0x72, 0xa2, 0xb5, 0xb5, 0xb5, 0xab, 0x9c,
-    0x94, 0x7c, 0x70, 0x5b, 0x42, 0x32, 0x2c, 0x23, 0x1d, 0x28, 0x45, 0x51,
-    0x5a, 0x5a, 0x87, 0xd2, 0xe4, 0xee, 0xe3, 0xe1, 0xd5, 0xa5, 0x88, 0x70,
-    0x68, 0x68, 0x57, 0x68, 0x70, 0x70, 0x4b, 0x32, 0x23, 0x23, 0x23, 0x1a,
-    0x1a, 0x14, 0x14, 0x1b, 0x2d, 0x78, 0x7a, 0x71, 0x71, 0x71, 0x68, 0x4b,
-    0x37, 0x23, 0x23, 0x45, 0x51, 0x4b, 0x4b, 0x51, 0x37, 0x30, 0x1d, 0x0d,
-    0x08, 0x05, 0x08, 0x0a, 0x12, 0x2d, 0xbb, 0xdc, 0xd7, 0xd8, 0xda, 0xd7,
-    0xd5, 0xca, 0xab, 0x88, 0xd5, 0xa6, 0x8a, 0x9c, 0x88, 0x70, 0x70, 0x7a,
-    0xcf, 0xe9, 0xd7, 0xca, 0xde, 0xd9, 0xc8, 0x8d, 0xa7, 0xd8, 0xa4, 0xa9,
-    0xda, 0xd7, 0xf6, 0xfe, 0xfd, 0xfd, 0xfa, 0xf9, 0xf7, 0xf7, 0xf6, 0xf5,
-    0xef, 0xef, 0xf6, 0xf7, 0xf7, 0xfd, 0xf5, 0xef, 0xea, 0xe9, 0xed, 0xed,
-    0xf6, 0xf5, 0xf5, 0xf5, 0xe7, 0xd7, 0xd9, 0xd5, 0xce, 0xbc, 0xac, 0xac,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x7b, 0x7b, 0x7b, 0x91, 0x9f, 0x85, 0x97, 0xaa,
-    0xbe, 0xb2, 0xb2, 0xac, 0xbb, 0xc6, 0xc6, 0xc6, 0xce, 0xce, 0xce, 0xbb,
-    0xbb, 0xc6, 0xc6, 0xb1, 0x9f, 0xae, 0xcf, 0xb1, 0xaa, 0xaa, 0xa2, 0xa2,
-    0x9f, 0x6f, 0x6c, 0x74, 0x75, 0x75, 0x74, 0x85, 0x77, 0x75, 0x9f, 0xa0,
-    0x86, 0x75, 0x85, 0x78, 0x22, 0x03, 0x02, 0x02, 0x03, 0x05, 0x08, 0x0a,
-    0x12, 0x12, 0x19, 0x1c, 0x19, 0x19, 0x19, 0x19, 0x1e, 0x21, 0x1c, 0x1c,
-    0x16, 0x16, 0x0c, 0x09, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x06, 0x0c, 0x0c, 0x15, 0x16, 0x1c, 0x4e, 0x4e, 0x67, 0x81,
-    0x81, 0x87, 0x91, 0xa3, 0x8c, 0x86, 0x6c, 0x54, 0x3a, 0x27, 0x2e, 0x54,
-    0x4d, 0x4d, 0x50, 0x74, 0x58, 0x58, 0x68, 0x68, 0x68, 0x74, 0x44, 0x37,
-    0x37, 0x82, 0x88, 0x8a, 0xad, 0xb6, 0xc8, 0xc8, 0xc8, 0xb6, 0xb5, 0x94,
-    0xb8, 0xdc, 0xdd, 0xdd, 0xdc, 0xe0, 0xdd, 0xe1, 0xc2, 0xab, 0xcc, 0xdc,
-    0xc9, 0xc2, 0xab, 0xb5, 0xb5, 0xab, 0xab, 0xbb, 0xb2, 0xbe, 0xc9, 0xb5,
-    0xb5, 0xc2, 0xd7, 0xda, 0xc8, 0xa7, 0xa9, 0xa9, 0x89, 0x8a, 0x88, 0x94,
-    0x7f, 0x7f, 0x93, 0xb8, 0xc9, 0xdc, 0xe8, 0xe6, 0xd7, 0xca, 0xab, 0x9c,
-    0x7c, 0x82, 0x93, 0xa5, 0xab, 0x9c, 0x9c, 0x88, 0x7c, 0x70, 0x5b, 0x4b,
-    0x42, 0x32, 0x2c, 0x23, 0x1d, 0x1d, 0x30, 0x44, 0x51, 0x51, 0x7a, 0xb4,
-    0xe3, 0xe4, 0xe3, 0xdd, 0xc9, 0x9c, 0x7c, 0x70, 0x5b, 0x4b, 0x42, 0x42,
-    0x42, 0x42, 0x37, 0x23, 0x23, 0x28, 0x1d, 0x1a, 0x14, 0x14, 0x14, 0x2a,
-    0x7d, 0x9a, 0x93, 0x7f, 0x70, 0x70, 0x68, 0x57, 0x42, 0x2c, 0x23, 0x30,
-    0x37, 0x43, 0x4b, 0x44, 0x37, 0x27, 0x14, 0x0a, 0x07, 0x0a, 0x0c, 0x0c,
-    0x10, 0x1d, 0xa2, 0xca, 0xc8, 0xca, 0xca, 0xc8, 0xab, 0x8a, 0x8a, 0x9c,
-    0xc9, 0xb5, 0x8a, 0x76, 0x5b, 0x4b, 0x72, 0xa2, 0xaa, 0xea, 0xd7, 0xc8,
-    0xc8, 0xca, 0xc5, 0xa7, 0xd7, 0xe8, 0xc8, 0xc8, 0xd7, 0xeb, 0xfe, 0xfd,
-    0xf6, 0xf6, 0xf9, 0xf5, 0xd8, 0xd8, 0xef, 0xf5, 0xef, 0xf5, 0xf6, 0xf7,
-    0xf6, 0xf6, 0xef, 0xef, 0xef, 0xea, 0xf6, 0xf6, 0xf5, 0xef, 0xe7, 0xe7,
-    0xd9, 0xd9, 0xce, 0xce, 0xbe, 0xbe, 0xae, 0xa3, 0x7e, 0xa0, 0xa0, 0xa1,
-    0x7e, 0x69, 0x7e, 0x7e, 0x81, 0x75, 0x84, 0xaa, 0xae, 0xb2, 0xb4, 0xb2,
-    0xac, 0xbb, 0xbb, 0xc6, 0xce, 0xcf, 0xcf, 0xbe, 0xbb, 0xbb, 0xb1, 0xb1,
-    0x9f, 0xb1, 0xcf, 0xe1, 0xcf, 0xa2, 0x8c, 0x9f, 0xa0, 0x87, 0x51, 0x43,
-    0x58, 0x75, 0x91, 0xa0, 0x9d, 0x7e, 0x77, 0x86, 0x87, 0x87, 0x78, 0x4e,
-    0x15, 0x03, 0x02, 0x02, 0x03, 0x05, 0x08, 0x08, 0x0a, 0x12, 0x12, 0x1c,
-    0x1c, 0x12, 0x19, 0x21, 0x1e, 0x1e, 0x19, 0x16, 0x0c, 0x0c, 0x0c, 0x09,
-    0x03, 0x03, 0x04, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x06, 0x0b,
-    0x0c, 0x15, 0x22, 0x33, 0x69, 0x81, 0xa0, 0x9d, 0xa0, 0x9d, 0x9f, 0xa3,
-    0xa3, 0x91, 0x86, 0x61, 0x46, 0x27, 0x2e, 0x46, 0x46, 0x4d, 0x43, 0x50,
-    0x58, 0x73, 0x91, 0x75, 0x37, 0x51, 0x5e, 0x53, 0x5a, 0x71, 0x7f, 0x94,
-    0x8a, 0x8a, 0x89, 0xad, 0xb6, 0xa6, 0xa5, 0x94, 0xa6, 0xca, 0xd9, 0xdd,
-    0xeb, 0xee, 0xe0, 0xeb, 0xab, 0xb5, 0xc9, 0xc9, 0xc1, 0xb5, 0xb8, 0xcc,
-    0xd5, 0xab, 0xab, 0xc9, 0xb8, 0xca, 0xc8, 0xab, 0xb5, 0xab, 0xc1, 0xa9,
-    0xa9, 0xa9, 0x89, 0x89, 0x8a, 0x76, 0x7c, 0x88, 0x71, 0x7f, 0x93, 0xca,
-    0xc9, 0xd7, 0xd7, 0xd7, 0xc8, 0xab, 0x8a, 0x8a, 0x70, 0x7f, 0x93, 0x93,
-    0x9c, 0x9c, 0x9c, 0x88, 0x70, 0x68, 0x57, 0x42, 0x32, 0x2c, 0x2c, 0x23,
-    0x23, 0x1d, 0x23, 0x2c, 0x37, 0x44, 0x51, 0x9f, 0xba, 0xd3, 0xe1, 0xdc,
-    0xb8, 0x9c, 0x76, 0x70, 0x5b, 0x57, 0x42, 0x42, 0x37, 0x42, 0x30, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1a, 0x14, 0x14, 0x34, 0x9b, 0xb1, 0x93, 0x7c,
-    0x7c, 0x70, 0x5b, 0x57, 0x42, 0x37, 0x23, 0x1d, 0x27, 0x30, 0x37, 0x2e,
-    0x1f, 0x10, 0x07, 0x07, 0x0a, 0x0a, 0x0a, 0x12, 0x14, 0x1b, 0x60, 0xb8,
-    0xca, 0xca, 0xb6, 0x8a, 0x89, 0x8a, 0xa7, 0x8a, 0xc9, 0xc9, 0xa5, 0x70,
-    0x68, 0x4b, 0x71, 0x93, 0xa2, 0xb8, 0xd7, 0xc1, 0xc1, 0xca, 0xbf, 0xc1,
-    0xdc, 0xed, 0xe9, 0xe9, 0xeb, 0xf7, 0xfd, 0xfd, 0xf5, 0xf5, 0xf7, 0xef,
-    0xd8, 0xd8, 0xd7, 0xe8, 0xf5, 0xf7, 0xf7, 0xf6, 0xf5, 0xea, 0xef, 0xe6,
-    0xef, 0xf6, 0xf7, 0xf6, 0xef, 0xe6, 0xe6, 0xd7, 0xd9, 0xce, 0xbe, 0xd1,
-    0xb7, 0xb7, 0xae, 0x9f, 0x7e, 0x7e, 0x81, 0x80, 0x6d, 0x69, 0x6d, 0x81,
-    0x69, 0x6f, 0x75, 0x8c, 0xae, 0xb2, 0xb4, 0xa0, 0xa3, 0xbb, 0xcc, 0xce,
-    0xcf, 0xcf, 0xd2, 0xd2, 0xcf, 0xb1, 0xbe, 0xb2, 0xb2, 0xbb, 0xc6, 0xdc,
-    0xdc, 0xb1, 0xa2, 0xaa, 0x86, 0x75, 0x60, 0x5a, 0x77, 0x5a, 0x5a, 0x75,
-    0x61, 0x54, 0x6c, 0x75, 0x7b, 0x7e, 0x6a, 0x22, 0x09, 0x04, 0x02, 0x03,
-    0x03, 0x05, 0x08, 0x08, 0x0c, 0x13, 0x12, 0x16, 0x16, 0x12, 0x19, 0x19,
-    0x19, 0x19, 0x12, 0x16, 0x0c, 0x0a, 0x0c, 0x0b, 0x06, 0x03, 0x03, 0x02,
-    0x04, 0x03, 0x04, 0x06, 0x03, 0x02, 0x04, 0x05, 0x0c, 0x12, 0x22, 0x48,
-    0x6f, 0x77, 0x86, 0x8c, 0x8c, 0xae, 0xa3, 0xa3, 0xa3, 0x91, 0x86, 0x75,
-    0x54, 0x2e, 0x27, 0x27, 0x2e, 0x50, 0x43, 0x43, 0x44, 0x61, 0x84, 0x75,
-    0x51, 0x58, 0x61, 0x74, 0x73, 0x68, 0x7f, 0x7f, 0x76, 0x94, 0x8e, 0xa6,
-    0xbb, 0x7f, 0x93, 0x71, 0xb5, 0xb5, 0xaf, 0xdf, 0xe1, 0xeb, 0xdf, 0xd9,
-    0xab, 0xb8, 0xc2, 0xab, 0xa7, 0xab, 0xc9, 0xdd, 0xdd, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xab, 0xa7, 0xa7, 0x9c, 0xab, 0xab, 0xa7, 0x8a, 0xa7, 0x8a, 0x79,
-    0x76, 0x76, 0x76, 0x70, 0x57, 0x71, 0x93, 0xab, 0xc8, 0xc8, 0xc1, 0xc8,
-    0xab, 0x8a, 0x8a, 0x76, 0x5b, 0x68, 0x72, 0x82, 0x7c, 0x7c, 0x82, 0x71,
-    0x68, 0x68, 0x68, 0x4b, 0x42, 0x37, 0x2c, 0x23, 0x23, 0x1a, 0x1d, 0x23,
-    0x2c, 0x37, 0x44, 0x6f, 0xa0, 0xd3, 0xcf, 0xcc, 0xbb, 0x94, 0x7c, 0x88,
-    0x93, 0x93, 0x71, 0x57, 0x42, 0x42, 0x30, 0x1d, 0x1a, 0x1a, 0x1d, 0x1d,
-    0x1a, 0x14, 0x1b, 0x67, 0x9a, 0xa8, 0x93, 0x88, 0x7c, 0x70, 0x5b, 0x66,
-    0x4b, 0x43, 0x2c, 0x1a, 0x14, 0x1a, 0x1a, 0x14, 0x0a, 0x05, 0x05, 0x07,
-    0x0a, 0x0a, 0x12, 0x1c, 0x1b, 0x1b, 0x28, 0x8c, 0xca, 0xab, 0xab, 0xa7,
-    0x79, 0x9c, 0xab, 0x9c, 0xab, 0x88, 0x70, 0x7f, 0x7f, 0x5b, 0x71, 0x82,
-    0xb5, 0xca, 0xc9, 0xe8, 0xdc, 0xe6, 0xc5, 0x89, 0xc8, 0xe7, 0xf9, 0xf9,
-    0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xef, 0xef, 0xe9, 0xf7, 0xe9, 0xe8,
-    0xf6, 0xf6, 0xf6, 0xf6, 0xf5, 0xef, 0xe7, 0xea, 0xf6, 0xfd, 0xfd, 0xf6,
-    0xef, 0xda, 0xde, 0xd5, 0xd5, 0xbc, 0xa3, 0xae, 0xb7, 0xb7, 0xa0, 0xa1,
-    0x81, 0x81, 0x6d, 0x81, 0x6d, 0x6d, 0x6d, 0x6d, 0x69, 0x5e, 0x6c, 0x8c,
-    0xae, 0xb2, 0xb4, 0xb4, 0xae, 0xce, 0xcf, 0xdd, 0xcf, 0xcf, 0xe1, 0xe1,
-    0xd2, 0xcf, 0xce, 0xdd, 0xcf, 0xbb, 0xca, 0xd7, 0xdc, 0xdd, 0xb2, 0xb2,
-    0xa0, 0xb2, 0xd2, 0xcf, 0xa0, 0x78, 0x77, 0x78, 0x55, 0x47, 0x44, 0x55,
-    0x56, 0x4e, 0x33, 0x1c, 0x0b, 0x05, 0x03, 0x03, 0x03, 0x03, 0x05, 0x08,
-    0x0b, 0x0c, 0x16, 0x16, 0x16, 0x12, 0x12, 0x19, 0x12, 0x12, 0x12, 0x0c,
-    0x0c, 0x13, 0x15, 0x0b, 0x06, 0x03, 0x03, 0x02, 0x03, 0x06, 0x09, 0x09,
-    0x0b, 0x05, 0x02, 0x03, 0x0c, 0x22, 0x33, 0x3d, 0x5a, 0x85, 0x93, 0xa8,
-    0xa8, 0xaa, 0xbb, 0xac, 0xa3, 0x8c, 0x84, 0x75, 0x5e, 0x47, 0x2e, 0x27,
-    0x1f, 0x54, 0x46, 0x46, 0x3a, 0x27, 0x51, 0x77, 0x87, 0x75, 0x85, 0x74,
-    0x6b, 0x68, 0x68, 0x70, 0x71, 0x97, 0x71, 0x76, 0xa6, 0x71, 0x82, 0x72,
-    0xb5, 0xb5, 0xb6, 0xd5, 0xd9, 0xd9, 0xd9, 0xd5, 0xcc, 0xdd, 0xc2, 0xab,
-    0xab, 0x9c, 0xb8, 0xd7, 0xc9, 0xc8, 0xab, 0xb5, 0xab, 0xab, 0xa7, 0x8a,
-    0x8a, 0xab, 0xc2, 0xc9, 0xb5, 0xc9, 0xb5, 0x88, 0x76, 0x5b, 0x70, 0x68,
-    0x57, 0x71, 0x94, 0xa5, 0xab, 0xab, 0xab, 0xa7, 0x8a, 0x8a, 0x76, 0x5b,
-    0x57, 0x57, 0x57, 0x57, 0x57, 0x68, 0x68, 0x68, 0x57, 0x57, 0x58, 0x42,
-    0x32, 0x32, 0x2c, 0x23, 0x23, 0x1a, 0x1d, 0x1d, 0x30, 0x45, 0x53, 0x7a,
-    0x9f, 0xd1, 0xce, 0xc6, 0xa5, 0xa5, 0xc6, 0xdc, 0xc9, 0xb5, 0xab, 0x82,
-    0x82, 0x72, 0x37, 0x1d, 0x1d, 0x1b, 0x1d, 0x1f, 0x1b, 0x1e, 0x56, 0x86,
-    0xa8, 0xa8, 0xa5, 0x88, 0x7c, 0x70, 0x5b, 0x5b, 0x4b, 0x43, 0x3a, 0x23,
-    0x1a, 0x14, 0x0a, 0x08, 0x03, 0x02, 0x03, 0x08, 0x07, 0x0a, 0x12, 0x14,
-    0x1b, 0x1d, 0x1d, 0x53, 0x93, 0xab, 0xab, 0x8a, 0x9c, 0xc9, 0xc6, 0x9c,
-    0x7c, 0x7c, 0x94, 0x93, 0x88, 0x70, 0x68, 0x71, 0x93, 0xd7, 0xe6, 0xe9,
-    0xe6, 0xd7, 0xde, 0xd7, 0xf7, 0xf9, 0xf9, 0xfe, 0xf7, 0xf6, 0xf5, 0xef,
-    0xf5, 0xf5, 0xf5, 0xef, 0xea, 0xed, 0xe8, 0xdc, 0xf6, 0xf6, 0xf6, 0xef,
-    0xef, 0xe6, 0xde, 0xe6, 0xf6, 0xfd, 0xfd, 0xf6, 0xe6, 0xd8, 0xd5, 0xd5,
-    0xd5, 0xbb, 0x97, 0xa3, 0x9f, 0xa0, 0x9d, 0xa1, 0x81, 0x81, 0x6d, 0x6d,
-    0x6d, 0x6d, 0x6d, 0x6a, 0x4e, 0x55, 0x5a, 0x84, 0xaa, 0xb1, 0xb4, 0xb4,
-    0xb2, 0xce, 0xdc, 0xdd, 0xdd, 0xe1, 0xdd, 0xdd, 0xe1, 0xcf, 0xcf, 0xdd,
-    0xe1, 0xe1, 0xcf, 0xd5, 0xdc, 0xeb, 0xd2, 0xbb, 0xc6, 0xcf, 0xe3, 0xb4,
-    0xa0, 0x7e, 0x86, 0x87, 0x64, 0x47, 0x55, 0x64, 0x4c, 0x4e, 0x33, 0x34,
-    0x15, 0x0b, 0x09, 0x06, 0x02, 0x02, 0x03, 0x05, 0x08, 0x08, 0x0c, 0x0c,
-    0x0c, 0x12, 0x12, 0x19, 0x12, 0x16, 0x16, 0x0c, 0x0c, 0x0c, 0x0c, 0x09,
-    0x06, 0x02, 0x02, 0x03, 0x08, 0x0c, 0x13, 0x1c, 0x15, 0x08, 0x03, 0x03,
-    0x06, 0x22, 0x33, 0x47, 0x6c, 0x8c, 0xaa, 0xaa, 0xbb, 0xbb, 0xaa, 0xa3,
-    0xa3, 0x85, 0x84, 0x84, 0x75, 0x61, 0x46, 0x2e, 0x1d, 0x28, 0x36, 0x2e,
-    0x3a, 0x23, 0x5a, 0x91, 0x91, 0x8c, 0x8c, 0x74, 0x58, 0x4b, 0x71, 0x71,
-    0x71, 0x94, 0x68, 0x66, 0x73, 0x57, 0x72, 0x8c, 0xa5, 0xa6, 0xa6, 0xaf,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xc9, 0xdc, 0xc9, 0xab, 0x9c, 0x88, 0xab, 0xab,
-    0xab, 0xa7, 0x9c, 0xab, 0x9c, 0x8a, 0x8a, 0x76, 0x76, 0xb5, 0xcc, 0xdd,
-    0xdd, 0xeb, 0xdc, 0xb5, 0x9c, 0x70, 0x71, 0x68, 0x68, 0x82, 0x88, 0x9c,
-    0xab, 0xab, 0xab, 0x8a, 0x76, 0x7c, 0x5b, 0x5b, 0x57, 0x57, 0x4b, 0x42,
-    0x42, 0x42, 0x4b, 0x57, 0x57, 0x42, 0x42, 0x37, 0x2c, 0x2c, 0x2c, 0x23,
-    0x23, 0x28, 0x30, 0x30, 0x45, 0x60, 0x9a, 0xb1, 0xa8, 0xb1, 0xc6, 0xbb,
-    0xab, 0xc9, 0xeb, 0xeb, 0xc9, 0xc8, 0xab, 0x9c, 0x88, 0x71, 0x4b, 0x53,
-    0x53, 0x3d, 0x2a, 0x1b, 0x1e, 0x31, 0x87, 0xaa, 0xa5, 0xa5, 0xa5, 0x9c,
-    0x76, 0x70, 0x5b, 0x5b, 0x57, 0x42, 0x32, 0x23, 0x1d, 0x14, 0x0a, 0x07,
-    0x03, 0x02, 0x03, 0x05, 0x08, 0x0a, 0x0d, 0x14, 0x14, 0x1b, 0x1a, 0x1d,
-    0x30, 0x51, 0x8c, 0xa5, 0xb8, 0xab, 0x88, 0x9c, 0xa5, 0x7c, 0x7c, 0x94,
-    0x88, 0x68, 0x72, 0x93, 0xcc, 0xe9, 0xdc, 0xd7, 0xd7, 0xc8, 0xd9, 0xf9,
-    0xfa, 0xfa, 0xfa, 0xfd, 0xf6, 0xef, 0xdb, 0xdb, 0xd8, 0xd8, 0xde, 0xde,
-    0xde, 0xd7, 0xea, 0xe9, 0xf6, 0xf6, 0xf5, 0xef, 0xe6, 0xde, 0xc8, 0xde,
-    0xe7, 0xf6, 0xf6, 0xef, 0xd8, 0xc8, 0xd5, 0xd7, 0xcc, 0xc6, 0xaf, 0x8c,
-    0x9f, 0xa0, 0xa1, 0xa1, 0x81, 0x7e, 0x81, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a,
-    0x4e, 0x55, 0x5a, 0x84, 0x8c, 0xbe, 0xb4, 0xb4, 0xb2, 0xbc, 0xd9, 0xdd,
-    0xeb, 0xe3, 0xdd, 0xdd, 0xeb, 0xe1, 0xdd, 0xdd, 0xdc, 0xdd, 0xdd, 0xd5,
-    0xd9, 0xe1, 0xe1, 0xcc, 0xca, 0xca, 0xdd, 0xce, 0xa0, 0x5e, 0x6b, 0x86,
-    0x78, 0x5e, 0x56, 0x64, 0x64, 0x4c, 0x48, 0x33, 0x22, 0x22, 0x25, 0x09,
-    0x03, 0x03, 0x05, 0x06, 0x05, 0x08, 0x0c, 0x0c, 0x0c, 0x0a, 0x0d, 0x12,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x06, 0x03, 0x06, 0x0b,
-    0x0a, 0x1c, 0x22, 0x22, 0x22, 0x15, 0x0b, 0x09, 0x0a, 0x1c, 0x2d, 0x53,
-    0x74, 0xa2, 0xb7, 0xbe, 0xbb, 0xaa, 0xaf, 0x97, 0x91, 0x91, 0x7b, 0x91,
-    0x85, 0x61, 0x46, 0x27, 0x10, 0x07, 0x28, 0x3a, 0x51, 0x51, 0xa2, 0xa3,
-    0x91, 0xa2, 0x94, 0xaa, 0x9d, 0x60, 0x6b, 0x57, 0x42, 0x6b, 0x68, 0x82,
-    0x58, 0x44, 0x75, 0x84, 0x71, 0x76, 0x94, 0x96, 0x96, 0x94, 0x8e, 0xa6,
-    0xab, 0xab, 0x9c, 0x8a, 0x88, 0x94, 0x88, 0x9c, 0x8a, 0x9c, 0x9c, 0xa5,
-    0xa5, 0x88, 0x8a, 0x76, 0x7c, 0xc9, 0xdd, 0xdd, 0xe9, 0xeb, 0xdc, 0xc9,
-    0xab, 0x7f, 0x82, 0x68, 0x71, 0x93, 0x88, 0x88, 0x88, 0x88, 0x9c, 0x7c,
-    0x70, 0x76, 0x5b, 0x5b, 0x4b, 0x4b, 0x4b, 0x42, 0x37, 0x37, 0x42, 0x4b,
-    0x42, 0x32, 0x2c, 0x37, 0x2c, 0x2c, 0x2c, 0x23, 0x45, 0x60, 0x9a, 0x9a,
-    0x7a, 0x9b, 0xcf, 0xc9, 0xb5, 0xbb, 0xc6, 0xa5, 0xa5, 0xdd, 0xeb, 0xe8,
-    0xd7, 0xc8, 0xa7, 0xab, 0x88, 0x70, 0x68, 0x6c, 0x7a, 0x60, 0x2d, 0x2a,
-    0x48, 0x64, 0x87, 0xaa, 0xa5, 0xa6, 0x94, 0xa6, 0x88, 0x7c, 0x7c, 0x9c,
-    0x94, 0x71, 0x4b, 0x37, 0x23, 0x1a, 0x1b, 0x10, 0x07, 0x03, 0x03, 0x05,
-    0x08, 0x0a, 0x0a, 0x10, 0x14, 0x1b, 0x1e, 0x1a, 0x1d, 0x28, 0x77, 0xb5,
-    0xab, 0x8a, 0x8a, 0xa5, 0xb5, 0x8a, 0x5c, 0x5b, 0x5b, 0x5b, 0x93, 0xd5,
-    0xeb, 0xeb, 0xd7, 0xda, 0xc8, 0xd7, 0xe9, 0xf7, 0xf9, 0xf9, 0xf9, 0xf6,
-    0xef, 0xef, 0xdb, 0xd8, 0xdb, 0xd8, 0xd8, 0xef, 0xe9, 0xeb, 0xeb, 0xf6,
-    0xf6, 0xf5, 0xef, 0xe6, 0xe6, 0xd7, 0xc8, 0xde, 0xe6, 0xea, 0xef, 0xe6,
-    0xd8, 0xc8, 0xdc, 0xdd, 0xdc, 0xd7, 0xc6, 0x93, 0x7b, 0x7e, 0x81, 0x80,
-    0x7e, 0x7e, 0x69, 0x4c, 0x4c, 0x6a, 0x67, 0x80, 0x4e, 0x55, 0x5a, 0x74,
-    0x84, 0xac, 0xb2, 0xb2, 0xb2, 0xbc, 0xce, 0xdc, 0xe1, 0xe1, 0xdd, 0xe1,
-    0xe3, 0xe1, 0xdd, 0xdc, 0xdc, 0xe9, 0xe1, 0xc6, 0xc6, 0xdc, 0xcc, 0xbb,
-    0xc9, 0xc9, 0xdd, 0xcc, 0xcf, 0xd2, 0xd3, 0x9d, 0x6a, 0x56, 0x56, 0x64,
-    0x56, 0x48, 0x48, 0x48, 0x40, 0x33, 0x35, 0x15, 0x07, 0x05, 0x06, 0x06,
-    0x05, 0x05, 0x08, 0x08, 0x0c, 0x0a, 0x0a, 0x15, 0x0c, 0x0c, 0x08, 0x0c,
-    0x12, 0x1c, 0x22, 0x26, 0x26, 0x18, 0x15, 0x13, 0x1c, 0x1c, 0x20, 0x2a,
-    0x20, 0x13, 0x0b, 0x0c, 0x12, 0x1e, 0x2e, 0x44, 0x6b, 0x97, 0xac, 0xbe,
-    0xaa, 0xaa, 0xa2, 0x97, 0x84, 0x84, 0x84, 0x84, 0x75, 0x54, 0x3e, 0x2b,
-    0x07, 0x10, 0x2e, 0x51, 0x5a, 0x77, 0xaa, 0xbb, 0xbb, 0xce, 0xbe, 0xce,
-    0xbe, 0x85, 0x75, 0x44, 0x44, 0x7a, 0x72, 0x85, 0x58, 0x51, 0x7a, 0x7f,
-    0x71, 0x94, 0x93, 0x96, 0x83, 0x71, 0x7f, 0xa2, 0x88, 0x9c, 0x7c, 0x7c,
-    0x88, 0xa8, 0x9c, 0x9c, 0x7c, 0x9c, 0xc9, 0xcc, 0xc9, 0x9c, 0x7c, 0xab,
-    0x9c, 0xb8, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xc1, 0xa7, 0x88, 0x93, 0x82,
-    0x93, 0x93, 0x93, 0x94, 0x88, 0x88, 0x7c, 0x7c, 0x76, 0x5b, 0x68, 0x68,
-    0x42, 0x42, 0x42, 0x32, 0x2c, 0x2c, 0x2c, 0x37, 0x42, 0x37, 0x2c, 0x2c,
-    0x23, 0x23, 0x30, 0x53, 0x9b, 0xcf, 0xcf, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc,
-    0xc2, 0xa8, 0xb1, 0xa5, 0xa2, 0xdd, 0xe8, 0xd7, 0xda, 0xa7, 0x8a, 0x8a,
-    0x76, 0x70, 0x71, 0x72, 0x71, 0x68, 0x45, 0x45, 0x60, 0x86, 0x8c, 0x8c,
-    0x94, 0x88, 0x7c, 0x9c, 0x9c, 0xca, 0xd5, 0xd7, 0xca, 0xa6, 0x7f, 0x57,
-    0x30, 0x1d, 0x28, 0x2b, 0x12, 0x05, 0x05, 0x0a, 0x12, 0x12, 0x10, 0x1b,
-    0x1d, 0x28, 0x28, 0x1d, 0x1d, 0x47, 0x82, 0x9c, 0xab, 0x9c, 0x9c, 0xab,
-    0xb5, 0x9c, 0x76, 0x70, 0x94, 0x88, 0x82, 0xd5, 0xe8, 0xe6, 0xda, 0xd7,
-    0xc9, 0xd7, 0xea, 0xf6, 0xf6, 0xf6, 0xf6, 0xe8, 0xde, 0xe6, 0xde, 0xde,
-    0xdb, 0xc5, 0xd8, 0xea, 0xee, 0xfa, 0xf7, 0xea, 0xef, 0xef, 0xdb, 0xdb,
-    0xde, 0xe6, 0xda, 0xe6, 0xea, 0xea, 0xe6, 0xd7, 0xc8, 0xca, 0xdc, 0xeb,
-    0xeb, 0xdc, 0xc6, 0x97, 0x74, 0x75, 0x5e, 0x69, 0x81, 0x78, 0x61, 0x54,
-    0x54, 0x61, 0x5e, 0x67, 0x6a, 0x55, 0x6c, 0x74, 0x82, 0xaa, 0xb4, 0xb4,
-    0xb2, 0xae, 0xbc, 0xbc, 0xce, 0xcf, 0xcf, 0xd3, 0xd3, 0xd1, 0xcf, 0xd9,
-    0xe6, 0xeb, 0xeb, 0xce, 0xbb, 0xbb, 0xbb, 0xcc, 0xcc, 0xdc, 0xe1, 0xe3,
-    0xe1, 0xe3, 0xe4, 0xe4, 0x80, 0x48, 0x48, 0x69, 0x4c, 0x55, 0x5e, 0x5e,
-    0x5e, 0x55, 0x56, 0x4e, 0x20, 0x13, 0x11, 0x06, 0x05, 0x05, 0x08, 0x08,
-    0x08, 0x0c, 0x0c, 0x0c, 0x0b, 0x08, 0x0c, 0x22, 0x1e, 0x2a, 0x2a, 0x22,
-    0x22, 0x20, 0x33, 0x34, 0x2a, 0x2a, 0x1e, 0x20, 0x1c, 0x13, 0x0b, 0x08,
-    0x12, 0x1e, 0x28, 0x46, 0x58, 0x84, 0x97, 0xa3, 0x97, 0x97, 0x84, 0x84,
-    0x97, 0x74, 0x84, 0x91, 0x6c, 0x6f, 0x56, 0x1e, 0x07, 0x1e, 0x30, 0x86,
-    0x85, 0xaa, 0xcc, 0xc6, 0xca, 0xd5, 0xdc, 0xce, 0xce, 0xaa, 0x93, 0x9f,
-    0x87, 0x5a, 0x37, 0x58, 0x51, 0x51, 0x5a, 0x6b, 0x72, 0x82, 0x71, 0x85,
-    0x71, 0x7f, 0xaa, 0xac, 0x7c, 0x7c, 0x5b, 0x7f, 0xa5, 0xc6, 0xb5, 0xab,
-    0xa5, 0xb8, 0xdd, 0xdd, 0xcc, 0xab, 0x9c, 0x93, 0xab, 0xb5, 0xb5, 0xc9,
-    0xc2, 0xc1, 0xab, 0xa7, 0x8a, 0x88, 0xa5, 0xa8, 0xa8, 0xb8, 0xb8, 0xbb,
-    0xa8, 0x93, 0x7c, 0x7c, 0x70, 0x5b, 0x57, 0x57, 0x42, 0x42, 0x32, 0x2c,
-    0x23, 0x23, 0x23, 0x37, 0x42, 0x42, 0x2c, 0x2c, 0x23, 0x23, 0x53, 0x9b,
-    0xcf, 0xdd, 0xcf, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xb8, 0xbb, 0xb1, 0xa8,
-    0xaa, 0xdc, 0xe8, 0xd7, 0xc2, 0xa7, 0x89, 0x8a, 0x76, 0x76, 0x70, 0x70,
-    0x68, 0x68, 0x6b, 0x6c, 0x6c, 0x6c, 0x7a, 0x82, 0x7f, 0x70, 0x70, 0x93,
-    0xca, 0xd7, 0xe7, 0xdf, 0xd7, 0xb6, 0x8a, 0x71, 0x4b, 0x30, 0x2e, 0x2b,
-    0x1b, 0x0a, 0x08, 0x13, 0x1c, 0x1e, 0x1b, 0x1b, 0x2a, 0x28, 0x28, 0x1d,
-    0x1e, 0x2d, 0x5a, 0x7f, 0x88, 0x9c, 0x88, 0x7c, 0x93, 0x93, 0x94, 0xab,
-    0xca, 0xe6, 0xe9, 0xe8, 0xe8, 0xe6, 0xdc, 0xda, 0xc1, 0xea, 0xf6, 0xf6,
-    0xf5, 0xef, 0xf5, 0xe9, 0xde, 0xe6, 0xe6, 0xde, 0xd8, 0xd6, 0xbf, 0xd9,
-    0xf0, 0xfa, 0xf9, 0xe9, 0xea, 0xef, 0xdb, 0xd8, 0xc5, 0xd8, 0xd7, 0xe9,
-    0xf7, 0xea, 0xd7, 0xd7, 0xca, 0xc9, 0xdd, 0xeb, 0xeb, 0xdc, 0xca, 0x96,
-    0x73, 0x61, 0x54, 0x69, 0x7e, 0x78, 0x6c, 0x75, 0x85, 0x74, 0x6c, 0x5e,
-    0x56, 0x5e, 0x75, 0x86, 0x8c, 0xaa, 0xb2, 0xb4, 0x9f, 0x85, 0x98, 0x97,
-    0xaa, 0xac, 0xbe, 0xb2, 0xae, 0xbe, 0xbe, 0xbc, 0xd9, 0xdd, 0xe1, 0xc6,
-    0xa2, 0xaa, 0xac, 0xd1, 0xce, 0xca, 0xca, 0xce, 0xe0, 0xe1, 0xee, 0xee,
-    0xd2, 0x81, 0x55, 0x55, 0x5e, 0x6f, 0x61, 0x61, 0x61, 0x6f, 0x5e, 0x69,
-    0x4e, 0x35, 0x22, 0x08, 0x06, 0x06, 0x06, 0x06, 0x05, 0x09, 0x0b, 0x0b,
-    0x08, 0x08, 0x16, 0x21, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f, 0x4c, 0x4c,
-    0x40, 0x33, 0x22, 0x1c, 0x13, 0x13, 0x07, 0x08, 0x13, 0x1e, 0x2d, 0x3e,
-    0x50, 0x6b, 0x73, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x86,
-    0x77, 0x61, 0x7b, 0x69, 0x1c, 0x1e, 0x64, 0x86, 0xaa, 0xaa, 0xbb, 0xaf,
-    0xca, 0xd9, 0xd9, 0xd9, 0xdc, 0xbb, 0x93, 0xa2, 0x86, 0x3e, 0x1d, 0x1d,
-    0x23, 0x44, 0x75, 0x6c, 0x58, 0x72, 0x68, 0x74, 0x6b, 0x68, 0x6b, 0x58,
-    0x7f, 0x70, 0x57, 0x7f, 0xa5, 0xb5, 0x9c, 0x9c, 0xab, 0xb5, 0xc9, 0xd5,
-    0xc2, 0xab, 0x8a, 0x9c, 0xa5, 0xb5, 0xa7, 0xab, 0xab, 0xa7, 0x8a, 0x8a,
-    0x76, 0x7c, 0x93, 0xa8, 0xb8, 0xb8, 0xcf, 0xdd, 0xcc, 0xb8, 0x93, 0x7f,
-    0x5b, 0x68, 0x4b, 0x42, 0x4b, 0x4b, 0x43, 0x2c, 0x23, 0x28, 0x23, 0x37,
-    0x42, 0x42, 0x37, 0x2c, 0x30, 0x30, 0x9a, 0xd2, 0xe1, 0xdc, 0xc9, 0xb5,
-    0xab, 0xab, 0xab, 0xb5, 0xb5, 0xb8, 0xa8, 0xa2, 0xc9, 0xe8, 0xe6, 0xda,
-    0xc8, 0xa7, 0x89, 0x8a, 0x76, 0x76, 0x88, 0x9c, 0x93, 0x93, 0x82, 0x72,
-    0x58, 0x4b, 0x58, 0x72, 0x6b, 0x7f, 0x93, 0xc9, 0xca, 0xd7, 0xd7, 0xde,
-    0xc8, 0xad, 0x8a, 0x7f, 0x66, 0x42, 0x2e, 0x1f, 0x14, 0x0a, 0x0c, 0x12,
-    0x19, 0x1e, 0x1b, 0x1c, 0x1e, 0x1d, 0x1d, 0x1a, 0x10, 0x1b, 0x3d, 0x6c,
-    0x82, 0x7a, 0x8c, 0xa8, 0xa8, 0xa8, 0xa5, 0xa5, 0xca, 0xe6, 0xe6, 0xe6,
-    0xd8, 0xc1, 0xd7, 0xd8, 0xc1, 0xed, 0xf6, 0xf5, 0xef, 0xe6, 0xe7, 0xea,
-    0xe6, 0xd8, 0xc8, 0xd7, 0xd8, 0xc8, 0xc8, 0xea, 0xf0, 0xfa, 0xfe, 0xfa,
-    0xf7, 0xe8, 0xde, 0xdb, 0xc5, 0xc5, 0xd7, 0xf7, 0xf7, 0xe9, 0xd7, 0xd5,
-    0xca, 0xbb, 0xce, 0xdf, 0xdc, 0xd5, 0xaf, 0x83, 0x75, 0x77, 0x86, 0x87,
-    0x78, 0x77, 0x86, 0x8c, 0xaa, 0xa2, 0x85, 0x6f, 0x5e, 0x6f, 0x86, 0x86,
-    0xaa, 0xbe, 0xb2, 0xa0, 0x7e, 0x61, 0x74, 0x84, 0x84, 0x91, 0x91, 0x9f,
-    0x9f, 0xa2, 0xaf, 0xbb, 0xd0, 0xd9, 0xce, 0xbb, 0xa2, 0x93, 0x94, 0xaf,
-    0xaf, 0xad, 0xad, 0xd5, 0xdd, 0xe1, 0xe1, 0xdd, 0xdc, 0xae, 0x55, 0x54,
-    0x61, 0x77, 0x61, 0x58, 0x75, 0x77, 0x6f, 0x69, 0x67, 0x4e, 0x4f, 0x3c,
-    0x26, 0x15, 0x06, 0x03, 0x03, 0x05, 0x06, 0x08, 0x08, 0x08, 0x12, 0x21,
-    0x1e, 0x2a, 0x1e, 0x2a, 0x2b, 0x3e, 0x47, 0x55, 0x48, 0x2f, 0x2a, 0x2a,
-    0x1c, 0x12, 0x13, 0x13, 0x12, 0x1b, 0x2f, 0x3e, 0x37, 0x50, 0x58, 0x58,
-    0x73, 0x74, 0x6b, 0x63, 0x58, 0x74, 0x74, 0x63, 0x75, 0x51, 0x54, 0x47,
-    0x28, 0x48, 0x86, 0x9a, 0xaa, 0xaa, 0xaf, 0xca, 0xd9, 0xe0, 0xe0, 0xd9,
-    0xc6, 0xce, 0xbe, 0xac, 0x86, 0x30, 0x28, 0x28, 0x28, 0x30, 0x9a, 0x7a,
-    0x68, 0x72, 0x68, 0x4b, 0x57, 0x84, 0x6b, 0x58, 0x7f, 0x7c, 0x70, 0x7c,
-    0x9c, 0x8a, 0x76, 0x70, 0x70, 0x9c, 0xab, 0xab, 0xa7, 0x8a, 0x8a, 0x8a,
-    0x9c, 0x8a, 0x79, 0x8a, 0x76, 0x8a, 0x76, 0x76, 0x70, 0x70, 0x88, 0xa5,
-    0xb8, 0xcc, 0xdd, 0xdd, 0xdd, 0xc9, 0xb8, 0x88, 0x7f, 0x71, 0x4b, 0x42,
-    0x42, 0x43, 0x42, 0x2c, 0x23, 0x2e, 0x23, 0x30, 0x3a, 0x30, 0x23, 0x23,
-    0x30, 0x53, 0xb1, 0xcf, 0xcc, 0xc9, 0xab, 0xab, 0xa5, 0xb5, 0xab, 0xb5,
-    0xab, 0x9c, 0x88, 0xa8, 0xcc, 0xe6, 0xd7, 0xc2, 0xa7, 0xa7, 0xab, 0x8a,
-    0x8a, 0xb8, 0xdc, 0xe6, 0xc2, 0xb5, 0xab, 0x88, 0x68, 0x72, 0x58, 0x6b,
-    0x6c, 0xa2, 0xa5, 0xca, 0xda, 0xde, 0xd8, 0xd8, 0xc5, 0xad, 0x89, 0x7f,
-    0x71, 0x57, 0x2c, 0x1f, 0x12, 0x08, 0x0c, 0x12, 0x1b, 0x1e, 0x1b, 0x1b,
-    0x1d, 0x1a, 0x14, 0x0d, 0x0d, 0x10, 0x3d, 0x77, 0x86, 0x7a, 0x7a, 0xa2,
-    0xc9, 0xa8, 0xbb, 0xe9, 0xea, 0xe6, 0xe6, 0xea, 0xe6, 0xd8, 0xc8, 0xd8,
-    0xda, 0xf5, 0xf5, 0xef, 0xe6, 0xde, 0xde, 0xd9, 0xd7, 0xc5, 0x89, 0x9c,
-    0xca, 0xd7, 0xe9, 0xf7, 0xf9, 0xf9, 0xf9, 0xf7, 0xea, 0xe6, 0xde, 0xde,
-    0xd8, 0xda, 0xeb, 0xfa, 0xf9, 0xf6, 0xe6, 0xc8, 0xa6, 0xbc, 0xce, 0xbc,
-    0xaf, 0xa6, 0x97, 0x91, 0x91, 0xae, 0xae, 0xac, 0xa2, 0x91, 0x9f, 0x9f,
-    0xae, 0x9f, 0x86, 0x6f, 0x5e, 0x78, 0x77, 0x8c, 0xaa, 0xb2, 0xb2, 0x87,
-    0x78, 0x6f, 0x75, 0x75, 0x86, 0x78, 0x87, 0x87, 0x87, 0x8c, 0x93, 0x97,
-    0xaa, 0xbb, 0xbc, 0x9f, 0x9f, 0xae, 0x96, 0x9c, 0xab, 0xad, 0xca, 0xdd,
-    0xe0, 0xe0, 0xdc, 0xdc, 0xea, 0xe3, 0x7d, 0x51, 0x6c, 0x75, 0x5a, 0x58,
-    0x74, 0x75, 0x75, 0x77, 0x78, 0x6a, 0x6e, 0x6e, 0x59, 0x3c, 0x15, 0x03,
-    0x02, 0x03, 0x05, 0x05, 0x06, 0x08, 0x0c, 0x1c, 0x1e, 0x1e, 0x2a, 0x2a,
-    0x2d, 0x3e, 0x47, 0x47, 0x48, 0x3d, 0x3d, 0x2d, 0x2a, 0x1c, 0x1c, 0x10,
-    0x0a, 0x1c, 0x2b, 0x2d, 0x3e, 0x46, 0x3a, 0x46, 0x58, 0x75, 0x7b, 0x7b,
-    0x69, 0x6f, 0x54, 0x4d, 0x61, 0x3a, 0x27, 0x28, 0x45, 0x60, 0x85, 0x82,
-    0xa2, 0x97, 0x96, 0xaf, 0xd9, 0xdc, 0xe0, 0xdf, 0xbc, 0xc6, 0xaa, 0x96,
-    0x72, 0x77, 0x56, 0x48, 0x30, 0x5a, 0xa2, 0x85, 0x72, 0x93, 0x58, 0x42,
-    0x42, 0x75, 0x61, 0x51, 0xa8, 0xa5, 0x7c, 0x7c, 0x7c, 0x70, 0x7c, 0x5b,
-    0x5b, 0x7c, 0x76, 0x8a, 0x8a, 0x76, 0x5c, 0x70, 0x7c, 0x76, 0x76, 0x8a,
-    0x76, 0x5c, 0x5c, 0x5b, 0x5b, 0x5b, 0x7c, 0x9c, 0xb5, 0xc9, 0xd5, 0xdc,
-    0xdd, 0xdd, 0xc9, 0x93, 0x7c, 0x68, 0x4b, 0x32, 0x32, 0x43, 0x42, 0x30,
-    0x28, 0x2e, 0x23, 0x23, 0x27, 0x1a, 0x1b, 0x1d, 0x30, 0x45, 0x9a, 0xcc,
-    0xbb, 0xb5, 0xab, 0xab, 0xb5, 0xb5, 0xab, 0x9c, 0x9c, 0x8a, 0x88, 0xcc,
-    0xdc, 0xd7, 0xd7, 0xd7, 0xc1, 0xab, 0xc2, 0xb5, 0xc2, 0xeb, 0xf7, 0xe8,
-    0xd8, 0xc1, 0xa7, 0x9c, 0x88, 0x93, 0x6b, 0x7a, 0xa2, 0xb8, 0xca, 0xc8,
-    0xc8, 0xc8, 0xc8, 0xc8, 0xbf, 0xa9, 0x89, 0x76, 0x70, 0x57, 0x37, 0x28,
-    0x0d, 0x08, 0x0a, 0x10, 0x1b, 0x28, 0x30, 0x37, 0x44, 0x44, 0x27, 0x14,
-    0x10, 0x2a, 0x77, 0x8c, 0x7a, 0x72, 0x57, 0x72, 0xa8, 0xd5, 0xe8, 0xea,
-    0xf7, 0xf7, 0xe8, 0xea, 0xea, 0xda, 0xc1, 0xa7, 0xca, 0xef, 0xef, 0xdb,
-    0xdb, 0xd8, 0xc5, 0xa7, 0xc1, 0xa9, 0x8d, 0x79, 0x88, 0xd5, 0xeb, 0xf9,
-    0xf7, 0xf6, 0xea, 0xef, 0xda, 0xc8, 0xd7, 0xda, 0xda, 0xd7, 0xeb, 0xfa,
-    0xf9, 0xf6, 0xe6, 0xc8, 0xaf, 0xbc, 0xce, 0xbc, 0xa6, 0x96, 0x98, 0x91,
-    0xac, 0xbe, 0xce, 0xc6, 0xbb, 0xa2, 0x91, 0x86, 0x9f, 0xb4, 0xa0, 0x5e,
-    0x46, 0x61, 0x75, 0x84, 0x8c, 0xaa, 0x9a, 0x86, 0x77, 0x77, 0x86, 0x87,
-    0x78, 0x78, 0x7d, 0x5e, 0x61, 0x85, 0x8c, 0x91, 0xa2, 0xa2, 0xa2, 0x8c,
-    0xbe, 0xb4, 0x9f, 0xaa, 0xc6, 0xce, 0xa6, 0xa6, 0xc8, 0xdc, 0xe0, 0xd9,
-    0xdd, 0xe1, 0x9f, 0x6c, 0x60, 0x78, 0x6f, 0x61, 0x63, 0x77, 0x78, 0x77,
-    0x6f, 0x7e, 0x80, 0x80, 0x6e, 0x4f, 0x26, 0x06, 0x03, 0x02, 0x03, 0x03,
-    0x03, 0x05, 0x0a, 0x1c, 0x1c, 0x1e, 0x2a, 0x40, 0x48, 0x48, 0x40, 0x40,
-    0x4c, 0x4c, 0x56, 0x56, 0x40, 0x1e, 0x1c, 0x1c, 0x20, 0x21, 0x1e, 0x2f,
-    0x2f, 0x2b, 0x2b, 0x2e, 0x54, 0x55, 0x46, 0x46, 0x6f, 0x6f, 0x46, 0x54,
-    0x54, 0x3d, 0x1f, 0x28, 0x47, 0x6c, 0x74, 0x82, 0x93, 0x83, 0x83, 0xa6,
-    0xca, 0xc6, 0xd0, 0xc6, 0xb0, 0xaf, 0xbc, 0x86, 0x86, 0x86, 0x86, 0x55,
-    0x45, 0x7a, 0xa2, 0xbb, 0xa8, 0x93, 0x93, 0x8c, 0x6b, 0x7a, 0x3e, 0x2e,
-    0xa8, 0xa5, 0x7c, 0x7c, 0x88, 0x94, 0x9c, 0x9c, 0x68, 0x5b, 0x70, 0x5c,
-    0x76, 0x5b, 0x70, 0x71, 0x88, 0x7c, 0x88, 0x9c, 0x7c, 0x5b, 0x5b, 0x5b,
-    0x4b, 0x5b, 0x70, 0x94, 0xa5, 0xb5, 0xc9, 0xc9, 0xdc, 0xdc, 0xc9, 0x9c,
-    0x70, 0x57, 0x42, 0x32, 0x37, 0x37, 0x37, 0x23, 0x1d, 0x27, 0x23, 0x23,
-    0x1a, 0x0d, 0x10, 0x1b, 0x1a, 0x28, 0x87, 0xbb, 0xb8, 0xb5, 0xb5, 0xab,
-    0xab, 0x9c, 0x8a, 0x88, 0x9c, 0x9c, 0x93, 0xc9, 0xdc, 0xd7, 0xd7, 0xd7,
-    0xc1, 0xa7, 0xb5, 0xca, 0xe6, 0xf6, 0xea, 0xda, 0xc1, 0xbf, 0xa7, 0x8a,
-    0x94, 0x94, 0x82, 0x8c, 0xa2, 0xa5, 0xb5, 0xc8, 0xc8, 0xc8, 0xa7, 0xc5,
-    0xa9, 0x89, 0x8a, 0x76, 0x71, 0x68, 0x4b, 0x37, 0x14, 0x0a, 0x1c, 0x1e,
-    0x2e, 0x4b, 0x6b, 0x74, 0x84, 0x71, 0x4b, 0x2c, 0x1d, 0x67, 0xa2, 0x93,
-    0x7f, 0x71, 0x57, 0x4b, 0x6c, 0xcc, 0xe9, 0xeb, 0xf7, 0xea, 0xda, 0xda,
-    0xef, 0xd8, 0xda, 0xdc, 0xd5, 0xde, 0xe6, 0xdb, 0xc5, 0xa9, 0xb6, 0xca,
-    0xa7, 0x89, 0x89, 0x8a, 0x8a, 0xb5, 0xdc, 0xf6, 0xf6, 0xea, 0xe8, 0xe6,
-    0xda, 0xd7, 0xdd, 0xd7, 0xd5, 0xd7, 0xe9, 0xf7, 0xf7, 0xea, 0xde, 0xc8,
-    0xb6, 0xc6, 0xce, 0xd5, 0xca, 0x96, 0x97, 0x91, 0xbe, 0xcf, 0xdd, 0xdc,
-    0xc6, 0x97, 0x74, 0x6f, 0xa0, 0x9d, 0x9d, 0x78, 0x46, 0x54, 0x61, 0x75,
-    0x85, 0x85, 0x8c, 0x9f, 0x9f, 0xa0, 0xa0, 0x9d, 0x7d, 0x78, 0x67, 0x48,
-    0x44, 0x61, 0x86, 0x9f, 0x8c, 0x85, 0x8c, 0xaa, 0xbb, 0xaa, 0x97, 0xaa,
-    0xcf, 0xd2, 0xbc, 0xbb, 0xce, 0xe1, 0xd2, 0xce, 0xdd, 0xdd, 0x9f, 0x77,
-    0x6f, 0x6f, 0x7e, 0x5e, 0x61, 0x61, 0x75, 0x6f, 0x6f, 0x7e, 0x80, 0x80,
-    0x7d, 0x6a, 0x4e, 0x13, 0x06, 0x02, 0x02, 0x02, 0x03, 0x08, 0x13, 0x22,
-    0x20, 0x2a, 0x2d, 0x48, 0x56, 0x4c, 0x33, 0x4e, 0x4c, 0x47, 0x55, 0x55,
-    0x40, 0x2b, 0x1e, 0x1e, 0x1c, 0x0d, 0x12, 0x2a, 0x2b, 0x1e, 0x21, 0x36,
-    0x36, 0x29, 0x2e, 0x2c, 0x54, 0x5e, 0x55, 0x54, 0x55, 0x4e, 0x1e, 0x3d,
-    0x54, 0x51, 0x6b, 0x82, 0x82, 0x84, 0x83, 0x96, 0xb3, 0xb3, 0xa6, 0xa6,
-    0x96, 0x94, 0x97, 0xa2, 0xb2, 0x77, 0x6c, 0x45, 0x9a, 0xcc, 0xa8, 0xb6,
-    0xb6, 0xb6, 0xa6, 0x93, 0x82, 0x8c, 0x47, 0x23, 0x88, 0x7c, 0x70, 0x88,
-    0xb8, 0xc9, 0xb5, 0xa5, 0x93, 0x71, 0x5b, 0x57, 0x5b, 0x68, 0x7c, 0xa8,
-    0xc9, 0xb8, 0xa5, 0x88, 0x70, 0x5b, 0x57, 0x57, 0x57, 0x68, 0x71, 0x7c,
-    0x9c, 0xab, 0xb8, 0xca, 0xca, 0xc9, 0xb8, 0x88, 0x5b, 0x57, 0x58, 0x4b,
-    0x2c, 0x23, 0x1d, 0x1d, 0x30, 0x30, 0x30, 0x30, 0x23, 0x1b, 0x14, 0x14,
-    0x14, 0x14, 0x56, 0x9a, 0xa8, 0xa8, 0xa5, 0xab, 0x9c, 0x9c, 0x7c, 0x9c,
-    0xa5, 0xab, 0xa5, 0xb8, 0xdc, 0xd7, 0xd7, 0xd7, 0xc1, 0xa7, 0xab, 0xc9,
-    0xe6, 0xef, 0xe6, 0xd8, 0xc5, 0xa9, 0xa9, 0x89, 0x8a, 0x7c, 0x7f, 0x82,
-    0x82, 0x94, 0xab, 0xc8, 0xd5, 0xca, 0xc5, 0xa9, 0x8d, 0x8a, 0x8a, 0x76,
-    0x7f, 0x71, 0x68, 0x50, 0x23, 0x1d, 0x28, 0x30, 0x51, 0x68, 0x71, 0x7f,
-    0x93, 0x7f, 0x71, 0x4b, 0x23, 0x56, 0x8c, 0x93, 0x7f, 0x70, 0x5b, 0x4b,
-    0x7a, 0xf0, 0xfa, 0xf9, 0xf7, 0xe9, 0xef, 0xda, 0xe6, 0xd8, 0xc8, 0xc8,
-    0xa7, 0xc1, 0xde, 0xdb, 0xc5, 0xa9, 0xad, 0xa6, 0xad, 0x8a, 0xb5, 0xb5,
-    0x9c, 0x94, 0xd7, 0xe6, 0xef, 0xef, 0xea, 0xd8, 0xca, 0xdc, 0xdc, 0xd5,
-    0xd1, 0xe0, 0xe9, 0xe9, 0xea, 0xe6, 0xd8, 0xad, 0xb6, 0xdc, 0xdd, 0xe9,
-    0xd7, 0xa5, 0x96, 0xa2, 0xce, 0xe0, 0xed, 0xdc, 0xc6, 0x96, 0x74, 0x54,
-    0x81, 0x8f, 0x80, 0x78, 0x75, 0x6f, 0x78, 0x77, 0x6f, 0x61, 0x91, 0xb2,
-    0xb4, 0xb4, 0xb4, 0xb4, 0x9d, 0x9b, 0x7d, 0x67, 0x56, 0x61, 0x75, 0x86,
-    0x9f, 0x86, 0x8c, 0xa8, 0xc6, 0xcf, 0xcf, 0xaa, 0x96, 0x97, 0xaf, 0xbb,
-    0xbe, 0xbc, 0xaf, 0xc6, 0xd5, 0xce, 0x9f, 0x78, 0x5e, 0x54, 0x54, 0x54,
-    0x4d, 0x6b, 0x74, 0x61, 0x77, 0x81, 0x81, 0x81, 0x7d, 0x7e, 0x81, 0x35,
-    0x06, 0x02, 0x02, 0x00, 0x03, 0x0a, 0x1c, 0x20, 0x20, 0x31, 0x3d, 0x45,
-    0x64, 0x48, 0x47, 0x4e, 0x40, 0x47, 0x47, 0x48, 0x2d, 0x2d, 0x1e, 0x19,
-    0x1c, 0x0a, 0x0a, 0x1e, 0x1f, 0x1f, 0x28, 0x36, 0x29, 0x29, 0x2e, 0x3a,
-    0x46, 0x55, 0x47, 0x3e, 0x3e, 0x56, 0x2a, 0x1e, 0x51, 0x51, 0x51, 0x85,
-    0x72, 0x84, 0x74, 0x73, 0x83, 0x83, 0x83, 0x73, 0x74, 0x91, 0x85, 0x84,
-    0xa2, 0x77, 0x30, 0x53, 0x7a, 0xbb, 0xb8, 0xca, 0xca, 0xca, 0xca, 0xca,
-    0xa2, 0xa2, 0x60, 0x53, 0x82, 0x7c, 0x68, 0xaa, 0xcf, 0xcf, 0xc9, 0xab,
-    0x93, 0x94, 0x70, 0x4b, 0x7c, 0x94, 0xa5, 0xc9, 0xcc, 0xcc, 0xc9, 0x7c,
-    0x57, 0x68, 0x42, 0x42, 0x42, 0x57, 0x71, 0x7c, 0x76, 0x88, 0xa5, 0xab,
-    0x9c, 0xab, 0x9c, 0x70, 0x5b, 0x68, 0x58, 0x4b, 0x23, 0x14, 0x1b, 0x2d,
-    0x51, 0x5a, 0x6c, 0x6c, 0x5a, 0x45, 0x30, 0x23, 0x1a, 0x0a, 0x20, 0x7d,
-    0x8c, 0x82, 0x7c, 0x7c, 0x94, 0x93, 0x88, 0x9c, 0xab, 0x9c, 0x88, 0xa8,
-    0xcc, 0xd7, 0xd7, 0xc1, 0xa7, 0xb5, 0xd7, 0xe6, 0xda, 0xda, 0xd8, 0xd8,
-    0xbf, 0xa9, 0xa7, 0xa7, 0x8a, 0x88, 0x9c, 0x88, 0x82, 0x9c, 0xb6, 0xca,
-    0xc9, 0xc8, 0xbf, 0x89, 0x8a, 0x8a, 0x8a, 0x76, 0x76, 0x71, 0x57, 0x4b,
-    0x44, 0x3e, 0x46, 0x50, 0x57, 0x66, 0x71, 0x7f, 0x7f, 0x7f, 0x71, 0x4b,
-    0x2c, 0x37, 0x72, 0x93, 0x88, 0x76, 0x5b, 0x72, 0xe1, 0xfa, 0xfa, 0xf7,
-    0xef, 0xe6, 0xe8, 0xe9, 0xd7, 0xc0, 0xa4, 0xa9, 0xa4, 0x89, 0xca, 0xd5,
-    0xc8, 0xc5, 0xad, 0x8e, 0xad, 0xa6, 0xb5, 0xb5, 0x9c, 0xa6, 0xd7, 0xd8,
-    0xd8, 0xdb, 0xde, 0xc5, 0xc8, 0xd5, 0xc9, 0xce, 0xe1, 0xeb, 0xe9, 0xe6,
-    0xe6, 0xd8, 0xc8, 0xb6, 0xc6, 0xdd, 0xeb, 0xeb, 0xdc, 0xb5, 0x94, 0xa2,
-    0xbe, 0xdd, 0xdd, 0xdc, 0xca, 0x96, 0x75, 0x55, 0x4c, 0x81, 0x81, 0x7e,
-    0x8c, 0x9f, 0xa0, 0x78, 0x64, 0x6f, 0x7e, 0xa0, 0xb4, 0xba, 0xd3, 0xb4,
-    0xb2, 0xb2, 0x9d, 0x67, 0x69, 0x6f, 0x75, 0x9a, 0xb4, 0xa0, 0xb1, 0xbb,
-    0xce, 0xdd, 0xdd, 0xce, 0x8c, 0x83, 0x7f, 0x8e, 0xaf, 0xac, 0xac, 0xbb,
-    0xbb, 0xac, 0x77, 0x5e, 0x46, 0x3a, 0x36, 0x46, 0x6c, 0x75, 0x61, 0x61,
-    0x61, 0x75, 0x77, 0x78, 0x7e, 0x91, 0x87, 0x6a, 0x15, 0x03, 0x02, 0x02,
-    0x05, 0x13, 0x2a, 0x2a, 0x33, 0x49, 0x48, 0x56, 0x67, 0x64, 0x47, 0x64,
-    0x6a, 0x48, 0x47, 0x3e, 0x28, 0x28, 0x1b, 0x1b, 0x15, 0x13, 0x13, 0x10,
-    0x1e, 0x2b, 0x2e, 0x36, 0x36, 0x29, 0x3e, 0x3e, 0x4a, 0x4a, 0x2e, 0x3e,
-    0x3a, 0x2e, 0x1c, 0x0a, 0x1e, 0x47, 0x51, 0x6c, 0x6b, 0x72, 0x74, 0x58,
-    0x63, 0x63, 0x58, 0x63, 0x74, 0x7b, 0x75, 0x6b, 0x68, 0x46, 0x28, 0x64,
-    0x7a, 0xa8, 0xb8, 0xc6, 0xd9, 0xdf, 0xe0, 0xc6, 0xaf, 0xaa, 0x9a, 0x7d,
-    0x58, 0x68, 0x68, 0xa2, 0xbb, 0xbb, 0xa6, 0x8a, 0x88, 0x7c, 0x70, 0x4b,
-    0x88, 0xa5, 0xb8, 0xc9, 0xdd, 0xdc, 0xc9, 0x9c, 0x68, 0x4b, 0x2c, 0x2c,
-    0x32, 0x32, 0x71, 0x7c, 0x76, 0x7c, 0x7c, 0x7c, 0x76, 0x76, 0x76, 0x5b,
-    0x4b, 0x4b, 0x4b, 0x37, 0x30, 0x28, 0x30, 0x5a, 0x71, 0x82, 0x93, 0x93,
-    0x93, 0x93, 0x7a, 0x44, 0x1d, 0x0d, 0x0a, 0x49, 0x75, 0x72, 0x82, 0x93,
-    0x93, 0xa5, 0x88, 0x88, 0x88, 0x8a, 0x88, 0xa8, 0xc9, 0xd7, 0xc9, 0xc1,
-    0xa7, 0xc2, 0xd7, 0xd8, 0xd8, 0xd8, 0xd8, 0xd6, 0xc1, 0xd8, 0xef, 0xea,
-    0xda, 0xc1, 0xb6, 0xab, 0x7c, 0x94, 0xa6, 0xab, 0xab, 0xa7, 0xa9, 0xb6,
-    0xb6, 0x8a, 0x76, 0x76, 0x71, 0x66, 0x57, 0x50, 0x51, 0x46, 0x50, 0x58,
-    0x58, 0x71, 0x71, 0x7f, 0x7f, 0x71, 0x5b, 0x4b, 0x2c, 0x44, 0x8c, 0xa8,
-    0x9c, 0x76, 0x5b, 0xc9, 0xf7, 0xf6, 0xf5, 0xf5, 0xea, 0xe9, 0xe6, 0xc5,
-    0xc1, 0xc1, 0xc2, 0xc1, 0xa4, 0x76, 0xb5, 0xd7, 0xca, 0xc8, 0xb6, 0xab,
-    0xab, 0xa7, 0x8a, 0x9c, 0xa6, 0xc6, 0xd7, 0xd8, 0xd6, 0xd6, 0xc5, 0xc5,
-    0xa7, 0xa7, 0xa7, 0xc6, 0xee, 0xeb, 0xe9, 0xef, 0xd7, 0xc8, 0xb6, 0xa6,
-    0xaa, 0xcf, 0xdd, 0xdd, 0xd9, 0xa6, 0x7f, 0x84, 0xa3, 0xbe, 0xce, 0xc6,
-    0x97, 0x84, 0x61, 0x47, 0x55, 0x78, 0x87, 0x9f, 0xae, 0xae, 0xa0, 0x87,
-    0x78, 0x6a, 0x69, 0x78, 0x7e, 0xae, 0xb7, 0xb2, 0xa0, 0xb2, 0xa0, 0x7d,
-    0x7d, 0x78, 0x86, 0xb2, 0xb4, 0xb2, 0xaa, 0xaf, 0xce, 0xdd, 0xd5, 0xd9,
-    0xb2, 0xb2, 0xb7, 0xa3, 0xa3, 0xac, 0xae, 0xa3, 0xaa, 0x86, 0x55, 0x5e,
-    0x3e, 0x36, 0x36, 0x4a, 0x75, 0x6f, 0x54, 0x61, 0x61, 0x6f, 0x7e, 0xa0,
-    0x86, 0x86, 0x91, 0x81, 0x22, 0x06, 0x05, 0x06, 0x0b, 0x1c, 0x22, 0x4f,
-    0x4f, 0x49, 0x49, 0x6a, 0x67, 0x60, 0x60, 0x6f, 0x5e, 0x5e, 0x51, 0x46,
-    0x2d, 0x2b, 0x1f, 0x21, 0x12, 0x13, 0x0b, 0x0b, 0x25, 0x1f, 0x1f, 0x2f,
-    0x2b, 0x1f, 0x24, 0x24, 0x40, 0x40, 0x28, 0x2e, 0x3e, 0x2e, 0x1c, 0x05,
-    0x03, 0x13, 0x2d, 0x51, 0x4b, 0x5a, 0x75, 0x58, 0x6b, 0x4d, 0x50, 0x58,
-    0x6c, 0x51, 0x43, 0x50, 0x2c, 0x45, 0x31, 0x2d, 0x8c, 0xa5, 0xa6, 0xca,
-    0xd9, 0xe0, 0xe0, 0xce, 0xaf, 0x93, 0x72, 0x45, 0x2c, 0x42, 0x58, 0x7f,
-    0x94, 0x88, 0x7c, 0x70, 0x5b, 0x7c, 0x70, 0x82, 0x7c, 0xa5, 0xb5, 0xca,
-    0xdc, 0xd5, 0xb5, 0x9c, 0x71, 0x2c, 0x2c, 0x44, 0x42, 0x32, 0x68, 0x7c,
-    0x7c, 0x7c, 0x70, 0x70, 0x5b, 0x5b, 0x5b, 0x4b, 0x42, 0x37, 0x2c, 0x30,
-    0x45, 0x60, 0x6c, 0x7f, 0x88, 0x93, 0xa8, 0xbb, 0xb8, 0xb8, 0xa8, 0x72,
-    0x45, 0x14, 0x10, 0x31, 0x60, 0x6c, 0x7a, 0x8c, 0x82, 0x93, 0x88, 0xb5,
-    0xc9, 0xc9, 0xc9, 0xd7, 0xd7, 0xd7, 0xd7, 0xc8, 0xc1, 0xab, 0xc9, 0xda,
-    0xda, 0xd8, 0xc1, 0xc1, 0xe6, 0xf6, 0xfa, 0xf9, 0xe6, 0xd8, 0xc1, 0xab,
-    0x7c, 0x5c, 0x76, 0x76, 0x8a, 0x8a, 0x9c, 0xab, 0xb6, 0x8a, 0x76, 0x7c,
-    0x7f, 0x68, 0x68, 0x50, 0x51, 0x37, 0x43, 0x57, 0x68, 0x71, 0x71, 0x71,
-    0x71, 0x66, 0x66, 0x4b, 0x37, 0x6c, 0xcc, 0xc9, 0xab, 0x8a, 0x76, 0xd7,
-    0xf9, 0xfd, 0xf6, 0xf5, 0xea, 0xe6, 0xd8, 0xbf, 0xa4, 0xa4, 0xda, 0xd7,
-    0xc1, 0xab, 0x9c, 0xab, 0xc2, 0xc8, 0xca, 0xc9, 0xca, 0xb6, 0xa7, 0x89,
-    0xbb, 0xdd, 0xe6, 0xd8, 0xd6, 0xd6, 0xc5, 0xbf, 0xa9, 0xa7, 0xa6, 0xd5,
-    0xf7, 0xfa, 0xf7, 0xe9, 0xd7, 0xca, 0xa6, 0x94, 0x8c, 0xbe, 0xce, 0xbc,
-    0xaf, 0x94, 0x73, 0x58, 0x61, 0xac, 0xac, 0xa3, 0x84, 0x63, 0x46, 0x4a,
-    0x64, 0x78, 0x91, 0xa3, 0xbe, 0xbe, 0xae, 0x9f, 0x78, 0x69, 0x5e, 0x5e,
-    0x75, 0x91, 0x9f, 0x9f, 0x87, 0x9f, 0x9f, 0xa0, 0x9d, 0x87, 0x9a, 0xb2,
-    0xd2, 0xb1, 0x93, 0xa6, 0xc6, 0xdc, 0xd9, 0xdc, 0xce, 0xa2, 0x9f, 0x9f,
-    0x85, 0x85, 0x9f, 0x86, 0x87, 0x56, 0x40, 0x4c, 0x4c, 0x4c, 0x4a, 0x6f,
-    0x6f, 0x61, 0x58, 0x61, 0x61, 0x6d, 0x69, 0x7e, 0x86, 0x86, 0x91, 0x9f,
-    0x35, 0x0b, 0x05, 0x06, 0x13, 0x1c, 0x34, 0x4e, 0x49, 0x67, 0x80, 0x80,
-    0x6a, 0x60, 0x75, 0x74, 0x5a, 0x5a, 0x5a, 0x54, 0x3e, 0x2d, 0x27, 0x2b,
-    0x1c, 0x0a, 0x05, 0x05, 0x06, 0x1c, 0x19, 0x1f, 0x1f, 0x1f, 0x19, 0x19,
-    0x24, 0x2b, 0x3e, 0x56, 0x4c, 0x4e, 0x20, 0x13, 0x13, 0x07, 0x10, 0x48,
-    0x5a, 0x5a, 0x5a, 0x58, 0x50, 0x4d, 0x4d, 0x75, 0x61, 0x50, 0x6b, 0x86,
-    0x53, 0x60, 0x53, 0x64, 0x7a, 0x93, 0x93, 0xaf, 0xbc, 0xbc, 0xb0, 0xaf,
-    0x96, 0x84, 0x85, 0x56, 0x23, 0x37, 0x4b, 0x57, 0x66, 0x66, 0x5b, 0x57,
-    0x4b, 0x68, 0x71, 0x71, 0x71, 0x7c, 0x9c, 0xab, 0xb6, 0xab, 0x8a, 0x76,
-    0x4b, 0x23, 0x37, 0x4b, 0x4b, 0x4b, 0x57, 0x5b, 0x71, 0x7f, 0x5b, 0x5b,
-    0x5b, 0x4b, 0x42, 0x42, 0x2c, 0x1d, 0x23, 0x2c, 0x5a, 0x7a, 0x82, 0x7c,
-    0x93, 0xa5, 0xa8, 0xb8, 0xbb, 0xc9, 0xa8, 0x7c, 0x4b, 0x1d, 0x1b, 0x2d,
-    0x53, 0x5a, 0x7a, 0x82, 0x82, 0xa8, 0xdd, 0xf7, 0xf6, 0xef, 0xe6, 0xda,
-    0xd7, 0xe9, 0xe9, 0xe6, 0xda, 0xc2, 0xda, 0xd8, 0xd8, 0xd8, 0xc8, 0xda,
-    0xea, 0xf6, 0xf6, 0xef, 0xd8, 0xc5, 0xa9, 0xa7, 0x7c, 0x5b, 0x5b, 0x4b,
-    0x7c, 0xab, 0x9c, 0x8a, 0x8a, 0x76, 0x76, 0x76, 0x71, 0x66, 0x57, 0x57,
-    0x37, 0x37, 0x42, 0x57, 0x57, 0x66, 0x66, 0x66, 0x5b, 0x5b, 0x4b, 0x32,
-    0x37, 0x86, 0xc6, 0xb8, 0xab, 0xa7, 0x8a, 0xe8, 0xfc, 0xfc, 0xf7, 0xf5,
-    0xe6, 0xd8, 0xd8, 0xc8, 0xa7, 0xa7, 0xca, 0xd7, 0xd8, 0xa9, 0x79, 0x5c,
-    0x9c, 0xca, 0xc8, 0xc8, 0xc9, 0xca, 0xa7, 0xa6, 0xf0, 0xfa, 0xf6, 0xe6,
-    0xd8, 0xbf, 0xbf, 0xad, 0xb6, 0xca, 0xd5, 0xeb, 0xfa, 0xfa, 0xf7, 0xe8,
-    0xd7, 0xca, 0xab, 0x7f, 0x8c, 0xd3, 0xd1, 0xbb, 0x96, 0x7f, 0x71, 0x4d,
-    0x6f, 0xa0, 0xb7, 0x91, 0x6b, 0x63, 0x46, 0x47, 0x5e, 0x77, 0x91, 0xa3,
-    0xbe, 0xbe, 0x9f, 0x87, 0x69, 0x4c, 0x4a, 0x55, 0x6f, 0x77, 0x87, 0x7e,
-    0x81, 0x78, 0x87, 0x9f, 0x7d, 0x9f, 0xb2, 0xb2, 0xcf, 0xcc, 0xbb, 0xce,
-    0xce, 0xd9, 0xd9, 0xdd, 0xdd, 0x85, 0x50, 0x58, 0x74, 0x85, 0x86, 0x87,
-    0x69, 0x4e, 0x40, 0x52, 0x6d, 0x6d, 0x4c, 0x47, 0x5e, 0x75, 0x61, 0x61,
-    0x54, 0x5e, 0x6d, 0x7e, 0x86, 0x77, 0x86, 0x7e, 0x22, 0x06, 0x05, 0x15,
-    0x22, 0x20, 0x2a, 0x31, 0x67, 0x7d, 0x80, 0x80, 0x80, 0x7d, 0x78, 0x78,
-    0x6f, 0x64, 0x69, 0x55, 0x47, 0x47, 0x47, 0x28, 0x1e, 0x1c, 0x0b, 0x0b,
-    0x06, 0x0b, 0x12, 0x1e, 0x1e, 0x21, 0x19, 0x19, 0x2f, 0x55, 0x5e, 0x6f,
-    0x77, 0x56, 0x48, 0x64, 0x64, 0x49, 0x48, 0x53, 0x5a, 0x5a, 0x5a, 0x6c,
-    0x61, 0x50, 0x43, 0x54, 0x61, 0x58, 0x85, 0x91, 0x61, 0x6f, 0x60, 0x87,
-    0x7a, 0x72, 0x93, 0x96, 0xa6, 0xa6, 0x96, 0x96, 0x83, 0x74, 0x5a, 0x5e,
-    0x23, 0x23, 0x44, 0x42, 0x4b, 0x57, 0x4b, 0x72, 0x72, 0x57, 0x71, 0x68,
-    0x68, 0x70, 0x7c, 0x8a, 0x8a, 0x76, 0x76, 0x76, 0x4b, 0x37, 0x5a, 0x5a,
-    0x4b, 0x4b, 0x68, 0x57, 0x57, 0x68, 0x5b, 0x4b, 0x57, 0x4b, 0x42, 0x32,
-    0x23, 0x1d, 0x23, 0x37, 0x58, 0x72, 0x82, 0x88, 0x88, 0xa5, 0xa8, 0xb8,
-    0xbb, 0xb8, 0xa5, 0x7c, 0x57, 0x23, 0x1d, 0x2d, 0x60, 0xb1, 0xb8, 0xa8,
-    0xa8, 0xcf, 0xf7, 0xf9, 0xe9, 0xe6, 0xda, 0xda, 0xf7, 0xfe, 0xf6, 0xe6,
-    0xd8, 0xd8, 0xc8, 0xc8, 0xc1, 0xc1, 0xca, 0xd7, 0xe8, 0xef, 0xda, 0xd8,
-    0xc5, 0xbf, 0xa9, 0xa7, 0x7c, 0x70, 0x68, 0x68, 0x7c, 0x94, 0xa6, 0x8a,
-    0x70, 0x88, 0x7c, 0x5b, 0x4b, 0x42, 0x42, 0x32, 0x2c, 0x51, 0x58, 0x68,
-    0x66, 0x66, 0x66, 0x66, 0x5b, 0x4b, 0x32, 0x2c, 0x2c, 0x8c, 0xa5, 0xb5,
-    0xab, 0xa7, 0x89, 0xc9, 0xfa, 0xfe, 0xf7, 0xef, 0xde, 0xd8, 0xbf, 0xb6,
-    0xc1, 0x9c, 0xab, 0xa7, 0x79, 0x89, 0x88, 0x88, 0x70, 0x5b, 0x94, 0xd7,
-    0xd7, 0xca, 0xa7, 0xca, 0xfa, 0xfc, 0xf9, 0xe8, 0xd8, 0xc8, 0xc8, 0xb6,
-    0xb6, 0xa6, 0xa6, 0xdc, 0xf7, 0xf7, 0xf5, 0xef, 0xda, 0xc8, 0xa6, 0x94,
-    0xaa, 0xd2, 0xe1, 0xd5, 0xa6, 0x94, 0x82, 0x6b, 0x7e, 0xa1, 0xb4, 0x91,
-    0x85, 0x75, 0x61, 0x54, 0x54, 0x6f, 0x86, 0xa3, 0xae, 0xae, 0x9f, 0x6f,
-    0x47, 0x47, 0x47, 0x55, 0x55, 0x64, 0x78, 0x7e, 0x6a, 0x67, 0x64, 0x87,
-    0x86, 0xa2, 0xb1, 0xce, 0xd5, 0xcc, 0xbc, 0xce, 0xbc, 0xd5, 0xd9, 0xe0,
-    0xe1, 0xae, 0x51, 0x51, 0x74, 0x77, 0x91, 0x81, 0x6a, 0x4c, 0x40, 0x2b,
-    0x2f, 0x40, 0x4c, 0x69, 0x55, 0x7e, 0x81, 0x69, 0x69, 0x6f, 0x6a, 0x69,
-    0x77, 0x6f, 0x5e, 0x35, 0x06, 0x02, 0x03, 0x0b, 0x1c, 0x20, 0x31, 0x56,
-    0x7d, 0x7d, 0x7d, 0x9d, 0xa1, 0x80, 0x81, 0x81, 0x6a, 0x6d, 0x69, 0x5e,
-    0x47, 0x47, 0x3e, 0x29, 0x1f, 0x2a, 0x20, 0x1c, 0x13, 0x0b, 0x13, 0x19,
-    0x1c, 0x12, 0x1c, 0x28, 0x47, 0x5e, 0x6c, 0x75, 0x86, 0x77, 0x60, 0x7a,
-    0x78, 0x78, 0x53, 0x47, 0x44, 0x51, 0x51, 0x60, 0x6f, 0x54, 0x37, 0x37,
-    0x37, 0x44, 0x61, 0x6f, 0x30, 0x3e, 0x3d, 0x64, 0x58, 0x58, 0x72, 0x84,
-    0x73, 0x73, 0x73, 0x74, 0x61, 0x63, 0x54, 0x27, 0x30, 0x51, 0x44, 0x6c,
-    0x68, 0x68, 0x68, 0x8c, 0xc9, 0x93, 0x93, 0xa2, 0x6b, 0x7c, 0x7f, 0x7c,
-    0x70, 0x5b, 0x5b, 0x5b, 0x5b, 0x6b, 0x75, 0x7a, 0x72, 0x6b, 0x58, 0x4b,
-    0x42, 0x57, 0x57, 0x42, 0x42, 0x42, 0x42, 0x32, 0x2c, 0x2c, 0x2c, 0x37,
-    0x4b, 0x68, 0x82, 0x88, 0x88, 0x93, 0xa8, 0xa8, 0xab, 0x9c, 0x94, 0x70,
-    0x4b, 0x30, 0x2d, 0x7d, 0xb1, 0xdd, 0xdc, 0xd7, 0xdc, 0xdd, 0xf6, 0xef,
-    0xe8, 0xda, 0xda, 0xe9, 0xfd, 0xf7, 0xef, 0xd8, 0xd6, 0xc1, 0xc8, 0xc2,
-    0xc8, 0xca, 0xca, 0xd8, 0xda, 0xda, 0xd8, 0xd8, 0xc5, 0xa9, 0xa9, 0x8a,
-    0x9c, 0x7c, 0x71, 0x93, 0x9c, 0x9c, 0xa5, 0xab, 0xab, 0xca, 0xca, 0x88,
-    0x68, 0x58, 0x58, 0x51, 0x37, 0x50, 0x58, 0x57, 0x66, 0x57, 0x57, 0x68,
-    0x68, 0x4b, 0x4b, 0x72, 0x82, 0x94, 0xab, 0xab, 0xc8, 0xc1, 0xa7, 0xd7,
-    0xed, 0xf6, 0xea, 0xe6, 0xe7, 0xdb, 0xbf, 0x8d, 0x79, 0xab, 0xab, 0x79,
-    0x5b, 0x9c, 0xb8, 0xb5, 0x7c, 0x70, 0xa5, 0xdc, 0xd7, 0xc8, 0xb6, 0xea,
-    0xfa, 0xfa, 0xf7, 0xe8, 0xd7, 0xd5, 0xca, 0xb6, 0xa6, 0xa6, 0x94, 0xbb,
-    0xe9, 0xe9, 0xef, 0xe6, 0xd8, 0xb6, 0xa6, 0x7f, 0xa3, 0xe1, 0xe1, 0xdc,
-    0xd5, 0xb5, 0xaa, 0x84, 0x7b, 0x81, 0xa0, 0x9f, 0xaa, 0xa2, 0x85, 0x63,
-    0x54, 0x55, 0x77, 0x78, 0x7b, 0x78, 0x7e, 0x64, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x56, 0x56, 0x78, 0x7d, 0x80, 0x7d, 0x67, 0x78, 0x8c, 0xa2, 0xbb, 0xbc,
-    0xdc, 0xdd, 0xac, 0xac, 0xa6, 0xca, 0xd9, 0xe0, 0xe1, 0xb2, 0x77, 0x60,
-    0x77, 0x9a, 0x9f, 0x78, 0x69, 0x55, 0x4c, 0x33, 0x2e, 0x3e, 0x47, 0x5e,
-    0x3e, 0x36, 0x4a, 0x47, 0x6f, 0x81, 0x6a, 0x53, 0x5e, 0x69, 0x35, 0x06,
-    0x02, 0x02, 0x03, 0x0b, 0x13, 0x20, 0x3d, 0x64, 0x60, 0x75, 0x85, 0x9f,
-    0xa0, 0x87, 0x7e, 0x78, 0x6f, 0x61, 0x54, 0x6f, 0x55, 0x47, 0x36, 0x36,
-    0x2f, 0x3d, 0x3d, 0x2a, 0x1c, 0x13, 0x13, 0x15, 0x0b, 0x05, 0x20, 0x3d,
-    0x53, 0x60, 0x75, 0x8c, 0x9a, 0x9a, 0x87, 0x86, 0x86, 0x77, 0x5a, 0x48,
-    0x1d, 0x45, 0x37, 0x44, 0x55, 0x3a, 0x46, 0x55, 0x44, 0x30, 0x27, 0x28,
-    0x49, 0x67, 0x67, 0x28, 0x10, 0x14, 0x45, 0x75, 0x74, 0x58, 0x50, 0x58,
-    0x61, 0x3e, 0x47, 0x1d, 0x5a, 0x51, 0x42, 0x8c, 0x93, 0x93, 0xa5, 0xb5,
-    0xa5, 0xa5, 0x93, 0x93, 0x68, 0x57, 0x57, 0x57, 0x57, 0x4b, 0x4b, 0x4b,
-    0x68, 0x7f, 0x88, 0x88, 0x7f, 0x57, 0x2c, 0x2c, 0x42, 0x58, 0x57, 0x42,
-    0x32, 0x32, 0x32, 0x2c, 0x2c, 0x44, 0x44, 0x44, 0x4b, 0x68, 0x71, 0x88,
-    0x88, 0x93, 0x93, 0x93, 0x88, 0x7c, 0x70, 0x5b, 0x4b, 0x45, 0x9b, 0xdd,
-    0xe9, 0xe8, 0xe6, 0xda, 0xda, 0xdc, 0xe8, 0xef, 0xef, 0xd8, 0xd8, 0xf5,
-    0xf5, 0xef, 0xe6, 0xd8, 0xd8, 0xda, 0xe6, 0xe8, 0xd7, 0xda, 0xc1, 0xc8,
-    0xc1, 0xd8, 0xd8, 0xc8, 0xbf, 0xa9, 0xab, 0xab, 0xab, 0x88, 0x71, 0x94,
-    0xab, 0xa6, 0xca, 0xca, 0xda, 0xe6, 0xd7, 0xb5, 0x94, 0x71, 0x74, 0x58,
-    0x43, 0x2c, 0x43, 0x42, 0x57, 0x68, 0x68, 0x68, 0x57, 0x4b, 0x72, 0xa8,
-    0xa8, 0xa6, 0xab, 0xc9, 0xd7, 0xd7, 0xb5, 0xc8, 0xe6, 0xea, 0xd8, 0xda,
-    0xd7, 0xc8, 0xa7, 0x8d, 0x79, 0xab, 0xab, 0x89, 0x88, 0xd5, 0xb8, 0x9c,
-    0x70, 0xa2, 0xcf, 0xe9, 0xd7, 0xc8, 0xca, 0xf7, 0xf9, 0xf7, 0xf6, 0xe8,
-    0xe8, 0xd7, 0xc9, 0xca, 0xa5, 0xab, 0xa6, 0xc9, 0xd7, 0xe7, 0xde, 0xdb,
-    0xc5, 0xad, 0x94, 0x7c, 0x84, 0xe3, 0xf0, 0xeb, 0xd7, 0xd5, 0xbb, 0x8c,
-    0x85, 0x77, 0x7e, 0xb2, 0xbe, 0xbb, 0xaa, 0x75, 0x5e, 0x4c, 0x69, 0x4c,
-    0x4a, 0x5e, 0x78, 0x7e, 0x7e, 0x87, 0x78, 0x64, 0x64, 0x78, 0xa0, 0xb4,
-    0x9d, 0x80, 0x64, 0x77, 0x9a, 0x8c, 0xaa, 0xbc, 0xce, 0xcf, 0xa3, 0x84,
-    0xaa, 0xbb, 0xc6, 0xd9, 0xce, 0x91, 0x6f, 0x6f, 0x9f, 0xb2, 0xb2, 0xb4,
-    0x80, 0x48, 0x69, 0x6a, 0x47, 0x55, 0x69, 0x4c, 0x36, 0x2e, 0x2e, 0x2e,
-    0x47, 0x4c, 0x6d, 0x69, 0x4c, 0x35, 0x18, 0x03, 0x02, 0x00, 0x02, 0x05,
-    0x1c, 0x2a, 0x3d, 0x5a, 0x75, 0x8c, 0x91, 0x8c, 0x8c, 0x91, 0x91, 0x7b,
-    0x6d, 0x5e, 0x58, 0x61, 0x5e, 0x4a, 0x36, 0x28, 0x3d, 0x47, 0x48, 0x2f,
-    0x1e, 0x1c, 0x13, 0x0b, 0x06, 0x26, 0x6a, 0x67, 0x7d, 0x7d, 0x9a, 0xa2,
-    0xa2, 0x91, 0x9d, 0x86, 0x85, 0x6c, 0x51, 0x53, 0x28, 0x48, 0x55, 0x47,
-    0x3e, 0x3e, 0x53, 0x77, 0x54, 0x2e, 0x2d, 0x9b, 0x9d, 0x9d, 0x78, 0x64,
-    0x20, 0x0a, 0x28, 0x5a, 0x43, 0x44, 0x3a, 0x37, 0x51, 0x2e, 0x2e, 0x3d,
-    0x82, 0x5a, 0x60, 0x82, 0xb8, 0xb8, 0xca, 0xc8, 0xab, 0xb5, 0xa5, 0x71,
-    0x68, 0x57, 0x42, 0x32, 0x42, 0x42, 0x4b, 0x71, 0x93, 0x93, 0x9c, 0x88,
-    0x7c, 0x4b, 0x1a, 0x23, 0x42, 0x50, 0x4b, 0x42, 0x42, 0x32, 0x42, 0x32,
-    0x37, 0x44, 0x42, 0x58, 0x6b, 0x68, 0x68, 0x68, 0x71, 0x71, 0x7f, 0x7c,
-    0x70, 0x5b, 0x5b, 0x4b, 0x32, 0x64, 0xe4, 0xe9, 0xe6, 0xe6, 0xd7, 0xc2,
-    0xc9, 0xe6, 0xe6, 0xda, 0xe6, 0xda, 0xe6, 0xe8, 0xef, 0xd8, 0xe6, 0xd8,
-    0xe6, 0xf9, 0xfe, 0xf7, 0xe6, 0xd8, 0xc1, 0xab, 0xc2, 0xc1, 0xc1, 0xda,
-    0xc1, 0xc2, 0xe9, 0xe9, 0xe8, 0xd7, 0xa6, 0x94, 0xa5, 0xca, 0xca, 0xd7,
-    0xe6, 0xe9, 0xea, 0xda, 0x9c, 0x7f, 0x72, 0x58, 0x2c, 0x27, 0x44, 0x50,
-    0x4b, 0x68, 0x68, 0x4b, 0x32, 0x4b, 0xaa, 0xb5, 0xb5, 0xab, 0xab, 0xc8,
-    0xca, 0xc8, 0xc1, 0x89, 0xb8, 0xd7, 0xda, 0xd7, 0xc8, 0xa9, 0x89, 0x79,
-    0x9c, 0xc9, 0xb5, 0x88, 0x9c, 0x88, 0x70, 0x5b, 0x70, 0xd7, 0xe8, 0xe8,
-    0xe9, 0xe6, 0xda, 0xf6, 0xf7, 0xf6, 0xf5, 0xe8, 0xc8, 0xb6, 0xca, 0xa5,
-    0xa6, 0xa5, 0xa5, 0xa5, 0xc6, 0xd7, 0xde, 0xdb, 0xc5, 0xad, 0x8e, 0x7f,
-    0x91, 0xe4, 0xf0, 0xeb, 0xe9, 0xdc, 0xbc, 0x97, 0x85, 0x61, 0x78, 0x9f,
-    0xbe, 0xbe, 0xac, 0x86, 0x5e, 0x40, 0x2f, 0x2f, 0x2f, 0x4c, 0x69, 0x7e,
-    0xa0, 0xa0, 0x81, 0x64, 0x77, 0x86, 0xa0, 0xb4, 0x9d, 0x7d, 0x64, 0x77,
-    0x86, 0x85, 0x97, 0xaa, 0xc6, 0xae, 0x85, 0x84, 0xa2, 0xa2, 0x97, 0xbc,
-    0xac, 0x77, 0x6c, 0x85, 0x9b, 0xb2, 0xb1, 0xd2, 0xd4, 0x7d, 0x55, 0x69,
-    0x3e, 0x3e, 0x6d, 0x4e, 0x4c, 0x4c, 0x4c, 0x48, 0x3d, 0x4e, 0x52, 0x33,
-    0x35, 0x15, 0x04, 0x02, 0x02, 0x02, 0x02, 0x05, 0x1c, 0x2a, 0x3d, 0x5a,
-    0x85, 0xae, 0xae, 0xa3, 0x8c, 0xa3, 0x84, 0x74, 0x7e, 0x69, 0x5e, 0x61,
-    0x61, 0x4a, 0x36, 0x2d, 0x2d, 0x3e, 0x40, 0x2b, 0x1b, 0x1b, 0x1c, 0x12,
-    0x12, 0x4c, 0x77, 0x91, 0x9f, 0x9f, 0xae, 0xaa, 0xa2, 0x8c, 0x91, 0x97,
-    0x75, 0x75, 0x77, 0x64, 0x28, 0x3d, 0x48, 0x3e, 0x47, 0x3e, 0x2d, 0x64,
-    0x47, 0x30, 0x51, 0xb4, 0xb9, 0x75, 0x8c, 0xb4, 0x67, 0x2a, 0x48, 0x77,
-    0x61, 0x27, 0x1d, 0x30, 0x55, 0x2b, 0x1a, 0x1e, 0x82, 0x6c, 0x9a, 0xa8,
-    0xa8, 0xb8, 0xc9, 0xd5, 0xc9, 0xab, 0xa5, 0x7f, 0x68, 0x6b, 0x2c, 0x23,
-    0x58, 0x82, 0x82, 0x88, 0xab, 0xb5, 0xb5, 0xa5, 0x93, 0x7a, 0x45, 0x37,
-    0x2c, 0x32, 0x57, 0x4b, 0x4b, 0x4b, 0x57, 0x57, 0x58, 0x4b, 0x42, 0x58,
-    0x72, 0x68, 0x57, 0x57, 0x68, 0x68, 0x68, 0x57, 0x57, 0x5b, 0x4b, 0x32,
-    0x2c, 0x67, 0xe3, 0xe8, 0xe6, 0xe6, 0xd7, 0xd7, 0xd7, 0xda, 0xda, 0xef,
-    0xda, 0xd8, 0xe6, 0xe6, 0xe6, 0xda, 0xd8, 0xe6, 0xf6, 0xfd, 0xf6, 0xef,
-    0xd8, 0xd8, 0xc5, 0xab, 0xb8, 0xc9, 0xb5, 0xd7, 0xdc, 0xf7, 0xeb, 0xf6,
-    0xf7, 0xf7, 0xd7, 0xb6, 0xa6, 0xca, 0xca, 0xde, 0xde, 0xdc, 0xd9, 0xc8,
-    0xa7, 0x76, 0x68, 0x4b, 0x2c, 0x30, 0x44, 0x58, 0x50, 0x50, 0x4b, 0x42,
-    0x32, 0x4b, 0xa2, 0xb5, 0xc8, 0xc1, 0xbf, 0xa9, 0xa9, 0xa9, 0xa7, 0x89,
-    0x9c, 0xdc, 0xd7, 0xc2, 0xab, 0x89, 0x76, 0x76, 0x88, 0x70, 0x70, 0x76,
-    0x7c, 0x5c, 0x4b, 0x57, 0x71, 0xcc, 0xe9, 0xe6, 0xeb, 0xe6, 0xd7, 0xed,
-    0xf6, 0xf5, 0xe7, 0xd7, 0xc5, 0xdc, 0xd5, 0x94, 0xa6, 0xa5, 0xbb, 0xbb,
-    0xce, 0xdc, 0xd7, 0xc8, 0xad, 0x8e, 0x7f, 0x71, 0x75, 0xd2, 0xe3, 0xee,
-    0xeb, 0xe0, 0xbc, 0x97, 0x74, 0x54, 0x5e, 0x78, 0x9f, 0x9f, 0x86, 0x6f,
-    0x55, 0x2d, 0x2b, 0x2f, 0x2f, 0x4a, 0x55, 0x6f, 0x87, 0x81, 0x78, 0x5e,
-    0x75, 0x85, 0xaa, 0xb4, 0xb4, 0x81, 0x64, 0x78, 0x77, 0x75, 0x84, 0x8c,
-    0xa2, 0x75, 0x58, 0x74, 0x84, 0x82, 0x96, 0x97, 0x77, 0x78, 0x77, 0x82,
-    0xa2, 0xb1, 0xcf, 0xd2, 0xb4, 0x9d, 0x69, 0x4a, 0x36, 0x2b, 0x40, 0x40,
-    0x2f, 0x40, 0x52, 0x52, 0x35, 0x1e, 0x21, 0x1c, 0x0b, 0x03, 0x02, 0x02,
-    0x02, 0x02, 0x03, 0x0b, 0x13, 0x1e, 0x3d, 0x5a, 0x85, 0xa3, 0xae, 0xa2,
-    0x91, 0x91, 0x91, 0x86, 0x81, 0x81, 0x5e, 0x61, 0x54, 0x4a, 0x4a, 0x48,
-    0x2d, 0x28, 0x2f, 0x1f, 0x14, 0x1c, 0x21, 0x2a, 0x31, 0x5e, 0x75, 0x86,
-    0x85, 0x93, 0x93, 0xa8, 0xa2, 0x94, 0x94, 0xa8, 0xb2, 0x87, 0x7d, 0x81,
-    0x2a, 0x1e, 0x28, 0x1d, 0x1e, 0x1c, 0x0a, 0x1c, 0x2d, 0x30, 0x5a, 0x9f,
-    0xa0, 0x72, 0x93, 0xd3, 0x9f, 0x7a, 0x8c, 0x91, 0x78, 0x47, 0x28, 0x23,
-    0x3e, 0x2d, 0x2b, 0x1b, 0x68, 0x74, 0x85, 0xbc, 0xaa, 0xc6, 0xdd, 0xdd,
-    0xc9, 0xab, 0x88, 0x7c, 0x68, 0x30, 0x23, 0x37, 0x6b, 0x93, 0xa5, 0xb5,
-    0xb5, 0xc9, 0xc2, 0xb5, 0xb5, 0x94, 0x71, 0x71, 0x32, 0x4b, 0x71, 0x71,
-    0x68, 0x82, 0x88, 0x71, 0x71, 0x68, 0x42, 0x4b, 0x58, 0x57, 0x57, 0x57,
-    0x68, 0x68, 0x57, 0x4b, 0x4b, 0x4b, 0x32, 0x2c, 0x23, 0x56, 0xce, 0xd7,
-    0xda, 0xe6, 0xe6, 0xe8, 0xe8, 0xe6, 0xe6, 0xe6, 0xe6, 0xd7, 0xe8, 0xe6,
-    0xe6, 0xda, 0xd7, 0xe9, 0xf5, 0xef, 0xef, 0xd8, 0xd6, 0xc5, 0xc5, 0xb6,
-    0xc6, 0xb5, 0xca, 0xdd, 0xf7, 0xe8, 0xea, 0xea, 0xf7, 0xe9, 0xd7, 0xc1,
-    0x8a, 0xab, 0xab, 0xc8, 0xc8, 0xc8, 0xc8, 0xa7, 0x89, 0x76, 0x5b, 0x42,
-    0x44, 0x3a, 0x43, 0x43, 0x43, 0x2c, 0x2c, 0x42, 0x58, 0x82, 0xa5, 0xc8,
-    0xd7, 0xe6, 0xd8, 0xbf, 0x89, 0x8a, 0xb6, 0x8a, 0x94, 0xd5, 0xd7, 0xc2,
-    0xa5, 0x9c, 0x9c, 0xab, 0x9c, 0x76, 0x5c, 0x7c, 0x88, 0x76, 0x5b, 0x4b,
-    0xa8, 0xf7, 0xf7, 0xe9, 0xe6, 0xd7, 0xd9, 0xea, 0xf6, 0xef, 0xde, 0xc8,
-    0xc8, 0xdc, 0xa5, 0x7c, 0x7f, 0x93, 0xd5, 0xd5, 0xce, 0xd9, 0xd7, 0xca,
-    0xa6, 0x94, 0x7f, 0x58, 0x6b, 0xa2, 0xd1, 0xe1, 0xe1, 0xdf, 0xbc, 0x83,
-    0x6b, 0x54, 0x36, 0x69, 0x7e, 0x78, 0x5e, 0x55, 0x55, 0x40, 0x40, 0x40,
-    0x36, 0x36, 0x47, 0x55, 0x6f, 0x64, 0x5e, 0x5a, 0x75, 0xa2, 0xbb, 0xd2,
-    0xb4, 0x81, 0x55, 0x61, 0x61, 0x6b, 0x75, 0x86, 0x77, 0x6c, 0x50, 0x6b,
-    0x75, 0x75, 0x75, 0x51, 0x44, 0x6c, 0x78, 0x86, 0xa2, 0xaa, 0xaf, 0xbb,
-    0xb4, 0x80, 0x4c, 0x36, 0x2f, 0x2f, 0x2d, 0x2b, 0x2f, 0x2f, 0x1e, 0x21,
-    0x22, 0x15, 0x15, 0x0c, 0x09, 0x05, 0x02, 0x02, 0x02, 0x00, 0x02, 0x06,
-    0x13, 0x1c, 0x2f, 0x51, 0x72, 0x84, 0xa3, 0xa3, 0x91, 0x85, 0x91, 0x9f,
-    0x81, 0x6a, 0x69, 0x55, 0x36, 0x4a, 0x4a, 0x36, 0x35, 0x21, 0x21, 0x19,
-    0x10, 0x1b, 0x22, 0x2a, 0x48, 0x64, 0x77, 0x8c, 0x7a, 0xa2, 0xb1, 0xb2,
-    0xb2, 0xaa, 0xaa, 0xcf, 0xb7, 0x86, 0x75, 0x61, 0x2e, 0x2d, 0x31, 0x2a,
-    0x1c, 0x13, 0x10, 0x3d, 0x56, 0x53, 0x6c, 0x72, 0x82, 0x93, 0xa8, 0xb1,
-    0xaa, 0x94, 0x7a, 0x75, 0x6c, 0x46, 0x2e, 0x2e, 0x45, 0x47, 0x2e, 0x3e,
-    0x6b, 0x44, 0x75, 0x84, 0xaf, 0xc6, 0xc6, 0xc6, 0xb5, 0x88, 0x71, 0x68,
-    0x58, 0x44, 0x51, 0x75, 0x68, 0x88, 0xa5, 0xb5, 0xca, 0xc9, 0xc9, 0xb5,
-    0xab, 0x9c, 0x7c, 0x71, 0x4b, 0x6b, 0x88, 0x88, 0x94, 0xa5, 0xa5, 0x9c,
-    0x93, 0x7f, 0x57, 0x2c, 0x37, 0x42, 0x42, 0x4b, 0x57, 0x57, 0x4b, 0x32,
-    0x32, 0x32, 0x37, 0x2c, 0x23, 0x3d, 0xb1, 0xd7, 0xe9, 0xfe, 0xfd, 0xf5,
-    0xef, 0xe6, 0xe6, 0xe8, 0xf7, 0xf5, 0xe8, 0xef, 0xef, 0xef, 0xe6, 0xe8,
-    0xef, 0xef, 0xd8, 0xd6, 0xc5, 0xd8, 0xc2, 0xda, 0xe6, 0xc1, 0xd5, 0xdc,
-    0xd7, 0xe6, 0xe6, 0xe6, 0xe6, 0xde, 0xc8, 0xa9, 0x89, 0x79, 0x8a, 0xa7,
-    0xa7, 0xa7, 0xa9, 0x89, 0x79, 0x76, 0x5b, 0x42, 0x45, 0x30, 0x2c, 0x2c,
-    0x2c, 0x37, 0x37, 0x58, 0x93, 0xb5, 0xd5, 0xc9, 0xd7, 0xd7, 0xc8, 0xc5,
-    0xa7, 0xc8, 0xc8, 0xa7, 0xb5, 0xda, 0xda, 0xd7, 0xca, 0xb5, 0xab, 0x9c,
-    0x94, 0x76, 0x7c, 0x94, 0x94, 0x7c, 0x71, 0x82, 0xf7, 0xf9, 0xfa, 0xf5,
-    0xd6, 0xd6, 0xd8, 0xef, 0xef, 0xde, 0xdb, 0xc5, 0xb6, 0xc6, 0xa6, 0x88,
-    0x71, 0x83, 0xdc, 0xe8, 0xd9, 0xdc, 0xdc, 0xca, 0xab, 0x93, 0x68, 0x43,
-    0x85, 0x91, 0xae, 0xce, 0xce, 0xbc, 0x97, 0x74, 0x50, 0x3e, 0x36, 0x6d,
-    0x80, 0x81, 0x6f, 0x61, 0x5e, 0x64, 0x5e, 0x55, 0x48, 0x40, 0x40, 0x4e,
-    0x67, 0x6a, 0x5e, 0x63, 0x84, 0xac, 0xd1, 0xd2, 0x9d, 0x6a, 0x48, 0x55,
-    0x5e, 0x54, 0x54, 0x61, 0x60, 0x5a, 0x5a, 0x6b, 0x75, 0x77, 0x56, 0x30,
-    0x44, 0x50, 0x58, 0x72, 0x93, 0xa5, 0xa5, 0xa5, 0xce, 0xb9, 0x6a, 0x3d,
-    0x2f, 0x40, 0x40, 0x33, 0x2a, 0x21, 0x12, 0x15, 0x15, 0x15, 0x0b, 0x09,
-    0x05, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x0a, 0x22, 0x2b, 0x46,
-    0x58, 0x74, 0x84, 0x91, 0x75, 0x75, 0x75, 0x7e, 0x81, 0x81, 0x69, 0x4c,
-    0x40, 0x40, 0x3e, 0x36, 0x40, 0x21, 0x12, 0x0d, 0x12, 0x12, 0x12, 0x2a,
-    0x3d, 0x67, 0x87, 0x9a, 0x86, 0xb1, 0xcf, 0xbe, 0xbb, 0xaa, 0xaf, 0xbb,
-    0x8c, 0x84, 0x85, 0x86, 0x60, 0x64, 0x67, 0x4e, 0x1c, 0x10, 0x49, 0x7d,
-    0xa0, 0x9a, 0x8c, 0xb2, 0xcf, 0xa8, 0x9c, 0x9c, 0x9c, 0xa5, 0xbe, 0x77,
-    0x72, 0x75, 0x47, 0x30, 0x45, 0x3d, 0x28, 0x64, 0x37, 0x23, 0x5a, 0x58,
-    0x84, 0xa2, 0xa5, 0x93, 0x88, 0x71, 0x57, 0x42, 0x4b, 0x58, 0x50, 0x75,
-    0x82, 0x93, 0xbb, 0xc9, 0xd5, 0xdc, 0xdd, 0xc9, 0xab, 0x94, 0x7c, 0x68,
-    0x6b, 0x72, 0x94, 0x93, 0x9c, 0xb8, 0xb5, 0xab, 0xa5, 0x94, 0x68, 0x37,
-    0x37, 0x32, 0x32, 0x32, 0x42, 0x42, 0x42, 0x42, 0x37, 0x2c, 0x30, 0x23,
-    0x30, 0x53, 0xa2, 0xc9, 0xfa, 0xfe, 0xf7, 0xf5, 0xef, 0xda, 0xd8, 0xf7,
-    0xfe, 0xf6, 0xf5, 0xf7, 0xfe, 0xf6, 0xe6, 0xd8, 0xd8, 0xe6, 0xd8, 0xda,
-    0xd7, 0xe9, 0xf7, 0xf9, 0xe9, 0xda, 0xca, 0xc8, 0xda, 0xd8, 0xda, 0xd8,
-    0xc1, 0xc5, 0xbf, 0x89, 0x89, 0x76, 0x76, 0x79, 0x89, 0x89, 0x89, 0x79,
-    0x79, 0x70, 0x66, 0x42, 0x44, 0x23, 0x1d, 0x2c, 0x4b, 0x5a, 0x60, 0x51,
-    0x58, 0xb5, 0xd7, 0xc8, 0xc1, 0xda, 0xda, 0xc5, 0xa4, 0xa7, 0xab, 0x9c,
-    0xb8, 0xe9, 0xe8, 0xe8, 0xda, 0xc1, 0xc1, 0xab, 0xab, 0x8a, 0x76, 0x5b,
-    0x71, 0x82, 0x71, 0x8c, 0xe8, 0xe9, 0xf6, 0xef, 0xef, 0xe6, 0xe8, 0xf7,
-    0xe7, 0xdb, 0xc5, 0xad, 0xb6, 0xa6, 0x94, 0x71, 0x71, 0x73, 0xd1, 0xeb,
-    0xef, 0xea, 0xea, 0xc8, 0xb6, 0x94, 0x66, 0x58, 0x9f, 0xae, 0xae, 0xbc,
-    0xbb, 0x97, 0x84, 0x6b, 0x46, 0x2e, 0x2b, 0x4e, 0x81, 0x87, 0x86, 0x85,
-    0x7b, 0x77, 0x77, 0x64, 0x64, 0x4c, 0x35, 0x35, 0x6a, 0x6e, 0x69, 0x61,
-    0x74, 0xa3, 0xb7, 0xb4, 0x81, 0x56, 0x56, 0x56, 0x64, 0x40, 0x3e, 0x46,
-    0x51, 0x51, 0x5a, 0x60, 0x60, 0x64, 0x56, 0x30, 0x37, 0x5a, 0x7a, 0xa2,
-    0xb2, 0xa2, 0xbe, 0xcf, 0xd3, 0xd3, 0xb9, 0x6a, 0x2f, 0x21, 0x21, 0x21,
-    0x22, 0x25, 0x0c, 0x08, 0x08, 0x08, 0x06, 0x05, 0x03, 0x03, 0x03, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x05, 0x1c, 0x2b, 0x2e, 0x46, 0x63, 0x63, 0x63,
-    0x61, 0x63, 0x61, 0x61, 0x69, 0x6a, 0x4c, 0x40, 0x4c, 0x2f, 0x2d, 0x40,
-    0x40, 0x35, 0x15, 0x0a, 0x0c, 0x0c, 0x12, 0x2a, 0x67, 0x7d, 0x78, 0x86,
-    0xa2, 0xaa, 0xbb, 0xbb, 0xc6, 0xbc, 0xbe, 0xac, 0xaa, 0x97, 0xae, 0x9f,
-    0x60, 0x64, 0x81, 0x6e, 0x13, 0x2a, 0x56, 0x7d, 0xb4, 0xb1, 0xa2, 0xcf,
-    0xe3, 0xbb, 0xa8, 0xa5, 0xb5, 0xc6, 0xd1, 0x8c, 0xaa, 0xd2, 0x7d, 0x53,
-    0x45, 0x2a, 0x1c, 0x7d, 0x23, 0x1f, 0x5e, 0x6c, 0x75, 0x72, 0x71, 0x68,
-    0x57, 0x4b, 0x42, 0x42, 0x37, 0x30, 0x30, 0x6c, 0x8c, 0x93, 0xa5, 0xb8,
-    0xc6, 0xdd, 0xdd, 0xc9, 0xab, 0x88, 0x7f, 0x68, 0x68, 0x68, 0x7c, 0xa8,
-    0xa5, 0xb8, 0xb5, 0xb5, 0xb5, 0xab, 0x7c, 0x4b, 0x44, 0x51, 0x44, 0x42,
-    0x42, 0x42, 0x32, 0x37, 0x2c, 0x23, 0x30, 0x60, 0x9b, 0xb1, 0xb8, 0xcc,
-    0xf7, 0xf7, 0xf5, 0xf5, 0xe6, 0xda, 0xd7, 0xf5, 0xef, 0xef, 0xf6, 0xfd,
-    0xfd, 0xef, 0xda, 0xe6, 0xe6, 0xe6, 0xe6, 0xe9, 0xeb, 0xe9, 0xf6, 0xf9,
-    0xea, 0xda, 0xc1, 0xa9, 0xa7, 0xb5, 0xd7, 0xc1, 0xbf, 0xa9, 0x8d, 0x89,
-    0x76, 0x76, 0x76, 0x76, 0x8a, 0x79, 0x79, 0x76, 0x5c, 0x5b, 0x4b, 0x58,
-    0x6b, 0x43, 0x4b, 0x57, 0x57, 0x58, 0x60, 0x51, 0x72, 0xc6, 0xd8, 0xc8,
-    0xc1, 0xda, 0xd8, 0xc0, 0xa4, 0xa7, 0xca, 0xb8, 0xd7, 0xe6, 0xe6, 0xda,
-    0xc1, 0xa7, 0xc1, 0xc2, 0xab, 0x9c, 0x8a, 0x7c, 0x7f, 0x7f, 0x7c, 0xc9,
-    0xe9, 0xf6, 0xf9, 0xf9, 0xf6, 0xda, 0xe9, 0xeb, 0xd7, 0xc8, 0xc5, 0xb6,
-    0xa6, 0x96, 0x7f, 0x71, 0x7f, 0x96, 0xdd, 0xe9, 0xea, 0xea, 0xe6, 0xca,
-    0xca, 0x94, 0x70, 0x58, 0x91, 0xbe, 0xcf, 0xd5, 0xaf, 0x93, 0x93, 0x74,
-    0x51, 0x2e, 0x29, 0x48, 0x78, 0x87, 0x8c, 0xa3, 0xa3, 0x91, 0x86, 0x78,
-    0x6a, 0x6a, 0x52, 0x35, 0x52, 0x6d, 0x69, 0x54, 0x63, 0x85, 0x9f, 0x81,
-    0x56, 0x55, 0x64, 0x67, 0x7d, 0x67, 0x45, 0x55, 0x53, 0x60, 0x77, 0x7d,
-    0x4e, 0x2b, 0x3e, 0x53, 0x60, 0x60, 0x72, 0x8c, 0xb4, 0xb7, 0xac, 0xbc,
-    0xbe, 0xd2, 0xd4, 0x9d, 0x22, 0x0c, 0x0c, 0x09, 0x06, 0x18, 0x06, 0x05,
-    0x05, 0x06, 0x06, 0x06, 0x08, 0x09, 0x06, 0x03, 0x02, 0x02, 0x02, 0x03,
-    0x06, 0x15, 0x1e, 0x2b, 0x2e, 0x3a, 0x39, 0x4d, 0x46, 0x4d, 0x46, 0x46,
-    0x4a, 0x4c, 0x36, 0x36, 0x4a, 0x40, 0x2f, 0x4c, 0x4a, 0x21, 0x15, 0x08,
-    0x09, 0x08, 0x1c, 0x33, 0x64, 0x60, 0x77, 0x85, 0xa2, 0xaa, 0xbb, 0xc6,
-    0xc6, 0xc6, 0xbc, 0xb7, 0xae, 0x82, 0x7f, 0x73, 0x51, 0x53, 0x5e, 0x31,
-    0x1b, 0x49, 0x64, 0x78, 0xae, 0x8c, 0x82, 0x93, 0xce, 0xbb, 0xcf, 0xe1,
-    0xdc, 0xc6, 0xc6, 0xaa, 0xaa, 0xbe, 0x77, 0x86, 0x78, 0x4e, 0x06, 0x34,
-    0x1d, 0x2b, 0x3e, 0x27, 0x47, 0x75, 0x4b, 0x42, 0x32, 0x32, 0x2c, 0x37,
-    0x23, 0x23, 0x2e, 0x86, 0x8c, 0x93, 0x9c, 0xa5, 0xb5, 0xc6, 0xb1, 0xb8,
-    0x94, 0x7c, 0x71, 0x6b, 0x57, 0x71, 0x82, 0xa8, 0xa5, 0xb5, 0xca, 0xc9,
-    0xc9, 0xab, 0x7c, 0x68, 0x51, 0x51, 0x44, 0x37, 0x44, 0x37, 0x2c, 0x2c,
-    0x2c, 0x30, 0x64, 0xb2, 0xcf, 0xcf, 0xb8, 0xdc, 0xf5, 0xef, 0xef, 0xe6,
-    0xda, 0xef, 0xe9, 0xf7, 0xf5, 0xf5, 0xe9, 0xe8, 0xef, 0xe6, 0xe8, 0xeb,
-    0xfe, 0xf9, 0xef, 0xd7, 0xd8, 0xe6, 0xef, 0xe6, 0xd8, 0xc5, 0xa9, 0xa9,
-    0xab, 0xab, 0xa7, 0xa4, 0x8d, 0x89, 0x89, 0x76, 0x76, 0x5c, 0x5b, 0x7f,
-    0x8a, 0x5c, 0x5c, 0x70, 0x5b, 0x57, 0x68, 0x71, 0x71, 0x7f, 0x88, 0x88,
-    0x71, 0x58, 0x44, 0x37, 0x5a, 0xa5, 0xd8, 0xc1, 0xc5, 0xc1, 0xd6, 0xc1,
-    0xa7, 0xc1, 0xc8, 0xab, 0xc2, 0xda, 0xda, 0xc1, 0xc1, 0xc1, 0xc9, 0xc8,
-    0xab, 0x8a, 0x5b, 0x57, 0x71, 0x9c, 0x93, 0xe1, 0xfa, 0xfe, 0xfa, 0xfa,
-    0xe6, 0xe6, 0xe6, 0xd7, 0xc1, 0xca, 0xca, 0xaf, 0xa5, 0x94, 0x7f, 0x7f,
-    0x93, 0xaa, 0xe9, 0xeb, 0xf6, 0xef, 0xe6, 0xca, 0xb6, 0x94, 0x82, 0x50,
-    0x54, 0xcf, 0xdd, 0xdc, 0xca, 0xb6, 0x96, 0x84, 0x58, 0x46, 0x2e, 0x55,
-    0x64, 0x87, 0xa3, 0xac, 0xac, 0xac, 0x91, 0x78, 0x64, 0x48, 0x33, 0x2f,
-    0x2f, 0x4c, 0x4c, 0x55, 0x61, 0x77, 0x77, 0x69, 0x81, 0x7d, 0x7d, 0x9b,
-    0x9b, 0x9d, 0x56, 0x48, 0x56, 0x78, 0x87, 0x31, 0x2a, 0x27, 0x3a, 0x51,
-    0x77, 0x87, 0x58, 0x71, 0x85, 0xa3, 0xa3, 0xbe, 0xcf, 0xce, 0xcf, 0xb4,
-    0x26, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x06, 0x0b, 0x0b, 0x0c,
-    0x0c, 0x0c, 0x09, 0x06, 0x03, 0x03, 0x05, 0x05, 0x0b, 0x0c, 0x12, 0x1a,
-    0x1d, 0x29, 0x3e, 0x36, 0x36, 0x46, 0x46, 0x46, 0x4a, 0x4a, 0x36, 0x4a,
-    0x4a, 0x36, 0x3e, 0x3e, 0x2b, 0x2a, 0x15, 0x03, 0x03, 0x05, 0x13, 0x20,
-    0x48, 0x53, 0xa0, 0x9a, 0xa2, 0xb8, 0xce, 0xcf, 0xc6, 0xbb, 0xbc, 0xbe,
-    0xa0, 0x72, 0x84, 0x75, 0x86, 0x60, 0x55, 0x28, 0x3d, 0x48, 0x48, 0x60,
-    0x77, 0x72, 0x7a, 0xaa, 0xa8, 0xa5, 0xe1, 0xd9, 0xdc, 0xdd, 0xdd, 0xe1,
-    0xaa, 0x85, 0x74, 0x6c, 0xa0, 0x80, 0x11, 0x05, 0x2d, 0x28, 0x3e, 0x27,
-    0x1a, 0x30, 0x30, 0x23, 0x37, 0x37, 0x2c, 0x44, 0x37, 0x30, 0x3e, 0x5a,
-    0x7a, 0x82, 0x82, 0x93, 0x94, 0x94, 0xa5, 0x94, 0x71, 0x68, 0x58, 0x32,
-    0x58, 0x82, 0x82, 0xa8, 0xa5, 0xa5, 0xb8, 0xc6, 0xb8, 0x9c, 0x7c, 0x68,
-    0x44, 0x37, 0x37, 0x2c, 0x30, 0x23, 0x23, 0x2e, 0x30, 0x56, 0x9b, 0xb2,
-    0xcf, 0xcc, 0xb8, 0xcc, 0xe8, 0xe6, 0xef, 0xef, 0xe6, 0xf6, 0xfe, 0xfe,
-    0xf5, 0xef, 0xe6, 0xef, 0xe6, 0xe6, 0xe9, 0xf6, 0xf7, 0xf6, 0xda, 0xd8,
-    0xc1, 0xc8, 0xda, 0xc1, 0xc1, 0xbf, 0xa9, 0x8a, 0x8a, 0x8a, 0x79, 0x79,
-    0x79, 0x89, 0x8a, 0x76, 0x70, 0x4b, 0x4b, 0x71, 0x70, 0x5b, 0x66, 0x5b,
-    0x57, 0x57, 0x71, 0x7f, 0x7f, 0xa6, 0x9c, 0x9c, 0x88, 0x7f, 0x58, 0x51,
-    0x6c, 0xa5, 0xc8, 0xd8, 0xd8, 0xc8, 0xda, 0xd7, 0xc1, 0xa7, 0xab, 0xc8,
-    0xe6, 0xe9, 0xe6, 0xd8, 0xc1, 0xd7, 0xe8, 0xc8, 0xa7, 0x79, 0x7c, 0x9c,
-    0x93, 0xa5, 0xa2, 0xf0, 0xfc, 0xfe, 0xfd, 0xfa, 0xf9, 0xeb, 0xdc, 0xc8,
-    0xab, 0xbb, 0xa8, 0xa5, 0xa5, 0x94, 0x71, 0x82, 0x94, 0x7f, 0xc6, 0xe9,
-    0xed, 0xea, 0xe7, 0xde, 0xa6, 0x94, 0x84, 0x58, 0x61, 0xd2, 0xe1, 0xdc,
-    0xd7, 0xca, 0xaf, 0x83, 0x68, 0x4d, 0x46, 0x4a, 0x4c, 0x7e, 0x9f, 0xac,
-    0xac, 0xa3, 0x86, 0x6f, 0x47, 0x4c, 0x4e, 0x40, 0x2f, 0x36, 0x40, 0x3d,
-    0x56, 0x6a, 0x64, 0x6f, 0xa0, 0x9d, 0xa0, 0x9b, 0x9b, 0x7d, 0x67, 0x67,
-    0x60, 0x87, 0x9b, 0x7d, 0x49, 0x48, 0x3e, 0x37, 0x5a, 0x6f, 0x50, 0x58,
-    0x75, 0x91, 0xae, 0xae, 0xbe, 0xce, 0xcf, 0xb4, 0x26, 0x11, 0x11, 0x06,
-    0x06, 0x03, 0x03, 0x06, 0x0c, 0x0a, 0x12, 0x19, 0x19, 0x12, 0x16, 0x0c,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x0c, 0x12, 0x19, 0x1e, 0x2b, 0x2f, 0x36,
-    0x36, 0x36, 0x36, 0x36, 0x4a, 0x4a, 0x36, 0x36, 0x36, 0x40, 0x2f, 0x2b,
-    0x1f, 0x1e, 0x12, 0x05, 0x05, 0x05, 0x07, 0x20, 0x3d, 0x53, 0x77, 0x7a,
-    0x93, 0xbb, 0xcf, 0xd2, 0xcf, 0xbc, 0xaa, 0xaa, 0xae, 0xb2, 0xa0, 0x77,
-    0x91, 0xa0, 0x6a, 0x3d, 0x48, 0x2d, 0x28, 0x45, 0x60, 0x7a, 0x9b, 0xb2,
-    0xcf, 0xcc, 0xce, 0xc6, 0xdc, 0xce, 0xc6, 0xce, 0xcc, 0xb2, 0x77, 0x5a,
-    0x77, 0x4e, 0x0b, 0x07, 0x45, 0x1d, 0x14, 0x23, 0x23, 0x37, 0x37, 0x37,
-    0x58, 0x42, 0x4b, 0x58, 0x58, 0x44, 0x3a, 0x51, 0x50, 0x50, 0x72, 0x74,
-    0x73, 0x71, 0x71, 0x68, 0x57, 0x58, 0x42, 0x37, 0x42, 0x68, 0x74, 0x93,
-    0x93, 0xa5, 0xa5, 0xa5, 0x9c, 0x88, 0x5b, 0x42, 0x37, 0x27, 0x23, 0x23,
-    0x23, 0x1d, 0x2e, 0x2e, 0x30, 0x78, 0xb2, 0xcc, 0xcc, 0xb8, 0xb8, 0xdd,
-    0xf6, 0xf5, 0xf6, 0xfe, 0xfd, 0xf7, 0xfe, 0xfd, 0xef, 0xef, 0xe8, 0xf6,
-    0xe6, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd6, 0xc1, 0xc2, 0xab, 0xc1, 0xc1,
-    0xc1, 0xa7, 0xa7, 0x94, 0x7c, 0x5c, 0x8a, 0x9c, 0x8a, 0x76, 0x8a, 0x70,
-    0x71, 0x57, 0x71, 0x7f, 0x71, 0x7f, 0x68, 0x4b, 0x4b, 0x42, 0x71, 0x94,
-    0x94, 0xb6, 0xb6, 0xc1, 0xab, 0x9c, 0x7f, 0x8c, 0xc9, 0xd7, 0xd7, 0xd7,
-    0xc1, 0xc1, 0xda, 0xda, 0xa9, 0xa9, 0xc2, 0xe9, 0xeb, 0xeb, 0xe6, 0xc1,
-    0xa7, 0xd7, 0xdc, 0xc8, 0xa7, 0x79, 0x7c, 0xa8, 0xbb, 0xa5, 0x93, 0xeb,
-    0xfe, 0xfd, 0xf6, 0xf9, 0xf7, 0xeb, 0xd7, 0xab, 0xbb, 0xcf, 0x82, 0x71,
-    0x82, 0x72, 0x82, 0x94, 0x94, 0x7f, 0x94, 0xd5, 0xea, 0xe7, 0xe7, 0xc8,
-    0xa6, 0x7f, 0x73, 0x50, 0x61, 0xd3, 0xe1, 0xeb, 0xdc, 0xd9, 0xbc, 0x96,
-    0x6b, 0x4d, 0x47, 0x36, 0x2f, 0x4c, 0x7e, 0x7b, 0x7b, 0x7e, 0x6f, 0x55,
-    0x55, 0x69, 0x64, 0x56, 0x56, 0x4c, 0x33, 0x2f, 0x4e, 0x80, 0x64, 0x5a,
-    0x75, 0x8c, 0xb2, 0xb4, 0xb4, 0x7d, 0x64, 0x60, 0x6c, 0x86, 0x9b, 0xb4,
-    0xb9, 0x6a, 0x4c, 0x2e, 0x44, 0x61, 0x54, 0x58, 0x77, 0x91, 0x91, 0xae,
-    0xbe, 0xbe, 0xd2, 0x9d, 0x1c, 0x0b, 0x0b, 0x13, 0x15, 0x0b, 0x0b, 0x0c,
-    0x0a, 0x12, 0x19, 0x21, 0x21, 0x21, 0x1c, 0x12, 0x08, 0x08, 0x0a, 0x0c,
-    0x0c, 0x0a, 0x0a, 0x12, 0x19, 0x21, 0x1f, 0x1f, 0x2f, 0x2b, 0x2b, 0x29,
-    0x2e, 0x4a, 0x40, 0x2f, 0x21, 0x21, 0x21, 0x21, 0x21, 0x19, 0x12, 0x0a,
-    0x0b, 0x13, 0x22, 0x33, 0x28, 0x45, 0x60, 0x7a, 0x82, 0xaa, 0xbb, 0xbb,
-    0xbc, 0xbc, 0x97, 0xaa, 0xae, 0xb7, 0x81, 0x75, 0x77, 0x81, 0x81, 0x56,
-    0x49, 0x3d, 0x2a, 0x28, 0x87, 0x9a, 0xb2, 0xb1, 0xcf, 0xb1, 0xbb, 0xca,
-    0xd5, 0xce, 0xce, 0xaa, 0x94, 0xcf, 0xa0, 0x77, 0x47, 0x2d, 0x2a, 0x1c,
-    0x60, 0x3d, 0x1d, 0x30, 0x51, 0x72, 0x72, 0x72, 0x58, 0x57, 0x57, 0x58,
-    0x42, 0x23, 0x27, 0x61, 0x50, 0x44, 0x61, 0x58, 0x50, 0x58, 0x4b, 0x57,
-    0x4b, 0x42, 0x37, 0x44, 0x51, 0x4b, 0x58, 0x71, 0x7f, 0x93, 0x7c, 0x7f,
-    0x70, 0x5b, 0x4b, 0x2c, 0x1d, 0x1a, 0x27, 0x30, 0x30, 0x23, 0x27, 0x28,
-    0x28, 0x78, 0xb1, 0xb1, 0xbb, 0xb1, 0xeb, 0xfd, 0xf7, 0xf5, 0xf6, 0xfd,
-    0xf6, 0xf6, 0xf5, 0xf5, 0xef, 0xf5, 0xf7, 0xf6, 0xef, 0xda, 0xd8, 0xc1,
-    0xc1, 0xd8, 0xc1, 0xda, 0xda, 0xa7, 0xc8, 0xb5, 0xa7, 0x8a, 0x8a, 0x9c,
-    0x70, 0x70, 0x7c, 0x88, 0x70, 0x5b, 0x70, 0x71, 0x71, 0x71, 0x88, 0x9c,
-    0x8a, 0x7c, 0x4b, 0x32, 0x4b, 0x6b, 0x71, 0x94, 0xa6, 0xa6, 0xc8, 0xd5,
-    0xd5, 0xb6, 0x9c, 0xc8, 0xd7, 0xd7, 0xd7, 0xc8, 0xc5, 0xa9, 0xa7, 0xa9,
-    0xa9, 0xab, 0xdc, 0xeb, 0xe9, 0xe6, 0xda, 0xc1, 0xc1, 0xc9, 0xda, 0xb5,
-    0xa7, 0x79, 0x7c, 0xb1, 0xdd, 0xa8, 0x7f, 0xd1, 0xf9, 0xfa, 0xf9, 0xf6,
-    0xf7, 0xd7, 0xca, 0xb5, 0xcc, 0x93, 0x57, 0x7a, 0x8c, 0x72, 0x9a, 0xd5,
-    0xb5, 0xa6, 0x94, 0x96, 0xd9, 0xd9, 0xde, 0xc8, 0x8e, 0x7f, 0x6b, 0x50,
-    0x54, 0x9f, 0xd2, 0xe1, 0xe1, 0xdf, 0xbc, 0x96, 0x63, 0x54, 0x4a, 0x2f,
-    0x2f, 0x40, 0x69, 0x5e, 0x5e, 0x69, 0x5e, 0x55, 0x60, 0x78, 0x78, 0x78,
-    0x78, 0x6a, 0x33, 0x2f, 0x48, 0x64, 0x64, 0x75, 0x85, 0x93, 0xbc, 0xd3,
-    0xb2, 0xb4, 0x64, 0x5a, 0x7a, 0x86, 0x9a, 0xb4, 0xb9, 0x80, 0x4e, 0x27,
-    0x44, 0x51, 0x5e, 0x37, 0x4d, 0x61, 0x77, 0x9f, 0xb2, 0xbb, 0xce, 0x6a,
-    0x13, 0x0b, 0x15, 0x1c, 0x22, 0x22, 0x15, 0x13, 0x12, 0x19, 0x19, 0x21,
-    0x21, 0x21, 0x19, 0x12, 0x0c, 0x08, 0x0a, 0x0a, 0x13, 0x0c, 0x0c, 0x12,
-    0x16, 0x1c, 0x19, 0x1e, 0x1f, 0x1f, 0x29, 0x2b, 0x29, 0x2f, 0x21, 0x24,
-    0x21, 0x16, 0x12, 0x1c, 0x19, 0x19, 0x19, 0x12, 0x13, 0x22, 0x20, 0x2a,
-    0x2d, 0x53, 0x53, 0x5a, 0x6b, 0x8c, 0xa2, 0xaf, 0xaa, 0x97, 0x91, 0x85,
-    0x91, 0x87, 0x9f, 0x6f, 0x5a, 0x55, 0x3d, 0x48, 0x56, 0x56, 0x31, 0x1e,
-    0x9a, 0x86, 0x8c, 0xaa, 0xbb, 0xa8, 0xaf, 0xc6, 0xd5, 0xce, 0xce, 0xb2,
-    0xa3, 0xb7, 0xa0, 0x9d, 0x80, 0x4e, 0x49, 0x34, 0x30, 0x28, 0x55, 0x60,
-    0x8c, 0x93, 0x93, 0x93, 0x82, 0x82, 0x72, 0x72, 0x37, 0x30, 0x28, 0x47,
-    0x44, 0x44, 0x54, 0x50, 0x43, 0x42, 0x42, 0x4b, 0x44, 0x2c, 0x23, 0x30,
-    0x60, 0x6c, 0x4b, 0x58, 0x57, 0x68, 0x68, 0x68, 0x57, 0x4b, 0x42, 0x23,
-    0x1d, 0x28, 0x3e, 0x45, 0x44, 0x37, 0x23, 0x1a, 0x1b, 0x49, 0x8c, 0xa2,
-    0xb1, 0xd2, 0xfe, 0xfe, 0xf6, 0xf5, 0xf5, 0xe8, 0xf5, 0xf5, 0xf6, 0xef,
-    0xda, 0xef, 0xf5, 0xf6, 0xd8, 0xd8, 0xd8, 0xc1, 0xc2, 0xe8, 0xe8, 0xe8,
-    0xd8, 0xc8, 0xd7, 0xd5, 0xc9, 0xc9, 0xc8, 0x9c, 0xab, 0xa6, 0xa6, 0xb5,
-    0x9c, 0x5b, 0x5b, 0x70, 0x71, 0x94, 0xa6, 0xb6, 0xc1, 0x9c, 0x70, 0x42,
-    0x58, 0x74, 0x7f, 0x94, 0xa6, 0xb6, 0xc8, 0xd7, 0xdc, 0xb8, 0xab, 0xb5,
-    0xca, 0xda, 0xda, 0xca, 0xc1, 0xbf, 0xa7, 0x89, 0x89, 0xc9, 0xdd, 0xe9,
-    0xd7, 0xda, 0xda, 0xda, 0xc1, 0xa7, 0xa7, 0xa7, 0x79, 0x8a, 0x5b, 0xa2,
-    0xb1, 0xa5, 0x7f, 0xd5, 0xf9, 0xf6, 0xef, 0xed, 0xe6, 0xd7, 0xdc, 0xa6,
-    0x7c, 0x5b, 0x57, 0xa2, 0x7a, 0x42, 0xa0, 0xe1, 0xc6, 0xd7, 0xa6, 0x8e,
-    0xca, 0xd9, 0xc8, 0xb3, 0x94, 0x73, 0x6b, 0x63, 0x54, 0x61, 0x86, 0xbe,
-    0xe0, 0xce, 0xbc, 0x83, 0x63, 0x54, 0x40, 0x1f, 0x2f, 0x4c, 0x55, 0x69,
-    0x78, 0x77, 0x77, 0x75, 0x75, 0x77, 0x86, 0x87, 0x78, 0x56, 0x33, 0x2f,
-    0x64, 0x78, 0x6c, 0x85, 0xb2, 0xae, 0xbe, 0xd2, 0xd2, 0xd2, 0x9b, 0x6c,
-    0x85, 0x9a, 0xae, 0xb2, 0xb4, 0x33, 0x40, 0x3e, 0x54, 0x75, 0x78, 0x51,
-    0x4d, 0x63, 0x75, 0x91, 0x9f, 0xa2, 0x9f, 0x22, 0x0b, 0x0a, 0x19, 0x21,
-    0x21, 0x22, 0x22, 0x12, 0x12, 0x19, 0x19, 0x19, 0x24, 0x21, 0x19, 0x12,
-    0x16, 0x0c, 0x0a, 0x13, 0x13, 0x13, 0x0c, 0x0c, 0x08, 0x0b, 0x12, 0x19,
-    0x1f, 0x24, 0x24, 0x1f, 0x2f, 0x2f, 0x2b, 0x21, 0x22, 0x0c, 0x08, 0x0a,
-    0x12, 0x19, 0x1b, 0x1e, 0x1e, 0x20, 0x20, 0x2a, 0x28, 0x45, 0x53, 0x51,
-    0x5a, 0x6b, 0x84, 0x84, 0x84, 0x84, 0x91, 0x75, 0x85, 0x9f, 0x87, 0x87,
-    0x6f, 0x56, 0x4c, 0x2d, 0x48, 0x4c, 0x20, 0x31, 0x87, 0x6c, 0x72, 0x8c,
-    0x82, 0xa8, 0xbb, 0xce, 0xd2, 0xd1, 0xbb, 0xa3, 0xa2, 0x86, 0x78, 0x9d,
-    0x6a, 0x35, 0x4e, 0x49, 0x30, 0x1a, 0x48, 0x77, 0x8c, 0xa8, 0xa5, 0xa8,
-    0x8c, 0x8c, 0x82, 0x85, 0x45, 0x44, 0x23, 0x28, 0x2e, 0x3a, 0x3a, 0x3a,
-    0x43, 0x44, 0x37, 0x44, 0x37, 0x23, 0x1a, 0x2e, 0x51, 0x5a, 0x58, 0x6c,
-    0x58, 0x42, 0x4b, 0x4b, 0x42, 0x37, 0x2c, 0x30, 0x27, 0x2e, 0x47, 0x55,
-    0x5a, 0x51, 0x27, 0x14, 0x0a, 0x1c, 0x64, 0x8c, 0x9a, 0xd2, 0xfe, 0xfd,
-    0xf7, 0xfd, 0xf6, 0xef, 0xef, 0xef, 0xef, 0xd8, 0xd8, 0xe6, 0xf7, 0xfe,
-    0xf5, 0xd8, 0xd6, 0xc1, 0xc2, 0xe9, 0xf0, 0xfa, 0xe8, 0xd6, 0xc5, 0xb5,
-    0xca, 0xe8, 0xe8, 0xc8, 0x9c, 0xab, 0xc9, 0xd7, 0xca, 0x9c, 0x88, 0x5b,
-    0x70, 0x9c, 0xca, 0xd9, 0xd5, 0xb6, 0x7f, 0x68, 0x58, 0x6b, 0x94, 0x94,
-    0xab, 0xab, 0xb6, 0xca, 0xc6, 0xa5, 0xa5, 0xdc, 0xdc, 0xd7, 0xda, 0xc8,
-    0xc1, 0xb6, 0xc8, 0x8a, 0x8a, 0xd7, 0xdc, 0xe6, 0xd8, 0xc1, 0xda, 0xda,
-    0xc0, 0xa4, 0x8a, 0xb5, 0xab, 0xab, 0x76, 0x71, 0x7f, 0x7c, 0x5b, 0xaa,
-    0xfa, 0xf9, 0xea, 0xe6, 0xde, 0xca, 0xbb, 0x94, 0x71, 0x68, 0x57, 0x57,
-    0x43, 0x2c, 0xae, 0xb2, 0xd2, 0xdd, 0xc8, 0xb6, 0xbb, 0xce, 0xaf, 0xa6,
-    0x83, 0x6b, 0x6b, 0x75, 0x75, 0x75, 0x63, 0xa3, 0xae, 0xac, 0xa3, 0x75,
-    0x46, 0x47, 0x36, 0x1e, 0x2b, 0x56, 0x55, 0x7e, 0x87, 0x86, 0x91, 0x91,
-    0x8c, 0x8c, 0x91, 0x86, 0x78, 0x67, 0x4e, 0x40, 0x6a, 0x80, 0x78, 0x91,
-    0xb2, 0xae, 0xbc, 0xce, 0xe1, 0xd2, 0xa0, 0x86, 0x82, 0xaa, 0xaa, 0xbb,
-    0xae, 0x64, 0x3e, 0x55, 0x47, 0x47, 0x5e, 0x55, 0x54, 0x61, 0x61, 0x6f,
-    0x87, 0x77, 0x35, 0x0b, 0x0b, 0x0d, 0x1e, 0x2a, 0x21, 0x35, 0x22, 0x22,
-    0x13, 0x12, 0x19, 0x19, 0x19, 0x19, 0x19, 0x12, 0x16, 0x0c, 0x0c, 0x0a,
-    0x12, 0x0d, 0x0c, 0x06, 0x03, 0x03, 0x0c, 0x19, 0x19, 0x19, 0x21, 0x1f,
-    0x21, 0x2f, 0x2b, 0x21, 0x16, 0x08, 0x03, 0x0b, 0x20, 0x20, 0x2a, 0x2d,
-    0x2a, 0x2a, 0x1c, 0x1c, 0x14, 0x28, 0x45, 0x53, 0x51, 0x50, 0x58, 0x6b,
-    0x6b, 0x63, 0x61, 0x5a, 0x75, 0x7e, 0x81, 0x81, 0x7e, 0x69, 0x4e, 0x2d,
-    0x28, 0x0d, 0x10, 0x56, 0x60, 0x51, 0x5a, 0x86, 0x7a, 0x8c, 0xaa, 0xbc,
-    0xbc, 0xbe, 0xac, 0x91, 0x91, 0x78, 0x5e, 0x55, 0x33, 0x21, 0x1e, 0x49,
-    0x3e, 0x28, 0x56, 0x86, 0xaa, 0xc6, 0xc6, 0xa8, 0xa2, 0x82, 0x6b, 0x58,
-    0x45, 0x3e, 0x2e, 0x2e, 0x28, 0x3e, 0x3a, 0x27, 0x2e, 0x2c, 0x23, 0x37,
-    0x30, 0x1d, 0x1d, 0x23, 0x3a, 0x46, 0x44, 0x51, 0x51, 0x43, 0x37, 0x37,
-    0x2c, 0x23, 0x1d, 0x1d, 0x1a, 0x28, 0x3e, 0x55, 0x61, 0x44, 0x23, 0x1b,
-    0x0d, 0x0a, 0x2a, 0x60, 0x9a, 0xd2, 0xf7, 0xf7, 0xfa, 0xfe, 0xfd, 0xf5,
-    0xef, 0xf6, 0xfd, 0xef, 0xd8, 0xda, 0xf6, 0xf5, 0xda, 0xd8, 0xd6, 0xc1,
-    0xc1, 0xd7, 0xe9, 0xeb, 0xe6, 0xc5, 0xbf, 0xa7, 0xc1, 0xd7, 0xdc, 0xc1,
-    0x8a, 0x9c, 0xc6, 0xdc, 0xd5, 0xab, 0x88, 0x68, 0x7f, 0x94, 0xb5, 0xd5,
-    0xc6, 0xb6, 0x8e, 0x57, 0x43, 0x57, 0x7f, 0x7f, 0x88, 0x9c, 0xa6, 0xa6,
-    0x94, 0x7c, 0xa5, 0xeb, 0xf0, 0xdc, 0xc8, 0xc1, 0xc1, 0xb6, 0xab, 0x8a,
-    0x7c, 0x9c, 0xca, 0xe6, 0xe6, 0xd7, 0xda, 0xda, 0xc1, 0xa7, 0xc2, 0xc9,
-    0xca, 0xab, 0x76, 0x7c, 0x5b, 0x5b, 0x68, 0x72, 0xeb, 0xeb, 0xe7, 0xde,
-    0xc8, 0xb6, 0x94, 0x7f, 0x71, 0x57, 0x58, 0x58, 0x50, 0x43, 0x60, 0xae,
-    0xe1, 0xd9, 0xc8, 0xdc, 0xdd, 0xb5, 0xc6, 0xc6, 0x7f, 0x43, 0x50, 0x77,
-    0x9a, 0xaa, 0x8c, 0x8c, 0x9f, 0x85, 0x85, 0x77, 0x51, 0x47, 0x2e, 0x1d,
-    0x19, 0x40, 0x64, 0xa0, 0x9a, 0x8c, 0x91, 0xac, 0xaa, 0xaa, 0xa3, 0x86,
-    0x64, 0x48, 0x40, 0x36, 0x5e, 0x81, 0x77, 0x84, 0xae, 0xae, 0xbc, 0xce,
-    0xcf, 0xd2, 0x87, 0x75, 0x85, 0xa5, 0xce, 0xcf, 0xd2, 0xb4, 0x5e, 0x55,
-    0x47, 0x2e, 0x3e, 0x46, 0x46, 0x54, 0x61, 0x69, 0x81, 0x35, 0x06, 0x05,
-    0x08, 0x0d, 0x19, 0x21, 0x21, 0x35, 0x22, 0x1c, 0x19, 0x19, 0x12, 0x12,
-    0x12, 0x19, 0x0d, 0x0a, 0x0a, 0x0b, 0x08, 0x0c, 0x0a, 0x0a, 0x08, 0x09,
-    0x03, 0x02, 0x05, 0x0c, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x19, 0x19, 0x16,
-    0x08, 0x03, 0x03, 0x13, 0x22, 0x20, 0x28, 0x2d, 0x28, 0x1b, 0x12, 0x0a,
-    0x10, 0x2a, 0x30, 0x45, 0x47, 0x55, 0x5e, 0x55, 0x51, 0x54, 0x6f, 0x6f,
-    0x5e, 0x47, 0x55, 0x4a, 0x55, 0x5e, 0x4c, 0x1e, 0x1b, 0x10, 0x20, 0x49,
-    0x53, 0x30, 0x45, 0x77, 0x77, 0x75, 0x8c, 0xa3, 0x97, 0xa3, 0xa3, 0x85,
-    0x9f, 0x9d, 0x6e, 0x48, 0x52, 0x1c, 0x10, 0x33, 0x2e, 0x2b, 0x69, 0x87,
-    0xbe, 0xce, 0xbe, 0xbb, 0x8c, 0x8c, 0x5a, 0x4b, 0x51, 0x28, 0x40, 0x2d,
-    0x28, 0x1d, 0x1a, 0x14, 0x1d, 0x27, 0x2e, 0x27, 0x1d, 0x28, 0x30, 0x23,
-    0x27, 0x27, 0x37, 0x2c, 0x37, 0x44, 0x37, 0x30, 0x23, 0x1b, 0x0d, 0x0a,
-    0x0d, 0x1b, 0x28, 0x3e, 0x3e, 0x2e, 0x1a, 0x14, 0x10, 0x10, 0x20, 0x53,
-    0x7d, 0xe1, 0xf7, 0xf9, 0xf9, 0xfd, 0xfe, 0xfd, 0xf5, 0xf7, 0xf7, 0xfa,
-    0xf7, 0xe9, 0xe9, 0xe6, 0xd6, 0xc0, 0xc1, 0xc8, 0xc2, 0xc1, 0xd8, 0xd8,
-    0xc1, 0xbf, 0xa9, 0x8a, 0xa7, 0xc1, 0xc8, 0xa7, 0x8a, 0x8a, 0xa6, 0xca,
-    0xb6, 0x9c, 0x5b, 0x57, 0x7f, 0x7f, 0x9c, 0xab, 0xa6, 0x8a, 0x5c, 0x57,
-    0x37, 0x42, 0x66, 0x57, 0x5b, 0x7c, 0x7c, 0x7c, 0x70, 0x5b, 0xa5, 0xdd,
-    0xe1, 0xdc, 0xc8, 0xab, 0xab, 0xab, 0x9c, 0x9c, 0x94, 0x68, 0xb5, 0xe6,
-    0xe6, 0xd8, 0xc0, 0xa7, 0xd8, 0xc8, 0x9c, 0xc9, 0xab, 0x76, 0x5b, 0x7c,
-    0x88, 0x70, 0x9c, 0x58, 0xa3, 0xdc, 0xd9, 0xc8, 0xad, 0x94, 0x7f, 0x73,
-    0x57, 0x50, 0x74, 0x75, 0x51, 0x37, 0x47, 0xe4, 0xee, 0xd9, 0xd5, 0xeb,
-    0xdc, 0xb6, 0xcc, 0xc6, 0x71, 0x42, 0x58, 0x77, 0x9f, 0xbe, 0xaa, 0xa2,
-    0xaa, 0x97, 0x84, 0x75, 0x77, 0x54, 0x3e, 0x29, 0x1f, 0x2f, 0x6a, 0xa0,
-    0x9a, 0xa2, 0xa3, 0xac, 0xbc, 0xac, 0x91, 0x7e, 0x40, 0x4c, 0x55, 0x46,
-    0x4d, 0x87, 0x86, 0x74, 0xac, 0xbe, 0xbc, 0xce, 0xdd, 0xd3, 0xa0, 0x85,
-    0x96, 0xaa, 0xbc, 0xce, 0xcf, 0xb4, 0x78, 0x55, 0x45, 0x44, 0x47, 0x47,
-    0x47, 0x40, 0x35, 0x1c, 0x1c, 0x0b, 0x06, 0x0b, 0x07, 0x12, 0x19, 0x1e,
-    0x21, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f, 0x19, 0x12, 0x12, 0x19, 0x19, 0x12,
-    0x12, 0x0c, 0x08, 0x0b, 0x0b, 0x08, 0x06, 0x06, 0x02, 0x00, 0x00, 0x06,
-    0x12, 0x19, 0x1c, 0x12, 0x16, 0x0a, 0x0c, 0x0c, 0x05, 0x03, 0x06, 0x15,
-    0x22, 0x1b, 0x1d, 0x28, 0x28, 0x1b, 0x0d, 0x1b, 0x31, 0x48, 0x2d, 0x2d,
-    0x48, 0x56, 0x56, 0x3e, 0x55, 0x47, 0x55, 0x4c, 0x47, 0x47, 0x64, 0x3e,
-    0x47, 0x64, 0x6a, 0x2a, 0x1e, 0x1b, 0x1e, 0x48, 0x45, 0x3e, 0x30, 0x77,
-    0x77, 0x60, 0x75, 0x74, 0x84, 0x75, 0x61, 0x61, 0x6f, 0x9d, 0x52, 0x4c,
-    0x4e, 0x21, 0x14, 0x1b, 0x1d, 0x1e, 0x64, 0x7e, 0x9f, 0xaa, 0xa2, 0x8c,
-    0x74, 0x58, 0x44, 0x37, 0x45, 0x1a, 0x1f, 0x28, 0x30, 0x1a, 0x0a, 0x14,
-    0x14, 0x1d, 0x27, 0x14, 0x1a, 0x30, 0x45, 0x2c, 0x23, 0x27, 0x3a, 0x2c,
-    0x30, 0x44, 0x37, 0x28, 0x1d, 0x10, 0x07, 0x05, 0x05, 0x0a, 0x19, 0x2b,
-    0x1f, 0x14, 0x14, 0x1b, 0x2a, 0x56, 0xb2, 0xd2, 0xeb, 0xfd, 0xf7, 0xf5,
-    0xef, 0xf5, 0xf6, 0xf6, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xe9, 0xe8, 0xda,
-    0xc1, 0xc1, 0xc8, 0xc8, 0xa7, 0xa9, 0xa9, 0xa9, 0xa7, 0xa9, 0xa7, 0xab,
-    0xab, 0xab, 0xa7, 0x8a, 0x8a, 0x5c, 0x8a, 0x8a, 0x8a, 0x76, 0x70, 0x6b,
-    0x57, 0x7f, 0x7c, 0x8a, 0x76, 0x76, 0x66, 0x4b, 0x4b, 0x58, 0x72, 0x6b,
-    0x71, 0x5b, 0x5b, 0x68, 0x57, 0x42, 0x8c, 0xcc, 0xd5, 0xc6, 0xb6, 0xab,
-    0x9c, 0x8a, 0x94, 0x88, 0x72, 0xc9, 0xd7, 0xe6, 0xe6, 0xd8, 0xc0, 0xc2,
-    0xd7, 0xa7, 0x79, 0x8a, 0x88, 0x76, 0x5c, 0xa5, 0xa5, 0x9c, 0xab, 0x57,
-    0x6b, 0xd5, 0xc8, 0xad, 0x8e, 0x7f, 0x73, 0x73, 0x6b, 0x58, 0x58, 0x50,
-    0x50, 0x43, 0x86, 0xe4, 0xd3, 0xe0, 0xed, 0xe9, 0xde, 0xd7, 0xdd, 0xa5,
-    0x71, 0x4b, 0x58, 0x51, 0x9f, 0xcf, 0xce, 0xc6, 0xc6, 0xbb, 0x97, 0x84,
-    0x8c, 0x75, 0x54, 0x36, 0x3e, 0x3d, 0x40, 0x67, 0xa0, 0x9f, 0xa3, 0xbc,
-    0xac, 0xa3, 0x87, 0x56, 0x40, 0x4c, 0x64, 0x55, 0x54, 0x7e, 0xa0, 0x85,
-    0xac, 0xbe, 0xbc, 0xce, 0xdd, 0xd3, 0x87, 0x75, 0x83, 0x94, 0xbc, 0xce,
-    0xce, 0x9d, 0x4c, 0x47, 0x46, 0x51, 0x5a, 0x53, 0x56, 0x22, 0x06, 0x06,
-    0x0b, 0x13, 0x13, 0x15, 0x1c, 0x13, 0x1c, 0x19, 0x1b, 0x1e, 0x1f, 0x2b,
-    0x2e, 0x36, 0x2b, 0x21, 0x19, 0x1e, 0x2a, 0x2a, 0x21, 0x1c, 0x0b, 0x08,
-    0x06, 0x06, 0x03, 0x03, 0x02, 0x00, 0x00, 0x02, 0x08, 0x0c, 0x0c, 0x08,
-    0x08, 0x03, 0x08, 0x0a, 0x0a, 0x13, 0x13, 0x22, 0x20, 0x2a, 0x28, 0x2a,
-    0x28, 0x1b, 0x10, 0x31, 0x48, 0x49, 0x31, 0x1d, 0x2d, 0x3d, 0x47, 0x3e,
-    0x47, 0x48, 0x40, 0x40, 0x46, 0x5e, 0x4e, 0x40, 0x3d, 0x3d, 0x33, 0x2a,
-    0x2a, 0x1e, 0x28, 0x30, 0x45, 0x47, 0x30, 0x45, 0x51, 0x60, 0x6c, 0x54,
-    0x61, 0x61, 0x5e, 0x4c, 0x4c, 0x4e, 0x25, 0x1e, 0x1e, 0x2b, 0x28, 0x2a,
-    0x1d, 0x1e, 0x28, 0x33, 0x81, 0x86, 0x84, 0x6b, 0x4b, 0x37, 0x30, 0x47,
-    0x37, 0x23, 0x1d, 0x3e, 0x53, 0x23, 0x1b, 0x28, 0x23, 0x23, 0x23, 0x1a,
-    0x1d, 0x28, 0x2e, 0x27, 0x1d, 0x1a, 0x2f, 0x2d, 0x23, 0x30, 0x30, 0x1d,
-    0x14, 0x0a, 0x05, 0x05, 0x03, 0x05, 0x0c, 0x0d, 0x10, 0x14, 0x1c, 0x34,
-    0x67, 0xcf, 0xeb, 0xf0, 0xfe, 0xfe, 0xf7, 0xef, 0xef, 0xf6, 0xf5, 0xf5,
-    0xf6, 0xf6, 0xf6, 0xe8, 0xef, 0xe6, 0xd7, 0xda, 0xc8, 0xd7, 0xdc, 0xc2,
-    0xb6, 0x9c, 0x89, 0x8d, 0xa7, 0xa9, 0xab, 0xca, 0xc9, 0xc9, 0xb5, 0x9c,
-    0x7c, 0x7c, 0x7c, 0x76, 0x76, 0x5b, 0x7c, 0x93, 0x93, 0x93, 0x9c, 0x76,
-    0x76, 0x66, 0x57, 0x58, 0x50, 0x6b, 0x71, 0x57, 0x72, 0x68, 0x57, 0x6b,
-    0x4b, 0x2c, 0x60, 0xaa, 0xbb, 0xa5, 0x9c, 0x94, 0x7c, 0x76, 0x70, 0x7f,
-    0xc9, 0xd7, 0xe6, 0xe6, 0xe6, 0xd8, 0xc1, 0xc2, 0xda, 0xab, 0x79, 0x5c,
-    0x5b, 0x70, 0x7f, 0xbb, 0xb8, 0x88, 0x5b, 0x42, 0x57, 0x82, 0xd7, 0xca,
-    0x96, 0x7f, 0x7f, 0x73, 0x58, 0x4d, 0x58, 0x6b, 0x6b, 0x58, 0x91, 0xd1,
-    0xb7, 0xeb, 0xf7, 0xe9, 0xda, 0xeb, 0xdc, 0x94, 0x94, 0x57, 0x50, 0x50,
-    0x9a, 0xb2, 0xe1, 0xdd, 0xd5, 0xce, 0xbb, 0x97, 0x8c, 0x85, 0x61, 0x47,
-    0x40, 0x2f, 0x35, 0x21, 0x6a, 0x6a, 0x7e, 0x91, 0x9f, 0x7b, 0x4c, 0x40,
-    0x4a, 0x40, 0x4c, 0x64, 0x5e, 0x87, 0x9f, 0x86, 0xa3, 0x98, 0xac, 0xbc,
-    0xce, 0xb2, 0x78, 0x74, 0x9a, 0xaa, 0xbc, 0xce, 0xe1, 0x9d, 0x3d, 0x30,
-    0x45, 0x60, 0x7d, 0x7d, 0x4e, 0x22, 0x0b, 0x08, 0x13, 0x1c, 0x1b, 0x22,
-    0x22, 0x20, 0x1e, 0x1c, 0x14, 0x1f, 0x2b, 0x3e, 0x47, 0x4a, 0x40, 0x2f,
-    0x1e, 0x2f, 0x3d, 0x40, 0x2f, 0x19, 0x0a, 0x0b, 0x0b, 0x08, 0x08, 0x03,
-    0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x03, 0x03, 0x08, 0x13, 0x1c,
-    0x1e, 0x33, 0x2a, 0x33, 0x48, 0x55, 0x47, 0x48, 0x48, 0x2a, 0x31, 0x56,
-    0x48, 0x56, 0x49, 0x2d, 0x28, 0x3d, 0x40, 0x40, 0x2f, 0x40, 0x40, 0x40,
-    0x40, 0x40, 0x31, 0x3d, 0x28, 0x1f, 0x2f, 0x40, 0x2f, 0x2a, 0x2a, 0x2a,
-    0x3e, 0x2d, 0x2d, 0x30, 0x45, 0x45, 0x45, 0x3d, 0x48, 0x64, 0x4e, 0x2a,
-    0x40, 0x33, 0x22, 0x12, 0x20, 0x2a, 0x3d, 0x56, 0x27, 0x28, 0x1b, 0x14,
-    0x33, 0x48, 0x47, 0x2d, 0x3e, 0x1b, 0x2b, 0x47, 0x30, 0x5a, 0x51, 0x44,
-    0x5a, 0x51, 0x51, 0x51, 0x37, 0x44, 0x37, 0x30, 0x28, 0x1b, 0x14, 0x14,
-    0x10, 0x0a, 0x0a, 0x1d, 0x27, 0x27, 0x28, 0x1e, 0x10, 0x0a, 0x05, 0x03,
-    0x03, 0x03, 0x05, 0x0a, 0x10, 0x1b, 0x2a, 0x67, 0xd2, 0xeb, 0xeb, 0xfe,
-    0xfe, 0xf7, 0xf5, 0xf6, 0xf7, 0xfd, 0xf5, 0xf5, 0xf6, 0xf6, 0xef, 0xef,
-    0xda, 0xda, 0xda, 0xda, 0xc1, 0xa7, 0xc8, 0xc2, 0xb5, 0xab, 0xab, 0x79,
-    0x79, 0xa7, 0xc8, 0xd7, 0xeb, 0xdc, 0xc8, 0x9c, 0xa5, 0xa5, 0xab, 0x9c,
-    0x7c, 0x5b, 0x70, 0x9c, 0xc9, 0xca, 0xab, 0x8a, 0x5b, 0x57, 0x57, 0x58,
-    0x5a, 0x74, 0x71, 0x4b, 0x50, 0x43, 0x42, 0x37, 0x23, 0x14, 0x28, 0x75,
-    0x93, 0x7f, 0x71, 0x71, 0x5b, 0x66, 0x57, 0x6b, 0xa8, 0xc9, 0xe6, 0xe6,
-    0xe6, 0xd8, 0xc1, 0xc1, 0xc8, 0xab, 0x8a, 0x7c, 0x5b, 0x4b, 0x82, 0x8c,
-    0x93, 0x7c, 0x5b, 0x4b, 0x57, 0x8c, 0xeb, 0xe9, 0xdc, 0xc9, 0xca, 0xa6,
-    0x97, 0x94, 0x8a, 0x7c, 0x71, 0x72, 0x74, 0x91, 0xbe, 0xeb, 0xeb, 0xea,
-    0xde, 0xdc, 0xca, 0xa6, 0xa8, 0x68, 0x68, 0x58, 0x6f, 0x9f, 0xe1, 0xe1,
-    0xdc, 0xd5, 0xc6, 0xaf, 0x97, 0x84, 0x58, 0x46, 0x47, 0x40, 0x33, 0x14,
-    0x21, 0x35, 0x4c, 0x69, 0x4c, 0x40, 0x2f, 0x2f, 0x4c, 0x4c, 0x47, 0x64,
-    0x6f, 0x87, 0xa0, 0x77, 0x84, 0x84, 0x97, 0xa3, 0x91, 0x6f, 0x54, 0x74,
-    0x84, 0x91, 0xac, 0xd1, 0xd3, 0x80, 0x2d, 0x45, 0x53, 0x78, 0x9d, 0x9d,
-    0x80, 0x6e, 0x26, 0x15, 0x1c, 0x1e, 0x1e, 0x19, 0x21, 0x2a, 0x2a, 0x2a,
-    0x1e, 0x1e, 0x28, 0x3a, 0x46, 0x4a, 0x4a, 0x40, 0x33, 0x4e, 0x4c, 0x4c,
-    0x40, 0x1f, 0x19, 0x1c, 0x1c, 0x12, 0x12, 0x0c, 0x08, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x03, 0x15, 0x1c, 0x2a, 0x3d, 0x40, 0x3d, 0x30,
-    0x45, 0x60, 0x60, 0x60, 0x60, 0x56, 0x48, 0x48, 0x45, 0x53, 0x48, 0x2d,
-    0x28, 0x1e, 0x12, 0x1c, 0x1e, 0x2f, 0x33, 0x33, 0x2f, 0x28, 0x2d, 0x40,
-    0x2b, 0x2b, 0x2f, 0x3d, 0x3d, 0x2a, 0x10, 0x1e, 0x3d, 0x2e, 0x1d, 0x1d,
-    0x2d, 0x45, 0x30, 0x2a, 0x2a, 0x33, 0x33, 0x10, 0x1e, 0x20, 0x13, 0x0a,
-    0x13, 0x20, 0x56, 0x67, 0x55, 0x2e, 0x1a, 0x1a, 0x1d, 0x2a, 0x0a, 0x0a,
-    0x1f, 0x1b, 0x28, 0x2c, 0x37, 0x5a, 0x6b, 0x68, 0x91, 0x7a, 0x6b, 0x4b,
-    0x44, 0x51, 0x51, 0x37, 0x27, 0x1b, 0x1b, 0x14, 0x10, 0x14, 0x1f, 0x14,
-    0x1b, 0x1d, 0x1d, 0x28, 0x2a, 0x0a, 0x05, 0x03, 0x03, 0x05, 0x08, 0x13,
-    0x1c, 0x1d, 0x28, 0xb9, 0xeb, 0xe9, 0xeb, 0xfe, 0xf6, 0xf5, 0xf6, 0xfd,
-    0xfd, 0xf6, 0xf5, 0xf6, 0xef, 0xef, 0xe9, 0xeb, 0xe8, 0xe6, 0xda, 0xc1,
-    0xa7, 0xc8, 0xc9, 0xc9, 0xb5, 0x9c, 0xab, 0x88, 0x76, 0xab, 0xca, 0xd7,
-    0xeb, 0xdd, 0xc8, 0x8a, 0x9c, 0xb5, 0xc9, 0xab, 0x9c, 0x93, 0xa2, 0xc9,
-    0xca, 0xca, 0xc8, 0xb5, 0x76, 0x57, 0x4b, 0x57, 0x82, 0x93, 0x71, 0x4b,
-    0x4b, 0x32, 0x32, 0x37, 0x1d, 0x14, 0x0a, 0x2a, 0x58, 0x57, 0x57, 0x57,
-    0x57, 0x50, 0x43, 0x2c, 0x5a, 0xa8, 0xe8, 0xe9, 0xe8, 0xe8, 0xc1, 0xab,
-    0xa7, 0x9c, 0xa5, 0x7c, 0x70, 0x4b, 0x4b, 0x68, 0x71, 0x71, 0x4b, 0x4b,
-    0x68, 0x82, 0xdc, 0xdd, 0xd7, 0xd8, 0xda, 0xd7, 0xe8, 0xca, 0xa7, 0x7c,
-    0x70, 0x82, 0x71, 0x7b, 0xd2, 0xfa, 0xe9, 0xd7, 0xe9, 0xd5, 0xc9, 0xcc,
-    0xa8, 0x73, 0x58, 0x44, 0x3a, 0x55, 0xb4, 0xdd, 0xd5, 0xd5, 0xd9, 0xbc,
-    0x98, 0x84, 0x6c, 0x5e, 0x4a, 0x36, 0x2f, 0x2b, 0x2f, 0x2b, 0x2f, 0x2f,
-    0x2f, 0x40, 0x4c, 0x36, 0x2e, 0x3e, 0x56, 0x78, 0x64, 0x78, 0x81, 0x78,
-    0x77, 0x75, 0x75, 0x61, 0x4a, 0x4a, 0x54, 0x61, 0x75, 0x84, 0x97, 0xac,
-    0xa0, 0x2f, 0x27, 0x45, 0x45, 0x60, 0x87, 0x7d, 0x7d, 0x80, 0x35, 0x13,
-    0x1c, 0x1e, 0x1b, 0x19, 0x21, 0x2b, 0x40, 0x40, 0x2f, 0x3d, 0x3d, 0x47,
-    0x55, 0x56, 0x55, 0x47, 0x33, 0x4e, 0x4c, 0x4a, 0x36, 0x36, 0x2b, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1c, 0x12, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x03, 0x0b, 0x1e, 0x2e, 0x3e, 0x47, 0x2d, 0x30, 0x5a, 0x77, 0x77, 0x6c,
-    0x51, 0x48, 0x67, 0x64, 0x45, 0x45, 0x30, 0x3d, 0x28, 0x1b, 0x07, 0x13,
-    0x1b, 0x12, 0x1c, 0x20, 0x21, 0x2a, 0x2f, 0x2b, 0x21, 0x1c, 0x13, 0x2a,
-    0x3d, 0x2d, 0x31, 0x67, 0x64, 0x45, 0x45, 0x30, 0x64, 0x60, 0x3e, 0x1a,
-    0x1b, 0x1d, 0x1e, 0x10, 0x1b, 0x1e, 0x13, 0x0c, 0x15, 0x22, 0x4e, 0x67,
-    0x44, 0x37, 0x23, 0x2d, 0x2b, 0x0d, 0x0d, 0x0d, 0x1e, 0x1f, 0x27, 0x55,
-    0x75, 0x6b, 0x84, 0x71, 0x93, 0x72, 0x6b, 0x58, 0x4b, 0x51, 0x44, 0x30,
-    0x28, 0x3d, 0x3e, 0x2e, 0x30, 0x37, 0x44, 0x23, 0x1a, 0x1f, 0x1d, 0x28,
-    0x3d, 0x1b, 0x07, 0x05, 0x03, 0x08, 0x13, 0x35, 0x4c, 0x30, 0x49, 0xe4,
-    0xeb, 0xeb, 0xeb, 0xf7, 0xf6, 0xef, 0xf5, 0xf7, 0xfd, 0xfd, 0xfd, 0xf7,
-    0xf0, 0xe5, 0xe4, 0xeb, 0xe9, 0xdc, 0xda, 0xc8, 0xca, 0xc9, 0xb8, 0xb5,
-    0x89, 0x9c, 0xb8, 0xb8, 0xa5, 0xb5, 0xab, 0xca, 0xd5, 0xc9, 0xb6, 0x8a,
-    0x76, 0xa5, 0xcc, 0xc9, 0x9c, 0x88, 0xa5, 0xb8, 0xca, 0xd7, 0xd7, 0xca,
-    0xab, 0x76, 0x57, 0x70, 0xa6, 0xa6, 0x88, 0x93, 0x82, 0x4b, 0x2c, 0x27,
-    0x14, 0x10, 0x08, 0x05, 0x28, 0x44, 0x43, 0x43, 0x43, 0x44, 0x3e, 0x2c,
-    0x60, 0xeb, 0xf7, 0xf7, 0xe9, 0xe6, 0xc1, 0xc2, 0xc9, 0xcc, 0xbb, 0x93,
-    0xab, 0xa8, 0x82, 0x57, 0x42, 0x4b, 0x42, 0x58, 0x82, 0x7f, 0xaa, 0xd7,
-    0xe6, 0xe8, 0xe6, 0xda, 0xe8, 0xd7, 0xab, 0x94, 0x7c, 0x68, 0x7a, 0x7a,
-    0xae, 0xeb, 0xe9, 0xea, 0xea, 0xd5, 0xc6, 0xbc, 0x97, 0x6b, 0x50, 0x37,
-    0x37, 0x47, 0x69, 0xae, 0xcc, 0xce, 0xe0, 0xce, 0xaa, 0x84, 0x6f, 0x64,
-    0x47, 0x3a, 0x2e, 0x4c, 0x4c, 0x36, 0x29, 0x29, 0x2f, 0x36, 0x47, 0x3e,
-    0x3e, 0x45, 0x55, 0x67, 0x6a, 0x4e, 0x4c, 0x4c, 0x4c, 0x5e, 0x5e, 0x4a,
-    0x36, 0x4a, 0x55, 0x61, 0x75, 0x74, 0x84, 0x77, 0x67, 0x2a, 0x2d, 0x30,
-    0x44, 0x60, 0x77, 0x86, 0x7d, 0x34, 0x13, 0x0a, 0x12, 0x1c, 0x19, 0x14,
-    0x1e, 0x2b, 0x2e, 0x2e, 0x3e, 0x47, 0x55, 0x55, 0x55, 0x4a, 0x55, 0x55,
-    0x4c, 0x40, 0x47, 0x47, 0x47, 0x2d, 0x28, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x21, 0x15, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x03, 0x1e, 0x48,
-    0x45, 0x45, 0x48, 0x53, 0x5a, 0x75, 0x75, 0x6c, 0x5a, 0x53, 0x67, 0x64,
-    0x53, 0x45, 0x30, 0x3d, 0x1e, 0x1c, 0x0a, 0x0a, 0x10, 0x10, 0x10, 0x10,
-    0x14, 0x1e, 0x2a, 0x1e, 0x1c, 0x07, 0x10, 0x28, 0x30, 0x53, 0x56, 0x7d,
-    0x7d, 0x64, 0x60, 0x45, 0x7a, 0x7d, 0x55, 0x37, 0x28, 0x2d, 0x3d, 0x1f,
-    0x1e, 0x2a, 0x22, 0x0b, 0x0c, 0x22, 0x22, 0x22, 0x77, 0x5a, 0x30, 0x3d,
-    0x1f, 0x1b, 0x19, 0x19, 0x2a, 0x40, 0x3e, 0x5a, 0x8c, 0x97, 0x94, 0x93,
-    0x93, 0x82, 0x72, 0x72, 0x6b, 0x4b, 0x30, 0x1d, 0x3d, 0x55, 0x44, 0x37,
-    0x51, 0x58, 0x6b, 0x4b, 0x45, 0x2e, 0x2d, 0x45, 0x45, 0x3d, 0x1c, 0x08,
-    0x05, 0x0a, 0x20, 0x48, 0x56, 0x51, 0x56, 0xd2, 0xe9, 0xeb, 0xe9, 0xeb,
-    0xf6, 0xf7, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfa, 0xf2, 0xf1, 0xf2, 0xeb,
-    0xdc, 0xda, 0xc8, 0xa7, 0xa7, 0xab, 0xa5, 0x9c, 0x8a, 0x9c, 0xc9, 0xca,
-    0xb5, 0xab, 0xab, 0xab, 0xab, 0x9c, 0x8a, 0x76, 0x70, 0x94, 0xb5, 0xa6,
-    0x7c, 0x5b, 0x88, 0xb5, 0xc8, 0xd5, 0xdd, 0xdc, 0xab, 0x7c, 0x7c, 0x7c,
-    0x9c, 0xab, 0xab, 0xb8, 0x93, 0x5a, 0x23, 0x27, 0x1b, 0x0a, 0x07, 0x0a,
-    0x1c, 0x14, 0x1f, 0x1d, 0x2d, 0x27, 0x1d, 0x28, 0xcf, 0xf7, 0xf7, 0xe9,
-    0xe8, 0xe6, 0xd7, 0xd7, 0xd7, 0x9c, 0x94, 0xa8, 0xa8, 0xcc, 0x72, 0x57,
-    0x82, 0x4b, 0x37, 0x4b, 0x74, 0x68, 0x82, 0xdc, 0xf7, 0xe9, 0xd8, 0xc1,
-    0xc8, 0xc1, 0xa7, 0xab, 0x88, 0x68, 0xa2, 0x72, 0x4b, 0xce, 0xea, 0xdc,
-    0xd7, 0xca, 0xb6, 0x97, 0x84, 0x74, 0x58, 0x44, 0x46, 0x47, 0x36, 0x5e,
-    0x91, 0xb7, 0xb7, 0xac, 0x91, 0x75, 0x5e, 0x64, 0x78, 0x55, 0x46, 0x55,
-    0x81, 0x78, 0x55, 0x36, 0x36, 0x3a, 0x46, 0x46, 0x55, 0x56, 0x48, 0x56,
-    0x33, 0x2a, 0x2f, 0x40, 0x2f, 0x4a, 0x56, 0x55, 0x47, 0x47, 0x55, 0x55,
-    0x6f, 0x5e, 0x4c, 0x48, 0x49, 0x49, 0x67, 0x49, 0x56, 0x64, 0x78, 0x87,
-    0xa0, 0x6a, 0x26, 0x0a, 0x0a, 0x12, 0x14, 0x14, 0x1f, 0x28, 0x2e, 0x3e,
-    0x46, 0x51, 0x54, 0x54, 0x54, 0x61, 0x54, 0x61, 0x5e, 0x47, 0x5e, 0x64,
-    0x5e, 0x47, 0x47, 0x40, 0x2f, 0x2d, 0x3d, 0x3d, 0x2a, 0x15, 0x03, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x40, 0x47, 0x47, 0x48, 0x45,
-    0x45, 0x5a, 0x6c, 0x6c, 0x5a, 0x6c, 0x60, 0x5a, 0x60, 0x53, 0x48, 0x2a,
-    0x1b, 0x2a, 0x33, 0x31, 0x2a, 0x2a, 0x2a, 0x1b, 0x1e, 0x1e, 0x2a, 0x2a,
-    0x22, 0x0a, 0x20, 0x3d, 0x48, 0x64, 0x45, 0x64, 0x87, 0x7d, 0x51, 0x5a,
-    0x7a, 0x87, 0x5e, 0x46, 0x47, 0x53, 0x64, 0x33, 0x1e, 0x33, 0x22, 0x15,
-    0x13, 0x13, 0x1c, 0x0c, 0x86, 0x60, 0x64, 0x2e, 0x1e, 0x2a, 0x1e, 0x19,
-    0x2a, 0x4c, 0x78, 0x84, 0xa2, 0xa5, 0xa6, 0x94, 0x94, 0x82, 0x85, 0x72,
-    0x75, 0x5a, 0x1d, 0x1a, 0x2e, 0x44, 0x44, 0x43, 0x50, 0x74, 0x84, 0x71,
-    0x4b, 0x51, 0x51, 0x51, 0x5a, 0x51, 0x45, 0x1c, 0x0a, 0x1c, 0x2d, 0x51,
-    0x6c, 0x58, 0x5a, 0x9f, 0xdc, 0xdc, 0xdc, 0xeb, 0xf7, 0xf9, 0xfe, 0xf9,
-    0xfd, 0xfd, 0xf7, 0xf7, 0xf3, 0xe5, 0xf0, 0xdd, 0xca, 0xc8, 0xc8, 0xc8,
-    0x9c, 0xab, 0x9c, 0x8a, 0x9c, 0x9c, 0xb5, 0xab, 0x8a, 0x76, 0x76, 0x8a,
-    0x8a, 0x8a, 0x76, 0x70, 0x5b, 0x70, 0x7f, 0x7f, 0x70, 0x68, 0x7c, 0x9c,
-    0xab, 0xb5, 0xd5, 0xc9, 0x94, 0x76, 0x70, 0x7c, 0x9c, 0xab, 0xab, 0xca,
-    0xab, 0x94, 0x58, 0x51, 0x28, 0x10, 0x0a, 0x14, 0x14, 0x0d, 0x0d, 0x10,
-    0x10, 0x14, 0x1f, 0x28, 0xdd, 0xe9, 0xe8, 0xe9, 0xe8, 0xda, 0xca, 0xd7,
-    0xab, 0x76, 0x5b, 0x7f, 0x93, 0xaa, 0x57, 0x82, 0x7a, 0x42, 0x4b, 0x37,
-    0x37, 0x44, 0xb2, 0xeb, 0xe9, 0xe9, 0xe6, 0xda, 0xc5, 0xa7, 0xd7, 0xdc,
-    0x9c, 0x93, 0xe1, 0x93, 0x68, 0xbe, 0xdc, 0xdc, 0xd9, 0xc8, 0xa6, 0x94,
-    0x84, 0x75, 0x61, 0x54, 0x54, 0x55, 0x55, 0x5e, 0x5e, 0x40, 0x69, 0x69,
-    0x5e, 0x6f, 0x6f, 0x7e, 0xa0, 0x77, 0x50, 0x4d, 0x77, 0x7e, 0x77, 0x6f,
-    0x54, 0x4d, 0x61, 0x54, 0x5e, 0x67, 0x31, 0x33, 0x2a, 0x1e, 0x1d, 0x2f,
-    0x3d, 0x47, 0x56, 0x67, 0x67, 0x55, 0x4c, 0x40, 0x3d, 0x48, 0x4e, 0x33,
-    0x3d, 0x30, 0x56, 0x67, 0x67, 0x60, 0x87, 0x7d, 0x87, 0x9d, 0x8f, 0x3c,
-    0x13, 0x12, 0x1c, 0x1e, 0x3d, 0x2d, 0x3e, 0x4c, 0x47, 0x4d, 0x4d, 0x58,
-    0x6b, 0x74, 0x63, 0x61, 0x54, 0x51, 0x5e, 0x81, 0x78, 0x61, 0x54, 0x4a,
-    0x2f, 0x2f, 0x3e, 0x40, 0x2a, 0x12, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x10, 0x28, 0x3e, 0x45, 0x30, 0x45, 0x53, 0x44, 0x44, 0x60,
-    0x78, 0x60, 0x51, 0x6c, 0x60, 0x53, 0x45, 0x28, 0x49, 0x56, 0x56, 0x49,
-    0x3d, 0x2d, 0x33, 0x1e, 0x1e, 0x2b, 0x2f, 0x33, 0x21, 0x0a, 0x20, 0x48,
-    0x47, 0x53, 0x53, 0x53, 0x60, 0x51, 0x51, 0x87, 0x7a, 0x60, 0x51, 0x37,
-    0x60, 0x5e, 0x7d, 0x4e, 0x1f, 0x28, 0x33, 0x21, 0x22, 0x13, 0x0a, 0x0b,
-    0x6c, 0x77, 0x56, 0x40, 0x2f, 0x33, 0x1e, 0x1f, 0x36, 0x47, 0x86, 0xa2,
-    0xaf, 0xaf, 0xaf, 0xa6, 0x88, 0x88, 0x82, 0x6b, 0x4b, 0x51, 0x37, 0x1d,
-    0x27, 0x3e, 0x51, 0x4b, 0x57, 0x68, 0x71, 0x74, 0x6b, 0x6b, 0x74, 0x58,
-    0x58, 0x58, 0x44, 0x2a, 0x1c, 0x28, 0x30, 0x50, 0x6c, 0x6b, 0x6c, 0x77,
-    0xce, 0xd5, 0xdd, 0xfa, 0xf9, 0xf7, 0xf9, 0xf6, 0xf6, 0xf6, 0xf5, 0xe7,
-    0xe1, 0xe3, 0xe1, 0xdc, 0xc9, 0xc8, 0xab, 0xb5, 0xb5, 0x94, 0xa5, 0x88,
-    0x8a, 0xab, 0xc9, 0xab, 0x76, 0x70, 0x7c, 0x5c, 0x8a, 0x7c, 0x7c, 0x70,
-    0x68, 0x5b, 0x5b, 0x5b, 0x4b, 0x57, 0x70, 0x76, 0x76, 0x94, 0xa6, 0x94,
-    0x76, 0x5b, 0x70, 0x88, 0xa6, 0xb6, 0xb5, 0xb5, 0xab, 0x9c, 0x71, 0x37,
-    0x1b, 0x0a, 0x0d, 0x1b, 0x1b, 0x14, 0x14, 0x2a, 0x1b, 0x10, 0x1b, 0x28,
-    0xcc, 0xe8, 0xe8, 0xe8, 0xe6, 0xd7, 0xdc, 0xab, 0x8a, 0x7c, 0x5b, 0x4b,
-    0x57, 0x68, 0x68, 0x68, 0x4b, 0x32, 0x7a, 0x58, 0x2c, 0x7d, 0xf0, 0xeb,
-    0xe8, 0xe9, 0xe8, 0xd8, 0xa9, 0xdc, 0xeb, 0xca, 0x89, 0x5b, 0xb1, 0x93,
-    0x7f, 0xaa, 0xbe, 0xca, 0xc8, 0xc5, 0x8e, 0x73, 0x74, 0x75, 0x6c, 0x6f,
-    0x86, 0x75, 0x5a, 0x51, 0x37, 0x27, 0x3d, 0x64, 0x47, 0x7e, 0x75, 0x61,
-    0x86, 0x86, 0x6b, 0x58, 0x75, 0x63, 0x7e, 0x9f, 0x63, 0x74, 0x74, 0x63,
-    0x77, 0x7d, 0x6e, 0x2a, 0x33, 0x33, 0x1f, 0x2e, 0x45, 0x56, 0x56, 0x7d,
-    0x90, 0x67, 0x28, 0x1f, 0x2b, 0x2d, 0x48, 0x2d, 0x1d, 0x23, 0x55, 0x64,
-    0x53, 0x4b, 0x77, 0x7d, 0xa0, 0x9d, 0x9d, 0x8f, 0x22, 0x20, 0x1b, 0x33,
-    0x40, 0x3e, 0x4a, 0x4c, 0x4a, 0x63, 0x63, 0x74, 0x84, 0x85, 0x75, 0x74,
-    0x6b, 0x58, 0x61, 0x64, 0x7e, 0x87, 0x6f, 0x47, 0x2e, 0x2e, 0x36, 0x36,
-    0x2a, 0x12, 0x0b, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1e,
-    0x28, 0x2d, 0x56, 0x7d, 0x78, 0x60, 0x60, 0x78, 0x7d, 0x77, 0x6c, 0x5a,
-    0x58, 0x5a, 0x45, 0x45, 0x67, 0x49, 0x49, 0x48, 0x47, 0x48, 0x3d, 0x1e,
-    0x1e, 0x1f, 0x2f, 0x2a, 0x22, 0x0c, 0x13, 0x33, 0x3d, 0x45, 0x45, 0x60,
-    0x64, 0x6c, 0x7a, 0x9b, 0xa0, 0x77, 0x58, 0x6c, 0x60, 0x51, 0x55, 0x3e,
-    0x2e, 0x4c, 0x33, 0x33, 0x35, 0x25, 0x13, 0x0a, 0x77, 0x53, 0x48, 0x40,
-    0x24, 0x21, 0x1e, 0x40, 0x36, 0x55, 0x91, 0xa2, 0xce, 0xc6, 0xc6, 0xaf,
-    0x94, 0x93, 0x7a, 0x72, 0x44, 0x37, 0x46, 0x3e, 0x3e, 0x44, 0x6c, 0x72,
-    0x68, 0x57, 0x74, 0x85, 0x86, 0x72, 0x74, 0x6c, 0x6b, 0x6b, 0x44, 0x28,
-    0x2a, 0x30, 0x37, 0x43, 0x6b, 0x74, 0x84, 0x84, 0x9a, 0xcc, 0xcf, 0xfa,
-    0xfa, 0xf7, 0xf9, 0xf6, 0xf5, 0xef, 0xe6, 0xd7, 0xd1, 0xd2, 0xdd, 0xd5,
-    0xb8, 0xab, 0x9c, 0x9c, 0xa8, 0xa5, 0x88, 0x7c, 0x8a, 0xab, 0xb5, 0xab,
-    0xb8, 0x7c, 0x88, 0x7c, 0x5b, 0x5b, 0x71, 0x88, 0x88, 0x5b, 0x68, 0x68,
-    0x5a, 0x4b, 0x68, 0x7f, 0x66, 0x7f, 0x71, 0x71, 0x66, 0x5b, 0x7c, 0x94,
-    0x8a, 0xab, 0xb6, 0xc9, 0xc9, 0xb5, 0x7f, 0x2c, 0x14, 0x10, 0x10, 0x1e,
-    0x1d, 0x1a, 0x1d, 0x2d, 0x28, 0x1a, 0x1a, 0x1c, 0xe1, 0xfa, 0xf7, 0xe6,
-    0xe6, 0xd7, 0xca, 0xab, 0x9c, 0x88, 0x7f, 0x71, 0x42, 0x6b, 0x71, 0x71,
-    0x68, 0x42, 0x7a, 0x72, 0x72, 0xe1, 0xf0, 0xeb, 0xe9, 0xdc, 0xe6, 0xd8,
-    0xc8, 0xe1, 0xdc, 0xb6, 0x76, 0x5b, 0x74, 0xa2, 0xa2, 0xa2, 0x77, 0x74,
-    0x96, 0x96, 0x83, 0x84, 0x84, 0x85, 0x85, 0xb1, 0x93, 0x68, 0x57, 0x4b,
-    0x6c, 0x51, 0x30, 0x64, 0x48, 0x7d, 0x86, 0x61, 0x86, 0xa3, 0x84, 0x85,
-    0x9f, 0x91, 0x9f, 0x9f, 0x91, 0x85, 0x74, 0x74, 0x77, 0x7d, 0x6e, 0x20,
-    0x33, 0x33, 0x1f, 0x2e, 0x53, 0x67, 0x64, 0x64, 0x90, 0x90, 0x34, 0x1f,
-    0x2d, 0x28, 0x28, 0x2d, 0x1d, 0x3e, 0x55, 0x55, 0x51, 0x6c, 0x86, 0x87,
-    0x9a, 0xb4, 0x9d, 0x35, 0x1c, 0x1e, 0x1a, 0x2f, 0x3e, 0x3a, 0x46, 0x36,
-    0x54, 0x63, 0x63, 0x75, 0x84, 0x91, 0x74, 0x75, 0x7b, 0x75, 0x61, 0x6f,
-    0x78, 0x77, 0x75, 0x47, 0x2e, 0x28, 0x2f, 0x2b, 0x1e, 0x12, 0x0c, 0x0b,
-    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x1b, 0x31, 0x56, 0x7d,
-    0x78, 0x77, 0x60, 0x77, 0x78, 0x77, 0x7a, 0x6c, 0x6c, 0x87, 0x78, 0x64,
-    0x7d, 0x6e, 0x49, 0x48, 0x47, 0x48, 0x2f, 0x2b, 0x1e, 0x1e, 0x21, 0x22,
-    0x1c, 0x0c, 0x08, 0x13, 0x1e, 0x28, 0x3d, 0x7d, 0x9d, 0x87, 0x6c, 0x7a,
-    0x9a, 0x86, 0x6c, 0x9a, 0x87, 0x86, 0x64, 0x5e, 0x64, 0x67, 0x4e, 0x33,
-    0x52, 0x22, 0x1c, 0x13, 0x5a, 0x47, 0x47, 0x2f, 0x19, 0x24, 0x2a, 0x40,
-    0x36, 0x56, 0x9f, 0xbc, 0xce, 0xce, 0xbb, 0xaf, 0x94, 0x82, 0x6b, 0x5a,
-    0x44, 0x1d, 0x27, 0x3e, 0x51, 0x50, 0x58, 0x84, 0x82, 0x82, 0x94, 0x82,
-    0x72, 0x72, 0x68, 0x4b, 0x50, 0x50, 0x37, 0x30, 0x30, 0x51, 0x51, 0x4b,
-    0x58, 0x6b, 0x84, 0x82, 0x7a, 0xb4, 0xeb, 0xfa, 0xfe, 0xf7, 0xe9, 0xe6,
-    0xea, 0xf5, 0xea, 0xdc, 0xe1, 0xe1, 0xcc, 0xbb, 0xa5, 0x94, 0x88, 0x88,
-    0x94, 0xa2, 0x93, 0x88, 0x9c, 0xb5, 0xdd, 0xd5, 0x9c, 0xb1, 0xb8, 0x88,
-    0x7f, 0x68, 0x93, 0xbb, 0xa8, 0x88, 0x7c, 0x71, 0x8c, 0x4b, 0x42, 0x57,
-    0x57, 0x68, 0x66, 0x57, 0x42, 0x32, 0x5b, 0x7f, 0x88, 0x9c, 0xb5, 0xd5,
-    0xce, 0xa5, 0x71, 0x2c, 0x1d, 0x1b, 0x14, 0x2a, 0x3d, 0x30, 0x23, 0x30,
-    0x23, 0x30, 0x27, 0x1b, 0xb2, 0xf0, 0xeb, 0xe6, 0xd7, 0xca, 0xb5, 0xa5,
-    0xa5, 0x8c, 0x82, 0x6b, 0x42, 0x4b, 0x6b, 0xa2, 0x6b, 0x4b, 0x6c, 0x6b,
-    0x6b, 0xb1, 0xcf, 0xeb, 0xf7, 0xe6, 0xda, 0xe8, 0xdd, 0xd5, 0x9c, 0x88,
-    0xa5, 0x94, 0x71, 0x85, 0x75, 0x74, 0x50, 0x27, 0x46, 0x58, 0x6b, 0xae,
-    0xb2, 0xcc, 0xb1, 0xcf, 0xa5, 0x7f, 0x5b, 0x58, 0x9a, 0x77, 0x2c, 0x3e,
-    0x3e, 0x56, 0x86, 0x61, 0x9f, 0xb2, 0x8c, 0xac, 0xd3, 0xae, 0xae, 0xa3,
-    0xbe, 0xa3, 0x8c, 0x86, 0x86, 0x7d, 0x34, 0x1b, 0x33, 0x2b, 0x1d, 0x2e,
-    0x55, 0x64, 0x64, 0x7d, 0x9d, 0x90, 0x4f, 0x28, 0x1d, 0x3d, 0x31, 0x2a,
-    0x28, 0x3e, 0x3d, 0x45, 0x44, 0x6c, 0x87, 0x87, 0x9a, 0xa0, 0x9d, 0x34,
-    0x14, 0x14, 0x1a, 0x1d, 0x2e, 0x3a, 0x46, 0x36, 0x4d, 0x6b, 0x74, 0x74,
-    0x73, 0x74, 0x74, 0x75, 0x75, 0x74, 0x61, 0x61, 0x61, 0x61, 0x61, 0x47,
-    0x47, 0x40, 0x2b, 0x1f, 0x19, 0x10, 0x0a, 0x13, 0x06, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x05, 0x20, 0x67, 0x67, 0x64, 0x60, 0x87, 0x86, 0x6c,
-    0x6b, 0x7a, 0x75, 0x7a, 0x8c, 0x87, 0x87, 0x64, 0x81, 0x6d, 0x3d, 0x30,
-    0x47, 0x3d, 0x2b, 0x33, 0x19, 0x1c, 0x1c, 0x0b, 0x0b, 0x0b, 0x0b, 0x07,
-    0x10, 0x2a, 0x56, 0x7d, 0x9d, 0x78, 0x6c, 0x7a, 0x8c, 0x8c, 0x9a, 0xb2,
-    0x9f, 0x91, 0x91, 0x9f, 0x78, 0x64, 0x4e, 0x22, 0x35, 0x22, 0x1c, 0x20,
-    0x5e, 0x47, 0x40, 0x1e, 0x19, 0x19, 0x21, 0x21, 0x24, 0x69, 0x9f, 0xbe,
-    0xac, 0xbc, 0xa2, 0x97, 0x7f, 0x6b, 0x51, 0x44, 0x2e, 0x14, 0x1f, 0x2d,
-    0x5e, 0x6b, 0x58, 0x82, 0x97, 0x7f, 0x94, 0x7f, 0x7f, 0x72, 0x7a, 0x58,
-    0x51, 0x44, 0x30, 0x37, 0x51, 0x58, 0x58, 0x6c, 0x58, 0x6b, 0x75, 0x7a,
-    0x7a, 0xd4, 0xfa, 0xfa, 0xf7, 0xe9, 0xea, 0xe6, 0xf7, 0xf0, 0xeb, 0xdd,
-    0xdc, 0xc6, 0xbb, 0xa5, 0x93, 0x94, 0x7f, 0x7f, 0x93, 0xaa, 0x93, 0x7f,
-    0x9c, 0xa5, 0xc9, 0xb8, 0xa6, 0xa8, 0xa5, 0xa6, 0xa5, 0x71, 0xa5, 0xcf,
-    0xb8, 0x94, 0x70, 0x7f, 0x82, 0x72, 0x72, 0x57, 0x32, 0x42, 0x4b, 0x42,
-    0x2c, 0x4b, 0x57, 0x68, 0x94, 0xa6, 0xa6, 0xbb, 0xbb, 0x94, 0x68, 0x3e,
-    0x28, 0x1f, 0x14, 0x28, 0x3e, 0x30, 0x30, 0x30, 0x45, 0x53, 0x45, 0x30,
-    0x60, 0xeb, 0xeb, 0xd7, 0xc8, 0xb5, 0x93, 0x94, 0x7f, 0x68, 0x57, 0x6c,
-    0x6c, 0x42, 0x6c, 0x75, 0x37, 0x51, 0x6c, 0x58, 0x58, 0x75, 0x86, 0xeb,
-    0xeb, 0xda, 0xe6, 0xeb, 0xd5, 0xa7, 0x9c, 0xa5, 0x88, 0x71, 0x50, 0x43,
-    0x58, 0x58, 0x51, 0x23, 0x23, 0x47, 0x55, 0xd2, 0xcf, 0xdd, 0xbb, 0xcf,
-    0xbb, 0x88, 0x70, 0x8c, 0xb2, 0x87, 0x4b, 0x44, 0x46, 0x3e, 0x5e, 0x5e,
-    0xb2, 0xb2, 0x91, 0xae, 0xd2, 0xd1, 0xd1, 0xbe, 0xbc, 0xac, 0xa3, 0x91,
-    0x9a, 0x81, 0x33, 0x1f, 0x3d, 0x3d, 0x2e, 0x3e, 0x45, 0x44, 0x6c, 0x9d,
-    0x9d, 0x9d, 0x80, 0x49, 0x3d, 0x56, 0x4f, 0x3d, 0x49, 0x48, 0x56, 0x67,
-    0x64, 0x78, 0x87, 0x9b, 0x9a, 0xa0, 0xb9, 0x4f, 0x1b, 0x1b, 0x2d, 0x2d,
-    0x36, 0x36, 0x46, 0x4d, 0x58, 0x73, 0x84, 0x83, 0x83, 0x83, 0x84, 0x7b,
-    0x63, 0x63, 0x63, 0x46, 0x44, 0x4d, 0x54, 0x36, 0x47, 0x48, 0x2a, 0x1e,
-    0x1c, 0x12, 0x12, 0x12, 0x0b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x22,
-    0x56, 0x64, 0x56, 0x53, 0x60, 0xa0, 0xa0, 0x86, 0x7a, 0xa0, 0x9f, 0x7a,
-    0x82, 0x85, 0x77, 0x77, 0x64, 0x4c, 0x45, 0x3d, 0x3d, 0x28, 0x2b, 0x1e,
-    0x1c, 0x1c, 0x12, 0x08, 0x08, 0x0b, 0x13, 0x0b, 0x12, 0x31, 0x67, 0x64,
-    0x60, 0x6c, 0x58, 0x86, 0x9b, 0x9a, 0xb1, 0xae, 0x8c, 0x7f, 0x84, 0xac,
-    0x9f, 0x81, 0x4e, 0x35, 0x22, 0x1c, 0x1c, 0x1e, 0x69, 0x40, 0x21, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x1e, 0x69, 0x78, 0xa0, 0x9f, 0x91, 0x84, 0x74,
-    0x58, 0x51, 0x3e, 0x3e, 0x1f, 0x14, 0x1f, 0x27, 0x5e, 0x74, 0x71, 0x7f,
-    0x94, 0x88, 0x7c, 0xa2, 0x8c, 0x86, 0x9a, 0x86, 0x86, 0x60, 0x37, 0x44,
-    0x6c, 0x6b, 0x58, 0x6b, 0x72, 0x72, 0x85, 0x7a, 0x8c, 0xe4, 0xfa, 0xfa,
-    0xf7, 0xf9, 0xf6, 0xe6, 0xea, 0xea, 0xd9, 0xd7, 0xca, 0xa6, 0x94, 0x94,
-    0x7f, 0x71, 0x71, 0x71, 0x75, 0x8c, 0x5b, 0xa2, 0x93, 0x88, 0xa5, 0x88,
-    0xa5, 0xaa, 0x70, 0x5b, 0x70, 0x70, 0x82, 0xaa, 0x94, 0x70, 0x5b, 0x7c,
-    0xa8, 0x93, 0x93, 0x93, 0x42, 0x4b, 0x57, 0x58, 0x2c, 0x58, 0x58, 0x57,
-    0x7f, 0x7f, 0x7f, 0x94, 0x7f, 0x68, 0x43, 0x2e, 0x27, 0x1d, 0x28, 0x30,
-    0x30, 0x37, 0x30, 0x37, 0x53, 0x60, 0x5a, 0x51, 0x45, 0xb2, 0xdd, 0xd5,
-    0xa6, 0xa6, 0xa2, 0x8c, 0x84, 0x58, 0x75, 0x86, 0x6c, 0x51, 0x5a, 0x44,
-    0x37, 0x30, 0x46, 0x46, 0x53, 0x45, 0xb2, 0xdd, 0xe7, 0xda, 0xda, 0xe6,
-    0xc8, 0xa7, 0xa6, 0xa5, 0x94, 0x71, 0x58, 0x43, 0x43, 0x27, 0x47, 0x30,
-    0x23, 0x2e, 0x1b, 0xb4, 0xa2, 0xbb, 0xaa, 0xcf, 0xd5, 0x8a, 0x94, 0x82,
-    0x85, 0x91, 0x58, 0x86, 0x77, 0x3a, 0x46, 0x2e, 0xa0, 0xae, 0x91, 0xb7,
-    0xd2, 0xd2, 0xce, 0xbc, 0xbc, 0xbb, 0xaa, 0x91, 0x87, 0x6a, 0x35, 0x1f,
-    0x4c, 0x6a, 0x56, 0x45, 0x67, 0x64, 0x6c, 0x87, 0x9d, 0xb9, 0x80, 0x6a,
-    0x4e, 0x56, 0x4c, 0x3d, 0x67, 0x6e, 0x53, 0x7d, 0x9d, 0x78, 0x87, 0x9d,
-    0x9d, 0xb4, 0xb9, 0x6e, 0x2a, 0x28, 0x2d, 0x2f, 0x2f, 0x36, 0x54, 0x61,
-    0x61, 0x74, 0x83, 0x97, 0x84, 0x84, 0x83, 0x74, 0x6b, 0x58, 0x61, 0x54,
-    0x43, 0x54, 0x47, 0x47, 0x55, 0x55, 0x3e, 0x2f, 0x1c, 0x1c, 0x1c, 0x1c,
-    0x13, 0x05, 0x02, 0x00, 0x00, 0x02, 0x13, 0x2a, 0x56, 0x67, 0x7d, 0x87,
-    0x78, 0x87, 0x86, 0x82, 0x8c, 0xb2, 0x9a, 0x82, 0x68, 0x7a, 0x72, 0x6b,
-    0x5a, 0x55, 0x56, 0x64, 0x56, 0x49, 0x49, 0x33, 0x2a, 0x2a, 0x22, 0x13,
-    0x0b, 0x0a, 0x13, 0x13, 0x13, 0x34, 0x7d, 0x64, 0x53, 0x7a, 0x7a, 0x9b,
-    0x9d, 0xb1, 0xa2, 0xa2, 0x93, 0xa2, 0xa2, 0x85, 0xa3, 0xa0, 0x80, 0x4e,
-    0x35, 0x15, 0x15, 0x1b, 0x1f, 0x1f, 0x19, 0x19, 0x24, 0x1e, 0x1e, 0x1e,
-    0x33, 0x2f, 0x4c, 0x69, 0x81, 0x78, 0x5e, 0x61, 0x55, 0x3e, 0x2e, 0x2f,
-    0x1e, 0x1e, 0x3e, 0x47, 0x50, 0x71, 0x7f, 0x7c, 0x88, 0x94, 0x94, 0xaa,
-    0x93, 0x85, 0x86, 0x75, 0x75, 0x75, 0x5a, 0x51, 0x5a, 0x6b, 0x58, 0x68,
-    0x68, 0x72, 0x82, 0x72, 0x9a, 0xf7, 0xf7, 0xea, 0xed, 0xf7, 0xf6, 0xe6,
-    0xd7, 0xc8, 0xc8, 0xc8, 0xad, 0x8e, 0x7f, 0x71, 0x73, 0x73, 0x68, 0x68,
-    0x75, 0x8c, 0x88, 0xa5, 0x7c, 0x93, 0x8c, 0x5b, 0x72, 0x72, 0x68, 0x71,
-    0xb8, 0xa8, 0x71, 0x71, 0x71, 0x5b, 0x7f, 0x94, 0xab, 0xa5, 0xa6, 0x7f,
-    0x37, 0x32, 0x42, 0x58, 0x61, 0x2c, 0x44, 0x43, 0x6b, 0x72, 0x72, 0x66,
-    0x57, 0x43, 0x37, 0x1d, 0x1d, 0x27, 0x45, 0x44, 0x45, 0x53, 0x53, 0x44,
-    0x53, 0x60, 0x5a, 0x60, 0x60, 0x6f, 0xae, 0xbc, 0xaf, 0x7f, 0x84, 0x85,
-    0x58, 0x50, 0x5a, 0x51, 0x37, 0x60, 0x6c, 0x44, 0x47, 0x3d, 0x4a, 0x47,
-    0x56, 0x87, 0xf0, 0xeb, 0xe6, 0xda, 0xda, 0xc8, 0xb6, 0xab, 0x94, 0x7f,
-    0x7f, 0x73, 0x58, 0x50, 0x51, 0x37, 0x75, 0x75, 0x27, 0x27, 0x1a, 0x3d,
-    0x77, 0x85, 0xce, 0xdd, 0xc6, 0xa6, 0xbb, 0x94, 0x71, 0x73, 0x58, 0x86,
-    0x86, 0x3a, 0x51, 0x47, 0x4c, 0x7e, 0xa0, 0xd3, 0xd2, 0xe1, 0xbe, 0xbc,
-    0xbc, 0xbc, 0xaa, 0x91, 0x5e, 0x2b, 0x35, 0x2f, 0x3d, 0x6a, 0x56, 0x46,
-    0x7d, 0x7d, 0x77, 0x87, 0xb4, 0xb9, 0x80, 0x6a, 0x6a, 0x6a, 0x2f, 0x28,
-    0x48, 0x80, 0x56, 0x78, 0x9d, 0x60, 0x72, 0x9f, 0x9d, 0xb4, 0xd4, 0x8f,
-    0x34, 0x2d, 0x36, 0x2f, 0x24, 0x29, 0x6f, 0x78, 0x91, 0x91, 0x84, 0x85,
-    0x8c, 0x91, 0x83, 0x73, 0x73, 0x74, 0x75, 0x75, 0x61, 0x5e, 0x56, 0x69,
-    0x5e, 0x5e, 0x55, 0x40, 0x22, 0x22, 0x21, 0x21, 0x12, 0x06, 0x02, 0x00,
-    0x00, 0x03, 0x1c, 0x2a, 0x56, 0x7d, 0x78, 0x87, 0x78, 0x75, 0x82, 0x71,
-    0x82, 0xae, 0xa2, 0x82, 0x82, 0xb1, 0xa2, 0x7a, 0x9b, 0x9d, 0x78, 0x78,
-    0x9d, 0x6a, 0x6a, 0x4e, 0x3d, 0x33, 0x33, 0x22, 0x13, 0x0a, 0x13, 0x13,
-    0x0a, 0x20, 0x67, 0x56, 0x48, 0x87, 0x9b, 0x9b, 0x9a, 0x82, 0xa2, 0xa2,
-    0xa2, 0xbb, 0xb1, 0xa2, 0x86, 0x87, 0x81, 0x6e, 0x4f, 0x0b, 0x15, 0x1e,
-    0x27, 0x2e, 0x28, 0x25, 0x2f, 0x2d, 0x2b, 0x28, 0x3d, 0x28, 0x2a, 0x33,
-    0x33, 0x33, 0x4e, 0x2f, 0x2f, 0x2f, 0x2b, 0x21, 0x19, 0x33, 0x55, 0x61,
-    0x84, 0x84, 0xaa, 0xa8, 0xa8, 0xb8, 0xaa, 0x93, 0x7f, 0x68, 0x68, 0x57,
-    0x4b, 0x58, 0x51, 0x51, 0x44, 0x51, 0x58, 0x68, 0x71, 0x7f, 0x71, 0x71,
-    0xd2, 0xf9, 0xea, 0xe7, 0xed, 0xeb, 0xf6, 0xef, 0xd7, 0xca, 0xb6, 0xad,
-    0x8e, 0x7f, 0x71, 0x71, 0x73, 0x6b, 0x75, 0x6c, 0x58, 0x75, 0xa2, 0xb1,
-    0xa2, 0xa2, 0x7a, 0x58, 0x32, 0x7a, 0xaa, 0x9c, 0xa5, 0xa8, 0x68, 0x68,
-    0x4b, 0x57, 0x7f, 0x93, 0xb5, 0xb5, 0xa6, 0x88, 0x68, 0x4b, 0x4b, 0x4b,
-    0x4d, 0x43, 0x37, 0x42, 0x42, 0x4b, 0x4b, 0x42, 0x43, 0x2c, 0x3e, 0x1b,
-    0x1b, 0x47, 0x55, 0x51, 0x44, 0x53, 0x5a, 0x51, 0x5a, 0x77, 0x6c, 0x78,
-    0x64, 0x45, 0x56, 0x78, 0x86, 0x6b, 0x6b, 0x58, 0x5a, 0x51, 0x51, 0x51,
-    0x54, 0x6f, 0x47, 0x48, 0x21, 0x35, 0x4c, 0x4c, 0x33, 0xb4, 0xf0, 0xf0,
-    0xe9, 0xea, 0xe6, 0xc8, 0xb6, 0xb5, 0x9c, 0x70, 0x7f, 0x57, 0x43, 0x43,
-    0x46, 0x46, 0x54, 0x54, 0x46, 0x2c, 0x3a, 0x1a, 0x2e, 0x78, 0xe1, 0xe0,
-    0xaf, 0xa6, 0xce, 0xbb, 0x7f, 0x97, 0x84, 0x75, 0x91, 0x50, 0x5a, 0x53,
-    0x3e, 0x33, 0x4e, 0xa0, 0xb7, 0xd3, 0xbe, 0xbc, 0xbe, 0xac, 0xa3, 0x6f,
-    0x36, 0x24, 0x2f, 0x36, 0x3e, 0x3e, 0x3e, 0x43, 0x5a, 0x87, 0x86, 0x9f,
-    0xb4, 0xb9, 0x67, 0x3d, 0x4c, 0x48, 0x2f, 0x27, 0x2e, 0x48, 0x67, 0x5e,
-    0x7d, 0x77, 0x74, 0x85, 0x9d, 0xb4, 0xb4, 0xb9, 0x4f, 0x28, 0x2e, 0x27,
-    0x2f, 0x3d, 0x77, 0x91, 0x91, 0xa3, 0xa2, 0xa2, 0xa3, 0x91, 0x74, 0x63,
-    0x63, 0x84, 0x7b, 0x6f, 0x5e, 0x69, 0x6d, 0x6a, 0x5e, 0x5e, 0x4c, 0x2f,
-    0x21, 0x19, 0x1e, 0x1e, 0x12, 0x08, 0x02, 0x00, 0x00, 0x03, 0x13, 0x20,
-    0x49, 0x56, 0x60, 0x87, 0x87, 0x86, 0x8c, 0xa2, 0x8c, 0xae, 0xa2, 0xa2,
-    0xb1, 0xb4, 0x86, 0x8c, 0xb7, 0x81, 0x60, 0x87, 0x9d, 0x4e, 0x56, 0x56,
-    0x55, 0x4e, 0x33, 0x33, 0x20, 0x1c, 0x10, 0x13, 0x0a, 0x20, 0x31, 0x31,
-    0x49, 0x78, 0x78, 0x87, 0xa0, 0xaa, 0xb1, 0xac, 0xaa, 0xaa, 0xaa, 0xaa,
-    0x86, 0x86, 0x7d, 0x6e, 0x3c, 0x15, 0x15, 0x2a, 0x55, 0x5e, 0x55, 0x3e,
-    0x48, 0x6f, 0x47, 0x27, 0x1d, 0x1d, 0x1b, 0x10, 0x1e, 0x1e, 0x2a, 0x2b,
-    0x2a, 0x1e, 0x19, 0x19, 0x21, 0x33, 0x47, 0x5a, 0x84, 0xaa, 0xce, 0xce,
-    0xc6, 0xa5, 0xa8, 0xa8, 0xa2, 0x82, 0x72, 0x5a, 0x51, 0x50, 0x3a, 0x2e,
-    0x46, 0x51, 0x6b, 0x74, 0x82, 0x82, 0x7f, 0x82, 0xd2, 0xf6, 0xe6, 0xf6,
-    0xea, 0xeb, 0xfa, 0xe6, 0xd7, 0xd5, 0xa6, 0x8e, 0x96, 0x83, 0x71, 0x71,
-    0x73, 0x6b, 0x77, 0x77, 0x51, 0x58, 0x85, 0x85, 0x8c, 0x86, 0x4b, 0x58,
-    0x72, 0x7f, 0xa2, 0xa5, 0x9c, 0x93, 0x88, 0x4b, 0x32, 0x57, 0x7f, 0xa5,
-    0xbb, 0xc6, 0xa5, 0x94, 0x7f, 0x68, 0x57, 0x7f, 0x82, 0x85, 0x44, 0x32,
-    0x4b, 0x32, 0x2c, 0x2c, 0x2c, 0x2c, 0x53, 0x2d, 0x1b, 0x2e, 0x3e, 0x37,
-    0x44, 0x51, 0x37, 0x51, 0x77, 0x77, 0x6c, 0x60, 0x5e, 0x44, 0x1d, 0x1c,
-    0x1c, 0x40, 0x4a, 0x2b, 0x40, 0x40, 0x4c, 0x3e, 0x47, 0x2f, 0x2a, 0x1c,
-    0x0c, 0x09, 0x18, 0x18, 0x0c, 0x4f, 0xd4, 0xfa, 0xfa, 0xeb, 0xdd, 0xd5,
-    0xb6, 0xa6, 0x7f, 0x82, 0x93, 0x71, 0x43, 0x37, 0x3a, 0x46, 0x2e, 0x2e,
-    0x46, 0x46, 0x54, 0x27, 0x2d, 0xb4, 0xd3, 0xd2, 0xaf, 0x8e, 0xc6, 0xc6,
-    0x96, 0xce, 0x83, 0xaa, 0x91, 0x50, 0x5a, 0x53, 0x56, 0x56, 0x2a, 0x4e,
-    0x69, 0x81, 0x9f, 0x9f, 0x91, 0x86, 0x6f, 0x55, 0x36, 0x36, 0x4c, 0x55,
-    0x48, 0x47, 0x54, 0x5a, 0x58, 0x86, 0xa0, 0x91, 0xb4, 0xb9, 0x6a, 0x2d,
-    0x2b, 0x40, 0x36, 0x2e, 0x55, 0x47, 0x78, 0x7d, 0x64, 0x78, 0xa0, 0x9f,
-    0xb4, 0xb4, 0xb4, 0xb4, 0x8f, 0x31, 0x28, 0x28, 0x56, 0x54, 0x6b, 0x84,
-    0x97, 0x97, 0xac, 0xae, 0xae, 0x9f, 0x91, 0x61, 0x61, 0x75, 0x74, 0x61,
-    0x54, 0x69, 0x4e, 0x40, 0x47, 0x4a, 0x35, 0x1c, 0x12, 0x19, 0x19, 0x1c,
-    0x09, 0x03, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x13, 0x1e, 0x2d, 0x45, 0xa0,
-    0x9f, 0xa2, 0x9a, 0xb4, 0xb2, 0xb2, 0xb2, 0xb4, 0xae, 0x8c, 0x72, 0x84,
-    0x86, 0x6b, 0x58, 0x77, 0x6a, 0x48, 0x55, 0x55, 0x47, 0x4e, 0x40, 0x2d,
-    0x33, 0x20, 0x10, 0x12, 0x12, 0x1c, 0x20, 0x1c, 0x31, 0x78, 0x64, 0xa0,
-    0x9b, 0x9a, 0xa2, 0xaa, 0xbb, 0xbe, 0xbc, 0xac, 0x91, 0x78, 0x6a, 0x4f,
-    0x35, 0x22, 0x22, 0x20, 0x61, 0x6f, 0x86, 0x6b, 0x75, 0x85, 0x50, 0x37,
-    0x47, 0x47, 0x30, 0x1b, 0x1e, 0x1f, 0x1f, 0x21, 0x21, 0x19, 0x19, 0x1c,
-    0x35, 0x2f, 0x69, 0x75, 0x85, 0xae, 0xce, 0xce, 0xcc, 0xa5, 0xa5, 0xaa,
-    0x9a, 0x7a, 0x85, 0x60, 0x53, 0x30, 0x27, 0x28, 0x5e, 0x61, 0x75, 0x72,
-    0x82, 0x82, 0x8c, 0xa2, 0xb2, 0xdc, 0xe8, 0xfa, 0xdd, 0xdd, 0xeb, 0xda,
-    0xdd, 0xdd, 0xca, 0x93, 0xa2, 0x97, 0x73, 0x74, 0x75, 0x61, 0x54, 0x53,
-    0x44, 0x50, 0x4b, 0x43, 0x5a, 0x77, 0x7a, 0x7a, 0x72, 0x7f, 0x93, 0xa8,
-    0x93, 0x93, 0x72, 0x4b, 0x37, 0x6b, 0x72, 0x93, 0x93, 0x84, 0x94, 0x71,
-    0x68, 0x82, 0x82, 0x94, 0x94, 0x8c, 0x72, 0x5a, 0x23, 0x23, 0x23, 0x23,
-    0x27, 0x45, 0x51, 0x46, 0x28, 0x1d, 0x27, 0x44, 0x5a, 0x5a, 0x44, 0x45,
-    0x64, 0x77, 0x6c, 0x54, 0x51, 0x2e, 0x1e, 0x0a, 0x03, 0x09, 0x0c, 0x0b,
-    0x0c, 0x0a, 0x0a, 0x1c, 0x21, 0x0d, 0x0c, 0x09, 0x03, 0x02, 0x02, 0x02,
-    0x05, 0x09, 0xb9, 0xfa, 0xf7, 0xea, 0xd9, 0xb6, 0x89, 0x7f, 0x97, 0x85,
-    0x97, 0x73, 0x43, 0x46, 0x46, 0x2e, 0x2e, 0x3e, 0x47, 0x55, 0x5e, 0x3e,
-    0x3e, 0x9d, 0x86, 0x91, 0xbc, 0xce, 0xdd, 0xd5, 0xbc, 0xce, 0x8e, 0x96,
-    0x84, 0x6b, 0x6c, 0x60, 0x56, 0x64, 0x2a, 0x33, 0x4e, 0x2f, 0x4c, 0x4c,
-    0x69, 0x55, 0x55, 0x5e, 0x4a, 0x36, 0x4a, 0x5e, 0x47, 0x3a, 0x61, 0x7e,
-    0x86, 0x85, 0x91, 0x9a, 0xb4, 0xb9, 0x6e, 0x3d, 0x2f, 0x2f, 0x36, 0x4a,
-    0x5e, 0x47, 0x78, 0x9d, 0x80, 0x6f, 0x87, 0xa0, 0xa0, 0xb4, 0xb4, 0xb4,
-    0xb4, 0x4e, 0x2d, 0x2d, 0x5e, 0x58, 0x73, 0x83, 0x94, 0x96, 0xa3, 0xae,
-    0xb7, 0x9f, 0x7b, 0x6f, 0x86, 0x78, 0x61, 0x61, 0x5e, 0x4c, 0x40, 0x3d,
-    0x2d, 0x2b, 0x21, 0x1c, 0x15, 0x0c, 0x0c, 0x05, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x03, 0x0b, 0x13, 0x1c, 0x2a, 0x48, 0x9b, 0x86, 0x8c, 0x9a, 0xb4,
-    0xb4, 0xb2, 0xbe, 0xbe, 0xa2, 0xae, 0x9f, 0xa0, 0x77, 0x85, 0x86, 0x5e,
-    0x55, 0x47, 0x4c, 0x40, 0x40, 0x33, 0x3d, 0x40, 0x33, 0x34, 0x1c, 0x1c,
-    0x1c, 0x1c, 0x0d, 0x10, 0x1c, 0x31, 0x48, 0x7d, 0x7d, 0x77, 0x8c, 0xa2,
-    0xac, 0xbe, 0xae, 0x9f, 0x78, 0x80, 0x4f, 0x3c, 0x3c, 0x3c, 0x3c, 0x20,
-    0x86, 0x86, 0xa2, 0x8c, 0x71, 0x68, 0x58, 0x43, 0x51, 0x61, 0x30, 0x27,
-    0x1d, 0x1d, 0x1f, 0x1e, 0x21, 0x19, 0x19, 0x25, 0x35, 0x2f, 0x6a, 0x77,
-    0xa3, 0xcf, 0xbb, 0xc6, 0xc6, 0xb8, 0xaa, 0xa2, 0x8c, 0x6c, 0x61, 0x61,
-    0x53, 0x28, 0x1f, 0x2f, 0x47, 0x58, 0x6b, 0x72, 0x7f, 0x8c, 0x9a, 0x9a,
-    0xb2, 0xaa, 0xcc, 0xfa, 0xeb, 0xe9, 0xdd, 0xd9, 0xc6, 0xd5, 0xbb, 0xaa,
-    0xaa, 0xa2, 0x75, 0x81, 0x7d, 0x77, 0x50, 0x75, 0x6b, 0x50, 0x5a, 0x43,
-    0x5a, 0xa0, 0xb4, 0x86, 0x68, 0x7f, 0x93, 0xaa, 0x94, 0x7f, 0x71, 0x82,
-    0x4b, 0x50, 0x58, 0x71, 0x71, 0x71, 0x71, 0x57, 0x57, 0x82, 0x93, 0x94,
-    0xa6, 0x71, 0x57, 0x75, 0x23, 0x1a, 0x27, 0x27, 0x3e, 0x55, 0x51, 0x2c,
-    0x27, 0x28, 0x27, 0x3e, 0x5a, 0x5a, 0x47, 0x56, 0x56, 0x53, 0x55, 0x47,
-    0x2e, 0x28, 0x0d, 0x03, 0x03, 0x05, 0x06, 0x0c, 0x0b, 0x0c, 0x0a, 0x08,
-    0x08, 0x08, 0x09, 0x05, 0x02, 0x02, 0x00, 0x02, 0x06, 0x08, 0x8f, 0xeb,
-    0xea, 0xd8, 0xc8, 0xad, 0x8a, 0x71, 0x73, 0x6b, 0x6b, 0x4d, 0x46, 0x46,
-    0x47, 0x3e, 0x2e, 0x2e, 0x3e, 0x5e, 0x47, 0x47, 0x3e, 0x48, 0x55, 0x2f,
-    0x7e, 0xd1, 0xee, 0xdc, 0xe0, 0xcf, 0xb0, 0x83, 0x97, 0x85, 0x77, 0x64,
-    0x48, 0x40, 0x28, 0x1e, 0x4e, 0x1a, 0x1b, 0x1f, 0x69, 0x69, 0x6f, 0x5e,
-    0x54, 0x4d, 0x54, 0x54, 0x46, 0x50, 0x63, 0x7e, 0xb7, 0x8c, 0x86, 0xa2,
-    0xb4, 0xb4, 0x80, 0x47, 0x36, 0x36, 0x36, 0x46, 0x4a, 0x3e, 0x44, 0x64,
-    0x81, 0x78, 0x87, 0x86, 0xbe, 0xb4, 0xb4, 0xb4, 0x80, 0x2d, 0x2e, 0x3e,
-    0x54, 0x6b, 0x83, 0xaa, 0xac, 0xaf, 0x97, 0xac, 0xae, 0x91, 0x91, 0x7b,
-    0x77, 0x81, 0x77, 0x64, 0x69, 0x69, 0x6a, 0x4e, 0x2a, 0x1e, 0x2a, 0x25,
-    0x15, 0x08, 0x03, 0x02, 0x00, 0x00, 0x00, 0x02, 0x02, 0x03, 0x11, 0x15,
-    0x13, 0x20, 0x64, 0x60, 0x58, 0x7a, 0xb2, 0xb2, 0xb2, 0xbe, 0xb1, 0xbe,
-    0xbe, 0xb7, 0xb7, 0xb4, 0x86, 0xae, 0xb4, 0x81, 0x78, 0x4c, 0x40, 0x2f,
-    0x33, 0x33, 0x33, 0x2b, 0x1e, 0x1e, 0x1e, 0x2a, 0x1e, 0x1b, 0x1b, 0x1b,
-    0x2a, 0x28, 0x2d, 0x64, 0x78, 0x77, 0x7a, 0x8c, 0xa2, 0x91, 0x91, 0x7e,
-    0x80, 0x6e, 0x3c, 0x3c, 0x62, 0x95, 0x62, 0x3c, 0xbe, 0xbb, 0xa8, 0xbb,
-    0xa2, 0x8c, 0x75, 0x58, 0x51, 0x51, 0x23, 0x27, 0x2d, 0x40, 0x2b, 0x1b,
-    0x19, 0x19, 0x1e, 0x25, 0x21, 0x35, 0x4c, 0x81, 0xb4, 0xcf, 0xc6, 0xc6,
-    0xc6, 0xbb, 0x97, 0x82, 0x7a, 0x6c, 0x51, 0x46, 0x56, 0x1e, 0x19, 0x2b,
-    0x3e, 0x51, 0x6b, 0x75, 0x8c, 0xa2, 0xb1, 0xb1, 0xa2, 0x8c, 0x9a, 0xdd,
-    0xeb, 0xf7, 0xeb, 0xdf, 0xca, 0xa6, 0x97, 0xb2, 0xaa, 0x8c, 0x84, 0x86,
-    0x77, 0x78, 0x86, 0x85, 0x77, 0x74, 0x86, 0x5a, 0x50, 0x51, 0x53, 0x53,
-    0x74, 0x73, 0x7f, 0x71, 0x71, 0x71, 0x68, 0x77, 0x5a, 0x37, 0x50, 0x50,
-    0x58, 0x57, 0x57, 0x4b, 0x4b, 0x7c, 0x94, 0xa5, 0xcf, 0xa8, 0x71, 0x50,
-    0x2e, 0x1a, 0x27, 0x2c, 0x37, 0x44, 0x44, 0x23, 0x30, 0x2d, 0x28, 0x1f,
-    0x27, 0x2e, 0x30, 0x56, 0x56, 0x47, 0x47, 0x2e, 0x2f, 0x1e, 0x07, 0x02,
-    0x02, 0x05, 0x08, 0x08, 0x0c, 0x0c, 0x0c, 0x06, 0x03, 0x03, 0x03, 0x03,
-    0x02, 0x02, 0x02, 0x05, 0x08, 0x0c, 0xb9, 0xf7, 0xea, 0xd8, 0xc5, 0xad,
-    0x8e, 0x71, 0x74, 0x6b, 0x58, 0x4d, 0x3a, 0x3e, 0x47, 0x47, 0x47, 0x47,
-    0x3e, 0x47, 0x48, 0x47, 0x47, 0x55, 0x3d, 0x3e, 0x5e, 0xd1, 0xe3, 0xe1,
-    0xe0, 0xe0, 0xbc, 0xa3, 0x8c, 0x84, 0x75, 0x64, 0x3d, 0x2b, 0x1e, 0x0d,
-    0x1e, 0x2f, 0x28, 0x28, 0x2e, 0x69, 0x78, 0x7b, 0x6f, 0x77, 0x61, 0x4d,
-    0x6c, 0x77, 0x77, 0x87, 0x9f, 0x9f, 0xb2, 0xb2, 0xb2, 0xb4, 0x67, 0x47,
-    0x4a, 0x2e, 0x3a, 0x3a, 0x2e, 0x3a, 0x51, 0x55, 0x61, 0x63, 0x86, 0xa0,
-    0x9f, 0xb2, 0xb2, 0xb2, 0x4e, 0x2d, 0x2e, 0x47, 0x50, 0x6b, 0x83, 0xac,
-    0xb7, 0xbc, 0xaf, 0x97, 0xa3, 0x9f, 0xa0, 0x7e, 0x6f, 0x6f, 0x64, 0x34,
-    0x34, 0x34, 0x4e, 0x4e, 0x34, 0x33, 0x35, 0x35, 0x15, 0x05, 0x03, 0x02,
-    0x00, 0x00, 0x02, 0x02, 0x03, 0x06, 0x11, 0x13, 0x0b, 0x1c, 0x49, 0x53,
-    0x6c, 0x8c, 0xb1, 0xb1, 0xbb, 0xc6, 0xc6, 0xc6, 0xbb, 0xac, 0xbe, 0x9f,
-    0x9f, 0xa0, 0x7e, 0x75, 0x91, 0x81, 0x4e, 0x2a, 0x2a, 0x1e, 0x22, 0x12,
-    0x19, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x31, 0x28, 0x1d, 0x2b, 0x28, 0x28,
-    0x2d, 0x48, 0x64, 0x60, 0x77, 0x77, 0x7e, 0x6a, 0x35, 0x35, 0x4f, 0x59,
-    0xc7, 0xcb, 0x95, 0x59, 0xcf, 0xdc, 0xc6, 0xa8, 0xa8, 0xa2, 0x7a, 0x6c,
-    0x86, 0x60, 0x2c, 0x27, 0x3d, 0x40, 0x2a, 0x1e, 0x1e, 0x1e, 0x2a, 0x2f,
-    0x35, 0x52, 0x4c, 0x80, 0xba, 0xcf, 0xbe, 0xbb, 0xaa, 0x97, 0x93, 0x72,
-    0x6b, 0x61, 0x46, 0x3e, 0x2f, 0x21, 0x21, 0x33, 0x3d, 0x64, 0x77, 0x75,
-    0x8c, 0xa2, 0xb1, 0xaa, 0x93, 0x82, 0x72, 0x86, 0xe1, 0xfa, 0xe0, 0xd0,
-    0xc8, 0xad, 0x8e, 0x91, 0xd2, 0xbe, 0xbb, 0x93, 0x74, 0x9d, 0x9a, 0x91,
-    0x7b, 0x6b, 0x50, 0x44, 0x51, 0x51, 0x37, 0x37, 0x58, 0x58, 0x6b, 0x6b,
-    0x68, 0x57, 0x58, 0x77, 0x60, 0x30, 0x3a, 0x3a, 0x46, 0x43, 0x43, 0x4b,
-    0x71, 0x88, 0xab, 0xa8, 0xcf, 0xb1, 0xa2, 0x6b, 0x30, 0x23, 0x27, 0x2c,
-    0x37, 0x44, 0x4b, 0x51, 0x47, 0x2e, 0x1a, 0x1b, 0x28, 0x27, 0x28, 0x2e,
-    0x2e, 0x3d, 0x40, 0x2a, 0x21, 0x12, 0x05, 0x02, 0x02, 0x03, 0x05, 0x06,
-    0x08, 0x08, 0x08, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x06,
-    0x09, 0x0c, 0x8f, 0xeb, 0xea, 0xda, 0xc5, 0xad, 0x8e, 0x83, 0x74, 0x58,
-    0x4d, 0x54, 0x46, 0x2e, 0x3e, 0x3e, 0x47, 0x55, 0x47, 0x3e, 0x64, 0x5e,
-    0x5e, 0x5e, 0x3e, 0x47, 0x56, 0xb7, 0xb7, 0xd2, 0xe0, 0xce, 0xbc, 0xaa,
-    0x8c, 0x84, 0x75, 0x64, 0x28, 0x3e, 0x3d, 0x1e, 0x14, 0x1b, 0x28, 0x2e,
-    0x3e, 0x56, 0x7d, 0x9f, 0x75, 0x77, 0x7e, 0x63, 0x75, 0x87, 0x86, 0x87,
-    0x9f, 0x91, 0xa3, 0xae, 0xb1, 0xa0, 0x56, 0x3a, 0x36, 0x2e, 0x30, 0x46,
-    0x3a, 0x50, 0x6c, 0x54, 0x50, 0x6b, 0x6b, 0x86, 0x9f, 0x9a, 0xb2, 0x9d,
-    0x34, 0x2b, 0x2d, 0x47, 0x50, 0x6b, 0x83, 0xa3, 0xbe, 0xbe, 0xac, 0x97,
-    0x8c, 0x91, 0x7e, 0x69, 0x4c, 0x40, 0x33, 0x1e, 0x1e, 0x20, 0x20, 0x34,
-    0x4f, 0x35, 0x35, 0x35, 0x15, 0x05, 0x05, 0x03, 0x03, 0x02, 0x03, 0x05,
-    0x06, 0x0b, 0x0b, 0x13, 0x0b, 0x0a, 0x20, 0x48, 0x87, 0x87, 0xa2, 0xa2,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xbb, 0xbe, 0xb2, 0xa0, 0x67, 0x6f, 0x75,
-    0x75, 0x7e, 0x6a, 0x34, 0x33, 0x20, 0x1c, 0x12, 0x1b, 0x1e, 0x2a, 0x2a,
-    0x1e, 0x2a, 0x49, 0x2d, 0x2d, 0x28, 0x28, 0x1f, 0x1a, 0x28, 0x49, 0x49,
-    0x31, 0x2d, 0x2a, 0x34, 0x20, 0x34, 0x4f, 0x9e, 0xc7, 0xcb, 0xcb, 0x95,
-    0xd2, 0xdd, 0xc6, 0xaa, 0xaa, 0xa2, 0x8c, 0x6f, 0x7e, 0x53, 0x44, 0x3e,
-    0x2d, 0x2b, 0x33, 0x33, 0x2f, 0x2f, 0x47, 0x4c, 0x40, 0x35, 0x4c, 0x52,
-    0x8f, 0xd4, 0xb2, 0xa3, 0x84, 0x84, 0x74, 0x6b, 0x54, 0x4a, 0x2f, 0x2f,
-    0x1e, 0x1c, 0x22, 0x33, 0x4e, 0x67, 0x77, 0x75, 0x8c, 0xa2, 0xa2, 0xa2,
-    0x8c, 0x8c, 0x82, 0x7a, 0xd2, 0xee, 0xdc, 0xde, 0xb6, 0xb3, 0x96, 0x83,
-    0xd3, 0xe4, 0xd2, 0xaf, 0x84, 0x8c, 0x75, 0x75, 0x6f, 0x75, 0x75, 0x54,
-    0x5e, 0x5e, 0x44, 0x37, 0x43, 0x50, 0x50, 0x50, 0x43, 0x43, 0x58, 0x77,
-    0x86, 0x44, 0x2e, 0x1d, 0x1a, 0x27, 0x51, 0x4b, 0x82, 0x93, 0x9c, 0xa5,
-    0xb8, 0xa8, 0x93, 0x72, 0x5a, 0x60, 0x44, 0x51, 0x4b, 0x5a, 0x58, 0x61,
-    0x5e, 0x47, 0x28, 0x1b, 0x2f, 0x2e, 0x28, 0x2d, 0x2e, 0x28, 0x1e, 0x1b,
-    0x0b, 0x05, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x05, 0x08, 0x05, 0x03,
-    0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x05, 0x06, 0x09, 0x0c, 0x59, 0xeb,
-    0xe9, 0xd9, 0xc8, 0xad, 0x8e, 0x71, 0x6b, 0x63, 0x46, 0x46, 0x47, 0x3e,
-    0x47, 0x47, 0x5e, 0x5e, 0x47, 0x27, 0x45, 0x78, 0x6f, 0x54, 0x44, 0x51,
-    0x6f, 0x78, 0x75, 0x69, 0xd1, 0xbc, 0xce, 0xbe, 0xa3, 0x85, 0x61, 0x45,
-    0x27, 0x55, 0x56, 0x2d, 0x28, 0x1f, 0x28, 0x3e, 0x47, 0x3d, 0x67, 0x7d,
-    0x78, 0x67, 0x9d, 0x9f, 0x91, 0x86, 0x7b, 0x91, 0x91, 0x91, 0xa3, 0xae,
-    0xb4, 0x80, 0x3d, 0x3d, 0x3e, 0x36, 0x46, 0x46, 0x46, 0x61, 0x77, 0x54,
-    0x50, 0x77, 0x77, 0x8c, 0x7b, 0x8c, 0x9f, 0x52, 0x13, 0x19, 0x1d, 0x3e,
-    0x43, 0x50, 0x74, 0x91, 0xae, 0xbe, 0xac, 0x97, 0x84, 0x91, 0x7e, 0x69,
-    0x40, 0x2f, 0x24, 0x1e, 0x1b, 0x1c, 0x1c, 0x20, 0x20, 0x35, 0x35, 0x22,
-    0x15, 0x08, 0x08, 0x06, 0x05, 0x05, 0x06, 0x08, 0x0b, 0x0b, 0x13, 0x13,
-    0x0b, 0x0a, 0x10, 0x3d, 0x78, 0x86, 0x86, 0x8c, 0xa5, 0xb8, 0xc6, 0xbb,
-    0xaa, 0xaa, 0xbc, 0xb7, 0x9d, 0x81, 0x55, 0x61, 0x5e, 0x4c, 0x69, 0x4e,
-    0x33, 0x2a, 0x19, 0x1c, 0x1b, 0x1e, 0x1e, 0x1e, 0x1e, 0x28, 0x48, 0x3d,
-    0x3d, 0x3d, 0x48, 0x2a, 0x1d, 0x3d, 0x48, 0x4e, 0x33, 0x31, 0x28, 0x2a,
-    0x33, 0x4f, 0x4f, 0x9e, 0xc7, 0xcb, 0xcb, 0xcb, 0xe3, 0xe0, 0xc6, 0xaa,
-    0xaa, 0x9f, 0x9f, 0x77, 0x44, 0x3e, 0x4a, 0x69, 0x2d, 0x2b, 0x2f, 0x3d,
-    0x3d, 0x48, 0x64, 0x69, 0x4e, 0x35, 0x35, 0x35, 0x8f, 0xb9, 0x9d, 0x75,
-    0x6b, 0x63, 0x54, 0x55, 0x4a, 0x40, 0x1e, 0x21, 0x19, 0x19, 0x22, 0x35,
-    0x6a, 0x5e, 0x53, 0x87, 0x9a, 0xa2, 0xa2, 0xa2, 0x9a, 0x85, 0x7a, 0x87,
-    0xcf, 0xe2, 0xd9, 0xd5, 0xaf, 0xaf, 0xa6, 0x96, 0x91, 0xd3, 0xce, 0xa6,
-    0x84, 0x74, 0x61, 0x5e, 0x46, 0x5e, 0x64, 0x4a, 0x5e, 0x5e, 0x6f, 0x51,
-    0x44, 0x44, 0x46, 0x46, 0x43, 0x58, 0x6b, 0x74, 0x6c, 0x45, 0x30, 0x1d,
-    0x28, 0x27, 0x2c, 0x75, 0x72, 0x93, 0xa5, 0xa5, 0xbb, 0xa8, 0x93, 0x58,
-    0x6f, 0x86, 0x58, 0x84, 0x8c, 0x6b, 0x6b, 0x58, 0x58, 0x55, 0x3e, 0x1d,
-    0x1e, 0x2f, 0x28, 0x1e, 0x1e, 0x1e, 0x1e, 0x12, 0x0a, 0x03, 0x02, 0x02,
-    0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x03,
-    0x03, 0x05, 0x05, 0x08, 0x08, 0x09, 0x15, 0xb9, 0xf0, 0xe0, 0xc8, 0xad,
-    0x8e, 0x66, 0x4d, 0x4d, 0x46, 0x46, 0x47, 0x47, 0x47, 0x55, 0x5e, 0x55,
-    0x47, 0x27, 0x47, 0x78, 0x86, 0x75, 0x60, 0x60, 0x6c, 0x77, 0x61, 0x5a,
-    0x6f, 0xae, 0xd3, 0xb7, 0x91, 0x77, 0x78, 0x45, 0x46, 0x55, 0x5e, 0x36,
-    0x3e, 0x1f, 0x1d, 0x27, 0x30, 0x3d, 0x56, 0x67, 0x67, 0x33, 0x6a, 0xa0,
-    0x9f, 0x85, 0x91, 0x85, 0x84, 0x91, 0x91, 0x91, 0x81, 0x2a, 0x1e, 0x2d,
-    0x2e, 0x3e, 0x46, 0x54, 0x47, 0x47, 0x5e, 0x5e, 0x61, 0x75, 0x9f, 0x9f,
-    0x75, 0x75, 0x52, 0x09, 0x05, 0x0d, 0x1a, 0x30, 0x37, 0x43, 0x6b, 0x84,
-    0x91, 0xa3, 0xac, 0x91, 0x74, 0x85, 0x81, 0x52, 0x35, 0x2f, 0x36, 0x1f,
-    0x14, 0x12, 0x1c, 0x1c, 0x1c, 0x20, 0x22, 0x15, 0x0c, 0x09, 0x0b, 0x0c,
-    0x0b, 0x09, 0x09, 0x0b, 0x0a, 0x13, 0x13, 0x13, 0x13, 0x13, 0x10, 0x31,
-    0x53, 0x60, 0x7a, 0x82, 0xaa, 0xb1, 0xbe, 0xcf, 0xac, 0x93, 0xa2, 0x9f,
-    0xa0, 0x81, 0x64, 0x64, 0x49, 0x48, 0x69, 0x4e, 0x40, 0x35, 0x1c, 0x20,
-    0x1e, 0x1e, 0x28, 0x28, 0x2d, 0x2d, 0x48, 0x48, 0x30, 0x3d, 0x64, 0x48,
-    0x30, 0x2d, 0x3d, 0x56, 0x2d, 0x49, 0x4e, 0x33, 0x33, 0x4e, 0x6e, 0x90,
-    0xc4, 0xcb, 0xcb, 0xcb, 0xe4, 0xe1, 0xce, 0xa2, 0x8c, 0x86, 0x87, 0x60,
-    0x45, 0x3e, 0x4c, 0x6a, 0x3d, 0x2f, 0x2f, 0x3d, 0x56, 0x64, 0x7d, 0x67,
-    0x4e, 0x2a, 0x21, 0x33, 0x6d, 0x52, 0x6d, 0x7e, 0x5e, 0x3e, 0x40, 0x2f,
-    0x36, 0x2d, 0x1b, 0x0c, 0x15, 0x15, 0x22, 0x22, 0x6a, 0x64, 0x55, 0x78,
-    0x9a, 0x86, 0x85, 0x8c, 0x86, 0x74, 0x6c, 0x53, 0xd2, 0xe9, 0xd9, 0xc6,
-    0xcf, 0xf0, 0xce, 0xca, 0xa6, 0xae, 0xbe, 0xaf, 0x83, 0x73, 0x6b, 0x50,
-    0x3a, 0x46, 0x3a, 0x36, 0x47, 0x51, 0x86, 0x53, 0x53, 0x3a, 0x27, 0x3a,
-    0x54, 0x61, 0x6c, 0x6b, 0x6b, 0x5e, 0x64, 0x45, 0x30, 0x2e, 0x37, 0x60,
-    0x85, 0x7f, 0x93, 0xbb, 0xbe, 0xaa, 0x82, 0x58, 0x51, 0x58, 0x71, 0x85,
-    0xa2, 0x71, 0x58, 0x4b, 0x51, 0x3e, 0x2b, 0x1f, 0x12, 0x0a, 0x12, 0x19,
-    0x12, 0x12, 0x12, 0x0d, 0x0c, 0x08, 0x05, 0x03, 0x03, 0x05, 0x03, 0x03,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x06, 0x06, 0x08,
-    0x08, 0x06, 0x05, 0x18, 0xe4, 0xd9, 0xb6, 0x8e, 0x66, 0x66, 0x4d, 0x4d,
-    0x54, 0x54, 0x5e, 0x54, 0x27, 0x3e, 0x55, 0x55, 0x44, 0x2c, 0x3e, 0x64,
-    0x78, 0x78, 0x77, 0x75, 0x77, 0x86, 0x86, 0x61, 0x54, 0x55, 0x7e, 0xa0,
-    0x61, 0x3e, 0x56, 0x6f, 0x54, 0x5e, 0x55, 0x47, 0x47, 0x1d, 0x28, 0x3e,
-    0x45, 0x56, 0x56, 0x67, 0x67, 0x2a, 0x28, 0x48, 0x78, 0x87, 0x7e, 0x86,
-    0x75, 0x84, 0x74, 0x54, 0x2b, 0x1d, 0x14, 0x2a, 0x3d, 0x3d, 0x48, 0x55,
-    0x47, 0x54, 0x5e, 0x6f, 0x6f, 0x6f, 0x78, 0x7e, 0x56, 0x2a, 0x08, 0x02,
-    0x03, 0x0d, 0x14, 0x2e, 0x2e, 0x44, 0x50, 0x6b, 0x84, 0x91, 0x91, 0x85,
-    0x61, 0x64, 0x4e, 0x35, 0x21, 0x2f, 0x36, 0x2b, 0x1c, 0x12, 0x13, 0x13,
-    0x12, 0x1c, 0x1c, 0x0a, 0x08, 0x0c, 0x0c, 0x15, 0x0c, 0x0c, 0x08, 0x0c,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x10, 0x2a, 0x3d, 0x56, 0x60, 0x72,
-    0xa2, 0xaa, 0xaa, 0xaa, 0x9f, 0x85, 0x93, 0xa0, 0x80, 0x5e, 0x7e, 0x80,
-    0x4e, 0x4c, 0x69, 0x4e, 0x33, 0x1c, 0x13, 0x1c, 0x1c, 0x2a, 0x2d, 0x3d,
-    0x48, 0x3d, 0x48, 0x3d, 0x30, 0x45, 0x60, 0x64, 0x45, 0x45, 0x48, 0x49,
-    0x3d, 0x56, 0x6a, 0x34, 0x34, 0x4e, 0x6e, 0x8f, 0xb9, 0xc7, 0xcb, 0xcb,
-    0xa1, 0xce, 0xbc, 0x84, 0x74, 0x5a, 0x5e, 0x4c, 0x56, 0x47, 0x40, 0x4c,
-    0x47, 0x40, 0x40, 0x69, 0x7d, 0x7d, 0x7d, 0x6a, 0x33, 0x21, 0x2a, 0x2a,
-    0x33, 0x2f, 0x35, 0x4e, 0x3d, 0x1e, 0x10, 0x0a, 0x1c, 0x33, 0x1c, 0x0a,
-    0x0a, 0x12, 0x1c, 0x22, 0x4e, 0x48, 0x56, 0x78, 0x87, 0x87, 0x85, 0x85,
-    0x75, 0x6c, 0x51, 0x3d, 0xe3, 0xe9, 0xdd, 0xe1, 0xe3, 0xe4, 0xe3, 0xdf,
-    0xbc, 0x97, 0x98, 0xbe, 0xbe, 0xa3, 0x83, 0x73, 0x58, 0x61, 0x3a, 0x36,
-    0x5e, 0x54, 0x61, 0x61, 0x61, 0x47, 0x27, 0x36, 0x4d, 0x61, 0x61, 0x58,
-    0x50, 0x75, 0x60, 0x78, 0x48, 0x27, 0x2e, 0x50, 0x6b, 0x73, 0x97, 0xaa,
-    0xa3, 0xa2, 0x6b, 0x43, 0x43, 0x74, 0x74, 0x71, 0x71, 0x82, 0x72, 0x72,
-    0x6c, 0x2b, 0x1c, 0x19, 0x12, 0x05, 0x05, 0x08, 0x0b, 0x08, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x08, 0x05, 0x05, 0x08, 0x05, 0x05, 0x05, 0x03, 0x05, 0x03,
-    0x03, 0x03, 0x05, 0x03, 0x03, 0x03, 0x05, 0x05, 0x06, 0x05, 0x08, 0x08,
-    0x3c, 0xb7, 0xb0, 0x98, 0x73, 0x63, 0x4d, 0x54, 0x54, 0x6f, 0x5a, 0x46,
-    0x3a, 0x3e, 0x47, 0x55, 0x44, 0x2c, 0x27, 0x28, 0x3d, 0x78, 0x86, 0x85,
-    0x77, 0x87, 0x87, 0x75, 0x5a, 0x43, 0x54, 0x78, 0x54, 0x47, 0x2e, 0x47,
-    0x55, 0x69, 0x5e, 0x3e, 0x47, 0x3d, 0x27, 0x3d, 0x56, 0x67, 0x56, 0x30,
-    0x31, 0x1f, 0x2e, 0x3e, 0x47, 0x47, 0x40, 0x40, 0x3e, 0x55, 0x3e, 0x1d,
-    0x28, 0x2d, 0x1d, 0x28, 0x3d, 0x2d, 0x2d, 0x30, 0x45, 0x51, 0x5a, 0x60,
-    0x78, 0x78, 0x69, 0x64, 0x4c, 0x2a, 0x1c, 0x0a, 0x08, 0x0a, 0x0a, 0x1f,
-    0x2f, 0x3a, 0x43, 0x50, 0x63, 0x63, 0x63, 0x61, 0x54, 0x56, 0x4e, 0x35,
-    0x2a, 0x1f, 0x2b, 0x22, 0x22, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0a,
-    0x0a, 0x0c, 0x0c, 0x15, 0x15, 0x0c, 0x0c, 0x0c, 0x13, 0x12, 0x12, 0x13,
-    0x1c, 0x1c, 0x1c, 0x1c, 0x1e, 0x1e, 0x3d, 0x5a, 0x82, 0x8c, 0x97, 0x97,
-    0x91, 0x75, 0x7a, 0x7d, 0x6a, 0x5e, 0x78, 0x80, 0x4e, 0x4e, 0x4e, 0x33,
-    0x2a, 0x13, 0x0a, 0x0a, 0x10, 0x1c, 0x2a, 0x3d, 0x56, 0x48, 0x56, 0x56,
-    0x53, 0x53, 0x45, 0x53, 0x44, 0x60, 0x64, 0x48, 0x30, 0x48, 0x6a, 0x33,
-    0x31, 0x49, 0x6e, 0x90, 0xb9, 0xc7, 0xcb, 0xcb, 0x5e, 0x77, 0x85, 0x63,
-    0x61, 0x54, 0x4a, 0x4a, 0x4c, 0x55, 0x55, 0x4c, 0x4c, 0x4c, 0x67, 0x81,
-    0xa0, 0x87, 0x67, 0x33, 0x20, 0x1b, 0x1f, 0x1f, 0x1e, 0x1e, 0x2a, 0x33,
-    0x28, 0x1b, 0x14, 0x0a, 0x08, 0x22, 0x1e, 0x12, 0x13, 0x13, 0x12, 0x1c,
-    0x52, 0x4c, 0x56, 0x64, 0x81, 0x7e, 0x77, 0x6c, 0x5a, 0x51, 0x3e, 0x2b,
-    0xd4, 0xdd, 0xdc, 0xf0, 0xeb, 0xf0, 0xe3, 0xe0, 0xb0, 0x96, 0x66, 0x9f,
-    0xb4, 0xa3, 0x83, 0x83, 0x63, 0x4d, 0x54, 0x5e, 0x5e, 0x61, 0x58, 0x4d,
-    0x58, 0x51, 0x3e, 0x2e, 0x4a, 0x4d, 0x43, 0x43, 0x44, 0x75, 0x6b, 0x87,
-    0x56, 0x23, 0x23, 0x46, 0x6f, 0x58, 0x73, 0x8c, 0x85, 0x75, 0x51, 0x44,
-    0x50, 0x85, 0x82, 0x71, 0x7f, 0xa2, 0x8c, 0x72, 0x77, 0x2d, 0x0a, 0x08,
-    0x05, 0x05, 0x05, 0x03, 0x05, 0x05, 0x07, 0x08, 0x0a, 0x0d, 0x0a, 0x0a,
-    0x08, 0x08, 0x0c, 0x08, 0x08, 0x05, 0x08, 0x0a, 0x0a, 0x08, 0x08, 0x05,
-    0x03, 0x03, 0x05, 0x05, 0x05, 0x06, 0x06, 0x0b, 0x0c, 0x22, 0x69, 0x6f,
-    0x6f, 0x64, 0x5e, 0x60, 0x5e, 0x54, 0x51, 0x44, 0x37, 0x2e, 0x3e, 0x3a,
-    0x2c, 0x30, 0x23, 0x1d, 0x30, 0x60, 0x60, 0x86, 0x86, 0x87, 0x75, 0x61,
-    0x61, 0x5a, 0x75, 0x81, 0x7b, 0x54, 0x47, 0x3e, 0x47, 0x47, 0x3e, 0x2e,
-    0x47, 0x56, 0x23, 0x30, 0x48, 0x64, 0x67, 0x28, 0x1f, 0x1b, 0x1b, 0x2f,
-    0x29, 0x27, 0x28, 0x2b, 0x28, 0x47, 0x3e, 0x2e, 0x2e, 0x2d, 0x1d, 0x2d,
-    0x2d, 0x28, 0x23, 0x30, 0x53, 0x5a, 0x60, 0x5a, 0x6c, 0x77, 0x81, 0x6a,
-    0x4c, 0x40, 0x2b, 0x1e, 0x12, 0x07, 0x05, 0x0b, 0x1c, 0x1d, 0x3e, 0x46,
-    0x43, 0x43, 0x4d, 0x54, 0x47, 0x3d, 0x40, 0x2f, 0x21, 0x1c, 0x12, 0x15,
-    0x15, 0x13, 0x0b, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0b, 0x0c, 0x18,
-    0x0c, 0x0c, 0x08, 0x0b, 0x13, 0x13, 0x13, 0x10, 0x10, 0x1c, 0x20, 0x1e,
-    0x1b, 0x10, 0x1b, 0x47, 0x58, 0x6b, 0x74, 0x74, 0x74, 0x6f, 0x6f, 0x64,
-    0x4e, 0x48, 0x4c, 0x6a, 0x33, 0x34, 0x22, 0x1c, 0x13, 0x0a, 0x0a, 0x13,
-    0x12, 0x10, 0x10, 0x2a, 0x49, 0x48, 0x45, 0x64, 0x64, 0x60, 0x51, 0x51,
-    0x51, 0x60, 0x67, 0x53, 0x53, 0x3d, 0x56, 0x48, 0x48, 0x67, 0x6e, 0x90,
-    0xb9, 0xc4, 0xc7, 0xcb, 0x37, 0x30, 0x3e, 0x4a, 0x4a, 0x2f, 0x40, 0x40,
-    0x4a, 0x5e, 0x47, 0x4c, 0x81, 0x80, 0x9d, 0x9d, 0xa0, 0x64, 0x3d, 0x1e,
-    0x1e, 0x1e, 0x1f, 0x1f, 0x1e, 0x1e, 0x2a, 0x2a, 0x28, 0x1f, 0x1e, 0x19,
-    0x0a, 0x1c, 0x1c, 0x20, 0x20, 0x1c, 0x1c, 0x1c, 0x35, 0x4e, 0x4e, 0x4c,
-    0x6a, 0x80, 0x6a, 0x64, 0x47, 0x3e, 0x2e, 0x2a, 0x80, 0xce, 0xce, 0xf3,
-    0xeb, 0xf0, 0xe0, 0xb0, 0xb3, 0x8e, 0x73, 0x61, 0x9f, 0x91, 0x98, 0x83,
-    0x73, 0x4d, 0x54, 0x55, 0x5e, 0x61, 0x63, 0x58, 0x4d, 0x51, 0x40, 0x1f,
-    0x1f, 0x27, 0x3a, 0x60, 0x58, 0x85, 0x9f, 0x9f, 0x53, 0x45, 0x30, 0x47,
-    0x55, 0x46, 0x4d, 0x54, 0x55, 0x3a, 0x47, 0x44, 0x50, 0x74, 0x82, 0x8c,
-    0x93, 0x7f, 0x82, 0x6b, 0x58, 0x47, 0x1c, 0x07, 0x07, 0x12, 0x12, 0x07,
-    0x07, 0x07, 0x0a, 0x13, 0x12, 0x12, 0x12, 0x0a, 0x0a, 0x0c, 0x0a, 0x0a,
-    0x07, 0x08, 0x07, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x05, 0x05, 0x08, 0x08,
-    0x08, 0x05, 0x05, 0x0b, 0x0d, 0x20, 0x49, 0x64, 0x51, 0x51, 0x64, 0x60,
-    0x44, 0x37, 0x37, 0x46, 0x3e, 0x2e, 0x37, 0x30, 0x37, 0x37, 0x30, 0x27,
-    0x27, 0x27, 0x60, 0x9f, 0x9f, 0x86, 0x6c, 0x77, 0x6c, 0x6b, 0x91, 0xa0,
-    0x77, 0x61, 0x5e, 0x47, 0x3e, 0x47, 0x47, 0x3e, 0x64, 0x6a, 0x3d, 0x45,
-    0x53, 0x64, 0x48, 0x28, 0x1b, 0x14, 0x1b, 0x2b, 0x29, 0x2e, 0x3e, 0x2e,
-    0x2e, 0x47, 0x47, 0x55, 0x47, 0x2e, 0x28, 0x49, 0x49, 0x2d, 0x28, 0x45,
-    0x53, 0x5a, 0x5a, 0x6c, 0x6c, 0x6c, 0x78, 0x6a, 0x33, 0x3e, 0x40, 0x2f,
-    0x1f, 0x0d, 0x05, 0x03, 0x05, 0x0d, 0x1f, 0x1f, 0x2e, 0x3e, 0x3e, 0x3e,
-    0x28, 0x2b, 0x33, 0x35, 0x1c, 0x10, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x13, 0x0b, 0x13, 0x0b, 0x0b, 0x0c, 0x0c, 0x18, 0x0c, 0x0c, 0x08, 0x08,
-    0x0c, 0x0c, 0x0a, 0x0a, 0x10, 0x1e, 0x1e, 0x1e, 0x1e, 0x14, 0x1b, 0x28,
-    0x30, 0x46, 0x51, 0x60, 0x60, 0x6f, 0x69, 0x4e, 0x33, 0x2b, 0x4c, 0x4e,
-    0x34, 0x20, 0x22, 0x1c, 0x13, 0x13, 0x12, 0x13, 0x1c, 0x12, 0x10, 0x2a,
-    0x3d, 0x48, 0x48, 0x64, 0x64, 0x5a, 0x53, 0x78, 0x60, 0x60, 0x64, 0x64,
-    0x64, 0x67, 0x67, 0x67, 0x49, 0x6e, 0x90, 0x90, 0xb9, 0xb9, 0xc7, 0xcb,
-    0x23, 0x28, 0x40, 0x33, 0x1e, 0x1e, 0x2b, 0x2f, 0x3e, 0x3e, 0x28, 0x4c,
-    0xa1, 0xb9, 0xb4, 0xa0, 0x78, 0x3e, 0x27, 0x2b, 0x2d, 0x2f, 0x2b, 0x1d,
-    0x1f, 0x28, 0x2a, 0x1d, 0x1d, 0x1f, 0x1f, 0x1e, 0x1e, 0x2a, 0x2a, 0x1e,
-    0x2a, 0x1e, 0x22, 0x22, 0x22, 0x35, 0x35, 0x33, 0x52, 0x4e, 0x4e, 0x4e,
-    0x4e, 0x40, 0x33, 0x21, 0x22, 0x4c, 0x7e, 0xe4, 0xe3, 0xf3, 0xf0, 0xd0,
-    0xb0, 0x96, 0x85, 0x86, 0x91, 0x91, 0x7b, 0x74, 0x63, 0x54, 0x54, 0x5e,
-    0x6f, 0x61, 0x63, 0x63, 0x63, 0x46, 0x33, 0x1f, 0x1d, 0x3e, 0x51, 0x6c,
-    0x6b, 0x85, 0x8c, 0x9a, 0x87, 0x3d, 0x2d, 0x2d, 0x2f, 0x40, 0x40, 0x2f,
-    0x1f, 0x1d, 0x3e, 0x44, 0x50, 0x57, 0x82, 0xa2, 0xaa, 0x8c, 0x8c, 0x8c,
-    0x51, 0x2e, 0x1e, 0x12, 0x12, 0x1e, 0x2b, 0x1e, 0x14, 0x0d, 0x12, 0x1c,
-    0x1b, 0x1b, 0x19, 0x1c, 0x12, 0x12, 0x0d, 0x0a, 0x0a, 0x07, 0x0a, 0x0a,
-    0x12, 0x12, 0x0d, 0x0a, 0x08, 0x08, 0x0c, 0x0c, 0x08, 0x05, 0x03, 0x07,
-    0x12, 0x20, 0x4e, 0x64, 0x51, 0x51, 0x77, 0x6c, 0x42, 0x37, 0x44, 0x54,
-    0x3a, 0x2e, 0x44, 0x44, 0x44, 0x51, 0x2c, 0x2e, 0x2e, 0x27, 0x2e, 0x78,
-    0x87, 0x85, 0x85, 0x9f, 0x75, 0x6b, 0x75, 0x78, 0x61, 0x44, 0x64, 0x7d,
-    0x64, 0x30, 0x47, 0x47, 0x64, 0x80, 0x67, 0x56, 0x56, 0x67, 0x31, 0x28,
-    0x1f, 0x1b, 0x2b, 0x2f, 0x2e, 0x3e, 0x3e, 0x2e, 0x2e, 0x47, 0x55, 0x5e,
-    0x55, 0x3e, 0x27, 0x56, 0x67, 0x4e, 0x3d, 0x45, 0x51, 0x51, 0x5a, 0x77,
-    0x60, 0x6c, 0x6f, 0x64, 0x48, 0x47, 0x47, 0x3e, 0x2b, 0x14, 0x0a, 0x03,
-    0x02, 0x05, 0x08, 0x0d, 0x19, 0x1b, 0x1f, 0x2b, 0x1f, 0x1b, 0x1c, 0x15,
-    0x13, 0x1c, 0x13, 0x0b, 0x0b, 0x0b, 0x13, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x09, 0x09, 0x09, 0x0b, 0x0b, 0x06, 0x03, 0x03, 0x03, 0x05, 0x07,
-    0x0a, 0x1c, 0x1e, 0x1e, 0x1b, 0x14, 0x1e, 0x1e, 0x2a, 0x2d, 0x3d, 0x3d,
-    0x48, 0x4c, 0x4e, 0x35, 0x1c, 0x20, 0x21, 0x22, 0x20, 0x1c, 0x22, 0x15,
-    0x13, 0x13, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1e, 0x2d, 0x48, 0x56, 0x56,
-    0x64, 0x60, 0x60, 0x7d, 0x78, 0x78, 0x77, 0x87, 0x67, 0x7d, 0x67, 0x7d,
-    0x6e, 0x67, 0x80, 0x90, 0x90, 0xb9, 0xc7, 0xcb, 0x2d, 0x2f, 0x40, 0x2b,
-    0x21, 0x21, 0x2b, 0x2f, 0x2d, 0x28, 0x1f, 0x4e, 0xa0, 0xb4, 0xa0, 0x87,
-    0x64, 0x47, 0x2e, 0x36, 0x47, 0x47, 0x47, 0x2e, 0x28, 0x4e, 0x3e, 0x27,
-    0x1d, 0x1d, 0x28, 0x2f, 0x2e, 0x2e, 0x28, 0x2a, 0x2b, 0x2b, 0x22, 0x35,
-    0x22, 0x22, 0x21, 0x22, 0x35, 0x35, 0x33, 0x35, 0x33, 0x33, 0x21, 0x21,
-    0x16, 0x0d, 0x12, 0x4f, 0xa1, 0xb9, 0xf3, 0xd1, 0x97, 0x85, 0x87, 0xb7,
-    0xae, 0x9f, 0x91, 0x63, 0x4d, 0x46, 0x5e, 0x54, 0x5e, 0x61, 0x63, 0x63,
-    0x54, 0x55, 0x4e, 0x1f, 0x2e, 0x55, 0x61, 0x74, 0x74, 0x84, 0x84, 0x85,
-    0x60, 0x28, 0x2a, 0x1e, 0x2b, 0x2a, 0x1e, 0x14, 0x1e, 0x2d, 0x45, 0x53,
-    0x86, 0x85, 0x97, 0x97, 0xa2, 0xaa, 0x8c, 0x85, 0x53, 0x28, 0x1b, 0x1b,
-    0x1e, 0x28, 0x3e, 0x2e, 0x1d, 0x14, 0x14, 0x14, 0x1a, 0x1e, 0x1e, 0x19,
-    0x12, 0x12, 0x12, 0x0d, 0x0a, 0x0c, 0x0a, 0x0d, 0x19, 0x19, 0x12, 0x0a,
-    0x07, 0x0a, 0x0a, 0x0a, 0x0a, 0x05, 0x03, 0x0c, 0x1c, 0x22, 0x33, 0x5e,
-    0x6c, 0x6c, 0x6c, 0x58, 0x58, 0x6c, 0x51, 0x54, 0x3a, 0x2c, 0x3a, 0x51,
-    0x5a, 0x51, 0x30, 0x2e, 0x2e, 0x2c, 0x27, 0x55, 0x91, 0x85, 0x91, 0xa0,
-    0x84, 0x74, 0x86, 0x75, 0x43, 0x29, 0x69, 0xba, 0x7d, 0x44, 0x47, 0x2e,
-    0x48, 0x64, 0x64, 0x7d, 0x67, 0x6e, 0x31, 0x28, 0x2b, 0x2b, 0x2e, 0x36,
-    0x2e, 0x3e, 0x47, 0x3a, 0x37, 0x37, 0x45, 0x45, 0x47, 0x3e, 0x2e, 0x30,
-    0x56, 0x64, 0x53, 0x64, 0x60, 0x5a, 0x5a, 0x77, 0x78, 0x78, 0x64, 0x56,
-    0x3e, 0x3e, 0x3a, 0x3e, 0x29, 0x1f, 0x0d, 0x05, 0x03, 0x02, 0x02, 0x03,
-    0x06, 0x08, 0x0a, 0x12, 0x12, 0x08, 0x08, 0x08, 0x0a, 0x1e, 0x13, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09,
-    0x06, 0x08, 0x06, 0x02, 0x02, 0x03, 0x05, 0x08, 0x0a, 0x12, 0x1c, 0x1b,
-    0x14, 0x10, 0x1c, 0x1e, 0x1e, 0x1f, 0x1e, 0x10, 0x1e, 0x1e, 0x20, 0x20,
-    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x22, 0x22, 0x15, 0x0b, 0x0a, 0x13, 0x1c,
-    0x1c, 0x1c, 0x1c, 0x1c, 0x2a, 0x31, 0x49, 0x49, 0x67, 0x78, 0x7d, 0x78,
-    0x78, 0x87, 0x77, 0x77, 0x6f, 0x7d, 0x67, 0x80, 0x6e, 0x49, 0x80, 0x90,
-    0x90, 0x90, 0xc7, 0xcb, 0x3d, 0x2f, 0x2b, 0x1f, 0x21, 0x21, 0x21, 0x2f,
-    0x2f, 0x2f, 0x2b, 0x4c, 0x9f, 0x9a, 0x6c, 0x77, 0x69, 0x4c, 0x4a, 0x3e,
-    0x47, 0x55, 0x51, 0x37, 0x3e, 0x55, 0x44, 0x30, 0x2d, 0x3d, 0x2d, 0x2d,
-    0x3e, 0x3e, 0x2d, 0x1e, 0x1f, 0x1f, 0x1e, 0x20, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x33, 0x2a, 0x2a, 0x21, 0x21, 0x21, 0x19, 0x12, 0x0d, 0x0d, 0x12,
-    0x2a, 0x6a, 0x80, 0x6a, 0x9f, 0xaa, 0xae, 0xd3, 0xd3, 0xb7, 0x91, 0x74,
-    0x63, 0x46, 0x46, 0x46, 0x6f, 0x61, 0x58, 0x4d, 0x5e, 0x55, 0x40, 0x27,
-    0x2e, 0x46, 0x5a, 0x6b, 0x74, 0x74, 0x84, 0x74, 0x6f, 0x2d, 0x1b, 0x1f,
-    0x1f, 0x2b, 0x1f, 0x1b, 0x33, 0x56, 0x47, 0x46, 0x77, 0x86, 0xa2, 0xa2,
-    0x97, 0xa2, 0x93, 0x74, 0x5a, 0x2d, 0x1f, 0x1e, 0x2d, 0x3e, 0x55, 0x47,
-    0x2e, 0x1a, 0x14, 0x1a, 0x1f, 0x1e, 0x1b, 0x19, 0x12, 0x12, 0x12, 0x0a,
-    0x08, 0x07, 0x0a, 0x10, 0x10, 0x12, 0x12, 0x0d, 0x0a, 0x13, 0x13, 0x12,
-    0x13, 0x07, 0x03, 0x05, 0x13, 0x1c, 0x33, 0x55, 0x60, 0x75, 0x50, 0x50,
-    0x75, 0x86, 0x51, 0x51, 0x37, 0x46, 0x3a, 0x3a, 0x55, 0x47, 0x2e, 0x2e,
-    0x2e, 0x3e, 0x3a, 0x44, 0x6f, 0x9f, 0xb2, 0xb2, 0x84, 0x73, 0xa3, 0x86,
-    0x58, 0x46, 0x46, 0x9d, 0x7d, 0x5a, 0x78, 0x47, 0x51, 0x60, 0x60, 0x7d,
-    0x67, 0x6e, 0x2a, 0x2a, 0x2f, 0x40, 0x3e, 0x2e, 0x2e, 0x3e, 0x47, 0x3e,
-    0x30, 0x30, 0x30, 0x30, 0x45, 0x45, 0x53, 0x45, 0x3a, 0x47, 0x44, 0x78,
-    0x87, 0x60, 0x4b, 0x75, 0x81, 0xa0, 0x9d, 0x6a, 0x3d, 0x3e, 0x3a, 0x2e,
-    0x29, 0x1f, 0x12, 0x0a, 0x08, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
-    0x02, 0x03, 0x03, 0x02, 0x0a, 0x22, 0x0b, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x09, 0x09, 0x0b, 0x06, 0x06, 0x06, 0x03,
-    0x03, 0x06, 0x0b, 0x13, 0x1c, 0x1c, 0x1c, 0x12, 0x10, 0x10, 0x20, 0x1e,
-    0x14, 0x1b, 0x1b, 0x10, 0x10, 0x10, 0x2a, 0x2a, 0x1c, 0x12, 0x1c, 0x20,
-    0x22, 0x22, 0x22, 0x13, 0x0b, 0x0b, 0x15, 0x13, 0x13, 0x13, 0x1c, 0x1c,
-    0x2a, 0x2a, 0x31, 0x49, 0x67, 0x7d, 0x7d, 0x77, 0x77, 0x86, 0x77, 0x60,
-    0x60, 0x7d, 0x7d, 0x80, 0x6e, 0x49, 0x67, 0x9d, 0x90, 0x90, 0xc7, 0xcb,
-    0x2b, 0x2f, 0x2f, 0x33, 0x21, 0x21, 0x2b, 0x2f, 0x2f, 0x2f, 0x3e, 0x5e,
-    0x9f, 0xa2, 0x6c, 0x77, 0x81, 0x69, 0x55, 0x47, 0x47, 0x53, 0x5a, 0x58,
-    0x43, 0x44, 0x44, 0x37, 0x56, 0x55, 0x30, 0x2e, 0x3e, 0x3e, 0x2d, 0x2a,
-    0x1f, 0x1f, 0x1e, 0x20, 0x22, 0x20, 0x22, 0x35, 0x34, 0x34, 0x2a, 0x1e,
-    0x1c, 0x19, 0x19, 0x19, 0x19, 0x19, 0x16, 0x19, 0x1e, 0x1f, 0x1d, 0x1e,
-    0x9d, 0xcf, 0xe1, 0xe4, 0xd3, 0xb7, 0xac, 0x84, 0x63, 0x54, 0x5e, 0x61,
-    0x77, 0x75, 0x75, 0x50, 0x5e, 0x78, 0x48, 0x2e, 0x36, 0x46, 0x58, 0x61,
-    0x63, 0x63, 0x73, 0x5a, 0x64, 0x2d, 0x2d, 0x27, 0x27, 0x3d, 0x2d, 0x2b,
-    0x21, 0x4e, 0x3e, 0x46, 0x77, 0x75, 0x85, 0x97, 0x93, 0x93, 0x93, 0x74,
-    0x53, 0x2d, 0x1f, 0x2f, 0x40, 0x47, 0x47, 0x47, 0x2e, 0x28, 0x28, 0x28,
-    0x1f, 0x1b, 0x14, 0x10, 0x13, 0x16, 0x0c, 0x0c, 0x05, 0x08, 0x0a, 0x0d,
-    0x0d, 0x0d, 0x0a, 0x0a, 0x12, 0x12, 0x12, 0x1c, 0x12, 0x0a, 0x03, 0x03,
-    0x08, 0x15, 0x35, 0x64, 0x77, 0x75, 0x6b, 0x6b, 0x86, 0x86, 0x58, 0x43,
-    0x44, 0x46, 0x2e, 0x27, 0x2e, 0x3e, 0x23, 0x2e, 0x3e, 0x3e, 0x2e, 0x37,
-    0x47, 0xb4, 0xb4, 0xb7, 0x97, 0x7f, 0x91, 0x91, 0x73, 0x63, 0x61, 0x9f,
-    0x78, 0x61, 0xa0, 0x64, 0x44, 0x53, 0x60, 0x7d, 0x67, 0x49, 0x1e, 0x1b,
-    0x2f, 0x3d, 0x47, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x45, 0x45, 0x45, 0x3d,
-    0x56, 0x45, 0x60, 0x60, 0x50, 0x43, 0x43, 0x60, 0x77, 0x60, 0x60, 0x60,
-    0x87, 0xa0, 0x9d, 0x9d, 0x4e, 0x2e, 0x2e, 0x27, 0x29, 0x1f, 0x14, 0x12,
-    0x0c, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03,
-    0x14, 0x1c, 0x06, 0x03, 0x03, 0x04, 0x03, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x09, 0x06, 0x03, 0x06, 0x06, 0x03, 0x06, 0x0b, 0x13, 0x1c,
-    0x22, 0x22, 0x1c, 0x1c, 0x1c, 0x20, 0x20, 0x1e, 0x1b, 0x14, 0x1b, 0x1e,
-    0x1e, 0x1b, 0x1e, 0x33, 0x1e, 0x14, 0x1e, 0x2a, 0x34, 0x22, 0x22, 0x1c,
-    0x15, 0x15, 0x15, 0x0c, 0x0b, 0x0b, 0x13, 0x1c, 0x20, 0x20, 0x20, 0x31,
-    0x56, 0x7d, 0x7d, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x7d, 0x80,
-    0x6e, 0x67, 0x7d, 0x80, 0x8f, 0x9e, 0xcb, 0xcb, 0x2b, 0x35, 0x52, 0x35,
-    0x3f, 0x35, 0x33, 0x4e, 0x48, 0x47, 0x54, 0x75, 0x86, 0x8c, 0x72, 0x6f,
-    0x81, 0x78, 0x5e, 0x60, 0x77, 0x6c, 0x77, 0x75, 0x58, 0x51, 0x60, 0x44,
-    0x53, 0x55, 0x30, 0x30, 0x30, 0x3e, 0x2d, 0x33, 0x1e, 0x1f, 0x21, 0x22,
-    0x22, 0x35, 0x4f, 0x6e, 0x4e, 0x4e, 0x2a, 0x1e, 0x22, 0x19, 0x21, 0x24,
-    0x19, 0x19, 0x19, 0x21, 0x1f, 0x1e, 0x1f, 0x3d, 0xa0, 0xe3, 0xe4, 0xe4,
-    0xe3, 0xbe, 0xa3, 0x84, 0x50, 0x5e, 0xa1, 0x7e, 0x86, 0x7b, 0x75, 0x63,
-    0x61, 0x64, 0x4c, 0x2f, 0x2f, 0x36, 0x54, 0x63, 0x63, 0x63, 0x4d, 0x47,
-    0x5e, 0x47, 0x64, 0x3e, 0x30, 0x48, 0x48, 0x2a, 0x21, 0x2a, 0x40, 0x47,
-    0x6f, 0x75, 0x84, 0x97, 0xaa, 0xb1, 0x8c, 0x5a, 0x2e, 0x1f, 0x1f, 0x1f,
-    0x2f, 0x2e, 0x3e, 0x3e, 0x30, 0x30, 0x2e, 0x2e, 0x2b, 0x14, 0x10, 0x0d,
-    0x0a, 0x0c, 0x0c, 0x08, 0x03, 0x08, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a,
-    0x0a, 0x0d, 0x12, 0x1c, 0x12, 0x08, 0x05, 0x05, 0x05, 0x0b, 0x35, 0x67,
-    0x77, 0x7a, 0x72, 0x6c, 0x75, 0x77, 0x6b, 0x50, 0x51, 0x55, 0x2e, 0x27,
-    0x3a, 0x3a, 0x2c, 0x2c, 0x23, 0x2e, 0x28, 0x28, 0x2d, 0xa0, 0xa0, 0xb7,
-    0xac, 0x94, 0x84, 0x7f, 0x73, 0x91, 0x9f, 0x75, 0x77, 0x6f, 0x81, 0x6f,
-    0x6f, 0x64, 0x64, 0x7d, 0x80, 0x31, 0x1f, 0x14, 0x1b, 0x3d, 0x47, 0x47,
-    0x47, 0x3e, 0x47, 0x47, 0x55, 0x53, 0x53, 0x45, 0x53, 0x55, 0x53, 0x61,
-    0x5a, 0x43, 0x44, 0x51, 0x60, 0x77, 0x78, 0x77, 0x86, 0x9f, 0x81, 0x81,
-    0x6a, 0x3e, 0x2e, 0x2e, 0x2f, 0x2b, 0x1a, 0x14, 0x0a, 0x05, 0x03, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x03, 0x0a, 0x2a, 0x1c, 0x05, 0x03,
-    0x03, 0x04, 0x03, 0x03, 0x03, 0x05, 0x06, 0x05, 0x03, 0x03, 0x06, 0x03,
-    0x03, 0x06, 0x06, 0x03, 0x06, 0x0b, 0x13, 0x1c, 0x20, 0x20, 0x20, 0x1e,
-    0x1b, 0x20, 0x34, 0x2a, 0x2a, 0x1e, 0x1b, 0x2a, 0x33, 0x1e, 0x1b, 0x1e,
-    0x1e, 0x1e, 0x2a, 0x33, 0x34, 0x22, 0x22, 0x22, 0x26, 0x15, 0x15, 0x0b,
-    0x08, 0x0b, 0x13, 0x13, 0x1c, 0x1c, 0x1c, 0x1e, 0x31, 0x67, 0x67, 0x78,
-    0x78, 0x77, 0x6f, 0x6f, 0x6f, 0x78, 0x80, 0x6e, 0x6e, 0x67, 0x7d, 0x90,
-    0x9e, 0xcb, 0xcb, 0xcb, 0x4c, 0x52, 0x41, 0x41, 0x5d, 0x92, 0x92, 0x80,
-    0x6f, 0x75, 0x75, 0x8c, 0xa2, 0x82, 0x6b, 0x60, 0xa1, 0x81, 0x77, 0x6f,
-    0x86, 0x86, 0x86, 0x85, 0x7a, 0x75, 0x86, 0x5a, 0x51, 0x60, 0x51, 0x47,
-    0x53, 0x48, 0x3d, 0x3d, 0x2a, 0x2a, 0x21, 0x22, 0x35, 0x6e, 0x8f, 0x80,
-    0x67, 0x4e, 0x33, 0x2a, 0x21, 0x21, 0x21, 0x2b, 0x24, 0x19, 0x19, 0x21,
-    0x1e, 0x1e, 0x2b, 0x67, 0xd2, 0xf3, 0xeb, 0xe4, 0xe4, 0xd2, 0xaa, 0x83,
-    0x58, 0x54, 0x69, 0xa0, 0x9f, 0x91, 0x85, 0x74, 0x63, 0x54, 0x2e, 0x29,
-    0x2b, 0x2f, 0x2f, 0x36, 0x46, 0x4a, 0x29, 0x3e, 0x45, 0x46, 0x5e, 0x44,
-    0x37, 0x45, 0x3d, 0x2a, 0x1e, 0x2a, 0x4e, 0x4e, 0x69, 0x5e, 0x75, 0x91,
-    0xa0, 0xa0, 0x77, 0x3e, 0x1a, 0x1e, 0x20, 0x34, 0x56, 0x45, 0x2c, 0x30,
-    0x48, 0x48, 0x30, 0x2e, 0x1d, 0x14, 0x14, 0x12, 0x0a, 0x08, 0x08, 0x05,
-    0x05, 0x0a, 0x12, 0x12, 0x10, 0x12, 0x0d, 0x0d, 0x12, 0x0d, 0x0d, 0x12,
-    0x0d, 0x08, 0x05, 0x05, 0x08, 0x0a, 0x22, 0x67, 0x87, 0x7a, 0x7a, 0x86,
-    0x77, 0x6c, 0x75, 0x5a, 0x50, 0x44, 0x37, 0x2c, 0x3a, 0x3a, 0x2e, 0x23,
-    0x2e, 0x3d, 0x2d, 0x1d, 0x28, 0x6a, 0x81, 0xb4, 0xae, 0x97, 0xaa, 0x97,
-    0x73, 0xae, 0xb4, 0x74, 0x5e, 0x5e, 0x78, 0x6c, 0x7d, 0x7d, 0x67, 0x7d,
-    0x67, 0x2d, 0x2b, 0x1f, 0x1a, 0x2d, 0x47, 0x47, 0x3e, 0x36, 0x3e, 0x47,
-    0x55, 0x51, 0x5a, 0x51, 0x51, 0x55, 0x51, 0x54, 0x51, 0x44, 0x53, 0x64,
-    0x77, 0x87, 0x77, 0x86, 0x91, 0x87, 0x7e, 0x7e, 0x69, 0x47, 0x3e, 0x36,
-    0x2f, 0x2b, 0x1a, 0x14, 0x0a, 0x08, 0x08, 0x02, 0x00, 0x00, 0x00, 0x02,
-    0x02, 0x05, 0x07, 0x10, 0x2a, 0x11, 0x03, 0x03, 0x03, 0x03, 0x05, 0x05,
-    0x05, 0x05, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03, 0x06, 0x06, 0x03,
-    0x06, 0x08, 0x0b, 0x13, 0x1c, 0x1c, 0x1c, 0x1e, 0x1e, 0x1e, 0x2a, 0x2a,
-    0x1d, 0x1d, 0x1d, 0x28, 0x2d, 0x2b, 0x1b, 0x1e, 0x2a, 0x33, 0x33, 0x33,
-    0x34, 0x35, 0x26, 0x22, 0x26, 0x26, 0x15, 0x18, 0x0b, 0x06, 0x07, 0x0b,
-    0x0b, 0x13, 0x1c, 0x20, 0x1e, 0x49, 0x56, 0x64, 0x64, 0x6f, 0x6f, 0x77,
-    0x78, 0x80, 0x6e, 0x49, 0x67, 0x7d, 0x90, 0x9e, 0xcb, 0xcb, 0xcb, 0xcb,
-    0x5d, 0x5d, 0x38, 0x65, 0x99, 0x99, 0xc3, 0xc4, 0xac, 0x97, 0x8c, 0xb1,
-    0xaa, 0x82, 0x58, 0x51, 0x9d, 0xa0, 0x7e, 0x86, 0x86, 0xa2, 0x8c, 0x85,
-    0xa2, 0x86, 0x86, 0x6b, 0x6c, 0x77, 0x51, 0x47, 0x55, 0x3e, 0x40, 0x33,
-    0x33, 0x2a, 0x20, 0x20, 0x4f, 0x8f, 0x8f, 0x80, 0x67, 0x49, 0x33, 0x2a,
-    0x2a, 0x2a, 0x33, 0x35, 0x24, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x28, 0x67,
-    0xe4, 0xf3, 0xeb, 0xe3, 0xe4, 0xe3, 0xac, 0x84, 0x6b, 0x61, 0x77, 0x81,
-    0xa0, 0x91, 0x91, 0x7b, 0x7b, 0x51, 0x44, 0x2e, 0x36, 0x33, 0x21, 0x1e,
-    0x2b, 0x2f, 0x2f, 0x5e, 0x60, 0x51, 0x5a, 0x6f, 0x51, 0x55, 0x2f, 0x2a,
-    0x19, 0x33, 0x33, 0x2a, 0x35, 0x4c, 0x5e, 0x7e, 0x81, 0x6a, 0x3d, 0x2d,
-    0x28, 0x2d, 0x33, 0x49, 0x67, 0x53, 0x37, 0x56, 0x56, 0x67, 0x45, 0x23,
-    0x28, 0x28, 0x1f, 0x1b, 0x0d, 0x08, 0x05, 0x05, 0x08, 0x0d, 0x19, 0x19,
-    0x1b, 0x10, 0x0d, 0x10, 0x1b, 0x10, 0x0d, 0x0d, 0x0a, 0x0a, 0x08, 0x05,
-    0x08, 0x13, 0x20, 0x67, 0xa0, 0x9a, 0x9a, 0x8c, 0x75, 0x6b, 0x75, 0x5a,
-    0x44, 0x43, 0x51, 0x44, 0x37, 0x2c, 0x2c, 0x2e, 0x2d, 0x2d, 0x28, 0x1a,
-    0x1a, 0x2b, 0x4c, 0xb4, 0xbe, 0xa3, 0xb7, 0xa3, 0x83, 0x91, 0x87, 0x61,
-    0x78, 0x78, 0x60, 0x77, 0x9d, 0x7d, 0x78, 0x7d, 0x4e, 0x2b, 0x2b, 0x1f,
-    0x28, 0x2b, 0x2d, 0x2b, 0x1f, 0x1e, 0x2b, 0x3d, 0x48, 0x55, 0x47, 0x55,
-    0x54, 0x55, 0x53, 0x6f, 0x51, 0x51, 0x53, 0x78, 0x77, 0x86, 0x91, 0x86,
-    0x91, 0x91, 0x86, 0x77, 0x5e, 0x4a, 0x36, 0x2f, 0x29, 0x28, 0x1d, 0x1e,
-    0x12, 0x0a, 0x0b, 0x03, 0x00, 0x00, 0x02, 0x02, 0x06, 0x07, 0x10, 0x1b,
-    0x34, 0x11, 0x05, 0x06, 0x08, 0x05, 0x08, 0x0c, 0x0b, 0x08, 0x05, 0x03,
-    0x03, 0x02, 0x02, 0x02, 0x03, 0x06, 0x06, 0x03, 0x03, 0x05, 0x0b, 0x0b,
-    0x13, 0x10, 0x1c, 0x1e, 0x2a, 0x2a, 0x2a, 0x1d, 0x1a, 0x2d, 0x28, 0x1d,
-    0x28, 0x28, 0x1f, 0x2a, 0x2f, 0x33, 0x33, 0x33, 0x34, 0x35, 0x26, 0x22,
-    0x1c, 0x26, 0x15, 0x15, 0x0b, 0x06, 0x06, 0x06, 0x0b, 0x0b, 0x13, 0x22,
-    0x20, 0x20, 0x2a, 0x31, 0x48, 0x5e, 0x6f, 0x64, 0x81, 0x80, 0x4e, 0x49,
-    0x56, 0x80, 0x90, 0x9e, 0xc7, 0xcb, 0xcb, 0xcb, 0x3b, 0x65, 0x99, 0x99,
-    0x99, 0xc3, 0xc3, 0xd4, 0xbb, 0x93, 0xaa, 0xcc, 0xa5, 0x7f, 0x68, 0x51,
-    0x67, 0x81, 0x81, 0x9f, 0x91, 0xac, 0xaa, 0xaa, 0xbb, 0xa2, 0xa2, 0x72,
-    0x58, 0x75, 0x44, 0x37, 0x3e, 0x2e, 0x2f, 0x2f, 0x33, 0x33, 0x34, 0x34,
-    0x6e, 0x8f, 0x8f, 0x80, 0x67, 0x49, 0x33, 0x33, 0x2f, 0x2b, 0x2f, 0x2f,
-    0x2b, 0x1f, 0x1f, 0x27, 0x1d, 0x28, 0x3e, 0x87, 0xd2, 0xf0, 0xf0, 0xee,
-    0xd3, 0xd3, 0xac, 0x84, 0x74, 0x6f, 0xb4, 0xa0, 0x91, 0x91, 0x91, 0x75,
-    0x77, 0x6f, 0x60, 0x37, 0x2e, 0x40, 0x2b, 0x2b, 0x36, 0x36, 0x4a, 0x6f,
-    0x77, 0x77, 0x86, 0x7d, 0x64, 0x6a, 0x33, 0x14, 0x19, 0x2a, 0x35, 0x2a,
-    0x1c, 0x35, 0x35, 0x35, 0x35, 0x1e, 0x1e, 0x33, 0x36, 0x3e, 0x2e, 0x37,
-    0x53, 0x53, 0x53, 0x64, 0x55, 0x46, 0x45, 0x30, 0x3e, 0x48, 0x2a, 0x20,
-    0x0d, 0x07, 0x07, 0x07, 0x0a, 0x19, 0x1e, 0x24, 0x1e, 0x14, 0x10, 0x14,
-    0x1b, 0x14, 0x12, 0x0d, 0x0d, 0x13, 0x0a, 0x05, 0x08, 0x13, 0x1c, 0x67,
-    0xa0, 0x9b, 0x9a, 0x8c, 0x85, 0x6b, 0x6b, 0x51, 0x3a, 0x44, 0x54, 0x46,
-    0x44, 0x37, 0x37, 0x2e, 0x28, 0x2b, 0x1f, 0x14, 0x14, 0x1e, 0x1f, 0x9d,
-    0xb7, 0xa3, 0xd1, 0xbc, 0x83, 0x8c, 0x91, 0x91, 0xa0, 0x9d, 0x77, 0x78,
-    0x9d, 0x7d, 0x78, 0x49, 0x2b, 0x2b, 0x1f, 0x1e, 0x2b, 0x2b, 0x2a, 0x1b,
-    0x14, 0x14, 0x1e, 0x1e, 0x1e, 0x2a, 0x1c, 0x33, 0x55, 0x54, 0x60, 0x6f,
-    0x78, 0x6f, 0x77, 0x78, 0x6f, 0x61, 0x86, 0x86, 0x86, 0x91, 0x86, 0x86,
-    0x55, 0x3e, 0x3e, 0x28, 0x27, 0x27, 0x28, 0x28, 0x1b, 0x12, 0x0a, 0x05,
-    0x02, 0x02, 0x02, 0x05, 0x0b, 0x13, 0x1b, 0x1d, 0x49, 0x06, 0x06, 0x0a,
-    0x13, 0x13, 0x12, 0x1c, 0x20, 0x1c, 0x0a, 0x05, 0x03, 0x02, 0x02, 0x02,
-    0x03, 0x06, 0x06, 0x06, 0x03, 0x03, 0x05, 0x0b, 0x13, 0x1c, 0x1b, 0x1e,
-    0x31, 0x31, 0x28, 0x1d, 0x28, 0x3d, 0x2d, 0x28, 0x1d, 0x2d, 0x2d, 0x2b,
-    0x40, 0x4e, 0x33, 0x33, 0x34, 0x35, 0x26, 0x1c, 0x22, 0x22, 0x26, 0x15,
-    0x09, 0x06, 0x06, 0x09, 0x0b, 0x0b, 0x13, 0x22, 0x22, 0x20, 0x22, 0x20,
-    0x2a, 0x33, 0x49, 0x4e, 0x4e, 0x49, 0x4e, 0x49, 0x56, 0x67, 0x80, 0x90,
-    0xc7, 0xcb, 0xcb, 0xcb, 0x99, 0x99, 0x99, 0xc3, 0xc3, 0xc3, 0xc3, 0xd4,
-    0xcc, 0xa5, 0xa2, 0xaa, 0xa8, 0x7f, 0x68, 0x50, 0x5e, 0x64, 0x80, 0xa0,
-    0x9f, 0xb1, 0xbe, 0xb1, 0xbe, 0xbb, 0xaa, 0x84, 0x6b, 0x5a, 0x51, 0x44,
-    0x3e, 0x3e, 0x2d, 0x2b, 0x34, 0x34, 0x4f, 0x80, 0x80, 0x9d, 0x80, 0x80,
-    0x67, 0x4e, 0x33, 0x2f, 0x40, 0x2f, 0x2f, 0x35, 0x2f, 0x2b, 0x29, 0x2e,
-    0x27, 0x3e, 0x55, 0x9f, 0xdd, 0xf3, 0xf2, 0xe3, 0xbb, 0xa3, 0x84, 0x61,
-    0x6b, 0x5a, 0x9d, 0xd4, 0xb7, 0xa3, 0x84, 0x74, 0x7e, 0x77, 0x61, 0x5e,
-    0x3e, 0x40, 0x2b, 0x2f, 0x4a, 0x4a, 0x5e, 0x6f, 0x86, 0x86, 0x86, 0x78,
-    0x67, 0x4e, 0x2f, 0x1f, 0x1e, 0x1e, 0x1e, 0x1e, 0x0c, 0x0c, 0x0c, 0x12,
-    0x1c, 0x1b, 0x1b, 0x2f, 0x36, 0x3e, 0x44, 0x44, 0x51, 0x51, 0x53, 0x5a,
-    0x58, 0x43, 0x44, 0x53, 0x45, 0x2d, 0x1d, 0x12, 0x0a, 0x0c, 0x0c, 0x0a,
-    0x12, 0x19, 0x21, 0x2b, 0x1e, 0x1b, 0x14, 0x14, 0x1b, 0x14, 0x14, 0x10,
-    0x10, 0x0d, 0x07, 0x08, 0x0b, 0x13, 0x1c, 0x49, 0xa0, 0xa0, 0xa0, 0x8c,
-    0x85, 0x6b, 0x58, 0x58, 0x44, 0x44, 0x44, 0x3a, 0x3e, 0x3e, 0x3e, 0x2e,
-    0x2d, 0x28, 0x1a, 0x14, 0x14, 0x1b, 0x1e, 0x2f, 0x9f, 0x81, 0xd2, 0xce,
-    0x97, 0xbc, 0xae, 0xb4, 0x9d, 0xa0, 0xa0, 0x7d, 0x7d, 0x7d, 0x67, 0x28,
-    0x2b, 0x2b, 0x1d, 0x1d, 0x2b, 0x28, 0x1d, 0x1f, 0x14, 0x1c, 0x1b, 0x10,
-    0x0a, 0x0c, 0x05, 0x13, 0x4e, 0x61, 0x54, 0x51, 0x78, 0x78, 0x78, 0x7e,
-    0x86, 0x75, 0x75, 0x85, 0x85, 0x84, 0x85, 0x86, 0x47, 0x27, 0x3e, 0x3e,
-    0x3e, 0x2e, 0x2b, 0x2b, 0x1b, 0x10, 0x0a, 0x05, 0x02, 0x00, 0x02, 0x07,
-    0x13, 0x13, 0x20, 0x2d, 0x35, 0x0b, 0x1c, 0x2a, 0x2a, 0x2d, 0x3e, 0x53,
-    0x5e, 0x48, 0x2a, 0x12, 0x05, 0x03, 0x02, 0x02, 0x04, 0x06, 0x06, 0x06,
-    0x06, 0x03, 0x02, 0x11, 0x13, 0x1c, 0x20, 0x20, 0x2a, 0x2d, 0x2d, 0x28,
-    0x30, 0x3d, 0x40, 0x2d, 0x27, 0x3d, 0x49, 0x33, 0x33, 0x2d, 0x2d, 0x4e,
-    0x4e, 0x3c, 0x26, 0x1c, 0x22, 0x20, 0x22, 0x26, 0x15, 0x06, 0x06, 0x0b,
-    0x0b, 0x13, 0x13, 0x13, 0x13, 0x22, 0x34, 0x20, 0x20, 0x2a, 0x33, 0x33,
-    0x33, 0x33, 0x4e, 0x3d, 0x48, 0x67, 0x7d, 0x90, 0xc7, 0xcb, 0xcb, 0xcb,
-    0x99, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xec, 0xcf, 0xa8, 0x94, 0x82,
-    0xa2, 0x82, 0x72, 0x4b, 0x44, 0x45, 0x56, 0xa0, 0xb4, 0xd1, 0xce, 0xce,
-    0xce, 0xaa, 0x97, 0x97, 0x85, 0x75, 0x5a, 0x45, 0x47, 0x47, 0x40, 0x33,
-    0x34, 0x4e, 0x4e, 0x80, 0x81, 0x80, 0x80, 0x80, 0x6a, 0x4e, 0x40, 0x2f,
-    0x40, 0x40, 0x2f, 0x40, 0x4e, 0x48, 0x3d, 0x3e, 0x3e, 0x47, 0x56, 0x9d,
-    0xe1, 0xe4, 0xe5, 0xe3, 0xac, 0x91, 0x74, 0x75, 0x61, 0x77, 0xb7, 0xba,
-    0xd3, 0xac, 0xa3, 0x91, 0x91, 0x75, 0x61, 0x5e, 0x47, 0x36, 0x2f, 0x4c,
-    0x55, 0x54, 0x61, 0x75, 0x86, 0x86, 0x77, 0x6f, 0x64, 0x3d, 0x28, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x1c, 0x13, 0x0d, 0x12, 0x1c, 0x21, 0x21, 0x1e, 0x2b,
-    0x36, 0x2e, 0x47, 0x5e, 0x60, 0x5a, 0x60, 0x58, 0x4b, 0x4b, 0x53, 0x60,
-    0x45, 0x23, 0x1a, 0x14, 0x0d, 0x12, 0x12, 0x0d, 0x12, 0x19, 0x1e, 0x1e,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x14, 0x14, 0x1b, 0x1e, 0x14, 0x0a, 0x0a, 0x08,
-    0x08, 0x13, 0x12, 0x33, 0x87, 0x9f, 0xa2, 0x8c, 0x85, 0x75, 0x58, 0x58,
-    0x44, 0x44, 0x37, 0x37, 0x2e, 0x27, 0x3e, 0x2d, 0x3d, 0x28, 0x1d, 0x14,
-    0x14, 0x1b, 0x1e, 0x1f, 0x3d, 0x6a, 0xd3, 0xce, 0xbc, 0xbe, 0xae, 0xb7,
-    0x78, 0x81, 0x87, 0xa0, 0xa0, 0x7d, 0x49, 0x2b, 0x2f, 0x2d, 0x28, 0x28,
-    0x2d, 0x3d, 0x2e, 0x2b, 0x14, 0x1b, 0x14, 0x10, 0x0a, 0x07, 0x05, 0x07,
-    0x34, 0x4c, 0x2a, 0x3d, 0x6a, 0x78, 0x78, 0x77, 0x86, 0x75, 0x85, 0x85,
-    0x84, 0x84, 0x91, 0x6f, 0x44, 0x30, 0x55, 0x55, 0x55, 0x2e, 0x1d, 0x1b,
-    0x19, 0x0d, 0x0a, 0x05, 0x02, 0x02, 0x05, 0x0a, 0x10, 0x10, 0x20, 0x33,
-    0x3f, 0x1c, 0x33, 0x3e, 0x47, 0x51, 0x6b, 0x75, 0x91, 0x86, 0x6f, 0x31,
-    0x13, 0x05, 0x03, 0x03, 0x03, 0x06, 0x06, 0x06, 0x06, 0x03, 0x02, 0x11,
-    0x13, 0x1c, 0x1c, 0x1c, 0x2a, 0x2a, 0x28, 0x2d, 0x2d, 0x2d, 0x2d, 0x28,
-    0x30, 0x48, 0x48, 0x2d, 0x2d, 0x2d, 0x3d, 0x4e, 0x34, 0x3c, 0x26, 0x22,
-    0x20, 0x20, 0x22, 0x26, 0x11, 0x06, 0x0b, 0x0b, 0x0b, 0x0b, 0x13, 0x13,
-    0x13, 0x26, 0x20, 0x20, 0x26, 0x20, 0x34, 0x33, 0x33, 0x33, 0x33, 0x40,
-    0x48, 0x67, 0x7d, 0x9e, 0xcb, 0xcb, 0xcb, 0xcb, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xd4, 0xcf, 0xbb, 0x9c, 0x7f, 0x7a, 0xa2, 0xa2, 0x7a,
-    0x42, 0x30, 0x67, 0x9d, 0xd3, 0xd3, 0xe0, 0xdc, 0xd1, 0xbc, 0xa2, 0x93,
-    0x85, 0x6c, 0x6f, 0x47, 0x3e, 0x2d, 0x33, 0x33, 0x4e, 0x4e, 0x4e, 0x69,
-    0x7e, 0x81, 0x6a, 0x6e, 0x6a, 0x4e, 0x2f, 0x2d, 0x2f, 0x4c, 0x4c, 0x4c,
-    0x52, 0x52, 0x4c, 0x47, 0x47, 0x44, 0x56, 0x9d, 0xd3, 0xce, 0xb2, 0xae,
-    0xa3, 0x83, 0x75, 0x61, 0x5e, 0x9d, 0xe4, 0xd3, 0xd2, 0xd1, 0xb7, 0x9f,
-    0x98, 0x74, 0x63, 0x54, 0x47, 0x27, 0x1f, 0x52, 0x4c, 0x5e, 0x77, 0x91,
-    0x8c, 0x91, 0x77, 0x5e, 0x56, 0x3e, 0x28, 0x2f, 0x2d, 0x28, 0x28, 0x2a,
-    0x20, 0x1c, 0x20, 0x33, 0x33, 0x2b, 0x1e, 0x28, 0x27, 0x2e, 0x37, 0x51,
-    0x58, 0x6c, 0x77, 0x58, 0x4b, 0x4b, 0x51, 0x44, 0x37, 0x23, 0x27, 0x1e,
-    0x1c, 0x1c, 0x19, 0x19, 0x16, 0x19, 0x1b, 0x14, 0x14, 0x1b, 0x1e, 0x1e,
-    0x1b, 0x1b, 0x1d, 0x1d, 0x1b, 0x14, 0x0d, 0x0c, 0x08, 0x0c, 0x0d, 0x1b,
-    0x64, 0x91, 0x8c, 0x85, 0x85, 0x6b, 0x58, 0x58, 0x50, 0x44, 0x37, 0x2c,
-    0x27, 0x1d, 0x28, 0x28, 0x28, 0x28, 0x1b, 0x1b, 0x1b, 0x1b, 0x1e, 0x1f,
-    0x28, 0x40, 0xb7, 0xce, 0xd0, 0xce, 0xbe, 0xb7, 0x86, 0x91, 0x87, 0x9d,
-    0xa0, 0x7d, 0x33, 0x2b, 0x2f, 0x2e, 0x28, 0x2d, 0x3e, 0x3e, 0x3e, 0x2b,
-    0x1b, 0x1e, 0x1a, 0x1b, 0x14, 0x10, 0x08, 0x05, 0x0b, 0x18, 0x06, 0x13,
-    0x4e, 0x6a, 0x78, 0x86, 0x77, 0x6b, 0x73, 0x84, 0x84, 0x97, 0x75, 0x6c,
-    0x6c, 0x51, 0x47, 0x55, 0x55, 0x2e, 0x28, 0x1f, 0x19, 0x19, 0x12, 0x0a,
-    0x08, 0x08, 0x0a, 0x10, 0x10, 0x1b, 0x31, 0x4f, 0x25, 0x2a, 0x48, 0x5e,
-    0x5a, 0x58, 0x74, 0x98, 0xa3, 0x9f, 0x91, 0x64, 0x2a, 0x0c, 0x06, 0x03,
-    0x03, 0x03, 0x06, 0x06, 0x06, 0x04, 0x03, 0x06, 0x0b, 0x0a, 0x10, 0x20,
-    0x1e, 0x1e, 0x28, 0x3d, 0x3d, 0x2d, 0x27, 0x2d, 0x30, 0x3d, 0x3d, 0x3d,
-    0x3d, 0x3d, 0x49, 0x4e, 0x20, 0x34, 0x26, 0x22, 0x20, 0x20, 0x22, 0x15,
-    0x0b, 0x06, 0x0b, 0x0b, 0x0b, 0x13, 0x13, 0x13, 0x13, 0x26, 0x26, 0x3c,
-    0x3c, 0x3c, 0x3c, 0x34, 0x34, 0x34, 0x31, 0x40, 0x48, 0x64, 0x80, 0x9e,
-    0xcb, 0xcb, 0xcb, 0xcb, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xe4,
-    0xcf, 0xc6, 0xb8, 0xa2, 0x9a, 0xb2, 0xb2, 0x7a, 0x51, 0x56, 0x80, 0x8f,
-    0xa1, 0xd3, 0xe0, 0xce, 0xbe, 0xbe, 0xa2, 0x84, 0x85, 0x5a, 0x5e, 0x4c,
-    0x31, 0x35, 0x35, 0x4e, 0x6e, 0x80, 0x56, 0x60, 0x6f, 0x69, 0x6a, 0x6a,
-    0x4e, 0x40, 0x2f, 0x2e, 0x2f, 0x4a, 0x4c, 0x52, 0x52, 0x52, 0x4c, 0x47,
-    0x55, 0x53, 0x64, 0x81, 0xa0, 0xac, 0xaf, 0x7f, 0x74, 0x75, 0x61, 0x5e,
-    0x69, 0x80, 0xd4, 0xe4, 0xb4, 0xd1, 0xb7, 0xac, 0x98, 0x73, 0x61, 0x5e,
-    0x3e, 0x2e, 0x28, 0x2a, 0x2f, 0x6d, 0x7e, 0x9f, 0x86, 0x86, 0x5e, 0x47,
-    0x48, 0x2e, 0x2e, 0x3d, 0x3d, 0x27, 0x2e, 0x2f, 0x2a, 0x22, 0x22, 0x33,
-    0x2f, 0x2b, 0x1f, 0x40, 0x48, 0x47, 0x44, 0x44, 0x50, 0x5a, 0x77, 0x7a,
-    0x6b, 0x77, 0x5a, 0x44, 0x37, 0x30, 0x30, 0x2b, 0x21, 0x19, 0x19, 0x19,
-    0x19, 0x1e, 0x1e, 0x1e, 0x1e, 0x1d, 0x1f, 0x1f, 0x1d, 0x1d, 0x28, 0x1e,
-    0x1e, 0x1b, 0x1b, 0x0d, 0x0c, 0x0b, 0x0a, 0x10, 0x33, 0x87, 0x91, 0x85,
-    0x72, 0x58, 0x58, 0x5a, 0x46, 0x3e, 0x2e, 0x23, 0x2d, 0x2d, 0x1d, 0x1b,
-    0x1b, 0x1f, 0x1d, 0x1f, 0x1f, 0x1e, 0x1e, 0x1f, 0x2b, 0x1f, 0x6a, 0xd1,
-    0xd1, 0xbe, 0xb7, 0xbe, 0x9f, 0x91, 0x86, 0x7e, 0x9d, 0x31, 0x2a, 0x2b,
-    0x2f, 0x2f, 0x1f, 0x2d, 0x40, 0x3d, 0x3d, 0x2a, 0x1e, 0x2b, 0x2b, 0x2b,
-    0x1f, 0x14, 0x0a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x06, 0x22, 0x4e, 0x69,
-    0x75, 0x6b, 0x84, 0x91, 0x84, 0x75, 0x5a, 0x5e, 0x5e, 0x55, 0x3e, 0x30,
-    0x3d, 0x2d, 0x2e, 0x2d, 0x2a, 0x19, 0x14, 0x0d, 0x0c, 0x0b, 0x10, 0x1b,
-    0x1b, 0x1d, 0x31, 0x33, 0x49, 0x48, 0x55, 0x58, 0x6b, 0x6b, 0x74, 0x83,
-    0x97, 0xa3, 0xa3, 0x77, 0x40, 0x1c, 0x09, 0x05, 0x03, 0x03, 0x06, 0x06,
-    0x06, 0x06, 0x03, 0x03, 0x05, 0x08, 0x13, 0x20, 0x2a, 0x2a, 0x28, 0x3d,
-    0x3d, 0x2d, 0x30, 0x48, 0x3d, 0x30, 0x30, 0x45, 0x48, 0x56, 0x49, 0x34,
-    0x20, 0x22, 0x26, 0x22, 0x22, 0x22, 0x13, 0x0b, 0x06, 0x06, 0x0b, 0x0b,
-    0x13, 0x13, 0x13, 0x13, 0x26, 0x26, 0x26, 0x3c, 0x62, 0x62, 0x62, 0x59,
-    0x59, 0x4f, 0x34, 0x49, 0x49, 0x6e, 0x9e, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc7, 0xe4, 0xdd, 0xdc, 0xb8, 0xa2,
-    0xb2, 0xae, 0xaa, 0x72, 0x44, 0x64, 0x80, 0x9d, 0x81, 0xa1, 0xd1, 0xbe,
-    0xbe, 0xae, 0x91, 0x74, 0x6c, 0x54, 0x55, 0x48, 0x33, 0x35, 0x34, 0x6e,
-    0x9d, 0x9d, 0x78, 0x5a, 0x54, 0x55, 0x4e, 0x4e, 0x4c, 0x40, 0x40, 0x40,
-    0x52, 0x52, 0x52, 0x6d, 0x6d, 0x4c, 0x69, 0x69, 0x5e, 0x60, 0x64, 0x7d,
-    0x78, 0x78, 0x86, 0x6f, 0x6f, 0x64, 0x56, 0x4e, 0x52, 0x6d, 0xb9, 0xe3,
-    0xce, 0xbc, 0xac, 0xa2, 0x91, 0x74, 0x54, 0x4c, 0x56, 0x40, 0x2f, 0x3d,
-    0x2f, 0x2f, 0x6a, 0x7e, 0x7b, 0x61, 0x37, 0x47, 0x3e, 0x30, 0x3a, 0x2e,
-    0x3e, 0x27, 0x27, 0x2b, 0x2a, 0x21, 0x21, 0x2a, 0x2f, 0x2b, 0x2b, 0x40,
-    0x4c, 0x3e, 0x53, 0x60, 0x6c, 0x58, 0x6c, 0x75, 0x7a, 0x87, 0x77, 0x77,
-    0x53, 0x45, 0x28, 0x1b, 0x1c, 0x12, 0x1c, 0x19, 0x21, 0x2a, 0x2a, 0x2a,
-    0x2b, 0x28, 0x1d, 0x1d, 0x28, 0x28, 0x2a, 0x1e, 0x1e, 0x1e, 0x1b, 0x12,
-    0x0c, 0x0b, 0x0c, 0x0a, 0x12, 0x40, 0x6f, 0x77, 0x6c, 0x50, 0x51, 0x3e,
-    0x28, 0x28, 0x2e, 0x30, 0x3e, 0x3d, 0x1d, 0x1d, 0x1f, 0x28, 0x27, 0x1d,
-    0x1d, 0x1f, 0x1e, 0x1b, 0x1e, 0x19, 0x1c, 0x6e, 0xa1, 0x9f, 0xbe, 0xac,
-    0xa3, 0x91, 0x86, 0x64, 0x35, 0x21, 0x2b, 0x2b, 0x2b, 0x2b, 0x1d, 0x2d,
-    0x40, 0x2e, 0x2d, 0x2a, 0x2a, 0x2f, 0x3d, 0x3d, 0x2f, 0x1b, 0x0a, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x10, 0x33, 0x4c, 0x47, 0x54, 0x61,
-    0x54, 0x3a, 0x46, 0x55, 0x46, 0x47, 0x2e, 0x27, 0x27, 0x2e, 0x2d, 0x2d,
-    0x2b, 0x1b, 0x19, 0x12, 0x13, 0x13, 0x1b, 0x1b, 0x20, 0x31, 0x31, 0x49,
-    0x4c, 0x5e, 0x51, 0x63, 0x63, 0x6b, 0x74, 0x7f, 0x83, 0x97, 0x97, 0x75,
-    0x47, 0x1c, 0x0b, 0x05, 0x05, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02,
-    0x03, 0x0b, 0x13, 0x20, 0x2a, 0x2a, 0x2a, 0x2d, 0x3d, 0x3d, 0x48, 0x56,
-    0x48, 0x45, 0x45, 0x56, 0x56, 0x6a, 0x6e, 0x3c, 0x20, 0x22, 0x26, 0x22,
-    0x22, 0x22, 0x15, 0x06, 0x06, 0x06, 0x06, 0x0b, 0x13, 0x13, 0x13, 0x1c,
-    0x26, 0x26, 0x3c, 0x3c, 0x62, 0x62, 0x62, 0x95, 0x95, 0x95, 0x62, 0x62,
-    0x9e, 0xc7, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xec, 0xe4, 0xdd, 0xdc, 0xbb, 0xaa, 0xa2, 0x7a, 0x75, 0x6c,
-    0x45, 0x47, 0x69, 0x69, 0x56, 0x6d, 0xa1, 0xb7, 0xbe, 0xa3, 0x85, 0x61,
-    0x54, 0x47, 0x4c, 0x49, 0x35, 0x35, 0x4f, 0x8f, 0xb9, 0xba, 0x9f, 0x61,
-    0x54, 0x4c, 0x52, 0x52, 0x4c, 0x48, 0x4e, 0x6d, 0x6d, 0x6d, 0x6d, 0x69,
-    0x4c, 0x56, 0x69, 0x6a, 0x78, 0x78, 0x78, 0x87, 0x77, 0x60, 0x53, 0x56,
-    0x56, 0x4c, 0x2f, 0x35, 0x52, 0x3f, 0x8f, 0xe4, 0xe3, 0xcf, 0xbb, 0x8c,
-    0x9f, 0x75, 0x43, 0x55, 0x56, 0x3e, 0x48, 0x4c, 0x4a, 0x36, 0x2f, 0x4a,
-    0x55, 0x55, 0x3a, 0x37, 0x44, 0x55, 0x46, 0x46, 0x47, 0x2e, 0x2e, 0x2f,
-    0x2a, 0x21, 0x24, 0x24, 0x2f, 0x2f, 0x2f, 0x2f, 0x36, 0x45, 0x56, 0xa0,
-    0x75, 0x58, 0x75, 0x86, 0x86, 0x9a, 0x86, 0x77, 0x60, 0x53, 0x2d, 0x19,
-    0x12, 0x14, 0x1b, 0x1f, 0x1e, 0x2a, 0x2a, 0x28, 0x2d, 0x2e, 0x2d, 0x28,
-    0x28, 0x2d, 0x28, 0x1f, 0x1d, 0x1e, 0x1b, 0x0d, 0x0a, 0x0a, 0x13, 0x1c,
-    0x1e, 0x1d, 0x3d, 0x5e, 0x51, 0x44, 0x45, 0x28, 0x1d, 0x2d, 0x3e, 0x45,
-    0x47, 0x3e, 0x28, 0x28, 0x2d, 0x2e, 0x2e, 0x27, 0x1d, 0x1d, 0x1e, 0x14,
-    0x12, 0x16, 0x0c, 0x09, 0x18, 0x3c, 0xa0, 0xae, 0xa3, 0x91, 0x6f, 0x1e,
-    0x19, 0x21, 0x2a, 0x2b, 0x2b, 0x1f, 0x28, 0x3d, 0x3d, 0x3e, 0x28, 0x1e,
-    0x1e, 0x2d, 0x3d, 0x3d, 0x28, 0x1e, 0x13, 0x03, 0x02, 0x00, 0x00, 0x02,
-    0x08, 0x0a, 0x13, 0x13, 0x13, 0x1c, 0x1e, 0x1d, 0x1d, 0x1d, 0x28, 0x2b,
-    0x2d, 0x30, 0x3e, 0x3e, 0x2d, 0x1f, 0x1e, 0x1d, 0x1e, 0x1b, 0x1c, 0x12,
-    0x12, 0x1c, 0x2a, 0x1d, 0x1d, 0x20, 0x34, 0x3d, 0x46, 0x54, 0x51, 0x61,
-    0x75, 0x74, 0x74, 0x71, 0x7f, 0x83, 0x83, 0x74, 0x55, 0x1e, 0x0c, 0x07,
-    0x05, 0x03, 0x03, 0x03, 0x06, 0x03, 0x02, 0x02, 0x03, 0x06, 0x13, 0x13,
-    0x1c, 0x1c, 0x1e, 0x31, 0x48, 0x48, 0x56, 0x56, 0x56, 0x45, 0x53, 0x60,
-    0x56, 0x6a, 0x6a, 0x34, 0x22, 0x22, 0x26, 0x22, 0x22, 0x22, 0x26, 0x0f,
-    0x06, 0x06, 0x06, 0x0b, 0x13, 0x13, 0x1c, 0x22, 0x22, 0x26, 0x3c, 0x3c,
-    0x59, 0x62, 0x62, 0x95, 0x95, 0x95, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb,
-    0xcb, 0xcb, 0xcb, 0xcb, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc4, 0xe4,
-    0xe1, 0xdc, 0xcc, 0xcc, 0xa2, 0x68, 0x51, 0x60, 0x53, 0x2d, 0x2d, 0x3d,
-    0x2f, 0x2a, 0x6d, 0x81, 0x7e, 0x7b, 0x7b, 0x54, 0x47, 0x69, 0x80, 0x6e,
-    0x3f, 0x3c, 0x59, 0x8f, 0xb9, 0xba, 0x9f, 0x6f, 0x55, 0x52, 0x52, 0x4e,
-    0x52, 0x4e, 0x6d, 0x6e, 0x6e, 0x6e, 0x6a, 0x6a, 0x69, 0x4c, 0x6a, 0x6a,
-    0x81, 0x81, 0x87, 0x86, 0x77, 0x60, 0x53, 0x45, 0x3e, 0x2d, 0x2b, 0x22,
-    0x25, 0x18, 0x11, 0xec, 0xf3, 0xe1, 0xcf, 0xa2, 0x85, 0x75, 0x5a, 0x53,
-    0x45, 0x40, 0x4e, 0x81, 0x69, 0x4a, 0x3e, 0x3a, 0x47, 0x55, 0x51, 0x42,
-    0x51, 0x6f, 0x44, 0x47, 0x47, 0x3e, 0x3d, 0x40, 0x35, 0x35, 0x35, 0x2f,
-    0x40, 0x4c, 0x40, 0x2f, 0x47, 0x69, 0x55, 0x60, 0x6c, 0x77, 0x9a, 0x8c,
-    0x8c, 0x9a, 0x86, 0x77, 0x6c, 0x53, 0x3d, 0x1e, 0x1b, 0x1f, 0x2b, 0x2b,
-    0x2a, 0x2b, 0x28, 0x2d, 0x3d, 0x3e, 0x2e, 0x28, 0x2d, 0x30, 0x28, 0x28,
-    0x28, 0x1d, 0x1b, 0x10, 0x13, 0x15, 0x22, 0x22, 0x2a, 0x2d, 0x3d, 0x48,
-    0x47, 0x45, 0x48, 0x2d, 0x2d, 0x2d, 0x3e, 0x3e, 0x2e, 0x2d, 0x2b, 0x1f,
-    0x28, 0x2e, 0x3e, 0x36, 0x1f, 0x1f, 0x1e, 0x12, 0x08, 0x08, 0x06, 0x05,
-    0x03, 0x03, 0x0b, 0x35, 0x52, 0x35, 0x19, 0x14, 0x14, 0x19, 0x21, 0x1e,
-    0x1e, 0x1f, 0x2f, 0x3d, 0x3d, 0x3e, 0x2b, 0x14, 0x1e, 0x2d, 0x3d, 0x2d,
-    0x1d, 0x28, 0x10, 0x07, 0x03, 0x02, 0x02, 0x05, 0x13, 0x12, 0x12, 0x0a,
-    0x07, 0x0a, 0x10, 0x1b, 0x28, 0x1d, 0x14, 0x14, 0x28, 0x44, 0x53, 0x55,
-    0x36, 0x1a, 0x10, 0x14, 0x10, 0x10, 0x0d, 0x0c, 0x0a, 0x1c, 0x2a, 0x20,
-    0x1e, 0x28, 0x31, 0x45, 0x43, 0x50, 0x50, 0x50, 0x6b, 0x74, 0x83, 0x73,
-    0x84, 0x82, 0x82, 0x85, 0x6f, 0x22, 0x0c, 0x08, 0x07, 0x05, 0x03, 0x05,
-    0x03, 0x03, 0x02, 0x02, 0x03, 0x05, 0x0b, 0x06, 0x08, 0x10, 0x2a, 0x31,
-    0x48, 0x48, 0x48, 0x55, 0x55, 0x53, 0x53, 0x60, 0x64, 0x64, 0x6a, 0x20,
-    0x20, 0x22, 0x26, 0x26, 0x22, 0x22, 0x26, 0x11, 0x0f, 0x06, 0x06, 0x0b,
-    0x13, 0x1c, 0x26, 0x26, 0x26, 0x26, 0x3c, 0x3c, 0x4f, 0x59, 0x62, 0x62,
-    0x95, 0x95, 0x95, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb,
-    0xc3, 0xc3, 0xc3, 0xc3, 0x99, 0xc3, 0xc4, 0xf2, 0xe1, 0xd5, 0xcc, 0xc6,
-    0xa2, 0x68, 0x5a, 0x78, 0x64, 0x2d, 0x28, 0x1f, 0x2b, 0x19, 0x22, 0x25,
-    0x35, 0x6d, 0x69, 0x40, 0x4e, 0x6d, 0x6e, 0x5d, 0x41, 0x41, 0x5d, 0x92,
-    0x8f, 0xa1, 0x81, 0x69, 0x4c, 0x52, 0x52, 0x52, 0x4c, 0x6d, 0x6e, 0x8f,
-    0x8f, 0x8f, 0x80, 0x6e, 0x6a, 0x6a, 0x6a, 0x81, 0x81, 0x81, 0x87, 0x86,
-    0x77, 0x60, 0x55, 0x47, 0x2f, 0x2f, 0x22, 0x25, 0x18, 0x0e, 0x01, 0xc7,
-    0xf3, 0xe1, 0xd2, 0xaa, 0x8c, 0x75, 0x77, 0x64, 0x53, 0x4c, 0x4c, 0x6d,
-    0x81, 0x5e, 0x55, 0x46, 0x51, 0x53, 0x77, 0x60, 0x60, 0x6f, 0x51, 0x46,
-    0x3e, 0x3d, 0x40, 0x35, 0x35, 0x35, 0x33, 0x2f, 0x4c, 0x4c, 0x4c, 0x40,
-    0x40, 0x69, 0x5e, 0x44, 0x77, 0x87, 0x9f, 0x8c, 0x86, 0x8c, 0x85, 0x72,
-    0x5a, 0x45, 0x2d, 0x1e, 0x2a, 0x33, 0x2f, 0x2f, 0x40, 0x2d, 0x3e, 0x2e,
-    0x45, 0x30, 0x2e, 0x30, 0x2d, 0x3d, 0x45, 0x30, 0x30, 0x2d, 0x28, 0x1b,
-    0x12, 0x13, 0x22, 0x22, 0x33, 0x3d, 0x30, 0x45, 0x45, 0x45, 0x56, 0x56,
-    0x3d, 0x2d, 0x28, 0x28, 0x2b, 0x1f, 0x1a, 0x1f, 0x28, 0x2e, 0x3d, 0x2f,
-    0x1f, 0x1e, 0x1c, 0x0c, 0x08, 0x08, 0x08, 0x05, 0x05, 0x03, 0x03, 0x05,
-    0x0b, 0x0c, 0x16, 0x12, 0x14, 0x19, 0x12, 0x1b, 0x1f, 0x2b, 0x2b, 0x2d,
-    0x3d, 0x2f, 0x21, 0x12, 0x1c, 0x34, 0x31, 0x2d, 0x28, 0x2d, 0x1b, 0x12,
-    0x13, 0x07, 0x07, 0x0a, 0x0d, 0x10, 0x10, 0x0d, 0x07, 0x0a, 0x14, 0x1f,
-    0x2d, 0x3d, 0x2d, 0x45, 0x7a, 0x93, 0x8c, 0x74, 0x53, 0x1d, 0x1b, 0x14,
-    0x10, 0x0a, 0x0d, 0x0d, 0x1b, 0x1e, 0x2a, 0x20, 0x20, 0x31, 0x49, 0x56,
-    0x61, 0x58, 0x43, 0x43, 0x57, 0x68, 0x71, 0x83, 0x84, 0x82, 0x82, 0x85,
-    0x6f, 0x20, 0x07, 0x0a, 0x0a, 0x07, 0x06, 0x05, 0x05, 0x06, 0x03, 0x03,
-    0x03, 0x06, 0x06, 0x03, 0x03, 0x13, 0x2a, 0x31, 0x3d, 0x3d, 0x48, 0x56,
-    0x56, 0x53, 0x60, 0x60, 0x64, 0x67, 0x4e, 0x20, 0x1c, 0x22, 0x26, 0x26,
-    0x26, 0x3c, 0x3c, 0x26, 0x11, 0x06, 0x06, 0x11, 0x13, 0x13, 0x26, 0x26,
-    0x26, 0x3c, 0x3c, 0x3c, 0x3c, 0x59, 0x62, 0x62, 0x62, 0x95, 0x95, 0x95,
-    0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc3, 0xc3, 0x99, 0x99,
-    0x99, 0x99, 0xc7, 0xf2, 0xe1, 0xc9, 0xa8, 0xa8, 0xa2, 0x7a, 0x77, 0x78,
-    0x56, 0x28, 0x28, 0x2b, 0x2f, 0x21, 0x1c, 0x19, 0x1e, 0x33, 0x33, 0x33,
-    0x35, 0x52, 0x5d, 0x38, 0x38, 0x3b, 0x38, 0x5d, 0x92, 0x8f, 0x6d, 0x52,
-    0x3f, 0x52, 0x52, 0x6d, 0x6d, 0x6d, 0x80, 0x8f, 0x9e, 0x9e, 0x8f, 0x8f,
-    0x80, 0x6e, 0x80, 0x81, 0x6a, 0x80, 0xa0, 0x77, 0x6f, 0x6f, 0x4c, 0x4c,
-    0x40, 0x35, 0x18, 0x0e, 0x04, 0x01, 0x01, 0x41, 0xf3, 0xee, 0xe1, 0xb1,
-    0x8c, 0x75, 0x60, 0x64, 0x55, 0x55, 0x4a, 0x3d, 0x69, 0x69, 0x6f, 0x6f,
-    0x77, 0x77, 0x87, 0x86, 0x77, 0x6c, 0x5e, 0x53, 0x48, 0x3d, 0x2b, 0x21,
-    0x21, 0x1e, 0x2a, 0x4e, 0x6a, 0x6a, 0x69, 0x4c, 0x4c, 0x69, 0x56, 0x55,
-    0x78, 0x9f, 0x9f, 0xa2, 0x86, 0x85, 0x85, 0x75, 0x58, 0x45, 0x28, 0x2a,
-    0x33, 0x2f, 0x2f, 0x2f, 0x3d, 0x48, 0x47, 0x3e, 0x45, 0x45, 0x47, 0x30,
-    0x56, 0x56, 0x56, 0x45, 0x45, 0x30, 0x2d, 0x1e, 0x12, 0x13, 0x13, 0x1e,
-    0x33, 0x3d, 0x47, 0x45, 0x45, 0x45, 0x55, 0x69, 0x4c, 0x2d, 0x2b, 0x1e,
-    0x1d, 0x1d, 0x1e, 0x1f, 0x1d, 0x2b, 0x2b, 0x1b, 0x14, 0x12, 0x0c, 0x08,
-    0x05, 0x08, 0x09, 0x08, 0x08, 0x03, 0x03, 0x03, 0x06, 0x09, 0x0c, 0x12,
-    0x12, 0x16, 0x12, 0x1c, 0x2b, 0x2f, 0x28, 0x28, 0x2b, 0x2b, 0x1c, 0x0c,
-    0x12, 0x2a, 0x3d, 0x3d, 0x3e, 0x30, 0x2e, 0x2d, 0x1e, 0x1b, 0x1d, 0x14,
-    0x14, 0x1a, 0x1b, 0x12, 0x0a, 0x0a, 0x1b, 0x2b, 0x3d, 0x56, 0x77, 0x8c,
-    0xbb, 0xbb, 0xbb, 0xbb, 0x85, 0x44, 0x45, 0x2d, 0x1e, 0x14, 0x1a, 0x27,
-    0x3e, 0x31, 0x31, 0x28, 0x1d, 0x31, 0x56, 0x67, 0x77, 0x74, 0x50, 0x4b,
-    0x57, 0x57, 0x57, 0x6b, 0x72, 0x82, 0x84, 0x85, 0x48, 0x1c, 0x10, 0x1b,
-    0x1e, 0x1c, 0x12, 0x07, 0x08, 0x0b, 0x08, 0x08, 0x0b, 0x0b, 0x11, 0x06,
-    0x06, 0x13, 0x1c, 0x2a, 0x3d, 0x48, 0x48, 0x53, 0x45, 0x53, 0x60, 0x60,
-    0x64, 0x6a, 0x4f, 0x22, 0x22, 0x26, 0x26, 0x26, 0x26, 0x26, 0x3c, 0x26,
-    0x11, 0x06, 0x06, 0x11, 0x13, 0x1c, 0x22, 0x22, 0x20, 0x3c, 0x3c, 0x3c,
-    0x4f, 0x4f, 0x59, 0x62, 0x62, 0x62, 0x95, 0x95, 0x95, 0xcb, 0xcb, 0xcb,
-    0xcb, 0xcb, 0xcb, 0xcb, 0xc3, 0x99, 0x99, 0x99, 0x99, 0x99, 0xec, 0xf3,
-    0xe1, 0xd5, 0xa5, 0xa2, 0xb2, 0x9a, 0x60, 0x64, 0x48, 0x2e, 0x1f, 0x2b,
-    0x33, 0x21, 0x22, 0x2a, 0x1f, 0x2a, 0x33, 0x35, 0x3c, 0x41, 0x38, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x38, 0x38, 0x5d, 0x41, 0x41, 0x41, 0x5d, 0x6e, 0x6d,
-    0x6d, 0x80, 0x8f, 0x9e, 0x9e, 0x9e, 0x9e, 0x8f, 0x8f, 0x8f, 0x80, 0x81,
-    0x6a, 0x6a, 0x80, 0x7e, 0x64, 0x5e, 0x4c, 0x35, 0x3f, 0x18, 0x0e, 0x01,
-    0x01, 0x01, 0x01, 0x41, 0xe5, 0xe4, 0xe3, 0xbe, 0x91, 0x75, 0x6c, 0x5a,
-    0x46, 0x47, 0x47, 0x3e, 0x2e, 0x64, 0x7e, 0x86, 0x86, 0x8c, 0x8c, 0x86,
-    0x75, 0x75, 0x6f, 0x56, 0x48, 0x3d, 0x1f, 0x1a, 0x1b, 0x1e, 0x33, 0x52,
-    0x6d, 0x6d, 0x6a, 0x6a, 0x69, 0x69, 0x4c, 0x6a, 0x87, 0x9f, 0x9f, 0x85,
-    0x85, 0x86, 0x86, 0x77, 0x5e, 0x3e, 0x2b, 0x33, 0x33, 0x2f, 0x2f, 0x40,
-    0x4e, 0x48, 0x47, 0x45, 0x64, 0x64, 0x45, 0x45, 0x64, 0x64, 0x53, 0x53,
-    0x51, 0x45, 0x2d, 0x2a, 0x10, 0x12, 0x1c, 0x2a, 0x2d, 0x3e, 0x47, 0x53,
-    0x53, 0x44, 0x47, 0x55, 0x3d, 0x2d, 0x2d, 0x2a, 0x28, 0x28, 0x2d, 0x28,
-    0x28, 0x2b, 0x1e, 0x12, 0x0d, 0x0a, 0x08, 0x08, 0x08, 0x0b, 0x0c, 0x0b,
-    0x08, 0x06, 0x05, 0x06, 0x06, 0x06, 0x0b, 0x0b, 0x0c, 0x15, 0x13, 0x1c,
-    0x1e, 0x2f, 0x28, 0x1d, 0x1f, 0x1b, 0x0d, 0x10, 0x28, 0x45, 0x53, 0x45,
-    0x45, 0x30, 0x44, 0x45, 0x30, 0x23, 0x27, 0x28, 0x1b, 0x2b, 0x2b, 0x20,
-    0x13, 0x0a, 0x1b, 0x28, 0x47, 0x77, 0x8c, 0xaf, 0xbc, 0xce, 0xce, 0xc6,
-    0xaa, 0x85, 0x75, 0x55, 0x2d, 0x1d, 0x30, 0x46, 0x5e, 0x31, 0x2d, 0x2d,
-    0x28, 0x31, 0x48, 0x64, 0x78, 0x6b, 0x58, 0x72, 0x85, 0x74, 0x58, 0x6b,
-    0x84, 0x75, 0x72, 0x75, 0x56, 0x3d, 0x2a, 0x2d, 0x3d, 0x40, 0x21, 0x1c,
-    0x0a, 0x0c, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0b, 0x13, 0x1c, 0x20,
-    0x2d, 0x3d, 0x45, 0x45, 0x45, 0x5a, 0x60, 0x64, 0x67, 0x4f, 0x15, 0x13,
-    0x22, 0x26, 0x26, 0x22, 0x22, 0x35, 0x3c, 0x3c, 0x26, 0x11, 0x06, 0x0b,
-    0x13, 0x1c, 0x22, 0x20, 0x20, 0x34, 0x3c, 0x4f, 0x4f, 0x4f, 0x59, 0x59,
-    0x62, 0x62, 0x62, 0x95, 0x95, 0x95, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xc4, 0xf3, 0xeb, 0xdc, 0xb8, 0xaa,
-    0xb4, 0x9a, 0x5a, 0x56, 0x4c, 0x3e, 0x1d, 0x2a, 0x35, 0x21, 0x22, 0x21,
-    0x21, 0x3f, 0x3f, 0x3f, 0x41, 0x38, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x38, 0x38, 0x38, 0x41, 0x5d, 0x6e, 0x6d, 0x80, 0x80, 0x8f, 0x9e,
-    0xb9, 0x9e, 0x9e, 0x9e, 0x9e, 0x8f, 0x80, 0x78, 0x55, 0x48, 0x4e, 0x6a,
-    0x56, 0x4e, 0x35, 0x25, 0x18, 0x0e, 0x04, 0x01, 0x01, 0x01, 0x01, 0x38,
-    0xe5, 0xe4, 0xe3, 0xb7, 0xa2, 0x74, 0x6b, 0x51, 0x46, 0x55, 0x47, 0x3d,
-    0x47, 0x64, 0x81, 0x7e, 0xa3, 0xa2, 0xa2, 0x85, 0x85, 0x75, 0x64, 0x6a,
-    0x4c, 0x2f, 0x2b, 0x1f, 0x1b, 0x1e, 0x2a, 0x33, 0x35, 0x52, 0x80, 0x4e,
-    0x4c, 0x4e, 0x52, 0x80, 0x80, 0x81, 0xa0, 0x85, 0x86, 0x87, 0x77, 0x6f,
-    0x47, 0x40, 0x2f, 0x2f, 0x33, 0x2f, 0x33, 0x4e, 0x4e, 0x48, 0x47, 0x45,
-    0x56, 0x64, 0x45, 0x56, 0x64, 0x64, 0x60, 0x5a, 0x51, 0x45, 0x3e, 0x28,
-    0x14, 0x12, 0x22, 0x2a, 0x3e, 0x3e, 0x47, 0x53, 0x60, 0x44, 0x37, 0x3e,
-    0x3e, 0x2e, 0x2d, 0x2d, 0x3d, 0x3d, 0x3d, 0x2d, 0x2f, 0x2a, 0x1b, 0x0a,
-    0x0a, 0x0a, 0x08, 0x05, 0x08, 0x0b, 0x0c, 0x09, 0x05, 0x06, 0x06, 0x09,
-    0x11, 0x11, 0x11, 0x15, 0x0b, 0x15, 0x13, 0x1c, 0x22, 0x33, 0x28, 0x1d,
-    0x1b, 0x14, 0x1e, 0x28, 0x48, 0x60, 0x6c, 0x6c, 0x51, 0x51, 0x51, 0x53,
-    0x45, 0x45, 0x30, 0x30, 0x28, 0x28, 0x2f, 0x2f, 0x22, 0x0a, 0x10, 0x28,
-    0x60, 0x8c, 0xaa, 0xaf, 0xb6, 0xca, 0xca, 0xca, 0xa5, 0x93, 0x85, 0x77,
-    0x30, 0x23, 0x30, 0x53, 0x56, 0x31, 0x49, 0x3d, 0x31, 0x31, 0x48, 0x56,
-    0x67, 0x5a, 0x4b, 0x72, 0x8c, 0x85, 0x6b, 0x72, 0x85, 0x6c, 0x72, 0x7a,
-    0x77, 0x78, 0x56, 0x45, 0x55, 0x55, 0x40, 0x2a, 0x1c, 0x14, 0x21, 0x21,
-    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x22, 0x22, 0x1c, 0x1b, 0x2a, 0x2e, 0x30,
-    0x44, 0x51, 0x5e, 0x6a, 0x4f, 0x26, 0x0b, 0x0b, 0x22, 0x26, 0x22, 0x22,
-    0x22, 0x35, 0x35, 0x3c, 0x26, 0x11, 0x06, 0x11, 0x13, 0x1c, 0x22, 0x20,
-    0x20, 0x34, 0x34, 0x4f, 0x4f, 0x4f, 0x4f, 0x59, 0x62, 0x62, 0x62, 0x62,
-    0x95, 0x95, 0x95, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0xc4, 0xee, 0xee, 0xdd, 0xbb, 0xa2, 0xae, 0x86, 0x44, 0x40,
-    0x4c, 0x2d, 0x2b, 0x2a, 0x33, 0x22, 0x25, 0x26, 0x41, 0x41, 0x41, 0x41,
-    0x38, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x38, 0x92, 0x8f, 0x80, 0x80, 0x8f, 0x8f, 0xc4, 0xc4, 0x9e, 0x8f, 0x8f,
-    0x9e, 0x8f, 0x9d, 0x6f, 0x51, 0x2e, 0x2d, 0x33, 0x35, 0x22, 0x15, 0x0e,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x17, 0xc4, 0xe4, 0xd3, 0xb2,
-    0xa2, 0x74, 0x6b, 0x50, 0x46, 0x47, 0x4c, 0x55, 0x55, 0x55, 0x81, 0xa0,
-    0xa0, 0xae, 0xae, 0x9f, 0x86, 0x77, 0x55, 0x4e, 0x4c, 0x36, 0x2e, 0x28,
-    0x1b, 0x1b, 0x1f, 0x2b, 0x2a, 0x2a, 0x34, 0x2a, 0x2a, 0x2a, 0x34, 0x4f,
-    0x6a, 0x6a, 0x80, 0x78, 0x64, 0x7e, 0x69, 0x4c, 0x4c, 0x40, 0x2f, 0x33,
-    0x33, 0x33, 0x4e, 0x4e, 0x4e, 0x4c, 0x56, 0x60, 0x55, 0x45, 0x56, 0x7d,
-    0x9d, 0x78, 0x60, 0x5a, 0x51, 0x53, 0x45, 0x28, 0x1b, 0x19, 0x21, 0x2b,
-    0x3e, 0x56, 0x67, 0x64, 0x53, 0x51, 0x44, 0x30, 0x3e, 0x3e, 0x45, 0x45,
-    0x3e, 0x47, 0x3d, 0x28, 0x2b, 0x1e, 0x19, 0x0a, 0x08, 0x08, 0x05, 0x05,
-    0x05, 0x08, 0x08, 0x06, 0x06, 0x0b, 0x13, 0x26, 0x26, 0x26, 0x15, 0x11,
-    0x11, 0x11, 0x15, 0x13, 0x1c, 0x20, 0x28, 0x1f, 0x1b, 0x1d, 0x47, 0x53,
-    0x6c, 0x75, 0x85, 0x82, 0x72, 0x6b, 0x5a, 0x6c, 0x6c, 0x51, 0x51, 0x44,
-    0x30, 0x30, 0x2d, 0x2d, 0x21, 0x0a, 0x1e, 0x30, 0x6c, 0x8c, 0xbe, 0xd1,
-    0xaf, 0xb6, 0xc8, 0xb6, 0xa6, 0xa6, 0x93, 0x86, 0x45, 0x30, 0x30, 0x3e,
-    0x48, 0x48, 0x56, 0x3d, 0x31, 0x34, 0x49, 0x49, 0x67, 0x56, 0x51, 0x75,
-    0x75, 0x60, 0x5a, 0x6c, 0x85, 0x86, 0x8c, 0xa2, 0xa2, 0xaa, 0xaa, 0xaa,
-    0x75, 0x5a, 0x47, 0x40, 0x2a, 0x1e, 0x1e, 0x2a, 0x1e, 0x1c, 0x20, 0x2a,
-    0x2a, 0x20, 0x20, 0x1c, 0x1c, 0x2a, 0x2d, 0x30, 0x45, 0x47, 0x56, 0x34,
-    0x13, 0x06, 0x06, 0x0b, 0x1c, 0x22, 0x20, 0x34, 0x34, 0x35, 0x4f, 0x4f,
-    0x3c, 0x11, 0x06, 0x11, 0x13, 0x26, 0x22, 0x20, 0x34, 0x34, 0x34, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x59, 0x59, 0x62, 0x62, 0x62, 0x62, 0x95, 0x95, 0x95,
-    0xcb, 0xcb, 0xcb, 0xcb, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0xf3,
-    0xe4, 0xe1, 0xb1, 0xa2, 0x86, 0x60, 0x44, 0x2d, 0x2f, 0x2a, 0x24, 0x33,
-    0x35, 0x3f, 0x26, 0x41, 0x38, 0x65, 0x65, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x38, 0x5d, 0x8f, 0x8f,
-    0x8f, 0x8f, 0x9e, 0xc4, 0x9e, 0x9e, 0x59, 0x59, 0x8f, 0xb9, 0xa1, 0x78,
-    0x51, 0x3a, 0x27, 0x2b, 0x21, 0x25, 0x18, 0x04, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x5d, 0xe4, 0xd2, 0xcf, 0xaa, 0x84, 0x6c, 0x5a,
-    0x47, 0x4c, 0x69, 0x6f, 0x6f, 0x61, 0x78, 0x9d, 0xba, 0xb4, 0x9d, 0x9f,
-    0x86, 0x6f, 0x51, 0x46, 0x37, 0x3e, 0x48, 0x2e, 0x1d, 0x1f, 0x28, 0x28,
-    0x2f, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x35, 0x4f, 0x4f,
-    0x4f, 0x3c, 0x35, 0x4f, 0x4e, 0x4e, 0x40, 0x33, 0x33, 0x35, 0x40, 0x4c,
-    0x4c, 0x40, 0x4c, 0x64, 0x55, 0x47, 0x67, 0x9d, 0x9d, 0x78, 0x6c, 0x5a,
-    0x5a, 0x60, 0x47, 0x28, 0x1b, 0x1e, 0x33, 0x2f, 0x3e, 0x56, 0x67, 0x64,
-    0x60, 0x60, 0x53, 0x47, 0x30, 0x45, 0x53, 0x51, 0x30, 0x3e, 0x2e, 0x28,
-    0x1f, 0x1e, 0x12, 0x0c, 0x08, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03,
-    0x06, 0x15, 0x26, 0x3c, 0x3c, 0x3c, 0x26, 0x15, 0x11, 0x11, 0x0b, 0x0b,
-    0x13, 0x20, 0x28, 0x2d, 0x2d, 0x3d, 0x5e, 0x6c, 0x75, 0x93, 0x93, 0xa2,
-    0x93, 0x82, 0x72, 0x72, 0x75, 0x6c, 0x58, 0x50, 0x37, 0x37, 0x47, 0x3d,
-    0x1e, 0x1b, 0x47, 0x51, 0x82, 0x97, 0xac, 0xbc, 0xb6, 0xb6, 0xb6, 0xaf,
-    0xa6, 0xa6, 0x93, 0x8c, 0x6c, 0x5a, 0x51, 0x45, 0x48, 0x56, 0x46, 0x30,
-    0x30, 0x34, 0x4f, 0x49, 0x49, 0x67, 0x56, 0x5e, 0x75, 0x6c, 0x5a, 0x6c,
-    0x86, 0xa2, 0xa2, 0xaa, 0xaa, 0xaf, 0xc6, 0xce, 0xb1, 0x8c, 0x60, 0x48,
-    0x2f, 0x2a, 0x28, 0x2d, 0x28, 0x1e, 0x2a, 0x31, 0x2d, 0x2d, 0x2a, 0x2a,
-    0x2a, 0x31, 0x2d, 0x2d, 0x2e, 0x3e, 0x48, 0x33, 0x22, 0x13, 0x11, 0x0a,
-    0x12, 0x1c, 0x1e, 0x34, 0x34, 0x35, 0x4f, 0x4f, 0x3c, 0x11, 0x0f, 0x11,
-    0x13, 0x13, 0x22, 0x20, 0x34, 0x34, 0x34, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x59, 0x62, 0x62, 0x62, 0x62, 0x95, 0x95, 0x95, 0xcb, 0xcb, 0xcb, 0xcb,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x8b, 0xec, 0xe3, 0xcf, 0xaa, 0xa2,
-    0x86, 0x6c, 0x51, 0x47, 0x33, 0x35, 0x35, 0x3f, 0x41, 0x41, 0x41, 0x38,
-    0x65, 0x65, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x38, 0x5d, 0x8f, 0x8f, 0x8f, 0x9e, 0x9e, 0x9e,
-    0x92, 0x5d, 0x41, 0x41, 0x59, 0x8f, 0xba, 0x7e, 0x6f, 0x47, 0x2e, 0x29,
-    0x21, 0x16, 0x0e, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x0f, 0xc4, 0xd4, 0xb7, 0xa3, 0x75, 0x6f, 0x4c, 0x33, 0x6a, 0x81, 0x87,
-    0x77, 0x61, 0x6f, 0x9d, 0xba, 0xb4, 0xa0, 0x86, 0x86, 0x77, 0x58, 0x44,
-    0x37, 0x47, 0x67, 0x3d, 0x1d, 0x1d, 0x2d, 0x3d, 0x3d, 0x28, 0x28, 0x33,
-    0x33, 0x33, 0x2a, 0x2a, 0x2a, 0x22, 0x26, 0x26, 0x26, 0x26, 0x26, 0x3c,
-    0x52, 0x4e, 0x4c, 0x48, 0x40, 0x4a, 0x4a, 0x4c, 0x4c, 0x4c, 0x4c, 0x56,
-    0x56, 0x56, 0x67, 0x81, 0x78, 0x75, 0x6c, 0x6c, 0x60, 0x53, 0x47, 0x1e,
-    0x1e, 0x2a, 0x33, 0x4c, 0x55, 0x60, 0x77, 0x77, 0x77, 0x6f, 0x55, 0x55,
-    0x3e, 0x30, 0x44, 0x46, 0x30, 0x30, 0x23, 0x1f, 0x1b, 0x1b, 0x0d, 0x0c,
-    0x0c, 0x08, 0x08, 0x08, 0x08, 0x05, 0x03, 0x03, 0x06, 0x26, 0x3c, 0x4f,
-    0x3c, 0x3c, 0x26, 0x15, 0x15, 0x0b, 0x0b, 0x07, 0x13, 0x20, 0x3d, 0x45,
-    0x48, 0x53, 0x60, 0x74, 0x8c, 0xaa, 0xaf, 0xaa, 0xaf, 0x93, 0x82, 0x84,
-    0x85, 0x75, 0x6b, 0x4b, 0x4b, 0x51, 0x55, 0x3e, 0x1d, 0x27, 0x5a, 0x6b,
-    0x82, 0x94, 0xa6, 0xa6, 0xb6, 0xb6, 0xa6, 0xa6, 0xb6, 0xa6, 0x94, 0x93,
-    0x8c, 0x86, 0x77, 0x53, 0x53, 0x53, 0x44, 0x4b, 0x6b, 0x64, 0x67, 0x49,
-    0x49, 0x6e, 0x67, 0x60, 0x74, 0x7a, 0x8c, 0x85, 0xa2, 0xa2, 0xaa, 0xaa,
-    0xa5, 0xb5, 0xc6, 0xd9, 0xcf, 0xbe, 0x86, 0x55, 0x3d, 0x1e, 0x1d, 0x31,
-    0x2a, 0x1e, 0x2d, 0x2d, 0x3d, 0x3d, 0x31, 0x31, 0x2d, 0x2d, 0x30, 0x30,
-    0x30, 0x45, 0x45, 0x56, 0x49, 0x22, 0x13, 0x13, 0x1c, 0x1c, 0x1e, 0x2a,
-    0x33, 0x4e, 0x49, 0x4e, 0x35, 0x11, 0x0f, 0x06, 0x11, 0x13, 0x22, 0x20,
-    0x34, 0x34, 0x34, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x59, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x95, 0x95, 0xcb, 0xcb, 0xcb, 0xcb, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x92, 0xe4, 0xce, 0xaa, 0x91, 0x87, 0x77, 0x5e, 0x52,
-    0x3c, 0x41, 0x41, 0x41, 0x5d, 0x38, 0x5f, 0x65, 0x65, 0x65, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x38, 0x5d, 0x8f, 0x8f, 0x8f, 0x5d, 0x5d, 0x5d, 0x41, 0x38, 0x17, 0x38,
-    0x5d, 0x8f, 0x9d, 0xa0, 0x7b, 0x5e, 0x47, 0x29, 0x1e, 0x25, 0x0e, 0x04,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x41, 0xb9, 0xb7,
-    0x91, 0x6f, 0x33, 0x22, 0x26, 0x6e, 0x80, 0x81, 0x77, 0x61, 0x5e, 0x7d,
-    0xb4, 0xb4, 0xa3, 0x84, 0x85, 0x86, 0x6c, 0x51, 0x44, 0x45, 0x56, 0x3d,
-    0x2d, 0x28, 0x2f, 0x3d, 0x3d, 0x2d, 0x28, 0x33, 0x33, 0x34, 0x34, 0x33,
-    0x35, 0x22, 0x26, 0x26, 0x3c, 0x26, 0x26, 0x3c, 0x4f, 0x4e, 0x4c, 0x48,
-    0x48, 0x48, 0x4c, 0x4c, 0x56, 0x56, 0x56, 0x48, 0x4c, 0x69, 0x69, 0x81,
-    0x78, 0x61, 0x5a, 0x5e, 0x5e, 0x55, 0x2d, 0x1b, 0x1c, 0x2a, 0x33, 0x4c,
-    0x64, 0x77, 0x87, 0x77, 0x77, 0x6c, 0x54, 0x54, 0x47, 0x30, 0x30, 0x2e,
-    0x30, 0x30, 0x28, 0x1e, 0x14, 0x0d, 0x0d, 0x0c, 0x0c, 0x0c, 0x08, 0x0b,
-    0x08, 0x05, 0x05, 0x03, 0x06, 0x26, 0x3c, 0x3c, 0x3c, 0x26, 0x1c, 0x1c,
-    0x1c, 0x12, 0x0a, 0x0a, 0x1c, 0x31, 0x48, 0x56, 0x53, 0x60, 0x77, 0x75,
-    0x97, 0xbb, 0xbb, 0xbb, 0xaf, 0xa6, 0x7f, 0x93, 0x85, 0x75, 0x6b, 0x6b,
-    0x6b, 0x6c, 0x5e, 0x27, 0x1d, 0x23, 0x51, 0x72, 0x96, 0x94, 0x96, 0x96,
-    0xa6, 0xb6, 0xad, 0xa6, 0xa6, 0xa6, 0x7f, 0x93, 0x8c, 0x86, 0x77, 0x6c,
-    0x60, 0x7a, 0x93, 0xa5, 0xa5, 0xa8, 0x87, 0x78, 0x67, 0x67, 0x67, 0x78,
-    0x6c, 0x85, 0x8c, 0x8c, 0x8c, 0x93, 0x97, 0xa5, 0xab, 0xb6, 0xca, 0xca,
-    0xc6, 0xce, 0x9f, 0x60, 0x3d, 0x1e, 0x2a, 0x2a, 0x2a, 0x3d, 0x48, 0x2d,
-    0x2d, 0x2d, 0x2d, 0x3d, 0x3d, 0x45, 0x45, 0x56, 0x53, 0x45, 0x53, 0x64,
-    0x67, 0x4e, 0x34, 0x20, 0x20, 0x1c, 0x1c, 0x2a, 0x31, 0x31, 0x49, 0x4e,
-    0x35, 0x11, 0x03, 0x06, 0x11, 0x13, 0x22, 0x20, 0x34, 0x34, 0x34, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x59, 0x62, 0x62, 0x62, 0x62, 0x95, 0x95,
-    0xcb, 0xcb, 0xcb, 0xcb, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x65, 0x65,
-    0xc4, 0xba, 0x9f, 0x7e, 0x7e, 0x69, 0x52, 0x52, 0x41, 0x5f, 0x38, 0x5d,
-    0x5f, 0x65, 0x65, 0x65, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x5d, 0x5d, 0x5d,
-    0x5d, 0x41, 0x38, 0x38, 0x41, 0x17, 0x17, 0x17, 0x5d, 0x8f, 0x9d, 0x87,
-    0x6f, 0x6f, 0x55, 0x2e, 0x1e, 0x25, 0x0e, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x0f, 0x41, 0x3c, 0x15, 0x06, 0x06,
-    0x0f, 0x4f, 0x80, 0xa0, 0x86, 0x75, 0x61, 0x56, 0x81, 0xb4, 0xb1, 0x93,
-    0x82, 0x72, 0x6b, 0x75, 0x6c, 0x44, 0x45, 0x45, 0x45, 0x2d, 0x28, 0x2d,
-    0x2d, 0x2d, 0x33, 0x34, 0x35, 0x35, 0x35, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
-    0x3c, 0x3c, 0x3c, 0x3c, 0x4f, 0x52, 0x6a, 0x64, 0x56, 0x48, 0x56, 0x69,
-    0x56, 0x48, 0x48, 0x4c, 0x4c, 0x4e, 0x4e, 0x6a, 0x81, 0x64, 0x55, 0x55,
-    0x4c, 0x2f, 0x1f, 0x1b, 0x1c, 0x1c, 0x34, 0x56, 0x78, 0x87, 0xa0, 0x9b,
-    0x77, 0x60, 0x60, 0x55, 0x47, 0x30, 0x3e, 0x2e, 0x23, 0x2e, 0x28, 0x1b,
-    0x12, 0x0d, 0x0d, 0x16, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x06, 0x05, 0x03,
-    0x06, 0x11, 0x18, 0x26, 0x13, 0x13, 0x20, 0x2a, 0x2a, 0x1e, 0x1c, 0x10,
-    0x20, 0x3d, 0x48, 0x55, 0x53, 0x6c, 0x72, 0x82, 0x97, 0xaa, 0xbb, 0xbb,
-    0xaf, 0xa6, 0x94, 0x7f, 0x84, 0x75, 0x72, 0x72, 0x71, 0x74, 0x54, 0x23,
-    0x27, 0x30, 0x50, 0x82, 0xa6, 0x94, 0x8e, 0x8e, 0x8a, 0xb6, 0xca, 0xb6,
-    0x9c, 0x7c, 0x7c, 0x7f, 0x82, 0x85, 0x72, 0x8c, 0x85, 0x93, 0xa5, 0xc6,
-    0xce, 0xce, 0xc6, 0xa2, 0x7a, 0x7d, 0x67, 0x67, 0x9d, 0x85, 0x7f, 0x7f,
-    0x7c, 0x7c, 0x9c, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xbb, 0xb2, 0x78,
-    0x48, 0x2d, 0x2d, 0x2d, 0x30, 0x48, 0x48, 0x3d, 0x2d, 0x30, 0x45, 0x56,
-    0x56, 0x48, 0x53, 0x64, 0x53, 0x51, 0x5a, 0x60, 0x67, 0x6a, 0x34, 0x34,
-    0x34, 0x20, 0x20, 0x2a, 0x31, 0x31, 0x33, 0x35, 0x26, 0x06, 0x02, 0x03,
-    0x11, 0x13, 0x1c, 0x20, 0x34, 0x34, 0x34, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x3c, 0x59, 0x62, 0x62, 0x62, 0x62, 0x95, 0x95, 0x95, 0xcb, 0xcb, 0xcb,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x65, 0x65, 0x65, 0x8b, 0x92, 0xa1, 0x6d,
-    0x6e, 0x6d, 0x5d, 0x5d, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x38, 0x41, 0x41, 0x41, 0x38, 0x38, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x41, 0x8f, 0xa1, 0x86, 0x75, 0x5e, 0x55, 0x36,
-    0x21, 0x25, 0x0e, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x02, 0x02, 0x04, 0x04, 0x04, 0x0f, 0x26, 0x6e, 0x8f,
-    0x81, 0x7e, 0x5e, 0x56, 0x7d, 0xb2, 0xbb, 0xaa, 0xa2, 0x7f, 0x72, 0x86,
-    0x77, 0x51, 0x44, 0x53, 0x56, 0x30, 0x2e, 0x2f, 0x33, 0x31, 0x31, 0x34,
-    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
-    0x3c, 0x6e, 0x6e, 0x80, 0x6a, 0x64, 0x64, 0x64, 0x60, 0x47, 0x47, 0x48,
-    0x4c, 0x4c, 0x40, 0x4e, 0x6a, 0x4e, 0x40, 0x2f, 0x2b, 0x1e, 0x1b, 0x1b,
-    0x1c, 0x13, 0x20, 0x4e, 0x78, 0xa0, 0x9d, 0xa0, 0x86, 0x75, 0x6c, 0x51,
-    0x45, 0x45, 0x3e, 0x2d, 0x27, 0x28, 0x1e, 0x1b, 0x19, 0x0d, 0x0a, 0x0c,
-    0x0c, 0x0c, 0x0a, 0x13, 0x0a, 0x08, 0x05, 0x05, 0x05, 0x0b, 0x0b, 0x13,
-    0x13, 0x1c, 0x33, 0x2d, 0x2d, 0x2d, 0x2a, 0x1c, 0x20, 0x40, 0x47, 0x45,
-    0x53, 0x75, 0x82, 0x82, 0x93, 0xaf, 0xaf, 0xaf, 0xa6, 0x94, 0x94, 0x94,
-    0x93, 0x84, 0x93, 0x7f, 0x82, 0x72, 0x4b, 0x44, 0x44, 0x6c, 0x72, 0x7f,
-    0x94, 0x8a, 0x8e, 0x88, 0x9c, 0xab, 0xa6, 0xa6, 0xaf, 0x94, 0x96, 0x71,
-    0x68, 0x82, 0x7f, 0x93, 0xaf, 0xb5, 0xb6, 0xca, 0xd5, 0xce, 0xc6, 0xa5,
-    0x93, 0x85, 0x86, 0x78, 0x7d, 0xa1, 0x75, 0x94, 0x9c, 0x88, 0x8a, 0xab,
-    0xbb, 0xbb, 0xb6, 0xab, 0xb6, 0xbb, 0xbe, 0x87, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x45, 0x45, 0x45, 0x30, 0x45, 0x53, 0x53, 0x55, 0x45, 0x53, 0x56,
-    0x60, 0x5a, 0x6c, 0x77, 0x78, 0x67, 0x49, 0x34, 0x34, 0x34, 0x34, 0x34,
-    0x31, 0x31, 0x20, 0x11, 0x06, 0x02, 0x02, 0x03, 0x06, 0x13, 0x1c, 0x22,
-    0x34, 0x34, 0x34, 0x4f, 0x4e, 0x4e, 0x4f, 0x4f, 0x4f, 0x59, 0x62, 0x62,
-    0x62, 0x62, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x65, 0x65, 0x65, 0x65, 0x5f, 0x5f, 0x5f, 0x5f, 0x5d, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x17,
-    0x38, 0x38, 0x38, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-    0x41, 0x8f, 0xa1, 0x9f, 0x77, 0x61, 0x4a, 0x36, 0x21, 0x18, 0x04, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x02, 0x02, 0x04, 0x02, 0x03, 0x0f, 0x3c, 0x6e, 0x80, 0x6d, 0x52, 0x4e,
-    0xa1, 0xb7, 0xbc, 0xbb, 0xbe, 0x93, 0x72, 0x7a, 0x6c, 0x6c, 0x51, 0x45,
-    0x56, 0x48, 0x30, 0x3d, 0x33, 0x34, 0x34, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
-    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x59, 0x6e, 0x80,
-    0x80, 0x81, 0x6a, 0x64, 0x64, 0x55, 0x45, 0x64, 0x4c, 0x48, 0x2d, 0x2d,
-    0x31, 0x33, 0x2a, 0x1e, 0x2a, 0x1e, 0x1e, 0x1b, 0x12, 0x13, 0x20, 0x4e,
-    0x6a, 0x87, 0xa0, 0x9a, 0x86, 0x75, 0x6c, 0x51, 0x44, 0x44, 0x3e, 0x27,
-    0x28, 0x1f, 0x1e, 0x21, 0x19, 0x12, 0x0a, 0x0a, 0x0a, 0x0a, 0x12, 0x13,
-    0x0a, 0x07, 0x05, 0x05, 0x05, 0x0b, 0x0a, 0x1c, 0x1e, 0x31, 0x2d, 0x2d,
-    0x30, 0x3e, 0x2d, 0x1f, 0x1e, 0x2d, 0x2e, 0x45, 0x60, 0x7a, 0x85, 0x93,
-    0x93, 0x94, 0xa6, 0xa6, 0xa6, 0x94, 0xa6, 0x94, 0x7f, 0x7f, 0x93, 0x97,
-    0x72, 0x4b, 0x4b, 0x50, 0x6b, 0x84, 0x94, 0x7f, 0x94, 0xa6, 0xa6, 0xa6,
-    0xb6, 0xb6, 0xa6, 0x94, 0x96, 0x96, 0x97, 0x74, 0x74, 0xa5, 0x93, 0xb5,
-    0xaf, 0xb6, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xb6, 0xbb, 0x8c, 0x71, 0x7f,
-    0xa2, 0xa3, 0x91, 0x97, 0xa6, 0xa6, 0x8a, 0x94, 0xa5, 0xbb, 0xca, 0xc6,
-    0xaf, 0xaa, 0xae, 0x9f, 0x86, 0x7a, 0x77, 0x77, 0x78, 0x45, 0x30, 0x45,
-    0x45, 0x45, 0x45, 0x44, 0x51, 0x51, 0x53, 0x60, 0x60, 0x60, 0x60, 0x77,
-    0x78, 0x67, 0x49, 0x31, 0x31, 0x49, 0x49, 0x49, 0x49, 0x34, 0x26, 0x06,
-    0x02, 0x02, 0x02, 0x03, 0x06, 0x0b, 0x1c, 0x22, 0x20, 0x34, 0x34, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x59, 0x59, 0x59, 0x62, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x99, 0x99, 0x99, 0x99, 0x99, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x41, 0x6e, 0xa1, 0x9f,
-    0x7b, 0x5e, 0x4a, 0x2f, 0x16, 0x0e, 0x04, 0x00, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x0f, 0x0f, 0x3c, 0x26, 0x22, 0x11, 0x59, 0xa1, 0xd1, 0xbb,
-    0xbb, 0x93, 0x82, 0x72, 0x7a, 0x87, 0x60, 0x44, 0x51, 0x53, 0x30, 0x3d,
-    0x34, 0x34, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
-    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x59, 0x6e, 0x80, 0x80, 0x6a, 0x81,
-    0x64, 0x5e, 0x53, 0x64, 0x56, 0x48, 0x48, 0x3d, 0x2d, 0x2a, 0x28, 0x1d,
-    0x28, 0x1e, 0x1e, 0x1b, 0x13, 0x13, 0x22, 0x4e, 0x6a, 0x87, 0x9f, 0x9f,
-    0xa3, 0x86, 0x6b, 0x50, 0x44, 0x44, 0x30, 0x27, 0x1f, 0x1f, 0x19, 0x21,
-    0x19, 0x12, 0x0a, 0x0a, 0x0a, 0x0a, 0x12, 0x0d, 0x0a, 0x0a, 0x08, 0x08,
-    0x07, 0x13, 0x20, 0x28, 0x3d, 0x47, 0x30, 0x30, 0x45, 0x45, 0x30, 0x28,
-    0x1b, 0x28, 0x30, 0x60, 0x7a, 0x7a, 0x8c, 0x93, 0x93, 0x94, 0x94, 0x94,
-    0x9c, 0x88, 0x96, 0x97, 0x7f, 0x71, 0x7f, 0x7f, 0x72, 0x58, 0x6b, 0x6b,
-    0x6b, 0x82, 0x97, 0x93, 0xa5, 0xaf, 0xa6, 0xa6, 0xb6, 0xb6, 0xa6, 0x7f,
-    0x71, 0x71, 0x84, 0x84, 0x97, 0xa5, 0xa5, 0xc6, 0xb5, 0xb6, 0xbf, 0xc5,
-    0xc8, 0xc8, 0xb6, 0xb6, 0xb5, 0x8c, 0x57, 0x66, 0x7f, 0x97, 0x7f, 0x88,
-    0x8e, 0x94, 0x8e, 0x76, 0x9c, 0x94, 0xa6, 0xbb, 0xc6, 0xbb, 0xae, 0x9f,
-    0x9a, 0xa2, 0x86, 0x86, 0x87, 0x64, 0x64, 0x7d, 0x56, 0x64, 0x77, 0x53,
-    0x51, 0x60, 0x7d, 0x64, 0x60, 0x77, 0x87, 0x78, 0x67, 0x67, 0x49, 0x31,
-    0x3d, 0x49, 0x67, 0x67, 0x6e, 0x4f, 0x26, 0x11, 0x03, 0x03, 0x02, 0x02,
-    0x06, 0x0b, 0x13, 0x22, 0x20, 0x34, 0x34, 0x4f, 0x4f, 0x6e, 0x6e, 0x6e,
-    0x6e, 0x4f, 0x3c, 0x62, 0x62, 0x62, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-};
@@ -0,0 +1,177 @@
+//*****************************************************************************
+//
+// irq.c - Interrupt priorities and latency measurement.
+//
+// The interrupt sources are set up here with the priorities and the
+// preemption grouping chosen in defines.h.  SSI1 is the most urgent, since the
+// SPI link has only its eight word receive FIFO to bridge the time until its
+// handler runs.  The handlers of the sources raised by a timer record how long
+// after the timer expired they were entered, which shows the delay added by
+// the handlers of more urgent sources and by code that masks interrupts.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup irq_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_ints.h"
+#include "driverlib/interrupt.h"
+#include "defines.h"
+#include "irq.h"
+#include "touch.h"
+
+//*****************************************************************************
+//
+// The interrupt sources, in IRQ_* order.
+//
+//*****************************************************************************
+static tIrqSource g_psIrqSources[NUM_IRQS] =
+{
+    { "ssi1", INT_SSI1, INT_PRIORITY_SSI1, 0, 0, 0 },
+    { "timer0a", INT_TIMER0A, INT_PRIORITY_TIMER0A, 0, 0, 0 },
+    { "touch", TOUCH_INT, INT_PRIORITY_TOUCH, 0, 0, 0 },
+    { "uart0", INT_UART0, INT_PRIORITY_UART0, 0, 0, 0 },
+    { "systick", FAULT_SYSTICK, INT_PRIORITY_SYSTICK, 0, 0, 0 },
+};
+
+//*****************************************************************************
+//
+//! Sets up the interrupt priorities.
+//!
+//! This function sets the preemption grouping and the priority of every
+//! interrupt source.  It should be called before interrupts are enabled.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+IrqInit(void)
+{
+    uint32_t ui32Idx;
+
+    IntPriorityGroupingSet(INT_PRIORITY_PREEMPT_BITS);
+
+    for(ui32Idx = 0; ui32Idx < NUM_IRQS; ui32Idx++)
+    {
+        IntPrioritySet(g_psIrqSources[ui32Idx].ui32Int,
+                       g_psIrqSources[ui32Idx].ui8Priority);
+    }
+
+    IrqStatsReset();
+}
+
+//*****************************************************************************
+//
+//! Changes the priority of an interrupt source.
+//!
+//! \param ui32Irq is the interrupt source, one of the IRQ_* values.
+//! \param ui32Priority is the new priority, in the top three bits.
+//!
+//! The priority must be more urgent than that of PendSV, so that the source
+//! still preempts the paint jobs and is not held off by PainterLock().
+//!
+//! \return Returns \b true if the priority was changed, or \b false if the
+//! source or the priority is not valid.
+//
+//*****************************************************************************
+bool
+IrqPrioritySet(uint32_t ui32Irq, uint32_t ui32Priority)
+{
+    if((ui32Irq >= NUM_IRQS) || (ui32Priority & ~0xe0) ||
+       (ui32Priority >= INT_PRIORITY_PENDSV))
+    {
+        return(false);
+    }
+
+    g_psIrqSources[ui32Irq].ui8Priority = ui32Priority;
+    IntPrioritySet(g_psIrqSources[ui32Irq].ui32Int, ui32Priority);
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+//! Gets an interrupt source.
+//!
+//! \param ui32Irq is the interrupt source, one of the IRQ_* values.
+//!
+//! \return Returns a pointer to the source, or 0 if it is not valid.
+//
+//*****************************************************************************
+const tIrqSource *
+IrqSourceGet(uint32_t ui32Irq)
+{
+    return((ui32Irq < NUM_IRQS) ? &g_psIrqSources[ui32Irq] : 0);
+}
+
+//*****************************************************************************
+//
+//! Records the latency of an interrupt.
+//!
+//! \param ui32Irq is the interrupt source, one of the IRQ_* values.
+//! \param ui32Cycles is the time since the interrupt was raised, in processor
+//! cycles.
+//!
+//! This function is called, through IRQ_LATENCY(), from the handler of the
+//! source.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+IrqLatencyRecord(uint32_t ui32Irq, uint32_t ui32Cycles)
+{
+    tIrqSource *psSource;
+
+    psSource = &g_psIrqSources[ui32Irq];
+    psSource->ui32Samples++;
+    psSource->ui64LatencyTotal += ui32Cycles;
+    if(ui32Cycles > psSource->ui32LatencyMax)
+    {
+        psSource->ui32LatencyMax = ui32Cycles;
+    }
+}
+
+//*****************************************************************************
+//
+//! Resets the latency statistics of all interrupt sources.
+//!
+//! The handlers record their latencies at any priority, so interrupts are
+//! masked while the statistics are cleared.  Otherwise a latency recorded in
+//! the middle would leave a count without its total, or a total without its
+//! count.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+IrqStatsReset(void)
+{
+    uint32_t ui32Idx;
+    bool bMasked;
+
+    bMasked = IntMasterDisable();
+    for(ui32Idx = 0; ui32Idx < NUM_IRQS; ui32Idx++)
+    {
+        g_psIrqSources[ui32Idx].ui32Samples = 0;
+        g_psIrqSources[ui32Idx].ui32LatencyMax = 0;
+        g_psIrqSources[ui32Idx].ui64LatencyTotal = 0;
+    }
+    if(!bMasked)
+    {
+        IntMasterEnable();
+    }
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
@@ -0,0 +1,86 @@
+//*****************************************************************************
+//
+// irq.h - Prototypes and macros for the interrupt priorities and latencies.
+//
+// The latency measurement is enabled by defining IRQ_STATS_ENABLE (see
+// defines.h).  When it is not defined IRQ_LATENCY() expands to nothing, so the
+// interrupt handlers carry no cost.
+//
+//*****************************************************************************
+
+#ifndef __IRQ_H__
+#define __IRQ_H__
+
+//*****************************************************************************
+//
+// The interrupt sources of the application, in order of their default
+// priority (see defines.h).  PendSV, which runs the paint jobs, is set up by
+// the painter.
+//
+//*****************************************************************************
+#define IRQ_SSI1                0           // SPI link receive
+#define IRQ_TIMER0A             1           // Acquisition timer
+#define IRQ_TOUCH               2           // Touch screen sample
+#define IRQ_UART0               3           // Console and telemetry
+#define IRQ_SYSTICK             4           // Display frame
+#define NUM_IRQS                5
+
+//*****************************************************************************
+//
+//! An interrupt source, its priority and the latencies measured since the
+//! last reset of the statistics.  The latency is the time from the event that
+//! raised the interrupt to the entry of its handler, in processor cycles; it
+//! is only measured for the sources raised by a timer, whose count tells how
+//! long ago it expired.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The name of the source, used in reports.
+    //
+    const char *pcName;
+
+    //
+    //! The interrupt number.
+    //
+    uint32_t ui32Int;
+
+    //
+    //! The priority, in the top three bits.
+    //
+    uint8_t ui8Priority;
+
+    //
+    //! The number of latencies measured, and the longest and the total.
+    //
+    uint32_t ui32Samples;
+    uint32_t ui32LatencyMax;
+    uint64_t ui64LatencyTotal;
+}
+tIrqSource;
+
+//*****************************************************************************
+//
+// Records the latency of an interrupt; called first thing in its handler.
+//
+//*****************************************************************************
+#ifdef IRQ_STATS_ENABLE
+#define IRQ_LATENCY(ui32Irq, ui32Cycles)                                     \
+        IrqLatencyRecord(ui32Irq, ui32Cycles)
+#else
+#define IRQ_LATENCY(ui32Irq, ui32Cycles)
+#endif
+
+//*****************************************************************************
+//
+// Prototypes for the functions exported by the interrupt priority module.
+//
+//*****************************************************************************
+extern void IrqInit(void);
+extern bool IrqPrioritySet(uint32_t ui32Irq, uint32_t ui32Priority);
+extern const tIrqSource *IrqSourceGet(uint32_t ui32Irq);
+extern void IrqLatencyRecord(uint32_t ui32Irq, uint32_t ui32Cycles);
+extern void IrqStatsReset(void);
+
+#endif // __IRQ_H__
@@ -1,6659 +0,0 @@
-
-#include <stdint.h>
-#include <stdbool.h>
-#include "grlib/grlib.h"
-
-
-
-const uint8_t g_pui_Lightning_Image[] =
-{
-    IMAGE_FMT_8BPP_UNCOMP,
-    64, 1,
-        216, 0,
-//        216, 0,
-
-    241,
-    0x01, 0x01, 0x0f,
-    0x02, 0x00, 0x17,
-    0x00, 0x00, 0x1f,
-    0x00, 0x00, 0x28,
-    0x01, 0x00, 0x2e,
-    0x00, 0x01, 0x33,
-    0x01, 0x01, 0x3c,
-    0x04, 0x00, 0x42,
-    0x01, 0x01, 0x45,
-    0x04, 0x00, 0x4a,
-    0x00, 0x03, 0x48,
-    0x01, 0x01, 0x4e,
-    0x04, 0x02, 0x50,
-    0x00, 0x00, 0x56,
-    0x06, 0x00, 0x54,
-    0x00, 0x03, 0x51,
-    0x0e, 0x00, 0x54,
-    0x03, 0x01, 0x58,
-    0x00, 0x02, 0x5a,
-    0x00, 0x00, 0x5f,
-    0x07, 0x00, 0x5e,
-    0x02, 0x00, 0x61,
-    0x04, 0x01, 0x62,
-    0x00, 0x02, 0x64,
-    0x03, 0x00, 0x6b,
-    0x00, 0x01, 0x6e,
-    0x05, 0x02, 0x6d,
-    0x01, 0x00, 0x73,
-    0x04, 0x00, 0x76,
-    0x00, 0x03, 0x79,
-    0x07, 0x02, 0x79,
-    0x02, 0x00, 0x7f,
-    0x00, 0x00, 0x82,
-    0x05, 0x01, 0x82,
-    0x01, 0x06, 0x7b,
-    0x01, 0x00, 0x89,
-    0x00, 0x03, 0x84,
-    0x03, 0x00, 0x8b,
-    0x07, 0x04, 0x84,
-    0x00, 0x01, 0x8d,
-    0x00, 0x06, 0x85,
-    0x05, 0x02, 0x8d,
-    0x02, 0x00, 0x95,
-    0x03, 0x00, 0x96,
-    0x00, 0x05, 0x90,
-    0x04, 0x01, 0x98,
-    0x00, 0x02, 0x99,
-    0x00, 0x00, 0x9e,
-    0x02, 0x00, 0xa1,
-    0x08, 0x00, 0x9f,
-    0x03, 0x0e, 0x87,
-    0x00, 0x05, 0x9a,
-    0x06, 0x05, 0x9a,
-    0x00, 0x02, 0xa4,
-    0x00, 0x00, 0xaa,
-    0x01, 0x00, 0xac,
-    0x07, 0x00, 0xaa,
-    0x02, 0x00, 0xae,
-    0x05, 0x05, 0xa5,
-    0x00, 0x00, 0xb6,
-    0x04, 0x10, 0x96,
-    0x06, 0x00, 0xb5,
-    0x00, 0x04, 0xb0,
-    0x01, 0x0e, 0x9d,
-    0x03, 0x04, 0xb0,
-    0x00, 0x00, 0xb9,
-    0x00, 0x0b, 0xa8,
-    0x00, 0x00, 0xc1,
-    0x01, 0x03, 0xbb,
-    0x09, 0x03, 0xba,
-    0x05, 0x00, 0xc2,
-    0x04, 0x19, 0x93,
-    0x00, 0x03, 0xc6,
-    0x03, 0x00, 0xcd,
-    0x00, 0x09, 0xbd,
-    0x00, 0x00, 0xd0,
-    0x02, 0x12, 0xac,
-    0x02, 0x17, 0xa3,
-    0x0d, 0x00, 0xce,
-    0x00, 0x03, 0xd2,
-    0x00, 0x00, 0xd8,
-    0x02, 0x00, 0xdb,
-    0x07, 0x05, 0xd3,
-    0x05, 0x01, 0xdf,
-    0x00, 0x03, 0xde,
-    0x05, 0x19, 0xb1,
-    0x06, 0x11, 0xc1,
-    0x00, 0x00, 0xe5,
-    0x01, 0x00, 0xe8,
-    0x01, 0x11, 0xcc,
-    0x00, 0x00, 0xf1,
-    0x06, 0x00, 0xef,
-    0x05, 0x23, 0xac,
-    0x03, 0x05, 0xea,
-    0x00, 0x00, 0xf5,
-    0x05, 0x1d, 0xbe,
-    0x00, 0x09, 0xeb,
-    0x04, 0x00, 0xfc,
-    0x00, 0x00, 0xff,
-    0x0c, 0x0e, 0xe6,
-    0x05, 0x16, 0xda,
-    0x06, 0x33, 0xa3,
-    0x02, 0x20, 0xca,
-    0x03, 0x2a, 0xbc,
-    0x01, 0x19, 0xe7,
-    0x03, 0x0f, 0xfa,
-    0x00, 0x20, 0xe1,
-    0x04, 0x24, 0xd9,
-    0x00, 0x1b, 0xf4,
-    0x0e, 0x1a, 0xf3,
-    0x07, 0x18, 0xfe,
-    0x00, 0x1c, 0xff,
-    0x04, 0x31, 0xd5,
-    0x0a, 0x2a, 0xee,
-    0x00, 0x36, 0xdc,
-    0x08, 0x42, 0xc2,
-    0x00, 0x2b, 0xf4,
-    0x06, 0x3d, 0xd0,
-    0x07, 0x28, 0xfc,
-    0x00, 0x2b, 0xff,
-    0x00, 0x34, 0xf2,
-    0x0c, 0x37, 0xea,
-    0x00, 0x3c, 0xf0,
-    0x0b, 0x41, 0xe7,
-    0x00, 0x37, 0xff,
-    0x06, 0x49, 0xe2,
-    0x00, 0x45, 0xed,
-    0x0d, 0x3b, 0xfc,
-    0x00, 0x41, 0xfe,
-    0x0c, 0x4f, 0xe0,
-    0x0f, 0x46, 0xfa,
-    0x0e, 0x57, 0xdd,
-    0x01, 0x49, 0xfe,
-    0x0d, 0x4e, 0xf6,
-    0x0f, 0x5f, 0xd8,
-    0x02, 0x5a, 0xe7,
-    0x02, 0x50, 0xfd,
-    0x0e, 0x55, 0xf1,
-    0x01, 0x55, 0xf9,
-    0x00, 0x53, 0xff,
-    0x02, 0x5b, 0xf8,
-    0x0f, 0x5d, 0xf1,
-    0x00, 0x59, 0xff,
-    0x07, 0x67, 0xe4,
-    0x11, 0x6d, 0xd9,
-    0x00, 0x69, 0xe9,
-    0x05, 0x62, 0xf8,
-    0x00, 0x60, 0xff,
-    0x11, 0x65, 0xf0,
-    0x00, 0x67, 0xff,
-    0x0a, 0x69, 0xf8,
-    0x0a, 0x6d, 0xf5,
-    0x16, 0x70, 0xed,
-    0x00, 0x6e, 0xff,
-    0x0d, 0x74, 0xf3,
-    0x02, 0x73, 0xfd,
-    0x00, 0x75, 0xff,
-    0x02, 0x77, 0xfb,
-    0x11, 0x81, 0xe2,
-    0x14, 0x7b, 0xf0,
-    0x00, 0x7a, 0xff,
-    0x1e, 0x80, 0xeb,
-    0x00, 0x7f, 0xfe,
-    0x09, 0x82, 0xf9,
-    0x15, 0x84, 0xf1,
-    0x0c, 0x86, 0xf7,
-    0x00, 0x86, 0xfe,
-    0x00, 0x8b, 0xfe,
-    0x17, 0x8f, 0xf4,
-    0x05, 0x8f, 0xfb,
-    0x00, 0x92, 0xff,
-    0x06, 0x94, 0xfb,
-    0x24, 0x96, 0xed,
-    0x16, 0x96, 0xf5,
-    0x00, 0x97, 0xff,
-    0x09, 0x99, 0xf9,
-    0x00, 0x9d, 0xfe,
-    0x1e, 0x9f, 0xf6,
-    0x02, 0xa1, 0xfd,
-    0x0b, 0xa5, 0xfa,
-    0x26, 0xa6, 0xf1,
-    0x00, 0xa9, 0xff,
-    0x1b, 0xab, 0xf8,
-    0x00, 0xad, 0xfe,
-    0x00, 0xb2, 0xfd,
-    0x24, 0xb3, 0xf7,
-    0x07, 0xb7, 0xfc,
-    0x00, 0xbb, 0xff,
-    0x3e, 0xb8, 0xf6,
-    0x1c, 0xbd, 0xf9,
-    0x0b, 0xbf, 0xfc,
-    0x00, 0xc1, 0xfe,
-    0x2e, 0xbe, 0xf8,
-    0x00, 0xc9, 0xfd,
-    0x03, 0xcd, 0xfc,
-    0x1e, 0xc8, 0xfc,
-    0x36, 0xc7, 0xf9,
-    0x00, 0xd0, 0xff,
-    0x23, 0xcf, 0xfc,
-    0x00, 0xd8, 0xfd,
-    0x15, 0xd7, 0xfc,
-    0x3e, 0xd5, 0xfc,
-    0x2d, 0xd8, 0xfd,
-    0x0b, 0xe2, 0xfd,
-    0x00, 0xe5, 0xfe,
-    0x25, 0xe5, 0xfe,
-    0x00, 0xec, 0xfe,
-    0x56, 0xdc, 0xfe,
-    0x19, 0xeb, 0xfc,
-    0x37, 0xe6, 0xfe,
-    0x00, 0xf2, 0xfe,
-    0x4f, 0xe7, 0xfe,
-    0x2e, 0xee, 0xfe,
-    0x62, 0xe6, 0xfd,
-    0x23, 0xf3, 0xfd,
-    0x40, 0xef, 0xfe,
-    0x00, 0xfb, 0xfe,
-    0x34, 0xf5, 0xff,
-    0x51, 0xf1, 0xff,
-    0x1c, 0xfc, 0xfe,
-    0x5c, 0xf2, 0xfe,
-    0x47, 0xf6, 0xfe,
-    0x2f, 0xfd, 0xfe,
-    0x3b, 0xfd, 0xfd,
-    0x4c, 0xfe, 0xfe,
-    0x58, 0xfc, 0xfe,
-    0x65, 0xfd, 0xfe,
-    0x70, 0xfb, 0xfe,
-    0x7a, 0xfe, 0xff,
-    0x85, 0xfe, 0xfe,
-    0x90, 0xff, 0xfe,
-    0x97, 0xff, 0xfe,
-    0xa1, 0xff, 0xfe,
-    0xaf, 0xff, 0xfe,
-    0xb9, 0xff, 0xff,
-    0xc0, 0xff, 0xfe,
-    0xc6, 0xff, 0xfd,
-    0xcd, 0xfe, 0xff,
-    0xd4, 0xff, 0xfe,
-    0xda, 0xff, 0xfd,
-    0xe1, 0xfe, 0xff,
-    0xe9, 0xff, 0xfe,
-
-    0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2a, 0x2c, 0x27, 0x2c, 0x2a,
-    0x2b, 0x2b, 0x2a, 0x2b, 0x27, 0x27, 0x25, 0x25, 0x25, 0x2a, 0x2a, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x30, 0x2d, 0x56, 0x6d, 0x35, 0x33, 0x30,
-    0x2e, 0x2a, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2a, 0x2b, 0x2e, 0x2d, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x42, 0x59, 0x80, 0x68, 0x36,
-    0x30, 0x30, 0x30, 0x35, 0x35, 0x35, 0x30, 0x35, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x30, 0x30, 0x33, 0x2e, 0x33,
-    0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2b, 0x2e, 0x30, 0x30,
-    0x30, 0x30, 0x2f, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x2e, 0x2b, 0x2b,
-    0x2e, 0x2e, 0x33, 0x30, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x33, 0x2e,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x42, 0x36, 0x36, 0x42, 0x35, 0x42,
-    0x36, 0x37, 0x36, 0x37, 0x39, 0x39, 0x39, 0x37, 0x3e, 0x37, 0x39, 0x3b,
-    0x41, 0x46, 0x41, 0x41, 0x43, 0x49, 0x4f, 0x50, 0x51, 0x51, 0x58, 0x5e,
-    0x62, 0x6f, 0x84, 0xb7, 0xe6, 0xf0, 0xed, 0xe4, 0xdb, 0xb8, 0x95, 0x77,
-    0x62, 0x5e, 0x57, 0x4f, 0x48, 0x48, 0x41, 0x43, 0x41, 0x37, 0x37, 0x35,
-    0x30, 0x30, 0x33, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2b, 0x2a, 0x2b, 0x2b,
-    0x2c, 0x2c, 0x2b, 0x2f, 0x2e, 0x3b, 0xc0, 0xac, 0x2e, 0x2c, 0x2c, 0x2c,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2a, 0x2a, 0x2e, 0x33, 0x33, 0x35,
-    0x42, 0x37, 0x7b, 0xa8, 0x30, 0x2b, 0x27, 0x27, 0x25, 0x29, 0x37, 0x53,
-    0x94, 0xe3, 0xc0, 0x43, 0x30, 0x27, 0x23, 0x1e, 0x1f, 0x1f, 0x1d, 0x1c,
-    0x1b, 0x19, 0x1c, 0x1c, 0x1b, 0x19, 0x19, 0x1b, 0x18, 0x18, 0x19, 0x19,
-    0x19, 0x1c, 0x24, 0x25, 0x25, 0x27, 0x2b, 0x2b, 0x27, 0x24, 0x22, 0x1b,
-    0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x16,
-    0x16, 0x16, 0x15, 0x15, 0x15, 0x15, 0x15, 0x16, 0x2b, 0x2b, 0x2b, 0x2d,
-    0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x30, 0x30, 0x2f, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x2b, 0x2a, 0x2c, 0x2c, 0x2a, 0x2b, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e,
-    0x2b, 0x2b, 0x2d, 0x6b, 0x64, 0x30, 0x2e, 0x2f, 0x2d, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x34, 0x2e, 0x33, 0x30, 0x30,
-    0x33, 0x33, 0x3e, 0x6a, 0x74, 0x4f, 0x39, 0x35, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x2e, 0x33, 0x30, 0x2e, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x2f, 0x30,
-    0x2f, 0x30, 0x30, 0x2e, 0x2b, 0x2e, 0x2f, 0x2f, 0x2f, 0x30, 0x2e, 0x2d,
-    0x2e, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x2f, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30,
-    0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x35, 0x35, 0x42, 0x42, 0x35, 0x35, 0x35, 0x42, 0x36, 0x37, 0x36, 0x37,
-    0x39, 0x39, 0x39, 0x39, 0x3e, 0x39, 0x39, 0x3b, 0x41, 0x41, 0x46, 0x48,
-    0x49, 0x4b, 0x4f, 0x50, 0x51, 0x57, 0x5b, 0x61, 0x62, 0x6f, 0x8a, 0xbe,
-    0xe8, 0xf0, 0xea, 0xe0, 0xc7, 0xb0, 0x8e, 0x77, 0x62, 0x5e, 0x58, 0x51,
-    0x4b, 0x49, 0x43, 0x48, 0x41, 0x3b, 0x39, 0x37, 0x42, 0x30, 0x30, 0x30,
-    0x2f, 0x33, 0x2e, 0x2e, 0x2b, 0x2b, 0x2e, 0x2e, 0x2c, 0x2c, 0x2c, 0x31,
-    0x3a, 0x3b, 0xc4, 0x9e, 0x2b, 0x2c, 0x2a, 0x2c, 0x27, 0x27, 0x2c, 0x27,
-    0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x33, 0x30, 0x35, 0x41, 0xa5,
-    0x67, 0x2b, 0x27, 0x28, 0x27, 0x2b, 0x2c, 0x37, 0x41, 0xa4, 0xe3, 0x83,
-    0x37, 0x29, 0x20, 0x20, 0x1f, 0x1f, 0x1d, 0x1d, 0x1c, 0x1c, 0x1c, 0x1d,
-    0x1b, 0x19, 0x19, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x1f, 0x24,
-    0x24, 0x25, 0x27, 0x25, 0x23, 0x1f, 0x1d, 0x19, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x16, 0x16, 0x15, 0x15, 0x15,
-    0x15, 0x15, 0x15, 0x15, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2d, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b,
-    0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x30, 0x41, 0x7f,
-    0x39, 0x2c, 0x2b, 0x2e, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x2b, 0x2b, 0x2e, 0x30, 0x2e, 0x31, 0x30, 0x41, 0x78, 0x71,
-    0x41, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x33, 0x2f, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x33, 0x2f,
-    0x33, 0x2e, 0x33, 0x30, 0x30, 0x2e, 0x33, 0x2e, 0x2e, 0x33, 0x30, 0x2e,
-    0x2b, 0x33, 0x2e, 0x2b, 0x2e, 0x33, 0x2e, 0x2e, 0x2e, 0x33, 0x30, 0x30,
-    0x30, 0x30, 0x2f, 0x2e, 0x33, 0x33, 0x33, 0x30, 0x33, 0x30, 0x30, 0x30,
-    0x33, 0x2e, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x33,
-    0x2e, 0x30, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35,
-    0x35, 0x30, 0x30, 0x35, 0x37, 0x36, 0x36, 0x37, 0x39, 0x37, 0x37, 0x3e,
-    0x3b, 0x3e, 0x3e, 0x3b, 0x41, 0x4a, 0x43, 0x49, 0x4b, 0x4b, 0x50, 0x54,
-    0x57, 0x5e, 0x61, 0x69, 0x69, 0x7c, 0x99, 0xc2, 0xe7, 0xef, 0xe9, 0xcd,
-    0xb0, 0x9b, 0x84, 0x6f, 0x62, 0x5e, 0x58, 0x54, 0x50, 0x49, 0x48, 0x48,
-    0x41, 0x3e, 0x39, 0x37, 0x37, 0x36, 0x35, 0x30, 0x33, 0x2e, 0x2e, 0x2d,
-    0x2d, 0x2b, 0x2e, 0x2b, 0x2c, 0x2a, 0x2e, 0x36, 0x48, 0x72, 0xd1, 0x7b,
-    0x2b, 0x2a, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2a, 0x2a,
-    0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2e, 0x2b, 0x70, 0x97, 0x64, 0x42, 0x2b,
-    0x25, 0x27, 0x29, 0x2b, 0x30, 0x4a, 0xc4, 0xc9, 0x70, 0x30, 0x24, 0x1f,
-    0x1d, 0x1d, 0x1d, 0x1c, 0x1d, 0x1b, 0x1c, 0x1c, 0x1b, 0x19, 0x19, 0x1b,
-    0x19, 0x19, 0x19, 0x18, 0x18, 0x19, 0x1d, 0x22, 0x1f, 0x1f, 0x24, 0x20,
-    0x1d, 0x1d, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x17, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x15, 0x15, 0x15,
-    0x2b, 0x2b, 0x2d, 0x2d, 0x2b, 0x2d, 0x33, 0x2e, 0x2e, 0x30, 0x2f, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2d, 0x2b, 0x2b,
-    0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2c, 0x27, 0x2a, 0x2c, 0x29, 0x2b, 0x2e,
-    0x2b, 0x2e, 0x3a, 0x37, 0x3b, 0x49, 0x6d, 0x48, 0x2d, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2a, 0x2a, 0x2c, 0x2a, 0x2a, 0x2a, 0x2b,
-    0x2e, 0x2e, 0x2d, 0x2e, 0x30, 0x79, 0x6a, 0x37, 0x30, 0x2e, 0x30, 0x33,
-    0x2e, 0x33, 0x33, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x30,
-    0x30, 0x30, 0x30, 0x33, 0x33, 0x2e, 0x33, 0x30, 0x30, 0x2e, 0x33, 0x2f,
-    0x30, 0x2e, 0x33, 0x2e, 0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x2e, 0x2d, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x2e, 0x2e,
-    0x2e, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x33, 0x2e,
-    0x30, 0x30, 0x30, 0x30, 0x2e, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x30,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x2e,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35,
-    0x36, 0x42, 0x42, 0x37, 0x37, 0x37, 0x37, 0x3e, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x41, 0x48, 0x48, 0x49, 0x4b, 0x50, 0x54, 0x5d, 0x5a, 0x5e, 0x62, 0x6e,
-    0x77, 0x8b, 0xaa, 0xcd, 0xea, 0xf0, 0xe7, 0xc2, 0x9d, 0x88, 0x77, 0x6f,
-    0x5e, 0x5e, 0x57, 0x51, 0x4b, 0x49, 0x43, 0x48, 0x3b, 0x37, 0x37, 0x42,
-    0x42, 0x35, 0x35, 0x30, 0x33, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x2c, 0x2a, 0x30, 0x83, 0xbe, 0xbd, 0x8f, 0x3e, 0x2a, 0x2c, 0x2c, 0x27,
-    0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x2c, 0x2c, 0x2a, 0x35, 0x59, 0x82, 0x85, 0x71, 0x59, 0x42, 0x2b, 0x2a,
-    0x2b, 0x30, 0x6b, 0xd1, 0xb4, 0x42, 0x25, 0x24, 0x1d, 0x1c, 0x1b, 0x1c,
-    0x1d, 0x1d, 0x1b, 0x1c, 0x19, 0x18, 0x19, 0x1b, 0x19, 0x19, 0x19, 0x18,
-    0x18, 0x18, 0x19, 0x1b, 0x1b, 0x1d, 0x22, 0x1c, 0x19, 0x19, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x16,
-    0x15, 0x15, 0x16, 0x16, 0x15, 0x15, 0x15, 0x15, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x2e, 0x2d, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-    0x2a, 0x2c, 0x2c, 0x2a, 0x29, 0x2b, 0x30, 0x41, 0x59, 0x68, 0x71, 0x6d,
-    0x6d, 0x5d, 0x41, 0x2e, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2a, 0x2d, 0x2b,
-    0x2b, 0x2c, 0x2c, 0x27, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x33,
-    0x37, 0x94, 0x3e, 0x30, 0x3a, 0x30, 0x30, 0x30, 0x33, 0x33, 0x2e, 0x33,
-    0x2e, 0x33, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x30, 0x2f, 0x30, 0x2f, 0x30,
-    0x33, 0x33, 0x30, 0x30, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x2e, 0x2e, 0x33,
-    0x2e, 0x2b, 0x2e, 0x2d, 0x2b, 0x2d, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x33,
-    0x2d, 0x33, 0x2e, 0x2e, 0x2d, 0x2e, 0x2e, 0x2e, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x33, 0x33, 0x2e,
-    0x2e, 0x2e, 0x30, 0x2e, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x33,
-    0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x30, 0x33, 0x2e, 0x2e, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x42, 0x42, 0x35, 0x37,
-    0x37, 0x37, 0x37, 0x3e, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x48, 0x4b, 0x4f,
-    0x51, 0x57, 0x5b, 0x5e, 0x62, 0x6f, 0x77, 0x88, 0xa6, 0xba, 0xd7, 0xe5,
-    0xee, 0xec, 0xe2, 0xb5, 0x8c, 0x77, 0x6f, 0x69, 0x5a, 0x58, 0x51, 0x50,
-    0x49, 0x48, 0x46, 0x48, 0x3b, 0x42, 0x35, 0x35, 0x35, 0x30, 0x30, 0x30,
-    0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2c, 0x2c, 0x2b, 0x37, 0xbc,
-    0xb9, 0x4a, 0x2f, 0x2b, 0x27, 0x27, 0x27, 0x25, 0x23, 0x23, 0x24, 0x25,
-    0x23, 0x25, 0x27, 0x27, 0x25, 0x23, 0x25, 0x25, 0x25, 0x23, 0x21, 0x28,
-    0x24, 0x42, 0x3b, 0x5f, 0x78, 0x7b, 0x3b, 0x27, 0x27, 0x2d, 0x41, 0xa1,
-    0xdc, 0x66, 0x2b, 0x21, 0x1d, 0x1c, 0x1b, 0x1b, 0x1d, 0x1d, 0x1b, 0x1b,
-    0x19, 0x18, 0x18, 0x19, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x18, 0x19, 0x19, 0x19, 0x18, 0x18, 0x17, 0x17, 0x18, 0x18, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x18, 0x17, 0x17, 0x15, 0x15, 0x15, 0x16, 0x15,
-    0x15, 0x15, 0x12, 0x13, 0x2e, 0x2d, 0x2d, 0x2d, 0x2b, 0x2b, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2f, 0x30, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2a, 0x27, 0x2a, 0x2a, 0x2a, 0x2c, 0x2c, 0x27, 0x2c, 0x2b,
-    0x27, 0x2b, 0x44, 0x6d, 0x5d, 0x64, 0x48, 0x3b, 0x36, 0x30, 0x2e, 0x2c,
-    0x2a, 0x2c, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2c, 0x27, 0x27, 0x2c,
-    0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2c, 0x2f, 0x56, 0x85, 0x35, 0x2b,
-    0x31, 0x33, 0x2e, 0x2e, 0x2f, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x2f, 0x30,
-    0x34, 0x2e, 0x2e, 0x33, 0x2e, 0x33, 0x2f, 0x30, 0x30, 0x2e, 0x30, 0x30,
-    0x33, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x2e, 0x33, 0x2b, 0x2d, 0x2e, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2d, 0x2e, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x33, 0x33,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x2e, 0x33,
-    0x2e, 0x2e, 0x30, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x33, 0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x35, 0x42, 0x42, 0x42, 0x35, 0x35, 0x42, 0x37, 0x37, 0x39, 0x3b,
-    0x3b, 0x41, 0x4a, 0x41, 0x43, 0x48, 0x4f, 0x54, 0x57, 0x5a, 0x5e, 0x62,
-    0x6f, 0x84, 0xa7, 0xca, 0xe3, 0xe7, 0xeb, 0xef, 0xeb, 0xe5, 0xc3, 0x95,
-    0x7c, 0x6f, 0x62, 0x5e, 0x5b, 0x57, 0x50, 0x4b, 0x49, 0x48, 0x43, 0x48,
-    0x41, 0x36, 0x35, 0x42, 0x35, 0x35, 0x35, 0x30, 0x2e, 0x2e, 0x2b, 0x2b,
-    0x2b, 0x2c, 0x27, 0x25, 0x27, 0x2e, 0x3b, 0xc4, 0xc3, 0x48, 0x31, 0x2c,
-    0x25, 0x25, 0x25, 0x23, 0x24, 0x20, 0x24, 0x24, 0x28, 0x23, 0x25, 0x25,
-    0x24, 0x24, 0x25, 0x23, 0x23, 0x24, 0x20, 0x20, 0x26, 0x28, 0x25, 0x2b,
-    0x37, 0x70, 0x7b, 0x2b, 0x25, 0x2c, 0x3e, 0x9f, 0xe5, 0x98, 0x35, 0x1f,
-    0x22, 0x1d, 0x1b, 0x1b, 0x1b, 0x1c, 0x19, 0x19, 0x18, 0x18, 0x18, 0x1a,
-    0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x17, 0x17, 0x17, 0x18, 0x17, 0x17, 0x17, 0x16, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x15, 0x15, 0x15, 0x15, 0x13, 0x12, 0x12, 0x12, 0x15,
-    0x2e, 0x2d, 0x2d, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x2e,
-    0x2e, 0x2e, 0x2d, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x2c, 0x27,
-    0x2c, 0x2c, 0x27, 0x2c, 0x2c, 0x27, 0x2c, 0x2a, 0x27, 0x2e, 0x71, 0x48,
-    0x30, 0x2e, 0x33, 0x30, 0x2a, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2b, 0x27,
-    0x2c, 0x2a, 0x2a, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2b, 0x2a,
-    0x2b, 0x27, 0x2e, 0x2e, 0x67, 0x7b, 0x2e, 0x30, 0x33, 0x2e, 0x2b, 0x2b,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2b,
-    0x2e, 0x2e, 0x2d, 0x2e, 0x34, 0x2d, 0x2e, 0x33, 0x30, 0x2f, 0x30, 0x30,
-    0x2e, 0x2b, 0x33, 0x33, 0x2e, 0x33, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2d, 0x2d, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x33,
-    0x2d, 0x2b, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x33, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2d, 0x2e, 0x2e, 0x30, 0x2e, 0x2e,
-    0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x42, 0x42, 0x37,
-    0x36, 0x42, 0x35, 0x35, 0x37, 0x39, 0x3b, 0x3b, 0x3b, 0x41, 0x43, 0x48,
-    0x49, 0x4f, 0x51, 0x54, 0x5b, 0x61, 0x6f, 0x7c, 0x95, 0xbe, 0xe3, 0xea,
-    0xed, 0xee, 0xeb, 0xe5, 0xda, 0xba, 0x93, 0x77, 0x6f, 0x61, 0x5e, 0x5d,
-    0x54, 0x50, 0x4b, 0x48, 0x49, 0x48, 0x41, 0x41, 0x48, 0x37, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x2f, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x2a, 0x3a, 0x70, 0xc3, 0xb1, 0x42, 0x2b, 0x27, 0x23, 0x27, 0x25,
-    0x24, 0x20, 0x1f, 0x20, 0x24, 0x25, 0x25, 0x24, 0x24, 0x23, 0x23, 0x24,
-    0x24, 0x20, 0x1f, 0x1f, 0x1f, 0x20, 0x24, 0x27, 0x2b, 0x4c, 0x89, 0x2c,
-    0x2b, 0x2e, 0x59, 0xc0, 0xd3, 0x6b, 0x30, 0x26, 0x22, 0x1d, 0x1b, 0x1b,
-    0x19, 0x19, 0x1b, 0x19, 0x19, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x15, 0x12, 0x12, 0x12, 0x12, 0x12, 0x15, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2c,
-    0x2a, 0x2a, 0x27, 0x25, 0x2a, 0x4f, 0x71, 0x30, 0x2b, 0x2c, 0x2b, 0x30,
-    0x2d, 0x2b, 0x2a, 0x2a, 0x2c, 0x2a, 0x2b, 0x2a, 0x2a, 0x2b, 0x2a, 0x2c,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2b, 0x2c, 0x2c, 0x2b,
-    0x83, 0x6b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2f, 0x30, 0x2f, 0x30,
-    0x30, 0x2f, 0x33, 0x30, 0x2e, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x2e, 0x2e,
-    0x2d, 0x2b, 0x2b, 0x2e, 0x2e, 0x30, 0x30, 0x2f, 0x2b, 0x2e, 0x33, 0x2e,
-    0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2e, 0x2e, 0x2b, 0x2d, 0x30,
-    0x30, 0x30, 0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2d, 0x2b, 0x2d, 0x2e, 0x30, 0x30, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x37, 0x37, 0x37, 0x37, 0x37, 0x36, 0x37,
-    0x37, 0x39, 0x3b, 0x3b, 0x41, 0x41, 0x43, 0x49, 0x50, 0x57, 0x5a, 0x5e,
-    0x62, 0x6e, 0x84, 0xa7, 0xca, 0xe6, 0xed, 0xec, 0xe6, 0xda, 0xca, 0xb7,
-    0xa9, 0x95, 0x77, 0x69, 0x69, 0x5a, 0x58, 0x57, 0x50, 0x4b, 0x49, 0x48,
-    0x48, 0x46, 0x3b, 0x3b, 0x48, 0x41, 0x36, 0x30, 0x33, 0x30, 0x30, 0x2e,
-    0x2e, 0x2b, 0x2c, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x2c, 0x2a, 0x2e, 0x37,
-    0x70, 0xd1, 0x75, 0x2b, 0x25, 0x23, 0x23, 0x24, 0x20, 0x1f, 0x20, 0x20,
-    0x20, 0x24, 0x24, 0x20, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x21, 0x1f,
-    0x1f, 0x20, 0x20, 0x23, 0x2a, 0x55, 0x7b, 0x2b, 0x2b, 0x36, 0xac, 0xe5,
-    0xdc, 0x9f, 0x41, 0x2b, 0x20, 0x1d, 0x1c, 0x1d, 0x1b, 0x1b, 0x1b, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x15, 0x12,
-    0x12, 0x12, 0x15, 0x15, 0x2a, 0x2a, 0x2a, 0x2a, 0x2c, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b,
-    0x2a, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2a, 0x2b, 0x2d,
-    0x59, 0x82, 0x48, 0x2d, 0x2b, 0x2c, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x2c, 0x2a, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x2c, 0x2c, 0x2c, 0x2a, 0x2b, 0x2d, 0x2b, 0x35, 0x70, 0x7b, 0x2e, 0x2d,
-    0x2b, 0x2e, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2f, 0x30, 0x2e, 0x2e, 0x33,
-    0x33, 0x33, 0x30, 0x30, 0x30, 0x33, 0x2e, 0x2b, 0x2e, 0x2a, 0x2b, 0x2b,
-    0x2d, 0x33, 0x2e, 0x2e, 0x2d, 0x2d, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x33, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2d, 0x2b, 0x2d, 0x2b, 0x2b,
-    0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2b,
-    0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2f, 0x2e, 0x2d, 0x2d, 0x33, 0x2e,
-    0x30, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x30, 0x30, 0x30, 0x30,
-    0x35, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3e, 0x3d, 0x3b, 0x3b, 0x41,
-    0x41, 0x46, 0x48, 0x4b, 0x54, 0x5a, 0x5e, 0x6f, 0x7c, 0x95, 0xb7, 0xda,
-    0xe9, 0xee, 0xeb, 0xda, 0xbe, 0xa3, 0x8e, 0x7c, 0x7c, 0x76, 0x6e, 0x5e,
-    0x5d, 0x57, 0x54, 0x51, 0x4b, 0x48, 0x48, 0x41, 0x41, 0x3b, 0x3e, 0x3e,
-    0x41, 0x43, 0x41, 0x30, 0x2e, 0x30, 0x30, 0x2e, 0x2e, 0x2b, 0x2c, 0x2a,
-    0x2a, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2d, 0x30, 0x70, 0xca, 0x66, 0x2c,
-    0x1f, 0x24, 0x24, 0x20, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x21, 0x1f, 0x1f, 0x1f, 0x1f, 0x20,
-    0x29, 0x4c, 0x92, 0x35, 0x29, 0x42, 0x83, 0xc0, 0xca, 0xe3, 0x98, 0x30,
-    0x24, 0x1d, 0x1c, 0x1b, 0x1c, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x18, 0x18, 0x18, 0x18, 0x19, 0x19, 0x19, 0x18, 0x18, 0x17, 0x17, 0x17,
-    0x18, 0x18, 0x17, 0x17, 0x16, 0x17, 0x17, 0x17, 0x17, 0x16, 0x15, 0x15,
-    0x15, 0x16, 0x16, 0x16, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x16,
-    0x2c, 0x2c, 0x2c, 0x2c, 0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x42, 0x5d, 0x63, 0x41, 0x2e, 0x2e,
-    0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x2c, 0x2a, 0x2c, 0x2c, 0x2a, 0x2a, 0x2c,
-    0x2a, 0x2b, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x2b,
-    0x2c, 0x2b, 0x30, 0x67, 0x9f, 0x72, 0x2e, 0x2e, 0x2d, 0x2e, 0x2e, 0x2b,
-    0x2b, 0x2e, 0x2b, 0x2e, 0x30, 0x2d, 0x2d, 0x33, 0x33, 0x30, 0x2f, 0x30,
-    0x30, 0x2e, 0x33, 0x2e, 0x2b, 0x2a, 0x2b, 0x2b, 0x2e, 0x33, 0x2e, 0x2b,
-    0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2d, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2d, 0x2d, 0x2b, 0x2b,
-    0x2d, 0x2b, 0x2b, 0x2b, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2f, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e,
-    0x33, 0x33, 0x30, 0x2e, 0x2e, 0x2e, 0x33, 0x2f, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x37, 0x37, 0x37,
-    0x39, 0x39, 0x3e, 0x3b, 0x3b, 0x41, 0x41, 0x46, 0x43, 0x48, 0x49, 0x51,
-    0x5d, 0x5e, 0x5e, 0x7f, 0x9b, 0xc6, 0xe4, 0xed, 0xf0, 0xe9, 0xda, 0xb2,
-    0x88, 0x77, 0x6f, 0x69, 0x5e, 0x5e, 0x61, 0x5a, 0x51, 0x51, 0x50, 0x4b,
-    0x48, 0x48, 0x43, 0x3b, 0x3b, 0x39, 0x37, 0x37, 0x3e, 0x48, 0x46, 0x30,
-    0x33, 0x30, 0x30, 0x2b, 0x2e, 0x2b, 0x2c, 0x2b, 0x2a, 0x27, 0x25, 0x27,
-    0x27, 0x2a, 0x2e, 0x5f, 0xc6, 0xa1, 0x3e, 0x25, 0x28, 0x24, 0x20, 0x20,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x22, 0x1f, 0x1f, 0x1f, 0x30, 0x98, 0x83,
-    0x25, 0x2e, 0x2e, 0x3b, 0x4b, 0xb9, 0xd3, 0x67, 0x2c, 0x1d, 0x19, 0x1b,
-    0x1b, 0x19, 0x19, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x18, 0x18, 0x17, 0x17,
-    0x16, 0x15, 0x17, 0x17, 0x17, 0x17, 0x15, 0x15, 0x15, 0x16, 0x16, 0x16,
-    0x15, 0x15, 0x15, 0x15, 0x15, 0x16, 0x15, 0x15, 0x27, 0x27, 0x27, 0x2c,
-    0x2c, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x2a, 0x2c, 0x2c, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x2c, 0x2a,
-    0x2b, 0x2e, 0x68, 0x51, 0x37, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2c, 0x27,
-    0x2c, 0x2a, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x2c, 0x2b, 0x2b, 0x2a,
-    0x27, 0x2c, 0x2a, 0x27, 0x27, 0x2c, 0x27, 0x2b, 0x2a, 0x29, 0x42, 0x9a,
-    0xaf, 0x59, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2d,
-    0x2f, 0x2e, 0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2b, 0x2d, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b,
-    0x2b, 0x33, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2e, 0x2e, 0x33, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2d, 0x2e, 0x2d, 0x2e, 0x2e, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b,
-    0x2d, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2a, 0x2e, 0x2e, 0x2d, 0x2d, 0x2e,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x2e,
-    0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x37, 0x37, 0x37, 0x37, 0x3e, 0x3b, 0x3b,
-    0x41, 0x41, 0x41, 0x43, 0x48, 0x49, 0x50, 0x57, 0x5e, 0x5e, 0x76, 0x95,
-    0xc2, 0xe7, 0xee, 0xed, 0xe7, 0xd3, 0xa9, 0x80, 0x6e, 0x62, 0x5e, 0x61,
-    0x5a, 0x58, 0x58, 0x54, 0x51, 0x49, 0x49, 0x48, 0x43, 0x41, 0x41, 0x3b,
-    0x39, 0x37, 0x37, 0x36, 0x42, 0x3b, 0x46, 0x30, 0x2e, 0x30, 0x2d, 0x2b,
-    0x2e, 0x2b, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x30, 0xa1,
-    0xd4, 0x5f, 0x35, 0x29, 0x25, 0x24, 0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x22, 0x1f, 0x1f, 0x1f, 0x1d, 0x1f, 0x22, 0x1f, 0x1f, 0x1f, 0x22,
-    0x22, 0x22, 0x22, 0x1d, 0x20, 0x21, 0x66, 0xb1, 0x37, 0x2c, 0x2c, 0x2a,
-    0x36, 0x66, 0xdc, 0x83, 0x30, 0x1f, 0x19, 0x1b, 0x1b, 0x18, 0x19, 0x1b,
-    0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x15, 0x15, 0x16, 0x16, 0x16, 0x15, 0x15, 0x15, 0x15,
-    0x15, 0x15, 0x15, 0x15, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2a, 0x2c, 0x2a,
-    0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x2a, 0x2c, 0x27, 0x27, 0x2b, 0x2a, 0x2b, 0x3d, 0x71, 0x3e,
-    0x2b, 0x25, 0x2c, 0x2d, 0x2a, 0x2a, 0x2c, 0x2c, 0x2b, 0x2b, 0x27, 0x27,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2a, 0x27, 0x2c, 0x2a, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2e, 0x2c, 0x30, 0x89, 0x70, 0x39, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2d,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2e, 0x2b, 0x2a, 0x2b, 0x33, 0x2d, 0x2b,
-    0x2a, 0x2a, 0x2b, 0x2e, 0x2b, 0x2e, 0x2e, 0x2e, 0x33, 0x2d, 0x2e, 0x2e,
-    0x2d, 0x2e, 0x30, 0x2e, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x27, 0x2c,
-    0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2d, 0x2d, 0x30, 0x2d, 0x2b, 0x2d, 0x2d,
-    0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x33, 0x2e, 0x33, 0x30, 0x2f,
-    0x30, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x35, 0x37, 0x37, 0x37, 0x37, 0x3e, 0x3b, 0x3b, 0x41, 0x3b, 0x41, 0x48,
-    0x49, 0x4b, 0x54, 0x5b, 0x62, 0x6f, 0x88, 0xb3, 0xe1, 0xef, 0xef, 0xe6,
-    0xc8, 0x9d, 0x80, 0x69, 0x61, 0x61, 0x5a, 0x58, 0x57, 0x54, 0x50, 0x4b,
-    0x48, 0x48, 0x43, 0x41, 0x41, 0x3b, 0x3b, 0x3e, 0x39, 0x37, 0x37, 0x35,
-    0x30, 0x35, 0x3d, 0x30, 0x2e, 0x2e, 0x2b, 0x2e, 0x33, 0x2b, 0x2c, 0x27,
-    0x2c, 0x27, 0x27, 0x25, 0x25, 0x27, 0x2e, 0x70, 0xd4, 0x83, 0x35, 0x2c,
-    0x26, 0x24, 0x20, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x22, 0x1d, 0x1d, 0x22, 0x22, 0x1f, 0x22, 0x22, 0x22, 0x22, 0x1f, 0x1d,
-    0x20, 0x1f, 0x2e, 0x7b, 0x81, 0x2b, 0x21, 0x23, 0x25, 0x39, 0xbc, 0xbc,
-    0x37, 0x25, 0x1c, 0x1c, 0x1c, 0x18, 0x19, 0x19, 0x1b, 0x19, 0x19, 0x19,
-    0x1b, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x15, 0x15, 0x17, 0x17, 0x17, 0x15,
-    0x15, 0x16, 0x16, 0x16, 0x15, 0x12, 0x12, 0x16, 0x15, 0x13, 0x12, 0x12,
-    0x27, 0x2c, 0x2a, 0x2c, 0x2a, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x2b, 0x2a, 0x2b, 0x2c, 0x2a, 0x2a, 0x2c, 0x2a, 0x2c,
-    0x2c, 0x29, 0x2b, 0x2c, 0x2e, 0x68, 0x52, 0x2f, 0x2b, 0x27, 0x27, 0x2c,
-    0x2c, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x2c, 0x2a, 0x2a, 0x2c, 0x27, 0x2a, 0x2a, 0x27, 0x27, 0x2c, 0x2c, 0x2b,
-    0x2b, 0x2b, 0x30, 0x71, 0x56, 0x30, 0x2c, 0x2b, 0x2d, 0x2b, 0x2b, 0x2a,
-    0x2a, 0x2b, 0x2b, 0x33, 0x30, 0x2e, 0x33, 0x2e, 0x33, 0x2f, 0x30, 0x2f,
-    0x30, 0x2f, 0x30, 0x33, 0x2e, 0x2e, 0x2d, 0x2b, 0x2e, 0x2b, 0x2b, 0x2e,
-    0x2b, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2b, 0x2b, 0x2e, 0x2c, 0x27, 0x2b, 0x2b, 0x2a, 0x2b, 0x2d,
-    0x2d, 0x2b, 0x2b, 0x2d, 0x33, 0x2e, 0x2e, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x33, 0x33, 0x30, 0x30, 0x33, 0x2f,
-    0x33, 0x30, 0x30, 0x35, 0x42, 0x42, 0x35, 0x36, 0x36, 0x37, 0x37, 0x37,
-    0x39, 0x39, 0x3b, 0x41, 0x41, 0x41, 0x46, 0x48, 0x4b, 0x50, 0x58, 0x5e,
-    0x6f, 0x80, 0xb3, 0xdc, 0xe9, 0xf1, 0xeb, 0xdd, 0xa7, 0x80, 0x6f, 0x69,
-    0x5e, 0x58, 0x57, 0x54, 0x50, 0x4b, 0x49, 0x48, 0x43, 0x46, 0x41, 0x3b,
-    0x3e, 0x3e, 0x3b, 0x37, 0x37, 0x42, 0x35, 0x30, 0x30, 0x35, 0x36, 0x30,
-    0x30, 0x2e, 0x2b, 0x2e, 0x2d, 0x2a, 0x2a, 0x2b, 0x2b, 0x27, 0x25, 0x27,
-    0x23, 0x25, 0x2e, 0x42, 0x9f, 0xd3, 0x5f, 0x2b, 0x25, 0x20, 0x1f, 0x22,
-    0x22, 0x1f, 0x1f, 0x1f, 0x22, 0x1f, 0x20, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x22, 0x1f, 0x1f, 0x1d, 0x22, 0x22, 0x22, 0x1f, 0x1f, 0x20, 0x24, 0x41,
-    0xa8, 0x2c, 0x20, 0x23, 0x23, 0x3e, 0xac, 0xd5, 0x3e, 0x25, 0x1c, 0x19,
-    0x1c, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x17, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x15, 0x17, 0x17, 0x15,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x15, 0x15, 0x16, 0x15,
-    0x15, 0x15, 0x12, 0x15, 0x15, 0x12, 0x12, 0x11, 0x27, 0x2b, 0x2b, 0x2a,
-    0x2a, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x2c, 0x2c, 0x2b, 0x2a, 0x2c, 0x2a, 0x2b, 0x25, 0x28, 0x25,
-    0x2b, 0x52, 0x52, 0x2c, 0x2b, 0x27, 0x27, 0x2a, 0x27, 0x27, 0x2c, 0x27,
-    0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2a,
-    0x2c, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2b, 0x2b, 0x3e, 0x85,
-    0x37, 0x30, 0x29, 0x2b, 0x2d, 0x2d, 0x2f, 0x2a, 0x2a, 0x2b, 0x2b, 0x33,
-    0x30, 0x2d, 0x2d, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x30, 0x30, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2b, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b,
-    0x2b, 0x2d, 0x2e, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x33, 0x33, 0x2e,
-    0x2e, 0x2b, 0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2e, 0x2b, 0x2a, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2d,
-    0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x33, 0x33, 0x2e, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x42, 0x36, 0x42, 0x36, 0x36, 0x37, 0x37, 0x37, 0x39, 0x3e, 0x3b, 0x41,
-    0x41, 0x41, 0x48, 0x48, 0x4b, 0x51, 0x5a, 0x62, 0x77, 0x9b, 0xd3, 0xeb,
-    0xf0, 0xed, 0xe5, 0xb8, 0x88, 0x6f, 0x5e, 0x5e, 0x58, 0x51, 0x50, 0x4f,
-    0x4b, 0x48, 0x43, 0x41, 0x41, 0x41, 0x3b, 0x3e, 0x39, 0x39, 0x39, 0x37,
-    0x36, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2b,
-    0x2b, 0x2c, 0x27, 0x2c, 0x27, 0x23, 0x23, 0x27, 0x23, 0x25, 0x2b, 0x30,
-    0x6b, 0xdc, 0x72, 0x2b, 0x24, 0x20, 0x1f, 0x22, 0x1d, 0x1f, 0x1f, 0x22,
-    0x22, 0x1f, 0x1f, 0x22, 0x1d, 0x1d, 0x1d, 0x1d, 0x22, 0x1f, 0x1f, 0x1f,
-    0x22, 0x1f, 0x22, 0x1d, 0x22, 0x1d, 0x23, 0x4c, 0x9f, 0x34, 0x25, 0x27,
-    0x27, 0x5f, 0xd5, 0xac, 0x3e, 0x25, 0x1c, 0x1c, 0x19, 0x1b, 0x1b, 0x1b,
-    0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x19, 0x18, 0x18, 0x17, 0x18, 0x18,
-    0x17, 0x17, 0x17, 0x15, 0x15, 0x17, 0x17, 0x15, 0x17, 0x17, 0x15, 0x15,
-    0x15, 0x15, 0x13, 0x15, 0x15, 0x15, 0x17, 0x15, 0x15, 0x15, 0x12, 0x15,
-    0x15, 0x12, 0x12, 0x12, 0x2c, 0x2b, 0x2b, 0x2c, 0x2a, 0x2b, 0x2b, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2c, 0x27, 0x2a, 0x2c, 0x2a,
-    0x2b, 0x2a, 0x2c, 0x2c, 0x2b, 0x25, 0x28, 0x29, 0x2b, 0x44, 0x53, 0x27,
-    0x2d, 0x25, 0x25, 0x2c, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x2a, 0x27, 0x27, 0x2c, 0x2a, 0x2a, 0x2a, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x28, 0x2b, 0x29, 0x40, 0x7e, 0x39, 0x3a, 0x29, 0x2a,
-    0x2e, 0x2e, 0x2e, 0x2b, 0x2a, 0x2b, 0x2b, 0x33, 0x30, 0x2b, 0x2d, 0x2b,
-    0x2d, 0x2e, 0x2e, 0x2e, 0x33, 0x33, 0x2e, 0x2b, 0x2b, 0x2e, 0x2b, 0x2b,
-    0x2e, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b,
-    0x2c, 0x2b, 0x2b, 0x2d, 0x2e, 0x33, 0x33, 0x2d, 0x2b, 0x2b, 0x27, 0x27,
-    0x2c, 0x2b, 0x2b, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x27, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2d, 0x2d,
-    0x2b, 0x2a, 0x2b, 0x2b, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x33, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x42, 0x36, 0x42, 0x36,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x41, 0x43, 0x43, 0x48, 0x48, 0x4b,
-    0x50, 0x57, 0x5e, 0x6f, 0x7c, 0xa9, 0xe3, 0xef, 0xef, 0xe4, 0xc2, 0x95,
-    0x77, 0x62, 0x5e, 0x58, 0x51, 0x50, 0x4f, 0x49, 0x48, 0x41, 0x41, 0x41,
-    0x3b, 0x3b, 0x39, 0x39, 0x37, 0x39, 0x37, 0x36, 0x35, 0x30, 0x30, 0x30,
-    0x2f, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2a, 0x2c, 0x2c, 0x27, 0x27,
-    0x25, 0x24, 0x23, 0x29, 0x25, 0x25, 0x2e, 0x37, 0x66, 0xd7, 0x94, 0x30,
-    0x24, 0x20, 0x1f, 0x22, 0x1d, 0x1d, 0x22, 0x22, 0x1d, 0x1f, 0x1f, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x22, 0x1f, 0x1f, 0x1f, 0x22, 0x1d, 0x1d, 0x1d,
-    0x1c, 0x22, 0x24, 0x2b, 0x94, 0x67, 0x23, 0x24, 0x25, 0x66, 0xcf, 0xb4,
-    0x59, 0x30, 0x1f, 0x1f, 0x1b, 0x19, 0x1b, 0x19, 0x19, 0x18, 0x18, 0x18,
-    0x19, 0x18, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x15, 0x15,
-    0x15, 0x17, 0x17, 0x15, 0x17, 0x16, 0x17, 0x15, 0x17, 0x15, 0x15, 0x15,
-    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x12, 0x12, 0x12, 0x11, 0x12, 0x12,
-    0x2c, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2b, 0x2c, 0x2a, 0x2b, 0x27, 0x27, 0x27,
-    0x2c, 0x27, 0x2c, 0x2d, 0x2b, 0x56, 0x68, 0x2a, 0x2b, 0x25, 0x25, 0x25,
-    0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2c, 0x2b, 0x2c,
-    0x27, 0x2c, 0x2b, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2a, 0x27, 0x33, 0x64, 0x71, 0x66, 0x2d, 0x2e, 0x2b, 0x2c, 0x2b, 0x2e,
-    0x2b, 0x2b, 0x2a, 0x2e, 0x2e, 0x2d, 0x2b, 0x2b, 0x33, 0x33, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2e, 0x2d, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2c, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x2b, 0x2b, 0x2e,
-    0x33, 0x33, 0x2e, 0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x2a, 0x2b, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x2b, 0x2d, 0x33, 0x2e, 0x2b, 0x2d, 0x2b, 0x2a, 0x2c, 0x2c,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x42, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x41, 0x43, 0x48, 0x49, 0x4b, 0x50, 0x57, 0x5a, 0x62, 0x6f,
-    0x84, 0xb7, 0xe4, 0xf0, 0xea, 0xd1, 0xa6, 0x80, 0x6f, 0x5e, 0x58, 0x54,
-    0x50, 0x4f, 0x4f, 0x48, 0x43, 0x41, 0x41, 0x3b, 0x39, 0x3e, 0x3e, 0x39,
-    0x37, 0x37, 0x37, 0x42, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x2f, 0x2e, 0x2b, 0x2c, 0x27, 0x2c, 0x2c, 0x27, 0x25, 0x24, 0x24, 0x27,
-    0x29, 0x2c, 0x35, 0x75, 0xca, 0xb6, 0x44, 0x2b, 0x25, 0x20, 0x1f, 0x1f,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1f, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1f, 0x22, 0x1d, 0x1c, 0x1c, 0x1c, 0x1c, 0x1d, 0x19, 0x1f, 0x25,
-    0x67, 0x9a, 0x2c, 0x21, 0x25, 0x3a, 0x98, 0xe1, 0xbc, 0x66, 0x2b, 0x24,
-    0x1c, 0x19, 0x18, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x15, 0x15, 0x17, 0x17, 0x15,
-    0x17, 0x17, 0x17, 0x18, 0x18, 0x18, 0x17, 0x16, 0x15, 0x15, 0x15, 0x15,
-    0x15, 0x15, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x2c, 0x2a, 0x2a, 0x2c,
-    0x2c, 0x2b, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2d, 0x2d, 0x2a,
-    0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x27, 0x27, 0x27, 0x2c, 0x25, 0x2b, 0x2b,
-    0x35, 0x63, 0x46, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2c, 0x27, 0x2a, 0x2a, 0x2c,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x2d, 0x27, 0x39,
-    0xa1, 0x89, 0x2e, 0x2b, 0x2b, 0x29, 0x2b, 0x2e, 0x2b, 0x2a, 0x2a, 0x2b,
-    0x33, 0x2e, 0x2d, 0x33, 0x2e, 0x33, 0x33, 0x30, 0x2e, 0x2e, 0x2e, 0x2b,
-    0x2b, 0x2d, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2a, 0x27, 0x2b, 0x2e, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x27, 0x27, 0x2a, 0x2e, 0x2e, 0x2e, 0x2d, 0x2b, 0x2a,
-    0x2b, 0x2a, 0x2c, 0x2a, 0x2b, 0x2e, 0x2b, 0x2a, 0x27, 0x2c, 0x2b, 0x2b,
-    0x33, 0x2e, 0x2e, 0x2e, 0x2b, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35,
-    0x35, 0x42, 0x36, 0x37, 0x36, 0x37, 0x37, 0x37, 0x39, 0x3b, 0x41, 0x48,
-    0x49, 0x49, 0x50, 0x57, 0x5a, 0x61, 0x6f, 0x77, 0x95, 0xc5, 0xe8, 0xf0,
-    0xe8, 0xba, 0x84, 0x77, 0x69, 0x5a, 0x57, 0x50, 0x4f, 0x4b, 0x49, 0x48,
-    0x41, 0x3b, 0x3b, 0x3b, 0x3e, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x42,
-    0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2b, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x2c, 0x29, 0x25, 0x25, 0x25, 0x27, 0x2c, 0x2e, 0x3b, 0xc9,
-    0xa8, 0x59, 0x30, 0x24, 0x1f, 0x20, 0x1f, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x22, 0x1f, 0x1d, 0x1d, 0x1d, 0x1c, 0x1d, 0x1d, 0x1f, 0x1d, 0x1c,
-    0x1c, 0x1c, 0x1b, 0x1b, 0x19, 0x1d, 0x1c, 0x24, 0x2e, 0xa4, 0x4a, 0x24,
-    0x23, 0x27, 0x41, 0x98, 0xdc, 0xc4, 0x59, 0x2f, 0x1f, 0x1d, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x17, 0x17, 0x15, 0x15, 0x17, 0x17, 0x15, 0x17, 0x17, 0x17, 0x18,
-    0x18, 0x17, 0x17, 0x17, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x12, 0x11,
-    0x12, 0x12, 0x12, 0x13, 0x2c, 0x2a, 0x2a, 0x2c, 0x27, 0x2b, 0x2c, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2a, 0x2b, 0x2b, 0x2a, 0x2a,
-    0x2a, 0x27, 0x27, 0x2c, 0x2b, 0x25, 0x2c, 0x27, 0x37, 0x63, 0x42, 0x29,
-    0x25, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2a, 0x2a, 0x2c, 0x2c, 0x2c, 0x2c, 0x25, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x27, 0x25, 0x2c, 0x33, 0x59, 0x94, 0x3b, 0x2b, 0x2b,
-    0x2e, 0x2a, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x33, 0x2d, 0x2e, 0x33,
-    0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x2e, 0x2b, 0x2e, 0x2b, 0x2d,
-    0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2a, 0x27,
-    0x27, 0x2a, 0x2b, 0x2e, 0x2d, 0x2b, 0x2b, 0x2c, 0x2b, 0x2a, 0x2a, 0x2b,
-    0x2d, 0x2f, 0x2d, 0x2a, 0x2c, 0x2a, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x33, 0x33, 0x2e, 0x2e, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x3a, 0x35, 0x42, 0x42, 0x36,
-    0x37, 0x37, 0x37, 0x39, 0x3b, 0x41, 0x41, 0x48, 0x4b, 0x4b, 0x51, 0x58,
-    0x5e, 0x69, 0x77, 0x88, 0xa9, 0xd7, 0xec, 0xef, 0xe3, 0xa9, 0x77, 0x62,
-    0x61, 0x5e, 0x57, 0x50, 0x4b, 0x49, 0x46, 0x41, 0x41, 0x3e, 0x3b, 0x39,
-    0x37, 0x36, 0x36, 0x42, 0x42, 0x30, 0x30, 0x35, 0x35, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x2e, 0x2b, 0x2c, 0x2b, 0x2a, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x25, 0x27, 0x2b, 0x30, 0x86, 0xb9, 0x41, 0x30, 0x2a, 0x23,
-    0x1f, 0x1f, 0x1f, 0x22, 0x22, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x22, 0x1d,
-    0x1d, 0x1b, 0x1c, 0x1c, 0x1d, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x19, 0x19,
-    0x1a, 0x1d, 0x1a, 0x1f, 0x27, 0x90, 0x75, 0x23, 0x1f, 0x20, 0x2b, 0x59,
-    0xa5, 0xe3, 0xc4, 0x59, 0x31, 0x25, 0x22, 0x1c, 0x1b, 0x19, 0x18, 0x18,
-    0x19, 0x18, 0x1a, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17,
-    0x15, 0x17, 0x15, 0x15, 0x17, 0x17, 0x17, 0x17, 0x16, 0x15, 0x15, 0x15,
-    0x16, 0x15, 0x15, 0x15, 0x15, 0x15, 0x12, 0x12, 0x11, 0x11, 0x12, 0x12,
-    0x27, 0x27, 0x2c, 0x2a, 0x2a, 0x2b, 0x2c, 0x2a, 0x2a, 0x2b, 0x2b, 0x2d,
-    0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2a, 0x27, 0x2e, 0x63, 0x42, 0x2b, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2b,
-    0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x27, 0x27, 0x25, 0x27, 0x2c, 0x27,
-    0x25, 0x27, 0x48, 0x71, 0x41, 0x2f, 0x2c, 0x2e, 0x30, 0x2d, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x2f, 0x33, 0x2e,
-    0x30, 0x30, 0x30, 0x2e, 0x2d, 0x2e, 0x2d, 0x2d, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x2a, 0x2b, 0x2a,
-    0x2b, 0x2b, 0x2a, 0x2a, 0x2c, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2d, 0x2b, 0x2b, 0x33, 0x2e, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2d,
-    0x2b, 0x2e, 0x30, 0x2f, 0x30, 0x2f, 0x30, 0x2f, 0x2f, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x37, 0x36, 0x35, 0x36, 0x37, 0x37, 0x3e,
-    0x3b, 0x4a, 0x43, 0x48, 0x4b, 0x50, 0x58, 0x5a, 0x5e, 0x74, 0x99, 0xb3,
-    0xd1, 0xe8, 0xef, 0xec, 0xd1, 0x99, 0x6f, 0x61, 0x5e, 0x5b, 0x57, 0x4f,
-    0x49, 0x48, 0x41, 0x3b, 0x3b, 0x3e, 0x39, 0x39, 0x36, 0x35, 0x35, 0x42,
-    0x42, 0x35, 0x35, 0x30, 0x30, 0x30, 0x30, 0x34, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2b, 0x2a, 0x2c, 0x27, 0x25, 0x25, 0x25, 0x25, 0x20, 0x2b,
-    0x2a, 0x3a, 0xbd, 0x75, 0x30, 0x2c, 0x25, 0x24, 0x1f, 0x1f, 0x22, 0x1d,
-    0x22, 0x22, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0x1d,
-    0x27, 0x90, 0x67, 0x1f, 0x1f, 0x1d, 0x23, 0x46, 0x6a, 0xa1, 0xe3, 0xa4,
-    0x3e, 0x2b, 0x21, 0x1d, 0x1c, 0x19, 0x19, 0x1c, 0x19, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x17, 0x18, 0x18, 0x17, 0x15, 0x15, 0x15, 0x16,
-    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x17, 0x17, 0x17, 0x17, 0x15,
-    0x15, 0x15, 0x12, 0x12, 0x0d, 0x11, 0x11, 0x12, 0x27, 0x2c, 0x2c, 0x2b,
-    0x2b, 0x2a, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x2d, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25,
-    0x2b, 0x64, 0x39, 0x2c, 0x27, 0x27, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x27, 0x27, 0x27, 0x2a,
-    0x27, 0x2a, 0x2c, 0x27, 0x23, 0x27, 0x27, 0x25, 0x27, 0x30, 0x6d, 0x52,
-    0x36, 0x30, 0x2a, 0x2b, 0x2e, 0x2e, 0x34, 0x2b, 0x2a, 0x2b, 0x2a, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x33, 0x2d, 0x2e, 0x2e, 0x33, 0x2e, 0x33, 0x30, 0x33,
-    0x33, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x27, 0x2b, 0x2d, 0x2b,
-    0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x2a, 0x2c, 0x27, 0x2c, 0x2a, 0x2a, 0x2c,
-    0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2d, 0x2b, 0x2b, 0x2b,
-    0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2d, 0x2b, 0x2a, 0x2b, 0x2b, 0x2a, 0x2b, 0x2d, 0x2b, 0x2e, 0x30, 0x2f,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x36, 0x37, 0x36, 0x35, 0x36, 0x37, 0x37, 0x3e, 0x3b, 0x41, 0x48, 0x48,
-    0x50, 0x51, 0x60, 0x85, 0xb7, 0xd1, 0xdc, 0xe6, 0xea, 0xee, 0xec, 0xe4,
-    0xba, 0x80, 0x62, 0x5a, 0x57, 0x51, 0x4f, 0x48, 0x48, 0x43, 0x41, 0x3e,
-    0x3e, 0x39, 0x39, 0x37, 0x36, 0x42, 0x42, 0x42, 0x42, 0x35, 0x30, 0x2e,
-    0x33, 0x33, 0x2e, 0x2d, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b,
-    0x2c, 0x2c, 0x27, 0x2c, 0x2a, 0x2c, 0x2e, 0x5f, 0x6b, 0x9f, 0xb9, 0x42,
-    0x2b, 0x25, 0x29, 0x24, 0x20, 0x1f, 0x1f, 0x1d, 0x1d, 0x1f, 0x22, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1c, 0x1c, 0x1c, 0x1b, 0x19, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x1c, 0x1f, 0x25, 0x83, 0x73, 0x1d,
-    0x1d, 0x1d, 0x20, 0x63, 0x3e, 0x66, 0xcf, 0xe2, 0xbd, 0x9e, 0x83, 0x35,
-    0x27, 0x1b, 0x17, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x16, 0x15, 0x15, 0x15, 0x15,
-    0x15, 0x15, 0x15, 0x15, 0x16, 0x16, 0x16, 0x15, 0x15, 0x12, 0x12, 0x11,
-    0x11, 0x11, 0x11, 0x12, 0x27, 0x2c, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x2a, 0x2b, 0x2e, 0x2e, 0x2b, 0x2d, 0x2b, 0x2b, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x25, 0x2b, 0x64, 0x3a, 0x27,
-    0x27, 0x2c, 0x25, 0x25, 0x27, 0x25, 0x27, 0x29, 0x27, 0x25, 0x25, 0x25,
-    0x27, 0x27, 0x27, 0x2a, 0x2c, 0x2c, 0x2c, 0x27, 0x25, 0x2a, 0x27, 0x25,
-    0x25, 0x27, 0x2a, 0x2c, 0x2d, 0x2e, 0x4f, 0x7c, 0x8c, 0x56, 0x2b, 0x2b,
-    0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2d, 0x2b, 0x2b, 0x2d, 0x2d, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b,
-    0x2d, 0x2d, 0x2b, 0x2b, 0x2c, 0x2b, 0x2e, 0x2e, 0x2e, 0x2d, 0x2b, 0x2c,
-    0x2a, 0x2b, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2c, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x2b, 0x2d, 0x2e, 0x2e, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x36, 0x37, 0x37, 0x37,
-    0x37, 0x39, 0x39, 0x3b, 0x41, 0x46, 0x49, 0x52, 0x57, 0x5b, 0x8d, 0xdf,
-    0xcb, 0xdd, 0xeb, 0xef, 0xeb, 0xe5, 0xd1, 0xb2, 0x8a, 0x6f, 0x69, 0x57,
-    0x50, 0x4f, 0x49, 0x48, 0x43, 0x46, 0x41, 0x3e, 0x37, 0x37, 0x37, 0x42,
-    0x35, 0x42, 0x42, 0x35, 0x30, 0x30, 0x30, 0x33, 0x30, 0x30, 0x33, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b,
-    0x2b, 0x37, 0xa4, 0xca, 0xa3, 0x70, 0x39, 0x2a, 0x2c, 0x23, 0x25, 0x1f,
-    0x1f, 0x1f, 0x22, 0x1d, 0x1d, 0x22, 0x1d, 0x1d, 0x1d, 0x1c, 0x1c, 0x1c,
-    0x1c, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x1b, 0x19, 0x1e, 0x20, 0x66, 0xac, 0x2c, 0x22, 0x1c, 0x1f, 0x68,
-    0x30, 0x30, 0x70, 0xa8, 0x9e, 0xca, 0xe0, 0xbc, 0x5f, 0x27, 0x1e, 0x19,
-    0x18, 0x18, 0x18, 0x18, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x17, 0x17, 0x17, 0x16, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x16, 0x15,
-    0x15, 0x15, 0x15, 0x15, 0x12, 0x15, 0x13, 0x12, 0x12, 0x12, 0x12, 0x12,
-    0x2c, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2d, 0x2b, 0x2a, 0x2a, 0x2b,
-    0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27,
-    0x25, 0x27, 0x27, 0x27, 0x2a, 0x64, 0x30, 0x2c, 0x25, 0x2a, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x27, 0x27, 0x2c, 0x3b,
-    0x40, 0x2e, 0x2c, 0x2a, 0x2b, 0x2b, 0x2c, 0x25, 0x2a, 0x2e, 0x2f, 0x27,
-    0x2b, 0x2b, 0x79, 0x7f, 0x96, 0x70, 0x2b, 0x2b, 0x2b, 0x2c, 0x29, 0x2b,
-    0x2b, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2d, 0x2e,
-    0x2d, 0x2b, 0x2d, 0x2e, 0x33, 0x2d, 0x2d, 0x2d, 0x2e, 0x2e, 0x33, 0x2b,
-    0x2c, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x2a, 0x2c,
-    0x27, 0x2c, 0x27, 0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2d, 0x33, 0x33, 0x2e, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2d, 0x2e, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2d,
-    0x2e, 0x2e, 0x33, 0x33, 0x30, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x35, 0x35, 0x35, 0x36, 0x39, 0x37, 0x37, 0x37, 0x3e, 0x3b, 0x3b,
-    0x41, 0x48, 0x4b, 0x51, 0x5d, 0x6c, 0xc4, 0xd6, 0xcd, 0xe8, 0xee, 0xe9,
-    0xd3, 0xb8, 0xa0, 0x7c, 0x6e, 0x61, 0x5a, 0x51, 0x4f, 0x4b, 0x48, 0x46,
-    0x46, 0x41, 0x41, 0x39, 0x37, 0x37, 0x36, 0x35, 0x30, 0x35, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2b, 0x2b, 0x2c,
-    0x27, 0x2c, 0x2c, 0x2c, 0x2c, 0x27, 0x2a, 0x2a, 0x2e, 0x66, 0xd7, 0x86,
-    0x3b, 0x30, 0x24, 0x23, 0x25, 0x24, 0x24, 0x22, 0x1f, 0x22, 0x22, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1c, 0x1c, 0x1c, 0x1b, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0x1a, 0x1c,
-    0x21, 0x66, 0xa8, 0x39, 0x1f, 0x19, 0x1c, 0x45, 0x64, 0x23, 0x25, 0x30,
-    0x37, 0x70, 0xca, 0xe5, 0xac, 0x42, 0x1c, 0x18, 0x19, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x16,
-    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
-    0x15, 0x15, 0x15, 0x12, 0x12, 0x12, 0x12, 0x11, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x2e, 0x64, 0x30, 0x25, 0x25, 0x2a, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x2b, 0x51, 0x6d, 0x48, 0x41, 0x3d,
-    0x39, 0x37, 0x35, 0x30, 0x41, 0x53, 0x58, 0x39, 0x2d, 0x2d, 0x68, 0x68,
-    0x41, 0x42, 0x2e, 0x2e, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2b, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x2d, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x2e, 0x2b, 0x2a, 0x2b, 0x2b,
-    0x2e, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b,
-    0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2e, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2d, 0x2d, 0x2e, 0x2e, 0x33, 0x33,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x30, 0x30, 0x35, 0x35, 0x36,
-    0x37, 0x39, 0x37, 0x37, 0x37, 0x3b, 0x41, 0x41, 0x46, 0x4b, 0x50, 0x57,
-    0x74, 0xb3, 0xd9, 0xb9, 0xe3, 0xef, 0xed, 0xda, 0xb3, 0x95, 0x80, 0x62,
-    0x5e, 0x5a, 0x58, 0x51, 0x49, 0x49, 0x48, 0x41, 0x41, 0x41, 0x3b, 0x37,
-    0x37, 0x37, 0x36, 0x35, 0x30, 0x30, 0x30, 0x33, 0x30, 0x30, 0x30, 0x33,
-    0x2f, 0x30, 0x33, 0x2e, 0x2b, 0x2a, 0x2c, 0x2c, 0x27, 0x2c, 0x2a, 0x2c,
-    0x27, 0x27, 0x27, 0x27, 0x2b, 0x66, 0xd7, 0x70, 0x2a, 0x28, 0x20, 0x24,
-    0x24, 0x22, 0x1f, 0x1e, 0x1f, 0x22, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1c, 0x1c, 0x1c, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x1b, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x1b, 0x19, 0x19, 0x1d, 0x2e, 0x7b, 0x4a, 0x46,
-    0x30, 0x1d, 0x19, 0x20, 0x52, 0x3a, 0x21, 0x1f, 0x25, 0x37, 0x8f, 0xe6,
-    0xc9, 0x44, 0x20, 0x1b, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x15, 0x15, 0x15,
-    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x16, 0x16, 0x16, 0x16, 0x15, 0x15,
-    0x12, 0x11, 0x12, 0x11, 0x2a, 0x2a, 0x2a, 0x2b, 0x2a, 0x2c, 0x2a, 0x2c,
-    0x27, 0x2b, 0x2b, 0x2a, 0x2c, 0x2a, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x27, 0x27, 0x27, 0x25, 0x25, 0x25, 0x29, 0x2c, 0x33, 0x63, 0x3a, 0x2c,
-    0x25, 0x2c, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x2a, 0x37, 0x48, 0x49, 0x51, 0x51, 0x4b, 0x4f, 0x63, 0x53,
-    0x53, 0x64, 0x53, 0x63, 0x64, 0x49, 0x6d, 0x46, 0x2c, 0x2d, 0x2c, 0x2d,
-    0x2d, 0x2b, 0x2a, 0x27, 0x2c, 0x2b, 0x2c, 0x2c, 0x2b, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x33, 0x2e, 0x33, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e,
-    0x33, 0x33, 0x33, 0x33, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c,
-    0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2a, 0x2c, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x2b,
-    0x2b, 0x2b, 0x2a, 0x2a, 0x2c, 0x2c, 0x2a, 0x2b, 0x2c, 0x27, 0x2c, 0x2b,
-    0x2e, 0x2b, 0x2b, 0x2d, 0x2e, 0x2e, 0x33, 0x2e, 0x33, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x35, 0x30, 0x30, 0x42, 0x42, 0x42, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3e, 0x41, 0x41, 0x48, 0x4b, 0x51, 0xa1, 0xd1, 0xd1, 0xaf, 0xb6,
-    0xe6, 0xf0, 0xec, 0xd1, 0xa9, 0x84, 0x6f, 0x62, 0x5a, 0x57, 0x57, 0x50,
-    0x48, 0x48, 0x43, 0x41, 0x3b, 0x39, 0x39, 0x39, 0x37, 0x37, 0x42, 0x35,
-    0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b,
-    0x2b, 0x2b, 0x2c, 0x27, 0x27, 0x2a, 0x27, 0x27, 0x25, 0x25, 0x27, 0x27,
-    0x2c, 0x66, 0xd1, 0x75, 0x2a, 0x24, 0x24, 0x20, 0x1f, 0x22, 0x1f, 0x22,
-    0x1f, 0x22, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c,
-    0x1d, 0x1c, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x18, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x18, 0x19, 0x24, 0x70, 0x70, 0x1f, 0x2b, 0x52, 0x2e, 0x1d, 0x18,
-    0x30, 0x49, 0x53, 0x59, 0x46, 0x59, 0xc0, 0xd5, 0xd1, 0x75, 0x24, 0x1a,
-    0x1b, 0x19, 0x18, 0x18, 0x17, 0x17, 0x18, 0x18, 0x17, 0x16, 0x16, 0x15,
-    0x17, 0x16, 0x17, 0x17, 0x17, 0x17, 0x15, 0x15, 0x15, 0x16, 0x15, 0x15,
-    0x15, 0x15, 0x16, 0x16, 0x17, 0x15, 0x15, 0x12, 0x12, 0x0d, 0x11, 0x11,
-    0x2c, 0x2c, 0x27, 0x2a, 0x2a, 0x2a, 0x2b, 0x27, 0x27, 0x2b, 0x2a, 0x2c,
-    0x2a, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x29, 0x2c, 0x41, 0x63, 0x42, 0x29, 0x25, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2b,
-    0x37, 0x37, 0x30, 0x2e, 0x2e, 0x2b, 0x37, 0x44, 0x35, 0x2b, 0x2e, 0x40,
-    0x41, 0x46, 0x44, 0x30, 0x29, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2a, 0x2c,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x33,
-    0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2e, 0x2e,
-    0x2b, 0x2a, 0x2b, 0x2b, 0x2a, 0x2a, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2c,
-    0x2a, 0x2b, 0x2b, 0x2a, 0x2b, 0x2a, 0x27, 0x2c, 0x2b, 0x2e, 0x2b, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x2c, 0x2b, 0x2b, 0x27, 0x27, 0x27, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2d, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35,
-    0x36, 0x39, 0x37, 0x37, 0x39, 0x37, 0x37, 0x39, 0x3d, 0x3b, 0x46, 0x48,
-    0x4b, 0x4b, 0x98, 0xc9, 0x94, 0x80, 0x80, 0xb2, 0xe2, 0xed, 0xed, 0xe4,
-    0xba, 0x8b, 0x6f, 0x69, 0x5a, 0x57, 0x50, 0x4b, 0x48, 0x43, 0x41, 0x41,
-    0x3b, 0x39, 0x39, 0x39, 0x39, 0x37, 0x35, 0x3a, 0x30, 0x30, 0x30, 0x33,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x27,
-    0x2a, 0x2b, 0x2a, 0x27, 0x25, 0x25, 0x27, 0x27, 0x27, 0x3b, 0xbd, 0xac,
-    0x30, 0x27, 0x26, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x22, 0x1d, 0x1d,
-    0x1c, 0x1b, 0x1d, 0x1c, 0x1b, 0x1d, 0x1c, 0x1c, 0x1d, 0x1c, 0x19, 0x18,
-    0x18, 0x1a, 0x18, 0x18, 0x19, 0x1b, 0x19, 0x19, 0x18, 0x1a, 0x1b, 0x33,
-    0x94, 0x3f, 0x1e, 0x1f, 0x46, 0x39, 0x1b, 0x1a, 0x20, 0x23, 0x3a, 0x64,
-    0x51, 0x8d, 0xe1, 0x81, 0xa4, 0xb4, 0x33, 0x19, 0x1a, 0x18, 0x16, 0x18,
-    0x17, 0x18, 0x18, 0x18, 0x17, 0x16, 0x15, 0x15, 0x15, 0x15, 0x16, 0x16,
-    0x17, 0x17, 0x17, 0x17, 0x15, 0x15, 0x12, 0x12, 0x13, 0x15, 0x15, 0x15,
-    0x15, 0x15, 0x12, 0x11, 0x12, 0x12, 0x11, 0x11, 0x27, 0x27, 0x27, 0x2c,
-    0x2a, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x2a, 0x2a,
-    0x2b, 0x2a, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x2c, 0x2b, 0x2e, 0x48,
-    0x5d, 0x41, 0x2e, 0x25, 0x25, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x30, 0x3d, 0x30, 0x27,
-    0x2b, 0x2a, 0x25, 0x25, 0x2b, 0x2b, 0x26, 0x29, 0x29, 0x2c, 0x2c, 0x2c,
-    0x29, 0x2a, 0x2a, 0x2b, 0x2d, 0x2b, 0x2b, 0x2c, 0x2b, 0x33, 0x33, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2e, 0x33, 0x2d, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x27, 0x27, 0x2c, 0x2b, 0x2a, 0x2c,
-    0x2b, 0x2a, 0x2c, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2d, 0x2a, 0x2c, 0x2b, 0x2b, 0x2c, 0x2a, 0x2c, 0x27, 0x27, 0x2c, 0x2a,
-    0x27, 0x27, 0x27, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x2b, 0x2d, 0x2e, 0x2f,
-    0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x42, 0x42, 0x37, 0x39, 0x39, 0x39,
-    0x3b, 0x39, 0x37, 0x39, 0x39, 0x41, 0x48, 0x48, 0x4b, 0x7d, 0xd7, 0x98,
-    0x5e, 0x62, 0x76, 0x99, 0xca, 0xe6, 0xee, 0xec, 0xd7, 0x9d, 0x77, 0x61,
-    0x5a, 0x58, 0x51, 0x4b, 0x48, 0x43, 0x41, 0x41, 0x3b, 0x3b, 0x39, 0x37,
-    0x42, 0x35, 0x35, 0x30, 0x30, 0x30, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x33,
-    0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2a, 0x27, 0x25, 0x27, 0x27, 0x27, 0x25,
-    0x24, 0x24, 0x23, 0x25, 0x2b, 0x36, 0x8f, 0xbd, 0x3b, 0x27, 0x25, 0x20,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1d, 0x1b, 0x1b, 0x1d, 0x1d,
-    0x1c, 0x1c, 0x1c, 0x1b, 0x1c, 0x1b, 0x19, 0x18, 0x18, 0x1a, 0x19, 0x19,
-    0x19, 0x1c, 0x19, 0x19, 0x19, 0x1a, 0x19, 0x41, 0x70, 0x1f, 0x1b, 0x1b,
-    0x2e, 0x45, 0x25, 0x1d, 0x19, 0x19, 0x1b, 0x20, 0x27, 0x66, 0xd1, 0xa4,
-    0x6a, 0xba, 0x67, 0x2b, 0x1c, 0x17, 0x18, 0x18, 0x18, 0x19, 0x18, 0x18,
-    0x17, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x16, 0x17, 0x17,
-    0x16, 0x15, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x12, 0x12,
-    0x12, 0x12, 0x15, 0x13, 0x27, 0x2c, 0x27, 0x2a, 0x2a, 0x2a, 0x2b, 0x2a,
-    0x2a, 0x2b, 0x2b, 0x2c, 0x2b, 0x2a, 0x2a, 0x2c, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x29, 0x2b, 0x3b, 0x51, 0x63, 0x39, 0x2a, 0x25, 0x25,
-    0x27, 0x27, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x27, 0x25, 0x2b, 0x30, 0x33, 0x2c, 0x27, 0x27, 0x2c, 0x29,
-    0x27, 0x27, 0x2c, 0x2c, 0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x27, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x2e,
-    0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x33, 0x33, 0x2d, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2d, 0x2e, 0x33, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2a,
-    0x2b, 0x2a, 0x27, 0x27, 0x2c, 0x2b, 0x2c, 0x2c, 0x2b, 0x2a, 0x2c, 0x2b,
-    0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2b, 0x2a,
-    0x2b, 0x27, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2e, 0x33, 0x2e, 0x2e, 0x33, 0x30, 0x30,
-    0x30, 0x30, 0x35, 0x35, 0x36, 0x39, 0x37, 0x37, 0x37, 0x39, 0x39, 0x39,
-    0x41, 0x4f, 0x6b, 0x72, 0x8f, 0xd1, 0xb4, 0x57, 0x5d, 0x5e, 0x6f, 0x77,
-    0xa6, 0xda, 0xec, 0xee, 0xe5, 0xb6, 0x7c, 0x62, 0x5e, 0x58, 0x51, 0x4b,
-    0x48, 0x43, 0x4a, 0x41, 0x41, 0x3b, 0x39, 0x42, 0x35, 0x35, 0x35, 0x35,
-    0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2d, 0x2a, 0x27,
-    0x27, 0x2b, 0x27, 0x27, 0x2a, 0x27, 0x27, 0x25, 0x24, 0x1f, 0x20, 0x25,
-    0x2e, 0x3b, 0x7e, 0xdf, 0x81, 0x2c, 0x20, 0x20, 0x1f, 0x22, 0x1d, 0x1d,
-    0x1f, 0x1f, 0x1f, 0x1d, 0x1b, 0x1c, 0x1d, 0x1d, 0x1b, 0x1b, 0x1b, 0x18,
-    0x19, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x19, 0x19,
-    0x1b, 0x1b, 0x2b, 0x63, 0x38, 0x19, 0x19, 0x19, 0x1c, 0x38, 0x46, 0x33,
-    0x1d, 0x18, 0x1a, 0x1a, 0x19, 0x2b, 0x81, 0xd1, 0xb6, 0xa3, 0xb8, 0xa4,
-    0x2f, 0x1d, 0x1b, 0x1b, 0x16, 0x15, 0x18, 0x18, 0x17, 0x16, 0x15, 0x15,
-    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x17, 0x17, 0x16, 0x15, 0x15, 0x12,
-    0x12, 0x12, 0x12, 0x11, 0x12, 0x11, 0x11, 0x12, 0x15, 0x15, 0x15, 0x15,
-    0x2c, 0x2c, 0x2c, 0x2a, 0x2a, 0x2a, 0x2d, 0x2b, 0x2b, 0x2a, 0x2a, 0x2c,
-    0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x2c, 0x2a, 0x2a, 0x2c, 0x25, 0x27, 0x2b,
-    0x48, 0x63, 0x43, 0x30, 0x27, 0x25, 0x23, 0x27, 0x27, 0x27, 0x25, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2b, 0x2b, 0x27, 0x25, 0x27, 0x27, 0x25, 0x27, 0x2c, 0x27,
-    0x27, 0x2b, 0x2d, 0x2c, 0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x27,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x2d,
-    0x2e, 0x30, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x33,
-    0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2a, 0x2c,
-    0x2b, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x27, 0x2c, 0x2a,
-    0x2a, 0x27, 0x27, 0x27, 0x27, 0x2b, 0x2a, 0x27, 0x2c, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x33, 0x33, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x36, 0x36, 0x39, 0x38, 0x39, 0x41, 0x3b, 0x6a, 0xb6, 0xbe, 0xaf,
-    0xb1, 0xc6, 0x6a, 0x57, 0x57, 0x5a, 0x61, 0x77, 0x9b, 0xc8, 0xe9, 0xef,
-    0xe7, 0xbf, 0x80, 0x62, 0x5a, 0x57, 0x50, 0x49, 0x48, 0x43, 0x41, 0x41,
-    0x41, 0x3e, 0x39, 0x42, 0x35, 0x35, 0x35, 0x3a, 0x30, 0x30, 0x2f, 0x2e,
-    0x2e, 0x2d, 0x2d, 0x33, 0x2e, 0x2b, 0x2a, 0x2c, 0x2c, 0x2b, 0x2c, 0x2c,
-    0x2a, 0x27, 0x25, 0x23, 0x24, 0x1f, 0x20, 0x2a, 0x3d, 0x72, 0xc9, 0xda,
-    0x81, 0x2f, 0x20, 0x20, 0x1f, 0x22, 0x1d, 0x1d, 0x1c, 0x1d, 0x1d, 0x1d,
-    0x1c, 0x1c, 0x1c, 0x1c, 0x19, 0x1b, 0x19, 0x18, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x1a, 0x2c, 0x71, 0x59,
-    0x1f, 0x19, 0x19, 0x18, 0x1c, 0x19, 0x2b, 0x45, 0x42, 0x1b, 0x1c, 0x19,
-    0x19, 0x1f, 0x2e, 0x75, 0xdd, 0x9f, 0x72, 0xc8, 0x75, 0x27, 0x1d, 0x1b,
-    0x1a, 0x18, 0x18, 0x18, 0x17, 0x16, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
-    0x15, 0x15, 0x17, 0x17, 0x17, 0x15, 0x15, 0x12, 0x12, 0x12, 0x12, 0x11,
-    0x12, 0x0d, 0x0d, 0x12, 0x13, 0x12, 0x12, 0x12, 0x27, 0x2c, 0x2c, 0x2a,
-    0x2a, 0x2a, 0x2b, 0x2a, 0x2c, 0x2a, 0x2c, 0x27, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x2b, 0x2b, 0x2c, 0x2c, 0x25, 0x27, 0x2b, 0x3b, 0x63, 0x3e, 0x2a, 0x29,
-    0x27, 0x25, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x2c, 0x27, 0x25, 0x27, 0x2a,
-    0x27, 0x29, 0x27, 0x27, 0x2c, 0x2a, 0x27, 0x27, 0x2c, 0x2b, 0x2b, 0x2a,
-    0x2c, 0x27, 0x2c, 0x2b, 0x2a, 0x2c, 0x2c, 0x2a, 0x2b, 0x2d, 0x2a, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x33, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x2b,
-    0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x33, 0x30, 0x2e, 0x2e, 0x2e,
-    0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b,
-    0x2b, 0x2b, 0x2a, 0x2b, 0x2e, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x27, 0x2c, 0x2b, 0x2b, 0x2c, 0x27, 0x27,
-    0x27, 0x2b, 0x2b, 0x2c, 0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x36, 0x36, 0x36,
-    0x39, 0x3d, 0x43, 0x70, 0xc9, 0x98, 0x4f, 0x51, 0x68, 0xa6, 0x50, 0x50,
-    0x57, 0x58, 0x5e, 0x62, 0x88, 0xbe, 0xe7, 0xf0, 0xe7, 0xbe, 0x80, 0x62,
-    0x5a, 0x57, 0x4f, 0x48, 0x43, 0x41, 0x41, 0x41, 0x3b, 0x3e, 0x37, 0x42,
-    0x35, 0x42, 0x35, 0x35, 0x30, 0x30, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e,
-    0x2b, 0x2b, 0x2a, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x24, 0x24,
-    0x23, 0x21, 0x24, 0x2e, 0x48, 0x7a, 0xda, 0xac, 0x41, 0x2c, 0x24, 0x20,
-    0x1f, 0x1d, 0x1c, 0x1b, 0x1b, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1b, 0x1b,
-    0x19, 0x1b, 0x19, 0x18, 0x18, 0x19, 0x19, 0x18, 0x19, 0x19, 0x19, 0x19,
-    0x18, 0x18, 0x18, 0x19, 0x1f, 0x40, 0x64, 0x1f, 0x18, 0x19, 0x18, 0x18,
-    0x18, 0x19, 0x19, 0x25, 0x71, 0x29, 0x19, 0x1a, 0x19, 0x1b, 0x21, 0x30,
-    0xc9, 0xb1, 0x41, 0x70, 0xb1, 0x4d, 0x1c, 0x19, 0x1b, 0x19, 0x18, 0x18,
-    0x17, 0x15, 0x15, 0x15, 0x12, 0x15, 0x15, 0x15, 0x15, 0x17, 0x17, 0x17,
-    0x16, 0x16, 0x15, 0x15, 0x13, 0x13, 0x12, 0x11, 0x12, 0x11, 0x0d, 0x12,
-    0x12, 0x11, 0x11, 0x12, 0x27, 0x2a, 0x2a, 0x2a, 0x2c, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x2b, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x27,
-    0x25, 0x2c, 0x3b, 0x51, 0x56, 0x2b, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x27, 0x2c, 0x2c, 0x2c, 0x2a, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x25, 0x25, 0x25, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x2c,
-    0x2a, 0x2a, 0x2c, 0x2b, 0x2e, 0x2d, 0x2a, 0x2b, 0x2b, 0x2c, 0x2c, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2e, 0x2f, 0x30, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2a, 0x2b,
-    0x2b, 0x2c, 0x27, 0x2a, 0x2b, 0x2a, 0x2a, 0x2c, 0x27, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2d, 0x2d, 0x2e, 0x2e, 0x30, 0x30,
-    0x30, 0x35, 0x35, 0x33, 0x35, 0x39, 0x37, 0x37, 0x3e, 0x48, 0x72, 0xc6,
-    0x81, 0x4b, 0x48, 0x48, 0x4f, 0xa3, 0x51, 0x51, 0x51, 0x57, 0x5e, 0x61,
-    0x80, 0xb3, 0xe5, 0xef, 0xe8, 0xc3, 0x80, 0x61, 0x5a, 0x54, 0x4f, 0x49,
-    0x43, 0x41, 0x41, 0x3b, 0x3b, 0x39, 0x37, 0x36, 0x35, 0x35, 0x42, 0x35,
-    0x35, 0x30, 0x33, 0x2e, 0x2e, 0x2b, 0x2b, 0x2e, 0x2b, 0x2a, 0x2c, 0x2a,
-    0x2c, 0x2c, 0x25, 0x24, 0x23, 0x24, 0x24, 0x24, 0x24, 0x20, 0x24, 0x2e,
-    0x39, 0x48, 0xa4, 0xb9, 0x3e, 0x2c, 0x23, 0x1f, 0x20, 0x1f, 0x1b, 0x1d,
-    0x1c, 0x1b, 0x1b, 0x1c, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x1b, 0x19,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x19, 0x19, 0x19, 0x17, 0x19, 0x19, 0x19,
-    0x27, 0x63, 0x30, 0x1c, 0x17, 0x18, 0x19, 0x19, 0x18, 0x18, 0x1b, 0x20,
-    0x63, 0x23, 0x19, 0x1b, 0x19, 0x19, 0x21, 0x35, 0xd1, 0x9e, 0x30, 0x2c,
-    0x9e, 0x90, 0x1f, 0x1b, 0x19, 0x19, 0x18, 0x18, 0x17, 0x17, 0x16, 0x15,
-    0x15, 0x15, 0x15, 0x16, 0x15, 0x16, 0x17, 0x17, 0x16, 0x16, 0x15, 0x15,
-    0x15, 0x12, 0x12, 0x12, 0x12, 0x11, 0x11, 0x12, 0x15, 0x12, 0x11, 0x11,
-    0x27, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c,
-    0x2c, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2c, 0x2c, 0x2b, 0x3b, 0x51, 0x41,
-    0x2e, 0x2b, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x2b, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a,
-    0x2d, 0x2b, 0x2c, 0x2b, 0x2b, 0x27, 0x2a, 0x2a, 0x2b, 0x2e, 0x2e, 0x2e,
-    0x33, 0x33, 0x2e, 0x2e, 0x34, 0x2b, 0x2d, 0x2b, 0x33, 0x30, 0x30, 0x2e,
-    0x2e, 0x2e, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b,
-    0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x27, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2c, 0x27, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x27, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x3a, 0x3a,
-    0x35, 0x37, 0x37, 0x37, 0x3b, 0x48, 0xba, 0x8f, 0x49, 0x46, 0x41, 0x43,
-    0x48, 0xa5, 0x54, 0x4f, 0x51, 0x58, 0x5e, 0x62, 0x7c, 0xaf, 0xe4, 0xf0,
-    0xea, 0xc2, 0x84, 0x6f, 0x5a, 0x54, 0x4f, 0x4b, 0x43, 0x41, 0x3b, 0x3b,
-    0x39, 0x37, 0x37, 0x42, 0x35, 0x42, 0x35, 0x35, 0x35, 0x30, 0x30, 0x2e,
-    0x2e, 0x2d, 0x2b, 0x2e, 0x2b, 0x2c, 0x2c, 0x2b, 0x2b, 0x2c, 0x25, 0x23,
-    0x23, 0x24, 0x24, 0x23, 0x24, 0x24, 0x24, 0x23, 0x27, 0x30, 0x66, 0xbe,
-    0xb9, 0x75, 0x30, 0x24, 0x20, 0x21, 0x1d, 0x1f, 0x1f, 0x1d, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x1b, 0x19, 0x18, 0x19, 0x19, 0x18,
-    0x18, 0x19, 0x18, 0x1b, 0x18, 0x19, 0x1b, 0x1d, 0x59, 0x59, 0x1f, 0x1d,
-    0x17, 0x18, 0x19, 0x19, 0x18, 0x18, 0x19, 0x21, 0x46, 0x1f, 0x1b, 0x19,
-    0x19, 0x1a, 0x1f, 0x42, 0xd7, 0xac, 0x35, 0x23, 0x73, 0xc9, 0x42, 0x1b,
-    0x1b, 0x18, 0x19, 0x18, 0x18, 0x18, 0x17, 0x16, 0x15, 0x16, 0x16, 0x16,
-    0x15, 0x15, 0x16, 0x16, 0x16, 0x16, 0x15, 0x15, 0x15, 0x12, 0x12, 0x12,
-    0x12, 0x12, 0x12, 0x15, 0x15, 0x11, 0x11, 0x11, 0x27, 0x2a, 0x2b, 0x2c,
-    0x2c, 0x2c, 0x2c, 0x2b, 0x2b, 0x2a, 0x2a, 0x2c, 0x27, 0x2c, 0x2b, 0x2e,
-    0x30, 0x33, 0x2b, 0x2a, 0x37, 0x54, 0x3b, 0x2c, 0x2a, 0x27, 0x25, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x27, 0x2c, 0x27,
-    0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27,
-    0x27, 0x2c, 0x2c, 0x2c, 0x2b, 0x2a, 0x2a, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x2e, 0x2b, 0x2b, 0x2e, 0x2d, 0x2e, 0x33, 0x2f, 0x30, 0x30, 0x2f, 0x2f,
-    0x34, 0x2e, 0x2b, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2b, 0x2b,
-    0x2a, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2a, 0x2c, 0x2c, 0x2c,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x2c, 0x2c, 0x2b, 0x2b, 0x2c, 0x27, 0x2a, 0x2b, 0x2a, 0x2a, 0x2b,
-    0x27, 0x2b, 0x2e, 0x2e, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x35, 0x35, 0x3a, 0x37, 0x39, 0x41,
-    0x48, 0x70, 0xc6, 0x66, 0x41, 0x41, 0x41, 0x46, 0x4b, 0xa3, 0x54, 0x4b,
-    0x51, 0x57, 0x5e, 0x62, 0x7c, 0xab, 0xe3, 0xef, 0xea, 0xc8, 0x88, 0x6f,
-    0x5a, 0x54, 0x4f, 0x4b, 0x43, 0x41, 0x41, 0x3b, 0x39, 0x37, 0x37, 0x35,
-    0x35, 0x35, 0x35, 0x35, 0x35, 0x30, 0x30, 0x2e, 0x2e, 0x33, 0x2b, 0x2b,
-    0x2a, 0x27, 0x27, 0x2c, 0x2a, 0x2c, 0x25, 0x23, 0x23, 0x23, 0x24, 0x27,
-    0x23, 0x24, 0x20, 0x20, 0x24, 0x2c, 0x2e, 0x66, 0xad, 0xcd, 0x86, 0x2e,
-    0x24, 0x20, 0x1f, 0x1f, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19,
-    0x19, 0x1b, 0x1b, 0x19, 0x18, 0x19, 0x19, 0x18, 0x18, 0x19, 0x17, 0x1b,
-    0x1b, 0x1b, 0x1c, 0x2b, 0x71, 0x42, 0x19, 0x19, 0x1b, 0x1b, 0x18, 0x18,
-    0x18, 0x17, 0x18, 0x1b, 0x2e, 0x25, 0x1d, 0x1b, 0x19, 0x18, 0x1d, 0x2b,
-    0x98, 0xd1, 0x67, 0x2b, 0x4c, 0xd1, 0x5f, 0x1b, 0x18, 0x18, 0x19, 0x19,
-    0x18, 0x18, 0x17, 0x16, 0x15, 0x16, 0x17, 0x16, 0x15, 0x15, 0x16, 0x16,
-    0x15, 0x15, 0x15, 0x12, 0x12, 0x12, 0x12, 0x11, 0x12, 0x15, 0x12, 0x15,
-    0x15, 0x13, 0x12, 0x12, 0x27, 0x2a, 0x2b, 0x2c, 0x27, 0x2a, 0x2c, 0x2a,
-    0x2c, 0x2a, 0x2c, 0x27, 0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x2d,
-    0x4f, 0x4b, 0x2b, 0x2a, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x2c, 0x2b, 0x2a, 0x2a,
-    0x2c, 0x2a, 0x2a, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x33, 0x2e, 0x33, 0x2e,
-    0x2e, 0x33, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x2e, 0x2d, 0x33, 0x2e, 0x33,
-    0x2d, 0x2d, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x27, 0x27, 0x2c, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x2c, 0x2a, 0x2a, 0x2a, 0x2b, 0x2a,
-    0x2b, 0x2b, 0x2c, 0x2a, 0x2b, 0x2a, 0x2a, 0x2c, 0x2c, 0x2c, 0x2c, 0x2b,
-    0x2b, 0x2c, 0x27, 0x2a, 0x2b, 0x2a, 0x2c, 0x2b, 0x27, 0x2b, 0x2e, 0x2e,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2e, 0x33, 0x33, 0x2e, 0x2e, 0x30,
-    0x33, 0x30, 0x35, 0x42, 0x37, 0x39, 0x41, 0x59, 0x81, 0xbd, 0x9f, 0x48,
-    0x3d, 0x41, 0x3b, 0x46, 0x4f, 0xa3, 0x6a, 0x4b, 0x51, 0x57, 0x5e, 0x62,
-    0x7c, 0xa9, 0xdc, 0xee, 0xec, 0xca, 0x8e, 0x6f, 0x5e, 0x57, 0x50, 0x4b,
-    0x48, 0x46, 0x41, 0x3b, 0x3e, 0x39, 0x37, 0x35, 0x35, 0x35, 0x35, 0x30,
-    0x35, 0x30, 0x2f, 0x2e, 0x2e, 0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x25, 0x24, 0x23, 0x24, 0x20, 0x24, 0x20, 0x20, 0x20, 0x20,
-    0x24, 0x24, 0x23, 0x2b, 0x3b, 0xc0, 0xb4, 0x35, 0x21, 0x20, 0x21, 0x1f,
-    0x1d, 0x1c, 0x1b, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0x19, 0x1b, 0x1b, 0x19,
-    0x18, 0x19, 0x19, 0x18, 0x18, 0x19, 0x19, 0x1b, 0x19, 0x19, 0x1f, 0x52,
-    0x4f, 0x18, 0x17, 0x18, 0x18, 0x18, 0x18, 0x18, 0x19, 0x18, 0x18, 0x18,
-    0x22, 0x2b, 0x27, 0x1d, 0x19, 0x19, 0x1c, 0x25, 0x66, 0xd1, 0x81, 0x2b,
-    0x55, 0xca, 0x5f, 0x1c, 0x19, 0x18, 0x19, 0x18, 0x18, 0x18, 0x17, 0x15,
-    0x15, 0x16, 0x16, 0x16, 0x15, 0x15, 0x15, 0x16, 0x15, 0x15, 0x12, 0x12,
-    0x12, 0x12, 0x11, 0x11, 0x12, 0x15, 0x13, 0x12, 0x12, 0x12, 0x12, 0x12,
-    0x27, 0x2a, 0x2a, 0x2c, 0x2c, 0x2a, 0x2c, 0x2a, 0x2a, 0x2a, 0x2a, 0x2c,
-    0x2b, 0x2a, 0x2c, 0x2c, 0x2c, 0x2c, 0x2a, 0x59, 0x63, 0x30, 0x2a, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x27, 0x2c, 0x2a, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2b, 0x2a, 0x2a, 0x2c, 0x2a, 0x2a, 0x2e,
-    0x30, 0x2e, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x33, 0x30, 0x2e, 0x2e, 0x2e,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2e, 0x30, 0x2e, 0x2e, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x2a, 0x2c, 0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2d, 0x2b, 0x27, 0x2a,
-    0x2b, 0x2b, 0x2a, 0x27, 0x27, 0x27, 0x27, 0x2b, 0x2b, 0x2c, 0x27, 0x2b,
-    0x2b, 0x2a, 0x2c, 0x2a, 0x27, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38,
-    0x3e, 0x4a, 0x70, 0xc0, 0xc9, 0xa5, 0x4b, 0x41, 0x41, 0x3e, 0x45, 0x46,
-    0x48, 0x89, 0x85, 0x4f, 0x51, 0x57, 0x5e, 0x62, 0x7c, 0xa7, 0xda, 0xee,
-    0xed, 0xd1, 0x8e, 0x6f, 0x5e, 0x58, 0x50, 0x4f, 0x48, 0x43, 0x41, 0x3b,
-    0x3b, 0x39, 0x37, 0x36, 0x42, 0x35, 0x35, 0x35, 0x35, 0x30, 0x2e, 0x2e,
-    0x2b, 0x2b, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x27, 0x24,
-    0x23, 0x24, 0x20, 0x1f, 0x1f, 0x20, 0x24, 0x24, 0x23, 0x25, 0x24, 0x24,
-    0x30, 0xb4, 0xb4, 0x35, 0x21, 0x1f, 0x1f, 0x1f, 0x1d, 0x1c, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1c, 0x1b, 0x19, 0x1b, 0x1b, 0x19, 0x18, 0x19, 0x19, 0x18,
-    0x18, 0x19, 0x1b, 0x19, 0x18, 0x19, 0x20, 0x63, 0x36, 0x19, 0x19, 0x16,
-    0x17, 0x17, 0x18, 0x18, 0x19, 0x18, 0x18, 0x18, 0x19, 0x2c, 0x3a, 0x20,
-    0x19, 0x1b, 0x1c, 0x25, 0x4a, 0xd1, 0xac, 0x30, 0x30, 0xb6, 0x90, 0x23,
-    0x1c, 0x19, 0x18, 0x19, 0x19, 0x18, 0x17, 0x17, 0x15, 0x16, 0x16, 0x16,
-    0x16, 0x15, 0x15, 0x15, 0x15, 0x15, 0x12, 0x15, 0x15, 0x12, 0x11, 0x12,
-    0x12, 0x15, 0x12, 0x11, 0x12, 0x11, 0x12, 0x12, 0x2c, 0x2b, 0x2d, 0x2c,
-    0x2c, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2a, 0x2a,
-    0x2b, 0x30, 0x49, 0x6d, 0x3b, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x2a, 0x2b, 0x27, 0x27, 0x27, 0x2c, 0x2c,
-    0x2c, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x33, 0x2d, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x33, 0x2f, 0x2e, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2c, 0x2c, 0x2b, 0x2b, 0x2a, 0x27,
-    0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2a, 0x2c, 0x2b, 0x2b, 0x2b, 0x2c, 0x2b,
-    0x2c, 0x2a, 0x2c, 0x27, 0x2a, 0x2b, 0x2d, 0x2b, 0x2b, 0x2d, 0x2d, 0x2b,
-    0x33, 0x30, 0x30, 0x30, 0x35, 0x3a, 0x38, 0x3b, 0x66, 0xa5, 0xc6, 0xa4,
-    0x4f, 0x43, 0x41, 0x3b, 0x39, 0x3b, 0x41, 0x46, 0x48, 0x6a, 0x97, 0x50,
-    0x51, 0x57, 0x5e, 0x62, 0x7c, 0xa7, 0xdc, 0xef, 0xed, 0xcd, 0x8a, 0x6f,
-    0x5e, 0x5d, 0x51, 0x4f, 0x49, 0x43, 0x41, 0x41, 0x3b, 0x3b, 0x3e, 0x37,
-    0x37, 0x37, 0x36, 0x35, 0x30, 0x30, 0x2f, 0x2e, 0x2e, 0x2b, 0x2b, 0x2c,
-    0x2c, 0x2a, 0x2a, 0x2c, 0x2c, 0x2a, 0x27, 0x23, 0x23, 0x24, 0x20, 0x20,
-    0x24, 0x20, 0x20, 0x20, 0x20, 0x1f, 0x1e, 0x28, 0x2f, 0x70, 0xbc, 0x42,
-    0x21, 0x20, 0x22, 0x1f, 0x1d, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x1c, 0x1c,
-    0x19, 0x19, 0x1b, 0x18, 0x18, 0x19, 0x18, 0x18, 0x18, 0x19, 0x19, 0x18,
-    0x18, 0x1b, 0x1c, 0x41, 0x53, 0x24, 0x18, 0x18, 0x17, 0x15, 0x16, 0x18,
-    0x19, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x45, 0x24, 0x19, 0x19, 0x1c, 0x2e,
-    0xa1, 0xe3, 0xbc, 0x41, 0x2c, 0x75, 0xc6, 0x5c, 0x1c, 0x17, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x15,
-    0x16, 0x15, 0x15, 0x16, 0x16, 0x15, 0x12, 0x12, 0x12, 0x11, 0x11, 0x0d,
-    0x0d, 0x0d, 0x12, 0x12, 0x27, 0x2a, 0x2b, 0x27, 0x27, 0x2c, 0x2b, 0x2a,
-    0x2b, 0x2b, 0x2a, 0x25, 0x2c, 0x2b, 0x2b, 0x2e, 0x35, 0x64, 0x53, 0x3b,
-    0x2b, 0x2b, 0x2c, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x25, 0x25, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x2a, 0x2c, 0x2c, 0x2c,
-    0x2c, 0x2b, 0x2a, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x2f, 0x30, 0x33, 0x2d, 0x2d, 0x2b, 0x2e, 0x2e, 0x2f,
-    0x30, 0x2e, 0x2e, 0x2b, 0x2b, 0x2d, 0x2d, 0x2e, 0x2e, 0x2e, 0x2d, 0x2e,
-    0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x2e,
-    0x2e, 0x2b, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x27, 0x2b,
-    0x2d, 0x2b, 0x2a, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x27,
-    0x2c, 0x2b, 0x2e, 0x2a, 0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x30, 0x30, 0x42,
-    0x3b, 0x41, 0x59, 0xa4, 0xc6, 0xa8, 0x6b, 0x43, 0x41, 0x3b, 0x3b, 0x39,
-    0x3b, 0x3b, 0x41, 0x46, 0x48, 0x68, 0x96, 0x51, 0x4f, 0x58, 0x5e, 0x62,
-    0x77, 0xa9, 0xe3, 0xef, 0xed, 0xcb, 0x93, 0x77, 0x69, 0x58, 0x57, 0x4f,
-    0x49, 0x43, 0x41, 0x41, 0x3b, 0x3b, 0x3b, 0x39, 0x37, 0x37, 0x42, 0x30,
-    0x30, 0x30, 0x30, 0x2f, 0x33, 0x2e, 0x2e, 0x2a, 0x2c, 0x2c, 0x2c, 0x2c,
-    0x2a, 0x27, 0x25, 0x23, 0x24, 0x20, 0x20, 0x24, 0x23, 0x23, 0x20, 0x1f,
-    0x22, 0x1f, 0x1f, 0x2a, 0x2f, 0x86, 0xc0, 0x42, 0x20, 0x22, 0x22, 0x1f,
-    0x1f, 0x22, 0x1c, 0x19, 0x1c, 0x1b, 0x19, 0x1b, 0x1b, 0x1c, 0x1b, 0x19,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x19, 0x1b, 0x18, 0x19, 0x1b, 0x1a, 0x24,
-    0x5d, 0x41, 0x1a, 0x17, 0x17, 0x16, 0x15, 0x17, 0x18, 0x17, 0x17, 0x17,
-    0x18, 0x19, 0x3d, 0x27, 0x18, 0x19, 0x1e, 0x2f, 0xa1, 0xdc, 0xc4, 0x48,
-    0x25, 0x2e, 0xb1, 0x90, 0x1f, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17,
-    0x15, 0x15, 0x16, 0x16, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x17,
-    0x17, 0x15, 0x12, 0x11, 0x11, 0x11, 0x0d, 0x0d, 0x11, 0x12, 0x12, 0x11,
-    0x27, 0x2a, 0x2a, 0x27, 0x27, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x25,
-    0x2c, 0x42, 0x46, 0x46, 0x63, 0x58, 0x37, 0x2b, 0x2c, 0x2c, 0x2c, 0x2c,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x27, 0x2a, 0x2a, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2a, 0x2e,
-    0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2d, 0x33,
-    0x2e, 0x2e, 0x2d, 0x2d, 0x2b, 0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x33, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2a, 0x2a,
-    0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e,
-    0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2e,
-    0x2e, 0x2b, 0x2d, 0x31, 0x30, 0x37, 0x3b, 0x6b, 0x89, 0x9a, 0xc8, 0xb6,
-    0x79, 0x48, 0x41, 0x3d, 0x3b, 0x3e, 0x39, 0x3e, 0x3b, 0x3b, 0x41, 0x46,
-    0x48, 0x68, 0x9a, 0x50, 0x53, 0x57, 0x5a, 0x62, 0x76, 0xa6, 0xe1, 0xed,
-    0xef, 0xdd, 0xa6, 0x7c, 0x62, 0x60, 0x58, 0x4f, 0x49, 0x48, 0x41, 0x41,
-    0x3b, 0x3e, 0x3b, 0x39, 0x37, 0x42, 0x3a, 0x30, 0x30, 0x30, 0x30, 0x2f,
-    0x33, 0x2e, 0x2e, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x24,
-    0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x20, 0x1f, 0x1d, 0x1f, 0x21, 0x35,
-    0x48, 0xc3, 0x9e, 0x30, 0x22, 0x1e, 0x1f, 0x24, 0x1f, 0x1d, 0x1d, 0x1d,
-    0x22, 0x1b, 0x1b, 0x1b, 0x1b, 0x1c, 0x1c, 0x1b, 0x19, 0x19, 0x18, 0x18,
-    0x18, 0x19, 0x19, 0x18, 0x1a, 0x19, 0x19, 0x1f, 0x49, 0x59, 0x19, 0x18,
-    0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x16, 0x18, 0x2c, 0x31,
-    0x1c, 0x1b, 0x18, 0x1f, 0x39, 0x70, 0xd1, 0xa4, 0x2e, 0x25, 0x75, 0xb9,
-    0x3c, 0x1d, 0x19, 0x18, 0x18, 0x18, 0x18, 0x17, 0x15, 0x17, 0x18, 0x17,
-    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x17, 0x16, 0x15, 0x12, 0x12,
-    0x12, 0x11, 0x0d, 0x11, 0x12, 0x12, 0x12, 0x0d, 0x27, 0x2a, 0x2a, 0x2c,
-    0x27, 0x2c, 0x27, 0x2c, 0x2c, 0x2b, 0x2b, 0x2e, 0x46, 0x59, 0x46, 0x3b,
-    0x41, 0x30, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x2c, 0x2a, 0x2c, 0x2a, 0x2b, 0x2b, 0x2c, 0x2e, 0x2b, 0x2b, 0x2b, 0x2d,
-    0x2b, 0x2b, 0x2b, 0x33, 0x2e, 0x2b, 0x2d, 0x33, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2a, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2c, 0x2c, 0x2a, 0x2b, 0x2a, 0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x2c,
-    0x2b, 0x2a, 0x2a, 0x2b, 0x2e, 0x2e, 0x2d, 0x2e, 0x2b, 0x2e, 0x30, 0x30,
-    0x30, 0x41, 0x81, 0xc6, 0x9e, 0x8f, 0x7d, 0x41, 0x37, 0x39, 0x3a, 0x37,
-    0x37, 0x37, 0x39, 0x3b, 0x3b, 0x3b, 0x41, 0x46, 0x48, 0x4f, 0x92, 0x68,
-    0x51, 0x57, 0x5a, 0x5e, 0x77, 0x93, 0xd1, 0xeb, 0xf0, 0xe7, 0xc3, 0x88,
-    0x62, 0x5e, 0x5b, 0x52, 0x49, 0x48, 0x41, 0x3b, 0x3b, 0x3e, 0x3e, 0x39,
-    0x37, 0x42, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2b,
-    0x2a, 0x27, 0x25, 0x25, 0x25, 0x23, 0x28, 0x24, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x1f, 0x1f, 0x26, 0x2a, 0x56, 0xb9, 0xb1, 0x41, 0x27,
-    0x22, 0x1f, 0x1f, 0x20, 0x1f, 0x1d, 0x1d, 0x1f, 0x19, 0x18, 0x1b, 0x19,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x18, 0x18, 0x19, 0x19, 0x19,
-    0x1b, 0x18, 0x18, 0x24, 0x53, 0x40, 0x19, 0x1a, 0x18, 0x18, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x16, 0x12, 0x18, 0x1a, 0x2b, 0x42, 0x1e, 0x1a, 0x1d,
-    0x1f, 0x2e, 0x8f, 0xd3, 0x5f, 0x20, 0x3a, 0xb6, 0x67, 0x19, 0x19, 0x18,
-    0x18, 0x18, 0x17, 0x18, 0x18, 0x18, 0x18, 0x18, 0x15, 0x15, 0x15, 0x15,
-    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x12, 0x12, 0x13, 0x11, 0x0d, 0x11,
-    0x12, 0x11, 0x0d, 0x0d, 0x27, 0x2a, 0x2a, 0x2c, 0x2c, 0x2a, 0x2c, 0x29,
-    0x2b, 0x2a, 0x2c, 0x37, 0x51, 0x39, 0x2b, 0x2d, 0x2b, 0x2b, 0x2c, 0x27,
-    0x2c, 0x27, 0x27, 0x23, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2a, 0x2a, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x2c, 0x27, 0x27,
-    0x2b, 0x2a, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2d, 0x2d, 0x2b, 0x2e, 0x30,
-    0x2f, 0x2d, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2b, 0x2b, 0x2d, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2c, 0x27, 0x2c,
-    0x2b, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x25, 0x2c, 0x2b, 0x2b, 0x2b, 0x2e,
-    0x2e, 0x2f, 0x30, 0x30, 0x30, 0x35, 0x39, 0x48, 0x70, 0xb6, 0xc6, 0x83,
-    0x41, 0x3e, 0x37, 0x39, 0x36, 0x30, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39,
-    0x3d, 0x39, 0x41, 0x41, 0x43, 0x49, 0x68, 0x8d, 0x58, 0x57, 0x5e, 0x5e,
-    0x6f, 0x88, 0xba, 0xe7, 0xef, 0xec, 0xda, 0xa2, 0x6f, 0x61, 0x5a, 0x51,
-    0x4b, 0x48, 0x43, 0x41, 0x3b, 0x3e, 0x39, 0x37, 0x37, 0x36, 0x42, 0x30,
-    0x30, 0x30, 0x30, 0x2f, 0x2e, 0x2d, 0x2b, 0x2a, 0x2a, 0x27, 0x25, 0x25,
-    0x23, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1f,
-    0x1f, 0x25, 0x42, 0xad, 0xac, 0x3b, 0x36, 0x27, 0x1f, 0x1f, 0x1c, 0x1c,
-    0x22, 0x2c, 0x46, 0x46, 0x38, 0x23, 0x1d, 0x19, 0x19, 0x19, 0x1b, 0x1c,
-    0x1b, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x19, 0x18, 0x17, 0x27,
-    0x74, 0x37, 0x1b, 0x18, 0x17, 0x19, 0x18, 0x18, 0x17, 0x17, 0x16, 0x16,
-    0x16, 0x17, 0x18, 0x25, 0x52, 0x1d, 0x18, 0x1a, 0x1a, 0x1f, 0x66, 0xdd,
-    0x86, 0x24, 0x27, 0x9e, 0x83, 0x1f, 0x19, 0x18, 0x18, 0x17, 0x17, 0x17,
-    0x18, 0x18, 0x18, 0x18, 0x17, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
-    0x15, 0x12, 0x15, 0x15, 0x15, 0x11, 0x0d, 0x11, 0x12, 0x11, 0x0d, 0x0d,
-    0x27, 0x2a, 0x2a, 0x2a, 0x2c, 0x2a, 0x2c, 0x2b, 0x30, 0x2b, 0x2e, 0x46,
-    0x46, 0x30, 0x2b, 0x29, 0x27, 0x2c, 0x2b, 0x2b, 0x2a, 0x27, 0x27, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2b, 0x2a, 0x2c, 0x27,
-    0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2d, 0x2b, 0x2d, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a,
-    0x2c, 0x2c, 0x2c, 0x2c, 0x2b, 0x2c, 0x27, 0x2c, 0x2b, 0x2c, 0x27, 0x27,
-    0x27, 0x25, 0x27, 0x2b, 0x2c, 0x2a, 0x2b, 0x2b, 0x2e, 0x2e, 0x33, 0x2d,
-    0x42, 0x39, 0x3b, 0x64, 0xaf, 0xa5, 0x59, 0x3e, 0x37, 0x30, 0x30, 0x30,
-    0x35, 0x30, 0x30, 0x37, 0x36, 0x37, 0x37, 0x37, 0x39, 0x3e, 0x3b, 0x41,
-    0x41, 0x4b, 0x4b, 0x7b, 0x85, 0x57, 0x5a, 0x62, 0x62, 0x80, 0xa6, 0xdd,
-    0xed, 0xee, 0xe6, 0xbd, 0x80, 0x69, 0x5e, 0x54, 0x50, 0x49, 0x48, 0x4a,
-    0x3b, 0x3b, 0x3b, 0x3e, 0x37, 0x37, 0x36, 0x35, 0x30, 0x30, 0x30, 0x33,
-    0x2e, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2c, 0x25, 0x25, 0x23, 0x23, 0x24,
-    0x20, 0x24, 0x20, 0x1f, 0x1f, 0x20, 0x20, 0x20, 0x20, 0x24, 0x42, 0xb6,
-    0x86, 0x30, 0x2b, 0x25, 0x24, 0x1f, 0x1e, 0x24, 0x33, 0x46, 0x4e, 0x35,
-    0x3a, 0x2c, 0x1d, 0x1b, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0x1b, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x17, 0x20, 0x6b, 0x6b, 0x1f, 0x15,
-    0x18, 0x18, 0x18, 0x18, 0x17, 0x16, 0x16, 0x17, 0x18, 0x17, 0x18, 0x2d,
-    0x44, 0x1b, 0x19, 0x18, 0x18, 0x22, 0x30, 0xa4, 0xc3, 0x83, 0x3b, 0x86,
-    0xa1, 0x25, 0x1b, 0x19, 0x18, 0x17, 0x16, 0x18, 0x18, 0x18, 0x18, 0x17,
-    0x17, 0x17, 0x15, 0x15, 0x15, 0x15, 0x15, 0x12, 0x12, 0x13, 0x15, 0x15,
-    0x15, 0x11, 0x0d, 0x11, 0x11, 0x11, 0x0d, 0x0d, 0x25, 0x2a, 0x2a, 0x2a,
-    0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x39, 0x52, 0x48, 0x2e, 0x2b, 0x2b, 0x2c,
-    0x2b, 0x2c, 0x2b, 0x2b, 0x2a, 0x25, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x27, 0x27, 0x2c, 0x27, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x2c, 0x27, 0x27, 0x2b, 0x2b, 0x2c, 0x27, 0x2c, 0x2a, 0x2a, 0x2a,
-    0x2b, 0x2e, 0x2b, 0x2a, 0x2b, 0x2e, 0x2e, 0x2f, 0x2f, 0x2e, 0x2e, 0x2d,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2d, 0x2e,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2a, 0x27, 0x2c, 0x2c, 0x27, 0x2a, 0x2e,
-    0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x30, 0x30, 0x37, 0x41, 0x87, 0xbe,
-    0x94, 0x4a, 0x37, 0x42, 0x30, 0x3a, 0x35, 0x31, 0x30, 0x3a, 0x38, 0x35,
-    0x42, 0x37, 0x37, 0x37, 0x37, 0x39, 0x3b, 0x43, 0x46, 0x48, 0x48, 0x50,
-    0xa3, 0x71, 0x5a, 0x5e, 0x62, 0x77, 0x9b, 0xc8, 0xe8, 0xef, 0xeb, 0xdd,
-    0x95, 0x6f, 0x5e, 0x58, 0x51, 0x49, 0x49, 0x43, 0x41, 0x3b, 0x3b, 0x39,
-    0x37, 0x37, 0x37, 0x42, 0x30, 0x30, 0x30, 0x33, 0x2e, 0x2b, 0x2b, 0x2a,
-    0x2b, 0x2a, 0x2b, 0x2c, 0x27, 0x27, 0x25, 0x24, 0x20, 0x24, 0x20, 0x1f,
-    0x1f, 0x20, 0x20, 0x24, 0x24, 0x20, 0x2b, 0x87, 0xbd, 0x67, 0x2e, 0x27,
-    0x24, 0x24, 0x25, 0x35, 0x46, 0x30, 0x1f, 0x1c, 0x19, 0x1c, 0x1f, 0x1d,
-    0x1b, 0x19, 0x19, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x18,
-    0x18, 0x19, 0x19, 0x1b, 0x2a, 0x71, 0x3a, 0x19, 0x19, 0x18, 0x19, 0x18,
-    0x17, 0x15, 0x15, 0x16, 0x18, 0x17, 0x18, 0x2e, 0x24, 0x18, 0x17, 0x19,
-    0x1b, 0x1c, 0x1c, 0x30, 0x83, 0xd7, 0x8f, 0xa1, 0x98, 0x24, 0x1d, 0x19,
-    0x18, 0x18, 0x18, 0x17, 0x17, 0x15, 0x15, 0x15, 0x17, 0x16, 0x15, 0x15,
-    0x15, 0x15, 0x15, 0x11, 0x15, 0x15, 0x15, 0x15, 0x12, 0x11, 0x0d, 0x0d,
-    0x11, 0x0d, 0x0f, 0x0d, 0x2b, 0x2a, 0x2a, 0x2b, 0x2a, 0x2b, 0x2c, 0x2b,
-    0x3b, 0x51, 0x53, 0x37, 0x2b, 0x2b, 0x2c, 0x2c, 0x2c, 0x2c, 0x2b, 0x2a,
-    0x2a, 0x29, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x25, 0x25, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x25, 0x25, 0x25, 0x25, 0x25, 0x27, 0x25, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x27, 0x2c, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x2b, 0x2b, 0x2c, 0x27, 0x2c, 0x2a, 0x2c, 0x2a, 0x2b, 0x2b, 0x2a, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x33, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2a, 0x27, 0x27, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x2c, 0x25, 0x2a, 0x2b, 0x27, 0x2c, 0x2b, 0x2c, 0x2c, 0x2b, 0x2a,
-    0x2b, 0x2e, 0x36, 0x3b, 0x72, 0xb6, 0xab, 0x70, 0x3b, 0x36, 0x30, 0x30,
-    0x30, 0x30, 0x35, 0x35, 0x35, 0x42, 0x35, 0x35, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x39, 0x41, 0x43, 0x43, 0x48, 0x49, 0x50, 0x78, 0x92, 0x60, 0x5e,
-    0x62, 0x77, 0x9b, 0xcd, 0xe7, 0xf0, 0xef, 0xe1, 0xa2, 0x77, 0x62, 0x5d,
-    0x50, 0x49, 0x49, 0x43, 0x43, 0x41, 0x3e, 0x39, 0x37, 0x37, 0x36, 0x42,
-    0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2c, 0x2a, 0x2c, 0x2b, 0x2c,
-    0x27, 0x2c, 0x27, 0x28, 0x20, 0x20, 0x1f, 0x20, 0x20, 0x20, 0x1f, 0x20,
-    0x20, 0x21, 0x27, 0x41, 0xb1, 0xca, 0x48, 0x2b, 0x25, 0x2b, 0x36, 0x79,
-    0x3b, 0x1d, 0x19, 0x1b, 0x1b, 0x1b, 0x1d, 0x1c, 0x1b, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x18, 0x19, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1b,
-    0x1f, 0x6b, 0x66, 0x1e, 0x18, 0x18, 0x18, 0x17, 0x17, 0x15, 0x17, 0x18,
-    0x18, 0x17, 0x1c, 0x38, 0x1d, 0x18, 0x18, 0x19, 0x19, 0x18, 0x19, 0x1f,
-    0x30, 0xa1, 0xd7, 0xc8, 0x75, 0x24, 0x1c, 0x19, 0x18, 0x18, 0x19, 0x16,
-    0x16, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x12,
-    0x15, 0x15, 0x12, 0x12, 0x11, 0x11, 0x0d, 0x0d, 0x11, 0x0d, 0x0d, 0x0d,
-    0x2b, 0x2a, 0x2a, 0x2b, 0x2a, 0x2a, 0x2b, 0x30, 0x4e, 0x36, 0x35, 0x2b,
-    0x2b, 0x2a, 0x2a, 0x2a, 0x2c, 0x2c, 0x2b, 0x2c, 0x27, 0x25, 0x25, 0x25,
-    0x27, 0x27, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25,
-    0x23, 0x25, 0x23, 0x27, 0x27, 0x25, 0x25, 0x29, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x2c, 0x27, 0x2c,
-    0x2c, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2d, 0x2e, 0x2b, 0x27,
-    0x2b, 0x2b, 0x2a, 0x2b, 0x2e, 0x2b, 0x2a, 0x2b, 0x2b, 0x2e, 0x33, 0x30,
-    0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2d, 0x2e, 0x2b,
-    0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x27, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x2c, 0x27, 0x2c, 0x2b,
-    0x25, 0x27, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x35, 0x37, 0x66, 0x9e,
-    0xbe, 0x81, 0x41, 0x3a, 0x30, 0x30, 0x30, 0x2e, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x35, 0x42, 0x36, 0x37, 0x39, 0x37, 0x37, 0x37, 0x39, 0x41, 0x41,
-    0x43, 0x48, 0x48, 0x51, 0x49, 0x8a, 0x74, 0x5e, 0x6f, 0x7c, 0xa7, 0xdd,
-    0xed, 0xf0, 0xe8, 0xd0, 0x9b, 0x77, 0x5e, 0x5a, 0x54, 0x4f, 0x49, 0x48,
-    0x43, 0x41, 0x3e, 0x39, 0x37, 0x36, 0x36, 0x35, 0x30, 0x30, 0x30, 0x30,
-    0x2e, 0x2e, 0x2e, 0x2c, 0x2b, 0x2b, 0x2a, 0x27, 0x27, 0x2c, 0x25, 0x24,
-    0x20, 0x24, 0x1f, 0x1f, 0x20, 0x20, 0x1f, 0x1f, 0x20, 0x25, 0x2c, 0x66,
-    0xc3, 0x90, 0x51, 0x52, 0x30, 0x2d, 0x48, 0x71, 0x5f, 0x1f, 0x1b, 0x1c,
-    0x19, 0x18, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x27, 0x64, 0x59, 0x1a,
-    0x1c, 0x1b, 0x18, 0x17, 0x16, 0x17, 0x17, 0x18, 0x17, 0x17, 0x1f, 0x46,
-    0x1d, 0x18, 0x18, 0x18, 0x18, 0x19, 0x19, 0x1b, 0x1d, 0x3e, 0xd1, 0xde,
-    0xa5, 0x30, 0x1f, 0x1f, 0x1a, 0x19, 0x18, 0x17, 0x17, 0x16, 0x15, 0x15,
-    0x12, 0x12, 0x15, 0x15, 0x15, 0x15, 0x12, 0x11, 0x12, 0x12, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x0d, 0x11, 0x0d, 0x0d, 0x0d, 0x2a, 0x2a, 0x2a, 0x2a,
-    0x2c, 0x2a, 0x2b, 0x37, 0x46, 0x2f, 0x2b, 0x2c, 0x2b, 0x2b, 0x2a, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x27, 0x27, 0x25, 0x23, 0x23, 0x27, 0x27, 0x23, 0x23,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27,
-    0x27, 0x27, 0x2a, 0x2a, 0x2c, 0x2a, 0x2a, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
-    0x27, 0x2c, 0x27, 0x2a, 0x2e, 0x33, 0x2b, 0x2a, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x2e, 0x2b, 0x2a, 0x2b, 0x2b, 0x2e, 0x33, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2d, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c,
-    0x27, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x2c, 0x2a,
-    0x2b, 0x2a, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2b, 0x2c, 0x2c, 0x2a, 0x2e,
-    0x2b, 0x2b, 0x3a, 0x3b, 0x66, 0x9f, 0xb6, 0xac, 0x59, 0x37, 0x3a, 0x33,
-    0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2e, 0x30, 0x30, 0x30, 0x35, 0x36, 0x37,
-    0x37, 0x37, 0x37, 0x36, 0x37, 0x3e, 0x3b, 0x41, 0x43, 0x48, 0x48, 0x49,
-    0x4b, 0x71, 0x8c, 0x78, 0x76, 0x7c, 0xae, 0xe3, 0xf0, 0xef, 0xe3, 0xc1,
-    0x95, 0x77, 0x69, 0x5e, 0x57, 0x50, 0x4b, 0x48, 0x43, 0x41, 0x3b, 0x39,
-    0x37, 0x37, 0x42, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2c, 0x27, 0x24, 0x20, 0x20, 0x21, 0x20,
-    0x24, 0x20, 0x1f, 0x1f, 0x24, 0x1f, 0x30, 0x98, 0xb4, 0x30, 0x30, 0x6b,
-    0x63, 0x49, 0x51, 0x68, 0x66, 0x27, 0x1f, 0x1d, 0x19, 0x19, 0x1b, 0x19,
-    0x19, 0x19, 0x18, 0x18, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x19,
-    0x19, 0x19, 0x19, 0x1b, 0x46, 0x79, 0x23, 0x18, 0x1b, 0x19, 0x18, 0x18,
-    0x17, 0x17, 0x17, 0x18, 0x18, 0x18, 0x1c, 0x37, 0x2b, 0x19, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x19, 0x1c, 0x27, 0x83, 0xdd, 0xe1, 0x9e, 0x3f, 0x1f,
-    0x18, 0x1b, 0x17, 0x18, 0x16, 0x12, 0x12, 0x15, 0x13, 0x12, 0x12, 0x15,
-    0x15, 0x15, 0x12, 0x11, 0x11, 0x12, 0x11, 0x11, 0x0d, 0x11, 0x11, 0x0d,
-    0x11, 0x0d, 0x0d, 0x0d, 0x2a, 0x2a, 0x2c, 0x2c, 0x27, 0x2c, 0x25, 0x37,
-    0x63, 0x30, 0x2b, 0x2e, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b,
-    0x2a, 0x2c, 0x25, 0x25, 0x27, 0x27, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x25, 0x25, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2b, 0x2b,
-    0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2a, 0x2b, 0x2b, 0x2a, 0x2e, 0x2d, 0x2b, 0x2b, 0x2e, 0x2d, 0x2b, 0x2a,
-    0x2b, 0x2e, 0x30, 0x2f, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e,
-    0x2b, 0x2e, 0x2b, 0x2e, 0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2c, 0x2c, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x2c, 0x25, 0x2d, 0x2e, 0x33, 0x39, 0x48, 0x6b, 0x72, 0x87, 0xaf,
-    0xab, 0x89, 0x70, 0x3e, 0x35, 0x30, 0x30, 0x2b, 0x2e, 0x2d, 0x34, 0x2d,
-    0x2b, 0x2d, 0x30, 0x30, 0x30, 0x30, 0x42, 0x42, 0x37, 0x37, 0x37, 0x36,
-    0x37, 0x39, 0x3b, 0x41, 0x41, 0x43, 0x48, 0x49, 0x4f, 0x57, 0x6c, 0x84,
-    0xa3, 0x92, 0xaf, 0xe1, 0xee, 0xef, 0xe5, 0xc2, 0x9d, 0x77, 0x62, 0x5e,
-    0x58, 0x54, 0x50, 0x49, 0x48, 0x41, 0x3b, 0x3e, 0x37, 0x37, 0x36, 0x35,
-    0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x27, 0x27, 0x27, 0x23, 0x24, 0x20, 0x21, 0x24, 0x24, 0x24, 0x1f, 0x1f,
-    0x20, 0x1f, 0x30, 0xa5, 0x86, 0x2b, 0x20, 0x27, 0x30, 0x42, 0x2e, 0x2b,
-    0x2b, 0x1f, 0x1c, 0x1c, 0x19, 0x19, 0x1b, 0x19, 0x19, 0x19, 0x18, 0x18,
-    0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x19, 0x1b, 0x1b, 0x1b, 0x1b, 0x22,
-    0x52, 0x53, 0x22, 0x18, 0x18, 0x17, 0x19, 0x18, 0x18, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x18, 0x2d, 0x3a, 0x18, 0x17, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x1a, 0x1d, 0x3f, 0x83, 0xd7, 0xde, 0xb4, 0x30, 0x1c, 0x1b, 0x18, 0x15,
-    0x15, 0x11, 0x12, 0x15, 0x15, 0x15, 0x12, 0x12, 0x12, 0x11, 0x11, 0x11,
-    0x11, 0x12, 0x11, 0x0d, 0x0d, 0x0d, 0x0d, 0x11, 0x11, 0x0d, 0x0d, 0x0d,
-    0x2a, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x2c, 0x2a, 0x49, 0x3d, 0x27, 0x2c,
-    0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2b, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x23, 0x23, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x23,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2a, 0x2a, 0x2c, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2c, 0x2c,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2b, 0x2a, 0x2b, 0x2e, 0x30, 0x30,
-    0x2e, 0x2b, 0x2a, 0x2a, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2a, 0x2b, 0x2c, 0x27,
-    0x27, 0x2c, 0x2c, 0x2a, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2a, 0x27, 0x2b,
-    0x2e, 0x42, 0x70, 0xaf, 0xca, 0xba, 0xaf, 0x7d, 0x48, 0x3b, 0x3a, 0x33,
-    0x2b, 0x2c, 0x2d, 0x2b, 0x2e, 0x2e, 0x30, 0x2f, 0x2e, 0x33, 0x2e, 0x2e,
-    0x30, 0x30, 0x30, 0x35, 0x42, 0x37, 0x37, 0x36, 0x37, 0x39, 0x3e, 0x41,
-    0x41, 0x43, 0x48, 0x48, 0x4f, 0x51, 0x5b, 0x60, 0x88, 0xaa, 0xb7, 0xd9,
-    0xeb, 0xf0, 0xec, 0xdd, 0xb9, 0x88, 0x6f, 0x62, 0x60, 0x57, 0x50, 0x4b,
-    0x48, 0x43, 0x41, 0x3e, 0x3e, 0x39, 0x36, 0x42, 0x35, 0x35, 0x30, 0x2e,
-    0x2e, 0x2e, 0x33, 0x2e, 0x2b, 0x2b, 0x2c, 0x2a, 0x2c, 0x27, 0x27, 0x25,
-    0x23, 0x20, 0x1f, 0x20, 0x24, 0x24, 0x1f, 0x1f, 0x20, 0x23, 0x3f, 0xad,
-    0x73, 0x27, 0x25, 0x23, 0x1e, 0x1c, 0x1d, 0x1d, 0x1c, 0x19, 0x19, 0x1b,
-    0x19, 0x1b, 0x1b, 0x18, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18,
-    0x19, 0x19, 0x1b, 0x1b, 0x1b, 0x1c, 0x1d, 0x24, 0x3b, 0x3d, 0x3a, 0x1c,
-    0x17, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x15, 0x16, 0x18, 0x56,
-    0x2c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x19, 0x25, 0x5f,
-    0xbe, 0x87, 0xd1, 0x9f, 0x2b, 0x19, 0x1a, 0x18, 0x17, 0x12, 0x12, 0x15,
-    0x15, 0x13, 0x12, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x12, 0x11,
-    0x11, 0x0d, 0x11, 0x12, 0x11, 0x0d, 0x0d, 0x11, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x2b, 0x2b, 0x2f, 0x48, 0x37, 0x2b, 0x2c, 0x2a, 0x2a, 0x2a,
-    0x2a, 0x2a, 0x2b, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x23, 0x25,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x23,
-    0x23, 0x25, 0x25, 0x27, 0x27, 0x29, 0x27, 0x25, 0x25, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x27, 0x27, 0x2a, 0x2b, 0x2b, 0x27, 0x2c, 0x2b, 0x2b, 0x2b,
-    0x33, 0x2d, 0x2b, 0x2b, 0x2d, 0x2e, 0x30, 0x30, 0x2e, 0x2b, 0x2a, 0x2a,
-    0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b,
-    0x2b, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x2e, 0x30, 0x37, 0x83, 0xb6, 0x7d,
-    0x4a, 0x3b, 0x3b, 0x36, 0x30, 0x2d, 0x2e, 0x2d, 0x2e, 0x2c, 0x2e, 0x31,
-    0x2e, 0x2e, 0x30, 0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x30, 0x30, 0x30,
-    0x35, 0x37, 0x37, 0x36, 0x37, 0x39, 0x39, 0x41, 0x41, 0x4a, 0x43, 0x49,
-    0x4f, 0x50, 0x58, 0x5a, 0x69, 0x80, 0x93, 0xba, 0xe6, 0xef, 0xf0, 0xe9,
-    0xd7, 0xa3, 0x7c, 0x61, 0x5e, 0x58, 0x54, 0x4b, 0x48, 0x48, 0x41, 0x3b,
-    0x3b, 0x37, 0x37, 0x36, 0x42, 0x35, 0x30, 0x2f, 0x2e, 0x33, 0x2f, 0x2e,
-    0x2b, 0x2a, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x23, 0x20, 0x1f, 0x20,
-    0x24, 0x24, 0x20, 0x20, 0x23, 0x2a, 0x33, 0xb3, 0x73, 0x25, 0x1f, 0x21,
-    0x1f, 0x1b, 0x1d, 0x1d, 0x19, 0x18, 0x18, 0x1c, 0x1b, 0x19, 0x19, 0x18,
-    0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x19, 0x1b, 0x18, 0x18,
-    0x18, 0x19, 0x1b, 0x21, 0x21, 0x1f, 0x38, 0x2b, 0x18, 0x18, 0x19, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x17, 0x18, 0x19, 0x46, 0x2a, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x1c, 0x1d, 0x5c, 0xbe, 0x48, 0x75, 0xd1,
-    0x86, 0x1f, 0x1b, 0x18, 0x18, 0x15, 0x12, 0x15, 0x15, 0x15, 0x12, 0x11,
-    0x0d, 0x0d, 0x12, 0x0d, 0x11, 0x15, 0x13, 0x11, 0x11, 0x11, 0x12, 0x12,
-    0x11, 0x11, 0x0d, 0x0d, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2c,
-    0x2e, 0x33, 0x46, 0x49, 0x30, 0x25, 0x2b, 0x27, 0x27, 0x2b, 0x2b, 0x2a,
-    0x2c, 0x27, 0x25, 0x25, 0x27, 0x27, 0x25, 0x23, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x2b, 0x2d, 0x2a, 0x2a, 0x27, 0x2c, 0x2b, 0x2e, 0x2e, 0x2b, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2e,
-    0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x33, 0x2e, 0x2e,
-    0x2d, 0x2b, 0x2b, 0x2d, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b,
-    0x2b, 0x2a, 0x2e, 0x2b, 0x2e, 0x2b, 0x2a, 0x2a, 0x2c, 0x30, 0x30, 0x2b,
-    0x2a, 0x30, 0x30, 0x36, 0x72, 0xc6, 0x66, 0x39, 0x30, 0x30, 0x33, 0x2e,
-    0x2e, 0x2b, 0x27, 0x2c, 0x27, 0x2a, 0x2e, 0x30, 0x2b, 0x2b, 0x2e, 0x2e,
-    0x2e, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x42, 0x36, 0x36,
-    0x37, 0x39, 0x3e, 0x3b, 0x41, 0x41, 0x48, 0x49, 0x50, 0x54, 0x58, 0x5a,
-    0x61, 0x69, 0x77, 0x9b, 0xd3, 0xec, 0xee, 0xf0, 0xe8, 0xbe, 0x8a, 0x6f,
-    0x5e, 0x5b, 0x54, 0x4b, 0x49, 0x43, 0x41, 0x3b, 0x3e, 0x37, 0x36, 0x42,
-    0x35, 0x35, 0x30, 0x30, 0x33, 0x30, 0x30, 0x2d, 0x2b, 0x2b, 0x2a, 0x2a,
-    0x2a, 0x27, 0x27, 0x27, 0x27, 0x24, 0x24, 0x24, 0x23, 0x20, 0x1f, 0x1f,
-    0x23, 0x2b, 0x42, 0xbd, 0x73, 0x25, 0x1f, 0x22, 0x1d, 0x1d, 0x1c, 0x1b,
-    0x1b, 0x1b, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x19, 0x19, 0x1a, 0x18, 0x18, 0x1b, 0x1f, 0x1b,
-    0x19, 0x17, 0x1f, 0x39, 0x25, 0x17, 0x18, 0x18, 0x18, 0x17, 0x18, 0x17,
-    0x16, 0x18, 0x19, 0x3a, 0x33, 0x1f, 0x17, 0x18, 0x18, 0x15, 0x18, 0x17,
-    0x18, 0x18, 0x1b, 0x35, 0xc3, 0x75, 0x2e, 0xac, 0xcf, 0x34, 0x19, 0x19,
-    0x18, 0x1b, 0x17, 0x11, 0x15, 0x17, 0x15, 0x11, 0x11, 0x11, 0x12, 0x12,
-    0x12, 0x12, 0x12, 0x11, 0x0d, 0x11, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x27, 0x2c, 0x2a, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x2b, 0x2c, 0x30, 0x63,
-    0x46, 0x2c, 0x2a, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2a,
-    0x2c, 0x2a, 0x2c, 0x2a, 0x2b, 0x2b, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2e, 0x2e, 0x2b, 0x2b, 0x2a,
-    0x2b, 0x2a, 0x2b, 0x2b, 0x2e, 0x33, 0x33, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2d, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d,
-    0x2e, 0x29, 0x29, 0x2b, 0x31, 0x3e, 0x70, 0x89, 0x9a, 0x97, 0x89, 0x97,
-    0xbd, 0x94, 0x30, 0x2b, 0x2d, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x27, 0x27,
-    0x27, 0x2b, 0x2e, 0x30, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x33,
-    0x2e, 0x2e, 0x30, 0x30, 0x30, 0x42, 0x42, 0x42, 0x37, 0x39, 0x3e, 0x3b,
-    0x41, 0x43, 0x48, 0x48, 0x4b, 0x51, 0x57, 0x5a, 0x61, 0x62, 0x6f, 0x84,
-    0xc9, 0xe5, 0xe8, 0xef, 0xed, 0xd3, 0xa6, 0x77, 0x62, 0x5a, 0x57, 0x50,
-    0x49, 0x48, 0x4a, 0x41, 0x3e, 0x37, 0x37, 0x42, 0x35, 0x42, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x23, 0x1f, 0x21, 0x22, 0x1f, 0x27, 0x30, 0x5f, 0xad, 0xc0,
-    0x4c, 0x23, 0x22, 0x1d, 0x1d, 0x1d, 0x1c, 0x1c, 0x19, 0x18, 0x19, 0x19,
-    0x19, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x17,
-    0x18, 0x18, 0x19, 0x1d, 0x24, 0x2b, 0x21, 0x17, 0x18, 0x18, 0x1b, 0x27,
-    0x34, 0x18, 0x12, 0x17, 0x17, 0x18, 0x17, 0x18, 0x17, 0x17, 0x19, 0x2c,
-    0x20, 0x22, 0x1c, 0x19, 0x17, 0x15, 0x17, 0x18, 0x18, 0x18, 0x18, 0x20,
-    0x75, 0xb6, 0x56, 0x66, 0xd1, 0x90, 0x27, 0x16, 0x17, 0x13, 0x12, 0x16,
-    0x12, 0x17, 0x15, 0x12, 0x11, 0x15, 0x12, 0x11, 0x12, 0x12, 0x11, 0x11,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0d, 0x27, 0x2a, 0x2a, 0x2c,
-    0x27, 0x2c, 0x2c, 0x27, 0x2c, 0x2b, 0x2c, 0x50, 0x52, 0x2e, 0x2c, 0x2c,
-    0x2b, 0x2a, 0x2c, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x2c, 0x2c, 0x2c, 0x27, 0x2c, 0x27, 0x2a, 0x2b, 0x2b, 0x2a,
-    0x2a, 0x2b, 0x27, 0x2c, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2e, 0x2b,
-    0x2e, 0x33, 0x33, 0x2e, 0x2d, 0x2b, 0x2b, 0x2a, 0x2b, 0x2d, 0x2b, 0x2e,
-    0x2e, 0x2d, 0x2b, 0x2b, 0x2e, 0x33, 0x30, 0x2b, 0x2b, 0x2b, 0x2d, 0x30,
-    0x39, 0xa4, 0x9a, 0x6b, 0x6b, 0x7d, 0x94, 0x7b, 0x59, 0x3e, 0x2e, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x33, 0x33,
-    0x2e, 0x2e, 0x33, 0x33, 0x33, 0x2f, 0x30, 0x33, 0x2e, 0x33, 0x30, 0x30,
-    0x30, 0x35, 0x42, 0x36, 0x37, 0x39, 0x3e, 0x3b, 0x41, 0x43, 0x43, 0x48,
-    0x4b, 0x51, 0x54, 0x60, 0x5e, 0x69, 0x61, 0x80, 0xc9, 0xe1, 0xe5, 0xee,
-    0xf0, 0xe4, 0xb2, 0x77, 0x62, 0x5e, 0x58, 0x51, 0x4f, 0x49, 0x48, 0x46,
-    0x3b, 0x39, 0x37, 0x37, 0x42, 0x42, 0x42, 0x30, 0x30, 0x30, 0x30, 0x2e,
-    0x2d, 0x2b, 0x2b, 0x2b, 0x2a, 0x27, 0x27, 0x27, 0x25, 0x23, 0x23, 0x27,
-    0x25, 0x27, 0x2e, 0x37, 0x83, 0xbe, 0xaf, 0x66, 0x2b, 0x1c, 0x1d, 0x1b,
-    0x1c, 0x1d, 0x1d, 0x1c, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0x19, 0x1b, 0x1d,
-    0x1d, 0x1d, 0x1c, 0x1b, 0x1b, 0x19, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x29,
-    0x29, 0x21, 0x19, 0x18, 0x18, 0x17, 0x18, 0x19, 0x20, 0x20, 0x17, 0x17,
-    0x16, 0x16, 0x17, 0x18, 0x18, 0x15, 0x19, 0x20, 0x1b, 0x19, 0x1b, 0x1f,
-    0x1f, 0x17, 0x17, 0x17, 0x16, 0x18, 0x18, 0x19, 0x2e, 0xb1, 0x73, 0x2a,
-    0x83, 0xc9, 0x75, 0x1c, 0x1b, 0x17, 0x15, 0x16, 0x12, 0x16, 0x13, 0x12,
-    0x12, 0x15, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0d, 0x11,
-    0x0d, 0x0d, 0x0d, 0x11, 0x27, 0x2b, 0x2b, 0x2c, 0x27, 0x2a, 0x2c, 0x25,
-    0x2b, 0x2b, 0x30, 0x49, 0x37, 0x2d, 0x2b, 0x27, 0x2c, 0x2c, 0x2c, 0x27,
-    0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x29, 0x27,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x2a, 0x2a, 0x2a,
-    0x2a, 0x2c, 0x27, 0x27, 0x2a, 0x2d, 0x2e, 0x2b, 0x2c, 0x2a, 0x2c, 0x2c,
-    0x2b, 0x2e, 0x2b, 0x2e, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x2e, 0x2b, 0x2d, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x2e,
-    0x2b, 0x2d, 0x2b, 0x2a, 0x2b, 0x2b, 0x2e, 0x2e, 0x33, 0x2e, 0x2b, 0x2b,
-    0x2e, 0x30, 0x31, 0x2b, 0x2d, 0x33, 0x30, 0x39, 0x8d, 0xb6, 0x66, 0x3b,
-    0x36, 0x39, 0x3b, 0x42, 0x30, 0x2b, 0x25, 0x2c, 0x27, 0x27, 0x2b, 0x2a,
-    0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x33, 0x30, 0x30, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x35, 0x42, 0x36,
-    0x37, 0x39, 0x39, 0x3b, 0x41, 0x4a, 0x43, 0x48, 0x4b, 0x50, 0x54, 0x58,
-    0x5a, 0x5e, 0x7c, 0x88, 0xcf, 0xe2, 0xe6, 0xef, 0xee, 0xe2, 0xb0, 0x77,
-    0x69, 0x5e, 0x5a, 0x57, 0x51, 0x4b, 0x48, 0x48, 0x41, 0x3b, 0x39, 0x37,
-    0x42, 0x37, 0x36, 0x42, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x27, 0x27, 0x25, 0x27, 0x25, 0x25, 0x29, 0x2d, 0x30, 0x3b, 0x87,
-    0xc8, 0x7d, 0x42, 0x30, 0x22, 0x22, 0x1d, 0x1b, 0x1c, 0x1d, 0x1c, 0x1c,
-    0x1c, 0x1b, 0x19, 0x19, 0x1d, 0x22, 0x22, 0x1f, 0x1f, 0x1f, 0x1f, 0x22,
-    0x22, 0x22, 0x1d, 0x1b, 0x1b, 0x1c, 0x26, 0x1f, 0x1b, 0x17, 0x17, 0x19,
-    0x18, 0x17, 0x15, 0x17, 0x19, 0x25, 0x25, 0x19, 0x17, 0x16, 0x18, 0x17,
-    0x17, 0x17, 0x18, 0x1d, 0x22, 0x18, 0x18, 0x17, 0x34, 0x1f, 0x18, 0x18,
-    0x17, 0x18, 0x1b, 0x18, 0x42, 0xb9, 0x4c, 0x1f, 0x2b, 0xb4, 0xc9, 0x3b,
-    0x1f, 0x19, 0x16, 0x15, 0x12, 0x15, 0x12, 0x12, 0x12, 0x15, 0x11, 0x11,
-    0x0d, 0x0d, 0x11, 0x11, 0x12, 0x11, 0x0d, 0x11, 0x0d, 0x0d, 0x0d, 0x11,
-    0x2c, 0x2b, 0x2d, 0x2a, 0x2c, 0x2b, 0x2c, 0x27, 0x2b, 0x2a, 0x37, 0x39,
-    0x27, 0x2a, 0x2b, 0x27, 0x2a, 0x2c, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x27,
-    0x2c, 0x2c, 0x27, 0x27, 0x27, 0x25, 0x23, 0x23, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x27, 0x27, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2a, 0x2b, 0x2b, 0x2a, 0x27, 0x2a,
-    0x2b, 0x2d, 0x2b, 0x2b, 0x2c, 0x2b, 0x2c, 0x27, 0x2b, 0x2b, 0x2b, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x2b, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2e, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x2f, 0x2e, 0x2e, 0x2b, 0x2b, 0x33, 0x2f, 0x2e, 0x33,
-    0x30, 0x37, 0x66, 0x98, 0xa8, 0x66, 0x30, 0x30, 0x2b, 0x35, 0x2b, 0x2d,
-    0x2b, 0x2e, 0x2e, 0x25, 0x25, 0x27, 0x2a, 0x2a, 0x27, 0x2c, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2f, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x42, 0x42, 0x42, 0x37, 0x37, 0x3e, 0x3b,
-    0x41, 0x41, 0x43, 0x48, 0x4b, 0x50, 0x51, 0x57, 0x5a, 0x5e, 0x77, 0xaf,
-    0xdd, 0xdd, 0xeb, 0xf1, 0xea, 0xd1, 0xa6, 0x7c, 0x6e, 0x61, 0x5e, 0x58,
-    0x54, 0x4f, 0x48, 0x48, 0x41, 0x3b, 0x3d, 0x37, 0x37, 0x36, 0x36, 0x35,
-    0x30, 0x30, 0x2e, 0x33, 0x33, 0x2e, 0x2e, 0x2e, 0x2b, 0x2c, 0x2c, 0x2c,
-    0x2c, 0x2b, 0x2b, 0x30, 0x67, 0x9a, 0xaf, 0xba, 0x75, 0x30, 0x2b, 0x25,
-    0x1d, 0x1e, 0x1b, 0x1c, 0x1d, 0x1d, 0x1c, 0x1b, 0x1b, 0x19, 0x19, 0x1f,
-    0x29, 0x29, 0x21, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x22, 0x1f, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x19, 0x18, 0x17, 0x17, 0x18, 0x18, 0x17, 0x18, 0x12, 0x16,
-    0x18, 0x1c, 0x29, 0x29, 0x1b, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x1f,
-    0x1f, 0x17, 0x15, 0x15, 0x1c, 0x29, 0x21, 0x17, 0x18, 0x17, 0x17, 0x1a,
-    0x3e, 0xbe, 0x5c, 0x1b, 0x1f, 0x67, 0xb9, 0xc3, 0x73, 0x2c, 0x1f, 0x19,
-    0x16, 0x15, 0x13, 0x12, 0x12, 0x12, 0x11, 0x0d, 0x0d, 0x11, 0x11, 0x12,
-    0x11, 0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0f, 0x0d, 0x2c, 0x2b, 0x2e, 0x2b,
-    0x27, 0x2b, 0x2a, 0x2e, 0x2c, 0x2c, 0x35, 0x30, 0x2c, 0x27, 0x2c, 0x2b,
-    0x2f, 0x2a, 0x2a, 0x2a, 0x27, 0x27, 0x27, 0x27, 0x2b, 0x27, 0x27, 0x27,
-    0x27, 0x23, 0x24, 0x23, 0x23, 0x25, 0x25, 0x27, 0x27, 0x27, 0x25, 0x23,
-    0x23, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x25, 0x27, 0x25,
-    0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x2d, 0x2b, 0x2b, 0x2b, 0x2c,
-    0x2a, 0x2b, 0x27, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2d, 0x2e, 0x2d, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2f, 0x33,
-    0x2e, 0x2b, 0x2b, 0x2b, 0x2e, 0x30, 0x38, 0x2e, 0x41, 0xa8, 0xad, 0x75,
-    0x3e, 0x30, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2b, 0x2a, 0x2b,
-    0x27, 0x2c, 0x2b, 0x2b, 0x2c, 0x27, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2d,
-    0x2e, 0x2e, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x35, 0x36, 0x42, 0x35, 0x36, 0x37, 0x39, 0x3e, 0x3b, 0x41, 0x43, 0x48,
-    0x4b, 0x50, 0x51, 0x57, 0x5a, 0x5e, 0x9a, 0xd7, 0xb1, 0xcd, 0xe9, 0xf1,
-    0xe9, 0xca, 0xa2, 0x80, 0x6f, 0x62, 0x5e, 0x5d, 0x54, 0x4f, 0x48, 0x48,
-    0x43, 0x3b, 0x3b, 0x37, 0x36, 0x37, 0x42, 0x35, 0x30, 0x30, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2e, 0x35, 0x83,
-    0xc9, 0x83, 0x66, 0x42, 0x30, 0x25, 0x1f, 0x21, 0x22, 0x1e, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1b, 0x1b, 0x1b, 0x1b, 0x1f, 0x2b, 0x2c, 0x1d, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x19, 0x18, 0x18, 0x18, 0x18, 0x17,
-    0x17, 0x19, 0x19, 0x16, 0x17, 0x16, 0x17, 0x18, 0x17, 0x17, 0x19, 0x2c,
-    0x34, 0x1b, 0x15, 0x17, 0x19, 0x17, 0x17, 0x1f, 0x18, 0x17, 0x15, 0x17,
-    0x18, 0x19, 0x25, 0x1c, 0x18, 0x17, 0x13, 0x18, 0x27, 0xa5, 0x90, 0x1d,
-    0x19, 0x1f, 0x39, 0x86, 0xc9, 0xb4, 0x4c, 0x1d, 0x19, 0x17, 0x13, 0x12,
-    0x13, 0x11, 0x0d, 0x0d, 0x12, 0x12, 0x11, 0x11, 0x11, 0x0d, 0x0f, 0x0f,
-    0x0b, 0x0f, 0x0b, 0x0f, 0x2a, 0x2a, 0x2b, 0x2b, 0x2c, 0x27, 0x27, 0x2b,
-    0x27, 0x2b, 0x39, 0x3a, 0x2c, 0x27, 0x27, 0x27, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x27, 0x27, 0x2c, 0x2b, 0x27, 0x27, 0x25, 0x27, 0x25, 0x25, 0x25,
-    0x27, 0x27, 0x23, 0x25, 0x27, 0x25, 0x23, 0x23, 0x23, 0x23, 0x23, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x2c, 0x2c, 0x2e, 0x2e, 0x2b, 0x2a, 0x2a, 0x2a, 0x2b, 0x2a, 0x2b,
-    0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2e, 0x2b, 0x2b, 0x2a, 0x2a, 0x2c, 0x2b, 0x2d, 0x2e, 0x2b, 0x2a, 0x2b,
-    0x2a, 0x2b, 0x2b, 0x2b, 0x31, 0x30, 0x30, 0x2e, 0x30, 0x30, 0x2d, 0x30,
-    0x33, 0x30, 0x39, 0x70, 0xb2, 0x9a, 0x4a, 0x3a, 0x2e, 0x2b, 0x2a, 0x2b,
-    0x2a, 0x2a, 0x2a, 0x2b, 0x2c, 0x2a, 0x27, 0x2c, 0x27, 0x27, 0x2a, 0x2a,
-    0x2c, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2b, 0x2e, 0x2e,
-    0x2e, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x36, 0x36, 0x42,
-    0x37, 0x39, 0x39, 0x39, 0x3b, 0x41, 0x46, 0x48, 0x49, 0x4b, 0x52, 0x51,
-    0x58, 0x6c, 0xd1, 0xba, 0x93, 0xc8, 0xe6, 0xf0, 0xea, 0xd1, 0xb0, 0x88,
-    0x6f, 0x61, 0x5e, 0x5b, 0x58, 0x54, 0x4f, 0x4b, 0x48, 0x41, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x42, 0x35, 0x30, 0x2e, 0x2d, 0x30, 0x2b, 0x2a, 0x2b,
-    0x2b, 0x2b, 0x29, 0x2b, 0x2d, 0x30, 0x8f, 0xc8, 0x81, 0x36, 0x2b, 0x2b,
-    0x27, 0x24, 0x1f, 0x22, 0x1d, 0x1f, 0x1f, 0x22, 0x1d, 0x1c, 0x1c, 0x1c,
-    0x20, 0x2b, 0x29, 0x21, 0x1b, 0x19, 0x18, 0x18, 0x19, 0x19, 0x19, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x18, 0x18, 0x19,
-    0x17, 0x17, 0x18, 0x18, 0x18, 0x17, 0x16, 0x1d, 0x30, 0x19, 0x17, 0x19,
-    0x1c, 0x22, 0x1d, 0x1c, 0x17, 0x18, 0x17, 0x19, 0x17, 0x17, 0x25, 0x24,
-    0x18, 0x17, 0x17, 0x18, 0x1d, 0x81, 0xb1, 0x22, 0x17, 0x18, 0x22, 0x2b,
-    0x66, 0xbd, 0xcd, 0x90, 0x25, 0x19, 0x15, 0x17, 0x14, 0x0f, 0x0e, 0x0d,
-    0x11, 0x0d, 0x11, 0x11, 0x0f, 0x0d, 0x0d, 0x0b, 0x0b, 0x0f, 0x0d, 0x0d,
-    0x27, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x2a, 0x2c, 0x37, 0x45, 0x2b,
-    0x2c, 0x2b, 0x2c, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27,
-    0x2a, 0x2c, 0x27, 0x27, 0x27, 0x25, 0x23, 0x27, 0x25, 0x27, 0x23, 0x25,
-    0x27, 0x23, 0x23, 0x23, 0x23, 0x25, 0x25, 0x25, 0x27, 0x25, 0x25, 0x27,
-    0x27, 0x27, 0x29, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2a,
-    0x2b, 0x2d, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b,
-    0x2b, 0x2c, 0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b,
-    0x30, 0x33, 0x30, 0x3e, 0x75, 0x81, 0x66, 0x4a, 0x59, 0x70, 0x8d, 0xb1,
-    0x70, 0x37, 0x2d, 0x2c, 0x2a, 0x2a, 0x2b, 0x2c, 0x2c, 0x2c, 0x2c, 0x2a,
-    0x2b, 0x2a, 0x2c, 0x2c, 0x27, 0x2c, 0x2a, 0x2a, 0x27, 0x2c, 0x2c, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x33, 0x33, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x37, 0x36, 0x36, 0x37, 0x39, 0x39, 0x39,
-    0x3b, 0x41, 0x41, 0x48, 0x4b, 0x49, 0x50, 0x58, 0x5a, 0x89, 0xda, 0x96,
-    0x88, 0xb7, 0xe2, 0xec, 0xef, 0xe6, 0xc8, 0xa6, 0x84, 0x77, 0x6f, 0x61,
-    0x5e, 0x51, 0x52, 0x49, 0x48, 0x41, 0x3b, 0x3b, 0x39, 0x39, 0x37, 0x42,
-    0x36, 0x42, 0x30, 0x30, 0x33, 0x30, 0x30, 0x2b, 0x2b, 0x2e, 0x2b, 0x2b,
-    0x35, 0x66, 0xca, 0x83, 0x38, 0x2b, 0x25, 0x23, 0x22, 0x20, 0x1f, 0x1d,
-    0x1d, 0x1f, 0x21, 0x22, 0x1b, 0x1d, 0x22, 0x1f, 0x2d, 0x2c, 0x1f, 0x1b,
-    0x19, 0x19, 0x19, 0x18, 0x18, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x17, 0x22, 0x2c, 0x17, 0x16, 0x18, 0x1b, 0x1f, 0x21, 0x19,
-    0x17, 0x17, 0x18, 0x18, 0x17, 0x15, 0x1b, 0x22, 0x18, 0x16, 0x16, 0x18,
-    0x1d, 0x75, 0xb1, 0x21, 0x16, 0x12, 0x18, 0x17, 0x1d, 0x42, 0x86, 0xca,
-    0x86, 0x1f, 0x18, 0x15, 0x12, 0x12, 0x0d, 0x0d, 0x0d, 0x0b, 0x0d, 0x11,
-    0x0d, 0x0d, 0x0d, 0x0b, 0x0c, 0x0f, 0x0d, 0x0d, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x27, 0x2b, 0x41, 0x3b, 0x27, 0x2c, 0x2b, 0x2b, 0x2b,
-    0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x23, 0x27, 0x27, 0x27, 0x23, 0x25, 0x25, 0x23, 0x23, 0x25,
-    0x25, 0x27, 0x27, 0x27, 0x25, 0x25, 0x23, 0x25, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2b, 0x2c, 0x25, 0x27, 0x2a, 0x2e, 0x27, 0x2a, 0x2e, 0x2d, 0x2a,
-    0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x33, 0x2e, 0x2b, 0x2a, 0x2b, 0x2d,
-    0x2e, 0x33, 0x2d, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x30, 0x30, 0x43, 0x97,
-    0xaf, 0x97, 0xa3, 0xa2, 0x92, 0x9b, 0x87, 0x56, 0x36, 0x33, 0x2d, 0x2b,
-    0x2b, 0x2a, 0x2c, 0x2c, 0x2c, 0x27, 0x2a, 0x2b, 0x2b, 0x2c, 0x2c, 0x2a,
-    0x2c, 0x2a, 0x2b, 0x2a, 0x2c, 0x27, 0x27, 0x2b, 0x2d, 0x2b, 0x2e, 0x30,
-    0x2e, 0x2e, 0x30, 0x30, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x33, 0x30, 0x30,
-    0x42, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39, 0x3b, 0x41, 0x41, 0x43,
-    0x49, 0x49, 0x51, 0x57, 0x5d, 0xb6, 0xd1, 0x80, 0x80, 0xa9, 0xd9, 0xe5,
-    0xed, 0xed, 0xe5, 0xcd, 0xb3, 0x8c, 0x77, 0x62, 0x5e, 0x57, 0x54, 0x4b,
-    0x48, 0x41, 0x41, 0x3b, 0x3e, 0x37, 0x37, 0x35, 0x42, 0x42, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x33, 0x35, 0x36, 0x3b, 0x81, 0xbd, 0xba, 0x3b,
-    0x2d, 0x27, 0x24, 0x21, 0x20, 0x1f, 0x1d, 0x1d, 0x1d, 0x1f, 0x22, 0x1d,
-    0x1d, 0x22, 0x28, 0x2b, 0x25, 0x1f, 0x1c, 0x19, 0x19, 0x19, 0x18, 0x18,
-    0x18, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x18, 0x19, 0x19,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x19, 0x25,
-    0x1d, 0x15, 0x15, 0x18, 0x1b, 0x22, 0x1c, 0x18, 0x17, 0x17, 0x18, 0x15,
-    0x15, 0x12, 0x18, 0x1f, 0x18, 0x16, 0x15, 0x18, 0x19, 0x67, 0xb6, 0x35,
-    0x19, 0x12, 0x18, 0x17, 0x18, 0x1b, 0x25, 0x83, 0xd1, 0x86, 0x28, 0x16,
-    0x16, 0x12, 0x0d, 0x11, 0x0f, 0x0b, 0x0d, 0x0d, 0x0d, 0x0d, 0x11, 0x0d,
-    0x0b, 0x0d, 0x0d, 0x11, 0x29, 0x27, 0x2c, 0x2c, 0x27, 0x2c, 0x2b, 0x2b,
-    0x2b, 0x42, 0x39, 0x30, 0x27, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x2c, 0x27,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x23, 0x23, 0x27,
-    0x27, 0x27, 0x25, 0x23, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x25, 0x25, 0x23, 0x25, 0x27, 0x27, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2b, 0x2c, 0x25,
-    0x27, 0x2a, 0x2e, 0x27, 0x2a, 0x2b, 0x2b, 0x2a, 0x27, 0x2c, 0x2c, 0x2b,
-    0x2b, 0x2c, 0x27, 0x2b, 0x2a, 0x2a, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x2e, 0x2e, 0x33, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x2b, 0x2b, 0x2a, 0x2e, 0x2e, 0x7b, 0xba, 0x59, 0x45, 0x41, 0x4a,
-    0x3e, 0x41, 0x37, 0x37, 0x2f, 0x2e, 0x2e, 0x2b, 0x2a, 0x2c, 0x2c, 0x27,
-    0x2c, 0x27, 0x2b, 0x2c, 0x2c, 0x27, 0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2c, 0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x2e, 0x30, 0x2e, 0x2e, 0x2f, 0x2f,
-    0x2e, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x42, 0x37, 0x37, 0x36,
-    0x37, 0x37, 0x37, 0x39, 0x3b, 0x3b, 0x41, 0x46, 0x4e, 0x54, 0x68, 0x97,
-    0xbd, 0xcd, 0x8c, 0x7c, 0x84, 0x88, 0xbb, 0xcb, 0xe5, 0xee, 0xed, 0xe8,
-    0xdc, 0xbe, 0x9d, 0x7c, 0x6f, 0x5e, 0x5d, 0x50, 0x49, 0x48, 0x41, 0x41,
-    0x3b, 0x39, 0x37, 0x35, 0x42, 0x36, 0x42, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x3b, 0x70, 0x9f, 0xb9, 0xb3, 0x72, 0x59, 0x30, 0x2b, 0x26, 0x24, 0x23,
-    0x24, 0x22, 0x1d, 0x1d, 0x1d, 0x22, 0x1c, 0x1d, 0x24, 0x29, 0x25, 0x20,
-    0x1d, 0x1c, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x19, 0x19,
-    0x19, 0x19, 0x18, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x29, 0x19, 0x15, 0x16, 0x18,
-    0x1c, 0x1e, 0x19, 0x18, 0x15, 0x15, 0x15, 0x12, 0x16, 0x15, 0x22, 0x29,
-    0x18, 0x16, 0x12, 0x18, 0x18, 0x2e, 0xa4, 0xaf, 0x4d, 0x1d, 0x17, 0x11,
-    0x12, 0x15, 0x17, 0x2c, 0x81, 0xd1, 0x67, 0x1c, 0x18, 0x15, 0x13, 0x11,
-    0x0f, 0x0f, 0x0d, 0x0d, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x11, 0x0d,
-    0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2a, 0x2b, 0x2a, 0x2c, 0x2a, 0x35, 0x39,
-    0x2b, 0x2b, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x2c, 0x27, 0x25, 0x25, 0x27, 0x27, 0x27, 0x25, 0x25,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x27, 0x27, 0x25, 0x25, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2b, 0x2c, 0x27, 0x27, 0x2a, 0x2a, 0x25,
-    0x27, 0x2c, 0x2b, 0x2a, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2c, 0x2a, 0x2b,
-    0x2a, 0x2a, 0x2a, 0x2b, 0x2d, 0x2a, 0x2a, 0x2b, 0x2e, 0x2e, 0x2b, 0x2e,
-    0x33, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x27,
-    0x2b, 0x35, 0x5f, 0xb8, 0x75, 0x36, 0x39, 0x30, 0x30, 0x30, 0x30, 0x2e,
-    0x2b, 0x2c, 0x27, 0x29, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27,
-    0x27, 0x25, 0x27, 0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x27, 0x2c, 0x2a,
-    0x2a, 0x2a, 0x2e, 0x2e, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2e, 0x2f, 0x30,
-    0x30, 0x30, 0x30, 0x35, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39,
-    0x3b, 0x41, 0x41, 0x48, 0x50, 0x70, 0xc9, 0xdc, 0xc4, 0x89, 0x5a, 0x6e,
-    0x6c, 0x78, 0xab, 0xa6, 0xba, 0xdc, 0xe9, 0xf0, 0xef, 0xe5, 0xca, 0xa6,
-    0x7c, 0x69, 0x5b, 0x57, 0x50, 0x49, 0x43, 0x41, 0x3b, 0x3e, 0x37, 0x35,
-    0x42, 0x42, 0x3a, 0x30, 0x3a, 0x30, 0x3a, 0x39, 0xa1, 0xd1, 0xb6, 0x75,
-    0x3b, 0x30, 0x30, 0x2e, 0x29, 0x25, 0x1f, 0x1f, 0x1f, 0x1f, 0x22, 0x1d,
-    0x1d, 0x1d, 0x1c, 0x1d, 0x27, 0x34, 0x22, 0x19, 0x19, 0x1b, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x19, 0x19, 0x1b, 0x1b, 0x19, 0x18,
-    0x17, 0x18, 0x18, 0x18, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17,
-    0x17, 0x18, 0x25, 0x24, 0x18, 0x15, 0x17, 0x19, 0x19, 0x18, 0x17, 0x16,
-    0x15, 0x12, 0x15, 0x12, 0x15, 0x15, 0x26, 0x27, 0x16, 0x15, 0x12, 0x17,
-    0x17, 0x1b, 0x33, 0xad, 0xc3, 0x73, 0x24, 0x17, 0x15, 0x14, 0x17, 0x18,
-    0x2b, 0xb4, 0xb4, 0x27, 0x1b, 0x15, 0x15, 0x11, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2e, 0x2b, 0x2c, 0x27, 0x2a, 0x2b, 0x2e, 0x3a, 0x30, 0x2b, 0x2a, 0x2c,
-    0x2b, 0x2b, 0x2a, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x2c,
-    0x27, 0x25, 0x25, 0x27, 0x27, 0x27, 0x23, 0x23, 0x23, 0x27, 0x27, 0x27,
-    0x27, 0x23, 0x23, 0x23, 0x25, 0x27, 0x25, 0x27, 0x25, 0x27, 0x27, 0x27,
-    0x27, 0x23, 0x23, 0x25, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x25, 0x27, 0x27, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2b, 0x2e, 0x2e, 0x2e, 0x33, 0x33,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2e, 0x2e, 0x27, 0x2a, 0x2d, 0x37, 0x70,
-    0xa9, 0x42, 0x30, 0x33, 0x33, 0x2d, 0x2d, 0x2b, 0x2d, 0x2e, 0x2e, 0x2b,
-    0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x25, 0x25, 0x25, 0x25,
-    0x2c, 0x2a, 0x2a, 0x2b, 0x2b, 0x2a, 0x27, 0x2a, 0x2c, 0x2c, 0x2b, 0x2e,
-    0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x35, 0x42,
-    0x37, 0x37, 0x37, 0x36, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x41, 0x46, 0x48,
-    0x50, 0x98, 0xc9, 0x7a, 0x68, 0x58, 0x5e, 0x5e, 0x6c, 0xa6, 0x8c, 0x80,
-    0x93, 0xb2, 0xd1, 0xe5, 0xed, 0xee, 0xe8, 0xd1, 0xa9, 0x7c, 0x6f, 0x5b,
-    0x54, 0x4b, 0x48, 0x41, 0x41, 0x3b, 0x37, 0x35, 0x42, 0x35, 0x30, 0x30,
-    0x35, 0x3f, 0x3e, 0x83, 0xc8, 0x7d, 0x41, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b,
-    0x2c, 0x20, 0x21, 0x24, 0x1f, 0x1f, 0x1f, 0x22, 0x22, 0x1d, 0x1d, 0x20,
-    0x2b, 0x27, 0x22, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x1b,
-    0x19, 0x19, 0x19, 0x1b, 0x1b, 0x1b, 0x19, 0x18, 0x17, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x17, 0x18, 0x18, 0x17, 0x15, 0x17, 0x18, 0x29, 0x1c,
-    0x18, 0x15, 0x15, 0x18, 0x19, 0x17, 0x15, 0x15, 0x15, 0x12, 0x15, 0x15,
-    0x12, 0x17, 0x25, 0x25, 0x15, 0x14, 0x11, 0x15, 0x15, 0x15, 0x1b, 0x66,
-    0x92, 0xa5, 0x83, 0x1b, 0x16, 0x15, 0x12, 0x16, 0x1c, 0x73, 0xd1, 0xb4,
-    0x86, 0x4d, 0x1d, 0x17, 0x12, 0x0d, 0x11, 0x0d, 0x0f, 0x0c, 0x0d, 0x0d,
-    0x0d, 0x0f, 0x0f, 0x0f, 0x27, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x27, 0x27,
-    0x27, 0x2c, 0x2b, 0x2e, 0x36, 0x30, 0x2b, 0x2b, 0x2b, 0x2d, 0x2a, 0x2a,
-    0x2b, 0x2c, 0x27, 0x2c, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x25, 0x23, 0x24, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x25, 0x25, 0x25, 0x23, 0x25, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2a, 0x2b, 0x2a, 0x2a, 0x2b,
-    0x2a, 0x2a, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b,
-    0x2a, 0x2a, 0x2b, 0x2e, 0x33, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x33, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x29, 0x2d, 0x30, 0x36, 0x70, 0xba, 0x48, 0x2b, 0x30,
-    0x33, 0x30, 0x2e, 0x2e, 0x33, 0x2e, 0x2b, 0x27, 0x2b, 0x2c, 0x2c, 0x2a,
-    0x2b, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x2c, 0x2a, 0x2b,
-    0x2b, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2d, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x36, 0x37, 0x37, 0x42, 0x42,
-    0x37, 0x39, 0x37, 0x39, 0x3b, 0x3b, 0x48, 0x6a, 0x9f, 0xd1, 0x8d, 0x57,
-    0x57, 0x54, 0x5b, 0x6c, 0x8c, 0x80, 0x69, 0x6f, 0x7c, 0x88, 0xa2, 0xc1,
-    0xe1, 0xeb, 0xef, 0xe9, 0xd7, 0x9b, 0x6f, 0x5e, 0x58, 0x50, 0x48, 0x43,
-    0x41, 0x39, 0x3d, 0x35, 0x37, 0x3a, 0x30, 0x30, 0x3b, 0x3e, 0x87, 0xca,
-    0x7b, 0x3e, 0x30, 0x2e, 0x2b, 0x2c, 0x25, 0x27, 0x27, 0x23, 0x23, 0x24,
-    0x20, 0x1f, 0x1f, 0x22, 0x22, 0x1f, 0x24, 0x2c, 0x28, 0x1d, 0x1c, 0x1c,
-    0x1b, 0x1b, 0x1c, 0x1b, 0x19, 0x19, 0x1b, 0x1b, 0x19, 0x19, 0x1b, 0x1b,
-    0x19, 0x19, 0x18, 0x17, 0x17, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x17, 0x17, 0x16, 0x17, 0x18, 0x18, 0x29, 0x1c, 0x18, 0x18, 0x16, 0x17,
-    0x18, 0x17, 0x15, 0x12, 0x12, 0x12, 0x15, 0x16, 0x15, 0x17, 0x26, 0x2c,
-    0x17, 0x12, 0x15, 0x15, 0x11, 0x15, 0x18, 0x27, 0x68, 0x7e, 0xbe, 0x4d,
-    0x19, 0x19, 0x11, 0x12, 0x16, 0x20, 0x75, 0xb4, 0xca, 0xca, 0x73, 0x20,
-    0x19, 0x16, 0x15, 0x12, 0x13, 0x11, 0x0d, 0x0d, 0x11, 0x0d, 0x0f, 0x0d,
-    0x27, 0x2c, 0x2a, 0x2a, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2b,
-    0x33, 0x30, 0x2e, 0x2a, 0x2a, 0x2b, 0x2a, 0x2c, 0x2a, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x25,
-    0x23, 0x23, 0x23, 0x24, 0x24, 0x24, 0x23, 0x23, 0x24, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x25, 0x23, 0x23, 0x27, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27,
-    0x2c, 0x2a, 0x2c, 0x2c, 0x2b, 0x2c, 0x2a, 0x2a, 0x2b, 0x2c, 0x2a, 0x2a,
-    0x2a, 0x2c, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x2e,
-    0x33, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2a, 0x2b, 0x2d, 0x2e,
-    0x2e, 0x30, 0x39, 0x7d, 0x9a, 0x39, 0x30, 0x2e, 0x31, 0x33, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x27, 0x27, 0x2a, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c,
-    0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x2c, 0x2a, 0x2b, 0x2a, 0x2c, 0x27,
-    0x27, 0x2a, 0x2b, 0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x35, 0x35, 0x35, 0x42, 0x42, 0x42, 0x42, 0x37, 0x37, 0x3e,
-    0x41, 0x46, 0x89, 0xbe, 0x9a, 0x7b, 0x4b, 0x51, 0x57, 0x78, 0x7f, 0x76,
-    0x6c, 0x5a, 0x61, 0x62, 0x6f, 0x77, 0x84, 0x9b, 0xba, 0xe1, 0xeb, 0xf0,
-    0xe6, 0xb8, 0x7c, 0x5e, 0x5a, 0x57, 0x4f, 0x48, 0x41, 0x39, 0x39, 0x37,
-    0x3a, 0x38, 0x3e, 0x4a, 0x81, 0xb6, 0xa3, 0x70, 0x35, 0x30, 0x2b, 0x2b,
-    0x27, 0x25, 0x23, 0x25, 0x23, 0x24, 0x24, 0x20, 0x21, 0x1f, 0x1f, 0x1f,
-    0x20, 0x27, 0x2b, 0x25, 0x1f, 0x1d, 0x1b, 0x1c, 0x1c, 0x1b, 0x1d, 0x1b,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x18, 0x1f, 0x1f, 0x17, 0x15, 0x17, 0x17, 0x18, 0x17, 0x15, 0x15,
-    0x15, 0x12, 0x12, 0x15, 0x15, 0x15, 0x1c, 0x29, 0x1f, 0x16, 0x15, 0x15,
-    0x12, 0x15, 0x16, 0x18, 0x24, 0x3e, 0xa5, 0xb6, 0x73, 0x2b, 0x18, 0x17,
-    0x14, 0x18, 0x1b, 0x35, 0x56, 0x86, 0xb9, 0xad, 0x73, 0x3c, 0x1f, 0x19,
-    0x11, 0x11, 0x0d, 0x0d, 0x0e, 0x0d, 0x11, 0x0d, 0x27, 0x27, 0x2c, 0x2c,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2a, 0x2a, 0x33, 0x2e, 0x2b,
-    0x2a, 0x2c, 0x2a, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25,
-    0x25, 0x27, 0x27, 0x27, 0x23, 0x23, 0x25, 0x25, 0x25, 0x25, 0x23, 0x23,
-    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x23, 0x25, 0x25, 0x23,
-    0x23, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2c, 0x2a,
-    0x2b, 0x2b, 0x2a, 0x2b, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b,
-    0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2d, 0x2e, 0x2b, 0x2a, 0x2b, 0x2c, 0x2b, 0x2d, 0x2c, 0x33, 0x66,
-    0xa3, 0x37, 0x30, 0x2e, 0x33, 0x2d, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x25,
-    0x2a, 0x2c, 0x2c, 0x2b, 0x2b, 0x2a, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x29,
-    0x25, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e,
-    0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x2e, 0x30, 0x30, 0x30,
-    0x30, 0x35, 0x35, 0x35, 0x35, 0x37, 0x3e, 0x41, 0x49, 0x49, 0xb9, 0xac,
-    0x54, 0x49, 0x49, 0x4f, 0x68, 0x84, 0x58, 0x5b, 0x57, 0x5a, 0x62, 0x62,
-    0x62, 0x6f, 0x77, 0x8b, 0xa7, 0xd4, 0xea, 0xef, 0xe5, 0xbe, 0x88, 0x6f,
-    0x5a, 0x57, 0x52, 0x49, 0x48, 0x41, 0x41, 0x41, 0x3e, 0x59, 0x83, 0xb6,
-    0xb9, 0x7d, 0x3e, 0x30, 0x31, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23,
-    0x24, 0x24, 0x20, 0x20, 0x1f, 0x20, 0x20, 0x21, 0x24, 0x2b, 0x2b, 0x20,
-    0x1d, 0x1b, 0x1b, 0x1c, 0x1c, 0x1b, 0x1c, 0x1b, 0x19, 0x19, 0x19, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x17, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x18, 0x21,
-    0x1c, 0x15, 0x15, 0x18, 0x18, 0x17, 0x17, 0x15, 0x15, 0x15, 0x11, 0x12,
-    0x15, 0x13, 0x17, 0x19, 0x1f, 0x1f, 0x17, 0x17, 0x16, 0x12, 0x16, 0x18,
-    0x11, 0x19, 0x70, 0x92, 0xb1, 0xb1, 0x67, 0x1d, 0x15, 0x15, 0x16, 0x1d,
-    0x30, 0x20, 0x4c, 0x90, 0xc6, 0xc9, 0xb1, 0x90, 0x5c, 0x20, 0x19, 0x17,
-    0x15, 0x11, 0x11, 0x0d, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x2b, 0x27, 0x2e, 0x30, 0x2e, 0x2b, 0x2b, 0x27, 0x2c,
-    0x27, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x25, 0x25, 0x25, 0x25, 0x27, 0x27, 0x25, 0x23, 0x24, 0x24, 0x24, 0x24,
-    0x24, 0x24, 0x24, 0x23, 0x25, 0x23, 0x25, 0x23, 0x25, 0x25, 0x25, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c,
-    0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2c, 0x2c, 0x2b, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x2a, 0x2a, 0x2c, 0x2a, 0x2a, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2a, 0x2b, 0x2e, 0x2e, 0x2b,
-    0x2b, 0x2b, 0x33, 0x2d, 0x38, 0x37, 0x38, 0x66, 0xa5, 0x41, 0x2b, 0x2d,
-    0x2b, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x2c, 0x27, 0x27, 0x2b,
-    0x2b, 0x2c, 0x2b, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x27, 0x27, 0x2a, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2d, 0x2e,
-    0x2e, 0x2e, 0x30, 0x30, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3a, 0x35,
-    0x42, 0x37, 0x41, 0x66, 0x8a, 0x87, 0xca, 0x86, 0x50, 0x49, 0x49, 0x50,
-    0x7f, 0x71, 0x57, 0x57, 0x57, 0x5b, 0x5e, 0x69, 0x62, 0x6f, 0x77, 0x8e,
-    0xb2, 0xda, 0xec, 0xed, 0xe1, 0xa9, 0x8c, 0x69, 0x5d, 0x54, 0x50, 0x49,
-    0x43, 0x41, 0x41, 0x48, 0x81, 0xc0, 0xc0, 0x9e, 0x48, 0x35, 0x30, 0x30,
-    0x2c, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x25, 0x24, 0x24, 0x20, 0x20, 0x1f,
-    0x1f, 0x20, 0x20, 0x1f, 0x20, 0x2c, 0x2c, 0x1f, 0x1c, 0x1b, 0x1b, 0x1c,
-    0x1b, 0x1b, 0x1c, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x15, 0x18, 0x1f, 0x22, 0x18, 0x17,
-    0x18, 0x17, 0x17, 0x16, 0x15, 0x13, 0x11, 0x12, 0x12, 0x11, 0x15, 0x15,
-    0x1d, 0x31, 0x26, 0x18, 0x16, 0x15, 0x12, 0x11, 0x15, 0x17, 0x59, 0x52,
-    0x2e, 0x75, 0xad, 0x8f, 0x1d, 0x12, 0x0f, 0x17, 0x29, 0x18, 0x18, 0x20,
-    0x30, 0xb4, 0xb4, 0xb4, 0xc0, 0xa1, 0x75, 0x4d, 0x47, 0x32, 0x1d, 0x18,
-    0x27, 0x27, 0x2c, 0x2c, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2a,
-    0x27, 0x2e, 0x3a, 0x2e, 0x2a, 0x2c, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2c,
-    0x2a, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x25, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x25, 0x25, 0x23, 0x23, 0x23, 0x23,
-    0x25, 0x23, 0x23, 0x23, 0x25, 0x29, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27,
-    0x2a, 0x2a, 0x2c, 0x2c, 0x2b, 0x2a, 0x2a, 0x2a, 0x2b, 0x2a, 0x2a, 0x2b,
-    0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x27,
-    0x27, 0x2a, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x30, 0x37, 0x66,
-    0x7b, 0x7e, 0x7b, 0x84, 0x79, 0x38, 0x2b, 0x2e, 0x2d, 0x2b, 0x2c, 0x27,
-    0x2c, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x2c, 0x2c, 0x27, 0x2a,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x42, 0x39, 0x41, 0x8d, 0xc6,
-    0xc8, 0xbd, 0x9f, 0x6b, 0x49, 0x48, 0x49, 0x68, 0x82, 0x51, 0x50, 0x57,
-    0x58, 0x5a, 0x5e, 0x61, 0x62, 0x6f, 0x7c, 0x9d, 0xc2, 0xe6, 0xef, 0xe8,
-    0xc8, 0x95, 0x80, 0x7f, 0x6c, 0x5d, 0x54, 0x4b, 0x4a, 0x48, 0x48, 0x98,
-    0xc8, 0x7b, 0x48, 0x39, 0x37, 0x30, 0x35, 0x33, 0x2c, 0x2b, 0x2a, 0x2a,
-    0x2b, 0x2c, 0x27, 0x25, 0x23, 0x24, 0x20, 0x20, 0x21, 0x20, 0x1f, 0x1d,
-    0x1f, 0x27, 0x2c, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19,
-    0x19, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x19,
-    0x18, 0x18, 0x17, 0x18, 0x18, 0x18, 0x17, 0x17, 0x16, 0x17, 0x17, 0x18,
-    0x17, 0x17, 0x18, 0x12, 0x18, 0x23, 0x21, 0x17, 0x17, 0x17, 0x17, 0x16,
-    0x15, 0x12, 0x15, 0x12, 0x12, 0x12, 0x12, 0x12, 0x15, 0x1d, 0x23, 0x18,
-    0x11, 0x11, 0x12, 0x0c, 0x14, 0x24, 0x79, 0x45, 0x19, 0x1d, 0x42, 0xb8,
-    0x67, 0x18, 0x11, 0x11, 0x21, 0x28, 0x1f, 0x17, 0x19, 0x67, 0x7b, 0x23,
-    0x4d, 0x73, 0x98, 0xa5, 0xad, 0xad, 0xa4, 0x73, 0x27, 0x2c, 0x2c, 0x2c,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x25, 0x2b, 0x2e, 0x2a,
-    0x27, 0x25, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x2b, 0x2b, 0x2a, 0x27, 0x27,
-    0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x27, 0x27, 0x25, 0x25, 0x27, 0x25, 0x25, 0x23, 0x23, 0x23,
-    0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x2a, 0x2a, 0x27, 0x2c,
-    0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x2c, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e,
-    0x2b, 0x2b, 0x2e, 0x2b, 0x2b, 0x30, 0x75, 0xb9, 0x7e, 0x6b, 0x6a, 0x4a,
-    0x37, 0x2e, 0x2e, 0x2b, 0x2d, 0x2b, 0x2b, 0x2a, 0x2a, 0x27, 0x27, 0x27,
-    0x2c, 0x2c, 0x27, 0x2b, 0x2a, 0x2c, 0x2b, 0x2a, 0x27, 0x27, 0x27, 0x27,
-    0x2a, 0x27, 0x2c, 0x27, 0x27, 0x2a, 0x27, 0x2c, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2b, 0x2d, 0x2d, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35,
-    0x35, 0x35, 0x42, 0x37, 0x41, 0x70, 0xd1, 0x94, 0x68, 0x4f, 0x43, 0x48,
-    0x48, 0x48, 0x49, 0x74, 0x71, 0x51, 0x51, 0x57, 0x5d, 0x5a, 0x5e, 0x69,
-    0x62, 0x6f, 0x88, 0xb2, 0xda, 0xec, 0xee, 0xe3, 0xb7, 0x88, 0x77, 0x69,
-    0x69, 0x6e, 0x54, 0x4b, 0x49, 0x49, 0x7d, 0xc3, 0x72, 0x41, 0x3e, 0x3a,
-    0x42, 0x33, 0x30, 0x30, 0x30, 0x2e, 0x2a, 0x2c, 0x2a, 0x27, 0x25, 0x23,
-    0x23, 0x24, 0x20, 0x20, 0x21, 0x1f, 0x1d, 0x1c, 0x1f, 0x2a, 0x2b, 0x1d,
-    0x1c, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x17, 0x15, 0x15, 0x18, 0x17, 0x18, 0x18, 0x16, 0x15,
-    0x15, 0x18, 0x21, 0x1d, 0x17, 0x17, 0x17, 0x16, 0x15, 0x13, 0x15, 0x15,
-    0x12, 0x15, 0x13, 0x12, 0x15, 0x15, 0x19, 0x19, 0x15, 0x11, 0x11, 0x11,
-    0x21, 0x79, 0x56, 0x1d, 0x1a, 0x17, 0x20, 0x83, 0xb9, 0x5c, 0x19, 0x14,
-    0x15, 0x19, 0x21, 0x17, 0x1a, 0x73, 0x83, 0x1a, 0x19, 0x18, 0x1d, 0x20,
-    0x47, 0x3f, 0x75, 0xb9, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27,
-    0x25, 0x25, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2a, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25,
-    0x25, 0x25, 0x27, 0x25, 0x25, 0x25, 0x23, 0x23, 0x23, 0x25, 0x27, 0x25,
-    0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x2a, 0x2c, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2a,
-    0x2b, 0x2a, 0x2a, 0x2a, 0x2c, 0x2b, 0x2b, 0x2e, 0x2b, 0x2c, 0x2a, 0x2d,
-    0x2e, 0x2b, 0x2a, 0x2b, 0x2b, 0x2d, 0x2c, 0x2b, 0x2b, 0x2b, 0x2e, 0x2d,
-    0x30, 0x41, 0xa5, 0x70, 0x3b, 0x30, 0x37, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x2a, 0x27, 0x2c, 0x2c, 0x2a,
-    0x2c, 0x27, 0x2b, 0x2c, 0x27, 0x25, 0x27, 0x25, 0x27, 0x2c, 0x2b, 0x2b,
-    0x2b, 0x2c, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x33, 0x2b, 0x2b, 0x2e, 0x2e,
-    0x33, 0x30, 0x30, 0x31, 0x2d, 0x2e, 0x30, 0x35, 0x42, 0x37, 0x37, 0x3e,
-    0x59, 0xac, 0xb9, 0x4b, 0x48, 0x46, 0x41, 0x41, 0x4a, 0x41, 0x4f, 0x95,
-    0x57, 0x50, 0x51, 0x57, 0x57, 0x5b, 0x61, 0x62, 0x6e, 0x77, 0x95, 0xc8,
-    0xe8, 0xf0, 0xe9, 0xd1, 0xa6, 0x7c, 0x6f, 0x62, 0x5e, 0x6e, 0x6c, 0x51,
-    0x68, 0x74, 0xa8, 0xac, 0x41, 0x39, 0x37, 0x35, 0x35, 0x30, 0x30, 0x30,
-    0x30, 0x2d, 0x2a, 0x2a, 0x2c, 0x27, 0x25, 0x24, 0x23, 0x20, 0x20, 0x20,
-    0x20, 0x1f, 0x1d, 0x1f, 0x2b, 0x2d, 0x1f, 0x1c, 0x1b, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0x1b, 0x1b, 0x18, 0x18,
-    0x18, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17,
-    0x15, 0x15, 0x15, 0x17, 0x17, 0x17, 0x15, 0x16, 0x16, 0x15, 0x1c, 0x29,
-    0x17, 0x12, 0x15, 0x18, 0x17, 0x15, 0x16, 0x15, 0x12, 0x15, 0x15, 0x15,
-    0x12, 0x16, 0x18, 0x17, 0x12, 0x11, 0x0d, 0x16, 0x42, 0x64, 0x1d, 0x12,
-    0x16, 0x18, 0x17, 0x2b, 0x75, 0xad, 0x70, 0x2c, 0x15, 0x14, 0x15, 0x11,
-    0x19, 0xa1, 0x5c, 0x17, 0x11, 0x11, 0x12, 0x11, 0x12, 0x17, 0x1b, 0x3b,
-    0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x25, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x27, 0x2a, 0x2c, 0x2c, 0x27, 0x2c, 0x27, 0x27, 0x27,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x25, 0x27, 0x27, 0x25,
-    0x25, 0x25, 0x25, 0x23, 0x25, 0x23, 0x25, 0x27, 0x27, 0x27, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2c,
-    0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x2b, 0x2c, 0x2a, 0x2a,
-    0x2c, 0x2b, 0x2e, 0x33, 0x2b, 0x2b, 0x27, 0x27, 0x2c, 0x2a, 0x2b, 0x2e,
-    0x2d, 0x2b, 0x2c, 0x2d, 0x2e, 0x2b, 0x2b, 0x2b, 0x30, 0x94, 0x94, 0x37,
-    0x30, 0x2e, 0x2e, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x27, 0x2c, 0x2c, 0x2b, 0x2c, 0x27, 0x2b, 0x2c,
-    0x27, 0x25, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x2d, 0x2e, 0x2e, 0x30, 0x33, 0x30, 0x35,
-    0x42, 0x35, 0x30, 0x30, 0x30, 0x39, 0x41, 0x81, 0xb4, 0xca, 0x70, 0x43,
-    0x41, 0x39, 0x41, 0x3b, 0x41, 0x43, 0x64, 0x96, 0x50, 0x50, 0x51, 0x57,
-    0x58, 0x5a, 0x61, 0x61, 0x6f, 0x80, 0xa6, 0xdd, 0xec, 0xef, 0xe3, 0xb7,
-    0x84, 0x76, 0x69, 0x62, 0x5e, 0x58, 0x5d, 0x96, 0x8a, 0x64, 0x87, 0xb6,
-    0x41, 0x3b, 0x42, 0x35, 0x35, 0x30, 0x30, 0x2e, 0x2e, 0x2b, 0x2b, 0x2a,
-    0x2c, 0x2c, 0x27, 0x23, 0x24, 0x24, 0x20, 0x20, 0x20, 0x24, 0x1f, 0x22,
-    0x27, 0x24, 0x1c, 0x1c, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x16, 0x17, 0x15,
-    0x17, 0x17, 0x15, 0x16, 0x16, 0x15, 0x18, 0x26, 0x18, 0x15, 0x15, 0x15,
-    0x15, 0x13, 0x15, 0x15, 0x12, 0x13, 0x16, 0x16, 0x12, 0x15, 0x17, 0x15,
-    0x12, 0x11, 0x15, 0x17, 0x59, 0x55, 0x18, 0x12, 0x12, 0x0f, 0x15, 0x18,
-    0x18, 0x4d, 0x83, 0xb4, 0x32, 0x17, 0x11, 0x0c, 0x1b, 0xa1, 0x32, 0x14,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x11, 0x17, 0x25, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2a, 0x2c, 0x27, 0x25, 0x27, 0x27, 0x25, 0x27, 0x2c, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x25, 0x23, 0x23, 0x23, 0x27, 0x25, 0x23, 0x25, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a,
-    0x2b, 0x2a, 0x2a, 0x2a, 0x2b, 0x2a, 0x2c, 0x2c, 0x2c, 0x2c, 0x2b, 0x2e,
-    0x2b, 0x2c, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2c, 0x2b, 0x30,
-    0x30, 0x30, 0x3b, 0x64, 0x7b, 0x9a, 0x3b, 0x31, 0x33, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2a, 0x2c, 0x2c, 0x27, 0x2c, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x2c,
-    0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e,
-    0x33, 0x33, 0x30, 0x33, 0x2e, 0x30, 0x3a, 0x30, 0x33, 0x30, 0x35, 0x35,
-    0x38, 0x41, 0x7d, 0xd1, 0xa1, 0x70, 0x4a, 0x3d, 0x39, 0x37, 0x41, 0x41,
-    0x41, 0x46, 0x4b, 0x85, 0x51, 0x4f, 0x50, 0x57, 0x5d, 0x5a, 0x62, 0x62,
-    0x6f, 0x84, 0xaf, 0xe2, 0xee, 0xec, 0xda, 0xa7, 0x80, 0x6f, 0x62, 0x62,
-    0x5e, 0x51, 0x7e, 0xab, 0x68, 0x49, 0x59, 0xb8, 0x70, 0x41, 0x42, 0x42,
-    0x42, 0x30, 0x33, 0x2e, 0x2b, 0x2a, 0x2a, 0x2c, 0x2c, 0x2a, 0x2c, 0x25,
-    0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x1f, 0x22, 0x25, 0x20, 0x1b, 0x1c,
-    0x1c, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x18,
-    0x18, 0x18, 0x17, 0x15, 0x15, 0x17, 0x17, 0x17, 0x17, 0x17, 0x15, 0x16,
-    0x16, 0x12, 0x17, 0x1c, 0x19, 0x17, 0x15, 0x12, 0x12, 0x13, 0x12, 0x12,
-    0x12, 0x12, 0x15, 0x16, 0x12, 0x15, 0x15, 0x15, 0x12, 0x11, 0x11, 0x16,
-    0x6b, 0x55, 0x15, 0x12, 0x0c, 0x09, 0x13, 0x18, 0x15, 0x15, 0x2b, 0xac,
-    0x65, 0x17, 0x0d, 0x14, 0x18, 0xa1, 0x32, 0x12, 0x0c, 0x0e, 0x0b, 0x0b,
-    0x0b, 0x0f, 0x11, 0x18, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x2a, 0x2c,
-    0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2c,
-    0x2c, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x29, 0x27, 0x27, 0x27, 0x25,
-    0x24, 0x23, 0x25, 0x25, 0x25, 0x25, 0x25, 0x23, 0x23, 0x23, 0x23, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x25, 0x25, 0x27, 0x27, 0x2c, 0x2c, 0x2a, 0x2c, 0x2b,
-    0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2d, 0x2b,
-    0x2b, 0x30, 0x30, 0x2f, 0x2e, 0x2f, 0x30, 0x40, 0x66, 0x71, 0x74, 0x82,
-    0x72, 0x48, 0x2f, 0x2e, 0x35, 0x2b, 0x2d, 0x30, 0x2e, 0x2d, 0x2b, 0x2b,
-    0x2d, 0x2e, 0x2b, 0x2c, 0x2c, 0x27, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2d, 0x2e, 0x34, 0x30, 0x2f,
-    0x30, 0x30, 0x30, 0x2e, 0x33, 0x30, 0x3a, 0x42, 0x3e, 0x48, 0xac, 0xc4,
-    0x4b, 0x48, 0x3e, 0x3d, 0x39, 0x3b, 0x3e, 0x3b, 0x41, 0x41, 0x4b, 0x6c,
-    0x57, 0x4b, 0x50, 0x57, 0x5d, 0x5e, 0x62, 0x6f, 0x6f, 0x8b, 0xb8, 0xe4,
-    0xef, 0xe9, 0xd1, 0xb1, 0x92, 0x80, 0x74, 0x6c, 0x6c, 0x78, 0xa0, 0x68,
-    0x49, 0x48, 0x46, 0x79, 0xb6, 0x70, 0x39, 0x37, 0x37, 0x35, 0x30, 0x2e,
-    0x2e, 0x2b, 0x2c, 0x2a, 0x2a, 0x27, 0x27, 0x25, 0x23, 0x24, 0x24, 0x24,
-    0x24, 0x20, 0x21, 0x1f, 0x25, 0x25, 0x1d, 0x1d, 0x1b, 0x19, 0x19, 0x19,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x19, 0x18, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x16, 0x15, 0x15, 0x15, 0x17, 0x18,
-    0x1c, 0x19, 0x17, 0x15, 0x15, 0x15, 0x12, 0x12, 0x12, 0x13, 0x15, 0x16,
-    0x13, 0x12, 0x15, 0x17, 0x15, 0x12, 0x15, 0x19, 0x79, 0x4d, 0x11, 0x12,
-    0x0f, 0x0d, 0x11, 0x0c, 0x11, 0x12, 0x17, 0x67, 0x9f, 0x20, 0x12, 0x11,
-    0x19, 0xa1, 0x47, 0x11, 0x11, 0x0b, 0x0c, 0x0c, 0x0b, 0x0b, 0x0d, 0x11,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x23, 0x23, 0x23, 0x25, 0x23,
-    0x25, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x25, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x27, 0x27, 0x2a, 0x2a, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x2d, 0x2c, 0x27, 0x27, 0x2c, 0x2e, 0x41, 0x51, 0x64,
-    0x49, 0x64, 0x71, 0x89, 0x79, 0x66, 0x56, 0x37, 0x2e, 0x2b, 0x2e, 0x2e,
-    0x30, 0x2b, 0x2e, 0x2e, 0x2e, 0x33, 0x2b, 0x2b, 0x2b, 0x2e, 0x2d, 0x2b,
-    0x2b, 0x2a, 0x2b, 0x2b, 0x27, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c,
-    0x27, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2d, 0x2b, 0x2e, 0x33, 0x33, 0x2f, 0x30, 0x30, 0x30, 0x33,
-    0x30, 0x37, 0x39, 0x41, 0x7d, 0xaf, 0xd1, 0x98, 0x41, 0x3e, 0x3b, 0x39,
-    0x3e, 0x41, 0x3b, 0x3b, 0x41, 0x41, 0x49, 0x5d, 0x51, 0x4b, 0x50, 0x58,
-    0x5a, 0x5e, 0x62, 0x6f, 0x7c, 0x99, 0xc5, 0xe7, 0xf1, 0xe8, 0xcd, 0xcb,
-    0xb8, 0xa3, 0x97, 0x92, 0x8a, 0x88, 0x68, 0x51, 0x46, 0x46, 0x43, 0x41,
-    0xa4, 0x87, 0x3b, 0x37, 0x42, 0x35, 0x30, 0x2e, 0x2e, 0x2b, 0x2b, 0x2a,
-    0x2c, 0x2c, 0x27, 0x23, 0x25, 0x23, 0x23, 0x20, 0x20, 0x1f, 0x20, 0x1f,
-    0x23, 0x24, 0x1d, 0x1d, 0x1b, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x19, 0x19,
-    0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x18, 0x1c, 0x18, 0x17,
-    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x12, 0x15, 0x18,
-    0x15, 0x12, 0x16, 0x2e, 0x96, 0x55, 0x1a, 0x11, 0x11, 0x11, 0x0d, 0x0c,
-    0x0f, 0x0e, 0x11, 0x28, 0x9a, 0x73, 0x1d, 0x18, 0x67, 0x9f, 0x22, 0x12,
-    0x12, 0x0c, 0x0b, 0x0f, 0x0b, 0x0b, 0x0b, 0x0f, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2c,
-    0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x23, 0x23, 0x23, 0x23, 0x23, 0x25, 0x25, 0x23, 0x23,
-    0x25, 0x23, 0x23, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x2c,
-    0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2a, 0x2b, 0x2d, 0x2a, 0x2b, 0x2e, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x2d, 0x2e, 0x35, 0x48, 0x71, 0x7f, 0x6a, 0x4f, 0x3e,
-    0x30, 0x2e, 0x2b, 0x2b, 0x2d, 0x31, 0x2e, 0x2b, 0x29, 0x2c, 0x2b, 0x2b,
-    0x2e, 0x33, 0x2b, 0x2a, 0x2a, 0x2b, 0x33, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2c, 0x2c, 0x2c, 0x2b, 0x2b, 0x2a, 0x2b, 0x2c, 0x27, 0x27, 0x2c, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x2f, 0x30, 0x30, 0x30, 0x37, 0x41, 0x48, 0x66, 0xad,
-    0xca, 0xa4, 0x7b, 0x64, 0x41, 0x39, 0x37, 0x3e, 0x3d, 0x3b, 0x3b, 0x3b,
-    0x43, 0x46, 0x48, 0x51, 0x49, 0x49, 0x51, 0x58, 0x5a, 0x5e, 0x62, 0x6f,
-    0x84, 0xb2, 0xdd, 0xec, 0xef, 0xe7, 0xd0, 0xc7, 0x88, 0x6c, 0x5e, 0x5e,
-    0x5d, 0x57, 0x50, 0x50, 0x49, 0x43, 0x46, 0x3b, 0x70, 0xa8, 0x43, 0x42,
-    0x30, 0x30, 0x2e, 0x2e, 0x2b, 0x2d, 0x2b, 0x2a, 0x2c, 0x27, 0x27, 0x25,
-    0x25, 0x25, 0x23, 0x20, 0x20, 0x1f, 0x20, 0x1f, 0x1f, 0x1f, 0x1c, 0x1d,
-    0x1b, 0x1b, 0x19, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1c, 0x19, 0x19,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x15, 0x15,
-    0x15, 0x15, 0x15, 0x12, 0x15, 0x18, 0x19, 0x17, 0x15, 0x12, 0x15, 0x16,
-    0x15, 0x15, 0x15, 0x15, 0x15, 0x12, 0x16, 0x18, 0x17, 0x12, 0x12, 0x20,
-    0x56, 0x79, 0x59, 0x12, 0x0f, 0x0f, 0x11, 0x0d, 0x0f, 0x11, 0x15, 0x18,
-    0x4c, 0xb1, 0x83, 0x5f, 0x97, 0x2c, 0x17, 0x11, 0x11, 0x0f, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0e, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x23, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x27, 0x27, 0x27, 0x25,
-    0x23, 0x23, 0x24, 0x23, 0x25, 0x25, 0x23, 0x23, 0x25, 0x24, 0x24, 0x24,
-    0x24, 0x23, 0x23, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2c, 0x2c, 0x2b,
-    0x2b, 0x2a, 0x2a, 0x2b, 0x2a, 0x2a, 0x2a, 0x2c, 0x2c, 0x2c, 0x2d, 0x2e,
-    0x33, 0x2b, 0x2e, 0x30, 0x42, 0x30, 0x2e, 0x33, 0x2e, 0x2d, 0x2a, 0x27,
-    0x2b, 0x2d, 0x2b, 0x27, 0x2a, 0x2b, 0x2b, 0x2e, 0x2b, 0x2a, 0x2c, 0x27,
-    0x2a, 0x2b, 0x2b, 0x2d, 0x33, 0x33, 0x2b, 0x2b, 0x2e, 0x2b, 0x2a, 0x2b,
-    0x2b, 0x27, 0x2c, 0x27, 0x27, 0x2c, 0x27, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2d, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x33,
-    0x35, 0x36, 0x3b, 0x70, 0xb4, 0xc6, 0xca, 0xb1, 0x66, 0x3b, 0x39, 0x37,
-    0x37, 0x39, 0x37, 0x37, 0x39, 0x3b, 0x3b, 0x3e, 0x43, 0x48, 0x48, 0x4b,
-    0x49, 0x4b, 0x50, 0x58, 0x5e, 0x5e, 0x69, 0x77, 0x95, 0xc6, 0xe8, 0xf0,
-    0xec, 0xe1, 0xce, 0xab, 0x77, 0x62, 0x61, 0x5e, 0x58, 0x57, 0x51, 0x4f,
-    0x49, 0x48, 0x46, 0x41, 0x59, 0xb1, 0x66, 0x35, 0x30, 0x30, 0x30, 0x2e,
-    0x30, 0x2b, 0x2b, 0x2b, 0x2c, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x25, 0x24,
-    0x20, 0x1f, 0x20, 0x20, 0x20, 0x20, 0x1f, 0x1d, 0x1b, 0x1b, 0x19, 0x19,
-    0x19, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x1a, 0x19, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x15, 0x16, 0x15, 0x16, 0x16, 0x15, 0x15, 0x13, 0x15,
-    0x16, 0x1b, 0x1d, 0x18, 0x12, 0x12, 0x11, 0x11, 0x13, 0x15, 0x16, 0x15,
-    0x15, 0x15, 0x17, 0x18, 0x17, 0x12, 0x12, 0x14, 0x17, 0x3f, 0x71, 0x25,
-    0x0d, 0x0c, 0x0d, 0x0d, 0x0c, 0x0d, 0x11, 0x11, 0x18, 0x55, 0xb4, 0xb1,
-    0x4c, 0x17, 0x11, 0x13, 0x0b, 0x11, 0x0c, 0x08, 0x0b, 0x11, 0x0b, 0x0b,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x27, 0x27,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x23, 0x23, 0x24, 0x24,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x24, 0x24, 0x20, 0x23, 0x23, 0x25,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2a, 0x2c, 0x2c, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a,
-    0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2e, 0x2d, 0x2b, 0x2b, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2b, 0x2e, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2c, 0x2c,
-    0x2a, 0x2d, 0x2d, 0x2e, 0x2b, 0x2b, 0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2e,
-    0x33, 0x33, 0x2b, 0x2a, 0x2b, 0x2b, 0x2c, 0x2a, 0x2b, 0x2a, 0x2a, 0x2c,
-    0x2c, 0x2c, 0x2a, 0x2b, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a,
-    0x2a, 0x2b, 0x2e, 0x2e, 0x2b, 0x2e, 0x2e, 0x2e, 0x35, 0x41, 0x87, 0xc6,
-    0xad, 0x81, 0x75, 0x41, 0x37, 0x37, 0x42, 0x35, 0x42, 0x37, 0x37, 0x39,
-    0x39, 0x3b, 0x3b, 0x3d, 0x41, 0x41, 0x48, 0x4f, 0x50, 0x51, 0x50, 0x5b,
-    0x5a, 0x82, 0xa3, 0x9b, 0xa9, 0xd7, 0xeb, 0xf0, 0xe6, 0xc8, 0xaf, 0x88,
-    0x6f, 0x69, 0x62, 0x5e, 0x5d, 0x57, 0x51, 0x50, 0x49, 0x49, 0x46, 0x41,
-    0x48, 0x9f, 0x9f, 0x3b, 0x35, 0x3a, 0x35, 0x30, 0x30, 0x2d, 0x2b, 0x2a,
-    0x2c, 0x2b, 0x2b, 0x2c, 0x2c, 0x25, 0x25, 0x23, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x21, 0x22, 0x1d, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x1b,
-    0x1b, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x17, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x15,
-    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x12, 0x1b, 0x22, 0x17,
-    0x12, 0x15, 0x12, 0x13, 0x13, 0x15, 0x15, 0x15, 0x11, 0x11, 0x15, 0x17,
-    0x15, 0x11, 0x11, 0x11, 0x15, 0x18, 0x56, 0x66, 0x18, 0x13, 0x11, 0x0e,
-    0x0b, 0x0c, 0x11, 0x11, 0x15, 0x1f, 0x73, 0xca, 0x73, 0x1f, 0x16, 0x15,
-    0x11, 0x0b, 0x0a, 0x0b, 0x0d, 0x09, 0x0b, 0x0b, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x27, 0x27, 0x2a, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x25, 0x27, 0x25, 0x25, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x25, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x25, 0x25, 0x23, 0x24, 0x24, 0x24, 0x24, 0x28, 0x24,
-    0x24, 0x24, 0x20, 0x20, 0x20, 0x24, 0x23, 0x23, 0x25, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x2c, 0x27, 0x2c, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2a, 0x2a,
-    0x2a, 0x2b, 0x2d, 0x2e, 0x2d, 0x2b, 0x2a, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2a, 0x2b, 0x2d, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b,
-    0x2b, 0x2c, 0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2c, 0x2a, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x27, 0x27, 0x2b, 0x2b, 0x2e, 0x33,
-    0x2b, 0x2e, 0x2e, 0x30, 0x36, 0x44, 0xbd, 0x87, 0x41, 0x46, 0x30, 0x30,
-    0x36, 0x3a, 0x35, 0x35, 0x3a, 0x38, 0x37, 0x39, 0x39, 0x3b, 0x3b, 0x41,
-    0x3b, 0x41, 0x51, 0x7f, 0x58, 0x57, 0x57, 0x5e, 0x5e, 0xa9, 0xbe, 0xd0,
-    0xc7, 0xdf, 0xeb, 0xf0, 0xe5, 0xbb, 0x95, 0x7c, 0x6f, 0x69, 0x62, 0x5e,
-    0x58, 0x57, 0x51, 0x50, 0x49, 0x48, 0x48, 0x41, 0x41, 0x72, 0xca, 0x43,
-    0x35, 0x30, 0x36, 0x30, 0x30, 0x33, 0x2d, 0x2a, 0x2a, 0x2a, 0x2b, 0x2a,
-    0x2c, 0x2c, 0x23, 0x23, 0x24, 0x20, 0x24, 0x24, 0x21, 0x1f, 0x22, 0x1d,
-    0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0x19, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x15, 0x15, 0x12, 0x16, 0x16,
-    0x15, 0x17, 0x17, 0x17, 0x15, 0x18, 0x1c, 0x18, 0x15, 0x15, 0x15, 0x13,
-    0x13, 0x12, 0x12, 0x12, 0x11, 0x11, 0x12, 0x15, 0x15, 0x12, 0x0f, 0x0d,
-    0x13, 0x14, 0x2b, 0x6a, 0x1b, 0x11, 0x11, 0x0d, 0x0b, 0x0b, 0x15, 0x11,
-    0x11, 0x18, 0x2e, 0x90, 0xd1, 0xac, 0x3f, 0x17, 0x12, 0x0f, 0x12, 0x0e,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2c, 0x2c, 0x27,
-    0x27, 0x2a, 0x2c, 0x27, 0x2c, 0x2c, 0x27, 0x2c, 0x27, 0x2c, 0x2c, 0x2c,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x25,
-    0x23, 0x23, 0x24, 0x24, 0x24, 0x24, 0x23, 0x24, 0x24, 0x24, 0x20, 0x20,
-    0x24, 0x23, 0x25, 0x23, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
-    0x2c, 0x2a, 0x2a, 0x2b, 0x2a, 0x2b, 0x2a, 0x2b, 0x2b, 0x2d, 0x2d, 0x2b,
-    0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x33, 0x2b, 0x2b, 0x2b, 0x2d,
-    0x2b, 0x2c, 0x2a, 0x2b, 0x2d, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2b, 0x2e, 0x2e, 0x2b, 0x2e, 0x3a, 0x2d,
-    0x36, 0x66, 0xca, 0x6b, 0x37, 0x37, 0x42, 0x36, 0x42, 0x36, 0x38, 0x42,
-    0x37, 0x37, 0x37, 0x39, 0x39, 0x3b, 0x3b, 0x41, 0x41, 0x43, 0x50, 0x7c,
-    0x77, 0x76, 0x68, 0x5a, 0x74, 0xb8, 0x7a, 0x8c, 0xa7, 0xd1, 0xeb, 0xf1,
-    0xe5, 0xbe, 0x99, 0x80, 0x6f, 0x62, 0x61, 0x5e, 0x58, 0x57, 0x51, 0x50,
-    0x49, 0x49, 0x49, 0x4a, 0x46, 0x94, 0xc3, 0x43, 0x42, 0x30, 0x42, 0x30,
-    0x33, 0x33, 0x2e, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2c, 0x25, 0x23,
-    0x24, 0x24, 0x24, 0x20, 0x21, 0x1f, 0x1d, 0x1d, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x18, 0x18, 0x18, 0x17,
-    0x18, 0x18, 0x17, 0x15, 0x15, 0x12, 0x15, 0x15, 0x15, 0x17, 0x16, 0x17,
-    0x16, 0x15, 0x17, 0x1c, 0x18, 0x11, 0x15, 0x15, 0x13, 0x11, 0x11, 0x12,
-    0x12, 0x11, 0x12, 0x15, 0x15, 0x15, 0x12, 0x0d, 0x0b, 0x11, 0x2d, 0x6a,
-    0x1b, 0x0c, 0x0f, 0x0f, 0x0b, 0x11, 0x11, 0x0c, 0x11, 0x15, 0x18, 0x22,
-    0x67, 0xc4, 0x90, 0x42, 0x5c, 0x2c, 0x15, 0x12, 0x0c, 0x0b, 0x09, 0x0b,
-    0x27, 0x27, 0x27, 0x27, 0x2a, 0x2a, 0x2b, 0x2c, 0x27, 0x2a, 0x27, 0x25,
-    0x2a, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x23, 0x23, 0x23, 0x23,
-    0x24, 0x23, 0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2b, 0x2b,
-    0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b,
-    0x2c, 0x2b, 0x2d, 0x2d, 0x2a, 0x2b, 0x2a, 0x2b, 0x2b, 0x2a, 0x2b, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x2a, 0x2b, 0x2a, 0x2c, 0x27,
-    0x27, 0x27, 0x2a, 0x2a, 0x27, 0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x3a, 0x30, 0x39, 0x7d, 0xcd, 0x59,
-    0x3e, 0x3a, 0x42, 0x35, 0x42, 0x37, 0x37, 0x36, 0x37, 0x37, 0x37, 0x39,
-    0x39, 0x3b, 0x3b, 0x3d, 0x46, 0x43, 0x51, 0x5a, 0x58, 0x6d, 0x7f, 0x5e,
-    0x76, 0xb3, 0x9b, 0x80, 0xa2, 0xd1, 0xeb, 0xf0, 0xe6, 0xc8, 0xa6, 0x84,
-    0x6f, 0x6f, 0x62, 0x5e, 0x5a, 0x58, 0x57, 0x51, 0x50, 0x4b, 0x48, 0x43,
-    0x4b, 0xaf, 0x94, 0x41, 0x37, 0x36, 0x42, 0x33, 0x30, 0x30, 0x2e, 0x2e,
-    0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2a, 0x27, 0x23, 0x24, 0x20, 0x20, 0x20,
-    0x1f, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x1b, 0x1c, 0x1c, 0x1c, 0x19, 0x18,
-    0x18, 0x18, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x17, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x15,
-    0x15, 0x15, 0x12, 0x12, 0x15, 0x15, 0x15, 0x15, 0x15, 0x12, 0x15, 0x1c,
-    0x19, 0x12, 0x12, 0x12, 0x12, 0x11, 0x11, 0x11, 0x11, 0x0d, 0x11, 0x15,
-    0x15, 0x12, 0x0d, 0x11, 0x11, 0x16, 0x20, 0x6a, 0x1f, 0x0c, 0x0c, 0x0b,
-    0x0b, 0x11, 0x0d, 0x0d, 0x0d, 0x11, 0x11, 0x16, 0x1f, 0x86, 0xbe, 0x7e,
-    0x85, 0xad, 0x5c, 0x12, 0x0e, 0x0b, 0x0c, 0x0b, 0x29, 0x27, 0x27, 0x2c,
-    0x2c, 0x2c, 0x2a, 0x27, 0x2c, 0x2a, 0x27, 0x25, 0x2a, 0x2a, 0x27, 0x2c,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x29, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x27, 0x25, 0x23, 0x23, 0x23, 0x23, 0x24, 0x23, 0x23, 0x24,
-    0x24, 0x23, 0x23, 0x23, 0x23, 0x25, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27,
-    0x27, 0x27, 0x2c, 0x2b, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x27, 0x27, 0x2b, 0x2b,
-    0x2c, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x2e,
-    0x2b, 0x2c, 0x2b, 0x2e, 0x33, 0x30, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2c, 0x27, 0x2a, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x2c,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2b, 0x2b, 0x2e, 0x30, 0x30,
-    0x30, 0x30, 0x2e, 0x41, 0x68, 0xa4, 0xc4, 0x3b, 0x42, 0x3a, 0x31, 0x30,
-    0x42, 0x37, 0x37, 0x36, 0x38, 0x37, 0x37, 0x39, 0x39, 0x3e, 0x3b, 0x3e,
-    0x41, 0x4a, 0x4f, 0x6d, 0x57, 0x51, 0x85, 0x85, 0x5e, 0x7e, 0xa0, 0x80,
-    0xaf, 0xe3, 0xed, 0xf1, 0xea, 0xcd, 0xa9, 0x8b, 0x77, 0x6e, 0x62, 0x62,
-    0x5e, 0x5a, 0x5d, 0x57, 0x51, 0x49, 0x49, 0x48, 0x4f, 0xb9, 0x81, 0x41,
-    0x39, 0x37, 0x42, 0x30, 0x3a, 0x30, 0x33, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x2c, 0x23, 0x24, 0x20, 0x20, 0x20, 0x22, 0x1d, 0x1d, 0x22,
-    0x1d, 0x1d, 0x1c, 0x1d, 0x1e, 0x1b, 0x1b, 0x18, 0x18, 0x18, 0x19, 0x1b,
-    0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x15, 0x15, 0x15, 0x15, 0x13,
-    0x15, 0x12, 0x13, 0x12, 0x12, 0x15, 0x17, 0x18, 0x18, 0x15, 0x15, 0x12,
-    0x12, 0x12, 0x12, 0x11, 0x0f, 0x0b, 0x0d, 0x12, 0x12, 0x12, 0x0d, 0x0f,
-    0x12, 0x11, 0x1d, 0x71, 0x2c, 0x0d, 0x0f, 0x0b, 0x08, 0x11, 0x0f, 0x0d,
-    0x0c, 0x0e, 0x0d, 0x0f, 0x17, 0x55, 0x98, 0x20, 0x24, 0x86, 0xc0, 0x1d,
-    0x11, 0x0a, 0x0b, 0x0b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2a, 0x27, 0x2c, 0x27, 0x2c, 0x2c, 0x27, 0x27,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x23, 0x25, 0x23, 0x23, 0x24, 0x23, 0x23,
-    0x23, 0x23, 0x25, 0x23, 0x23, 0x23, 0x23, 0x23, 0x24, 0x23, 0x23, 0x23,
-    0x23, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x2a,
-    0x2a, 0x2b, 0x27, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2e, 0x33, 0x2e, 0x2b, 0x2e, 0x2b, 0x2b, 0x2e, 0x2e, 0x2c, 0x25, 0x2a,
-    0x2b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
-    0x27, 0x27, 0x2b, 0x2a, 0x2b, 0x2e, 0x30, 0x30, 0x41, 0x52, 0x51, 0x51,
-    0x50, 0xa8, 0xb1, 0x41, 0x35, 0x30, 0x34, 0x30, 0x35, 0x37, 0x36, 0x42,
-    0x42, 0x37, 0x37, 0x39, 0x39, 0x39, 0x3b, 0x41, 0x46, 0x48, 0x49, 0x51,
-    0x54, 0x51, 0x8d, 0xbe, 0x88, 0x8a, 0x88, 0x8a, 0xd7, 0xe1, 0xe8, 0xf1,
-    0xee, 0xe1, 0xba, 0x9b, 0x84, 0x6f, 0x6f, 0x62, 0x61, 0x5e, 0x60, 0x57,
-    0x51, 0x50, 0x49, 0x49, 0x4b, 0x87, 0xbd, 0x43, 0x41, 0x37, 0x42, 0x36,
-    0x36, 0x3a, 0x2f, 0x2e, 0x2e, 0x2e, 0x2b, 0x2a, 0x2b, 0x2b, 0x2c, 0x25,
-    0x23, 0x20, 0x24, 0x20, 0x1f, 0x1f, 0x1f, 0x1f, 0x1d, 0x1d, 0x1b, 0x1d,
-    0x22, 0x1d, 0x1c, 0x1b, 0x1b, 0x19, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x19,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x18, 0x18, 0x18, 0x17,
-    0x15, 0x17, 0x17, 0x16, 0x15, 0x12, 0x12, 0x15, 0x15, 0x12, 0x12, 0x15,
-    0x15, 0x15, 0x15, 0x15, 0x12, 0x12, 0x15, 0x13, 0x12, 0x11, 0x11, 0x0d,
-    0x0d, 0x0f, 0x0d, 0x12, 0x15, 0x15, 0x11, 0x0e, 0x0d, 0x11, 0x20, 0x71,
-    0x28, 0x12, 0x0f, 0x09, 0x0a, 0x0d, 0x0d, 0x0b, 0x0f, 0x0d, 0x0d, 0x0d,
-    0x18, 0x47, 0x97, 0x20, 0x15, 0x33, 0xc3, 0x2c, 0x11, 0x0b, 0x08, 0x0a,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27,
-    0x2a, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x25, 0x24, 0x23, 0x23, 0x23, 0x24, 0x25, 0x25, 0x29,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2c, 0x2c, 0x2c, 0x2b,
-    0x2d, 0x2b, 0x2b, 0x2a, 0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x2b, 0x2b, 0x27, 0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2e, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2d, 0x33,
-    0x2e, 0x2b, 0x2b, 0x2e, 0x2e, 0x2c, 0x27, 0x2b, 0x2b, 0x27, 0x27, 0x27,
-    0x2c, 0x27, 0x2a, 0x2a, 0x2c, 0x2c, 0x2a, 0x2a, 0x27, 0x27, 0x2b, 0x27,
-    0x2c, 0x2b, 0x2e, 0x2e, 0x35, 0x46, 0x48, 0x39, 0x41, 0xb4, 0xa8, 0x37,
-    0x35, 0x3a, 0x30, 0x42, 0x30, 0x42, 0x35, 0x42, 0x36, 0x42, 0x35, 0x37,
-    0x37, 0x37, 0x3e, 0x41, 0x41, 0x43, 0x48, 0x4b, 0x50, 0x51, 0x57, 0x74,
-    0x6c, 0x5e, 0x6f, 0x96, 0xe1, 0xd0, 0xe2, 0xf0, 0xf1, 0xe7, 0xd0, 0xb0,
-    0x8e, 0x7c, 0x6f, 0x62, 0x62, 0x5e, 0x5a, 0x58, 0x54, 0x51, 0x49, 0x49,
-    0x49, 0x6a, 0xc6, 0x4f, 0x43, 0x3e, 0x37, 0x37, 0x37, 0x42, 0x30, 0x2e,
-    0x2e, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2a, 0x27, 0x24, 0x23, 0x23, 0x24,
-    0x24, 0x20, 0x1f, 0x1f, 0x1d, 0x1b, 0x1c, 0x1c, 0x1d, 0x1d, 0x1d, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x18, 0x18,
-    0x18, 0x18, 0x17, 0x17, 0x18, 0x18, 0x18, 0x17, 0x15, 0x15, 0x17, 0x16,
-    0x15, 0x15, 0x12, 0x15, 0x15, 0x12, 0x12, 0x15, 0x15, 0x15, 0x15, 0x15,
-    0x13, 0x12, 0x12, 0x11, 0x11, 0x11, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x11,
-    0x12, 0x15, 0x12, 0x11, 0x11, 0x11, 0x1a, 0x6b, 0x39, 0x16, 0x11, 0x0e,
-    0x0c, 0x11, 0x0d, 0x0b, 0x0b, 0x0d, 0x0d, 0x0c, 0x15, 0x75, 0x81, 0x18,
-    0x11, 0x42, 0xb3, 0x25, 0x0f, 0x0b, 0x0b, 0x0b, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27,
-    0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25,
-    0x25, 0x23, 0x24, 0x24, 0x24, 0x23, 0x23, 0x23, 0x23, 0x24, 0x23, 0x23,
-    0x24, 0x23, 0x23, 0x24, 0x24, 0x23, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x23, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x2a, 0x2a, 0x2c, 0x2c, 0x2e, 0x2b, 0x2b, 0x2b, 0x2c,
-    0x2c, 0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a,
-    0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2d, 0x2b, 0x2b, 0x2d, 0x2d, 0x2d, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x33, 0x2e, 0x2b, 0x2a, 0x2b,
-    0x2d, 0x2a, 0x27, 0x2a, 0x2a, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2a, 0x2a,
-    0x2c, 0x2a, 0x2a, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e,
-    0x30, 0x2e, 0x30, 0x39, 0x64, 0xca, 0x8f, 0x38, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x35, 0x35, 0x42, 0x36, 0x36, 0x42, 0x37, 0x37, 0x39, 0x3b, 0x41,
-    0x41, 0x46, 0x48, 0x49, 0x4b, 0x4b, 0x54, 0x5d, 0x5a, 0x69, 0x69, 0x9d,
-    0xe1, 0xbe, 0xd1, 0xe8, 0xef, 0xed, 0xe4, 0xc8, 0xa9, 0x88, 0x77, 0x6f,
-    0x62, 0x61, 0x5e, 0x5a, 0x57, 0x57, 0x4b, 0x49, 0x48, 0x64, 0xb7, 0x64,
-    0x41, 0x3b, 0x39, 0x37, 0x37, 0x42, 0x30, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x2c, 0x27, 0x23, 0x23, 0x23, 0x24, 0x24, 0x21, 0x21, 0x22,
-    0x1d, 0x1c, 0x1c, 0x1c, 0x1d, 0x22, 0x1c, 0x1b, 0x1b, 0x1c, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x17, 0x18,
-    0x17, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x15, 0x15, 0x15,
-    0x15, 0x12, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x12, 0x12, 0x11,
-    0x0d, 0x0d, 0x11, 0x0d, 0x0d, 0x0d, 0x0d, 0x11, 0x12, 0x12, 0x11, 0x12,
-    0x11, 0x0e, 0x14, 0x2e, 0x53, 0x2e, 0x0d, 0x0d, 0x0b, 0x0f, 0x0d, 0x0b,
-    0x0d, 0x0d, 0x0b, 0x0b, 0x18, 0x83, 0x83, 0x1b, 0x1c, 0x75, 0x83, 0x1a,
-    0x0e, 0x08, 0x0f, 0x0b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x2c, 0x27, 0x2c, 0x2c, 0x2c, 0x2a, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x25, 0x25, 0x23, 0x23,
-    0x23, 0x24, 0x23, 0x23, 0x24, 0x23, 0x23, 0x24, 0x24, 0x23, 0x24, 0x24,
-    0x24, 0x23, 0x23, 0x27, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25,
-    0x27, 0x27, 0x2c, 0x25, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x2c, 0x27, 0x2c, 0x2e, 0x2e, 0x2b, 0x2b, 0x2c, 0x27, 0x2c, 0x2c, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2a, 0x2c, 0x2c, 0x2c, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x2a,
-    0x2b, 0x2b, 0x2e, 0x2e, 0x2d, 0x2b, 0x2a, 0x2b, 0x2d, 0x2b, 0x2c, 0x2b,
-    0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2d, 0x33, 0x2f, 0x35, 0x43,
-    0x87, 0xd1, 0x66, 0x39, 0x30, 0x30, 0x33, 0x33, 0x30, 0x30, 0x30, 0x35,
-    0x37, 0x37, 0x37, 0x39, 0x39, 0x3e, 0x3b, 0x41, 0x41, 0x41, 0x43, 0x48,
-    0x49, 0x4b, 0x54, 0x57, 0x5a, 0x61, 0x6c, 0xbd, 0xd7, 0xa3, 0xb0, 0xd1,
-    0xe7, 0xee, 0xee, 0xe5, 0xd1, 0xa9, 0x84, 0x77, 0x6f, 0x62, 0x61, 0x5e,
-    0x58, 0x57, 0x51, 0x51, 0x4f, 0x9a, 0x94, 0x48, 0x41, 0x39, 0x39, 0x37,
-    0x37, 0x36, 0x30, 0x30, 0x2f, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x27,
-    0x27, 0x23, 0x24, 0x24, 0x24, 0x1f, 0x1f, 0x22, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18,
-    0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x18, 0x18,
-    0x17, 0x17, 0x17, 0x15, 0x15, 0x15, 0x13, 0x15, 0x15, 0x13, 0x13, 0x15,
-    0x15, 0x15, 0x15, 0x15, 0x15, 0x12, 0x11, 0x11, 0x0d, 0x11, 0x0d, 0x0d,
-    0x0d, 0x11, 0x0d, 0x11, 0x11, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0e, 0x16,
-    0x3a, 0x63, 0x28, 0x0d, 0x0b, 0x0c, 0x0d, 0x0b, 0x0f, 0x0d, 0x0b, 0x0d,
-    0x15, 0x3f, 0x97, 0x42, 0x73, 0x94, 0x24, 0x12, 0x14, 0x0b, 0x0b, 0x0b,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2c,
-    0x27, 0x2c, 0x2c, 0x2a, 0x2b, 0x2a, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x25, 0x24,
-    0x23, 0x23, 0x23, 0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x25, 0x25,
-    0x23, 0x25, 0x25, 0x23, 0x25, 0x27, 0x27, 0x23, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x25, 0x25, 0x25, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x2b,
-    0x2e, 0x2b, 0x2b, 0x2c, 0x27, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2a, 0x2a, 0x2b, 0x2a, 0x2a,
-    0x2a, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x2e,
-    0x2d, 0x2b, 0x2a, 0x2d, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2e, 0x2b, 0x2b, 0x2e, 0x2e,
-    0x33, 0x2e, 0x2e, 0x2e, 0x2d, 0x2d, 0x37, 0x4b, 0xc0, 0xb4, 0x48, 0x39,
-    0x30, 0x30, 0x30, 0x33, 0x30, 0x30, 0x30, 0x35, 0x37, 0x37, 0x39, 0x3b,
-    0x39, 0x3e, 0x3b, 0x3b, 0x41, 0x41, 0x43, 0x48, 0x49, 0x52, 0x50, 0x58,
-    0x61, 0x6c, 0x9a, 0xdd, 0xb1, 0x7a, 0x88, 0xae, 0xc8, 0xe5, 0xec, 0xf0,
-    0xe7, 0xc8, 0xa0, 0x80, 0x77, 0x62, 0x62, 0x5e, 0x5a, 0x57, 0x54, 0x54,
-    0x7b, 0xb3, 0x4f, 0x48, 0x41, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x35, 0x30,
-    0x30, 0x30, 0x2e, 0x2e, 0x2b, 0x2b, 0x27, 0x27, 0x27, 0x23, 0x24, 0x24,
-    0x20, 0x20, 0x1f, 0x22, 0x22, 0x22, 0x22, 0x1d, 0x22, 0x1d, 0x1c, 0x1b,
-    0x1b, 0x1b, 0x19, 0x18, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0x19, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x18, 0x18, 0x18, 0x17, 0x15,
-    0x15, 0x15, 0x12, 0x15, 0x15, 0x12, 0x12, 0x15, 0x12, 0x15, 0x15, 0x15,
-    0x15, 0x12, 0x12, 0x11, 0x12, 0x0d, 0x0d, 0x0f, 0x0d, 0x0d, 0x11, 0x11,
-    0x0d, 0x0b, 0x0d, 0x0c, 0x0c, 0x0d, 0x0b, 0x0e, 0x15, 0x52, 0x56, 0x15,
-    0x0e, 0x0b, 0x0f, 0x0b, 0x0d, 0x0d, 0x0b, 0x0b, 0x12, 0x1c, 0x75, 0x94,
-    0xad, 0x65, 0x16, 0x0d, 0x0d, 0x0b, 0x0b, 0x0b, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x2b, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27,
-    0x25, 0x27, 0x25, 0x25, 0x25, 0x23, 0x25, 0x23, 0x23, 0x25, 0x23, 0x23,
-    0x24, 0x23, 0x24, 0x24, 0x24, 0x24, 0x23, 0x24, 0x23, 0x25, 0x23, 0x23,
-    0x25, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x25,
-    0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2c, 0x2b, 0x2e, 0x2e,
-    0x2e, 0x2b, 0x2b, 0x2c, 0x27, 0x2a, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2d,
-    0x2b, 0x2b, 0x2b, 0x27, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2d, 0x2d, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2e, 0x33,
-    0x2e, 0x2e, 0x42, 0x48, 0xca, 0xa4, 0x4f, 0x37, 0x3a, 0x3a, 0x42, 0x30,
-    0x30, 0x35, 0x3a, 0x30, 0x36, 0x37, 0x39, 0x39, 0x39, 0x3e, 0x3e, 0x3b,
-    0x41, 0x41, 0x48, 0x48, 0x49, 0x50, 0x57, 0x60, 0x78, 0xbd, 0xd9, 0xc3,
-    0x80, 0x6f, 0x7c, 0x93, 0xa9, 0xcb, 0xe5, 0xf0, 0xee, 0xdc, 0xb0, 0x88,
-    0x7c, 0x6f, 0x62, 0x61, 0x5e, 0x58, 0x58, 0x6c, 0xc6, 0x7e, 0x51, 0x48,
-    0x4a, 0x41, 0x41, 0x3b, 0x39, 0x37, 0x35, 0x35, 0x30, 0x30, 0x33, 0x2e,
-    0x2b, 0x2a, 0x2c, 0x2c, 0x2c, 0x27, 0x23, 0x23, 0x24, 0x1f, 0x20, 0x1f,
-    0x1f, 0x1f, 0x22, 0x22, 0x1d, 0x1d, 0x1c, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17,
-    0x17, 0x17, 0x17, 0x18, 0x18, 0x18, 0x17, 0x16, 0x15, 0x15, 0x12, 0x15,
-    0x15, 0x12, 0x12, 0x15, 0x12, 0x15, 0x15, 0x15, 0x15, 0x12, 0x12, 0x11,
-    0x11, 0x11, 0x0d, 0x0f, 0x0d, 0x0d, 0x12, 0x11, 0x11, 0x0f, 0x0e, 0x0b,
-    0x0b, 0x0d, 0x0b, 0x0d, 0x12, 0x46, 0x56, 0x0d, 0x0b, 0x11, 0x0d, 0x0d,
-    0x0d, 0x0f, 0x0b, 0x0c, 0x0f, 0x15, 0x5f, 0xb8, 0xb1, 0x32, 0x12, 0x0c,
-    0x0b, 0x09, 0x0b, 0x0b, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x27, 0x25,
-    0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x25, 0x24, 0x23, 0x23,
-    0x23, 0x24, 0x23, 0x25, 0x25, 0x23, 0x23, 0x23, 0x24, 0x24, 0x24, 0x24,
-    0x24, 0x24, 0x24, 0x20, 0x24, 0x24, 0x23, 0x23, 0x25, 0x25, 0x25, 0x27,
-    0x27, 0x25, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2c,
-    0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2a, 0x2c, 0x2a, 0x2a, 0x2c, 0x27, 0x27,
-    0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x2c,
-    0x2c, 0x2a, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2a, 0x2e, 0x2b, 0x2a, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x33, 0x30, 0x2e, 0x33, 0x30, 0x3d,
-    0x75, 0xbd, 0xb6, 0x4a, 0x39, 0x3a, 0x30, 0x30, 0x35, 0x42, 0x42, 0x30,
-    0x42, 0x37, 0x39, 0x39, 0x3e, 0x3b, 0x3b, 0x3b, 0x41, 0x46, 0x43, 0x48,
-    0x49, 0x4f, 0x58, 0x78, 0xc9, 0xd1, 0xa3, 0x77, 0x5e, 0x6f, 0x77, 0x80,
-    0x95, 0xba, 0xe1, 0xed, 0xef, 0xe5, 0xba, 0x95, 0x84, 0x77, 0x6f, 0x61,
-    0x61, 0x5e, 0x5a, 0x74, 0xca, 0x68, 0x50, 0x48, 0x43, 0x41, 0x41, 0x3b,
-    0x3b, 0x37, 0x37, 0x42, 0x30, 0x2f, 0x2e, 0x2d, 0x2b, 0x2b, 0x2a, 0x2a,
-    0x2a, 0x2c, 0x27, 0x27, 0x25, 0x24, 0x24, 0x24, 0x1f, 0x1d, 0x1c, 0x1d,
-    0x1d, 0x1c, 0x1c, 0x1c, 0x1c, 0x1b, 0x1c, 0x1b, 0x1c, 0x1b, 0x1b, 0x1b,
-    0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x15, 0x15,
-    0x17, 0x18, 0x18, 0x16, 0x15, 0x12, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
-    0x13, 0x13, 0x12, 0x12, 0x12, 0x12, 0x11, 0x11, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x0d, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11, 0x0d, 0x0b, 0x0c, 0x0f, 0x11,
-    0x15, 0x52, 0x56, 0x0b, 0x0b, 0x11, 0x0d, 0x0d, 0x0d, 0x0f, 0x0d, 0x0b,
-    0x0d, 0x1c, 0x83, 0x87, 0xa4, 0x22, 0x0d, 0x0d, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2a, 0x2a, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x27, 0x27, 0x25, 0x24, 0x23, 0x23, 0x23, 0x24, 0x23, 0x23,
-    0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
-    0x24, 0x23, 0x23, 0x23, 0x25, 0x25, 0x25, 0x27, 0x29, 0x27, 0x25, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2e,
-    0x2e, 0x2e, 0x2b, 0x2e, 0x2b, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x2c, 0x2a, 0x2d, 0x2b, 0x2b, 0x2e, 0x2b, 0x27, 0x2a, 0x2b, 0x2c, 0x2a,
-    0x2a, 0x2b, 0x2c, 0x2c, 0x2a, 0x2b, 0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2d, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e,
-    0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x33, 0x33, 0x33, 0x30, 0x30, 0x3a, 0x41, 0x59, 0xbd, 0xad,
-    0x3b, 0x37, 0x35, 0x30, 0x35, 0x42, 0x42, 0x35, 0x42, 0x37, 0x37, 0x37,
-    0x3e, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x4a, 0x48, 0x48, 0x50, 0x58, 0xb9,
-    0xda, 0x97, 0x69, 0x61, 0x61, 0x62, 0x6f, 0x84, 0xba, 0xdb, 0xde, 0xe9,
-    0xf1, 0xe9, 0xd0, 0xb3, 0x99, 0x80, 0x77, 0x6e, 0x62, 0x5e, 0x5e, 0x54,
-    0xbd, 0x7b, 0x50, 0x48, 0x48, 0x43, 0x41, 0x41, 0x3b, 0x39, 0x37, 0x42,
-    0x35, 0x30, 0x30, 0x2f, 0x2e, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x27,
-    0x25, 0x24, 0x24, 0x20, 0x1f, 0x1d, 0x1c, 0x1d, 0x1d, 0x1c, 0x1c, 0x1c,
-    0x1c, 0x1b, 0x1c, 0x1b, 0x1c, 0x1c, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x16, 0x16, 0x17, 0x18, 0x17, 0x16,
-    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x13,
-    0x15, 0x13, 0x12, 0x12, 0x12, 0x11, 0x0d, 0x0d, 0x0d, 0x11, 0x12, 0x12,
-    0x12, 0x12, 0x12, 0x0d, 0x0b, 0x0c, 0x0f, 0x0d, 0x15, 0x53, 0x39, 0x09,
-    0x0b, 0x0f, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0d, 0x18, 0x3f, 0x92, 0x3e,
-    0x94, 0x32, 0x0d, 0x11, 0x0c, 0x0a, 0x09, 0x0b, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2a, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27,
-    0x25, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x24, 0x24, 0x24, 0x24, 0x24,
-    0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x23, 0x23, 0x23,
-    0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x25, 0x27, 0x27, 0x2c, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x27, 0x27, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2c, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x2d, 0x2b, 0x2c, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c,
-    0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2d, 0x34, 0x2e, 0x2e, 0x2b,
-    0x2e, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x33, 0x2e, 0x2b, 0x2d, 0x2e, 0x2e,
-    0x2e, 0x2b, 0x30, 0x30, 0x30, 0x3b, 0x7d, 0xd1, 0x6b, 0x37, 0x30, 0x3a,
-    0x35, 0x42, 0x42, 0x35, 0x36, 0x37, 0x37, 0x39, 0x3e, 0x3b, 0x3b, 0x41,
-    0x41, 0x41, 0x41, 0x43, 0x49, 0x51, 0x6c, 0xd3, 0xad, 0x5e, 0x5a, 0x58,
-    0x5e, 0x62, 0x62, 0x88, 0xcb, 0xc8, 0xbe, 0xe3, 0xee, 0xee, 0xe6, 0xd7,
-    0xbe, 0x9d, 0x80, 0x6f, 0x62, 0x5e, 0x61, 0x60, 0xbd, 0x79, 0x51, 0x49,
-    0x48, 0x43, 0x41, 0x41, 0x3b, 0x39, 0x37, 0x36, 0x42, 0x35, 0x35, 0x30,
-    0x30, 0x2e, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2c, 0x27, 0x25, 0x23, 0x20,
-    0x1f, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x1d, 0x1c, 0x1c, 0x1b, 0x1c, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x17, 0x17, 0x16, 0x17, 0x17, 0x17, 0x15, 0x15, 0x15, 0x13, 0x13,
-    0x12, 0x12, 0x12, 0x12, 0x13, 0x13, 0x13, 0x12, 0x13, 0x13, 0x12, 0x12,
-    0x12, 0x0d, 0x11, 0x11, 0x0d, 0x0d, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x0d,
-    0x0b, 0x0b, 0x0f, 0x0d, 0x15, 0x52, 0x40, 0x11, 0x0d, 0x0b, 0x0b, 0x0b,
-    0x0f, 0x0f, 0x0d, 0x15, 0x19, 0x83, 0x75, 0x24, 0x81, 0x4d, 0x0d, 0x0d,
-    0x0b, 0x0a, 0x0b, 0x0b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x25, 0x25, 0x25,
-    0x24, 0x23, 0x24, 0x24, 0x24, 0x23, 0x24, 0x24, 0x20, 0x24, 0x24, 0x24,
-    0x24, 0x24, 0x24, 0x24, 0x25, 0x23, 0x25, 0x23, 0x23, 0x25, 0x25, 0x27,
-    0x27, 0x27, 0x27, 0x25, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2c, 0x2c, 0x2b,
-    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x33, 0x2e, 0x2e, 0x2b, 0x2d, 0x2b, 0x2d, 0x33,
-    0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2d, 0x2e,
-    0x2d, 0x2b, 0x2e, 0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x30, 0x30,
-    0x30, 0x3b, 0x81, 0xd1, 0x70, 0x37, 0x30, 0x38, 0x35, 0x37, 0x36, 0x42,
-    0x37, 0x37, 0x37, 0x39, 0x3e, 0x3b, 0x3b, 0x41, 0x43, 0x43, 0x43, 0x48,
-    0x50, 0x5d, 0x85, 0xe1, 0x94, 0x60, 0x57, 0x57, 0x5d, 0x5e, 0x5e, 0x80,
-    0xc8, 0xa2, 0x9b, 0xc8, 0xe7, 0xed, 0xef, 0xeb, 0xe3, 0xc6, 0x9d, 0x7c,
-    0x6f, 0x69, 0x61, 0x8a, 0xc6, 0x5d, 0x51, 0x49, 0x48, 0x43, 0x41, 0x3b,
-    0x3b, 0x3e, 0x39, 0x37, 0x36, 0x36, 0x42, 0x35, 0x30, 0x2e, 0x2e, 0x2d,
-    0x2b, 0x2a, 0x2a, 0x2a, 0x2c, 0x25, 0x25, 0x24, 0x20, 0x22, 0x1d, 0x22,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x19, 0x18, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x16, 0x17,
-    0x17, 0x15, 0x15, 0x15, 0x15, 0x15, 0x12, 0x12, 0x12, 0x11, 0x11, 0x12,
-    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x11, 0x0d, 0x11, 0x11,
-    0x0d, 0x0d, 0x0f, 0x0d, 0x0d, 0x0d, 0x11, 0x0d, 0x0b, 0x0c, 0x0f, 0x0f,
-    0x15, 0x52, 0x5f, 0x0d, 0x0b, 0x0b, 0x0c, 0x0b, 0x0b, 0x0d, 0x11, 0x15,
-    0x2c, 0xb6, 0x3f, 0x22, 0x70, 0x83, 0x1c, 0x0d, 0x0b, 0x09, 0x0b, 0x0b,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x27, 0x27, 0x27, 0x2c, 0x25, 0x27, 0x25, 0x23, 0x24, 0x24, 0x24, 0x24,
-    0x23, 0x25, 0x25, 0x24, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x23,
-    0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x27, 0x27, 0x27, 0x25, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a,
-    0x2a, 0x2a, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x27, 0x2c,
-    0x2c, 0x2c, 0x2b, 0x2b, 0x2c, 0x2a, 0x2b, 0x2d, 0x2e, 0x2e, 0x2b, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2d, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2e, 0x33,
-    0x33, 0x33, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x30, 0x3a, 0x46, 0x9f, 0xbd,
-    0x46, 0x37, 0x30, 0x35, 0x35, 0x36, 0x36, 0x36, 0x37, 0x37, 0x37, 0x39,
-    0x3e, 0x3b, 0x3b, 0x41, 0x43, 0x46, 0x43, 0x49, 0x50, 0x68, 0xc3, 0xcf,
-    0x71, 0x57, 0x63, 0x58, 0x5b, 0x69, 0x9d, 0xb7, 0xa7, 0x84, 0x84, 0xa7,
-    0xcd, 0xe3, 0xea, 0xef, 0xef, 0xe3, 0xba, 0x93, 0x77, 0x6f, 0x5e, 0xb1,
-    0xba, 0x58, 0x53, 0x4f, 0x4b, 0x48, 0x43, 0x41, 0x3b, 0x3b, 0x3e, 0x39,
-    0x37, 0x37, 0x36, 0x42, 0x30, 0x30, 0x2e, 0x2e, 0x2b, 0x2b, 0x2a, 0x2b,
-    0x2a, 0x27, 0x27, 0x23, 0x20, 0x1f, 0x1f, 0x1f, 0x22, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1c, 0x1c, 0x1c, 0x1b, 0x1b, 0x1b, 0x19, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x16, 0x15, 0x17, 0x15, 0x13, 0x12,
-    0x15, 0x15, 0x15, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
-    0x12, 0x12, 0x12, 0x11, 0x0d, 0x0d, 0x0d, 0x11, 0x0d, 0x0f, 0x0f, 0x0b,
-    0x0d, 0x0d, 0x11, 0x0b, 0x0b, 0x0b, 0x0b, 0x0d, 0x15, 0x39, 0x64, 0x20,
-    0x15, 0x0b, 0x0b, 0x0b, 0x0f, 0x0d, 0x11, 0x1f, 0x81, 0x90, 0x19, 0x18,
-    0x33, 0x94, 0x81, 0x22, 0x11, 0x0b, 0x0b, 0x0b, 0x27, 0x27, 0x27, 0x2c,
-    0x2c, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2a, 0x2c, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x27, 0x27, 0x27, 0x23, 0x23, 0x24, 0x24, 0x24, 0x23, 0x25, 0x25, 0x25,
-    0x24, 0x23, 0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x24, 0x24, 0x24,
-    0x23, 0x25, 0x25, 0x27, 0x27, 0x25, 0x25, 0x25, 0x25, 0x27, 0x25, 0x27,
-    0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x2a, 0x2c, 0x2c, 0x2c, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x27, 0x2c, 0x2c, 0x2b, 0x2c,
-    0x27, 0x2c, 0x2d, 0x2e, 0x2e, 0x2e, 0x2b, 0x2c, 0x2a, 0x2b, 0x2d, 0x2d,
-    0x2b, 0x2b, 0x2b, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2a,
-    0x27, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x2e, 0x2b, 0x2e, 0x2e,
-    0x2f, 0x30, 0x33, 0x2d, 0x2b, 0x2b, 0x2b, 0x2e, 0x30, 0x30, 0x2e, 0x2d,
-    0x2b, 0x2e, 0x33, 0x30, 0x36, 0x41, 0xad, 0xac, 0x3b, 0x39, 0x30, 0x30,
-    0x35, 0x42, 0x36, 0x37, 0x37, 0x37, 0x37, 0x39, 0x3e, 0x3b, 0x3b, 0x41,
-    0x41, 0x41, 0x41, 0x48, 0x50, 0x98, 0xe2, 0x9a, 0x58, 0x54, 0x51, 0x57,
-    0x5e, 0x6c, 0xbe, 0x96, 0x69, 0x6f, 0x77, 0x88, 0xa6, 0xc1, 0xdd, 0xeb,
-    0xf1, 0xe9, 0xcd, 0xa6, 0x80, 0x77, 0x82, 0xcd, 0xa3, 0x5b, 0x58, 0x51,
-    0x4b, 0x48, 0x48, 0x46, 0x41, 0x41, 0x3b, 0x39, 0x37, 0x37, 0x37, 0x42,
-    0x30, 0x30, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x27, 0x25,
-    0x24, 0x1f, 0x1f, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1c, 0x1c,
-    0x1c, 0x1c, 0x1b, 0x1b, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x17, 0x16, 0x17, 0x15, 0x15, 0x12, 0x12, 0x15, 0x15, 0x15,
-    0x16, 0x15, 0x15, 0x13, 0x12, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11,
-    0x0d, 0x0d, 0x11, 0x11, 0x0d, 0x0d, 0x0f, 0x0b, 0x0d, 0x0d, 0x11, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0e, 0x18, 0x52, 0x64, 0x41, 0x1f, 0x0d, 0x0b,
-    0x0f, 0x0d, 0x18, 0x67, 0x9f, 0x1d, 0x11, 0x0f, 0x17, 0x2c, 0x83, 0x7d,
-    0x19, 0x0b, 0x0c, 0x0b, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2a, 0x2c, 0x2c,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x23,
-    0x24, 0x23, 0x24, 0x24, 0x24, 0x23, 0x25, 0x25, 0x24, 0x25, 0x23, 0x24,
-    0x24, 0x23, 0x23, 0x20, 0x20, 0x23, 0x23, 0x23, 0x25, 0x25, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x25, 0x27, 0x25, 0x25, 0x27, 0x2c,
-    0x27, 0x27, 0x27, 0x2b, 0x2a, 0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x27, 0x2c, 0x2b, 0x2d,
-    0x2e, 0x2b, 0x2b, 0x2c, 0x27, 0x27, 0x2a, 0x2b, 0x2a, 0x2b, 0x2b, 0x2d,
-    0x2d, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2a, 0x2b,
-    0x2b, 0x2a, 0x2e, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x33, 0x2e,
-    0x2e, 0x2b, 0x2b, 0x2d, 0x30, 0x30, 0x2e, 0x2d, 0x2b, 0x2e, 0x33, 0x30,
-    0x39, 0x66, 0xca, 0x7d, 0x39, 0x3a, 0x33, 0x42, 0x35, 0x35, 0x36, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x46, 0x48, 0x48,
-    0x57, 0xac, 0xda, 0x68, 0x54, 0x51, 0x54, 0x63, 0x5d, 0x6c, 0xbe, 0xa3,
-    0x5e, 0x6f, 0x6f, 0x7c, 0x8a, 0xa6, 0xc8, 0xe5, 0xef, 0xec, 0xdd, 0xb0,
-    0x93, 0x8a, 0xba, 0xaf, 0x6c, 0x5e, 0x54, 0x51, 0x4b, 0x49, 0x48, 0x43,
-    0x43, 0x41, 0x3b, 0x39, 0x39, 0x39, 0x37, 0x42, 0x35, 0x30, 0x30, 0x2e,
-    0x2e, 0x2b, 0x2b, 0x2a, 0x27, 0x27, 0x25, 0x27, 0x24, 0x20, 0x20, 0x1f,
-    0x22, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1c, 0x1c, 0x1b, 0x1c, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17,
-    0x18, 0x17, 0x15, 0x12, 0x12, 0x15, 0x12, 0x12, 0x15, 0x15, 0x12, 0x12,
-    0x12, 0x12, 0x11, 0x12, 0x12, 0x12, 0x12, 0x11, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0b, 0x0f, 0x0b, 0x0d, 0x0d, 0x0d, 0x0f, 0x0b,
-    0x0b, 0x0d, 0x19, 0x24, 0x3d, 0x51, 0x22, 0x09, 0x0d, 0x11, 0x24, 0x98,
-    0x4d, 0x11, 0x0f, 0x0c, 0x11, 0x17, 0x1f, 0x83, 0x4d, 0x0d, 0x0b, 0x0b,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x25, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x23, 0x23, 0x23, 0x28, 0x24,
-    0x23, 0x25, 0x27, 0x27, 0x25, 0x23, 0x23, 0x24, 0x24, 0x23, 0x24, 0x20,
-    0x24, 0x25, 0x23, 0x23, 0x24, 0x23, 0x23, 0x25, 0x27, 0x27, 0x27, 0x25,
-    0x25, 0x25, 0x23, 0x25, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2b,
-    0x2b, 0x27, 0x2c, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x2c, 0x2c, 0x2a, 0x2a, 0x2b, 0x2d, 0x2b, 0x2a, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x2a, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2e, 0x33,
-    0x33, 0x2b, 0x2b, 0x2b, 0x30, 0x33, 0x2e, 0x2e, 0x2b, 0x2d, 0x2d, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x2e, 0x30, 0x35, 0x30, 0x3a, 0x39, 0xa8, 0xb6, 0x4a,
-    0x3d, 0x36, 0x30, 0x37, 0x35, 0x42, 0x36, 0x37, 0x37, 0x37, 0x37, 0x39,
-    0x3e, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x48, 0x50, 0x68, 0xcf, 0xb6, 0x57,
-    0x4b, 0x4b, 0x51, 0x51, 0x57, 0x8a, 0xd6, 0xb8, 0x7c, 0x61, 0x62, 0x6f,
-    0x7c, 0x93, 0xb5, 0xe0, 0xee, 0xf0, 0xe3, 0xbf, 0xa3, 0xb6, 0xc6, 0x78,
-    0x69, 0x5e, 0x58, 0x51, 0x50, 0x4b, 0x48, 0x48, 0x48, 0x46, 0x41, 0x3e,
-    0x37, 0x37, 0x37, 0x42, 0x42, 0x35, 0x30, 0x2f, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x27, 0x27, 0x27, 0x24, 0x20, 0x24, 0x1f, 0x1f, 0x22, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1c, 0x1c, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x18, 0x17, 0x15, 0x15,
-    0x15, 0x15, 0x12, 0x12, 0x15, 0x15, 0x12, 0x12, 0x11, 0x11, 0x11, 0x12,
-    0x12, 0x12, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0d,
-    0x0e, 0x0e, 0x0f, 0x0f, 0x0c, 0x0c, 0x0f, 0x0b, 0x0b, 0x0e, 0x0c, 0x0b,
-    0x18, 0x53, 0x29, 0x16, 0x17, 0x19, 0x67, 0x83, 0x17, 0x0b, 0x0b, 0x0f,
-    0x0d, 0x15, 0x17, 0x81, 0x47, 0x0f, 0x0a, 0x0b, 0x2c, 0x27, 0x2c, 0x27,
-    0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x23, 0x23, 0x24, 0x24, 0x24, 0x23, 0x25, 0x27, 0x27,
-    0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x23, 0x23,
-    0x23, 0x24, 0x23, 0x23, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2c, 0x27, 0x2c, 0x2b,
-    0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x2c, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b,
-    0x33, 0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2d, 0x2b, 0x2e, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x3a, 0x39, 0x9f, 0xc6, 0x6b, 0x41, 0x36, 0x38, 0x35,
-    0x37, 0x36, 0x42, 0x36, 0x36, 0x37, 0x37, 0x39, 0x3e, 0x3e, 0x3b, 0x3b,
-    0x3e, 0x3d, 0x43, 0x49, 0x78, 0xd5, 0x97, 0x58, 0x4f, 0x4b, 0x50, 0x54,
-    0x53, 0x71, 0x9d, 0xb3, 0x8a, 0x5e, 0x62, 0x62, 0x6f, 0x84, 0xaa, 0xd6,
-    0xed, 0xf0, 0xe6, 0xd4, 0xc8, 0xd0, 0x9a, 0x6f, 0x62, 0x5e, 0x5a, 0x58,
-    0x57, 0x50, 0x4b, 0x49, 0x49, 0x48, 0x46, 0x41, 0x3e, 0x39, 0x37, 0x37,
-    0x37, 0x35, 0x30, 0x30, 0x2f, 0x2e, 0x2d, 0x2b, 0x2a, 0x27, 0x27, 0x27,
-    0x24, 0x24, 0x24, 0x20, 0x1f, 0x1f, 0x1f, 0x22, 0x1d, 0x1d, 0x1d, 0x1c,
-    0x1c, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x15, 0x15, 0x15, 0x15, 0x12, 0x12,
-    0x15, 0x12, 0x12, 0x12, 0x11, 0x12, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11,
-    0x11, 0x0d, 0x0d, 0x11, 0x0d, 0x0d, 0x0c, 0x0f, 0x0e, 0x0b, 0x0f, 0x0f,
-    0x0c, 0x0b, 0x0b, 0x0b, 0x0a, 0x0b, 0x11, 0x0c, 0x17, 0x64, 0x2c, 0x17,
-    0x1f, 0x66, 0x94, 0x5c, 0x12, 0x0f, 0x0e, 0x0d, 0x11, 0x15, 0x67, 0xa4,
-    0x1e, 0x11, 0x0b, 0x09, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x23, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x27, 0x23,
-    0x23, 0x24, 0x24, 0x23, 0x25, 0x25, 0x27, 0x25, 0x23, 0x24, 0x24, 0x24,
-    0x24, 0x24, 0x24, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x25, 0x23, 0x25,
-    0x25, 0x27, 0x27, 0x25, 0x25, 0x27, 0x25, 0x25, 0x25, 0x27, 0x25, 0x25,
-    0x25, 0x27, 0x27, 0x2a, 0x27, 0x27, 0x27, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2b,
-    0x2b, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2d, 0x2d, 0x2e, 0x2e, 0x2e, 0x33,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3f,
-    0x3b, 0x74, 0xa9, 0xca, 0x87, 0x43, 0x37, 0x30, 0x36, 0x42, 0x35, 0x42,
-    0x37, 0x37, 0x37, 0x39, 0x3e, 0x3b, 0x3b, 0x41, 0x3b, 0x41, 0x48, 0x4b,
-    0x8d, 0xe3, 0x9a, 0x5d, 0x50, 0x4b, 0x51, 0x54, 0x57, 0x58, 0x68, 0xba,
-    0x7f, 0x5e, 0x62, 0x62, 0x6e, 0x7c, 0x9b, 0xc8, 0xe7, 0xef, 0xee, 0xe8,
-    0xe0, 0xbe, 0x95, 0x7c, 0x6e, 0x62, 0x61, 0x5a, 0x58, 0x57, 0x51, 0x4f,
-    0x49, 0x48, 0x43, 0x41, 0x41, 0x3b, 0x39, 0x37, 0x37, 0x42, 0x35, 0x30,
-    0x30, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2a, 0x25, 0x25, 0x24, 0x23, 0x24,
-    0x20, 0x1f, 0x1f, 0x1f, 0x1d, 0x1d, 0x1d, 0x1c, 0x1b, 0x1c, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x15,
-    0x17, 0x17, 0x15, 0x15, 0x15, 0x15, 0x12, 0x15, 0x15, 0x12, 0x12, 0x11,
-    0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0d, 0x0d, 0x0d, 0x0f, 0x0d, 0x0d,
-    0x0d, 0x0d, 0x0d, 0x0c, 0x0b, 0x0b, 0x0d, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0a, 0x0b, 0x0b, 0x0b, 0x17, 0x6b, 0x2c, 0x22, 0x81, 0x7b, 0x3c, 0x18,
-    0x0c, 0x0b, 0x0b, 0x0d, 0x1d, 0x75, 0x9a, 0x4d, 0x15, 0x0d, 0x09, 0x0b,
-    0x27, 0x27, 0x2c, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25,
-    0x23, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2c,
-    0x27, 0x27, 0x27, 0x27, 0x23, 0x25, 0x27, 0x23, 0x23, 0x24, 0x24, 0x23,
-    0x23, 0x25, 0x25, 0x24, 0x24, 0x20, 0x20, 0x24, 0x23, 0x23, 0x24, 0x1f,
-    0x1f, 0x20, 0x24, 0x24, 0x24, 0x23, 0x23, 0x23, 0x25, 0x25, 0x25, 0x23,
-    0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x25, 0x25, 0x25, 0x27, 0x27, 0x2c,
-    0x2c, 0x27, 0x27, 0x2a, 0x2d, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x33,
-    0x33, 0x2b, 0x2b, 0x2b, 0x2b, 0x33, 0x2e, 0x2b, 0x2a, 0x2c, 0x27, 0x27,
-    0x2a, 0x2a, 0x2a, 0x27, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d,
-    0x2e, 0x2b, 0x2a, 0x2c, 0x2d, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x3a, 0x37, 0x52, 0x6d, 0x4f, 0x91,
-    0xcd, 0x7b, 0x3e, 0x37, 0x36, 0x42, 0x35, 0x42, 0x37, 0x37, 0x37, 0x39,
-    0x3b, 0x3b, 0x3e, 0x41, 0x39, 0x3b, 0x48, 0x50, 0xa1, 0xe2, 0xb4, 0x60,
-    0x51, 0x49, 0x50, 0x50, 0x4f, 0x58, 0x74, 0xb5, 0x74, 0x5e, 0x62, 0x62,
-    0x69, 0x77, 0x8e, 0xb0, 0xdd, 0xe8, 0xf0, 0xf0, 0xe8, 0xcb, 0xa6, 0x84,
-    0x6f, 0x62, 0x5e, 0x5e, 0x5d, 0x57, 0x51, 0x50, 0x49, 0x48, 0x48, 0x43,
-    0x41, 0x3b, 0x3e, 0x37, 0x37, 0x36, 0x35, 0x30, 0x30, 0x30, 0x2e, 0x2d,
-    0x2b, 0x2b, 0x2c, 0x25, 0x23, 0x24, 0x24, 0x24, 0x20, 0x20, 0x1f, 0x1f,
-    0x22, 0x1d, 0x1d, 0x1c, 0x1c, 0x1b, 0x1b, 0x1b, 0x19, 0x1b, 0x1b, 0x19,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x15, 0x15, 0x15, 0x15, 0x15,
-    0x12, 0x13, 0x13, 0x15, 0x15, 0x12, 0x12, 0x11, 0x12, 0x12, 0x12, 0x12,
-    0x12, 0x12, 0x0d, 0x11, 0x0f, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0c,
-    0x0b, 0x0b, 0x0d, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0e, 0x12,
-    0x28, 0x79, 0x24, 0x28, 0x9f, 0x32, 0x16, 0x0c, 0x10, 0x0b, 0x0a, 0x0d,
-    0x5c, 0xa8, 0x2b, 0x15, 0x11, 0x11, 0x0d, 0x0b, 0x27, 0x27, 0x27, 0x2c,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x25, 0x23, 0x24, 0x23, 0x23, 0x23, 0x23, 0x25, 0x24,
-    0x20, 0x20, 0x20, 0x24, 0x23, 0x23, 0x24, 0x1f, 0x1f, 0x20, 0x20, 0x24,
-    0x20, 0x23, 0x23, 0x25, 0x23, 0x23, 0x23, 0x23, 0x25, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x23, 0x25, 0x25, 0x25, 0x27, 0x2c, 0x27, 0x27, 0x2c, 0x2c,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2d, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x2c, 0x2c, 0x2b, 0x2b, 0x2d, 0x2d, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2d, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e,
-    0x2b, 0x2e, 0x33, 0x2e, 0x2e, 0x30, 0x2e, 0x30, 0x30, 0x30, 0x35, 0x30,
-    0x30, 0x3a, 0x3e, 0x53, 0x57, 0x41, 0x41, 0x48, 0xb9, 0xac, 0x43, 0x3b,
-    0x36, 0x35, 0x35, 0x42, 0x37, 0x37, 0x37, 0x39, 0x39, 0x3b, 0x3b, 0x3b,
-    0x3e, 0x41, 0x46, 0x4f, 0x6a, 0xc4, 0xe4, 0x85, 0x54, 0x52, 0x50, 0x54,
-    0x51, 0x54, 0x9b, 0x8a, 0x5d, 0x5b, 0x5e, 0x62, 0x62, 0x6f, 0x80, 0x99,
-    0xbe, 0xe1, 0xeb, 0xef, 0xee, 0xdd, 0xb8, 0x95, 0x77, 0x6f, 0x62, 0x5e,
-    0x58, 0x57, 0x54, 0x4f, 0x49, 0x49, 0x48, 0x43, 0x4a, 0x41, 0x3b, 0x39,
-    0x37, 0x36, 0x35, 0x35, 0x30, 0x30, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x27,
-    0x25, 0x23, 0x23, 0x23, 0x20, 0x20, 0x1f, 0x1f, 0x22, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18,
-    0x17, 0x17, 0x15, 0x15, 0x12, 0x15, 0x15, 0x15, 0x15, 0x12, 0x12, 0x12,
-    0x12, 0x12, 0x12, 0x11, 0x12, 0x11, 0x12, 0x11, 0x11, 0x0d, 0x0d, 0x11,
-    0x0d, 0x0d, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0c, 0x0c, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0d, 0x08, 0x0d, 0x1b, 0x6b, 0x56, 0x18, 0x3f,
-    0x98, 0x19, 0x11, 0x0b, 0x0b, 0x0b, 0x0d, 0x11, 0x47, 0x81, 0x18, 0x12,
-    0x11, 0x0e, 0x0b, 0x0b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x25,
-    0x24, 0x24, 0x25, 0x25, 0x24, 0x23, 0x25, 0x24, 0x24, 0x20, 0x20, 0x20,
-    0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24,
-    0x23, 0x25, 0x25, 0x24, 0x25, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x25,
-    0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x2a, 0x2d, 0x2b, 0x2a, 0x2c, 0x2b, 0x2a, 0x27, 0x27, 0x2c, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x2c,
-    0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x2d,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x33,
-    0x30, 0x30, 0x2e, 0x33, 0x33, 0x30, 0x2e, 0x2e, 0x2e, 0x37, 0x63, 0x51,
-    0x37, 0x37, 0x39, 0x48, 0x98, 0xdc, 0x8f, 0x41, 0x37, 0x35, 0x35, 0x35,
-    0x36, 0x37, 0x37, 0x37, 0x39, 0x3e, 0x3d, 0x41, 0x41, 0x41, 0x46, 0x4b,
-    0x54, 0xbc, 0xdc, 0x7a, 0x54, 0x50, 0x4f, 0x50, 0x54, 0x78, 0x88, 0x5d,
-    0x5b, 0x5a, 0x61, 0x61, 0x62, 0x6f, 0x77, 0x84, 0xba, 0xdb, 0xe4, 0xef,
-    0xed, 0xda, 0xbb, 0xa6, 0x88, 0x77, 0x5e, 0x5e, 0x5b, 0x58, 0x57, 0x50,
-    0x52, 0x49, 0x48, 0x48, 0x43, 0x41, 0x3b, 0x39, 0x39, 0x37, 0x42, 0x42,
-    0x35, 0x30, 0x2e, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2c, 0x25, 0x23, 0x23,
-    0x24, 0x1f, 0x1f, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1c, 0x1b,
-    0x1b, 0x1b, 0x19, 0x18, 0x18, 0x19, 0x18, 0x18, 0x17, 0x15, 0x15, 0x15,
-    0x12, 0x15, 0x16, 0x16, 0x15, 0x12, 0x12, 0x11, 0x12, 0x11, 0x11, 0x12,
-    0x12, 0x11, 0x11, 0x12, 0x11, 0x0d, 0x0d, 0x11, 0x11, 0x0d, 0x0d, 0x0d,
-    0x0d, 0x11, 0x11, 0x11, 0x0d, 0x0f, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x07, 0x17, 0x4e, 0x66, 0x1b, 0x15, 0x3f, 0x9f, 0x19, 0x11, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0f, 0x47, 0x98, 0x17, 0x11, 0x0b, 0x0d, 0x09, 0x0b,
-    0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x24, 0x25, 0x25,
-    0x24, 0x23, 0x25, 0x23, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x20, 0x24, 0x24, 0x24, 0x25, 0x24,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x23, 0x23, 0x23, 0x27, 0x25, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2b, 0x2d, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x2b, 0x2b, 0x2b, 0x27, 0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2b, 0x2b, 0x2d, 0x2b,
-    0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x2a, 0x2c, 0x2b, 0x2e, 0x33, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x30, 0x2f, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2d, 0x2e,
-    0x30, 0x42, 0x37, 0x3e, 0x41, 0x58, 0x63, 0x3b, 0x3a, 0x35, 0x42, 0x48,
-    0x6a, 0xc4, 0xc6, 0x48, 0x37, 0x36, 0x36, 0x42, 0x36, 0x37, 0x37, 0x37,
-    0x39, 0x39, 0x39, 0x3b, 0x41, 0x41, 0x48, 0x50, 0x6c, 0xad, 0xdc, 0x85,
-    0x54, 0x50, 0x52, 0x49, 0x50, 0x82, 0x7f, 0x58, 0x57, 0x57, 0x5a, 0x62,
-    0x5e, 0x74, 0x8c, 0xaf, 0xc8, 0xc2, 0xe1, 0xee, 0xef, 0xe3, 0xc2, 0xa7,
-    0x9b, 0x93, 0x7f, 0x61, 0x5e, 0x60, 0x57, 0x50, 0x4f, 0x4b, 0x48, 0x48,
-    0x48, 0x41, 0x3b, 0x3e, 0x39, 0x37, 0x37, 0x36, 0x42, 0x3a, 0x33, 0x2e,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x27, 0x23, 0x23, 0x24, 0x21, 0x1f, 0x1f,
-    0x1f, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x19, 0x19,
-    0x18, 0x19, 0x18, 0x18, 0x17, 0x17, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
-    0x15, 0x12, 0x12, 0x11, 0x12, 0x12, 0x0d, 0x11, 0x12, 0x11, 0x12, 0x12,
-    0x0d, 0x0d, 0x11, 0x12, 0x11, 0x0d, 0x0d, 0x11, 0x0f, 0x0d, 0x11, 0x0d,
-    0x0f, 0x0b, 0x0f, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x0b, 0x1d, 0x63,
-    0x1f, 0x0f, 0x17, 0x75, 0x83, 0x12, 0x0c, 0x09, 0x09, 0x0b, 0x0c, 0x0d,
-    0x28, 0x98, 0x3f, 0x16, 0x11, 0x0b, 0x09, 0x0b, 0x27, 0x27, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x25, 0x27, 0x23, 0x24, 0x25, 0x25, 0x23, 0x24, 0x23, 0x23,
-    0x23, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x23, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2d, 0x2e, 0x2b,
-    0x2c, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2a, 0x2b, 0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x30, 0x30,
-    0x2e, 0x2f, 0x30, 0x30, 0x33, 0x30, 0x30, 0x42, 0x3b, 0x52, 0x68, 0x58,
-    0x53, 0x49, 0x37, 0x30, 0x42, 0x42, 0x3b, 0x6b, 0xa4, 0xc6, 0x83, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x36, 0x37, 0x36, 0x37, 0x39, 0x39, 0x39, 0x3b,
-    0x41, 0x41, 0x48, 0x4f, 0x58, 0x74, 0xda, 0xa4, 0x54, 0x49, 0x4f, 0x50,
-    0x50, 0x5d, 0x99, 0x6c, 0x57, 0x51, 0x5b, 0x5a, 0x88, 0xb3, 0xa9, 0x9b,
-    0x99, 0xaa, 0xdd, 0xea, 0xf0, 0xea, 0xdd, 0xb3, 0x95, 0x84, 0x77, 0x62,
-    0x62, 0x5e, 0x58, 0x51, 0x50, 0x50, 0x4b, 0x48, 0x48, 0x46, 0x3b, 0x3b,
-    0x3e, 0x37, 0x37, 0x37, 0x36, 0x35, 0x30, 0x33, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2c, 0x25, 0x23, 0x24, 0x20, 0x20, 0x1f, 0x1f, 0x22, 0x22, 0x22,
-    0x1d, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x18, 0x19, 0x18, 0x18,
-    0x17, 0x17, 0x16, 0x16, 0x16, 0x15, 0x15, 0x15, 0x15, 0x12, 0x12, 0x12,
-    0x11, 0x11, 0x0d, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x0d, 0x0d, 0x11, 0x12,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0b, 0x0f, 0x0d, 0x0d, 0x0b, 0x0b, 0x0d, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x11, 0x1f, 0x64, 0x15, 0x11, 0x20, 0xa4,
-    0x5c, 0x11, 0x0d, 0x0b, 0x0b, 0x09, 0x0b, 0x0c, 0x15, 0x4c, 0x82, 0x75,
-    0x29, 0x11, 0x0d, 0x0b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25,
-    0x23, 0x24, 0x25, 0x25, 0x23, 0x24, 0x23, 0x23, 0x23, 0x24, 0x24, 0x24,
-    0x20, 0x20, 0x20, 0x23, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x24, 0x24, 0x23, 0x24, 0x23, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x23,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2b, 0x2b,
-    0x2c, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2e, 0x2b, 0x2a, 0x2a, 0x2b, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x33, 0x2e, 0x2e, 0x2e, 0x33, 0x2e,
-    0x30, 0x42, 0x48, 0x51, 0x5d, 0x63, 0x48, 0x3e, 0x36, 0x30, 0x30, 0x30,
-    0x3a, 0x3d, 0x59, 0xc4, 0xbd, 0x72, 0x46, 0x3e, 0x36, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x39, 0x39, 0x39, 0x37, 0x3e, 0x41, 0x41, 0x48, 0x49,
-    0x51, 0x57, 0xd3, 0xb1, 0x68, 0x49, 0x49, 0x50, 0x51, 0x63, 0x96, 0x71,
-    0x57, 0x5d, 0x5e, 0x92, 0xc3, 0x9d, 0x6c, 0x6f, 0x84, 0xa0, 0xc3, 0xe2,
-    0xed, 0xef, 0xea, 0xcd, 0xa7, 0x84, 0x77, 0x6f, 0x62, 0x61, 0x5d, 0x57,
-    0x51, 0x50, 0x4b, 0x49, 0x48, 0x43, 0x41, 0x3b, 0x3b, 0x39, 0x37, 0x37,
-    0x37, 0x35, 0x30, 0x30, 0x2e, 0x33, 0x2d, 0x2b, 0x2b, 0x2a, 0x27, 0x23,
-    0x24, 0x24, 0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x1f, 0x1d, 0x1d, 0x1c, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x18, 0x18, 0x18, 0x17, 0x17, 0x16, 0x16,
-    0x17, 0x17, 0x15, 0x15, 0x13, 0x12, 0x12, 0x12, 0x11, 0x12, 0x11, 0x11,
-    0x0d, 0x11, 0x12, 0x12, 0x0d, 0x0d, 0x0d, 0x11, 0x11, 0x0d, 0x0d, 0x0d,
-    0x0b, 0x0b, 0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0f, 0x21, 0x53, 0x11, 0x0d, 0x3f, 0xb4, 0x27, 0x15, 0x0f, 0x09,
-    0x0d, 0x0a, 0x0a, 0x0a, 0x0b, 0x13, 0x28, 0x75, 0x8d, 0x5f, 0x23, 0x18,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x23, 0x25, 0x25,
-    0x23, 0x24, 0x28, 0x23, 0x25, 0x23, 0x23, 0x24, 0x24, 0x24, 0x24, 0x23,
-    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x23, 0x23, 0x24,
-    0x23, 0x27, 0x27, 0x27, 0x27, 0x23, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2c, 0x2e, 0x2e, 0x2a,
-    0x2b, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2d, 0x2e, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x33, 0x2e, 0x2e, 0x30, 0x2f, 0x2d, 0x2e, 0x35, 0x3b, 0x57, 0x4f,
-    0x3b, 0x35, 0x30, 0x30, 0x35, 0x39, 0x41, 0x59, 0x48, 0x6b, 0x9a, 0xd4,
-    0x6b, 0x41, 0x39, 0x37, 0x35, 0x42, 0x37, 0x37, 0x39, 0x37, 0x37, 0x39,
-    0x39, 0x39, 0x37, 0x3e, 0x41, 0x46, 0x46, 0x48, 0x4b, 0x54, 0xda, 0xa8,
-    0x68, 0x4b, 0x49, 0x49, 0x50, 0x60, 0x92, 0x74, 0x6c, 0x74, 0x8c, 0xa3,
-    0x84, 0x5e, 0x62, 0x6f, 0x7c, 0x8a, 0xa7, 0xcb, 0xe5, 0xee, 0xef, 0xe2,
-    0xbf, 0x95, 0x80, 0x6f, 0x62, 0x61, 0x60, 0x57, 0x57, 0x51, 0x4f, 0x49,
-    0x48, 0x43, 0x41, 0x41, 0x3b, 0x3b, 0x39, 0x37, 0x37, 0x35, 0x35, 0x30,
-    0x30, 0x33, 0x2d, 0x2e, 0x2b, 0x2b, 0x27, 0x25, 0x23, 0x24, 0x20, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x22, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x19, 0x18, 0x18, 0x18, 0x17, 0x17, 0x16, 0x16, 0x17, 0x17, 0x15, 0x15,
-    0x12, 0x12, 0x15, 0x15, 0x12, 0x12, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11,
-    0x0d, 0x0f, 0x11, 0x11, 0x11, 0x0d, 0x0d, 0x11, 0x0d, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0d, 0x0d, 0x0f, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x1b, 0x63,
-    0x19, 0x0b, 0x24, 0x7b, 0x6a, 0x42, 0x3c, 0x16, 0x0d, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0d, 0x0b, 0x18, 0x4c, 0x70, 0x71, 0x56, 0x27, 0x2c, 0x2c, 0x27,
-    0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x25, 0x23, 0x25, 0x27, 0x25, 0x23, 0x28, 0x28, 0x23,
-    0x25, 0x25, 0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x25, 0x23, 0x23, 0x27, 0x27, 0x27,
-    0x27, 0x23, 0x25, 0x25, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2d, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x30, 0x30, 0x30, 0x30, 0x37, 0x46, 0x3e, 0x42, 0x2d, 0x2b, 0x30, 0x36,
-    0x56, 0x98, 0xa1, 0x8d, 0xa4, 0xa5, 0x92, 0xca, 0x6b, 0x3b, 0x36, 0x35,
-    0x35, 0x36, 0x37, 0x36, 0x37, 0x37, 0x37, 0x39, 0x39, 0x39, 0x37, 0x3e,
-    0x41, 0x41, 0x41, 0x43, 0x49, 0x51, 0xd1, 0xa8, 0x54, 0x4b, 0x50, 0x49,
-    0x51, 0x6c, 0xa9, 0xb8, 0xb1, 0x92, 0x78, 0x5e, 0x5e, 0x69, 0x62, 0x62,
-    0x77, 0x80, 0x95, 0xb7, 0xdd, 0xed, 0xf0, 0xe4, 0xc2, 0xa6, 0x93, 0x84,
-    0x69, 0x5e, 0x5a, 0x5d, 0x57, 0x51, 0x50, 0x4b, 0x49, 0x48, 0x41, 0x41,
-    0x41, 0x3b, 0x39, 0x37, 0x37, 0x35, 0x35, 0x30, 0x30, 0x2e, 0x2e, 0x2e,
-    0x2b, 0x2a, 0x2c, 0x25, 0x24, 0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x1f, 0x22,
-    0x1d, 0x1d, 0x1c, 0x1b, 0x19, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x19,
-    0x18, 0x17, 0x16, 0x16, 0x17, 0x15, 0x15, 0x15, 0x12, 0x12, 0x15, 0x13,
-    0x13, 0x12, 0x12, 0x12, 0x11, 0x0d, 0x11, 0x11, 0x0d, 0x0b, 0x11, 0x11,
-    0x0d, 0x0f, 0x0b, 0x0f, 0x0b, 0x0f, 0x0b, 0x0f, 0x0f, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0f, 0x0b, 0x15, 0x52, 0x2c, 0x0b, 0x15, 0x1d,
-    0x33, 0x39, 0x79, 0x5c, 0x19, 0x0b, 0x0d, 0x0e, 0x0a, 0x0b, 0x08, 0x0b,
-    0x0d, 0x18, 0x28, 0x66, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x23, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25,
-    0x25, 0x27, 0x27, 0x25, 0x23, 0x24, 0x28, 0x23, 0x25, 0x25, 0x25, 0x24,
-    0x20, 0x20, 0x24, 0x20, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x24, 0x24, 0x25, 0x23, 0x25, 0x25, 0x27, 0x27, 0x27, 0x25, 0x23, 0x25,
-    0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x2d, 0x2e, 0x2b, 0x2b, 0x2a, 0x2b, 0x2e, 0x2e, 0x2b, 0x2d, 0x2e, 0x2b,
-    0x30, 0x39, 0x39, 0x39, 0x37, 0x36, 0x42, 0x36, 0x35, 0x30, 0x30, 0x42,
-    0x37, 0x37, 0x31, 0x33, 0x31, 0x31, 0x39, 0x72, 0x96, 0x79, 0x48, 0x3e,
-    0x41, 0x41, 0x48, 0xb6, 0xa8, 0x41, 0x37, 0x3a, 0x42, 0x37, 0x37, 0x42,
-    0x37, 0x37, 0x37, 0x37, 0x39, 0x39, 0x3e, 0x3b, 0x41, 0x3b, 0x3b, 0x43,
-    0x49, 0x68, 0xd7, 0xa4, 0x51, 0x50, 0x49, 0x50, 0x58, 0x78, 0xc1, 0xa9,
-    0x58, 0x57, 0x5a, 0x5e, 0x5e, 0x5e, 0x62, 0x62, 0x6f, 0x80, 0x8e, 0xb0,
-    0xd0, 0xe9, 0xf1, 0xe8, 0xc8, 0x9d, 0x84, 0x80, 0x7f, 0x69, 0x5e, 0x5a,
-    0x57, 0x54, 0x51, 0x4b, 0x49, 0x48, 0x48, 0x41, 0x41, 0x41, 0x3b, 0x39,
-    0x37, 0x42, 0x35, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2b, 0x2a, 0x27, 0x27,
-    0x25, 0x20, 0x20, 0x1f, 0x22, 0x1f, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b,
-    0x19, 0x19, 0x19, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x18, 0x17, 0x17, 0x15,
-    0x17, 0x17, 0x15, 0x15, 0x12, 0x12, 0x13, 0x13, 0x12, 0x13, 0x12, 0x13,
-    0x11, 0x0d, 0x11, 0x12, 0x0d, 0x0c, 0x11, 0x11, 0x0d, 0x0f, 0x0c, 0x0b,
-    0x0b, 0x0b, 0x0f, 0x0f, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0d, 0x0c, 0x3a, 0x52, 0x1d, 0x11, 0x09, 0x0c, 0x11, 0x27, 0x85,
-    0x7b, 0x66, 0x1c, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x15,
-    0x27, 0x27, 0x2c, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x27, 0x27, 0x27,
-    0x23, 0x23, 0x23, 0x25, 0x25, 0x25, 0x23, 0x24, 0x24, 0x24, 0x24, 0x20,
-    0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x23,
-    0x23, 0x23, 0x27, 0x27, 0x27, 0x23, 0x23, 0x27, 0x27, 0x27, 0x25, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2c, 0x2a, 0x2b,
-    0x2b, 0x2b, 0x2a, 0x2c, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2d, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2e, 0x2b, 0x2a,
-    0x2a, 0x2b, 0x2b, 0x2e, 0x42, 0x3b, 0x48, 0x52, 0x51, 0x5d, 0x6d, 0x6d,
-    0x5e, 0x5d, 0x5d, 0x69, 0x64, 0x6b, 0x79, 0x6b, 0x3b, 0x36, 0x42, 0x30,
-    0x39, 0x42, 0x70, 0xa9, 0x64, 0x3e, 0x30, 0x35, 0x35, 0x37, 0x41, 0x9e,
-    0xb1, 0x41, 0x42, 0x36, 0x35, 0x37, 0x42, 0x42, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x39, 0x39, 0x3b, 0x41, 0x3b, 0x41, 0x43, 0x4b, 0x7b, 0xe3, 0x8f,
-    0x58, 0x51, 0x5d, 0x5a, 0x6c, 0xa6, 0xc2, 0x78, 0x57, 0x57, 0x58, 0x5e,
-    0x5e, 0x61, 0x62, 0x62, 0x6f, 0x7c, 0x8e, 0xab, 0xcb, 0xe7, 0xf1, 0xea,
-    0xcd, 0x9d, 0x7c, 0x77, 0x7f, 0x76, 0x5e, 0x5d, 0x58, 0x57, 0x51, 0x4b,
-    0x4b, 0x49, 0x48, 0x4a, 0x41, 0x41, 0x3e, 0x39, 0x36, 0x42, 0x35, 0x30,
-    0x30, 0x30, 0x33, 0x2e, 0x2b, 0x2b, 0x2a, 0x2b, 0x27, 0x23, 0x24, 0x20,
-    0x1f, 0x1f, 0x1f, 0x22, 0x1d, 0x1d, 0x1d, 0x1b, 0x19, 0x19, 0x19, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x19, 0x18, 0x17, 0x17, 0x16, 0x17, 0x17, 0x16, 0x15,
-    0x15, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0x12, 0x11, 0x11, 0x12,
-    0x0d, 0x0f, 0x11, 0x0d, 0x0d, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0b,
-    0x0b, 0x0b, 0x0f, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x0f, 0x0b, 0x15,
-    0x45, 0x52, 0x2c, 0x11, 0x0a, 0x0d, 0x0b, 0x1d, 0x4c, 0x83, 0x81, 0x18,
-    0x09, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x27, 0x27, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x27, 0x25, 0x23, 0x23, 0x25, 0x25,
-    0x23, 0x23, 0x23, 0x23, 0x24, 0x24, 0x24, 0x20, 0x20, 0x24, 0x24, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x23, 0x24, 0x24, 0x23, 0x23, 0x25,
-    0x25, 0x25, 0x23, 0x25, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x2c, 0x2b, 0x2a, 0x2b, 0x2c, 0x27,
-    0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x2b, 0x2d, 0x2e, 0x2b,
-    0x2e, 0x2b, 0x2b, 0x2a, 0x2d, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e,
-    0x30, 0x3e, 0x48, 0x49, 0x49, 0x48, 0x41, 0x43, 0x48, 0x46, 0x46, 0x48,
-    0x53, 0x6a, 0x6a, 0x7f, 0x6a, 0x43, 0x49, 0x49, 0x48, 0x43, 0x83, 0xa4,
-    0x39, 0x38, 0x36, 0x30, 0x38, 0x36, 0x48, 0xbd, 0x83, 0x39, 0x39, 0x36,
-    0x35, 0x37, 0x42, 0x35, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39, 0x3e,
-    0x3b, 0x41, 0x41, 0x48, 0x4b, 0x79, 0xe3, 0x91, 0x5d, 0x53, 0x54, 0x78,
-    0xa9, 0xa9, 0x7c, 0x60, 0x57, 0x57, 0x58, 0x5a, 0x5e, 0x62, 0x62, 0x62,
-    0x6e, 0x7c, 0x8e, 0xb2, 0xd4, 0xe9, 0xf1, 0xe8, 0xc8, 0x9d, 0x80, 0x77,
-    0x69, 0x76, 0x69, 0x60, 0x58, 0x57, 0x51, 0x49, 0x49, 0x49, 0x48, 0x43,
-    0x41, 0x41, 0x3b, 0x39, 0x37, 0x36, 0x35, 0x30, 0x30, 0x30, 0x30, 0x2e,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x25, 0x25, 0x24, 0x20, 0x1f, 0x1f, 0x1f,
-    0x1d, 0x1d, 0x1d, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0x1b, 0x19,
-    0x18, 0x18, 0x17, 0x16, 0x18, 0x17, 0x17, 0x15, 0x15, 0x15, 0x12, 0x12,
-    0x12, 0x12, 0x12, 0x12, 0x12, 0x0d, 0x0d, 0x11, 0x0d, 0x0d, 0x11, 0x11,
-    0x0f, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0e, 0x0b, 0x0b, 0x15, 0x2c, 0x53, 0x3e,
-    0x17, 0x08, 0x0b, 0x11, 0x15, 0x3c, 0x8d, 0x1c, 0x09, 0x0b, 0x08, 0x09,
-    0x08, 0x08, 0x08, 0x09, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25,
-    0x27, 0x27, 0x27, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25,
-    0x23, 0x23, 0x27, 0x25, 0x23, 0x25, 0x27, 0x25, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x24, 0x20, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x25, 0x23, 0x23, 0x23, 0x25,
-    0x25, 0x23, 0x23, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x2c,
-    0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2b, 0x2c, 0x27, 0x2c, 0x2b, 0x2a, 0x2a,
-    0x2b, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2e, 0x2b, 0x2e, 0x33, 0x2d, 0x2b,
-    0x2b, 0x2d, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x30, 0x30, 0x2f, 0x2e,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x3a, 0x30, 0x30, 0x30, 0x35, 0x3e, 0x48,
-    0x71, 0x85, 0x82, 0x7f, 0x8a, 0x85, 0xa5, 0x96, 0x3e, 0x30, 0x2e, 0x30,
-    0x30, 0x37, 0x6b, 0xbe, 0x48, 0x37, 0x37, 0x36, 0x35, 0x42, 0x35, 0x35,
-    0x37, 0x37, 0x36, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x41, 0x41, 0x41, 0x43,
-    0x49, 0x68, 0xda, 0xbd, 0x74, 0x57, 0x85, 0xa9, 0x78, 0x54, 0x57, 0x5d,
-    0x57, 0x58, 0x5d, 0x5a, 0x5e, 0x62, 0x62, 0x6e, 0x6f, 0x7c, 0x95, 0xba,
-    0xe3, 0xef, 0xef, 0xe2, 0xbf, 0x9b, 0x84, 0x77, 0x6f, 0x6f, 0x6e, 0x6e,
-    0x5a, 0x57, 0x51, 0x50, 0x4b, 0x49, 0x48, 0x48, 0x43, 0x41, 0x3b, 0x39,
-    0x39, 0x37, 0x35, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2b, 0x2a, 0x2b, 0x2b,
-    0x2c, 0x27, 0x25, 0x24, 0x20, 0x1f, 0x1f, 0x1f, 0x1d, 0x1d, 0x1d, 0x1b,
-    0x19, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0x1b, 0x19, 0x18, 0x18, 0x18, 0x16,
-    0x17, 0x17, 0x16, 0x15, 0x15, 0x15, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
-    0x12, 0x0d, 0x0d, 0x11, 0x11, 0x0d, 0x0d, 0x0d, 0x0f, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x09, 0x0b, 0x0b, 0x09, 0x08, 0x23, 0x51, 0x46, 0x18, 0x0b, 0x0a,
-    0x11, 0x55, 0x70, 0x15, 0x0f, 0x0b, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x25, 0x23, 0x25, 0x23,
-    0x23, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x27, 0x25,
-    0x27, 0x27, 0x27, 0x23, 0x23, 0x24, 0x24, 0x23, 0x25, 0x24, 0x24, 0x24,
-    0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24,
-    0x24, 0x24, 0x23, 0x23, 0x23, 0x24, 0x23, 0x23, 0x25, 0x23, 0x23, 0x27,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2b, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c,
-    0x2c, 0x2a, 0x2b, 0x2b, 0x2e, 0x33, 0x2b, 0x2b, 0x2b, 0x2e, 0x33, 0x2e,
-    0x2e, 0x2a, 0x2a, 0x2a, 0x30, 0x2e, 0x2e, 0x2e, 0x2f, 0x2e, 0x30, 0x30,
-    0x35, 0x3a, 0x30, 0x30, 0x3a, 0x3a, 0x3a, 0x35, 0x3e, 0x59, 0x46, 0x41,
-    0x4a, 0x46, 0x66, 0x3e, 0x35, 0x35, 0x30, 0x30, 0x30, 0x3e, 0x70, 0xb1,
-    0x48, 0x39, 0x37, 0x42, 0x35, 0x36, 0x35, 0x42, 0x36, 0x37, 0x37, 0x36,
-    0x37, 0x37, 0x37, 0x3e, 0x41, 0x41, 0x41, 0x43, 0x48, 0x50, 0x89, 0xd3,
-    0xc4, 0x9d, 0x9f, 0x68, 0x51, 0x4f, 0x51, 0x51, 0x58, 0x5e, 0x5a, 0x5a,
-    0x61, 0x62, 0x62, 0x6e, 0x6f, 0x7c, 0x9b, 0xc2, 0xe7, 0xf0, 0xed, 0xe0,
-    0xbb, 0x9b, 0x80, 0x77, 0x6f, 0x62, 0x69, 0x69, 0x76, 0x6c, 0x58, 0x57,
-    0x51, 0x4b, 0x48, 0x48, 0x43, 0x41, 0x3b, 0x3b, 0x39, 0x37, 0x35, 0x30,
-    0x30, 0x2e, 0x30, 0x2f, 0x2b, 0x2a, 0x2c, 0x2c, 0x2c, 0x25, 0x25, 0x23,
-    0x20, 0x20, 0x1f, 0x1f, 0x1d, 0x1d, 0x1d, 0x1b, 0x19, 0x19, 0x19, 0x1b,
-    0x1b, 0x1b, 0x19, 0x19, 0x18, 0x18, 0x18, 0x16, 0x17, 0x15, 0x15, 0x15,
-    0x12, 0x12, 0x11, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0d, 0x0f, 0x11,
-    0x11, 0x0d, 0x0f, 0x0c, 0x0f, 0x0b, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x09,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x08, 0x0b, 0x08,
-    0x08, 0x0b, 0x11, 0x17, 0x3a, 0x40, 0x0d, 0x0a, 0x13, 0x81, 0x47, 0x0f,
-    0x0e, 0x08, 0x08, 0x08, 0x09, 0x09, 0x08, 0x09, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x25, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x27, 0x27, 0x25,
-    0x25, 0x24, 0x23, 0x25, 0x25, 0x23, 0x23, 0x23, 0x23, 0x24, 0x24, 0x20,
-    0x20, 0x20, 0x20, 0x24, 0x24, 0x23, 0x24, 0x24, 0x24, 0x24, 0x23, 0x25,
-    0x25, 0x23, 0x24, 0x23, 0x25, 0x25, 0x23, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2b, 0x2a, 0x2b, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x30, 0x30, 0x35, 0x35, 0x30, 0x30, 0x35,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x36, 0x48, 0xa9, 0x9a, 0x41, 0x42, 0x37,
-    0x37, 0x37, 0x42, 0x36, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39, 0x3e, 0x3b,
-    0x41, 0x41, 0x41, 0x43, 0x48, 0x49, 0x51, 0x94, 0xe3, 0xba, 0x68, 0x54,
-    0x50, 0x4f, 0x53, 0x57, 0x58, 0x5e, 0x5e, 0x5e, 0x5e, 0x62, 0x62, 0x6f,
-    0x6f, 0x80, 0x9d, 0xc8, 0xe8, 0xf0, 0xed, 0xdf, 0xba, 0x9b, 0x84, 0x77,
-    0x6f, 0x62, 0x61, 0x62, 0x5e, 0x6e, 0x6e, 0x69, 0x5d, 0x50, 0x49, 0x49,
-    0x48, 0x41, 0x41, 0x3b, 0x39, 0x37, 0x37, 0x36, 0x30, 0x30, 0x30, 0x30,
-    0x2e, 0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x25, 0x23, 0x20, 0x20, 0x20, 0x20,
-    0x22, 0x1d, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x18,
-    0x18, 0x1a, 0x18, 0x17, 0x17, 0x17, 0x16, 0x16, 0x15, 0x15, 0x11, 0x12,
-    0x12, 0x11, 0x12, 0x12, 0x11, 0x0d, 0x0d, 0x0d, 0x11, 0x0d, 0x0f, 0x0b,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0b, 0x0b, 0x0b, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x0b, 0x08, 0x0a, 0x0b, 0x0b, 0x0b,
-    0x15, 0x37, 0x46, 0x15, 0x18, 0x81, 0x28, 0x0a, 0x0b, 0x08, 0x0a, 0x08,
-    0x09, 0x08, 0x08, 0x09, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x23, 0x24, 0x23, 0x23,
-    0x23, 0x25, 0x23, 0x23, 0x24, 0x24, 0x24, 0x24, 0x20, 0x23, 0x24, 0x20,
-    0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x23, 0x20, 0x28,
-    0x25, 0x25, 0x23, 0x25, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x27, 0x27, 0x2b, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2d, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x33, 0x2e, 0x2e, 0x2e, 0x33,
-    0x2e, 0x2e, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x42, 0x37, 0x59, 0xb1, 0xad, 0x46, 0x37, 0x37, 0x37, 0x36, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x39, 0x3e, 0x3b, 0x3b, 0x41, 0x46, 0x43, 0x43,
-    0x48, 0x48, 0x4b, 0x71, 0xcf, 0xc9, 0x60, 0x58, 0x54, 0x51, 0x57, 0x57,
-    0x57, 0x58, 0x5a, 0x5e, 0x5e, 0x62, 0x62, 0x6f, 0x6f, 0x7c, 0x99, 0xbe,
-    0xe5, 0xf0, 0xee, 0xe1, 0xc1, 0xa6, 0x8a, 0x7c, 0x6f, 0x6f, 0x62, 0x62,
-    0x5e, 0x5e, 0x5e, 0x60, 0x57, 0x50, 0x49, 0x49, 0x48, 0x43, 0x3b, 0x3d,
-    0x39, 0x39, 0x39, 0x37, 0x35, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2b,
-    0x2c, 0x2c, 0x2c, 0x23, 0x24, 0x24, 0x20, 0x20, 0x22, 0x1d, 0x1d, 0x1c,
-    0x1b, 0x1b, 0x1c, 0x1b, 0x1b, 0x1b, 0x19, 0x18, 0x18, 0x1a, 0x18, 0x18,
-    0x17, 0x17, 0x15, 0x15, 0x15, 0x15, 0x12, 0x12, 0x12, 0x11, 0x12, 0x12,
-    0x11, 0x0d, 0x0d, 0x0d, 0x11, 0x11, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0b, 0x0b, 0x0a, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x0b, 0x0d, 0x0d, 0x17, 0x46, 0x2d,
-    0x22, 0x89, 0x1b, 0x0d, 0x0b, 0x0b, 0x0a, 0x0a, 0x09, 0x08, 0x08, 0x09,
-    0x23, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x23, 0x24, 0x24, 0x23, 0x23, 0x23, 0x24, 0x23,
-    0x23, 0x23, 0x24, 0x23, 0x24, 0x23, 0x24, 0x24, 0x20, 0x20, 0x24, 0x24,
-    0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x20, 0x28, 0x27, 0x25, 0x23, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c,
-    0x2c, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x33, 0x33, 0x30, 0x2e, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x30, 0x2f, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x30, 0x30, 0x35, 0x37, 0x3b,
-    0x70, 0xd1, 0x4f, 0x39, 0x37, 0x37, 0x36, 0x37, 0x37, 0x37, 0x37, 0x39,
-    0x39, 0x3e, 0x3b, 0x3e, 0x3b, 0x46, 0x48, 0x48, 0x43, 0x49, 0x4f, 0x68,
-    0xbd, 0xdd, 0x9a, 0x58, 0x57, 0x50, 0x50, 0x58, 0x57, 0x57, 0x5d, 0x5a,
-    0x5e, 0x61, 0x62, 0x62, 0x6f, 0x80, 0x93, 0xb0, 0xdd, 0xed, 0xf0, 0xe8,
-    0xcd, 0xb3, 0x99, 0x84, 0x77, 0x6f, 0x6f, 0x62, 0x61, 0x5e, 0x5d, 0x58,
-    0x57, 0x51, 0x49, 0x49, 0x48, 0x43, 0x41, 0x3b, 0x39, 0x39, 0x39, 0x37,
-    0x42, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x25,
-    0x24, 0x23, 0x24, 0x20, 0x22, 0x1d, 0x1d, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
-    0x1b, 0x1b, 0x19, 0x18, 0x19, 0x1a, 0x18, 0x18, 0x17, 0x17, 0x15, 0x15,
-    0x15, 0x12, 0x15, 0x15, 0x15, 0x12, 0x11, 0x11, 0x11, 0x0d, 0x0d, 0x11,
-    0x11, 0x11, 0x0d, 0x0d, 0x0d, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0c, 0x0d, 0x09, 0x2c, 0x46, 0x3e, 0x90, 0x15, 0x0e,
-    0x0b, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x08, 0x23, 0x23, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x27, 0x27, 0x27, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25,
-    0x23, 0x24, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x24, 0x24, 0x23, 0x23,
-    0x25, 0x23, 0x23, 0x24, 0x20, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20,
-    0x20, 0x24, 0x20, 0x24, 0x27, 0x25, 0x23, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x27, 0x2c, 0x2c, 0x2c, 0x27, 0x2a, 0x2a, 0x2c, 0x2d, 0x2e, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x33, 0x30, 0x30, 0x2e, 0x2b, 0x2b, 0x2d, 0x2b, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x30, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35,
-    0x30, 0x42, 0x3a, 0x30, 0x30, 0x42, 0x36, 0x39, 0x59, 0xbd, 0x83, 0x3e,
-    0x37, 0x37, 0x36, 0x37, 0x37, 0x37, 0x39, 0x37, 0x39, 0x3e, 0x3b, 0x3b,
-    0x41, 0x43, 0x48, 0x43, 0x43, 0x4b, 0x7e, 0xab, 0x91, 0xb1, 0xc9, 0x68,
-    0x57, 0x51, 0x54, 0x57, 0x58, 0x57, 0x5d, 0x5a, 0x5e, 0x61, 0x62, 0x62,
-    0x6f, 0x7c, 0x88, 0xa0, 0xc8, 0xe5, 0xee, 0xef, 0xe3, 0xc2, 0xa2, 0x8e,
-    0x7c, 0x77, 0x6f, 0x62, 0x61, 0x5e, 0x5a, 0x58, 0x57, 0x51, 0x4f, 0x4b,
-    0x49, 0x43, 0x41, 0x3b, 0x3b, 0x39, 0x3e, 0x37, 0x36, 0x3a, 0x30, 0x30,
-    0x2e, 0x2e, 0x2e, 0x2b, 0x2a, 0x2b, 0x2c, 0x25, 0x24, 0x24, 0x24, 0x20,
-    0x1f, 0x1d, 0x1d, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1b, 0x19, 0x18,
-    0x19, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x16, 0x15, 0x15, 0x15, 0x15,
-    0x12, 0x12, 0x12, 0x11, 0x12, 0x11, 0x0d, 0x11, 0x11, 0x0d, 0x0d, 0x0d,
-    0x0d, 0x0b, 0x0b, 0x0b, 0x08, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x08, 0x08,
-    0x0b, 0x0d, 0x15, 0x39, 0x6a, 0x90, 0x15, 0x0f, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x25, 0x23, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x25, 0x23, 0x23, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2b,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x29, 0x27, 0x27, 0x23, 0x23, 0x25, 0x23,
-    0x23, 0x25, 0x25, 0x23, 0x24, 0x24, 0x23, 0x23, 0x25, 0x23, 0x24, 0x24,
-    0x24, 0x24, 0x23, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x24, 0x20, 0x24,
-    0x25, 0x25, 0x23, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2c, 0x2a, 0x2b, 0x2b, 0x2a,
-    0x2a, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d,
-    0x30, 0x30, 0x2e, 0x2b, 0x2d, 0x2b, 0x2e, 0x2d, 0x30, 0x30, 0x33, 0x33,
-    0x2e, 0x2e, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x2f, 0x30, 0x30, 0x30, 0x35, 0x3a, 0x3a, 0x30, 0x35, 0x3a, 0x30,
-    0x35, 0x42, 0x35, 0x41, 0x41, 0xa8, 0x9f, 0x3b, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x39, 0x39, 0x39, 0x39, 0x3b, 0x3b, 0x3b, 0x41, 0x43, 0x43, 0x43,
-    0x48, 0x68, 0xd1, 0x97, 0x57, 0x7e, 0xd7, 0x94, 0x5e, 0x5b, 0x53, 0x5d,
-    0x5d, 0x5d, 0x5a, 0x5e, 0x61, 0x61, 0x62, 0x62, 0x6f, 0x77, 0x7c, 0x8e,
-    0xb5, 0xd9, 0xea, 0xf0, 0xea, 0xd4, 0xba, 0xa2, 0x84, 0x77, 0x6f, 0x62,
-    0x62, 0x61, 0x5a, 0x58, 0x57, 0x54, 0x50, 0x4f, 0x49, 0x48, 0x41, 0x3b,
-    0x3b, 0x39, 0x39, 0x3e, 0x37, 0x35, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2b,
-    0x2a, 0x2a, 0x27, 0x23, 0x20, 0x20, 0x24, 0x20, 0x1f, 0x22, 0x1d, 0x1d,
-    0x1c, 0x1c, 0x1d, 0x1d, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18,
-    0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x15, 0x15, 0x15, 0x12, 0x12, 0x12,
-    0x12, 0x11, 0x12, 0x12, 0x12, 0x11, 0x0d, 0x0f, 0x0f, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x08, 0x0b, 0x08, 0x0d, 0x0b, 0x18,
-    0x83, 0x90, 0x18, 0x09, 0x0b, 0x0b, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23,
-    0x25, 0x25, 0x27, 0x27, 0x27, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2a, 0x27, 0x27, 0x27, 0x27,
-    0x25, 0x27, 0x29, 0x27, 0x25, 0x25, 0x27, 0x23, 0x23, 0x25, 0x27, 0x23,
-    0x23, 0x24, 0x25, 0x23, 0x25, 0x23, 0x24, 0x24, 0x23, 0x23, 0x25, 0x23,
-    0x23, 0x23, 0x24, 0x24, 0x23, 0x24, 0x20, 0x23, 0x25, 0x25, 0x25, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x2c, 0x2a,
-    0x2c, 0x2a, 0x2a, 0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x33, 0x30, 0x2e, 0x2b,
-    0x2d, 0x2e, 0x2e, 0x33, 0x30, 0x30, 0x2f, 0x30, 0x2e, 0x2e, 0x33, 0x2e,
-    0x30, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x35, 0x35, 0x35, 0x30, 0x35, 0x3a, 0x30, 0x42, 0x37, 0x37, 0x3b,
-    0x7d, 0xb1, 0x4f, 0x3e, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x3b, 0x3b, 0x41, 0x41, 0x43, 0x43, 0x48, 0x4b, 0x7b, 0xbe, 0x71,
-    0x57, 0x5d, 0xad, 0xd1, 0x94, 0x60, 0x58, 0x5b, 0x58, 0x5a, 0x5e, 0x5e,
-    0x61, 0x62, 0x62, 0x61, 0x6f, 0x6f, 0x7c, 0x88, 0xa2, 0xc1, 0xe2, 0xee,
-    0xef, 0xe7, 0xd7, 0xb8, 0x99, 0x80, 0x77, 0x6f, 0x62, 0x62, 0x5e, 0x5d,
-    0x58, 0x54, 0x50, 0x50, 0x4b, 0x48, 0x41, 0x41, 0x3b, 0x3e, 0x3e, 0x3e,
-    0x37, 0x42, 0x35, 0x30, 0x30, 0x2e, 0x2e, 0x2d, 0x2b, 0x2d, 0x2b, 0x27,
-    0x24, 0x24, 0x24, 0x20, 0x1f, 0x1d, 0x1d, 0x1d, 0x1e, 0x1d, 0x1d, 0x1c,
-    0x1c, 0x1c, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x17, 0x15, 0x15, 0x15, 0x12, 0x12, 0x13, 0x12, 0x12, 0x12, 0x13,
-    0x11, 0x0d, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x09, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x08, 0x0b, 0x0b, 0x08, 0x0c, 0x0f, 0x18, 0x83, 0x9f, 0x39, 0x19,
-    0x13, 0x0b, 0x08, 0x08, 0x08, 0x07, 0x06, 0x06, 0x25, 0x27, 0x27, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x2b, 0x2b, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x27, 0x23, 0x23, 0x23, 0x25, 0x27, 0x27, 0x27, 0x23, 0x25,
-    0x27, 0x27, 0x24, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x27,
-    0x27, 0x2c, 0x27, 0x2c, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x25,
-    0x23, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x25, 0x23, 0x25, 0x23, 0x23,
-    0x25, 0x25, 0x23, 0x24, 0x23, 0x23, 0x24, 0x25, 0x23, 0x24, 0x24, 0x23,
-    0x25, 0x24, 0x24, 0x25, 0x27, 0x25, 0x23, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2c, 0x27, 0x27, 0x27,
-    0x2b, 0x2e, 0x2b, 0x2d, 0x2b, 0x2a, 0x2b, 0x2b, 0x2d, 0x2d, 0x2b, 0x2b,
-    0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x33, 0x2e, 0x2e, 0x33, 0x2f, 0x2f, 0x30,
-    0x2f, 0x33, 0x2e, 0x30, 0x33, 0x30, 0x33, 0x2e, 0x2e, 0x33, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x42, 0x36, 0x36,
-    0x30, 0x42, 0x37, 0x38, 0x42, 0x37, 0x37, 0x59, 0xaf, 0x6a, 0x48, 0x37,
-    0x39, 0x39, 0x37, 0x37, 0x39, 0x41, 0x3b, 0x3d, 0x39, 0x41, 0x3e, 0x41,
-    0x41, 0x4b, 0x4f, 0x50, 0x54, 0xb6, 0x8c, 0x50, 0x53, 0x57, 0x6c, 0xc3,
-    0xcf, 0x71, 0x58, 0x5a, 0x58, 0x60, 0x5e, 0x61, 0x61, 0x61, 0x62, 0x62,
-    0x6f, 0x6f, 0x77, 0x84, 0x95, 0xab, 0xc7, 0xe4, 0xee, 0xef, 0xea, 0xd1,
-    0xa7, 0x88, 0x7c, 0x6f, 0x6f, 0x62, 0x61, 0x5a, 0x57, 0x54, 0x51, 0x50,
-    0x4b, 0x48, 0x43, 0x41, 0x3b, 0x3b, 0x3e, 0x39, 0x37, 0x35, 0x35, 0x3a,
-    0x30, 0x2e, 0x2e, 0x33, 0x2e, 0x2b, 0x2b, 0x2c, 0x23, 0x24, 0x20, 0x24,
-    0x1f, 0x1f, 0x1f, 0x1d, 0x22, 0x1d, 0x1d, 0x1c, 0x1c, 0x1b, 0x19, 0x1b,
-    0x1b, 0x1b, 0x19, 0x18, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x16, 0x15,
-    0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x11, 0x0c, 0x0b,
-    0x0b, 0x0b, 0x0f, 0x0d, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x08, 0x08, 0x08, 0x0b, 0x0b, 0x0b, 0x09, 0x0b, 0x09,
-    0x08, 0x0d, 0x15, 0x3f, 0x97, 0x27, 0x48, 0x53, 0x51, 0x34, 0x15, 0x0b,
-    0x08, 0x06, 0x06, 0x07, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a,
-    0x2a, 0x2c, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x25,
-    0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x23, 0x25, 0x27, 0x27, 0x24, 0x25,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x25, 0x23, 0x25, 0x23, 0x23, 0x25, 0x27, 0x23, 0x24,
-    0x25, 0x25, 0x24, 0x25, 0x23, 0x24, 0x24, 0x25, 0x25, 0x24, 0x23, 0x25,
-    0x25, 0x23, 0x23, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2b, 0x2b,
-    0x2a, 0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x30, 0x33, 0x30, 0x2e, 0x33, 0x2e, 0x30,
-    0x33, 0x2e, 0x33, 0x2f, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x35, 0x3a, 0x35, 0x42, 0x3a, 0x30, 0x37, 0x37, 0x35,
-    0x42, 0x42, 0x37, 0x87, 0xa8, 0x43, 0x37, 0x37, 0x3e, 0x3b, 0x3b, 0x3b,
-    0x41, 0x41, 0x3b, 0x41, 0x3e, 0x41, 0x45, 0x46, 0x49, 0x64, 0x85, 0x96,
-    0xa3, 0xa2, 0x4f, 0x51, 0x51, 0x51, 0x5d, 0xc0, 0xd3, 0x74, 0x63, 0x58,
-    0x5d, 0x5a, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x77, 0x80,
-    0x8e, 0x9b, 0xb3, 0xcd, 0xe5, 0xf0, 0xee, 0xdc, 0xb5, 0x95, 0x80, 0x6f,
-    0x6f, 0x62, 0x61, 0x5e, 0x58, 0x57, 0x51, 0x50, 0x49, 0x48, 0x43, 0x41,
-    0x3b, 0x3b, 0x3b, 0x39, 0x36, 0x35, 0x35, 0x35, 0x30, 0x2e, 0x2e, 0x2e,
-    0x2b, 0x2b, 0x2b, 0x27, 0x23, 0x24, 0x20, 0x20, 0x20, 0x1f, 0x1f, 0x22,
-    0x1d, 0x1d, 0x1d, 0x1c, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19,
-    0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x16, 0x15, 0x13, 0x12, 0x12, 0x12,
-    0x12, 0x12, 0x12, 0x12, 0x11, 0x12, 0x0f, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x08,
-    0x08, 0x08, 0x0b, 0x0b, 0x0b, 0x0a, 0x09, 0x08, 0x0a, 0x11, 0x3f, 0x85,
-    0x5c, 0x15, 0x18, 0x1f, 0x24, 0x34, 0x3d, 0x27, 0x0b, 0x0a, 0x06, 0x08,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x25, 0x25, 0x25, 0x25, 0x23, 0x25, 0x25, 0x25, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x27, 0x25, 0x23, 0x25, 0x25, 0x23, 0x23,
-    0x24, 0x24, 0x24, 0x23, 0x25, 0x23, 0x23, 0x23, 0x27, 0x25, 0x25, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c,
-    0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x2c, 0x2b, 0x2a, 0x2a, 0x2a, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e,
-    0x33, 0x30, 0x30, 0x30, 0x2f, 0x30, 0x2f, 0x2e, 0x33, 0x2e, 0x2e, 0x30,
-    0x30, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35,
-    0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3a, 0x30, 0x37, 0x37, 0x41, 0xb6,
-    0x83, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x46, 0x46, 0x46, 0x48,
-    0x48, 0x48, 0x70, 0x8f, 0x97, 0x97, 0x7e, 0x64, 0x68, 0x54, 0x4b, 0x51,
-    0x50, 0x58, 0x78, 0xd3, 0xc3, 0x5e, 0x60, 0x5b, 0x5e, 0x5e, 0x5e, 0x61,
-    0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x77, 0x80, 0x88, 0x93, 0xa6, 0xbb,
-    0xe0, 0xec, 0xf0, 0xe5, 0xc1, 0xa0, 0x84, 0x77, 0x6f, 0x62, 0x62, 0x5e,
-    0x5a, 0x58, 0x57, 0x50, 0x4b, 0x48, 0x46, 0x41, 0x3b, 0x3b, 0x3b, 0x39,
-    0x37, 0x36, 0x35, 0x30, 0x30, 0x33, 0x2e, 0x2e, 0x2b, 0x2a, 0x2a, 0x27,
-    0x23, 0x24, 0x20, 0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1c, 0x1c, 0x1c, 0x1b, 0x1b, 0x1b, 0x19, 0x18, 0x19, 0x19, 0x18, 0x18,
-    0x18, 0x18, 0x17, 0x17, 0x15, 0x15, 0x15, 0x12, 0x12, 0x12, 0x12, 0x12,
-    0x12, 0x12, 0x11, 0x0d, 0x0b, 0x0b, 0x0f, 0x0f, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x08, 0x08, 0x09, 0x0b, 0x0b,
-    0x0b, 0x0a, 0x0c, 0x09, 0x0b, 0x13, 0x70, 0x73, 0x15, 0x0b, 0x0c, 0x0f,
-    0x09, 0x0b, 0x1c, 0x46, 0x3a, 0x0e, 0x08, 0x08, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25,
-    0x23, 0x23, 0x23, 0x25, 0x29, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x25, 0x23, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x25, 0x23, 0x27, 0x27, 0x23, 0x24, 0x24, 0x24, 0x24, 0x23,
-    0x23, 0x25, 0x23, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2a,
-    0x2a, 0x2c, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x33, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x33, 0x2e, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x35, 0x30, 0x30, 0x30,
-    0x30, 0x31, 0x36, 0x3e, 0x42, 0x41, 0x59, 0xba, 0x70, 0x46, 0x3b, 0x3b,
-    0x41, 0x3b, 0x41, 0x3b, 0x41, 0x43, 0x43, 0x49, 0x4b, 0x4f, 0xb5, 0x9d,
-    0x78, 0x4f, 0x48, 0x4b, 0x4f, 0x49, 0x4f, 0x50, 0x57, 0x6c, 0xb1, 0xdd,
-    0x89, 0x5a, 0x5e, 0x5e, 0x5e, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x6f,
-    0x6f, 0x6f, 0x77, 0x80, 0x8b, 0x95, 0xa2, 0xb8, 0xd9, 0xea, 0xf1, 0xe8,
-    0xc8, 0xa2, 0x84, 0x77, 0x6f, 0x62, 0x62, 0x5e, 0x5a, 0x5d, 0x57, 0x50,
-    0x4f, 0x49, 0x48, 0x41, 0x41, 0x41, 0x3b, 0x3e, 0x37, 0x37, 0x42, 0x30,
-    0x2f, 0x33, 0x2e, 0x2b, 0x2b, 0x2a, 0x2a, 0x2c, 0x23, 0x24, 0x20, 0x20,
-    0x20, 0x20, 0x1f, 0x1f, 0x22, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1b,
-    0x1b, 0x19, 0x19, 0x19, 0x1b, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17,
-    0x17, 0x15, 0x15, 0x12, 0x12, 0x12, 0x12, 0x11, 0x12, 0x11, 0x11, 0x0d,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0b, 0x0b, 0x0b, 0x0c, 0x0b, 0x0c, 0x0b, 0x0b,
-    0x0b, 0x09, 0x08, 0x08, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0d,
-    0x0b, 0x15, 0x7b, 0x83, 0x15, 0x0b, 0x0b, 0x0b, 0x09, 0x0b, 0x08, 0x1d,
-    0x52, 0x1d, 0x08, 0x08, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x24, 0x23, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2a, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23,
-    0x27, 0x27, 0x23, 0x23, 0x25, 0x25, 0x23, 0x25, 0x25, 0x27, 0x23, 0x25,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2a, 0x2a, 0x2b, 0x2a,
-    0x2b, 0x2e, 0x2b, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x33, 0x30, 0x2e, 0x2e, 0x2e, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e,
-    0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35,
-    0x35, 0x42, 0x42, 0x36, 0x42, 0x42, 0x42, 0x35, 0x3a, 0x37, 0x37, 0x37,
-    0x56, 0x89, 0xa5, 0x97, 0x48, 0x39, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x41, 0x41, 0x48, 0x51, 0x7e, 0xb1, 0x4f, 0x48, 0x48, 0x49, 0x4b,
-    0x49, 0x4b, 0x51, 0x54, 0x5b, 0x96, 0xdd, 0x9a, 0x5e, 0x5e, 0x5a, 0x5a,
-    0x5e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x77, 0x7c, 0x84,
-    0x8e, 0x99, 0xa7, 0xbb, 0xdf, 0xeb, 0xf1, 0xe9, 0xc7, 0xa6, 0x84, 0x77,
-    0x6f, 0x62, 0x61, 0x61, 0x5e, 0x5d, 0x57, 0x51, 0x50, 0x4b, 0x48, 0x48,
-    0x46, 0x41, 0x3b, 0x3e, 0x39, 0x37, 0x36, 0x30, 0x30, 0x30, 0x2e, 0x2e,
-    0x2e, 0x2b, 0x2b, 0x2a, 0x27, 0x23, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20,
-    0x22, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1c, 0x1b, 0x19, 0x19, 0x19, 0x19,
-    0x1b, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x15, 0x12,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x08, 0x08,
-    0x0b, 0x09, 0x0a, 0x0b, 0x0b, 0x0b, 0x09, 0x09, 0x1a, 0x66, 0x89, 0x1f,
-    0x0d, 0x09, 0x08, 0x08, 0x07, 0x09, 0x08, 0x0b, 0x38, 0x46, 0x0b, 0x08,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x25, 0x25, 0x27, 0x25, 0x24, 0x23, 0x27, 0x27, 0x27, 0x23, 0x25, 0x27,
-    0x27, 0x27, 0x2b, 0x2b, 0x2c, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x27, 0x25, 0x23, 0x25,
-    0x25, 0x27, 0x25, 0x25, 0x25, 0x27, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2a, 0x2b, 0x2b, 0x2c, 0x27, 0x2c, 0x2b, 0x2b, 0x2e, 0x2b,
-    0x2e, 0x2e, 0x2e, 0x2d, 0x2e, 0x30, 0x33, 0x2e, 0x30, 0x30, 0x2e, 0x33,
-    0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x42, 0x36, 0x36, 0x36, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x66, 0x9f, 0x9d, 0x6b, 0x48,
-    0x37, 0x39, 0x37, 0x39, 0x3e, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x49,
-    0x5e, 0x85, 0x94, 0x49, 0x48, 0x49, 0x49, 0x49, 0x49, 0x50, 0x50, 0x57,
-    0x68, 0xc3, 0xc0, 0x6c, 0x5a, 0x5a, 0x5e, 0x5b, 0x5e, 0x62, 0x61, 0x62,
-    0x62, 0x6f, 0x6f, 0x6f, 0x77, 0x7c, 0x80, 0x8b, 0x93, 0x99, 0xae, 0xc5,
-    0xe0, 0xec, 0xf1, 0xe9, 0xcd, 0xa7, 0x84, 0x77, 0x6f, 0x62, 0x62, 0x61,
-    0x5e, 0x58, 0x57, 0x54, 0x51, 0x50, 0x49, 0x48, 0x48, 0x46, 0x41, 0x3b,
-    0x39, 0x37, 0x36, 0x30, 0x30, 0x30, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b,
-    0x2c, 0x23, 0x24, 0x24, 0x20, 0x20, 0x24, 0x20, 0x1f, 0x1f, 0x22, 0x1d,
-    0x1c, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x19, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x15, 0x12, 0x11, 0x0d, 0x0d, 0x11,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x11, 0x0b, 0x0b, 0x0c, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x08, 0x0b, 0x09, 0x0a, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0c, 0x12, 0x67, 0x6b, 0x22, 0x09, 0x0b, 0x08, 0x09, 0x0a,
-    0x09, 0x08, 0x08, 0x09, 0x18, 0x46, 0x12, 0x08, 0x25, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x25,
-    0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2b, 0x2b,
-    0x2b, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x23, 0x25, 0x25,
-    0x25, 0x23, 0x25, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x23, 0x23, 0x25, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b,
-    0x2b, 0x2b, 0x2a, 0x2b, 0x2e, 0x2e, 0x33, 0x2f, 0x2e, 0x2e, 0x2e, 0x33,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x30, 0x30, 0x35, 0x35, 0x35, 0x30,
-    0x30, 0x35, 0x36, 0x42, 0x35, 0x35, 0x37, 0x37, 0x37, 0x37, 0x42, 0x35,
-    0x37, 0x3d, 0x3b, 0xa8, 0x7e, 0x48, 0x3b, 0x3b, 0x39, 0x3b, 0x3e, 0x3e,
-    0x39, 0x3d, 0x3b, 0x3b, 0x41, 0x43, 0x4f, 0x5e, 0x57, 0x79, 0x89, 0x49,
-    0x48, 0x48, 0x49, 0x49, 0x50, 0x4b, 0x57, 0x58, 0x78, 0xdd, 0xa4, 0x5e,
-    0x5e, 0x5a, 0x5e, 0x61, 0x62, 0x61, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x77,
-    0x77, 0x80, 0x8b, 0x95, 0x9c, 0xa9, 0xba, 0xce, 0xe4, 0xef, 0xf0, 0xeb,
-    0xcd, 0xae, 0x8c, 0x7f, 0x6f, 0x6f, 0x62, 0x61, 0x5e, 0x58, 0x57, 0x54,
-    0x50, 0x4f, 0x4b, 0x48, 0x4a, 0x41, 0x3b, 0x3b, 0x39, 0x37, 0x37, 0x42,
-    0x35, 0x35, 0x30, 0x2e, 0x2e, 0x2b, 0x2b, 0x27, 0x27, 0x27, 0x25, 0x24,
-    0x24, 0x20, 0x20, 0x20, 0x20, 0x1f, 0x1f, 0x1d, 0x1d, 0x1c, 0x1c, 0x1b,
-    0x19, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18,
-    0x18, 0x17, 0x15, 0x15, 0x11, 0x11, 0x11, 0x0d, 0x11, 0x11, 0x0d, 0x0d,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0b, 0x0b, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x0b, 0x0b, 0x17,
-    0x7b, 0x32, 0x0c, 0x0b, 0x0b, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0b,
-    0x11, 0x45, 0x20, 0x07, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x25, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x25, 0x23, 0x25, 0x23, 0x25, 0x25, 0x27, 0x27, 0x27,
-    0x25, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2a, 0x2c,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2b, 0x2c, 0x2c, 0x2b,
-    0x2b, 0x2b, 0x33, 0x33, 0x2e, 0x2e, 0x33, 0x30, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x33, 0x33, 0x33, 0x30, 0x2f, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x30, 0x30, 0x35, 0x42, 0x42,
-    0x42, 0x35, 0x37, 0x37, 0x37, 0x37, 0x42, 0x35, 0x37, 0x38, 0x66, 0xb6,
-    0x59, 0x41, 0x3b, 0x3e, 0x39, 0x39, 0x39, 0x3e, 0x3b, 0x3d, 0x3d, 0x3b,
-    0x43, 0x53, 0x5d, 0x4b, 0x48, 0x64, 0x8c, 0x50, 0x4b, 0x48, 0x49, 0x50,
-    0x51, 0x50, 0x57, 0x5b, 0x96, 0xe1, 0x96, 0x5e, 0x5e, 0x5e, 0x61, 0x62,
-    0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x77, 0x7c, 0x80, 0x88, 0x93, 0x9d,
-    0xb0, 0xba, 0xcb, 0xe2, 0xea, 0xf0, 0xee, 0xea, 0xdc, 0xb0, 0x8a, 0x7c,
-    0x77, 0x6f, 0x62, 0x61, 0x5e, 0x58, 0x57, 0x54, 0x50, 0x50, 0x4b, 0x48,
-    0x43, 0x41, 0x41, 0x3b, 0x39, 0x37, 0x37, 0x36, 0x35, 0x35, 0x30, 0x33,
-    0x2e, 0x2e, 0x2b, 0x2c, 0x2c, 0x27, 0x29, 0x25, 0x23, 0x24, 0x20, 0x20,
-    0x1f, 0x1f, 0x1f, 0x22, 0x1d, 0x1d, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x18,
-    0x19, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x17, 0x15, 0x15,
-    0x15, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0d, 0x11, 0x0d, 0x0d, 0x0d,
-    0x0b, 0x0b, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0e, 0x1d, 0x7b, 0x17, 0x0b, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0b, 0x0b, 0x1c, 0x31, 0x1c,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x25, 0x27, 0x29, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2a, 0x2a, 0x2a, 0x27, 0x2a, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x33, 0x2f, 0x30, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x35, 0x35, 0x37, 0x37,
-    0x37, 0x37, 0x36, 0x37, 0x39, 0x39, 0x5f, 0xb6, 0x6b, 0x3b, 0x3b, 0x37,
-    0x37, 0x39, 0x39, 0x3e, 0x3b, 0x3e, 0x43, 0x51, 0x63, 0x4f, 0x49, 0x46,
-    0x48, 0x4f, 0x85, 0x85, 0x51, 0x48, 0x4b, 0x54, 0x53, 0x52, 0x58, 0x5e,
-    0xc4, 0xc3, 0x6c, 0x5e, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f,
-    0x6f, 0x77, 0x7c, 0x80, 0x8a, 0x99, 0xa7, 0xba, 0xcb, 0xdd, 0xe5, 0xec,
-    0xf0, 0xed, 0xe5, 0xe2, 0xdc, 0xab, 0x84, 0x77, 0x6c, 0x62, 0x62, 0x61,
-    0x5a, 0x58, 0x57, 0x54, 0x50, 0x50, 0x4b, 0x49, 0x48, 0x43, 0x41, 0x3b,
-    0x39, 0x37, 0x37, 0x36, 0x35, 0x35, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2b,
-    0x2a, 0x2c, 0x2c, 0x29, 0x25, 0x23, 0x20, 0x20, 0x1f, 0x1f, 0x22, 0x1d,
-    0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x18, 0x19, 0x19, 0x19, 0x19,
-    0x1b, 0x19, 0x18, 0x18, 0x18, 0x17, 0x16, 0x15, 0x16, 0x15, 0x12, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x0d, 0x0f, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x0b, 0x15, 0x56, 0x70, 0x0d, 0x0d, 0x08, 0x0b, 0x09, 0x08, 0x08,
-    0x07, 0x08, 0x09, 0x0b, 0x0d, 0x08, 0x22, 0x3d, 0x23, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x33,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x42, 0x35, 0x42, 0x35, 0x3a, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x42, 0x35, 0x42, 0x37, 0x37, 0x37, 0x36, 0x37, 0x37,
-    0x39, 0x41, 0x5f, 0xb8, 0x59, 0x41, 0x3e, 0x37, 0x37, 0x39, 0x3b, 0x3b,
-    0x41, 0x4a, 0x50, 0x69, 0x4b, 0x48, 0x41, 0x41, 0x48, 0x49, 0x64, 0x9a,
-    0x68, 0x50, 0x49, 0x57, 0x57, 0x50, 0x5e, 0x78, 0xd5, 0xa4, 0x5e, 0x5e,
-    0x5e, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x77, 0x7c, 0x8b, 0x93,
-    0x9b, 0xae, 0xc2, 0xe0, 0xe6, 0xeb, 0xef, 0xf0, 0xeb, 0xe2, 0xd0, 0xdd,
-    0xdc, 0xa9, 0x80, 0x77, 0x6f, 0x62, 0x61, 0x61, 0x5a, 0x58, 0x57, 0x54,
-    0x51, 0x4f, 0x49, 0x49, 0x48, 0x43, 0x41, 0x41, 0x3e, 0x37, 0x37, 0x36,
-    0x35, 0x35, 0x35, 0x30, 0x2f, 0x2e, 0x2e, 0x2a, 0x2a, 0x2a, 0x2c, 0x2c,
-    0x25, 0x23, 0x24, 0x24, 0x1f, 0x1f, 0x22, 0x1d, 0x1d, 0x1b, 0x1c, 0x1b,
-    0x1c, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0x18, 0x18,
-    0x18, 0x18, 0x17, 0x15, 0x17, 0x16, 0x15, 0x15, 0x12, 0x12, 0x12, 0x12,
-    0x11, 0x0d, 0x0d, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0a, 0x08, 0x09, 0x0b, 0x0b, 0x0b, 0x0b, 0x2d, 0x71,
-    0x28, 0x09, 0x0b, 0x09, 0x0b, 0x08, 0x08, 0x07, 0x06, 0x08, 0x08, 0x0b,
-    0x0c, 0x07, 0x12, 0x40, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2a, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2e, 0x2e, 0x2a, 0x2c, 0x2d, 0x2b, 0x2d,
-    0x2e, 0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35,
-    0x3a, 0x42, 0x42, 0x3a, 0x42, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35,
-    0x42, 0x37, 0x37, 0x37, 0x36, 0x36, 0x37, 0x37, 0x39, 0x48, 0x9a, 0xa8,
-    0x43, 0x3b, 0x3e, 0x3d, 0x39, 0x3b, 0x3b, 0x46, 0x51, 0x5d, 0x5e, 0x53,
-    0x48, 0x46, 0x46, 0x43, 0x48, 0x49, 0x4f, 0xa5, 0x6a, 0x54, 0x49, 0x54,
-    0x57, 0x58, 0x6c, 0xa4, 0xdc, 0x96, 0x5e, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x6f, 0x6f, 0x6f, 0x77, 0x7c, 0x88, 0x95, 0xa2, 0xb2, 0xc7, 0xe1, 0xeb,
-    0xf0, 0xf0, 0xed, 0xe8, 0xe1, 0xc7, 0xb3, 0xd1, 0xe3, 0xa9, 0x7c, 0x6f,
-    0x6f, 0x62, 0x62, 0x5e, 0x5a, 0x57, 0x57, 0x54, 0x50, 0x4b, 0x4b, 0x49,
-    0x48, 0x48, 0x43, 0x41, 0x3b, 0x39, 0x37, 0x37, 0x42, 0x35, 0x35, 0x30,
-    0x2e, 0x2e, 0x2e, 0x2b, 0x2a, 0x2c, 0x2c, 0x2c, 0x27, 0x25, 0x23, 0x24,
-    0x1f, 0x1f, 0x1f, 0x22, 0x1d, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x1b, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17,
-    0x17, 0x17, 0x16, 0x15, 0x15, 0x12, 0x12, 0x11, 0x11, 0x0d, 0x0d, 0x0d,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x08, 0x08,
-    0x08, 0x09, 0x09, 0x0b, 0x0b, 0x0b, 0x3a, 0x7b, 0x18, 0x09, 0x06, 0x08,
-    0x09, 0x08, 0x08, 0x07, 0x06, 0x06, 0x08, 0x08, 0x07, 0x08, 0x0d, 0x24,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2c,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c,
-    0x2b, 0x2e, 0x2e, 0x2b, 0x2c, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x2f, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x42, 0x36,
-    0x42, 0x35, 0x30, 0x30, 0x30, 0x3a, 0x30, 0x35, 0x37, 0x37, 0x39, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x64, 0xca, 0x6b, 0x41, 0x3b, 0x3b, 0x3b,
-    0x41, 0x41, 0x4a, 0x48, 0x49, 0x49, 0x48, 0x41, 0x41, 0x46, 0x46, 0x48,
-    0x48, 0x48, 0x64, 0xa5, 0x53, 0x50, 0x50, 0x54, 0x57, 0x5a, 0xb1, 0xd9,
-    0xad, 0x6c, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x77, 0x7c,
-    0x84, 0x95, 0xa6, 0xb7, 0xcb, 0xe0, 0xea, 0xf0, 0xef, 0xe8, 0xe1, 0xcb,
-    0xc1, 0xb0, 0xa2, 0xb6, 0xe4, 0xc6, 0x8c, 0x77, 0x6f, 0x62, 0x62, 0x5e,
-    0x5a, 0x58, 0x57, 0x51, 0x4f, 0x4b, 0x4b, 0x49, 0x48, 0x48, 0x43, 0x41,
-    0x3e, 0x37, 0x37, 0x37, 0x35, 0x30, 0x35, 0x30, 0x30, 0x2e, 0x2b, 0x2b,
-    0x2c, 0x27, 0x2c, 0x2c, 0x2c, 0x27, 0x25, 0x23, 0x20, 0x1f, 0x1f, 0x22,
-    0x1d, 0x1d, 0x1d, 0x1b, 0x1b, 0x1c, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x18, 0x19, 0x19, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x16,
-    0x15, 0x12, 0x12, 0x12, 0x11, 0x11, 0x0d, 0x0d, 0x0b, 0x0c, 0x0c, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0a,
-    0x0b, 0x0b, 0x20, 0x85, 0x28, 0x0b, 0x07, 0x09, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x06, 0x07, 0x07, 0x08, 0x12, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b,
-    0x27, 0x23, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x23, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x27, 0x2b, 0x2a, 0x2b, 0x2a,
-    0x2a, 0x2b, 0x2e, 0x2b, 0x2b, 0x2d, 0x2e, 0x2e, 0x2e, 0x33, 0x30, 0x30,
-    0x30, 0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x42, 0x42, 0x35,
-    0x35, 0x35, 0x35, 0x35, 0x42, 0x37, 0x39, 0x39, 0x39, 0x37, 0x39, 0x3b,
-    0x41, 0x8f, 0xaf, 0x43, 0x41, 0x3b, 0x3b, 0x48, 0x52, 0x43, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x4a, 0x45, 0x46, 0x48, 0x43, 0x79, 0x92,
-    0x54, 0x51, 0x50, 0x57, 0x5d, 0x78, 0xda, 0xb1, 0x5e, 0x62, 0x61, 0x62,
-    0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x77, 0x7c, 0x84, 0x8e, 0xa2, 0xb8, 0xd6,
-    0xe4, 0xeb, 0xef, 0xf1, 0xe9, 0xe0, 0xc7, 0xb5, 0xa6, 0x99, 0x8e, 0x99,
-    0xcf, 0xe4, 0xca, 0x92, 0x77, 0x62, 0x61, 0x5e, 0x5e, 0x5b, 0x57, 0x54,
-    0x51, 0x4f, 0x49, 0x49, 0x48, 0x48, 0x46, 0x41, 0x3b, 0x37, 0x36, 0x36,
-    0x35, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b,
-    0x2c, 0x25, 0x27, 0x25, 0x24, 0x20, 0x1f, 0x22, 0x1d, 0x1c, 0x1d, 0x1d,
-    0x1c, 0x1c, 0x1b, 0x1b, 0x19, 0x18, 0x18, 0x18, 0x19, 0x19, 0x19, 0x18,
-    0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x16, 0x15, 0x13,
-    0x12, 0x0d, 0x0d, 0x0d, 0x0b, 0x0b, 0x0d, 0x0f, 0x0c, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x09, 0x08, 0x08, 0x08, 0x0b, 0x0c, 0x11, 0x24, 0x53,
-    0x39, 0x11, 0x09, 0x08, 0x08, 0x08, 0x0a, 0x08, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x07, 0x08, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x2c, 0x2c, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x25, 0x27, 0x27,
-    0x27, 0x2c, 0x2c, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2c,
-    0x2c, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2e, 0x2b,
-    0x2b, 0x2d, 0x2e, 0x2b, 0x2b, 0x2e, 0x2f, 0x33, 0x33, 0x30, 0x33, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x35, 0x35, 0x37, 0x42, 0x35, 0x35, 0x35, 0x42, 0x42,
-    0x36, 0x37, 0x39, 0x3d, 0x42, 0x39, 0x39, 0x41, 0x59, 0xb8, 0x70, 0x41,
-    0x3b, 0x41, 0x49, 0x51, 0x49, 0x43, 0x41, 0x3b, 0x3b, 0x41, 0x41, 0x41,
-    0x46, 0x48, 0x46, 0x43, 0x43, 0x49, 0x78, 0x92, 0x58, 0x53, 0x51, 0x5d,
-    0x85, 0xca, 0xc9, 0x92, 0x5e, 0x5e, 0x5e, 0x62, 0x62, 0x62, 0x6f, 0x6f,
-    0x77, 0x7c, 0x84, 0x93, 0x9b, 0xb3, 0xcb, 0xe3, 0xee, 0xef, 0xec, 0xe8,
-    0xdd, 0xc5, 0xb2, 0xa0, 0x93, 0x88, 0x80, 0x84, 0x9d, 0xbd, 0xdd, 0xdd,
-    0xb1, 0x7c, 0x69, 0x5e, 0x5a, 0x57, 0x54, 0x51, 0x50, 0x4b, 0x49, 0x49,
-    0x48, 0x48, 0x43, 0x41, 0x3b, 0x39, 0x37, 0x37, 0x42, 0x35, 0x30, 0x30,
-    0x30, 0x2f, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x27, 0x25, 0x25, 0x24,
-    0x20, 0x1f, 0x1f, 0x22, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1c, 0x1b, 0x1b,
-    0x19, 0x19, 0x18, 0x18, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x15, 0x15, 0x12, 0x11, 0x0d, 0x0f,
-    0x0c, 0x0d, 0x0d, 0x0d, 0x0f, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x09, 0x0b, 0x0b, 0x0c, 0x11, 0x1c, 0x30, 0x41, 0x39, 0x18, 0x0b,
-    0x08, 0x08, 0x08, 0x09, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2b,
-    0x2a, 0x2a, 0x2b, 0x2a, 0x2a, 0x2c, 0x27, 0x2c, 0x2c, 0x2c, 0x2c, 0x27,
-    0x25, 0x27, 0x2c, 0x2b, 0x2c, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x25,
-    0x27, 0x27, 0x2c, 0x2a, 0x2a, 0x27, 0x27, 0x2a, 0x2c, 0x2a, 0x2a, 0x27,
-    0x2c, 0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x27, 0x2c, 0x2c, 0x2b, 0x2c, 0x2c,
-    0x27, 0x27, 0x27, 0x27, 0x2b, 0x2d, 0x2e, 0x2b, 0x2b, 0x2d, 0x2e, 0x2b,
-    0x2b, 0x2e, 0x33, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x36, 0x36,
-    0x36, 0x37, 0x36, 0x42, 0x37, 0x42, 0x36, 0x37, 0x37, 0x37, 0x39, 0x3b,
-    0x39, 0x3b, 0x41, 0x64, 0xa3, 0x97, 0x48, 0x41, 0x41, 0x41, 0x4f, 0x50,
-    0x41, 0x41, 0x41, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x43,
-    0x48, 0x4b, 0x64, 0x9a, 0x68, 0x5d, 0x58, 0x78, 0xd1, 0xc0, 0x78, 0x6f,
-    0x61, 0x5e, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x77, 0x80, 0x8e, 0xa0,
-    0xb2, 0xc7, 0xe2, 0xec, 0xef, 0xeb, 0xe2, 0xd6, 0xc1, 0xb0, 0xa0, 0x93,
-    0x84, 0x7c, 0x77, 0x6f, 0x77, 0x80, 0x96, 0xca, 0xe4, 0xa3, 0x69, 0x61,
-    0x5e, 0x57, 0x57, 0x54, 0x50, 0x4f, 0x49, 0x49, 0x48, 0x48, 0x43, 0x41,
-    0x41, 0x3b, 0x39, 0x37, 0x37, 0x37, 0x42, 0x30, 0x30, 0x30, 0x2e, 0x2b,
-    0x2b, 0x2b, 0x2d, 0x2a, 0x27, 0x23, 0x23, 0x24, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x22, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1c, 0x1b, 0x1b, 0x19, 0x19, 0x18,
-    0x19, 0x1b, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x15, 0x16, 0x15, 0x13, 0x11, 0x0d, 0x0d, 0x0d, 0x11, 0x11, 0x11,
-    0x0f, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x15, 0x1f, 0x15, 0x17, 0x56, 0x52, 0x3a, 0x0d, 0x06, 0x08, 0x09,
-    0x06, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x2c, 0x2a, 0x2a, 0x2b, 0x2b, 0x2a,
-    0x2a, 0x2c, 0x2c, 0x27, 0x2c, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x2a, 0x2b,
-    0x2c, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x27, 0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2f, 0x30, 0x30,
-    0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x37, 0x37, 0x37, 0x36, 0x36, 0x36,
-    0x42, 0x36, 0x37, 0x37, 0x37, 0x37, 0x39, 0x3b, 0x3e, 0x41, 0x59, 0xa9,
-    0x97, 0x48, 0x48, 0x41, 0x41, 0x3b, 0x48, 0x49, 0x3b, 0x41, 0x46, 0x3b,
-    0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x41, 0x46, 0x49, 0x49, 0x50, 0x97,
-    0x78, 0x58, 0x78, 0xca, 0xca, 0x7e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x6f, 0x6f, 0x77, 0x7c, 0x88, 0x95, 0xae, 0xc2, 0xdd, 0xeb, 0xf0,
-    0xeb, 0xe2, 0xce, 0xc1, 0xae, 0xa2, 0x95, 0x88, 0x80, 0x7c, 0x77, 0x6f,
-    0x6f, 0x6f, 0x77, 0x97, 0xe3, 0xc9, 0x76, 0x61, 0x5a, 0x57, 0x54, 0x51,
-    0x50, 0x4f, 0x49, 0x49, 0x48, 0x48, 0x4a, 0x41, 0x41, 0x3b, 0x39, 0x37,
-    0x39, 0x37, 0x42, 0x30, 0x30, 0x2e, 0x2b, 0x2c, 0x2c, 0x2b, 0x2b, 0x27,
-    0x27, 0x27, 0x25, 0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x22, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1c, 0x1c, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x19, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x15, 0x17, 0x17, 0x17, 0x18, 0x16,
-    0x15, 0x11, 0x11, 0x0d, 0x11, 0x11, 0x12, 0x11, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x15, 0x19, 0x11,
-    0x08, 0x15, 0x30, 0x4e, 0x45, 0x25, 0x0d, 0x09, 0x08, 0x08, 0x08, 0x07,
-    0x06, 0x06, 0x06, 0x06, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x25, 0x27,
-    0x25, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27,
-    0x2c, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2c,
-    0x2a, 0x2a, 0x2a, 0x2b, 0x2c, 0x2c, 0x2b, 0x2b, 0x2c, 0x2a, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x25, 0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e,
-    0x2b, 0x2e, 0x2f, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x33, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35,
-    0x35, 0x35, 0x36, 0x36, 0x42, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39,
-    0x37, 0x3e, 0x3e, 0x3e, 0x37, 0x46, 0x9a, 0xbd, 0x49, 0x41, 0x41, 0x3e,
-    0x39, 0x3b, 0x43, 0x43, 0x41, 0x41, 0x43, 0x41, 0x4a, 0x43, 0x43, 0x41,
-    0x43, 0x48, 0x43, 0x49, 0x48, 0x51, 0x74, 0x7f, 0x5e, 0x74, 0xc6, 0xca,
-    0x85, 0x5e, 0x61, 0x62, 0x62, 0x61, 0x62, 0x62, 0x6f, 0x6f, 0x77, 0x7c,
-    0x84, 0x93, 0xa6, 0xbf, 0xdd, 0xea, 0xf0, 0xed, 0xe4, 0xcb, 0xbb, 0xae,
-    0x9d, 0x93, 0x88, 0x80, 0x7c, 0x77, 0x6f, 0x6f, 0x6e, 0x62, 0x6f, 0x96,
-    0xdc, 0xc9, 0x6c, 0x5a, 0x57, 0x51, 0x50, 0x51, 0x50, 0x4b, 0x49, 0x49,
-    0x48, 0x43, 0x41, 0x3b, 0x3b, 0x39, 0x37, 0x37, 0x36, 0x35, 0x30, 0x30,
-    0x30, 0x2e, 0x2e, 0x2b, 0x2c, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x24,
-    0x20, 0x20, 0x1f, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1b,
-    0x1b, 0x1c, 0x19, 0x19, 0x1b, 0x1b, 0x18, 0x18, 0x18, 0x17, 0x18, 0x18,
-    0x17, 0x15, 0x17, 0x17, 0x17, 0x17, 0x18, 0x15, 0x15, 0x11, 0x11, 0x11,
-    0x0d, 0x11, 0x11, 0x0d, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x08, 0x0b, 0x21, 0x17, 0x08, 0x0a, 0x0a, 0x17,
-    0x2b, 0x40, 0x3f, 0x0b, 0x08, 0x06, 0x06, 0x07, 0x08, 0x06, 0x06, 0x06,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x23, 0x27, 0x27, 0x2c, 0x2c,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2a, 0x2a,
-    0x27, 0x2a, 0x2b, 0x2a, 0x2c, 0x2a, 0x2a, 0x27, 0x2a, 0x2c, 0x2a, 0x2d,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25,
-    0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2c, 0x2c,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x2d, 0x33, 0x33,
-    0x33, 0x30, 0x30, 0x2e, 0x33, 0x30, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x3a, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3a, 0x42, 0x42, 0x36,
-    0x42, 0x42, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x3e, 0x3e, 0x3b, 0x3e,
-    0x3b, 0x4b, 0xbe, 0x8d, 0x43, 0x41, 0x41, 0x3b, 0x3b, 0x48, 0x48, 0x46,
-    0x46, 0x46, 0x4a, 0x41, 0x43, 0x48, 0x43, 0x43, 0x48, 0x48, 0x49, 0x4b,
-    0x4b, 0x79, 0x97, 0x68, 0x6a, 0xc0, 0xca, 0x7b, 0x69, 0x5e, 0x5e, 0x6e,
-    0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x80, 0x8e, 0x9b, 0xb2, 0xcd,
-    0xe8, 0xf0, 0xee, 0xe5, 0xd2, 0xbf, 0xae, 0xa2, 0x95, 0x8b, 0x80, 0x7c,
-    0x77, 0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x74, 0xc0, 0xe1, 0x97, 0x69, 0x5a,
-    0x57, 0x54, 0x54, 0x51, 0x50, 0x4b, 0x49, 0x49, 0x48, 0x43, 0x41, 0x3b,
-    0x39, 0x37, 0x37, 0x37, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e,
-    0x2b, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x23, 0x24, 0x20, 0x21, 0x1f,
-    0x1d, 0x1d, 0x22, 0x1d, 0x1d, 0x1d, 0x1c, 0x1c, 0x1b, 0x1c, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x18, 0x18, 0x17, 0x17, 0x18, 0x18, 0x17, 0x17, 0x15, 0x17,
-    0x17, 0x17, 0x17, 0x15, 0x15, 0x12, 0x12, 0x15, 0x0d, 0x0d, 0x11, 0x0d,
-    0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x08, 0x08, 0x0b, 0x0b, 0x09,
-    0x08, 0x08, 0x21, 0x26, 0x0b, 0x0e, 0x0b, 0x08, 0x0e, 0x3c, 0x79, 0x11,
-    0x09, 0x08, 0x06, 0x06, 0x08, 0x08, 0x06, 0x08, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x23, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x2a, 0x2e, 0x2b,
-    0x27, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x2a, 0x2a, 0x2a, 0x2a, 0x27,
-    0x2c, 0x2a, 0x2a, 0x2a, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2a,
-    0x2a, 0x2b, 0x2a, 0x2c, 0x2c, 0x27, 0x27, 0x2c, 0x2a, 0x2b, 0x2c, 0x2a,
-    0x2b, 0x2c, 0x2b, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e,
-    0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2e, 0x2f, 0x33, 0x33, 0x33, 0x33, 0x2e,
-    0x30, 0x30, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x30, 0x35, 0x42, 0x35, 0x3a,
-    0x35, 0x30, 0x30, 0x35, 0x42, 0x42, 0x42, 0x37, 0x37, 0x37, 0x42, 0x37,
-    0x39, 0x37, 0x37, 0x3b, 0x3b, 0x37, 0x39, 0x3e, 0x46, 0x7d, 0xab, 0x54,
-    0x46, 0x41, 0x41, 0x41, 0x41, 0x43, 0x48, 0x48, 0x43, 0x43, 0x43, 0x43,
-    0x41, 0x43, 0x48, 0x48, 0x48, 0x4b, 0x4f, 0x48, 0x54, 0xa2, 0x97, 0xad,
-    0xcd, 0xca, 0x85, 0x5e, 0x5e, 0x5e, 0x5e, 0x62, 0x61, 0x62, 0x6f, 0x6f,
-    0x6f, 0x77, 0x7c, 0x88, 0x95, 0xa7, 0xbf, 0xdd, 0xea, 0xf0, 0xec, 0xe0,
-    0xcb, 0xb7, 0xa6, 0x9b, 0x8e, 0x84, 0x80, 0x7c, 0x77, 0x6f, 0x6f, 0x62,
-    0x6f, 0x74, 0xb6, 0xd7, 0xd4, 0x91, 0x74, 0x6c, 0x60, 0x57, 0x51, 0x50,
-    0x4f, 0x49, 0x49, 0x48, 0x48, 0x43, 0x41, 0x41, 0x3b, 0x3e, 0x39, 0x37,
-    0x36, 0x35, 0x30, 0x30, 0x30, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2c, 0x2c,
-    0x2b, 0x2b, 0x27, 0x23, 0x24, 0x24, 0x24, 0x20, 0x1f, 0x1f, 0x22, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x1c, 0x1c, 0x19, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x15, 0x15, 0x15,
-    0x15, 0x12, 0x12, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0b, 0x0b,
-    0x0b, 0x0a, 0x08, 0x08, 0x08, 0x09, 0x0b, 0x08, 0x0a, 0x09, 0x18, 0x3a,
-    0x09, 0x08, 0x08, 0x08, 0x0d, 0x3a, 0x2a, 0x0b, 0x0a, 0x08, 0x07, 0x07,
-    0x08, 0x07, 0x08, 0x07, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c,
-    0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2b, 0x2e, 0x2b, 0x2a, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2a, 0x2a,
-    0x2a, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x2b, 0x2b, 0x2b, 0x2c, 0x2a, 0x2b, 0x2c, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2d, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x2f, 0x30, 0x30, 0x30, 0x2e, 0x2f, 0x30, 0x2e, 0x2e,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x36, 0x42, 0x35, 0x35, 0x35, 0x30, 0x35,
-    0x42, 0x36, 0x35, 0x37, 0x37, 0x36, 0x37, 0x39, 0x39, 0x37, 0x39, 0x3b,
-    0x3b, 0x39, 0x39, 0x3b, 0x6a, 0xa8, 0x6a, 0x43, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x48, 0x49, 0x49, 0x48, 0x43, 0x43, 0x41, 0x43, 0x48, 0x48,
-    0x49, 0x4b, 0x49, 0x4f, 0x58, 0xab, 0xd1, 0xc6, 0xa2, 0x74, 0x5a, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x77, 0x80, 0x8e,
-    0x9b, 0xb7, 0xce, 0xe1, 0xed, 0xf1, 0xed, 0xe1, 0xc7, 0xb0, 0xa2, 0x99,
-    0x8e, 0x84, 0x7c, 0x77, 0x6f, 0x6f, 0x6f, 0x69, 0x69, 0xa8, 0xdc, 0x9a,
-    0x9d, 0xc2, 0xd1, 0xb9, 0x74, 0x58, 0x54, 0x50, 0x4f, 0x49, 0x49, 0x48,
-    0x48, 0x43, 0x41, 0x41, 0x3b, 0x3b, 0x39, 0x39, 0x37, 0x36, 0x42, 0x35,
-    0x30, 0x2e, 0x33, 0x2e, 0x2b, 0x2a, 0x2c, 0x2a, 0x2b, 0x2b, 0x2c, 0x23,
-    0x20, 0x24, 0x24, 0x24, 0x20, 0x20, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b,
-    0x19, 0x1b, 0x1b, 0x1b, 0x1b, 0x1d, 0x19, 0x18, 0x19, 0x18, 0x18, 0x17,
-    0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x15, 0x15, 0x15, 0x12, 0x12, 0x11,
-    0x11, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0b, 0x0b, 0x0a, 0x0b, 0x0b,
-    0x0b, 0x08, 0x08, 0x08, 0x08, 0x08, 0x18, 0x3d, 0x0d, 0x0b, 0x0b, 0x07,
-    0x15, 0x6b, 0x3a, 0x11, 0x0b, 0x0b, 0x08, 0x07, 0x06, 0x06, 0x08, 0x08,
-    0x27, 0x27, 0x27, 0x29, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x2a, 0x2b,
-    0x2a, 0x2b, 0x2e, 0x2e, 0x2b, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x2c,
-    0x2c, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2b,
-    0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x27, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2e,
-    0x2e, 0x2b, 0x2d, 0x2d, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x33, 0x33, 0x2f,
-    0x30, 0x30, 0x30, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x30, 0x30,
-    0x3a, 0x36, 0x35, 0x35, 0x35, 0x35, 0x35, 0x42, 0x42, 0x37, 0x35, 0x36,
-    0x37, 0x37, 0x37, 0x39, 0x37, 0x39, 0x39, 0x3b, 0x3b, 0x3e, 0x41, 0x41,
-    0x8d, 0xa4, 0x4b, 0x43, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x49,
-    0x49, 0x48, 0x43, 0x43, 0x43, 0x48, 0x48, 0x48, 0x4b, 0x49, 0x52, 0x54,
-    0x68, 0xc3, 0xd7, 0x7e, 0x5e, 0x5e, 0x58, 0x5a, 0x5a, 0x5a, 0x5e, 0x62,
-    0x62, 0x62, 0x6f, 0x6f, 0x77, 0x77, 0x84, 0x93, 0xa6, 0xbf, 0xdb, 0xe4,
-    0xef, 0xf1, 0xed, 0xe2, 0xc7, 0xb0, 0xa0, 0x95, 0x88, 0x80, 0x7c, 0x77,
-    0x6f, 0x6f, 0x6f, 0x69, 0x69, 0xb9, 0xcf, 0x74, 0x6f, 0x74, 0x94, 0xdd,
-    0x97, 0x54, 0x4f, 0x50, 0x4b, 0x49, 0x49, 0x48, 0x43, 0x43, 0x41, 0x3b,
-    0x3b, 0x3b, 0x3d, 0x39, 0x37, 0x37, 0x36, 0x42, 0x30, 0x30, 0x2f, 0x2e,
-    0x2b, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2c, 0x23, 0x20, 0x20, 0x24, 0x24,
-    0x20, 0x24, 0x1f, 0x22, 0x1c, 0x1d, 0x1d, 0x1c, 0x19, 0x19, 0x1b, 0x1b,
-    0x1b, 0x1c, 0x19, 0x18, 0x18, 0x18, 0x18, 0x17, 0x18, 0x18, 0x18, 0x17,
-    0x17, 0x17, 0x16, 0x15, 0x15, 0x12, 0x11, 0x11, 0x12, 0x12, 0x0d, 0x11,
-    0x0d, 0x0d, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x08, 0x08, 0x0b, 0x0b, 0x08,
-    0x0b, 0x15, 0x28, 0x2b, 0x08, 0x0a, 0x0b, 0x08, 0x0b, 0x22, 0x29, 0x31,
-    0x39, 0x18, 0x08, 0x07, 0x06, 0x06, 0x08, 0x08, 0x27, 0x27, 0x27, 0x27,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x27,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2c, 0x2c, 0x2b, 0x2e,
-    0x2b, 0x2b, 0x2b, 0x2a, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x2c, 0x2c, 0x2a,
-    0x2a, 0x2a, 0x2a, 0x2a, 0x2c, 0x2a, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x33, 0x2e, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x33, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x30, 0x35, 0x35, 0x42, 0x42, 0x35,
-    0x35, 0x35, 0x35, 0x42, 0x42, 0x37, 0x42, 0x36, 0x37, 0x37, 0x37, 0x39,
-    0x39, 0x3d, 0x3b, 0x3b, 0x3b, 0x3b, 0x46, 0x43, 0xa4, 0x94, 0x48, 0x3b,
-    0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x49, 0x49, 0x48, 0x43, 0x43,
-    0x48, 0x49, 0x49, 0x49, 0x4b, 0x4f, 0x51, 0x57, 0x7b, 0xe3, 0xb1, 0x5e,
-    0x5e, 0x58, 0x54, 0x5b, 0x61, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x6f, 0x6f,
-    0x77, 0x7c, 0x8b, 0x9b, 0xae, 0xc1, 0xd2, 0xe6, 0xef, 0xf1, 0xec, 0xe0,
-    0xc7, 0xae, 0x9c, 0x93, 0x84, 0x7c, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x61,
-    0x69, 0xad, 0xd3, 0x78, 0x5e, 0x5e, 0x68, 0xca, 0x9a, 0x57, 0x57, 0x50,
-    0x4b, 0x49, 0x48, 0x48, 0x43, 0x43, 0x41, 0x41, 0x3b, 0x3b, 0x3b, 0x39,
-    0x39, 0x37, 0x37, 0x37, 0x35, 0x30, 0x30, 0x2e, 0x2b, 0x2c, 0x2a, 0x2b,
-    0x2b, 0x2b, 0x2c, 0x25, 0x24, 0x20, 0x24, 0x24, 0x24, 0x20, 0x21, 0x22,
-    0x1d, 0x1d, 0x1d, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x18,
-    0x18, 0x18, 0x18, 0x17, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x15, 0x15,
-    0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x12, 0x0d, 0x0d, 0x0d, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x08, 0x09, 0x0b, 0x08, 0x17, 0x29, 0x19, 0x0b,
-    0x06, 0x08, 0x08, 0x08, 0x09, 0x0b, 0x0b, 0x17, 0x1f, 0x15, 0x0b, 0x08,
-    0x06, 0x06, 0x08, 0x08, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x2c, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x25, 0x27, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2b, 0x2b, 0x27, 0x27, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b,
-    0x2b, 0x2c, 0x27, 0x2a, 0x2b, 0x2b, 0x2c, 0x2a, 0x2b, 0x2c, 0x2a, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2e, 0x33, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x33, 0x2e, 0x2e, 0x30, 0x30, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x35,
-    0x42, 0x36, 0x35, 0x3a, 0x35, 0x35, 0x42, 0x35, 0x42, 0x35, 0x42, 0x42,
-    0x37, 0x37, 0x36, 0x37, 0x37, 0x37, 0x37, 0x39, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x41, 0x46, 0x79, 0xab, 0x6a, 0x48, 0x3b, 0x41, 0x41, 0x46, 0x46,
-    0x46, 0x43, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x49,
-    0x4b, 0x51, 0x54, 0x58, 0x8d, 0xe4, 0x7e, 0x5a, 0x57, 0x57, 0x58, 0x5e,
-    0x61, 0x61, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x77, 0x7c, 0x80, 0x93, 0xa0,
-    0xb0, 0xc1, 0xde, 0xe9, 0xef, 0xf0, 0xe8, 0xde, 0xc5, 0xae, 0x9c, 0x8e,
-    0x84, 0x7c, 0x77, 0x77, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x97, 0xdc, 0x7a,
-    0x61, 0x5b, 0x5a, 0xa3, 0xbd, 0x68, 0x54, 0x50, 0x4b, 0x48, 0x48, 0x48,
-    0x43, 0x43, 0x41, 0x41, 0x3b, 0x3b, 0x39, 0x37, 0x39, 0x37, 0x37, 0x36,
-    0x35, 0x35, 0x30, 0x2f, 0x2b, 0x2a, 0x2a, 0x2a, 0x2b, 0x2a, 0x2a, 0x27,
-    0x23, 0x25, 0x23, 0x24, 0x24, 0x1f, 0x1f, 0x1d, 0x1b, 0x1c, 0x1d, 0x1d,
-    0x1c, 0x1c, 0x1b, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17,
-    0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x15, 0x15, 0x12, 0x12, 0x15, 0x15,
-    0x12, 0x12, 0x11, 0x0d, 0x0d, 0x0f, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x08, 0x13, 0x26, 0x1c, 0x0a, 0x06, 0x08, 0x09, 0x08, 0x08,
-    0x09, 0x08, 0x06, 0x09, 0x09, 0x0b, 0x0b, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x27, 0x27, 0x27, 0x29, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x2c, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2a,
-    0x27, 0x2c, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2a, 0x2a, 0x27,
-    0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2b,
-    0x2a, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x2a, 0x2c, 0x2c,
-    0x2b, 0x2b, 0x27, 0x2c, 0x2a, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e,
-    0x33, 0x33, 0x33, 0x2e, 0x2b, 0x2b, 0x2d, 0x2d, 0x2b, 0x2e, 0x2e, 0x2b,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x42, 0x42, 0x36, 0x42, 0x42,
-    0x35, 0x3a, 0x3a, 0x35, 0x36, 0x36, 0x36, 0x36, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x41, 0x3b, 0x3b, 0x41, 0x48, 0xa5,
-    0x84, 0x51, 0x48, 0x43, 0x41, 0x41, 0x46, 0x46, 0x46, 0x48, 0x50, 0x4f,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4b, 0x4b, 0x4f, 0x50, 0x53, 0x60,
-    0xb1, 0xdd, 0x8a, 0x60, 0x5e, 0x5a, 0x5d, 0x5e, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x6f, 0x6f, 0x77, 0x7c, 0x84, 0x95, 0xa2, 0xb0, 0xc2, 0xe1, 0xed,
-    0xef, 0xec, 0xe1, 0xce, 0xba, 0xa7, 0x99, 0x8e, 0x80, 0x7c, 0x77, 0x77,
-    0x6f, 0x62, 0x62, 0x69, 0x5e, 0xa4, 0xdc, 0x7f, 0x5e, 0x5e, 0x5e, 0x5d,
-    0xc3, 0xaf, 0x68, 0x50, 0x4b, 0x49, 0x48, 0x43, 0x48, 0x43, 0x41, 0x41,
-    0x3b, 0x3e, 0x37, 0x37, 0x37, 0x37, 0x37, 0x36, 0x42, 0x30, 0x30, 0x30,
-    0x2d, 0x2b, 0x2a, 0x2a, 0x2b, 0x2a, 0x2a, 0x2a, 0x2c, 0x27, 0x25, 0x24,
-    0x1f, 0x1f, 0x1f, 0x1d, 0x1c, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x19,
-    0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x16, 0x15, 0x15, 0x12, 0x15, 0x15, 0x12, 0x12, 0x11, 0x11,
-    0x0d, 0x0d, 0x0f, 0x0f, 0x0b, 0x0b, 0x0b, 0x0a, 0x0b, 0x0b, 0x0f, 0x26,
-    0x1f, 0x0b, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x07, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x09, 0x08, 0x08, 0x07, 0x08, 0x23, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2a, 0x2c, 0x2b, 0x2d,
-    0x2a, 0x27, 0x2b, 0x2b, 0x2a, 0x2c, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2b, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2a, 0x2b, 0x2a, 0x2c, 0x27, 0x27,
-    0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2a, 0x2b, 0x2e, 0x33, 0x33, 0x33, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2f, 0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x35, 0x37, 0x37, 0x37, 0x36, 0x42, 0x42, 0x36, 0x37,
-    0x42, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x3b,
-    0x3b, 0x41, 0x46, 0x41, 0x46, 0x49, 0x6b, 0xa8, 0x6c, 0x50, 0x48, 0x41,
-    0x41, 0x41, 0x41, 0x43, 0x43, 0x48, 0x50, 0x4f, 0x4b, 0x49, 0x4b, 0x49,
-    0x49, 0x4b, 0x4b, 0x4f, 0x50, 0x51, 0x58, 0x71, 0xd3, 0xb4, 0x8c, 0x6c,
-    0x5e, 0x5a, 0x5a, 0x5e, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x77,
-    0x7c, 0x8b, 0x95, 0xa6, 0xae, 0xc2, 0xe0, 0xed, 0xf0, 0xeb, 0xde, 0xcb,
-    0xb2, 0xa6, 0x99, 0x8e, 0x84, 0x7c, 0x7c, 0x77, 0x6f, 0x62, 0x62, 0x62,
-    0x6c, 0xc0, 0xcf, 0x74, 0x5e, 0x5a, 0x58, 0x58, 0x7a, 0xbe, 0xba, 0x6a,
-    0x50, 0x49, 0x49, 0x48, 0x48, 0x46, 0x41, 0x41, 0x41, 0x3b, 0x37, 0x39,
-    0x37, 0x37, 0x42, 0x35, 0x42, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2a, 0x2b, 0x2a, 0x27, 0x27, 0x23, 0x24, 0x20, 0x22, 0x1d,
-    0x1c, 0x1d, 0x1d, 0x1c, 0x1d, 0x1c, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17,
-    0x15, 0x15, 0x15, 0x15, 0x13, 0x12, 0x13, 0x12, 0x12, 0x12, 0x12, 0x12,
-    0x11, 0x0d, 0x0b, 0x0f, 0x0f, 0x0b, 0x12, 0x26, 0x17, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x09,
-    0x09, 0x09, 0x08, 0x08, 0x24, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x2c, 0x2c,
-    0x2c, 0x2a, 0x2b, 0x2b, 0x2a, 0x2c, 0x2b, 0x2a, 0x27, 0x27, 0x2b, 0x2b,
-    0x2a, 0x2c, 0x2b, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2a, 0x2b, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2c,
-    0x2a, 0x2a, 0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x27, 0x2c, 0x2c, 0x2a, 0x2b,
-    0x2b, 0x2c, 0x2b, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x33, 0x2e, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35,
-    0x36, 0x37, 0x37, 0x36, 0x36, 0x37, 0x37, 0x39, 0x37, 0x36, 0x37, 0x3e,
-    0x3e, 0x37, 0x39, 0x39, 0x39, 0x39, 0x3b, 0x41, 0x59, 0x64, 0x48, 0x4b,
-    0x74, 0x74, 0x85, 0x6a, 0x5e, 0x4b, 0x41, 0x48, 0x41, 0x41, 0x4a, 0x43,
-    0x43, 0x48, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x49, 0x49, 0x4b, 0x4f, 0x50,
-    0x50, 0x54, 0x5d, 0x6c, 0xc9, 0xa4, 0x88, 0x6c, 0x5a, 0x5a, 0x5a, 0x5e,
-    0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x77, 0x7c, 0x8b, 0x95, 0xa2,
-    0xaa, 0xbf, 0xd6, 0xe9, 0xf0, 0xed, 0xe0, 0xcb, 0xb2, 0xa6, 0x99, 0x8b,
-    0x84, 0x7c, 0x77, 0x77, 0x6f, 0x62, 0x62, 0x69, 0x84, 0xda, 0xb1, 0x5e,
-    0x5e, 0x5d, 0x58, 0x58, 0x58, 0x68, 0xb1, 0xb1, 0x54, 0x4f, 0x49, 0x4b,
-    0x48, 0x48, 0x41, 0x41, 0x3b, 0x37, 0x3e, 0x39, 0x39, 0x37, 0x42, 0x35,
-    0x35, 0x35, 0x30, 0x30, 0x2f, 0x2e, 0x2e, 0x2b, 0x2b, 0x2a, 0x2c, 0x2c,
-    0x27, 0x27, 0x25, 0x23, 0x24, 0x20, 0x1f, 0x22, 0x22, 0x1d, 0x1d, 0x1c,
-    0x1c, 0x1c, 0x1b, 0x19, 0x19, 0x19, 0x18, 0x19, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x16, 0x15, 0x15, 0x15,
-    0x12, 0x11, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x0d, 0x0f, 0x0f,
-    0x0b, 0x0b, 0x19, 0x21, 0x0b, 0x08, 0x08, 0x09, 0x09, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x24, 0x25, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x2c, 0x2a, 0x2b,
-    0x2c, 0x2c, 0x2b, 0x2a, 0x2c, 0x27, 0x2b, 0x2b, 0x2a, 0x2c, 0x2b, 0x27,
-    0x2c, 0x2a, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x29, 0x27, 0x2a, 0x2b,
-    0x2b, 0x2c, 0x27, 0x27, 0x27, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x2a, 0x2b, 0x2a, 0x2c, 0x2a, 0x2a, 0x2c, 0x2b, 0x2c, 0x2b, 0x2e,
-    0x2b, 0x2e, 0x30, 0x33, 0x33, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x36, 0x37, 0x37, 0x36,
-    0x37, 0x37, 0x39, 0x37, 0x37, 0x42, 0x37, 0x49, 0x52, 0x49, 0x3b, 0x39,
-    0x41, 0x43, 0x49, 0x4b, 0x7b, 0xa3, 0x92, 0x97, 0x85, 0x54, 0x4b, 0x4b,
-    0x69, 0x50, 0x43, 0x48, 0x41, 0x4a, 0x4a, 0x43, 0x48, 0x48, 0x49, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x49, 0x4f, 0x4f, 0x50, 0x50, 0x54, 0x58, 0x5d,
-    0xc4, 0xb6, 0x9b, 0x6c, 0x5e, 0x5e, 0x5e, 0x5e, 0x62, 0x62, 0x62, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x77, 0x7c, 0x88, 0x95, 0xa0, 0xa7, 0xb7, 0xcb, 0xe5,
-    0xf0, 0xef, 0xe2, 0xcb, 0xb2, 0xa6, 0x95, 0x8b, 0x80, 0x7c, 0x77, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x61, 0x97, 0xe3, 0x97, 0x5e, 0x5e, 0x60, 0x63, 0x57,
-    0x57, 0x58, 0x6a, 0xc2, 0xa8, 0x71, 0x68, 0x48, 0x46, 0x41, 0x41, 0x46,
-    0x41, 0x3b, 0x39, 0x39, 0x37, 0x37, 0x42, 0x35, 0x35, 0x35, 0x30, 0x30,
-    0x30, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x27, 0x25, 0x25, 0x24,
-    0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x22, 0x1d, 0x1c, 0x1b, 0x1c, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x18,
-    0x18, 0x18, 0x18, 0x17, 0x17, 0x15, 0x15, 0x13, 0x11, 0x11, 0x11, 0x12,
-    0x12, 0x13, 0x12, 0x11, 0x0d, 0x0d, 0x0f, 0x0f, 0x0a, 0x15, 0x21, 0x16,
-    0x0b, 0x08, 0x08, 0x08, 0x0b, 0x0b, 0x0b, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x06, 0x06, 0x07, 0x08, 0x08, 0x24, 0x23, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27,
-    0x27, 0x2c, 0x27, 0x2c, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x2c, 0x2b, 0x2b,
-    0x2c, 0x2c, 0x2b, 0x2b, 0x2c, 0x2c, 0x2b, 0x27, 0x27, 0x2a, 0x2a, 0x2b,
-    0x2c, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x2a, 0x2b, 0x2b, 0x27, 0x27, 0x27,
-    0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x2b, 0x2b, 0x2c, 0x2a, 0x2a, 0x2b, 0x2e, 0x2e, 0x2e, 0x30, 0x2e,
-    0x30, 0x30, 0x30, 0x30, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x42, 0x36, 0x42, 0x36, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x42, 0x37, 0x43, 0x49, 0x49, 0x46, 0x43, 0x49, 0x54, 0x6d, 0x69,
-    0x74, 0x85, 0x81, 0x81, 0x4b, 0x48, 0x48, 0x49, 0x5b, 0x52, 0x48, 0x46,
-    0x46, 0x43, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4f, 0x50, 0x51, 0x54, 0x51, 0x58, 0x6c, 0xb1, 0xd7, 0xa3, 0x5e,
-    0x5e, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x77, 0x77,
-    0x7c, 0x84, 0x93, 0x9b, 0xa6, 0xb2, 0xc7, 0xe2, 0xef, 0xef, 0xe4, 0xcb,
-    0xb3, 0xa6, 0x95, 0x8e, 0x80, 0x7c, 0x77, 0x6f, 0x6f, 0x6f, 0x62, 0x6e,
-    0x92, 0xe3, 0x9a, 0x5e, 0x60, 0x58, 0x57, 0x51, 0x51, 0x54, 0x54, 0x7e,
-    0xb9, 0xbe, 0xa3, 0x7b, 0x6b, 0x48, 0x41, 0x41, 0x41, 0x41, 0x39, 0x39,
-    0x37, 0x37, 0x42, 0x35, 0x35, 0x35, 0x30, 0x30, 0x30, 0x2e, 0x2b, 0x2d,
-    0x2b, 0x2c, 0x2c, 0x27, 0x25, 0x25, 0x23, 0x24, 0x20, 0x20, 0x20, 0x1f,
-    0x1f, 0x22, 0x1d, 0x1c, 0x1b, 0x1c, 0x1c, 0x1c, 0x1c, 0x1b, 0x19, 0x19,
-    0x19, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x18, 0x17, 0x18, 0x18,
-    0x17, 0x16, 0x15, 0x15, 0x11, 0x11, 0x11, 0x12, 0x12, 0x12, 0x11, 0x0d,
-    0x0d, 0x0f, 0x0f, 0x0f, 0x0d, 0x1f, 0x1b, 0x0b, 0x0c, 0x08, 0x0b, 0x09,
-    0x08, 0x09, 0x0b, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x08, 0x08,
-    0x06, 0x07, 0x08, 0x09, 0x23, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x2c, 0x27, 0x2c, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2e, 0x2e, 0x2a, 0x2c, 0x2a, 0x2b,
-    0x2c, 0x2c, 0x2b, 0x27, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2c,
-    0x2a, 0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x27, 0x2c, 0x2a, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x2c, 0x27, 0x2a, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x2f, 0x30, 0x30, 0x2e, 0x2e,
-    0x2e, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x35, 0x35, 0x35, 0x42, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x39, 0x39, 0x3b, 0x41, 0x48, 0x48, 0x48, 0x49, 0x48, 0x49, 0x48,
-    0x43, 0x46, 0x48, 0x51, 0x51, 0x43, 0x43, 0x46, 0x43, 0x48, 0x48, 0x49,
-    0x49, 0x49, 0x49, 0x49, 0x4b, 0x4f, 0x4b, 0x4b, 0x50, 0x50, 0x51, 0x54,
-    0x57, 0x57, 0x58, 0x69, 0x74, 0xc6, 0xc9, 0x80, 0x6f, 0x5e, 0x61, 0x61,
-    0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x7c, 0x84, 0x8e, 0x99,
-    0xa2, 0xb0, 0xc7, 0xe1, 0xee, 0xef, 0xe5, 0xd2, 0xb8, 0xa7, 0x99, 0x8e,
-    0x80, 0x7c, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x69, 0x8a, 0xe3, 0x9d, 0x5e,
-    0x58, 0x58, 0x54, 0x54, 0x51, 0x50, 0x50, 0x50, 0x51, 0x64, 0x64, 0x8c,
-    0xbe, 0x6b, 0x49, 0x3e, 0x3b, 0x3e, 0x39, 0x39, 0x37, 0x37, 0x36, 0x42,
-    0x42, 0x3a, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2d, 0x2e, 0x2a, 0x27, 0x27,
-    0x25, 0x25, 0x24, 0x24, 0x20, 0x20, 0x20, 0x1f, 0x1f, 0x1d, 0x1d, 0x1d,
-    0x1c, 0x1d, 0x1d, 0x1c, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x16, 0x15, 0x15,
-    0x15, 0x15, 0x15, 0x13, 0x12, 0x12, 0x12, 0x0d, 0x0b, 0x0c, 0x0b, 0x0d,
-    0x1b, 0x1c, 0x0d, 0x0b, 0x0b, 0x0b, 0x0b, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x0b, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0a,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2a, 0x33, 0x33, 0x2b, 0x27, 0x2a, 0x2b, 0x2c, 0x2a, 0x2b, 0x2c,
-    0x2c, 0x2b, 0x2a, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x2e, 0x2e, 0x2a,
-    0x2c, 0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x2a,
-    0x2b, 0x2b, 0x2e, 0x2e, 0x2a, 0x2b, 0x2b, 0x2b, 0x2d, 0x2e, 0x30, 0x30,
-    0x30, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x2e, 0x2e, 0x33, 0x33, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x30, 0x35,
-    0x36, 0x37, 0x36, 0x37, 0x42, 0x37, 0x37, 0x37, 0x39, 0x41, 0x3e, 0x3e,
-    0x3b, 0x3b, 0x3d, 0x3b, 0x41, 0x41, 0x45, 0x41, 0x43, 0x48, 0x49, 0x51,
-    0x48, 0x43, 0x43, 0x48, 0x48, 0x48, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x4b, 0x4b, 0x4b, 0x4f, 0x50, 0x50, 0x51, 0x57, 0x57, 0x57, 0x57, 0x5e,
-    0x5e, 0xb6, 0xd5, 0x8a, 0x6f, 0x5e, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x6f,
-    0x6f, 0x6f, 0x77, 0x7c, 0x7c, 0x84, 0x8b, 0x95, 0xa2, 0xb0, 0xc7, 0xe1,
-    0xed, 0xf0, 0xe8, 0xdb, 0xba, 0xa7, 0x99, 0x8e, 0x80, 0x7c, 0x77, 0x6f,
-    0x6f, 0x62, 0x62, 0x6f, 0x9a, 0xdc, 0x8c, 0x5e, 0x5b, 0x5d, 0x57, 0x51,
-    0x51, 0x51, 0x54, 0x4b, 0x49, 0x4e, 0x48, 0x4f, 0x9a, 0xa8, 0x4f, 0x43,
-    0x46, 0x37, 0x3b, 0x37, 0x37, 0x36, 0x36, 0x36, 0x42, 0x35, 0x30, 0x30,
-    0x30, 0x2e, 0x2e, 0x2d, 0x2b, 0x2b, 0x27, 0x2c, 0x27, 0x23, 0x23, 0x24,
-    0x23, 0x20, 0x20, 0x1f, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1b,
-    0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x16, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
-    0x12, 0x12, 0x12, 0x0d, 0x0b, 0x0b, 0x0d, 0x17, 0x22, 0x15, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x09, 0x08, 0x08, 0x08, 0x08, 0x0b, 0x08, 0x08, 0x08,
-    0x08, 0x09, 0x09, 0x0b, 0x09, 0x08, 0x08, 0x08, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x2c, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2b,
-    0x2c, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x27, 0x2c, 0x2c, 0x2c, 0x2a, 0x2b, 0x2c, 0x2c, 0x2c, 0x27, 0x2c,
-    0x2a, 0x2c, 0x2a, 0x2c, 0x2b, 0x2c, 0x2c, 0x2c, 0x2a, 0x2b, 0x27, 0x27,
-    0x2a, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2e, 0x2b, 0x2b, 0x2e, 0x33, 0x2f, 0x30, 0x30, 0x33, 0x2e, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x30, 0x35, 0x35, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x42, 0x35, 0x35, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x36, 0x36, 0x37, 0x39, 0x3b, 0x3e, 0x3b, 0x3b, 0x3b, 0x3b, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x4a, 0x48, 0x51, 0x4b, 0x48, 0x43, 0x43, 0x48,
-    0x48, 0x48, 0x48, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4b, 0x50, 0x50,
-    0x50, 0x50, 0x51, 0x51, 0x57, 0x57, 0x5a, 0x69, 0x6f, 0xb6, 0xc9, 0x7c,
-    0x6f, 0x62, 0x61, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x77, 0x77,
-    0x80, 0x84, 0x8e, 0x99, 0xa2, 0xb0, 0xc2, 0xdf, 0xe9, 0xf0, 0xea, 0xde,
-    0xba, 0xa7, 0x95, 0x88, 0x80, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x62, 0x76,
-    0xc4, 0xbd, 0x5e, 0x5e, 0x5a, 0x5d, 0x57, 0x57, 0x51, 0x51, 0x50, 0x4b,
-    0x49, 0x48, 0x49, 0x4b, 0x64, 0xb3, 0x9a, 0x64, 0x46, 0x3e, 0x39, 0x37,
-    0x36, 0x36, 0x37, 0x35, 0x30, 0x35, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2b,
-    0x2a, 0x2c, 0x2c, 0x2a, 0x27, 0x24, 0x24, 0x23, 0x25, 0x24, 0x21, 0x1f,
-    0x1f, 0x22, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x18, 0x18, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x16, 0x15, 0x17, 0x17, 0x15, 0x12, 0x11, 0x11, 0x11,
-    0x0d, 0x0a, 0x12, 0x1b, 0x16, 0x0d, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x08, 0x08, 0x08, 0x09, 0x0b, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x2c, 0x2a, 0x2c, 0x2a, 0x2b, 0x2b, 0x2a, 0x27, 0x27, 0x2c, 0x27,
-    0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x27, 0x27, 0x2b, 0x2d, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e,
-    0x33, 0x2e, 0x30, 0x30, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x35, 0x35, 0x42, 0x37, 0x37, 0x37, 0x36, 0x37, 0x36, 0x37, 0x37,
-    0x3e, 0x3b, 0x3e, 0x41, 0x3b, 0x3e, 0x3b, 0x41, 0x46, 0x41, 0x41, 0x41,
-    0x43, 0x48, 0x50, 0x49, 0x43, 0x48, 0x43, 0x43, 0x48, 0x48, 0x48, 0x48,
-    0x49, 0x49, 0x49, 0x49, 0x4b, 0x4b, 0x50, 0x50, 0x50, 0x51, 0x54, 0x54,
-    0x57, 0x5a, 0x6e, 0x5e, 0x5e, 0xb9, 0xc9, 0x77, 0x62, 0x62, 0x61, 0x62,
-    0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x77, 0x7c, 0x80, 0x88, 0x93, 0x9b,
-    0xa6, 0xb0, 0xc2, 0xde, 0xea, 0xf0, 0xec, 0xd9, 0xbe, 0xa7, 0x93, 0x8b,
-    0x84, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x7f, 0xd5, 0xa8, 0x61, 0x5a,
-    0x58, 0x58, 0x57, 0x54, 0x50, 0x50, 0x4b, 0x49, 0x48, 0x48, 0x48, 0x49,
-    0x4b, 0x79, 0xcd, 0x79, 0x49, 0x41, 0x37, 0x37, 0x36, 0x37, 0x37, 0x42,
-    0x35, 0x35, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2d, 0x2b, 0x2c, 0x2a, 0x2a,
-    0x2c, 0x25, 0x23, 0x23, 0x23, 0x20, 0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x22, 0x22, 0x1d, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x18, 0x18,
-    0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17,
-    0x15, 0x17, 0x17, 0x15, 0x12, 0x12, 0x12, 0x11, 0x0d, 0x11, 0x17, 0x15,
-    0x0b, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x08, 0x09, 0x09,
-    0x08, 0x08, 0x08, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2b, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2b, 0x2c, 0x27,
-    0x27, 0x2c, 0x2a, 0x27, 0x2c, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x2d,
-    0x2b, 0x2b, 0x2a, 0x2c, 0x2c, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b,
-    0x2b, 0x2b, 0x2c, 0x2a, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e,
-    0x2b, 0x2b, 0x2e, 0x2d, 0x33, 0x2e, 0x33, 0x30, 0x33, 0x2e, 0x2f, 0x30,
-    0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x30, 0x30, 0x30, 0x2f, 0x30, 0x42, 0x36,
-    0x37, 0x37, 0x36, 0x36, 0x37, 0x36, 0x37, 0x37, 0x39, 0x3b, 0x3e, 0x3b,
-    0x3b, 0x3b, 0x41, 0x46, 0x46, 0x43, 0x43, 0x48, 0x48, 0x48, 0x4f, 0x48,
-    0x43, 0x48, 0x48, 0x48, 0x43, 0x48, 0x48, 0x48, 0x49, 0x49, 0x4b, 0x4b,
-    0x4b, 0x4f, 0x50, 0x50, 0x51, 0x51, 0x54, 0x58, 0x58, 0x5e, 0x69, 0x62,
-    0x69, 0xb6, 0xda, 0x8c, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x6f, 0x6f,
-    0x6f, 0x77, 0x77, 0x7c, 0x80, 0x8b, 0x93, 0x9c, 0xa7, 0xb2, 0xc5, 0xe0,
-    0xec, 0xf1, 0xe9, 0xde, 0xba, 0xa7, 0x95, 0x8a, 0x80, 0x77, 0x77, 0x6f,
-    0x6f, 0x6f, 0x62, 0x78, 0xcf, 0xa8, 0x61, 0x5e, 0x5a, 0x58, 0x57, 0x51,
-    0x50, 0x4b, 0x4b, 0x4b, 0x49, 0x49, 0x49, 0x48, 0x49, 0x6a, 0xc8, 0x7e,
-    0x50, 0x41, 0x39, 0x37, 0x37, 0x36, 0x36, 0x35, 0x35, 0x30, 0x35, 0x30,
-    0x30, 0x30, 0x30, 0x33, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x27, 0x23, 0x23,
-    0x23, 0x20, 0x20, 0x20, 0x20, 0x21, 0x1f, 0x1f, 0x1f, 0x1f, 0x1d, 0x1d,
-    0x1d, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x18, 0x18, 0x19, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x15, 0x16,
-    0x15, 0x12, 0x15, 0x13, 0x12, 0x18, 0x1a, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x25, 0x25, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2b, 0x2a,
-    0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x33, 0x2e, 0x2d, 0x2e, 0x2e, 0x33, 0x2e, 0x2b, 0x2d, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b,
-    0x2d, 0x2d, 0x2d, 0x2b, 0x2b, 0x2b, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x33, 0x30, 0x2f, 0x33, 0x2e, 0x2e, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x35, 0x35, 0x30, 0x30, 0x30, 0x42, 0x42, 0x36, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x39, 0x39, 0x3e, 0x3b, 0x3b, 0x3b, 0x41, 0x46,
-    0x43, 0x43, 0x48, 0x48, 0x48, 0x48, 0x49, 0x48, 0x43, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x49, 0x49, 0x49, 0x4b, 0x4b, 0x4b, 0x50, 0x50, 0x51,
-    0x54, 0x57, 0x57, 0x58, 0x5a, 0x5e, 0x62, 0x62, 0x6c, 0xbd, 0xd4, 0xb9,
-    0x69, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x77, 0x7c, 0x7c,
-    0x84, 0x8b, 0x95, 0xa0, 0xaa, 0xb8, 0xcb, 0xe4, 0xef, 0xef, 0xe2, 0xce,
-    0xbf, 0xab, 0x95, 0x8e, 0x80, 0x7c, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x78,
-    0xd1, 0x9a, 0x62, 0x5e, 0x5e, 0x5d, 0x57, 0x54, 0x50, 0x50, 0x4f, 0x4f,
-    0x4b, 0x4b, 0x4b, 0x49, 0x48, 0x49, 0x94, 0xb8, 0x6a, 0x46, 0x41, 0x3e,
-    0x37, 0x36, 0x36, 0x3a, 0x3a, 0x35, 0x35, 0x30, 0x30, 0x30, 0x30, 0x33,
-    0x2e, 0x2b, 0x2a, 0x2c, 0x2c, 0x27, 0x23, 0x23, 0x24, 0x20, 0x20, 0x20,
-    0x24, 0x24, 0x21, 0x1f, 0x1f, 0x1f, 0x22, 0x1d, 0x1d, 0x1c, 0x1c, 0x1b,
-    0x1b, 0x19, 0x19, 0x19, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x15, 0x15, 0x15, 0x15, 0x15,
-    0x15, 0x18, 0x18, 0x0f, 0x0b, 0x0b, 0x0d, 0x0d, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x09, 0x09, 0x09, 0x08, 0x09, 0x08, 0x08, 0x09, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x25, 0x23, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x2a, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2b, 0x2b, 0x27, 0x27, 0x27, 0x2a,
-    0x2b, 0x2c, 0x2c, 0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x30, 0x30, 0x2d, 0x2b, 0x2d, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d,
-    0x2b, 0x2b, 0x2b, 0x2e, 0x2f, 0x2e, 0x2d, 0x2b, 0x2e, 0x30, 0x33, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x42, 0x42, 0x35, 0x35,
-    0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x39, 0x3e, 0x3b, 0x3b, 0x3b, 0x41, 0x46, 0x43, 0x43, 0x48, 0x48,
-    0x48, 0x48, 0x49, 0x48, 0x48, 0x48, 0x49, 0x4b, 0x49, 0x49, 0x49, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4f, 0x50, 0x51, 0x54, 0x57, 0x58, 0x58, 0x5d,
-    0x5a, 0x5e, 0x6c, 0x6c, 0xa5, 0xc8, 0xa5, 0xc6, 0x74, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x6f, 0x6f, 0x77, 0x77, 0x7c, 0x80, 0x88, 0x8e, 0x99, 0xa7,
-    0xb2, 0xc5, 0xdf, 0xea, 0xf0, 0xe9, 0xde, 0xc1, 0xb7, 0xae, 0x95, 0x8b,
-    0x84, 0x7c, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x7e, 0xd7, 0x92, 0x61, 0x61,
-    0x5e, 0x5b, 0x58, 0x57, 0x51, 0x51, 0x50, 0x4b, 0x4b, 0x4b, 0x49, 0x49,
-    0x48, 0x49, 0x48, 0xa5, 0xb3, 0x4f, 0x43, 0x41, 0x3b, 0x37, 0x37, 0x36,
-    0x42, 0x35, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x2e, 0x2b, 0x2c, 0x27,
-    0x2c, 0x25, 0x23, 0x25, 0x23, 0x20, 0x20, 0x20, 0x24, 0x24, 0x20, 0x1f,
-    0x1f, 0x22, 0x1d, 0x1d, 0x1c, 0x1b, 0x1c, 0x1c, 0x1b, 0x1b, 0x1b, 0x19,
-    0x1b, 0x1b, 0x1b, 0x1c, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x17, 0x17, 0x17, 0x16, 0x15, 0x15, 0x15, 0x15, 0x16, 0x15, 0x12, 0x11,
-    0x0f, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x09,
-    0x08, 0x09, 0x09, 0x09, 0x0b, 0x0b, 0x0b, 0x09, 0x09, 0x08, 0x08, 0x08,
-    0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2a, 0x2a, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x27, 0x2c, 0x2c,
-    0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x34, 0x2e, 0x2d,
-    0x2b, 0x2d, 0x2e, 0x2e, 0x2e, 0x2b, 0x2e, 0x2d, 0x2e, 0x2e, 0x2b, 0x33,
-    0x30, 0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x33, 0x2e, 0x2e,
-    0x33, 0x33, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x2e, 0x2e, 0x33, 0x33, 0x33,
-    0x2f, 0x30, 0x30, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x42, 0x36, 0x42, 0x42, 0x37, 0x37, 0x37, 0x36,
-    0x37, 0x37, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39, 0x3b, 0x3b,
-    0x41, 0x3b, 0x41, 0x46, 0x43, 0x43, 0x43, 0x48, 0x43, 0x48, 0x49, 0x48,
-    0x48, 0x49, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4f, 0x4f,
-    0x4f, 0x50, 0x54, 0x57, 0x57, 0x57, 0x58, 0x6c, 0x78, 0x9d, 0xaf, 0xa5,
-    0xb8, 0x7e, 0x8c, 0xc6, 0x7a, 0x6f, 0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x77, 0x77, 0x7c, 0x84, 0x8e, 0x95, 0xa0, 0xae, 0xba, 0xce, 0xe3, 0xef,
-    0xee, 0xe4, 0xcc, 0xb7, 0xa9, 0xa6, 0x99, 0x8e, 0x84, 0x80, 0x77, 0x77,
-    0x6f, 0x6f, 0x76, 0x91, 0xda, 0x9f, 0x5e, 0x62, 0x5e, 0x60, 0x58, 0x57,
-    0x54, 0x51, 0x50, 0x49, 0x4b, 0x4b, 0x48, 0x48, 0x48, 0x43, 0x48, 0x4f,
-    0xad, 0xa3, 0x85, 0x70, 0x4a, 0x4a, 0x4a, 0x41, 0x39, 0x42, 0x35, 0x30,
-    0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2b, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27,
-    0x23, 0x24, 0x24, 0x20, 0x24, 0x24, 0x20, 0x1f, 0x1f, 0x22, 0x1d, 0x1d,
-    0x1b, 0x1c, 0x1c, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x1c, 0x1b, 0x1b, 0x1b,
-    0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x16,
-    0x16, 0x16, 0x15, 0x12, 0x15, 0x12, 0x11, 0x12, 0x0d, 0x0f, 0x0b, 0x0b,
-    0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x08, 0x09, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x08, 0x08, 0x27, 0x27, 0x2c, 0x2c,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x23, 0x27, 0x25, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x2c,
-    0x2c, 0x27, 0x27, 0x25, 0x27, 0x25, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2c,
-    0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2e, 0x2e, 0x33, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x33, 0x2e, 0x33, 0x2e, 0x33, 0x30, 0x2f, 0x33, 0x2e,
-    0x2e, 0x2d, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x33,
-    0x2e, 0x33, 0x2e, 0x2f, 0x33, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x30, 0x30,
-    0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x35, 0x35, 0x35, 0x35, 0x42, 0x37, 0x36, 0x42, 0x42, 0x36, 0x36, 0x37,
-    0x39, 0x39, 0x3e, 0x3e, 0x39, 0x3e, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x41,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x48, 0x43, 0x48, 0x48, 0x49, 0x4b, 0x4f,
-    0x4b, 0x4f, 0x4b, 0x4b, 0x4b, 0x4f, 0x51, 0x51, 0x50, 0x51, 0x58, 0x57,
-    0x58, 0x7b, 0xa8, 0xb9, 0xbd, 0xa3, 0x7a, 0x6c, 0x6c, 0x62, 0x74, 0xc9,
-    0xc9, 0xb1, 0x74, 0x6e, 0x61, 0x6f, 0x6f, 0x6f, 0x77, 0x7c, 0x80, 0x84,
-    0x8e, 0x95, 0xa2, 0xb2, 0xc7, 0xdf, 0xea, 0xf1, 0xea, 0xdf, 0xc7, 0xb2,
-    0xa6, 0x9b, 0x95, 0x8e, 0x88, 0x80, 0x77, 0x6f, 0x6f, 0x6c, 0x7e, 0xc9,
-    0xc0, 0x80, 0x6f, 0x5e, 0x5d, 0x58, 0x57, 0x54, 0x54, 0x51, 0x51, 0x50,
-    0x4b, 0x49, 0x48, 0x48, 0x48, 0x48, 0x41, 0x46, 0x49, 0x59, 0x72, 0xa8,
-    0xb4, 0xa8, 0xb1, 0xa8, 0x70, 0x44, 0x36, 0x35, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2c, 0x27, 0x25, 0x23, 0x25, 0x25,
-    0x25, 0x24, 0x20, 0x20, 0x1f, 0x22, 0x1d, 0x1c, 0x1d, 0x1d, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x18, 0x19, 0x19,
-    0x19, 0x18, 0x18, 0x18, 0x18, 0x17, 0x16, 0x16, 0x15, 0x15, 0x15, 0x12,
-    0x12, 0x12, 0x12, 0x11, 0x0d, 0x0d, 0x0b, 0x0b, 0x0d, 0x0d, 0x0d, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x0b, 0x0b,
-    0x0b, 0x08, 0x08, 0x08, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2a,
-    0x2b, 0x2b, 0x2a, 0x2c, 0x2a, 0x2c, 0x2a, 0x2a, 0x2c, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x2b, 0x27, 0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2d, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x2b, 0x2d, 0x33,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x30, 0x30, 0x33, 0x33, 0x33, 0x2e, 0x2e,
-    0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x35, 0x30, 0x30, 0x35, 0x35, 0x42,
-    0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3e, 0x3b, 0x3b, 0x3e,
-    0x3b, 0x3b, 0x3e, 0x3b, 0x3b, 0x3b, 0x41, 0x46, 0x43, 0x43, 0x43, 0x43,
-    0x48, 0x48, 0x43, 0x48, 0x48, 0x49, 0x4b, 0x4f, 0x4b, 0x4b, 0x4b, 0x4f,
-    0x4f, 0x4f, 0x50, 0x51, 0x63, 0x5d, 0x85, 0xab, 0xaa, 0xad, 0x8a, 0x68,
-    0x6c, 0x5e, 0x61, 0x5e, 0x62, 0x61, 0x69, 0x85, 0x9a, 0xc8, 0xc6, 0x88,
-    0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x7c, 0x80, 0x8a, 0x93, 0x99, 0xa6, 0xb7,
-    0xcb, 0xe4, 0xef, 0xf1, 0xe6, 0xdb, 0xbf, 0xb0, 0xa6, 0x99, 0x93, 0x88,
-    0x84, 0x80, 0x7c, 0x6f, 0x77, 0x7a, 0xc0, 0xc9, 0x7f, 0x69, 0x62, 0x5e,
-    0x58, 0x58, 0x57, 0x54, 0x51, 0x51, 0x50, 0x4f, 0x4b, 0x49, 0x48, 0x48,
-    0x48, 0x43, 0x41, 0x46, 0x46, 0x41, 0x41, 0x48, 0x59, 0x64, 0x64, 0x7e,
-    0x94, 0x9a, 0x7b, 0x59, 0x42, 0x33, 0x30, 0x2f, 0x2f, 0x2e, 0x2b, 0x2c,
-    0x2a, 0x2a, 0x2a, 0x27, 0x27, 0x25, 0x27, 0x2c, 0x27, 0x23, 0x24, 0x24,
-    0x21, 0x1f, 0x22, 0x1d, 0x1d, 0x1d, 0x1c, 0x1c, 0x1c, 0x1c, 0x1b, 0x1c,
-    0x1b, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x19, 0x19, 0x18, 0x18, 0x18,
-    0x17, 0x17, 0x17, 0x15, 0x15, 0x15, 0x15, 0x15, 0x12, 0x12, 0x12, 0x12,
-    0x11, 0x11, 0x0d, 0x0c, 0x0d, 0x11, 0x11, 0x0d, 0x0f, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x08, 0x08,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x2c, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x2c, 0x2c, 0x2c, 0x27, 0x2c, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x2b, 0x2a, 0x2a, 0x2b, 0x2a, 0x2c, 0x27, 0x2c, 0x2b, 0x27,
-    0x2c, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x2b,
-    0x2e, 0x2e, 0x33, 0x2e, 0x2b, 0x33, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x30, 0x30, 0x2f, 0x33, 0x30, 0x33, 0x30, 0x30, 0x2e, 0x2e, 0x33, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35,
-    0x36, 0x37, 0x42, 0x3a, 0x30, 0x30, 0x35, 0x42, 0x37, 0x37, 0x39, 0x37,
-    0x39, 0x37, 0x37, 0x39, 0x39, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x39, 0x3b,
-    0x3b, 0x3b, 0x41, 0x46, 0x43, 0x46, 0x43, 0x43, 0x48, 0x48, 0x48, 0x48,
-    0x49, 0x49, 0x4b, 0x4f, 0x4b, 0x4b, 0x50, 0x50, 0x51, 0x51, 0x57, 0x51,
-    0x7e, 0xab, 0xa9, 0x7a, 0x74, 0x6c, 0x57, 0x5b, 0x5e, 0x62, 0x69, 0x5e,
-    0x62, 0x61, 0x61, 0x62, 0x6e, 0x80, 0xbd, 0xbe, 0x77, 0x6e, 0x6f, 0x77,
-    0x7c, 0x7c, 0x84, 0x8e, 0x95, 0x9b, 0xa7, 0xbe, 0xd2, 0xe5, 0xf0, 0xf1,
-    0xe7, 0xdb, 0xbf, 0xae, 0xa2, 0x99, 0x93, 0x88, 0x80, 0x7c, 0x77, 0x77,
-    0x76, 0x9f, 0xe1, 0x96, 0x69, 0x5e, 0x62, 0x5e, 0x5e, 0x58, 0x57, 0x57,
-    0x51, 0x51, 0x50, 0x4f, 0x4b, 0x49, 0x48, 0x48, 0x48, 0x46, 0x41, 0x41,
-    0x41, 0x3b, 0x3d, 0x3b, 0x41, 0x41, 0x37, 0x3e, 0x3b, 0x64, 0x9f, 0xc6,
-    0x7b, 0x36, 0x30, 0x2d, 0x2e, 0x2e, 0x2e, 0x2a, 0x2b, 0x2b, 0x2c, 0x2c,
-    0x27, 0x27, 0x25, 0x25, 0x23, 0x23, 0x20, 0x20, 0x20, 0x1f, 0x1f, 0x22,
-    0x1d, 0x1c, 0x1d, 0x1c, 0x1c, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x18,
-    0x19, 0x18, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x15,
-    0x15, 0x15, 0x15, 0x16, 0x15, 0x15, 0x15, 0x15, 0x11, 0x12, 0x11, 0x0d,
-    0x11, 0x11, 0x11, 0x0d, 0x0f, 0x0f, 0x0d, 0x0c, 0x0f, 0x0c, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x09, 0x08, 0x09, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c,
-    0x2b, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2a, 0x2a,
-    0x2c, 0x2c, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2a, 0x2a, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x27, 0x2a, 0x2b, 0x2a, 0x2b, 0x2d, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2d, 0x30, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2d, 0x2b, 0x2e, 0x33, 0x2e, 0x2e, 0x2e, 0x33, 0x30, 0x2f, 0x30,
-    0x30, 0x30, 0x30, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x2e, 0x33, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x42, 0x36, 0x42, 0x35,
-    0x30, 0x30, 0x42, 0x36, 0x37, 0x37, 0x39, 0x39, 0x39, 0x37, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x3e, 0x39, 0x37, 0x3b, 0x41, 0x3b, 0x41, 0x41,
-    0x4a, 0x46, 0x43, 0x48, 0x48, 0x43, 0x48, 0x48, 0x49, 0x49, 0x4f, 0x50,
-    0x4b, 0x4f, 0x50, 0x51, 0x54, 0x54, 0x57, 0x7e, 0xba, 0x7a, 0x60, 0x58,
-    0x58, 0x5a, 0x5a, 0x5b, 0x5e, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x61,
-    0x62, 0x6c, 0x94, 0xd4, 0x84, 0x6f, 0x6f, 0x77, 0x7c, 0x80, 0x84, 0x8e,
-    0x99, 0xa2, 0xab, 0xc7, 0xdb, 0xe3, 0xee, 0xf0, 0xea, 0xd6, 0xbf, 0xae,
-    0xa2, 0x95, 0x93, 0x88, 0x80, 0x7c, 0x77, 0x7c, 0x8a, 0xca, 0xc3, 0x6c,
-    0x62, 0x62, 0x61, 0x61, 0x60, 0x58, 0x57, 0x57, 0x51, 0x50, 0x4f, 0x4b,
-    0x4b, 0x49, 0x48, 0x48, 0x43, 0x43, 0x41, 0x41, 0x3d, 0x3d, 0x3d, 0x37,
-    0x42, 0x37, 0x39, 0x37, 0x37, 0x3d, 0x56, 0xa4, 0xb6, 0x3e, 0x30, 0x31,
-    0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x2c, 0x27, 0x25, 0x23,
-    0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x1f, 0x1f, 0x1d, 0x1b, 0x1d, 0x1d,
-    0x1c, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x18, 0x18, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x15,
-    0x15, 0x15, 0x16, 0x15, 0x11, 0x12, 0x12, 0x0d, 0x11, 0x11, 0x11, 0x0d,
-    0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0f, 0x0b, 0x0f, 0x0b, 0x0b, 0x0b, 0x0a,
-    0x0a, 0x09, 0x09, 0x0a, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2b, 0x2c, 0x2c,
-    0x2a, 0x2a, 0x2c, 0x2c, 0x2c, 0x2b, 0x2b, 0x2a, 0x2a, 0x2c, 0x2a, 0x2a,
-    0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2a, 0x2c, 0x2a, 0x2b, 0x2b, 0x2c,
-    0x27, 0x27, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2d, 0x2d,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2d, 0x33, 0x2e, 0x2e,
-    0x2e, 0x33, 0x2f, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2e,
-    0x33, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x42, 0x37, 0x42, 0x35, 0x30, 0x35, 0x36, 0x36,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39, 0x3e, 0x3e, 0x3e, 0x3e,
-    0x3e, 0x3e, 0x3e, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x4a, 0x43, 0x43,
-    0x43, 0x43, 0x48, 0x48, 0x49, 0x49, 0x4f, 0x4f, 0x50, 0x50, 0x54, 0x54,
-    0x57, 0x57, 0x78, 0xba, 0x85, 0x5d, 0x57, 0x58, 0x57, 0x58, 0x5d, 0x5a,
-    0x5e, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x69, 0x9f, 0xd9,
-    0x80, 0x6f, 0x77, 0x77, 0x7c, 0x80, 0x84, 0x93, 0x9b, 0xab, 0xbf, 0xd2,
-    0xdb, 0xe5, 0xef, 0xef, 0xe7, 0xd2, 0xbb, 0xae, 0xa0, 0x95, 0x93, 0x88,
-    0x80, 0x7c, 0x77, 0x77, 0xb3, 0xd1, 0x8c, 0x6e, 0x62, 0x69, 0x61, 0x5e,
-    0x5a, 0x58, 0x58, 0x57, 0x54, 0x50, 0x4f, 0x4f, 0x4b, 0x49, 0x49, 0x48,
-    0x43, 0x43, 0x41, 0x41, 0x3b, 0x3b, 0x3b, 0x3e, 0x3e, 0x37, 0x37, 0x37,
-    0x37, 0x30, 0x37, 0x4a, 0x85, 0x6a, 0x39, 0x42, 0x30, 0x2b, 0x2e, 0x2e,
-    0x2b, 0x2a, 0x2b, 0x2a, 0x27, 0x2c, 0x27, 0x27, 0x23, 0x24, 0x20, 0x20,
-    0x20, 0x24, 0x20, 0x1f, 0x1d, 0x1c, 0x1d, 0x1d, 0x1d, 0x1b, 0x1b, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x18, 0x18, 0x18, 0x18, 0x17, 0x18, 0x17, 0x17, 0x15, 0x15, 0x17, 0x15,
-    0x11, 0x13, 0x11, 0x0d, 0x11, 0x11, 0x0d, 0x0d, 0x0d, 0x0f, 0x11, 0x0d,
-    0x11, 0x0d, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x08, 0x08, 0x09, 0x09, 0x08,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x27, 0x27, 0x27, 0x27, 0x2b, 0x2a, 0x2b, 0x2a, 0x2b, 0x2b, 0x2a, 0x2a,
-    0x2c, 0x2b, 0x2a, 0x2c, 0x2c, 0x2c, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
-    0x2a, 0x2b, 0x2c, 0x27, 0x2c, 0x2b, 0x2a, 0x2c, 0x27, 0x2c, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2d, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x2f, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x2e, 0x2e, 0x33, 0x33, 0x33,
-    0x33, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x30, 0x30,
-    0x42, 0x37, 0x36, 0x35, 0x35, 0x35, 0x42, 0x42, 0x36, 0x42, 0x37, 0x37,
-    0x37, 0x37, 0x39, 0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x48, 0x43, 0x48, 0x48, 0x49,
-    0x4b, 0x49, 0x50, 0x50, 0x50, 0x54, 0x54, 0x58, 0x5d, 0x7b, 0xaf, 0x7a,
-    0x58, 0x57, 0x58, 0x5d, 0x58, 0x58, 0x57, 0x58, 0x5e, 0x62, 0x62, 0x5e,
-    0x62, 0x61, 0x61, 0x61, 0x62, 0x7c, 0xc6, 0xb3, 0x77, 0x77, 0x77, 0x7c,
-    0x80, 0x80, 0x88, 0x93, 0xa0, 0xbe, 0xc7, 0xcb, 0xde, 0xe8, 0xf0, 0xec,
-    0xe2, 0xce, 0xba, 0xaa, 0xa0, 0x95, 0x8e, 0x88, 0x80, 0x7c, 0x77, 0x78,
-    0xc9, 0xb4, 0x76, 0x69, 0x62, 0x61, 0x61, 0x5a, 0x5a, 0x58, 0x58, 0x57,
-    0x51, 0x50, 0x50, 0x4f, 0x4f, 0x49, 0x49, 0x48, 0x48, 0x43, 0x41, 0x41,
-    0x41, 0x3b, 0x3e, 0x39, 0x39, 0x37, 0x42, 0x3a, 0x3a, 0x33, 0x3a, 0x35,
-    0x41, 0x85, 0x7b, 0x64, 0x41, 0x30, 0x2e, 0x2d, 0x2d, 0x2b, 0x27, 0x2a,
-    0x2a, 0x2c, 0x27, 0x27, 0x25, 0x23, 0x24, 0x20, 0x24, 0x24, 0x20, 0x1f,
-    0x1f, 0x1d, 0x22, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x19, 0x18, 0x18, 0x19,
-    0x19, 0x18, 0x19, 0x18, 0x18, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x15, 0x12, 0x15, 0x12, 0x11,
-    0x12, 0x12, 0x12, 0x11, 0x0d, 0x0d, 0x0d, 0x0d, 0x11, 0x0d, 0x0d, 0x0b,
-    0x0f, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x09, 0x08, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x2c, 0x2b, 0x2c, 0x27, 0x2c, 0x2c, 0x2a, 0x2b, 0x2a, 0x2c, 0x2c,
-    0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x2c,
-    0x2c, 0x2c, 0x27, 0x2c, 0x2a, 0x2a, 0x2a, 0x2b, 0x2c, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b,
-    0x2d, 0x2b, 0x2b, 0x2e, 0x33, 0x2e, 0x2e, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x30, 0x2e, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x2f, 0x30, 0x30, 0x35, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x35, 0x42, 0x36, 0x30, 0x30, 0x42, 0x37, 0x37, 0x36,
-    0x42, 0x42, 0x35, 0x42, 0x42, 0x42, 0x39, 0x39, 0x39, 0x39, 0x39, 0x37,
-    0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x43, 0x41, 0x4a, 0x48, 0x49, 0x48, 0x48, 0x4b, 0x4b, 0x4b, 0x50, 0x50,
-    0x51, 0x50, 0x68, 0x96, 0xa5, 0x9b, 0x7a, 0x58, 0x5d, 0x57, 0x54, 0x57,
-    0x58, 0x5a, 0x5a, 0x5a, 0x5e, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x6f, 0xa5, 0xc6, 0x78, 0x6f, 0x77, 0x77, 0x7c, 0x80, 0x84, 0x8e, 0x99,
-    0xa6, 0xc5, 0xbb, 0xc7, 0xdf, 0xea, 0xf0, 0xe9, 0xde, 0xc7, 0xb7, 0xa9,
-    0xa0, 0x95, 0x93, 0x84, 0x80, 0x7c, 0x74, 0x9a, 0xdd, 0xa3, 0x76, 0x6f,
-    0x62, 0x62, 0x61, 0x5e, 0x5e, 0x5a, 0x58, 0x54, 0x54, 0x51, 0x51, 0x50,
-    0x50, 0x4b, 0x49, 0x48, 0x48, 0x43, 0x41, 0x41, 0x41, 0x3b, 0x3e, 0x39,
-    0x37, 0x37, 0x37, 0x42, 0x36, 0x35, 0x35, 0x35, 0x37, 0x41, 0x41, 0x64,
-    0x71, 0x5d, 0x59, 0x30, 0x2b, 0x2c, 0x27, 0x2c, 0x2c, 0x2c, 0x27, 0x27,
-    0x25, 0x23, 0x24, 0x24, 0x24, 0x24, 0x20, 0x1f, 0x1f, 0x1f, 0x1f, 0x1d,
-    0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x18, 0x19, 0x19, 0x19, 0x19, 0x18,
-    0x18, 0x18, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x18, 0x18,
-    0x17, 0x17, 0x17, 0x15, 0x12, 0x12, 0x12, 0x15, 0x15, 0x13, 0x12, 0x12,
-    0x11, 0x11, 0x11, 0x0d, 0x11, 0x0d, 0x0d, 0x0b, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0b, 0x0b, 0x0b, 0x08, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c,
-    0x2c, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2c,
-    0x27, 0x27, 0x2c, 0x2c, 0x2a, 0x2b, 0x2a, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x27, 0x27, 0x2c, 0x2c, 0x2a, 0x2b,
-    0x2b, 0x2a, 0x2b, 0x2c, 0x27, 0x27, 0x2c, 0x2b, 0x2d, 0x2e, 0x2e, 0x2e,
-    0x33, 0x2e, 0x2e, 0x2e, 0x2b, 0x2d, 0x2d, 0x2b, 0x2d, 0x2d, 0x2b, 0x2d,
-    0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x33, 0x30, 0x33, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x30, 0x30,
-    0x30, 0x30, 0x35, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35,
-    0x35, 0x42, 0x30, 0x30, 0x35, 0x36, 0x37, 0x37, 0x42, 0x36, 0x42, 0x42,
-    0x36, 0x36, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x41, 0x41, 0x45, 0x48,
-    0x48, 0x46, 0x4e, 0x4b, 0x4b, 0x4f, 0x50, 0x54, 0x6c, 0x82, 0xbe, 0xaf,
-    0x74, 0x5a, 0x5a, 0x58, 0x58, 0x57, 0x57, 0x58, 0x5d, 0x5b, 0x5e, 0x5e,
-    0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x74, 0xca, 0xa3, 0x77,
-    0x6f, 0x77, 0x77, 0x7c, 0x80, 0x88, 0x93, 0x9d, 0xa6, 0xba, 0xbe, 0xc2,
-    0xdf, 0xeb, 0xf0, 0xe8, 0xdb, 0xc7, 0xb3, 0xa7, 0xa0, 0x95, 0x93, 0x88,
-    0x80, 0x80, 0x96, 0xd1, 0xc6, 0x7a, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x61,
-    0x5e, 0x5a, 0x58, 0x54, 0x51, 0x51, 0x54, 0x51, 0x50, 0x4b, 0x49, 0x48,
-    0x43, 0x43, 0x43, 0x46, 0x46, 0x41, 0x3b, 0x39, 0x39, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x36, 0x42, 0x42, 0x35, 0x30, 0x37, 0x48, 0x53, 0x7f, 0x64,
-    0x3e, 0x2f, 0x2e, 0x27, 0x27, 0x2c, 0x2a, 0x2c, 0x27, 0x29, 0x23, 0x24,
-    0x24, 0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x1f, 0x1d, 0x1c, 0x1c, 0x1b, 0x1b,
-    0x1c, 0x19, 0x19, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x18, 0x18, 0x19, 0x1b,
-    0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x18, 0x17, 0x17, 0x17, 0x16, 0x15,
-    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x12, 0x15, 0x15, 0x12, 0x12, 0x11,
-    0x11, 0x11, 0x0d, 0x0d, 0x0f, 0x0f, 0x0f, 0x0f, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x2a, 0x2b, 0x2c, 0x2a, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x2c, 0x2a, 0x2b, 0x2e, 0x33, 0x33, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x2e,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2e, 0x2b, 0x2e, 0x2b, 0x2b, 0x2e, 0x2e,
-    0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x2f, 0x30, 0x30, 0x30, 0x2f, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x35, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x35, 0x30,
-    0x35, 0x42, 0x36, 0x37, 0x36, 0x36, 0x36, 0x37, 0x37, 0x37, 0x37, 0x39,
-    0x37, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41,
-    0x3b, 0x41, 0x41, 0x43, 0x46, 0x43, 0x41, 0x48, 0x49, 0x4f, 0x51, 0x57,
-    0x68, 0x6c, 0x74, 0x92, 0x8a, 0x9b, 0xaa, 0x60, 0x58, 0x5d, 0x58, 0x57,
-    0x57, 0x5d, 0x5a, 0x5b, 0x58, 0x5a, 0x5e, 0x5e, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x69, 0x89, 0xcd, 0x82, 0x77, 0x77, 0x77, 0x77, 0x7c,
-    0x84, 0x8e, 0x95, 0x9b, 0xa6, 0xba, 0xc5, 0xc7, 0xde, 0xe9, 0xf0, 0xea,
-    0xde, 0xc5, 0xb2, 0xa6, 0x9b, 0x95, 0x8e, 0x84, 0x84, 0x88, 0xc3, 0xd1,
-    0x8a, 0x6f, 0x6e, 0x62, 0x62, 0x62, 0x62, 0x61, 0x5e, 0x5a, 0x58, 0x57,
-    0x57, 0x54, 0x54, 0x51, 0x50, 0x4b, 0x49, 0x48, 0x43, 0x48, 0x4a, 0x41,
-    0x41, 0x41, 0x3b, 0x3e, 0x39, 0x37, 0x37, 0x37, 0x37, 0x36, 0x42, 0x42,
-    0x3a, 0x30, 0x38, 0x35, 0x33, 0x30, 0x48, 0x68, 0x58, 0x46, 0x2e, 0x27,
-    0x2c, 0x2a, 0x2b, 0x2b, 0x2c, 0x27, 0x25, 0x23, 0x24, 0x20, 0x20, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x22, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x1b,
-    0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x19, 0x19, 0x18, 0x18,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x15, 0x15, 0x15, 0x15,
-    0x15, 0x15, 0x15, 0x16, 0x15, 0x15, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x0d, 0x0f, 0x0d, 0x0d, 0x0d, 0x0b, 0x0b, 0x0b, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x27, 0x2c, 0x2a, 0x2c, 0x2c, 0x27, 0x27, 0x2c, 0x2a, 0x2c, 0x2a,
-    0x2b, 0x27, 0x27, 0x2c, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x2c, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2f,
-    0x30, 0x33, 0x2b, 0x2d, 0x33, 0x33, 0x30, 0x2e, 0x2b, 0x2d, 0x2d, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x2e, 0x2f, 0x30, 0x30, 0x30,
-    0x30, 0x2e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3a, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x3a, 0x35, 0x35, 0x35, 0x35, 0x30, 0x30, 0x35, 0x42, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x37, 0x37, 0x39,
-    0x3d, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x46,
-    0x46, 0x48, 0x49, 0x54, 0x6a, 0x6a, 0x8a, 0x8c, 0x8a, 0x71, 0x6c, 0x68,
-    0x58, 0x8a, 0x78, 0x54, 0x57, 0x57, 0x63, 0x63, 0x58, 0x5b, 0x58, 0x57,
-    0x5d, 0x5e, 0x5e, 0x5e, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5e,
-    0xb1, 0xbd, 0x74, 0x6f, 0x7c, 0x77, 0x7c, 0x80, 0x88, 0x8e, 0x95, 0x9b,
-    0xa7, 0xbf, 0xcc, 0xce, 0xdf, 0xea, 0xef, 0xe8, 0xde, 0xc1, 0xb0, 0xa2,
-    0x99, 0x93, 0x88, 0x84, 0x84, 0x92, 0xe0, 0xb6, 0x74, 0x6f, 0x69, 0x62,
-    0x62, 0x62, 0x62, 0x61, 0x5e, 0x5a, 0x58, 0x57, 0x57, 0x54, 0x54, 0x54,
-    0x50, 0x4b, 0x49, 0x48, 0x48, 0x43, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x3b,
-    0x3e, 0x37, 0x37, 0x37, 0x37, 0x37, 0x42, 0x42, 0x36, 0x3a, 0x30, 0x30,
-    0x2e, 0x30, 0x30, 0x42, 0x36, 0x39, 0x30, 0x2c, 0x25, 0x2c, 0x2b, 0x2b,
-    0x2c, 0x2c, 0x25, 0x23, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1f, 0x1f,
-    0x22, 0x1d, 0x1d, 0x1c, 0x1b, 0x19, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x18, 0x18, 0x17, 0x18, 0x18,
-    0x17, 0x17, 0x18, 0x17, 0x17, 0x17, 0x16, 0x15, 0x15, 0x15, 0x17, 0x17,
-    0x15, 0x15, 0x12, 0x11, 0x11, 0x12, 0x12, 0x11, 0x0d, 0x11, 0x0d, 0x0d,
-    0x11, 0x0d, 0x0f, 0x0f, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2a,
-    0x2a, 0x2b, 0x27, 0x27, 0x2c, 0x2c, 0x2a, 0x2c, 0x2b, 0x2a, 0x2c, 0x2b,
-    0x2b, 0x2b, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x2a, 0x2b, 0x2a, 0x2a, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x33, 0x33, 0x33, 0x2e, 0x2b, 0x2b, 0x2d, 0x2d, 0x2d, 0x2e, 0x2e, 0x2e,
-    0x2f, 0x30, 0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35,
-    0x30, 0x30, 0x42, 0x35, 0x35, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x42,
-    0x36, 0x36, 0x42, 0x30, 0x30, 0x30, 0x35, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x39, 0x39, 0x37, 0x37, 0x39, 0x39, 0x39, 0x39, 0x3b, 0x41, 0x3b, 0x3b,
-    0x3b, 0x41, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x46, 0x46, 0x6a, 0x96,
-    0xa5, 0xa4, 0x94, 0x54, 0x49, 0x50, 0x54, 0x52, 0x54, 0x97, 0x71, 0x51,
-    0x57, 0x57, 0x63, 0x63, 0x5d, 0x5b, 0x58, 0x58, 0x5a, 0x5e, 0x5e, 0x5e,
-    0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5e, 0xbd, 0xb7, 0x77, 0x6f,
-    0x7c, 0x77, 0x7c, 0x84, 0x8b, 0x93, 0x99, 0xa0, 0xb0, 0xc5, 0xcc, 0xdb,
-    0xe4, 0xed, 0xee, 0xe6, 0xdb, 0xbf, 0xae, 0xa2, 0x9b, 0x93, 0x88, 0x84,
-    0x88, 0xa3, 0xca, 0xcd, 0x9a, 0x80, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x5e,
-    0x5e, 0x5a, 0x58, 0x58, 0x57, 0x57, 0x57, 0x51, 0x50, 0x4f, 0x49, 0x48,
-    0x48, 0x48, 0x43, 0x4a, 0x46, 0x41, 0x3b, 0x3b, 0x3b, 0x3e, 0x37, 0x37,
-    0x37, 0x39, 0x36, 0x35, 0x35, 0x35, 0x30, 0x30, 0x30, 0x30, 0x2d, 0x2e,
-    0x27, 0x2b, 0x2f, 0x2c, 0x25, 0x27, 0x2c, 0x27, 0x27, 0x25, 0x24, 0x24,
-    0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x1f, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x22, 0x1c, 0x1b, 0x1b, 0x1b, 0x19, 0x1b, 0x1b, 0x1b,
-    0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x17, 0x17, 0x17, 0x15, 0x15, 0x15, 0x17, 0x17, 0x16, 0x15, 0x12, 0x12,
-    0x12, 0x12, 0x13, 0x12, 0x12, 0x11, 0x0d, 0x0d, 0x11, 0x0d, 0x0f, 0x0d,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2a, 0x2a, 0x2c, 0x2c, 0x2c, 0x27,
-    0x2c, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2d, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x33, 0x33, 0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x36,
-    0x42, 0x35, 0x35, 0x35, 0x30, 0x30, 0x30, 0x35, 0x36, 0x36, 0x35, 0x30,
-    0x30, 0x30, 0x35, 0x37, 0x39, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x3e, 0x3d, 0x41, 0x41, 0x3b, 0x3b, 0x41, 0x41, 0x3b, 0x41,
-    0x46, 0x46, 0x41, 0x41, 0x48, 0x53, 0xa0, 0x68, 0x4f, 0x50, 0x4b, 0x50,
-    0x51, 0x4f, 0x50, 0x58, 0x5e, 0x84, 0x58, 0x57, 0x57, 0x57, 0x58, 0x5b,
-    0x5a, 0x60, 0x5d, 0x5d, 0x5a, 0x5e, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x5e, 0xb3, 0xb8, 0x77, 0x6f, 0x7c, 0x7c, 0x80, 0x84,
-    0x8e, 0x95, 0x9b, 0xa7, 0xb7, 0xc1, 0xce, 0xe0, 0xe9, 0xef, 0xec, 0xe2,
-    0xdb, 0xc7, 0xb2, 0xa2, 0x99, 0x93, 0x8b, 0x8e, 0x99, 0x99, 0x88, 0xa9,
-    0xc8, 0xc1, 0x88, 0x69, 0x62, 0x61, 0x61, 0x61, 0x5e, 0x5a, 0x5d, 0x58,
-    0x57, 0x57, 0x57, 0x51, 0x50, 0x50, 0x4b, 0x49, 0x49, 0x49, 0x48, 0x43,
-    0x43, 0x46, 0x41, 0x41, 0x3b, 0x3e, 0x39, 0x37, 0x3e, 0x39, 0x37, 0x36,
-    0x42, 0x35, 0x35, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2d, 0x2d, 0x2b, 0x2b,
-    0x2a, 0x2c, 0x2b, 0x2c, 0x27, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24,
-    0x24, 0x24, 0x24, 0x20, 0x1f, 0x22, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x22,
-    0x1d, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x15, 0x15, 0x15, 0x12, 0x12, 0x12, 0x15, 0x15,
-    0x13, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x2a, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2a, 0x2e, 0x2b, 0x2b, 0x2a, 0x2b, 0x2d,
-    0x33, 0x2b, 0x2e, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x33, 0x33, 0x2f, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x2e, 0x2e, 0x2f, 0x30,
-    0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x36, 0x35, 0x35, 0x35, 0x30,
-    0x30, 0x30, 0x30, 0x35, 0x35, 0x42, 0x36, 0x42, 0x42, 0x42, 0x37, 0x37,
-    0x39, 0x39, 0x37, 0x39, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3b, 0x3e,
-    0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x46, 0x41, 0x43,
-    0x48, 0x4f, 0x96, 0x57, 0x4b, 0x4f, 0x4b, 0x4b, 0x50, 0x52, 0x58, 0x76,
-    0x5e, 0x5d, 0x57, 0x57, 0x57, 0x57, 0x5d, 0x5d, 0x5a, 0x5b, 0x5d, 0x5a,
-    0x5e, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x61, 0x62, 0x62, 0x62, 0x69,
-    0xa5, 0xbe, 0x77, 0x77, 0x7c, 0x7c, 0x80, 0x88, 0x93, 0x99, 0xa2, 0xb2,
-    0xbf, 0xc7, 0xd2, 0xe5, 0xef, 0xee, 0xe5, 0xdb, 0xcc, 0xc7, 0xc7, 0xad,
-    0x95, 0x93, 0x8e, 0xa2, 0x93, 0x80, 0x7c, 0x7c, 0x88, 0xbe, 0xca, 0x6c,
-    0x6f, 0x62, 0x61, 0x5e, 0x5e, 0x5a, 0x5b, 0x58, 0x58, 0x57, 0x54, 0x51,
-    0x50, 0x50, 0x4b, 0x49, 0x49, 0x49, 0x48, 0x43, 0x43, 0x46, 0x41, 0x41,
-    0x3b, 0x3b, 0x3d, 0x3d, 0x39, 0x37, 0x37, 0x37, 0x37, 0x42, 0x42, 0x36,
-    0x42, 0x35, 0x30, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b,
-    0x2a, 0x2a, 0x27, 0x23, 0x24, 0x24, 0x24, 0x23, 0x23, 0x24, 0x20, 0x1f,
-    0x1f, 0x22, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x1c, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x18, 0x17, 0x17, 0x17, 0x17,
-    0x15, 0x16, 0x16, 0x16, 0x15, 0x15, 0x15, 0x12, 0x13, 0x12, 0x11, 0x11,
-    0x12, 0x12, 0x12, 0x11, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x2c, 0x27, 0x27, 0x2c, 0x2c, 0x2a, 0x2b, 0x2a, 0x2a, 0x2b, 0x2c,
-    0x2c, 0x2c, 0x27, 0x2c, 0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2a,
-    0x2c, 0x2a, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x33, 0x30, 0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x2f, 0x2e, 0x30, 0x30, 0x35, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x3a, 0x42, 0x35, 0x35, 0x35, 0x35, 0x30, 0x30, 0x35, 0x35,
-    0x42, 0x36, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x3b, 0x3b, 0x3e, 0x3e, 0x3e, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x46, 0x43, 0x46, 0x43, 0x43, 0x49, 0x49, 0x9a, 0x68,
-    0x49, 0x4b, 0x4b, 0x4b, 0x50, 0x51, 0x60, 0x6e, 0x57, 0x54, 0x51, 0x57,
-    0x57, 0x57, 0x5b, 0x5a, 0x5a, 0x5b, 0x5d, 0x5a, 0x5e, 0x5e, 0x61, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x69, 0xb3, 0xbe, 0x7c, 0x77,
-    0x7c, 0x7c, 0x84, 0x8e, 0x95, 0x9c, 0xa6, 0xb2, 0xbb, 0xcc, 0xde, 0xe9,
-    0xf1, 0xed, 0xe2, 0xdb, 0xbf, 0xb8, 0xc7, 0xc2, 0xae, 0x99, 0xa0, 0x9b,
-    0x80, 0x7c, 0x77, 0x77, 0x77, 0x8a, 0xd7, 0x92, 0x5e, 0x62, 0x61, 0x61,
-    0x5e, 0x5a, 0x5a, 0x58, 0x58, 0x57, 0x57, 0x51, 0x51, 0x50, 0x4f, 0x49,
-    0x49, 0x49, 0x49, 0x48, 0x43, 0x46, 0x46, 0x43, 0x41, 0x3b, 0x3b, 0x3b,
-    0x39, 0x37, 0x39, 0x37, 0x37, 0x37, 0x37, 0x37, 0x42, 0x35, 0x30, 0x33,
-    0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2c, 0x25,
-    0x24, 0x23, 0x23, 0x23, 0x23, 0x23, 0x20, 0x1f, 0x1f, 0x22, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x16, 0x16, 0x17,
-    0x15, 0x15, 0x15, 0x15, 0x12, 0x13, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x2c, 0x2c,
-    0x2c, 0x2a, 0x2c, 0x2b, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x2b, 0x2c, 0x2a, 0x2c, 0x2c, 0x2c, 0x2b, 0x2a, 0x2c, 0x2a, 0x2d, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x33, 0x2f, 0x30, 0x33, 0x2e, 0x2e,
-    0x2e, 0x33, 0x2e, 0x30, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x2f, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35,
-    0x42, 0x35, 0x42, 0x42, 0x35, 0x35, 0x42, 0x42, 0x36, 0x37, 0x36, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x3b, 0x3e, 0x3e, 0x3e,
-    0x3e, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x43, 0x4a, 0x46, 0x48, 0x49, 0x64, 0xab, 0x68, 0x49, 0x4b, 0x52, 0x49,
-    0x4f, 0x54, 0x5e, 0x5e, 0x54, 0x54, 0x51, 0x54, 0x57, 0x58, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5e, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x6e, 0x8c, 0xd7, 0xa3, 0x7c, 0x77, 0x7c, 0x80, 0x84, 0x8e,
-    0x95, 0xa0, 0xa6, 0xb0, 0xba, 0xce, 0xdf, 0xea, 0xf0, 0xee, 0xe2, 0xd2,
-    0xc1, 0xb2, 0xa9, 0xab, 0xb7, 0xbf, 0xb0, 0x88, 0x80, 0x77, 0x77, 0x6f,
-    0x6f, 0x77, 0xbe, 0xb3, 0x6c, 0x62, 0x62, 0x61, 0x61, 0x5e, 0x5a, 0x58,
-    0x58, 0x57, 0x57, 0x54, 0x51, 0x50, 0x4f, 0x4b, 0x49, 0x49, 0x49, 0x48,
-    0x48, 0x48, 0x43, 0x48, 0x46, 0x41, 0x3b, 0x3d, 0x39, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x42, 0x35, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2c, 0x27, 0x24, 0x25, 0x24, 0x24,
-    0x23, 0x23, 0x20, 0x24, 0x24, 0x20, 0x1f, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x22, 0x1f, 0x1d, 0x1d, 0x1c, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x19, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x15, 0x15,
-    0x15, 0x15, 0x15, 0x15, 0x15, 0x12, 0x12, 0x11, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x2c, 0x2c, 0x2c,
-    0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2a, 0x2c, 0x2c, 0x27,
-    0x2a, 0x2c, 0x2a, 0x2a, 0x27, 0x27, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x30, 0x2e, 0x33, 0x30, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x30, 0x33, 0x2e, 0x33, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3a, 0x35, 0x35, 0x35, 0x36, 0x42,
-    0x42, 0x42, 0x37, 0x36, 0x37, 0x37, 0x36, 0x37, 0x37, 0x37, 0x37, 0x36,
-    0x37, 0x37, 0x36, 0x37, 0x39, 0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x4a, 0x41, 0x46, 0x43, 0x43, 0x43, 0x48,
-    0x49, 0x71, 0x92, 0x50, 0x49, 0x4b, 0x4b, 0x4b, 0x50, 0x51, 0x5d, 0x6c,
-    0x54, 0x54, 0x54, 0x57, 0x57, 0x5d, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5e,
-    0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x69, 0x62, 0x62, 0x62, 0x78, 0xbd,
-    0xb6, 0x80, 0x7c, 0x7c, 0x80, 0x80, 0x84, 0x8b, 0x93, 0x9b, 0xa6, 0xb0,
-    0xbb, 0xce, 0xe0, 0xea, 0xf1, 0xef, 0xe1, 0xce, 0xc1, 0xb2, 0xa7, 0xa2,
-    0xb2, 0xc2, 0xbe, 0x8a, 0x7c, 0x7c, 0x77, 0x6f, 0x77, 0x77, 0xa2, 0xd1,
-    0x85, 0x62, 0x61, 0x61, 0x62, 0x5e, 0x5e, 0x5d, 0x58, 0x58, 0x57, 0x54,
-    0x51, 0x50, 0x4f, 0x4b, 0x4b, 0x4b, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x43, 0x41, 0x3b, 0x3b, 0x3e, 0x37, 0x37, 0x37, 0x36, 0x37, 0x36, 0x35,
-    0x30, 0x30, 0x33, 0x2e, 0x30, 0x30, 0x2e, 0x33, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2b, 0x2b, 0x27, 0x25, 0x25, 0x25, 0x23, 0x23, 0x24, 0x23, 0x23,
-    0x25, 0x23, 0x24, 0x1f, 0x1f, 0x22, 0x1d, 0x1d, 0x1d, 0x1f, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x19, 0x19, 0x19, 0x18, 0x18, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x15, 0x15, 0x15, 0x15, 0x15,
-    0x12, 0x11, 0x11, 0x12, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x2b, 0x2b, 0x2a, 0x27, 0x27, 0x2c, 0x2a, 0x2c, 0x2b, 0x2b,
-    0x2c, 0x27, 0x2c, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x30, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2f, 0x30, 0x30, 0x30, 0x30,
-    0x2f, 0x33, 0x33, 0x30, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x3a, 0x35, 0x35, 0x42, 0x37, 0x42, 0x36, 0x36, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x37, 0x37,
-    0x39, 0x3e, 0x3e, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41,
-    0x43, 0x41, 0x41, 0x46, 0x43, 0x43, 0x48, 0x49, 0x4b, 0x8c, 0x68, 0x50,
-    0x49, 0x4b, 0x49, 0x4b, 0x50, 0x58, 0x74, 0x82, 0x57, 0x57, 0x57, 0x57,
-    0x58, 0x5d, 0x5a, 0x5a, 0x5a, 0x5a, 0x5e, 0x5e, 0x61, 0x61, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x6f, 0x6c, 0xa9, 0xc6, 0x7e, 0x77, 0x7c, 0x7c,
-    0x80, 0x84, 0x8b, 0x93, 0x95, 0x9b, 0xa7, 0xb2, 0xbb, 0xce, 0xe1, 0xec,
-    0xf1, 0xed, 0xe0, 0xce, 0xbf, 0xb2, 0xab, 0xb2, 0xb2, 0x9d, 0xb3, 0x9d,
-    0x80, 0x7c, 0x77, 0x6f, 0x77, 0x6f, 0x7a, 0xd1, 0x97, 0x6e, 0x61, 0x61,
-    0x62, 0x61, 0x5e, 0x5d, 0x58, 0x58, 0x57, 0x57, 0x54, 0x50, 0x4f, 0x4f,
-    0x4b, 0x4b, 0x49, 0x48, 0x48, 0x43, 0x43, 0x43, 0x43, 0x41, 0x3b, 0x3b,
-    0x3e, 0x37, 0x36, 0x42, 0x35, 0x42, 0x36, 0x36, 0x3a, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x27,
-    0x27, 0x27, 0x25, 0x23, 0x24, 0x20, 0x28, 0x23, 0x23, 0x23, 0x20, 0x1f,
-    0x1f, 0x1f, 0x1d, 0x1d, 0x1d, 0x1f, 0x1d, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
-    0x1b, 0x1b, 0x1b, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x18,
-    0x18, 0x19, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x17, 0x17, 0x16, 0x15, 0x15, 0x15, 0x12, 0x11, 0x12, 0x12,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27,
-    0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2a,
-    0x27, 0x27, 0x2c, 0x2b, 0x2a, 0x27, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x33, 0x33, 0x33, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x2e, 0x2e, 0x33, 0x33, 0x2e, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x35,
-    0x35, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x30, 0x35, 0x35,
-    0x35, 0x30, 0x35, 0x36, 0x37, 0x36, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39, 0x37, 0x39, 0x3e, 0x39, 0x3b,
-    0x41, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x46, 0x46,
-    0x46, 0x43, 0x48, 0x4b, 0x7b, 0x85, 0x51, 0x50, 0x4b, 0x49, 0x4f, 0x54,
-    0x76, 0x76, 0x6c, 0x6d, 0x57, 0x57, 0x58, 0x58, 0x58, 0x5d, 0x5d, 0x5a,
-    0x5a, 0x5a, 0x5e, 0x5e, 0x5e, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x7c, 0xc8, 0x97, 0x76, 0x77, 0x7c, 0x7c, 0x84, 0x84, 0x8e, 0x95,
-    0x99, 0xa0, 0xa7, 0xb2, 0xbe, 0xce, 0xe1, 0xed, 0xf1, 0xea, 0xdf, 0xcc,
-    0xc1, 0xb3, 0xb2, 0xba, 0xa6, 0x93, 0x93, 0xa6, 0x95, 0x84, 0x80, 0x77,
-    0x77, 0x77, 0x9a, 0xd1, 0x85, 0x69, 0x62, 0x61, 0x61, 0x61, 0x5e, 0x5a,
-    0x58, 0x58, 0x57, 0x54, 0x54, 0x50, 0x50, 0x50, 0x4f, 0x4b, 0x49, 0x48,
-    0x48, 0x48, 0x43, 0x41, 0x41, 0x41, 0x3b, 0x3b, 0x3e, 0x39, 0x37, 0x37,
-    0x37, 0x36, 0x36, 0x36, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2c, 0x2a, 0x2a, 0x2b, 0x2a, 0x27, 0x25,
-    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x1f, 0x1f, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1c, 0x1b, 0x1c, 0x1c, 0x1c, 0x1c, 0x1d, 0x1d, 0x1c,
-    0x1c, 0x1b, 0x1c, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x18, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17,
-    0x17, 0x16, 0x16, 0x15, 0x15, 0x15, 0x15, 0x15, 0x27, 0x27, 0x27, 0x2c,
-    0x27, 0x27, 0x27, 0x2c, 0x27, 0x2c, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x2c, 0x2b,
-    0x2b, 0x27, 0x27, 0x2a, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2e, 0x2d,
-    0x2d, 0x33, 0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x30, 0x30,
-    0x30, 0x30, 0x2f, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x33, 0x33, 0x2e, 0x33,
-    0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x35, 0x42, 0x35, 0x35, 0x35, 0x42, 0x30, 0x30, 0x35, 0x36,
-    0x37, 0x36, 0x36, 0x37, 0x37, 0x36, 0x36, 0x36, 0x36, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x39, 0x39, 0x39, 0x39, 0x3e, 0x3b, 0x41, 0x41, 0x41, 0x41,
-    0x46, 0x41, 0x46, 0x43, 0x43, 0x43, 0x43, 0x43, 0x46, 0x48, 0x48, 0x78,
-    0x89, 0x51, 0x50, 0x4f, 0x4b, 0x50, 0x5d, 0x6e, 0x6c, 0x57, 0x57, 0x57,
-    0x54, 0x57, 0x57, 0x57, 0x58, 0x58, 0x5d, 0x5a, 0x5a, 0x5a, 0x5e, 0x5e,
-    0x5e, 0x61, 0x62, 0x62, 0x62, 0x61, 0x61, 0x6f, 0x6f, 0x84, 0xcd, 0x88,
-    0x77, 0x77, 0x77, 0x7c, 0x80, 0x84, 0x8b, 0x93, 0x99, 0xa0, 0xa7, 0xb0,
-    0xbb, 0xce, 0xe0, 0xec, 0xf1, 0xea, 0xdf, 0xce, 0xc1, 0xb3, 0xb8, 0xb7,
-    0x9d, 0x95, 0x8e, 0x93, 0x95, 0x8c, 0x8c, 0x82, 0x80, 0x7a, 0xbd, 0xc0,
-    0x6f, 0x69, 0x62, 0x61, 0x61, 0x61, 0x5e, 0x5a, 0x58, 0x58, 0x57, 0x54,
-    0x54, 0x51, 0x50, 0x50, 0x50, 0x4b, 0x49, 0x48, 0x49, 0x48, 0x43, 0x41,
-    0x41, 0x41, 0x41, 0x3b, 0x3b, 0x3e, 0x39, 0x39, 0x37, 0x37, 0x36, 0x36,
-    0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x2e, 0x2b, 0x2e, 0x2b,
-    0x2c, 0x2c, 0x2a, 0x2b, 0x2e, 0x2b, 0x27, 0x27, 0x27, 0x25, 0x24, 0x20,
-    0x24, 0x24, 0x24, 0x24, 0x1f, 0x1f, 0x22, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c,
-    0x1b, 0x1b, 0x1d, 0x1d, 0x1c, 0x1d, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x19, 0x19, 0x19, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x16, 0x16,
-    0x15, 0x15, 0x15, 0x15, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x27, 0x2c, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2a, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x2a, 0x2c, 0x27, 0x27, 0x2b, 0x2a, 0x27, 0x2c, 0x2a,
-    0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33,
-    0x33, 0x30, 0x30, 0x2f, 0x2e, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x35,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35,
-    0x35, 0x35, 0x42, 0x36, 0x35, 0x30, 0x35, 0x37, 0x37, 0x36, 0x36, 0x36,
-    0x37, 0x37, 0x37, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39,
-    0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x46, 0x43,
-    0x43, 0x43, 0x46, 0x48, 0x48, 0x46, 0x64, 0x8a, 0x64, 0x50, 0x51, 0x4f,
-    0x4f, 0x51, 0x60, 0x58, 0x57, 0x51, 0x51, 0x54, 0x57, 0x57, 0x57, 0x57,
-    0x57, 0x58, 0x5b, 0x5a, 0x5e, 0x5e, 0x5e, 0x5e, 0x61, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x69, 0x6f, 0x69, 0x96, 0xcd, 0x84, 0x77, 0x77, 0x77, 0x7c,
-    0x80, 0x84, 0x8b, 0x93, 0x99, 0xa0, 0xa7, 0xb0, 0xba, 0xce, 0xe0, 0xea,
-    0xf1, 0xeb, 0xe0, 0xce, 0xc1, 0xb7, 0xb8, 0xae, 0x9b, 0x95, 0x88, 0x88,
-    0x80, 0x80, 0x80, 0x77, 0x7c, 0x84, 0xba, 0xc4, 0x69, 0x62, 0x69, 0x62,
-    0x61, 0x61, 0x5e, 0x5a, 0x60, 0x58, 0x58, 0x57, 0x57, 0x54, 0x50, 0x50,
-    0x50, 0x4b, 0x4b, 0x49, 0x49, 0x48, 0x48, 0x43, 0x41, 0x41, 0x41, 0x3b,
-    0x3b, 0x3e, 0x3e, 0x39, 0x39, 0x37, 0x37, 0x37, 0x42, 0x35, 0x35, 0x30,
-    0x30, 0x30, 0x30, 0x33, 0x2b, 0x2b, 0x2e, 0x2e, 0x2a, 0x2c, 0x2a, 0x2b,
-    0x2e, 0x2b, 0x2a, 0x27, 0x27, 0x27, 0x23, 0x24, 0x23, 0x24, 0x24, 0x23,
-    0x24, 0x1f, 0x1f, 0x22, 0x1d, 0x1c, 0x1d, 0x1d, 0x1b, 0x1b, 0x1b, 0x1c,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x16, 0x16, 0x15, 0x15, 0x15,
-    0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x2a, 0x2b, 0x2c, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2b,
-    0x2a, 0x27, 0x2c, 0x2b, 0x2b, 0x2a, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x33, 0x2e, 0x33, 0x2e, 0x2e,
-    0x30, 0x30, 0x2e, 0x30, 0x30, 0x30, 0x33, 0x30, 0x30, 0x30, 0x2f, 0x33,
-    0x33, 0x33, 0x30, 0x30, 0x3a, 0x35, 0x35, 0x35, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x35, 0x35, 0x35, 0x30, 0x35, 0x35, 0x35, 0x35, 0x42, 0x37,
-    0x42, 0x42, 0x42, 0x37, 0x37, 0x36, 0x37, 0x36, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x39, 0x39, 0x39, 0x37, 0x3e, 0x3e, 0x3b, 0x3b, 0x3b, 0x3b, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x46, 0x43, 0x48, 0x48, 0x44, 0x4f,
-    0x50, 0x78, 0x96, 0x68, 0x50, 0x51, 0x50, 0x4b, 0x4b, 0x50, 0x54, 0x54,
-    0x51, 0x51, 0x51, 0x54, 0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x5b, 0x5a,
-    0x5e, 0x5e, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f,
-    0x80, 0xbe, 0xb3, 0x80, 0x77, 0x77, 0x7c, 0x7c, 0x80, 0x88, 0x8e, 0x93,
-    0x99, 0x9c, 0xa6, 0xb0, 0xba, 0xcc, 0xde, 0xe8, 0xf1, 0xed, 0xe2, 0xd2,
-    0xc5, 0xb8, 0xb7, 0xae, 0x9b, 0x95, 0x8b, 0x84, 0x80, 0x7c, 0x77, 0x6f,
-    0x77, 0x78, 0xa5, 0xd3, 0x84, 0x6e, 0x62, 0x61, 0x61, 0x61, 0x5e, 0x5e,
-    0x5a, 0x58, 0x58, 0x58, 0x57, 0x54, 0x51, 0x50, 0x50, 0x4f, 0x4b, 0x49,
-    0x49, 0x48, 0x48, 0x43, 0x43, 0x46, 0x41, 0x41, 0x3b, 0x3b, 0x3b, 0x3e,
-    0x39, 0x39, 0x37, 0x37, 0x36, 0x36, 0x42, 0x35, 0x30, 0x30, 0x30, 0x2e,
-    0x2e, 0x2b, 0x2e, 0x2e, 0x2b, 0x2a, 0x2a, 0x2a, 0x2b, 0x2c, 0x27, 0x25,
-    0x25, 0x23, 0x25, 0x23, 0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x1f,
-    0x1d, 0x1d, 0x22, 0x1d, 0x1d, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x17, 0x17, 0x17, 0x15, 0x15, 0x15, 0x15, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x27, 0x27, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x27, 0x2c, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b,
-    0x2d, 0x33, 0x2e, 0x33, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x35, 0x35, 0x35, 0x35, 0x30, 0x30, 0x30, 0x35, 0x35, 0x42, 0x37, 0x36,
-    0x42, 0x42, 0x36, 0x42, 0x35, 0x30, 0x35, 0x37, 0x42, 0x35, 0x36, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x3d, 0x39, 0x39,
-    0x39, 0x3e, 0x3e, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x46, 0x46, 0x46, 0x43, 0x43, 0x48, 0x49, 0x50, 0x6c, 0x85, 0x68, 0x49,
-    0x50, 0x4f, 0x4b, 0x4b, 0x4f, 0x4b, 0x4f, 0x50, 0x50, 0x51, 0x54, 0x53,
-    0x57, 0x57, 0x57, 0x58, 0x58, 0x58, 0x5d, 0x5a, 0x5a, 0x5e, 0x61, 0x61,
-    0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x74, 0xba, 0xb2, 0x7c, 0x77,
-    0x77, 0x77, 0x7c, 0x7c, 0x80, 0x88, 0x8e, 0x95, 0x99, 0xa0, 0xa6, 0xb0,
-    0xba, 0xcc, 0xdb, 0xe6, 0xf0, 0xef, 0xe5, 0xdb, 0xc7, 0xbe, 0xba, 0xb0,
-    0x9b, 0x95, 0x8e, 0x8b, 0x84, 0x80, 0x7c, 0x77, 0x6f, 0x74, 0x92, 0xd7,
-    0x9d, 0x76, 0x69, 0x62, 0x5e, 0x62, 0x61, 0x5e, 0x5a, 0x5d, 0x58, 0x58,
-    0x57, 0x57, 0x51, 0x50, 0x50, 0x50, 0x4b, 0x4b, 0x49, 0x48, 0x43, 0x43,
-    0x43, 0x43, 0x41, 0x41, 0x3b, 0x3b, 0x3b, 0x3b, 0x3e, 0x39, 0x39, 0x39,
-    0x37, 0x37, 0x36, 0x35, 0x35, 0x35, 0x30, 0x30, 0x30, 0x33, 0x30, 0x2e,
-    0x2e, 0x2b, 0x2a, 0x2a, 0x2a, 0x2c, 0x27, 0x25, 0x25, 0x23, 0x25, 0x25,
-    0x25, 0x23, 0x23, 0x24, 0x24, 0x23, 0x23, 0x24, 0x1f, 0x22, 0x1f, 0x1f,
-    0x1d, 0x1d, 0x22, 0x22, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x1b, 0x1c, 0x1c, 0x1b, 0x1b, 0x1b, 0x19,
-    0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x18, 0x18, 0x17, 0x17, 0x17,
-    0x15, 0x15, 0x12, 0x15, 0x27, 0x27, 0x27, 0x25, 0x23, 0x25, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x2a, 0x2b, 0x2d, 0x2b, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x2c, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x30, 0x33,
-    0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x42, 0x42, 0x37, 0x37, 0x42,
-    0x35, 0x30, 0x30, 0x42, 0x35, 0x3a, 0x42, 0x36, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3e, 0x3b, 0x39, 0x37, 0x39, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x46, 0x41, 0x41, 0x46, 0x43,
-    0x48, 0x48, 0x50, 0x53, 0x7f, 0x51, 0x50, 0x4f, 0x4f, 0x4b, 0x4b, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x50, 0x50, 0x51, 0x54, 0x57, 0x58, 0x58, 0x58, 0x58,
-    0x58, 0x58, 0x5d, 0x5a, 0x5a, 0x5e, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x6e, 0x8c, 0xc7, 0x7a, 0x6e, 0x77, 0x77, 0x77, 0x7c, 0x80,
-    0x84, 0x8b, 0x93, 0x95, 0x99, 0xa0, 0xa6, 0xb0, 0xb8, 0xcb, 0xdb, 0xe5,
-    0xef, 0xf1, 0xe7, 0xdb, 0xcb, 0xc1, 0xbf, 0xa9, 0x9b, 0x99, 0x93, 0x8e,
-    0x84, 0x80, 0x7c, 0x77, 0x6f, 0x77, 0x7c, 0xb7, 0xc8, 0x9a, 0x6f, 0x61,
-    0x61, 0x62, 0x61, 0x5e, 0x5a, 0x5d, 0x58, 0x58, 0x57, 0x54, 0x54, 0x50,
-    0x50, 0x50, 0x4b, 0x4b, 0x49, 0x48, 0x43, 0x43, 0x43, 0x4a, 0x41, 0x41,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3e, 0x39, 0x39, 0x39, 0x39, 0x37, 0x36,
-    0x42, 0x35, 0x30, 0x30, 0x30, 0x33, 0x33, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2a, 0x27, 0x27, 0x27, 0x25, 0x25, 0x25, 0x23, 0x24, 0x24,
-    0x24, 0x23, 0x23, 0x23, 0x1f, 0x1f, 0x20, 0x1f, 0x22, 0x22, 0x22, 0x1f,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x15, 0x15, 0x12, 0x15,
-    0x27, 0x25, 0x25, 0x23, 0x23, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x33,
-    0x2b, 0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2d, 0x2d, 0x2b, 0x2e, 0x2e, 0x33, 0x30, 0x30, 0x2f, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x35, 0x35, 0x42, 0x36, 0x38, 0x42, 0x42, 0x3a, 0x35, 0x30, 0x35,
-    0x35, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39, 0x3e,
-    0x3e, 0x3b, 0x3b, 0x39, 0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x3b, 0x3b,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x48, 0x48, 0x48, 0x68, 0x7f,
-    0x6d, 0x51, 0x50, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x50, 0x50, 0x50, 0x50,
-    0x51, 0x54, 0x54, 0x54, 0x58, 0x58, 0x5d, 0x5d, 0x5d, 0x5d, 0x5a, 0x5a,
-    0x5e, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x69, 0x9d,
-    0xba, 0x74, 0x77, 0x77, 0x77, 0x7c, 0x7c, 0x80, 0x84, 0x8e, 0x93, 0x95,
-    0x99, 0xa0, 0xa6, 0xae, 0xba, 0xcb, 0xdb, 0xe5, 0xef, 0xf0, 0xe8, 0xde,
-    0xce, 0xc7, 0xba, 0xa9, 0xa0, 0x99, 0x95, 0x8e, 0x84, 0x80, 0x7c, 0x77,
-    0x77, 0x77, 0x77, 0x74, 0xaf, 0xca, 0x69, 0x61, 0x62, 0x62, 0x61, 0x5e,
-    0x5a, 0x5d, 0x58, 0x58, 0x57, 0x54, 0x54, 0x51, 0x50, 0x50, 0x4b, 0x4b,
-    0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x43, 0x41, 0x41, 0x41, 0x41, 0x3b,
-    0x3e, 0x3e, 0x39, 0x39, 0x39, 0x39, 0x37, 0x36, 0x36, 0x36, 0x35, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x27, 0x25, 0x25, 0x23, 0x23, 0x25, 0x23, 0x24, 0x24, 0x23,
-    0x24, 0x20, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x22, 0x22, 0x1d, 0x1d,
-    0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x19, 0x19, 0x1b, 0x19, 0x19, 0x1a, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x25, 0x23, 0x25, 0x25,
-    0x23, 0x25, 0x27, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x33, 0x2e, 0x2e, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x30, 0x30, 0x35, 0x42, 0x42,
-    0x42, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x36, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x3e, 0x37, 0x37, 0x3b, 0x3b, 0x3e,
-    0x39, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x43, 0x43, 0x48, 0x48, 0x49, 0x85, 0x68, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x50, 0x50, 0x4f, 0x4f, 0x50, 0x51, 0x51, 0x51, 0x51, 0x51, 0x57, 0x57,
-    0x57, 0x58, 0x58, 0x58, 0x5d, 0x5b, 0x5a, 0x5a, 0x5e, 0x5e, 0x61, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6c, 0xba, 0xb3, 0x7c, 0x77, 0x77,
-    0x77, 0x7c, 0x7c, 0x80, 0x88, 0x88, 0x93, 0x95, 0x99, 0xa0, 0xa7, 0xb0,
-    0xbf, 0xd2, 0xdb, 0xe4, 0xef, 0xf0, 0xea, 0xe0, 0xd2, 0xc7, 0xba, 0xae,
-    0xa2, 0x9b, 0x95, 0x8e, 0x84, 0x80, 0x7c, 0x77, 0x77, 0x77, 0x6f, 0x6e,
-    0xa8, 0xc4, 0x5e, 0x62, 0x62, 0x62, 0x61, 0x5e, 0x5e, 0x5a, 0x5d, 0x58,
-    0x57, 0x57, 0x54, 0x51, 0x51, 0x51, 0x4f, 0x4b, 0x4b, 0x49, 0x48, 0x48,
-    0x48, 0x48, 0x43, 0x43, 0x46, 0x41, 0x3b, 0x3b, 0x3e, 0x3e, 0x39, 0x39,
-    0x39, 0x37, 0x37, 0x36, 0x36, 0x42, 0x35, 0x42, 0x35, 0x30, 0x30, 0x2f,
-    0x2e, 0x30, 0x2e, 0x2e, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2a, 0x27, 0x27,
-    0x25, 0x23, 0x25, 0x23, 0x25, 0x24, 0x24, 0x23, 0x24, 0x20, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x22, 0x22, 0x22, 0x22, 0x1d, 0x1d, 0x1d, 0x1c,
-    0x1c, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17,
-    0x17, 0x17, 0x18, 0x18, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x27, 0x27,
-    0x25, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x2c, 0x2b, 0x2c, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e,
-    0x33, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x30, 0x30,
-    0x30, 0x35, 0x35, 0x35, 0x35, 0x35, 0x36, 0x37, 0x42, 0x35, 0x30, 0x35,
-    0x42, 0x42, 0x36, 0x36, 0x42, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3e, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x41, 0x41, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x46, 0x46, 0x43,
-    0x48, 0x4f, 0x8c, 0x68, 0x49, 0x4b, 0x49, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x51, 0x54, 0x54, 0x54, 0x50, 0x54, 0x57, 0x58, 0x57, 0x58, 0x58, 0x5d,
-    0x60, 0x5b, 0x5a, 0x5a, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x6f, 0x74, 0xc8, 0xaf, 0x7c, 0x77, 0x77, 0x7c, 0x7c, 0x80, 0x84,
-    0x88, 0x8e, 0x93, 0x95, 0x99, 0xa2, 0xaa, 0xb5, 0xc1, 0xcc, 0xd8, 0xe1,
-    0xeb, 0xf1, 0xec, 0xe1, 0xd8, 0xc7, 0xb8, 0xae, 0xa2, 0x9b, 0x95, 0x8e,
-    0x84, 0x80, 0x7c, 0x77, 0x77, 0x77, 0x6f, 0x6f, 0xa8, 0xc9, 0x6c, 0x62,
-    0x62, 0x62, 0x62, 0x61, 0x5e, 0x5a, 0x5a, 0x58, 0x57, 0x57, 0x51, 0x51,
-    0x50, 0x51, 0x50, 0x4f, 0x4b, 0x49, 0x48, 0x48, 0x48, 0x48, 0x43, 0x43,
-    0x46, 0x41, 0x41, 0x3b, 0x3b, 0x3e, 0x39, 0x37, 0x39, 0x37, 0x37, 0x37,
-    0x42, 0x35, 0x30, 0x42, 0x36, 0x35, 0x30, 0x30, 0x2e, 0x33, 0x2e, 0x2e,
-    0x2e, 0x33, 0x33, 0x2e, 0x2b, 0x2b, 0x2c, 0x2c, 0x27, 0x25, 0x25, 0x27,
-    0x25, 0x24, 0x24, 0x24, 0x20, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x22, 0x22, 0x22, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x18, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x24, 0x23, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x25, 0x27, 0x27, 0x2b, 0x2a, 0x2c, 0x2b, 0x2b, 0x2a, 0x27, 0x2a, 0x2b,
-    0x2c, 0x27, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2d, 0x2d,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x2e,
-    0x2e, 0x33, 0x30, 0x30, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x35, 0x42,
-    0x35, 0x42, 0x36, 0x36, 0x36, 0x35, 0x42, 0x42, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x36, 0x37, 0x37, 0x37, 0x37, 0x36, 0x36, 0x37, 0x39, 0x3e, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x46, 0x46, 0x43, 0x43, 0x4b, 0x53, 0x85, 0x57,
-    0x49, 0x4b, 0x52, 0x51, 0x50, 0x50, 0x50, 0x51, 0x51, 0x54, 0x57, 0x54,
-    0x54, 0x54, 0x58, 0x58, 0x58, 0x58, 0x58, 0x5d, 0x5a, 0x5a, 0x5e, 0x5e,
-    0x5e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x89, 0xd6,
-    0x9d, 0x77, 0x77, 0x77, 0x7c, 0x7c, 0x80, 0x80, 0x88, 0x8e, 0x93, 0x95,
-    0x9c, 0xa6, 0xaa, 0xb2, 0xb8, 0xc2, 0xd2, 0xde, 0xe8, 0xf1, 0xee, 0xe5,
-    0xdb, 0xc7, 0xba, 0xb0, 0xa6, 0x9c, 0x95, 0x8e, 0x84, 0x84, 0x7c, 0x7c,
-    0x77, 0x77, 0x77, 0x77, 0x9f, 0xd4, 0x74, 0x6f, 0x62, 0x62, 0x62, 0x61,
-    0x5e, 0x5a, 0x5a, 0x58, 0x57, 0x57, 0x51, 0x50, 0x51, 0x51, 0x4b, 0x4b,
-    0x4b, 0x48, 0x48, 0x48, 0x48, 0x48, 0x43, 0x43, 0x46, 0x41, 0x41, 0x3b,
-    0x3b, 0x3b, 0x39, 0x39, 0x37, 0x37, 0x37, 0x37, 0x36, 0x42, 0x35, 0x42,
-    0x37, 0x35, 0x30, 0x30, 0x2e, 0x30, 0x30, 0x33, 0x2e, 0x33, 0x30, 0x2e,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x25, 0x24, 0x24, 0x23,
-    0x20, 0x1f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1f, 0x22, 0x1f, 0x1f, 0x1f,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1c, 0x1b, 0x1b,
-    0x1b, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x23, 0x23, 0x23, 0x27,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x2a, 0x27, 0x2c, 0x27, 0x27, 0x25, 0x27, 0x2c, 0x2c,
-    0x2c, 0x27, 0x2c, 0x2c, 0x2c, 0x27, 0x2a, 0x2b, 0x27, 0x2c, 0x2c, 0x2b,
-    0x2b, 0x2a, 0x2b, 0x2e, 0x33, 0x2e, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x30, 0x2e, 0x2e, 0x2e, 0x33, 0x30, 0x2e, 0x33, 0x33, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x35, 0x30, 0x35, 0x35, 0x42, 0x42, 0x42, 0x36, 0x36,
-    0x42, 0x35, 0x42, 0x42, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39,
-    0x39, 0x37, 0x37, 0x37, 0x37, 0x39, 0x3e, 0x39, 0x39, 0x3b, 0x41, 0x3b,
-    0x41, 0x41, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x4a,
-    0x43, 0x43, 0x48, 0x48, 0x4b, 0x50, 0x88, 0x53, 0x4e, 0x49, 0x4b, 0x4f,
-    0x50, 0x50, 0x50, 0x50, 0x51, 0x54, 0x57, 0x57, 0x57, 0x57, 0x5d, 0x5d,
-    0x58, 0x58, 0x5d, 0x5a, 0x5a, 0x5a, 0x5e, 0x5e, 0x5e, 0x61, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x6f, 0x77, 0xb8, 0xc6, 0x80, 0x76, 0x77, 0x77,
-    0x7c, 0x7c, 0x80, 0x84, 0x88, 0x8e, 0x93, 0x95, 0x9c, 0xa2, 0xa9, 0xb0,
-    0xb7, 0xbf, 0xcb, 0xdb, 0xe6, 0xef, 0xf0, 0xe8, 0xde, 0xcb, 0xbf, 0xb0,
-    0xa6, 0xa0, 0x99, 0x93, 0x8b, 0x84, 0x80, 0x7c, 0x77, 0x77, 0x6f, 0x6f,
-    0x92, 0xd9, 0x85, 0x69, 0x62, 0x62, 0x62, 0x61, 0x5e, 0x5e, 0x5a, 0x58,
-    0x58, 0x57, 0x54, 0x51, 0x50, 0x50, 0x4b, 0x4b, 0x4b, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x43, 0x43, 0x43, 0x41, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x39,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x42, 0x35, 0x42, 0x36, 0x35, 0x35, 0x30,
-    0x30, 0x30, 0x30, 0x33, 0x33, 0x2f, 0x30, 0x2e, 0x2e, 0x2b, 0x2d, 0x2b,
-    0x2c, 0x27, 0x27, 0x27, 0x25, 0x23, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1b, 0x19, 0x19,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x19,
-    0x19, 0x18, 0x18, 0x19, 0x24, 0x24, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2c,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2c, 0x27, 0x27, 0x2c, 0x27,
-    0x2c, 0x27, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2c, 0x2c, 0x2c, 0x2b, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
-    0x30, 0x30, 0x30, 0x35, 0x35, 0x42, 0x35, 0x42, 0x42, 0x42, 0x36, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3e, 0x39, 0x37, 0x37, 0x39,
-    0x37, 0x39, 0x3b, 0x3b, 0x39, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x3b, 0x3b,
-    0x3b, 0x41, 0x41, 0x43, 0x46, 0x4a, 0x4a, 0x4a, 0x43, 0x48, 0x49, 0x49,
-    0x4b, 0x50, 0x76, 0x54, 0x50, 0x50, 0x4f, 0x4f, 0x4f, 0x50, 0x50, 0x50,
-    0x51, 0x51, 0x54, 0x57, 0x58, 0x58, 0x58, 0x58, 0x5d, 0x5d, 0x5a, 0x5e,
-    0x5e, 0x5e, 0x62, 0x61, 0x61, 0x61, 0x62, 0x62, 0x61, 0x62, 0x62, 0x62,
-    0x6f, 0x80, 0xcb, 0xa3, 0x77, 0x6f, 0x77, 0x77, 0x7c, 0x7c, 0x80, 0x80,
-    0x88, 0x8e, 0x93, 0x99, 0x99, 0xa0, 0xa7, 0xb2, 0xb7, 0xbf, 0xcb, 0xdb,
-    0xe4, 0xed, 0xf0, 0xe9, 0xde, 0xcc, 0xbf, 0xb2, 0xa7, 0xa0, 0x9b, 0x95,
-    0x8e, 0x84, 0x80, 0x7c, 0x77, 0x77, 0x6f, 0x6f, 0x7e, 0xca, 0xbe, 0x88,
-    0x69, 0x62, 0x62, 0x62, 0x5e, 0x5a, 0x5b, 0x5b, 0x58, 0x57, 0x54, 0x51,
-    0x51, 0x50, 0x4f, 0x4b, 0x4b, 0x49, 0x48, 0x48, 0x48, 0x48, 0x43, 0x43,
-    0x41, 0x41, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x39, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x36, 0x35, 0x42, 0x42, 0x35, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x2f, 0x33, 0x33, 0x2e, 0x2d, 0x2b, 0x2b, 0x2c, 0x27, 0x27,
-    0x25, 0x23, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c,
-    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x1b, 0x19, 0x18, 0x18, 0x19,
-    0x24, 0x23, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2a, 0x2c, 0x2a, 0x2b,
-    0x2c, 0x2c, 0x2a, 0x2b, 0x2c, 0x2b, 0x2e, 0x2d, 0x2b, 0x2e, 0x33, 0x30,
-    0x2e, 0x2e, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x33,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
-    0x35, 0x42, 0x36, 0x37, 0x36, 0x42, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x39, 0x3e, 0x3e, 0x37, 0x39, 0x3e, 0x3e, 0x3e, 0x3e,
-    0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x46, 0x43, 0x43, 0x46, 0x48, 0x48, 0x49, 0x49, 0x5d, 0x6d, 0x51,
-    0x50, 0x50, 0x50, 0x51, 0x51, 0x50, 0x50, 0x50, 0x54, 0x54, 0x54, 0x57,
-    0x57, 0x58, 0x58, 0x58, 0x5d, 0x5b, 0x5e, 0x5a, 0x5e, 0x5e, 0x61, 0x61,
-    0x61, 0x62, 0x62, 0x61, 0x61, 0x6f, 0x6e, 0x6e, 0x6e, 0x84, 0xc8, 0x80,
-    0x77, 0x77, 0x77, 0x77, 0x7c, 0x7c, 0x80, 0x84, 0x88, 0x8b, 0x93, 0x99,
-    0x9b, 0xa0, 0xa7, 0xb0, 0xb5, 0xbb, 0xc7, 0xd2, 0xe2, 0xeb, 0xef, 0xeb,
-    0xe0, 0xce, 0xc1, 0xb2, 0xaa, 0xa2, 0x9c, 0x95, 0x8e, 0x84, 0x80, 0x7c,
-    0x77, 0x77, 0x6f, 0x77, 0x7c, 0x78, 0xb3, 0xcd, 0xa5, 0x84, 0x69, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x5b, 0x57, 0x54, 0x51, 0x51, 0x51, 0x50, 0x4f,
-    0x4f, 0x49, 0x49, 0x49, 0x48, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x3b,
-    0x3b, 0x3d, 0x3b, 0x3b, 0x3e, 0x37, 0x39, 0x37, 0x37, 0x35, 0x30, 0x35,
-    0x35, 0x42, 0x36, 0x42, 0x35, 0x30, 0x30, 0x33, 0x30, 0x30, 0x2e, 0x2e,
-    0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x25, 0x24, 0x24, 0x25, 0x25,
-    0x25, 0x23, 0x24, 0x21, 0x21, 0x21, 0x20, 0x24, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x1d, 0x1d, 0x1d, 0x22, 0x1d, 0x1d, 0x1c, 0x1c, 0x1b, 0x1c, 0x1c, 0x1d,
-    0x1d, 0x1c, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x19, 0x1b, 0x1b, 0x19, 0x19, 0x19, 0x23, 0x24, 0x25, 0x25,
-    0x25, 0x27, 0x27, 0x27, 0x23, 0x23, 0x25, 0x25, 0x23, 0x27, 0x25, 0x27,
-    0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2a, 0x2b, 0x2c, 0x27, 0x2a, 0x2b,
-    0x2a, 0x2b, 0x2e, 0x2d, 0x2b, 0x2e, 0x33, 0x30, 0x2e, 0x2b, 0x2b, 0x2e,
-    0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x35, 0x30, 0x30, 0x30, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
-    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x42, 0x37, 0x37,
-    0x37, 0x42, 0x42, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x3d,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3e, 0x3e, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x48,
-    0x48, 0x48, 0x48, 0x49, 0x4f, 0x71, 0x58, 0x51, 0x50, 0x50, 0x50, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x54, 0x57, 0x57, 0x57, 0x58, 0x58, 0x5d, 0x5b,
-    0x5b, 0x5a, 0x5e, 0x5e, 0x5e, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x69, 0x6e, 0x6f, 0x6f, 0x77, 0xb1, 0xc1, 0x7c, 0x77, 0x77, 0x77, 0x77,
-    0x7c, 0x7c, 0x80, 0x84, 0x8b, 0x8e, 0x93, 0x9b, 0xa0, 0xa2, 0xa7, 0xb0,
-    0xb5, 0xbf, 0xcb, 0xd8, 0xe1, 0xeb, 0xef, 0xeb, 0xe0, 0xce, 0xbf, 0xb5,
-    0xab, 0xa6, 0xa0, 0x95, 0x8e, 0x84, 0x80, 0x7c, 0x7c, 0x77, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x77, 0x9d, 0xba, 0xba, 0xb1, 0x9b, 0x69, 0x5a, 0x5a, 0x5a,
-    0x58, 0x58, 0x57, 0x51, 0x54, 0x54, 0x50, 0x50, 0x4f, 0x49, 0x49, 0x49,
-    0x48, 0x48, 0x48, 0x43, 0x41, 0x41, 0x41, 0x3b, 0x3b, 0x3d, 0x3b, 0x3b,
-    0x3e, 0x39, 0x39, 0x39, 0x37, 0x36, 0x42, 0x35, 0x36, 0x37, 0x37, 0x36,
-    0x42, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2b, 0x2d, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x27, 0x25, 0x28, 0x23, 0x25, 0x25, 0x25, 0x23, 0x24, 0x24,
-    0x20, 0x20, 0x20, 0x24, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1c, 0x1c, 0x1b, 0x1c, 0x1c, 0x1d, 0x1d, 0x1c, 0x1b, 0x1b,
-    0x19, 0x19, 0x19, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x1b,
-    0x1b, 0x1b, 0x19, 0x18, 0x23, 0x23, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x23, 0x23, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x2c, 0x27, 0x27, 0x2b, 0x2a, 0x27, 0x2c, 0x2c, 0x2c, 0x2b,
-    0x2b, 0x2b, 0x2c, 0x2b, 0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x35, 0x35, 0x3a, 0x35, 0x35, 0x42, 0x35, 0x42, 0x35, 0x35, 0x35, 0x35,
-    0x42, 0x35, 0x35, 0x42, 0x42, 0x36, 0x37, 0x37, 0x37, 0x42, 0x35, 0x36,
-    0x37, 0x37, 0x39, 0x37, 0x39, 0x39, 0x3e, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3e, 0x3e, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x46, 0x43, 0x43, 0x48, 0x48, 0x48, 0x48, 0x4b, 0x49, 0x49, 0x50,
-    0x5d, 0x71, 0x54, 0x51, 0x50, 0x50, 0x50, 0x51, 0x51, 0x51, 0x54, 0x54,
-    0x57, 0x58, 0x58, 0x5d, 0x5d, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5e, 0x61,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6e, 0x77,
-    0xb1, 0xc2, 0x8a, 0x77, 0x77, 0x77, 0x7c, 0x7c, 0x7c, 0x80, 0x80, 0x8b,
-    0x8e, 0x8e, 0x95, 0x99, 0x9d, 0xa2, 0xa7, 0xb0, 0xb7, 0xbb, 0xcb, 0xd8,
-    0xe0, 0xeb, 0xf0, 0xea, 0xde, 0xce, 0xbf, 0xb3, 0xae, 0xa6, 0xa0, 0x95,
-    0x8e, 0x88, 0x80, 0x7c, 0x7c, 0x77, 0x6f, 0x6e, 0x6e, 0x69, 0x6f, 0x69,
-    0x6e, 0x76, 0x8a, 0xb6, 0xbe, 0x88, 0x5e, 0x5e, 0x5a, 0x58, 0x53, 0x57,
-    0x57, 0x54, 0x50, 0x50, 0x4f, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x43,
-    0x41, 0x4a, 0x41, 0x3b, 0x3b, 0x3b, 0x41, 0x3b, 0x3e, 0x39, 0x39, 0x39,
-    0x37, 0x37, 0x36, 0x42, 0x37, 0x37, 0x37, 0x36, 0x36, 0x35, 0x30, 0x30,
-    0x30, 0x30, 0x2e, 0x33, 0x2d, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x27, 0x27,
-    0x23, 0x25, 0x27, 0x27, 0x23, 0x23, 0x23, 0x24, 0x20, 0x20, 0x20, 0x20,
-    0x1f, 0x20, 0x21, 0x1f, 0x1f, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1c, 0x1c, 0x1c, 0x1c, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x1b, 0x19, 0x19, 0x18,
-    0x23, 0x23, 0x23, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x25, 0x25, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27,
-    0x27, 0x2a, 0x2c, 0x27, 0x2a, 0x2a, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x27, 0x27, 0x2b, 0x2b, 0x2b, 0x2d, 0x2e, 0x2e, 0x30, 0x30, 0x2e,
-    0x2e, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x35, 0x35,
-    0x35, 0x36, 0x42, 0x42, 0x36, 0x35, 0x42, 0x36, 0x36, 0x35, 0x35, 0x35,
-    0x42, 0x36, 0x37, 0x37, 0x37, 0x42, 0x42, 0x36, 0x37, 0x39, 0x39, 0x3e,
-    0x3e, 0x3b, 0x3b, 0x3b, 0x41, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41,
-    0x41, 0x41, 0x4a, 0x43, 0x43, 0x43, 0x43, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x4f, 0x58, 0x69, 0x54, 0x51, 0x51,
-    0x50, 0x50, 0x50, 0x51, 0x51, 0x54, 0x54, 0x57, 0x58, 0x58, 0x5b, 0x5b,
-    0x5a, 0x5a, 0x5e, 0x5e, 0x5e, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x6c, 0xab, 0xc3, 0x7e, 0x6e, 0x77,
-    0x77, 0x77, 0x77, 0x7c, 0x80, 0x80, 0x84, 0x8b, 0x93, 0x93, 0x99, 0x9b,
-    0xa0, 0xa2, 0xaa, 0xb2, 0xb7, 0xbf, 0xcb, 0xd8, 0xe1, 0xeb, 0xf0, 0xe9,
-    0xde, 0xce, 0xbb, 0xb2, 0xa7, 0xa2, 0x99, 0x95, 0x8e, 0x88, 0x80, 0x7c,
-    0x7c, 0x77, 0x77, 0x6f, 0x6e, 0x6f, 0x62, 0x69, 0x5e, 0x69, 0x61, 0x6c,
-    0x8c, 0xb3, 0xa2, 0x5e, 0x5b, 0x5a, 0x57, 0x57, 0x57, 0x54, 0x51, 0x50,
-    0x50, 0x4b, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x43, 0x43, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x3b, 0x3b, 0x39, 0x37, 0x39, 0x37, 0x37, 0x36, 0x42,
-    0x42, 0x42, 0x37, 0x36, 0x42, 0x35, 0x30, 0x30, 0x2f, 0x2e, 0x2e, 0x2e,
-    0x2d, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x25,
-    0x23, 0x24, 0x23, 0x23, 0x23, 0x24, 0x20, 0x20, 0x20, 0x24, 0x24, 0x20,
-    0x21, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x1c, 0x1b, 0x1b,
-    0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1c, 0x1c, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x19, 0x19, 0x1b, 0x19, 0x19, 0x19, 0x18, 0x23, 0x23, 0x25, 0x29,
-    0x27, 0x27, 0x25, 0x23, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
-    0x2b, 0x2b, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2c, 0x2c, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2e, 0x33, 0x33, 0x30, 0x33, 0x2e, 0x33, 0x33, 0x2e,
-    0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x30, 0x35, 0x3a, 0x35, 0x3a, 0x42, 0x36,
-    0x36, 0x35, 0x35, 0x36, 0x42, 0x35, 0x35, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39, 0x3b, 0x3b, 0x41, 0x41, 0x41,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x4a,
-    0x43, 0x43, 0x43, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49,
-    0x49, 0x4f, 0x54, 0x5e, 0x58, 0x50, 0x50, 0x50, 0x50, 0x50, 0x51, 0x54,
-    0x54, 0x57, 0x57, 0x58, 0x58, 0x58, 0x5a, 0x5a, 0x5a, 0x5e, 0x5e, 0x5e,
-    0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x61, 0x6f, 0x6f, 0xbe, 0xad, 0x76, 0x76, 0x77, 0x77, 0x7c, 0x80, 0x80,
-    0x80, 0x84, 0x8b, 0x8e, 0x95, 0x99, 0x99, 0x9b, 0xa0, 0xa6, 0xaa, 0xb2,
-    0xb8, 0xc1, 0xcc, 0xd8, 0xe2, 0xed, 0xf1, 0xeb, 0xe2, 0xd9, 0xc8, 0xb3,
-    0xae, 0xa2, 0x99, 0x93, 0x8e, 0x84, 0x80, 0x7c, 0x7c, 0x77, 0x77, 0x6f,
-    0x6f, 0x6f, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x69, 0x6c, 0xaf, 0x92,
-    0x6d, 0x58, 0x5d, 0x58, 0x57, 0x54, 0x51, 0x50, 0x50, 0x4f, 0x4b, 0x4f,
-    0x49, 0x49, 0x49, 0x48, 0x48, 0x43, 0x46, 0x41, 0x41, 0x41, 0x41, 0x3b,
-    0x3b, 0x39, 0x39, 0x39, 0x37, 0x37, 0x37, 0x36, 0x42, 0x42, 0x42, 0x35,
-    0x35, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2e, 0x2d, 0x2b, 0x2e, 0x2e,
-    0x2d, 0x2b, 0x2b, 0x2a, 0x2a, 0x2c, 0x2c, 0x25, 0x23, 0x24, 0x23, 0x25,
-    0x25, 0x23, 0x24, 0x24, 0x20, 0x20, 0x24, 0x24, 0x20, 0x20, 0x1f, 0x1f,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x1b, 0x1b, 0x1b, 0x1c, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1c, 0x1d, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x1b,
-    0x19, 0x19, 0x18, 0x19, 0x23, 0x23, 0x23, 0x27, 0x27, 0x25, 0x25, 0x23,
-    0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x2a, 0x2b, 0x27, 0x2c,
-    0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x27, 0x2c, 0x2d, 0x2b, 0x2b, 0x2b, 0x2d,
-    0x30, 0x2f, 0x2e, 0x33, 0x2e, 0x33, 0x30, 0x30, 0x33, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x35, 0x35, 0x3a, 0x30, 0x35, 0x35, 0x35, 0x36, 0x36, 0x35, 0x42, 0x37,
-    0x36, 0x42, 0x35, 0x36, 0x36, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39, 0x39,
-    0x37, 0x39, 0x39, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x3b, 0x3b, 0x3b, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x4a, 0x43, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x4f, 0x57, 0x5e, 0x5d,
-    0x50, 0x4f, 0x50, 0x50, 0x50, 0x51, 0x54, 0x54, 0x57, 0x57, 0x58, 0x58,
-    0x58, 0x58, 0x5a, 0x5a, 0x5a, 0x5e, 0x5e, 0x5e, 0x61, 0x61, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x6f, 0x77, 0xbe,
-    0x9a, 0x77, 0x77, 0x77, 0x77, 0x7c, 0x80, 0x80, 0x80, 0x84, 0x8b, 0x93,
-    0x95, 0x99, 0x9b, 0xa0, 0xa2, 0xa7, 0xae, 0xb3, 0xbb, 0xc5, 0xce, 0xdb,
-    0xe3, 0xee, 0xf0, 0xe9, 0xe2, 0xe1, 0xe0, 0xc8, 0xb6, 0xae, 0x9d, 0x93,
-    0x8b, 0x84, 0x80, 0x7c, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x62,
-    0x62, 0x61, 0x61, 0x61, 0x61, 0x5e, 0x84, 0xb7, 0x7a, 0x5a, 0x5b, 0x5e,
-    0x57, 0x54, 0x51, 0x50, 0x51, 0x50, 0x4f, 0x4f, 0x49, 0x49, 0x49, 0x48,
-    0x48, 0x48, 0x43, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x3d, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x37, 0x37, 0x36, 0x35, 0x35, 0x35, 0x30, 0x30, 0x30,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2d, 0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2a,
-    0x2b, 0x2a, 0x2c, 0x25, 0x23, 0x20, 0x24, 0x23, 0x25, 0x25, 0x23, 0x24,
-    0x20, 0x20, 0x20, 0x24, 0x20, 0x20, 0x1f, 0x1f, 0x22, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1d, 0x1d, 0x1d,
-    0x1c, 0x1b, 0x19, 0x19, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x18,
-    0x24, 0x25, 0x25, 0x25, 0x23, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27,
-    0x2a, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2d, 0x2e, 0x2e, 0x2e, 0x2b, 0x2e, 0x30, 0x30, 0x30, 0x33, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x3a, 0x35, 0x30, 0x30, 0x30, 0x30, 0x35, 0x42, 0x42, 0x3a, 0x35,
-    0x36, 0x36, 0x37, 0x37, 0x37, 0x37, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x39, 0x39, 0x39, 0x37, 0x39, 0x3e, 0x3e, 0x3e, 0x3e, 0x3b,
-    0x41, 0x41, 0x41, 0x41, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x46, 0x46, 0x41,
-    0x41, 0x46, 0x43, 0x43, 0x43, 0x43, 0x43, 0x48, 0x48, 0x49, 0x48, 0x48,
-    0x49, 0x4f, 0x4f, 0x4f, 0x54, 0x5d, 0x5d, 0x51, 0x50, 0x50, 0x50, 0x50,
-    0x51, 0x54, 0x54, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x58, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5e, 0x61, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x69, 0x6f, 0x76, 0xba, 0x96, 0x74, 0x77, 0x7c,
-    0x7c, 0x80, 0x80, 0x80, 0x84, 0x8b, 0x8e, 0x93, 0x95, 0x99, 0x9c, 0xa2,
-    0xa7, 0xae, 0xb2, 0xba, 0xc1, 0xcb, 0xd8, 0xdf, 0xe8, 0xef, 0xee, 0xe3,
-    0xdb, 0xce, 0xd6, 0xdf, 0xdb, 0xdb, 0xc1, 0x9d, 0x95, 0x8e, 0x8b, 0x80,
-    0x7c, 0x7c, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x6f, 0x8a, 0xb5, 0xa2, 0x74, 0x5e, 0x58, 0x54, 0x57, 0x54,
-    0x51, 0x50, 0x50, 0x50, 0x4f, 0x4b, 0x4b, 0x4b, 0x49, 0x48, 0x48, 0x4a,
-    0x41, 0x41, 0x41, 0x41, 0x3b, 0x3b, 0x3e, 0x39, 0x3b, 0x3b, 0x39, 0x37,
-    0x36, 0x42, 0x42, 0x3a, 0x30, 0x30, 0x30, 0x2f, 0x2e, 0x2e, 0x2e, 0x2b,
-    0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2a, 0x2b, 0x27, 0x2c, 0x2c,
-    0x27, 0x25, 0x23, 0x25, 0x25, 0x23, 0x23, 0x23, 0x24, 0x20, 0x20, 0x24,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x22, 0x1d, 0x22, 0x1d, 0x1d, 0x1d,
-    0x1c, 0x1c, 0x1c, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x19, 0x24, 0x23, 0x27, 0x25,
-    0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x2b, 0x2e, 0x2b, 0x2a, 0x2c, 0x2b, 0x2b, 0x2e, 0x2e,
-    0x2e, 0x2b, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x35, 0x35, 0x35, 0x35, 0x35, 0x36, 0x36, 0x37, 0x37,
-    0x37, 0x36, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39,
-    0x39, 0x39, 0x3e, 0x3b, 0x3b, 0x3e, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x3b,
-    0x3b, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x41, 0x41, 0x43, 0x43, 0x48,
-    0x48, 0x48, 0x43, 0x48, 0x48, 0x48, 0x49, 0x49, 0x50, 0x50, 0x50, 0x50,
-    0x54, 0x54, 0x51, 0x50, 0x50, 0x50, 0x50, 0x50, 0x51, 0x54, 0x54, 0x57,
-    0x57, 0x58, 0x58, 0x5b, 0x5d, 0x5d, 0x5a, 0x5a, 0x5a, 0x5e, 0x5e, 0x61,
-    0x5e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x6f, 0x6f, 0x7c, 0xc3, 0x97, 0x77, 0x77, 0x7c, 0x7c, 0x7c, 0x80, 0x84,
-    0x88, 0x8e, 0x8e, 0x95, 0x99, 0x9b, 0xa0, 0xa6, 0xaa, 0xb0, 0xb7, 0xbb,
-    0xc7, 0xd2, 0xdb, 0xe3, 0xec, 0xf0, 0xea, 0xe0, 0xd2, 0xc5, 0xbe, 0xc1,
-    0xbe, 0xc1, 0xd0, 0xc1, 0x99, 0x8e, 0x88, 0x80, 0x80, 0x7c, 0x77, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5e,
-    0x6c, 0x9d, 0xb2, 0x96, 0x71, 0x5d, 0x57, 0x57, 0x51, 0x51, 0x51, 0x50,
-    0x4f, 0x4b, 0x4b, 0x4b, 0x49, 0x48, 0x48, 0x43, 0x41, 0x41, 0x41, 0x41,
-    0x3b, 0x3b, 0x3e, 0x3e, 0x3b, 0x3b, 0x39, 0x37, 0x37, 0x42, 0x42, 0x35,
-    0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x2e, 0x2e, 0x2d, 0x2b, 0x2e, 0x2e,
-    0x2d, 0x2b, 0x2b, 0x2a, 0x2b, 0x2c, 0x2c, 0x2b, 0x2c, 0x25, 0x27, 0x25,
-    0x25, 0x25, 0x23, 0x23, 0x24, 0x20, 0x20, 0x20, 0x1f, 0x22, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x22, 0x1f, 0x1f, 0x22, 0x22, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x19,
-    0x19, 0x18, 0x18, 0x19, 0x23, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x2a,
-    0x2e, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x30, 0x30, 0x30, 0x35, 0x42,
-    0x42, 0x35, 0x35, 0x42, 0x36, 0x36, 0x37, 0x37, 0x36, 0x36, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3e, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x3b, 0x41, 0x41, 0x41,
-    0x41, 0x43, 0x43, 0x43, 0x46, 0x43, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x4b, 0x50, 0x50, 0x51, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x50, 0x50, 0x51, 0x51, 0x51, 0x54, 0x57, 0x57, 0x58, 0x58, 0x5b, 0x5b,
-    0x5d, 0x5d, 0x5a, 0x5e, 0x5e, 0x5e, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x7c, 0xbf,
-    0xa8, 0x74, 0x77, 0x7c, 0x7c, 0x7c, 0x80, 0x88, 0x8e, 0x93, 0x95, 0x99,
-    0x9b, 0xa0, 0xa2, 0xa7, 0xaa, 0xb2, 0xb8, 0xbf, 0xcb, 0xd8, 0xe1, 0xea,
-    0xf0, 0xef, 0xe5, 0xdb, 0xcb, 0xbf, 0xb3, 0xae, 0xa6, 0xa7, 0xaf, 0xc7,
-    0xba, 0x8a, 0x84, 0x84, 0x7c, 0x7c, 0x77, 0x6f, 0x6f, 0x6f, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5e, 0x61, 0x5e, 0x74, 0x97,
-    0xa9, 0x92, 0x6c, 0x58, 0x54, 0x54, 0x51, 0x50, 0x4f, 0x4b, 0x4b, 0x4b,
-    0x49, 0x49, 0x48, 0x43, 0x43, 0x41, 0x41, 0x41, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3e, 0x39, 0x37, 0x37, 0x37, 0x36, 0x36, 0x35, 0x30, 0x30, 0x30,
-    0x30, 0x33, 0x2e, 0x33, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x27, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x25, 0x25, 0x23, 0x25,
-    0x24, 0x20, 0x20, 0x20, 0x1f, 0x22, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x20, 0x1f, 0x1f, 0x1f, 0x22, 0x22, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x19, 0x1b, 0x19, 0x19, 0x19, 0x1b,
-    0x25, 0x25, 0x27, 0x27, 0x27, 0x25, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x2c, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2c, 0x27, 0x2b, 0x2e, 0x2a, 0x2a, 0x2c,
-    0x2a, 0x2b, 0x2b, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x35, 0x35, 0x30, 0x30, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x42,
-    0x42, 0x42, 0x42, 0x36, 0x36, 0x37, 0x36, 0x37, 0x37, 0x37, 0x37, 0x39,
-    0x37, 0x37, 0x39, 0x39, 0x39, 0x3b, 0x3b, 0x41, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x46, 0x43, 0x43,
-    0x43, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x50, 0x54,
-    0x51, 0x50, 0x50, 0x4f, 0x52, 0x4f, 0x4b, 0x50, 0x50, 0x51, 0x54, 0x54,
-    0x54, 0x54, 0x57, 0x58, 0x58, 0x58, 0x5d, 0x5a, 0x5d, 0x5b, 0x5d, 0x5a,
-    0x5e, 0x5e, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x6f, 0x6f, 0x6f, 0x6c, 0x6f, 0x76, 0xaf, 0xc1, 0x8c, 0x80, 0x7c,
-    0x80, 0x80, 0x80, 0x8b, 0x93, 0x95, 0x95, 0x99, 0x9c, 0xa0, 0xa6, 0xa7,
-    0xae, 0xb5, 0xba, 0xc5, 0xd2, 0xde, 0xe7, 0xf0, 0xf0, 0xe9, 0xe0, 0xd8,
-    0xc7, 0xba, 0xb0, 0xaa, 0xa2, 0xa2, 0x99, 0xb2, 0xd6, 0x9d, 0x84, 0x80,
-    0x7c, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x61, 0x61, 0x5e, 0x5e, 0x5a, 0x60, 0x6c, 0xa9, 0x7a, 0x5a,
-    0x58, 0x51, 0x50, 0x50, 0x4f, 0x4b, 0x4b, 0x4b, 0x49, 0x48, 0x48, 0x48,
-    0x43, 0x43, 0x43, 0x41, 0x41, 0x3b, 0x3b, 0x3b, 0x3b, 0x3e, 0x3e, 0x39,
-    0x37, 0x37, 0x37, 0x36, 0x42, 0x35, 0x35, 0x35, 0x30, 0x30, 0x30, 0x2e,
-    0x30, 0x2e, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x2a,
-    0x2c, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x25, 0x23, 0x24, 0x20, 0x20, 0x20,
-    0x1f, 0x22, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x20, 0x20, 0x20, 0x1f,
-    0x1f, 0x22, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x24, 0x23, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x2c,
-    0x2b, 0x2a, 0x27, 0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x2c, 0x2c, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x33, 0x2e, 0x33, 0x30, 0x30, 0x2e,
-    0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x30,
-    0x30, 0x42, 0x42, 0x42, 0x42, 0x36, 0x37, 0x36, 0x42, 0x35, 0x42, 0x42,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x41, 0x3b, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x43, 0x41, 0x41, 0x43, 0x43, 0x43, 0x43, 0x43, 0x48, 0x48,
-    0x49, 0x48, 0x48, 0x48, 0x4b, 0x4f, 0x51, 0x50, 0x50, 0x50, 0x4f, 0x4f,
-    0x4f, 0x50, 0x50, 0x51, 0x54, 0x54, 0x57, 0x57, 0x54, 0x57, 0x57, 0x58,
-    0x58, 0x58, 0x5d, 0x5b, 0x5d, 0x5b, 0x5a, 0x5e, 0x5e, 0x61, 0x61, 0x61,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x76, 0x77, 0x77, 0x8a, 0xc8, 0xa9, 0x95, 0x84, 0x80, 0x84, 0x84, 0x8e,
-    0x93, 0x95, 0x99, 0x99, 0xa0, 0xa2, 0xa6, 0xae, 0xb2, 0xb8, 0xc2, 0xce,
-    0xdb, 0xe4, 0xed, 0xf0, 0xeb, 0xe2, 0xdb, 0xcb, 0xbf, 0xb7, 0xb0, 0xa7,
-    0xa2, 0x9d, 0x9b, 0x9d, 0xd1, 0xb9, 0x84, 0x80, 0x77, 0x77, 0x77, 0x6f,
-    0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61,
-    0x61, 0x5e, 0x5d, 0x60, 0x5e, 0x9d, 0x7a, 0x58, 0x57, 0x57, 0x54, 0x50,
-    0x4f, 0x4b, 0x4b, 0x4b, 0x49, 0x49, 0x48, 0x43, 0x43, 0x4a, 0x41, 0x41,
-    0x41, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3e, 0x39, 0x39, 0x37, 0x37, 0x36,
-    0x36, 0x36, 0x42, 0x36, 0x42, 0x3a, 0x35, 0x30, 0x30, 0x30, 0x2e, 0x2e,
-    0x2e, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2c, 0x2a, 0x2c, 0x27, 0x2a, 0x2c,
-    0x2c, 0x27, 0x27, 0x23, 0x23, 0x20, 0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x22, 0x1d, 0x1c, 0x1b, 0x1c, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1c, 0x1c, 0x20, 0x24, 0x23, 0x23, 0x23, 0x25, 0x25, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2a, 0x2a, 0x2c, 0x2c, 0x2a,
-    0x2b, 0x2a, 0x2a, 0x2c, 0x2c, 0x27, 0x27, 0x2b, 0x2a, 0x2e, 0x2e, 0x2b,
-    0x2b, 0x2d, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x33, 0x2e, 0x33, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x30, 0x30, 0x36, 0x42, 0x35,
-    0x42, 0x36, 0x37, 0x37, 0x36, 0x42, 0x35, 0x35, 0x36, 0x37, 0x37, 0x37,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3e, 0x3b, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x46, 0x41,
-    0x41, 0x43, 0x48, 0x48, 0x43, 0x48, 0x48, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x4f, 0x51, 0x50, 0x50, 0x4f, 0x4b, 0x4b, 0x4b, 0x50, 0x50, 0x51, 0x54,
-    0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x5d, 0x5d,
-    0x5b, 0x5d, 0x5a, 0x5a, 0x5e, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x84,
-    0xc1, 0x9a, 0xa3, 0x95, 0x84, 0x88, 0x8b, 0x93, 0x99, 0x99, 0x9b, 0x9b,
-    0xa2, 0xa7, 0xa9, 0xb2, 0xb7, 0xbf, 0xcb, 0xdb, 0xe0, 0xea, 0xf0, 0xec,
-    0xe4, 0xdb, 0xcc, 0xbf, 0xb7, 0xb0, 0xaa, 0xa6, 0x9b, 0x9b, 0x9b, 0x95,
-    0xbb, 0xd1, 0x8a, 0x7c, 0x77, 0x7c, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x5e, 0x5a, 0x5a, 0x5e,
-    0x5e, 0xa3, 0xa2, 0x5d, 0x58, 0x54, 0x51, 0x51, 0x50, 0x4b, 0x4b, 0x4b,
-    0x49, 0x48, 0x48, 0x43, 0x4a, 0x4a, 0x4a, 0x4a, 0x41, 0x41, 0x41, 0x41,
-    0x3b, 0x3b, 0x3b, 0x39, 0x37, 0x37, 0x39, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x36, 0x42, 0x42, 0x30, 0x30, 0x33, 0x33, 0x33, 0x2d, 0x2e, 0x2b,
-    0x2e, 0x2b, 0x2b, 0x2a, 0x27, 0x27, 0x2b, 0x2b, 0x2c, 0x27, 0x27, 0x25,
-    0x25, 0x24, 0x24, 0x20, 0x21, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x20,
-    0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x22, 0x1f, 0x22, 0x1d, 0x22, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1b, 0x1b, 0x1c, 0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1d,
-    0x24, 0x24, 0x23, 0x24, 0x24, 0x23, 0x27, 0x27, 0x27, 0x25, 0x25, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2a, 0x2c, 0x27, 0x27, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x33, 0x2e, 0x2b, 0x2d, 0x2e, 0x2e,
-    0x30, 0x30, 0x30, 0x30, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x35, 0x3a, 0x36, 0x35, 0x35, 0x37, 0x37, 0x3a, 0x36,
-    0x42, 0x35, 0x35, 0x42, 0x37, 0x37, 0x37, 0x39, 0x39, 0x37, 0x37, 0x37,
-    0x3e, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x3b, 0x3b, 0x41, 0x3b,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x48, 0x43, 0x41, 0x43, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x49, 0x49, 0x49, 0x49, 0x4b, 0x50, 0x50, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x50, 0x50, 0x50, 0x51, 0x51, 0x54, 0x54, 0x57, 0x57, 0x57,
-    0x57, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x5b, 0x5b, 0x5b, 0x5a, 0x5e,
-    0x5e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x88, 0xbe, 0xbb, 0x9d, 0xa6,
-    0x8b, 0x88, 0x8e, 0x93, 0x99, 0x9b, 0x9b, 0xa2, 0xa6, 0xa7, 0xa9, 0xb2,
-    0xba, 0xc7, 0xd2, 0xde, 0xe8, 0xf0, 0xef, 0xe6, 0xde, 0xd8, 0xc7, 0xb8,
-    0xb2, 0xa9, 0xa6, 0xa0, 0x9b, 0x99, 0x95, 0x95, 0x9b, 0xd9, 0x9d, 0x80,
-    0x7c, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x61, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x8d, 0xb0, 0x60,
-    0x5b, 0x57, 0x54, 0x51, 0x50, 0x4b, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x48, 0x48, 0x43, 0x43, 0x46, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x39,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x37, 0x37, 0x37, 0x37, 0x35, 0x30,
-    0x30, 0x30, 0x33, 0x30, 0x2f, 0x33, 0x2e, 0x2b, 0x2d, 0x2b, 0x2b, 0x2a,
-    0x27, 0x27, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x24, 0x20, 0x24, 0x20,
-    0x20, 0x1f, 0x24, 0x20, 0x1f, 0x1f, 0x1f, 0x1f, 0x20, 0x20, 0x20, 0x1f,
-    0x22, 0x1f, 0x1f, 0x22, 0x1f, 0x1f, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1c, 0x1b, 0x1b, 0x1c, 0x1c, 0x1c, 0x1d, 0x24, 0x24, 0x24, 0x24,
-    0x24, 0x23, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x2c,
-    0x2c, 0x2a, 0x2c, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x33, 0x2e, 0x2b, 0x2d, 0x2d, 0x2e, 0x2e, 0x30, 0x30, 0x30,
-    0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x35, 0x42, 0x35, 0x35, 0x37, 0x37, 0x42, 0x42, 0x42, 0x35, 0x42, 0x36,
-    0x37, 0x37, 0x37, 0x39, 0x39, 0x37, 0x37, 0x37, 0x3e, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x41, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x43, 0x43, 0x43, 0x43, 0x43, 0x48, 0x43, 0x48, 0x48, 0x48, 0x49,
-    0x49, 0x49, 0x49, 0x4b, 0x4f, 0x50, 0x4f, 0x4f, 0x4f, 0x50, 0x50, 0x50,
-    0x51, 0x51, 0x51, 0x54, 0x54, 0x54, 0x54, 0x57, 0x57, 0x57, 0x57, 0x58,
-    0x5b, 0x58, 0x5d, 0x5b, 0x5a, 0x5a, 0x5a, 0x5e, 0x61, 0x61, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x77, 0x77, 0x77, 0x80, 0x97, 0xb8, 0xa7, 0xa7, 0x99, 0x8e, 0x93, 0x95,
-    0x99, 0x9b, 0xa0, 0xa6, 0xa7, 0xaa, 0xae, 0xb5, 0xba, 0xc7, 0xdb, 0xe2,
-    0xec, 0xf0, 0xe9, 0xe0, 0xd8, 0xcb, 0xc1, 0xb7, 0xae, 0xa7, 0xa6, 0xa0,
-    0x9b, 0x95, 0x95, 0x95, 0x99, 0xd4, 0x99, 0x80, 0x7c, 0x7f, 0x77, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x61, 0x5e, 0x5e, 0x5e, 0x5a, 0x7f, 0x9d, 0x5e, 0x58, 0x57, 0x54, 0x54,
-    0x50, 0x4f, 0x49, 0x4b, 0x4b, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x43,
-    0x43, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x3e, 0x39, 0x39, 0x39, 0x37,
-    0x39, 0x39, 0x37, 0x37, 0x37, 0x37, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x33, 0x2e, 0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x27, 0x27, 0x2a, 0x2c,
-    0x2c, 0x27, 0x27, 0x2c, 0x23, 0x24, 0x24, 0x24, 0x20, 0x20, 0x24, 0x24,
-    0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x21, 0x22, 0x1d, 0x1d, 0x1d, 0x1c, 0x1d, 0x1d, 0x1c, 0x1b, 0x1b,
-    0x1c, 0x1c, 0x1c, 0x1c, 0x24, 0x24, 0x23, 0x23, 0x23, 0x25, 0x25, 0x23,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27,
-    0x2c, 0x27, 0x2c, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x35,
-    0x37, 0x37, 0x42, 0x42, 0x36, 0x42, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39,
-    0x39, 0x39, 0x37, 0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41,
-    0x3b, 0x41, 0x41, 0x41, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43,
-    0x43, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x49, 0x49, 0x4b,
-    0x4b, 0x50, 0x4b, 0x4f, 0x4f, 0x50, 0x50, 0x50, 0x51, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x57, 0x57, 0x57, 0x57, 0x58, 0x5a, 0x60, 0x5b, 0x5a,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77, 0x77,
-    0x80, 0x8a, 0xa9, 0xc8, 0xae, 0x8e, 0x93, 0x99, 0x99, 0x9b, 0xa2, 0xa6,
-    0xaa, 0xb0, 0xb3, 0xb7, 0xbf, 0xcb, 0xdb, 0xe5, 0xee, 0xef, 0xe5, 0xdb,
-    0xce, 0xc5, 0xbb, 0xb2, 0xaa, 0xa6, 0xa2, 0x9c, 0x99, 0x95, 0x93, 0x93,
-    0x8c, 0xc8, 0xa3, 0x7c, 0x7c, 0x7c, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x5e, 0x5e, 0x5e,
-    0x5e, 0x6c, 0x9b, 0x5e, 0x5d, 0x58, 0x54, 0x54, 0x50, 0x4f, 0x4f, 0x4b,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x43, 0x43, 0x41, 0x41,
-    0x41, 0x3b, 0x3b, 0x3e, 0x3e, 0x3e, 0x3e, 0x39, 0x39, 0x39, 0x37, 0x39,
-    0x37, 0x36, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x2e,
-    0x2e, 0x33, 0x2e, 0x2b, 0x2a, 0x2c, 0x2a, 0x2c, 0x2c, 0x2c, 0x2c, 0x2a,
-    0x25, 0x25, 0x25, 0x23, 0x24, 0x24, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24,
-    0x20, 0x20, 0x20, 0x20, 0x1f, 0x1f, 0x22, 0x1f, 0x20, 0x24, 0x1f, 0x1f,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x1b, 0x1b, 0x1c, 0x1c, 0x1c, 0x1b,
-    0x24, 0x24, 0x23, 0x23, 0x23, 0x23, 0x25, 0x23, 0x27, 0x29, 0x27, 0x2c,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2d, 0x2b, 0x2b, 0x2e, 0x33, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x35, 0x35, 0x36, 0x37, 0x36, 0x35,
-    0x36, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3d, 0x3e,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x43, 0x48, 0x48, 0x48,
-    0x48, 0x49, 0x48, 0x49, 0x49, 0x49, 0x4b, 0x4b, 0x4b, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x50, 0x50, 0x50, 0x54, 0x54, 0x57, 0x57, 0x57, 0x57, 0x57, 0x58,
-    0x58, 0x57, 0x58, 0x5a, 0x5a, 0x5a, 0x5a, 0x5e, 0x5e, 0x5e, 0x5e, 0x61,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x7c, 0x7c, 0x7c, 0x80, 0x84, 0xa6, 0xbe,
-    0xb0, 0x95, 0x93, 0x99, 0x9b, 0xa0, 0xa2, 0xaa, 0xae, 0xb3, 0xb8, 0xbf,
-    0xc7, 0xd2, 0xde, 0xe7, 0xef, 0xee, 0xe2, 0xd8, 0xcb, 0xbf, 0xb7, 0xb0,
-    0xa7, 0xa6, 0xa0, 0x9b, 0x99, 0x93, 0x8e, 0x8e, 0x8a, 0xa7, 0xbe, 0x88,
-    0x7c, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x5e, 0x5e, 0xa0, 0x6c,
-    0x5a, 0x57, 0x54, 0x57, 0x50, 0x50, 0x4f, 0x4b, 0x4b, 0x49, 0x49, 0x49,
-    0x48, 0x48, 0x48, 0x43, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3e, 0x3e, 0x39, 0x37, 0x37, 0x37, 0x36, 0x35, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x33, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2c, 0x27, 0x2a, 0x2c, 0x27, 0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x27, 0x25,
-    0x23, 0x24, 0x1f, 0x20, 0x20, 0x20, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x20, 0x1f, 0x22, 0x1d, 0x1d, 0x1c, 0x1d,
-    0x1d, 0x1c, 0x1b, 0x1c, 0x1c, 0x1c, 0x1b, 0x1b, 0x20, 0x24, 0x23, 0x25,
-    0x27, 0x25, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x2c,
-    0x2c, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x2c, 0x2a, 0x2b, 0x2d, 0x2b,
-    0x2b, 0x2d, 0x2e, 0x2d, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x2f, 0x33, 0x2e,
-    0x2e, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35,
-    0x42, 0x3a, 0x30, 0x35, 0x37, 0x37, 0x37, 0x42, 0x36, 0x37, 0x37, 0x37,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x3d, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x41, 0x4a, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x46, 0x43, 0x43, 0x48, 0x49, 0x48, 0x48, 0x48, 0x48, 0x49,
-    0x49, 0x4b, 0x4b, 0x4b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x50, 0x50, 0x51,
-    0x57, 0x54, 0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x5a,
-    0x5e, 0x5a, 0x5e, 0x5e, 0x61, 0x62, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x77, 0x7c, 0x7c, 0x7c, 0x80, 0x88, 0xa6, 0xab, 0xb0, 0x9b, 0x99, 0x9b,
-    0xa0, 0xa2, 0xa7, 0xae, 0xb2, 0xb7, 0xbb, 0xc7, 0xcc, 0xd8, 0xe0, 0xea,
-    0xf1, 0xed, 0xe1, 0xd2, 0xc7, 0xba, 0xb5, 0xae, 0xa7, 0xa2, 0xa0, 0x99,
-    0x95, 0x93, 0x8e, 0x8b, 0x88, 0x8a, 0xb6, 0xb3, 0x80, 0x7c, 0x77, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x61, 0x5e, 0x61, 0x5e, 0x5e, 0x8a, 0x85, 0x5e, 0x58, 0x57, 0x57,
-    0x51, 0x50, 0x4f, 0x4b, 0x4b, 0x4b, 0x4b, 0x49, 0x48, 0x48, 0x43, 0x43,
-    0x43, 0x4a, 0x41, 0x41, 0x41, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3e,
-    0x37, 0x39, 0x37, 0x36, 0x37, 0x37, 0x36, 0x42, 0x35, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2a, 0x27, 0x2a, 0x2c,
-    0x2c, 0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x23, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x24, 0x20, 0x1f, 0x22, 0x1d, 0x1d, 0x1c, 0x1d, 0x1d, 0x1c, 0x1c, 0x1c,
-    0x1c, 0x1b, 0x1b, 0x1c, 0x20, 0x24, 0x24, 0x23, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2b, 0x2e, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e,
-    0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x33, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x37, 0x30, 0x30, 0x35,
-    0x36, 0x37, 0x36, 0x35, 0x37, 0x37, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x3d, 0x3b, 0x3e, 0x3b, 0x41, 0x3b, 0x3b, 0x3b, 0x41, 0x43, 0x41,
-    0x41, 0x41, 0x46, 0x46, 0x41, 0x41, 0x41, 0x46, 0x41, 0x43, 0x43, 0x43,
-    0x48, 0x48, 0x49, 0x48, 0x48, 0x49, 0x49, 0x49, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4f, 0x4f, 0x4b, 0x4b, 0x4f, 0x50, 0x50, 0x51, 0x54, 0x54, 0x57, 0x58,
-    0x58, 0x58, 0x57, 0x58, 0x58, 0x60, 0x5a, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x6f, 0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x7c, 0x7c, 0x7c, 0x80,
-    0x84, 0x88, 0x9b, 0xa9, 0xb2, 0xab, 0x9d, 0x9c, 0xa2, 0xa6, 0xaa, 0xb0,
-    0xb5, 0xb8, 0xbf, 0xcb, 0xd8, 0xdb, 0xe3, 0xed, 0xf0, 0xe9, 0xde, 0xce,
-    0xc2, 0xb8, 0xb2, 0xaa, 0xa6, 0xa0, 0x9b, 0x99, 0x93, 0x8e, 0x8b, 0x84,
-    0x84, 0x84, 0x92, 0xbe, 0xab, 0x7c, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x62, 0x62, 0x62, 0x62, 0x61, 0x62, 0x62, 0x62, 0x62, 0x61, 0x5e, 0x5e,
-    0x5e, 0x5e, 0x76, 0x80, 0x5a, 0x57, 0x58, 0x57, 0x54, 0x50, 0x4f, 0x4f,
-    0x4b, 0x4f, 0x4b, 0x49, 0x48, 0x48, 0x43, 0x43, 0x4a, 0x41, 0x41, 0x41,
-    0x41, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x3b, 0x3b, 0x39, 0x39, 0x37, 0x36,
-    0x37, 0x37, 0x37, 0x36, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2f,
-    0x2e, 0x2e, 0x2e, 0x2d, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2b, 0x2d, 0x2b,
-    0x2c, 0x2c, 0x27, 0x27, 0x27, 0x25, 0x23, 0x25, 0x23, 0x24, 0x24, 0x24,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x20, 0x1f, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1e, 0x1b, 0x1c, 0x1b, 0x1b, 0x1d,
-    0x20, 0x20, 0x24, 0x23, 0x25, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x29, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2c, 0x27, 0x27, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2d, 0x2b, 0x2d, 0x2e, 0x33, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x35, 0x35, 0x42, 0x42, 0x37, 0x42, 0x35, 0x35, 0x42, 0x36, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3e, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x43, 0x43, 0x43, 0x43, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4f, 0x4b, 0x50,
-    0x50, 0x50, 0x50, 0x51, 0x54, 0x54, 0x57, 0x57, 0x57, 0x58, 0x5d, 0x5d,
-    0x5d, 0x5d, 0x5b, 0x5a, 0x5e, 0x5e, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x77, 0x77, 0x77, 0x7c, 0x7c, 0x7c, 0x80, 0x88, 0x8b, 0x8e, 0xa2,
-    0xab, 0xb7, 0xa7, 0xa2, 0xa6, 0xa7, 0xaa, 0xb2, 0xb7, 0xbf, 0xc7, 0xd2,
-    0xd8, 0xe1, 0xea, 0xef, 0xec, 0xe2, 0xd8, 0xcb, 0xbf, 0xb7, 0xb0, 0xa7,
-    0xa2, 0x9c, 0x9b, 0x95, 0x8e, 0x88, 0x84, 0x84, 0x80, 0x80, 0x80, 0x92,
-    0xc3, 0x9b, 0x7c, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x5e, 0x5e, 0x5a, 0x6e, 0x62,
-    0x5e, 0x5a, 0x58, 0x57, 0x54, 0x50, 0x50, 0x50, 0x4f, 0x49, 0x49, 0x49,
-    0x48, 0x48, 0x48, 0x43, 0x4a, 0x46, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x3b, 0x3b, 0x3b, 0x3d, 0x39, 0x37, 0x37, 0x37, 0x37, 0x42,
-    0x35, 0x30, 0x35, 0x35, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2c, 0x27,
-    0x27, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x24, 0x20, 0x20, 0x1f,
-    0x1f, 0x1f, 0x20, 0x21, 0x1f, 0x1f, 0x1f, 0x1f, 0x22, 0x22, 0x22, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x1c, 0x20, 0x20, 0x24, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x2a, 0x27, 0x27, 0x27, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x33, 0x30, 0x2f, 0x33, 0x30, 0x30, 0x33,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x35,
-    0x35, 0x36, 0x36, 0x35, 0x35, 0x35, 0x35, 0x39, 0x39, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x41, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4b, 0x4b,
-    0x4b, 0x4f, 0x4b, 0x4b, 0x4b, 0x4f, 0x4f, 0x50, 0x50, 0x50, 0x50, 0x51,
-    0x51, 0x54, 0x54, 0x57, 0x58, 0x57, 0x5a, 0x5b, 0x5d, 0x5a, 0x5a, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77, 0x77,
-    0x7c, 0x7c, 0x7c, 0x80, 0x88, 0x8e, 0x93, 0x93, 0xab, 0xb3, 0xb8, 0xab,
-    0xa7, 0xaa, 0xae, 0xb5, 0xba, 0xc2, 0xce, 0xdb, 0xe2, 0xe9, 0xef, 0xf0,
-    0xe8, 0xdf, 0xd2, 0xc7, 0xbb, 0xb3, 0xae, 0xa6, 0xa0, 0x99, 0x99, 0x95,
-    0x8e, 0x88, 0x84, 0x80, 0x80, 0x80, 0x7c, 0x7c, 0xa3, 0xb9, 0x9d, 0x88,
-    0x77, 0x6e, 0x6f, 0x6f, 0x61, 0x62, 0x62, 0x62, 0x61, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x61, 0x5e, 0x5e, 0x5a, 0x61, 0x5e, 0x69, 0x69, 0x5d, 0x57,
-    0x57, 0x54, 0x51, 0x51, 0x50, 0x4b, 0x49, 0x49, 0x48, 0x48, 0x48, 0x43,
-    0x4a, 0x43, 0x46, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x3b, 0x3b,
-    0x3e, 0x3d, 0x39, 0x37, 0x37, 0x37, 0x37, 0x42, 0x35, 0x35, 0x35, 0x42,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x25, 0x25,
-    0x27, 0x25, 0x27, 0x25, 0x23, 0x23, 0x24, 0x20, 0x20, 0x1f, 0x20, 0x20,
-    0x1f, 0x1f, 0x21, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x22, 0x1d,
-    0x1d, 0x1d, 0x1c, 0x1d, 0x20, 0x24, 0x23, 0x25, 0x27, 0x27, 0x27, 0x29,
-    0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2a,
-    0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e,
-    0x33, 0x33, 0x30, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
-    0x35, 0x35, 0x35, 0x37, 0x39, 0x37, 0x37, 0x39, 0x37, 0x37, 0x37, 0x37,
-    0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x43, 0x43, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4b, 0x4b, 0x4b, 0x4f, 0x4b, 0x4b,
-    0x4b, 0x4f, 0x4f, 0x50, 0x50, 0x50, 0x50, 0x51, 0x54, 0x54, 0x57, 0x57,
-    0x5d, 0x58, 0x5b, 0x60, 0x5a, 0x5a, 0x5a, 0x5e, 0x5e, 0x5e, 0x61, 0x61,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77, 0x7c, 0x7c, 0x7c, 0x7c, 0x80, 0x84,
-    0x8b, 0x8e, 0x93, 0x99, 0xae, 0xa9, 0xb8, 0xb7, 0xae, 0xb0, 0xb2, 0xb8,
-    0xbf, 0xc7, 0xd8, 0xdf, 0xe8, 0xef, 0xf0, 0xed, 0xe2, 0xd8, 0xce, 0xc5,
-    0xb8, 0xb2, 0xae, 0xa6, 0xa0, 0x99, 0x95, 0x95, 0x8e, 0x88, 0x88, 0x84,
-    0x80, 0x84, 0x7c, 0x80, 0x7c, 0x99, 0xb2, 0xbe, 0x8c, 0x77, 0x6f, 0x6f,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x62, 0x61, 0x61, 0x61, 0x61,
-    0x5e, 0x5e, 0x5e, 0x5a, 0x5a, 0x61, 0x5e, 0x5d, 0x57, 0x57, 0x51, 0x50,
-    0x50, 0x4f, 0x4b, 0x4b, 0x49, 0x48, 0x48, 0x48, 0x43, 0x43, 0x43, 0x41,
-    0x41, 0x4a, 0x41, 0x41, 0x3b, 0x3d, 0x3b, 0x3b, 0x3b, 0x39, 0x37, 0x37,
-    0x37, 0x37, 0x36, 0x42, 0x35, 0x35, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x33, 0x33, 0x33, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b,
-    0x27, 0x2c, 0x2a, 0x2a, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x25,
-    0x25, 0x25, 0x23, 0x24, 0x24, 0x24, 0x1f, 0x1f, 0x1f, 0x1f, 0x21, 0x1f,
-    0x1f, 0x1f, 0x21, 0x1f, 0x21, 0x1f, 0x1f, 0x1f, 0x22, 0x1d, 0x1d, 0x1c,
-    0x20, 0x24, 0x23, 0x25, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x29, 0x27,
-    0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2c, 0x27, 0x2c, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x33, 0x33, 0x30, 0x30,
-    0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35,
-    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x3a, 0x30, 0x35, 0x35, 0x36, 0x37,
-    0x37, 0x37, 0x37, 0x39, 0x39, 0x37, 0x37, 0x39, 0x39, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x46, 0x43,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x50, 0x50,
-    0x51, 0x50, 0x50, 0x54, 0x54, 0x57, 0x57, 0x58, 0x5d, 0x5d, 0x5d, 0x5a,
-    0x5a, 0x5a, 0x5e, 0x5e, 0x5e, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77,
-    0x77, 0x7c, 0x7c, 0x7c, 0x80, 0x80, 0x84, 0x84, 0x8e, 0x93, 0x95, 0xaa,
-    0xa7, 0x9d, 0xa9, 0xba, 0xb3, 0xb3, 0xb7, 0xbb, 0xc5, 0xce, 0xd8, 0xe0,
-    0xea, 0xf1, 0xee, 0xe8, 0xdf, 0xd8, 0xcb, 0xbf, 0xb7, 0xb2, 0xb0, 0xa6,
-    0xa0, 0x99, 0x95, 0x93, 0x8b, 0x8b, 0x84, 0x80, 0x7c, 0x80, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x80, 0x92, 0xa2, 0x9b, 0x88, 0x7c, 0x77, 0x6f, 0x61, 0x61,
-    0x62, 0x62, 0x61, 0x62, 0x61, 0x61, 0x5e, 0x61, 0x61, 0x5e, 0x5e, 0x5a,
-    0x5b, 0x5a, 0x69, 0x61, 0x5a, 0x57, 0x51, 0x4f, 0x4f, 0x4f, 0x4b, 0x4b,
-    0x49, 0x49, 0x48, 0x48, 0x43, 0x43, 0x43, 0x41, 0x4a, 0x43, 0x41, 0x41,
-    0x41, 0x3b, 0x3b, 0x3b, 0x3b, 0x39, 0x37, 0x37, 0x36, 0x36, 0x42, 0x42,
-    0x42, 0x42, 0x35, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x33, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2a, 0x2b,
-    0x2c, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x25, 0x23, 0x24, 0x20, 0x20, 0x20, 0x24, 0x20, 0x20, 0x20, 0x20, 0x24,
-    0x20, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1d, 0x1d, 0x24, 0x24, 0x23, 0x23,
-    0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x23, 0x25, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x2a,
-    0x2c, 0x27, 0x2a, 0x2b, 0x2c, 0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2d, 0x2e, 0x2e, 0x30, 0x2f, 0x2e, 0x33, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x35, 0x35, 0x35,
-    0x35, 0x35, 0x3a, 0x35, 0x3a, 0x42, 0x36, 0x37, 0x37, 0x37, 0x37, 0x39,
-    0x39, 0x37, 0x37, 0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x41, 0x41, 0x41, 0x4a, 0x4a, 0x4a, 0x43, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4b, 0x4b, 0x4f,
-    0x4b, 0x4b, 0x4f, 0x4b, 0x4f, 0x4f, 0x50, 0x51, 0x51, 0x51, 0x50, 0x54,
-    0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x5d, 0x5d, 0x5a, 0x5a, 0x5e, 0x5e,
-    0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77, 0x7c, 0x80, 0x80,
-    0x80, 0x84, 0x84, 0x8b, 0x93, 0x95, 0x9b, 0xae, 0xa6, 0xa6, 0xaa, 0xb7,
-    0xb7, 0xb7, 0xba, 0xc5, 0xcc, 0xd8, 0xdb, 0xe2, 0xec, 0xf1, 0xeb, 0xe1,
-    0xdb, 0xcc, 0xc2, 0xba, 0xb5, 0xae, 0xaa, 0xa6, 0x9c, 0x99, 0x99, 0x93,
-    0x8e, 0x8b, 0x84, 0x80, 0x7c, 0x7c, 0x7c, 0x77, 0x77, 0x77, 0x76, 0x77,
-    0x7c, 0x80, 0x7a, 0x84, 0x84, 0x7c, 0x77, 0x6f, 0x5e, 0x61, 0x62, 0x62,
-    0x61, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5a, 0x5d, 0x58, 0x5d, 0x58, 0x5d,
-    0x5b, 0x57, 0x51, 0x50, 0x50, 0x50, 0x4f, 0x4b, 0x4b, 0x49, 0x49, 0x48,
-    0x48, 0x48, 0x48, 0x43, 0x4a, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x3b,
-    0x3e, 0x39, 0x37, 0x36, 0x36, 0x42, 0x42, 0x42, 0x42, 0x42, 0x35, 0x35,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c,
-    0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x2c, 0x27, 0x27, 0x25, 0x24,
-    0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x1f, 0x1f, 0x20,
-    0x1f, 0x1f, 0x1d, 0x1d, 0x20, 0x20, 0x24, 0x24, 0x24, 0x23, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x25, 0x25, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x27, 0x2c, 0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b,
-    0x2a, 0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2d,
-    0x2e, 0x2e, 0x2f, 0x30, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x3a, 0x42, 0x35,
-    0x36, 0x37, 0x36, 0x42, 0x37, 0x37, 0x39, 0x39, 0x37, 0x37, 0x37, 0x39,
-    0x3b, 0x3e, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x46,
-    0x4a, 0x43, 0x43, 0x43, 0x48, 0x48, 0x49, 0x48, 0x48, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4f, 0x4f, 0x50, 0x51, 0x51, 0x51, 0x51, 0x54, 0x58, 0x57, 0x58, 0x58,
-    0x58, 0x58, 0x5a, 0x5a, 0x5a, 0x5e, 0x5e, 0x5e, 0x61, 0x61, 0x61, 0x61,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x77, 0x77, 0x77, 0x7c, 0x80, 0x80, 0x84, 0x84, 0x88, 0x8e,
-    0x95, 0x99, 0x9d, 0xa2, 0xa2, 0xae, 0xb7, 0xb5, 0xb5, 0xb7, 0xbf, 0xc7,
-    0xd8, 0xdb, 0xe1, 0xe8, 0xef, 0xf1, 0xe6, 0xdb, 0xd2, 0xc7, 0xbf, 0xb7,
-    0xb0, 0xaa, 0xa6, 0xa0, 0x9b, 0x95, 0x95, 0x93, 0x8b, 0x8b, 0x84, 0x80,
-    0x7c, 0x7c, 0x7c, 0x77, 0x6f, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x6f,
-    0x69, 0x6e, 0x8c, 0x96, 0x69, 0x61, 0x62, 0x62, 0x61, 0x5e, 0x5e, 0x5e,
-    0x5e, 0x5a, 0x5a, 0x60, 0x5d, 0x57, 0x57, 0x57, 0x57, 0x57, 0x54, 0x54,
-    0x51, 0x4f, 0x4f, 0x4b, 0x4b, 0x4b, 0x49, 0x48, 0x43, 0x48, 0x48, 0x43,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x3b, 0x3e, 0x39, 0x37, 0x36,
-    0x42, 0x42, 0x36, 0x36, 0x37, 0x37, 0x35, 0x35, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2b, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x33, 0x2b, 0x2a, 0x2b, 0x2a, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2c, 0x25, 0x24, 0x24, 0x24, 0x23,
-    0x24, 0x24, 0x20, 0x20, 0x1f, 0x22, 0x1f, 0x1f, 0x1f, 0x1f, 0x1d, 0x1d,
-    0x20, 0x24, 0x24, 0x20, 0x20, 0x24, 0x25, 0x27, 0x25, 0x25, 0x25, 0x25,
-    0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2c, 0x2c, 0x2b,
-    0x2b, 0x2d, 0x33, 0x2f, 0x30, 0x2e, 0x33, 0x2e, 0x2e, 0x2b, 0x2b, 0x2e,
-    0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x35, 0x30, 0x30, 0x30, 0x30, 0x35,
-    0x35, 0x35, 0x35, 0x35, 0x35, 0x3a, 0x30, 0x35, 0x36, 0x36, 0x35, 0x42,
-    0x36, 0x37, 0x39, 0x39, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39, 0x39, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x46, 0x46, 0x46, 0x43,
-    0x43, 0x43, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x4b, 0x4b, 0x4b, 0x50,
-    0x4f, 0x4b, 0x4f, 0x4b, 0x4b, 0x4f, 0x4b, 0x4f, 0x50, 0x50, 0x51, 0x51,
-    0x51, 0x51, 0x54, 0x54, 0x57, 0x58, 0x58, 0x58, 0x5d, 0x5a, 0x5e, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77,
-    0x77, 0x7c, 0x80, 0x80, 0x84, 0x8b, 0x8b, 0x8e, 0x95, 0x99, 0x9b, 0xa2,
-    0xa7, 0xb0, 0xb7, 0xb7, 0xb8, 0xbe, 0xc7, 0xd2, 0xdb, 0xe2, 0xea, 0xf0,
-    0xef, 0xea, 0xe1, 0xd8, 0xcc, 0xc1, 0xb8, 0xb2, 0xb0, 0xa7, 0xa6, 0xa0,
-    0x99, 0x95, 0x93, 0x93, 0x8e, 0x8b, 0x8b, 0x84, 0x7c, 0x7c, 0x77, 0x77,
-    0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x6c, 0x7f,
-    0x76, 0x69, 0x61, 0x5e, 0x61, 0x5e, 0x5e, 0x5e, 0x5a, 0x5d, 0x5d, 0x5d,
-    0x5d, 0x57, 0x57, 0x54, 0x54, 0x57, 0x54, 0x51, 0x50, 0x4b, 0x4b, 0x49,
-    0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x3b, 0x3b, 0x3b, 0x3b, 0x3e, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x35, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e,
-    0x2a, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x25, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x22, 0x1d, 0x1d, 0x1d, 0x1f, 0x24, 0x24, 0x20,
-    0x20, 0x24, 0x25, 0x23, 0x23, 0x23, 0x23, 0x25, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2b, 0x2a,
-    0x2b, 0x2c, 0x27, 0x2c, 0x2c, 0x2c, 0x2a, 0x2c, 0x2a, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2e, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x3a, 0x35, 0x35,
-    0x35, 0x35, 0x30, 0x35, 0x36, 0x36, 0x35, 0x42, 0x37, 0x37, 0x39, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x39, 0x39, 0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x46, 0x46, 0x43, 0x43, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x49, 0x49, 0x4b, 0x4b, 0x4b, 0x50, 0x4f, 0x4b, 0x4f, 0x4b,
-    0x4f, 0x50, 0x50, 0x50, 0x50, 0x51, 0x50, 0x50, 0x50, 0x51, 0x54, 0x54,
-    0x57, 0x58, 0x58, 0x58, 0x58, 0x5b, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x5e, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77, 0x77, 0x7c, 0x7c, 0x80, 0x84,
-    0x84, 0x8b, 0x8e, 0x93, 0x99, 0x9b, 0xa0, 0xa2, 0xa7, 0xb0, 0xb7, 0xb8,
-    0xba, 0xc1, 0xcc, 0xd8, 0xe1, 0xe9, 0xf0, 0xef, 0xe8, 0xe0, 0xd8, 0xd2,
-    0xc7, 0xbb, 0xb7, 0xb0, 0xaa, 0xa6, 0xa2, 0xa0, 0x99, 0x95, 0x93, 0x8e,
-    0x8b, 0x84, 0x84, 0x80, 0x7c, 0x7c, 0x77, 0x77, 0x77, 0x77, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x62, 0x62, 0x62, 0x61, 0x69, 0x6f, 0x62, 0x62, 0x61, 0x5e,
-    0x61, 0x5e, 0x5a, 0x5a, 0x5e, 0x5d, 0x5d, 0x5d, 0x5d, 0x58, 0x57, 0x57,
-    0x54, 0x51, 0x51, 0x51, 0x50, 0x4f, 0x4b, 0x49, 0x49, 0x49, 0x49, 0x48,
-    0x48, 0x48, 0x48, 0x43, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3e, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x35, 0x35,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2d, 0x2e,
-    0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2a, 0x27, 0x2b, 0x2a,
-    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2a, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x27,
-    0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1f,
-    0x1f, 0x1f, 0x22, 0x1f, 0x1f, 0x24, 0x24, 0x20, 0x20, 0x24, 0x23, 0x23,
-    0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2c, 0x27, 0x2c,
-    0x2c, 0x2a, 0x2a, 0x2c, 0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b,
-    0x2b, 0x2e, 0x33, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x30, 0x35,
-    0x37, 0x36, 0x35, 0x36, 0x37, 0x37, 0x39, 0x37, 0x37, 0x37, 0x37, 0x39,
-    0x39, 0x39, 0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x43, 0x43, 0x43, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49,
-    0x4b, 0x4b, 0x4f, 0x4f, 0x4f, 0x4b, 0x4f, 0x4b, 0x4f, 0x50, 0x50, 0x50,
-    0x50, 0x51, 0x50, 0x50, 0x51, 0x54, 0x54, 0x57, 0x57, 0x57, 0x58, 0x58,
-    0x5d, 0x5a, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x61, 0x61, 0x61,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x77, 0x77, 0x77, 0x77, 0x7c, 0x7c, 0x80, 0x84, 0x8b, 0x8e, 0x8e, 0x93,
-    0x99, 0xa0, 0xa2, 0xa6, 0xaa, 0xb2, 0xb7, 0xb8, 0xbb, 0xc7, 0xdb, 0xe0,
-    0xe8, 0xee, 0xf1, 0xea, 0xe1, 0xd8, 0xd8, 0xcb, 0xc1, 0xba, 0xb5, 0xb0,
-    0xa7, 0xa6, 0xa2, 0x9d, 0x99, 0x95, 0x8e, 0x8e, 0x84, 0x84, 0x80, 0x80,
-    0x7c, 0x7c, 0x77, 0x77, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x62,
-    0x62, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5e, 0x61, 0x5e, 0x5a, 0x5a,
-    0x5e, 0x5d, 0x5d, 0x5d, 0x58, 0x58, 0x58, 0x58, 0x54, 0x50, 0x50, 0x51,
-    0x50, 0x4f, 0x4b, 0x4b, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x43, 0x43,
-    0x4a, 0x46, 0x41, 0x41, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3e, 0x3e,
-    0x39, 0x39, 0x37, 0x37, 0x36, 0x42, 0x42, 0x35, 0x35, 0x35, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x33, 0x2e, 0x33, 0x2e, 0x2d, 0x2d,
-    0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x24, 0x24,
-    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x1f, 0x1f, 0x1f, 0x21,
-    0x1f, 0x24, 0x24, 0x20, 0x24, 0x24, 0x24, 0x24, 0x23, 0x25, 0x25, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2c, 0x2c, 0x27, 0x2c, 0x2a, 0x2b, 0x2b,
-    0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2d, 0x2e, 0x2e,
-    0x33, 0x30, 0x2f, 0x33, 0x2e, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35,
-    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x42, 0x37, 0x37, 0x42, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x39, 0x39, 0x39, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43,
-    0x43, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x4b, 0x4b, 0x4b, 0x4f,
-    0x4f, 0x4f, 0x4b, 0x4f, 0x50, 0x50, 0x50, 0x50, 0x50, 0x51, 0x50, 0x50,
-    0x51, 0x54, 0x54, 0x57, 0x57, 0x58, 0x5d, 0x5a, 0x5a, 0x5a, 0x5e, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77, 0x77, 0x7c,
-    0x7c, 0x80, 0x84, 0x88, 0x8b, 0x8e, 0x93, 0x93, 0x99, 0xa0, 0xa2, 0xa6,
-    0xae, 0xb5, 0xb8, 0xba, 0xc1, 0xce, 0xe1, 0xe9, 0xef, 0xf1, 0xef, 0xe5,
-    0xdb, 0xd8, 0xcc, 0xc5, 0xbb, 0xb7, 0xb2, 0xae, 0xa7, 0xa2, 0xa0, 0x9b,
-    0x95, 0x95, 0x8e, 0x8b, 0x84, 0x80, 0x80, 0x80, 0x7c, 0x7c, 0x77, 0x77,
-    0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61,
-    0x62, 0x62, 0x62, 0x61, 0x61, 0x5e, 0x5a, 0x5a, 0x5e, 0x5d, 0x58, 0x58,
-    0x57, 0x58, 0x58, 0x58, 0x54, 0x50, 0x50, 0x50, 0x50, 0x4f, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x49, 0x48, 0x48, 0x48, 0x48, 0x43, 0x43, 0x43, 0x43, 0x41,
-    0x41, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3e, 0x3e, 0x3b, 0x39, 0x37, 0x37,
-    0x37, 0x36, 0x36, 0x42, 0x42, 0x3a, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x33, 0x2e, 0x34, 0x33, 0x2e, 0x2e, 0x2d, 0x2a, 0x2a, 0x2d, 0x2e,
-    0x2b, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2c,
-    0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x23, 0x24, 0x24, 0x24, 0x24, 0x24,
-    0x24, 0x24, 0x24, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x20, 0x24, 0x20,
-    0x20, 0x24, 0x24, 0x24, 0x24, 0x23, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x2b, 0x2a, 0x2c, 0x2c, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2e, 0x33, 0x2e, 0x2b, 0x2b, 0x2e, 0x33, 0x2b, 0x2e, 0x33, 0x33, 0x30,
-    0x2e, 0x2e, 0x33, 0x33, 0x30, 0x30, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x35, 0x35, 0x42, 0x37, 0x37, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x39, 0x3d, 0x3b, 0x39, 0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x4a, 0x43, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x49, 0x49, 0x4b, 0x4b, 0x4b, 0x4f, 0x4b, 0x4b, 0x4f, 0x4b,
-    0x4f, 0x4f, 0x4f, 0x50, 0x50, 0x50, 0x51, 0x54, 0x54, 0x54, 0x57, 0x57,
-    0x58, 0x5d, 0x5a, 0x5e, 0x5e, 0x5e, 0x61, 0x5e, 0x5e, 0x5e, 0x5e, 0x61,
-    0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x7c, 0x7c, 0x7c, 0x7c, 0x80, 0x84, 0x88,
-    0x8b, 0x8e, 0x93, 0x93, 0x99, 0xa0, 0xa2, 0xa6, 0xae, 0xb7, 0xbb, 0xc1,
-    0xcc, 0xdf, 0xe8, 0xef, 0xf0, 0xeb, 0xe5, 0xdf, 0xd8, 0xcb, 0xc2, 0xbb,
-    0xb7, 0xb2, 0xae, 0xaa, 0xa6, 0xa0, 0x9c, 0x99, 0x95, 0x93, 0x8e, 0x8b,
-    0x84, 0x80, 0x80, 0x7c, 0x7c, 0x7c, 0x77, 0x77, 0x77, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61,
-    0x5e, 0x5e, 0x5a, 0x5a, 0x5e, 0x5b, 0x5d, 0x58, 0x58, 0x57, 0x57, 0x57,
-    0x54, 0x51, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4f, 0x4b, 0x4b, 0x49, 0x49,
-    0x48, 0x48, 0x48, 0x48, 0x43, 0x43, 0x43, 0x41, 0x41, 0x41, 0x3b, 0x3b,
-    0x3e, 0x39, 0x3e, 0x3b, 0x3e, 0x3e, 0x39, 0x37, 0x37, 0x37, 0x36, 0x42,
-    0x42, 0x35, 0x35, 0x35, 0x35, 0x30, 0x33, 0x30, 0x30, 0x2e, 0x2e, 0x33,
-    0x33, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x2c,
-    0x27, 0x23, 0x23, 0x23, 0x23, 0x23, 0x24, 0x20, 0x20, 0x24, 0x20, 0x1f,
-    0x22, 0x22, 0x1f, 0x1f, 0x1f, 0x24, 0x24, 0x20, 0x20, 0x24, 0x24, 0x24,
-    0x24, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x2c, 0x2b, 0x2a, 0x2a, 0x2c,
-    0x27, 0x27, 0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2e, 0x2e, 0x33, 0x2e, 0x2d,
-    0x2b, 0x2b, 0x2d, 0x2a, 0x2a, 0x2b, 0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x33,
-    0x30, 0x30, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x35,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x3d,
-    0x3b, 0x39, 0x39, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x46, 0x41, 0x41, 0x41, 0x43, 0x43, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49,
-    0x4b, 0x4b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x50, 0x50, 0x50, 0x4f, 0x4f,
-    0x50, 0x50, 0x51, 0x54, 0x57, 0x54, 0x57, 0x57, 0x58, 0x60, 0x5a, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x61, 0x61, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77,
-    0x77, 0x7c, 0x7c, 0x7c, 0x7c, 0x80, 0x84, 0x8b, 0x8b, 0x8e, 0x93, 0x95,
-    0x9c, 0xa2, 0xa6, 0xa7, 0xb0, 0xb7, 0xbf, 0xcb, 0xd8, 0xe1, 0xec, 0xf0,
-    0xed, 0xe8, 0xe0, 0xd8, 0xce, 0xc2, 0xbb, 0xb7, 0xb0, 0xae, 0xa9, 0xa6,
-    0xa0, 0xa0, 0x9c, 0x99, 0x95, 0x93, 0x8e, 0x8b, 0x84, 0x80, 0x80, 0x7c,
-    0x7c, 0x77, 0x77, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x5e, 0x5a, 0x5a, 0x5e,
-    0x5e, 0x5b, 0x5d, 0x58, 0x58, 0x58, 0x57, 0x54, 0x54, 0x54, 0x51, 0x50,
-    0x50, 0x50, 0x50, 0x50, 0x4b, 0x4b, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48,
-    0x43, 0x43, 0x43, 0x43, 0x41, 0x41, 0x3b, 0x3b, 0x3e, 0x39, 0x3e, 0x3e,
-    0x3e, 0x39, 0x39, 0x37, 0x37, 0x37, 0x37, 0x36, 0x42, 0x35, 0x35, 0x35,
-    0x3a, 0x30, 0x33, 0x30, 0x30, 0x2e, 0x33, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x2c, 0x2b, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2a,
-    0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x25, 0x25, 0x23,
-    0x23, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1f, 0x22, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x20, 0x20, 0x20, 0x24, 0x28, 0x20, 0x20, 0x24, 0x23, 0x23, 0x23,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x2a, 0x2b, 0x2b,
-    0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x36, 0x36, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x39, 0x3b, 0x3b, 0x3b, 0x3e, 0x39, 0x37, 0x39, 0x3b,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x46, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x48, 0x48, 0x48, 0x49, 0x4b, 0x4b, 0x4f, 0x4f, 0x4b,
-    0x4b, 0x4b, 0x4f, 0x50, 0x51, 0x51, 0x51, 0x50, 0x51, 0x51, 0x54, 0x54,
-    0x57, 0x57, 0x57, 0x57, 0x5d, 0x58, 0x5a, 0x5a, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77, 0x7c, 0x7c, 0x7c,
-    0x80, 0x80, 0x84, 0x88, 0x8b, 0x93, 0x95, 0x99, 0xa0, 0xa2, 0xa6, 0xae,
-    0xb2, 0xb7, 0xbf, 0xcc, 0xd8, 0xe1, 0xeb, 0xf0, 0xed, 0xe5, 0xdf, 0xd8,
-    0xcb, 0xc1, 0xba, 0xb5, 0xb0, 0xa9, 0xa7, 0xa6, 0xa0, 0x9b, 0x99, 0x95,
-    0x93, 0x8e, 0x8e, 0x84, 0x84, 0x80, 0x7c, 0x7c, 0x7c, 0x7c, 0x77, 0x77,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x61, 0x5e, 0x5a, 0x5a, 0x5e, 0x5e, 0x5d, 0x5d, 0x58,
-    0x58, 0x58, 0x57, 0x54, 0x54, 0x54, 0x51, 0x50, 0x50, 0x50, 0x4f, 0x4f,
-    0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x43, 0x43, 0x43, 0x43, 0x4a,
-    0x41, 0x41, 0x41, 0x41, 0x3b, 0x3b, 0x3b, 0x3b, 0x39, 0x39, 0x39, 0x37,
-    0x36, 0x42, 0x36, 0x42, 0x35, 0x30, 0x30, 0x30, 0x30, 0x33, 0x2e, 0x30,
-    0x30, 0x33, 0x2f, 0x2e, 0x2d, 0x2b, 0x2d, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x2c,
-    0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x27, 0x25, 0x25, 0x23, 0x24, 0x20, 0x20,
-    0x24, 0x20, 0x1f, 0x20, 0x1f, 0x1f, 0x20, 0x20, 0x1f, 0x20, 0x20, 0x20,
-    0x24, 0x24, 0x24, 0x24, 0x28, 0x23, 0x23, 0x25, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x34, 0x2b, 0x2e, 0x2e, 0x33, 0x33,
-    0x2e, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x35, 0x35, 0x35, 0x35, 0x42, 0x35, 0x36, 0x37, 0x37, 0x37, 0x39,
-    0x3b, 0x3e, 0x3e, 0x39, 0x39, 0x39, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x46, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x48,
-    0x48, 0x49, 0x49, 0x4b, 0x4b, 0x4f, 0x4b, 0x4b, 0x4b, 0x4b, 0x50, 0x50,
-    0x51, 0x54, 0x51, 0x51, 0x51, 0x51, 0x51, 0x54, 0x57, 0x57, 0x57, 0x57,
-    0x58, 0x5d, 0x5a, 0x5a, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x61,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x77, 0x77, 0x77, 0x7c, 0x7c, 0x7c, 0x80, 0x84, 0x88, 0x8b,
-    0x8b, 0x93, 0x95, 0x99, 0xa0, 0xa6, 0xa7, 0xae, 0xb2, 0xb8, 0xc1, 0xcc,
-    0xd8, 0xe0, 0xe9, 0xf1, 0xee, 0xe5, 0xdf, 0xce, 0xc5, 0xbf, 0xb7, 0xb2,
-    0xae, 0xa7, 0xa6, 0xa2, 0x9c, 0x99, 0x95, 0x95, 0x8e, 0x8e, 0x8b, 0x84,
-    0x80, 0x80, 0x7c, 0x7c, 0x77, 0x7c, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61,
-    0x5e, 0x5a, 0x5a, 0x5a, 0x5a, 0x60, 0x5d, 0x58, 0x58, 0x58, 0x57, 0x54,
-    0x54, 0x54, 0x51, 0x50, 0x50, 0x50, 0x4f, 0x4b, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x48, 0x48, 0x43, 0x43, 0x43, 0x43, 0x4a, 0x41, 0x41, 0x41, 0x41,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3e, 0x39, 0x39, 0x37, 0x36, 0x36, 0x36, 0x36,
-    0x35, 0x35, 0x30, 0x30, 0x35, 0x30, 0x2e, 0x30, 0x30, 0x2e, 0x33, 0x2e,
-    0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2a,
-    0x2b, 0x2a, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x2a,
-    0x2c, 0x27, 0x27, 0x27, 0x25, 0x24, 0x20, 0x20, 0x24, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x1f, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24,
-    0x24, 0x23, 0x23, 0x25, 0x25, 0x27, 0x25, 0x27, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x2a, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x34, 0x2e, 0x2e, 0x2e, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x35,
-    0x35, 0x35, 0x35, 0x42, 0x37, 0x37, 0x37, 0x39, 0x3b, 0x39, 0x37, 0x39,
-    0x39, 0x3e, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x46,
-    0x43, 0x43, 0x43, 0x43, 0x48, 0x43, 0x48, 0x48, 0x48, 0x49, 0x49, 0x4b,
-    0x4b, 0x4f, 0x4b, 0x4b, 0x4b, 0x4f, 0x50, 0x50, 0x51, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x51, 0x54, 0x57, 0x57, 0x57, 0x58, 0x58, 0x5d, 0x5a, 0x5a,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77,
-    0x77, 0x7c, 0x7c, 0x7c, 0x80, 0x84, 0x8b, 0x8b, 0x8e, 0x93, 0x99, 0x9b,
-    0xa0, 0xa6, 0xa7, 0xae, 0xb2, 0xb7, 0xc1, 0xcc, 0xd8, 0xde, 0xe7, 0xf0,
-    0xee, 0xe4, 0xde, 0xcc, 0xc1, 0xba, 0xb2, 0xb0, 0xaa, 0xa6, 0xa2, 0xa0,
-    0x9c, 0x99, 0x95, 0x93, 0x8e, 0x8b, 0x88, 0x80, 0x80, 0x7c, 0x7c, 0x7c,
-    0x77, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x61, 0x62, 0x62, 0x61, 0x5e, 0x5e, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5d, 0x58, 0x5d, 0x58, 0x57, 0x57, 0x54, 0x54, 0x50, 0x50,
-    0x50, 0x50, 0x50, 0x4f, 0x4b, 0x4b, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48,
-    0x43, 0x43, 0x43, 0x4a, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x3b, 0x3b,
-    0x3e, 0x3e, 0x39, 0x37, 0x37, 0x37, 0x37, 0x36, 0x42, 0x35, 0x35, 0x30,
-    0x35, 0x30, 0x33, 0x30, 0x30, 0x2e, 0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2c, 0x2c, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x27,
-    0x27, 0x23, 0x24, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x1f,
-    0x1f, 0x20, 0x20, 0x20, 0x24, 0x23, 0x25, 0x23, 0x23, 0x25, 0x25, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x33,
-    0x2e, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2f,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x35, 0x30, 0x35, 0x35, 0x35, 0x42,
-    0x37, 0x37, 0x37, 0x37, 0x39, 0x37, 0x37, 0x37, 0x3e, 0x3e, 0x3b, 0x3b,
-    0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x43, 0x48,
-    0x43, 0x43, 0x48, 0x48, 0x48, 0x49, 0x49, 0x4b, 0x4b, 0x4f, 0x4b, 0x4b,
-    0x4f, 0x4f, 0x50, 0x50, 0x51, 0x54, 0x54, 0x54, 0x54, 0x54, 0x51, 0x54,
-    0x57, 0x54, 0x57, 0x58, 0x58, 0x5d, 0x5a, 0x5a, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x5e, 0x61, 0x62, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77, 0x77, 0x7c, 0x7c, 0x80,
-    0x80, 0x88, 0x8b, 0x8e, 0x8e, 0x95, 0x99, 0x9b, 0xa0, 0xa6, 0xa9, 0xae,
-    0xb5, 0xba, 0xc2, 0xce, 0xd8, 0xe0, 0xe7, 0xee, 0xec, 0xe2, 0xdb, 0xcb,
-    0xbf, 0xb7, 0xb2, 0xae, 0xa7, 0xa6, 0xa0, 0xa0, 0x99, 0x95, 0x93, 0x93,
-    0x8e, 0x8b, 0x84, 0x80, 0x7c, 0x7c, 0x7c, 0x77, 0x77, 0x77, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x61, 0x5e, 0x5e, 0x5e, 0x5a, 0x5a, 0x5a, 0x5d, 0x60, 0x58,
-    0x58, 0x58, 0x57, 0x57, 0x54, 0x54, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4f,
-    0x4f, 0x4f, 0x4b, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x43, 0x43, 0x4a,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x3b, 0x3b, 0x3e, 0x3e, 0x39,
-    0x39, 0x39, 0x37, 0x37, 0x36, 0x42, 0x35, 0x35, 0x30, 0x30, 0x33, 0x30,
-    0x30, 0x30, 0x2e, 0x2f, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e,
-    0x2e, 0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27,
-    0x27, 0x27, 0x2a, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x25, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x24, 0x24, 0x24, 0x20, 0x1f, 0x1f, 0x1f, 0x20, 0x20,
-    0x23, 0x25, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x29, 0x27, 0x27, 0x25,
-    0x27, 0x29, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x2d, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3a, 0x35,
-    0x42, 0x30, 0x30, 0x35, 0x35, 0x35, 0x35, 0x36, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x36, 0x36, 0x37, 0x3e, 0x3b, 0x41, 0x3b, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x48, 0x48, 0x48, 0x43, 0x48, 0x48,
-    0x48, 0x49, 0x49, 0x4b, 0x4b, 0x4f, 0x4f, 0x4b, 0x4f, 0x50, 0x50, 0x50,
-    0x51, 0x54, 0x54, 0x57, 0x57, 0x57, 0x54, 0x54, 0x57, 0x57, 0x58, 0x5b,
-    0x5d, 0x5d, 0x5a, 0x5a, 0x5e, 0x5e, 0x5a, 0x5e, 0x5e, 0x61, 0x61, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x77, 0x77, 0x77, 0x77, 0x7c, 0x7c, 0x80, 0x84, 0x88, 0x8e, 0x8e,
-    0x93, 0x95, 0x9b, 0x9c, 0xa2, 0xa6, 0xaa, 0xb2, 0xb8, 0xbf, 0xc7, 0xd8,
-    0xde, 0xe5, 0xec, 0xef, 0xe8, 0xdf, 0xd8, 0xc7, 0xbe, 0xb7, 0xb2, 0xae,
-    0xa7, 0xa6, 0xa0, 0x9c, 0x99, 0x93, 0x93, 0x8e, 0x8b, 0x84, 0x80, 0x80,
-    0x7c, 0x7c, 0x7c, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x5a, 0x5e, 0x5a, 0x5a, 0x5d, 0x58, 0x58, 0x58, 0x57,
-    0x57, 0x54, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4f, 0x4f, 0x4b, 0x49,
-    0x49, 0x49, 0x48, 0x48, 0x43, 0x43, 0x4a, 0x4a, 0x4a, 0x4a, 0x41, 0x41,
-    0x41, 0x41, 0x3b, 0x3b, 0x3e, 0x3e, 0x3e, 0x3e, 0x39, 0x39, 0x37, 0x37,
-    0x37, 0x36, 0x35, 0x35, 0x30, 0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x2e, 0x2e, 0x2b, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x2b, 0x2a,
-    0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x25, 0x23, 0x23, 0x25, 0x27, 0x27, 0x25, 0x25, 0x23,
-    0x23, 0x24, 0x24, 0x20, 0x1f, 0x20, 0x20, 0x20, 0x24, 0x25, 0x25, 0x25,
-    0x23, 0x25, 0x25, 0x27, 0x27, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b,
-    0x2b, 0x2b, 0x2d, 0x2d, 0x2d, 0x2e, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x42, 0x37, 0x30, 0x30, 0x35,
-    0x35, 0x35, 0x35, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x36, 0x37,
-    0x3e, 0x3b, 0x41, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x43, 0x43, 0x48, 0x48, 0x43, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49,
-    0x4b, 0x4b, 0x4f, 0x4b, 0x4f, 0x50, 0x50, 0x51, 0x51, 0x54, 0x54, 0x57,
-    0x57, 0x57, 0x54, 0x54, 0x57, 0x57, 0x58, 0x5a, 0x5d, 0x5b, 0x5a, 0x5a,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77,
-    0x7c, 0x7c, 0x7c, 0x80, 0x80, 0x8b, 0x8e, 0x8e, 0x93, 0x95, 0x99, 0x9c,
-    0xa2, 0xa7, 0xae, 0xb5, 0xba, 0xc5, 0xce, 0xdb, 0xe3, 0xec, 0xf0, 0xea,
-    0xe1, 0xd8, 0xd8, 0xc7, 0xba, 0xb5, 0xb2, 0xae, 0xa7, 0xa2, 0xa0, 0x9b,
-    0x95, 0x93, 0x93, 0x8e, 0x88, 0x84, 0x80, 0x7c, 0x7c, 0x7c, 0x7c, 0x77,
-    0x77, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x61, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x5e, 0x5e, 0x5e,
-    0x5e, 0x5a, 0x5a, 0x5a, 0x5b, 0x58, 0x58, 0x57, 0x54, 0x51, 0x51, 0x51,
-    0x50, 0x50, 0x4f, 0x50, 0x4f, 0x4f, 0x4b, 0x49, 0x49, 0x49, 0x49, 0x48,
-    0x43, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3b,
-    0x3b, 0x3e, 0x3e, 0x3e, 0x39, 0x37, 0x37, 0x37, 0x37, 0x37, 0x36, 0x35,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e,
-    0x2e, 0x2e, 0x33, 0x33, 0x2e, 0x2e, 0x2b, 0x2b, 0x2a, 0x2c, 0x27, 0x2c,
-    0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23,
-    0x23, 0x25, 0x27, 0x27, 0x27, 0x25, 0x25, 0x23, 0x23, 0x24, 0x24, 0x24,
-    0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x25, 0x25, 0x24, 0x24, 0x24, 0x23,
-    0x25, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x27, 0x2a, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2e, 0x2d,
-    0x2e, 0x33, 0x30, 0x30, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x35, 0x35, 0x35, 0x42, 0x30, 0x30, 0x35, 0x35, 0x42, 0x35, 0x37,
-    0x36, 0x37, 0x36, 0x36, 0x37, 0x36, 0x42, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43,
-    0x43, 0x48, 0x48, 0x48, 0x43, 0x48, 0x48, 0x48, 0x48, 0x49, 0x4b, 0x4b,
-    0x4f, 0x50, 0x50, 0x54, 0x54, 0x57, 0x54, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x57, 0x58, 0x58, 0x58, 0x5b, 0x5b, 0x5a, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x5e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x7c, 0x7c, 0x7c, 0x80,
-    0x80, 0x84, 0x8b, 0x8e, 0x93, 0x99, 0x99, 0x9c, 0xa6, 0xaa, 0xb0, 0xb5,
-    0xba, 0xc7, 0xd8, 0xe0, 0xe9, 0xef, 0xeb, 0xe4, 0xdb, 0xd2, 0xce, 0xce,
-    0xba, 0xb0, 0xb0, 0xa9, 0xa7, 0xa2, 0x9c, 0x99, 0x95, 0x93, 0x93, 0x8e,
-    0x88, 0x84, 0x80, 0x7c, 0x7c, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x61, 0x62, 0x61, 0x5e, 0x5e, 0x5e, 0x5e, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5d, 0x58, 0x58, 0x54, 0x54, 0x54, 0x51, 0x50, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4b, 0x49, 0x49, 0x49, 0x48, 0x48, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x3b, 0x3b, 0x3b, 0x3d,
-    0x39, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x35, 0x35, 0x35, 0x35, 0x30,
-    0x30, 0x30, 0x2f, 0x30, 0x2f, 0x30, 0x30, 0x30, 0x33, 0x33, 0x33, 0x2e,
-    0x2e, 0x2e, 0x2d, 0x2b, 0x2a, 0x2a, 0x2c, 0x2a, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x25, 0x27, 0x27,
-    0x27, 0x25, 0x25, 0x23, 0x23, 0x23, 0x20, 0x24, 0x20, 0x23, 0x23, 0x24,
-    0x24, 0x23, 0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x23, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x2c, 0x2a,
-    0x2b, 0x2b, 0x2d, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2e, 0x33, 0x33,
-    0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35,
-    0x35, 0x30, 0x30, 0x30, 0x35, 0x35, 0x35, 0x36, 0x36, 0x36, 0x37, 0x37,
-    0x37, 0x42, 0x37, 0x39, 0x39, 0x3e, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x4a, 0x43, 0x43, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x49, 0x48, 0x4b, 0x4f, 0x50, 0x50, 0x50, 0x51, 0x54,
-    0x54, 0x54, 0x54, 0x57, 0x57, 0x58, 0x57, 0x57, 0x57, 0x58, 0x58, 0x58,
-    0x5d, 0x5d, 0x5a, 0x5a, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x61, 0x62, 0x61,
-    0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x77, 0x77, 0x7c, 0x7c, 0x7c, 0x80, 0x80, 0x84, 0x8b, 0x8e,
-    0x93, 0x99, 0x9b, 0xa0, 0xa6, 0xaa, 0xb0, 0xb7, 0xbf, 0xcb, 0xdb, 0xe5,
-    0xef, 0xee, 0xe4, 0xde, 0xd8, 0xc7, 0xc5, 0xce, 0xba, 0xae, 0xae, 0xa9,
-    0xa7, 0xa2, 0x9c, 0x99, 0x95, 0x8e, 0x8e, 0x8b, 0x84, 0x80, 0x80, 0x7c,
-    0x7c, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x61, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5a, 0x60, 0x5d, 0x58,
-    0x54, 0x51, 0x54, 0x51, 0x50, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4b, 0x49,
-    0x49, 0x49, 0x48, 0x48, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x3b, 0x3b, 0x3b, 0x3d, 0x39, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x42, 0x35, 0x35, 0x35, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x33, 0x33, 0x30, 0x33, 0x33, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b,
-    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x23,
-    0x24, 0x24, 0x20, 0x20, 0x20, 0x24, 0x24, 0x20, 0x24, 0x23, 0x24, 0x24,
-    0x24, 0x20, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x2d, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x35, 0x35, 0x42, 0x36, 0x37, 0x37, 0x39, 0x37, 0x37, 0x3d,
-    0x3b, 0x39, 0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x43, 0x43, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49,
-    0x49, 0x4b, 0x4f, 0x50, 0x50, 0x50, 0x51, 0x54, 0x51, 0x51, 0x54, 0x57,
-    0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x5d, 0x5a, 0x5a,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x61, 0x61, 0x61, 0x62, 0x62, 0x61, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x7c,
-    0x7c, 0x80, 0x7c, 0x80, 0x84, 0x88, 0x88, 0x8e, 0x95, 0x9b, 0x9c, 0xa0,
-    0xa7, 0xaa, 0xb0, 0xb7, 0xc1, 0xce, 0xdf, 0xe9, 0xf1, 0xeb, 0xe0, 0xd8,
-    0xd8, 0xcb, 0xc2, 0xc5, 0xb7, 0xae, 0xae, 0xa7, 0xa6, 0xa0, 0x9b, 0x95,
-    0x93, 0x8e, 0x8e, 0x8b, 0x84, 0x80, 0x80, 0x7c, 0x7c, 0x77, 0x77, 0x77,
-    0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x5a, 0x60, 0x5d, 0x57, 0x54, 0x51, 0x54, 0x51,
-    0x50, 0x50, 0x50, 0x4f, 0x4f, 0x4f, 0x4b, 0x49, 0x49, 0x49, 0x48, 0x48,
-    0x48, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4a, 0x4a, 0x41, 0x41, 0x41, 0x41,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x39, 0x37, 0x37, 0x37, 0x37, 0x36, 0x35, 0x35,
-    0x35, 0x35, 0x35, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x2e, 0x2e,
-    0x30, 0x30, 0x30, 0x2e, 0x30, 0x2e, 0x2b, 0x2b, 0x2a, 0x2c, 0x2c, 0x27,
-    0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x23, 0x23, 0x24, 0x24, 0x24,
-    0x1f, 0x20, 0x20, 0x1f, 0x21, 0x24, 0x23, 0x24, 0x20, 0x24, 0x24, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x27, 0x27, 0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35,
-    0x42, 0x36, 0x37, 0x39, 0x39, 0x37, 0x37, 0x39, 0x39, 0x39, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43,
-    0x43, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x49, 0x4b, 0x4f, 0x50,
-    0x50, 0x51, 0x51, 0x51, 0x51, 0x51, 0x54, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x57, 0x58, 0x58, 0x58, 0x58, 0x5d, 0x5a, 0x5a, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x7c, 0x7c, 0x7c, 0x80, 0x80,
-    0x84, 0x88, 0x8b, 0x93, 0x95, 0x9b, 0xa0, 0xa0, 0xa7, 0xae, 0xb2, 0xba,
-    0xc7, 0xd8, 0xde, 0xe8, 0xf0, 0xea, 0xe0, 0xd8, 0xd2, 0xcc, 0xc2, 0xbb,
-    0xb5, 0xae, 0xaa, 0xa6, 0xa2, 0xa0, 0x99, 0x95, 0x93, 0x8e, 0x8e, 0x88,
-    0x88, 0x84, 0x80, 0x7c, 0x7c, 0x77, 0x77, 0x77, 0x77, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x62, 0x62,
-    0x62, 0x61, 0x62, 0x61, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x5a, 0x60, 0x58, 0x57, 0x54, 0x54, 0x54, 0x51, 0x50, 0x50, 0x50, 0x4f,
-    0x4f, 0x4b, 0x4b, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x3b, 0x3b, 0x39,
-    0x39, 0x37, 0x37, 0x37, 0x37, 0x36, 0x42, 0x42, 0x35, 0x35, 0x35, 0x35,
-    0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x30, 0x2f, 0x30, 0x30,
-    0x30, 0x2e, 0x2e, 0x2b, 0x2c, 0x2c, 0x2b, 0x2c, 0x2c, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x2c, 0x2a, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25,
-    0x27, 0x25, 0x23, 0x23, 0x24, 0x24, 0x24, 0x24, 0x1d, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x21, 0x23, 0x24, 0x20, 0x24, 0x24, 0x23, 0x25, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x25, 0x2c,
-    0x2c, 0x2d, 0x2d, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2d,
-    0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x35, 0x35, 0x36, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x39, 0x3b, 0x3b, 0x3b, 0x3e, 0x3e, 0x3b, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x43, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x49, 0x4b, 0x4b, 0x4f, 0x4f, 0x4f, 0x50, 0x50, 0x50, 0x50,
-    0x51, 0x54, 0x54, 0x54, 0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x58,
-    0x5d, 0x5b, 0x5a, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x61, 0x61, 0x62, 0x62,
-    0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x62, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x77, 0x77, 0x7c, 0x7c, 0x80, 0x80, 0x80, 0x8b, 0x8e, 0x93,
-    0x95, 0x9b, 0xa0, 0xa0, 0xa7, 0xb0, 0xb8, 0xc1, 0xcb, 0xd8, 0xde, 0xe8,
-    0xf0, 0xe9, 0xe0, 0xd8, 0xce, 0xc7, 0xc1, 0xbf, 0xb7, 0xae, 0xaa, 0xa6,
-    0xa2, 0x9c, 0x95, 0x95, 0x93, 0x8e, 0x8b, 0x88, 0x84, 0x80, 0x80, 0x7c,
-    0x7c, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5a, 0x5a, 0x5a, 0x5a, 0x58, 0x58, 0x57,
-    0x54, 0x54, 0x54, 0x51, 0x50, 0x50, 0x50, 0x4f, 0x4f, 0x4b, 0x49, 0x49,
-    0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x43, 0x43, 0x43, 0x4a, 0x43, 0x43,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x3b, 0x39, 0x39, 0x39, 0x37, 0x39,
-    0x37, 0x37, 0x36, 0x42, 0x35, 0x35, 0x35, 0x35, 0x35, 0x3a, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2b, 0x2b, 0x2b, 0x2a, 0x27, 0x2c, 0x2c, 0x2c, 0x25, 0x27, 0x2c, 0x2c,
-    0x2a, 0x27, 0x25, 0x25, 0x27, 0x23, 0x24, 0x23, 0x27, 0x25, 0x23, 0x24,
-    0x24, 0x24, 0x24, 0x23, 0x22, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x24, 0x24,
-    0x20, 0x24, 0x23, 0x23, 0x25, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x2c, 0x2a, 0x2a, 0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2d, 0x2b,
-    0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2e, 0x2f, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x35, 0x30, 0x35, 0x42, 0x36, 0x36, 0x36, 0x37, 0x37, 0x37, 0x37, 0x36,
-    0x37, 0x3b, 0x3b, 0x41, 0x3b, 0x3e, 0x3e, 0x3b, 0x41, 0x41, 0x41, 0x41,
-    0x46, 0x46, 0x43, 0x43, 0x43, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x4b,
-    0x4b, 0x4f, 0x4f, 0x4f, 0x50, 0x50, 0x50, 0x50, 0x51, 0x57, 0x54, 0x54,
-    0x57, 0x54, 0x57, 0x57, 0x57, 0x58, 0x58, 0x58, 0x5d, 0x5b, 0x5a, 0x5e,
-    0x5e, 0x61, 0x5e, 0x5e, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77,
-    0x7c, 0x7c, 0x7c, 0x80, 0x84, 0x8b, 0x8e, 0x93, 0x95, 0x9b, 0xa0, 0xa2,
-    0xa7, 0xb0, 0xb7, 0xbf, 0xc5, 0xd2, 0xde, 0xe8, 0xf1, 0xea, 0xe1, 0xdb,
-    0xd2, 0xc7, 0xbf, 0xbf, 0xb8, 0xae, 0xa7, 0xa6, 0xa0, 0x9c, 0x95, 0x93,
-    0x8e, 0x8b, 0x8b, 0x84, 0x80, 0x80, 0x7c, 0x7c, 0x7c, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x5e, 0x5e, 0x5a, 0x5e,
-    0x5e, 0x5a, 0x5a, 0x5a, 0x5b, 0x58, 0x57, 0x57, 0x54, 0x51, 0x51, 0x51,
-    0x50, 0x50, 0x50, 0x50, 0x4f, 0x4b, 0x4b, 0x49, 0x49, 0x49, 0x49, 0x48,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x3b, 0x3e, 0x39, 0x39, 0x3e, 0x37, 0x37, 0x37, 0x37, 0x37, 0x42,
-    0x35, 0x35, 0x35, 0x35, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x2e, 0x2f, 0x2f, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b,
-    0x27, 0x2c, 0x2a, 0x2a, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x25, 0x24, 0x23, 0x23, 0x25, 0x23, 0x24, 0x23, 0x23, 0x23, 0x25,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x24, 0x20, 0x20, 0x20, 0x24, 0x23,
-    0x23, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x25, 0x25,
-    0x29, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x2a, 0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2d, 0x2b, 0x2d, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e,
-    0x2e, 0x33, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35,
-    0x42, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x42, 0x37, 0x39, 0x3d, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x46, 0x46, 0x46, 0x46, 0x43,
-    0x43, 0x43, 0x48, 0x48, 0x48, 0x49, 0x49, 0x4b, 0x4b, 0x4b, 0x4f, 0x4f,
-    0x4f, 0x50, 0x50, 0x51, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x57, 0x57,
-    0x57, 0x58, 0x58, 0x58, 0x5d, 0x5d, 0x5a, 0x5e, 0x5e, 0x5e, 0x5e, 0x61,
-    0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f,
-    0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77, 0x7c, 0x7c, 0x7c, 0x80,
-    0x80, 0x88, 0x8b, 0x93, 0x95, 0x9b, 0xa0, 0xa2, 0xaa, 0xb2, 0xb7, 0xbb,
-    0xc1, 0xcc, 0xdb, 0xe5, 0xed, 0xef, 0xe9, 0xe2, 0xdb, 0xcc, 0xc1, 0xbf,
-    0xb8, 0xae, 0xa6, 0xa2, 0xa0, 0x99, 0x95, 0x93, 0x8e, 0x8b, 0x8b, 0x84,
-    0x80, 0x7c, 0x7c, 0x7c, 0x7c, 0x77, 0x77, 0x77, 0x77, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61,
-    0x61, 0x61, 0x61, 0x61, 0x5e, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5b, 0x58, 0x57, 0x54, 0x54, 0x51, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x50, 0x4f, 0x4b, 0x49, 0x49, 0x48, 0x48, 0x48, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x46, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x41, 0x3b, 0x3e, 0x3e,
-    0x3e, 0x3e, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x42, 0x42, 0x35, 0x42,
-    0x35, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x33, 0x33,
-    0x33, 0x2e, 0x30, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2a, 0x2b, 0x2a,
-    0x2a, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23,
-    0x23, 0x25, 0x23, 0x23, 0x23, 0x23, 0x23, 0x27, 0x22, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x20, 0x20, 0x1f, 0x20, 0x24, 0x23, 0x24, 0x23, 0x23, 0x25,
-    0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x25, 0x23, 0x23, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c,
-    0x2b, 0x2a, 0x2a, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x33, 0x2e, 0x33,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x42, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3d, 0x3b, 0x3b, 0x3b, 0x3b, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x43, 0x48, 0x43,
-    0x48, 0x49, 0x49, 0x49, 0x4b, 0x4b, 0x4f, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x57, 0x57, 0x57, 0x58, 0x57, 0x58,
-    0x5d, 0x5d, 0x5a, 0x5a, 0x5e, 0x5e, 0x5e, 0x5e, 0x61, 0x61, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x62, 0x62, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x77, 0x77, 0x77, 0x77, 0x7c, 0x7c, 0x80, 0x84, 0x84, 0x8e, 0x93,
-    0x95, 0x9b, 0xa0, 0xa6, 0xaa, 0xb0, 0xb2, 0xb8, 0xbf, 0xcb, 0xd8, 0xdf,
-    0xe6, 0xed, 0xef, 0xeb, 0xe1, 0xd2, 0xc2, 0xbb, 0xb7, 0xa7, 0xa6, 0xa2,
-    0x9c, 0x99, 0x95, 0x93, 0x8b, 0x8b, 0x88, 0x84, 0x80, 0x7c, 0x7c, 0x77,
-    0x77, 0x77, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x61,
-    0x5e, 0x5e, 0x5a, 0x5a, 0x5a, 0x5d, 0x5a, 0x5b, 0x5d, 0x57, 0x57, 0x54,
-    0x54, 0x51, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4f, 0x4b, 0x49,
-    0x49, 0x48, 0x48, 0x48, 0x48, 0x43, 0x43, 0x43, 0x48, 0x43, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x3d, 0x39, 0x39, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x42, 0x36, 0x36, 0x36, 0x38, 0x35, 0x35, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33,
-    0x2e, 0x2b, 0x2b, 0x2a, 0x2c, 0x2c, 0x2c, 0x27, 0x2c, 0x2b, 0x2a, 0x27,
-    0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x27, 0x25, 0x27,
-    0x25, 0x23, 0x23, 0x27, 0x22, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x20, 0x20,
-    0x20, 0x20, 0x24, 0x23, 0x24, 0x28, 0x24, 0x23, 0x25, 0x25, 0x25, 0x23,
-    0x25, 0x27, 0x27, 0x23, 0x25, 0x23, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27,
-    0x2c, 0x27, 0x27, 0x25, 0x27, 0x25, 0x27, 0x27, 0x2a, 0x2a, 0x2c, 0x2b,
-    0x2a, 0x2b, 0x2b, 0x2d, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x33, 0x2e, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x35, 0x42, 0x36, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x39, 0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x43, 0x43, 0x43, 0x43, 0x48, 0x48, 0x49, 0x49, 0x49,
-    0x49, 0x4b, 0x4f, 0x4f, 0x4f, 0x50, 0x50, 0x50, 0x51, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x57, 0x57, 0x57, 0x57, 0x57, 0x5d, 0x5d, 0x5b, 0x5a,
-    0x5a, 0x5a, 0x5e, 0x5e, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77,
-    0x77, 0x7c, 0x7c, 0x80, 0x80, 0x84, 0x8b, 0x8e, 0x95, 0x9b, 0xa0, 0xa2,
-    0xa7, 0xae, 0xb2, 0xb8, 0xbf, 0xcb, 0xd8, 0xde, 0xe5, 0xeb, 0xf0, 0xf0,
-    0xe4, 0xd2, 0xc5, 0xb8, 0xb2, 0xa7, 0xa6, 0xa2, 0x9c, 0x95, 0x93, 0x8e,
-    0x88, 0x84, 0x84, 0x80, 0x80, 0x7c, 0x7c, 0x77, 0x77, 0x77, 0x77, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x5e, 0x5e, 0x5e, 0x5a, 0x5b,
-    0x5b, 0x60, 0x5d, 0x5d, 0x58, 0x57, 0x54, 0x51, 0x51, 0x51, 0x50, 0x50,
-    0x50, 0x4f, 0x50, 0x50, 0x4f, 0x4b, 0x4b, 0x49, 0x49, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x43, 0x43, 0x43, 0x46, 0x41, 0x41, 0x41, 0x46, 0x41,
-    0x41, 0x41, 0x3b, 0x3b, 0x3b, 0x39, 0x37, 0x37, 0x37, 0x37, 0x42, 0x42,
-    0x42, 0x37, 0x37, 0x37, 0x36, 0x42, 0x35, 0x35, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x2f, 0x30, 0x2f, 0x30, 0x2f, 0x30, 0x2e, 0x2e, 0x2e, 0x34, 0x2d,
-    0x2b, 0x2b, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2c, 0x2a, 0x2b, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x23, 0x25,
-    0x1d, 0x1f, 0x21, 0x1f, 0x1f, 0x1f, 0x1f, 0x20, 0x20, 0x24, 0x23, 0x24,
-    0x24, 0x24, 0x24, 0x23, 0x25, 0x25, 0x25, 0x24, 0x23, 0x25, 0x25, 0x23,
-    0x25, 0x25, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x2c, 0x2c, 0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x30, 0x30, 0x2b,
-    0x2e, 0x30, 0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x42,
-    0x42, 0x35, 0x42, 0x37, 0x37, 0x37, 0x37, 0x39, 0x37, 0x37, 0x37, 0x3e,
-    0x3b, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x48, 0x48, 0x48, 0x48, 0x49, 0x4f, 0x4b,
-    0x4b, 0x4f, 0x50, 0x50, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x57, 0x57, 0x57, 0x58, 0x5d, 0x5d, 0x5a, 0x5a, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x61, 0x61, 0x62, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x7c, 0x7c, 0x7c,
-    0x80, 0x84, 0x88, 0x8e, 0x93, 0x99, 0xa0, 0xa2, 0xa6, 0xaa, 0xb2, 0xba,
-    0xc1, 0xcc, 0xd8, 0xe2, 0xec, 0xf0, 0xee, 0xea, 0xe1, 0xce, 0xc1, 0xb7,
-    0xb0, 0xa7, 0xa2, 0xa0, 0x99, 0x95, 0x93, 0x8e, 0x88, 0x84, 0x80, 0x80,
-    0x7c, 0x7c, 0x77, 0x77, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x62, 0x62, 0x62, 0x62, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x61, 0x61, 0x5e, 0x5e, 0x5e, 0x5e, 0x5a, 0x5d, 0x5d, 0x5a, 0x5b, 0x58,
-    0x58, 0x57, 0x57, 0x54, 0x54, 0x51, 0x51, 0x50, 0x50, 0x4f, 0x50, 0x50,
-    0x4b, 0x4b, 0x4b, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x43, 0x43, 0x43, 0x41, 0x41, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x3b,
-    0x3b, 0x39, 0x37, 0x37, 0x37, 0x37, 0x35, 0x35, 0x35, 0x42, 0x37, 0x37,
-    0x36, 0x36, 0x35, 0x35, 0x35, 0x30, 0x30, 0x30, 0x30, 0x33, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x2e, 0x33, 0x2e, 0x33, 0x33, 0x33, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2a, 0x2c, 0x2b, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x23, 0x25, 0x23, 0x23, 0x23, 0x1d, 0x1f, 0x21, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x20, 0x20, 0x24, 0x23, 0x24, 0x24, 0x23, 0x23, 0x25,
-    0x27, 0x27, 0x25, 0x20, 0x24, 0x25, 0x25, 0x25, 0x27, 0x29, 0x25, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2c, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2d, 0x2d,
-    0x2e, 0x2f, 0x30, 0x2e, 0x2b, 0x2e, 0x33, 0x2e, 0x2e, 0x30, 0x30, 0x2e,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x35, 0x35, 0x35, 0x37,
-    0x37, 0x37, 0x37, 0x39, 0x37, 0x37, 0x37, 0x39, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x48, 0x48, 0x48, 0x49, 0x4f, 0x49, 0x4b, 0x4b, 0x4f, 0x50,
-    0x51, 0x54, 0x54, 0x51, 0x51, 0x51, 0x54, 0x54, 0x57, 0x57, 0x57, 0x57,
-    0x58, 0x5d, 0x5a, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x61, 0x61, 0x61, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x7c, 0x7c, 0x7c, 0x80, 0x84, 0x84, 0x8b,
-    0x8e, 0x95, 0x9c, 0xa0, 0xa2, 0xa7, 0xb0, 0xb8, 0xc1, 0xce, 0xde, 0xe8,
-    0xef, 0xeb, 0xe5, 0xdf, 0xd2, 0xc7, 0xbf, 0xb7, 0xb0, 0xa6, 0xa2, 0xa0,
-    0x99, 0x95, 0x93, 0x8e, 0x88, 0x80, 0x80, 0x80, 0x7c, 0x77, 0x77, 0x77,
-    0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x6f, 0x61, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x5e, 0x5e, 0x5a,
-    0x5a, 0x5a, 0x5b, 0x58, 0x58, 0x5a, 0x5b, 0x5d, 0x58, 0x58, 0x57, 0x57,
-    0x57, 0x54, 0x51, 0x50, 0x50, 0x4b, 0x50, 0x4f, 0x4f, 0x4b, 0x4b, 0x49,
-    0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x43, 0x43, 0x48, 0x43,
-    0x4a, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x3b, 0x3e, 0x37, 0x39,
-    0x37, 0x36, 0x35, 0x30, 0x35, 0x42, 0x37, 0x37, 0x37, 0x36, 0x36, 0x35,
-    0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e,
-    0x33, 0x2e, 0x33, 0x30, 0x2e, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x27, 0x2c,
-    0x2a, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x25, 0x1d, 0x1d, 0x1f, 0x1f, 0x22, 0x22, 0x1f, 0x20,
-    0x24, 0x23, 0x23, 0x23, 0x24, 0x23, 0x25, 0x25, 0x27, 0x27, 0x25, 0x24,
-    0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2a,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x27, 0x2b, 0x2b, 0x2e, 0x2f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0x42, 0x37, 0x37, 0x37, 0x3e,
-    0x39, 0x37, 0x37, 0x37, 0x37, 0x3e, 0x3b, 0x3b, 0x41, 0x3b, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x4a, 0x43, 0x43, 0x48, 0x48,
-    0x48, 0x49, 0x49, 0x49, 0x49, 0x4b, 0x4b, 0x4b, 0x4f, 0x50, 0x50, 0x50,
-    0x51, 0x51, 0x51, 0x54, 0x54, 0x54, 0x57, 0x57, 0x57, 0x58, 0x5a, 0x5e,
-    0x5e, 0x5e, 0x61, 0x61, 0x5e, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x61,
-    0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x77, 0x77, 0x7c, 0x7c, 0x80, 0x80, 0x84, 0x88, 0x8e, 0x93, 0x99, 0xa0,
-    0xa2, 0xa7, 0xae, 0xb7, 0xc1, 0xd2, 0xe0, 0xeb, 0xee, 0xe5, 0xdb, 0xd2,
-    0xc7, 0xbf, 0xb7, 0xb0, 0xaa, 0xa6, 0xa0, 0x9b, 0x95, 0x93, 0x8e, 0x8e,
-    0x88, 0x80, 0x80, 0x7c, 0x7c, 0x77, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x61, 0x61, 0x61, 0x5e, 0x5e, 0x5a, 0x5a, 0x5a, 0x5a, 0x5b,
-    0x5b, 0x5b, 0x5d, 0x58, 0x57, 0x57, 0x57, 0x57, 0x57, 0x54, 0x51, 0x50,
-    0x50, 0x50, 0x50, 0x4f, 0x4b, 0x4b, 0x4f, 0x4b, 0x48, 0x48, 0x48, 0x43,
-    0x48, 0x48, 0x48, 0x48, 0x43, 0x43, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x3b, 0x3b, 0x39, 0x37, 0x37, 0x37, 0x36, 0x35, 0x35,
-    0x35, 0x35, 0x42, 0x42, 0x42, 0x35, 0x42, 0x35, 0x35, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x2e, 0x33,
-    0x2b, 0x2b, 0x2c, 0x2c, 0x2a, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x23, 0x24, 0x23, 0x25, 0x25,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x22, 0x1f, 0x20, 0x24, 0x24, 0x24,
-    0x24, 0x25, 0x27, 0x27, 0x27, 0x27, 0x25, 0x24, 0x24, 0x27, 0x27, 0x23,
-    0x23, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x2b, 0x2b, 0x2a, 0x2b, 0x2c, 0x27, 0x2a, 0x2b, 0x2e,
-    0x30, 0x30, 0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x35, 0x35, 0x30, 0x30,
-    0x30, 0x30, 0x35, 0x42, 0x37, 0x37, 0x39, 0x3b, 0x3b, 0x39, 0x37, 0x37,
-    0x37, 0x37, 0x39, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x46, 0x46, 0x43, 0x43, 0x43, 0x43, 0x43, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x49, 0x4b, 0x49, 0x4b, 0x4f, 0x50, 0x50, 0x51, 0x51, 0x51, 0x50,
-    0x50, 0x51, 0x51, 0x54, 0x57, 0x58, 0x5d, 0x5a, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x61, 0x61, 0x5e, 0x5e, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x6f, 0x6e, 0x69, 0x6f, 0x6f, 0x6f, 0x77, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x80, 0x84, 0x8b, 0x8e, 0x93, 0x95, 0x9c, 0xa2, 0xa6, 0xaa, 0xb5,
-    0xc1, 0xd2, 0xe2, 0xee, 0xeb, 0xe1, 0xd8, 0xce, 0xbf, 0xb8, 0xb2, 0xa9,
-    0xa6, 0xa0, 0x9b, 0x99, 0x95, 0x8e, 0x8b, 0x88, 0x84, 0x80, 0x80, 0x7c,
-    0x7c, 0x77, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x62, 0x61, 0x61,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x5a, 0x5a, 0x60, 0x5a, 0x5a, 0x58, 0x58, 0x57,
-    0x57, 0x57, 0x57, 0x57, 0x57, 0x54, 0x51, 0x50, 0x4b, 0x4b, 0x4f, 0x49,
-    0x48, 0x49, 0x4b, 0x49, 0x46, 0x49, 0x48, 0x41, 0x48, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x36, 0x42, 0x37, 0x30, 0x35, 0x35, 0x35,
-    0x35, 0x35, 0x36, 0x42, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x33, 0x2e, 0x30, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2c,
-    0x2c, 0x2b, 0x2a, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x25, 0x27, 0x23, 0x23, 0x23, 0x27, 0x25, 0x1d, 0x1d, 0x1d, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x20, 0x24, 0x20, 0x20, 0x20, 0x24, 0x23, 0x27,
-    0x27, 0x25, 0x25, 0x24, 0x23, 0x27, 0x27, 0x25, 0x23, 0x25, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2c, 0x2c, 0x27, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2d, 0x2e,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x35, 0x30, 0x30, 0x35, 0x35, 0x35, 0x30, 0x30, 0x35, 0x42, 0x36,
-    0x37, 0x37, 0x39, 0x39, 0x39, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39,
-    0x3e, 0x3b, 0x3b, 0x41, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x43, 0x43, 0x43, 0x43, 0x48, 0x48, 0x48, 0x43, 0x48, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4f, 0x50, 0x50, 0x51, 0x51, 0x50, 0x50, 0x51, 0x51, 0x54,
-    0x58, 0x57, 0x57, 0x58, 0x5b, 0x5e, 0x5a, 0x5e, 0x61, 0x62, 0x61, 0x5e,
-    0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77, 0x7c, 0x7c, 0x80, 0x84, 0x84,
-    0x8b, 0x8e, 0x93, 0x99, 0xa0, 0xa2, 0xaa, 0xb2, 0xc1, 0xd2, 0xe2, 0xee,
-    0xec, 0xe1, 0xd8, 0xc7, 0xbb, 0xb7, 0xb0, 0xa7, 0xa2, 0x9c, 0x99, 0x95,
-    0x93, 0x8e, 0x88, 0x84, 0x84, 0x80, 0x80, 0x80, 0x7c, 0x77, 0x77, 0x77,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x61, 0x62, 0x61, 0x61, 0x5e, 0x5e, 0x5e, 0x5a,
-    0x5a, 0x5b, 0x5b, 0x5b, 0x5b, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x54, 0x51, 0x50, 0x4f, 0x4b, 0x4b, 0x4b, 0x4b, 0x48, 0x48, 0x48, 0x46,
-    0x41, 0x48, 0x48, 0x41, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x3b, 0x3e, 0x37, 0x37,
-    0x37, 0x37, 0x36, 0x36, 0x42, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x2e, 0x2e, 0x2e,
-    0x2b, 0x2b, 0x2e, 0x2d, 0x2b, 0x2e, 0x2b, 0x2c, 0x2c, 0x2b, 0x2a, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x25,
-    0x25, 0x25, 0x25, 0x27, 0x1d, 0x1d, 0x1f, 0x1f, 0x1f, 0x21, 0x1f, 0x1f,
-    0x20, 0x20, 0x20, 0x20, 0x1f, 0x20, 0x20, 0x23, 0x23, 0x25, 0x23, 0x24,
-    0x24, 0x25, 0x27, 0x25, 0x24, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27,
-    0x27, 0x27, 0x27, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2f, 0x2e, 0x33, 0x30, 0x2e, 0x2e, 0x30, 0x35, 0x30, 0x30,
-    0x42, 0x42, 0x42, 0x35, 0x42, 0x35, 0x42, 0x36, 0x37, 0x42, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x36, 0x37, 0x37, 0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x41,
-    0x41, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43,
-    0x43, 0x43, 0x48, 0x48, 0x4a, 0x48, 0x49, 0x4b, 0x50, 0x50, 0x4b, 0x49,
-    0x49, 0x49, 0x49, 0x48, 0x48, 0x49, 0x49, 0x49, 0x51, 0x54, 0x57, 0x58,
-    0x5d, 0x58, 0x60, 0x58, 0x5d, 0x5a, 0x5e, 0x5e, 0x62, 0x61, 0x61, 0x61,
-    0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x69, 0x5e, 0x69, 0x6e,
-    0x6f, 0x77, 0x77, 0x7c, 0x7c, 0x80, 0x80, 0x80, 0x88, 0x8e, 0x93, 0x99,
-    0x9b, 0xa0, 0xa7, 0xb0, 0xbe, 0xcc, 0xdf, 0xe9, 0xed, 0xe4, 0xd8, 0xcb,
-    0xbe, 0xb5, 0xb0, 0xa7, 0xa0, 0x9b, 0x95, 0x93, 0x93, 0x8e, 0x8b, 0x84,
-    0x80, 0x80, 0x80, 0x7c, 0x7c, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x61, 0x61, 0x61, 0x5e, 0x5e, 0x5e, 0x5e, 0x5a, 0x5a, 0x5b, 0x5d, 0x5d,
-    0x58, 0x57, 0x57, 0x57, 0x57, 0x54, 0x57, 0x54, 0x54, 0x51, 0x50, 0x4f,
-    0x4b, 0x4b, 0x49, 0x48, 0x3e, 0x37, 0x30, 0x36, 0x37, 0x48, 0x49, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x3b, 0x3b, 0x3b, 0x39, 0x37, 0x37, 0x37, 0x36, 0x42,
-    0x42, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x2e, 0x2e, 0x2b, 0x2b, 0x2d, 0x2b,
-    0x2b, 0x2e, 0x2b, 0x2c, 0x2a, 0x2b, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x2c, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x27, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x1d, 0x1d, 0x1f, 0x1f, 0x1f, 0x21, 0x1f, 0x21, 0x24, 0x24, 0x24, 0x24,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x20, 0x24, 0x20, 0x1f, 0x1f, 0x23, 0x25, 0x23,
-    0x24, 0x23, 0x25, 0x27, 0x25, 0x25, 0x25, 0x25, 0x25, 0x23, 0x25, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x2b,
-    0x2b, 0x2b, 0x33, 0x2e, 0x2b, 0x2e, 0x2d, 0x2b, 0x2d, 0x2d, 0x2e, 0x2b,
-    0x2d, 0x2e, 0x2b, 0x2b, 0x2f, 0x30, 0x30, 0x30, 0x35, 0x42, 0x35, 0x35,
-    0x35, 0x30, 0x35, 0x42, 0x42, 0x35, 0x42, 0x42, 0x36, 0x36, 0x36, 0x30,
-    0x42, 0x37, 0x39, 0x3d, 0x3b, 0x3e, 0x3b, 0x3b, 0x3b, 0x3e, 0x39, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3d, 0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x39, 0x39,
-    0x42, 0x37, 0x3b, 0x41, 0x3d, 0x39, 0x42, 0x30, 0x2f, 0x2e, 0x2e, 0x2a,
-    0x2c, 0x2a, 0x2b, 0x2e, 0x37, 0x43, 0x50, 0x57, 0x57, 0x51, 0x52, 0x48,
-    0x41, 0x4a, 0x52, 0x54, 0x60, 0x60, 0x5a, 0x5e, 0x61, 0x62, 0x62, 0x62,
-    0x5e, 0x63, 0x48, 0x39, 0x30, 0x42, 0x3b, 0x4b, 0x6c, 0x6f, 0x77, 0x77,
-    0x7c, 0x7c, 0x80, 0x80, 0x84, 0x8e, 0x93, 0x95, 0x99, 0xa0, 0xa7, 0xae,
-    0xb7, 0xc7, 0xd2, 0xe5, 0xef, 0xea, 0xde, 0xc7, 0xbb, 0xb3, 0xae, 0xa6,
-    0xa0, 0x99, 0x95, 0x93, 0x8e, 0x8e, 0x8b, 0x84, 0x80, 0x7c, 0x7c, 0x7c,
-    0x77, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x5e, 0x5e,
-    0x5e, 0x5a, 0x5a, 0x60, 0x5b, 0x5d, 0x58, 0x58, 0x57, 0x57, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x51, 0x51, 0x50, 0x50, 0x4b, 0x49, 0x49, 0x48,
-    0x39, 0x30, 0x1f, 0x30, 0x3e, 0x43, 0x48, 0x48, 0x48, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x4a, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3e, 0x39, 0x39, 0x36, 0x42, 0x3a, 0x35, 0x35, 0x35,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x33, 0x2e, 0x2e, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2a,
-    0x2a, 0x2b, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x25, 0x25, 0x27, 0x25, 0x25, 0x23, 0x24, 0x24, 0x22, 0x1d, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x22, 0x1f, 0x1f, 0x24, 0x24, 0x20, 0x1f, 0x22, 0x22, 0x1d,
-    0x1f, 0x1f, 0x22, 0x22, 0x1f, 0x20, 0x20, 0x24, 0x24, 0x23, 0x23, 0x23,
-    0x25, 0x25, 0x23, 0x23, 0x24, 0x24, 0x23, 0x25, 0x27, 0x27, 0x27, 0x29,
-    0x25, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x2a, 0x2b, 0x2b, 0x2b, 0x33, 0x2e,
-    0x2e, 0x2e, 0x33, 0x2d, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2c, 0x2a,
-    0x2d, 0x30, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x35, 0x42, 0x3a, 0x35, 0x42, 0x42, 0x42, 0x42,
-    0x42, 0x37, 0x37, 0x37, 0x36, 0x30, 0x2e, 0x2c, 0x25, 0x23, 0x25, 0x25,
-    0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x1f, 0x1d, 0x1d, 0x1f, 0x20, 0x20,
-    0x1f, 0x1d, 0x1b, 0x19, 0x19, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x1b, 0x1b,
-    0x1c, 0x20, 0x2b, 0x30, 0x30, 0x30, 0x27, 0x24, 0x24, 0x25, 0x2b, 0x30,
-    0x39, 0x36, 0x37, 0x37, 0x41, 0x46, 0x49, 0x41, 0x2e, 0x1d, 0x17, 0x13,
-    0x18, 0x1c, 0x25, 0x37, 0x50, 0x6c, 0x6c, 0x69, 0x6f, 0x77, 0x77, 0x7c,
-    0x84, 0x84, 0x8b, 0x8e, 0x8c, 0x93, 0x8c, 0x99, 0xa9, 0xba, 0xc8, 0xdd,
-    0xe8, 0xe9, 0xd9, 0xc7, 0xb8, 0xb2, 0xa9, 0xa2, 0x9b, 0x95, 0x93, 0x8e,
-    0x8b, 0x8b, 0x84, 0x80, 0x7c, 0x7c, 0x77, 0x77, 0x77, 0x77, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x69, 0x5e, 0x5e, 0x62,
-    0x62, 0x62, 0x62, 0x61, 0x61, 0x61, 0x5e, 0x5e, 0x5e, 0x5a, 0x5a, 0x58,
-    0x5d, 0x58, 0x58, 0x57, 0x57, 0x57, 0x54, 0x54, 0x54, 0x51, 0x51, 0x51,
-    0x50, 0x50, 0x50, 0x50, 0x4f, 0x4b, 0x4b, 0x4b, 0x48, 0x40, 0x24, 0x38,
-    0x48, 0x48, 0x43, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x43, 0x43,
-    0x43, 0x46, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x39, 0x39, 0x36, 0x36, 0x42, 0x35, 0x35, 0x35, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2b, 0x2a, 0x2c, 0x2b, 0x2e, 0x2e, 0x2b, 0x2c, 0x2a, 0x27, 0x25,
-    0x27, 0x2c, 0x2c, 0x27, 0x27, 0x27, 0x27, 0x25, 0x23, 0x25, 0x27, 0x27,
-    0x27, 0x23, 0x24, 0x24, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x22, 0x1f, 0x1f, 0x1f, 0x1d, 0x1d, 0x1d, 0x1f, 0x1f, 0x22,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x20, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x28,
-    0x24, 0x23, 0x24, 0x25, 0x25, 0x27, 0x27, 0x27, 0x25, 0x2c, 0x2c, 0x2c,
-    0x27, 0x27, 0x27, 0x2c, 0x2b, 0x2e, 0x2e, 0x2e, 0x2b, 0x2e, 0x2d, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x27, 0x2c, 0x2a, 0x2a, 0x2b, 0x2e, 0x2e, 0x2b, 0x33,
-    0x30, 0x35, 0x30, 0x30, 0x30, 0x33, 0x2e, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2c, 0x27, 0x27, 0x2a, 0x2c, 0x27, 0x25, 0x28, 0x25, 0x2a, 0x2b, 0x2c,
-    0x23, 0x20, 0x1b, 0x18, 0x18, 0x17, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x19, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x19, 0x18, 0x18, 0x19, 0x19, 0x19,
-    0x1c, 0x1b, 0x1b, 0x1b, 0x1b, 0x1c, 0x1c, 0x1c, 0x1b, 0x18, 0x16, 0x15,
-    0x15, 0x17, 0x18, 0x15, 0x0d, 0x0d, 0x18, 0x1e, 0x1d, 0x1d, 0x1f, 0x2a,
-    0x35, 0x3b, 0x43, 0x48, 0x4b, 0x54, 0x68, 0x6c, 0x77, 0x6f, 0x77, 0x76,
-    0x6c, 0x6c, 0x5d, 0x68, 0x7c, 0x9b, 0xb2, 0xab, 0xb1, 0xd7, 0xc6, 0xa9,
-    0xb2, 0xaa, 0xa6, 0x9b, 0x99, 0x93, 0x93, 0x8b, 0x8b, 0x84, 0x80, 0x7c,
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x62, 0x62, 0x62,
-    0x61, 0x5b, 0x51, 0x49, 0x41, 0x41, 0x49, 0x49, 0x51, 0x5e, 0x61, 0x5e,
-    0x5e, 0x61, 0x5e, 0x5e, 0x5e, 0x5a, 0x58, 0x58, 0x5d, 0x58, 0x57, 0x57,
-    0x57, 0x53, 0x57, 0x51, 0x51, 0x50, 0x4b, 0x50, 0x4f, 0x4b, 0x50, 0x50,
-    0x50, 0x49, 0x48, 0x49, 0x48, 0x39, 0x20, 0x3d, 0x48, 0x48, 0x41, 0x46,
-    0x43, 0x48, 0x48, 0x43, 0x41, 0x48, 0x41, 0x41, 0x46, 0x46, 0x46, 0x41,
-    0x41, 0x41, 0x3b, 0x39, 0x39, 0x39, 0x3e, 0x39, 0x39, 0x37, 0x42, 0x35,
-    0x36, 0x42, 0x35, 0x3a, 0x35, 0x35, 0x35, 0x35, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x33, 0x30, 0x30, 0x33, 0x2b, 0x2b, 0x2b, 0x2a,
-    0x2a, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x27, 0x25, 0x27, 0x2c, 0x27, 0x27,
-    0x27, 0x27, 0x25, 0x23, 0x25, 0x27, 0x27, 0x27, 0x25, 0x25, 0x23, 0x23,
-    0x1b, 0x1b, 0x1c, 0x1c, 0x1d, 0x1d, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x22, 0x1f, 0x1f, 0x1d, 0x1f, 0x1f, 0x1f, 0x20, 0x20,
-    0x1f, 0x20, 0x20, 0x21, 0x28, 0x23, 0x25, 0x23, 0x23, 0x28, 0x24, 0x24,
-    0x25, 0x27, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x2b, 0x2b, 0x2b, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x2e, 0x33, 0x2b, 0x2b, 0x2b, 0x2d, 0x2b, 0x27, 0x25,
-    0x20, 0x1f, 0x1d, 0x1c, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x18, 0x18, 0x19,
-    0x19, 0x19, 0x1b, 0x1b, 0x1b, 0x19, 0x19, 0x18, 0x17, 0x16, 0x15, 0x12,
-    0x15, 0x15, 0x17, 0x17, 0x17, 0x17, 0x17, 0x16, 0x15, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x19, 0x19, 0x1b, 0x19, 0x19,
-    0x19, 0x19, 0x18, 0x18, 0x12, 0x0d, 0x0b, 0x0b, 0x0b, 0x0d, 0x15, 0x12,
-    0x11, 0x11, 0x18, 0x1d, 0x1b, 0x1d, 0x20, 0x2a, 0x30, 0x37, 0x3a, 0x35,
-    0x37, 0x39, 0x3b, 0x43, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x49, 0x51,
-    0x5a, 0x74, 0x92, 0x7c, 0x7e, 0xc8, 0xca, 0x7e, 0x93, 0xa0, 0x9b, 0x99,
-    0x95, 0x93, 0x8a, 0x88, 0x84, 0x80, 0x7c, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x6f, 0x6f, 0x6f, 0x62, 0x61, 0x61, 0x5b, 0x4f, 0x3b, 0x33, 0x20, 0x1d,
-    0x19, 0x18, 0x1c, 0x20, 0x27, 0x48, 0x5b, 0x5e, 0x61, 0x61, 0x5e, 0x5a,
-    0x5a, 0x5a, 0x5d, 0x5a, 0x5a, 0x58, 0x58, 0x5d, 0x58, 0x58, 0x57, 0x50,
-    0x51, 0x50, 0x4b, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4b, 0x48, 0x48, 0x4b,
-    0x49, 0x41, 0x20, 0x3d, 0x48, 0x49, 0x48, 0x48, 0x48, 0x43, 0x48, 0x48,
-    0x48, 0x48, 0x4a, 0x41, 0x3b, 0x3b, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x3e,
-    0x3e, 0x39, 0x37, 0x37, 0x37, 0x37, 0x42, 0x35, 0x42, 0x36, 0x3a, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x2e, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x2b,
-    0x2a, 0x2b, 0x2a, 0x2a, 0x2b, 0x2b, 0x2a, 0x27, 0x25, 0x27, 0x27, 0x27,
-    0x2c, 0x25, 0x25, 0x27, 0x27, 0x23, 0x20, 0x20, 0x19, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1c, 0x1d, 0x1d, 0x1f, 0x22, 0x22, 0x1d, 0x1d, 0x22, 0x1c, 0x1c,
-    0x1c, 0x1f, 0x1d, 0x22, 0x1f, 0x1f, 0x20, 0x20, 0x1f, 0x20, 0x20, 0x1f,
-    0x20, 0x24, 0x25, 0x24, 0x24, 0x24, 0x20, 0x24, 0x23, 0x24, 0x23, 0x27,
-    0x27, 0x27, 0x25, 0x25, 0x27, 0x2c, 0x2c, 0x27, 0x2c, 0x2c, 0x2a, 0x2a,
-    0x2b, 0x2b, 0x2c, 0x2a, 0x2c, 0x2b, 0x2b, 0x2b, 0x2c, 0x27, 0x25, 0x27,
-    0x27, 0x25, 0x24, 0x1f, 0x1f, 0x1c, 0x19, 0x18, 0x17, 0x15, 0x15, 0x15,
-    0x15, 0x12, 0x15, 0x15, 0x15, 0x15, 0x12, 0x12, 0x15, 0x16, 0x16, 0x18,
-    0x17, 0x16, 0x17, 0x15, 0x12, 0x11, 0x12, 0x12, 0x12, 0x15, 0x15, 0x15,
-    0x15, 0x17, 0x17, 0x17, 0x18, 0x18, 0x17, 0x15, 0x15, 0x12, 0x15, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x17, 0x18, 0x18, 0x19, 0x18, 0x18, 0x17, 0x17, 0x15, 0x12,
-    0x0b, 0x0b, 0x0f, 0x0b, 0x0b, 0x11, 0x15, 0x11, 0x0b, 0x0b, 0x11, 0x18,
-    0x19, 0x1c, 0x21, 0x2c, 0x30, 0x30, 0x2e, 0x2f, 0x30, 0x30, 0x30, 0x42,
-    0x3b, 0x41, 0x3e, 0x3e, 0x3d, 0x41, 0x3b, 0x4a, 0x50, 0x53, 0x5d, 0x5a,
-    0xb1, 0xd9, 0x94, 0x7c, 0x80, 0x93, 0x95, 0x8e, 0x88, 0x84, 0x84, 0x84,
-    0x80, 0x7c, 0x7c, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x69, 0x6d, 0x63,
-    0x48, 0x37, 0x2b, 0x20, 0x1c, 0x19, 0x15, 0x15, 0x15, 0x11, 0x0d, 0x15,
-    0x1c, 0x2b, 0x48, 0x63, 0x5a, 0x5e, 0x5b, 0x5b, 0x58, 0x58, 0x5b, 0x5d,
-    0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x54, 0x4f, 0x4f, 0x4f, 0x4b, 0x49,
-    0x4f, 0x50, 0x4b, 0x4b, 0x4b, 0x49, 0x49, 0x4b, 0x49, 0x41, 0x24, 0x3d,
-    0x46, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x43, 0x43, 0x43, 0x41, 0x41,
-    0x41, 0x41, 0x3b, 0x3b, 0x3e, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x35,
-    0x35, 0x39, 0x39, 0x3a, 0x42, 0x42, 0x37, 0x36, 0x35, 0x30, 0x33, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x2e, 0x2e, 0x33, 0x2e, 0x2d, 0x2e, 0x30, 0x34,
-    0x2b, 0x2a, 0x2c, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x27, 0x2a, 0x27, 0x27,
-    0x27, 0x2b, 0x2c, 0x25, 0x25, 0x27, 0x27, 0x29, 0x23, 0x25, 0x23, 0x25,
-    0x25, 0x24, 0x24, 0x1f, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1c, 0x19, 0x1b,
-    0x1d, 0x1d, 0x1d, 0x1c, 0x1d, 0x1d, 0x1d, 0x1c, 0x1b, 0x1d, 0x1c, 0x1d,
-    0x1c, 0x1c, 0x19, 0x19, 0x1c, 0x1c, 0x1b, 0x19, 0x1b, 0x1b, 0x1d, 0x1d,
-    0x22, 0x1f, 0x24, 0x24, 0x21, 0x1f, 0x20, 0x24, 0x25, 0x25, 0x25, 0x25,
-    0x25, 0x29, 0x27, 0x27, 0x2c, 0x27, 0x27, 0x2a, 0x2b, 0x2b, 0x2c, 0x23,
-    0x24, 0x1f, 0x1f, 0x1f, 0x1c, 0x19, 0x18, 0x19, 0x19, 0x18, 0x18, 0x17,
-    0x17, 0x15, 0x12, 0x15, 0x15, 0x15, 0x13, 0x15, 0x15, 0x11, 0x12, 0x15,
-    0x15, 0x15, 0x15, 0x12, 0x15, 0x15, 0x15, 0x15, 0x15, 0x16, 0x18, 0x17,
-    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x17, 0x17, 0x16, 0x16, 0x17,
-    0x17, 0x18, 0x18, 0x16, 0x15, 0x15, 0x16, 0x18, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-    0x18, 0x18, 0x17, 0x17, 0x15, 0x16, 0x11, 0x0d, 0x0b, 0x0c, 0x11, 0x0f,
-    0x0d, 0x11, 0x13, 0x0d, 0x0b, 0x0b, 0x0f, 0x11, 0x17, 0x19, 0x1d, 0x24,
-    0x2c, 0x2b, 0x2d, 0x2d, 0x2f, 0x30, 0x30, 0x30, 0x42, 0x37, 0x37, 0x36,
-    0x37, 0x39, 0x37, 0x39, 0x46, 0x41, 0x43, 0x4b, 0x8d, 0x87, 0x4f, 0x5d,
-    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x76, 0x80, 0x80, 0x7c, 0x77, 0x6e,
-    0x5e, 0x54, 0x4b, 0x49, 0x49, 0x44, 0x35, 0x27, 0x1d, 0x17, 0x13, 0x15,
-    0x15, 0x15, 0x12, 0x13, 0x11, 0x12, 0x1b, 0x1b, 0x27, 0x3b, 0x41, 0x39,
-    0x58, 0x5b, 0x4b, 0x54, 0x5d, 0x58, 0x58, 0x57, 0x54, 0x57, 0x58, 0x58,
-    0x57, 0x54, 0x57, 0x57, 0x51, 0x50, 0x4f, 0x4b, 0x4b, 0x4b, 0x4b, 0x4f,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x49, 0x41, 0x1f, 0x3a, 0x44, 0x43, 0x48, 0x43,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43, 0x3b, 0x41, 0x41, 0x37, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x37, 0x37, 0x37, 0x37, 0x37, 0x42, 0x30, 0x30,
-    0x38, 0x3a, 0x30, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33,
-    0x30, 0x30, 0x30, 0x2e, 0x2e, 0x2e, 0x33, 0x33, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x27, 0x27, 0x2c, 0x25, 0x25, 0x2a, 0x2c, 0x2c,
-    0x2b, 0x2a, 0x29, 0x1f, 0x19, 0x16, 0x18, 0x1f, 0x24, 0x1c, 0x16, 0x19,
-    0x1b, 0x1b, 0x1b, 0x1c, 0x1b, 0x1b, 0x1c, 0x1c, 0x1b, 0x1c, 0x1c, 0x1d,
-    0x1f, 0x1f, 0x1f, 0x1c, 0x1c, 0x1b, 0x18, 0x18, 0x15, 0x12, 0x0d, 0x0f,
-    0x0d, 0x11, 0x11, 0x0b, 0x0b, 0x0d, 0x13, 0x17, 0x18, 0x1b, 0x1f, 0x1e,
-    0x19, 0x1b, 0x1d, 0x1f, 0x24, 0x24, 0x24, 0x1f, 0x1f, 0x1d, 0x22, 0x1f,
-    0x1f, 0x24, 0x25, 0x27, 0x25, 0x24, 0x1f, 0x1b, 0x19, 0x18, 0x17, 0x15,
-    0x12, 0x11, 0x11, 0x11, 0x11, 0x0d, 0x0f, 0x0d, 0x12, 0x12, 0x0d, 0x11,
-    0x12, 0x12, 0x11, 0x12, 0x12, 0x0d, 0x11, 0x11, 0x11, 0x0d, 0x11, 0x15,
-    0x15, 0x17, 0x15, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x15,
-    0x15, 0x15, 0x15, 0x16, 0x16, 0x15, 0x12, 0x12, 0x15, 0x17, 0x16, 0x15,
-    0x16, 0x16, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x18, 0x18, 0x16, 0x16,
-    0x16, 0x16, 0x15, 0x15, 0x16, 0x16, 0x15, 0x15, 0x16, 0x16, 0x15, 0x15,
-    0x12, 0x0d, 0x0b, 0x08, 0x06, 0x08, 0x0b, 0x0a, 0x0a, 0x0b, 0x11, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0d, 0x15, 0x1b, 0x20, 0x25, 0x27, 0x27, 0x2c,
-    0x2a, 0x2b, 0x2e, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x37, 0x36, 0x39,
-    0x39, 0x3e, 0x3b, 0x41, 0x49, 0x48, 0x41, 0x41, 0x46, 0x46, 0x43, 0x43,
-    0x48, 0x4b, 0x54, 0x77, 0x77, 0x6c, 0x51, 0x49, 0x3b, 0x2e, 0x27, 0x23,
-    0x20, 0x1b, 0x18, 0x17, 0x16, 0x15, 0x15, 0x15, 0x11, 0x11, 0x12, 0x15,
-    0x12, 0x1d, 0x38, 0x3d, 0x48, 0x57, 0x46, 0x27, 0x49, 0x50, 0x39, 0x49,
-    0x58, 0x57, 0x58, 0x5d, 0x58, 0x54, 0x51, 0x57, 0x57, 0x54, 0x57, 0x57,
-    0x4f, 0x49, 0x50, 0x51, 0x50, 0x4b, 0x4b, 0x49, 0x49, 0x49, 0x48, 0x48,
-    0x39, 0x2b, 0x11, 0x19, 0x3a, 0x46, 0x3d, 0x38, 0x2b, 0x2c, 0x29, 0x30,
-    0x3d, 0x41, 0x41, 0x30, 0x28, 0x1f, 0x21, 0x30, 0x3b, 0x3b, 0x39, 0x37,
-    0x42, 0x42, 0x33, 0x20, 0x1d, 0x28, 0x1d, 0x17, 0x18, 0x24, 0x34, 0x35,
-    0x3a, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x2d,
-    0x2c, 0x27, 0x2b, 0x2b, 0x2b, 0x2c, 0x25, 0x25, 0x25, 0x24, 0x23, 0x25,
-    0x1f, 0x19, 0x17, 0x12, 0x12, 0x17, 0x1a, 0x18, 0x17, 0x17, 0x12, 0x08,
-    0x05, 0x03, 0x04, 0x08, 0x09, 0x06, 0x03, 0x04, 0x19, 0x19, 0x18, 0x19,
-    0x19, 0x19, 0x1b, 0x18, 0x17, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19, 0x17,
-    0x16, 0x15, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0c, 0x0d, 0x0d, 0x0d, 0x15, 0x17, 0x16, 0x15, 0x18, 0x1b, 0x22,
-    0x22, 0x1d, 0x1c, 0x18, 0x15, 0x11, 0x11, 0x11, 0x15, 0x19, 0x1d, 0x22,
-    0x1c, 0x18, 0x18, 0x15, 0x15, 0x12, 0x11, 0x0d, 0x11, 0x11, 0x12, 0x11,
-    0x0f, 0x0c, 0x0d, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x0d, 0x11, 0x12,
-    0x12, 0x12, 0x12, 0x12, 0x11, 0x0d, 0x0d, 0x11, 0x12, 0x15, 0x15, 0x12,
-    0x11, 0x0d, 0x11, 0x12, 0x11, 0x11, 0x12, 0x11, 0x12, 0x13, 0x12, 0x15,
-    0x12, 0x11, 0x11, 0x0d, 0x12, 0x15, 0x12, 0x12, 0x16, 0x17, 0x16, 0x15,
-    0x15, 0x15, 0x15, 0x16, 0x16, 0x16, 0x15, 0x12, 0x13, 0x15, 0x15, 0x15,
-    0x15, 0x15, 0x15, 0x12, 0x15, 0x15, 0x11, 0x0d, 0x0f, 0x0b, 0x08, 0x06,
-    0x07, 0x08, 0x0b, 0x0b, 0x09, 0x0b, 0x0d, 0x0b, 0x0a, 0x0b, 0x0d, 0x0d,
-    0x17, 0x18, 0x1b, 0x22, 0x1d, 0x1f, 0x27, 0x27, 0x27, 0x2c, 0x27, 0x2a,
-    0x33, 0x30, 0x30, 0x33, 0x30, 0x3a, 0x30, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x39, 0x3b, 0x39, 0x37, 0x3b, 0x37, 0x37, 0x37, 0x3e, 0x49, 0x51, 0x5d,
-    0x51, 0x37, 0x27, 0x25, 0x25, 0x20, 0x1d, 0x1b, 0x19, 0x18, 0x17, 0x17,
-    0x15, 0x11, 0x15, 0x15, 0x11, 0x0d, 0x0c, 0x0d, 0x11, 0x18, 0x27, 0x48,
-    0x5a, 0x5b, 0x39, 0x22, 0x46, 0x46, 0x30, 0x46, 0x51, 0x54, 0x5d, 0x57,
-    0x57, 0x49, 0x3b, 0x46, 0x52, 0x48, 0x41, 0x39, 0x2c, 0x2b, 0x3d, 0x49,
-    0x49, 0x49, 0x41, 0x30, 0x30, 0x37, 0x3a, 0x2b, 0x19, 0x08, 0x04, 0x06,
-    0x17, 0x26, 0x1a, 0x17, 0x0b, 0x08, 0x08, 0x15, 0x1f, 0x25, 0x2b, 0x17,
-    0x07, 0x06, 0x06, 0x18, 0x2b, 0x24, 0x1c, 0x18, 0x18, 0x18, 0x11, 0x06,
-    0x05, 0x07, 0x06, 0x03, 0x03, 0x08, 0x1a, 0x21, 0x21, 0x22, 0x1e, 0x1f,
-    0x21, 0x26, 0x21, 0x1f, 0x20, 0x1f, 0x22, 0x1c, 0x18, 0x18, 0x1b, 0x19,
-    0x17, 0x12, 0x0c, 0x0b, 0x0c, 0x0b, 0x0b, 0x0c, 0x06, 0x04, 0x03, 0x01,
-    0x02, 0x02, 0x04, 0x03, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x17, 0x15, 0x0f, 0x0f, 0x0d, 0x0d, 0x08,
-    0x08, 0x09, 0x0b, 0x0b, 0x0b, 0x0d, 0x0d, 0x0b, 0x0b, 0x0b, 0x0b, 0x08,
-    0x09, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0f, 0x0d, 0x0d, 0x0f, 0x0d, 0x15, 0x18, 0x19, 0x18, 0x17, 0x15, 0x0d,
-    0x0d, 0x0c, 0x0b, 0x0b, 0x0d, 0x12, 0x15, 0x16, 0x15, 0x13, 0x11, 0x11,
-    0x0d, 0x11, 0x0d, 0x0d, 0x0d, 0x11, 0x15, 0x16, 0x12, 0x0b, 0x0b, 0x0d,
-    0x11, 0x0f, 0x0d, 0x0d, 0x11, 0x0d, 0x0d, 0x0d, 0x12, 0x11, 0x0d, 0x12,
-    0x12, 0x0d, 0x0d, 0x12, 0x15, 0x13, 0x12, 0x12, 0x11, 0x12, 0x12, 0x12,
-    0x12, 0x12, 0x0d, 0x12, 0x12, 0x0d, 0x0f, 0x0f, 0x0b, 0x0c, 0x11, 0x11,
-    0x12, 0x12, 0x15, 0x15, 0x15, 0x15, 0x15, 0x12, 0x15, 0x15, 0x15, 0x12,
-    0x15, 0x15, 0x15, 0x15, 0x16, 0x12, 0x12, 0x15, 0x15, 0x15, 0x13, 0x11,
-    0x12, 0x15, 0x11, 0x0f, 0x0b, 0x08, 0x08, 0x07, 0x08, 0x09, 0x0b, 0x0b,
-    0x08, 0x09, 0x0f, 0x08, 0x08, 0x0d, 0x15, 0x15, 0x17, 0x1a, 0x19, 0x19,
-    0x18, 0x19, 0x21, 0x27, 0x2a, 0x2c, 0x27, 0x2b, 0x2b, 0x27, 0x27, 0x2c,
-    0x2a, 0x2b, 0x33, 0x30, 0x30, 0x30, 0x2d, 0x2b, 0x30, 0x30, 0x33, 0x30,
-    0x30, 0x2b, 0x27, 0x2b, 0x2f, 0x37, 0x41, 0x30, 0x24, 0x1b, 0x19, 0x1b,
-    0x1c, 0x19, 0x18, 0x17, 0x15, 0x16, 0x15, 0x12, 0x12, 0x12, 0x12, 0x12,
-    0x0d, 0x0d, 0x0b, 0x0d, 0x0d, 0x17, 0x2c, 0x50, 0x58, 0x46, 0x24, 0x1d,
-    0x3d, 0x2b, 0x2b, 0x3d, 0x30, 0x42, 0x51, 0x50, 0x46, 0x2b, 0x1d, 0x1f,
-    0x1f, 0x18, 0x11, 0x0b, 0x08, 0x0b, 0x18, 0x30, 0x41, 0x37, 0x1b, 0x0f,
-    0x12, 0x17, 0x12, 0x0d, 0x07, 0x05, 0x03, 0x03, 0x06, 0x07, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0b, 0x06, 0x04, 0x04, 0x06, 0x0c,
-    0x0b, 0x06, 0x04, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01,
-    0x01, 0x02, 0x03, 0x05, 0x05, 0x05, 0x04, 0x06, 0x0b, 0x11, 0x15, 0x15,
-    0x16, 0x0e, 0x07, 0x06, 0x05, 0x06, 0x06, 0x06, 0x04, 0x02, 0x02, 0x02,
-    0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x0d, 0x0b, 0x08, 0x08, 0x08, 0x08, 0x06, 0x06, 0x08, 0x08, 0x08,
-    0x0b, 0x0b, 0x0b, 0x0a, 0x08, 0x08, 0x08, 0x09, 0x09, 0x0b, 0x0b, 0x0b,
-    0x09, 0x08, 0x08, 0x08, 0x09, 0x0b, 0x0b, 0x0b, 0x0c, 0x0d, 0x0b, 0x0b,
-    0x0b, 0x11, 0x15, 0x15, 0x12, 0x0d, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0d, 0x12, 0x11, 0x0d, 0x12, 0x11, 0x0d, 0x0d, 0x11, 0x0d, 0x0d,
-    0x0d, 0x0d, 0x15, 0x16, 0x12, 0x0b, 0x0a, 0x11, 0x11, 0x0c, 0x0d, 0x0d,
-    0x0d, 0x11, 0x0d, 0x0d, 0x11, 0x0d, 0x0d, 0x11, 0x12, 0x0d, 0x11, 0x15,
-    0x15, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0f, 0x0d, 0x12, 0x12, 0x11, 0x11,
-    0x11, 0x0d, 0x09, 0x08, 0x08, 0x09, 0x0d, 0x0d, 0x12, 0x15, 0x16, 0x15,
-    0x12, 0x12, 0x12, 0x12, 0x15, 0x15, 0x12, 0x11, 0x11, 0x15, 0x15, 0x15,
-    0x15, 0x12, 0x12, 0x15, 0x12, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0f, 0x0b,
-    0x0b, 0x08, 0x08, 0x08, 0x06, 0x08, 0x0b, 0x08, 0x08, 0x09, 0x0c, 0x0a,
-    0x0a, 0x0c, 0x11, 0x11, 0x0d, 0x15, 0x15, 0x15, 0x12, 0x15, 0x19, 0x26,
-    0x25, 0x25, 0x23, 0x2c, 0x2c, 0x24, 0x20, 0x24, 0x23, 0x2c, 0x2b, 0x2a,
-    0x2c, 0x27, 0x24, 0x24, 0x23, 0x24, 0x20, 0x24, 0x1f, 0x1f, 0x22, 0x1f,
-    0x20, 0x1f, 0x1f, 0x1d, 0x19, 0x18, 0x18, 0x1a, 0x18, 0x18, 0x17, 0x16,
-    0x11, 0x12, 0x11, 0x11, 0x11, 0x0d, 0x11, 0x0d, 0x0b, 0x0b, 0x0b, 0x0e,
-    0x0b, 0x12, 0x25, 0x46, 0x33, 0x15, 0x0b, 0x11, 0x18, 0x0d, 0x17, 0x1d,
-    0x15, 0x15, 0x2e, 0x42, 0x27, 0x19, 0x0d, 0x08, 0x0b, 0x08, 0x08, 0x06,
-    0x06, 0x06, 0x08, 0x15, 0x1b, 0x15, 0x06, 0x05, 0x07, 0x07, 0x06, 0x05,
-    0x04, 0x04, 0x02, 0x02, 0x03, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x04, 0x04, 0x04, 0x03, 0x02, 0x03, 0x05, 0x06, 0x06, 0x04, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
-    0x02, 0x01, 0x00, 0x00, 0x03, 0x05, 0x06, 0x05, 0x04, 0x02, 0x00, 0x00,
-    0x00, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0a, 0x08, 0x06,
-    0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0a, 0x0b, 0x0a, 0x08,
-    0x08, 0x08, 0x08, 0x09, 0x09, 0x0b, 0x0b, 0x09, 0x08, 0x08, 0x09, 0x09,
-    0x09, 0x0b, 0x0c, 0x0c, 0x0f, 0x0b, 0x0b, 0x08, 0x0b, 0x0b, 0x0d, 0x11,
-    0x0f, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0f, 0x0d, 0x11, 0x12,
-    0x0d, 0x11, 0x11, 0x0f, 0x0b, 0x0b, 0x0c, 0x0f, 0x0b, 0x0d, 0x11, 0x0d,
-    0x0d, 0x0b, 0x0b, 0x11, 0x11, 0x0b, 0x0d, 0x0f, 0x11, 0x11, 0x0d, 0x11,
-    0x11, 0x0d, 0x0d, 0x11, 0x12, 0x11, 0x0d, 0x11, 0x12, 0x0d, 0x0d, 0x11,
-    0x0d, 0x0f, 0x0b, 0x0f, 0x11, 0x11, 0x0d, 0x0d, 0x0d, 0x0b, 0x08, 0x08,
-    0x07, 0x08, 0x0b, 0x11, 0x11, 0x15, 0x15, 0x11, 0x12, 0x12, 0x0d, 0x11,
-    0x12, 0x12, 0x11, 0x0d, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
-    0x11, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0b, 0x08, 0x08, 0x06, 0x06, 0x06,
-    0x06, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0b, 0x08, 0x08, 0x08, 0x0b, 0x0b,
-    0x0b, 0x0f, 0x0d, 0x0d, 0x0d, 0x11, 0x17, 0x1b, 0x1f, 0x26, 0x20, 0x24,
-    0x20, 0x1f, 0x1d, 0x1d, 0x22, 0x24, 0x25, 0x24, 0x1f, 0x1d, 0x1b, 0x1c,
-    0x1c, 0x1c, 0x1b, 0x19, 0x18, 0x1b, 0x1c, 0x1b, 0x19, 0x19, 0x18, 0x18,
-    0x17, 0x16, 0x15, 0x16, 0x15, 0x15, 0x15, 0x11, 0x0f, 0x0c, 0x0d, 0x0d,
-    0x0d, 0x0b, 0x0b, 0x0b, 0x08, 0x0b, 0x0b, 0x09, 0x0b, 0x0c, 0x18, 0x1f,
-    0x15, 0x08, 0x07, 0x06, 0x06, 0x07, 0x08, 0x09, 0x07, 0x08, 0x11, 0x19,
-    0x17, 0x0d, 0x06, 0x05, 0x06, 0x05, 0x05, 0x05, 0x05, 0x04, 0x05, 0x06,
-    0x06, 0x04, 0x04, 0x04, 0x05, 0x03, 0x03, 0x03, 0x02, 0x02, 0x01, 0x02,
-    0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x01,
-    0x01, 0x01, 0x02, 0x03, 0x05, 0x03, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
-    0x02, 0x04, 0x03, 0x02, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0a, 0x08, 0x06, 0x08, 0x07, 0x07, 0x07, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x0b, 0x0b, 0x09, 0x09, 0x08, 0x0b, 0x0b, 0x0b, 0x08, 0x0b, 0x0d, 0x11,
-    0x0d, 0x0b, 0x08, 0x08, 0x0b, 0x0c, 0x0f, 0x0b, 0x0b, 0x0b, 0x0b, 0x0f,
-    0x0d, 0x0d, 0x0d, 0x0b, 0x0f, 0x11, 0x12, 0x11, 0x11, 0x12, 0x0d, 0x0b,
-    0x0b, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0f, 0x0b, 0x0d, 0x11, 0x0b, 0x0d,
-    0x11, 0x0b, 0x0d, 0x0d, 0x11, 0x12, 0x11, 0x0d, 0x11, 0x0d, 0x11, 0x12,
-    0x15, 0x0d, 0x0c, 0x0b, 0x0d, 0x0d, 0x0d, 0x0d, 0x0c, 0x0b, 0x0b, 0x0b,
-    0x0d, 0x0f, 0x0c, 0x0f, 0x0b, 0x08, 0x06, 0x06, 0x06, 0x08, 0x0b, 0x0f,
-    0x0d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0d, 0x11, 0x11, 0x11, 0x11,
-    0x0d, 0x11, 0x12, 0x11, 0x11, 0x12, 0x12, 0x0d, 0x0f, 0x0d, 0x12, 0x11,
-    0x11, 0x15, 0x0b, 0x08, 0x06, 0x07, 0x06, 0x06, 0x06, 0x08, 0x08, 0x08,
-    0x06, 0x08, 0x07, 0x07, 0x08, 0x08, 0x0b, 0x0b, 0x0a, 0x0b, 0x0f, 0x0c,
-    0x0b, 0x0d, 0x12, 0x15, 0x18, 0x1c, 0x1f, 0x1f, 0x1d, 0x1c, 0x19, 0x18,
-    0x18, 0x1b, 0x1c, 0x1b, 0x19, 0x19, 0x19, 0x1b, 0x1b, 0x19, 0x18, 0x18,
-    0x18, 0x17, 0x17, 0x17, 0x15, 0x15, 0x12, 0x12, 0x0d, 0x0f, 0x0b, 0x0d,
-    0x0d, 0x0d, 0x11, 0x0b, 0x0b, 0x08, 0x0b, 0x0b, 0x0b, 0x08, 0x08, 0x07,
-    0x06, 0x08, 0x08, 0x06, 0x06, 0x07, 0x08, 0x08, 0x07, 0x06, 0x05, 0x03,
-    0x04, 0x05, 0x05, 0x03, 0x04, 0x04, 0x04, 0x06, 0x06, 0x05, 0x03, 0x02,
-    0x02, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02,
-    0x05, 0x04, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-};
@@ -0,0 +1,604 @@
+//*****************************************************************************
+//
+// numfield.c - Fixed layout numeric field widget.
+//
+// The values on the status panels used to be drawn as whole opaque strings
+// on every display frame, with their width measured each time to align them
+// right.  A numeric field lays its value out once, from a template, into
+// cells of fixed position and width: a digit cell is as wide as the widest
+// digit, a space or a minus sign, and any other cell as wide as the
+// character the template puts there.
+//
+// The first time a font is used, the glyphs of NUMFIELD_GLYPHS are rendered
+// once, through grlib, into a 1 BPP glyph atlas: a digit or a minus sign
+// centered in a digit cell, any other glyph at its own width.  A cell is then
+// drawn by streaming its atlas glyph into one display window in the colors
+// of the context, instead of having grlib decode the compressed font and set
+// up the display row by row for every character.
+//
+// A field remembers the characters it put on the display and redraws only
+// the cells whose character changed, which is usually one or two digits of a
+// value.  Cells past the end of a shorter value are blanked, so values do
+// not need trailing spaces to erase the previous one.  Whatever painted the
+// field's background, such as the paint handler of its panel, must call
+// NumFieldInvalidate() so that the whole field is drawn again.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup numfield_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "grlib/grlib.h"
+#include "Kentec320x240x16_ssd2119_8bit.h"
+#include "compositor.h"
+#include "numfield.h"
+
+//*****************************************************************************
+//
+// The marker for a glyph that is not in the atlas.
+//
+//*****************************************************************************
+#define NUMFIELD_NO_GLYPH       0xFFFF
+
+//*****************************************************************************
+//
+// The glyphs of a font, in NUMFIELD_GLYPHS order: their widths, the offsets
+// of their renderings in the atlas and the widths they were rendered at.
+//
+//*****************************************************************************
+typedef struct
+{
+    const tFont *psFont;
+    uint8_t pui8Width[NUM_NUMFIELD_GLYPHS];
+    uint8_t pui8AtlasWidth[NUM_NUMFIELD_GLYPHS];
+    uint16_t pui16Atlas[NUM_NUMFIELD_GLYPHS];
+    uint8_t ui8DigitWidth;
+    uint8_t ui8Height;
+}
+tNumFieldFont;
+
+static tNumFieldFont g_psNumFieldFonts[NUMFIELD_MAX_FONTS];
+static uint32_t g_ui32NumFieldFonts;
+
+//*****************************************************************************
+//
+// The glyph atlas.  Each glyph is stored row by row from the top, most
+// significant bit first, with each row starting on a byte boundary.
+//
+//*****************************************************************************
+static uint8_t g_pui8NumFieldAtlas[NUMFIELD_ATLAS_SIZE];
+static uint32_t g_ui32NumFieldAtlasUsed;
+
+//*****************************************************************************
+//
+// A display that renders into an atlas glyph, which is the only thing it has
+// to support: any drawing in a color other than black sets the pixels.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint8_t *pui8Bits;
+    uint32_t ui32Stride;
+}
+tNumFieldCapture;
+
+static tNumFieldCapture g_sNumFieldCapture;
+
+static void
+NumFieldCapturePixelDraw(void *pvDisplayData, int32_t i32X, int32_t i32Y,
+                         uint32_t ui32Value)
+{
+    tNumFieldCapture *psCapture;
+
+    psCapture = (tNumFieldCapture *)pvDisplayData;
+    if(ui32Value)
+    {
+        psCapture->pui8Bits[(i32Y * psCapture->ui32Stride) + (i32X / 8)] |=
+            0x80 >> (i32X & 7);
+    }
+}
+
+static void
+NumFieldCapturePixelDrawMultiple(void *pvDisplayData, int32_t i32X,
+                                 int32_t i32Y, int32_t i32X0,
+                                 int32_t i32Count, int32_t i32BPP,
+                                 const uint8_t *pui8Data,
+                                 const uint8_t *pui8Palette)
+{
+    //
+    // Fonts are drawn with 1 BPP data, whose palette holds the translated
+    // background and foreground colors.
+    //
+    if(i32BPP != 1)
+    {
+        return;
+    }
+
+    for(; i32Count > 0; i32Count--, i32X++, i32X0++)
+    {
+        NumFieldCapturePixelDraw(pvDisplayData, i32X, i32Y,
+                                 ((const uint32_t *)pui8Palette)
+                                 [(pui8Data[i32X0 / 8] >>
+                                   (7 - (i32X0 & 7))) & 1]);
+    }
+}
+
+static void
+NumFieldCaptureLineDrawH(void *pvDisplayData, int32_t i32X1, int32_t i32X2,
+                         int32_t i32Y, uint32_t ui32Value)
+{
+    for(; i32X1 <= i32X2; i32X1++)
+    {
+        NumFieldCapturePixelDraw(pvDisplayData, i32X1, i32Y, ui32Value);
+    }
+}
+
+static void
+NumFieldCaptureLineDrawV(void *pvDisplayData, int32_t i32X, int32_t i32Y1,
+                         int32_t i32Y2, uint32_t ui32Value)
+{
+    for(; i32Y1 <= i32Y2; i32Y1++)
+    {
+        NumFieldCapturePixelDraw(pvDisplayData, i32X, i32Y1, ui32Value);
+    }
+}
+
+static void
+NumFieldCaptureRectFill(void *pvDisplayData, const tRectangle *psRect,
+                        uint32_t ui32Value)
+{
+    int32_t i32Y;
+
+    for(i32Y = psRect->i16YMin; i32Y <= psRect->i16YMax; i32Y++)
+    {
+        NumFieldCaptureLineDrawH(pvDisplayData, psRect->i16XMin,
+                                 psRect->i16XMax, i32Y, ui32Value);
+    }
+}
+
+static uint32_t
+NumFieldCaptureColorTranslate(void *pvDisplayData, uint32_t ui32Value)
+{
+    return(ui32Value ? 1 : 0);
+}
+
+static void
+NumFieldCaptureFlush(void *pvDisplayData)
+{
+}
+
+static tDisplay g_sNumFieldCaptureDisplay =
+{
+    sizeof(tDisplay),
+    &g_sNumFieldCapture,
+    0,
+    0,
+    NumFieldCapturePixelDraw,
+    NumFieldCapturePixelDrawMultiple,
+    NumFieldCaptureLineDrawH,
+    NumFieldCaptureLineDrawV,
+    NumFieldCaptureRectFill,
+    NumFieldCaptureColorTranslate,
+    NumFieldCaptureFlush
+};
+
+//*****************************************************************************
+//
+// Returns true if a character is drawn in digit cells.
+//
+//*****************************************************************************
+static bool
+NumFieldDigitCheck(char cChar)
+{
+    return(((cChar >= '0') && (cChar <= '9')) || (cChar == '-') ||
+           (cChar == ' '));
+}
+
+//*****************************************************************************
+//
+// Renders the glyphs of a font into the atlas.  A space is never rendered,
+// since it is drawn as a fill.
+//
+//*****************************************************************************
+static void
+NumFieldAtlasBuild(tNumFieldFont *psFont)
+{
+    tContext sContext;
+    uint32_t ui32Idx, ui32Size;
+    int32_t i32Width;
+    char pcGlyph[1];
+
+    for(ui32Idx = 0; ui32Idx < NUM_NUMFIELD_GLYPHS; ui32Idx++)
+    {
+        pcGlyph[0] = NUMFIELD_GLYPHS[ui32Idx];
+        i32Width = NumFieldDigitCheck(pcGlyph[0]) ? psFont->ui8DigitWidth :
+                   psFont->pui8Width[ui32Idx];
+        ui32Size = ((i32Width + 7) / 8) * psFont->ui8Height;
+        psFont->pui8AtlasWidth[ui32Idx] = i32Width;
+        psFont->pui16Atlas[ui32Idx] = NUMFIELD_NO_GLYPH;
+        if((pcGlyph[0] == ' ') || (i32Width == 0) ||
+           ((g_ui32NumFieldAtlasUsed + ui32Size) > NUMFIELD_ATLAS_SIZE))
+        {
+            continue;
+        }
+
+        //
+        // Draw the glyph, centered, in white on black into its place in the
+        // atlas.
+        //
+        g_sNumFieldCapture.pui8Bits =
+            &g_pui8NumFieldAtlas[g_ui32NumFieldAtlasUsed];
+        g_sNumFieldCapture.ui32Stride = (i32Width + 7) / 8;
+        g_sNumFieldCaptureDisplay.ui16Width = i32Width;
+        g_sNumFieldCaptureDisplay.ui16Height = psFont->ui8Height;
+        memset(g_sNumFieldCapture.pui8Bits, 0, ui32Size);
+
+        GrContextInit(&sContext, &g_sNumFieldCaptureDisplay);
+        GrContextFontSet(&sContext, psFont->psFont);
+        GrContextForegroundSet(&sContext, ClrWhite);
+        GrContextBackgroundSet(&sContext, ClrBlack);
+        GrStringDraw(&sContext, pcGlyph, 1,
+                     (i32Width - psFont->pui8Width[ui32Idx]) / 2, 0, 0);
+
+        psFont->pui16Atlas[ui32Idx] = g_ui32NumFieldAtlasUsed;
+        g_ui32NumFieldAtlasUsed += ui32Size;
+    }
+}
+
+//*****************************************************************************
+//
+// Returns the glyphs of the context font, measuring and rendering them the
+// first time the font is seen, or 0 if there is no room for another font.
+//
+//*****************************************************************************
+static const tNumFieldFont *
+NumFieldFontGet(const tContext *psContext)
+{
+    tNumFieldFont *psFont;
+    uint32_t ui32Idx;
+    char pcGlyph[1];
+
+    for(ui32Idx = 0; ui32Idx < g_ui32NumFieldFonts; ui32Idx++)
+    {
+        if(g_psNumFieldFonts[ui32Idx].psFont == psContext->psFont)
+        {
+            return(&g_psNumFieldFonts[ui32Idx]);
+        }
+    }
+
+    if(g_ui32NumFieldFonts == NUMFIELD_MAX_FONTS)
+    {
+        return(0);
+    }
+
+    psFont = &g_psNumFieldFonts[g_ui32NumFieldFonts++];
+    psFont->psFont = psContext->psFont;
+    psFont->ui8Height = GrFontHeightGet(psContext->psFont);
+    psFont->ui8DigitWidth = 0;
+    for(ui32Idx = 0; ui32Idx < NUM_NUMFIELD_GLYPHS; ui32Idx++)
+    {
+        pcGlyph[0] = NUMFIELD_GLYPHS[ui32Idx];
+        psFont->pui8Width[ui32Idx] = GrStringWidthGet(psContext, pcGlyph, 1);
+        if(NumFieldDigitCheck(pcGlyph[0]) &&
+           (psFont->pui8Width[ui32Idx] > psFont->ui8DigitWidth))
+        {
+            psFont->ui8DigitWidth = psFont->pui8Width[ui32Idx];
+        }
+    }
+
+    NumFieldAtlasBuild(psFont);
+
+    return(psFont);
+}
+
+//*****************************************************************************
+//
+// Returns the index of a character in NUMFIELD_GLYPHS, or NUM_NUMFIELD_GLYPHS
+// if it is not one of them.
+//
+//*****************************************************************************
+static uint32_t
+NumFieldGlyphIndex(char cChar)
+{
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < NUM_NUMFIELD_GLYPHS; ui32Idx++)
+    {
+        if(NUMFIELD_GLYPHS[ui32Idx] == cChar)
+        {
+            break;
+        }
+    }
+
+    return(ui32Idx);
+}
+
+//*****************************************************************************
+//
+// Returns the width of a character in the context font.
+//
+//*****************************************************************************
+static int32_t
+NumFieldGlyphWidth(const tContext *psContext, const tNumFieldFont *psFont,
+                   char cChar)
+{
+    uint32_t ui32Idx;
+
+    ui32Idx = NumFieldGlyphIndex(cChar);
+    if(psFont && (ui32Idx < NUM_NUMFIELD_GLYPHS))
+    {
+        return(psFont->pui8Width[ui32Idx]);
+    }
+
+    return(GrStringWidthGet(psContext, &cChar, 1));
+}
+
+//*****************************************************************************
+//
+// Draws one cell of a field: the character centered in the cell, with the
+// rest of the cell filled with the context background.  Characters that are
+// not in the atlas, or not at the width of the cell, are drawn by grlib.
+//
+//*****************************************************************************
+static void
+NumFieldCellDraw(tNumField *psField, tContext *psContext,
+                 const tNumFieldFont *psFont, uint32_t ui32Cell, char cChar)
+{
+    tRectangle sRect;
+    uint32_t ui32Foreground, ui32Idx;
+    int32_t i32Width, i32Offset;
+
+    i32Width = psField->pui8CellWidth[ui32Cell];
+
+    //
+    // Stream the glyph from the atlas if it was rendered at the width of the
+    // cell and the cell lies within the clipping region.
+    //
+    ui32Idx = NumFieldGlyphIndex(cChar);
+    if(psFont && (ui32Idx < NUM_NUMFIELD_GLYPHS) &&
+       (psFont->pui16Atlas[ui32Idx] != NUMFIELD_NO_GLYPH) &&
+       (psFont->pui8AtlasWidth[ui32Idx] == i32Width) &&
+       (psField->pi16CellX[ui32Cell] >= psContext->sClipRegion.i16XMin) &&
+       ((psField->pi16CellX[ui32Cell] + i32Width - 1) <=
+        psContext->sClipRegion.i16XMax) &&
+       (psField->i16Y >= psContext->sClipRegion.i16YMin) &&
+       ((psField->i16Y + psFont->ui8Height - 1) <=
+        psContext->sClipRegion.i16YMax))
+    {
+        sRect.i16XMin = psField->pi16CellX[ui32Cell];
+        sRect.i16XMax = sRect.i16XMin + i32Width - 1;
+        sRect.i16YMin = psField->i16Y;
+        sRect.i16YMax = sRect.i16YMin + psFont->ui8Height - 1;
+        CompositorRectDraw(&sRect);
+        Kentec320x240x16_SSD2119GlyphDraw(psField->pi16CellX[ui32Cell],
+                                          psField->i16Y, i32Width,
+                                          psFont->ui8Height,
+                                          &g_pui8NumFieldAtlas
+                                          [psFont->pui16Atlas[ui32Idx]],
+                                          psContext->ui32Foreground,
+                                          psContext->ui32Background);
+        return;
+    }
+
+    i32Offset = 0;
+    if(cChar != ' ')
+    {
+        i32Offset = (i32Width - NumFieldGlyphWidth(psContext, psFont,
+                                                   cChar)) / 2;
+        if(i32Offset < 0)
+        {
+            i32Offset = 0;
+        }
+    }
+
+    //
+    // Fill the parts of the cell the glyph does not cover, which for a space
+    // is all of it.
+    //
+    sRect.i16YMin = psField->i16Y;
+    sRect.i16YMax = psField->i16Y + GrFontHeightGet(psField->psFont) - 1;
+    ui32Foreground = psContext->ui32Foreground;
+    psContext->ui32Foreground = psContext->ui32Background;
+    if(cChar == ' ')
+    {
+        sRect.i16XMin = psField->pi16CellX[ui32Cell];
+        sRect.i16XMax = sRect.i16XMin + i32Width - 1;
+        GrRectFill(psContext, &sRect);
+        psContext->ui32Foreground = ui32Foreground;
+        return;
+    }
+    if(i32Offset > 0)
+    {
+        sRect.i16XMin = psField->pi16CellX[ui32Cell];
+        sRect.i16XMax = sRect.i16XMin + i32Offset - 1;
+        GrRectFill(psContext, &sRect);
+    }
+    sRect.i16XMin = psField->pi16CellX[ui32Cell] + i32Offset +
+                    NumFieldGlyphWidth(psContext, psFont, cChar);
+    sRect.i16XMax = psField->pi16CellX[ui32Cell] + i32Width - 1;
+    if(sRect.i16XMin <= sRect.i16XMax)
+    {
+        GrRectFill(psContext, &sRect);
+    }
+    psContext->ui32Foreground = ui32Foreground;
+
+    GrStringDraw(psContext, &cChar, 1, psField->pi16CellX[ui32Cell] + i32Offset,
+                 psField->i16Y, 1);
+}
+
+//*****************************************************************************
+//
+//! Lays out a numeric field.
+//!
+//! \param psField points to the field.
+//! \param psContext is the drawing context used to measure the glyphs.
+//! \param psFont is the font of the field.
+//! \param pcTemplate is the template of the field, one character per cell:
+//! NUMFIELD_DIGIT for a digit cell and any other character for a cell that
+//! always shows that character.  It must stay valid while the field is used.
+//! \param i32X is the left edge of the field, or its right edge if \e bRight
+//! is \b true.
+//! \param i32Y is the top of the field.
+//! \param bRight is \b true to align the field to the right of \e i32X.
+//!
+//! The field is not drawn until the first call to NumFieldDraw().  The font
+//! of the context is left unchanged.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+NumFieldInit(tNumField *psField, tContext *psContext, const tFont *psFont,
+             const char *pcTemplate, int32_t i32X, int32_t i32Y, bool bRight)
+{
+    const tNumFieldFont *psGlyphs;
+    const tFont *psContextFont;
+    uint32_t ui32Cell;
+    int32_t i32Width;
+
+    psContextFont = psContext->psFont;
+    GrContextFontSet(psContext, psFont);
+    psGlyphs = NumFieldFontGet(psContext);
+
+    psField->psFont = psFont;
+    psField->pcTemplate = pcTemplate;
+    psField->i16Y = i32Y;
+    psField->bShown = false;
+
+    i32Width = 0;
+    for(ui32Cell = 0; pcTemplate[ui32Cell] && (ui32Cell < NUMFIELD_MAX_CELLS);
+        ui32Cell++)
+    {
+        if(pcTemplate[ui32Cell] != NUMFIELD_DIGIT)
+        {
+            psField->pui8CellWidth[ui32Cell] =
+                NumFieldGlyphWidth(psContext, psGlyphs, pcTemplate[ui32Cell]);
+        }
+        else if(psGlyphs)
+        {
+            psField->pui8CellWidth[ui32Cell] = psGlyphs->ui8DigitWidth;
+        }
+        else
+        {
+            psField->pui8CellWidth[ui32Cell] =
+                NumFieldGlyphWidth(psContext, 0, '0');
+        }
+        psField->pi16CellX[ui32Cell] = i32Width;
+        i32Width += psField->pui8CellWidth[ui32Cell];
+    }
+    psField->ui8Cells = ui32Cell;
+
+    if(bRight)
+    {
+        i32X -= i32Width;
+    }
+    for(ui32Cell = 0; ui32Cell < psField->ui8Cells; ui32Cell++)
+    {
+        psField->pi16CellX[ui32Cell] += i32X;
+    }
+
+    GrContextFontSet(psContext, psContextFont);
+}
+
+//*****************************************************************************
+//
+//! Draws the value of a numeric field.
+//!
+//! \param psField points to the field.
+//! \param psContext is the drawing context, whose foreground and background
+//! colors are used.
+//! \param pcText is the value, one character per cell.  The characters for
+//! the fixed cells of the template are ignored, cells past the end of the
+//! text are blanked and characters past the last cell are not shown.
+//!
+//! Only the cells whose character differs from the one on the display are
+//! drawn, unless the colors changed or the field was invalidated, in which
+//! case all of them are.  The font of the context is set to the font of the
+//! field.
+//!
+//! \return Returns the number of cells drawn.
+//
+//*****************************************************************************
+uint32_t
+NumFieldDraw(tNumField *psField, tContext *psContext, const char *pcText)
+{
+    const tNumFieldFont *psGlyphs;
+    uint32_t ui32Cell, ui32Drawn;
+    bool bEnd;
+    char cChar;
+
+    GrContextFontSet(psContext, psField->psFont);
+    psGlyphs = NumFieldFontGet(psContext);
+
+    if((psContext->ui32Foreground != psField->ui32Foreground) ||
+       (psContext->ui32Background != psField->ui32Background))
+    {
+        psField->ui32Foreground = psContext->ui32Foreground;
+        psField->ui32Background = psContext->ui32Background;
+        psField->bShown = false;
+    }
+
+    ui32Drawn = 0;
+    bEnd = false;
+    for(ui32Cell = 0; ui32Cell < psField->ui8Cells; ui32Cell++)
+    {
+        if(!bEnd && !pcText[ui32Cell])
+        {
+            bEnd = true;
+        }
+
+        if(psField->pcTemplate[ui32Cell] != NUMFIELD_DIGIT)
+        {
+            cChar = psField->pcTemplate[ui32Cell];
+        }
+        else
+        {
+            cChar = bEnd ? ' ' : pcText[ui32Cell];
+        }
+
+        if(psField->bShown && (psField->pcShown[ui32Cell] == cChar))
+        {
+            continue;
+        }
+
+        NumFieldCellDraw(psField, psContext, psGlyphs, ui32Cell, cChar);
+        psField->pcShown[ui32Cell] = cChar;
+        ui32Drawn++;
+    }
+    psField->bShown = true;
+
+    return(ui32Drawn);
+}
+
+//*****************************************************************************
+//
+//! Marks a numeric field as no longer on the display.
+//!
+//! \param psField points to the field.
+//!
+//! This function must be called when the background under the field has
+//! been painted over, so that the next call to NumFieldDraw() draws the whole
+//! field.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+NumFieldInvalidate(tNumField *psField)
+{
+    psField->bShown = false;
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
@@ -0,0 +1,101 @@
+//*****************************************************************************
+//
+// numfield.h - Prototypes for the fixed layout numeric field widget.
+//
+//*****************************************************************************
+
+#ifndef __NUMFIELD_H__
+#define __NUMFIELD_H__
+
+//*****************************************************************************
+//
+// The characters a numeric field lays out from cached widths.  Other
+// characters are measured when they are drawn.
+//
+//*****************************************************************************
+#define NUMFIELD_GLYPHS         "0123456789.-edB "
+#define NUM_NUMFIELD_GLYPHS     (sizeof(NUMFIELD_GLYPHS) - 1)
+
+//*****************************************************************************
+//
+// The character that marks a digit cell in a field template.  A digit cell
+// holds a digit, a space or a minus sign; any other template character is a
+// fixed cell that always shows that character.
+//
+//*****************************************************************************
+#define NUMFIELD_DIGIT          '#'
+
+//*****************************************************************************
+//
+// The most cells in a field, and the most fonts whose glyph widths are
+// cached.
+//
+//*****************************************************************************
+#define NUMFIELD_MAX_CELLS      12
+#define NUMFIELD_MAX_FONTS      4
+
+//*****************************************************************************
+//
+// The size, in bytes, of the glyph atlas that holds the 1 BPP renderings of
+// NUMFIELD_GLYPHS in each font.  The three value fonts take about 1.6 KB;
+// glyphs that do not fit are drawn by grlib instead.
+//
+//*****************************************************************************
+#define NUMFIELD_ATLAS_SIZE     2048
+
+//*****************************************************************************
+//
+//! A numeric field: a value drawn into a row of cells that do not move when
+//! the value changes, so that only the cells whose character changed have to
+//! be redrawn.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The font of the field.
+    //
+    const tFont *psFont;
+
+    //
+    //! The template the field was laid out from, with NUMFIELD_DIGIT for
+    //! each digit cell.
+    //
+    const char *pcTemplate;
+
+    //
+    //! The number of cells.
+    //
+    uint8_t ui8Cells;
+
+    //
+    //! The top of the field and the left edge and width of each cell.
+    //
+    int16_t i16Y;
+    int16_t pi16CellX[NUMFIELD_MAX_CELLS];
+    uint8_t pui8CellWidth[NUMFIELD_MAX_CELLS];
+
+    //
+    //! The characters on the display, the colors they were drawn with, and
+    //! whether they are still there.
+    //
+    char pcShown[NUMFIELD_MAX_CELLS];
+    uint32_t ui32Foreground;
+    uint32_t ui32Background;
+    bool bShown;
+}
+tNumField;
+
+//*****************************************************************************
+//
+// Prototypes for the functions exported by the numeric field widget.
+//
+//*****************************************************************************
+extern void NumFieldInit(tNumField *psField, tContext *psContext,
+                         const tFont *psFont, const char *pcTemplate,
+                         int32_t i32X, int32_t i32Y, bool bRight);
+extern uint32_t NumFieldDraw(tNumField *psField, tContext *psContext,
+                             const char *pcText);
+extern void NumFieldInvalidate(tNumField *psField);
+
+#endif // __NUMFIELD_H__
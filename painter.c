@@ -0,0 +1,264 @@
+//*****************************************************************************
+//
+// painter.c - Deferred paint job executor.
+//
+// All drawing on the display is done by paint jobs that run from the PendSV
+// exception at the lowest interrupt priority.  The interrupt handlers preempt
+// a paint job, so a long repaint does not hold off the SPI link or the touch
+// screen, while the paint jobs in turn preempt the tasks of the main loop.
+// Since the paint jobs run one after the other and never preempt each other,
+// the display and the widget tree are only ever accessed from one context.
+// Code outside the paint jobs that changes what they draw brackets the change
+// with PainterLock() and PainterUnlock().
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup painter_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_types.h"
+#include "inc/hw_ints.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "scheduler.h"
+#include "painter.h"
+
+//*****************************************************************************
+//
+// The paint job table, as passed to PainterInit().
+//
+//*****************************************************************************
+static tSchedTask *g_psPaintJobs;
+static uint32_t g_ui32PaintNumJobs;
+
+//*****************************************************************************
+//
+// The priority of the PendSV exception, which PainterLock() masks.
+//
+//*****************************************************************************
+static uint8_t g_ui8PaintPriority;
+
+//*****************************************************************************
+//
+// Returns the pending paint job with the lowest priority number, or 0 if no
+// job is pending.
+//
+//*****************************************************************************
+static tSchedTask *
+PainterReadyGet(void)
+{
+    tSchedTask *psJob, *psBest;
+    uint32_t ui32Idx;
+
+    psBest = 0;
+
+    for(ui32Idx = 0; ui32Idx < g_ui32PaintNumJobs; ui32Idx++)
+    {
+        psJob = &g_psPaintJobs[ui32Idx];
+        if(psJob->ui8Pending &&
+           ((psBest == 0) || (psJob->ui8Priority < psBest->ui8Priority)))
+        {
+            psBest = psJob;
+        }
+    }
+
+    return(psBest);
+}
+
+//*****************************************************************************
+//
+//! Initializes the paint job executor.
+//!
+//! \param psJobs points to the paint job table.
+//! \param ui32NumJobs is the number of jobs in the table.
+//! \param ui8Priority is the interrupt priority of PendSV, which should be
+//! lower than that of every interrupt.
+//!
+//! The scheduler must have been initialized first, since the execution time
+//! accounting uses the cycle counter that it enables.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PainterInit(tSchedTask *psJobs, uint32_t ui32NumJobs, uint8_t ui8Priority)
+{
+    uint32_t ui32Idx, ui32CyclesPerUs;
+
+    g_psPaintJobs = psJobs;
+    g_ui32PaintNumJobs = ui32NumJobs;
+    g_ui8PaintPriority = ui8Priority;
+
+    ui32CyclesPerUs = SysCtlClockGet() / 1000000;
+
+    for(ui32Idx = 0; ui32Idx < ui32NumJobs; ui32Idx++)
+    {
+        psJobs[ui32Idx].ui32BudgetCycles = (psJobs[ui32Idx].ui32BudgetUs *
+                                            ui32CyclesPerUs);
+    }
+
+    PainterStatsReset();
+
+    IntPrioritySet(FAULT_PENDSV, ui8Priority);
+}
+
+//*****************************************************************************
+//
+//! Makes a paint job ready to run.
+//!
+//! \param ui32Job is the index of the job in the paint job table.
+//!
+//! This function may be called from any context.  The job runs as soon as no
+//! interrupt handler is active and the paint jobs are not locked; when posted
+//! from a task of the main loop, that is before this function returns.
+//! Posting a job that is already pending has no further effect.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PainterJobPost(uint32_t ui32Job)
+{
+    if(ui32Job < g_ui32PaintNumJobs)
+    {
+        g_psPaintJobs[ui32Job].ui8Pending = 1;
+        IntPendSet(FAULT_PENDSV);
+    }
+}
+
+//*****************************************************************************
+//
+//! Keeps the paint jobs from running.
+//!
+//! This function raises the interrupt priority mask (BASEPRI) to the priority
+//! of PendSV, so that the code that follows can change the widget tree or the
+//! data the paint jobs draw without being preempted by them.  Interrupts of a
+//! more urgent priority are still taken.  The locked section should be short.
+//!
+//! \return Returns the previous priority mask, to be passed to
+//! PainterUnlock().
+//
+//*****************************************************************************
+uint32_t
+PainterLock(void)
+{
+    uint32_t ui32Was;
+
+    ui32Was = IntPriorityMaskGet();
+
+    //
+    // Do not lower a priority mask that is already tighter.
+    //
+    if((ui32Was == 0) || (ui32Was > g_ui8PaintPriority))
+    {
+        IntPriorityMaskSet(g_ui8PaintPriority);
+    }
+
+    return(ui32Was);
+}
+
+//*****************************************************************************
+//
+//! Lets the paint jobs run again.
+//!
+//! \param ui32Was is the priority mask returned by PainterLock().
+//!
+//! Paint jobs posted while the lock was held run when this function restores
+//! the priority mask.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PainterUnlock(uint32_t ui32Was)
+{
+    IntPriorityMaskSet(ui32Was);
+}
+
+//*****************************************************************************
+//
+//! Runs the pending paint jobs.
+//!
+//! This function is the PendSV exception handler.  It runs the pending job
+//! with the lowest priority number to completion, accounting for the cycles
+//! it takes, until no job is left pending; a job posted by another job or by
+//! an interrupt handler meanwhile is run in the same exception.  The time
+//! taken is excluded from that of the scheduler task that was preempted.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PendSVIntHandler(void)
+{
+    tSchedTask *psJob;
+    uint32_t ui32Start, ui32Cycles, ui32Entry;
+
+    ui32Entry = SchedulerCyclesGet();
+
+    while((psJob = PainterReadyGet()) != 0)
+    {
+        //
+        // Clear the pending flag before running the job so that a post made
+        // while it runs makes it run again.
+        //
+        psJob->ui8Pending = 0;
+
+        ui32Start = SchedulerCyclesGet();
+        psJob->pfnTask();
+        ui32Cycles = SchedulerCyclesGet() - ui32Start;
+
+        psJob->ui32Runs++;
+        psJob->ui32CyclesLast = ui32Cycles;
+        psJob->ui64CyclesTotal += ui32Cycles;
+        if(ui32Cycles > psJob->ui32CyclesMax)
+        {
+            psJob->ui32CyclesMax = ui32Cycles;
+        }
+        if(psJob->ui32BudgetCycles && (ui32Cycles > psJob->ui32BudgetCycles))
+        {
+            psJob->ui32Overruns++;
+        }
+    }
+
+    //
+    // The jobs are accounted here, so they are not charged to the task of the
+    // main loop that they preempted.
+    //
+    SchedulerCyclesExclude(SchedulerCyclesGet() - ui32Entry);
+}
+
+//*****************************************************************************
+//
+//! Resets the execution time statistics of all paint jobs.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PainterStatsReset(void)
+{
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < g_ui32PaintNumJobs; ui32Idx++)
+    {
+        g_psPaintJobs[ui32Idx].ui32Runs = 0;
+        g_psPaintJobs[ui32Idx].ui32Overruns = 0;
+        g_psPaintJobs[ui32Idx].ui32CyclesLast = 0;
+        g_psPaintJobs[ui32Idx].ui32CyclesMax = 0;
+        g_psPaintJobs[ui32Idx].ui64CyclesTotal = 0;
+    }
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
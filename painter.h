@@ -0,0 +1,25 @@
+//*****************************************************************************
+//
+// painter.h - Prototypes for the deferred paint job executor.
+//
+//*****************************************************************************
+
+#ifndef __PAINTER_H__
+#define __PAINTER_H__
+
+//*****************************************************************************
+//
+// Prototypes for the functions exported by the paint job executor.  The paint
+// jobs are described by scheduler task entries, built with SchedTaskStruct()
+// and a period of 0; the priority orders the jobs among themselves.
+//
+//*****************************************************************************
+extern void PainterInit(tSchedTask *psJobs, uint32_t ui32NumJobs,
+                        uint8_t ui8Priority);
+extern void PainterJobPost(uint32_t ui32Job);
+extern uint32_t PainterLock(void);
+extern void PainterUnlock(uint32_t ui32Was);
+extern void PainterStatsReset(void);
+extern void PendSVIntHandler(void);
+
+#endif // __PAINTER_H__
@@ -0,0 +1,83 @@
+//*****************************************************************************
+//
+// panelcache.c - Cache of static panel layers.
+//
+// The background of a panel and the drawing on it that never changes, such
+// as the arrows of the block diagram, used to be drawn with a fill and a
+// line per segment every time the panel was shown.  That static layer is
+// drawn by PanelStaticPaint() in the firmware, and baked at build time: the
+// host simulator runs PanelStaticPaint() for each panel and writes the
+// pixels, run-length encoded, to panelcache_data.c ("make -C sim bake", which
+// "make -C sim test" checks is up to date).  Showing a panel then streams its
+// layer into one display window.
+//
+// Static layers hold no text, since the simulator draws text with stand-in
+// fonts, and a panel of labels would take far more flash than its few
+// string draws take time.  The labels and the dynamic content are drawn over
+// the layer as before.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup panelcache_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "grlib/grlib.h"
+#include "Kentec320x240x16_ssd2119_8bit.h"
+#include "compositor.h"
+#include "panelcache.h"
+
+//*****************************************************************************
+//
+//! Draws the cached static layer of a panel.
+//!
+//! \param ui32Panel is the panel index.
+//!
+//! The layer is drawn directly on the display, in one window.  It covers
+//! whatever the compositor holds back beneath it, such as the fills of the
+//! panel canvases.
+//!
+//! \return Returns \b true if the layer was drawn, or \b false if the panel
+//! is not in the cache and its static layer must be painted.
+//
+//*****************************************************************************
+bool
+PanelCacheDraw(uint32_t ui32Panel)
+{
+    const tPanelCache *psCache;
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < g_ui32PanelCacheCount; ui32Idx++)
+    {
+        psCache = &g_psPanelCache[ui32Idx];
+        if(psCache->ui8Panel != ui32Panel)
+        {
+            continue;
+        }
+
+        CompositorRectDraw(&psCache->sRect);
+        Kentec320x240x16_SSD2119RunsDraw(psCache->sRect.i16XMin,
+                                         psCache->sRect.i16YMin,
+                                         psCache->sRect.i16XMax -
+                                         psCache->sRect.i16XMin + 1,
+                                         psCache->sRect.i16YMax -
+                                         psCache->sRect.i16YMin + 1,
+                                         psCache->pui16Runs,
+                                         psCache->ui32Runs);
+        return(true);
+    }
+
+    return(false);
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
@@ -0,0 +1,55 @@
+//*****************************************************************************
+//
+// panelcache.h - Prototypes for the cache of static panel layers.
+//
+//*****************************************************************************
+
+#ifndef __PANELCACHE_H__
+#define __PANELCACHE_H__
+
+//*****************************************************************************
+//
+//! The static layer of a panel, as baked into panelcache_data.c.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The panel index.
+    //
+    uint8_t ui8Panel;
+
+    //
+    //! The rectangle the layer covers.
+    //
+    tRectangle sRect;
+
+    //
+    //! The pixels of the rectangle, as pairs of a pixel count and an SSD2119
+    //! color (see Kentec320x240x16_SSD2119RunsDraw()), and the number of
+    //! pairs.
+    //
+    const uint16_t *pui16Runs;
+    uint32_t ui32Runs;
+}
+tPanelCache;
+
+//*****************************************************************************
+//
+// The baked static layers, generated by "make -C sim bake".
+//
+//*****************************************************************************
+extern const tPanelCache g_psPanelCache[];
+extern const uint32_t g_ui32PanelCacheCount;
+
+//*****************************************************************************
+//
+// Prototypes for the functions exported by the panel cache.  The firmware
+// provides PanelStaticPaint(), which draws the static layers that are baked.
+//
+//*****************************************************************************
+extern bool PanelCacheDraw(uint32_t ui32Panel);
+extern bool PanelStaticPaint(uint32_t ui32Panel, tContext *pContext,
+                             tRectangle *psRect);
+
+#endif // __PANELCACHE_H__
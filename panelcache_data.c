@@ -0,0 +1,104 @@
+//*****************************************************************************
+//
+// panelcache_data.c - The baked static layers of the panels.
+//
+// Generated from PanelStaticPaint() by "make -C sim bake"; do not edit.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "grlib/grlib.h"
+#include "panelcache.h"
+
+static const uint16_t g_pui16PanelCache1[] =
+{
+   12245, 0xffbd,     1, 0xa145,    74, 0xffbd,     1, 0xa145,
+      74, 0xffbd,     1, 0xa145,   170, 0xffbd,     2, 0xa145,
+      73, 0xffbd,     2, 0xa145,    73, 0xffbd,     2, 0xa145,
+     170, 0xffbd,     2, 0xa145,    73, 0xffbd,     2, 0xa145,
+      73, 0xffbd,     2, 0xa145,   170, 0xffbd,     2, 0xa145,
+      73, 0xffbd,     2, 0xa145,    73, 0xffbd,     2, 0xa145,
+     170, 0xffbd,     2, 0xa145,    73, 0xffbd,     2, 0xa145,
+      73, 0xffbd,     2, 0xa145,   141, 0xffbd,    31, 0xa145,
+      44, 0xffbd,    31, 0xa145,    44, 0xffbd,    31, 0xa145,
+     166, 0xffbd,     2, 0xa145,    73, 0xffbd,     2, 0xa145,
+      73, 0xffbd,     2, 0xa145,   166, 0xffbd,     2, 0xa145,
+      73, 0xffbd,     2, 0xa145,    73, 0xffbd,     2, 0xa145,
+     166, 0xffbd,     2, 0xa145,    73, 0xffbd,     2, 0xa145,
+      73, 0xffbd,     2, 0xa145,   166, 0xffbd,     2, 0xa145,
+      73, 0xffbd,     2, 0xa145,    73, 0xffbd,     2, 0xa145,
+     167, 0xffbd,     1, 0xa145,    74, 0xffbd,     1, 0xa145,
+      74, 0xffbd,     1, 0xa145,  5791, 0xffbd,     1, 0xa145,
+     319, 0xffbd,     1, 0xa145,   319, 0xffbd,     1, 0xa145,
+     319, 0xffbd,     1, 0xa145,   319, 0xffbd,     1, 0xa145,
+     319, 0xffbd,     1, 0xa145,   319, 0xffbd,     1, 0xa145,
+     319, 0xffbd,     1, 0xa145,   319, 0xffbd,     1, 0xa145,
+     319, 0xffbd,     1, 0xa145,   319, 0xffbd,     1, 0xa145,
+     319, 0xffbd,     1, 0xa145,   319, 0xffbd,     1, 0xa145,
+     319, 0xffbd,     1, 0xa145,   319, 0xffbd,     1, 0xa145,
+     319, 0xffbd,     1, 0xa145,   319, 0xffbd,     1, 0xa145,
+     319, 0xffbd,     1, 0xa145,   319, 0xffbd,     1, 0xa145,
+     319, 0xffbd,     1, 0xa145,   314, 0xffbd,     1, 0xa145,
+       4, 0xffbd,     1, 0xa145,     4, 0xffbd,     1, 0xa145,
+     310, 0xffbd,     1, 0xa145,     3, 0xffbd,     1, 0xa145,
+       3, 0xffbd,     1, 0xa145,   311, 0xffbd,     1, 0xa145,
+       3, 0xffbd,     1, 0xa145,     3, 0xffbd,     1, 0xa145,
+     312, 0xffbd,     1, 0xa145,     2, 0xffbd,     1, 0xa145,
+       2, 0xffbd,     1, 0xa145,   313, 0xffbd,     1, 0xa145,
+       2, 0xffbd,     1, 0xa145,     2, 0xffbd,     1, 0xa145,
+     314, 0xffbd,     1, 0xa145,     1, 0xffbd,     1, 0xa145,
+       1, 0xffbd,     1, 0xa145,   315, 0xffbd,     1, 0xa145,
+       1, 0xffbd,     1, 0xa145,     1, 0xffbd,     1, 0xa145,
+     316, 0xffbd,     3, 0xa145,   317, 0xffbd,     3, 0xa145,
+     318, 0xffbd,     1, 0xa145,   319, 0xffbd,     1, 0xa145,
+    5246, 0xffbd,     2, 0xa145,    73, 0xffbd,     2, 0xa145,
+      73, 0xffbd,     2, 0xa145,   166, 0xffbd,     2, 0xa145,
+      73, 0xffbd,     2, 0xa145,    73, 0xffbd,     2, 0xa145,
+     166, 0xffbd,     2, 0xa145,    73, 0xffbd,     2, 0xa145,
+      73, 0xffbd,     2, 0xa145,   166, 0xffbd,     2, 0xa145,
+      73, 0xffbd,     2, 0xa145,    73, 0xffbd,     2, 0xa145,
+     166, 0xffbd,     2, 0xa145,    73, 0xffbd,     2, 0xa145,
+      73, 0xffbd,     2, 0xa145,   167, 0xffbd,    31, 0xa145,
+      44, 0xffbd,    31, 0xa145,    44, 0xffbd,    31, 0xa145,
+     140, 0xffbd,     2, 0xa145,    73, 0xffbd,     2, 0xa145,
+      73, 0xffbd,     2, 0xa145,   170, 0xffbd,     2, 0xa145,
+      73, 0xffbd,     2, 0xa145,    73, 0xffbd,     2, 0xa145,
+     170, 0xffbd,     2, 0xa145,    73, 0xffbd,     2, 0xa145,
+      73, 0xffbd,     2, 0xa145,   170, 0xffbd,     2, 0xa145,
+      73, 0xffbd,     2, 0xa145,    73, 0xffbd,     2, 0xa145,
+     170, 0xffbd,     2, 0xa145,    73, 0xffbd,     2, 0xa145,
+      73, 0xffbd,     2, 0xa145, 13534, 0xffbd,
+};
+
+static const uint16_t g_pui16PanelCache4[] =
+{
+   17600, 0x07e0, 35520, 0x0000,
+};
+
+static const uint16_t g_pui16PanelCache5[] =
+{
+   17600, 0x07e0, 35520, 0x0000,
+};
+
+static const uint16_t g_pui16PanelCache6[] =
+{
+   17600, 0x07e0, 35520, 0x0000,
+};
+
+static const uint16_t g_pui16PanelCache7[] =
+{
+   17600, 0x07e0, 35520, 0x0000,
+};
+
+const tPanelCache g_psPanelCache[] =
+{
+    { 1, { 0, 24, 319, 189 }, g_pui16PanelCache1, 223 },
+    { 4, { 0, 24, 319, 189 }, g_pui16PanelCache4, 2 },
+    { 5, { 0, 24, 319, 189 }, g_pui16PanelCache5, 2 },
+    { 6, { 0, 24, 319, 189 }, g_pui16PanelCache6, 2 },
+    { 7, { 0, 24, 319, 189 }, g_pui16PanelCache7, 2 },
+};
+
+const uint32_t g_ui32PanelCacheCount =
+    sizeof(g_psPanelCache) / sizeof(g_psPanelCache[0]);
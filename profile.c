@@ -0,0 +1,368 @@
+//*****************************************************************************
+//
+// profile.c - Cycle count profiler.
+//
+// Named code zones are timed with the DWT cycle counter, which the scheduler
+// enables.  For each zone the profiler keeps the number of passes and the
+// shortest, average and longest pass in cycles.  The CPU load is derived from
+// the time the scheduler spends in its idle hook.  All storage is static.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup profile_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_types.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "utils/ustdlib.h"
+#include "defines.h"
+#include "scheduler.h"
+#include "serial.h"
+#include "profile.h"
+
+#ifdef PROFILE_ENABLE
+
+//*****************************************************************************
+//
+// The names of the zones, in PROFILE_* order.
+//
+//*****************************************************************************
+static const char * const g_ppcProfileNames[NUM_PROFILE_ZONES] =
+{
+    "ssi", "acquire", "convert", "stats", "render", "scope", "text", "widget"
+};
+
+//*****************************************************************************
+//
+// The zone statistics.
+//
+//*****************************************************************************
+static tProfileZone g_psProfileZones[NUM_PROFILE_ZONES];
+
+//*****************************************************************************
+//
+// Whether the zones are being timed.
+//
+//*****************************************************************************
+static volatile bool g_bProfileEnabled;
+
+//*****************************************************************************
+//
+// The CPU load in tenths of a percent, and the scheduler time and idle cycles
+// at which it was last updated.
+//
+//*****************************************************************************
+static uint32_t g_ui32ProfileLoad;
+static uint32_t g_ui32ProfileLoadMs;
+static uint64_t g_ui64ProfileIdle;
+
+//*****************************************************************************
+//
+// Resets the statistics of one zone.
+//
+//*****************************************************************************
+static void
+ProfileZoneReset(tProfileZone *psZone)
+{
+    psZone->ui32Count = 0;
+    psZone->ui32Min = 0xffffffff;
+    psZone->ui32Max = 0;
+    psZone->ui64Total = 0;
+}
+
+//*****************************************************************************
+//
+//! Initializes the profiler.
+//!
+//! This function must be called after SchedulerInit(), which enables the
+//! cycle counter.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+ProfileInit(void)
+{
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < NUM_PROFILE_ZONES; ui32Idx++)
+    {
+        g_psProfileZones[ui32Idx].pcName = g_ppcProfileNames[ui32Idx];
+        g_psProfileZones[ui32Idx].ui32Last = 0;
+        ProfileZoneReset(&g_psProfileZones[ui32Idx]);
+    }
+
+    g_ui32ProfileLoad = 0;
+    g_ui32ProfileLoadMs = SchedulerTimeGet();
+    g_ui64ProfileIdle = SchedulerIdleCyclesGet();
+    g_bProfileEnabled = true;
+}
+
+//*****************************************************************************
+//
+//! Starts or stops the timing of the zones.
+//!
+//! \param bEnable is \b true to time the zones.
+//!
+//! The zone statistics are reset when timing is started.  The CPU load is
+//! measured either way, since it costs nothing in the zones.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+ProfileEnable(bool bEnable)
+{
+    uint32_t ui32Idx;
+    bool bMasked;
+
+    bMasked = IntMasterDisable();
+    if(bEnable && !g_bProfileEnabled)
+    {
+        //
+        // A zone that is open now is timed from here, not from an entry
+        // that was never recorded.
+        //
+        for(ui32Idx = 0; ui32Idx < NUM_PROFILE_ZONES; ui32Idx++)
+        {
+            ProfileZoneReset(&g_psProfileZones[ui32Idx]);
+            g_psProfileZones[ui32Idx].ui32Start = SchedulerCyclesGet();
+        }
+    }
+    g_bProfileEnabled = bEnable;
+    if(!bMasked)
+    {
+        IntMasterEnable();
+    }
+}
+
+//*****************************************************************************
+//
+//! Returns \b true if the zones are being timed.
+//
+//*****************************************************************************
+bool
+ProfileIsEnabled(void)
+{
+    return(g_bProfileEnabled);
+}
+
+//*****************************************************************************
+//
+//! Marks the entry into a zone.
+//!
+//! \param ui32Zone is the zone, one of the PROFILE_* values.
+//!
+//! This function is normally called through the PROFILE_ENTER() macro.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+ProfileZoneEnter(uint32_t ui32Zone)
+{
+    if(!g_bProfileEnabled)
+    {
+        return;
+    }
+
+    g_psProfileZones[ui32Zone].ui32Start = SchedulerCyclesGet();
+}
+
+//*****************************************************************************
+//
+//! Marks the exit from a zone and updates its statistics.
+//!
+//! \param ui32Zone is the zone, one of the PROFILE_* values.
+//!
+//! This function is normally called through the PROFILE_EXIT() macro.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+ProfileZoneExit(uint32_t ui32Zone)
+{
+    tProfileZone *psZone;
+    uint32_t ui32Cycles;
+
+    if(!g_bProfileEnabled)
+    {
+        return;
+    }
+
+    psZone = &g_psProfileZones[ui32Zone];
+    ui32Cycles = SchedulerCyclesGet() - psZone->ui32Start;
+
+    psZone->ui32Last = ui32Cycles;
+    psZone->ui32Count++;
+    psZone->ui64Total += ui32Cycles;
+    if(ui32Cycles < psZone->ui32Min)
+    {
+        psZone->ui32Min = ui32Cycles;
+    }
+    if(ui32Cycles > psZone->ui32Max)
+    {
+        psZone->ui32Max = ui32Cycles;
+    }
+}
+
+//*****************************************************************************
+//
+//! Gets a consistent copy of the statistics of a zone.
+//!
+//! \param ui32Zone is the zone, one of the PROFILE_* values.
+//! \param psZone points to storage for the statistics.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+ProfileZoneGet(uint32_t ui32Zone, tProfileZone *psZone)
+{
+    bool bMasked;
+
+    bMasked = IntMasterDisable();
+    *psZone = g_psProfileZones[ui32Zone];
+    if(!bMasked)
+    {
+        IntMasterEnable();
+    }
+}
+
+//*****************************************************************************
+//
+//! Updates the CPU load.
+//!
+//! This function is called periodically, typically once a second.  The load
+//! is the share of the time since the previous call that the scheduler did
+//! not spend in its idle hook.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+ProfileLoadUpdate(void)
+{
+    uint32_t ui32Now;
+    uint64_t ui64Idle, ui64Elapsed;
+
+    ui32Now = SchedulerTimeGet();
+    ui64Idle = SchedulerIdleCyclesGet();
+
+    ui64Elapsed = ((uint64_t)(ui32Now - g_ui32ProfileLoadMs) *
+                   (SysCtlClockGet() / 1000));
+    if(ui64Elapsed == 0)
+    {
+        return;
+    }
+
+    ui64Idle -= g_ui64ProfileIdle;
+    if(ui64Idle > ui64Elapsed)
+    {
+        ui64Idle = ui64Elapsed;
+    }
+    g_ui32ProfileLoad = 1000 - (uint32_t)((ui64Idle * 1000) / ui64Elapsed);
+
+    g_ui32ProfileLoadMs = ui32Now;
+    g_ui64ProfileIdle = SchedulerIdleCyclesGet();
+}
+
+//*****************************************************************************
+//
+//! Gets the CPU load.
+//!
+//! \return Returns the CPU load, as of the last call to ProfileLoadUpdate(),
+//! in tenths of a percent.
+//
+//*****************************************************************************
+uint32_t
+ProfileLoadGet(void)
+{
+    return(g_ui32ProfileLoad);
+}
+
+//*****************************************************************************
+//
+//! Prints the zone statistics and the CPU load on the console.
+//!
+//! The zone statistics are reset once they have been printed, so each report
+//! covers the time since the previous one.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+ProfileReport(void)
+{
+    tProfileZone sZone;
+    uint32_t ui32Idx;
+    bool bMasked;
+
+    SerialPrintf("Zone        count   min(cyc)   avg(cyc)   max(cyc)\n");
+    for(ui32Idx = 0; ui32Idx < NUM_PROFILE_ZONES; ui32Idx++)
+    {
+        bMasked = IntMasterDisable();
+        sZone = g_psProfileZones[ui32Idx];
+        ProfileZoneReset(&g_psProfileZones[ui32Idx]);
+        if(!bMasked)
+        {
+            IntMasterEnable();
+        }
+
+        if(sZone.ui32Count == 0)
+        {
+            SerialPrintf("%8s %8d          -          -          -\n",
+                         sZone.pcName, 0);
+            continue;
+        }
+
+        SerialPrintf("%8s %8d %10d %10d %10d\n", sZone.pcName, sZone.ui32Count,
+                     sZone.ui32Min,
+                     (uint32_t)(sZone.ui64Total / sZone.ui32Count),
+                     sZone.ui32Max);
+    }
+    SerialPrintf("CPU load %d.%d%%\n", g_ui32ProfileLoad / 10,
+                 g_ui32ProfileLoad % 10);
+}
+
+//*****************************************************************************
+//
+//! Formats the on-screen profile overlay.
+//!
+//! \param pcBuf points to storage for the overlay text.
+//! \param ui32Size is the size of the storage in bytes.
+//!
+//! The overlay shows the CPU load and the time taken to paint the last frame.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+ProfileOverlayGet(char *pcBuf, uint32_t ui32Size)
+{
+    uint32_t ui32Us;
+
+    ui32Us = (g_psProfileZones[PROFILE_RENDER].ui32Last /
+              (SysCtlClockGet() / 1000000));
+
+    usnprintf(pcBuf, ui32Size, "CPU %2d.%d%%  paint %3d.%dms ",
+              g_ui32ProfileLoad / 10, g_ui32ProfileLoad % 10,
+              ui32Us / 1000, (ui32Us % 1000) / 100);
+}
+
+#endif // PROFILE_ENABLE
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
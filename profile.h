@@ -0,0 +1,102 @@
+//*****************************************************************************
+//
+// profile.h - Prototypes and macros for the cycle count profiler.
+//
+// The profiler is enabled by defining PROFILE_ENABLE (see defines.h).  When it
+// is not defined the PROFILE_* macros expand to nothing and profile.c compiles
+// to an empty object, so instrumented code carries no cost.
+//
+//*****************************************************************************
+
+#ifndef __PROFILE_H__
+#define __PROFILE_H__
+
+//*****************************************************************************
+//
+// The profiling zones.  A zone covers the code between PROFILE_ENTER() and
+// PROFILE_EXIT() and includes the time of any interrupt that preempts it.  A
+// zone must not be entered again before it has been exited.
+//
+//*****************************************************************************
+#define PROFILE_SSI             0           // SSI1IntHandler
+#define PROFILE_ACQUIRE         1           // AcquireIntHandler
+#define PROFILE_CONVERT         2           // Metric conversion
+#define PROFILE_STATS           3           // Frame statistics and formatting
+#define PROFILE_RENDER          4           // Painting of the current panel
+#define PROFILE_SCOPE           5           // UpdateScope
+#define PROFILE_TEXT            6           // Text of the data panel
+#define PROFILE_WIDGET          7           // Widget message queue
+#define NUM_PROFILE_ZONES       8
+
+//*****************************************************************************
+//
+// The interval, in milliseconds, of the profile report on the console.
+//
+//*****************************************************************************
+#define PROFILE_REPORT_MS       10000
+
+#ifdef PROFILE_ENABLE
+
+//*****************************************************************************
+//
+//! The statistics of one profiling zone.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The name of the zone, used in reports.
+    //
+    const char *pcName;
+
+    //
+    //! The cycle counter at the last entry into the zone.
+    //
+    uint32_t ui32Start;
+
+    //
+    //! The number of times the zone was exited since the last reset.
+    //
+    uint32_t ui32Count;
+
+    //
+    //! The cycles taken by the last, the shortest and the longest pass.
+    //
+    uint32_t ui32Last;
+    uint32_t ui32Min;
+    uint32_t ui32Max;
+
+    //
+    //! The cycles taken by all passes since the last reset.
+    //
+    uint64_t ui64Total;
+}
+tProfileZone;
+
+//*****************************************************************************
+//
+// Prototypes for the functions exported by the profiler.
+//
+//*****************************************************************************
+extern void ProfileInit(void);
+extern void ProfileEnable(bool bEnable);
+extern bool ProfileIsEnabled(void);
+extern void ProfileZoneEnter(uint32_t ui32Zone);
+extern void ProfileZoneExit(uint32_t ui32Zone);
+extern void ProfileZoneGet(uint32_t ui32Zone, tProfileZone *psZone);
+extern void ProfileLoadUpdate(void);
+extern uint32_t ProfileLoadGet(void);
+extern void ProfileReport(void);
+extern void ProfileOverlayGet(char *pcBuf, uint32_t ui32Size);
+
+#define PROFILE_ENTER(ui32Zone) ProfileZoneEnter(ui32Zone)
+#define PROFILE_EXIT(ui32Zone)  ProfileZoneExit(ui32Zone)
+
+#else
+
+#define PROFILE_ENTER(ui32Zone)
+#define PROFILE_EXIT(ui32Zone)
+
+#endif // PROFILE_ENABLE
+
+#endif // __PROFILE_H__
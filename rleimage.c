@@ -0,0 +1,254 @@
+//*****************************************************************************
+//
+// rleimage.c - Decoder for the run-length encoded image format.
+//
+// The full-screen backgrounds are photos of about 69 KB each as TivaWare 8 BPP
+// images, too many of them to fit in flash together.  tools/assets.py run-
+// length encodes them, merging runs of nearly equal pixels, to a fraction of
+// that (see rleimage.h for the format).  The decoder streams the pixels
+// straight into one display window as it reads the tokens, with each run
+// written as one constant color burst, so that it also draws the image with
+// fewer bus writes than GrImageDraw(), which sets up a window per row.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup rleimage_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "grlib/grlib.h"
+#include "Kentec320x240x16_ssd2119_8bit.h"
+#include "compositor.h"
+#include "rleimage.h"
+
+//*****************************************************************************
+//
+// The palette of the image being drawn, copied out of the image so that a
+// pixel takes a single lookup.
+//
+//*****************************************************************************
+static uint16_t g_pui16RLEImagePalette[256];
+
+//*****************************************************************************
+//
+//! Draws a run-length encoded image.
+//!
+//! \param pContext is a pointer to the drawing context to use.
+//! \param pui8Image is a pointer to the image, in the RLE_IMAGE_FMT_8BPP
+//! format.
+//! \param i32X is the X coordinate of the upper left corner of the image.
+//! \param i32Y is the Y coordinate of the upper left corner of the image.
+//!
+//! The image is clipped to the clipping region of the context and drawn
+//! directly on the display, in one window, over whatever the compositor holds
+//! back beneath it.  Like GrImageDraw(), the foreground and background colors
+//! of the context are not used.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+RLEImageDraw(const tContext *pContext, const uint8_t *pui8Image,
+             int32_t i32X, int32_t i32Y)
+{
+    RLEImageRowsDraw(pContext, pui8Image, i32X, i32Y, 0);
+}
+
+//*****************************************************************************
+//
+//! Draws the rows of a run-length encoded image that follow a cursor.
+//!
+//! \param pContext is a pointer to the drawing context to use.
+//! \param pui8Image is a pointer to the image, in the RLE_IMAGE_FMT_8BPP
+//! format.
+//! \param i32X is the X coordinate of the upper left corner of the image.
+//! \param i32Y is the Y coordinate of the upper left corner of the image.
+//! \param psCursor is a pointer to the decoder position, or 0 to decode from
+//! the top of the image.
+//!
+//! This draws the image as RLEImageDraw() does, but starts decoding at the
+//! row held by the cursor, if it has one, and leaves the cursor at the first
+//! row below the clipping region.  Drawing a tall image as a series of bands
+//! from the top, with a clipping region per band and the same cursor, so
+//! decodes each token once, rather than decoding all of the tokens above each
+//! band again.  A cursor is reset by setting its pui8Token member to 0.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+RLEImageRowsDraw(const tContext *pContext, const uint8_t *pui8Image,
+                 int32_t i32X, int32_t i32Y, tRLEImageCursor *psCursor)
+{
+    const uint8_t *pui8Pixels, *pui8Token;
+    tRectangle sImage, sRect;
+    int32_t i32Width, i32Row, i32Col, i32Count, i32Run, i32First, i32Last;
+    int32_t i32Used;
+    uint32_t ui32Idx, ui32Color;
+
+    if(pui8Image[0] != RLE_IMAGE_FMT_8BPP)
+    {
+        return;
+    }
+
+    //
+    // Get the part of the image that is visible.
+    //
+    i32Width = pui8Image[1] | (pui8Image[2] << 8);
+    sImage.i16XMin = i32X;
+    sImage.i16YMin = i32Y;
+    sImage.i16XMax = i32X + i32Width - 1;
+    sImage.i16YMax = i32Y + (pui8Image[3] | (pui8Image[4] << 8)) - 1;
+    if(!GrRectIntersectGet(&sImage, (tRectangle *)&pContext->sClipRegion,
+                           &sRect))
+    {
+        return;
+    }
+
+    //
+    // Rows above the cursor have been drawn already.
+    //
+    if(psCursor && psCursor->pui8Token && (psCursor->i32Row > sRect.i16YMin))
+    {
+        if(psCursor->i32Row > sRect.i16YMax)
+        {
+            return;
+        }
+        sRect.i16YMin = psCursor->i32Row;
+    }
+
+    for(ui32Idx = 0; ui32Idx <= pui8Image[5]; ui32Idx++)
+    {
+        g_pui16RLEImagePalette[ui32Idx] = (pui8Image[6 + (ui32Idx * 2)] |
+                                           (pui8Image[7 + (ui32Idx * 2)] << 8));
+    }
+    pui8Image += 6 + (ui32Idx * 2);
+
+    CompositorRectDraw(&sRect);
+    Kentec320x240x16_SSD2119StreamStart(sRect.i16XMin, sRect.i16YMin,
+                                        sRect.i16XMax - sRect.i16XMin + 1,
+                                        sRect.i16YMax - sRect.i16YMin + 1);
+
+    //
+    // Decode the tokens until the last visible row is done.  i32Row and
+    // i32Col are the screen position of the next pixel, and i32Used the
+    // number of pixels of the first token that lie in the rows above the
+    // cursor.
+    //
+    i32Row = i32Y;
+    i32Col = i32X;
+    i32Used = 0;
+    if(psCursor && psCursor->pui8Token)
+    {
+        pui8Image = psCursor->pui8Token;
+        i32Row = psCursor->i32Row;
+        i32Used = psCursor->i32Used;
+    }
+    i32Count = 0;
+    pui8Token = pui8Image;
+    while(i32Row <= sRect.i16YMax)
+    {
+        pui8Token = pui8Image;
+        if(*pui8Image & 0x80)
+        {
+            i32Count = (*pui8Image++ & 0x7f) + RLE_IMAGE_RUN_MIN;
+            ui32Color = g_pui16RLEImagePalette[*pui8Image++];
+            pui8Pixels = 0;
+        }
+        else
+        {
+            i32Count = *pui8Image++ + 1;
+            ui32Color = 0;
+            pui8Pixels = pui8Image;
+            pui8Image += i32Count;
+        }
+        i32Count -= i32Used;
+        if(pui8Pixels)
+        {
+            pui8Pixels += i32Used;
+        }
+        i32Used = 0;
+
+        //
+        // Stream the visible pixels of the token, a row at a time.
+        //
+        while(i32Count && (i32Row <= sRect.i16YMax))
+        {
+            i32Run = sImage.i16XMax + 1 - i32Col;
+            if(i32Run > i32Count)
+            {
+                i32Run = i32Count;
+            }
+
+            i32First = (i32Col > sRect.i16XMin) ? i32Col : sRect.i16XMin;
+            i32Last = i32Col + i32Run - 1;
+            if(i32Last > sRect.i16XMax)
+            {
+                i32Last = sRect.i16XMax;
+            }
+            if((i32Row >= sRect.i16YMin) && (i32Row <= sRect.i16YMax) &&
+               (i32First <= i32Last))
+            {
+                if(pui8Pixels)
+                {
+                    Kentec320x240x16_SSD2119StreamPixels(
+                        pui8Pixels + (i32First - i32Col),
+                        i32Last - i32First + 1, g_pui16RLEImagePalette);
+                }
+                else
+                {
+                    Kentec320x240x16_SSD2119StreamFill(ui32Color,
+                                                       i32Last - i32First + 1);
+                }
+            }
+
+            if(pui8Pixels)
+            {
+                pui8Pixels += i32Run;
+            }
+            i32Count -= i32Run;
+            i32Col += i32Run;
+            if(i32Col > sImage.i16XMax)
+            {
+                i32Col = i32X;
+                i32Row++;
+            }
+        }
+    }
+
+    Kentec320x240x16_SSD2119StreamEnd();
+
+    //
+    // Leave the cursor at the first row below the clipping region: in the
+    // token being decoded, past the pixels of the rows above, or at the next
+    // token if this one is done.
+    //
+    if(psCursor)
+    {
+        if(i32Count)
+        {
+            psCursor->pui8Token = pui8Token;
+            psCursor->i32Used = (((*pui8Token & 0x80) ?
+                                  ((*pui8Token & 0x7f) + RLE_IMAGE_RUN_MIN) :
+                                  (*pui8Token + 1)) - i32Count);
+        }
+        else
+        {
+            psCursor->pui8Token = pui8Image;
+            psCursor->i32Used = 0;
+        }
+        psCursor->i32Row = i32Row;
+    }
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
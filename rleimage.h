@@ -0,0 +1,70 @@
+//*****************************************************************************
+//
+// rleimage.h - Prototypes for the run-length encoded image format.
+//
+//*****************************************************************************
+
+#ifndef __RLEIMAGE_H__
+#define __RLEIMAGE_H__
+
+//*****************************************************************************
+//
+// The format byte of an 8 BPP run-length encoded image.  The image is laid
+// out like a TivaWare 8 BPP palette image, with the palette already in the
+// display format:
+//
+//     RLE_IMAGE_FMT_8BPP
+//     width, low byte first (2 bytes)
+//     height, low byte first (2 bytes)
+//     number of palette colors - 1 (1 byte)
+//     the palette colors, as returned by DpyColorTranslate(), low byte first
+//     (2 bytes each)
+//     the pixels, row by row from the top, as a series of tokens
+//
+// A token byte below 0x80 is followed by that many plus one palette indices,
+// of one pixel each.  A token byte of 0x80 or above is followed by one palette
+// index, for (token - 0x80 + RLE_IMAGE_RUN_MIN) pixels.  Tokens may span
+// rows.  tools/assets.py converts PNG images to this format.
+//
+//*****************************************************************************
+#define RLE_IMAGE_FMT_8BPP      0x48
+#define RLE_IMAGE_RUN_MIN       3
+
+//*****************************************************************************
+//
+//! The position of the decoder at the start of a row, kept by
+//! RLEImageRowsDraw() between the bands of an image drawn a band at a time.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The token that holds the first pixel of the row, or 0 to start at the
+    //! top of the image.
+    //
+    const uint8_t *pui8Token;
+
+    //
+    //! The number of pixels of the token that lie in the rows above.
+    //
+    int32_t i32Used;
+
+    //
+    //! The screen Y coordinate of the row.
+    //
+    int32_t i32Row;
+}
+tRLEImageCursor;
+
+//*****************************************************************************
+//
+// Prototypes for the functions exported by the image decoder.
+//
+//*****************************************************************************
+extern void RLEImageDraw(const tContext *pContext, const uint8_t *pui8Image,
+                         int32_t i32X, int32_t i32Y);
+extern void RLEImageRowsDraw(const tContext *pContext,
+                             const uint8_t *pui8Image, int32_t i32X,
+                             int32_t i32Y, tRLEImageCursor *psCursor);
+
+#endif // __RLEIMAGE_H__
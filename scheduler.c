@@ -0,0 +1,358 @@
+//*****************************************************************************
+//
+// scheduler.c - Cooperative run-to-completion task scheduler.
+//
+// The application is split into short tasks that are run from the main
+// context.  Interrupt handlers only capture data and post the task that
+// processes it; when no task is ready the processor sleeps until the next
+// interrupt.  Every run is timed with the DWT cycle counter so that each task
+// can be checked against its execution time budget.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup scheduler_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_types.h"
+#include "driverlib/cpu.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "scheduler.h"
+
+//*****************************************************************************
+//
+// The task table, as passed to SchedulerInit().
+//
+//*****************************************************************************
+static tSchedTask *g_psSchedTasks;
+static uint32_t g_ui32SchedNumTasks;
+
+//*****************************************************************************
+//
+// The function called when no task is ready.
+//
+//*****************************************************************************
+static void (*g_pfnSchedIdle)(void);
+
+//*****************************************************************************
+//
+// The scheduler time in milliseconds, as last passed to SchedulerTick().
+//
+//*****************************************************************************
+static volatile uint32_t g_ui32SchedMs;
+
+//*****************************************************************************
+//
+// The processor cycles spent in the idle hook since SchedulerInit().
+//
+//*****************************************************************************
+static uint64_t g_ui64SchedIdleCycles;
+
+//*****************************************************************************
+//
+// The processor cycles, as passed to SchedulerCyclesExclude(), that are not
+// charged to the task they preempted.
+//
+//*****************************************************************************
+static volatile uint32_t g_ui32SchedExcluded;
+
+//*****************************************************************************
+//
+// The default idle hook, which waits for the next interrupt.
+//
+//*****************************************************************************
+static void
+SchedulerIdleDefault(void)
+{
+    CPUwfi();
+}
+
+//*****************************************************************************
+//
+// Marks periodic tasks whose period has expired as pending and returns the
+// highest priority pending task, or 0 if no task is ready.
+//
+//*****************************************************************************
+static tSchedTask *
+SchedulerReadyGet(void)
+{
+    tSchedTask *psTask, *psBest;
+    uint32_t ui32Idx, ui32Now;
+
+    ui32Now = g_ui32SchedMs;
+    psBest = 0;
+
+    for(ui32Idx = 0; ui32Idx < g_ui32SchedNumTasks; ui32Idx++)
+    {
+        psTask = &g_psSchedTasks[ui32Idx];
+
+        if(psTask->ui32PeriodMs &&
+           ((int32_t)(ui32Now - psTask->ui32NextMs) >= 0))
+        {
+            psTask->ui8Pending = 1;
+
+            //
+            // Keep the task on its original time grid, but do not try to
+            // catch up on periods that were missed altogether.
+            //
+            psTask->ui32NextMs += psTask->ui32PeriodMs;
+            if((int32_t)(ui32Now - psTask->ui32NextMs) >= 0)
+            {
+                psTask->ui32NextMs = ui32Now + psTask->ui32PeriodMs;
+            }
+        }
+
+        if(psTask->ui8Pending &&
+           ((psBest == 0) || (psTask->ui8Priority < psBest->ui8Priority)))
+        {
+            psBest = psTask;
+        }
+    }
+
+    return(psBest);
+}
+
+//*****************************************************************************
+//
+// Sleeps until the next interrupt unless a task became ready in the meantime.
+// Interrupts are disabled around the final check so that a post made by an
+// interrupt handler cannot slip in between the check and the sleep; a pending
+// interrupt still wakes the processor from WFI with interrupts disabled.
+//
+//*****************************************************************************
+static void
+SchedulerIdle(void)
+{
+    uint32_t ui32Start;
+
+    ui32Start = SchedulerCyclesGet();
+
+    IntMasterDisable();
+    if(SchedulerReadyGet() == 0)
+    {
+        g_pfnSchedIdle();
+    }
+    g_ui64SchedIdleCycles += SchedulerCyclesGet() - ui32Start;
+    IntMasterEnable();
+}
+
+//*****************************************************************************
+//
+//! Initializes the scheduler.
+//!
+//! \param psTasks points to the task table.
+//! \param ui32NumTasks is the number of tasks in the table.
+//! \param pfnIdle is the function called, with interrupts disabled, when no
+//! task is ready; it must return once an interrupt is pending.  If 0, the
+//! processor waits for the next interrupt with WFI.
+//!
+//! This function also enables the DWT cycle counter used for the execution
+//! time accounting.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SchedulerInit(tSchedTask *psTasks, uint32_t ui32NumTasks,
+              void (*pfnIdle)(void))
+{
+    uint32_t ui32Idx, ui32CyclesPerUs;
+
+    g_psSchedTasks = psTasks;
+    g_ui32SchedNumTasks = ui32NumTasks;
+    g_pfnSchedIdle = pfnIdle ? pfnIdle : SchedulerIdleDefault;
+    g_ui32SchedMs = 0;
+    g_ui64SchedIdleCycles = 0;
+
+    //
+    // Enable the DWT cycle counter.
+    //
+    HWREG(SCHED_DEMCR) |= SCHED_DEMCR_TRCENA;
+    HWREG(SCHED_DWT_CYCCNT) = 0;
+    HWREG(SCHED_DWT_CTRL) |= SCHED_DWT_CTRL_CYCCNTENA;
+
+    ui32CyclesPerUs = SysCtlClockGet() / 1000000;
+
+    for(ui32Idx = 0; ui32Idx < ui32NumTasks; ui32Idx++)
+    {
+        psTasks[ui32Idx].ui32NextMs = psTasks[ui32Idx].ui32PeriodMs;
+        psTasks[ui32Idx].ui32BudgetCycles = (psTasks[ui32Idx].ui32BudgetUs *
+                                             ui32CyclesPerUs);
+    }
+
+    SchedulerStatsReset();
+}
+
+//*****************************************************************************
+//
+//! Advances the scheduler time.
+//!
+//! \param ui32NowMs is the current time in milliseconds.
+//!
+//! This function is called from the acquisition timer interrupt.  The
+//! interrupt also wakes the scheduler from its idle hook so that periodic
+//! tasks are started on time.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SchedulerTick(uint32_t ui32NowMs)
+{
+    g_ui32SchedMs = ui32NowMs;
+}
+
+//*****************************************************************************
+//
+//! Gets the scheduler time.
+//!
+//! \return Returns the time in milliseconds.
+//
+//*****************************************************************************
+uint32_t
+SchedulerTimeGet(void)
+{
+    return(g_ui32SchedMs);
+}
+
+//*****************************************************************************
+//
+//! Makes a task ready to run.
+//!
+//! \param ui32Task is the index of the task in the task table.
+//!
+//! This function may be called from interrupt handlers.  Posting a task that
+//! is already pending has no further effect.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SchedulerTaskPost(uint32_t ui32Task)
+{
+    if(ui32Task < g_ui32SchedNumTasks)
+    {
+        g_psSchedTasks[ui32Task].ui8Pending = 1;
+    }
+}
+
+//*****************************************************************************
+//
+//! Runs the scheduler.
+//!
+//! This function repeatedly runs the highest priority ready task to
+//! completion, accounting for the cycles it takes, and calls the idle hook
+//! when no task is ready.  It never returns.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SchedulerRun(void)
+{
+    tSchedTask *psTask;
+    uint32_t ui32Start, ui32Cycles, ui32Excluded;
+
+    while(1)
+    {
+        psTask = SchedulerReadyGet();
+        if(psTask == 0)
+        {
+            SchedulerIdle();
+            continue;
+        }
+
+        //
+        // Clear the pending flag before running the task so that a post made
+        // while it runs makes it run again.
+        //
+        psTask->ui8Pending = 0;
+
+        ui32Excluded = g_ui32SchedExcluded;
+        ui32Start = SchedulerCyclesGet();
+        psTask->pfnTask();
+        ui32Cycles = SchedulerCyclesGet() - ui32Start;
+        ui32Cycles -= g_ui32SchedExcluded - ui32Excluded;
+
+        psTask->ui32Runs++;
+        psTask->ui32CyclesLast = ui32Cycles;
+        psTask->ui64CyclesTotal += ui32Cycles;
+        if(ui32Cycles > psTask->ui32CyclesMax)
+        {
+            psTask->ui32CyclesMax = ui32Cycles;
+        }
+        if(psTask->ui32BudgetCycles && (ui32Cycles > psTask->ui32BudgetCycles))
+        {
+            psTask->ui32Overruns++;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Excludes processor cycles from the run of the current task.
+//!
+//! \param ui32Cycles is the number of cycles.
+//!
+//! This function is called from interrupt handlers that account for their own
+//! time, such as the paint job executor, so that the time they take is not
+//! also charged to the task they preempted.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SchedulerCyclesExclude(uint32_t ui32Cycles)
+{
+    g_ui32SchedExcluded += ui32Cycles;
+}
+
+//*****************************************************************************
+//
+//! Gets the processor cycles spent idle.
+//!
+//! \return Returns the number of cycles spent in the idle hook since
+//! SchedulerInit().  The count is not affected by SchedulerStatsReset(), so
+//! several clients can each derive the idle time over their own interval.
+//
+//*****************************************************************************
+uint64_t
+SchedulerIdleCyclesGet(void)
+{
+    return(g_ui64SchedIdleCycles);
+}
+
+//*****************************************************************************
+//
+//! Resets the execution time statistics of all tasks.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SchedulerStatsReset(void)
+{
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < g_ui32SchedNumTasks; ui32Idx++)
+    {
+        g_psSchedTasks[ui32Idx].ui32Runs = 0;
+        g_psSchedTasks[ui32Idx].ui32Overruns = 0;
+        g_psSchedTasks[ui32Idx].ui32CyclesLast = 0;
+        g_psSchedTasks[ui32Idx].ui32CyclesMax = 0;
+        g_psSchedTasks[ui32Idx].ui64CyclesTotal = 0;
+    }
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
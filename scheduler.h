@@ -0,0 +1,126 @@
+//*****************************************************************************
+//
+// scheduler.h - Prototypes for the cooperative run-to-completion scheduler.
+//
+//*****************************************************************************
+
+#ifndef __SCHEDULER_H__
+#define __SCHEDULER_H__
+
+//*****************************************************************************
+//
+//! A task of the cooperative scheduler.  Tasks run to completion; a ready task
+//! with a lower priority number always runs before one with a higher number.
+//! A task is made ready by its period expiring, by SchedulerTaskPost(), or
+//! both.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The name of the task, used in reports.
+    //
+    const char *pcName;
+
+    //
+    //! The function that implements the task.
+    //
+    void (*pfnTask)(void);
+
+    //
+    //! The priority of the task; 0 is the highest.
+    //
+    uint8_t ui8Priority;
+
+    //
+    //! The period of the task in milliseconds, or 0 for an event-only task.
+    //
+    uint32_t ui32PeriodMs;
+
+    //
+    //! The execution time budget of one run in microseconds.  Runs that take
+    //! longer are counted as overruns.
+    //
+    uint32_t ui32BudgetUs;
+
+    //
+    //! Set, from any context, when the task has been posted.
+    //
+    volatile uint8_t ui8Pending;
+
+    //
+    //! The time at which a periodic task is next due.
+    //
+    uint32_t ui32NextMs;
+
+    //
+    //! The budget converted to processor cycles.
+    //
+    uint32_t ui32BudgetCycles;
+
+    //
+    //! The number of runs and the number of runs that exceeded the budget.
+    //
+    uint32_t ui32Runs;
+    uint32_t ui32Overruns;
+
+    //
+    //! The processor cycles taken by the last and by the longest run.
+    //
+    uint32_t ui32CyclesLast;
+    uint32_t ui32CyclesMax;
+
+    //
+    //! The processor cycles taken by all runs.
+    //
+    uint64_t ui64CyclesTotal;
+}
+tSchedTask;
+
+//*****************************************************************************
+//
+//! Declares the static part of a scheduler task; used to build the task table
+//! at compile time.
+//
+//*****************************************************************************
+#define SchedTaskStruct(pcName, pfnTask, ui8Priority, ui32PeriodMs,          \
+                        ui32BudgetUs)                                        \
+        {                                                                    \
+            pcName,                                                          \
+            pfnTask,                                                         \
+            ui8Priority,                                                     \
+            ui32PeriodMs,                                                    \
+            ui32BudgetUs,                                                    \
+            0, 0, 0, 0, 0, 0, 0, 0                                           \
+        }
+
+//*****************************************************************************
+//
+// Reads the free-running processor cycle counter (DWT CYCCNT), which the
+// scheduler enables in SchedulerInit().
+//
+//*****************************************************************************
+#define SCHED_DWT_CTRL          0xE0001000
+#define SCHED_DWT_CYCCNT        0xE0001004
+#define SCHED_DEMCR             0xE000EDFC
+#define SCHED_DEMCR_TRCENA      0x01000000
+#define SCHED_DWT_CTRL_CYCCNTENA 0x00000001
+
+#define SchedulerCyclesGet()    HWREG(SCHED_DWT_CYCCNT)
+
+//*****************************************************************************
+//
+// Prototypes for the functions exported by the scheduler.
+//
+//*****************************************************************************
+extern void SchedulerInit(tSchedTask *psTasks, uint32_t ui32NumTasks,
+                          void (*pfnIdle)(void));
+extern void SchedulerTick(uint32_t ui32NowMs);
+extern uint32_t SchedulerTimeGet(void);
+extern void SchedulerTaskPost(uint32_t ui32Task);
+extern void SchedulerRun(void);
+extern void SchedulerCyclesExclude(uint32_t ui32Cycles);
+extern uint64_t SchedulerIdleCyclesGet(void);
+extern void SchedulerStatsReset(void);
+
+#endif // __SCHEDULER_H__
@@ -0,0 +1,700 @@
+//*****************************************************************************
+//
+// serial.c - Interrupt driven UART0 driver.
+//
+// The console text and the telemetry frames are queued in a ring buffer and
+// moved into the UART transmit FIFO by the UART0 interrupt, so writing to
+// the UART never waits for the line.  The transmit interrupt is raised when
+// the FIFO drains to 2 of its 16 bytes; a write to an idle transmitter fills
+// the FIFO itself to start the interrupts.
+//
+// A message is queued whole or not at all.  When the ring buffer does not
+// have room for a message it is dropped and counted, so that a burst of
+// output loses complete lines and frames instead of corrupting them, and the
+// code that writes is never held up.
+//
+// The ring buffer has a single writer, which must not be an interrupt
+// handler, and a single reader, the UART0 interrupt.
+//
+// Received bytes are moved from the UART receive FIFO into a second ring
+// buffer by the same interrupt, on the receive and receive time-out
+// interrupts, and read back by SerialCharGet() or, a line at a time with echo
+// and backspace editing, by SerialLineGet().
+//
+// The baud rate can be raised at run time with a handshake that cannot lose
+// the console: SerialBaudSet() requests it, SerialBaudPoll() then holds new
+// output and switches once the line is idle, and the new rate is kept only
+// if SerialBaudConfirm() is called within SERIAL_BAUD_CONFIRM_MS, normally
+// by a command received at that rate.  Otherwise the previous rate is
+// restored.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup serial_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/uart.h"
+#include "driverlib/rom.h"
+#include "utils/ustdlib.h"
+#include "serial.h"
+
+//*****************************************************************************
+//
+// The transmit ring buffer.  The write index is only changed by the writer
+// and the read index only by the interrupt handler, or by the writer with
+// the interrupt disabled.
+//
+//*****************************************************************************
+#define SERIAL_TX_MASK          (SERIAL_TX_BUFFER_SIZE - 1)
+
+static uint8_t g_pui8SerialTx[SERIAL_TX_BUFFER_SIZE];
+static volatile uint32_t g_ui32SerialTxWrite;
+static volatile uint32_t g_ui32SerialTxRead;
+
+//*****************************************************************************
+//
+// The receive ring buffer.  The write index is only changed by the interrupt
+// handler and the read index only by the reader.
+//
+//*****************************************************************************
+#define SERIAL_RX_MASK          (SERIAL_RX_BUFFER_SIZE - 1)
+
+static uint8_t g_pui8SerialRx[SERIAL_RX_BUFFER_SIZE];
+static volatile uint32_t g_ui32SerialRxWrite;
+static volatile uint32_t g_ui32SerialRxRead;
+
+//*****************************************************************************
+//
+// The command line being collected by SerialLineGet(), its length and
+// whether the last character ended a line with a carriage return.
+//
+//*****************************************************************************
+static char g_pcSerialCmd[SERIAL_CMD_SIZE];
+static uint32_t g_ui32SerialCmdLength;
+static bool g_bSerialCmdCR;
+
+//*****************************************************************************
+//
+// The buffer in which SerialPrintf() formats a message.
+//
+//*****************************************************************************
+static char g_pcSerialLine[SERIAL_LINE_SIZE];
+
+//*****************************************************************************
+//
+// The transmitter counters.
+//
+//*****************************************************************************
+static tSerialStats g_sSerialStats;
+
+//*****************************************************************************
+//
+// The states of a baud rate change.
+//
+//*****************************************************************************
+#define SERIAL_BAUD_IDLE        0           // No change in progress
+#define SERIAL_BAUD_REQUEST     1           // Requested, output still queued
+#define SERIAL_BAUD_DRAIN       2           // Output held until the line idles
+#define SERIAL_BAUD_TRIAL       3           // Waiting for the confirmation
+#define SERIAL_BAUD_REVERT      4           // Output held to restore the rate
+
+//*****************************************************************************
+//
+// The current baud rate, the rate being switched to or from, the state of
+// the change and the time by which the new rate must be confirmed.
+//
+//*****************************************************************************
+static uint32_t g_ui32SerialBaud;
+static uint32_t g_ui32SerialBaudOther;
+static uint32_t g_ui32SerialBaudState;
+static uint32_t g_ui32SerialBaudDeadline;
+
+//*****************************************************************************
+//
+// Returns the number of bytes waiting in the ring buffer.
+//
+//*****************************************************************************
+static uint32_t
+SerialTxUsed(void)
+{
+    return((g_ui32SerialTxWrite - g_ui32SerialTxRead) & SERIAL_TX_MASK);
+}
+
+//*****************************************************************************
+//
+// Moves bytes from the ring buffer into the UART transmit FIFO until either
+// is exhausted.
+//
+//*****************************************************************************
+static void
+SerialTxFill(void)
+{
+    uint32_t ui32Read;
+
+    ui32Read = g_ui32SerialTxRead;
+    while((ui32Read != g_ui32SerialTxWrite) && ROM_UARTSpaceAvail(UART0_BASE))
+    {
+        ROM_UARTCharPutNonBlocking(UART0_BASE, g_pui8SerialTx[ui32Read]);
+        ui32Read = (ui32Read + 1) & SERIAL_TX_MASK;
+    }
+    g_ui32SerialTxRead = ui32Read;
+}
+
+//*****************************************************************************
+//
+// Moves bytes from the UART receive FIFO into the ring buffer until the FIFO
+// is empty.  Bytes that do not fit are dropped.
+//
+//*****************************************************************************
+static void
+SerialRxDrain(void)
+{
+    uint32_t ui32Write, ui32Next;
+    int32_t i32Char;
+
+    ui32Write = g_ui32SerialRxWrite;
+    while(ROM_UARTCharsAvail(UART0_BASE))
+    {
+        i32Char = ROM_UARTCharGetNonBlocking(UART0_BASE);
+        ui32Next = (ui32Write + 1) & SERIAL_RX_MASK;
+        if(ui32Next == g_ui32SerialRxRead)
+        {
+            g_sSerialStats.ui32RxDropped++;
+            continue;
+        }
+        g_pui8SerialRx[ui32Write] = i32Char;
+        ui32Write = ui32Next;
+    }
+    g_ui32SerialRxWrite = ui32Write;
+}
+
+//*****************************************************************************
+//
+// Queues a message, expanding each newline to a carriage return and newline
+// if it is text, and starts the transmitter.  Returns false, and counts the
+// message as dropped, if the ring buffer does not have room for all of it.
+//
+//*****************************************************************************
+static bool
+SerialQueue(const uint8_t *pui8Data, uint32_t ui32Length, bool bText)
+{
+    uint32_t ui32Idx, ui32Needed, ui32Write;
+
+    //
+    // Nothing is queued while the baud rate is about to change, so that the
+    // line idles and the change is not held up by a steady stream of output.
+    //
+    ui32Needed = ui32Length;
+    if((g_ui32SerialBaudState == SERIAL_BAUD_DRAIN) ||
+       (g_ui32SerialBaudState == SERIAL_BAUD_REVERT))
+    {
+        g_sSerialStats.ui32Dropped++;
+        g_sSerialStats.ui32DroppedBytes += ui32Needed;
+        return(false);
+    }
+    if(bText)
+    {
+        for(ui32Idx = 0; ui32Idx < ui32Length; ui32Idx++)
+        {
+            if(pui8Data[ui32Idx] == '\n')
+            {
+                ui32Needed++;
+            }
+        }
+    }
+
+    //
+    // One byte of the ring buffer is always left empty to tell a full
+    // buffer from an empty one.
+    //
+    if(ui32Needed > (SERIAL_TX_MASK - SerialTxUsed()))
+    {
+        g_sSerialStats.ui32Dropped++;
+        g_sSerialStats.ui32DroppedBytes += ui32Needed;
+        return(false);
+    }
+
+    ui32Write = g_ui32SerialTxWrite;
+    for(ui32Idx = 0; ui32Idx < ui32Length; ui32Idx++)
+    {
+        if(bText && (pui8Data[ui32Idx] == '\n'))
+        {
+            g_pui8SerialTx[ui32Write] = '\r';
+            ui32Write = (ui32Write + 1) & SERIAL_TX_MASK;
+        }
+        g_pui8SerialTx[ui32Write] = pui8Data[ui32Idx];
+        ui32Write = (ui32Write + 1) & SERIAL_TX_MASK;
+    }
+    g_ui32SerialTxWrite = ui32Write;
+
+    g_sSerialStats.ui32Bytes += ui32Needed;
+    if(SerialTxUsed() > g_sSerialStats.ui32MaxUsed)
+    {
+        g_sSerialStats.ui32MaxUsed = SerialTxUsed();
+    }
+
+    //
+    // Top up the transmit FIFO.  If the transmitter was idle this starts it;
+    // otherwise the interrupt would have done the same shortly.
+    //
+    ROM_IntDisable(INT_UART0);
+    SerialTxFill();
+    ROM_IntEnable(INT_UART0);
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Checks that a baud rate can be produced from the system clock to within
+// SERIAL_BAUD_ERROR_PCT percent, using the divisor that
+// UARTConfigSetExpClk() would program.  The fractional divisor is in 64ths
+// of the UART clock divided by 16, or by 8 in high speed mode.
+//
+//*****************************************************************************
+static bool
+SerialBaudValid(uint32_t ui32Baud)
+{
+    uint32_t ui32Clock, ui32Div, ui32Actual;
+
+    ui32Clock = ROM_SysCtlClockGet();
+    if((ui32Baud == 0) || (ui32Baud > (ui32Clock / 8)))
+    {
+        return(false);
+    }
+
+    if((ui32Baud * 16) > ui32Clock)
+    {
+        ui32Div = (((ui32Clock * 8) / (ui32Baud / 2)) + 1) / 2;
+        ui32Actual = (ui32Clock * 8) / ui32Div;
+    }
+    else
+    {
+        ui32Div = (((ui32Clock * 8) / ui32Baud) + 1) / 2;
+        ui32Actual = (ui32Clock * 4) / ui32Div;
+    }
+
+    if((ui32Div < 64) || (ui32Div >= (65536 * 64)))
+    {
+        return(false);
+    }
+
+    return(((ui32Actual > ui32Baud) ? (ui32Actual - ui32Baud) :
+            (ui32Baud - ui32Actual)) <=
+           ((ui32Baud / 100) * SERIAL_BAUD_ERROR_PCT));
+}
+
+//*****************************************************************************
+//
+// Programs UART0 for a baud rate, 8-N-1, and discards whatever was received
+// at the old rate, including a partly typed command line.
+//
+//*****************************************************************************
+static void
+SerialBaudApply(uint32_t ui32Baud)
+{
+    ROM_UARTConfigSetExpClk(UART0_BASE, ROM_SysCtlClockGet(), ui32Baud,
+                            (UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE |
+                             UART_CONFIG_PAR_NONE));
+    g_ui32SerialBaud = ui32Baud;
+
+    ROM_IntDisable(INT_UART0);
+    while(ROM_UARTCharsAvail(UART0_BASE))
+    {
+        ROM_UARTCharGetNonBlocking(UART0_BASE);
+    }
+    g_ui32SerialRxRead = g_ui32SerialRxWrite;
+    ROM_IntEnable(INT_UART0);
+    g_ui32SerialCmdLength = 0;
+    g_bSerialCmdCR = false;
+}
+
+//*****************************************************************************
+//
+//! Initializes the UART driver.
+//!
+//! \param ui32Baud is the baud rate, normally SERIAL_BAUD_DEFAULT.
+//!
+//! UART0 and its pins must have been enabled, and the system clock selected
+//! as its clock, before this function is called.  The UART is configured for
+//! 8-N-1 at \e ui32Baud, and the transmit, receive and receive time-out
+//! interrupts are enabled in UART0 and in the interrupt controller.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SerialInit(uint32_t ui32Baud)
+{
+    g_ui32SerialTxWrite = 0;
+    g_ui32SerialTxRead = 0;
+    g_ui32SerialRxWrite = 0;
+    g_ui32SerialRxRead = 0;
+    g_ui32SerialCmdLength = 0;
+    g_bSerialCmdCR = false;
+    g_ui32SerialBaudState = SERIAL_BAUD_IDLE;
+    SerialStatsGet(0, true);
+
+    SerialBaudApply(ui32Baud);
+    ROM_UARTFIFOEnable(UART0_BASE);
+    ROM_UARTFIFOLevelSet(UART0_BASE, UART_FIFO_TX1_8, UART_FIFO_RX4_8);
+    ROM_UARTTxIntModeSet(UART0_BASE, UART_TXINT_MODE_FIFO);
+    ROM_UARTIntEnable(UART0_BASE, UART_INT_TX | UART_INT_RX | UART_INT_RT);
+    ROM_IntEnable(INT_UART0);
+}
+
+//*****************************************************************************
+//
+//! Queues bytes for transmission.
+//!
+//! \param pui8Data points to the bytes.
+//! \param ui32Length is the number of bytes.
+//!
+//! The bytes are sent unchanged.  They are queued whole or, if the ring
+//! buffer does not have room for all of them, dropped.  This function must
+//! not be called from an interrupt handler.
+//!
+//! \return Returns \b true if the bytes were queued and \b false if they were
+//! dropped.
+//
+//*****************************************************************************
+bool
+SerialWrite(const uint8_t *pui8Data, uint32_t ui32Length)
+{
+    return(SerialQueue(pui8Data, ui32Length, false));
+}
+
+//*****************************************************************************
+//
+//! Formats a console message and queues it for transmission.
+//!
+//! \param pcString is the format string, as for usnprintf().
+//!
+//! Each newline in the message is sent as a carriage return and a newline.
+//! Messages longer than SERIAL_LINE_SIZE - 1 characters are truncated.  The
+//! message is queued whole or dropped, as for SerialWrite().  This function
+//! must not be called from an interrupt handler.
+//!
+//! \return Returns \b true if the message was queued and \b false if it was
+//! dropped.
+//
+//*****************************************************************************
+bool
+SerialPrintf(const char *pcString, ...)
+{
+    va_list vaArgP;
+    int32_t i32Length;
+
+    va_start(vaArgP, pcString);
+    i32Length = uvsnprintf(g_pcSerialLine, sizeof(g_pcSerialLine), pcString,
+                           vaArgP);
+    va_end(vaArgP);
+
+    if(i32Length <= 0)
+    {
+        return(true);
+    }
+    if(i32Length >= (int32_t)sizeof(g_pcSerialLine))
+    {
+        i32Length = sizeof(g_pcSerialLine) - 1;
+    }
+
+    return(SerialQueue((const uint8_t *)g_pcSerialLine, i32Length, true));
+}
+
+//*****************************************************************************
+//
+//! Reads a received character.
+//!
+//! \return Returns the next received character, or -1 if there is none.
+//
+//*****************************************************************************
+int32_t
+SerialCharGet(void)
+{
+    uint32_t ui32Read;
+    int32_t i32Char;
+
+    ui32Read = g_ui32SerialRxRead;
+    if(ui32Read == g_ui32SerialRxWrite)
+    {
+        return(-1);
+    }
+
+    i32Char = g_pui8SerialRx[ui32Read];
+    g_ui32SerialRxRead = (ui32Read + 1) & SERIAL_RX_MASK;
+
+    return(i32Char);
+}
+
+//*****************************************************************************
+//
+//! Collects a command line from the received characters.
+//!
+//! This function reads the characters received so far, echoing them, and
+//! returns once a carriage return or newline completes a line.  Backspace and
+//! delete remove the last character.  Other control characters, and the
+//! characters beyond SERIAL_CMD_SIZE - 1, are ignored.  This function must
+//! not be called from an interrupt handler.
+//!
+//! \return Returns a pointer to the completed line, without its terminator,
+//! or 0 if no line is complete yet.  The line is overwritten by the next call.
+//
+//*****************************************************************************
+char *
+SerialLineGet(void)
+{
+    int32_t i32Char;
+
+    while((i32Char = SerialCharGet()) >= 0)
+    {
+        //
+        // A newline right after a carriage return ends the same line.
+        //
+        if((i32Char == '\n') && g_bSerialCmdCR)
+        {
+            g_bSerialCmdCR = false;
+            continue;
+        }
+        g_bSerialCmdCR = (i32Char == '\r');
+
+        if((i32Char == '\r') || (i32Char == '\n'))
+        {
+            SerialQueue((const uint8_t *)"\n", 1, true);
+            g_pcSerialCmd[g_ui32SerialCmdLength] = 0;
+            g_ui32SerialCmdLength = 0;
+            return(g_pcSerialCmd);
+        }
+
+        if((i32Char == '\b') || (i32Char == 0x7f))
+        {
+            if(g_ui32SerialCmdLength)
+            {
+                g_ui32SerialCmdLength--;
+                SerialQueue((const uint8_t *)"\b \b", 3, false);
+            }
+            continue;
+        }
+
+        if((i32Char < ' ') || (i32Char > '~') ||
+           (g_ui32SerialCmdLength >= (SERIAL_CMD_SIZE - 1)))
+        {
+            continue;
+        }
+
+        g_pcSerialCmd[g_ui32SerialCmdLength++] = i32Char;
+        SerialQueue((const uint8_t *)&g_pcSerialCmd[g_ui32SerialCmdLength - 1],
+                    1, false);
+    }
+
+    return(0);
+}
+
+//*****************************************************************************
+//
+//! Starts a change of the baud rate.
+//!
+//! \param ui32Baud is the new baud rate.
+//!
+//! Output queued before the next call to SerialBaudPoll(), such as the reply
+//! to the command that asked for the change, is still sent at the current
+//! rate.  From that call on, new output is dropped until the line has idled
+//! and the new rate is set.  The new rate is then kept only if
+//! SerialBaudConfirm() is called within SERIAL_BAUD_CONFIRM_MS.
+//!
+//! \return Returns \b false if the rate cannot be produced from the system
+//! clock or a change is already in progress.
+//
+//*****************************************************************************
+bool
+SerialBaudSet(uint32_t ui32Baud)
+{
+    if((g_ui32SerialBaudState != SERIAL_BAUD_IDLE) ||
+       !SerialBaudValid(ui32Baud))
+    {
+        return(false);
+    }
+
+    if(ui32Baud != g_ui32SerialBaud)
+    {
+        g_ui32SerialBaudOther = ui32Baud;
+        g_ui32SerialBaudState = SERIAL_BAUD_REQUEST;
+    }
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+//! Confirms the baud rate switched to by SerialBaudPoll().
+//!
+//! \return Returns \b false if a switch has not happened yet, and \b true
+//! otherwise, including when no change was in progress.
+//
+//*****************************************************************************
+bool
+SerialBaudConfirm(void)
+{
+    if(g_ui32SerialBaudState == SERIAL_BAUD_TRIAL)
+    {
+        g_ui32SerialBaudState = SERIAL_BAUD_IDLE;
+    }
+
+    return(g_ui32SerialBaudState == SERIAL_BAUD_IDLE);
+}
+
+//*****************************************************************************
+//
+//! Advances a change of the baud rate.
+//!
+//! \param ui32Now is the time in milliseconds.
+//!
+//! This function switches to the requested rate, or back to the previous one
+//! when the new rate was not confirmed in time, once the transmit ring buffer
+//! is empty and the transmitter idle.  It must be called periodically, and
+//! not from an interrupt handler.
+//!
+//! \return Returns \b SERIAL_BAUD_SWITCHED or \b SERIAL_BAUD_RESTORED when
+//! the rate was changed and \b SERIAL_BAUD_NONE otherwise.
+//
+//*****************************************************************************
+uint32_t
+SerialBaudPoll(uint32_t ui32Now)
+{
+    uint32_t ui32Baud;
+
+    switch(g_ui32SerialBaudState)
+    {
+        case SERIAL_BAUD_REQUEST:
+        {
+            g_ui32SerialBaudState = SERIAL_BAUD_DRAIN;
+            return(SERIAL_BAUD_NONE);
+        }
+
+        case SERIAL_BAUD_TRIAL:
+        {
+            if((int32_t)(ui32Now - g_ui32SerialBaudDeadline) >= 0)
+            {
+                g_ui32SerialBaudState = SERIAL_BAUD_REVERT;
+            }
+            return(SERIAL_BAUD_NONE);
+        }
+
+        case SERIAL_BAUD_DRAIN:
+        case SERIAL_BAUD_REVERT:
+        {
+            if(SerialTxUsed() || ROM_UARTBusy(UART0_BASE))
+            {
+                return(SERIAL_BAUD_NONE);
+            }
+
+            ui32Baud = g_ui32SerialBaud;
+            SerialBaudApply(g_ui32SerialBaudOther);
+            g_ui32SerialBaudOther = ui32Baud;
+
+            if(g_ui32SerialBaudState == SERIAL_BAUD_REVERT)
+            {
+                g_ui32SerialBaudState = SERIAL_BAUD_IDLE;
+                return(SERIAL_BAUD_RESTORED);
+            }
+
+            g_ui32SerialBaudState = SERIAL_BAUD_TRIAL;
+            g_ui32SerialBaudDeadline = ui32Now + SERIAL_BAUD_CONFIRM_MS;
+            return(SERIAL_BAUD_SWITCHED);
+        }
+
+        default:
+        {
+            return(SERIAL_BAUD_NONE);
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Gets the baud rate.
+//!
+//! \return Returns the baud rate UART0 is running at.
+//
+//*****************************************************************************
+uint32_t
+SerialBaudGet(void)
+{
+    return(g_ui32SerialBaud);
+}
+
+//*****************************************************************************
+//
+//! Handles the UART0 interrupt.
+//!
+//! This function refills the transmit FIFO from the transmit ring buffer and
+//! empties the receive FIFO into the receive ring buffer.  It must be
+//! installed as the UART0 handler in the vector table.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SerialIntHandler(void)
+{
+    uint32_t ui32Status;
+
+    ui32Status = ROM_UARTIntStatus(UART0_BASE, true);
+    ROM_UARTIntClear(UART0_BASE, ui32Status);
+
+    if(ui32Status & UART_INT_TX)
+    {
+        SerialTxFill();
+    }
+
+    if(ui32Status & (UART_INT_RX | UART_INT_RT))
+    {
+        SerialRxDrain();
+    }
+}
+
+//*****************************************************************************
+//
+//! Gets the UART counters.
+//!
+//! \param psStats points to storage for the counters, or is 0 to only reset
+//! them.
+//! \param bReset is \b true to reset the counters once they are read.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SerialStatsGet(tSerialStats *psStats, bool bReset)
+{
+    if(psStats)
+    {
+        *psStats = g_sSerialStats;
+    }
+
+    if(bReset)
+    {
+        g_sSerialStats.ui32Bytes = 0;
+        g_sSerialStats.ui32Dropped = 0;
+        g_sSerialStats.ui32DroppedBytes = 0;
+        g_sSerialStats.ui32MaxUsed = SerialTxUsed();
+    }
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
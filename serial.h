@@ -0,0 +1,117 @@
+//*****************************************************************************
+//
+// serial.h - Prototypes for the interrupt driven UART0 driver.
+//
+//*****************************************************************************
+
+#ifndef __SERIAL_H__
+#define __SERIAL_H__
+
+//*****************************************************************************
+//
+// The baud rate at reset, the time in milliseconds within which a new rate
+// must be confirmed before the previous one is restored, and the largest
+// error, in percent, allowed between a rate and what the baud rate divider
+// produces.  The UART runs from the system clock and reaches an eighth of it,
+// 10 Mbaud at 80 MHz, in high speed mode.
+//
+//*****************************************************************************
+#define SERIAL_BAUD_DEFAULT     115200
+#define SERIAL_BAUD_CONFIRM_MS  2000
+#define SERIAL_BAUD_ERROR_PCT   2
+
+//*****************************************************************************
+//
+// The results of SerialBaudPoll().
+//
+//*****************************************************************************
+#define SERIAL_BAUD_NONE        0           // Nothing happened
+#define SERIAL_BAUD_SWITCHED    1           // Now at the requested rate
+#define SERIAL_BAUD_RESTORED    2           // Back at the previous rate
+
+//*****************************************************************************
+//
+// The size of the transmit ring buffer, in bytes.  It must be a power of two.
+// It holds the largest console report burst with room to spare; at 115200
+// baud it takes about 350ms to drain when full, at 921600 about 45ms.
+//
+//*****************************************************************************
+#define SERIAL_TX_BUFFER_SIZE   4096
+
+//*****************************************************************************
+//
+// The size of the receive ring buffer, in bytes.  It must be a power of two.
+// It only has to hold what is typed between two calls to SerialLineGet().
+//
+//*****************************************************************************
+#define SERIAL_RX_BUFFER_SIZE   128
+
+//*****************************************************************************
+//
+// The longest console message, in bytes, that SerialPrintf() formats.
+// Longer messages are truncated.
+//
+//*****************************************************************************
+#define SERIAL_LINE_SIZE        160
+
+//*****************************************************************************
+//
+// The longest command line, in bytes, that SerialLineGet() collects.  Further
+// characters are ignored.
+//
+//*****************************************************************************
+#define SERIAL_CMD_SIZE         80
+
+//*****************************************************************************
+//
+//! The UART counters.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The number of bytes queued for transmission.
+    //
+    uint32_t ui32Bytes;
+
+    //
+    //! The number of messages dropped because the ring buffer was full.
+    //
+    uint32_t ui32Dropped;
+
+    //
+    //! The number of bytes in the dropped messages.
+    //
+    uint32_t ui32DroppedBytes;
+
+    //
+    //! The largest number of bytes waiting in the ring buffer.
+    //
+    uint32_t ui32MaxUsed;
+
+    //
+    //! The number of received bytes lost because the receive ring buffer
+    //! was full.
+    //
+    uint32_t ui32RxDropped;
+}
+tSerialStats;
+
+//*****************************************************************************
+//
+// Prototypes for the functions exported by the UART driver.
+//
+//*****************************************************************************
+extern void SerialInit(uint32_t ui32Baud);
+extern bool SerialWrite(const uint8_t *pui8Data, uint32_t ui32Length);
+extern bool SerialPrintf(const char *pcString, ...);
+extern int32_t SerialCharGet(void);
+extern char *SerialLineGet(void);
+extern bool SerialBaudSet(uint32_t ui32Baud);
+extern bool SerialBaudConfirm(void);
+extern uint32_t SerialBaudPoll(uint32_t ui32Now);
+extern uint32_t SerialBaudGet(void);
+extern void SerialIntHandler(void);
+extern void SerialStatsGet(tSerialStats *psStats, bool bReset);
+
+#endif // __SERIAL_H__
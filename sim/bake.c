@@ -0,0 +1,262 @@
+//*****************************************************************************
+//
+// bake.c - Bakes the static panel layers into the panel cache.
+//
+// "zc706sim --bake <file>" paints the static layer of each panel with the
+// firmware's PanelStaticPaint() into a frame buffer on the host, and writes
+// the pixels of each layer, run-length encoded, as the C source of the panel
+// cache (see ../panelcache.c).  Nothing else of the firmware is run.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "grlib/grlib.h"
+#include "Kentec320x240x16_ssd2119_8bit.h"
+#include "panelcache.h"
+#include "sim.h"
+
+//*****************************************************************************
+//
+// The most panels looked at, and the longest run.
+//
+//*****************************************************************************
+#define SIM_BAKE_PANELS         16
+#define SIM_BAKE_RUN_MAX        0xffff
+
+//*****************************************************************************
+//
+// The frame buffer the layers are painted into, and whether anything was
+// drawn that the bake does not support.
+//
+//*****************************************************************************
+static uint16_t g_ppui16SimBake[SIM_LCD_HEIGHT][SIM_LCD_WIDTH];
+static bool g_bSimBakeError;
+
+//*****************************************************************************
+//
+// The display functions of the frame buffer.
+//
+//*****************************************************************************
+static void
+SimBakePixelDraw(void *pvDisplayData, int32_t i32X, int32_t i32Y,
+                 uint32_t ui32Value)
+{
+    g_ppui16SimBake[i32Y][i32X] = ui32Value;
+}
+
+static void
+SimBakePixelDrawMultiple(void *pvDisplayData, int32_t i32X, int32_t i32Y,
+                         int32_t i32X0, int32_t i32Count, int32_t i32BPP,
+                         const uint8_t *pui8Data, const uint8_t *pui8Palette)
+{
+    if(i32BPP != 1)
+    {
+        g_bSimBakeError = true;
+        return;
+    }
+
+    for(; i32Count > 0; i32Count--, i32X++, i32X0++)
+    {
+        g_ppui16SimBake[i32Y][i32X] =
+            ((const uint32_t *)pui8Palette)[(pui8Data[i32X0 / 8] >>
+                                             (7 - (i32X0 % 8))) & 1];
+    }
+}
+
+static void
+SimBakeLineDrawH(void *pvDisplayData, int32_t i32X1, int32_t i32X2,
+                 int32_t i32Y, uint32_t ui32Value)
+{
+    for(; i32X1 <= i32X2; i32X1++)
+    {
+        g_ppui16SimBake[i32Y][i32X1] = ui32Value;
+    }
+}
+
+static void
+SimBakeLineDrawV(void *pvDisplayData, int32_t i32X, int32_t i32Y1,
+                 int32_t i32Y2, uint32_t ui32Value)
+{
+    for(; i32Y1 <= i32Y2; i32Y1++)
+    {
+        g_ppui16SimBake[i32Y1][i32X] = ui32Value;
+    }
+}
+
+static void
+SimBakeRectFill(void *pvDisplayData, const tRectangle *psRect,
+                uint32_t ui32Value)
+{
+    int32_t i32Y;
+
+    for(i32Y = psRect->i16YMin; i32Y <= psRect->i16YMax; i32Y++)
+    {
+        SimBakeLineDrawH(pvDisplayData, psRect->i16XMin, psRect->i16XMax,
+                         i32Y, ui32Value);
+    }
+}
+
+static uint32_t
+SimBakeColorTranslate(void *pvDisplayData, uint32_t ui32Value)
+{
+    return(DpyColorTranslate(&g_sKentec320x240x16_SSD2119, ui32Value));
+}
+
+static void
+SimBakeFlush(void *pvDisplayData)
+{
+}
+
+static const tDisplay g_sSimBakeDisplay =
+{
+    sizeof(tDisplay),
+    0,
+    SIM_LCD_WIDTH,
+    SIM_LCD_HEIGHT,
+    SimBakePixelDraw,
+    SimBakePixelDrawMultiple,
+    SimBakeLineDrawH,
+    SimBakeLineDrawV,
+    SimBakeRectFill,
+    SimBakeColorTranslate,
+    SimBakeFlush
+};
+
+//*****************************************************************************
+//
+// Writes the runs of a rectangle of the frame buffer as a C array, and
+// returns the number of runs.
+//
+//*****************************************************************************
+static uint32_t
+SimBakeRunsWrite(FILE *psFile, uint32_t ui32Panel, const tRectangle *psRect)
+{
+    uint32_t ui32Runs, ui32Count;
+    uint16_t ui16Color;
+    int32_t i32X, i32Y;
+
+    fprintf(psFile, "static const uint16_t g_pui16PanelCache%u[] =\n{",
+            ui32Panel);
+
+    ui32Runs = 0;
+    ui32Count = 0;
+    ui16Color = 0;
+    for(i32Y = psRect->i16YMin; i32Y <= (psRect->i16YMax + 1); i32Y++)
+    {
+        for(i32X = psRect->i16XMin; i32X <= psRect->i16XMax; i32X++)
+        {
+            //
+            // Close the run at a change of color, at its longest and past the
+            // last pixel.
+            //
+            if(ui32Count &&
+               ((i32Y > psRect->i16YMax) ||
+                (g_ppui16SimBake[i32Y][i32X] != ui16Color) ||
+                (ui32Count == SIM_BAKE_RUN_MAX)))
+            {
+                fprintf(psFile, "%s%5u, 0x%04x,",
+                        (ui32Runs % 4) ? " " : "\n   ", ui32Count, ui16Color);
+                ui32Runs++;
+                ui32Count = 0;
+            }
+            if(i32Y > psRect->i16YMax)
+            {
+                break;
+            }
+
+            ui16Color = g_ppui16SimBake[i32Y][i32X];
+            ui32Count++;
+        }
+    }
+
+    fprintf(psFile, "\n};\n\n");
+
+    return(ui32Runs);
+}
+
+//*****************************************************************************
+//
+// Bakes the static layers of the panels into a C source file.  Returns true
+// on success.
+//
+//*****************************************************************************
+bool
+SimBake(const char *pcFile)
+{
+    tRectangle psRect[SIM_BAKE_PANELS];
+    uint32_t pui32Runs[SIM_BAKE_PANELS];
+    bool pbBaked[SIM_BAKE_PANELS];
+    tContext sContext;
+    uint32_t ui32Panel;
+    FILE *psFile;
+
+    psFile = fopen(pcFile, "w");
+    if(!psFile)
+    {
+        fprintf(stderr, "sim: cannot write %s\n", pcFile);
+        return(false);
+    }
+
+    fprintf(psFile,
+            "//*************************************************************"
+            "****************\n"
+            "//\n"
+            "// panelcache_data.c - The baked static layers of the panels.\n"
+            "//\n"
+            "// Generated from PanelStaticPaint() by \"make -C sim bake\"; "
+            "do not edit.\n"
+            "//\n"
+            "//*************************************************************"
+            "****************\n"
+            "\n"
+            "#include <stdint.h>\n"
+            "#include <stdbool.h>\n"
+            "#include \"grlib/grlib.h\"\n"
+            "#include \"panelcache.h\"\n"
+            "\n");
+
+    for(ui32Panel = 0; ui32Panel < SIM_BAKE_PANELS; ui32Panel++)
+    {
+        memset(g_ppui16SimBake, 0, sizeof(g_ppui16SimBake));
+        GrContextInit(&sContext, &g_sSimBakeDisplay);
+        pbBaked[ui32Panel] = PanelStaticPaint(ui32Panel, &sContext,
+                                              &psRect[ui32Panel]);
+        if(pbBaked[ui32Panel])
+        {
+            pui32Runs[ui32Panel] = SimBakeRunsWrite(psFile, ui32Panel,
+                                                    &psRect[ui32Panel]);
+        }
+    }
+
+    fprintf(psFile, "const tPanelCache g_psPanelCache[] =\n{\n");
+    for(ui32Panel = 0; ui32Panel < SIM_BAKE_PANELS; ui32Panel++)
+    {
+        if(pbBaked[ui32Panel])
+        {
+            fprintf(psFile, "    { %u, { %d, %d, %d, %d }, "
+                    "g_pui16PanelCache%u, %u },\n", ui32Panel,
+                    psRect[ui32Panel].i16XMin, psRect[ui32Panel].i16YMin,
+                    psRect[ui32Panel].i16XMax, psRect[ui32Panel].i16YMax,
+                    ui32Panel, pui32Runs[ui32Panel]);
+        }
+    }
+    fprintf(psFile, "};\n\n"
+            "const uint32_t g_ui32PanelCacheCount =\n"
+            "    sizeof(g_psPanelCache) / sizeof(g_psPanelCache[0]);\n");
+
+    if(fclose(psFile) != 0)
+    {
+        fprintf(stderr, "sim: cannot write %s\n", pcFile);
+        return(false);
+    }
+    if(g_bSimBakeError)
+    {
+        fprintf(stderr, "sim: a static layer draws an image\n");
+        return(false);
+    }
+
+    return(true);
+}
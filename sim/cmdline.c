@@ -0,0 +1,55 @@
+//*****************************************************************************
+//
+// cmdline.c - Host simulator replacement for the TivaWare command line
+//             processor.
+//
+// The line is split in place into words separated by spaces, and the entry
+// of g_psCmdTable named by the first word is run with the words as its
+// arguments, as the TivaWare version does.
+//
+//*****************************************************************************
+
+#include <string.h>
+#include "utils/cmdline.h"
+
+int
+CmdLineProcess(char *pcCmdLine)
+{
+    char *ppcArgv[CMDLINE_MAX_ARGS + 1];
+    tCmdLineEntry *psEntry;
+    int iArgc;
+    char *pcChar;
+
+    iArgc = 0;
+    for(pcChar = pcCmdLine; *pcChar; )
+    {
+        if(*pcChar == ' ')
+        {
+            *pcChar++ = 0;
+            continue;
+        }
+
+        if(iArgc == CMDLINE_MAX_ARGS)
+        {
+            return(CMDLINE_TOO_MANY_ARGS);
+        }
+        ppcArgv[iArgc++] = pcChar;
+        while(*pcChar && (*pcChar != ' '))
+        {
+            pcChar++;
+        }
+    }
+
+    if(iArgc)
+    {
+        for(psEntry = g_psCmdTable; psEntry->pcCmd; psEntry++)
+        {
+            if(!strcmp(ppcArgv[0], psEntry->pcCmd))
+            {
+                return(psEntry->pfnCmd(iArgc, ppcArgv));
+            }
+        }
+    }
+
+    return(CMDLINE_BAD_CMD);
+}
@@ -0,0 +1,72 @@
+//*****************************************************************************
+//
+// draw.c - Measures the drawing of one image.
+//
+// "zc706sim --draw <file>" loads an image written by tools/assets.py, draws
+// it at the top left of the virtual display with the firmware's AssetDraw(),
+// and prints the simulated processor cycles that the draw took.  With --ppm
+// the display is dumped afterwards, for the pipeline to compare against the
+// source image.  Nothing else of the firmware is run.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "grlib/grlib.h"
+#include "Kentec320x240x16_ssd2119_8bit.h"
+#include "rleimage.h"
+#include "assetdraw.h"
+#include "sim.h"
+
+//*****************************************************************************
+//
+// The largest image file that is read.
+//
+//*****************************************************************************
+#define SIM_DRAW_SIZE_MAX       (1024 * 1024)
+
+//*****************************************************************************
+//
+// Draws an image file and prints the cycles it took.  Returns true on
+// success.
+//
+//*****************************************************************************
+bool
+SimDraw(const char *pcImage, const char *pcPPM)
+{
+    tContext sContext;
+    uint64_t ui64Start;
+    uint8_t *pui8Image;
+    size_t szSize;
+    FILE *psFile;
+
+    psFile = fopen(pcImage, "rb");
+    if(!psFile)
+    {
+        fprintf(stderr, "sim: cannot read %s\n", pcImage);
+        return(false);
+    }
+    pui8Image = malloc(SIM_DRAW_SIZE_MAX);
+    szSize = fread(pui8Image, 1, SIM_DRAW_SIZE_MAX, psFile);
+    fclose(psFile);
+    if(szSize < 5)
+    {
+        fprintf(stderr, "sim: %s is not an image\n", pcImage);
+        free(pui8Image);
+        return(false);
+    }
+
+    Kentec320x240x16_SSD2119Init();
+    GrContextInit(&sContext, &g_sKentec320x240x16_SSD2119);
+
+    ui64Start = SimCyclesGet();
+    AssetDraw(&sContext, pui8Image, 0, 0);
+    printf("cycles %llu\n",
+           (unsigned long long)(SimCyclesGet() - ui64Start));
+
+    free(pui8Image);
+
+    return(!pcPPM || SimLCDDump(pcPPM));
+}
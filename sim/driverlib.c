@@ -0,0 +1,1783 @@
+//*****************************************************************************
+//
+// driverlib.c - Host simulator implementation of the driverlib functions used
+//               by the firmware, and the interrupt model.
+//
+// Only the peripherals the firmware relies on are modeled: SysTick, the
+// periodic mode of Timer 0A and Timer 1A, ADC0 sample sequences 0 and 3
+// triggered by Timer 1A, the basic mode uDMA transfers of sequence 0, the
+// receive side of SSI1 and UART0.
+// Everything else is accepted and ignored.
+//
+// Interrupts are raised when simulated time passes an event, which happens on
+// register accesses and in CPUwfi().  A raised interrupt is taken at once
+// unless interrupts are masked, by PRIMASK or BASEPRI, or a handler of the
+// same or a more urgent priority is running; handlers nest by priority as on
+// the NVIC.  Because simulated time only advances with register accesses and
+// sleeps, every run with the same stimulus is identical.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "inc/hw_adc.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_ssi.h"
+#include "inc/hw_timer.h"
+#include "inc/hw_types.h"
+#include "driverlib/adc.h"
+#include "driverlib/cpu.h"
+#include "driverlib/fpu.h"
+#include "driverlib/gpio.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/mpu.h"
+#include "driverlib/ssi.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/systick.h"
+#include "driverlib/timer.h"
+#include "driverlib/uart.h"
+#include "driverlib/udma.h"
+#include "sim.h"
+
+//*****************************************************************************
+//
+// The firmware interrupt handlers, as installed in the CCS vector table.
+//
+//*****************************************************************************
+extern void SysTickIntHandler(void);
+extern void AcquireIntHandler(void);
+extern void TouchScreenIntHandler(void);
+extern void SSI1IntHandler(void);
+extern void SerialIntHandler(void);
+extern void PendSVIntHandler(void);
+
+typedef struct
+{
+    uint32_t ui32Int;
+    void (*pfnHandler)(void);
+}
+tSimVector;
+
+static const tSimVector g_psSimVectors[] =
+{
+    { FAULT_SYSTICK, SysTickIntHandler },
+    { INT_UART0, SerialIntHandler },
+    { INT_ADC0SS0, TouchScreenIntHandler },
+    { INT_ADC0SS3, TouchScreenIntHandler },
+    { INT_TIMER0A, AcquireIntHandler },
+    { INT_SSI1, SSI1IntHandler },
+    { FAULT_PENDSV, PendSVIntHandler },
+};
+
+#define SIM_NUM_VECTORS         (sizeof(g_psSimVectors) /                     \
+                                 sizeof(g_psSimVectors[0]))
+
+//*****************************************************************************
+//
+// The interrupt controller state.  Interrupts are unmasked out of reset, and
+// all of them have priority 0.  The execution priority is the group priority
+// of the handler running, or SIM_PRIORITY_THREAD when none is.  Out of reset
+// all three priority bits are group priority bits, as on the NVIC.
+//
+//*****************************************************************************
+#define SIM_PRIORITY_THREAD     0x100
+#define SIM_PRIORITY_MASK       0xe0
+
+static bool g_bSimMasked;
+static uint32_t g_ui32SimBasepri;
+static uint32_t g_ui32SimPreemptMask = SIM_PRIORITY_MASK;
+static uint32_t g_ui32SimActive = SIM_PRIORITY_THREAD;
+static bool g_pbSimIntEnabled[NUM_INTERRUPTS];
+static bool g_pbSimIntPending[NUM_INTERRUPTS];
+static uint8_t g_pui8SimIntPriority[NUM_INTERRUPTS];
+
+//*****************************************************************************
+//
+// The cycles taken to enter and leave an interrupt handler.
+//
+//*****************************************************************************
+#define SIM_CYCLES_PER_INT      24
+
+//*****************************************************************************
+//
+// The time of the next peripheral event.
+//
+//*****************************************************************************
+static uint64_t g_ui64SimNextEvent;
+
+//*****************************************************************************
+//
+// SysTick.
+//
+//*****************************************************************************
+static bool g_bSimTickEnabled;
+static bool g_bSimTickIntEnabled;
+static uint32_t g_ui32SimTickPeriod = 0x01000000;
+static uint64_t g_ui64SimTickNext;
+
+//*****************************************************************************
+//
+// The general purpose timers.  Only the A half of Timer 0 and Timer 1 is
+// modeled.  Configured as a split pair, the A half is a 16-bit timer; its
+// prescaler is not modeled.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ui32Base;
+    uint32_t ui32Int;
+    bool bEnabled;
+    bool bIntEnabled;
+    bool bTrigger;
+    uint32_t ui32Load;
+    uint64_t ui64Next;
+    bool bSplit;
+}
+tSimTimer;
+
+static tSimTimer g_psSimTimers[] =
+{
+    { TIMER0_BASE, INT_TIMER0A, false, false, false, 0xffffffff, 0 },
+    { TIMER1_BASE, INT_TIMER1A, false, false, false, 0xffffffff, 0 },
+};
+
+#define SIM_NUM_TIMERS          (sizeof(g_psSimTimers) /                      \
+                                 sizeof(g_psSimTimers[0]))
+
+//*****************************************************************************
+//
+// ADC0 sample sequences 0 and 3 and the touch screen connected to them.  Only
+// sequence 3 has a FIFO; the readings of sequence 0 are taken by the uDMA.
+//
+//*****************************************************************************
+#define SIM_ADC_NUM_SEQS        4
+
+static bool g_pbSimADCEnabled[SIM_ADC_NUM_SEQS];
+static bool g_pbSimADCIntEnabled[SIM_ADC_NUM_SEQS];
+static bool g_pbSimADCDMAEnabled[SIM_ADC_NUM_SEQS];
+static uint32_t g_ui32SimADCFIFO;
+static bool g_bSimADCFIFOFull;
+
+static bool g_bSimTouchDown;
+static uint32_t g_ui32SimTouchRawX;
+static uint32_t g_ui32SimTouchRawY;
+
+//*****************************************************************************
+//
+// The uDMA channels.  A transfer moves one item per request of the peripheral
+// of the channel; when the last item is moved the channel stops.
+//
+//*****************************************************************************
+#define SIM_DMA_NUM_CHANNELS    32
+
+typedef struct
+{
+    bool bEnabled;
+    uint32_t ui32Control;
+    uint32_t ui32Mode;
+    uint8_t *pui8Dst;
+    uint32_t ui32Remaining;
+}
+tSimDMAChannel;
+
+static tSimDMAChannel g_psSimDMAChannels[SIM_DMA_NUM_CHANNELS];
+
+//*****************************************************************************
+//
+// The calibration of the touch screen driver, which is inverted to produce
+// the raw readings of a touch at a given screen position.
+//
+//*****************************************************************************
+extern const int32_t g_lTouchParameters[][7];
+
+//*****************************************************************************
+//
+// The SSI1 receive FIFO.
+//
+//*****************************************************************************
+#define SIM_SSI_FIFO_SIZE       8
+
+static uint16_t g_pui16SimSSIFIFO[SIM_SSI_FIFO_SIZE];
+static uint32_t g_ui32SimSSIRead;
+static uint32_t g_ui32SimSSICount;
+static uint32_t g_ui32SimSSIIntMask;
+static uint32_t g_ui32SimSSIOverruns;
+static bool g_bSimSSIOverrun;
+
+//*****************************************************************************
+//
+// The UART0 transmit FIFO.  A byte is written to the UART output file when it
+// enters the FIFO and leaves the FIFO one character time, ten bits at the
+// configured baud rate, after the byte ahead of it.  The transmit interrupt
+// is raised when the FIFO drains to the level set by UARTFIFOLevelSet().
+//
+//*****************************************************************************
+#define SIM_UART_FIFO_SIZE      16
+
+static uint32_t g_ui32SimUARTCount;
+static uint64_t g_ui64SimUARTNext;
+static uint32_t g_ui32SimUARTCharCycles = (SIM_CLOCK_HZ / 115200) * 10;
+static uint32_t g_ui32SimUARTTxLevel = 2;
+static uint32_t g_ui32SimUARTIntMask;
+static uint32_t g_ui32SimUARTIntStatus;
+
+//*****************************************************************************
+//
+// The UART0 receive side.  Text typed by the stimulus is queued and arrives
+// in the receive FIFO one character time apart.  The receive interrupt is
+// raised when the FIFO fills to its level, and the receive time-out interrupt
+// when characters have waited in the FIFO for four character times, about
+// the 32 bit times of the hardware, without another one arriving.
+//
+//*****************************************************************************
+#define SIM_UART_INPUT_SIZE     1024
+
+static char g_pcSimUARTInput[SIM_UART_INPUT_SIZE];
+static uint32_t g_ui32SimUARTInputRead;
+static uint32_t g_ui32SimUARTInputWrite;
+static uint64_t g_ui64SimUARTRxNext;
+static uint64_t g_ui64SimUARTRxTimeout;
+static uint8_t g_pui8SimUARTRxFIFO[SIM_UART_FIFO_SIZE];
+static uint32_t g_ui32SimUARTRxRead;
+static uint32_t g_ui32SimUARTRxCount;
+static uint32_t g_ui32SimUARTRxLevel = 8;
+
+//*****************************************************************************
+//
+// Returns true if an interrupt is enabled.  System exceptions, such as
+// SysTick, are not gated by the NVIC enable registers.
+//
+//*****************************************************************************
+static bool
+SimInterruptEnabled(uint32_t ui32Int)
+{
+    return((ui32Int < INT_GPIOA) || g_pbSimIntEnabled[ui32Int]);
+}
+
+//*****************************************************************************
+//
+// Returns the vector of the pending interrupt that would preempt the code
+// running now, ignoring PRIMASK, or -1 if there is none.  Only the group
+// priority bits take part in preemption and in the BASEPRI mask.  Of the
+// pending interrupts that preempt, the one with the most urgent priority is
+// taken, and of those with equal priority the one with the lowest exception
+// number, as the NVIC does.
+//
+//*****************************************************************************
+static int32_t
+SimInterruptNext(void)
+{
+    uint32_t ui32Idx, ui32Int, ui32Priority, ui32Level, ui32Best;
+    int32_t i32Vector;
+
+    ui32Level = g_ui32SimActive;
+    if(g_ui32SimBasepri &&
+       ((g_ui32SimBasepri & g_ui32SimPreemptMask) < ui32Level))
+    {
+        ui32Level = g_ui32SimBasepri & g_ui32SimPreemptMask;
+    }
+
+    ui32Best = SIM_PRIORITY_THREAD;
+    i32Vector = -1;
+    for(ui32Idx = 0; ui32Idx < SIM_NUM_VECTORS; ui32Idx++)
+    {
+        ui32Int = g_psSimVectors[ui32Idx].ui32Int;
+        ui32Priority = g_pui8SimIntPriority[ui32Int];
+        if(g_pbSimIntPending[ui32Int] && SimInterruptEnabled(ui32Int) &&
+           ((ui32Priority & g_ui32SimPreemptMask) < ui32Level) &&
+           ((ui32Priority < ui32Best) ||
+            ((ui32Priority == ui32Best) &&
+             (ui32Int < g_psSimVectors[i32Vector].ui32Int))))
+        {
+            ui32Best = ui32Priority;
+            i32Vector = ui32Idx;
+        }
+    }
+
+    return(i32Vector);
+}
+
+//*****************************************************************************
+//
+// Takes the pending interrupts that preempt the code running now.  A handler
+// is preempted in turn, from the register accesses it makes, by interrupts of
+// a more urgent priority.
+//
+//*****************************************************************************
+static void
+SimInterruptsService(void)
+{
+    uint32_t ui32Int, ui32Was;
+    int32_t i32Vector;
+
+    while(!g_bSimMasked && ((i32Vector = SimInterruptNext()) >= 0))
+    {
+        ui32Int = g_psSimVectors[i32Vector].ui32Int;
+        g_pbSimIntPending[ui32Int] = false;
+        ui32Was = g_ui32SimActive;
+        g_ui32SimActive = (g_pui8SimIntPriority[ui32Int] &
+                           g_ui32SimPreemptMask);
+        SimCyclesAdvance(SIM_CYCLES_PER_INT);
+        g_psSimVectors[i32Vector].pfnHandler();
+        SimRegisterFlush();
+        g_ui32SimActive = ui32Was;
+
+        //
+        // The receive time-out asserts again for as long as words are left
+        // in the SSI1 FIFO.
+        //
+        if((ui32Int == INT_SSI1) && g_ui32SimSSICount &&
+           (g_ui32SimSSIIntMask & SSI_RXTO))
+        {
+            g_pbSimIntPending[INT_SSI1] = true;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Returns true if an enabled interrupt is pending that would preempt the code
+// running now, which is what ends a wait for interrupt.
+//
+//*****************************************************************************
+static bool
+SimInterruptPending(void)
+{
+    return(SimInterruptNext() >= 0);
+}
+
+//*****************************************************************************
+//
+// Moves one item for a request of the peripheral of a uDMA channel.  Returns
+// true if that was the last item of the transfer.
+//
+//*****************************************************************************
+static bool
+SimDMARequest(uint32_t ui32Channel, uint32_t ui32Value)
+{
+    tSimDMAChannel *psChannel;
+    uint32_t ui32Size;
+
+    psChannel = &g_psSimDMAChannels[ui32Channel];
+    if(!psChannel->bEnabled || (psChannel->ui32Mode == UDMA_MODE_STOP))
+    {
+        return(false);
+    }
+
+    //
+    // The destination item size is in bits 29:28 of the control word.
+    //
+    ui32Size = 1 << ((psChannel->ui32Control >> 28) & 3);
+    if(ui32Size == 4)
+    {
+        *(uint32_t *)psChannel->pui8Dst = ui32Value;
+    }
+    else if(ui32Size == 2)
+    {
+        *(uint16_t *)psChannel->pui8Dst = ui32Value;
+    }
+    else
+    {
+        *psChannel->pui8Dst = ui32Value;
+    }
+    psChannel->pui8Dst += ui32Size;
+
+    if(--psChannel->ui32Remaining == 0)
+    {
+        psChannel->ui32Mode = UDMA_MODE_STOP;
+        psChannel->bEnabled = false;
+        return(true);
+    }
+
+    return(false);
+}
+
+//*****************************************************************************
+//
+// Returns the reading of an ADC input.  The touch screen driver drives one
+// layer and samples the other: the YP input gives the X reading and the XP
+// input the Y reading.  With the screen untouched both read as zero.
+//
+//*****************************************************************************
+static uint32_t
+SimADCSample(uint32_t ui32Channel)
+{
+    if(!g_bSimTouchDown)
+    {
+        return(0);
+    }
+
+    return((ui32Channel == ADC_CTL_CH8) ? g_ui32SimTouchRawX :
+           g_ui32SimTouchRawY);
+}
+
+//*****************************************************************************
+//
+// Performs a timer triggered conversion of the enabled ADC0 sequences.  The
+// inputs are selected through SSMUX0 and SSMUX3, one nibble per step, and the
+// end of sequence 0 is the first step whose SSCTL0 nibble has the END bit.
+// Sequence 0 interrupts at its end if the last step has the IE bit, and also
+// when the uDMA has moved its last reading.
+//
+//*****************************************************************************
+static void
+SimADCConvert(void)
+{
+    uint32_t ui32Mux, ui32Ctl, ui32Step;
+    bool bInt;
+
+    if(g_pbSimADCEnabled[3])
+    {
+        g_ui32SimADCFIFO =
+            SimADCSample(SimRegisterGet(ADC0_BASE + ADC_O_SSMUX3) & 0xf);
+        g_bSimADCFIFOFull = true;
+
+        if(g_pbSimADCIntEnabled[3])
+        {
+            g_pbSimIntPending[INT_ADC0SS3] = true;
+        }
+    }
+
+    if(g_pbSimADCEnabled[0])
+    {
+        ui32Mux = SimRegisterGet(ADC0_BASE + ADC_O_SSMUX0);
+        ui32Ctl = SimRegisterGet(ADC0_BASE + ADC_O_SSCTL0);
+        bInt = false;
+
+        for(ui32Step = 0; ui32Step < 8; ui32Step++)
+        {
+            if(g_pbSimADCDMAEnabled[0] &&
+               SimDMARequest(UDMA_CHANNEL_ADC0,
+                             SimADCSample((ui32Mux >> (ui32Step * 4)) & 0xf)))
+            {
+                bInt = true;
+            }
+            if((ui32Ctl >> (ui32Step * 4)) & (ADC_CTL_END >> 4))
+            {
+                bInt |= ((ui32Ctl >> (ui32Step * 4)) & (ADC_CTL_IE >> 4)) != 0;
+                break;
+            }
+        }
+
+        if(bInt && g_pbSimADCIntEnabled[0])
+        {
+            g_pbSimIntPending[INT_ADC0SS0] = true;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Raises UART0 interrupt sources.
+//
+//*****************************************************************************
+static void
+SimUARTIntRaise(uint32_t ui32Flags)
+{
+    g_ui32SimUARTIntStatus |= ui32Flags;
+    if(g_ui32SimUARTIntMask & ui32Flags)
+    {
+        g_pbSimIntPending[INT_UART0] = true;
+    }
+}
+
+//*****************************************************************************
+//
+// Puts a received character into the UART0 receive FIFO, losing it if the
+// FIFO is full.
+//
+//*****************************************************************************
+static void
+SimUARTReceive(char cChar)
+{
+    if(g_ui32SimUARTRxCount == SIM_UART_FIFO_SIZE)
+    {
+        return;
+    }
+
+    g_pui8SimUARTRxFIFO[(g_ui32SimUARTRxRead + g_ui32SimUARTRxCount) %
+                        SIM_UART_FIFO_SIZE] = cChar;
+    g_ui32SimUARTRxCount++;
+    if(g_ui32SimUARTRxCount == g_ui32SimUARTRxLevel)
+    {
+        SimUARTIntRaise(UART_INT_RX);
+    }
+}
+
+//*****************************************************************************
+//
+// Recomputes the time of the next event.
+//
+//*****************************************************************************
+static void
+SimNextEventUpdate(void)
+{
+    uint64_t ui64Next;
+    uint32_t ui32Idx;
+
+    ui64Next = SimStimulusNextGet();
+    if(g_ui32SimUARTCount && (g_ui64SimUARTNext < ui64Next))
+    {
+        ui64Next = g_ui64SimUARTNext;
+    }
+    if((g_ui32SimUARTInputRead != g_ui32SimUARTInputWrite) &&
+       (g_ui64SimUARTRxNext < ui64Next))
+    {
+        ui64Next = g_ui64SimUARTRxNext;
+    }
+    if(g_ui64SimUARTRxTimeout && (g_ui64SimUARTRxTimeout < ui64Next))
+    {
+        ui64Next = g_ui64SimUARTRxTimeout;
+    }
+    if(g_bSimTickEnabled && (g_ui64SimTickNext < ui64Next))
+    {
+        ui64Next = g_ui64SimTickNext;
+    }
+    for(ui32Idx = 0; ui32Idx < SIM_NUM_TIMERS; ui32Idx++)
+    {
+        if(g_psSimTimers[ui32Idx].bEnabled &&
+           (g_psSimTimers[ui32Idx].ui64Next < ui64Next))
+        {
+            ui64Next = g_psSimTimers[ui32Idx].ui64Next;
+        }
+    }
+
+    g_ui64SimNextEvent = ui64Next;
+}
+
+//*****************************************************************************
+//
+// Raises the events that are due.
+//
+//*****************************************************************************
+static void
+SimEventsRaise(void)
+{
+    tSimTimer *psTimer;
+    uint64_t ui64Now;
+    uint32_t ui32Idx;
+
+    ui64Now = SimCyclesGet();
+
+    while(g_bSimTickEnabled && (g_ui64SimTickNext <= ui64Now))
+    {
+        g_ui64SimTickNext += g_ui32SimTickPeriod;
+        if(g_bSimTickIntEnabled)
+        {
+            g_pbSimIntPending[FAULT_SYSTICK] = true;
+        }
+        SimFrameMark();
+    }
+
+    for(ui32Idx = 0; ui32Idx < SIM_NUM_TIMERS; ui32Idx++)
+    {
+        psTimer = &g_psSimTimers[ui32Idx];
+        while(psTimer->bEnabled && (psTimer->ui64Next <= ui64Now))
+        {
+            psTimer->ui64Next += (uint64_t)psTimer->ui32Load + 1;
+            if(psTimer->bIntEnabled)
+            {
+                g_pbSimIntPending[psTimer->ui32Int] = true;
+            }
+            if(psTimer->bTrigger)
+            {
+                SimADCConvert();
+            }
+        }
+    }
+
+    while(g_ui32SimUARTCount && (g_ui64SimUARTNext <= ui64Now))
+    {
+        g_ui32SimUARTCount--;
+        g_ui64SimUARTNext += g_ui32SimUARTCharCycles;
+        if(g_ui32SimUARTCount == g_ui32SimUARTTxLevel)
+        {
+            SimUARTIntRaise(UART_INT_TX);
+        }
+    }
+
+    while((g_ui32SimUARTInputRead != g_ui32SimUARTInputWrite) &&
+          (g_ui64SimUARTRxNext <= ui64Now))
+    {
+        SimUARTReceive(g_pcSimUARTInput[g_ui32SimUARTInputRead++]);
+        g_ui64SimUARTRxTimeout = (g_ui64SimUARTRxNext +
+                                  (4 * g_ui32SimUARTCharCycles));
+        g_ui64SimUARTRxNext += g_ui32SimUARTCharCycles;
+    }
+    if(g_ui64SimUARTRxTimeout && (g_ui64SimUARTRxTimeout <= ui64Now))
+    {
+        g_ui64SimUARTRxTimeout = 0;
+        if(g_ui32SimUARTRxCount)
+        {
+            SimUARTIntRaise(UART_INT_RT);
+        }
+    }
+
+    SimStimulusRun(ui64Now, false);
+
+    SimNextEventUpdate();
+}
+
+//*****************************************************************************
+//
+// Called on every register access: raises the events that are due and takes
+// the interrupts they cause.
+//
+//*****************************************************************************
+void
+SimEventsPoll(void)
+{
+    if(SimCyclesGet() >= g_ui64SimNextEvent)
+    {
+        SimEventsRaise();
+    }
+
+    SimInterruptsService();
+}
+
+//*****************************************************************************
+//
+// Handles the registers that have side effects when read.  Returns true, with
+// the value, if the register is one of them.
+//
+//*****************************************************************************
+bool
+SimRegisterRead(uint32_t ui32Addr, volatile uint32_t *pui32Value)
+{
+    if(ui32Addr == (ADC0_BASE + ADC_O_SSFIFO3))
+    {
+        *pui32Value = g_ui32SimADCFIFO;
+        g_bSimADCFIFOFull = false;
+        return(true);
+    }
+
+    if(ui32Addr == (SSI1_BASE + SSI_O_DR))
+    {
+        if(g_ui32SimSSICount)
+        {
+            *pui32Value = g_pui16SimSSIFIFO[g_ui32SimSSIRead];
+            g_ui32SimSSIRead = (g_ui32SimSSIRead + 1) % SIM_SSI_FIFO_SIZE;
+            g_ui32SimSSICount--;
+        }
+        else
+        {
+            *pui32Value = 0;
+        }
+        return(true);
+    }
+
+    return(false);
+}
+
+//*****************************************************************************
+//
+// Receives words on SSI1 as if clocked in by the ZC706.  Words that do not
+// fit in the receive FIFO are lost, counted as overruns and flagged in the
+// raw interrupt status.  The receive timeout interrupt is raised once the
+// words are in.
+//
+//*****************************************************************************
+void
+SimSSIFramePut(const uint16_t *pui16Words, uint32_t ui32Count)
+{
+    while(ui32Count--)
+    {
+        if(g_ui32SimSSICount == SIM_SSI_FIFO_SIZE)
+        {
+            g_ui32SimSSIOverruns++;
+            g_bSimSSIOverrun = true;
+            pui16Words++;
+            continue;
+        }
+        g_pui16SimSSIFIFO[(g_ui32SimSSIRead + g_ui32SimSSICount) %
+                          SIM_SSI_FIFO_SIZE] = *pui16Words++;
+        g_ui32SimSSICount++;
+    }
+
+    if(g_ui32SimSSIIntMask & SSI_RXTO)
+    {
+        g_pbSimIntPending[INT_SSI1] = true;
+    }
+}
+
+//*****************************************************************************
+//
+// Presses the touch screen at a screen position, or releases it.  The raw
+// readings are found by solving the driver's calibration equations
+//
+//     x = (rx * M0 + ry * M1 + M2) / M6
+//     y = (rx * M3 + ry * M4 + M5) / M6
+//
+// for rx and ry.
+//
+//*****************************************************************************
+void
+SimTouchSet(bool bDown, int32_t i32X, int32_t i32Y)
+{
+    const int32_t *pi32M;
+    double dDet, dA, dB;
+
+    g_bSimTouchDown = bDown;
+    if(!bDown)
+    {
+        return;
+    }
+
+    pi32M = g_lTouchParameters[0];
+    dA = ((double)i32X + 0.5) * pi32M[6] - pi32M[2];
+    dB = ((double)i32Y + 0.5) * pi32M[6] - pi32M[5];
+    dDet = ((double)pi32M[0] * pi32M[4]) - ((double)pi32M[1] * pi32M[3]);
+
+    g_ui32SimTouchRawX = (uint32_t)(((dA * pi32M[4]) - (dB * pi32M[1])) /
+                                    dDet + 0.5);
+    g_ui32SimTouchRawY = (uint32_t)(((dB * pi32M[0]) - (dA * pi32M[3])) /
+                                    dDet + 0.5);
+}
+
+//*****************************************************************************
+//
+// The number of SSI1 receive overruns.
+//
+//*****************************************************************************
+uint32_t
+SimSSIOverrunsGet(void)
+{
+    return(g_ui32SimSSIOverruns);
+}
+
+//*****************************************************************************
+//
+// Processor.
+//
+//*****************************************************************************
+uint32_t
+CPUcpsid(void)
+{
+    bool bWas = g_bSimMasked;
+
+    g_bSimMasked = true;
+    return(bWas);
+}
+
+uint32_t
+CPUcpsie(void)
+{
+    bool bWas = g_bSimMasked;
+
+    g_bSimMasked = false;
+    SimInterruptsService();
+    return(bWas);
+}
+
+uint32_t
+CPUprimask(void)
+{
+    return(g_bSimMasked);
+}
+
+//*****************************************************************************
+//
+// Waits for an interrupt.  Simulated time jumps to the next event; as on the
+// processor, a pending interrupt ends the wait even while interrupts are
+// masked, and is taken once they are unmasked.  The stimulus actions that
+// inspect the display run here, when the firmware has nothing left to draw.
+//
+//*****************************************************************************
+void
+CPUwfi(void)
+{
+    SimRegisterFlush();
+
+    while(!SimInterruptPending())
+    {
+        SimStimulusRun(SimCyclesGet(), true);
+
+        if(g_ui64SimNextEvent > SimCyclesGet())
+        {
+            SimCyclesAdvance(g_ui64SimNextEvent - SimCyclesGet());
+        }
+        SimEventsRaise();
+    }
+
+    SimInterruptsService();
+}
+
+uint32_t
+CPUbasepriGet(void)
+{
+    return(g_ui32SimBasepri);
+}
+
+void
+CPUbasepriSet(uint32_t ui32NewBasepri)
+{
+    g_ui32SimBasepri = ui32NewBasepri & SIM_PRIORITY_MASK;
+    SimInterruptsService();
+}
+
+//*****************************************************************************
+//
+// Interrupt controller.
+//
+//*****************************************************************************
+bool
+IntMasterEnable(void)
+{
+    return(CPUcpsie());
+}
+
+bool
+IntMasterDisable(void)
+{
+    return(CPUcpsid());
+}
+
+void
+IntEnable(uint32_t ui32Interrupt)
+{
+    if(ui32Interrupt < NUM_INTERRUPTS)
+    {
+        g_pbSimIntEnabled[ui32Interrupt] = true;
+    }
+}
+
+void
+IntDisable(uint32_t ui32Interrupt)
+{
+    if(ui32Interrupt < NUM_INTERRUPTS)
+    {
+        g_pbSimIntEnabled[ui32Interrupt] = false;
+    }
+}
+
+uint32_t
+IntIsEnabled(uint32_t ui32Interrupt)
+{
+    return((ui32Interrupt < NUM_INTERRUPTS) &&
+           g_pbSimIntEnabled[ui32Interrupt]);
+}
+
+void
+IntPendSet(uint32_t ui32Interrupt)
+{
+    if(ui32Interrupt < NUM_INTERRUPTS)
+    {
+        g_pbSimIntPending[ui32Interrupt] = true;
+        SimInterruptsService();
+    }
+}
+
+void
+IntPendClear(uint32_t ui32Interrupt)
+{
+    if(ui32Interrupt < NUM_INTERRUPTS)
+    {
+        g_pbSimIntPending[ui32Interrupt] = false;
+    }
+}
+
+void
+IntPriorityGroupingSet(uint32_t ui32Bits)
+{
+    g_ui32SimPreemptMask = (0xff << (8 - ((ui32Bits > 8) ? 8 : ui32Bits))) &
+                           SIM_PRIORITY_MASK;
+}
+
+uint32_t
+IntPriorityGroupingGet(void)
+{
+    uint32_t ui32Bits;
+
+    for(ui32Bits = 0; ui32Bits < 3; ui32Bits++)
+    {
+        if(g_ui32SimPreemptMask == ((0xff << (8 - ui32Bits)) &
+                                    SIM_PRIORITY_MASK))
+        {
+            break;
+        }
+    }
+    return(ui32Bits);
+}
+
+void
+IntPrioritySet(uint32_t ui32Interrupt, uint8_t ui8Priority)
+{
+    if(ui32Interrupt < NUM_INTERRUPTS)
+    {
+        g_pui8SimIntPriority[ui32Interrupt] = ui8Priority & SIM_PRIORITY_MASK;
+    }
+}
+
+int32_t
+IntPriorityGet(uint32_t ui32Interrupt)
+{
+    if(ui32Interrupt < NUM_INTERRUPTS)
+    {
+        return(g_pui8SimIntPriority[ui32Interrupt]);
+    }
+    return(-1);
+}
+
+void
+IntPriorityMaskSet(uint32_t ui32PriorityMask)
+{
+    CPUbasepriSet(ui32PriorityMask);
+}
+
+uint32_t
+IntPriorityMaskGet(void)
+{
+    return(CPUbasepriGet());
+}
+
+//*****************************************************************************
+//
+// System control.
+//
+//*****************************************************************************
+void
+SysCtlClockSet(uint32_t ui32Config)
+{
+}
+
+uint32_t
+SysCtlClockGet(void)
+{
+    return(SIM_CLOCK_HZ);
+}
+
+void
+SysCtlPeripheralEnable(uint32_t ui32Peripheral)
+{
+}
+
+void
+SysCtlPeripheralDisable(uint32_t ui32Peripheral)
+{
+}
+
+void
+SysCtlPeripheralReset(uint32_t ui32Peripheral)
+{
+}
+
+bool
+SysCtlPeripheralReady(uint32_t ui32Peripheral)
+{
+    return(true);
+}
+
+void
+SysCtlPeripheralSleepEnable(uint32_t ui32Peripheral)
+{
+}
+
+void
+SysCtlPeripheralClockGating(bool bEnable)
+{
+}
+
+void
+SysCtlDelay(uint32_t ui32Count)
+{
+    SimCyclesAdvance((uint64_t)ui32Count * 3);
+    SimEventsPoll();
+}
+
+void
+SysCtlSleep(void)
+{
+    CPUwfi();
+}
+
+//*****************************************************************************
+//
+// SysTick.
+//
+//*****************************************************************************
+void
+SysTickEnable(void)
+{
+    g_bSimTickEnabled = true;
+    g_ui64SimTickNext = SimCyclesGet() + g_ui32SimTickPeriod;
+    SimNextEventUpdate();
+}
+
+void
+SysTickDisable(void)
+{
+    g_bSimTickEnabled = false;
+}
+
+void
+SysTickIntEnable(void)
+{
+    g_bSimTickIntEnabled = true;
+}
+
+void
+SysTickIntDisable(void)
+{
+    g_bSimTickIntEnabled = false;
+}
+
+void
+SysTickPeriodSet(uint32_t ui32Period)
+{
+    g_ui32SimTickPeriod = ui32Period;
+}
+
+uint32_t
+SysTickPeriodGet(void)
+{
+    return(g_ui32SimTickPeriod);
+}
+
+uint32_t
+SysTickValueGet(void)
+{
+    if(!g_bSimTickEnabled)
+    {
+        return(0);
+    }
+    return((uint32_t)(g_ui64SimTickNext - SimCyclesGet()) - 1);
+}
+
+//*****************************************************************************
+//
+// General purpose timers.
+//
+//*****************************************************************************
+static tSimTimer *
+SimTimerGet(uint32_t ui32Base)
+{
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < SIM_NUM_TIMERS; ui32Idx++)
+    {
+        if(g_psSimTimers[ui32Idx].ui32Base == ui32Base)
+        {
+            return(&g_psSimTimers[ui32Idx]);
+        }
+    }
+
+    return(0);
+}
+
+void
+TimerEnable(uint32_t ui32Base, uint32_t ui32Timer)
+{
+    tSimTimer *psTimer;
+
+    HWREG(ui32Base + TIMER_O_CTL) |= ui32Timer & (TIMER_CTL_TAEN |
+                                                  TIMER_CTL_TBEN);
+
+    psTimer = SimTimerGet(ui32Base);
+    if(psTimer && (ui32Timer & TIMER_A))
+    {
+        psTimer->bEnabled = true;
+        psTimer->ui64Next = SimCyclesGet() + (uint64_t)psTimer->ui32Load + 1;
+        SimNextEventUpdate();
+    }
+}
+
+void
+TimerDisable(uint32_t ui32Base, uint32_t ui32Timer)
+{
+    tSimTimer *psTimer;
+
+    HWREG(ui32Base + TIMER_O_CTL) &= ~(ui32Timer & (TIMER_CTL_TAEN |
+                                                    TIMER_CTL_TBEN));
+
+    psTimer = SimTimerGet(ui32Base);
+    if(psTimer && (ui32Timer & TIMER_A))
+    {
+        psTimer->bEnabled = false;
+    }
+}
+
+void
+TimerConfigure(uint32_t ui32Base, uint32_t ui32Config)
+{
+    tSimTimer *psTimer;
+
+    HWREG(ui32Base + TIMER_O_CTL) = 0;
+
+    psTimer = SimTimerGet(ui32Base);
+    if(psTimer)
+    {
+        psTimer->bSplit = (ui32Config & TIMER_CFG_SPLIT_PAIR) != 0;
+    }
+}
+
+void
+TimerControlTrigger(uint32_t ui32Base, uint32_t ui32Timer, bool bEnable)
+{
+    tSimTimer *psTimer;
+
+    psTimer = SimTimerGet(ui32Base);
+    if(psTimer && (ui32Timer & TIMER_A))
+    {
+        psTimer->bTrigger = bEnable;
+    }
+}
+
+void
+TimerControlStall(uint32_t ui32Base, uint32_t ui32Timer, bool bStall)
+{
+}
+
+void
+TimerLoadSet(uint32_t ui32Base, uint32_t ui32Timer, uint32_t ui32Value)
+{
+    tSimTimer *psTimer;
+
+    psTimer = SimTimerGet(ui32Base);
+    if(psTimer && (ui32Timer & TIMER_A))
+    {
+        psTimer->ui32Load = psTimer->bSplit ? (ui32Value & 0xffff) : ui32Value;
+    }
+}
+
+uint32_t
+TimerLoadGet(uint32_t ui32Base, uint32_t ui32Timer)
+{
+    tSimTimer *psTimer;
+
+    psTimer = SimTimerGet(ui32Base);
+    return(psTimer ? psTimer->ui32Load : 0);
+}
+
+uint32_t
+TimerValueGet(uint32_t ui32Base, uint32_t ui32Timer)
+{
+    tSimTimer *psTimer;
+
+    psTimer = SimTimerGet(ui32Base);
+    if(!psTimer || !psTimer->bEnabled)
+    {
+        return(0);
+    }
+    return((uint32_t)(psTimer->ui64Next - SimCyclesGet()) - 1);
+}
+
+void
+TimerIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    tSimTimer *psTimer;
+
+    psTimer = SimTimerGet(ui32Base);
+    if(psTimer && (ui32IntFlags & TIMER_TIMA_TIMEOUT))
+    {
+        psTimer->bIntEnabled = true;
+    }
+}
+
+void
+TimerIntDisable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    tSimTimer *psTimer;
+
+    psTimer = SimTimerGet(ui32Base);
+    if(psTimer && (ui32IntFlags & TIMER_TIMA_TIMEOUT))
+    {
+        psTimer->bIntEnabled = false;
+    }
+}
+
+uint32_t
+TimerIntStatus(uint32_t ui32Base, bool bMasked)
+{
+    return(0);
+}
+
+void
+TimerIntClear(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    HWREG(ui32Base + TIMER_O_ICR) = ui32IntFlags;
+}
+
+//*****************************************************************************
+//
+// ADC.
+//
+//*****************************************************************************
+void
+ADCSequenceConfigure(uint32_t ui32Base, uint32_t ui32SequenceNum,
+                     uint32_t ui32Trigger, uint32_t ui32Priority)
+{
+}
+
+void
+ADCSequenceStepConfigure(uint32_t ui32Base, uint32_t ui32SequenceNum,
+                         uint32_t ui32Step, uint32_t ui32Config)
+{
+    uint32_t ui32Shift;
+
+    if((ui32Base == ADC0_BASE) && (ui32SequenceNum == 3))
+    {
+        HWREG(ui32Base + ADC_O_SSMUX3) = ui32Config & 0xf;
+    }
+    else if((ui32Base == ADC0_BASE) && (ui32SequenceNum == 0))
+    {
+        ui32Shift = ui32Step * 4;
+        SimRegisterSet(ui32Base + ADC_O_SSMUX0,
+                       ((SimRegisterGet(ui32Base + ADC_O_SSMUX0) &
+                         ~(0xf << ui32Shift)) |
+                        ((ui32Config & 0xf) << ui32Shift)));
+        SimRegisterSet(ui32Base + ADC_O_SSCTL0,
+                       ((SimRegisterGet(ui32Base + ADC_O_SSCTL0) &
+                         ~(0xf << ui32Shift)) |
+                        (((ui32Config & 0xf0) >> 4) << ui32Shift)));
+    }
+}
+
+void
+ADCSequenceEnable(uint32_t ui32Base, uint32_t ui32SequenceNum)
+{
+    if((ui32Base == ADC0_BASE) && (ui32SequenceNum < SIM_ADC_NUM_SEQS))
+    {
+        g_pbSimADCEnabled[ui32SequenceNum] = true;
+    }
+}
+
+void
+ADCSequenceDisable(uint32_t ui32Base, uint32_t ui32SequenceNum)
+{
+    if((ui32Base == ADC0_BASE) && (ui32SequenceNum < SIM_ADC_NUM_SEQS))
+    {
+        g_pbSimADCEnabled[ui32SequenceNum] = false;
+    }
+}
+
+void
+ADCSequenceDMAEnable(uint32_t ui32Base, uint32_t ui32SequenceNum)
+{
+    if((ui32Base == ADC0_BASE) && (ui32SequenceNum < SIM_ADC_NUM_SEQS))
+    {
+        g_pbSimADCDMAEnabled[ui32SequenceNum] = true;
+    }
+}
+
+void
+ADCHardwareOversampleConfigure(uint32_t ui32Base, uint32_t ui32Factor)
+{
+}
+
+void
+ADCIntEnable(uint32_t ui32Base, uint32_t ui32SequenceNum)
+{
+    if((ui32Base == ADC0_BASE) && (ui32SequenceNum < SIM_ADC_NUM_SEQS))
+    {
+        g_pbSimADCIntEnabled[ui32SequenceNum] = true;
+    }
+}
+
+void
+ADCIntDisable(uint32_t ui32Base, uint32_t ui32SequenceNum)
+{
+    if((ui32Base == ADC0_BASE) && (ui32SequenceNum < SIM_ADC_NUM_SEQS))
+    {
+        g_pbSimADCIntEnabled[ui32SequenceNum] = false;
+    }
+}
+
+void
+ADCIntEnableEx(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+}
+
+void
+ADCIntClear(uint32_t ui32Base, uint32_t ui32SequenceNum)
+{
+    HWREG(ui32Base + ADC_O_ISC) = 1 << ui32SequenceNum;
+}
+
+void
+ADCIntClearEx(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+}
+
+uint32_t
+ADCIntStatusEx(uint32_t ui32Base, bool bMasked)
+{
+    return(0);
+}
+
+int32_t
+ADCSequenceDataGet(uint32_t ui32Base, uint32_t ui32SequenceNum,
+                   uint32_t *pui32Buffer)
+{
+    if(!g_bSimADCFIFOFull)
+    {
+        return(0);
+    }
+    *pui32Buffer = HWREG(ui32Base + ADC_O_SSFIFO3);
+    return(1);
+}
+
+//*****************************************************************************
+//
+// SSI.
+//
+//*****************************************************************************
+void
+SSIConfigSetExpClk(uint32_t ui32Base, uint32_t ui32SSIClk,
+                   uint32_t ui32Protocol, uint32_t ui32Mode,
+                   uint32_t ui32BitRate, uint32_t ui32DataWidth)
+{
+}
+
+void
+SSIEnable(uint32_t ui32Base)
+{
+}
+
+void
+SSIDisable(uint32_t ui32Base)
+{
+}
+
+void
+SSIIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    if(ui32Base == SSI1_BASE)
+    {
+        g_ui32SimSSIIntMask |= ui32IntFlags;
+    }
+}
+
+void
+SSIIntDisable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    if(ui32Base == SSI1_BASE)
+    {
+        g_ui32SimSSIIntMask &= ~ui32IntFlags;
+    }
+}
+
+uint32_t
+SSIIntStatus(uint32_t ui32Base, bool bMasked)
+{
+    uint32_t ui32Status;
+
+    ui32Status = HWREG(ui32Base + SSI_O_RIS);
+    if((ui32Base == SSI1_BASE) && g_ui32SimSSICount)
+    {
+        ui32Status |= SSI_RXTO;
+    }
+    if((ui32Base == SSI1_BASE) && g_bSimSSIOverrun)
+    {
+        ui32Status |= SSI_RXOR;
+    }
+
+    return(bMasked ? (ui32Status & g_ui32SimSSIIntMask) : ui32Status);
+}
+
+void
+SSIIntClear(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    HWREG(ui32Base + SSI_O_ICR) = ui32IntFlags;
+    if((ui32Base == SSI1_BASE) && (ui32IntFlags & SSI_RXOR))
+    {
+        g_bSimSSIOverrun = false;
+    }
+}
+
+void
+SSIDataGet(uint32_t ui32Base, uint32_t *pui32Data)
+{
+    *pui32Data = HWREG(ui32Base + SSI_O_DR);
+}
+
+int32_t
+SSIDataGetNonBlocking(uint32_t ui32Base, uint32_t *pui32Data)
+{
+    if((ui32Base == SSI1_BASE) && !g_ui32SimSSICount)
+    {
+        return(0);
+    }
+    *pui32Data = HWREG(ui32Base + SSI_O_DR);
+    return(1);
+}
+
+void
+SSIDataPut(uint32_t ui32Base, uint32_t ui32Data)
+{
+    HWREG(ui32Base + SSI_O_DR) = ui32Data;
+}
+
+//*****************************************************************************
+//
+// GPIO.  Pin writes go through the masked data register so that the virtual
+// display sees them.
+//
+//*****************************************************************************
+void
+GPIOPinConfigure(uint32_t ui32PinConfig)
+{
+}
+
+void
+GPIOPinTypeGPIOOutput(uint32_t ui32Port, uint8_t ui8Pins)
+{
+}
+
+void
+GPIOPinTypeGPIOInput(uint32_t ui32Port, uint8_t ui8Pins)
+{
+}
+
+void
+GPIOPinTypeSSI(uint32_t ui32Port, uint8_t ui8Pins)
+{
+}
+
+void
+GPIOPinTypeUART(uint32_t ui32Port, uint8_t ui8Pins)
+{
+}
+
+void
+GPIOPinTypeADC(uint32_t ui32Port, uint8_t ui8Pins)
+{
+}
+
+void
+GPIOPinWrite(uint32_t ui32Port, uint8_t ui8Pins, uint8_t ui8Val)
+{
+    HWREG(ui32Port + (ui8Pins << 2)) = ui8Val;
+}
+
+int32_t
+GPIOPinRead(uint32_t ui32Port, uint8_t ui8Pins)
+{
+    return(HWREG(ui32Port + (ui8Pins << 2)));
+}
+
+//*****************************************************************************
+//
+// UART.  Only UART0 is modeled.
+//
+//*****************************************************************************
+
+//
+// Types text on the console, to arrive after any text still being received.
+//
+void
+SimUARTInput(const char *pcText, uint32_t ui32Length)
+{
+    if(g_ui32SimUARTInputRead == g_ui32SimUARTInputWrite)
+    {
+        g_ui32SimUARTInputRead = 0;
+        g_ui32SimUARTInputWrite = 0;
+        g_ui64SimUARTRxNext = SimCyclesGet() + g_ui32SimUARTCharCycles;
+    }
+
+    while(ui32Length-- && (g_ui32SimUARTInputWrite < SIM_UART_INPUT_SIZE))
+    {
+        g_pcSimUARTInput[g_ui32SimUARTInputWrite++] = *pcText++;
+    }
+
+    SimNextEventUpdate();
+}
+
+//
+// Queues a byte in the transmit FIFO, which must have room for it.
+//
+static void
+SimUARTPut(unsigned char ucData)
+{
+    fputc(ucData, g_psSimUART);
+    SimUARTCapture(ucData);
+
+    if(g_ui32SimUARTCount == 0)
+    {
+        g_ui64SimUARTNext = SimCyclesGet() + g_ui32SimUARTCharCycles;
+    }
+    g_ui32SimUARTCount++;
+
+    SimNextEventUpdate();
+}
+
+void
+UARTConfigSetExpClk(uint32_t ui32Base, uint32_t ui32UARTClk, uint32_t ui32Baud,
+                    uint32_t ui32Config)
+{
+    if(ui32Baud)
+    {
+        g_ui32SimUARTCharCycles = (uint32_t)(((uint64_t)SIM_CLOCK_HZ * 10) /
+                                             ui32Baud);
+    }
+}
+
+void
+UARTClockSourceSet(uint32_t ui32Base, uint32_t ui32Source)
+{
+}
+
+void
+UARTEnable(uint32_t ui32Base)
+{
+}
+
+void
+UARTDisable(uint32_t ui32Base)
+{
+}
+
+void
+UARTFIFOEnable(uint32_t ui32Base)
+{
+}
+
+void
+UARTFIFOLevelSet(uint32_t ui32Base, uint32_t ui32TxLevel,
+                 uint32_t ui32RxLevel)
+{
+    static const uint32_t pui32Levels[] = { 2, 4, 8, 12, 14 };
+
+    if(ui32TxLevel < (sizeof(pui32Levels) / sizeof(pui32Levels[0])))
+    {
+        g_ui32SimUARTTxLevel = pui32Levels[ui32TxLevel];
+    }
+    if((ui32RxLevel >> 3) < (sizeof(pui32Levels) / sizeof(pui32Levels[0])))
+    {
+        g_ui32SimUARTRxLevel = pui32Levels[ui32RxLevel >> 3];
+    }
+}
+
+void
+UARTTxIntModeSet(uint32_t ui32Base, uint32_t ui32Mode)
+{
+}
+
+bool
+UARTCharsAvail(uint32_t ui32Base)
+{
+    return(g_ui32SimUARTRxCount != 0);
+}
+
+bool
+UARTSpaceAvail(uint32_t ui32Base)
+{
+    return(g_ui32SimUARTCount < SIM_UART_FIFO_SIZE);
+}
+
+int32_t
+UARTCharGetNonBlocking(uint32_t ui32Base)
+{
+    int32_t i32Char;
+
+    if(!g_ui32SimUARTRxCount)
+    {
+        return(-1);
+    }
+
+    i32Char = g_pui8SimUARTRxFIFO[g_ui32SimUARTRxRead];
+    g_ui32SimUARTRxRead = (g_ui32SimUARTRxRead + 1) % SIM_UART_FIFO_SIZE;
+    g_ui32SimUARTRxCount--;
+
+    return(i32Char);
+}
+
+bool
+UARTCharPutNonBlocking(uint32_t ui32Base, unsigned char ucData)
+{
+    if(g_ui32SimUARTCount >= SIM_UART_FIFO_SIZE)
+    {
+        return(false);
+    }
+
+    SimUARTPut(ucData);
+    return(true);
+}
+
+//
+// Waits, letting simulated time pass, until the transmit FIFO has room.
+//
+void
+UARTCharPut(uint32_t ui32Base, unsigned char ucData)
+{
+    while(g_ui32SimUARTCount >= SIM_UART_FIFO_SIZE)
+    {
+        if(g_ui64SimUARTNext > SimCyclesGet())
+        {
+            SimCyclesAdvance(g_ui64SimUARTNext - SimCyclesGet());
+        }
+        SimEventsRaise();
+        SimInterruptsService();
+    }
+
+    SimUARTPut(ucData);
+}
+
+bool
+UARTBusy(uint32_t ui32Base)
+{
+    return(g_ui32SimUARTCount != 0);
+}
+
+void
+UARTIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    g_ui32SimUARTIntMask |= ui32IntFlags;
+    if(g_ui32SimUARTIntStatus & g_ui32SimUARTIntMask)
+    {
+        g_pbSimIntPending[INT_UART0] = true;
+    }
+}
+
+void
+UARTIntDisable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    g_ui32SimUARTIntMask &= ~ui32IntFlags;
+}
+
+uint32_t
+UARTIntStatus(uint32_t ui32Base, bool bMasked)
+{
+    return(bMasked ? (g_ui32SimUARTIntStatus & g_ui32SimUARTIntMask) :
+           g_ui32SimUARTIntStatus);
+}
+
+void
+UARTIntClear(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    g_ui32SimUARTIntStatus &= ~ui32IntFlags;
+}
+
+//*****************************************************************************
+//
+// FPU and MPU need no modeling on the host.
+//
+//*****************************************************************************
+void
+FPUEnable(void)
+{
+}
+
+void
+FPUDisable(void)
+{
+}
+
+void
+FPULazyStackingEnable(void)
+{
+}
+
+void
+FPUStackingEnable(void)
+{
+}
+
+void
+MPUEnable(uint32_t ui32MPUConfig)
+{
+}
+
+void
+MPUDisable(void)
+{
+}
+
+//*****************************************************************************
+//
+// uDMA.  The control table is kept here rather than in the table the firmware
+// passes to uDMAControlBaseSet(), and only the primary control structures are
+// modeled.
+//
+//*****************************************************************************
+void
+uDMAEnable(void)
+{
+}
+
+void
+uDMADisable(void)
+{
+}
+
+void
+uDMAControlBaseSet(void *pControlTable)
+{
+}
+
+void
+uDMAChannelAttributeDisable(uint32_t ui32ChannelNum, uint32_t ui32Attr)
+{
+}
+
+void
+uDMAChannelAttributeEnable(uint32_t ui32ChannelNum, uint32_t ui32Attr)
+{
+}
+
+void
+uDMAChannelControlSet(uint32_t ui32ChannelStructIndex, uint32_t ui32Control)
+{
+    if(!(ui32ChannelStructIndex & UDMA_ALT_SELECT))
+    {
+        g_psSimDMAChannels[ui32ChannelStructIndex & 0x1f].ui32Control =
+            ui32Control;
+    }
+}
+
+void
+uDMAChannelTransferSet(uint32_t ui32ChannelStructIndex, uint32_t ui32Mode,
+                       void *pvSrcAddr, void *pvDstAddr,
+                       uint32_t ui32TransferSize)
+{
+    tSimDMAChannel *psChannel;
+
+    if(!(ui32ChannelStructIndex & UDMA_ALT_SELECT))
+    {
+        psChannel = &g_psSimDMAChannels[ui32ChannelStructIndex & 0x1f];
+        psChannel->ui32Mode = ui32Mode;
+        psChannel->pui8Dst = pvDstAddr;
+        psChannel->ui32Remaining = ui32TransferSize;
+    }
+}
+
+void
+uDMAChannelEnable(uint32_t ui32ChannelNum)
+{
+    g_psSimDMAChannels[ui32ChannelNum & 0x1f].bEnabled = true;
+}
+
+void
+uDMAChannelDisable(uint32_t ui32ChannelNum)
+{
+    g_psSimDMAChannels[ui32ChannelNum & 0x1f].bEnabled = false;
+}
+
+bool
+uDMAChannelIsEnabled(uint32_t ui32ChannelNum)
+{
+    return(g_psSimDMAChannels[ui32ChannelNum & 0x1f].bEnabled);
+}
+
+uint32_t
+uDMAChannelModeGet(uint32_t ui32ChannelStructIndex)
+{
+    if(ui32ChannelStructIndex & UDMA_ALT_SELECT)
+    {
+        return(UDMA_MODE_STOP);
+    }
+
+    return(g_psSimDMAChannels[ui32ChannelStructIndex & 0x1f].ui32Mode);
+}
+
+uint32_t
+uDMAChannelSizeGet(uint32_t ui32ChannelStructIndex)
+{
+    if(ui32ChannelStructIndex & UDMA_ALT_SELECT)
+    {
+        return(0);
+    }
+
+    return(g_psSimDMAChannels[ui32ChannelStructIndex & 0x1f].ui32Remaining);
+}
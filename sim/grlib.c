@@ -0,0 +1,750 @@
+//*****************************************************************************
+//
+// grlib.c - Host simulator replacement for the TivaWare graphics primitives.
+//
+// The primitives follow the TivaWare graphics library: they clip against the
+// context and draw through the tDisplay callbacks of the display driver, so
+// the unmodified Kentec driver, and with it the bus traffic to the virtual
+// SSD2119, is exercised as on the target.  Images use the TivaWare image
+// format, including its compressed variant.
+//
+// The Computer Modern fonts are not available on the host.  All fonts are
+// rendered from one 5x7 bitmap font in a 6x8 cell, scaled by two for the
+// larger sizes, so text is legible and of a similar extent but is not pixel
+// identical to the target.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "grlib/grlib.h"
+
+//*****************************************************************************
+//
+// The font cell and the bitmaps of the printable ASCII characters, one byte
+// per column with the top row in bit 0.
+//
+//*****************************************************************************
+#define SIM_FONT_CELL_W         6
+#define SIM_FONT_CELL_H         8
+#define SIM_FONT_FIRST          ' '
+#define SIM_FONT_LAST           '~'
+
+//*****************************************************************************
+//
+// The widest row of a string that can be visible at once.
+//
+//*****************************************************************************
+#define SIM_STRING_ROW_MAX      320
+
+static const uint8_t g_pui8SimFont[][5] =
+{
+    { 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x5f, 0x00, 0x00 },
+    { 0x00, 0x07, 0x00, 0x07, 0x00 }, { 0x14, 0x7f, 0x14, 0x7f, 0x14 },
+    { 0x24, 0x2a, 0x7f, 0x2a, 0x12 }, { 0x23, 0x13, 0x08, 0x64, 0x62 },
+    { 0x36, 0x49, 0x56, 0x20, 0x50 }, { 0x00, 0x08, 0x07, 0x03, 0x00 },
+    { 0x00, 0x1c, 0x22, 0x41, 0x00 }, { 0x00, 0x41, 0x22, 0x1c, 0x00 },
+    { 0x2a, 0x1c, 0x7f, 0x1c, 0x2a }, { 0x08, 0x08, 0x3e, 0x08, 0x08 },
+    { 0x00, 0x80, 0x70, 0x30, 0x00 }, { 0x08, 0x08, 0x08, 0x08, 0x08 },
+    { 0x00, 0x00, 0x60, 0x60, 0x00 }, { 0x20, 0x10, 0x08, 0x04, 0x02 },
+    { 0x3e, 0x51, 0x49, 0x45, 0x3e }, { 0x00, 0x42, 0x7f, 0x40, 0x00 },
+    { 0x72, 0x49, 0x49, 0x49, 0x46 }, { 0x21, 0x41, 0x49, 0x4d, 0x33 },
+    { 0x18, 0x14, 0x12, 0x7f, 0x10 }, { 0x27, 0x45, 0x45, 0x45, 0x39 },
+    { 0x3c, 0x4a, 0x49, 0x49, 0x31 }, { 0x41, 0x21, 0x11, 0x09, 0x07 },
+    { 0x36, 0x49, 0x49, 0x49, 0x36 }, { 0x46, 0x49, 0x49, 0x29, 0x1e },
+    { 0x00, 0x00, 0x14, 0x00, 0x00 }, { 0x00, 0x40, 0x34, 0x00, 0x00 },
+    { 0x00, 0x08, 0x14, 0x22, 0x41 }, { 0x14, 0x14, 0x14, 0x14, 0x14 },
+    { 0x00, 0x41, 0x22, 0x14, 0x08 }, { 0x02, 0x01, 0x59, 0x09, 0x06 },
+    { 0x3e, 0x41, 0x5d, 0x59, 0x4e }, { 0x7c, 0x12, 0x11, 0x12, 0x7c },
+    { 0x7f, 0x49, 0x49, 0x49, 0x36 }, { 0x3e, 0x41, 0x41, 0x41, 0x22 },
+    { 0x7f, 0x41, 0x41, 0x41, 0x3e }, { 0x7f, 0x49, 0x49, 0x49, 0x41 },
+    { 0x7f, 0x09, 0x09, 0x09, 0x01 }, { 0x3e, 0x41, 0x41, 0x51, 0x73 },
+    { 0x7f, 0x08, 0x08, 0x08, 0x7f }, { 0x00, 0x41, 0x7f, 0x41, 0x00 },
+    { 0x20, 0x40, 0x41, 0x3f, 0x01 }, { 0x7f, 0x08, 0x14, 0x22, 0x41 },
+    { 0x7f, 0x40, 0x40, 0x40, 0x40 }, { 0x7f, 0x02, 0x1c, 0x02, 0x7f },
+    { 0x7f, 0x04, 0x08, 0x10, 0x7f }, { 0x3e, 0x41, 0x41, 0x41, 0x3e },
+    { 0x7f, 0x09, 0x09, 0x09, 0x06 }, { 0x3e, 0x41, 0x51, 0x21, 0x5e },
+    { 0x7f, 0x09, 0x19, 0x29, 0x46 }, { 0x26, 0x49, 0x49, 0x49, 0x32 },
+    { 0x03, 0x01, 0x7f, 0x01, 0x03 }, { 0x3f, 0x40, 0x40, 0x40, 0x3f },
+    { 0x1f, 0x20, 0x40, 0x20, 0x1f }, { 0x3f, 0x40, 0x38, 0x40, 0x3f },
+    { 0x63, 0x14, 0x08, 0x14, 0x63 }, { 0x03, 0x04, 0x78, 0x04, 0x03 },
+    { 0x61, 0x59, 0x49, 0x4d, 0x43 }, { 0x00, 0x7f, 0x41, 0x41, 0x41 },
+    { 0x02, 0x04, 0x08, 0x10, 0x20 }, { 0x00, 0x41, 0x41, 0x41, 0x7f },
+    { 0x04, 0x02, 0x01, 0x02, 0x04 }, { 0x40, 0x40, 0x40, 0x40, 0x40 },
+    { 0x00, 0x03, 0x07, 0x08, 0x00 }, { 0x20, 0x54, 0x54, 0x78, 0x40 },
+    { 0x7f, 0x28, 0x44, 0x44, 0x38 }, { 0x38, 0x44, 0x44, 0x44, 0x28 },
+    { 0x38, 0x44, 0x44, 0x28, 0x7f }, { 0x38, 0x54, 0x54, 0x54, 0x18 },
+    { 0x00, 0x08, 0x7e, 0x09, 0x02 }, { 0x18, 0xa4, 0xa4, 0x9c, 0x78 },
+    { 0x7f, 0x08, 0x04, 0x04, 0x78 }, { 0x00, 0x44, 0x7d, 0x40, 0x00 },
+    { 0x20, 0x40, 0x40, 0x3d, 0x00 }, { 0x7f, 0x10, 0x28, 0x44, 0x00 },
+    { 0x00, 0x41, 0x7f, 0x40, 0x00 }, { 0x7c, 0x04, 0x78, 0x04, 0x78 },
+    { 0x7c, 0x08, 0x04, 0x04, 0x78 }, { 0x38, 0x44, 0x44, 0x44, 0x38 },
+    { 0xfc, 0x18, 0x24, 0x24, 0x18 }, { 0x18, 0x24, 0x24, 0x18, 0xfc },
+    { 0x7c, 0x08, 0x04, 0x04, 0x08 }, { 0x48, 0x54, 0x54, 0x54, 0x24 },
+    { 0x04, 0x04, 0x3f, 0x44, 0x24 }, { 0x3c, 0x40, 0x40, 0x20, 0x7c },
+    { 0x1c, 0x20, 0x40, 0x20, 0x1c }, { 0x3c, 0x40, 0x30, 0x40, 0x3c },
+    { 0x44, 0x28, 0x10, 0x28, 0x44 }, { 0x4c, 0x90, 0x90, 0x90, 0x7c },
+    { 0x44, 0x64, 0x54, 0x4c, 0x44 }, { 0x00, 0x08, 0x36, 0x41, 0x00 },
+    { 0x00, 0x00, 0x77, 0x00, 0x00 }, { 0x00, 0x41, 0x36, 0x08, 0x00 },
+    { 0x02, 0x01, 0x02, 0x04, 0x02 },
+};
+
+//*****************************************************************************
+//
+// The fonts used by the firmware.
+//
+//*****************************************************************************
+const tFont g_sFontCm12 = { 0, 6, 8, 7, 1 };
+const tFont g_sFontCm14 = { 0, 6, 8, 7, 1 };
+const tFont g_sFontCm16 = { 0, 12, 16, 14, 2 };
+const tFont g_sFontCm20 = { 0, 12, 16, 14, 2 };
+
+//*****************************************************************************
+//
+// Orders two values.
+//
+//*****************************************************************************
+#define SWAP(a, b)                                                           \
+        do                                                                   \
+        {                                                                    \
+            int32_t i32Temp = (a);                                           \
+            (a) = (b);                                                       \
+            (b) = i32Temp;                                                   \
+        }                                                                    \
+        while(0)
+
+//*****************************************************************************
+//
+// Initializes a drawing context.
+//
+//*****************************************************************************
+void
+GrContextInit(tContext *psContext, const tDisplay *psDisplay)
+{
+    psContext->i32Size = sizeof(tContext);
+    psContext->psDisplay = psDisplay;
+    psContext->sClipRegion.i16XMin = 0;
+    psContext->sClipRegion.i16YMin = 0;
+    psContext->sClipRegion.i16XMax = DpyWidthGet(psDisplay) - 1;
+    psContext->sClipRegion.i16YMax = DpyHeightGet(psDisplay) - 1;
+    psContext->ui32Foreground = 0;
+    psContext->ui32Background = 0;
+    psContext->psFont = 0;
+}
+
+//*****************************************************************************
+//
+// Sets the clipping region of a context, limited to the display.
+//
+//*****************************************************************************
+void
+GrContextClipRegionSet(tContext *psContext, tRectangle *psRect)
+{
+    int32_t i32W, i32H;
+
+    i32W = DpyWidthGet(psContext->psDisplay);
+    i32H = DpyHeightGet(psContext->psDisplay);
+
+    psContext->sClipRegion.i16XMin = (psRect->i16XMin < 0) ? 0 :
+                                     psRect->i16XMin;
+    psContext->sClipRegion.i16YMin = (psRect->i16YMin < 0) ? 0 :
+                                     psRect->i16YMin;
+    psContext->sClipRegion.i16XMax = (psRect->i16XMax >= i32W) ? (i32W - 1) :
+                                     psRect->i16XMax;
+    psContext->sClipRegion.i16YMax = (psRect->i16YMax >= i32H) ? (i32H - 1) :
+                                     psRect->i16YMax;
+}
+
+//*****************************************************************************
+//
+// Draws a pixel.
+//
+//*****************************************************************************
+void
+GrPixelDraw(const tContext *psContext, int32_t i32X, int32_t i32Y)
+{
+    if((i32X >= psContext->sClipRegion.i16XMin) &&
+       (i32X <= psContext->sClipRegion.i16XMax) &&
+       (i32Y >= psContext->sClipRegion.i16YMin) &&
+       (i32Y <= psContext->sClipRegion.i16YMax))
+    {
+        DpyPixelDraw(psContext->psDisplay, i32X, i32Y,
+                     psContext->ui32Foreground);
+    }
+}
+
+//*****************************************************************************
+//
+// Draws a horizontal line.
+//
+//*****************************************************************************
+void
+GrLineDrawH(const tContext *psContext, int32_t i32X1, int32_t i32X2,
+            int32_t i32Y)
+{
+    if((i32Y < psContext->sClipRegion.i16YMin) ||
+       (i32Y > psContext->sClipRegion.i16YMax))
+    {
+        return;
+    }
+    if(i32X1 > i32X2)
+    {
+        SWAP(i32X1, i32X2);
+    }
+    if((i32X2 < psContext->sClipRegion.i16XMin) ||
+       (i32X1 > psContext->sClipRegion.i16XMax))
+    {
+        return;
+    }
+    if(i32X1 < psContext->sClipRegion.i16XMin)
+    {
+        i32X1 = psContext->sClipRegion.i16XMin;
+    }
+    if(i32X2 > psContext->sClipRegion.i16XMax)
+    {
+        i32X2 = psContext->sClipRegion.i16XMax;
+    }
+
+    DpyLineDrawH(psContext->psDisplay, i32X1, i32X2, i32Y,
+                 psContext->ui32Foreground);
+}
+
+//*****************************************************************************
+//
+// Draws a vertical line.
+//
+//*****************************************************************************
+void
+GrLineDrawV(const tContext *psContext, int32_t i32X, int32_t i32Y1,
+            int32_t i32Y2)
+{
+    if((i32X < psContext->sClipRegion.i16XMin) ||
+       (i32X > psContext->sClipRegion.i16XMax))
+    {
+        return;
+    }
+    if(i32Y1 > i32Y2)
+    {
+        SWAP(i32Y1, i32Y2);
+    }
+    if((i32Y2 < psContext->sClipRegion.i16YMin) ||
+       (i32Y1 > psContext->sClipRegion.i16YMax))
+    {
+        return;
+    }
+    if(i32Y1 < psContext->sClipRegion.i16YMin)
+    {
+        i32Y1 = psContext->sClipRegion.i16YMin;
+    }
+    if(i32Y2 > psContext->sClipRegion.i16YMax)
+    {
+        i32Y2 = psContext->sClipRegion.i16YMax;
+    }
+
+    DpyLineDrawV(psContext->psDisplay, i32X, i32Y1, i32Y2,
+                 psContext->ui32Foreground);
+}
+
+//*****************************************************************************
+//
+// Draws a line with Bresenham's algorithm.
+//
+//*****************************************************************************
+void
+GrLineDraw(const tContext *psContext, int32_t i32X1, int32_t i32Y1,
+           int32_t i32X2, int32_t i32Y2)
+{
+    int32_t i32DX, i32DY, i32SX, i32SY, i32Err, i32E2;
+
+    if(i32Y1 == i32Y2)
+    {
+        GrLineDrawH(psContext, i32X1, i32X2, i32Y1);
+        return;
+    }
+    if(i32X1 == i32X2)
+    {
+        GrLineDrawV(psContext, i32X1, i32Y1, i32Y2);
+        return;
+    }
+
+    i32DX = abs(i32X2 - i32X1);
+    i32DY = -abs(i32Y2 - i32Y1);
+    i32SX = (i32X1 < i32X2) ? 1 : -1;
+    i32SY = (i32Y1 < i32Y2) ? 1 : -1;
+    i32Err = i32DX + i32DY;
+
+    while(1)
+    {
+        GrPixelDraw(psContext, i32X1, i32Y1);
+        if((i32X1 == i32X2) && (i32Y1 == i32Y2))
+        {
+            break;
+        }
+        i32E2 = 2 * i32Err;
+        if(i32E2 >= i32DY)
+        {
+            i32Err += i32DY;
+            i32X1 += i32SX;
+        }
+        if(i32E2 <= i32DX)
+        {
+            i32Err += i32DX;
+            i32Y1 += i32SY;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Draws the outline of a rectangle.
+//
+//*****************************************************************************
+void
+GrRectDraw(const tContext *psContext, const tRectangle *psRect)
+{
+    GrLineDrawH(psContext, psRect->i16XMin, psRect->i16XMax, psRect->i16YMin);
+    if(psRect->i16YMin == psRect->i16YMax)
+    {
+        return;
+    }
+    GrLineDrawV(psContext, psRect->i16XMax, psRect->i16YMin + 1,
+                psRect->i16YMax);
+    GrLineDrawH(psContext, psRect->i16XMax - 1, psRect->i16XMin,
+                psRect->i16YMax);
+    if((psRect->i16XMin == psRect->i16XMax) ||
+       ((psRect->i16YMin + 1) > (psRect->i16YMax - 1)))
+    {
+        return;
+    }
+    GrLineDrawV(psContext, psRect->i16XMin, psRect->i16YMax - 1,
+                psRect->i16YMin + 1);
+}
+
+//*****************************************************************************
+//
+// Fills a rectangle.
+//
+//*****************************************************************************
+void
+GrRectFill(const tContext *psContext, const tRectangle *psRect)
+{
+    tRectangle sTemp;
+
+    sTemp = *psRect;
+    if(sTemp.i16XMin > sTemp.i16XMax)
+    {
+        SWAP(sTemp.i16XMin, sTemp.i16XMax);
+    }
+    if(sTemp.i16YMin > sTemp.i16YMax)
+    {
+        SWAP(sTemp.i16YMin, sTemp.i16YMax);
+    }
+
+    if((sTemp.i16XMin > psContext->sClipRegion.i16XMax) ||
+       (sTemp.i16XMax < psContext->sClipRegion.i16XMin) ||
+       (sTemp.i16YMin > psContext->sClipRegion.i16YMax) ||
+       (sTemp.i16YMax < psContext->sClipRegion.i16YMin))
+    {
+        return;
+    }
+
+    if(sTemp.i16XMin < psContext->sClipRegion.i16XMin)
+    {
+        sTemp.i16XMin = psContext->sClipRegion.i16XMin;
+    }
+    if(sTemp.i16YMin < psContext->sClipRegion.i16YMin)
+    {
+        sTemp.i16YMin = psContext->sClipRegion.i16YMin;
+    }
+    if(sTemp.i16XMax > psContext->sClipRegion.i16XMax)
+    {
+        sTemp.i16XMax = psContext->sClipRegion.i16XMax;
+    }
+    if(sTemp.i16YMax > psContext->sClipRegion.i16YMax)
+    {
+        sTemp.i16YMax = psContext->sClipRegion.i16YMax;
+    }
+
+    DpyRectFill(psContext->psDisplay, &sTemp, psContext->ui32Foreground);
+}
+
+//*****************************************************************************
+//
+// Draws the outline of a circle with the midpoint algorithm.
+//
+//*****************************************************************************
+void
+GrCircleDraw(const tContext *psContext, int32_t i32X, int32_t i32Y,
+             int32_t i32Radius)
+{
+    int32_t i32A, i32B, i32D;
+
+    i32A = 0;
+    i32B = i32Radius;
+    i32D = 3 - (2 * i32Radius);
+
+    while(i32A <= i32B)
+    {
+        GrPixelDraw(psContext, i32X + i32A, i32Y + i32B);
+        GrPixelDraw(psContext, i32X - i32A, i32Y + i32B);
+        GrPixelDraw(psContext, i32X + i32A, i32Y - i32B);
+        GrPixelDraw(psContext, i32X - i32A, i32Y - i32B);
+        GrPixelDraw(psContext, i32X + i32B, i32Y + i32A);
+        GrPixelDraw(psContext, i32X - i32B, i32Y + i32A);
+        GrPixelDraw(psContext, i32X + i32B, i32Y - i32A);
+        GrPixelDraw(psContext, i32X - i32B, i32Y - i32A);
+
+        if(i32D < 0)
+        {
+            i32D += (4 * i32A) + 6;
+        }
+        else
+        {
+            i32D += (4 * (i32A - i32B)) + 10;
+            i32B--;
+        }
+        i32A++;
+    }
+}
+
+//*****************************************************************************
+//
+// Fills a circle with horizontal lines.
+//
+//*****************************************************************************
+void
+GrCircleFill(const tContext *psContext, int32_t i32X, int32_t i32Y,
+             int32_t i32Radius)
+{
+    int32_t i32A, i32B, i32D;
+
+    i32A = 0;
+    i32B = i32Radius;
+    i32D = 3 - (2 * i32Radius);
+
+    while(i32A <= i32B)
+    {
+        GrLineDrawH(psContext, i32X - i32B, i32X + i32B, i32Y + i32A);
+        if(i32A)
+        {
+            GrLineDrawH(psContext, i32X - i32B, i32X + i32B, i32Y - i32A);
+        }
+
+        if(i32D < 0)
+        {
+            i32D += (4 * i32A) + 6;
+        }
+        else
+        {
+            if(i32A != i32B)
+            {
+                GrLineDrawH(psContext, i32X - i32A, i32X + i32A, i32Y + i32B);
+                GrLineDrawH(psContext, i32X - i32A, i32X + i32A, i32Y - i32B);
+            }
+            i32D += (4 * (i32A - i32B)) + 10;
+            i32B--;
+        }
+        i32A++;
+    }
+}
+
+//*****************************************************************************
+//
+// Returns the length of a string as used by the string functions.
+//
+//*****************************************************************************
+static int32_t
+SimStringLength(const char *pcString, int32_t i32Length)
+{
+    int32_t i32Len;
+
+    for(i32Len = 0; pcString[i32Len] && (i32Length < 0 || i32Len < i32Length);
+        i32Len++)
+    {
+    }
+
+    return(i32Len);
+}
+
+//*****************************************************************************
+//
+// Returns the width of a string in pixels.
+//
+//*****************************************************************************
+int32_t
+GrStringWidthGet(const tContext *psContext, const char *pcString,
+                 int32_t i32Length)
+{
+    return(SimStringLength(pcString, i32Length) * SIM_FONT_CELL_W *
+           psContext->psFont->ui8Scale);
+}
+
+//*****************************************************************************
+//
+// Returns true if the pixel at column i32Col of row i32Row of a string is set.
+//
+//*****************************************************************************
+static bool
+SimStringPixelGet(const char *pcString, int32_t i32Scale, int32_t i32Col,
+                  int32_t i32Row)
+{
+    int32_t i32Char, i32Bit;
+    uint8_t ui8Char;
+
+    i32Char = i32Col / (SIM_FONT_CELL_W * i32Scale);
+    i32Bit = (i32Col % (SIM_FONT_CELL_W * i32Scale)) / i32Scale;
+    if(i32Bit >= 5)
+    {
+        return(false);
+    }
+
+    ui8Char = (uint8_t)pcString[i32Char];
+    if((ui8Char < SIM_FONT_FIRST) || (ui8Char > SIM_FONT_LAST))
+    {
+        ui8Char = '?';
+    }
+
+    return((g_pui8SimFont[ui8Char - SIM_FONT_FIRST][i32Bit] >>
+            (i32Row / i32Scale)) & 1);
+}
+
+//*****************************************************************************
+//
+// Draws a string with its top left corner at the given position.  Opaque text
+// is sent to the display one 1 BPP row at a time, with the context background
+// and foreground as the palette; transparent text is drawn as horizontal runs.
+//
+//*****************************************************************************
+void
+GrStringDraw(const tContext *psContext, const char *pcString,
+             int32_t i32Length, int32_t i32X, int32_t i32Y, uint32_t bOpaque)
+{
+    uint8_t pui8Row[(SIM_STRING_ROW_MAX + 7) / 8];
+    uint32_t pui32Palette[2];
+    int32_t i32Len, i32Scale, i32Width, i32Height, i32Row, i32Col;
+    int32_t i32X0, i32X1, i32Run;
+
+    i32Len = SimStringLength(pcString, i32Length);
+    i32Scale = psContext->psFont->ui8Scale;
+    i32Width = i32Len * SIM_FONT_CELL_W * i32Scale;
+    i32Height = SIM_FONT_CELL_H * i32Scale;
+    if(i32Width == 0)
+    {
+        return;
+    }
+
+    //
+    // The visible columns.
+    //
+    i32X0 = (i32X < psContext->sClipRegion.i16XMin) ?
+            (psContext->sClipRegion.i16XMin - i32X) : 0;
+    i32X1 = ((i32X + i32Width - 1) > psContext->sClipRegion.i16XMax) ?
+            (psContext->sClipRegion.i16XMax - i32X) : (i32Width - 1);
+    if(i32X0 > i32X1)
+    {
+        return;
+    }
+
+    pui32Palette[0] = psContext->ui32Background;
+    pui32Palette[1] = psContext->ui32Foreground;
+
+    for(i32Row = 0; i32Row < i32Height; i32Row++)
+    {
+        if(((i32Y + i32Row) < psContext->sClipRegion.i16YMin) ||
+           ((i32Y + i32Row) > psContext->sClipRegion.i16YMax))
+        {
+            continue;
+        }
+
+        if(bOpaque)
+        {
+            memset(pui8Row, 0, sizeof(pui8Row));
+            for(i32Col = i32X0; i32Col <= i32X1; i32Col++)
+            {
+                if(SimStringPixelGet(pcString, i32Scale, i32Col, i32Row))
+                {
+                    pui8Row[(i32Col - i32X0) / 8] |=
+                        0x80 >> ((i32Col - i32X0) % 8);
+                }
+            }
+            DpyPixelDrawMultiple(psContext->psDisplay, i32X + i32X0,
+                                 i32Y + i32Row, 0, i32X1 - i32X0 + 1, 1,
+                                 pui8Row, (const uint8_t *)pui32Palette);
+            continue;
+        }
+
+        for(i32Col = i32X0; i32Col <= i32X1; )
+        {
+            if(!SimStringPixelGet(pcString, i32Scale, i32Col, i32Row))
+            {
+                i32Col++;
+                continue;
+            }
+            for(i32Run = i32Col;
+                (i32Run < i32X1) &&
+                SimStringPixelGet(pcString, i32Scale, i32Run + 1, i32Row);
+                i32Run++)
+            {
+            }
+            DpyLineDrawH(psContext->psDisplay, i32X + i32Col, i32X + i32Run,
+                         i32Y + i32Row, psContext->ui32Foreground);
+            i32Col = i32Run + 1;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Decodes the pixel data of a compressed image.  The data is a sequence of
+// groups of eight items, each group preceded by a byte whose bits, most
+// significant first, mark the items that are back references.  A literal item
+// is one byte.  A back reference is one byte holding the length less two in
+// bits 2:0 and, in bits 7:3, thirty-two less the distance back into the last
+// 32 bytes written; history before the start of the data reads as zero.  The rows of the image follow each other without
+// padding between the compressed groups.
+//
+//*****************************************************************************
+static void
+SimImageDecompress(const uint8_t *pui8Data, uint8_t *pui8Out, uint32_t ui32Size)
+{
+    uint32_t ui32Out, ui32Len, ui32Dist, ui32Item;
+    uint8_t ui8Flags;
+
+    ui32Out = 0;
+    while(ui32Out < ui32Size)
+    {
+        ui8Flags = *pui8Data++;
+        for(ui32Item = 0; (ui32Item < 8) && (ui32Out < ui32Size); ui32Item++)
+        {
+            if(!(ui8Flags & (0x80 >> ui32Item)))
+            {
+                pui8Out[ui32Out++] = *pui8Data++;
+                continue;
+            }
+
+            ui32Len = (*pui8Data & 7) + 2;
+            ui32Dist = 32 - (*pui8Data++ >> 3);
+            while(ui32Len-- && (ui32Out < ui32Size))
+            {
+                pui8Out[ui32Out] = ((ui32Out >= ui32Dist) ?
+                                    pui8Out[ui32Out - ui32Dist] : 0);
+                ui32Out++;
+            }
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Draws an image with its top left corner at the given position.
+//
+//*****************************************************************************
+void
+GrImageDraw(const tContext *psContext, const uint8_t *pui8Image, int32_t i32X,
+            int32_t i32Y)
+{
+    uint32_t pui32Palette[2];
+    const uint8_t *pui8Palette, *pui8Data;
+    uint8_t *pui8Pixels;
+    int32_t i32W, i32H, i32BPP, i32Stride, i32Row, i32X0, i32X1;
+    uint8_t ui8Format;
+
+    ui8Format = pui8Image[0];
+    i32W = GrImageWidthGet(pui8Image);
+    i32H = GrImageHeightGet(pui8Image);
+    i32BPP = ui8Format & 0x7f;
+    if((i32BPP != 1) && (i32BPP != 4) && (i32BPP != 8))
+    {
+        return;
+    }
+
+    //
+    // 1 BPP images are drawn in the context colors; the others carry a
+    // palette of 24-bit colors, which the display driver translates.
+    //
+    if(i32BPP == 1)
+    {
+        pui32Palette[0] = psContext->ui32Background;
+        pui32Palette[1] = psContext->ui32Foreground;
+        pui8Palette = (const uint8_t *)pui32Palette;
+        pui8Data = pui8Image + 5;
+    }
+    else
+    {
+        pui8Palette = pui8Image + 6;
+        pui8Data = pui8Palette + ((pui8Image[5] + 1) * 3);
+    }
+
+    i32Stride = ((i32W * i32BPP) + 7) / 8;
+    pui8Pixels = 0;
+    if(ui8Format & 0x80)
+    {
+        pui8Pixels = malloc(i32Stride * i32H);
+        if(!pui8Pixels)
+        {
+            return;
+        }
+        SimImageDecompress(pui8Data, pui8Pixels, i32Stride * i32H);
+        pui8Data = pui8Pixels;
+    }
+
+    i32X0 = (i32X < psContext->sClipRegion.i16XMin) ?
+            (psContext->sClipRegion.i16XMin - i32X) : 0;
+    i32X1 = ((i32X + i32W - 1) > psContext->sClipRegion.i16XMax) ?
+            (psContext->sClipRegion.i16XMax - i32X) : (i32W - 1);
+
+    for(i32Row = 0; (i32X0 <= i32X1) && (i32Row < i32H); i32Row++)
+    {
+        if(((i32Y + i32Row) < psContext->sClipRegion.i16YMin) ||
+           ((i32Y + i32Row) > psContext->sClipRegion.i16YMax))
+        {
+            continue;
+        }
+
+        DpyPixelDrawMultiple(psContext->psDisplay, i32X + i32X0,
+                             i32Y + i32Row, (i32X0 * i32BPP) % 8 / i32BPP,
+                             i32X1 - i32X0 + 1, i32BPP,
+                             pui8Data + (i32Row * i32Stride) +
+                             ((i32X0 * i32BPP) / 8),
+                             pui8Palette);
+    }
+
+    free(pui8Pixels);
+}
+
+//*****************************************************************************
+//
+// Rectangle helpers.
+//
+//*****************************************************************************
+bool
+GrRectOverlapCheck(tRectangle *psRect1, tRectangle *psRect2)
+{
+    return(!((psRect1->i16XMax < psRect2->i16XMin) ||
+             (psRect2->i16XMax < psRect1->i16XMin) ||
+             (psRect1->i16YMax < psRect2->i16YMin) ||
+             (psRect2->i16YMax < psRect1->i16YMin)));
+}
+
+int32_t
+GrRectIntersectGet(tRectangle *psRect1, tRectangle *psRect2,
+                   tRectangle *psIntersect)
+{
+    if(!GrRectOverlapCheck(psRect1, psRect2))
+    {
+        return(0);
+    }
+
+    psIntersect->i16XMin = (psRect1->i16XMin > psRect2->i16XMin) ?
+                           psRect1->i16XMin : psRect2->i16XMin;
+    psIntersect->i16YMin = (psRect1->i16YMin > psRect2->i16YMin) ?
+                           psRect1->i16YMin : psRect2->i16YMin;
+    psIntersect->i16XMax = (psRect1->i16XMax < psRect2->i16XMax) ?
+                           psRect1->i16XMax : psRect2->i16XMax;
+    psIntersect->i16YMax = (psRect1->i16YMax < psRect2->i16YMax) ?
+                           psRect1->i16YMax : psRect2->i16YMax;
+
+    return(1);
+}
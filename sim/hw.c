@@ -0,0 +1,279 @@
+//*****************************************************************************
+//
+// hw.c - Simulated peripheral register file.
+//
+// HWREG() in the simulator resolves to SimRegister(), which returns a host
+// cell standing in for the target register.  Plain registers are kept in a
+// sparse table.  GPIO data registers use the TivaWare address masking scheme
+// (bits 9:2 of the address select the pins affected), so every access gets a
+// scratch cell pre-loaded with the masked port value; because a cell cannot
+// tell a read from a write, the access is committed lazily, when the next
+// register access is made or SimRegisterFlush() is called, by comparing the
+// cell against the value it was loaded with.  Committed GPIO writes are passed
+// to the virtual SSD2119 so that the unmodified GPIO bus driver can be
+// observed.
+//
+// Every register access also advances the simulated cycle counter by
+// SIM_CYCLES_PER_ACCESS, which gives deterministic, bus-bound timing for the
+// profiler and the scheduler statistics.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "sim.h"
+
+//*****************************************************************************
+//
+// The sparse register table.  The table is far larger than the number of
+// registers the firmware touches, so linear probing never runs long.
+//
+//*****************************************************************************
+#define SIM_REG_TABLE_SIZE      4096
+
+typedef struct
+{
+    uint32_t ui32Addr;
+    bool bUsed;
+    uint32_t ui32Value;
+}
+tSimReg;
+
+static tSimReg g_psSimRegs[SIM_REG_TABLE_SIZE];
+
+//*****************************************************************************
+//
+// The GPIO ports.  The pin state is kept here, not in the register table,
+// because each data access goes through a different masked address.
+//
+//*****************************************************************************
+static const uint32_t g_pui32SimGPIOBase[SIM_NUM_PORTS] =
+{
+    GPIO_PORTA_BASE, GPIO_PORTB_BASE, GPIO_PORTC_BASE,
+    GPIO_PORTD_BASE, GPIO_PORTE_BASE, GPIO_PORTF_BASE
+};
+
+static uint8_t g_pui8SimGPIOData[SIM_NUM_PORTS];
+
+//*****************************************************************************
+//
+// The access waiting to be committed.
+//
+//*****************************************************************************
+static volatile uint32_t *g_pui32SimPending;
+static uint32_t g_ui32SimPendingLoaded;
+static int32_t g_i32SimPendingPort;
+static uint8_t g_ui8SimPendingMask;
+
+//*****************************************************************************
+//
+// The scratch cell used for masked GPIO data and read-only registers.
+//
+//*****************************************************************************
+static volatile uint32_t g_ui32SimScratch;
+
+//*****************************************************************************
+//
+// The simulated processor cycle counter and the register access count.
+//
+//*****************************************************************************
+static uint64_t g_ui64SimCycles;
+static uint64_t g_ui64SimAccesses;
+
+//*****************************************************************************
+//
+// Returns the GPIO port index of a data register address, or -1.
+//
+//*****************************************************************************
+static int32_t
+SimGPIOPortGet(uint32_t ui32Addr)
+{
+    int32_t i32Port;
+
+    for(i32Port = 0; i32Port < SIM_NUM_PORTS; i32Port++)
+    {
+        if((ui32Addr >= g_pui32SimGPIOBase[i32Port]) &&
+           (ui32Addr < (g_pui32SimGPIOBase[i32Port] + 0x400)))
+        {
+            return(i32Port);
+        }
+    }
+
+    return(-1);
+}
+
+//*****************************************************************************
+//
+// Finds, or creates, the table entry of a plain register.
+//
+//*****************************************************************************
+static tSimReg *
+SimRegFind(uint32_t ui32Addr)
+{
+    uint32_t ui32Idx;
+
+    ui32Idx = ((ui32Addr >> 2) * 2654435761u) % SIM_REG_TABLE_SIZE;
+    while(g_psSimRegs[ui32Idx].bUsed &&
+          (g_psSimRegs[ui32Idx].ui32Addr != ui32Addr))
+    {
+        ui32Idx = (ui32Idx + 1) % SIM_REG_TABLE_SIZE;
+    }
+
+    if(!g_psSimRegs[ui32Idx].bUsed)
+    {
+        g_psSimRegs[ui32Idx].bUsed = true;
+        g_psSimRegs[ui32Idx].ui32Addr = ui32Addr;
+        g_psSimRegs[ui32Idx].ui32Value = 0;
+    }
+
+    return(&g_psSimRegs[ui32Idx]);
+}
+
+//*****************************************************************************
+//
+// Commits the pending access.  A GPIO data cell that no longer holds the
+// value it was loaded with has been written.
+//
+//*****************************************************************************
+void
+SimRegisterFlush(void)
+{
+    volatile uint32_t *pui32Cell;
+    uint8_t ui8Old, ui8New;
+
+    pui32Cell = g_pui32SimPending;
+    if(pui32Cell == 0)
+    {
+        return;
+    }
+    g_pui32SimPending = 0;
+
+    if(*pui32Cell != g_ui32SimPendingLoaded)
+    {
+        ui8Old = g_pui8SimGPIOData[g_i32SimPendingPort];
+        ui8New = ((ui8Old & ~g_ui8SimPendingMask) |
+                  (*pui32Cell & g_ui8SimPendingMask));
+        g_pui8SimGPIOData[g_i32SimPendingPort] = ui8New;
+        if(ui8New != ui8Old)
+        {
+            SimGPIOWrite(g_i32SimPendingPort, ui8Old, ui8New);
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Returns the host cell standing in for a target register.
+//
+//*****************************************************************************
+volatile uint32_t *
+SimRegister(uint32_t ui32Addr)
+{
+    int32_t i32Port;
+    tSimReg *psReg;
+
+    SimRegisterFlush();
+
+    g_ui64SimCycles += SIM_CYCLES_PER_ACCESS;
+    g_ui64SimAccesses++;
+
+    //
+    // Raise any peripheral events that have become due and take the
+    // interrupts they cause.  This happens before the access is set up, so
+    // that the handlers' own accesses cannot disturb it.
+    //
+    SimEventsPoll();
+
+    //
+    // Masked GPIO data access.
+    //
+    i32Port = SimGPIOPortGet(ui32Addr);
+    if(i32Port >= 0)
+    {
+        g_i32SimPendingPort = i32Port;
+        g_ui8SimPendingMask = (ui32Addr >> 2) & 0xff;
+        g_ui32SimScratch = g_pui8SimGPIOData[i32Port] & g_ui8SimPendingMask;
+        g_ui32SimPendingLoaded = g_ui32SimScratch;
+        g_pui32SimPending = &g_ui32SimScratch;
+        return(&g_ui32SimScratch);
+    }
+
+    //
+    // The DWT cycle counter reads the simulated cycle count.  Writes are
+    // ignored; the firmware only ever clears it once at start-up.
+    //
+    if(ui32Addr == (DWT_BASE + 0x004))
+    {
+        g_ui32SimScratch = (uint32_t)g_ui64SimCycles;
+        return(&g_ui32SimScratch);
+    }
+
+    //
+    // Registers with read side effects.
+    //
+    if(SimRegisterRead(ui32Addr, &g_ui32SimScratch))
+    {
+        return(&g_ui32SimScratch);
+    }
+
+    psReg = SimRegFind(ui32Addr);
+    return(&psReg->ui32Value);
+}
+
+//*****************************************************************************
+//
+// Reads and writes plain registers without going through an access, for the
+// driverlib stubs.
+//
+//*****************************************************************************
+uint32_t
+SimRegisterGet(uint32_t ui32Addr)
+{
+    return(SimRegFind(ui32Addr)->ui32Value);
+}
+
+void
+SimRegisterSet(uint32_t ui32Addr, uint32_t ui32Value)
+{
+    SimRegFind(ui32Addr)->ui32Value = ui32Value;
+}
+
+//*****************************************************************************
+//
+// Gets the state of a GPIO port.
+//
+//*****************************************************************************
+uint8_t
+SimGPIOGet(uint32_t ui32Port)
+{
+    SimRegisterFlush();
+
+    return(g_pui8SimGPIOData[ui32Port]);
+}
+
+//*****************************************************************************
+//
+// The simulated cycle counter.
+//
+//*****************************************************************************
+uint64_t
+SimCyclesGet(void)
+{
+    return(g_ui64SimCycles);
+}
+
+void
+SimCyclesAdvance(uint64_t ui64Cycles)
+{
+    g_ui64SimCycles += ui64Cycles;
+}
+
+uint64_t
+SimAccessesGet(void)
+{
+    return(g_ui64SimAccesses);
+}
@@ -0,0 +1,20 @@
+//*****************************************************************************
+//
+// cpu.h - Host simulator stub of the CPU instruction wrappers.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_CPU_H__
+#define __DRIVERLIB_CPU_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+extern uint32_t CPUcpsid(void);
+extern uint32_t CPUcpsie(void);
+extern uint32_t CPUprimask(void);
+extern void CPUwfi(void);
+extern uint32_t CPUbasepriGet(void);
+extern void CPUbasepriSet(uint32_t ui32NewBasepri);
+
+#endif // __DRIVERLIB_CPU_H__
@@ -0,0 +1,15 @@
+//*****************************************************************************
+//
+// debug.h - Assertion macro used by driverlib.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_DEBUG_H__
+#define __DRIVERLIB_DEBUG_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ASSERT(expr)
+
+#endif // __DRIVERLIB_DEBUG_H__
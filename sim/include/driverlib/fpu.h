@@ -0,0 +1,18 @@
+//*****************************************************************************
+//
+// fpu.h - Host simulator stub of the FPU API.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_FPU_H__
+#define __DRIVERLIB_FPU_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+extern void FPUEnable(void);
+extern void FPUDisable(void);
+extern void FPULazyStackingEnable(void);
+extern void FPUStackingEnable(void);
+
+#endif // __DRIVERLIB_FPU_H__
@@ -0,0 +1,13 @@
+//*****************************************************************************
+//
+// i2c.h - Host simulator stub of the I2C API (unused).
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_I2C_H__
+#define __DRIVERLIB_I2C_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#endif // __DRIVERLIB_I2C_H__
@@ -0,0 +1,20 @@
+//*****************************************************************************
+//
+// mpu.h - Host simulator stub of the MPU API.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_MPU_H__
+#define __DRIVERLIB_MPU_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define MPU_CONFIG_PRIV_DEFAULT 4
+#define MPU_CONFIG_HARDFLT_NMI  2
+#define MPU_CONFIG_NONE         0
+
+extern void MPUEnable(uint32_t ui32MPUConfig);
+extern void MPUDisable(void);
+
+#endif // __DRIVERLIB_MPU_H__
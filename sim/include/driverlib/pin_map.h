@@ -0,0 +1,20 @@
+//*****************************************************************************
+//
+// pin_map.h - Pin mux values used by the firmware.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_PIN_MAP_H__
+#define __DRIVERLIB_PIN_MAP_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define GPIO_PA0_U0RX           0x00000001
+#define GPIO_PA1_U0TX           0x00000401
+#define GPIO_PD0_SSI1CLK        0x00030002
+#define GPIO_PD1_SSI1FSS        0x00030402
+#define GPIO_PD2_SSI1RX         0x00030802
+#define GPIO_PD3_SSI1TX         0x00030C02
+
+#endif // __DRIVERLIB_PIN_MAP_H__
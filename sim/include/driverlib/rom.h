@@ -0,0 +1,66 @@
+//*****************************************************************************
+//
+// rom.h - Maps the ROM_ driverlib entry points onto the simulated flash versions.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_ROM_H__
+#define __DRIVERLIB_ROM_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "driverlib/sysctl.h"
+#include "driverlib/gpio.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/systick.h"
+#include "driverlib/timer.h"
+#include "driverlib/uart.h"
+#include "driverlib/ssi.h"
+#include "driverlib/adc.h"
+#include "driverlib/fpu.h"
+
+#define ROM_SysCtlClockSet              SysCtlClockSet
+#define ROM_SysCtlClockGet              SysCtlClockGet
+#define ROM_SysCtlPeripheralEnable      SysCtlPeripheralEnable
+#define ROM_SysCtlDelay                 SysCtlDelay
+#define ROM_SysCtlSleep                 SysCtlSleep
+#define ROM_GPIOPinConfigure            GPIOPinConfigure
+#define ROM_GPIOPinTypeUART             GPIOPinTypeUART
+#define ROM_GPIOPinTypeGPIOOutput       GPIOPinTypeGPIOOutput
+#define ROM_GPIOPinWrite                GPIOPinWrite
+#define ROM_IntMasterEnable             IntMasterEnable
+#define ROM_IntMasterDisable            IntMasterDisable
+#define ROM_IntEnable                   IntEnable
+#define ROM_IntDisable                  IntDisable
+#define ROM_IntPrioritySet              IntPrioritySet
+#define ROM_IntPriorityGroupingSet      IntPriorityGroupingSet
+#define ROM_SysTickPeriodSet            SysTickPeriodSet
+#define ROM_SysTickIntEnable            SysTickIntEnable
+#define ROM_SysTickEnable               SysTickEnable
+#define ROM_SysTickDisable              SysTickDisable
+#define ROM_TimerConfigure              TimerConfigure
+#define ROM_TimerLoadSet                TimerLoadSet
+#define ROM_TimerEnable                 TimerEnable
+#define ROM_TimerDisable                TimerDisable
+#define ROM_TimerIntEnable              TimerIntEnable
+#define ROM_TimerIntClear               TimerIntClear
+#define ROM_TimerValueGet               TimerValueGet
+#define ROM_UARTConfigSetExpClk         UARTConfigSetExpClk
+#define ROM_UARTCharGetNonBlocking      UARTCharGetNonBlocking
+#define ROM_UARTCharPutNonBlocking      UARTCharPutNonBlocking
+#define ROM_UARTCharsAvail              UARTCharsAvail
+#define ROM_UARTCharPut                 UARTCharPut
+#define ROM_UARTSpaceAvail              UARTSpaceAvail
+#define ROM_UARTIntEnable               UARTIntEnable
+#define ROM_UARTIntDisable              UARTIntDisable
+#define ROM_UARTIntStatus               UARTIntStatus
+#define ROM_UARTIntClear                UARTIntClear
+#define ROM_UARTFIFOLevelSet            UARTFIFOLevelSet
+#define ROM_UARTFIFOEnable              UARTFIFOEnable
+#define ROM_UARTTxIntModeSet            UARTTxIntModeSet
+#define ROM_UARTEnable                  UARTEnable
+#define ROM_UARTDisable                 UARTDisable
+#define ROM_UARTBusy                    UARTBusy
+
+#endif // __DRIVERLIB_ROM_H__
@@ -0,0 +1,42 @@
+//*****************************************************************************
+//
+// ssi.h - Host simulator stub of the SSI API.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_SSI_H__
+#define __DRIVERLIB_SSI_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SSI_TXFF                0x00000008
+#define SSI_RXFF                0x00000004
+#define SSI_RXTO                0x00000002
+#define SSI_RXOR                0x00000001
+
+#define SSI_FRF_MOTO_MODE_0     0x00000000
+#define SSI_FRF_MOTO_MODE_1     0x00000002
+#define SSI_FRF_MOTO_MODE_2     0x00000001
+#define SSI_FRF_MOTO_MODE_3     0x00000003
+
+#define SSI_MODE_MASTER         0x00000000
+#define SSI_MODE_SLAVE          0x00000001
+
+#define SSI_DMA_TX              0x00000002
+#define SSI_DMA_RX              0x00000001
+
+extern void SSIConfigSetExpClk(uint32_t ui32Base, uint32_t ui32SSIClk,
+                               uint32_t ui32Protocol, uint32_t ui32Mode,
+                               uint32_t ui32BitRate, uint32_t ui32DataWidth);
+extern void SSIEnable(uint32_t ui32Base);
+extern void SSIDisable(uint32_t ui32Base);
+extern void SSIIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags);
+extern void SSIIntDisable(uint32_t ui32Base, uint32_t ui32IntFlags);
+extern uint32_t SSIIntStatus(uint32_t ui32Base, bool bMasked);
+extern void SSIIntClear(uint32_t ui32Base, uint32_t ui32IntFlags);
+extern void SSIDataGet(uint32_t ui32Base, uint32_t *pui32Data);
+extern int32_t SSIDataGetNonBlocking(uint32_t ui32Base, uint32_t *pui32Data);
+extern void SSIDataPut(uint32_t ui32Base, uint32_t ui32Data);
+
+#endif // __DRIVERLIB_SSI_H__
@@ -0,0 +1,21 @@
+//*****************************************************************************
+//
+// systick.h - Host simulator stub of the SysTick API.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_SYSTICK_H__
+#define __DRIVERLIB_SYSTICK_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+extern void SysTickEnable(void);
+extern void SysTickDisable(void);
+extern void SysTickIntEnable(void);
+extern void SysTickIntDisable(void);
+extern void SysTickPeriodSet(uint32_t ui32Period);
+extern uint32_t SysTickPeriodGet(void);
+extern uint32_t SysTickValueGet(void);
+
+#endif // __DRIVERLIB_SYSTICK_H__
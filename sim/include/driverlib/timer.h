@@ -0,0 +1,43 @@
+//*****************************************************************************
+//
+// timer.h - Host simulator stub of the general purpose timer API.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_TIMER_H__
+#define __DRIVERLIB_TIMER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TIMER_CFG_ONE_SHOT      0x00000021
+#define TIMER_CFG_PERIODIC      0x00000022
+#define TIMER_CFG_PERIODIC_UP   0x00000032
+#define TIMER_CFG_SPLIT_PAIR    0x04000000
+#define TIMER_CFG_A_PERIODIC    0x00000002
+#define TIMER_CFG_B_PERIODIC    0x00000200
+
+#define TIMER_TIMA_TIMEOUT      0x00000001
+#define TIMER_TIMB_TIMEOUT      0x00000100
+
+#define TIMER_A                 0x000000ff
+#define TIMER_B                 0x0000ff00
+#define TIMER_BOTH              0x0000ffff
+
+extern void TimerEnable(uint32_t ui32Base, uint32_t ui32Timer);
+extern void TimerDisable(uint32_t ui32Base, uint32_t ui32Timer);
+extern void TimerConfigure(uint32_t ui32Base, uint32_t ui32Config);
+extern void TimerControlTrigger(uint32_t ui32Base, uint32_t ui32Timer,
+                                bool bEnable);
+extern void TimerControlStall(uint32_t ui32Base, uint32_t ui32Timer,
+                              bool bStall);
+extern void TimerLoadSet(uint32_t ui32Base, uint32_t ui32Timer,
+                         uint32_t ui32Value);
+extern uint32_t TimerLoadGet(uint32_t ui32Base, uint32_t ui32Timer);
+extern uint32_t TimerValueGet(uint32_t ui32Base, uint32_t ui32Timer);
+extern void TimerIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags);
+extern void TimerIntDisable(uint32_t ui32Base, uint32_t ui32IntFlags);
+extern uint32_t TimerIntStatus(uint32_t ui32Base, bool bMasked);
+extern void TimerIntClear(uint32_t ui32Base, uint32_t ui32IntFlags);
+
+#endif // __DRIVERLIB_TIMER_H__
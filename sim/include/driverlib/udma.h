@@ -0,0 +1,67 @@
+//*****************************************************************************
+//
+// udma.h - Host simulator stub of the micro DMA API.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_UDMA_H__
+#define __DRIVERLIB_UDMA_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct
+{
+    volatile void *pvSrcEndAddr;
+    volatile void *pvDstEndAddr;
+    volatile uint32_t ui32Control;
+    volatile uint32_t ui32Spare;
+}
+tDMAControlTable;
+
+#define UDMA_CHANNEL_ADC0       14
+#define UDMA_CHANNEL_UART0TX    9
+#define UDMA_PRI_SELECT         0x00000000
+#define UDMA_ALT_SELECT         0x00000020
+#define UDMA_SIZE_8             0x00000000
+#define UDMA_SIZE_16            0x11000000
+#define UDMA_SIZE_32            0x22000000
+#define UDMA_SRC_INC_8          0x00000000
+#define UDMA_SRC_INC_16         0x01000000
+#define UDMA_SRC_INC_32         0x02000000
+#define UDMA_SRC_INC_NONE       0x03000000
+#define UDMA_DST_INC_8          0x00000000
+#define UDMA_DST_INC_16         0x04000000
+#define UDMA_DST_INC_32         0x08000000
+#define UDMA_DST_INC_NONE       0x0c000000
+#define UDMA_ARB_1              0x00000000
+#define UDMA_ARB_4              0x00008000
+#define UDMA_ARB_8              0x0000c000
+#define UDMA_MODE_STOP          0x00000000
+#define UDMA_MODE_BASIC         0x00000001
+#define UDMA_MODE_PINGPONG      0x00000003
+#define UDMA_ATTR_USEBURST      0x00000001
+#define UDMA_ATTR_ALTSELECT     0x00000002
+#define UDMA_ATTR_HIGH_PRIORITY 0x00000004
+#define UDMA_ATTR_REQMASK       0x00000008
+#define UDMA_ATTR_ALL           0x0000000F
+
+extern void uDMAEnable(void);
+extern void uDMADisable(void);
+extern void uDMAControlBaseSet(void *pControlTable);
+extern void uDMAChannelAttributeDisable(uint32_t ui32ChannelNum,
+                                        uint32_t ui32Attr);
+extern void uDMAChannelAttributeEnable(uint32_t ui32ChannelNum,
+                                       uint32_t ui32Attr);
+extern void uDMAChannelControlSet(uint32_t ui32ChannelStructIndex,
+                                  uint32_t ui32Control);
+extern void uDMAChannelTransferSet(uint32_t ui32ChannelStructIndex,
+                                   uint32_t ui32Mode, void *pvSrcAddr,
+                                   void *pvDstAddr, uint32_t ui32TransferSize);
+extern void uDMAChannelEnable(uint32_t ui32ChannelNum);
+extern void uDMAChannelDisable(uint32_t ui32ChannelNum);
+extern bool uDMAChannelIsEnabled(uint32_t ui32ChannelNum);
+extern uint32_t uDMAChannelModeGet(uint32_t ui32ChannelStructIndex);
+extern uint32_t uDMAChannelSizeGet(uint32_t ui32ChannelStructIndex);
+
+#endif // __DRIVERLIB_UDMA_H__
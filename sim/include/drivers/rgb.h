@@ -0,0 +1,16 @@
+//*****************************************************************************
+//
+// rgb.h - Host simulator stub of the EK-TM4C123GXL RGB LED driver.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERS_RGB_H__
+#define __DRIVERS_RGB_H__
+
+#include <stdint.h>
+
+#define RED                     0
+#define GREEN                   1
+#define BLUE                    2
+
+#endif // __DRIVERS_RGB_H__
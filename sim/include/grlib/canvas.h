@@ -0,0 +1,94 @@
+//*****************************************************************************
+//
+// canvas.h - Host simulator version of the grlib canvas widget.
+//
+//*****************************************************************************
+
+#ifndef __CANVAS_H__
+#define __CANVAS_H__
+
+#include "grlib/widget.h"
+
+typedef struct
+{
+    tWidget sBase;
+    uint32_t ui32Style;
+    uint32_t ui32FillColor;
+    uint32_t ui32OutlineColor;
+    uint32_t ui32TextColor;
+    const tFont *psFont;
+    const char *pcText;
+    const uint8_t *pui8Image;
+    void (*pfnOnPaint)(tWidget *psWidget, tContext *psContext);
+}
+tCanvasWidget;
+
+#define CANVAS_STYLE_OUTLINE    0x00000001
+#define CANVAS_STYLE_FILL       0x00000002
+#define CANVAS_STYLE_TEXT       0x00000004
+#define CANVAS_STYLE_IMG        0x00000008
+#define CANVAS_STYLE_APP_DRAWN  0x00000010
+#define CANVAS_STYLE_TEXT_OPAQUE 0x00000020
+
+#define CanvasStruct(psParent, psNext, psChild, psDisplay, i32X, i32Y,       \
+                     i32Width, i32Height, ui32Style, ui32FillColor,          \
+                     ui32OutlineColor, ui32TextColor, psFont, pcText,        \
+                     pui8Image, pfnOnPaint)                                  \
+        {                                                                    \
+            {                                                                \
+                sizeof(tCanvasWidget),                                       \
+                (tWidget *)(psParent),                                       \
+                (tWidget *)(psNext),                                         \
+                (tWidget *)(psChild),                                        \
+                psDisplay,                                                   \
+                {                                                            \
+                    i32X,                                                    \
+                    i32Y,                                                    \
+                    (i32X) + (i32Width) - 1,                                 \
+                    (i32Y) + (i32Height) - 1                                 \
+                },                                                           \
+                CanvasMsgProc                                                \
+            },                                                               \
+            ui32Style,                                                       \
+            ui32FillColor,                                                   \
+            ui32OutlineColor,                                                \
+            ui32TextColor,                                                   \
+            psFont,                                                          \
+            pcText,                                                          \
+            pui8Image,                                                       \
+            pfnOnPaint                                                       \
+        }
+
+#define Canvas(sName, psParent, psNext, psChild, psDisplay, i32X, i32Y,      \
+               i32Width, i32Height, ui32Style, ui32FillColor,                \
+               ui32OutlineColor, ui32TextColor, psFont, pcText, pui8Image,   \
+               pfnOnPaint)                                                   \
+        tCanvasWidget sName =                                                \
+            CanvasStruct(psParent, psNext, psChild, psDisplay, i32X, i32Y,   \
+                         i32Width, i32Height, ui32Style, ui32FillColor,      \
+                         ui32OutlineColor, ui32TextColor, psFont, pcText,    \
+                         pui8Image, pfnOnPaint)
+
+#define CanvasFillColorSet(psWidget, ui32Color)                              \
+        do                                                                   \
+        {                                                                    \
+            (psWidget)->ui32FillColor = ui32Color;                           \
+        }                                                                    \
+        while(0)
+#define CanvasTextSet(psWidget, pcTxt)                                       \
+        do                                                                   \
+        {                                                                    \
+            (psWidget)->pcText = pcTxt;                                      \
+        }                                                                    \
+        while(0)
+#define CanvasImageSet(psWidget, pImg)                                       \
+        do                                                                   \
+        {                                                                    \
+            (psWidget)->pui8Image = pImg;                                    \
+        }                                                                    \
+        while(0)
+
+extern int32_t CanvasMsgProc(tWidget *psWidget, uint32_t ui32Msg,
+                             uint32_t ui32Param1, uint32_t ui32Param2);
+
+#endif // __CANVAS_H__
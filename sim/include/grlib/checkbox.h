@@ -0,0 +1,12 @@
+//*****************************************************************************
+//
+// checkbox.h - Not used by the firmware; present so the include list resolves.
+//
+//*****************************************************************************
+
+#ifndef __CHECKBOX_H__
+#define __CHECKBOX_H__
+
+#include "grlib/widget.h"
+
+#endif // __CHECKBOX_H__
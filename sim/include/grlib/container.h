@@ -0,0 +1,12 @@
+//*****************************************************************************
+//
+// container.h - Not used by the firmware; present so the include list resolves.
+//
+//*****************************************************************************
+
+#ifndef __CONTAINER_H__
+#define __CONTAINER_H__
+
+#include "grlib/widget.h"
+
+#endif // __CONTAINER_H__
@@ -0,0 +1,246 @@
+//*****************************************************************************
+//
+// grlib.h - Host simulator subset of the TivaWare graphics library API.
+//
+// Only the types, macros and entry points used by the firmware are provided.
+// Structure layouts match TivaWare 2.x so that the firmware's static widget
+// initializers and display driver compile unchanged.
+//
+//*****************************************************************************
+
+#ifndef __GRLIB_H__
+#define __GRLIB_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//*****************************************************************************
+//
+// Rectangle, display, font and context definitions.
+//
+//*****************************************************************************
+typedef struct
+{
+    int16_t i16XMin;
+    int16_t i16YMin;
+    int16_t i16XMax;
+    int16_t i16YMax;
+}
+tRectangle;
+
+typedef struct
+{
+    int32_t i32Size;
+    void *pvDisplayData;
+    uint16_t ui16Width;
+    uint16_t ui16Height;
+    void (*pfnPixelDraw)(void *pvDisplayData, int32_t i32X, int32_t i32Y,
+                         uint32_t ui32Value);
+    void (*pfnPixelDrawMultiple)(void *pvDisplayData, int32_t i32X,
+                                 int32_t i32Y, int32_t i32X0, int32_t i32Count,
+                                 int32_t i32BPP, const uint8_t *pui8Data,
+                                 const uint8_t *pui8Palette);
+    void (*pfnLineDrawH)(void *pvDisplayData, int32_t i32X1, int32_t i32X2,
+                         int32_t i32Y, uint32_t ui32Value);
+    void (*pfnLineDrawV)(void *pvDisplayData, int32_t i32X, int32_t i32Y1,
+                         int32_t i32Y2, uint32_t ui32Value);
+    void (*pfnRectFill)(void *pvDisplayData, const tRectangle *psRect,
+                        uint32_t ui32Value);
+    uint32_t (*pfnColorTranslate)(void *pvDisplayData, uint32_t ui32Value);
+    void (*pfnFlush)(void *pvDisplayData);
+}
+tDisplay;
+
+//
+// The simulator fonts are scaled renderings of a built-in 5x7 cell font; the
+// structure only carries the metrics the layout code depends on.
+//
+typedef struct
+{
+    uint8_t ui8Format;
+    uint8_t ui8MaxWidth;
+    uint8_t ui8Height;
+    uint8_t ui8Baseline;
+    uint8_t ui8Scale;
+}
+tFont;
+
+typedef struct _Context
+{
+    int32_t i32Size;
+    const tDisplay *psDisplay;
+    tRectangle sClipRegion;
+    uint32_t ui32Foreground;
+    uint32_t ui32Background;
+    const tFont *psFont;
+}
+tContext;
+
+//*****************************************************************************
+//
+// Image formats.
+//
+//*****************************************************************************
+#define IMAGE_FMT_1BPP_UNCOMP   0x01
+#define IMAGE_FMT_2BPP_UNCOMP   0x02
+#define IMAGE_FMT_4BPP_UNCOMP   0x04
+#define IMAGE_FMT_8BPP_UNCOMP   0x08
+#define IMAGE_FMT_1BPP_COMP     0x81
+#define IMAGE_FMT_2BPP_COMP     0x82
+#define IMAGE_FMT_4BPP_COMP     0x84
+#define IMAGE_FMT_8BPP_COMP     0x88
+
+//*****************************************************************************
+//
+// Display and context helpers.
+//
+//*****************************************************************************
+#define DpyWidthGet(psDisplay)  ((psDisplay)->ui16Width)
+#define DpyHeightGet(psDisplay) ((psDisplay)->ui16Height)
+#define DpyPixelDraw(psDisplay, i32X, i32Y, ui32Value)                       \
+        ((psDisplay)->pfnPixelDraw((psDisplay)->pvDisplayData, i32X, i32Y,    \
+                                   ui32Value))
+#define DpyPixelDrawMultiple(psDisplay, i32X, i32Y, i32X0, i32Count, i32BPP, \
+                             pui8Data, pui8Palette)                          \
+        ((psDisplay)->pfnPixelDrawMultiple((psDisplay)->pvDisplayData, i32X,  \
+                                           i32Y, i32X0, i32Count, i32BPP,    \
+                                           pui8Data, pui8Palette))
+#define DpyLineDrawH(psDisplay, i32X1, i32X2, i32Y, ui32Value)               \
+        ((psDisplay)->pfnLineDrawH((psDisplay)->pvDisplayData, i32X1, i32X2,  \
+                                   i32Y, ui32Value))
+#define DpyLineDrawV(psDisplay, i32X, i32Y1, i32Y2, ui32Value)               \
+        ((psDisplay)->pfnLineDrawV((psDisplay)->pvDisplayData, i32X, i32Y1,   \
+                                   i32Y2, ui32Value))
+#define DpyRectFill(psDisplay, psRect, ui32Value)                            \
+        ((psDisplay)->pfnRectFill((psDisplay)->pvDisplayData, psRect,         \
+                                  ui32Value))
+#define DpyColorTranslate(psDisplay, ui32Value)                              \
+        ((psDisplay)->pfnColorTranslate((psDisplay)->pvDisplayData,           \
+                                        ui32Value))
+#define DpyFlush(psDisplay)                                                  \
+        ((psDisplay)->pfnFlush((psDisplay)->pvDisplayData))
+
+#define GrContextForegroundSet(psContext, ui32Value)                         \
+        do                                                                   \
+        {                                                                    \
+            tContext *psC = (psContext);                                     \
+            psC->ui32Foreground = DpyColorTranslate(psC->psDisplay,          \
+                                                    ui32Value);              \
+        }                                                                    \
+        while(0)
+#define GrContextForegroundSetTranslated(psContext, ui32Value)               \
+        do                                                                   \
+        {                                                                    \
+            (psContext)->ui32Foreground = (ui32Value);                       \
+        }                                                                    \
+        while(0)
+#define GrContextBackgroundSet(psContext, ui32Value)                         \
+        do                                                                   \
+        {                                                                    \
+            tContext *psC = (psContext);                                     \
+            psC->ui32Background = DpyColorTranslate(psC->psDisplay,          \
+                                                    ui32Value);              \
+        }                                                                    \
+        while(0)
+#define GrContextFontSet(psContext, psFnt)                                   \
+        do                                                                   \
+        {                                                                    \
+            (psContext)->psFont = (psFnt);                                   \
+        }                                                                    \
+        while(0)
+#define GrContextDpyWidthGet(psContext) DpyWidthGet((psContext)->psDisplay)
+#define GrContextDpyHeightGet(psContext) DpyHeightGet((psContext)->psDisplay)
+#define GrFlush(psContext)      DpyFlush((psContext)->psDisplay)
+#define GrFontHeightGet(psFont) ((psFont)->ui8Height)
+#define GrFontMaxWidthGet(psFont) ((psFont)->ui8MaxWidth)
+#define GrStringHeightGet(psContext) ((psContext)->psFont->ui8Height)
+#define GrStringMaxWidthGet(psContext) ((psContext)->psFont->ui8MaxWidth)
+#define GrImageWidthGet(pui8Image)                                           \
+        ((int32_t)((pui8Image)[1] | ((pui8Image)[2] << 8)))
+#define GrImageHeightGet(pui8Image)                                          \
+        ((int32_t)((pui8Image)[3] | ((pui8Image)[4] << 8)))
+#define GrStringDrawCentered(psContext, pcString, i32Length, i32X, i32Y,     \
+                             bOpaque)                                        \
+        do                                                                   \
+        {                                                                    \
+            const tContext *psC = (psContext);                               \
+            const char *pcStr = (pcString);                                  \
+                                                                             \
+            GrStringDraw(psC, pcStr, (i32Length),                            \
+                         (i32X) - (GrStringWidthGet(psC, pcStr,              \
+                                                    (i32Length)) / 2),       \
+                         (i32Y) - (psC->psFont->ui8Height / 2), bOpaque);    \
+        }                                                                    \
+        while(0)
+
+//*****************************************************************************
+//
+// Colors.
+//
+//*****************************************************************************
+#define ClrBlack                0x00000000
+#define ClrBrown                0x00A52A2A
+#define ClrDarkBlue             0x0000008B
+#define ClrGold                 0x00FFD700
+#define ClrGray                 0x00808080
+#define ClrLightGreen           0x0090EE90
+#define ClrLime                 0x0000FF00
+#define ClrLimeGreen            0x0032CD32
+#define ClrRed                  0x00FF0000
+#define ClrSeashell             0x00FFF5EE
+#define ClrSilver               0x00C0C0C0
+#define ClrSlateBlue            0x006A5ACD
+#define ClrWhite                0x00FFFFFF
+#define ClrYellow               0x00FFFF00
+#define ClrBlue                 0x000000FF
+#define ClrGreen                0x00008000
+#define ClrOrange               0x00FFA500
+#define ClrDarkGray             0x00A9A9A9
+#define ClrDarkGreen            0x00006400
+#define ClrDarkRed              0x008B0000
+#define ClrCyan                 0x0000FFFF
+#define ClrMagenta              0x00FF00FF
+#define ClrNavy                 0x00000080
+
+//*****************************************************************************
+//
+// Fonts.
+//
+//*****************************************************************************
+extern const tFont g_sFontCm12;
+extern const tFont g_sFontCm14;
+extern const tFont g_sFontCm16;
+extern const tFont g_sFontCm20;
+
+//*****************************************************************************
+//
+// Drawing functions.
+//
+//*****************************************************************************
+extern void GrContextInit(tContext *psContext, const tDisplay *psDisplay);
+extern void GrContextClipRegionSet(tContext *psContext, tRectangle *psRect);
+extern void GrCircleDraw(const tContext *psContext, int32_t i32X, int32_t i32Y,
+                         int32_t i32Radius);
+extern void GrCircleFill(const tContext *psContext, int32_t i32X, int32_t i32Y,
+                         int32_t i32Radius);
+extern void GrImageDraw(const tContext *psContext, const uint8_t *pui8Image,
+                        int32_t i32X, int32_t i32Y);
+extern void GrLineDraw(const tContext *psContext, int32_t i32X1, int32_t i32Y1,
+                       int32_t i32X2, int32_t i32Y2);
+extern void GrLineDrawH(const tContext *psContext, int32_t i32X1,
+                        int32_t i32X2, int32_t i32Y);
+extern void GrLineDrawV(const tContext *psContext, int32_t i32X,
+                        int32_t i32Y1, int32_t i32Y2);
+extern void GrPixelDraw(const tContext *psContext, int32_t i32X, int32_t i32Y);
+extern void GrRectDraw(const tContext *psContext, const tRectangle *psRect);
+extern void GrRectFill(const tContext *psContext, const tRectangle *psRect);
+extern void GrStringDraw(const tContext *psContext, const char *pcString,
+                         int32_t i32Length, int32_t i32X, int32_t i32Y,
+                         uint32_t bOpaque);
+extern int32_t GrStringWidthGet(const tContext *psContext,
+                                const char *pcString, int32_t i32Length);
+extern bool GrRectOverlapCheck(tRectangle *psRect1, tRectangle *psRect2);
+extern int32_t GrRectIntersectGet(tRectangle *psRect1, tRectangle *psRect2,
+                                  tRectangle *psIntersect);
+
+#endif // __GRLIB_H__
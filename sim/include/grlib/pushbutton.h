@@ -0,0 +1,152 @@
+//*****************************************************************************
+//
+// pushbutton.h - Host simulator version of the grlib push button widget.
+//
+//*****************************************************************************
+
+#ifndef __PUSHBUTTON_H__
+#define __PUSHBUTTON_H__
+
+#include "grlib/widget.h"
+
+typedef struct
+{
+    tWidget sBase;
+    uint32_t ui32Style;
+    uint32_t ui32FillColor;
+    uint32_t ui32PressFillColor;
+    uint32_t ui32OutlineColor;
+    uint32_t ui32TextColor;
+    const tFont *psFont;
+    const char *pcText;
+    const uint8_t *pui8Image;
+    const uint8_t *pui8PressImage;
+    uint16_t ui16AutoRepeatDelay;
+    uint16_t ui16AutoRepeatRate;
+    uint32_t ui32AutoRepeatCount;
+    void (*pfnOnClick)(tWidget *psWidget);
+}
+tPushButtonWidget;
+
+#define PB_STYLE_OUTLINE        0x00000001
+#define PB_STYLE_FILL           0x00000002
+#define PB_STYLE_TEXT           0x00000004
+#define PB_STYLE_IMG            0x00000008
+#define PB_STYLE_TEXT_OPAQUE    0x00000010
+#define PB_STYLE_AUTO_REPEAT    0x00000020
+#define PB_STYLE_PRESSED        0x00000040
+#define PB_STYLE_RELEASE_NOTIFY 0x00000080
+
+#define RectangularButtonStruct(psParent, psNext, psChild, psDisplay, i32X,  \
+                                i32Y, i32Width, i32Height, ui32Style,        \
+                                ui32FillColor, ui32PressFillColor,           \
+                                ui32OutlineColor, ui32TextColor, psFont,     \
+                                pcText, pui8Image, pui8PressImage,           \
+                                ui16AutoRepeatDelay, ui16AutoRepeatRate,     \
+                                pfnOnClick)                                  \
+        {                                                                    \
+            {                                                                \
+                sizeof(tPushButtonWidget),                                   \
+                (tWidget *)(psParent),                                       \
+                (tWidget *)(psNext),                                         \
+                (tWidget *)(psChild),                                        \
+                psDisplay,                                                   \
+                {                                                            \
+                    i32X,                                                    \
+                    i32Y,                                                    \
+                    (i32X) + (i32Width) - 1,                                 \
+                    (i32Y) + (i32Height) - 1                                 \
+                },                                                           \
+                RectangularButtonMsgProc                                     \
+            },                                                               \
+            ui32Style,                                                       \
+            ui32FillColor,                                                   \
+            ui32PressFillColor,                                              \
+            ui32OutlineColor,                                                \
+            ui32TextColor,                                                   \
+            psFont,                                                          \
+            pcText,                                                          \
+            pui8Image,                                                       \
+            pui8PressImage,                                                  \
+            ui16AutoRepeatDelay,                                             \
+            ui16AutoRepeatRate,                                              \
+            0,                                                               \
+            pfnOnClick                                                       \
+        }
+
+#define RectangularButton(sName, psParent, psNext, psChild, psDisplay, i32X, \
+                          i32Y, i32Width, i32Height, ui32Style,              \
+                          ui32FillColor, ui32PressFillColor,                 \
+                          ui32OutlineColor, ui32TextColor, psFont, pcText,   \
+                          pui8Image, pui8PressImage, ui16AutoRepeatDelay,    \
+                          ui16AutoRepeatRate, pfnOnClick)                    \
+        tPushButtonWidget sName =                                            \
+            RectangularButtonStruct(psParent, psNext, psChild, psDisplay,    \
+                                    i32X, i32Y, i32Width, i32Height,         \
+                                    ui32Style, ui32FillColor,                \
+                                    ui32PressFillColor, ui32OutlineColor,    \
+                                    ui32TextColor, psFont, pcText,           \
+                                    pui8Image, pui8PressImage,               \
+                                    ui16AutoRepeatDelay, ui16AutoRepeatRate, \
+                                    pfnOnClick)
+
+#define PushButtonFillColorSet(psWidget, ui32Color)                          \
+        do                                                                   \
+        {                                                                    \
+            (psWidget)->ui32FillColor = ui32Color;                           \
+        }                                                                    \
+        while(0)
+#define PushButtonFillOn(psWidget)                                           \
+        do                                                                   \
+        {                                                                    \
+            (psWidget)->ui32Style |= PB_STYLE_FILL;                          \
+        }                                                                    \
+        while(0)
+#define PushButtonFillOff(psWidget)                                          \
+        do                                                                   \
+        {                                                                    \
+            (psWidget)->ui32Style &= ~(PB_STYLE_FILL);                       \
+        }                                                                    \
+        while(0)
+#define PushButtonImageOn(psWidget)                                          \
+        do                                                                   \
+        {                                                                    \
+            (psWidget)->ui32Style |= PB_STYLE_IMG;                           \
+        }                                                                    \
+        while(0)
+#define PushButtonImageOff(psWidget)                                         \
+        do                                                                   \
+        {                                                                    \
+            (psWidget)->ui32Style &= ~(PB_STYLE_IMG);                        \
+        }                                                                    \
+        while(0)
+#define PushButtonTextOn(psWidget)                                           \
+        do                                                                   \
+        {                                                                    \
+            (psWidget)->ui32Style |= PB_STYLE_TEXT;                          \
+        }                                                                    \
+        while(0)
+#define PushButtonTextOff(psWidget)                                          \
+        do                                                                   \
+        {                                                                    \
+            (psWidget)->ui32Style &= ~(PB_STYLE_TEXT);                       \
+        }                                                                    \
+        while(0)
+#define PushButtonTextSet(psWidget, pcTxt)                                   \
+        do                                                                   \
+        {                                                                    \
+            (psWidget)->pcText = pcTxt;                                      \
+        }                                                                    \
+        while(0)
+#define PushButtonImageSet(psWidget, pImg)                                   \
+        do                                                                   \
+        {                                                                    \
+            (psWidget)->pui8Image = pImg;                                    \
+        }                                                                    \
+        while(0)
+
+extern int32_t RectangularButtonMsgProc(tWidget *psWidget, uint32_t ui32Msg,
+                                        uint32_t ui32Param1,
+                                        uint32_t ui32Param2);
+
+#endif // __PUSHBUTTON_H__
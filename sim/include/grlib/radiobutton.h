@@ -0,0 +1,12 @@
+//*****************************************************************************
+//
+// radiobutton.h - Not used by the firmware; present so the include list resolves.
+//
+//*****************************************************************************
+
+#ifndef __RADIOBUTTON_H__
+#define __RADIOBUTTON_H__
+
+#include "grlib/widget.h"
+
+#endif // __RADIOBUTTON_H__
@@ -0,0 +1,12 @@
+//*****************************************************************************
+//
+// slider.h - Not used by the firmware; present so the include list resolves.
+//
+//*****************************************************************************
+
+#ifndef __SLIDER_H__
+#define __SLIDER_H__
+
+#include "grlib/widget.h"
+
+#endif // __SLIDER_H__
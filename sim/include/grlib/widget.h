@@ -0,0 +1,63 @@
+//*****************************************************************************
+//
+// widget.h - Host simulator subset of the grlib widget framework.
+//
+//*****************************************************************************
+
+#ifndef __WIDGET_H__
+#define __WIDGET_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "grlib/grlib.h"
+
+typedef struct _Widget
+{
+    int32_t i32Size;
+    struct _Widget *psParent;
+    struct _Widget *psNext;
+    struct _Widget *psChild;
+    const tDisplay *psDisplay;
+    tRectangle sPosition;
+    int32_t (*pfnMsgProc)(struct _Widget *psWidget, uint32_t ui32Message,
+                          uint32_t ui32Param1, uint32_t ui32Param2);
+}
+tWidget;
+
+#define WIDGET_ROOT             &g_sRoot
+
+#define WIDGET_MSG_PAINT        0x00000001
+#define WIDGET_MSG_PTR_DOWN     0x00000002
+#define WIDGET_MSG_PTR_MOVE     0x00000003
+#define WIDGET_MSG_PTR_UP       0x00000004
+
+#define MQ_FLAG_POST_ORDER      1
+#define MQ_FLAG_STOP_ON_SUCCESS 2
+
+extern tWidget g_sRoot;
+
+extern int32_t WidgetDefaultMsgProc(tWidget *psWidget, uint32_t ui32Message,
+                                    uint32_t ui32Param1, uint32_t ui32Param2);
+extern void WidgetAdd(tWidget *psParent, tWidget *psWidget);
+extern void WidgetRemove(tWidget *psWidget);
+extern uint32_t WidgetMessageSendPreOrder(tWidget *psWidget,
+                                          uint32_t ui32Message,
+                                          uint32_t ui32Param1,
+                                          uint32_t ui32Param2,
+                                          bool bStopOnSuccess);
+extern uint32_t WidgetMessageSendPostOrder(tWidget *psWidget,
+                                           uint32_t ui32Message,
+                                           uint32_t ui32Param1,
+                                           uint32_t ui32Param2,
+                                           bool bStopOnSuccess);
+extern int32_t WidgetMessageQueueAdd(tWidget *psWidget, uint32_t ui32Message,
+                                     uint32_t ui32Param1, uint32_t ui32Param2,
+                                     bool bPostOrder, bool bStopOnSuccess);
+extern void WidgetMessageQueueProcess(void);
+extern int32_t WidgetPointerMessage(uint32_t ui32Message, int32_t i32X,
+                                    int32_t i32Y);
+
+#define WidgetPaint(psWidget)                                                \
+        WidgetMessageQueueAdd(psWidget, WIDGET_MSG_PAINT, 0, 0, 0, 0)
+
+#endif // __WIDGET_H__
@@ -0,0 +1,28 @@
+//*****************************************************************************
+//
+// hw_adc.h - ADC register offsets used by the firmware.
+//
+//*****************************************************************************
+
+#ifndef __HW_ADC_H__
+#define __HW_ADC_H__
+
+#define ADC_O_ACTSS             0x00000000
+#define ADC_O_RIS               0x00000004
+#define ADC_O_IM                0x00000008
+#define ADC_O_ISC               0x0000000C
+#define ADC_O_EMUX              0x00000014
+#define ADC_O_PSSI              0x00000028
+#define ADC_O_SAC               0x00000030
+#define ADC_O_SSMUX0            0x00000040
+#define ADC_O_SSCTL0            0x00000044
+#define ADC_O_SSFIFO0           0x00000048
+#define ADC_O_SSFSTAT0          0x0000004C
+#define ADC_O_SSMUX3            0x000000A0
+#define ADC_O_SSCTL3            0x000000A4
+#define ADC_O_SSFIFO3           0x000000A8
+#define ADC_O_SSFSTAT3          0x000000AC
+
+#define ADC_SSFSTAT0_EMPTY      0x00000100
+
+#endif // __HW_ADC_H__
@@ -0,0 +1,20 @@
+//*****************************************************************************
+//
+// hw_gpio.h - GPIO register offsets used by the firmware.
+//
+//*****************************************************************************
+
+#ifndef __HW_GPIO_H__
+#define __HW_GPIO_H__
+
+#define GPIO_O_DATA             0x00000000
+#define GPIO_O_DIR              0x00000400
+#define GPIO_O_IS               0x00000404
+#define GPIO_O_IM               0x00000410
+#define GPIO_O_ICR              0x0000041C
+#define GPIO_O_AFSEL            0x00000420
+#define GPIO_O_DEN              0x0000051C
+#define GPIO_O_AMSEL            0x00000528
+#define GPIO_O_PCTL             0x0000052C
+
+#endif // __HW_GPIO_H__
@@ -0,0 +1,12 @@
+//*****************************************************************************
+//
+// hw_i2c.h - I2C register offsets (unused by the simulator).
+//
+//*****************************************************************************
+
+#ifndef __HW_I2C_H__
+#define __HW_I2C_H__
+
+#define I2C_O_MSA               0x00000000
+
+#endif // __HW_I2C_H__
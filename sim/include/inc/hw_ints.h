@@ -0,0 +1,50 @@
+//*****************************************************************************
+//
+// hw_ints.h - Interrupt assignments of the TM4C123 class devices.
+//
+//*****************************************************************************
+
+#ifndef __HW_INTS_H__
+#define __HW_INTS_H__
+
+#define FAULT_NMI               2
+#define FAULT_HARD              3
+#define FAULT_MPU               4
+#define FAULT_BUS               5
+#define FAULT_USAGE             6
+#define FAULT_SVCALL            11
+#define FAULT_DEBUG             12
+#define FAULT_PENDSV            14
+#define FAULT_SYSTICK           15
+
+#define INT_GPIOA               16
+#define INT_GPIOB               17
+#define INT_GPIOC               18
+#define INT_GPIOD               19
+#define INT_GPIOE               20
+#define INT_UART0               21
+#define INT_UART1               22
+#define INT_SSI0                23
+#define INT_I2C0                24
+#define INT_ADC0SS0             30
+#define INT_ADC0SS1             31
+#define INT_ADC0SS2             32
+#define INT_ADC0SS3             33
+#define INT_WATCHDOG            34
+#define INT_TIMER0A             35
+#define INT_TIMER0B             36
+#define INT_TIMER1A             37
+#define INT_TIMER1B             38
+#define INT_TIMER2A             39
+#define INT_TIMER2B             40
+#define INT_GPIOF               46
+#define INT_UART2               49
+#define INT_SSI1                50
+#define INT_TIMER3A             51
+#define INT_TIMER3B             52
+#define INT_UDMA                62
+#define INT_UDMAERR             63
+
+#define NUM_INTERRUPTS          155
+
+#endif // __HW_INTS_H__
@@ -0,0 +1,28 @@
+//*****************************************************************************
+//
+// hw_nvic.h - NVIC, SysTick and debug register addresses.
+//
+//*****************************************************************************
+
+#ifndef __HW_NVIC_H__
+#define __HW_NVIC_H__
+
+#define NVIC_ST_CTRL            0xE000E010
+#define NVIC_ST_RELOAD          0xE000E014
+#define NVIC_ST_CURRENT         0xE000E018
+#define NVIC_ACTIVE0            0xE000E300
+#define NVIC_INT_CTRL           0xE000ED04
+#define NVIC_APINT              0xE000ED0C
+#define NVIC_SYS_CTRL           0xE000ED10
+#define NVIC_SYS_PRI2           0xE000ED1C
+#define NVIC_SYS_PRI3           0xE000ED20
+#define NVIC_DBG_CTRL           0xE000EDF0
+#define NVIC_DBG_XFER           0xE000EDF8
+
+#define NVIC_INT_CTRL_PEND_SV   0x10000000
+#define NVIC_INT_CTRL_UNPEND_SV 0x08000000
+#define NVIC_INT_CTRL_VEC_ACT_M 0x000000FF
+
+#define NVIC_SYS_CTRL_SLEEPDEEP 0x00000004
+
+#endif // __HW_NVIC_H__
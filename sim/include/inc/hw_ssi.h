@@ -0,0 +1,22 @@
+//*****************************************************************************
+//
+// hw_ssi.h - SSI register offsets.
+//
+//*****************************************************************************
+
+#ifndef __HW_SSI_H__
+#define __HW_SSI_H__
+
+#define SSI_O_CR0               0x00000000
+#define SSI_O_CR1               0x00000004
+#define SSI_O_DR                0x00000008
+#define SSI_O_SR                0x0000000C
+#define SSI_O_IM                0x00000014
+#define SSI_O_RIS               0x00000018
+#define SSI_O_MIS               0x0000001C
+#define SSI_O_ICR               0x00000020
+
+#define SSI_SR_RFF              0x00000008
+#define SSI_SR_RNE              0x00000004
+
+#endif // __HW_SSI_H__
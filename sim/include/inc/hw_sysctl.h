@@ -0,0 +1,13 @@
+//*****************************************************************************
+//
+// hw_sysctl.h - System control register addresses.
+//
+//*****************************************************************************
+
+#ifndef __HW_SYSCTL_H__
+#define __HW_SYSCTL_H__
+
+#define SYSCTL_RCC              0x400FE060
+#define SYSCTL_RCC2             0x400FE070
+
+#endif // __HW_SYSCTL_H__
@@ -0,0 +1,41 @@
+//*****************************************************************************
+//
+// hw_types.h - Host simulator replacement for the TivaWare register access
+//              macros.  Every peripheral register lives in a sparse register
+//              file owned by hw.c so that firmware code using HWREG() can run
+//              unmodified on a Linux host.
+//
+//*****************************************************************************
+
+#ifndef __HW_TYPES_H__
+#define __HW_TYPES_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//*****************************************************************************
+//
+// Returns the host address backing the given target register address.
+//
+//*****************************************************************************
+extern volatile uint32_t *SimRegister(uint32_t ui32Addr);
+
+#define HWREG(x)                (*((volatile uint32_t *)SimRegister(x)))
+#define HWREGH(x)               (*((volatile uint16_t *)SimRegister(x)))
+#define HWREGB(x)               (*((volatile uint8_t *)SimRegister(x)))
+#define HWREGBITW(x, b)         (((*SimRegister(x)) >> (b)) & 1)
+
+//*****************************************************************************
+//
+// Device class helpers referenced by driverlib headers.
+//
+//*****************************************************************************
+#define CLASS_IS_TM4C123        1
+#define CLASS_IS_TM4C129        0
+#define REVISION_IS_A0          0
+#define REVISION_IS_A1          0
+#define REVISION_IS_A2          0
+#define REVISION_IS_B0          0
+#define REVISION_IS_B1          0
+
+#endif // __HW_TYPES_H__
@@ -0,0 +1,29 @@
+//*****************************************************************************
+//
+// hw_uart.h - UART register offsets.
+//
+//*****************************************************************************
+
+#ifndef __HW_UART_H__
+#define __HW_UART_H__
+
+#define UART_O_DR               0x00000000
+#define UART_O_FR               0x00000018
+#define UART_O_IBRD             0x00000024
+#define UART_O_FBRD             0x00000028
+#define UART_O_LCRH             0x0000002C
+#define UART_O_CTL              0x00000030
+#define UART_O_IM               0x00000038
+#define UART_O_MIS              0x00000040
+#define UART_O_ICR              0x00000044
+#define UART_O_CC               0x00000FC8
+
+#define UART_FR_TXFE            0x00000080
+#define UART_FR_RXFF            0x00000040
+#define UART_FR_TXFF            0x00000020
+#define UART_FR_RXFE            0x00000010
+#define UART_FR_BUSY            0x00000008
+
+#define UART_CTL_HSE            0x00000020
+
+#endif // __HW_UART_H__
@@ -0,0 +1,31 @@
+//*****************************************************************************
+//
+// cmdline.h - Host simulator version of the TivaWare command line processor.
+//
+//*****************************************************************************
+
+#ifndef __CMDLINE_H__
+#define __CMDLINE_H__
+
+#define CMDLINE_BAD_CMD         (-1)
+#define CMDLINE_TOO_MANY_ARGS   (-2)
+
+#ifndef CMDLINE_MAX_ARGS
+#define CMDLINE_MAX_ARGS        8
+#endif
+
+typedef int (*pfnCmdLine)(int argc, char *argv[]);
+
+typedef struct
+{
+    const char *pcCmd;
+    pfnCmdLine pfnCmd;
+    const char *pcHelp;
+}
+tCmdLineEntry;
+
+extern tCmdLineEntry g_psCmdTable[];
+
+extern int CmdLineProcess(char *pcCmdLine);
+
+#endif // __CMDLINE_H__
@@ -0,0 +1,25 @@
+//*****************************************************************************
+//
+// ustdlib.h - Host simulator version of the TivaWare small stdlib subset.
+//
+//*****************************************************************************
+
+#ifndef __USTDLIB_H__
+#define __USTDLIB_H__
+
+#include <stdarg.h>
+#include <stdint.h>
+
+extern int usprintf(char *pcBuf, const char *pcString, ...);
+extern int usnprintf(char *pcBuf, uint32_t ui32Size, const char *pcString,
+                     ...);
+extern int uvsnprintf(char *pcBuf, uint32_t ui32Size, const char *pcString,
+                      va_list vaArgP);
+extern int ustrncmp(const char *pcS1, const char *pcS2, uint32_t ui32N);
+extern int ustrcmp(const char *pcS1, const char *pcS2);
+extern uint32_t ustrtoul(const char *pcStr, const char **ppcStrRet,
+                         int iBase);
+extern float ustrtof(const char *pcStr, const char **ppcStrRet);
+extern uint32_t ustrlen(const char *pcStr);
+
+#endif // __USTDLIB_H__
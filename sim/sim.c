@@ -0,0 +1,957 @@
+//*****************************************************************************
+//
+// sim.c - Host simulator run control: the command line, the stimulus file,
+//         the render probes and the bus benchmark.
+//
+// The firmware runs unmodified on the host.  Time is simulated: it advances
+// with every register access and jumps forward whenever the firmware waits
+// for an interrupt.  A stimulus file drives the SSI1 link and the touch
+// screen at given times and, whenever the firmware is idle, checks pixels of
+// the virtual display or dumps it to a PPM image.
+//
+// Stimulus lines have the form "<time ms> <command> [arguments]":
+//
+//     reg <index> <value>        send a register update over SSI1
+//     stream <index> <value> <count> <burst> <period ms>
+//                                send <count> register updates, <burst> of
+//                                them back to back every <period ms>, the
+//                                value going up by one with each update
+//     raw <w3> <w2> <w1> <w0>    send four raw 16-bit SSI1 words
+//     touch <x> <y>              press the touch screen at a screen position
+//     release                    release the touch screen
+//     uart <text>                type a line of text on the UART0 console
+//     dump <file>                write the display to a PPM image
+//     expect <x> <y> <rrggbb>    check the colour of a display pixel
+//     expectuart <text>          check that the UART output holds the text
+//     expectfield <n> <min> <max> <text>
+//                                check that field <n> of the next line of the
+//                                UART output that holds the text is a number
+//                                from <min> to <max>
+//     end                        stop the run
+//
+// A stream goes on alongside the stimuli that follow it.  An expectuart
+// check consumes the output up to the end of the text it finds, and an
+// expectfield check the output before the line it finds, so the texts of
+// successive checks must appear in that order.  The fields of a line are
+// separated by white space and counted from 1.  Blank lines and lines
+// starting with '#' are ignored.
+//
+//*****************************************************************************
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+
+//*****************************************************************************
+//
+// The stimulus commands.
+//
+//*****************************************************************************
+typedef enum
+{
+    SIM_CMD_REG,
+    SIM_CMD_STREAM,
+    SIM_CMD_RAW,
+    SIM_CMD_TOUCH,
+    SIM_CMD_RELEASE,
+    SIM_CMD_UART,
+    SIM_CMD_DUMP,
+    SIM_CMD_EXPECT,
+    SIM_CMD_EXPECT_UART,
+    SIM_CMD_EXPECT_FIELD,
+    SIM_CMD_END
+}
+tSimCommand;
+
+typedef struct
+{
+    uint64_t ui64Time;
+    uint64_t ui64Period;
+    tSimCommand eCommand;
+    uint32_t pui32Args[4];
+    char pcText[128];
+    uint32_t ui32Line;
+}
+tSimStimulus;
+
+#define SIM_MAX_STIMULI         1024
+
+static tSimStimulus g_psSimStimuli[SIM_MAX_STIMULI];
+static uint32_t g_ui32SimNumStimuli;
+static uint32_t g_ui32SimNextStimulus;
+static const char *g_pcSimStimulusFile = "-";
+
+//*****************************************************************************
+//
+// The end of the run.  The run stops the first time the firmware is idle at
+// or after the end time; if the firmware never goes idle, it is stopped a
+// second later regardless.
+//
+//*****************************************************************************
+#define SIM_END_GRACE           (1000ull * SIM_CYCLES_PER_MS)
+
+static uint64_t g_ui64SimEnd = 5000ull * SIM_CYCLES_PER_MS;
+static bool g_bSimEndSet;
+
+//*****************************************************************************
+//
+// The options.
+//
+//*****************************************************************************
+static const char *g_pcSimPPMFile;
+static const char *g_pcSimBenchFile;
+static uint32_t g_ui32SimFailures;
+static uint32_t g_ui32SimChecks;
+
+//*****************************************************************************
+//
+// The UART output, and the part of it that the expectuart checks have not
+// yet consumed.  The zero bytes of the binary telemetry frames are left out
+// of the latter so that it can be searched as a string.
+//
+//*****************************************************************************
+#define SIM_UART_SEEN_SIZE      65536
+
+FILE *g_psSimUART;
+static char g_pcSimUARTSeen[SIM_UART_SEEN_SIZE + 1];
+static uint32_t g_ui32SimUARTSeen;
+
+//*****************************************************************************
+//
+// The bus benchmark.  A frame is the interval between two SysTick
+// interrupts, which pace the display refresh.  Frames are also aggregated by
+// the panel that was shown at the end of the frame.
+//
+//*****************************************************************************
+#define SIM_MAX_PANELS          16
+
+typedef struct
+{
+    uint32_t ui32Frames;
+    tSimBusCounts sTotal;
+    tSimBusCounts sMax;
+}
+tSimBench;
+
+static tSimBench g_sSimBench;
+static tSimBench g_psSimPanelBench[SIM_MAX_PANELS];
+static tSimBusCounts g_sSimFrameStart;
+
+extern uint32_t g_ulPanel;
+
+//*****************************************************************************
+//
+// Prints a usage message and exits.
+//
+//*****************************************************************************
+static void
+SimUsage(const char *pcName)
+{
+    fprintf(stderr,
+            "Usage: %s [options] [stimulus file]\n"
+            "  --time <ms>      stop after the given simulated time "
+            "(default 5000)\n"
+            "  --ppm <file>     dump the display to a PPM image at the end\n"
+            "  --bench <file>   write the bus benchmark to a file "
+            "(default stderr)\n"
+            "  --uart <file>    write the UART output to a file "
+            "(default stdout)\n"
+            "  --bake <file>    write the panel cache source and exit\n"
+            "  --draw <file>    draw an image file, print the cycles it took "
+            "and exit\n"
+            "  --touchcheck     check the touch screen transform and exit\n",
+            pcName);
+    exit(2);
+}
+
+//*****************************************************************************
+//
+// Parses the stimulus file.
+//
+//*****************************************************************************
+static void
+SimStimulusLoad(const char *pcFile)
+{
+    tSimStimulus *psStim;
+    char pcLine[256], pcCmd[32];
+    double dTime;
+    uint32_t ui32Line;
+    int32_t i32Count, i32Used;
+    FILE *psFile;
+
+    psFile = strcmp(pcFile, "-") ? fopen(pcFile, "r") : 0;
+    if(strcmp(pcFile, "-") && !psFile)
+    {
+        fprintf(stderr, "sim: cannot open %s\n", pcFile);
+        exit(2);
+    }
+    if(!psFile)
+    {
+        return;
+    }
+
+    for(ui32Line = 1; fgets(pcLine, sizeof(pcLine), psFile); ui32Line++)
+    {
+        if((sscanf(pcLine, " %31s", pcCmd) != 1) || (pcCmd[0] == '#'))
+        {
+            continue;
+        }
+
+        if(g_ui32SimNumStimuli == SIM_MAX_STIMULI)
+        {
+            fprintf(stderr, "%s:%u: too many stimuli\n", pcFile, ui32Line);
+            exit(2);
+        }
+        psStim = &g_psSimStimuli[g_ui32SimNumStimuli];
+        memset(psStim, 0, sizeof(*psStim));
+        psStim->ui32Line = ui32Line;
+
+        if(sscanf(pcLine, "%lf %31s %n", &dTime, pcCmd, &i32Used) < 2)
+        {
+            fprintf(stderr, "%s:%u: syntax error\n", pcFile, ui32Line);
+            exit(2);
+        }
+        psStim->ui64Time = (uint64_t)(dTime * SIM_CYCLES_PER_MS);
+
+        if(!strcmp(pcCmd, "reg"))
+        {
+            psStim->eCommand = SIM_CMD_REG;
+            i32Count = sscanf(pcLine + i32Used, "%i %i",
+                              (int *)&psStim->pui32Args[0],
+                              (int *)&psStim->pui32Args[1]) - 2;
+        }
+        else if(!strcmp(pcCmd, "stream"))
+        {
+            double dPeriod;
+
+            psStim->eCommand = SIM_CMD_STREAM;
+            i32Count = sscanf(pcLine + i32Used, "%i %i %i %i %lf",
+                              (int *)&psStim->pui32Args[0],
+                              (int *)&psStim->pui32Args[1],
+                              (int *)&psStim->pui32Args[2],
+                              (int *)&psStim->pui32Args[3], &dPeriod) - 5;
+            if(!i32Count && (!psStim->pui32Args[2] || !psStim->pui32Args[3] ||
+                             (dPeriod <= 0)))
+            {
+                i32Count = -1;
+            }
+            psStim->ui64Period = (uint64_t)(dPeriod * SIM_CYCLES_PER_MS);
+        }
+        else if(!strcmp(pcCmd, "raw"))
+        {
+            psStim->eCommand = SIM_CMD_RAW;
+            i32Count = sscanf(pcLine + i32Used, "%i %i %i %i",
+                              (int *)&psStim->pui32Args[0],
+                              (int *)&psStim->pui32Args[1],
+                              (int *)&psStim->pui32Args[2],
+                              (int *)&psStim->pui32Args[3]) - 4;
+        }
+        else if(!strcmp(pcCmd, "touch"))
+        {
+            psStim->eCommand = SIM_CMD_TOUCH;
+            i32Count = sscanf(pcLine + i32Used, "%i %i",
+                              (int *)&psStim->pui32Args[0],
+                              (int *)&psStim->pui32Args[1]) - 2;
+        }
+        else if(!strcmp(pcCmd, "release"))
+        {
+            psStim->eCommand = SIM_CMD_RELEASE;
+            i32Count = 0;
+        }
+        else if(!strcmp(pcCmd, "uart") || !strcmp(pcCmd, "expectuart") ||
+                !strcmp(pcCmd, "expectfield"))
+        {
+            char *pcEnd;
+            int32_t i32Next;
+
+            psStim->eCommand = SIM_CMD_UART;
+            if(!strcmp(pcCmd, "expectuart"))
+            {
+                psStim->eCommand = SIM_CMD_EXPECT_UART;
+            }
+            else if(!strcmp(pcCmd, "expectfield"))
+            {
+                psStim->eCommand = SIM_CMD_EXPECT_FIELD;
+                i32Next = 0;
+                if((sscanf(pcLine + i32Used, "%i %i %i %n",
+                           (int *)&psStim->pui32Args[0],
+                           (int *)&psStim->pui32Args[1],
+                           (int *)&psStim->pui32Args[2], &i32Next) != 3) ||
+                   !i32Next || !psStim->pui32Args[0])
+                {
+                    fprintf(stderr, "%s:%u: bad command\n", pcFile,
+                            ui32Line);
+                    exit(2);
+                }
+                i32Used += i32Next;
+            }
+
+            //
+            // The text runs to the end of the line or to a comment.  Typed
+            // text is sent followed by a carriage return, as a terminal
+            // would.
+            //
+            strncpy(psStim->pcText, pcLine + i32Used,
+                    sizeof(psStim->pcText) - 2);
+            pcEnd = strchr(psStim->pcText, '#');
+            if(!pcEnd)
+            {
+                pcEnd = psStim->pcText + strlen(psStim->pcText);
+            }
+            while((pcEnd > psStim->pcText) && isspace((int)pcEnd[-1]))
+            {
+                pcEnd--;
+            }
+            strcpy(pcEnd, (psStim->eCommand == SIM_CMD_UART) ? "\r" : "");
+            i32Count = (((psStim->eCommand != SIM_CMD_UART) &&
+                         (pcEnd == psStim->pcText)) ? -1 : 0);
+        }
+        else if(!strcmp(pcCmd, "dump"))
+        {
+            psStim->eCommand = SIM_CMD_DUMP;
+            i32Count = sscanf(pcLine + i32Used, "%127s", psStim->pcText) - 1;
+        }
+        else if(!strcmp(pcCmd, "expect"))
+        {
+            psStim->eCommand = SIM_CMD_EXPECT;
+            i32Count = sscanf(pcLine + i32Used, "%i %i %x",
+                              (int *)&psStim->pui32Args[0],
+                              (int *)&psStim->pui32Args[1],
+                              &psStim->pui32Args[2]) - 3;
+        }
+        else if(!strcmp(pcCmd, "end"))
+        {
+            psStim->eCommand = SIM_CMD_END;
+            i32Count = 0;
+            if(!g_bSimEndSet)
+            {
+                g_ui64SimEnd = psStim->ui64Time;
+                g_bSimEndSet = true;
+            }
+        }
+        else
+        {
+            i32Count = -1;
+        }
+
+        if(i32Count != 0)
+        {
+            fprintf(stderr, "%s:%u: bad command\n", pcFile, ui32Line);
+            exit(2);
+        }
+
+        if(g_ui32SimNumStimuli &&
+           (psStim->ui64Time < psStim[-1].ui64Time))
+        {
+            fprintf(stderr, "%s:%u: time goes backwards\n", pcFile, ui32Line);
+            exit(2);
+        }
+
+        g_ui32SimNumStimuli++;
+    }
+
+    fclose(psFile);
+}
+
+//*****************************************************************************
+//
+// Returns true if a command inspects the display, and so must wait until the
+// firmware is idle.
+//
+//*****************************************************************************
+static bool
+SimStimulusIsProbe(const tSimStimulus *psStim)
+{
+    return((psStim->eCommand == SIM_CMD_DUMP) ||
+           (psStim->eCommand == SIM_CMD_EXPECT) ||
+           (psStim->eCommand == SIM_CMD_EXPECT_UART) ||
+           (psStim->eCommand == SIM_CMD_EXPECT_FIELD) ||
+           (psStim->eCommand == SIM_CMD_END));
+}
+
+//*****************************************************************************
+//
+// Sends a register update as the four words of an SSI1 frame.  Each word
+// carries the register index plus one in bits 15:10, a sync pattern in bits
+// 9:8 and one data byte, most significant byte first.
+//
+//*****************************************************************************
+static void
+SimRegisterUpdateSend(uint32_t ui32Index, uint32_t ui32Value)
+{
+    uint16_t pui16Words[4];
+    uint32_t ui32Counter;
+
+    ui32Counter = (ui32Index + 1) << 10;
+    pui16Words[0] = ui32Counter | 0x300 | ((ui32Value >> 24) & 0xff);
+    pui16Words[1] = ui32Counter | 0x200 | ((ui32Value >> 16) & 0xff);
+    pui16Words[2] = ui32Counter | 0x100 | ((ui32Value >> 8) & 0xff);
+    pui16Words[3] = ui32Counter | 0x000 | (ui32Value & 0xff);
+
+    SimSSIFramePut(pui16Words, 4);
+}
+
+//*****************************************************************************
+//
+// Checks the colour of a display pixel.  The expected colour is given as
+// 24-bit RGB and is compared after reduction to RGB565.
+//
+//*****************************************************************************
+static void
+SimExpect(const tSimStimulus *psStim)
+{
+    uint32_t ui32RGB;
+    uint16_t ui16Want, ui16Got;
+
+    ui32RGB = psStim->pui32Args[2];
+    ui16Want = (((ui32RGB >> 8) & 0xf800) | ((ui32RGB >> 5) & 0x07e0) |
+                ((ui32RGB >> 3) & 0x001f));
+    ui16Got = SimLCDPixelGet(psStim->pui32Args[0], psStim->pui32Args[1]);
+
+    g_ui32SimChecks++;
+    if(ui16Got != ui16Want)
+    {
+        fprintf(stderr, "%s:%u: pixel (%u,%u) is %02x%02x%02x, "
+                "expected %06x\n", g_pcSimStimulusFile, psStim->ui32Line,
+                psStim->pui32Args[0], psStim->pui32Args[1],
+                ((ui16Got >> 11) & 0x1f) << 3, ((ui16Got >> 5) & 0x3f) << 2,
+                (ui16Got & 0x1f) << 3, ui32RGB);
+        g_ui32SimFailures++;
+    }
+}
+
+//*****************************************************************************
+//
+// Keeps a byte of the UART output for the expectuart checks.  When the
+// output has not been checked for a long time only the newest part is kept.
+//
+//*****************************************************************************
+void
+SimUARTCapture(uint8_t ui8Data)
+{
+    if(!ui8Data)
+    {
+        return;
+    }
+
+    if(g_ui32SimUARTSeen == SIM_UART_SEEN_SIZE)
+    {
+        memmove(g_pcSimUARTSeen, g_pcSimUARTSeen + (SIM_UART_SEEN_SIZE / 2),
+                SIM_UART_SEEN_SIZE / 2);
+        g_ui32SimUARTSeen = SIM_UART_SEEN_SIZE / 2;
+    }
+    g_pcSimUARTSeen[g_ui32SimUARTSeen++] = ui8Data;
+    g_pcSimUARTSeen[g_ui32SimUARTSeen] = 0;
+}
+
+//*****************************************************************************
+//
+// Checks that the UART output not yet consumed holds a text, and consumes it
+// up to the end of the text.
+//
+//*****************************************************************************
+static void
+SimExpectUART(const tSimStimulus *psStim)
+{
+    char *pcFound;
+
+    g_ui32SimChecks++;
+    pcFound = strstr(g_pcSimUARTSeen, psStim->pcText);
+    if(!pcFound)
+    {
+        fprintf(stderr, "%s:%u: UART output lacks \"%s\"\n",
+                g_pcSimStimulusFile, psStim->ui32Line, psStim->pcText);
+        g_ui32SimFailures++;
+        return;
+    }
+
+    pcFound += strlen(psStim->pcText);
+    g_ui32SimUARTSeen -= pcFound - g_pcSimUARTSeen;
+    memmove(g_pcSimUARTSeen, pcFound, g_ui32SimUARTSeen + 1);
+}
+
+//*****************************************************************************
+//
+// Checks that a field of the next line of the UART output that holds a text
+// is a number in a range, and consumes the output before the line, so that
+// the next check can look at the same line.
+//
+//*****************************************************************************
+static void
+SimExpectField(const tSimStimulus *psStim)
+{
+    char pcLine[256], *pcField, *pcEnd;
+    uint32_t ui32Field, ui32Value, ui32Len;
+    char *pcFound;
+
+    g_ui32SimChecks++;
+    pcFound = strstr(g_pcSimUARTSeen, psStim->pcText);
+    if(!pcFound)
+    {
+        fprintf(stderr, "%s:%u: UART output lacks \"%s\"\n",
+                g_pcSimStimulusFile, psStim->ui32Line, psStim->pcText);
+        g_ui32SimFailures++;
+        return;
+    }
+
+    //
+    // Consume the output before the line, and take a copy of the line.
+    //
+    while((pcFound > g_pcSimUARTSeen) && (pcFound[-1] != '\n'))
+    {
+        pcFound--;
+    }
+    g_ui32SimUARTSeen -= pcFound - g_pcSimUARTSeen;
+    memmove(g_pcSimUARTSeen, pcFound, g_ui32SimUARTSeen + 1);
+    ui32Len = strcspn(g_pcSimUARTSeen, "\r\n");
+    if(ui32Len >= sizeof(pcLine))
+    {
+        ui32Len = sizeof(pcLine) - 1;
+    }
+    memcpy(pcLine, g_pcSimUARTSeen, ui32Len);
+    pcLine[ui32Len] = 0;
+
+    pcField = strtok(pcLine, " \t");
+    for(ui32Field = 1; pcField && (ui32Field < psStim->pui32Args[0]);
+        ui32Field++)
+    {
+        pcField = strtok(0, " \t");
+    }
+    ui32Value = pcField ? strtoul(pcField, &pcEnd, 0) : 0;
+    if(!pcField || *pcEnd)
+    {
+        fprintf(stderr, "%s:%u: field %u of the \"%s\" line is not a "
+                "number\n", g_pcSimStimulusFile, psStim->ui32Line,
+                psStim->pui32Args[0], psStim->pcText);
+        g_ui32SimFailures++;
+    }
+    else if((ui32Value < psStim->pui32Args[1]) ||
+            (ui32Value > psStim->pui32Args[2]))
+    {
+        fprintf(stderr, "%s:%u: field %u of the \"%s\" line is %u, "
+                "expected %u to %u\n", g_pcSimStimulusFile, psStim->ui32Line,
+                psStim->pui32Args[0], psStim->pcText, ui32Value,
+                psStim->pui32Args[1], psStim->pui32Args[2]);
+        g_ui32SimFailures++;
+    }
+}
+
+//*****************************************************************************
+//
+// Sends the next burst of a stream of register updates.  While updates
+// remain, the stream is moved on to the time of its next burst, behind the
+// stimuli due before or at it.
+//
+//*****************************************************************************
+static void
+SimStreamRun(uint32_t ui32Idx)
+{
+    tSimStimulus sStream;
+    uint32_t ui32Burst;
+
+    sStream = g_psSimStimuli[ui32Idx];
+    for(ui32Burst = sStream.pui32Args[3];
+        ui32Burst && sStream.pui32Args[2]; ui32Burst--)
+    {
+        SimRegisterUpdateSend(sStream.pui32Args[0], sStream.pui32Args[1]++);
+        sStream.pui32Args[2]--;
+    }
+    if(!sStream.pui32Args[2])
+    {
+        return;
+    }
+
+    sStream.ui64Time += sStream.ui64Period;
+    while(((ui32Idx + 1) < g_ui32SimNumStimuli) &&
+          (g_psSimStimuli[ui32Idx + 1].ui64Time <= sStream.ui64Time))
+    {
+        g_psSimStimuli[ui32Idx] = g_psSimStimuli[ui32Idx + 1];
+        ui32Idx++;
+    }
+    g_psSimStimuli[ui32Idx] = sStream;
+    g_ui32SimNextStimulus--;
+}
+
+//*****************************************************************************
+//
+// Returns the time of the next stimulus event, including the end of the run.
+// A probe that is already due is waiting for the firmware to go idle, which
+// the interrupt model notices by itself, so it is not reported again.
+//
+//*****************************************************************************
+uint64_t
+SimStimulusNextGet(void)
+{
+    uint64_t ui64Next;
+
+    ui64Next = g_ui64SimEnd + SIM_END_GRACE;
+    if(SimCyclesGet() < g_ui64SimEnd)
+    {
+        ui64Next = g_ui64SimEnd;
+    }
+
+    if(g_ui32SimNextStimulus < g_ui32SimNumStimuli)
+    {
+        const tSimStimulus *psStim;
+
+        psStim = &g_psSimStimuli[g_ui32SimNextStimulus];
+        if(!SimStimulusIsProbe(psStim) || (psStim->ui64Time > SimCyclesGet()))
+        {
+            if(psStim->ui64Time < ui64Next)
+            {
+                ui64Next = psStim->ui64Time;
+            }
+        }
+    }
+
+    return(ui64Next);
+}
+
+//*****************************************************************************
+//
+// Runs the stimuli that are due.  Probes only run when the firmware is idle,
+// and hold back the stimuli after them.
+//
+//*****************************************************************************
+void
+SimStimulusRun(uint64_t ui64Now, bool bIdle)
+{
+    tSimStimulus *psStim;
+
+    while(g_ui32SimNextStimulus < g_ui32SimNumStimuli)
+    {
+        psStim = &g_psSimStimuli[g_ui32SimNextStimulus];
+        if((psStim->ui64Time > ui64Now) ||
+           (SimStimulusIsProbe(psStim) && !bIdle))
+        {
+            break;
+        }
+        g_ui32SimNextStimulus++;
+
+        switch(psStim->eCommand)
+        {
+            case SIM_CMD_REG:
+            {
+                SimRegisterUpdateSend(psStim->pui32Args[0],
+                                      psStim->pui32Args[1]);
+                break;
+            }
+
+            case SIM_CMD_STREAM:
+            {
+                SimStreamRun(g_ui32SimNextStimulus - 1);
+                break;
+            }
+
+            case SIM_CMD_RAW:
+            {
+                uint16_t pui16Words[4];
+                uint32_t ui32Idx;
+
+                for(ui32Idx = 0; ui32Idx < 4; ui32Idx++)
+                {
+                    pui16Words[ui32Idx] = psStim->pui32Args[ui32Idx];
+                }
+                SimSSIFramePut(pui16Words, 4);
+                break;
+            }
+
+            case SIM_CMD_TOUCH:
+            {
+                SimTouchSet(true, psStim->pui32Args[0], psStim->pui32Args[1]);
+                break;
+            }
+
+            case SIM_CMD_RELEASE:
+            {
+                SimTouchSet(false, 0, 0);
+                break;
+            }
+
+            case SIM_CMD_UART:
+            {
+                SimUARTInput(psStim->pcText, strlen(psStim->pcText));
+                break;
+            }
+
+            case SIM_CMD_DUMP:
+            {
+                SimRegisterFlush();
+                if(!SimLCDDump(psStim->pcText))
+                {
+                    fprintf(stderr, "sim: cannot write %s\n", psStim->pcText);
+                    g_ui32SimFailures++;
+                }
+                break;
+            }
+
+            case SIM_CMD_EXPECT:
+            {
+                SimRegisterFlush();
+                SimExpect(psStim);
+                break;
+            }
+
+            case SIM_CMD_EXPECT_UART:
+            {
+                SimExpectUART(psStim);
+                break;
+            }
+
+            case SIM_CMD_EXPECT_FIELD:
+            {
+                SimExpectField(psStim);
+                break;
+            }
+
+            case SIM_CMD_END:
+            {
+                SimFinish();
+                break;
+            }
+        }
+    }
+
+    if((bIdle && (ui64Now >= g_ui64SimEnd)) ||
+       (ui64Now >= (g_ui64SimEnd + SIM_END_GRACE)))
+    {
+        SimFinish();
+    }
+}
+
+//*****************************************************************************
+//
+// Adds one frame's bus counts to a benchmark.
+//
+//*****************************************************************************
+#define SIM_BENCH_ADD(psBench, psFrame, field)                               \
+        do                                                                   \
+        {                                                                    \
+            (psBench)->sTotal.field += (psFrame)->field;                     \
+            if((psFrame)->field > (psBench)->sMax.field)                     \
+            {                                                                \
+                (psBench)->sMax.field = (psFrame)->field;                    \
+            }                                                                \
+        }                                                                    \
+        while(0)
+
+static void
+SimBenchAdd(tSimBench *psBench, const tSimBusCounts *psFrame)
+{
+    psBench->ui32Frames++;
+    SIM_BENCH_ADD(psBench, psFrame, ui64PortWrites);
+    SIM_BENCH_ADD(psBench, psFrame, ui64Commands);
+    SIM_BENCH_ADD(psBench, psFrame, ui64DataWords);
+    SIM_BENCH_ADD(psBench, psFrame, ui64Pixels);
+    SIM_BENCH_ADD(psBench, psFrame, ui64WindowSetups);
+}
+
+//*****************************************************************************
+//
+// Marks the end of a display frame.
+//
+//*****************************************************************************
+void
+SimFrameMark(void)
+{
+    tSimBusCounts sNow, sFrame;
+
+    SimRegisterFlush();
+    SimLCDCountsGet(&sNow);
+
+    sFrame.ui64PortWrites = sNow.ui64PortWrites -
+                            g_sSimFrameStart.ui64PortWrites;
+    sFrame.ui64Commands = sNow.ui64Commands - g_sSimFrameStart.ui64Commands;
+    sFrame.ui64DataWords = sNow.ui64DataWords -
+                           g_sSimFrameStart.ui64DataWords;
+    sFrame.ui64Pixels = sNow.ui64Pixels - g_sSimFrameStart.ui64Pixels;
+    sFrame.ui64WindowSetups = sNow.ui64WindowSetups -
+                              g_sSimFrameStart.ui64WindowSetups;
+    g_sSimFrameStart = sNow;
+
+    SimBenchAdd(&g_sSimBench, &sFrame);
+    if(g_ulPanel < SIM_MAX_PANELS)
+    {
+        SimBenchAdd(&g_psSimPanelBench[g_ulPanel], &sFrame);
+    }
+}
+
+//*****************************************************************************
+//
+// Writes one line of the benchmark.
+//
+//*****************************************************************************
+static void
+SimBenchPrint(FILE *psFile, const char *pcName, const tSimBench *psBench)
+{
+    uint32_t ui32N;
+
+    ui32N = psBench->ui32Frames ? psBench->ui32Frames : 1;
+    fprintf(psFile, "%-8s %6u  %9.1f/%-8llu %9.1f/%-8llu %9.1f/%-8llu "
+            "%7.1f/%-5llu %9.1f/%-8llu\n", pcName, psBench->ui32Frames,
+            (double)psBench->sTotal.ui64Commands / ui32N,
+            (unsigned long long)psBench->sMax.ui64Commands,
+            (double)psBench->sTotal.ui64DataWords / ui32N,
+            (unsigned long long)psBench->sMax.ui64DataWords,
+            (double)psBench->sTotal.ui64Pixels / ui32N,
+            (unsigned long long)psBench->sMax.ui64Pixels,
+            (double)psBench->sTotal.ui64WindowSetups / ui32N,
+            (unsigned long long)psBench->sMax.ui64WindowSetups,
+            (double)psBench->sTotal.ui64PortWrites / ui32N,
+            (unsigned long long)psBench->sMax.ui64PortWrites);
+}
+
+//*****************************************************************************
+//
+// Ends the run: writes the final image and the benchmark and exits with a
+// failure status if any probe failed or any SSI1 word was lost.
+//
+//*****************************************************************************
+void
+SimFinish(void)
+{
+    char pcName[16];
+    uint32_t ui32Panel;
+    FILE *psFile;
+
+    SimRegisterFlush();
+    fflush(g_psSimUART);
+
+    if(g_pcSimPPMFile && !SimLCDDump(g_pcSimPPMFile))
+    {
+        fprintf(stderr, "sim: cannot write %s\n", g_pcSimPPMFile);
+        g_ui32SimFailures++;
+    }
+
+    //
+    // The SPI link must not lose words, whatever else the firmware is doing.
+    //
+    if(SimSSIOverrunsGet())
+    {
+        fprintf(stderr, "%s: %u SSI1 overruns\n", g_pcSimStimulusFile,
+                SimSSIOverrunsGet());
+        g_ui32SimFailures++;
+    }
+
+    psFile = g_pcSimBenchFile ? fopen(g_pcSimBenchFile, "w") : stderr;
+    if(!psFile)
+    {
+        fprintf(stderr, "sim: cannot write %s\n", g_pcSimBenchFile);
+        exit(2);
+    }
+
+    fprintf(psFile, "simulated %.1f ms, %llu register accesses, "
+            "%u SSI1 overruns\n", (double)SimCyclesGet() / SIM_CYCLES_PER_MS,
+            (unsigned long long)SimAccessesGet(), SimSSIOverrunsGet());
+    fprintf(psFile, "bus writes per frame (average/maximum):\n");
+    fprintf(psFile, "%-8s %6s  %-18s %-18s %-18s %-13s %-18s\n", "panel",
+            "frames", "commands", "data words", "pixels", "windows",
+            "port writes");
+    SimBenchPrint(psFile, "all", &g_sSimBench);
+    for(ui32Panel = 0; ui32Panel < SIM_MAX_PANELS; ui32Panel++)
+    {
+        if(g_psSimPanelBench[ui32Panel].ui32Frames)
+        {
+            snprintf(pcName, sizeof(pcName), "%u", ui32Panel);
+            SimBenchPrint(psFile, pcName, &g_psSimPanelBench[ui32Panel]);
+        }
+    }
+    if(psFile != stderr)
+    {
+        fclose(psFile);
+    }
+
+    if(g_ui32SimFailures)
+    {
+        fprintf(stderr, "%s: %u of %u checks failed\n", g_pcSimStimulusFile,
+                g_ui32SimFailures, g_ui32SimChecks);
+    }
+
+    exit(g_ui32SimFailures ? 1 : 0);
+}
+
+//*****************************************************************************
+//
+// Parses the command line and runs the firmware.
+//
+//*****************************************************************************
+int
+main(int argc, char *argv[])
+{
+    const char *pcDraw;
+    int32_t i32Arg;
+
+    pcDraw = 0;
+    g_psSimUART = stdout;
+
+    for(i32Arg = 1; i32Arg < argc; i32Arg++)
+    {
+        if(!strcmp(argv[i32Arg], "--time") && ((i32Arg + 1) < argc))
+        {
+            g_ui64SimEnd = ((uint64_t)strtoul(argv[++i32Arg], 0, 0) *
+                            SIM_CYCLES_PER_MS);
+            g_bSimEndSet = true;
+        }
+        else if(!strcmp(argv[i32Arg], "--ppm") && ((i32Arg + 1) < argc))
+        {
+            g_pcSimPPMFile = argv[++i32Arg];
+        }
+        else if(!strcmp(argv[i32Arg], "--bench") && ((i32Arg + 1) < argc))
+        {
+            g_pcSimBenchFile = argv[++i32Arg];
+        }
+        else if(!strcmp(argv[i32Arg], "--uart") && ((i32Arg + 1) < argc))
+        {
+            g_psSimUART = fopen(argv[++i32Arg], "w");
+            if(!g_psSimUART)
+            {
+                fprintf(stderr, "sim: cannot write %s\n", argv[i32Arg]);
+                return(2);
+            }
+        }
+        else if(!strcmp(argv[i32Arg], "--bake") && ((i32Arg + 1) < argc))
+        {
+            return(SimBake(argv[++i32Arg]) ? 0 : 2);
+        }
+        else if(!strcmp(argv[i32Arg], "--draw") && ((i32Arg + 1) < argc))
+        {
+            pcDraw = argv[++i32Arg];
+        }
+        else if(!strcmp(argv[i32Arg], "--touchcheck"))
+        {
+            return(SimTouchCheck() ? 0 : 1);
+        }
+        else if((argv[i32Arg][0] == '-') && argv[i32Arg][1])
+        {
+            SimUsage(argv[0]);
+        }
+        else
+        {
+            g_pcSimStimulusFile = argv[i32Arg];
+        }
+    }
+
+    //
+    // An image is drawn once the whole command line has been read, so that
+    // --ppm applies to it.
+    //
+    if(pcDraw)
+    {
+        return(SimDraw(pcDraw, g_pcSimPPMFile) ? 0 : 2);
+    }
+
+    SimStimulusLoad(g_pcSimStimulusFile);
+
+    FirmwareMain();
+
+    //
+    // The firmware never returns from its main loop.
+    //
+    SimFinish();
+
+    return(0);
+}
@@ -0,0 +1,139 @@
+//*****************************************************************************
+//
+// sim.h - Interfaces shared by the parts of the host simulator.
+//
+//*****************************************************************************
+
+#ifndef __SIM_H__
+#define __SIM_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+//*****************************************************************************
+//
+// The simulated processor clock, as set up by the firmware, and the cost of
+// one peripheral register access in processor cycles.  Code that does not
+// touch a register is taken to be free, so simulated times are those of the
+// bus traffic only.
+//
+//*****************************************************************************
+#define SIM_CLOCK_HZ            80000000
+#define SIM_CYCLES_PER_ACCESS   2
+#define SIM_CYCLES_PER_MS       (SIM_CLOCK_HZ / 1000)
+
+//*****************************************************************************
+//
+// The GPIO ports, in register file order.
+//
+//*****************************************************************************
+#define SIM_PORTA               0
+#define SIM_PORTB               1
+#define SIM_PORTC               2
+#define SIM_PORTD               3
+#define SIM_PORTE               4
+#define SIM_PORTF               5
+#define SIM_NUM_PORTS           6
+
+//*****************************************************************************
+//
+// The display panel size.
+//
+//*****************************************************************************
+#define SIM_LCD_WIDTH           320
+#define SIM_LCD_HEIGHT          240
+
+//*****************************************************************************
+//
+// The bus transfer counters kept by the virtual SSD2119.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint64_t ui64PortWrites;
+    uint64_t ui64Commands;
+    uint64_t ui64DataWords;
+    uint64_t ui64Pixels;
+    uint64_t ui64WindowSetups;
+}
+tSimBusCounts;
+
+//*****************************************************************************
+//
+// hw.c: the register file.
+//
+//*****************************************************************************
+extern volatile uint32_t *SimRegister(uint32_t ui32Addr);
+extern void SimRegisterFlush(void);
+extern uint32_t SimRegisterGet(uint32_t ui32Addr);
+extern void SimRegisterSet(uint32_t ui32Addr, uint32_t ui32Value);
+extern uint8_t SimGPIOGet(uint32_t ui32Port);
+extern uint64_t SimCyclesGet(void);
+extern void SimCyclesAdvance(uint64_t ui64Cycles);
+extern uint64_t SimAccessesGet(void);
+
+//*****************************************************************************
+//
+// driverlib.c: peripherals with side effects and the interrupt model.
+//
+//*****************************************************************************
+extern bool SimRegisterRead(uint32_t ui32Addr, volatile uint32_t *pui32Value);
+extern void SimEventsPoll(void);
+extern void SimSSIFramePut(const uint16_t *pui16Words, uint32_t ui32Count);
+extern void SimTouchSet(bool bDown, int32_t i32X, int32_t i32Y);
+extern uint32_t SimSSIOverrunsGet(void);
+extern void SimUARTInput(const char *pcText, uint32_t ui32Length);
+
+//*****************************************************************************
+//
+// ssd2119.c: the virtual display controller.
+//
+//*****************************************************************************
+extern void SimGPIOWrite(uint32_t ui32Port, uint8_t ui8Old, uint8_t ui8New);
+extern void SimLCDCountsGet(tSimBusCounts *psCounts);
+extern uint16_t SimLCDPixelGet(int32_t i32X, int32_t i32Y);
+extern bool SimLCDDump(const char *pcFile);
+
+//*****************************************************************************
+//
+// bake.c: the panel cache generator.
+//
+//*****************************************************************************
+extern bool SimBake(const char *pcFile);
+
+//*****************************************************************************
+//
+// draw.c: the image draw measurement.
+//
+//*****************************************************************************
+extern bool SimDraw(const char *pcImage, const char *pcPPM);
+
+//*****************************************************************************
+//
+// touchcheck.c: the touch screen transform check.
+//
+//*****************************************************************************
+extern bool SimTouchCheck(void);
+
+//*****************************************************************************
+//
+// sim.c: the stimulus and the run control.
+//
+//*****************************************************************************
+extern uint64_t SimStimulusNextGet(void);
+extern void SimStimulusRun(uint64_t ui64Now, bool bIdle);
+extern void SimFrameMark(void);
+extern void SimFinish(void);
+extern void SimUARTCapture(uint8_t ui8Data);
+extern FILE *g_psSimUART;
+
+//*****************************************************************************
+//
+// The firmware entry point, renamed at compile time so that the simulator can
+// provide main().
+//
+//*****************************************************************************
+extern int FirmwareMain(void);
+
+#endif // __SIM_H__
@@ -0,0 +1,346 @@
+//*****************************************************************************
+//
+// ssd2119.c - Virtual SSD2119 display controller.
+//
+// The controller is attached to the simulated GPIO ports exactly as the
+// Kentec panel is attached to the board: the data bus on port B and CS, DC
+// and WR on port A.  Each rising edge of WR latches one byte, most significant
+// byte first; DC low marks a command.  The register model covers what the
+// Kentec driver uses: the entry mode (address increment direction and
+// order), the RAM address counters and the RAM window.  Pixels written to the
+// RAM data register land in a 320x240 RGB565 frame buffer, which can be dumped
+// as a PPM image in screen orientation.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "sim.h"
+
+//*****************************************************************************
+//
+// The bus pins.
+//
+//*****************************************************************************
+#define SIM_LCD_CTRL_PORT       SIM_PORTA
+#define SIM_LCD_DATA_PORT       SIM_PORTB
+#define SIM_LCD_CS              0x80
+#define SIM_LCD_DC              0x40
+#define SIM_LCD_WR              0x20
+
+//*****************************************************************************
+//
+// The controller registers used by the model.
+//
+//*****************************************************************************
+#define SSD2119_ENTRY_MODE      0x11
+#define SSD2119_RAM_DATA        0x22
+#define SSD2119_V_RAM_POS       0x44
+#define SSD2119_H_RAM_START     0x45
+#define SSD2119_H_RAM_END       0x46
+#define SSD2119_X_RAM_ADDR      0x4E
+#define SSD2119_Y_RAM_ADDR      0x4F
+
+#define SSD2119_ENTRY_ID0       0x0010
+#define SSD2119_ENTRY_ID1       0x0020
+#define SSD2119_ENTRY_AM        0x0008
+
+//*****************************************************************************
+//
+// The controller state.
+//
+//*****************************************************************************
+static uint16_t g_pui16LCDRegs[256];
+static uint16_t g_pui16LCDRAM[SIM_LCD_HEIGHT][SIM_LCD_WIDTH];
+static uint8_t g_ui8LCDIndex;
+static int32_t g_i32LCDX;
+static int32_t g_i32LCDY;
+
+//*****************************************************************************
+//
+// The byte assembly state of the 8-bit interface.
+//
+//*****************************************************************************
+static bool g_bLCDLowByte;
+static uint8_t g_ui8LCDHighByte;
+
+//*****************************************************************************
+//
+// The transfer counters.
+//
+//*****************************************************************************
+static tSimBusCounts g_sLCDCounts;
+
+//*****************************************************************************
+//
+// Advances the RAM address counter after a pixel write, wrapping within the
+// RAM window as the controller does.
+//
+//*****************************************************************************
+static void
+SimLCDAddressStep(void)
+{
+    uint16_t ui16Entry;
+    int32_t i32XStart, i32XEnd, i32YStart, i32YEnd;
+    bool bWrapped;
+
+    ui16Entry = g_pui16LCDRegs[SSD2119_ENTRY_MODE];
+    i32XStart = g_pui16LCDRegs[SSD2119_H_RAM_START] & 0x1ff;
+    i32XEnd = g_pui16LCDRegs[SSD2119_H_RAM_END] & 0x1ff;
+    i32YStart = g_pui16LCDRegs[SSD2119_V_RAM_POS] & 0xff;
+    i32YEnd = g_pui16LCDRegs[SSD2119_V_RAM_POS] >> 8;
+
+    if(!(ui16Entry & SSD2119_ENTRY_AM))
+    {
+        //
+        // Horizontal first, then vertical.
+        //
+        bWrapped = false;
+        if(ui16Entry & SSD2119_ENTRY_ID0)
+        {
+            if(++g_i32LCDX > i32XEnd)
+            {
+                g_i32LCDX = i32XStart;
+                bWrapped = true;
+            }
+        }
+        else
+        {
+            if(--g_i32LCDX < i32XStart)
+            {
+                g_i32LCDX = i32XEnd;
+                bWrapped = true;
+            }
+        }
+        if(bWrapped)
+        {
+            if(ui16Entry & SSD2119_ENTRY_ID1)
+            {
+                if(++g_i32LCDY > i32YEnd)
+                {
+                    g_i32LCDY = i32YStart;
+                }
+            }
+            else
+            {
+                if(--g_i32LCDY < i32YStart)
+                {
+                    g_i32LCDY = i32YEnd;
+                }
+            }
+        }
+    }
+    else
+    {
+        //
+        // Vertical first, then horizontal.
+        //
+        bWrapped = false;
+        if(ui16Entry & SSD2119_ENTRY_ID1)
+        {
+            if(++g_i32LCDY > i32YEnd)
+            {
+                g_i32LCDY = i32YStart;
+                bWrapped = true;
+            }
+        }
+        else
+        {
+            if(--g_i32LCDY < i32YStart)
+            {
+                g_i32LCDY = i32YEnd;
+                bWrapped = true;
+            }
+        }
+        if(bWrapped)
+        {
+            if(ui16Entry & SSD2119_ENTRY_ID0)
+            {
+                if(++g_i32LCDX > i32XEnd)
+                {
+                    g_i32LCDX = i32XStart;
+                }
+            }
+            else
+            {
+                if(--g_i32LCDX < i32XStart)
+                {
+                    g_i32LCDX = i32XEnd;
+                }
+            }
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Handles a complete 16-bit transfer.
+//
+//*****************************************************************************
+static void
+SimLCDWord(bool bCommand, uint16_t ui16Word)
+{
+    if(bCommand)
+    {
+        g_sLCDCounts.ui64Commands++;
+        g_ui8LCDIndex = ui16Word & 0xff;
+        return;
+    }
+
+    g_sLCDCounts.ui64DataWords++;
+
+    switch(g_ui8LCDIndex)
+    {
+        case SSD2119_RAM_DATA:
+        {
+            g_sLCDCounts.ui64Pixels++;
+            if((g_i32LCDX >= 0) && (g_i32LCDX < SIM_LCD_WIDTH) &&
+               (g_i32LCDY >= 0) && (g_i32LCDY < SIM_LCD_HEIGHT))
+            {
+                g_pui16LCDRAM[g_i32LCDY][g_i32LCDX] = ui16Word;
+            }
+            SimLCDAddressStep();
+            break;
+        }
+
+        case SSD2119_X_RAM_ADDR:
+        {
+            g_i32LCDX = ui16Word & 0x1ff;
+            g_pui16LCDRegs[g_ui8LCDIndex] = ui16Word;
+            break;
+        }
+
+        case SSD2119_Y_RAM_ADDR:
+        {
+            g_i32LCDY = ui16Word & 0xff;
+            g_pui16LCDRegs[g_ui8LCDIndex] = ui16Word;
+            break;
+        }
+
+        case SSD2119_V_RAM_POS:
+        case SSD2119_H_RAM_START:
+        case SSD2119_H_RAM_END:
+        {
+            g_sLCDCounts.ui64WindowSetups++;
+            g_pui16LCDRegs[g_ui8LCDIndex] = ui16Word;
+            break;
+        }
+
+        default:
+        {
+            g_pui16LCDRegs[g_ui8LCDIndex] = ui16Word;
+            break;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Called by the register file whenever the state of a GPIO port changes.
+//
+//*****************************************************************************
+void
+SimGPIOWrite(uint32_t ui32Port, uint8_t ui8Old, uint8_t ui8New)
+{
+    uint8_t ui8Byte;
+
+    g_sLCDCounts.ui64PortWrites++;
+
+    if(ui32Port != SIM_LCD_CTRL_PORT)
+    {
+        return;
+    }
+
+    //
+    // Deselecting the controller abandons a partly transferred word.
+    //
+    if(ui8New & SIM_LCD_CS)
+    {
+        g_bLCDLowByte = false;
+        return;
+    }
+
+    //
+    // Bytes are latched on the rising edge of WR.  The driver raises DC
+    // together with WR at the end of a command, so DC is sampled from the
+    // state before the edge.
+    //
+    if(!(ui8Old & SIM_LCD_WR) && (ui8New & SIM_LCD_WR))
+    {
+        ui8Byte = SimGPIOGet(SIM_LCD_DATA_PORT);
+        if(!g_bLCDLowByte)
+        {
+            g_ui8LCDHighByte = ui8Byte;
+            g_bLCDLowByte = true;
+        }
+        else
+        {
+            g_bLCDLowByte = false;
+            SimLCDWord(!(ui8Old & SIM_LCD_DC),
+                       (g_ui8LCDHighByte << 8) | ui8Byte);
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Gets the transfer counters.
+//
+//*****************************************************************************
+void
+SimLCDCountsGet(tSimBusCounts *psCounts)
+{
+    *psCounts = g_sLCDCounts;
+}
+
+//*****************************************************************************
+//
+// Gets a pixel in screen coordinates.  The firmware is built for the LANDSCAPE
+// orientation, in which the driver mirrors both axes of the controller RAM.
+//
+//*****************************************************************************
+uint16_t
+SimLCDPixelGet(int32_t i32X, int32_t i32Y)
+{
+    return(g_pui16LCDRAM[SIM_LCD_HEIGHT - 1 - i32Y][SIM_LCD_WIDTH - 1 - i32X]);
+}
+
+//*****************************************************************************
+//
+// Writes the frame buffer to a binary PPM file in screen orientation.
+//
+//*****************************************************************************
+bool
+SimLCDDump(const char *pcFile)
+{
+    FILE *psFile;
+    int32_t i32X, i32Y;
+    uint16_t ui16Pixel;
+    uint8_t pui8RGB[3];
+
+    psFile = fopen(pcFile, "wb");
+    if(!psFile)
+    {
+        return(false);
+    }
+
+    fprintf(psFile, "P6\n%d %d\n255\n", SIM_LCD_WIDTH, SIM_LCD_HEIGHT);
+    for(i32Y = 0; i32Y < SIM_LCD_HEIGHT; i32Y++)
+    {
+        for(i32X = 0; i32X < SIM_LCD_WIDTH; i32X++)
+        {
+            ui16Pixel = SimLCDPixelGet(i32X, i32Y);
+            pui8RGB[0] = ((ui16Pixel >> 11) & 0x1f) << 3;
+            pui8RGB[1] = ((ui16Pixel >> 5) & 0x3f) << 2;
+            pui8RGB[2] = (ui16Pixel & 0x1f) << 3;
+            pui8RGB[0] |= pui8RGB[0] >> 5;
+            pui8RGB[1] |= pui8RGB[1] >> 6;
+            pui8RGB[2] |= pui8RGB[2] >> 5;
+            fwrite(pui8RGB, 1, 3, psFile);
+        }
+    }
+
+    return(fclose(psFile) == 0);
+}
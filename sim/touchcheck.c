@@ -0,0 +1,110 @@
+//*****************************************************************************
+//
+// touchcheck.c - Checks the touch screen calibration transform.
+//
+// "zc706sim --touchcheck" runs the firmware's TouchScreenTransform(), which
+// replaces the divisions by M6 with a multiplication by a reciprocal, over
+// every pair of raw readings of the 12-bit ADC.  It compares each position
+// with the integer division of the calibration equations.  Every parameter
+// set is checked, and also with all its parameters negated, which gives the
+// same positions with a negative M6.  Nothing else of the firmware is run.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "touch.h"
+#include "sim.h"
+
+//*****************************************************************************
+//
+// The calibration parameter sets of the touch screen driver.
+//
+//*****************************************************************************
+#define SIM_TOUCH_NUM_SETS      2
+
+extern const int32_t g_lTouchParameters[SIM_TOUCH_NUM_SETS][7];
+
+//*****************************************************************************
+//
+// The number of raw readings of each axis.
+//
+//*****************************************************************************
+#define SIM_TOUCH_RAW_MAX       4096
+
+//*****************************************************************************
+//
+// Checks the transform with one parameter set.  Returns the number of
+// positions that differ, after printing the first of them.
+//
+//*****************************************************************************
+static uint32_t
+SimTouchCheckSet(const int32_t *pi32M, const char *pcName)
+{
+    int32_t i32RawX, i32RawY, i32X, i32Y, i32RefX, i32RefY;
+    uint32_t ui32Errors;
+
+    TouchScreenCalibrationSet(pi32M);
+
+    ui32Errors = 0;
+    for(i32RawX = 0; i32RawX < SIM_TOUCH_RAW_MAX; i32RawX++)
+    {
+        for(i32RawY = 0; i32RawY < SIM_TOUCH_RAW_MAX; i32RawY++)
+        {
+            i32RefX = (((int64_t)i32RawX * pi32M[0]) +
+                       ((int64_t)i32RawY * pi32M[1]) + pi32M[2]) / pi32M[6];
+            i32RefY = (((int64_t)i32RawX * pi32M[3]) +
+                       ((int64_t)i32RawY * pi32M[4]) + pi32M[5]) / pi32M[6];
+            TouchScreenTransform(i32RawX, i32RawY, &i32X, &i32Y);
+
+            if((i32X != i32RefX) || (i32Y != i32RefY))
+            {
+                if(ui32Errors == 0)
+                {
+                    fprintf(stderr, "sim: touch set %s: raw %d,%d gives "
+                            "%d,%d, expected %d,%d\n", pcName, i32RawX,
+                            i32RawY, i32X, i32Y, i32RefX, i32RefY);
+                }
+                ui32Errors++;
+            }
+        }
+    }
+
+    return(ui32Errors);
+}
+
+//*****************************************************************************
+//
+// Checks the transform with every parameter set.  Returns true if all
+// positions match.
+//
+//*****************************************************************************
+bool
+SimTouchCheck(void)
+{
+    int32_t pi32Negated[7];
+    uint32_t ui32Set, ui32Idx, ui32Errors;
+    char pcName[16];
+
+    ui32Errors = 0;
+    for(ui32Set = 0; ui32Set < SIM_TOUCH_NUM_SETS; ui32Set++)
+    {
+        snprintf(pcName, sizeof(pcName), "%u", ui32Set);
+        ui32Errors += SimTouchCheckSet(g_lTouchParameters[ui32Set], pcName);
+
+        for(ui32Idx = 0; ui32Idx < 7; ui32Idx++)
+        {
+            pi32Negated[ui32Idx] = -g_lTouchParameters[ui32Set][ui32Idx];
+        }
+        snprintf(pcName, sizeof(pcName), "-%u", ui32Set);
+        ui32Errors += SimTouchCheckSet(pi32Negated, pcName);
+    }
+
+    if(ui32Errors)
+    {
+        fprintf(stderr, "sim: %u touch positions differ\n", ui32Errors);
+    }
+
+    return(ui32Errors == 0);
+}
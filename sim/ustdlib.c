@@ -0,0 +1,96 @@
+//*****************************************************************************
+//
+// ustdlib.c - Host simulator replacement for the TivaWare string utilities.
+//
+// The firmware only uses the formatting subset of the TivaWare functions,
+// which the C library formats identically.
+//
+//*****************************************************************************
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "utils/ustdlib.h"
+
+int
+uvsnprintf(char *pcBuf, uint32_t ui32Size, const char *pcString,
+           va_list vaArgP)
+{
+    return(vsnprintf(pcBuf, ui32Size, pcString, vaArgP));
+}
+
+int
+usnprintf(char *pcBuf, uint32_t ui32Size, const char *pcString, ...)
+{
+    va_list vaArgP;
+    int iRet;
+
+    va_start(vaArgP, pcString);
+    iRet = vsnprintf(pcBuf, ui32Size, pcString, vaArgP);
+    va_end(vaArgP);
+
+    return(iRet);
+}
+
+int
+usprintf(char *pcBuf, const char *pcString, ...)
+{
+    va_list vaArgP;
+    int iRet;
+
+    va_start(vaArgP, pcString);
+    iRet = vsprintf(pcBuf, pcString, vaArgP);
+    va_end(vaArgP);
+
+    return(iRet);
+}
+
+int
+ustrncmp(const char *pcS1, const char *pcS2, uint32_t ui32N)
+{
+    return(strncmp(pcS1, pcS2, ui32N));
+}
+
+int
+ustrcmp(const char *pcS1, const char *pcS2)
+{
+    return(strcmp(pcS1, pcS2));
+}
+
+uint32_t
+ustrtoul(const char *pcStr, const char **ppcStrRet, int iBase)
+{
+    char *pcEnd;
+    uint32_t ui32Ret;
+
+    ui32Ret = strtoul(pcStr, &pcEnd, iBase);
+    if(ppcStrRet)
+    {
+        *ppcStrRet = pcEnd;
+    }
+
+    return(ui32Ret);
+}
+
+float
+ustrtof(const char *pcStr, const char **ppcStrRet)
+{
+    char *pcEnd;
+    float fRet;
+
+    fRet = strtof(pcStr, &pcEnd);
+    if(ppcStrRet)
+    {
+        *ppcStrRet = pcEnd;
+    }
+
+    return(fRet);
+}
+
+uint32_t
+ustrlen(const char *pcStr)
+{
+    return(strlen(pcStr));
+}
@@ -0,0 +1,579 @@
+//*****************************************************************************
+//
+// widget.c - Host simulator replacement for the TivaWare widget framework,
+//            with the canvas and rectangular push button widgets.
+//
+// The widget tree, the message queue and the pointer capture follow the
+// TivaWare implementation closely enough that the firmware's panels paint
+// and react to touches as they do on the target.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "grlib/grlib.h"
+#include "grlib/widget.h"
+#include "grlib/canvas.h"
+#include "grlib/pushbutton.h"
+
+//*****************************************************************************
+//
+// The root of the widget tree, which covers the whole screen.
+//
+//*****************************************************************************
+tWidget g_sRoot =
+{
+    sizeof(tWidget),
+    0,
+    0,
+    0,
+    0,
+    { 0, 0, 319, 239 },
+    WidgetDefaultMsgProc
+};
+
+//*****************************************************************************
+//
+// The message queue.
+//
+//*****************************************************************************
+#define QUEUE_SIZE              16
+
+typedef struct
+{
+    uint32_t ui32Flags;
+    tWidget *psWidget;
+    uint32_t ui32Message;
+    uint32_t ui32Param1;
+    uint32_t ui32Param2;
+}
+tWidgetMessageQueue;
+
+static tWidgetMessageQueue g_psMQ[QUEUE_SIZE];
+static volatile uint32_t g_ui32MQRead;
+static volatile uint32_t g_ui32MQWrite;
+
+//*****************************************************************************
+//
+// The widget that received the last pointer down message and so receives the
+// following move and up messages.
+//
+//*****************************************************************************
+static tWidget *g_psPointerWidget;
+
+//*****************************************************************************
+//
+// Returns true if a point lies within a rectangle.
+//
+//*****************************************************************************
+static bool
+SimRectContainsPoint(const tRectangle *psRect, int32_t i32X, int32_t i32Y)
+{
+    return((i32X >= psRect->i16XMin) && (i32X <= psRect->i16XMax) &&
+           (i32Y >= psRect->i16YMin) && (i32Y <= psRect->i16YMax));
+}
+
+//*****************************************************************************
+//
+// The default message handler, which handles nothing.
+//
+//*****************************************************************************
+int32_t
+WidgetDefaultMsgProc(tWidget *psWidget, uint32_t ui32Message,
+                     uint32_t ui32Param1, uint32_t ui32Param2)
+{
+    return(0);
+}
+
+//*****************************************************************************
+//
+// Adds a widget as the last child of a parent.
+//
+//*****************************************************************************
+void
+WidgetAdd(tWidget *psParent, tWidget *psWidget)
+{
+    tWidget *psTemp;
+
+    psWidget->psParent = psParent;
+    psWidget->psNext = 0;
+
+    if(!psParent->psChild)
+    {
+        psParent->psChild = psWidget;
+        return;
+    }
+
+    for(psTemp = psParent->psChild; psTemp->psNext; psTemp = psTemp->psNext)
+    {
+    }
+    psTemp->psNext = psWidget;
+}
+
+//*****************************************************************************
+//
+// Returns true if a widget is within the subtree rooted at another.
+//
+//*****************************************************************************
+static bool
+SimWidgetIsWithin(tWidget *psWidget, tWidget *psRoot)
+{
+    for(; psWidget; psWidget = psWidget->psParent)
+    {
+        if(psWidget == psRoot)
+        {
+            return(true);
+        }
+    }
+
+    return(false);
+}
+
+//*****************************************************************************
+//
+// Removes a widget, and its children, from the tree.
+//
+//*****************************************************************************
+void
+WidgetRemove(tWidget *psWidget)
+{
+    tWidget *psTemp;
+
+    if(!psWidget->psParent)
+    {
+        return;
+    }
+
+    if(g_psPointerWidget && SimWidgetIsWithin(g_psPointerWidget, psWidget))
+    {
+        g_psPointerWidget = 0;
+    }
+
+    if(psWidget->psParent->psChild == psWidget)
+    {
+        psWidget->psParent->psChild = psWidget->psNext;
+    }
+    else
+    {
+        for(psTemp = psWidget->psParent->psChild;
+            psTemp && (psTemp->psNext != psWidget); psTemp = psTemp->psNext)
+        {
+        }
+        if(psTemp)
+        {
+            psTemp->psNext = psWidget->psNext;
+        }
+    }
+
+    psWidget->psNext = 0;
+    psWidget->psParent = 0;
+}
+
+//*****************************************************************************
+//
+// Sends a message to a widget and then to its children.
+//
+//*****************************************************************************
+uint32_t
+WidgetMessageSendPreOrder(tWidget *psWidget, uint32_t ui32Message,
+                          uint32_t ui32Param1, uint32_t ui32Param2,
+                          bool bStopOnSuccess)
+{
+    tWidget *psChild;
+    uint32_t ui32Ret;
+
+    ui32Ret = psWidget->pfnMsgProc(psWidget, ui32Message, ui32Param1,
+                                   ui32Param2);
+    if(ui32Ret && bStopOnSuccess)
+    {
+        return(ui32Ret);
+    }
+
+    for(psChild = psWidget->psChild; psChild; psChild = psChild->psNext)
+    {
+        ui32Ret = WidgetMessageSendPreOrder(psChild, ui32Message, ui32Param1,
+                                            ui32Param2, bStopOnSuccess);
+        if(ui32Ret && bStopOnSuccess)
+        {
+            return(ui32Ret);
+        }
+    }
+
+    return(0);
+}
+
+//*****************************************************************************
+//
+// Sends a message to the children of a widget and then to the widget.  When
+// stopping on success, the widget that handled the message is remembered so
+// that a pointer down message can capture the pointer.
+//
+//*****************************************************************************
+static tWidget *g_psPostOrderHandler;
+
+uint32_t
+WidgetMessageSendPostOrder(tWidget *psWidget, uint32_t ui32Message,
+                           uint32_t ui32Param1, uint32_t ui32Param2,
+                           bool bStopOnSuccess)
+{
+    tWidget *psChild;
+    uint32_t ui32Ret;
+
+    for(psChild = psWidget->psChild; psChild; psChild = psChild->psNext)
+    {
+        ui32Ret = WidgetMessageSendPostOrder(psChild, ui32Message, ui32Param1,
+                                             ui32Param2, bStopOnSuccess);
+        if(ui32Ret && bStopOnSuccess)
+        {
+            return(ui32Ret);
+        }
+    }
+
+    ui32Ret = psWidget->pfnMsgProc(psWidget, ui32Message, ui32Param1,
+                                   ui32Param2);
+    if(ui32Ret)
+    {
+        g_psPostOrderHandler = psWidget;
+    }
+
+    return(ui32Ret);
+}
+
+//*****************************************************************************
+//
+// Adds a message to the queue.  Returns -1 if the queue is full.
+//
+//*****************************************************************************
+int32_t
+WidgetMessageQueueAdd(tWidget *psWidget, uint32_t ui32Message,
+                      uint32_t ui32Param1, uint32_t ui32Param2,
+                      bool bPostOrder, bool bStopOnSuccess)
+{
+    uint32_t ui32Next;
+
+    ui32Next = (g_ui32MQWrite + 1) % QUEUE_SIZE;
+    if(ui32Next == g_ui32MQRead)
+    {
+        return(-1);
+    }
+
+    g_psMQ[g_ui32MQWrite].ui32Flags = ((bPostOrder ? MQ_FLAG_POST_ORDER : 0) |
+                                       (bStopOnSuccess ?
+                                        MQ_FLAG_STOP_ON_SUCCESS : 0));
+    g_psMQ[g_ui32MQWrite].psWidget = psWidget;
+    g_psMQ[g_ui32MQWrite].ui32Message = ui32Message;
+    g_psMQ[g_ui32MQWrite].ui32Param1 = ui32Param1;
+    g_psMQ[g_ui32MQWrite].ui32Param2 = ui32Param2;
+    g_ui32MQWrite = ui32Next;
+
+    return(0);
+}
+
+//*****************************************************************************
+//
+// Processes the queued messages.
+//
+//*****************************************************************************
+void
+WidgetMessageQueueProcess(void)
+{
+    tWidgetMessageQueue sMsg;
+    uint32_t ui32Ret;
+
+    while(g_ui32MQRead != g_ui32MQWrite)
+    {
+        sMsg = g_psMQ[g_ui32MQRead];
+        g_ui32MQRead = (g_ui32MQRead + 1) % QUEUE_SIZE;
+
+        if(!(sMsg.ui32Flags & MQ_FLAG_POST_ORDER))
+        {
+            WidgetMessageSendPreOrder(sMsg.psWidget, sMsg.ui32Message,
+                                      sMsg.ui32Param1, sMsg.ui32Param2,
+                                      sMsg.ui32Flags &
+                                      MQ_FLAG_STOP_ON_SUCCESS);
+            continue;
+        }
+
+        //
+        // Pointer move and up messages go to the widget that took the
+        // pointer down message, if any.
+        //
+        if(g_psPointerWidget &&
+           ((sMsg.ui32Message == WIDGET_MSG_PTR_MOVE) ||
+            (sMsg.ui32Message == WIDGET_MSG_PTR_UP)))
+        {
+            g_psPointerWidget->pfnMsgProc(g_psPointerWidget, sMsg.ui32Message,
+                                          sMsg.ui32Param1, sMsg.ui32Param2);
+            if(sMsg.ui32Message == WIDGET_MSG_PTR_UP)
+            {
+                g_psPointerWidget = 0;
+            }
+            continue;
+        }
+
+        g_psPostOrderHandler = 0;
+        ui32Ret = WidgetMessageSendPostOrder(sMsg.psWidget, sMsg.ui32Message,
+                                             sMsg.ui32Param1, sMsg.ui32Param2,
+                                             sMsg.ui32Flags &
+                                             MQ_FLAG_STOP_ON_SUCCESS);
+        if(ui32Ret && (sMsg.ui32Message == WIDGET_MSG_PTR_DOWN))
+        {
+            g_psPointerWidget = g_psPostOrderHandler;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Queues a pointer message for the widget tree.
+//
+//*****************************************************************************
+int32_t
+WidgetPointerMessage(uint32_t ui32Message, int32_t i32X, int32_t i32Y)
+{
+    return(WidgetMessageQueueAdd(WIDGET_ROOT, ui32Message, i32X, i32Y, 1, 1));
+}
+
+//*****************************************************************************
+//
+// Initializes a context clipped to a widget.
+//
+//*****************************************************************************
+static void
+SimWidgetContextInit(tWidget *psWidget, tContext *psContext)
+{
+    GrContextInit(psContext, psWidget->psDisplay);
+    GrContextClipRegionSet(psContext, &psWidget->sPosition);
+}
+
+//*****************************************************************************
+//
+// Paints a canvas.
+//
+//*****************************************************************************
+static void
+CanvasPaint(tWidget *psWidget)
+{
+    tCanvasWidget *psCanvas;
+    tContext sCtx;
+    int32_t i32X, i32Y;
+
+    psCanvas = (tCanvasWidget *)psWidget;
+    SimWidgetContextInit(psWidget, &sCtx);
+
+    if(psCanvas->ui32Style & CANVAS_STYLE_FILL)
+    {
+        GrContextForegroundSet(&sCtx, psCanvas->ui32FillColor);
+        GrRectFill(&sCtx, &psWidget->sPosition);
+    }
+
+    if(psCanvas->ui32Style & CANVAS_STYLE_OUTLINE)
+    {
+        GrContextForegroundSet(&sCtx, psCanvas->ui32OutlineColor);
+        GrRectDraw(&sCtx, &psWidget->sPosition);
+    }
+
+    i32X = (psWidget->sPosition.i16XMin + psWidget->sPosition.i16XMax) / 2;
+    i32Y = (psWidget->sPosition.i16YMin + psWidget->sPosition.i16YMax) / 2;
+
+    if((psCanvas->ui32Style & CANVAS_STYLE_IMG) && psCanvas->pui8Image)
+    {
+        GrContextForegroundSet(&sCtx, psCanvas->ui32TextColor);
+        GrContextBackgroundSet(&sCtx, psCanvas->ui32FillColor);
+        GrImageDraw(&sCtx, psCanvas->pui8Image,
+                    i32X - (GrImageWidthGet(psCanvas->pui8Image) / 2),
+                    i32Y - (GrImageHeightGet(psCanvas->pui8Image) / 2));
+    }
+
+    if((psCanvas->ui32Style & CANVAS_STYLE_TEXT) && psCanvas->pcText)
+    {
+        GrContextFontSet(&sCtx, psCanvas->psFont);
+        GrContextForegroundSet(&sCtx, psCanvas->ui32TextColor);
+        GrContextBackgroundSet(&sCtx, psCanvas->ui32FillColor);
+        GrStringDrawCentered(&sCtx, psCanvas->pcText, -1, i32X, i32Y,
+                             psCanvas->ui32Style & CANVAS_STYLE_TEXT_OPAQUE);
+    }
+
+    if((psCanvas->ui32Style & CANVAS_STYLE_APP_DRAWN) && psCanvas->pfnOnPaint)
+    {
+        psCanvas->pfnOnPaint(psWidget, &sCtx);
+    }
+}
+
+//*****************************************************************************
+//
+// The canvas message handler.
+//
+//*****************************************************************************
+int32_t
+CanvasMsgProc(tWidget *psWidget, uint32_t ui32Msg, uint32_t ui32Param1,
+              uint32_t ui32Param2)
+{
+    if(ui32Msg == WIDGET_MSG_PAINT)
+    {
+        CanvasPaint(psWidget);
+        return(1);
+    }
+
+    return(WidgetDefaultMsgProc(psWidget, ui32Msg, ui32Param1, ui32Param2));
+}
+
+//*****************************************************************************
+//
+// Paints a rectangular push button.
+//
+//*****************************************************************************
+static void
+RectangularButtonPaint(tWidget *psWidget)
+{
+    tPushButtonWidget *psPush;
+    const uint8_t *pui8Image;
+    uint32_t ui32Fill;
+    tContext sCtx;
+    int32_t i32X, i32Y;
+
+    psPush = (tPushButtonWidget *)psWidget;
+    SimWidgetContextInit(psWidget, &sCtx);
+
+    ui32Fill = ((psPush->ui32Style & PB_STYLE_PRESSED) ?
+                psPush->ui32PressFillColor : psPush->ui32FillColor);
+
+    if(psPush->ui32Style & PB_STYLE_FILL)
+    {
+        GrContextForegroundSet(&sCtx, ui32Fill);
+        GrRectFill(&sCtx, &psWidget->sPosition);
+    }
+
+    if(psPush->ui32Style & PB_STYLE_OUTLINE)
+    {
+        GrContextForegroundSet(&sCtx, psPush->ui32OutlineColor);
+        GrRectDraw(&sCtx, &psWidget->sPosition);
+    }
+
+    i32X = (psWidget->sPosition.i16XMin + psWidget->sPosition.i16XMax) / 2;
+    i32Y = (psWidget->sPosition.i16YMin + psWidget->sPosition.i16YMax) / 2;
+
+    pui8Image = (((psPush->ui32Style & PB_STYLE_PRESSED) &&
+                  psPush->pui8PressImage) ? psPush->pui8PressImage :
+                 psPush->pui8Image);
+    if((psPush->ui32Style & PB_STYLE_IMG) && pui8Image)
+    {
+        GrContextForegroundSet(&sCtx, psPush->ui32TextColor);
+        GrContextBackgroundSet(&sCtx, ui32Fill);
+        GrImageDraw(&sCtx, pui8Image,
+                    i32X - (GrImageWidthGet(pui8Image) / 2),
+                    i32Y - (GrImageHeightGet(pui8Image) / 2));
+    }
+
+    if((psPush->ui32Style & PB_STYLE_TEXT) && psPush->pcText)
+    {
+        GrContextFontSet(&sCtx, psPush->psFont);
+        GrContextForegroundSet(&sCtx, psPush->ui32TextColor);
+        GrContextBackgroundSet(&sCtx, ui32Fill);
+        GrStringDrawCentered(&sCtx, psPush->pcText, -1, i32X, i32Y,
+                             psPush->ui32Style & PB_STYLE_TEXT_OPAQUE);
+    }
+}
+
+//*****************************************************************************
+//
+// Handles pointer messages for a rectangular push button.  The button is
+// pressed while the pointer is down on it and calls its click handler on the
+// press, or on the release if PB_STYLE_RELEASE_NOTIFY is set.
+//
+//*****************************************************************************
+static int32_t
+RectangularButtonClick(tWidget *psWidget, uint32_t ui32Msg, int32_t i32X,
+                       int32_t i32Y)
+{
+    tPushButtonWidget *psPush;
+    bool bInside;
+
+    psPush = (tPushButtonWidget *)psWidget;
+    bInside = SimRectContainsPoint(&psWidget->sPosition, i32X, i32Y);
+
+    if(ui32Msg == WIDGET_MSG_PTR_DOWN)
+    {
+        if(!bInside)
+        {
+            return(0);
+        }
+
+        psPush->ui32Style |= PB_STYLE_PRESSED;
+        RectangularButtonPaint(psWidget);
+        if(psPush->pfnOnClick &&
+           !(psPush->ui32Style & PB_STYLE_RELEASE_NOTIFY))
+        {
+            psPush->pfnOnClick(psWidget);
+        }
+        return(1);
+    }
+
+    if(ui32Msg == WIDGET_MSG_PTR_MOVE)
+    {
+        if(bInside != ((psPush->ui32Style & PB_STYLE_PRESSED) != 0))
+        {
+            if(bInside)
+            {
+                psPush->ui32Style |= PB_STYLE_PRESSED;
+            }
+            else
+            {
+                psPush->ui32Style &= ~PB_STYLE_PRESSED;
+            }
+            RectangularButtonPaint(psWidget);
+        }
+        return(bInside);
+    }
+
+    if(ui32Msg == WIDGET_MSG_PTR_UP)
+    {
+        if(psPush->ui32Style & PB_STYLE_PRESSED)
+        {
+            psPush->ui32Style &= ~PB_STYLE_PRESSED;
+            RectangularButtonPaint(psWidget);
+            if(bInside && psPush->pfnOnClick &&
+               (psPush->ui32Style & PB_STYLE_RELEASE_NOTIFY))
+            {
+                psPush->pfnOnClick(psWidget);
+            }
+        }
+        return(bInside);
+    }
+
+    return(0);
+}
+
+//*****************************************************************************
+//
+// The rectangular push button message handler.
+//
+//*****************************************************************************
+int32_t
+RectangularButtonMsgProc(tWidget *psWidget, uint32_t ui32Msg,
+                         uint32_t ui32Param1, uint32_t ui32Param2)
+{
+    switch(ui32Msg)
+    {
+        case WIDGET_MSG_PAINT:
+        {
+            RectangularButtonPaint(psWidget);
+            return(1);
+        }
+
+        case WIDGET_MSG_PTR_DOWN:
+        case WIDGET_MSG_PTR_MOVE:
+        case WIDGET_MSG_PTR_UP:
+        {
+            return(RectangularButtonClick(psWidget, ui32Msg,
+                                          (int32_t)ui32Param1,
+                                          (int32_t)ui32Param2));
+        }
+
+        default:
+        {
+            return(WidgetDefaultMsgProc(psWidget, ui32Msg, ui32Param1,
+                                        ui32Param2));
+        }
+    }
+}
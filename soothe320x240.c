@@ -1,6671 +0,0 @@
-#include <stdint.h>
-#include <stdbool.h>
-#include "grlib/grlib.h"
-
-
-const uint8_t g_pui_Soothing_Image[] =
-{
-    IMAGE_FMT_8BPP_UNCOMP,
-    64, 1,
-    //    240, 0,
-        216, 0,
-
-    255,
-    0x04, 0x11, 0x0a,
-    0x00, 0x13, 0x0f,
-    0x08, 0x18, 0x15,
-    0x02, 0x1a, 0x14,
-    0x00, 0x1b, 0x17,
-    0x0f, 0x1c, 0x19,
-    0x0a, 0x1e, 0x18,
-    0x0e, 0x20, 0x1e,
-    0x05, 0x25, 0x1f,
-    0x12, 0x24, 0x1d,
-    0x13, 0x23, 0x22,
-    0x0f, 0x26, 0x20,
-    0x12, 0x2a, 0x24,
-    0x17, 0x28, 0x27,
-    0x18, 0x2b, 0x24,
-    0x16, 0x2d, 0x27,
-    0x0c, 0x31, 0x2a,
-    0x26, 0x2c, 0x2d,
-    0x1f, 0x31, 0x2a,
-    0x1b, 0x32, 0x2c,
-    0x16, 0x33, 0x2d,
-    0x1e, 0x34, 0x34,
-    0x20, 0x38, 0x32,
-    0x1b, 0x38, 0x34,
-    0x16, 0x3a, 0x32,
-    0x1c, 0x3a, 0x31,
-    0x22, 0x3c, 0x30,
-    0x07, 0x3f, 0x36,
-    0x28, 0x3a, 0x35,
-    0x10, 0x3f, 0x38,
-    0x21, 0x3f, 0x36,
-    0x26, 0x3f, 0x35,
-    0x1c, 0x41, 0x38,
-    0x27, 0x47, 0x3d,
-    0x23, 0x47, 0x3f,
-    0x1e, 0x49, 0x3f,
-    0x30, 0x48, 0x3e,
-    0x1b, 0x4e, 0x44,
-    0x12, 0x50, 0x47,
-    0x2a, 0x4f, 0x45,
-    0x24, 0x4f, 0x48,
-    0x25, 0x51, 0x44,
-    0x2f, 0x4f, 0x45,
-    0x2b, 0x57, 0x4b,
-    0x25, 0x58, 0x4c,
-    0x15, 0x5a, 0x50,
-    0x33, 0x57, 0x4c,
-    0x0f, 0x5e, 0x53,
-    0x20, 0x5f, 0x52,
-    0x31, 0x5d, 0x52,
-    0x47, 0x59, 0x52,
-    0x27, 0x5f, 0x53,
-    0x2c, 0x5f, 0x53,
-    0x39, 0x5e, 0x53,
-    0x27, 0x66, 0x59,
-    0x32, 0x65, 0x57,
-    0x2d, 0x67, 0x57,
-    0x21, 0x68, 0x5a,
-    0x3e, 0x66, 0x59,
-    0x2f, 0x67, 0x5d,
-    0x3a, 0x66, 0x5b,
-    0x1d, 0x6c, 0x60,
-    0x36, 0x67, 0x62,
-    0x0f, 0x6f, 0x63,
-    0x49, 0x69, 0x5d,
-    0x28, 0x6f, 0x61,
-    0x34, 0x6d, 0x64,
-    0x30, 0x70, 0x62,
-    0x30, 0x6e, 0x66,
-    0x36, 0x70, 0x60,
-    0x3b, 0x6e, 0x63,
-    0x42, 0x6e, 0x61,
-    0x2e, 0x77, 0x63,
-    0x2e, 0x75, 0x68,
-    0x35, 0x75, 0x67,
-    0x3a, 0x75, 0x66,
-    0x1b, 0x78, 0x6c,
-    0x29, 0x77, 0x6a,
-    0x11, 0x7a, 0x6d,
-    0x35, 0x74, 0x6c,
-    0x42, 0x75, 0x6a,
-    0x38, 0x7a, 0x66,
-    0x61, 0x70, 0x6c,
-    0x38, 0x79, 0x6a,
-    0x3e, 0x79, 0x69,
-    0x4a, 0x78, 0x6c,
-    0x50, 0x78, 0x6b,
-    0x2d, 0x7e, 0x6d,
-    0x57, 0x78, 0x6a,
-    0x3b, 0x7e, 0x6a,
-    0x3b, 0x7c, 0x6e,
-    0x2e, 0x7d, 0x72,
-    0x42, 0x7e, 0x6b,
-    0x37, 0x7e, 0x71,
-    0x48, 0x7c, 0x70,
-    0x42, 0x7c, 0x73,
-    0x3d, 0x7d, 0x75,
-    0x3e, 0x7f, 0x71,
-    0x32, 0x7e, 0x79,
-    0x1c, 0x86, 0x79,
-    0x41, 0x84, 0x70,
-    0x41, 0x82, 0x74,
-    0x3c, 0x85, 0x72,
-    0x3c, 0x83, 0x77,
-    0x30, 0x87, 0x77,
-    0x49, 0x84, 0x74,
-    0x37, 0x86, 0x78,
-    0x43, 0x85, 0x77,
-    0x31, 0x84, 0x80,
-    0x49, 0x84, 0x7a,
-    0x44, 0x84, 0x7c,
-    0x32, 0x87, 0x7d,
-    0x58, 0x84, 0x77,
-    0x46, 0x8a, 0x75,
-    0x41, 0x8a, 0x77,
-    0x3f, 0x86, 0x80,
-    0x40, 0x88, 0x7c,
-    0x47, 0x89, 0x7a,
-    0x52, 0x87, 0x7b,
-    0x67, 0x89, 0x7a,
-    0x45, 0x8f, 0x7c,
-    0x7a, 0x84, 0x80,
-    0x3a, 0x90, 0x80,
-    0x51, 0x8d, 0x7e,
-    0x4c, 0x8e, 0x7f,
-    0x46, 0x8e, 0x82,
-    0x26, 0x93, 0x84,
-    0x51, 0x8c, 0x83,
-    0x39, 0x8f, 0x86,
-    0x34, 0x92, 0x82,
-    0x68, 0x88, 0x84,
-    0x5f, 0x8c, 0x80,
-    0x42, 0x92, 0x80,
-    0x41, 0x90, 0x85,
-    0x41, 0x8e, 0x89,
-    0x4d, 0x8f, 0x88,
-    0x49, 0x92, 0x85,
-    0x4a, 0x94, 0x81,
-    0x50, 0x92, 0x84,
-    0x25, 0x9b, 0x8c,
-    0x79, 0x90, 0x87,
-    0x48, 0x99, 0x88,
-    0x33, 0x9b, 0x8c,
-    0x59, 0x95, 0x8a,
-    0x4f, 0x99, 0x86,
-    0x54, 0x97, 0x89,
-    0x4f, 0x97, 0x8b,
-    0x41, 0x9b, 0x8a,
-    0x68, 0x95, 0x88,
-    0x3d, 0x99, 0x91,
-    0x44, 0x9a, 0x90,
-    0x4b, 0x9a, 0x8f,
-    0x56, 0x98, 0x91,
-    0x62, 0x98, 0x8d,
-    0x22, 0xa2, 0x91,
-    0x4b, 0x99, 0x95,
-    0x76, 0x98, 0x88,
-    0x52, 0x99, 0x94,
-    0x4d, 0x9e, 0x8d,
-    0x53, 0x9e, 0x8b,
-    0x8e, 0x91, 0x8f,
-    0x59, 0x9e, 0x89,
-    0x75, 0x95, 0x91,
-    0x53, 0x9d, 0x90,
-    0x5a, 0x9d, 0x8f,
-    0x8a, 0x93, 0x92,
-    0x6f, 0x9c, 0x90,
-    0x51, 0xa2, 0x91,
-    0x3c, 0xa5, 0x93,
-    0x4a, 0xa3, 0x94,
-    0x57, 0xa3, 0x90,
-    0x4d, 0xa6, 0x90,
-    0x4b, 0xa2, 0x99,
-    0x89, 0x99, 0x94,
-    0x52, 0xa2, 0x97,
-    0x5e, 0xa2, 0x94,
-    0x59, 0xa3, 0x97,
-    0x59, 0xa1, 0x9c,
-    0x5f, 0xa1, 0x9a,
-    0x53, 0xa2, 0x9e,
-    0x55, 0xa7, 0x95,
-    0x4e, 0xa3, 0xa0,
-    0x5b, 0xa7, 0x94,
-    0x52, 0xac, 0x96,
-    0x5d, 0xa3, 0xa4,
-    0x76, 0xa4, 0x99,
-    0x52, 0xa9, 0xa0,
-    0x5f, 0xab, 0x98,
-    0x59, 0xaa, 0x9f,
-    0x45, 0xaf, 0x9d,
-    0x5b, 0xac, 0x9b,
-    0x54, 0xa8, 0xa6,
-    0x62, 0xaa, 0x9e,
-    0x5b, 0xa9, 0xa5,
-    0x6c, 0xa9, 0x9f,
-    0x61, 0xa9, 0xa4,
-    0x72, 0xa9, 0x9e,
-    0x86, 0xa8, 0x9a,
-    0x96, 0xa3, 0x9f,
-    0x5b, 0xa8, 0xab,
-    0x8f, 0xa4, 0xa3,
-    0x68, 0xab, 0xa4,
-    0x62, 0xa9, 0xab,
-    0x92, 0xaa, 0x98,
-    0x88, 0xa7, 0xa3,
-    0x7e, 0xad, 0x9f,
-    0x6b, 0xab, 0xac,
-    0x80, 0xac, 0xa5,
-    0x70, 0xb6, 0xa8,
-    0x70, 0xb0, 0xb4,
-    0x66, 0xb8, 0xaa,
-    0x86, 0xb5, 0xa6,
-    0x89, 0xb4, 0xac,
-    0x79, 0xb7, 0xae,
-    0x80, 0xb7, 0xae,
-    0x96, 0xb3, 0xae,
-    0x8b, 0xb4, 0xb3,
-    0xa0, 0xb8, 0xa5,
-    0x95, 0xb8, 0xac,
-    0xa0, 0xb7, 0xae,
-    0x94, 0xb7, 0xb4,
-    0xa2, 0xb5, 0xb3,
-    0x90, 0xbc, 0xb3,
-    0x9d, 0xba, 0xb5,
-    0x90, 0xbb, 0xbb,
-    0x7e, 0xc2, 0xbc,
-    0x7d, 0xc5, 0xb7,
-    0x97, 0xc3, 0xbb,
-    0xa1, 0xc2, 0xbe,
-    0xa1, 0xc5, 0xba,
-    0x90, 0xc8, 0xbf,
-    0xa6, 0xc2, 0xc3,
-    0x8b, 0xca, 0xc0,
-    0xb6, 0xc7, 0xb9,
-    0xaf, 0xc7, 0xbc,
-    0xb5, 0xc6, 0xc3,
-    0x9e, 0xcc, 0xc4,
-    0xa9, 0xcd, 0xc4,
-    0xa9, 0xc9, 0xcc,
-    0xb2, 0xd4, 0xcc,
-    0xbc, 0xd4, 0xcc,
-    0xc3, 0xd4, 0xcc,
-    0xa9, 0xd8, 0xcf,
-    0xb8, 0xd7, 0xda,
-    0xbb, 0xdd, 0xd5,
-    0xc4, 0xdc, 0xd5,
-    0xd0, 0xd9, 0xd9,
-    0xcc, 0xdc, 0xd5,
-    0xce, 0xe5, 0xdb,
-    0xd2, 0xe4, 0xe1,
-    0xc6, 0xe8, 0xe1,
-    0xdf, 0xe9, 0xe0,
-    0xda, 0xed, 0xe7,
-    0xe2, 0xf5, 0xf1,
-    0xed, 0xf6, 0xed,
-    0xf1, 0xf8, 0xf7,
-
-    0x2a, 0x2a, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x35, 0x35,
-    0x35, 0x35, 0x35, 0x3a, 0x3a, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
-    0x47, 0x47, 0x47, 0x47, 0x46, 0x50, 0x55, 0x50, 0x50, 0x5e, 0x5e, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x76, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x7b, 0x7b,
-    0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b,
-    0x7b, 0x7b, 0x7b, 0x8f, 0x8f, 0x8f, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
-    0xa4, 0xa4, 0xa4, 0xa4, 0xaf, 0xaf, 0xaf, 0xaf, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xa4, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xa4, 0xa4,
-    0xa4, 0xa4, 0xa4, 0xa4, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x78, 0x78, 0x78, 0x72,
-    0x74, 0x74, 0x74, 0x74, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x5a, 0x5a,
-    0x5a, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x38, 0x38, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x34, 0x31, 0x31, 0x31, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29,
-    0x29, 0x29, 0x29, 0x23, 0x23, 0x23, 0x23, 0x23, 0x22, 0x22, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x1e, 0x1e, 0x1e, 0x19, 0x19, 0x19, 0x14, 0x14, 0x14, 0x14,
-    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x13, 0x13,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x2a, 0x2a, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x3a,
-    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x47, 0x47, 0x47, 0x47, 0x47, 0x50,
-    0x55, 0x55, 0x55, 0x50, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x76, 0x76, 0x76,
-    0x69, 0x69, 0x69, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b,
-    0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x8f, 0x8f, 0x8f, 0x8f,
-    0x8f, 0x8f, 0x91, 0x91, 0x91, 0x91, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
-    0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
-    0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x78, 0x78, 0x78, 0x72, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x67, 0x67, 0x67, 0x67, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53,
-    0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x34, 0x34, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
-    0x23, 0x23, 0x23, 0x23, 0x22, 0x22, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1e, 0x1e,
-    0x1e, 0x19, 0x19, 0x19, 0x17, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
-    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0b, 0x0b, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x35,
-    0x35, 0x35, 0x35, 0x35, 0x3a, 0x3a, 0x3a, 0x3a, 0x3c, 0x3c, 0x3c, 0x3c,
-    0x3c, 0x47, 0x47, 0x47, 0x47, 0x46, 0x50, 0x55, 0x55, 0x50, 0x5e, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x76, 0x76, 0x69, 0x69, 0x69, 0x7b, 0x7b, 0x7b,
-    0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b,
-    0x7b, 0x7b, 0x8f, 0x8f, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
-    0xa4, 0xa4, 0xa4, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x78, 0x78, 0x78, 0x72, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65,
-    0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x45, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x34,
-    0x34, 0x34, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x29, 0x23, 0x23, 0x23, 0x23,
-    0x22, 0x22, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1e, 0x1e, 0x1e, 0x19, 0x19, 0x19,
-    0x17, 0x17, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
-    0x14, 0x14, 0x14, 0x14, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x3a,
-    0x3a, 0x3a, 0x3a, 0x3c, 0x3c, 0x3c, 0x3c, 0x47, 0x47, 0x47, 0x47, 0x46,
-    0x50, 0x50, 0x55, 0x50, 0x50, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x76,
-    0x76, 0x69, 0x69, 0x69, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b,
-    0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x8f, 0x8f, 0x8f,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
-    0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x78, 0x78, 0x78, 0x78, 0x72,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61,
-    0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x38, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x34, 0x34, 0x34, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x29, 0x29, 0x29, 0x29, 0x29, 0x23, 0x23, 0x23, 0x22, 0x22, 0x22, 0x22,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x1e, 0x1e, 0x1e, 0x19, 0x19, 0x19, 0x17, 0x17, 0x17, 0x14,
-    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x2e, 0x2e, 0x2e, 0x35,
-    0x35, 0x35, 0x35, 0x35, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3c, 0x3c, 0x3c,
-    0x3c, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x50, 0x55, 0x50, 0x50, 0x50,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x69, 0x69, 0x69, 0x69, 0x69, 0x7b, 0x7b,
-    0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b,
-    0x7b, 0x7b, 0x8f, 0x8f, 0x8f, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
-    0xa4, 0xa4, 0xa4, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xaa, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x78, 0x78, 0x78, 0x78, 0x72, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a,
-    0x5a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x38, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x31, 0x31,
-    0x31, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29,
-    0x29, 0x29, 0x23, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1e, 0x1e,
-    0x1e, 0x19, 0x19, 0x19, 0x17, 0x17, 0x17, 0x14, 0x14, 0x14, 0x14, 0x14,
-    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x2e, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x3a,
-    0x3a, 0x3a, 0x3a, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b,
-    0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x8f, 0x8f, 0x8f,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
-    0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x78,
-    0x78, 0x78, 0x78, 0x72, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-    0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65,
-    0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x53, 0x53, 0x53, 0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45,
-    0x45, 0x38, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x31, 0x31, 0x31, 0x31, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x23,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1e, 0x1e, 0x1e, 0x1e, 0x19, 0x19,
-    0x17, 0x17, 0x17, 0x17, 0x14, 0x14, 0x13, 0x14, 0x14, 0x14, 0x14, 0x14,
-    0x14, 0x14, 0x14, 0x14, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x35, 0x35, 0x35, 0x35, 0x35, 0x3a, 0x3a, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
-    0x3c, 0x3c, 0x47, 0x47, 0x47, 0x46, 0x46, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x50, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x69, 0x69, 0x69, 0x69, 0x7b,
-    0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b,
-    0x7b, 0x7b, 0x8f, 0x8f, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
-    0xa4, 0xa4, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x78, 0x78, 0x78, 0x78, 0x72,
-    0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65,
-    0x61, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x53,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x38, 0x38,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x34, 0x34, 0x34, 0x34,
-    0x34, 0x34, 0x34, 0x34, 0x31, 0x31, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x29, 0x23, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x1e, 0x1e, 0x19, 0x19, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x14, 0x14, 0x14, 0x13, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x35, 0x35, 0x35, 0x3a,
-    0x3a, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x47, 0x47, 0x47,
-    0x46, 0x46, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x5e, 0x69, 0x69, 0x69, 0x69, 0x69, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b,
-    0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
-    0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xaf, 0xaf, 0xa4, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x78, 0x78, 0x78, 0x78, 0x72, 0x74, 0x74, 0x74, 0x74,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6b, 0x75, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61,
-    0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x54, 0x4b, 0x4b, 0x4b,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
-    0x31, 0x31, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29,
-    0x29, 0x29, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x1e, 0x1e, 0x19, 0x19, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x14, 0x14,
-    0x13, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x31, 0x31, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
-    0x3c, 0x3c, 0x47, 0x47, 0x47, 0x46, 0x47, 0x46, 0x50, 0x50, 0x50, 0x50,
-    0x50, 0x5e, 0x5e, 0x5e, 0x5e, 0x54, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
-    0xa4, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xaa, 0xb6, 0xb6, 0xb6,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x78, 0x78,
-    0x78, 0x78, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x61,
-    0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x61, 0x61, 0x61, 0x61, 0x61,
-    0x61, 0x61, 0x5a, 0x5a, 0x53, 0x53, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x34, 0x34, 0x34, 0x34, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x29,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1e, 0x1e, 0x19, 0x19,
-    0x17, 0x17, 0x17, 0x17, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
-    0x14, 0x14, 0x14, 0x14, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c,
-    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x47, 0x47, 0x46,
-    0x46, 0x46, 0x46, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5e, 0x5e, 0x5e, 0x54,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x7b, 0x7b, 0x7b, 0x7b,
-    0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x8f, 0x8a, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xa4, 0xa4, 0xa4,
-    0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xbb, 0xbb, 0xbb, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x78, 0x78, 0x78, 0x78, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
-    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x5a, 0x5a,
-    0x53, 0x53, 0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x38,
-    0x38, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x34, 0x34, 0x34, 0x34, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x1e, 0x1e, 0x19, 0x19, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x14, 0x14, 0x14, 0x13, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
-    0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x3c, 0x3c, 0x3c, 0x3c,
-    0x3c, 0x3c, 0x3c, 0x47, 0x47, 0x46, 0x46, 0x46, 0x46, 0x46, 0x50, 0x50,
-    0x50, 0x50, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
-    0xa4, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x78, 0x78, 0x78, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
-    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x53, 0x53, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x34, 0x34,
-    0x34, 0x34, 0x31, 0x31, 0x31, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29,
-    0x29, 0x29, 0x29, 0x29, 0x29, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x18,
-    0x18, 0x18, 0x19, 0x19, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x14, 0x14,
-    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x0f, 0x0f, 0x0f, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x47, 0x47, 0x46,
-    0x46, 0x46, 0x46, 0x46, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5e, 0x5e, 0x5e,
-    0x5e, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x7b, 0x75,
-    0x7b, 0x7b, 0x7b, 0x7b, 0x8a, 0x8a, 0x8a, 0x8a, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xa4,
-    0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x78,
-    0x78, 0x78, 0x7d, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
-    0x61, 0x61, 0x5a, 0x5a, 0x53, 0x53, 0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x34, 0x34, 0x34, 0x34, 0x31, 0x31,
-    0x31, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x29,
-    0x29, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x18, 0x18, 0x18, 0x19, 0x19,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
-    0x14, 0x14, 0x14, 0x14, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x3c, 0x3c, 0x3c, 0x3c, 0x47, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x50,
-    0x50, 0x50, 0x50, 0x50, 0x5e, 0x5e, 0x54, 0x54, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x75, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
-    0xa4, 0xa4, 0xa4, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa7, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x78, 0x78, 0x78, 0x7d, 0x74,
-    0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61,
-    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a,
-    0x53, 0x53, 0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x34, 0x34, 0x34, 0x34, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x23, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x18, 0x18, 0x18, 0x19, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0b, 0x0b, 0x0b, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x3c, 0x3c, 0x47, 0x47,
-    0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5e,
-    0x5e, 0x5e, 0x54, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x75, 0x75, 0x7b, 0x7b, 0x7c, 0x7c, 0x8a, 0x8a, 0x8a, 0x8a, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xa7, 0xa7, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x78, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x7c, 0x7c, 0x7c, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x61, 0x61,
-    0x61, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x54, 0x4b,
-    0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x38, 0x38, 0x38, 0x38,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x34, 0x34,
-    0x34, 0x34, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x18, 0x18, 0x18, 0x18, 0x19, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b,
-    0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x0d, 0x0a, 0x0a, 0x0a, 0x3c, 0x47, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
-    0x50, 0x50, 0x50, 0x50, 0x50, 0x5e, 0x5e, 0x5e, 0x5e, 0x54, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x7b, 0x75, 0x7b, 0x7b, 0x7b,
-    0x7c, 0x8a, 0x8a, 0x8a, 0x8a, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
-    0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xb6, 0xb6, 0xb6, 0xb6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa7, 0xa7,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x54, 0x4b, 0x4b, 0x4b, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37,
-    0x34, 0x34, 0x37, 0x37, 0x37, 0x37, 0x34, 0x34, 0x34, 0x34, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29,
-    0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x18, 0x18, 0x18, 0x18,
-    0x19, 0x19, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x14, 0x14, 0x13, 0x14,
-    0x14, 0x14, 0x14, 0x14, 0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0a, 0x0a, 0x0d, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a,
-    0x47, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x5e, 0x5e, 0x5e, 0x54, 0x54, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa7, 0xa7, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x78, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x54, 0x54, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x37, 0x37, 0x34, 0x34, 0x37, 0x37,
-    0x37, 0x37, 0x34, 0x34, 0x34, 0x34, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x27, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x18, 0x18, 0x18, 0x18, 0x19, 0x19, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x14, 0x13, 0x13, 0x14, 0x14, 0x14, 0x14,
-    0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0b, 0x0a, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0d, 0x0d,
-    0x0a, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x46, 0x46, 0x46, 0x46,
-    0x46, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x75, 0x75, 0x7b,
-    0x7b, 0x7b, 0x7c, 0x8a, 0x8a, 0x8a, 0x8a, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
-    0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xaf, 0xaf, 0xaf, 0xaa, 0xaf, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61,
-    0x61, 0x61, 0x61, 0x61, 0x5a, 0x61, 0x61, 0x5a, 0x5a, 0x53, 0x53, 0x53,
-    0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x38, 0x38, 0x38, 0x38,
-    0x37, 0x37, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
-    0x34, 0x34, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x23, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x18, 0x18, 0x19, 0x19, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x14, 0x13, 0x13, 0x14, 0x14, 0x14, 0x14, 0x13, 0x13, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b,
-    0x0a, 0x0b, 0x0d, 0x0a, 0x0a, 0x0d, 0x0d, 0x0a, 0x0a, 0x0d, 0x0d, 0x0d,
-    0x0a, 0x0a, 0x0a, 0x0d, 0x46, 0x46, 0x46, 0x46, 0x50, 0x50, 0x50, 0x50,
-    0x50, 0x5e, 0x54, 0x54, 0x54, 0x54, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x7b, 0x75, 0x75, 0x7b, 0x7b, 0x7b, 0x7b, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
-    0xa4, 0xaf, 0xaf, 0xaf, 0xaa, 0xaa, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
-    0x5a, 0x5a, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x4b, 0x4b, 0x4b, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x38, 0x38, 0x38, 0x37, 0x37, 0x34, 0x34,
-    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29,
-    0x29, 0x29, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x18, 0x18, 0x19, 0x19,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x13, 0x13,
-    0x14, 0x14, 0x14, 0x14, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0d, 0x0d,
-    0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x46, 0x46, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5e, 0x5e, 0x54, 0x54,
-    0x54, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x75, 0x75,
-    0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
-    0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xaf, 0xaf, 0xaa, 0xaa,
-    0xaa, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x78, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x53, 0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45,
-    0x45, 0x38, 0x38, 0x38, 0x37, 0x37, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
-    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x31, 0x31, 0x31, 0x31,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x18, 0x18, 0x19, 0x19, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x13, 0x14, 0x14, 0x14, 0x14, 0x14,
-    0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x46, 0x46, 0x50, 0x50,
-    0x50, 0x50, 0x5e, 0x5e, 0x5e, 0x54, 0x54, 0x54, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x7b, 0x75, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
-    0xa4, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaa, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65,
-    0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x53,
-    0x54, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x38, 0x38, 0x38,
-    0x37, 0x37, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x37, 0x34, 0x34, 0x34,
-    0x34, 0x34, 0x34, 0x34, 0x31, 0x31, 0x31, 0x31, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x18, 0x18, 0x19, 0x19, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-    0x16, 0x16, 0x13, 0x14, 0x14, 0x14, 0x14, 0x14, 0x13, 0x13, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x09, 0x09, 0x09, 0x0b, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5e, 0x5e,
-    0x54, 0x54, 0x54, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x6b, 0x6b, 0x75,
-    0x75, 0x75, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
-    0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xaf, 0xaf, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbe, 0xbe, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x54, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x45, 0x45, 0x45, 0x45, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x34,
-    0x34, 0x34, 0x34, 0x34, 0x37, 0x37, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
-    0x31, 0x31, 0x31, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29,
-    0x29, 0x29, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1e, 0x19, 0x19, 0x19,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x16, 0x13, 0x14, 0x14,
-    0x14, 0x14, 0x14, 0x14, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x50, 0x50, 0x50, 0x50, 0x5e, 0x5e, 0x5e, 0x54, 0x54, 0x54, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x6b, 0x6b, 0x75, 0x75, 0x75, 0x7b, 0x7b, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x8a, 0x8a, 0x8a, 0x8a, 0x91, 0x8a, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
-    0xa4, 0xa4, 0xaf, 0xaf, 0xaf, 0xaf, 0xaa, 0xaa, 0xaa, 0xaa, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xbe,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x65, 0x65, 0x65, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x53, 0x54, 0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45,
-    0x45, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
-    0x37, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x31, 0x31, 0x31, 0x31,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x1e, 0x19, 0x19, 0x19, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x13, 0x13, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
-    0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x50, 0x50, 0x50, 0x5e,
-    0x5e, 0x5e, 0x54, 0x54, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x6b, 0x6b, 0x75, 0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x91, 0x91, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0xa4, 0xa4,
-    0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xaf, 0xb0, 0xb0, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65,
-    0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x53,
-    0x53, 0x53, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
-    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x29, 0x29, 0x29, 0x29, 0x29, 0x27, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x1e, 0x19, 0x19, 0x19, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x16, 0x13,
-    0x13, 0x14, 0x14, 0x14, 0x14, 0x14, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x09, 0x09, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x09, 0x09, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x0a, 0x0a,
-    0x07, 0x07, 0x07, 0x07, 0x50, 0x50, 0x5e, 0x5e, 0x5e, 0x54, 0x54, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x6b, 0x6b, 0x75, 0x75, 0x7b,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x8a, 0x8a, 0x8a, 0x8a, 0x91, 0x91,
-    0x92, 0x92, 0x92, 0x91, 0x91, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
-    0xa4, 0xa4, 0xaf, 0xaf, 0xb0, 0xb0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
-    0x34, 0x34, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29,
-    0x29, 0x29, 0x27, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1e, 0x19, 0x19, 0x19,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x13, 0x13, 0x13, 0x14, 0x14, 0x14,
-    0x14, 0x14, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
-    0x0b, 0x0b, 0x0b, 0x09, 0x09, 0x09, 0x09, 0x0b, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x0b, 0x0b, 0x0b, 0x09, 0x09, 0x0a, 0x07, 0x06, 0x06, 0x06, 0x06,
-    0x50, 0x5e, 0x54, 0x54, 0x54, 0x54, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x6b, 0x6b, 0x6b, 0x75, 0x75, 0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x91, 0x91, 0x92, 0x92, 0x92, 0x91,
-    0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xb0, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xaa, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x89, 0x89, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x75, 0x75, 0x75, 0x75,
-    0x6b, 0x6b, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4b, 0x4b, 0x45, 0x45,
-    0x45, 0x45, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x31, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x29, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x1e, 0x1e, 0x19, 0x19, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x13, 0x13, 0x14, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x09,
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x5e, 0x5e, 0x54, 0x54,
-    0x54, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x6b, 0x6b, 0x6b, 0x75,
-    0x75, 0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x91, 0x91, 0x91, 0x92, 0x92, 0x91, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
-    0xa3, 0xa3, 0xa3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xa7, 0xa7, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x89,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x65,
-    0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x4a, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x34, 0x34, 0x33,
-    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x29, 0x29, 0x29, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1e, 0x1e,
-    0x19, 0x19, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13,
-    0x13, 0x14, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x54, 0x54, 0x54, 0x54, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x6b, 0x6b, 0x6b, 0x6b, 0x75, 0x75, 0x75, 0x75, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x91, 0x91, 0x91,
-    0x92, 0x92, 0x92, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb6, 0xb6, 0xb6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x61, 0x61, 0x61,
-    0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a,
-    0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
-    0x31, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29,
-    0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1e, 0x1e, 0x19, 0x19, 0x17, 0x17,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c,
-    0x0b, 0x0b, 0x0b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x54, 0x54, 0x54, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x75, 0x75, 0x75, 0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x91, 0x91, 0x91, 0x92, 0x91, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb6, 0xb6, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa7,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x91, 0x91, 0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x75, 0x75, 0x75,
-    0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x61, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4b, 0x4b, 0x45, 0x45,
-    0x45, 0x45, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x31, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x1e, 0x1e, 0x19, 0x19, 0x17, 0x17, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x09,
-    0x09, 0x09, 0x09, 0x09, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x54, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x6b, 0x6b, 0x6b, 0x6b, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x91, 0x91, 0x91, 0x91, 0x92, 0x92, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xb6, 0xb6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x65,
-    0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4b, 0x45, 0x45, 0x45, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x33, 0x34, 0x34,
-    0x34, 0x34, 0x34, 0x34, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29,
-    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1e, 0x1e,
-    0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x09, 0x09, 0x09, 0x0a, 0x07,
-    0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x05, 0x02, 0x02, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x75, 0x75, 0x75, 0x75, 0x75, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x91, 0x91, 0x91, 0x91,
-    0x92, 0x92, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x61, 0x61,
-    0x61, 0x61, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x4a, 0x4a, 0x4b, 0x45, 0x45, 0x45, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x33, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x29,
-    0x29, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1e, 0x1e, 0x17, 0x17, 0x17, 0x17,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c,
-    0x0b, 0x0b, 0x0b, 0x09, 0x09, 0x09, 0x0a, 0x07, 0x07, 0x07, 0x07, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x6b, 0x6b, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x8a,
-    0x88, 0x88, 0x8a, 0x8a, 0x91, 0x91, 0x91, 0x91, 0x92, 0x92, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb6, 0xb6, 0xb6, 0xb6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x89, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x75, 0x75,
-    0x75, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4b, 0x45,
-    0x45, 0x45, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x33,
-    0x33, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x27, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x1e, 0x1e, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x09,
-    0x09, 0x09, 0x0a, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x07, 0x05, 0x02, 0x02, 0x02, 0x02, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x6b, 0x6b, 0x6b, 0x75, 0x75, 0x75, 0x75, 0x75, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x8a, 0x88, 0x8a, 0x8a, 0x91,
-    0x91, 0x91, 0x91, 0x90, 0x92, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xc0, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b,
-    0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x4a,
-    0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x45, 0x45, 0x45, 0x45, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x33, 0x33, 0x33, 0x33, 0x34, 0x34,
-    0x34, 0x34, 0x34, 0x34, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29,
-    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x27, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x20, 0x20, 0x20, 0x1e, 0x1e,
-    0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x09, 0x09, 0x09, 0x07, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x69, 0x65, 0x69, 0x65, 0x65, 0x65, 0x6b, 0x6b,
-    0x6b, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x7d, 0x88, 0x88, 0x8a, 0x89, 0x89, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xa3, 0xa3, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x90, 0x90, 0x90, 0x89, 0x8a, 0x8a, 0x88, 0x88, 0x8a, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x75, 0x71, 0x71, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x61,
-    0x69, 0x54, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a,
-    0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x33, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x29,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x20, 0x20, 0x20, 0x20, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1a, 0x1a, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
-    0x0b, 0x0b, 0x0b, 0x09, 0x09, 0x09, 0x07, 0x07, 0x09, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x88, 0x88,
-    0x8a, 0x8a, 0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0xa3, 0xa3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xc0, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb6, 0xb6, 0xb6, 0xb6, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x90, 0x90, 0x90, 0x89,
-    0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x75,
-    0x71, 0x71, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x61, 0x69, 0x54, 0x5a, 0x5a,
-    0x5a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4b, 0x4b, 0x45, 0x45,
-    0x45, 0x45, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x33, 0x33,
-    0x33, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x29, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x22, 0x22, 0x27, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20,
-    0x20, 0x20, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1a, 0x1a, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0b, 0x0b, 0x09, 0x09,
-    0x09, 0x09, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x03, 0x03,
-    0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x65, 0x65, 0x65, 0x65,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x75, 0x75, 0x75, 0x75, 0x75, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x88, 0x88, 0x8a, 0x8a, 0x89, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0xa3, 0xa3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xc0, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0x8a, 0x8a, 0x8a,
-    0x88, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x75, 0x71, 0x71, 0x6b, 0x6b,
-    0x65, 0x67, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x45, 0x45, 0x45, 0x45, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x34,
-    0x34, 0x34, 0x31, 0x31, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x29, 0x29, 0x29, 0x29, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1a, 0x1a, 0x1a, 0x1a, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0c, 0x0c, 0x0b, 0x0b, 0x09, 0x09, 0x09, 0x09, 0x07, 0x07,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x65, 0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7d, 0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa3, 0xa3, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xc0,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x91, 0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x88, 0x7d,
-    0x7d, 0x7d, 0x7c, 0x75, 0x71, 0x71, 0x6b, 0x6b, 0x67, 0x67, 0x67, 0x67,
-    0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x45, 0x45, 0x45, 0x45, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 0x34, 0x31, 0x31,
-    0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1a, 0x1a, 0x1a, 0x1a, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
-    0x0b, 0x0b, 0x09, 0x09, 0x09, 0x09, 0x07, 0x07, 0x06, 0x06, 0x06, 0x05,
-    0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
-    0x65, 0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x75, 0x75, 0x75, 0x75, 0x75, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x88, 0x88, 0x8a, 0x8a,
-    0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0xa3, 0xa3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xc0, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb6, 0xb6, 0xb6, 0xb6, 0xaa, 0xaa, 0xaa, 0xaa,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0xa1, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x71, 0x71, 0x74, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x61, 0x61,
-    0x61, 0x5a, 0x4f, 0x5f, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x45, 0x45,
-    0x45, 0x45, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x34, 0x34, 0x34, 0x34, 0x31, 0x31, 0x31, 0x31, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x21,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x1a, 0x1a, 0x1a,
-    0x19, 0x19, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0b, 0x0b, 0x09, 0x09,
-    0x09, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x65, 0x65, 0x6b, 0x6b,
-    0x6b, 0x75, 0x75, 0x75, 0x75, 0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x8a, 0x88, 0x88, 0x8a, 0x8a, 0x89, 0x89, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa,
-    0xa3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xc0, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb6, 0xb6, 0xb6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x9f,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x9f, 0x9f, 0xa1, 0xa1,
-    0xa1, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x8a, 0x8a,
-    0x8a, 0x88, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x71, 0x71, 0x74, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x65, 0x61, 0x61, 0x5a, 0x4f, 0x53,
-    0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x45, 0x45, 0x45, 0x45, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x34,
-    0x34, 0x34, 0x31, 0x31, 0x31, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x29, 0x29, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x21, 0x21, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x1a, 0x1a, 0x1a, 0x19, 0x19, 0x16, 0x16,
-    0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0c, 0x0c, 0x0b, 0x0b, 0x09, 0x09, 0x09, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x05, 0x05, 0x06, 0x65, 0x6b, 0x6b, 0x6b, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x88, 0x88,
-    0x88, 0x8a, 0x8a, 0x8a, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb6, 0xb6,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb6, 0xb6, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x89, 0x8a, 0x88, 0x88, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x75, 0x75, 0x74, 0x74, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x64, 0x64, 0x65, 0x61, 0x61, 0x60, 0x5a, 0x53, 0x53, 0x53, 0x4a,
-    0x4a, 0x4a, 0x43, 0x43, 0x45, 0x45, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 0x34, 0x31, 0x31,
-    0x31, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x21, 0x21, 0x21, 0x21, 0x21, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1f, 0x1a, 0x1a, 0x1a, 0x19, 0x19, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0c, 0x0e, 0x0c,
-    0x0b, 0x0b, 0x09, 0x09, 0x09, 0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x09, 0x07, 0x09, 0x0a, 0x09,
-    0x65, 0x6b, 0x6b, 0x6b, 0x75, 0x75, 0x75, 0x75, 0x75, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x88, 0x88, 0x88, 0x88, 0x8a, 0x8a, 0x91,
-    0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb6, 0xb6, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x89, 0x89, 0x8a, 0x88, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x75, 0x75, 0x74, 0x75, 0x75, 0x7b, 0x7b, 0x7b, 0x6b, 0x6b, 0x6b, 0x65,
-    0x61, 0x61, 0x61, 0x5a, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x43, 0x43,
-    0x45, 0x45, 0x45, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x34, 0x34, 0x34, 0x34, 0x31, 0x31, 0x31, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x21, 0x21, 0x21,
-    0x21, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x1a, 0x1a, 0x1a,
-    0x19, 0x19, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0c, 0x0e, 0x0c, 0x0b, 0x0b, 0x09, 0x09,
-    0x09, 0x09, 0x09, 0x09, 0x0b, 0x0b, 0x0a, 0x0b, 0x0a, 0x0b, 0x0a, 0x09,
-    0x09, 0x09, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x6b, 0x6b, 0x6b, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x88, 0x88, 0x88, 0x8a, 0x8a, 0x89, 0x89, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xbb, 0xbb, 0xb4, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xa7, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89,
-    0x89, 0x89, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x74, 0x7d, 0x74, 0x75,
-    0x7b, 0xc4, 0xd3, 0xe6, 0xc4, 0x8f, 0x7b, 0x69, 0x69, 0x61, 0x65, 0x5a,
-    0x5a, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x45, 0x45, 0x45, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 0x34,
-    0x34, 0x34, 0x31, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x27, 0x27, 0x27, 0x27, 0x27, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x21, 0x21, 0x21, 0x1e, 0x21, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x1a, 0x1a, 0x1a, 0x19, 0x19, 0x16, 0x16,
-    0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f,
-    0x0f, 0x0c, 0x0e, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0c,
-    0x0e, 0x0c, 0x0e, 0x0c, 0x0e, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0c, 0x0c, 0x0c, 0x0f, 0x6b, 0x6b, 0x6b, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x88, 0x88, 0x88,
-    0x8a, 0x8a, 0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xbb, 0xb4, 0xb4, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa7, 0xa7, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x89, 0x88, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x74, 0x7c, 0xc4, 0xf2, 0xf2, 0xde,
-    0xe6, 0xe6, 0xd6, 0x99, 0x69, 0x69, 0x65, 0x65, 0x5a, 0x53, 0x53, 0x4a,
-    0x4a, 0x43, 0x43, 0x43, 0x45, 0x45, 0x45, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x33, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x31, 0x31,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29,
-    0x29, 0x29, 0x27, 0x27, 0x27, 0x27, 0x27, 0x22, 0x27, 0x22, 0x22, 0x22,
-    0x21, 0x21, 0x21, 0x21, 0x21, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1f, 0x1f, 0x1a, 0x1a, 0x19, 0x19, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c,
-    0x0b, 0x0b, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f,
-    0x6b, 0x6b, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0x89, 0x89,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x89, 0x89, 0x89, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x74, 0x74, 0x7d, 0x7b, 0xd6, 0xf2, 0xda, 0xc5, 0x94, 0xa6, 0xd3, 0xe6,
-    0xcd, 0x76, 0x69, 0x65, 0x54, 0x5a, 0x53, 0x4a, 0x4a, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x33, 0x33, 0x33, 0x33,
-    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x1e,
-    0x21, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f, 0x1a, 0x1a,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x12, 0x12, 0x12, 0x12, 0x0e, 0x0e, 0x0c, 0x0b, 0x0b, 0x0c, 0x0c, 0x0e,
-    0x0e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x14, 0x14, 0x6b, 0x6b, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x88, 0x88, 0x88, 0x8a, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89,
-    0x89, 0x89, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x74, 0x75, 0x7b,
-    0xcd, 0xec, 0xda, 0xc5, 0x83, 0xb9, 0xd3, 0xd3, 0xde, 0xde, 0x99, 0x54,
-    0x54, 0x53, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 0x34,
-    0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x29, 0x2b, 0x29, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x21, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f, 0x1a, 0x1a, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0x12, 0x12, 0x12,
-    0x0e, 0x0e, 0x0c, 0x0b, 0x0b, 0x0c, 0x0c, 0x0e, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
-    0x0f, 0x14, 0x14, 0x14, 0x6b, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x88, 0x88, 0x88, 0x88,
-    0x89, 0x89, 0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x8a, 0x8a, 0x88, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x74, 0x7d, 0x7c, 0x7b, 0xcd, 0xed, 0xc5, 0x77,
-    0x77, 0xa6, 0xcd, 0xcd, 0xc5, 0xe5, 0xd3, 0x70, 0x69, 0x54, 0x54, 0x4b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x33, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 0x34, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29,
-    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x2e, 0x2e, 0x28, 0x22, 0x22,
-    0x22, 0x22, 0x21, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x1a, 0x1a, 0x1a, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x12, 0x12, 0x12, 0x12, 0x0e, 0x0e, 0x0c, 0x0b,
-    0x0c, 0x0c, 0x0e, 0x0e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x6b, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x7c, 0x7c, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xb6, 0xb6, 0xb6, 0xb6, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x91, 0x91, 0x8a, 0x8a, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7c, 0x7b, 0x94, 0xef, 0xe5, 0xcb, 0x9c, 0x9c, 0x9c, 0x9c,
-    0xcb, 0xda, 0xda, 0xb9, 0x5e, 0x54, 0x54, 0x54, 0x4b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x33, 0x33, 0x33, 0x33,
-    0x34, 0x34, 0x34, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29,
-    0x29, 0x2e, 0x3a, 0x3a, 0x3a, 0x35, 0x2e, 0x22, 0x22, 0x22, 0x21, 0x21,
-    0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1a, 0x1a, 0x1a, 0x1a,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x12, 0x12, 0x12, 0x12, 0x0e, 0x0e, 0x0b, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x6b, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x88, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xb6, 0xb6, 0xb6, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0xa1, 0xa1, 0xa1, 0xa1, 0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91,
-    0x8a, 0x8a, 0x88, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7b,
-    0x94, 0xef, 0xed, 0xea, 0xda, 0x9c, 0x9c, 0x9c, 0xd9, 0xd9, 0xea, 0xe5,
-    0x99, 0x69, 0x54, 0x4b, 0x4b, 0x45, 0x43, 0x43, 0x43, 0x43, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x33, 0x34, 0x34, 0x34, 0x2c,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x2e, 0x35, 0x47, 0x56, 0x70,
-    0x56, 0x47, 0x35, 0x27, 0x27, 0x22, 0x1e, 0x21, 0x1e, 0x1e, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1a, 0x1a, 0x1a, 0x1a, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0x12, 0x12, 0x0e,
-    0x0e, 0x0c, 0x0b, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0c, 0x0c, 0x0e, 0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x6b, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xb6, 0xb6, 0xb6,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0xa1, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8a, 0x88, 0x88,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x74, 0x7d, 0x7b, 0xb9, 0xf4, 0xe4, 0xd9,
-    0xda, 0xd3, 0xc5, 0xc5, 0xd9, 0xd9, 0xcb, 0xf0, 0xed, 0xcd, 0x76, 0x54,
-    0x4b, 0x4b, 0x45, 0x43, 0x45, 0x45, 0x38, 0x38, 0x38, 0x38, 0x38, 0x46,
-    0x46, 0x46, 0x37, 0x34, 0x33, 0x34, 0x34, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2e, 0x2e, 0x2e, 0x3a, 0x56, 0x83, 0x94, 0x94, 0x70, 0x56, 0x3a, 0x47,
-    0x56, 0x35, 0x22, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x1a, 0x1a, 0x1a, 0x1a, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x12, 0x12, 0x12, 0x0e, 0x0e, 0x0b, 0x0b, 0x0b,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0c,
-    0x0c, 0x0e, 0x0c, 0x0f, 0x0f, 0x0f, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x6b, 0x6b, 0x75, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
-    0xb6, 0xb6, 0xb6, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa,
-    0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x91, 0x91, 0x91, 0x91, 0x8a, 0x8a, 0x88, 0x88, 0x7d, 0x7d, 0x78, 0x78,
-    0x78, 0x72, 0x78, 0x8a, 0x99, 0xde, 0xed, 0xea, 0xcb, 0x9c, 0x9c, 0x9c,
-    0x9c, 0xcb, 0xd9, 0xe9, 0xea, 0xda, 0x99, 0x54, 0x54, 0x54, 0x45, 0x4b,
-    0x45, 0x4b, 0x38, 0x38, 0x3b, 0x42, 0x46, 0x46, 0x70, 0xcf, 0xb9, 0x46,
-    0x33, 0x33, 0x33, 0x34, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2e, 0x2b, 0x2e, 0x2e, 0x29, 0x2e, 0x2e, 0x2e, 0x35, 0x56,
-    0x83, 0xb9, 0xb9, 0xb9, 0xa2, 0x77, 0xb9, 0xe3, 0xd4, 0x83, 0x22, 0x20,
-    0x1e, 0x1f, 0x1f, 0x1f, 0x1e, 0x1e, 0x1e, 0x1a, 0x1a, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x12, 0x12,
-    0x12, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x0d, 0x0d, 0x0c, 0x0c,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0c, 0x0e, 0x0c, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x6b, 0x6b, 0x75, 0x75,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91,
-    0x8a, 0x8a, 0x88, 0x88, 0x88, 0x7d, 0x78, 0x78, 0x72, 0x89, 0x78, 0x7d,
-    0x8f, 0xde, 0xda, 0xdb, 0xd9, 0xd9, 0xc5, 0x9c, 0xc5, 0xd9, 0xe9, 0xe9,
-    0xe9, 0xea, 0xd3, 0x76, 0x5e, 0x5e, 0x5e, 0x5e, 0x76, 0x37, 0x45, 0x45,
-    0x46, 0x46, 0x47, 0x70, 0xee, 0xf4, 0xd4, 0x55, 0x3e, 0x33, 0x33, 0x2c,
-    0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e,
-    0x2e, 0x2e, 0x2b, 0x2e, 0x2e, 0x35, 0x58, 0xa2, 0xcf, 0xcf, 0xcf, 0xcf,
-    0xcc, 0xe5, 0xf2, 0xcf, 0x94, 0x47, 0x28, 0x20, 0x1e, 0x1f, 0x1f, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1f, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x12, 0x12, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x0d, 0x0a, 0x0a, 0x0a, 0x0d, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x13,
-    0x13, 0x13, 0x0f, 0x0f, 0x6b, 0x6b, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x78, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x88,
-    0x88, 0x7d, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x7c, 0x99, 0xe5, 0xea,
-    0xdd, 0xcb, 0xe9, 0xd9, 0xcb, 0xd9, 0xd9, 0xd9, 0xdd, 0xe9, 0xef, 0xde,
-    0x83, 0x94, 0xd3, 0xec, 0xe6, 0x99, 0x5f, 0x50, 0x55, 0x56, 0x82, 0xee,
-    0xfa, 0xe4, 0xc5, 0xa6, 0x46, 0x34, 0x33, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x29, 0x2b, 0x2b, 0x2b,
-    0x31, 0x56, 0xa2, 0xc5, 0xda, 0xde, 0xde, 0xe3, 0xec, 0xec, 0xb9, 0x70,
-    0x3c, 0x28, 0x20, 0x21, 0x1e, 0x1f, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13,
-    0x13, 0x13, 0x12, 0x12, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x13, 0x13, 0x13, 0x13, 0x0f,
-    0x6b, 0x6b, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x78, 0x78, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9e, 0x9e, 0xa7,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0xa1, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x91, 0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x88, 0x7d, 0x78, 0x78,
-    0x7c, 0x71, 0x78, 0x78, 0x7c, 0x8f, 0xe3, 0xf5, 0xe9, 0xdd, 0xcb, 0xd9,
-    0xcb, 0xcb, 0xd9, 0xd9, 0xcb, 0xe9, 0xf8, 0xef, 0xed, 0xf4, 0xef, 0xe5,
-    0xe3, 0x70, 0x46, 0x50, 0x56, 0x82, 0xf5, 0xf9, 0xea, 0xef, 0xef, 0xd4,
-    0x70, 0x34, 0x34, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x29, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x31, 0x55, 0x94, 0xc5, 0xed,
-    0xee, 0xe5, 0xe3, 0xf2, 0xc4, 0x76, 0x5e, 0x3c, 0x28, 0x22, 0x1e, 0x1e,
-    0x1f, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x12, 0x12,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0f, 0x0f, 0x0f, 0x13, 0x13, 0x13, 0x13, 0x13, 0x6b, 0x6b, 0x75, 0x75,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x78, 0x78, 0x78, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xa7, 0xa7, 0xa7, 0xa7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0xa1,
-    0xa1, 0xa1, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x8a,
-    0x8a, 0x8a, 0x88, 0x88, 0x88, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x75,
-    0x7c, 0x76, 0xd4, 0xef, 0xef, 0xcb, 0xcb, 0xd9, 0xcb, 0xd9, 0xd9, 0xcb,
-    0xcb, 0xe9, 0xf1, 0xea, 0xef, 0xe5, 0xc8, 0xe4, 0xda, 0x83, 0x50, 0x55,
-    0xa2, 0xf3, 0xf9, 0xeb, 0xeb, 0xea, 0xee, 0xc5, 0x47, 0x34, 0x34, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x34, 0x31, 0x31, 0x31, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2e, 0x2e, 0x2e, 0x3a, 0x94, 0xd4, 0xed, 0xef, 0xee, 0xe5, 0xec, 0xc4,
-    0x6d, 0x6d, 0x50, 0x28, 0x20, 0x1e, 0x24, 0x1f, 0x1f, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1f, 0x1f, 0x1a, 0x1a, 0x1a, 0x1a, 0x19, 0x19, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x12, 0x12, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x0c, 0x0c, 0x0c,
-    0x0b, 0x0b, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x6b, 0x6b, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x78, 0x78, 0x78,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xbe, 0xbe, 0xbe, 0xbe, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0x9f,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x88, 0x88,
-    0x88, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x75, 0x8a, 0x7f, 0x7f, 0xd3, 0xe3,
-    0xef, 0xed, 0xda, 0xc5, 0xcb, 0x9c, 0xcb, 0xd9, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xcb, 0xcb, 0xc6, 0xdb, 0xd7, 0x77, 0x70, 0xb9, 0xf4, 0xfa, 0xf0, 0xdd,
-    0xeb, 0xf1, 0xe4, 0xa2, 0x31, 0x3c, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2c, 0x2c, 0x2b, 0x2b, 0x35, 0x35, 0x31, 0x31, 0x35, 0x35, 0x40, 0x77,
-    0xda, 0xed, 0xf4, 0xf4, 0xed, 0xe3, 0xc4, 0x6e, 0x5a, 0x5a, 0x2c, 0x28,
-    0x21, 0x1f, 0x24, 0x1f, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f,
-    0x1a, 0x1f, 0x1a, 0x1a, 0x19, 0x19, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13,
-    0x13, 0x13, 0x12, 0x12, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x6b, 0x6b, 0x6b, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x7d, 0x7d, 0x7d, 0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xbe, 0xbe, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0x90, 0x90, 0x90, 0x91, 0x91,
-    0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x8a, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x8a, 0x7c, 0x7c, 0x7c, 0x7f, 0x99, 0xd3, 0xed, 0xda, 0xda, 0x9c,
-    0xcb, 0xcb, 0xd9, 0xd9, 0xe9, 0xd9, 0xd9, 0xd9, 0xcb, 0xc8, 0xeb, 0xeb,
-    0xdb, 0x82, 0xcc, 0xf4, 0xf3, 0xe7, 0xdf, 0xdb, 0xf1, 0xf1, 0xdf, 0x77,
-    0x3c, 0x3c, 0x34, 0x34, 0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2c, 0x2b, 0x2b,
-    0x29, 0x29, 0x2b, 0x2b, 0x2e, 0x40, 0x82, 0xcc, 0xe4, 0xfa, 0xfa, 0xec,
-    0xd4, 0xc2, 0x7c, 0x49, 0x5a, 0x30, 0x25, 0x20, 0x1e, 0x1f, 0x16, 0x1f,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1a, 0x1f, 0x1a, 0x1a,
-    0x19, 0x19, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x0f, 0x12,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x13, 0x13, 0x13, 0x0f, 0x6b, 0x6b, 0x6b, 0x75,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x7d, 0x7d, 0x7d,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-    0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xbe, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x8a, 0x8a,
-    0x8a, 0x88, 0x8a, 0x8a, 0x8a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x8a, 0x8f,
-    0x8f, 0x99, 0xcd, 0xb9, 0xf2, 0xda, 0xda, 0xda, 0xcb, 0xcb, 0xcb, 0xe9,
-    0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xdb, 0xeb, 0xeb, 0xf0, 0xee, 0xfa, 0xfa,
-    0xee, 0xe5, 0xdc, 0xd7, 0xf0, 0xea, 0xc5, 0x70, 0x3c, 0x34, 0x34, 0x34,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2c, 0x2b, 0x2b, 0x2b, 0x2e, 0x2b, 0x2b, 0x35,
-    0x40, 0xa2, 0xdb, 0xf0, 0xf5, 0xf4, 0xed, 0xde, 0xc2, 0x74, 0x67, 0x49,
-    0x30, 0x25, 0x20, 0x22, 0x1f, 0x1f, 0x16, 0x1f, 0x1e, 0x1e, 0x1e, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1a, 0x1f, 0x1a, 0x1a, 0x1a, 0x19, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x0f, 0x0e, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f,
-    0x13, 0x13, 0x13, 0x0f, 0x6b, 0x6b, 0x6b, 0x6b, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xab, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xab, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0x90, 0x90,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8a, 0x8a, 0x88, 0x88, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x7c, 0x7c, 0x7d, 0x8a, 0xd5, 0xec, 0xf2, 0xf2, 0xf4, 0xf4,
-    0xed, 0xb9, 0xc5, 0xda, 0xda, 0xc5, 0xcb, 0xcb, 0xd9, 0xd9, 0xd9, 0xd9,
-    0xf8, 0xf7, 0xf7, 0xf7, 0xf8, 0xef, 0xf4, 0xf4, 0xe5, 0xd4, 0xda, 0xea,
-    0xf5, 0xea, 0xa2, 0x3c, 0x37, 0x37, 0x34, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2e, 0x2e, 0x40, 0x82, 0xdf, 0xf7, 0xf9,
-    0xf9, 0xf3, 0xe3, 0xc2, 0x7d, 0x6a, 0x5b, 0x41, 0x25, 0x25, 0x20, 0x1e,
-    0x1f, 0x1f, 0x1f, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x16, 0x16, 0x1f, 0x1a,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13,
-    0x13, 0x0f, 0x0f, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x0b,
-    0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x14, 0x14, 0x14, 0x14,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xab, 0xab, 0xb7, 0xb7, 0xb7, 0xb7, 0xab, 0xab, 0xb7,
-    0xab, 0xab, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xab, 0xb7, 0xb7, 0xb7,
-    0xab, 0xab, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x8a, 0x7c, 0x8a, 0x8a,
-    0x88, 0x91, 0xd6, 0xec, 0xec, 0xed, 0xdc, 0xdc, 0xda, 0xc5, 0xc5, 0xc5,
-    0xda, 0xd9, 0xd9, 0xd9, 0xea, 0xea, 0xd9, 0xdb, 0xf1, 0xf1, 0xf9, 0xfc,
-    0xfa, 0xee, 0xe4, 0xe5, 0xde, 0xda, 0xdf, 0xf5, 0xf0, 0xd7, 0x83, 0x3c,
-    0x37, 0x33, 0x33, 0x34, 0x34, 0x31, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x35, 0x40, 0x82, 0xe4, 0xf5, 0xf9, 0xf9, 0xf4, 0xec, 0xc2, 0x92,
-    0x85, 0x85, 0x5d, 0x30, 0x25, 0x22, 0x1e, 0x1e, 0x1f, 0x1f, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1f, 0x16, 0x16, 0x16, 0x1a, 0x1a, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0f, 0x0f, 0x14, 0x14, 0x14, 0x14, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x67, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9e, 0x9e, 0x9e, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xab, 0xab, 0xab, 0xab, 0xb7, 0xb7, 0xb7, 0xab,
-    0xab, 0xb7, 0xb7, 0xb7, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x88, 0x8a, 0x8a, 0x8a, 0xa4, 0xc2, 0xc2, 0x8f, 0x7f, 0x99, 0x99,
-    0xcf, 0xe3, 0xed, 0xf3, 0xfa, 0xfa, 0xeb, 0xdd, 0xdd, 0xdb, 0xdb, 0xdd,
-    0xdb, 0xea, 0xe9, 0xfc, 0xfc, 0xf9, 0xf9, 0xf8, 0xf3, 0xe5, 0xdc, 0xda,
-    0xda, 0xda, 0xe9, 0xf1, 0xf5, 0xda, 0x70, 0x46, 0x37, 0x33, 0x33, 0x34,
-    0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x31, 0x35, 0x58, 0xd7,
-    0xf5, 0xf9, 0xfc, 0xfa, 0xf2, 0xd6, 0xa3, 0x80, 0x6f, 0x5b, 0x44, 0x25,
-    0x22, 0x21, 0x1f, 0x1f, 0x1f, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1a, 0x16,
-    0x16, 0x16, 0x1a, 0x1a, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d,
-    0x0d, 0x0a, 0x0a, 0x0a, 0x07, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0c, 0x0c, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x6b, 0x6b, 0x6b, 0x6b, 0x67, 0x67, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x72, 0x72, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xb7,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xab, 0xb7, 0xb7, 0xb7, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f,
-    0x9f, 0x9f, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0x90, 0x90, 0x90, 0x90,
-    0x91, 0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x88, 0x8a, 0x7c,
-    0x91, 0xd5, 0xe8, 0xe8, 0xd6, 0xc4, 0xc4, 0x99, 0x7f, 0xb9, 0xd4, 0xef,
-    0xef, 0xf0, 0xf5, 0xf9, 0xf9, 0xf9, 0xeb, 0xe9, 0xf8, 0xf1, 0xeb, 0xfc,
-    0xfc, 0xf9, 0xf5, 0xf4, 0xed, 0xe5, 0xda, 0xda, 0xda, 0xda, 0xe9, 0xf1,
-    0xea, 0xc5, 0x70, 0x37, 0x38, 0x33, 0x33, 0x34, 0x31, 0x31, 0x2b, 0x2b,
-    0x31, 0x2b, 0x2b, 0x31, 0x31, 0x47, 0xa2, 0xf0, 0xf9, 0xf8, 0xfa, 0xf2,
-    0xe6, 0xaf, 0x80, 0x7a, 0x6f, 0x41, 0x33, 0x23, 0x21, 0x1f, 0x1f, 0x1f,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1a, 0x16, 0x16, 0x16, 0x1a, 0x1a,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x07,
-    0x07, 0x07, 0x07, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0c,
-    0x65, 0x6b, 0x6b, 0x6b, 0x67, 0x67, 0x67, 0x67, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x9f, 0x9f,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xb7, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0x90, 0x90, 0x90, 0x90, 0x91, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x88, 0x88, 0x7d, 0x88, 0x8a, 0x7c, 0x91, 0xd5, 0xe8, 0xe8,
-    0xe6, 0xd6, 0xde, 0xcf, 0xb9, 0xa6, 0xcf, 0xe4, 0xee, 0xe7, 0xe7, 0xf0,
-    0xf5, 0xf9, 0xf9, 0xfc, 0xf0, 0xf1, 0xf7, 0xfd, 0xfc, 0xf9, 0xef, 0xf3,
-    0xed, 0xde, 0xda, 0xda, 0xda, 0xd9, 0xf1, 0xf1, 0xdf, 0x94, 0x55, 0x34,
-    0x3b, 0x33, 0x33, 0x34, 0x31, 0x31, 0x31, 0x31, 0x34, 0x34, 0x31, 0x31,
-    0x47, 0x83, 0xcc, 0xf0, 0xf8, 0xfa, 0xf2, 0xd6, 0xc9, 0x96, 0x68, 0x7a,
-    0x5b, 0x30, 0x28, 0x21, 0x24, 0x1f, 0x1f, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1a, 0x1a, 0x1a, 0x1a, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x07, 0x05, 0x07, 0x07, 0x07,
-    0x07, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0c, 0x0f, 0x0f, 0x0f, 0x0c, 0x65, 0x65, 0x6b, 0x6b,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x88,
-    0x88, 0x7d, 0x7c, 0x7c, 0x8a, 0xaf, 0xc2, 0xd5, 0xc4, 0xd6, 0xd6, 0xd6,
-    0xd6, 0xd4, 0xec, 0xfa, 0xf4, 0xf3, 0xee, 0xe7, 0xee, 0xf3, 0xf5, 0xfc,
-    0xf9, 0xf9, 0xfc, 0xfd, 0xf9, 0xef, 0xe4, 0xef, 0xed, 0xdc, 0xda, 0xda,
-    0xda, 0xea, 0xf1, 0xe9, 0xc5, 0x55, 0x46, 0x3b, 0x3b, 0x33, 0x37, 0x34,
-    0x31, 0x31, 0x31, 0x31, 0x34, 0x34, 0x46, 0x55, 0x83, 0xb9, 0xdc, 0xf3,
-    0xf4, 0xf3, 0xe3, 0xc9, 0x93, 0x7a, 0x68, 0x5b, 0x41, 0x25, 0x22, 0x1e,
-    0x24, 0x1f, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x19, 0x19,
-    0x19, 0x1a, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13,
-    0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x0d, 0x0d, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x07, 0x05, 0x05, 0x05, 0x05, 0x07, 0x07, 0x07, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0c,
-    0x0c, 0x0f, 0x0c, 0x0c, 0x65, 0x65, 0x65, 0x6b, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x74, 0x74, 0x74, 0x74, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x9f, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xb4, 0xb4,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xaa, 0xaa, 0xaa, 0xaa,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9e, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9f, 0x9f,
-    0x9f, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0x90, 0x90, 0x90, 0x90, 0x89,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7d, 0x7c, 0x7c,
-    0x7c, 0x8a, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0xc2, 0xd6, 0xde, 0xec, 0xec,
-    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf4, 0xfc, 0xf9, 0xfd, 0xfd,
-    0xf4, 0xe4, 0xe3, 0xf2, 0xee, 0xe4, 0xda, 0xda, 0xdf, 0xf0, 0xf0, 0xea,
-    0xa2, 0x55, 0x46, 0x42, 0x3b, 0x3b, 0x3e, 0x34, 0x3c, 0x31, 0x31, 0x3c,
-    0x47, 0x55, 0x83, 0xa6, 0xcd, 0xd4, 0xe5, 0xf4, 0xef, 0xe3, 0xc2, 0x92,
-    0x7a, 0x81, 0x68, 0x41, 0x33, 0x23, 0x22, 0x21, 0x21, 0x1e, 0x20, 0x20,
-    0x1e, 0x1e, 0x1f, 0x16, 0x16, 0x1f, 0x19, 0x19, 0x19, 0x19, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0x0f,
-    0x0f, 0x0f, 0x0e, 0x0e, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x07, 0x07,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x07, 0x07, 0x07, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x09, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b,
-    0x65, 0x65, 0x65, 0x65, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x74, 0x74, 0x74, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x9e, 0x9e, 0x9e, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0x90, 0x90, 0x90, 0x90, 0x89, 0x8a, 0x8a, 0x88, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x87,
-    0x6e, 0x87, 0x87, 0x98, 0xb2, 0xc4, 0xde, 0xe0, 0xe0, 0xee, 0xf3, 0xf3,
-    0xf4, 0xf3, 0xee, 0xef, 0xfa, 0xfa, 0xf9, 0xf4, 0xee, 0xde, 0xde, 0xe3,
-    0xe4, 0xda, 0xda, 0xda, 0xe4, 0xf0, 0xea, 0xdf, 0xcf, 0x94, 0x46, 0x46,
-    0x3b, 0x3b, 0x34, 0x34, 0x3c, 0x3c, 0x3c, 0x55, 0x83, 0xb9, 0xcd, 0xd3,
-    0xd3, 0xe3, 0xe3, 0xec, 0xde, 0xc2, 0x92, 0x85, 0x81, 0x68, 0x4d, 0x36,
-    0x25, 0x22, 0x21, 0x21, 0x1e, 0x1e, 0x20, 0x20, 0x1e, 0x1e, 0x1f, 0x16,
-    0x16, 0x1f, 0x19, 0x19, 0x19, 0x19, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0x12, 0x12, 0x0f, 0x0e, 0x0e,
-    0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x07, 0x07, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x09, 0x09,
-    0x09, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x61, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x74, 0x74,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9,
-    0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xb4, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0x90, 0x90,
-    0x91, 0x91, 0x91, 0x8a, 0x89, 0x89, 0x88, 0x8a, 0x7b, 0x7b, 0x7c, 0x7c,
-    0x7c, 0x88, 0x78, 0x72, 0x7d, 0x7c, 0x7c, 0x7c, 0x8a, 0x7c, 0x87, 0x7f,
-    0x8f, 0x99, 0xc4, 0xcf, 0xcf, 0xd4, 0xde, 0xe3, 0xec, 0xe3, 0xd4, 0xe3,
-    0xee, 0xef, 0xf4, 0xec, 0xd4, 0xd4, 0xde, 0xd3, 0xcf, 0xc5, 0xda, 0xda,
-    0xe4, 0xd7, 0xf5, 0xfa, 0xe3, 0x99, 0x50, 0x46, 0x3b, 0x3b, 0x3e, 0x3e,
-    0x3c, 0x3e, 0x55, 0xa6, 0xcf, 0xde, 0xe3, 0xe3, 0xe3, 0xe6, 0xe1, 0xd0,
-    0xbc, 0x97, 0x7a, 0x68, 0x7a, 0x5b, 0x39, 0x2c, 0x23, 0x21, 0x21, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1a,
-    0x1a, 0x19, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x09, 0x09,
-    0x0a, 0x0a, 0x07, 0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x07,
-    0x07, 0x07, 0x0a, 0x0a, 0x0a, 0x07, 0x0a, 0x0a, 0x09, 0x09, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x61, 0x61, 0x65, 0x65, 0x65, 0x65, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x74, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x90, 0x90, 0x90, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0xa7, 0x9e, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9,
-    0xa9, 0xa9, 0xa9, 0xa9, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0x9e, 0x9e, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x8a,
-    0x89, 0x89, 0x8a, 0x8a, 0x7b, 0x7b, 0x7b, 0x7c, 0x7d, 0x7d, 0x78, 0x88,
-    0x7c, 0x8a, 0x8f, 0x8f, 0x8f, 0x8f, 0x99, 0x99, 0xb9, 0xcf, 0xcf, 0xcf,
-    0xcf, 0xb9, 0xcf, 0xd4, 0xd4, 0xcd, 0xd3, 0xde, 0xde, 0xec, 0xec, 0xde,
-    0xcf, 0xcf, 0xd3, 0xd3, 0xb9, 0xc5, 0xda, 0xda, 0xe4, 0xf4, 0xef, 0xcc,
-    0xa6, 0x5e, 0x3e, 0x46, 0x46, 0x46, 0x3e, 0x46, 0x47, 0x70, 0xa6, 0xd4,
-    0xde, 0xe3, 0xe6, 0xe6, 0xe6, 0xd5, 0xd0, 0xbe, 0x93, 0x81, 0x68, 0x68,
-    0x6f, 0x49, 0x30, 0x25, 0x22, 0x21, 0x21, 0x21, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x09, 0x09, 0x0a, 0x0a, 0x07, 0x07,
-    0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x09, 0x09, 0x09, 0x09, 0x0b, 0x06, 0x06, 0x03,
-    0x61, 0x61, 0x61, 0x61, 0x61, 0x65, 0x65, 0x65, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa9, 0xa9, 0xa9, 0xa9,
-    0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa,
-    0xaa, 0xaa, 0x9f, 0x9f, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x8a, 0x7b, 0x8f, 0x99, 0x94, 0xa6,
-    0xe5, 0xef, 0xf3, 0xf4, 0xef, 0xf4, 0xed, 0xec, 0xd4, 0xb9, 0xb9, 0xc4,
-    0xc4, 0xc4, 0xd6, 0xd3, 0xd4, 0xde, 0xde, 0xcf, 0xcf, 0xcf, 0xd3, 0xb9,
-    0x94, 0xa2, 0xda, 0xed, 0xef, 0xef, 0xdc, 0xa6, 0x55, 0x46, 0x46, 0x46,
-    0x46, 0x46, 0x50, 0x70, 0x83, 0xb9, 0xd4, 0xe3, 0xe6, 0xe6, 0xd5, 0xd5,
-    0xd0, 0xc9, 0xbc, 0x93, 0x81, 0x81, 0x68, 0x68, 0x5b, 0x39, 0x2c, 0x25,
-    0x22, 0x21, 0x21, 0x21, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1f, 0x1a, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0x12, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0e, 0x0e, 0x09, 0x09, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x07, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x06, 0x06, 0x03, 0x03, 0x03, 0x02, 0x5a, 0x61, 0x61, 0x61,
-    0x61, 0x61, 0x65, 0x65, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9,
-    0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xb4, 0xb4, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0xaa, 0x9f, 0x9f,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x7d, 0x7d, 0x78,
-    0x89, 0x7d, 0x7c, 0x7b, 0x99, 0xd4, 0xef, 0xfa, 0xf0, 0xea, 0xeb, 0xdb,
-    0xdb, 0xdf, 0xdf, 0xe5, 0xe3, 0xcf, 0xcf, 0xb9, 0xb9, 0xc4, 0xcd, 0xd3,
-    0xd3, 0xd4, 0xcf, 0xb9, 0xb9, 0xcf, 0xcd, 0xa6, 0xa6, 0x94, 0xda, 0xed,
-    0xef, 0xd4, 0xa6, 0x55, 0x47, 0x46, 0x46, 0x46, 0x50, 0x76, 0x94, 0xb9,
-    0xd4, 0xde, 0xe3, 0xe6, 0xd5, 0xd0, 0xc0, 0xb0, 0x97, 0x93, 0x93, 0x95,
-    0x81, 0x81, 0x68, 0x5b, 0x41, 0x30, 0x25, 0x23, 0x22, 0x22, 0x21, 0x21,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x1a, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x12, 0x12, 0x0f, 0x0f, 0x0f, 0x0c, 0x0e, 0x0e, 0x09, 0x09,
-    0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x05, 0x03, 0x02,
-    0x02, 0x02, 0x02, 0x01, 0x5a, 0x61, 0x61, 0x61, 0x61, 0x61, 0x65, 0x65,
-    0x65, 0x65, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0xa7,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0xa7, 0x9e,
-    0x9f, 0x9f, 0x9f, 0x9f, 0xaa, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0xaa, 0xaa, 0x9f, 0x9f, 0x9f, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0x8a, 0x8a, 0x88,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x7d, 0x89, 0x78, 0x89, 0x7d, 0x8f, 0x99,
-    0xf2, 0xf2, 0xf4, 0xf3, 0xf0, 0xe9, 0xdb, 0xdb, 0xdb, 0xd7, 0xd7, 0xda,
-    0xda, 0xde, 0xd4, 0xcd, 0xb9, 0xb9, 0xb9, 0xcd, 0xcd, 0xcd, 0xb9, 0xb9,
-    0xcf, 0xcf, 0xb9, 0x83, 0x83, 0x83, 0xd4, 0xf2, 0xcf, 0xb9, 0x5e, 0x50,
-    0x50, 0x46, 0x46, 0x5e, 0x76, 0x99, 0xcd, 0xd3, 0xde, 0xe6, 0xe6, 0xd5,
-    0xd0, 0xb0, 0xae, 0x96, 0x95, 0x81, 0x95, 0x81, 0x81, 0x68, 0x6f, 0x4d,
-    0x36, 0x2c, 0x23, 0x23, 0x22, 0x22, 0x20, 0x21, 0x1e, 0x21, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x1a, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0x12,
-    0x0f, 0x0f, 0x0c, 0x0c, 0x0e, 0x0e, 0x09, 0x09, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x5a, 0x5a, 0x61, 0x61, 0x61, 0x61, 0x61, 0x65, 0x65, 0x65, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x84, 0x84, 0x84, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa1, 0xa1, 0xa1, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x89, 0x91, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x7d, 0x89, 0x78, 0x89, 0x7d, 0x8a, 0xc2, 0xe6, 0xde, 0xde, 0xdc,
-    0xc5, 0xf0, 0xf0, 0xf5, 0xf5, 0xef, 0xef, 0xe5, 0xda, 0xda, 0xde, 0xde,
-    0xd4, 0xd4, 0xb9, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xd4, 0xa6, 0x70,
-    0x83, 0xa6, 0xd4, 0xde, 0xb9, 0x76, 0x50, 0x50, 0x50, 0x5e, 0x76, 0x99,
-    0xc4, 0xc4, 0xd6, 0xe6, 0xe6, 0xe6, 0xd5, 0xc9, 0xae, 0x93, 0x93, 0x93,
-    0x8e, 0x8e, 0x8e, 0x81, 0x68, 0x68, 0x5b, 0x41, 0x33, 0x25, 0x23, 0x22,
-    0x22, 0x22, 0x22, 0x21, 0x21, 0x21, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f,
-    0x1f, 0x1a, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
-    0x0e, 0x0e, 0x09, 0x09, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x5a, 0x61, 0x61,
-    0x61, 0x61, 0x61, 0x61, 0x65, 0x65, 0x65, 0x65, 0x67, 0x67, 0x67, 0x67,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0xa7, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x8a, 0x8f, 0xc2, 0x99, 0x99, 0x99, 0x99, 0xb9, 0xcd, 0xb9,
-    0xde, 0xda, 0xf4, 0xf4, 0xf4, 0xef, 0xed, 0xed, 0xed, 0xe3, 0xd4, 0xcf,
-    0xcd, 0xcd, 0xcd, 0xb9, 0xb9, 0xd4, 0x94, 0x56, 0x56, 0xcf, 0xd4, 0xcf,
-    0xb9, 0x5e, 0x4b, 0x54, 0x76, 0x99, 0x99, 0xc4, 0xd5, 0xd6, 0xd6, 0xd5,
-    0xd5, 0xd0, 0xaf, 0x97, 0x93, 0x81, 0x8e, 0x8e, 0xa8, 0xa8, 0x8e, 0x81,
-    0x68, 0x5b, 0x49, 0x36, 0x2c, 0x28, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21,
-    0x21, 0x21, 0x21, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x1a, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0e, 0x0e, 0x09, 0x09,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x5a, 0x5a, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
-    0x61, 0x65, 0x65, 0x65, 0x67, 0x67, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x89,
-    0x84, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x7c, 0x7d, 0x7d, 0x88, 0x7d, 0x8a,
-    0x8a, 0x7c, 0x8a, 0x7c, 0x7b, 0x7b, 0x7b, 0x99, 0xc4, 0xb9, 0xd3, 0xe3,
-    0xd4, 0xd4, 0xd4, 0xcf, 0xd4, 0xe3, 0xec, 0xde, 0xd3, 0xd3, 0xcd, 0xb9,
-    0xb9, 0xd4, 0x94, 0x3a, 0x70, 0xb9, 0xcf, 0xcf, 0x7f, 0x50, 0x4b, 0x69,
-    0x8f, 0x99, 0xc4, 0xd5, 0xd5, 0xd5, 0xd0, 0xd0, 0xaf, 0xa3, 0x85, 0x80,
-    0x81, 0x7e, 0x8e, 0x8e, 0xa8, 0xa8, 0x8e, 0x68, 0x68, 0x4d, 0x39, 0x3b,
-    0x25, 0x27, 0x22, 0x22, 0x22, 0x22, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1e,
-    0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x1a, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0c, 0x0e, 0x0e, 0x09, 0x09, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x07, 0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x5a, 0x5a, 0x5a, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
-    0x61, 0x61, 0x61, 0x61, 0x67, 0x67, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x89, 0x91, 0x8a, 0x8a, 0x8a, 0x88, 0x89, 0x88, 0x8a,
-    0x8a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x89, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7c, 0x7f, 0x7f, 0x7f, 0x7f, 0x5f, 0x6d, 0xb2, 0x8f, 0x99, 0x99, 0xb9,
-    0xe3, 0xf2, 0xf4, 0xef, 0xde, 0xde, 0xd4, 0xcf, 0xcf, 0xda, 0x94, 0x3a,
-    0x83, 0xcf, 0xcf, 0xa6, 0x5e, 0x50, 0x50, 0x69, 0x99, 0xc4, 0xd5, 0xd5,
-    0xd0, 0xc9, 0xb0, 0x97, 0x85, 0x84, 0x68, 0x7a, 0x81, 0x7e, 0x8e, 0x8e,
-    0x8e, 0x8e, 0x81, 0x57, 0x57, 0x41, 0x53, 0x33, 0x29, 0x27, 0x27, 0x22,
-    0x22, 0x22, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1e, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x1a, 0x1a, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x12, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
-    0x0e, 0x0e, 0x09, 0x09, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x53, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
-    0x5d, 0x67, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x84, 0x84, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x88, 0x8a, 0x8a, 0x7c, 0x7c, 0x7c,
-    0x8a, 0x7c, 0x7d, 0x89, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x8a, 0x7c, 0x75,
-    0x7c, 0x7c, 0x7c, 0x8a, 0x7c, 0x7c, 0x7f, 0x8f, 0xc4, 0xd4, 0xde, 0xe3,
-    0xef, 0xe3, 0xda, 0xc5, 0xc5, 0xda, 0xa2, 0x47, 0x94, 0xcf, 0xcf, 0x70,
-    0x50, 0x50, 0x5e, 0x99, 0xc4, 0xd5, 0xd5, 0xc9, 0xaa, 0x9e, 0x8d, 0x7a,
-    0x7a, 0x68, 0x68, 0x68, 0x68, 0x81, 0x8e, 0x8e, 0x8e, 0x81, 0x68, 0x57,
-    0x49, 0x43, 0x5f, 0x2c, 0x29, 0x27, 0x27, 0x27, 0x22, 0x22, 0x21, 0x21,
-    0x21, 0x21, 0x21, 0x1e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1a, 0x1a, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0f, 0x0e, 0x0e, 0x09, 0x09,
-    0x0d, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x61,
-    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x5d, 0x67,
-    0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x89, 0x89, 0x84, 0x84, 0x84, 0x84, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x91, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x87, 0x87, 0x87, 0x6e,
-    0x87, 0x6e, 0x7f, 0x7f, 0x7f, 0x8f, 0xc4, 0xc4, 0xde, 0xde, 0xe5, 0xda,
-    0xda, 0xda, 0xda, 0xa6, 0xa6, 0xd3, 0xb9, 0x55, 0x55, 0x76, 0x99, 0xc4,
-    0xd6, 0xd5, 0xc2, 0xaf, 0x90, 0x8d, 0x93, 0x7a, 0x81, 0x68, 0x68, 0x68,
-    0x68, 0x63, 0x63, 0x63, 0x68, 0x68, 0x4d, 0x41, 0x39, 0x44, 0x42, 0x25,
-    0x29, 0x27, 0x27, 0x27, 0x27, 0x22, 0x21, 0x24, 0x21, 0x21, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1a, 0x1a, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0c, 0x0f, 0x0e, 0x0e, 0x09, 0x09, 0x0d, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x07, 0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x61, 0x61, 0x61, 0x61,
-    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x5d, 0x5d, 0x5d, 0x5d, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x89, 0x89, 0x89, 0x89,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x7c, 0x7c, 0x7c,
-    0x7d, 0x74, 0x7d, 0x88, 0x7c, 0x6e, 0x7f, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
-    0x7c, 0x7c, 0x8f, 0xc2, 0xb9, 0xcd, 0xd3, 0xd4, 0xda, 0xda, 0xda, 0xda,
-    0xcf, 0xd4, 0xb9, 0x55, 0x70, 0x7f, 0xb9, 0xd6, 0xd6, 0xd5, 0xaf, 0x90,
-    0x84, 0x93, 0x93, 0x93, 0x95, 0x81, 0x81, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x57, 0x4d, 0x41, 0x30, 0x42, 0x2c, 0x29, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x1a, 0x1a, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0f,
-    0x0e, 0x0e, 0x09, 0x09, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x4a, 0x53, 0x53, 0x53,
-    0x53, 0x5a, 0x5a, 0x5a, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
-    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x84, 0x84, 0x89, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x93, 0x93, 0x93, 0x93,
-    0x93, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7c, 0x7c, 0x7c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x7c, 0x8f,
-    0xc4, 0xb9, 0xcd, 0xd4, 0xd4, 0xda, 0xe5, 0xda, 0xcf, 0xd3, 0xb9, 0x70,
-    0x76, 0x99, 0x99, 0xc4, 0xc4, 0xc2, 0x91, 0x78, 0x84, 0x84, 0x7a, 0x81,
-    0x95, 0x95, 0x81, 0x81, 0x81, 0x68, 0x68, 0x68, 0x68, 0x4d, 0x41, 0x39,
-    0x33, 0x37, 0x29, 0x29, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x21, 0x21, 0x21,
-    0x21, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1a, 0x1a, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x03, 0x03, 0x02, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
-    0x61, 0x61, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x84, 0x84,
-    0x84, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e, 0x8d,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9e, 0x9e, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x7c, 0x7c, 0x7c, 0x7d, 0x88, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x74, 0x7c, 0x75, 0x6b, 0x75, 0x7c, 0x6d, 0x7b, 0xc4, 0xcd, 0xcd,
-    0xd4, 0xda, 0xda, 0xe5, 0xda, 0xde, 0xde, 0x83, 0x99, 0x76, 0x76, 0x7f,
-    0x99, 0x99, 0x8f, 0x7d, 0x78, 0x84, 0x7a, 0x7a, 0x7a, 0x93, 0x93, 0x81,
-    0x81, 0x81, 0x81, 0x7a, 0x6f, 0x5b, 0x41, 0x36, 0x45, 0x31, 0x29, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x2a, 0x21, 0x21, 0x21, 0x21, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1a, 0x1a, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x12, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x07, 0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02,
-    0x05, 0x05, 0x06, 0x06, 0x07, 0x07, 0x09, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x67, 0x67,
-    0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x84, 0x84, 0x84, 0x84, 0x89, 0x89,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xa7, 0xa7, 0xab, 0xab, 0xab, 0xab, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9f, 0x9f, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89,
-    0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x89, 0x89, 0x89, 0x89, 0x89, 0x88, 0x88, 0x88, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x74, 0x74, 0x74, 0x74,
-    0x7c, 0x75, 0x6b, 0x7b, 0x75, 0x6d, 0x99, 0xb9, 0xd3, 0xda, 0xda, 0xda,
-    0xda, 0xde, 0xe3, 0xb9, 0x99, 0x99, 0x8f, 0x7f, 0x99, 0xc4, 0x8f, 0x8a,
-    0x89, 0x84, 0x84, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x95, 0x93, 0x93, 0x93,
-    0x6f, 0x5b, 0x41, 0x30, 0x46, 0x2b, 0x27, 0x2a, 0x27, 0x27, 0x27, 0x27,
-    0x21, 0x21, 0x22, 0x22, 0x21, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x1a, 0x1f, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x0f, 0x0f, 0x12, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e,
-    0x0e, 0x0e, 0x09, 0x09, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x05, 0x07, 0x07, 0x0a, 0x0a,
-    0x09, 0x09, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x4a, 0x4a, 0x53, 0x53,
-    0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x67, 0x67, 0x67, 0x67, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x89, 0x84, 0x84, 0x84, 0x89, 0x89, 0x84, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x93, 0x93,
-    0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa7, 0xa7,
-    0xab, 0xab, 0xab, 0xab, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x9f, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x9f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x88, 0x7d, 0x7d, 0x7d, 0x88, 0x7c, 0x7c, 0x7c,
-    0x7d, 0x7d, 0x7d, 0x74, 0x74, 0x74, 0x7d, 0x74, 0x6b, 0x75, 0x75, 0x6b,
-    0x75, 0x6b, 0x6d, 0x76, 0xcd, 0xde, 0xde, 0xde, 0xde, 0xde, 0xd3, 0xc4,
-    0x99, 0x8f, 0x8f, 0xc2, 0xc4, 0xc4, 0x8f, 0x8a, 0x89, 0x8d, 0x84, 0x68,
-    0x68, 0x68, 0x68, 0x7a, 0x81, 0x93, 0x93, 0x93, 0x6f, 0x4d, 0x39, 0x36,
-    0x34, 0x2b, 0x27, 0x2a, 0x27, 0x27, 0x27, 0x27, 0x21, 0x21, 0x22, 0x21,
-    0x21, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1a, 0x1a, 0x1f, 0x16, 0x1f,
-    0x1f, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f,
-    0x12, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x02, 0x02, 0x05, 0x07, 0x0a, 0x0b, 0x0b, 0x0c, 0x0b, 0x0b, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x61, 0x61, 0x61, 0x61,
-    0x61, 0x61, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x67, 0x67, 0x67, 0x67,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e,
-    0xa7, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x88,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d,
-    0x7c, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6d, 0x6d,
-    0x99, 0xd6, 0xd6, 0xd6, 0xd6, 0xc4, 0xc4, 0xc2, 0x8f, 0x7c, 0x91, 0xaf,
-    0x99, 0x8f, 0x8a, 0x78, 0x89, 0x8d, 0x84, 0x84, 0x6a, 0x6f, 0x68, 0x68,
-    0x81, 0x93, 0x93, 0x7a, 0x5b, 0x49, 0x36, 0x3b, 0x31, 0x29, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x21, 0x21, 0x21, 0x21, 0x24, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x1a, 0x16, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0c, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x06, 0x0a, 0x0d,
-    0x0f, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x67, 0x67, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x84, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e,
-    0x9e, 0x9e, 0xa7, 0xa7, 0xa7, 0xa7, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x8d, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x73, 0x6e, 0x6e, 0x8f, 0x8f, 0xc2, 0xd5, 0xc9,
-    0xaf, 0xa4, 0x8f, 0x7b, 0x65, 0x5a, 0x65, 0x75, 0x7b, 0x7b, 0x6b, 0x66,
-    0x6a, 0x84, 0x84, 0x84, 0x85, 0x7a, 0x68, 0x68, 0x81, 0x81, 0x95, 0x7a,
-    0x5b, 0x41, 0x30, 0x37, 0x28, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x21, 0x21, 0x21, 0x21, 0x24, 0x24, 0x1f, 0x1f, 0x1f, 0x1f, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x1a, 0x1a, 0x1a,
-    0x16, 0x16, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e,
-    0x0c, 0x0c, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x07, 0x05,
-    0x05, 0x05, 0x05, 0x06, 0x06, 0x09, 0x0e, 0x12, 0x13, 0x13, 0x13, 0x14,
-    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x66, 0x66, 0x64, 0x64, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x84, 0x84, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7,
-    0xa7, 0xa7, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x8d, 0x8d, 0x9e, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x89, 0x89, 0x89, 0x8a, 0x8a, 0x88, 0x88, 0x8a, 0x8a,
-    0x88, 0x88, 0x88, 0x88, 0x8a, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x6e, 0x6e, 0x7f, 0xc2, 0xc2, 0xc2, 0xc9, 0xa4, 0x89, 0x72, 0x67, 0x53,
-    0x43, 0x43, 0x43, 0x4a, 0x4a, 0x5a, 0x66, 0x57, 0x6a, 0x68, 0x7a, 0x7a,
-    0x7a, 0x7a, 0x95, 0x93, 0x93, 0x93, 0x81, 0x68, 0x5b, 0x41, 0x36, 0x34,
-    0x28, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x21, 0x21, 0x21, 0x21,
-    0x21, 0x21, 0x1f, 0x1f, 0x1f, 0x1f, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x13, 0x13, 0x12, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x07, 0x06, 0x06, 0x07,
-    0x0b, 0x0f, 0x13, 0x16, 0x16, 0x1a, 0x1f, 0x1e, 0x1e, 0x1e, 0x1e, 0x19,
-    0x19, 0x19, 0x19, 0x1e, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x61, 0x61, 0x61, 0x61,
-    0x61, 0x61, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x66,
-    0x64, 0x64, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x84, 0x84, 0x84, 0x84, 0x84, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xa7, 0xa7, 0xa7, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89,
-    0x89, 0x89, 0x8a, 0x88, 0x88, 0x88, 0x8a, 0x8a, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x7d, 0x7d, 0x88, 0x88, 0x88, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x8a, 0x8a, 0x8a, 0x8a, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x75, 0x75, 0x75, 0x6e, 0x6e, 0x8f, 0xc2,
-    0xc9, 0xaf, 0xaa, 0x78, 0x6a, 0x57, 0x48, 0x49, 0x41, 0x36, 0x43, 0x43,
-    0x43, 0x4a, 0x5d, 0x57, 0x68, 0x68, 0x68, 0x68, 0x7a, 0x81, 0x93, 0xa9,
-    0xa9, 0xa9, 0x93, 0x68, 0x4d, 0x39, 0x42, 0x34, 0x28, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x16, 0x16, 0x16, 0x13, 0x12, 0x0f,
-    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x07, 0x07, 0x07, 0x06, 0x06, 0x0a, 0x0e, 0x13, 0x16, 0x1f, 0x24,
-    0x21, 0x21, 0x21, 0x21, 0x27, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x21,
-    0x43, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x84, 0x84, 0x84, 0x84, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0xa7, 0xa7, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa7, 0xa7, 0xa7, 0xa7,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x89, 0x89, 0x90, 0x89, 0x89, 0x89, 0x89, 0x89, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x7d, 0x7d, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x75, 0x75, 0x75, 0x6e, 0x6e, 0x8f, 0xb2, 0xc0, 0xc9, 0x97, 0x84,
-    0x84, 0x68, 0x57, 0x48, 0x41, 0x39, 0x36, 0x43, 0x43, 0x49, 0x5b, 0x57,
-    0x5b, 0x6f, 0x68, 0x68, 0x68, 0x81, 0x8e, 0x8e, 0xa9, 0xa9, 0x93, 0x5b,
-    0x41, 0x36, 0x5f, 0x2c, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x21,
-    0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1e, 0x1e, 0x1f, 0x1f, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x12, 0x13,
-    0x13, 0x0f, 0x0f, 0x0f, 0x12, 0x12, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e,
-    0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0b, 0x09, 0x0b,
-    0x0b, 0x0c, 0x12, 0x16, 0x1e, 0x21, 0x2a, 0x2a, 0x2a, 0x2a, 0x2e, 0x2e,
-    0x35, 0x2e, 0x2e, 0x2e, 0x2e, 0x27, 0x2e, 0x2e, 0x43, 0x43, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x59, 0x59, 0x59, 0x59,
-    0x59, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x84, 0x84,
-    0x84, 0x84, 0x84, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x84, 0x84,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0xab, 0xab, 0xab, 0xab, 0xa7, 0xa7, 0xa7, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x90, 0x89, 0x90, 0x90, 0x90, 0x90, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x88, 0x88, 0x88, 0x88, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x88, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x88, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x75, 0x6e,
-    0x6e, 0x7f, 0x8f, 0xb2, 0xaf, 0xb0, 0x8d, 0x93, 0x93, 0x7a, 0x6a, 0x57,
-    0x48, 0x39, 0x39, 0x39, 0x41, 0x41, 0x4d, 0x5b, 0x6a, 0x6f, 0x68, 0x68,
-    0x68, 0x63, 0x81, 0x8e, 0xa9, 0xa9, 0x85, 0x5b, 0x39, 0x44, 0x46, 0x2b,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
-    0x21, 0x21, 0x21, 0x1e, 0x1f, 0x1f, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x13, 0x13, 0x12, 0x12, 0x12, 0x12, 0x13, 0x0f, 0x12, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0c, 0x0e, 0x0c,
-    0x09, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0c, 0x0f, 0x13, 0x16, 0x16, 0x24,
-    0x22, 0x27, 0x2e, 0x35, 0x35, 0x35, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a,
-    0x3a, 0x35, 0x3a, 0x3a, 0x43, 0x43, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x61, 0x61,
-    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x59, 0x59, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x84,
-    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x90, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x88, 0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x87, 0x87, 0x6e, 0x6e, 0x6d, 0x6d, 0x8f, 0x8f,
-    0xaf, 0xc0, 0x8d, 0x93, 0x93, 0x93, 0x84, 0x6a, 0x5d, 0x48, 0x41, 0x41,
-    0x41, 0x41, 0x4d, 0x5b, 0x6a, 0x6a, 0x7a, 0x7a, 0x81, 0x81, 0x81, 0x8e,
-    0x93, 0x93, 0x85, 0x5d, 0x36, 0x5f, 0x34, 0x28, 0x27, 0x2a, 0x27, 0x27,
-    0x27, 0x22, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1e,
-    0x1f, 0x1f, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13,
-    0x12, 0x12, 0x12, 0x12, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0f, 0x14, 0x19, 0x1e, 0x21, 0x2a, 0x2a, 0x2e, 0x3a, 0x3a, 0x3a,
-    0x47, 0x47, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x47, 0x47, 0x47, 0x55,
-    0x43, 0x43, 0x43, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
-    0x61, 0x61, 0x61, 0x61, 0x59, 0x59, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
-    0x84, 0x84, 0x84, 0x84, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0xa7, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x90, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x88, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x88,
-    0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x88, 0x88, 0x88, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x7c, 0x7c, 0x7c,
-    0x87, 0x87, 0x6e, 0x7f, 0x6d, 0x7f, 0x8f, 0x8f, 0xc2, 0xd0, 0xae, 0x9e,
-    0x93, 0x93, 0x8d, 0x84, 0x6a, 0x66, 0x48, 0x41, 0x41, 0x41, 0x4d, 0x4d,
-    0x5b, 0x6a, 0x6f, 0x7a, 0x81, 0x8e, 0x8e, 0x8e, 0xa9, 0x93, 0x74, 0x53,
-    0x44, 0x5e, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x22, 0x21, 0x21,
-    0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1e, 0x1f, 0x1f, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x12, 0x12, 0x12, 0x12,
-    0x12, 0x13, 0x0f, 0x0f, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x16, 0x16,
-    0x1a, 0x1a, 0x16, 0x13, 0x13, 0x13, 0x19, 0x19, 0x19, 0x1e, 0x1e, 0x21,
-    0x27, 0x2a, 0x35, 0x35, 0x3a, 0x47, 0x56, 0x55, 0x55, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x55, 0x70, 0x70, 0x45, 0x45, 0x43, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
-    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89, 0x84, 0x84,
-    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
-    0x84, 0x84, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x97, 0x97, 0x90, 0x90, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x88, 0x88, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x91, 0x91, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x87, 0x87, 0x87, 0x7f,
-    0x7f, 0x7f, 0x99, 0xd6, 0xe8, 0xe2, 0xc0, 0x97, 0x8d, 0x8d, 0x8d, 0x90,
-    0x89, 0x78, 0x72, 0x66, 0x49, 0x41, 0x4d, 0x4d, 0x5b, 0x5b, 0x68, 0x7a,
-    0x81, 0x8e, 0xa8, 0xbd, 0xa9, 0x96, 0x74, 0x43, 0x42, 0x46, 0x28, 0x27,
-    0x2a, 0x2a, 0x27, 0x22, 0x22, 0x22, 0x21, 0x21, 0x24, 0x21, 0x21, 0x21,
-    0x21, 0x21, 0x1f, 0x1f, 0x1f, 0x1f, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x13, 0x13, 0x12, 0x12, 0x12, 0x12, 0x13, 0x13, 0x13, 0x1a,
-    0x1a, 0x1a, 0x16, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x21, 0x21, 0x21, 0x21,
-    0x21, 0x21, 0x21, 0x21, 0x22, 0x27, 0x27, 0x2e, 0x35, 0x3a, 0x47, 0x56,
-    0x55, 0x55, 0x70, 0x70, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
-    0x83, 0x83, 0x83, 0x83, 0x45, 0x45, 0x43, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x53, 0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
-    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x66, 0x66, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
-    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x8d, 0x9e, 0x9e, 0x9e, 0x8d, 0x8d, 0x97, 0x97,
-    0x90, 0x90, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x8a, 0x8a, 0x8a, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x87, 0x87, 0x87, 0x7f, 0x7f, 0x76, 0x99, 0xd6,
-    0xe6, 0xd5, 0xd0, 0xb0, 0xa3, 0x97, 0x9f, 0x9f, 0x90, 0x9f, 0x9f, 0x89,
-    0x72, 0x5d, 0x4d, 0x4d, 0x4d, 0x5b, 0x68, 0x7a, 0x81, 0x8e, 0x8e, 0xa8,
-    0xa9, 0x80, 0x67, 0x43, 0x46, 0x31, 0x28, 0x27, 0x2a, 0x2a, 0x27, 0x27,
-    0x22, 0x22, 0x21, 0x21, 0x24, 0x24, 0x21, 0x21, 0x21, 0x21, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13,
-    0x12, 0x12, 0x12, 0x13, 0x16, 0x16, 0x1f, 0x1f, 0x1f, 0x24, 0x24, 0x21,
-    0x21, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2e, 0x2e, 0x2e,
-    0x35, 0x35, 0x35, 0x3a, 0x47, 0x55, 0x56, 0x70, 0x70, 0x83, 0x83, 0x83,
-    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0xa6,
-    0x45, 0x45, 0x45, 0x45, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
-    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x66, 0x66, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x84, 0x84, 0x84, 0x84, 0x84,
-    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9e,
-    0x9e, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x92, 0x92,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x87, 0x87,
-    0x87, 0x87, 0x87, 0x7f, 0x7f, 0x99, 0xc4, 0xd6, 0xe6, 0xe6, 0xd5, 0xc9,
-    0xc0, 0xc0, 0xbb, 0xb6, 0xaf, 0xaf, 0xaa, 0xaa, 0x90, 0x78, 0x6a, 0x4d,
-    0x3d, 0x57, 0x6f, 0x68, 0x68, 0x8e, 0x8e, 0xa8, 0xa9, 0x7a, 0x67, 0x53,
-    0x50, 0x28, 0x29, 0x27, 0x27, 0x2a, 0x27, 0x27, 0x22, 0x22, 0x21, 0x21,
-    0x24, 0x24, 0x21, 0x21, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x16, 0x1a, 0x1a,
-    0x1f, 0x24, 0x24, 0x2a, 0x2a, 0x2a, 0x2a, 0x2e, 0x2e, 0x35, 0x35, 0x35,
-    0x35, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x47, 0x47, 0x47, 0x55, 0x56, 0x55,
-    0x55, 0x70, 0x70, 0x83, 0x94, 0x94, 0x94, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6,
-    0xa6, 0xa6, 0xa6, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0x45, 0x45, 0x45, 0x45,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x61,
-    0x5a, 0x5a, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
-    0x61, 0x61, 0x59, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x66, 0x66, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
-    0x84, 0x84, 0x84, 0x84, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x92, 0x92, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x92, 0x92, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x8a, 0x8a, 0x87, 0x87, 0x87, 0x87, 0x87, 0x7f,
-    0x8f, 0xc4, 0xe6, 0xe6, 0xe6, 0xe6, 0xd5, 0xd0, 0xd0, 0xd0, 0xc9, 0xaf,
-    0xc9, 0xc9, 0xbb, 0xbb, 0xbb, 0xaf, 0x90, 0x72, 0x5b, 0x4d, 0x5b, 0x68,
-    0x7a, 0x81, 0x93, 0xa9, 0x93, 0x84, 0x5d, 0x5f, 0x3e, 0x28, 0x2e, 0x27,
-    0x2a, 0x27, 0x27, 0x22, 0x22, 0x21, 0x21, 0x21, 0x24, 0x24, 0x21, 0x21,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x1f, 0x1f, 0x24, 0x2a, 0x2a, 0x2e,
-    0x2e, 0x35, 0x35, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x47, 0x55, 0x56, 0x55,
-    0x56, 0x55, 0x56, 0x55, 0x56, 0x70, 0x70, 0x70, 0x70, 0x83, 0x83, 0x94,
-    0x94, 0xa6, 0xa6, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xcd,
-    0xcd, 0xcd, 0xcd, 0xcd, 0x45, 0x45, 0x45, 0x45, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x61, 0x61,
-    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
-    0x61, 0x65, 0x64, 0x64, 0x66, 0x66, 0x66, 0x66, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
-    0x84, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x8a, 0x91, 0x87, 0x87, 0x87, 0x87, 0x87, 0x8f, 0xd5, 0xe6, 0xe6, 0xe6,
-    0xd6, 0xd6, 0xd5, 0xd5, 0xd0, 0xc9, 0xc9, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2,
-    0xc2, 0xc2, 0xaf, 0xa1, 0x89, 0x66, 0x5b, 0x57, 0x5b, 0x68, 0x7a, 0x93,
-    0x84, 0x85, 0x61, 0x54, 0x2c, 0x28, 0x27, 0x27, 0x2a, 0x27, 0x22, 0x22,
-    0x22, 0x21, 0x21, 0x24, 0x24, 0x1f, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x1f, 0x24, 0x24, 0x2a, 0x2a, 0x2e, 0x35, 0x3a, 0x40, 0x3a, 0x56, 0x56,
-    0x56, 0x56, 0x56, 0x55, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x83, 0x83, 0x83, 0x83, 0x94, 0x94, 0x94, 0xa6, 0xa6, 0xb9, 0xb9, 0xcf,
-    0xcf, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
-    0x45, 0x45, 0x45, 0x45, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x61, 0x61, 0x61, 0x61, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x64, 0x64,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x78, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x84, 0x84, 0x84, 0x84,
-    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xb4, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x88, 0x88,
-    0x88, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x88, 0x7d, 0x88, 0x88, 0x88,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8a, 0x91, 0x87, 0x87,
-    0x87, 0x87, 0x87, 0x8f, 0xd5, 0xd5, 0xc4, 0xc4, 0xc4, 0xd6, 0xd5, 0xd5,
-    0xd0, 0xd5, 0xc2, 0xc2, 0xd6, 0xd6, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xaf,
-    0xc2, 0xa4, 0x88, 0x67, 0x5b, 0x4d, 0x5b, 0x5b, 0x5d, 0x67, 0x53, 0x42,
-    0x29, 0x2e, 0x27, 0x2a, 0x27, 0x27, 0x22, 0x27, 0x22, 0x21, 0x21, 0x24,
-    0x1f, 0x1f, 0x1f, 0x1e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x1f, 0x24, 0x2a, 0x2a, 0x2e,
-    0x35, 0x35, 0x40, 0x47, 0x47, 0x56, 0x56, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x94, 0x94, 0x94, 0xa6,
-    0xa6, 0xa6, 0xa6, 0xa6, 0xb9, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xd3, 0xd3,
-    0xd3, 0xd3, 0xd3, 0xd3, 0xde, 0xde, 0xd3, 0xd3, 0x45, 0x45, 0x45, 0x45,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x61, 0x61, 0x61, 0x61, 0x61, 0x64, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x78, 0x78, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
-    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0x9e, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xa7, 0xa7, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x91, 0x91, 0x98, 0x98, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x87, 0x87, 0x87, 0x87, 0x87, 0x7f,
-    0x7f, 0x8f, 0x7f, 0x7f, 0x7f, 0x8f, 0x98, 0xa4, 0xa4, 0xaf, 0x7b, 0x76,
-    0xb9, 0xde, 0xd3, 0xd3, 0xd3, 0xcd, 0xd3, 0x99, 0x99, 0x8f, 0xc2, 0x8f,
-    0x8a, 0x74, 0x5d, 0x49, 0x4a, 0x5f, 0x45, 0x46, 0x2b, 0x2e, 0x27, 0x2a,
-    0x27, 0x22, 0x22, 0x22, 0x22, 0x21, 0x21, 0x24, 0x1f, 0x1f, 0x1f, 0x1e,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x1f, 0x24, 0x24, 0x2a, 0x2a, 0x35, 0x35, 0x40, 0x40, 0x58, 0x56,
-    0x56, 0x70, 0x70, 0x83, 0x83, 0x83, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
-    0x94, 0x94, 0x94, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xb9, 0xb9, 0xb9, 0xb9,
-    0xb9, 0xcf, 0xcf, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xde, 0xde, 0xde,
-    0xde, 0xde, 0xde, 0xd4, 0x45, 0x45, 0x45, 0x45, 0x4a, 0x4a, 0x4a, 0x53,
-    0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x61,
-    0x61, 0x61, 0x61, 0x61, 0x64, 0x66, 0x64, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
-    0x84, 0x84, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x91, 0x91, 0x91, 0x91, 0x98, 0x98, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x87, 0x87, 0x87, 0x87, 0x87, 0x7f, 0x7f, 0x7f, 0x6d, 0x6d,
-    0x6d, 0x6d, 0x6e, 0x6e, 0x65, 0x65, 0x6d, 0x5e, 0x70, 0xcd, 0xcd, 0xb9,
-    0xb9, 0xcd, 0xd3, 0xb9, 0x50, 0x5e, 0x76, 0x7f, 0x7f, 0x8f, 0xc2, 0x8f,
-    0x6d, 0x69, 0x42, 0x55, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x22,
-    0x22, 0x21, 0x21, 0x24, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x1a, 0x1f, 0x24, 0x24, 0x2a,
-    0x2a, 0x35, 0x35, 0x3a, 0x40, 0x56, 0x56, 0x70, 0x70, 0x83, 0x83, 0x94,
-    0x94, 0x94, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6,
-    0xb9, 0xb9, 0xb9, 0xb9, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xcf, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xde, 0xde, 0xde, 0xde, 0xe3, 0xe3, 0xe3, 0xe3, 0xde, 0xd4,
-    0x45, 0x45, 0x45, 0x4b, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53,
-    0x51, 0x51, 0x51, 0x51, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x61, 0x61,
-    0x61, 0x64, 0x65, 0x64, 0x64, 0x64, 0x64, 0x71, 0x71, 0x71, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e,
-    0x9e, 0x9e, 0xa7, 0xa7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x92, 0x92, 0x88, 0x88, 0x88, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x91, 0x91, 0x98, 0x98, 0x98, 0x98,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8a, 0x8a, 0x87, 0x87,
-    0x87, 0x87, 0x7f, 0x7f, 0x7f, 0x7f, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5e, 0x5e, 0x70, 0xd4, 0xcf, 0xc5, 0xc5, 0xc5, 0xda,
-    0x94, 0x47, 0x46, 0x3e, 0x3e, 0x46, 0x99, 0xd6, 0x99, 0x76, 0x4b, 0x5e,
-    0x2b, 0x2e, 0x27, 0x27, 0x27, 0x27, 0x22, 0x22, 0x22, 0x22, 0x21, 0x21,
-    0x1f, 0x1f, 0x1f, 0x16, 0x16, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x1a, 0x1a, 0x1f, 0x1e, 0x21, 0x2a, 0x2a, 0x2e, 0x35, 0x3a, 0x47, 0x56,
-    0x56, 0x70, 0x70, 0x83, 0x83, 0x94, 0x94, 0x94, 0xa6, 0xa6, 0xa6, 0xb9,
-    0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9,
-    0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xcf, 0xd4, 0xd4, 0xde, 0xde, 0xde, 0xde,
-    0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xde, 0x45, 0x45, 0x4b, 0x4b,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x51, 0x51, 0x51, 0x51,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x59, 0x59, 0x59,
-    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x61, 0x61, 0x61, 0x65, 0x65, 0x65,
-    0x64, 0x64, 0x64, 0x64, 0x71, 0x71, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x84, 0x84,
-    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x88, 0x88, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x91, 0x91, 0x91, 0x91, 0x98, 0x98, 0x98, 0x98, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x87, 0x87, 0x87, 0x87, 0x7f, 0x7f,
-    0x7f, 0x6e, 0x6d, 0x6d, 0x6d, 0x6d, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x5e,
-    0x5e, 0x55, 0x83, 0xd4, 0xc5, 0xc5, 0xc5, 0xc5, 0xda, 0x56, 0x3e, 0x47,
-    0x3c, 0x3c, 0x55, 0xd4, 0xa6, 0x76, 0x54, 0x5e, 0x2b, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x22, 0x22, 0x22, 0x22, 0x21, 0x21, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x21, 0x2a,
-    0x2a, 0x2e, 0x35, 0x3a, 0x3a, 0x56, 0x56, 0x55, 0x70, 0x70, 0x83, 0x83,
-    0x94, 0xa6, 0xa6, 0xa6, 0xb9, 0xb9, 0xb9, 0xb9, 0xcd, 0xb9, 0xb9, 0xb9,
-    0xb9, 0xb9, 0xb9, 0xb9, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd,
-    0xcf, 0xcf, 0xd4, 0xde, 0xde, 0xde, 0xe3, 0xe3, 0xe5, 0xe5, 0xe5, 0xe3,
-    0xe3, 0xe3, 0xe3, 0xe3, 0x45, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x51, 0x4b, 0x54, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x5a, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
-    0x59, 0x59, 0x59, 0x59, 0x61, 0x61, 0x65, 0x65, 0x65, 0x65, 0x64, 0x64,
-    0x64, 0x64, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
-    0x84, 0x84, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0xa7, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x87, 0x87, 0x87, 0x87, 0x7f, 0x7f, 0x7f, 0x6e, 0x6d, 0x6d,
-    0x6d, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x5e, 0x50, 0x55, 0x55, 0xa6,
-    0xde, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0x47, 0x3c, 0x3e, 0x3c, 0x3e, 0xd4,
-    0xb9, 0x76, 0x54, 0x50, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x21, 0x21, 0x21,
-    0x21, 0x21, 0x21, 0x21, 0x1f, 0x1f, 0x1f, 0x16, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x24, 0x24, 0x21, 0x2a, 0x2a, 0x2a, 0x35, 0x35, 0x3a, 0x3a, 0x47,
-    0x56, 0x55, 0x70, 0x70, 0x83, 0x83, 0x94, 0x94, 0xa6, 0xb9, 0xb9, 0xb9,
-    0xb9, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd,
-    0xcd, 0xd3, 0xcd, 0xcd, 0xd3, 0xd4, 0xd3, 0xd3, 0xd4, 0xd4, 0xd4, 0xde,
-    0xe3, 0xe3, 0xe5, 0xe5, 0xed, 0xed, 0xed, 0xec, 0xec, 0xe3, 0xe3, 0xe3,
-    0x45, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x51, 0x51, 0x51, 0x51, 0x4b, 0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
-    0x61, 0x61, 0x61, 0x65, 0x65, 0x65, 0x64, 0x64, 0x64, 0x64, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x78, 0x78, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0xa7, 0xa7, 0xa7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xa3, 0xa3, 0xa3, 0xa3, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8a, 0x87, 0x87,
-    0x87, 0x87, 0x7f, 0x7f, 0x7f, 0x6e, 0x6d, 0x6d, 0x6d, 0x6d, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5e, 0x5e, 0x50, 0x5e, 0x55, 0x55, 0xd4, 0xda, 0xc5, 0xc5,
-    0xc5, 0xda, 0x70, 0x47, 0x3c, 0x3c, 0x3e, 0xd4, 0xb9, 0x99, 0x5e, 0x5e,
-    0x2b, 0x27, 0x27, 0x27, 0x2a, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1e,
-    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1e, 0x1e, 0x21, 0x2a, 0x2a, 0x2a, 0x2e,
-    0x2e, 0x35, 0x35, 0x3a, 0x40, 0x56, 0x56, 0x56, 0x70, 0x70, 0x83, 0x83,
-    0x94, 0x94, 0xa6, 0xa6, 0xb9, 0xcd, 0xcd, 0xcd, 0xcd, 0xd3, 0xd3, 0xd3,
-    0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xde, 0xde, 0xe3, 0xe3, 0xe5, 0xed, 0xed,
-    0xed, 0xed, 0xed, 0xed, 0xed, 0xec, 0xe3, 0xe3, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x59, 0x59, 0x59,
-    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x71, 0x71, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x84, 0x84, 0x84, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x92, 0x92,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x50,
-    0x5e, 0x50, 0x55, 0x55, 0x83, 0xe5, 0xda, 0xc5, 0xc5, 0xda, 0xda, 0x56,
-    0x47, 0x3a, 0x47, 0xd4, 0xcd, 0x94, 0x5e, 0x5e, 0x31, 0x2e, 0x2a, 0x27,
-    0x2a, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x21, 0x2a, 0x2e, 0x35, 0x35, 0x35, 0x3a, 0x3a, 0x3a, 0x47, 0x56,
-    0x56, 0x70, 0x70, 0x83, 0x83, 0x94, 0x94, 0xa6, 0xa6, 0xb9, 0xb9, 0xcd,
-    0xcd, 0xd3, 0xd4, 0xd4, 0xd4, 0xd3, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
-    0xd4, 0xd4, 0xd4, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
-    0xe3, 0xe3, 0xe3, 0xe5, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed,
-    0xed, 0xed, 0xe3, 0xe3, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54,
-    0x54, 0x54, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
-    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x71, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x84, 0x84,
-    0x84, 0x84, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e,
-    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x92, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x98, 0x98, 0x98, 0x98, 0x98, 0x87, 0x87, 0x87,
-    0x87, 0x87, 0x87, 0x87, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x6d, 0x6d, 0x6d,
-    0x6d, 0x6d, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x50, 0x5e, 0x50, 0x55,
-    0x56, 0xb9, 0xda, 0xc5, 0xc5, 0xc5, 0xda, 0xc5, 0x40, 0x3a, 0x40, 0xcf,
-    0xcf, 0x94, 0x5e, 0x5e, 0x31, 0x2e, 0x2a, 0x27, 0x21, 0x21, 0x21, 0x21,
-    0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x2a, 0x2e, 0x35, 0x3a,
-    0x40, 0x47, 0x47, 0x56, 0x56, 0x56, 0x70, 0x70, 0x83, 0x94, 0x94, 0xa6,
-    0xa6, 0xa6, 0xb9, 0xb9, 0xb9, 0xcd, 0xcd, 0xd3, 0xd3, 0xde, 0xde, 0xde,
-    0xde, 0xde, 0xda, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xde, 0xe3, 0xe5,
-    0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe5, 0xed,
-    0xed, 0xed, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xec, 0xe3,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x59, 0x59, 0x51, 0x51, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
-    0x59, 0x59, 0x59, 0x59, 0x59, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
-    0x9e, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x97, 0x97, 0x97, 0x97,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x92, 0x92, 0x92, 0x92, 0x92, 0xa3, 0xa3, 0xa3,
-    0xa3, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0x98, 0x98, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x6d, 0x6d, 0x6d, 0x6d, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x50, 0x5e, 0x50, 0x55, 0x55, 0x70, 0xda, 0xda,
-    0xc5, 0xc5, 0xda, 0xda, 0x77, 0x40, 0x40, 0xc5, 0xd4, 0x94, 0x76, 0x5e,
-    0x31, 0x2e, 0x27, 0x27, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x2a, 0x27,
-    0x2a, 0x2a, 0x2e, 0x2e, 0x3a, 0x3a, 0x56, 0x56, 0x56, 0x70, 0x70, 0x70,
-    0x83, 0x83, 0x94, 0x94, 0xa6, 0xa6, 0xa6, 0xb9, 0xb9, 0xcd, 0xcd, 0xcd,
-    0xd3, 0xd3, 0xd3, 0xde, 0xde, 0xe3, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5,
-    0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xed, 0xed, 0xed, 0xe5, 0xed,
-    0xed, 0xed, 0xe5, 0xe5, 0xe5, 0xe5, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed,
-    0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe5, 0xe3, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x5a, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x59,
-    0x51, 0x51, 0x51, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
-    0x59, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90,
-    0x90, 0x90, 0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0x9e, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0x97, 0x97, 0x97, 0x9d, 0x9d, 0x9d, 0x9d,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0x98, 0x98, 0xa4, 0x91, 0x91, 0x91, 0x91, 0x91, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x87, 0x87, 0x87, 0x87, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x55, 0x55, 0x70, 0xe5, 0xc5, 0xc5, 0xc5, 0xda,
-    0xda, 0x58, 0x40, 0xc5, 0xd4, 0xa6, 0x5e, 0x5e, 0x31, 0x2e, 0x27, 0x27,
-    0x21, 0x21, 0x21, 0x21, 0x2a, 0x2a, 0x2e, 0x2e, 0x35, 0x35, 0x3a, 0x3a,
-    0x56, 0x56, 0x70, 0x70, 0x83, 0x83, 0x94, 0x94, 0x94, 0x94, 0xa6, 0xb9,
-    0xb9, 0xb9, 0xcd, 0xcd, 0xcd, 0xd3, 0xd4, 0xd3, 0xde, 0xde, 0xde, 0xe3,
-    0xe3, 0xe5, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee,
-    0xed, 0xef, 0xef, 0xef, 0xef, 0xee, 0xee, 0xef, 0xef, 0xef, 0xed, 0xed,
-    0xe5, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe5,
-    0xe3, 0xe3, 0xe3, 0xe3, 0x45, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x45, 0x45, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x51, 0x51,
-    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x9e, 0x9e, 0x97, 0x97, 0x97, 0x97, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x97,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0xb1, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0xa3, 0xa3, 0xa3, 0xa3, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb1, 0xa3, 0xa3, 0xb2, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x87, 0x87, 0x87, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x6d, 0x6d,
-    0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x5f, 0x5f, 0x5f, 0x5e, 0x5e, 0x50, 0x50,
-    0x50, 0x55, 0x56, 0xa2, 0xda, 0xc5, 0xc5, 0xc5, 0xda, 0xc5, 0x40, 0xc5,
-    0xda, 0xa6, 0x76, 0x50, 0x3c, 0x2e, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x2e,
-    0x2e, 0x35, 0x3a, 0x3a, 0x3a, 0x47, 0x56, 0x56, 0x70, 0x83, 0x94, 0x94,
-    0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xb9, 0xb9, 0xb9, 0xcd, 0xcd, 0xcd, 0xd3,
-    0xd4, 0xd4, 0xde, 0xde, 0xe3, 0xe3, 0xe3, 0xe3, 0xe5, 0xed, 0xed, 0xed,
-    0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xf5, 0xf5, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf0, 0xf5, 0xf5, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xed,
-    0xed, 0xed, 0xe5, 0xe5, 0xe5, 0xe3, 0xe3, 0xe3, 0xe3, 0xde, 0xde, 0xde,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x51, 0x51, 0x59, 0x59, 0x59, 0x59,
-    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89,
-    0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x9e, 0x9e, 0x97, 0x97,
-    0x97, 0x97, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb0, 0xb0, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x87, 0x87, 0x87, 0x87,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d,
-    0x6d, 0x5f, 0x5f, 0x5f, 0x5e, 0x5e, 0x50, 0x50, 0x50, 0x55, 0x55, 0x56,
-    0xdc, 0xda, 0xc5, 0xc5, 0xd7, 0xe5, 0x77, 0xa2, 0xda, 0xa6, 0x76, 0x50,
-    0x47, 0x29, 0x27, 0x27, 0x27, 0x2e, 0x2e, 0x35, 0x3a, 0x3a, 0x47, 0x55,
-    0x56, 0x70, 0x70, 0x83, 0x94, 0xa6, 0xa6, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9,
-    0xb9, 0xb9, 0xb9, 0xcd, 0xcd, 0xd3, 0xd4, 0xde, 0xde, 0xe3, 0xe3, 0xe3,
-    0xe3, 0xe3, 0xec, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef,
-    0xf3, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xf5, 0xf5, 0xf5, 0xf0, 0xed, 0xed, 0xed, 0xed, 0xe5, 0xe5, 0xe5, 0xe3,
-    0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xde, 0xde, 0xde, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x53, 0x5a, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
-    0x59, 0x59, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x9f, 0x9f, 0x9f, 0x97, 0x97, 0x97, 0x97, 0x97, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb1, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9d, 0x9d, 0x9d, 0x9d,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x87, 0x87, 0x87, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x5f, 0x5f,
-    0x5e, 0x5e, 0x50, 0x50, 0x50, 0x50, 0x55, 0x56, 0x83, 0xe4, 0xcc, 0xc5,
-    0xd7, 0xdf, 0xdf, 0xc5, 0xe5, 0xa6, 0x70, 0x50, 0x55, 0x2b, 0x29, 0x27,
-    0x2e, 0x35, 0x35, 0x3a, 0x47, 0x56, 0x56, 0x70, 0x83, 0x83, 0x94, 0xa6,
-    0xb9, 0xcf, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf,
-    0xcf, 0xd4, 0xde, 0xe3, 0xe5, 0xed, 0xe5, 0xe3, 0xe5, 0xe5, 0xe5, 0xed,
-    0xed, 0xef, 0xef, 0xf3, 0xf3, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5,
-    0xf5, 0xf5, 0xf8, 0xf9, 0xf9, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf1, 0xf0,
-    0xed, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xde, 0xe3, 0xe3,
-    0xe3, 0xe3, 0xe3, 0xe3, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x72, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x9f,
-    0x9f, 0x9f, 0x97, 0x97, 0x97, 0x97, 0x97, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0x9d, 0x9d, 0x9d, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x87, 0x8f, 0x8f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x5f, 0x5f, 0x5e, 0x5e, 0x50, 0x50,
-    0x46, 0x50, 0x55, 0x56, 0x56, 0xa2, 0xe4, 0xcc, 0xcc, 0xd7, 0xe4, 0xe5,
-    0xe5, 0xa6, 0x70, 0x50, 0x55, 0x2b, 0x29, 0x2e, 0x35, 0x35, 0x3a, 0x47,
-    0x56, 0x70, 0x70, 0x83, 0x94, 0x94, 0xb9, 0xcd, 0xcf, 0xcf, 0xcf, 0xd3,
-    0xd3, 0xd3, 0xcf, 0xcf, 0xcf, 0xcf, 0xd4, 0xd4, 0xcf, 0xd4, 0xe5, 0xed,
-    0xee, 0xee, 0xed, 0xed, 0xed, 0xe5, 0xed, 0xed, 0xef, 0xef, 0xf5, 0xf5,
-    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xf9,
-    0xf9, 0xf7, 0xf7, 0xf7, 0xf9, 0xf9, 0xf1, 0xea, 0xe5, 0xe3, 0xe3, 0xe3,
-    0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x59, 0x59, 0x59,
-    0x59, 0x59, 0x59, 0x59, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x72, 0x72,
-    0x72, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x9f, 0x9f, 0x9f, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0xa3, 0xa3, 0xa3, 0xa3, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x9d, 0x9d, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x87, 0x87, 0x7f, 0x7f, 0x87, 0x87, 0x7f, 0x7f, 0x7f, 0x7f, 0x6d, 0x6d,
-    0x6d, 0x6d, 0x5f, 0x5f, 0x5e, 0x5e, 0x50, 0x50, 0x50, 0x50, 0x55, 0xb9,
-    0x83, 0x70, 0xdc, 0xcc, 0xa2, 0xcc, 0xc5, 0x82, 0xe5, 0xb9, 0x70, 0x46,
-    0x55, 0x29, 0x2e, 0x35, 0x35, 0x3a, 0x47, 0x56, 0x55, 0x70, 0x83, 0x83,
-    0x94, 0xb9, 0xcf, 0xcf, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xde, 0xda, 0xdc, 0xe4, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee,
-    0xed, 0xed, 0xed, 0xef, 0xf0, 0xf5, 0xf8, 0xf8, 0xfc, 0xfc, 0xf9, 0xf9,
-    0xf8, 0xf5, 0xf5, 0xf0, 0xf0, 0xf5, 0xf8, 0xf7, 0xf7, 0xf1, 0xf1, 0xf7,
-    0xf9, 0xf9, 0xf7, 0xea, 0xe5, 0xe3, 0xe3, 0xde, 0xe3, 0xde, 0xe3, 0xe3,
-    0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x72, 0x72, 0x72, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x9f, 0x9f, 0x9f, 0x97, 0x97, 0x97, 0x97, 0x97, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-    0xa3, 0xa3, 0xa3, 0xa3, 0x9d, 0x9d, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x87, 0x8f, 0x7f,
-    0x87, 0x87, 0x7f, 0x7f, 0x7f, 0x7f, 0x6d, 0x6d, 0x6d, 0x6d, 0x5f, 0x5f,
-    0x5e, 0x5e, 0x50, 0x50, 0x50, 0x50, 0x55, 0x83, 0xe5, 0xdc, 0xcc, 0xdc,
-    0xcc, 0xa2, 0xcc, 0xa2, 0xda, 0xa6, 0x70, 0x50, 0x55, 0x29, 0x2e, 0x35,
-    0x35, 0x3a, 0x47, 0x55, 0x70, 0x83, 0x94, 0xa6, 0xb9, 0xcd, 0xcf, 0xd4,
-    0xd4, 0xde, 0xde, 0xde, 0xd4, 0xd4, 0xd4, 0xd4, 0xde, 0xde, 0xe5, 0xe4,
-    0xee, 0xef, 0xf3, 0xef, 0xef, 0xef, 0xee, 0xee, 0xed, 0xed, 0xed, 0xef,
-    0xf5, 0xf8, 0xf9, 0xfc, 0xfc, 0xfc, 0xfc, 0xf9, 0xf7, 0xf0, 0xf0, 0xea,
-    0xea, 0xf0, 0xf0, 0xf0, 0xf0, 0xf1, 0xf1, 0xf1, 0xf7, 0xf9, 0xf1, 0xea,
-    0xe5, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3,
-    0xe3, 0xe3, 0xe3, 0xe3, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x51, 0x51, 0x53, 0x53, 0x53, 0x5a, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x89, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0xa3, 0xa3, 0x97, 0x97, 0x97, 0x97, 0x97, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb2, 0xb2, 0xb1, 0xb1, 0x9d, 0x9d, 0xb1, 0xb1, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9,
-    0xc9, 0xc0, 0xc0, 0xaf, 0xc9, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x8f, 0x8f, 0x87, 0x87, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x6d, 0x6d, 0x5f, 0x5f, 0x5e, 0x5e, 0x50, 0x50,
-    0x50, 0x50, 0x50, 0x55, 0x70, 0x56, 0xa2, 0xcc, 0xcc, 0xcc, 0xa2, 0xa2,
-    0xe5, 0xa6, 0x70, 0x47, 0x56, 0x27, 0x2e, 0x35, 0x3a, 0x47, 0x55, 0x55,
-    0x70, 0x94, 0xa6, 0xb9, 0xb9, 0xcf, 0xcf, 0xd4, 0xd4, 0xde, 0xde, 0xde,
-    0xde, 0xd4, 0xd4, 0xd4, 0xe5, 0xe5, 0xe4, 0xe4, 0xef, 0xef, 0xef, 0xef,
-    0xf3, 0xef, 0xed, 0xee, 0xee, 0xee, 0xef, 0xf5, 0xf8, 0xf8, 0xfc, 0xfc,
-    0xfb, 0xfb, 0xfb, 0xf9, 0xf7, 0xf0, 0xea, 0xd9, 0xd9, 0xd9, 0xea, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xf5, 0xf8, 0xf5, 0xf0, 0xee, 0xe5, 0xe3, 0xe3, 0xe3,
-    0xed, 0xed, 0xed, 0xec, 0xec, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54, 0x51, 0x53, 0x53,
-    0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x59, 0x5c, 0x5c,
-    0x59, 0x59, 0x59, 0x59, 0x59, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0xa3, 0xa3, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0xb1,
-    0xb1, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb1,
-    0xb2, 0xb2, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc2, 0xc9, 0xc9, 0xc9,
-    0xc9, 0xc9, 0xc3, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x8f, 0x8f, 0x8f, 0x8f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x6d, 0x6d, 0x6d, 0x5f, 0x5e, 0x5e, 0x5e, 0x50, 0x5f, 0x50, 0x46, 0x55,
-    0x3a, 0x40, 0x40, 0x56, 0xdc, 0xa2, 0xcc, 0xc5, 0xa2, 0x94, 0x55, 0x47,
-    0x56, 0x27, 0x2e, 0x35, 0x3a, 0x55, 0x56, 0x70, 0x83, 0x94, 0xa6, 0xb9,
-    0xb9, 0xcf, 0xcf, 0xcf, 0xda, 0xda, 0xde, 0xe3, 0xe3, 0xde, 0xd4, 0xd4,
-    0xe5, 0xe4, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xed, 0xed,
-    0xee, 0xef, 0xf5, 0xf8, 0xf8, 0xfc, 0xfc, 0xf9, 0xfb, 0xfb, 0xfb, 0xf7,
-    0xf1, 0xea, 0xcb, 0xcb, 0xc5, 0xd7, 0xe5, 0xf0, 0xf5, 0xf0, 0xf0, 0xf5,
-    0xf8, 0xf8, 0xf0, 0xe4, 0xe5, 0xe3, 0xe3, 0xed, 0xed, 0xef, 0xed, 0xed,
-    0xec, 0xec, 0xe3, 0xe3, 0xe3, 0xde, 0xde, 0xd4, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x59, 0x59, 0x59, 0x59, 0x5c, 0x5c, 0x5c, 0x5c, 0x59, 0x59, 0x59, 0x59,
-    0x59, 0x59, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x78, 0x78, 0x78, 0x89, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0xa3, 0xa3, 0x97, 0x97, 0x97, 0x97, 0x97, 0xae,
-    0xae, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xce, 0xce, 0xce, 0xb2,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb1, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb1, 0xc3, 0xc3, 0xc3, 0xc9, 0xce,
-    0xc9, 0xc9, 0xc2, 0xd5, 0xd6, 0xd4, 0xc4, 0xc2, 0xc9, 0xc3, 0xc3, 0xb1,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0x9d, 0x9d, 0x9d, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x8f, 0x99, 0x99, 0x99, 0x99, 0x8f, 0x7f, 0x7f, 0x7f, 0x6d, 0x6d, 0x6d,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x50, 0x46, 0x47, 0x47, 0x47, 0x3a, 0x3a,
-    0xa2, 0xda, 0xc5, 0x77, 0x70, 0x70, 0x55, 0x46, 0x55, 0x2e, 0x2e, 0x35,
-    0x3a, 0x55, 0x55, 0x70, 0x94, 0x94, 0xa6, 0xb9, 0xb9, 0xcf, 0xcf, 0xcf,
-    0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xdc, 0xdc, 0xe5, 0xe4, 0xee, 0xee,
-    0xee, 0xee, 0xed, 0xed, 0xed, 0xef, 0xed, 0xed, 0xee, 0xf3, 0xf9, 0xfc,
-    0xfc, 0xfc, 0xf9, 0xf9, 0xf7, 0xf7, 0xf7, 0xe9, 0xd9, 0xd9, 0xc5, 0xc5,
-    0xc5, 0xd7, 0xed, 0xf5, 0xf5, 0xf1, 0xf1, 0xf1, 0xf5, 0xf0, 0xee, 0xe5,
-    0xe5, 0xe5, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe3, 0xe3,
-    0xde, 0xd4, 0xd4, 0xd4, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x51, 0x59, 0x59, 0x59,
-    0x59, 0x5c, 0x5c, 0x5c, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x78, 0x78,
-    0x78, 0x78, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0xa3, 0xa3, 0x97, 0x97, 0x97, 0x97, 0xae, 0xae, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
-    0xc3, 0xc3, 0xc3, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc9, 0xce, 0xc9, 0xc9, 0xc3, 0xc3, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xc3, 0xb1, 0xc3, 0xc3, 0xc9, 0xc9, 0xce, 0xce, 0xd6, 0xf2,
-    0xfa, 0xf4, 0xec, 0xde, 0xc2, 0xc2, 0xc9, 0xc9, 0xc9, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb2, 0xb2,
-    0x98, 0x98, 0xb2, 0x8f, 0x8f, 0xb2, 0x8f, 0x8f, 0xcf, 0xe3, 0xe3, 0xde,
-    0xcf, 0xb9, 0x94, 0x99, 0x7f, 0x7f, 0x76, 0x76, 0x5e, 0x5e, 0x5f, 0x5f,
-    0x4b, 0x50, 0x50, 0x47, 0x47, 0x3e, 0x3a, 0x3a, 0x3a, 0xda, 0xc5, 0x9c,
-    0x83, 0x55, 0x47, 0x37, 0x55, 0x2e, 0x2e, 0x35, 0x3a, 0x55, 0x55, 0x83,
-    0x94, 0xa6, 0xa6, 0xb9, 0xb9, 0xcf, 0xcf, 0xcf, 0xdc, 0xdc, 0xdc, 0xdc,
-    0xdc, 0xe4, 0xe4, 0xe4, 0xed, 0xed, 0xed, 0xed, 0xec, 0xec, 0xe3, 0xe3,
-    0xed, 0xed, 0xed, 0xed, 0xef, 0xf5, 0xf9, 0xfc, 0xfc, 0xfc, 0xf9, 0xf1,
-    0xf1, 0xf0, 0xea, 0xd9, 0xcb, 0xd9, 0xea, 0xef, 0xef, 0xf0, 0xf0, 0xf5,
-    0xf5, 0xf7, 0xf1, 0xf5, 0xf0, 0xef, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed,
-    0xed, 0xed, 0xed, 0xed, 0xed, 0xe5, 0xe3, 0xde, 0xd4, 0xcf, 0xcf, 0xcf,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x51, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5c, 0x5c,
-    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x71, 0x71, 0x71, 0x71, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89,
-    0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xae, 0xae, 0xae, 0xae, 0xb0, 0xb0, 0xb0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
-    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xb1, 0xb1, 0xb1, 0xb1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xb1, 0xc3, 0xc9, 0xce, 0xce, 0xce, 0xb2, 0xb1, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xc9, 0xc9,
-    0xc9, 0xc9, 0xc9, 0xd5, 0xd6, 0xd6, 0xec, 0xfa, 0xf5, 0xf5, 0xf8, 0xf4,
-    0xef, 0xde, 0xc4, 0xc2, 0xc9, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xce, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0x99,
-    0x99, 0x99, 0x99, 0xde, 0xf4, 0xfc, 0xfc, 0xf9, 0xf9, 0xf0, 0xe4, 0xcf,
-    0x94, 0x83, 0x76, 0x76, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x50, 0x50, 0x47,
-    0x47, 0x3e, 0x3e, 0x3a, 0x3a, 0xa2, 0xda, 0x9c, 0x70, 0x55, 0x55, 0x3c,
-    0x47, 0x2e, 0x35, 0x35, 0x3a, 0x56, 0x70, 0x83, 0x94, 0x94, 0xa6, 0xb9,
-    0xb9, 0xcf, 0xcf, 0xcf, 0xcc, 0xdc, 0xdc, 0xdc, 0xe4, 0xe4, 0xe4, 0xed,
-    0xed, 0xed, 0xe3, 0xe3, 0xde, 0xd6, 0xd6, 0xde, 0xe3, 0xed, 0xed, 0xef,
-    0xf0, 0xf5, 0xf8, 0xf9, 0xf9, 0xf9, 0xf1, 0xe9, 0xe9, 0xd9, 0xd9, 0xcb,
-    0xcb, 0xea, 0xf0, 0xf8, 0xfc, 0xfc, 0xf8, 0xf5, 0xf5, 0xf5, 0xf0, 0xed,
-    0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xe5, 0xe5, 0xe3, 0xe3,
-    0xe3, 0xe3, 0xe3, 0xde, 0xd3, 0xb9, 0xb9, 0xb9, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x4b, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x51, 0x51, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5c, 0x59, 0x59, 0x59, 0x59,
-    0x59, 0x59, 0x59, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x71, 0x71,
-    0x71, 0x71, 0x78, 0x78, 0x78, 0x78, 0x89, 0x89, 0x89, 0x89, 0x89, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0xa3, 0xa3, 0xa3, 0xa3, 0xb0, 0xae, 0xae, 0xb0,
-    0xb0, 0xb0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
-    0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc9, 0xce, 0xce, 0xce, 0xc9, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2,
-    0xb2, 0xce, 0xb2, 0xb2, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xd5, 0xd6,
-    0xde, 0xef, 0xfa, 0xf5, 0xe9, 0xe9, 0xf1, 0xe9, 0xf5, 0xf4, 0xef, 0xde,
-    0xc4, 0xc2, 0xc9, 0xb2, 0xc9, 0xc2, 0xb2, 0xce, 0xc2, 0xc2, 0xc2, 0xc2,
-    0xc2, 0xb2, 0xb2, 0xc4, 0xc4, 0xb9, 0xde, 0xde, 0xcf, 0xcf, 0xde, 0xfa,
-    0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf5, 0xef, 0xcf, 0xb9, 0x94,
-    0x70, 0x70, 0x76, 0x76, 0x99, 0x5e, 0x50, 0x50, 0x3e, 0x3c, 0x3c, 0x3c,
-    0x3a, 0x40, 0xda, 0xa2, 0x77, 0x70, 0x55, 0x37, 0x55, 0x2e, 0x2e, 0x35,
-    0x3a, 0x55, 0x70, 0x83, 0x83, 0x94, 0xa6, 0xb9, 0xb9, 0xb9, 0xcf, 0xcf,
-    0xcc, 0xdc, 0xdc, 0xe4, 0xe4, 0xe4, 0xe4, 0xee, 0xef, 0xec, 0xe3, 0xde,
-    0xd6, 0xc4, 0xc2, 0xd6, 0xde, 0xe5, 0xed, 0xf0, 0xf0, 0xf0, 0xf5, 0xf5,
-    0xf0, 0xf0, 0xe9, 0xdb, 0xd9, 0xcb, 0xcb, 0xcb, 0xdb, 0xf1, 0xf7, 0xfc,
-    0xfd, 0xfc, 0xf5, 0xf0, 0xf0, 0xef, 0xe5, 0xe5, 0xe5, 0xed, 0xed, 0xed,
-    0xed, 0xed, 0xe5, 0xe5, 0xe5, 0xde, 0xde, 0xd4, 0xd4, 0xde, 0xde, 0xd3,
-    0xcd, 0xa6, 0xa6, 0x94, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x51, 0x51, 0x51, 0x59,
-    0x59, 0x59, 0x59, 0x5c, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
-    0x59, 0x59, 0x59, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x75, 0x75, 0x71, 0x71, 0x7c, 0x7c,
-    0x78, 0x78, 0x89, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90, 0x90, 0x92, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xc0, 0xc0, 0xc0,
-    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc9, 0xc9, 0xc9, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xb1, 0xb1, 0xb1, 0xc3, 0xc9, 0xc9, 0xb2, 0xb2, 0xc9, 0xb2, 0xb2,
-    0xc3, 0xc3, 0xc3, 0xc9, 0xd5, 0xd6, 0xe3, 0xf3, 0xf8, 0xfd, 0xfc, 0xf1,
-    0xd9, 0xcb, 0xd9, 0xcb, 0xad, 0xd9, 0xe5, 0xed, 0xe3, 0xd6, 0xc2, 0xc2,
-    0xc2, 0xce, 0xd6, 0xc4, 0xc4, 0xd6, 0xd6, 0xc4, 0xcf, 0xcf, 0xde, 0xec,
-    0xee, 0xf4, 0xfc, 0xfc, 0xf9, 0xf9, 0xf9, 0xfd, 0xfe, 0xfe, 0xff, 0xff,
-    0xf6, 0xfe, 0xfe, 0xfd, 0xfd, 0xf8, 0xfa, 0xe5, 0x83, 0x94, 0xcd, 0xd6,
-    0xc4, 0x76, 0x50, 0x55, 0x47, 0x3e, 0x3c, 0x3c, 0x35, 0x40, 0xc5, 0xc5,
-    0x9c, 0x70, 0x55, 0x47, 0x55, 0x27, 0x2e, 0x3a, 0x3a, 0x47, 0x70, 0x70,
-    0x83, 0x94, 0xa6, 0xb9, 0xb9, 0xb9, 0xcf, 0xcf, 0xcf, 0xd4, 0xdc, 0xe4,
-    0xe4, 0xe4, 0xee, 0xef, 0xef, 0xed, 0xe3, 0xde, 0xc4, 0xa4, 0xc2, 0xc4,
-    0xde, 0xed, 0xed, 0xea, 0xf1, 0xe9, 0xea, 0xf0, 0xed, 0xe5, 0xcb, 0xcb,
-    0xcb, 0xcb, 0xcb, 0xd9, 0xe9, 0xf7, 0xfc, 0xfd, 0xfc, 0xf5, 0xea, 0xdf,
-    0xda, 0xda, 0xda, 0xe5, 0xed, 0xed, 0xed, 0xed, 0xe5, 0xe5, 0xe3, 0xe3,
-    0xde, 0xd4, 0xd3, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xb9, 0x99, 0x7f, 0x7f,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x51, 0x51, 0x51, 0x51, 0x51, 0x59, 0x59, 0x5c,
-    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x75, 0x75, 0x71, 0x71, 0x7c, 0x7c, 0x78, 0x78, 0x89, 0x89,
-    0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x92, 0xa3, 0xa3, 0xa3, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
-    0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc9,
-    0xce, 0xce, 0xce, 0xc3, 0xc3, 0xc3, 0xc1, 0xc1, 0xc1, 0xc3, 0xb1, 0xc3,
-    0xc9, 0xc9, 0xce, 0xc9, 0xb2, 0xc3, 0xc3, 0xc9, 0xc9, 0xc9, 0xc9, 0xe6,
-    0xf2, 0xfa, 0xf8, 0xfd, 0xfe, 0xfb, 0xfb, 0xe9, 0xcb, 0xcb, 0xd9, 0xe9,
-    0xcb, 0xcb, 0xcb, 0xc5, 0xe5, 0xec, 0xde, 0xd4, 0xde, 0xec, 0xf2, 0xec,
-    0xef, 0xf4, 0xf4, 0xef, 0xee, 0xf3, 0xfa, 0xf8, 0xfd, 0xfd, 0xfe, 0xfe,
-    0xff, 0xfe, 0xfe, 0xf6, 0xfb, 0xfb, 0xfb, 0xfb, 0xf6, 0xfb, 0xfe, 0xfe,
-    0xfd, 0xfd, 0xf5, 0xcc, 0xcf, 0xe3, 0xe6, 0xe6, 0xd6, 0x99, 0x50, 0x3e,
-    0x3e, 0x3c, 0x3c, 0x31, 0x35, 0x40, 0x82, 0xc5, 0x9c, 0x56, 0x55, 0x47,
-    0x55, 0x27, 0x27, 0x35, 0x35, 0x47, 0x56, 0x70, 0x83, 0x94, 0x94, 0xa6,
-    0xb9, 0xb9, 0xcf, 0xcf, 0xcf, 0xd4, 0xdc, 0xe4, 0xe4, 0xe4, 0xee, 0xf3,
-    0xf4, 0xed, 0xe3, 0xde, 0xc4, 0x99, 0xaf, 0xc4, 0xde, 0xed, 0xea, 0xea,
-    0xe9, 0xd9, 0xd9, 0xd9, 0xda, 0xc5, 0xa2, 0xa2, 0xcb, 0xd9, 0xea, 0xf0,
-    0xf7, 0xfc, 0xfc, 0xf8, 0xf0, 0xea, 0xdf, 0xa2, 0xc5, 0xda, 0xda, 0xe3,
-    0xe3, 0xe3, 0xe3, 0xde, 0xde, 0xde, 0xd4, 0xd4, 0xd4, 0xcd, 0xb9, 0xb9,
-    0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0x76, 0x76, 0x76, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x53, 0x53, 0x51, 0x51, 0x51, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
-    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x7c, 0x7c, 0x78, 0x89, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90,
-    0x90, 0x90, 0xa3, 0xa3, 0xa3, 0xa3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xce, 0xce, 0xce, 0xce, 0xc3,
-    0xc3, 0xc3, 0xc1, 0xc1, 0xc3, 0xc3, 0xc3, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9,
-    0xc3, 0xc3, 0xc3, 0xc9, 0xc2, 0xd6, 0xec, 0xfa, 0xfd, 0xfd, 0xfe, 0xfe,
-    0xfe, 0xf7, 0xf1, 0xe9, 0xcb, 0xcb, 0xd9, 0xcb, 0xcb, 0xd9, 0xd9, 0xcb,
-    0xda, 0xe5, 0xf4, 0xf5, 0xf5, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc,
-    0xfd, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfb, 0xfb,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xf6, 0xfb, 0xff, 0xfe, 0xfe, 0xf7, 0xf0, 0xee,
-    0xec, 0xec, 0xd6, 0xc4, 0xd6, 0x99, 0x5e, 0x50, 0x47, 0x3c, 0x3c, 0x31,
-    0x35, 0x35, 0x58, 0xda, 0x9c, 0x56, 0x70, 0x47, 0x55, 0x2e, 0x27, 0x2e,
-    0x3a, 0x3a, 0x56, 0x70, 0x70, 0x83, 0x94, 0x94, 0xb9, 0xb9, 0xcf, 0xcf,
-    0xd4, 0xd4, 0xdc, 0xe4, 0xe4, 0xee, 0xef, 0xf4, 0xef, 0xe5, 0xda, 0xd3,
-    0xb9, 0xb9, 0xcd, 0xde, 0xe5, 0xed, 0xea, 0xea, 0xd9, 0xcb, 0xcb, 0xcb,
-    0x9c, 0x9c, 0x77, 0x77, 0xc5, 0xea, 0xf0, 0xf5, 0xfc, 0xf8, 0xf0, 0xdb,
-    0xdb, 0xe5, 0xda, 0xa2, 0xc5, 0xd4, 0xde, 0xde, 0xde, 0xde, 0xde, 0xd4,
-    0xd4, 0xcf, 0xcf, 0xcd, 0xcd, 0xb9, 0xa6, 0xa6, 0x94, 0x99, 0x99, 0x99,
-    0x99, 0x5e, 0x55, 0x5e, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x51, 0x51,
-    0x51, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
-    0x59, 0x59, 0x59, 0x59, 0x59, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x7c, 0x7c, 0x7c,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x90, 0x90, 0x90, 0x90, 0x9f, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
-    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc9, 0xc9, 0xc9, 0xc9,
-    0xc9, 0xc9, 0xc9, 0xce, 0xce, 0xce, 0xce, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc9, 0xc9, 0xc9, 0xc9, 0xce, 0xc2, 0xc9, 0xc9, 0xc9, 0xc2,
-    0xd6, 0xec, 0xfa, 0xfd, 0xff, 0xff, 0xfb, 0xfb, 0xf7, 0xe9, 0xe9, 0xd9,
-    0xd9, 0xcb, 0xcb, 0x9c, 0xcb, 0xc5, 0x9c, 0xcb, 0xd9, 0xe9, 0xe9, 0xfb,
-    0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfb, 0xfb, 0xfb, 0xfe, 0xfc, 0xf9,
-    0xf9, 0xfb, 0xfe, 0xfe, 0xfe, 0xf8, 0xf4, 0xf2, 0xec, 0xc2, 0x8f, 0xc2,
-    0xd6, 0x99, 0x50, 0x3e, 0x3c, 0x3c, 0x31, 0x31, 0x35, 0x2e, 0x35, 0xc5,
-    0x9c, 0x70, 0x55, 0x47, 0x47, 0x35, 0x2e, 0x2a, 0x35, 0x3a, 0x56, 0x70,
-    0x70, 0x83, 0x94, 0x94, 0xa6, 0xb9, 0xcf, 0xd4, 0xd4, 0xd4, 0xdc, 0xe4,
-    0xe4, 0xee, 0xef, 0xef, 0xef, 0xe5, 0xda, 0xc5, 0xc5, 0xc5, 0xda, 0xda,
-    0xe5, 0xe5, 0xd9, 0xd9, 0xcb, 0xcb, 0xcb, 0xcb, 0x9c, 0x77, 0x77, 0x9c,
-    0xda, 0xf0, 0xf5, 0xfc, 0xf8, 0xf5, 0xcb, 0x8c, 0xc5, 0xda, 0xc5, 0xa2,
-    0xcd, 0xcd, 0xcd, 0xd3, 0xd3, 0xd3, 0xd4, 0xcf, 0xb9, 0xb9, 0xb9, 0xb9,
-    0xa6, 0x94, 0x94, 0x83, 0x83, 0x83, 0x70, 0x70, 0x70, 0x55, 0x47, 0x47,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x51, 0x51, 0x51, 0x51, 0x59, 0x59,
-    0x59, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
-    0x59, 0x59, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x8a, 0x89, 0x89, 0x8a, 0x8a,
-    0x89, 0x90, 0x92, 0x92, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xb0, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xb0, 0xb0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9,
-    0xce, 0xce, 0xc9, 0xc9, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc9, 0xc2,
-    0xce, 0xd6, 0xe3, 0xd6, 0xc4, 0xd6, 0xd6, 0xd4, 0xe4, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0xf6, 0xd9, 0xcb, 0xd9, 0xc5, 0x9c, 0x9c, 0xc5, 0x9c,
-    0x9c, 0x9c, 0xcb, 0xcb, 0xcb, 0xe9, 0xf7, 0xfb, 0xfe, 0xfe, 0xfe, 0xff,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xfe, 0xfd, 0xfc, 0xf7, 0xfe, 0xfc, 0xfc, 0xf8, 0xf7, 0xf7, 0xfb, 0xfd,
-    0xfc, 0xfa, 0xf2, 0xd5, 0xaf, 0x92, 0xd5, 0xf2, 0xe6, 0x99, 0x5e, 0x3e,
-    0x3c, 0x3c, 0x3c, 0x31, 0x35, 0x2e, 0x35, 0xa2, 0x9c, 0x58, 0x3a, 0x3c,
-    0x3a, 0x3a, 0x27, 0x2a, 0x35, 0x3a, 0x47, 0x56, 0x56, 0x70, 0x83, 0x94,
-    0xb9, 0xcf, 0xcf, 0xd4, 0xd4, 0xe3, 0xe4, 0xe4, 0xe4, 0xee, 0xed, 0xed,
-    0xe5, 0xda, 0xda, 0xc5, 0xc5, 0xc5, 0xda, 0xda, 0xda, 0xda, 0xcb, 0xcb,
-    0xcb, 0xcb, 0xcb, 0xc5, 0x9c, 0x77, 0xc5, 0xda, 0xf0, 0xf5, 0xf9, 0xf8,
-    0xef, 0xc5, 0x77, 0xa2, 0xc5, 0xc5, 0x9c, 0x83, 0xb9, 0xa6, 0xb9, 0xb9,
-    0xb9, 0xb9, 0xc5, 0xc5, 0xa6, 0xa6, 0xa6, 0xa6, 0x94, 0x94, 0x83, 0x70,
-    0x70, 0x70, 0x70, 0x55, 0x55, 0x3c, 0x3a, 0x35, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x53, 0x53, 0x51, 0x51, 0x51, 0x51, 0x59, 0x59, 0x59, 0x5c, 0x5c, 0x5c,
-    0x5c, 0x5c, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x8a, 0x8a, 0x89, 0x89, 0x8a, 0x91, 0x90, 0x90, 0x92, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xb0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc9, 0xc9, 0xc9, 0xc9,
-    0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9,
-    0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xd5, 0xc4, 0xe3, 0xf2, 0xfa, 0xf4,
-    0xef, 0xed, 0xf4, 0xf4, 0xfd, 0xfe, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xf7,
-    0xe9, 0xd9, 0xcb, 0x77, 0x77, 0x9c, 0x9c, 0x9c, 0x9c, 0xd9, 0xea, 0xe9,
-    0xd9, 0xf1, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xfb, 0xfe, 0xfb, 0xfc, 0xfd, 0xfd, 0xfc, 0xfc,
-    0xfc, 0xf8, 0xf5, 0xed, 0xed, 0xfa, 0xfd, 0xfa, 0xfa, 0xec, 0xd0, 0x9f,
-    0x8d, 0xbc, 0xd0, 0xc2, 0xc2, 0x76, 0x46, 0x3e, 0x47, 0x3c, 0x31, 0x31,
-    0x35, 0x2e, 0x35, 0x77, 0xc5, 0x58, 0x56, 0x47, 0x3a, 0x3a, 0x27, 0x2a,
-    0x2e, 0x35, 0x3a, 0x56, 0x56, 0x70, 0x83, 0x94, 0xb9, 0xcf, 0xcf, 0xd4,
-    0xde, 0xe3, 0xe5, 0xe4, 0xe4, 0xe4, 0xed, 0xe5, 0xda, 0xc5, 0x9c, 0x9c,
-    0x9c, 0x9c, 0xc5, 0xc5, 0xc5, 0xc5, 0xcb, 0xcb, 0xcb, 0xcb, 0xc5, 0x9c,
-    0x9c, 0x9c, 0xe5, 0xf0, 0xf5, 0xf5, 0xf7, 0xea, 0xc5, 0x77, 0x9c, 0xd7,
-    0xa2, 0x58, 0x58, 0x83, 0x94, 0x99, 0x99, 0x99, 0xa6, 0xa6, 0xb9, 0xa6,
-    0x94, 0x94, 0x94, 0x94, 0x83, 0x70, 0x70, 0x55, 0x55, 0x55, 0x56, 0x3a,
-    0x35, 0x2e, 0x27, 0x22, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53,
-    0x51, 0x51, 0x59, 0x59, 0x59, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-    0x5c, 0x5c, 0x59, 0x59, 0x59, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x8a, 0x88, 0x88,
-    0x8a, 0x8a, 0x89, 0x90, 0x92, 0x92, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xb0, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb0, 0xc0, 0xc0, 0xc0,
-    0xc0, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9,
-    0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc3, 0xc3, 0xc9, 0xc9, 0xc9, 0xc9,
-    0xd5, 0xd6, 0xd4, 0xe3, 0xfa, 0xf8, 0xf8, 0xf8, 0xfc, 0xfd, 0xfc, 0xfc,
-    0xfb, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfb, 0xe9, 0xe9,
-    0xd9, 0xe9, 0xd9, 0xcb, 0xcb, 0xcb, 0xd9, 0xcb, 0x8c, 0xe9, 0xfc, 0xfd,
-    0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xfb, 0xf6, 0xf1, 0xf9, 0xfc, 0xfc, 0xf9, 0xf5, 0xf5, 0xef, 0xec, 0xde,
-    0xd6, 0xf2, 0xf2, 0xf2, 0xe8, 0xd0, 0xa7, 0x93, 0x93, 0xb4, 0xb0, 0xc2,
-    0x6d, 0x50, 0x46, 0x3e, 0x3c, 0x3c, 0x31, 0x31, 0x35, 0x35, 0x35, 0x40,
-    0xc5, 0x77, 0x56, 0x55, 0x47, 0x47, 0x22, 0x2a, 0x2a, 0x2e, 0x3a, 0x47,
-    0x58, 0x77, 0x83, 0x94, 0xa6, 0xcd, 0xd4, 0xd4, 0xde, 0xde, 0xde, 0xe3,
-    0xe5, 0xe5, 0xe5, 0xde, 0xcd, 0xa6, 0x83, 0x70, 0x77, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0xcb, 0xcb, 0xc5, 0xc5, 0x9c, 0xda, 0xf0, 0xfc,
-    0xfc, 0xf7, 0xea, 0xdb, 0xa2, 0xc5, 0xdf, 0xda, 0x77, 0x40, 0x58, 0x70,
-    0x76, 0x76, 0x76, 0x76, 0x83, 0x94, 0x94, 0x94, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x56, 0x56, 0x56, 0x3a, 0x3a, 0x35, 0x2a, 0x21, 0x1e, 0x19, 0x19,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x5a, 0x51, 0x51, 0x59, 0x59,
-    0x59, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x59, 0x59,
-    0x59, 0x59, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x75, 0x7c, 0x7c, 0x7c, 0x8a, 0x8a, 0x88, 0x8a, 0x8a, 0x91, 0x90, 0x90,
-    0x92, 0x92, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xb0, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xb0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9,
-    0xc3, 0xc3, 0xc3, 0xc9, 0xce, 0xd1, 0xd1, 0xd6, 0xec, 0xec, 0xf4, 0xfa,
-    0xf8, 0xe9, 0xf7, 0xf7, 0xf7, 0xfb, 0xf1, 0xf7, 0xfb, 0xfb, 0xfb, 0xfe,
-    0xfe, 0xfe, 0xfb, 0xfb, 0xfe, 0xfe, 0xfb, 0xf1, 0xe9, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf0, 0xf0, 0xe5, 0xe5, 0xef, 0xf4, 0xf8, 0xf8, 0xf5, 0xf0, 0xf9,
-    0xfc, 0xf9, 0xfe, 0xfe, 0xfb, 0xfb, 0xfb, 0xfb, 0xfd, 0xfc, 0xf8, 0xf8,
-    0xf0, 0xef, 0xef, 0xed, 0xed, 0xd3, 0xc2, 0x9f, 0xb6, 0xd2, 0xe2, 0xd0,
-    0xbe, 0xa9, 0x93, 0x93, 0xa9, 0xa9, 0xc0, 0x91, 0x4b, 0x50, 0x50, 0x3e,
-    0x3c, 0x3c, 0x3c, 0x31, 0x2e, 0x2e, 0x2e, 0x35, 0xc5, 0x77, 0x56, 0x47,
-    0x31, 0x47, 0x22, 0x2a, 0x2a, 0x2a, 0x35, 0x3a, 0x58, 0x58, 0x83, 0x94,
-    0xa6, 0xcd, 0xd3, 0xd4, 0xde, 0xde, 0xde, 0xde, 0xda, 0xe5, 0xec, 0xde,
-    0xb9, 0xa6, 0x83, 0x56, 0x77, 0x9c, 0x9c, 0x9c, 0x77, 0x77, 0x8c, 0xcb,
-    0xcb, 0xc5, 0xc5, 0xa6, 0x9c, 0xe5, 0xf5, 0xfc, 0xfd, 0xf7, 0xdb, 0xda,
-    0xda, 0xf4, 0xef, 0xc5, 0x58, 0x40, 0x56, 0x56, 0x55, 0x55, 0x70, 0x70,
-    0x70, 0x83, 0x83, 0x70, 0x56, 0x56, 0x56, 0x56, 0x47, 0x3a, 0x40, 0x35,
-    0x2e, 0x2a, 0x21, 0x19, 0x14, 0x14, 0x08, 0x08, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x51, 0x51, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x53, 0x53, 0x53, 0x5a, 0x51, 0x51, 0x59, 0x59, 0x59, 0x59, 0x5c, 0x5c,
-    0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x59, 0x59,
-    0x59, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x75, 0x75, 0x7c, 0x7c, 0x7c, 0x8a,
-    0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x90, 0x92, 0x92, 0x92, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xaf, 0xaf, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xc0, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xce, 0xce,
-    0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xca, 0xc3, 0xc3, 0xc3, 0xd1,
-    0xd1, 0xd6, 0xe0, 0xf4, 0xfa, 0xfd, 0xfd, 0xfd, 0xf1, 0xc6, 0xe9, 0xf1,
-    0xe9, 0xe9, 0xe9, 0xf7, 0xf9, 0xf1, 0xe9, 0xfb, 0xfe, 0xfe, 0xf7, 0xf1,
-    0xfb, 0xfe, 0xf7, 0xf7, 0xfb, 0xfb, 0xfb, 0xfe, 0xfc, 0xf8, 0xf8, 0xef,
-    0xef, 0xf2, 0xf2, 0xf2, 0xf2, 0xe3, 0xe3, 0xf4, 0xfd, 0xfc, 0xfd, 0xfd,
-    0xfd, 0xfc, 0xf9, 0xf5, 0xee, 0xed, 0xed, 0xf2, 0xf2, 0xec, 0xe6, 0xd6,
-    0xc2, 0x9f, 0x8d, 0x93, 0xab, 0xbd, 0xb7, 0xa9, 0xa9, 0xa9, 0x93, 0x93,
-    0xba, 0xa7, 0xd0, 0x65, 0x5f, 0x50, 0x46, 0x3e, 0x3c, 0x3c, 0x31, 0x31,
-    0x35, 0x35, 0x35, 0x2e, 0xc5, 0x9c, 0x56, 0x56, 0x3c, 0x56, 0x2a, 0x21,
-    0x22, 0x27, 0x27, 0x35, 0x40, 0x58, 0x70, 0x83, 0xa6, 0xb9, 0xcd, 0xcd,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xda, 0xe5, 0xed, 0xe3, 0xcd, 0xb9, 0x94, 0x70,
-    0x70, 0x58, 0x58, 0x58, 0x58, 0x77, 0xcb, 0xcb, 0xcb, 0xc5, 0x9c, 0x9c,
-    0xc5, 0xe5, 0xf7, 0xfc, 0xfc, 0xe9, 0xda, 0xe5, 0xed, 0xf4, 0xef, 0x9c,
-    0x3a, 0x47, 0x47, 0x47, 0x3a, 0x47, 0x56, 0x56, 0x56, 0x70, 0x70, 0x55,
-    0x47, 0x3a, 0x40, 0x35, 0x2e, 0x2a, 0x2a, 0x21, 0x1f, 0x19, 0x0f, 0x0c,
-    0x0b, 0x0b, 0x06, 0x06, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x51, 0x51, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53,
-    0x51, 0x51, 0x51, 0x59, 0x59, 0x59, 0x59, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-    0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x59, 0x59, 0x59, 0x59, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71,
-    0x71, 0x71, 0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x8a, 0x8a, 0x8a, 0x8a, 0x91,
-    0x90, 0x90, 0x92, 0x92, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xb0,
-    0xaf, 0xaf, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xc0, 0xc0,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce,
-    0xce, 0xce, 0xce, 0xca, 0xc3, 0xc3, 0xd1, 0xd1, 0xd6, 0xe0, 0xef, 0xfd,
-    0xfd, 0xff, 0xfe, 0xfb, 0xf7, 0xdd, 0xe9, 0xd9, 0xd9, 0xcb, 0xe9, 0xf1,
-    0xf7, 0xf1, 0xf1, 0xfe, 0xfb, 0xf7, 0xf1, 0xe9, 0xf1, 0xf7, 0xf6, 0xfb,
-    0xfb, 0xfb, 0xf7, 0xfc, 0xfc, 0xfa, 0xef, 0xe3, 0xd6, 0xe8, 0xe8, 0xe8,
-    0xd5, 0xc2, 0xc2, 0xec, 0xf4, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf4, 0xed,
-    0xde, 0xd6, 0xd5, 0xd5, 0xd0, 0xc9, 0xb6, 0xa7, 0x93, 0x93, 0x93, 0xa8,
-    0xa8, 0xa8, 0xa8, 0xbd, 0xbd, 0xa8, 0x81, 0xa9, 0xbe, 0xbc, 0xc0, 0x61,
-    0x5f, 0x46, 0x46, 0x3e, 0x3e, 0x3c, 0x31, 0x31, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x77, 0x9c, 0x56, 0x55, 0x47, 0x47, 0x2e, 0x21, 0x22, 0x22, 0x22, 0x2a,
-    0x40, 0x40, 0x56, 0x70, 0x94, 0xa6, 0xb9, 0xb9, 0xb9, 0xcf, 0xcf, 0xd4,
-    0xda, 0xe5, 0xed, 0xe5, 0xde, 0xcd, 0xb9, 0x94, 0x77, 0x58, 0x40, 0x58,
-    0x77, 0x9c, 0xcb, 0xcb, 0xcb, 0x9c, 0x77, 0x77, 0xc5, 0xea, 0xf7, 0xf9,
-    0xf1, 0xdb, 0xc5, 0xe5, 0xef, 0xef, 0xda, 0x47, 0x35, 0x31, 0x31, 0x35,
-    0x35, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3a, 0x35, 0x2e, 0x2a, 0x2a, 0x21,
-    0x1e, 0x1e, 0x19, 0x13, 0x0c, 0x0b, 0x0b, 0x06, 0x06, 0x03, 0x03, 0x03,
-    0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x51, 0x51, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x51, 0x51, 0x51, 0x51,
-    0x59, 0x59, 0x59, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-    0x5c, 0x5c, 0x5c, 0x5c, 0x59, 0x59, 0x59, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x75, 0x75, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x8a, 0x8a, 0x8a, 0x8a, 0x91, 0x91, 0x92, 0x92, 0x92, 0xa3,
-    0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xb0, 0xaf, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xc0, 0xc0, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xca, 0xca, 0xca, 0xca,
-    0xca, 0xca, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce,
-    0xc3, 0xd1, 0xd1, 0xd6, 0xec, 0xfa, 0xfc, 0xfd, 0xff, 0xfe, 0xfe, 0xfe,
-    0xfb, 0xe9, 0xf7, 0xf7, 0xfb, 0xe9, 0xf1, 0xdd, 0xe9, 0xe9, 0xf1, 0xfb,
-    0xf7, 0xfc, 0xd9, 0xcb, 0xf7, 0xf7, 0xf6, 0xf6, 0xf9, 0xf8, 0xf8, 0xfa,
-    0xf2, 0xf2, 0xd5, 0xc9, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xd0,
-    0xe8, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe6, 0xd5, 0xaf, 0x90, 0xa7, 0xb7,
-    0xab, 0xab, 0xab, 0xa8, 0xa8, 0xa8, 0xa8, 0xbd, 0xa8, 0xa8, 0xa8, 0xbd,
-    0xa8, 0xa8, 0x81, 0xba, 0xbe, 0xc0, 0x6b, 0x5f, 0x42, 0x46, 0x3e, 0x3e,
-    0x3c, 0x3c, 0x3c, 0x31, 0x2e, 0x2e, 0x2e, 0x2e, 0x58, 0x9c, 0x55, 0x47,
-    0x31, 0x3a, 0x40, 0x21, 0x1e, 0x20, 0x20, 0x22, 0x2e, 0x40, 0x56, 0x55,
-    0x70, 0x94, 0x94, 0xa6, 0xb9, 0xb9, 0xcf, 0xcf, 0xda, 0xe4, 0xed, 0xed,
-    0xe5, 0xda, 0xda, 0xc5, 0x77, 0x58, 0x58, 0x77, 0x9c, 0xcb, 0xcb, 0xcb,
-    0xcb, 0x77, 0x77, 0x9c, 0xda, 0xf8, 0xfc, 0xf7, 0xdb, 0xc8, 0xda, 0xed,
-    0xf4, 0xdc, 0x70, 0x35, 0x29, 0x23, 0x29, 0x2e, 0x2e, 0x2e, 0x2e, 0x35,
-    0x2e, 0x2e, 0x2a, 0x21, 0x21, 0x1e, 0x19, 0x19, 0x0f, 0x0c, 0x0c, 0x0b,
-    0x06, 0x06, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x4a, 0x4a, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x51, 0x51, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x53, 0x53, 0x53, 0x53, 0x51, 0x51, 0x51, 0x51, 0x51, 0x59, 0x59, 0x59,
-    0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x59, 0x59, 0x5c, 0x5c, 0x5c,
-    0x59, 0x59, 0x59, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x71, 0x71,
-    0x71, 0x71, 0x71, 0x71, 0x75, 0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x8a, 0x8a,
-    0x8a, 0x8a, 0x91, 0x91, 0x92, 0x92, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa3,
-    0xa3, 0xb0, 0xaf, 0xaf, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xca, 0xca, 0xca, 0xce, 0xce, 0xce, 0xce, 0xce,
-    0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xd1, 0xd5, 0xe0, 0xe0,
-    0xf3, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xfb, 0xe9, 0xfb, 0xfb, 0xfb,
-    0xe9, 0xf1, 0xf7, 0xfb, 0xfb, 0xf1, 0xf1, 0xf1, 0xd9, 0xe9, 0xe9, 0xd9,
-    0xf1, 0xf1, 0xf9, 0xf8, 0xfa, 0xf2, 0xec, 0xe6, 0xe8, 0xe2, 0xbe, 0xba,
-    0xba, 0xbd, 0xbd, 0xbd, 0xa8, 0xbd, 0xa8, 0xba, 0xc0, 0xd0, 0xd0, 0xd0,
-    0xe2, 0xe2, 0xc0, 0x97, 0x84, 0x7a, 0x81, 0x8e, 0xa8, 0xa8, 0xa8, 0xbd,
-    0xa8, 0xa8, 0xbd, 0xbd, 0xbd, 0xa8, 0xbd, 0xbd, 0xbd, 0xa8, 0x81, 0xbe,
-    0xc0, 0x6b, 0x5f, 0x5f, 0x50, 0x46, 0x3e, 0x3e, 0x3c, 0x3c, 0x3c, 0x35,
-    0x2e, 0x2e, 0x2a, 0x2a, 0x3a, 0xc5, 0x56, 0x3c, 0x3c, 0x3c, 0x40, 0x21,
-    0x1e, 0x1e, 0x1e, 0x21, 0x2a, 0x35, 0x47, 0x56, 0x70, 0x83, 0x94, 0x94,
-    0xa6, 0xc4, 0xb9, 0xcf, 0xd4, 0xe4, 0xee, 0xef, 0xed, 0xe5, 0xe5, 0xc5,
-    0x9c, 0x77, 0x77, 0x9c, 0x9c, 0xcb, 0xd9, 0xcb, 0x9c, 0x77, 0x77, 0xda,
-    0xf0, 0xf8, 0xfc, 0xf1, 0xdb, 0xdb, 0xef, 0xed, 0xda, 0x70, 0x2e, 0x22,
-    0x20, 0x20, 0x20, 0x20, 0x21, 0x21, 0x24, 0x24, 0x24, 0x1f, 0x1f, 0x1a,
-    0x13, 0x14, 0x0c, 0x0c, 0x0b, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x03, 0x03, 0x03, 0x03, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5c, 0x5c, 0x5c,
-    0x5c, 0x5c, 0x5c, 0x5c, 0x59, 0x59, 0x59, 0x59, 0x5c, 0x5c, 0x5c, 0x5c,
-    0x5c, 0x5c, 0x64, 0x64, 0x64, 0x64, 0x6b, 0x6b, 0x75, 0x75, 0x75, 0x75,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x8a, 0x88, 0x8a, 0x91, 0x92, 0x92,
-    0x92, 0x92, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc9, 0xce, 0xce, 0xce, 0xce, 0xca, 0xce, 0xce, 0xce, 0xce,
-    0xce, 0xce, 0xd1, 0xd1, 0xd5, 0xde, 0xef, 0xfc, 0xfd, 0xfd, 0xfb, 0xfe,
-    0xfd, 0xfd, 0xf7, 0xfc, 0xf7, 0xfe, 0xfe, 0xfb, 0xe9, 0xfe, 0xfb, 0xfb,
-    0xfe, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfe, 0xfc, 0xf8, 0xf8, 0xf8, 0xfa,
-    0xf2, 0xe2, 0xd0, 0xd0, 0xbe, 0xba, 0xba, 0xb7, 0xbd, 0xbd, 0xbd, 0xbd,
-    0xbd, 0xbd, 0xa8, 0x93, 0x93, 0x93, 0x93, 0xab, 0xab, 0xb7, 0xab, 0xa9,
-    0x93, 0x93, 0x93, 0x93, 0x81, 0x93, 0xab, 0xbd, 0xa8, 0xbd, 0xbd, 0xbd,
-    0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xa8, 0x81, 0xa9, 0xa3, 0x61, 0x5e, 0x50,
-    0x46, 0x46, 0x46, 0x3c, 0x3c, 0x3c, 0x35, 0x2e, 0x2e, 0x2e, 0x2a, 0x2a,
-    0x2e, 0xb9, 0x55, 0x50, 0x55, 0x31, 0x56, 0x1e, 0x1f, 0x1f, 0x1f, 0x21,
-    0x27, 0x2e, 0x35, 0x47, 0x56, 0x70, 0x83, 0x94, 0xa6, 0xb9, 0xa6, 0xb9,
-    0xd4, 0xe4, 0xef, 0xef, 0xf3, 0xef, 0xe5, 0xda, 0x9c, 0x9c, 0x9c, 0x9c,
-    0xc5, 0xcb, 0xcb, 0x8c, 0x9c, 0x77, 0xc5, 0xea, 0xf5, 0xf9, 0xf9, 0xf7,
-    0xea, 0xf0, 0xef, 0xc5, 0x40, 0x2a, 0x2a, 0x20, 0x14, 0x14, 0x14, 0x1a,
-    0x1a, 0x16, 0x16, 0x16, 0x16, 0x13, 0x0f, 0x0c, 0x0b, 0x09, 0x09, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x53, 0x5a, 0x53, 0x53, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x59, 0x59, 0x59, 0x59, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-    0x59, 0x59, 0x59, 0x59, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x64, 0x64,
-    0x64, 0x71, 0x6b, 0x75, 0x75, 0x75, 0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x8a, 0x88, 0x8a, 0x8a, 0x91, 0x92, 0x92, 0x92, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xc0, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc9, 0xc3, 0xc3, 0xc3, 0xc9, 0xc9,
-    0xce, 0xce, 0xca, 0xca, 0xca, 0xce, 0xce, 0xce, 0xd1, 0xce, 0xd1, 0xd5,
-    0xe3, 0xfa, 0xfd, 0xfd, 0xff, 0xfb, 0xf6, 0xfc, 0xf7, 0xf9, 0xf7, 0xf1,
-    0xfb, 0xfe, 0xfe, 0xfb, 0xfb, 0xfe, 0xfe, 0xfb, 0xf6, 0xfb, 0xfe, 0xfb,
-    0xfe, 0xfb, 0xfd, 0xfc, 0xfa, 0xf4, 0xe3, 0xd6, 0xc0, 0xb4, 0xa9, 0xa9,
-    0xa9, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0x8e, 0x93, 0x8e, 0xa8, 0x8e, 0x8e, 0x8e, 0xa8, 0x8e, 0x93, 0x81,
-    0x81, 0x81, 0x81, 0x93, 0xa8, 0xa8, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd,
-    0xbd, 0xbd, 0x7a, 0x9e, 0x88, 0x5f, 0x50, 0x46, 0x46, 0x46, 0x46, 0x3c,
-    0x3c, 0x3c, 0x35, 0x35, 0x2e, 0x2a, 0x2a, 0x2a, 0x27, 0x94, 0x55, 0x37,
-    0x46, 0x47, 0x56, 0x21, 0x1f, 0x1f, 0x1a, 0x1e, 0x27, 0x2e, 0x35, 0x3a,
-    0x56, 0x56, 0x55, 0x70, 0x76, 0x99, 0x99, 0xb9, 0xd4, 0xe4, 0xef, 0xf3,
-    0xf5, 0xf3, 0xed, 0xda, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xcb, 0xcb, 0xcb,
-    0x9c, 0xa2, 0xd9, 0xf0, 0xf9, 0xf9, 0xf7, 0xf9, 0xef, 0xe5, 0xc5, 0x40,
-    0x2a, 0x2a, 0x1e, 0x08, 0x08, 0x0f, 0x0c, 0x13, 0x0f, 0x13, 0x0f, 0x0f,
-    0x0c, 0x0c, 0x0b, 0x09, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x4a, 0x4a, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x5a, 0x5a,
-    0x5a, 0x53, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x59, 0x59,
-    0x59, 0x59, 0x59, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x59, 0x59,
-    0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x64, 0x64, 0x6b, 0x6b, 0x75, 0x75,
-    0x75, 0x75, 0x71, 0x71, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x88, 0x8a, 0x8a,
-    0x91, 0x91, 0x92, 0x92, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xb0, 0xaf,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb1, 0xb1, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc9,
-    0xc9, 0xc9, 0xce, 0xc9, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca,
-    0xd1, 0xca, 0xd1, 0xd1, 0xce, 0xd5, 0xd5, 0xe3, 0xf4, 0xfd, 0xff, 0xff,
-    0xff, 0xfb, 0xf9, 0xf9, 0xf1, 0xf1, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfe,
-    0xfe, 0xfe, 0xfe, 0xf9, 0xfb, 0xfb, 0xfe, 0xfd, 0xf9, 0xfc, 0xfa, 0xfa,
-    0xec, 0xd5, 0xb0, 0xb4, 0xa9, 0x93, 0x93, 0xa8, 0xa8, 0x8e, 0x8e, 0x8e,
-    0x8e, 0x7e, 0x7e, 0x7e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e,
-    0x8e, 0x8e, 0xa8, 0xa8, 0xa8, 0x8e, 0x8e, 0x7e, 0x63, 0x68, 0x81, 0x81,
-    0x81, 0x81, 0x93, 0x93, 0xa8, 0xa8, 0xa8, 0xbd, 0xb7, 0xa9, 0x7a, 0x92,
-    0xa4, 0x5f, 0x5e, 0x55, 0x46, 0x46, 0x3c, 0x3c, 0x3c, 0x31, 0x31, 0x2e,
-    0x2e, 0x27, 0x27, 0x27, 0x27, 0x70, 0x83, 0x37, 0x46, 0x46, 0x47, 0x2a,
-    0x1f, 0x1f, 0x1a, 0x1e, 0x27, 0x2e, 0x35, 0x3a, 0x47, 0x55, 0x55, 0x70,
-    0x76, 0x76, 0x94, 0xb9, 0xde, 0xed, 0xf3, 0xf5, 0xf5, 0xf5, 0xef, 0xe5,
-    0xdf, 0xdf, 0xdf, 0xea, 0xea, 0xd9, 0xcb, 0xcb, 0xcb, 0xd9, 0xea, 0xf5,
-    0xfc, 0xf7, 0xf0, 0xf3, 0xda, 0x83, 0x35, 0x27, 0x21, 0x1e, 0x14, 0x14,
-    0x08, 0x0c, 0x0b, 0x0c, 0x0b, 0x0b, 0x0b, 0x09, 0x0b, 0x09, 0x09, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x5a, 0x5a, 0x5a, 0x53, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x59, 0x59, 0x59, 0x59, 0x59,
-    0x5c, 0x5c, 0x5c, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5c, 0x5c, 0x5c, 0x5c,
-    0x5c, 0x64, 0x64, 0x71, 0x6b, 0x75, 0x75, 0x75, 0x75, 0x7c, 0x71, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x8a, 0x88, 0x88, 0x8a, 0x91, 0x91, 0x91, 0x92, 0x92,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xb0, 0xaf, 0xaf, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc9, 0xc3, 0xc3,
-    0xc9, 0xc9, 0xc3, 0xc3, 0xc3, 0xc3, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc3,
-    0xca, 0xc3, 0xc3, 0xc3, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xce, 0xd1,
-    0xd1, 0xd5, 0xe6, 0xf4, 0xfd, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xf8,
-    0xf5, 0xf8, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xf8, 0xf8, 0xf0,
-    0xf8, 0xf8, 0xf5, 0xf4, 0xf4, 0xf4, 0xf2, 0xe6, 0xd0, 0xb4, 0xa9, 0xa8,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x8e, 0x7e, 0x8e, 0x8e,
-    0x8e, 0x93, 0x81, 0x93, 0x93, 0x93, 0x81, 0x68, 0x68, 0x81, 0x81, 0x81,
-    0x95, 0x81, 0x81, 0x81, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x81, 0x81, 0x81, 0x93, 0x93, 0x85, 0x88, 0xc2, 0xc4, 0x5e, 0x47,
-    0x47, 0x46, 0x3e, 0x3c, 0x3c, 0x3c, 0x31, 0x2b, 0x2e, 0x27, 0x27, 0x2a,
-    0x27, 0x47, 0x94, 0x47, 0x46, 0x37, 0x3a, 0x40, 0x19, 0x1f, 0x1f, 0x1e,
-    0x27, 0x2e, 0x35, 0x3a, 0x47, 0x55, 0x55, 0x70, 0x76, 0x76, 0x94, 0xb9,
-    0xe3, 0xee, 0xf3, 0xf5, 0xf8, 0xf5, 0xf3, 0xef, 0xed, 0xed, 0xea, 0xf0,
-    0xea, 0xd9, 0xd9, 0xcb, 0xd9, 0xea, 0xf5, 0xf8, 0xfc, 0xf5, 0xef, 0xd4,
-    0x70, 0x2e, 0x27, 0x22, 0x1e, 0x14, 0x08, 0x0f, 0x0b, 0x0c, 0x0f, 0x09,
-    0x0b, 0x0b, 0x0b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x59, 0x59, 0x59, 0x5c, 0x59, 0x59, 0x59,
-    0x59, 0x59, 0x59, 0x59, 0x5c, 0x5c, 0x59, 0x64, 0x64, 0x64, 0x6b, 0x6b,
-    0x75, 0x75, 0x71, 0x71, 0x71, 0x71, 0x71, 0x7c, 0x7d, 0x7d, 0x88, 0x88,
-    0x88, 0x8a, 0x89, 0x89, 0x90, 0x90, 0x92, 0x92, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xb0, 0xaf, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb1, 0xb1, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc0, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc9, 0xc9,
-    0xc9, 0xc9, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xca, 0xca, 0xc7, 0xc7,
-    0xca, 0xce, 0xce, 0xce, 0xce, 0xd1, 0xc3, 0xd0, 0xe1, 0xd5, 0xec, 0xfa,
-    0xfd, 0xfe, 0xfd, 0xfd, 0xfc, 0xfa, 0xfa, 0xf2, 0xe5, 0xfa, 0xfd, 0xfd,
-    0xfd, 0xfc, 0xfd, 0xfd, 0xfa, 0xfa, 0xef, 0xf2, 0xec, 0xec, 0xec, 0xe6,
-    0xd5, 0xd0, 0xbb, 0xbe, 0xba, 0xa9, 0xab, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
-    0x8e, 0x8e, 0x8e, 0x8e, 0x7e, 0x81, 0x81, 0x81, 0x81, 0x81, 0x68, 0x68,
-    0x6a, 0x6a, 0x5b, 0x4d, 0x4d, 0x4d, 0x5b, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x4d, 0x4d, 0x5b, 0x6a, 0x6a,
-    0x6a, 0x5b, 0x5d, 0x61, 0x7f, 0xc4, 0xd6, 0x99, 0x55, 0x46, 0x47, 0x3c,
-    0x3c, 0x3c, 0x31, 0x2b, 0x2e, 0x27, 0x27, 0x22, 0x2a, 0x3a, 0x56, 0x55,
-    0x37, 0x37, 0x31, 0x40, 0x1e, 0x1f, 0x1a, 0x1e, 0x21, 0x2a, 0x35, 0x3a,
-    0x47, 0x47, 0x55, 0x55, 0x70, 0x70, 0x94, 0xcd, 0xe5, 0xef, 0xf4, 0xf9,
-    0xf9, 0xf9, 0xf5, 0xf0, 0xf5, 0xf5, 0xf0, 0xf1, 0xf1, 0xea, 0xd9, 0xcb,
-    0xea, 0xf5, 0xf9, 0xfc, 0xf5, 0xf4, 0xe3, 0x94, 0x28, 0x22, 0x22, 0x10,
-    0x08, 0x0c, 0x0f, 0x0b, 0x0c, 0x0c, 0x0e, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x09, 0x09, 0x09, 0x09, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x4a, 0x4a, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x53, 0x53, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x53, 0x53, 0x53, 0x53, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5c,
-    0x5c, 0x5c, 0x64, 0x64, 0x64, 0x64, 0x6b, 0x75, 0x75, 0x75, 0x71, 0x71,
-    0x71, 0x71, 0x7c, 0x78, 0x7d, 0x7d, 0x88, 0x88, 0x88, 0x8a, 0x89, 0x89,
-    0x90, 0x90, 0x92, 0xa3, 0xa3, 0xa3, 0xa3, 0xb0, 0xaf, 0xaf, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc0, 0xc0, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc1, 0xc3, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xce, 0xce,
-    0xd1, 0xd1, 0xe1, 0xd5, 0xd6, 0xe3, 0xf3, 0xfd, 0xfd, 0xfc, 0xfa, 0xfa,
-    0xf2, 0xe6, 0xe8, 0xd6, 0xec, 0xf2, 0xfa, 0xfa, 0xf3, 0xed, 0xef, 0xf2,
-    0xf2, 0xe6, 0xd5, 0xc2, 0xaf, 0xaf, 0xaa, 0x9f, 0x9e, 0x9e, 0xa9, 0xa9,
-    0x93, 0x93, 0x93, 0x95, 0x81, 0x81, 0x81, 0x81, 0x68, 0x68, 0x68, 0x4c,
-    0x4c, 0x4c, 0x6f, 0x68, 0x5b, 0x57, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x41,
-    0x41, 0x3d, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x39, 0x39, 0x41, 0x41, 0x39, 0x41, 0x41, 0x41, 0x41, 0x49, 0x5a,
-    0x5f, 0x7f, 0x99, 0xc4, 0xb9, 0x55, 0x47, 0x3c, 0x3c, 0x31, 0x31, 0x2b,
-    0x29, 0x27, 0x27, 0x27, 0x22, 0x27, 0x83, 0x55, 0x34, 0x37, 0x3c, 0x47,
-    0x1e, 0x19, 0x1a, 0x1a, 0x21, 0x2a, 0x35, 0x3a, 0x47, 0x47, 0x47, 0x55,
-    0x5e, 0x70, 0x94, 0xd4, 0xed, 0xef, 0xf5, 0xf9, 0xf9, 0xf9, 0xf5, 0xf5,
-    0xf5, 0xf5, 0xf7, 0xf7, 0xf1, 0xea, 0xd9, 0xd7, 0xea, 0xf8, 0xfc, 0xf8,
-    0xf3, 0xed, 0xcf, 0x34, 0x22, 0x18, 0x10, 0x14, 0x0f, 0x0c, 0x0f, 0x0c,
-    0x0f, 0x0b, 0x0a, 0x0d, 0x0a, 0x0a, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09,
-    0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x59, 0x59,
-    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5c, 0x5c, 0x59, 0x64, 0x64, 0x64,
-    0x6b, 0x6b, 0x75, 0x75, 0x71, 0x71, 0x71, 0x71, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x92, 0x92, 0x92, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb1, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xca, 0xc3, 0xc3, 0xc1, 0xc1, 0xc3,
-    0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xd1, 0xd1, 0xd1, 0xd5, 0xd6, 0xe3,
-    0xfa, 0xfa, 0xfd, 0xfd, 0xfc, 0xfa, 0xf2, 0xe2, 0xe2, 0xd2, 0xd2, 0xd2,
-    0xe2, 0xe8, 0xe8, 0xe8, 0xc9, 0xd0, 0xd5, 0xd5, 0xd0, 0xbb, 0xa7, 0x93,
-    0x93, 0x93, 0xa9, 0x7a, 0x7a, 0x93, 0x96, 0x7a, 0x7a, 0x81, 0x68, 0x4c,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x6a, 0x85, 0x85, 0x85, 0x85, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0xa3, 0xa3, 0x92, 0x92, 0x92, 0x97, 0x92, 0xa3,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x88, 0x88, 0x88, 0x7d, 0x88, 0x87, 0x73,
-    0x67, 0x67, 0x67, 0x49, 0x41, 0x41, 0x43, 0x4a, 0x65, 0x6d, 0x7b, 0x99,
-    0xc4, 0xd3, 0xb9, 0x55, 0x3c, 0x3c, 0x31, 0x2b, 0x29, 0x27, 0x27, 0x21,
-    0x21, 0x22, 0x94, 0x70, 0x37, 0x37, 0x3c, 0x3a, 0x21, 0x19, 0x1f, 0x19,
-    0x1f, 0x2a, 0x2e, 0x3a, 0x3a, 0x3c, 0x47, 0x47, 0x50, 0x70, 0x94, 0xd4,
-    0xee, 0xef, 0xf5, 0xf9, 0xf9, 0xf9, 0xf7, 0xf5, 0xf9, 0xf9, 0xf7, 0xf1,
-    0xea, 0xd9, 0xc5, 0xda, 0xf0, 0xf8, 0xfc, 0xf5, 0xe3, 0xcf, 0x55, 0x23,
-    0x14, 0x0f, 0x14, 0x14, 0x0f, 0x0c, 0x0c, 0x0c, 0x0e, 0x0e, 0x0d, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x09, 0x09, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x59, 0x59, 0x59, 0x59, 0x59,
-    0x59, 0x5c, 0x5c, 0x5c, 0x64, 0x64, 0x64, 0x64, 0x6b, 0x6b, 0x75, 0x75,
-    0x71, 0x71, 0x71, 0x71, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x92, 0x92, 0x92, 0xa3, 0xa3, 0xa3, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xca, 0xc3, 0xc3, 0xc1, 0xc1, 0xc3, 0xca, 0xce, 0xce, 0xc9,
-    0xce, 0xc9, 0xd1, 0xd5, 0xd6, 0xde, 0xee, 0xfa, 0xfd, 0xfd, 0xfd, 0xfc,
-    0xfa, 0xec, 0xd0, 0xba, 0xba, 0xd2, 0xbd, 0xba, 0xba, 0xbe, 0xbe, 0xa7,
-    0xab, 0xab, 0x9e, 0x9e, 0xa9, 0xa9, 0xa9, 0xba, 0xba, 0x93, 0x7a, 0x7a,
-    0x6f, 0x6f, 0x5b, 0x5b, 0x5b, 0x6f, 0x7a, 0x80, 0x97, 0x9b, 0xb1, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc0, 0xc3, 0xc0, 0xc3, 0xc0, 0xc0, 0xbc, 0xb0, 0xbc,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xae, 0xae, 0x97, 0x97, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x88, 0x88, 0x88, 0x88, 0x7d, 0x73, 0x87, 0x75, 0x6b, 0x75, 0x6b,
-    0x6b, 0x6b, 0x4a, 0x4a, 0x61, 0x65, 0x69, 0x69, 0x7f, 0x99, 0xcd, 0xde,
-    0x70, 0x3c, 0x31, 0x2b, 0x27, 0x27, 0x21, 0x21, 0x21, 0x27, 0x56, 0x70,
-    0x37, 0x37, 0x31, 0x3a, 0x35, 0x1e, 0x19, 0x1a, 0x1a, 0x21, 0x2a, 0x35,
-    0x3a, 0x3c, 0x3c, 0x47, 0x50, 0x70, 0xa6, 0xde, 0xee, 0xef, 0xf5, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf7, 0xf1, 0xea, 0xd9, 0xd7, 0xe5,
-    0xf8, 0xf8, 0xf8, 0xed, 0x99, 0x50, 0x2b, 0x18, 0x14, 0x0f, 0x0c, 0x0f,
-    0x0f, 0x0f, 0x0c, 0x0f, 0x09, 0x0e, 0x0d, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x09, 0x09, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06,
-    0x06, 0x06, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x53, 0x53, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x59, 0x59, 0x5c, 0x5c,
-    0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x71, 0x71, 0x75, 0x7c, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x88, 0x88, 0x88, 0x88, 0x88, 0x92,
-    0x92, 0x92, 0x92, 0xa3, 0xa3, 0xa3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb1, 0xb1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca,
-    0xca, 0xc3, 0xc3, 0xca, 0xce, 0xc9, 0xc9, 0xc9, 0xe1, 0xd5, 0xd6, 0xde,
-    0xe4, 0xf4, 0xfd, 0xfc, 0xfd, 0xfd, 0xfc, 0xf8, 0xf2, 0xe1, 0xba, 0xba,
-    0xbd, 0xbd, 0xa8, 0xa8, 0xbd, 0x93, 0x93, 0x8e, 0xa8, 0xa8, 0x93, 0x81,
-    0x81, 0xa9, 0x96, 0x80, 0x6f, 0x5b, 0x4d, 0x5b, 0x6a, 0x85, 0x97, 0xae,
-    0xbc, 0xbc, 0xbc, 0xbc, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xbc, 0xb3, 0xb0, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb1, 0xb1, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x87, 0x87, 0x87, 0x87,
-    0x7d, 0x7d, 0x73, 0x73, 0x6e, 0x6e, 0x6e, 0x6e, 0x60, 0x60, 0x65, 0x61,
-    0x53, 0x5a, 0x53, 0x69, 0x6d, 0x6d, 0x7f, 0xa6, 0xd3, 0xb9, 0x3c, 0x2b,
-    0x2e, 0x27, 0x2a, 0x21, 0x21, 0x22, 0x3a, 0x94, 0x46, 0x34, 0x3c, 0x56,
-    0x40, 0x19, 0x19, 0x1a, 0x1a, 0x1f, 0x21, 0x2a, 0x35, 0x3a, 0x3c, 0x3c,
-    0x55, 0x83, 0xcf, 0xda, 0xef, 0xf3, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xfc, 0xf9, 0xf7, 0xf1, 0xf0, 0xd9, 0xda, 0xf0, 0xf8, 0xf8, 0xf4, 0xde,
-    0x5f, 0x33, 0x20, 0x14, 0x0f, 0x0f, 0x0e, 0x0e, 0x0f, 0x0f, 0x0f, 0x0c,
-    0x0c, 0x0c, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x09, 0x09,
-    0x0a, 0x0a, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x59, 0x5c, 0x5c, 0x64, 0x65, 0x65, 0x6b, 0x6b,
-    0x6b, 0x75, 0x71, 0x71, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x89,
-    0x7d, 0x7d, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x92, 0x92, 0x92, 0x92,
-    0xa3, 0xa3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb1, 0xb1, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc9,
-    0xce, 0xd1, 0xd5, 0xd5, 0xd6, 0xde, 0xec, 0xfa, 0xfd, 0xfd, 0xfd, 0xfd,
-    0xf5, 0xfc, 0xfa, 0xf2, 0xd5, 0xbc, 0xba, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd,
-    0xbd, 0x8e, 0x8e, 0x8e, 0xa8, 0x8e, 0x81, 0x68, 0x5b, 0x6f, 0x6f, 0x6a,
-    0x86, 0x9b, 0xb1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc1, 0xc3, 0xc3, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x87, 0x87, 0x87, 0x87, 0x7d, 0x7d, 0x73, 0x6e,
-    0x6e, 0x6e, 0x6e, 0x60, 0x60, 0x60, 0x61, 0x53, 0x4f, 0x4f, 0x4b, 0x54,
-    0x65, 0x6d, 0x7b, 0x99, 0xa6, 0xb9, 0xb9, 0x47, 0x2e, 0x27, 0x21, 0x2a,
-    0x21, 0x22, 0x35, 0xcf, 0x55, 0x34, 0x47, 0x47, 0x56, 0x1e, 0x1f, 0x1a,
-    0x1a, 0x1a, 0x1e, 0x22, 0x27, 0x2e, 0x35, 0x47, 0x70, 0xa6, 0xda, 0xe5,
-    0xef, 0xf5, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfc, 0xfc, 0xf9, 0xf9, 0xf1,
-    0xf0, 0xea, 0xea, 0xf0, 0xf9, 0xfc, 0xf2, 0x99, 0x4a, 0x25, 0x18, 0x13,
-    0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x09, 0x09, 0x0a, 0x0a, 0x07, 0x07,
-    0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x4b,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x53, 0x53, 0x53, 0x53, 0x51, 0x51, 0x51, 0x51, 0x54, 0x54, 0x54, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x5c, 0x59, 0x64, 0x65, 0x6b, 0x64, 0x71, 0x71, 0x71, 0x75, 0x75,
-    0x7d, 0x7d, 0x7d, 0x78, 0x78, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x88, 0x88, 0x88, 0x92, 0x92, 0x92, 0x92, 0xa3, 0xa3, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xc0, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc9, 0xce, 0xce, 0xce, 0xd1, 0xd5, 0xd6, 0xe0, 0xee,
-    0xfa, 0xfd, 0xfd, 0xf9, 0xfd, 0xfc, 0xfc, 0xfa, 0xfa, 0xf2, 0xe8, 0xc0,
-    0xba, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xa8, 0xa8, 0x93, 0x7a, 0x80, 0x6f,
-    0x5b, 0x5b, 0x85, 0x9d, 0x9d, 0xb1, 0xc3, 0xc3, 0xc1, 0xc1, 0xc1, 0xc1,
-    0xc3, 0xc3, 0xca, 0xc3, 0xca, 0xc3, 0xca, 0xc3, 0xc3, 0xc7, 0xca, 0xca,
-    0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xae, 0xae, 0xae, 0x97, 0x97, 0x9d, 0x9d,
-    0x87, 0x87, 0x87, 0x73, 0x7d, 0x74, 0x73, 0x6e, 0x6e, 0x6d, 0x6d, 0x5f,
-    0x5f, 0x4f, 0x5f, 0x4f, 0x42, 0x42, 0x42, 0x42, 0x5a, 0x5a, 0x69, 0x76,
-    0x76, 0x83, 0x83, 0xa6, 0x83, 0x2e, 0x2e, 0x2a, 0x2a, 0x27, 0x27, 0xb9,
-    0x70, 0x46, 0x3c, 0x3c, 0x47, 0x22, 0x19, 0x1a, 0x1a, 0x1a, 0x1e, 0x20,
-    0x22, 0x2e, 0x3a, 0x70, 0x94, 0xcf, 0xe4, 0xef, 0xf0, 0xf5, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xfc, 0xfc, 0xfc, 0xf9, 0xf5, 0xf1, 0xe9, 0xea, 0xf5,
-    0xfc, 0xfa, 0xd6, 0x6b, 0x38, 0x1d, 0x14, 0x13, 0x0f, 0x0f, 0x0e, 0x0d,
-    0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x09,
-    0x09, 0x09, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x07, 0x06, 0x06,
-    0x06, 0x06, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53,
-    0x51, 0x51, 0x51, 0x51, 0x54, 0x54, 0x54, 0x54, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x59, 0x59, 0x64,
-    0x65, 0x6b, 0x64, 0x71, 0x71, 0x71, 0x75, 0x75, 0x7d, 0x7d, 0x78, 0x78,
-    0x78, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x88, 0x88, 0x88,
-    0x92, 0x92, 0x92, 0x92, 0xa3, 0xa3, 0xa3, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xc0, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc1, 0xc3, 0xc3, 0xc3, 0xc9, 0xd1, 0xd1,
-    0xd1, 0xd6, 0xd6, 0xd4, 0xec, 0xfa, 0xfa, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc,
-    0xfd, 0xfa, 0xf4, 0xec, 0xe6, 0xd0, 0xae, 0xba, 0xba, 0xa8, 0x8e, 0x8e,
-    0xa9, 0x95, 0x80, 0x6f, 0x6f, 0x6c, 0x86, 0x9b, 0xc3, 0xc3, 0xc9, 0xc9,
-    0xc9, 0xc9, 0xc3, 0xc3, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc3, 0xc3, 0xca,
-    0xca, 0xca, 0xca, 0xca, 0xca, 0xc7, 0xc7, 0xc7, 0xca, 0xca, 0xca, 0xca,
-    0xca, 0xca, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb1, 0xae, 0xae, 0x97, 0x97, 0x9d, 0x9d, 0x9d, 0x87, 0x87, 0x73, 0x73,
-    0x74, 0x73, 0x6e, 0x6e, 0x6e, 0x6d, 0x6d, 0x5f, 0x5f, 0x5f, 0x5f, 0x42,
-    0x42, 0x46, 0x3b, 0x42, 0x5f, 0x5f, 0x54, 0x5e, 0x5e, 0x76, 0x76, 0x94,
-    0xcd, 0xcd, 0x3a, 0x2e, 0x2e, 0x27, 0x2e, 0xcf, 0xa6, 0x70, 0x37, 0x3c,
-    0x3c, 0x35, 0x1e, 0x1f, 0x1a, 0x1a, 0x19, 0x20, 0x27, 0x3a, 0x70, 0xa2,
-    0xcf, 0xda, 0xee, 0xf0, 0xf5, 0xf5, 0xf9, 0xf9, 0xfc, 0xfd, 0xfd, 0xfd,
-    0xfc, 0xf9, 0xf8, 0xf5, 0xe9, 0xe9, 0xf1, 0xf8, 0xfc, 0xef, 0x7f, 0x43,
-    0x25, 0x18, 0x14, 0x13, 0x0f, 0x0f, 0x0f, 0x0e, 0x0f, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x09, 0x09, 0x09, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x53, 0x53, 0x53, 0x53,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x51, 0x51, 0x51, 0x51, 0x59, 0x59, 0x59, 0x64, 0x65, 0x64, 0x6b, 0x6b,
-    0x75, 0x75, 0x74, 0x74, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x88, 0x88, 0x88, 0x92, 0x92, 0x92, 0x92,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xb0, 0xae, 0xae, 0xae, 0xb0, 0xc0, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc9, 0xc9, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xd0, 0xc9, 0xd1, 0xd6, 0xe0, 0xec, 0xf3, 0xfa,
-    0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xf7, 0xf8, 0xfa, 0xfa, 0xe6, 0xd5, 0xc0,
-    0xae, 0x93, 0x68, 0x7a, 0x80, 0x6f, 0x6a, 0x5b, 0x6a, 0x85, 0x9b, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xca, 0xca, 0xd1, 0xca, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xca, 0xc7, 0xc7, 0xc1, 0xc1, 0xc7, 0xc7, 0xca, 0xca, 0xca,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xca, 0xca, 0xca, 0xca, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc9, 0xc3, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0x9d, 0x9d, 0x9d, 0x87, 0x87, 0x87, 0x73, 0x73, 0x73, 0x73, 0x6e, 0x6e,
-    0x6e, 0x6e, 0x60, 0x60, 0x5f, 0x4f, 0x4b, 0x42, 0x46, 0x46, 0x46, 0x46,
-    0x3b, 0x42, 0x5e, 0x50, 0x50, 0x54, 0x76, 0x76, 0x7f, 0xb9, 0xd4, 0x56,
-    0x27, 0x2e, 0x70, 0xb9, 0xcf, 0x55, 0x34, 0x34, 0x3c, 0x47, 0x18, 0x19,
-    0x19, 0x19, 0x20, 0x27, 0x3a, 0x70, 0xa2, 0xc5, 0xda, 0xe4, 0xf0, 0xf5,
-    0xf7, 0xf9, 0xf9, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xf9, 0xf5, 0xf0,
-    0xea, 0xea, 0xf8, 0xfa, 0xfa, 0xd6, 0x5f, 0x33, 0x23, 0x14, 0x14, 0x14,
-    0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07,
-    0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53,
-    0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4b, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x51, 0x51, 0x51, 0x51,
-    0x59, 0x59, 0x64, 0x64, 0x64, 0x64, 0x6b, 0x6b, 0x75, 0x75, 0x74, 0x74,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x88, 0x88, 0x88, 0x88, 0x92, 0x92, 0x92, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xb0, 0xae, 0xae, 0xb0, 0xb0, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc9, 0xce, 0xc9, 0xc9, 0xc9, 0xc9, 0xd5, 0xd5,
-    0xd6, 0xe3, 0xf2, 0xfa, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd,
-    0xfa, 0xf4, 0xe3, 0xd6, 0xc2, 0xa4, 0xae, 0x96, 0x80, 0x6f, 0x6f, 0x6f,
-    0x6a, 0x87, 0xb1, 0xc9, 0xc9, 0xc9, 0xd1, 0xd1, 0xce, 0xd1, 0xca, 0xca,
-    0xce, 0xce, 0xce, 0xca, 0xc3, 0xc1, 0xc3, 0xc3, 0xca, 0xca, 0xca, 0xca,
-    0xc7, 0xc1, 0xc1, 0xc1, 0xc7, 0xc7, 0xca, 0xca, 0xca, 0xc3, 0xc3, 0xc3,
-    0xca, 0xca, 0xca, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xb1,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x9d, 0x9d, 0x9d, 0x87,
-    0x87, 0x87, 0x73, 0x73, 0x73, 0x73, 0x6e, 0x6e, 0x6e, 0x6e, 0x60, 0x60,
-    0x60, 0x4f, 0x4f, 0x42, 0x50, 0x46, 0x46, 0x3e, 0x37, 0x34, 0x34, 0x46,
-    0x50, 0x4b, 0x69, 0x54, 0x7b, 0x7b, 0xa6, 0xd4, 0xda, 0xa2, 0xb9, 0xcf,
-    0xd4, 0x47, 0x2c, 0x34, 0x37, 0x47, 0x20, 0x20, 0x1e, 0x2a, 0x35, 0x56,
-    0x83, 0xa6, 0xc5, 0xda, 0xe4, 0xef, 0xf5, 0xf9, 0xf9, 0xf9, 0xfc, 0xfc,
-    0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xf7, 0xf0, 0xea, 0xea, 0xf5, 0xfa, 0xfa,
-    0xe6, 0x7f, 0x42, 0x25, 0x18, 0x14, 0x14, 0x14, 0x0c, 0x0f, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x07, 0x06, 0x06,
-    0x06, 0x06, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x51, 0x51, 0x51, 0x59, 0x59, 0x59, 0x64, 0x64,
-    0x64, 0x6b, 0x6b, 0x6b, 0x74, 0x74, 0x74, 0x74, 0x78, 0x78, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x88, 0x88, 0x88,
-    0x92, 0x92, 0x92, 0x92, 0xa3, 0xa3, 0xa3, 0xb0, 0xb0, 0xae, 0xae, 0xb0,
-    0xc0, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc9, 0xd1, 0xd6, 0xd4, 0xe0, 0xee, 0xfa, 0xfc, 0xfd, 0xfd,
-    0xfd, 0xfd, 0xfd, 0xfc, 0xff, 0xfd, 0xfa, 0xf2, 0xe6, 0xc2, 0xa3, 0x92,
-    0x85, 0x85, 0x85, 0x85, 0x85, 0x9b, 0xb1, 0xc3, 0xca, 0xce, 0xd1, 0xd1,
-    0xce, 0xd1, 0xd1, 0xce, 0xce, 0xd1, 0xca, 0xca, 0xd1, 0xce, 0xce, 0xca,
-    0xca, 0xc3, 0xc3, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc7,
-    0xc7, 0xc7, 0xc7, 0xca, 0xca, 0xca, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb1, 0xae, 0xae, 0xae, 0x9d, 0x9d, 0x9d, 0x87, 0x87, 0x73, 0x73, 0x73,
-    0x74, 0x74, 0x73, 0x73, 0x73, 0x6e, 0x60, 0x60, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x42, 0x42, 0x46, 0x37, 0x3e, 0x31, 0x34, 0x2c, 0x33, 0x4b, 0x53, 0x53,
-    0x61, 0x69, 0x76, 0x94, 0xd4, 0xed, 0xcf, 0xcf, 0xb9, 0x3e, 0x25, 0x33,
-    0x34, 0x3c, 0x31, 0x27, 0x35, 0x40, 0x70, 0x94, 0xcd, 0xd4, 0xe5, 0xed,
-    0xef, 0xf5, 0xf9, 0xf9, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfc,
-    0xf9, 0xf7, 0xea, 0xea, 0xf0, 0xfc, 0xfa, 0xe6, 0x91, 0x4a, 0x34, 0x18,
-    0x14, 0x0f, 0x13, 0x0f, 0x0e, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x05, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x4b, 0x4b, 0x4b,
-    0x54, 0x54, 0x54, 0x45, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x51, 0x51, 0x59, 0x59, 0x59, 0x59, 0x64, 0x64, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x74, 0x74, 0x74, 0x74, 0x78, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x88, 0x88, 0x88, 0x92, 0x92, 0x92, 0xa3,
-    0xa3, 0xa3, 0xb0, 0xb0, 0xb0, 0xae, 0xb0, 0xb0, 0xc0, 0xc0, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc9, 0xc9, 0xd1, 0xd5, 0xd5, 0xd6, 0xde, 0xe0,
-    0xee, 0xf4, 0xfc, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc,
-    0xf9, 0xef, 0xde, 0xc4, 0x87, 0x85, 0x97, 0x96, 0x97, 0xae, 0xc3, 0xc3,
-    0xc3, 0xc9, 0xce, 0xce, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1,
-    0xd1, 0xd1, 0xca, 0xca, 0xd1, 0xce, 0xce, 0xce, 0xca, 0xca, 0xca, 0xca,
-    0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc7, 0xc7, 0xc7, 0xca,
-    0xca, 0xca, 0xca, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xb0, 0xb0, 0xae, 0xb1, 0xb1, 0xb1, 0xb1, 0xae, 0xae, 0xae, 0x97,
-    0x9d, 0x9d, 0x9d, 0x87, 0x87, 0x73, 0x73, 0x73, 0x74, 0x74, 0x73, 0x73,
-    0x73, 0x6e, 0x60, 0x60, 0x4f, 0x4f, 0x4f, 0x4f, 0x42, 0x42, 0x3e, 0x37,
-    0x31, 0x3c, 0x2b, 0x34, 0x34, 0x2c, 0x45, 0x61, 0x4a, 0x4b, 0x5e, 0x55,
-    0x83, 0xcf, 0xb9, 0xcf, 0x83, 0x34, 0x25, 0x33, 0x37, 0x37, 0x70, 0x3a,
-    0x58, 0x83, 0xa2, 0xd4, 0xda, 0xe5, 0xef, 0xef, 0xf5, 0xf9, 0xf9, 0xfc,
-    0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf7, 0xf1, 0xea, 0xed,
-    0xfa, 0xfa, 0xe6, 0xa4, 0x5b, 0x39, 0x23, 0x14, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0e, 0x0f, 0x0c, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07,
-    0x07, 0x07, 0x06, 0x06, 0x06, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x45, 0x45, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x53, 0x53, 0x5a, 0x61,
-    0x61, 0x61, 0x65, 0x64, 0x6b, 0x67, 0x67, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x7d, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x88, 0x88, 0x92, 0x92, 0x92, 0xa3, 0xa3, 0xa3, 0xa3, 0xb0, 0xb0,
-    0xb0, 0xae, 0xbc, 0xbc, 0xbc, 0xbc, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc9,
-    0xd6, 0xd4, 0xe0, 0xee, 0xf9, 0xf9, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
-    0xfd, 0xfd, 0xfd, 0xfd, 0xfa, 0xf3, 0xe4, 0xdc, 0xcf, 0xc4, 0x99, 0xb2,
-    0xc9, 0xca, 0xca, 0xc3, 0xca, 0xca, 0xca, 0xca, 0xce, 0xd1, 0xd1, 0xd1,
-    0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1,
-    0xce, 0xce, 0xce, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca,
-    0xca, 0xca, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xca, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x9d, 0x9d, 0x9d, 0x87, 0x87,
-    0x87, 0x73, 0x73, 0x73, 0x74, 0x74, 0x73, 0x73, 0x6e, 0x60, 0x60, 0x60,
-    0x4f, 0x4f, 0x42, 0x42, 0x42, 0x3b, 0x37, 0x34, 0x31, 0x31, 0x2b, 0x2b,
-    0x2b, 0x2c, 0x33, 0x45, 0x69, 0x4b, 0x4b, 0x5e, 0x76, 0x83, 0xa6, 0x94,
-    0x70, 0x3c, 0x25, 0x33, 0x37, 0x3e, 0x70, 0x83, 0xa6, 0xcf, 0xd4, 0xe4,
-    0xee, 0xf0, 0xf5, 0xf7, 0xf9, 0xfc, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xfc,
-    0xfc, 0xf9, 0xf9, 0xf9, 0xf7, 0xf0, 0xe5, 0xe5, 0xf2, 0xe8, 0xb4, 0x7a,
-    0x4d, 0x30, 0x20, 0x14, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0f, 0x0e, 0x0e,
-    0x0e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06,
-    0x06, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x53, 0x5a, 0x5a, 0x61, 0x61, 0x61, 0x64, 0x64,
-    0x67, 0x67, 0x67, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x7d, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x88, 0x88, 0x92, 0x92,
-    0x92, 0x92, 0xa3, 0xa3, 0xa3, 0xb0, 0xae, 0xae, 0xae, 0xae, 0xbc, 0xbc,
-    0xbc, 0xbc, 0xc1, 0xc3, 0xc3, 0xc9, 0xd5, 0xd6, 0xec, 0xf4, 0xfc, 0xfd,
-    0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xf9, 0xf3, 0xee, 0xe4,
-    0xd8, 0xcf, 0xc4, 0xc4, 0xce, 0xce, 0xca, 0xca, 0xca, 0xca, 0xca, 0xce,
-    0xce, 0xce, 0xce, 0xce, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1,
-    0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xce, 0xce, 0xca, 0xca,
-    0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc7, 0xc7, 0xc1, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb1, 0xb1, 0x9d, 0x9d, 0x9d, 0x9d, 0x87, 0x87, 0x87, 0x73, 0x73, 0x73,
-    0x74, 0x74, 0x73, 0x73, 0x6e, 0x60, 0x60, 0x4f, 0x4f, 0x42, 0x42, 0x42,
-    0x42, 0x3b, 0x37, 0x34, 0x34, 0x31, 0x31, 0x28, 0x28, 0x28, 0x25, 0x2c,
-    0x2c, 0x50, 0x4b, 0x4b, 0x50, 0x5e, 0x76, 0x46, 0x37, 0x31, 0x34, 0x2c,
-    0x37, 0x37, 0x47, 0xcf, 0xd4, 0xe3, 0xe5, 0xef, 0xf5, 0xf7, 0xf9, 0xf9,
-    0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf5, 0xf0, 0xda, 0xe3, 0xd5, 0xa3, 0x81, 0x68, 0x41, 0x25, 0x10, 0x13,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0f, 0x0e, 0x0e, 0x0e, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x53, 0x5a, 0x5a, 0x61, 0x61, 0x65, 0x64, 0x64, 0x67, 0x67, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x7d, 0x7d, 0x88, 0x88, 0x88, 0x92, 0x92, 0x92, 0x92, 0xa3, 0xa3, 0xa3,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xc3,
-    0xc9, 0xc4, 0xe0, 0xf4, 0xfa, 0xfd, 0xfc, 0xfc, 0xf9, 0xfa, 0xfa, 0xf3,
-    0xef, 0xef, 0xee, 0xde, 0xd4, 0xd6, 0xd6, 0xd1, 0xc9, 0xc9, 0xc3, 0xc3,
-    0xb8, 0xb8, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xce, 0xce, 0xd1, 0xd1,
-    0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1,
-    0xd1, 0xd1, 0xd1, 0xd1, 0xce, 0xce, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca,
-    0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc1, 0xc1, 0xc1, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xb1, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x87, 0x87, 0x87, 0x73, 0x73, 0x73, 0x74, 0x74, 0x73, 0x73,
-    0x6e, 0x60, 0x60, 0x4f, 0x4f, 0x42, 0x42, 0x42, 0x3b, 0x37, 0x34, 0x34,
-    0x34, 0x34, 0x31, 0x28, 0x2b, 0x2b, 0x29, 0x29, 0x25, 0x25, 0x37, 0x50,
-    0x54, 0x45, 0x45, 0x38, 0x37, 0x50, 0x46, 0x37, 0x2c, 0x34, 0x3c, 0xa6,
-    0xe3, 0xed, 0xef, 0xf5, 0xf9, 0xf9, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xf9, 0xf9, 0xf9, 0xf9, 0xf0, 0xea, 0xc5, 0xde,
-    0xc9, 0x84, 0x7a, 0x57, 0x30, 0x1d, 0x14, 0x13, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x07,
-    0x06, 0x06, 0x06, 0x06, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x4b, 0x4b, 0x4b, 0x53, 0x5a, 0x5a, 0x61,
-    0x61, 0x65, 0x64, 0x64, 0x67, 0x67, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x7d, 0x88, 0x88, 0x88,
-    0x88, 0x92, 0x92, 0x92, 0xa3, 0xa3, 0xa3, 0xa3, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xc3, 0xce, 0xd6, 0xf4, 0xfa,
-    0xfa, 0xf4, 0xf4, 0xee, 0xec, 0xd4, 0xcf, 0xcf, 0xd6, 0xd6, 0xd6, 0xd6,
-    0xce, 0xc9, 0xc9, 0xc3, 0xc3, 0xc1, 0xc1, 0xc1, 0xca, 0xb8, 0xb8, 0xb8,
-    0xca, 0xca, 0xca, 0xce, 0xce, 0xce, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1,
-    0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1,
-    0xce, 0xce, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca,
-    0xca, 0xca, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc1, 0xc1, 0xc1,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xb1, 0xb3, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x9d, 0x9d, 0x9d, 0x9d, 0x87, 0x87,
-    0x87, 0x73, 0x73, 0x73, 0x74, 0x74, 0x73, 0x73, 0x60, 0x60, 0x4f, 0x4f,
-    0x42, 0x42, 0x42, 0x3b, 0x3e, 0x37, 0x34, 0x34, 0x34, 0x34, 0x34, 0x28,
-    0x29, 0x27, 0x27, 0x2e, 0x29, 0x23, 0x25, 0x46, 0x76, 0x54, 0x45, 0x38,
-    0x38, 0x38, 0x37, 0x38, 0x2c, 0x2c, 0x34, 0x55, 0xec, 0xef, 0xf5, 0xf9,
-    0xfc, 0xfc, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xfc, 0xfc, 0xfc, 0xf9, 0xf0, 0xdb, 0xda, 0xde, 0xaf, 0x84, 0x6a, 0x39,
-    0x1b, 0x10, 0x14, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0e, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x05,
-    0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x45, 0x4b, 0x4b, 0x4b, 0x53, 0x5a, 0x5a, 0x5a, 0x61, 0x64, 0x65, 0x6b,
-    0x67, 0x74, 0x74, 0x74, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x88, 0x88, 0x88, 0x88, 0x92, 0x92, 0x92, 0xa3,
-    0x97, 0x97, 0xae, 0xae, 0xae, 0xae, 0xae, 0xb0, 0xaf, 0xaf, 0xb1, 0xc0,
-    0xbc, 0xbc, 0xbc, 0xc3, 0xc9, 0xe6, 0xf4, 0xec, 0xec, 0xe0, 0xd6, 0xd6,
-    0xc9, 0xc9, 0xd5, 0xc9, 0xc9, 0xc3, 0xc9, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc1, 0xc1, 0xc1, 0xc7, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca,
-    0xca, 0xca, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1,
-    0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xce, 0xce, 0xce, 0xca, 0xca,
-    0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc1, 0xc1, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xb1, 0xb3, 0xb3, 0xb3, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x87, 0x87, 0x87, 0x73, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x60, 0x60, 0x4f, 0x4f, 0x42, 0x42, 0x42, 0x3b,
-    0x37, 0x37, 0x34, 0x34, 0x33, 0x33, 0x2c, 0x2b, 0x29, 0x27, 0x27, 0x2e,
-    0x2e, 0x29, 0x2b, 0x2c, 0x50, 0x99, 0x69, 0x4b, 0x45, 0x33, 0x33, 0x38,
-    0x2c, 0x33, 0x50, 0x3c, 0xcf, 0xf4, 0xf8, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xf8, 0xf8,
-    0xf5, 0xe4, 0xe5, 0xde, 0x90, 0x7a, 0x5d, 0x33, 0x20, 0x14, 0x13, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07,
-    0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x01, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x4b, 0x4b, 0x53,
-    0x53, 0x53, 0x5a, 0x5a, 0x59, 0x64, 0x65, 0x67, 0x67, 0x74, 0x74, 0x74,
-    0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x88,
-    0x88, 0x88, 0x88, 0x92, 0x92, 0x92, 0x92, 0xa3, 0x97, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xb0, 0xaf, 0xaf, 0xb1, 0xc0, 0xbc, 0xbc, 0xbc, 0xc3,
-    0xc9, 0xce, 0xce, 0xce, 0xce, 0xc2, 0xc9, 0xc3, 0xc1, 0xc1, 0xc1, 0xc1,
-    0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc7, 0xb8, 0xca, 0xb8,
-    0xb8, 0xb8, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xd1, 0xd1,
-    0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1,
-    0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca,
-    0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc1, 0xc1, 0xc1, 0xc1, 0xc3, 0xc3, 0xc3, 0xb1, 0xb3, 0xb3, 0xb3, 0xb3,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x87, 0x87, 0x87, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x60,
-    0x60, 0x4f, 0x4f, 0x4f, 0x42, 0x42, 0x3b, 0x3b, 0x37, 0x34, 0x34, 0x34,
-    0x34, 0x2c, 0x2b, 0x2b, 0x29, 0x2e, 0x27, 0x27, 0x2e, 0x35, 0x47, 0x83,
-    0xa6, 0xcd, 0xd3, 0x99, 0x5e, 0x45, 0x33, 0x33, 0x33, 0x33, 0x37, 0x37,
-    0x70, 0xf4, 0xfc, 0xfc, 0xfe, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfd, 0xfd,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0xfc, 0xf8, 0xf8, 0xf5, 0xed, 0xec, 0xd6,
-    0x84, 0x6a, 0x36, 0x25, 0x14, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06,
-    0x06, 0x06, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x45, 0x45, 0x45, 0x45, 0x4b, 0x45, 0x45, 0x45,
-    0x45, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x4b, 0x4b, 0x53, 0x53, 0x5a, 0x5a, 0x61,
-    0x61, 0x65, 0x67, 0x67, 0x74, 0x72, 0x72, 0x72, 0x72, 0x72, 0x74, 0x74,
-    0x74, 0x74, 0x7d, 0x7d, 0x7d, 0x7d, 0x88, 0x88, 0x88, 0x85, 0x85, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xb1, 0xb1, 0xb0, 0xbc, 0xbc, 0xbc, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc0, 0xc0, 0xbc, 0xbc, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1,
-    0xc7, 0xc7, 0xca, 0xca, 0xca, 0xca, 0xca, 0xb8, 0xca, 0xb8, 0xb8, 0xb8,
-    0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1,
-    0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce,
-    0xce, 0xce, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca,
-    0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xb1, 0xb3, 0xb3, 0xb3, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xae, 0xae, 0x97, 0x97, 0x97, 0x97, 0x9d, 0x9d, 0x9d, 0x87, 0x87, 0x87,
-    0x87, 0x73, 0x73, 0x73, 0x73, 0x60, 0x60, 0x60, 0x4f, 0x4f, 0x4f, 0x44,
-    0x42, 0x42, 0x3b, 0x37, 0x37, 0x34, 0x34, 0x34, 0x31, 0x31, 0x2b, 0x29,
-    0x29, 0x29, 0x29, 0x2e, 0x3a, 0x56, 0x94, 0xcf, 0xde, 0xe3, 0xe5, 0xec,
-    0xcd, 0x50, 0x36, 0x36, 0x33, 0x33, 0x2c, 0x46, 0x50, 0xde, 0xf8, 0xfd,
-    0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff,
-    0xfc, 0xf9, 0xf8, 0xf5, 0xe5, 0xe3, 0xd6, 0x91, 0x6a, 0x5b, 0x2c, 0x18,
-    0x14, 0x12, 0x12, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x45, 0x4b, 0x4a, 0x53, 0x53, 0x5a, 0x5a, 0x59, 0x61, 0x67, 0x67, 0x74,
-    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x74, 0x74, 0x74, 0x74, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x88, 0x88, 0x85, 0x85, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xbc, 0xbc,
-    0xbc, 0xbc, 0xc3, 0xc3, 0xc3, 0xc1, 0xbc, 0xbc, 0xba, 0xba, 0xbc, 0xbc,
-    0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc7, 0xc7, 0xc7,
-    0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xca, 0xca, 0xca,
-    0xca, 0xca, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1,
-    0xd1, 0xd1, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xca, 0xca,
-    0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca,
-    0xca, 0xca, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xb1, 0xb3,
-    0xb3, 0xb3, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x9b, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x9d, 0x9d, 0x9d, 0x87, 0x87, 0x87, 0x87, 0x73, 0x73, 0x73,
-    0x60, 0x60, 0x60, 0x4f, 0x4f, 0x4f, 0x44, 0x42, 0x42, 0x3b, 0x3e, 0x37,
-    0x34, 0x34, 0x34, 0x31, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x2b, 0x3c,
-    0x56, 0x82, 0xc5, 0xda, 0xed, 0xef, 0xef, 0xf3, 0xef, 0xd3, 0x6b, 0x4a,
-    0x38, 0x33, 0x2c, 0x38, 0x50, 0x83, 0xf4, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd,
-    0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xf5, 0xf0, 0xe4,
-    0xc5, 0xd3, 0xc2, 0x78, 0x66, 0x39, 0x25, 0x10, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b,
-    0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x07,
-    0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x01, 0x01, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x4b, 0x4a, 0x53,
-    0x53, 0x5a, 0x61, 0x64, 0x65, 0x67, 0x67, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x72, 0x72, 0x74, 0x74, 0x74, 0x7d, 0x85, 0x85, 0x7d, 0x7d, 0x88, 0x88,
-    0x85, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xbc, 0xbc, 0xbc, 0xbc, 0xc0, 0xc3, 0xc3,
-    0xc3, 0xc1, 0xbc, 0xba, 0xba, 0xbc, 0xbc, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1,
-    0xc7, 0xc7, 0xc7, 0xc7, 0xb8, 0xca, 0xca, 0xca, 0xca, 0xca, 0xd1, 0xd1,
-    0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce,
-    0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca,
-    0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb1, 0xb1,
-    0xb1, 0x9b, 0x9b, 0x9b, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x9d, 0x9d,
-    0x9d, 0x87, 0x88, 0x88, 0x7d, 0x7d, 0x74, 0x67, 0x60, 0x60, 0x4f, 0x4f,
-    0x44, 0x44, 0x44, 0x42, 0x42, 0x3b, 0x37, 0x34, 0x34, 0x34, 0x34, 0x31,
-    0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x31, 0x47, 0x83, 0xc5, 0xdc, 0xee,
-    0xf0, 0xf5, 0xf7, 0xf5, 0xf4, 0xf4, 0xc4, 0x65, 0x4b, 0x33, 0x2c, 0x33,
-    0x50, 0x46, 0xda, 0xf8, 0xfd, 0xfd, 0xfe, 0xfd, 0xfc, 0xfc, 0xfd, 0xfd,
-    0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xf7, 0xf0, 0xdf, 0xc5, 0xd6, 0xbb, 0x6a,
-    0x4a, 0x2c, 0x18, 0x14, 0x0f, 0x0f, 0x0f, 0x0c, 0x0e, 0x0e, 0x0f, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x4b, 0x4b, 0x4a, 0x53, 0x53, 0x5a, 0x59, 0x64,
-    0x67, 0x67, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x74, 0x74,
-    0x74, 0x7d, 0x85, 0x85, 0x7d, 0x7d, 0x88, 0x85, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xbc, 0xbc, 0xbc, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xbc, 0xbc,
-    0xbc, 0xbc, 0xbc, 0xc1, 0xc3, 0xc3, 0xc3, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1,
-    0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc7, 0xc7, 0xc7, 0xc7,
-    0xb8, 0xca, 0xca, 0xca, 0xca, 0xca, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1,
-    0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce,
-    0xce, 0xce, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca,
-    0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xb8, 0xb8, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xb1, 0xb1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb1, 0xb1, 0x9b, 0x9b, 0x9b, 0x9b,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x9d, 0x9d, 0x87, 0x87, 0x88, 0x7d,
-    0x7d, 0x74, 0x67, 0x73, 0x60, 0x4f, 0x4f, 0x44, 0x44, 0x44, 0x42, 0x42,
-    0x3b, 0x3b, 0x34, 0x34, 0x34, 0x34, 0x2c, 0x2b, 0x2b, 0x2b, 0x29, 0x29,
-    0x29, 0x2b, 0x3c, 0x56, 0xc5, 0xda, 0xee, 0xf5, 0xf9, 0xf9, 0xfb, 0xf9,
-    0xf8, 0xfa, 0xf2, 0x99, 0x54, 0x45, 0x33, 0x38, 0x38, 0x50, 0x83, 0xf4,
-    0xfc, 0xfd, 0xfe, 0xfe, 0xfd, 0xfd, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xf9, 0xf0, 0xe4, 0xd4, 0xd5, 0xb4, 0x6a, 0x36, 0x25, 0x10, 0x14,
-    0x14, 0x14, 0x0f, 0x0f, 0x0e, 0x0e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0d, 0x0d,
-    0x0d, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x4a, 0x4a, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x4b, 0x4b, 0x53, 0x53, 0x5a, 0x5a, 0x61, 0x65, 0x67, 0x67, 0x66, 0x72,
-    0x72, 0x72, 0x72, 0x72, 0x74, 0x74, 0x74, 0x74, 0x85, 0x85, 0x7d, 0x7d,
-    0x85, 0x85, 0x85, 0x85, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xbc, 0xbc, 0xc0,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbf, 0xbf,
-    0xbc, 0xbc, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1,
-    0xc1, 0xc1, 0xc1, 0xb3, 0xc7, 0xc7, 0xc7, 0xc7, 0xb8, 0xb8, 0xca, 0xca,
-    0xca, 0xca, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce,
-    0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xca, 0xca,
-    0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb1, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x9d, 0x9d, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x74, 0x67, 0x60,
-    0x4f, 0x4f, 0x4f, 0x44, 0x44, 0x44, 0x42, 0x3b, 0x3b, 0x37, 0x34, 0x34,
-    0x34, 0x31, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x2b, 0x47, 0xa2,
-    0xda, 0xe7, 0xf0, 0xf7, 0xf9, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfc, 0xed,
-    0x69, 0x4a, 0x38, 0x33, 0x33, 0x46, 0x50, 0xb9, 0xf8, 0xfd, 0xfe, 0xfe,
-    0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf0, 0xef,
-    0xec, 0xd5, 0x9e, 0x57, 0x2c, 0x18, 0x14, 0x0f, 0x14, 0x14, 0x14, 0x0c,
-    0x0e, 0x0e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x07, 0x07, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x01, 0x01, 0x01, 0x01, 0x4a, 0x4a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x4b, 0x4a, 0x53, 0x53,
-    0x5a, 0x5a, 0x61, 0x65, 0x67, 0x67, 0x66, 0x72, 0x72, 0x72, 0x72, 0x72,
-    0x74, 0x74, 0x74, 0x74, 0x85, 0x85, 0x7d, 0x7d, 0x85, 0x85, 0x85, 0x85,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xbc, 0xae, 0xbc, 0xbc, 0xc0, 0xc3, 0xc1, 0xbc, 0xbc,
-    0xbc, 0xbc, 0xc1, 0xc1, 0xc1, 0xbc, 0xbf, 0xbf, 0xba, 0xba, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc3, 0xb1,
-    0xc7, 0xc7, 0xc7, 0xc7, 0xb8, 0xb8, 0xca, 0xca, 0xca, 0xca, 0xce, 0xce,
-    0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce,
-    0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca,
-    0xca, 0xca, 0xca, 0xca, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x9b, 0x9b,
-    0x9b, 0x9b, 0x9b, 0x9b, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x9d, 0x87,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x74, 0x67, 0x67, 0x60, 0x4f, 0x4f, 0x44, 0x44,
-    0x44, 0x3b, 0x3b, 0x3b, 0x37, 0x34, 0x34, 0x34, 0x31, 0x2b, 0x2b, 0x28,
-    0x29, 0x29, 0x29, 0x29, 0x29, 0x31, 0x56, 0xc5, 0xe5, 0xef, 0xf5, 0xf9,
-    0xf9, 0xfb, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfc, 0xde, 0x69, 0x4b, 0x38,
-    0x33, 0x38, 0x45, 0x50, 0xed, 0xfc, 0xfd, 0xfe, 0xfd, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf5, 0xef, 0xe6, 0xc9, 0x84, 0x41,
-    0x25, 0x14, 0x0f, 0x0f, 0x14, 0x14, 0x14, 0x0c, 0x0e, 0x0e, 0x0c, 0x0c,
-    0x0e, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x45, 0x45, 0x45, 0x45, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x4a, 0x4a, 0x4a, 0x53, 0x5a, 0x5a, 0x61, 0x65,
-    0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x72, 0x74, 0x74, 0x85, 0x85,
-    0x74, 0x7d, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xbc,
-    0xae, 0xae, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xba, 0xbc, 0xbc, 0xc3, 0xc3,
-    0xc1, 0xc1, 0xbf, 0xbf, 0xba, 0xbc, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1,
-    0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3,
-    0xb1, 0xb1, 0xb8, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xce,
-    0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce,
-    0xc9, 0xc9, 0xc3, 0xc3, 0xca, 0xca, 0xca, 0xca, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b,
-    0x97, 0x97, 0x97, 0x97, 0x85, 0x85, 0x87, 0x87, 0x7d, 0x7d, 0x7d, 0x74,
-    0x74, 0x67, 0x60, 0x60, 0x4f, 0x44, 0x44, 0x44, 0x44, 0x3b, 0x3b, 0x3b,
-    0x34, 0x34, 0x34, 0x34, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x25,
-    0x29, 0x3c, 0x83, 0xc5, 0xe4, 0xf0, 0xf7, 0xf9, 0xfc, 0xfb, 0xfb, 0xfb,
-    0xfc, 0xfc, 0xfd, 0xfc, 0xfa, 0xa6, 0x4b, 0x38, 0x2c, 0x2c, 0x33, 0x46,
-    0x94, 0xfa, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xfa, 0xec, 0xc2, 0x88, 0x67, 0x30, 0x20, 0x14, 0x0f, 0x0f,
-    0x0c, 0x14, 0x0c, 0x0c, 0x0e, 0x0e, 0x0c, 0x0c, 0x0d, 0x0d, 0x0d, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x4b, 0x4b, 0x54, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x4a, 0x4a, 0x4a, 0x53, 0x5a, 0x5a, 0x61, 0x5d, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x67, 0x74, 0x85, 0x85, 0x74, 0x7d, 0x85, 0x85,
-    0x85, 0x85, 0x85, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc,
-    0xba, 0xba, 0xba, 0xba, 0xbc, 0xbc, 0xc1, 0xc3, 0xc1, 0xc1, 0xbf, 0xbf,
-    0xbc, 0xbc, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1,
-    0xc1, 0xc1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb1, 0xb1, 0xb8, 0xb8,
-    0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xce, 0xce, 0xce, 0xce,
-    0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xc9, 0xc9, 0xc3, 0xc3,
-    0xca, 0xca, 0xca, 0xca, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb1, 0x9d, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x97, 0x97, 0x97, 0x85,
-    0x85, 0x85, 0x87, 0x87, 0x7d, 0x7d, 0x74, 0x74, 0x67, 0x67, 0x60, 0x4f,
-    0x4f, 0x44, 0x44, 0x44, 0x3b, 0x3b, 0x3b, 0x3b, 0x34, 0x34, 0x34, 0x2c,
-    0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x29, 0x25, 0x31, 0x55, 0xa6, 0xda,
-    0xe4, 0xf0, 0xf5, 0xf9, 0xf9, 0xfb, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfd,
-    0xfc, 0xef, 0x76, 0x38, 0x33, 0x2c, 0x2c, 0x46, 0x50, 0xd4, 0xfc, 0xfd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xf2, 0xd5,
-    0x7d, 0x85, 0x5d, 0x2c, 0x18, 0x14, 0x0e, 0x0e, 0x0c, 0x0c, 0x0c, 0x0f,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0d, 0x0d, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x00, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x4a, 0x4a, 0x4a, 0x53,
-    0x53, 0x5a, 0x61, 0x5d, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x67, 0x74, 0x85, 0x85, 0x7d, 0x7d, 0x85, 0x85, 0x85, 0x85, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xbc, 0xae, 0xb1, 0xb1, 0xb3, 0xbc, 0xba, 0xba, 0xbc, 0xbc,
-    0xbc, 0xbc, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xbf, 0xbf, 0xbf,
-    0xc1, 0xc1, 0xc1, 0xc1, 0xc7, 0xc7, 0xc1, 0xc1, 0xc1, 0xb3, 0xb3, 0xb3,
-    0xb3, 0xb3, 0xb3, 0xb3, 0xb1, 0xb1, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xca,
-    0xca, 0xca, 0xca, 0xca, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce,
-    0xce, 0xce, 0xc9, 0xc9, 0xc9, 0xc9, 0xc3, 0xc3, 0xca, 0xca, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x9d, 0x9d, 0x9b, 0x9b,
-    0x9b, 0x9b, 0x9b, 0x9b, 0x97, 0x97, 0x97, 0x85, 0x87, 0x87, 0x87, 0x73,
-    0x7d, 0x74, 0x74, 0x67, 0x73, 0x60, 0x4f, 0x4f, 0x44, 0x44, 0x44, 0x44,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x34, 0x33, 0x2c, 0x2c, 0x2b, 0x2b, 0x29, 0x29,
-    0x29, 0x29, 0x29, 0x31, 0x55, 0xa6, 0xcf, 0xda, 0xe5, 0xf0, 0xf5, 0xf7,
-    0xf9, 0xf9, 0xf9, 0xf6, 0xfb, 0xfb, 0xfe, 0xfe, 0xfc, 0xfa, 0xd3, 0x69,
-    0x43, 0x30, 0x33, 0x38, 0x46, 0x70, 0xef, 0xfd, 0xfd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xfc, 0xfa, 0xf2, 0xc0, 0x85, 0x85, 0x41, 0x25,
-    0x10, 0x14, 0x0e, 0x0e, 0x0e, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0d, 0x0d, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x54,
-    0x54, 0x54, 0x54, 0x54, 0x54, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x4b, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x5d, 0x5d, 0x5d,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x6a, 0x85, 0x85,
-    0x7d, 0x85, 0x85, 0x85, 0x85, 0x85, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xbc, 0xbc, 0xbc,
-    0xb1, 0xb1, 0xb3, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xc1, 0xc1,
-    0xc1, 0xc1, 0xc1, 0xc1, 0xbf, 0xbf, 0xbf, 0xbf, 0xc1, 0xc1, 0xc1, 0xc1,
-    0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3,
-    0xb1, 0xb1, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xca, 0xce,
-    0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xc9, 0xc9,
-    0xc9, 0xc9, 0xc9, 0xc3, 0xca, 0xca, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb1, 0xb1, 0x9d, 0x9d, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b,
-    0x97, 0x97, 0x97, 0x85, 0x87, 0x87, 0x87, 0x73, 0x74, 0x74, 0x74, 0x67,
-    0x73, 0x60, 0x4f, 0x4f, 0x44, 0x44, 0x44, 0x44, 0x3b, 0x3b, 0x3b, 0x34,
-    0x33, 0x2c, 0x2c, 0x2c, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x2b, 0x31, 0x55,
-    0x94, 0xcd, 0xd4, 0xda, 0xe4, 0xf0, 0xf0, 0xf7, 0xf1, 0xf1, 0xf1, 0xf7,
-    0xf6, 0xfb, 0xfe, 0xfe, 0xfe, 0xf8, 0xef, 0x99, 0x54, 0x38, 0x33, 0x33,
-    0x38, 0x34, 0xb9, 0xfa, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfc,
-    0xfa, 0xfa, 0xe8, 0xae, 0x7a, 0x6a, 0x30, 0x1d, 0x10, 0x14, 0x0f, 0x0e,
-    0x0e, 0x0e, 0x0e, 0x0e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0d, 0x0a, 0x0b, 0x0b,
-    0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x4b,
-    0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x5a, 0x5d, 0x5d, 0x5d, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x67, 0x67, 0x6a, 0x6a, 0x74, 0x85, 0x85, 0x85, 0x85, 0x85,
-    0x85, 0x85, 0x97, 0x97, 0x97, 0x96, 0x97, 0x97, 0x97, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc,
-    0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1,
-    0xc1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9,
-    0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xc9,
-    0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc3,
-    0xc9, 0xc3, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xae, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x9d, 0x9d, 0x85, 0x85,
-    0x85, 0x85, 0x85, 0x85, 0x74, 0x74, 0x67, 0x67, 0x60, 0x4f, 0x4f, 0x4f,
-    0x44, 0x44, 0x44, 0x3b, 0x3b, 0x3b, 0x33, 0x33, 0x2c, 0x2c, 0x2c, 0x2b,
-    0x28, 0x28, 0x28, 0x28, 0x28, 0x2b, 0x47, 0x76, 0x99, 0xb9, 0xd3, 0xda,
-    0xea, 0xf0, 0xe9, 0xf1, 0xe9, 0xe9, 0xe9, 0xf1, 0xf1, 0xf9, 0xfb, 0xfb,
-    0xfe, 0xfc, 0xf4, 0xe5, 0x76, 0x54, 0x33, 0x2c, 0x38, 0x46, 0x50, 0xe3,
-    0xf8, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xf4, 0xf2, 0xf2, 0xf2, 0xd0, 0x9e,
-    0x84, 0x5d, 0x2c, 0x18, 0x14, 0x0f, 0x0c, 0x0f, 0x0e, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07,
-    0x07, 0x07, 0x07, 0x06, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05,
-    0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x00, 0x00, 0x00, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x4b, 0x4a, 0x4a, 0x4a, 0x53,
-    0x53, 0x5a, 0x5d, 0x5d, 0x5d, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67,
-    0x6a, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x97, 0x96,
-    0x96, 0x96, 0x97, 0x97, 0x97, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc,
-    0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xc1, 0xc1, 0xc1, 0xc1, 0xb3, 0xb3, 0xb3, 0xb3,
-    0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xc9, 0xc9, 0xc9, 0xc9, 0xce, 0xce, 0xce, 0xce,
-    0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xc9, 0xc9, 0xc9, 0xc9,
-    0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x9d, 0x9d, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
-    0x74, 0x74, 0x67, 0x5d, 0x60, 0x4f, 0x4f, 0x4f, 0x44, 0x44, 0x3b, 0x3b,
-    0x3b, 0x33, 0x33, 0x34, 0x2c, 0x2c, 0x2b, 0x29, 0x28, 0x28, 0x28, 0x28,
-    0x28, 0x3c, 0x5e, 0x99, 0x99, 0x99, 0xb9, 0xda, 0xe5, 0xea, 0xea, 0xea,
-    0xea, 0xd9, 0xd9, 0xea, 0xf1, 0xf7, 0xfb, 0xfb, 0xfb, 0xf9, 0xf8, 0xf4,
-    0xcd, 0x76, 0x38, 0x26, 0x2c, 0x38, 0x45, 0x83, 0xed, 0xf5, 0xf8, 0xfa,
-    0xf2, 0xe6, 0xd6, 0xe1, 0xe8, 0xe2, 0xb6, 0x84, 0x6a, 0x53, 0x2b, 0x18,
-    0x14, 0x0f, 0x0c, 0x0c, 0x0e, 0x0c, 0x0e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06,
-    0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4b, 0x4b, 0x4b, 0x4b, 0x53, 0x53, 0x53, 0x4a,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x4b, 0x4a, 0x4a, 0x4a, 0x53, 0x5a, 0x5a, 0x5d, 0x5d,
-    0x5d, 0x67, 0x66, 0x66, 0x67, 0x67, 0x6a, 0x6a, 0x6a, 0x85, 0x85, 0x85,
-    0x85, 0x85, 0x85, 0x85, 0x85, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x97, 0x97, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xbc, 0xbc,
-    0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba,
-    0xba, 0xba, 0xba, 0xba, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xc1, 0xc1, 0xc1, 0xc1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x9b,
-    0x9b, 0xb3, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce,
-    0xce, 0xce, 0xce, 0xce, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb1, 0x9d, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x87, 0x87, 0x85, 0x85, 0x85, 0x85, 0x7d, 0x74, 0x74, 0x67, 0x67, 0x5d,
-    0x5d, 0x53, 0x4f, 0x44, 0x44, 0x44, 0x3b, 0x3b, 0x3b, 0x33, 0x33, 0x2c,
-    0x2c, 0x2c, 0x2b, 0x29, 0x28, 0x28, 0x28, 0x28, 0x2b, 0x46, 0x5e, 0x99,
-    0x99, 0x99, 0xa6, 0xd3, 0xe5, 0xda, 0xd7, 0xd7, 0xda, 0xc5, 0xda, 0xea,
-    0xe9, 0xf7, 0xfb, 0xfb, 0xfb, 0xf9, 0xf5, 0xfa, 0xef, 0x94, 0x46, 0x2c,
-    0x2c, 0x33, 0x38, 0x46, 0xb9, 0xef, 0xf2, 0xf2, 0xe8, 0xc0, 0xae, 0xb4,
-    0xc0, 0xaa, 0x89, 0x72, 0x72, 0x54, 0x31, 0x22, 0x14, 0x0f, 0x0c, 0x0c,
-    0x0e, 0x0e, 0x0d, 0x0d, 0x0c, 0x0c, 0x0c, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x4b,
-    0x4a, 0x4a, 0x53, 0x53, 0x5a, 0x5a, 0x5d, 0x5d, 0x5d, 0x5d, 0x66, 0x66,
-    0x67, 0x67, 0x6a, 0x6a, 0x6a, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
-    0x85, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0xae, 0xae,
-    0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc,
-    0xbc, 0xbc, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xc1, 0xc1, 0xc1, 0xc1,
-    0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x9b, 0x9b, 0x9b, 0x9b, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb8, 0xb8, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x9d, 0x9d,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x85, 0x87, 0x87, 0x85, 0x85,
-    0x85, 0x85, 0x74, 0x74, 0x74, 0x67, 0x5d, 0x60, 0x53, 0x53, 0x4f, 0x44,
-    0x44, 0x44, 0x3b, 0x3b, 0x33, 0x33, 0x34, 0x2c, 0x2c, 0x2c, 0x29, 0x29,
-    0x28, 0x28, 0x28, 0x28, 0x2c, 0x46, 0x5e, 0x76, 0x99, 0x99, 0xa6, 0xd3,
-    0xd3, 0xc5, 0x9c, 0x9c, 0xc5, 0xc5, 0xc5, 0xd9, 0xe9, 0xf6, 0xfb, 0xfb,
-    0xfb, 0xf7, 0xf5, 0xf8, 0xfa, 0xde, 0x5e, 0x38, 0x2c, 0x2c, 0x33, 0x37,
-    0x55, 0xd3, 0xe6, 0xe2, 0xbc, 0x93, 0x93, 0x7a, 0x78, 0x72, 0x64, 0x75,
-    0x7b, 0x76, 0x47, 0x27, 0x19, 0x0f, 0x0c, 0x0c, 0x0e, 0x0e, 0x0d, 0x0d,
-    0x0c, 0x0c, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x4b, 0x4a, 0x4a, 0x53, 0x53,
-    0x53, 0x5a, 0x5d, 0x5d, 0x66, 0x66, 0x66, 0x66, 0x67, 0x6a, 0x6a, 0x6a,
-    0x6a, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac,
-    0xac, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba,
-    0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xc1, 0xc1, 0xc1, 0xc1, 0xb3, 0xb3, 0xb3, 0xb3,
-    0xb3, 0xb3, 0x9b, 0x9b, 0x9b, 0x9b, 0xb3, 0xb3, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb8, 0xce, 0xce, 0xce,
-    0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x9d, 0x9d, 0x9d, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x85, 0x85, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x74, 0x74,
-    0x67, 0x67, 0x5d, 0x5d, 0x53, 0x4f, 0x4f, 0x44, 0x44, 0x3b, 0x3b, 0x33,
-    0x33, 0x33, 0x2c, 0x2c, 0x2c, 0x2c, 0x29, 0x28, 0x28, 0x28, 0x28, 0x28,
-    0x25, 0x3e, 0x50, 0x76, 0x76, 0x76, 0x94, 0xcd, 0xcd, 0xb9, 0xc5, 0xc5,
-    0xd7, 0xcb, 0xd9, 0xea, 0xf1, 0xf7, 0xfb, 0xfb, 0xf9, 0xf7, 0xf0, 0xf5,
-    0xfa, 0xf4, 0xcd, 0x4b, 0x30, 0x26, 0x2c, 0x38, 0x46, 0x7b, 0xc0, 0x9e,
-    0x7a, 0x7a, 0x6a, 0x5d, 0x43, 0x33, 0x38, 0x54, 0x76, 0x76, 0x55, 0x35,
-    0x1e, 0x0f, 0x0c, 0x0c, 0x0c, 0x0e, 0x0d, 0x0a, 0x0c, 0x0c, 0x0b, 0x0b,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x53, 0x4b, 0x4b, 0x4b, 0x4b, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x5a, 0x5d, 0x5d,
-    0x66, 0x66, 0x66, 0x66, 0x6a, 0x6a, 0x6a, 0x6a, 0x85, 0x85, 0x85, 0x85,
-    0x85, 0x85, 0x85, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xba, 0xba,
-    0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba,
-    0xba, 0xba, 0xba, 0xba, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xc1, 0xc1, 0xc1, 0xc1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x9b, 0x9b, 0x9b,
-    0x9b, 0x9b, 0x9b, 0xb3, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2,
-    0xb1, 0xb2, 0xb2, 0xb2, 0xb8, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce,
-    0xce, 0xce, 0xce, 0xce, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1,
-    0xb1, 0x9d, 0x9d, 0x9d, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x85, 0x85,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x74, 0x74, 0x67, 0x67, 0x67, 0x5d, 0x5a,
-    0x4f, 0x4f, 0x44, 0x44, 0x3b, 0x3b, 0x33, 0x33, 0x33, 0x33, 0x2c, 0x2c,
-    0x2c, 0x2b, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x2b, 0x34, 0x3c, 0x47,
-    0x55, 0x70, 0x83, 0xb9, 0xcd, 0xc5, 0xd7, 0xda, 0xd9, 0xd9, 0xea, 0xea,
-    0xf0, 0xf7, 0xf7, 0xf9, 0xf9, 0xf1, 0xf0, 0xf5, 0xfa, 0xfa, 0xe6, 0x6b,
-    0x48, 0x2f, 0x2c, 0x38, 0x45, 0x43, 0x78, 0x6a, 0x4d, 0x41, 0x30, 0x2c,
-    0x25, 0x23, 0x25, 0x3c, 0x76, 0x94, 0x70, 0x40, 0x21, 0x14, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0a, 0x0a, 0x0c, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x05,
-    0x07, 0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4b, 0x45, 0x4b, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x43, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x5a, 0x5d, 0x5d, 0x66, 0x66, 0x66, 0x66,
-    0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x85, 0x85, 0x85, 0x85, 0x85, 0x80, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0xac, 0xac,
-    0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba,
-    0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xc1, 0xc1,
-    0xb3, 0xb3, 0xb3, 0xb3, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0xb1,
-    0xb1, 0xb1, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x92, 0x88, 0x88, 0x88, 0x7d, 0x7d, 0x7d, 0x74,
-    0x74, 0x74, 0x67, 0x67, 0x5d, 0x5d, 0x5a, 0x4f, 0x4f, 0x4f, 0x44, 0x44,
-    0x3b, 0x3b, 0x33, 0x33, 0x33, 0x33, 0x2c, 0x2c, 0x2c, 0x2b, 0x28, 0x28,
-    0x28, 0x28, 0x28, 0x28, 0x29, 0x2b, 0x31, 0x31, 0x31, 0x55, 0x94, 0xcd,
-    0xd4, 0xda, 0xe4, 0xea, 0xe9, 0xe9, 0xe9, 0xea, 0xea, 0xf0, 0xf7, 0xf9,
-    0xf9, 0xf8, 0xf8, 0xf4, 0xf2, 0xe8, 0xd0, 0x9e, 0x57, 0x41, 0x26, 0x33,
-    0x38, 0x36, 0x53, 0x5a, 0x30, 0x25, 0x20, 0x18, 0x19, 0x19, 0x18, 0x2a,
-    0x58, 0x9c, 0x77, 0x58, 0x2a, 0x19, 0x0f, 0x0c, 0x0c, 0x0c, 0x0a, 0x0d,
-    0x0a, 0x0a, 0x09, 0x09, 0x0a, 0x0a, 0x07, 0x07, 0x07, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x43, 0x4a, 0x4a, 0x4a, 0x4a, 0x53,
-    0x53, 0x5a, 0x5d, 0x5d, 0x66, 0x66, 0x66, 0x6a, 0x6a, 0x6a, 0x6a, 0x85,
-    0x85, 0x85, 0x85, 0x85, 0x85, 0x80, 0x80, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac,
-    0xac, 0xac, 0xac, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba,
-    0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xc1, 0xc1, 0xb3, 0xb3, 0xb3, 0xb3,
-    0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xc9,
-    0xc9, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x87,
-    0x88, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x74, 0x74, 0x74, 0x74, 0x67, 0x5d,
-    0x5d, 0x5a, 0x4f, 0x4f, 0x4f, 0x44, 0x44, 0x3b, 0x3b, 0x3b, 0x33, 0x33,
-    0x33, 0x33, 0x2c, 0x2c, 0x2b, 0x29, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-    0x23, 0x29, 0x27, 0x2e, 0x31, 0x70, 0xa6, 0xd3, 0xe5, 0xe5, 0xf0, 0xf1,
-    0xe9, 0xe9, 0xe9, 0xea, 0xdf, 0xea, 0xf0, 0xf8, 0xf8, 0xfa, 0xf4, 0xf2,
-    0xe8, 0xc0, 0x9e, 0xa7, 0x8d, 0x48, 0x36, 0x33, 0x30, 0x30, 0x38, 0x4b,
-    0x25, 0x18, 0x19, 0x19, 0x13, 0x13, 0x19, 0x21, 0x40, 0x82, 0x9c, 0x58,
-    0x35, 0x19, 0x0f, 0x0f, 0x0c, 0x0c, 0x0a, 0x0d, 0x0a, 0x0a, 0x09, 0x09,
-    0x0a, 0x07, 0x07, 0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x4a, 0x4a, 0x43, 0x43, 0x43, 0x43, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x43, 0x43, 0x43, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x5d, 0x5d,
-    0x66, 0x66, 0x66, 0x6a, 0x6a, 0x6a, 0x6a, 0x85, 0x85, 0x85, 0x85, 0x85,
-    0x85, 0x80, 0x80, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac,
-    0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba,
-    0xba, 0xba, 0xba, 0xba, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xb5, 0xb3, 0xb3, 0xb3, 0xb3, 0xae, 0x9b, 0x9b, 0x9b,
-    0x9b, 0x9b, 0x9b, 0x9b, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x92, 0x92, 0x92, 0x92, 0x88, 0x88, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x74, 0x74, 0x67, 0x67, 0x5d, 0x5d, 0x53, 0x53, 0x4a, 0x4a,
-    0x44, 0x44, 0x3b, 0x3b, 0x3b, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2c, 0x2c,
-    0x2b, 0x29, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x22, 0x27, 0x27, 0x29,
-    0x31, 0x70, 0xcf, 0xde, 0xed, 0xef, 0xf5, 0xf1, 0xf1, 0xe9, 0xea, 0xdf,
-    0xe4, 0xf3, 0xfa, 0xf4, 0xf2, 0xf2, 0xe6, 0xd0, 0xae, 0x84, 0x84, 0x6a,
-    0x90, 0x67, 0x41, 0x36, 0x30, 0x2c, 0x33, 0x46, 0x3c, 0x18, 0x14, 0x19,
-    0x14, 0x19, 0x14, 0x19, 0x35, 0x77, 0xa2, 0x77, 0x40, 0x24, 0x0f, 0x0c,
-    0x0e, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x09, 0x09, 0x0a, 0x07, 0x07, 0x07,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x4a, 0x43, 0x43,
-    0x43, 0x43, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x45, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x43, 0x43, 0x43, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x5d, 0x5d, 0x66, 0x66, 0x66, 0x6a,
-    0x6a, 0x6a, 0x6a, 0x85, 0x85, 0x85, 0x85, 0x85, 0x80, 0x80, 0x80, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0xac, 0xac,
-    0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xba, 0xba, 0xba,
-    0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xb5,
-    0xb3, 0xb3, 0xb3, 0xb3, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0x98, 0x98, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x92, 0x92,
-    0x88, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x74, 0x74, 0x74, 0x74, 0x67,
-    0x67, 0x5d, 0x5d, 0x53, 0x4a, 0x4a, 0x43, 0x43, 0x44, 0x44, 0x3b, 0x3b,
-    0x3b, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2c, 0x2c, 0x2c, 0x29, 0x28, 0x28,
-    0x28, 0x28, 0x28, 0x28, 0x27, 0x27, 0x22, 0x29, 0x31, 0x83, 0xd4, 0xe5,
-    0xed, 0xf0, 0xf7, 0xf1, 0xf1, 0xe9, 0xf0, 0xef, 0xf4, 0xef, 0xf2, 0xf2,
-    0xe6, 0xd0, 0xb0, 0xa3, 0x84, 0x6a, 0x66, 0x41, 0x36, 0x65, 0x61, 0x36,
-    0x33, 0x2c, 0x25, 0x34, 0x3c, 0x2e, 0x19, 0x19, 0x14, 0x14, 0x14, 0x19,
-    0x2a, 0x58, 0xa2, 0x8c, 0x40, 0x2a, 0x13, 0x0c, 0x0c, 0x0b, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x09, 0x09, 0x07, 0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4a, 0x4a, 0x4a, 0x4a, 0x53,
-    0x53, 0x53, 0x5d, 0x5d, 0x66, 0x66, 0x66, 0x6a, 0x6a, 0x6a, 0x6a, 0x85,
-    0x85, 0x85, 0x85, 0x85, 0x80, 0x80, 0x80, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0xac, 0xac, 0xac, 0xac, 0xac,
-    0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba,
-    0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xb5, 0xb5, 0xb5, 0xb3, 0x9b,
-    0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x9d, 0x9d, 0xa3, 0xa3, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x88, 0x88, 0x88, 0x88, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x74, 0x74, 0x74, 0x74, 0x74, 0x67, 0x67, 0x5d, 0x5d, 0x53, 0x4a,
-    0x4a, 0x43, 0x44, 0x44, 0x42, 0x3b, 0x3b, 0x3b, 0x3b, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x2c, 0x2c, 0x2c, 0x29, 0x28, 0x28, 0x28, 0x28, 0x29, 0x29,
-    0x23, 0x23, 0x23, 0x29, 0x3c, 0x94, 0xd4, 0xe4, 0xf0, 0xf7, 0xf6, 0xfb,
-    0xf6, 0xf1, 0xf5, 0xf4, 0xf2, 0xe6, 0xe8, 0xd0, 0xc0, 0x97, 0x85, 0x6a,
-    0x49, 0x43, 0x33, 0x25, 0x1d, 0x37, 0x7b, 0x36, 0x2c, 0x33, 0x2c, 0x33,
-    0x37, 0x3c, 0x22, 0x10, 0x19, 0x14, 0x14, 0x14, 0x21, 0x40, 0x8c, 0x8c,
-    0x58, 0x2e, 0x1a, 0x0c, 0x0b, 0x0b, 0x0a, 0x0d, 0x0a, 0x0a, 0x09, 0x09,
-    0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x43, 0x43, 0x43, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x5d, 0x5d,
-    0x66, 0x66, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x85, 0x85, 0x85, 0x85, 0x85,
-    0x80, 0x80, 0x80, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac,
-    0xac, 0xac, 0xac, 0xac, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba,
-    0xba, 0xba, 0xba, 0xba, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xb5, 0xb5, 0xb5, 0xb3, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b,
-    0x9b, 0x9b, 0x9b, 0x9b, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0xb2, 0xb2, 0xb2, 0xb2, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x9d, 0x9d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x74, 0x74, 0x74, 0x74, 0x67,
-    0x67, 0x67, 0x67, 0x5d, 0x5d, 0x5a, 0x53, 0x4a, 0x4a, 0x43, 0x44, 0x44,
-    0x42, 0x3b, 0x3b, 0x3b, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2c, 0x2c,
-    0x2c, 0x25, 0x28, 0x28, 0x28, 0x28, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
-    0x3e, 0x94, 0xda, 0xe4, 0xf0, 0xf9, 0xfb, 0xfb, 0xfc, 0xfc, 0xf8, 0xf4,
-    0xe6, 0xd0, 0xbb, 0x8d, 0x85, 0x6a, 0x49, 0x36, 0x30, 0x25, 0x23, 0x20,
-    0x20, 0x23, 0x5e, 0x50, 0x2c, 0x33, 0x33, 0x33, 0x33, 0x37, 0x3c, 0x18,
-    0x14, 0x14, 0x13, 0x14, 0x19, 0x40, 0x82, 0x8c, 0x77, 0x35, 0x19, 0x0c,
-    0x0c, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x09, 0x09, 0x07, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x43, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x45, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x5d, 0x5d, 0x66, 0x66, 0x6a, 0x6a,
-    0x6a, 0x6a, 0x6a, 0x85, 0x85, 0x85, 0x85, 0x85, 0x80, 0x80, 0x80, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac,
-    0xac, 0xac, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x87,
-    0x87, 0x87, 0x87, 0x87, 0x87, 0x98, 0x98, 0x98, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x88, 0x88, 0x88, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x74, 0x74, 0x74, 0x74, 0x74, 0x67, 0x67, 0x67, 0x67, 0x5d, 0x61,
-    0x5a, 0x53, 0x53, 0x4a, 0x4a, 0x44, 0x44, 0x44, 0x42, 0x3b, 0x3b, 0x3b,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2c, 0x2c, 0x2c, 0x25, 0x28, 0x28,
-    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x2b, 0x47, 0xa2, 0xdf, 0xf0,
-    0xf9, 0xfc, 0xfd, 0xfd, 0xfd, 0xfc, 0xfa, 0xf2, 0xd0, 0x8d, 0x6a, 0x66,
-    0x4a, 0x38, 0x2c, 0x25, 0x20, 0x20, 0x20, 0x20, 0x1e, 0x1e, 0x27, 0x55,
-    0x46, 0x33, 0x2c, 0x2c, 0x2c, 0x34, 0x46, 0x29, 0x14, 0x0f, 0x12, 0x12,
-    0x1a, 0x2a, 0x58, 0x9c, 0x77, 0x40, 0x1f, 0x0f, 0x0c, 0x0b, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x09, 0x09, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x43, 0x43, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x53, 0x53, 0x5d, 0x5d, 0x66, 0x66, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x85,
-    0x85, 0x85, 0x85, 0x85, 0x80, 0x80, 0x80, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0xac, 0xac, 0xac,
-    0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xba,
-    0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x87, 0x98, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
-    0x87, 0x87, 0x87, 0x87, 0x88, 0x88, 0x92, 0x92, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x5d, 0x61, 0x5a, 0x5a, 0x53, 0x4a, 0x4a,
-    0x4f, 0x44, 0x44, 0x44, 0x42, 0x3b, 0x3b, 0x3b, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x2c, 0x2c, 0x2c, 0x25, 0x29, 0x28, 0x29, 0x29, 0x29, 0x29,
-    0x23, 0x29, 0x29, 0x31, 0x56, 0xc5, 0xe4, 0xf5, 0xfc, 0xfd, 0xfd, 0xfa,
-    0xfa, 0xfa, 0xec, 0xd6, 0x8a, 0x5d, 0x41, 0x30, 0x2c, 0x25, 0x20, 0x20,
-    0x18, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x35, 0x5e, 0x45, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x34, 0x3c, 0x21, 0x13, 0x0d, 0x12, 0x13, 0x21, 0x58, 0x9c,
-    0x77, 0x40, 0x24, 0x0f, 0x0c, 0x0b, 0x0a, 0x0a, 0x0a, 0x07, 0x09, 0x06,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01,
-    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4b, 0x4b, 0x45, 0x45, 0x45, 0x45, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x5d, 0x5d,
-    0x5d, 0x66, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x85, 0x85, 0x85, 0x85, 0x85,
-    0x80, 0x80, 0x80, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac,
-    0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xba, 0xba, 0xba, 0xba,
-    0xba, 0xba, 0xba, 0xba, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0x9b, 0x9b, 0x9b, 0x9b,
-    0x9b, 0x9b, 0x9b, 0x9b, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x98, 0x98, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
-    0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
-    0x87, 0x87, 0x88, 0x88, 0x88, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x74, 0x74, 0x74, 0x74, 0x74, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x65, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x4a, 0x4a, 0x4f, 0x44, 0x42, 0x42,
-    0x42, 0x3b, 0x3b, 0x3b, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2c, 0x2c,
-    0x2c, 0x25, 0x25, 0x29, 0x29, 0x29, 0x29, 0x29, 0x27, 0x27, 0x2b, 0x35,
-    0xa2, 0xdc, 0xf0, 0xf8, 0xfc, 0xfa, 0xf4, 0xec, 0xe6, 0xd5, 0xc2, 0x69,
-    0x45, 0x37, 0x2b, 0x23, 0x23, 0x20, 0x20, 0x17, 0x16, 0x16, 0x1f, 0x1e,
-    0x20, 0x19, 0x1f, 0x20, 0x46, 0x50, 0x3c, 0x2c, 0x2c, 0x2c, 0x2c, 0x3c,
-    0x2a, 0x16, 0x12, 0x0f, 0x14, 0x1e, 0x40, 0x77, 0x77, 0x58, 0x2a, 0x13,
-    0x0c, 0x0b, 0x0a, 0x0a, 0x07, 0x07, 0x06, 0x06, 0x06, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4b, 0x45, 0x45,
-    0x45, 0x45, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x5d, 0x5d, 0x5d, 0x66, 0x6a, 0x5b,
-    0x6a, 0x6a, 0x6a, 0x85, 0x85, 0x85, 0x85, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac,
-    0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xba, 0xba, 0xba, 0xba, 0xba,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x86, 0x86,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
-    0x73, 0x87, 0x73, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x7d,
-    0x87, 0x7d, 0x87, 0x7d, 0x7d, 0x7d, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x65, 0x61, 0x5a, 0x5a,
-    0x5a, 0x53, 0x4a, 0x4a, 0x4f, 0x44, 0x42, 0x42, 0x42, 0x3b, 0x3b, 0x3b,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x2c, 0x2c, 0x2c, 0x2c, 0x25, 0x25, 0x29,
-    0x29, 0x29, 0x29, 0x29, 0x27, 0x27, 0x35, 0x56, 0xcc, 0xef, 0xf8, 0xfc,
-    0xfa, 0xf2, 0xe3, 0xc2, 0x8f, 0x6b, 0x4a, 0x38, 0x2b, 0x22, 0x20, 0x20,
-    0x20, 0x20, 0x1e, 0x16, 0x16, 0x16, 0x1a, 0x1e, 0x1e, 0x19, 0x1f, 0x1e,
-    0x23, 0x47, 0x3c, 0x29, 0x25, 0x25, 0x25, 0x2b, 0x2a, 0x19, 0x13, 0x14,
-    0x14, 0x19, 0x32, 0x77, 0x77, 0x58, 0x2e, 0x1a, 0x0c, 0x0b, 0x0a, 0x07,
-    0x07, 0x05, 0x05, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x48, 0x48, 0x5d, 0x5d, 0x5d, 0x66, 0x5b, 0x5b, 0x6a, 0x6a, 0x6a, 0x6a,
-    0x85, 0x80, 0x80, 0x7a, 0x80, 0x80, 0x80, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x95, 0x95, 0x95, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac,
-    0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xba, 0xba, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xb5, 0xb5, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0x96, 0x96,
-    0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x97, 0x97, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
-    0x87, 0x87, 0x87, 0x87, 0x6e, 0x6e, 0x6e, 0x87, 0x6e, 0x7c, 0x6e, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x74, 0x75, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x67, 0x67, 0x6b, 0x6b,
-    0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x4a,
-    0x44, 0x44, 0x42, 0x42, 0x3b, 0x3b, 0x38, 0x33, 0x33, 0x33, 0x33, 0x34,
-    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x29, 0x29, 0x28, 0x28, 0x28, 0x28,
-    0x28, 0x2e, 0x3c, 0xa6, 0xe7, 0xf5, 0xfc, 0xfc, 0xf2, 0xd6, 0x8f, 0x6b,
-    0x4a, 0x38, 0x33, 0x25, 0x22, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x17, 0x17,
-    0x1f, 0x16, 0x16, 0x16, 0x17, 0x17, 0x16, 0x1e, 0x18, 0x2e, 0x3a, 0x29,
-    0x23, 0x1d, 0x25, 0x2b, 0x2e, 0x2e, 0x14, 0x14, 0x14, 0x14, 0x2a, 0x58,
-    0x77, 0x58, 0x35, 0x1f, 0x0c, 0x0c, 0x06, 0x07, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x4a, 0x4a, 0x4a, 0x4a, 0x48, 0x48, 0x5d, 0x5d,
-    0x5d, 0x66, 0x5b, 0x5b, 0x6a, 0x6a, 0x6a, 0x6a, 0x6f, 0x80, 0x7a, 0x7a,
-    0x80, 0x80, 0x80, 0x80, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x95, 0x95, 0x95,
-    0x96, 0x96, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac,
-    0xac, 0xac, 0xac, 0xba, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xac, 0xac, 0xac, 0xac, 0xac, 0x96, 0x96, 0x96, 0x9b, 0x9b, 0x9b, 0x9b,
-    0x9b, 0x86, 0x86, 0x86, 0x85, 0x97, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x6e, 0x6e, 0x6e,
-    0x6e, 0x6e, 0x6e, 0x6e, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x67, 0x67, 0x67, 0x67, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61,
-    0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x4a, 0x44, 0x44, 0x42, 0x3b,
-    0x3b, 0x3b, 0x38, 0x33, 0x33, 0x33, 0x33, 0x34, 0x2c, 0x2c, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x29, 0x29, 0x27, 0x28, 0x28, 0x28, 0x28, 0x2e, 0x70, 0xdc,
-    0xf5, 0xfc, 0xf8, 0xf4, 0xe6, 0x8f, 0x5a, 0x43, 0x38, 0x2c, 0x25, 0x23,
-    0x20, 0x1e, 0x1e, 0x1e, 0x17, 0x17, 0x17, 0x1e, 0x17, 0x17, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x17, 0x18, 0x22, 0x2e, 0x2e, 0x23, 0x23, 0x25, 0x25,
-    0x2b, 0x2e, 0x2a, 0x14, 0x0f, 0x14, 0x21, 0x40, 0x77, 0x58, 0x40, 0x21,
-    0x0c, 0x0b, 0x06, 0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06,
-    0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x61, 0x61, 0x61, 0x61,
-    0x64, 0x59, 0x59, 0x59, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x48, 0x48, 0x49, 0x5d, 0x5d, 0x66, 0x67, 0x5b,
-    0x6a, 0x6a, 0x6a, 0x6a, 0x6f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac,
-    0xba, 0xba, 0xba, 0xba, 0xb5, 0xb5, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac,
-    0x96, 0x96, 0x96, 0x96, 0x9b, 0x9b, 0x97, 0x97, 0x85, 0x85, 0x85, 0x85,
-    0x85, 0x97, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x92, 0x88, 0x87, 0x87,
-    0x87, 0x87, 0x87, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
-    0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x67,
-    0x6b, 0x6b, 0x65, 0x65, 0x61, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x53, 0x53, 0x53, 0x4a, 0x44, 0x44, 0x42, 0x3b, 0x38, 0x38, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x25, 0x29, 0x2b,
-    0x29, 0x29, 0x28, 0x28, 0x2b, 0x56, 0xd7, 0xf5, 0xfc, 0xfa, 0xfa, 0xe6,
-    0xaf, 0x65, 0x43, 0x34, 0x2b, 0x23, 0x23, 0x23, 0x20, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x1e, 0x1e, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x17,
-    0x19, 0x18, 0x22, 0x35, 0x2e, 0x29, 0x23, 0x25, 0x29, 0x2e, 0x35, 0x1f,
-    0x0c, 0x14, 0x1e, 0x40, 0x58, 0x58, 0x40, 0x21, 0x0c, 0x0b, 0x07, 0x07,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x03, 0x05, 0x05, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x53, 0x53, 0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a,
-    0x61, 0x61, 0x61, 0x61, 0x61, 0x65, 0x65, 0x65, 0x64, 0x64, 0x64, 0x64,
-    0x61, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4a, 0x4a, 0x4a,
-    0x48, 0x48, 0x49, 0x48, 0x5d, 0x66, 0x67, 0x5b, 0x6a, 0x6a, 0x6a, 0x6a,
-    0x6f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0xac, 0xac,
-    0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xba, 0xba, 0xba,
-    0xb5, 0xb5, 0xac, 0xac, 0xac, 0xac, 0xac, 0x96, 0x96, 0x96, 0x96, 0x97,
-    0x9b, 0x9b, 0x97, 0x97, 0x85, 0x85, 0x85, 0x85, 0x97, 0x97, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x88, 0x88, 0x87, 0x87, 0x87, 0x6e, 0x6e, 0x6e,
-    0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x75, 0x75, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x67, 0x6b, 0x65, 0x65, 0x61,
-    0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x4a,
-    0x44, 0x44, 0x42, 0x3b, 0x38, 0x38, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2c,
-    0x2b, 0x2c, 0x2c, 0x2c, 0x25, 0x2c, 0x2b, 0x29, 0x29, 0x29, 0x28, 0x28,
-    0x47, 0xc5, 0xf0, 0xfc, 0xfc, 0xfa, 0xe6, 0xc9, 0x67, 0x4a, 0x38, 0x2b,
-    0x23, 0x20, 0x20, 0x20, 0x1e, 0x17, 0x17, 0x17, 0x17, 0x1e, 0x1e, 0x17,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x1e, 0x19, 0x19, 0x2a,
-    0x3a, 0x2e, 0x2b, 0x29, 0x23, 0x22, 0x2a, 0x2a, 0x14, 0x14, 0x19, 0x2e,
-    0x58, 0x58, 0x40, 0x24, 0x0f, 0x0b, 0x07, 0x06, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x03, 0x03, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x4a, 0x53, 0x53, 0x53, 0x5a, 0x61, 0x61, 0x61, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x61, 0x61,
-    0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4a, 0x4a, 0x48, 0x48, 0x49, 0x48,
-    0x5d, 0x66, 0x5d, 0x5b, 0x6a, 0x6a, 0x6a, 0x85, 0x6f, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0xac, 0xac, 0xac, 0xac,
-    0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac,
-    0xac, 0xac, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x85,
-    0x85, 0x85, 0x85, 0x85, 0x97, 0x97, 0x9d, 0x9d, 0x9d, 0x9d, 0x92, 0x88,
-    0x88, 0x88, 0x87, 0x87, 0x6e, 0x73, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
-    0x6e, 0x6e, 0x6e, 0x6e, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x74, 0x74, 0x75, 0x75,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x60, 0x60, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4f, 0x4f, 0x42, 0x42, 0x38, 0x38,
-    0x38, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x2c, 0x2b, 0x2c, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x29, 0x29, 0x29, 0x29, 0x29, 0x31, 0xa6, 0xee, 0xf8, 0xfc,
-    0xfa, 0xec, 0xc9, 0x78, 0x5d, 0x43, 0x33, 0x23, 0x20, 0x20, 0x17, 0x16,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x1e, 0x17, 0x17, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x1a, 0x19, 0x19, 0x19, 0x2a, 0x27, 0x2e, 0x29,
-    0x23, 0x20, 0x22, 0x21, 0x1f, 0x14, 0x19, 0x2a, 0x58, 0x58, 0x40, 0x2a,
-    0x13, 0x0b, 0x07, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x02, 0x05, 0x07, 0x07,
-    0x0a, 0x0a, 0x09, 0x03, 0x01, 0x00, 0x00, 0x00, 0x53, 0x53, 0x53, 0x5a,
-    0x61, 0x61, 0x65, 0x65, 0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x61, 0x61, 0x61, 0x61, 0x5a,
-    0x5a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x4a, 0x48, 0x48, 0x49, 0x49, 0x5d, 0x5d, 0x5d, 0x5b,
-    0x6a, 0x6a, 0x6a, 0x6a, 0x6f, 0x6f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac,
-    0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0x96, 0x96, 0x96,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
-    0x85, 0x85, 0x87, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x7d, 0x87, 0x6e,
-    0x73, 0x73, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x74, 0x74, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x60, 0x60, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x4f, 0x4f, 0x42, 0x42, 0x38, 0x38, 0x38, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x34, 0x2c, 0x2b, 0x2b, 0x2c, 0x2c, 0x2c, 0x25, 0x29, 0x29,
-    0x29, 0x29, 0x2b, 0x70, 0xde, 0xf4, 0xfa, 0xfa, 0xec, 0xc2, 0x78, 0x57,
-    0x49, 0x38, 0x25, 0x23, 0x20, 0x1e, 0x16, 0x16, 0x16, 0x17, 0x17, 0x17,
-    0x17, 0x1e, 0x17, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x19, 0x19, 0x20, 0x2e, 0x23, 0x23, 0x20, 0x18, 0x1e,
-    0x1e, 0x19, 0x14, 0x2a, 0x58, 0x58, 0x40, 0x32, 0x1a, 0x0b, 0x06, 0x06,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x00, 0x02, 0x0a, 0x0d, 0x15, 0x1c, 0x15, 0x24, 0x24, 0x16, 0x0c,
-    0x03, 0x01, 0x00, 0x00, 0x53, 0x5a, 0x5a, 0x61, 0x61, 0x65, 0x65, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x48, 0x48, 0x49, 0x49, 0x48, 0x5d, 0x5d, 0x5b, 0x6a, 0x6a, 0x6a, 0x6a,
-    0x6f, 0x6f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x93, 0x93, 0x93, 0x93, 0x96, 0x96, 0x95, 0x95, 0x95, 0x95, 0x93, 0x93,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac,
-    0xac, 0xac, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x85, 0x85,
-    0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x88, 0x7d,
-    0x88, 0x88, 0x88, 0x7d, 0x7d, 0x7d, 0x6e, 0x73, 0x73, 0x73, 0x6e, 0x6e,
-    0x6e, 0x6e, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6e, 0x6e, 0x60, 0x60, 0x65, 0x61, 0x61, 0x5a,
-    0x5a, 0x5a, 0x53, 0x53, 0x53, 0x4a, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x45, 0x45, 0x38, 0x38, 0x38, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2c, 0x2c,
-    0x2b, 0x2b, 0x2c, 0x2c, 0x25, 0x25, 0x29, 0x29, 0x29, 0x29, 0x34, 0xa6,
-    0xe5, 0xef, 0xf2, 0xe6, 0xc2, 0x88, 0x6a, 0x48, 0x36, 0x2c, 0x25, 0x23,
-    0x20, 0x1e, 0x1c, 0x1c, 0x16, 0x17, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x14, 0x20, 0x27, 0x23, 0x20, 0x22, 0x18, 0x18, 0x19, 0x21, 0x14, 0x21,
-    0x40, 0x58, 0x40, 0x40, 0x1f, 0x0c, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0d, 0x1c,
-    0x32, 0x32, 0x40, 0x40, 0x40, 0x32, 0x24, 0x16, 0x06, 0x01, 0x00, 0x00,
-    0x5a, 0x5a, 0x61, 0x61, 0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65,
-    0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x48, 0x48, 0x49, 0x49,
-    0x48, 0x5d, 0x5d, 0x5b, 0x5b, 0x6a, 0x6a, 0x6a, 0x6f, 0x6f, 0x6f, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7a, 0x93, 0x93, 0x93,
-    0x96, 0x96, 0x95, 0x95, 0x95, 0x95, 0x93, 0x93, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x85, 0x85, 0x85, 0x80, 0x85, 0x85, 0x85, 0x85,
-    0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x73, 0x73, 0x73, 0x73, 0x6e, 0x6e, 0x6e, 0x6e, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53,
-    0x4a, 0x4a, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x45, 0x45, 0x38, 0x38,
-    0x38, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2c, 0x2c, 0x2b, 0x2b, 0x2c, 0x2c,
-    0x25, 0x29, 0x29, 0x23, 0x29, 0x2b, 0x34, 0xb9, 0xe3, 0xec, 0xe6, 0xc2,
-    0xb0, 0x84, 0x57, 0x41, 0x33, 0x25, 0x23, 0x18, 0x18, 0x1e, 0x1c, 0x1c,
-    0x16, 0x17, 0x17, 0x1e, 0x17, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x1c, 0x1c, 0x16, 0x13, 0x19, 0x19, 0x27, 0x2e,
-    0x27, 0x22, 0x22, 0x20, 0x20, 0x27, 0x22, 0x20, 0x40, 0x58, 0x40, 0x40,
-    0x24, 0x0f, 0x09, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x0d, 0x24, 0x52, 0x52, 0x82, 0xa2, 0xa2,
-    0x82, 0x58, 0x32, 0x1f, 0x0b, 0x01, 0x00, 0x00, 0x5a, 0x61, 0x61, 0x65,
-    0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x48, 0x48, 0x49, 0x49, 0x48, 0x48, 0x5d, 0x5b,
-    0x5b, 0x6a, 0x6a, 0x6a, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x80, 0x7a, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x93, 0x93, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x93, 0x93, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
-    0x85, 0x85, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x74, 0x73, 0x73,
-    0x73, 0x73, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x65, 0x65, 0x6b, 0x6b, 0x6e, 0x6e, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x61, 0x61, 0x5a, 0x53, 0x5f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4b, 0x42, 0x45, 0x45, 0x38, 0x38, 0x38, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x2c, 0x2c, 0x2b, 0x2b, 0x2c, 0x25, 0x25, 0x29, 0x29, 0x29,
-    0x29, 0x25, 0x37, 0x99, 0xd6, 0xd5, 0xc9, 0xc0, 0x8d, 0x6a, 0x49, 0x36,
-    0x33, 0x29, 0x20, 0x20, 0x18, 0x19, 0x16, 0x16, 0x16, 0x17, 0x1f, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x1c, 0x12, 0x16, 0x16, 0x19, 0x14, 0x20, 0x35, 0x2e, 0x27, 0x22, 0x22,
-    0x22, 0x27, 0x27, 0x22, 0x35, 0x58, 0x40, 0x40, 0x2a, 0x13, 0x09, 0x06,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02,
-    0x07, 0x24, 0x40, 0x82, 0xa2, 0xd7, 0xd7, 0xcc, 0xa2, 0x82, 0x40, 0x24,
-    0x0a, 0x02, 0x00, 0x00, 0x61, 0x61, 0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x48, 0x48, 0x49, 0x49, 0x48, 0x48, 0x5d, 0x5b, 0x5b, 0x6a, 0x6a, 0x6a,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x93, 0x93,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x7d, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x5a, 0x53,
-    0x5f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x42, 0x42,
-    0x45, 0x45, 0x38, 0x38, 0x38, 0x33, 0x33, 0x33, 0x33, 0x34, 0x2c, 0x2c,
-    0x2b, 0x2b, 0x2c, 0x25, 0x29, 0x29, 0x29, 0x29, 0x29, 0x25, 0x46, 0x7f,
-    0xaf, 0xc9, 0xc0, 0x9e, 0x84, 0x5b, 0x41, 0x3b, 0x2c, 0x23, 0x20, 0x19,
-    0x19, 0x19, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13,
-    0x19, 0x14, 0x19, 0x27, 0x35, 0x2e, 0x23, 0x23, 0x23, 0x22, 0x27, 0x2e,
-    0x35, 0x40, 0x40, 0x40, 0x2a, 0x16, 0x09, 0x06, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x06, 0x15, 0x32, 0x82, 0xcc,
-    0xd7, 0xe4, 0xe4, 0xd7, 0xcc, 0x82, 0x40, 0x24, 0x0b, 0x01, 0x00, 0x00,
-    0x61, 0x61, 0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x64, 0x64, 0x64, 0x64, 0x6b, 0x6b, 0x6b, 0x65,
-    0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x48, 0x48, 0x49, 0x49,
-    0x48, 0x48, 0x5d, 0x5b, 0x5b, 0x57, 0x6a, 0x6a, 0x6f, 0x6f, 0x68, 0x68,
-    0x6f, 0x6f, 0x6f, 0x80, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
-    0x81, 0x81, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x93, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96, 0x96, 0x96, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x61, 0x61, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x4f, 0x4f, 0x4f,
-    0x5f, 0x4b, 0x4b, 0x5f, 0x5f, 0x4b, 0x4b, 0x4b, 0x45, 0x45, 0x38, 0x38,
-    0x38, 0x38, 0x33, 0x33, 0x34, 0x34, 0x2c, 0x2c, 0x2b, 0x2b, 0x2c, 0x25,
-    0x29, 0x29, 0x29, 0x29, 0x28, 0x34, 0x5e, 0x75, 0x91, 0xae, 0xb4, 0x7a,
-    0x57, 0x49, 0x36, 0x34, 0x28, 0x22, 0x19, 0x17, 0x17, 0x19, 0x18, 0x19,
-    0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x16, 0x13, 0x14, 0x14, 0x14, 0x19,
-    0x2a, 0x2e, 0x27, 0x23, 0x23, 0x23, 0x27, 0x27, 0x2a, 0x35, 0x40, 0x35,
-    0x2a, 0x16, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
-    0x01, 0x02, 0x02, 0x0d, 0x24, 0x52, 0xcc, 0xdb, 0xef, 0xef, 0xef, 0xe4,
-    0xcc, 0xa2, 0x40, 0x1e, 0x0b, 0x02, 0x07, 0x0a, 0x61, 0x61, 0x65, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x64, 0x64, 0x64, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65,
-    0x61, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x48, 0x48, 0x49, 0x49, 0x48, 0x48, 0x49, 0x5b,
-    0x5b, 0x57, 0x6a, 0x6a, 0x6a, 0x6f, 0x68, 0x68, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x81, 0x81, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x85, 0x85, 0x85, 0x85,
-    0x85, 0x85, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x67, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x4f, 0x4f, 0x4f, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x42, 0x42, 0x4b, 0x45, 0x45, 0x45, 0x38, 0x38, 0x38, 0x33, 0x33, 0x33,
-    0x34, 0x34, 0x2c, 0x2c, 0x2b, 0x2b, 0x2c, 0x25, 0x29, 0x29, 0x29, 0x29,
-    0x28, 0x37, 0x5f, 0x7c, 0xa3, 0xae, 0x93, 0x68, 0x4d, 0x43, 0x3b, 0x2b,
-    0x28, 0x20, 0x19, 0x17, 0x17, 0x19, 0x18, 0x1e, 0x17, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x13, 0x16, 0x13, 0x13, 0x13, 0x0f, 0x14, 0x19, 0x2a, 0x2e, 0x29,
-    0x23, 0x20, 0x20, 0x20, 0x27, 0x2e, 0x35, 0x2e, 0x24, 0x1f, 0x09, 0x07,
-    0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x00, 0x02, 0x02, 0x05, 0x15,
-    0x32, 0x82, 0xdb, 0xee, 0xf3, 0xf3, 0xef, 0xe4, 0xcf, 0x94, 0x47, 0x22,
-    0x10, 0x10, 0x14, 0x17, 0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x65, 0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61,
-    0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x48, 0x48, 0x49, 0x49, 0x48, 0x48, 0x49, 0x5b, 0x57, 0x57, 0x57, 0x6a,
-    0x6a, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6f, 0x6f, 0x80, 0x80, 0x80, 0x80,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x81, 0x81, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96, 0x96, 0x96, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x85, 0x85, 0x85, 0x85, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x67, 0x67, 0x67, 0x67, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x4b, 0x4b, 0x42, 0x4b, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x38, 0x38, 0x34, 0x33, 0x33, 0x33, 0x34, 0x34, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x2c, 0x25, 0x29, 0x29, 0x28, 0x28, 0x25, 0x46, 0x5f, 0x75,
-    0x91, 0x92, 0x6a, 0x4d, 0x41, 0x36, 0x34, 0x27, 0x22, 0x18, 0x18, 0x19,
-    0x19, 0x19, 0x1e, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x0f, 0x0f, 0x14, 0x1e, 0x2e, 0x27, 0x23, 0x20, 0x20, 0x20,
-    0x22, 0x2e, 0x35, 0x2a, 0x24, 0x1f, 0x0c, 0x06, 0x05, 0x05, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x0a, 0x24, 0x52, 0xcc, 0xe4, 0xef,
-    0xf4, 0xef, 0xec, 0xe3, 0xcf, 0x99, 0x3e, 0x25, 0x1b, 0x1d, 0x25, 0x28,
-    0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x43, 0x43, 0x48, 0x48, 0x41, 0x49,
-    0x48, 0x48, 0x49, 0x4d, 0x57, 0x57, 0x57, 0x6a, 0x6a, 0x68, 0x6f, 0x68,
-    0x68, 0x68, 0x6f, 0x6f, 0x80, 0x80, 0x80, 0x80, 0x7a, 0x7a, 0x7a, 0x7a,
-    0x81, 0x81, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x85, 0x85, 0x85, 0x85, 0x85, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x67, 0x67, 0x67, 0x67, 0x67, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65,
-    0x65, 0x65, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x61, 0x61, 0x5a, 0x5a, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x4b, 0x42, 0x42, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x38, 0x38,
-    0x34, 0x33, 0x33, 0x33, 0x34, 0x34, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
-    0x29, 0x29, 0x28, 0x28, 0x29, 0x46, 0x42, 0x65, 0x75, 0x7d, 0x5d, 0x41,
-    0x36, 0x33, 0x2b, 0x27, 0x20, 0x19, 0x18, 0x18, 0x19, 0x17, 0x17, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x12, 0x0e, 0x0e,
-    0x0c, 0x14, 0x27, 0x2e, 0x29, 0x23, 0x20, 0x20, 0x20, 0x27, 0x2a, 0x2a,
-    0x24, 0x1f, 0x0f, 0x06, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
-    0x02, 0x0a, 0x1c, 0x52, 0x8c, 0xd7, 0xe4, 0xef, 0xef, 0xec, 0xe3, 0xd6,
-    0xc2, 0x6d, 0x44, 0x2d, 0x2d, 0x2d, 0x30, 0x44, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x53,
-    0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x48, 0x48, 0x41, 0x41, 0x48, 0x48, 0x49, 0x4d,
-    0x57, 0x57, 0x57, 0x57, 0x6a, 0x68, 0x6f, 0x68, 0x68, 0x68, 0x68, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x81, 0x81, 0x80, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x85, 0x85,
-    0x85, 0x85, 0x85, 0x73, 0x74, 0x74, 0x74, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x4b, 0x4b, 0x42, 0x42, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x38, 0x38, 0x38, 0x34, 0x33, 0x33, 0x33,
-    0x34, 0x34, 0x34, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x28, 0x28, 0x28, 0x28,
-    0x25, 0x3b, 0x44, 0x4f, 0x4f, 0x61, 0x44, 0x36, 0x33, 0x2c, 0x28, 0x22,
-    0x18, 0x18, 0x18, 0x19, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x0e, 0x0d, 0x0d, 0x0c, 0x08, 0x18, 0x27,
-    0x27, 0x23, 0x22, 0x20, 0x20, 0x22, 0x21, 0x21, 0x24, 0x24, 0x0f, 0x06,
-    0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x05, 0x0d, 0x1c, 0x52, 0x8c,
-    0xcc, 0xdc, 0xee, 0xee, 0xec, 0xde, 0xd6, 0xc2, 0x87, 0x62, 0x3d, 0x3d,
-    0x3d, 0x3d, 0x4d, 0x5b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65,
-    0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x43,
-    0x48, 0x48, 0x41, 0x41, 0x48, 0x48, 0x49, 0x49, 0x57, 0x57, 0x57, 0x57,
-    0x6a, 0x6a, 0x6f, 0x68, 0x68, 0x68, 0x68, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x81, 0x81, 0x80, 0x80, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
-    0x74, 0x74, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x65, 0x65, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x4b, 0x42, 0x42, 0x42, 0x42, 0x45, 0x45, 0x45, 0x38, 0x45, 0x45,
-    0x38, 0x38, 0x38, 0x38, 0x34, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 0x2c,
-    0x2c, 0x2c, 0x2c, 0x2c, 0x29, 0x28, 0x23, 0x28, 0x25, 0x34, 0x3b, 0x3b,
-    0x44, 0x42, 0x3b, 0x33, 0x25, 0x28, 0x23, 0x20, 0x18, 0x19, 0x19, 0x19,
-    0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x0e, 0x0d, 0x0d, 0x0f, 0x0c, 0x14, 0x22, 0x27, 0x27, 0x27, 0x20,
-    0x22, 0x22, 0x22, 0x21, 0x24, 0x24, 0x0f, 0x06, 0x05, 0x02, 0x05, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x02, 0x02, 0x05, 0x0d, 0x24, 0x52, 0x8c, 0xc8, 0xdf, 0xe4, 0xe5, 0xe3,
-    0xde, 0xd5, 0xb2, 0x9d, 0x6a, 0x5b, 0x5b, 0x4c, 0x4c, 0x6f, 0x6f, 0x6f,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x6b, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61,
-    0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41,
-    0x49, 0x48, 0x48, 0x48, 0x57, 0x57, 0x57, 0x57, 0x6a, 0x6a, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x85, 0x85, 0x85, 0x85, 0x85, 0x74, 0x74, 0x67, 0x67,
-    0x67, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61,
-    0x61, 0x5a, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x4b, 0x42, 0x42,
-    0x42, 0x42, 0x42, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x38, 0x38, 0x38, 0x38,
-    0x34, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b,
-    0x29, 0x29, 0x29, 0x23, 0x23, 0x29, 0x2b, 0x34, 0x34, 0x34, 0x2c, 0x29,
-    0x28, 0x23, 0x20, 0x18, 0x19, 0x17, 0x19, 0x19, 0x19, 0x19, 0x19, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x19, 0x19, 0x19, 0x19, 0x13, 0x14, 0x14, 0x13, 0x0f, 0x0f, 0x0e, 0x0c,
-    0x0c, 0x0c, 0x08, 0x14, 0x22, 0x2e, 0x22, 0x27, 0x22, 0x22, 0x22, 0x21,
-    0x21, 0x24, 0x13, 0x06, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02,
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x0d, 0x24,
-    0x52, 0x8c, 0xcc, 0xd7, 0xe4, 0xe4, 0xe3, 0xd6, 0xc2, 0xb2, 0x85, 0x6f,
-    0x5b, 0x4c, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a,
-    0x5a, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x49, 0x49, 0x48, 0x48,
-    0x57, 0x57, 0x57, 0x57, 0x6a, 0x6a, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x7a, 0x7a, 0x81, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x80, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x6f, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x85,
-    0x85, 0x85, 0x85, 0x74, 0x74, 0x67, 0x67, 0x67, 0x67, 0x65, 0x65, 0x61,
-    0x61, 0x65, 0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x61, 0x61, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x38, 0x38, 0x38, 0x38, 0x34, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x23,
-    0x23, 0x23, 0x28, 0x28, 0x29, 0x29, 0x23, 0x23, 0x20, 0x20, 0x18, 0x19,
-    0x17, 0x17, 0x1a, 0x1a, 0x19, 0x19, 0x19, 0x19, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x19, 0x19, 0x19, 0x19,
-    0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0b, 0x0c, 0x08,
-    0x19, 0x27, 0x27, 0x27, 0x20, 0x20, 0x20, 0x22, 0x2a, 0x2a, 0x16, 0x0b,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x02, 0x02, 0x0a, 0x24, 0x52, 0x82, 0xcc, 0xd7, 0xe4,
-    0xee, 0xe3, 0xd4, 0xc2, 0xb1, 0x85, 0x5b, 0x4c, 0x4e, 0x4e, 0x4e, 0x4e,
-    0x63, 0x63, 0x63, 0x63, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53,
-    0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43,
-    0x41, 0x41, 0x41, 0x41, 0x49, 0x49, 0x48, 0x48, 0x4d, 0x57, 0x57, 0x57,
-    0x68, 0x6a, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x7a, 0x7a, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x85, 0x85, 0x6a, 0x6a, 0x6a,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x65, 0x61, 0x61, 0x61, 0x61, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x60, 0x60, 0x60, 0x60,
-    0x65, 0x61, 0x61, 0x61, 0x61, 0x61, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x42, 0x42, 0x42, 0x42, 0x42, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x38, 0x38, 0x38, 0x38, 0x33, 0x33, 0x33, 0x33, 0x34, 0x34, 0x2c, 0x2c,
-    0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x20, 0x20, 0x18, 0x18, 0x18, 0x19, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x19, 0x19, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f,
-    0x0f, 0x0e, 0x0c, 0x0d, 0x0d, 0x0a, 0x0c, 0x0b, 0x08, 0x1e, 0x2a, 0x2a,
-    0x22, 0x20, 0x20, 0x20, 0x21, 0x2a, 0x24, 0x0c, 0x05, 0x05, 0x02, 0x02,
-    0x02, 0x02, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
-    0x07, 0x15, 0x32, 0x8c, 0xcc, 0xd7, 0xe4, 0xe4, 0xe3, 0xd6, 0xc2, 0x92,
-    0x6a, 0x4c, 0x4c, 0x4c, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e,
-    0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65,
-    0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x41, 0x41, 0x41, 0x41,
-    0x49, 0x49, 0x48, 0x48, 0x4d, 0x57, 0x57, 0x57, 0x57, 0x6a, 0x6a, 0x68,
-    0x6f, 0x68, 0x68, 0x68, 0x68, 0x68, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x80, 0x80, 0x80, 0x80, 0x80,
-    0x80, 0x80, 0x85, 0x85, 0x6a, 0x6a, 0x6a, 0x6a, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x65, 0x65, 0x65, 0x65,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x65, 0x65, 0x60, 0x60, 0x60, 0x60, 0x65, 0x65, 0x61, 0x61,
-    0x61, 0x61, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x42, 0x42, 0x42, 0x42, 0x42,
-    0x42, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x38, 0x38, 0x38, 0x38,
-    0x33, 0x33, 0x33, 0x33, 0x34, 0x34, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x29,
-    0x29, 0x29, 0x29, 0x29, 0x23, 0x23, 0x23, 0x23, 0x20, 0x20, 0x20, 0x20,
-    0x18, 0x18, 0x19, 0x1e, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x19, 0x19,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x12, 0x12, 0x12, 0x0e, 0x0e, 0x0e, 0x0d, 0x0d,
-    0x0d, 0x0a, 0x0a, 0x0c, 0x0c, 0x14, 0x21, 0x2a, 0x2a, 0x22, 0x20, 0x20,
-    0x22, 0x2a, 0x2a, 0x16, 0x06, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x05, 0x15, 0x32, 0x79, 0xcc,
-    0xd7, 0xe4, 0xe4, 0xe3, 0xd6, 0xc2, 0x92, 0x6a, 0x5b, 0x4c, 0x4e, 0x4e,
-    0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4c, 0x75, 0x75, 0x75, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x5a,
-    0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x48, 0x48, 0x49, 0x49, 0x49, 0x41, 0x41, 0x41, 0x48, 0x48, 0x48, 0x48,
-    0x4d, 0x57, 0x57, 0x57, 0x57, 0x68, 0x6a, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
-    0x81, 0x81, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x6f, 0x85, 0x6a,
-    0x6a, 0x6a, 0x6a, 0x5b, 0x67, 0x67, 0x67, 0x67, 0x5d, 0x5d, 0x5d, 0x5d,
-    0x5d, 0x5d, 0x61, 0x61, 0x61, 0x65, 0x65, 0x65, 0x65, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6e, 0x60, 0x60, 0x60, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a,
-    0x5f, 0x4f, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x38, 0x38, 0x38, 0x38, 0x33, 0x33, 0x33, 0x33,
-    0x34, 0x34, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x22, 0x20, 0x20, 0x20, 0x20, 0x18, 0x1e, 0x1e, 0x1e,
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x12, 0x12, 0x0e, 0x0e, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x0d,
-    0x0b, 0x0b, 0x16, 0x2a, 0x2e, 0x27, 0x20, 0x20, 0x22, 0x21, 0x2a, 0x1f,
-    0x0c, 0x05, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x02, 0x01, 0x05, 0x12, 0x32, 0x52, 0xad, 0xd7, 0xe4, 0xe5, 0xe3, 0xde,
-    0xc2, 0x7d, 0x5b, 0x4d, 0x3f, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e,
-    0x4c, 0x4c, 0x3f, 0x3f, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x53, 0x53,
-    0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x48, 0x48, 0x49, 0x49,
-    0x49, 0x49, 0x41, 0x41, 0x48, 0x48, 0x48, 0x48, 0x48, 0x57, 0x57, 0x57,
-    0x5b, 0x57, 0x6a, 0x6a, 0x6a, 0x68, 0x6f, 0x68, 0x68, 0x68, 0x68, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x81, 0x81, 0x7a, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
-    0x81, 0x81, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x80,
-    0x80, 0x80, 0x80, 0x80, 0x6f, 0x6f, 0x6a, 0x6a, 0x6a, 0x6a, 0x5b, 0x5b,
-    0x67, 0x67, 0x67, 0x67, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x61, 0x61,
-    0x61, 0x61, 0x65, 0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6e, 0x60, 0x60, 0x60,
-    0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x53, 0x53, 0x4f, 0x4f, 0x42, 0x42,
-    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x38, 0x38, 0x38, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x34, 0x2c, 0x2c,
-    0x2b, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x23, 0x23, 0x23, 0x23, 0x23, 0x22,
-    0x22, 0x20, 0x20, 0x18, 0x1e, 0x1e, 0x1e, 0x1e, 0x17, 0x17, 0x17, 0x17,
-    0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0e, 0x0e, 0x0e,
-    0x0c, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x09, 0x0c, 0x24,
-    0x2a, 0x27, 0x22, 0x20, 0x20, 0x1e, 0x21, 0x24, 0x12, 0x06, 0x02, 0x02,
-    0x02, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x05, 0x12, 0x24,
-    0x52, 0x8c, 0xd7, 0xe4, 0xed, 0xec, 0xe3, 0xc4, 0x92, 0x5b, 0x3d, 0x3f,
-    0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4c, 0x3f, 0x3f, 0x3d, 0x3d, 0x2f,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65,
-    0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x4a, 0x4a, 0x49, 0x49, 0x41, 0x41,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x57, 0x57, 0x57, 0x57, 0x57, 0x6a,
-    0x6a, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x80, 0x80, 0x80, 0x80,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x80, 0x80, 0x80, 0x6f,
-    0x6f, 0x6f, 0x6a, 0x6a, 0x6a, 0x6a, 0x5b, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x5d, 0x5d, 0x5d, 0x5d, 0x67, 0x67, 0x65, 0x65,
-    0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x5a,
-    0x5a, 0x53, 0x53, 0x4a, 0x4f, 0x4f, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42,
-    0x42, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x38, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x34, 0x34, 0x2c, 0x2c, 0x2b, 0x2b, 0x29, 0x29,
-    0x29, 0x29, 0x23, 0x23, 0x23, 0x23, 0x22, 0x22, 0x22, 0x20, 0x20, 0x20,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0d, 0x0a,
-    0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x09, 0x0b, 0x19, 0x2a, 0x2e, 0x27, 0x20,
-    0x18, 0x1e, 0x21, 0x2a, 0x1f, 0x0c, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05,
-    0x09, 0x09, 0x0e, 0x0e, 0x0e, 0x12, 0x32, 0x52, 0x8c, 0xcc, 0xdf, 0xed,
-    0xec, 0xe3, 0xd6, 0x8f, 0x67, 0x4d, 0x3d, 0x3f, 0x4e, 0x4e, 0x4e, 0x4e,
-    0x3f, 0x3f, 0x3f, 0x3d, 0x3d, 0x2f, 0x2f, 0x2f, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61,
-    0x61, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x4d, 0x57, 0x57, 0x57, 0x57, 0x57, 0x6a, 0x6a, 0x6a, 0x68, 0x68,
-    0x6f, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x7a, 0x7a,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x7a, 0x81, 0x81,
-    0x81, 0x81, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6a, 0x6a, 0x6a,
-    0x6a, 0x5b, 0x67, 0x67, 0x67, 0x67, 0x67, 0x5d, 0x67, 0x67, 0x67, 0x67,
-    0x5d, 0x67, 0x67, 0x67, 0x67, 0x67, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x53, 0x4a, 0x4a,
-    0x4f, 0x4f, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x38, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x34, 0x34, 0x2c, 0x2c, 0x2b, 0x2b, 0x29, 0x29, 0x29, 0x29, 0x23, 0x23,
-    0x23, 0x23, 0x22, 0x22, 0x22, 0x20, 0x20, 0x20, 0x20, 0x1e, 0x1e, 0x19,
-    0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f,
-    0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0d, 0x0a, 0x0d, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x09, 0x06, 0x0c, 0x21, 0x2e, 0x2a, 0x22, 0x20, 0x20, 0x21, 0x2a,
-    0x24, 0x13, 0x09, 0x06, 0x09, 0x0e, 0x12, 0x12, 0x12, 0x12, 0x1c, 0x1c,
-    0x1c, 0x24, 0x52, 0x8c, 0xc8, 0xd7, 0xe5, 0xed, 0xec, 0xd6, 0xc4, 0x87,
-    0x5b, 0x3d, 0x3d, 0x3f, 0x3f, 0x3f, 0x4e, 0x3f, 0x3f, 0x3f, 0x3d, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2d, 0x7c, 0x7c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a,
-    0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x57, 0x57,
-    0x57, 0x57, 0x57, 0x57, 0x6a, 0x6a, 0x6a, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6a, 0x6a, 0x6a, 0x5b, 0x5b, 0x67, 0x67,
-    0x5d, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x61,
-    0x61, 0x61, 0x5a, 0x5a, 0x53, 0x53, 0x4a, 0x4a, 0x4f, 0x4f, 0x44, 0x44,
-    0x42, 0x42, 0x42, 0x42, 0x42, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x34, 0x34, 0x33, 0x33, 0x34, 0x34, 0x2c, 0x2c, 0x2c, 0x2c,
-    0x2b, 0x2b, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x27, 0x22, 0x20, 0x18, 0x18, 0x19, 0x19, 0x17, 0x16,
-    0x16, 0x16, 0x16, 0x13, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x0a, 0x07, 0x09, 0x06, 0x0b,
-    0x14, 0x2a, 0x35, 0x2a, 0x22, 0x22, 0x27, 0x2a, 0x35, 0x24, 0x1a, 0x12,
-    0x1c, 0x1c, 0x1c, 0x1c, 0x24, 0x24, 0x24, 0x2a, 0x2a, 0x40, 0x77, 0xa2,
-    0xc5, 0xda, 0xed, 0xec, 0xde, 0xc4, 0x8f, 0x65, 0x3d, 0x3d, 0x3d, 0x3d,
-    0x3d, 0x3f, 0x3f, 0x3d, 0x3d, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2d, 0x2d,
-    0x7c, 0x7c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65,
-    0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x57, 0x57, 0x57, 0x5b, 0x57,
-    0x57, 0x68, 0x6a, 0x6a, 0x6a, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6a, 0x6a, 0x6a, 0x5b, 0x5b, 0x5b, 0x67, 0x67, 0x5d, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x6b, 0x6b,
-    0x65, 0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a,
-    0x53, 0x53, 0x4a, 0x4a, 0x4f, 0x4f, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42,
-    0x42, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x34, 0x34,
-    0x33, 0x33, 0x34, 0x34, 0x2c, 0x2c, 0x2c, 0x2c, 0x2b, 0x2b, 0x28, 0x28,
-    0x28, 0x28, 0x28, 0x23, 0x27, 0x27, 0x27, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x27, 0x22, 0x18, 0x18, 0x19, 0x17, 0x16, 0x16, 0x16, 0x15, 0x13,
-    0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x0f, 0x0f, 0x0c, 0x0e, 0x0e, 0x0e, 0x0e, 0x0c, 0x0c, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x07, 0x05, 0x06, 0x06, 0x0b, 0x08, 0x21, 0x35, 0x35,
-    0x27, 0x27, 0x27, 0x2e, 0x35, 0x35, 0x2a, 0x24, 0x24, 0x24, 0x2a, 0x2a,
-    0x2a, 0x2e, 0x2e, 0x35, 0x40, 0x58, 0xa2, 0xc5, 0xda, 0xe5, 0xe3, 0xde,
-    0xd6, 0x99, 0x69, 0x49, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x8a, 0x7c, 0x7c, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x75, 0x75, 0x75, 0x75,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61,
-    0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x49, 0x49, 0x49, 0x49, 0x49, 0x41, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x6a,
-    0x6a, 0x6a, 0x6a, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x7a, 0x7a, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6a, 0x6a, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x53, 0x53, 0x4a, 0x4a,
-    0x4f, 0x4f, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x34, 0x34, 0x34, 0x33, 0x34, 0x34, 0x34, 0x34,
-    0x2c, 0x2c, 0x2c, 0x2c, 0x2b, 0x2b, 0x28, 0x28, 0x28, 0x28, 0x28, 0x27,
-    0x2e, 0x35, 0x35, 0x3a, 0x56, 0x56, 0x47, 0x3a, 0x3a, 0x35, 0x2e, 0x22,
-    0x20, 0x19, 0x19, 0x19, 0x16, 0x16, 0x15, 0x16, 0x16, 0x16, 0x16, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c,
-    0x0e, 0x0e, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x0d, 0x0d, 0x0a, 0x0a,
-    0x07, 0x07, 0x07, 0x0b, 0x08, 0x1e, 0x35, 0x40, 0x3a, 0x35, 0x31, 0x35,
-    0x3a, 0x40, 0x40, 0x35, 0x2a, 0x2a, 0x2e, 0x2e, 0x2e, 0x3a, 0x40, 0x47,
-    0x58, 0x83, 0xc5, 0xcd, 0xde, 0xde, 0xde, 0xcd, 0x99, 0x7b, 0x53, 0x39,
-    0x3d, 0x3d, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2d, 0x2d, 0x2d,
-    0x2d, 0x2d, 0x2d, 0x26, 0x8a, 0x8a, 0x7c, 0x7c, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x6b, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x65, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x41, 0x41, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x68, 0x6a, 0x6a, 0x6a,
-    0x6a, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6a, 0x6a, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5d, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x61,
-    0x61, 0x61, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x4a, 0x4f, 0x4f, 0x44, 0x44,
-    0x42, 0x42, 0x42, 0x42, 0x42, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x34, 0x34, 0x33, 0x33, 0x34, 0x34, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
-    0x2b, 0x2b, 0x28, 0x28, 0x28, 0x28, 0x27, 0x2e, 0x35, 0x3a, 0x58, 0x58,
-    0x70, 0x70, 0x70, 0x56, 0x56, 0x47, 0x3a, 0x2e, 0x27, 0x20, 0x19, 0x19,
-    0x16, 0x13, 0x16, 0x16, 0x16, 0x13, 0x14, 0x14, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0e, 0x0e, 0x0d, 0x0c,
-    0x0e, 0x0e, 0x0e, 0x12, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0e, 0x0f,
-    0x14, 0x18, 0x27, 0x3a, 0x55, 0x3c, 0x3c, 0x3c, 0x3c, 0x47, 0x56, 0x56,
-    0x3a, 0x35, 0x3a, 0x3a, 0x3a, 0x47, 0x47, 0x55, 0x83, 0xa6, 0xb9, 0xd3,
-    0xd3, 0xd3, 0xcd, 0x99, 0x7b, 0x54, 0x43, 0x39, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x1b,
-    0x8a, 0x8a, 0x7c, 0x7c, 0x7c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53,
-    0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x49, 0x49, 0x49, 0x41, 0x41,
-    0x41, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x57, 0x57, 0x57,
-    0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x68, 0x6a, 0x6a, 0x6a, 0x68,
-    0x68, 0x68, 0x6f, 0x6f, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6f, 0x6f,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6a, 0x6a,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5d, 0x5d, 0x5d, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x74, 0x74, 0x74, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a,
-    0x53, 0x53, 0x53, 0x53, 0x4f, 0x4f, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42,
-    0x42, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x34, 0x34, 0x34, 0x34,
-    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2b, 0x29, 0x29, 0x28,
-    0x28, 0x28, 0x2e, 0x35, 0x56, 0x70, 0x82, 0xa2, 0xa2, 0x94, 0x94, 0x83,
-    0x70, 0x56, 0x47, 0x35, 0x2e, 0x27, 0x22, 0x20, 0x1e, 0x19, 0x16, 0x16,
-    0x16, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x12, 0x12, 0x12, 0x13, 0x13, 0x13, 0x16, 0x16,
-    0x16, 0x13, 0x13, 0x13, 0x13, 0x16, 0x16, 0x16, 0x19, 0x18, 0x22, 0x3a,
-    0x55, 0x50, 0x46, 0x46, 0x46, 0x50, 0x70, 0x70, 0x55, 0x47, 0x3c, 0x47,
-    0x47, 0x55, 0x70, 0x76, 0x99, 0xa6, 0xb9, 0xcd, 0xb9, 0xb9, 0x99, 0x7f,
-    0x5f, 0x44, 0x36, 0x30, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x26, 0x26, 0x26,
-    0x26, 0x25, 0x25, 0x25, 0x25, 0x1b, 0x1d, 0x1d, 0x8a, 0x8a, 0x8a, 0x7c,
-    0x7c, 0x7c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x61,
-    0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x49, 0x49, 0x49, 0x49, 0x49, 0x41, 0x41, 0x41, 0x41, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x57, 0x57, 0x57, 0x57, 0x68, 0x68, 0x6a, 0x6a, 0x6a, 0x68, 0x6f, 0x6f,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6f, 0x6f, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5d, 0x5d, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x74, 0x74, 0x67, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x74, 0x74, 0x74, 0x74, 0x74, 0x67, 0x67, 0x67, 0x6b, 0x6b,
-    0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53,
-    0x4f, 0x4f, 0x44, 0x44, 0x42, 0x42, 0x42, 0x42, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x33, 0x34, 0x33, 0x34, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x2c, 0x2c, 0x2b, 0x29, 0x29, 0x2b, 0x28, 0x2b, 0x35, 0x56,
-    0x83, 0xa2, 0xc5, 0xda, 0xc5, 0xc5, 0x9c, 0x94, 0x94, 0x83, 0x56, 0x47,
-    0x3a, 0x35, 0x2e, 0x27, 0x22, 0x1e, 0x1e, 0x17, 0x16, 0x16, 0x13, 0x13,
-    0x13, 0x13, 0x0f, 0x13, 0x13, 0x13, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x16, 0x16, 0x19, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-    0x16, 0x17, 0x17, 0x1e, 0x20, 0x22, 0x23, 0x2b, 0x46, 0x5e, 0x5e, 0x54,
-    0x54, 0x54, 0x76, 0x76, 0x76, 0x5e, 0x50, 0x50, 0x50, 0x76, 0x76, 0x76,
-    0x8f, 0x99, 0x99, 0x99, 0x99, 0x99, 0x76, 0x54, 0x42, 0x30, 0x2d, 0x30,
-    0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x1b, 0x1d, 0x1d,
-    0x18, 0x10, 0x08, 0x04, 0x91, 0x8a, 0x8a, 0x8a, 0x7c, 0x7c, 0x7c, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a,
-    0x5a, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x49,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x4d, 0x4d, 0x4d, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x57, 0x57, 0x57, 0x68, 0x6a, 0x6a, 0x5b, 0x5b, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x6f, 0x6f, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5d, 0x5d, 0x67, 0x67,
-    0x5b, 0x6a, 0x6a, 0x6a, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x67, 0x6b, 0x6b, 0x6b, 0x6b, 0x67, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x67, 0x67, 0x67, 0x67, 0x67, 0x6b, 0x65, 0x65, 0x65,
-    0x65, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x4f, 0x4f, 0x44, 0x44,
-    0x42, 0x42, 0x42, 0x42, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x34, 0x34,
-    0x33, 0x33, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x28, 0x28, 0x2b, 0x47, 0x70, 0x94, 0xc5, 0xda, 0xe5, 0xda,
-    0xda, 0xda, 0xc5, 0xc5, 0xa6, 0x94, 0x70, 0x55, 0x47, 0x3a, 0x3a, 0x35,
-    0x2e, 0x2a, 0x27, 0x21, 0x1f, 0x16, 0x16, 0x16, 0x13, 0x13, 0x13, 0x16,
-    0x16, 0x1f, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x1f, 0x1e, 0x1e, 0x1e,
-    0x21, 0x22, 0x20, 0x20, 0x20, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x27, 0x28, 0x31, 0x46, 0x5e, 0x69, 0x69, 0x5c, 0x5c, 0x69, 0x7b,
-    0x7b, 0x69, 0x5e, 0x5e, 0x54, 0x69, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x69,
-    0x69, 0x5f, 0x42, 0x3b, 0x33, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x1b, 0x1d, 0x1d, 0x1d, 0x10, 0x10, 0x08, 0x04, 0x03, 0x01,
-    0x91, 0x8a, 0x8a, 0x8a, 0x8a, 0x7c, 0x7c, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x49, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x68, 0x68, 0x5b, 0x5b, 0x5b, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6f, 0x6f,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5d, 0x67, 0x67, 0x67, 0x5b, 0x6a, 0x6a, 0x6a,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x67,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x67, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x67, 0x67, 0x67, 0x67, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x5a,
-    0x5a, 0x5a, 0x53, 0x53, 0x4f, 0x4f, 0x4f, 0x44, 0x42, 0x42, 0x42, 0x42,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x34, 0x34, 0x34, 0x34, 0x2c, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x28, 0x2b, 0x31,
-    0x56, 0x94, 0xc5, 0xda, 0xe5, 0xed, 0xef, 0xe5, 0xda, 0xda, 0xda, 0xcd,
-    0xa6, 0x94, 0x83, 0x70, 0x55, 0x55, 0x55, 0x47, 0x3a, 0x3a, 0x3a, 0x35,
-    0x2e, 0x2a, 0x21, 0x1f, 0x16, 0x1f, 0x24, 0x24, 0x24, 0x2a, 0x2a, 0x2a,
-    0x2a, 0x2a, 0x2a, 0x2a, 0x22, 0x22, 0x22, 0x22, 0x27, 0x27, 0x28, 0x28,
-    0x28, 0x28, 0x28, 0x28, 0x28, 0x23, 0x28, 0x28, 0x28, 0x28, 0x31, 0x34,
-    0x38, 0x54, 0x7b, 0x6b, 0x65, 0x65, 0x65, 0x6b, 0x69, 0x6b, 0x54, 0x54,
-    0x54, 0x53, 0x4a, 0x53, 0x4a, 0x4a, 0x44, 0x42, 0x42, 0x3b, 0x33, 0x2c,
-    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x1d, 0x1d, 0x20, 0x18, 0x10,
-    0x10, 0x08, 0x04, 0x03, 0x01, 0x01, 0x01, 0x01, 0x8f, 0x8f, 0x87, 0x87,
-    0x87, 0x8a, 0x7c, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x49, 0x49, 0x49, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x5b, 0x5b, 0x57, 0x57, 0x57, 0x57, 0x68, 0x68, 0x68, 0x68,
-    0x5b, 0x5b, 0x5b, 0x6f, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x6f, 0x6f, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x67, 0x67, 0x67, 0x67, 0x67, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x67, 0x67, 0x6b, 0x6b,
-    0x6b, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53,
-    0x53, 0x4a, 0x4f, 0x44, 0x42, 0x42, 0x42, 0x42, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x33, 0x34, 0x34, 0x34, 0x2c, 0x2c, 0x2b, 0x29, 0x29, 0x2b, 0x28, 0x28,
-    0x28, 0x28, 0x28, 0x28, 0x28, 0x2b, 0x3c, 0x56, 0xa2, 0xc5, 0xda, 0xe5,
-    0xed, 0xef, 0xed, 0xe5, 0xda, 0xda, 0xda, 0xcd, 0xa6, 0x94, 0x94, 0x94,
-    0x83, 0x83, 0x83, 0x76, 0x76, 0x70, 0x70, 0x55, 0x47, 0x40, 0x35, 0x2a,
-    0x27, 0x2a, 0x2a, 0x2a, 0x2e, 0x2e, 0x2e, 0x35, 0x35, 0x35, 0x35, 0x2e,
-    0x2e, 0x27, 0x29, 0x29, 0x29, 0x29, 0x29, 0x25, 0x25, 0x25, 0x25, 0x2c,
-    0x2c, 0x25, 0x25, 0x2c, 0x33, 0x33, 0x38, 0x38, 0x45, 0x4a, 0x61, 0x6b,
-    0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x61, 0x5a, 0x53, 0x43, 0x44, 0x36, 0x36,
-    0x33, 0x33, 0x3b, 0x33, 0x33, 0x2c, 0x25, 0x25, 0x25, 0x1b, 0x1d, 0x1d,
-    0x23, 0x20, 0x20, 0x18, 0x10, 0x08, 0x04, 0x03, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x8f, 0x8f, 0x87, 0x87, 0x87, 0x87, 0x7c, 0x7c,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6b,
-    0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a,
-    0x5a, 0x5a, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x49, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x5b,
-    0x57, 0x57, 0x57, 0x57, 0x57, 0x68, 0x68, 0x68, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6f, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x74, 0x67, 0x67, 0x74, 0x74, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x67, 0x67, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65,
-    0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x4a, 0x4f, 0x44,
-    0x42, 0x42, 0x42, 0x42, 0x3b, 0x3b, 0x3b, 0x3b, 0x34, 0x34, 0x34, 0x34,
-    0x2b, 0x2b, 0x2b, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x2b,
-    0x31, 0x3a, 0x70, 0xc5, 0xda, 0xe5, 0xed, 0xed, 0xed, 0xed, 0xe5, 0xe5,
-    0xda, 0xda, 0xc5, 0xcd, 0xa6, 0xa6, 0xa6, 0xb9, 0xa6, 0xa6, 0xa6, 0xa6,
-    0xa6, 0xa6, 0x94, 0x83, 0x70, 0x70, 0x55, 0x47, 0x3c, 0x3a, 0x3a, 0x3a,
-    0x3a, 0x3a, 0x3a, 0x3c, 0x3c, 0x3c, 0x3c, 0x31, 0x31, 0x2b, 0x29, 0x2b,
-    0x2b, 0x2c, 0x2c, 0x2c, 0x2c, 0x33, 0x33, 0x33, 0x2c, 0x2c, 0x33, 0x33,
-    0x36, 0x36, 0x43, 0x43, 0x43, 0x4a, 0x5a, 0x5a, 0x5a, 0x4a, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x36, 0x36, 0x30, 0x30, 0x33, 0x2c, 0x25, 0x2c, 0x25,
-    0x25, 0x25, 0x1b, 0x1d, 0x1d, 0x1d, 0x20, 0x18, 0x10, 0x10, 0x08, 0x03,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
-    0x8f, 0x8f, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x75, 0x75, 0x75, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53,
-    0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x49, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x57, 0x57, 0x57, 0x57,
-    0x57, 0x57, 0x57, 0x68, 0x5b, 0x5b, 0x5b, 0x5b, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x68, 0x68,
-    0x68, 0x68, 0x6f, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x67, 0x67, 0x67, 0x67, 0x74, 0x74,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x67, 0x67, 0x6b, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61,
-    0x5a, 0x5a, 0x53, 0x53, 0x53, 0x4a, 0x4f, 0x4f, 0x42, 0x42, 0x42, 0x42,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x34, 0x33, 0x34, 0x34, 0x2c, 0x2c, 0x2c, 0x25,
-    0x29, 0x29, 0x29, 0x2b, 0x28, 0x2b, 0x2b, 0x31, 0x56, 0xa2, 0xdc, 0xe4,
-    0xed, 0xef, 0xef, 0xed, 0xe5, 0xe5, 0xe5, 0xe5, 0xda, 0xda, 0xc5, 0xb9,
-    0xb9, 0xcd, 0xcd, 0xcd, 0xcd, 0xd3, 0xd3, 0xcd, 0xcd, 0xcd, 0xcd, 0xc4,
-    0xa6, 0x99, 0x76, 0x76, 0x76, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x50, 0x50,
-    0x46, 0x46, 0x37, 0x37, 0x34, 0x34, 0x34, 0x34, 0x33, 0x33, 0x33, 0x30,
-    0x36, 0x30, 0x30, 0x36, 0x39, 0x2d, 0x39, 0x39, 0x36, 0x43, 0x49, 0x4a,
-    0x49, 0x49, 0x49, 0x41, 0x39, 0x39, 0x39, 0x39, 0x39, 0x36, 0x30, 0x30,
-    0x30, 0x2d, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x1d, 0x1d, 0x20, 0x20,
-    0x18, 0x10, 0x08, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x8f, 0x8f, 0x87, 0x87,
-    0x87, 0x87, 0x87, 0x87, 0x7c, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x65, 0x61,
-    0x61, 0x61, 0x61, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x49,
-    0x49, 0x49, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x68, 0x68, 0x68, 0x68, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x67, 0x67, 0x67, 0x67, 0x74, 0x74, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x67, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x53, 0x53,
-    0x53, 0x4a, 0x4f, 0x4f, 0x42, 0x42, 0x42, 0x42, 0x3b, 0x3b, 0x3b, 0x33,
-    0x33, 0x33, 0x2c, 0x2c, 0x2c, 0x2c, 0x25, 0x25, 0x29, 0x29, 0x29, 0x29,
-    0x28, 0x34, 0x3c, 0x83, 0xc5, 0xdc, 0xe4, 0xef, 0xf3, 0xef, 0xed, 0xe5,
-    0xe5, 0xe5, 0xe5, 0xe5, 0xda, 0xcd, 0xb9, 0xcd, 0xcd, 0xd3, 0xd3, 0xd3,
-    0xd3, 0xde, 0xde, 0xde, 0xde, 0xd3, 0xd3, 0xd3, 0xc4, 0xc4, 0x99, 0x99,
-    0x99, 0x99, 0x8f, 0x7b, 0x7b, 0x69, 0x69, 0x54, 0x54, 0x4b, 0x4b, 0x45,
-    0x38, 0x33, 0x38, 0x38, 0x3b, 0x30, 0x36, 0x61, 0x74, 0x67, 0x5d, 0x5d,
-    0x67, 0x5d, 0x49, 0x49, 0x41, 0x49, 0x49, 0x41, 0x41, 0x41, 0x39, 0x39,
-    0x39, 0x2d, 0x2d, 0x2d, 0x2d, 0x26, 0x26, 0x2d, 0x26, 0x26, 0x26, 0x25,
-    0x1b, 0x25, 0x23, 0x20, 0x18, 0x10, 0x08, 0x04, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x8f, 0x8f, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
-    0x7c, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x7c, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x61, 0x5a,
-    0x5a, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x49, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x57, 0x57, 0x57, 0x57, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x5b, 0x5b, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x4d, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x67, 0x67, 0x6b, 0x6b, 0x65, 0x65,
-    0x65, 0x65, 0x61, 0x61, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x4a, 0x4f, 0x4f,
-    0x42, 0x42, 0x42, 0x42, 0x3b, 0x37, 0x37, 0x34, 0x33, 0x33, 0x2c, 0x2c,
-    0x2c, 0x2c, 0x25, 0x25, 0x25, 0x25, 0x29, 0x29, 0x34, 0x55, 0x94, 0xcf,
-    0xe4, 0xef, 0xf3, 0xf4, 0xef, 0xed, 0xe5, 0xe5, 0xe3, 0xe3, 0xde, 0xde,
-    0xcd, 0xcd, 0xcd, 0xd3, 0xd3, 0xd3, 0xd3, 0xde, 0xda, 0xde, 0xde, 0xde,
-    0xde, 0xde, 0xd6, 0xd6, 0xd6, 0xc4, 0xc4, 0x99, 0xaf, 0xaf, 0xa4, 0x8f,
-    0x8f, 0x7b, 0x7b, 0x69, 0x69, 0x54, 0x54, 0x45, 0x42, 0x44, 0x36, 0x36,
-    0x43, 0x5d, 0x5d, 0x67, 0x74, 0x6a, 0x5b, 0x4d, 0x4d, 0x4d, 0x49, 0x41,
-    0x41, 0x41, 0x3d, 0x3d, 0x3d, 0x2f, 0x2f, 0x2f, 0x39, 0x2d, 0x2d, 0x2d,
-    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x1b, 0x1d, 0x18, 0x10, 0x08,
-    0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x8f, 0x8f, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x7c, 0x7c, 0x75, 0x75,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x6b, 0x65, 0x61,
-    0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x49, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x48, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x57, 0x57, 0x57, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x5b, 0x5b, 0x5b, 0x68, 0x68, 0x68, 0x57, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x4d, 0x4d, 0x4d, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x67, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61,
-    0x5a, 0x5a, 0x53, 0x53, 0x53, 0x4a, 0x4f, 0x44, 0x42, 0x42, 0x42, 0x3b,
-    0x3b, 0x37, 0x34, 0x34, 0x33, 0x33, 0x2c, 0x2c, 0x2c, 0x25, 0x25, 0x25,
-    0x25, 0x25, 0x25, 0x2b, 0x3e, 0x83, 0xb9, 0xda, 0xe4, 0xef, 0xf3, 0xef,
-    0xe5, 0xe3, 0xde, 0xde, 0xde, 0xde, 0xd3, 0xd3, 0xcd, 0xcd, 0xcd, 0xd3,
-    0xd3, 0xd3, 0xde, 0xde, 0xde, 0xde, 0xde, 0xd3, 0xd3, 0xd6, 0xd6, 0xd6,
-    0xd6, 0xd6, 0xc2, 0xc2, 0xc2, 0xc2, 0xc9, 0xaf, 0xa4, 0x91, 0x8a, 0x7c,
-    0x6b, 0x65, 0x5a, 0x4a, 0x43, 0x4a, 0x65, 0x74, 0x74, 0x67, 0x4d, 0x4d,
-    0x4d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2d, 0x39, 0x2d, 0x2d, 0x2d, 0x26, 0x26, 0x26, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1d, 0x10, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x8f, 0x8f, 0x98, 0x87,
-    0x87, 0x87, 0x87, 0x87, 0x7c, 0x7c, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x67, 0x67, 0x5d, 0x67, 0x61, 0x61,
-    0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x49,
-    0x49, 0x49, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x48, 0x41, 0x41,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x57,
-    0x57, 0x57, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x68, 0x68, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x61, 0x61, 0x61, 0x5a, 0x53, 0x53,
-    0x53, 0x4a, 0x4f, 0x44, 0x42, 0x42, 0x42, 0x3b, 0x38, 0x37, 0x33, 0x33,
-    0x33, 0x33, 0x2c, 0x2c, 0x2c, 0x25, 0x25, 0x25, 0x25, 0x28, 0x28, 0x31,
-    0x55, 0x94, 0xb9, 0xd4, 0xe4, 0xef, 0xed, 0xe3, 0xd4, 0xd3, 0xd6, 0xd6,
-    0xd6, 0xd5, 0xc4, 0xc4, 0xc2, 0xc2, 0xc4, 0xc4, 0xd6, 0xd3, 0xd3, 0xde,
-    0xde, 0xe6, 0xde, 0xd6, 0xd6, 0xd5, 0xd5, 0xc2, 0xc2, 0xc9, 0xc9, 0xc9,
-    0xc9, 0xc9, 0xc0, 0xb0, 0xa3, 0x92, 0x92, 0x88, 0x74, 0x67, 0x5d, 0x49,
-    0x5a, 0x5a, 0x5d, 0x49, 0x41, 0x3d, 0x3d, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2d, 0x2f, 0x2f, 0x2f, 0x2f, 0x2d, 0x2d, 0x2d, 0x2d, 0x26,
-    0x26, 0x26, 0x26, 0x25, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1d, 0x10, 0x10,
-    0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x8f, 0x8f, 0x98, 0x87, 0x87, 0x87, 0x87, 0x87,
-    0x7c, 0x7c, 0x75, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x7d, 0x74, 0x67, 0x67, 0x5d, 0x5d, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x53,
-    0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x49, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x57, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x57, 0x57, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x5b, 0x5b, 0x5b, 0x5b, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x65, 0x61, 0x61, 0x5a, 0x53, 0x53, 0x4a, 0x4a, 0x4f, 0x44,
-    0x42, 0x42, 0x3b, 0x3b, 0x38, 0x34, 0x33, 0x33, 0x33, 0x33, 0x2c, 0x2c,
-    0x25, 0x25, 0x25, 0x25, 0x28, 0x28, 0x28, 0x31, 0x55, 0x94, 0xb9, 0xd4,
-    0xe3, 0xec, 0xec, 0xd6, 0xd6, 0xd5, 0xc9, 0xc9, 0xc0, 0xaf, 0xa4, 0xa4,
-    0xaf, 0xaf, 0xc2, 0xd0, 0xd6, 0xd6, 0xd3, 0xd3, 0xd3, 0xd3, 0xd6, 0xd6,
-    0xd5, 0xd5, 0xbb, 0xaf, 0xb0, 0xb0, 0xb0, 0xa3, 0xa3, 0xa3, 0x92, 0x92,
-    0x92, 0x88, 0x88, 0x85, 0x85, 0x6a, 0x5b, 0x5b, 0x41, 0x39, 0x39, 0x2f,
-    0x2f, 0x2f, 0x3d, 0x3d, 0x2f, 0x3d, 0x2f, 0x2f, 0x2f, 0x2f, 0x2d, 0x2d,
-    0x2f, 0x2d, 0x2d, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1d, 0x1d, 0x18, 0x10, 0x18, 0x17, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x8f, 0x8f, 0x98, 0x98, 0x87, 0x87, 0x87, 0x87, 0x8a, 0x7c, 0x7c, 0x75,
-    0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x7d, 0x74, 0x74, 0x67,
-    0x61, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x4a, 0x4a,
-    0x4a, 0x49, 0x49, 0x49, 0x49, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x39, 0x39, 0x39, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x3d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x57, 0x57, 0x57,
-    0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x5b, 0x5b, 0x5d, 0x5d, 0x5d, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x65, 0x65, 0x65, 0x61,
-    0x61, 0x5a, 0x53, 0x53, 0x53, 0x4a, 0x44, 0x44, 0x42, 0x42, 0x3b, 0x3b,
-    0x38, 0x38, 0x33, 0x33, 0x34, 0x33, 0x2c, 0x2c, 0x25, 0x29, 0x25, 0x28,
-    0x28, 0x28, 0x28, 0x31, 0x55, 0x99, 0xc4, 0xc4, 0xde, 0xd6, 0xd5, 0xb2,
-    0xaf, 0xb0, 0xa7, 0xa7, 0x9e, 0x8d, 0x97, 0x9f, 0xaa, 0xbb, 0xbb, 0xd0,
-    0xd5, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd5, 0xd0, 0xc9, 0xb6, 0xaa,
-    0x9e, 0x97, 0x97, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x6a, 0x6a,
-    0x6a, 0x5b, 0x4d, 0x3d, 0x2f, 0x2f, 0x2f, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
-    0x3d, 0x3d, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2d, 0x2d, 0x2d, 0x26, 0x26,
-    0x25, 0x25, 0x23, 0x23, 0x23, 0x23, 0x28, 0x31, 0x28, 0x25, 0x25, 0x2b,
-    0x20, 0x18, 0x10, 0x17, 0x21, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x8f, 0x98, 0x98,
-    0x87, 0x87, 0x87, 0x87, 0x8a, 0x7c, 0x7c, 0x75, 0x75, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x67, 0x61, 0x61, 0x61, 0x61,
-    0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x49, 0x49, 0x49,
-    0x49, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x3d, 0x3d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x57, 0x57, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x5b, 0x5b, 0x5d, 0x5d,
-    0x5d, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x53, 0x53,
-    0x4a, 0x4a, 0x44, 0x44, 0x42, 0x3b, 0x3b, 0x3b, 0x38, 0x38, 0x33, 0x33,
-    0x34, 0x34, 0x2c, 0x2c, 0x25, 0x25, 0x28, 0x28, 0x28, 0x28, 0x28, 0x31,
-    0x46, 0x76, 0x99, 0xd5, 0xd5, 0xc9, 0x92, 0x85, 0x7a, 0x7a, 0x81, 0x81,
-    0x7a, 0x93, 0x93, 0xa9, 0xa7, 0xb6, 0xbb, 0xbb, 0xc9, 0xd0, 0xc2, 0xc2,
-    0xc2, 0xd5, 0xd5, 0xc9, 0xbb, 0xaa, 0x9f, 0x8d, 0x96, 0x7a, 0x80, 0x6f,
-    0x6f, 0x6a, 0x6a, 0x6a, 0x6f, 0x5b, 0x57, 0x57, 0x57, 0x4d, 0x3d, 0x3d,
-    0x3d, 0x3d, 0x3d, 0x4d, 0x5b, 0x5b, 0x3d, 0x3d, 0x3d, 0x3d, 0x2f, 0x2f,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x26, 0x26, 0x25, 0x25, 0x28, 0x22, 0x18, 0x08,
-    0x04, 0x08, 0x20, 0x27, 0x2e, 0x23, 0x23, 0x28, 0x28, 0x20, 0x10, 0x10,
-    0x1e, 0x16, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x8f, 0x8f, 0x98, 0x98, 0x87, 0x87, 0x87, 0x87,
-    0x8a, 0x7c, 0x7c, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-    0x74, 0x74, 0x75, 0x65, 0x61, 0x61, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53,
-    0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x57, 0x57, 0x57, 0x57,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x65, 0x65, 0x61, 0x61, 0x61, 0x5a, 0x53, 0x53, 0x4a, 0x4a, 0x44, 0x44,
-    0x42, 0x3b, 0x3b, 0x3b, 0x38, 0x38, 0x33, 0x34, 0x34, 0x34, 0x2c, 0x2b,
-    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x34, 0x3b, 0x4f, 0x8f, 0xaf,
-    0xa3, 0x85, 0x5b, 0x68, 0x81, 0x81, 0x81, 0x81, 0x8e, 0x8e, 0xa9, 0xa9,
-    0xa9, 0xb4, 0xb4, 0xb6, 0xb6, 0xbb, 0xc9, 0xc9, 0xc9, 0xc9, 0xb6, 0xb0,
-    0xa3, 0x97, 0x84, 0x85, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x5b, 0x5b,
-    0x4c, 0x3f, 0x4c, 0x4c, 0x4c, 0x4e, 0x3f, 0x4e, 0x4e, 0x4e, 0x4e, 0x63,
-    0x68, 0x4c, 0x3d, 0x3d, 0x3d, 0x2f, 0x2d, 0x2d, 0x2d, 0x26, 0x26, 0x25,
-    0x25, 0x25, 0x23, 0x18, 0x10, 0x0b, 0x03, 0x03, 0x02, 0x03, 0x0b, 0x1e,
-    0x35, 0x2e, 0x23, 0x20, 0x23, 0x28, 0x10, 0x10, 0x18, 0x21, 0x0b, 0x03,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x8f, 0x8f, 0x98, 0x98, 0x98, 0x87, 0x87, 0x87, 0x8a, 0x8a, 0x7c, 0x7c,
-    0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74, 0x74, 0x75, 0x65,
-    0x61, 0x61, 0x5a, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x65, 0x61, 0x61, 0x61,
-    0x61, 0x5a, 0x53, 0x4a, 0x4a, 0x4a, 0x44, 0x44, 0x42, 0x3b, 0x3b, 0x3b,
-    0x38, 0x38, 0x33, 0x34, 0x34, 0x34, 0x2b, 0x29, 0x28, 0x28, 0x25, 0x25,
-    0x28, 0x25, 0x28, 0x2c, 0x30, 0x4a, 0x7d, 0x97, 0x7a, 0x68, 0x63, 0x81,
-    0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0xa8, 0xa8, 0xa9, 0xa9, 0xa9, 0x9e, 0x9e,
-    0xaa, 0xb6, 0xb6, 0xbb, 0xb6, 0xaa, 0x9e, 0x8d, 0x7a, 0x6f, 0x6f, 0x68,
-    0x5b, 0x5b, 0x5b, 0x68, 0x68, 0x68, 0x4c, 0x4c, 0x3f, 0x4e, 0x4e, 0x4e,
-    0x4e, 0x63, 0x63, 0x63, 0x7e, 0x4e, 0x4e, 0x63, 0x63, 0x3f, 0x3d, 0x2f,
-    0x2f, 0x2d, 0x26, 0x25, 0x25, 0x25, 0x25, 0x23, 0x18, 0x10, 0x04, 0x04,
-    0x04, 0x03, 0x01, 0x02, 0x01, 0x02, 0x03, 0x13, 0x2a, 0x35, 0x27, 0x20,
-    0x18, 0x28, 0x23, 0x10, 0x18, 0x20, 0x21, 0x03, 0x01, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x8f, 0x98, 0x98,
-    0x98, 0x87, 0x87, 0x87, 0x8a, 0x8a, 0x7c, 0x7c, 0x75, 0x75, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x75, 0x75, 0x75, 0x75,
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x65, 0x61, 0x61, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x41, 0x41, 0x39, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x3d, 0x3d,
-    0x3d, 0x3d, 0x3d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49,
-    0x49, 0x49, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x5d, 0x5d,
-    0x5d, 0x5d, 0x5d, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x65, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x4a,
-    0x44, 0x44, 0x42, 0x42, 0x42, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x33, 0x34,
-    0x34, 0x2c, 0x2b, 0x29, 0x28, 0x28, 0x25, 0x25, 0x25, 0x25, 0x2c, 0x33,
-    0x41, 0x67, 0x85, 0x80, 0x81, 0x63, 0x7e, 0xa8, 0xa8, 0xa8, 0x8e, 0x8e,
-    0xa8, 0x8e, 0x8e, 0x8e, 0x95, 0x95, 0x93, 0x93, 0xa9, 0xb4, 0xb4, 0xb4,
-    0xa9, 0x93, 0x7a, 0x7a, 0x68, 0x68, 0x4c, 0x4d, 0x3d, 0x3d, 0x4c, 0x6f,
-    0x63, 0x4e, 0x4e, 0x4e, 0x63, 0x7e, 0x63, 0x63, 0x63, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x4e, 0x4e, 0x4c, 0x3f, 0x3d, 0x2f, 0x2d, 0x2d, 0x2c, 0x25, 0x28,
-    0x22, 0x20, 0x10, 0x04, 0x04, 0x04, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00,
-    0x00, 0x02, 0x02, 0x0b, 0x16, 0x35, 0x2e, 0x20, 0x18, 0x20, 0x2e, 0x18,
-    0x10, 0x18, 0x2a, 0x08, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x8f, 0x8f, 0x98, 0x98, 0x87, 0x87, 0x87, 0x87,
-    0x8a, 0x8a, 0x7c, 0x7c, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x75, 0x75, 0x75, 0x65, 0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x53,
-    0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x41, 0x41, 0x41, 0x41, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x4d, 0x4d,
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x61, 0x61, 0x5a, 0x5a, 0x5a, 0x53, 0x4a, 0x4a, 0x44, 0x44, 0x42, 0x42,
-    0x42, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x33, 0x33, 0x34, 0x2c, 0x2b, 0x29,
-    0x28, 0x25, 0x25, 0x25, 0x2c, 0x33, 0x36, 0x44, 0x67, 0x85, 0x96, 0x93,
-    0x8e, 0x8e, 0x8b, 0x8b, 0x8b, 0x8b, 0x8e, 0x8e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x81, 0x8e, 0x81, 0x93, 0xa9, 0xa9, 0xa9, 0x93, 0x81, 0x81, 0x63, 0x63,
-    0x63, 0x63, 0x4e, 0x4c, 0x3f, 0x3f, 0x4c, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x7e, 0x7e, 0x63, 0x63, 0x63, 0x63, 0x4e, 0x4e, 0x4e, 0x4c, 0x3f, 0x3d,
-    0x3d, 0x2f, 0x2d, 0x25, 0x25, 0x23, 0x20, 0x10, 0x0b, 0x03, 0x02, 0x07,
-    0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x00, 0x01, 0x02, 0x00, 0x02, 0x03,
-    0x16, 0x2a, 0x35, 0x27, 0x18, 0x18, 0x22, 0x27, 0x10, 0x18, 0x22, 0x21,
-    0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
-    0x8f, 0x8f, 0x98, 0x87, 0x87, 0x87, 0x87, 0x87, 0x8a, 0x8a, 0x7c, 0x7c,
-    0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x65,
-    0x5a, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x41, 0x41,
-    0x41, 0x39, 0x39, 0x39, 0x36, 0x36, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x3d, 0x3d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x3d, 0x4d, 0x4d, 0x4d, 0x4d, 0x3d, 0x3d, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x49, 0x49, 0x49, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x61, 0x61, 0x5a, 0x5a,
-    0x53, 0x53, 0x4a, 0x4a, 0x44, 0x44, 0x42, 0x42, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x33, 0x33, 0x2c, 0x2c, 0x28, 0x28, 0x25, 0x25, 0x25, 0x33,
-    0x44, 0x4f, 0x6e, 0x7d, 0x97, 0xa9, 0xa9, 0xa8, 0xa8, 0x8b, 0x8b, 0x8b,
-    0x8b, 0x8b, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x8e, 0x8e, 0x8e,
-    0x8e, 0x8e, 0x8e, 0x81, 0x81, 0x7e, 0x63, 0x7e, 0x63, 0x63, 0x63, 0x63,
-    0x4e, 0x3f, 0x4e, 0x4e, 0x63, 0x63, 0x7e, 0x7e, 0x8b, 0x63, 0x4e, 0x4e,
-    0x4e, 0x3f, 0x3f, 0x3d, 0x3d, 0x3d, 0x2f, 0x2d, 0x26, 0x25, 0x25, 0x23,
-    0x18, 0x0c, 0x04, 0x03, 0x06, 0x06, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x0b, 0x1e, 0x2e, 0x35,
-    0x1e, 0x17, 0x17, 0x35, 0x20, 0x18, 0x18, 0x2a, 0x0f, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x8f, 0x8f, 0x87, 0x87,
-    0x87, 0x87, 0x87, 0x87, 0x8a, 0x8a, 0x7c, 0x7c, 0x75, 0x75, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x61, 0x5a, 0x61, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x41, 0x41, 0x41, 0x39, 0x39, 0x39,
-    0x36, 0x36, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x41, 0x41, 0x41, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x4d, 0x4d, 0x41, 0x41,
-    0x49, 0x49, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x41, 0x3d, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x41, 0x49, 0x41, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x5d,
-    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x5d, 0x5d, 0x61, 0x5a, 0x53, 0x53, 0x4a, 0x4a, 0x4a,
-    0x43, 0x43, 0x44, 0x44, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x33, 0x34, 0x33,
-    0x2c, 0x25, 0x28, 0x25, 0x25, 0x2c, 0x33, 0x4f, 0x6b, 0x7d, 0x92, 0x97,
-    0xba, 0xba, 0xa8, 0x8e, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x8e, 0x8e, 0x8e, 0x8e, 0x7e, 0x7e,
-    0x7e, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x7e, 0x7e, 0x63, 0x4e, 0x4e, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x4e, 0x4e, 0x3f, 0x3f, 0x3d, 0x3d, 0x2f, 0x2f,
-    0x39, 0x30, 0x2c, 0x25, 0x25, 0x20, 0x10, 0x08, 0x0b, 0x06, 0x06, 0x05,
-    0x05, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x01, 0x02, 0x01, 0x03, 0x01, 0x13, 0x24, 0x32, 0x2a, 0x17, 0x10, 0x27,
-    0x2e, 0x18, 0x10, 0x22, 0x17, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x01, 0x01, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x87, 0x87,
-    0x87, 0x87, 0x87, 0x87, 0x75, 0x75, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x65, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x36, 0x36, 0x36, 0x36, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x41,
-    0x41, 0x41, 0x41, 0x3d, 0x3d, 0x3d, 0x41, 0x41, 0x43, 0x41, 0x41, 0x4d,
-    0x4d, 0x4d, 0x3d, 0x49, 0x41, 0x41, 0x41, 0x39, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x39, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x49, 0x49, 0x41, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x5d, 0x5d, 0x5d,
-    0x61, 0x5d, 0x61, 0x5d, 0x5d, 0x67, 0x67, 0x5d, 0x5d, 0x67, 0x67, 0x5d,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x74, 0x67, 0x74, 0x74,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x5d, 0x5d,
-    0x5d, 0x5d, 0x5d, 0x53, 0x4f, 0x4f, 0x4f, 0x4f, 0x43, 0x41, 0x41, 0x43,
-    0x44, 0x3b, 0x3b, 0x34, 0x33, 0x33, 0x33, 0x2c, 0x2c, 0x2c, 0x25, 0x2c,
-    0x2c, 0x37, 0x5f, 0x75, 0x97, 0xa9, 0xa9, 0xba, 0xbd, 0xa8, 0x7e, 0x7e,
-    0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8e, 0x8e, 0x8b, 0x8b, 0x8b,
-    0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x7e, 0x7e, 0x8b, 0x8b, 0x8b, 0x8b,
-    0x9a, 0x9a, 0x9a, 0x8b, 0x7e, 0x63, 0x4e, 0x4e, 0x4c, 0x4c, 0x4e, 0x3f,
-    0x3f, 0x3f, 0x3f, 0x3d, 0x3d, 0x3d, 0x39, 0x2d, 0x33, 0x28, 0x23, 0x18,
-    0x08, 0x08, 0x0b, 0x09, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x02, 0x05, 0x02,
-    0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01,
-    0x03, 0x03, 0x16, 0x24, 0x2e, 0x22, 0x18, 0x18, 0x35, 0x22, 0x10, 0x18,
-    0x1e, 0x0b, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
-    0x75, 0x75, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x6b, 0x6b, 0x6b, 0x6b, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x6b, 0x6b, 0x65,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x36, 0x36, 0x36, 0x36, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x41, 0x41, 0x41,
-    0x3d, 0x3d, 0x41, 0x41, 0x43, 0x41, 0x41, 0x3d, 0x3d, 0x4d, 0x41, 0x41,
-    0x43, 0x44, 0x44, 0x44, 0x44, 0x42, 0x42, 0x3b, 0x36, 0x43, 0x42, 0x44,
-    0x44, 0x44, 0x44, 0x3b, 0x4f, 0x44, 0x42, 0x42, 0x44, 0x4f, 0x4f, 0x4f,
-    0x44, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4b, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x60, 0x5f, 0x60, 0x5f, 0x6e, 0x5f, 0x60, 0x6d, 0x60,
-    0x6d, 0x6d, 0x6d, 0x6d, 0x5f, 0x6d, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x60,
-    0x5f, 0x6d, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x60, 0x60, 0x5f, 0x5f,
-    0x50, 0x50, 0x50, 0x50, 0x42, 0x42, 0x3b, 0x3b, 0x37, 0x37, 0x3c, 0x31,
-    0x31, 0x34, 0x2b, 0x2b, 0x28, 0x28, 0x28, 0x31, 0x55, 0x55, 0x99, 0x8f,
-    0xaf, 0xae, 0x93, 0x93, 0x93, 0x8e, 0x81, 0x81, 0x81, 0x7e, 0x7e, 0x7e,
-    0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x7e, 0x7e, 0x7e, 0x8e, 0x8e, 0x8e,
-    0x8e, 0x8e, 0x8e, 0x95, 0x8e, 0x8e, 0x95, 0x95, 0x8e, 0x7e, 0x7e, 0x8e,
-    0x80, 0x5b, 0x3d, 0x2f, 0x3d, 0x62, 0x3d, 0x4d, 0x4d, 0x4d, 0x5d, 0x5d,
-    0x44, 0x30, 0x2c, 0x25, 0x20, 0x10, 0x08, 0x0b, 0x0b, 0x0a, 0x0a, 0x05,
-    0x05, 0x05, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x0d, 0x1f,
-    0x32, 0x21, 0x17, 0x14, 0x2a, 0x35, 0x17, 0x14, 0x1e, 0x13, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x8f, 0x8f, 0x8f,
-    0x8f, 0x8f, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x75, 0x75, 0x6b, 0x6b,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x6b, 0x6b, 0x61, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x41, 0x41, 0x3d, 0x3d, 0x41, 0x41,
-    0x41, 0x41, 0x4d, 0x3d, 0x41, 0x41, 0x43, 0x42, 0x76, 0xb9, 0xcf, 0xcf,
-    0xcf, 0xcf, 0xcf, 0xcf, 0xd4, 0xcf, 0xcf, 0xd4, 0xd4, 0xcf, 0xcf, 0xcf,
-    0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xd4, 0xd4, 0xd4, 0xcf,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xda, 0xda, 0xd4, 0xd4, 0xd4, 0xd4, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xdc,
-    0xdc, 0xdc, 0xd4, 0xd4, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xd7, 0xe4, 0xe4, 0xe5, 0xe3, 0xe3, 0xe6, 0xd6, 0xe8,
-    0xd5, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1,
-    0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe8, 0xe1, 0xe2, 0xe1, 0xe1, 0xd5,
-    0xd5, 0xd5, 0xd5, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xce,
-    0xd6, 0xd6, 0xd4, 0xd4, 0xcf, 0xcf, 0xcf, 0xcf, 0xc5, 0xa2, 0xa2, 0xa2,
-    0x8c, 0x8c, 0x8c, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
-    0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
-    0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0xad, 0xad, 0xc8, 0xad, 0xad,
-    0xad, 0xc8, 0xad, 0x8c, 0xad, 0xad, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
-    0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
-    0x79, 0x79, 0x79, 0x79, 0x7f, 0x7f, 0x7f, 0x7f, 0x8f, 0x8f, 0x87, 0x87,
-    0x87, 0x87, 0x87, 0x87, 0x75, 0x6b, 0x6b, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x61, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53,
-    0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x36, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x41, 0x41, 0x41, 0x41, 0x41, 0x39, 0x41, 0x41,
-    0x41, 0x43, 0x7f, 0xcf, 0xd4, 0xdc, 0xdc, 0xdc, 0xd7, 0xd7, 0xd7, 0xd7,
-    0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xdc, 0xdf, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7,
-    0xdb, 0xdf, 0xdb, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdc,
-    0xdc, 0xdc, 0xdc, 0xdc, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-    0xe4, 0xdf, 0xdf, 0xdf, 0xdf, 0xdb, 0xdd, 0xdb, 0xdb, 0xdb, 0xdf, 0xdf,
-    0xdd, 0xe7, 0xdd, 0xdb, 0xdb, 0xdb, 0xdb, 0xdd, 0xdb, 0xdb, 0xdb, 0xdb,
-    0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xc8, 0xdb, 0xdb, 0xdb, 0xea, 0xf0,
-    0xee, 0xef, 0xef, 0xee, 0xe5, 0xe3, 0xe3, 0xec, 0xec, 0xe3, 0xe3, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xec, 0xec, 0xec, 0xe6, 0xe6, 0xe6,
-    0xec, 0xec, 0xec, 0xec, 0xec, 0xe3, 0xe3, 0xe3, 0xe3, 0xde, 0xdc, 0xdc,
-    0xdc, 0xd4, 0xe0, 0xde, 0xe3, 0xde, 0xe0, 0xe3, 0xe4, 0xdc, 0xdf, 0xd7,
-    0xd7, 0xd7, 0xcc, 0xc8, 0xc8, 0xad, 0xad, 0xa5, 0xad, 0xad, 0xa5, 0xa5,
-    0xa5, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xdd, 0xdd, 0xc6,
-    0xc6, 0xc6, 0xc6, 0xa5, 0xa0, 0xa0, 0xa0, 0xa0, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
-    0x75, 0x6b, 0x65, 0x65, 0x61, 0x61, 0x61, 0x61, 0x61, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x61,
-    0x5a, 0x5a, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x36,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x41, 0x41, 0x41, 0x41, 0x39, 0x44, 0x99, 0xd4, 0xdc,
-    0xd7, 0xdb, 0xdb, 0xdb, 0xd7, 0xd7, 0xd7, 0xdf, 0xd7, 0xd7, 0xd7, 0xd7,
-    0xdb, 0xd7, 0xd7, 0xd7, 0xdb, 0xdb, 0xdb, 0xdb, 0xdd, 0xdb, 0xdd, 0xdb,
-    0xdb, 0xdf, 0xdb, 0xdf, 0xdf, 0xdf, 0xd7, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-    0xdb, 0xdb, 0xdb, 0xdb, 0xe4, 0xe4, 0xdc, 0xdc, 0xe4, 0xe4, 0xe4, 0xdf,
-    0xdf, 0xdf, 0xdb, 0xdb, 0xdb, 0xdf, 0xdf, 0xdf, 0xdd, 0xdd, 0xdb, 0xdb,
-    0xdb, 0xdf, 0xdf, 0xdb, 0xdb, 0xdd, 0xdb, 0xdb, 0xd7, 0xd7, 0xd7, 0xd7,
-    0xdb, 0xdb, 0xdb, 0xdf, 0xdd, 0xe7, 0xeb, 0xef, 0xef, 0xef, 0xec, 0xe3,
-    0xe3, 0xe3, 0xec, 0xe3, 0xe3, 0xe3, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xec,
-    0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xe3, 0xe3,
-    0xde, 0xde, 0xda, 0xe4, 0xdc, 0xe4, 0xe4, 0xe4, 0xdc, 0xdc, 0xe4, 0xe3,
-    0xe3, 0xe3, 0xe4, 0xe4, 0xdf, 0xdb, 0xdd, 0xc8, 0xc8, 0xc8, 0xad, 0xad,
-    0xad, 0xa5, 0xa5, 0xa0, 0xa5, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
-    0xa0, 0xa0, 0xa5, 0xa5, 0xa5, 0xa5, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
-    0xa0, 0xa0, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa5, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xa5,
-    0xa0, 0xa0, 0xa0, 0xa0, 0xa5, 0xa5, 0xa5, 0xa5, 0xa0, 0xa5, 0xa0, 0xa5,
-    0xa0, 0xa5, 0xa0, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x87, 0x87, 0x87, 0x87, 0x87, 0x6e, 0x75, 0x6b, 0x65, 0x61,
-    0x61, 0x61, 0x5a, 0x61, 0x61, 0x61, 0x61, 0x61, 0x65, 0x65, 0x65, 0x65,
-    0x61, 0x61, 0x61, 0x61, 0x65, 0x65, 0x65, 0x61, 0x5a, 0x5a, 0x5a, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x36, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x41, 0x36, 0x3b, 0x99, 0xd4, 0xdc, 0xd7, 0xdb, 0xdd, 0xdb, 0xdb,
-    0xdb, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xdf, 0xd7, 0xdb, 0xdb, 0xd7, 0xdf,
-    0xdb, 0xdd, 0xdb, 0xdb, 0xdb, 0xdf, 0xdb, 0xdf, 0xd7, 0xdf, 0xdf, 0xd7,
-    0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdb, 0xdb, 0xdb, 0xdb, 0xdd, 0xdf,
-    0xdf, 0xe4, 0xe4, 0xe4, 0xdc, 0xe4, 0xe4, 0xdc, 0xe4, 0xdf, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdb, 0xdb, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-    0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xdb, 0xdb, 0xe4, 0xe4,
-    0xe4, 0xe4, 0xee, 0xef, 0xf2, 0xec, 0xec, 0xec, 0xec, 0xec, 0xe6, 0xe6,
-    0xe6, 0xe6, 0xe6, 0xe8, 0xe8, 0xe6, 0xe6, 0xec, 0xec, 0xec, 0xec, 0xec,
-    0xec, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe4, 0xdc, 0xdc, 0xdc,
-    0xdc, 0xe7, 0xe4, 0xe5, 0xe4, 0xe4, 0xe4, 0xe5, 0xe5, 0xda, 0xe4, 0xdf,
-    0xdd, 0xc8, 0xc8, 0xc6, 0xad, 0xad, 0xad, 0xc6, 0xa5, 0xa5, 0xa0, 0xa0,
-    0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa5, 0xc6, 0xa0, 0xa0, 0xa0, 0xa5, 0xa5, 0xa5, 0xa5, 0xc6,
-    0xc6, 0xc6, 0xc6, 0xa5, 0xa5, 0xa5, 0xa0, 0xa0, 0xa5, 0xc6, 0xc6, 0xc6,
-    0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xa5, 0xa5, 0xa5, 0xa0, 0xa0,
-    0xa5, 0xa5, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
-    0xa5, 0xa5, 0xa5, 0xa5, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x75, 0x6b, 0x65, 0x61, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x5a, 0x5a, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
-    0x61, 0x65, 0x65, 0x61, 0x5a, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x36, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x36, 0x3b, 0x50,
-    0xcf, 0xdc, 0xdf, 0xdb, 0xdd, 0xdb, 0xdb, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7,
-    0xd7, 0xdf, 0xdc, 0xdc, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xdb, 0xd7, 0xd7,
-    0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdf, 0xdf, 0xdf, 0xd7, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xdb, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe4, 0xdf,
-    0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdb, 0xdf, 0xe4, 0xdc, 0xe4, 0xe4,
-    0xe4, 0xe4, 0xe4, 0xdc, 0xdc, 0xdf, 0xdf, 0xdf, 0xdf, 0xe4, 0xdf, 0xdc,
-    0xdc, 0xdf, 0xdf, 0xdf, 0xdf, 0xdb, 0xdb, 0xd7, 0xd7, 0xd7, 0xdc, 0xdc,
-    0xdc, 0xd7, 0xd7, 0xdb, 0xeb, 0xea, 0xed, 0xec, 0xec, 0xec, 0xec, 0xec,
-    0xe6, 0xe8, 0xe6, 0xe6, 0xec, 0xe6, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
-    0xe8, 0xe8, 0xe6, 0xe6, 0xec, 0xe3, 0xe3, 0xe3, 0xe3, 0xde, 0xe3, 0xe3,
-    0xe3, 0xe3, 0xe3, 0xe4, 0xdf, 0xd7, 0xdf, 0xe4, 0xef, 0xed, 0xe3, 0xe3,
-    0xe3, 0xe3, 0xda, 0xe5, 0xe4, 0xda, 0xd7, 0xd7, 0xc8, 0xc8, 0xad, 0xc6,
-    0xad, 0xad, 0xad, 0xad, 0xa5, 0xa5, 0xc6, 0xa5, 0xa0, 0xa0, 0xa0, 0xa0,
-    0xa0, 0xa0, 0xa5, 0xa5, 0xa5, 0xad, 0xad, 0xad, 0xc6, 0xc6, 0xc6, 0xc6,
-    0xc6, 0xc6, 0xa5, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
-    0xa5, 0xc6, 0xa0, 0xa5, 0xa5, 0xa5, 0xc6, 0xc6, 0xc6, 0xad, 0xdd, 0xc6,
-    0xc6, 0xc6, 0xc6, 0xc6, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa0, 0xa0,
-    0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x6e,
-    0x75, 0x6b, 0x61, 0x61, 0x5a, 0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x61,
-    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x65, 0x61, 0x5a,
-    0x5a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x41, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x30, 0x36, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x36, 0x36, 0x3b, 0x83, 0xda, 0xd7, 0xdb, 0xdd,
-    0xdd, 0xdb, 0xd7, 0xd7, 0xd7, 0xa2, 0xa2, 0xdc, 0xd7, 0xd7, 0x77, 0xc5,
-    0xd7, 0xdf, 0xcc, 0x82, 0xd7, 0xd7, 0xd7, 0xdc, 0xcc, 0x82, 0x70, 0x82,
-    0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xcc, 0xcc, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-    0xdc, 0xdc, 0xdc, 0xe4, 0xdc, 0xa2, 0xcc, 0xdc, 0xdf, 0xdf, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xdf, 0xdf, 0xdc, 0xb9, 0x94, 0x94, 0x94, 0x94, 0xa6, 0xa2,
-    0xa2, 0xcc, 0xdc, 0xdc, 0xe4, 0xe4, 0xcc, 0xa2, 0x82, 0xc5, 0xdc, 0xdc,
-    0xdf, 0xdf, 0xd7, 0xa2, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xa2, 0xd7,
-    0xeb, 0xef, 0xec, 0xd6, 0xd5, 0xc2, 0xc2, 0xc9, 0xc9, 0xc9, 0xc2, 0xd5,
-    0xe6, 0xe6, 0xe8, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xd0, 0xc9, 0xc2, 0xd6,
-    0xe3, 0xe3, 0xd4, 0x99, 0xa6, 0x99, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xdc,
-    0xf0, 0xf0, 0xef, 0xed, 0xe5, 0xe3, 0xde, 0xc4, 0xd4, 0xde, 0xdc, 0xda,
-    0x82, 0xd7, 0xcc, 0xad, 0x52, 0xc6, 0xc6, 0xad, 0x32, 0x32, 0x32, 0x32,
-    0x32, 0x32, 0x32, 0x32, 0x79, 0xa5, 0xa5, 0xa5, 0x32, 0x32, 0x32, 0x32,
-    0x32, 0x32, 0x52, 0x52, 0x79, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
-    0xa5, 0x52, 0x52, 0x52, 0x79, 0x79, 0x52, 0x52, 0x52, 0xa5, 0xc6, 0xc6,
-    0x79, 0x32, 0x32, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0xc8, 0xc6, 0xc6,
-    0x32, 0x12, 0x52, 0xa5, 0xa5, 0xa5, 0xa0, 0x79, 0x11, 0x32, 0xa0, 0xa0,
-    0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7c, 0x75, 0x6d, 0x6d, 0x5f, 0x5f,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-    0x61, 0x61, 0x61, 0x61, 0x61, 0x65, 0x61, 0x5a, 0x53, 0x53, 0x53, 0x53,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x39, 0x39,
-    0x36, 0x44, 0x34, 0xb9, 0xdc, 0xd7, 0xdb, 0xdd, 0xdb, 0xdb, 0xd7, 0xd7,
-    0xd7, 0xa2, 0x77, 0xdc, 0xd7, 0xd7, 0x58, 0xc5, 0xd7, 0xd7, 0xc5, 0x58,
-    0xd7, 0xd7, 0xd7, 0xdc, 0x82, 0x83, 0xd4, 0x94, 0x82, 0xdc, 0xdc, 0xdc,
-    0xdc, 0xa2, 0xa2, 0xdc, 0xdf, 0xdf, 0xdf, 0xdf, 0xdc, 0xdc, 0xe4, 0xdc,
-    0xdc, 0x82, 0xcc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdf, 0xdf, 0xdf, 0xdc,
-    0xda, 0xcf, 0xb9, 0xb9, 0xb9, 0xb9, 0xa6, 0xb9, 0x94, 0x94, 0xe4, 0xdc,
-    0xe4, 0xdc, 0x83, 0xcf, 0xd4, 0x83, 0xcc, 0xdc, 0xdc, 0xdc, 0xdf, 0xcc,
-    0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xcc, 0xcc, 0xcc, 0xef, 0xef, 0xe6, 0xd0,
-    0xc0, 0xc0, 0xd0, 0xd2, 0xd2, 0xd2, 0xd5, 0xe8, 0xec, 0xec, 0xe6, 0xd5,
-    0xc9, 0xc9, 0xd0, 0xc0, 0xc9, 0xb2, 0x8f, 0xc4, 0xde, 0xe3, 0xcd, 0x99,
-    0xcf, 0xd4, 0xde, 0xd4, 0xd4, 0xcf, 0xda, 0xee, 0xef, 0xee, 0xcf, 0xa6,
-    0xe3, 0xe3, 0xe6, 0x99, 0xcf, 0xda, 0xda, 0xcc, 0x40, 0xdb, 0xc6, 0xad,
-    0x52, 0xc6, 0xc6, 0xc6, 0x79, 0xc6, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x79,
-    0x32, 0xad, 0xad, 0xad, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x8c, 0x8c,
-    0xc6, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x52, 0xad, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xc6, 0xc6, 0xc6, 0x32, 0x52, 0xad, 0xc6,
-    0xc8, 0xc8, 0xc8, 0xc8, 0x32, 0x79, 0xc6, 0xc6, 0x1c, 0x32, 0x11, 0x52,
-    0xa5, 0xa5, 0x52, 0x11, 0x11, 0x11, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
-    0xa0, 0xa0, 0xa0, 0xa0, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x75, 0x75, 0x6d, 0x6d, 0x5f, 0x5f, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x61, 0x61,
-    0x61, 0x61, 0x5a, 0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x41, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x36, 0x36, 0x36, 0x36,
-    0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x39, 0x39, 0x39, 0x36, 0x37, 0xcf,
-    0xdc, 0xd7, 0xdb, 0xdb, 0xdb, 0xdb, 0xd7, 0xd7, 0xdf, 0xa2, 0x58, 0xcc,
-    0xd7, 0xdc, 0x70, 0xa2, 0xcc, 0xd7, 0xa2, 0x58, 0xd7, 0xd7, 0xdc, 0x82,
-    0x82, 0xdc, 0xa2, 0xdc, 0xa2, 0x82, 0xdc, 0xdc, 0xdc, 0xa2, 0xa2, 0xdc,
-    0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0x82, 0xcc, 0xdc,
-    0xdc, 0xdc, 0xdc, 0xdc, 0xdf, 0xdf, 0xdf, 0xdc, 0xdc, 0x83, 0xb9, 0xb9,
-    0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xdc, 0xe4, 0xdc, 0xdc, 0x82, 0xcc, 0xd4,
-    0xcf, 0xd4, 0x77, 0xcc, 0xdc, 0xdc, 0xd7, 0x82, 0xa2, 0xa2, 0xcc, 0xcc,
-    0xcc, 0xdc, 0xdc, 0xe7, 0xef, 0xed, 0xd6, 0x92, 0xd2, 0xd2, 0xd2, 0xd2,
-    0xd2, 0xd2, 0xc9, 0xd6, 0xec, 0xe3, 0xd6, 0x7f, 0xc2, 0xc9, 0xc9, 0xb2,
-    0x6e, 0x6e, 0x99, 0xde, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe5, 0xda,
-    0xda, 0xc5, 0xda, 0xf3, 0xee, 0xe5, 0xd4, 0xa6, 0xe3, 0xe6, 0xd6, 0xa6,
-    0xcf, 0xda, 0xcc, 0x8c, 0x52, 0xdd, 0xdd, 0xc6, 0x52, 0xc6, 0xc6, 0x79,
-    0x52, 0xa5, 0xc6, 0xc6, 0xc6, 0xc6, 0xad, 0x79, 0x32, 0xc6, 0xad, 0x79,
-    0x32, 0x52, 0x8c, 0x8c, 0x8c, 0x8c, 0xc8, 0xc8, 0xc6, 0xeb, 0xeb, 0xdd,
-    0xdd, 0xeb, 0xdd, 0xdd, 0xad, 0xdd, 0xe7, 0xeb, 0xe7, 0xe7, 0xeb, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0x52, 0x79, 0xc6, 0xc6, 0xdd, 0xdd, 0xc8, 0xc8,
-    0x52, 0x79, 0xc6, 0xc6, 0x32, 0x52, 0x52, 0x11, 0x52, 0x52, 0x11, 0x52,
-    0x52, 0x11, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x6d, 0x6d,
-    0x6d, 0x5f, 0x5f, 0x5f, 0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x5a, 0x61, 0x61, 0x5a, 0x53, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x41, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x36, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x36, 0x36, 0x36, 0x36, 0x36,
-    0x36, 0x36, 0x39, 0x39, 0x39, 0x36, 0x3b, 0xcf, 0xda, 0xd7, 0xdb, 0xdb,
-    0xdb, 0xdb, 0xdb, 0xdb, 0xd7, 0xcc, 0x82, 0x58, 0x58, 0x58, 0x56, 0x56,
-    0x58, 0x77, 0x58, 0xc5, 0xdc, 0xdc, 0xcc, 0x82, 0xda, 0xdc, 0xa2, 0xdc,
-    0xdc, 0xa2, 0xcc, 0xdc, 0xdc, 0xcc, 0x82, 0x82, 0x77, 0x77, 0x82, 0x82,
-    0x82, 0x82, 0xdc, 0xdc, 0xdc, 0xc5, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0xa2, 0xdc, 0xe4, 0xdc, 0xa2, 0xdc, 0xdc, 0xe4, 0xdc, 0xe4, 0xdc,
-    0xdc, 0xdf, 0xdf, 0xe4, 0xa2, 0xcc, 0xdf, 0xcc, 0xcc, 0xdf, 0xd7, 0x8c,
-    0xd7, 0xdf, 0xd7, 0x8c, 0xdd, 0xe7, 0xeb, 0xf0, 0xf0, 0xf0, 0xef, 0xef,
-    0xe4, 0xe3, 0xe6, 0xc0, 0xc0, 0xbc, 0xbc, 0xbc, 0xae, 0xb0, 0x8f, 0xc4,
-    0xe3, 0xde, 0xd6, 0x99, 0xe3, 0xe3, 0xe6, 0xd6, 0xd6, 0xd6, 0xb9, 0xd4,
-    0xed, 0xee, 0xef, 0xe5, 0xda, 0xdf, 0xd7, 0xc5, 0xd7, 0xf3, 0xe4, 0xdc,
-    0xe5, 0xe5, 0xe3, 0xb9, 0xa6, 0xa6, 0xa6, 0x82, 0x58, 0x52, 0x8c, 0x8c,
-    0xc6, 0xdb, 0xdb, 0xdd, 0x79, 0xdd, 0xdd, 0xc6, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0xad, 0xc6, 0xc6, 0xc6, 0x79, 0x52, 0x8c, 0x8c,
-    0x8c, 0xc8, 0xc8, 0xc6, 0xdd, 0xeb, 0xeb, 0xeb, 0xc6, 0xdd, 0xeb, 0xeb,
-    0xdd, 0xdd, 0xdd, 0xdb, 0xdb, 0xdb, 0xc8, 0xc6, 0xc6, 0xdd, 0xdd, 0xdd,
-    0xc6, 0x8c, 0x52, 0x52, 0x8c, 0x8c, 0x52, 0x52, 0x79, 0xc6, 0xc6, 0xc6,
-    0x52, 0x79, 0xa5, 0x79, 0x11, 0x11, 0x52, 0xa5, 0x79, 0x11, 0xa0, 0xa0,
-    0xa0, 0xa0, 0xa0, 0xa0, 0xa5, 0xa5, 0xa5, 0xa5, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x6d, 0x6d, 0x6d, 0x5f, 0x5f, 0x5f,
-    0x54, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x54, 0x53, 0x4a, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x5a, 0x5a, 0x5a, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x41, 0x41, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x39, 0x39,
-    0x39, 0x36, 0x3b, 0xcf, 0xda, 0xd7, 0xdb, 0xdb, 0xdd, 0xdd, 0xdd, 0xdb,
-    0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xdf, 0xd7,
-    0xd7, 0xd7, 0xdf, 0xd7, 0xd7, 0xd7, 0xdf, 0xd7, 0xd7, 0xdf, 0xdf, 0xdc,
-    0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc,
-    0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xd7, 0xd7, 0xdf, 0xdf,
-    0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdb, 0xdb, 0xdb,
-    0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdf, 0xdf, 0xd7, 0xdd, 0xdd,
-    0xeb, 0xf9, 0xf9, 0xf9, 0xf7, 0xf0, 0xef, 0xe4, 0xe4, 0xe3, 0xe6, 0xe8,
-    0xe2, 0xe2, 0xe2, 0xe2, 0xd5, 0xd5, 0xd6, 0xde, 0xde, 0xd4, 0xde, 0xde,
-    0xe3, 0xe3, 0xe3, 0xec, 0xec, 0xec, 0xed, 0xed, 0xee, 0xef, 0xef, 0xee,
-    0xea, 0xea, 0xea, 0xf0, 0xf5, 0xe5, 0xe4, 0xe5, 0xe4, 0xe5, 0xed, 0xef,
-    0xe5, 0xda, 0xd7, 0xd7, 0xc8, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xe9,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xc6, 0xc8, 0xdd, 0xdb, 0xdb, 0xdb,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xeb, 0xeb, 0xeb, 0xeb,
-    0xeb, 0xf1, 0xeb, 0xeb, 0xeb, 0xf1, 0xeb, 0xf1, 0xf1, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xe7, 0xdd, 0xc8, 0xdd, 0xc6, 0xad, 0xc6, 0xc6, 0xc6, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
-    0xa5, 0xa5, 0xa5, 0xa5, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x6d, 0x6d, 0x6d, 0x6d, 0x5f, 0x54, 0x54, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x54, 0x54, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x41, 0x41, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x36, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x39, 0x39, 0x39, 0x36, 0x37, 0xcf,
-    0xdc, 0xd7, 0xd7, 0xdb, 0xdb, 0xdd, 0xdd, 0xdd, 0xdb, 0xdb, 0xdb, 0xd7,
-    0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xdb, 0xdb,
-    0xdb, 0xdb, 0xdb, 0xdb, 0xdd, 0xdb, 0xdb, 0xdf, 0xd7, 0xd7, 0xdf, 0xdf,
-    0xdc, 0xdc, 0xdc, 0xdc, 0xdf, 0xdf, 0xdf, 0xdf, 0xd7, 0xdf, 0xd7, 0xdf,
-    0xdf, 0xd7, 0xd7, 0xd7, 0xdf, 0xdf, 0xdf, 0xdb, 0xdd, 0xdd, 0xdd, 0xdb,
-    0xdb, 0xdf, 0xdb, 0xdb, 0xdb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xdb, 0xdb,
-    0xdd, 0xdd, 0xdd, 0xdb, 0xdb, 0xdb, 0xdd, 0xeb, 0xf1, 0xf9, 0xf9, 0xfc,
-    0xf9, 0xf0, 0xe4, 0xe4, 0xe4, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3,
-    0xe3, 0xe3, 0xe5, 0xe5, 0xe4, 0xda, 0xe3, 0xe3, 0xe4, 0xe4, 0xe4, 0xee,
-    0xef, 0xef, 0xee, 0xee, 0xef, 0xef, 0xe4, 0xea, 0xea, 0xea, 0xf5, 0xf5,
-    0xea, 0xe4, 0xe4, 0xe5, 0xe4, 0xe5, 0xe4, 0xea, 0xdb, 0xdb, 0xdb, 0xdb,
-    0xdb, 0xdb, 0xdb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xeb, 0xdd, 0xdd, 0xdb, 0xdb, 0xea, 0xe7, 0xeb, 0xeb, 0xeb,
-    0xeb, 0xeb, 0xeb, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf6, 0xf6,
-    0xf7, 0xf1, 0xf1, 0xf1, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf1, 0xf1,
-    0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xe7, 0xe7, 0xeb, 0xe7, 0xdd,
-    0xdd, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xa5, 0xa5, 0xa0, 0xa0, 0xa0,
-    0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa5, 0xa5, 0xa5, 0xa5,
-    0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d,
-    0x5f, 0x5f, 0x54, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4a, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x4a, 0x4a,
-    0x4a, 0x43, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x41, 0x41,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x36, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x36, 0x36, 0x36,
-    0x36, 0x36, 0x39, 0x39, 0x36, 0x3b, 0x34, 0xcf, 0xdc, 0xd7, 0xd7, 0xdb,
-    0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd7, 0xd7, 0xdb, 0xdb,
-    0xd7, 0xd7, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xdb, 0xdb, 0xdf, 0xd7, 0xdf, 0xdf, 0xdf,
-    0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb,
-    0xdb, 0xdb, 0xdb, 0xdb, 0xdd, 0xdd, 0xdd, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xdb, 0xdb, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdb, 0xdd, 0xdd, 0xeb, 0xf7, 0xf7, 0xf9, 0xf9, 0xf0, 0xe4, 0xe4, 0xdc,
-    0xe5, 0xe3, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xee, 0xef, 0xee, 0xef,
-    0xef, 0xe4, 0xee, 0xdc, 0xe4, 0xeb, 0xf0, 0xf0, 0xf0, 0xf3, 0xee, 0xee,
-    0xe5, 0xe4, 0xea, 0xdb, 0xdb, 0xea, 0xf0, 0xdb, 0xea, 0xea, 0xea, 0xea,
-    0xea, 0xea, 0xdb, 0xe9, 0xdb, 0xdb, 0xeb, 0xdd, 0xe9, 0xe9, 0xe9, 0xe9,
-    0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xe9, 0xe9, 0xe9, 0xe9, 0xeb, 0xeb,
-    0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xf1, 0xeb, 0xeb, 0xeb, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf7, 0xf7, 0xf7, 0xf7, 0xf6, 0xf6, 0xf6, 0xf1, 0xfb, 0xf7,
-    0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf1, 0xf1, 0xeb,
-    0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xdd, 0xdd, 0xc6, 0xc6,
-    0xc6, 0xc6, 0xc6, 0xa5, 0xa5, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
-    0xa0, 0xa0, 0xa0, 0xa0, 0xa5, 0xa5, 0xa5, 0xa5, 0x6d, 0x6d, 0x6d, 0x6d,
-    0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x5f, 0x5f, 0x4b, 0x4b,
-    0x42, 0x42, 0x45, 0x45, 0x45, 0x45, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x4a, 0x4a, 0x43, 0x43, 0x45, 0x45, 0x43, 0x43, 0x43, 0x43, 0x4a, 0x4a,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x36, 0x36,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x41, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-    0x3b, 0x34, 0x3c, 0xcc, 0xd7, 0xdb, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7,
-    0xdb, 0xdb, 0xdb, 0xdb, 0xd7, 0xd7, 0xdb, 0xdb, 0xd7, 0xd7, 0xdb, 0xdb,
-    0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd7, 0xdb, 0xd7, 0xdb, 0xdb,
-    0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb,
-    0xdb, 0xdb, 0xdf, 0xd7, 0xdf, 0xdf, 0xd7, 0xd7, 0xdf, 0xdf, 0xdb, 0xdb,
-    0xdd, 0xdd, 0xdd, 0xdb, 0xdb, 0xdf, 0xdf, 0xdf, 0xdb, 0xdb, 0xdb, 0xdb,
-    0xdb, 0xd7, 0xdf, 0xdf, 0xdb, 0xdb, 0xdb, 0xdb, 0xdd, 0xdd, 0xe7, 0xeb,
-    0xf0, 0xf5, 0xf0, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe3, 0xe3, 0xe5, 0xe4,
-    0xea, 0xf0, 0xf7, 0xf7, 0xf1, 0xf7, 0xf7, 0xf5, 0xeb, 0xe7, 0xeb, 0xf0,
-    0xf7, 0xf9, 0xf7, 0xf7, 0xf0, 0xf0, 0xef, 0xe5, 0xe5, 0xdf, 0xdb, 0xdb,
-    0xdb, 0xea, 0xea, 0xdb, 0xdb, 0xe9, 0xdb, 0xe9, 0xea, 0xdb, 0xe9, 0xdb,
-    0xdb, 0xdb, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xeb, 0xeb, 0xeb, 0xeb,
-    0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf7, 0xf1, 0xf7, 0xf1, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xf7, 0xf7, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xfb, 0xf6, 0xf6,
-    0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xeb, 0xdd, 0xdd, 0xc6, 0xad, 0xc6, 0xc6, 0xc6, 0xc6,
-    0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
-    0xa0, 0xa0, 0xa5, 0xa5, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d,
-    0x6d, 0x6d, 0x6d, 0x6d, 0x5f, 0x5f, 0x4b, 0x45, 0x42, 0x42, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x43, 0x43, 0x43, 0x43,
-    0x45, 0x45, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x43, 0x43,
-    0x43, 0x43, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3b, 0x34, 0x35, 0xcc,
-    0xdb, 0xdb, 0xdb, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xdb, 0xdb, 0xdd, 0xdb,
-    0xd7, 0xd7, 0xdb, 0xdb, 0xd7, 0xd7, 0xdb, 0xdb, 0xdb, 0xd7, 0xdb, 0xdb,
-    0xdb, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xdb, 0xdb, 0xdb, 0xdb, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd7, 0xdf,
-    0xd7, 0xdf, 0xd7, 0xdf, 0xdf, 0xd7, 0xdb, 0xdb, 0xdd, 0xdd, 0xdb, 0xdb,
-    0xdf, 0xdf, 0xdf, 0xd7, 0xdb, 0xdb, 0xdb, 0xdb, 0xdf, 0xd7, 0xdf, 0xd7,
-    0xd7, 0xdf, 0xdb, 0xdb, 0xdd, 0xdd, 0xe7, 0xeb, 0xeb, 0xea, 0xe4, 0xe4,
-    0xe4, 0xee, 0xe4, 0xe3, 0xe3, 0xe3, 0xe4, 0xef, 0xf0, 0xf7, 0xf7, 0xf7,
-    0xf7, 0xf7, 0xf7, 0xf9, 0xeb, 0xf1, 0xf7, 0xf9, 0xf9, 0xf7, 0xf7, 0xf7,
-    0xf7, 0xf0, 0xe7, 0xed, 0xe5, 0xdf, 0xdb, 0xdb, 0xdd, 0xc8, 0xdb, 0xdb,
-    0xdb, 0xdb, 0xdb, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xdb, 0xe9, 0xe9, 0xe9,
-    0xe9, 0xe9, 0xe9, 0xe9, 0xeb, 0xeb, 0xeb, 0xeb, 0xf1, 0xeb, 0xf1, 0xf1,
-    0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf7, 0xf7, 0xf7, 0xf1, 0xf7, 0xf7,
-    0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6,
-    0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf1, 0xf6, 0xf1, 0xf1, 0xf1, 0xf1,
-    0xeb, 0xdd, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xa0, 0xa0, 0xa0, 0xa0,
-    0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa5, 0xa5,
-};
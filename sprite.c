@@ -0,0 +1,392 @@
+//*****************************************************************************
+//
+// sprite.c - Blitter for the run-length encoded RGB565 sprites, and the sprite
+//            push button.
+//
+// The bottom navigation buttons were TivaWare 4 BPP compressed images, which
+// GrImageDraw() decompresses and translates through the palette on every
+// press and release, a row at a time.  A sprite holds its pixels already in
+// the display format, as runs that the blitter writes to the SSD2119 data
+// port as single bursts, in one window; transparent pixels are skip runs,
+// which move the write cursor past them (see sprite.h for the format).
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup sprite_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "grlib/grlib.h"
+#include "grlib/widget.h"
+#include "grlib/pushbutton.h"
+#include "Kentec320x240x16_ssd2119_8bit.h"
+#include "compositor.h"
+#include "rleimage.h"
+#include "assetdraw.h"
+#include "sprite.h"
+
+//*****************************************************************************
+//
+// Returns true if a sprite has no transparent pixels.
+//
+//*****************************************************************************
+static bool
+SpriteOpaque(const uint8_t *pui8Sprite)
+{
+    int32_t i32Pixels;
+    uint8_t ui8Token;
+
+    i32Pixels = ((pui8Sprite[1] | (pui8Sprite[2] << 8)) *
+                 (pui8Sprite[3] | (pui8Sprite[4] << 8)));
+    for(pui8Sprite += 5; i32Pixels > 0; )
+    {
+        ui8Token = *pui8Sprite++;
+        if(ui8Token & SPRITE_TOKEN_RUN)
+        {
+            i32Pixels -= (ui8Token & (SPRITE_RUN_MAX - 1)) + 1;
+            pui8Sprite += 2;
+        }
+        else if(ui8Token & SPRITE_TOKEN_LITERAL)
+        {
+            i32Pixels -= (ui8Token & (SPRITE_LITERAL_MAX - 1)) + 1;
+            pui8Sprite += ((ui8Token & (SPRITE_LITERAL_MAX - 1)) + 1) * 2;
+        }
+        else
+        {
+            return(false);
+        }
+    }
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+//! Draws a sprite.
+//!
+//! \param pContext is a pointer to the drawing context to use.
+//! \param pui8Sprite is a pointer to the sprite, in the SPRITE_FMT_RGB565
+//! format.
+//! \param i32X is the X coordinate of the upper left corner of the sprite.
+//! \param i32Y is the Y coordinate of the upper left corner of the sprite.
+//!
+//! The sprite is clipped to the clipping region of the context and drawn
+//! directly on the display, in one window.  Its transparent pixels show what
+//! is beneath, including what the compositor held back there.  Like
+//! GrImageDraw(), the foreground and background colors of the context are not
+//! used.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SpriteDraw(const tContext *pContext, const uint8_t *pui8Sprite, int32_t i32X,
+           int32_t i32Y)
+{
+    const uint8_t *pui8Pixels;
+    tRectangle sImage, sRect;
+    int32_t i32Row, i32Col, i32Count, i32First, i32Last, i32NextX, i32NextY;
+    uint32_t ui32Color;
+    uint8_t ui8Token;
+
+    if(pui8Sprite[0] != SPRITE_FMT_RGB565)
+    {
+        return;
+    }
+
+    //
+    // Get the part of the sprite that is visible.
+    //
+    sImage.i16XMin = i32X;
+    sImage.i16YMin = i32Y;
+    sImage.i16XMax = i32X + (pui8Sprite[1] | (pui8Sprite[2] << 8)) - 1;
+    sImage.i16YMax = i32Y + (pui8Sprite[3] | (pui8Sprite[4] << 8)) - 1;
+    if(!GrRectIntersectGet(&sImage, (tRectangle *)&pContext->sClipRegion,
+                           &sRect))
+    {
+        return;
+    }
+
+    if(SpriteOpaque(pui8Sprite))
+    {
+        CompositorRectDraw(&sRect);
+    }
+    else
+    {
+        CompositorRectBlend(&sRect);
+    }
+    pui8Sprite += 5;
+
+    Kentec320x240x16_SSD2119StreamStart(sRect.i16XMin, sRect.i16YMin,
+                                        sRect.i16XMax - sRect.i16XMin + 1,
+                                        sRect.i16YMax - sRect.i16YMin + 1);
+
+    //
+    // Decode the rows down to the last visible one.  i32NextX and i32NextY
+    // are where the stream writes next; the cursor is only moved when a
+    // visible pixel is somewhere else, that is after skipped or clipped
+    // pixels.
+    //
+    i32NextX = sRect.i16XMin;
+    i32NextY = sRect.i16YMin;
+    for(i32Row = i32Y; i32Row <= sRect.i16YMax; i32Row++)
+    {
+        for(i32Col = i32X; i32Col <= sImage.i16XMax; i32Col += i32Count)
+        {
+            ui8Token = *pui8Sprite++;
+            if(ui8Token & SPRITE_TOKEN_RUN)
+            {
+                i32Count = (ui8Token & (SPRITE_RUN_MAX - 1)) + 1;
+                ui32Color = pui8Sprite[0] | (pui8Sprite[1] << 8);
+                pui8Pixels = 0;
+                pui8Sprite += 2;
+            }
+            else if(ui8Token & SPRITE_TOKEN_LITERAL)
+            {
+                i32Count = (ui8Token & (SPRITE_LITERAL_MAX - 1)) + 1;
+                ui32Color = 0;
+                pui8Pixels = pui8Sprite;
+                pui8Sprite += i32Count * 2;
+            }
+            else
+            {
+                i32Count = ui8Token + 1;
+                continue;
+            }
+
+            i32First = (i32Col > sRect.i16XMin) ? i32Col : sRect.i16XMin;
+            i32Last = i32Col + i32Count - 1;
+            if(i32Last > sRect.i16XMax)
+            {
+                i32Last = sRect.i16XMax;
+            }
+            if((i32Row < sRect.i16YMin) || (i32First > i32Last))
+            {
+                continue;
+            }
+
+            if((i32First != i32NextX) || (i32Row != i32NextY))
+            {
+                Kentec320x240x16_SSD2119StreamSkip(i32First, i32Row);
+            }
+            if(pui8Pixels)
+            {
+                Kentec320x240x16_SSD2119StreamData(pui8Pixels +
+                                                   ((i32First - i32Col) * 2),
+                                                   i32Last - i32First + 1);
+            }
+            else
+            {
+                Kentec320x240x16_SSD2119StreamFill(ui32Color,
+                                                   i32Last - i32First + 1);
+            }
+
+            //
+            // The stream wraps to the start of the next row at the right edge
+            // of the window.
+            //
+            i32NextX = i32Last + 1;
+            i32NextY = i32Row;
+            if(i32NextX > sRect.i16XMax)
+            {
+                i32NextX = sRect.i16XMin;
+                i32NextY++;
+            }
+        }
+    }
+
+    Kentec320x240x16_SSD2119StreamEnd();
+}
+
+//*****************************************************************************
+//
+// Paints a sprite push button the way grlib paints a rectangular push button,
+// with its image drawn by AssetDraw().  When the button is only repainted for
+// a press or a release, the fill is left out if it does not change color and
+// an image covers it: what shows through the transparent pixels of the image
+// is then already there.
+//
+//*****************************************************************************
+static void
+SpriteButtonPaint(tWidget *psWidget, bool bAll)
+{
+    tPushButtonWidget *psPush;
+    const uint8_t *pui8Image;
+    uint32_t ui32Fill;
+    tContext sCtx;
+    int32_t i32X, i32Y;
+
+    psPush = (tPushButtonWidget *)psWidget;
+    GrContextInit(&sCtx, psWidget->psDisplay);
+    GrContextClipRegionSet(&sCtx, &psWidget->sPosition);
+
+    ui32Fill = ((psPush->ui32Style & PB_STYLE_PRESSED) ?
+                psPush->ui32PressFillColor : psPush->ui32FillColor);
+
+    pui8Image = (((psPush->ui32Style & PB_STYLE_PRESSED) &&
+                  psPush->pui8PressImage) ? psPush->pui8PressImage :
+                 psPush->pui8Image);
+    if(!(psPush->ui32Style & PB_STYLE_IMG))
+    {
+        pui8Image = 0;
+    }
+
+    if((psPush->ui32Style & PB_STYLE_FILL) &&
+       (bAll || !pui8Image ||
+        (psPush->ui32FillColor != psPush->ui32PressFillColor)))
+    {
+        GrContextForegroundSet(&sCtx, ui32Fill);
+        GrRectFill(&sCtx, &psWidget->sPosition);
+    }
+
+    if(psPush->ui32Style & PB_STYLE_OUTLINE)
+    {
+        GrContextForegroundSet(&sCtx, psPush->ui32OutlineColor);
+        GrRectDraw(&sCtx, &psWidget->sPosition);
+    }
+
+    i32X = (psWidget->sPosition.i16XMin + psWidget->sPosition.i16XMax) / 2;
+    i32Y = (psWidget->sPosition.i16YMin + psWidget->sPosition.i16YMax) / 2;
+
+    if(pui8Image)
+    {
+        AssetDraw(&sCtx, pui8Image, i32X - (GrImageWidthGet(pui8Image) / 2),
+                  i32Y - (GrImageHeightGet(pui8Image) / 2));
+    }
+
+    if((psPush->ui32Style & PB_STYLE_TEXT) && psPush->pcText)
+    {
+        GrContextFontSet(&sCtx, psPush->psFont);
+        GrContextForegroundSet(&sCtx, psPush->ui32TextColor);
+        GrContextBackgroundSet(&sCtx, ui32Fill);
+        GrStringDrawCentered(&sCtx, psPush->pcText, -1, i32X, i32Y,
+                             psPush->ui32Style & PB_STYLE_TEXT_OPAQUE);
+    }
+}
+
+//*****************************************************************************
+//
+// Handles the pointer messages of a sprite push button.  The button is
+// pressed while the pointer is down on it, and calls its click handler on the
+// press, or on the release with PB_STYLE_RELEASE_NOTIFY.
+//
+//*****************************************************************************
+static int32_t
+SpriteButtonClick(tWidget *psWidget, uint32_t ui32Msg, int32_t i32X,
+                  int32_t i32Y)
+{
+    tPushButtonWidget *psPush;
+    bool bInside;
+
+    psPush = (tPushButtonWidget *)psWidget;
+    bInside = ((i32X >= psWidget->sPosition.i16XMin) &&
+               (i32X <= psWidget->sPosition.i16XMax) &&
+               (i32Y >= psWidget->sPosition.i16YMin) &&
+               (i32Y <= psWidget->sPosition.i16YMax));
+
+    switch(ui32Msg)
+    {
+        case WIDGET_MSG_PTR_DOWN:
+        {
+            if(!bInside)
+            {
+                return(0);
+            }
+
+            psPush->ui32Style |= PB_STYLE_PRESSED;
+            SpriteButtonPaint(psWidget, false);
+            if(psPush->pfnOnClick &&
+               !(psPush->ui32Style & PB_STYLE_RELEASE_NOTIFY))
+            {
+                psPush->pfnOnClick(psWidget);
+            }
+            return(1);
+        }
+
+        case WIDGET_MSG_PTR_MOVE:
+        {
+            if(bInside != ((psPush->ui32Style & PB_STYLE_PRESSED) != 0))
+            {
+                psPush->ui32Style ^= PB_STYLE_PRESSED;
+                SpriteButtonPaint(psWidget, false);
+            }
+            return(bInside);
+        }
+
+        case WIDGET_MSG_PTR_UP:
+        {
+            if(psPush->ui32Style & PB_STYLE_PRESSED)
+            {
+                psPush->ui32Style &= ~PB_STYLE_PRESSED;
+                SpriteButtonPaint(psWidget, false);
+                if(bInside && psPush->pfnOnClick &&
+                   (psPush->ui32Style & PB_STYLE_RELEASE_NOTIFY))
+                {
+                    psPush->pfnOnClick(psWidget);
+                }
+            }
+            return(bInside);
+        }
+
+        default:
+        {
+            return(0);
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Handles messages for a sprite push button.
+//!
+//! \param psWidget is a pointer to the push button widget.
+//! \param ui32Msg is the message.
+//! \param ui32Param1 is the first parameter to the message.
+//! \param ui32Param2 is the second parameter to the message.
+//!
+//! A sprite push button behaves as a grlib rectangular push button, without
+//! auto-repeat, but draws its images with AssetDraw().  It is declared with
+//! SpriteButton().
+//!
+//! \return Returns a value that depends on the message.
+//
+//*****************************************************************************
+int32_t
+SpriteButtonMsgProc(tWidget *psWidget, uint32_t ui32Msg, uint32_t ui32Param1,
+                    uint32_t ui32Param2)
+{
+    switch(ui32Msg)
+    {
+        case WIDGET_MSG_PAINT:
+        {
+            SpriteButtonPaint(psWidget, true);
+            return(1);
+        }
+
+        case WIDGET_MSG_PTR_DOWN:
+        case WIDGET_MSG_PTR_MOVE:
+        case WIDGET_MSG_PTR_UP:
+        {
+            return(SpriteButtonClick(psWidget, ui32Msg, (int32_t)ui32Param1,
+                                     (int32_t)ui32Param2));
+        }
+
+        default:
+        {
+            return(WidgetDefaultMsgProc(psWidget, ui32Msg, ui32Param1,
+                                        ui32Param2));
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
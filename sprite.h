@@ -0,0 +1,107 @@
+//*****************************************************************************
+//
+// sprite.h - Prototypes for the run-length encoded RGB565 sprites and the
+//            sprite push button.
+//
+//*****************************************************************************
+
+#ifndef __SPRITE_H__
+#define __SPRITE_H__
+
+//*****************************************************************************
+//
+// The format byte of a sprite.  A sprite is laid out like a TivaWare image
+// without a palette:
+//
+//     SPRITE_FMT_RGB565
+//     width, low byte first (2 bytes)
+//     height, low byte first (2 bytes)
+//     the pixels, row by row from the top, as a series of tokens
+//
+// A token byte is one of:
+//
+//     SPRITE_TOKEN_SKIP + n - 1      n transparent pixels
+//     SPRITE_TOKEN_LITERAL + n - 1   n pixels, each as returned by
+//                                    DpyColorTranslate(), low byte first
+//                                    (2 bytes each)
+//     SPRITE_TOKEN_RUN + n - 1       n pixels of the one color that follows,
+//                                    low byte first (2 bytes)
+//
+// The tokens of a row cover exactly its width; no token spans rows.
+// tools/assets.py converts PNG images to this format.
+//
+//*****************************************************************************
+#define SPRITE_FMT_RGB565       0x51
+#define SPRITE_TOKEN_SKIP       0x00
+#define SPRITE_TOKEN_LITERAL    0x40
+#define SPRITE_TOKEN_RUN        0x80
+#define SPRITE_SKIP_MAX         0x40
+#define SPRITE_LITERAL_MAX      0x40
+#define SPRITE_RUN_MAX          0x80
+
+//*****************************************************************************
+//
+// Declares a push button that draws its images with AssetDraw(), so that they
+// may be sprites, instead of with GrImageDraw().  It takes the arguments of
+// RectangularButton() and is a tPushButtonWidget, so the push button macros
+// apply to it.  Auto-repeat is not supported.
+//
+//*****************************************************************************
+#define SpriteButtonStruct(psParent, psNext, psChild, psDisplay, i32X, i32Y, \
+                           i32Width, i32Height, ui32Style, ui32FillColor,    \
+                           ui32PressFillColor, ui32OutlineColor,             \
+                           ui32TextColor, psFont, pcText, pui8Image,         \
+                           pui8PressImage, pfnOnClick)                       \
+        {                                                                    \
+            {                                                                \
+                sizeof(tPushButtonWidget),                                   \
+                (tWidget *)(psParent),                                       \
+                (tWidget *)(psNext),                                         \
+                (tWidget *)(psChild),                                        \
+                psDisplay,                                                   \
+                {                                                            \
+                    i32X,                                                    \
+                    i32Y,                                                    \
+                    (i32X) + (i32Width) - 1,                                 \
+                    (i32Y) + (i32Height) - 1                                 \
+                },                                                           \
+                SpriteButtonMsgProc                                          \
+            },                                                               \
+            ui32Style,                                                       \
+            ui32FillColor,                                                   \
+            ui32PressFillColor,                                              \
+            ui32OutlineColor,                                                \
+            ui32TextColor,                                                   \
+            psFont,                                                          \
+            pcText,                                                          \
+            pui8Image,                                                       \
+            pui8PressImage,                                                  \
+            0,                                                               \
+            0,                                                               \
+            0,                                                               \
+            pfnOnClick                                                       \
+        }
+
+#define SpriteButton(sName, psParent, psNext, psChild, psDisplay, i32X,      \
+                     i32Y, i32Width, i32Height, ui32Style, ui32FillColor,    \
+                     ui32PressFillColor, ui32OutlineColor, ui32TextColor,    \
+                     psFont, pcText, pui8Image, pui8PressImage, pfnOnClick)  \
+        tPushButtonWidget sName =                                            \
+            SpriteButtonStruct(psParent, psNext, psChild, psDisplay, i32X,   \
+                               i32Y, i32Width, i32Height, ui32Style,         \
+                               ui32FillColor, ui32PressFillColor,            \
+                               ui32OutlineColor, ui32TextColor, psFont,      \
+                               pcText, pui8Image, pui8PressImage,            \
+                               pfnOnClick)
+
+//*****************************************************************************
+//
+// Prototypes for the functions exported by the sprite blitter.
+//
+//*****************************************************************************
+extern void SpriteDraw(const tContext *pContext, const uint8_t *pui8Sprite,
+                       int32_t i32X, int32_t i32Y);
+extern int32_t SpriteButtonMsgProc(tWidget *psWidget, uint32_t ui32Msg,
+                                   uint32_t ui32Param1, uint32_t ui32Param2);
+
+#endif // __SPRITE_H__
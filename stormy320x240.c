@@ -1,6671 +0,0 @@
-
-#include <stdint.h>
-#include <stdbool.h>
-#include "grlib/grlib.h"
-
-const uint8_t g_pui_Stormy_Image[] =
-{
-    IMAGE_FMT_8BPP_UNCOMP,
-    64, 1,
-    //    240, 0,
-        166, 0,
-
-    255,
-    0x00, 0x02, 0x00,
-    0x06, 0x00, 0x03,
-    0x00, 0x00, 0x08,
-    0x0f, 0x02, 0x05,
-    0x0a, 0x02, 0x0e,
-    0x03, 0x02, 0x11,
-    0x17, 0x03, 0x09,
-    0x21, 0x03, 0x0a,
-    0x04, 0x07, 0x0f,
-    0x2a, 0x03, 0x0a,
-    0x06, 0x03, 0x18,
-    0x00, 0x06, 0x17,
-    0x13, 0x04, 0x14,
-    0x00, 0x05, 0x1b,
-    0x03, 0x03, 0x1f,
-    0x10, 0x06, 0x18,
-    0x05, 0x02, 0x26,
-    0x06, 0x0e, 0x16,
-    0x02, 0x03, 0x2f,
-    0x31, 0x09, 0x14,
-    0x08, 0x0d, 0x1d,
-    0x27, 0x0a, 0x18,
-    0x40, 0x0a, 0x0f,
-    0x03, 0x0a, 0x26,
-    0x01, 0x0e, 0x1f,
-    0x0f, 0x0d, 0x1c,
-    0x20, 0x0c, 0x1e,
-    0x00, 0x10, 0x22,
-    0x0f, 0x0d, 0x23,
-    0x05, 0x02, 0x3d,
-    0x1b, 0x0e, 0x1f,
-    0x17, 0x0e, 0x21,
-    0x39, 0x0c, 0x19,
-    0x04, 0x01, 0x48,
-    0x33, 0x0d, 0x20,
-    0x2d, 0x0f, 0x20,
-    0x0f, 0x1a, 0x1b,
-    0x08, 0x12, 0x2e,
-    0x0e, 0x19, 0x21,
-    0x16, 0x16, 0x24,
-    0x10, 0x14, 0x2d,
-    0x10, 0x18, 0x26,
-    0x08, 0x18, 0x29,
-    0x18, 0x15, 0x2b,
-    0x04, 0x15, 0x34,
-    0x10, 0x11, 0x3b,
-    0x02, 0x11, 0x41,
-    0x63, 0x15, 0x1d,
-    0x52, 0x18, 0x1f,
-    0x08, 0x03, 0x64,
-    0x36, 0x19, 0x28,
-    0x28, 0x19, 0x2f,
-    0x24, 0x1e, 0x29,
-    0x2e, 0x1a, 0x2e,
-    0x2a, 0x1d, 0x2b,
-    0x13, 0x07, 0x5f,
-    0x25, 0x1c, 0x30,
-    0x43, 0x1d, 0x24,
-    0x0e, 0x10, 0x59,
-    0x11, 0x1e, 0x3d,
-    0x16, 0x11, 0x58,
-    0x18, 0x1f, 0x3c,
-    0x18, 0x25, 0x31,
-    0x1c, 0x24, 0x32,
-    0x1d, 0x20, 0x3b,
-    0x23, 0x24, 0x31,
-    0x24, 0x21, 0x38,
-    0x14, 0x27, 0x36,
-    0x08, 0x08, 0x80,
-    0x23, 0x1e, 0x4b,
-    0x0e, 0x27, 0x48,
-    0x0e, 0x22, 0x54,
-    0x7d, 0x22, 0x2d,
-    0x1c, 0x21, 0x54,
-    0x84, 0x24, 0x28,
-    0x39, 0x2a, 0x3c,
-    0x29, 0x20, 0x5c,
-    0x90, 0x2a, 0x25,
-    0x35, 0x2d, 0x41,
-    0x54, 0x2d, 0x36,
-    0x7b, 0x28, 0x33,
-    0x89, 0x28, 0x2e,
-    0x90, 0x27, 0x2f,
-    0x83, 0x27, 0x34,
-    0x2d, 0x30, 0x42,
-    0x31, 0x34, 0x3a,
-    0x1a, 0x14, 0x82,
-    0x1f, 0x2d, 0x4f,
-    0x26, 0x2d, 0x4d,
-    0x31, 0x2e, 0x48,
-    0x2a, 0x2e, 0x4b,
-    0x65, 0x2f, 0x37,
-    0x2e, 0x29, 0x57,
-    0x99, 0x29, 0x33,
-    0x94, 0x2a, 0x33,
-    0x95, 0x2e, 0x2c,
-    0x9c, 0x2d, 0x2d,
-    0x74, 0x2f, 0x3a,
-    0x90, 0x2d, 0x35,
-    0x89, 0x2c, 0x3b,
-    0x97, 0x2d, 0x37,
-    0x84, 0x31, 0x3d,
-    0x9a, 0x32, 0x33,
-    0x8e, 0x32, 0x39,
-    0x9a, 0x2f, 0x3b,
-    0x95, 0x32, 0x3a,
-    0x2d, 0x23, 0x7e,
-    0x15, 0x1a, 0x99,
-    0x32, 0x3f, 0x50,
-    0x3b, 0x3b, 0x56,
-    0x32, 0x3a, 0x5c,
-    0x3c, 0x34, 0x66,
-    0xa0, 0x38, 0x3a,
-    0x3f, 0x41, 0x4d,
-    0x48, 0x3e, 0x51,
-    0x9b, 0x37, 0x42,
-    0x9c, 0x3a, 0x3c,
-    0x37, 0x2f, 0x77,
-    0x96, 0x39, 0x42,
-    0x33, 0x37, 0x6b,
-    0x2f, 0x3e, 0x62,
-    0x2e, 0x44, 0x59,
-    0x6e, 0x3f, 0x4e,
-    0x1f, 0x41, 0x68,
-    0x15, 0x3c, 0x76,
-    0x88, 0x3f, 0x4e,
-    0x94, 0x3f, 0x4b,
-    0xa9, 0x3f, 0x44,
-    0x2f, 0x3e, 0x74,
-    0xa4, 0x41, 0x45,
-    0x9f, 0x41, 0x4a,
-    0x34, 0x37, 0x85,
-    0x34, 0x2b, 0xa5,
-    0x33, 0x33, 0x99,
-    0x3e, 0x33, 0x95,
-    0x4c, 0x4f, 0x59,
-    0x41, 0x4f, 0x5f,
-    0x82, 0x46, 0x59,
-    0x49, 0x43, 0x74,
-    0x22, 0x2d, 0xaf,
-    0x88, 0x47, 0x58,
-    0xac, 0x47, 0x4c,
-    0x48, 0x4a, 0x6b,
-    0x18, 0x22, 0xd0,
-    0xa7, 0x4a, 0x4d,
-    0x93, 0x49, 0x59,
-    0xa8, 0x48, 0x54,
-    0x20, 0x28, 0xc8,
-    0x26, 0x21, 0xd6,
-    0x82, 0x4c, 0x63,
-    0xa5, 0x4d, 0x56,
-    0x2f, 0x29, 0xc9,
-    0xa0, 0x4d, 0x59,
-    0x7e, 0x52, 0x5d,
-    0xb4, 0x4e, 0x53,
-    0x1a, 0x34, 0xc0,
-    0xae, 0x50, 0x55,
-    0x3d, 0x31, 0xbf,
-    0x4c, 0x46, 0x91,
-    0x95, 0x53, 0x63,
-    0x63, 0x5a, 0x6c,
-    0xa2, 0x54, 0x62,
-    0xa8, 0x53, 0x64,
-    0x9d, 0x55, 0x65,
-    0x45, 0x58, 0x80,
-    0xb5, 0x56, 0x5b,
-    0x5b, 0x5f, 0x6c,
-    0x93, 0x57, 0x69,
-    0xb0, 0x56, 0x61,
-    0x47, 0x60, 0x77,
-    0xb2, 0x5a, 0x5d,
-    0x37, 0x5d, 0x89,
-    0x45, 0x44, 0xb8,
-    0x30, 0x42, 0xc5,
-    0x5b, 0x5e, 0x80,
-    0xb0, 0x5c, 0x65,
-    0x2c, 0x5a, 0x9a,
-    0x5a, 0x58, 0x8f,
-    0xb2, 0x60, 0x61,
-    0x53, 0x4a, 0xb2,
-    0xac, 0x5d, 0x6c,
-    0xa7, 0x5f, 0x6b,
-    0xa2, 0x60, 0x6d,
-    0xae, 0x61, 0x68,
-    0x93, 0x61, 0x73,
-    0xbb, 0x62, 0x66,
-    0x37, 0x34, 0xf9,
-    0xc7, 0x64, 0x69,
-    0xba, 0x65, 0x6d,
-    0x36, 0x3a, 0xf5,
-    0x33, 0x42, 0xeb,
-    0xb4, 0x68, 0x72,
-    0x6e, 0x71, 0x7a,
-    0x45, 0x46, 0xea,
-    0xb0, 0x6d, 0x79,
-    0xad, 0x70, 0x7c,
-    0x78, 0x7b, 0x7f,
-    0x51, 0x53, 0xe2,
-    0xc2, 0x76, 0x7e,
-    0x79, 0x7c, 0x92,
-    0x75, 0x77, 0x9e,
-    0x41, 0x52, 0xfb,
-    0x36, 0x59, 0xf2,
-    0xd1, 0x78, 0x7d,
-    0x49, 0x59, 0xec,
-    0xad, 0x7b, 0x86,
-    0x45, 0x79, 0xb2,
-    0x69, 0x6d, 0xbe,
-    0x5b, 0x64, 0xd7,
-    0x84, 0x86, 0x8a,
-    0x54, 0x56, 0xfe,
-    0x63, 0x81, 0xa7,
-    0x89, 0x8c, 0x8a,
-    0x8a, 0x8c, 0x91,
-    0x91, 0x8c, 0x91,
-    0x53, 0x6f, 0xe6,
-    0xcf, 0x87, 0x8f,
-    0x88, 0x8c, 0xa3,
-    0x8f, 0x8f, 0x9b,
-    0x83, 0x8f, 0xa0,
-    0x65, 0x6a, 0xf8,
-    0xee, 0x95, 0x9b,
-    0x9c, 0x9f, 0xa9,
-    0x6a, 0x98, 0xca,
-    0x8d, 0x9d, 0xb6,
-    0x9c, 0x9d, 0xb4,
-    0x75, 0x82, 0xfa,
-    0xa1, 0x9a, 0xbe,
-    0x6b, 0x8e, 0xf0,
-    0x85, 0xa3, 0xc9,
-    0xec, 0xa4, 0xab,
-    0x8a, 0x95, 0xed,
-    0xa9, 0xa5, 0xcb,
-    0x9c, 0xad, 0xc5,
-    0xad, 0xaf, 0xbf,
-    0xc1, 0xba, 0xc6,
-    0x89, 0xac, 0xff,
-    0xf2, 0xbc, 0xc3,
-    0xbf, 0xc0, 0xd1,
-    0xb0, 0xc0, 0xd7,
-    0x98, 0xc0, 0xf2,
-    0xc7, 0xba, 0xf2,
-    0xac, 0xc5, 0xe8,
-    0xcf, 0xd1, 0xe0,
-    0xe7, 0xe1, 0xeb,
-    0xe0, 0xe0, 0xf6,
-    0xc1, 0xe3, 0xfe,
-    0xe4, 0xe6, 0xee,
-    0xd1, 0xe5, 0xfb,
-    0xee, 0xf2, 0xf4,
-    0xef, 0xf0, 0xfe,
-    0xe0, 0xf7, 0xff,
-    0xec, 0xfb, 0xfe,
-    0xf9, 0xfa, 0xff,
-    0xff, 0xfb, 0xfd,
-    0xfb, 0xff, 0xfd,
-
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5e,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x68, 0x60,
-    0x5e, 0x60, 0x5e, 0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x70, 0x7f, 0x70, 0x64,
-    0x64, 0x64, 0x66, 0x64, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x70, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x7f, 0x5f, 0x5f, 0x4d, 0x8d, 0x8d, 0x69, 0x51, 0x51,
-    0x4a, 0x81, 0x74, 0x51, 0x90, 0x90, 0x51, 0x4a, 0x51, 0x74, 0xbb, 0x51,
-    0x5f, 0x4d, 0x52, 0x5f, 0x64, 0x52, 0x64, 0x9a, 0x9a, 0x64, 0x64, 0x64,
-    0x66, 0x64, 0x66, 0x66, 0x70, 0x70, 0x70, 0x70, 0x68, 0x68, 0x68, 0x64,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5f, 0x5f, 0x5f,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x4d, 0x62, 0x62, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x5f, 0x66, 0x66, 0x66, 0x69, 0x62, 0x62, 0x62, 0x64, 0x66, 0x66, 0x64,
-    0x64, 0x64, 0x64, 0x52, 0x52, 0x52, 0x4d, 0x4d, 0x5f, 0x62, 0x62, 0x5f,
-    0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51,
-    0x4d, 0x4d, 0x4d, 0x5f, 0x62, 0x5f, 0x5f, 0x5f, 0x5f, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x5f, 0x4d, 0x4d, 0x5f, 0x5f,
-    0x62, 0x62, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x64, 0x52, 0x5f, 0x4d, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x52, 0x52, 0x52, 0x52, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5e, 0x5e, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x68, 0x60, 0x5e, 0x60, 0x5e, 0x60,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x70, 0x7f, 0x64, 0x66, 0x64, 0x64, 0x64,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5e, 0x60,
-    0x60, 0x60, 0x60, 0x68, 0x70, 0x64, 0x64, 0x64, 0x64, 0x64, 0x8d, 0x5f,
-    0x52, 0x5f, 0x4d, 0x5f, 0xbb, 0x62, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x51,
-    0x92, 0x90, 0x51, 0x51, 0x51, 0x51, 0xa5, 0x51, 0x4d, 0x5f, 0x52, 0x5f,
-    0x64, 0x64, 0x64, 0x64, 0xbb, 0x66, 0x64, 0x64, 0x64, 0x64, 0x66, 0x70,
-    0x66, 0x7f, 0x70, 0x70, 0x68, 0x68, 0x66, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x64, 0x5f, 0x5f, 0x5f, 0x4d, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x62, 0x69,
-    0x66, 0x66, 0x66, 0x66, 0x70, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64,
-    0x69, 0x69, 0x69, 0x69, 0x64, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0x64,
-    0x64, 0x64, 0x62, 0x62, 0x62, 0x69, 0x62, 0x5f, 0x51, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x5f, 0x5f, 0x5f, 0x62,
-    0x5f, 0x5f, 0x5f, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x5f, 0x5f, 0x4d, 0x5f, 0x5f, 0x62, 0x62, 0x62, 0x52, 0x52,
-    0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x5f, 0x5f, 0x4d, 0x51, 0x51, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x52,
-    0x5f, 0x4d, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x52, 0x52, 0x52, 0x52, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5e,
-    0x5e, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5e, 0x5e,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5e, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x60, 0x60, 0x5e, 0x60, 0x5e, 0x60, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x8d, 0x64, 0x64, 0x66, 0x64, 0x64, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5e, 0x60, 0x60, 0x5e, 0x60, 0x70,
-    0x68, 0x64, 0x64, 0x5f, 0x64, 0x66, 0x7f, 0x64, 0x52, 0x5f, 0x5f, 0x69,
-    0xa5, 0x51, 0x51, 0x51, 0x4a, 0x51, 0x51, 0x51, 0xbb, 0xa5, 0x4a, 0x67,
-    0x51, 0xa5, 0xbb, 0x62, 0x5f, 0x4d, 0x5f, 0x52, 0x52, 0x64, 0x52, 0x66,
-    0xbb, 0x64, 0x64, 0x64, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7f, 0x70, 0x70,
-    0x70, 0x68, 0x5f, 0x52, 0x52, 0x52, 0x52, 0x5f, 0x52, 0x5f, 0x64, 0x64,
-    0x64, 0x64, 0x4d, 0x4d, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x4d,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5f, 0x69, 0x66, 0x5f, 0x5f, 0x66,
-    0x70, 0x70, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x69, 0x69, 0x5f, 0x4d, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x51, 0x51, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x62, 0x5f, 0x4d,
-    0x4d, 0x4d, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x62, 0x62, 0x62, 0x5f, 0x5f, 0x5f, 0x5f, 0x4d, 0x4d,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x52, 0x5f, 0x4d, 0x4d, 0x4d,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5e, 0x5e, 0x5e,
-    0x60, 0x60, 0x60, 0x60, 0x60, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x60, 0x60, 0x60, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x60,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60, 0x5e,
-    0x5e, 0x60, 0x5e, 0x5e, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x64, 0x7f, 0x64,
-    0x52, 0x64, 0x64, 0x64, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x5e, 0x5e, 0x60, 0x70, 0x64, 0x66, 0x52, 0x5f,
-    0x64, 0x5f, 0x66, 0x70, 0x5f, 0x5f, 0x5f, 0x5f, 0xa5, 0x62, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0xdd, 0xbb, 0x90, 0x51, 0xa5, 0xcb, 0xcb, 0xa5, 0x51,
-    0x4d, 0x5f, 0x5f, 0x5f, 0x52, 0x66, 0x64, 0x64, 0x8d, 0xbb, 0x7f, 0x64,
-    0x66, 0x5f, 0x66, 0x66, 0x70, 0x7f, 0x70, 0x70, 0x68, 0x68, 0x64, 0x52,
-    0x52, 0x52, 0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x52, 0x52, 0x64, 0x4d, 0x4d,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x4d, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x4d, 0x62, 0x66, 0x5f, 0x64, 0x66, 0x70, 0x70, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0x64, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x70, 0x70, 0x70, 0x66, 0x66, 0x69, 0x62, 0x5f, 0x4d,
-    0x52, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x5f, 0x62,
-    0x5f, 0x5f, 0x4d, 0x4d, 0x5f, 0x62, 0x5f, 0x4d, 0x4d, 0x4d, 0x5f, 0x4d,
-    0x4d, 0x5f, 0x5f, 0x5f, 0x5f, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x5f, 0x5f,
-    0x62, 0x62, 0x5f, 0x5f, 0x62, 0x5f, 0x5f, 0x4d, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x64, 0x64, 0x64, 0x64, 0x5f, 0x4d, 0x4d, 0x4d, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x60, 0x60, 0x60, 0x60,
-    0x60, 0x60, 0x60, 0x60, 0x5e, 0x5e, 0x5e, 0x5e, 0x60, 0x60, 0x60, 0x5e,
-    0x5e, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x68, 0x70, 0x68, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x66, 0x70, 0x70, 0x64, 0x66, 0x52, 0x64, 0x5f, 0x64, 0x7f, 0x66,
-    0x5f, 0x5f, 0x4d, 0x4d, 0xa5, 0x62, 0x51, 0x51, 0x4d, 0x4d, 0x51, 0xa5,
-    0x8d, 0xa5, 0x51, 0x62, 0x69, 0x51, 0x5f, 0x5f, 0x5f, 0x66, 0x52, 0x5f,
-    0x64, 0x64, 0x52, 0x52, 0x66, 0x66, 0xa5, 0x7f, 0x68, 0x64, 0x66, 0x66,
-    0x68, 0x70, 0x70, 0x70, 0x68, 0x64, 0x52, 0x52, 0x52, 0x4d, 0x5f, 0x5f,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x4d, 0x4d, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d,
-    0x66, 0x5f, 0x5f, 0x5f, 0x66, 0x70, 0x68, 0x64, 0x64, 0x66, 0x66, 0x66,
-    0x64, 0x64, 0x64, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x70,
-    0x70, 0x70, 0x66, 0x66, 0x64, 0x64, 0x64, 0x5f, 0x52, 0x51, 0x51, 0x51,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x5f, 0x5f, 0x5f, 0x52, 0x52, 0x52,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x4d, 0x4d, 0x4d, 0x5f, 0x5f, 0x62, 0x62, 0x62,
-    0x62, 0x5f, 0x5f, 0x4d, 0x4d, 0x5f, 0x5f, 0x5f, 0x5f, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x5f, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x5f, 0x52, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x60, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x60,
-    0x60, 0x5e, 0x5e, 0x5d, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5d, 0x5d,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x52, 0x52, 0x64, 0x64, 0x64, 0x5e, 0x60, 0x60, 0x60,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x70, 0x7f, 0x64, 0x68, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x66, 0x66, 0x66,
-    0x5f, 0x64, 0x64, 0x5f, 0x52, 0x5f, 0x7f, 0x5f, 0x5f, 0x52, 0x5f, 0x69,
-    0xa5, 0x51, 0x62, 0x51, 0x62, 0x52, 0x4d, 0xcb, 0xcb, 0x8d, 0x62, 0x51,
-    0x51, 0x69, 0x4d, 0x4d, 0x5f, 0x5f, 0x64, 0x64, 0x52, 0x52, 0x66, 0x64,
-    0x64, 0x64, 0x66, 0xa5, 0x64, 0x68, 0x66, 0x66, 0x68, 0x7f, 0x70, 0x70,
-    0x64, 0x64, 0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x5f, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x4d,
-    0x4d, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x66, 0x66, 0x5f, 0x5f,
-    0x5f, 0x66, 0x64, 0x52, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x70, 0x70, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x52, 0x52, 0x51, 0x51, 0x4a, 0x4a, 0x51, 0x51,
-    0x51, 0x62, 0x5f, 0x5f, 0x5f, 0x52, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x52, 0x4d, 0x4d, 0x5f, 0x5f, 0x62, 0x5f, 0x5f, 0x5f, 0x5f, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x4d,
-    0x4d, 0x5f, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x5f, 0x52, 0x52, 0x52,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x60, 0x5e,
-    0x5e, 0x5d, 0x5e, 0x5e, 0x5d, 0x5d, 0x5e, 0x5e, 0x5e, 0x5d, 0x5d, 0x5d,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5d, 0x5d, 0x5d, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x64,
-    0x64, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x7f, 0x64, 0x68, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x66, 0x66, 0x64, 0x64, 0x5f, 0x52, 0x5f, 0x5f,
-    0x52, 0x66, 0x7f, 0x66, 0x5f, 0x5f, 0x5f, 0x5f, 0xbb, 0x5f, 0x4d, 0x4d,
-    0x52, 0x5f, 0x4d, 0x69, 0x69, 0x4d, 0x4d, 0x5f, 0x5f, 0x52, 0x5f, 0x5f,
-    0x64, 0x64, 0x5f, 0x5f, 0x64, 0x64, 0x52, 0x66, 0x66, 0x64, 0x70, 0xbb,
-    0x70, 0x64, 0x66, 0x66, 0x68, 0x70, 0x68, 0x68, 0x5f, 0x64, 0x52, 0x52,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x4d, 0x64, 0x64, 0x64, 0x52, 0x52, 0x52, 0x52, 0x4d,
-    0x62, 0x69, 0x69, 0x62, 0x5f, 0x5f, 0x62, 0x69, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x69, 0x69, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66,
-    0x5f, 0x52, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x62, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x5f, 0x5f, 0x5f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x52, 0x52, 0x52, 0x52, 0x51, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x60, 0x60, 0x60, 0x60,
-    0x5e, 0x5e, 0x5e, 0x5e, 0x5d, 0x5e, 0x60, 0x5e, 0x5d, 0x5d, 0x5e, 0x60,
-    0x5e, 0x5e, 0x5e, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
-    0x5d, 0x5d, 0x5d, 0x5d, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x52, 0x64, 0x64, 0x64, 0x52,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x64, 0x64, 0x52, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x68, 0x64, 0x70, 0x68, 0x64, 0x68,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x66,
-    0x66, 0x64, 0x64, 0x5f, 0x64, 0x64, 0x64, 0x52, 0x66, 0x5f, 0xa5, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x8d, 0x9a, 0x5f, 0x4d, 0x5f, 0x52, 0x52, 0x4d, 0x4d,
-    0x4d, 0x5f, 0x4d, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x66, 0x64, 0x5f, 0x64,
-    0x52, 0x64, 0x64, 0x52, 0x66, 0x66, 0x64, 0x70, 0xbb, 0x64, 0x66, 0x66,
-    0x64, 0x68, 0x7f, 0x68, 0x5f, 0x64, 0x52, 0x4d, 0x4d, 0x4d, 0x4d, 0x52,
-    0x52, 0x52, 0x64, 0x5f, 0x64, 0x64, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x4d, 0x4d, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d,
-    0x5f, 0x5f, 0x52, 0x4d, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x62, 0x62, 0x51,
-    0x52, 0x4a, 0x4d, 0x62, 0x69, 0x66, 0x66, 0x66, 0x66, 0x66, 0x70, 0x70,
-    0x69, 0x62, 0x52, 0x64, 0x64, 0x66, 0x66, 0x66, 0x5f, 0x52, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x5f, 0x5f, 0x5f, 0x5f, 0x52, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x4a, 0x51, 0x51, 0x51, 0x51, 0x5f, 0x5f, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x4d, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x52, 0x52, 0x52, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x52, 0x64, 0x64, 0x64, 0x52,
-    0x52, 0x52, 0x64, 0x64, 0x64, 0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x52,
-    0x52, 0x52, 0x64, 0x64, 0x64, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x68, 0x7f, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x68, 0x64, 0x68, 0x68, 0x64, 0x64, 0x64, 0x64, 0x64, 0x5f,
-    0x64, 0x5f, 0x5f, 0x52, 0x5f, 0x7f, 0x7f, 0x5f, 0x5f, 0x5f, 0x5f, 0xbb,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x52, 0x52, 0x5f, 0x52, 0x52, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x66, 0x52, 0x64,
-    0x64, 0x66, 0x66, 0x66, 0x9a, 0x68, 0x70, 0x70, 0x5f, 0x66, 0x7f, 0x68,
-    0x5f, 0x64, 0x52, 0x5f, 0x4d, 0x4a, 0x52, 0x4d, 0x52, 0x52, 0x64, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x51, 0x52, 0x51,
-    0x52, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x51,
-    0x4d, 0x62, 0x69, 0x5f, 0x5f, 0x69, 0x73, 0x73, 0x69, 0x5f, 0x52, 0x52,
-    0x52, 0x66, 0x66, 0x66, 0x5f, 0x5f, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x4a, 0x51, 0x52, 0x5f, 0x5f, 0x5f, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x4a, 0x4a, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52,
-    0x4d, 0x4d, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x51, 0x51, 0x51, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x64, 0x64, 0x52, 0x64, 0x64, 0x64, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x52, 0x52, 0x64,
-    0x64, 0x64, 0x52, 0x52, 0x64, 0x64, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64,
-    0x64, 0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x7f, 0x64, 0x64, 0x64, 0x64, 0x52, 0x64, 0x68, 0x64, 0x64,
-    0x68, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x5f, 0x52, 0x5f, 0x5f,
-    0x5f, 0x9a, 0x5f, 0x5f, 0x4d, 0x5f, 0x9a, 0xbb, 0x5f, 0x4d, 0x5f, 0x4d,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66,
-    0xbb, 0x70, 0x64, 0x68, 0x66, 0x66, 0x70, 0x70, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x51, 0x4a, 0x52, 0x4d, 0x52, 0x52, 0x5f, 0x5f, 0x5f, 0x64, 0x5f, 0x5f,
-    0x5f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x62, 0x69, 0x69, 0x4d, 0x4d, 0x52, 0x52, 0x52, 0x5f, 0x64, 0x64,
-    0x5f, 0x5f, 0x62, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x5f, 0x5f,
-    0x5f, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x4a, 0x4a, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x5f,
-    0x5f, 0x5f, 0x4d, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x64, 0x64, 0x52, 0x64,
-    0x64, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x52, 0x52, 0x52, 0x64, 0x64, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x52, 0x52,
-    0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64,
-    0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x7f, 0x68,
-    0x64, 0x66, 0x64, 0x66, 0x64, 0x52, 0x64, 0x70, 0x66, 0x5f, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x52, 0x52, 0x64, 0x66, 0x52, 0x73, 0x81, 0x8d, 0x5f,
-    0x69, 0xbb, 0x9a, 0x5f, 0x66, 0x52, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x64, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x64,
-    0x5f, 0x5f, 0x52, 0x64, 0x52, 0x64, 0x70, 0x70, 0x9a, 0x70, 0x66, 0x64,
-    0x5f, 0x66, 0x68, 0x68, 0x5f, 0x5f, 0x52, 0x4d, 0x51, 0x51, 0x51, 0x51,
-    0x4d, 0x4d, 0x5f, 0x5f, 0x5f, 0x52, 0x52, 0x5f, 0x5f, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x4d, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x4a, 0x52, 0x52, 0x52, 0x5f, 0x5f, 0x5f, 0x62, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x62, 0x5f, 0x5f, 0x62, 0x62, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x52, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x64, 0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x68, 0x52, 0x64, 0x64, 0x68, 0x7f, 0x66, 0x66, 0x7f, 0x7f,
-    0x68, 0x68, 0x68, 0x52, 0x5f, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52,
-    0x64, 0x64, 0x52, 0x70, 0xcb, 0xcb, 0xbb, 0xcb, 0xcb, 0x81, 0x5f, 0x5f,
-    0x52, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x64, 0x5f, 0x64, 0x66, 0x64,
-    0x66, 0x64, 0x66, 0x70, 0xbb, 0x68, 0x68, 0x66, 0x66, 0x66, 0x68, 0x64,
-    0x5f, 0x64, 0x52, 0x4d, 0x51, 0x51, 0x51, 0x51, 0x4d, 0x4d, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x5f, 0x5f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x52, 0x52, 0x52, 0x4d, 0x4d, 0x51, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51,
-    0x62, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x51,
-    0x5f, 0x5f, 0x52, 0x5f, 0x5f, 0x66, 0x69, 0x62, 0x51, 0x51, 0x51, 0x51,
-    0x62, 0x62, 0x5f, 0x62, 0x62, 0x62, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x64, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x64, 0x64, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x52, 0x52, 0x52,
-    0x52, 0x64, 0x64, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x68, 0x64,
-    0x52, 0x64, 0x64, 0x68, 0x70, 0x7f, 0x64, 0x66, 0x7f, 0x64, 0x68, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x73, 0x9a,
-    0xbb, 0x69, 0x69, 0x62, 0x5f, 0x5f, 0x52, 0x5f, 0x5f, 0x66, 0x64, 0x52,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x64, 0x64, 0x64, 0x64, 0x5f, 0x5f, 0x64, 0x64, 0x70, 0xa5, 0xbb, 0xa5,
-    0xbb, 0x66, 0x64, 0x70, 0x66, 0x68, 0x5f, 0x66, 0x64, 0x64, 0x52, 0x4d,
-    0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x5f,
-    0x5f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x52,
-    0x52, 0x52, 0x4d, 0x4d, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x62, 0x51, 0x51, 0x51,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x62, 0x62, 0x52, 0x64,
-    0x69, 0x66, 0x69, 0x62, 0x62, 0x62, 0x62, 0x62, 0x69, 0x69, 0x62, 0x62,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x64, 0x52, 0x52, 0x52, 0x52, 0x64, 0x52, 0x52,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x68, 0x70, 0x70, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x5f, 0x64, 0x66, 0x9a, 0xbb, 0xbb, 0x62, 0x62, 0x62,
-    0x5f, 0x5f, 0x52, 0x5f, 0x5f, 0x5f, 0x64, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x64, 0x64, 0x64,
-    0x5f, 0x5f, 0x64, 0x64, 0x7f, 0x70, 0x66, 0x70, 0x66, 0x66, 0x70, 0x68,
-    0x68, 0x70, 0x66, 0x66, 0x68, 0x64, 0x64, 0x52, 0x4d, 0x51, 0x51, 0x51,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5f, 0x5f, 0x5f, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x52, 0x4d, 0x4d, 0x4d,
-    0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x51, 0x51, 0x51, 0x62, 0x62, 0x64, 0x64, 0x66, 0x5f, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x69, 0x69, 0x62, 0x62, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51,
-    0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x64, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x64, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x64, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x52,
-    0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x52, 0x68, 0x52, 0x52, 0x68, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x64,
-    0x52, 0x68, 0x70, 0x66, 0x5f, 0x64, 0x64, 0x64, 0x64, 0x64, 0x5f, 0x5f,
-    0x64, 0x9a, 0xbb, 0x73, 0x62, 0x62, 0x5f, 0x5f, 0x5f, 0x4d, 0x66, 0x5f,
-    0x5f, 0x5f, 0x64, 0x52, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x5f, 0x64, 0x66, 0x68,
-    0x9a, 0x64, 0x66, 0x66, 0x64, 0x66, 0x68, 0x64, 0x68, 0x70, 0x68, 0x68,
-    0x68, 0x68, 0x64, 0x52, 0x4d, 0x52, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52,
-    0x4d, 0x4d, 0x5f, 0x5f, 0x5f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x52, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x52, 0x52,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51,
-    0x51, 0x62, 0x62, 0x62, 0x5f, 0x5f, 0x62, 0x62, 0x62, 0x62, 0x51, 0x62,
-    0x62, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64,
-    0x64, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x5f, 0x64, 0x7f, 0x5f, 0x64,
-    0x5f, 0x64, 0x52, 0x52, 0x64, 0x5f, 0x5f, 0x5f, 0x81, 0x73, 0xbb, 0x5f,
-    0x62, 0x69, 0x4d, 0x5f, 0x5f, 0x5f, 0x52, 0x52, 0x66, 0x52, 0x52, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x5f, 0x66, 0x7f, 0x9a, 0x70, 0x66, 0x64, 0x66,
-    0x66, 0x64, 0x68, 0x66, 0x68, 0x68, 0x70, 0x68, 0x64, 0x68, 0x64, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x4d, 0x5f, 0x5f,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x52, 0x51, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51,
-    0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x62, 0x62, 0x62,
-    0x5f, 0x62, 0x62, 0x62, 0x62, 0x62, 0x51, 0x62, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x51, 0x51,
-    0x51, 0x4a, 0x4a, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x52, 0x5f, 0x66, 0x70, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x52, 0x5f, 0x51, 0x51, 0x9c, 0xa5, 0xa5, 0x62, 0x62, 0x51, 0x5f, 0x4d,
-    0x5f, 0x5f, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x70, 0x8d, 0x66, 0x64, 0x66, 0x52, 0x66, 0x64, 0x64, 0x66, 0x64, 0x68,
-    0x68, 0x68, 0x66, 0x68, 0x66, 0x66, 0x64, 0x64, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x4d, 0x5f, 0x62, 0x62, 0x4d, 0x4d, 0x4d, 0x52,
-    0x52, 0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x52, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x52, 0x52, 0x52, 0x52, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x4a, 0x48, 0x48,
-    0x48, 0x48, 0x4a, 0x4a, 0x51, 0x51, 0x62, 0x62, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x62, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x4a, 0x4a, 0x51,
-    0x4a, 0x4a, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x5f,
-    0x66, 0x70, 0x5f, 0x64, 0x64, 0x64, 0x64, 0x52, 0x52, 0x5f, 0x62, 0x69,
-    0xcb, 0x92, 0x62, 0x51, 0x62, 0x51, 0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x64, 0x64, 0x68, 0x64, 0x64, 0x64, 0x70, 0x7f, 0x66, 0x70, 0x64, 0x64,
-    0x66, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x66, 0x66, 0x64, 0x66, 0x64, 0x52, 0x64, 0x52, 0x52, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x5f, 0x62, 0x4d, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x52, 0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x52, 0x52, 0x4a, 0x4a, 0x4a, 0x51, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x4a, 0x48, 0x48, 0x48, 0x48, 0x51, 0x51,
-    0x51, 0x62, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x62, 0x62, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x5f, 0x70, 0x66, 0x64,
-    0x52, 0x64, 0x64, 0x5f, 0x5f, 0x5f, 0x74, 0xcb, 0x9c, 0x51, 0x51, 0x62,
-    0x5f, 0x5f, 0x5f, 0x52, 0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x64, 0x64, 0x64,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x68, 0x68, 0x64,
-    0x64, 0x64, 0x7f, 0x66, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x66, 0x68, 0x68, 0x68, 0x68, 0x64, 0x66, 0x64, 0x64,
-    0x70, 0x52, 0x64, 0x52, 0x52, 0x52, 0x4d, 0x4d, 0x52, 0x4d, 0x4d, 0x5f,
-    0x51, 0x51, 0x4a, 0x51, 0x51, 0x51, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x52, 0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x51, 0x4a, 0x4a, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x62, 0x69, 0x69, 0x69,
-    0x62, 0x62, 0x62, 0x62, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x64, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x64, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x52, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x52, 0x64, 0x64, 0x5f, 0x70, 0x66, 0x5f, 0x52, 0x64, 0x52, 0x64,
-    0x5f, 0x5f, 0xcb, 0x74, 0x51, 0x51, 0x62, 0x51, 0x4d, 0x5f, 0x52, 0x66,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x64, 0x64, 0x64, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x68, 0x64, 0x68, 0x68, 0x7f, 0x7f, 0x64,
-    0x66, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x64, 0x64, 0x64, 0x66,
-    0x68, 0x68, 0x66, 0x68, 0x66, 0x64, 0x52, 0x64, 0x70, 0x66, 0x64, 0x66,
-    0x64, 0x64, 0x5f, 0x4d, 0x52, 0x4d, 0x4d, 0x4d, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x52, 0x52, 0x52, 0x52, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x51, 0x51, 0x62, 0x69, 0x69, 0x69, 0x62, 0x62, 0x62, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x5f, 0x64,
-    0x52, 0x66, 0x66, 0x52, 0x5f, 0x52, 0x52, 0x5f, 0x5f, 0x73, 0xbb, 0x51,
-    0x5f, 0x4d, 0x4d, 0x5f, 0x5f, 0x5f, 0x5f, 0x52, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x64, 0x64, 0x64, 0x70, 0x70, 0x70, 0x68, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x64, 0x66, 0x64, 0x64, 0x66, 0x7f, 0x9a, 0x70, 0x66, 0x64, 0x64, 0x64,
-    0x52, 0x52, 0x52, 0x4d, 0x51, 0x51, 0x4a, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x4d, 0x4d, 0x52, 0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x5f, 0x5f, 0x62, 0x69, 0x62, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x62,
-    0x69, 0x69, 0x66, 0x69, 0x69, 0x62, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x53, 0x48, 0x48, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x48, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x64, 0x64, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x66, 0x66, 0x52,
-    0x64, 0x52, 0x5f, 0x5f, 0x69, 0x9a, 0xbb, 0x69, 0x5f, 0x5f, 0x4d, 0x4d,
-    0x52, 0x52, 0x5f, 0x52, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x64, 0x68, 0x68,
-    0x70, 0x68, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0x64, 0x64,
-    0x64, 0x66, 0x70, 0x9a, 0x64, 0x64, 0x66, 0x66, 0x64, 0x52, 0x52, 0x4d,
-    0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4d, 0x4d,
-    0x52, 0x52, 0x52, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x5f,
-    0x62, 0x5f, 0x69, 0x69, 0x62, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x62, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x62, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x53, 0x48, 0x48,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x48, 0x48, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5f, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x52, 0x52, 0x5f, 0x70, 0x5f, 0x5f, 0x52, 0x66, 0x52, 0x5f,
-    0x73, 0xa5, 0xbb, 0x69, 0x5f, 0x66, 0x5f, 0x5f, 0x66, 0x5f, 0x52, 0x52,
-    0x64, 0x64, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x66, 0x64, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x66, 0x66, 0x66, 0x66, 0x64, 0x64, 0x66, 0x64, 0x64, 0x66, 0x66, 0xbb,
-    0x70, 0x66, 0x66, 0x66, 0x66, 0x64, 0x52, 0x5f, 0x51, 0x51, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x51, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x62, 0x62, 0x5f, 0x5f, 0x5f,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x51, 0x51, 0x51, 0x62, 0x69, 0x69, 0x69, 0x69, 0x62, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x4a, 0x53, 0x53, 0x53, 0x53, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x62, 0x62, 0x51, 0x51, 0x51, 0x53, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x4a, 0x4a, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x48, 0x48, 0x48, 0x48, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x48, 0x48, 0x48, 0x48, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x5f, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x5f, 0x5f, 0x52, 0x64,
-    0x66, 0x70, 0x5f, 0x52, 0x5f, 0x52, 0x5f, 0x5f, 0xa5, 0x69, 0xbb, 0x69,
-    0x66, 0x66, 0x66, 0x52, 0x52, 0x52, 0x64, 0x5f, 0x64, 0x64, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x66,
-    0x64, 0x66, 0x64, 0x7f, 0x66, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x66, 0x64, 0x64, 0x64, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x64, 0x64, 0x64, 0x66, 0x66, 0xbb, 0x7f, 0x70, 0x66, 0x66,
-    0x70, 0x66, 0x64, 0x5f, 0x62, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x51, 0x51, 0x51, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
-    0x4d, 0x4d, 0x5f, 0x62, 0x69, 0x5f, 0x4d, 0x52, 0x51, 0x51, 0x62, 0x51,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x4a, 0x51, 0x51, 0x51, 0x51,
-    0x69, 0x69, 0x66, 0x62, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x53, 0x53, 0x53, 0x53, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x62, 0x51, 0x51, 0x51,
-    0x51, 0x53, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4a, 0x4a, 0x51, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x48, 0x48, 0x48, 0x48,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x48, 0x48, 0x48, 0x48,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x5f, 0x5f, 0x5f, 0x5f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x5f, 0x52, 0x64, 0x70, 0x52, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x8d, 0x81, 0x51, 0xbb, 0x62, 0x52, 0x5f, 0x5f, 0x70,
-    0x64, 0x5f, 0x64, 0x5f, 0x64, 0x64, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x64, 0x66, 0x70,
-    0x66, 0x64, 0x64, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0x64, 0x64,
-    0x64, 0x66, 0x66, 0x70, 0xbb, 0x7f, 0x8d, 0x66, 0x66, 0x66, 0x64, 0x62,
-    0x62, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4d, 0x4d, 0x4d, 0x4d, 0x5f, 0x5f,
-    0x5f, 0x4d, 0x51, 0x4a, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x51,
-    0x51, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x62, 0x69, 0x69, 0x69, 0x5f, 0x62,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x48, 0x48, 0x48, 0x48, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x48, 0x48, 0x48, 0x48, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x5f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x66, 0x66, 0x5f, 0x52, 0x5f, 0x4d, 0x5f, 0x4d, 0xa5,
-    0x69, 0xa5, 0x8d, 0x62, 0x52, 0x52, 0x5f, 0x7f, 0x66, 0x52, 0x5f, 0x64,
-    0x64, 0x64, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x66, 0x66, 0x66, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x66,
-    0x7f, 0x9a, 0x7f, 0x7f, 0x70, 0x70, 0x66, 0x62, 0x62, 0x51, 0x51, 0x51,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x62, 0x62, 0x62, 0x51, 0x51,
-    0x51, 0x51, 0x5f, 0x4d, 0x4d, 0x4d, 0x5f, 0x5f, 0x4d, 0x4d, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x62, 0x69, 0x69, 0x69, 0x5f, 0x62, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x53, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x48, 0x48, 0x48, 0x48, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x48, 0x48, 0x48, 0x48, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x52, 0x52, 0x64, 0x64,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x52, 0x52, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x5f, 0x64, 0x64, 0x5f, 0x5f, 0x66, 0x70,
-    0x64, 0x5f, 0x5f, 0x5f, 0x5f, 0x51, 0x74, 0xa5, 0xa5, 0x9a, 0x5f, 0x62,
-    0x52, 0x5f, 0x52, 0x5f, 0x9a, 0x70, 0x5f, 0x64, 0x64, 0x64, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x64, 0x66, 0x66, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x62, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66, 0x66, 0x66, 0x66,
-    0x69, 0x62, 0x62, 0x62, 0x62, 0x69, 0x69, 0x69, 0x69, 0x81, 0x9a, 0x9a,
-    0x66, 0x66, 0x70, 0x69, 0x62, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x4a, 0x51, 0x51, 0x69, 0x69, 0x62, 0x51, 0x51, 0x51, 0x51, 0x62, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x4a, 0x51, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x69, 0x69,
-    0x69, 0x69, 0x62, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x53, 0x53,
-    0x53, 0x53, 0x63, 0x53, 0x53, 0x53, 0x63, 0x63, 0x63, 0x53, 0x53, 0x53,
-    0x63, 0x63, 0x53, 0x53, 0x53, 0x53, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x53, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x4a, 0x4a, 0x4a, 0x4a, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x64, 0x52, 0x52, 0x64, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x64, 0x64, 0x64, 0x64, 0x52, 0x64, 0x64, 0x64, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x52, 0x5f, 0x5f, 0x5f, 0x52, 0x52, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x64, 0x64, 0x64,
-    0x5f, 0x64, 0x64, 0x64, 0x5f, 0x5f, 0x66, 0x66, 0x64, 0x64, 0x5f, 0x5f,
-    0x5f, 0x62, 0x90, 0x9c, 0xbb, 0x69, 0x62, 0x4d, 0x52, 0x52, 0x5f, 0x5f,
-    0x5f, 0x66, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x66, 0x66, 0x66, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x62, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x66, 0x66, 0x66, 0x66, 0x66, 0x69, 0x62, 0x62, 0x62,
-    0x69, 0x69, 0x69, 0x69, 0x73, 0x73, 0x7f, 0x9a, 0x66, 0x66, 0x66, 0x62,
-    0x69, 0x62, 0x51, 0x62, 0x62, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x62,
-    0x62, 0x51, 0x51, 0x4a, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x62, 0x69, 0x69, 0x69, 0x62, 0x62, 0x62,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x53, 0x53, 0x53, 0x53, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x53, 0x53, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x64, 0x52, 0x64, 0x64, 0x64, 0x52, 0x52, 0x64, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x5f, 0x52, 0x52, 0x52, 0x5f, 0x5f, 0x5f, 0x52,
-    0x52, 0x5f, 0x5f, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5f, 0x5f, 0x5f,
-    0x52, 0x5f, 0x5f, 0x5f, 0x5f, 0x52, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x64, 0x64, 0x5f, 0x5f, 0x64, 0x64, 0x64,
-    0x64, 0x66, 0x66, 0x5f, 0x64, 0x52, 0x5f, 0x5f, 0x5f, 0x69, 0x8d, 0xcb,
-    0x74, 0x51, 0x69, 0x4d, 0x4d, 0x5f, 0x5f, 0x52, 0x5f, 0x7f, 0x66, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x64, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x66, 0x66, 0x70, 0x66, 0x66, 0x64, 0x66, 0x64, 0x64, 0x64,
-    0x62, 0x62, 0x62, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x69, 0x69, 0x62, 0x62, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x73, 0x81, 0x9a, 0x73, 0x69, 0x5f, 0x69, 0x62, 0x62, 0x62, 0x69,
-    0x69, 0x69, 0x62, 0x69, 0x62, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x62, 0x69, 0x69, 0x69, 0x62, 0x62, 0x62, 0x62, 0x62, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x53, 0x53, 0x53, 0x53, 0x63, 0x63, 0x63, 0x63, 0x51, 0x63,
-    0x63, 0x63, 0x63, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x51, 0x51, 0x53, 0x53, 0x53, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4a, 0x4a, 0x4a, 0x4a, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x5f, 0x5f, 0x5f, 0x52, 0x52, 0x5f, 0x52, 0x52, 0x52, 0x5f, 0x5f, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x64, 0x64, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x70, 0x5f, 0x5f,
-    0x64, 0x64, 0x5f, 0x5f, 0x62, 0x67, 0x74, 0xdd, 0x74, 0x62, 0x4d, 0x5f,
-    0x4d, 0x4d, 0x5f, 0x52, 0x5f, 0x5f, 0x7f, 0x66, 0x5f, 0x5f, 0x5f, 0x64,
-    0x5f, 0x5f, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x62, 0x62, 0x69,
-    0x64, 0x64, 0x64, 0x64, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x69, 0x69, 0x62, 0x62, 0x69, 0x69, 0x69, 0x69, 0x69, 0x81, 0x81, 0x73,
-    0x9a, 0x69, 0x69, 0x62, 0x62, 0x62, 0x62, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x62, 0x51, 0x51, 0x51, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x51, 0x62, 0x62, 0x69, 0x69, 0x69,
-    0x62, 0x51, 0x62, 0x62, 0x62, 0x62, 0x62, 0x51, 0x51, 0x51, 0x53, 0x53,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x51, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x51, 0x51,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4a, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x4a, 0x4a, 0x4a, 0x4a, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x52, 0x52, 0x5f, 0x5f, 0x52, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x70, 0x66, 0x5f, 0x64, 0x64, 0x5f, 0x5f,
-    0x62, 0x67, 0x69, 0xbb, 0xbb, 0x69, 0x69, 0x5f, 0x4d, 0x5f, 0x5f, 0x69,
-    0x5f, 0x5f, 0x7f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x69, 0x62, 0x62, 0x62, 0x69, 0x69, 0x69, 0x69, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x69, 0x69, 0x62, 0x69,
-    0x69, 0x69, 0x62, 0x69, 0x69, 0x69, 0x9a, 0x69, 0x73, 0x73, 0x62, 0x62,
-    0x64, 0x64, 0x64, 0x64, 0x62, 0x69, 0x69, 0x73, 0x69, 0x62, 0x51, 0x4a,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x62, 0x62, 0x62, 0x62, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x62, 0x62, 0x62, 0x62, 0x51, 0x51, 0x53, 0x53, 0x63, 0x63, 0x63, 0x63,
-    0x53, 0x53, 0x51, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51,
-    0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x4a, 0x4a, 0x4a, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x64,
-    0x5f, 0x5f, 0x52, 0x52, 0x52, 0x5f, 0x5f, 0x5f, 0x66, 0x66, 0x5f, 0x5f,
-    0x52, 0x5f, 0x5f, 0x52, 0x5f, 0x5f, 0x5f, 0x52, 0x52, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x64, 0x64, 0x70, 0x64, 0x5f, 0x64, 0x5f, 0x5f, 0x5f, 0x62, 0x69, 0x74,
-    0xdd, 0x81, 0x69, 0x62, 0x5f, 0x5f, 0x5f, 0x4d, 0x5f, 0x66, 0x7f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x5f, 0x64, 0x64, 0x66, 0x64, 0x64, 0x64, 0x69, 0x62,
-    0x62, 0x69, 0x69, 0x69, 0x69, 0x69, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x62, 0x62,
-    0x62, 0x73, 0x8d, 0x69, 0x73, 0x81, 0x69, 0x69, 0x69, 0x69, 0x69, 0x5f,
-    0x4d, 0x69, 0x69, 0x69, 0x73, 0x69, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x62, 0x62, 0x69, 0x62, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x62, 0x62,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x62, 0x62, 0x51, 0x51, 0x62, 0x62, 0x62,
-    0x51, 0x51, 0x53, 0x53, 0x63, 0x63, 0x53, 0x53, 0x53, 0x53, 0x51, 0x51,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x63, 0x63, 0x53, 0x53, 0x53, 0x53,
-    0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a,
-    0x4a, 0x4a, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x4a, 0x4a, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x52, 0x52, 0x52, 0x52,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x52, 0x64, 0x64, 0x64, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x52, 0x64, 0x64, 0x64,
-    0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x64, 0x52, 0x52, 0x64, 0x5f, 0x66, 0x5f, 0x52, 0x52, 0x64, 0x52,
-    0x5f, 0x52, 0x52, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x64, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x64,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x64, 0x70, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x69, 0x69, 0x81, 0xcb, 0xa5, 0x69,
-    0x5f, 0x5f, 0x62, 0x51, 0x5f, 0x5f, 0x70, 0x70, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x66, 0x66, 0x69, 0x69, 0x66, 0x66, 0x66, 0x64, 0x64, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x69, 0x69, 0x69, 0x69,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x69, 0x69, 0x69, 0x69, 0x66, 0x64, 0x62, 0x62, 0x69, 0xa5, 0x73, 0x69,
-    0x69, 0x81, 0x69, 0x69, 0x69, 0x62, 0x51, 0x4d, 0x52, 0x4d, 0x66, 0x70,
-    0x66, 0x69, 0x69, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x51,
-    0x51, 0x67, 0x67, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x51, 0x51,
-    0x51, 0x62, 0x62, 0x51, 0x51, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-    0x51, 0x51, 0x62, 0x62, 0x69, 0x69, 0x69, 0x69, 0x51, 0x51, 0x51, 0x51,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x51, 0x51, 0x63, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x63, 0x63, 0x63, 0x53, 0x53, 0x53, 0x53, 0x51, 0x4a, 0x4a, 0x4a,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x64, 0x64, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x52, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
-    0x64, 0x5f, 0x66, 0x70, 0x66, 0x66, 0x5f, 0x64, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x7f, 0x70, 0x64, 0x64, 0x62, 0x69, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x62, 0x69, 0xa5, 0xb9, 0x74, 0x66, 0x52, 0x62, 0x62,
-    0x5f, 0x5f, 0x66, 0x7f, 0x69, 0x69, 0x69, 0x66, 0x66, 0x66, 0x69, 0x69,
-    0x66, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x66, 0x66, 0x66, 0x66, 0x69, 0x69, 0x69, 0x69, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x69, 0x69, 0x69, 0x69,
-    0x66, 0x64, 0x69, 0x73, 0x69, 0x9a, 0x69, 0x69, 0x69, 0x9a, 0x73, 0x62,
-    0x62, 0x51, 0x51, 0x51, 0x5f, 0x62, 0x66, 0x66, 0x66, 0x70, 0x69, 0x62,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x51, 0x51, 0x67, 0x67, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x62, 0x69, 0x62,
-    0x51, 0x62, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x62, 0x62, 0x62, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x62, 0x51, 0x51, 0x51, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x51, 0x51, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x63, 0x63, 0x63,
-    0x63, 0x53, 0x53, 0x53, 0x51, 0x4a, 0x4a, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x4a, 0x4a, 0x4a, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x52, 0x52, 0x52, 0x52,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64,
-    0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x52, 0x52, 0x64, 0x64,
-    0x64, 0x64, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x5f, 0x5f, 0x66,
-    0x66, 0x66, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x66, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x66, 0x66, 0x5f, 0x66, 0x66, 0x5f, 0x5f, 0x5f, 0x66, 0x66,
-    0x7f, 0x64, 0x66, 0x64, 0x62, 0x69, 0x64, 0x64, 0x64, 0x68, 0x66, 0x69,
-    0x69, 0x82, 0xcb, 0x76, 0x62, 0x69, 0x69, 0x5f, 0x5f, 0x70, 0x66, 0x9a,
-    0x69, 0x69, 0x69, 0x66, 0x66, 0x66, 0x64, 0x64, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x69, 0x69, 0x69, 0x69, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x69, 0x69, 0x73, 0x69, 0x69, 0x73, 0x69, 0x69,
-    0xa5, 0x69, 0x74, 0x69, 0x51, 0x69, 0x62, 0x69, 0x51, 0x51, 0x51, 0x62,
-    0x62, 0x69, 0x66, 0x5f, 0x66, 0x70, 0x73, 0x69, 0x62, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x62, 0x62, 0x69, 0x69, 0x62, 0x51, 0x62, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x62, 0x62, 0x62, 0x69, 0x62, 0x62, 0x62, 0x69,
-    0x62, 0x62, 0x63, 0x53, 0x53, 0x53, 0x53, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x63, 0x63, 0x63, 0x63, 0x53, 0x53,
-    0x51, 0x51, 0x4a, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x66, 0x5f, 0x64, 0x5f, 0x66, 0x5f, 0x66, 0x70,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x66, 0x66, 0x5f, 0x5f, 0x5f, 0x5f, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7f, 0x64, 0x66, 0x64,
-    0x69, 0x69, 0x66, 0x64, 0x64, 0x64, 0x64, 0x62, 0x69, 0x74, 0xdd, 0x74,
-    0x62, 0x62, 0x4d, 0x66, 0x5f, 0x70, 0x8d, 0x70, 0x69, 0x69, 0x5f, 0x69,
-    0x66, 0x66, 0x68, 0x68, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x69, 0x69, 0x69, 0x69,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x69,
-    0x69, 0x69, 0x69, 0x73, 0x69, 0x69, 0x69, 0xa5, 0x74, 0x69, 0x69, 0x74,
-    0x9a, 0x69, 0x69, 0x62, 0x51, 0x51, 0x69, 0x69, 0x69, 0x62, 0x66, 0x66,
-    0x66, 0x70, 0x73, 0x69, 0x62, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x62, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x62, 0x62, 0x62, 0x51, 0x51, 0x62, 0x62, 0x62, 0x69, 0x62, 0x62, 0x62,
-    0x62, 0x62, 0x62, 0x62, 0x51, 0x62, 0x62, 0x69, 0x69, 0x62, 0x63, 0x53,
-    0x53, 0x53, 0x53, 0x63, 0x63, 0x63, 0x63, 0x63, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x63, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x63, 0x67, 0x67, 0x67, 0x63, 0x53, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x52, 0x52, 0x52, 0x52, 0x52, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x5f, 0x5f, 0x64, 0x5f, 0x66, 0x5f, 0x66, 0x70, 0x66, 0x5f, 0x5f, 0x5f,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x70, 0x70, 0x66, 0x5f, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x69, 0x74, 0x74, 0xcb, 0x90, 0x69, 0x62, 0x69, 0x5f,
-    0x5f, 0x66, 0x7f, 0x66, 0x5f, 0x5f, 0x62, 0x5f, 0x69, 0x66, 0x68, 0x68,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x73,
-    0x73, 0x69, 0x81, 0xa5, 0x69, 0x74, 0x74, 0x74, 0xbb, 0x69, 0x69, 0x62,
-    0x69, 0x69, 0x74, 0x69, 0x62, 0x62, 0x69, 0x69, 0x69, 0x73, 0x73, 0x69,
-    0x62, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x62, 0x62,
-    0x62, 0x62, 0x69, 0x62, 0x62, 0x62, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x62, 0x69, 0x69, 0x69, 0x62, 0x63, 0x53, 0x63, 0x53, 0x53, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x53, 0x53, 0x53, 0x53, 0x63, 0x63, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x63, 0x63, 0x67,
-    0x67, 0x67, 0x63, 0x63, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x4a, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x52, 0x52, 0x52, 0x52,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x5f, 0x5f, 0x64, 0x5f,
-    0x5f, 0x64, 0x66, 0x70, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x5f, 0x5f, 0x66, 0x66, 0x66, 0x66, 0x5f, 0x5f, 0x5f, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x7f, 0x66, 0x5f, 0x66, 0x5f, 0x66, 0x66, 0x5f, 0x66, 0x66, 0x69,
-    0x51, 0x69, 0xa5, 0xcb, 0xa5, 0x62, 0x5f, 0x66, 0x5f, 0x66, 0x9a, 0x69,
-    0x69, 0x69, 0x5f, 0x69, 0x69, 0x66, 0x60, 0x60, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x73, 0x73, 0x69, 0x69, 0x73, 0x9a, 0x74,
-    0x74, 0x69, 0x74, 0xbb, 0x8d, 0x73, 0x69, 0x73, 0x69, 0x69, 0x69, 0x69,
-    0x62, 0x62, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x62, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x62, 0x62, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x62, 0x62, 0x51, 0x51, 0x51, 0x62, 0x62, 0x69, 0x69, 0x62,
-    0x62, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x62, 0x69, 0x69,
-    0x62, 0x62, 0x63, 0x53, 0x53, 0x53, 0x53, 0x53, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x63, 0x63, 0x67, 0x67, 0x67, 0x67, 0x67, 0x63,
-    0x62, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x4a,
-    0x53, 0x53, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x66, 0x64, 0x5f, 0x5f, 0x5f, 0x5f, 0x66, 0x70,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5f, 0x66, 0x66, 0x66,
-    0x66, 0x5f, 0x5f, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5f, 0x70, 0x66, 0x66,
-    0x66, 0x5f, 0x66, 0x66, 0x66, 0x66, 0x5f, 0x69, 0x69, 0x74, 0x74, 0x9c,
-    0xcb, 0x69, 0x69, 0x69, 0x69, 0x74, 0x9c, 0x8d, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x68, 0x68, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x69, 0x69, 0x69, 0x69, 0x73, 0x73, 0x73, 0x73, 0x73, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x73, 0x69, 0x81, 0x8d, 0x74, 0x74, 0x69, 0xbb, 0x76,
-    0x74, 0x69, 0x73, 0x69, 0x69, 0x62, 0x69, 0x69, 0x62, 0x62, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x62, 0x62, 0x51, 0x62, 0x62, 0x62, 0x69, 0x69,
-    0x69, 0x69, 0x62, 0x51, 0x51, 0x51, 0x51, 0x62, 0x62, 0x69, 0x69, 0x62,
-    0x51, 0x51, 0x51, 0x62, 0x69, 0x69, 0x69, 0x62, 0x51, 0x51, 0x51, 0x51,
-    0x63, 0x53, 0x53, 0x53, 0x51, 0x51, 0x51, 0x51, 0x63, 0x63, 0x63, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x53, 0x53, 0x53, 0x63, 0x63,
-    0x63, 0x63, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x53, 0x53, 0x53, 0x53, 0x53, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x5f, 0x66, 0x5f, 0x66, 0x66, 0x66, 0x5f, 0x66, 0x66, 0x66,
-    0x66, 0x5f, 0x5f, 0x5f, 0x5f, 0x66, 0x66, 0x66, 0x5f, 0x5f, 0x5f, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x70, 0x7f, 0x66, 0x66, 0x66, 0x66, 0x66, 0x70,
-    0x66, 0x66, 0x69, 0x69, 0x62, 0x69, 0x69, 0x74, 0xcb, 0x76, 0x69, 0x73,
-    0x74, 0x74, 0x9c, 0x90, 0x69, 0x66, 0x66, 0x69, 0x69, 0x69, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x70, 0x70, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x69, 0x69, 0x69, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x69, 0x69, 0x69, 0x73, 0x69, 0x73,
-    0x73, 0xa5, 0x73, 0x69, 0x74, 0x74, 0xa5, 0x69, 0x74, 0x69, 0x69, 0x69,
-    0x62, 0x62, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x62, 0x62, 0x62, 0x62, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x62, 0x51,
-    0x51, 0x51, 0x62, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x62, 0x62, 0x69,
-    0x69, 0x69, 0x69, 0x62, 0x62, 0x51, 0x51, 0x51, 0x63, 0x53, 0x53, 0x53,
-    0x51, 0x51, 0x51, 0x51, 0x63, 0x63, 0x63, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
-    0x51, 0x51, 0x53, 0x53, 0x53, 0x53, 0x53, 0x48, 0x53, 0x53, 0x53, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x68,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x66, 0x5f, 0x5f, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x5f, 0x5f, 0x66, 0x66, 0x66, 0x66, 0x5f, 0x5f, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x70, 0x66,
-    0x70, 0x70, 0x70, 0x66, 0x66, 0x70, 0x66, 0x66, 0x66, 0x66, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x67, 0xcb, 0xa5, 0x76, 0x76, 0x76, 0xb9, 0xe6, 0xaa,
-    0x73, 0x66, 0x66, 0x66, 0x69, 0x69, 0x69, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x66, 0x66, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x66, 0x69, 0x69, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x69, 0x69, 0x74, 0x69, 0x73, 0x9a, 0x74, 0x69, 0x73,
-    0x74, 0x76, 0xa5, 0x69, 0x69, 0x69, 0x62, 0x69, 0x62, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x62, 0x62, 0x69, 0x69, 0x62,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x69, 0x69, 0x51, 0x51, 0x62, 0x69, 0x74,
-    0x74, 0x74, 0x69, 0x69, 0x74, 0x74, 0x69, 0x69, 0x69, 0x69, 0x62, 0x62,
-    0x51, 0x51, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x51, 0x51, 0x51, 0x51,
-    0x63, 0x63, 0x63, 0x63, 0x53, 0x63, 0x67, 0x67, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x51, 0x62, 0x62, 0x69, 0x69, 0x69, 0x62, 0x62,
-    0x63, 0x63, 0x63, 0x63, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x68, 0x64, 0x64, 0x68, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x5f, 0x5f, 0x5f, 0x5f, 0x66, 0x66, 0x70, 0x70, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5f, 0x70, 0x70, 0x70, 0x66, 0x66,
-    0x66, 0x70, 0x70, 0x66, 0x70, 0x69, 0x69, 0x69, 0x69, 0x69, 0x74, 0x74,
-    0xa5, 0xcb, 0xbb, 0x96, 0xb9, 0xdd, 0xdd, 0x9c, 0x73, 0x70, 0x66, 0x66,
-    0x69, 0x74, 0x74, 0x69, 0x66, 0x66, 0x66, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x69, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x69,
-    0x74, 0x74, 0x73, 0x69, 0xbb, 0x74, 0x73, 0x74, 0x74, 0x74, 0xbb, 0x74,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x74, 0x69, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x69, 0x62, 0x69, 0x69, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x69, 0x69, 0x69, 0x69, 0x62, 0x62, 0x51, 0x51, 0x53, 0x53,
-    0x53, 0x63, 0x63, 0x63, 0x51, 0x51, 0x62, 0x62, 0x67, 0x63, 0x63, 0x63,
-    0x63, 0x67, 0x67, 0x67, 0x67, 0x67, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x62, 0x62, 0x69, 0x69, 0x69, 0x69, 0x62, 0x51, 0x63, 0x63, 0x63, 0x63,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x48, 0x48, 0x53, 0x53, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x66, 0x64, 0x64, 0x64, 0x64, 0x66, 0x66, 0x5f, 0x5f,
-    0x66, 0x66, 0x66, 0x70, 0x70, 0x70, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x70, 0x66, 0x66, 0x66, 0x73, 0x73, 0x66, 0x66, 0x66, 0x66, 0x70, 0x70,
-    0x66, 0x69, 0x69, 0x74, 0xa5, 0x9c, 0x9a, 0x9c, 0x74, 0x76, 0xb9, 0xcb,
-    0xcb, 0xcb, 0xdd, 0x82, 0x74, 0x70, 0x66, 0x66, 0x69, 0x74, 0x74, 0x74,
-    0x69, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x73, 0x73, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x74, 0x74, 0x73,
-    0xa5, 0x73, 0x74, 0x69, 0x74, 0x76, 0xcb, 0x74, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x69, 0x69,
-    0x69, 0x69, 0x62, 0x62, 0x67, 0x67, 0x53, 0x53, 0x53, 0x63, 0x67, 0x67,
-    0x62, 0x62, 0x69, 0x69, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x63, 0x63, 0x63, 0x63, 0x67, 0x67, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x69, 0x69,
-    0x69, 0x62, 0x62, 0x51, 0x63, 0x63, 0x63, 0x63, 0x63, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x68, 0x64, 0x68, 0x68, 0x68,
-    0x68, 0x66, 0x68, 0x64, 0x66, 0x66, 0x66, 0x66, 0x64, 0x64, 0x64, 0x64,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x70,
-    0x73, 0x73, 0x66, 0x66, 0x66, 0x70, 0x70, 0x70, 0x73, 0x74, 0xa5, 0xdd,
-    0x8d, 0x69, 0x69, 0x69, 0x69, 0x74, 0x67, 0x7e, 0x7e, 0xcb, 0x96, 0x76,
-    0x74, 0x70, 0x66, 0x66, 0x70, 0x74, 0x74, 0x74, 0x69, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x74, 0x74, 0x69, 0x81, 0xbb, 0x73, 0x74, 0x74,
-    0x74, 0x90, 0x9c, 0x76, 0x74, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x62, 0x62, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x62, 0x62, 0x69, 0x69, 0x69, 0x69, 0x62, 0x69, 0x69, 0x69, 0x74,
-    0x74, 0x69, 0x69, 0x69, 0x74, 0x74, 0x69, 0x69, 0x69, 0x69, 0x69, 0x62,
-    0x67, 0x67, 0x53, 0x53, 0x53, 0x63, 0x67, 0x67, 0x69, 0x69, 0x69, 0x69,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x63, 0x63,
-    0x63, 0x63, 0x67, 0x67, 0x67, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x62, 0x69, 0x69, 0x69, 0x62, 0x62, 0x62, 0x62,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x68, 0x68, 0x68, 0x68, 0x68, 0x64, 0x64, 0x64,
-    0x68, 0x68, 0x68, 0x68, 0x64, 0x68, 0x68, 0x68, 0x68, 0x70, 0x68, 0x64,
-    0x64, 0x64, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x73, 0x5f, 0x73, 0x69, 0x5f, 0x73, 0x73, 0x69, 0x81, 0x69, 0x70, 0x66,
-    0x66, 0x70, 0x70, 0x70, 0x69, 0x8d, 0xdd, 0x90, 0x74, 0x69, 0x73, 0x69,
-    0x69, 0x74, 0x76, 0x76, 0x7e, 0xdd, 0x82, 0x74, 0x74, 0x69, 0x66, 0x70,
-    0x70, 0x69, 0x74, 0x74, 0x73, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x69, 0x73,
-    0x74, 0x74, 0x8d, 0xbb, 0x81, 0x73, 0x74, 0x69, 0x74, 0x90, 0xbb, 0x76,
-    0x74, 0x74, 0x69, 0x69, 0x69, 0x69, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x62, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x74, 0x74, 0x74, 0x74, 0x69, 0x69,
-    0x73, 0x73, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x67, 0x67, 0x63, 0x53,
-    0x63, 0x67, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x67, 0x67,
-    0x67, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x69, 0x69, 0x69, 0x69, 0x62, 0x62, 0x62, 0x51, 0x63, 0x63, 0x63, 0x63,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x50, 0x50, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x50, 0x50,
-    0x64, 0x64, 0x64, 0x64, 0x68, 0x68, 0x68, 0x68, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x68, 0x68, 0x68, 0x68,
-    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x66, 0x66, 0x66, 0x64, 0x64, 0x64, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x5f, 0x69, 0xbb, 0x9a,
-    0x73, 0x69, 0x73, 0x73, 0x73, 0x69, 0x70, 0x70, 0x70, 0x70, 0x70, 0x73,
-    0x73, 0x74, 0x9c, 0x74, 0x74, 0x74, 0x69, 0x69, 0x73, 0x74, 0x90, 0xcb,
-    0xdd, 0x9c, 0x74, 0x74, 0x74, 0x74, 0x70, 0x70, 0x70, 0x70, 0x74, 0x74,
-    0x73, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x73, 0x73, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x81, 0xa5, 0xbb, 0x8d, 0x73,
-    0x74, 0x69, 0x73, 0x74, 0x74, 0x76, 0xdd, 0x74, 0x74, 0x74, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73, 0x73, 0x74, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x67, 0x67, 0x63, 0x63, 0x63, 0x67, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x67, 0x67, 0x67, 0x67, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x67, 0x67, 0x63, 0x63, 0x69, 0x69, 0x69, 0x69,
-    0x62, 0x62, 0x51, 0x51, 0x63, 0x63, 0x63, 0x63, 0x63, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x50, 0x50,
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x50, 0x50, 0x64, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x64, 0x64, 0x64, 0x64,
-    0x64, 0x64, 0x64, 0x64, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x66, 0x70, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x69, 0x69, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0xbb, 0x81, 0x73, 0x69, 0x73, 0x81,
-    0x74, 0x69, 0x70, 0x70, 0x70, 0x70, 0x70, 0x73, 0x73, 0x74, 0xa5, 0x74,
-    0x74, 0x74, 0x69, 0x73, 0x69, 0x81, 0xdd, 0x82, 0x76, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x69, 0x70, 0x70, 0x70, 0x73, 0x73, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x73,
-    0x74, 0x74, 0x74, 0x9a, 0x74, 0x74, 0x73, 0x73, 0x73, 0x74, 0x69, 0x74,
-    0x74, 0x76, 0xcb, 0x82, 0x74, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x74, 0x74,
-    0x74, 0x74, 0x69, 0x69, 0x73, 0x73, 0x74, 0x74, 0x69, 0x69, 0x69, 0x69,
-    0x67, 0x67, 0x67, 0x67, 0x62, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x63, 0x63, 0x69, 0x69, 0x69, 0x62, 0x62, 0x62, 0x51, 0x51,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x50, 0x50, 0x50, 0x50, 0x48, 0x48, 0x48, 0x48,
-    0x50, 0x50, 0x50, 0x50, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x64, 0x64, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x66,
-    0x70, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x69, 0x69,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x81, 0x81, 0x73, 0x81, 0x81, 0x73, 0x74, 0x73, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x73, 0x74, 0x9c, 0x9c, 0x74, 0x74, 0x73, 0x73,
-    0x74, 0xcb, 0x90, 0x76, 0x74, 0x73, 0x73, 0x69, 0x74, 0x74, 0x73, 0x73,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x73, 0x74, 0x73, 0x81, 0xa5,
-    0x74, 0x74, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x82, 0xcb, 0x76,
-    0x74, 0x74, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
-    0x74, 0x74, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73, 0x73,
-    0x73, 0x73, 0x74, 0x74, 0x69, 0x69, 0x69, 0x69, 0x67, 0x67, 0x67, 0x67,
-    0x62, 0x69, 0x69, 0x69, 0x69, 0x69, 0x73, 0x73, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x63, 0x63, 0x63, 0x63,
-    0x69, 0x69, 0x62, 0x62, 0x62, 0x62, 0x51, 0x51, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x48, 0x53, 0x53, 0x48, 0x48,
-    0x50, 0x50, 0x50, 0x50, 0x48, 0x48, 0x48, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x70, 0x68, 0x68, 0x66, 0x68, 0x68, 0x60,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x70, 0x70, 0x70,
-    0x70, 0x66, 0x68, 0x68, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x70, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x73, 0x73, 0x69, 0x66, 0x66, 0x66, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x9a, 0xbb, 0x73, 0x73, 0x69, 0x73, 0x70, 0x70, 0x70, 0x66, 0x70, 0x70,
-    0x70, 0x8d, 0x81, 0x74, 0x74, 0x74, 0x74, 0x74, 0x76, 0xcb, 0x76, 0x73,
-    0x73, 0x73, 0x69, 0x73, 0x70, 0x70, 0x73, 0x73, 0x74, 0x73, 0x70, 0x70,
-    0x70, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
-    0x74, 0x74, 0x74, 0x73, 0x74, 0x74, 0xbb, 0x81, 0x74, 0x74, 0x69, 0x73,
-    0x74, 0x74, 0x73, 0x73, 0x74, 0x76, 0xb9, 0x76, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73, 0x74,
-    0x74, 0x73, 0x73, 0x69, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73, 0x73,
-    0x73, 0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x69, 0x69, 0x62, 0x62, 0x62, 0x62, 0x69, 0x69, 0x67, 0x67,
-    0x74, 0x74, 0x73, 0x73, 0x76, 0x76, 0x63, 0x63, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x63, 0x63, 0x63, 0x63,
-    0x67, 0x67, 0x67, 0x67, 0x69, 0x69, 0x69, 0x69, 0x67, 0x67, 0x67, 0x63,
-    0x63, 0x63, 0x63, 0x67, 0x62, 0x62, 0x62, 0x62, 0x62, 0x51, 0x62, 0x62,
-    0x63, 0x63, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x66, 0x68, 0x68, 0x68,
-    0x66, 0x70, 0x68, 0x68, 0x70, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x66, 0x66, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x70, 0x70, 0x70, 0x70, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x70, 0x70, 0x70, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x70, 0x70, 0x70, 0x70, 0x70, 0x66, 0x66, 0x66, 0x66,
-    0x70, 0x70, 0x69, 0x69, 0x69, 0x69, 0x73, 0x73, 0x69, 0x69, 0x69, 0x69,
-    0x70, 0x70, 0x70, 0x66, 0x70, 0x66, 0x8d, 0x66, 0x8d, 0x73, 0x69, 0x69,
-    0x73, 0x73, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x8d, 0x7f, 0x73, 0x73,
-    0x74, 0x74, 0x74, 0x74, 0x90, 0xcb, 0x74, 0x73, 0x73, 0x70, 0x73, 0x69,
-    0x70, 0x70, 0x70, 0x74, 0x74, 0x74, 0x70, 0x70, 0x70, 0x73, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x73, 0x74, 0x74,
-    0x74, 0x74, 0xa5, 0x92, 0x74, 0x74, 0x73, 0x73, 0x74, 0x74, 0x69, 0x73,
-    0x74, 0x76, 0xcb, 0x76, 0x74, 0x74, 0x74, 0x76, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x69,
-    0x69, 0x69, 0x62, 0x62, 0x69, 0x69, 0x67, 0x76, 0x74, 0x74, 0x73, 0x73,
-    0x76, 0x76, 0x63, 0x63, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x63, 0x63, 0x63, 0x63, 0x67, 0x67, 0x69, 0x69,
-    0x69, 0x69, 0x69, 0x69, 0x67, 0x67, 0x67, 0x67, 0x63, 0x63, 0x63, 0x67,
-    0x62, 0x69, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x50, 0x50, 0x50, 0x50, 0x70, 0x70, 0x68, 0x70, 0x70, 0x70, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x70, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-    0x68, 0x68, 0x68, 0x68, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x68, 0x68,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x70, 0x66, 0x66, 0x70, 0x70, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x66, 0x66, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x66, 0x66, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x73, 0x73, 0x73, 0x73,
-    0x73, 0x69, 0x69, 0x69, 0x69, 0x73, 0x73, 0x73, 0x7f, 0x7f, 0x70, 0x70,
-    0x70, 0x70, 0x7f, 0x70, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
-    0x7f, 0x66, 0x70, 0x7f, 0x9a, 0x81, 0x69, 0x73, 0x74, 0x81, 0x74, 0x81,
-    0xdd, 0x90, 0x74, 0x74, 0x69, 0x73, 0x73, 0x73, 0x70, 0x70, 0x70, 0x74,
-    0x74, 0x74, 0x70, 0x70, 0x70, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
-    0x73, 0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x81, 0x92,
-    0xa5, 0x9c, 0x73, 0x73, 0x74, 0x74, 0x73, 0x73, 0x74, 0x76, 0xcb, 0x82,
-    0x74, 0x74, 0x74, 0x76, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x69, 0x69, 0x76, 0x76, 0x74, 0x74, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x63, 0x63, 0x63, 0x63, 0x67, 0x67, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x69, 0x69, 0x69, 0x69,
-    0x62, 0x62, 0x62, 0x62, 0x63, 0x67, 0x63, 0x63, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x50, 0x50, 0x50, 0x50,
-    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x68, 0x70, 0x70, 0x70, 0x68, 0x70, 0x68, 0x68, 0x68, 0x70, 0x68, 0x70,
-    0x70, 0x68, 0x68, 0x68, 0x68, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x70, 0x70, 0x70, 0x66, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x66, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x69, 0x69,
-    0x73, 0x69, 0x73, 0x81, 0x7f, 0x7f, 0x8d, 0x8d, 0x7f, 0x8d, 0x7f, 0x70,
-    0x69, 0x73, 0x73, 0x69, 0x73, 0x73, 0x73, 0x73, 0x70, 0x7f, 0x7f, 0x9a,
-    0x9a, 0x73, 0x73, 0x73, 0x74, 0x74, 0x81, 0xcb, 0xaa, 0x76, 0x74, 0x74,
-    0x69, 0x73, 0x73, 0x73, 0x70, 0x70, 0x73, 0x74, 0x74, 0x74, 0x70, 0x70,
-    0x70, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x81, 0x82, 0xa5, 0x73, 0x73,
-    0x74, 0x74, 0x73, 0x73, 0x74, 0x82, 0xa5, 0xa5, 0x74, 0x74, 0x74, 0x76,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73, 0x74,
-    0x73, 0x73, 0x73, 0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x76, 0x76,
-    0x74, 0x74, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x63, 0x63, 0x63, 0x63,
-    0x67, 0x67, 0x69, 0x69, 0x69, 0x73, 0x69, 0x69, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x69, 0x69, 0x69, 0x69, 0x69, 0x62, 0x62, 0x67,
-    0x63, 0x67, 0x63, 0x63, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x70, 0x66, 0x68, 0x68,
-    0x68, 0x7f, 0x68, 0x7f, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x66,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x66, 0x66, 0x66,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x66, 0x66, 0x66, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x66, 0x66, 0x66, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x66, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x73, 0x73, 0x73, 0x69, 0x73, 0x73, 0x73, 0x73, 0x73, 0x81, 0x81, 0x81,
-    0x7f, 0x70, 0x70, 0x7f, 0x7f, 0x70, 0x70, 0x70, 0x73, 0x73, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x8d, 0xa5, 0xa5, 0x81, 0x73, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0xcb, 0x90, 0x82, 0x74, 0x73, 0x81, 0x74, 0x74, 0x73,
-    0x70, 0x70, 0x73, 0x74, 0x74, 0x74, 0x70, 0x70, 0x7f, 0x73, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0xa5, 0x92, 0x73, 0x73, 0x74, 0x76, 0x73, 0x73,
-    0x74, 0x82, 0x76, 0xcb, 0x74, 0x74, 0x74, 0x76, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x63, 0x63, 0x63, 0x63, 0x67, 0x67, 0x76, 0x76,
-    0x76, 0x76, 0x69, 0x69, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x69, 0x69, 0x69, 0x69, 0x62, 0x67, 0x63, 0x63, 0x63, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x50, 0x50,
-    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x50, 0x50, 0x50, 0x50, 0x67, 0x67, 0x74, 0x73, 0x73, 0x70, 0x7f, 0x7f,
-    0x7f, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x73, 0x73, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x81, 0x81, 0x81, 0x70, 0x70, 0x7f, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x73, 0x73, 0x69, 0x73, 0x73, 0x73, 0x73, 0x73,
-    0x81, 0x9a, 0x81, 0x81, 0x81, 0x73, 0x74, 0x74, 0x74, 0x74, 0x81, 0xb9,
-    0xb9, 0x82, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73, 0x70, 0x73, 0x74,
-    0x74, 0x74, 0x70, 0x7f, 0x73, 0x73, 0x73, 0x73, 0x81, 0x81, 0x81, 0x73,
-    0x81, 0x81, 0x81, 0x81, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
-    0x73, 0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x81, 0x74,
-    0xbb, 0x74, 0x73, 0x73, 0x74, 0x76, 0x74, 0x74, 0x74, 0x76, 0x76, 0xcb,
-    0x81, 0x74, 0x76, 0x76, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x69, 0x69, 0x69, 0x69,
-    0x73, 0x73, 0x73, 0x69, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x63, 0x63, 0x67, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x69, 0x69,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x69, 0x69,
-    0x69, 0x69, 0x62, 0x67, 0x67, 0x67, 0x63, 0x63, 0x53, 0x53, 0x53, 0x53,
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x2f, 0x61, 0x50, 0x50, 0x2f, 0x2f, 0x69, 0x7f, 0x73, 0x7f, 0x7f, 0x7f,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
-    0x81, 0x81, 0x81, 0x73, 0x73, 0x73, 0x70, 0x70, 0x70, 0x70, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x81, 0x73, 0x9a, 0x73, 0x74, 0x74,
-    0x81, 0x81, 0x74, 0x74, 0x74, 0x81, 0x81, 0x81, 0xcb, 0xb9, 0xcb, 0x8d,
-    0x81, 0x74, 0x74, 0x74, 0x73, 0x73, 0x73, 0x74, 0x74, 0x74, 0x73, 0x7f,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x73, 0x73, 0x73, 0x73, 0x81, 0x81, 0x81, 0x81, 0x81, 0x74, 0x74, 0x74,
-    0x81, 0x74, 0x81, 0x81, 0x74, 0x74, 0x81, 0x81, 0x9c, 0xa5, 0x9a, 0x81,
-    0x81, 0x74, 0x74, 0x74, 0x74, 0x76, 0x82, 0xcb, 0x76, 0x74, 0x76, 0x82,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x81, 0x81, 0x81, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x81,
-    0x76, 0x76, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x69, 0x69, 0x69, 0x73, 0x73, 0x73, 0x73, 0x69,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67,
-    0x67, 0x67, 0x76, 0x76, 0x67, 0x67, 0x76, 0x76, 0x76, 0x67, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x63, 0x63, 0x53, 0x53, 0x53, 0x53, 0x65, 0x50, 0x50, 0x50,
-    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x20, 0x20, 0x20, 0x20,
-    0x16, 0x2f, 0x67, 0x73, 0x73, 0x7f, 0x7f, 0x7f, 0x7f, 0x70, 0x70, 0x70,
-    0x68, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x81, 0x81, 0x81, 0x73, 0x73, 0x73,
-    0x73, 0x73, 0x70, 0x70, 0x70, 0x7f, 0x73, 0x81, 0x73, 0x73, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x9a, 0x81, 0x73, 0x74, 0x74, 0x74, 0x81, 0x81, 0x74,
-    0x74, 0x74, 0x74, 0x81, 0x82, 0xbb, 0xa5, 0xcb, 0x81, 0x82, 0x82, 0x76,
-    0x74, 0x73, 0x73, 0x74, 0x74, 0x81, 0x81, 0x7f, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x73, 0x73, 0x73, 0x73,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x74, 0x74, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x74, 0x81, 0x81, 0x81, 0x73, 0x9a, 0x81, 0x76, 0x81, 0x81,
-    0x76, 0x76, 0x82, 0xcb, 0x82, 0x74, 0x76, 0x76, 0x74, 0x74, 0x81, 0x81,
-    0x74, 0x81, 0x81, 0x81, 0x74, 0x74, 0x81, 0x81, 0x81, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x76, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x67, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x63, 0x63,
-    0x53, 0x53, 0x53, 0x53, 0x65, 0x65, 0x65, 0x65, 0x50, 0x50, 0x50, 0x50,
-    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x50, 0x50, 0x50, 0x50, 0x07, 0x07, 0x07, 0x09, 0x07, 0x16, 0x2f, 0x67,
-    0x73, 0x7f, 0x68, 0x7f, 0x7f, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x73, 0x73, 0x73, 0x73, 0x81, 0x81, 0x73, 0x73, 0x73, 0x73,
-    0x81, 0x8d, 0x81, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x70, 0x70,
-    0x7f, 0x70, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x81, 0x74, 0x81, 0x9c,
-    0x81, 0x74, 0x74, 0x81, 0x74, 0x81, 0x74, 0x81, 0x74, 0x81, 0x74, 0x81,
-    0x82, 0x82, 0x92, 0xbb, 0xcb, 0x9c, 0x82, 0x82, 0x81, 0x74, 0x74, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x74, 0x81, 0x81, 0x9c, 0x82, 0x74, 0x81, 0x82, 0x76, 0x82, 0xcb,
-    0x82, 0x81, 0x76, 0x82, 0x81, 0x81, 0x74, 0x74, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x74, 0x81, 0x82, 0x82,
-    0x82, 0x76, 0x82, 0x82, 0x82, 0x76, 0x76, 0x76, 0x74, 0x76, 0x76, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x7e, 0x7e, 0x7e, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x63, 0x63, 0x63, 0x65, 0x65,
-    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x09, 0x09, 0x07, 0x07, 0x09, 0x39, 0x30, 0x65, 0x73, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x7f, 0x70, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x81, 0x73, 0x73, 0x73, 0x81, 0x81, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x7f, 0x7f, 0x7f, 0x7f, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x73, 0x74, 0x81, 0x9c, 0x81, 0x81, 0x81, 0x81, 0x74,
-    0x81, 0x81, 0x8d, 0x74, 0x81, 0x74, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x9c, 0xcb, 0xcb, 0x82, 0x74, 0x74, 0x81, 0x74, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x74,
-    0x81, 0xa5, 0x81, 0x81, 0x76, 0x82, 0x82, 0xcb, 0x82, 0x81, 0x82, 0x82,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x76, 0x76, 0x76, 0x76, 0x76, 0x74, 0x74, 0x74, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x73, 0x73, 0x73, 0x74, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x63, 0x65, 0x65, 0x50, 0x50, 0x50, 0x50,
-    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x16, 0x30, 0x20, 0x07,
-    0x09, 0x07, 0x20, 0x16, 0x2f, 0x74, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x7f, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
-    0x73, 0x73, 0x81, 0x8d, 0x9a, 0x81, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x73, 0x73, 0x81, 0x81,
-    0x81, 0x81, 0x9c, 0xbb, 0x9c, 0x81, 0xa5, 0x8d, 0xcb, 0x9c, 0x81, 0x81,
-    0x81, 0x81, 0x74, 0x81, 0x74, 0x81, 0x81, 0x81, 0x90, 0x90, 0xcb, 0x90,
-    0x81, 0x81, 0x81, 0x8d, 0xa5, 0xa5, 0xa5, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x76, 0xbb, 0x81, 0x81,
-    0x82, 0x82, 0x90, 0xcb, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x76, 0x76, 0x82, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73, 0x73,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x76, 0x76, 0x76, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x50, 0x65, 0x50, 0x50, 0x50, 0x65, 0x50, 0x50, 0x50,
-    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x50, 0x50, 0x50, 0x50, 0x2f, 0x30, 0x30, 0x20, 0x23, 0x07, 0x20, 0x30,
-    0x50, 0x76, 0x73, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x73, 0x73,
-    0x73, 0x73, 0x73, 0x81, 0x81, 0x81, 0x8d, 0x8d, 0x8d, 0x9a, 0x81, 0x81,
-    0x81, 0x73, 0x73, 0x73, 0x73, 0x73, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x74,
-    0x9c, 0xbb, 0x8d, 0xbb, 0xa5, 0xbb, 0x8d, 0x81, 0x74, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x90, 0x96, 0xdd, 0x90, 0x81, 0x81, 0x9c, 0x9c,
-    0x82, 0x81, 0x81, 0xbb, 0x81, 0x8d, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x82, 0xa5, 0x82, 0x82, 0x82, 0x90, 0x7e, 0xcb,
-    0x76, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x76, 0x76, 0x82, 0x74,
-    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73, 0x74, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67,
-    0x67, 0x67, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x50, 0x50, 0x65, 0x65, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x2f, 0x30, 0x16, 0x09, 0x07, 0x07, 0x30, 0x61, 0x50, 0x7e, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x7f, 0x73, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x73, 0x73, 0x73, 0x81, 0x81, 0x81, 0x81, 0x73, 0x81, 0x73,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x8d, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x90,
-    0x82, 0x96, 0xe6, 0xb9, 0x90, 0x81, 0xa5, 0x81, 0x81, 0x81, 0x81, 0x8d,
-    0x9a, 0x81, 0x8d, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x82, 0xa5, 0x82, 0x90, 0x92, 0x82, 0xb9, 0x96, 0x82, 0x81, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x74, 0x82, 0x82, 0x74, 0x76, 0x76, 0x74, 0x74,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x67, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x50,
-    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x65, 0x30, 0x16, 0x09, 0x07,
-    0x06, 0x06, 0x30, 0x61, 0x2f, 0x7e, 0x69, 0x7f, 0x81, 0x81, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x7f, 0x7f, 0x7f, 0x70, 0x70, 0x70, 0x7f,
-    0x73, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x73, 0x81, 0x73, 0x73, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x73, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x90, 0x96, 0xaa, 0xdd,
-    0xa5, 0xa5, 0x8d, 0x81, 0x81, 0x81, 0x8d, 0x81, 0x9a, 0xa5, 0x81, 0x8d,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0xa5, 0x82, 0x82,
-    0x82, 0x90, 0xcb, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x74, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x82, 0x82, 0x82, 0x82, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x82, 0x82, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x67,
-    0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x50, 0x50, 0x50, 0x50,
-    0x50, 0x50, 0x65, 0x65, 0x65, 0x65, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
-    0x65, 0x65, 0x65, 0x65, 0x39, 0x09, 0x07, 0x03, 0x03, 0x03, 0x07, 0x13,
-    0x30, 0x2f, 0x2f, 0x82, 0x81, 0x8d, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x7f, 0x70, 0x70, 0x7f, 0x7f, 0x70, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x74, 0x81, 0x81, 0x81, 0x81, 0x74, 0x81, 0x81, 0x73, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x8d, 0x90, 0x90, 0x96, 0xbc, 0xdd, 0x90, 0x81, 0x8d, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x8d, 0xbb, 0x8d, 0x8d, 0x81, 0x81, 0x8d,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x82, 0xa5, 0x90, 0x82, 0x90, 0x90, 0xcb, 0x7e,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x76, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x7e, 0x7e, 0x7e, 0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x50, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x07, 0x06, 0x03, 0x01, 0x01, 0x01, 0x03, 0x07, 0x13, 0x30, 0x2f, 0x7e,
-    0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x70, 0x70,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x73, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x8d, 0x81, 0x81, 0x8d, 0x81, 0x81, 0x81, 0x81, 0x81, 0x90, 0x90,
-    0xaa, 0xdd, 0xdd, 0xaa, 0x90, 0x81, 0x81, 0x81, 0x92, 0x81, 0x81, 0x81,
-    0x81, 0x8d, 0x8d, 0x9a, 0x9a, 0x9a, 0x8d, 0x8d, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x90, 0x81, 0x81, 0x81,
-    0x82, 0x90, 0xa5, 0x90, 0x90, 0xb9, 0xb9, 0x7e, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x92, 0x92, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x7e, 0x7e, 0x76, 0x76,
-    0x76, 0x76, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x06, 0x09, 0x30, 0x65, 0x76, 0x81, 0x8d, 0x7f, 0x7f,
-    0x7f, 0x8d, 0x7f, 0x7f, 0x8d, 0x8d, 0x8d, 0x7f, 0x8d, 0x8d, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x73, 0x7f, 0x7f, 0x7f, 0x81, 0x73, 0x73,
-    0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x73, 0x73, 0x73, 0x73,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x73, 0x73, 0x73, 0x73, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x81, 0x73, 0x73, 0x73, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x8d, 0x90, 0x96, 0xdd, 0xb9, 0xaa, 0x90,
-    0x82, 0x81, 0x7f, 0x7f, 0x81, 0x82, 0x81, 0x81, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x9c, 0xa5, 0xa5, 0x9c, 0x8d, 0x8d, 0x8d, 0xbb, 0x9c, 0x8d, 0x90,
-    0x81, 0x8d, 0x8d, 0x8d, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x8d,
-    0x8d, 0x8d, 0x81, 0x81, 0x90, 0x82, 0x81, 0x82, 0x92, 0x82, 0x9c, 0xa5,
-    0xbc, 0xdd, 0x96, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x92, 0x90, 0x92, 0x92, 0x92, 0x92, 0x92, 0x82, 0x82, 0x82,
-    0x92, 0x82, 0x82, 0x82, 0x92, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x76, 0x76, 0x76, 0x76,
-    0x76, 0x76, 0x76, 0x76, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x76, 0x76, 0x76, 0x76, 0x67,
-    0x67, 0x67, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x61, 0x61, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03,
-    0x07, 0x20, 0x2f, 0x50, 0x81, 0x7f, 0x7f, 0x9a, 0x8d, 0x9c, 0x7e, 0x65,
-    0x7d, 0x7e, 0x9a, 0x8d, 0x9a, 0x8d, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x81,
-    0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x81, 0x81, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x81, 0x81, 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x81,
-    0x81, 0x73, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x8d, 0x81, 0x96, 0xaa, 0xdd, 0x96, 0x90, 0x90, 0x81, 0x81, 0x7f, 0x7f,
-    0x81, 0x82, 0x81, 0x81, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x9c, 0xa5, 0xa5, 0xa5, 0xbb, 0x9c, 0x90, 0x90, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x81, 0x81, 0x81, 0x81, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x90, 0x90, 0x8d, 0x82, 0x82, 0x90, 0x92, 0x90, 0xcb, 0xbc, 0xa8, 0x90,
-    0x7e, 0x82, 0x82, 0x92, 0x82, 0x90, 0x90, 0x90, 0x92, 0x92, 0x90, 0x90,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x7e, 0x7e, 0x7e, 0x7e, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x76,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x76, 0x65, 0x76, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x65, 0x65, 0x61, 0x61,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x03, 0x07, 0x09, 0x2f,
-    0x7e, 0x9a, 0x9a, 0x9a, 0x92, 0x7e, 0x30, 0x09, 0x07, 0x30, 0x7e, 0x9a,
-    0x8d, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x73, 0x81, 0x81, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x81, 0x81,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x92, 0x90, 0xaa, 0xdd,
-    0xcb, 0x9c, 0x90, 0x92, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x9c, 0x9c,
-    0x92, 0x81, 0x81, 0x8d, 0x8d, 0x8d, 0x92, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x90, 0x82, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0xcb, 0xbc, 0x7e, 0xb9, 0x7e, 0x90, 0x90, 0x82, 0x82,
-    0x82, 0x90, 0x92, 0x90, 0x90, 0x90, 0x90, 0x90, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x90, 0x90, 0x90, 0x90, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x61,
-    0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x61, 0x61, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x06, 0x13, 0x16, 0x48, 0x9a, 0x9a, 0x92,
-    0x65, 0x2f, 0x13, 0x06, 0x06, 0x07, 0x65, 0x9a, 0x9a, 0x9a, 0x9a, 0x8d,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x81, 0x81, 0x81, 0x90, 0x90, 0x96, 0xcb, 0xcb, 0x9c, 0x92, 0x90, 0x8d,
-    0x81, 0x81, 0x81, 0x92, 0x90, 0x90, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x92, 0x92, 0x8d, 0x8d, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x92,
-    0x92, 0x92, 0x8d, 0x8d, 0x90, 0x90, 0x90, 0x82, 0x90, 0x90, 0xa8, 0xcb,
-    0x96, 0x96, 0xbc, 0x96, 0x90, 0x90, 0x90, 0x90, 0x82, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x90, 0x90, 0x90, 0x90, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x61, 0x61, 0x61, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x36, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
-    0x03, 0x06, 0x09, 0x61, 0x96, 0xa5, 0x92, 0xaf, 0x9f, 0x13, 0x07, 0x06,
-    0x06, 0x13, 0x91, 0x92, 0x9a, 0x9a, 0x8d, 0x8d, 0x8d, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x81,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x81, 0x81, 0x81, 0x8d,
-    0x90, 0xaa, 0xe6, 0xaa, 0x9c, 0x9a, 0x8d, 0x8d, 0x81, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x7f, 0x7f, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x8d, 0x8d, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x8d, 0x8d, 0x8d, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x92, 0x90, 0x82, 0x90, 0x90, 0x90, 0xcb, 0x96, 0x96, 0x96, 0x96, 0xb9,
-    0x96, 0x90, 0x90, 0x82, 0x92, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x92, 0x92, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x90, 0x90, 0x90, 0x90, 0x90, 0x82, 0x82, 0x82,
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x06, 0x03, 0x03, 0x03, 0x01, 0x01, 0x03, 0x06, 0x03, 0x1a, 0x39, 0x16,
-    0x7e, 0x7e, 0x7e, 0x61, 0x20, 0x07, 0x06, 0x06, 0x06, 0x4f, 0xb6, 0x50,
-    0x81, 0x9a, 0x9a, 0x8d, 0x8d, 0x8d, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x81, 0x81, 0x8d, 0x7f, 0x7f, 0x7f, 0x7f, 0x8d, 0x81, 0x81, 0x81, 0x81,
-    0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x8d, 0x8d, 0x8d, 0x8d, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x81, 0x81, 0x8d, 0x90, 0x96, 0xdd, 0xbc, 0xaa,
-    0x90, 0x9a, 0x8d, 0x8d, 0x8d, 0x90, 0x90, 0x90, 0x90, 0x90, 0x7f, 0x7f,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x8d,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8d, 0x90, 0x90, 0x82,
-    0x90, 0x96, 0xcb, 0x96, 0x96, 0x96, 0x96, 0x96, 0xb9, 0x96, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x92, 0x92, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x82, 0x82, 0x82, 0x82, 0x82,
-    0x90, 0x90, 0x90, 0x90, 0x82, 0x82, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x06, 0x07, 0x16, 0x30, 0x30, 0x09,
-    0x06, 0x03, 0x06, 0x06, 0x06, 0x32, 0x4f, 0x16, 0x2f, 0x74, 0x9a, 0x9a,
-    0x8d, 0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x90, 0x92,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x8d, 0x8d, 0x7f, 0x7f, 0x8d, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x81, 0x8d, 0x90, 0x96, 0xdd, 0xb2, 0xaa, 0xa5, 0x9a, 0x9a, 0x8d,
-    0x8d, 0x90, 0x90, 0x90, 0x90, 0x8d, 0x7f, 0x7f, 0x8d, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x92, 0x92, 0x92, 0x90, 0x90, 0x96, 0x90, 0x90, 0xcb, 0x96,
-    0x90, 0x90, 0x96, 0x96, 0x96, 0xb9, 0xb9, 0x96, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x03,
-    0x01, 0x01, 0x01, 0x06, 0x39, 0x20, 0x4f, 0x06, 0x03, 0x03, 0x07, 0x07,
-    0x06, 0x06, 0x07, 0x20, 0x61, 0xa8, 0x9a, 0x7f, 0x8d, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x81, 0x81, 0x81, 0x7f, 0x8d, 0x90, 0x90, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x7f, 0x7f, 0x8d, 0x90, 0x90, 0x90, 0x90, 0x81, 0x81, 0x8d,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x8d, 0x8d, 0x92, 0x8d, 0x8d, 0x8d, 0x92, 0x90,
-    0x96, 0xe6, 0xcb, 0xaa, 0x9c, 0x9c, 0x9c, 0x8d, 0x8d, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x8d, 0x8d, 0x8d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x92, 0x92,
-    0x92, 0x90, 0x90, 0x90, 0x90, 0x96, 0xbc, 0xcb, 0x90, 0x90, 0x96, 0x7e,
-    0x90, 0x90, 0x96, 0xcb, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x7e, 0x7e, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x03,
-    0x09, 0x4f, 0x07, 0x03, 0x01, 0x03, 0x15, 0x4f, 0x32, 0x06, 0x07, 0x20,
-    0xa3, 0x96, 0x9c, 0x92, 0x92, 0x8d, 0x7f, 0x7f, 0x7f, 0x73, 0x82, 0x82,
-    0x82, 0x82, 0x92, 0x92, 0x9a, 0x9a, 0x8d, 0x9a, 0x9a, 0x8d, 0x9a, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x92, 0x8d, 0x8d, 0x8d, 0x8d, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x8d, 0x8d, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x8d, 0x8d, 0x81, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x92, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x92, 0x8d, 0x92, 0x92, 0x92, 0x92, 0x8d, 0x92, 0x8d,
-    0x81, 0x92, 0x92, 0x8d, 0x92, 0x92, 0x92, 0x90, 0xb9, 0xaf, 0xdd, 0xdd,
-    0xaa, 0x96, 0x9c, 0x9a, 0x8d, 0x8d, 0x90, 0x90, 0x90, 0x90, 0x92, 0x8d,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x92, 0x92, 0x9c, 0x9c, 0x9c, 0x9c, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x92, 0x92, 0x90, 0x90, 0x90, 0x92, 0x92, 0x92, 0x90, 0x96,
-    0x90, 0x96, 0xaf, 0xcb, 0x96, 0x90, 0x96, 0x96, 0x90, 0x90, 0x96, 0xcb,
-    0x90, 0x90, 0x90, 0x90, 0x92, 0x92, 0x90, 0x92, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x7e, 0x7e, 0x7e, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7d, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x8c, 0x7d, 0x8c, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x06, 0x07, 0x01, 0x01,
-    0x01, 0x03, 0x07, 0x15, 0x06, 0x06, 0x07, 0x5b, 0xa1, 0xa5, 0x9c, 0x92,
-    0x8d, 0x8d, 0x8d, 0x7f, 0x7f, 0x90, 0x65, 0x30, 0x50, 0x98, 0x96, 0x90,
-    0x96, 0x96, 0x9a, 0x8d, 0x8d, 0x8d, 0x8d, 0x9a, 0x9a, 0x8d, 0x8d, 0x9a,
-    0x8d, 0x9a, 0x8d, 0x8d, 0x8d, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x8d,
-    0x81, 0x81, 0x8d, 0x8d, 0x8d, 0x8d, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0xa5, 0xa5, 0x9c, 0x92, 0x92, 0x92, 0x92, 0x92, 0x8d, 0x8d, 0x92,
-    0x92, 0x8d, 0x92, 0xbb, 0xa8, 0x96, 0xaa, 0xcb, 0xdd, 0xaa, 0x9c, 0x92,
-    0x9c, 0x8d, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x90, 0x90, 0x90, 0x90, 0x90, 0x92, 0x92,
-    0x90, 0x90, 0x90, 0x90, 0x92, 0x92, 0x96, 0x96, 0x96, 0x96, 0xcb, 0xaa,
-    0x96, 0x9c, 0x96, 0x96, 0x90, 0x90, 0x96, 0xbc, 0x96, 0x90, 0x90, 0x96,
-    0x90, 0x92, 0x92, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x89, 0x7d, 0x8c,
-    0x8c, 0x8c, 0x8c, 0x8c, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x01, 0x00, 0x00, 0x01, 0x03, 0x06,
-    0x03, 0x06, 0x13, 0xc3, 0xbc, 0xa5, 0x9a, 0x9a, 0x9a, 0x7f, 0x8d, 0x81,
-    0x81, 0x65, 0x09, 0x07, 0x13, 0x89, 0x91, 0x7e, 0x61, 0x91, 0x92, 0x8d,
-    0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x8d, 0x8d, 0x8d, 0x9a, 0x9a,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x7f, 0x7f, 0x7f, 0x7f, 0x8d, 0x81, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x8d, 0x92, 0x92, 0x92, 0x8d, 0x8d, 0x92, 0x92, 0x9c, 0xa5, 0x92, 0xa5,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x9c, 0xa5, 0xbb, 0x9c,
-    0x92, 0x96, 0x96, 0xaf, 0xd8, 0xdd, 0xaa, 0x9c, 0x9a, 0x9a, 0x92, 0x92,
-    0x92, 0x90, 0x90, 0x90, 0x9c, 0x92, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-    0x9c, 0x9c, 0x90, 0x96, 0x96, 0x96, 0xcb, 0x96, 0x96, 0x9c, 0x96, 0x96,
-    0x90, 0x90, 0x96, 0xbc, 0x96, 0x96, 0x96, 0x96, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x8c, 0x7d, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x06, 0x07, 0x5b,
-    0xbf, 0xaa, 0x9c, 0x9a, 0x9a, 0x7f, 0x8d, 0x92, 0x82, 0x7d, 0x09, 0x06,
-    0x07, 0x09, 0x61, 0x30, 0x09, 0x16, 0x7d, 0xa8, 0x9c, 0x92, 0x9c, 0x9c,
-    0x8d, 0x9a, 0x9a, 0x9a, 0x9a, 0x8d, 0x9a, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x9c,
-    0xa5, 0xa5, 0xbb, 0xbb, 0xa5, 0x92, 0x92, 0xbb, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x9c, 0xbb, 0xbb, 0xa5, 0x9c, 0x92, 0x92, 0x92, 0x90, 0x96, 0x96,
-    0xb2, 0xe6, 0xb9, 0x9c, 0x9a, 0x9a, 0x92, 0x92, 0x92, 0x90, 0x90, 0x90,
-    0x9c, 0x92, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x90,
-    0x90, 0x90, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x92, 0x9c, 0x96, 0xaa,
-    0x96, 0xcb, 0xcb, 0xaa, 0x96, 0x9c, 0x90, 0x90, 0x90, 0x90, 0x96, 0xb9,
-    0xb9, 0x96, 0x96, 0x96, 0x96, 0x90, 0x90, 0x9c, 0x90, 0x90, 0x90, 0x90,
-    0x90, 0x90, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x91, 0x7e, 0x91, 0x91, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x8c, 0x7d, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
-    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x03, 0x06, 0x06, 0x07, 0x13, 0x30, 0x61, 0x65,
-    0x76, 0x8d, 0x8d, 0x92, 0x7e, 0x16, 0x39, 0x07, 0x07, 0x09, 0x5b, 0x30,
-    0x07, 0x06, 0x20, 0x61, 0x98, 0x50, 0x61, 0x8c, 0x98, 0x9c, 0x92, 0x9a,
-    0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x8d, 0x92, 0x92, 0x8d, 0x7f, 0x7f, 0x7f,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x9c, 0xa5, 0xa5, 0xa5, 0x9c, 0x92, 0x92, 0x92,
-    0x90, 0x90, 0x90, 0x9c, 0xbb, 0xbb, 0x9c, 0x9c, 0xbb, 0xbb, 0x9c, 0x90,
-    0x90, 0x90, 0x90, 0x92, 0x92, 0x92, 0x9c, 0x96, 0xb2, 0xe6, 0xb9, 0xa5,
-    0x9c, 0x9a, 0x92, 0x92, 0x92, 0x92, 0x90, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x90, 0x96, 0x96, 0xa1, 0xd8, 0xa1, 0xaa,
-    0x96, 0x96, 0x92, 0x9c, 0x9c, 0x96, 0x96, 0x96, 0xbc, 0xaa, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x7e, 0x98, 0x98, 0x7e, 0x7e,
-    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01,
-    0x03, 0x06, 0x06, 0x06, 0x06, 0x07, 0x20, 0x16, 0x67, 0x8d, 0x9a, 0x90,
-    0x96, 0x61, 0x5b, 0x09, 0x07, 0x15, 0x09, 0x07, 0x03, 0x03, 0x07, 0x30,
-    0xa3, 0x65, 0x09, 0x20, 0x61, 0x65, 0x96, 0x90, 0x92, 0x9a, 0x9a, 0x9a,
-    0x9a, 0x9a, 0x92, 0x92, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x90, 0x9c, 0x90, 0x90,
-    0x9c, 0x9c, 0xbb, 0xbb, 0x9c, 0x9c, 0x9c, 0x90, 0x9c, 0x9c, 0x90, 0x9c,
-    0x8d, 0x92, 0x9c, 0x96, 0xb2, 0xe6, 0xaa, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x92, 0x92, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x90, 0xa8, 0x96, 0x96, 0xb2, 0xd8, 0x96, 0xaa, 0x96, 0x96, 0x9c, 0x9c,
-    0x9c, 0x96, 0x96, 0x96, 0xaa, 0xcb, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x7e, 0x98, 0x98, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
-    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x34,
-    0x06, 0x06, 0x09, 0x16, 0x96, 0x9a, 0x8d, 0x90, 0x96, 0x7e, 0x16, 0x20,
-    0x07, 0x09, 0x07, 0x06, 0x03, 0x03, 0x06, 0x20, 0xb7, 0x61, 0x07, 0x09,
-    0x09, 0x30, 0x8c, 0xa1, 0x96, 0x92, 0x9a, 0x9a, 0x9a, 0x9a, 0x92, 0x90,
-    0x90, 0x90, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x90, 0x90, 0x9c, 0x90, 0x9c, 0x90, 0x9c, 0x9c, 0x90, 0x9c, 0x9c, 0x9c,
-    0x90, 0x9c, 0x90, 0x9c, 0x90, 0x90, 0x9c, 0x90, 0x8d, 0x9c, 0x9c, 0xaa,
-    0xb2, 0xe6, 0xaa, 0xa5, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x96, 0xa8, 0x96, 0xaa,
-    0xd8, 0xb2, 0x96, 0x96, 0xaa, 0xa8, 0x9c, 0x92, 0x9c, 0x96, 0x96, 0x96,
-    0x96, 0xaf, 0xbc, 0xaa, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x8c,
-    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x01, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x03, 0x06, 0x09, 0x61,
-    0xa8, 0x9a, 0x67, 0x7e, 0x7e, 0x98, 0x89, 0x4f, 0x39, 0x4f, 0xa0, 0x06,
-    0x06, 0x06, 0x09, 0x5b, 0xa3, 0x8c, 0x09, 0x07, 0x07, 0x13, 0x20, 0x5b,
-    0x61, 0x96, 0x9c, 0x9a, 0x9a, 0x9a, 0x92, 0x9c, 0x90, 0x90, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x90, 0x9c, 0x9c, 0x9c, 0x9c, 0x90, 0x9c, 0x90, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x90, 0x9c, 0x92, 0x92, 0x9c, 0xaa, 0xb2, 0xe6, 0xaa, 0xa5,
-    0xa5, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x96, 0x96, 0x96, 0x96, 0xbc, 0xcb, 0x98, 0xaa, 0x96,
-    0x96, 0xa8, 0xa5, 0x9c, 0x9c, 0x96, 0x96, 0x96, 0x96, 0xa1, 0xcb, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x7d, 0x7d, 0x7d, 0x7d,
-    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
-    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x01, 0x01, 0x00, 0x02, 0x02, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x01, 0x01, 0x07, 0x09, 0x30, 0x91, 0xaf, 0x50, 0x16, 0x16,
-    0x61, 0xb5, 0xa7, 0x4f, 0x39, 0x32, 0x36, 0x07, 0x09, 0x39, 0x61, 0xb5,
-    0xb6, 0x30, 0x39, 0x4f, 0x07, 0x07, 0x06, 0x15, 0x09, 0x61, 0x96, 0x9a,
-    0x9a, 0x9a, 0x9a, 0x92, 0x9c, 0x92, 0x9a, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x90, 0x96, 0xa1, 0xb2, 0xe6, 0xcb, 0xa5, 0xa5, 0x9c, 0x9c, 0xa8,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0xa8, 0xa8, 0x96, 0x96, 0x9c, 0x9c, 0x9c, 0x9c, 0x96, 0x96, 0x96, 0x96,
-    0xaa, 0xa1, 0xa1, 0xcb, 0xbc, 0xaa, 0x96, 0xa8, 0x96, 0x96, 0x9c, 0x9c,
-    0xa8, 0xa8, 0x96, 0x96, 0x96, 0xaa, 0xaa, 0xcb, 0xcb, 0xbc, 0xaa, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x91, 0x91, 0x91,
-    0x91, 0xa1, 0xa1, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8c, 0x7d, 0x8c, 0x8c, 0x8c,
-    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x00, 0x00, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
-    0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03,
-    0x07, 0x39, 0x30, 0x65, 0xa1, 0x50, 0x30, 0x30, 0x2f, 0x16, 0x20, 0x07,
-    0x06, 0x03, 0x06, 0x07, 0x39, 0x5b, 0xc2, 0x9f, 0x30, 0x13, 0x09, 0x06,
-    0x06, 0x06, 0x03, 0x06, 0x09, 0x5b, 0x98, 0x92, 0x9a, 0x9a, 0x9a, 0x9a,
-    0x92, 0x92, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x9c, 0x92, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xaa, 0x96,
-    0xaf, 0xcb, 0xdd, 0xb9, 0xa5, 0xa5, 0x96, 0x96, 0x96, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa5, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa8, 0xa8, 0xa8, 0xa8,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x96, 0x96, 0xa8, 0xaa, 0x96, 0xaf, 0xcb, 0xcb,
-    0xaa, 0xaa, 0xa8, 0x96, 0xa8, 0x96, 0x96, 0xa8, 0xa8, 0xa8, 0x96, 0x96,
-    0x96, 0xaa, 0xaa, 0x96, 0xaa, 0xaf, 0xbc, 0xaa, 0x96, 0x96, 0xa1, 0xa1,
-    0x98, 0x98, 0xa1, 0x98, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
-    0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x02, 0x02, 0x08, 0x04,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x07, 0x30, 0x61,
-    0x7d, 0x2f, 0x91, 0x7d, 0x7e, 0x61, 0x13, 0x06, 0x03, 0x03, 0x06, 0x06,
-    0x06, 0x32, 0xb8, 0x20, 0x07, 0x06, 0x06, 0x03, 0x01, 0x01, 0x06, 0x06,
-    0x07, 0x5b, 0x98, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x90, 0x90,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x90, 0xa8, 0x96, 0xaa, 0xaa, 0xbc, 0xdd, 0xb9,
-    0xa8, 0xa8, 0xa8, 0x96, 0x96, 0x9c, 0x9c, 0x9a, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x9c,
-    0xa5, 0xa5, 0xa5, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0xa8, 0xaa, 0xa1, 0xb2, 0xdd, 0xaf, 0xaa, 0xaa, 0x96, 0xaa,
-    0xa8, 0xa8, 0x96, 0xa8, 0xa8, 0xa8, 0xaa, 0x96, 0xaa, 0x96, 0x96, 0xaa,
-    0xa1, 0x96, 0xbc, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xbc, 0xaf, 0xaf, 0xbc,
-    0xcb, 0xbc, 0xa1, 0x96, 0xa8, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98,
-    0x96, 0x98, 0xa2, 0x98, 0x98, 0x98, 0x98, 0x98, 0x96, 0x96, 0x96, 0x96,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8c, 0x8c,
-    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x02, 0x02, 0x02, 0x55, 0x01, 0x03, 0x01, 0x00, 0x00, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x03, 0x03, 0x06, 0x4f, 0x20, 0x5b, 0x30, 0xb5, 0xb6,
-    0x7d, 0x7a, 0x39, 0x03, 0x03, 0x03, 0x06, 0x4b, 0x03, 0x03, 0x07, 0x07,
-    0x07, 0x07, 0x03, 0x01, 0x01, 0x01, 0x06, 0x09, 0x07, 0x5b, 0x98, 0x8d,
-    0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x90, 0x9c, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x96, 0xa8, 0x9c, 0x96, 0xb9, 0xd8, 0xd8, 0xb2, 0xaa, 0xa8, 0xa8, 0xa8,
-    0xaa, 0x96, 0x9c, 0x9a, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xa8, 0xa8, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa8, 0xa8, 0xaa,
-    0xa1, 0xb2, 0xdd, 0xaf, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x96, 0x96, 0xa1, 0x96, 0xaa,
-    0xaa, 0xaa, 0xa8, 0xa8, 0xaf, 0xbc, 0xcb, 0xbc, 0xaf, 0xaf, 0xcb, 0x98,
-    0x98, 0xa1, 0x96, 0x98, 0x98, 0x98, 0xa2, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x96, 0x96, 0x96, 0x96, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
-    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x05, 0x08, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x02, 0x01,
-    0x01, 0x01, 0x03, 0x36, 0x11, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04,
-    0x34, 0x03, 0x06, 0x06, 0x07, 0x09, 0x39, 0x4f, 0x39, 0x07, 0x32, 0x06,
-    0x06, 0x06, 0x03, 0x03, 0x01, 0x03, 0x32, 0x07, 0x39, 0x32, 0x01, 0x00,
-    0x01, 0x03, 0x13, 0x30, 0x16, 0x61, 0x96, 0x92, 0x9a, 0x9a, 0x9a, 0x9a,
-    0x92, 0x92, 0x9a, 0x9a, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x9c, 0x9c, 0x9c, 0xa8, 0x9c, 0x9c, 0xa5,
-    0xaf, 0xe6, 0xd8, 0xb7, 0xaf, 0xa8, 0xa8, 0xa8, 0xaa, 0xa8, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0xa5, 0xa5, 0xa5, 0xa5, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa5, 0xa5, 0xa8, 0xa8, 0xaa, 0xaa, 0xa8, 0xa8,
-    0x9c, 0x9c, 0x9c, 0x9c, 0xa8, 0xa8, 0xa8, 0xaa, 0xaf, 0xb2, 0xd8, 0xaf,
-    0xaf, 0xa1, 0xaa, 0x96, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa,
-    0xaa, 0x96, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0x96, 0x96, 0xa8, 0x96, 0x96,
-    0xa8, 0xa8, 0xa1, 0xa1, 0x98, 0xa1, 0xc6, 0xaf, 0xa1, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0xa1, 0xb4, 0xa1, 0xa1, 0xa1, 0xa1, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
-    0x8c, 0x8c, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x95, 0x89, 0x89, 0x89, 0x04, 0x04, 0x04, 0x01,
-    0x01, 0x01, 0x01, 0x00, 0x02, 0x00, 0x02, 0x01, 0x01, 0x01, 0x03, 0x03,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x03,
-    0x03, 0x32, 0x06, 0x07, 0x07, 0x07, 0x09, 0x15, 0xa0, 0x06, 0x03, 0x01,
-    0x01, 0x03, 0x4b, 0x4f, 0x39, 0x06, 0x01, 0x00, 0x01, 0x03, 0x20, 0x9f,
-    0x61, 0x2f, 0x96, 0x92, 0x9c, 0x9a, 0x9c, 0x9c, 0x9c, 0x92, 0x9a, 0x9a,
-    0x9a, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa5, 0xa5, 0x9c, 0x9c, 0x9c, 0x9c, 0xa5, 0x9c, 0xaf, 0xd8, 0xd8, 0xc2,
-    0xb2, 0xaa, 0xa5, 0xa5, 0xaa, 0xa8, 0x9c, 0x9c, 0x9c, 0x9c, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa5, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa, 0xa8, 0xa8, 0x9c, 0x9c, 0x9c, 0x9c,
-    0xa8, 0xa8, 0xaa, 0xaa, 0xa1, 0xc6, 0xcb, 0xaf, 0xaf, 0xa1, 0xaa, 0xaa,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0x96, 0xa8, 0xa8, 0xa8, 0x96, 0xa8, 0x96, 0x96, 0x96, 0xa1, 0x98,
-    0xa1, 0x98, 0xaf, 0xd8, 0xa1, 0x98, 0x98, 0xa1, 0xa1, 0xa1, 0xa1, 0xc6,
-    0xe6, 0xa1, 0xa1, 0xa1, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8c, 0x8c, 0x8c, 0x8c,
-    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x01, 0x01, 0x01, 0x01, 0x02, 0x08, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x0c, 0x01, 0x01, 0x00, 0x00, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x03, 0x06, 0x06, 0x06,
-    0x13, 0x7a, 0x5b, 0x13, 0x06, 0x03, 0x01, 0x01, 0x01, 0x01, 0x03, 0x06,
-    0x07, 0x03, 0x01, 0x00, 0x00, 0x03, 0x09, 0x5b, 0xa3, 0x96, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9a, 0x9a, 0x9a, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa5,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa8, 0xa8, 0xa8, 0xa8, 0xa5, 0xa5, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0xa5, 0xaf, 0xc6, 0xed, 0xd8, 0xbf, 0xb9, 0xa5, 0xa5,
-    0xa8, 0xa8, 0x9c, 0x9c, 0x9c, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xa8, 0xa5, 0x9c, 0xa8, 0xa8, 0xaa, 0xaa,
-    0xaf, 0xd8, 0xb2, 0xaf, 0xa1, 0xaf, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0x96, 0xa8, 0xaa, 0xa8, 0x96, 0xa8,
-    0x96, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x96, 0xa1, 0xa1, 0x98, 0xa1, 0xbc,
-    0xbf, 0xa1, 0x98, 0xa1, 0x98, 0xa1, 0xa1, 0xa1, 0xc6, 0xe6, 0xb7, 0xa1,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0xa2, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
-    0x8c, 0x8c, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x01, 0x01, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01,
-    0x03, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x20, 0x89, 0xb8, 0x99,
-    0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x00,
-    0x01, 0x06, 0x09, 0x30, 0xb7, 0xaa, 0x9c, 0x9a, 0x9a, 0xa5, 0xa5, 0xa5,
-    0xa5, 0x9c, 0x9a, 0x9a, 0x9c, 0x9c, 0x9c, 0x92, 0x92, 0x92, 0x92, 0x92,
-    0x92, 0x92, 0x92, 0x92, 0x92, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa5, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa5, 0x9c,
-    0xaf, 0xbf, 0xe6, 0xe6, 0xd8, 0xbc, 0xaa, 0xaa, 0xaa, 0xa8, 0x9c, 0xa5,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xa8, 0xa8, 0xa5, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xb2, 0xe6, 0xb2, 0xaf,
-    0xaf, 0xa1, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaf, 0xaa, 0xaa, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xa8, 0xa1, 0x98, 0xa1, 0x98, 0x98, 0xd8, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xc6, 0xbf, 0xd8, 0xb7, 0xc6, 0xbf, 0xa1, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0xa2, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0xa1, 0xa1, 0xa1, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0xa1, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x95, 0x95, 0x89, 0x89, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x01, 0x34, 0x34, 0x04,
-    0x02, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02,
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x06, 0x06, 0x07, 0x39, 0x09,
-    0x09, 0x09, 0x06, 0x32, 0xb8, 0x39, 0x09, 0x39, 0x03, 0x03, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x4b, 0x39, 0x30,
-    0x7d, 0xaf, 0xa5, 0x9a, 0x9a, 0xa5, 0xa5, 0xa5, 0x9c, 0xa5, 0xa5, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0xa5, 0xa5, 0xa5, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xa8, 0xa8, 0x9c, 0xa5, 0x9c, 0xa5, 0xaa, 0xb7, 0xd8, 0xc6,
-    0xed, 0xc6, 0xbc, 0xb9, 0xaa, 0xaa, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xaa, 0xaa, 0xaa, 0xaf, 0xd8, 0xb2, 0xaf, 0xaf, 0xaf, 0xa1, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaa, 0xaa, 0xaf, 0xaf, 0xaf, 0xa1, 0xaf, 0xaf, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa2, 0xa1, 0xaf, 0xd8, 0xa1, 0xa1, 0xa1, 0xc6, 0xb7, 0xc6,
-    0xbf, 0xa1, 0xa1, 0xbf, 0xc6, 0xa1, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0x98, 0x98, 0xa1, 0xa1, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-    0x98, 0x98, 0xa1, 0xa1, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
-    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x01, 0x01, 0x04, 0x04, 0x05, 0x02, 0x05, 0x05,
-    0x05, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01,
-    0x01, 0x03, 0x06, 0x4f, 0x39, 0x13, 0x7a, 0x16, 0x99, 0x39, 0x06, 0x06,
-    0x39, 0x39, 0x39, 0x06, 0x06, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x06, 0x07, 0x07, 0x09, 0x30, 0xb7, 0xbb, 0xbb,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0x9c, 0x9c, 0xa5, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xa8, 0x9c, 0xa5, 0xaa, 0xaf, 0xd8, 0xc2, 0xe6, 0xc6, 0xbf, 0xbc,
-    0xb9, 0xaa, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xa8, 0xa8, 0xa8, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa, 0xaf, 0xaf, 0xb2,
-    0xd8, 0xb2, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaa, 0xaa,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaa, 0xaa, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa1, 0xa1, 0xa1, 0xa1, 0xaf, 0x98, 0xa2, 0xa2,
-    0xa1, 0xbf, 0xdd, 0xb4, 0xbf, 0xc6, 0xb4, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xbf, 0xc6, 0xa1, 0x98, 0xa1, 0x98, 0x98, 0x98, 0x98, 0x98, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x01, 0x34, 0x34, 0x01, 0x01, 0x04, 0x02, 0x05, 0x05, 0x0b, 0x05, 0x0b,
-    0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x34, 0x1e, 0x15, 0x4b, 0x23,
-    0x09, 0x4f, 0x30, 0x39, 0x09, 0x06, 0x03, 0x03, 0x4f, 0x99, 0x09, 0x07,
-    0x03, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x03,
-    0x06, 0x39, 0x20, 0x5b, 0x89, 0x7d, 0xbc, 0xbb, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa5, 0x9c, 0xa5, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa5, 0x9c, 0x9c, 0x9c,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xa8, 0xa5,
-    0xa5, 0xaa, 0xd8, 0xbf, 0xe6, 0xe6, 0xe6, 0xc6, 0xbc, 0xb9, 0xaa, 0xa8,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xa1, 0xaf, 0xd8, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xa1, 0xa1, 0xa8, 0xa8, 0xaf, 0xa1, 0xa1, 0xa1, 0xaf, 0xc6,
-    0xbf, 0xb4, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xc6, 0xb4, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0x98, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0x98, 0x98, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8c, 0x8c, 0x8c, 0x8c,
-    0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x89, 0x8c, 0x8c, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x02, 0x02, 0x04, 0x01,
-    0x01, 0x04, 0x04, 0x05, 0x05, 0x0d, 0x0b, 0x29, 0x0b, 0x02, 0x02, 0x02,
-    0x02, 0x00, 0x00, 0x01, 0x03, 0xa0, 0x4b, 0x06, 0x06, 0x39, 0x39, 0x99,
-    0x4f, 0x06, 0x03, 0x03, 0x99, 0x39, 0x4f, 0xd6, 0x36, 0x01, 0x00, 0x00,
-    0x01, 0x03, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x06, 0x32, 0x7a, 0x39,
-    0x09, 0x30, 0xc6, 0xb9, 0xb9, 0xb9, 0xb9, 0xaa, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa5, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xa8, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xa8, 0xa5, 0xa5, 0xaa, 0xcb, 0xbc,
-    0xc6, 0xe6, 0xe6, 0xe6, 0xc6, 0xb2, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf,
-    0xaf, 0xaf, 0xb2, 0xdd, 0xbc, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xa1,
-    0xa8, 0xaa, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xb4, 0xc6, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0x98, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
-    0x89, 0x89, 0x8c, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x02, 0x02, 0x08, 0x01, 0x01, 0x04, 0x02, 0x05,
-    0x05, 0x0b, 0x05, 0x1b, 0x0b, 0x05, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x06, 0x36, 0x03, 0x03,
-    0x36, 0x07, 0x99, 0xcd, 0x99, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x03, 0x06, 0x06, 0x09, 0xb5, 0xcb,
-    0x98, 0x98, 0xb9, 0xb9, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
-    0x9c, 0xa5, 0xa5, 0xa5, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xa8, 0x9c, 0xa5, 0xa8, 0xcb, 0xb2, 0xb7, 0xc6, 0xd8, 0xed,
-    0xd8, 0xbf, 0xaf, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaf, 0xaf, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xb2, 0xb2, 0xb7, 0xd8,
-    0xaf, 0xa1, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xa1, 0xaf, 0xaf,
-    0xaf, 0xa1, 0xa1, 0xa1, 0xaf, 0x98, 0xa1, 0xa1, 0x98, 0x98, 0xa2, 0xa1,
-    0xa1, 0xb4, 0xc6, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa3, 0xa3, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8c,
-    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x95, 0x95, 0x89, 0x89, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x0d,
-    0x0d, 0x05, 0x05, 0x05, 0x02, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x1e, 0x36, 0x06, 0x36, 0x06, 0x15, 0x39,
-    0x07, 0x06, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x02, 0x02, 0x01, 0x01, 0x36, 0x06, 0x5b, 0xc6, 0x65, 0xaf, 0xbc, 0xb9,
-    0xb9, 0xbb, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa5, 0xa5, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa5, 0x9c, 0x9c, 0x9c,
-    0xa5, 0xa5, 0xa5, 0x9c, 0x9c, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xaa,
-    0xaa, 0xcb, 0xcb, 0xaf, 0xb2, 0xb2, 0xbf, 0xd8, 0xed, 0xc6, 0xbc, 0xaf,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xaf, 0xaa, 0xaa,
-    0xaa, 0xaf, 0xaf, 0xaf, 0xb2, 0xb7, 0xbf, 0xd8, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xa1, 0xa1, 0xaf, 0xa1,
-    0xa1, 0xaf, 0xa1, 0xa1, 0xa1, 0xa1, 0xa2, 0xa1, 0xa1, 0xa1, 0xc6, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
-    0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x95, 0x95, 0x89, 0x89, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x08, 0x08, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x0a, 0x05,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01,
-    0x01, 0x03, 0x15, 0x4b, 0x01, 0x01, 0x03, 0x06, 0x09, 0x32, 0x4b, 0x01,
-    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x01, 0x01,
-    0x01, 0x06, 0x39, 0xcd, 0xa3, 0xaa, 0xb9, 0xa5, 0xaa, 0xaa, 0xb9, 0xa5,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa5, 0xa8, 0xcb, 0xbc, 0xd8, 0xaf,
-    0xaa, 0xb9, 0xb2, 0xc6, 0xd8, 0xe6, 0xd8, 0xc6, 0xbc, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb2,
-    0xb2, 0xb7, 0xbf, 0xd8, 0xaf, 0xaa, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xaf, 0xb2, 0xb2, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xa1, 0xaf, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xaf,
-    0xa1, 0xa1, 0xa2, 0xa1, 0xa1, 0xa1, 0xbf, 0xc6, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x91, 0x91,
-    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x9f, 0x8c,
-    0x91, 0x91, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x89,
-    0x8c, 0x8c, 0x89, 0x89, 0x89, 0x89, 0x95, 0x95, 0x89, 0x89, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x05, 0x05, 0x0a, 0x0a, 0x05, 0x02, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03,
-    0x01, 0x01, 0x01, 0x03, 0x23, 0x4f, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x03, 0x07, 0x4f,
-    0xb5, 0xbc, 0xbc, 0x96, 0xb9, 0xb9, 0xb9, 0xbb, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa8, 0xa8,
-    0x9c, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa8,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xa5, 0xaa, 0xcb, 0xb7, 0xb2, 0xbc, 0xbc, 0xb9, 0xbc, 0xbf,
-    0xd8, 0xe6, 0xb7, 0xbc, 0xbc, 0xb9, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb2, 0xb2, 0xb7, 0xb7, 0xd8,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xbc, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xa1, 0xa1, 0xa1, 0xa1, 0xaf, 0xa1, 0xaf, 0xaf, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xd8, 0xb7, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0x91, 0x91, 0x91, 0x91, 0x91, 0x9f, 0x9f, 0x91, 0x8c, 0x8c, 0x8c,
-    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x89,
-    0x89, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x0a, 0x0a, 0x0d, 0x0a, 0x05, 0x05, 0x02, 0x00, 0x00, 0x00, 0x02,
-    0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x03,
-    0x06, 0x4b, 0x06, 0x01, 0x01, 0x01, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x02, 0x02, 0x04, 0x03, 0x07, 0x13, 0x5b, 0x8c, 0xbf, 0xbf,
-    0xbc, 0xbc, 0xb9, 0xb9, 0xb9, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xa5, 0xa5, 0x9a, 0xa5, 0xa8, 0xaa, 0xaa, 0xa8, 0xa5, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xaa,
-    0xd8, 0xb2, 0xb2, 0xaf, 0xb2, 0xcb, 0xb2, 0xb2, 0xe6, 0xd8, 0xb7, 0xb2,
-    0xbc, 0xbc, 0xaf, 0xcb, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaa, 0xaa, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xb2, 0xb7, 0xb7, 0xd8, 0xb2, 0xb2, 0xaf, 0xaf,
-    0xaf, 0xb2, 0xbc, 0xb2, 0xbf, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xb4, 0xb7,
-    0xc6, 0xa3, 0xa1, 0xa1, 0xa1, 0xa1, 0xa2, 0xa2, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0x9f, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x8c, 0x8c, 0x9f, 0x8c, 0x8c, 0x8c, 0x8c,
-    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x89, 0x89, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x08, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0a, 0x0d, 0x0d,
-    0x0e, 0x0e, 0x0b, 0x14, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x72, 0x03, 0x03,
-    0x01, 0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0x34, 0x01, 0x01, 0x08, 0x02,
-    0x36, 0x0c, 0x03, 0x32, 0x4f, 0x5b, 0x5b, 0x30, 0xbf, 0xbf, 0xcb, 0xbc,
-    0xbc, 0xb9, 0xbb, 0xbb, 0xb9, 0xb9, 0xb9, 0xaa, 0xaa, 0xaa, 0xa5, 0x9a,
-    0xa5, 0xa8, 0xa8, 0xa8, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa8,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xc6, 0xbf, 0xaf, 0xaf,
-    0xb2, 0xb2, 0xcb, 0xc6, 0xe6, 0xd8, 0xbc, 0xaf, 0xaf, 0xbc, 0xcb, 0xcb,
-    0xb2, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb2,
-    0xb2, 0xb7, 0xb7, 0xd8, 0xb2, 0xb2, 0xaf, 0xaf, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xb2, 0xb2, 0xaf, 0xaf, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xbf, 0xc6, 0xa3, 0xa3, 0xa3,
-    0xa1, 0xa1, 0xa2, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0x9f, 0x9f, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x8c, 0x8c, 0x9f, 0x8c, 0x8c, 0x8c,
-    0x8c, 0x89, 0x89, 0x89, 0x89, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x08, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0a, 0x0d, 0x0e, 0x0e, 0x2b, 0x42,
-    0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x03, 0x06, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00,
-    0x02, 0x01, 0x01, 0x01, 0x0c, 0x01, 0x01, 0x04, 0x04, 0x01, 0x04, 0x1e,
-    0x32, 0x72, 0x4f, 0x09, 0x89, 0xa3, 0xc6, 0xc6, 0xc6, 0xbc, 0xcb, 0xb9,
-    0xb9, 0xb9, 0xa5, 0xb9, 0xb9, 0xb9, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xaf, 0xa8, 0xa8,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaf, 0xa1, 0xaa, 0xcb, 0xc6, 0xdd, 0xdd, 0xcb, 0xaa, 0xaf, 0xb2, 0xbf,
-    0xe6, 0xd8, 0xc6, 0xcb, 0xbc, 0xcb, 0xcb, 0xcb, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xbc, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb2, 0xb2, 0xb7, 0xbf, 0xd8,
-    0xb2, 0xaf, 0xaf, 0xaf, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xaf, 0xa1, 0xa1, 0xb4, 0xd8, 0xbf, 0xa3, 0xa3, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0x9f, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x95, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02,
-    0x05, 0x05, 0x0d, 0x0d, 0x0e, 0x0a, 0x0a, 0x0a, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x36, 0x36, 0x06, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x04, 0x01,
-    0x01, 0x01, 0x01, 0x04, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x03, 0x06,
-    0x39, 0x5b, 0xc3, 0xb6, 0xd8, 0xc6, 0xc6, 0xcb, 0xbc, 0xb9, 0xbb, 0xb9,
-    0xb9, 0xb9, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa5, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xbc, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xb2, 0xaf, 0xaa, 0xcb,
-    0xaf, 0xb2, 0xbc, 0xb9, 0xcb, 0xbc, 0xb2, 0xbf, 0xe6, 0xc2, 0xbc, 0xbc,
-    0xbc, 0xaf, 0xaf, 0xaf, 0xbc, 0xcb, 0xcb, 0xcb, 0xbc, 0xbc, 0xcb, 0xbc,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xbc,
-    0xaf, 0xaf, 0xaf, 0xb2, 0xb7, 0xbf, 0xd8, 0xbf, 0xb2, 0xaf, 0xaf, 0xaf,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xb5, 0xd8, 0xa3, 0xa3, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0x9f, 0x9f, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x95,
-    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x95, 0x95, 0x89, 0x89, 0x89, 0x95,
-    0x95, 0x95, 0x89, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x99,
-    0x99, 0x99, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x05, 0x0a, 0x0d, 0x0a,
-    0x1c, 0x0a, 0x05, 0x05, 0x05, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x04, 0x01, 0x00, 0x02, 0x02, 0x19,
-    0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x06, 0x07, 0x39, 0x39,
-    0x20, 0x7a, 0xc3, 0xc6, 0xc6, 0xcb, 0xbc, 0xbc, 0xbc, 0xb9, 0xa5, 0xa5,
-    0xa5, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa,
-    0xaa, 0xbc, 0xb9, 0xaa, 0xaa, 0xaa, 0xb9, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaf, 0xaf, 0xaf, 0xaf, 0xcb, 0xaa, 0xb2, 0xaf, 0xaa, 0xaa,
-    0xb9, 0xcb, 0xb2, 0xc6, 0xe6, 0xc2, 0xb2, 0xbc, 0xbc, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xbc, 0xcb, 0xcb, 0xbc, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xbc, 0xaf, 0xaf, 0xaf, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xd8, 0xd8, 0xbf, 0xb7, 0xb2, 0xaf, 0xaf, 0xaf, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xb4, 0xa1, 0xa1, 0xa1, 0xb5, 0xc6, 0xc2, 0xa3,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x95, 0x95, 0x95, 0x95,
-    0xa7, 0xa7, 0x95, 0xa7, 0x95, 0x95, 0x95, 0x95, 0xa7, 0x95, 0xa7, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x99, 0x95, 0x95, 0x99,
-    0xb8, 0x95, 0xb8, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x05, 0x0a, 0x0d, 0x0a, 0x0a, 0x0f, 0x19, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x08, 0x41, 0x36, 0x01, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x06, 0x06, 0x07, 0x09, 0x13, 0x5b,
-    0x5b, 0xb6, 0xc2, 0xbf, 0xbf, 0xbc, 0xa5, 0xa5, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xbc, 0xbc, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xbc,
-    0xcb, 0xcb, 0xaa, 0xaa, 0xaf, 0xb2, 0xaa, 0xaa, 0xb9, 0xcb, 0xb7, 0xd8,
-    0xe6, 0xc2, 0xbc, 0xbc, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xb2, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb2, 0xc6, 0xb2, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xbc, 0xaf, 0xb2, 0xb2, 0xb2, 0xd8, 0xc6, 0xbf, 0xb7, 0xb7,
-    0xb2, 0xaf, 0xaf, 0xaf, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xb4, 0xb5, 0xb5, 0xd8, 0xb5, 0xb4, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0xb8, 0xb8, 0x99, 0x99, 0xb8, 0xb8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02,
-    0x05, 0x0a, 0x0e, 0x0e, 0x05, 0x27, 0x08, 0x02, 0x02, 0x08, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x06, 0x06, 0x09, 0x7a, 0x30,
-    0xbf, 0xbc, 0xb9, 0xaa, 0xaa, 0xaa, 0xa8, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa, 0xa8, 0xa8,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xa8, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbc, 0xbc, 0xaa, 0xaa, 0xaf, 0xaa,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xcb, 0xcb, 0xcb, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xb9, 0xaf, 0xbc, 0xc6, 0xc2, 0xe6, 0xd8, 0xc2, 0xbc, 0xaa,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xc6, 0xc6, 0xb2, 0xb2, 0xb2, 0xaf, 0xb2,
-    0xb2, 0xb7, 0xbf, 0xd8, 0xb7, 0xbf, 0xb4, 0xb7, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xaf, 0xbc, 0xbc, 0xbc, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xb7, 0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa1, 0xa1,
-    0xa1, 0xb5, 0xc6, 0xd8, 0xc6, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x95, 0x95, 0x95, 0x95, 0x95,
-    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0xa7,
-    0xb8, 0x95, 0xb8, 0xb8, 0x4f, 0x15, 0x32, 0x99, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x05, 0x0a, 0x0d, 0x0e,
-    0x0d, 0x0b, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x04,
-    0x02, 0x02, 0x02, 0x19, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x09, 0x30, 0x89, 0x91, 0xbc, 0xb9,
-    0xaa, 0xaa, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa5, 0xa5, 0xa5,
-    0xa5, 0xa5, 0xa8, 0xa8, 0xaa, 0xaa, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xb9, 0xaa, 0xbc, 0xbc, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xcb, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb2,
-    0xbf, 0xc6, 0xe6, 0xe6, 0xbf, 0xbf, 0xbc, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xbc, 0xaf, 0xaf, 0xaf, 0xbc, 0xaf, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb7, 0xb7, 0xbf, 0xc6, 0xbf, 0xb2, 0xb2, 0xb2, 0xb7, 0xb7, 0xc6, 0xc6,
-    0xbf, 0xb7, 0xb7, 0xb7, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xa1, 0xa1, 0xa1, 0xa1, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xd8, 0xb4, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0x95, 0x95, 0x95, 0x95, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xb8, 0xb8, 0x99, 0x99, 0x4f,
-    0x07, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x0a, 0x0a, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x08, 0x08, 0x05, 0x05,
-    0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x06, 0x03, 0x03, 0x01,
-    0x01, 0x01, 0x01, 0x06, 0x07, 0x20, 0xbf, 0xbc, 0xa5, 0xa5, 0x9c, 0x92,
-    0x9c, 0x9c, 0x90, 0x9c, 0x9c, 0x9c, 0xa5, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xaf, 0xaf, 0xcb,
-    0xcb, 0xbc, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xcb, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaa, 0xaa, 0xaa, 0xb2, 0xb7, 0xc2, 0xd8, 0xed, 0xe6, 0xc2,
-    0xbf, 0xaf, 0xbc, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb7, 0xb7, 0xb2, 0xbf,
-    0xbc, 0xcb, 0xc6, 0xc6, 0xbf, 0xb7, 0xb7, 0xd8, 0xbf, 0xbf, 0xb7, 0xb4,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xaf, 0xbc, 0xbc, 0xbc, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb4,
-    0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb7, 0xb7, 0xb4, 0xb4, 0xb5, 0xb5, 0xb5, 0xb5, 0xd8, 0xbf, 0xa3, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0x95, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xb8, 0xb8, 0xa7, 0xa7,
-    0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0x4f, 0x32, 0x1a, 0x1a, 0x03, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x08,
-    0x05, 0x19, 0x1c, 0x0d, 0x14, 0x0b, 0x08, 0x02, 0x08, 0x02, 0x02, 0x02,
-    0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x01, 0x08, 0x02, 0x02, 0x08, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04,
-    0x04, 0x02, 0x02, 0x02, 0x03, 0x72, 0x06, 0x01, 0x02, 0x00, 0x01, 0x01,
-    0x06, 0x39, 0xc2, 0xbc, 0xb9, 0xa5, 0xa5, 0x9c, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xa8, 0x96, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xbc, 0xbc, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xcb, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaa, 0xaa,
-    0xb9, 0xb2, 0xc2, 0xe6, 0xed, 0xc6, 0xc2, 0xbf, 0xbc, 0xbc, 0xaf, 0xbc,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb7, 0xb7, 0xb7, 0xb2, 0xb2, 0xaf, 0xaf, 0xb2, 0xb7,
-    0xbf, 0xc6, 0xb7, 0xbf, 0xd8, 0xbf, 0xb4, 0xb7, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xaf, 0xaf, 0xbc, 0xbc, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb7, 0xb7, 0xb4, 0xb4,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xd8, 0xb5, 0xb5, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xb8, 0xa7, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0x99, 0x99,
-    0x4f, 0x15, 0x06, 0x03, 0x01, 0x04, 0x01, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x0a, 0x0d,
-    0x0d, 0x0d, 0x0d, 0x17, 0x0d, 0x05, 0x05, 0x08, 0x05, 0x08, 0x02, 0x02,
-    0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02,
-    0x02, 0x02, 0x0b, 0x0b, 0x0b, 0x14, 0x05, 0x05, 0x04, 0x04, 0x02, 0x04,
-    0x01, 0x36, 0x1e, 0x01, 0x01, 0x01, 0x01, 0x03, 0x06, 0x39, 0xc3, 0xbf,
-    0xbc, 0xa8, 0xa8, 0xa8, 0x96, 0xa8, 0x96, 0x96, 0xa8, 0xa8, 0xa8, 0xa8,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xbc, 0xcb, 0xaf, 0xaf, 0xb2, 0xb2,
-    0xcb, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xa8, 0xaa, 0xaa, 0xbf, 0xd8, 0xed,
-    0xc2, 0xc2, 0xbf, 0xb2, 0xaf, 0xbc, 0xb9, 0xaa, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xbc, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xaf, 0xb7,
-    0xb7, 0xb7, 0xb2, 0xb2, 0xaf, 0xaf, 0xb2, 0xb7, 0xb7, 0xb7, 0xc6, 0xbf,
-    0xd8, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb5, 0xb5,
-    0xb5, 0xd8, 0xbf, 0xb5, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
-    0x99, 0x4f, 0x99, 0x99, 0x99, 0x4f, 0x06, 0x06, 0x1e, 0x0c, 0x03, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x0d, 0x0e, 0x17, 0x17,
-    0x28, 0x0d, 0x05, 0x05, 0x02, 0x05, 0x02, 0x02, 0x04, 0x02, 0x01, 0x01,
-    0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0b, 0x0b,
-    0x18, 0x14, 0x08, 0x02, 0x05, 0x05, 0x04, 0x05, 0x01, 0x01, 0x01, 0x03,
-    0x01, 0x01, 0x01, 0x03, 0x06, 0x07, 0x89, 0xc6, 0xc6, 0xbc, 0xaf, 0xaf,
-    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xcb, 0xaf, 0xbc, 0xb2, 0xb2, 0xcb, 0xbc, 0xaf, 0xaf,
-    0xb2, 0xb2, 0xb9, 0xaa, 0xbc, 0xbf, 0xd8, 0xe6, 0xc2, 0xb7, 0xb2, 0xbc,
-    0xaf, 0xaf, 0xbc, 0xbc, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xbc, 0xbc, 0xbc,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xaf, 0xaf, 0xb7, 0xb7, 0xb2, 0xb2,
-    0xaf, 0xaf, 0xb2, 0xb7, 0xb7, 0xb7, 0xc6, 0xbf, 0xd8, 0xb7, 0xbf, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb5, 0xb5, 0xb5, 0xd8, 0xbf, 0xb5,
-    0xb5, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xb6,
-    0xa7, 0xb8, 0xb8, 0xb8, 0x7a, 0x7a, 0x4f, 0x23, 0x1a, 0x1a, 0x06, 0x0c,
-    0x0c, 0x0c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
-    0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x0a, 0x0e, 0x0e, 0x1c, 0x19, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x08, 0x02, 0x02, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x02,
-    0x11, 0x11, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x0b, 0x08, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x08, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01,
-    0x01, 0x06, 0x99, 0xd8, 0xd8, 0xc6, 0xbc, 0xbc, 0xb9, 0xb9, 0xa8, 0xa8,
-    0xa5, 0xa5, 0xa5, 0xa5, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xb9, 0xb9, 0xaf, 0xaf, 0xb9, 0xb9, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xbc,
-    0xcb, 0xcb, 0xcb, 0xcb, 0xbc, 0xbc, 0xaf, 0xb2, 0xb2, 0xb2, 0xaa, 0xaf,
-    0xb2, 0xc2, 0xe6, 0xd8, 0xbf, 0xbc, 0xbc, 0xaf, 0xaf, 0xbc, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xbc, 0xbc,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xb7, 0xb7, 0xb2, 0xaf, 0xaf, 0xaf, 0xb2, 0xb7,
-    0xb7, 0xb7, 0xc6, 0xe6, 0xc6, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb5, 0xb5, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb5, 0xb5, 0xb5, 0xd8, 0xc2, 0xb5, 0xb5, 0xa1, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xa1, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xb6, 0xa7, 0xb6, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0x4f,
-    0x06, 0x06, 0x06, 0x03, 0x06, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
-    0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x05, 0x05, 0x0a, 0x05, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x08, 0x08, 0x02, 0x02, 0x00, 0x02, 0x02, 0x01, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x05, 0x08, 0x14, 0x11, 0x02, 0x02,
-    0x02, 0x02, 0x05, 0x05, 0x0b, 0x02, 0x02, 0x05, 0x05, 0x0b, 0x05, 0x05,
-    0x08, 0x02, 0x02, 0x01, 0x02, 0x02, 0x00, 0x02, 0x00, 0x03, 0x15, 0x7a,
-    0x7a, 0xb6, 0xd8, 0xc2, 0xbf, 0xbf, 0xbf, 0xbf, 0xbc, 0xbc, 0xbc, 0xaf,
-    0xbc, 0xb9, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xb9, 0xb9, 0xaf, 0xaf,
-    0xbc, 0xb9, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xbc, 0xcb, 0xaf, 0xaf,
-    0xaf, 0xbc, 0xaf, 0xb2, 0xb2, 0xb2, 0xbc, 0xb2, 0xbf, 0xc6, 0xed, 0xd8,
-    0xb7, 0xbc, 0xaf, 0xaf, 0xaf, 0xbc, 0xb2, 0xb7, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xbc, 0xbc, 0xbc, 0xbc, 0xaf, 0xaf,
-    0xb7, 0xb7, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb7, 0xb7, 0xb5, 0xd8, 0xc2,
-    0xc6, 0xc6, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb7, 0xb7, 0xb7, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb5, 0xb5, 0xb4, 0xb4, 0xb4, 0xb4, 0xb5, 0xb5,
-    0xb5, 0xd8, 0xc3, 0xb5, 0xb5, 0xb5, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xb8, 0xb8, 0xb8, 0xb8,
-    0xb8, 0xb8, 0xb8, 0xb8, 0xcd, 0xb8, 0x32, 0x15, 0x0c, 0x03, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08,
-    0x02, 0x05, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
-    0x08, 0x05, 0x05, 0x05, 0x14, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05,
-    0x11, 0x08, 0x05, 0x05, 0x05, 0x0b, 0x0a, 0x05, 0x02, 0x08, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x01, 0x00, 0x01, 0x03, 0x06, 0x06, 0x39, 0x7a, 0x7a,
-    0x7a, 0xb8, 0x20, 0x30, 0x89, 0xb6, 0xc2, 0xc2, 0xbf, 0xbf, 0xbc, 0xb9,
-    0xb9, 0xb9, 0xa5, 0xa8, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xaf, 0xaf, 0xaf, 0xaa, 0xbc, 0xbc, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xbc, 0xbc, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xbc, 0xb2,
-    0xbc, 0xb7, 0xbf, 0xbf, 0xc6, 0xe6, 0xe6, 0xc2, 0xbc, 0xb9, 0xaf, 0xbc,
-    0xbc, 0xb2, 0xb7, 0xbf, 0xb7, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xb7, 0xb7, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xb4, 0xb7, 0xb5, 0xd8, 0xc2, 0xbf, 0xbf, 0xc6, 0xbf,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb5, 0xb5, 0xb4, 0xb4, 0xb4, 0xb4, 0xb5, 0xb5, 0xb5, 0xe6, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xa1, 0xb4, 0xa1, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xb6, 0xb8, 0x99, 0x7a, 0x4f, 0x7a, 0xb8, 0xb8, 0xcd, 0xb8,
-    0x99, 0x15, 0x06, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x08, 0x02, 0x02,
-    0x02, 0x02, 0x08, 0x02, 0x08, 0x05, 0x05, 0x02, 0x02, 0x00, 0x02, 0x02,
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05,
-    0x05, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x08, 0x08, 0x02, 0x02, 0x00, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x06, 0x06, 0x07, 0x07, 0x06, 0x07, 0x07,
-    0x07, 0x09, 0x4f, 0x99, 0xc3, 0xc3, 0xc2, 0xbf, 0xbc, 0xbc, 0xb9, 0xb9,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xb9, 0xaf, 0xbc, 0xaa, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xbc, 0xb2, 0xbf, 0xc2, 0xc6, 0xe6,
-    0xed, 0xd8, 0xbf, 0xbf, 0xbc, 0xbc, 0xbc, 0xaf, 0xb2, 0xb2, 0xbf, 0xb7,
-    0xb7, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xbc, 0xbc, 0xbc, 0xbc,
-    0xbc, 0xbc, 0xaf, 0xaf, 0xb7, 0xb7, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb4,
-    0xb7, 0xb7, 0xd8, 0xb5, 0xb5, 0xbf, 0xb7, 0xc6, 0xbf, 0xbf, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb5, 0xb5, 0xb4, 0xb4,
-    0xb4, 0xb5, 0xb5, 0xb5, 0xb5, 0xd8, 0xb6, 0xb5, 0xb5, 0xb5, 0xa1, 0xa1,
-    0xa1, 0xa1, 0xb5, 0xa3, 0xa3, 0xa3, 0xa3, 0xb5, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa7, 0xa7, 0xa7, 0x20,
-    0x07, 0x07, 0x07, 0x15, 0x07, 0x4f, 0x4f, 0x06, 0x06, 0x06, 0x03, 0x01,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02, 0x08, 0x02, 0x02, 0x02,
-    0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x0a, 0x05, 0x02, 0x08,
-    0x08, 0x05, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x03, 0x06, 0x06, 0x03, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07,
-    0x07, 0x13, 0x7a, 0xa7, 0xc2, 0xc6, 0xbc, 0xbc, 0xbc, 0xbc, 0xaa, 0xb9,
-    0xa8, 0xa8, 0xaa, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xb9, 0xb9,
-    0xa8, 0xbc, 0xaf, 0xb2, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xbc, 0xaf,
-    0xbc, 0xaf, 0xbc, 0xbf, 0xc2, 0xe6, 0xed, 0xed, 0xc6, 0xbf, 0xbc, 0xbc,
-    0xb9, 0xb9, 0xb2, 0xb7, 0xb7, 0xb7, 0xbc, 0xbc, 0xb2, 0xb2, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xbc, 0xbc, 0xbc, 0xaf, 0xbc, 0xbc, 0xaf, 0xaf,
-    0xb7, 0xb7, 0xb4, 0xaf, 0xaf, 0xaf, 0xaf, 0xb4, 0xb7, 0xbf, 0xd8, 0xb5,
-    0xb5, 0xb5, 0xb7, 0xb7, 0xb7, 0xc6, 0xbf, 0xb7, 0xb7, 0xbf, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb5, 0xb5, 0xb5, 0xb4, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xa3, 0xbf, 0xe6, 0xb5, 0xb6, 0xb6, 0xa3, 0xa3, 0xa3, 0xb5, 0xb5, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0x9f, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa7, 0x95,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa7, 0xb8, 0x4f, 0x07, 0x06, 0x06, 0x03,
-    0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
-    0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x19, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x19, 0x05, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x05, 0x05, 0x0a, 0x05, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03,
-    0x03, 0x03, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x09,
-    0x16, 0xa7, 0xd8, 0xc6, 0xc2, 0xbf, 0xbf, 0xbc, 0xaf, 0xbc, 0xaf, 0xaf,
-    0xaf, 0xaf, 0xaf, 0xaf, 0xbc, 0xaa, 0xb9, 0xaa, 0xaf, 0xaf, 0xbc, 0xaf,
-    0xaf, 0xbc, 0xaf, 0xaf, 0xb9, 0xbc, 0xaf, 0xbc, 0xb2, 0xbf, 0xbf, 0xc6,
-    0xe6, 0xe6, 0xc2, 0xc2, 0xbf, 0xaf, 0xbc, 0xb9, 0xb9, 0xbc, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xbc, 0xbc, 0xb2, 0xb7, 0xb2, 0xb7, 0xb2, 0xb7, 0xb2, 0xb2,
-    0xb2, 0xb2, 0xbc, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xaf, 0xaf, 0xb4, 0xb7, 0xb7, 0xb7, 0xc6, 0xc6, 0xbf, 0xb5, 0xb5, 0xb5,
-    0xb7, 0xb7, 0xbf, 0xbf, 0xb7, 0xb7, 0xbf, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb4, 0xb7, 0xb4, 0xb7, 0xb4, 0xb7, 0xb4, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb5, 0xb7, 0xb5, 0xb7, 0xb7, 0xb7, 0xb4, 0xb4, 0xb5,
-    0xb5, 0xb5, 0xb4, 0xb4, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xa3, 0xd8, 0xe6,
-    0xb6, 0xb6, 0xb5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x8c, 0x8c, 0x89, 0x89, 0x9f, 0x9f, 0x9f, 0x9f,
-    0xa7, 0xb8, 0x99, 0x15, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02,
-    0x01, 0x01, 0x00, 0x00, 0x02, 0x08, 0x00, 0x02, 0x02, 0x08, 0x02, 0x02,
-    0x02, 0x08, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05,
-    0x0a, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x03, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x4f, 0x4f,
-    0x89, 0x8c, 0xc2, 0xc6, 0xbf, 0xbc, 0xbc, 0xbc, 0xbc, 0xaf, 0xaf, 0xaf,
-    0xaa, 0xaf, 0xaf, 0xbc, 0xaf, 0xbc, 0xaf, 0xbc, 0xb9, 0xaf, 0xaa, 0xb9,
-    0xb9, 0xa8, 0xbc, 0xbc, 0xb7, 0xc2, 0xcd, 0xed, 0xe6, 0xc6, 0xbf, 0xbf,
-    0xbc, 0xbc, 0xb2, 0xb2, 0xb7, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbc, 0xbc,
-    0xbf, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xbf, 0xb7, 0xb7, 0xb7,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xaf, 0xaf, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb5, 0xd8, 0xc6, 0xb5, 0xb5, 0xb5, 0xb4, 0xb4, 0xb4, 0xbf,
-    0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb7, 0xb7, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb7, 0xb5, 0xb7, 0xb5, 0xb7, 0xb5, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb4, 0xb4,
-    0xb4, 0xb5, 0xb5, 0xb5, 0xb5, 0xa3, 0xb5, 0xb6, 0xe6, 0xb6, 0xb5, 0xb5,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x9f, 0x9f, 0x95, 0x89,
-    0x89, 0x89, 0x89, 0x89, 0x8c, 0xa7, 0xa7, 0xa7, 0x99, 0x4f, 0x06, 0x03,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x0b,
-    0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00,
-    0x02, 0x08, 0x02, 0x00, 0x02, 0x08, 0x02, 0x00, 0x02, 0x08, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x02, 0x01,
-    0x01, 0x03, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x03, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x09, 0x09, 0x16, 0x5b,
-    0xb6, 0xc6, 0xc2, 0x7d, 0xa1, 0xbc, 0xbc, 0xbc, 0xbc, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xb7, 0xb7, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc,
-    0xc2, 0xc3, 0xed, 0xed, 0xc6, 0xbf, 0xbc, 0xbc, 0xbc, 0xaf, 0xbf, 0xb7,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xbc, 0xbc, 0xbf, 0xbf, 0xbf, 0xbf, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xbf, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xaf, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb5, 0xb5,
-    0xd8, 0xb5, 0xb5, 0xb5, 0xb7, 0xb7, 0xb4, 0xb7, 0xbf, 0xb7, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb4, 0xb4, 0xb4, 0xb4, 0xb5, 0xb5, 0xb5,
-    0xa3, 0xb5, 0xb5, 0xb6, 0xc2, 0xe6, 0x9f, 0xb5, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0x9f, 0x9f, 0x9f, 0x89, 0x89, 0x89, 0x89, 0x89, 0x9f,
-    0xa7, 0xa7, 0xa7, 0xb8, 0x39, 0x06, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x19, 0x02, 0x02, 0x02, 0x08, 0x05, 0x05, 0x19, 0x05, 0x08,
-    0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x0b, 0x05, 0x05, 0x05, 0x05,
-    0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x08, 0x02, 0x00,
-    0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x04, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x08, 0x05, 0x08,
-    0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0x03, 0x03, 0x06,
-    0x03, 0x03, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x03, 0x06, 0x06, 0x06, 0x07, 0x09, 0x5b, 0xb8, 0xcd, 0x30,
-    0x61, 0xc2, 0xc6, 0xc6, 0xc6, 0xc6, 0xc2, 0xc2, 0x95, 0x89, 0xb6, 0xc2,
-    0xb7, 0xbf, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbf, 0xc2, 0xd8, 0xed, 0xd8,
-    0xc2, 0xbf, 0xbf, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xbc, 0xbc, 0xbc, 0xbf, 0xbf, 0xbf, 0xbf, 0xb7, 0xb7, 0xb7, 0xb4, 0xb4,
-    0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb7, 0xb7, 0xb4, 0xb4,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb5, 0xb5, 0xd8, 0xb5, 0xb5, 0xb5,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xbf, 0xbf, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb7, 0xb7, 0xb7, 0xb5, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb4, 0xb4, 0xb4, 0xb4, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0x9f,
-    0xb6, 0xd8, 0xd8, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x8c, 0x8c,
-    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x9f, 0x9f, 0x9f, 0xa7, 0xb8, 0xb8,
-    0x32, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x41, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x08,
-    0x08, 0x02, 0x02, 0x02, 0x08, 0x08, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x02, 0x02,
-    0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05,
-    0x05, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x03, 0x0c, 0x0c, 0x0c, 0x0c, 0x06,
-    0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x03,
-    0x03, 0x03, 0x06, 0x06, 0x09, 0x13, 0x4f, 0x20, 0x16, 0xc3, 0xd8, 0xd8,
-    0xd8, 0xcd, 0xc3, 0x20, 0x07, 0x07, 0x09, 0x20, 0x89, 0xc2, 0xc2, 0xc6,
-    0xc6, 0xc2, 0xc2, 0xd8, 0xe6, 0xed, 0xd8, 0xc3, 0xc2, 0xc2, 0xc2, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xb4, 0xb4, 0xb7, 0xb7, 0xb7, 0xb4,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xb7, 0xb7, 0xb4, 0xb4, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb5, 0xb5, 0xb5, 0xd8, 0xb5, 0xb5, 0xb5, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xa3, 0xa3, 0xb5, 0xb6, 0xd8, 0xc2, 0xb6,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xb5, 0xb5, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0xa3, 0x91, 0x91, 0x91, 0x9f, 0x9f, 0x8c, 0x8c, 0x8c,
-    0x9f, 0x9f, 0xa3, 0x9f, 0xb6, 0xa7, 0x7a, 0x07, 0x06, 0x01, 0x02, 0x00,
-    0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x27, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x02, 0x02, 0x08, 0x02,
-    0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x11, 0x02, 0x02, 0x02, 0x05, 0x0a, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
-    0x01, 0x04, 0x0c, 0x1e, 0x1c, 0x0a, 0x0f, 0x0c, 0x06, 0x06, 0x07, 0x07,
-    0x07, 0x07, 0x15, 0x15, 0x07, 0x07, 0x07, 0x06, 0x03, 0x03, 0x06, 0x06,
-    0x06, 0x07, 0x07, 0x07, 0x09, 0x39, 0xb8, 0x7a, 0x16, 0x7a, 0x13, 0x07,
-    0x06, 0x03, 0x03, 0x06, 0x09, 0x20, 0xcd, 0x99, 0x7a, 0x7a, 0xcd, 0xed,
-    0xed, 0xcd, 0xcd, 0xa7, 0x5b, 0x7a, 0xb8, 0xc3, 0xc3, 0xc3, 0xc2, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xbc, 0xbc, 0xbf, 0xbf, 0xbc, 0xbc, 0xbc, 0xbc,
-    0xb4, 0xb4, 0xb4, 0xb4, 0xbf, 0xbf, 0xb7, 0xb7, 0xbf, 0xb7, 0xb7, 0xb4,
-    0xb7, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb7, 0xb7, 0xb5, 0xb5, 0xb5,
-    0xd8, 0xb5, 0xb5, 0xb5, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xbf, 0xbf, 0xbf, 0xb7, 0xb7, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0x9f, 0xc2, 0xd8, 0xb6, 0xb5, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xb5, 0xb5, 0xb5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa3, 0xa3, 0x91,
-    0x91, 0x9f, 0x9f, 0x8c, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa3, 0xa3, 0xb6,
-    0xb8, 0x7a, 0x15, 0x03, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02,
-    0x08, 0x02, 0x02, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x08, 0x02, 0x02, 0x02,
-    0x14, 0x02, 0x02, 0x02, 0x05, 0x19, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x05, 0x08, 0x02, 0x02, 0x02, 0x08, 0x08, 0x14, 0x02, 0x02,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x04, 0x0f, 0x1c,
-    0x1c, 0x0a, 0x05, 0x04, 0x03, 0x06, 0x07, 0x07, 0x07, 0x15, 0x15, 0x07,
-    0x15, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x01, 0x01, 0x03, 0x03,
-    0x06, 0x07, 0x09, 0x07, 0x07, 0x07, 0x4f, 0x39, 0x09, 0x20, 0xcd, 0x20,
-    0x07, 0x07, 0x09, 0x39, 0x09, 0x13, 0x5b, 0xa7, 0xc2, 0xc2, 0xbf, 0xbf,
-    0xbc, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xb7, 0xb7, 0xb7, 0xb4, 0xb4,
-    0xb4, 0xb7, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xc2, 0xd8, 0xbf, 0xb5, 0xb5,
-    0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
-    0xb7, 0xb7, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb7, 0xb5, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xa3, 0xb5,
-    0xb6, 0xd8, 0xd8, 0xb6, 0xb5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xb5,
-    0xb5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0xa3, 0xa3, 0x9f, 0x9f, 0x9f, 0xa7, 0x95, 0x7a,
-    0x7a, 0x7a, 0x95, 0xb8, 0xa7, 0xc3, 0xc3, 0xc3, 0xb8, 0x7a, 0x06, 0x01,
-    0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x19, 0x02, 0x02,
-    0x02, 0x02, 0x05, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x19, 0x05, 0x05, 0x05, 0x02, 0x05, 0x19, 0x08, 0x02, 0x02, 0x08, 0x02,
-    0x02, 0x0b, 0x0b, 0x05, 0x0b, 0x27, 0x08, 0x02, 0x02, 0x00, 0x01, 0x01,
-    0x01, 0x00, 0x02, 0x02, 0x05, 0x05, 0x0a, 0x0a, 0x0d, 0x1c, 0x19, 0x05,
-    0x01, 0x01, 0x03, 0x06, 0x06, 0x1a, 0x07, 0x07, 0x07, 0x06, 0x07, 0x07,
-    0x07, 0x07, 0x06, 0x06, 0x06, 0x03, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x03, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x03, 0x06, 0x06,
-    0x03, 0x03, 0x06, 0x06, 0x39, 0xb8, 0xc2, 0xc6, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xb7, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xb7, 0xb7, 0xbf, 0xb7, 0xb5, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xd8, 0xd8, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xbf, 0xb5, 0xb5, 0xbf, 0xb5, 0xbf, 0xb5, 0xbf, 0xbf, 0xb5,
-    0xbf, 0xbf, 0xb5, 0xbf, 0xb5, 0xbf, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb6, 0xb6, 0xe6, 0xb6,
-    0xb5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xb5, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0xa3, 0x8c, 0x9f, 0x95, 0x7a, 0x39, 0x15, 0x15, 0x06, 0x03, 0x15, 0x32,
-    0x7a, 0xb8, 0x7a, 0x4f, 0x15, 0x72, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x08, 0x05, 0x02, 0x02, 0x02, 0x19, 0x05, 0x02, 0x02, 0x05, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x19, 0x02, 0x02, 0x02, 0x08, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02,
-    0x19, 0x05, 0x05, 0x1c, 0x0a, 0x05, 0x02, 0x05, 0x05, 0x02, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x08, 0x02, 0x05, 0x0b, 0x0b, 0x29,
-    0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
-    0x05, 0x14, 0x0d, 0x0a, 0x05, 0x14, 0x19, 0x05, 0x02, 0x01, 0x01, 0x03,
-    0x03, 0x06, 0x0c, 0x06, 0x0c, 0x0c, 0x06, 0x06, 0x07, 0x07, 0x1a, 0x06,
-    0x0c, 0x0c, 0x06, 0x0c, 0x06, 0x06, 0x0c, 0x03, 0x03, 0x03, 0x0c, 0x06,
-    0x03, 0x03, 0x06, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
-    0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x06, 0x23, 0xb8, 0xc2, 0xc6, 0xc6, 0xc2, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xb7, 0xbf, 0xbf, 0xb7,
-    0xb5, 0xb5, 0xb5, 0xb7, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xd8,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xb5, 0xbf, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb7, 0xb5, 0xb5, 0xb5, 0xa3, 0xb5, 0xb5, 0xa3,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xc2, 0xe6, 0xb6, 0xb5, 0xb5, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xb5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa3, 0xa3, 0x9f, 0xa7, 0x5b,
-    0x07, 0x03, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x08, 0x08,
-    0x02, 0x05, 0x05, 0x05, 0x02, 0x08, 0x05, 0x19, 0x04, 0x02, 0x02, 0x08,
-    0x02, 0x02, 0x19, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x05, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x05, 0x05, 0x19,
-    0x19, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x05, 0x05, 0x05, 0x14, 0x14, 0x0d, 0x17, 0x17, 0x0d, 0x05, 0x05, 0x02,
-    0x08, 0x08, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x05, 0x0d, 0x0d,
-    0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x04, 0x03, 0x03,
-    0x03, 0x0c, 0x0c, 0x03, 0x06, 0x0c, 0x0c, 0x04, 0x04, 0x04, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x04, 0x04, 0x03, 0x0c, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04,
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x01, 0x02, 0x01, 0x03, 0x06, 0x39, 0xb8,
-    0xc3, 0xc2, 0xc2, 0xc6, 0xc6, 0xbf, 0xc2, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xb7, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xd8, 0xc2, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xbf, 0xbf, 0xb5, 0xbf, 0xb5, 0xb5, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xc2, 0xc2, 0xbf, 0xc2, 0xc2, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
-    0xb4, 0xb4, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xa3, 0xb5, 0xb5,
-    0xb5, 0xb6, 0xd8, 0xd8, 0xb5, 0xb5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0xa3, 0xa3, 0xa3, 0x9f, 0xb8, 0x7a, 0x06, 0x03, 0x02, 0x00,
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x02, 0x02, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x08, 0x05, 0x05, 0x02, 0x08, 0x02, 0x02, 0x19, 0x02,
-    0x02, 0x08, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x0a, 0x05, 0x05, 0x02,
-    0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05,
-    0x0d, 0x0d, 0x0d, 0x28, 0x28, 0x05, 0x05, 0x05, 0x02, 0x02, 0x08, 0x01,
-    0x01, 0x01, 0x02, 0x02, 0x02, 0x05, 0x0b, 0x05, 0x05, 0x05, 0x05, 0x08,
-    0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x03, 0x04, 0x03,
-    0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x0c, 0x0c, 0x0c, 0x0c, 0x04, 0x04,
-    0x04, 0x04, 0x04, 0x03, 0x0c, 0x0c, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x03, 0x03, 0x04, 0x04, 0x04,
-    0x04, 0x04, 0x04, 0x01, 0x01, 0x03, 0x06, 0x22, 0x99, 0xcd, 0xd8, 0xc6,
-    0xc2, 0xc2, 0xc2, 0xc2, 0xbf, 0xc2, 0xbf, 0xc2, 0xc2, 0xbf, 0xbf, 0xbf,
-    0xb7, 0xbf, 0xb7, 0xbf, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb6, 0xd8, 0xb6, 0xbf, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xbf, 0xbf, 0xbf,
-    0xbf, 0xbf, 0xc2, 0xbf, 0xbf, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2,
-    0xc2, 0xc2, 0xc2, 0xc2, 0xbf, 0xbf, 0xbf, 0xbf, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xa3, 0xb5, 0xb5, 0xb5, 0xb6, 0xb6, 0xc3, 0xe6,
-    0xb6, 0xb5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0x9f, 0x9f, 0xa7, 0xa7, 0x9f, 0x9f, 0x9f, 0xb5, 0xb5,
-    0xb6, 0xa7, 0xb8, 0x99, 0x06, 0x01, 0x00, 0x00, 0x02, 0x01, 0x02, 0x02,
-    0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02,
-    0x08, 0x02, 0x02, 0x05, 0x02, 0x02, 0x27, 0x02, 0x02, 0x08, 0x02, 0x02,
-    0x08, 0x19, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x19, 0x02, 0x02, 0x00,
-    0x00, 0x02, 0x02, 0x05, 0x05, 0x05, 0x0a, 0x0d, 0x0b, 0x05, 0x0d, 0x0d,
-    0x0b, 0x0d, 0x0b, 0x05, 0x14, 0x05, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x05, 0x02, 0x05, 0x08, 0x08, 0x02, 0x02, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
-    0x01, 0x04, 0x04, 0x03, 0x03, 0x04, 0x04, 0x02, 0x02, 0x02, 0x04, 0x04,
-    0x04, 0x04, 0x04, 0x04, 0x0c, 0x0c, 0x0c, 0x06, 0x1a, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x06, 0x06, 0x06, 0x0c, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x03,
-    0x0c, 0x03, 0x03, 0x06, 0x32, 0x4f, 0xcd, 0xc3, 0xc2, 0xc3, 0xc2, 0xb6,
-    0xc2, 0xc2, 0xb6, 0xc2, 0xc2, 0xb6, 0xc2, 0xbf, 0xbf, 0xb5, 0xbf, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb6, 0xd8, 0xb6,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xbf, 0xbf, 0xb5, 0xbf, 0xbf, 0xbf, 0xb6,
-    0xc2, 0xc2, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x89, 0x5b, 0xa7, 0xc3, 0xc2,
-    0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xb6, 0xc2, 0xc2, 0xc2, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb4, 0xb4, 0xb4, 0xbf, 0xb5, 0xc2, 0xc3, 0xb6, 0xb6, 0xb6, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb6, 0xc2, 0xe6, 0xc3, 0xb6, 0xb5, 0xa3, 0xa3,
-    0xa3, 0xb5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9f,
-    0x9f, 0xa7, 0x9f, 0xa7, 0xb6, 0xb6, 0xb6, 0xb6, 0xc3, 0xc3, 0xcd, 0x15,
-    0x06, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x08, 0x08, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05,
-    0x05, 0x05, 0x27, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x02, 0x02, 0x02,
-    0x19, 0x05, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05,
-    0x05, 0x02, 0x02, 0x02, 0x27, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0d, 0x05, 0x0b, 0x14, 0x14,
-    0x14, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x08, 0x08, 0x08, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04,
-    0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05,
-    0x04, 0x0f, 0x0c, 0x0c, 0x1a, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x06, 0x06,
-    0x0c, 0x0c, 0x0c, 0x1e, 0x0c, 0x0c, 0x06, 0x0c, 0x03, 0x03, 0x04, 0x03,
-    0x06, 0x07, 0x39, 0x20, 0x30, 0xa7, 0x5b, 0x16, 0x5b, 0x5b, 0x16, 0x30,
-    0x5b, 0xb8, 0xc3, 0xc3, 0xc2, 0xc2, 0xb6, 0xb6, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xa3, 0xa3, 0xb5, 0xa3, 0xb6, 0xb6, 0xd8, 0xb6, 0xb5, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xbf,
-    0xb5, 0xbf, 0xbf, 0xc2, 0xc2, 0xc2, 0xc2, 0xc3, 0xc3, 0xc3, 0xb8, 0x5b,
-    0x20, 0x20, 0x20, 0x09, 0x09, 0x16, 0x99, 0x7a, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xa7, 0x5b, 0x95, 0xb8, 0x30, 0x5b, 0xb6, 0xc2, 0xc2, 0xbf, 0xbf, 0xc2,
-    0xc2, 0x5b, 0x7a, 0x7a, 0x89, 0xa7, 0xc3, 0xb6, 0xb6, 0xb6, 0xb5, 0xb5,
-    0xb6, 0xc2, 0xe6, 0xc3, 0xb6, 0xb5, 0xa3, 0xa3, 0xa3, 0xb5, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x9f, 0xa3, 0x9f, 0x9f, 0x9f, 0xb6, 0xb6,
-    0xb6, 0xc3, 0xc3, 0xb8, 0x99, 0x4f, 0x32, 0x06, 0x03, 0x01, 0x01, 0x00,
-    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0a, 0x05, 0x02, 0x02, 0x05, 0x05, 0x08, 0x02, 0x08, 0x02, 0x02, 0x02,
-    0x02, 0x00, 0x01, 0x02, 0x02, 0x08, 0x08, 0x05, 0x19, 0x14, 0x0b, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x19, 0x0b, 0x05, 0x02,
-    0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x08, 0x02, 0x02, 0x02,
-    0x19, 0x0b, 0x08, 0x02, 0x02, 0x08, 0x02, 0x05, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x08, 0x05, 0x05, 0x05, 0x05, 0x0d, 0x0d, 0x0a, 0x0a, 0x0b, 0x0d,
-    0x05, 0x02, 0x02, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x01, 0x04, 0x01, 0x02,
-    0x01, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0f, 0x0c,
-    0x0c, 0x1a, 0x1a, 0x1a, 0x1a, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x04, 0x04, 0x04, 0x0c, 0x03, 0x06, 0x15,
-    0x22, 0x13, 0x22, 0x13, 0x22, 0x13, 0x13, 0x13, 0x20, 0x13, 0x5b, 0x5b,
-    0x7a, 0xb8, 0x30, 0xa7, 0xb6, 0xb5, 0xb5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0x9f, 0xc2, 0xd8, 0x9f, 0xb5, 0xb5, 0xa3, 0xb5, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb6, 0xc2, 0xb6, 0xc2, 0xc2, 0xc2,
-    0xc3, 0xa7, 0x7a, 0x30, 0x4f, 0x4f, 0x09, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x09, 0x09, 0x09, 0x09, 0x20, 0x5b, 0x99, 0x7a, 0x39, 0x09, 0x20, 0x20,
-    0x09, 0x13, 0x30, 0x5b, 0x89, 0xc3, 0xc2, 0xc3, 0x7a, 0x09, 0x09, 0x09,
-    0x09, 0x5b, 0x99, 0xc3, 0xc3, 0xc3, 0xc2, 0xc2, 0xb6, 0xb6, 0xc3, 0xe6,
-    0xb6, 0xb5, 0xb5, 0xa3, 0xb5, 0xb5, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-    0xa3, 0xa3, 0xa3, 0xa3, 0xb5, 0xa3, 0xb6, 0xb6, 0xc3, 0xc3, 0x95, 0x22,
-    0x15, 0x06, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0d, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x02, 0x08, 0x08, 0x19, 0x14, 0x05, 0x02, 0x08, 0x02, 0x02, 0x02,
-    0x08, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x02, 0x02, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x0b, 0x05, 0x02, 0x02, 0x02, 0x02, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05,
-    0x0d, 0x0b, 0x0e, 0x1c, 0x0a, 0x0d, 0x0d, 0x14, 0x08, 0x02, 0x02, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x08, 0x05, 0x19, 0x02, 0x02,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01,
-    0x01, 0x01, 0x04, 0x04, 0x04, 0x04, 0x01, 0x01, 0x04, 0x04, 0x04, 0x04,
-    0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x19, 0x0f, 0x1e, 0x1e, 0x1e, 0x1a,
-    0x1a, 0x1a, 0x1e, 0x1e, 0x1e, 0x1e, 0x0c, 0x0c, 0x1e, 0x0f, 0x0f, 0x0c,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x1a, 0x23, 0x23, 0x23, 0x23,
-    0x22, 0x13, 0x22, 0x13, 0x22, 0x09, 0x13, 0x09, 0x13, 0x13, 0x22, 0x39,
-    0xa7, 0xb6, 0xb6, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xd8, 0xb6, 0xb6,
-    0x9f, 0x9f, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xb5, 0xb5, 0xb6,
-    0xb6, 0xb6, 0xc2, 0xc2, 0xc2, 0xc3, 0xc3, 0xa7, 0x39, 0x09, 0x09, 0x09,
-    0x09, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x09,
-    0x09, 0x09, 0x09, 0x13, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x13, 0x13,
-    0x5b, 0xb8, 0xcd, 0xcd, 0x99, 0x09, 0x07, 0x07, 0x09, 0x09, 0x13, 0x20,
-    0x30, 0x99, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xed, 0xc2, 0xb5, 0xb5, 0xb5,
-    0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xb6,
-    0xb6, 0xb6, 0xc3, 0x89, 0x7a, 0x20, 0x09, 0x06, 0x03, 0x01, 0x01, 0x02,
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x25, 0x17, 0x0d, 0x0a, 0x05, 0x05, 0x05, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x05, 0x1c, 0x05, 0x05, 0x08, 0x02, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02,
-    0x05, 0x0d, 0x0b, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x11, 0x2a, 0x0b,
-    0x02, 0x02, 0x08, 0x05, 0x19, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x0e, 0x28,
-    0x0a, 0x14, 0x05, 0x05, 0x05, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x08, 0x05, 0x0b, 0x0d, 0x2b, 0x05, 0x04, 0x01, 0x01, 0x01, 0x02,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x04, 0x04, 0x04, 0x04, 0x04,
-    0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-    0x04, 0x05, 0x19, 0x19, 0x1f, 0x1f, 0x1f, 0x1e, 0x1e, 0x1e, 0x1a, 0x1a,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x0f, 0x0f,
-    0x1e, 0x0c, 0x0c, 0x1a, 0x23, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x23, 0x15, 0x15, 0x15, 0x15, 0x15, 0x09, 0x13, 0x30, 0xa7, 0xa7,
-    0xa7, 0x9f, 0x9f, 0x9f, 0x9f, 0xd8, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0xa3, 0xa3, 0xb5, 0xb5, 0xb6, 0xb6, 0xb6, 0xc2, 0xc3, 0xc3,
-    0xcd, 0xcd, 0x99, 0x13, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x07, 0x09, 0x13, 0x39, 0xb8, 0xcd, 0x7a,
-    0x39, 0x13, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x09, 0x22, 0x20,
-    0xcd, 0xc3, 0xcd, 0xed, 0xc3, 0xb6, 0xb6, 0xb6, 0xb6, 0xb5, 0xb5, 0xb5,
-    0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xa7, 0xa7, 0x99, 0x4f, 0x13,
-    0x06, 0x06, 0x06, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2c, 0x10, 0x0e, 0x25, 0x28, 0x0d, 0x0a, 0x05, 0x05, 0x02, 0x02, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x2b, 0x0a, 0x05,
-    0x08, 0x02, 0x02, 0x08, 0x02, 0x08, 0x02, 0x02, 0x05, 0x0b, 0x0b, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x08, 0x3e, 0x43, 0x2a, 0x08, 0x02, 0x02, 0x05,
-    0x19, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x05, 0x05, 0x02, 0x02, 0x05, 0x05, 0x0b, 0x0d, 0x28, 0x05, 0x05, 0x02,
-    0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x0d, 0x0e,
-    0x17, 0x1c, 0x0a, 0x04, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01,
-    0x01, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01,
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x19,
-    0x1c, 0x1c, 0x1c, 0x1f, 0x1e, 0x1e, 0x1a, 0x1a, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1a,
-    0x23, 0x32, 0x32, 0x32, 0x32, 0x32, 0x23, 0x23, 0x23, 0x23, 0x15, 0x15,
-    0x15, 0x15, 0x15, 0x15, 0x15, 0x22, 0x7a, 0x99, 0xb8, 0x95, 0x95, 0xa7,
-    0xa7, 0xcd, 0xa7, 0xa7, 0xa7, 0x89, 0xa7, 0xa7, 0xa7, 0x9f, 0x9f, 0x9f,
-    0x9f, 0xb6, 0xb6, 0xc3, 0xc3, 0xa7, 0x5b, 0x5b, 0x7a, 0x22, 0x09, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x09, 0x09, 0x09, 0x13, 0x20, 0x20, 0x13, 0x09, 0x09, 0x09, 0x09,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x09, 0x20, 0xb8, 0xcd, 0xed,
-    0xc3, 0xc3, 0xc3, 0xc2, 0xc2, 0xc2, 0xb6, 0xb6, 0xb6, 0xc3, 0xc3, 0xc3,
-    0x89, 0x5b, 0x30, 0x5b, 0x20, 0x09, 0x07, 0x06, 0x03, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2e, 0x2e, 0x46,
-    0x3b, 0x25, 0x0e, 0x0d, 0x05, 0x02, 0x02, 0x02, 0x01, 0x00, 0x01, 0x00,
-    0x02, 0x02, 0x00, 0x02, 0x08, 0x27, 0x05, 0x05, 0x02, 0x02, 0x02, 0x08,
-    0x08, 0x08, 0x02, 0x02, 0x26, 0x2a, 0x2a, 0x1b, 0x14, 0x05, 0x02, 0x02,
-    0x11, 0x2a, 0x2a, 0x43, 0x05, 0x02, 0x02, 0x02, 0x41, 0x08, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x05, 0x08, 0x08, 0x02, 0x05, 0x0b, 0x0b, 0x05, 0x02,
-    0x02, 0x05, 0x0b, 0x0b, 0x05, 0x05, 0x02, 0x02, 0x02, 0x04, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x1c, 0x28, 0x1c, 0x17, 0x1c, 0x0e, 0x05, 0x02,
-    0x01, 0x01, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x04, 0x05,
-    0x04, 0x04, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x04, 0x04,
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x19, 0x1c, 0x19, 0x1c, 0x1c,
-    0x1f, 0x1e, 0x1e, 0x1e, 0x1a, 0x1a, 0x1a, 0x1a, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1a, 0x35, 0x32, 0x32, 0x32,
-    0x32, 0x32, 0x32, 0x32, 0x32, 0x23, 0x23, 0x23, 0x23, 0x15, 0x15, 0x15,
-    0x15, 0x15, 0x22, 0x4f, 0x4f, 0x7a, 0x7a, 0x7a, 0x99, 0xcd, 0xa7, 0x95,
-    0x95, 0xa7, 0xa7, 0xa7, 0x95, 0x95, 0xa7, 0xa7, 0xa7, 0xb6, 0xb8, 0x95,
-    0x4f, 0x20, 0x22, 0x13, 0x09, 0x15, 0x07, 0x15, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x09, 0x13, 0x09, 0x13, 0x13, 0x13, 0x09, 0x09, 0x13, 0x09, 0x09,
-    0x13, 0x13, 0x13, 0x13, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x07,
-    0x07, 0x07, 0x09, 0x09, 0x09, 0x13, 0x99, 0xcd, 0xcd, 0xcd, 0xcd, 0xc3,
-    0xc3, 0xc2, 0xc2, 0xc2, 0x8c, 0x89, 0x5b, 0x30, 0x13, 0x09, 0x07, 0x07,
-    0x07, 0x06, 0x06, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x12, 0x2e, 0x2e, 0x47, 0x46, 0x2c, 0x25, 0x0e,
-    0x05, 0x05, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x00, 0x02,
-    0x02, 0x19, 0x02, 0x08, 0x08, 0x02, 0x02, 0x08, 0x05, 0x02, 0x02, 0x02,
-    0x11, 0x2a, 0x2a, 0x2a, 0x17, 0x14, 0x02, 0x02, 0x11, 0x43, 0x79, 0x43,
-    0x05, 0x02, 0x08, 0x02, 0x27, 0x05, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02,
-    0x08, 0x02, 0x02, 0x05, 0x0b, 0x0d, 0x14, 0x14, 0x02, 0x08, 0x05, 0x0b,
-    0x29, 0x14, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x0a, 0x0a, 0x0a,
-    0x1c, 0x1c, 0x0e, 0x17, 0x1c, 0x0a, 0x05, 0x02, 0x02, 0x01, 0x00, 0x00,
-    0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x04, 0x05, 0x04, 0x04, 0x04, 0x04,
-    0x04, 0x01, 0x01, 0x01, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-    0x04, 0x04, 0x0f, 0x0a, 0x1c, 0x19, 0x1c, 0x1c, 0x1f, 0x1f, 0x1e, 0x1e,
-    0x1a, 0x1a, 0x1a, 0x1a, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x33, 0x33, 0x33, 0x35, 0x35, 0x35, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
-    0x32, 0x32, 0x32, 0x32, 0x32, 0x23, 0x23, 0x15, 0x1a, 0x1a, 0x15, 0x23,
-    0x32, 0x22, 0x39, 0x22, 0x39, 0x7a, 0x99, 0x99, 0x99, 0x99, 0x95, 0x7a,
-    0x4f, 0x7a, 0x7a, 0x5b, 0x5b, 0x7a, 0x5b, 0x22, 0x09, 0x09, 0x07, 0x07,
-    0x15, 0x15, 0x15, 0x07, 0x07, 0x07, 0x07, 0x15, 0x07, 0x15, 0x15, 0x15,
-    0x09, 0x09, 0x09, 0x09, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x09, 0x13, 0x13, 0x20, 0x20,
-    0x20, 0x13, 0x13, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x07, 0x09,
-    0x07, 0x07, 0x07, 0x09, 0x09, 0x20, 0x5b, 0x7a, 0xa7, 0x89, 0x8c, 0x61,
-    0x16, 0x16, 0x13, 0x09, 0x07, 0x07, 0x06, 0x06, 0x03, 0x03, 0x03, 0x01,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x25, 0x3b, 0x46, 0x46, 0x2c, 0x2c, 0x0d, 0x05, 0x05, 0x05, 0x02,
-    0x02, 0x02, 0x01, 0x01, 0x00, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x08,
-    0x08, 0x02, 0x08, 0x08, 0x19, 0x02, 0x02, 0x02, 0x02, 0x11, 0x11, 0x0b,
-    0x2a, 0x2a, 0x0b, 0x02, 0x0b, 0x18, 0x3f, 0x0b, 0x02, 0x05, 0x05, 0x14,
-    0x0d, 0x05, 0x05, 0x08, 0x02, 0x05, 0x04, 0x02, 0x02, 0x08, 0x05, 0x0b,
-    0x05, 0x0a, 0x0d, 0x0d, 0x05, 0x02, 0x05, 0x02, 0x29, 0x29, 0x11, 0x02,
-    0x02, 0x05, 0x05, 0x0a, 0x0a, 0x0d, 0x0e, 0x0e, 0x0d, 0x0d, 0x0e, 0x0e,
-    0x17, 0x0d, 0x05, 0x08, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
-    0x01, 0x02, 0x04, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x01, 0x01, 0x01,
-    0x04, 0x04, 0x04, 0x04, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x04, 0x04, 0x0f,
-    0x0a, 0x0a, 0x1c, 0x1c, 0x1c, 0x1f, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x1e, 0x1e, 0x33, 0x33, 0x33, 0x35,
-    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
-    0x32, 0x32, 0x23, 0x23, 0x1a, 0x1e, 0x1a, 0x1a, 0x35, 0x32, 0x32, 0x32,
-    0x32, 0x32, 0x32, 0x4f, 0x4f, 0x4f, 0x39, 0x4f, 0x4f, 0x39, 0x4f, 0x4f,
-    0x39, 0x22, 0x22, 0x15, 0x15, 0x1a, 0x07, 0x07, 0x07, 0x15, 0x15, 0x07,
-    0x15, 0x15, 0x15, 0x13, 0x09, 0x09, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x22, 0x22, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x13,
-    0x13, 0x20, 0x20, 0x20, 0x20, 0x13, 0x20, 0x20, 0x20, 0x13, 0x20, 0x20,
-    0x20, 0x13, 0x13, 0x13, 0x09, 0x09, 0x09, 0x09, 0x07, 0x07, 0x07, 0x07,
-    0x09, 0x09, 0x09, 0x13, 0x16, 0x16, 0x16, 0x16, 0x13, 0x09, 0x07, 0x07,
-    0x06, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x17, 0x0e, 0x25,
-    0x2c, 0x2c, 0x3d, 0x17, 0x0d, 0x05, 0x05, 0x02, 0x02, 0x02, 0x01, 0x01,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x02, 0x08, 0x02, 0x02, 0x02, 0x08, 0x08,
-    0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x05, 0x0b, 0x2a, 0x43, 0x2a,
-    0x0b, 0x0d, 0x05, 0x02, 0x0b, 0x2a, 0x25, 0x0e, 0x0d, 0x05, 0x05, 0x05,
-    0x02, 0x02, 0x05, 0x05, 0x02, 0x02, 0x05, 0x05, 0x05, 0x0a, 0x0d, 0x0d,
-    0x05, 0x05, 0x02, 0x05, 0x02, 0x02, 0x19, 0x02, 0x02, 0x02, 0x05, 0x05,
-    0x0a, 0x0d, 0x0a, 0x0d, 0x0d, 0x14, 0x0d, 0x17, 0x0d, 0x0a, 0x05, 0x08,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x04, 0x05,
-    0x04, 0x04, 0x04, 0x0f, 0x04, 0x04, 0x04, 0x01, 0x04, 0x04, 0x04, 0x04,
-    0x0f, 0x04, 0x0f, 0x0f, 0x0f, 0x04, 0x0f, 0x0f, 0x1c, 0x1c, 0x1c, 0x1c,
-    0x1c, 0x2b, 0x38, 0x1f, 0x1e, 0x1e, 0x1e, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33, 0x36, 0x35, 0x35, 0x35,
-    0x35, 0x35, 0x35, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
-    0x36, 0x1e, 0x1e, 0x1e, 0x36, 0x36, 0x35, 0x35, 0x36, 0x36, 0x35, 0x32,
-    0x32, 0x32, 0x39, 0x39, 0x32, 0x32, 0x39, 0x39, 0x22, 0x22, 0x15, 0x15,
-    0x1a, 0x1a, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x23, 0x23, 0x13, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x13,
-    0x13, 0x09, 0x09, 0x09, 0x09, 0x07, 0x07, 0x07, 0x07, 0x09, 0x09, 0x09,
-    0x09, 0x13, 0x13, 0x13, 0x09, 0x07, 0x06, 0x03, 0x01, 0x01, 0x01, 0x02,
-    0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2c, 0x3b, 0x17, 0x17, 0x0e, 0x0e, 0x0e, 0x0e,
-    0x0e, 0x0d, 0x05, 0x05, 0x02, 0x02, 0x01, 0x01, 0x08, 0x02, 0x02, 0x00,
-    0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x08, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x14, 0x18, 0x43, 0x26, 0x08, 0x05, 0x0b, 0x05, 0x14,
-    0x25, 0x2c, 0x46, 0x2c, 0x0d, 0x0b, 0x0b, 0x02, 0x02, 0x05, 0x05, 0x02,
-    0x02, 0x02, 0x02, 0x05, 0x05, 0x0e, 0x0d, 0x0a, 0x05, 0x0a, 0x0d, 0x05,
-    0x0b, 0x05, 0x02, 0x08, 0x08, 0x02, 0x05, 0x05, 0x05, 0x0d, 0x0a, 0x05,
-    0x05, 0x05, 0x0d, 0x0d, 0x0d, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x04,
-    0x04, 0x04, 0x04, 0x04, 0x02, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x1c, 0x1c, 0x0a, 0x1c, 0x2b, 0x27, 0x1f,
-    0x1f, 0x1e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x35, 0x35, 0x35, 0x35, 0x35,
-    0x35, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x35, 0x35, 0x36, 0x36, 0x36,
-    0x36, 0x4b, 0x4b, 0x72, 0x4e, 0x72, 0x72, 0x4b, 0x36, 0x36, 0x35, 0x32,
-    0x32, 0x32, 0x32, 0x32, 0x23, 0x15, 0x15, 0x1a, 0x1a, 0x23, 0x15, 0x23,
-    0x23, 0x15, 0x23, 0x23, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x13, 0x13, 0x13, 0x13, 0x09,
-    0x13, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x07, 0x07,
-    0x06, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2c, 0x25, 0x25, 0x0e, 0x0e, 0x0e, 0x17, 0x17, 0x17, 0x0e, 0x0d, 0x0b,
-    0x05, 0x02, 0x02, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x08,
-    0x02, 0x02, 0x19, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05,
-    0x17, 0x2a, 0x11, 0x02, 0x02, 0x05, 0x1b, 0x1b, 0x2c, 0x46, 0x2c, 0x2c,
-    0x1b, 0x14, 0x11, 0x02, 0x08, 0x05, 0x05, 0x05, 0x02, 0x02, 0x05, 0x05,
-    0x05, 0x0a, 0x05, 0x0a, 0x0a, 0x05, 0x0d, 0x0b, 0x0b, 0x0b, 0x02, 0x02,
-    0x08, 0x02, 0x05, 0x0d, 0x0b, 0x05, 0x05, 0x05, 0x05, 0x05, 0x14, 0x1c,
-    0x0e, 0x0e, 0x0e, 0x0d, 0x0a, 0x05, 0x02, 0x02, 0x02, 0x04, 0x04, 0x04,
-    0x02, 0x02, 0x05, 0x04, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-    0x04, 0x04, 0x0f, 0x0f, 0x0f, 0x19, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0a, 0x1c, 0x1c, 0x0a, 0x19, 0x1c, 0x19, 0x38, 0x1f, 0x1e, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x36, 0x36, 0x36, 0x36, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
-    0x35, 0x35, 0x35, 0x35, 0x35, 0x36, 0x35, 0x35, 0x36, 0x36, 0x72, 0xa0,
-    0xa0, 0xc0, 0xc7, 0x72, 0x72, 0x4b, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
-    0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x09,
-    0x09, 0x09, 0x09, 0x09, 0x15, 0x07, 0x07, 0x06, 0x03, 0x01, 0x01, 0x01,
-    0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x57, 0x3b, 0x17,
-    0x0a, 0x05, 0x1c, 0x0e, 0x17, 0x25, 0x25, 0x17, 0x0d, 0x05, 0x05, 0x05,
-    0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x19, 0x05,
-    0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x25, 0x17, 0x05, 0x0b,
-    0x1b, 0x2c, 0x1b, 0x2a, 0x46, 0x46, 0x2c, 0x0d, 0x0b, 0x05, 0x08, 0x08,
-    0x08, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x05, 0x0a, 0x0a, 0x05, 0x0a,
-    0x1c, 0x0e, 0x0d, 0x0d, 0x0d, 0x27, 0x02, 0x02, 0x02, 0x08, 0x05, 0x14,
-    0x0b, 0x05, 0x02, 0x05, 0x05, 0x0d, 0x0d, 0x0e, 0x17, 0x28, 0x17, 0x1c,
-    0x0a, 0x0a, 0x05, 0x05, 0x02, 0x02, 0x02, 0x04, 0x04, 0x04, 0x04, 0x05,
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0f, 0x04, 0x0f, 0x0f,
-    0x0a, 0x19, 0x0a, 0x0a, 0x19, 0x19, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x0a,
-    0x19, 0x1c, 0x1c, 0x2b, 0x1f, 0x38, 0x38, 0x38, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x33, 0x33, 0x36, 0x36,
-    0x36, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x35, 0x35, 0x35, 0x35, 0x4b, 0x4b, 0x72, 0xa0, 0xda, 0xde, 0xe1, 0xda,
-    0xa0, 0x4e, 0x36, 0x33, 0x45, 0x6f, 0x72, 0x35, 0x35, 0x1a, 0x1a, 0x1a,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x13, 0x20, 0x20, 0x13, 0x13, 0x13, 0x13, 0x13, 0x09, 0x09, 0x09, 0x07,
-    0x07, 0x06, 0x06, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2c, 0x2c, 0x25, 0x1c, 0x0d, 0x0a, 0x0d, 0x0e,
-    0x17, 0x25, 0x2c, 0x2c, 0x0e, 0x0e, 0x0e, 0x0d, 0x05, 0x05, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x05, 0x02, 0x08, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x14, 0x25, 0x17, 0x0d, 0x0d, 0x3b, 0x46, 0x18, 0x1b,
-    0x3b, 0x3b, 0x43, 0x05, 0x05, 0x02, 0x08, 0x08, 0x05, 0x05, 0x05, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x02, 0x05, 0x0a, 0x0e, 0x0a, 0x0d,
-    0x05, 0x05, 0x02, 0x02, 0x02, 0x08, 0x0b, 0x14, 0x28, 0x0b, 0x05, 0x05,
-    0x05, 0x0d, 0x0d, 0x0e, 0x1c, 0x17, 0x0e, 0x0e, 0x0d, 0x05, 0x05, 0x05,
-    0x02, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04,
-    0x04, 0x04, 0x04, 0x04, 0x0f, 0x04, 0x0f, 0x0a, 0x04, 0x19, 0x19, 0x19,
-    0x1c, 0x1c, 0x1f, 0x1f, 0x1f, 0x1f, 0x0f, 0x0f, 0x0f, 0x19, 0x1c, 0x2b,
-    0x2b, 0x38, 0x38, 0x38, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x36, 0x36, 0x36, 0x36, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x35, 0x35,
-    0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x4b, 0x4b, 0x35, 0x35, 0x4b,
-    0x4b, 0x72, 0xa0, 0xda, 0xea, 0xfd, 0xfd, 0xf5, 0xa0, 0x4e, 0x38, 0x42,
-    0x8a, 0xf1, 0xc8, 0x33, 0x35, 0x35, 0x35, 0x1a, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x13, 0x13,
-    0x13, 0x13, 0x09, 0x09, 0x07, 0x07, 0x07, 0x15, 0x06, 0x06, 0x03, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2c, 0x0e, 0x0e, 0x3d, 0x0d, 0x1c, 0x05, 0x0e, 0x0e, 0x17, 0x25, 0x25,
-    0x10, 0x0e, 0x28, 0x28, 0x0d, 0x0a, 0x0a, 0x05, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x00, 0x00, 0x08, 0x1b,
-    0x3b, 0x2c, 0x3b, 0x17, 0x46, 0x79, 0x18, 0x05, 0x2c, 0x18, 0x05, 0x02,
-    0x05, 0x02, 0x08, 0x08, 0x05, 0x02, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x05, 0x05, 0x02, 0x08, 0x05, 0x0d, 0x05, 0x0b, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x05, 0x0b, 0x14, 0x28, 0x0b, 0x05, 0x05, 0x0a, 0x0a, 0x0d, 0x1c,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x05, 0x05, 0x05, 0x04, 0x05, 0x05, 0x05,
-    0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0a, 0x0f, 0x0a, 0x19, 0x1c, 0x1c, 0x1c, 0x1c, 0x1f,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x1f, 0x1c, 0x2b, 0x2b, 0x2b, 0x38,
-    0x38, 0x38, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-    0x36, 0x36, 0x36, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x72, 0xa0, 0xda,
-    0xf4, 0xfd, 0xfa, 0xee, 0xc7, 0x72, 0x4b, 0x4e, 0xb1, 0xf1, 0xb1, 0x6f,
-    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
-    0x32, 0x32, 0x23, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x13, 0x13, 0x09, 0x15, 0x15, 0x15, 0x06,
-    0x06, 0x06, 0x06, 0x07, 0x06, 0x06, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x0e, 0x0e, 0x0e,
-    0x17, 0x0d, 0x0a, 0x05, 0x0a, 0x0e, 0x0e, 0x17, 0x0e, 0x0d, 0x05, 0x0d,
-    0x0d, 0x0e, 0x0e, 0x05, 0x05, 0x02, 0x02, 0x02, 0x08, 0x02, 0x08, 0x02,
-    0x08, 0x02, 0x02, 0x08, 0x02, 0x11, 0x29, 0x2a, 0x3b, 0x25, 0x3b, 0x57,
-    0x25, 0x25, 0x18, 0x2a, 0x25, 0x17, 0x02, 0x02, 0x05, 0x05, 0x02, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x0b, 0x05, 0x05, 0x02, 0x02,
-    0x05, 0x05, 0x05, 0x0b, 0x05, 0x02, 0x02, 0x08, 0x05, 0x05, 0x0d, 0x0d,
-    0x28, 0x05, 0x05, 0x05, 0x0a, 0x0a, 0x05, 0x0b, 0x0d, 0x0b, 0x05, 0x0b,
-    0x0b, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0a, 0x0a, 0x05, 0x05, 0x04, 0x04,
-    0x05, 0x05, 0x04, 0x04, 0x04, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0a, 0x0a, 0x19, 0x1c, 0x1c, 0x2b, 0x1c, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x1f, 0x1c, 0x1c, 0x2b, 0x2b, 0x2b, 0x38, 0x38, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-    0x4b, 0x36, 0x4b, 0x4b, 0x4b, 0x72, 0xa0, 0xda, 0xfe, 0xfd, 0xf5, 0xc7,
-    0xa0, 0x72, 0x4b, 0x45, 0xb1, 0xe7, 0xb1, 0x6f, 0x33, 0x35, 0x35, 0x35,
-    0x35, 0x35, 0x35, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x23, 0x23, 0x23,
-    0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x13, 0x22, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x13, 0x13, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x13, 0x09, 0x07, 0x07, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03, 0x06,
-    0x06, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x0e, 0x0d, 0x17, 0x2c, 0x17, 0x0e, 0x0d,
-    0x0d, 0x1c, 0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x0e, 0x0e, 0x0d,
-    0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x08, 0x02, 0x02, 0x0b,
-    0x29, 0x2a, 0x3f, 0x14, 0x18, 0x0b, 0x05, 0x14, 0x25, 0x0e, 0x05, 0x2a,
-    0x3b, 0x46, 0x05, 0x0b, 0x0b, 0x02, 0x05, 0x08, 0x02, 0x05, 0x02, 0x05,
-    0x02, 0x02, 0x02, 0x14, 0x05, 0x05, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x02, 0x02, 0x02, 0x02, 0x05, 0x0a, 0x0d, 0x0d, 0x05, 0x05, 0x05,
-    0x05, 0x02, 0x02, 0x08, 0x02, 0x05, 0x0b, 0x0b, 0x1b, 0x27, 0x05, 0x05,
-    0x0f, 0x0a, 0x05, 0x0a, 0x0a, 0x05, 0x04, 0x05, 0x05, 0x04, 0x04, 0x04,
-    0x04, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x04, 0x0a, 0x0a, 0x19,
-    0x1c, 0x1c, 0x1c, 0x19, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x1f, 0x1c,
-    0x1c, 0x2b, 0x2b, 0x2b, 0x38, 0x38, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x38, 0x38, 0x38, 0x38, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x38,
-    0x36, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x4e,
-    0x4e, 0x72, 0xc0, 0xeb, 0xfe, 0xfe, 0xeb, 0xc7, 0xa0, 0x4e, 0x33, 0x45,
-    0x9e, 0xe7, 0xcf, 0x6f, 0x33, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
-    0x32, 0x32, 0x32, 0x32, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x09, 0x07, 0x06, 0x06,
-    0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x02, 0x02,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x28, 0x40, 0x17, 0x17, 0x3b, 0x3b, 0x17, 0x0e, 0x0e, 0x0d, 0x0a, 0x05,
-    0x05, 0x05, 0x02, 0x02, 0x05, 0x0d, 0x1c, 0x0e, 0x05, 0x05, 0x02, 0x02,
-    0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x05, 0x1c, 0x17, 0x0d, 0x05, 0x02,
-    0x02, 0x02, 0x02, 0x27, 0x28, 0x17, 0x05, 0x0d, 0x2c, 0x2c, 0x25, 0x1b,
-    0x18, 0x0b, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x08,
-    0x19, 0x0b, 0x05, 0x05, 0x19, 0x05, 0x05, 0x05, 0x08, 0x05, 0x02, 0x02,
-    0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x08, 0x02, 0x02, 0x02, 0x02,
-    0x08, 0x02, 0x05, 0x0b, 0x14, 0x28, 0x05, 0x05, 0x04, 0x0a, 0x05, 0x0a,
-    0x0a, 0x05, 0x05, 0x04, 0x04, 0x05, 0x05, 0x04, 0x04, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x04, 0x04, 0x0f, 0x19, 0x1c, 0x1c, 0x1c, 0x19,
-    0x0f, 0x0f, 0x04, 0x0f, 0x0f, 0x0f, 0x1f, 0x1c, 0x1c, 0x2b, 0x2b, 0x2b,
-    0x1f, 0x38, 0x38, 0x33, 0x33, 0x33, 0x33, 0x33, 0x38, 0x38, 0x38, 0x38,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x4e, 0x4e, 0xa0, 0xc7, 0xf4,
-    0xfd, 0xfd, 0xc7, 0xa0, 0x72, 0x38, 0x33, 0x45, 0x9e, 0xe7, 0xcf, 0x8a,
-    0x4b, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x32, 0x32, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x23, 0x23, 0x23, 0x23, 0x23, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x13, 0x13, 0x15, 0x07, 0x06, 0x03, 0x03, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0d, 0x0d, 0x0e,
-    0x3d, 0x3b, 0x3b, 0x2c, 0x25, 0x10, 0x0d, 0x05, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x05, 0x0b, 0x0d, 0x0d, 0x05, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x08,
-    0x08, 0x08, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x11, 0x02, 0x08, 0x02,
-    0x0b, 0x2a, 0x18, 0x17, 0x2e, 0x2e, 0x46, 0x46, 0x43, 0x43, 0x88, 0x0b,
-    0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x05, 0x0a, 0x0a, 0x0a, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x02, 0x05, 0x08, 0x08, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x0b, 0x0d,
-    0x14, 0x1c, 0x05, 0x05, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04,
-    0x04, 0x05, 0x05, 0x04, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x19, 0x1c, 0x1c, 0x1c, 0x1f, 0x0f, 0x0f, 0x04, 0x0f,
-    0x0f, 0x0f, 0x1f, 0x1c, 0x19, 0x27, 0x2b, 0x2b, 0x38, 0x38, 0x38, 0x38,
-    0x33, 0x33, 0x33, 0x33, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x4e, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x42, 0x42, 0x42, 0x4e, 0x72, 0xa0, 0xda, 0xfe, 0xfd, 0xf3, 0xa6, 0x71,
-    0x54, 0x42, 0x38, 0x45, 0x9e, 0xe7, 0xcf, 0x6f, 0x4b, 0x4b, 0x35, 0x35,
-    0x35, 0x35, 0x32, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x22, 0x22, 0x22, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x09, 0x09, 0x15, 0x15, 0x15,
-    0x15, 0x06, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x05, 0x0d, 0x10, 0x25, 0x2d, 0x2d,
-    0x2c, 0x0a, 0x0e, 0x0e, 0x1c, 0x0e, 0x17, 0x0d, 0x05, 0x05, 0x0a, 0x0d,
-    0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x14, 0x02, 0x11, 0x0b, 0x2a, 0x2a, 0x3b,
-    0x46, 0x7b, 0x46, 0x18, 0x0d, 0x18, 0x3f, 0x05, 0x0b, 0x05, 0x05, 0x05,
-    0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x0a, 0x05, 0x05, 0x02, 0x05, 0x08,
-    0x02, 0x08, 0x02, 0x05, 0x05, 0x05, 0x0a, 0x05, 0x05, 0x05, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x0b, 0x0d, 0x0d, 0x0d, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x1c,
-    0x1c, 0x1c, 0x1c, 0x2b, 0x19, 0x0f, 0x0f, 0x0f, 0x0f, 0x19, 0x1f, 0x2b,
-    0x2b, 0x1c, 0x2b, 0x2b, 0x2b, 0x42, 0x38, 0x38, 0x38, 0x36, 0x33, 0x33,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x38, 0x41, 0x42, 0x42, 0x4e,
-    0x72, 0xa0, 0xeb, 0xfd, 0xfd, 0xde, 0x87, 0x54, 0x41, 0x42, 0x2b, 0x2d,
-    0x9e, 0xe7, 0xcf, 0x8a, 0x33, 0x33, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
-    0x1a, 0x23, 0x23, 0x23, 0x1a, 0x1a, 0x23, 0x23, 0x23, 0x23, 0x23, 0x15,
-    0x23, 0x23, 0x23, 0x23, 0x13, 0x22, 0x22, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x13, 0x13, 0x13,
-    0x13, 0x13, 0x09, 0x15, 0x07, 0x07, 0x07, 0x06, 0x06, 0x03, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x02, 0x02, 0x05, 0x0d, 0x17, 0x25, 0x25, 0x2c, 0x25, 0x25, 0x17,
-    0x25, 0x25, 0x25, 0x17, 0x0d, 0x0a, 0x0d, 0x0d, 0x05, 0x05, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x05, 0x02, 0x02, 0x05, 0x05,
-    0x05, 0x14, 0x14, 0x29, 0x3f, 0x0b, 0x05, 0x18, 0x18, 0x2a, 0x18, 0x05,
-    0x05, 0x02, 0x05, 0x02, 0x02, 0x02, 0x05, 0x05, 0x02, 0x02, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x04, 0x05, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x08,
-    0x05, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x05, 0x08, 0x08, 0x02,
-    0x05, 0x05, 0x05, 0x0d, 0x0d, 0x14, 0x05, 0x0a, 0x0a, 0x05, 0x05, 0x0a,
-    0x0a, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x04, 0x0a, 0x0f, 0x0f,
-    0x0f, 0x04, 0x0f, 0x0f, 0x0f, 0x0a, 0x0a, 0x19, 0x1c, 0x1c, 0x1c, 0x2b,
-    0x1f, 0x19, 0x0f, 0x0f, 0x1f, 0x1c, 0x19, 0x2b, 0x38, 0x38, 0x2b, 0x2b,
-    0x2b, 0x42, 0x42, 0x38, 0x38, 0x36, 0x36, 0x36, 0x38, 0x38, 0x42, 0x42,
-    0x42, 0x41, 0x38, 0x34, 0x38, 0x38, 0x38, 0x42, 0x38, 0x42, 0x38, 0x4e,
-    0x38, 0x34, 0x34, 0x41, 0x41, 0x41, 0x42, 0x4e, 0x72, 0xa0, 0xee, 0xfd,
-    0xfa, 0xc0, 0x71, 0x41, 0x2b, 0x2b, 0x38, 0x45, 0x83, 0xcf, 0xcf, 0x9e,
-    0x45, 0x33, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x1a, 0x1a, 0x1a, 0x1a,
-    0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x23, 0x15, 0x23, 0x15, 0x15,
-    0x23, 0x23, 0x23, 0x23, 0x1a, 0x1a, 0x1a, 0x1a, 0x23, 0x15, 0x23, 0x23,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x13, 0x13, 0x15, 0x07, 0x07,
-    0x06, 0x06, 0x0c, 0x0c, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02,
-    0x05, 0x0d, 0x17, 0x28, 0x25, 0x3d, 0x3b, 0x25, 0x3d, 0x25, 0x25, 0x0e,
-    0x28, 0x1c, 0x0d, 0x0a, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x08, 0x02,
-    0x02, 0x08, 0x08, 0x08, 0x08, 0x02, 0x05, 0x05, 0x05, 0x0b, 0x0b, 0x18,
-    0x0b, 0x05, 0x05, 0x08, 0x08, 0x08, 0x05, 0x02, 0x02, 0x01, 0x01, 0x01,
-    0x02, 0x02, 0x02, 0x05, 0x02, 0x08, 0x0b, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x08, 0x02, 0x05, 0x05, 0x05,
-    0x0a, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0b,
-    0x1c, 0x0b, 0x0d, 0x0a, 0x0a, 0x19, 0x19, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0f, 0x0a, 0x0f, 0x0f, 0x04, 0x04, 0x04, 0x0f,
-    0x1f, 0x19, 0x19, 0x19, 0x2b, 0x1c, 0x1c, 0x2b, 0x1f, 0x1f, 0x1f, 0x1f,
-    0x1c, 0x2b, 0x1c, 0x1c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x42, 0x42, 0x38,
-    0x38, 0x38, 0x36, 0x36, 0x38, 0x38, 0x42, 0x38, 0x38, 0x34, 0x34, 0x34,
-    0x34, 0x38, 0x38, 0x38, 0x42, 0x42, 0x4e, 0x4e, 0x41, 0x41, 0x41, 0x41,
-    0x41, 0x41, 0x59, 0x4e, 0x72, 0xc7, 0xf7, 0xff, 0xf3, 0x87, 0x41, 0x27,
-    0x1f, 0x1f, 0x1f, 0x2d, 0x83, 0xcf, 0xcf, 0x9e, 0x5c, 0x1f, 0x33, 0x35,
-    0x35, 0x33, 0x33, 0x1e, 0x1e, 0x1e, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a,
-    0x1a, 0x1a, 0x1a, 0x1a, 0x23, 0x23, 0x15, 0x15, 0x23, 0x23, 0x23, 0x23,
-    0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x15, 0x23, 0x23, 0x22, 0x22, 0x22,
-    0x22, 0x13, 0x22, 0x13, 0x09, 0x07, 0x07, 0x1a, 0x06, 0x06, 0x03, 0x01,
-    0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x02, 0x02, 0x02, 0x0b, 0x0b,
-    0x14, 0x25, 0x25, 0x17, 0x28, 0x17, 0x1c, 0x1c, 0x1c, 0x14, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x05, 0x19, 0x19, 0x11, 0x02, 0x08, 0x02, 0x02, 0x08, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x08, 0x19, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x0d, 0x28, 0x0d, 0x0d,
-    0x19, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0f, 0x04, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x1f, 0x1f, 0x1c,
-    0x2b, 0x1c, 0x1c, 0x2b, 0x2b, 0x1f, 0x0f, 0x1f, 0x1f, 0x2b, 0x2b, 0x2b,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x42, 0x42, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x36, 0x34, 0x36, 0x36, 0x36, 0x36, 0x38, 0x38, 0x38, 0x38, 0x34,
-    0x41, 0x41, 0x41, 0x41, 0x54, 0x59, 0x4e, 0x42, 0x54, 0x54, 0x59, 0x72,
-    0xa0, 0xea, 0xff, 0xff, 0xea, 0x87, 0x41, 0x27, 0x19, 0x19, 0x1c, 0x2d,
-    0x83, 0xcf, 0xe7, 0x9e, 0x6f, 0x33, 0x33, 0x33, 0x35, 0x33, 0x1f, 0x1f,
-    0x1e, 0x1a, 0x1a, 0x1a, 0x1a, 0x1e, 0x1a, 0x1a, 0x1e, 0x1a, 0x1a, 0x1a,
-    0x1a, 0x1a, 0x23, 0x23, 0x23, 0x23, 0x23, 0x1a, 0x1a, 0x1e, 0x1e, 0x1a,
-    0x1a, 0x1a, 0x1a, 0x15, 0x23, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x13,
-    0x15, 0x07, 0x06, 0x06, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
-    0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05,
-    0x0b, 0x05, 0x05, 0x0b, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x08, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x02, 0x02, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05,
-    0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x1c, 0x28, 0x1c, 0x0d, 0x0a, 0x0a, 0x0a,
-    0x19, 0x19, 0x1c, 0x1c, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x1f, 0x0f, 0x0f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x2b,
-    0x2b, 0x38, 0x2b, 0x27, 0x2b, 0x2b, 0x38, 0x42, 0x27, 0x27, 0x27, 0x41,
-    0x27, 0x27, 0x27, 0x42, 0x38, 0x38, 0x38, 0x38, 0x38, 0x36, 0x36, 0x36,
-    0x36, 0x36, 0x36, 0x38, 0x38, 0x42, 0x41, 0x41, 0x41, 0x41, 0x41, 0x54,
-    0x59, 0x59, 0x4e, 0x59, 0x71, 0x71, 0x87, 0xa0, 0xea, 0xfa, 0xff, 0xff,
-    0xc0, 0x87, 0x41, 0x19, 0x19, 0x19, 0x2b, 0x2d, 0x9e, 0xcf, 0xe7, 0x9e,
-    0x6f, 0x38, 0x33, 0x33, 0x33, 0x33, 0x1f, 0x1f, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1a, 0x1e, 0x1e, 0x1e, 0x1e, 0x1a, 0x1a, 0x1a, 0x35, 0x35,
-    0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1e, 0x1e, 0x1e, 0x0c, 0x1a, 0x1a, 0x1a,
-    0x23, 0x15, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x1a, 0x06, 0x03, 0x03,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x0a, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02,
-    0x00, 0x00, 0x02, 0x05, 0x02, 0x02, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x05, 0x05, 0x05,
-    0x0b, 0x29, 0x28, 0x0d, 0x0d, 0x1c, 0x19, 0x0a, 0x0a, 0x0a, 0x1c, 0x1c,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x19, 0x1c, 0x19, 0x0f,
-    0x0f, 0x1c, 0x1f, 0x1f, 0x1e, 0x1e, 0x1f, 0x1f, 0x2b, 0x42, 0x42, 0x42,
-    0x2b, 0x2b, 0x38, 0x33, 0x38, 0x2b, 0x2b, 0x27, 0x41, 0x41, 0x41, 0x42,
-    0x42, 0x2b, 0x38, 0x38, 0x38, 0x34, 0x36, 0x36, 0x38, 0x33, 0x38, 0x42,
-    0x42, 0x42, 0x41, 0x41, 0x54, 0x54, 0x54, 0x59, 0x59, 0x6d, 0x72, 0x71,
-    0x87, 0x87, 0x87, 0xd6, 0xfa, 0xfd, 0xfd, 0xf7, 0xa0, 0x54, 0x27, 0x19,
-    0x19, 0x1c, 0x2b, 0x2d, 0x83, 0xe7, 0xe7, 0xb1, 0x8e, 0x2b, 0x2b, 0x33,
-    0x38, 0x38, 0x10, 0x1c, 0x1f, 0x0f, 0x0f, 0x1f, 0x1e, 0x1e, 0x1e, 0x1e,
-    0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1a, 0x1a, 0x1e, 0x1e, 0x1a, 0x1e,
-    0x1e, 0x1f, 0x0f, 0x0c, 0x0c, 0x0c, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a,
-    0x15, 0x1a, 0x1a, 0x1a, 0x0c, 0x03, 0x04, 0x01, 0x01, 0x01, 0x01, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x08, 0x02, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x04,
-    0x01, 0x01, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x00, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05,
-    0x02, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x3f, 0x1c, 0x0a,
-    0x0d, 0x0d, 0x19, 0x0a, 0x0a, 0x0a, 0x1c, 0x1c, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x1c, 0x1c, 0x1f, 0x1c, 0x1c, 0x1c, 0x1f, 0x1f,
-    0x1e, 0x1e, 0x1e, 0x2b, 0x2b, 0x42, 0x42, 0x42, 0x42, 0x42, 0x38, 0x38,
-    0x1f, 0x1f, 0x2b, 0x2b, 0x42, 0x41, 0x41, 0x41, 0x42, 0x42, 0x2b, 0x38,
-    0x38, 0x38, 0x34, 0x38, 0x38, 0x38, 0x42, 0x42, 0x42, 0x42, 0x42, 0x59,
-    0x59, 0x59, 0x6d, 0x6d, 0x71, 0x71, 0x87, 0xa6, 0xc0, 0xde, 0xf3, 0xfd,
-    0xfe, 0xfd, 0xfd, 0xde, 0x87, 0x42, 0x2b, 0x19, 0x19, 0x1c, 0x1c, 0x2d,
-    0x9e, 0xe7, 0xf2, 0xd3, 0xb1, 0x5c, 0x10, 0x42, 0x42, 0x2b, 0x10, 0x1c,
-    0x0e, 0x0a, 0x19, 0x0f, 0x0f, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x1f, 0x0f, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x0f, 0x1f, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x1e, 0x1e, 0x0c, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1e, 0x1e, 0x0c,
-    0x04, 0x04, 0x04, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x05, 0x05, 0x05, 0x08, 0x02, 0x02, 0x02, 0x05, 0x02, 0x05, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05,
-    0x05, 0x05, 0x02, 0x02, 0x05, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x05, 0x05, 0x05, 0x0d, 0x1c, 0x0d, 0x0a, 0x0e, 0x1c, 0x0a,
-    0x0a, 0x0a, 0x1c, 0x1c, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x19, 0x1c, 0x19,
-    0x1c, 0x2b, 0x2b, 0x1c, 0x1c, 0x1c, 0x19, 0x1f, 0x1f, 0x1f, 0x1f, 0x2b,
-    0x2b, 0x2b, 0x40, 0x42, 0x59, 0x42, 0x42, 0x27, 0x27, 0x27, 0x27, 0x2b,
-    0x2b, 0x42, 0x41, 0x41, 0x41, 0x34, 0x34, 0x34, 0x34, 0x38, 0x38, 0x42,
-    0x41, 0x41, 0x41, 0x42, 0x42, 0x59, 0x5a, 0x5a, 0x6e, 0x6e, 0x6e, 0x8e,
-    0xc0, 0xda, 0xee, 0xf9, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xf7, 0xa6,
-    0x6d, 0x42, 0x2b, 0x1c, 0x2b, 0x1c, 0x17, 0x49, 0xab, 0xec, 0xf2, 0xf2,
-    0xb1, 0x6f, 0x45, 0x59, 0x59, 0x40, 0x28, 0x2b, 0x1c, 0x1c, 0x1c, 0x0a,
-    0x04, 0x04, 0x04, 0x04, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x1f, 0x1f, 0x1f,
-    0x1f, 0x1f, 0x1c, 0x0e, 0x0a, 0x0f, 0x1f, 0x1f, 0x0f, 0x1f, 0x0f, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x04, 0x04, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x05, 0x08, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02,
-    0x02, 0x08, 0x02, 0x08, 0x02, 0x02, 0x02, 0x05, 0x05, 0x0a, 0x0a, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x19, 0x0b,
-    0x0d, 0x0d, 0x14, 0x14, 0x0d, 0x0d, 0x14, 0x05, 0x05, 0x05, 0x19, 0x19,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x1c, 0x1c, 0x19, 0x1c, 0x2b, 0x2b, 0x1c,
-    0x1c, 0x1c, 0x19, 0x19, 0x27, 0x27, 0x2b, 0x2b, 0x2b, 0x2b, 0x42, 0x42,
-    0x42, 0x42, 0x41, 0x27, 0x27, 0x29, 0x29, 0x29, 0x29, 0x42, 0x42, 0x41,
-    0x41, 0x41, 0x27, 0x27, 0x2b, 0x42, 0x42, 0x42, 0x40, 0x3f, 0x40, 0x5a,
-    0x5a, 0x5a, 0x5a, 0x6e, 0x6e, 0xae, 0xd9, 0xee, 0xf5, 0xfd, 0xfd, 0xff,
-    0xff, 0xfd, 0xff, 0xfd, 0xfd, 0xf7, 0xc7, 0x87, 0x59, 0x2b, 0x2b, 0x2b,
-    0x87, 0x28, 0x45, 0x49, 0xcf, 0xf2, 0xf2, 0xf8, 0xcf, 0xb1, 0x8e, 0x59,
-    0x6d, 0x5a, 0x59, 0x40, 0x40, 0x28, 0x28, 0x1c, 0x0a, 0x0f, 0x05, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0e, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x0e,
-    0x1c, 0x0a, 0x0e, 0x1f, 0x0f, 0x1f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x04,
-    0x04, 0x0f, 0x0f, 0x04, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x05, 0x02,
-    0x02, 0x02, 0x02, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x08, 0x02, 0x05, 0x0a, 0x0a, 0x19, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x08, 0x05, 0x0a, 0x0b, 0x05, 0x0b, 0x0b, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x08, 0x08, 0x05, 0x05, 0x0b, 0x05, 0x0a, 0x19, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x14, 0x1c, 0x17, 0x28, 0x1c,
-    0x14, 0x14, 0x1c, 0x05, 0x05, 0x0a, 0x1c, 0x1c, 0x0a, 0x0a, 0x19, 0x0a,
-    0x0a, 0x1c, 0x2b, 0x1c, 0x2b, 0x42, 0x42, 0x2b, 0x2b, 0x1f, 0x19, 0x27,
-    0x27, 0x1c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x42, 0x42, 0x42, 0x29, 0x29,
-    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x3f, 0x40, 0x28, 0x40, 0x40,
-    0x40, 0x40, 0x40, 0x58, 0x57, 0x57, 0x57, 0x57, 0x6e, 0x88, 0xc7, 0xea,
-    0xf5, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xf5,
-    0xea, 0xa6, 0x87, 0x71, 0x42, 0x2b, 0x27, 0x27, 0x2b, 0x28, 0x45, 0x80,
-    0xe7, 0xf2, 0xe5, 0xfc, 0xf2, 0xb1, 0xb1, 0x40, 0x28, 0x59, 0x5c, 0x45,
-    0x45, 0x42, 0x40, 0x28, 0x1c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x1c, 0x0e,
-    0x0e, 0x1c, 0x0e, 0x0e, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x19, 0x0a, 0x0a,
-    0x0a, 0x1f, 0x0f, 0x0f, 0x0f, 0x04, 0x04, 0x05, 0x04, 0x04, 0x04, 0x04,
-    0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x02, 0x02, 0x00, 0x08, 0x08,
-    0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05,
-    0x0d, 0x0a, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05,
-    0x0b, 0x0d, 0x17, 0x28, 0x0d, 0x0d, 0x05, 0x02, 0x02, 0x02, 0x02, 0x08,
-    0x05, 0x05, 0x0b, 0x0b, 0x19, 0x19, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x08, 0x05, 0x0b, 0x0d, 0x28, 0x28, 0x28, 0x28, 0x1c, 0x0d, 0x0a,
-    0x05, 0x0a, 0x1c, 0x19, 0x1c, 0x1c, 0x2b, 0x19, 0x1c, 0x1c, 0x2b, 0x2b,
-    0x2b, 0x42, 0x42, 0x42, 0x38, 0x1f, 0x27, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x42, 0x42, 0x2b, 0x28, 0x29, 0x25, 0x3d, 0x25, 0x28,
-    0x28, 0x28, 0x3d, 0x3d, 0x3d, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0xa4, 0xa4, 0xd9, 0xe9, 0xf3, 0xf8, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xfe, 0xfe, 0xfa, 0xf3, 0xde, 0xc7, 0xa6, 0xa6, 0x87, 0x71, 0x41,
-    0x2b, 0x2b, 0x19, 0x1c, 0x0e, 0x10, 0x75, 0x9e, 0xf0, 0xf2, 0xd3, 0xfc,
-    0xfc, 0xc8, 0x8a, 0xb1, 0x6d, 0x10, 0x45, 0x45, 0x59, 0x59, 0x42, 0x40,
-    0x40, 0x40, 0x40, 0x40, 0x40, 0x28, 0x10, 0x0e, 0x0a, 0x0a, 0x0a, 0x0a,
-    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x0a, 0x0a, 0x0a, 0x19, 0x0f, 0x0f,
-    0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x08, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x0b, 0x14, 0x1c, 0x17, 0x25,
-    0x25, 0x17, 0x0e, 0x05, 0x02, 0x02, 0x08, 0x02, 0x05, 0x05, 0x0b, 0x05,
-    0x0a, 0x0d, 0x0b, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05,
-    0x0d, 0x28, 0x28, 0x40, 0x40, 0x28, 0x1c, 0x0a, 0x0a, 0x0a, 0x1c, 0x1c,
-    0x2b, 0x2b, 0x42, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x27,
-    0x34, 0x34, 0x2b, 0x1c, 0x2b, 0x42, 0x42, 0x2b, 0x2b, 0x2b, 0x42, 0x42,
-    0x40, 0x28, 0x28, 0x28, 0x25, 0x2c, 0x3d, 0x40, 0x5a, 0x5a, 0x57, 0x57,
-    0x47, 0x47, 0x47, 0x7b, 0xa4, 0xd3, 0xef, 0xef, 0xef, 0xef, 0xfa, 0xfa,
-    0xfd, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfa, 0xea, 0xa6,
-    0x87, 0x87, 0xa0, 0x87, 0x87, 0x71, 0x54, 0x41, 0x27, 0x14, 0x19, 0x0d,
-    0x0e, 0x45, 0x9e, 0xcf, 0xf6, 0xf6, 0xa4, 0xfb, 0xfb, 0xef, 0x9e, 0x75,
-    0xb1, 0x45, 0x10, 0x10, 0x28, 0x42, 0x42, 0x59, 0x5a, 0x5a, 0x40, 0x2d,
-    0x25, 0x25, 0x17, 0x0e, 0x0a, 0x0a, 0x0a, 0x0a, 0x1c, 0x19, 0x1c, 0x1c,
-    0x1c, 0x1c, 0x19, 0x0a, 0x0a, 0x0a, 0x04, 0x05, 0x05, 0x04, 0x04, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x04, 0x02,
-    0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x05, 0x11, 0x11, 0x0b, 0x02, 0x02, 0x02, 0x08, 0x02,
-    0x00, 0x00, 0x02, 0x05, 0x0d, 0x17, 0x25, 0x2d, 0x25, 0x2d, 0x28, 0x1c,
-    0x0b, 0x02, 0x08, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0b, 0x14, 0x02,
-    0x02, 0x02, 0x02, 0x08, 0x05, 0x05, 0x05, 0x14, 0x28, 0x28, 0x17, 0x17,
-    0x28, 0x42, 0x2b, 0x1c, 0x19, 0x0a, 0x1c, 0x2b, 0x2b, 0x2b, 0x2b, 0x42,
-    0x42, 0x2b, 0x1c, 0x2b, 0x2b, 0x2b, 0x2b, 0x27, 0x34, 0x34, 0x2b, 0x2b,
-    0x2b, 0x42, 0x42, 0x42, 0x28, 0x40, 0x40, 0x28, 0x3d, 0x25, 0x3d, 0x58,
-    0x57, 0x57, 0x57, 0x57, 0x49, 0x77, 0xd3, 0xd3, 0xd3, 0xd3, 0xe5, 0xe5,
-    0xd3, 0xc7, 0xdb, 0xef, 0xfa, 0xfd, 0xfd, 0xff, 0xfd, 0xfe, 0xfe, 0xfe,
-    0xfd, 0xfe, 0xfd, 0xfd, 0xee, 0xc0, 0x71, 0x71, 0x71, 0x71, 0x59, 0x6d,
-    0x54, 0x41, 0x41, 0x27, 0x19, 0x19, 0x05, 0x0d, 0x10, 0x8a, 0x83, 0xcf,
-    0xf2, 0xf6, 0xd3, 0xfb, 0xfb, 0xfc, 0xcf, 0x9e, 0x8a, 0xb1, 0x45, 0x10,
-    0x0e, 0x0e, 0x1c, 0x42, 0x5a, 0x58, 0x58, 0x3d, 0x28, 0x17, 0x28, 0x1c,
-    0x05, 0x0a, 0x19, 0x19, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x0e, 0x0a,
-    0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x05, 0x08, 0x05, 0x02, 0x02,
-    0x05, 0x05, 0x0a, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x02, 0x05, 0x05,
-    0x19, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08,
-    0x11, 0x11, 0x0b, 0x0b, 0x0b, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02,
-    0x05, 0x0d, 0x17, 0x25, 0x2c, 0x3b, 0x25, 0x0e, 0x14, 0x0b, 0x05, 0x0a,
-    0x0a, 0x05, 0x05, 0x05, 0x0b, 0x0d, 0x27, 0x11, 0x02, 0x02, 0x02, 0x05,
-    0x05, 0x05, 0x0a, 0x0d, 0x1c, 0x28, 0x17, 0x0e, 0x28, 0x2b, 0x2b, 0x2b,
-    0x19, 0x19, 0x1c, 0x2b, 0x1c, 0x1c, 0x2b, 0x2b, 0x2b, 0x2b, 0x1c, 0x1c,
-    0x2b, 0x2b, 0x2b, 0x27, 0x27, 0x27, 0x2b, 0x2b, 0x42, 0x42, 0x42, 0x40,
-    0x3d, 0x3d, 0x2c, 0x3b, 0x57, 0x57, 0x57, 0x3b, 0x57, 0x57, 0xc8, 0xe5,
-    0xe5, 0xf0, 0xdf, 0xe5, 0xd3, 0xd3, 0xa9, 0xdb, 0xf3, 0xf9, 0xfd, 0xfd,
-    0xfd, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xfd, 0xf4, 0xde, 0xa6,
-    0x87, 0x71, 0x71, 0x54, 0x3f, 0x42, 0x59, 0x42, 0x54, 0x41, 0x1c, 0x14,
-    0x08, 0x08, 0x0a, 0x0e, 0x45, 0x8a, 0x83, 0xcf, 0xf6, 0xf6, 0xd3, 0xf6,
-    0xfb, 0xfb, 0xf2, 0x9e, 0x83, 0x75, 0xb1, 0x45, 0x12, 0x10, 0x0a, 0x1c,
-    0x17, 0x25, 0x25, 0x3d, 0x25, 0x17, 0x17, 0x1c, 0x0d, 0x0d, 0x19, 0x1c,
-    0x2b, 0x2b, 0x28, 0x25, 0x1c, 0x0e, 0x0e, 0x1c, 0x0a, 0x0a, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x02, 0x02,
-    0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x05, 0x05, 0x19, 0x0b, 0x05, 0x0d, 0x0d, 0x0b, 0x14, 0x14, 0x02,
-    0x05, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x08, 0x11, 0x11, 0x18, 0x17,
-    0x29, 0x14, 0x05, 0x02, 0x02, 0x00, 0x08, 0x11, 0x0b, 0x05, 0x0e, 0x10,
-    0x25, 0x2c, 0x25, 0x0e, 0x0b, 0x0d, 0x05, 0x0a, 0x0a, 0x0a, 0x05, 0x05,
-    0x0b, 0x17, 0x29, 0x0b, 0x05, 0x05, 0x05, 0x05, 0x0b, 0x0b, 0x0d, 0x0e,
-    0x0d, 0x17, 0x17, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x19, 0x1c, 0x1c,
-    0x1c, 0x1c, 0x2b, 0x2b, 0x2b, 0x2b, 0x1c, 0x1c, 0x1c, 0x2b, 0x2b, 0x27,
-    0x34, 0x27, 0x2b, 0x2b, 0x28, 0x28, 0x25, 0x2d, 0x57, 0x78, 0x78, 0x57,
-    0x46, 0x47, 0x47, 0xa4, 0xe5, 0xf2, 0xe5, 0xd3, 0xe5, 0xd3, 0xd3, 0xd3,
-    0xe9, 0xf8, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfd,
-    0xff, 0xfe, 0xfd, 0xf3, 0xde, 0x87, 0x71, 0x71, 0x54, 0x54, 0x41, 0x41,
-    0x27, 0x3f, 0x42, 0x42, 0x41, 0x41, 0x28, 0x28, 0x27, 0x27, 0x1c, 0x17,
-    0xae, 0x77, 0x3a, 0xe7, 0xf2, 0xf6, 0xdf, 0xe5, 0xfb, 0xfb, 0xfb, 0xe5,
-    0x83, 0x86, 0x83, 0xcf, 0x49, 0x1d, 0x40, 0x0d, 0x0e, 0x10, 0x17, 0x17,
-    0x17, 0x0e, 0x0e, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x1c, 0x10, 0x25, 0x25,
-    0x28, 0x1c, 0x1c, 0x1c, 0x1c, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x0a, 0x05, 0x05, 0x04, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
-    0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x08, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x0d,
-    0x0d, 0x1c, 0x17, 0x17, 0x0d, 0x0d, 0x14, 0x0b, 0x05, 0x05, 0x08, 0x02,
-    0x08, 0x02, 0x02, 0x11, 0x0b, 0x18, 0x25, 0x25, 0x3d, 0x3d, 0x0e, 0x05,
-    0x02, 0x11, 0x08, 0x11, 0x11, 0x0b, 0x10, 0x17, 0x2c, 0x25, 0x25, 0x17,
-    0x05, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x0d, 0x28, 0x14, 0x14,
-    0x0b, 0x05, 0x05, 0x14, 0x14, 0x1c, 0x1c, 0x28, 0x1c, 0x1c, 0x0e, 0x1c,
-    0x0e, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x0a, 0x1c, 0x1c, 0x1c, 0x1c,
-    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x2b, 0x1f, 0x1f, 0x19, 0x2b, 0x28,
-    0x25, 0x2e, 0x57, 0x78, 0x6e, 0x3b, 0x2c, 0x3b, 0x47, 0x7b, 0x7c, 0xdf,
-    0xdf, 0xdf, 0xf0, 0xe5, 0xd3, 0xef, 0xf8, 0xfc, 0xfc, 0xfc, 0xfd, 0xff,
-    0xff, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xf7, 0xee, 0xc0, 0x71,
-    0x71, 0x54, 0x41, 0x41, 0x41, 0x27, 0x27, 0x27, 0x27, 0x29, 0x2b, 0x42,
-    0x41, 0x41, 0x40, 0x28, 0x42, 0x2b, 0x28, 0x8e, 0xae, 0x49, 0x80, 0xe7,
-    0xf0, 0xf0, 0xe7, 0xb0, 0xf2, 0xf6, 0xf6, 0xf8, 0xcf, 0x85, 0x85, 0x85,
-    0xb3, 0x75, 0x77, 0x2d, 0x2d, 0x1d, 0x12, 0x0e, 0x0e, 0x0e, 0x0a, 0x05,
-    0x05, 0x05, 0x0d, 0x14, 0x2b, 0x28, 0x28, 0x28, 0x17, 0x1c, 0x1c, 0x1c,
-    0x1c, 0x0a, 0x05, 0x05, 0x05, 0x0a, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x05,
-    0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02, 0x08, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x08, 0x02, 0x02, 0x05, 0x05, 0x0b, 0x1c, 0x28, 0x25, 0x17,
-    0x28, 0x18, 0x05, 0x0b, 0x0b, 0x05, 0x02, 0x11, 0x08, 0x11, 0x02, 0x14,
-    0x1b, 0x2a, 0x3b, 0x2c, 0x3b, 0x3d, 0x25, 0x0d, 0x05, 0x08, 0x02, 0x11,
-    0x0b, 0x18, 0x1c, 0x0e, 0x3b, 0x43, 0x25, 0x25, 0x0d, 0x05, 0x1c, 0x1c,
-    0x2b, 0x0a, 0x05, 0x05, 0x1c, 0x17, 0x05, 0x14, 0x14, 0x0b, 0x0b, 0x0d,
-    0x0d, 0x1c, 0x1c, 0x28, 0x28, 0x17, 0x0e, 0x1c, 0x1c, 0x1c, 0x0a, 0x1c,
-    0x19, 0x1c, 0x1c, 0x1c, 0x0e, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x0f, 0x1f,
-    0x0f, 0x1f, 0x1c, 0x1c, 0x1f, 0x1c, 0x17, 0x2c, 0x78, 0xa4, 0x78, 0x2c,
-    0x2c, 0x2c, 0x46, 0x46, 0x47, 0x7c, 0xce, 0xf0, 0xf0, 0xdf, 0xdf, 0xf2,
-    0xfb, 0xfc, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xfd,
-    0xfe, 0xfd, 0xf4, 0xde, 0xd1, 0x71, 0x54, 0x41, 0x41, 0x41, 0x41, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x42, 0x59, 0x54, 0x54, 0x42, 0x42,
-    0x42, 0x42, 0x59, 0xc8, 0x8e, 0x49, 0x80, 0xe7, 0xf0, 0xf0, 0xe4, 0xd0,
-    0xec, 0xf6, 0xf6, 0xf2, 0xf0, 0xcf, 0x85, 0x84, 0x86, 0xcf, 0x9e, 0x9e,
-    0x83, 0x75, 0x3c, 0x21, 0x1d, 0x2d, 0x10, 0x0e, 0x0a, 0x0a, 0x0a, 0x0d,
-    0x1c, 0x17, 0x17, 0x17, 0x1c, 0x0e, 0x0e, 0x1c, 0x0d, 0x0a, 0x05, 0x05,
-    0x05, 0x0a, 0x05, 0x05, 0x0a, 0x0a, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x08, 0x08,
-    0x05, 0x05, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x01,
-    0x01, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05,
-    0x02, 0x08, 0x05, 0x05, 0x0d, 0x28, 0x17, 0x17, 0x29, 0x0b, 0x0b, 0x0b,
-    0x18, 0x0b, 0x05, 0x05, 0x0b, 0x0b, 0x14, 0x29, 0x43, 0x43, 0x3b, 0x2c,
-    0x25, 0x0d, 0x17, 0x0d, 0x18, 0x0d, 0x0d, 0x0b, 0x17, 0x0d, 0x17, 0x25,
-    0x25, 0x43, 0x25, 0x2a, 0x2a, 0x05, 0x0b, 0x14, 0x2b, 0x1c, 0x05, 0x05,
-    0x0d, 0x0d, 0x05, 0x0b, 0x18, 0x1b, 0x1b, 0x05, 0x05, 0x05, 0x14, 0x1c,
-    0x1c, 0x28, 0x28, 0x28, 0x0d, 0x0a, 0x0a, 0x0a, 0x0e, 0x19, 0x1c, 0x1c,
-    0x1f, 0x1f, 0x1f, 0x2b, 0x1c, 0x1c, 0x19, 0x19, 0x19, 0x19, 0x1f, 0x2b,
-    0x1c, 0x25, 0x47, 0xa4, 0x57, 0x25, 0x25, 0x25, 0x3b, 0x47, 0x80, 0x7b,
-    0xdf, 0xf0, 0xf0, 0xe5, 0xef, 0xf8, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xfe, 0xf5, 0xda, 0xa6, 0x54,
-    0x41, 0x41, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x41, 0x54, 0x59, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x8e, 0xae,
-    0x8a, 0x5c, 0x8a, 0xcf, 0xec, 0xec, 0xec, 0xe4, 0xb0, 0xec, 0xf0, 0xf6,
-    0xf0, 0xec, 0xe7, 0xac, 0x85, 0x85, 0xb3, 0x85, 0x84, 0x56, 0x56, 0x31,
-    0x1d, 0x1d, 0x2d, 0x2d, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x10, 0x10,
-    0x10, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x05, 0x0a, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x08, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x08, 0x05, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x08, 0x02, 0x02, 0x08, 0x05, 0x1c, 0x19, 0x05, 0x05, 0x02, 0x05, 0x05,
-    0x0d, 0x28, 0x17, 0x28, 0x29, 0x18, 0x1b, 0x1b, 0x1b, 0x1b, 0x14, 0x05,
-    0x05, 0x05, 0x11, 0x2a, 0x43, 0x46, 0x43, 0x2a, 0x3b, 0x28, 0x0d, 0x0d,
-    0x0d, 0x17, 0x25, 0x2c, 0x3b, 0x17, 0x17, 0x18, 0x25, 0x2a, 0x2a, 0x18,
-    0x0d, 0x05, 0x05, 0x0b, 0x1c, 0x14, 0x0b, 0x0b, 0x05, 0x14, 0x0b, 0x14,
-    0x1b, 0x1b, 0x3f, 0x0b, 0x0b, 0x05, 0x05, 0x0b, 0x28, 0x17, 0x28, 0x28,
-    0x0d, 0x0a, 0x0a, 0x0a, 0x0a, 0x19, 0x19, 0x1c, 0x1f, 0x1f, 0x1f, 0x1c,
-    0x1c, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1c, 0x17, 0x3b, 0x78, 0x80, 0x2e,
-    0x2c, 0x25, 0x18, 0x2c, 0x46, 0xd3, 0xdf, 0xe5, 0xe5, 0xf2, 0xf6, 0xfb,
-    0xf9, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xf7, 0xc0, 0x71, 0x71, 0x41, 0x27, 0x41, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x19, 0x19, 0x27, 0x41, 0x59, 0x59, 0x59, 0x59,
-    0x42, 0x42, 0x42, 0x42, 0x42, 0x59, 0x6d, 0xae, 0x8a, 0x5c, 0x8a, 0xb1,
-    0xcf, 0xec, 0xec, 0xf0, 0xe4, 0xad, 0xe4, 0xf0, 0xf0, 0xf0, 0xe7, 0xe7,
-    0xd0, 0x84, 0x84, 0x9d, 0x9d, 0x84, 0x85, 0x85, 0x83, 0x3a, 0x21, 0x21,
-    0x21, 0x21, 0x21, 0x1d, 0x1d, 0x1d, 0x2d, 0x12, 0x0e, 0x0e, 0x0e, 0x0e,
-    0x0e, 0x0d, 0x0a, 0x0e, 0x0d, 0x0a, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x01, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0b, 0x14,
-    0x05, 0x05, 0x02, 0x02, 0x02, 0x05, 0x05, 0x0b, 0x27, 0x27, 0x05, 0x05,
-    0x0e, 0x28, 0x28, 0x0d, 0x05, 0x0d, 0x0d, 0x1c, 0x28, 0x40, 0x25, 0x25,
-    0x17, 0x18, 0x1b, 0x1b, 0x2a, 0x2a, 0x0b, 0x02, 0x02, 0x02, 0x02, 0x11,
-    0x43, 0x79, 0x43, 0x2a, 0x25, 0x25, 0x17, 0x18, 0x17, 0x17, 0x28, 0x28,
-    0x40, 0x0d, 0x17, 0x28, 0x2a, 0x1b, 0x1b, 0x05, 0x0b, 0x05, 0x05, 0x05,
-    0x1c, 0x14, 0x0b, 0x05, 0x05, 0x0b, 0x14, 0x14, 0x2a, 0x1b, 0x29, 0x29,
-    0x05, 0x05, 0x05, 0x0b, 0x3f, 0x3f, 0x28, 0x28, 0x2b, 0x05, 0x0a, 0x0a,
-    0x05, 0x19, 0x14, 0x1c, 0x2b, 0x38, 0x1f, 0x0f, 0x19, 0x0a, 0x1c, 0x1c,
-    0x0f, 0x1c, 0x2d, 0x47, 0x80, 0x47, 0x12, 0x25, 0x17, 0x25, 0xa9, 0xd3,
-    0xdf, 0xce, 0xab, 0xe5, 0xf8, 0xfb, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xde, 0x71, 0x71,
-    0x87, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x41, 0x42, 0x59, 0x4e, 0x4e, 0x59, 0x59, 0x42, 0x42, 0x42,
-    0x42, 0x42, 0xae, 0x8e, 0x8e, 0x5c, 0x6f, 0x8a, 0x9e, 0xac, 0xe4, 0xe4,
-    0xec, 0xe4, 0xd7, 0xd7, 0xe4, 0xec, 0xec, 0xec, 0xe4, 0xd0, 0x97, 0x8b,
-    0x84, 0x84, 0x86, 0x6a, 0x85, 0xb3, 0x84, 0x84, 0x84, 0x31, 0x21, 0x1d,
-    0x1d, 0x1d, 0x2e, 0x2e, 0x2e, 0x21, 0x3c, 0x21, 0x1d, 0x12, 0x10, 0x10,
-    0x0e, 0x0d, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x01, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0b, 0x05, 0x05, 0x05, 0x02,
-    0x02, 0x05, 0x0a, 0x28, 0x40, 0x54, 0x28, 0x3d, 0x3d, 0x6e, 0x6e, 0x25,
-    0x17, 0x40, 0x40, 0x28, 0x5a, 0x3d, 0x3d, 0x25, 0x17, 0x28, 0x18, 0x18,
-    0x2a, 0x2a, 0x0b, 0x02, 0x02, 0x02, 0x02, 0x11, 0x2a, 0x43, 0x2a, 0x43,
-    0x2a, 0x25, 0x25, 0x18, 0x17, 0x18, 0x0d, 0x29, 0x14, 0x29, 0x05, 0x28,
-    0x18, 0x18, 0x18, 0x0b, 0x0b, 0x0b, 0x05, 0x0b, 0x05, 0x05, 0x0d, 0x0b,
-    0x05, 0x0b, 0x0b, 0x29, 0x0d, 0x0d, 0x0b, 0x54, 0x05, 0x0b, 0x05, 0x0b,
-    0x3f, 0x3f, 0x3f, 0x28, 0x1c, 0x14, 0x0a, 0x05, 0x05, 0x19, 0x19, 0x1c,
-    0x2b, 0x1f, 0x1f, 0x19, 0x04, 0x19, 0x0e, 0x10, 0x1c, 0x28, 0x77, 0x80,
-    0x47, 0x12, 0x28, 0x59, 0xae, 0xc8, 0xab, 0xab, 0xce, 0xdf, 0xf6, 0xfb,
-    0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xfd, 0xff, 0xfd, 0xfd, 0xc4, 0x41, 0x55, 0x87, 0x19, 0x27, 0x19, 0x27,
-    0x27, 0x19, 0x27, 0x19, 0x19, 0x19, 0x19, 0x19, 0x27, 0x41, 0x54, 0x59,
-    0x4e, 0x4e, 0x4e, 0x59, 0x59, 0x59, 0x6d, 0x6d, 0x42, 0x42, 0x6d, 0xc8,
-    0x6d, 0x6d, 0x5c, 0x8a, 0x75, 0x83, 0x85, 0xe4, 0xec, 0xec, 0xe4, 0xe2,
-    0xd7, 0xd7, 0xec, 0xec, 0xec, 0xe2, 0xcc, 0xc5, 0xac, 0x85, 0x85, 0x85,
-    0x56, 0x56, 0x56, 0x84, 0x84, 0x86, 0x86, 0x83, 0x3a, 0x21, 0x1d, 0x21,
-    0x3a, 0x37, 0x31, 0x3a, 0x3c, 0x3c, 0x3c, 0x2d, 0x2d, 0x10, 0x0d, 0x05,
-    0x05, 0x71, 0x71, 0x71, 0x6d, 0x71, 0x71, 0x71, 0x41, 0x02, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x0b,
-    0x0b, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x18, 0x17, 0x17,
-    0x25, 0x6c, 0x58, 0x3d, 0x6e, 0x58, 0x58, 0x17, 0x25, 0x58, 0x5a, 0x3d,
-    0x6e, 0x3d, 0x58, 0x58, 0x17, 0x17, 0x05, 0x18, 0x18, 0x1b, 0x18, 0x11,
-    0x02, 0x02, 0x02, 0x0b, 0x1b, 0x2a, 0x2a, 0x43, 0x79, 0x43, 0x25, 0x18,
-    0x0d, 0x14, 0x0b, 0x02, 0x05, 0x05, 0x05, 0x05, 0x0b, 0x05, 0x29, 0x29,
-    0x11, 0x11, 0x05, 0x05, 0x05, 0x14, 0x05, 0x0b, 0x05, 0x05, 0x05, 0x27,
-    0x14, 0x0d, 0x05, 0x27, 0x27, 0x05, 0x05, 0x05, 0x14, 0x54, 0x54, 0x3f,
-    0x1c, 0x0d, 0x0a, 0x19, 0x0f, 0x0f, 0x19, 0x19, 0x1c, 0x19, 0x19, 0x19,
-    0x04, 0x05, 0x1c, 0x10, 0x3b, 0x47, 0x80, 0x46, 0x2c, 0x6c, 0xc8, 0xae,
-    0x7b, 0x7b, 0x7c, 0xdf, 0xe5, 0xf8, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xc0,
-    0x41, 0x41, 0xa6, 0x19, 0x19, 0x19, 0x19, 0x19, 0x27, 0x27, 0x19, 0x19,
-    0x19, 0x19, 0x1c, 0x1c, 0x42, 0x59, 0x59, 0x59, 0x4e, 0x4e, 0x4e, 0x59,
-    0x59, 0x59, 0x59, 0x59, 0x59, 0x42, 0x42, 0x6d, 0xc8, 0x59, 0x6d, 0x5c,
-    0x77, 0x77, 0x83, 0x83, 0xcf, 0xe7, 0xec, 0xec, 0xe4, 0xe4, 0xd7, 0xd7,
-    0xe4, 0xec, 0xec, 0xe4, 0xd7, 0xd0, 0xad, 0x9d, 0x84, 0x85, 0x6a, 0x37,
-    0x37, 0x37, 0x6a, 0x85, 0x85, 0x84, 0x84, 0x6b, 0x44, 0x31, 0x21, 0x21,
-    0x21, 0x21, 0x2d, 0x2c, 0x3b, 0x49, 0x2d, 0x2d, 0x45, 0xe8, 0xe8, 0xe1,
-    0xe8, 0xe8, 0xe8, 0xea, 0xc0, 0x00, 0x00, 0x02, 0x02, 0x02, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x00, 0x02, 0x02, 0x08, 0x08, 0x0b, 0x05, 0x05, 0x05, 0x08,
-    0x05, 0x08, 0x05, 0x08, 0x05, 0x14, 0x28, 0x17, 0x18, 0x2a, 0x2a, 0x2c,
-    0x58, 0x3d, 0x3d, 0x3f, 0x6c, 0x6c, 0x6d, 0x5a, 0x5a, 0x58, 0x6e, 0x5a,
-    0x17, 0x0e, 0x0b, 0x0b, 0x18, 0x18, 0x1b, 0x14, 0x08, 0x02, 0x02, 0x05,
-    0x18, 0x05, 0x1b, 0x43, 0x43, 0x43, 0x25, 0x0d, 0x0b, 0x14, 0x14, 0x02,
-    0x02, 0x02, 0x02, 0x05, 0x02, 0x02, 0x11, 0x29, 0x11, 0x11, 0x14, 0x14,
-    0x0b, 0x0b, 0x0b, 0x05, 0x0b, 0x05, 0x05, 0x14, 0x1c, 0x0d, 0x05, 0x41,
-    0x27, 0x0b, 0x05, 0x14, 0x1b, 0x3f, 0x6c, 0x54, 0x54, 0x41, 0x1c, 0x41,
-    0x1f, 0x0f, 0x19, 0x19, 0x19, 0x19, 0x0f, 0x04, 0x05, 0x19, 0x10, 0x3d,
-    0x47, 0x7b, 0x2e, 0x78, 0xc7, 0xa9, 0x3b, 0x46, 0x7b, 0x7b, 0xdf, 0xf6,
-    0xfb, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfa, 0xc4, 0x41, 0x41, 0xa6, 0x41, 0x05,
-    0x19, 0x05, 0x19, 0x19, 0x19, 0x27, 0x27, 0x27, 0x27, 0x19, 0x2b, 0x2b,
-    0x59, 0x71, 0x59, 0x6d, 0x72, 0x4e, 0x72, 0x59, 0x59, 0x59, 0x59, 0x6d,
-    0x59, 0x59, 0x2b, 0x42, 0x59, 0xc7, 0xae, 0x8e, 0x6f, 0x6f, 0x6f, 0x75,
-    0x86, 0x83, 0xd0, 0xe7, 0xe7, 0xe4, 0xe2, 0xd7, 0xad, 0xd7, 0xe4, 0xec,
-    0xf0, 0xec, 0xe2, 0xe2, 0xd0, 0xd0, 0xb3, 0x9e, 0x86, 0x6a, 0x37, 0x31,
-    0x31, 0x56, 0x6b, 0x84, 0x84, 0x84, 0x85, 0x56, 0x31, 0x37, 0x1d, 0x12,
-    0x12, 0x1d, 0x3a, 0x3c, 0x3c, 0xe8, 0xe8, 0xe3, 0xe3, 0xe3, 0xe8, 0xe8,
-    0xc7, 0x05, 0x05, 0x05, 0x0e, 0x0d, 0x0e, 0x0e, 0x0a, 0x05, 0x02, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x08, 0x0b, 0x14, 0x08, 0x02, 0x02, 0x08, 0x08, 0x02,
-    0x02, 0x0b, 0x1c, 0x0d, 0x0d, 0x0b, 0x1b, 0x2a, 0x3d, 0x25, 0x17, 0x2a,
-    0x54, 0x54, 0x3f, 0x29, 0x3f, 0x40, 0x40, 0x40, 0x17, 0x0e, 0x0d, 0x05,
-    0x18, 0x18, 0x2a, 0x29, 0x08, 0x02, 0x05, 0x05, 0x11, 0x18, 0x0b, 0x43,
-    0x43, 0x3b, 0x43, 0x2a, 0x0b, 0x14, 0x02, 0x02, 0x02, 0x08, 0x08, 0x02,
-    0x02, 0x02, 0x02, 0x08, 0x08, 0x08, 0x11, 0x14, 0x3f, 0x0b, 0x3f, 0x0b,
-    0x05, 0x05, 0x05, 0x14, 0x2b, 0x0d, 0x05, 0x0a, 0x14, 0x41, 0x29, 0x14,
-    0x29, 0x3f, 0x54, 0x54, 0x54, 0x54, 0x59, 0x27, 0x1f, 0x19, 0x19, 0x19,
-    0x19, 0x0f, 0x0c, 0x0f, 0x1c, 0x17, 0x46, 0x46, 0xa4, 0x78, 0xd9, 0xae,
-    0x58, 0x3b, 0x7b, 0x7b, 0xab, 0xdf, 0xfb, 0xfb, 0xfc, 0xff, 0xfd, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd,
-    0xfd, 0xea, 0x41, 0x27, 0x54, 0x87, 0x19, 0x19, 0x05, 0x19, 0x19, 0x27,
-    0x19, 0x19, 0x27, 0x19, 0x2b, 0x2b, 0x42, 0x59, 0x6d, 0x6d, 0x6d, 0x6d,
-    0x6d, 0x6d, 0x59, 0x59, 0x42, 0x42, 0x38, 0x38, 0x38, 0x38, 0x38, 0x42,
-    0x42, 0x59, 0xee, 0xe8, 0xa0, 0x6d, 0x6f, 0x6f, 0x6f, 0x75, 0x83, 0x85,
-    0xd0, 0xe2, 0xe7, 0xe7, 0xe2, 0xd7, 0x8b, 0xad, 0xe4, 0xec, 0xec, 0xec,
-    0xe4, 0xd7, 0xd7, 0xe2, 0xd0, 0xac, 0xb3, 0x83, 0x37, 0x21, 0x21, 0x37,
-    0x37, 0x6a, 0x85, 0x84, 0x6b, 0x6b, 0x6b, 0x6b, 0x44, 0x31, 0x37, 0x21,
-    0x1d, 0xf1, 0xe3, 0xe3, 0xe1, 0xe1, 0xe1, 0xe8, 0xc8, 0x45, 0x49, 0x49,
-    0x21, 0x1d, 0x12, 0x10, 0x0e, 0x0a, 0x05, 0x01, 0x01, 0x01, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02,
-    0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x05,
-    0x0b, 0x14, 0x02, 0x02, 0x02, 0x08, 0x11, 0x11, 0x08, 0x05, 0x0d, 0x0b,
-    0x0b, 0x0b, 0x0b, 0x29, 0x3f, 0x3f, 0x29, 0x3f, 0x29, 0x14, 0x05, 0x05,
-    0x3f, 0x3f, 0x40, 0x28, 0x0d, 0x14, 0x0d, 0x05, 0x18, 0x18, 0x1b, 0x2a,
-    0x19, 0x02, 0x05, 0x05, 0x02, 0x11, 0x18, 0x2a, 0x43, 0x2a, 0x2a, 0x1b,
-    0x0b, 0x14, 0x08, 0x02, 0x02, 0x08, 0x11, 0x11, 0x02, 0x02, 0x02, 0x02,
-    0x08, 0x08, 0x08, 0x26, 0x3f, 0x14, 0x3f, 0x29, 0x05, 0x05, 0x14, 0x14,
-    0x1c, 0x0d, 0x05, 0x1c, 0x14, 0x27, 0x14, 0x29, 0x1b, 0x3f, 0x54, 0x54,
-    0x41, 0x41, 0x41, 0x19, 0x19, 0x19, 0x0a, 0x0a, 0x0a, 0x0f, 0x1e, 0x1f,
-    0x2b, 0x57, 0x46, 0xa4, 0xe0, 0xe1, 0x6e, 0x40, 0x3b, 0x78, 0x7b, 0xd3,
-    0xf0, 0xfb, 0xfb, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfd, 0xf4, 0x71, 0x41, 0x27,
-    0x41, 0x41, 0x05, 0x19, 0x19, 0x19, 0x05, 0x19, 0x19, 0x19, 0x19, 0x19,
-    0x2b, 0x42, 0x42, 0x6d, 0xa0, 0x8e, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d,
-    0x59, 0x59, 0x4e, 0x38, 0x38, 0x38, 0x38, 0x42, 0x2b, 0x59, 0x8e, 0xe8,
-    0xf5, 0xae, 0x8e, 0x59, 0x5c, 0x6f, 0x75, 0x6a, 0x86, 0xb3, 0xcf, 0xe7,
-    0xe2, 0xe2, 0xe2, 0xd0, 0xad, 0xad, 0xe4, 0xe4, 0xec, 0xec, 0xe4, 0xd7,
-    0xad, 0xd0, 0xd0, 0xcf, 0xb3, 0x9e, 0x9e, 0x6a, 0x37, 0x37, 0x37, 0x31,
-    0x56, 0x84, 0x9d, 0x6b, 0x6b, 0x56, 0x56, 0x56, 0x37, 0xb3, 0x9e, 0x9e,
-    0x8a, 0x8a, 0x8a, 0xb1, 0x75, 0x3a, 0x3a, 0x21, 0x3a, 0x3c, 0x75, 0x77,
-    0x49, 0x2d, 0x0e, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x0b, 0x0b, 0x14, 0x05, 0x02,
-    0x02, 0x02, 0x11, 0x14, 0x08, 0x05, 0x0d, 0x0a, 0x0d, 0x05, 0x05, 0x14,
-    0x40, 0x17, 0x28, 0x29, 0x27, 0x0b, 0x05, 0x05, 0x2a, 0x6c, 0x58, 0x3d,
-    0x17, 0x1c, 0x05, 0x05, 0x0b, 0x0b, 0x18, 0x18, 0x19, 0x08, 0x05, 0x05,
-    0x02, 0x11, 0x18, 0x2a, 0x43, 0x1b, 0x43, 0x05, 0x05, 0x11, 0x08, 0x02,
-    0x08, 0x11, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x11,
-    0x29, 0x14, 0x0b, 0x0b, 0x05, 0x0b, 0x05, 0x05, 0x1c, 0x2b, 0x14, 0x14,
-    0x27, 0x14, 0x29, 0x14, 0x27, 0x3f, 0x54, 0x54, 0x42, 0x19, 0x05, 0x19,
-    0x04, 0x19, 0x0a, 0x0b, 0x19, 0x19, 0x1c, 0x1c, 0x58, 0x57, 0xc8, 0xe0,
-    0x8e, 0x40, 0x28, 0x25, 0x78, 0x47, 0xab, 0xf6, 0xfb, 0xfb, 0xfc, 0xfd,
-    0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xfe, 0xfe, 0xfd, 0xfe, 0xa6, 0x27, 0x27, 0x27, 0x41, 0x27, 0x27, 0x19,
-    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1f, 0x42, 0x2b, 0x2b, 0x59,
-    0x6d, 0x6d, 0x6d, 0x59, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4e, 0x4e,
-    0x4e, 0x38, 0x38, 0x42, 0x2b, 0x42, 0x6d, 0x6d, 0xd9, 0xf3, 0xd9, 0x6d,
-    0x40, 0x40, 0x5c, 0x4c, 0x75, 0x75, 0x86, 0xb3, 0xd0, 0xe2, 0xe7, 0xe2,
-    0xe2, 0xd7, 0xad, 0xad, 0xcc, 0xd7, 0xe4, 0xe4, 0xec, 0xe4, 0xad, 0xad,
-    0xd0, 0xd0, 0xd0, 0xac, 0xb3, 0x86, 0x56, 0x37, 0x37, 0x21, 0x37, 0x31,
-    0x56, 0x56, 0x56, 0x56, 0x44, 0x6b, 0x6b, 0x6b, 0x56, 0x56, 0x31, 0x31,
-    0x21, 0x1d, 0x12, 0x1d, 0x49, 0x49, 0x49, 0x57, 0x46, 0x2e, 0x47, 0x47,
-    0x49, 0x49, 0x1d, 0x12, 0x10, 0x0e, 0x0e, 0x0a, 0x02, 0x01, 0x01, 0x01,
-    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02,
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x08, 0x08, 0x08,
-    0x02, 0x02, 0x02, 0x0b, 0x0b, 0x05, 0x05, 0x08, 0x02, 0x02, 0x11, 0x14,
-    0x08, 0x05, 0x0d, 0x0d, 0x0a, 0x0b, 0x05, 0x14, 0x14, 0x0b, 0x0d, 0x0b,
-    0x0b, 0x05, 0x05, 0x05, 0x18, 0x3b, 0x3d, 0x58, 0x3d, 0x18, 0x0d, 0x05,
-    0x14, 0x0b, 0x05, 0x0b, 0x02, 0x02, 0x05, 0x05, 0x08, 0x08, 0x11, 0x18,
-    0x43, 0x43, 0x43, 0x43, 0x08, 0x02, 0x02, 0x11, 0x11, 0x11, 0x11, 0x02,
-    0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x08, 0x02, 0x02, 0x29, 0x29, 0x0b,
-    0x14, 0x14, 0x19, 0x0a, 0x0d, 0x1c, 0x0b, 0x27, 0x29, 0x0b, 0x14, 0x41,
-    0x41, 0x41, 0x41, 0x2b, 0x19, 0x05, 0x05, 0x05, 0x04, 0x05, 0x05, 0x19,
-    0x19, 0x19, 0x1c, 0x5a, 0xae, 0xe0, 0xae, 0x5a, 0x40, 0x40, 0x25, 0x6e,
-    0x47, 0xab, 0xf2, 0xfb, 0xfc, 0xf9, 0xf9, 0xfd, 0xff, 0xfe, 0xfe, 0xfe,
-    0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf3,
-    0x27, 0x27, 0x27, 0x19, 0x27, 0x27, 0x27, 0x14, 0x19, 0x19, 0x19, 0x19,
-    0x19, 0x19, 0x1f, 0x1f, 0x1c, 0x1c, 0x1c, 0x59, 0x6d, 0x59, 0x59, 0x59,
-    0x42, 0x59, 0x42, 0x42, 0x59, 0x6d, 0x6d, 0x59, 0x4e, 0x38, 0x38, 0x42,
-    0x42, 0x42, 0x59, 0xae, 0xae, 0x8e, 0xea, 0xee, 0x8e, 0x59, 0x59, 0x6d,
-    0x6f, 0x6f, 0x75, 0x86, 0x86, 0x85, 0xd0, 0xe2, 0xe7, 0xe2, 0xdc, 0xdc,
-    0xc1, 0x93, 0xad, 0xd7, 0xe4, 0xe4, 0xe4, 0xe2, 0xcc, 0x93, 0xad, 0xc5,
-    0xd0, 0xac, 0xac, 0xb3, 0x86, 0x6a, 0x6a, 0x37, 0x37, 0x21, 0x31, 0x31,
-    0x44, 0x6b, 0x6b, 0x6b, 0x44, 0x44, 0x44, 0x84, 0x84, 0x56, 0x31, 0x21,
-    0x12, 0x12, 0x12, 0x12, 0x1d, 0x47, 0x47, 0x3a, 0x3a, 0x3c, 0x21, 0x3c,
-    0x49, 0x49, 0x49, 0x2d, 0x10, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x05,
-    0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x05, 0x08, 0x08, 0x08, 0x02, 0x02, 0x05,
-    0x05, 0x05, 0x05, 0x08, 0x08, 0x11, 0x11, 0x11, 0x11, 0x02, 0x05, 0x0b,
-    0x0b, 0x14, 0x0b, 0x0b, 0x0b, 0x05, 0x0b, 0x0b, 0x08, 0x02, 0x05, 0x17,
-    0x3b, 0x3b, 0x2c, 0x3b, 0x3b, 0x3d, 0x14, 0x14, 0x14, 0x0b, 0x05, 0x11,
-    0x02, 0x02, 0x01, 0x02, 0x02, 0x08, 0x14, 0x11, 0x0b, 0x2a, 0x2a, 0x18,
-    0x43, 0x11, 0x02, 0x11, 0x24, 0x24, 0x11, 0x08, 0x02, 0x02, 0x02, 0x02,
-    0x08, 0x02, 0x02, 0x08, 0x08, 0x08, 0x14, 0x14, 0x1c, 0x14, 0x19, 0x05,
-    0x0a, 0x1c, 0x0b, 0x14, 0x14, 0x27, 0x27, 0x05, 0x27, 0x19, 0x19, 0x0a,
-    0x05, 0x0f, 0x05, 0x05, 0x05, 0x05, 0x0a, 0x0a, 0x0f, 0x27, 0x6d, 0xef,
-    0xe9, 0x78, 0x28, 0x2b, 0x42, 0x28, 0x57, 0x46, 0xab, 0xf0, 0xfb, 0xfc,
-    0xfc, 0xf9, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
-    0xff, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfe, 0xc7, 0x27, 0x27, 0x19, 0x27,
-    0x41, 0x27, 0x27, 0x27, 0x27, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0f, 0x1f,
-    0x1c, 0x1c, 0x1c, 0x4e, 0x6d, 0x59, 0x59, 0x42, 0x38, 0x42, 0x2b, 0x2b,
-    0x2b, 0x42, 0x42, 0x59, 0x59, 0x59, 0x59, 0x42, 0x42, 0x59, 0x42, 0x6d,
-    0x59, 0x40, 0x6d, 0xd9, 0xee, 0xe3, 0x6d, 0x59, 0x5c, 0x77, 0x75, 0x75,
-    0x75, 0x75, 0x86, 0xb3, 0xac, 0xdc, 0xe2, 0xe2, 0xdc, 0xdc, 0xcc, 0x93,
-    0x93, 0xc9, 0xe2, 0xe2, 0xe2, 0xe4, 0xe4, 0xd7, 0xad, 0xad, 0xcc, 0xdc,
-    0xc5, 0x9d, 0x84, 0x85, 0x56, 0x56, 0x31, 0x21, 0x1d, 0x1d, 0x37, 0x3a,
-    0x31, 0x31, 0x56, 0x84, 0x44, 0x44, 0x6b, 0x6b, 0x84, 0x84, 0x56, 0x31,
-    0x21, 0x1d, 0x12, 0x12, 0x0e, 0x25, 0x57, 0x57, 0x57, 0x57, 0x3b, 0x2d,
-    0x47, 0x49, 0x4c, 0x49, 0x45, 0x12, 0x0e, 0x0e, 0x0e, 0x0e, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x05, 0x08, 0x11, 0x02, 0x02, 0x02, 0x02, 0x05, 0x0b, 0x14, 0x05,
-    0x08, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0b, 0x05, 0x14, 0x14, 0x14, 0x11,
-    0x05, 0x08, 0x11, 0x08, 0x11, 0x05, 0x0b, 0x28, 0x2c, 0x25, 0x2c, 0x17,
-    0x18, 0x18, 0x18, 0x14, 0x14, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
-    0x01, 0x02, 0x08, 0x11, 0x02, 0x26, 0x2a, 0x26, 0x11, 0x26, 0x26, 0x11,
-    0x26, 0x3f, 0x3e, 0x24, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x05, 0x14, 0x14, 0x14, 0x19, 0x19, 0x2b, 0x1c, 0x0b, 0x0d,
-    0x14, 0x19, 0x19, 0x05, 0x05, 0x05, 0x0a, 0x05, 0x04, 0x04, 0x05, 0x05,
-    0x05, 0x05, 0x0f, 0x1f, 0x34, 0xc0, 0xee, 0xae, 0x6e, 0x58, 0x2b, 0x42,
-    0x2b, 0x3d, 0x7b, 0x7b, 0xe5, 0xfb, 0xfc, 0xf9, 0xf3, 0xfd, 0xfe, 0xfe,
-    0xff, 0xff, 0xfd, 0xfd, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe,
-    0xfd, 0xfe, 0xfd, 0x71, 0x27, 0x27, 0x14, 0x27, 0x27, 0x27, 0x14, 0x27,
-    0x27, 0x19, 0x19, 0x19, 0x19, 0x27, 0x1f, 0x1f, 0x1c, 0x1c, 0x1c, 0x4e,
-    0x6d, 0x59, 0x59, 0x42, 0x38, 0x42, 0x38, 0x2b, 0x2b, 0x42, 0x42, 0x42,
-    0x42, 0x2b, 0x59, 0x59, 0x42, 0x42, 0x42, 0x42, 0x2b, 0x1c, 0x42, 0x2b,
-    0x42, 0xc7, 0xf3, 0xc7, 0x6e, 0x45, 0x5c, 0x6f, 0x6f, 0x6f, 0x75, 0x86,
-    0x86, 0x84, 0xac, 0xd0, 0xe2, 0xe2, 0xdc, 0xdc, 0xc1, 0xbe, 0x93, 0x93,
-    0xcc, 0xd7, 0xd7, 0xd7, 0xe4, 0xd7, 0xcc, 0x9b, 0x93, 0xcc, 0xdc, 0xc5,
-    0x9d, 0x84, 0x85, 0x31, 0x37, 0x3c, 0x3c, 0x21, 0x1d, 0x1d, 0x21, 0x56,
-    0x31, 0x56, 0x6b, 0x6b, 0x6b, 0x44, 0x6b, 0x84, 0x84, 0x85, 0x6a, 0x3a,
-    0x21, 0x12, 0x12, 0x12, 0x10, 0x12, 0x2e, 0x47, 0x80, 0x47, 0x3a, 0x3c,
-    0x1d, 0x1d, 0x4c, 0x5c, 0x5c, 0x45, 0x2d, 0x10, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0b, 0x14, 0x14,
-    0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x27, 0x14, 0x14, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x14, 0x05, 0x08, 0x02, 0x08, 0x02, 0x02, 0x11, 0x11, 0x08,
-    0x11, 0x14, 0x0d, 0x18, 0x25, 0x2c, 0x3b, 0x17, 0x0d, 0x18, 0x0d, 0x0b,
-    0x08, 0x02, 0x02, 0x02, 0x11, 0x11, 0x02, 0x01, 0x01, 0x02, 0x02, 0x11,
-    0x26, 0x11, 0x02, 0x11, 0x26, 0x08, 0x29, 0x3f, 0x26, 0x3f, 0x26, 0x3f,
-    0x26, 0x08, 0x02, 0x02, 0x08, 0x08, 0x02, 0x08, 0x02, 0x08, 0x05, 0x05,
-    0x05, 0x1c, 0x1c, 0x1c, 0x2b, 0x2b, 0x1c, 0x05, 0x05, 0x05, 0x19, 0x05,
-    0x05, 0x04, 0x0f, 0x0f, 0x05, 0x05, 0x05, 0x05, 0x19, 0x19, 0x1e, 0x4b,
-    0xe1, 0xe8, 0x78, 0xa4, 0x40, 0x42, 0x42, 0x2b, 0x25, 0x78, 0x2c, 0xe5,
-    0xfb, 0xfc, 0xfc, 0xf9, 0xfd, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xfd,
-    0xf9, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xf3, 0x27,
-    0x27, 0x27, 0x0b, 0x14, 0x29, 0x3f, 0x14, 0x27, 0x27, 0x19, 0x19, 0x19,
-    0x27, 0x27, 0x27, 0x27, 0x1c, 0x1c, 0x1c, 0x4e, 0x59, 0x59, 0x59, 0x42,
-    0x38, 0x42, 0x42, 0x2b, 0x42, 0x42, 0x42, 0x42, 0x42, 0x2b, 0x2b, 0x2b,
-    0x42, 0x42, 0x42, 0x42, 0x2b, 0x42, 0x42, 0x1c, 0x0a, 0x0a, 0x6d, 0xd9,
-    0xee, 0xc7, 0x59, 0x40, 0x5c, 0x6f, 0x75, 0x75, 0x75, 0x83, 0x86, 0x86,
-    0x84, 0xd0, 0xe2, 0xe2, 0xe2, 0xdc, 0xc5, 0xc1, 0x94, 0x93, 0xbe, 0xcc,
-    0xdc, 0xe2, 0xd7, 0xe2, 0xe2, 0xcc, 0x93, 0x93, 0xcc, 0xc1, 0xc5, 0x9d,
-    0x9d, 0x84, 0x56, 0x31, 0x31, 0x37, 0x37, 0x21, 0x1d, 0x1d, 0x1d, 0x21,
-    0x37, 0x56, 0x56, 0x56, 0x56, 0x6b, 0x6b, 0x6b, 0x9d, 0x9d, 0x84, 0x56,
-    0x31, 0x21, 0x1d, 0x1d, 0x12, 0x10, 0x10, 0x2d, 0x57, 0x78, 0x57, 0x57,
-    0x2c, 0x0e, 0x2d, 0x49, 0x49, 0x4c, 0x4c, 0x1d, 0x1d, 0x12, 0x10, 0x0e,
-    0x0e, 0x0a, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0b, 0x14, 0x29, 0x14, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x05, 0x0a, 0x0d, 0x0d, 0x14, 0x11, 0x11, 0x11, 0x24, 0x27, 0x08,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x02, 0x11, 0x11, 0x14, 0x17,
-    0x25, 0x17, 0x18, 0x2a, 0x18, 0x43, 0x0d, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x11, 0x24, 0x26, 0x11, 0x26,
-    0x26, 0x26, 0x11, 0x11, 0x29, 0x3f, 0x11, 0x3f, 0x3f, 0x26, 0x11, 0x02,
-    0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0a, 0x19, 0x1c, 0x2b,
-    0x2b, 0x19, 0x0a, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x0f, 0x04, 0x04, 0x04,
-    0x05, 0x05, 0x05, 0x05, 0x19, 0x42, 0xa0, 0xeb, 0xe1, 0x58, 0x78, 0x57,
-    0x2b, 0x2b, 0x2b, 0x25, 0x78, 0x2c, 0xd3, 0xfb, 0xfc, 0xfc, 0xf9, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfd, 0xfe, 0xfe, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xee, 0x41, 0x27, 0x14, 0x0b, 0x27,
-    0x27, 0x14, 0x14, 0x27, 0x27, 0x19, 0x19, 0x19, 0x19, 0x27, 0x27, 0x27,
-    0x1c, 0x1c, 0x1c, 0x38, 0x59, 0x59, 0x59, 0x42, 0x42, 0x42, 0x42, 0x42,
-    0x42, 0x2b, 0x2b, 0x42, 0x2b, 0x2b, 0x2b, 0x1c, 0x2b, 0x2b, 0x42, 0x42,
-    0x59, 0x42, 0x2b, 0x2b, 0x1c, 0x0a, 0x1c, 0x2b, 0xa0, 0xda, 0xea, 0xc7,
-    0x59, 0x45, 0x45, 0x5c, 0x8a, 0x8a, 0x75, 0x75, 0x86, 0x86, 0x84, 0xac,
-    0xd0, 0xe2, 0xdc, 0xdc, 0xd2, 0xc1, 0x94, 0x94, 0x93, 0xc1, 0xcc, 0xdc,
-    0xe2, 0xdc, 0xe2, 0xdc, 0xc9, 0xbe, 0x93, 0x94, 0xc1, 0xc5, 0x9d, 0x9d,
-    0x84, 0x56, 0x31, 0x37, 0x3a, 0x21, 0x1d, 0x12, 0x1d, 0x1d, 0x21, 0x37,
-    0x31, 0x56, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x84, 0x85, 0x85, 0x85,
-    0x3c, 0x3c, 0x1d, 0x12, 0x12, 0x12, 0x12, 0x12, 0x46, 0x57, 0x49, 0x49,
-    0x3c, 0x1d, 0x12, 0x1d, 0x3c, 0x4c, 0x4c, 0x4c, 0x1d, 0x10, 0x0a, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0d, 0x0d, 0x14, 0x0b, 0x0b, 0x0b, 0x05, 0x05, 0x05, 0x0d, 0x0d, 0x0e,
-    0x17, 0x28, 0x1b, 0x02, 0x00, 0x11, 0x11, 0x08, 0x08, 0x08, 0x08, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x11, 0x14, 0x28, 0x28, 0x28, 0x0e, 0x0b, 0x0b,
-    0x18, 0x2a, 0x0b, 0x0b, 0x08, 0x02, 0x02, 0x11, 0x43, 0x18, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x00, 0x11, 0x24, 0x26, 0x11, 0x26, 0x0b, 0x0b, 0x14,
-    0x05, 0x11, 0x26, 0x11, 0x26, 0x3f, 0x26, 0x02, 0x02, 0x02, 0x02, 0x08,
-    0x05, 0x27, 0x19, 0x05, 0x0a, 0x0a, 0x0a, 0x1c, 0x19, 0x0a, 0x0a, 0x0a,
-    0x05, 0x05, 0x05, 0x05, 0x0f, 0x04, 0x04, 0x04, 0x05, 0x05, 0x08, 0x27,
-    0x54, 0xe1, 0xf5, 0xd9, 0x57, 0x57, 0x8e, 0x40, 0x2b, 0x42, 0x28, 0x57,
-    0x46, 0x7b, 0xf8, 0xfc, 0xfc, 0xf7, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xf9, 0xf7, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0xda, 0x27, 0x27, 0x14, 0x0b, 0x14, 0x27, 0x3f, 0x41, 0x14,
-    0x27, 0x19, 0x19, 0x19, 0x19, 0x19, 0x27, 0x27, 0x1c, 0x1c, 0x1c, 0x2b,
-    0x42, 0x59, 0x42, 0x42, 0x42, 0x42, 0x42, 0x2b, 0x42, 0x42, 0x2b, 0x2b,
-    0x2b, 0x42, 0x42, 0x2b, 0x1c, 0x2b, 0x40, 0x28, 0x42, 0x59, 0x42, 0x1c,
-    0x2b, 0x1c, 0x0a, 0x05, 0x05, 0x0b, 0x87, 0xea, 0xe1, 0x8e, 0x40, 0x28,
-    0x59, 0x5c, 0x6f, 0x8a, 0x75, 0x75, 0x75, 0x86, 0x86, 0x84, 0x9d, 0xc5,
-    0xdc, 0xdc, 0xdc, 0xd2, 0xbe, 0x94, 0x94, 0x94, 0xc1, 0xd2, 0xd2, 0xcc,
-    0xdc, 0xdc, 0xdc, 0xd2, 0xc1, 0x93, 0x97, 0xc5, 0xc1, 0xc1, 0x9d, 0x9d,
-    0x84, 0x56, 0x31, 0x31, 0x37, 0x21, 0x21, 0x1d, 0x12, 0x1d, 0x1d, 0x1d,
-    0x21, 0x31, 0x6a, 0x56, 0x56, 0x56, 0x56, 0x44, 0x6b, 0x84, 0x84, 0xac,
-    0x85, 0x56, 0x31, 0x21, 0x1d, 0x12, 0x12, 0x10, 0x12, 0x3b, 0x58, 0x57,
-    0x57, 0x3b, 0x12, 0x0e, 0x1d, 0x47, 0x3a, 0x49, 0x4c, 0x1d, 0x1d, 0x12,
-    0x0e, 0x0e, 0x0a, 0x05, 0x02, 0x02, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x0d, 0x28, 0x0d,
-    0x0d, 0x0b, 0x0b, 0x0b, 0x0a, 0x0e, 0x28, 0x17, 0x17, 0x0e, 0x28, 0x05,
-    0x02, 0x11, 0x11, 0x11, 0x02, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x05, 0x0d, 0x1c, 0x0d, 0x0d, 0x18, 0x18, 0x18, 0x18, 0x2a, 0x3f,
-    0x14, 0x02, 0x02, 0x11, 0x6c, 0x0b, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x00, 0x24, 0x26, 0x11, 0x18, 0x14, 0x0b, 0x05, 0x0b, 0x29, 0x29,
-    0x02, 0x11, 0x26, 0x27, 0x08, 0x02, 0x08, 0x02, 0x05, 0x05, 0x19, 0x0a,
-    0x05, 0x0a, 0x0a, 0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x04, 0x05, 0x05, 0x05, 0x19, 0x41, 0x71, 0xee, 0xf5, 0xc8, 0x58,
-    0x46, 0x78, 0x5a, 0x40, 0x2b, 0x42, 0x25, 0x78, 0x46, 0xe5, 0xfc, 0xfc,
-    0xfd, 0xf7, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xf7, 0xf7,
-    0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xda, 0x27,
-    0x27, 0x29, 0x14, 0x1b, 0x29, 0x3f, 0x27, 0x27, 0x27, 0x14, 0x19, 0x19,
-    0x19, 0x19, 0x27, 0x27, 0x1c, 0x1c, 0x2b, 0x2b, 0x42, 0x42, 0x42, 0x42,
-    0x42, 0x42, 0x42, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x27, 0x27, 0x1c, 0x1c,
-    0x2b, 0x42, 0x28, 0x28, 0x42, 0x59, 0x42, 0x42, 0x2b, 0x1c, 0x0a, 0x05,
-    0x02, 0x02, 0x11, 0x14, 0x87, 0xd9, 0xc7, 0xa6, 0x42, 0x59, 0x45, 0x45,
-    0x6f, 0x8a, 0x6f, 0x75, 0x86, 0x86, 0x86, 0x84, 0x84, 0xc5, 0xdc, 0xdc,
-    0xdc, 0xd2, 0xd2, 0x94, 0x94, 0x94, 0x94, 0xc1, 0xd2, 0xcc, 0xdc, 0xdc,
-    0xdc, 0xdc, 0xd2, 0xc1, 0x93, 0x93, 0xc1, 0xc1, 0xc5, 0x9d, 0x9d, 0x84,
-    0x56, 0x31, 0x21, 0x3c, 0x3c, 0x21, 0x1d, 0x12, 0x12, 0x12, 0x1d, 0x21,
-    0x21, 0x31, 0x31, 0x56, 0x56, 0x44, 0x44, 0x44, 0x44, 0x56, 0x84, 0xac,
-    0xb3, 0x86, 0x6a, 0x3a, 0x1d, 0x10, 0x0e, 0x0e, 0x0e, 0x12, 0x46, 0x57,
-    0x49, 0x49, 0x49, 0x21, 0x1d, 0x1d, 0x3c, 0x4c, 0x4c, 0x4c, 0x2d, 0x12,
-    0x0a, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0d, 0x14, 0x0b, 0x05, 0x0b, 0x27, 0x0b, 0x05,
-    0x05, 0x1c, 0x28, 0x17, 0x0d, 0x28, 0x28, 0x0b, 0x02, 0x00, 0x11, 0x11,
-    0x26, 0x26, 0x24, 0x26, 0x11, 0x02, 0x02, 0x02, 0x05, 0x0b, 0x0d, 0x17,
-    0x0b, 0x0b, 0x2a, 0x1b, 0x18, 0x0b, 0x05, 0x1b, 0x3f, 0x29, 0x11, 0x05,
-    0x79, 0x46, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x3e, 0x26, 0x29, 0x0b, 0x02, 0x02, 0x14, 0x29, 0x11, 0x02, 0x02, 0x02,
-    0x08, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0a, 0x0a, 0x04, 0x05, 0x05, 0x05,
-    0x19, 0x27, 0x54, 0xee, 0xf3, 0x8e, 0x8e, 0x2d, 0x2e, 0x80, 0x28, 0x2b,
-    0x2b, 0x28, 0x78, 0x46, 0xab, 0xfb, 0xfc, 0xff, 0xfd, 0xfd, 0xfd, 0xfd,
-    0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xfd, 0xf3, 0xfd, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xda, 0x27, 0x41, 0x14, 0x17, 0x18,
-    0x2a, 0x3f, 0x41, 0x14, 0x29, 0x3f, 0x41, 0x19, 0x05, 0x19, 0x19, 0x27,
-    0x1c, 0x1c, 0x2b, 0x1c, 0x2b, 0x42, 0x59, 0x42, 0x42, 0x42, 0x42, 0x2b,
-    0x2b, 0x27, 0x27, 0x19, 0x19, 0x19, 0x1c, 0x1c, 0x2b, 0x2b, 0x42, 0x42,
-    0x59, 0x42, 0x40, 0x59, 0x59, 0x42, 0x1c, 0x05, 0x05, 0x02, 0x02, 0x02,
-    0x05, 0x19, 0x54, 0xc0, 0xee, 0xae, 0x40, 0x28, 0x45, 0x45, 0x6f, 0x8a,
-    0x75, 0x75, 0x75, 0x6a, 0x6a, 0x86, 0x84, 0x9d, 0xc5, 0xdc, 0xdc, 0xdc,
-    0xc1, 0xc1, 0x94, 0x94, 0x94, 0x94, 0xbe, 0xd2, 0xd2, 0xd2, 0xd2, 0xdc,
-    0xdc, 0xd2, 0xc1, 0x93, 0x93, 0xc1, 0x97, 0xc5, 0x9d, 0x9d, 0x9d, 0x84,
-    0x56, 0x31, 0x31, 0x37, 0x21, 0x21, 0x1d, 0x12, 0x12, 0x12, 0x12, 0x12,
-    0x12, 0x1d, 0x37, 0x31, 0x56, 0x56, 0x56, 0x44, 0x44, 0x44, 0x6b, 0x84,
-    0xac, 0xac, 0x56, 0x44, 0x31, 0x21, 0x12, 0x10, 0x0e, 0x0a, 0x0d, 0x3d,
-    0x57, 0x57, 0x57, 0x57, 0x3b, 0x12, 0x12, 0x49, 0x49, 0x49, 0x49, 0x49,
-    0x1d, 0x12, 0x10, 0x10, 0x0e, 0x0d, 0x05, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x00, 0x01, 0x01, 0x01, 0x00,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x02, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00,
-    0x0b, 0x0b, 0x14, 0x05, 0x05, 0x27, 0x14, 0x0b, 0x0b, 0x0b, 0x14, 0x28,
-    0x0d, 0x28, 0x14, 0x14, 0x02, 0x00, 0x00, 0x11, 0x24, 0x26, 0x26, 0x11,
-    0x11, 0x11, 0x08, 0x02, 0x19, 0x14, 0x0b, 0x1b, 0x14, 0x14, 0x43, 0x2a,
-    0x0b, 0x05, 0x05, 0x0b, 0x1b, 0x0b, 0x0b, 0x3e, 0x46, 0x05, 0x02, 0x01,
-    0x01, 0x02, 0x00, 0x00, 0x02, 0x01, 0x02, 0x02, 0x3e, 0x3e, 0x08, 0x08,
-    0x05, 0x02, 0x11, 0x3f, 0x11, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x08, 0x05, 0x02,
-    0x08, 0x08, 0x05, 0x05, 0x05, 0x02, 0x08, 0x19, 0x27, 0x54, 0xea, 0xe1,
-    0x6d, 0x6d, 0x40, 0x2d, 0x80, 0x49, 0x2b, 0x1f, 0x2b, 0x25, 0x7b, 0x7b,
-    0xf8, 0xfc, 0xf9, 0xf9, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff,
-    0xfd, 0xfd, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xfd, 0xf9, 0xda, 0x41, 0x2b, 0x28, 0x29, 0x2a, 0x2a, 0x3f, 0x29, 0x27,
-    0x29, 0x3f, 0x41, 0x27, 0x27, 0x19, 0x05, 0x19, 0x1c, 0x1c, 0x1c, 0x1c,
-    0x1c, 0x2b, 0x42, 0x42, 0x42, 0x42, 0x2b, 0x2b, 0x2b, 0x19, 0x1c, 0x27,
-    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x2b, 0x42, 0x42, 0x2b, 0x42, 0x28,
-    0x40, 0x40, 0x42, 0x1c, 0x05, 0x02, 0x05, 0x05, 0x02, 0x02, 0x02, 0x08,
-    0x87, 0xde, 0xc7, 0xc7, 0x6d, 0x10, 0x45, 0x12, 0x5c, 0x8a, 0x8a, 0x75,
-    0x75, 0x75, 0x86, 0x86, 0x84, 0x84, 0x9d, 0xc5, 0xdc, 0xd2, 0xd2, 0xc1,
-    0xbe, 0x94, 0x93, 0x8f, 0x94, 0xc1, 0xd2, 0xc1, 0xd2, 0xd2, 0xd2, 0xdc,
-    0xd2, 0xc1, 0x94, 0x93, 0x93, 0xc1, 0x97, 0xc5, 0x9d, 0x9d, 0x84, 0x56,
-    0x56, 0x21, 0x37, 0x3a, 0x21, 0x1d, 0x12, 0x0e, 0x0d, 0x0e, 0x12, 0x1d,
-    0x1d, 0x21, 0x37, 0x31, 0x56, 0x56, 0x56, 0x44, 0x44, 0x44, 0x6b, 0x84,
-    0x84, 0xac, 0x85, 0x3a, 0x21, 0x12, 0x10, 0x0e, 0x0e, 0x0e, 0x0d, 0x0a,
-    0x25, 0x57, 0x57, 0x49, 0x49, 0x49, 0x21, 0x1d, 0x21, 0x49, 0x4c, 0x4c,
-    0x4c, 0x45, 0x2d, 0x10, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x02, 0x02, 0x08, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x05, 0x0b, 0x14, 0x05,
-    0x05, 0x08, 0x0b, 0x05, 0x05, 0x0b, 0x05, 0x05, 0x05, 0x0d, 0x14, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x11, 0x11, 0x11, 0x24, 0x11, 0x11, 0x08, 0x11,
-    0x26, 0x11, 0x02, 0x02, 0x05, 0x0b, 0x1b, 0x18, 0x1b, 0x18, 0x29, 0x18,
-    0x2a, 0x18, 0x05, 0x1b, 0x17, 0x0d, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x00, 0x00, 0x24, 0x3e, 0x26, 0x11, 0x08, 0x02, 0x11, 0x26,
-    0x14, 0x11, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x02, 0x02, 0x04, 0x04,
-    0x05, 0x05, 0x14, 0x27, 0x54, 0xea, 0xea, 0x42, 0x42, 0x5a, 0x25, 0x57,
-    0xa4, 0x2d, 0x2b, 0x1f, 0x25, 0x78, 0x47, 0xe5, 0xfc, 0xfc, 0xfc, 0xf9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfd, 0xf3, 0xff,
-    0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf9, 0xea, 0x41,
-    0x42, 0x2b, 0x29, 0x29, 0x2a, 0x3f, 0x27, 0x29, 0x3f, 0x54, 0x3f, 0x27,
-    0x14, 0x19, 0x05, 0x19, 0x2b, 0x2b, 0x1c, 0x0e, 0x1c, 0x2b, 0x42, 0x42,
-    0x42, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x1c, 0x1c, 0x1c,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x1c, 0x1c, 0x1c, 0x0d, 0x1c, 0x1c, 0x42, 0x42,
-    0x2b, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x0d, 0x54, 0xde,
-    0xde, 0xc0, 0x40, 0x0e, 0x8e, 0x12, 0x45, 0x6f, 0x8a, 0x8a, 0x75, 0x75,
-    0x75, 0x86, 0x86, 0x84, 0x9d, 0xc1, 0xc1, 0xd2, 0xd2, 0xd2, 0xbe, 0x94,
-    0x94, 0x94, 0x8f, 0x94, 0xbe, 0xc9, 0xc9, 0xc9, 0xd2, 0xd2, 0xd2, 0xd2,
-    0xd2, 0x94, 0x93, 0x97, 0x97, 0xc1, 0xc1, 0x97, 0x9d, 0x9d, 0x84, 0x56,
-    0x31, 0x21, 0x37, 0x21, 0x1d, 0x2d, 0x12, 0x10, 0x12, 0x12, 0x0e, 0x0e,
-    0x0e, 0x10, 0x1d, 0x3c, 0x6a, 0x6a, 0x6a, 0x31, 0x56, 0x44, 0x84, 0x84,
-    0x84, 0x84, 0x84, 0x44, 0x44, 0x21, 0x12, 0x12, 0x0e, 0x0a, 0x05, 0x05,
-    0x05, 0x0b, 0x3d, 0x58, 0x58, 0x6e, 0x58, 0x3b, 0x0e, 0x12, 0x2e, 0x3c,
-    0x4c, 0x75, 0x4c, 0x4c, 0x1d, 0x12, 0x12, 0x10, 0x10, 0x0e, 0x14, 0x02,
-    0x02, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0b, 0x0b, 0x14, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x08, 0x08, 0x05, 0x02, 0x05, 0x02, 0x19, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x08, 0x08, 0x08, 0x08, 0x02, 0x08, 0x08, 0x08, 0x02, 0x08, 0x02,
-    0x02, 0x27, 0x2a, 0x0b, 0x0b, 0x18, 0x1b, 0x14, 0x2a, 0x18, 0x02, 0x02,
-    0x17, 0x3f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
-    0x00, 0x24, 0x3e, 0x11, 0x02, 0x08, 0x02, 0x08, 0x11, 0x19, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x08, 0x02, 0x04, 0x04, 0x02, 0x02, 0x05, 0x02, 0x05, 0x41, 0x41, 0x54,
-    0xee, 0xe1, 0x2b, 0x28, 0x8e, 0x12, 0x2d, 0xa4, 0x58, 0x28, 0x2b, 0x2b,
-    0x2c, 0x7b, 0xab, 0xf6, 0xfd, 0xfd, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfa, 0xf7, 0xff, 0xfd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xf7, 0xf3, 0x54, 0x42, 0x2b, 0x40, 0x2a,
-    0x1b, 0x2a, 0x29, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x27, 0x14, 0x19, 0x19,
-    0x27, 0x2b, 0x1c, 0x1c, 0x1c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x42, 0x42, 0x1c, 0x19,
-    0x05, 0x05, 0x05, 0x0d, 0x14, 0x0d, 0x14, 0x1c, 0x27, 0x27, 0x27, 0x19,
-    0x05, 0x05, 0x05, 0x02, 0x05, 0x05, 0x08, 0x11, 0xa6, 0x88, 0xea, 0x88,
-    0x71, 0x2b, 0x40, 0x12, 0x45, 0x6f, 0x8a, 0x6f, 0x8a, 0x75, 0x75, 0x6a,
-    0x84, 0x84, 0x9d, 0x9d, 0xc5, 0xd2, 0xd2, 0xd2, 0xd2, 0xbd, 0x94, 0x94,
-    0x8f, 0x8f, 0x94, 0xbe, 0xc9, 0xbe, 0xc9, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2,
-    0xbe, 0x94, 0x94, 0x94, 0xd2, 0xc1, 0x97, 0x9d, 0x9d, 0x9d, 0x84, 0x56,
-    0x37, 0x1d, 0x21, 0x21, 0x21, 0x1d, 0x10, 0x0d, 0x05, 0x05, 0x0d, 0x10,
-    0x10, 0x12, 0x1d, 0x21, 0x37, 0x31, 0x56, 0x56, 0x44, 0x44, 0x6b, 0x9d,
-    0x84, 0x84, 0x85, 0x6a, 0x3a, 0x2e, 0x12, 0x0e, 0x0d, 0x0d, 0x0e, 0x0e,
-    0x0e, 0x0e, 0x0a, 0x2c, 0x57, 0x57, 0x57, 0x49, 0x3a, 0x1d, 0x12, 0x21,
-    0x3c, 0x49, 0x75, 0x75, 0x49, 0x1d, 0x12, 0x0e, 0x0a, 0x05, 0x05, 0x05,
-    0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
-    0x05, 0x05, 0x14, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x08,
-    0x02, 0x08, 0x02, 0x02, 0x02, 0x08, 0x08, 0x08, 0x02, 0x02, 0x02, 0x08,
-    0x11, 0x08, 0x08, 0x02, 0x02, 0x00, 0x08, 0x08, 0x11, 0x0b, 0x18, 0x0b,
-    0x0b, 0x2a, 0x2a, 0x1b, 0x0b, 0x2a, 0x6c, 0x11, 0x1b, 0x43, 0x08, 0x02,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x11, 0x02, 0x26, 0x08,
-    0x08, 0x27, 0x11, 0x11, 0x27, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
-    0x04, 0x02, 0x08, 0x14, 0x29, 0x41, 0x71, 0xf3, 0xe1, 0x59, 0x59, 0x6d,
-    0x40, 0x2d, 0x77, 0xa4, 0x2b, 0x34, 0x19, 0x25, 0x7b, 0x7c, 0xf2, 0xfb,
-    0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0xf3, 0xf7, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xf7, 0xef, 0x6d, 0x42, 0x2b, 0x28, 0x54, 0x1b, 0x2a, 0x0d, 0x3f,
-    0x29, 0x3f, 0x29, 0x29, 0x11, 0x08, 0x05, 0x19, 0x19, 0x1c, 0x1c, 0x1c,
-    0x1c, 0x1c, 0x0e, 0x1c, 0x2b, 0x27, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
-    0x42, 0x42, 0x42, 0x2b, 0x27, 0x19, 0x05, 0x02, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x19, 0x27, 0x41, 0x27, 0x05, 0x05,
-    0x0a, 0x02, 0x02, 0x02, 0x00, 0x02, 0x87, 0x3f, 0xee, 0x87, 0x71, 0x40,
-    0x42, 0x10, 0x2d, 0x5c, 0x8e, 0x77, 0x8a, 0x75, 0x75, 0x75, 0x6a, 0x86,
-    0x84, 0x9d, 0x9d, 0xc1, 0xd2, 0xd2, 0xd2, 0xbe, 0xbe, 0x94, 0x94, 0x94,
-    0x93, 0x94, 0xbe, 0xc1, 0xbe, 0xc9, 0xd2, 0xd2, 0xd2, 0xd2, 0xc9, 0xbd,
-    0x94, 0x94, 0x97, 0xd2, 0x97, 0x97, 0x9d, 0x9d, 0x9d, 0x84, 0x56, 0x31,
-    0x31, 0x21, 0x21, 0x21, 0x2d, 0x25, 0x0e, 0x0e, 0x12, 0x10, 0x0e, 0x0e,
-    0x0e, 0x0e, 0x10, 0x1d, 0x37, 0x37, 0x37, 0x31, 0x31, 0x56, 0x56, 0x84,
-    0x85, 0x85, 0xac, 0x8b, 0x6b, 0x44, 0x31, 0x21, 0x1d, 0x12, 0x0e, 0x0a,
-    0x05, 0x05, 0x05, 0x05, 0x0e, 0x58, 0x6e, 0x57, 0x57, 0x57, 0x25, 0x0e,
-    0x1d, 0x3a, 0x6a, 0x75, 0x75, 0x4c, 0x3c, 0x21, 0x1d, 0x12, 0x10, 0x0d,
-    0x05, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02,
-    0x02, 0x02, 0x08, 0x02, 0x02, 0x08, 0x11, 0x08, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x08, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x00, 0x11, 0x18, 0x18, 0x2a, 0x43, 0x43, 0x2a, 0x43,
-    0x2a, 0x2a, 0x43, 0x2a, 0x43, 0x43, 0x26, 0x08, 0x02, 0x02, 0x01, 0x01,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x02, 0x08, 0x08, 0x08, 0x11, 0x11,
-    0x19, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x04, 0x08, 0x19, 0x27,
-    0x3f, 0x87, 0xf3, 0xea, 0x42, 0x42, 0x59, 0x5a, 0x40, 0x45, 0x80, 0x77,
-    0x2b, 0x1f, 0x28, 0x2c, 0x7c, 0xab, 0xf8, 0xfc, 0xfd, 0xfd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xee, 0xfd, 0xff,
-    0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xef, 0x5a,
-    0x59, 0x2b, 0x2b, 0x3f, 0x58, 0x1b, 0x28, 0x54, 0x29, 0x29, 0x18, 0x3f,
-    0x29, 0x14, 0x05, 0x05, 0x05, 0x19, 0x1c, 0x1c, 0x1c, 0x0a, 0x0e, 0x1c,
-    0x19, 0x19, 0x2b, 0x2b, 0x2b, 0x2b, 0x42, 0x42, 0x42, 0x42, 0x2b, 0x19,
-    0x05, 0x05, 0x02, 0x02, 0x02, 0x08, 0x05, 0x02, 0x02, 0x02, 0x08, 0x08,
-    0x02, 0x02, 0x02, 0x05, 0x19, 0x27, 0x41, 0x2b, 0x19, 0x05, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x08, 0x71, 0x6c, 0xea, 0xa6, 0xa6, 0x40, 0x6d, 0x10,
-    0x25, 0x3d, 0x6f, 0x8a, 0x6f, 0x6f, 0x75, 0x75, 0x6a, 0x86, 0x84, 0x84,
-    0x9d, 0x9d, 0xc5, 0xd2, 0xc1, 0xd2, 0xc1, 0xc1, 0x93, 0x93, 0x93, 0x8f,
-    0x94, 0xbe, 0xc9, 0xc9, 0xc9, 0xc9, 0xd2, 0xd2, 0xd2, 0xd2, 0xc1, 0x94,
-    0x8f, 0x94, 0xc1, 0x97, 0xc1, 0x97, 0x97, 0x9d, 0x9d, 0x84, 0x56, 0x31,
-    0x21, 0x1d, 0x1d, 0x1d, 0x21, 0x1d, 0x10, 0x0a, 0x05, 0x05, 0x0a, 0x0d,
-    0x10, 0x12, 0x10, 0x1d, 0x3c, 0x37, 0x56, 0x56, 0x44, 0x44, 0x6b, 0x8b,
-    0x8b, 0xad, 0xac, 0xac, 0xac, 0x85, 0x83, 0x3a, 0x12, 0x0e, 0x0e, 0x0e,
-    0x0e, 0x0e, 0x0d, 0x0d, 0x0a, 0x17, 0x79, 0x78, 0x77, 0x77, 0x83, 0x21,
-    0x1d, 0x21, 0x3a, 0x37, 0x6a, 0x75, 0x4c, 0x45, 0x12, 0x10, 0x05, 0x05,
-    0x05, 0x05, 0x0a, 0x0a, 0x02, 0x02, 0x19, 0x02, 0x02, 0x02, 0x02, 0x00,
-    0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x08, 0x02,
-    0x02, 0x02, 0x02, 0x11, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02,
-    0x11, 0x18, 0x29, 0x2a, 0x43, 0x43, 0x43, 0x18, 0x2a, 0x43, 0x3e, 0x2a,
-    0x43, 0x1b, 0x26, 0x26, 0x08, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x19, 0x05, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x08, 0x08, 0x02, 0x02, 0x05, 0x19, 0x27, 0x27, 0x71, 0xf3, 0xde, 0x41,
-    0x59, 0x40, 0x6d, 0x28, 0x40, 0x6e, 0x77, 0x5c, 0x1c, 0x29, 0x25, 0x7b,
-    0x7c, 0xf0, 0xfc, 0xfc, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xfa, 0xf3, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xfd,
-    0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xef, 0x58, 0x40, 0x40, 0x2b, 0x1c,
-    0x58, 0x25, 0x2a, 0x3f, 0x3f, 0x54, 0x3f, 0x3f, 0x29, 0x11, 0x08, 0x05,
-    0x05, 0x19, 0x19, 0x0a, 0x0d, 0x0a, 0x0e, 0x1c, 0x0a, 0x1c, 0x2b, 0x2b,
-    0x2b, 0x2b, 0x42, 0x2b, 0x2b, 0x1c, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x05, 0x02, 0x05,
-    0x05, 0x0a, 0x2b, 0x40, 0x42, 0x2b, 0x0a, 0x02, 0x08, 0x02, 0x02, 0x02,
-    0x02, 0x14, 0x54, 0xa6, 0xee, 0x88, 0x8e, 0x1c, 0x6d, 0x1c, 0x10, 0x2b,
-    0x6f, 0x8a, 0x6f, 0x75, 0x6f, 0x75, 0x75, 0x75, 0x86, 0x86, 0x84, 0xac,
-    0xc5, 0xdc, 0xd2, 0xc1, 0xd2, 0xbe, 0x94, 0x94, 0x94, 0x94, 0x93, 0x94,
-    0xbe, 0xc1, 0xc1, 0xbe, 0xbd, 0xbd, 0xbd, 0xd2, 0xc9, 0xbd, 0xbd, 0x8f,
-    0x8f, 0xba, 0x94, 0x94, 0xc1, 0x9d, 0x9d, 0x9d, 0x9d, 0x84, 0x56, 0x31,
-    0x37, 0x21, 0x21, 0x3c, 0x1d, 0x12, 0x0e, 0x0e, 0x10, 0x0e, 0x0d, 0x0d,
-    0x0e, 0x10, 0x12, 0x1d, 0x21, 0x31, 0x31, 0x56, 0x31, 0x44, 0x44, 0x6b,
-    0x6b, 0x84, 0xac, 0xac, 0xd0, 0xac, 0xac, 0x56, 0x31, 0x21, 0x12, 0x10,
-    0x0e, 0x0e, 0x10, 0x17, 0x0e, 0x0e, 0x25, 0x57, 0x78, 0x78, 0x78, 0x57,
-    0x2e, 0x10, 0x12, 0x2e, 0x3c, 0x4c, 0x4c, 0x49, 0x4c, 0x1d, 0x1d, 0x10,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x08,
-    0x02, 0x11, 0x00, 0x00, 0x02, 0x08, 0x02, 0x08, 0x02, 0x02, 0x11, 0x08,
-    0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x11, 0x29, 0x2a, 0x18,
-    0x43, 0x43, 0x26, 0x79, 0x2a, 0x2a, 0x2a, 0x43, 0x79, 0x43, 0x2a, 0x29,
-    0x26, 0x08, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08,
-    0x27, 0x14, 0x41, 0x87, 0xf3, 0xe1, 0x41, 0x41, 0x59, 0x40, 0x59, 0x40,
-    0x45, 0x8e, 0x6f, 0x2d, 0x2b, 0x17, 0x2c, 0xab, 0xd3, 0xf8, 0xf9, 0xff,
-    0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xf3, 0xea, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xf9, 0xfe, 0xfe, 0xff, 0xff,
-    0xff, 0xfd, 0xea, 0xae, 0x3d, 0x40, 0x2b, 0x19, 0x3d, 0x58, 0x3b, 0x2a,
-    0x14, 0x29, 0x29, 0x18, 0x29, 0x14, 0x08, 0x08, 0x08, 0x05, 0x05, 0x0a,
-    0x1c, 0x1c, 0x1c, 0x0e, 0x1c, 0x2b, 0x2b, 0x1c, 0x1c, 0x1c, 0x19, 0x0a,
-    0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x0a, 0x2b, 0x1c,
-    0x28, 0x40, 0x42, 0x1c, 0x0a, 0x05, 0x05, 0x02, 0x02, 0x02, 0x05, 0x29,
-    0x71, 0x6c, 0xea, 0x54, 0x87, 0x1c, 0x42, 0x2b, 0x10, 0x12, 0x5c, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x75, 0x75, 0x75, 0x86, 0x84, 0x84, 0x9d, 0xc5,
-    0xc1, 0xc1, 0xc1, 0xd2, 0xc1, 0x94, 0x94, 0x94, 0x93, 0x93, 0x93, 0x94,
-    0xc9, 0xbd, 0xc9, 0xbe, 0xbe, 0xc9, 0xbd, 0xd2, 0xba, 0xba, 0x8f, 0x8f,
-    0xc1, 0x97, 0x97, 0xc1, 0x97, 0x9d, 0x9d, 0xac, 0x84, 0x84, 0x56, 0x31,
-    0x21, 0x21, 0x1d, 0x1d, 0x1d, 0x1d, 0x10, 0x0e, 0x0e, 0x0e, 0x0e, 0x10,
-    0x12, 0x1d, 0x12, 0x1d, 0x21, 0x37, 0x31, 0x56, 0x56, 0x44, 0x44, 0x44,
-    0x6b, 0x6b, 0x8b, 0x8b, 0xac, 0xac, 0xac, 0x83, 0x83, 0x47, 0x47, 0x1d,
-    0x2d, 0x10, 0x0e, 0x0e, 0x10, 0x0e, 0x0a, 0x0e, 0x43, 0x78, 0x78, 0x77,
-    0x77, 0x3a, 0x12, 0x12, 0x1d, 0x1d, 0x4c, 0x4c, 0x01, 0x01, 0x01, 0x01,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x11, 0x24, 0x11, 0x24,
-    0x11, 0x08, 0x02, 0x02, 0x02, 0x02, 0x11, 0x11, 0x08, 0x02, 0x02, 0x02,
-    0x08, 0x08, 0x02, 0x08, 0x08, 0x02, 0x26, 0x43, 0x26, 0x2a, 0x2a, 0x43,
-    0x43, 0x2a, 0x2a, 0x43, 0x6c, 0x43, 0x1b, 0x2a, 0x26, 0x11, 0x08, 0x01,
-    0x01, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x11, 0x29, 0x3f, 0x41, 0x87, 0xf3,
-    0xe1, 0x42, 0x54, 0x54, 0x17, 0x6d, 0x2b, 0x42, 0x58, 0x6e, 0x6e, 0x28,
-    0x1c, 0x25, 0x7c, 0xb0, 0xf2, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfe,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xde, 0xee, 0xfd, 0xff,
-    0xff, 0xfd, 0xfe, 0xf4, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xea, 0xc7,
-    0x3d, 0x3d, 0x28, 0x27, 0x28, 0x28, 0x6c, 0x3b, 0x2a, 0x2a, 0x29, 0x29,
-    0x29, 0x14, 0x14, 0x11, 0x08, 0x05, 0x19, 0x19, 0x1c, 0x1c, 0x1c, 0x2b,
-    0x1c, 0x1c, 0x2b, 0x1c, 0x19, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x05, 0x05, 0x05, 0x0a, 0x0d, 0x0a, 0x29, 0x28, 0x40, 0x40,
-    0x40, 0x28, 0x0d, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x11, 0x55, 0x29,
-    0xf3, 0x71, 0x54, 0x14, 0x19, 0x6d, 0x10, 0x10, 0x45, 0x6f, 0x8a, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x4c, 0x75, 0x6a, 0x86, 0x85, 0x84, 0x9d, 0xc1, 0xc1,
-    0xc1, 0xc1, 0xd2, 0xbd, 0x94, 0x94, 0x94, 0x93, 0x93, 0x93, 0x94, 0xbe,
-    0xbe, 0xbe, 0xbd, 0xbd, 0xba, 0xba, 0xd2, 0xbd, 0xba, 0x94, 0x94, 0x94,
-    0x94, 0x94, 0x97, 0xc5, 0x9d, 0x9d, 0xac, 0xac, 0x84, 0x84, 0x56, 0x31,
-    0x21, 0x21, 0x37, 0x21, 0x1d, 0x1d, 0x12, 0x10, 0x12, 0x12, 0x12, 0x10,
-    0x0e, 0x0e, 0x0e, 0x0e, 0x12, 0x1d, 0x3a, 0x31, 0x31, 0x31, 0x31, 0x56,
-    0x44, 0x44, 0x44, 0x6b, 0x8b, 0xd0, 0xd0, 0xd0, 0xac, 0x44, 0x44, 0x21,
-    0x1d, 0x12, 0x0e, 0x0d, 0x05, 0x05, 0x05, 0x05, 0x0e, 0x25, 0x57, 0x78,
-    0x57, 0x6e, 0x3d, 0x0e, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x02, 0x08, 0x11, 0x11, 0x11, 0x24, 0x11, 0x26, 0x11,
-    0x02, 0x02, 0x14, 0x14, 0x02, 0x02, 0x00, 0x00, 0x00, 0x02, 0x08, 0x02,
-    0x08, 0x11, 0x11, 0x26, 0x24, 0x3e, 0x2a, 0x2a, 0x79, 0x43, 0x2a, 0x43,
-    0x2a, 0x2a, 0x43, 0x18, 0x11, 0x11, 0x08, 0x02, 0x08, 0x02, 0x02, 0x02,
-    0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x08, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x14, 0x3e, 0x3f, 0x87, 0xf3, 0xe1, 0x40, 0x2b, 0x4e, 0x2b,
-    0x40, 0x6d, 0x42, 0x59, 0x8e, 0x49, 0x59, 0x28, 0x0b, 0x2c, 0xb0, 0xce,
-    0xf8, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xfd, 0xda, 0xee, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xf4,
-    0xfa, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xc7, 0x3d, 0x58, 0x40, 0x1c,
-    0x1c, 0x3f, 0x3b, 0x57, 0x25, 0x18, 0x1b, 0x0b, 0x29, 0x3f, 0x29, 0x11,
-    0x14, 0x0b, 0x05, 0x0a, 0x19, 0x1c, 0x1c, 0x1c, 0x2b, 0x1c, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05,
-    0x05, 0x19, 0x19, 0x0b, 0x0b, 0x1b, 0x40, 0x28, 0x28, 0x40, 0x40, 0x28,
-    0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x11, 0x71, 0x27, 0xde, 0xa6,
-    0x54, 0x19, 0x0a, 0x2b, 0x5c, 0x12, 0x12, 0x5c, 0x8a, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x4c, 0x75, 0x75, 0x86, 0x86, 0x84, 0x9d, 0xc5, 0xc1, 0xc1, 0xc1,
-    0xc1, 0xc1, 0xc1, 0x94, 0x93, 0x93, 0x93, 0x8f, 0x93, 0x94, 0xbe, 0xbe,
-    0xc9, 0xbe, 0x94, 0xbe, 0xbd, 0xd2, 0xd2, 0xba, 0xba, 0x8f, 0x94, 0xc1,
-    0x97, 0x97, 0x9d, 0xc5, 0x9d, 0x9d, 0x9d, 0x84, 0x84, 0x84, 0x56, 0x31,
-    0x21, 0x21, 0x21, 0x21, 0x21, 0x1d, 0x10, 0x0e, 0x0d, 0x05, 0x0a, 0x0e,
-    0x0a, 0x10, 0x12, 0x12, 0x12, 0x1d, 0x21, 0x3a, 0x31, 0x31, 0x44, 0x44,
-    0x6b, 0x6b, 0x44, 0x6b, 0x6b, 0x8b, 0xad, 0xd0, 0xd0, 0xb0, 0x7c, 0x47,
-    0x12, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x05, 0x05, 0x11, 0x3e,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x08, 0x08, 0x24, 0x26, 0x29, 0x29, 0x2a, 0x0b, 0x05, 0x29,
-    0x26, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x11, 0x26, 0x11,
-    0x11, 0x11, 0x3e, 0x2a, 0x3f, 0x2a, 0x79, 0x79, 0x2a, 0x0b, 0x43, 0x58,
-    0x3e, 0x11, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
-    0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x08, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x27, 0x3f, 0x1b,
-    0x87, 0xf3, 0xe1, 0x28, 0x28, 0x59, 0x38, 0x1f, 0x6d, 0x42, 0x59, 0x40,
-    0x6e, 0x6e, 0x40, 0x2b, 0x17, 0x7b, 0xce, 0xf0, 0xfc, 0xfd, 0xff, 0xff,
-    0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd,
-    0xc7, 0xf3, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xf4, 0xfe, 0xfe, 0xff, 0xff,
-    0xff, 0xfd, 0xfd, 0xd9, 0x5a, 0x58, 0x3b, 0x25, 0x19, 0x1c, 0x17, 0x57,
-    0x3b, 0x2c, 0x17, 0x29, 0x29, 0x3f, 0x3f, 0x29, 0x29, 0x14, 0x05, 0x05,
-    0x0a, 0x0a, 0x0d, 0x14, 0x0d, 0x0a, 0x05, 0x0a, 0x05, 0x05, 0x02, 0x08,
-    0x08, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05,
-    0x02, 0x11, 0x14, 0x14, 0x10, 0x25, 0x40, 0x40, 0x28, 0x27, 0x05, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x71, 0x55, 0x54, 0xf3, 0x29, 0x41,
-    0x2b, 0x42, 0x28, 0x8e, 0xc8, 0xae, 0x8a, 0x8a, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x75, 0x75, 0x86, 0x86, 0x84, 0x9d, 0xc5, 0xc1, 0xc1, 0xc1, 0xc1,
-    0xc1, 0xbe, 0x94, 0x94, 0x93, 0x93, 0x93, 0x93, 0x93, 0xc1, 0xbe, 0xbe,
-    0xbe, 0x8f, 0xbd, 0xbd, 0xba, 0xd2, 0xba, 0xbd, 0x94, 0x8f, 0x93, 0xc1,
-    0x97, 0x97, 0x9d, 0x9d, 0x9d, 0x84, 0x84, 0xac, 0x84, 0x84, 0x56, 0x31,
-    0x21, 0x21, 0x21, 0x21, 0x1d, 0x2d, 0x10, 0x0e, 0x0e, 0x10, 0x1d, 0x12,
-    0x0e, 0x0e, 0x0d, 0x0e, 0x0e, 0x10, 0x21, 0x3a, 0x31, 0x85, 0x56, 0x44,
-    0x44, 0x6b, 0x44, 0x44, 0x6b, 0x85, 0xac, 0xd0, 0xd0, 0xd0, 0xac, 0x44,
-    0x31, 0x21, 0x12, 0x12, 0x0e, 0x0a, 0x0b, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x11, 0x29, 0x3e, 0x2a, 0x18, 0x18, 0x18, 0x11, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x11, 0x26, 0x24, 0x3e, 0x43, 0x0b,
-    0x0b, 0x3f, 0x43, 0x43, 0x79, 0x43, 0x2a, 0x18, 0x2a, 0x3f, 0x08, 0x02,
-    0x05, 0x19, 0x14, 0x14, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
-    0x02, 0x08, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x08, 0x14, 0x3f, 0x3f, 0x87, 0xf3, 0xea, 0x28, 0x28,
-    0x59, 0x1c, 0x33, 0x38, 0x6d, 0x59, 0x40, 0x6e, 0x57, 0x6e, 0x28, 0x17,
-    0x2c, 0xab, 0xce, 0xf6, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xfa, 0xde, 0xf3, 0xfd, 0xff,
-    0xff, 0xfd, 0xfa, 0xfa, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xea,
-    0xc0, 0x3b, 0x57, 0x2c, 0x1c, 0x27, 0x25, 0x2c, 0xa9, 0x43, 0x43, 0x3f,
-    0x3f, 0x3f, 0x29, 0x29, 0x14, 0x0b, 0x05, 0x05, 0x05, 0x19, 0x14, 0x29,
-    0x0d, 0x0d, 0x05, 0x0a, 0x1c, 0x19, 0x05, 0x19, 0x05, 0x05, 0x05, 0x02,
-    0x02, 0x02, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x02, 0x02, 0x02, 0x08, 0x05,
-    0x0a, 0x14, 0x28, 0x40, 0x40, 0x40, 0x3f, 0x14, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x14, 0xdb, 0x11, 0x29, 0xde, 0xa0, 0x5a, 0xae,
-    0xe0, 0xc8, 0x12, 0x2d, 0x5c, 0x8a, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x4c,
-    0x75, 0x6a, 0x86, 0x84, 0x84, 0x9d, 0xc5, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1,
-    0xc1, 0x97, 0x97, 0x93, 0x93, 0x93, 0x93, 0x93, 0xbe, 0xbe, 0xc9, 0xbd,
-    0x8f, 0xbd, 0xbd, 0xba, 0xd2, 0xba, 0xba, 0x94, 0x94, 0x93, 0x97, 0xc5,
-    0x97, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x84, 0xac, 0x85, 0x56, 0x37,
-    0x21, 0x1d, 0x1d, 0x21, 0x1d, 0x1d, 0x1d, 0x12, 0x0e, 0x05, 0x05, 0x05,
-    0x0a, 0x0e, 0x0e, 0x12, 0x1d, 0x1d, 0x21, 0x3a, 0x31, 0x31, 0x56, 0x56,
-    0x44, 0x44, 0x44, 0x44, 0x6b, 0x8b, 0x8b, 0xad, 0xd7, 0xd0, 0xd0, 0x85,
-    0x80, 0x47, 0x12, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x29,
-    0x3e, 0x43, 0x2a, 0x3e, 0x26, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x11,
-    0x11, 0x11, 0x02, 0x02, 0x11, 0x24, 0x43, 0x2a, 0x05, 0x29, 0x2a, 0x1b,
-    0x26, 0x43, 0x79, 0x43, 0x0b, 0x05, 0x05, 0x05, 0x05, 0x27, 0x27, 0x3f,
-    0x41, 0x27, 0x1c, 0x19, 0x05, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x11, 0x19,
-    0x29, 0x71, 0x54, 0xf3, 0xea, 0x42, 0x59, 0x54, 0x1c, 0x2b, 0x33, 0x72,
-    0x42, 0x40, 0x40, 0x8e, 0x3b, 0x6e, 0x17, 0x17, 0x46, 0xd3, 0xf0, 0xfb,
-    0xfc, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xfd, 0xfd, 0xfa, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfa,
-    0xfd, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfa, 0xf7, 0xc7, 0x3b, 0x57, 0x3b,
-    0x28, 0x2b, 0x40, 0x3d, 0x3b, 0x88, 0x43, 0x43, 0x2a, 0x2a, 0x29, 0x29,
-    0x1b, 0x14, 0x14, 0x0b, 0x05, 0x05, 0x05, 0x14, 0x27, 0x1c, 0x0d, 0x14,
-    0x0a, 0x19, 0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x0b,
-    0x28, 0x40, 0x5a, 0x5a, 0x1c, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x02, 0x02, 0x00, 0x00, 0xde, 0x87, 0x40, 0xae, 0xe0, 0xe0, 0x78, 0x25,
-    0x10, 0x10, 0x5c, 0x8a, 0x8a, 0x8a, 0x8a, 0x6f, 0x6f, 0x6f, 0x75, 0x75,
-    0x86, 0x86, 0x86, 0x84, 0x9d, 0xc5, 0xc5, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1,
-    0x94, 0x8f, 0x93, 0x93, 0x93, 0x93, 0x93, 0xbe, 0xbe, 0xbe, 0xbe, 0xbd,
-    0xba, 0xba, 0xba, 0xd2, 0xbd, 0xbd, 0x94, 0x8f, 0x93, 0x93, 0x93, 0xd2,
-    0x97, 0x97, 0x97, 0x9d, 0xac, 0xac, 0x84, 0xb3, 0xb3, 0x86, 0x37, 0x37,
-    0x21, 0x1d, 0x21, 0x21, 0x2d, 0x12, 0x10, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
-    0x10, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x21, 0x37, 0x6a, 0x56, 0x56,
-    0x44, 0x44, 0x6b, 0x6b, 0x44, 0x6b, 0x6b, 0x8b, 0xd0, 0xd0, 0xd7, 0xd7,
-    0x02, 0x02, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x11, 0x3e, 0x26, 0x3e,
-    0x26, 0x11, 0x11, 0x11, 0x11, 0x02, 0x00, 0x00, 0x24, 0x26, 0x02, 0x02,
-    0x11, 0x24, 0x43, 0x26, 0x05, 0x05, 0x14, 0x0b, 0x26, 0x26, 0x2a, 0x3e,
-    0x29, 0x14, 0x05, 0x19, 0x19, 0x19, 0x29, 0x54, 0x40, 0x6d, 0x42, 0x2b,
-    0x05, 0x05, 0x19, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x19, 0x14, 0x54, 0xee, 0xea,
-    0x59, 0x2b, 0x42, 0x2b, 0x27, 0x2b, 0x38, 0x72, 0x42, 0x28, 0x58, 0x6e,
-    0x57, 0x58, 0x0d, 0x25, 0xab, 0xce, 0xf6, 0xfc, 0xff, 0xff, 0xfe, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfa,
-    0xf3, 0xf5, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xfa, 0xfd, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xf4, 0xfd, 0xd9, 0x58, 0x3b, 0x6e, 0x25, 0x1c, 0x28, 0x40,
-    0x25, 0x57, 0x79, 0x43, 0x2a, 0x2a, 0x3f, 0x1b, 0x29, 0x14, 0x14, 0x0b,
-    0x05, 0x08, 0x08, 0x0b, 0x0b, 0x14, 0x14, 0x0b, 0x0a, 0x0e, 0x1c, 0x1c,
-    0x1c, 0x0e, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x14, 0x0d, 0x17, 0x40,
-    0x5a, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x02, 0x02,
-    0x41, 0x87, 0x71, 0xf5, 0xf8, 0xe0, 0x78, 0x8e, 0x6d, 0x8e, 0x8e, 0x45,
-    0x2d, 0x6f, 0x8a, 0x6f, 0x6f, 0x8a, 0x6f, 0x6f, 0x6f, 0x75, 0x75, 0x86,
-    0x86, 0x84, 0x84, 0x9d, 0xc5, 0xc1, 0xc5, 0xc1, 0xc1, 0xc1, 0xbe, 0x93,
-    0x93, 0x93, 0x93, 0x93, 0x93, 0x8f, 0xbe, 0xbe, 0xbd, 0xbd, 0xbd, 0xbd,
-    0xbd, 0xbd, 0xd2, 0xbd, 0xbd, 0x94, 0x8f, 0x8f, 0x93, 0x94, 0x94, 0x97,
-    0xc5, 0x6b, 0x9d, 0x9d, 0x9d, 0xac, 0x84, 0x84, 0x86, 0x86, 0x6a, 0x37,
-    0x1d, 0x1d, 0x12, 0x1d, 0x1d, 0x1d, 0x12, 0x10, 0x0e, 0x0e, 0x0e, 0x0d,
-    0x0e, 0x10, 0x10, 0x12, 0x12, 0x1d, 0x1d, 0x21, 0x37, 0x31, 0x56, 0x56,
-    0x56, 0x44, 0x56, 0x44, 0x44, 0x6b, 0x8b, 0x9b, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x02, 0x02, 0x02, 0x11, 0x11, 0x3e, 0x3e, 0x43, 0x3e, 0x3e,
-    0x11, 0x02, 0x02, 0x02, 0x02, 0x02, 0x11, 0x02, 0x00, 0x02, 0x26, 0x29,
-    0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x08, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x05, 0x14, 0x14, 0x54, 0x28, 0x54, 0x28, 0x0a, 0x05, 0x05, 0x05, 0x05,
-    0x19, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x08, 0x08, 0x59, 0xee, 0xea, 0x71, 0x3f, 0x71, 0x2b, 0x1f,
-    0x1e, 0x38, 0x6d, 0x45, 0x10, 0x28, 0x8a, 0x49, 0x6e, 0x28, 0x1c, 0x3b,
-    0xce, 0xdf, 0xfb, 0xfc, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xf4, 0xee, 0xf7, 0xff, 0xff,
-    0xff, 0xfe, 0xfe, 0xfa, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf4, 0xfd,
-    0xe1, 0x88, 0x3b, 0x57, 0x57, 0x25, 0x1c, 0x42, 0x25, 0x25, 0x57, 0x79,
-    0x43, 0x18, 0x3f, 0x3f, 0x14, 0x14, 0x27, 0x29, 0x14, 0x11, 0x08, 0x08,
-    0x05, 0x41, 0x0d, 0x0d, 0x0d, 0x0e, 0x0e, 0x1c, 0x1c, 0x1c, 0x0e, 0x0a,
-    0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02,
-    0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x0a, 0x42, 0x3f, 0x29, 0x0b,
-    0x0b, 0x05, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x41, 0xc4,
-    0x54, 0x18, 0x0b, 0x0b, 0x43, 0x88, 0x88, 0xae, 0x6e, 0x0e, 0x10, 0x5c,
-    0x8a, 0x8a, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x4c, 0x75, 0x75, 0x86, 0x86,
-    0x85, 0x84, 0xac, 0xd0, 0xc5, 0xc5, 0xc1, 0xc1, 0xc1, 0xc1, 0x94, 0x93,
-    0x93, 0x93, 0x93, 0x93, 0x8f, 0xbe, 0xc9, 0xbe, 0xc9, 0xbd, 0xbd, 0xbd,
-    0xbd, 0xd2, 0xd2, 0xbe, 0x94, 0x8f, 0x8f, 0x8f, 0x94, 0x97, 0x94, 0x97,
-    0x9d, 0x9d, 0x9d, 0x9d, 0xac, 0x85, 0x86, 0x86, 0x86, 0x84, 0x56, 0x37,
-    0x1d, 0x12, 0x12, 0x1d, 0x1d, 0x2d, 0x2d, 0x12, 0x0e, 0x0e, 0x0e, 0x0e,
-    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x12, 0x1d, 0x3a, 0x37, 0x56,
-    0x56, 0x44, 0x44, 0x6b, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02,
-    0x02, 0x08, 0x11, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x02, 0x08, 0x11, 0x11, 0x3e, 0x43, 0x43, 0x6c, 0x11, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x11, 0x00, 0x00, 0x02, 0x02, 0x02, 0x05, 0x05, 0x55,
-    0x41, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x14,
-    0x14, 0x29, 0x0d, 0x0d, 0x05, 0x05, 0x05, 0x08, 0xd1, 0x02, 0x02, 0x02,
-    0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x19, 0x14, 0x41,
-    0xee, 0xee, 0x54, 0x05, 0x1c, 0x59, 0x1f, 0x1e, 0x1e, 0x2b, 0x6d, 0x28,
-    0x25, 0x5a, 0x8a, 0x49, 0x6e, 0x17, 0x17, 0x46, 0xdf, 0xf0, 0xfb, 0xff,
-    0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe,
-    0xfe, 0xfd, 0xfd, 0xf3, 0xee, 0xf3, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xf4,
-    0xfe, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xf4, 0xfa, 0xf3, 0xa6, 0x3d, 0x3b,
-    0x78, 0x3b, 0x28, 0x1c, 0x58, 0x17, 0x25, 0x79, 0x46, 0x2a, 0x54, 0x27,
-    0x14, 0x14, 0x29, 0x29, 0x11, 0x11, 0x08, 0x05, 0x19, 0x19, 0x19, 0x2b,
-    0x0d, 0x0e, 0x1c, 0x0e, 0x10, 0x10, 0x0e, 0x0d, 0x0a, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x01, 0x01,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x05, 0x19, 0x27, 0x3f, 0x40, 0x2b, 0x1c, 0x0f,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x11, 0x27, 0x11,
-    0x02, 0x0b, 0x43, 0x88, 0x6c, 0x6d, 0x42, 0x0e, 0x10, 0x28, 0x6f, 0x8a,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x75, 0x75, 0x75, 0x86, 0x86, 0x85,
-    0xac, 0xd0, 0xdc, 0xc5, 0xc5, 0xc1, 0xc1, 0xc1, 0xc1, 0x94, 0x93, 0x93,
-    0x9b, 0x9b, 0x9b, 0x8f, 0x8f, 0xc9, 0xbe, 0xbe, 0xbe, 0x8f, 0x8f, 0xc9,
-    0xd2, 0xd2, 0xc9, 0xbd, 0x94, 0x8f, 0x8f, 0x8f, 0x97, 0xc1, 0x97, 0x97,
-    0x6b, 0x8b, 0x9d, 0x9d, 0x9d, 0x9d, 0x84, 0xb3, 0x86, 0x6a, 0x6a, 0x37,
-    0x1d, 0x1d, 0x12, 0x1d, 0x1d, 0x12, 0x12, 0x12, 0x0a, 0x05, 0x0a, 0x0e,
-    0x0e, 0x0e, 0x10, 0x10, 0x10, 0x10, 0x12, 0x1d, 0x21, 0x37, 0x31, 0x56,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x08, 0x08, 0x02, 0x29, 0x29,
-    0x11, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02,
-    0x11, 0x11, 0x3e, 0x3e, 0x43, 0x43, 0x43, 0x3e, 0x26, 0x11, 0x11, 0x11,
-    0x24, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x27, 0x11, 0x05, 0x02,
-    0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x0d, 0x05,
-    0x02, 0x05, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02,
-    0x02, 0x02, 0x02, 0x08, 0x27, 0x19, 0x54, 0xee, 0xee, 0x71, 0x1c, 0x59,
-    0x2b, 0x1f, 0x1e, 0x1f, 0x2b, 0x59, 0x42, 0x10, 0x40, 0x6e, 0x6f, 0x2d,
-    0x5a, 0x17, 0x2c, 0xab, 0xce, 0xf6, 0xfc, 0xfc, 0xff, 0xfd, 0xfe, 0xfe,
-    0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xf7,
-    0xf5, 0xf5, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff,
-    0xfe, 0xfd, 0xfd, 0xee, 0xfd, 0xa6, 0x6d, 0x3b, 0x47, 0x78, 0x25, 0x17,
-    0x58, 0x25, 0x1b, 0x43, 0xa9, 0x46, 0x1b, 0x19, 0x14, 0x27, 0x0b, 0x14,
-    0x26, 0x11, 0x19, 0x05, 0x05, 0x05, 0x05, 0x05, 0x19, 0x27, 0x1c, 0x1c,
-    0x0e, 0x1c, 0x1c, 0x0d, 0x05, 0x05, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x08, 0x1c, 0x28, 0x2b, 0x2b, 0x14, 0x05, 0x08, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x08, 0x08, 0x11, 0x0b, 0x0b, 0x05,
-    0x3f, 0x88, 0x6c, 0x3f, 0x6d, 0x17, 0x0e, 0x10, 0x5a, 0x8a, 0x8a, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x4c, 0x4c, 0x75, 0x75, 0x9e, 0x86, 0x85, 0xac,
-    0xd0, 0xdc, 0xc5, 0xcc, 0xc1, 0xc1, 0xc1, 0xbe, 0x94, 0x93, 0x93, 0x93,
-    0x93, 0x93, 0x93, 0x93, 0xca, 0xbe, 0xbe, 0xbe, 0x8f, 0x8f, 0xbe, 0xc9,
-    0xd2, 0xd2, 0xbd, 0x94, 0x94, 0x8f, 0x8f, 0x8f, 0x94, 0x97, 0xdc, 0x97,
-    0x8b, 0x8b, 0x9d, 0xac, 0xb3, 0x86, 0x86, 0x84, 0x84, 0x84, 0x6a, 0x37,
-    0x1d, 0x1d, 0x12, 0x10, 0x12, 0x12, 0x12, 0x12, 0x0e, 0x0e, 0x0d, 0x0e,
-    0x10, 0x10, 0x12, 0x12, 0x12, 0x10, 0x10, 0x10, 0x02, 0x02, 0x02, 0x02,
-    0x01, 0x02, 0x02, 0x08, 0x05, 0x14, 0x29, 0x3e, 0x29, 0x08, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x26, 0x6c,
-    0x43, 0x24, 0x43, 0x43, 0x43, 0x24, 0x26, 0x3e, 0x24, 0x24, 0x02, 0x08,
-    0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x05, 0x05, 0x05, 0x14, 0x19, 0x08,
-    0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x0a, 0x19, 0x05, 0x08, 0x08,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x27, 0x3f,
-    0x41, 0x41, 0xee, 0xee, 0xa0, 0x0a, 0x6d, 0x59, 0x1f, 0x1e, 0x1e, 0x1f,
-    0x2b, 0x8e, 0x2b, 0x42, 0x2d, 0x8e, 0x45, 0x5a, 0x25, 0x17, 0x46, 0xdf,
-    0xe5, 0xfb, 0xfc, 0xfc, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf3, 0xf3, 0xf5, 0xff, 0xff,
-    0xff, 0xfe, 0xfd, 0xf9, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xea,
-    0xfa, 0xe1, 0x8e, 0x3d, 0x2e, 0x78, 0x57, 0x25, 0x28, 0x5a, 0x0b, 0x18,
-    0x2a, 0x79, 0x25, 0x40, 0x29, 0x3f, 0x27, 0x27, 0x29, 0x26, 0x19, 0x19,
-    0x05, 0x05, 0x02, 0x08, 0x19, 0x27, 0x27, 0x17, 0x1c, 0x28, 0x1c, 0x0d,
-    0x0d, 0x1c, 0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x1c, 0x1c, 0x6d, 0x2b, 0x2b, 0x14, 0x14, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x02, 0x02, 0x08, 0x11, 0x11, 0x08, 0x11, 0x11, 0x2a,
-    0x6c, 0x88, 0x6c, 0x3d, 0x0e, 0x0e, 0x2d, 0x6f, 0x8a, 0x8a, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x4c, 0x4c, 0x75, 0x75, 0x86, 0x85, 0x85, 0xac, 0xc5,
-    0xc5, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0x94, 0x93, 0x93, 0x9b, 0x9b,
-    0x9b, 0x9b, 0x9b, 0xbe, 0xbe, 0xca, 0xc9, 0xbe, 0x8f, 0xbe, 0xc9, 0xd2,
-    0xd2, 0xbd, 0xba, 0xba, 0x8f, 0x8f, 0x94, 0x93, 0x93, 0x97, 0x97, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x84, 0x86, 0x86, 0x6a, 0x3c, 0x21,
-    0x12, 0x12, 0x12, 0x12, 0x1d, 0x12, 0x2d, 0x12, 0x0e, 0x05, 0x0a, 0x0a,
-    0x10, 0x10, 0x28, 0x17, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02,
-    0x02, 0x05, 0x0b, 0x0b, 0x3f, 0x11, 0x11, 0x00, 0x24, 0x00, 0x00, 0x02,
-    0x00, 0x02, 0x02, 0x00, 0x02, 0x11, 0x11, 0x3e, 0x3e, 0x6c, 0x26, 0x26,
-    0x43, 0x88, 0x3e, 0x3e, 0x55, 0x26, 0x11, 0x02, 0x08, 0x02, 0x08, 0x02,
-    0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x19, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x19, 0x0a, 0x19, 0x05, 0x02, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x01, 0x01, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0b, 0x27, 0xea, 0xee, 0x87,
-    0x19, 0x0a, 0x2b, 0x38, 0x38, 0x33, 0x33, 0x33, 0x6d, 0x6d, 0x38, 0x42,
-    0x49, 0xa4, 0x2d, 0x59, 0x1c, 0x25, 0x7b, 0xdf, 0xf2, 0xfb, 0xfc, 0xff,
-    0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xf9, 0xff, 0xf3, 0xee, 0xf3, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xfd,
-    0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xf3, 0xf3, 0xfa, 0x5a, 0x58,
-    0x3d, 0x57, 0x78, 0x3b, 0x17, 0x42, 0x40, 0x0d, 0x1b, 0x43, 0xa4, 0x57,
-    0x25, 0x29, 0x3f, 0x29, 0x18, 0x29, 0x27, 0x02, 0x05, 0x05, 0x08, 0x08,
-    0x05, 0x27, 0x29, 0x18, 0x17, 0x17, 0x0d, 0x0a, 0x19, 0x1c, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x27, 0x19, 0x41, 0x19,
-    0x05, 0x1c, 0x0a, 0x1c, 0x1c, 0x19, 0x05, 0x08, 0x02, 0x02, 0x02, 0x00,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x24, 0x11, 0x11, 0x11, 0x3e, 0x3f, 0x6c,
-    0x58, 0x58, 0x25, 0x10, 0x10, 0x5c, 0x8a, 0x8a, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x5c, 0x4c, 0x75, 0x75, 0x83, 0x83, 0x86, 0x85, 0xac, 0xc5, 0xc5,
-    0xcc, 0xc1, 0xbe, 0xbe, 0xc1, 0xbe, 0x94, 0x93, 0x93, 0x93, 0x9b, 0x9b,
-    0x93, 0x93, 0x9b, 0x9b, 0xbe, 0xc9, 0xbe, 0xbe, 0x8f, 0xbe, 0xc9, 0xd2,
-    0xd2, 0xc9, 0x94, 0x94, 0x8f, 0x8f, 0x8f, 0xba, 0xd2, 0x94, 0x93, 0x93,
-    0x97, 0x9d, 0xac, 0xac, 0xac, 0x85, 0x85, 0x85, 0xb3, 0x86, 0x6a, 0x37,
-    0x21, 0x1d, 0x10, 0x10, 0x12, 0x25, 0x25, 0x25, 0x0e, 0x0e, 0x0d, 0x0e,
-    0x08, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x08, 0x29, 0x11,
-    0x11, 0x26, 0x08, 0x11, 0x11, 0x02, 0x02, 0x00, 0x02, 0x02, 0x00, 0x00,
-    0x08, 0x02, 0x02, 0x02, 0x11, 0x6c, 0x6c, 0x11, 0x02, 0x11, 0x11, 0x3f,
-    0x88, 0x55, 0x11, 0x11, 0x08, 0x11, 0x08, 0x02, 0x05, 0x19, 0x05, 0x14,
-    0x0b, 0x1c, 0x2b, 0x05, 0x19, 0x19, 0x19, 0x19, 0x1c, 0x2b, 0x2b, 0x0a,
-    0x05, 0x02, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x19, 0x19,
-    0x41, 0x41, 0x05, 0x0b, 0xe1, 0xee, 0xa6, 0x1c, 0x42, 0x42, 0x2b, 0x1f,
-    0x33, 0x33, 0x33, 0x38, 0xa0, 0x42, 0x38, 0x42, 0x77, 0x77, 0x3d, 0x59,
-    0x1c, 0x2c, 0xab, 0xdf, 0xfb, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xee,
-    0xe1, 0xf5, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe,
-    0xfe, 0xfd, 0xfd, 0xf9, 0xde, 0xfc, 0xc7, 0x5a, 0x40, 0x40, 0x80, 0x57,
-    0x28, 0x28, 0x5a, 0x25, 0x2a, 0x43, 0x46, 0x78, 0x57, 0x2a, 0x29, 0x29,
-    0x29, 0x3f, 0x26, 0x11, 0x02, 0x02, 0x08, 0x02, 0x02, 0x27, 0x3f, 0x1b,
-    0x0d, 0x0d, 0x0d, 0x1c, 0x1c, 0x1c, 0x19, 0x0a, 0x0a, 0x0a, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x02, 0x05, 0x02, 0x05, 0x05, 0x0a,
-    0x0a, 0x14, 0x19, 0x27, 0x05, 0x08, 0x02, 0x02, 0x01, 0x01, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x11, 0x26, 0x29, 0x18, 0x3f, 0x6c, 0x6c, 0x6e, 0xae,
-    0x5a, 0x0e, 0x10, 0x12, 0x6f, 0x8a, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x5c,
-    0x4c, 0x4c, 0x75, 0x75, 0x83, 0x83, 0x85, 0x85, 0x8b, 0xad, 0xcc, 0xcc,
-    0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0x97, 0x93, 0x93, 0x93, 0x9b, 0x9b, 0x9b,
-    0x9b, 0x9b, 0x9b, 0xbe, 0xc9, 0xc9, 0xbe, 0xbe, 0xbe, 0xbe, 0xd2, 0xd2,
-    0xd2, 0xba, 0xba, 0x8f, 0x8f, 0x8f, 0x94, 0x94, 0x97, 0x97, 0xc5, 0x6b,
-    0x8b, 0x9d, 0x9d, 0x9d, 0x9d, 0x84, 0x84, 0x85, 0x86, 0x86, 0x3c, 0x21,
-    0x12, 0x12, 0x10, 0x12, 0x12, 0x1d, 0x12, 0x12, 0x02, 0x02, 0x02, 0x02,
-    0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x11, 0x08, 0x08, 0x08,
-    0x00, 0x11, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02,
-    0x02, 0x11, 0x55, 0x3f, 0x26, 0x02, 0x02, 0x02, 0x3f, 0x26, 0x11, 0x02,
-    0x02, 0x27, 0x41, 0x19, 0x08, 0x02, 0x08, 0x19, 0x05, 0x05, 0x19, 0x0a,
-    0x0a, 0x0a, 0x1c, 0x0e, 0x1c, 0x1c, 0x1c, 0x05, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x05, 0x05, 0x05, 0x19, 0xe1,
-    0xee, 0xc7, 0x42, 0x40, 0x42, 0x2b, 0x1f, 0x36, 0x36, 0x4b, 0x38, 0x72,
-    0x72, 0x38, 0x59, 0x5a, 0xa4, 0x49, 0x2c, 0x5a, 0x29, 0x43, 0xdf, 0xdf,
-    0xfb, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xf9, 0xfd, 0xf3, 0xee, 0xf5, 0xfd, 0xff,
-    0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfc,
-    0xe9, 0xf8, 0xf3, 0x42, 0x59, 0x25, 0x49, 0xa4, 0x3b, 0x25, 0x3d, 0x5a,
-    0x0d, 0x28, 0x2c, 0x78, 0x79, 0x25, 0x1b, 0x14, 0x11, 0x02, 0x18, 0x18,
-    0x11, 0x11, 0x08, 0x05, 0x05, 0x08, 0x14, 0x11, 0x18, 0x0d, 0x0d, 0x0a,
-    0x0e, 0x0a, 0x0a, 0x05, 0x0a, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x27,
-    0x2b, 0x1c, 0x0a, 0x05, 0x02, 0x01, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x11, 0x24, 0x11, 0x26, 0x3f, 0x6c, 0x88, 0x28, 0x3d, 0x6d, 0x40, 0x1c,
-    0x10, 0x10, 0x5c, 0x8a, 0x8a, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x4c, 0x4c,
-    0x4c, 0x4c, 0x75, 0x83, 0x83, 0x85, 0x85, 0x8b, 0xc5, 0xcc, 0xc1, 0xc1,
-    0xc1, 0xc1, 0xc1, 0xc1, 0x93, 0x93, 0x9b, 0x9b, 0x9b, 0x8b, 0x9b, 0xad,
-    0x9b, 0x9b, 0x9b, 0xcc, 0xcc, 0xc9, 0xbe, 0xbe, 0xbe, 0xc9, 0xd2, 0xd2,
-    0xc9, 0xbe, 0x94, 0x8f, 0x8f, 0x8f, 0xba, 0x94, 0x97, 0x97, 0x8b, 0x8b,
-    0x9d, 0xac, 0xac, 0xac, 0x85, 0x6a, 0x86, 0xcf, 0xb3, 0x86, 0x6a, 0x37,
-    0x21, 0x1d, 0x10, 0x0e, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x11, 0x11, 0x08, 0x02, 0x08, 0x11, 0x26, 0x26, 0x02,
-    0x02, 0x02, 0x00, 0x02, 0x00, 0x02, 0x08, 0x08, 0x00, 0x02, 0x02, 0x08,
-    0x3f, 0x55, 0x08, 0x02, 0x11, 0x11, 0x11, 0x02, 0x02, 0x02, 0x08, 0x27,
-    0x08, 0x02, 0x02, 0x08, 0x05, 0x0d, 0x19, 0x0a, 0x0a, 0x0e, 0x0e, 0x0e,
-    0x0a, 0x19, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x05, 0x02, 0x05, 0xe1, 0xee, 0xd9, 0x3f, 0x40, 0x59,
-    0x59, 0x1c, 0x1f, 0x36, 0x35, 0x33, 0x42, 0xae, 0x4e, 0x4e, 0x42, 0x5a,
-    0x8e, 0x3b, 0x25, 0x3b, 0x2a, 0x57, 0xdf, 0xf0, 0xfb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe,
-    0xfd, 0xf9, 0xfd, 0xf3, 0xea, 0xf5, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xf7, 0xfd, 0xf8, 0xef, 0xf9, 0xa0,
-    0x59, 0x3d, 0x2e, 0x80, 0x80, 0x2c, 0x25, 0x5a, 0x17, 0x0d, 0x0d, 0x17,
-    0x79, 0x57, 0x17, 0x1b, 0x29, 0x11, 0x18, 0x3e, 0x26, 0x11, 0x02, 0x05,
-    0x05, 0x05, 0x11, 0x26, 0x2a, 0x2a, 0x0b, 0x0a, 0x0e, 0x0a, 0x05, 0x0b,
-    0x0a, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x0d, 0x0d, 0x0e, 0x1c,
-    0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x08, 0x24, 0x11,
-    0x11, 0x11, 0x27, 0x29, 0x88, 0x88, 0x3f, 0x54, 0x5a, 0x40, 0x0e, 0x10,
-    0x2d, 0x6f, 0x8a, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x5c, 0x5c, 0x4c,
-    0x4c, 0x75, 0x83, 0x85, 0x85, 0x84, 0x9d, 0xc5, 0xc5, 0xc5, 0xc1, 0xc1,
-    0xc1, 0xc1, 0xc1, 0x97, 0x93, 0x9b, 0x8b, 0x9b, 0x9b, 0x9b, 0xad, 0xad,
-    0x9b, 0x9b, 0xbe, 0xc9, 0xc9, 0xbe, 0xbe, 0xbe, 0xbe, 0xc9, 0xcc, 0xd2,
-    0xba, 0xba, 0x8f, 0x8f, 0x8f, 0x94, 0x94, 0x97, 0xc5, 0xc5, 0x6b, 0x6b,
-    0x84, 0xac, 0xac, 0xb3, 0x84, 0x84, 0x56, 0x56, 0x86, 0x86, 0x75, 0x21,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x08, 0x08, 0x08, 0x11, 0x3f, 0x55, 0x26, 0x00, 0x02, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x02, 0x02, 0x02, 0x55, 0x11, 0x24,
-    0x08, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x05, 0x02, 0x05, 0x0a, 0x0a, 0x05, 0x0a, 0x19, 0x05, 0x05, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05,
-    0x19, 0xda, 0xee, 0xd9, 0x2b, 0x2b, 0x87, 0x59, 0x2b, 0x38, 0x38, 0x36,
-    0x36, 0x4b, 0x59, 0x8e, 0x4e, 0x4e, 0x59, 0x8e, 0x6d, 0x25, 0x3b, 0x3b,
-    0x3b, 0xa9, 0xd3, 0xfb, 0xfb, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfa, 0xfd, 0xf3,
-    0xee, 0xf5, 0xfd, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe,
-    0xff, 0xff, 0xf9, 0xf9, 0xfc, 0xe9, 0xfa, 0xea, 0x5a, 0x57, 0x2c, 0x46,
-    0xab, 0x47, 0x2c, 0x40, 0x28, 0x0d, 0x0b, 0x18, 0x17, 0xa9, 0x3b, 0x25,
-    0x1b, 0x18, 0x18, 0x2a, 0x26, 0x26, 0x08, 0x05, 0x04, 0x05, 0x11, 0x26,
-    0x11, 0x29, 0x0b, 0x0d, 0x1c, 0x0a, 0x05, 0x05, 0x0b, 0x0a, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x08, 0x02, 0x02, 0x02,
-    0x02, 0x05, 0x05, 0x05, 0x0a, 0x0d, 0x0d, 0x0d, 0x1c, 0x1c, 0x0d, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x00, 0x02, 0x08, 0x02, 0x02, 0x02,
-    0x11, 0x11, 0x26, 0x3e, 0x43, 0x88, 0x57, 0x5a, 0x0e, 0x0e, 0x10, 0x59,
-    0x8a, 0x8a, 0x5c, 0x5c, 0x6f, 0x6f, 0x6f, 0x5c, 0x5c, 0x4c, 0x4c, 0x75,
-    0x75, 0x83, 0x85, 0x85, 0x84, 0x9d, 0xc5, 0xc5, 0xcc, 0xc1, 0xc1, 0xc1,
-    0xc1, 0xc1, 0x97, 0x97, 0x93, 0x93, 0x6b, 0x8b, 0x8b, 0xad, 0xad, 0x93,
-    0x9b, 0x9b, 0xca, 0xca, 0xc9, 0xbe, 0x8f, 0xbe, 0xc9, 0xc9, 0xd2, 0xc9,
-    0xbe, 0x94, 0x94, 0x94, 0x94, 0xc1, 0x94, 0x97, 0x97, 0x6b, 0x6b, 0x84,
-    0xac, 0xb3, 0xb3, 0xb3, 0x86, 0x6a, 0x6a, 0x86, 0x02, 0x02, 0x02, 0x02,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x08, 0x27, 0x27, 0x08, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x0a,
-    0x0a, 0x0a, 0x05, 0x05, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x08, 0x08, 0x05, 0x05, 0x05, 0xc7, 0xf3, 0xd9, 0x40,
-    0x1c, 0x59, 0x42, 0x42, 0x2b, 0x38, 0x38, 0x36, 0x36, 0x33, 0x8e, 0x5c,
-    0x42, 0x42, 0x5a, 0x8e, 0x59, 0x1c, 0x58, 0x3b, 0x46, 0xd3, 0xf2, 0xfb,
-    0xfb, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xff,
-    0xff, 0xff, 0xfe, 0xfe, 0xfa, 0xfa, 0xfd, 0xf3, 0xee, 0xf5, 0xfd, 0xfe,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xf3,
-    0xf9, 0xe9, 0xf3, 0xfa, 0x6e, 0x58, 0x3b, 0x2c, 0x7b, 0xab, 0x2c, 0x25,
-    0x6e, 0x17, 0x0d, 0x05, 0x0d, 0x25, 0x88, 0x17, 0x18, 0x1b, 0x14, 0x14,
-    0x26, 0x26, 0x0b, 0x05, 0x05, 0x08, 0x11, 0x11, 0x11, 0x18, 0x14, 0x1c,
-    0x0d, 0x0a, 0x0b, 0x0b, 0x0b, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x0a, 0x0d, 0x14, 0x05, 0x05, 0x05, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x26,
-    0x2a, 0x2a, 0x6c, 0x6d, 0x5a, 0x6d, 0x0d, 0x0a, 0x0e, 0x12, 0x6f, 0x8a,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x5c, 0x5c, 0x4c, 0x4c, 0x4c, 0x75, 0x75,
-    0x83, 0x85, 0x85, 0x84, 0xad, 0xc5, 0xc5, 0xc5, 0xc1, 0xc1, 0xc1, 0xc1,
-    0xc1, 0x97, 0x97, 0x8b, 0x8b, 0x6b, 0x6b, 0x8b, 0x9b, 0xad, 0x9b, 0x9b,
-    0x9b, 0xbe, 0xc9, 0xca, 0xca, 0xbe, 0x8f, 0xbe, 0xc9, 0xd2, 0xd2, 0xbd,
-    0xbd, 0x94, 0x8f, 0x8f, 0x93, 0x93, 0x97, 0x9d, 0xdc, 0x44, 0x84, 0x84,
-    0xac, 0xb3, 0xb3, 0xb3, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x02,
-    0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x0a, 0x05, 0x05, 0x02,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x05, 0x05, 0xa0, 0xf3, 0xe1, 0x1c, 0x1c, 0x59, 0x6d, 0x42, 0x2b,
-    0x38, 0x36, 0x1f, 0x38, 0x38, 0x42, 0x8e, 0x3d, 0x42, 0x42, 0x57, 0x8e,
-    0x2b, 0x1c, 0x6e, 0x57, 0x46, 0xe5, 0xf8, 0xfc, 0xfc, 0xfc, 0xf9, 0xff,
-    0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xfe, 0xfe,
-    0xfa, 0xf7, 0xfd, 0xf3, 0xc7, 0xf5, 0xfa, 0xfd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xfa, 0xfd, 0xfd, 0xfd, 0xf3, 0xfd, 0xf5, 0xe0, 0xf8,
-    0xd9, 0x5a, 0x58, 0x2c, 0x47, 0xa4, 0x7b, 0x2c, 0x3d, 0x28, 0x28, 0x0a,
-    0x17, 0x2c, 0x2c, 0x79, 0x0d, 0x0d, 0x14, 0x11, 0x11, 0x11, 0x02, 0x05,
-    0x05, 0x08, 0x02, 0x02, 0x11, 0x11, 0x14, 0x29, 0x14, 0x14, 0x14, 0x0b,
-    0x05, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x05, 0x05, 0x05, 0x05, 0x19, 0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x08,
-    0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x11, 0x3f,
-    0x88, 0xc0, 0x88, 0x3f, 0x3f, 0x0d, 0x0e, 0x0e, 0x45, 0x8a, 0x8a, 0x5c,
-    0x5c, 0x6f, 0x6f, 0x6f, 0x5c, 0x45, 0x4c, 0x4c, 0x4c, 0x75, 0x75, 0x6a,
-    0x83, 0x85, 0x85, 0xac, 0xc5, 0xc5, 0xc5, 0xc5, 0xc1, 0xc1, 0xc1, 0xc1,
-    0xc1, 0x97, 0x93, 0x93, 0x6b, 0x6b, 0x6b, 0x8b, 0xad, 0x97, 0x9b, 0x9b,
-    0xca, 0xca, 0xca, 0xca, 0xbe, 0xbe, 0xbe, 0xc9, 0xcc, 0xd2, 0xc9, 0xbe,
-    0x8f, 0x8f, 0x8f, 0x8f, 0xc1, 0x94, 0x97, 0x97, 0x6b, 0x6b, 0x84, 0x84,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x05, 0x05, 0x05, 0x19, 0x14, 0x05, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x87, 0xf3,
-    0xe1, 0x40, 0x0d, 0x28, 0x59, 0x42, 0x0a, 0x38, 0x1e, 0x33, 0x36, 0x38,
-    0x42, 0x59, 0x5a, 0x40, 0x42, 0x59, 0x57, 0x6e, 0x1c, 0x2b, 0x6d, 0x6e,
-    0x7b, 0xf2, 0xfb, 0xfc, 0xfc, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe,
-    0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfa, 0xf5, 0xfd, 0xf3,
-    0xc7, 0xf3, 0xfa, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfa,
-    0xfa, 0xfd, 0xfd, 0xf7, 0xf3, 0xf9, 0xdb, 0xf8, 0xf5, 0x5a, 0x58, 0x3b,
-    0x3b, 0x47, 0xab, 0x47, 0x25, 0x59, 0x28, 0x25, 0x17, 0x25, 0x0d, 0x46,
-    0x79, 0x2a, 0x2a, 0x29, 0x11, 0x14, 0x0b, 0x14, 0x0b, 0x08, 0x11, 0x11,
-    0x08, 0x08, 0x0b, 0x0b, 0x14, 0x29, 0x29, 0x0b, 0x0b, 0x0a, 0x05, 0x0b,
-    0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x02, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x05, 0x08, 0x11, 0x11,
-    0x08, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x08, 0x3f, 0x88, 0xa6,
-    0xa6, 0x71, 0x54, 0x05, 0x0e, 0x0e, 0x12, 0x6f, 0x8a, 0x8a, 0x5c, 0x5c,
-    0x5c, 0x6f, 0x5c, 0x5c, 0x4c, 0x4c, 0x4c, 0x4c, 0x75, 0x75, 0x83, 0x6a,
-    0x85, 0x84, 0xac, 0xc5, 0xc5, 0xc5, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0x97,
-    0x97, 0x8b, 0x6b, 0x6b, 0x6b, 0x6b, 0x8b, 0x9b, 0x9b, 0x9b, 0x9b, 0xca,
-    0xca, 0xca, 0xca, 0xca, 0xbe, 0xbe, 0xc9, 0xc9, 0xcc, 0xc9, 0xbd, 0xba,
-    0x94, 0x8f, 0x8f, 0x8f, 0x97, 0x97, 0x8b, 0x9d, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x0a, 0x05, 0x19,
-    0x19, 0x05, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x08, 0x27, 0x04, 0x72, 0xee, 0xea, 0x59, 0x05, 0x28, 0x59,
-    0x59, 0x1c, 0x38, 0x4b, 0x36, 0x36, 0x1e, 0x2b, 0x28, 0x8e, 0x17, 0x2b,
-    0x42, 0x59, 0x6e, 0x49, 0x10, 0x42, 0x6d, 0x57, 0xd3, 0xf6, 0xfb, 0xfc,
-    0xfc, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xff, 0xff, 0xfe, 0xfe, 0xfa, 0xf5, 0xfd, 0xf3, 0xc7, 0xee, 0xf5, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xfa, 0xf4, 0xfa, 0xfd, 0xfd,
-    0xee, 0xfc, 0xef, 0xe9, 0xf9, 0xc7, 0x58, 0x57, 0x25, 0x2e, 0x7c, 0xb0,
-    0x2c, 0x42, 0x40, 0x0e, 0x3b, 0x25, 0x18, 0x1b, 0x79, 0x79, 0x2a, 0x2a,
-    0x14, 0x27, 0x3f, 0x29, 0x29, 0x11, 0x11, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x14, 0x3f, 0x11, 0x11, 0x05, 0x0b, 0x05, 0x19, 0x19, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x04, 0x05, 0x05,
-    0x05, 0x05, 0x0a, 0x05, 0x0b, 0x14, 0x14, 0x14, 0x14, 0x0b, 0x05, 0x05,
-    0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x41, 0x54, 0x88, 0x88,
-    0x6c, 0x0b, 0x0a, 0x10, 0x0e, 0x45, 0x8a, 0x8e, 0x77, 0x5c, 0x5c, 0x6f,
-    0x6f, 0x5c, 0x5c, 0x4c, 0x45, 0x4c, 0x4c, 0x75, 0x75, 0x6a, 0x6a, 0x85,
-    0x85, 0xac, 0xc5, 0xc5, 0xd2, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0x97,
-    0x97, 0x8b, 0x6b, 0x6b, 0x6b, 0x8b, 0x8b, 0xad, 0x9b, 0xad, 0x9b, 0xca,
-    0xc9, 0xca, 0xc9, 0xbe, 0xbe, 0xbe, 0xc9, 0xcc, 0xc9, 0xc9, 0xbe, 0xbe,
-    0x8f, 0x8f, 0x8f, 0x94, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x08,
-    0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05,
-    0x4e, 0xeb, 0xea, 0x71, 0x0d, 0x0d, 0x1c, 0x42, 0x42, 0x1f, 0x33, 0x1e,
-    0x33, 0x36, 0x36, 0x2b, 0x25, 0x6e, 0x28, 0x42, 0x59, 0x5a, 0x8e, 0x12,
-    0x25, 0x59, 0x59, 0x3d, 0xe5, 0xf6, 0xfb, 0xfc, 0xff, 0xf3, 0xfd, 0xfd,
-    0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe,
-    0xfe, 0xf5, 0xfd, 0xf3, 0xc7, 0xee, 0xfa, 0xfd, 0xfe, 0xff, 0xff, 0xff,
-    0xfe, 0xfd, 0xfd, 0xfa, 0xf5, 0xfa, 0xfa, 0xf9, 0xea, 0xfc, 0xfb, 0xdb,
-    0xf8, 0xf3, 0x58, 0x58, 0x40, 0x2d, 0x47, 0xb0, 0x80, 0x2c, 0x40, 0x0e,
-    0x17, 0x17, 0x14, 0x18, 0x2a, 0x7b, 0x46, 0x3b, 0x18, 0x28, 0x18, 0x0b,
-    0x11, 0x26, 0x11, 0x11, 0x08, 0x02, 0x02, 0x02, 0x08, 0x08, 0x11, 0x11,
-    0x05, 0x05, 0x05, 0x1c, 0x19, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x0b, 0x14, 0x28, 0x28, 0x2b, 0x05, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x11, 0x3e, 0x88, 0xa6, 0xc0, 0x2b,
-    0x0a, 0x0e, 0x0e, 0x12, 0x58, 0x8e, 0x8e, 0x5c, 0x5c, 0x6f, 0x6f, 0x6f,
-    0x5c, 0x5c, 0x45, 0x45, 0x4c, 0x4c, 0x75, 0x75, 0x83, 0x83, 0x85, 0x84,
-    0x9d, 0xc5, 0xc5, 0xc5, 0xcc, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0x9d, 0x8b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x8b, 0xad, 0x9b, 0x9b, 0x8f, 0xbe, 0xc9,
-    0xc9, 0xca, 0xbe, 0x8f, 0xbe, 0xca, 0xc9, 0xcc, 0xd2, 0xbd, 0xbd, 0xbd,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x05, 0x02, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x41, 0xee, 0xea, 0xa6, 0x0a,
-    0x0d, 0x71, 0x42, 0x2b, 0x1c, 0x38, 0x36, 0x33, 0x33, 0x33, 0x38, 0x2b,
-    0x8e, 0x3d, 0x42, 0x59, 0x59, 0x5a, 0x6e, 0x17, 0x40, 0x6e, 0x5a, 0x3d,
-    0xf8, 0xfb, 0xfb, 0xfc, 0xff, 0xf7, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf5, 0xfd, 0xf3,
-    0xc7, 0xea, 0xfa, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfa,
-    0xf5, 0xf3, 0xf7, 0xfd, 0xf3, 0xe9, 0xfc, 0xdb, 0xef, 0xfc, 0xae, 0x58,
-    0x58, 0x2d, 0x2e, 0x80, 0xab, 0x47, 0x2c, 0x59, 0x0b, 0x14, 0x05, 0x2a,
-    0x2a, 0x2a, 0xa9, 0x46, 0x25, 0x18, 0x05, 0x05, 0x08, 0x11, 0x11, 0x11,
-    0x08, 0x02, 0x02, 0x08, 0x19, 0x11, 0x26, 0x11, 0x02, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0a,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x08, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0a,
-    0x1c, 0x2b, 0x2b, 0x17, 0x14, 0x14, 0x0b, 0x02, 0x11, 0x11, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x3f, 0xa6, 0x6c, 0x54, 0x40, 0x40, 0x0e,
-    0x0e, 0x0e, 0x28, 0x8e, 0x8e, 0x6f, 0x5c, 0x4c, 0x6f, 0x5c, 0x5c, 0x5c,
-    0x45, 0x45, 0x4c, 0x4c, 0x75, 0x75, 0x75, 0x83, 0x83, 0x6a, 0xb3, 0xd0,
-    0xd0, 0xd0, 0xc5, 0xc5, 0xc1, 0xc1, 0xc5, 0xc5, 0xc5, 0x97, 0x97, 0x8b,
-    0x8b, 0x6b, 0x6b, 0x6b, 0x8b, 0xad, 0xad, 0xad, 0x93, 0xbe, 0xca, 0xca,
-    0xca, 0xca, 0x8f, 0x8f, 0xbe, 0xc9, 0xcc, 0xd2, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x08,
-    0x02, 0x05, 0x19, 0xea, 0xee, 0xc0, 0x1c, 0x0a, 0x1c, 0x42, 0x2b, 0x2b,
-    0x1f, 0x0f, 0x1e, 0x1e, 0x1e, 0x33, 0x38, 0x2b, 0x8e, 0x40, 0x59, 0x59,
-    0x5a, 0x6e, 0x40, 0x40, 0x5a, 0x58, 0x58, 0xc7, 0xfb, 0xfb, 0xfc, 0xfc,
-    0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe,
-    0xff, 0xff, 0xfe, 0xfe, 0xfa, 0xf3, 0xfd, 0xf3, 0xd9, 0xe1, 0xfa, 0xfd,
-    0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfa, 0xfa, 0xf4, 0xee, 0xf3, 0xfa,
-    0xf5, 0xe0, 0xfc, 0xf8, 0xa9, 0xf8, 0xf3, 0x5a, 0x49, 0x57, 0x2d, 0x2e,
-    0xb0, 0xb0, 0x2d, 0x5a, 0x2b, 0x14, 0x29, 0x2a, 0x43, 0x43, 0x2c, 0xa9,
-    0x3b, 0x2a, 0x18, 0x05, 0x02, 0x08, 0x11, 0x11, 0x08, 0x08, 0x08, 0x02,
-    0x02, 0x08, 0x02, 0x08, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0a, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x00, 0x02,
-    0x02, 0x02, 0x02, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x0e, 0x10, 0x0e, 0x1c,
-    0x17, 0x2a, 0x29, 0x14, 0x11, 0x02, 0x02, 0x00, 0x02, 0x00, 0x01, 0x02,
-    0x02, 0x02, 0x11, 0x11, 0x29, 0x54, 0xc7, 0xc7, 0x28, 0x0a, 0x05, 0x0a,
-    0x0e, 0x5a, 0x8a, 0x8a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x45,
-    0x4c, 0x4c, 0x4c, 0x4c, 0x75, 0x75, 0x75, 0x6a, 0x85, 0xac, 0xd0, 0xd0,
-    0xdc, 0xdc, 0xc5, 0xc5, 0xcc, 0xc5, 0xc1, 0xc1, 0x97, 0x8b, 0x8b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x8b, 0x9b, 0xcc, 0x9b, 0x9b, 0x9b, 0xca, 0xca, 0xca,
-    0xca, 0xbe, 0x8f, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08,
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x08, 0x00, 0x02, 0x02, 0x05, 0xda, 0xee,
-    0xe1, 0x2b, 0x0a, 0x05, 0x2b, 0x42, 0x1c, 0x1f, 0x1e, 0x1e, 0x35, 0x36,
-    0x36, 0x38, 0x42, 0x6d, 0x59, 0x42, 0x4e, 0x59, 0x49, 0x8e, 0x28, 0x42,
-    0x59, 0x5a, 0x57, 0xe9, 0xfb, 0xfc, 0xfc, 0xff, 0xfd, 0xfe, 0xff, 0xff,
-    0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe,
-    0xfa, 0xf3, 0xfd, 0xf3, 0xc7, 0xda, 0xf5, 0xfd, 0xfe, 0xff, 0xfe, 0xff,
-    0xfe, 0xfe, 0xf9, 0xfa, 0xf3, 0xea, 0xf3, 0xf5, 0xf5, 0xef, 0xf3, 0xfb,
-    0xa9, 0xf2, 0xf9, 0xae, 0x58, 0x57, 0x3b, 0x2e, 0x7c, 0xce, 0x47, 0x2e,
-    0x58, 0x14, 0x2b, 0x18, 0x1b, 0x2a, 0x2a, 0x17, 0xa9, 0x17, 0x1b, 0x0b,
-    0x02, 0x08, 0x08, 0x11, 0x11, 0x08, 0x02, 0x02, 0x08, 0x02, 0x08, 0x02,
-    0x19, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x00, 0x02, 0x02, 0x08, 0x05,
-    0x05, 0x05, 0x19, 0x0e, 0x0e, 0x0e, 0x0d, 0x0d, 0x0d, 0x1c, 0x1c, 0x1c,
-    0x14, 0x27, 0x05, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x11, 0x6c, 0x88, 0x88, 0x6c, 0x18, 0x05, 0x05, 0x0a, 0x10,
-    0x6e, 0x8e, 0x8a, 0x45, 0x5c, 0x5c, 0x5c, 0x6f, 0x5c, 0x5c, 0x45, 0x4c,
-    0x45, 0x4c, 0x4c, 0x75, 0x75, 0x75, 0x83, 0x86, 0xb3, 0xd0, 0xd0, 0xd0,
-    0xc5, 0xc5, 0xcc, 0xc1, 0xc1, 0xc5, 0xc5, 0x97, 0x8b, 0x8b, 0x8b, 0x6b,
-    0x6b, 0x6b, 0x8b, 0xad, 0xad, 0xad, 0x9b, 0x8f, 0xbe, 0xca, 0xca, 0xca,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x08, 0x24, 0x00, 0x02, 0x05, 0x87, 0xee, 0xea, 0x42, 0x0d, 0x05, 0x05,
-    0x0a, 0x1c, 0x1f, 0x36, 0x36, 0x36, 0x36, 0x36, 0x4b, 0x38, 0x40, 0x8e,
-    0x42, 0x4e, 0x4e, 0x59, 0x49, 0x77, 0x28, 0x4e, 0x59, 0x5a, 0x46, 0xf8,
-    0xfc, 0xfc, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfa, 0xf3, 0xfd, 0xf3,
-    0xea, 0xea, 0xf5, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xfe, 0xfd, 0xfa,
-    0xf3, 0xea, 0xee, 0xf3, 0xfd, 0xea, 0xe0, 0xfb, 0xf2, 0xdb, 0xfa, 0xee,
-    0x58, 0x3b, 0x6e, 0x2e, 0x2e, 0x7c, 0xce, 0x2e, 0x3b, 0x1c, 0x0d, 0x0d,
-    0x2a, 0x6c, 0x6c, 0x6c, 0x1b, 0xa9, 0x43, 0x18, 0x05, 0x02, 0x02, 0x02,
-    0x08, 0x08, 0x08, 0x02, 0x02, 0x02, 0x04, 0x19, 0x02, 0x08, 0x19, 0x19,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0a, 0x0a,
-    0x0a, 0x0a, 0x05, 0x0a, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
-    0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x19, 0x0a,
-    0x0a, 0x0b, 0x0d, 0x19, 0x0a, 0x0a, 0x0a, 0x0d, 0x0d, 0x1c, 0x14, 0x05,
-    0x05, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
-    0x26, 0x3e, 0x6c, 0xa6, 0x88, 0x14, 0x05, 0x05, 0x0e, 0x0e, 0x45, 0x8e,
-    0x8e, 0x5c, 0x5c, 0x5c, 0x6f, 0x5c, 0x5c, 0x5c, 0x45, 0x45, 0x45, 0x45,
-    0x4c, 0x4c, 0x4c, 0x75, 0x75, 0x83, 0x85, 0xb3, 0xd0, 0xe2, 0xd0, 0xdc,
-    0xc5, 0xc5, 0xc1, 0xc5, 0xcc, 0xcc, 0x97, 0x8b, 0x8b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x8b, 0x9b, 0xad, 0xca, 0x9b, 0x9b, 0xca, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x08, 0x02, 0x02,
-    0x54, 0xee, 0xee, 0x6d, 0x1c, 0x0a, 0x1c, 0x1c, 0x2b, 0x1f, 0x1e, 0x1e,
-    0x36, 0x36, 0x35, 0x4b, 0x4b, 0x38, 0x59, 0x8e, 0x42, 0x4e, 0x38, 0x59,
-    0x57, 0x49, 0x42, 0x4e, 0x59, 0x58, 0x78, 0xfb, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xfe, 0xfe, 0xfa, 0xf4, 0xfd, 0xf3, 0xea, 0xe1, 0xf5, 0xfa,
-    0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xf7, 0xf5, 0xe8, 0xe1, 0xea,
-    0xfe, 0xf3, 0xd9, 0xf8, 0xfb, 0xa9, 0xf8, 0xf9, 0xae, 0x57, 0x57, 0x57,
-    0x2d, 0x47, 0xb0, 0xb0, 0x2c, 0x40, 0x0d, 0x0a, 0x14, 0x18, 0x18, 0x2a,
-    0x18, 0x2c, 0x78, 0x17, 0x0d, 0x05, 0x02, 0x02, 0x05, 0x19, 0x05, 0x02,
-    0x00, 0x00, 0x01, 0x01, 0x02, 0x08, 0x08, 0x08, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x05,
-    0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x19,
-    0x05, 0x05, 0x02, 0x05, 0x05, 0x05, 0x14, 0x14, 0x14, 0x14, 0x1c, 0x0b,
-    0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x08,
-    0x3f, 0xc0, 0x88, 0x3f, 0x29, 0x0a, 0x0d, 0x0d, 0x17, 0x6e, 0xae, 0x6e,
-    0x58, 0x45, 0x5c, 0x5c, 0x5c, 0x5c, 0x45, 0x45, 0x45, 0x4c, 0x4c, 0x4c,
-    0x4c, 0x75, 0x75, 0x75, 0x83, 0x83, 0xcf, 0xd0, 0xd0, 0xdc, 0xdc, 0xc5,
-    0xc1, 0xc1, 0xc5, 0xc5, 0xc5, 0xad, 0x8b, 0x8b, 0x8b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x8b, 0xad, 0xad, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x19, 0xee, 0xee, 0xc7, 0x59,
-    0x1c, 0x0a, 0x42, 0x42, 0x2b, 0x38, 0x36, 0x4b, 0x36, 0x36, 0x35, 0x33,
-    0x33, 0x38, 0xae, 0x59, 0x59, 0x34, 0x42, 0x5a, 0x80, 0x2e, 0x59, 0x4e,
-    0x59, 0x58, 0xd3, 0xfb, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe,
-    0xfa, 0xf3, 0xfa, 0xf7, 0xea, 0xd9, 0xee, 0xfa, 0xfd, 0xff, 0xfe, 0xfe,
-    0xff, 0xff, 0xfd, 0xf5, 0xf5, 0xee, 0xda, 0xe1, 0xf4, 0xf5, 0xd9, 0xe9,
-    0xfb, 0xe9, 0xdb, 0xfa, 0xef, 0x58, 0x3b, 0x78, 0x45, 0x2e, 0x7c, 0xce,
-    0x47, 0x57, 0x58, 0x0d, 0x29, 0x14, 0x18, 0x29, 0x29, 0x18, 0x3b, 0xa4,
-    0x6e, 0x18, 0x08, 0x02, 0x05, 0x05, 0x05, 0x02, 0x00, 0x00, 0x01, 0x01,
-    0x00, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x05,
-    0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x02, 0x02, 0x05,
-    0x02, 0x05, 0x05, 0x0d, 0x1c, 0x1c, 0x28, 0x14, 0x0a, 0x05, 0x19, 0x05,
-    0x02, 0x02, 0x01, 0x01, 0x08, 0x00, 0x02, 0x02, 0x02, 0x11, 0x55, 0xa6,
-    0xdb, 0xa6, 0x3f, 0x05, 0x05, 0x0a, 0x0e, 0x3d, 0x6e, 0xae, 0x5c, 0x45,
-    0x5c, 0x5c, 0x6f, 0x5c, 0x5c, 0x45, 0x45, 0x45, 0x4c, 0x4c, 0x4c, 0x4c,
-    0x75, 0x75, 0x75, 0x83, 0x85, 0xac, 0xac, 0xc5, 0xdc, 0xdc, 0xc5, 0xc5,
-    0xc5, 0xc5, 0xc5, 0xc5, 0xad, 0x8b, 0x8b, 0x8b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x19, 0xea, 0xee, 0xd9, 0x0a, 0x0a, 0x2b, 0x42, 0x38, 0x1f,
-    0x1f, 0x36, 0x36, 0x36, 0x33, 0x4b, 0x4b, 0x33, 0x38, 0x59, 0xae, 0x42,
-    0x4e, 0x1f, 0x59, 0x5a, 0x77, 0x2d, 0x59, 0x59, 0x59, 0x40, 0xe9, 0xfc,
-    0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfa, 0xf3, 0xfa, 0xfa,
-    0xee, 0xc7, 0xee, 0xf7, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xf7,
-    0xf3, 0xe1, 0xc0, 0xe1, 0xea, 0xfd, 0xe1, 0xae, 0xfb, 0xfb, 0xa9, 0xf8,
-    0xf9, 0xae, 0x58, 0x3b, 0x49, 0x2e, 0x2e, 0xb0, 0xce, 0x2e, 0x46, 0x0b,
-    0x02, 0x08, 0x05, 0x28, 0x3f, 0x2a, 0x0d, 0x57, 0xa9, 0x46, 0x0b, 0x02,
-    0x02, 0x08, 0x14, 0x14, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x0d, 0x1c, 0x1c, 0x1c, 0x1c, 0x14, 0x14, 0x0b, 0x02, 0x08, 0x08, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x02, 0x24, 0x3e, 0x88, 0x88, 0x6c,
-    0x6c, 0x17, 0x05, 0x0a, 0x0d, 0x0e, 0x6e, 0x8e, 0x8a, 0x5c, 0x5c, 0x5c,
-    0x5c, 0x5c, 0x6f, 0x5c, 0x5c, 0x4c, 0x45, 0x45, 0x4c, 0x4c, 0x4c, 0x75,
-    0x75, 0x6a, 0x85, 0x85, 0xac, 0xac, 0xd0, 0xd0, 0xdc, 0xdc, 0xcc, 0xcc,
-    0xc5, 0xc5, 0xc5, 0xc5, 0x9d, 0x8b, 0x8b, 0x6b, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0xc7, 0xee,
-    0xe1, 0x1c, 0x05, 0x0a, 0x2b, 0x38, 0x38, 0x1f, 0x36, 0x1e, 0x36, 0x36,
-    0x33, 0x33, 0x33, 0x33, 0x40, 0x8e, 0x59, 0x59, 0x38, 0x59, 0x40, 0x58,
-    0x58, 0x5a, 0x59, 0x59, 0x59, 0x5a, 0xf8, 0xfc, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xfe, 0xfa, 0xf3, 0xf7, 0xfd, 0xee, 0xc7, 0xee, 0xf7,
-    0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xf5, 0xee, 0xea, 0xc7, 0xc7,
-    0xde, 0xfa, 0xef, 0xa9, 0xef, 0xfb, 0xe0, 0xe0, 0xf9, 0xee, 0x58, 0x3b,
-    0x77, 0x2e, 0x2e, 0x47, 0xce, 0x7c, 0x47, 0x3b, 0x05, 0x05, 0x05, 0x1c,
-    0x18, 0x18, 0x18, 0x0d, 0x7b, 0x7b, 0x2a, 0x18, 0x02, 0x08, 0x11, 0x02,
-    0x11, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05,
-    0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x02, 0x02, 0x05, 0x05, 0x19, 0x0a, 0x05, 0x05, 0x0a, 0x0a, 0x0d, 0x0d,
-    0x0d, 0x14, 0x14, 0x14, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
-    0x02, 0x00, 0x02, 0x00, 0x11, 0x3e, 0x11, 0x11, 0x6c, 0xc7, 0x71, 0x42,
-    0x0a, 0x0a, 0x0a, 0x0e, 0x25, 0x8e, 0x8a, 0x8a, 0x45, 0x5c, 0x5c, 0x5c,
-    0x5c, 0x6f, 0x5c, 0x45, 0x45, 0x45, 0x4c, 0x4c, 0x4c, 0x75, 0x75, 0x75,
-    0x6a, 0x6a, 0x85, 0xac, 0xd0, 0xd0, 0xdc, 0xdc, 0xdc, 0xc5, 0xc5, 0xc5,
-    0xc5, 0xc5, 0xad, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
-    0x00, 0x00, 0x02, 0x02, 0x02, 0xa6, 0xee, 0xe8, 0x42, 0x05, 0x19, 0x2b,
-    0x42, 0x1c, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x38, 0x4b, 0x4b, 0x4b, 0x4e,
-    0x40, 0xae, 0x59, 0x4e, 0x1f, 0x59, 0x3d, 0x6e, 0x40, 0x59, 0x40, 0x40,
-    0x5a, 0x8e, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe,
-    0xfa, 0xf3, 0xfa, 0xfd, 0xee, 0xda, 0xea, 0xf4, 0xfd, 0xff, 0xfe, 0xfe,
-    0xfe, 0xfe, 0xfd, 0xfa, 0xee, 0xee, 0xda, 0xc0, 0xd1, 0xee, 0xf8, 0xae,
-    0xc7, 0xfc, 0xf6, 0xa9, 0xf8, 0xf9, 0xae, 0x57, 0x2e, 0x77, 0x2d, 0x2e,
-    0xb0, 0xce, 0x47, 0x57, 0x0b, 0x05, 0x05, 0x0d, 0x29, 0x3e, 0x29, 0x18,
-    0x0d, 0x79, 0x57, 0x0b, 0x02, 0x02, 0x11, 0x18, 0x0b, 0x05, 0x08, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x05, 0x05, 0x0a, 0x05, 0x0a, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0b, 0x28,
-    0x1c, 0x28, 0x1c, 0x0d, 0x05, 0x02, 0x02, 0x02, 0x00, 0x00, 0x01, 0x02,
-    0x00, 0x02, 0x00, 0x11, 0x08, 0x55, 0xa9, 0xa9, 0x43, 0x6c, 0x5a, 0x17,
-    0x0e, 0x0a, 0x0e, 0x5a, 0x8e, 0xae, 0x49, 0x49, 0x5c, 0x5c, 0x5c, 0x5c,
-    0x5c, 0x5c, 0x45, 0x45, 0x45, 0x45, 0x4c, 0x4c, 0x4c, 0x75, 0x75, 0x83,
-    0x83, 0x85, 0xac, 0xd0, 0xd0, 0xdc, 0xdc, 0xdc, 0xc5, 0xc5, 0xc5, 0xc5,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x08,
-    0x71, 0xee, 0xee, 0x8e, 0x19, 0x0a, 0x05, 0x0a, 0x2b, 0x38, 0x33, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4e, 0x4e, 0x4b, 0x4e, 0x6d, 0x8e, 0x42, 0x38,
-    0x4b, 0x42, 0x49, 0x8e, 0x5a, 0x6d, 0x59, 0x5a, 0x58, 0xd9, 0xfd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfa, 0xf5, 0xf7, 0xfd,
-    0xf3, 0xea, 0xe1, 0xf3, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xf7,
-    0xee, 0xea, 0xc7, 0x87, 0xc7, 0xc7, 0xf9, 0xe0, 0x54, 0xf8, 0xfb, 0xd3,
-    0xe0, 0xfc, 0xef, 0x57, 0x3b, 0x57, 0x45, 0x2d, 0x47, 0xb0, 0xce, 0x47,
-    0x2c, 0x05, 0x05, 0x1c, 0x54, 0x6c, 0x29, 0x0d, 0x18, 0x05, 0x79, 0x43,
-    0x05, 0x08, 0x29, 0x3f, 0x0b, 0x11, 0x11, 0x08, 0x08, 0x02, 0x02, 0x02,
-    0x00, 0x02, 0x02, 0x08, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x08, 0x02, 0x02, 0x08, 0x05, 0x05, 0x02, 0x05,
-    0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05,
-    0x19, 0x0a, 0x05, 0x05, 0x08, 0x02, 0x05, 0x0d, 0x1c, 0x17, 0x28, 0x0e,
-    0x0d, 0x0b, 0x08, 0x08, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00,
-    0x00, 0x00, 0x02, 0x3e, 0x79, 0x6c, 0x6c, 0x6c, 0x88, 0x40, 0x0d, 0x0a,
-    0x0e, 0x12, 0x78, 0xae, 0x8e, 0x45, 0x45, 0x5c, 0x5c, 0x6f, 0x6f, 0x5c,
-    0x45, 0x5c, 0x45, 0x45, 0x45, 0x4c, 0x4c, 0x75, 0x75, 0x75, 0x83, 0x85,
-    0x85, 0xac, 0xd0, 0xd0, 0xe2, 0xe2, 0xdc, 0xdc, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x41, 0xee, 0xea, 0xc7, 0x1c,
-    0x19, 0x05, 0x27, 0x1c, 0x0a, 0x1f, 0x1e, 0x1a, 0x36, 0x36, 0x33, 0x4b,
-    0x38, 0x38, 0x33, 0x38, 0xae, 0x5a, 0x42, 0x2b, 0x4b, 0x42, 0x49, 0x78,
-    0x59, 0x59, 0x59, 0x5a, 0x57, 0xef, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xfe, 0xf4, 0xf3, 0xf4, 0xfd, 0xf3, 0xee, 0xe1, 0xee,
-    0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xf9, 0xee, 0xe1, 0xa6, 0x87,
-    0xa6, 0xa6, 0xf7, 0xee, 0x88, 0xe0, 0xfb, 0xf6, 0xa4, 0xf2, 0xfc, 0xae,
-    0x57, 0x2e, 0x77, 0x2d, 0x25, 0x7b, 0xce, 0x7c, 0x2e, 0x1c, 0x0a, 0x2b,
-    0x1c, 0x0d, 0x17, 0x0b, 0x18, 0x0b, 0x0b, 0xa9, 0x25, 0x05, 0x05, 0x02,
-    0x11, 0x11, 0x11, 0x08, 0x08, 0x02, 0x02, 0x00, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x02, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x0a, 0x0a, 0x05,
-    0x05, 0x02, 0x05, 0x05, 0x0a, 0x0d, 0x1c, 0x17, 0x28, 0x28, 0x1c, 0x2b,
-    0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
-    0x24, 0x55, 0x88, 0x3e, 0x3e, 0x88, 0x88, 0x6c, 0x28, 0x05, 0x0a, 0x0d,
-    0x3d, 0x8e, 0xae, 0x77, 0x45, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x45,
-    0x5c, 0x4c, 0x45, 0x45, 0x4c, 0x4c, 0x75, 0x75, 0x75, 0x83, 0x83, 0x83,
-    0xb3, 0xd0, 0xd0, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x08, 0x27,
-    0x19, 0x02, 0x14, 0xea, 0xea, 0xda, 0x2b, 0x1c, 0x2b, 0x41, 0x54, 0x0f,
-    0x04, 0x1e, 0x1a, 0x35, 0x35, 0x35, 0x36, 0x4b, 0x33, 0x38, 0x4e, 0x42,
-    0xae, 0x59, 0x2b, 0x42, 0x4e, 0x59, 0x77, 0x57, 0x71, 0x4e, 0x59, 0x5a,
-    0x78, 0xf8, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe,
-    0xfa, 0xf3, 0xf3, 0xfd, 0xf5, 0xf3, 0xda, 0xee, 0xfd, 0xfd, 0xff, 0xff,
-    0xfe, 0xfe, 0xff, 0xfd, 0xf3, 0xea, 0xc7, 0xc7, 0x87, 0x87, 0xde, 0xfd,
-    0xae, 0x78, 0xfb, 0xf8, 0xab, 0xe5, 0xfb, 0xef, 0x57, 0x2e, 0x49, 0x77,
-    0x25, 0x46, 0xb0, 0xce, 0x47, 0x3b, 0x0e, 0x0a, 0x0a, 0x14, 0x0b, 0x18,
-    0x43, 0x11, 0x2a, 0x0b, 0x8e, 0x0e, 0x05, 0x08, 0x11, 0x11, 0x11, 0x11,
-    0x08, 0x02, 0x02, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05,
-    0x05, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x02, 0x05, 0x05, 0x02, 0x02,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x02, 0x02, 0x05, 0x05, 0x0a, 0x05, 0x04, 0x04, 0x05, 0x05,
-    0x05, 0x05, 0x0d, 0x0e, 0x10, 0x10, 0x28, 0x2b, 0x2b, 0x19, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24,
-    0x26, 0x6c, 0x6c, 0x6c, 0x3f, 0xa6, 0x71, 0x05, 0x0a, 0x0d, 0x10, 0x58,
-    0x8e, 0xae, 0x5c, 0x45, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x45,
-    0x45, 0x45, 0x4c, 0x4c, 0x4c, 0x77, 0x75, 0x75, 0x83, 0x83, 0x85, 0xac,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x0d, 0xe1, 0xea,
-    0xe1, 0x2b, 0x1c, 0x0d, 0x0a, 0x19, 0x19, 0x0f, 0x1e, 0x1e, 0x35, 0x35,
-    0x35, 0x4b, 0x4b, 0x4b, 0x33, 0x38, 0x42, 0x6d, 0x6d, 0x59, 0x1c, 0x59,
-    0x40, 0x45, 0x8e, 0x57, 0x54, 0x54, 0x59, 0x5a, 0xae, 0xfc, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xf4, 0xf3, 0xee, 0xfd,
-    0xf4, 0xf3, 0xc7, 0xee, 0xfa, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xfd,
-    0xf3, 0xe1, 0xda, 0x8e, 0x6d, 0x71, 0x87, 0xfd, 0xe0, 0x57, 0xe9, 0xfb,
-    0xf0, 0x7b, 0xf2, 0xf9, 0xae, 0x58, 0x2d, 0x77, 0x2d, 0x12, 0x47, 0xb0,
-    0xce, 0x47, 0x3b, 0x0d, 0x19, 0x14, 0x0b, 0x2a, 0x2a, 0x2a, 0x0b, 0x1b,
-    0x17, 0x8e, 0x0d, 0x05, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x05, 0x05, 0x05, 0x05,
-    0x02, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x05, 0x05, 0x04, 0x05, 0x05, 0x02, 0x02, 0x02, 0x05, 0x05,
-    0x0a, 0x0e, 0x1c, 0x2b, 0x2b, 0x1c, 0x14, 0x08, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x11, 0x11, 0x11, 0x0b, 0x88,
-    0x6c, 0x3f, 0x6c, 0x6d, 0x58, 0x17, 0x0a, 0x0a, 0x0d, 0x17, 0x8e, 0x8e,
-    0x8e, 0x49, 0x49, 0x49, 0x5c, 0x6f, 0x5c, 0x5c, 0x5c, 0x45, 0x45, 0x45,
-    0x45, 0x49, 0x4c, 0x4c, 0x75, 0x75, 0x75, 0x83, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02,
-    0x02, 0x08, 0x19, 0x05, 0x0a, 0xe1, 0xe8, 0xe8, 0x42, 0x0a, 0x27, 0x05,
-    0x05, 0x27, 0x1f, 0x1f, 0x36, 0x35, 0x35, 0x35, 0x35, 0x35, 0x4b, 0x36,
-    0x33, 0x38, 0x42, 0xae, 0x4e, 0x1f, 0x42, 0x59, 0x40, 0x2d, 0x6e, 0x6e,
-    0x54, 0x54, 0x59, 0x5a, 0xe9, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xfe, 0xf4, 0xf3, 0xf3, 0xfd, 0xf3, 0xfa, 0xc0, 0xea,
-    0xf5, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf3, 0xe1, 0xc7, 0x6d,
-    0x59, 0x87, 0x55, 0xf3, 0xf3, 0x8e, 0x8e, 0xfc, 0xf6, 0xab, 0xd3, 0xfc,
-    0xf3, 0x5a, 0x49, 0x2e, 0x77, 0x2e, 0x2e, 0x7c, 0xce, 0xb0, 0x2e, 0x17,
-    0x0b, 0x02, 0x11, 0x2a, 0x6c, 0x79, 0x43, 0x43, 0x17, 0x3b, 0x88, 0x0d,
-    0x0b, 0x11, 0x08, 0x08, 0x02, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x0d,
-    0x0d, 0x0d, 0x14, 0x14, 0x02, 0x08, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02, 0x11, 0x08, 0x54, 0x6c, 0x17,
-    0x40, 0x5a, 0x28, 0x54, 0x0d, 0x05, 0x0a, 0x0e, 0x3d, 0x8e, 0xae, 0x77,
-    0x45, 0x45, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x45, 0x45, 0x45, 0x45, 0x49,
-    0x4c, 0x4c, 0x75, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x08, 0x02, 0x11, 0x08, 0x05, 0x2b,
-    0xe1, 0xee, 0xe8, 0xae, 0x1c, 0x14, 0x0b, 0x02, 0x19, 0x27, 0x1f, 0x1e,
-    0x1a, 0x1e, 0x36, 0x36, 0x33, 0x33, 0x4b, 0x4b, 0x4b, 0x4e, 0x59, 0xa0,
-    0x4e, 0x1f, 0x4e, 0x42, 0x58, 0x6e, 0x6e, 0x6e, 0x54, 0x54, 0x6d, 0x58,
-    0xf8, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd,
-    0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe,
-    0xfa, 0xf3, 0xf3, 0xfa, 0xf3, 0xfa, 0xc0, 0xe1, 0xee, 0xfd, 0xff, 0xff,
-    0xff, 0xf9, 0xfe, 0xfe, 0xfa, 0xee, 0xc7, 0xa0, 0x6d, 0x71, 0x71, 0xda,
-    0xfd, 0xc7, 0x40, 0xef, 0xf8, 0xe5, 0x7b, 0xf2, 0xf9, 0xc7, 0x6e, 0x2e,
-    0x47, 0x47, 0x12, 0x2e, 0xb0, 0xce, 0x47, 0x2e, 0x28, 0x02, 0x05, 0x3f,
-    0x18, 0x0b, 0x0b, 0x18, 0x0b, 0x18, 0x43, 0xa9, 0x0b, 0x18, 0x05, 0x02,
-    0x08, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x08, 0x02, 0x02, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x0a, 0x0d,
-    0x05, 0x1c, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
-    0x01, 0x02, 0x00, 0x00, 0x00, 0x26, 0x41, 0x27, 0x27, 0x3f, 0x29, 0x29,
-    0x88, 0xa6, 0x27, 0x05, 0x05, 0x0a, 0x10, 0x5a, 0x8e, 0xae, 0x49, 0x49,
-    0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x45, 0x45, 0x49, 0x4c, 0x45, 0x45,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x08, 0x08, 0x02, 0x02, 0x08, 0x02, 0x05, 0xc0, 0xf3, 0xe1, 0xae, 0x1c,
-    0x1c, 0x19, 0x05, 0x14, 0x27, 0x38, 0x1f, 0x33, 0x1a, 0x36, 0x1a, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x4e, 0x4e, 0xae, 0x6d, 0x38, 0x1f, 0x4b, 0x42,
-    0x2d, 0x78, 0x6e, 0x59, 0x59, 0x54, 0x5a, 0x8e, 0xf8, 0xfc, 0xf9, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfa, 0xf5, 0xf3, 0xfa,
-    0xf7, 0xfa, 0xc7, 0xda, 0xee, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfd,
-    0xfa, 0xf3, 0xe1, 0xa0, 0x87, 0x54, 0x87, 0x71, 0xf9, 0xea, 0x5a, 0xae,
-    0xfc, 0xf8, 0x7b, 0xd3, 0xf9, 0xf5, 0x6e, 0x49, 0x2e, 0x78, 0x2d, 0x2e,
-    0x7c, 0xce, 0xce, 0x7c, 0x25, 0x05, 0x05, 0x0b, 0x14, 0x0b, 0x1b, 0x2a,
-    0x18, 0x18, 0x1b, 0x46, 0x79, 0x17, 0x1c, 0x05, 0x08, 0x08, 0x08, 0x08,
-    0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x05, 0x0d, 0x2b, 0x1c, 0x1c,
-    0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
-    0x00, 0x02, 0x08, 0x08, 0x11, 0x14, 0x29, 0x3f, 0x14, 0x11, 0x29, 0x54,
-    0x54, 0x1c, 0x0a, 0x0e, 0x0e, 0x12, 0x78, 0xae, 0x8e, 0x45, 0x45, 0x45,
-    0x5c, 0x5c, 0x6f, 0x5c, 0x5c, 0x45, 0x45, 0x45, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x02, 0x02, 0x08,
-    0x02, 0x05, 0x71, 0xf3, 0xe8, 0xc7, 0x42, 0x2b, 0x1c, 0x1c, 0x41, 0x41,
-    0x0f, 0x1f, 0x38, 0x1e, 0x35, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b,
-    0x38, 0x59, 0xae, 0x59, 0x1c, 0x4e, 0x33, 0x42, 0x49, 0xa4, 0x5a, 0x59,
-    0x59, 0x6d, 0x58, 0xc8, 0xf9, 0xfd, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xf7, 0xf3, 0xf3, 0xfa, 0xf7, 0xf5, 0xc7, 0xc7,
-    0xee, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xee, 0xda, 0xa6,
-    0x71, 0x54, 0x6d, 0x54, 0xee, 0xf7, 0x8e, 0x3d, 0xf3, 0xf8, 0xdf, 0x7b,
-    0xef, 0xf9, 0xc7, 0x6e, 0x3b, 0x49, 0x77, 0x1d, 0x2d, 0xab, 0xce, 0xb0,
-    0x2c, 0x0e, 0x0a, 0x0a, 0x19, 0x14, 0x2a, 0x43, 0x29, 0x11, 0x0b, 0x0b,
-    0x46, 0x78, 0x17, 0x0b, 0x08, 0x08, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x19, 0x2b, 0x19, 0x19, 0x05, 0x05, 0x02,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x08, 0x05, 0x19, 0x1c, 0x2b, 0x2b, 0x0a, 0x0a, 0x05,
-    0x02, 0x02, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x02, 0x11,
-    0x24, 0x02, 0x11, 0x02, 0x14, 0x27, 0x6c, 0x54, 0x25, 0x6e, 0x8e, 0x57,
-    0x17, 0x0e, 0x0a, 0x0a, 0x40, 0x8e, 0x8e, 0x78, 0x49, 0x49, 0x45, 0x5c,
-    0x5c, 0x5c, 0x5c, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x08, 0x08, 0x05, 0x54, 0xf3, 0xea,
-    0xe1, 0x1c, 0x42, 0x59, 0x2b, 0x1c, 0x41, 0x4e, 0x1f, 0x38, 0x36, 0x36,
-    0x36, 0x35, 0x35, 0x4b, 0x4b, 0x33, 0x4b, 0x4e, 0x42, 0x8e, 0x6d, 0x2b,
-    0x2b, 0x59, 0x4e, 0x59, 0x77, 0x78, 0x6d, 0x54, 0x59, 0x6d, 0x3b, 0xe9,
-    0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfd,
-    0xfd, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xf7, 0xf3, 0xee, 0xf7, 0xfa, 0xea, 0xae, 0xc7, 0xea, 0xfa, 0xfd, 0xff,
-    0xff, 0xff, 0xf9, 0xfd, 0xfd, 0xf5, 0xd9, 0xa6, 0x71, 0x54, 0x59, 0x4e,
-    0xc0, 0xfd, 0xdb, 0x3b, 0xc7, 0xfc, 0xf0, 0x7b, 0xd3, 0xfc, 0xf5, 0x5a,
-    0x40, 0x2d, 0x80, 0x47, 0x2c, 0x2e, 0xb0, 0xce, 0x7c, 0x10, 0x0e, 0x05,
-    0x05, 0x14, 0x0b, 0x11, 0x08, 0x11, 0x02, 0x05, 0x0e, 0x46, 0x79, 0x0b,
-    0x02, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x0a, 0x2b, 0x1c, 0x19, 0x19, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x05, 0x0d, 0x1c, 0x0d, 0x19, 0x0a, 0x05, 0x02, 0x08, 0x02,
-    0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x02, 0x02, 0x11, 0x88, 0x6c, 0x3b, 0x3b, 0x78, 0xc7, 0xa9, 0x28, 0x0a,
-    0x0a, 0x0e, 0x0e, 0x57, 0xa4, 0xa4, 0x58, 0x2d, 0x45, 0x5c, 0x49, 0x5c,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x19, 0x02, 0x05, 0x05, 0x27, 0xee, 0xee, 0xea, 0x59, 0x0a, 0x42, 0x2b,
-    0x2b, 0x1c, 0x2b, 0x38, 0x38, 0x36, 0x36, 0x36, 0x33, 0x33, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x33, 0x38, 0x42, 0xae, 0x59, 0x1c, 0x59, 0x42, 0x42, 0x40,
-    0x77, 0x78, 0x59, 0x71, 0x59, 0x6d, 0x57, 0xf8, 0xfc, 0xff, 0xff, 0xff,
-    0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe,
-    0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfa, 0xf3, 0xee, 0xf4,
-    0xfd, 0xd9, 0xc7, 0xc7, 0xea, 0xf4, 0xff, 0xff, 0xfe, 0xfe, 0xf9, 0xff,
-    0xfd, 0xf5, 0xe1, 0xc0, 0x87, 0x4e, 0x38, 0x72, 0x55, 0xfa, 0xef, 0x78,
-    0x3d, 0xf8, 0xf6, 0xd3, 0x7b, 0xf2, 0xf9, 0xd9, 0x6e, 0x2d, 0x2e, 0x80,
-    0x12, 0x2d, 0x7c, 0xb0, 0xce, 0x47, 0x3b, 0x0d, 0x05, 0x08, 0x18, 0x0b,
-    0x11, 0x11, 0x11, 0x0b, 0x05, 0x05, 0x79, 0x46, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x0a, 0x19, 0x0a,
-    0x0a, 0x0a, 0x19, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x05, 0x05, 0x05, 0x0a, 0x0a, 0x05, 0x0a, 0x05, 0x05, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x08, 0x02, 0x11,
-    0x11, 0x11, 0x6c, 0xdb, 0x88, 0x43, 0x88, 0x8e, 0x5a, 0x0a, 0x0a, 0x0a,
-    0x0a, 0x0e, 0x6e, 0xae, 0x8e, 0x49, 0x49, 0x49, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x02, 0x02, 0x05, 0x05, 0x05,
-    0xc0, 0xf3, 0xea, 0xa6, 0x1c, 0x42, 0x2b, 0x42, 0x0a, 0x2b, 0x1c, 0x38,
-    0x36, 0x1e, 0x1e, 0x1f, 0x1e, 0x33, 0x35, 0x4b, 0x4b, 0x36, 0x33, 0x42,
-    0x6d, 0x8e, 0x40, 0x2b, 0x59, 0x42, 0x6d, 0x6e, 0xae, 0x6e, 0x59, 0x54,
-    0x6d, 0x59, 0xae, 0xf8, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd,
-    0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xf5, 0xee, 0xea, 0xf3, 0xfd, 0xd9, 0xc7, 0xae,
-    0xc7, 0xf3, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xf9, 0xfe, 0xf5, 0xef, 0xc7,
-    0x87, 0x72, 0x4e, 0x71, 0x55, 0xde, 0xfc, 0xae, 0x25, 0xd9, 0xfb, 0xf2,
-    0x7b, 0xd3, 0xfc, 0xfa, 0x6e, 0x49, 0x2e, 0x47, 0x77, 0x2e, 0x2e, 0xb0,
-    0xce, 0xb0, 0x7b, 0x25, 0x05, 0x29, 0x0b, 0x18, 0x11, 0x29, 0x55, 0x0b,
-    0x0b, 0x0b, 0x0a, 0x79, 0x43, 0x05, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x19, 0x05,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05,
-    0x0a, 0x0a, 0x0a, 0x1c, 0x1c, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x55, 0x41, 0x02, 0x00, 0x24,
-    0x6c, 0x88, 0x88, 0x3d, 0x8e, 0x6d, 0x59, 0x0d, 0x0d, 0x0a, 0x0a, 0x0e,
-    0x2c, 0x8e, 0xae, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x14, 0x08, 0x04, 0x04, 0x05, 0x59, 0xea, 0xea, 0xc7, 0x28,
-    0x28, 0x59, 0x42, 0x59, 0x2b, 0x1f, 0x0f, 0x38, 0x36, 0x4b, 0x4b, 0x4b,
-    0x38, 0x38, 0x33, 0x4b, 0x36, 0x36, 0x33, 0x38, 0xae, 0x5a, 0x1c, 0x4e,
-    0x4e, 0x42, 0x6e, 0x58, 0x8e, 0x6e, 0x59, 0x59, 0x6d, 0x5a, 0xdb, 0xfc,
-    0xfc, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfd,
-    0xfa, 0xfa, 0xfa, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xfa, 0xf3, 0xee, 0xf3, 0xfd, 0xd1, 0xd9, 0xc8, 0xd9, 0xea, 0xfd, 0xff,
-    0xfd, 0xfe, 0xff, 0xf9, 0xfd, 0xfa, 0xf3, 0xc7, 0xa0, 0x71, 0x55, 0x71,
-    0x55, 0x87, 0xfd, 0xde, 0x5a, 0x58, 0xfb, 0xf2, 0xce, 0xab, 0xef, 0xfd,
-    0xe1, 0x78, 0x2d, 0x2e, 0x80, 0x47, 0x2d, 0x46, 0xb0, 0xce, 0x7c, 0x46,
-    0x17, 0x05, 0x0b, 0x29, 0x18, 0x18, 0x2a, 0x11, 0x08, 0x08, 0x02, 0x05,
-    0x88, 0x3b, 0x18, 0x11, 0x02, 0x08, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02,
-    0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x02, 0x02, 0x02,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x05, 0x19,
-    0x1c, 0x1c, 0x1c, 0x14, 0x0a, 0x05, 0x05, 0x05, 0x02, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x02, 0x02, 0x02, 0x02, 0x18, 0x6c, 0xa6,
-    0xdb, 0x6c, 0x3f, 0x58, 0x58, 0x58, 0x3d, 0x0d, 0x0d, 0x0e, 0x0d, 0x59,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x08, 0x02, 0x08, 0x14, 0x27,
-    0x04, 0x02, 0x1c, 0xea, 0xea, 0xea, 0x40, 0x40, 0x6d, 0x71, 0x42, 0x42,
-    0x0a, 0x0f, 0x36, 0x4b, 0x35, 0x4b, 0x4b, 0x4b, 0x4b, 0x4e, 0x4b, 0x4b,
-    0x4b, 0x36, 0x38, 0x4e, 0xae, 0x40, 0x1c, 0x4e, 0x38, 0x59, 0x49, 0x8e,
-    0x8e, 0x59, 0x59, 0x59, 0x6d, 0x58, 0xe9, 0xfc, 0xfc, 0xff, 0xfd, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xfa, 0xfa, 0xfe, 0xfe,
-    0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfa, 0xf3, 0xee, 0xf3,
-    0xff, 0xde, 0xe1, 0xc8, 0xe1, 0xea, 0xf9, 0xff, 0xff, 0xfe, 0xfd, 0xf7,
-    0xfd, 0xfd, 0xf5, 0xd9, 0xc0, 0x71, 0x71, 0x55, 0x55, 0x55, 0xf3, 0xfa,
-    0x8e, 0x25, 0xe9, 0xfb, 0xe5, 0x7b, 0xdb, 0xf9, 0xfa, 0x6c, 0x6d, 0x2d,
-    0x2e, 0xa4, 0x17, 0x25, 0x7c, 0xb0, 0xdf, 0x7b, 0x3b, 0x05, 0x05, 0x05,
-    0x05, 0x14, 0x3e, 0x26, 0x11, 0x02, 0x02, 0x08, 0x0a, 0xa9, 0x2a, 0x02,
-    0x02, 0x08, 0x08, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x08, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x05, 0x19, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x0a, 0x0a, 0x1c, 0x1c, 0x1c,
-    0x1c, 0x19, 0x05, 0x05, 0x05, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x08, 0x11, 0x26, 0x3f, 0x11, 0x6c, 0xc7, 0xa9, 0x6c,
-    0x6c, 0x18, 0x88, 0xc7, 0xa6, 0x0d, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x02, 0x02, 0x02, 0x08, 0x08, 0x02, 0x02, 0x0f, 0xda, 0xee,
-    0xea, 0x5a, 0x17, 0x17, 0x17, 0x05, 0x1c, 0x2b, 0x38, 0x1f, 0x1e, 0x1e,
-    0x36, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x72, 0x4e, 0xc8,
-    0x59, 0x28, 0x4e, 0x38, 0x1f, 0x42, 0x49, 0xa4, 0x6e, 0x59, 0x6d, 0x6d,
-    0x6e, 0x6e, 0xf3, 0xf9, 0xfc, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xfd, 0xfd, 0xfd, 0xfa, 0xfa, 0xfa, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf5, 0xf3, 0xf3, 0xf9, 0xee, 0xee, 0xe8,
-    0xee, 0xee, 0xf7, 0xf9, 0xf9, 0xf9, 0xf9, 0xf7, 0xf9, 0xf9, 0xf5, 0xee,
-    0xe1, 0xda, 0xda, 0xda, 0xda, 0xda, 0xea, 0xfa, 0xea, 0xdb, 0xde, 0xfc,
-    0xf8, 0xe9, 0xe0, 0xf8, 0xfc, 0xee, 0xd9, 0xd9, 0xc7, 0xd9, 0xd9, 0xc7,
-    0xd3, 0xe5, 0xe5, 0xe5, 0xc7, 0xc0, 0xc7, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4,
-    0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc0, 0xe0, 0xc7, 0xc0, 0xc4, 0xc4, 0xc4,
-    0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4,
-    0xc4, 0xc4, 0xc4, 0xc0, 0xc0, 0xc0, 0xc0, 0xc4, 0xc0, 0xc0, 0xc0, 0xc0,
-    0xc4, 0xc4, 0xc4, 0xc4, 0xc0, 0xc0, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4,
-    0xc0, 0xc4, 0xc0, 0xc4, 0xc4, 0xc4, 0xc4, 0xc0, 0xc4, 0xc4, 0xc0, 0xc0,
-    0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4,
-    0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4,
-    0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc0,
-    0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc0,
-    0xc0, 0xc4, 0xc0, 0xc4, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xd1, 0xc7, 0xc0,
-    0xc0, 0xc0, 0xc4, 0xc4, 0xc4, 0xc4, 0xc0, 0xc0, 0xc4, 0xc4, 0xc4, 0xc4,
-    0xc4, 0xc4, 0xc4, 0xd1, 0xdb, 0xdb, 0xdb, 0xdb, 0xe9, 0xef, 0xe0, 0xc7,
-    0xde, 0xea, 0xda, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02,
-    0x08, 0x02, 0x02, 0x02, 0x05, 0xc0, 0xee, 0xee, 0x8e, 0x0e, 0x0d, 0x0d,
-    0x0d, 0x05, 0x0a, 0x19, 0x0f, 0x1f, 0x36, 0x36, 0x36, 0x4b, 0x33, 0x4b,
-    0x4b, 0x4b, 0x36, 0x36, 0x36, 0x33, 0x59, 0xae, 0x59, 0x1c, 0x4e, 0x38,
-    0x42, 0x40, 0x77, 0xa4, 0x59, 0x71, 0x72, 0x87, 0x58, 0xae, 0xf5, 0xfc,
-    0xfc, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfd,
-    0xf7, 0xf7, 0xf4, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf4, 0xf5, 0xf3, 0xf3, 0xf7, 0xf3, 0xee, 0xee, 0xea, 0xee, 0xf7, 0xf9,
-    0xf9, 0xf4, 0xf9, 0xf7, 0xf7, 0xf7, 0xfa, 0xf3, 0xea, 0xde, 0xde, 0xde,
-    0xde, 0xde, 0xde, 0xf7, 0xf3, 0xde, 0xd4, 0xf3, 0xfc, 0xef, 0xe0, 0xef,
-    0xf8, 0xf7, 0xde, 0xde, 0xda, 0xd9, 0xe9, 0xdb, 0xdb, 0xdb, 0xe9, 0xf2,
-    0xe9, 0xd9, 0xd5, 0xd4, 0xd4, 0xde, 0xde, 0xde, 0xde, 0xd4, 0xd4, 0xd4,
-    0xd5, 0xd5, 0xdb, 0xe9, 0xd5, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd1, 0xd5, 0xd1, 0xd5, 0xd5, 0xd5, 0xd1,
-    0xd5, 0xd1, 0xd5, 0xd1, 0xda, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd1,
-    0xd5, 0xd5, 0xd1, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4, 0xd5, 0xd5, 0xd1, 0xd1,
-    0xd4, 0xd4, 0xd1, 0xd1, 0xd1, 0xd5, 0xd1, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd5, 0xd5, 0xd1, 0xd5, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd1, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xda,
-    0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd6, 0xd6,
-    0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xde, 0xdb, 0xde, 0xea, 0xf3, 0xea, 0xde, 0xd5, 0xda, 0xde,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x08, 0x02, 0x08, 0x02,
-    0x71, 0xee, 0xee, 0xc7, 0x0d, 0x05, 0x0d, 0x5a, 0x71, 0x42, 0x19, 0x19,
-    0x1f, 0x1f, 0x36, 0x36, 0x4b, 0x35, 0x4b, 0x4b, 0x4e, 0x4b, 0x36, 0x4b,
-    0x4b, 0x4e, 0x8e, 0x8e, 0x2b, 0x38, 0x38, 0x41, 0x59, 0x5a, 0x77, 0x8a,
-    0x59, 0x4e, 0x72, 0x6d, 0x57, 0xc8, 0xfa, 0xfc, 0xfc, 0xfc, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xf9, 0xfd, 0xf5, 0xf5, 0xf4, 0xf7,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfe, 0xf9, 0xf7, 0xf4, 0xee, 0xf3,
-    0xf7, 0xf7, 0xea, 0xee, 0xea, 0xee, 0xf7, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf7, 0xf9, 0xfa, 0xf3, 0xea, 0xea, 0xde, 0xde, 0xde, 0xde, 0xde, 0xf3,
-    0xf7, 0xea, 0xda, 0xea, 0xf9, 0xf3, 0xe9, 0xe9, 0xf3, 0xf7, 0xf3, 0xda,
-    0xde, 0xda, 0xe1, 0xe1, 0xda, 0xd5, 0xe0, 0xe9, 0xef, 0xe0, 0xda, 0xd5,
-    0xd4, 0xd5, 0xda, 0xde, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5,
-    0xea, 0xd5, 0xd4, 0xd4, 0xd4, 0xd4, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd1, 0xd1, 0xd5, 0xd5, 0xd1, 0xd5, 0xd5, 0xd5,
-    0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd1, 0xd1, 0xd5, 0xd1, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd5, 0xd5,
-    0xd1, 0xd1, 0xd4, 0xd4, 0xd6, 0xd6, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd1, 0xd5, 0xd5, 0xd1, 0xd5, 0xd1, 0xd1, 0xd1, 0xd5, 0xd5,
-    0xd5, 0xd5, 0xda, 0xda, 0xd5, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda,
-    0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd6, 0xda, 0xda, 0xd6, 0xd5, 0xd5,
-    0xd1, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xde, 0xde, 0xea, 0xea, 0xea, 0xde, 0xde, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01,
-    0x01, 0x04, 0x01, 0x02, 0x08, 0x08, 0x02, 0x54, 0xee, 0xee, 0xe1, 0x40,
-    0x0e, 0x0d, 0x0d, 0x88, 0x3f, 0x14, 0x05, 0x1f, 0x0f, 0x1e, 0x33, 0x4b,
-    0x4b, 0x4b, 0x4e, 0x4b, 0x4b, 0x72, 0x72, 0x4e, 0x72, 0x72, 0xae, 0x59,
-    0x0f, 0x4e, 0x38, 0x2b, 0x59, 0x3d, 0xa4, 0x77, 0x59, 0x72, 0x72, 0x6d,
-    0x49, 0xe5, 0xfd, 0xfd, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xfd, 0xfd, 0xf9, 0xfd, 0xf5, 0xf5, 0xf7, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf7, 0xf4, 0xf7, 0xf7, 0xf7, 0xee, 0xee, 0xf7, 0xf7, 0xea, 0xee,
-    0xea, 0xea, 0xf3, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf7, 0xf7, 0xf9, 0xf5,
-    0xee, 0xea, 0xde, 0xde, 0xde, 0xde, 0xde, 0xea, 0xf9, 0xee, 0xde, 0xda,
-    0xf7, 0xf7, 0xef, 0xe0, 0xef, 0xf7, 0xf4, 0xde, 0xde, 0xd9, 0xd9, 0xea,
-    0xda, 0xd9, 0xdb, 0xe9, 0xe5, 0xef, 0xdb, 0xda, 0xd5, 0xd5, 0xda, 0xda,
-    0xda, 0xda, 0xda, 0xd5, 0xda, 0xd4, 0xd4, 0xd1, 0xda, 0xea, 0xd5, 0xd1,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd1, 0xd1, 0xd5, 0xd1, 0xd1, 0xd1, 0xd1, 0xd5, 0xd1, 0xd5,
-    0xd5, 0xd5, 0xd5, 0xd1, 0xd1, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd1, 0xd1, 0xd5, 0xd5, 0xd4, 0xd4,
-    0xd6, 0xd6, 0xd4, 0xd4, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd5, 0xd1,
-    0xd5, 0xd1, 0xd5, 0xd1, 0xd5, 0xd6, 0xd6, 0xd6, 0xda, 0xda, 0xda, 0xda,
-    0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xde, 0xda, 0xda,
-    0xda, 0xda, 0xd6, 0xd6, 0xd6, 0xda, 0xda, 0xd5, 0xd5, 0xd1, 0xd5, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd1, 0xd4, 0xd4, 0xde, 0xd4, 0xd4,
-    0xea, 0xea, 0xde, 0xee, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08,
-    0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02,
-    0x02, 0x05, 0x19, 0xe1, 0xee, 0xee, 0x40, 0x5a, 0x3d, 0xae, 0x5a, 0x6c,
-    0x54, 0x19, 0x04, 0x0f, 0x1e, 0x1e, 0x1e, 0x35, 0x36, 0x4b, 0x4b, 0x72,
-    0x4b, 0x4b, 0x36, 0x36, 0x38, 0x59, 0xae, 0x59, 0x1f, 0x4e, 0x4e, 0x41,
-    0x5a, 0x6e, 0xae, 0x58, 0x59, 0x72, 0xa0, 0x6d, 0x80, 0xf2, 0xfc, 0xff,
-    0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xf7, 0xfa,
-    0xf5, 0xf5, 0xf7, 0xf7, 0xf7, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf7, 0xf7, 0xf3, 0xee, 0xf7, 0xf9, 0xde, 0xea, 0xea, 0xee, 0xee, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf7, 0xf7, 0xf7, 0xf9, 0xf7, 0xee, 0xea, 0xde, 0xde,
-    0xde, 0xde, 0xde, 0xde, 0xf7, 0xf7, 0xea, 0xda, 0xea, 0xf9, 0xf3, 0xe9,
-    0xe9, 0xf3, 0xf7, 0xf3, 0xde, 0xe0, 0xd9, 0xd9, 0xe9, 0xd9, 0xd9, 0xe1,
-    0xe5, 0xf2, 0xe5, 0xdb, 0xd9, 0xda, 0xd9, 0xd9, 0xda, 0xda, 0xda, 0xd9,
-    0xd1, 0xd5, 0xda, 0xd5, 0xd1, 0xd5, 0xe9, 0xdb, 0xd5, 0xd4, 0xd4, 0xd4,
-    0xd1, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd5, 0xd1, 0xd5, 0xd1, 0xd5, 0xd1, 0xd5, 0xd5,
-    0xd1, 0xd5, 0xd1, 0xd5, 0xd1, 0xd5, 0xd1, 0xd1, 0xd1, 0xd5, 0xd1, 0xd5,
-    0xd4, 0xd4, 0xd1, 0xd5, 0xd1, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd1, 0xd5, 0xd5, 0xd5, 0xd1, 0xd5,
-    0xd6, 0xd6, 0xda, 0xda, 0xda, 0xd1, 0xda, 0xda, 0xda, 0xda, 0xda, 0xde,
-    0xda, 0xde, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda,
-    0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0xd6,
-    0xd6, 0xd1, 0xd5, 0xd4, 0xd4, 0xd4, 0xd5, 0xd5, 0xd5, 0xde, 0xde, 0xde,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0xc7, 0xf3,
-    0xee, 0x8e, 0x17, 0x0e, 0x28, 0x6c, 0x54, 0x14, 0x1c, 0x19, 0x19, 0x1f,
-    0x1e, 0x33, 0x35, 0x35, 0x36, 0x36, 0x4b, 0x4b, 0x35, 0x35, 0x36, 0x4b,
-    0x4e, 0xae, 0x59, 0x1c, 0x4e, 0x38, 0x38, 0x42, 0x3d, 0x6e, 0x8e, 0x5a,
-    0x59, 0x72, 0x72, 0x6d, 0xa4, 0xf8, 0xfd, 0xff, 0xf9, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xfe, 0xfa, 0xfa, 0xf7, 0xf7, 0xf7, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf7, 0xf7, 0xf7, 0xee, 0xee,
-    0xf3, 0xf9, 0xde, 0xde, 0xea, 0xee, 0xee, 0xf7, 0xf9, 0xff, 0xfd, 0xfd,
-    0xf7, 0xf7, 0xf9, 0xf9, 0xee, 0xe1, 0xd1, 0xde, 0xde, 0xde, 0xde, 0xde,
-    0xee, 0xf9, 0xee, 0xde, 0xde, 0xf7, 0xf7, 0xef, 0xe0, 0xef, 0xf7, 0xf7,
-    0xea, 0xe0, 0xde, 0xdb, 0xe0, 0xc8, 0x6d, 0x6d, 0xa4, 0xd3, 0xe5, 0x7b,
-    0x6c, 0xc0, 0xdb, 0xda, 0xde, 0xde, 0xc7, 0x71, 0x71, 0xa6, 0xda, 0xda,
-    0xd5, 0xd5, 0xdb, 0xdb, 0x88, 0x6c, 0x55, 0x71, 0x55, 0x55, 0x55, 0x87,
-    0xd4, 0xd4, 0xc4, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x87,
-    0xd4, 0xd4, 0xc4, 0x71, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xc0,
-    0xd5, 0xd1, 0xc0, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xc0,
-    0xd5, 0xd1, 0xa6, 0x87, 0xd4, 0xd4, 0xd4, 0x71, 0xc4, 0xd4, 0xd4, 0xc4,
-    0x55, 0xd4, 0xd4, 0xc4, 0x71, 0xd4, 0xd4, 0xc4, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0xc4, 0xd4, 0xd4, 0xd1, 0x71, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x87, 0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0xda, 0xda,
-    0xc0, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x87, 0x87, 0xda, 0xda, 0xda,
-    0xd1, 0x87, 0x71, 0x71, 0x55, 0x71, 0x55, 0x55, 0xa6, 0xda, 0xda, 0xda,
-    0xa6, 0x55, 0xc0, 0xda, 0xda, 0xd1, 0xd5, 0xc0, 0x34, 0x87, 0xd1, 0xd5,
-    0xd5, 0xd1, 0xd5, 0xd5, 0xd5, 0xd1, 0xd5, 0xda, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x01, 0x01, 0x08, 0x02, 0x02, 0x00, 0x02, 0x00, 0x02, 0x02,
-    0x02, 0x08, 0x02, 0x05, 0x0a, 0xa0, 0xee, 0xee, 0xae, 0x17, 0x17, 0x17,
-    0x6d, 0x25, 0x28, 0x1c, 0x2b, 0x41, 0x34, 0x36, 0x36, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x36, 0x36, 0x36, 0x4b, 0x4b, 0x4b, 0x72, 0x59, 0xc8, 0x2b, 0x1c,
-    0x6d, 0x4e, 0x38, 0x59, 0x3b, 0xae, 0x6e, 0x42, 0x59, 0x72, 0x72, 0x5a,
-    0xd3, 0xf8, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd,
-    0xfe, 0xfa, 0xfa, 0xfa, 0xf7, 0xf7, 0xf7, 0xf7, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xff, 0xf9, 0xf9, 0xf7, 0xf7, 0xea, 0xee, 0xf7, 0xf7, 0xea, 0xd1,
-    0xea, 0xea, 0xea, 0xf7, 0xf9, 0xff, 0xf9, 0xfd, 0xf9, 0xf7, 0xf9, 0xf9,
-    0xf3, 0xc7, 0xc4, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xf9, 0xf3, 0xde,
-    0xda, 0xda, 0xf9, 0xf3, 0xe9, 0xe9, 0xf3, 0xf9, 0xf3, 0xdb, 0xe9, 0xdb,
-    0xd9, 0xe1, 0xae, 0x88, 0xa9, 0xd3, 0xdf, 0xdf, 0xa4, 0x88, 0xda, 0xd4,
-    0xd4, 0xd4, 0x87, 0xc4, 0xc4, 0x87, 0xc0, 0xda, 0xd5, 0xd5, 0xdb, 0xdb,
-    0xdb, 0x88, 0x88, 0x87, 0xa6, 0x87, 0x71, 0x55, 0xd4, 0xd4, 0xd1, 0x87,
-    0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0xc4, 0xd5, 0xd5, 0xd1, 0xa6,
-    0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x41, 0x87, 0xd5, 0xd5, 0xa6, 0x41,
-    0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0xd1, 0xd4, 0xd4, 0x87, 0x55,
-    0xd4, 0xd4, 0xd1, 0x55, 0xc0, 0xd4, 0xd4, 0xc4, 0x34, 0xd1, 0xd5, 0xc0,
-    0x55, 0xd1, 0xd1, 0xd1, 0xc0, 0xc4, 0xd1, 0xd1, 0xc4, 0xd1, 0xc4, 0xa6,
-    0x55, 0xd4, 0xd4, 0xc4, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
-    0xc0, 0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0xd6, 0xd6, 0x41, 0xa6, 0xd1, 0xd1,
-    0xd1, 0xd1, 0xd1, 0xd1, 0xda, 0xda, 0xda, 0xda, 0x71, 0xa6, 0xda, 0xd1,
-    0xd1, 0xd1, 0xd1, 0xd1, 0x55, 0xc0, 0xda, 0xda, 0x71, 0x87, 0x54, 0xc4,
-    0xda, 0xda, 0xc0, 0x34, 0x71, 0x41, 0xd1, 0xd5, 0xd5, 0xd1, 0xd5, 0xd4,
-    0xd4, 0xd4, 0xd5, 0xd5, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x08, 0x05, 0x19, 0x0a,
-    0x6d, 0xee, 0xee, 0xe1, 0x28, 0x17, 0x25, 0x17, 0x6d, 0x5a, 0x1c, 0x0d,
-    0x0a, 0x19, 0x0f, 0x1e, 0x1e, 0x33, 0x35, 0x4b, 0x4b, 0x4b, 0x4e, 0x36,
-    0x33, 0x4b, 0x72, 0x38, 0x6d, 0xae, 0x1c, 0x4e, 0x42, 0x42, 0x42, 0x42,
-    0x57, 0xae, 0x6e, 0x59, 0x59, 0x8e, 0x6d, 0x5a, 0xe0, 0xfb, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfa, 0xfa,
-    0xf7, 0xf7, 0xf7, 0xf7, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf7, 0xea, 0xea, 0xf3, 0xf9, 0xee, 0xee, 0xee, 0xea, 0xea, 0xf3,
-    0xf9, 0xf9, 0xff, 0xf9, 0xf9, 0xf3, 0xf9, 0xf9, 0xf3, 0xde, 0xc4, 0xde,
-    0xde, 0xde, 0xde, 0xde, 0xde, 0xf3, 0xf9, 0xea, 0xde, 0x87, 0xf7, 0xf7,
-    0xef, 0xe0, 0xee, 0xf7, 0xf7, 0xea, 0xe0, 0xe0, 0xc7, 0x6d, 0xd9, 0x88,
-    0xa9, 0xa9, 0xdf, 0xdf, 0xe5, 0xdb, 0xdb, 0xd4, 0xc4, 0x71, 0xc4, 0xc4,
-    0xc0, 0xc4, 0x71, 0xc0, 0xd5, 0xda, 0xd1, 0x3f, 0xc0, 0xc7, 0xa6, 0xa6,
-    0x87, 0xa6, 0xc0, 0xd1, 0xd4, 0xd4, 0xc0, 0x11, 0x71, 0x87, 0x87, 0x87,
-    0x87, 0x87, 0x87, 0xc4, 0xd5, 0xd1, 0xc4, 0x34, 0x87, 0x87, 0x87, 0x71,
-    0x41, 0x08, 0x71, 0xd1, 0xd5, 0xd1, 0xd1, 0xa6, 0x87, 0x87, 0x87, 0x87,
-    0x87, 0x87, 0x55, 0x71, 0xd4, 0xd4, 0xc0, 0x41, 0xc4, 0xd1, 0xc4, 0x55,
-    0x87, 0xd1, 0xc4, 0xa6, 0x41, 0xd5, 0xd5, 0xc0, 0x55, 0xd5, 0xd1, 0xc0,
-    0x55, 0xc4, 0xd1, 0xc4, 0xd1, 0xc4, 0xd1, 0xa6, 0x55, 0xd4, 0xd4, 0xc0,
-    0x24, 0x71, 0x87, 0x71, 0x87, 0x87, 0x87, 0x87, 0xc0, 0xd5, 0xd5, 0xd5,
-    0xd1, 0xd5, 0xd5, 0xd5, 0x41, 0xa6, 0xd1, 0xd1, 0xda, 0xd1, 0xc7, 0xd1,
-    0xda, 0xda, 0xda, 0xda, 0x71, 0xa6, 0xda, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1,
-    0x55, 0xc0, 0xd1, 0xda, 0x54, 0xc0, 0xc7, 0x71, 0xa6, 0xc0, 0x41, 0xa6,
-    0xa6, 0x55, 0xd1, 0xd5, 0xd5, 0xd1, 0xd1, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x02, 0x02,
-    0x02, 0x02, 0x08, 0x05, 0x19, 0x0a, 0x0a, 0x42, 0xee, 0xee, 0xee, 0xae,
-    0x28, 0x17, 0x28, 0x17, 0x40, 0x0e, 0x59, 0x05, 0x0a, 0x19, 0x1f, 0x0f,
-    0x1e, 0x1a, 0x35, 0x35, 0x35, 0x4b, 0x4b, 0x36, 0x33, 0x33, 0x4e, 0x72,
-    0xae, 0x59, 0x1c, 0x4e, 0x42, 0x42, 0x42, 0x40, 0x6e, 0xae, 0x59, 0x71,
-    0x6d, 0x8e, 0x5a, 0x6e, 0xe9, 0xfb, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xfd, 0xf9, 0xfd, 0xfe, 0xf4, 0xfa, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xf7, 0xea, 0xde,
-    0xea, 0xf9, 0xde, 0xd1, 0xee, 0xea, 0xde, 0xee, 0xf9, 0xf9, 0xf9, 0xf7,
-    0xf9, 0xf3, 0xf7, 0xf9, 0xf5, 0xea, 0xc0, 0xc0, 0xa6, 0xa6, 0x87, 0xa6,
-    0xa6, 0xd5, 0xf9, 0xee, 0xde, 0xc0, 0xde, 0xfd, 0xe9, 0xa9, 0xc0, 0xf3,
-    0xfa, 0xf3, 0xde, 0xde, 0xc7, 0x88, 0xe0, 0xe0, 0xdb, 0xdb, 0xe5, 0xe5,
-    0xf2, 0xe9, 0xdb, 0xd4, 0x87, 0xc0, 0xd4, 0xd1, 0xc0, 0xd5, 0xc0, 0x71,
-    0xd5, 0xda, 0xd5, 0x71, 0xc4, 0xea, 0xde, 0xdb, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd1, 0xc4, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x87,
-    0xd1, 0xd5, 0xc4, 0x55, 0xd1, 0xd5, 0xd1, 0xd5, 0xd1, 0xc0, 0x55, 0xa6,
-    0xd1, 0xd5, 0xd1, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa6,
-    0xd4, 0xd4, 0xd4, 0x55, 0x55, 0x55, 0x55, 0x24, 0x24, 0x55, 0x55, 0x55,
-    0xc0, 0xd5, 0xd1, 0xc4, 0x87, 0xd1, 0xd5, 0xc0, 0x27, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0xc0, 0xd4, 0xd4, 0xd1, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x41, 0x87, 0xd5, 0xd5, 0xc4, 0x71, 0xc4, 0xd1, 0xd5,
-    0xc0, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x71, 0xc7, 0xda, 0xda,
-    0xc7, 0x71, 0x71, 0x71, 0x55, 0x55, 0x55, 0x55, 0x87, 0xd1, 0xd5, 0xd1,
-    0x71, 0xc0, 0xda, 0xc7, 0x71, 0x87, 0xc4, 0xda, 0xc4, 0x71, 0xd5, 0xd1,
-    0xd5, 0xd5, 0xd5, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x05, 0x05,
-    0x0a, 0x0a, 0x2b, 0xe1, 0xee, 0xf3, 0x8e, 0x28, 0x28, 0x17, 0x6d, 0x28,
-    0x28, 0x42, 0x05, 0x19, 0x2b, 0x1f, 0x1e, 0x1e, 0x35, 0x35, 0x35, 0x35,
-    0x35, 0x36, 0x36, 0x1e, 0x4b, 0x4b, 0x38, 0x59, 0xae, 0x10, 0x4e, 0x34,
-    0x59, 0x59, 0x59, 0x40, 0xae, 0x6e, 0x59, 0x72, 0x6d, 0x8e, 0x58, 0xae,
-    0xef, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xfe,
-    0xfe, 0xf4, 0xfa, 0xfa, 0xf7, 0xf7, 0xf7, 0xf7, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf7, 0xf3, 0xee, 0xf3, 0xf9, 0xf3, 0xea,
-    0xee, 0xea, 0xea, 0xee, 0xf7, 0xf9, 0xf9, 0xf9, 0xf7, 0xf7, 0xf7, 0xf9,
-    0xf7, 0xf3, 0xea, 0xde, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xf7, 0xf7,
-    0xde, 0xde, 0xde, 0xf7, 0xf8, 0xe9, 0xdb, 0xea, 0xf7, 0xf4, 0xea, 0xde,
-    0xe1, 0xd9, 0xdb, 0xe9, 0xdb, 0xdb, 0xdb, 0xe9, 0xe5, 0xf2, 0xdb, 0xde,
-    0xde, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xda, 0xde, 0xda, 0xda, 0xd5, 0xd5,
-    0xd5, 0xd1, 0xe0, 0xde, 0xd5, 0xd4, 0xd4, 0xd6, 0xd6, 0xd1, 0xd5, 0xd1,
-    0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xd1, 0xd1, 0xd1, 0xd5, 0xd5, 0xd1, 0xd1,
-    0xd5, 0xd5, 0xd1, 0xd1, 0xd5, 0xd1, 0xd1, 0xd5, 0xd5, 0xd1, 0xd1, 0xd1,
-    0xc4, 0xd1, 0xc4, 0xd1, 0xc4, 0xc4, 0xd1, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd1, 0xc4, 0xc4, 0xd1, 0xc4, 0xc4, 0xd1, 0xd5, 0xda, 0xd5, 0xda, 0xda,
-    0xda, 0xd5, 0xd6, 0xd5, 0xd1, 0xc4, 0xc4, 0xd1, 0xc4, 0xd1, 0xc4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xd1,
-    0xd1, 0xd5, 0xd1, 0xd5, 0xd1, 0xd4, 0xd5, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1,
-    0xd1, 0xc4, 0xc4, 0xd1, 0xd1, 0xd5, 0xd1, 0xda, 0xda, 0xda, 0xda, 0xd1,
-    0xd1, 0xd1, 0xc4, 0xd4, 0xd4, 0xd4, 0xd5, 0xd5, 0xda, 0xda, 0xda, 0xda,
-    0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5,
-    0xd1, 0xd4, 0xd4, 0xd4, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
-    0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02,
-    0x02, 0x02, 0x08, 0x08, 0x08, 0x05, 0x19, 0x19, 0x1c, 0x1c, 0xc7, 0xee,
-    0xee, 0xc7, 0x28, 0x28, 0x5a, 0x29, 0x28, 0x54, 0x28, 0x42, 0x0a, 0x19,
-    0x1f, 0x1f, 0x36, 0x1e, 0x1a, 0x35, 0x36, 0x36, 0x36, 0x33, 0x36, 0x36,
-    0x33, 0x4e, 0x59, 0xae, 0x8e, 0x0e, 0x4e, 0x4e, 0x42, 0x42, 0x59, 0x6e,
-    0xae, 0x58, 0x6d, 0x72, 0x8e, 0x6d, 0x77, 0xc8, 0xf8, 0xfc, 0xfc, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xf9, 0xf7, 0xfe, 0xfe, 0xfa, 0xfa, 0xf7,
-    0xf5, 0xf7, 0xf7, 0xf7, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf7, 0xee, 0xee, 0xee, 0xf7, 0xf7, 0xea, 0xea, 0xee, 0xea, 0xea,
-    0xf7, 0xf9, 0xf9, 0xf9, 0xf9, 0xf7, 0xf3, 0xf9, 0xf9, 0xf3, 0xea, 0xe1,
-    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xee, 0xf7, 0xee, 0xde, 0xda, 0xf3,
-    0xf9, 0xef, 0xe9, 0xe9, 0xf3, 0xfa, 0xf4, 0xde, 0xe0, 0xe0, 0xdb, 0xdb,
-    0xe9, 0xd9, 0xda, 0xde, 0xe9, 0xe9, 0xef, 0xdb, 0xc7, 0xda, 0xda, 0xd1,
-    0xd5, 0xd4, 0xda, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xea,
-    0xdb, 0xd1, 0xd4, 0xd4, 0xd6, 0xd5, 0xd1, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd1, 0xd5, 0xd1, 0xd5, 0xd1, 0xd1, 0xd1, 0xd5,
-    0xd1, 0xd1, 0xd5, 0xd5, 0xd1, 0xd5, 0xd5, 0xd1, 0xd5, 0xd1, 0xd1, 0xd1,
-    0xd1, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd5, 0xd1, 0xd1,
-    0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda,
-    0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd1, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd1, 0xd4, 0xd4, 0xd5, 0xd1, 0xd1, 0xd5, 0xd5, 0xd1,
-    0xd1, 0xd5, 0xd1, 0xd1, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd1, 0xd1, 0xd5,
-    0xd1, 0xd5, 0xd1, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xd4,
-    0xd4, 0xd4, 0xd1, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xda,
-    0xda, 0xda, 0xda, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xd1, 0xd4, 0xd4, 0xd4,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x08, 0x08,
-    0x05, 0x05, 0x19, 0x19, 0x19, 0x8e, 0xee, 0xee, 0xe1, 0x42, 0x40, 0x28,
-    0x54, 0x5a, 0x88, 0x71, 0x59, 0x59, 0x1c, 0x2b, 0x1f, 0x1e, 0x1e, 0x1e,
-    0x35, 0x1a, 0x33, 0x36, 0x4b, 0x36, 0x4b, 0x4b, 0x4e, 0x42, 0x59, 0xc8,
-    0x40, 0x38, 0x4e, 0x4e, 0x42, 0x42, 0x59, 0x8e, 0xae, 0x6e, 0x6d, 0x72,
-    0xa0, 0x6d, 0x47, 0xd3, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xfd, 0xfd,
-    0xfd, 0xf9, 0xf4, 0xfe, 0xfe, 0xf4, 0xfa, 0xf7, 0xf5, 0xf7, 0xf7, 0xf7,
-    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf7, 0xf9, 0xf9, 0xf7, 0xf3, 0xee,
-    0xee, 0xf7, 0xf7, 0xde, 0xea, 0xea, 0xea, 0xea, 0xf7, 0xf7, 0xf9, 0xf9,
-    0xf7, 0xf4, 0xf3, 0xf9, 0xf9, 0xf7, 0xee, 0xea, 0xea, 0xde, 0xde, 0xd6,
-    0xde, 0xde, 0xde, 0xf9, 0xf7, 0xde, 0xda, 0xde, 0xf7, 0xf7, 0xe9, 0xe0,
-    0xea, 0xf7, 0xf7, 0xee, 0xde, 0xe9, 0xdb, 0xd9, 0xe9, 0xde, 0xda, 0xda,
-    0xe0, 0xe9, 0xef, 0xe9, 0xdb, 0xd9, 0xda, 0xda, 0xde, 0xde, 0xde, 0xda,
-    0xde, 0xda, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xea, 0xd5, 0xd4, 0xd4,
-    0xd1, 0xd5, 0xd5, 0xd5, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd5, 0xd5, 0xd1, 0xd1, 0xd5, 0xd1, 0xd1, 0xd5, 0xd1, 0xd5, 0xd5, 0xd1,
-    0xd5, 0xd5, 0xd5, 0xd5, 0xd1, 0xd1, 0xd1, 0xd5, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd5, 0xd1, 0xd1, 0xd1, 0xd5, 0xd1, 0xda, 0xda, 0xda,
-    0xda, 0xde, 0xde, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd6, 0xd5,
-    0xd5, 0xd1, 0xd5, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4, 0xd1, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd5, 0xd1, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd1, 0xd5,
-    0xd5, 0xd5, 0xd5, 0xd1, 0xd5, 0xd1, 0xd1, 0xd1, 0xd5, 0xd1, 0xd5, 0xd5,
-    0xda, 0xda, 0xda, 0xd6, 0xd5, 0xd5, 0xd5, 0xd1, 0xd4, 0xd1, 0xd5, 0xd5,
-    0xd5, 0xd5, 0xd5, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xda,
-    0xda, 0xda, 0xda, 0xd5, 0xd5, 0xd5, 0xd5, 0xd1, 0x02, 0x02, 0x02, 0x02,
-    0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x08, 0x08, 0x05, 0x05, 0x05, 0x0a, 0x0a,
-    0x59, 0xee, 0xee, 0xee, 0x2b, 0x0d, 0x54, 0x29, 0x54, 0x3f, 0x3f, 0x3f,
-    0x71, 0xa0, 0x42, 0x2b, 0x1f, 0x1e, 0x1e, 0x35, 0x36, 0x36, 0x4b, 0x4b,
-    0x4b, 0x4b, 0x4b, 0x4b, 0x38, 0x10, 0x45, 0xae, 0x0e, 0x4e, 0x4e, 0x42,
-    0x38, 0x59, 0x5a, 0xae, 0x8e, 0x5a, 0x6d, 0x72, 0xa0, 0x6e, 0x80, 0xe5,
-    0xf9, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xfd, 0xfe, 0xfd, 0xf9, 0xf4, 0xfe,
-    0xfe, 0xf4, 0xfa, 0xf7, 0xf5, 0xf7, 0xf7, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
-    0xf9, 0xf9, 0xf7, 0xf7, 0xf9, 0xf7, 0xf4, 0xeb, 0xf3, 0xf7, 0xf7, 0xde,
-    0xea, 0xea, 0xea, 0xea, 0xf3, 0xf7, 0xf9, 0xf9, 0xf7, 0xf7, 0xf3, 0xf7,
-    0xf9, 0xf7, 0xee, 0xea, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xf3,
-    0xf9, 0xea, 0xde, 0xda, 0xf3, 0xf9, 0xef, 0xe0, 0xe9, 0xf3, 0xf9, 0xf7,
-    0xde, 0xde, 0xe1, 0xd9, 0xd9, 0xea, 0xda, 0xda, 0xdb, 0xe9, 0xe9, 0xf2,
-    0xe0, 0xdb, 0xd5, 0xd5, 0xde, 0xde, 0xd5, 0xde, 0xde, 0xde, 0xd5, 0xd5,
-    0xd1, 0xd5, 0xd5, 0xd5, 0xd5, 0xea, 0xdb, 0xdb, 0xd5, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd5, 0xd1,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd1, 0xd5, 0xd5, 0xd1, 0xd1, 0xd1,
-    0xd1, 0xd4, 0xd4, 0xd4, 0xd6, 0xd6, 0xd6, 0xd6, 0xd4, 0xd4, 0xd5, 0xd1,
-    0xd5, 0xd5, 0xd5, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xde, 0xda, 0xda, 0xda,
-    0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd1,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd1, 0xd1, 0xd5, 0xd5, 0xd1, 0xd1, 0xd5,
-    0xd1, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd1, 0xd1, 0xd5, 0xd5, 0xd6,
-    0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd5, 0xd1, 0xd5, 0xd1, 0xd5,
-    0xd5, 0xd5, 0xda, 0xd5, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda,
-    0xda, 0xda, 0xda, 0xda, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
-    0x08, 0x11, 0x05, 0x05, 0x05, 0x05, 0x19, 0x42, 0xe1, 0xee, 0xee, 0xa0,
-    0x42, 0x0d, 0x3f, 0x3f, 0x54, 0x41, 0x54, 0x54, 0x2b, 0x42, 0x42, 0x38,
-    0x38, 0x36, 0x35, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x36, 0x36, 0x1e,
-    0x4e, 0x40, 0xb1, 0x45, 0x1c, 0x72, 0x4e, 0x59, 0x4e, 0x59, 0x6d, 0xae,
-    0x8a, 0x6e, 0x6d, 0xa0, 0xa0, 0x6e, 0xa4, 0xf2, 0xf9, 0xfc, 0xfc, 0xfc,
-    0xff, 0xff, 0xfd, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xf4, 0xfa, 0xfa,
-    0xf5, 0xf7, 0xf7, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf7, 0xf7,
-    0xf9, 0xf7, 0xf4, 0xeb, 0xee, 0xf7, 0xf9, 0xde, 0xde, 0xea, 0xde, 0xea,
-    0xee, 0xf7, 0xf9, 0xf9, 0xf7, 0xf7, 0xf4, 0xf3, 0xf9, 0xf9, 0xf3, 0xea,
-    0xea, 0xea, 0xde, 0xde, 0xda, 0xde, 0xde, 0xea, 0xf9, 0xf3, 0xde, 0xd9,
-    0xde, 0xf9, 0xf3, 0xe9, 0xe0, 0xea, 0xf7, 0xf7, 0xee, 0xde, 0xe1, 0xd9,
-    0xd9, 0xe1, 0xe9, 0xdb, 0xdb, 0xe0, 0xe9, 0xe5, 0xef, 0xdb, 0xda, 0xd5,
-    0xd5, 0xd4, 0xde, 0xde, 0xde, 0xde, 0xde, 0xda, 0xd5, 0xd5, 0xd5, 0xd1,
-    0xd5, 0xda, 0xe9, 0xdb, 0xd5, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd1, 0xd1, 0xd1, 0xd5, 0xd1, 0xd1, 0xd4, 0xd4, 0xd4, 0xd4,
-    0xd6, 0xd6, 0xd6, 0xd6, 0xd4, 0xd4, 0xd1, 0xd5, 0xd1, 0xd5, 0xd5, 0xd5,
-    0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda,
-    0xda, 0xda, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd1, 0xd5, 0xd4, 0xd4, 0xd4,
-    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd1, 0xd5, 0xd5, 0xd5,
-    0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd1, 0xd5, 0xd1, 0xd5, 0xd1, 0xd5,
-    0xd5, 0xd1, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6,
-    0xd6, 0xd6, 0xd6, 0xd6, 0xd4, 0xd4, 0xd4, 0xd1, 0xd5, 0xd1, 0xda, 0xda,
-    0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xde, 0xda, 0xda, 0xda, 0xda, 0xda,
-};
@@ -0,0 +1,433 @@
+//*****************************************************************************
+//
+// telemetry.c - Binary UART telemetry stream.
+//
+// The received registers, the frame statistics of the derived metrics and
+// the link counters are sent on UART0 as COBS encoded frames.  A frame is
+//
+//     type (1) | sequence (2) | time in ms (4) | payload | CRC-16 (2)
+//
+// with all fields little-endian and the CRC-16/CCITT (polynomial 0x1021,
+// initial value 0xFFFF) taken over everything before it.  After COBS
+// encoding a frame contains no zero bytes, and each one is sent between two
+// zero delimiters.  Console text contains no zero bytes either, so text and
+// frames can share the UART: a receiver treats any run between delimiters
+// that does not decode to a frame with a good CRC as text.  The sequence
+// number counts every frame, whatever its type, so a receiver can tell when
+// frames have been lost.  Frames are queued on the interrupt driven
+// transmitter (see serial.c), which drops a frame rather than wait when its
+// buffer is full; the dropped frame still uses its sequence number.
+//
+// The register frames are delta encoded.  A key frame carries all
+// TLM_NUM_REGS registers; a delta frame carries only the registers that
+// changed since they were last sent, as pairs of the register index and the
+// difference, and is not sent at all when nothing has changed.  Register
+// values and differences are sent as zig-zag varints, so small values and
+// small changes take one byte.  A key frame is sent every TLM_KEY_PERIOD_MS;
+// a receiver that has lost a frame ignores the delta frames until then.
+//
+// The metrics frame carries the frame sample count, the bit error counters
+// and, for each alarm channel, the alarm level and the last, minimum,
+// maximum and mean values as IEEE-754 single precision floats.  The link
+// frame carries a count followed by that many 32-bit counters (TLM_LINK_*).
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup telemetry_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "defines.h"
+#include "alarm.h"
+#include "acquire.h"
+#include "serial.h"
+#include "telemetry.h"
+
+//*****************************************************************************
+//
+// The largest frame before encoding: a key frame with every register taking
+// the longest varint.
+//
+//*****************************************************************************
+#define TLM_HEADER_SIZE         7
+#define TLM_MAX_FRAME           (TLM_HEADER_SIZE + 1 + (TLM_NUM_REGS * 6) + 2)
+
+//*****************************************************************************
+//
+// The frame being built and its encoded form, which grows by one byte per
+// 254 bytes of frame plus the two delimiters.
+//
+//*****************************************************************************
+static uint8_t g_pui8TlmFrame[TLM_MAX_FRAME];
+static uint8_t g_pui8TlmCOBS[TLM_MAX_FRAME + (TLM_MAX_FRAME / 254) + 3];
+static uint32_t g_ui32TlmLength;
+
+//*****************************************************************************
+//
+// The stream state: whether it is enabled, the next sequence number, the
+// register values last sent and the time of the last key frame.
+//
+//*****************************************************************************
+static bool g_bTlmEnabled;
+static uint16_t g_ui16TlmSeq;
+static int32_t g_pi32TlmSent[TLM_NUM_REGS];
+static bool g_bTlmKeyDue;
+static uint32_t g_ui32TlmKeyTime;
+
+//*****************************************************************************
+//
+// The number of frames and bytes sent.
+//
+//*****************************************************************************
+static uint32_t g_ui32TlmFrames;
+static uint32_t g_ui32TlmBytes;
+
+//*****************************************************************************
+//
+// Computes the CRC-16/CCITT of a buffer.
+//
+//*****************************************************************************
+static uint16_t
+TelemetryCRC(const uint8_t *pui8Data, uint32_t ui32Length)
+{
+    uint16_t ui16CRC;
+    uint32_t ui32Bit;
+
+    ui16CRC = 0xFFFF;
+    while(ui32Length--)
+    {
+        ui16CRC ^= (uint16_t)*pui8Data++ << 8;
+        for(ui32Bit = 0; ui32Bit < 8; ui32Bit++)
+        {
+            ui16CRC = ((ui16CRC & 0x8000) ? ((ui16CRC << 1) ^ 0x1021) :
+                       (ui16CRC << 1));
+        }
+    }
+
+    return(ui16CRC);
+}
+
+//*****************************************************************************
+//
+// Appends bytes, little-endian values and varints to the frame being built.
+//
+//*****************************************************************************
+static void
+TelemetryPut8(uint32_t ui32Value)
+{
+    g_pui8TlmFrame[g_ui32TlmLength++] = (uint8_t)ui32Value;
+}
+
+static void
+TelemetryPut16(uint32_t ui32Value)
+{
+    TelemetryPut8(ui32Value);
+    TelemetryPut8(ui32Value >> 8);
+}
+
+static void
+TelemetryPut32(uint32_t ui32Value)
+{
+    TelemetryPut16(ui32Value);
+    TelemetryPut16(ui32Value >> 16);
+}
+
+static void
+TelemetryPutFloat(float fValue)
+{
+    uint32_t ui32Value;
+
+    memcpy(&ui32Value, &fValue, sizeof(ui32Value));
+    TelemetryPut32(ui32Value);
+}
+
+static void
+TelemetryPutVarint(int32_t i32Value)
+{
+    uint32_t ui32Value;
+
+    //
+    // Zig-zag encode so that small negative values are small too, then send
+    // seven bits at a time, least significant first, with the top bit set on
+    // all but the last byte.
+    //
+    ui32Value = ((uint32_t)i32Value << 1) ^ (uint32_t)(i32Value >> 31);
+    while(ui32Value >= 0x80)
+    {
+        TelemetryPut8((ui32Value & 0x7F) | 0x80);
+        ui32Value >>= 7;
+    }
+    TelemetryPut8(ui32Value);
+}
+
+//*****************************************************************************
+//
+// Starts a frame of the given type.
+//
+//*****************************************************************************
+static void
+TelemetryStart(uint32_t ui32Type, uint32_t ui32Now)
+{
+    g_ui32TlmLength = 0;
+    TelemetryPut8(ui32Type);
+    TelemetryPut16(g_ui16TlmSeq);
+    TelemetryPut32(ui32Now);
+}
+
+//*****************************************************************************
+//
+// Adds the CRC to the frame being built, COBS encodes it and queues it on the
+// UART.  Returns false if the frame was dropped because the UART transmit
+// buffer was full.  The frame uses its sequence number either way, so that
+// the receiver sees the loss.
+//
+//*****************************************************************************
+static bool
+TelemetryFinish(void)
+{
+    uint32_t ui32In, ui32Out, ui32Code;
+
+    TelemetryPut16(TelemetryCRC(g_pui8TlmFrame, g_ui32TlmLength));
+
+    //
+    // COBS: each zero byte is replaced by the distance to the next zero,
+    // with a code byte in front of the first block.  A block holds at most
+    // 254 non-zero bytes.
+    //
+    g_pui8TlmCOBS[0] = 0;
+    ui32Code = 1;
+    ui32Out = 2;
+    for(ui32In = 0; ui32In < g_ui32TlmLength; ui32In++)
+    {
+        if(g_pui8TlmFrame[ui32In] != 0)
+        {
+            g_pui8TlmCOBS[ui32Out++] = g_pui8TlmFrame[ui32In];
+        }
+        if((g_pui8TlmFrame[ui32In] == 0) ||
+           ((ui32Out - ui32Code) == 0xFF))
+        {
+            g_pui8TlmCOBS[ui32Code] = ui32Out - ui32Code;
+            ui32Code = ui32Out++;
+        }
+    }
+    g_pui8TlmCOBS[ui32Code] = ui32Out - ui32Code;
+    g_pui8TlmCOBS[ui32Out++] = 0;
+
+    g_ui16TlmSeq++;
+    if(!SerialWrite(g_pui8TlmCOBS, ui32Out))
+    {
+        return(false);
+    }
+
+    g_ui32TlmFrames++;
+    g_ui32TlmBytes += ui32Out;
+    return(true);
+}
+
+//*****************************************************************************
+//
+//! Initializes the telemetry stream.
+//!
+//! \param bEnable is \b true to start sending at once.
+//!
+//! SerialInit() must have been called before this function.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TelemetryInit(bool bEnable)
+{
+    g_ui16TlmSeq = 0;
+    g_ui32TlmFrames = 0;
+    g_ui32TlmBytes = 0;
+
+    TelemetryEnable(bEnable);
+}
+
+//*****************************************************************************
+//
+//! Starts or stops the telemetry stream.
+//!
+//! \param bEnable is \b true to send telemetry frames.
+//!
+//! The first register frame after the stream is started is a key frame.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TelemetryEnable(bool bEnable)
+{
+    g_bTlmEnabled = bEnable;
+    g_bTlmKeyDue = true;
+}
+
+//*****************************************************************************
+//
+//! Returns \b true if the telemetry stream is enabled.
+//
+//*****************************************************************************
+bool
+TelemetryIsEnabled(void)
+{
+    return(g_bTlmEnabled);
+}
+
+//*****************************************************************************
+//
+//! Sends the received registers.
+//!
+//! \param pi32Regs points to the first of TLM_NUM_REGS registers.
+//! \param ui32Now is the current time in milliseconds.
+//!
+//! This function sends a key frame if one is due and a delta frame of the
+//! registers that changed since they were last sent otherwise.  Nothing is
+//! sent if no register has changed.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TelemetryRegistersSend(const int32_t *pi32Regs, uint32_t ui32Now)
+{
+    uint32_t ui32Idx;
+    int32_t i32Value;
+
+    if(!g_bTlmEnabled)
+    {
+        return;
+    }
+
+    if(g_bTlmKeyDue || ((ui32Now - g_ui32TlmKeyTime) >= TLM_KEY_PERIOD_MS))
+    {
+        TelemetryStart(TLM_TYPE_KEY, ui32Now);
+        TelemetryPut8(TLM_NUM_REGS);
+        for(ui32Idx = 0; ui32Idx < TLM_NUM_REGS; ui32Idx++)
+        {
+            i32Value = pi32Regs[ui32Idx];
+            TelemetryPutVarint(i32Value);
+            g_pi32TlmSent[ui32Idx] = i32Value;
+        }
+        g_bTlmKeyDue = !TelemetryFinish();
+        g_ui32TlmKeyTime = ui32Now;
+        return;
+    }
+
+    TelemetryStart(TLM_TYPE_DELTA, ui32Now);
+    for(ui32Idx = 0; ui32Idx < TLM_NUM_REGS; ui32Idx++)
+    {
+        i32Value = pi32Regs[ui32Idx];
+        if(i32Value != g_pi32TlmSent[ui32Idx])
+        {
+            TelemetryPut8(ui32Idx);
+            TelemetryPutVarint(i32Value - g_pi32TlmSent[ui32Idx]);
+            g_pi32TlmSent[ui32Idx] = i32Value;
+        }
+    }
+    if(g_ui32TlmLength > TLM_HEADER_SIZE)
+    {
+        //
+        // The receiver ignores delta frames after a lost frame, so resend
+        // all registers as soon as possible.
+        //
+        g_bTlmKeyDue = !TelemetryFinish();
+    }
+}
+
+//*****************************************************************************
+//
+//! Sends the statistics of a display frame.
+//!
+//! \param psFrame points to the frame statistics.
+//! \param ui32Now is the current time in milliseconds.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TelemetryMetricsSend(const tAcqFrame *psFrame, uint32_t ui32Now)
+{
+    uint32_t ui32Idx;
+
+    if(!g_bTlmEnabled)
+    {
+        return;
+    }
+
+    TelemetryStart(TLM_TYPE_METRICS, ui32Now);
+    TelemetryPut32(psFrame->ui32Samples);
+    TelemetryPut32(psFrame->ui32ErrorCount);
+    TelemetryPut32(psFrame->ui32BitCount);
+    TelemetryPut8(NUM_ALARMS);
+    for(ui32Idx = 0; ui32Idx < NUM_ALARMS; ui32Idx++)
+    {
+        TelemetryPut8(AlarmLevelGet(ui32Idx));
+        TelemetryPutFloat(psFrame->psMetric[ui32Idx].fLast);
+        TelemetryPutFloat(psFrame->psMetric[ui32Idx].fMin);
+        TelemetryPutFloat(psFrame->psMetric[ui32Idx].fMax);
+        TelemetryPutFloat(psFrame->psMetric[ui32Idx].fMean);
+    }
+    TelemetryFinish();
+}
+
+//*****************************************************************************
+//
+//! Sends the link counters.
+//!
+//! \param pui32Counters points to the counters, in TLM_LINK_* order.
+//! \param ui32Count is the number of counters.
+//! \param ui32Now is the current time in milliseconds.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TelemetryLinkSend(const uint32_t *pui32Counters, uint32_t ui32Count,
+                  uint32_t ui32Now)
+{
+    uint32_t ui32Idx;
+
+    if(!g_bTlmEnabled)
+    {
+        return;
+    }
+
+    TelemetryStart(TLM_TYPE_LINK, ui32Now);
+    TelemetryPut8(ui32Count);
+    for(ui32Idx = 0; ui32Idx < ui32Count; ui32Idx++)
+    {
+        TelemetryPut32(pui32Counters[ui32Idx]);
+    }
+    TelemetryFinish();
+}
+
+//*****************************************************************************
+//
+//! Gets the number of telemetry frames and bytes sent since TelemetryInit().
+//!
+//! \param pui32Frames points to storage for the number of frames.
+//! \param pui32Bytes points to storage for the number of bytes.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TelemetryCountsGet(uint32_t *pui32Frames, uint32_t *pui32Bytes)
+{
+    *pui32Frames = g_ui32TlmFrames;
+    *pui32Bytes = g_ui32TlmBytes;
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
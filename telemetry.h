@@ -0,0 +1,69 @@
+//*****************************************************************************
+//
+// telemetry.h - Prototypes for the binary UART telemetry stream.
+//
+//*****************************************************************************
+
+#ifndef __TELEMETRY_H__
+#define __TELEMETRY_H__
+
+//*****************************************************************************
+//
+// The telemetry frame types.  Every frame starts with the type, a 16-bit
+// sequence number shared by all types and the scheduler time in
+// milliseconds, and ends with a CRC-16 (see telemetry.c).
+//
+//*****************************************************************************
+#define TLM_TYPE_KEY            0x01        // All registers
+#define TLM_TYPE_DELTA          0x02        // Changed registers
+#define TLM_TYPE_METRICS        0x03        // Display frame statistics
+#define TLM_TYPE_LINK           0x04        // Link and stream counters
+
+//*****************************************************************************
+//
+// The number of received registers covered by the stream.  The SSI1 frame
+// carries a 6-bit register counter, so the link can address no more.
+//
+//*****************************************************************************
+#define TLM_NUM_REGS            64
+
+//*****************************************************************************
+//
+// The interval, in milliseconds, at which changed registers are sent and at
+// which all registers are sent again so that a recorder can join the stream
+// at any time.
+//
+//*****************************************************************************
+#define TLM_REG_PERIOD_MS       10
+#define TLM_KEY_PERIOD_MS       1000
+
+//*****************************************************************************
+//
+// The counters of the link frame, in order.
+//
+//*****************************************************************************
+#define TLM_LINK_FRAMES         0           // SSI1 frames received
+#define TLM_LINK_SYNC_ERRORS    1           // SSI1 sync errors
+#define TLM_LINK_FRAME_RATE     2           // Frames in the last second
+#define TLM_LINK_SYNC_RATE      3           // Sync errors in the last second
+#define TLM_LINK_TLM_FRAMES     4           // Telemetry frames sent
+#define TLM_LINK_TLM_BYTES      5           // Telemetry bytes sent
+#define TLM_LINK_UART_DROPS     6           // UART messages dropped
+#define TLM_LINK_UART_MAX_USED  7           // Most UART buffer bytes used
+#define NUM_TLM_LINK            8
+
+//*****************************************************************************
+//
+// Prototypes for the functions exported by the telemetry stream.
+//
+//*****************************************************************************
+extern void TelemetryInit(bool bEnable);
+extern void TelemetryEnable(bool bEnable);
+extern bool TelemetryIsEnabled(void);
+extern void TelemetryRegistersSend(const int32_t *pi32Regs, uint32_t ui32Now);
+extern void TelemetryMetricsSend(const tAcqFrame *psFrame, uint32_t ui32Now);
+extern void TelemetryLinkSend(const uint32_t *pui32Counters, uint32_t ui32Count,
+                              uint32_t ui32Now);
+extern void TelemetryCountsGet(uint32_t *pui32Frames, uint32_t *pui32Bytes);
+
+#endif // __TELEMETRY_H__
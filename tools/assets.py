@@ -0,0 +1,821 @@
+#!/usr/bin/env python3
+#******************************************************************************
+#
+# assets.py - Converts the images of assets/ to display formats.
+#
+# Each image listed in the manifest (assets/manifest.txt) is read from a PNG
+# file, or from a TivaWare image array in C source (such as the button
+# images of images.c), and converted to every candidate format:
+#
+#   8bpp    TivaWare IMAGE_FMT_8BPP_UNCOMP, with a palette of up to 256
+#           colors (exact when the image has no more)
+#   4bpp    TivaWare IMAGE_FMT_4BPP_UNCOMP, 16 colors, Floyd-Steinberg
+#           dithered
+#   rle     RLE_IMAGE_FMT_8BPP (see rleimage.h), lossy within the quality
+#           the manifest asks for
+#   rgb565  ASSET_FMT_RGB565 (see assetdraw.h), the pixels as the display
+#           takes them
+#   sprite  SPRITE_FMT_RGB565 (see sprite.h), runs of display format pixels,
+#           with skip runs for the transparent ones
+#
+# Images with transparent pixels (an alpha channel below half) can only be
+# sprites.
+# Every candidate is drawn with AssetDraw() in the host simulator
+# ("zc706sim --draw"), which gives the simulated cycles of the draw and the
+# pixels as the display shows them.  The quality of a candidate is its PSNR
+# against the source image as the display shows it, in RGB565.  Of the
+# candidates that keep the quality of the manifest, the smallest is picked,
+# the fastest for an image that prefers speed, or the one of the format the
+# manifest names.
+#
+# The picked candidates are written as C source (assets.c and assets.h), and
+# all of them to a report.  "make -C sim assets" runs the tool; with --check,
+# as "make -C sim test" runs it, nothing is written and the tool fails if the
+# files are not what it would write.  The picked images must fit the --budget
+# in bytes.
+#
+# The PNG reader takes 8 bit grayscale, RGB, palette, grayscale with alpha and
+# RGBA images, without interlace.  Nothing beyond the Python standard library is needed.
+#
+#******************************************************************************
+
+import argparse
+import io
+import math
+import os
+import re
+import shlex
+import struct
+import subprocess
+import sys
+import tempfile
+import zlib
+
+IMAGE_FMT_1BPP_UNCOMP = 0x01
+IMAGE_FMT_4BPP_UNCOMP = 0x04
+IMAGE_FMT_8BPP_UNCOMP = 0x08
+IMAGE_FMT_COMP = 0x80
+RLE_IMAGE_FMT_8BPP = 0x48
+ASSET_FMT_RGB565 = 0x50
+SPRITE_FMT_RGB565 = 0x51
+
+SPRITE_SKIP = 0x00
+SPRITE_LITERAL = 0x40
+SPRITE_RUN = 0x80
+SPRITE_SKIP_MAX = 0x40
+SPRITE_LITERAL_MAX = 0x40
+SPRITE_RUN_MAX = 0x80
+
+RLE_IMAGE_RUN_MIN = 3
+RLE_IMAGE_RUN_MAX = 0x7F + RLE_IMAGE_RUN_MIN
+RLE_IMAGE_LITERAL_MAX = 0x80
+TOLERANCE_MAX = 64
+
+PSNR_MAX = 99.0
+SIM_CLOCK_HZ = 80000000
+
+FORMATS = ("8bpp", "4bpp", "rle", "rgb565", "sprite")
+
+
+#
+# PNG input.
+#
+
+def png_read(path):
+    """Returns the width, height, (red, green, blue) pixels and opacity of
+    each pixel of a PNG."""
+    data = open(path, "rb").read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit("%s: not a PNG file" % path)
+    pos = 8
+    idat = b""
+    palette = []
+    while pos < len(data):
+        length, kind = struct.unpack_from(">I4s", data, pos)
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            (width, height, depth, ctype, _, _,
+             interlace) = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = [tuple(body[idx:idx + 3])
+                       for idx in range(0, len(body), 3)]
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(ctype)
+    if depth != 8 or channels is None or interlace:
+        sys.exit("%s: only 8 bit, non-interlaced PNGs are supported" % path)
+
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    rows = []
+    prior = bytearray(stride)
+    pos = 0
+    for _ in range(height):
+        kind = raw[pos]
+        row = bytearray(raw[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        for idx in range(stride):
+            left = row[idx - channels] if idx >= channels else 0
+            up = prior[idx]
+            if kind == 1:
+                row[idx] = (row[idx] + left) & 0xFF
+            elif kind == 2:
+                row[idx] = (row[idx] + up) & 0xFF
+            elif kind == 3:
+                row[idx] = (row[idx] + ((left + up) >> 1)) & 0xFF
+            elif kind == 4:
+                corner = prior[idx - channels] if idx >= channels else 0
+                guess = left + up - corner
+                dl, du, dc = (abs(guess - left), abs(guess - up),
+                              abs(guess - corner))
+                pred = left if dl <= du and dl <= dc else (
+                    up if du <= dc else corner)
+                row[idx] = (row[idx] + pred) & 0xFF
+        rows.append(row)
+        prior = row
+
+    pixels = []
+    opaque = []
+    for row in rows:
+        for idx in range(0, stride, channels):
+            if ctype == 3:
+                pixels.append(palette[row[idx]])
+            elif ctype in (0, 4):
+                pixels.append((row[idx],) * 3)
+            else:
+                pixels.append(tuple(row[idx:idx + 3]))
+            opaque.append(ctype not in (4, 6) or
+                          row[idx + channels - 1] >= 0x80)
+    return width, height, pixels, opaque
+
+
+#
+# Colors.
+#
+
+def rgb565(color):
+    """Returns a color in the display format, as DpyColorTranslate()."""
+    red, green, blue = color
+    return ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3)
+
+
+def shown(color):
+    """Returns a color as the display shows it, expanded to 8 bit channels."""
+    red, green, blue = color
+    return ((red & 0xF8) | (red >> 5), (green & 0xFC) | (green >> 6),
+            (blue & 0xF8) | (blue >> 5))
+
+
+def distance(color1, color2):
+    return ((color1[0] - color2[0]) ** 2 + (color1[1] - color2[1]) ** 2 +
+            (color1[2] - color2[2]) ** 2)
+
+
+def psnr(pixels1, pixels2):
+    error = sum(distance(a, b) for a, b in zip(pixels1, pixels2))
+    if not error:
+        return PSNR_MAX
+    return 10 * math.log10(255 * 255 * 3.0 * len(pixels1) / error)
+
+
+def median_cut(pixels, colors):
+    """Returns a palette of at most the given number of colors."""
+    histogram = {}
+    for color in pixels:
+        histogram[color] = histogram.get(color, 0) + 1
+    if len(histogram) <= colors:
+        return sorted(histogram)
+
+    boxes = [list(histogram.items())]
+    while len(boxes) < colors:
+        #
+        # Split the box with the widest channel range, weighted by pixels,
+        # at its median pixel.
+        #
+        def spread(box):
+            widest = max(max(c[ch] for c, _ in box) - min(c[ch] for c, _ in box)
+                         for ch in range(3))
+            return widest * sum(n for _, n in box) if len(box) > 1 else -1
+
+        box = max(boxes, key=spread)
+        if spread(box) < 0:
+            break
+        boxes.remove(box)
+        channel = max(range(3), key=lambda ch: max(c[ch] for c, _ in box) -
+                      min(c[ch] for c, _ in box))
+        box.sort(key=lambda item: item[0][channel])
+        half = sum(n for _, n in box) / 2.0
+        count = 0
+        for split, (_, n) in enumerate(box):
+            count += n
+            if count >= half:
+                break
+        split = min(max(split + 1, 1), len(box) - 1)
+        boxes += [box[:split], box[split:]]
+
+    palette = []
+    for box in boxes:
+        total = sum(n for _, n in box)
+        palette.append(tuple(int(round(sum(c[ch] * n for c, n in box) /
+                                       total)) for ch in range(3)))
+    return palette
+
+
+class Nearest:
+    """Finds the palette index nearest to a color, with a cache."""
+
+    def __init__(self, palette):
+        self.palette = palette
+        self.cache = {}
+
+    def __call__(self, color):
+        if color not in self.cache:
+            self.cache[color] = min(range(len(self.palette)),
+                                    key=lambda idx: distance(
+                                        self.palette[idx], color))
+        return self.cache[color]
+
+
+def quantize(width, height, pixels, colors, dither):
+    """Returns a palette and the palette index of each pixel."""
+    palette = median_cut(pixels, colors)
+    nearest = Nearest(palette)
+    if not dither:
+        return palette, [nearest(color) for color in pixels]
+
+    #
+    # Floyd-Steinberg: the error of each pixel is spread over the pixels to
+    # its right and below.
+    #
+    work = [list(color) for color in pixels]
+    indices = []
+    for y in range(height):
+        for x in range(width):
+            pos = (y * width) + x
+            color = tuple(min(255, max(0, int(round(v)))) for v in work[pos])
+            index = nearest(color)
+            indices.append(index)
+            error = [color[ch] - palette[index][ch] for ch in range(3)]
+            for dx, dy, weight in ((1, 0, 7), (-1, 1, 3), (0, 1, 5),
+                                   (1, 1, 1)):
+                if 0 <= x + dx < width and y + dy < height:
+                    other = work[pos + dx + (dy * width)]
+                    for ch in range(3):
+                        other[ch] += error[ch] * weight / 16.0
+    return palette, indices
+
+
+#
+# Encoders.  Each returns the bytes of the image in its format.
+#
+
+def header(fmt, width, height):
+    return bytearray([fmt, width & 0xFF, width >> 8, height & 0xFF,
+                      height >> 8])
+
+
+def tiva_palette(palette):
+    out = bytearray([len(palette) - 1])
+    for red, green, blue in palette:
+        out += bytes([blue, green, red])
+    return out
+
+
+def encode_8bpp(width, height, palette, indices):
+    return (header(IMAGE_FMT_8BPP_UNCOMP, width, height) +
+            tiva_palette(palette) + bytes(indices))
+
+
+def encode_4bpp(width, height, palette, indices):
+    out = header(IMAGE_FMT_4BPP_UNCOMP, width, height) + tiva_palette(palette)
+    for y in range(height):
+        row = indices[y * width:(y + 1) * width] + [0]
+        for x in range(0, width, 2):
+            out.append((row[x] << 4) | row[x + 1])
+    return out
+
+
+def encode_rgb565(width, height, pixels):
+    out = header(ASSET_FMT_RGB565, width, height)
+    for color in pixels:
+        value = rgb565(color)
+        out += bytes([value & 0xFF, value >> 8])
+    return out
+
+
+def encode_sprite(width, height, pixels, opaque):
+    """Returns a SPRITE_FMT_RGB565 sprite.  Each row is a series of skip runs
+    for the transparent pixels, runs of two or more equal pixels, and
+    literals for the rest; no token spans rows."""
+    out = header(SPRITE_FMT_RGB565, width, height)
+    for y in range(height):
+        row = [rgb565(color) if solid else None for color, solid in
+               zip(pixels[y * width:(y + 1) * width],
+                   opaque[y * width:(y + 1) * width])]
+        x = 0
+        literal = []
+
+        def flush():
+            if literal:
+                out.append(SPRITE_LITERAL + len(literal) - 1)
+                for value in literal:
+                    out.extend([value & 0xFF, value >> 8])
+                del literal[:]
+
+        while x < width:
+            end = x + 1
+            while end < width and row[end] == row[x]:
+                end += 1
+            if row[x] is None:
+                flush()
+                for start in range(x, end, SPRITE_SKIP_MAX):
+                    out.append(SPRITE_SKIP +
+                               min(end - start, SPRITE_SKIP_MAX) - 1)
+            elif end - x >= 2:
+                flush()
+                for start in range(x, end, SPRITE_RUN_MAX):
+                    out += bytes([SPRITE_RUN +
+                                  min(end - start, SPRITE_RUN_MAX) - 1,
+                                  row[x] & 0xFF, row[x] >> 8])
+            else:
+                literal.append(row[x])
+                if len(literal) == SPRITE_LITERAL_MAX:
+                    flush()
+            x = end
+        flush()
+    return out
+
+
+class RunLength:
+    """The RLE_IMAGE_FMT_8BPP encoder.  The photos have few runs of exactly
+    equal pixels, so the encoding is lossy: a run takes in every following
+    pixel as long as no color channel of the pixels in it spans more than
+    twice the tolerance, and is drawn with the palette color nearest to their
+    mean.  Pixels that do not form a run are kept as they are."""
+
+    def __init__(self, width, height, palette, indices):
+        self.width = width
+        self.height = height
+        self.palette = palette
+        self.indices = indices
+        self.shown = [shown(color) for color in palette]
+        self.nearest = Nearest(self.shown)
+        self.estimates = {}
+
+    def runs(self, tolerance):
+        """Splits the pixels into (start, end) runs and single pixels."""
+        pixels = [self.shown[idx] for idx in self.indices]
+        span = 2 * tolerance
+        count = len(pixels)
+        start = 0
+        while start < count:
+            red_lo = red_hi = pixels[start][0]
+            green_lo = green_hi = pixels[start][1]
+            blue_lo = blue_hi = pixels[start][2]
+            end = start + 1
+            while end < count and end - start < RLE_IMAGE_RUN_MAX:
+                red, green, blue = pixels[end]
+                red_lo, red_hi = min(red_lo, red), max(red_hi, red)
+                green_lo, green_hi = min(green_lo, green), max(green_hi, green)
+                blue_lo, blue_hi = min(blue_lo, blue), max(blue_hi, blue)
+                if (red_hi - red_lo > span or green_hi - green_lo > span or
+                        blue_hi - blue_lo > span):
+                    break
+                end += 1
+            if end - start < RLE_IMAGE_RUN_MIN:
+                end = start + 1
+            yield start, end
+            start = end
+
+    def estimate(self, tolerance):
+        """Returns about the PSNR against the palette image, without
+        encoding, as if each run were drawn in its exact mean color."""
+        if tolerance not in self.estimates:
+            error = 0.0
+            for start, end in self.runs(tolerance):
+                if end - start < RLE_IMAGE_RUN_MIN:
+                    continue
+                for ch in range(3):
+                    values = [self.shown[idx][ch] for idx in
+                              self.indices[start:end]]
+                    error += (sum(v * v for v in values) -
+                              (sum(values) ** 2) / len(values))
+            self.estimates[tolerance] = (
+                10 * math.log10(255 * 255 * 3.0 * len(self.indices) / error)
+                if error > 0 else PSNR_MAX)
+        return self.estimates[tolerance]
+
+    def tolerance_for(self, quality):
+        """Returns the highest tolerance that keeps about the PSNR."""
+        low, high = 0, TOLERANCE_MAX
+        while low < high:
+            mid = (low + high + 1) // 2
+            if self.estimate(mid) >= quality:
+                low = mid
+            else:
+                high = mid - 1
+        return low
+
+    def encode(self, tolerance):
+        """Returns the encoded image and its PSNR against the palette
+        image."""
+        out = header(RLE_IMAGE_FMT_8BPP, self.width, self.height)
+        out.append(len(self.palette) - 1)
+        for color in self.palette:
+            value = rgb565(color)
+            out += bytes([value & 0xFF, value >> 8])
+
+        error = 0
+        literal = []
+
+        def flush():
+            if literal:
+                out.append(len(literal) - 1)
+                out.extend(literal)
+                del literal[:]
+
+        for start, end in self.runs(tolerance):
+            if end - start < RLE_IMAGE_RUN_MIN:
+                literal.append(self.indices[start])
+                if len(literal) == RLE_IMAGE_LITERAL_MAX:
+                    flush()
+                continue
+            flush()
+            colors = [self.shown[idx] for idx in self.indices[start:end]]
+            mean = tuple(int(round(sum(c[ch] for c in colors) / len(colors)))
+                         for ch in range(3))
+            index = self.nearest(mean)
+            error += sum(distance(color, self.shown[index])
+                         for color in colors)
+            out += bytes([0x80 + end - start - RLE_IMAGE_RUN_MIN, index])
+        flush()
+        return out, (10 * math.log10(255 * 255 * 3.0 * len(self.indices) /
+                                     error) if error else PSNR_MAX)
+
+
+#
+# TivaWare image input.
+#
+
+def tiva_array(path, symbol):
+    """Returns the bytes of a const uint8_t array in C source."""
+    text = open(path).read()
+    text = re.sub(r"/\*.*?\*/|//[^\n]*", "", text, flags=re.S)
+    match = re.search(r"\b%s\s*\[\s*\]\s*=\s*\{(.*?)\}" %
+                      re.escape(symbol), text, re.S)
+    if not match:
+        sys.exit("%s: no array %s" % (path, symbol))
+    names = {"IMAGE_FMT_%dBPP_%s" % (bpp, kind):
+             bpp | (IMAGE_FMT_COMP if kind == "COMP" else 0)
+             for bpp in (1, 4, 8) for kind in ("COMP", "UNCOMP")}
+    data = []
+    for item in match.group(1).split(","):
+        item = item.strip()
+        if item:
+            data.append(names[item] if item in names else int(item, 0))
+    return data
+
+
+def tiva_decompress(data, size):
+    """Decodes the pixel data of a TivaWare compressed image, as
+    SimImageDecompress() in sim/grlib.c does."""
+    out = []
+    pos = 0
+    while len(out) < size:
+        flags = data[pos]
+        pos += 1
+        for item in range(8):
+            if len(out) >= size:
+                break
+            if not flags & (0x80 >> item):
+                out.append(data[pos])
+            else:
+                length = (data[pos] & 7) + 2
+                dist = 32 - (data[pos] >> 3)
+                for _ in range(length):
+                    out.append(out[-dist] if len(out) >= dist else 0)
+            pos += 1
+    return out[:size]
+
+
+def tiva_read(path, symbol):
+    """Returns the width, height, (red, green, blue) pixels and opacity of
+    each pixel of a TivaWare image array."""
+    data = tiva_array(path, symbol)
+    fmt = data[0]
+    width = data[1] | (data[2] << 8)
+    height = data[3] | (data[4] << 8)
+    bpp = fmt & ~IMAGE_FMT_COMP
+    if bpp not in (4, 8):
+        sys.exit("%s: %s is drawn in the context colors" % (path, symbol))
+    count = data[5] + 1
+    palette = [(data[idx + 2], data[idx + 1], data[idx])
+               for idx in range(6, 6 + (count * 3), 3)]
+    stride = ((width * bpp) + 7) // 8
+    data = data[6 + (count * 3):]
+    if fmt & IMAGE_FMT_COMP:
+        data = tiva_decompress(data, stride * height)
+    pixels = []
+    for y in range(height):
+        row = data[y * stride:(y + 1) * stride]
+        if bpp == 4:
+            row = [nibble for byte in row for nibble in (byte >> 4,
+                                                         byte & 0x0F)]
+        pixels += [palette[idx] for idx in row[:width]]
+    return width, height, pixels, [True] * len(pixels)
+
+
+def image_read(path):
+    """Reads a PNG file, or a TivaWare image given as <C file>:<array>."""
+    if ":" in os.path.basename(path):
+        path, symbol = path.rsplit(":", 1)
+        return tiva_read(path, symbol)
+    return png_read(path)
+
+
+#
+# The manifest and the pipeline.
+#
+
+class Asset:
+    """An image of the manifest."""
+
+    def __init__(self, line, base):
+        fields = line.split()
+        if (len(fields) != 4 or
+                fields[3] not in ("size", "speed") + FORMATS):
+            raise ValueError("expected <symbol> <image> <min dB> "
+                             "size|speed|<format>")
+        self.symbol = fields[0]
+        self.path = os.path.join(base, fields[1])
+        self.source = fields[1]
+        self.quality = float(fields[2])
+        self.prefer = fields[3]
+        self.candidates = []
+        self.pick = None
+
+
+class Candidate:
+    def __init__(self, name, data, note=""):
+        self.name = name
+        self.data = bytes(data)
+        self.note = note
+        self.cycles = None
+        self.psnr = None
+
+
+def manifest_read(path):
+    assets = []
+    base = os.path.dirname(path)
+    for number, line in enumerate(open(path), 1):
+        line = line.split("#")[0].strip()
+        if not line:
+            continue
+        try:
+            assets.append(Asset(line, base))
+        except ValueError as error:
+            sys.exit("%s:%d: %s" % (path, number, error))
+    return assets
+
+
+def candidates_make(asset, formats):
+    width, height, pixels, opaque = image_read(asset.path)
+    asset.width, asset.height = width, height
+
+    #
+    # The simulated display starts out black, which is what shows through
+    # the transparent pixels of a sprite.
+    #
+    asset.shown = [shown(color) if solid else (0, 0, 0)
+                   for color, solid in zip(pixels, opaque)]
+    if not all(opaque):
+        if "sprite" not in formats:
+            sys.exit("%s: transparent images need the sprite format" %
+                     asset.source)
+        asset.candidates.append(Candidate(
+            "sprite", encode_sprite(width, height, pixels, opaque),
+            "transparent"))
+        return
+    if "8bpp" in formats or "rle" in formats:
+        palette, indices = quantize(width, height, pixels, 256, False)
+        if "8bpp" in formats:
+            asset.candidates.append(Candidate(
+                "8bpp", encode_8bpp(width, height, palette, indices),
+                "%d colors" % len(palette)))
+        if "rle" in formats:
+            #
+            # The runs are drawn in the palette color nearest their mean, so
+            # the estimate is a little high: lower the tolerance until the
+            # encoding keeps the quality.
+            #
+            encoder = RunLength(width, height, palette, indices)
+            tolerance = encoder.tolerance_for(asset.quality)
+            data, quality = encoder.encode(tolerance)
+            while tolerance and quality < asset.quality:
+                tolerance -= 1
+                data, quality = encoder.encode(tolerance)
+            asset.candidates.append(Candidate(
+                "rle", data, "tolerance %d" % tolerance))
+    if "4bpp" in formats:
+        palette, indices = quantize(width, height, pixels, 16, True)
+        asset.candidates.append(Candidate(
+            "4bpp", encode_4bpp(width, height, palette, indices),
+            "dithered"))
+    if "rgb565" in formats:
+        asset.candidates.append(Candidate(
+            "rgb565", encode_rgb565(width, height, pixels)))
+    if "sprite" in formats:
+        asset.candidates.append(Candidate(
+            "sprite", encode_sprite(width, height, pixels, opaque)))
+
+
+def ppm_read(path, width, height):
+    data = open(path, "rb").read()
+    fields = data.split(b"\n", 3)
+    screen = int(fields[1].split()[0])
+    pixels = fields[3]
+    out = []
+    for y in range(height):
+        pos = y * screen * 3
+        out += [tuple(pixels[pos + (x * 3):pos + (x * 3) + 3])
+                for x in range(width)]
+    return out
+
+
+def candidates_measure(asset, sim, work):
+    """Draws each candidate in the simulator."""
+    for candidate in asset.candidates:
+        image = os.path.join(work, "%s.%s.bin" % (asset.symbol,
+                                                  candidate.name))
+        ppm = os.path.join(work, "%s.%s.ppm" % (asset.symbol, candidate.name))
+        open(image, "wb").write(candidate.data)
+        result = subprocess.run([sim, "--draw", image, "--ppm", ppm],
+                                stdout=subprocess.PIPE,
+                                universal_newlines=True)
+        fields = result.stdout.split()
+        if result.returncode or len(fields) != 2 or fields[0] != "cycles":
+            sys.exit("%s: %s draw failed" % (asset.symbol, candidate.name))
+        candidate.cycles = int(fields[1])
+        candidate.psnr = psnr(ppm_read(ppm, asset.width, asset.height),
+                              asset.shown)
+
+
+def candidate_pick(asset):
+    good = [c for c in asset.candidates if c.psnr >= asset.quality and
+            asset.prefer in ("size", "speed", c.name)]
+    if not good:
+        print("warning: %s: no candidate keeps %.1f dB" %
+              (asset.symbol, asset.quality), file=sys.stderr)
+        good = [max(asset.candidates, key=lambda c: c.psnr)]
+    if asset.prefer == "speed":
+        key = lambda c: (c.cycles, len(c.data))
+    else:
+        key = lambda c: (len(c.data), c.cycles)
+    asset.pick = min(good, key=key)
+
+
+def banner(name, lines):
+    out = "//" + "*" * 77 + "\n//\n// %s\n//\n" % name
+    for line in lines:
+        out += ("// " + line).rstrip() + "\n"
+    return out + "//\n//" + "*" * 77 + "\n"
+
+
+def source_write(out, path, assets, command):
+    lines = ["Generated from assets/manifest.txt by:", "",
+             "  " + command, "", "Do not edit."]
+    out.write(banner("%s - The images of the application, as picked by "
+                     "tools/assets.py." % os.path.basename(path), lines))
+    out.write("\n#include <stdint.h>\n\n")
+    for asset in assets:
+        pick = asset.pick
+        out.write("//\n// %s: %dx%d %s%s, %d bytes, %.1f dB.\n//\n"
+                  "const uint8_t %s[] =\n{" %
+                  (asset.source, asset.width, asset.height, pick.name,
+                   (" (" + pick.note + ")") if pick.note else "",
+                   len(pick.data), pick.psnr, asset.symbol))
+        for idx, byte in enumerate(pick.data):
+            out.write("%s0x%02x," % (" " if idx % 12 else "\n    ", byte))
+        out.write("\n};\n\n")
+
+
+def header_write(out, path, assets, command):
+    guard = "__%s__" % os.path.basename(path).upper().replace(".", "_")
+    out.write(banner("%s - Prototypes for the images of the application."
+                     % os.path.basename(path),
+                     ["Generated by " + command.split()[0] +
+                      "; do not edit."]))
+    out.write("\n#ifndef %s\n#define %s\n\n" % (guard, guard))
+    out.write("//" + "*" * 77 + "\n//\n// The images, to be drawn with "
+              "AssetDraw().\n//\n//" + "*" * 77 + "\n")
+    for asset in assets:
+        out.write("extern const uint8_t %s[];\n" % asset.symbol)
+    out.write("\n#endif // %s\n" % guard)
+
+
+def report_write(out, assets, budget):
+    out.write("%-24s %-7s %8s %9s %7s %7s %-6s %s\n" %
+              ("image", "format", "bytes", "cycles", "ms", "dB", "picked",
+               "note"))
+    for asset in assets:
+        for candidate in asset.candidates:
+            line = ("%-24s %-7s %8d %9d %7.2f %7.1f %-6s %s" %
+                    (asset.symbol, candidate.name, len(candidate.data),
+                     candidate.cycles,
+                     candidate.cycles * 1000.0 / SIM_CLOCK_HZ,
+                     candidate.psnr,
+                     "   *" if candidate is asset.pick else "",
+                     candidate.note))
+            out.write(line.rstrip() + "\n")
+    out.write("picked: %d bytes" % picked_size(assets))
+    if budget:
+        out.write(" of a budget of %d" % budget)
+    out.write("\n")
+
+
+def picked_size(assets):
+    return sum(len(asset.pick.data) for asset in assets)
+
+
+def output_put(path, text, check):
+    """Writes a file, or with check tells if it already holds the text."""
+    if not check:
+        with open(path, "w") as out:
+            out.write(text)
+        return True
+    try:
+        with open(path) as old:
+            return old.read() == text
+    except OSError:
+        return False
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert the images of the manifest to display "
+        "formats and pick the best for each.")
+    parser.add_argument("manifest", help="the image manifest")
+    parser.add_argument("--sim", required=True,
+                        help="the host simulator, to measure the draws")
+    parser.add_argument("-o", "--output", required=True,
+                        help="C source file to write; the header is written "
+                        "next to it")
+    parser.add_argument("--report", help="file to write the report to "
+                        "(default stdout)")
+    parser.add_argument("--formats", default=",".join(FORMATS),
+                        help="candidate formats (default %s)" %
+                        ",".join(FORMATS))
+    parser.add_argument("--budget", type=int, default=0,
+                        help="the most bytes the picked images may take")
+    parser.add_argument("--check", action="store_true",
+                        help="write nothing, fail if the output files are "
+                        "out of date")
+    args = parser.parse_args()
+
+    formats = args.formats.split(",")
+    for name in formats:
+        if name not in FORMATS:
+            sys.exit("unknown format %s" % name)
+
+    assets = manifest_read(args.manifest)
+    with tempfile.TemporaryDirectory() as work:
+        for asset in assets:
+            candidates_make(asset, formats)
+            candidates_measure(asset, args.sim, work)
+            candidate_pick(asset)
+
+    #
+    # The command is recorded in the output as "make -C sim assets" runs it,
+    # so that a check gives the same files.
+    #
+    command = " ".join(["tools/assets.py"] +
+                       [shlex.quote(arg) for arg in sys.argv[1:]
+                        if arg != "--check"])
+    outputs = []
+    for path, writer in ((args.output, source_write),
+                         (os.path.splitext(args.output)[0] + ".h",
+                          header_write)):
+        out = io.StringIO()
+        writer(out, path, assets, command)
+        outputs.append((path, out.getvalue()))
+    out = io.StringIO()
+    report_write(out, assets, args.budget)
+    if args.report:
+        outputs.append((args.report, out.getvalue()))
+    else:
+        sys.stdout.write(out.getvalue())
+
+    stale = [path for path, text in outputs
+             if not output_put(path, text, args.check)]
+    if stale:
+        sys.exit("out of date: %s" % " ".join(stale))
+    if args.budget and picked_size(assets) > args.budget:
+        sys.exit("the picked images take %d bytes, over the budget of %d" %
+                 (picked_size(assets), args.budget))
+
+
+if __name__ == "__main__":
+    main()
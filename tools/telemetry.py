@@ -0,0 +1,455 @@
+#!/usr/bin/env python3
+#******************************************************************************
+#
+# telemetry.py - Decoder and recorder for the binary UART telemetry stream.
+#
+# Reads the UART0 output of the display board from a serial port, a file or
+# standard input, splits it into COBS frames and console text (see
+# telemetry.c for the frame format) and
+#
+#   - prints the console text and a one line summary of each metrics and link
+#     frame,
+#   - optionally records the raw stream, so that it can be decoded again
+#     later with this tool,
+#   - optionally writes the registers and the metrics to CSV files.
+#
+# Examples:
+#
+#   telemetry.py /dev/ttyACM0 --record run.bin
+#   telemetry.py /dev/ttyACM0 --baud 921600
+#   telemetry.py run.bin --regs regs.csv --metrics metrics.csv --quiet
+#   telemetry.py --selftest
+#
+# On a serial port the tool first moves the board to the --baud rate with the
+# console baud command handshake (see Cmd_baud in ZC706_SPI_Display.c), and
+# falls back to 115200 if the board does not confirm the new rate.
+#
+# --selftest decodes a made-up stream with a lost frame and checks the
+# registers that come out; "make -C sim test" runs it.
+#
+# Reading a serial port needs pyserial; files and pipes need nothing beyond
+# the standard library.
+#
+#******************************************************************************
+
+import argparse
+import csv
+import struct
+import sys
+import time
+import types
+
+TLM_TYPE_KEY = 0x01
+TLM_TYPE_DELTA = 0x02
+TLM_TYPE_METRICS = 0x03
+TLM_TYPE_LINK = 0x04
+
+METRIC_NAMES = ["AGC", "Lock", "Hold", "EVM", "Frame", "CRC", "BER"]
+LEVEL_NAMES = ["green", "yellow", "red"]
+BAUD_DEFAULT = 115200
+BAUD_PROBE = [230400, 460800, 921600, 1000000, 2000000]
+
+LINK_NAMES = ["frames", "sync_errors", "frame_rate", "sync_rate",
+              "tlm_frames", "tlm_bytes", "uart_drops", "uart_max_used"]
+
+
+def crc16(data):
+    """CRC-16/CCITT, polynomial 0x1021, initial value 0xFFFF."""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_decode(data):
+    """Decodes one COBS block, or returns None if it is malformed."""
+    out = bytearray()
+    idx = 0
+    while idx < len(data):
+        code = data[idx]
+        if code == 0 or idx + code > len(data):
+            return None
+        out += data[idx + 1:idx + code]
+        idx += code
+        if code < 0xFF and idx < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def varint(data, pos):
+    """Decodes a zig-zag varint; returns the value and the next position."""
+    value = 0
+    shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            break
+    value &= 0xFFFFFFFF
+    return (value >> 1) ^ -(value & 1), pos
+
+
+def is_text(block):
+    """Console text never contains control characters other than white
+    space."""
+    return all(b >= 0x20 or b in b"\r\n\t" for b in block)
+
+
+def frame_decode(block):
+    """Returns (type, sequence, time, payload) or None if not a frame."""
+    frame = cobs_decode(block)
+    if frame is None or len(frame) < 9:
+        return None
+    if crc16(frame[:-2]) != struct.unpack_from("<H", frame, len(frame) - 2)[0]:
+        return None
+    ftype, seq, time = struct.unpack_from("<BHI", frame, 0)
+    if ftype not in (TLM_TYPE_KEY, TLM_TYPE_DELTA, TLM_TYPE_METRICS,
+                     TLM_TYPE_LINK):
+        return None
+    return ftype, seq, time, frame[7:-2]
+
+
+class Decoder:
+    """Splits the stream on zero bytes and tracks the register state."""
+
+    def __init__(self, args):
+        self.args = args
+        self.pending = bytearray()
+        self.regs = None
+        self.seq = None
+        self.frames = 0
+        self.lost = 0
+        self.bad = 0
+        self.regs_csv = None
+        self.metrics_csv = None
+        if args.regs:
+            self.regs_file = open(args.regs, "w", newline="")
+            self.regs_csv = csv.writer(self.regs_file)
+        if args.metrics:
+            self.metrics_file = open(args.metrics, "w", newline="")
+            self.metrics_csv = csv.writer(self.metrics_file)
+            header = ["time_ms", "samples", "error_count", "bit_count"]
+            for name in METRIC_NAMES:
+                header += [name + "_level", name + "_last", name + "_min",
+                           name + "_max", name + "_mean"]
+            self.metrics_csv.writerow(header)
+
+    def feed(self, data):
+        self.pending += data
+        while True:
+            end = self.pending.find(0)
+            if end < 0:
+                break
+            block = bytes(self.pending[:end])
+            del self.pending[:end + 1]
+            if block:
+                self.block(block)
+
+        #
+        # Print whole lines of text at once instead of at the next delimiter,
+        # which does not come while the telemetry is stopped.  The second
+        # byte of a frame is its type, a control character, so text cannot
+        # be the start of a frame.
+        #
+        end = self.pending.rfind(b"\n")
+        if end > 0 and is_text(self.pending[:end + 1]):
+            self.text(bytes(self.pending[:end + 1]))
+            del self.pending[:end + 1]
+
+    def text(self, block):
+        if not self.args.quiet:
+            sys.stdout.write(block.decode("ascii", "replace"))
+
+    def block(self, block):
+        decoded = frame_decode(block)
+        if decoded is None:
+            #
+            # Console text, or a frame damaged in transit.
+            #
+            if is_text(block):
+                self.text(block)
+            else:
+                self.bad += 1
+            return
+
+        ftype, seq, time, payload = decoded
+        self.frames += 1
+        if self.seq is not None and seq != ((self.seq + 1) & 0xFFFF):
+            #
+            # Any lost frame may have been a key or delta frame, whatever
+            # the frame that shows the gap, so the registers are unknown
+            # until the next key frame.
+            #
+            self.lost += (seq - self.seq - 1) & 0xFFFF
+            if ftype != TLM_TYPE_KEY:
+                self.regs = None
+        self.seq = seq
+
+        if ftype == TLM_TYPE_KEY:
+            count = payload[0]
+            pos = 1
+            regs = []
+            for _ in range(count):
+                value, pos = varint(payload, pos)
+                regs.append(value)
+            self.regs = regs
+            self.regs_row(time)
+        elif ftype == TLM_TYPE_DELTA:
+            if self.regs is None:
+                #
+                # A frame was lost since the last key frame; wait for the
+                # next one.
+                #
+                return
+            pos = 0
+            while pos < len(payload):
+                index = payload[pos]
+                delta, pos = varint(payload, pos + 1)
+                value = (self.regs[index] + delta) & 0xFFFFFFFF
+                self.regs[index] = value - (1 << 32) if value >> 31 else value
+            self.regs_row(time)
+        elif ftype == TLM_TYPE_METRICS:
+            self.metrics(time, payload)
+        elif ftype == TLM_TYPE_LINK:
+            self.link(time, payload)
+
+    def regs_row(self, time):
+        if self.regs_csv:
+            self.regs_csv.writerow([time] + self.regs)
+
+    def metrics(self, time, payload):
+        samples, errors, bits, count = struct.unpack_from("<IIIB", payload, 0)
+        pos = 13
+        row = [time, samples, errors, bits]
+        summary = []
+        for idx in range(count):
+            level, last, vmin, vmax, mean = struct.unpack_from("<Bffff",
+                                                               payload, pos)
+            pos += 17
+            row += [level, last, vmin, vmax, mean]
+            name = METRIC_NAMES[idx] if idx < len(METRIC_NAMES) else str(idx)
+            summary.append("%s=%.3f%s" % (name, last,
+                                          "" if level == 0 else
+                                          "(" + LEVEL_NAMES[min(level, 2)] +
+                                          ")"))
+        if self.metrics_csv:
+            self.metrics_csv.writerow(row)
+        if not self.args.quiet:
+            print("[%9.3f] %s" % (time / 1000.0, " ".join(summary)))
+
+    def link(self, time, payload):
+        count = payload[0]
+        values = struct.unpack_from("<%dI" % count, payload, 1)
+        if not self.args.quiet:
+            names = LINK_NAMES + [str(i) for i in range(len(LINK_NAMES),
+                                                        count)]
+            print("[%9.3f] link %s" % (time / 1000.0,
+                                       " ".join("%s=%d" % (names[i], v)
+                                                for i, v in
+                                                enumerate(values))))
+
+    def close(self):
+        if self.pending:
+            self.block(bytes(self.pending))
+        for name in ("regs_file", "metrics_file"):
+            if hasattr(self, name):
+                getattr(self, name).close()
+        print("%d frames, %d lost, %d damaged" % (self.frames, self.lost,
+                                                  self.bad), file=sys.stderr)
+
+
+def cobs_encode(data):
+    """Encodes one COBS block, as telemetry.c does."""
+    out = bytearray()
+    for chunk in data.split(b"\0"):
+        while len(chunk) >= 0xFE:
+            out += bytes([0xFF]) + chunk[:0xFE]
+            chunk = chunk[0xFE:]
+        out += bytes([len(chunk) + 1]) + chunk
+    return bytes(out)
+
+
+def varint_encode(value):
+    """Encodes a zig-zag varint."""
+    value = ((value << 1) ^ (value >> 31)) & 0xFFFFFFFF
+    out = bytearray()
+    while value >= 0x80:
+        out.append((value & 0x7F) | 0x80)
+        value >>= 7
+    out.append(value)
+    return bytes(out)
+
+
+def frame_encode(ftype, seq, time, payload):
+    frame = struct.pack("<BHI", ftype, seq, time) + payload
+    frame += struct.pack("<H", crc16(frame))
+    return b"\0" + cobs_encode(frame) + b"\0"
+
+
+def selftest():
+    """Decodes a stream in which a delta frame is lost ahead of a metrics
+    frame: the delta after the gap must not be applied to the stale
+    registers, and the rows resume at the next key frame."""
+    key = bytes([4]) + b"".join(varint_encode(v) for v in (1, 2, 3, 4))
+    frames = [
+        frame_encode(TLM_TYPE_KEY, 0, 0, key),
+        frame_encode(TLM_TYPE_DELTA, 1, 10,
+                     bytes([2]) + varint_encode(10)),
+        frame_encode(TLM_TYPE_DELTA, 2, 20,
+                     bytes([0]) + varint_encode(10)),
+        frame_encode(TLM_TYPE_METRICS, 3, 30,
+                     struct.pack("<IIIB", 0, 0, 0, 0)),
+        frame_encode(TLM_TYPE_DELTA, 4, 40,
+                     bytes([1]) + varint_encode(-1)),
+        frame_encode(TLM_TYPE_KEY, 5, 1000,
+                     bytes([4]) + b"".join(varint_encode(v)
+                                           for v in (11, 1, 13, 4))),
+    ]
+    del frames[2]
+
+    rows = []
+    decoder = Decoder(argparse.Namespace(regs=None, metrics=None,
+                                         quiet=True))
+    decoder.regs_csv = types.SimpleNamespace(writerow=rows.append)
+    decoder.feed(b"".join(frames))
+    expected = [[0, 1, 2, 3, 4], [10, 1, 2, 13, 4], [1000, 11, 1, 13, 4]]
+    if rows != expected or decoder.lost != 1:
+        print("selftest: rows %s, %d lost; expected %s, 1 lost" %
+              (rows, decoder.lost, expected), file=sys.stderr)
+        return False
+    return True
+
+
+def wait_for(port, patterns, timeout):
+    """Reads the port until one of the byte strings arrives; returns its
+    index, or None after the timeout."""
+    data = bytearray()
+    end = time.monotonic() + timeout
+    while time.monotonic() < end:
+        data += port.read(4096)
+        for idx, pattern in enumerate(patterns):
+            if pattern in data:
+                return idx
+    return None
+
+
+def negotiate(port, baud):
+    """Moves the board and the port to the baud rate, and returns the rate
+    they end up at.  The board is at 115200 after a reset but may still be
+    at a rate set by an earlier run, so the baud command is tried at 115200,
+    the requested rate and the usual fast rates in turn.  The board replies
+    at its current rate, then switches and keeps the new rate only if baud
+    ok arrives at it within two seconds."""
+    request = b"\rbaud %d\r" % baud
+    switching = b"Baud %d," % baud
+    current = b"Baud %d\r" % baud
+    rates = [BAUD_DEFAULT, baud] + BAUD_PROBE
+    for rate in sorted(set(rates), key=rates.index):
+        port.baudrate = rate
+        port.reset_input_buffer()
+        port.write(request)
+        found = wait_for(port, [switching, current], 0.5)
+        if found == 1:
+            return baud
+        if found == 0:
+            break
+    else:
+        print("baud: no reply from the board, staying at %d" % BAUD_DEFAULT,
+              file=sys.stderr)
+        port.baudrate = BAUD_DEFAULT
+        return BAUD_DEFAULT
+
+    #
+    # The board switches once its output has drained; a confirmation sent
+    # too early is lost, so it is repeated.
+    #
+    time.sleep(0.1)
+    port.baudrate = baud
+    confirmed = b"Baud %d confirmed" % baud
+    for _ in range(3):
+        port.write(b"\rbaud ok\r")
+        if wait_for(port, [confirmed], 0.4) is not None:
+            return baud
+
+    #
+    # Let the board restore its rate before following it.
+    #
+    print("baud: %d not confirmed, falling back to %d" % (baud, BAUD_DEFAULT),
+          file=sys.stderr)
+    time.sleep(2.0)
+    port.baudrate = BAUD_DEFAULT
+    port.reset_input_buffer()
+    return BAUD_DEFAULT
+
+
+def open_source(args):
+    """Returns a function that reads the next chunk of the stream."""
+    if args.source == "-":
+        stream = sys.stdin.buffer
+        return lambda: stream.read1(4096) or None
+    if args.source.startswith("/dev/") or args.source.upper().startswith(
+            "COM"):
+        import serial
+        port = serial.Serial(args.source, BAUD_DEFAULT, timeout=0.1)
+        if args.no_handshake:
+            port.baudrate = args.baud
+        else:
+            rate = negotiate(port, args.baud)
+            print("baud: %d" % rate, file=sys.stderr)
+        return lambda: port.read(4096) or b""
+    stream = open(args.source, "rb")
+    return lambda: stream.read(4096) or None
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Decode and record the display board telemetry stream.")
+    parser.add_argument("source", nargs="?", help="serial port, recorded "
+                        "file or - for standard input")
+    parser.add_argument("--baud", type=int, default=BAUD_DEFAULT,
+                        help="baud rate to move the board to, for example "
+                        "921600 (default 115200)")
+    parser.add_argument("--no-handshake", action="store_true",
+                        help="open the port at --baud without asking the "
+                        "board to change its rate")
+    parser.add_argument("--record", help="append the raw stream to a file")
+    parser.add_argument("--regs", help="write the registers to a CSV file")
+    parser.add_argument("--metrics", help="write the metrics to a CSV file")
+    parser.add_argument("--quiet", action="store_true",
+                        help="do not print text and frame summaries")
+    parser.add_argument("--selftest", action="store_true",
+                        help="check the decoder on a stream with a lost "
+                        "frame, and exit")
+    args = parser.parse_args()
+
+    if args.selftest:
+        sys.exit(0 if selftest() else 1)
+    if args.source is None:
+        parser.error("the source is required")
+
+    read = open_source(args)
+    record = open(args.record, "ab") if args.record else None
+    decoder = Decoder(args)
+    try:
+        while True:
+            data = read()
+            if data is None:
+                break
+            if record:
+                record.write(data)
+            decoder.feed(data)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if record:
+            record.close()
+        decoder.close()
+
+
+if __name__ == "__main__":
+    main()
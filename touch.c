@@ -24,8 +24,11 @@
 #include "driverlib/interrupt.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/timer.h"
+#include "driverlib/udma.h"
 #include "grlib/grlib.h"
 #include "grlib/widget.h"
+#include "defines.h"
+#include "irq.h"
 #include "touch.h"
 #include "Kentec320x240x16_ssd2119_8bit.h"
 
@@ -84,6 +87,20 @@
 #define ADC_CTL_CH_XP ADC_CTL_CH9
 #define ADC_CTL_CH_YP ADC_CTL_CH8
 
+//*****************************************************************************
+//
+// The rate at which the ADC trigger timer starts a sample of one axis.  When
+// the samples are moved by the uDMA each axis is sampled once, rather than
+// once to let it settle and once to read it, so half the rate gives the same
+// 250 X/Y pairs per second.
+//
+//*****************************************************************************
+#ifdef TOUCH_DMA_ENABLE
+#define TS_TRIGGER_HZ           500
+#else
+#define TS_TRIGGER_HZ           1000
+#endif
+
 //*****************************************************************************
 //
 // The coefficients used to convert from the ADC touch screen readings to the
@@ -220,10 +237,38 @@ static uint32_t g_ulTSState;
 #define TS_STATE_SKIP_X         3
 #define TS_STATE_SKIP_Y         4
 
+#ifdef TOUCH_DMA_ENABLE
+//*****************************************************************************
+//
+// The readings of one axis, one per step of ADC sample sequence 0, as moved
+// there by the uDMA.  All steps of the sequence sample the same input.
+//
+//*****************************************************************************
+#define TS_NUM_READINGS         8
+static uint32_t g_pui32TSReadings[TS_NUM_READINGS];
+
+//*****************************************************************************
+//
+// The SSMUX0 value that has every step of the sequence sample an input.
+//
+//*****************************************************************************
+#define TS_MUX_ALL(ui32Channel) ((ui32Channel) * 0x11111111)
+
+//*****************************************************************************
+//
+// The state of the IIR filters of the X and Y readings, in 1/16ths of an ADC
+// count, or -1 when the pen is up and the next reading restarts the filter.
+//
+//*****************************************************************************
+static int32_t g_i32TSFilterX = -1;
+static int32_t g_i32TSFilterY = -1;
+#endif
+
 //*****************************************************************************
 //
 // The most recent raw ADC reading for the X position on the screen.  This
-// value is not affected by the selected screen orientation.
+// value is not affected by the selected screen orientation.  When sampling
+// through uDMA it is the filtered reading.
 //
 //*****************************************************************************
 volatile int16_t g_sTouchX;
@@ -271,6 +316,107 @@ static int16_t g_psSamples[8];
 //*****************************************************************************
 static int8_t g_cIndex = 0;
 
+//*****************************************************************************
+//
+// The calibration parameters as prepared by TouchScreenCalibrationSet() for
+// the transform from the raw readings to pixels.  The sign of M6 is folded
+// into M0 to M5, and the division by M6 is done as a multiplication by the
+// reciprocal of its magnitude, a fixed-point value of g_ui32TSShift fraction
+// bits.
+//
+//*****************************************************************************
+static int32_t g_plTSCoeffs[6];
+static uint32_t g_ui32TSRecip;
+static uint32_t g_ui32TSShift;
+
+//*****************************************************************************
+//
+// Divides a sum of the transform by M6, rounding toward zero as an integer
+// division does.
+//
+//*****************************************************************************
+static int32_t
+TouchScreenScale(int32_t lSum)
+{
+    uint32_t ui32Mag;
+
+    ui32Mag = (lSum < 0) ? (0 - (uint32_t)lSum) : (uint32_t)lSum;
+    ui32Mag = ((uint64_t)ui32Mag * g_ui32TSRecip) >> g_ui32TSShift;
+
+    return((lSum < 0) ? -(int32_t)ui32Mag : (int32_t)ui32Mag);
+}
+
+//*****************************************************************************
+//
+//! Sets the calibration parameters of the touch screen.
+//!
+//! \param plParms points to the seven calibration parameters M0 to M6.
+//!
+//! This function prepares the parameters for TouchScreenTransform(), which is
+//! run for every X/Y sample pair in interrupt context.  A division by M6 of a
+//! value below 2^31 gives the same quotient as a multiplication by
+//! ceil(2^S / M6) shifted right by S, when 2^(S - 31) is at least M6; the
+//! product takes 64 bits.  The one division is made here instead.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TouchScreenCalibrationSet(const int32_t *plParms)
+{
+    uint32_t ui32Idx, ui32Div;
+
+    g_plParmSet = plParms;
+
+    ui32Div = (plParms[6] < 0) ? (0 - (uint32_t)plParms[6]) : plParms[6];
+    for(ui32Idx = 0; ui32Idx < 6; ui32Idx++)
+    {
+        g_plTSCoeffs[ui32Idx] = (plParms[6] < 0) ? -plParms[ui32Idx] :
+                                plParms[ui32Idx];
+    }
+
+    //
+    // Find the smallest shift that keeps the quotients exact, and round the
+    // reciprocal up.  It then fits in 32 bits.
+    //
+    for(g_ui32TSShift = 31;
+        ((uint64_t)1 << (g_ui32TSShift - 31)) < ui32Div;
+        g_ui32TSShift++)
+    {
+    }
+    g_ui32TSRecip = ((((uint64_t)1 << g_ui32TSShift) + ui32Div - 1) /
+                     ui32Div);
+}
+
+//*****************************************************************************
+//
+//! Converts raw touch screen readings to a screen position.
+//!
+//! \param lRawX is the raw X reading.
+//! \param lRawY is the raw Y reading.
+//! \param plX is a pointer to the X position in pixels.
+//! \param plY is a pointer to the Y position in pixels.
+//!
+//! This function applies the calibration set by TouchScreenCalibrationSet():
+//!
+//!     x = (rx * M0 + ry * M1 + M2) / M6
+//!     y = (rx * M3 + ry * M4 + M5) / M6
+//!
+//! with the result of an integer division, but without dividing.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TouchScreenTransform(int32_t lRawX, int32_t lRawY, int32_t *plX,
+                     int32_t *plY)
+{
+    *plX = TouchScreenScale((lRawX * g_plTSCoeffs[0]) +
+                            (lRawY * g_plTSCoeffs[1]) + g_plTSCoeffs[2]);
+    *plY = TouchScreenScale((lRawX * g_plTSCoeffs[3]) +
+                            (lRawY * g_plTSCoeffs[4]) + g_plTSCoeffs[5]);
+}
+
 //*****************************************************************************
 //
 //! Debounces presses of the touch screen.
@@ -284,18 +430,12 @@ static int8_t g_cIndex = 0;
 static void
 TouchScreenDebouncer(void)
 {
-    int32_t lX, lY, lTemp;
+    int32_t lX, lY;
 
     //
     // Convert the ADC readings into pixel values on the screen.
     //
-    lX = g_sTouchX;
-    lY = g_sTouchY;
-    lTemp = (((lX * g_plParmSet[0]) + (lY * g_plParmSet[1]) + g_plParmSet[2]) /
-             g_plParmSet[6]);
-    lY = (((lX * g_plParmSet[3]) + (lY * g_plParmSet[4]) + g_plParmSet[5]) /
-          g_plParmSet[6]);
-    lX = lTemp;
+    TouchScreenTransform(g_sTouchX, g_sTouchY, &lX, &lY);
 
     //
     // See if the touch screen is being touched.
@@ -455,6 +595,239 @@ TouchScreenDebouncer(void)
     }
 }
 
+#ifdef TOUCH_DMA_ENABLE
+//*****************************************************************************
+//
+// Drives one side of the X axis touch layer with VDD and the other with GND,
+// and both sides of the Y axis layer with GND to discharge any residual
+// voltage (so that a no-touch condition can be properly detected).
+//
+//*****************************************************************************
+static void
+TouchScreenDriveX(void)
+{
+    HWREG(TS_P_BASE + GPIO_O_AMSEL) =
+        HWREG(TS_P_BASE + GPIO_O_AMSEL) & ~(TS_XP_PIN | TS_YP_PIN);
+    HWREG(TS_P_BASE + GPIO_O_DATA + ((TS_XP_PIN | TS_YP_PIN) << 2)) =
+        TS_XP_PIN;
+    HWREG(TS_N_BASE + GPIO_O_DATA + ((TS_XN_PIN | TS_YN_PIN) << 2)) = 0;
+    HWREG(TS_P_BASE + GPIO_O_DIR) =
+        HWREG(TS_P_BASE + GPIO_O_DIR) | TS_XP_PIN | TS_YP_PIN;
+    HWREG(TS_N_BASE + GPIO_O_DIR) =
+        HWREG(TS_N_BASE + GPIO_O_DIR) | TS_XN_PIN | TS_YN_PIN;
+}
+
+//*****************************************************************************
+//
+// Drives one side of the Y axis touch layer with VDD and the other with GND,
+// and both sides of the X axis layer with GND to discharge it.
+//
+//*****************************************************************************
+static void
+TouchScreenDriveY(void)
+{
+    HWREG(TS_P_BASE + GPIO_O_AMSEL) =
+        HWREG(TS_P_BASE + GPIO_O_AMSEL) & ~(TS_XP_PIN | TS_YP_PIN);
+    HWREG(TS_P_BASE + GPIO_O_DATA + ((TS_XP_PIN | TS_YP_PIN) << 2)) =
+        TS_YP_PIN;
+    HWREG(TS_N_BASE + GPIO_O_DATA + ((TS_XN_PIN | TS_YN_PIN) << 2)) = 0;
+    HWREG(TS_P_BASE + GPIO_O_DIR) =
+        HWREG(TS_P_BASE + GPIO_O_DIR) | TS_XP_PIN | TS_YP_PIN;
+    HWREG(TS_N_BASE + GPIO_O_DIR) =
+        HWREG(TS_N_BASE + GPIO_O_DIR) | TS_XN_PIN | TS_YN_PIN;
+}
+
+//*****************************************************************************
+//
+// Releases the discharged layer so that it can be sampled: the pins of the
+// layer become inputs, and the positive one an analog input.  With bX set the
+// Y axis layer is released, which is sampled to read the X position.
+//
+//*****************************************************************************
+static void
+TouchScreenRelease(bool bX)
+{
+    uint32_t ui32PPin, ui32NPin;
+
+    ui32PPin = bX ? TS_YP_PIN : TS_XP_PIN;
+    ui32NPin = bX ? TS_YN_PIN : TS_XN_PIN;
+
+    HWREG(TS_P_BASE + GPIO_O_AMSEL) =
+        HWREG(TS_P_BASE + GPIO_O_AMSEL) | ui32PPin;
+    HWREG(TS_P_BASE + GPIO_O_DIR) = HWREG(TS_P_BASE + GPIO_O_DIR) & ~ui32PPin;
+    HWREG(TS_N_BASE + GPIO_O_DIR) = HWREG(TS_N_BASE + GPIO_O_DIR) & ~ui32NPin;
+}
+
+//*****************************************************************************
+//
+// Selects the input that the next run of the ADC sequence samples, and sets
+// up the uDMA to move the readings of the run to g_pui32TSReadings.  The uDMA
+// interrupts on the ADC sequence interrupt once it has moved all of them.
+//
+//*****************************************************************************
+static void
+TouchScreenSampleStart(uint32_t ui32Channel)
+{
+    HWREG(ADC0_BASE + ADC_O_SSMUX0) = TS_MUX_ALL(ui32Channel);
+
+    uDMAChannelTransferSet(UDMA_CHANNEL_ADC0 | UDMA_PRI_SELECT,
+                           UDMA_MODE_BASIC,
+                           (void *)(ADC0_BASE + ADC_O_SSFIFO0),
+                           g_pui32TSReadings, TS_NUM_READINGS);
+    uDMAChannelEnable(UDMA_CHANNEL_ADC0);
+}
+
+//*****************************************************************************
+//
+// Returns the median of the readings of an axis, which discards the readings
+// disturbed by a spike as long as fewer than half of them are.
+//
+//*****************************************************************************
+static int16_t
+TouchScreenMedian(void)
+{
+    uint32_t ui32Idx, ui32Pos, ui32Value;
+
+    //
+    // Sort the readings with an insertion sort, which is the quickest for so
+    // few of them.
+    //
+    for(ui32Idx = 1; ui32Idx < TS_NUM_READINGS; ui32Idx++)
+    {
+        ui32Value = g_pui32TSReadings[ui32Idx];
+        for(ui32Pos = ui32Idx;
+            (ui32Pos > 0) && (g_pui32TSReadings[ui32Pos - 1] > ui32Value);
+            ui32Pos--)
+        {
+            g_pui32TSReadings[ui32Pos] = g_pui32TSReadings[ui32Pos - 1];
+        }
+        g_pui32TSReadings[ui32Pos] = ui32Value;
+    }
+
+    //
+    // With an even number of readings, the median is the mean of the middle
+    // two.
+    //
+    return((g_pui32TSReadings[(TS_NUM_READINGS / 2) - 1] +
+            g_pui32TSReadings[TS_NUM_READINGS / 2] + 1) / 2);
+}
+
+//*****************************************************************************
+//
+// Passes a reading through an IIR filter, which restarts from the reading if
+// its state is -1, and returns the filtered reading.
+//
+//*****************************************************************************
+static int16_t
+TouchScreenFilter(int32_t *pi32State, int16_t i16Reading)
+{
+    if(*pi32State < 0)
+    {
+        *pi32State = (int32_t)i16Reading << 4;
+    }
+    else
+    {
+        *pi32State += ((((int32_t)i16Reading << 4) - *pi32State) >>
+                       TOUCH_IIR_SHIFT);
+    }
+
+    return((*pi32State + 8) >> 4);
+}
+
+//*****************************************************************************
+//
+//! Handles the ADC interrupt for the touch screen.
+//!
+//! This function is called when the uDMA has moved the readings of one axis
+//! from ADC sample sequence 0.  The median of the readings is taken, and the
+//! touch screen is set up to sample the other axis at the next trigger; after
+//! the Y axis, the X/Y pair is filtered and passed to the debouncer.
+//!
+//! It is the responsibility of the application using the touch screen driver
+//! to ensure that this function is installed in the interrupt vector table for
+//! the ADC0 sequence 0 interrupt.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TouchScreenIntHandler(void)
+{
+    //
+    // The sequence was triggered when the ADC trigger timer expired, and the
+    // timer has been counting down from its load value since.  The latency
+    // includes the conversion time of all the oversampled readings.
+    //
+    IRQ_LATENCY(IRQ_TOUCH, (TimerLoadGet(TIMER1_BASE, TIMER_A) -
+                            TimerValueGet(TIMER1_BASE, TIMER_A)));
+
+    //
+    // Clear the ADC sample sequence interrupt.
+    //
+    HWREG(ADC0_BASE + ADC_O_ISC) = 1 << 0;
+
+    //
+    // The end of the sequence interrupts as well; wait for the uDMA to have
+    // moved the last reading.
+    //
+    if(uDMAChannelModeGet(UDMA_CHANNEL_ADC0 | UDMA_PRI_SELECT) !=
+       UDMA_MODE_STOP)
+    {
+        return;
+    }
+
+    if(g_ulTSState == TS_STATE_READ_X)
+    {
+        //
+        // Drive the Y axis layer, which starts discharging the X axis layer
+        // while the readings are processed, and keep the X reading.
+        //
+        TouchScreenDriveY();
+        g_sTouchX = TouchScreenMedian();
+
+        //
+        // Sample the X axis layer at the next trigger.
+        //
+        TouchScreenSampleStart(ADC_CTL_CH_XP);
+        TouchScreenRelease(false);
+        g_ulTSState = TS_STATE_READ_Y;
+    }
+    else
+    {
+        TouchScreenDriveX();
+
+        if(g_ulTSState == TS_STATE_READ_Y)
+        {
+            g_sTouchY = TouchScreenMedian();
+
+            //
+            // Filter a pair taken while the screen is touched.  A pair taken
+            // while it is not is passed on as it is, so that the debouncer
+            // sees the pen go up, and restarts the filters.
+            //
+            if((g_sTouchX < g_sTouchMin) || (g_sTouchY < g_sTouchMin))
+            {
+                g_i32TSFilterX = -1;
+                g_i32TSFilterY = -1;
+            }
+            else
+            {
+                g_sTouchX = TouchScreenFilter(&g_i32TSFilterX, g_sTouchX);
+                g_sTouchY = TouchScreenFilter(&g_i32TSFilterY, g_sTouchY);
+            }
+
+            TouchScreenDebouncer();
+        }
+
+        //
+        // Sample the Y axis layer at the next trigger.
+        //
+        TouchScreenSampleStart(ADC_CTL_CH_YP);
+        TouchScreenRelease(true);
+        g_ulTSState = TS_STATE_READ_X;
+    }
+}
+#else
 //*****************************************************************************
 //
 //! Handles the ADC interrupt for the touch screen.
@@ -473,6 +846,14 @@ TouchScreenDebouncer(void)
 void
 TouchScreenIntHandler(void)
 {
+    //
+    // The sample was triggered when the ADC trigger timer expired, and the
+    // timer has been counting down from its load value since.  The latency
+    // includes the conversion time of the oversampled reading.
+    //
+    IRQ_LATENCY(IRQ_TOUCH, (TimerLoadGet(TIMER1_BASE, TIMER_A) -
+                            TimerValueGet(TIMER1_BASE, TIMER_A)));
+
     //
     // Clear the ADC sample sequence interrupt.
     //
@@ -711,6 +1092,7 @@ TouchScreenIntHandler(void)
         }
     }
 }
+#endif
 
 //*****************************************************************************
 //
@@ -720,15 +1102,22 @@ TouchScreenIntHandler(void)
 //! reading from the touch screen.  This driver uses the following hardware
 //! resources:
 //!
-//! - ADC sample sequence 3
+//! - ADC sample sequence 3, or sample sequence 0 and uDMA channel 14 when
+//!   TOUCH_DMA_ENABLE is defined
 //! - Timer 1 subtimer A
 //!
+//! When sampling through uDMA, the uDMA controller must have been enabled.
+//!
 //! \return None.
 //
 //*****************************************************************************
 void
 TouchScreenInit(void)
 {
+#ifdef TOUCH_DMA_ENABLE
+    uint32_t ui32Step;
+#endif
+
     //
     // Set the initial state of the touch screen driver's state machine.
     //
@@ -748,6 +1137,11 @@ TouchScreenInit(void)
     //    g_sTouchMin = 40;
     }
 
+    //
+    // Prepare the selected parameters for the transform.
+    //
+    TouchScreenCalibrationSet(g_plParmSet);
+
     //
     // There is no touch screen handler initially.
     //
@@ -765,6 +1159,34 @@ TouchScreenInit(void)
     // Configure the ADC sample sequence used to read the touch screen reading.
     //
     ADCHardwareOversampleConfigure(ADC0_BASE, 4);
+#ifdef TOUCH_DMA_ENABLE
+    //
+    // Every step samples the same input, and the last one ends the sequence.
+    // The uDMA moves each reading from the FIFO as it is converted.
+    //
+    ADCSequenceConfigure(ADC0_BASE, 0, ADC_TRIGGER_TIMER, 0);
+    for(ui32Step = 0; ui32Step < TS_NUM_READINGS; ui32Step++)
+    {
+        ADCSequenceStepConfigure(ADC0_BASE, 0, ui32Step,
+                                 (ADC_CTL_CH_YP |
+                                  ((ui32Step == (TS_NUM_READINGS - 1)) ?
+                                   (ADC_CTL_END | ADC_CTL_IE) : 0)));
+    }
+    ADCSequenceEnable(ADC0_BASE, 0);
+
+    uDMAChannelAttributeDisable(UDMA_CHANNEL_ADC0, UDMA_ATTR_ALL);
+    uDMAChannelControlSet(UDMA_CHANNEL_ADC0 | UDMA_PRI_SELECT,
+                          (UDMA_SIZE_32 | UDMA_SRC_INC_NONE |
+                           UDMA_DST_INC_32 | UDMA_ARB_1));
+    ADCSequenceDMAEnable(ADC0_BASE, 0);
+
+    //
+    // Enable the ADC sample sequence interrupt, which the uDMA raises once it
+    // has moved all the readings.
+    //
+    ADCIntEnable(ADC0_BASE, 0);
+    IntEnable(INT_ADC0SS0);
+#else
     ADCSequenceConfigure(ADC0_BASE, 3, ADC_TRIGGER_TIMER, 0);
     ADCSequenceStepConfigure(ADC0_BASE, 3, 0,
                              ADC_CTL_CH_YP | ADC_CTL_END | ADC_CTL_IE);
@@ -775,6 +1197,7 @@ TouchScreenInit(void)
     //
     ADCIntEnable(ADC0_BASE, 3);
     IntEnable(INT_ADC0SS3);
+#endif
 
     //
     // Configure the GPIOs used to drive the touch screen layers.
@@ -800,6 +1223,16 @@ TouchScreenInit(void)
     //    HWREGB(LCD_CONTROL_CLR_REG) = LCD_CONTROL_XN | LCD_CONTROL_YN;
     }
 
+#ifdef TOUCH_DMA_ENABLE
+    //
+    // Sample the Y axis layer, for the X position, at the first trigger.
+    //
+    TouchScreenDriveX();
+    TouchScreenSampleStart(ADC_CTL_CH_YP);
+    TouchScreenRelease(true);
+    g_ulTSState = TS_STATE_READ_X;
+#endif
+
     //
     // See if the ADC trigger timer has been configured, and configure it only
     // if it has not been configured yet.
@@ -808,17 +1241,18 @@ TouchScreenInit(void)
     {
         //
         // Configure the timer to trigger the sampling of the touch screen
-        // every millisecond.
+        // TS_TRIGGER_HZ times per second.  The period does not fit the 16
+        // bits of a split timer at the system clock, so the timer runs at
+        // full width.
         //
-        TimerConfigure(TIMER1_BASE, (TIMER_CFG_SPLIT_PAIR |
-                                     TIMER_CFG_A_PERIODIC |
-                                     TIMER_CFG_B_PERIODIC));
-        TimerLoadSet(TIMER1_BASE, TIMER_A, (SysCtlClockGet() / 1000) - 1);
+        TimerConfigure(TIMER1_BASE, TIMER_CFG_PERIODIC);
+        TimerLoadSet(TIMER1_BASE, TIMER_A,
+                     (SysCtlClockGet() / TS_TRIGGER_HZ) - 1);
         TimerControlTrigger(TIMER1_BASE, TIMER_A, true);
 
         //
         // Enable the timer.  At this point, the touch screen state machine
-        // will sample and run once per millisecond.
+        // will sample and run at every trigger.
         //
         TimerEnable(TIMER1_BASE, TIMER_A);
     }
@@ -15,6 +15,17 @@
 //*****************************************************************************
 #define TOUCH_MIN 150
 
+//*****************************************************************************
+//
+// The interrupt of the ADC sample sequence that reads the touch screen.
+//
+//*****************************************************************************
+#ifdef TOUCH_DMA_ENABLE
+#define TOUCH_INT               INT_ADC0SS0
+#else
+#define TOUCH_INT               INT_ADC0SS3
+#endif
+
 //*****************************************************************************
 //
 // Prototypes for the functions exported by the touch screen driver.
@@ -25,6 +36,9 @@ extern volatile short g_sTouchY;
 extern short g_sTouchMin;
 extern void TouchScreenIntHandler(void);
 extern void TouchScreenInit(void);
+extern void TouchScreenCalibrationSet(const int32_t *plParms);
+extern void TouchScreenTransform(int32_t lRawX, int32_t lRawY, int32_t *plX,
+                                 int32_t *plY);
 extern void TouchScreenCallbackSet(int32_t (*pfnCallback)(uint32_t ulMessage,
                                                        int32_t lX, int32_t lY));
 